@@ -39,6 +39,7 @@
 #include <stan/math/prim/fun/ceil.hpp>
 #include <stan/math/prim/fun/chol2inv.hpp>
 #include <stan/math/prim/fun/cholesky_decompose.hpp>
+#include <stan/math/prim/fun/cholesky_update.hpp>
 #include <stan/math/prim/fun/choose.hpp>
 #include <stan/math/prim/fun/col.hpp>
 #include <stan/math/prim/fun/cols.hpp>
@@ -122,6 +123,10 @@
 #include <stan/math/prim/fun/grad_reg_inc_gamma.hpp>
 #include <stan/math/prim/fun/grad_reg_lower_inc_gamma.hpp>
 #include <stan/math/prim/fun/head.hpp>
+#include <stan/math/prim/fun/hsgp_basis.hpp>
+#include <stan/math/prim/fun/hsgp_exp_quad_sqrt_spd.hpp>
+#include <stan/math/prim/fun/hsgp_matern32_sqrt_spd.hpp>
+#include <stan/math/prim/fun/hsgp_matern52_sqrt_spd.hpp>
 #include <stan/math/prim/fun/hypergeometric_1F0.hpp>
 #include <stan/math/prim/fun/hypergeometric_2F1.hpp>
 #include <stan/math/prim/fun/hypergeometric_2F2.hpp>
@@ -200,6 +205,7 @@
 #include <stan/math/prim/fun/logit.hpp>
 #include <stan/math/prim/fun/make_nu.hpp>
 #include <stan/math/prim/fun/matrix_exp.hpp>
+#include <stan/math/prim/fun/matrix_factor.hpp>
 #include <stan/math/prim/fun/matrix_exp_multiply.hpp>
 #include <stan/math/prim/fun/matrix_power.hpp>
 #include <stan/math/prim/fun/max.hpp>
@@ -330,6 +336,7 @@
 #include <stan/math/prim/fun/trace.hpp>
 #include <stan/math/prim/fun/trace_gen_inv_quad_form_ldlt.hpp>
 #include <stan/math/prim/fun/trace_gen_quad_form.hpp>
+#include <stan/math/prim/fun/trace_inv_quad_form.hpp>
 #include <stan/math/prim/fun/trace_inv_quad_form_ldlt.hpp>
 #include <stan/math/prim/fun/trace_quad_form.hpp>
 #include <stan/math/prim/fun/transpose.hpp>
@@ -4,12 +4,154 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
-
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <algorithm>
 #include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace stan {
 namespace math {
 
+namespace internal {
+
+/**
+ * Tuning parameters of the multithreaded Cholesky decomposition of double
+ * matrices and of its reverse mode adjoint.
+ */
+struct cholesky_tuning_struct {
+  // matrices with at least this many rows use the tiled algorithms
+  int parallel_min_size = 512;
+  // number of rows and columns of the tiles of the tiled algorithms
+  int tile_size = 128;
+};
+
+}  // namespace internal
+
+/**
+ * Returns a reference to the tuning parameters of the multithreaded
+ * Cholesky decomposition, which can be changed to tune it for a machine.
+ * The parameters are not meant to be changed while a decomposition is
+ * computed.
+ */
+inline internal::cholesky_tuning_struct& cholesky_tuning_opts() noexcept {
+  static internal::cholesky_tuning_struct tuning_opts;
+  return tuning_opts;
+}
+
+namespace internal {
+
+/**
+ * Calls <code>f(begin, end)</code> for consecutive chunks of `[0, n)` of
+ * about \p grain indices, in parallel with TBB if \p parallel is true, or
+ * once for the whole range otherwise.
+ *
+ * @tparam F type of the functor
+ * @param n size of the range
+ * @param grain number of indices of a chunk
+ * @param parallel whether the chunks are processed in parallel
+ * @param f functor called with the bounds of each chunk
+ */
+template <typename F>
+inline void cholesky_for_each_chunk(Eigen::Index n, Eigen::Index grain,
+                                    bool parallel, F&& f) {
+  if (parallel && n > grain) {
+    tbb::parallel_for(tbb::blocked_range<Eigen::Index>(0, n, grain),
+                      [&f](const tbb::blocked_range<Eigen::Index>& r) {
+                        f(r.begin(), r.end());
+                      });
+  } else if (n > 0) {
+    f(0, n);
+  }
+}
+
+/**
+ * Overwrite the lower triangle of the symmetric matrix \p A with its
+ * Cholesky factor, using a right-looking algorithm on square tiles. After
+ * the decomposition of each diagonal tile, the tiles below it and the
+ * tiles of the trailing submatrix are updated in parallel with TBB. The
+ * strict upper triangle of \p A is left in an unspecified state.
+ *
+ * @param[in, out] A symmetric matrix
+ * @param tile_size number of rows and columns of the tiles
+ * @return false if \p A is not positive definite
+ */
+inline bool cholesky_tiled_inplace(Eigen::Ref<Eigen::MatrixXd> A,
+                                   Eigen::Index tile_size) {
+  const Eigen::Index N = A.rows();
+  tile_size = std::max(tile_size, Eigen::Index(1));
+  std::vector<std::pair<Eigen::Index, Eigen::Index>> tiles;
+  for (Eigen::Index k = 0; k < N; k += tile_size) {
+    const Eigen::Index kb = std::min(tile_size, N - k);
+    auto A_kk = A.block(k, k, kb, kb);
+    Eigen::LLT<Eigen::Ref<Eigen::MatrixXd>, Eigen::Lower> llt(A_kk);
+    if (llt.info() != Eigen::Success
+        || !(A_kk.diagonal().array() > 0.0).all()) {
+      return false;
+    }
+    const Eigen::Index M = N - k - kb;
+    if (M == 0) {
+      break;
+    }
+    const auto L_kk = A_kk.template triangularView<Eigen::Lower>();
+    cholesky_for_each_chunk(
+        M, tile_size, true, [&](Eigen::Index begin, Eigen::Index end) {
+          L_kk.transpose().template solveInPlace<Eigen::OnTheRight>(
+              A.block(k + kb + begin, k, end - begin, kb));
+        });
+    tiles.clear();
+    for (Eigen::Index j = k + kb; j < N; j += tile_size) {
+      for (Eigen::Index i = j; i < N; i += tile_size) {
+        tiles.emplace_back(i, j);
+      }
+    }
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, tiles.size()),
+        [&](const tbb::blocked_range<std::size_t>& r) {
+          for (std::size_t t = r.begin(); t < r.end(); ++t) {
+            const Eigen::Index i = tiles[t].first;
+            const Eigen::Index j = tiles[t].second;
+            const Eigen::Index ib = std::min(tile_size, N - i);
+            const Eigen::Index jb = std::min(tile_size, N - j);
+            A.block(i, j, ib, jb).noalias()
+                -= A.block(i, k, ib, kb) * A.block(j, k, jb, kb).transpose();
+          }
+        });
+  }
+  return true;
+}
+
+/**
+ * Overwrite the lower triangle of the symmetric matrix \p A with its
+ * Cholesky factor and set its strict upper triangle to zero. Matrices
+ * with at least <code>cholesky_tuning_opts().parallel_min_size</code>
+ * rows are decomposed with the multithreaded tiled algorithm and smaller
+ * ones with Eigen's LLT.
+ *
+ * @param function function name (for error messages)
+ * @param name variable name (for error messages)
+ * @param[in, out] A symmetric matrix
+ * @throw std::domain_error if \p A is not positive definite
+ */
+inline void cholesky_decompose_inplace(const char* function, const char* name,
+                                       Eigen::Ref<Eigen::MatrixXd> A) {
+  const auto& tuning = cholesky_tuning_opts();
+  if (A.rows() >= tuning.parallel_min_size) {
+    if (!cholesky_tiled_inplace(A, tuning.tile_size)) {
+      throw_domain_error(function, "Matrix", " is not positive definite",
+                         name);
+    }
+  } else {
+    Eigen::LLT<Eigen::Ref<Eigen::MatrixXd>, Eigen::Lower> llt(A);
+    check_pos_definite(function, name, llt);
+  }
+  A.template triangularView<Eigen::StrictlyUpper>().setZero();
+}
+
+}  // namespace internal
+
 /**
  * Return the lower-triangular Cholesky factor (i.e., matrix
  * square root) of the specified square, symmetric matrix.  The return
@@ -23,6 +165,9 @@ namespace math {
  * @note Because OpenCL only works on doubles there are two
  * <code>cholesky_decompose</code> functions. One that works on doubles
  * and another that works on all other types (this one).
+ * @note Matrices of doubles with at least
+ * <code>cholesky_tuning_opts().parallel_min_size</code> rows are
+ * decomposed with a multithreaded tiled algorithm.
  * @throw std::domain_error if m is not a symmetric matrix or
  *   if m is not positive definite (if m has more than 0 elements)
  */
@@ -34,6 +179,13 @@ cholesky_decompose(const EigMat& m) {
   const eval_return_type_t<EigMat>& m_eval = m.eval();
   check_symmetric("cholesky_decompose", "m", m_eval);
   check_not_nan("cholesky_decompose", "m", m_eval);
+  if constexpr (std::is_same<value_type_t<EigMat>, double>::value) {
+    if (m_eval.rows() >= cholesky_tuning_opts().parallel_min_size) {
+      Eigen::MatrixXd L = m_eval;
+      internal::cholesky_decompose_inplace("cholesky_decompose", "m", L);
+      return L;
+    }
+  }
   Eigen::LLT<Eigen::Matrix<value_type_t<EigMat>, EigMat::RowsAtCompileTime,
                            EigMat::ColsAtCompileTime>>
       llt = m_eval.llt();
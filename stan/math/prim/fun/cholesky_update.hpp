@@ -0,0 +1,148 @@
+#ifndef STAN_MATH_PRIM_FUN_CHOLESKY_UPDATE_HPP
+#define STAN_MATH_PRIM_FUN_CHOLESKY_UPDATE_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/sqrt.hpp>
+#include <cmath>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * Overwrite the Cholesky factor `L` of `A` with the Cholesky factor of
+ * `A + sign * W W^T`, one column of `L` at a time. Within a column the
+ * rank one terms are applied in order, so the cost is `O(N^2 k)` for
+ * `N x k` matrices `W`. `W` is overwritten by the transformed low-rank
+ * term.
+ *
+ * Every step applies a (hyperbolic for downdates) rotation to the pair of
+ * the diagonal element `a = L(j, j)` and `b = W(j, i)` and to the columns
+ * below them. If `a_b` is not null, the pairs `(a, b)` of the steps are
+ * written to it in order, which is all the reverse pass needs to undo the
+ * steps.
+ *
+ * @tparam T scalar type
+ * @param function name of the calling function
+ * @param sign 1 for an update and -1 for a downdate
+ * @param[in, out] L lower triangular Cholesky factor
+ * @param[in, out] W low-rank term
+ * @param[out] a_b storage for the `2 N k` rotation parameters, or nullptr
+ * @throw std::domain_error if the downdated matrix is not positive
+ * definite
+ */
+template <typename T>
+inline void cholesky_rank_update(
+    const char* function, double sign,
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>& L,
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>& W, T* a_b = nullptr) {
+  using std::sqrt;
+  const Eigen::Index N = L.rows();
+  const Eigen::Index K = W.cols();
+  for (Eigen::Index j = 0; j < N; ++j) {
+    const Eigen::Index M = N - j - 1;
+    for (Eigen::Index i = 0; i < K; ++i) {
+      const T a = L.coeff(j, j);
+      const T b = W.coeff(j, i);
+      const T r2 = a * a + sign * b * b;
+      if (!(r2 > 0)) {
+        throw_domain_error(function, "downdated matrix", "",
+                           "is not positive definite", "");
+      }
+      const T r = sqrt(r2);
+      const T c = r / a;
+      const T s = b / a;
+      if (a_b != nullptr) {
+        *a_b++ = a;
+        *a_b++ = b;
+      }
+      L.coeffRef(j, j) = r;
+      auto l = L.col(j).tail(M);
+      auto w = W.col(i).tail(M);
+      l = (l + sign * s * w) / c;
+      w = c * w - s * l;
+    }
+  }
+}
+
+}  // namespace internal
+
+/**
+ * Return the Cholesky factor of `L L^T + V V^T` given the lower
+ * triangular Cholesky factor `L` and a low-rank term `V`, at a cost of
+ * `O(N^2 k)` instead of the `O(N^3)` of a new decomposition. Only the
+ * lower triangle of `L` is used.
+ *
+ * @tparam EigMat1 type of the Cholesky factor
+ * @tparam EigMat2 type of the low-rank term (vector or matrix)
+ * @param L `N x N` lower triangular Cholesky factor
+ * @param V `N x k` low-rank term
+ * @return Cholesky factor of `L L^T + V V^T`
+ * @throw std::invalid_argument if `L` is not square or the number of rows
+ * of `V` does not match
+ * @throw std::domain_error if the diagonal of `L` is not positive or the
+ * arguments are not finite
+ */
+template <typename EigMat1, typename EigMat2,
+          require_all_eigen_t<EigMat1, EigMat2>* = nullptr,
+          require_all_not_st_var<EigMat1, EigMat2>* = nullptr>
+inline Eigen::Matrix<return_type_t<EigMat1, EigMat2>, Eigen::Dynamic,
+                     Eigen::Dynamic>
+cholesky_update(const EigMat1& L, const EigMat2& V) {
+  using T_return = return_type_t<EigMat1, EigMat2>;
+  static constexpr const char* function = "cholesky_update";
+  check_square(function, "L", L);
+  check_size_match(function, "Rows of L", L.rows(), "rows of V", V.rows());
+  check_positive(function, "diagonal of L", L.diagonal());
+  check_finite(function, "V", V);
+  Eigen::Matrix<T_return, Eigen::Dynamic, Eigen::Dynamic> L_new
+      = L.template cast<T_return>().template triangularView<Eigen::Lower>();
+  Eigen::Matrix<T_return, Eigen::Dynamic, Eigen::Dynamic> W
+      = V.template cast<T_return>();
+  internal::cholesky_rank_update(function, 1, L_new, W);
+  return L_new;
+}
+
+/**
+ * Return the Cholesky factor of `L L^T - V V^T` given the lower
+ * triangular Cholesky factor `L` and a low-rank term `V`, at a cost of
+ * `O(N^2 k)` instead of the `O(N^3)` of a new decomposition. Only the
+ * lower triangle of `L` is used.
+ *
+ * @tparam EigMat1 type of the Cholesky factor
+ * @tparam EigMat2 type of the low-rank term (vector or matrix)
+ * @param L `N x N` lower triangular Cholesky factor
+ * @param V `N x k` low-rank term
+ * @return Cholesky factor of `L L^T - V V^T`
+ * @throw std::invalid_argument if `L` is not square or the number of rows
+ * of `V` does not match
+ * @throw std::domain_error if the diagonal of `L` is not positive, the
+ * arguments are not finite or `L L^T - V V^T` is not positive definite
+ */
+template <typename EigMat1, typename EigMat2,
+          require_all_eigen_t<EigMat1, EigMat2>* = nullptr,
+          require_all_not_st_var<EigMat1, EigMat2>* = nullptr>
+inline Eigen::Matrix<return_type_t<EigMat1, EigMat2>, Eigen::Dynamic,
+                     Eigen::Dynamic>
+cholesky_downdate(const EigMat1& L, const EigMat2& V) {
+  using T_return = return_type_t<EigMat1, EigMat2>;
+  static constexpr const char* function = "cholesky_downdate";
+  check_square(function, "L", L);
+  check_size_match(function, "Rows of L", L.rows(), "rows of V", V.rows());
+  check_positive(function, "diagonal of L", L.diagonal());
+  check_finite(function, "V", V);
+  Eigen::Matrix<T_return, Eigen::Dynamic, Eigen::Dynamic> L_new
+      = L.template cast<T_return>().template triangularView<Eigen::Lower>();
+  Eigen::Matrix<T_return, Eigen::Dynamic, Eigen::Dynamic> W
+      = V.template cast<T_return>();
+  internal::cholesky_rank_update(function, -1, L_new, W);
+  return L_new;
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
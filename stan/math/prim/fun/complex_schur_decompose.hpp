@@ -24,7 +24,8 @@ namespace math {
  * specified matrix
  * @see complex_schur_decompose_t
  */
-template <typename M, require_eigen_dense_dynamic_t<M>* = nullptr>
+template <typename M, require_eigen_dense_dynamic_t<M>* = nullptr,
+          require_not_st_var<M>* = nullptr>
 inline Eigen::Matrix<complex_return_t<scalar_type_t<M>>, -1, -1>
 complex_schur_decompose_u(const M& m) {
   if (unlikely(m.size() == 0)) {
@@ -48,7 +49,8 @@ complex_schur_decompose_u(const M& m) {
  * @see complex_schur_decompose_u for a definition of the complex
  * Schur decomposition
  */
-template <typename M, require_eigen_dense_dynamic_t<M>* = nullptr>
+template <typename M, require_eigen_dense_dynamic_t<M>* = nullptr,
+          require_not_st_var<M>* = nullptr>
 inline Eigen::Matrix<complex_return_t<scalar_type_t<M>>, -1, -1>
 complex_schur_decompose_t(const M& m) {
   if (unlikely(m.size() == 0)) {
@@ -77,7 +79,8 @@ complex_schur_decompose_t(const M& m) {
  * Schur decomposition of `m` and T is the Schur form matrix of
  * the complex Schur decomposition of `m`
  */
-template <typename M, require_eigen_dense_dynamic_t<M>* = nullptr>
+template <typename M, require_eigen_dense_dynamic_t<M>* = nullptr,
+          require_not_st_var<M>* = nullptr>
 inline std::tuple<Eigen::Matrix<complex_return_t<scalar_type_t<M>>, -1, -1>,
                   Eigen::Matrix<complex_return_t<scalar_type_t<M>>, -1, -1>>
 complex_schur_decompose(const M& m) {
@@ -18,7 +18,8 @@ namespace math {
  * with entries the eigenvectors of `m`
  */
 template <typename EigMat, require_eigen_matrix_dynamic_t<EigMat>* = nullptr,
-          require_not_vt_complex<EigMat>* = nullptr>
+          require_not_vt_complex<EigMat>* = nullptr,
+          require_not_st_var<EigMat>* = nullptr>
 inline std::tuple<Eigen::Matrix<complex_return_t<value_type_t<EigMat>>, -1, -1>,
                   Eigen::Matrix<complex_return_t<value_type_t<EigMat>>, -1, 1>>
 eigendecompose(const EigMat& m) {
@@ -16,7 +16,8 @@ namespace math {
  * @return a complex-valued column vector with entries the eigenvectors of `m`
  */
 template <typename EigMat, require_eigen_matrix_dynamic_t<EigMat>* = nullptr,
-          require_not_vt_complex<EigMat>* = nullptr>
+          require_not_vt_complex<EigMat>* = nullptr,
+          require_not_st_var<EigMat>* = nullptr>
 inline Eigen::Matrix<complex_return_t<value_type_t<EigMat>>, -1, 1> eigenvalues(
     const EigMat& m) {
   if (unlikely(m.size() == 0)) {
@@ -0,0 +1,79 @@
+#ifndef STAN_MATH_PRIM_FUN_HSGP_BASIS_HPP
+#define STAN_MATH_PRIM_FUN_HSGP_BASIS_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/sin.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
+#include <cmath>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * Returns the square roots `pi j / (2 L)`, `j = 1, ..., M`, of the
+ * eigenvalues of the Laplacian on `[-L, L]` with Dirichlet boundary
+ * conditions, the frequencies at which the spectral density of the kernel
+ * is evaluated in the Hilbert space approximation of a Gaussian process.
+ *
+ * @param L boundary of the domain
+ * @param M number of basis functions
+ */
+inline Eigen::VectorXd hsgp_frequencies(double L, int M) {
+  return Eigen::VectorXd::LinSpaced(M, 1, M) * (pi() / (2 * L));
+}
+
+}  // namespace internal
+
+/**
+ * Returns the `N x M` matrix of the basis functions
+ * `phi_j(x) = sin(pi j (x + L) / (2 L)) / sqrt(L)`, `j = 1, ..., M`, of the
+ * Hilbert space approximation of a one dimensional stationary Gaussian
+ * process on `[-L, L]` evaluated at the inputs `x`.
+ *
+ * The covariance matrix of the process at `x` is approximated by
+ * `Phi diag(S) Phi^T`, where `S` is the spectral density of the kernel at
+ * the square roots of the eigenvalues of the basis functions (see
+ * <code>hsgp_exp_quad_sqrt_spd</code>), so a process
+ * `f = Phi (sqrt(S) .* z)` with standard normal `z` costs `O(N M)`
+ * instead of the `O(N^3)` of the Cholesky decomposition of the exact
+ * covariance matrix. The basis does not depend on the parameters of the
+ * kernel and is usually computed once from data.
+ *
+ * @tparam T_x type of the inputs
+ * @param x std::vector or Eigen vector of inputs
+ * @param L boundary of the domain, the inputs must lie in `[-L, L]`
+ * @param M number of basis functions
+ * @return `N x M` matrix of the basis functions
+ * @throw std::domain_error if L is not positive and finite, M is negative
+ * or an input lies outside `[-L, L]`
+ */
+template <typename T_x, require_vector_vt<is_stan_scalar, T_x>* = nullptr>
+inline Eigen::Matrix<value_type_t<T_x>, Eigen::Dynamic, Eigen::Dynamic>
+hsgp_basis(const T_x& x, double L, int M) {
+  static constexpr const char* function = "hsgp_basis";
+  check_positive_finite(function, "boundary", L);
+  check_nonnegative(function, "number of basis functions", M);
+  const auto& x_ref = to_ref(x);
+  check_bounded(function, "x", x_ref, -L, L);
+
+  const Eigen::VectorXd omega = internal::hsgp_frequencies(L, M);
+  const double inv_sqrt_L = 1.0 / std::sqrt(L);
+  const size_t N = x_ref.size();
+  Eigen::Matrix<value_type_t<T_x>, Eigen::Dynamic, Eigen::Dynamic> phi(N, M);
+  for (int j = 0; j < M; ++j) {
+    for (size_t i = 0; i < N; ++i) {
+      phi.coeffRef(i, j) = inv_sqrt_L * sin(omega.coeff(j) * (x_ref[i] + L));
+    }
+  }
+  return phi;
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
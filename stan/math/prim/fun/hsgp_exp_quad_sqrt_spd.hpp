@@ -0,0 +1,60 @@
+#ifndef STAN_MATH_PRIM_FUN_HSGP_EXP_QUAD_SQRT_SPD_HPP
+#define STAN_MATH_PRIM_FUN_HSGP_EXP_QUAD_SQRT_SPD_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/exp.hpp>
+#include <stan/math/prim/fun/sqrt.hpp>
+#include <stan/math/prim/fun/square.hpp>
+#include <cmath>
+#include <stan/math/prim/fun/hsgp_basis.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Returns the square root of the spectral density of the one dimensional
+ * exponentiated quadratic kernel with magnitude `sigma` and length scale `l`,
+ * `S(omega) = sigma^2 sqrt(2 pi) l exp(-l^2 omega^2 / 2)`,
+ * at the square roots `omega_j = pi j / (2 L)`, `j = 1, ..., M`, of the
+ * eigenvalues of the basis functions of the Hilbert space approximation
+ * on `[-L, L]` (see <code>hsgp_basis</code>).
+ *
+ * @tparam T_sigma type of the magnitude
+ * @tparam T_l type of the length scale
+ * @param sigma magnitude
+ * @param length_scale length scale
+ * @param L boundary of the domain
+ * @param M number of basis functions
+ * @return vector of the `M` square roots of the spectral density
+ * @throw std::domain_error if sigma, length_scale or L are not positive and
+ * finite or M is negative
+ */
+template <typename T_sigma, typename T_l,
+          require_all_stan_scalar_t<T_sigma, T_l>* = nullptr,
+          require_all_not_st_var<T_sigma, T_l>* = nullptr>
+inline Eigen::Matrix<return_type_t<T_sigma, T_l>, Eigen::Dynamic, 1>
+hsgp_exp_quad_sqrt_spd(const T_sigma& sigma, const T_l& length_scale,
+                       double L, int M) {
+  static constexpr const char* function = "hsgp_exp_quad_sqrt_spd";
+  check_positive_finite(function, "magnitude", sigma);
+  check_positive_finite(function, "length scale", length_scale);
+  check_positive_finite(function, "boundary", L);
+  check_nonnegative(function, "number of basis functions", M);
+
+  const Eigen::VectorXd omega = internal::hsgp_frequencies(L, M);
+  const auto scale = sigma * std::pow(TWO_PI, 0.25) * sqrt(length_scale);
+  const auto quarter_l_sq = 0.25 * square(length_scale);
+  Eigen::Matrix<return_type_t<T_sigma, T_l>, Eigen::Dynamic, 1> res(M);
+  for (int j = 0; j < M; ++j) {
+    res.coeffRef(j) = scale * exp(-quarter_l_sq * square(omega.coeff(j)));
+  }
+  return res;
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -4,6 +4,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/matrix_factor.hpp>
 
 namespace stan {
 namespace math {
@@ -32,6 +33,27 @@ inverse(const EigMat& m) {
   return m.inverse();
 }
 
+/**
+ * Returns the inverse of a matrix given its factor.
+ *
+ * @tparam T type of the factored matrix
+ * @tparam Decomposition Eigen decomposition template of the factor
+ *
+ * @param A factor of the matrix
+ * @return Inverse of the matrix (an empty matrix if the matrix has size
+ * zero).
+ */
+template <typename T, template <typename> class Decomposition,
+          require_not_st_var<T>* = nullptr>
+inline plain_type_t<T> inverse(const matrix_factor<T, Decomposition>& A) {
+  const auto& m = A.matrix();
+  if (m.size() == 0) {
+    return {};
+  }
+  return A.decomposition().solve(
+      plain_type_t<T>::Identity(m.rows(), m.cols()));
+}
+
 }  // namespace math
 }  // namespace stan
 
@@ -4,6 +4,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/matrix_factor.hpp>
 
 namespace stan {
 namespace math {
@@ -27,6 +28,25 @@ inline value_type_t<EigMat> log_determinant(const EigMat& m) {
   return m.colPivHouseholderQr().logAbsDeterminant();
 }
 
+/**
+ * Returns the log absolute determinant of a matrix given its factor.
+ *
+ * @tparam T type of the factored matrix
+ * @tparam Decomposition Eigen decomposition template of the factor
+ *
+ * @param A factor of the matrix
+ * @return log absolute determinant of the matrix.
+ */
+template <typename T, template <typename> class Decomposition,
+          require_not_st_var<T>* = nullptr>
+inline value_type_t<T> log_determinant(
+    const matrix_factor<T, Decomposition>& A) {
+  if (A.matrix().size() == 0) {
+    return 0;
+  }
+  return internal::log_abs_determinant(A.decomposition());
+}
+
 }  // namespace math
 }  // namespace stan
 
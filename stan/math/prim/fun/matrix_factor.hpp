@@ -0,0 +1,242 @@
+#ifndef STAN_MATH_PRIM_FUN_MATRIX_FACTOR_HPP
+#define STAN_MATH_PRIM_FUN_MATRIX_FACTOR_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err/check_square.hpp>
+#include <stan/math/prim/err/throw_domain_error.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/abs.hpp>
+#include <stan/math/prim/fun/log.hpp>
+#include <stan/math/prim/fun/sum.hpp>
+#include <type_traits>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * Partial pivoting LU decomposition of a matrix of type \p M.
+ */
+template <typename M>
+using partial_piv_lu = Eigen::PartialPivLU<M>;
+
+/**
+ * Column pivoting Householder QR decomposition of a matrix of type \p M.
+ */
+template <typename M>
+using col_piv_householder_qr = Eigen::ColPivHouseholderQR<M>;
+
+/**
+ * Cholesky decomposition of a symmetric positive definite matrix of type
+ * \p M.
+ */
+template <typename M>
+using llt = Eigen::LLT<M>;
+
+/**
+ * Returns the log absolute determinant of a matrix given its LU
+ * decomposition.
+ */
+template <typename M>
+inline auto log_abs_determinant(const Eigen::PartialPivLU<M>& lu) {
+  return sum(log(abs(lu.matrixLU().diagonal())));
+}
+
+/**
+ * Returns the log absolute determinant of a matrix given its QR
+ * decomposition.
+ */
+template <typename M>
+inline auto log_abs_determinant(const Eigen::ColPivHouseholderQR<M>& qr) {
+  return sum(log(abs(qr.matrixQR().diagonal())));
+}
+
+/**
+ * Returns the log determinant of a matrix given its Cholesky
+ * decomposition.
+ */
+template <typename M>
+inline auto log_abs_determinant(const Eigen::LLT<M>& llt) {
+  return 2 * sum(log(llt.matrixLLT().diagonal()));
+}
+
+}  // namespace internal
+
+/**
+ * A matrix_factor holds a matrix of type T and a decomposition of it,
+ * computed once on construction and reused by every function the factor
+ * is passed to (<code>mdivide_left</code>, <code>mdivide_right</code>,
+ * <code>log_determinant</code>, <code>inverse</code> and
+ * <code>trace_inv_quad_form</code>). Use the aliases
+ * <code>LU_factor</code>, <code>QR_factor</code> and
+ * <code>LLT_factor</code> and the matching <code>make_*_factor</code>
+ * functions.
+ *
+ * @tparam T type of the matrix
+ * @tparam Decomposition Eigen decomposition template
+ */
+template <typename T, template <typename> class Decomposition,
+          typename Enable = void>
+class matrix_factor;
+
+/**
+ * A matrix_factor of a matrix of non-var scalars holds a copy of the
+ * matrix and its decomposition.
+ *
+ * @tparam T type of the matrix
+ * @tparam Decomposition Eigen decomposition template
+ */
+template <typename T, template <typename> class Decomposition>
+class matrix_factor<T, Decomposition,
+                    std::enable_if_t<is_eigen_matrix_dynamic<T>::value
+                                     && !is_var<scalar_type_t<T>>::value>> {
+ private:
+  plain_type_t<T> matrix_;
+  Decomposition<plain_type_t<T>> decomposition_;
+
+ public:
+  using decomposition_t = Decomposition<plain_type_t<T>>;
+
+  template <typename S,
+            require_same_t<plain_type_t<T>, plain_type_t<S>>* = nullptr>
+  explicit matrix_factor(const S& matrix) : matrix_(matrix) {
+    if (matrix_.size() > 0) {
+      decomposition_.compute(matrix_);
+    }
+  }
+
+  /**
+   * Return a const reference to the underlying matrix
+   */
+  const auto& matrix() const noexcept { return matrix_; }
+
+  /**
+   * Return a const reference to the decomposition of the matrix
+   */
+  const auto& decomposition() const noexcept { return decomposition_; }
+};
+
+/**
+ * LU decomposition with partial pivoting of a square matrix.
+ *
+ * @tparam T type of the matrix
+ */
+template <typename T>
+using LU_factor = matrix_factor<T, internal::partial_piv_lu>;
+
+/**
+ * QR decomposition with column pivoting of a square matrix.
+ *
+ * @tparam T type of the matrix
+ */
+template <typename T>
+using QR_factor = matrix_factor<T, internal::col_piv_householder_qr>;
+
+/**
+ * Cholesky decomposition of a symmetric positive definite matrix.
+ *
+ * @tparam T type of the matrix
+ */
+template <typename T>
+using LLT_factor = matrix_factor<T, internal::llt>;
+
+/**
+ * Make an LU_factor with matrix type `plain_type_t<T>`
+ *
+ * @tparam T type of the matrix
+ * @param A square matrix to factor
+ * @return LU_factor of A
+ * @throw std::invalid_argument if A is not square
+ */
+template <typename T, require_matrix_t<T>* = nullptr>
+inline auto make_lu_factor(const T& A) {
+  check_square("make_lu_factor", "A", A);
+  return LU_factor<plain_type_t<T>>(A);
+}
+
+/**
+ * Make a QR_factor with matrix type `plain_type_t<T>`
+ *
+ * @tparam T type of the matrix
+ * @param A square matrix to factor
+ * @return QR_factor of A
+ * @throw std::invalid_argument if A is not square
+ */
+template <typename T, require_matrix_t<T>* = nullptr>
+inline auto make_qr_factor(const T& A) {
+  check_square("make_qr_factor", "A", A);
+  return QR_factor<plain_type_t<T>>(A);
+}
+
+/**
+ * Make an LLT_factor with matrix type `plain_type_t<T>`. Only the lower
+ * triangle of A is used.
+ *
+ * @tparam T type of the matrix
+ * @param A symmetric positive definite matrix to factor
+ * @return LLT_factor of A
+ * @throw std::invalid_argument if A is not square
+ * @throw std::domain_error if A is not positive definite
+ */
+template <typename T, require_matrix_t<T>* = nullptr>
+inline auto make_llt_factor(const T& A) {
+  check_square("make_llt_factor", "A", A);
+  LLT_factor<plain_type_t<T>> factor(A);
+  if (A.size() > 0 && factor.decomposition().info() != Eigen::Success) {
+    throw_domain_error("make_llt_factor", "A", "", "is not positive definite",
+                       "");
+  }
+  return factor;
+}
+
+namespace internal {
+
+/**
+ * Returns the decomposition of the matrix of a factor in the scalar type
+ * \p T_return. This is the decomposition held by the factor if its scalar
+ * type is \p T_return and a new decomposition of the promoted matrix
+ * otherwise, e.g. for a factor of a matrix of doubles used with forward
+ * mode right hand sides.
+ *
+ * @tparam T_return scalar type of the decomposition
+ * @tparam T type of the matrix
+ * @tparam Decomposition Eigen decomposition template
+ * @param A factor
+ */
+template <typename T_return, typename T,
+          template <typename> class Decomposition>
+inline decltype(auto) promoted_decomposition(
+    const matrix_factor<T, Decomposition>& A) {
+  if constexpr (std::is_same<value_type_t<T>, T_return>::value) {
+    return A.decomposition();
+  } else {
+    return Decomposition<Eigen::Matrix<T_return, -1, -1>>(
+        A.matrix().template cast<T_return>());
+  }
+}
+
+/**
+ * Returns the solution of A^T X = B given a decomposition of A.
+ *
+ * @tparam Decomp type of the decomposition
+ * @tparam EigMat type of the right hand side
+ * @param decomposition decomposition of A
+ * @param B right hand side
+ */
+template <typename Decomp, typename EigMat>
+inline Eigen::Matrix<typename Decomp::Scalar, Eigen::Dynamic,
+                     EigMat::ColsAtCompileTime>
+transpose_solve(const Decomp& decomposition, const EigMat& B) {
+  Eigen::Matrix<typename Decomp::Scalar, Eigen::Dynamic,
+                EigMat::ColsAtCompileTime>
+      X = decomposition.transpose().solve(B.eval());
+  return X;
+}
+
+}  // namespace internal
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -4,6 +4,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/matrix_factor.hpp>
 
 namespace stan {
 namespace math {
@@ -38,6 +39,34 @@ mdivide_left(const T1& A, const T2& b) {
                            T2::ColsAtCompileTime>(b));
 }
 
+/**
+ * Returns the solution of the system Ax=b given a factor of A.
+ *
+ * @tparam T type of the factored matrix
+ * @tparam Decomposition Eigen decomposition template of the factor
+ * @tparam EigMat type of the right-hand side matrix or vector
+ *
+ * @param A factor of the matrix
+ * @param b Right hand side matrix or vector.
+ * @return x = A^-1 b, solution of the linear system.
+ * @throws std::domain_error if the rows of b don't match the size of A.
+ */
+template <typename T, template <typename> class Decomposition,
+          typename EigMat, require_eigen_t<EigMat>* = nullptr,
+          require_all_not_st_var<T, EigMat>* = nullptr>
+inline Eigen::Matrix<return_type_t<T, EigMat>, Eigen::Dynamic,
+                     EigMat::ColsAtCompileTime>
+mdivide_left(const matrix_factor<T, Decomposition>& A, const EigMat& b) {
+  using T_return = return_type_t<T, EigMat>;
+  check_multiplicable("mdivide_left", "A", A.matrix(), "b", b);
+  if (A.matrix().size() == 0) {
+    return {0, b.cols()};
+  }
+
+  return internal::promoted_decomposition<T_return>(A).solve(
+      b.template cast<T_return>());
+}
+
 }  // namespace math
 }  // namespace stan
 
@@ -4,6 +4,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/matrix_factor.hpp>
 
 namespace stan {
 namespace math {
@@ -42,6 +43,37 @@ mdivide_right(const EigMat1& b, const EigMat2& A) {
       .transpose();
 }
 
+/**
+ * Returns the solution of the system xA=b given a factor of A.
+ *
+ * @tparam EigMat type of the right-hand side matrix or vector
+ * @tparam T type of the factored matrix
+ * @tparam Decomposition Eigen decomposition template of the factor
+ *
+ * @param b Right hand side matrix or vector.
+ * @param A factor of the matrix
+ * @return x = b A^-1, solution of the linear system.
+ * @throws std::domain_error if the columns of b don't match the size of A.
+ */
+template <typename EigMat, typename T,
+          template <typename> class Decomposition,
+          require_eigen_t<EigMat>* = nullptr,
+          require_all_not_st_var<EigMat, T>* = nullptr>
+inline Eigen::Matrix<return_type_t<EigMat, T>, EigMat::RowsAtCompileTime,
+                     Eigen::Dynamic>
+mdivide_right(const EigMat& b, const matrix_factor<T, Decomposition>& A) {
+  using T_return = return_type_t<EigMat, T>;
+  check_multiplicable("mdivide_right", "b", b, "A", A.matrix());
+  if (A.matrix().size() == 0) {
+    return {b.rows(), 0};
+  }
+
+  return internal::transpose_solve(
+             internal::promoted_decomposition<T_return>(A),
+             b.template cast<T_return>().transpose())
+      .transpose();
+}
+
 }  // namespace math
 }  // namespace stan
 
@@ -2,15 +2,221 @@
 #define STAN_MATH_PRIM_FUN_POISSON_BINOMIAL_LOG_PROBS_HPP
 
 #include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/fft.hpp>
 #include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/log1m.hpp>
+#include <stan/math/prim/fun/log1m_exp.hpp>
 #include <stan/math/prim/fun/log_sum_exp.hpp>
 #include <stan/math/prim/fun/max_size.hpp>
+#include <stan/math/prim/fun/square.hpp>
 #include <stan/math/prim/fun/vector_seq_view.hpp>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <type_traits>
+#include <vector>
 
 namespace stan {
 namespace math {
 
+namespace internal {
+
+/**
+ * Minimum number of trials for which the Poisson-binomial lpmf, lcdf and
+ * lccdf use the FFT product tree instead of the O(N y) recursion.
+ */
+constexpr int poisson_binomial_fft_min_trials = 256;
+
+/**
+ * Minimum number of successes for which the FFT product tree is used;
+ * below it the recursion over the first y successes is cheaper.
+ */
+constexpr int poisson_binomial_fft_min_successes = 16;
+
+/**
+ * Returns true if the log probabilities of `y` successes in `N` trials
+ * should be computed with `poisson_binomial_log_sum_probs`.
+ *
+ * @param y number of successes
+ * @param N number of trials
+ */
+inline bool use_poisson_binomial_fft(int y, int N) {
+  return N >= poisson_binomial_fft_min_trials
+         && y >= poisson_binomial_fft_min_successes;
+}
+
+/**
+ * Returns the full linear convolution of two coefficient vectors,
+ * using `fft` for long vectors and the direct sum for short ones.
+ *
+ * @param a first coefficient vector
+ * @param b second coefficient vector
+ * @return vector of size `a.size() + b.size() - 1`
+ */
+inline Eigen::VectorXd poisson_binomial_convolve(const Eigen::VectorXd& a,
+                                                 const Eigen::VectorXd& b) {
+  const int n = a.size() + b.size() - 1;
+  if (std::min(a.size(), b.size()) <= 64) {
+    Eigen::VectorXd c = Eigen::VectorXd::Zero(n);
+    for (int j = 0; j < b.size(); ++j) {
+      c.segment(j, a.size()) += b(j) * a;
+    }
+    return c;
+  }
+  int n_fft = 1;
+  while (n_fft < n) {
+    n_fft *= 2;
+  }
+  Eigen::VectorXcd a_pad = Eigen::VectorXcd::Zero(n_fft);
+  Eigen::VectorXcd b_pad = Eigen::VectorXcd::Zero(n_fft);
+  a_pad.head(a.size()) = a.cast<std::complex<double>>();
+  b_pad.head(b.size()) = b.cast<std::complex<double>>();
+  return inv_fft(fft(a_pad).cwiseProduct(fft(b_pad))).real().head(n);
+}
+
+/**
+ * Returns the log of the sum of the Poisson-binomial probabilities of
+ * `lo` through `hi` successes, together with its gradient with respect to
+ * the success probabilities.
+ *
+ * The probability generating function \f$\prod_i (1 - \theta_i + \theta_i
+ * z)\f$ is expanded by multiplying the factors pairwise in a balanced
+ * tree with `poisson_binomial_convolve`, which costs
+ * \f$O(N \log^2 N)\f$. Every node of the tree is rescaled to a maximum
+ * coefficient of one, and the scales are accumulated on the log scale.
+ * FFT products only have absolute accuracy, so the generating function
+ * is exponentially tilted, \f$z \to s z\f$, to center it on the summed
+ * tail. A tail that contains the mean is computed as the complement of
+ * the other tail. The gradient is obtained by propagating the adjoints
+ * of the coefficients back down the same tree, where each product
+ * becomes a correlation.
+ *
+ * @tparam T_theta type of the vector of success probabilities
+ * @param lo smallest number of successes in the sum
+ * @param hi largest number of successes in the sum
+ * @param theta vector of success probabilities
+ * @param[out] grad gradient of the result with respect to theta
+ * @return log of the probability of between lo and hi successes
+ */
+template <typename T_theta, require_eigen_vector_vt<std::is_arithmetic,
+                                                    T_theta>* = nullptr>
+inline double poisson_binomial_log_sum_probs(int lo, int hi,
+                                             const T_theta& theta,
+                                             Eigen::VectorXd& grad) {
+  const int N = theta.size();
+  const Eigen::ArrayXd theta_arr = theta.array();
+  grad = Eigen::VectorXd::Zero(N);
+  if (lo > hi) {
+    return NEGATIVE_INFTY;
+  }
+  if (lo == 0 && hi == N) {
+    return 0;
+  }
+  // a tail containing the mean is one minus the opposite tail
+  const double mean = theta_arr.sum();
+  if ((lo == 0 && hi >= mean) || (hi == N && lo <= mean)) {
+    const double log_complement
+        = lo == 0 ? poisson_binomial_log_sum_probs(hi + 1, N, theta, grad)
+                  : poisson_binomial_log_sum_probs(0, lo - 1, theta, grad);
+    const double log_sum = log1m_exp(log_complement);
+    grad *= -std::exp(log_complement - log_sum);
+    return log_sum;
+  }
+
+  // tilt so that the tilted mean sits at the boundary of the summed range
+  const double boundary = lo == 0 ? hi : lo;
+  const double target = std::min(std::max(boundary, 0.5), N - 0.5);
+  double log_s_lo = -40;
+  double log_s_hi = 40;
+  for (int iter = 0; iter < 100; ++iter) {
+    const double log_s = 0.5 * (log_s_lo + log_s_hi);
+    const double s = std::exp(log_s);
+    const double tilted_mean
+        = (theta_arr * s / (1 - theta_arr + theta_arr * s)).sum();
+    if (tilted_mean < target) {
+      log_s_lo = log_s;
+    } else {
+      log_s_hi = log_s;
+    }
+  }
+  const double log_s = 0.5 * (log_s_lo + log_s_hi);
+  const double s = std::exp(log_s);
+  const Eigen::ArrayXd leaf_norms = 1 - theta_arr + theta_arr * s;
+
+  // levels[0] holds the normalized factors, levels.back() the product
+  std::vector<std::vector<Eigen::VectorXd>> levels(1);
+  std::vector<std::vector<double>> level_norms;
+  levels[0].reserve(N);
+  for (int i = 0; i < N; ++i) {
+    Eigen::VectorXd leaf(2);
+    leaf << 1 - theta_arr(i), theta_arr(i) * s;
+    leaf /= leaf_norms(i);
+    levels[0].push_back(std::move(leaf));
+  }
+  double log_scale = log(leaf_norms).sum();
+  while (levels.back().size() > 1) {
+    const auto& below = levels.back();
+    std::vector<Eigen::VectorXd> level;
+    std::vector<double> norms;
+    for (size_t j = 0; j + 1 < below.size(); j += 2) {
+      Eigen::VectorXd node
+          = poisson_binomial_convolve(below[j], below[j + 1]).cwiseMax(0);
+      const double norm = node.maxCoeff();
+      node /= norm;
+      log_scale += std::log(norm);
+      level.push_back(std::move(node));
+      norms.push_back(norm);
+    }
+    if (below.size() % 2 == 1) {
+      level.push_back(below.back());
+      norms.push_back(1);
+    }
+    levels.push_back(std::move(level));
+    level_norms.push_back(std::move(norms));
+  }
+
+  // log sum_k R_k s^{-k} over the range, and its adjoint with respect to R
+  const Eigen::VectorXd& root = levels.back()[0];
+  const Eigen::ArrayXd log_terms
+      = root.segment(lo, hi - lo + 1).array().log()
+        - log_s * Eigen::ArrayXd::LinSpaced(hi - lo + 1, lo, hi);
+  const double log_sum_terms = log_sum_exp(log_terms.matrix());
+  std::vector<Eigen::VectorXd> adjs(1, Eigen::VectorXd::Zero(N + 1));
+  adjs[0].segment(lo, hi - lo + 1)
+      = (-log_s * Eigen::ArrayXd::LinSpaced(hi - lo + 1, lo, hi)
+         - log_sum_terms)
+            .exp()
+            .matrix();
+
+  for (size_t l = levels.size() - 1; l-- > 0;) {
+    const auto& below = levels[l];
+    std::vector<Eigen::VectorXd> below_adjs(below.size());
+    for (size_t j = 0; j + 1 < below.size(); j += 2) {
+      const Eigen::VectorXd node_adj = adjs[j / 2] / level_norms[l][j / 2];
+      const auto& a = below[j];
+      const auto& b = below[j + 1];
+      below_adjs[j] = poisson_binomial_convolve(node_adj, b.reverse())
+                          .segment(b.size() - 1, a.size());
+      below_adjs[j + 1] = poisson_binomial_convolve(node_adj, a.reverse())
+                              .segment(a.size() - 1, b.size());
+    }
+    if (below.size() % 2 == 1) {
+      below_adjs.back() = adjs.back();
+    }
+    adjs = std::move(below_adjs);
+  }
+
+  for (int i = 0; i < N; ++i) {
+    grad(i) = (s - 1) / leaf_norms(i)
+              + s * (adjs[i](1) - adjs[i](0)) / square(leaf_norms(i));
+  }
+  return log_scale + log_sum_terms;
+}
+
+}  // namespace internal
+
 /**
  * Returns the last row of the log probability matrix of the Poisson-Binomial
  * distribution given the number of successes and a vector of success
@@ -1,13 +1,14 @@
 #ifndef STAN_MATH_PRIM_FUN_PSEUDO_EIGENVALUES_HPP
 #define STAN_MATH_PRIM_FUN_PSEUDO_EIGENVALUES_HPP
 
+#include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/err.hpp>
 
 namespace stan {
 namespace math {
 
-template <typename T>
+template <typename T, require_not_var_t<T>* = nullptr>
 Eigen::Matrix<T, -1, -1> pseudo_eigenvalues(const Eigen::Matrix<T, -1, -1>& m) {
   check_nonzero_size("pseudo_eigenvalues", "m", m);
   check_square("pseudo_eigenvalues", "m", m);
@@ -0,0 +1,42 @@
+#ifndef STAN_MATH_PRIM_FUN_TRACE_INV_QUAD_FORM_HPP
+#define STAN_MATH_PRIM_FUN_TRACE_INV_QUAD_FORM_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/matrix_factor.hpp>
+#include <stan/math/prim/fun/mdivide_left.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Compute the trace of an inverse quadratic form.  I.E., this computes
+ *       trace(B^T A^-1 B)
+ * where a factor of A is provided.
+ *
+ * @tparam T type of the factored matrix
+ * @tparam Decomposition Eigen decomposition template of the factor
+ * @tparam EigMat type of the second matrix
+ * @param A factor of the first matrix
+ * @param B second matrix
+ */
+template <typename T, template <typename> class Decomposition,
+          typename EigMat, require_eigen_t<EigMat>* = nullptr,
+          require_all_not_st_var<T, EigMat>* = nullptr>
+inline return_type_t<T, EigMat> trace_inv_quad_form(
+    const matrix_factor<T, Decomposition>& A, const EigMat& B) {
+  using T_return = return_type_t<T, EigMat>;
+  check_multiplicable("trace_inv_quad_form", "A", A.matrix(), "B", B);
+
+  if (A.matrix().size() == 0) {
+    return 0;
+  }
+
+  return B.template cast<T_return>().cwiseProduct(mdivide_left(A, B)).sum();
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -16,6 +16,8 @@
 #include <stan/math/prim/functor/integrate_ode_rk45.hpp>
 #include <stan/math/prim/functor/integrate_ode_std_vector_interface_adapter.hpp>
 #include <stan/math/prim/functor/ode_ckrk.hpp>
+#include <stan/math/prim/functor/ode_events.hpp>
+#include <stan/math/prim/functor/ode_linear.hpp>
 #include <stan/math/prim/functor/ode_rk45.hpp>
 #include <stan/math/prim/functor/ode_store_sensitivities.hpp>
 #include <stan/math/prim/functor/map_rect.hpp>
@@ -23,10 +23,17 @@
 #include <stan/math/prim/fun/fabs.hpp>
 #include <stan/math/prim/fun/fmax.hpp>
 #include <stan/math/prim/fun/max.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/functor/apply.hpp>
 #include <stan/math/prim/functor/integrate_1d.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <map>
 #include <queue>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -200,6 +207,90 @@ make_GenzMalik(const int dim) {
                          std::move(weights_low_deg));
 }
 
+/**
+ * Genz-Malik cubature rule of one dimension with the offsets of all points
+ * of the rule from the center of a box, in units of the half-widths of the
+ * box, as the columns of one matrix. The first column is the center, then
+ * for every coordinate i the points +p_i, -p_i of the first and of the
+ * second set of <code>make_GenzMalik</code>, then the points of the third
+ * and of the fourth set.
+ */
+struct GenzMalikRule {
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> points_;
+  Eigen::Matrix<double, 5, 1> weights_;
+  Eigen::Matrix<double, 4, 1> weights_low_deg_;
+};
+
+/**
+ * Return the Genz-Malik rule of dimension \p dim. The rules are built once
+ * per dimension and thread and reused by all later integrals.
+ *
+ * @param dim dimension
+ * @return Genz-Malik rule
+ */
+inline const GenzMalikRule& genz_malik_rule(const int dim) {
+  static thread_local std::map<int, GenzMalikRule> rules;
+  auto it = rules.find(dim);
+  if (it != rules.end()) {
+    return it->second;
+  }
+  auto genz_malik = make_GenzMalik(dim);
+  auto&& points = std::get<0>(genz_malik);
+  GenzMalikRule& rule = rules[dim];
+  rule.points_.resize(dim, 1 + 4 * dim + points[2].cols() + points[3].cols());
+  rule.points_.col(0).setZero();
+  for (int i = 0; i < dim; ++i) {
+    rule.points_.col(1 + 4 * i) = points[0].col(i);
+    rule.points_.col(2 + 4 * i) = -points[0].col(i);
+    rule.points_.col(3 + 4 * i) = points[1].col(i);
+    rule.points_.col(4 + 4 * i) = -points[1].col(i);
+  }
+  rule.points_.middleCols(1 + 4 * dim, points[2].cols()) = points[2];
+  rule.points_.rightCols(points[3].cols()) = points[3];
+  rule.weights_ = std::get<1>(genz_malik);
+  rule.weights_low_deg_ = std::get<2>(genz_malik);
+  return rule;
+}
+
+/**
+ * Smallest number of points of a box that are evaluated in parallel when
+ * parallel evaluation is requested. The Genz-Malik rule has more points
+ * from four dimensions on.
+ */
+static constexpr int hcubature_min_parallel_points = 64;
+
+/**
+ * Evaluate the integrand at all points of a box, in parallel with TBB if
+ * \p parallel is true, the batch is large and no autodiff variables are
+ * involved.
+ *
+ * @tparam Eval type of the evaluation functor
+ * @tparam Scalar type of the values of the integrand
+ * @param eval functor returning the value of the integrand at the j-th point
+ * @param[out] fx values of the integrand, sized to the number of points
+ * @param parallel whether large batches may be evaluated in parallel
+ */
+template <typename Eval, typename Scalar>
+inline void hcubature_evaluate(const Eval& eval,
+                               Eigen::Matrix<Scalar, Eigen::Dynamic, 1>& fx,
+                               const bool parallel) {
+  const int num_points = fx.size();
+  if constexpr (std::is_arithmetic<Scalar>::value) {
+    if (parallel && num_points >= hcubature_min_parallel_points) {
+      tbb::parallel_for(tbb::blocked_range<int>(0, num_points),
+                        [&](const tbb::blocked_range<int>& r) {
+                          for (int j = r.begin(); j != r.end(); ++j) {
+                            fx.coeffRef(j) = eval(j);
+                          }
+                        });
+      return;
+    }
+  }
+  for (int j = 0; j != num_points; ++j) {
+    fx.coeffRef(j) = eval(j);
+  }
+}
+
 /**
  * Compute the integral of the function to be integrated (integrand) from a to b
  * for one dimension.
@@ -249,32 +340,33 @@ inline auto gauss_kronrod(const F& integrand, const T_a a, const T_b b,
 
 /**
  * Compute the integral of the function to be integrated (integrand) from a to b
- * for more than one dimensions.
+ * for more than one dimensions. The points of the rule are formed for the
+ * whole box first and the integrand is evaluated over all of them as one
+ * batch.
  *
  * @tparam F type of the integrand
- * @tparam GenzMalik type of -----
  * @tparam T_a type of lower limit of integration
  * @tparam T_b type of upper limit of integration
  * @tparam ParsTupleT type of the tuple of parameters for the integrand
  * @param[out] integrand function to be integrated
- * @param[in] genz_malik tuple of GenzMalik weights
+ * @param[in] genz_malik Genz-Malik rule of dimension dim
  * @param dim dimension of the multidimensional integral
  * @param a lower limit of integration
  * @param b upper limit of integration
  * @param pars_tuple Tuple of parameters for the integrand
+ * @param parallel whether large batches may be evaluated in parallel
  * @return numeric integral of the integrand, error, and suggested coordinate to
  * subdivide next
  */
-template <typename F, typename GenzMalik, typename T_a, typename T_b,
-          typename ParsTupleT>
-inline auto integrate_GenzMalik(const F& integrand, const GenzMalik& genz_malik,
-                                const int dim,
+template <typename F, typename T_a, typename T_b, typename ParsTupleT>
+inline auto integrate_GenzMalik(const F& integrand,
+                                const GenzMalikRule& genz_malik, const int dim,
                                 const Eigen::Matrix<T_a, Eigen::Dynamic, 1>& a,
                                 const Eigen::Matrix<T_b, Eigen::Dynamic, 1>& b,
-                                const ParsTupleT& pars_tuple) {
-  auto&& points = std::get<0>(genz_malik);
-  auto&& weights = std::get<1>(genz_malik);
-  auto&& weights_low_deg = std::get<2>(genz_malik);
+                                const ParsTupleT& pars_tuple,
+                                const bool parallel = false) {
+  auto&& weights = genz_malik.weights_;
+  auto&& weights_low_deg = genz_malik.weights_low_deg_;
   using delta_t = return_type_t<T_a, T_b>;
   Eigen::Matrix<delta_t, Eigen::Dynamic, 1> c(dim);
   Eigen::Matrix<delta_t, Eigen::Dynamic, 1> deltac(dim);
@@ -290,42 +382,40 @@ inline auto integrate_GenzMalik(const F& integrand, const GenzMalik& genz_malik,
   for (std::size_t i = 0; i != dim; i++) {
     v *= deltac[i];
   }
+
+  const int num_points = genz_malik.points_.cols();
+  Eigen::Matrix<delta_t, Eigen::Dynamic, Eigen::Dynamic> x(dim, num_points);
+  for (int j = 0; j != num_points; ++j) {
+    for (int i = 0; i != dim; ++i) {
+      x.coeffRef(i, j) = c.coeff(i)
+                         + deltac.coeff(i) * genz_malik.points_.coeff(i, j);
+    }
+  }
+  Eigen::Matrix<Scalar, Eigen::Dynamic, 1> fx(num_points);
+  hcubature_evaluate(
+      [&](int j) {
+        return math::apply(
+            [&](auto&&... args) { return integrand(x.col(j), args...); },
+            pars_tuple);
+      },
+      fx, parallel);
+
   Eigen::Matrix<Scalar, 5, 1> f = Eigen::Matrix<Scalar, 5, 1>::Zero();
-  f.coeffRef(0)
-      = math::apply([](auto&& integrand, auto&& c,
-                       auto&&... args) { return integrand(c, args...); },
-                    pars_tuple, integrand, c);
+  f.coeffRef(0) = fx.coeff(0);
   Eigen::Matrix<Scalar, Eigen::Dynamic, 1> divdiff(dim);
   for (auto i = 0; i != dim; i++) {
-    auto p2 = deltac.cwiseProduct(points[0].col(i));
-    auto f2i = math::apply(
-        [](auto&& integrand, auto&& c, auto&& p2, auto&&... args) {
-          return integrand(c + p2, args...) + integrand(c - p2, args...);
-        },
-        pars_tuple, integrand, c, p2);
-    auto p3 = deltac.cwiseProduct(points[1].col(i));
-    auto f3i = math::apply(
-        [](auto&& integrand, auto&& c, auto&& p3, auto&&... args) {
-          return integrand(c + p3, args...) + integrand(c - p3, args...);
-        },
-        pars_tuple, integrand, c, p3);
+    Scalar f2i = fx.coeff(1 + 4 * i) + fx.coeff(2 + 4 * i);
+    Scalar f3i = fx.coeff(3 + 4 * i) + fx.coeff(4 + 4 * i);
     f.coeffRef(1) += f2i;
     f.coeffRef(2) += f3i;
     divdiff[i] = fabs(f3i + 12.0 * f.coeff(0) - 7.0 * f2i);
   }
-  for (auto i = 0; i != points[2].cols(); i++) {
-    f.coeffRef(3) += math::apply(
-        [](auto&& integrand, auto&& cc, auto&&... args) {
-          return integrand(cc, args...);
-        },
-        pars_tuple, integrand, c + deltac.cwiseProduct(points[2].col(i)));
+  const int num_points_3 = num_points - 1 - 4 * dim - (1 << dim);
+  for (auto i = 1 + 4 * dim; i != 1 + 4 * dim + num_points_3; i++) {
+    f.coeffRef(3) += fx.coeff(i);
   }
-  for (auto i = 0; i != points[3].cols(); i++) {
-    f.coeffRef(4) += math::apply(
-        [](auto&& integrand, auto&& cc, auto&&... args) {
-          return integrand(cc, args...);
-        },
-        pars_tuple, integrand, c + deltac.cwiseProduct(points[3].col(i)));
+  for (auto i = 1 + 4 * dim + num_points_3; i != num_points; i++) {
+    f.coeffRef(4) += fx.coeff(i);
   }
 
   Scalar I = v * weights.dot(f);
@@ -380,6 +470,15 @@ struct Box {
  * specified relative and absolute tolerances or maximum number of evaluations.
  * \f$a\f$ and \f$b\f$ can be finite or infinite and should be given as vectors.
  *
+ * The box with the largest error estimate is taken from a heap for every
+ * subdivision, the Genz-Malik rule of each dimension is built once per
+ * thread, and the integrand is evaluated at all points of a box as one
+ * batch. If \p parallel is true and the integrand and its arguments are
+ * arithmetic, batches of at least
+ * <code>internal::hcubature_min_parallel_points</code> points are
+ * evaluated with TBB, so the integrand must then be safe to call
+ * concurrently.
+ *
  * @tparam F Type of f
  * @tparam T_a Type of lower limit of integration
  * @tparam T_b Type of upper limit of integration
@@ -395,6 +494,8 @@ struct Box {
  * @param max_eval maximal number of evaluations
  * @param reqAbsError absolute error
  * @param reqRelError relative error as vector
+ * @param parallel whether large batches of points may be evaluated in
+ * parallel
  *
  * @return The value of the [dim]-dimensional integral of \f$f\f$ from \f$a\f$
  to \f$b\f$.
@@ -406,7 +507,7 @@ inline auto hcubature(const F& integrand, const ParsTuple& pars, const int dim,
                       const Eigen::Matrix<T_a, Eigen::Dynamic, 1>& a,
                       const Eigen::Matrix<T_b, Eigen::Dynamic, 1>& b,
                       const int max_eval, const TAbsErr reqAbsError,
-                      const TRelErr reqRelError) {
+                      const TRelErr reqRelError, const bool parallel = false) {
   using Scalar = return_type_t<ParsTuple, T_a, T_b, TAbsErr, TRelErr>;
   using eig_vec_a = Eigen::Matrix<T_a, Eigen::Dynamic, 1>;
   using eig_vec_b = Eigen::Matrix<T_b, Eigen::Dynamic, 1>;
@@ -416,18 +517,15 @@ inline auto hcubature(const F& integrand, const ParsTuple& pars, const int dim,
   Scalar result;
   Scalar err;
   auto kdivide = 0;
-  std::tuple<
-      std::array<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>, 4>,
-      Eigen::Matrix<double, 5, 1>, Eigen::Matrix<double, 4, 1>>
-      genz_malik;
+  const internal::GenzMalikRule* genz_malik = nullptr;
 
   if (dim == 1) {
     std::tie(result, err)
         = internal::gauss_kronrod(integrand, a[0], b[0], pars);
   } else {
-    genz_malik = internal::make_GenzMalik(dim);
-    std::tie(result, err, kdivide)
-        = internal::integrate_GenzMalik(integrand, genz_malik, dim, a, b, pars);
+    genz_malik = &internal::genz_malik_rule(dim);
+    std::tie(result, err, kdivide) = internal::integrate_GenzMalik(
+        integrand, *genz_malik, dim, a, b, pars, parallel);
   }
   auto numevals
       = (dim == 1) ? 15 : 1 + 4 * dim + 2 * dim * (dim - 1) + std::pow(2, dim);
@@ -445,17 +543,24 @@ inline auto hcubature(const F& integrand, const ParsTuple& pars, const int dim,
   std::vector<box_t> ms;
   ms.reserve(numevals);
   ms.emplace_back(a, b, result, kdivide);
-  auto get_largest_box_idx = [](auto&& box_vec) {
-    auto max_it = std::max_element(box_vec.begin(), box_vec.end());
-    return std::distance(box_vec.begin(), max_it);
-  };
   std::vector<Scalar> err_vec;
   err_vec.reserve(numevals);
   err_vec.push_back(err);
+  // boxes not yet subdivided by their error estimate, ties going to the
+  // box created first
+  using heap_entry_t = std::pair<double, std::size_t>;
+  auto lower_priority = [](const heap_entry_t& x, const heap_entry_t& y) {
+    return x.first < y.first || (x.first == y.first && x.second > y.second);
+  };
+  std::priority_queue<heap_entry_t, std::vector<heap_entry_t>,
+                      decltype(lower_priority)>
+      heap(lower_priority);
+  heap.emplace(value_of(err), 0);
   while ((numevals < maxEval)
          && (error > fmax(reqRelError * fabs(val), reqAbsError))
          && fabs(val) < INFTY) {
-    auto err_idx = get_largest_box_idx(err_vec);
+    const std::size_t err_idx = heap.top().second;
+    heap.pop();
     auto&& box = ms[err_idx];
     auto w = (box.b_[box.kdiv_] - box.a_[box.kdiv_]) / 2;
     eig_vec_a ma = Eigen::Map<const eig_vec_a>(box.a_.data(), box.a_.size());
@@ -475,9 +580,9 @@ inline auto hcubature(const F& integrand, const ParsTuple& pars, const int dim,
           = internal::gauss_kronrod(integrand, box.a_[0], mb[0], pars);
     } else {
       std::tie(result_1, err_1, kdivide_1) = internal::integrate_GenzMalik(
-          integrand, genz_malik, dim, ma, box.b_, pars);
+          integrand, *genz_malik, dim, ma, box.b_, pars, parallel);
       std::tie(result_2, err_2, kdivide_2) = internal::integrate_GenzMalik(
-          integrand, genz_malik, dim, box.a_, mb, pars);
+          integrand, *genz_malik, dim, box.a_, mb, pars, parallel);
     }
     box_t box1(std::move(ma), box.b_, result_1, kdivide_1);
     box_t box2(box.a_, std::move(mb), result_2, kdivide_2);
@@ -489,6 +594,8 @@ inline auto hcubature(const F& integrand, const ParsTuple& pars, const int dim,
     ms.push_back(std::move(box2));
     err_vec.push_back(err_1);
     err_vec.push_back(err_2);
+    heap.emplace(value_of(err_1), ms.size() - 2);
+    heap.emplace(value_of(err_2), ms.size() - 1);
     numevals += 2 * evals_per_box;
   }
   result = 0.0;
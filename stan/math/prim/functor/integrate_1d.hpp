@@ -6,6 +6,7 @@
 #include <stan/math/prim/fun/constants.hpp>
 #include <stan/math/prim/functor/integrate_1d_adapter.hpp>
 #include <boost/math/quadrature/exp_sinh.hpp>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
 #include <boost/math/quadrature/sinh_sinh.hpp>
 #include <boost/math/quadrature/tanh_sinh.hpp>
 #include <cmath>
@@ -15,6 +16,90 @@
 
 namespace stan {
 namespace math {
+
+/**
+ * Quadrature rules of <code>integrate_1d</code>
+ */
+enum class integrate_1d_rule {
+  /**
+   * Adaptive tanh-sinh, exp-sinh or sinh-sinh quadrature depending on the
+   * limits of integration. Robust to endpoint singularities.
+   */
+  double_exponential,
+  /**
+   * Adaptive 21 point Gauss-Kronrod quadrature with interval bisection.
+   * Needs far fewer evaluations than the double exponential rules for
+   * smooth integrands on finite intervals.
+   */
+  gauss_kronrod,
+  /**
+   * A single 21 point Gauss-Kronrod rule over the whole interval, exact for
+   * polynomials up to degree 31. The number of evaluations is fixed and
+   * the error estimate is not checked.
+   */
+  gauss_kronrod_fixed
+};
+
+namespace internal {
+
+/**
+ * Return the quadrature object of type \p Integrator of the calling thread.
+ * The double exponential rules compute their tables of abscissas and
+ * weights on construction, so one object per thread is shared by all
+ * integrals instead of building the tables on every call.
+ *
+ * @tparam Integrator type of Boost quadrature object
+ * @return quadrature object of this thread
+ */
+template <typename Integrator>
+inline const Integrator& integrate_1d_integrator() {
+  static thread_local const Integrator integrator;
+  return integrator;
+}
+
+/**
+ * Integrate a single variable function f from a to b with the 21 point
+ * Gauss-Kronrod rule, to within a specified relative tolerance if
+ * \p adaptive is true. See <code>integrate</code> for the xc argument.
+ *
+ * @tparam F Type of f
+ * @param f the function to be integrated
+ * @param a lower limit of integration
+ * @param b upper limit of integration
+ * @param relative_tolerance target relative tolerance of the adaptive rule
+ * @param adaptive whether to bisect the interval until the tolerance is met
+ * @return numeric integral of function f
+ */
+template <typename F>
+inline double integrate_gauss_kronrod(const F& f, double a, double b,
+                                      double relative_tolerance,
+                                      bool adaptive) {
+  static constexpr const char* function = "integrate";
+  static constexpr unsigned max_depth = 15;
+  const bool finite = !std::isinf(a) && !std::isinf(b);
+  const double mid = 0.5 * (a + b);
+  auto f_wrap = [&](double x) {
+    if (!finite) {
+      return f(x, NOT_A_NUMBER);
+    }
+    return x < mid ? f(x, a - x) : f(x, b - x);
+  };
+  double error = 0.0;
+  double L1 = 0.0;
+  double Q = boost::math::quadrature::gauss_kronrod<double, 21>::integrate(
+      f_wrap, a, b, adaptive ? max_depth : 0, relative_tolerance, &error, &L1);
+  if (adaptive && error > relative_tolerance * L1) {
+    [error]() STAN_COLD_PATH {
+      throw_domain_error(
+          function, "error estimate of integral", error, "",
+          " exceeds the given relative tolerance times norm of integral");
+    }();
+  }
+  return Q;
+}
+
+}  // namespace internal
+
 /**
  * Integrate a single variable function f from a to b to within a specified
  * relative tolerance. This function assumes a is less than b.
@@ -40,18 +125,31 @@ namespace math {
  *
  * If either limit is infinite, xc is set to NaN
  *
+ * With the Gauss-Kronrod rules the integral is not split at zero, and xc is
+ * a - x or b - x, computed directly.
+ *
  * @tparam T Type of f
  * @param f the function to be integrated
  * @param a lower limit of integration
  * @param b upper limit of integration
  * @param relative_tolerance target relative tolerance passed to Boost
  * quadrature
+ * @param rule quadrature rule
  * @return numeric integral of function f
  */
 template <typename F>
-inline double integrate(const F& f, double a, double b,
-                        double relative_tolerance) {
+inline double integrate(
+    const F& f, double a, double b, double relative_tolerance,
+    integrate_1d_rule rule = integrate_1d_rule::double_exponential) {
   static constexpr const char* function = "integrate";
+  if (rule != integrate_1d_rule::double_exponential) {
+    return internal::integrate_gauss_kronrod(
+        f, a, b, relative_tolerance, rule == integrate_1d_rule::gauss_kronrod);
+  }
+  using boost::math::quadrature::exp_sinh;
+  using boost::math::quadrature::sinh_sinh;
+  using boost::math::quadrature::tanh_sinh;
+  using internal::integrate_1d_integrator;
   double error1 = 0.0;
   double error2 = 0.0;
   double L1 = 0.0;
@@ -93,13 +191,13 @@ inline double integrate(const F& f, double a, double b,
   // function for xc info)
   auto f_wrap = [&f](double x) { return f(x, NOT_A_NUMBER); };
   if (std::isinf(a) && std::isinf(b)) {
-    boost::math::quadrature::sinh_sinh<double> integrator;
+    const auto& integrator = integrate_1d_integrator<sinh_sinh<double>>();
     double Q = integrator.integrate(f_wrap, relative_tolerance, &error1, &L1,
                                     &levels);
     one_integral_convergence_check(error1, relative_tolerance, L1);
     return Q;
   } else if (std::isinf(a)) {
-    boost::math::quadrature::exp_sinh<double> integrator;
+    const auto& integrator = integrate_1d_integrator<exp_sinh<double>>();
     /**
      * If the integral crosses zero, break it into two (advice from the Boost
      * implementation:
@@ -111,7 +209,8 @@ inline double integrate(const F& f, double a, double b,
       one_integral_convergence_check(error1, relative_tolerance, L1);
       return Q;
     } else {
-      boost::math::quadrature::tanh_sinh<double> integrator_right;
+      const auto& integrator_right
+          = integrate_1d_integrator<tanh_sinh<double>>();
       double Q = integrator.integrate(f_wrap, a, 0.0, relative_tolerance,
                                       &error1, &L1, &levels)
                  + integrator_right.integrate(
@@ -121,14 +220,15 @@ inline double integrate(const F& f, double a, double b,
       return Q;
     }
   } else if (std::isinf(b)) {
-    boost::math::quadrature::exp_sinh<double> integrator;
+    const auto& integrator = integrate_1d_integrator<exp_sinh<double>>();
     if (a >= 0.0) {
       double Q = integrator.integrate(f_wrap, a, b, relative_tolerance, &error1,
                                       &L1, &levels);
       one_integral_convergence_check(error1, relative_tolerance, L1);
       return Q;
     } else {
-      boost::math::quadrature::tanh_sinh<double> integrator_left;
+      const auto& integrator_left
+          = integrate_1d_integrator<tanh_sinh<double>>();
       double Q = integrator_left.integrate(f_wrap, a, 0, relative_tolerance,
                                            &error1, &L1, &levels)
                  + integrator.integrate(f_wrap, relative_tolerance, &error2,
@@ -139,7 +239,7 @@ inline double integrate(const F& f, double a, double b,
     }
   } else {
     auto f_wrap = [&f](double x, double xc) { return f(x, xc); };
-    boost::math::quadrature::tanh_sinh<double> integrator;
+    const auto& integrator = integrate_1d_integrator<tanh_sinh<double>>();
     if (a < 0.0 && b > 0.0) {
       double Q = integrator.integrate(f_wrap, a, 0.0, relative_tolerance,
                                       &error1, &L1, &levels)
@@ -159,9 +259,11 @@ inline double integrate(const F& f, double a, double b,
 
 /**
  * Compute the integral of the single variable function f from a to b to within
- * a specified relative tolerance. a and b can be finite or infinite.
+ * a specified relative tolerance with the given quadrature rule. a and b can
+ * be finite or infinite.
  *
  * @tparam T Type of f
+ * @param rule quadrature rule
  * @param f the function to be integrated
  * @param a lower limit of integration
  * @param b upper limit of integration
@@ -172,9 +274,9 @@ inline double integrate(const F& f, double a, double b,
  */
 template <typename F, typename... Args,
           require_all_st_arithmetic<Args...>* = nullptr>
-inline double integrate_1d_impl(const F& f, double a, double b,
-                                double relative_tolerance, std::ostream* msgs,
-                                const Args&... args) {
+inline double integrate_1d_impl(integrate_1d_rule rule, const F& f, double a,
+                                double b, double relative_tolerance,
+                                std::ostream* msgs, const Args&... args) {
   static constexpr const char* function = "integrate_1d";
   check_less_or_equal(function, "lower limit", a, b);
   if (unlikely(a == b)) {
@@ -185,10 +287,32 @@ inline double integrate_1d_impl(const F& f, double a, double b,
   } else {
     return integrate(
         [&](const auto& x, const auto& xc) { return f(x, xc, msgs, args...); },
-        a, b, relative_tolerance);
+        a, b, relative_tolerance, rule);
   }
 }
 
+/**
+ * Compute the integral of the single variable function f from a to b to within
+ * a specified relative tolerance. a and b can be finite or infinite.
+ *
+ * @tparam T Type of f
+ * @param f the function to be integrated
+ * @param a lower limit of integration
+ * @param b upper limit of integration
+ * @param relative_tolerance tolerance passed to Boost quadrature
+ * @param[in, out] msgs the print stream for warning messages
+ * @param args additional arguments passed to f
+ * @return numeric integral of function f
+ */
+template <typename F, typename... Args,
+          require_all_st_arithmetic<Args...>* = nullptr>
+inline double integrate_1d_impl(const F& f, double a, double b,
+                                double relative_tolerance, std::ostream* msgs,
+                                const Args&... args) {
+  return integrate_1d_impl(integrate_1d_rule::double_exponential, f, a, b,
+                           relative_tolerance, msgs, args...);
+}
+
 /**
  * Compute the integral of the single variable function f from a to b to within
  * a specified relative tolerance. a and b can be finite or infinite.
@@ -233,17 +357,17 @@ inline double integrate_1d_impl(const F& f, double a, double b,
  * @param x_i additional integer data to be passed to f
  * @param[in, out] msgs the print stream for warning messages
  * @param relative_tolerance tolerance passed to Boost quadrature
+ * @param rule quadrature rule, see <code>integrate_1d_rule</code>
  * @return numeric integral of function f
  */
 template <typename F>
-inline double integrate_1d(const F& f, double a, double b,
-                           const std::vector<double>& theta,
-                           const std::vector<double>& x_r,
-                           const std::vector<int>& x_i, std::ostream* msgs,
-                           const double relative_tolerance
-                           = std::sqrt(EPSILON)) {
-  return integrate_1d_impl(integrate_1d_adapter<F>(f), a, b, relative_tolerance,
-                           msgs, theta, x_r, x_i);
+inline double integrate_1d(
+    const F& f, double a, double b, const std::vector<double>& theta,
+    const std::vector<double>& x_r, const std::vector<int>& x_i,
+    std::ostream* msgs, const double relative_tolerance = std::sqrt(EPSILON),
+    integrate_1d_rule rule = integrate_1d_rule::double_exponential) {
+  return integrate_1d_impl(rule, integrate_1d_adapter<F>(f), a, b,
+                           relative_tolerance, msgs, theta, x_r, x_i);
 }
 
 }  // namespace math
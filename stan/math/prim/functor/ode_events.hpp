@@ -0,0 +1,326 @@
+#ifndef STAN_MATH_PRIM_FUNCTOR_ODE_EVENTS_HPP
+#define STAN_MATH_PRIM_FUNCTOR_ODE_EVENTS_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/functor/apply.hpp>
+#include <stan/math/prim/functor/coupled_ode_system.hpp>
+#include <stan/math/prim/functor/ode_store_sensitivities.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <boost/numeric/odeint.hpp>
+#include <algorithm>
+#include <ostream>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Right hand side of an ODE with a schedule of events, y' = f(t, y) + r_e
+ * between event e and event e + 1, where r_e is the input rate set at
+ * event e and no input is active before the first event. The boluses of
+ * the events are passed as an argument so that their sensitivities are
+ * part of the coupled system, but only enter the solution through the
+ * jumps applied by <code>ode_events_apply</code>.
+ *
+ * An analytic Jacobian or Jacobian-vector product of \p f is forwarded,
+ * since the rates do not depend on the states.
+ *
+ * @tparam F type of ODE right hand side
+ */
+template <typename F>
+struct ode_events_rhs {
+  const F& f_;
+  /**
+   * Index of the last event applied, -1 before the first event.
+   */
+  const int& segment_;
+
+  template <typename T_t, typename T_y, typename T_bolus, typename T_rate,
+            typename... T_Args>
+  inline Eigen::Matrix<return_type_t<T_t, T_y, T_rate, T_Args...>,
+                       Eigen::Dynamic, 1>
+  operator()(const T_t& t, const T_y& y, std::ostream* msgs,
+             const std::vector<Eigen::Matrix<T_bolus, Eigen::Dynamic, 1>>&,
+             const std::vector<Eigen::Matrix<T_rate, Eigen::Dynamic, 1>>& rates,
+             const T_Args&... args) const {
+    using T_return = return_type_t<T_t, T_y, T_rate, T_Args...>;
+    Eigen::Matrix<T_return, Eigen::Dynamic, 1> dy_dt = f_(t, y, msgs, args...);
+    if (segment_ >= 0) {
+      dy_dt += rates[segment_].template cast<T_return>();
+    }
+    return dy_dt;
+  }
+
+  template <typename T_bolus, typename T_rate, typename... T_Args,
+            typename FF = F>
+  inline auto jacobian(double t, const Eigen::VectorXd& y, std::ostream* msgs,
+                       const std::vector<T_bolus>&,
+                       const std::vector<T_rate>&, const T_Args&... args) const
+      -> decltype(std::declval<const FF&>().jacobian(t, y, msgs, args...)) {
+    return f_.jacobian(t, y, msgs, args...);
+  }
+
+  template <typename T_bolus, typename T_rate, typename... T_Args,
+            typename FF = F>
+  inline auto jacobian_vector_product(double t, const Eigen::VectorXd& y,
+                                      const Eigen::VectorXd& v,
+                                      std::ostream* msgs,
+                                      const std::vector<T_bolus>&,
+                                      const std::vector<T_rate>&,
+                                      const T_Args&... args) const
+      -> decltype(std::declval<const FF&>().jacobian_vector_product(
+          t, y, v, msgs, args...)) {
+    return f_.jacobian_vector_product(t, y, v, msgs, args...);
+  }
+};
+
+/**
+ * Check the event schedule of an ODE solve with events.
+ */
+template <typename T_bolus, typename T_rate>
+inline void ode_events_check(
+    const char* function_name, size_t N, double t0,
+    const std::vector<double>& event_times,
+    const std::vector<Eigen::Matrix<T_bolus, Eigen::Dynamic, 1>>& bolus,
+    const std::vector<Eigen::Matrix<T_rate, Eigen::Dynamic, 1>>& rates) {
+  check_finite(function_name, "event times", event_times);
+  check_sorted(function_name, "event times", event_times);
+  if (!event_times.empty()) {
+    check_greater_or_equal(function_name, "event times", event_times[0], t0);
+  }
+  check_size_match(function_name, "number of boluses", bolus.size(),
+                   "number of events", event_times.size());
+  check_size_match(function_name, "number of rates", rates.size(),
+                   "number of events", event_times.size());
+  for (size_t e = 0; e < event_times.size(); ++e) {
+    check_size_match(function_name, "size of bolus", bolus[e].size(),
+                     "states", N);
+    check_size_match(function_name, "size of rate", rates[e].size(), "states",
+                     N);
+    check_finite(function_name, "bolus", bolus[e]);
+    check_finite(function_name, "rate", rates[e]);
+  }
+}
+
+/**
+ * Returns the index of the last event before time \p t, which is the
+ * event whose rate is active at \p t, or -1 if there is none.
+ */
+inline int ode_events_segment(const std::vector<double>& event_times,
+                              double t) {
+  return static_cast<int>(std::lower_bound(event_times.begin(),
+                                           event_times.end(), t)
+                          - event_times.begin())
+         - 1;
+}
+
+/**
+ * Apply event \p e to the coupled state of an ODE solve with events: add
+ * the bolus of the event to the states and, if the boluses are
+ * autodiff variables, the identity to the sensitivities of the states
+ * with respect to the bolus. The sensitivities with respect to the
+ * boluses directly follow those with respect to the initial state.
+ *
+ * @param[in, out] coupled_state states followed by their sensitivities
+ * @param N number of states
+ * @param num_y0_vars number of autodiff variables in the initial state
+ * @param bolus boluses of the events
+ * @param e index of the event
+ */
+template <typename T_bolus>
+inline void ode_events_apply(
+    std::vector<double>& coupled_state, size_t N, size_t num_y0_vars,
+    const std::vector<Eigen::Matrix<T_bolus, Eigen::Dynamic, 1>>& bolus,
+    size_t e) {
+  for (size_t i = 0; i < N; ++i) {
+    coupled_state[i] += value_of(bolus[e].coeff(i));
+  }
+  if (is_var<T_bolus>::value) {
+    for (size_t i = 0; i < N; ++i) {
+      coupled_state[(1 + num_y0_vars + e * N + i) * N + i] += 1.0;
+    }
+  }
+}
+
+}  // namespace internal
+
+/**
+ * Solve the ODE initial value problem y' = f(t, y), y(t0) = y0 at a set of
+ * times, { t1, t2, t3, ... } with a schedule of events using the
+ * Dormand-Prince algorithm, a 4th/5th order Runge-Kutta method.
+ *
+ * At each event time t_e the bolus b_e is added to the state and the
+ * input rate r_e replaces the rate of the previous event, so that between
+ * event e and event e + 1 the state follows y' = f(t, y) + r_e. A dosing
+ * history of boluses and infusions therefore takes a single solve, in
+ * which the integration is restarted at every event instead of stepping
+ * across the discontinuity. The solution at an output time equal to an
+ * event time is taken before the event, and events at or after the last
+ * output time are ignored.
+ *
+ * \p f must define an operator() with the same signature as for
+ * <code>ode_rk45</code>.
+ *
+ * @tparam F Type of ODE right hand side
+ * @tparam T_y0 Type of initial state
+ * @tparam T_ts Type of output times
+ * @tparam T_bolus Type of scalars of the boluses
+ * @tparam T_rate Type of scalars of the rates
+ * @tparam Args Types of pass-through parameters
+ *
+ * @param f Right hand side of the ODE
+ * @param y0_arg Initial state
+ * @param t0 Initial time
+ * @param ts Times at which to solve the ODE at. All values must be sorted and
+ *   greater than t0.
+ * @param event_times Sorted times of the events, not less than t0
+ * @param bolus Bolus added to the state at each event
+ * @param rates Input rate active from each event until the next one
+ * @param relative_tolerance Relative tolerance passed to Boost
+ * @param absolute_tolerance Absolute tolerance passed to Boost
+ * @param max_num_steps Upper limit on the number of integration steps to
+ *   take between each output (error if exceeded)
+ * @param[in, out] msgs the print stream for warning messages
+ * @param args Extra arguments passed unmodified through to ODE right hand side
+ * @return Solution to ODE at times \p ts
+ */
+template <typename F, typename T_y0, typename T_ts, typename T_bolus,
+          typename T_rate, typename... Args,
+          require_eigen_col_vector_t<T_y0>* = nullptr>
+std::vector<Eigen::Matrix<return_type_t<T_y0, T_ts, T_bolus, T_rate, Args...>,
+                          Eigen::Dynamic, 1>>
+ode_rk45_events_tol(
+    const F& f, const T_y0& y0_arg, double t0, const std::vector<T_ts>& ts,
+    const std::vector<double>& event_times,
+    const std::vector<Eigen::Matrix<T_bolus, Eigen::Dynamic, 1>>& bolus,
+    const std::vector<Eigen::Matrix<T_rate, Eigen::Dynamic, 1>>& rates,
+    double relative_tolerance, double absolute_tolerance,
+    long int max_num_steps,  // NOLINT(runtime/int)
+    std::ostream* msgs, const Args&... args) {
+  using boost::numeric::odeint::integrate_times;
+  using boost::numeric::odeint::make_dense_output;
+  using boost::numeric::odeint::max_step_checker;
+  using boost::numeric::odeint::no_progress_error;
+  using boost::numeric::odeint::runge_kutta_dopri5;
+  static constexpr const char* function_name = "ode_rk45_events_tol";
+
+  using T_y0_t0 = return_type_t<T_y0, double>;
+  Eigen::Matrix<T_y0_t0, Eigen::Dynamic, 1> y0
+      = y0_arg.template cast<T_y0_t0>();
+  const size_t N = y0.size();
+
+  check_finite(function_name, "initial state", y0);
+  check_finite(function_name, "initial time", t0);
+  check_finite(function_name, "times", ts);
+  std::tuple<ref_type_t<Args>...> args_ref_tuple(args...);
+  math::apply(
+      [&](const auto&... args_ref) {
+        std::vector<int> unused_temp{
+            0,
+            (check_finite(function_name, "ode parameters and data", args_ref),
+             0)...};
+      },
+      args_ref_tuple);
+  check_nonzero_size(function_name, "initial state", y0);
+  check_nonzero_size(function_name, "times", ts);
+  check_sorted(function_name, "times", ts);
+  check_less(function_name, "initial time", t0, ts[0]);
+  internal::ode_events_check(function_name, N, t0, event_times, bolus, rates);
+  check_positive_finite(function_name, "relative_tolerance",
+                        relative_tolerance);
+  check_positive_finite(function_name, "absolute_tolerance",
+                        absolute_tolerance);
+  check_positive(function_name, "max_num_steps", max_num_steps);
+
+  int segment = -1;
+  const internal::ode_events_rhs<F> f_events{f, segment};
+  auto&& coupled_system = math::apply(
+      [&](const auto&... args_ref) {
+        return coupled_ode_system<
+            internal::ode_events_rhs<F>, T_y0_t0,
+            std::vector<Eigen::Matrix<T_bolus, Eigen::Dynamic, 1>>,
+            std::vector<Eigen::Matrix<T_rate, Eigen::Dynamic, 1>>,
+            ref_type_t<Args>...>(f_events, y0, msgs, bolus, rates,
+                                 args_ref...);
+      },
+      args_ref_tuple);
+  const size_t num_y0_vars = is_var<T_y0_t0>::value ? N : 0;
+
+  std::vector<double> coupled_state = coupled_system.initial_state();
+  std::vector<std::vector<double>> coupled_states;
+  coupled_states.reserve(ts.size());
+  auto observer = [&](const std::vector<double>& state, double t) {
+    // the initial state and the state at an event are not outputs
+    if (coupled_states.size() < ts.size()
+        && t == value_of(ts[coupled_states.size()])) {
+      coupled_states.push_back(state);
+    }
+  };
+
+  const double t_last = value_of(ts.back());
+  double t_init = t0;
+  size_t e = 0;
+  size_t n = 0;
+  std::vector<double> ts_segment;
+  while (n < ts.size()) {
+    const bool event = e < event_times.size() && event_times[e] < t_last;
+    // solution times up to and including the next event
+    ts_segment.assign(1, t_init);
+    for (; n < ts.size() && (!event || value_of(ts[n]) <= event_times[e]);
+         ++n) {
+      ts_segment.push_back(value_of(ts[n]));
+    }
+    if (event && ts_segment.back() != event_times[e]) {
+      ts_segment.push_back(event_times[e]);
+    }
+    if (ts_segment.size() > 1) {
+      try {
+        integrate_times(
+            make_dense_output(
+                absolute_tolerance, relative_tolerance,
+                runge_kutta_dopri5<std::vector<double>, double,
+                                   std::vector<double>, double>()),
+            std::ref(coupled_system), coupled_state, std::begin(ts_segment),
+            std::end(ts_segment), 0.1, observer,
+            max_step_checker(max_num_steps));
+      } catch (const no_progress_error&) {
+        throw_domain_error(function_name, "", ts_segment.back(),
+                           "Failed to integrate to next output time (",
+                           ") in less than max_num_steps steps");
+      }
+      t_init = ts_segment.back();
+    }
+    if (event) {
+      internal::ode_events_apply(coupled_state, N, num_y0_vars, bolus, e);
+      segment = e;
+      ++e;
+    }
+  }
+
+  std::vector<Eigen::Matrix<return_type_t<T_y0, T_ts, T_bolus, T_rate, Args...>,
+                            Eigen::Dynamic, 1>>
+      y;
+  y.reserve(ts.size());
+  for (n = 0; n < ts.size(); ++n) {
+    // the derivative with respect to an output time is the right hand side
+    // with the rate active at that time
+    segment = internal::ode_events_segment(event_times, value_of(ts[n]));
+    math::apply(
+        [&](const auto&... args_ref) {
+          y.emplace_back(ode_store_sensitivities(f_events, coupled_states[n],
+                                                 y0, t0, ts[n], msgs, bolus,
+                                                 rates, args_ref...));
+        },
+        args_ref_tuple);
+  }
+  return y;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,151 @@
+#ifndef STAN_MATH_PRIM_FUNCTOR_ODE_LINEAR_HPP
+#define STAN_MATH_PRIM_FUNCTOR_ODE_LINEAR_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/matrix_exp.hpp>
+#include <stan/math/prim/fun/value_of_rec.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Check the arguments of <code>ode_linear</code>.
+ */
+template <typename T_A, typename T_b, typename T_y0, typename T_t0,
+          typename T_ts>
+inline void ode_linear_check(const char* function_name, const T_A& A,
+                             const T_b& b, const T_y0& y0, const T_t0& t0,
+                             const std::vector<T_ts>& ts) {
+  check_square(function_name, "system matrix", A);
+  check_nonzero_size(function_name, "initial state", y0);
+  check_size_match(function_name, "rows of system matrix", A.rows(),
+                   "size of initial state", y0.size());
+  check_size_match(function_name, "size of input vector", b.size(),
+                   "size of initial state", y0.size());
+  check_finite(function_name, "system matrix", A);
+  check_finite(function_name, "input vector", b);
+  check_finite(function_name, "initial state", y0);
+  check_finite(function_name, "initial time", t0);
+  check_finite(function_name, "times", ts);
+  check_nonzero_size(function_name, "times", ts);
+  check_sorted(function_name, "times", ts);
+  check_less(function_name, "initial time", t0, ts[0]);
+}
+
+/**
+ * Returns the matrix of the augmented system z' = M z with z = [y; 1] of
+ * the linear system y' = A y + b,
+ * \f[
+ *   M = \left[ \begin{array}{cc} A & b \\ 0 & 0 \end{array} \right],
+ * \f]
+ * whose exponential propagates the state whether or not A is invertible.
+ */
+template <typename T_A, typename T_b>
+inline Eigen::Matrix<return_type_t<T_A, T_b>, Eigen::Dynamic, Eigen::Dynamic>
+ode_linear_augmented(const T_A& A, const T_b& b) {
+  using T_return = return_type_t<T_A, T_b>;
+  const int N = A.rows();
+  Eigen::Matrix<T_return, Eigen::Dynamic, Eigen::Dynamic> M
+      = Eigen::Matrix<T_return, Eigen::Dynamic, Eigen::Dynamic>::Zero(N + 1,
+                                                                      N + 1);
+  M.topLeftCorner(N, N) = A.template cast<T_return>();
+  M.col(N).head(N) = b.template cast<T_return>();
+  return M;
+}
+
+/**
+ * Returns true if the step \p h between two output times is the same as
+ * the previous step \p h_prev up to the rounding of the output time \p t,
+ * in which case the propagator of the previous step can be reused.
+ */
+inline bool ode_linear_same_step(double h, double h_prev, double t) {
+  return std::abs(h - h_prev) <= 8 * EPSILON * std::max(std::abs(t), 1.0);
+}
+
+}  // namespace internal
+
+/**
+ * Solve the linear time-invariant ODE initial value problem
+ * y' = A y + b, y(t0) = y0 at a set of times { t1, t2, t3, ... }.
+ *
+ * The solution at each time is the previous solution propagated by the
+ * exponential of the augmented matrix of the system (see
+ * <code>internal::ode_linear_augmented</code>) scaled by the step between
+ * the times, so no adaptive integration is done and the result is exact
+ * up to the accuracy of <code>matrix_exp</code>. A propagator is only
+ * recomputed when the step changes, so uniformly spaced times need a
+ * single matrix exponential.
+ *
+ * @tparam T_A type of system matrix
+ * @tparam T_b type of input vector
+ * @tparam T_y0 type of initial state
+ * @tparam T_t0 type of initial time
+ * @tparam T_ts type of output times
+ * @param A N by N system matrix
+ * @param b input vector of size N
+ * @param y0 initial state of size N
+ * @param t0 initial time
+ * @param ts times at which to return the solution. All values must be
+ *   sorted and greater than t0.
+ * @return solution of the ODE at the times \p ts
+ * @throw std::invalid_argument if A is not square or the sizes of A, b
+ *   and y0 do not match
+ * @throw std::domain_error if any argument is not finite, the times are
+ *   not sorted or not greater than t0
+ */
+template <typename T_A, typename T_b, typename T_y0, typename T_t0,
+          typename T_ts, require_eigen_t<T_A>* = nullptr,
+          require_all_eigen_col_vector_t<T_b, T_y0>* = nullptr,
+          require_all_not_st_var<T_A, T_b, T_y0, T_t0, T_ts>* = nullptr>
+inline std::vector<Eigen::Matrix<return_type_t<T_A, T_b, T_y0, T_t0, T_ts>,
+                                 Eigen::Dynamic, 1>>
+ode_linear(const T_A& A, const T_b& b, const T_y0& y0, const T_t0& t0,
+           const std::vector<T_ts>& ts) {
+  using T_return = return_type_t<T_A, T_b, T_y0, T_t0, T_ts>;
+  using T_time = return_type_t<T_t0, T_ts>;
+  using matrix_t = Eigen::Matrix<T_return, Eigen::Dynamic, Eigen::Dynamic>;
+  static constexpr const char* function_name = "ode_linear";
+  const auto& A_ref = to_ref(A);
+  const auto& b_ref = to_ref(b);
+  const auto& y0_ref = to_ref(y0);
+  internal::ode_linear_check(function_name, A_ref, b_ref, y0_ref, t0, ts);
+
+  const int N = y0_ref.size();
+  const matrix_t M = internal::ode_linear_augmented(A_ref, b_ref)
+                         .template cast<T_return>();
+  Eigen::Matrix<T_return, Eigen::Dynamic, 1> z(N + 1);
+  z.head(N) = y0_ref.template cast<T_return>();
+  z.coeffRef(N) = 1.0;
+
+  std::vector<Eigen::Matrix<T_return, Eigen::Dynamic, 1>> y;
+  y.reserve(ts.size());
+  matrix_t E;
+  T_time t_prev = t0;
+  T_time h_prev = 0;
+  for (size_t n = 0; n < ts.size(); ++n) {
+    const T_time h = ts[n] - t_prev;
+    // the propagator is only reused if the steps carry no derivatives
+    if (n == 0 || !std::is_arithmetic<T_time>::value
+        || !internal::ode_linear_same_step(value_of_rec(h),
+                                           value_of_rec(h_prev),
+                                           value_of_rec(ts[n]))) {
+      E = matrix_exp((M * T_return(h)).eval());
+    }
+    z = (E * z).eval();
+    y.emplace_back(z.head(N));
+    t_prev = ts[n];
+    h_prev = h;
+  }
+  return y;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
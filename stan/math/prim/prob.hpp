@@ -17,6 +17,7 @@
 #include <stan/math/prim/prob/beta_binomial_cdf_log.hpp>
 #include <stan/math/prim/prob/beta_binomial_lccdf.hpp>
 #include <stan/math/prim/prob/beta_binomial_lcdf.hpp>
+#include <stan/math/prim/prob/beta_binomial_log_tails.hpp>
 #include <stan/math/prim/prob/beta_binomial_lpmf.hpp>
 #include <stan/math/prim/prob/beta_binomial_rng.hpp>
 #include <stan/math/prim/prob/beta_ccdf_log.hpp>
@@ -123,6 +124,7 @@
 #include <stan/math/prim/prob/hmm_hidden_state_prob.hpp>
 #include <stan/math/prim/prob/hmm_latent_rng.hpp>
 #include <stan/math/prim/prob/hmm_marginal.hpp>
+#include <stan/math/prim/prob/hmm_scan.hpp>
 #include <stan/math/prim/prob/hypergeometric_lpmf.hpp>
 #include <stan/math/prim/prob/hypergeometric_rng.hpp>
 #include <stan/math/prim/prob/inv_chi_square_ccdf_log.hpp>
@@ -175,6 +177,7 @@
 #include <stan/math/prim/prob/multi_normal_prec_lpdf.hpp>
 #include <stan/math/prim/prob/multi_normal_prec_rng.hpp>
 #include <stan/math/prim/prob/multi_normal_rng.hpp>
+#include <stan/math/prim/prob/multi_normal_toeplitz_lpdf.hpp>
 #include <stan/math/prim/prob/multi_student_t_cholesky_lpdf.hpp>
 #include <stan/math/prim/prob/multi_student_t_cholesky_rng.hpp>
 #include <stan/math/prim/prob/multi_student_t_lpdf.hpp>
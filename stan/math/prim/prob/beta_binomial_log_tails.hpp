@@ -0,0 +1,210 @@
+#ifndef STAN_MATH_PRIM_PROB_BETA_BINOMIAL_LOG_TAILS_HPP
+#define STAN_MATH_PRIM_PROB_BETA_BINOMIAL_LOG_TAILS_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/digamma.hpp>
+#include <stan/math/prim/fun/exp.hpp>
+#include <stan/math/prim/fun/lbeta.hpp>
+#include <stan/math/prim/fun/log.hpp>
+#include <stan/math/prim/fun/log1m_exp.hpp>
+#include <stan/math/prim/fun/max_size.hpp>
+#include <stan/math/prim/fun/scalar_seq_view.hpp>
+#include <stan/math/prim/fun/size.hpp>
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Log CDF (or CCDF) of one beta-binomial observation together with its
+ * derivatives with respect to the prior success and failure parameters.
+ *
+ * @tparam T partials type
+ */
+template <typename T>
+struct beta_binomial_log_tail {
+  T val = 0;
+  T d_alpha = 0;
+  T d_beta = 0;
+};
+
+/**
+ * Returns the log CDFs (or log CCDFs) of the beta-binomial distribution
+ * and their derivatives with respect to `alpha` and `beta` for every
+ * element of the broadcast arguments.
+ *
+ * Instead of a generalized hypergeometric function per element, the
+ * probability mass function is summed with the recurrence
+ * \f[
+ *   \frac{p_{k+1}}{p_k} = \frac{(N - k)(k + \alpha)}{(k + 1)(N - k - 1
+ *   + \beta)},
+ * \f]
+ * and the derivatives of \f$\log p_k\f$, which are differences of digamma
+ * functions, are updated along the way with the recurrence of the digamma
+ * function. Elements that share `N`, `alpha` and `beta` are grouped and
+ * sorted by `n`, so one sweep per group yields all of their values. Each
+ * sweep sums whichever tail lies away from the mean, starting from
+ * \f$k = 0\f$ or \f$k = N\f$, and the other tail is obtained with
+ * `log1m_exp`, so no cancellation occurs in the summed tail.
+ *
+ * Elements with `n < 0` or `n >= N` are left at zero and must be handled
+ * by the caller.
+ *
+ * @tparam Lower true to compute the log CDF, false for the log CCDF
+ * @tparam T_n type of number of successes
+ * @tparam T_N type of population size
+ * @tparam T_alpha type of prior success parameter
+ * @tparam T_beta type of prior failure parameter
+ * @param n number of successes
+ * @param N population size
+ * @param alpha prior success parameter
+ * @param beta prior failure parameter
+ * @return log tail probabilities and their derivatives
+ */
+template <bool Lower, typename T_n, typename T_N, typename T_alpha,
+          typename T_beta>
+inline auto beta_binomial_log_tails(const T_n& n, const T_N& N,
+                                    const T_alpha& alpha, const T_beta& beta) {
+  using T_partials_return = partials_return_t<T_n, T_N, T_alpha, T_beta>;
+  using tail_t = beta_binomial_log_tail<T_partials_return>;
+  // rescale the running terms before they can overflow
+  static constexpr double rescale_threshold = 1e100;
+  const double log_rescale_threshold = std::log(rescale_threshold);
+
+  scalar_seq_view<T_n> n_vec(n);
+  scalar_seq_view<T_N> N_vec(N);
+  scalar_seq_view<T_alpha> alpha_vec(alpha);
+  scalar_seq_view<T_beta> beta_vec(beta);
+  const size_t size_alpha = stan::math::size(alpha);
+  const size_t size_beta = stan::math::size(beta);
+  const size_t max_size_seq_view = max_size(n, N, alpha, beta);
+  std::vector<tail_t> tails(max_size_seq_view);
+
+  std::map<std::tuple<int, size_t, size_t>, std::vector<size_t>> groups;
+  for (size_t i = 0; i < max_size_seq_view; ++i) {
+    if (n_vec.val(i) < 0 || n_vec.val(i) >= N_vec.val(i)) {
+      continue;
+    }
+    groups[std::make_tuple(N_vec.val(i), size_alpha == 1 ? 0 : i,
+                           size_beta == 1 ? 0 : i)]
+        .push_back(i);
+  }
+
+  // converts the log of the summed tail to the requested tail
+  auto record = [&](size_t i, bool summed_lower, const T_partials_return& L,
+                    const T_partials_return& d_alpha,
+                    const T_partials_return& d_beta) {
+    if (summed_lower == Lower) {
+      tails[i] = {L, d_alpha, d_beta};
+    } else {
+      const T_partials_return val = log1m_exp(L);
+      const T_partials_return scale = -exp(L - val);
+      tails[i] = {val, scale * d_alpha, scale * d_beta};
+    }
+  };
+
+  for (const auto& group : groups) {
+    const int N_dbl = std::get<0>(group.first);
+    const size_t first = group.second[0];
+    const T_partials_return alpha_dbl = alpha_vec.val(first);
+    const T_partials_return beta_dbl = beta_vec.val(first);
+    const T_partials_return mean = N_dbl * alpha_dbl / (alpha_dbl + beta_dbl);
+    const T_partials_return lbeta_ab = lbeta(alpha_dbl, beta_dbl);
+    const T_partials_return digamma_diff
+        = digamma(alpha_dbl + beta_dbl) - digamma(N_dbl + alpha_dbl + beta_dbl);
+
+    std::vector<size_t> lower;
+    std::vector<size_t> upper;
+    for (size_t i : group.second) {
+      (n_vec.val(i) < mean ? lower : upper).push_back(i);
+    }
+    std::sort(lower.begin(), lower.end(), [&](size_t a, size_t b) {
+      return n_vec.val(a) < n_vec.val(b);
+    });
+    std::sort(upper.begin(), upper.end(), [&](size_t a, size_t b) {
+      return n_vec.val(a) > n_vec.val(b);
+    });
+
+    // sum p_0 + ... + p_n upwards from k = 0, with p_k = term * exp(offset)
+    if (!lower.empty()) {
+      T_partials_return log_offset = lbeta(alpha_dbl, N_dbl + beta_dbl)
+                                     - lbeta_ab;
+      T_partials_return term = 1;
+      T_partials_return sum = 0;
+      T_partials_return sum_d_alpha = 0;
+      T_partials_return sum_d_beta = 0;
+      // digamma(k + alpha) - digamma(alpha), digamma(N - k + beta)
+      // - digamma(beta)
+      T_partials_return psi_alpha = 0;
+      T_partials_return psi_beta
+          = digamma(N_dbl + beta_dbl) - digamma(beta_dbl);
+      size_t j = 0;
+      for (int k = 0; j < lower.size(); ++k) {
+        sum += term;
+        sum_d_alpha += term * psi_alpha;
+        sum_d_beta += term * psi_beta;
+        for (; j < lower.size() && n_vec.val(lower[j]) == k; ++j) {
+          record(lower[j], true, log(sum) + log_offset,
+                 sum_d_alpha / sum + digamma_diff,
+                 sum_d_beta / sum + digamma_diff);
+        }
+        term *= (N_dbl - k) * (k + alpha_dbl)
+                / ((k + 1) * (N_dbl - k - 1 + beta_dbl));
+        psi_alpha += 1 / (k + alpha_dbl);
+        psi_beta -= 1 / (N_dbl - k - 1 + beta_dbl);
+        if (term > rescale_threshold) {
+          term /= rescale_threshold;
+          sum /= rescale_threshold;
+          sum_d_alpha /= rescale_threshold;
+          sum_d_beta /= rescale_threshold;
+          log_offset += log_rescale_threshold;
+        }
+      }
+    }
+
+    // sum p_{n + 1} + ... + p_N downwards from k = N
+    if (!upper.empty()) {
+      T_partials_return log_offset = lbeta(N_dbl + alpha_dbl, beta_dbl)
+                                     - lbeta_ab;
+      T_partials_return term = 1;
+      T_partials_return sum = 0;
+      T_partials_return sum_d_alpha = 0;
+      T_partials_return sum_d_beta = 0;
+      T_partials_return psi_alpha
+          = digamma(N_dbl + alpha_dbl) - digamma(alpha_dbl);
+      T_partials_return psi_beta = 0;
+      size_t j = 0;
+      for (int k = N_dbl; j < upper.size(); --k) {
+        sum += term;
+        sum_d_alpha += term * psi_alpha;
+        sum_d_beta += term * psi_beta;
+        for (; j < upper.size() && n_vec.val(upper[j]) == k - 1; ++j) {
+          record(upper[j], false, log(sum) + log_offset,
+                 sum_d_alpha / sum + digamma_diff,
+                 sum_d_beta / sum + digamma_diff);
+        }
+        term *= k * (N_dbl - k + beta_dbl)
+                / ((N_dbl - k + 1) * (k - 1 + alpha_dbl));
+        psi_alpha -= 1 / (k - 1 + alpha_dbl);
+        psi_beta += 1 / (N_dbl - k + beta_dbl);
+        if (term > rescale_threshold) {
+          term /= rescale_threshold;
+          sum /= rescale_threshold;
+          sum_d_alpha /= rescale_threshold;
+          sum_d_beta /= rescale_threshold;
+          log_offset += log_rescale_threshold;
+        }
+      }
+    }
+  }
+  return tails;
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+#endif
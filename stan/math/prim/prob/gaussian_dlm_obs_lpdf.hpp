@@ -5,20 +5,24 @@
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/add.hpp>
 #include <stan/math/prim/fun/dot_product.hpp>
-#include <stan/math/prim/fun/inverse_spd.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/log.hpp>
-#include <stan/math/prim/fun/log_determinant_spd.hpp>
 #include <stan/math/prim/fun/multiply.hpp>
 #include <stan/math/prim/fun/quad_form.hpp>
 #include <stan/math/prim/fun/quad_form_sym.hpp>
 #include <stan/math/prim/fun/square.hpp>
 #include <stan/math/prim/fun/subtract.hpp>
+#include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/tcrossprod.hpp>
 #include <stan/math/prim/fun/to_ref.hpp>
 #include <stan/math/prim/fun/trace_quad_form.hpp>
 #include <stan/math/prim/fun/transpose.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/fun/value_of_rec.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/functor/partials_propagator.hpp>
 #include <cmath>
+#include <vector>
 
 /*
   TODO: time-varying system matrices
@@ -40,6 +44,14 @@ namespace math {
  * If V is a vector, then the Kalman filter is applied
  * sequentially.
  *
+ * The Kalman filter factors the one-step-ahead forecast covariance
+ * \f$Q_t\f$ with a Cholesky decomposition rather than inverting it.
+ * Once the filtered state covariance has converged to its steady state
+ * (relative change below 1e-12), the remaining
+ * time steps reuse the converged gain and only propagate the state mean.
+ * Gradients are computed with an analytic reverse pass through the
+ * filter recursions instead of taping every scalar operation.
+ *
  * @tparam T_y type of scalar
  * @tparam T_F type of design matrix
  * @tparam T_G type of transition matrix
@@ -70,9 +82,16 @@ template <bool propto, typename T_y, typename T_F, typename T_G, typename T_V,
 inline return_type_t<T_y, T_F, T_G, T_V, T_W, T_m0, T_C0> gaussian_dlm_obs_lpdf(
     const T_y& y, const T_F& F, const T_G& G, const T_V& V, const T_W& W,
     const T_m0& m0, const T_C0& C0) {
-  using T_lp = return_type_t<T_y, T_F, T_G, T_V, T_W, T_m0, T_C0>;
-  using std::pow;
+  using T_partials_return = partials_return_t<T_y, T_F, T_G, T_V, T_W, T_m0,
+                                              T_C0>;
+  using matrix_partials_t
+      = Eigen::Matrix<T_partials_return, Eigen::Dynamic, Eigen::Dynamic>;
+  using vector_partials_t = Eigen::Matrix<T_partials_return, Eigen::Dynamic, 1>;
+  using llt_partials_t = Eigen::LLT<matrix_partials_t>;
   static constexpr const char* function = "gaussian_dlm_obs_lpdf";
+  // relative change in the filtered covariance below which the filter is
+  // treated as having reached its steady state
+  static constexpr double steady_state_tol = 1e-12;
   check_size_match(function, "columns of F", F.cols(), "rows of y", y.rows());
   check_size_match(function, "rows of F", F.rows(), "rows of G", G.rows());
   check_size_match(function, "rows of V", V.rows(), "rows of y", y.rows());
@@ -106,50 +125,161 @@ inline return_type_t<T_y, T_F, T_G, T_V, T_W, T_m0, T_C0> gaussian_dlm_obs_lpdf(
     return 0;
   }
 
-  int r = y.rows();  // number of variables
-  int n = G.rows();  // number of states
+  const int r = y.rows();  // number of variables
+  const int n = G.rows();  // number of states
+  const int T = y.cols();  // number of time points
 
-  T_lp lp(0);
+  auto ops_partials
+      = make_partials_propagator(y_ref, F_ref, G_ref, V_ref, W_ref, m0_ref,
+                                 C0_ref);
+
+  T_partials_return lp(0);
   if (include_summand<propto>::value) {
-    lp -= HALF_LOG_TWO_PI * r * y.cols();
+    lp -= HALF_LOG_TWO_PI * r * T;
   }
 
   if (include_summand<propto, T_y, T_F, T_G, T_V, T_W, T_m0, T_C0>::value) {
-    Eigen::Matrix<T_lp, Eigen::Dynamic, 1> m{m0_ref};
-    Eigen::Matrix<T_lp, Eigen::Dynamic, Eigen::Dynamic> C{C0_ref};
-    Eigen::Matrix<T_lp, Eigen::Dynamic, 1> a(n);
-    Eigen::Matrix<T_lp, Eigen::Dynamic, Eigen::Dynamic> R(n, n);
-    Eigen::Matrix<T_lp, Eigen::Dynamic, 1> f(r);
-    Eigen::Matrix<T_lp, Eigen::Dynamic, Eigen::Dynamic> Q(r, r);
-    Eigen::Matrix<T_lp, Eigen::Dynamic, Eigen::Dynamic> Q_inv(r, r);
-    Eigen::Matrix<T_lp, Eigen::Dynamic, 1> e(r);
-    Eigen::Matrix<T_lp, Eigen::Dynamic, Eigen::Dynamic> A(n, r);
+    const matrix_partials_t y_val = value_of(y_ref);
+    const matrix_partials_t F_val = value_of(F_ref);
+    const matrix_partials_t G_val = value_of(G_ref);
+    const matrix_partials_t V_val = value_of(V_ref);
+    const matrix_partials_t W_val = value_of(W_ref);
 
-    for (int i = 0; i < y.cols(); i++) {
-      // // Predict state
-      // a_t = G_t m_{t-1}
-      a = multiply(G_ref, m);
-      // R_t = G_t C_{t-1} G_t' + W_t
-      R = quad_form_sym(C, transpose(G_ref)) + W_ref;
-      // // predict observation
-      // f_t = F_t' a_t
-      f = multiply(transpose(F_ref), a);
-      // Q_t = F'_t R_t F_t + V_t
-      Q = quad_form_sym(R, F_ref) + V_ref;
-      Q_inv = inverse_spd(Q);
-      // // filtered state
-      // e_t = y_t - f_t
-      e = y_ref.col(i) - f;
-      // A_t = R_t F_t Q^{-1}_t
-      A = multiply(multiply(R, F_ref), Q_inv);
-      // m_t = a_t + A_t e_t
-      m = a + multiply(A, e);
-      // C = R_t - A_t Q_t A_t'
-      C = R - quad_form_sym(Q, transpose(A));
-      lp -= 0.5 * (log_determinant_spd(Q) + trace_quad_form(Q_inv, e));
+    // filtered state means, m.col(0) = m0 and m.col(t + 1) = m_t
+    matrix_partials_t m(n, T + 1);
+    m.col(0) = value_of(m0_ref);
+    // standardized forecast errors u_t = Q_t^{-1} e_t
+    matrix_partials_t u(r, T);
+
+    // Covariance recursion for the steps before steady state. Entry t holds
+    // C_{t-1}, R_t = G C_{t-1} G' + W, P_t = R_t F and the factor of
+    // Q_t = F' R_t F + V.
+    std::vector<matrix_partials_t> C_hist;
+    std::vector<matrix_partials_t> R_hist;
+    std::vector<matrix_partials_t> P_hist;
+    std::vector<llt_partials_t> Q_llt_hist;
+
+    matrix_partials_t C = value_of(C0_ref);
+    // time step after which the gain is held fixed
+    int t_steady = T;
+    for (int t = 0; t < T; ++t) {
+      if (t <= t_steady) {
+        matrix_partials_t R = G_val * C * G_val.transpose() + W_val;
+        R = 0.5 * (R + R.transpose()).eval();
+        matrix_partials_t P = R * F_val;
+        llt_partials_t Q_llt(F_val.transpose() * P + V_val);
+        check_pos_definite(function, "Q", Q_llt);
+        // C_t = R_t - P_t Q_t^{-1} P_t'
+        matrix_partials_t C_new = R - P * Q_llt.solve(P.transpose());
+        C_new = 0.5 * (C_new + C_new.transpose()).eval();
+        lp -= sum(log(Q_llt.matrixLLT().diagonal()));
+        if (t_steady == T
+            && (value_of_rec(C_new) - value_of_rec(C)).cwiseAbs().maxCoeff()
+                   <= steady_state_tol
+                          * value_of_rec(C_new).cwiseAbs().maxCoeff()) {
+          t_steady = t;
+        }
+        C_hist.emplace_back(std::move(C));
+        R_hist.emplace_back(std::move(R));
+        P_hist.emplace_back(std::move(P));
+        Q_llt_hist.emplace_back(std::move(Q_llt));
+        C = std::move(C_new);
+      } else {
+        lp -= sum(log(Q_llt_hist.back().matrixLLT().diagonal()));
+      }
+      const auto& P = P_hist.back();
+      const auto& Q_llt = Q_llt_hist.back();
+      const vector_partials_t a = G_val * m.col(t);
+      const vector_partials_t e = y_val.col(t) - F_val.transpose() * a;
+      u.col(t) = Q_llt.solve(e);
+      m.col(t + 1) = a + P * u.col(t);
+      lp -= 0.5 * dot_product(e, u.col(t));
+    }
+
+    if (!is_constant_all<T_y, T_F, T_G, T_V, T_W, T_m0, T_C0>::value) {
+      matrix_partials_t y_adj(r, T);
+      matrix_partials_t F_adj = matrix_partials_t::Zero(n, r);
+      matrix_partials_t G_adj = matrix_partials_t::Zero(n, n);
+      matrix_partials_t V_adj = matrix_partials_t::Zero(r, r);
+      matrix_partials_t W_adj = matrix_partials_t::Zero(n, n);
+      vector_partials_t m_adj = vector_partials_t::Zero(n);
+      matrix_partials_t C_adj = matrix_partials_t::Zero(n, n);
+      // adjoints of P and Q accumulated over the steady-state steps
+      matrix_partials_t P_adj_steady = matrix_partials_t::Zero(n, r);
+      matrix_partials_t Q_adj_steady = matrix_partials_t::Zero(r, r);
+
+      for (int t = T - 1; t >= 0; --t) {
+        const bool is_steady = t > t_steady;
+        const size_t k = is_steady ? t_steady : t;
+        const auto& P = P_hist[k];
+        const auto& Q_llt = Q_llt_hist[k];
+        const auto& u_t = u.col(t);
+        const auto& m_prev = m.col(t);
+        // m_t = a_t + P_t u_t and lp_t = -0.5 (log|Q_t| + e_t' u_t)
+        const vector_partials_t w = Q_llt.solve(P.transpose() * m_adj);
+        const vector_partials_t e_adj = w - u_t;
+        matrix_partials_t P_adj = m_adj * u_t.transpose();
+        matrix_partials_t Q_adj = 0.5 * u_t * u_t.transpose()
+                                  - 0.5 * (w * u_t.transpose()
+                                           + u_t * w.transpose());
+        y_adj.col(t) = e_adj;
+        // e_t = y_t - F' a_t
+        const vector_partials_t a_adj = m_adj - F_val * e_adj;
+        F_adj -= (G_val * m_prev) * e_adj.transpose();
+        G_adj += a_adj * m_prev.transpose();
+        m_adj = G_val.transpose() * a_adj;
+        if (is_steady) {
+          P_adj_steady += P_adj;
+          Q_adj_steady += Q_adj;
+          continue;
+        }
+        // log|Q_t| for this step and for every steady-state step after it
+        const int n_steps = (t == t_steady) ? T - t_steady : 1;
+        const matrix_partials_t Q_inv
+            = Q_llt.solve(matrix_partials_t::Identity(r, r));
+        const matrix_partials_t S = Q_llt.solve(P.transpose());
+        Q_adj += -0.5 * n_steps * Q_inv + S * C_adj * S.transpose();
+        P_adj -= 2.0 * C_adj * S.transpose();
+        if (t == t_steady) {
+          P_adj += P_adj_steady;
+          Q_adj += Q_adj_steady;
+        }
+        // Q_t = F' P_t + V and P_t = R_t F
+        V_adj += Q_adj;
+        F_adj += P * Q_adj;
+        P_adj += F_val * Q_adj;
+        F_adj += R_hist[t] * P_adj;
+        matrix_partials_t R_adj = C_adj + P_adj * F_val.transpose();
+        R_adj = 0.5 * (R_adj + R_adj.transpose()).eval();
+        // R_t = G C_{t-1} G' + W
+        W_adj += R_adj;
+        G_adj += 2.0 * R_adj * G_val * C_hist[t];
+        C_adj = G_val.transpose() * R_adj * G_val;
+      }
+      if (!is_constant_all<T_y>::value) {
+        partials<0>(ops_partials) = y_adj;
+      }
+      if (!is_constant_all<T_F>::value) {
+        partials<1>(ops_partials) = F_adj;
+      }
+      if (!is_constant_all<T_G>::value) {
+        partials<2>(ops_partials) = G_adj;
+      }
+      if (!is_constant_all<T_V>::value) {
+        partials<3>(ops_partials) = V_adj;
+      }
+      if (!is_constant_all<T_W>::value) {
+        partials<4>(ops_partials) = W_adj;
+      }
+      if (!is_constant_all<T_m0>::value) {
+        partials<5>(ops_partials) = m_adj;
+      }
+      if (!is_constant_all<T_C0>::value) {
+        partials<6>(ops_partials) = C_adj;
+      }
     }
   }
-  return lp;
+  return ops_partials.build(lp);
 }
 
 /** \ingroup multivar_dists
@@ -5,6 +5,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err/hmm_check.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/prob/hmm_scan.hpp>
 #include <boost/random.hpp>
 #include <vector>
 
@@ -29,6 +30,8 @@ namespace math {
  * of a state sequence given parameters and an observation sequence,
  * p(x | y, theta),
  * because it only computes marginals on a state-by-state basis.
+ * The forward and backward recursions run as a parallel scan for long
+ * sequences with few states (see `internal::hmm_scan`).
  *
  * @tparam T_omega type of the log likelihood matrix
  * @tparam T_Gamma type of the transition matrix
@@ -57,26 +60,34 @@ inline Eigen::MatrixXd hmm_hidden_state_prob(const T_omega& log_omegas,
   hmm_check(log_omegas, Gamma_dbl, rho_dbl, "hmm_hidden_state_prob");
 
   Eigen::MatrixXd alphas(n_states, n_transitions + 1);
+  Eigen::VectorXd alpha_log_norms(n_transitions + 1);
   alphas.col(0) = omegas.col(0).cwiseProduct(rho_dbl);
   alphas.col(0) /= alphas.col(0).maxCoeff();
+  alpha_log_norms(0) = 0;
 
-  for (int n = 0; n < n_transitions; ++n)
-    alphas.col(n + 1)
-        = omegas.col(n + 1).cwiseProduct(Gamma_dbl.transpose() * alphas.col(n));
+  const Eigen::MatrixXd Gamma_dbl_transpose = Gamma_dbl.transpose();
+  internal::hmm_scan(alphas, alpha_log_norms, false,
+                     [&](int n, const auto& alpha) {
+                       return (omegas.col(n).asDiagonal()
+                               * (Gamma_dbl_transpose * alpha))
+                           .eval();
+                     });
 
   // Backward pass with running normalization
-  Eigen::VectorXd beta = Eigen::VectorXd::Ones(n_states);
+  Eigen::MatrixXd betas(n_states, n_transitions + 1);
+  Eigen::VectorXd beta_log_norms(n_transitions + 1);
+  betas.col(n_transitions) = Eigen::VectorXd::Ones(n_states);
+  beta_log_norms(n_transitions) = 0;
+  internal::hmm_scan(betas, beta_log_norms, true,
+                     [&](int n, const auto& beta) {
+                       return (Gamma_dbl
+                               * (omegas.col(n + 1).asDiagonal() * beta))
+                           .eval();
+                     });
 
-  alphas.col(n_transitions) /= alphas.col(n_transitions).sum();
-
-  for (int n = n_transitions; n-- > 0;) {
-    beta = Gamma_dbl * omegas.col(n + 1).cwiseProduct(beta);
-    beta /= beta.maxCoeff();
-
-    // Reuse alphas to store probabilities
-    alphas.col(n) = alphas.col(n).cwiseProduct(beta);
-    alphas.col(n) /= alphas.col(n).sum();
-  }
+  // Reuse alphas to store probabilities
+  alphas = alphas.cwiseProduct(betas);
+  alphas.array().rowwise() /= alphas.colwise().sum().array();
 
   return alphas;
 }
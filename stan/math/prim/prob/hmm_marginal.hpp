@@ -7,10 +7,15 @@
 #include <stan/math/prim/fun/col.hpp>
 #include <stan/math/prim/fun/transpose.hpp>
 #include <stan/math/prim/fun/exp.hpp>
+#include <stan/math/prim/fun/log.hpp>
+#include <stan/math/prim/fun/sum.hpp>
 #include <stan/math/prim/fun/to_ref.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/core.hpp>
 #include <stan/math/prim/functor/partials_propagator.hpp>
+#include <stan/math/prim/prob/hmm_scan.hpp>
+#include <algorithm>
+#include <numeric>
 #include <vector>
 
 namespace stan {
@@ -31,13 +36,12 @@ inline auto hmm_marginal_val(
   alpha_log_norms(0) = log(norm);
 
   auto Gamma_val_transpose = Gamma_val.transpose().eval();
-  for (int n = 1; n <= n_transitions; ++n) {
-    alphas.col(n)
-        = omegas.col(n).cwiseProduct(Gamma_val_transpose * alphas.col(n - 1));
-    const auto col_norm = alphas.col(n).maxCoeff();
-    alphas.col(n) /= col_norm;
-    alpha_log_norms(n) = log(col_norm) + alpha_log_norms(n - 1);
-  }
+  internal::hmm_scan(alphas, alpha_log_norms, false,
+                     [&](int n, const auto& alpha) {
+                       return (omegas.col(n).asDiagonal()
+                               * (Gamma_val_transpose * alpha))
+                           .eval();
+                     });
   norm_norm = alpha_log_norms(n_transitions);
   return log(alphas.col(n_transitions).sum()) + norm_norm;
 }
@@ -50,6 +54,10 @@ inline auto hmm_marginal_val(
  * The marginal lpdf is obtained via a forward pass, and
  * the derivative is calculated with an adjoint method,
  * e.g (Betancourt, Margossian, & Leos-Barajas, 2020).
+ * For long sequences with few hidden states, the forward and backward
+ * recursions are evaluated as a parallel scan over products of the
+ * transition matrices (see `internal::hmm_scan`), and the adjoint
+ * reuses the states of both scans.
  * log_omegas is a matrix of observational densities, where
  * the (i, j)th entry corresponds to the density of the jth observation, y_j,
  * given x_j = i.
@@ -92,6 +100,9 @@ inline auto hmm_marginal(const T_omega& log_omegas, const T_Gamma& Gamma,
   const auto& Gamma_val = to_ref(value_of(Gamma_ref));
   const auto& rho_val = to_ref(value_of(rho_ref));
   hmm_check(log_omegas, Gamma_val, rho_val, "hmm_marginal");
+  // the scans multiply Gamma into matrices of the partials type
+  const eig_matrix_partial Gamma_partial
+      = Gamma_val.template cast<T_partial_type>();
 
   auto ops_partials
       = make_partials_propagator(log_omegas_ref, Gamma_ref, rho_ref);
@@ -102,38 +113,35 @@ inline auto hmm_marginal(const T_omega& log_omegas, const T_Gamma& Gamma,
   eig_matrix_partial omegas = value_of(log_omegas_ref).array().exp();
   T_partial_type norm_norm;
   auto log_marginal_density = hmm_marginal_val(
-      omegas, Gamma_val, rho_val, alphas, alpha_log_norms, norm_norm);
+      omegas, Gamma_partial, rho_val, alphas, alpha_log_norms, norm_norm);
 
   // Variables required for all three Jacobian-adjoint products.
   auto unnormed_marginal = alphas.col(n_transitions).sum();
 
-  std::vector<eig_vector_partial> kappa(n_transitions);
+  eig_matrix_partial kappa(n_states, n_transitions);
   eig_vector_partial kappa_log_norms(n_transitions);
-  std::vector<T_partial_type> grad_corr(n_transitions, 0);
+  eig_vector_partial grad_corr(n_transitions);
 
   if (n_transitions > 0) {
-    kappa[n_transitions - 1] = Eigen::VectorXd::Ones(n_states);
+    kappa.col(n_transitions - 1) = eig_vector_partial::Ones(n_states);
     kappa_log_norms(n_transitions - 1) = 0;
-    grad_corr[n_transitions - 1]
-        = exp(alpha_log_norms(n_transitions - 1) - norm_norm);
+    internal::hmm_scan(kappa, kappa_log_norms, true,
+                       [&](int n, const auto& kappa_next) {
+                         return (Gamma_partial
+                                 * (omegas.col(n + 2).asDiagonal()
+                                    * kappa_next))
+                             .eval();
+                       });
   }
-
-  for (int n = n_transitions - 1; n-- > 0;) {
-    kappa[n] = Gamma_val * (omegas.col(n + 2).cwiseProduct(kappa[n + 1]));
-
-    auto norm = kappa[n].maxCoeff();
-    kappa[n] /= norm;
-    kappa_log_norms[n] = log(norm) + kappa_log_norms[n + 1];
-    grad_corr[n] = exp(alpha_log_norms[n] + kappa_log_norms[n] - norm_norm);
+  for (int n = 0; n < n_transitions; ++n) {
+    grad_corr(n) = exp(alpha_log_norms(n) + kappa_log_norms(n) - norm_norm);
   }
 
-  if (!is_constant_all<T_Gamma>::value) {
-    for (int n = n_transitions - 1; n >= 0; --n) {
-      edge<1>(ops_partials).partials_
-          += grad_corr[n] * alphas.col(n)
-             * kappa[n].cwiseProduct(omegas.col(n + 1)).transpose()
-             / unnormed_marginal;
-    }
+  if (!is_constant_all<T_Gamma>::value && n_transitions > 0) {
+    edge<1>(ops_partials).partials_
+        += (alphas.leftCols(n_transitions) * grad_corr.asDiagonal())
+           * kappa.cwiseProduct(omegas.rightCols(n_transitions)).transpose()
+           / unnormed_marginal;
   }
 
   if (!is_constant_all<T_omega, T_rho>::value) {
@@ -151,18 +159,15 @@ inline auto hmm_marginal(const T_omega& log_omegas, const T_Gamma& Gamma,
       return ops_partials.build(log_marginal_density);
     } else {
       auto grad_corr_boundary = exp(kappa_log_norms(0) - norm_norm);
-      eig_vector_partial C = Gamma_val * omegas.col(1).cwiseProduct(kappa[0]);
+      eig_vector_partial C
+          = Gamma_val * omegas.col(1).cwiseProduct(kappa.col(0));
 
       if (!is_constant_all<T_omega>::value) {
-        eig_matrix_partial log_omega_jacad
-            = Eigen::MatrixXd::Zero(n_states, n_transitions + 1);
-
-        for (int n = n_transitions - 1; n >= 0; --n) {
-          log_omega_jacad.col(n + 1)
-              = grad_corr[n]
-                * kappa[n].cwiseProduct(Gamma_val.transpose() * alphas.col(n));
-        }
-
+        eig_matrix_partial log_omega_jacad(n_states, n_transitions + 1);
+        log_omega_jacad.rightCols(n_transitions)
+            = kappa.cwiseProduct(Gamma_partial.transpose()
+                                 * alphas.leftCols(n_transitions))
+              * grad_corr.asDiagonal();
         log_omega_jacad.col(0) = grad_corr_boundary * C.cwiseProduct(rho_val);
         edge<0>(ops_partials).partials_
             = log_omega_jacad.cwiseProduct(omegas / unnormed_marginal);
@@ -179,6 +184,205 @@ inline auto hmm_marginal(const T_omega& log_omegas, const T_Gamma& Gamma,
   return ops_partials.build(log_marginal_density);
 }
 
+/**
+ * Return the sum of the log marginal densities of a collection of
+ * independent hidden Markov model sequences that share the transition
+ * matrix Gamma and the initial state distribution rho.
+ *
+ * This is equivalent to summing `hmm_marginal(log_omegas[i], Gamma, rho)`
+ * over the sequences, but the sequences, which may have different
+ * lengths, are processed together. They are sorted by length, so that at
+ * every time step the sequences still running form a contiguous block of
+ * columns, and the forward and backward recursions and the Gamma
+ * Jacobian-adjoint product become matrix-matrix products over that
+ * block. The adjoints of Gamma and rho are accumulated once for all
+ * sequences.
+ *
+ * @tparam T_omega type of the log likelihood matrices
+ * @tparam T_Gamma type of the transition matrix
+ * @tparam T_rho type of the initial guess vector
+ * @param[in] log_omegas log matrices of observational densities, one
+ * per sequence, each with one row per hidden state.
+ * @param[in] Gamma transition density between hidden states.
+ * @param[in] rho initial state
+ * @return sum of the log marginal densities.
+ * @throw `std::invalid_argument` if Gamma is not square, or if the size
+ *         of rho is not the number of rows of each log_omegas.
+ * @throw `std::domain_error` if rho is not a simplex and of the rows
+ *         of Gamma are not a simplex.
+ */
+template <typename T_omega, typename T_Gamma, typename T_rho,
+          require_std_vector_vt<is_eigen, T_omega>* = nullptr,
+          require_eigen_t<T_Gamma>* = nullptr,
+          require_eigen_col_vector_t<T_rho>* = nullptr>
+inline auto hmm_marginal(const T_omega& log_omegas, const T_Gamma& Gamma,
+                         const T_rho& rho) {
+  using T_partial_type = partials_return_t<T_omega, T_Gamma, T_rho>;
+  using eig_matrix_partial
+      = Eigen::Matrix<T_partial_type, Eigen::Dynamic, Eigen::Dynamic>;
+  using eig_vector_partial = Eigen::Matrix<T_partial_type, Eigen::Dynamic, 1>;
+  using T_Gamma_ref = ref_type_if_not_constant_t<T_Gamma>;
+  using T_rho_ref = ref_type_if_not_constant_t<T_rho>;
+  static constexpr const char* function = "hmm_marginal";
+
+  T_Gamma_ref Gamma_ref = Gamma;
+  T_rho_ref rho_ref = rho;
+  const auto& Gamma_val = to_ref(value_of(Gamma_ref));
+  const auto& rho_val = to_ref(value_of(rho_ref));
+  for (size_t i = 0; i < log_omegas.size(); ++i) {
+    hmm_check(log_omegas[i], Gamma_val, rho_val, function);
+  }
+
+  auto ops_partials = make_partials_propagator(log_omegas, Gamma_ref, rho_ref);
+  const int n_seqs = log_omegas.size();
+  if (n_seqs == 0) {
+    return ops_partials.build(T_partial_type(0));
+  }
+  const int n_states = rho.size();
+  const eig_matrix_partial Gamma_partial
+      = Gamma_val.template cast<T_partial_type>();
+  const eig_vector_partial rho_partial
+      = rho_val.template cast<T_partial_type>();
+
+  // Process the sequences from longest to shortest so that the sequences
+  // with at least n + 1 observations are the first n_active[n] columns.
+  std::vector<int> order(n_seqs);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    return log_omegas[a].cols() > log_omegas[b].cols();
+  });
+  const int max_transitions = log_omegas[order[0]].cols() - 1;
+  std::vector<int> n_active(max_transitions + 2, 0);
+  for (int j = 0; j < n_seqs; ++j) {
+    for (int n = 0; n < log_omegas[order[j]].cols(); ++n) {
+      ++n_active[n];
+    }
+  }
+
+  // omegas, normalized alphas and their cumulative log norms, by time step
+  std::vector<eig_matrix_partial> omegas(max_transitions + 1);
+  std::vector<eig_matrix_partial> alphas(max_transitions + 1);
+  std::vector<eig_vector_partial> alpha_log_norms(max_transitions + 1);
+  for (int n = 0; n <= max_transitions; ++n) {
+    omegas[n].resize(n_states, n_active[n]);
+    for (int j = 0; j < n_active[n]; ++j) {
+      omegas[n].col(j) = value_of(log_omegas[order[j]].col(n)).array().exp();
+    }
+  }
+
+  alphas[0] = omegas[0].array().colwise() * rho_partial.array();
+  eig_vector_partial norms = alphas[0].colwise().maxCoeff().transpose();
+  alphas[0] *= norms.cwiseInverse().asDiagonal();
+  alpha_log_norms[0] = log(norms);
+  for (int n = 1; n <= max_transitions; ++n) {
+    alphas[n] = omegas[n].cwiseProduct(
+        Gamma_partial.transpose() * alphas[n - 1].leftCols(n_active[n]));
+    norms = alphas[n].colwise().maxCoeff().transpose();
+    alphas[n] *= norms.cwiseInverse().asDiagonal();
+    alpha_log_norms[n]
+        = log(norms) + alpha_log_norms[n - 1].head(n_active[n]);
+  }
+
+  // log norms and unnormalized densities at the end of each sequence
+  eig_vector_partial norm_norms(n_seqs);
+  eig_vector_partial unnormed_marginals(n_seqs);
+  for (int j = 0; j < n_seqs; ++j) {
+    const int last = log_omegas[order[j]].cols() - 1;
+    norm_norms(j) = alpha_log_norms[last](j);
+    unnormed_marginals(j) = alphas[last].col(j).sum();
+  }
+  T_partial_type log_marginal_density
+      = sum(log(unnormed_marginals)) + sum(norm_norms);
+
+  if (is_constant_all<T_omega, T_Gamma, T_rho>::value) {
+    return ops_partials.build(log_marginal_density);
+  }
+
+  // Backward pass. kappas[n] holds the sequences with more than n
+  // transitions; the ones whose last transition is n start at ones.
+  std::vector<eig_matrix_partial> kappas(max_transitions);
+  std::vector<eig_vector_partial> kappa_log_norms(max_transitions);
+  for (int n = max_transitions - 1; n >= 0; --n) {
+    const int n_continuing = n_active[n + 2];
+    kappas[n].resize(n_states, n_active[n + 1]);
+    kappa_log_norms[n] = eig_vector_partial::Zero(n_active[n + 1]);
+    if (n_continuing > 0) {
+      kappas[n].leftCols(n_continuing)
+          = Gamma_partial * omegas[n + 2].cwiseProduct(kappas[n + 1]);
+      norms = kappas[n].leftCols(n_continuing).colwise().maxCoeff().transpose();
+      kappas[n].leftCols(n_continuing) *= norms.cwiseInverse().asDiagonal();
+      kappa_log_norms[n].head(n_continuing)
+          = log(norms) + kappa_log_norms[n + 1];
+    }
+    kappas[n].rightCols(n_active[n + 1] - n_continuing).setOnes();
+  }
+
+  // grad_corr / unnormed_marginal for every sequence still running
+  auto adjoint_weights = [&](const eig_vector_partial& log_norms) {
+    const int n_cols = log_norms.size();
+    return exp(log_norms - norm_norms.head(n_cols))
+        .cwiseQuotient(unnormed_marginals.head(n_cols))
+        .eval();
+  };
+
+  if (!is_constant_all<T_Gamma>::value) {
+    eig_matrix_partial Gamma_adj = eig_matrix_partial::Zero(n_states, n_states);
+    for (int n = 0; n < max_transitions; ++n) {
+      const int n_cols = n_active[n + 1];
+      const eig_vector_partial weights = adjoint_weights(
+          alpha_log_norms[n].head(n_cols) + kappa_log_norms[n]);
+      Gamma_adj += (alphas[n].leftCols(n_cols) * weights.asDiagonal())
+                   * kappas[n].cwiseProduct(omegas[n + 1]).transpose();
+    }
+    partials<1>(ops_partials) = Gamma_adj;
+  }
+
+  if (!is_constant_all<T_omega, T_rho>::value) {
+    // Boundary terms: C = Gamma (omega_1 .* kappa_0) for sequences with at
+    // least one transition, and ones for single observations.
+    eig_matrix_partial C = eig_matrix_partial::Ones(n_states, n_active[0]);
+    eig_vector_partial boundary_log_norms
+        = eig_vector_partial::Zero(n_active[0]);
+    if (max_transitions > 0) {
+      C.leftCols(n_active[1])
+          = Gamma_partial * omegas[1].cwiseProduct(kappas[0]);
+      boundary_log_norms.head(n_active[1]) = kappa_log_norms[0];
+    }
+    const eig_matrix_partial boundary_adj
+        = C * adjoint_weights(boundary_log_norms).asDiagonal();
+
+    if (!is_constant_all<T_rho>::value) {
+      partials<2>(ops_partials)
+          = boundary_adj.cwiseProduct(omegas[0]).rowwise().sum();
+    }
+
+    if constexpr (!is_constant_all<T_omega>::value) {
+      for (int j = 0; j < n_seqs; ++j) {
+        partials_vec<0>(ops_partials)[order[j]].col(0)
+            = boundary_adj.col(j).cwiseProduct(rho_partial).cwiseProduct(
+                omegas[0].col(j));
+      }
+      for (int n = 0; n < max_transitions; ++n) {
+        const int n_cols = n_active[n + 1];
+        const eig_vector_partial weights = adjoint_weights(
+            alpha_log_norms[n].head(n_cols) + kappa_log_norms[n]);
+        const eig_matrix_partial log_omega_adj
+            = kappas[n]
+                  .cwiseProduct(Gamma_partial.transpose()
+                                * alphas[n].leftCols(n_cols))
+                  .cwiseProduct(omegas[n + 1])
+              * weights.asDiagonal();
+        for (int j = 0; j < n_cols; ++j) {
+          partials_vec<0>(ops_partials)[order[j]].col(n + 1)
+              = log_omega_adj.col(j);
+        }
+      }
+    }
+  }
+
+  return ops_partials.build(log_marginal_density);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,183 @@
+#ifndef STAN_MATH_PRIM_PROB_HMM_SCAN_HPP
+#define STAN_MATH_PRIM_PROB_HMM_SCAN_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/log.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Minimum number of recursion steps before the hidden Markov model
+ * forward and backward recursions are evaluated with a parallel scan.
+ */
+constexpr int hmm_scan_min_parallel_steps = 1024;
+
+/**
+ * Runs the scaled linear recursion \f$x_i = M_i x_{i-1}\f$ of the
+ * forward (or backward) algorithm serially. Each \f$x_i\f$ is divided by
+ * its largest coefficient and the log of the normalizing constants is
+ * accumulated in `log_norms`.
+ *
+ * Recursion step `i` is stored in column `i` of `xs`, or in column
+ * `xs.cols() - 1 - i` if `reverse` is true. The first column visited
+ * must be filled in, together with its log norm, before the call.
+ *
+ * @tparam T scalar type
+ * @tparam Step type of the functor applying the step matrices
+ * @param[in, out] xs matrix of normalized recursion states
+ * @param[in, out] log_norms cumulative log normalizing constants
+ * @param reverse whether the recursion runs from the last column
+ * @param step functor such that `step(j, X)` returns \f$M X\f$, where
+ * \f$M\f$ is the step matrix producing column `j`
+ */
+template <typename T, typename Step>
+inline void hmm_scan_serial(
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>& xs,
+    Eigen::Matrix<T, Eigen::Dynamic, 1>& log_norms, bool reverse,
+    const Step& step) {
+  const int last = xs.cols() - 1;
+  for (int i = 1; i <= last; ++i) {
+    const int col = reverse ? last - i : i;
+    const int prev = reverse ? col + 1 : col - 1;
+    xs.col(col) = step(col, xs.col(prev));
+    const T norm = xs.col(col).maxCoeff();
+    xs.col(col) /= norm;
+    log_norms(col) = log(norm) + log_norms(prev);
+  }
+}
+
+/**
+ * Runs the same scaled recursion as `hmm_scan_serial` as a blocked
+ * parallel prefix scan over the associative product of step matrices.
+ *
+ * The steps are split into blocks. First, the product of the step
+ * matrices of every block but the last is formed concurrently (with the
+ * same max-normalization and log scale tracking as the vectors). Then
+ * the recursion state at each block boundary is propagated serially
+ * through those products. Finally, every block reruns the vector
+ * recursion from its boundary state concurrently to fill in `xs`.
+ * Forming the block products costs \f$O(K^3)\f$ per step for \f$K\f$
+ * states, so this pays off for long sequences with few states.
+ *
+ * @tparam T scalar type
+ * @tparam Step type of the functor applying the step matrices
+ * @param[in, out] xs matrix of normalized recursion states
+ * @param[in, out] log_norms cumulative log normalizing constants
+ * @param reverse whether the recursion runs from the last column
+ * @param step functor such that `step(j, X)` returns \f$M X\f$, where
+ * \f$M\f$ is the step matrix producing column `j`
+ * @param block_size number of recursion steps per block
+ */
+template <typename T, typename Step>
+inline void hmm_scan_parallel(
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>& xs,
+    Eigen::Matrix<T, Eigen::Dynamic, 1>& log_norms, bool reverse,
+    const Step& step, int block_size) {
+  using matrix_t = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+  using vector_t = Eigen::Matrix<T, Eigen::Dynamic, 1>;
+  const int n_states = xs.rows();
+  const int last = xs.cols() - 1;
+  if (last <= 0) {
+    return;
+  }
+  block_size = std::max(block_size, 1);
+  const int n_blocks = (last + block_size - 1) / block_size;
+  auto col_of = [&](int i) { return reverse ? last - i : i; };
+  auto block_begin = [&](int b) { return 1 + b * block_size; };
+  auto block_end
+      = [&](int b) { return std::min(last + 1, block_begin(b + 1)); };
+
+  // Phase 1: scaled products of the step matrices of each block.
+  std::vector<matrix_t> block_prods(n_blocks - 1);
+  std::vector<T> block_log_scales(n_blocks - 1);
+  tbb::parallel_for(tbb::blocked_range<int>(0, n_blocks - 1),
+                    [&](const tbb::blocked_range<int>& r) {
+                      for (int b = r.begin(); b < r.end(); ++b) {
+                        matrix_t prod = matrix_t::Identity(n_states, n_states);
+                        T log_scale(0);
+                        for (int i = block_begin(b); i < block_end(b); ++i) {
+                          prod = step(col_of(i), prod);
+                          const T norm = prod.maxCoeff();
+                          prod /= norm;
+                          log_scale += log(norm);
+                        }
+                        block_prods[b] = std::move(prod);
+                        block_log_scales[b] = log_scale;
+                      }
+                    });
+
+  // Phase 2: recursion states at the start of each block.
+  std::vector<vector_t> block_starts(n_blocks);
+  std::vector<T> block_start_log_norms(n_blocks);
+  block_starts[0] = xs.col(col_of(0));
+  block_start_log_norms[0] = log_norms(col_of(0));
+  for (int b = 1; b < n_blocks; ++b) {
+    block_starts[b] = block_prods[b - 1] * block_starts[b - 1];
+    const T norm = block_starts[b].maxCoeff();
+    block_starts[b] /= norm;
+    block_start_log_norms[b]
+        = block_start_log_norms[b - 1] + block_log_scales[b - 1] + log(norm);
+  }
+
+  // Phase 3: fill in each block from its starting state.
+  tbb::parallel_for(tbb::blocked_range<int>(0, n_blocks),
+                    [&](const tbb::blocked_range<int>& r) {
+                      for (int b = r.begin(); b < r.end(); ++b) {
+                        vector_t x = block_starts[b];
+                        T log_norm = block_start_log_norms[b];
+                        for (int i = block_begin(b); i < block_end(b); ++i) {
+                          const int col = col_of(i);
+                          x = step(col, x);
+                          const T norm = x.maxCoeff();
+                          x /= norm;
+                          log_norm += log(norm);
+                          xs.col(col) = x;
+                          log_norms(col) = log_norm;
+                        }
+                      }
+                    });
+}
+
+/**
+ * Runs the scaled forward (or backward) recursion of a hidden Markov
+ * model, using the parallel scan when the sequence is long enough and
+ * the available concurrency exceeds the number of states, so that the
+ * extra \f$O(K)\f$ work of the block products is repaid. Autodiff
+ * scalars always use the serial recursion.
+ *
+ * @tparam T scalar type
+ * @tparam Step type of the functor applying the step matrices
+ * @param[in, out] xs matrix of normalized recursion states
+ * @param[in, out] log_norms cumulative log normalizing constants
+ * @param reverse whether the recursion runs from the last column
+ * @param step functor such that `step(j, X)` returns \f$M X\f$, where
+ * \f$M\f$ is the step matrix producing column `j`
+ */
+template <typename T, typename Step>
+inline void hmm_scan(Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>& xs,
+                     Eigen::Matrix<T, Eigen::Dynamic, 1>& log_norms,
+                     bool reverse, const Step& step) {
+  const int n_steps = xs.cols() - 1;
+  const int n_threads = tbb::this_task_arena::max_concurrency();
+  if (std::is_arithmetic<T>::value && n_steps >= hmm_scan_min_parallel_steps
+      && n_threads > xs.rows() + 1) {
+    const int block_size = std::max(64, n_steps / (4 * n_threads));
+    hmm_scan_parallel(xs, log_norms, reverse, step, block_size);
+  } else {
+    hmm_scan_serial(xs, log_norms, reverse, step);
+  }
+}
+
+}  // namespace internal
+}  // namespace math
+}  // namespace stan
+#endif
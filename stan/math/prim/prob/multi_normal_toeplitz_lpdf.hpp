@@ -0,0 +1,291 @@
+#ifndef STAN_MATH_PRIM_PROB_MULTI_NORMAL_TOEPLITZ_LPDF_HPP
+#define STAN_MATH_PRIM_PROB_MULTI_NORMAL_TOEPLITZ_LPDF_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/as_value_column_vector_or_scalar.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/log.hpp>
+#include <stan/math/prim/fun/max_size_mvt.hpp>
+#include <stan/math/prim/fun/size_mvt.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/fun/vector_seq_view.hpp>
+#include <stan/math/prim/functor/partials_propagator.hpp>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * Computes the first column of the inverse and the log determinant of the
+ * symmetric Toeplitz matrix `T_ij = r_|i-j|` with the Durbin recursion in
+ * `O(N^2)` operations.
+ *
+ * @tparam T scalar type
+ * @param function name of the calling function
+ * @param r first column of the matrix
+ * @param[out] x first column of the inverse of the matrix
+ * @param[out] log_det log determinant of the matrix
+ * @throw std::domain_error if the matrix is not positive definite
+ */
+template <typename T>
+inline void toeplitz_durbin(const char* function,
+                            const Eigen::Matrix<T, Eigen::Dynamic, 1>& r,
+                            Eigen::Matrix<T, Eigen::Dynamic, 1>& x,
+                            T& log_det) {
+  const Eigen::Index N = r.size();
+  const Eigen::Index n = N - 1;
+  const Eigen::Matrix<T, Eigen::Dynamic, 1> rho = r.tail(n) / r.coeff(0);
+  // z solves the Yule-Walker equations of order k, e is the prediction
+  // error of order k
+  Eigen::Matrix<T, Eigen::Dynamic, 1> z(n);
+  T e(1);
+  log_det = N * log(r.coeff(0));
+  for (Eigen::Index k = 0; k < n; ++k) {
+    T kappa = -rho.coeff(k);
+    if (k > 0) {
+      kappa -= rho.head(k).reverse().dot(z.head(k));
+    }
+    kappa /= e;
+    z.head(k) += kappa * z.head(k).reverse().eval();
+    z.coeffRef(k) = kappa;
+    e *= 1 - kappa * kappa;
+    if (!(e > 0)) {
+      throw_domain_error(function, "Toeplitz covariance", "",
+                         "is not positive definite", "");
+    }
+    log_det += log(e);
+  }
+  x.resize(N);
+  x.coeffRef(0) = 1;
+  x.tail(n) = z;
+  x /= r.coeff(0) * e;
+}
+
+/**
+ * Returns `T^-1 B` for a symmetric positive definite Toeplitz matrix `T`
+ * given the first column `x` of its inverse, using the Gohberg-Semencul
+ * formula `T^-1 = (L(x) L(x)^T - L(w) L(w)^T) / x_0` with
+ * `w = (0, x_{N-1}, ..., x_1)`, where `L(v)` is the lower triangular
+ * Toeplitz matrix with first column `v`.
+ *
+ * @tparam T scalar type
+ * @param x first column of the inverse
+ * @param B right hand side
+ */
+template <typename T>
+inline Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>
+toeplitz_inverse_multiply(
+    const Eigen::Matrix<T, Eigen::Dynamic, 1>& x,
+    const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>& B) {
+  using matrix_t = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
+  const Eigen::Index N = x.size();
+  Eigen::Matrix<T, Eigen::Dynamic, 1> w(N);
+  w.coeffRef(0) = 0;
+  w.tail(N - 1) = x.tail(N - 1).reverse();
+  matrix_t U_x(N, B.cols());
+  matrix_t U_w(N, B.cols());
+  for (Eigen::Index i = 0; i < N; ++i) {
+    U_x.row(i) = x.head(N - i).transpose() * B.bottomRows(N - i);
+    U_w.row(i) = w.head(N - i).transpose() * B.bottomRows(N - i);
+  }
+  matrix_t res(N, B.cols());
+  for (Eigen::Index i = 0; i < N; ++i) {
+    res.row(i) = x.head(i + 1).reverse().transpose() * U_x.topRows(i + 1)
+                 - w.head(i + 1).reverse().transpose() * U_w.topRows(i + 1);
+  }
+  return res / x.coeff(0);
+}
+
+/**
+ * Returns the sums `s_k = sum_i (T^-1)_{i, i + k}` of the diagonals of the
+ * inverse of a symmetric positive definite Toeplitz matrix `T` given the
+ * first column `x` of the inverse.
+ *
+ * @tparam T scalar type
+ * @param x first column of the inverse
+ */
+template <typename T>
+inline Eigen::Matrix<T, Eigen::Dynamic, 1> toeplitz_inverse_diagonal_sums(
+    const Eigen::Matrix<T, Eigen::Dynamic, 1>& x) {
+  const Eigen::Index N = x.size();
+  Eigen::Matrix<T, Eigen::Dynamic, 1> w(N);
+  w.coeffRef(0) = 0;
+  w.tail(N - 1) = x.tail(N - 1).reverse();
+  Eigen::Matrix<T, Eigen::Dynamic, 1> s(N);
+  for (Eigen::Index k = 0; k < N; ++k) {
+    const Eigen::Index M = N - k;
+    const Eigen::VectorXd weights = Eigen::VectorXd::LinSpaced(M, M, 1);
+    s.coeffRef(k) = (x.segment(k, M).cwiseProduct(x.head(M))
+                     - w.segment(k, M).cwiseProduct(w.head(M)))
+                        .dot(weights.template cast<T>());
+  }
+  return s / x.coeff(0);
+}
+
+}  // namespace internal
+
+/** \ingroup multivar_dists
+ * The log of the multivariate normal density for the given y and mu and a
+ * stationary covariance on a regular grid, given by the symmetric Toeplitz
+ * matrix `Sigma_ij = r_|i-j|` with first column `r`, e.g. the
+ * autocovariance of a stationary Gaussian process at lags `0, ..., N - 1`.
+ *
+ * The log determinant, the quadratic form and the gradients are computed
+ * from the Durbin recursion and the Gohberg-Semencul form of the inverse
+ * in `O(N^2)` operations and `O(N)` memory per observation, instead of
+ * the `O(N^3)` operations of a Cholesky decomposition of the full
+ * covariance matrix.
+ *
+ * This version of the function is vectorized on y and mu.
+ *
+ * @tparam T_y Type of the random variable
+ * @tparam T_loc Type of the location
+ * @tparam T_covar Type of the first column of the covariance
+ * @param y A scalar vector or array of vectors
+ * @param mu The mean vector or array of vectors of the multivariate normal
+ * distribution.
+ * @param r The first column of the Toeplitz covariance matrix
+ * @return The log of the multivariate normal density.
+ * @throw std::domain_error if the first element of r is not positive, r is
+ * not finite or the covariance matrix is not positive definite.
+ * @throw std::invalid_argument if the sizes do not match.
+ */
+template <bool propto, typename T_y, typename T_loc, typename T_covar,
+          require_eigen_col_vector_t<T_covar>* = nullptr>
+return_type_t<T_y, T_loc, T_covar> multi_normal_toeplitz_lpdf(
+    const T_y& y, const T_loc& mu, const T_covar& r) {
+  static constexpr const char* function = "multi_normal_toeplitz_lpdf";
+  using T_covar_elem = typename scalar_type<T_covar>::type;
+  using T_return = return_type_t<T_y, T_loc, T_covar>;
+  using T_partials_return = partials_return_t<T_y, T_loc, T_covar>;
+  using matrix_partials_t
+      = Eigen::Matrix<T_partials_return, Eigen::Dynamic, Eigen::Dynamic>;
+  using vector_partials_t = Eigen::Matrix<T_partials_return, Eigen::Dynamic, 1>;
+  using T_y_ref = ref_type_t<T_y>;
+  using T_mu_ref = ref_type_t<T_loc>;
+  using T_r_ref = ref_type_t<T_covar>;
+
+  check_consistent_sizes_mvt(function, "y", y, "mu", mu);
+  size_t number_of_y = size_mvt(y);
+  size_t number_of_mu = size_mvt(mu);
+  if (number_of_y == 0 || number_of_mu == 0) {
+    return 0;
+  }
+
+  T_y_ref y_ref = y;
+  T_mu_ref mu_ref = mu;
+  T_r_ref r_ref = r;
+  vector_seq_view<T_y_ref> y_vec(y_ref);
+  vector_seq_view<T_mu_ref> mu_vec(mu_ref);
+  const size_t size_vec = max_size_mvt(y, mu);
+
+  const int size_y = y_vec[0].size();
+  const int size_mu = mu_vec[0].size();
+
+  // check size consistency of all random variables y
+  for (size_t i = 1, size_mvt_y = size_mvt(y); i < size_mvt_y; i++) {
+    check_size_match(function,
+                     "Size of one of the vectors of "
+                     "the random variable",
+                     y_vec[i].size(),
+                     "Size of the first vector of the "
+                     "random variable",
+                     size_y);
+  }
+  // check size consistency of all means mu
+  for (size_t i = 1, size_mvt_mu = size_mvt(mu); i < size_mvt_mu; i++) {
+    check_size_match(function,
+                     "Size of one of the vectors of "
+                     "the location variable",
+                     mu_vec[i].size(),
+                     "Size of the first vector of the "
+                     "location variable",
+                     size_mu);
+  }
+
+  check_size_match(function, "Size of random variable", size_y,
+                   "size of location parameter", size_mu);
+  check_size_match(function, "Size of random variable", size_y,
+                   "size of covariance parameter", r.size());
+
+  for (size_t i = 0; i < size_vec; i++) {
+    check_finite(function, "Location parameter", mu_vec[i]);
+    check_not_nan(function, "Random variable", y_vec[i]);
+  }
+  check_finite(function, "Covariance parameter", r_ref);
+
+  if (unlikely(size_y == 0)) {
+    return T_return(0);
+  }
+  check_positive(function, "Variance", r_ref.coeff(0));
+
+  const vector_partials_t r_val = value_of(r_ref);
+  vector_partials_t inv_first_col;
+  T_partials_return log_det;
+  internal::toeplitz_durbin(function, r_val, inv_first_col, log_det);
+
+  auto ops_partials = make_partials_propagator(y_ref, mu_ref, r_ref);
+
+  T_partials_return logp(0);
+  if (include_summand<propto>::value) {
+    logp += NEG_LOG_SQRT_TWO_PI * size_y * size_vec;
+  }
+  if (include_summand<propto, T_covar_elem>::value) {
+    logp -= 0.5 * log_det * size_vec;
+  }
+
+  if (include_summand<propto, T_y, T_loc, T_covar_elem>::value) {
+    matrix_partials_t y_val_minus_mu_val(size_y, size_vec);
+    for (size_t i = 0; i < size_vec; i++) {
+      decltype(auto) y_val = as_value_column_vector_or_scalar(y_vec[i]);
+      decltype(auto) mu_val = as_value_column_vector_or_scalar(mu_vec[i]);
+      y_val_minus_mu_val.col(i) = y_val - mu_val;
+    }
+    const matrix_partials_t scaled_diff
+        = internal::toeplitz_inverse_multiply(inv_first_col,
+                                              y_val_minus_mu_val);
+
+    logp -= 0.5 * (y_val_minus_mu_val.array() * scaled_diff.array()).sum();
+
+    for (size_t i = 0; i < size_vec; i++) {
+      if (!is_constant_all<T_y>::value) {
+        partials_vec<0>(ops_partials)[i] -= scaled_diff.col(i);
+      }
+      if (!is_constant_all<T_loc>::value) {
+        partials_vec<1>(ops_partials)[i] += scaled_diff.col(i);
+      }
+    }
+
+    if (!is_constant_all<T_covar_elem>::value) {
+      // d/dr_k of -0.5 log|Sigma| - 0.5 a^T Sigma a with Sigma^-1 (y - mu)
+      // = a is -0.5 tr(Sigma^-1 E_k) + 0.5 a^T E_k a, where E_k has ones on
+      // the k-th super- and subdiagonals
+      vector_partials_t r_grad
+          = -static_cast<double>(size_vec)
+            * internal::toeplitz_inverse_diagonal_sums(inv_first_col);
+      for (int k = 0; k < size_y; ++k) {
+        r_grad.coeffRef(k)
+            += (scaled_diff.topRows(size_y - k).array()
+                * scaled_diff.bottomRows(size_y - k).array())
+                   .sum();
+      }
+      r_grad.coeffRef(0) *= 0.5;
+      partials<2>(ops_partials) += r_grad;
+    }
+  }
+
+  return ops_partials.build(logp);
+}
+
+template <typename T_y, typename T_loc, typename T_covar>
+inline return_type_t<T_y, T_loc, T_covar> multi_normal_toeplitz_lpdf(
+    const T_y& y, const T_loc& mu, const T_covar& r) {
+  return multi_normal_toeplitz_lpdf<false>(y, mu, r);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -16,6 +16,8 @@
 #include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/fun/poisson_binomial_log_probs.hpp>
 #include <stan/math/prim/fun/vector_seq_view.hpp>
+#include <stan/math/prim/functor/partials_propagator.hpp>
+#include <type_traits>
 
 namespace stan {
 namespace math {
@@ -36,6 +38,8 @@ namespace math {
 template <bool propto, typename T_y, typename T_theta>
 return_type_t<T_theta> poisson_binomial_lccdf(const T_y& y,
                                               const T_theta& theta) {
+  using T_partials_return = partials_return_t<T_theta>;
+  using T_theta_ref = ref_type_t<T_theta>;
   static constexpr const char* function = "poisson_binomial_lccdf";
 
   auto size_theta = size_mvt(theta);
@@ -46,7 +50,8 @@ return_type_t<T_theta> poisson_binomial_lccdf(const T_y& y,
 
   auto max_sz = std::max(stan::math::size(y), size_mvt(theta));
   scalar_seq_view<T_y> y_vec(y);
-  vector_seq_view<T_theta> theta_vec(theta);
+  T_theta_ref theta_ref = theta;
+  vector_seq_view<T_theta_ref> theta_vec(theta_ref);
 
   for (size_t i = 0; i < max_sz; ++i) {
     check_bounded(function, "Successes variable", y_vec[i], 0,
@@ -56,6 +61,8 @@ return_type_t<T_theta> poisson_binomial_lccdf(const T_y& y,
                   1.0);
   }
 
+  auto ops_partials = make_partials_propagator(theta_ref);
+  T_partials_return lccdf_fft = 0;
   return_type_t<T_theta> lccdf = 0.0;
   for (size_t i = 0; i < max_sz; ++i) {
     if (stan::math::size(theta_vec[i]) == 1) {
@@ -64,13 +71,24 @@ return_type_t<T_theta> poisson_binomial_lccdf(const T_y& y,
       } else {
         lccdf -= stan::math::INFTY;
       }
-    } else {
-      auto x = log1m_exp(
-          log_sum_exp(poisson_binomial_log_probs(y_vec[i], theta_vec[i])));
-      lccdf += x;
+      continue;
     }
+    if constexpr (std::is_same<T_partials_return, double>::value) {
+      if (internal::use_poisson_binomial_fft(y_vec[i], theta_vec[i].size())) {
+        Eigen::VectorXd grad;
+        lccdf_fft += internal::poisson_binomial_log_sum_probs(
+            y_vec[i] + 1, theta_vec[i].size(), theta_vec.val(i), grad);
+        if constexpr (!is_constant_all<T_theta>::value) {
+          partials_vec<0>(ops_partials)[i] += grad;
+        }
+        continue;
+      }
+    }
+    auto x = log1m_exp(
+        log_sum_exp(poisson_binomial_log_probs(y_vec[i], theta_vec[i])));
+    lccdf += x;
   }
-  return lccdf;
+  return ops_partials.build(lccdf_fft) + lccdf;
 }
 
 template <typename T_y, typename T_theta>
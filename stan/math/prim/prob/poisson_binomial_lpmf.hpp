@@ -7,6 +7,8 @@
 #include <stan/math/prim/fun/scalar_seq_view.hpp>
 #include <stan/math/prim/fun/poisson_binomial_log_probs.hpp>
 #include <stan/math/prim/fun/vector_seq_view.hpp>
+#include <stan/math/prim/functor/partials_propagator.hpp>
+#include <type_traits>
 
 namespace stan {
 namespace math {
@@ -27,6 +29,8 @@ namespace math {
 template <bool propto, typename T_y, typename T_theta>
 return_type_t<T_theta> poisson_binomial_lpmf(const T_y& y,
                                              const T_theta& theta) {
+  using T_partials_return = partials_return_t<T_theta>;
+  using T_theta_ref = ref_type_t<T_theta>;
   static constexpr const char* function = "poisson_binomial_lpmf";
 
   auto size_theta = size_mvt(theta);
@@ -37,7 +41,8 @@ return_type_t<T_theta> poisson_binomial_lpmf(const T_y& y,
 
   auto max_sz = std::max(stan::math::size(y), size_theta);
   scalar_seq_view<T_y> y_vec(y);
-  vector_seq_view<T_theta> theta_vec(theta);
+  T_theta_ref theta_ref = theta;
+  vector_seq_view<T_theta_ref> theta_vec(theta_ref);
 
   for (size_t i = 0; i < max_sz; ++i) {
     check_bounded(function, "Successes variable", y_vec[i], 0,
@@ -47,13 +52,26 @@ return_type_t<T_theta> poisson_binomial_lpmf(const T_y& y,
                   1.0);
   }
 
+  auto ops_partials = make_partials_propagator(theta_ref);
+  T_partials_return log_prob_fft = 0;
   return_type_t<T_theta> log_prob = 0.0;
   for (size_t i = 0; i < max_sz; ++i) {
+    if constexpr (std::is_same<T_partials_return, double>::value) {
+      if (internal::use_poisson_binomial_fft(y_vec[i], theta_vec[i].size())) {
+        Eigen::VectorXd grad;
+        log_prob_fft += internal::poisson_binomial_log_sum_probs(
+            y_vec[i], y_vec[i], theta_vec.val(i), grad);
+        if constexpr (!is_constant_all<T_theta>::value) {
+          partials_vec<0>(ops_partials)[i] += grad;
+        }
+        continue;
+      }
+    }
     auto x = poisson_binomial_log_probs(y_vec[i], theta_vec[i]);
     log_prob += x(y_vec[i]);
   }
 
-  return log_prob;
+  return ops_partials.build(log_prob_fft) + log_prob;
 }
 
 template <typename T_y, typename T_theta>
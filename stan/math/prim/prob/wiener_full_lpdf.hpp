@@ -4,6 +4,12 @@
 #include <stan/math/prim/fun.hpp>
 #include <stan/math/prim/functor/hcubature.hpp>
 #include <stan/math/prim/prob/wiener5_lpdf.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <array>
+#include <map>
+#include <type_traits>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -212,6 +218,11 @@ inline auto wiener7_integrate(const Wiener7FunctorT& wiener7_functor,
  *
  * See \b Details below for more details on how to use \c wiener_lpdf().
  *
+ * Observations with \c sw or \c st0 different from zero need numerical
+ * integration. Observations with the same values of all parameters are
+ * integrated once, and if the arguments are not forward mode autodiff types
+ * the distinct observations are integrated in parallel with TBB.
+ *
  * @tparam T_y type of scalar
  * @tparam T_a type of boundary separation
  * @tparam T_t0 type of non-decision time
@@ -446,29 +457,22 @@ inline auto wiener_lpdf(const T_y& y, const T_a& a, const T_t0& t0,
                                                v_ref, sv_ref, sw_ref, st0_ref);
   ret_t result = 0;
 
-  // calculate density and partials
-  for (size_t i = 0; i < N; i++) {
-    if (sw_vec[i] == 0 && st0_vec[i] == 0) {
-      // note: because we're delegating to wiener5_lpdf,
-      // we need to make sure is_constant is consistent between
-      // our inputs and these
-      result += wiener_lpdf<propto>(y_vec[i], a_vec[i], t0_vec[i], w_vec[i],
-                                    v_vec[i], sv_vec[i], precision_derivatives);
-      continue;
-    }
-    const T_partials_return y_value = y_vec.val(i);
-    const T_partials_return a_value = a_vec.val(i);
-    const T_partials_return v_value = v_vec.val(i);
-    const T_partials_return w_value = w_vec.val(i);
-    const T_partials_return t0_value = t0_vec.val(i);
-    const T_partials_return sv_value = sv_vec.val(i);
-    const T_partials_return sw_value = sw_vec.val(i);
-    const T_partials_return st0_value = st0_vec.val(i);
+  // log density and partials of one observation with variability in w or
+  // t0, as [log density, d/dy, d/da, d/dt0, d/dw, d/dv, d/dsv, d/dsw,
+  // d/dst0]
+  using values_t = std::array<T_partials_return, 8>;
+  using observation_t = Eigen::Matrix<T_partials_return, 9, 1>;
+  const auto integrate_observation = [&](const values_t& values) {
+    const T_partials_return y_value = values[0];
+    const T_partials_return a_value = values[1];
+    const T_partials_return v_value = values[2];
+    const T_partials_return w_value = values[3];
+    const T_partials_return t0_value = values[4];
+    const T_partials_return sv_value = values[5];
+    const T_partials_return sw_value = values[6];
+    const T_partials_return st0_value = values[7];
     const int dim = (sw_value != 0) + (st0_value != 0);
-    check_positive(function_name,
-                   "(Inter-trial variability in A-priori bias) + "
-                   "(Inter-trial variability in nondecision time)",
-                   dim);
+    observation_t out = observation_t::Zero();
 
     Eigen::Matrix<T_partials_return, -1, 1> xmin = Eigen::VectorXd::Zero(dim);
     Eigen::Matrix<T_partials_return, -1, 1> xmax = Eigen::VectorXd::Ones(dim);
@@ -490,7 +494,7 @@ inline auto wiener_lpdf(const T_y& y, const T_a& a, const T_t0& t0,
             hcubature_err, params, dim, xmin, xmax,
             maximal_evaluations_hcubature, absolute_error_hcubature,
             relative_error_hcubature / 2);
-    log_density += log(density);
+    out[0] = log(density);
     hcubature_err = log_error_absolute - log_error_derivative
                     + log(fabs(density)) + LOG_TWO + 1;
 
@@ -509,10 +513,10 @@ inline auto wiener_lpdf(const T_y& y, const T_a& a, const T_t0& t0,
     // computation of derivatives and precision checks
     T_partials_return derivative;
     if (!is_constant_all<T_y>::value) {
-      partials<0>(ops_partials)[i] = deriv_t_7;
+      out[1] = deriv_t_7;
     }
     if (!is_constant_all<T_a>::value) {
-      partials<1>(ops_partials)[i]
+      out[2]
           = internal::wiener7_integrate<GradientCalc::OFF, GradientCalc::OFF>(
                 [](auto&&... args) {
                   return internal::wiener5_grad_a<GradientCalc::ON>(args...);
@@ -523,10 +527,10 @@ inline auto wiener_lpdf(const T_y& y, const T_a& a, const T_t0& t0,
             / density;
     }
     if (!is_constant_all<T_t0>::value) {
-      partials<2>(ops_partials)[i] = -deriv_t_7;
+      out[3] = -deriv_t_7;
     }
     if (!is_constant_all<T_w>::value) {
-      partials<3>(ops_partials)[i]
+      out[4]
           = internal::wiener7_integrate<GradientCalc::OFF, GradientCalc::ON>(
                 [](auto&&... args) {
                   return internal::wiener5_grad_w<GradientCalc::ON>(args...);
@@ -537,7 +541,7 @@ inline auto wiener_lpdf(const T_y& y, const T_a& a, const T_t0& t0,
             / density;
     }
     if (!is_constant_all<T_v>::value) {
-      partials<4>(ops_partials)[i]
+      out[5]
           = internal::wiener7_integrate<GradientCalc::OFF, GradientCalc::OFF>(
                 [](auto&&... args) {
                   return internal::wiener5_grad_v<GradientCalc::ON>(args...);
@@ -548,7 +552,7 @@ inline auto wiener_lpdf(const T_y& y, const T_a& a, const T_t0& t0,
             / density;
     }
     if (!is_constant_all<T_sv>::value) {
-      partials<5>(ops_partials)[i]
+      out[6]
           = internal::wiener7_integrate<GradientCalc::OFF, GradientCalc::OFF>(
                 [](auto&&... args) {
                   return internal::wiener5_grad_sv<GradientCalc::ON>(args...);
@@ -560,7 +564,7 @@ inline auto wiener_lpdf(const T_y& y, const T_a& a, const T_t0& t0,
     }
     if (!is_constant_all<T_sw>::value) {
       if (sw_value == 0) {
-        partials<6>(ops_partials)[i] = 0;
+        out[7] = 0;
       } else {
         if (st0_value == 0) {
           derivative = internal::estimate_with_err_check<
@@ -576,15 +580,15 @@ inline auto wiener_lpdf(const T_y& y, const T_a& a, const T_t0& t0,
               maximal_evaluations_hcubature, absolute_error_hcubature,
               relative_error_hcubature / 2);
         }
-        partials<6>(ops_partials)[i] = derivative / density - 1.0 / sw_value;
+        out[7] = derivative / density - 1.0 / sw_value;
       }
     }
     if (!is_constant_all<T_st0>::value) {
       T_partials_return f;
       if (st0_value == 0) {
-        partials<7>(ops_partials)[i] = 0;
+        out[8] = 0;
       } else if (y_value - (t0_value + st0_value) <= 0) {
-        partials<7>(ops_partials)[i] = -1 / st0_value;
+        out[8] = -1 / st0_value;
       } else {
         const T_partials_return t0_st0 = t0_value + st0_value;
         if (sw_value == 0) {
@@ -608,8 +612,94 @@ inline auto wiener_lpdf(const T_y& y, const T_a& a, const T_t0& t0,
               maximal_evaluations_hcubature, absolute_error_hcubature,
               relative_error_hcubature / 2.0);
         }
-        partials<7>(ops_partials)[i] = -1 / st0_value + f / st0_value / density;
+        out[8] = -1 / st0_value + f / st0_value / density;
+      }
+    }
+    return out;
+  };
+
+  // observations without variability in w and t0 are delegated to the
+  // 5-parameter density, the others are grouped by their parameter values
+  // so that repeated parameters are integrated once
+  static constexpr bool is_arithmetic_partials
+      = std::is_arithmetic<T_partials_return>::value;
+  std::vector<size_t> observations;
+  std::vector<size_t> group_of;
+  std::vector<values_t> group_values;
+  std::map<values_t, size_t> groups;
+  for (size_t i = 0; i < N; i++) {
+    if (sw_vec[i] == 0 && st0_vec[i] == 0) {
+      // note: because we're delegating to wiener5_lpdf,
+      // we need to make sure is_constant is consistent between
+      // our inputs and these
+      result += wiener_lpdf<propto>(y_vec[i], a_vec[i], t0_vec[i], w_vec[i],
+                                    v_vec[i], sv_vec[i], precision_derivatives);
+      continue;
+    }
+    const values_t values{y_vec.val(i),  a_vec.val(i),  v_vec.val(i),
+                          w_vec.val(i),  t0_vec.val(i), sv_vec.val(i),
+                          sw_vec.val(i), st0_vec.val(i)};
+    const int dim = (values[6] != 0) + (values[7] != 0);
+    check_positive(function_name,
+                   "(Inter-trial variability in A-priori bias) + "
+                   "(Inter-trial variability in nondecision time)",
+                   dim);
+    observations.push_back(i);
+    if (is_arithmetic_partials) {
+      auto group = groups.emplace(values, group_values.size());
+      if (group.second) {
+        group_values.push_back(values);
       }
+      group_of.push_back(group.first->second);
+    } else {
+      group_of.push_back(group_values.size());
+      group_values.push_back(values);
+    }
+  }
+
+  // the groups are integrated in parallel if no autodiff types are involved
+  std::vector<observation_t> group_results(group_values.size());
+  if (is_arithmetic_partials && group_values.size() > 1) {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, group_values.size()),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                        for (size_t g = r.begin(); g != r.end(); ++g) {
+                          group_results[g]
+                              = integrate_observation(group_values[g]);
+                        }
+                      });
+  } else {
+    for (size_t g = 0; g < group_values.size(); ++g) {
+      group_results[g] = integrate_observation(group_values[g]);
+    }
+  }
+
+  for (size_t k = 0; k < observations.size(); ++k) {
+    const size_t i = observations[k];
+    const observation_t& out = group_results[group_of[k]];
+    log_density += out[0];
+    if (!is_constant_all<T_y>::value) {
+      partials<0>(ops_partials)[i] += out[1];
+    }
+    if (!is_constant_all<T_a>::value) {
+      partials<1>(ops_partials)[i] += out[2];
+    }
+    if (!is_constant_all<T_t0>::value) {
+      partials<2>(ops_partials)[i] += out[3];
+    }
+    if (!is_constant_all<T_w>::value) {
+      partials<3>(ops_partials)[i] += out[4];
+    }
+    if (!is_constant_all<T_v>::value) {
+      partials<4>(ops_partials)[i] += out[5];
+    }
+    if (!is_constant_all<T_sv>::value) {
+      partials<5>(ops_partials)[i] += out[6];
+    }
+    if (!is_constant_all<T_sw>::value) {
+      partials<6>(ops_partials)[i] += out[7];
+    }
+    if (!is_constant_all<T_st0>::value) {
+      partials<7>(ops_partials)[i] += out[8];
     }
   }
   return result + ops_partials.build(log_density);
@@ -4,6 +4,7 @@
 #include <stan/math/prim/fun/Eigen.hpp>
 
 #include <stan/math/rev/fun/LDLT_factor.hpp>
+#include <stan/math/rev/fun/matrix_factor.hpp>
 #include <stan/math/rev/fun/Phi.hpp>
 #include <stan/math/rev/fun/Phi_approx.hpp>
 #include <stan/math/rev/fun/abs.hpp>
@@ -28,9 +29,11 @@
 #include <stan/math/rev/fun/cbrt.hpp>
 #include <stan/math/rev/fun/ceil.hpp>
 #include <stan/math/rev/fun/cholesky_decompose.hpp>
+#include <stan/math/rev/fun/cholesky_update.hpp>
 #include <stan/math/rev/fun/cumulative_sum.hpp>
 #include <stan/math/rev/fun/columns_dot_product.hpp>
 #include <stan/math/rev/fun/columns_dot_self.hpp>
+#include <stan/math/rev/fun/complex_schur_decompose.hpp>
 #include <stan/math/rev/fun/conj.hpp>
 #include <stan/math/rev/fun/cos.hpp>
 #include <stan/math/rev/fun/cosh.hpp>
@@ -44,8 +47,11 @@
 #include <stan/math/rev/fun/divide.hpp>
 #include <stan/math/rev/fun/dot_product.hpp>
 #include <stan/math/rev/fun/dot_self.hpp>
+#include <stan/math/rev/fun/eigendecompose.hpp>
 #include <stan/math/rev/fun/eigendecompose_sym.hpp>
+#include <stan/math/rev/fun/eigenvalues.hpp>
 #include <stan/math/rev/fun/eigenvalues_sym.hpp>
+#include <stan/math/rev/fun/eigenvectors.hpp>
 #include <stan/math/rev/fun/eigenvectors_sym.hpp>
 #include <stan/math/rev/fun/elt_divide.hpp>
 #include <stan/math/rev/fun/elt_multiply.hpp>
@@ -68,9 +74,18 @@
 #include <stan/math/rev/fun/gamma_p.hpp>
 #include <stan/math/rev/fun/gamma_q.hpp>
 #include <stan/math/rev/fun/generalized_inverse.hpp>
+#include <stan/math/rev/fun/gp_dot_prod_cov.hpp>
+#include <stan/math/rev/fun/gp_exp_quad_cov.hpp>
+#include <stan/math/rev/fun/gp_exponential_cov.hpp>
+#include <stan/math/rev/fun/gp_matern32_cov.hpp>
+#include <stan/math/rev/fun/gp_matern52_cov.hpp>
 #include <stan/math/rev/fun/gp_periodic_cov.hpp>
 #include <stan/math/rev/fun/grad.hpp>
 #include <stan/math/rev/fun/grad_inc_beta.hpp>
+#include <stan/math/rev/fun/hsgp_exp_quad_sqrt_spd.hpp>
+#include <stan/math/rev/fun/hsgp_matern32_sqrt_spd.hpp>
+#include <stan/math/rev/fun/hsgp_matern52_sqrt_spd.hpp>
+#include <stan/math/rev/fun/hsgp_sqrt_spd.hpp>
 #include <stan/math/rev/fun/hypergeometric_1F0.hpp>
 #include <stan/math/rev/fun/hypergeometric_2F1.hpp>
 #include <stan/math/rev/fun/hypergeometric_pFq.hpp>
@@ -123,6 +138,7 @@
 #include <stan/math/rev/fun/mdivide_left_ldlt.hpp>
 #include <stan/math/rev/fun/mdivide_left_spd.hpp>
 #include <stan/math/rev/fun/mdivide_left_tri.hpp>
+#include <stan/math/rev/fun/mdivide_right.hpp>
 #include <stan/math/rev/fun/modified_bessel_first_kind.hpp>
 #include <stan/math/rev/fun/modified_bessel_second_kind.hpp>
 #include <stan/math/rev/fun/multiply.hpp>
@@ -136,6 +152,7 @@
 #include <stan/math/rev/fun/pow.hpp>
 #include <stan/math/rev/fun/primitive_value.hpp>
 #include <stan/math/rev/fun/proj.hpp>
+#include <stan/math/rev/fun/pseudo_eigenvalues.hpp>
 #include <stan/math/rev/fun/quad_form.hpp>
 #include <stan/math/rev/fun/quad_form_sym.hpp>
 #include <stan/math/rev/fun/read_corr_L.hpp>
@@ -175,6 +192,7 @@
 #include <stan/math/rev/fun/trace.hpp>
 #include <stan/math/rev/fun/trace_gen_inv_quad_form_ldlt.hpp>
 #include <stan/math/rev/fun/trace_gen_quad_form.hpp>
+#include <stan/math/rev/fun/trace_inv_quad_form.hpp>
 #include <stan/math/rev/fun/trace_inv_quad_form_ldlt.hpp>
 #include <stan/math/rev/fun/trace_quad_form.hpp>
 #include <stan/math/rev/fun/trigamma.hpp>
@@ -70,6 +70,77 @@ inline auto unblocked_cholesky_lambda(T1& L_A, T2& L, T3& A) {
   };
 }
 
+/**
+ * Blocked reverse mode differentiation of the Cholesky decomposition,
+ * overwriting the adjoint of the Cholesky factor with the adjoint of the
+ * lower triangle of the decomposed matrix. If \p parallel is true, the
+ * products and solves with the rows and columns outside of each diagonal
+ * block are split into chunks of \p block_size rows or columns that are
+ * processed in parallel with TBB.
+ *
+ * Reverse mode differentiation algorithm reference:
+ *
+ * Iain Murray: Differentiation of the Cholesky decomposition, 2016.
+ *
+ * @param L_A Cholesky factor
+ * @param[in, out] L_adj on entry the adjoint of the Cholesky factor, on
+ * exit the adjoint of the lower triangle of the decomposed matrix
+ * @param block_size number of rows and columns of the diagonal blocks
+ * @param parallel whether to process the chunks in parallel
+ */
+template <typename T1>
+inline void cholesky_blocked_adjoint(const T1& L_A, Eigen::MatrixXd& L_adj,
+                                     int block_size, bool parallel) {
+  using Eigen::Lower;
+  using Eigen::StrictlyUpper;
+  using Eigen::Upper;
+  const int M_ = L_A.rows();
+  for (int k = M_; k > 0; k -= block_size) {
+    int j = std::max(0, k - block_size);
+    auto R = L_A.block(j, 0, k - j, j);
+    auto D = L_A.block(j, j, k - j, k - j).eval();
+    auto B = L_A.block(k, 0, M_ - k, j);
+    auto C = L_A.block(k, j, M_ - k, k - j);
+    auto R_adj = L_adj.block(j, 0, k - j, j);
+    auto D_adj = L_adj.block(j, j, k - j, k - j);
+    auto B_adj = L_adj.block(k, 0, M_ - k, j);
+    auto C_adj = L_adj.block(k, j, M_ - k, k - j);
+    D.transposeInPlace();
+    if (C_adj.size() > 0) {
+      cholesky_for_each_chunk(
+          M_ - k, block_size, parallel,
+          [&](Eigen::Index begin, Eigen::Index end) {
+            auto C_adj_rows = C_adj.middleRows(begin, end - begin);
+            C_adj_rows = D.template triangularView<Upper>()
+                             .solve(C_adj_rows.transpose())
+                             .transpose();
+            B_adj.middleRows(begin, end - begin).noalias()
+                -= C_adj_rows * R;
+          });
+      cholesky_for_each_chunk(
+          k - j, block_size / 4, parallel,
+          [&](Eigen::Index begin, Eigen::Index end) {
+            D_adj.middleCols(begin, end - begin).noalias()
+                -= C_adj.transpose() * C.middleCols(begin, end - begin);
+          });
+    }
+    D_adj = (D * D_adj.template triangularView<Lower>()).eval();
+    D_adj.template triangularView<StrictlyUpper>()
+        = D_adj.adjoint().template triangularView<StrictlyUpper>();
+    D.template triangularView<Upper>().solveInPlace(D_adj);
+    D.template triangularView<Upper>().solveInPlace(D_adj.transpose());
+    cholesky_for_each_chunk(
+        j, block_size, parallel, [&](Eigen::Index begin, Eigen::Index end) {
+          auto R_adj_cols = R_adj.middleCols(begin, end - begin);
+          R_adj_cols.noalias()
+              -= C_adj.transpose() * B.middleCols(begin, end - begin);
+          R_adj_cols.noalias() -= D_adj.template selfadjointView<Lower>()
+                                  * R.middleCols(begin, end - begin);
+        });
+    D_adj.diagonal() *= 0.5;
+  }
+}
+
 /**
  * Reverse mode differentiation algorithm reference:
  *
@@ -79,41 +150,29 @@ inline auto unblocked_cholesky_lambda(T1& L_A, T2& L, T3& A) {
 template <typename T1, typename T2, typename T3>
 inline auto cholesky_lambda(T1& L_A, T2& L, T3& A) {
   return [L_A, L, A]() mutable {
-    using Eigen::Lower;
-    using Eigen::StrictlyUpper;
-    using Eigen::Upper;
     Eigen::MatrixXd L_adj = Eigen::MatrixXd::Zero(L.rows(), L.cols());
     L_adj.template triangularView<Eigen::Lower>() = L.adj();
     const int M_ = L_A.rows();
     int block_size_ = std::max(M_ / 8, 8);
     block_size_ = std::min(block_size_, 128);
-    for (int k = M_; k > 0; k -= block_size_) {
-      int j = std::max(0, k - block_size_);
-      auto R = L_A.block(j, 0, k - j, j);
-      auto D = L_A.block(j, j, k - j, k - j).eval();
-      auto B = L_A.block(k, 0, M_ - k, j);
-      auto C = L_A.block(k, j, M_ - k, k - j);
-      auto R_adj = L_adj.block(j, 0, k - j, j);
-      auto D_adj = L_adj.block(j, j, k - j, k - j);
-      auto B_adj = L_adj.block(k, 0, M_ - k, j);
-      auto C_adj = L_adj.block(k, j, M_ - k, k - j);
-      D.transposeInPlace();
-      if (C_adj.size() > 0) {
-        C_adj = D.template triangularView<Upper>()
-                    .solve(C_adj.transpose())
-                    .transpose();
-        B_adj.noalias() -= C_adj * R;
-        D_adj.noalias() -= C_adj.transpose() * C;
-      }
-      D_adj = (D * D_adj.template triangularView<Lower>()).eval();
-      D_adj.template triangularView<StrictlyUpper>()
-          = D_adj.adjoint().template triangularView<StrictlyUpper>();
-      D.template triangularView<Upper>().solveInPlace(D_adj);
-      D.template triangularView<Upper>().solveInPlace(D_adj.transpose());
-      R_adj.noalias() -= C_adj.transpose() * B;
-      R_adj.noalias() -= D_adj.template selfadjointView<Lower>() * R;
-      D_adj.diagonal() *= 0.5;
-    }
+    cholesky_blocked_adjoint(L_A, L_adj, block_size_, false);
+    A.adj().template triangularView<Eigen::Lower>() += L_adj;
+  };
+}
+
+/**
+ * Multithreaded version of <code>cholesky_lambda</code> for large
+ * matrices, which uses blocks of
+ * <code>cholesky_tuning_opts().tile_size</code> rows and columns.
+ */
+template <typename T1, typename T2, typename T3>
+inline auto parallel_cholesky_lambda(T1& L_A, T2& L, T3& A) {
+  return [L_A, L, A]() mutable {
+    Eigen::MatrixXd L_adj = Eigen::MatrixXd::Zero(L.rows(), L.cols());
+    L_adj.template triangularView<Eigen::Lower>() = L.adj();
+    cholesky_blocked_adjoint(L_A, L_adj,
+                             std::max(cholesky_tuning_opts().tile_size, 8),
+                             true);
     A.adj().template triangularView<Eigen::Lower>() += L_adj;
   };
 }
@@ -122,8 +181,10 @@ inline auto cholesky_lambda(T1& L_A, T2& L, T3& A) {
 /**
  * Reverse mode specialization of cholesky decomposition
  *
- * Internally calls Eigen::LLT rather than using
- * stan::math::cholesky_decompose in order to use an inplace decomposition.
+ * Internally decomposes a copy of the values in place rather than using
+ * stan::math::cholesky_decompose. Matrices with at least
+ * <code>cholesky_tuning_opts().parallel_min_size</code> rows use the
+ * multithreaded tiled decomposition and adjoint.
  *
  * Note chainable stack varis are created below in Matrix<var, -1, -1>
  *
@@ -137,10 +198,8 @@ inline auto cholesky_decompose(const EigMat& A) {
   arena_t<Eigen::Matrix<double, -1, -1>> L_A(arena_A.val());
 
   check_symmetric("cholesky_decompose", "A", A);
-  Eigen::LLT<Eigen::Ref<Eigen::MatrixXd>, Eigen::Lower> L_factor(L_A);
-  check_pos_definite("cholesky_decompose", "m", L_factor);
+  internal::cholesky_decompose_inplace("cholesky_decompose", "m", L_A);
 
-  L_A.template triangularView<Eigen::StrictlyUpper>().setZero();
   // looping gradient calcs faster for small matrices compared to
   // cholesky_block
   vari* dummy = new vari(0.0, false);
@@ -148,6 +207,10 @@ inline auto cholesky_decompose(const EigMat& A) {
   if (L_A.rows() <= 35) {
     internal::initialize_return(L, L_A, dummy);
     reverse_pass_callback(internal::unblocked_cholesky_lambda(L_A, L, arena_A));
+  } else if (L_A.rows() >= cholesky_tuning_opts().parallel_min_size) {
+    internal::initialize_return(L, L_A, dummy);
+    reverse_pass_callback(
+        internal::parallel_cholesky_lambda(L_A, L, arena_A));
   } else {
     internal::initialize_return(L, L_A, dummy);
     reverse_pass_callback(internal::cholesky_lambda(L_A, L, arena_A));
@@ -172,6 +235,8 @@ inline auto cholesky_decompose(const T& A) {
   plain_type_t<T> L = cholesky_decompose(A.val());
   if (A.rows() <= 35) {
     reverse_pass_callback(internal::unblocked_cholesky_lambda(L.val(), L, A));
+  } else if (A.rows() >= cholesky_tuning_opts().parallel_min_size) {
+    reverse_pass_callback(internal::parallel_cholesky_lambda(L.val(), L, A));
   } else {
     reverse_pass_callback(internal::cholesky_lambda(L.val(), L, A));
   }
@@ -0,0 +1,177 @@
+#ifndef STAN_MATH_REV_FUN_CHOLESKY_UPDATE_HPP
+#define STAN_MATH_REV_FUN_CHOLESKY_UPDATE_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/cholesky_update.hpp>
+#include <cmath>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * Reverse pass of <code>cholesky_rank_update</code>. Undoes the steps of
+ * the forward pass in reverse order, recovering the columns before every
+ * step from the columns after it and the stored rotation parameters, and
+ * propagates the adjoints through each step on the way, so the cost is
+ * the same `O(N^2 k)` as the forward pass.
+ *
+ * @param sign 1 for an update and -1 for a downdate
+ * @param[in, out] L on entry the updated Cholesky factor
+ * @param[in, out] W on entry the low-rank term transformed by the forward
+ * pass
+ * @param a_b the `2 N k` rotation parameters stored by the forward pass
+ * @param[in, out] adj_L on entry the adjoint of the updated factor, on
+ * exit the adjoint of the original factor
+ * @param[out] adj_W adjoint of the low-rank term, must be zero on entry
+ */
+inline void cholesky_rank_update_adjoint(double sign, Eigen::MatrixXd& L,
+                                         Eigen::MatrixXd& W,
+                                         const double* a_b,
+                                         Eigen::MatrixXd& adj_L,
+                                         Eigen::MatrixXd& adj_W) {
+  const Eigen::Index N = L.rows();
+  const Eigen::Index K = W.cols();
+  Eigen::VectorXd l_eff_adj(N);
+  for (Eigen::Index j = N - 1; j >= 0; --j) {
+    const Eigen::Index M = N - j - 1;
+    for (Eigen::Index i = K - 1; i >= 0; --i) {
+      const double a = a_b[2 * (j * K + i)];
+      const double b = a_b[2 * (j * K + i) + 1];
+      const double r = L.coeff(j, j);
+      const double c = r / a;
+      const double s = b / a;
+      auto l = L.col(j).tail(M);
+      auto w = W.col(i).tail(M);
+      auto l_adj = adj_L.col(j).tail(M);
+      auto w_adj = adj_W.col(i).tail(M);
+
+      // undo w' = c w - s l'
+      double c_adj = 0;
+      double s_adj = -w_adj.dot(l);
+      w = (w + s * l) / c;
+      c_adj += w_adj.dot(w);
+      auto l_new_adj = l_eff_adj.head(M);
+      l_new_adj = l_adj - s * w_adj;
+      w_adj *= c;
+
+      // undo l' = (l + sign s w) / c
+      c_adj -= l_new_adj.dot(l) / c;
+      s_adj += sign * l_new_adj.dot(w) / c;
+      w_adj += (sign * s / c) * l_new_adj;
+      l_adj = l_new_adj / c;
+      l = c * l - sign * s * w;
+
+      // undo r = sqrt(a^2 + sign b^2), c = r / a, s = b / a
+      const double r_adj = adj_L.coeff(j, j) + c_adj / a;
+      adj_L.coeffRef(j, j) = r_adj * a / r - c_adj * c / a - s_adj * s / a;
+      adj_W.coeffRef(j, i) += sign * r_adj * b / r + s_adj / a;
+      L.coeffRef(j, j) = a;
+    }
+  }
+}
+
+/**
+ * Reverse mode implementation of <code>cholesky_update</code> and
+ * <code>cholesky_downdate</code>.
+ *
+ * @tparam T1 type of the Cholesky factor
+ * @tparam T2 type of the low-rank term
+ * @param function name of the calling function
+ * @param sign 1 for an update and -1 for a downdate
+ * @param L lower triangular Cholesky factor
+ * @param V low-rank term
+ */
+template <typename T1, typename T2>
+inline auto cholesky_rank_update_rev(const char* function, double sign,
+                                     const T1& L, const T2& V) {
+  using ret_type = promote_var_matrix_t<Eigen::MatrixXd, T1, T2>;
+  check_square(function, "L", L);
+  check_size_match(function, "Rows of L", L.rows(), "rows of V", V.rows());
+  check_positive(function, "diagonal of L", value_of(L).diagonal());
+  check_finite(function, "V", value_of(V));
+
+  const Eigen::Index N = L.rows();
+  const Eigen::Index K = V.cols();
+  arena_t<T1> arena_L = L;
+  arena_t<T2> arena_V = V;
+  Eigen::MatrixXd L_new
+      = value_of(arena_L).template triangularView<Eigen::Lower>();
+  Eigen::MatrixXd W = value_of(arena_V);
+  double* a_b
+      = ChainableStack::instance_->memalloc_.alloc_array<double>(2 * N * K);
+  cholesky_rank_update(function, sign, L_new, W, a_b);
+
+  arena_t<ret_type> res = L_new;
+  arena_t<Eigen::MatrixXd> arena_W = W;
+  reverse_pass_callback(
+      [sign, arena_L, arena_V, arena_W, a_b, res]() mutable {
+        Eigen::MatrixXd L_rev = res.val();
+        Eigen::MatrixXd W_rev = arena_W;
+        Eigen::MatrixXd adj_L
+            = res.adj().template triangularView<Eigen::Lower>();
+        Eigen::MatrixXd adj_W = Eigen::MatrixXd::Zero(W_rev.rows(),
+                                                      W_rev.cols());
+        cholesky_rank_update_adjoint(sign, L_rev, W_rev, a_b, adj_L, adj_W);
+        if constexpr (!is_constant<T1>::value) {
+          arena_L.adj() += adj_L;
+        }
+        if constexpr (!is_constant<T2>::value) {
+          arena_V.adj() += adj_W;
+        }
+      });
+  return ret_type(res);
+}
+
+}  // namespace internal
+
+/**
+ * Return the Cholesky factor of `L L^T + V V^T` given the lower
+ * triangular Cholesky factor `L` and a low-rank term `V`. The forward and
+ * the reverse pass both cost `O(N^2 k)`.
+ *
+ * @tparam T1 type of the Cholesky factor
+ * @tparam T2 type of the low-rank term (vector or matrix)
+ * @param L `N x N` lower triangular Cholesky factor
+ * @param V `N x k` low-rank term
+ * @return Cholesky factor of `L L^T + V V^T`
+ * @throw std::invalid_argument if `L` is not square or the number of rows
+ * of `V` does not match
+ * @throw std::domain_error if the diagonal of `L` is not positive or the
+ * arguments are not finite
+ */
+template <typename T1, typename T2, require_all_matrix_t<T1, T2>* = nullptr,
+          require_any_st_var<T1, T2>* = nullptr>
+inline auto cholesky_update(const T1& L, const T2& V) {
+  return internal::cholesky_rank_update_rev("cholesky_update", 1.0, L, V);
+}
+
+/**
+ * Return the Cholesky factor of `L L^T - V V^T` given the lower
+ * triangular Cholesky factor `L` and a low-rank term `V`. The forward and
+ * the reverse pass both cost `O(N^2 k)`.
+ *
+ * @tparam T1 type of the Cholesky factor
+ * @tparam T2 type of the low-rank term (vector or matrix)
+ * @param L `N x N` lower triangular Cholesky factor
+ * @param V `N x k` low-rank term
+ * @return Cholesky factor of `L L^T - V V^T`
+ * @throw std::invalid_argument if `L` is not square or the number of rows
+ * of `V` does not match
+ * @throw std::domain_error if the diagonal of `L` is not positive, the
+ * arguments are not finite or `L L^T - V V^T` is not positive definite
+ */
+template <typename T1, typename T2, require_all_matrix_t<T1, T2>* = nullptr,
+          require_any_st_var<T1, T2>* = nullptr>
+inline auto cholesky_downdate(const T1& L, const T2& V) {
+  return internal::cholesky_rank_update_rev("cholesky_downdate", -1.0, L, V);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
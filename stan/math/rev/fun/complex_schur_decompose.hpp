@@ -0,0 +1,168 @@
+#ifndef STAN_MATH_REV_FUN_COMPLEX_SCHUR_DECOMPOSE_HPP
+#define STAN_MATH_REV_FUN_COMPLEX_SCHUR_DECOMPOSE_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/eigendecompose.hpp>
+#include <stan/math/rev/fun/to_arena.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/complex_schur_decompose.hpp>
+#include <complex>
+#include <tuple>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * Returns the adjoint of a real matrix `A = U T U^H` given its complex
+ * Schur decomposition and the adjoints of `U` and `T`.
+ *
+ * With `X = U^H dA U` and `Omega = U^H dU = Y - Y^H` for a strictly lower
+ * triangular `Y`, the strictly lower part of `T Y - Y T` is minus the
+ * strictly lower part of `X` and `dT = X - Omega T + T Omega`. The reverse
+ * pass solves the adjoint of this triangular Sylvester equation by
+ * substitution in `O(N^3)` operations. Like for the eigenvectors, the
+ * phases of the columns of `U` are not determined by `A`, and the adjoint
+ * is exact for functions that do not depend on them.
+ *
+ * @param U unitary matrix of the decomposition
+ * @param T upper triangular matrix of the decomposition
+ * @param adj_U adjoint of `U`
+ * @param adj_T adjoint of `T`
+ */
+inline Eigen::MatrixXd complex_schur_adjoint(const Eigen::MatrixXcd& U,
+                                             const Eigen::MatrixXcd& T,
+                                             const Eigen::MatrixXcd& adj_U,
+                                             const Eigen::MatrixXcd& adj_T) {
+  const Eigen::Index N = U.rows();
+  const Eigen::MatrixXcd adj_T_upper
+      = adj_T.template triangularView<Eigen::Upper>();
+  const Eigen::MatrixXcd K = adj_U.adjoint() * U - T * adj_T_upper.adjoint()
+                             + adj_T_upper.adjoint() * T;
+  const Eigen::MatrixXcd adj_Y = K.adjoint() - K;
+
+  // solve the strictly lower part of T^H Z - Z T^H = adj_Y for a strictly
+  // lower triangular Z, top to bottom and right to left
+  Eigen::MatrixXcd Z = Eigen::MatrixXcd::Zero(N, N);
+  for (Eigen::Index i = 1; i < N; ++i) {
+    for (Eigen::Index j = i - 1; j >= 0; --j) {
+      std::complex<double> z = adj_Y.coeff(i, j);
+      for (Eigen::Index k = j + 1; k < i; ++k) {
+        z -= std::conj(T.coeff(k, i)) * Z.coeff(k, j);
+        z += Z.coeff(i, k) * std::conj(T.coeff(j, k));
+      }
+      Z.coeffRef(i, j) = z / std::conj(T.coeff(i, i) - T.coeff(j, j));
+    }
+  }
+  const Eigen::MatrixXcd adj_X = adj_T_upper - Z;
+  return (U * adj_X * U.adjoint()).real();
+}
+
+/**
+ * Computes the complex Schur decomposition of a (real-valued) matrix of
+ * vars in double precision and registers the reverse pass.
+ *
+ * @tparam EigMat type of the matrix of vars
+ * @param m real matrix to decompose
+ * @return tuple of the unitary matrix and the upper triangular matrix
+ */
+template <typename EigMat>
+inline std::tuple<Eigen::Matrix<std::complex<var>, -1, -1>,
+                  Eigen::Matrix<std::complex<var>, -1, -1>>
+complex_schur_decompose_rev(const EigMat& m) {
+  auto arena_m = to_arena(m);
+  Eigen::ComplexSchur<Eigen::MatrixXd> cs(arena_m.val());
+  arena_t<Eigen::MatrixXcd> U = cs.matrixU();
+  arena_t<Eigen::MatrixXcd> T = cs.matrixT();
+  arena_t<Eigen::Matrix<var, -1, -1>> U_re = U.real();
+  arena_t<Eigen::Matrix<var, -1, -1>> U_im = U.imag();
+  arena_t<Eigen::Matrix<var, -1, -1>> T_re = T.real();
+  arena_t<Eigen::Matrix<var, -1, -1>> T_im = T.imag();
+
+  reverse_pass_callback(
+      [arena_m, U, T, U_re, U_im, T_re, T_im]() mutable {
+        arena_m.adj() += complex_schur_adjoint(
+            U, T, complex_adjoint(U_re, U_im), complex_adjoint(T_re, T_im));
+      });
+
+  return std::make_tuple(make_complex_var_matrix(U_re, U_im),
+                         make_complex_var_matrix(T_re, T_im));
+}
+
+}  // namespace internal
+
+/**
+ * Return the unitary matrix of the complex Schur decomposition of a
+ * (real-valued) matrix of vars. The decomposition is computed once in
+ * double precision and the reverse pass applies its closed form adjoint.
+ *
+ * @tparam EigMat type of the matrix of vars
+ * @param m real matrix to decompose
+ * @return complex unitary matrix of the complex Schur decomposition
+ * @throw std::invalid_argument if m is not square
+ * @see complex_schur_decompose_t
+ */
+template <typename EigMat,
+          require_eigen_dense_dynamic_vt<is_var, EigMat>* = nullptr>
+inline Eigen::Matrix<std::complex<var>, -1, -1> complex_schur_decompose_u(
+    const EigMat& m) {
+  if (unlikely(m.size() == 0)) {
+    return Eigen::Matrix<std::complex<var>, -1, -1>(0, 0);
+  }
+  check_square("complex_schur_decompose_u", "m", m);
+  return std::get<0>(internal::complex_schur_decompose_rev(m));
+}
+
+/**
+ * Return the upper triangular Schur form matrix of the complex Schur
+ * decomposition of a (real-valued) matrix of vars. The decomposition is
+ * computed once in double precision and the reverse pass applies its
+ * closed form adjoint.
+ *
+ * @tparam EigMat type of the matrix of vars
+ * @param m real matrix to decompose
+ * @return complex upper triangular Schur form of the matrix
+ * @throw std::invalid_argument if m is not square
+ * @see complex_schur_decompose_u
+ */
+template <typename EigMat,
+          require_eigen_dense_dynamic_vt<is_var, EigMat>* = nullptr>
+inline Eigen::Matrix<std::complex<var>, -1, -1> complex_schur_decompose_t(
+    const EigMat& m) {
+  if (unlikely(m.size() == 0)) {
+    return Eigen::Matrix<std::complex<var>, -1, -1>(0, 0);
+  }
+  check_square("complex_schur_decompose_t", "m", m);
+  return std::get<1>(internal::complex_schur_decompose_rev(m));
+}
+
+/**
+ * Return the complex Schur decomposition of a (real-valued) matrix of
+ * vars. The decomposition is computed once in double precision and the
+ * reverse pass applies its closed form adjoint.
+ *
+ * @tparam EigMat type of the matrix of vars
+ * @param m real matrix to decompose
+ * @return a tuple (U,T) where U is the complex unitary matrix and T is the
+ * complex upper triangular Schur form of the matrix
+ * @throw std::invalid_argument if m is not square
+ */
+template <typename EigMat,
+          require_eigen_dense_dynamic_vt<is_var, EigMat>* = nullptr>
+inline std::tuple<Eigen::Matrix<std::complex<var>, -1, -1>,
+                  Eigen::Matrix<std::complex<var>, -1, -1>>
+complex_schur_decompose(const EigMat& m) {
+  if (unlikely(m.size() == 0)) {
+    return std::make_tuple(Eigen::Matrix<std::complex<var>, -1, -1>(0, 0),
+                           Eigen::Matrix<std::complex<var>, -1, -1>(0, 0));
+  }
+  check_square("complex_schur_decompose", "m", m);
+  return internal::complex_schur_decompose_rev(m);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
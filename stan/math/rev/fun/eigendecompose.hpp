@@ -0,0 +1,152 @@
+#ifndef STAN_MATH_REV_FUN_EIGENDECOMPOSE_HPP
+#define STAN_MATH_REV_FUN_EIGENDECOMPOSE_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/to_arena.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/eigendecompose.hpp>
+#include <complex>
+#include <tuple>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * Returns a matrix of `std::complex<var>` whose real and imaginary parts
+ * are the elements of two matrices of vars of the same size.
+ *
+ * @tparam T type of the matrices of vars
+ * @param re real parts
+ * @param im imaginary parts
+ */
+template <typename T>
+inline Eigen::Matrix<std::complex<var>, T::RowsAtCompileTime,
+                     T::ColsAtCompileTime>
+make_complex_var_matrix(const T& re, const T& im) {
+  Eigen::Matrix<std::complex<var>, T::RowsAtCompileTime, T::ColsAtCompileTime>
+      res(re.rows(), re.cols());
+  for (Eigen::Index i = 0; i < res.size(); ++i) {
+    res.coeffRef(i) = std::complex<var>(re.coeff(i), im.coeff(i));
+  }
+  return res;
+}
+
+/**
+ * Returns the adjoint `re.adj() + i im.adj()` of a complex matrix with
+ * real parts \p re and imaginary parts \p im.
+ *
+ * @tparam T type of the matrices of vars
+ * @param re real parts
+ * @param im imaginary parts
+ */
+template <typename T>
+inline Eigen::Matrix<std::complex<double>, T::RowsAtCompileTime,
+                     T::ColsAtCompileTime>
+complex_adjoint(const T& re, const T& im) {
+  Eigen::Matrix<std::complex<double>, T::RowsAtCompileTime,
+                T::ColsAtCompileTime>
+      res(re.rows(), re.cols());
+  for (Eigen::Index i = 0; i < res.size(); ++i) {
+    res.coeffRef(i)
+        = std::complex<double>(re.coeff(i).adj(), im.coeff(i).adj());
+  }
+  return res;
+}
+
+/**
+ * Returns the adjoint of a real matrix `A = V diag(lambda) V^-1` given the
+ * adjoints of its eigenvalues and of its eigenvectors, which are
+ * normalized to unit norm.
+ *
+ * The adjoint is `Re(V^-H (diag(adj_lambda) + F) V^H)` with
+ * `F_ij = (V^H adj_V - V^H V diag(Re(diag(V^H adj_V))))_ij
+ * / conj(lambda_j - lambda_i)` for `i != j` and zero on the diagonal.
+ * Complex eigenvectors are only determined up to a phase, and their part
+ * of the adjoint is exact for functions of the eigenvectors that do not
+ * depend on the phase, such as the eigenvectors of real eigenvalues.
+ *
+ * @param V eigenvectors
+ * @param lambda eigenvalues
+ * @param adj_lambda adjoint of the eigenvalues
+ * @param adj_V adjoint of the eigenvectors, or an empty matrix if the
+ * eigenvectors are not used
+ */
+inline Eigen::MatrixXd eigendecompose_adjoint(
+    const Eigen::MatrixXcd& V, const Eigen::VectorXcd& lambda,
+    const Eigen::VectorXcd& adj_lambda, const Eigen::MatrixXcd& adj_V) {
+  const Eigen::Index N = V.rows();
+  Eigen::MatrixXcd G = adj_lambda.asDiagonal();
+  if (adj_V.size() > 0) {
+    const Eigen::MatrixXcd VhgV = V.adjoint() * adj_V;
+    const Eigen::MatrixXcd F
+        = VhgV
+          - V.adjoint() * V
+                * VhgV.diagonal()
+                      .real()
+                      .cast<std::complex<double>>()
+                      .asDiagonal();
+    for (Eigen::Index j = 0; j < N; ++j) {
+      for (Eigen::Index i = 0; i < N; ++i) {
+        if (i != j) {
+          G.coeffRef(i, j)
+              += F.coeff(i, j) / std::conj(lambda.coeff(j) - lambda.coeff(i));
+        }
+      }
+    }
+  }
+  return (V.adjoint().partialPivLu().solve(G) * V.adjoint()).real();
+}
+
+}  // namespace internal
+
+/**
+ * Return the eigendecomposition of a (real-valued) matrix of vars. The
+ * decomposition is computed once in double precision and the reverse pass
+ * propagates the adjoints of the eigenvalues and the eigenvectors to the
+ * matrix with a few `O(N^3)` matrix operations.
+ *
+ * @tparam EigMat type of the matrix of vars
+ * @param m real matrix to decompose
+ * @return a tuple (V, a) where V is a matrix of the complex eigenvectors of
+ * m, normalized to unit norm, and a is a complex vector of its eigenvalues
+ * @throw std::invalid_argument if m is not square
+ */
+template <typename EigMat,
+          require_eigen_matrix_dynamic_vt<is_var, EigMat>* = nullptr>
+inline std::tuple<Eigen::Matrix<std::complex<var>, -1, -1>,
+                  Eigen::Matrix<std::complex<var>, -1, 1>>
+eigendecompose(const EigMat& m) {
+  if (unlikely(m.size() == 0)) {
+    return std::make_tuple(Eigen::Matrix<std::complex<var>, -1, -1>(0, 0),
+                           Eigen::Matrix<std::complex<var>, -1, 1>(0, 1));
+  }
+  check_square("eigendecompose", "m", m);
+
+  auto arena_m = to_arena(m);
+  Eigen::EigenSolver<Eigen::MatrixXd> solver(arena_m.val());
+  arena_t<Eigen::MatrixXcd> V = solver.eigenvectors();
+  arena_t<Eigen::VectorXcd> lambda = solver.eigenvalues();
+  arena_t<Eigen::Matrix<var, -1, -1>> V_re = V.real();
+  arena_t<Eigen::Matrix<var, -1, -1>> V_im = V.imag();
+  arena_t<Eigen::Matrix<var, -1, 1>> lambda_re = lambda.real();
+  arena_t<Eigen::Matrix<var, -1, 1>> lambda_im = lambda.imag();
+
+  reverse_pass_callback(
+      [arena_m, V, lambda, V_re, V_im, lambda_re, lambda_im]() mutable {
+        arena_m.adj() += internal::eigendecompose_adjoint(
+            V, lambda, internal::complex_adjoint(lambda_re, lambda_im),
+            internal::complex_adjoint(V_re, V_im));
+      });
+
+  return std::make_tuple(internal::make_complex_var_matrix(V_re, V_im),
+                         internal::make_complex_var_matrix(lambda_re,
+                                                           lambda_im));
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
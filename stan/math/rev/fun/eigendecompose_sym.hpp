@@ -1,5 +1,5 @@
-#ifndef STAN_MATH_REV_FUN_EIGENDECOMPOSE_HPP
-#define STAN_MATH_REV_FUN_EIGENDECOMPOSE_HPP
+#ifndef STAN_MATH_REV_FUN_EIGENDECOMPOSE_SYM_HPP
+#define STAN_MATH_REV_FUN_EIGENDECOMPOSE_SYM_HPP
 
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/rev/meta.hpp>
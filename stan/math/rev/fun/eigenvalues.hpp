@@ -0,0 +1,53 @@
+#ifndef STAN_MATH_REV_FUN_EIGENVALUES_HPP
+#define STAN_MATH_REV_FUN_EIGENVALUES_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/eigendecompose.hpp>
+#include <stan/math/rev/fun/to_arena.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/eigenvalues.hpp>
+#include <complex>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the complex eigenvalues of a (real-valued) matrix of vars. The
+ * eigenvalues and eigenvectors are computed once in double precision and
+ * the reverse pass adds `Re(V^-H diag(adj_lambda) V^H)` to the adjoint of
+ * the matrix.
+ *
+ * @tparam EigMat type of the matrix of vars
+ * @param m real matrix
+ * @return complex eigenvalues of the matrix
+ * @throw std::invalid_argument if m is not square
+ */
+template <typename EigMat,
+          require_eigen_matrix_dynamic_vt<is_var, EigMat>* = nullptr>
+inline Eigen::Matrix<std::complex<var>, -1, 1> eigenvalues(const EigMat& m) {
+  if (unlikely(m.size() == 0)) {
+    return Eigen::Matrix<std::complex<var>, -1, 1>(0, 1);
+  }
+  check_square("eigenvalues", "m", m);
+
+  auto arena_m = to_arena(m);
+  Eigen::EigenSolver<Eigen::MatrixXd> solver(arena_m.val());
+  arena_t<Eigen::MatrixXcd> V = solver.eigenvectors();
+  arena_t<Eigen::VectorXcd> lambda = solver.eigenvalues();
+  arena_t<Eigen::Matrix<var, -1, 1>> lambda_re = lambda.real();
+  arena_t<Eigen::Matrix<var, -1, 1>> lambda_im = lambda.imag();
+
+  reverse_pass_callback([arena_m, V, lambda, lambda_re, lambda_im]() mutable {
+    arena_m.adj() += internal::eigendecompose_adjoint(
+        V, lambda, internal::complex_adjoint(lambda_re, lambda_im),
+        Eigen::MatrixXcd(0, 0));
+  });
+
+  return internal::make_complex_var_matrix(lambda_re, lambda_im);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
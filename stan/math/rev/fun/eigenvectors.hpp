@@ -0,0 +1,53 @@
+#ifndef STAN_MATH_REV_FUN_EIGENVECTORS_HPP
+#define STAN_MATH_REV_FUN_EIGENVECTORS_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/eigendecompose.hpp>
+#include <stan/math/rev/fun/to_arena.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/eigenvectors.hpp>
+#include <complex>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the complex eigenvectors of a (real-valued) matrix of vars,
+ * normalized to unit norm. The decomposition is computed once in double
+ * precision and the reverse pass propagates the adjoint of the
+ * eigenvectors to the matrix with a few `O(N^3)` matrix operations.
+ *
+ * @tparam EigMat type of the matrix of vars
+ * @param m real matrix
+ * @return complex eigenvectors of the matrix
+ * @throw std::invalid_argument if m is not square
+ */
+template <typename EigMat,
+          require_eigen_matrix_dynamic_vt<is_var, EigMat>* = nullptr>
+inline Eigen::Matrix<std::complex<var>, -1, -1> eigenvectors(const EigMat& m) {
+  if (unlikely(m.size() == 0)) {
+    return Eigen::Matrix<std::complex<var>, -1, -1>(0, 0);
+  }
+  check_square("eigenvectors", "m", m);
+
+  auto arena_m = to_arena(m);
+  Eigen::EigenSolver<Eigen::MatrixXd> solver(arena_m.val());
+  arena_t<Eigen::MatrixXcd> V = solver.eigenvectors();
+  arena_t<Eigen::VectorXcd> lambda = solver.eigenvalues();
+  arena_t<Eigen::Matrix<var, -1, -1>> V_re = V.real();
+  arena_t<Eigen::Matrix<var, -1, -1>> V_im = V.imag();
+
+  reverse_pass_callback([arena_m, V, lambda, V_re, V_im]() mutable {
+    arena_m.adj() += internal::eigendecompose_adjoint(
+        V, lambda, Eigen::VectorXcd::Zero(lambda.size()),
+        internal::complex_adjoint(V_re, V_im));
+  });
+
+  return internal::make_complex_var_matrix(V_re, V_im);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
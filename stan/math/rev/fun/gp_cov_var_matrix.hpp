@@ -0,0 +1,188 @@
+#ifndef STAN_MATH_REV_FUN_GP_COV_VAR_MATRIX_HPP
+#define STAN_MATH_REV_FUN_GP_COV_VAR_MATRIX_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/adjoint_of.hpp>
+#include <stan/math/rev/fun/to_arena.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/square.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * Returns the values of the inputs of a Gaussian process kernel as the
+ * columns of a `D x N` matrix, where `D` is 1 for scalar inputs and the
+ * size of the vectors for vector inputs.
+ *
+ * @tparam T_x type of the inputs
+ * @param function name of the calling function
+ * @param x std::vector of scalars or of Eigen column vectors
+ * @throw std::invalid_argument if the vectors do not all have the same size
+ */
+template <typename T_x>
+inline Eigen::MatrixXd gp_inputs_values(const char* function,
+                                        const std::vector<T_x>& x) {
+  if constexpr (is_stan_scalar<T_x>::value) {
+    Eigen::MatrixXd X(1, x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      X.coeffRef(0, i) = value_of(x[i]);
+    }
+    return X;
+  } else {
+    const Eigen::Index D = x.empty() ? 0 : x[0].size();
+    Eigen::MatrixXd X(D, x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      check_size_match(function, "x row", D, "x's other row", x[i].size());
+      X.col(i) = value_of(x[i]);
+    }
+    return X;
+  }
+}
+
+/**
+ * Adds the columns of \p adj_X to the adjoints of the inputs of a Gaussian
+ * process kernel.
+ *
+ * @tparam T_x type of the arena copy of the inputs
+ * @param x arena copy of the std::vector of var inputs
+ * @param adj_X `D x N` matrix of adjoints
+ */
+template <typename T_x>
+inline void gp_inputs_add_adjoint(T_x& x, const Eigen::MatrixXd& adj_X) {
+  for (size_t i = 0; i < x.size(); ++i) {
+    if constexpr (is_stan_scalar<value_type_t<T_x>>::value) {
+      x[i].adj() += adj_X.coeff(0, i);
+    } else {
+      x[i].adj() += adj_X.col(i);
+    }
+  }
+}
+
+/**
+ * Returns the adjoint of the inputs `X` of a kernel whose derivative with
+ * respect to the inputs is `dK_ij / dx_i = C_ij (x_i - x_j)` with
+ * `C_ij = C_ji`, given the elementwise product `M = G .* C` of the adjoint
+ * `G` of the covariance matrix and `C`.
+ *
+ * @param X `D x N` values of the inputs
+ * @param M `N x N` elementwise product of the adjoint of the covariance
+ * matrix and the coefficients of the differences of the inputs
+ */
+template <typename EigMat>
+inline Eigen::MatrixXd gp_inputs_adjoint(const Eigen::MatrixXd& X,
+                                         const EigMat& M) {
+  const Eigen::MatrixXd M_sym = M + M.transpose();
+  return X * M_sym.rowwise().sum().asDiagonal() - X * M_sym;
+}
+
+/**
+ * Returns the covariance matrix of a stationary isotropic kernel
+ * `k(x, x') = sigma^2 g(|x - x'|^2 / l^2)` as a single
+ * `var_value<Eigen::MatrixXd>`. The values of the covariance matrix and
+ * the derivatives of its elements with respect to the scaled squared
+ * distances are kept in the arena, and the reverse pass computes the
+ * adjoints of \p sigma, \p length_scale and \p x from them with a few
+ * matrix operations instead of one vari per element.
+ *
+ * @tparam T_x type of the inputs
+ * @tparam T_sigma type of the magnitude
+ * @tparam T_l type of the length scale
+ * @tparam F type of the kernel functor, which returns a `std::pair` of
+ * `g(s)` and `g'(s)` for a scaled squared distance `s`
+ * @param function name of the calling function
+ * @param x std::vector of scalars or of Eigen column vectors
+ * @param sigma magnitude
+ * @param length_scale length scale
+ * @param kernel kernel functor
+ * @return covariance matrix
+ */
+template <typename T_x, typename T_sigma, typename T_l, typename F>
+inline var_value<Eigen::MatrixXd> gp_isotropic_cov(const char* function,
+                                                   const std::vector<T_x>& x,
+                                                   const T_sigma& sigma,
+                                                   const T_l& length_scale,
+                                                   const F& kernel) {
+  const size_t x_size = x.size();
+  for (size_t i = 0; i < x_size; ++i) {
+    check_not_nan(function, "x", x[i]);
+  }
+  check_positive_finite(function, "magnitude", sigma);
+  check_positive_finite(function, "length scale", length_scale);
+  arena_t<Eigen::MatrixXd> X = gp_inputs_values(function, x);
+
+  const double sigma_sq = square(value_of(sigma));
+  const double inv_l_sq = 1.0 / square(value_of(length_scale));
+  constexpr bool grad_s = !is_constant_all<T_x, T_l>::value;
+  arena_t<Eigen::MatrixXd> cov_val(x_size, x_size);
+  arena_t<Eigen::MatrixXd> dcov_ds(grad_s ? x_size : 0, grad_s ? x_size : 0);
+  arena_t<Eigen::MatrixXd> s(grad_s ? x_size : 0, grad_s ? x_size : 0);
+  size_t block_size = 10;
+  for (size_t jb = 0; jb < x_size; jb += block_size) {
+    for (size_t ib = jb; ib < x_size; ib += block_size) {
+      size_t j_end = std::min(x_size, jb + block_size);
+      for (size_t j = jb; j < j_end; ++j) {
+        cov_val.coeffRef(j, j) = sigma_sq;
+        if (grad_s) {
+          dcov_ds.coeffRef(j, j) = 0;
+          s.coeffRef(j, j) = 0;
+        }
+        size_t i_end = std::min(x_size, ib + block_size);
+        for (size_t i = std::max(ib, j + 1); i < i_end; ++i) {
+          const double s_ij = (X.col(i) - X.col(j)).squaredNorm() * inv_l_sq;
+          const auto g = kernel(s_ij);
+          cov_val.coeffRef(j, i) = cov_val.coeffRef(i, j)
+              = sigma_sq * g.first;
+          if (grad_s) {
+            dcov_ds.coeffRef(j, i) = dcov_ds.coeffRef(i, j)
+                = sigma_sq * g.second;
+            s.coeffRef(j, i) = s.coeffRef(i, j) = s_ij;
+          }
+        }
+      }
+    }
+  }
+
+  var_value<Eigen::MatrixXd> cov = cov_val;
+  if constexpr (!is_constant_all<T_x, T_sigma, T_l>::value) {
+    arena_t<std::vector<T_x>> arena_x;
+    if constexpr (!is_constant<T_x>::value) {
+      arena_x = to_arena(x);
+    }
+    reverse_pass_callback([arena_x, X, sigma, length_scale, cov, dcov_ds,
+                           s]() mutable {
+      const auto& adj = cov.adj();
+      if constexpr (!is_constant<T_sigma>::value) {
+        adjoint_of(sigma) += 2.0 / value_of(sigma)
+                             * (adj.array() * cov.val().array()).sum();
+      }
+      if constexpr (!is_constant_all<T_x, T_l>::value) {
+        const Eigen::MatrixXd adj_ds = adj.cwiseProduct(dcov_ds);
+        const double l_val = value_of(length_scale);
+        if constexpr (!is_constant<T_l>::value) {
+          adjoint_of(length_scale)
+              += -2.0 / l_val * (adj_ds.array() * s.array()).sum();
+        }
+        if constexpr (!is_constant<T_x>::value) {
+          gp_inputs_add_adjoint(
+              arena_x,
+              gp_inputs_adjoint(X, (2.0 / square(l_val)) * adj_ds));
+        }
+      }
+    });
+  }
+  return cov;
+}
+
+}  // namespace internal
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,69 @@
+#ifndef STAN_MATH_REV_FUN_GP_DOT_PROD_COV_HPP
+#define STAN_MATH_REV_FUN_GP_DOT_PROD_COV_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/gp_cov_var_matrix.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/gp_dot_prod_cov.hpp>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Returns a dot product covariance matrix as a single
+ * `var_value<Eigen::MatrixXd>`, e.g.
+ * <code>gp_dot_prod_cov<var_value<Eigen::MatrixXd>>(x, sigma)</code>.
+ *
+ * \f$k(x,x') = \sigma^2 + x \cdot x'\f$
+ *
+ * The adjoints of sigma and x are computed with matrix products in one
+ * reverse pass callback instead of one vari per element.
+ *
+ * @tparam Ret `var_value<Eigen::MatrixXd>`
+ * @tparam T_x type of the elements of x, scalars or Eigen column vectors
+ * @tparam T_sigma type of sigma
+ * @param x std::vector of inputs
+ * @param sigma constant function that can be used in stan::math::square
+ * @return dot product covariance matrix
+ * @throw std::domain_error if sigma < 0, nan, inf or
+ *   x is nan or infinite
+ */
+template <typename Ret, typename T_x, typename T_sigma,
+          require_var_matrix_t<Ret>* = nullptr,
+          require_stan_scalar_t<T_sigma>* = nullptr>
+inline var_value<Eigen::MatrixXd> gp_dot_prod_cov(const std::vector<T_x>& x,
+                                                  const T_sigma& sigma) {
+  static constexpr const char* function = "gp_dot_prod_cov";
+  check_nonnegative(function, "sigma", sigma);
+  check_finite(function, "sigma", sigma);
+  for (size_t i = 0; i < x.size(); ++i) {
+    check_finite(function, "x", x[i]);
+  }
+  arena_t<Eigen::MatrixXd> X = internal::gp_inputs_values(function, x);
+  var_value<Eigen::MatrixXd> cov = Eigen::MatrixXd(
+      (X.transpose() * X).array() + square(value_of(sigma)));
+  if constexpr (!is_constant_all<T_x, T_sigma>::value) {
+    arena_t<std::vector<T_x>> arena_x;
+    if constexpr (!is_constant<T_x>::value) {
+      arena_x = to_arena(x);
+    }
+    reverse_pass_callback([arena_x, X, sigma, cov]() mutable {
+      if constexpr (!is_constant<T_sigma>::value) {
+        adjoint_of(sigma) += 2.0 * value_of(sigma) * cov.adj().sum();
+      }
+      if constexpr (!is_constant<T_x>::value) {
+        internal::gp_inputs_add_adjoint(
+            arena_x, X * (cov.adj() + cov.adj().transpose()));
+      }
+    });
+  }
+  return cov;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -6,12 +6,14 @@
 #include <stan/math/rev/core.hpp>
 #include <stan/math/rev/fun/adjoint_of.hpp>
 #include <stan/math/rev/fun/exp.hpp>
+#include <stan/math/rev/fun/gp_cov_var_matrix.hpp>
 #include <stan/math/rev/fun/squared_distance.hpp>
 #include <stan/math/rev/fun/value_of.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/gp_exp_quad_cov.hpp>
 #include <cmath>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace stan {
@@ -102,6 +104,37 @@ inline Eigen::Matrix<var, -1, -1> gp_exp_quad_cov(const std::vector<T_x>& x,
   return cov;
 }
 
+/**
+ * Returns a squared exponential kernel as a single
+ * `var_value<Eigen::MatrixXd>`, e.g.
+ * <code>gp_exp_quad_cov<var_value<Eigen::MatrixXd>>(x, sigma, l)</code>.
+ * The adjoints of sigma, the length scale and x are computed analytically
+ * in one reverse pass callback instead of one vari per element.
+ *
+ * @tparam Ret `var_value<Eigen::MatrixXd>`
+ * @tparam T_x type of the elements of x, scalars or Eigen column vectors
+ * @tparam T_sigma type of sigma
+ * @tparam T_l type of the length scale
+ * @param x std::vector of inputs
+ * @param sigma standard deviation
+ * @param length_scale length scale
+ * @return covariance matrix
+ * @throw std::domain_error if sigma <= 0, l <= 0, or
+ *   x is nan or infinite
+ */
+template <typename Ret, typename T_x, typename T_sigma, typename T_l,
+          require_var_matrix_t<Ret>* = nullptr,
+          require_all_stan_scalar_t<T_sigma, T_l>* = nullptr>
+inline var_value<Eigen::MatrixXd> gp_exp_quad_cov(const std::vector<T_x>& x,
+                                                  const T_sigma& sigma,
+                                                  const T_l& length_scale) {
+  return internal::gp_isotropic_cov(
+      "gp_exp_quad_cov", x, sigma, length_scale, [](double s) {
+        const double exp_val = std::exp(-0.5 * s);
+        return std::make_pair(exp_val, -0.5 * exp_val);
+      });
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
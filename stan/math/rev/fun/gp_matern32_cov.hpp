@@ -0,0 +1,56 @@
+#ifndef STAN_MATH_REV_FUN_GP_MATERN32_COV_HPP
+#define STAN_MATH_REV_FUN_GP_MATERN32_COV_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/gp_cov_var_matrix.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/gp_matern32_cov.hpp>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Returns a Matern 3/2 covariance matrix as a single
+ * `var_value<Eigen::MatrixXd>`, e.g.
+ * <code>gp_matern32_cov<var_value<Eigen::MatrixXd>>(x, sigma, l)</code>.
+ *
+ * \f[ k(x, x') = \sigma^2(1 +
+ *  \frac{\sqrt{3}d(x, x')}{l})exp(-\frac{\sqrt{3}d(x, x')}{l})
+ * \f]
+ *
+ * where \f$ d(x, x') \f$ is the Euclidean distance. The adjoints of
+ * sigma, the length scale and x are computed analytically in one reverse
+ * pass callback instead of one vari per element.
+ *
+ * @tparam Ret `var_value<Eigen::MatrixXd>`
+ * @tparam T_x type of the elements of x, scalars or Eigen column vectors
+ * @tparam T_s type of sigma
+ * @tparam T_l type of the length scale
+ * @param x std::vector of inputs
+ * @param sigma marginal standard deviation or magnitude
+ * @param length_scale length scale
+ * @return covariance matrix
+ * @throw std::domain error if sigma <= 0, l <= 0, or x is nan or inf
+ */
+template <typename Ret, typename T_x, typename T_s, typename T_l,
+          require_var_matrix_t<Ret>* = nullptr,
+          require_all_stan_scalar_t<T_s, T_l>* = nullptr>
+inline var_value<Eigen::MatrixXd> gp_matern32_cov(const std::vector<T_x>& x,
+                                                  const T_s& sigma,
+                                                  const T_l& length_scale) {
+  const double root_3 = std::sqrt(3.0);
+  return internal::gp_isotropic_cov(
+      "gp_matern32_cov", x, sigma, length_scale, [root_3](double s) {
+        const double r = root_3 * std::sqrt(s);
+        const double exp_neg_r = std::exp(-r);
+        return std::make_pair((1.0 + r) * exp_neg_r, -1.5 * exp_neg_r);
+      });
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
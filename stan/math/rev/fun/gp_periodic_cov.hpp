@@ -6,6 +6,7 @@
 #include <stan/math/rev/core.hpp>
 #include <stan/math/rev/fun/adjoint_of.hpp>
 #include <stan/math/rev/fun/exp.hpp>
+#include <stan/math/rev/fun/gp_cov_var_matrix.hpp>
 #include <stan/math/rev/fun/sin.hpp>
 #include <stan/math/rev/fun/square.hpp>
 #include <stan/math/rev/fun/squared_distance.hpp>
@@ -127,6 +128,125 @@ inline Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic> gp_periodic_cov(
   return cov;
 }  // namespace math
 
+/**
+ * Returns a periodic covariance matrix as a single
+ * `var_value<Eigen::MatrixXd>`, e.g.
+ * <code>gp_periodic_cov<var_value<Eigen::MatrixXd>>(x, sigma, l, p)</code>.
+ *
+ * \f$ k(\mathbf{x},\mathbf{x}^\prime) = \sigma^2
+ * \exp\left(-\frac{2\sin^2(\pi
+ * |\mathbf{x}-\mathbf{x}^\prime|/p)}{\ell^2}\right) \f$
+ *
+ * The derivatives of the elements with respect to the length-scale, the
+ * period and the inputs are kept in the arena, and the adjoints of all
+ * arguments are computed in one reverse pass callback instead of one vari
+ * per element.
+ *
+ * @tparam Ret `var_value<Eigen::MatrixXd>`
+ * @tparam T_x type of the elements of x, scalars or Eigen column vectors
+ * @tparam T_sigma type of sigma
+ * @tparam T_l type of the length-scale
+ * @tparam T_p type of the period
+ * @param x std::vector of inputs
+ * @param sigma standard deviation of the signal
+ * @param l length-scale
+ * @param p period
+ * @return periodic covariance matrix
+ * @throw std::domain_error if sigma <= 0, l <= 0, p <= 0, or
+ *   x is nan or infinite
+ */
+template <typename Ret, typename T_x, typename T_sigma, typename T_l,
+          typename T_p, require_var_matrix_t<Ret>* = nullptr,
+          require_all_stan_scalar_t<T_sigma, T_l, T_p>* = nullptr>
+inline var_value<Eigen::MatrixXd> gp_periodic_cov(const std::vector<T_x>& x,
+                                                  const T_sigma& sigma,
+                                                  const T_l& l, const T_p& p) {
+  const char* fun = "gp_periodic_cov";
+  check_positive(fun, "signal standard deviation", sigma);
+  check_positive(fun, "length-scale", l);
+  check_positive(fun, "period", p);
+  const size_t x_size = x.size();
+  for (size_t i = 0; i < x_size; ++i) {
+    check_not_nan(fun, "element of x", x[i]);
+  }
+  arena_t<Eigen::MatrixXd> X = internal::gp_inputs_values(fun, x);
+
+  const double sigma_sq = square(value_of(sigma));
+  const double l_val = value_of(l);
+  const double p_val = value_of(p);
+  const double pi_div_p = pi() / p_val;
+  const double neg_two_inv_l_sq = -2.0 / square(l_val);
+  const auto size_if = [x_size](bool grad) { return grad ? x_size : 0; };
+  arena_t<Eigen::MatrixXd> cov_val(x_size, x_size);
+  arena_t<Eigen::MatrixXd> dcov_dl(size_if(!is_constant<T_l>::value),
+                                   size_if(!is_constant<T_l>::value));
+  arena_t<Eigen::MatrixXd> dcov_dp(size_if(!is_constant<T_p>::value),
+                                   size_if(!is_constant<T_p>::value));
+  arena_t<Eigen::MatrixXd> dcov_dx(size_if(!is_constant<T_x>::value),
+                                   size_if(!is_constant<T_x>::value));
+  size_t block_size = 10;
+  for (size_t jb = 0; jb < x_size; jb += block_size) {
+    for (size_t ib = jb; ib < x_size; ib += block_size) {
+      size_t j_end = std::min(x_size, jb + block_size);
+      for (size_t j = jb; j < j_end; ++j) {
+        size_t i_end = std::min(x_size, ib + block_size);
+        for (size_t i = std::max(ib, j); i < i_end; ++i) {
+          const double dist = (X.col(i) - X.col(j)).norm();
+          const double sin_dist = std::sin(pi_div_p * dist);
+          const double sin_dist_sq = square(sin_dist);
+          const double cov_ij
+              = sigma_sq * std::exp(sin_dist_sq * neg_two_inv_l_sq);
+          cov_val.coeffRef(j, i) = cov_val.coeffRef(i, j) = cov_ij;
+          // derivative with respect to the distance
+          const double dcov_ddist = cov_ij * neg_two_inv_l_sq * pi_div_p
+                                    * std::sin(2.0 * pi_div_p * dist);
+          if (!is_constant<T_l>::value) {
+            dcov_dl.coeffRef(j, i) = dcov_dl.coeffRef(i, j)
+                = -2.0 * cov_ij * sin_dist_sq * neg_two_inv_l_sq / l_val;
+          }
+          if (!is_constant<T_p>::value) {
+            dcov_dp.coeffRef(j, i) = dcov_dp.coeffRef(i, j)
+                = -dcov_ddist * dist / p_val;
+          }
+          if (!is_constant<T_x>::value) {
+            dcov_dx.coeffRef(j, i) = dcov_dx.coeffRef(i, j)
+                = dist > 0 ? dcov_ddist / dist
+                           : 2.0 * cov_ij * neg_two_inv_l_sq
+                                 * square(pi_div_p);
+          }
+        }
+      }
+    }
+  }
+
+  var_value<Eigen::MatrixXd> cov = cov_val;
+  if constexpr (!is_constant_all<T_x, T_sigma, T_l, T_p>::value) {
+    arena_t<std::vector<T_x>> arena_x;
+    if constexpr (!is_constant<T_x>::value) {
+      arena_x = to_arena(x);
+    }
+    reverse_pass_callback([arena_x, X, sigma, l, p, cov, dcov_dl, dcov_dp,
+                           dcov_dx]() mutable {
+      const auto& adj = cov.adj();
+      if constexpr (!is_constant<T_sigma>::value) {
+        adjoint_of(sigma) += 2.0 / value_of(sigma)
+                             * (adj.array() * cov.val().array()).sum();
+      }
+      if constexpr (!is_constant<T_l>::value) {
+        adjoint_of(l) += (adj.array() * dcov_dl.array()).sum();
+      }
+      if constexpr (!is_constant<T_p>::value) {
+        adjoint_of(p) += (adj.array() * dcov_dp.array()).sum();
+      }
+      if constexpr (!is_constant<T_x>::value) {
+        internal::gp_inputs_add_adjoint(
+            arena_x, internal::gp_inputs_adjoint(X, adj.cwiseProduct(dcov_dx)));
+      }
+    });
+  }
+  return cov;
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,49 @@
+#ifndef STAN_MATH_REV_FUN_HSGP_MATERN32_SQRT_SPD_HPP
+#define STAN_MATH_REV_FUN_HSGP_MATERN32_SQRT_SPD_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/hsgp_sqrt_spd.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/hsgp_basis.hpp>
+#include <stan/math/prim/fun/hsgp_matern32_sqrt_spd.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Returns the square root of the spectral density of the one dimensional
+ * Matern 3/2 kernel at the square roots of the eigenvalues of the
+ * basis functions of the Hilbert space approximation on `[-L, L]`. The
+ * values are computed in double precision and the reverse pass adds the
+ * analytic derivatives with respect to \p sigma and \p length_scale.
+ *
+ * @tparam T_sigma type of the magnitude
+ * @tparam T_l type of the length scale
+ * @param sigma magnitude
+ * @param length_scale length scale
+ * @param L boundary of the domain
+ * @param M number of basis functions
+ * @return vector of the `M` square roots of the spectral density
+ * @throw std::domain_error if sigma, length_scale or L are not positive and
+ * finite or M is negative
+ */
+template <typename T_sigma, typename T_l,
+          require_all_stan_scalar_t<T_sigma, T_l>* = nullptr,
+          require_any_st_var<T_sigma, T_l>* = nullptr>
+inline Eigen::Matrix<var, Eigen::Dynamic, 1> hsgp_matern32_sqrt_spd(
+    const T_sigma& sigma, const T_l& length_scale, double L, int M) {
+  const double l_val = value_of(length_scale);
+  Eigen::VectorXd val = hsgp_matern32_sqrt_spd(value_of(sigma), l_val, L, M);
+  const Eigen::ArrayXd omega_sq
+      = internal::hsgp_frequencies(L, M).array().square();
+  const double a_sq = 3.0 / (l_val * l_val);
+  const Eigen::VectorXd dlog_dl
+      = (2 * a_sq / (a_sq + omega_sq) - 1.5) / l_val;
+  return internal::hsgp_sqrt_spd_rev(sigma, length_scale, val, dlog_dl);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
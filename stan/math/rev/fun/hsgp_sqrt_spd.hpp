@@ -0,0 +1,54 @@
+#ifndef STAN_MATH_REV_FUN_HSGP_SQRT_SPD_HPP
+#define STAN_MATH_REV_FUN_HSGP_SQRT_SPD_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/adjoint_of.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+
+/**
+ * Returns the square root of a spectral density that is proportional to
+ * the square of the magnitude \p sigma as a vector of vars whose reverse
+ * pass adds the analytic derivatives with respect to \p sigma and
+ * \p length_scale with a single callback.
+ *
+ * @tparam T_sigma type of the magnitude
+ * @tparam T_l type of the length scale
+ * @param sigma magnitude
+ * @param length_scale length scale
+ * @param val values of the square root of the spectral density
+ * @param dlog_dl derivatives of the log of the square root of the spectral
+ * density with respect to the length scale
+ */
+template <typename T_sigma, typename T_l>
+inline Eigen::Matrix<var, Eigen::Dynamic, 1> hsgp_sqrt_spd_rev(
+    const T_sigma& sigma, const T_l& length_scale, const Eigen::VectorXd& val,
+    const Eigen::VectorXd& dlog_dl) {
+  arena_t<Eigen::Matrix<var, Eigen::Dynamic, 1>> res = val;
+  arena_t<Eigen::VectorXd> arena_dlog_dl;
+  if constexpr (!is_constant<T_l>::value) {
+    arena_dlog_dl = dlog_dl;
+  }
+  reverse_pass_callback([sigma, length_scale, res, arena_dlog_dl]() mutable {
+    const Eigen::ArrayXd adj_val = res.adj().array() * res.val().array();
+    if constexpr (!is_constant<T_sigma>::value) {
+      adjoint_of(sigma) += adj_val.sum() / value_of(sigma);
+    }
+    if constexpr (!is_constant<T_l>::value) {
+      adjoint_of(length_scale) += (adj_val * arena_dlog_dl.array()).sum();
+    }
+  });
+  return res;
+}
+
+}  // namespace internal
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -6,6 +6,7 @@
 #include <stan/math/rev/core.hpp>
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/rev/fun/matrix_factor.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/inverse.hpp>
 
@@ -40,6 +41,39 @@ inline auto inverse(const T& m) {
   return ret_type(res);
 }
 
+/**
+ * Reverse mode specialization of calculating the inverse of a matrix given
+ * its factor.
+ *
+ * The adjoint of the matrix is accumulated in the factor and
+ * back-propagated once for all of its uses.
+ *
+ * @tparam T type of the factored matrix
+ * @tparam Decomposition Eigen decomposition template of the factor
+ * @param A factor of the matrix
+ * @return Inverse of the matrix (an empty matrix if the matrix has size
+ * zero).
+ */
+template <typename T, template <typename> class Decomposition,
+          require_rev_matrix_t<T>* = nullptr>
+inline auto inverse(const matrix_factor<T, Decomposition>& A) {
+  using ret_type = return_var_matrix_t<T>;
+  const auto& m = A.matrix();
+  if (unlikely(m.size() == 0)) {
+    return ret_type(m);
+  }
+
+  arena_t<Eigen::MatrixXd> res_val = A.decomposition().solve(
+      Eigen::MatrixXd::Identity(m.rows(), m.cols()));
+  arena_t<ret_type> res = res_val;
+
+  reverse_pass_callback([adj_A = A.adj(), res, res_val]() mutable {
+    adj_A -= res.adj_op() * res_val.transpose();
+  });
+
+  return ret_type(res);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
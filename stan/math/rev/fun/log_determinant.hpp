@@ -4,6 +4,7 @@
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/matrix_factor.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
 #include <stan/math/prim/fun/log_determinant.hpp>
@@ -30,6 +31,32 @@ inline var log_determinant(const T& m) {
   return log_det;
 }
 
+/**
+ * Returns the log absolute determinant of a matrix given its factor.
+ *
+ * The adjoint of the matrix is accumulated in the factor and
+ * back-propagated once for all of its uses.
+ *
+ * @tparam T type of the factored matrix
+ * @tparam Decomposition Eigen decomposition template of the factor
+ * @param A factor of the matrix
+ * @return log absolute determinant of the matrix.
+ */
+template <typename T, template <typename> class Decomposition,
+          require_rev_matrix_t<T>* = nullptr>
+inline var log_determinant(const matrix_factor<T, Decomposition>& A) {
+  if (A.matrix().size() == 0) {
+    return var(0.0);
+  }
+
+  var log_det = internal::log_abs_determinant(A.decomposition());
+
+  reverse_pass_callback([adj_A = A.adj(), log_det]() mutable {
+    adj_A.diagonal().array() += log_det.adj();
+  });
+  return log_det;
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
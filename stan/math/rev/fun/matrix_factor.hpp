@@ -0,0 +1,108 @@
+#ifndef STAN_MATH_REV_FUN_MATRIX_FACTOR_HPP
+#define STAN_MATH_REV_FUN_MATRIX_FACTOR_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/core/chainable_object.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/matrix_factor.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * A matrix_factor of an `Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>`
+ * or a `var_value<Eigen::MatrixXd>` holds a copy of the input matrix and
+ * the decomposition of its values, with all allocations done in the arena.
+ *
+ * The adjoint of the matrix picks up a term `A^-T G` from every function
+ * the factor is passed to. Instead of solving with the decomposition once
+ * per use, the uses accumulate their `G` in <code>adj()</code> and the
+ * factor solves once for the sum in the reverse pass, after all of its
+ * uses. The factor must be created at the same nesting level of autodiff
+ * as all of its uses.
+ *
+ * @tparam T type of the matrix
+ * @tparam Decomposition Eigen decomposition template
+ */
+template <typename T, template <typename> class Decomposition>
+class matrix_factor<T, Decomposition, require_rev_matrix_t<T>> {
+ public:
+  using decomposition_t = Decomposition<Eigen::MatrixXd>;
+
+ private:
+  arena_t<plain_type_t<T>> matrix_;
+  decomposition_t* decomposition_;
+  arena_t<Eigen::MatrixXd> adj_;
+
+ public:
+  template <typename S,
+            require_same_t<plain_type_t<T>, plain_type_t<S>>* = nullptr>
+  explicit matrix_factor(const S& matrix)
+      : matrix_(matrix),
+        decomposition_(make_unsafe_chainable_ptr(decomposition_t())),
+        adj_(Eigen::MatrixXd::Zero(matrix.rows(), matrix.cols())) {
+    if (matrix_.size() > 0) {
+      decomposition_->compute(matrix_.val());
+    }
+    reverse_pass_callback([matrix = matrix_, decomposition = decomposition_,
+                           adj = adj_]() mutable {
+      if ((adj.array() != 0.0).any()) {
+        matrix.adj() += internal::transpose_solve(*decomposition, adj);
+        adj.setZero();
+      }
+    });
+  }
+
+  /**
+   * Return a const reference to the underlying matrix
+   */
+  const auto& matrix() const noexcept { return matrix_; }
+
+  /**
+   * Return a const reference to the decomposition of the matrix values
+   */
+  const auto& decomposition() const noexcept { return *decomposition_; }
+
+  /**
+   * Return a pointer to the arena allocated decomposition of the matrix
+   * values
+   */
+  decomposition_t* decomposition_ptr() const noexcept { return decomposition_; }
+
+  /**
+   * Return the matrix `G` that is premultiplied by `A^-T` and added to the
+   * adjoint of the matrix after all uses of the factor. Uses of the factor
+   * add to it in their reverse pass callbacks.
+   */
+  const arena_t<Eigen::MatrixXd>& adj() const noexcept { return adj_; }
+};
+
+namespace internal {
+
+/**
+ * Returns a pointer to the arena allocated decomposition of the values of
+ * a matrix_factor of a matrix of vars.
+ */
+template <typename T, template <typename> class Decomposition,
+          require_st_var<T>* = nullptr>
+inline auto* arena_decomposition(const matrix_factor<T, Decomposition>& A) {
+  return A.decomposition_ptr();
+}
+
+/**
+ * Returns a pointer to an arena allocated copy of the decomposition of a
+ * matrix_factor of a matrix of doubles.
+ */
+template <typename T, template <typename> class Decomposition,
+          require_not_st_var<T>* = nullptr>
+inline auto* arena_decomposition(const matrix_factor<T, Decomposition>& A) {
+  return make_unsafe_chainable_ptr(A.decomposition());
+}
+
+}  // namespace internal
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -6,6 +6,7 @@
 #include <stan/math/rev/core.hpp>
 #include <stan/math/rev/core/typedefs.hpp>
 #include <stan/math/rev/core/chainable_object.hpp>
+#include <stan/math/rev/fun/matrix_factor.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
 #include <stan/math/prim/fun/mdivide_left.hpp>
@@ -87,6 +88,64 @@ inline auto mdivide_left(const T1& A, const T2& B) {
   }
 }
 
+/**
+ * Return the solution `X` of `AX = B` given a factor of `A`.
+ *
+ * The adjoint of `A` is accumulated in the factor and back-propagated
+ * once for all of its uses.
+ *
+ * @tparam T type of the factored matrix
+ * @tparam Decomposition Eigen decomposition template of the factor
+ * @tparam EigMat type of the right hand side
+ *
+ * @param[in] A factor of a square matrix
+ * @param[in] B right hand side
+ * @return solution of AX = B
+ */
+template <typename T, template <typename> class Decomposition,
+          typename EigMat, require_matrix_t<EigMat>* = nullptr,
+          require_any_st_var<T, EigMat>* = nullptr>
+inline auto mdivide_left(const matrix_factor<T, Decomposition>& A,
+                         const EigMat& B) {
+  using ret_val_type
+      = plain_type_t<decltype(value_of(A.matrix()) * value_of(B))>;
+  using ret_type = promote_var_matrix_t<ret_val_type, T, EigMat>;
+
+  check_multiplicable("mdivide_left", "A", A.matrix(), "B", B);
+
+  if (A.matrix().size() == 0) {
+    return ret_type(ret_val_type(0, B.cols()));
+  }
+
+  auto* decomposition = internal::arena_decomposition(A);
+  if constexpr (!is_constant<T>::value && !is_constant<EigMat>::value) {
+    arena_t<promote_scalar_t<var, EigMat>> arena_B = B;
+    arena_t<ret_type> res
+        = ret_val_type(decomposition->solve(value_of(arena_B)));
+    reverse_pass_callback(
+        [adj_A = A.adj(), arena_B, decomposition, res]() mutable {
+          adj_A -= res.adj_op() * res.val_op().transpose();
+          arena_B.adj()
+              += internal::transpose_solve(*decomposition, res.adj_op());
+        });
+    return ret_type(res);
+  } else if constexpr (!is_constant<EigMat>::value) {
+    arena_t<promote_scalar_t<var, EigMat>> arena_B = B;
+    arena_t<ret_type> res
+        = ret_val_type(decomposition->solve(value_of(arena_B)));
+    reverse_pass_callback([arena_B, decomposition, res]() mutable {
+      arena_B.adj() += internal::transpose_solve(*decomposition, res.adj_op());
+    });
+    return ret_type(res);
+  } else {
+    arena_t<ret_type> res = ret_val_type(decomposition->solve(value_of(B)));
+    reverse_pass_callback([adj_A = A.adj(), res]() mutable {
+      adj_A -= res.adj_op() * res.val_op().transpose();
+    });
+    return ret_type(res);
+  }
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
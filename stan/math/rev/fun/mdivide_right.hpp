@@ -0,0 +1,87 @@
+#ifndef STAN_MATH_REV_FUN_MDIVIDE_RIGHT_HPP
+#define STAN_MATH_REV_FUN_MDIVIDE_RIGHT_HPP
+
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/matrix_factor.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/mdivide_right.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the solution `X` of `XA = B` given a factor of `A`.
+ *
+ * @tparam EigMat type of the right hand side
+ * @tparam T type of the factored matrix
+ * @tparam Decomposition Eigen decomposition template of the factor
+ *
+ * @param[in] B right hand side
+ * @param[in] A factor of a square matrix
+ * @return solution of XA = B
+ */
+template <typename EigMat, typename T,
+          template <typename> class Decomposition,
+          require_matrix_t<EigMat>* = nullptr,
+          require_any_st_var<EigMat, T>* = nullptr>
+inline auto mdivide_right(const EigMat& B,
+                          const matrix_factor<T, Decomposition>& A) {
+  using ret_val_type
+      = plain_type_t<decltype(value_of(B) * value_of(A.matrix()))>;
+  using ret_type = promote_var_matrix_t<ret_val_type, EigMat, T>;
+
+  check_multiplicable("mdivide_right", "B", B, "A", A.matrix());
+
+  if (A.matrix().size() == 0) {
+    return ret_type(ret_val_type(B.rows(), 0));
+  }
+
+  auto* decomposition = internal::arena_decomposition(A);
+  if constexpr (!is_constant<EigMat>::value && !is_constant<T>::value) {
+    arena_t<promote_scalar_t<var, EigMat>> arena_B = B;
+    arena_t<ret_type> res
+        = internal::transpose_solve(*decomposition,
+                                    value_of(arena_B).transpose())
+              .transpose();
+    reverse_pass_callback(
+        [arena_A = A.matrix(), arena_B, decomposition, res]() mutable {
+          promote_scalar_t<double, EigMat> adjB
+              = decomposition->solve(res.adj_op().transpose().eval())
+                    .transpose();
+          arena_A.adj() -= res.val_op().transpose() * adjB;
+          arena_B.adj() += adjB;
+        });
+    return ret_type(res);
+  } else if constexpr (!is_constant<EigMat>::value) {
+    arena_t<promote_scalar_t<var, EigMat>> arena_B = B;
+    arena_t<ret_type> res
+        = internal::transpose_solve(*decomposition,
+                                    value_of(arena_B).transpose())
+              .transpose();
+    reverse_pass_callback([arena_B, decomposition, res]() mutable {
+      arena_B.adj()
+          += decomposition->solve(res.adj_op().transpose().eval())
+                 .transpose();
+    });
+    return ret_type(res);
+  } else {
+    arena_t<ret_type> res
+        = internal::transpose_solve(*decomposition, value_of(B).transpose())
+              .transpose();
+    reverse_pass_callback(
+        [arena_A = A.matrix(), decomposition, res]() mutable {
+          arena_A.adj() -= res.val_op().transpose()
+                           * decomposition
+                                 ->solve(res.adj_op().transpose().eval())
+                                 .transpose();
+        });
+    return ret_type(res);
+  }
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
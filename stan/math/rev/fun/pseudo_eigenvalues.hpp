@@ -0,0 +1,65 @@
+#ifndef STAN_MATH_REV_FUN_PSEUDO_EIGENVALUES_HPP
+#define STAN_MATH_REV_FUN_PSEUDO_EIGENVALUES_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/eigendecompose.hpp>
+#include <stan/math/rev/fun/to_arena.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/pseudo_eigenvalues.hpp>
+#include <complex>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the real block diagonal pseudo-eigenvalue matrix of a matrix of
+ * vars, with the real eigenvalues on the diagonal and a block
+ * `[a, b; -b, a]` for every pair `a +- ib` of complex eigenvalues. The
+ * decomposition is computed once in double precision and the reverse pass
+ * propagates the adjoint of the eigenvalues to the matrix.
+ *
+ * @tparam EigMat type of the matrix of vars
+ * @param m real matrix
+ * @return pseudo-eigenvalue matrix
+ * @throw std::invalid_argument if m is empty or not square
+ */
+template <typename EigMat,
+          require_eigen_matrix_dynamic_vt<is_var, EigMat>* = nullptr>
+inline Eigen::Matrix<var, -1, -1> pseudo_eigenvalues(const EigMat& m) {
+  check_nonzero_size("pseudo_eigenvalues", "m", m);
+  check_square("pseudo_eigenvalues", "m", m);
+
+  auto arena_m = to_arena(m);
+  Eigen::EigenSolver<Eigen::MatrixXd> solver(arena_m.val());
+  arena_t<Eigen::MatrixXcd> V = solver.eigenvectors();
+  arena_t<Eigen::VectorXcd> lambda = solver.eigenvalues();
+  arena_t<Eigen::Matrix<var, -1, -1>> D = solver.pseudoEigenvalueMatrix();
+
+  reverse_pass_callback([arena_m, V, lambda, D]() mutable {
+    const Eigen::Index N = lambda.size();
+    const auto& adj_D = D.adj();
+    // the block of a complex pair depends on the eigenvalue with positive
+    // imaginary part only, the adjoint of its conjugate stays zero
+    Eigen::VectorXcd adj_lambda = Eigen::VectorXcd::Zero(N);
+    for (Eigen::Index i = 0; i < N; ++i) {
+      if (i < N - 1 && lambda.coeff(i).imag() != 0) {
+        adj_lambda.coeffRef(i) = std::complex<double>(
+            adj_D.coeff(i, i) + adj_D.coeff(i + 1, i + 1),
+            adj_D.coeff(i, i + 1) - adj_D.coeff(i + 1, i));
+        ++i;
+      } else {
+        adj_lambda.coeffRef(i) = adj_D.coeff(i, i);
+      }
+    }
+    arena_m.adj() += internal::eigendecompose_adjoint(V, lambda, adj_lambda,
+                                                      Eigen::MatrixXcd(0, 0));
+  });
+
+  return D;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,79 @@
+#ifndef STAN_MATH_REV_FUN_TRACE_INV_QUAD_FORM_HPP
+#define STAN_MATH_REV_FUN_TRACE_INV_QUAD_FORM_HPP
+
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/matrix_factor.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/trace_inv_quad_form.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Compute the trace of an inverse quadratic form.  I.E., this computes
+ *       trace(B^T A^-1 B)
+ * where a factor of A is provided.
+ *
+ * The adjoint of `A` is accumulated in the factor and back-propagated
+ * once for all of its uses.
+ *
+ * @tparam T type of the factored matrix
+ * @tparam Decomposition Eigen decomposition template of the factor
+ * @tparam EigMat type of the second matrix
+ * @param A factor of the first matrix
+ * @param B second matrix
+ */
+template <typename T, template <typename> class Decomposition,
+          typename EigMat, require_matrix_t<EigMat>* = nullptr,
+          require_any_st_var<T, EigMat>* = nullptr>
+inline var trace_inv_quad_form(const matrix_factor<T, Decomposition>& A,
+                               const EigMat& B) {
+  check_multiplicable("trace_inv_quad_form", "A", A.matrix(), "B", B);
+
+  if (A.matrix().size() == 0) {
+    return 0.0;
+  }
+
+  auto* decomposition = internal::arena_decomposition(A);
+  if constexpr (!is_constant<T>::value && !is_constant<EigMat>::value) {
+    arena_t<promote_scalar_t<var, EigMat>> arena_B = B;
+    arena_t<Eigen::MatrixXd> X = decomposition->solve(value_of(arena_B));
+    var res = (arena_B.val().array() * X.array()).sum();
+    reverse_pass_callback(
+        [adj_A = A.adj(), arena_B, decomposition, X, res]() mutable {
+          adj_A -= res.adj() * arena_B.val_op() * X.transpose();
+          arena_B.adj()
+              += res.adj()
+                 * (X
+                    + internal::transpose_solve(*decomposition,
+                                                arena_B.val_op()));
+        });
+    return res;
+  } else if constexpr (!is_constant<EigMat>::value) {
+    arena_t<promote_scalar_t<var, EigMat>> arena_B = B;
+    arena_t<Eigen::MatrixXd> X = decomposition->solve(value_of(arena_B));
+    var res = (arena_B.val().array() * X.array()).sum();
+    reverse_pass_callback([arena_B, decomposition, X, res]() mutable {
+      arena_B.adj()
+          += res.adj()
+             * (X
+                + internal::transpose_solve(*decomposition, arena_B.val_op()));
+    });
+    return res;
+  } else {
+    arena_t<Eigen::MatrixXd> B_val = value_of(B);
+    arena_t<Eigen::MatrixXd> X = decomposition->solve(B_val);
+    var res = (B_val.array() * X.array()).sum();
+    reverse_pass_callback([adj_A = A.adj(), B_val, X, res]() mutable {
+      adj_A -= res.adj() * B_val * X.transpose();
+    });
+    return res;
+  }
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
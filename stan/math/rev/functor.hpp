@@ -2,6 +2,7 @@
 #define STAN_MATH_REV_FUNCTOR_HPP
 
 #include <stan/math/rev/functor/algebra_solver_fp.hpp>
+#include <stan/math/rev/functor/algebra_solver_warm_start.hpp>
 #include <stan/math/rev/functor/solve_powell.hpp>
 #include <stan/math/rev/functor/solve_newton.hpp>
 #include <stan/math/rev/functor/algebra_system.hpp>
@@ -10,6 +11,7 @@
 #include <stan/math/rev/functor/apply_vector_unary.hpp>
 #include <stan/math/rev/functor/coupled_ode_system.hpp>
 #include <stan/math/rev/functor/cvodes_integrator.hpp>
+#include <stan/math/rev/functor/cvodes_service.hpp>
 #include <stan/math/rev/functor/cvodes_utils.hpp>
 #include <stan/math/rev/functor/gradient.hpp>
 #include <stan/math/rev/functor/integrate_1d.hpp>
@@ -19,8 +21,13 @@
 #include <stan/math/rev/functor/ode_adams.hpp>
 #include <stan/math/rev/functor/ode_bdf.hpp>
 #include <stan/math/rev/functor/ode_adjoint.hpp>
+#include <stan/math/rev/functor/ode_batch.hpp>
+#include <stan/math/rev/functor/ode_events.hpp>
+#include <stan/math/rev/functor/ode_jacobian.hpp>
+#include <stan/math/rev/functor/ode_linear.hpp>
 #include <stan/math/rev/functor/ode_store_sensitivities.hpp>
 #include <stan/math/rev/functor/jacobian.hpp>
+#include <stan/math/rev/functor/jacobian_bandwidth.hpp>
 #include <stan/math/rev/functor/kinsol_data.hpp>
 #include <stan/math/rev/functor/kinsol_solve.hpp>
 #include <stan/math/rev/functor/map_rect_concurrent.hpp>
@@ -28,6 +35,7 @@
 #include <stan/math/rev/functor/operands_and_partials.hpp>
 #include <stan/math/rev/functor/partials_propagator.hpp>
 #include <stan/math/rev/functor/reduce_sum.hpp>
+#include <stan/math/rev/functor/sundials_service_pool.hpp>
 #include <stan/math/rev/functor/finite_diff_hessian_auto.hpp>
 #include <stan/math/rev/functor/finite_diff_hessian_times_vector_auto.hpp>
 
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <iostream>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace stan {
@@ -134,25 +135,27 @@ struct KinsolFixedPointEnv {
 };
 
 /**
- * Calculate Jacobian Jxy(Jacobian of unknown x w.r.t. the * param y)
- * given the solution. Specifically, for
+ * Calculate the gradients of the solution x w.r.t. the param y with the
+ * adjoint method. Specifically, for
  *
  *  x - f(x, y) = 0
  *
- * we have (Jpq = Jacobian matrix dq/dq)
+ * we have (Jpq = Jacobian matrix dq/dp)
  *
  * Jxy - Jfx * Jxy = Jfy
  *
- * therefore Jxy can be solved from system
+ * therefore Jxy = (I - Jfx)^{-1} * Jfy. Instead of forming Jxy, the adjoint
+ * of the solution is propagated in the reverse pass as
  *
- * (I - Jfx) * Jxy = Jfy
+ * y_adj += Jfy^T * eta, (I - Jfx)^T * eta = x_adj,
  *
- * Jfx and Jfy are obtained through one AD evaluation of f
- * w.r.t combined vector [x, y].
+ * which needs one solve with the QR factorization of (I - Jfx)^T made in the
+ * forward pass and one nested reverse pass through f. The cost of the
+ * gradient does not depend on the number of parameters.
  */
 struct FixedPointADJac {
   /**
-   * Calculate Jacobian Jxy.
+   * Return the solution as vars and register the adjoint reverse pass.
    *
    * @tparam F RHS functor type
    * @param x fixed point solution
@@ -163,38 +166,42 @@ struct FixedPointADJac {
   inline Eigen::Matrix<stan::math::var, -1, 1> operator()(
       const Eigen::VectorXd& x, const Eigen::Matrix<stan::math::var, -1, 1>& y,
       KinsolFixedPointEnv<F>& env) {
-    using stan::math::precomputed_gradients;
-    using stan::math::to_array_1d;
     using stan::math::var;
 
-    auto g = [&env](const Eigen::Matrix<var, -1, 1>& par_) {
-      Eigen::Matrix<var, -1, 1> x_(par_.head(env.N_));
-      Eigen::Matrix<var, -1, 1> y_(par_.tail(env.M_));
-      return env.f_(x_, y_, env.x_r_, env.x_i_, env.msgs_);
+    auto f_wrt_x = [&env](const Eigen::Matrix<var, -1, 1>& x_) {
+      return env.f_(x_, env.y_, env.x_r_, env.x_i_, env.msgs_);
     };
+    Eigen::VectorXd fx;
+    Eigen::MatrixXd J_x;
+    stan::math::jacobian(f_wrt_x, x, fx, J_x);
+    auto A_T_qr_ptr = make_unsafe_chainable_ptr(
+        (Eigen::MatrixXd::Identity(env.N_, env.N_) - J_x)
+            .transpose()
+            .colPivHouseholderQr());
 
-    Eigen::VectorXd theta(x.size() + y.size());
-    for (int i = 0; i < env.N_; ++i) {
-      theta(i) = x(i);
-    }
-    for (int i = 0; i < env.M_; ++i) {
-      theta(i + env.N_) = env.y_(i);
-    }
-    Eigen::Matrix<double, -1, 1> fx;
-    Eigen::Matrix<double, -1, -1> J_theta;
-    stan::math::jacobian(g, theta, fx, J_theta);
-    Eigen::MatrixXd A(J_theta.block(0, 0, env.N_, env.N_));
-    Eigen::MatrixXd b(J_theta.block(0, env.N_, env.N_, env.M_));
-    A = Eigen::MatrixXd::Identity(env.N_, env.N_) - A;
-    Eigen::MatrixXd Jxy = A.colPivHouseholderQr().solve(b);
-    std::vector<double> gradients(env.M_);
-    Eigen::Matrix<var, -1, 1> x_sol(env.N_);
-    std::vector<stan::math::var> yv(to_array_1d(y));
-    for (int i = 0; i < env.N_; ++i) {
-      gradients = to_array_1d(Eigen::VectorXd(Jxy.row(i)));
-      x_sol[i] = precomputed_gradients(x(i), yv, gradients);
-    }
-    return x_sol;
+    arena_t<Eigen::Matrix<var, -1, 1>> x_sol = x;
+    arena_t<Eigen::Matrix<var, -1, 1>> arena_y = y;
+    arena_t<Eigen::VectorXd> y_val = env.y_;
+    auto data_ptr = make_chainable_ptr(std::make_tuple(env.x_r_, env.x_i_));
+    reverse_pass_callback([f = env.f_, x_sol, arena_y, y_val, data_ptr,
+                           msgs = env.msgs_, A_T_qr_ptr]() mutable {
+      Eigen::VectorXd eta = A_T_qr_ptr->solve(x_sol.adj().eval());
+
+      // Contract with Jacobian of f with respect to y using a nested reverse
+      // autodiff pass.
+      {
+        nested_rev_autodiff rev;
+
+        Eigen::VectorXd x_val = x_sol.val();
+        Eigen::Matrix<var, -1, 1> y_ = y_val;
+        Eigen::Matrix<var, -1, 1> fx_nested = f(
+            x_val, y_, std::get<0>(*data_ptr), std::get<1>(*data_ptr), msgs);
+        fx_nested.adj() = eta;
+        grad();
+        arena_y.adj() += y_.adj();
+      }
+    });
+    return Eigen::Matrix<var, -1, 1>(x_sol);
   }
 };
 
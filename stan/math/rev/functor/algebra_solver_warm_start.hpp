@@ -0,0 +1,165 @@
+#ifndef STAN_MATH_REV_FUNCTOR_ALGEBRA_SOLVER_WARM_START_HPP
+#define STAN_MATH_REV_FUNCTOR_ALGEBRA_SOLVER_WARM_START_HPP
+
+#include <stan/math/rev/functor/kinsol_data.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace stan {
+namespace math {
+
+/**
+ * Solution cache of one call site of <code>solve_newton_tol</code> or
+ * <code>solve_powell_tol</code>.
+ *
+ * Successive solves from the same call site, e.g. in the leapfrog steps
+ * of HMC, see nearly identical parameters. Passing the same cache to each
+ * of them starts every solve after the first from the previous converged
+ * solution instead of the user provided initial guess. The Newton solver
+ * additionally keeps its KINSOL memory in the cache and starts from the
+ * factorized Jacobian of the previous solve, which KINSOL updates as
+ * usual once the convergence degrades.
+ *
+ * A warm started solve that fails is retried from the initial guess, so
+ * the cache never turns a solvable problem into an error, and solutions
+ * from a warm and a cold cache agree to within the solver tolerances.
+ *
+ * The cache is not thread safe; every thread needs its own.
+ */
+class algebra_solver_warm_start {
+  Eigen::VectorXd solution_;
+  bool warm_{false};
+  std::unique_ptr<kinsol_workspace> kinsol_workspace_;
+  bool kinsol_jacobian_current_{false};
+  std::size_t num_cold_solves_{0};
+  std::size_t num_warm_solves_{0};
+  std::int64_t num_cold_iterations_{0};
+  std::int64_t num_warm_iterations_{0};
+
+ public:
+  /**
+   * Returns true if the next solve for unknowns of the size of \p x
+   * starts from a cached solution.
+   *
+   * @param x initial guess provided by the user
+   */
+  bool is_warm(const Eigen::VectorXd& x) const {
+    return warm_ && solution_.size() == x.size();
+  }
+
+  /**
+   * Returns the starting point of the next solve, which is the cached
+   * solution if there is one of matching size and \p x otherwise.
+   *
+   * @param x initial guess provided by the user
+   */
+  const Eigen::VectorXd& initial_guess(const Eigen::VectorXd& x) const {
+    return is_warm(x) ? solution_ : x;
+  }
+
+  /**
+   * Returns the KINSOL workspace of the cache for \p N unknowns,
+   * replacing the workspace of a different size.
+   *
+   * @param N number of unknowns
+   */
+  kinsol_workspace& kinsol_memory(std::size_t N) {
+    if (!kinsol_workspace_ || kinsol_workspace_->N_ != N) {
+      kinsol_workspace_ = std::make_unique<kinsol_workspace>(N);
+      kinsol_jacobian_current_ = false;
+    }
+    return *kinsol_workspace_;
+  }
+
+  /**
+   * Returns true if the linear solver of the KINSOL workspace holds the
+   * factorized Jacobian of the last solve of this cache.
+   */
+  bool kinsol_jacobian_current() const { return kinsol_jacobian_current_; }
+
+  /**
+   * Store the solution of a successful solve.
+   *
+   * @param solution solution of the algebraic system
+   * @param num_iterations number of nonlinear iterations of the solve
+   * @param warm whether the solve started from the cached solution
+   * @param kinsol_jacobian_current whether the KINSOL workspace holds the
+   * factorized Jacobian of the solve
+   */
+  void store(const Eigen::VectorXd& solution, std::int64_t num_iterations,
+             bool warm, bool kinsol_jacobian_current) {
+    solution_ = solution;
+    warm_ = true;
+    kinsol_jacobian_current_ = kinsol_jacobian_current;
+    if (warm) {
+      ++num_warm_solves_;
+      num_warm_iterations_ += num_iterations;
+    } else {
+      ++num_cold_solves_;
+      num_cold_iterations_ += num_iterations;
+    }
+  }
+
+  /**
+   * Forget the cached solution, e.g. after a failed solve. The KINSOL
+   * memory and the counters are kept.
+   */
+  void reset() {
+    warm_ = false;
+    kinsol_jacobian_current_ = false;
+  }
+
+  /**
+   * Forget the cached solution and reset the counters.
+   */
+  void clear() {
+    reset();
+    num_cold_solves_ = 0;
+    num_warm_solves_ = 0;
+    num_cold_iterations_ = 0;
+    num_warm_iterations_ = 0;
+  }
+
+  /**
+   * Returns the number of successful solves that started from the initial
+   * guess.
+   */
+  std::size_t num_cold_solves() const { return num_cold_solves_; }
+
+  /**
+   * Returns the number of successful solves that started from the cached
+   * solution.
+   */
+  std::size_t num_warm_solves() const { return num_warm_solves_; }
+
+  /**
+   * Returns the number of nonlinear iterations of the cold solves.
+   */
+  std::int64_t num_cold_iterations() const { return num_cold_iterations_; }
+
+  /**
+   * Returns the number of nonlinear iterations of the warm solves.
+   */
+  std::int64_t num_warm_iterations() const { return num_warm_iterations_; }
+
+  /**
+   * Returns the estimated number of nonlinear iterations saved by warm
+   * starts, assuming every warm solve would have needed the average
+   * number of iterations of the cold solves. Returns zero if there were
+   * no cold solves.
+   */
+  double iterations_saved() const {
+    if (num_cold_solves_ == 0) {
+      return 0.0;
+    }
+    const double cold_average
+        = static_cast<double>(num_cold_iterations_) / num_cold_solves_;
+    return cold_average * num_warm_solves_ - num_warm_iterations_;
+  }
+};
+
+}  // namespace math
+}  // namespace stan
+#endif
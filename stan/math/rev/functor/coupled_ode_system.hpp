@@ -3,11 +3,11 @@
 
 #include <stan/math/prim/functor/coupled_ode_system.hpp>
 #include <stan/math/rev/functor/cvodes_utils.hpp>
+#include <stan/math/rev/functor/ode_jacobian.hpp>
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
 #include <stan/math/rev/fun/value_of.hpp>
 #include <stan/math/prim/functor/apply.hpp>
-#include <stan/math/prim/functor/for_each.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stdexcept>
 #include <ostream>
@@ -59,6 +59,11 @@ namespace math {
  * parameter vector part of the nochain autodiff tape and is therefore
  * set to zero separately.
  *
+ * <p>If only the initial state is an autodiff type and the functor
+ * provides its Jacobian or Jacobian-vector products (see
+ * <code>has_ode_jacobian</code>), the sensitivities are propagated with
+ * those and no autodiff is done.
+ *
  * @tparam F base ode system functor. Must provide
  *   <code>
  *     template<typename T_y, typename... T_args>
@@ -74,10 +79,16 @@ struct coupled_ode_system_impl<false, F, T_y0, Args...> {
   const size_t num_y0_vars_;
   const size_t num_args_vars;
   const size_t N_;
-  Eigen::VectorXd args_adjoints_;
-  Eigen::VectorXd y_adjoints_;
+  std::vector<vari*> args_varis_;
+  Eigen::MatrixXd jacobian_y_;
+  Eigen::MatrixXd jacobian_args_;
   std::ostream* msgs_;
 
+  static constexpr bool use_state_jacobian
+      = !is_var<return_type_t<Args...>>::value
+        && (has_ode_jacobian<F, Args...>::value
+            || has_ode_jacobian_vector_product<F, Args...>::value);
+
   /**
    * Construct a coupled ode system from the base system function,
    * initial state of the base system, parameters, and a stream for
@@ -97,9 +108,14 @@ struct coupled_ode_system_impl<false, F, T_y0, Args...> {
         num_y0_vars_(count_vars(y0_)),
         num_args_vars(count_vars(args...)),
         N_(y0.size()),
-        args_adjoints_(num_args_vars),
-        y_adjoints_(N_),
-        msgs_(msgs) {}
+        args_varis_(num_args_vars),
+        jacobian_y_(N_, N_),
+        jacobian_args_(N_, num_args_vars),
+        msgs_(msgs) {
+    math::apply(
+        [&](auto&&... args) { save_varis(args_varis_.data(), args...); },
+        local_args_tuple_);
+  }
 
   /**
    * Calculates the right hand side of the coupled ode system (the regular
@@ -119,6 +135,21 @@ struct coupled_ode_system_impl<false, F, T_y0, Args...> {
 
     dz_dt.resize(size());
 
+    if constexpr (use_state_jacobian) {
+      const Eigen::VectorXd y = Eigen::Map<const Eigen::VectorXd>(z.data(), N_);
+      const Eigen::VectorXd f_y_t = math::apply(
+          [&](auto&&... args) { return f_(t, y, msgs_, args...); },
+          local_args_tuple_);
+      check_size_match("coupled_ode_system", "dy_dt", f_y_t.size(), "states",
+                       N_);
+      Eigen::Map<Eigen::VectorXd>(dz_dt.data(), N_) = f_y_t;
+      Eigen::Map<const Eigen::MatrixXd> sens(z.data() + N_, N_, num_y0_vars_);
+      Eigen::Map<Eigen::MatrixXd>(dz_dt.data() + N_, N_, num_y0_vars_)
+          = ode_state_jacobian_product(f_, t, y, sens, msgs_,
+                                       local_args_tuple_);
+      return;
+    }
+
     // Run nested autodiff in this scope
     nested_rev_autodiff nested;
 
@@ -133,56 +164,35 @@ struct coupled_ode_system_impl<false, F, T_y0, Args...> {
     check_size_match("coupled_ode_system", "dy_dt", f_y_t_vars.size(), "states",
                      N_);
 
+    // One reverse sweep per state gives a row of the Jacobians of the ODE
+    // RHS with respect to the states and the parameters
     for (size_t i = 0; i < N_; ++i) {
       dz_dt[i] = f_y_t_vars.coeffRef(i).val();
       f_y_t_vars.coeffRef(i).grad();
 
-      y_adjoints_ = y_vars.adj();
-
-      if (args_adjoints_.size() > 0) {
-        memset(args_adjoints_.data(), 0,
-               sizeof(double) * args_adjoints_.size());
-      }
-
-      math::apply(
-          [&](auto&&... args) {
-            accumulate_adjoints(args_adjoints_.data(), args...);
-          },
-          local_args_tuple_);
+      jacobian_y_.row(i) = y_vars.adj().transpose();
 
       // The vars here do not live on the nested stack so must be zero'd
       // separately
-      stan::math::for_each([](auto&& arg) { zero_adjoints(arg); },
-                           local_args_tuple_);
+      for (size_t j = 0; j < num_args_vars; ++j) {
+        jacobian_args_.coeffRef(i, j) = args_varis_[j]->adj_;
+        args_varis_[j]->set_zero_adjoint();
+      }
 
       // No need to zero adjoints after last sweep
       if (i + 1 < N_) {
         nested.set_zero_all_adjoints();
       }
-
-      // Compute the right hand side for the sensitivities with respect to the
-      // initial conditions
-      for (size_t j = 0; j < num_y0_vars_; ++j) {
-        double temp_deriv = 0.0;
-        for (size_t k = 0; k < N_; ++k) {
-          temp_deriv += z[N_ + N_ * j + k] * y_adjoints_.coeffRef(k);
-        }
-
-        dz_dt[N_ + N_ * j + i] = temp_deriv;
-      }
-
-      // Compute the right hand size for the sensitivities with respect to the
-      // parameters
-      for (size_t j = 0; j < num_args_vars; ++j) {
-        double temp_deriv = args_adjoints_.coeffRef(j);
-        for (size_t k = 0; k < N_; ++k) {
-          temp_deriv += z[N_ + N_ * num_y0_vars_ + N_ * j + k]
-                        * y_adjoints_.coeffRef(k);
-        }
-
-        dz_dt[N_ + N_ * num_y0_vars_ + N_ * j + i] = temp_deriv;
-      }
     }
+
+    // The sensitivities are stored column major, one column of size N per
+    // initial condition followed by one per parameter, so their right hand
+    // side is J_y * S + [0, J_args]
+    const size_t num_sens = num_y0_vars_ + num_args_vars;
+    Eigen::Map<const Eigen::MatrixXd> sens(z.data() + N_, N_, num_sens);
+    Eigen::Map<Eigen::MatrixXd> dsens_dt(dz_dt.data() + N_, N_, num_sens);
+    dsens_dt.noalias() = jacobian_y_ * sens;
+    dsens_dt.rightCols(num_args_vars) += jacobian_args_;
   }
 
   /**
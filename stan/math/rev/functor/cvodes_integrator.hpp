@@ -4,14 +4,16 @@
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/functor/cvodes_utils.hpp>
 #include <stan/math/rev/functor/coupled_ode_system.hpp>
+#include <stan/math/rev/functor/cvodes_service.hpp>
+#include <stan/math/rev/functor/jacobian_bandwidth.hpp>
+#include <stan/math/rev/functor/ode_jacobian.hpp>
 #include <stan/math/rev/functor/ode_store_sensitivities.hpp>
+#include <stan/math/rev/functor/sundials_service_pool.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/functor/apply.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
-#include <sundials/sundials_context.h>
 #include <cvodes/cvodes.h>
 #include <nvector/nvector_serial.h>
-#include <sunlinsol/sunlinsol_dense.h>
 #include <algorithm>
 #include <ostream>
 #include <vector>
@@ -37,7 +39,6 @@ class cvodes_integrator {
   using T_y0_t0 = return_type_t<T_y0, T_t0>;
 
   const char* function_name_;
-  sundials::Context sundials_context_;
   const F& f_;
   const Eigen::Matrix<T_y0_t0, Eigen::Dynamic, 1> y0_;
   const T_t0 t0_;
@@ -57,10 +58,8 @@ class cvodes_integrator {
   coupled_ode_system<F, T_y0_t0, T_Args...> coupled_ode_;
 
   std::vector<double> coupled_state_;
-  N_Vector nv_state_;
-  N_Vector* nv_state_sens_;
-  SUNMatrix A_;
-  SUNLinearSolver LS_;
+  cvodes_callbacks callbacks_;
+  jacobian_bandwidth bandwidth_;
 
   /**
    * Implements the function of type CVRhsFn which is the user-defined
@@ -88,7 +87,7 @@ class cvodes_integrator {
    * Implements the function of type CVDlsJacFn which is the
    * user-defined callback for CVODES to calculate the jacobian of the
    * ode_rhs wrt to the states y. The jacobian is stored in column
-   * major format.
+   * major format, or in band format if the workspace is banded.
    */
   static int cv_jacobian_states(realtype t, N_Vector y, N_Vector fy,
                                 SUNMatrix J, void* user_data, N_Vector tmp1,
@@ -117,20 +116,24 @@ class cvodes_integrator {
 
   /**
    * Calculates the jacobian of the ODE RHS wrt to its states y at the
-   * given time-point t and state y.
+   * given time-point t and state y, with the Jacobian provided by the RHS
+   * functor if it has one (see <code>ode_state_jacobian</code>).
    */
   inline void jacobian_states(double t, const double y[], SUNMatrix J) const {
-    Eigen::VectorXd fy;
-    Eigen::MatrixXd Jfy;
-
-    auto f_wrapped = [&](const Eigen::Matrix<var, Eigen::Dynamic, 1>& y) {
-      return math::apply(
-          [&](auto&&... args) { return f_(t, y, msgs_, args...); },
-          value_of_args_tuple_);
-    };
-
-    jacobian(f_wrapped, Eigen::Map<const Eigen::VectorXd>(y, N_), fy, Jfy);
+    const Eigen::MatrixXd Jfy = ode_state_jacobian(
+        function_name_, f_, t, Eigen::Map<const Eigen::VectorXd>(y, N_), msgs_,
+        value_of_args_tuple_);
 
+    if (SUNMatGetID(J) == SUNMATRIX_BAND) {
+      const int N = N_;
+      for (int j = 0; j < N; ++j) {
+        const int i_end = std::min(N - 1, j + bandwidth_.lower);
+        for (int i = std::max(0, j - bandwidth_.upper); i <= i_end; ++i) {
+          SM_ELEMENT_B(J, i, j) = Jfy(i, j);
+        }
+      }
+      return;
+    }
     for (size_t j = 0; j < Jfy.cols(); ++j) {
       for (size_t i = 0; i < Jfy.rows(); ++i) {
         SM_ELEMENT_D(J, i, j) = Jfy(i, j);
@@ -194,7 +197,6 @@ class cvodes_integrator {
                     long int max_num_steps,  // NOLINT(runtime/int)
                     std::ostream* msgs, const T_Args&... args)
       : function_name_(function_name),
-        sundials_context_(),
         f_(f),
         y0_(y0.template cast<T_y0_t0>()),
         t0_(t0),
@@ -209,7 +211,11 @@ class cvodes_integrator {
         num_y0_vars_(count_vars(y0_)),
         num_args_vars_(count_vars(args...)),
         coupled_ode_(f, y0_, msgs, args...),
-        coupled_state_(coupled_ode_.initial_state()) {
+        coupled_state_(coupled_ode_.initial_state()),
+        callbacks_{this, &cvodes_integrator::cv_rhs,
+                   &cvodes_integrator::cv_rhs_sens,
+                   &cvodes_integrator::cv_jacobian_states},
+        bandwidth_{static_cast<int>(N_) - 1, static_cast<int>(N_) - 1} {
     check_finite(function_name, "initial state", y0_);
     check_finite(function_name, "initial time", t0_);
     check_finite(function_name, "times", ts_);
@@ -234,103 +240,147 @@ class cvodes_integrator {
                           absolute_tolerance_);
     check_positive(function_name, "max_num_steps", max_num_steps_);
 
-    nv_state_ = N_VMake_Serial(N_, &coupled_state_[0], sundials_context_);
-    nv_state_sens_ = nullptr;
-    A_ = SUNDenseMatrix(N_, N_, sundials_context_);
-    LS_ = SUNLinSol_Dense(nv_state_, A_, sundials_context_);
-
-    if (num_y0_vars_ + num_args_vars_ > 0) {
-      nv_state_sens_
-          = N_VCloneEmptyVectorArray(num_y0_vars_ + num_args_vars_, nv_state_);
-      for (std::size_t i = 0; i < num_y0_vars_ + num_args_vars_; i++) {
-        NV_DATA_S(nv_state_sens_[i]) = &coupled_state_[N_] + i * N_;
-      }
+    if (N_ >= jacobian_band_min_states) {
+      bandwidth_ = detect_jacobian_bandwidth(
+          [&](const Eigen::Matrix<var, Eigen::Dynamic, 1>& y) {
+            return math::apply(
+                [&](auto&&... args) {
+                  return f_(value_of(t0_), y, msgs_, args...);
+                },
+                value_of_args_tuple_);
+          },
+          value_of(y0_), N_);
     }
   }
 
-  ~cvodes_integrator() {
-    SUNLinSolFree(LS_);
-    SUNMatDestroy(A_);
-    N_VDestroy_Serial(nv_state_);
-    if (num_y0_vars_ + num_args_vars_ > 0) {
-      N_VDestroyVectorArray(nv_state_sens_, num_y0_vars_ + num_args_vars_);
-    }
-  }
+  cvodes_integrator(const cvodes_integrator&) = delete;
+  cvodes_integrator& operator=(const cvodes_integrator&) = delete;
 
   /**
-   * Solve the ODE initial value problem y' = f(t, y), y(t0) = y0 at a set of
-   * times, { t1, t2, t3, ... } using the stiff backward differentiation formula
-   * (BDF) solver in CVODES.
-   *
-   * @return std::vector of Eigen::Matrix of the states of the ODE, one for each
-   *   solution time (excluding the initial state)
+   * Returns the number of forward sensitivities of the ODE system, which
+   * together with the number of states determines the CVODES workspace
+   * needed to solve it.
    */
-  std::vector<Eigen::Matrix<T_Return, Eigen::Dynamic, 1>> operator()() {
-    std::vector<Eigen::Matrix<T_Return, Eigen::Dynamic, 1>> y;
-
-    void* cvodes_mem = CVodeCreate(Lmm, sundials_context_);
-    if (cvodes_mem == nullptr) {
-      throw std::runtime_error("CVodeCreate failed to allocate memory");
-    }
+  size_t num_sensitivities() const { return num_y0_vars_ + num_args_vars_; }
 
-    try {
-      CHECK_CVODES_CALL(CVodeInit(cvodes_mem, &cvodes_integrator::cv_rhs,
-                                  value_of(t0_), nv_state_));
+  /**
+   * Returns the bandwidth of the Jacobian of the ODE right hand side with
+   * respect to the states, detected at the initial state. Systems whose
+   * band is narrow are solved with a banded linear solver.
+   */
+  const jacobian_bandwidth& bandwidth() const { return bandwidth_; }
 
-      // Assign pointer to this as user data
-      CHECK_CVODES_CALL(
-          CVodeSetUserData(cvodes_mem, reinterpret_cast<void*>(this)));
+  /**
+   * Solve the ODE initial value problem with the given CVODES workspace
+   * and return the values of the coupled ODE system, the states followed
+   * by their sensitivities, at every solution time. No autodiff variables
+   * are created.
+   *
+   * @param service CVODES memory and workspace with <code>N</code> states,
+   *   <code>num_sensitivities()</code> sensitivities and the Jacobian
+   *   bandwidth <code>bandwidth()</code>
+   * @return std::vector of coupled states, one for each solution time
+   */
+  std::vector<std::vector<double>> integrate(cvodes_service<Lmm>& service) {
+    return integrate(service, {}, [](size_t, std::vector<double>&) {});
+  }
 
-      cvodes_set_options(cvodes_mem, max_num_steps_);
+  /**
+   * Solve the ODE initial value problem with the given CVODES workspace
+   * with discontinuities at the given event times and return the values
+   * of the coupled ODE system at every solution time.
+   *
+   * The solver stops exactly at every event time, where
+   * <code>jump(e, coupled_state)</code> may change the coupled state and
+   * the right hand side for event <code>e</code>. The solver is then
+   * reinitialized at the event time with <code>CVodeReInit</code>, which
+   * keeps the workspace and options, so that no step crosses a
+   * discontinuity. The solution at an output time equal to an event time
+   * is taken before the event, and events at or after the last output
+   * time are ignored.
+   *
+   * @tparam Jump type of event callback
+   * @param service CVODES memory and workspace with <code>N</code> states,
+   *   <code>num_sensitivities()</code> sensitivities and the Jacobian
+   *   bandwidth <code>bandwidth()</code>
+   * @param event_times sorted event times, not less than the initial time
+   * @param jump callback applying an event to the coupled state
+   * @return std::vector of coupled states, one for each solution time
+   */
+  template <typename Jump>
+  std::vector<std::vector<double>> integrate(
+      cvodes_service<Lmm>& service, const std::vector<double>& event_times,
+      const Jump& jump) {
+    std::vector<std::vector<double>> coupled_states;
+    coupled_states.reserve(ts_.size());
+
+    double t_init = value_of(t0_);
+    const double t_last = value_of(ts_.back());
+    size_t e = 0;
+    for (; e < event_times.size() && event_times[e] <= t_init; ++e) {
+      jump(e, coupled_state_);
+    }
 
-      CHECK_CVODES_CALL(CVodeSStolerances(cvodes_mem, relative_tolerance_,
-                                          absolute_tolerance_));
+    service.reinit(&callbacks_, t_init, coupled_state_.data());
+    void* cvodes_mem = service.mem();
+    cvodes_set_options(cvodes_mem, max_num_steps_);
+    CHECK_CVODES_CALL(CVodeSStolerances(cvodes_mem, relative_tolerance_,
+                                        absolute_tolerance_));
 
-      CHECK_CVODES_CALL(CVodeSetLinearSolver(cvodes_mem, LS_, A_));
+    auto advance = [&](double t_final) {
+      if (t_final == t_init) {
+        return;
+      }
+      if (e < event_times.size() && event_times[e] < t_last) {
+        service.set_stop_time(event_times[e]);
+      }
       CHECK_CVODES_CALL(
-          CVodeSetJacFn(cvodes_mem, &cvodes_integrator::cv_jacobian_states));
+          CVode(cvodes_mem, t_final, service.state(), &t_init, CV_NORMAL));
 
-      // initialize forward sensitivity system of CVODES as needed
-      if (num_y0_vars_ + num_args_vars_ > 0) {
-        CHECK_CVODES_CALL(CVodeSensInit(
-            cvodes_mem, static_cast<int>(num_y0_vars_ + num_args_vars_),
-            CV_STAGGERED, &cvodes_integrator::cv_rhs_sens, nv_state_sens_));
-
-        CHECK_CVODES_CALL(CVodeSetSensErrCon(cvodes_mem, SUNTRUE));
-
-        CHECK_CVODES_CALL(CVodeSensEEtolerances(cvodes_mem));
+      if (num_sensitivities() > 0) {
+        CHECK_CVODES_CALL(
+            CVodeGetSens(cvodes_mem, &t_init, service.state_sens()));
       }
+      service.get_coupled_state(coupled_state_.data());
+      t_init = t_final;
+    };
 
-      double t_init = value_of(t0_);
-      for (size_t n = 0; n < ts_.size(); ++n) {
-        double t_final = value_of(ts_[n]);
-
-        if (t_final != t_init) {
-          CHECK_CVODES_CALL(
-              CVode(cvodes_mem, t_final, nv_state_, &t_init, CV_NORMAL));
-
-          if (num_y0_vars_ + num_args_vars_ > 0) {
-            CHECK_CVODES_CALL(
-                CVodeGetSens(cvodes_mem, &t_init, nv_state_sens_));
-          }
-        }
-
-        y.emplace_back(math::apply(
-            [&](auto&&... args) {
-              return ode_store_sensitivities(f_, coupled_state_, y0_, t0_,
-                                             ts_[n], msgs_, args...);
-            },
-            args_tuple_));
-
-        t_init = t_final;
+    for (size_t n = 0; n < ts_.size(); ++n) {
+      const double t_final = value_of(ts_[n]);
+      for (; e < event_times.size() && event_times[e] < t_final; ++e) {
+        advance(event_times[e]);
+        jump(e, coupled_state_);
+        service.reinit(&callbacks_, t_init, coupled_state_.data());
       }
-    } catch (const std::exception& e) {
-      CVodeFree(&cvodes_mem);
-      throw;
+      advance(t_final);
+      coupled_states.push_back(coupled_state_);
     }
+    return coupled_states;
+  }
 
-    CVodeFree(&cvodes_mem);
+  /**
+   * Solve the ODE initial value problem y' = f(t, y), y(t0) = y0 at a set of
+   * times, { t1, t2, t3, ... } using the stiff backward differentiation formula
+   * (BDF) solver in CVODES.
+   *
+   * @return std::vector of Eigen::Matrix of the states of the ODE, one for each
+   *   solution time (excluding the initial state)
+   */
+  std::vector<Eigen::Matrix<T_Return, Eigen::Dynamic, 1>> operator()() {
+    const std::vector<std::vector<double>> coupled_states = integrate(
+        *sundials_service_pool<cvodes_service<Lmm>>::instance().acquire(
+            N_, num_sensitivities(), bandwidth_.lower, bandwidth_.upper));
 
+    std::vector<Eigen::Matrix<T_Return, Eigen::Dynamic, 1>> y;
+    y.reserve(ts_.size());
+    for (size_t n = 0; n < ts_.size(); ++n) {
+      y.emplace_back(math::apply(
+          [&](auto&&... args) {
+            return ode_store_sensitivities(f_, coupled_states[n], y0_, t0_,
+                                           ts_[n], msgs_, args...);
+          },
+          args_tuple_));
+    }
     return y;
   }
 };  // cvodes integrator
@@ -4,7 +4,9 @@
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core/save_varis.hpp>
 #include <stan/math/rev/functor/cvodes_utils.hpp>
+#include <stan/math/rev/functor/ode_jacobian.hpp>
 #include <stan/math/rev/functor/ode_store_sensitivities.hpp>
+#include <stan/math/rev/functor/sundials_service_pool.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
 #include <stan/math/prim/functor/apply.hpp>
@@ -15,12 +17,51 @@
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunlinsol/sunlinsol_dense.h>
 #include <algorithm>
+#include <cmath>
 #include <ostream>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 namespace stan {
 namespace math {
+namespace internal {
+
+/**
+ * Returns the number of integrator steps between the checkpoints of the
+ * CVODES adjoint solver which minimizes the memory of a forward pass of
+ * \p num_steps steps.
+ *
+ * CVODES stores the interpolation data of the steps between two
+ * checkpoints, two vectors of size N per step for Hermite and one for
+ * polynomial interpolation, and at every checkpoint up to qmax + 1
+ * vectors of the Nordsieck history, where qmax is 5 for BDF and 12 for
+ * Adams. With d steps between checkpoints the memory is proportional to
+ * <code>k_interp d + k_check num_steps / d</code>, which is smallest for
+ * <code>d = sqrt(k_check num_steps / k_interp)</code>. The time of the
+ * backward pass does not depend on the spacing, since every forward step
+ * is recomputed once.
+ *
+ * @param num_steps number of steps of the forward pass
+ * @param solver_forward solver of the forward pass (CV_ADAMS or CV_BDF)
+ * @param interpolation_polynomial CV_HERMITE or CV_POLYNOMIAL
+ * @return number of steps between checkpoints
+ */
+inline long int adjoint_checkpoint_spacing(  // NOLINT(runtime/int)
+    long int num_steps, int solver_forward,  // NOLINT(runtime/int)
+    int interpolation_polynomial) {
+  const double k_interp = interpolation_polynomial == CV_HERMITE ? 2.0 : 1.0;
+  const double k_check = solver_forward == CV_ADAMS ? 13.0 : 6.0;
+  return std::max(1L, std::lround(std::sqrt(k_check * num_steps / k_interp)));
+}
+
+/**
+ * Number of steps between checkpoints of the first solve with automatic
+ * checkpoint spacing.
+ */
+constexpr long int adjoint_default_checkpoint_spacing = 150;  // NOLINT
+
+}  // namespace internal
 
 /**
  * Integrator interface for CVODES' adjoint ODE solvers (Adams & BDF
@@ -47,6 +88,10 @@ class cvodes_integrator_adjoint_vari : public vari_base {
   static constexpr bool is_var_return_{is_var<T_Return>::value};
   static constexpr bool is_var_only_ts_{
       is_var_ts_ && !(is_var_t0_ || is_var_y0_t0_ || is_any_var_args_)};
+  static constexpr bool has_jacobian_{
+      has_ode_jacobian<std::decay_t<F>,
+                       promote_scalar_t<partials_type_t<scalar_type_t<T_Args>>,
+                                        T_Args>...>::value};
 
   const size_t num_args_vars_;
 
@@ -58,6 +103,10 @@ class cvodes_integrator_adjoint_vari : public vari_base {
   const long int num_steps_between_checkpoints_;  // NOLINT(runtime/int)
   const size_t N_;
   std::ostream* msgs_;
+  /**
+   * States of the forward solution at the output times, column by column.
+   */
+  arena_t<Eigen::MatrixXd> y_;
   vari** y_return_varis_;
   vari** args_varis_;
   const int interpolation_polynomial_;
@@ -67,24 +116,103 @@ class cvodes_integrator_adjoint_vari : public vari_base {
   bool backward_is_initialized_{false};
 
   /**
-   * Since the CVODES solver manages memory with malloc calls, these resources
-   * must be freed using a destructor call (which is not being called for the
-   * vari class).
+   * CVODES memory and workspace of the forward and backward problems. The
+   * callbacks are static members of this class, so workspaces are shared
+   * through <code>sundials_service_pool</code> between solves of the same
+   * ODE type, keyed by the number of states and parameters and the solver
+   * configuration. A reused workspace is reinitialized with
+   * <code>CVodeReInit</code>, <code>CVodeAdjReInit</code> and
+   * <code>CVodeReInitB</code>.
    */
-  struct cvodes_solver : public chainable_alloc {
+  struct cvodes_workspace {
+    using key_t = std::tuple<size_t, size_t, int, int, int,
+                             long int>;  // NOLINT(runtime/int)
+
     sundials::Context sundials_context_;
+    const size_t N_;
+    N_Vector nv_state_forward_;
+    N_Vector nv_state_backward_;
+    N_Vector nv_quad_;
+    N_Vector nv_absolute_tolerance_forward_;
+    N_Vector nv_absolute_tolerance_backward_;
+    SUNMatrix A_forward_;
+    SUNMatrix A_backward_;
+    SUNLinearSolver LS_forward_;
+    SUNLinearSolver LS_backward_;
+    void* cvodes_mem_;
+    bool forward_is_initialized_{false};
+    bool backward_is_created_{false};
+    int index_backward_{0};
+    /**
+     * Steps between checkpoints the adjoint memory was initialized with,
+     * and number of forward steps of the last solve.
+     */
+    long int checkpoint_spacing_{0};  // NOLINT(runtime/int)
+    long int num_steps_{0};           // NOLINT(runtime/int)
+
+    cvodes_workspace(size_t N, size_t num_args_vars, int solver_forward,
+                     int solver_backward, int interpolation_polynomial,
+                     long int num_steps_between_checkpoints)  // NOLINT
+        : sundials_context_(),
+          N_(N),
+          nv_state_forward_(N_VNew_Serial(N, sundials_context_)),
+          nv_state_backward_(N_VNew_Serial(N, sundials_context_)),
+          nv_quad_(N_VNew_Serial(num_args_vars, sundials_context_)),
+          nv_absolute_tolerance_forward_(N_VNew_Serial(N, sundials_context_)),
+          nv_absolute_tolerance_backward_(
+              N_VNew_Serial(N, sundials_context_)),
+          A_forward_(SUNDenseMatrix(N, N, sundials_context_)),
+          A_backward_(SUNDenseMatrix(N, N, sundials_context_)),
+          LS_forward_(N == 0 ? nullptr
+                             : SUNLinSol_Dense(nv_state_forward_, A_forward_,
+                                               sundials_context_)),
+          LS_backward_(N == 0 ? nullptr
+                              : SUNLinSol_Dense(nv_state_backward_, A_backward_,
+                                                sundials_context_)),
+          cvodes_mem_(CVodeCreate(solver_forward, sundials_context_)) {
+      if (cvodes_mem_ == nullptr) {
+        throw std::runtime_error("CVodeCreate failed to allocate memory");
+      }
+    }
+
+    cvodes_workspace(const cvodes_workspace&) = delete;
+    cvodes_workspace& operator=(const cvodes_workspace&) = delete;
+
+    ~cvodes_workspace() {
+      SUNMatDestroy(A_forward_);
+      SUNMatDestroy(A_backward_);
+      if (N_ > 0) {
+        SUNLinSolFree(LS_forward_);
+        SUNLinSolFree(LS_backward_);
+      }
+      N_VDestroy_Serial(nv_state_forward_);
+      N_VDestroy_Serial(nv_state_backward_);
+      N_VDestroy_Serial(nv_quad_);
+      N_VDestroy_Serial(nv_absolute_tolerance_forward_);
+      N_VDestroy_Serial(nv_absolute_tolerance_backward_);
+
+      CVodeFree(&cvodes_mem_);
+    }
+  };
+
+  /**
+   * Since the CVODES workspace must be returned to its pool, the solver
+   * must be destructed by a destructor call (which is not being called for
+   * the vari class).
+   */
+  struct cvodes_solver : public chainable_alloc {
     const std::string function_name_str_;
     const std::decay_t<F> f_;
     const size_t N_;
-    std::vector<Eigen::VectorXd> y_;
 
     std::vector<T_ts> ts_;
     Eigen::Matrix<T_y0_t0, Eigen::Dynamic, 1> y0_;
-    Eigen::VectorXd absolute_tolerance_forward_;
-    Eigen::VectorXd absolute_tolerance_backward_;
-    Eigen::VectorXd state_forward_;
-    Eigen::VectorXd state_backward_;
-    Eigen::VectorXd quad_;
+    typename sundials_service_pool<cvodes_workspace>::lease workspace_;
+    Eigen::Map<Eigen::VectorXd> absolute_tolerance_forward_;
+    Eigen::Map<Eigen::VectorXd> absolute_tolerance_backward_;
+    Eigen::Map<Eigen::VectorXd> state_forward_;
+    Eigen::Map<Eigen::VectorXd> state_backward_;
+    Eigen::Map<Eigen::VectorXd> quad_;
     T_t0 t0_;
 
     N_Vector nv_state_forward_;
@@ -108,62 +236,49 @@ class cvodes_integrator_adjoint_vari : public vari_base {
                   const Eigen::VectorXd& absolute_tolerance_forward,
                   const Eigen::VectorXd& absolute_tolerance_backward,
                   size_t num_args_vars, int solver_forward,
+                  int solver_backward, int interpolation_polynomial,
+                  long int num_steps_between_checkpoints,  // NOLINT
                   const T_Args&... args)
         : chainable_alloc(),
-          sundials_context_(),
           function_name_str_(function_name),
           f_(std::forward<FF>(f)),
           N_(N),
-          y_(ts.size()),
           ts_(ts.begin(), ts.end()),
           y0_(y0),
-          absolute_tolerance_forward_(absolute_tolerance_forward),
-          absolute_tolerance_backward_(absolute_tolerance_backward),
-          state_forward_(value_of(y0)),
-          state_backward_(Eigen::VectorXd::Zero(N)),
-          quad_(Eigen::VectorXd::Zero(num_args_vars)),
+          workspace_(
+              sundials_service_pool<cvodes_workspace>::instance().acquire(
+                  N, num_args_vars, solver_forward, solver_backward,
+                  interpolation_polynomial, num_steps_between_checkpoints)),
+          absolute_tolerance_forward_(
+              NV_DATA_S(workspace_->nv_absolute_tolerance_forward_), N),
+          absolute_tolerance_backward_(
+              NV_DATA_S(workspace_->nv_absolute_tolerance_backward_), N),
+          state_forward_(NV_DATA_S(workspace_->nv_state_forward_), N),
+          state_backward_(NV_DATA_S(workspace_->nv_state_backward_), N),
+          quad_(NV_DATA_S(workspace_->nv_quad_), num_args_vars),
           t0_(t0),
-          nv_state_forward_(
-              N_VMake_Serial(N, state_forward_.data(), sundials_context_)),
-          nv_state_backward_(
-              N_VMake_Serial(N, state_backward_.data(), sundials_context_)),
-          nv_quad_(
-              N_VMake_Serial(num_args_vars, quad_.data(), sundials_context_)),
-          nv_absolute_tolerance_forward_(N_VMake_Serial(
-              N, absolute_tolerance_forward_.data(), sundials_context_)),
-          nv_absolute_tolerance_backward_(N_VMake_Serial(
-              N, absolute_tolerance_backward_.data(), sundials_context_)),
-          A_forward_(SUNDenseMatrix(N, N, sundials_context_)),
-          A_backward_(SUNDenseMatrix(N, N, sundials_context_)),
-          LS_forward_(N == 0 ? nullptr
-                             : SUNLinSol_Dense(nv_state_forward_, A_forward_,
-                                               sundials_context_)),
-          LS_backward_(N == 0 ? nullptr
-                              : SUNLinSol_Dense(nv_state_backward_, A_backward_,
-                                                sundials_context_)),
-          cvodes_mem_(CVodeCreate(solver_forward, sundials_context_)),
+          nv_state_forward_(workspace_->nv_state_forward_),
+          nv_state_backward_(workspace_->nv_state_backward_),
+          nv_quad_(workspace_->nv_quad_),
+          nv_absolute_tolerance_forward_(
+              workspace_->nv_absolute_tolerance_forward_),
+          nv_absolute_tolerance_backward_(
+              workspace_->nv_absolute_tolerance_backward_),
+          A_forward_(workspace_->A_forward_),
+          A_backward_(workspace_->A_backward_),
+          LS_forward_(workspace_->LS_forward_),
+          LS_backward_(workspace_->LS_backward_),
+          cvodes_mem_(workspace_->cvodes_mem_),
           local_args_tuple_(deep_copy_vars(args)...),
           value_of_args_tuple_(value_of(args)...) {
-      if (cvodes_mem_ == nullptr) {
-        throw std::runtime_error("CVodeCreate failed to allocate memory");
-      }
+      absolute_tolerance_forward_ = absolute_tolerance_forward;
+      absolute_tolerance_backward_ = absolute_tolerance_backward;
+      state_forward_ = value_of(y0);
+      state_backward_.setZero();
+      quad_.setZero();
     }
 
-    virtual ~cvodes_solver() {
-      SUNMatDestroy(A_forward_);
-      SUNMatDestroy(A_backward_);
-      if (N_ > 0) {
-        SUNLinSolFree(LS_forward_);
-        SUNLinSolFree(LS_backward_);
-      }
-      N_VDestroy_Serial(nv_state_forward_);
-      N_VDestroy_Serial(nv_state_backward_);
-      N_VDestroy_Serial(nv_quad_);
-      N_VDestroy_Serial(nv_absolute_tolerance_forward_);
-      N_VDestroy_Serial(nv_absolute_tolerance_backward_);
-
-      CVodeFree(&cvodes_mem_);
-    }
+    virtual ~cvodes_solver() {}
   };
   cvodes_solver* solver_{nullptr};
 
@@ -195,11 +310,13 @@ class cvodes_integrator_adjoint_vari : public vari_base {
    * @param max_num_steps Upper limit on the number of integration steps to
    *   take between each output (error if exceeded)
    * @param num_steps_between_checkpoints Number of integrator steps after which
-   * a checkpoint is stored for the backward pass
+   * a checkpoint is stored for the backward pass, or 0 to choose the spacing
+   * which minimizes the checkpoint memory from the number of steps of the
+   * previous solve of the same system (see
+   * <code>internal::adjoint_checkpoint_spacing</code>)
    * @param interpolation_polynomial type of polynomial used for interpolation
    * @param solver_forward solver used for forward pass
    * @param solver_backward solver used for backward pass
-   *   take between each output (error if exceeded)
    * @param[in, out] msgs the print stream for warning messages
    * @param args Extra arguments passed unmodified through to ODE right hand
    * side function
@@ -230,6 +347,7 @@ class cvodes_integrator_adjoint_vari : public vari_base {
         num_steps_between_checkpoints_(num_steps_between_checkpoints),
         N_(y0.size()),
         msgs_(msgs),
+        y_(y0.size(), ts.size()),
         y_return_varis_(is_var_return_ ? ChainableStack::instance_->memalloc_
                                              .alloc_array<vari*>(N_ * ts.size())
                                        : nullptr),
@@ -270,8 +388,8 @@ class cvodes_integrator_adjoint_vari : public vari_base {
     check_positive_finite(function_name, "absolute_tolerance_quadrature",
                           absolute_tolerance_quadrature_);
     check_positive(function_name, "max_num_steps", max_num_steps_);
-    check_positive(function_name, "num_steps_between_checkpoints",
-                   num_steps_between_checkpoints_);
+    check_nonnegative(function_name, "num_steps_between_checkpoints",
+                      num_steps_between_checkpoints_);
     // for polynomial: 1=CV_HERMITE / 2=CV_POLYNOMIAL
     if (interpolation_polynomial_ != 1 && interpolation_polynomial_ != 2)
       invalid_argument(function_name, "interpolation_polynomial",
@@ -289,7 +407,9 @@ class cvodes_integrator_adjoint_vari : public vari_base {
     solver_ = new cvodes_solver(function_name, std::forward<FF>(f), N_, y0, t0,
                                 ts, absolute_tolerance_forward,
                                 absolute_tolerance_backward, num_args_vars_,
-                                solver_forward_, args...);
+                                solver_forward_, solver_backward_,
+                                interpolation_polynomial_,
+                                num_steps_between_checkpoints_, args...);
 
     stan::math::for_each(
         [func_name = function_name](auto&& arg) {
@@ -297,9 +417,59 @@ class cvodes_integrator_adjoint_vari : public vari_base {
         },
         solver_->local_args_tuple_);
 
-    CHECK_CVODES_CALL(
-        CVodeInit(solver_->cvodes_mem_, &cvodes_integrator_adjoint_vari::cv_rhs,
-                  value_of(solver_->t0_), solver_->nv_state_forward_));
+    cvodes_workspace& workspace = *solver_->workspace_;
+    long int checkpoint_spacing  // NOLINT(runtime/int)
+        = num_steps_between_checkpoints_;
+    if (checkpoint_spacing == 0) {
+      checkpoint_spacing = internal::adjoint_default_checkpoint_spacing;
+      if (workspace.num_steps_ > 0) {
+        checkpoint_spacing = internal::adjoint_checkpoint_spacing(
+            workspace.num_steps_, solver_forward_, interpolation_polynomial_);
+      }
+    }
+
+    if (!workspace.forward_is_initialized_) {
+      CHECK_CVODES_CALL(CVodeInit(solver_->cvodes_mem_,
+                                  &cvodes_integrator_adjoint_vari::cv_rhs,
+                                  value_of(solver_->t0_),
+                                  solver_->nv_state_forward_));
+
+      CHECK_CVODES_CALL(CVodeSetLinearSolver(
+          solver_->cvodes_mem_, solver_->LS_forward_, solver_->A_forward_));
+
+      CHECK_CVODES_CALL(CVodeSetJacFn(
+          solver_->cvodes_mem_,
+          &cvodes_integrator_adjoint_vari::cv_jacobian_rhs_states));
+
+      // initialize backward sensitivity system of CVODES as needed
+      if (is_var_return_ && !is_var_only_ts_) {
+        CHECK_CVODES_CALL(CVodeAdjInit(solver_->cvodes_mem_,
+                                       checkpoint_spacing,
+                                       interpolation_polynomial_));
+        workspace.checkpoint_spacing_ = checkpoint_spacing;
+      }
+      workspace.forward_is_initialized_ = true;
+    } else {
+      // reuse the pooled workspace of an earlier solve
+      CHECK_CVODES_CALL(CVodeReInit(solver_->cvodes_mem_,
+                                    value_of(solver_->t0_),
+                                    solver_->nv_state_forward_));
+      if (is_var_return_ && !is_var_only_ts_) {
+        if (checkpoint_spacing > 2 * workspace.checkpoint_spacing_
+            || 2 * checkpoint_spacing < workspace.checkpoint_spacing_) {
+          // the automatic spacing moved away from the one the adjoint
+          // memory was sized for, which also frees the backward problem
+          CVodeAdjFree(solver_->cvodes_mem_);
+          CHECK_CVODES_CALL(CVodeAdjInit(solver_->cvodes_mem_,
+                                         checkpoint_spacing,
+                                         interpolation_polynomial_));
+          workspace.checkpoint_spacing_ = checkpoint_spacing;
+          workspace.backward_is_created_ = false;
+        } else {
+          CHECK_CVODES_CALL(CVodeAdjReInit(solver_->cvodes_mem_));
+        }
+      }
+    }
 
     // Assign pointer to this as user data
     CHECK_CVODES_CALL(
@@ -311,20 +481,6 @@ class cvodes_integrator_adjoint_vari : public vari_base {
         CVodeSVtolerances(solver_->cvodes_mem_, relative_tolerance_forward_,
                           solver_->nv_absolute_tolerance_forward_));
 
-    CHECK_CVODES_CALL(CVodeSetLinearSolver(
-        solver_->cvodes_mem_, solver_->LS_forward_, solver_->A_forward_));
-
-    CHECK_CVODES_CALL(
-        CVodeSetJacFn(solver_->cvodes_mem_,
-                      &cvodes_integrator_adjoint_vari::cv_jacobian_rhs_states));
-
-    // initialize backward sensitivity system of CVODES as needed
-    if (is_var_return_ && !is_var_only_ts_) {
-      CHECK_CVODES_CALL(CVodeAdjInit(solver_->cvodes_mem_,
-                                     num_steps_between_checkpoints_,
-                                     interpolation_polynomial_));
-    }
-
     /**
      * Solve the ODE initial value problem y' = f(t, y), y(t0) = y0 at a set of
      * times, { t1, t2, t3, ... } using the requested forward solver of CVODES.
@@ -347,7 +503,7 @@ class cvodes_integrator_adjoint_vari : public vari_base {
                                   CV_NORMAL));
         }
       }
-      solver_->y_[n] = solver_->state_forward_;
+      y_.col(n) = solver_->state_forward_;
       if (is_var_return_) {
         for (std::size_t i = 0; i < N_; ++i)
           y_return_varis_[N_ * n + i]
@@ -356,6 +512,10 @@ class cvodes_integrator_adjoint_vari : public vari_base {
 
       t_init = t_final;
     }
+    if (is_var_return_ && !is_var_only_ts_) {
+      CHECK_CVODES_CALL(
+          CVodeGetNumSteps(solver_->cvodes_mem_, &workspace.num_steps_));
+    }
     ChainableStack::instance_->var_stack_.push_back(this);
   }
 
@@ -365,7 +525,8 @@ class cvodes_integrator_adjoint_vari : public vari_base {
    * the return type is a double only, then no autodiff is needed. In case of
    * autodiff then non-chaining varis are setup accordingly.
    */
-  void store_state(std::size_t n, const Eigen::VectorXd& state,
+  template <typename T_state>
+  void store_state(std::size_t n, const T_state& state,
                    Eigen::Matrix<var, Eigen::Dynamic, 1>& state_return) {
     state_return.resize(N_);
     for (size_t i = 0; i < N_; i++) {
@@ -373,7 +534,8 @@ class cvodes_integrator_adjoint_vari : public vari_base {
     }
   }
 
-  void store_state(std::size_t n, const Eigen::VectorXd& state,
+  template <typename T_state>
+  void store_state(std::size_t n, const T_state& state,
                    Eigen::Matrix<double, Eigen::Dynamic, 1>& state_return) {
     state_return = state;
   }
@@ -389,7 +551,7 @@ class cvodes_integrator_adjoint_vari : public vari_base {
     std::vector<Eigen::Matrix<T_Return, Eigen::Dynamic, 1>> y_return(
         solver_->ts_.size());
     for (std::size_t n = 0; n < solver_->ts_.size(); ++n)
-      store_state(n, solver_->y_[n], y_return[n]);
+      store_state(n, y_.col(n), y_return[n]);
     return y_return;
   }
 
@@ -413,7 +575,8 @@ class cvodes_integrator_adjoint_vari : public vari_base {
         }
 
         adjoint_of(solver_->ts_[i])
-            += step_sens.dot(rhs(value_of(solver_->ts_[i]), solver_->y_[i],
+            += step_sens.dot(rhs(value_of(solver_->ts_[i]),
+                                 Eigen::VectorXd(y_.col(i)),
                                  solver_->value_of_args_tuple_));
         step_sens.setZero();
       }
@@ -440,21 +603,55 @@ class cvodes_integrator_adjoint_vari : public vari_base {
       double t_final = value_of((i > 0) ? solver_->ts_[i - 1] : solver_->t0_);
       if (t_final != t_init) {
         if (unlikely(!backward_is_initialized_)) {
-          CHECK_CVODES_CALL(CVodeCreateB(solver_->cvodes_mem_, solver_backward_,
-                                         &index_backward_));
+          cvodes_workspace& workspace = *solver_->workspace_;
+          if (!workspace.backward_is_created_) {
+            CHECK_CVODES_CALL(CVodeCreateB(
+                solver_->cvodes_mem_, solver_backward_, &index_backward_));
+
+            // initialize CVODES backward machinery.
+            // the states of the backward problem *are* the adjoints
+            // of the ode states
+            CHECK_CVODES_CALL(
+                CVodeInitB(solver_->cvodes_mem_, index_backward_,
+                           &cvodes_integrator_adjoint_vari::cv_rhs_adj, t_init,
+                           solver_->nv_state_backward_));
+
+            CHECK_CVODES_CALL(CVodeSetLinearSolverB(
+                solver_->cvodes_mem_, index_backward_, solver_->LS_backward_,
+                solver_->A_backward_));
+
+            CHECK_CVODES_CALL(CVodeSetJacFnB(
+                solver_->cvodes_mem_, index_backward_,
+                &cvodes_integrator_adjoint_vari::cv_jacobian_rhs_adj_states));
+
+            // Allocate space for backwards quadrature needed when
+            // parameters vary.
+            if (is_any_var_args_) {
+              CHECK_CVODES_CALL(CVodeQuadInitB(
+                  solver_->cvodes_mem_, index_backward_,
+                  &cvodes_integrator_adjoint_vari::cv_quad_rhs_adj,
+                  solver_->nv_quad_));
+            }
+
+            workspace.index_backward_ = index_backward_;
+            workspace.backward_is_created_ = true;
+          } else {
+            // the pooled workspace keeps the backward problem of an
+            // earlier solve
+            index_backward_ = workspace.index_backward_;
+            CHECK_CVODES_CALL(CVodeReInitB(solver_->cvodes_mem_,
+                                           index_backward_, t_init,
+                                           solver_->nv_state_backward_));
+            if (is_any_var_args_) {
+              CHECK_CVODES_CALL(CVodeQuadReInitB(
+                  solver_->cvodes_mem_, index_backward_, solver_->nv_quad_));
+            }
+          }
 
           CHECK_CVODES_CALL(CVodeSetUserDataB(solver_->cvodes_mem_,
                                               index_backward_,
                                               reinterpret_cast<void*>(this)));
 
-          // initialize CVODES backward machinery.
-          // the states of the backward problem *are* the adjoints
-          // of the ode states
-          CHECK_CVODES_CALL(
-              CVodeInitB(solver_->cvodes_mem_, index_backward_,
-                         &cvodes_integrator_adjoint_vari::cv_rhs_adj, t_init,
-                         solver_->nv_state_backward_));
-
           CHECK_CVODES_CALL(
               CVodeSVtolerancesB(solver_->cvodes_mem_, index_backward_,
                                  relative_tolerance_backward_,
@@ -463,22 +660,7 @@ class cvodes_integrator_adjoint_vari : public vari_base {
           CHECK_CVODES_CALL(CVodeSetMaxNumStepsB(
               solver_->cvodes_mem_, index_backward_, max_num_steps_));
 
-          CHECK_CVODES_CALL(CVodeSetLinearSolverB(
-              solver_->cvodes_mem_, index_backward_, solver_->LS_backward_,
-              solver_->A_backward_));
-
-          CHECK_CVODES_CALL(CVodeSetJacFnB(
-              solver_->cvodes_mem_, index_backward_,
-              &cvodes_integrator_adjoint_vari::cv_jacobian_rhs_adj_states));
-
-          // Allocate space for backwards quadrature needed when
-          // parameters vary.
           if (is_any_var_args_) {
-            CHECK_CVODES_CALL(
-                CVodeQuadInitB(solver_->cvodes_mem_, index_backward_,
-                               &cvodes_integrator_adjoint_vari::cv_quad_rhs_adj,
-                               solver_->nv_quad_));
-
             CHECK_CVODES_CALL(
                 CVodeQuadSStolerancesB(solver_->cvodes_mem_, index_backward_,
                                        relative_tolerance_quadrature_,
@@ -585,7 +767,8 @@ class cvodes_integrator_adjoint_vari : public vari_base {
    * Calculate the adjoint sensitivity RHS for varying initial conditions
    * and parameters
    *
-   * Equation 2.23 in the cvs_guide.
+   * Equation 2.23 in the cvs_guide. If the RHS functor provides its
+   * Jacobian this is formed as -J^T yB without autodiff.
    *
    * @param[in] t time
    * @param[in] y state of the base ODE system
@@ -593,6 +776,16 @@ class cvodes_integrator_adjoint_vari : public vari_base {
    * @param[out] yBdot evaluation of adjoint ODE RHS
    */
   inline int rhs_adj(double t, N_Vector y, N_Vector yB, N_Vector yBdot) const {
+    if constexpr (has_jacobian_) {
+      const Eigen::MatrixXd J = ode_state_jacobian(
+          solver_->function_name_str_.c_str(), solver_->f_, t,
+          Eigen::Map<const Eigen::VectorXd>(NV_DATA_S(y), N_), msgs_,
+          solver_->value_of_args_tuple_);
+      Eigen::Map<const Eigen::VectorXd> yB_vec(NV_DATA_S(yB), N_);
+      Eigen::Map<Eigen::VectorXd>(NV_DATA_S(yBdot), N_).noalias()
+          = -J.transpose() * yB_vec;
+      return 0;
+    }
     const nested_rev_autodiff nested;
 
     Eigen::Matrix<var, Eigen::Dynamic, 1> y_vars(
@@ -661,29 +854,14 @@ class cvodes_integrator_adjoint_vari : public vari_base {
 
   /**
    * Calculates the jacobian of the ODE RHS wrt to its states y at the
-   * given time-point t and state y.
+   * given time-point t and state y, with the Jacobian provided by the RHS
+   * functor if it has one (see <code>ode_state_jacobian</code>).
    */
   inline int jacobian_rhs_states(double t, N_Vector y, SUNMatrix J) const {
-    Eigen::Map<Eigen::MatrixXd> Jfy(SM_DATA_D(J), N_, N_);
-
-    nested_rev_autodiff nested;
-
-    Eigen::Matrix<var, Eigen::Dynamic, 1> y_var(
-        Eigen::Map<const Eigen::VectorXd>(NV_DATA_S(y), N_));
-    Eigen::Matrix<var, Eigen::Dynamic, 1> fy_var
-        = rhs(t, y_var, solver_->value_of_args_tuple_);
-
-    check_size_match(solver_->function_name_str_.c_str(), "dy_dt",
-                     fy_var.size(), "states", N_);
-
-    grad(fy_var.coeffRef(0).vi_);
-    Jfy.col(0) = y_var.adj();
-    for (int i = 1; i < fy_var.size(); ++i) {
-      nested.set_zero_all_adjoints();
-      grad(fy_var.coeffRef(i).vi_);
-      Jfy.col(i) = y_var.adj();
-    }
-    Jfy.transposeInPlace();
+    Eigen::Map<Eigen::MatrixXd>(SM_DATA_D(J), N_, N_) = ode_state_jacobian(
+        solver_->function_name_str_.c_str(), solver_->f_, t,
+        Eigen::Map<const Eigen::VectorXd>(NV_DATA_S(y), N_), msgs_,
+        solver_->value_of_args_tuple_);
     return 0;
   }
 
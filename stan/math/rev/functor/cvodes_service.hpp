@@ -0,0 +1,222 @@
+#ifndef STAN_MATH_REV_FUNCTOR_CVODES_SERVICE_HPP
+#define STAN_MATH_REV_FUNCTOR_CVODES_SERVICE_HPP
+
+#include <stan/math/rev/functor/jacobian_bandwidth.hpp>
+#include <stan/math/prim/err/check_flag_sundials.hpp>
+#include <sundials/sundials_context.h>
+#include <cvodes/cvodes.h>
+#include <nvector/nvector_serial.h>
+#include <sunmatrix/sunmatrix_dense.h>
+#include <sunlinsol/sunlinsol_dense.h>
+#include <sunmatrix/sunmatrix_band.h>
+#include <sunlinsol/sunlinsol_band.h>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+
+namespace stan {
+namespace math {
+
+/**
+ * Callbacks of an ODE system solved by CVODES. The user data attached to
+ * the CVODES memory of a <code>cvodes_service</code> is the service
+ * itself, which forwards to the callbacks of the system being solved, so
+ * that the same memory can be reinitialized for different ODE systems of
+ * the same size.
+ */
+struct cvodes_callbacks {
+  void* system;
+  CVRhsFn rhs;
+  CVSensRhsFn rhs_sens;
+  CVLsJacFn jacobian_states;
+};
+
+/**
+ * CVODES memory and workspace (SUNDIALS context, state and sensitivity
+ * vectors, matrix and linear solver) for ODE systems with a given number
+ * of states and forward sensitivities and a given Jacobian bandwidth.
+ * Systems with a narrow band use a banded matrix and LU solver, which
+ * cost O(N (lower + upper)^2) per factorization instead of O(N^3); the
+ * others use a dense matrix.
+ *
+ * The first solve initializes the memory with <code>CVodeInit</code> and
+ * <code>CVodeSensInit</code>; every later solve reinitializes it with
+ * <code>CVodeReInit</code> and <code>CVodeSensReInit</code>, so that the
+ * allocations are paid once for many solves of same sized systems.
+ * Workspaces are shared between solves through
+ * <code>sundials_service_pool</code>, keyed by the number of states,
+ * the number of sensitivities and the bandwidth.
+ *
+ * @tparam Lmm ID of ODE solver (1: ADAMS, 2: BDF)
+ */
+template <int Lmm>
+class cvodes_service {
+  sundials::Context sundials_context_;
+  const size_t N_;
+  const size_t ns_;
+  N_Vector nv_state_;
+  N_Vector* nv_state_sens_;
+  SUNMatrix A_;
+  SUNLinearSolver LS_;
+  void* mem_;
+  bool initialized_;
+  bool stop_time_set_;
+  cvodes_callbacks* callbacks_;
+
+  static int cv_rhs(realtype t, N_Vector y, N_Vector ydot, void* user_data) {
+    auto* callbacks = static_cast<cvodes_service*>(user_data)->callbacks_;
+    return callbacks->rhs(t, y, ydot, callbacks->system);
+  }
+
+  static int cv_rhs_sens(int Ns, realtype t, N_Vector y, N_Vector ydot,
+                         N_Vector* yS, N_Vector* ySdot, void* user_data,
+                         N_Vector tmp1, N_Vector tmp2) {
+    auto* callbacks = static_cast<cvodes_service*>(user_data)->callbacks_;
+    return callbacks->rhs_sens(Ns, t, y, ydot, yS, ySdot, callbacks->system,
+                               tmp1, tmp2);
+  }
+
+  static int cv_jacobian_states(realtype t, N_Vector y, N_Vector fy,
+                                SUNMatrix J, void* user_data, N_Vector tmp1,
+                                N_Vector tmp2, N_Vector tmp3) {
+    auto* callbacks = static_cast<cvodes_service*>(user_data)->callbacks_;
+    return callbacks->jacobian_states(t, y, fy, J, callbacks->system, tmp1,
+                                      tmp2, tmp3);
+  }
+
+ public:
+  using key_t = std::tuple<size_t, size_t, int, int>;
+
+  /**
+   * Allocate CVODES memory and workspace.
+   *
+   * @param N number of states
+   * @param ns number of forward sensitivities
+   * @param lower lower bandwidth of the Jacobian
+   * @param upper upper bandwidth of the Jacobian
+   */
+  cvodes_service(size_t N, size_t ns, int lower, int upper)
+      : sundials_context_(),
+        N_(N),
+        ns_(ns),
+        nv_state_(N_VNew_Serial(N, sundials_context_)),
+        nv_state_sens_(nullptr),
+        A_(jacobian_bandwidth{lower, upper}.is_banded(N)
+               ? SUNBandMatrix(N, upper, lower, sundials_context_)
+               : SUNDenseMatrix(N, N, sundials_context_)),
+        LS_(SUNMatGetID(A_) == SUNMATRIX_BAND
+                ? SUNLinSol_Band(nv_state_, A_, sundials_context_)
+                : SUNLinSol_Dense(nv_state_, A_, sundials_context_)),
+        mem_(CVodeCreate(Lmm, sundials_context_)),
+        initialized_(false),
+        stop_time_set_(false),
+        callbacks_(nullptr) {
+    if (mem_ == nullptr) {
+      throw std::runtime_error("CVodeCreate failed to allocate memory");
+    }
+    if (ns_ > 0) {
+      nv_state_sens_ = N_VCloneVectorArray(ns_, nv_state_);
+    }
+  }
+
+  cvodes_service(const cvodes_service&) = delete;
+  cvodes_service& operator=(const cvodes_service&) = delete;
+
+  ~cvodes_service() {
+    CVodeFree(&mem_);
+    SUNLinSolFree(LS_);
+    SUNMatDestroy(A_);
+    if (ns_ > 0) {
+      N_VDestroyVectorArray(nv_state_sens_, ns_);
+    }
+    N_VDestroy_Serial(nv_state_);
+  }
+
+  /**
+   * Set the initial state and sensitivities and (re)initialize the CVODES
+   * memory at the given initial time for the given callbacks.
+   *
+   * @param callbacks callbacks of the ODE system, which must outlive the
+   * solve
+   * @param t0 initial time
+   * @param coupled_state initial state followed by the initial
+   * sensitivities, of size <code>N * (ns + 1)</code>
+   */
+  void reinit(cvodes_callbacks* callbacks, double t0,
+              const double* coupled_state) {
+    std::copy(coupled_state, coupled_state + N_, NV_DATA_S(nv_state_));
+    for (size_t i = 0; i < ns_; ++i) {
+      std::copy(coupled_state + (i + 1) * N_, coupled_state + (i + 2) * N_,
+                NV_DATA_S(nv_state_sens_[i]));
+    }
+
+    callbacks_ = callbacks;
+    if (!initialized_) {
+      // CVODES hands the sensitivity right hand side the user data set at
+      // CVodeSensInit, so it is set once to this service
+      CHECK_CVODES_CALL(CVodeSetUserData(mem_, static_cast<void*>(this)));
+      CHECK_CVODES_CALL(
+          CVodeInit(mem_, &cvodes_service::cv_rhs, t0, nv_state_));
+      CHECK_CVODES_CALL(CVodeSetLinearSolver(mem_, LS_, A_));
+      CHECK_CVODES_CALL(
+          CVodeSetJacFn(mem_, &cvodes_service::cv_jacobian_states));
+      if (ns_ > 0) {
+        CHECK_CVODES_CALL(CVodeSensInit(mem_, static_cast<int>(ns_),
+                                        CV_STAGGERED,
+                                        &cvodes_service::cv_rhs_sens,
+                                        nv_state_sens_));
+        CHECK_CVODES_CALL(CVodeSetSensErrCon(mem_, SUNTRUE));
+      }
+      initialized_ = true;
+    } else {
+      CHECK_CVODES_CALL(CVodeReInit(mem_, t0, nv_state_));
+      if (stop_time_set_) {
+        // CVODES clears a stop time once it is reached but has no way to
+        // clear one left by an interrupted solve, so it is moved out of
+        // reach
+        CHECK_CVODES_CALL(CVodeSetStopTime(
+            mem_, std::numeric_limits<double>::infinity()));
+        stop_time_set_ = false;
+      }
+      if (ns_ > 0) {
+        CHECK_CVODES_CALL(
+            CVodeSensReInit(mem_, CV_STAGGERED, nv_state_sens_));
+      }
+    }
+    if (ns_ > 0) {
+      CHECK_CVODES_CALL(CVodeSensEEtolerances(mem_));
+    }
+  }
+
+  /**
+   * Do not step past time \p t_stop in the current solve, so that the
+   * right hand side is never evaluated beyond a discontinuity at
+   * \p t_stop.
+   */
+  void set_stop_time(double t_stop) {
+    CHECK_CVODES_CALL(CVodeSetStopTime(mem_, t_stop));
+    stop_time_set_ = true;
+  }
+
+  /**
+   * Copy the current state and sensitivities into the given storage of
+   * size <code>N * (ns + 1)</code>, laid out as for <code>reinit</code>.
+   */
+  void get_coupled_state(double* coupled_state) const {
+    std::copy(NV_DATA_S(nv_state_), NV_DATA_S(nv_state_) + N_, coupled_state);
+    for (size_t i = 0; i < ns_; ++i) {
+      std::copy(NV_DATA_S(nv_state_sens_[i]),
+                NV_DATA_S(nv_state_sens_[i]) + N_,
+                coupled_state + (i + 1) * N_);
+    }
+  }
+
+  void* mem() { return mem_; }
+  N_Vector state() { return nv_state_; }
+  N_Vector* state_sens() { return nv_state_sens_; }
+};
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -5,6 +5,7 @@
 #include <stan/math/rev/core/nested_rev_autodiff.hpp>
 #include <stan/math/rev/core/zero_adjoints.hpp>
 #include <stan/math/rev/core/accumulate_adjoints.hpp>
+#include <stan/math/rev/functor/jacobian_bandwidth.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/dot_self.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
@@ -107,6 +108,30 @@ class dae_system {
         dbl_args_tuple_);
   }
 
+  /**
+   * Returns the bandwidth of the union of the Jacobians of the residual
+   * with respect to the states and their derivatives at the initial
+   * condition, see <code>detect_jacobian_bandwidth</code>.
+   *
+   * @param t time of evaluation
+   */
+  jacobian_bandwidth residual_bandwidth(double t) const {
+    const int n = N;
+    Eigen::VectorXd x(2 * n);
+    x << dbl_yy, dbl_yp;
+    return detect_jacobian_bandwidth(
+        [&](const Eigen::Matrix<var, -1, 1>& x_var) {
+          const Eigen::Matrix<var, -1, 1> yy_var = x_var.head(n);
+          const Eigen::Matrix<var, -1, 1> yp_var = x_var.tail(n);
+          return math::apply(
+              [&](auto&&... args) {
+                return f_(t, yy_var, yp_var, msgs_, args...);
+              },
+              dbl_args_tuple_);
+        },
+        x, n);
+  }
+
   /**
    * Evaluate DAE residual according to IDAS signature
    */
@@ -3,6 +3,8 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/functor/idas_service.hpp>
+#include <stan/math/rev/functor/jacobian_bandwidth.hpp>
+#include <stan/math/rev/functor/sundials_service_pool.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/err/check_flag_sundials.hpp>
 #include <idas/idas.h>
@@ -20,8 +22,6 @@ namespace math {
  * IDAS DAE integrator.
  */
 class idas_integrator {
-  sundials::Context sundials_context_;
-
   const double rtol_;
   const double atol_;
   const int64_t max_num_steps_;
@@ -57,13 +57,16 @@ class idas_integrator {
   typename dae_type::return_t operator()(const char* func, dae_type& dae,
                                          double t0,
                                          const std::vector<double>& ts) {
-    idas_service<dae_type> serv(t0, dae);
+    const jacobian_bandwidth bandwidth = dae.residual_bandwidth(t0);
+    auto serv = sundials_service_pool<idas_service<dae_type>>::instance()
+                    .acquire(dae.N, dae.ns, bandwidth.lower, bandwidth.upper);
+    serv->reinit(t0, dae);
 
-    void* mem = serv.mem;
-    N_Vector& yy = serv.nv_yy;
-    N_Vector& yp = serv.nv_yp;
-    N_Vector* yys = serv.nv_yys;
-    N_Vector* yps = serv.nv_yps;
+    void* mem = serv->mem;
+    N_Vector& yy = serv->nv_yy;
+    N_Vector& yp = serv->nv_yp;
+    N_Vector* yys = serv->nv_yys;
+    N_Vector* yps = serv->nv_yps;
     const size_t n = dae.N;
 
     CHECK_IDAS_CALL(IDASStolerances(mem, rtol_, atol_));
@@ -3,16 +3,20 @@
 
 #include <stan/math/rev/core/recover_memory.hpp>
 #include <stan/math/rev/meta/is_var.hpp>
+#include <stan/math/rev/functor/jacobian_bandwidth.hpp>
 #include <stan/math/prim/meta/require_helpers.hpp>
 #include <stan/math/prim/err/check_flag_sundials.hpp>
 #include <idas/idas.h>
 #include <nvector/nvector_serial.h>
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunlinsol/sunlinsol_dense.h>
+#include <sunmatrix/sunmatrix_band.h>
+#include <sunlinsol/sunlinsol_band.h>
 #include <sundials/sundials_context.h>
 #include <ostream>
 #include <vector>
 #include <algorithm>
+#include <tuple>
 #include <type_traits>
 
 namespace stan {
@@ -24,12 +28,23 @@ namespace math {
  * idas. This service manages the
  * allocation/deallocation, so ODE systems only request
  * service by injection.
+ *
+ * The first solve initializes the memory with <code>IDAInit</code>; later
+ * solves of same sized systems reinitialize it with <code>IDAReInit</code>.
+ * Services are shared between solves through
+ * <code>sundials_service_pool</code>, keyed by the number of states, the
+ * number of sensitivities and the bandwidth of the residual Jacobian.
+ * Systems with a narrow band use a banded matrix and LU solver, with the
+ * Jacobian approximated by the banded difference quotients of IDAS.
+ *
  * @tparam ode ode type
  * @tparam lmm_type IDAS solver type (BDF & ADAMS)
  * @tparam butcher_tab AKRODE Butcher table
  */
 template <typename dae_type>
 struct idas_service {
+  using key_t = std::tuple<size_t, size_t, int, int>;
+
   sundials::Context sundials_context_;
   int ns;
   N_Vector nv_yy;
@@ -39,36 +54,42 @@ struct idas_service {
   void* mem;
   SUNMatrix A;
   SUNLinearSolver LS;
+  dae_type* dae_;
+  bool initialized_;
 
   /**
    * Construct IDAS ODE mem & workspace
    *
-   * @param t0 initial time
-   * @param dae differential-algebraic system of equations
+   * @param N number of states
+   * @param ns number of sensitivities
+   * @param lower lower bandwidth of the residual Jacobian
+   * @param upper upper bandwidth of the residual Jacobian
    */
-  idas_service(double t0, dae_type& dae)
+  idas_service(size_t N, size_t ns, int lower, int upper)
       : sundials_context_(),
-        ns(dae.ns),
-        nv_yy(N_VNew_Serial(dae.N, sundials_context_)),
-        nv_yp(N_VNew_Serial(dae.N, sundials_context_)),
+        ns(ns),
+        nv_yy(N_VNew_Serial(N, sundials_context_)),
+        nv_yp(N_VNew_Serial(N, sundials_context_)),
         nv_yys(nullptr),
         nv_yps(nullptr),
         mem(IDACreate(sundials_context_)),
-        A(SUNDenseMatrix(dae.N, dae.N, sundials_context_)),
-        LS(SUNLinSol_Dense(nv_yy, A, sundials_context_)) {
-    const int n = dae.N;
-    for (auto i = 0; i < n; ++i) {
-      NV_Ith_S(nv_yy, i) = dae.dbl_yy[i];
-      NV_Ith_S(nv_yp, i) = dae.dbl_yp[i];
+        A(jacobian_bandwidth{lower, upper}.is_banded(N)
+              ? SUNBandMatrix(N, upper, lower, sundials_context_)
+              : SUNDenseMatrix(N, N, sundials_context_)),
+        LS(SUNMatGetID(A) == SUNMATRIX_BAND
+               ? SUNLinSol_Band(nv_yy, A, sundials_context_)
+               : SUNLinSol_Dense(nv_yy, A, sundials_context_)),
+        dae_(nullptr),
+        initialized_(false) {
+    if (dae_type::use_fwd_sens) {
+      nv_yys = N_VCloneVectorArray(ns, nv_yy);
+      nv_yps = N_VCloneVectorArray(ns, nv_yp);
     }
-
-    CHECK_IDAS_CALL(IDAInit(mem, dae_type::idas_res, t0, nv_yy, nv_yp));
-    CHECK_IDAS_CALL(IDASetUserData(mem, static_cast<void*>(&dae)));
-    CHECK_IDAS_CALL(IDASetLinearSolver(mem, LS, A));
-
-    idas_sens_init(nv_yys, nv_yps, ns, n);
   }
 
+  idas_service(const idas_service&) = delete;
+  idas_service& operator=(const idas_service&) = delete;
+
   ~idas_service() {
     SUNLinSolFree(LS);
     SUNMatDestroy(A);
@@ -81,6 +102,51 @@ struct idas_service {
     }
   }
 
+  /**
+   * Set the initial state and (re)initialize the IDAS memory for the
+   * given DAE system.
+   *
+   * @param t0 initial time
+   * @param dae differential-algebraic system of equations, which must
+   * outlive the solve
+   */
+  void reinit(double t0, dae_type& dae) {
+    const int n = dae.N;
+    for (auto i = 0; i < n; ++i) {
+      NV_Ith_S(nv_yy, i) = dae.dbl_yy[i];
+      NV_Ith_S(nv_yp, i) = dae.dbl_yp[i];
+    }
+    dae_ = &dae;
+
+    if (!initialized_) {
+      // IDAS hands the sensitivity residual the user data set at
+      // IDASensInit, so it is set once to this service
+      CHECK_IDAS_CALL(IDASetUserData(mem, static_cast<void*>(this)));
+      CHECK_IDAS_CALL(IDAInit(mem, idas_res, t0, nv_yy, nv_yp));
+      CHECK_IDAS_CALL(IDASetLinearSolver(mem, LS, A));
+    } else {
+      CHECK_IDAS_CALL(IDAReInit(mem, t0, nv_yy, nv_yp));
+    }
+
+    idas_sens_init(nv_yys, nv_yps, ns, n);
+    initialized_ = true;
+  }
+
+  static int idas_res(double t, N_Vector yy, N_Vector yp, N_Vector rr,
+                      void* user_data) {
+    return dae_type::idas_res(t, yy, yp, rr,
+                              static_cast<idas_service*>(user_data)->dae_);
+  }
+
+  static int idas_sens_res(int ns, double t, N_Vector yy, N_Vector yp,
+                           N_Vector res, N_Vector* yys, N_Vector* yps,
+                           N_Vector* ress, void* user_data, N_Vector temp1,
+                           N_Vector temp2, N_Vector temp3) {
+    return dae_type::idas_sens_res(
+        ns, t, yy, yp, res, yys, yps, ress,
+        static_cast<idas_service*>(user_data)->dae_, temp1, temp2, temp3);
+  }
+
   template <typename dae_t = dae_type,
             std::enable_if_t<!dae_t::use_fwd_sens>* = nullptr>
   void idas_sens_init(N_Vector* yys, N_Vector* yps, int ns, int n) {}
@@ -88,15 +154,17 @@ struct idas_service {
   template <typename dae_t = dae_type,
             std::enable_if_t<dae_t::use_fwd_sens>* = nullptr>
   void idas_sens_init(N_Vector*& yys, N_Vector*& yps, int ns, int n) {
-    yys = N_VCloneVectorArray(ns, nv_yy);
-    yps = N_VCloneVectorArray(ns, nv_yp);
     for (size_t is = 0; is < ns; ++is) {
       N_VConst(RCONST(0.0), yys[is]);
       N_VConst(RCONST(0.0), yps[is]);
     }
     set_init_sens(yys, yps, n);
-    CHECK_IDAS_CALL(
-        IDASensInit(mem, ns, IDA_STAGGERED, dae_type::idas_sens_res, yys, yps));
+    if (!initialized_) {
+      CHECK_IDAS_CALL(
+          IDASensInit(mem, ns, IDA_STAGGERED, idas_sens_res, yys, yps));
+    } else {
+      CHECK_IDAS_CALL(IDASensReInit(mem, IDA_STAGGERED, yys, yps));
+    }
   }
 
   template <typename dae_t = dae_type,
@@ -11,23 +11,87 @@
 #include <stan/math/prim/functor/apply.hpp>
 #include <stan/math/prim/functor/integrate_1d.hpp>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <ostream>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace stan {
 namespace math {
+namespace internal {
 
 /**
- * Return the integral of f from a to b to the given relative tolerance
+ * Value and gradient of an integrand with respect to its parameters at
+ * every quadrature node visited, keyed by the node and its distance to
+ * the nearest boundary. The gradient of each parameter is integrated by a
+ * separate adaptive quadrature, but all of them visit the same nodes up
+ * to the level each one needs, so a single reverse sweep per node yields
+ * the integrands of all parameters.
+ */
+class integrate_1d_node_cache {
+  struct key_hash {
+    size_t operator()(const std::pair<uint64_t, uint64_t>& key) const {
+      return std::hash<uint64_t>()(key.first)
+             ^ (std::hash<uint64_t>()(key.second) << 1);
+    }
+  };
+
+  const size_t size_;
+  std::unordered_map<std::pair<uint64_t, uint64_t>, size_t, key_hash> index_;
+  std::vector<double> values_;
+
+ public:
+  /**
+   * @param num_vars number of parameters of the integrand
+   */
+  explicit integrate_1d_node_cache(size_t num_vars) : size_(num_vars + 1) {}
+
+  /**
+   * Returns the value of the integrand followed by its gradient at the
+   * node \p x, computed by \p eval into the given storage on the first
+   * visit of the node.
+   *
+   * @tparam Eval type of evaluation
+   * @param x node
+   * @param xc distance of the node to the nearest boundary
+   * @param eval callable writing the value and gradient to a
+   * <code>double*</code>
+   */
+  template <typename Eval>
+  const double* operator()(double x, double xc, const Eval& eval) {
+    std::pair<uint64_t, uint64_t> key;
+    std::memcpy(&key.first, &x, sizeof(double));
+    std::memcpy(&key.second, &xc, sizeof(double));
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      return values_.data() + it->second;
+    }
+    const size_t offset = values_.size();
+    values_.resize(offset + size_);
+    eval(values_.data() + offset);
+    index_.emplace(key, offset);
+    return values_.data() + offset;
+  }
+};
+
+}  // namespace internal
+
+/**
+ * Return the integral of f from a to b to the given relative tolerance with
+ * the given quadrature rule. The value and the integrals of the gradients
+ * all use \p rule.
  *
  * @tparam F Type of f
  * @tparam T_a type of first limit
  * @tparam T_b type of second limit
  * @tparam Args types of parameter pack arguments
  *
+ * @param rule quadrature rule
  * @param f the functor to integrate
  * @param a lower limit of integration
  * @param b upper limit of integration
@@ -39,8 +103,8 @@ namespace math {
 template <typename F, typename T_a, typename T_b, typename... Args,
           require_any_st_var<T_a, T_b, Args...> * = nullptr>
 inline return_type_t<T_a, T_b, Args...> integrate_1d_impl(
-    const F &f, const T_a &a, const T_b &b, double relative_tolerance,
-    std::ostream *msgs, const Args &... args) {
+    integrate_1d_rule rule, const F &f, const T_a &a, const T_b &b,
+    double relative_tolerance, std::ostream *msgs, const Args &... args) {
   static constexpr const char *function = "integrate_1d";
   check_less_or_equal(function, "lower limit", a, b);
 
@@ -62,7 +126,7 @@ inline return_type_t<T_a, T_b, Args...> integrate_1d_impl(
               [&](auto &&... val_args) { return f(x, xc, msgs, val_args...); },
               args_val_tuple);
         },
-        a_val, b_val, relative_tolerance);
+        a_val, b_val, relative_tolerance, rule);
 
     constexpr size_t num_vars_ab = is_var<T_a>::value + is_var<T_b>::value;
     size_t num_vars_args = count_vars(args...);
@@ -111,28 +175,41 @@ inline return_type_t<T_a, T_b, Args...> integrate_1d_impl(
           },
           args_tuple_local_copy);
 
+      // The value and the gradient with respect to all parameters at a node
+      // come from one nested reverse sweep and are shared by the quadratures
+      // of all parameters
+      internal::integrate_1d_node_cache node_cache(num_vars_args);
+      auto eval_node = [&](double x, double xc, double *values) {
+        argument_nest.set_zero_all_adjoints();
+
+        nested_rev_autodiff gradient_nest;
+        var fx = math::apply(
+            [&f, &x, &xc, msgs](auto &&... local_args) {
+              return f(x, xc, msgs, local_args...);
+            },
+            args_tuple_local_copy);
+        fx.grad();
+
+        values[0] = fx.val();
+        for (size_t n = 0; n < num_vars_args; ++n) {
+          values[n + 1] = local_varis[n]->adj();
+        }
+      };
+
       for (size_t n = 0; n < num_vars_args; ++n) {
         // This computes the integral of the gradient of f with respect to the
         // nth parameter in args using a nested nested reverse mode autodiff
         *partials_ptr = integrate(
             [&](const auto &x, const auto &xc) {
-              argument_nest.set_zero_all_adjoints();
-
-              nested_rev_autodiff gradient_nest;
-              var fx = math::apply(
-                  [&f, &x, &xc, msgs](auto &&... local_args) {
-                    return f(x, xc, msgs, local_args...);
-                  },
-                  args_tuple_local_copy);
-              fx.grad();
-
-              double gradient = local_varis[n]->adj();
+              const double *values = node_cache(
+                  x, xc, [&](double *v) { eval_node(x, xc, v); });
+              double gradient = values[n + 1];
 
               // Gradients that evaluate to NaN are set to zero if the function
               // itself evaluates to zero. If the function is not zero and the
               // gradient evaluates to NaN, a std::domain_error is thrown
               if (is_nan(gradient)) {
-                if (fx.val() == 0) {
+                if (values[0] == 0) {
                   gradient = 0;
                 } else {
                   throw_domain_error("gradient_of_f", "The gradient of f", n,
@@ -141,7 +218,7 @@ inline return_type_t<T_a, T_b, Args...> integrate_1d_impl(
               }
               return gradient;
             },
-            a_val, b_val, relative_tolerance);
+            a_val, b_val, relative_tolerance, rule);
         partials_ptr++;
       }
     }
@@ -156,6 +233,31 @@ inline return_type_t<T_a, T_b, Args...> integrate_1d_impl(
   }
 }
 
+/**
+ * Return the integral of f from a to b to the given relative tolerance
+ *
+ * @tparam F Type of f
+ * @tparam T_a type of first limit
+ * @tparam T_b type of second limit
+ * @tparam Args types of parameter pack arguments
+ *
+ * @param f the functor to integrate
+ * @param a lower limit of integration
+ * @param b upper limit of integration
+ * @param relative_tolerance relative tolerance passed to Boost quadrature
+ * @param[in, out] msgs the print stream for warning messages
+ * @param args additional arguments to pass to f
+ * @return numeric integral of function f
+ */
+template <typename F, typename T_a, typename T_b, typename... Args,
+          require_any_st_var<T_a, T_b, Args...> * = nullptr>
+inline return_type_t<T_a, T_b, Args...> integrate_1d_impl(
+    const F &f, const T_a &a, const T_b &b, double relative_tolerance,
+    std::ostream *msgs, const Args &... args) {
+  return integrate_1d_impl(integrate_1d_rule::double_exponential, f, a, b,
+                           relative_tolerance, msgs, args...);
+}
+
 /**
  * Compute the integral of the single variable function f from a to b to within
  * a specified relative tolerance. a and b can be finite or infinite.
@@ -209,6 +311,7 @@ inline return_type_t<T_a, T_b, Args...> integrate_1d_impl(
  * @param x_i additional integer data to be passed to f
  * @param[in, out] msgs the print stream for warning messages
  * @param relative_tolerance relative tolerance passed to Boost quadrature
+ * @param rule quadrature rule, see <code>integrate_1d_rule</code>
  * @return numeric integral of function f
  */
 template <typename F, typename T_a, typename T_b, typename T_theta,
@@ -216,9 +319,10 @@ template <typename F, typename T_a, typename T_b, typename T_theta,
 inline return_type_t<T_a, T_b, T_theta> integrate_1d(
     const F &f, const T_a &a, const T_b &b, const std::vector<T_theta> &theta,
     const std::vector<double> &x_r, const std::vector<int> &x_i,
-    std::ostream *msgs, const double relative_tolerance = std::sqrt(EPSILON)) {
-  return integrate_1d_impl(integrate_1d_adapter<F>(f), a, b, relative_tolerance,
-                           msgs, theta, x_r, x_i);
+    std::ostream *msgs, const double relative_tolerance = std::sqrt(EPSILON),
+    integrate_1d_rule rule = integrate_1d_rule::double_exponential) {
+  return integrate_1d_impl(rule, integrate_1d_adapter<F>(f), a, b,
+                           relative_tolerance, msgs, theta, x_r, x_i);
 }
 
 }  // namespace math
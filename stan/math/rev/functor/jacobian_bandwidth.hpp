@@ -0,0 +1,95 @@
+#ifndef STAN_MATH_REV_FUNCTOR_JACOBIAN_BANDWIDTH_HPP
+#define STAN_MATH_REV_FUNCTOR_JACOBIAN_BANDWIDTH_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/jacobian.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <algorithm>
+#include <cmath>
+#include <exception>
+
+namespace stan {
+namespace math {
+
+/**
+ * Lower and upper bandwidth of the Jacobian of an ODE or DAE system with
+ * respect to its states. A Jacobian with <code>lower = upper = N - 1</code>
+ * is treated as dense.
+ */
+struct jacobian_bandwidth {
+  int lower;
+  int upper;
+
+  /**
+   * Returns true if the band of a system with \p N states is narrow
+   * enough for a banded linear solver to pay off.
+   */
+  bool is_banded(int N) const { return lower + upper + 1 < N; }
+};
+
+/**
+ * Systems with fewer states than this are always solved with a dense
+ * linear solver.
+ */
+constexpr int jacobian_band_min_states = 32;
+
+/**
+ * Returns the bandwidth of the Jacobian of the N-dimensional function
+ * \p f with respect to one or more N-dimensional blocks of its argument,
+ * e.g. the states of an ODE right hand side or the states and their
+ * derivatives of a DAE residual.
+ *
+ * The sparsity is detected with reverse mode autodiff at \p x and at a
+ * perturbed point, so that entries which vanish only at \p x (such as
+ * the derivatives of mass action terms at zero concentrations) are kept.
+ * The pattern is assumed not to change along the solution. A full
+ * bandwidth is returned if the system has fewer than
+ * <code>jacobian_band_min_states</code> states, if the band covers more
+ * than a quarter of the matrix, or if \p f throws, in which case the
+ * error is left to the solver.
+ *
+ * @tparam F type of function
+ * @param f function taking a column vector of <code>var</code> of the
+ * size of \p x and returning a column vector of <code>var</code> of size
+ * \p N
+ * @param x point of evaluation, made of blocks of size \p N
+ * @param N number of states
+ * @return bandwidth of the Jacobian
+ */
+template <typename F>
+inline jacobian_bandwidth detect_jacobian_bandwidth(const F& f,
+                                                    const Eigen::VectorXd& x,
+                                                    int N) {
+  const jacobian_bandwidth dense{N - 1, N - 1};
+  if (N < jacobian_band_min_states) {
+    return dense;
+  }
+
+  jacobian_bandwidth band{0, 0};
+  auto update = [&](const Eigen::VectorXd& x_eval) {
+    Eigen::VectorXd fx;
+    Eigen::MatrixXd J;
+    jacobian(f, x_eval, fx, J);
+    for (int j = 0; j < J.cols(); ++j) {
+      for (int i = 0; i < J.rows(); ++i) {
+        if (J.coeff(i, j) != 0.0) {
+          band.lower = std::max(band.lower, i - j % N);
+          band.upper = std::max(band.upper, j % N - i);
+        }
+      }
+    }
+  };
+
+  try {
+    update(x);
+    update((x.array() + 0.1 * (x.array().abs() + 0.1)).matrix());
+  } catch (const std::exception&) {
+    return dense;
+  }
+  return 4 * (band.lower + band.upper + 1) <= N ? band : dense;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
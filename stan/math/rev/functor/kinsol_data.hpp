@@ -18,50 +18,68 @@ namespace stan {
 namespace math {
 
 /**
- * KINSOL algebraic system data holder.
- * Based on cvodes_ode_data.
+ * KINSOL memory and workspace (SUNDIALS context, template vector, dense
+ * matrix and linear solver) for algebraic systems of a given size.
  *
- * @tparam F1 functor type for system function.
- * @tparam F2 functor type for jacobian function. Default is 0.
- *         If 0, use rev mode autodiff to compute the Jacobian.
+ * The memory is initialized with <code>KINInit</code> by the first solve;
+ * later solves only swap in the system function with
+ * <code>KINSetSysFunc</code>, so the allocations are paid once for many
+ * solves of same sized systems. Unless another system is solved in
+ * between, the linear solver still holds the factorized Jacobian of the
+ * last Newton step, which a warm started solve may reuse.
  */
-template <typename F1, typename... Args>
-class kinsol_system_data {
-  const F1& f_;
-  const Eigen::VectorXd& x_;
-  const size_t N_;
-  std::ostream* const msgs_;
-  const std::tuple<const Args&...> args_tuple_;
-
-  typedef kinsol_system_data<F1, Args...> system_data;
+struct kinsol_workspace {
+  using key_t = std::tuple<size_t>;
 
- public:
   sundials::Context sundials_context_;
+  const size_t N_;
   N_Vector nv_x_;
   SUNMatrix J_;
   SUNLinearSolver LS_;
   void* kinsol_memory_;
+  bool initialized_{false};
 
-  /* Constructor */
-  kinsol_system_data(const F1& f, const Eigen::VectorXd& x,
-                     std::ostream* const msgs, const Args&... args)
-      : f_(f),
-        x_(x),
-        N_(x.size()),
-        msgs_(msgs),
-        args_tuple_(args...),
-        sundials_context_(),
-        nv_x_(N_VMake_Serial(N_, &to_array_1d(x_)[0], sundials_context_)),
-        J_(SUNDenseMatrix(N_, N_, sundials_context_)),
+  explicit kinsol_workspace(size_t N)
+      : sundials_context_(),
+        N_(N),
+        nv_x_(N_VNew_Serial(N, sundials_context_)),
+        J_(SUNDenseMatrix(N, N, sundials_context_)),
         LS_(SUNLinSol_Dense(nv_x_, J_, sundials_context_)),
         kinsol_memory_(KINCreate(sundials_context_)) {}
 
-  ~kinsol_system_data() {
+  kinsol_workspace(const kinsol_workspace&) = delete;
+  kinsol_workspace& operator=(const kinsol_workspace&) = delete;
+
+  ~kinsol_workspace() {
     N_VDestroy_Serial(nv_x_);
     SUNLinSolFree(LS_);
     SUNMatDestroy(J_);
     KINFree(&kinsol_memory_);
   }
+};
+
+/**
+ * KINSOL algebraic system data holder, passed as user data to the
+ * callbacks of a <code>kinsol_workspace</code>.
+ * Based on cvodes_ode_data.
+ *
+ * @tparam F1 functor type for system function.
+ * @tparam Args types of additional arguments to the system function.
+ */
+template <typename F1, typename... Args>
+class kinsol_system_data {
+  const F1& f_;
+  const size_t N_;
+  std::ostream* const msgs_;
+  const std::tuple<const Args&...> args_tuple_;
+
+  typedef kinsol_system_data<F1, Args...> system_data;
+
+ public:
+  /* Constructor */
+  kinsol_system_data(const F1& f, const Eigen::VectorXd& x,
+                     std::ostream* const msgs, const Args&... args)
+      : f_(f), N_(x.size()), msgs_(msgs), args_tuple_(args...) {}
 
   /* Implements the user-defined function passed to KINSOL. */
   static int kinsol_f_system(const N_Vector x, const N_Vector f_eval,
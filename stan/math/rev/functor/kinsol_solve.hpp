@@ -1,8 +1,10 @@
 #ifndef STAN_MATH_REV_FUNCTOR_KINSOL_SOLVE_HPP
 #define STAN_MATH_REV_FUNCTOR_KINSOL_SOLVE_HPP
 
-#include <stan/math/rev/functor/kinsol_data.hpp>
+#include <stan/math/rev/functor/algebra_solver_warm_start.hpp>
 #include <stan/math/rev/functor/algebra_system.hpp>
+#include <stan/math/rev/functor/kinsol_data.hpp>
+#include <stan/math/rev/functor/sundials_service_pool.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/to_array_1d.hpp>
 #include <stan/math/prim/fun/to_vector.hpp>
@@ -11,11 +13,98 @@
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunlinsol/sunlinsol_dense.h>
 #include <nvector/nvector_serial.h>
+#include <exception>
 #include <vector>
 
 namespace stan {
 namespace math {
 
+namespace internal {
+
+/**
+ * Solve the algebraic system with KINSOL in the given workspace. See
+ * <code>kinsol_solve</code> for the arguments.
+ *
+ * @param[in, out] workspace KINSOL memory of the solve
+ * @param[in] reuse_jacobian whether to start from the factorized Jacobian
+ *            left in the linear solver of \p workspace by its last solve
+ * @param[out] num_iterations number of nonlinear iterations
+ */
+template <typename F1, typename... Args>
+Eigen::VectorXd kinsol_solve_in(
+    kinsol_workspace& workspace, const bool reuse_jacobian,
+    long int& num_iterations,  // NOLINT(runtime/int)
+    const F1& f, const Eigen::VectorXd& x, const double scaling_step_tol,
+    const double function_tolerance, const int64_t max_num_steps,
+    const bool custom_jacobian, const int steps_eval_jacobian,
+    const int global_line_search, std::ostream* const msgs,
+    const Args&... args) {
+  int N = x.size();
+  typedef kinsol_system_data<F1, Args...> system_data;
+  system_data kinsol_data(f, x, msgs, args...);
+  void* kinsol_memory = workspace.kinsol_memory_;
+
+  if (!workspace.initialized_) {
+    CHECK_KINSOL_CALL(KINInit(kinsol_memory, &system_data::kinsol_f_system,
+                              workspace.nv_x_));
+    CHECK_KINSOL_CALL(
+        KINSetLinearSolver(kinsol_memory, workspace.LS_, workspace.J_));
+    workspace.initialized_ = true;
+  } else {
+    CHECK_KINSOL_CALL(
+        KINSetSysFunc(kinsol_memory, &system_data::kinsol_f_system));
+  }
+
+  N_Vector scaling = N_VNew_Serial(N, workspace.sundials_context_);
+  N_Vector nv_x = N_VNew_Serial(N, workspace.sundials_context_);
+  Eigen::VectorXd x_solution(N);
+
+  try {
+    N_VConst_Serial(1.0, scaling);  // no scaling
+
+    CHECK_KINSOL_CALL(KINSetNumMaxIters(kinsol_memory, max_num_steps));
+    CHECK_KINSOL_CALL(KINSetFuncNormTol(kinsol_memory, function_tolerance));
+    CHECK_KINSOL_CALL(KINSetScaledStepTol(kinsol_memory, scaling_step_tol));
+    CHECK_KINSOL_CALL(KINSetMaxSetupCalls(kinsol_memory, steps_eval_jacobian));
+    CHECK_KINSOL_CALL(KINSetNoInitSetup(kinsol_memory, reuse_jacobian));
+
+    // CHECK
+    // The default value is 1000 * ||u_0||_D where ||u_0|| is the initial guess.
+    // So we run into issues if ||u_0|| = 0.
+    // If the norm is non-zero, use kinsol's default (accessed with 0),
+    // else use the dimension of x -- CHECK - find optimal length.
+    double max_newton_step = (x.norm() == 0) ? x.size() : 0;
+    CHECK_KINSOL_CALL(KINSetMaxNewtonStep(kinsol_memory, max_newton_step));
+    CHECK_KINSOL_CALL(
+        KINSetUserData(kinsol_memory, static_cast<void*>(&kinsol_data)));
+
+    CHECK_KINSOL_CALL(KINSetJacFn(
+        kinsol_memory, custom_jacobian ? &system_data::kinsol_jacobian : NULL));
+
+    for (int i = 0; i < N; i++)
+      NV_Ith_S(nv_x, i) = x(i);
+
+    kinsol_check(
+        KINSol(kinsol_memory, nv_x, global_line_search, scaling, scaling),
+        "KINSol", max_num_steps);
+    CHECK_KINSOL_CALL(KINGetNumNonlinSolvIters(kinsol_memory, &num_iterations));
+
+    for (int i = 0; i < N; i++)
+      x_solution(i) = NV_Ith_S(nv_x, i);
+  } catch (const std::exception& e) {
+    N_VDestroy(nv_x);
+    N_VDestroy(scaling);
+    throw;
+  }
+
+  N_VDestroy(nv_x);
+  N_VDestroy(scaling);
+
+  return x_solution;
+}
+
+}  // namespace internal
+
 /**
  * Return the solution to the specified algebraic system,
  * given an initial guess. Invokes the Kinsol solver from Sundials.
@@ -66,66 +155,57 @@ Eigen::VectorXd kinsol_solve(const F1& f, const Eigen::VectorXd& x,
                              const int steps_eval_jacobian,    // = 10
                              const int global_line_search,  // = KIN_LINESEARCH
                              std::ostream* const msgs, const Args&... args) {
-  int N = x.size();
-  typedef kinsol_system_data<F1, Args...> system_data;
-  system_data kinsol_data(f, x, msgs, args...);
-
-  CHECK_KINSOL_CALL(KINInit(kinsol_data.kinsol_memory_,
-                            &system_data::kinsol_f_system, kinsol_data.nv_x_));
-
-  N_Vector scaling = N_VNew_Serial(N, kinsol_data.sundials_context_);
-  N_Vector nv_x = N_VNew_Serial(N, kinsol_data.sundials_context_);
-  Eigen::VectorXd x_solution(N);
-
-  try {
-    N_VConst_Serial(1.0, scaling);  // no scaling
-
-    CHECK_KINSOL_CALL(
-        KINSetNumMaxIters(kinsol_data.kinsol_memory_, max_num_steps));
-    CHECK_KINSOL_CALL(
-        KINSetFuncNormTol(kinsol_data.kinsol_memory_, function_tolerance));
-    CHECK_KINSOL_CALL(
-        KINSetScaledStepTol(kinsol_data.kinsol_memory_, scaling_step_tol));
-    CHECK_KINSOL_CALL(
-        KINSetMaxSetupCalls(kinsol_data.kinsol_memory_, steps_eval_jacobian));
-
-    // CHECK
-    // The default value is 1000 * ||u_0||_D where ||u_0|| is the initial guess.
-    // So we run into issues if ||u_0|| = 0.
-    // If the norm is non-zero, use kinsol's default (accessed with 0),
-    // else use the dimension of x -- CHECK - find optimal length.
-    double max_newton_step = (x.norm() == 0) ? x.size() : 0;
-    CHECK_KINSOL_CALL(
-        KINSetMaxNewtonStep(kinsol_data.kinsol_memory_, max_newton_step));
-    CHECK_KINSOL_CALL(KINSetUserData(kinsol_data.kinsol_memory_,
-                                     static_cast<void*>(&kinsol_data)));
-
-    // construct Linear solver
-    CHECK_KINSOL_CALL(KINSetLinearSolver(kinsol_data.kinsol_memory_,
-                                         kinsol_data.LS_, kinsol_data.J_));
-
-    if (custom_jacobian)
-      CHECK_KINSOL_CALL(KINSetJacFn(kinsol_data.kinsol_memory_,
-                                    &system_data::kinsol_jacobian));
-
-    for (int i = 0; i < N; i++)
-      NV_Ith_S(nv_x, i) = x(i);
-
-    kinsol_check(KINSol(kinsol_data.kinsol_memory_, nv_x, global_line_search,
-                        scaling, scaling),
-                 "KINSol", max_num_steps);
+  auto workspace = sundials_service_pool<kinsol_workspace>::instance().acquire(
+      static_cast<size_t>(x.size()));
+  long int num_iterations;  // NOLINT(runtime/int)
+  return internal::kinsol_solve_in(
+      *workspace, false, num_iterations, f, x, scaling_step_tol,
+      function_tolerance, max_num_steps, custom_jacobian, steps_eval_jacobian,
+      global_line_search, msgs, args...);
+}
 
-    for (int i = 0; i < N; i++)
-      x_solution(i) = NV_Ith_S(nv_x, i);
-  } catch (const std::exception& e) {
-    N_VDestroy(nv_x);
-    N_VDestroy(scaling);
-    throw;
+/**
+ * Return the solution to the specified algebraic system, starting from
+ * the solution cached in \p warm_start if there is one and from the
+ * initial guess otherwise. A warm started solve also starts from the
+ * factorized Jacobian of the previous solve. If it fails, the system is
+ * solved again from the initial guess.
+ *
+ * See the overload without a cache for the other arguments.
+ *
+ * @param[in, out] warm_start solution cache of the call site
+ */
+template <typename F1, typename... Args>
+Eigen::VectorXd kinsol_solve(const F1& f, const Eigen::VectorXd& x,
+                             const double scaling_step_tol,
+                             const double function_tolerance,
+                             const int64_t max_num_steps,
+                             const bool custom_jacobian,
+                             const int steps_eval_jacobian,
+                             const int global_line_search,
+                             algebra_solver_warm_start& warm_start,
+                             std::ostream* const msgs, const Args&... args) {
+  kinsol_workspace& workspace = warm_start.kinsol_memory(x.size());
+  long int num_iterations;  // NOLINT(runtime/int)
+  if (warm_start.is_warm(x)) {
+    try {
+      Eigen::VectorXd x_solution = internal::kinsol_solve_in(
+          workspace, warm_start.kinsol_jacobian_current(), num_iterations, f,
+          warm_start.initial_guess(x), scaling_step_tol, function_tolerance,
+          max_num_steps, custom_jacobian, steps_eval_jacobian,
+          global_line_search, msgs, args...);
+      warm_start.store(x_solution, num_iterations, true, true);
+      return x_solution;
+    } catch (const std::exception&) {
+      warm_start.reset();
+    }
   }
-
-  N_VDestroy(nv_x);
-  N_VDestroy(scaling);
-
+  warm_start.reset();
+  Eigen::VectorXd x_solution = internal::kinsol_solve_in(
+      workspace, false, num_iterations, f, x, scaling_step_tol,
+      function_tolerance, max_num_steps, custom_jacobian, steps_eval_jacobian,
+      global_line_search, msgs, args...);
+  warm_start.store(x_solution, num_iterations, false, true);
   return x_solution;
 }
 
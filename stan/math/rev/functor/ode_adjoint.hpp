@@ -22,6 +22,10 @@ namespace math {
  *     operator()(const T_t& t, const Eigen::Matrix<T_y, Eigen::Dynamic, 1>& y,
  *     std::ostream* msgs, const T_Args&... args);
  *
+ * \p f may also provide the Jacobian of the right hand side with respect
+ * to the states, or its products with vectors, which are then used
+ * instead of autodiff (see <code>has_ode_jacobian</code>).
+ *
  * t is the time, y is the state, msgs is a stream for error messages, and args
  * are optional arguments passed to the ODE solve function (which are passed
  * through to \p f without modification).
@@ -53,7 +57,8 @@ namespace math {
  * @param max_num_steps Upper limit on the number of integration steps to
  *   take between each output (error if exceeded)
  * @param num_steps_between_checkpoints Number of integrator steps after which a
- * checkpoint is stored for the backward pass
+ * checkpoint is stored for the backward pass, or 0 to choose the spacing which
+ * minimizes the checkpoint memory from the previous solve of the same system
  * @param interpolation_polynomial type of polynomial used for interpolation
  * @param solver_forward solver used for forward pass
  * @param solver_backward solver used for backward pass
@@ -137,7 +142,8 @@ auto ode_adjoint_impl(
  * @param max_num_steps Upper limit on the number of integration steps to
  *   take between each output (error if exceeded)
  * @param num_steps_between_checkpoints Number of integrator steps after which a
- * checkpoint is stored for the backward pass
+ * checkpoint is stored for the backward pass, or 0 to choose the spacing which
+ * minimizes the checkpoint memory from the previous solve of the same system
  * @param interpolation_polynomial type of polynomial used for interpolation
  * @param solver_forward solver used for forward pass
  * @param solver_backward solver used for backward pass
@@ -226,7 +232,8 @@ std::vector<Eigen::VectorXd> ode_adjoint_impl(
  * @param max_num_steps Upper limit on the number of integration steps to
  *   take between each output (error if exceeded)
  * @param num_steps_between_checkpoints Number of integrator steps after which a
- * checkpoint is stored for the backward pass
+ * checkpoint is stored for the backward pass, or 0 to choose the spacing which
+ * minimizes the checkpoint memory from the previous solve of the same system
  * @param interpolation_polynomial type of polynomial used for interpolation
  * @param solver_forward solver used for forward pass
  * @param solver_backward solver used for backward pass
@@ -0,0 +1,218 @@
+#ifndef STAN_MATH_REV_FUNCTOR_ODE_BATCH_HPP
+#define STAN_MATH_REV_FUNCTOR_ODE_BATCH_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/cvodes_integrator.hpp>
+#include <stan/math/rev/functor/cvodes_service.hpp>
+#include <stan/math/rev/functor/ode_store_sensitivities.hpp>
+#include <stan/math/rev/functor/sundials_service_pool.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <ostream>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Solve a batch of ODE initial value problems that share the right hand
+ * side \p f, one per subject, with the CVODES solver \p Lmm.
+ *
+ * Subjects are solved in chunks, in parallel with TBB when
+ * <code>STAN_THREADS</code> is defined. Each worker takes the CVODES
+ * workspaces from its thread local <code>sundials_service_pool</code>, so
+ * subjects of the same size and Jacobian bandwidth reuse them through
+ * <code>CVodeReInit</code>. The workers only compute the states and their
+ * sensitivities; the autodiff variables of the results are created
+ * afterwards on the calling thread.
+ *
+ * @tparam Lmm ID of ODE solver (1: ADAMS, 2: BDF)
+ * @tparam F Type of ODE right hand side
+ * @tparam T_y0 Type of initial state of a subject
+ * @tparam T_t0 Type of initial time
+ * @tparam T_ts Type of output times
+ * @tparam T_Args Types of pass-through parameters of a subject
+ *
+ * @param function_name Calling function name (for printing debugging messages)
+ * @param f Right hand side of the ODE
+ * @param y0s Initial state of each subject
+ * @param t0 Initial time, shared by all subjects
+ * @param ts Times at which to solve the ODE of each subject
+ * @param relative_tolerance Relative tolerance passed to CVODES
+ * @param absolute_tolerance Absolute tolerance passed to CVODES
+ * @param max_num_steps Upper limit on the number of integration steps to
+ *   take between each output (error if exceeded)
+ * @param[in, out] msgs the print stream for warning messages
+ * @param args Extra arguments of each subject passed unmodified through to
+ *   the ODE right hand side
+ * @return Solution of the ODE of each subject at its times
+ */
+template <int Lmm, typename F, typename T_y0, typename T_t0, typename T_ts,
+          typename... T_Args, require_eigen_col_vector_t<T_y0>* = nullptr>
+std::vector<std::vector<Eigen::Matrix<
+    stan::return_type_t<T_y0, T_t0, T_ts, T_Args...>, Eigen::Dynamic, 1>>>
+ode_cvodes_batch_impl(const char* function_name, const F& f,
+                      const std::vector<T_y0>& y0s, const T_t0& t0,
+                      const std::vector<std::vector<T_ts>>& ts,
+                      double relative_tolerance, double absolute_tolerance,
+                      long int max_num_steps,  // NOLINT(runtime/int)
+                      std::ostream* msgs, const std::vector<T_Args>&... args) {
+  using T_Return = return_type_t<T_y0, T_t0, T_ts, T_Args...>;
+  using T_y0_t0 = return_type_t<T_y0, T_t0>;
+  using integrator_t = cvodes_integrator<Lmm, F, T_y0, T_t0, T_ts, T_Args...>;
+
+  const size_t num_subjects = y0s.size();
+  check_size_match(function_name, "number of times", ts.size(),
+                   "number of initial states", num_subjects);
+  std::vector<int> unused_temp{
+      0, (check_size_match(function_name, "number of ode parameters and data",
+                           args.size(), "number of initial states",
+                           num_subjects),
+          0)...};
+
+  std::vector<std::vector<std::vector<double>>> coupled_states(num_subjects);
+  auto execute_chunk = [&](std::size_t start, std::size_t end) -> void {
+    for (std::size_t i = start; i != end; ++i) {
+      nested_rev_autodiff nested;
+      integrator_t integrator(function_name, f, y0s[i], t0, ts[i],
+                              relative_tolerance, absolute_tolerance,
+                              max_num_steps, msgs, args[i]...);
+      auto service = sundials_service_pool<cvodes_service<Lmm>>::instance()
+                         .acquire(static_cast<size_t>(y0s[i].size()),
+                                  integrator.num_sensitivities(),
+                                  integrator.bandwidth().lower,
+                                  integrator.bandwidth().upper);
+      coupled_states[i] = integrator.integrate(*service);
+    }
+  };
+
+#ifdef STAN_THREADS
+  // task isolation keeps the thread local AD tape of each worker from
+  // being used by other tasks, see map_rect_concurrent
+  tbb::this_task_arena::isolate([&] {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, num_subjects),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                        execute_chunk(r.begin(), r.end());
+                      });
+  });
+#else
+  execute_chunk(0, num_subjects);
+#endif
+
+  std::vector<std::vector<Eigen::Matrix<T_Return, Eigen::Dynamic, 1>>> ys(
+      num_subjects);
+  for (size_t i = 0; i < num_subjects; ++i) {
+    const Eigen::Matrix<T_y0_t0, Eigen::Dynamic, 1> y0
+        = y0s[i].template cast<T_y0_t0>();
+    ys[i].reserve(ts[i].size());
+    for (size_t n = 0; n < ts[i].size(); ++n) {
+      ys[i].emplace_back(ode_store_sensitivities(
+          f, coupled_states[i][n], y0, t0, ts[i][n], msgs, args[i]...));
+    }
+  }
+  return ys;
+}
+
+}  // namespace internal
+
+/**
+ * Solve the ODE initial value problems y_i' = f(t, y_i, args_i...),
+ * y_i(t0) = y0_i of a batch of subjects that share the right hand side
+ * \p f, each at its own set of times, using the stiff backward
+ * differentiation formula (BDF) solver in CVODES.
+ *
+ * This is equivalent to calling <code>ode_bdf_tol</code> for every
+ * subject, but the CVODES workspaces are reused across subjects and,
+ * when <code>STAN_THREADS</code> is defined, subjects are solved in
+ * parallel.
+ *
+ * \p f must define an operator() with the signature as:
+ *   template<typename T_t, typename T_y, typename... T_Args>
+ *   Eigen::Matrix<stan::return_type_t<T_t, T_y, T_Args...>, Eigen::Dynamic, 1>
+ *     operator()(const T_t& t, const Eigen::Matrix<T_y, Eigen::Dynamic, 1>& y,
+ *     std::ostream* msgs, const T_Args&... args);
+ *
+ * @tparam F Type of ODE right hand side
+ * @tparam T_y0 Type of initial state of a subject
+ * @tparam T_t0 Type of initial time
+ * @tparam T_ts Type of output times
+ * @tparam T_Args Types of pass-through parameters of a subject
+ *
+ * @param f Right hand side of the ODE
+ * @param y0s Initial state of each subject
+ * @param t0 Initial time, shared by all subjects
+ * @param ts Times at which to solve the ODE of each subject. All values must
+ *   be sorted and not less than t0.
+ * @param relative_tolerance Relative tolerance passed to CVODES
+ * @param absolute_tolerance Absolute tolerance passed to CVODES
+ * @param max_num_steps Upper limit on the number of integration steps to
+ *   take between each output (error if exceeded)
+ * @param[in, out] msgs the print stream for warning messages
+ * @param args Extra arguments of each subject, each a std::vector with one
+ *   element per subject, passed through to the ODE right hand side
+ * @return Solution of the ODE of each subject at its times
+ */
+template <typename F, typename T_y0, typename T_t0, typename T_ts,
+          typename... T_Args, require_eigen_col_vector_t<T_y0>* = nullptr>
+std::vector<std::vector<Eigen::Matrix<
+    stan::return_type_t<T_y0, T_t0, T_ts, T_Args...>, Eigen::Dynamic, 1>>>
+ode_bdf_batch_tol(const F& f, const std::vector<T_y0>& y0s, const T_t0& t0,
+                  const std::vector<std::vector<T_ts>>& ts,
+                  double relative_tolerance, double absolute_tolerance,
+                  long int max_num_steps,  // NOLINT(runtime/int)
+                  std::ostream* msgs, const std::vector<T_Args>&... args) {
+  return internal::ode_cvodes_batch_impl<CV_BDF>(
+      "ode_bdf_batch_tol", f, y0s, t0, ts, relative_tolerance,
+      absolute_tolerance, max_num_steps, msgs, args...);
+}
+
+/**
+ * Solve the ODE initial value problems of a batch of subjects that share
+ * the right hand side \p f using the non-stiff Adams-Moulton solver in
+ * CVODES. See <code>ode_bdf_batch_tol</code> for the arguments.
+ */
+template <typename F, typename T_y0, typename T_t0, typename T_ts,
+          typename... T_Args, require_eigen_col_vector_t<T_y0>* = nullptr>
+std::vector<std::vector<Eigen::Matrix<
+    stan::return_type_t<T_y0, T_t0, T_ts, T_Args...>, Eigen::Dynamic, 1>>>
+ode_adams_batch_tol(const F& f, const std::vector<T_y0>& y0s, const T_t0& t0,
+                    const std::vector<std::vector<T_ts>>& ts,
+                    double relative_tolerance, double absolute_tolerance,
+                    long int max_num_steps,  // NOLINT(runtime/int)
+                    std::ostream* msgs, const std::vector<T_Args>&... args) {
+  return internal::ode_cvodes_batch_impl<CV_ADAMS>(
+      "ode_adams_batch_tol", f, y0s, t0, ts, relative_tolerance,
+      absolute_tolerance, max_num_steps, msgs, args...);
+}
+
+/**
+ * Solve the ODE initial value problems of a batch of subjects that share
+ * the right hand side \p f using the BDF solver in CVODES with the
+ * defaults of <code>ode_bdf</code> for relative_tolerance,
+ * absolute_tolerance, and max_num_steps. See
+ * <code>ode_bdf_batch_tol</code> for the arguments.
+ */
+template <typename F, typename T_y0, typename T_t0, typename T_ts,
+          typename... T_Args, require_eigen_col_vector_t<T_y0>* = nullptr>
+std::vector<std::vector<Eigen::Matrix<
+    stan::return_type_t<T_y0, T_t0, T_ts, T_Args...>, Eigen::Dynamic, 1>>>
+ode_bdf_batch(const F& f, const std::vector<T_y0>& y0s, const T_t0& t0,
+              const std::vector<std::vector<T_ts>>& ts, std::ostream* msgs,
+              const std::vector<T_Args>&... args) {
+  double relative_tolerance = 1e-10;
+  double absolute_tolerance = 1e-10;
+  long int max_num_steps = 1e8;  // NOLINT(runtime/int)
+
+  return internal::ode_cvodes_batch_impl<CV_BDF>(
+      "ode_bdf_batch", f, y0s, t0, ts, relative_tolerance, absolute_tolerance,
+      max_num_steps, msgs, args...);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
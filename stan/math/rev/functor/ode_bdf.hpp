@@ -22,6 +22,10 @@ namespace math {
  *     operator()(const T_t& t, const Eigen::Matrix<T_y, Eigen::Dynamic, 1>& y,
  *     std::ostream* msgs, const T_Args&... args);
  *
+ * \p f may also provide the Jacobian of the right hand side with respect
+ * to the states, or its products with vectors, which are then used
+ * instead of autodiff (see <code>has_ode_jacobian</code>).
+ *
  * t is the time, y is the vector-valued state, msgs is a stream for error
  * messages, and args are optional arguments passed to the ODE solve function
  * (which are passed through to \p f without modification).
@@ -0,0 +1,195 @@
+#ifndef STAN_MATH_REV_FUNCTOR_ODE_EVENTS_HPP
+#define STAN_MATH_REV_FUNCTOR_ODE_EVENTS_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/functor/cvodes_integrator.hpp>
+#include <stan/math/rev/functor/cvodes_service.hpp>
+#include <stan/math/rev/functor/sundials_service_pool.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/functor/apply.hpp>
+#include <stan/math/prim/functor/ode_events.hpp>
+#include <ostream>
+#include <tuple>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Solve an ODE with a schedule of events with the CVODES method
+ * \p Lmm. See <code>ode_bdf_events_tol</code>.
+ */
+template <int Lmm, typename F, typename T_y0, typename T_ts, typename T_bolus,
+          typename T_rate, typename... T_Args,
+          require_eigen_col_vector_t<T_y0>* = nullptr>
+std::vector<Eigen::Matrix<
+    return_type_t<T_y0, T_ts, T_bolus, T_rate, T_Args...>, Eigen::Dynamic, 1>>
+ode_cvodes_events_impl(
+    const char* function_name, const F& f, const T_y0& y0, double t0,
+    const std::vector<T_ts>& ts, const std::vector<double>& event_times,
+    const std::vector<Eigen::Matrix<T_bolus, Eigen::Dynamic, 1>>& bolus,
+    const std::vector<Eigen::Matrix<T_rate, Eigen::Dynamic, 1>>& rates,
+    double relative_tolerance, double absolute_tolerance,
+    long int max_num_steps,  // NOLINT(runtime/int)
+    std::ostream* msgs, const T_Args&... args) {
+  using bolus_t = std::vector<Eigen::Matrix<T_bolus, Eigen::Dynamic, 1>>;
+  using rate_t = std::vector<Eigen::Matrix<T_rate, Eigen::Dynamic, 1>>;
+  const size_t N = y0.size();
+  internal::ode_events_check(function_name, N, t0, event_times, bolus, rates);
+
+  int segment = -1;
+  const ode_events_rhs<F> f_events{f, segment};
+  const auto& args_ref_tuple = std::make_tuple(to_ref(args)...);
+  return math::apply(
+      [&](const auto&... args_refs) {
+        cvodes_integrator<Lmm, ode_events_rhs<F>, T_y0, double, T_ts, bolus_t,
+                          rate_t, ref_type_t<T_Args>...>
+            integrator(function_name, f_events, y0, t0, ts,
+                       relative_tolerance, absolute_tolerance, max_num_steps,
+                       msgs, bolus, rates, args_refs...);
+
+        const size_t num_y0_vars = count_vars(y0);
+        const std::vector<std::vector<double>> coupled_states
+            = integrator.integrate(
+                *sundials_service_pool<cvodes_service<Lmm>>::instance()
+                     .acquire(N, integrator.num_sensitivities(),
+                              integrator.bandwidth().lower,
+                              integrator.bandwidth().upper),
+                event_times,
+                [&](size_t e, std::vector<double>& coupled_state) {
+                  ode_events_apply(coupled_state, N, num_y0_vars, bolus, e);
+                  segment = e;
+                });
+
+        const Eigen::Matrix<return_type_t<T_y0, double>, Eigen::Dynamic, 1>
+            y0_t0 = y0;
+        std::vector<Eigen::Matrix<
+            return_type_t<T_y0, T_ts, T_bolus, T_rate, T_Args...>,
+            Eigen::Dynamic, 1>>
+            y;
+        y.reserve(ts.size());
+        for (size_t n = 0; n < ts.size(); ++n) {
+          // the derivative with respect to an output time is the right hand
+          // side with the rate active at that time
+          segment = ode_events_segment(event_times, value_of(ts[n]));
+          y.emplace_back(ode_store_sensitivities(f_events, coupled_states[n],
+                                                 y0_t0, t0, ts[n], msgs, bolus,
+                                                 rates, args_refs...));
+        }
+        return y;
+      },
+      args_ref_tuple);
+}
+
+}  // namespace internal
+
+/**
+ * Solve the ODE initial value problem y' = f(t, y), y(t0) = y0 at a set of
+ * times, { t1, t2, t3, ... } with a schedule of events using the stiff
+ * backward differentiation formula (BDF) solver in CVODES.
+ *
+ * At each event time t_e the bolus b_e is added to the state and the
+ * input rate r_e replaces the rate of the previous event, so that between
+ * event e and event e + 1 the state follows y' = f(t, y) + r_e. A dosing
+ * history of boluses and infusions therefore takes a single solve, with
+ * one CVODES workspace and one set of output vars. CVODES is stopped
+ * exactly at every event time and reinitialized there with the jumped
+ * state and sensitivities, so no step crosses a discontinuity. The
+ * solution at an output time equal to an event time is taken before the
+ * event, and events at or after the last output time are ignored.
+ *
+ * \p f must define an operator() with the same signature as for
+ * <code>ode_bdf</code>, and may provide its Jacobian in the same way.
+ *
+ * @tparam F Type of ODE right hand side
+ * @tparam T_y0 Type of initial state
+ * @tparam T_ts Type of output times
+ * @tparam T_bolus Type of scalars of the boluses
+ * @tparam T_rate Type of scalars of the rates
+ * @tparam T_Args Types of pass-through parameters
+ *
+ * @param f Right hand side of the ODE
+ * @param y0 Initial state
+ * @param t0 Initial time
+ * @param ts Times at which to solve the ODE at. All values must be sorted and
+ *   greater than t0.
+ * @param event_times Sorted times of the events, not less than t0
+ * @param bolus Bolus added to the state at each event
+ * @param rates Input rate active from each event until the next one
+ * @param relative_tolerance Relative tolerance passed to CVODES
+ * @param absolute_tolerance Absolute tolerance passed to CVODES
+ * @param max_num_steps Upper limit on the number of integration steps to
+ *   take between each output (error if exceeded)
+ * @param[in, out] msgs the print stream for warning messages
+ * @param args Extra arguments passed unmodified through to ODE right hand side
+ * @return Solution to ODE at times \p ts
+ */
+template <typename F, typename T_y0, typename T_ts, typename T_bolus,
+          typename T_rate, typename... T_Args,
+          require_eigen_col_vector_t<T_y0>* = nullptr>
+std::vector<Eigen::Matrix<
+    return_type_t<T_y0, T_ts, T_bolus, T_rate, T_Args...>, Eigen::Dynamic, 1>>
+ode_bdf_events_tol(
+    const F& f, const T_y0& y0, double t0, const std::vector<T_ts>& ts,
+    const std::vector<double>& event_times,
+    const std::vector<Eigen::Matrix<T_bolus, Eigen::Dynamic, 1>>& bolus,
+    const std::vector<Eigen::Matrix<T_rate, Eigen::Dynamic, 1>>& rates,
+    double relative_tolerance, double absolute_tolerance,
+    long int max_num_steps,  // NOLINT(runtime/int)
+    std::ostream* msgs, const T_Args&... args) {
+  return internal::ode_cvodes_events_impl<CV_BDF>(
+      "ode_bdf_events_tol", f, y0, t0, ts, event_times, bolus, rates,
+      relative_tolerance, absolute_tolerance, max_num_steps, msgs, args...);
+}
+
+/**
+ * Solve the ODE initial value problem y' = f(t, y), y(t0) = y0 at a set of
+ * times, { t1, t2, t3, ... } with a schedule of events using the non-stiff
+ * Adams-Moulton solver in CVODES. See <code>ode_bdf_events_tol</code>.
+ *
+ * @tparam F Type of ODE right hand side
+ * @tparam T_y0 Type of initial state
+ * @tparam T_ts Type of output times
+ * @tparam T_bolus Type of scalars of the boluses
+ * @tparam T_rate Type of scalars of the rates
+ * @tparam T_Args Types of pass-through parameters
+ *
+ * @param f Right hand side of the ODE
+ * @param y0 Initial state
+ * @param t0 Initial time
+ * @param ts Times at which to solve the ODE at. All values must be sorted and
+ *   greater than t0.
+ * @param event_times Sorted times of the events, not less than t0
+ * @param bolus Bolus added to the state at each event
+ * @param rates Input rate active from each event until the next one
+ * @param relative_tolerance Relative tolerance passed to CVODES
+ * @param absolute_tolerance Absolute tolerance passed to CVODES
+ * @param max_num_steps Upper limit on the number of integration steps to
+ *   take between each output (error if exceeded)
+ * @param[in, out] msgs the print stream for warning messages
+ * @param args Extra arguments passed unmodified through to ODE right hand side
+ * @return Solution to ODE at times \p ts
+ */
+template <typename F, typename T_y0, typename T_ts, typename T_bolus,
+          typename T_rate, typename... T_Args,
+          require_eigen_col_vector_t<T_y0>* = nullptr>
+std::vector<Eigen::Matrix<
+    return_type_t<T_y0, T_ts, T_bolus, T_rate, T_Args...>, Eigen::Dynamic, 1>>
+ode_adams_events_tol(
+    const F& f, const T_y0& y0, double t0, const std::vector<T_ts>& ts,
+    const std::vector<double>& event_times,
+    const std::vector<Eigen::Matrix<T_bolus, Eigen::Dynamic, 1>>& bolus,
+    const std::vector<Eigen::Matrix<T_rate, Eigen::Dynamic, 1>>& rates,
+    double relative_tolerance, double absolute_tolerance,
+    long int max_num_steps,  // NOLINT(runtime/int)
+    std::ostream* msgs, const T_Args&... args) {
+  return internal::ode_cvodes_events_impl<CV_ADAMS>(
+      "ode_adams_events_tol", f, y0, t0, ts, event_times, bolus, rates,
+      relative_tolerance, absolute_tolerance, max_num_steps, msgs, args...);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
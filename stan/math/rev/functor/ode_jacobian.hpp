@@ -0,0 +1,182 @@
+#ifndef STAN_MATH_REV_FUNCTOR_ODE_JACOBIAN_HPP
+#define STAN_MATH_REV_FUNCTOR_ODE_JACOBIAN_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/jacobian.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/functor/apply.hpp>
+#include <ostream>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+template <typename, typename F, typename... Args>
+struct has_ode_jacobian_impl : std::false_type {};
+
+template <typename F, typename... Args>
+struct has_ode_jacobian_impl<
+    void_t<decltype(std::declval<const F&>().jacobian(
+        std::declval<double>(), std::declval<const Eigen::VectorXd&>(),
+        std::declval<std::ostream*>(), std::declval<const Args&>()...))>,
+    F, Args...> : std::true_type {};
+
+template <typename, typename F, typename... Args>
+struct has_ode_jacobian_vector_product_impl : std::false_type {};
+
+template <typename F, typename... Args>
+struct has_ode_jacobian_vector_product_impl<
+    void_t<decltype(std::declval<const F&>().jacobian_vector_product(
+        std::declval<double>(), std::declval<const Eigen::VectorXd&>(),
+        std::declval<const Eigen::VectorXd&>(), std::declval<std::ostream*>(),
+        std::declval<const Args&>()...))>,
+    F, Args...> : std::true_type {};
+
+}  // namespace internal
+
+/**
+ * Checks whether the ODE right hand side \p F provides the Jacobian of
+ * the right hand side with respect to the states through a member
+ *
+ * <code>
+ *   Eigen::MatrixXd jacobian(double t, const Eigen::VectorXd& y,
+ *     std::ostream* msgs, const Args&... args) const;
+ * </code>
+ *
+ * @tparam F type of ODE right hand side
+ * @tparam Args types of the (arithmetic) arguments of the right hand side
+ */
+template <typename F, typename... Args>
+using has_ode_jacobian = internal::has_ode_jacobian_impl<void, F, Args...>;
+
+/**
+ * Checks whether the ODE right hand side \p F provides the product of the
+ * Jacobian of the right hand side with respect to the states with a
+ * vector through a member
+ *
+ * <code>
+ *   Eigen::VectorXd jacobian_vector_product(double t,
+ *     const Eigen::VectorXd& y, const Eigen::VectorXd& v,
+ *     std::ostream* msgs, const Args&... args) const;
+ * </code>
+ *
+ * @tparam F type of ODE right hand side
+ * @tparam Args types of the (arithmetic) arguments of the right hand side
+ */
+template <typename F, typename... Args>
+using has_ode_jacobian_vector_product
+    = internal::has_ode_jacobian_vector_product_impl<void, F, Args...>;
+
+/**
+ * Returns the Jacobian of the ODE right hand side \p f with respect to the
+ * states at time \p t and state \p y.
+ *
+ * The analytic Jacobian of \p f is used if it provides one, otherwise it
+ * is assembled column by column from its Jacobian-vector products if it
+ * provides those, and otherwise it is computed with reverse mode
+ * autodiff, one sweep per state.
+ *
+ * @tparam F type of ODE right hand side
+ * @tparam Args types of the arguments of the right hand side
+ * @param function_name name of the calling function
+ * @param f ODE right hand side
+ * @param t time
+ * @param y state
+ * @param msgs stream for messages
+ * @param args_tuple tuple of the arithmetic arguments of the right hand
+ * side
+ * @return N by N Jacobian
+ * @throw std::invalid_argument if the provided Jacobian has the wrong size
+ */
+template <typename F, typename... Args>
+inline Eigen::MatrixXd ode_state_jacobian(
+    const char* function_name, const F& f, double t, const Eigen::VectorXd& y,
+    std::ostream* msgs, const std::tuple<Args...>& args_tuple) {
+  const int N = y.size();
+  if constexpr (has_ode_jacobian<F, Args...>::value) {
+    Eigen::MatrixXd J = math::apply(
+        [&](auto&&... args) { return f.jacobian(t, y, msgs, args...); },
+        args_tuple);
+    check_size_match(function_name, "rows of Jacobian", J.rows(), "states",
+                     N);
+    check_size_match(function_name, "columns of Jacobian", J.cols(),
+                     "states", N);
+    return J;
+  } else if constexpr (has_ode_jacobian_vector_product<F, Args...>::value) {
+    Eigen::MatrixXd J(N, N);
+    Eigen::VectorXd e = Eigen::VectorXd::Zero(N);
+    for (int j = 0; j < N; ++j) {
+      e.coeffRef(j) = 1.0;
+      J.col(j) = math::apply(
+          [&](auto&&... args) {
+            return f.jacobian_vector_product(t, y, e, msgs, args...);
+          },
+          args_tuple);
+      e.coeffRef(j) = 0.0;
+    }
+    return J;
+  } else {
+    Eigen::VectorXd fy;
+    Eigen::MatrixXd J;
+    jacobian(
+        [&](const Eigen::Matrix<var, Eigen::Dynamic, 1>& y_var) {
+          return math::apply(
+              [&](auto&&... args) { return f(t, y_var, msgs, args...); },
+              args_tuple);
+        },
+        y, fy, J);
+    check_size_match(function_name, "dy_dt", fy.size(), "states", N);
+    return J;
+  }
+}
+
+/**
+ * Returns the product of the Jacobian of the ODE right hand side \p f with
+ * respect to the states at time \p t and state \p y with the matrix \p S,
+ * computed from the Jacobian or the Jacobian-vector products provided by
+ * \p f. Must only be called if \p f provides one of them.
+ *
+ * @tparam F type of ODE right hand side
+ * @tparam Args types of the arguments of the right hand side
+ * @param f ODE right hand side
+ * @param t time
+ * @param y state
+ * @param S matrix with N rows
+ * @param msgs stream for messages
+ * @param args_tuple tuple of the arithmetic arguments of the right hand
+ * side
+ * @return product of the Jacobian with \p S
+ */
+template <typename F, typename EigMat, typename... Args,
+          require_eigen_t<EigMat>* = nullptr>
+inline Eigen::MatrixXd ode_state_jacobian_product(
+    const F& f, double t, const Eigen::VectorXd& y, const EigMat& S,
+    std::ostream* msgs, const std::tuple<Args...>& args_tuple) {
+  if constexpr (has_ode_jacobian<F, Args...>::value) {
+    return ode_state_jacobian("ode_state_jacobian_product", f, t, y, msgs,
+                              args_tuple)
+           * S;
+  } else {
+    static_assert(has_ode_jacobian_vector_product<F, Args...>::value,
+                  "the ODE right hand side provides no Jacobian");
+    Eigen::MatrixXd JS(y.size(), S.cols());
+    for (int j = 0; j < S.cols(); ++j) {
+      const Eigen::VectorXd v = S.col(j);
+      JS.col(j) = math::apply(
+          [&](auto&&... args) {
+            return f.jacobian_vector_product(t, y, v, msgs, args...);
+          },
+          args_tuple);
+    }
+    return JS;
+  }
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,192 @@
+#ifndef STAN_MATH_REV_FUNCTOR_ODE_LINEAR_HPP
+#define STAN_MATH_REV_FUNCTOR_ODE_LINEAR_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/matrix_exp.hpp>
+#include <stan/math/prim/functor/ode_linear.hpp>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Returns the adjoint of the matrix \p X given the adjoint \p adj_E of
+ * its exponential E = exp(X), which is the Frechet derivative of the
+ * matrix exponential at X^T in the direction \p adj_E. It is the upper
+ * right block of the exponential of the block matrix
+ * \f[
+ *   \left[ \begin{array}{cc} X^T & \bar{E} \\ 0 & X^T \end{array}
+ *   \right].
+ * \f]
+ *
+ * @param X matrix
+ * @param adj_E adjoint of the exponential of \p X
+ * @return adjoint of \p X
+ */
+inline Eigen::MatrixXd matrix_exp_adjoint(const Eigen::MatrixXd& X,
+                                          const Eigen::MatrixXd& adj_E) {
+  const int N = X.rows();
+  Eigen::MatrixXd B = Eigen::MatrixXd::Zero(2 * N, 2 * N);
+  B.topLeftCorner(N, N) = X.transpose();
+  B.bottomRightCorner(N, N) = X.transpose();
+  B.topRightCorner(N, N) = adj_E;
+  return matrix_exp(B).topRightCorner(N, N);
+}
+
+}  // namespace internal
+
+/**
+ * Solve the linear time-invariant ODE initial value problem
+ * y' = A y + b, y(t0) = y0 at a set of times { t1, t2, t3, ... }. See
+ * the <code>prim</code> version for the method.
+ *
+ * The gradients are computed analytically in a single reverse pass. The
+ * adjoint of the state is propagated backwards through the transposed
+ * propagators, and the adjoints of the propagators of all steps of the
+ * same length are summed, so that the adjoint of the augmented system
+ * matrix needs one Frechet derivative of the matrix exponential
+ * (<code>internal::matrix_exp_adjoint</code>) per distinct step. The
+ * derivative of the solution with respect to a step is the right hand
+ * side of the ODE at the end of the step.
+ *
+ * @tparam T_A type of system matrix
+ * @tparam T_b type of input vector
+ * @tparam T_y0 type of initial state
+ * @tparam T_t0 type of initial time
+ * @tparam T_ts type of output times
+ * @param A N by N system matrix
+ * @param b input vector of size N
+ * @param y0 initial state of size N
+ * @param t0 initial time
+ * @param ts times at which to return the solution. All values must be
+ *   sorted and greater than t0.
+ * @return solution of the ODE at the times \p ts
+ * @throw std::invalid_argument if A is not square or the sizes of A, b
+ *   and y0 do not match
+ * @throw std::domain_error if any argument is not finite, the times are
+ *   not sorted or not greater than t0
+ */
+template <typename T_A, typename T_b, typename T_y0, typename T_t0,
+          typename T_ts, require_eigen_t<T_A>* = nullptr,
+          require_all_eigen_col_vector_t<T_b, T_y0>* = nullptr,
+          require_any_st_var<T_A, T_b, T_y0, T_t0, T_ts>* = nullptr>
+inline std::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>> ode_linear(
+    const T_A& A, const T_b& b, const T_y0& y0, const T_t0& t0,
+    const std::vector<T_ts>& ts) {
+  static constexpr const char* function_name = "ode_linear";
+  static constexpr bool is_var_M = is_var<scalar_type_t<T_A>>::value
+                                   || is_var<scalar_type_t<T_b>>::value;
+  static constexpr bool is_var_time
+      = is_var<T_t0>::value || is_var<T_ts>::value;
+
+  arena_t<T_A> arena_A = A;
+  arena_t<T_b> arena_b = b;
+  arena_t<T_y0> arena_y0 = y0;
+  arena_t<std::vector<T_ts>> arena_ts = to_arena(ts);
+  internal::ode_linear_check(function_name, arena_A, arena_b, arena_y0, t0,
+                             ts);
+
+  const int N = arena_y0.size();
+  const int T = ts.size();
+  arena_t<Eigen::MatrixXd> M
+      = internal::ode_linear_augmented(value_of(arena_A), value_of(arena_b));
+
+  // index of the distinct step of each output time
+  arena_t<std::vector<int>> step_index(T);
+  arena_t<std::vector<double>> steps;
+  double t_prev = value_of(t0);
+  for (int n = 0; n < T; ++n) {
+    const double h = value_of(arena_ts[n]) - t_prev;
+    if (steps.empty()
+        || !internal::ode_linear_same_step(h, steps.back(),
+                                           value_of(arena_ts[n]))) {
+      steps.push_back(h);
+    }
+    step_index[n] = steps.size() - 1;
+    t_prev = value_of(arena_ts[n]);
+  }
+
+  // propagators of the distinct steps side by side, and the augmented
+  // states z = [y; 1] at t0 and every output time
+  const int K = steps.size();
+  arena_t<Eigen::MatrixXd> E(N + 1, K * (N + 1));
+  for (int k = 0; k < K; ++k) {
+    E.middleCols(k * (N + 1), N + 1) = matrix_exp(steps[k] * M);
+  }
+  arena_t<Eigen::MatrixXd> Z(N + 1, T + 1);
+  Z.col(0).head(N) = value_of(arena_y0);
+  Z.coeffRef(N, 0) = 1.0;
+  for (int n = 0; n < T; ++n) {
+    Z.col(n + 1).noalias()
+        = E.middleCols(step_index[n] * (N + 1), N + 1) * Z.col(n);
+  }
+
+  arena_t<Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>> y
+      = Z.rightCols(T).topRows(N);
+
+  reverse_pass_callback([arena_A, arena_b, arena_y0, t0, arena_ts, M, E, Z,
+                         y, steps, step_index, N, T, K]() mutable {
+    Eigen::VectorXd adj_z = Eigen::VectorXd::Zero(N + 1);
+    Eigen::MatrixXd adj_E;
+    if constexpr (is_var_M) {
+      adj_E = Eigen::MatrixXd::Zero(N + 1, K * (N + 1));
+    }
+    for (int n = T - 1; n >= 0; --n) {
+      adj_z.head(N) += y.col(n).adj();
+      const int k = step_index[n];
+      if constexpr (is_var_M) {
+        adj_E.middleCols(k * (N + 1), N + 1).noalias()
+            += adj_z * Z.col(n).transpose();
+      }
+      if constexpr (is_var_time) {
+        // d z_{n + 1} / d h = M z_{n + 1}
+        const double adj_h = adj_z.dot(M * Z.col(n + 1));
+        if constexpr (is_var<T_ts>::value) {
+          arena_ts[n].adj() += adj_h;
+          if (n > 0) {
+            arena_ts[n - 1].adj() -= adj_h;
+          }
+        }
+        if constexpr (is_var<T_t0>::value) {
+          if (n == 0) {
+            t0.adj() -= adj_h;
+          }
+        }
+      }
+      adj_z = E.middleCols(k * (N + 1), N + 1).transpose() * adj_z;
+    }
+
+    if constexpr (is_var<scalar_type_t<T_y0>>::value) {
+      arena_y0.adj() += adj_z.head(N);
+    }
+    if constexpr (is_var_M) {
+      Eigen::MatrixXd adj_M = Eigen::MatrixXd::Zero(N + 1, N + 1);
+      for (int k = 0; k < K; ++k) {
+        adj_M += steps[k]
+                 * internal::matrix_exp_adjoint(
+                     steps[k] * M, adj_E.middleCols(k * (N + 1), N + 1));
+      }
+      if constexpr (is_var<scalar_type_t<T_A>>::value) {
+        arena_A.adj() += adj_M.topLeftCorner(N, N);
+      }
+      if constexpr (is_var<scalar_type_t<T_b>>::value) {
+        arena_b.adj() += adj_M.col(N).head(N);
+      }
+    }
+  });
+
+  std::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>> y_ret(T);
+  for (int n = 0; n < T; ++n) {
+    y_ret[n] = y.col(n);
+  }
+  return y_ret;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
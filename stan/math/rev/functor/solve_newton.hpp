@@ -2,6 +2,7 @@
 #define STAN_MATH_REV_FUNCTOR_SOLVE_NEWTON_HPP
 
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/algebra_solver_warm_start.hpp>
 #include <stan/math/rev/functor/algebra_system.hpp>
 #include <stan/math/rev/functor/kinsol_solve.hpp>
 #include <stan/math/prim/err.hpp>
@@ -17,6 +18,105 @@
 namespace stan {
 namespace math {
 
+namespace internal {
+
+/**
+ * Check the arguments and solve the algebraic system with KINSOL, warm
+ * started from \p warm_start unless it is null. See
+ * <code>solve_newton_tol</code> for the arguments.
+ */
+template <typename F, typename... Args>
+Eigen::VectorXd solve_newton_values(const F& f, const Eigen::VectorXd& x,
+                                    const double scaling_step_size,
+                                    const double function_tolerance,
+                                    const int64_t max_num_steps,
+                                    algebra_solver_warm_start* warm_start,
+                                    std::ostream* const msgs,
+                                    const Args&... args) {
+  check_nonzero_size("solve_newton", "initial guess", x);
+  check_finite("solve_newton", "initial guess", x);
+  check_nonnegative("solve_newton", "scaling_step_size", scaling_step_size);
+  check_nonnegative("solve_newton", "function_tolerance", function_tolerance);
+  check_positive("solve_newton", "max_num_steps", max_num_steps);
+
+  if (warm_start == nullptr) {
+    return kinsol_solve(f, x, scaling_step_size, function_tolerance,
+                        max_num_steps, 1, 10, KIN_LINESEARCH, msgs, args...);
+  }
+  return kinsol_solve(f, x, scaling_step_size, function_tolerance,
+                      max_num_steps, 1, 10, KIN_LINESEARCH, *warm_start, msgs,
+                      args...);
+}
+
+/**
+ * Solve the algebraic system with KINSOL and register the adjoint of the
+ * solution with respect to the var parameters, warm started from
+ * \p warm_start unless it is null. See <code>solve_newton_tol</code> for
+ * the arguments.
+ */
+template <typename F, typename T, typename... T_Args>
+Eigen::Matrix<var, Eigen::Dynamic, 1> solve_newton_tol_var(
+    const F& f, const T& x, const double scaling_step_size,
+    const double function_tolerance, const int64_t max_num_steps,
+    algebra_solver_warm_start* warm_start, std::ostream* const msgs,
+    const T_Args&... args) {
+  const auto& x_ref = to_ref(value_of(x));
+  auto arena_args_tuple = make_chainable_ptr(std::make_tuple(eval(args)...));
+  auto args_vals_tuple = math::apply(
+      [&](const auto&... args) {
+        return std::make_tuple(to_ref(value_of(args))...);
+      },
+      *arena_args_tuple);
+
+  // Solve the system
+  Eigen::VectorXd theta_dbl = math::apply(
+      [&](const auto&... vals) {
+        return solve_newton_values(f, x_ref, scaling_step_size,
+                                   function_tolerance, max_num_steps,
+                                   warm_start, msgs, vals...);
+      },
+      args_vals_tuple);
+
+  auto f_wrt_x = [&](const auto& x) {
+    return math::apply([&](const auto&... args) { return f(x, msgs, args...); },
+                       args_vals_tuple);
+  };
+
+  Eigen::MatrixXd Jf_x;
+  Eigen::VectorXd f_x;
+
+  jacobian(f_wrt_x, theta_dbl, f_x, Jf_x);
+
+  using ret_type = Eigen::Matrix<var, Eigen::Dynamic, -1>;
+  arena_t<ret_type> ret = theta_dbl;
+  auto Jf_x_T_lu_ptr
+      = make_unsafe_chainable_ptr(Jf_x.transpose().partialPivLu());  // Lu
+
+  reverse_pass_callback(
+      [f, ret, arena_args_tuple, Jf_x_T_lu_ptr, msgs]() mutable {
+        Eigen::VectorXd eta = -Jf_x_T_lu_ptr->solve(ret.adj().eval());
+
+        // Contract with Jacobian of f with respect to y using a nested reverse
+        // autodiff pass.
+        {
+          nested_rev_autodiff rev;
+
+          Eigen::VectorXd ret_val = ret.val();
+          auto x_nrad_ = math::apply(
+              [&ret_val, &f, msgs](const auto&... args) {
+                return eval(f(ret_val, msgs, args...));
+              },
+              *arena_args_tuple);
+          x_nrad_.adj() = eta;
+          grad();
+        }
+      });
+
+  return ret_type(ret);
+}
+
+}  // namespace internal
+
 /**
  * Return the solution to the specified system of algebraic
  * equations given an initial guess, and parameters and data,
@@ -62,16 +162,9 @@ Eigen::VectorXd solve_newton_tol(const F& f, const T& x,
                                  const int64_t max_num_steps,
                                  std::ostream* const msgs,
                                  const Args&... args) {
-  const auto& x_ref = to_ref(value_of(x));
-
-  check_nonzero_size("solve_newton", "initial guess", x_ref);
-  check_finite("solve_newton", "initial guess", x_ref);
-  check_nonnegative("solve_newton", "scaling_step_size", scaling_step_size);
-  check_nonnegative("solve_newton", "function_tolerance", function_tolerance);
-  check_positive("solve_newton", "max_num_steps", max_num_steps);
-
-  return kinsol_solve(f, x_ref, scaling_step_size, function_tolerance,
-                      max_num_steps, 1, 10, KIN_LINESEARCH, msgs, args...);
+  return internal::solve_newton_values(f, to_ref(value_of(x)),
+                                      scaling_step_size, function_tolerance,
+                                      max_num_steps, nullptr, msgs, args...);
 }
 
 /**
@@ -139,65 +232,106 @@ Eigen::Matrix<var, Eigen::Dynamic, 1> solve_newton_tol(
     const F& f, const T& x, const double scaling_step_size,
     const double function_tolerance, const int64_t max_num_steps,
     std::ostream* const msgs, const T_Args&... args) {
-  const auto& x_ref = to_ref(value_of(x));
-  auto arena_args_tuple = make_chainable_ptr(std::make_tuple(eval(args)...));
-  auto args_vals_tuple = math::apply(
-      [&](const auto&... args) {
-        return std::make_tuple(to_ref(value_of(args))...);
-      },
-      *arena_args_tuple);
-
-  check_nonzero_size("solve_newton", "initial guess", x_ref);
-  check_finite("solve_newton", "initial guess", x_ref);
-  check_nonnegative("solve_newton", "scaling_step_size", scaling_step_size);
-  check_nonnegative("solve_newton", "function_tolerance", function_tolerance);
-  check_positive("solve_newton", "max_num_steps", max_num_steps);
-
-  // Solve the system
-  Eigen::VectorXd theta_dbl = math::apply(
-      [&](const auto&... vals) {
-        return kinsol_solve(f, x_ref, scaling_step_size, function_tolerance,
-                            max_num_steps, 1, 10, KIN_LINESEARCH, msgs,
-                            vals...);
-      },
-      args_vals_tuple);
-
-  auto f_wrt_x = [&](const auto& x) {
-    return math::apply([&](const auto&... args) { return f(x, msgs, args...); },
-                       args_vals_tuple);
-  };
-
-  Eigen::MatrixXd Jf_x;
-  Eigen::VectorXd f_x;
-
-  jacobian(f_wrt_x, theta_dbl, f_x, Jf_x);
-
-  using ret_type = Eigen::Matrix<var, Eigen::Dynamic, -1>;
-  arena_t<ret_type> ret = theta_dbl;
-  auto Jf_x_T_lu_ptr
-      = make_unsafe_chainable_ptr(Jf_x.transpose().partialPivLu());  // Lu
-
-  reverse_pass_callback(
-      [f, ret, arena_args_tuple, Jf_x_T_lu_ptr, msgs]() mutable {
-        Eigen::VectorXd eta = -Jf_x_T_lu_ptr->solve(ret.adj().eval());
-
-        // Contract with Jacobian of f with respect to y using a nested reverse
-        // autodiff pass.
-        {
-          nested_rev_autodiff rev;
+  return internal::solve_newton_tol_var(f, x, scaling_step_size,
+                                       function_tolerance, max_num_steps,
+                                       nullptr, msgs, args...);
+}
 
-          Eigen::VectorXd ret_val = ret.val();
-          auto x_nrad_ = math::apply(
-              [&ret_val, &f, msgs](const auto&... args) {
-                return eval(f(ret_val, msgs, args...));
-              },
-              *arena_args_tuple);
-          x_nrad_.adj() = eta;
-          grad();
-        }
-      });
+/**
+ * Return the solution to the specified system of algebraic
+ * equations given an initial guess, and parameters and data,
+ * which get passed into the algebraic system. Use the
+ * KINSOL solver from the SUNDIALS suite.
+ *
+ * The solve starts from the solution and the factorized Jacobian of the
+ * previous solve with the same cache, if there was one, see
+ * <code>algebra_solver_warm_start</code>.
+ *
+ * This overload handles non-autodiff parameters.
+ *
+ * @tparam F type of equation system function.
+ * @tparam T type of initial guess vector.
+ * @tparam Args types of additional parameters to the equation system functor
+ *
+ * @param[in] f Functor that evaluated the system of equations.
+ * @param[in] x Vector of starting values, used if the cache is cold.
+ * @param[in] scaling_step_size Scaled-step stopping tolerance.
+ * @param[in] function_tolerance determines whether roots are acceptable.
+ * @param[in] max_num_steps  maximum number of function evaluations.
+ * @param[in, out] warm_start solution cache of the call site.
+ * @param[in, out] msgs The print stream for warning messages.
+ * @param[in] args Additional parameters to the equation system functor.
+ * @return theta Vector of solutions to the system of equations.
+ * @throw <code>std::invalid_argument</code> if x has size zero.
+ * @throw <code>std::invalid_argument</code> if x has non-finite elements.
+ * @throw <code>std::invalid_argument</code> if scaled_step_size is strictly
+ * negative.
+ * @throw <code>std::invalid_argument</code> if function_tolerance is strictly
+ * negative.
+ * @throw <code>std::invalid_argument</code> if max_num_steps is not positive.
+ * @throw <code>std::domain_error if solver exceeds max_num_steps.
+ */
+template <typename F, typename T, typename... Args,
+          require_eigen_vector_t<T>* = nullptr,
+          require_all_st_arithmetic<Args...>* = nullptr>
+Eigen::VectorXd solve_newton_tol(const F& f, const T& x,
+                                 const double scaling_step_size,
+                                 const double function_tolerance,
+                                 const int64_t max_num_steps,
+                                 algebra_solver_warm_start& warm_start,
+                                 std::ostream* const msgs,
+                                 const Args&... args) {
+  return internal::solve_newton_values(
+      f, to_ref(value_of(x)), scaling_step_size, function_tolerance,
+      max_num_steps, &warm_start, msgs, args...);
+}
 
-  return ret_type(ret);
+/**
+ * Return the solution to the specified system of algebraic
+ * equations given an initial guess, and parameters and data,
+ * which get passed into the algebraic system. Use the
+ * KINSOL solver from the SUNDIALS suite.
+ *
+ * The solve starts from the solution and the factorized Jacobian of the
+ * previous solve with the same cache, if there was one, see
+ * <code>algebra_solver_warm_start</code>. The gradients are computed as
+ * in the overload without a cache.
+ *
+ * This overload handles var parameters.
+ *
+ * @tparam F type of equation system function.
+ * @tparam T type of initial guess vector.
+ * @tparam Args types of additional parameters to the equation system functor
+ *
+ * @param[in] f Functor that evaluated the system of equations.
+ * @param[in] x Vector of starting values, used if the cache is cold.
+ * @param[in] scaling_step_size Scaled-step stopping tolerance.
+ * @param[in] function_tolerance determines whether roots are acceptable.
+ * @param[in] max_num_steps  maximum number of function evaluations.
+ * @param[in, out] warm_start solution cache of the call site.
+ * @param[in, out] msgs The print stream for warning messages.
+ * @param[in] args Additional parameters to the equation system functor.
+ * @return theta Vector of solutions to the system of equations.
+ * @throw <code>std::invalid_argument</code> if x has size zero.
+ * @throw <code>std::invalid_argument</code> if x has non-finite elements.
+ * @throw <code>std::invalid_argument</code> if scaled_step_size is strictly
+ * negative.
+ * @throw <code>std::invalid_argument</code> if function_tolerance is strictly
+ * negative.
+ * @throw <code>std::invalid_argument</code> if max_num_steps is not positive.
+ * @throw <code>std::domain_error if solver exceeds max_num_steps.
+ */
+template <typename F, typename T, typename... T_Args,
+          require_eigen_vector_t<T>* = nullptr,
+          require_any_st_var<T_Args...>* = nullptr>
+Eigen::Matrix<var, Eigen::Dynamic, 1> solve_newton_tol(
+    const F& f, const T& x, const double scaling_step_size,
+    const double function_tolerance, const int64_t max_num_steps,
+    algebra_solver_warm_start& warm_start, std::ostream* const msgs,
+    const T_Args&... args) {
+  return internal::solve_newton_tol_var(f, x, scaling_step_size,
+                                       function_tolerance, max_num_steps,
+                                       &warm_start, msgs, args...);
 }
 
 /**
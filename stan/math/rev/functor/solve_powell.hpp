@@ -3,6 +3,7 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/algebra_solver_warm_start.hpp>
 #include <stan/math/rev/functor/algebra_system.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/value_of.hpp>
@@ -17,6 +18,54 @@
 namespace stan {
 namespace math {
 
+namespace internal {
+
+/**
+ * Solve algebraic equations in place using Powell solver and return the
+ * number of iterations. See <code>solve_powell_call_solver</code> for the
+ * arguments.
+ */
+template <typename F, typename T>
+int64_t solve_powell_iterate(const F& f, T& x, const double relative_tolerance,
+                             const double function_tolerance,
+                             const int64_t max_num_steps) {
+  // Construct the solver
+  hybrj_functor_solver<F> hfs(f);
+  Eigen::HybridNonLinearSolver<hybrj_functor_solver<F>> solver(hfs);
+
+  // Compute theta_dbl
+  solver.parameters.xtol = relative_tolerance;
+  solver.parameters.maxfev = max_num_steps;
+  solver.solve(x);
+
+  // Check if the max number of steps has been exceeded
+  if (solver.nfev >= max_num_steps) {
+    [max_num_steps]() STAN_COLD_PATH {
+      throw_domain_error("algebra_solver", "maximum number of iterations",
+                         max_num_steps, "(", ") was exceeded in the solve.");
+    }();
+  }
+
+  // Check solution is a root
+  double system_norm = f(x).stableNorm();
+  if (system_norm > function_tolerance) {
+    [function_tolerance, system_norm]() STAN_COLD_PATH {
+      std::ostringstream message;
+      message << "the norm of the algebraic function is " << system_norm
+              << " but should be lower than the function "
+              << "tolerance:";
+      throw_domain_error("algebra_solver", message.str().c_str(),
+                         function_tolerance, "",
+                         ". Consider decreasing the relative tolerance and "
+                         "increasing max_num_steps.");
+    }();
+  }
+
+  return solver.iter;
+}
+
+}  // namespace internal
+
 /**
  * Solve algebraic equations using Powell solver
  *
@@ -49,41 +98,168 @@ T& solve_powell_call_solver(const F& f, T& x, std::ostream* const msgs,
                             const double relative_tolerance,
                             const double function_tolerance,
                             const int64_t max_num_steps, const Args&... args) {
-  // Construct the solver
-  hybrj_functor_solver<F> hfs(f);
-  Eigen::HybridNonLinearSolver<hybrj_functor_solver<F>> solver(hfs);
+  internal::solve_powell_iterate(f, x, relative_tolerance, function_tolerance,
+                                 max_num_steps);
+  return x;
+}
 
-  // Compute theta_dbl
-  solver.parameters.xtol = relative_tolerance;
-  solver.parameters.maxfev = max_num_steps;
-  solver.solve(x);
+/**
+ * Solve algebraic equations using Powell solver, starting from the
+ * solution cached in \p warm_start if there is one and from \p x
+ * otherwise. If the warm started solve fails, the system is solved again
+ * from \p x.
+ *
+ * See the overload without a cache for the other arguments.
+ *
+ * @param[in, out] warm_start solution cache of the call site
+ */
+template <typename F, typename T, require_eigen_vector_t<T>* = nullptr>
+T& solve_powell_call_solver(const F& f, T& x,
+                            algebra_solver_warm_start& warm_start,
+                            std::ostream* const msgs,
+                            const double relative_tolerance,
+                            const double function_tolerance,
+                            const int64_t max_num_steps) {
+  if (warm_start.is_warm(x)) {
+    Eigen::VectorXd x_warm = warm_start.initial_guess(x);
+    try {
+      const int64_t num_iterations = internal::solve_powell_iterate(
+          f, x_warm, relative_tolerance, function_tolerance, max_num_steps);
+      warm_start.store(x_warm, num_iterations, true, false);
+      x = x_warm;
+      return x;
+    } catch (const std::exception&) {
+      warm_start.reset();
+    }
+  }
+  warm_start.reset();
+  const int64_t num_iterations = internal::solve_powell_iterate(
+      f, x, relative_tolerance, function_tolerance, max_num_steps);
+  warm_start.store(x, num_iterations, false, false);
+  return x;
+}
 
-  // Check if the max number of steps has been exceeded
-  if (solver.nfev >= max_num_steps) {
-    [max_num_steps]() STAN_COLD_PATH {
-      throw_domain_error("algebra_solver", "maximum number of iterations",
-                         max_num_steps, "(", ") was exceeded in the solve.");
-    }();
+namespace internal {
+
+/**
+ * Check the arguments and solve the algebraic system with Powell's dogleg
+ * solver, warm started from \p warm_start unless it is null. See
+ * <code>solve_powell_tol</code> for the arguments.
+ */
+template <typename F, typename T, typename... Args>
+Eigen::VectorXd solve_powell_values(const F& f, const T& x,
+                                    const double relative_tolerance,
+                                    const double function_tolerance,
+                                    const int64_t max_num_steps,
+                                    algebra_solver_warm_start* warm_start,
+                                    std::ostream* const msgs,
+                                    const Args&... args) {
+  auto x_ref = eval(value_of(x));
+  auto args_vals_tuple = std::make_tuple(to_ref(args)...);
+
+  auto f_wrt_x = [&args_vals_tuple, &f, msgs](const auto& x) {
+    return math::apply(
+        [&x, &f, msgs](const auto&... args) { return f(x, msgs, args...); },
+        args_vals_tuple);
+  };
+
+  check_nonzero_size("solve_powell", "initial guess", x_ref);
+  check_finite("solve_powell", "initial guess", x_ref);
+  check_nonnegative("alegbra_solver_powell", "relative_tolerance",
+                    relative_tolerance);
+  check_nonnegative("solve_powell", "function_tolerance", function_tolerance);
+  check_positive("solve_powell", "max_num_steps", max_num_steps);
+  check_matching_sizes("solve_powell", "the algebraic system's output",
+                       f_wrt_x(x_ref), "the vector of unknowns, x,", x_ref);
+
+  // Solve the system
+  if (warm_start == nullptr) {
+    return solve_powell_call_solver(f_wrt_x, x_ref, msgs, relative_tolerance,
+                                    function_tolerance, max_num_steps);
   }
+  return solve_powell_call_solver(f_wrt_x, x_ref, *warm_start, msgs,
+                                  relative_tolerance, function_tolerance,
+                                  max_num_steps);
+}
 
-  // Check solution is a root
-  double system_norm = f(x).stableNorm();
-  if (system_norm > function_tolerance) {
-    [function_tolerance, system_norm]() STAN_COLD_PATH {
-      std::ostringstream message;
-      message << "the norm of the algebraic function is " << system_norm
-              << " but should be lower than the function "
-              << "tolerance:";
-      throw_domain_error("algebra_solver", message.str().c_str(),
-                         function_tolerance, "",
-                         ". Consider decreasing the relative tolerance and "
-                         "increasing max_num_steps.");
-    }();
+/**
+ * Solve the algebraic system with Powell's dogleg solver and register the
+ * adjoint of the solution with respect to the var parameters, warm started
+ * from \p warm_start unless it is null. See <code>solve_powell_tol</code>
+ * for the arguments.
+ */
+template <typename F, typename T, typename... T_Args>
+Eigen::Matrix<var, Eigen::Dynamic, 1> solve_powell_tol_var(
+    const F& f, const T& x, const double relative_tolerance,
+    const double function_tolerance, const int64_t max_num_steps,
+    algebra_solver_warm_start* warm_start, std::ostream* const msgs,
+    const T_Args&... args) {
+  auto x_ref = eval(value_of(x));
+  auto arena_args_tuple = make_chainable_ptr(std::make_tuple(eval(args)...));
+  auto args_vals_tuple = math::apply(
+      [&](const auto&... args) {
+        return std::make_tuple(to_ref(value_of(args))...);
+      },
+      *arena_args_tuple);
+
+  auto f_wrt_x = [&args_vals_tuple, &f, msgs](const auto& x) {
+    return math::apply(
+        [&x, &f, msgs](const auto&... args) { return f(x, msgs, args...); },
+        args_vals_tuple);
+  };
+
+  check_nonzero_size("solve_powell", "initial guess", x_ref);
+  check_finite("solve_powell", "initial guess", x_ref);
+  check_nonnegative("alegbra_solver_powell", "relative_tolerance",
+                    relative_tolerance);
+  check_nonnegative("solve_powell", "function_tolerance", function_tolerance);
+  check_positive("solve_powell", "max_num_steps", max_num_steps);
+  check_matching_sizes("solve_powell", "the algebraic system's output",
+                       f_wrt_x(x_ref), "the vector of unknowns, x,", x_ref);
+
+  // Solve the system
+  if (warm_start == nullptr) {
+    solve_powell_call_solver(f_wrt_x, x_ref, msgs, relative_tolerance,
+                             function_tolerance, max_num_steps);
+  } else {
+    solve_powell_call_solver(f_wrt_x, x_ref, *warm_start, msgs,
+                             relative_tolerance, function_tolerance,
+                             max_num_steps);
   }
 
-  return x;
+  Eigen::MatrixXd Jf_x;
+  Eigen::VectorXd f_x;
+
+  jacobian(f_wrt_x, x_ref, f_x, Jf_x);
+
+  using ret_type = Eigen::Matrix<var, Eigen::Dynamic, -1>;
+  auto Jf_x_T_lu_ptr
+      = make_unsafe_chainable_ptr(Jf_x.transpose().partialPivLu());  // Lu
+
+  arena_t<ret_type> ret = x_ref;
+
+  reverse_pass_callback([f, ret, arena_args_tuple, Jf_x_T_lu_ptr,
+                         msgs]() mutable {
+    Eigen::VectorXd eta = -Jf_x_T_lu_ptr->solve(ret.adj().eval());
+
+    // Contract with Jacobian of f with respect to y using a nested reverse
+    // autodiff pass.
+    {
+      nested_rev_autodiff rev;
+      Eigen::VectorXd ret_val = ret.val();
+      auto x_nrad_ = math::apply(
+          [&](const auto&... args) { return eval(f(ret_val, msgs, args...)); },
+          *arena_args_tuple);
+      x_nrad_.adj() = eta;
+      grad();
+    }
+  });
+
+  return ret_type(ret);
 }
 
+}  // namespace internal
+
 /**
  * Return the solution to the specified system of algebraic
  * equations given an initial guess, and parameters and data,
@@ -131,27 +307,60 @@ Eigen::VectorXd solve_powell_tol(const F& f, const T& x,
                                  const int64_t max_num_steps,
                                  std::ostream* const msgs,
                                  const Args&... args) {
-  auto x_ref = eval(value_of(x));
-  auto args_vals_tuple = std::make_tuple(to_ref(args)...);
-
-  auto f_wrt_x = [&args_vals_tuple, &f, msgs](const auto& x) {
-    return math::apply(
-        [&x, &f, msgs](const auto&... args) { return f(x, msgs, args...); },
-        args_vals_tuple);
-  };
-
-  check_nonzero_size("solve_powell", "initial guess", x_ref);
-  check_finite("solve_powell", "initial guess", x_ref);
-  check_nonnegative("alegbra_solver_powell", "relative_tolerance",
-                    relative_tolerance);
-  check_nonnegative("solve_powell", "function_tolerance", function_tolerance);
-  check_positive("solve_powell", "max_num_steps", max_num_steps);
-  check_matching_sizes("solve_powell", "the algebraic system's output",
-                       f_wrt_x(x_ref), "the vector of unknowns, x,", x_ref);
+  return internal::solve_powell_values(f, x, relative_tolerance,
+                                      function_tolerance, max_num_steps,
+                                      nullptr, msgs, args...);
+}
 
-  // Solve the system
-  return solve_powell_call_solver(f_wrt_x, x_ref, msgs, relative_tolerance,
-                                  function_tolerance, max_num_steps);
+/**
+ * Return the solution to the specified system of algebraic
+ * equations given an initial guess, and parameters and data,
+ * which get passed into the algebraic system.
+ * Use Powell's dogleg solver.
+ *
+ * The solve starts from the solution of the previous solve with the same
+ * cache, if there was one, see <code>algebra_solver_warm_start</code>.
+ *
+ * This overload handles non-autodiff parameters.
+ *
+ * @tparam F type of equation system function
+ * @tparam T type of elements in the x vector
+ * @tparam Args types of additional parameters to the equation system functor
+ *
+ * @param[in] f Functor that evaluates the system of equations.
+ * @param[in] x Vector of starting values, used if the cache is cold.
+ * @param[in] relative_tolerance determines the convergence criteria
+ *            for the solution.
+ * @param[in] function_tolerance determines whether roots are acceptable.
+ * @param[in] max_num_steps maximum number of function evaluations.
+ * @param[in, out] warm_start solution cache of the call site.
+ * @param[in, out] msgs the print stream for warning messages.
+ * @param[in] args additional parameters to the equation system functor.
+ * @return theta Vector of solutions to the system of equations.
+ * @throw <code>std::invalid_argument</code> if x has size zero.
+ * @throw <code>std::invalid_argument</code> if x has non-finite elements.
+ * @throw <code>std::invalid_argument</code> if relative_tolerance is strictly
+ * negative.
+ * @throw <code>std::invalid_argument</code> if function_tolerance is strictly
+ * negative.
+ * @throw <code>std::invalid_argument</code> if max_num_steps is not positive.
+ * @throw <code>std::domain_error</code> solver exceeds max_num_steps.
+ * @throw <code>std::domain_error</code> if the norm of the solution exceeds
+ * the function tolerance.
+ */
+template <typename F, typename T, typename... Args,
+          require_eigen_vector_t<T>* = nullptr,
+          require_all_st_arithmetic<Args...>* = nullptr>
+Eigen::VectorXd solve_powell_tol(const F& f, const T& x,
+                                 const double relative_tolerance,
+                                 const double function_tolerance,
+                                 const int64_t max_num_steps,
+                                 algebra_solver_warm_start& warm_start,
+                                 std::ostream* const msgs,
+                                 const Args&... args) {
+  return internal::solve_powell_values(f, x, relative_tolerance,
+                                      function_tolerance, max_num_steps,
+                                      &warm_start, msgs, args...);
 }
 
 /**
@@ -326,62 +535,59 @@ Eigen::Matrix<var, Eigen::Dynamic, 1> solve_powell_tol(
     const F& f, const T& x, const double relative_tolerance,
     const double function_tolerance, const int64_t max_num_steps,
     std::ostream* const msgs, const T_Args&... args) {
-  auto x_ref = eval(value_of(x));
-  auto arena_args_tuple = make_chainable_ptr(std::make_tuple(eval(args)...));
-  auto args_vals_tuple = math::apply(
-      [&](const auto&... args) {
-        return std::make_tuple(to_ref(value_of(args))...);
-      },
-      *arena_args_tuple);
-
-  auto f_wrt_x = [&args_vals_tuple, &f, msgs](const auto& x) {
-    return math::apply(
-        [&x, &f, msgs](const auto&... args) { return f(x, msgs, args...); },
-        args_vals_tuple);
-  };
-
-  check_nonzero_size("solve_powell", "initial guess", x_ref);
-  check_finite("solve_powell", "initial guess", x_ref);
-  check_nonnegative("alegbra_solver_powell", "relative_tolerance",
-                    relative_tolerance);
-  check_nonnegative("solve_powell", "function_tolerance", function_tolerance);
-  check_positive("solve_powell", "max_num_steps", max_num_steps);
-  check_matching_sizes("solve_powell", "the algebraic system's output",
-                       f_wrt_x(x_ref), "the vector of unknowns, x,", x_ref);
-
-  // Solve the system
-  solve_powell_call_solver(f_wrt_x, x_ref, msgs, relative_tolerance,
-                           function_tolerance, max_num_steps);
-
-  Eigen::MatrixXd Jf_x;
-  Eigen::VectorXd f_x;
-
-  jacobian(f_wrt_x, x_ref, f_x, Jf_x);
-
-  using ret_type = Eigen::Matrix<var, Eigen::Dynamic, -1>;
-  auto Jf_x_T_lu_ptr
-      = make_unsafe_chainable_ptr(Jf_x.transpose().partialPivLu());  // Lu
-
-  arena_t<ret_type> ret = x_ref;
-
-  reverse_pass_callback([f, ret, arena_args_tuple, Jf_x_T_lu_ptr,
-                         msgs]() mutable {
-    Eigen::VectorXd eta = -Jf_x_T_lu_ptr->solve(ret.adj().eval());
-
-    // Contract with Jacobian of f with respect to y using a nested reverse
-    // autodiff pass.
-    {
-      nested_rev_autodiff rev;
-      Eigen::VectorXd ret_val = ret.val();
-      auto x_nrad_ = math::apply(
-          [&](const auto&... args) { return eval(f(ret_val, msgs, args...)); },
-          *arena_args_tuple);
-      x_nrad_.adj() = eta;
-      grad();
-    }
-  });
+  return internal::solve_powell_tol_var(f, x, relative_tolerance,
+                                       function_tolerance, max_num_steps,
+                                       nullptr, msgs, args...);
+}
 
-  return ret_type(ret);
+/**
+ * Return the solution to the specified system of algebraic
+ * equations given an initial guess, and parameters and data,
+ * which get passed into the algebraic system.
+ * Use Powell's dogleg solver.
+ *
+ * The solve starts from the solution of the previous solve with the same
+ * cache, if there was one, see <code>algebra_solver_warm_start</code>.
+ * The gradients are computed as in the overload without a cache.
+ *
+ * This overload handles var parameters.
+ *
+ * @tparam F type of equation system function
+ * @tparam T type of elements in the x vector
+ * @tparam Args types of additional parameters to the equation system functor
+ *
+ * @param[in] f Functor that evaluates the system of equations.
+ * @param[in] x Vector of starting values, used if the cache is cold.
+ * @param[in] relative_tolerance determines the convergence criteria
+ *            for the solution.
+ * @param[in] function_tolerance determines whether roots are acceptable.
+ * @param[in] max_num_steps  maximum number of function evaluations.
+ * @param[in, out] warm_start solution cache of the call site.
+ * @param[in, out] msgs the print stream for warning messages.
+ * @param[in] args Additional parameters to the equation system functor.
+ * @return theta Vector of solutions to the system of equations.
+ * @throw <code>std::invalid_argument</code> if x has size zero.
+ * @throw <code>std::invalid_argument</code> if x has non-finite elements.
+ * @throw <code>std::invalid_argument</code> if relative_tolerance is strictly
+ * negative.
+ * @throw <code>std::invalid_argument</code> if function_tolerance is strictly
+ * negative.
+ * @throw <code>std::invalid_argument</code> if max_num_steps is not positive.
+ * @throw <code>std::domain_error</code> solver exceeds max_num_steps.
+ * @throw <code>std::domain_error</code> if the norm of the solution exceeds
+ * the function tolerance.
+ */
+template <typename F, typename T, typename... T_Args,
+          require_eigen_vector_t<T>* = nullptr,
+          require_any_st_var<T_Args...>* = nullptr>
+Eigen::Matrix<var, Eigen::Dynamic, 1> solve_powell_tol(
+    const F& f, const T& x, const double relative_tolerance,
+    const double function_tolerance, const int64_t max_num_steps,
+    algebra_solver_warm_start& warm_start, std::ostream* const msgs,
+    const T_Args&... args) {
+  return internal::solve_powell_tol_var(f, x, relative_tolerance,
+                                       function_tolerance, max_num_steps,
+                                       &warm_start, msgs, args...);
 }
 
 }  // namespace math
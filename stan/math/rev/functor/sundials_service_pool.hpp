@@ -0,0 +1,141 @@
+#ifndef STAN_MATH_REV_FUNCTOR_SUNDIALS_SERVICE_POOL_HPP
+#define STAN_MATH_REV_FUNCTOR_SUNDIALS_SERVICE_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Hit and miss counts of the SUNDIALS workspace pools of a thread.
+ */
+struct sundials_pool_counters {
+  std::size_t hits{0};
+  std::size_t misses{0};
+
+  /**
+   * Returns the fraction of workspace requests served from a pool, or
+   * zero if there were none.
+   */
+  double hit_rate() const {
+    const std::size_t requests = hits + misses;
+    return requests == 0 ? 0.0 : static_cast<double>(hits) / requests;
+  }
+};
+
+/**
+ * Returns the hit and miss counts of all SUNDIALS workspace pools of the
+ * calling thread. The counts may be reset by assigning to them.
+ */
+inline sundials_pool_counters& sundials_pool_stats() {
+  static thread_local sundials_pool_counters counters;
+  return counters;
+}
+
+/**
+ * Thread local pool of SUNDIALS workspaces (context, memory, vectors,
+ * matrices and linear solvers) of type \p Service.
+ *
+ * A workspace is identified by the key its constructor is called with,
+ * typically the number of states and sensitivities. Workspaces are
+ * checked out with <code>acquire</code> and go back to the pool of the
+ * releasing thread when the returned lease is destroyed, after which a
+ * solve with the same key can reinitialize them (<code>CVodeReInit</code>
+ * and friends) instead of allocating new ones. At most
+ * <code>capacity</code> idle workspaces are kept per pool; the least
+ * recently released one is freed first.
+ *
+ * The method of the solver is part of the workspace type, so every
+ * method has its own pool.
+ *
+ * @tparam Service workspace type, which must define a <code>key_t</code>
+ * and be constructible from the elements of the key
+ */
+template <typename Service>
+class sundials_service_pool {
+ public:
+  using key_t = typename Service::key_t;
+  static constexpr std::size_t capacity = 8;
+
+  /**
+   * Checked out workspace, returned to the pool on destruction.
+   */
+  class lease {
+    key_t key_;
+    std::unique_ptr<Service> service_;
+
+   public:
+    lease(const key_t& key, std::unique_ptr<Service>&& service)
+        : key_(key), service_(std::move(service)) {}
+    lease(lease&&) = default;
+    lease& operator=(lease&&) = default;
+    ~lease() {
+      if (service_) {
+        sundials_service_pool::instance().release(key_, std::move(service_));
+      }
+    }
+
+    Service& operator*() const { return *service_; }
+    Service* operator->() const { return service_.get(); }
+  };
+
+  /**
+   * Returns the pool of the calling thread.
+   */
+  static sundials_service_pool& instance() {
+    static thread_local sundials_service_pool pool;
+    return pool;
+  }
+
+  /**
+   * Check out a workspace with the given key, reusing an idle one if
+   * available and constructing a new one otherwise.
+   *
+   * @tparam Args types of the key elements
+   * @param args key of the workspace, passed to its constructor
+   * @return lease of the workspace
+   */
+  template <typename... Args>
+  lease acquire(const Args&... args) {
+    const key_t key(args...);
+    auto it
+        = std::find_if(idle_.rbegin(), idle_.rend(),
+                       [&](const auto& entry) { return entry.first == key; });
+    if (it != idle_.rend()) {
+      ++sundials_pool_stats().hits;
+      std::unique_ptr<Service> service = std::move(it->second);
+      idle_.erase(std::next(it).base());
+      return lease(key, std::move(service));
+    }
+    ++sundials_pool_stats().misses;
+    return lease(key, std::make_unique<Service>(args...));
+  }
+
+  /**
+   * Returns the number of idle workspaces in the pool.
+   */
+  std::size_t size() const { return idle_.size(); }
+
+  /**
+   * Free all idle workspaces.
+   */
+  void clear() { idle_.clear(); }
+
+ private:
+  std::vector<std::pair<key_t, std::unique_ptr<Service>>> idle_;
+
+  void release(const key_t& key, std::unique_ptr<Service>&& service) {
+    if (idle_.size() == capacity) {
+      idle_.erase(idle_.begin());
+    }
+    idle_.emplace_back(key, std::move(service));
+  }
+};
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/bernoulli/bernoulli_test.hpp>
+
+typedef std::tuple<int, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<int, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<int, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<int, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<int>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<int>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<int>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<int>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+
+typedef std::tuple<AgradDistributionsBernoulli, type_v_0> AgradDistributionsBernoulli_v_0;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_1> AgradDistributionsBernoulli_v_1;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_2> AgradDistributionsBernoulli_v_2;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_3> AgradDistributionsBernoulli_v_3;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_4> AgradDistributionsBernoulli_v_4;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_5> AgradDistributionsBernoulli_v_5;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_6> AgradDistributionsBernoulli_v_6;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_7> AgradDistributionsBernoulli_v_7;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_8> AgradDistributionsBernoulli_v_8;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_9> AgradDistributionsBernoulli_v_9;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_10> AgradDistributionsBernoulli_v_10;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_11> AgradDistributionsBernoulli_v_11;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_12> AgradDistributionsBernoulli_v_12;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_13> AgradDistributionsBernoulli_v_13;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_14> AgradDistributionsBernoulli_v_14;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_15> AgradDistributionsBernoulli_v_15;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_16> AgradDistributionsBernoulli_v_16;
+typedef std::tuple<AgradDistributionsBernoulli, type_v_17> AgradDistributionsBernoulli_v_17;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_0, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_1, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_2, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_3, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_4, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_5, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_6, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_7, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_8, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_9, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_10, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_11, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_12, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_13, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_14, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_15, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_16, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_v_17, AgradDistributionTestFixture, AgradDistributionsBernoulli_v_17);
+
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/bernoulli/bernoulli_test.hpp>
+
+typedef std::tuple<int, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<int>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<int>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+
+typedef std::tuple<AgradDistributionsBernoulli, type_vv_0> AgradDistributionsBernoulli_vv_0;
+typedef std::tuple<AgradDistributionsBernoulli, type_vv_1> AgradDistributionsBernoulli_vv_1;
+typedef std::tuple<AgradDistributionsBernoulli, type_vv_2> AgradDistributionsBernoulli_vv_2;
+typedef std::tuple<AgradDistributionsBernoulli, type_vv_3> AgradDistributionsBernoulli_vv_3;
+typedef std::tuple<AgradDistributionsBernoulli, type_vv_4> AgradDistributionsBernoulli_vv_4;
+typedef std::tuple<AgradDistributionsBernoulli, type_vv_5> AgradDistributionsBernoulli_vv_5;
+typedef std::tuple<AgradDistributionsBernoulli, type_vv_6> AgradDistributionsBernoulli_vv_6;
+typedef std::tuple<AgradDistributionsBernoulli, type_vv_7> AgradDistributionsBernoulli_vv_7;
+typedef std::tuple<AgradDistributionsBernoulli, type_vv_8> AgradDistributionsBernoulli_vv_8;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_vv_0, AgradDistributionTestFixture, AgradDistributionsBernoulli_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_vv_1, AgradDistributionTestFixture, AgradDistributionsBernoulli_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_vv_2, AgradDistributionTestFixture, AgradDistributionsBernoulli_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_vv_3, AgradDistributionTestFixture, AgradDistributionsBernoulli_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_vv_4, AgradDistributionTestFixture, AgradDistributionsBernoulli_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_vv_5, AgradDistributionTestFixture, AgradDistributionsBernoulli_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_vv_6, AgradDistributionTestFixture, AgradDistributionsBernoulli_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_vv_7, AgradDistributionTestFixture, AgradDistributionsBernoulli_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulli_vv_8, AgradDistributionTestFixture, AgradDistributionsBernoulli_vv_8);
+
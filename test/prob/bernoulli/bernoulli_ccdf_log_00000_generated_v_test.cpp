@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/bernoulli/bernoulli_ccdf_log_test.hpp>
+
+typedef std::tuple<int, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<int, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<int, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<int, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<int>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<int>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<int>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<int>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_0> AgradCcdfLogBernoulli_v_0;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_1> AgradCcdfLogBernoulli_v_1;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_2> AgradCcdfLogBernoulli_v_2;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_3> AgradCcdfLogBernoulli_v_3;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_4> AgradCcdfLogBernoulli_v_4;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_5> AgradCcdfLogBernoulli_v_5;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_6> AgradCcdfLogBernoulli_v_6;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_7> AgradCcdfLogBernoulli_v_7;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_8> AgradCcdfLogBernoulli_v_8;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_9> AgradCcdfLogBernoulli_v_9;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_10> AgradCcdfLogBernoulli_v_10;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_11> AgradCcdfLogBernoulli_v_11;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_12> AgradCcdfLogBernoulli_v_12;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_13> AgradCcdfLogBernoulli_v_13;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_14> AgradCcdfLogBernoulli_v_14;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_15> AgradCcdfLogBernoulli_v_15;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_16> AgradCcdfLogBernoulli_v_16;
+typedef std::tuple<AgradCcdfLogBernoulli, type_v_17> AgradCcdfLogBernoulli_v_17;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_0, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_1, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_2, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_3, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_4, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_5, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_6, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_7, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_8, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_9, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_10, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_11, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_12, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_13, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_14, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_15, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_16, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_v_17, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_v_17);
+
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/bernoulli/bernoulli_ccdf_log_test.hpp>
+
+typedef std::tuple<int, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<int>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<int>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+
+typedef std::tuple<AgradCcdfLogBernoulli, type_vv_0> AgradCcdfLogBernoulli_vv_0;
+typedef std::tuple<AgradCcdfLogBernoulli, type_vv_1> AgradCcdfLogBernoulli_vv_1;
+typedef std::tuple<AgradCcdfLogBernoulli, type_vv_2> AgradCcdfLogBernoulli_vv_2;
+typedef std::tuple<AgradCcdfLogBernoulli, type_vv_3> AgradCcdfLogBernoulli_vv_3;
+typedef std::tuple<AgradCcdfLogBernoulli, type_vv_4> AgradCcdfLogBernoulli_vv_4;
+typedef std::tuple<AgradCcdfLogBernoulli, type_vv_5> AgradCcdfLogBernoulli_vv_5;
+typedef std::tuple<AgradCcdfLogBernoulli, type_vv_6> AgradCcdfLogBernoulli_vv_6;
+typedef std::tuple<AgradCcdfLogBernoulli, type_vv_7> AgradCcdfLogBernoulli_vv_7;
+typedef std::tuple<AgradCcdfLogBernoulli, type_vv_8> AgradCcdfLogBernoulli_vv_8;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBernoulli_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogBernoulli_vv_8);
+
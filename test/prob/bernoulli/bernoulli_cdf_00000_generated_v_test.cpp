@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/bernoulli/bernoulli_cdf_test.hpp>
+
+typedef std::tuple<int, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<int, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<int, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<int, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<int>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<int>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<int>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<int>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+
+typedef std::tuple<AgradCdfBernoulli, type_v_0> AgradCdfBernoulli_v_0;
+typedef std::tuple<AgradCdfBernoulli, type_v_1> AgradCdfBernoulli_v_1;
+typedef std::tuple<AgradCdfBernoulli, type_v_2> AgradCdfBernoulli_v_2;
+typedef std::tuple<AgradCdfBernoulli, type_v_3> AgradCdfBernoulli_v_3;
+typedef std::tuple<AgradCdfBernoulli, type_v_4> AgradCdfBernoulli_v_4;
+typedef std::tuple<AgradCdfBernoulli, type_v_5> AgradCdfBernoulli_v_5;
+typedef std::tuple<AgradCdfBernoulli, type_v_6> AgradCdfBernoulli_v_6;
+typedef std::tuple<AgradCdfBernoulli, type_v_7> AgradCdfBernoulli_v_7;
+typedef std::tuple<AgradCdfBernoulli, type_v_8> AgradCdfBernoulli_v_8;
+typedef std::tuple<AgradCdfBernoulli, type_v_9> AgradCdfBernoulli_v_9;
+typedef std::tuple<AgradCdfBernoulli, type_v_10> AgradCdfBernoulli_v_10;
+typedef std::tuple<AgradCdfBernoulli, type_v_11> AgradCdfBernoulli_v_11;
+typedef std::tuple<AgradCdfBernoulli, type_v_12> AgradCdfBernoulli_v_12;
+typedef std::tuple<AgradCdfBernoulli, type_v_13> AgradCdfBernoulli_v_13;
+typedef std::tuple<AgradCdfBernoulli, type_v_14> AgradCdfBernoulli_v_14;
+typedef std::tuple<AgradCdfBernoulli, type_v_15> AgradCdfBernoulli_v_15;
+typedef std::tuple<AgradCdfBernoulli, type_v_16> AgradCdfBernoulli_v_16;
+typedef std::tuple<AgradCdfBernoulli, type_v_17> AgradCdfBernoulli_v_17;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_0, AgradCdfTestFixture, AgradCdfBernoulli_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_1, AgradCdfTestFixture, AgradCdfBernoulli_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_2, AgradCdfTestFixture, AgradCdfBernoulli_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_3, AgradCdfTestFixture, AgradCdfBernoulli_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_4, AgradCdfTestFixture, AgradCdfBernoulli_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_5, AgradCdfTestFixture, AgradCdfBernoulli_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_6, AgradCdfTestFixture, AgradCdfBernoulli_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_7, AgradCdfTestFixture, AgradCdfBernoulli_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_8, AgradCdfTestFixture, AgradCdfBernoulli_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_9, AgradCdfTestFixture, AgradCdfBernoulli_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_10, AgradCdfTestFixture, AgradCdfBernoulli_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_11, AgradCdfTestFixture, AgradCdfBernoulli_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_12, AgradCdfTestFixture, AgradCdfBernoulli_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_13, AgradCdfTestFixture, AgradCdfBernoulli_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_14, AgradCdfTestFixture, AgradCdfBernoulli_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_15, AgradCdfTestFixture, AgradCdfBernoulli_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_16, AgradCdfTestFixture, AgradCdfBernoulli_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBernoulli_v_17, AgradCdfTestFixture, AgradCdfBernoulli_v_17);
+
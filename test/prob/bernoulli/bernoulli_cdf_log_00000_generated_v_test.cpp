@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/bernoulli/bernoulli_cdf_log_test.hpp>
+
+typedef std::tuple<int, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<int, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<int, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<int, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<int>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<int>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<int>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<int>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+
+typedef std::tuple<AgradCdfLogBernoulli, type_v_0> AgradCdfLogBernoulli_v_0;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_1> AgradCdfLogBernoulli_v_1;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_2> AgradCdfLogBernoulli_v_2;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_3> AgradCdfLogBernoulli_v_3;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_4> AgradCdfLogBernoulli_v_4;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_5> AgradCdfLogBernoulli_v_5;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_6> AgradCdfLogBernoulli_v_6;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_7> AgradCdfLogBernoulli_v_7;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_8> AgradCdfLogBernoulli_v_8;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_9> AgradCdfLogBernoulli_v_9;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_10> AgradCdfLogBernoulli_v_10;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_11> AgradCdfLogBernoulli_v_11;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_12> AgradCdfLogBernoulli_v_12;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_13> AgradCdfLogBernoulli_v_13;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_14> AgradCdfLogBernoulli_v_14;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_15> AgradCdfLogBernoulli_v_15;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_16> AgradCdfLogBernoulli_v_16;
+typedef std::tuple<AgradCdfLogBernoulli, type_v_17> AgradCdfLogBernoulli_v_17;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_0, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_1, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_2, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_3, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_4, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_5, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_6, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_7, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_8, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_9, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_10, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_11, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_12, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_13, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_14, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_15, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_16, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBernoulli_v_17, AgradCdfLogTestFixture, AgradCdfLogBernoulli_v_17);
+
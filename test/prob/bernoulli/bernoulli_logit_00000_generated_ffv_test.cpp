@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/bernoulli/bernoulli_logit_test.hpp>
+
+typedef std::tuple<int, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_2;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_3;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_4;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_5;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_6;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_7;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_8;
+
+typedef std::tuple<AgradDistributionsBernoulliLogistic, type_ffv_0> AgradDistributionsBernoulliLogistic_ffv_0;
+typedef std::tuple<AgradDistributionsBernoulliLogistic, type_ffv_1> AgradDistributionsBernoulliLogistic_ffv_1;
+typedef std::tuple<AgradDistributionsBernoulliLogistic, type_ffv_2> AgradDistributionsBernoulliLogistic_ffv_2;
+typedef std::tuple<AgradDistributionsBernoulliLogistic, type_ffv_3> AgradDistributionsBernoulliLogistic_ffv_3;
+typedef std::tuple<AgradDistributionsBernoulliLogistic, type_ffv_4> AgradDistributionsBernoulliLogistic_ffv_4;
+typedef std::tuple<AgradDistributionsBernoulliLogistic, type_ffv_5> AgradDistributionsBernoulliLogistic_ffv_5;
+typedef std::tuple<AgradDistributionsBernoulliLogistic, type_ffv_6> AgradDistributionsBernoulliLogistic_ffv_6;
+typedef std::tuple<AgradDistributionsBernoulliLogistic, type_ffv_7> AgradDistributionsBernoulliLogistic_ffv_7;
+typedef std::tuple<AgradDistributionsBernoulliLogistic, type_ffv_8> AgradDistributionsBernoulliLogistic_ffv_8;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulliLogistic_ffv_0, AgradDistributionTestFixture, AgradDistributionsBernoulliLogistic_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulliLogistic_ffv_1, AgradDistributionTestFixture, AgradDistributionsBernoulliLogistic_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulliLogistic_ffv_2, AgradDistributionTestFixture, AgradDistributionsBernoulliLogistic_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulliLogistic_ffv_3, AgradDistributionTestFixture, AgradDistributionsBernoulliLogistic_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulliLogistic_ffv_4, AgradDistributionTestFixture, AgradDistributionsBernoulliLogistic_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulliLogistic_ffv_5, AgradDistributionTestFixture, AgradDistributionsBernoulliLogistic_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulliLogistic_ffv_6, AgradDistributionTestFixture, AgradDistributionsBernoulliLogistic_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulliLogistic_ffv_7, AgradDistributionTestFixture, AgradDistributionsBernoulliLogistic_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBernoulliLogistic_ffv_8, AgradDistributionTestFixture, AgradDistributionsBernoulliLogistic_ffv_8);
+
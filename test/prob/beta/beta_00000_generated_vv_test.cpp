@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsBeta, type_vv_0> AgradDistributionsBeta_vv_0;
+typedef std::tuple<AgradDistributionsBeta, type_vv_1> AgradDistributionsBeta_vv_1;
+typedef std::tuple<AgradDistributionsBeta, type_vv_2> AgradDistributionsBeta_vv_2;
+typedef std::tuple<AgradDistributionsBeta, type_vv_3> AgradDistributionsBeta_vv_3;
+typedef std::tuple<AgradDistributionsBeta, type_vv_4> AgradDistributionsBeta_vv_4;
+typedef std::tuple<AgradDistributionsBeta, type_vv_5> AgradDistributionsBeta_vv_5;
+typedef std::tuple<AgradDistributionsBeta, type_vv_6> AgradDistributionsBeta_vv_6;
+typedef std::tuple<AgradDistributionsBeta, type_vv_7> AgradDistributionsBeta_vv_7;
+typedef std::tuple<AgradDistributionsBeta, type_vv_8> AgradDistributionsBeta_vv_8;
+typedef std::tuple<AgradDistributionsBeta, type_vv_9> AgradDistributionsBeta_vv_9;
+typedef std::tuple<AgradDistributionsBeta, type_vv_10> AgradDistributionsBeta_vv_10;
+typedef std::tuple<AgradDistributionsBeta, type_vv_11> AgradDistributionsBeta_vv_11;
+typedef std::tuple<AgradDistributionsBeta, type_vv_12> AgradDistributionsBeta_vv_12;
+typedef std::tuple<AgradDistributionsBeta, type_vv_13> AgradDistributionsBeta_vv_13;
+typedef std::tuple<AgradDistributionsBeta, type_vv_14> AgradDistributionsBeta_vv_14;
+typedef std::tuple<AgradDistributionsBeta, type_vv_15> AgradDistributionsBeta_vv_15;
+typedef std::tuple<AgradDistributionsBeta, type_vv_16> AgradDistributionsBeta_vv_16;
+typedef std::tuple<AgradDistributionsBeta, type_vv_17> AgradDistributionsBeta_vv_17;
+typedef std::tuple<AgradDistributionsBeta, type_vv_18> AgradDistributionsBeta_vv_18;
+typedef std::tuple<AgradDistributionsBeta, type_vv_19> AgradDistributionsBeta_vv_19;
+typedef std::tuple<AgradDistributionsBeta, type_vv_20> AgradDistributionsBeta_vv_20;
+typedef std::tuple<AgradDistributionsBeta, type_vv_21> AgradDistributionsBeta_vv_21;
+typedef std::tuple<AgradDistributionsBeta, type_vv_22> AgradDistributionsBeta_vv_22;
+typedef std::tuple<AgradDistributionsBeta, type_vv_23> AgradDistributionsBeta_vv_23;
+typedef std::tuple<AgradDistributionsBeta, type_vv_24> AgradDistributionsBeta_vv_24;
+typedef std::tuple<AgradDistributionsBeta, type_vv_25> AgradDistributionsBeta_vv_25;
+typedef std::tuple<AgradDistributionsBeta, type_vv_26> AgradDistributionsBeta_vv_26;
+typedef std::tuple<AgradDistributionsBeta, type_vv_27> AgradDistributionsBeta_vv_27;
+typedef std::tuple<AgradDistributionsBeta, type_vv_28> AgradDistributionsBeta_vv_28;
+typedef std::tuple<AgradDistributionsBeta, type_vv_29> AgradDistributionsBeta_vv_29;
+typedef std::tuple<AgradDistributionsBeta, type_vv_30> AgradDistributionsBeta_vv_30;
+typedef std::tuple<AgradDistributionsBeta, type_vv_31> AgradDistributionsBeta_vv_31;
+typedef std::tuple<AgradDistributionsBeta, type_vv_32> AgradDistributionsBeta_vv_32;
+typedef std::tuple<AgradDistributionsBeta, type_vv_33> AgradDistributionsBeta_vv_33;
+typedef std::tuple<AgradDistributionsBeta, type_vv_34> AgradDistributionsBeta_vv_34;
+typedef std::tuple<AgradDistributionsBeta, type_vv_35> AgradDistributionsBeta_vv_35;
+typedef std::tuple<AgradDistributionsBeta, type_vv_36> AgradDistributionsBeta_vv_36;
+typedef std::tuple<AgradDistributionsBeta, type_vv_37> AgradDistributionsBeta_vv_37;
+typedef std::tuple<AgradDistributionsBeta, type_vv_38> AgradDistributionsBeta_vv_38;
+typedef std::tuple<AgradDistributionsBeta, type_vv_39> AgradDistributionsBeta_vv_39;
+typedef std::tuple<AgradDistributionsBeta, type_vv_40> AgradDistributionsBeta_vv_40;
+typedef std::tuple<AgradDistributionsBeta, type_vv_41> AgradDistributionsBeta_vv_41;
+typedef std::tuple<AgradDistributionsBeta, type_vv_42> AgradDistributionsBeta_vv_42;
+typedef std::tuple<AgradDistributionsBeta, type_vv_43> AgradDistributionsBeta_vv_43;
+typedef std::tuple<AgradDistributionsBeta, type_vv_44> AgradDistributionsBeta_vv_44;
+typedef std::tuple<AgradDistributionsBeta, type_vv_45> AgradDistributionsBeta_vv_45;
+typedef std::tuple<AgradDistributionsBeta, type_vv_46> AgradDistributionsBeta_vv_46;
+typedef std::tuple<AgradDistributionsBeta, type_vv_47> AgradDistributionsBeta_vv_47;
+typedef std::tuple<AgradDistributionsBeta, type_vv_48> AgradDistributionsBeta_vv_48;
+typedef std::tuple<AgradDistributionsBeta, type_vv_49> AgradDistributionsBeta_vv_49;
+typedef std::tuple<AgradDistributionsBeta, type_vv_50> AgradDistributionsBeta_vv_50;
+typedef std::tuple<AgradDistributionsBeta, type_vv_51> AgradDistributionsBeta_vv_51;
+typedef std::tuple<AgradDistributionsBeta, type_vv_52> AgradDistributionsBeta_vv_52;
+typedef std::tuple<AgradDistributionsBeta, type_vv_53> AgradDistributionsBeta_vv_53;
+typedef std::tuple<AgradDistributionsBeta, type_vv_54> AgradDistributionsBeta_vv_54;
+typedef std::tuple<AgradDistributionsBeta, type_vv_55> AgradDistributionsBeta_vv_55;
+typedef std::tuple<AgradDistributionsBeta, type_vv_56> AgradDistributionsBeta_vv_56;
+typedef std::tuple<AgradDistributionsBeta, type_vv_57> AgradDistributionsBeta_vv_57;
+typedef std::tuple<AgradDistributionsBeta, type_vv_58> AgradDistributionsBeta_vv_58;
+typedef std::tuple<AgradDistributionsBeta, type_vv_59> AgradDistributionsBeta_vv_59;
+typedef std::tuple<AgradDistributionsBeta, type_vv_60> AgradDistributionsBeta_vv_60;
+typedef std::tuple<AgradDistributionsBeta, type_vv_61> AgradDistributionsBeta_vv_61;
+typedef std::tuple<AgradDistributionsBeta, type_vv_62> AgradDistributionsBeta_vv_62;
+typedef std::tuple<AgradDistributionsBeta, type_vv_63> AgradDistributionsBeta_vv_63;
+typedef std::tuple<AgradDistributionsBeta, type_vv_64> AgradDistributionsBeta_vv_64;
+typedef std::tuple<AgradDistributionsBeta, type_vv_65> AgradDistributionsBeta_vv_65;
+typedef std::tuple<AgradDistributionsBeta, type_vv_66> AgradDistributionsBeta_vv_66;
+typedef std::tuple<AgradDistributionsBeta, type_vv_67> AgradDistributionsBeta_vv_67;
+typedef std::tuple<AgradDistributionsBeta, type_vv_68> AgradDistributionsBeta_vv_68;
+typedef std::tuple<AgradDistributionsBeta, type_vv_69> AgradDistributionsBeta_vv_69;
+typedef std::tuple<AgradDistributionsBeta, type_vv_70> AgradDistributionsBeta_vv_70;
+typedef std::tuple<AgradDistributionsBeta, type_vv_71> AgradDistributionsBeta_vv_71;
+typedef std::tuple<AgradDistributionsBeta, type_vv_72> AgradDistributionsBeta_vv_72;
+typedef std::tuple<AgradDistributionsBeta, type_vv_73> AgradDistributionsBeta_vv_73;
+typedef std::tuple<AgradDistributionsBeta, type_vv_74> AgradDistributionsBeta_vv_74;
+typedef std::tuple<AgradDistributionsBeta, type_vv_75> AgradDistributionsBeta_vv_75;
+typedef std::tuple<AgradDistributionsBeta, type_vv_76> AgradDistributionsBeta_vv_76;
+typedef std::tuple<AgradDistributionsBeta, type_vv_77> AgradDistributionsBeta_vv_77;
+typedef std::tuple<AgradDistributionsBeta, type_vv_78> AgradDistributionsBeta_vv_78;
+typedef std::tuple<AgradDistributionsBeta, type_vv_79> AgradDistributionsBeta_vv_79;
+typedef std::tuple<AgradDistributionsBeta, type_vv_80> AgradDistributionsBeta_vv_80;
+typedef std::tuple<AgradDistributionsBeta, type_vv_81> AgradDistributionsBeta_vv_81;
+typedef std::tuple<AgradDistributionsBeta, type_vv_82> AgradDistributionsBeta_vv_82;
+typedef std::tuple<AgradDistributionsBeta, type_vv_83> AgradDistributionsBeta_vv_83;
+typedef std::tuple<AgradDistributionsBeta, type_vv_84> AgradDistributionsBeta_vv_84;
+typedef std::tuple<AgradDistributionsBeta, type_vv_85> AgradDistributionsBeta_vv_85;
+typedef std::tuple<AgradDistributionsBeta, type_vv_86> AgradDistributionsBeta_vv_86;
+typedef std::tuple<AgradDistributionsBeta, type_vv_87> AgradDistributionsBeta_vv_87;
+typedef std::tuple<AgradDistributionsBeta, type_vv_88> AgradDistributionsBeta_vv_88;
+typedef std::tuple<AgradDistributionsBeta, type_vv_89> AgradDistributionsBeta_vv_89;
+typedef std::tuple<AgradDistributionsBeta, type_vv_90> AgradDistributionsBeta_vv_90;
+typedef std::tuple<AgradDistributionsBeta, type_vv_91> AgradDistributionsBeta_vv_91;
+typedef std::tuple<AgradDistributionsBeta, type_vv_92> AgradDistributionsBeta_vv_92;
+typedef std::tuple<AgradDistributionsBeta, type_vv_93> AgradDistributionsBeta_vv_93;
+typedef std::tuple<AgradDistributionsBeta, type_vv_94> AgradDistributionsBeta_vv_94;
+typedef std::tuple<AgradDistributionsBeta, type_vv_95> AgradDistributionsBeta_vv_95;
+typedef std::tuple<AgradDistributionsBeta, type_vv_96> AgradDistributionsBeta_vv_96;
+typedef std::tuple<AgradDistributionsBeta, type_vv_97> AgradDistributionsBeta_vv_97;
+typedef std::tuple<AgradDistributionsBeta, type_vv_98> AgradDistributionsBeta_vv_98;
+typedef std::tuple<AgradDistributionsBeta, type_vv_99> AgradDistributionsBeta_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_0, AgradDistributionTestFixture, AgradDistributionsBeta_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_1, AgradDistributionTestFixture, AgradDistributionsBeta_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_2, AgradDistributionTestFixture, AgradDistributionsBeta_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_3, AgradDistributionTestFixture, AgradDistributionsBeta_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_4, AgradDistributionTestFixture, AgradDistributionsBeta_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_5, AgradDistributionTestFixture, AgradDistributionsBeta_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_6, AgradDistributionTestFixture, AgradDistributionsBeta_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_7, AgradDistributionTestFixture, AgradDistributionsBeta_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_8, AgradDistributionTestFixture, AgradDistributionsBeta_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_9, AgradDistributionTestFixture, AgradDistributionsBeta_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_10, AgradDistributionTestFixture, AgradDistributionsBeta_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_11, AgradDistributionTestFixture, AgradDistributionsBeta_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_12, AgradDistributionTestFixture, AgradDistributionsBeta_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_13, AgradDistributionTestFixture, AgradDistributionsBeta_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_14, AgradDistributionTestFixture, AgradDistributionsBeta_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_15, AgradDistributionTestFixture, AgradDistributionsBeta_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_16, AgradDistributionTestFixture, AgradDistributionsBeta_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_17, AgradDistributionTestFixture, AgradDistributionsBeta_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_18, AgradDistributionTestFixture, AgradDistributionsBeta_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_19, AgradDistributionTestFixture, AgradDistributionsBeta_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_20, AgradDistributionTestFixture, AgradDistributionsBeta_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_21, AgradDistributionTestFixture, AgradDistributionsBeta_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_22, AgradDistributionTestFixture, AgradDistributionsBeta_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_23, AgradDistributionTestFixture, AgradDistributionsBeta_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_24, AgradDistributionTestFixture, AgradDistributionsBeta_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_25, AgradDistributionTestFixture, AgradDistributionsBeta_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_26, AgradDistributionTestFixture, AgradDistributionsBeta_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_27, AgradDistributionTestFixture, AgradDistributionsBeta_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_28, AgradDistributionTestFixture, AgradDistributionsBeta_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_29, AgradDistributionTestFixture, AgradDistributionsBeta_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_30, AgradDistributionTestFixture, AgradDistributionsBeta_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_31, AgradDistributionTestFixture, AgradDistributionsBeta_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_32, AgradDistributionTestFixture, AgradDistributionsBeta_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_33, AgradDistributionTestFixture, AgradDistributionsBeta_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_34, AgradDistributionTestFixture, AgradDistributionsBeta_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_35, AgradDistributionTestFixture, AgradDistributionsBeta_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_36, AgradDistributionTestFixture, AgradDistributionsBeta_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_37, AgradDistributionTestFixture, AgradDistributionsBeta_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_38, AgradDistributionTestFixture, AgradDistributionsBeta_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_39, AgradDistributionTestFixture, AgradDistributionsBeta_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_40, AgradDistributionTestFixture, AgradDistributionsBeta_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_41, AgradDistributionTestFixture, AgradDistributionsBeta_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_42, AgradDistributionTestFixture, AgradDistributionsBeta_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_43, AgradDistributionTestFixture, AgradDistributionsBeta_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_44, AgradDistributionTestFixture, AgradDistributionsBeta_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_45, AgradDistributionTestFixture, AgradDistributionsBeta_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_46, AgradDistributionTestFixture, AgradDistributionsBeta_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_47, AgradDistributionTestFixture, AgradDistributionsBeta_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_48, AgradDistributionTestFixture, AgradDistributionsBeta_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_49, AgradDistributionTestFixture, AgradDistributionsBeta_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_50, AgradDistributionTestFixture, AgradDistributionsBeta_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_51, AgradDistributionTestFixture, AgradDistributionsBeta_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_52, AgradDistributionTestFixture, AgradDistributionsBeta_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_53, AgradDistributionTestFixture, AgradDistributionsBeta_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_54, AgradDistributionTestFixture, AgradDistributionsBeta_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_55, AgradDistributionTestFixture, AgradDistributionsBeta_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_56, AgradDistributionTestFixture, AgradDistributionsBeta_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_57, AgradDistributionTestFixture, AgradDistributionsBeta_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_58, AgradDistributionTestFixture, AgradDistributionsBeta_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_59, AgradDistributionTestFixture, AgradDistributionsBeta_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_60, AgradDistributionTestFixture, AgradDistributionsBeta_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_61, AgradDistributionTestFixture, AgradDistributionsBeta_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_62, AgradDistributionTestFixture, AgradDistributionsBeta_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_63, AgradDistributionTestFixture, AgradDistributionsBeta_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_64, AgradDistributionTestFixture, AgradDistributionsBeta_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_65, AgradDistributionTestFixture, AgradDistributionsBeta_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_66, AgradDistributionTestFixture, AgradDistributionsBeta_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_67, AgradDistributionTestFixture, AgradDistributionsBeta_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_68, AgradDistributionTestFixture, AgradDistributionsBeta_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_69, AgradDistributionTestFixture, AgradDistributionsBeta_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_70, AgradDistributionTestFixture, AgradDistributionsBeta_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_71, AgradDistributionTestFixture, AgradDistributionsBeta_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_72, AgradDistributionTestFixture, AgradDistributionsBeta_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_73, AgradDistributionTestFixture, AgradDistributionsBeta_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_74, AgradDistributionTestFixture, AgradDistributionsBeta_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_75, AgradDistributionTestFixture, AgradDistributionsBeta_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_76, AgradDistributionTestFixture, AgradDistributionsBeta_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_77, AgradDistributionTestFixture, AgradDistributionsBeta_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_78, AgradDistributionTestFixture, AgradDistributionsBeta_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_79, AgradDistributionTestFixture, AgradDistributionsBeta_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_80, AgradDistributionTestFixture, AgradDistributionsBeta_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_81, AgradDistributionTestFixture, AgradDistributionsBeta_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_82, AgradDistributionTestFixture, AgradDistributionsBeta_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_83, AgradDistributionTestFixture, AgradDistributionsBeta_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_84, AgradDistributionTestFixture, AgradDistributionsBeta_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_85, AgradDistributionTestFixture, AgradDistributionsBeta_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_86, AgradDistributionTestFixture, AgradDistributionsBeta_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_87, AgradDistributionTestFixture, AgradDistributionsBeta_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_88, AgradDistributionTestFixture, AgradDistributionsBeta_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_89, AgradDistributionTestFixture, AgradDistributionsBeta_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_90, AgradDistributionTestFixture, AgradDistributionsBeta_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_91, AgradDistributionTestFixture, AgradDistributionsBeta_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_92, AgradDistributionTestFixture, AgradDistributionsBeta_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_93, AgradDistributionTestFixture, AgradDistributionsBeta_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_94, AgradDistributionTestFixture, AgradDistributionsBeta_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_95, AgradDistributionTestFixture, AgradDistributionsBeta_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_96, AgradDistributionTestFixture, AgradDistributionsBeta_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_97, AgradDistributionTestFixture, AgradDistributionsBeta_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_98, AgradDistributionTestFixture, AgradDistributionsBeta_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_99, AgradDistributionTestFixture, AgradDistributionsBeta_vv_99);
+
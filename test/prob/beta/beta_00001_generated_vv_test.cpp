@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionsBeta, type_vv_100> AgradDistributionsBeta_vv_100;
+typedef std::tuple<AgradDistributionsBeta, type_vv_101> AgradDistributionsBeta_vv_101;
+typedef std::tuple<AgradDistributionsBeta, type_vv_102> AgradDistributionsBeta_vv_102;
+typedef std::tuple<AgradDistributionsBeta, type_vv_103> AgradDistributionsBeta_vv_103;
+typedef std::tuple<AgradDistributionsBeta, type_vv_104> AgradDistributionsBeta_vv_104;
+typedef std::tuple<AgradDistributionsBeta, type_vv_105> AgradDistributionsBeta_vv_105;
+typedef std::tuple<AgradDistributionsBeta, type_vv_106> AgradDistributionsBeta_vv_106;
+typedef std::tuple<AgradDistributionsBeta, type_vv_107> AgradDistributionsBeta_vv_107;
+typedef std::tuple<AgradDistributionsBeta, type_vv_108> AgradDistributionsBeta_vv_108;
+typedef std::tuple<AgradDistributionsBeta, type_vv_109> AgradDistributionsBeta_vv_109;
+typedef std::tuple<AgradDistributionsBeta, type_vv_110> AgradDistributionsBeta_vv_110;
+typedef std::tuple<AgradDistributionsBeta, type_vv_111> AgradDistributionsBeta_vv_111;
+typedef std::tuple<AgradDistributionsBeta, type_vv_112> AgradDistributionsBeta_vv_112;
+typedef std::tuple<AgradDistributionsBeta, type_vv_113> AgradDistributionsBeta_vv_113;
+typedef std::tuple<AgradDistributionsBeta, type_vv_114> AgradDistributionsBeta_vv_114;
+typedef std::tuple<AgradDistributionsBeta, type_vv_115> AgradDistributionsBeta_vv_115;
+typedef std::tuple<AgradDistributionsBeta, type_vv_116> AgradDistributionsBeta_vv_116;
+typedef std::tuple<AgradDistributionsBeta, type_vv_117> AgradDistributionsBeta_vv_117;
+typedef std::tuple<AgradDistributionsBeta, type_vv_118> AgradDistributionsBeta_vv_118;
+typedef std::tuple<AgradDistributionsBeta, type_vv_119> AgradDistributionsBeta_vv_119;
+typedef std::tuple<AgradDistributionsBeta, type_vv_120> AgradDistributionsBeta_vv_120;
+typedef std::tuple<AgradDistributionsBeta, type_vv_121> AgradDistributionsBeta_vv_121;
+typedef std::tuple<AgradDistributionsBeta, type_vv_122> AgradDistributionsBeta_vv_122;
+typedef std::tuple<AgradDistributionsBeta, type_vv_123> AgradDistributionsBeta_vv_123;
+typedef std::tuple<AgradDistributionsBeta, type_vv_124> AgradDistributionsBeta_vv_124;
+typedef std::tuple<AgradDistributionsBeta, type_vv_125> AgradDistributionsBeta_vv_125;
+typedef std::tuple<AgradDistributionsBeta, type_vv_126> AgradDistributionsBeta_vv_126;
+typedef std::tuple<AgradDistributionsBeta, type_vv_127> AgradDistributionsBeta_vv_127;
+typedef std::tuple<AgradDistributionsBeta, type_vv_128> AgradDistributionsBeta_vv_128;
+typedef std::tuple<AgradDistributionsBeta, type_vv_129> AgradDistributionsBeta_vv_129;
+typedef std::tuple<AgradDistributionsBeta, type_vv_130> AgradDistributionsBeta_vv_130;
+typedef std::tuple<AgradDistributionsBeta, type_vv_131> AgradDistributionsBeta_vv_131;
+typedef std::tuple<AgradDistributionsBeta, type_vv_132> AgradDistributionsBeta_vv_132;
+typedef std::tuple<AgradDistributionsBeta, type_vv_133> AgradDistributionsBeta_vv_133;
+typedef std::tuple<AgradDistributionsBeta, type_vv_134> AgradDistributionsBeta_vv_134;
+typedef std::tuple<AgradDistributionsBeta, type_vv_135> AgradDistributionsBeta_vv_135;
+typedef std::tuple<AgradDistributionsBeta, type_vv_136> AgradDistributionsBeta_vv_136;
+typedef std::tuple<AgradDistributionsBeta, type_vv_137> AgradDistributionsBeta_vv_137;
+typedef std::tuple<AgradDistributionsBeta, type_vv_138> AgradDistributionsBeta_vv_138;
+typedef std::tuple<AgradDistributionsBeta, type_vv_139> AgradDistributionsBeta_vv_139;
+typedef std::tuple<AgradDistributionsBeta, type_vv_140> AgradDistributionsBeta_vv_140;
+typedef std::tuple<AgradDistributionsBeta, type_vv_141> AgradDistributionsBeta_vv_141;
+typedef std::tuple<AgradDistributionsBeta, type_vv_142> AgradDistributionsBeta_vv_142;
+typedef std::tuple<AgradDistributionsBeta, type_vv_143> AgradDistributionsBeta_vv_143;
+typedef std::tuple<AgradDistributionsBeta, type_vv_144> AgradDistributionsBeta_vv_144;
+typedef std::tuple<AgradDistributionsBeta, type_vv_145> AgradDistributionsBeta_vv_145;
+typedef std::tuple<AgradDistributionsBeta, type_vv_146> AgradDistributionsBeta_vv_146;
+typedef std::tuple<AgradDistributionsBeta, type_vv_147> AgradDistributionsBeta_vv_147;
+typedef std::tuple<AgradDistributionsBeta, type_vv_148> AgradDistributionsBeta_vv_148;
+typedef std::tuple<AgradDistributionsBeta, type_vv_149> AgradDistributionsBeta_vv_149;
+typedef std::tuple<AgradDistributionsBeta, type_vv_150> AgradDistributionsBeta_vv_150;
+typedef std::tuple<AgradDistributionsBeta, type_vv_151> AgradDistributionsBeta_vv_151;
+typedef std::tuple<AgradDistributionsBeta, type_vv_152> AgradDistributionsBeta_vv_152;
+typedef std::tuple<AgradDistributionsBeta, type_vv_153> AgradDistributionsBeta_vv_153;
+typedef std::tuple<AgradDistributionsBeta, type_vv_154> AgradDistributionsBeta_vv_154;
+typedef std::tuple<AgradDistributionsBeta, type_vv_155> AgradDistributionsBeta_vv_155;
+typedef std::tuple<AgradDistributionsBeta, type_vv_156> AgradDistributionsBeta_vv_156;
+typedef std::tuple<AgradDistributionsBeta, type_vv_157> AgradDistributionsBeta_vv_157;
+typedef std::tuple<AgradDistributionsBeta, type_vv_158> AgradDistributionsBeta_vv_158;
+typedef std::tuple<AgradDistributionsBeta, type_vv_159> AgradDistributionsBeta_vv_159;
+typedef std::tuple<AgradDistributionsBeta, type_vv_160> AgradDistributionsBeta_vv_160;
+typedef std::tuple<AgradDistributionsBeta, type_vv_161> AgradDistributionsBeta_vv_161;
+typedef std::tuple<AgradDistributionsBeta, type_vv_162> AgradDistributionsBeta_vv_162;
+typedef std::tuple<AgradDistributionsBeta, type_vv_163> AgradDistributionsBeta_vv_163;
+typedef std::tuple<AgradDistributionsBeta, type_vv_164> AgradDistributionsBeta_vv_164;
+typedef std::tuple<AgradDistributionsBeta, type_vv_165> AgradDistributionsBeta_vv_165;
+typedef std::tuple<AgradDistributionsBeta, type_vv_166> AgradDistributionsBeta_vv_166;
+typedef std::tuple<AgradDistributionsBeta, type_vv_167> AgradDistributionsBeta_vv_167;
+typedef std::tuple<AgradDistributionsBeta, type_vv_168> AgradDistributionsBeta_vv_168;
+typedef std::tuple<AgradDistributionsBeta, type_vv_169> AgradDistributionsBeta_vv_169;
+typedef std::tuple<AgradDistributionsBeta, type_vv_170> AgradDistributionsBeta_vv_170;
+typedef std::tuple<AgradDistributionsBeta, type_vv_171> AgradDistributionsBeta_vv_171;
+typedef std::tuple<AgradDistributionsBeta, type_vv_172> AgradDistributionsBeta_vv_172;
+typedef std::tuple<AgradDistributionsBeta, type_vv_173> AgradDistributionsBeta_vv_173;
+typedef std::tuple<AgradDistributionsBeta, type_vv_174> AgradDistributionsBeta_vv_174;
+typedef std::tuple<AgradDistributionsBeta, type_vv_175> AgradDistributionsBeta_vv_175;
+typedef std::tuple<AgradDistributionsBeta, type_vv_176> AgradDistributionsBeta_vv_176;
+typedef std::tuple<AgradDistributionsBeta, type_vv_177> AgradDistributionsBeta_vv_177;
+typedef std::tuple<AgradDistributionsBeta, type_vv_178> AgradDistributionsBeta_vv_178;
+typedef std::tuple<AgradDistributionsBeta, type_vv_179> AgradDistributionsBeta_vv_179;
+typedef std::tuple<AgradDistributionsBeta, type_vv_180> AgradDistributionsBeta_vv_180;
+typedef std::tuple<AgradDistributionsBeta, type_vv_181> AgradDistributionsBeta_vv_181;
+typedef std::tuple<AgradDistributionsBeta, type_vv_182> AgradDistributionsBeta_vv_182;
+typedef std::tuple<AgradDistributionsBeta, type_vv_183> AgradDistributionsBeta_vv_183;
+typedef std::tuple<AgradDistributionsBeta, type_vv_184> AgradDistributionsBeta_vv_184;
+typedef std::tuple<AgradDistributionsBeta, type_vv_185> AgradDistributionsBeta_vv_185;
+typedef std::tuple<AgradDistributionsBeta, type_vv_186> AgradDistributionsBeta_vv_186;
+typedef std::tuple<AgradDistributionsBeta, type_vv_187> AgradDistributionsBeta_vv_187;
+typedef std::tuple<AgradDistributionsBeta, type_vv_188> AgradDistributionsBeta_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_100, AgradDistributionTestFixture, AgradDistributionsBeta_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_101, AgradDistributionTestFixture, AgradDistributionsBeta_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_102, AgradDistributionTestFixture, AgradDistributionsBeta_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_103, AgradDistributionTestFixture, AgradDistributionsBeta_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_104, AgradDistributionTestFixture, AgradDistributionsBeta_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_105, AgradDistributionTestFixture, AgradDistributionsBeta_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_106, AgradDistributionTestFixture, AgradDistributionsBeta_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_107, AgradDistributionTestFixture, AgradDistributionsBeta_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_108, AgradDistributionTestFixture, AgradDistributionsBeta_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_109, AgradDistributionTestFixture, AgradDistributionsBeta_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_110, AgradDistributionTestFixture, AgradDistributionsBeta_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_111, AgradDistributionTestFixture, AgradDistributionsBeta_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_112, AgradDistributionTestFixture, AgradDistributionsBeta_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_113, AgradDistributionTestFixture, AgradDistributionsBeta_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_114, AgradDistributionTestFixture, AgradDistributionsBeta_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_115, AgradDistributionTestFixture, AgradDistributionsBeta_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_116, AgradDistributionTestFixture, AgradDistributionsBeta_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_117, AgradDistributionTestFixture, AgradDistributionsBeta_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_118, AgradDistributionTestFixture, AgradDistributionsBeta_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_119, AgradDistributionTestFixture, AgradDistributionsBeta_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_120, AgradDistributionTestFixture, AgradDistributionsBeta_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_121, AgradDistributionTestFixture, AgradDistributionsBeta_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_122, AgradDistributionTestFixture, AgradDistributionsBeta_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_123, AgradDistributionTestFixture, AgradDistributionsBeta_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_124, AgradDistributionTestFixture, AgradDistributionsBeta_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_125, AgradDistributionTestFixture, AgradDistributionsBeta_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_126, AgradDistributionTestFixture, AgradDistributionsBeta_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_127, AgradDistributionTestFixture, AgradDistributionsBeta_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_128, AgradDistributionTestFixture, AgradDistributionsBeta_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_129, AgradDistributionTestFixture, AgradDistributionsBeta_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_130, AgradDistributionTestFixture, AgradDistributionsBeta_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_131, AgradDistributionTestFixture, AgradDistributionsBeta_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_132, AgradDistributionTestFixture, AgradDistributionsBeta_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_133, AgradDistributionTestFixture, AgradDistributionsBeta_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_134, AgradDistributionTestFixture, AgradDistributionsBeta_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_135, AgradDistributionTestFixture, AgradDistributionsBeta_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_136, AgradDistributionTestFixture, AgradDistributionsBeta_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_137, AgradDistributionTestFixture, AgradDistributionsBeta_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_138, AgradDistributionTestFixture, AgradDistributionsBeta_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_139, AgradDistributionTestFixture, AgradDistributionsBeta_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_140, AgradDistributionTestFixture, AgradDistributionsBeta_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_141, AgradDistributionTestFixture, AgradDistributionsBeta_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_142, AgradDistributionTestFixture, AgradDistributionsBeta_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_143, AgradDistributionTestFixture, AgradDistributionsBeta_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_144, AgradDistributionTestFixture, AgradDistributionsBeta_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_145, AgradDistributionTestFixture, AgradDistributionsBeta_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_146, AgradDistributionTestFixture, AgradDistributionsBeta_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_147, AgradDistributionTestFixture, AgradDistributionsBeta_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_148, AgradDistributionTestFixture, AgradDistributionsBeta_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_149, AgradDistributionTestFixture, AgradDistributionsBeta_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_150, AgradDistributionTestFixture, AgradDistributionsBeta_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_151, AgradDistributionTestFixture, AgradDistributionsBeta_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_152, AgradDistributionTestFixture, AgradDistributionsBeta_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_153, AgradDistributionTestFixture, AgradDistributionsBeta_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_154, AgradDistributionTestFixture, AgradDistributionsBeta_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_155, AgradDistributionTestFixture, AgradDistributionsBeta_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_156, AgradDistributionTestFixture, AgradDistributionsBeta_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_157, AgradDistributionTestFixture, AgradDistributionsBeta_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_158, AgradDistributionTestFixture, AgradDistributionsBeta_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_159, AgradDistributionTestFixture, AgradDistributionsBeta_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_160, AgradDistributionTestFixture, AgradDistributionsBeta_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_161, AgradDistributionTestFixture, AgradDistributionsBeta_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_162, AgradDistributionTestFixture, AgradDistributionsBeta_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_163, AgradDistributionTestFixture, AgradDistributionsBeta_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_164, AgradDistributionTestFixture, AgradDistributionsBeta_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_165, AgradDistributionTestFixture, AgradDistributionsBeta_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_166, AgradDistributionTestFixture, AgradDistributionsBeta_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_167, AgradDistributionTestFixture, AgradDistributionsBeta_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_168, AgradDistributionTestFixture, AgradDistributionsBeta_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_169, AgradDistributionTestFixture, AgradDistributionsBeta_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_170, AgradDistributionTestFixture, AgradDistributionsBeta_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_171, AgradDistributionTestFixture, AgradDistributionsBeta_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_172, AgradDistributionTestFixture, AgradDistributionsBeta_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_173, AgradDistributionTestFixture, AgradDistributionsBeta_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_174, AgradDistributionTestFixture, AgradDistributionsBeta_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_175, AgradDistributionTestFixture, AgradDistributionsBeta_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_176, AgradDistributionTestFixture, AgradDistributionsBeta_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_177, AgradDistributionTestFixture, AgradDistributionsBeta_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_178, AgradDistributionTestFixture, AgradDistributionsBeta_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_179, AgradDistributionTestFixture, AgradDistributionsBeta_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_180, AgradDistributionTestFixture, AgradDistributionsBeta_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_181, AgradDistributionTestFixture, AgradDistributionsBeta_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_182, AgradDistributionTestFixture, AgradDistributionsBeta_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_183, AgradDistributionTestFixture, AgradDistributionsBeta_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_184, AgradDistributionTestFixture, AgradDistributionsBeta_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_185, AgradDistributionTestFixture, AgradDistributionsBeta_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_186, AgradDistributionTestFixture, AgradDistributionsBeta_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_187, AgradDistributionTestFixture, AgradDistributionsBeta_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBeta_vv_188, AgradDistributionTestFixture, AgradDistributionsBeta_vv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_0> AgradCcdfLogBeta_ffv_0;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_1> AgradCcdfLogBeta_ffv_1;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_2> AgradCcdfLogBeta_ffv_2;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_3> AgradCcdfLogBeta_ffv_3;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_4> AgradCcdfLogBeta_ffv_4;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_5> AgradCcdfLogBeta_ffv_5;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_6> AgradCcdfLogBeta_ffv_6;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_7> AgradCcdfLogBeta_ffv_7;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_8> AgradCcdfLogBeta_ffv_8;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_9> AgradCcdfLogBeta_ffv_9;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_10> AgradCcdfLogBeta_ffv_10;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_11> AgradCcdfLogBeta_ffv_11;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_12> AgradCcdfLogBeta_ffv_12;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_13> AgradCcdfLogBeta_ffv_13;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_14> AgradCcdfLogBeta_ffv_14;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_15> AgradCcdfLogBeta_ffv_15;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_16> AgradCcdfLogBeta_ffv_16;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_17> AgradCcdfLogBeta_ffv_17;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_18> AgradCcdfLogBeta_ffv_18;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_19> AgradCcdfLogBeta_ffv_19;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_20> AgradCcdfLogBeta_ffv_20;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_21> AgradCcdfLogBeta_ffv_21;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_22> AgradCcdfLogBeta_ffv_22;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_23> AgradCcdfLogBeta_ffv_23;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_24> AgradCcdfLogBeta_ffv_24;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_25> AgradCcdfLogBeta_ffv_25;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_26> AgradCcdfLogBeta_ffv_26;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_27> AgradCcdfLogBeta_ffv_27;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_28> AgradCcdfLogBeta_ffv_28;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_29> AgradCcdfLogBeta_ffv_29;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_30> AgradCcdfLogBeta_ffv_30;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_31> AgradCcdfLogBeta_ffv_31;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_32> AgradCcdfLogBeta_ffv_32;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_33> AgradCcdfLogBeta_ffv_33;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_34> AgradCcdfLogBeta_ffv_34;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_35> AgradCcdfLogBeta_ffv_35;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_36> AgradCcdfLogBeta_ffv_36;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_37> AgradCcdfLogBeta_ffv_37;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_38> AgradCcdfLogBeta_ffv_38;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_39> AgradCcdfLogBeta_ffv_39;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_40> AgradCcdfLogBeta_ffv_40;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_41> AgradCcdfLogBeta_ffv_41;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_42> AgradCcdfLogBeta_ffv_42;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_43> AgradCcdfLogBeta_ffv_43;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_44> AgradCcdfLogBeta_ffv_44;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_45> AgradCcdfLogBeta_ffv_45;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_46> AgradCcdfLogBeta_ffv_46;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_47> AgradCcdfLogBeta_ffv_47;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_48> AgradCcdfLogBeta_ffv_48;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_49> AgradCcdfLogBeta_ffv_49;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_50> AgradCcdfLogBeta_ffv_50;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_51> AgradCcdfLogBeta_ffv_51;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_52> AgradCcdfLogBeta_ffv_52;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_53> AgradCcdfLogBeta_ffv_53;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_54> AgradCcdfLogBeta_ffv_54;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_55> AgradCcdfLogBeta_ffv_55;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_56> AgradCcdfLogBeta_ffv_56;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_57> AgradCcdfLogBeta_ffv_57;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_58> AgradCcdfLogBeta_ffv_58;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_59> AgradCcdfLogBeta_ffv_59;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_60> AgradCcdfLogBeta_ffv_60;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_61> AgradCcdfLogBeta_ffv_61;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_62> AgradCcdfLogBeta_ffv_62;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_63> AgradCcdfLogBeta_ffv_63;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_64> AgradCcdfLogBeta_ffv_64;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_65> AgradCcdfLogBeta_ffv_65;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_66> AgradCcdfLogBeta_ffv_66;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_67> AgradCcdfLogBeta_ffv_67;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_68> AgradCcdfLogBeta_ffv_68;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_69> AgradCcdfLogBeta_ffv_69;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_70> AgradCcdfLogBeta_ffv_70;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_71> AgradCcdfLogBeta_ffv_71;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_72> AgradCcdfLogBeta_ffv_72;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_73> AgradCcdfLogBeta_ffv_73;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_74> AgradCcdfLogBeta_ffv_74;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_75> AgradCcdfLogBeta_ffv_75;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_76> AgradCcdfLogBeta_ffv_76;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_77> AgradCcdfLogBeta_ffv_77;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_78> AgradCcdfLogBeta_ffv_78;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_79> AgradCcdfLogBeta_ffv_79;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_80> AgradCcdfLogBeta_ffv_80;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_81> AgradCcdfLogBeta_ffv_81;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_82> AgradCcdfLogBeta_ffv_82;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_83> AgradCcdfLogBeta_ffv_83;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_84> AgradCcdfLogBeta_ffv_84;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_85> AgradCcdfLogBeta_ffv_85;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_86> AgradCcdfLogBeta_ffv_86;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_87> AgradCcdfLogBeta_ffv_87;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_88> AgradCcdfLogBeta_ffv_88;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_89> AgradCcdfLogBeta_ffv_89;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_90> AgradCcdfLogBeta_ffv_90;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_91> AgradCcdfLogBeta_ffv_91;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_92> AgradCcdfLogBeta_ffv_92;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_93> AgradCcdfLogBeta_ffv_93;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_94> AgradCcdfLogBeta_ffv_94;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_95> AgradCcdfLogBeta_ffv_95;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_96> AgradCcdfLogBeta_ffv_96;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_97> AgradCcdfLogBeta_ffv_97;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_98> AgradCcdfLogBeta_ffv_98;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_99> AgradCcdfLogBeta_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_99);
+
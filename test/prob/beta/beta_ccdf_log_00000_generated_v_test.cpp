@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogBeta, type_v_0> AgradCcdfLogBeta_v_0;
+typedef std::tuple<AgradCcdfLogBeta, type_v_1> AgradCcdfLogBeta_v_1;
+typedef std::tuple<AgradCcdfLogBeta, type_v_2> AgradCcdfLogBeta_v_2;
+typedef std::tuple<AgradCcdfLogBeta, type_v_3> AgradCcdfLogBeta_v_3;
+typedef std::tuple<AgradCcdfLogBeta, type_v_4> AgradCcdfLogBeta_v_4;
+typedef std::tuple<AgradCcdfLogBeta, type_v_5> AgradCcdfLogBeta_v_5;
+typedef std::tuple<AgradCcdfLogBeta, type_v_6> AgradCcdfLogBeta_v_6;
+typedef std::tuple<AgradCcdfLogBeta, type_v_7> AgradCcdfLogBeta_v_7;
+typedef std::tuple<AgradCcdfLogBeta, type_v_8> AgradCcdfLogBeta_v_8;
+typedef std::tuple<AgradCcdfLogBeta, type_v_9> AgradCcdfLogBeta_v_9;
+typedef std::tuple<AgradCcdfLogBeta, type_v_10> AgradCcdfLogBeta_v_10;
+typedef std::tuple<AgradCcdfLogBeta, type_v_11> AgradCcdfLogBeta_v_11;
+typedef std::tuple<AgradCcdfLogBeta, type_v_12> AgradCcdfLogBeta_v_12;
+typedef std::tuple<AgradCcdfLogBeta, type_v_13> AgradCcdfLogBeta_v_13;
+typedef std::tuple<AgradCcdfLogBeta, type_v_14> AgradCcdfLogBeta_v_14;
+typedef std::tuple<AgradCcdfLogBeta, type_v_15> AgradCcdfLogBeta_v_15;
+typedef std::tuple<AgradCcdfLogBeta, type_v_16> AgradCcdfLogBeta_v_16;
+typedef std::tuple<AgradCcdfLogBeta, type_v_17> AgradCcdfLogBeta_v_17;
+typedef std::tuple<AgradCcdfLogBeta, type_v_18> AgradCcdfLogBeta_v_18;
+typedef std::tuple<AgradCcdfLogBeta, type_v_19> AgradCcdfLogBeta_v_19;
+typedef std::tuple<AgradCcdfLogBeta, type_v_20> AgradCcdfLogBeta_v_20;
+typedef std::tuple<AgradCcdfLogBeta, type_v_21> AgradCcdfLogBeta_v_21;
+typedef std::tuple<AgradCcdfLogBeta, type_v_22> AgradCcdfLogBeta_v_22;
+typedef std::tuple<AgradCcdfLogBeta, type_v_23> AgradCcdfLogBeta_v_23;
+typedef std::tuple<AgradCcdfLogBeta, type_v_24> AgradCcdfLogBeta_v_24;
+typedef std::tuple<AgradCcdfLogBeta, type_v_25> AgradCcdfLogBeta_v_25;
+typedef std::tuple<AgradCcdfLogBeta, type_v_26> AgradCcdfLogBeta_v_26;
+typedef std::tuple<AgradCcdfLogBeta, type_v_27> AgradCcdfLogBeta_v_27;
+typedef std::tuple<AgradCcdfLogBeta, type_v_28> AgradCcdfLogBeta_v_28;
+typedef std::tuple<AgradCcdfLogBeta, type_v_29> AgradCcdfLogBeta_v_29;
+typedef std::tuple<AgradCcdfLogBeta, type_v_30> AgradCcdfLogBeta_v_30;
+typedef std::tuple<AgradCcdfLogBeta, type_v_31> AgradCcdfLogBeta_v_31;
+typedef std::tuple<AgradCcdfLogBeta, type_v_32> AgradCcdfLogBeta_v_32;
+typedef std::tuple<AgradCcdfLogBeta, type_v_33> AgradCcdfLogBeta_v_33;
+typedef std::tuple<AgradCcdfLogBeta, type_v_34> AgradCcdfLogBeta_v_34;
+typedef std::tuple<AgradCcdfLogBeta, type_v_35> AgradCcdfLogBeta_v_35;
+typedef std::tuple<AgradCcdfLogBeta, type_v_36> AgradCcdfLogBeta_v_36;
+typedef std::tuple<AgradCcdfLogBeta, type_v_37> AgradCcdfLogBeta_v_37;
+typedef std::tuple<AgradCcdfLogBeta, type_v_38> AgradCcdfLogBeta_v_38;
+typedef std::tuple<AgradCcdfLogBeta, type_v_39> AgradCcdfLogBeta_v_39;
+typedef std::tuple<AgradCcdfLogBeta, type_v_40> AgradCcdfLogBeta_v_40;
+typedef std::tuple<AgradCcdfLogBeta, type_v_41> AgradCcdfLogBeta_v_41;
+typedef std::tuple<AgradCcdfLogBeta, type_v_42> AgradCcdfLogBeta_v_42;
+typedef std::tuple<AgradCcdfLogBeta, type_v_43> AgradCcdfLogBeta_v_43;
+typedef std::tuple<AgradCcdfLogBeta, type_v_44> AgradCcdfLogBeta_v_44;
+typedef std::tuple<AgradCcdfLogBeta, type_v_45> AgradCcdfLogBeta_v_45;
+typedef std::tuple<AgradCcdfLogBeta, type_v_46> AgradCcdfLogBeta_v_46;
+typedef std::tuple<AgradCcdfLogBeta, type_v_47> AgradCcdfLogBeta_v_47;
+typedef std::tuple<AgradCcdfLogBeta, type_v_48> AgradCcdfLogBeta_v_48;
+typedef std::tuple<AgradCcdfLogBeta, type_v_49> AgradCcdfLogBeta_v_49;
+typedef std::tuple<AgradCcdfLogBeta, type_v_50> AgradCcdfLogBeta_v_50;
+typedef std::tuple<AgradCcdfLogBeta, type_v_51> AgradCcdfLogBeta_v_51;
+typedef std::tuple<AgradCcdfLogBeta, type_v_52> AgradCcdfLogBeta_v_52;
+typedef std::tuple<AgradCcdfLogBeta, type_v_53> AgradCcdfLogBeta_v_53;
+typedef std::tuple<AgradCcdfLogBeta, type_v_54> AgradCcdfLogBeta_v_54;
+typedef std::tuple<AgradCcdfLogBeta, type_v_55> AgradCcdfLogBeta_v_55;
+typedef std::tuple<AgradCcdfLogBeta, type_v_56> AgradCcdfLogBeta_v_56;
+typedef std::tuple<AgradCcdfLogBeta, type_v_57> AgradCcdfLogBeta_v_57;
+typedef std::tuple<AgradCcdfLogBeta, type_v_58> AgradCcdfLogBeta_v_58;
+typedef std::tuple<AgradCcdfLogBeta, type_v_59> AgradCcdfLogBeta_v_59;
+typedef std::tuple<AgradCcdfLogBeta, type_v_60> AgradCcdfLogBeta_v_60;
+typedef std::tuple<AgradCcdfLogBeta, type_v_61> AgradCcdfLogBeta_v_61;
+typedef std::tuple<AgradCcdfLogBeta, type_v_62> AgradCcdfLogBeta_v_62;
+typedef std::tuple<AgradCcdfLogBeta, type_v_63> AgradCcdfLogBeta_v_63;
+typedef std::tuple<AgradCcdfLogBeta, type_v_64> AgradCcdfLogBeta_v_64;
+typedef std::tuple<AgradCcdfLogBeta, type_v_65> AgradCcdfLogBeta_v_65;
+typedef std::tuple<AgradCcdfLogBeta, type_v_66> AgradCcdfLogBeta_v_66;
+typedef std::tuple<AgradCcdfLogBeta, type_v_67> AgradCcdfLogBeta_v_67;
+typedef std::tuple<AgradCcdfLogBeta, type_v_68> AgradCcdfLogBeta_v_68;
+typedef std::tuple<AgradCcdfLogBeta, type_v_69> AgradCcdfLogBeta_v_69;
+typedef std::tuple<AgradCcdfLogBeta, type_v_70> AgradCcdfLogBeta_v_70;
+typedef std::tuple<AgradCcdfLogBeta, type_v_71> AgradCcdfLogBeta_v_71;
+typedef std::tuple<AgradCcdfLogBeta, type_v_72> AgradCcdfLogBeta_v_72;
+typedef std::tuple<AgradCcdfLogBeta, type_v_73> AgradCcdfLogBeta_v_73;
+typedef std::tuple<AgradCcdfLogBeta, type_v_74> AgradCcdfLogBeta_v_74;
+typedef std::tuple<AgradCcdfLogBeta, type_v_75> AgradCcdfLogBeta_v_75;
+typedef std::tuple<AgradCcdfLogBeta, type_v_76> AgradCcdfLogBeta_v_76;
+typedef std::tuple<AgradCcdfLogBeta, type_v_77> AgradCcdfLogBeta_v_77;
+typedef std::tuple<AgradCcdfLogBeta, type_v_78> AgradCcdfLogBeta_v_78;
+typedef std::tuple<AgradCcdfLogBeta, type_v_79> AgradCcdfLogBeta_v_79;
+typedef std::tuple<AgradCcdfLogBeta, type_v_80> AgradCcdfLogBeta_v_80;
+typedef std::tuple<AgradCcdfLogBeta, type_v_81> AgradCcdfLogBeta_v_81;
+typedef std::tuple<AgradCcdfLogBeta, type_v_82> AgradCcdfLogBeta_v_82;
+typedef std::tuple<AgradCcdfLogBeta, type_v_83> AgradCcdfLogBeta_v_83;
+typedef std::tuple<AgradCcdfLogBeta, type_v_84> AgradCcdfLogBeta_v_84;
+typedef std::tuple<AgradCcdfLogBeta, type_v_85> AgradCcdfLogBeta_v_85;
+typedef std::tuple<AgradCcdfLogBeta, type_v_86> AgradCcdfLogBeta_v_86;
+typedef std::tuple<AgradCcdfLogBeta, type_v_87> AgradCcdfLogBeta_v_87;
+typedef std::tuple<AgradCcdfLogBeta, type_v_88> AgradCcdfLogBeta_v_88;
+typedef std::tuple<AgradCcdfLogBeta, type_v_89> AgradCcdfLogBeta_v_89;
+typedef std::tuple<AgradCcdfLogBeta, type_v_90> AgradCcdfLogBeta_v_90;
+typedef std::tuple<AgradCcdfLogBeta, type_v_91> AgradCcdfLogBeta_v_91;
+typedef std::tuple<AgradCcdfLogBeta, type_v_92> AgradCcdfLogBeta_v_92;
+typedef std::tuple<AgradCcdfLogBeta, type_v_93> AgradCcdfLogBeta_v_93;
+typedef std::tuple<AgradCcdfLogBeta, type_v_94> AgradCcdfLogBeta_v_94;
+typedef std::tuple<AgradCcdfLogBeta, type_v_95> AgradCcdfLogBeta_v_95;
+typedef std::tuple<AgradCcdfLogBeta, type_v_96> AgradCcdfLogBeta_v_96;
+typedef std::tuple<AgradCcdfLogBeta, type_v_97> AgradCcdfLogBeta_v_97;
+typedef std::tuple<AgradCcdfLogBeta, type_v_98> AgradCcdfLogBeta_v_98;
+typedef std::tuple<AgradCcdfLogBeta, type_v_99> AgradCcdfLogBeta_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_0, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_1, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_2, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_3, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_4, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_5, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_6, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_7, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_8, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_9, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_10, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_11, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_12, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_13, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_14, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_15, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_16, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_17, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_18, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_19, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_20, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_21, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_22, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_23, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_24, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_25, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_26, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_27, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_28, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_29, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_30, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_31, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_32, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_33, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_34, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_35, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_36, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_37, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_38, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_39, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_40, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_41, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_42, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_43, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_44, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_45, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_46, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_47, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_48, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_49, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_50, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_51, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_52, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_53, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_54, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_55, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_56, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_57, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_58, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_59, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_60, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_61, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_62, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_63, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_64, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_65, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_66, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_67, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_68, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_69, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_70, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_71, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_72, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_73, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_74, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_75, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_76, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_77, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_78, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_79, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_80, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_81, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_82, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_83, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_84, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_85, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_86, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_87, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_88, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_89, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_90, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_91, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_92, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_93, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_94, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_95, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_96, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_97, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_98, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_99, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogBeta, type_vv_0> AgradCcdfLogBeta_vv_0;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_1> AgradCcdfLogBeta_vv_1;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_2> AgradCcdfLogBeta_vv_2;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_3> AgradCcdfLogBeta_vv_3;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_4> AgradCcdfLogBeta_vv_4;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_5> AgradCcdfLogBeta_vv_5;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_6> AgradCcdfLogBeta_vv_6;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_7> AgradCcdfLogBeta_vv_7;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_8> AgradCcdfLogBeta_vv_8;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_9> AgradCcdfLogBeta_vv_9;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_10> AgradCcdfLogBeta_vv_10;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_11> AgradCcdfLogBeta_vv_11;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_12> AgradCcdfLogBeta_vv_12;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_13> AgradCcdfLogBeta_vv_13;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_14> AgradCcdfLogBeta_vv_14;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_15> AgradCcdfLogBeta_vv_15;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_16> AgradCcdfLogBeta_vv_16;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_17> AgradCcdfLogBeta_vv_17;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_18> AgradCcdfLogBeta_vv_18;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_19> AgradCcdfLogBeta_vv_19;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_20> AgradCcdfLogBeta_vv_20;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_21> AgradCcdfLogBeta_vv_21;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_22> AgradCcdfLogBeta_vv_22;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_23> AgradCcdfLogBeta_vv_23;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_24> AgradCcdfLogBeta_vv_24;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_25> AgradCcdfLogBeta_vv_25;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_26> AgradCcdfLogBeta_vv_26;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_27> AgradCcdfLogBeta_vv_27;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_28> AgradCcdfLogBeta_vv_28;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_29> AgradCcdfLogBeta_vv_29;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_30> AgradCcdfLogBeta_vv_30;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_31> AgradCcdfLogBeta_vv_31;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_32> AgradCcdfLogBeta_vv_32;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_33> AgradCcdfLogBeta_vv_33;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_34> AgradCcdfLogBeta_vv_34;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_35> AgradCcdfLogBeta_vv_35;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_36> AgradCcdfLogBeta_vv_36;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_37> AgradCcdfLogBeta_vv_37;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_38> AgradCcdfLogBeta_vv_38;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_39> AgradCcdfLogBeta_vv_39;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_40> AgradCcdfLogBeta_vv_40;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_41> AgradCcdfLogBeta_vv_41;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_42> AgradCcdfLogBeta_vv_42;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_43> AgradCcdfLogBeta_vv_43;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_44> AgradCcdfLogBeta_vv_44;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_45> AgradCcdfLogBeta_vv_45;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_46> AgradCcdfLogBeta_vv_46;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_47> AgradCcdfLogBeta_vv_47;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_48> AgradCcdfLogBeta_vv_48;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_49> AgradCcdfLogBeta_vv_49;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_50> AgradCcdfLogBeta_vv_50;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_51> AgradCcdfLogBeta_vv_51;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_52> AgradCcdfLogBeta_vv_52;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_53> AgradCcdfLogBeta_vv_53;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_54> AgradCcdfLogBeta_vv_54;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_55> AgradCcdfLogBeta_vv_55;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_56> AgradCcdfLogBeta_vv_56;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_57> AgradCcdfLogBeta_vv_57;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_58> AgradCcdfLogBeta_vv_58;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_59> AgradCcdfLogBeta_vv_59;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_60> AgradCcdfLogBeta_vv_60;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_61> AgradCcdfLogBeta_vv_61;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_62> AgradCcdfLogBeta_vv_62;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_63> AgradCcdfLogBeta_vv_63;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_64> AgradCcdfLogBeta_vv_64;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_65> AgradCcdfLogBeta_vv_65;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_66> AgradCcdfLogBeta_vv_66;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_67> AgradCcdfLogBeta_vv_67;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_68> AgradCcdfLogBeta_vv_68;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_69> AgradCcdfLogBeta_vv_69;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_70> AgradCcdfLogBeta_vv_70;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_71> AgradCcdfLogBeta_vv_71;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_72> AgradCcdfLogBeta_vv_72;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_73> AgradCcdfLogBeta_vv_73;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_74> AgradCcdfLogBeta_vv_74;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_75> AgradCcdfLogBeta_vv_75;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_76> AgradCcdfLogBeta_vv_76;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_77> AgradCcdfLogBeta_vv_77;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_78> AgradCcdfLogBeta_vv_78;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_79> AgradCcdfLogBeta_vv_79;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_80> AgradCcdfLogBeta_vv_80;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_81> AgradCcdfLogBeta_vv_81;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_82> AgradCcdfLogBeta_vv_82;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_83> AgradCcdfLogBeta_vv_83;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_84> AgradCcdfLogBeta_vv_84;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_85> AgradCcdfLogBeta_vv_85;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_86> AgradCcdfLogBeta_vv_86;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_87> AgradCcdfLogBeta_vv_87;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_88> AgradCcdfLogBeta_vv_88;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_89> AgradCcdfLogBeta_vv_89;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_90> AgradCcdfLogBeta_vv_90;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_91> AgradCcdfLogBeta_vv_91;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_92> AgradCcdfLogBeta_vv_92;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_93> AgradCcdfLogBeta_vv_93;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_94> AgradCcdfLogBeta_vv_94;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_95> AgradCcdfLogBeta_vv_95;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_96> AgradCcdfLogBeta_vv_96;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_97> AgradCcdfLogBeta_vv_97;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_98> AgradCcdfLogBeta_vv_98;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_99> AgradCcdfLogBeta_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_99);
+
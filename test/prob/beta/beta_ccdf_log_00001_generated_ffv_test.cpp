@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_100> AgradCcdfLogBeta_ffv_100;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_101> AgradCcdfLogBeta_ffv_101;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_102> AgradCcdfLogBeta_ffv_102;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_103> AgradCcdfLogBeta_ffv_103;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_104> AgradCcdfLogBeta_ffv_104;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_105> AgradCcdfLogBeta_ffv_105;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_106> AgradCcdfLogBeta_ffv_106;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_107> AgradCcdfLogBeta_ffv_107;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_108> AgradCcdfLogBeta_ffv_108;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_109> AgradCcdfLogBeta_ffv_109;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_110> AgradCcdfLogBeta_ffv_110;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_111> AgradCcdfLogBeta_ffv_111;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_112> AgradCcdfLogBeta_ffv_112;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_113> AgradCcdfLogBeta_ffv_113;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_114> AgradCcdfLogBeta_ffv_114;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_115> AgradCcdfLogBeta_ffv_115;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_116> AgradCcdfLogBeta_ffv_116;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_117> AgradCcdfLogBeta_ffv_117;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_118> AgradCcdfLogBeta_ffv_118;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_119> AgradCcdfLogBeta_ffv_119;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_120> AgradCcdfLogBeta_ffv_120;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_121> AgradCcdfLogBeta_ffv_121;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_122> AgradCcdfLogBeta_ffv_122;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_123> AgradCcdfLogBeta_ffv_123;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_124> AgradCcdfLogBeta_ffv_124;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_125> AgradCcdfLogBeta_ffv_125;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_126> AgradCcdfLogBeta_ffv_126;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_127> AgradCcdfLogBeta_ffv_127;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_128> AgradCcdfLogBeta_ffv_128;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_129> AgradCcdfLogBeta_ffv_129;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_130> AgradCcdfLogBeta_ffv_130;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_131> AgradCcdfLogBeta_ffv_131;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_132> AgradCcdfLogBeta_ffv_132;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_133> AgradCcdfLogBeta_ffv_133;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_134> AgradCcdfLogBeta_ffv_134;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_135> AgradCcdfLogBeta_ffv_135;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_136> AgradCcdfLogBeta_ffv_136;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_137> AgradCcdfLogBeta_ffv_137;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_138> AgradCcdfLogBeta_ffv_138;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_139> AgradCcdfLogBeta_ffv_139;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_140> AgradCcdfLogBeta_ffv_140;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_141> AgradCcdfLogBeta_ffv_141;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_142> AgradCcdfLogBeta_ffv_142;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_143> AgradCcdfLogBeta_ffv_143;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_144> AgradCcdfLogBeta_ffv_144;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_145> AgradCcdfLogBeta_ffv_145;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_146> AgradCcdfLogBeta_ffv_146;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_147> AgradCcdfLogBeta_ffv_147;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_148> AgradCcdfLogBeta_ffv_148;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_149> AgradCcdfLogBeta_ffv_149;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_150> AgradCcdfLogBeta_ffv_150;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_151> AgradCcdfLogBeta_ffv_151;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_152> AgradCcdfLogBeta_ffv_152;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_153> AgradCcdfLogBeta_ffv_153;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_154> AgradCcdfLogBeta_ffv_154;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_155> AgradCcdfLogBeta_ffv_155;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_156> AgradCcdfLogBeta_ffv_156;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_157> AgradCcdfLogBeta_ffv_157;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_158> AgradCcdfLogBeta_ffv_158;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_159> AgradCcdfLogBeta_ffv_159;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_160> AgradCcdfLogBeta_ffv_160;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_161> AgradCcdfLogBeta_ffv_161;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_162> AgradCcdfLogBeta_ffv_162;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_163> AgradCcdfLogBeta_ffv_163;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_164> AgradCcdfLogBeta_ffv_164;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_165> AgradCcdfLogBeta_ffv_165;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_166> AgradCcdfLogBeta_ffv_166;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_167> AgradCcdfLogBeta_ffv_167;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_168> AgradCcdfLogBeta_ffv_168;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_169> AgradCcdfLogBeta_ffv_169;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_170> AgradCcdfLogBeta_ffv_170;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_171> AgradCcdfLogBeta_ffv_171;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_172> AgradCcdfLogBeta_ffv_172;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_173> AgradCcdfLogBeta_ffv_173;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_174> AgradCcdfLogBeta_ffv_174;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_175> AgradCcdfLogBeta_ffv_175;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_176> AgradCcdfLogBeta_ffv_176;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_177> AgradCcdfLogBeta_ffv_177;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_178> AgradCcdfLogBeta_ffv_178;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_179> AgradCcdfLogBeta_ffv_179;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_180> AgradCcdfLogBeta_ffv_180;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_181> AgradCcdfLogBeta_ffv_181;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_182> AgradCcdfLogBeta_ffv_182;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_183> AgradCcdfLogBeta_ffv_183;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_184> AgradCcdfLogBeta_ffv_184;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_185> AgradCcdfLogBeta_ffv_185;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_186> AgradCcdfLogBeta_ffv_186;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_187> AgradCcdfLogBeta_ffv_187;
+typedef std::tuple<AgradCcdfLogBeta, type_ffv_188> AgradCcdfLogBeta_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogBeta_ffv_188);
+
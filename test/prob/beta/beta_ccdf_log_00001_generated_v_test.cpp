@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogBeta, type_v_100> AgradCcdfLogBeta_v_100;
+typedef std::tuple<AgradCcdfLogBeta, type_v_101> AgradCcdfLogBeta_v_101;
+typedef std::tuple<AgradCcdfLogBeta, type_v_102> AgradCcdfLogBeta_v_102;
+typedef std::tuple<AgradCcdfLogBeta, type_v_103> AgradCcdfLogBeta_v_103;
+typedef std::tuple<AgradCcdfLogBeta, type_v_104> AgradCcdfLogBeta_v_104;
+typedef std::tuple<AgradCcdfLogBeta, type_v_105> AgradCcdfLogBeta_v_105;
+typedef std::tuple<AgradCcdfLogBeta, type_v_106> AgradCcdfLogBeta_v_106;
+typedef std::tuple<AgradCcdfLogBeta, type_v_107> AgradCcdfLogBeta_v_107;
+typedef std::tuple<AgradCcdfLogBeta, type_v_108> AgradCcdfLogBeta_v_108;
+typedef std::tuple<AgradCcdfLogBeta, type_v_109> AgradCcdfLogBeta_v_109;
+typedef std::tuple<AgradCcdfLogBeta, type_v_110> AgradCcdfLogBeta_v_110;
+typedef std::tuple<AgradCcdfLogBeta, type_v_111> AgradCcdfLogBeta_v_111;
+typedef std::tuple<AgradCcdfLogBeta, type_v_112> AgradCcdfLogBeta_v_112;
+typedef std::tuple<AgradCcdfLogBeta, type_v_113> AgradCcdfLogBeta_v_113;
+typedef std::tuple<AgradCcdfLogBeta, type_v_114> AgradCcdfLogBeta_v_114;
+typedef std::tuple<AgradCcdfLogBeta, type_v_115> AgradCcdfLogBeta_v_115;
+typedef std::tuple<AgradCcdfLogBeta, type_v_116> AgradCcdfLogBeta_v_116;
+typedef std::tuple<AgradCcdfLogBeta, type_v_117> AgradCcdfLogBeta_v_117;
+typedef std::tuple<AgradCcdfLogBeta, type_v_118> AgradCcdfLogBeta_v_118;
+typedef std::tuple<AgradCcdfLogBeta, type_v_119> AgradCcdfLogBeta_v_119;
+typedef std::tuple<AgradCcdfLogBeta, type_v_120> AgradCcdfLogBeta_v_120;
+typedef std::tuple<AgradCcdfLogBeta, type_v_121> AgradCcdfLogBeta_v_121;
+typedef std::tuple<AgradCcdfLogBeta, type_v_122> AgradCcdfLogBeta_v_122;
+typedef std::tuple<AgradCcdfLogBeta, type_v_123> AgradCcdfLogBeta_v_123;
+typedef std::tuple<AgradCcdfLogBeta, type_v_124> AgradCcdfLogBeta_v_124;
+typedef std::tuple<AgradCcdfLogBeta, type_v_125> AgradCcdfLogBeta_v_125;
+typedef std::tuple<AgradCcdfLogBeta, type_v_126> AgradCcdfLogBeta_v_126;
+typedef std::tuple<AgradCcdfLogBeta, type_v_127> AgradCcdfLogBeta_v_127;
+typedef std::tuple<AgradCcdfLogBeta, type_v_128> AgradCcdfLogBeta_v_128;
+typedef std::tuple<AgradCcdfLogBeta, type_v_129> AgradCcdfLogBeta_v_129;
+typedef std::tuple<AgradCcdfLogBeta, type_v_130> AgradCcdfLogBeta_v_130;
+typedef std::tuple<AgradCcdfLogBeta, type_v_131> AgradCcdfLogBeta_v_131;
+typedef std::tuple<AgradCcdfLogBeta, type_v_132> AgradCcdfLogBeta_v_132;
+typedef std::tuple<AgradCcdfLogBeta, type_v_133> AgradCcdfLogBeta_v_133;
+typedef std::tuple<AgradCcdfLogBeta, type_v_134> AgradCcdfLogBeta_v_134;
+typedef std::tuple<AgradCcdfLogBeta, type_v_135> AgradCcdfLogBeta_v_135;
+typedef std::tuple<AgradCcdfLogBeta, type_v_136> AgradCcdfLogBeta_v_136;
+typedef std::tuple<AgradCcdfLogBeta, type_v_137> AgradCcdfLogBeta_v_137;
+typedef std::tuple<AgradCcdfLogBeta, type_v_138> AgradCcdfLogBeta_v_138;
+typedef std::tuple<AgradCcdfLogBeta, type_v_139> AgradCcdfLogBeta_v_139;
+typedef std::tuple<AgradCcdfLogBeta, type_v_140> AgradCcdfLogBeta_v_140;
+typedef std::tuple<AgradCcdfLogBeta, type_v_141> AgradCcdfLogBeta_v_141;
+typedef std::tuple<AgradCcdfLogBeta, type_v_142> AgradCcdfLogBeta_v_142;
+typedef std::tuple<AgradCcdfLogBeta, type_v_143> AgradCcdfLogBeta_v_143;
+typedef std::tuple<AgradCcdfLogBeta, type_v_144> AgradCcdfLogBeta_v_144;
+typedef std::tuple<AgradCcdfLogBeta, type_v_145> AgradCcdfLogBeta_v_145;
+typedef std::tuple<AgradCcdfLogBeta, type_v_146> AgradCcdfLogBeta_v_146;
+typedef std::tuple<AgradCcdfLogBeta, type_v_147> AgradCcdfLogBeta_v_147;
+typedef std::tuple<AgradCcdfLogBeta, type_v_148> AgradCcdfLogBeta_v_148;
+typedef std::tuple<AgradCcdfLogBeta, type_v_149> AgradCcdfLogBeta_v_149;
+typedef std::tuple<AgradCcdfLogBeta, type_v_150> AgradCcdfLogBeta_v_150;
+typedef std::tuple<AgradCcdfLogBeta, type_v_151> AgradCcdfLogBeta_v_151;
+typedef std::tuple<AgradCcdfLogBeta, type_v_152> AgradCcdfLogBeta_v_152;
+typedef std::tuple<AgradCcdfLogBeta, type_v_153> AgradCcdfLogBeta_v_153;
+typedef std::tuple<AgradCcdfLogBeta, type_v_154> AgradCcdfLogBeta_v_154;
+typedef std::tuple<AgradCcdfLogBeta, type_v_155> AgradCcdfLogBeta_v_155;
+typedef std::tuple<AgradCcdfLogBeta, type_v_156> AgradCcdfLogBeta_v_156;
+typedef std::tuple<AgradCcdfLogBeta, type_v_157> AgradCcdfLogBeta_v_157;
+typedef std::tuple<AgradCcdfLogBeta, type_v_158> AgradCcdfLogBeta_v_158;
+typedef std::tuple<AgradCcdfLogBeta, type_v_159> AgradCcdfLogBeta_v_159;
+typedef std::tuple<AgradCcdfLogBeta, type_v_160> AgradCcdfLogBeta_v_160;
+typedef std::tuple<AgradCcdfLogBeta, type_v_161> AgradCcdfLogBeta_v_161;
+typedef std::tuple<AgradCcdfLogBeta, type_v_162> AgradCcdfLogBeta_v_162;
+typedef std::tuple<AgradCcdfLogBeta, type_v_163> AgradCcdfLogBeta_v_163;
+typedef std::tuple<AgradCcdfLogBeta, type_v_164> AgradCcdfLogBeta_v_164;
+typedef std::tuple<AgradCcdfLogBeta, type_v_165> AgradCcdfLogBeta_v_165;
+typedef std::tuple<AgradCcdfLogBeta, type_v_166> AgradCcdfLogBeta_v_166;
+typedef std::tuple<AgradCcdfLogBeta, type_v_167> AgradCcdfLogBeta_v_167;
+typedef std::tuple<AgradCcdfLogBeta, type_v_168> AgradCcdfLogBeta_v_168;
+typedef std::tuple<AgradCcdfLogBeta, type_v_169> AgradCcdfLogBeta_v_169;
+typedef std::tuple<AgradCcdfLogBeta, type_v_170> AgradCcdfLogBeta_v_170;
+typedef std::tuple<AgradCcdfLogBeta, type_v_171> AgradCcdfLogBeta_v_171;
+typedef std::tuple<AgradCcdfLogBeta, type_v_172> AgradCcdfLogBeta_v_172;
+typedef std::tuple<AgradCcdfLogBeta, type_v_173> AgradCcdfLogBeta_v_173;
+typedef std::tuple<AgradCcdfLogBeta, type_v_174> AgradCcdfLogBeta_v_174;
+typedef std::tuple<AgradCcdfLogBeta, type_v_175> AgradCcdfLogBeta_v_175;
+typedef std::tuple<AgradCcdfLogBeta, type_v_176> AgradCcdfLogBeta_v_176;
+typedef std::tuple<AgradCcdfLogBeta, type_v_177> AgradCcdfLogBeta_v_177;
+typedef std::tuple<AgradCcdfLogBeta, type_v_178> AgradCcdfLogBeta_v_178;
+typedef std::tuple<AgradCcdfLogBeta, type_v_179> AgradCcdfLogBeta_v_179;
+typedef std::tuple<AgradCcdfLogBeta, type_v_180> AgradCcdfLogBeta_v_180;
+typedef std::tuple<AgradCcdfLogBeta, type_v_181> AgradCcdfLogBeta_v_181;
+typedef std::tuple<AgradCcdfLogBeta, type_v_182> AgradCcdfLogBeta_v_182;
+typedef std::tuple<AgradCcdfLogBeta, type_v_183> AgradCcdfLogBeta_v_183;
+typedef std::tuple<AgradCcdfLogBeta, type_v_184> AgradCcdfLogBeta_v_184;
+typedef std::tuple<AgradCcdfLogBeta, type_v_185> AgradCcdfLogBeta_v_185;
+typedef std::tuple<AgradCcdfLogBeta, type_v_186> AgradCcdfLogBeta_v_186;
+typedef std::tuple<AgradCcdfLogBeta, type_v_187> AgradCcdfLogBeta_v_187;
+typedef std::tuple<AgradCcdfLogBeta, type_v_188> AgradCcdfLogBeta_v_188;
+typedef std::tuple<AgradCcdfLogBeta, type_v_189> AgradCcdfLogBeta_v_189;
+typedef std::tuple<AgradCcdfLogBeta, type_v_190> AgradCcdfLogBeta_v_190;
+typedef std::tuple<AgradCcdfLogBeta, type_v_191> AgradCcdfLogBeta_v_191;
+typedef std::tuple<AgradCcdfLogBeta, type_v_192> AgradCcdfLogBeta_v_192;
+typedef std::tuple<AgradCcdfLogBeta, type_v_193> AgradCcdfLogBeta_v_193;
+typedef std::tuple<AgradCcdfLogBeta, type_v_194> AgradCcdfLogBeta_v_194;
+typedef std::tuple<AgradCcdfLogBeta, type_v_195> AgradCcdfLogBeta_v_195;
+typedef std::tuple<AgradCcdfLogBeta, type_v_196> AgradCcdfLogBeta_v_196;
+typedef std::tuple<AgradCcdfLogBeta, type_v_197> AgradCcdfLogBeta_v_197;
+typedef std::tuple<AgradCcdfLogBeta, type_v_198> AgradCcdfLogBeta_v_198;
+typedef std::tuple<AgradCcdfLogBeta, type_v_199> AgradCcdfLogBeta_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_100, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_101, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_102, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_103, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_104, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_105, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_106, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_107, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_108, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_109, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_110, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_111, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_112, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_113, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_114, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_115, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_116, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_117, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_118, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_119, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_120, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_121, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_122, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_123, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_124, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_125, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_126, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_127, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_128, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_129, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_130, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_131, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_132, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_133, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_134, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_135, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_136, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_137, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_138, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_139, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_140, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_141, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_142, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_143, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_144, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_145, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_146, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_147, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_148, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_149, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_150, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_151, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_152, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_153, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_154, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_155, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_156, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_157, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_158, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_159, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_160, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_161, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_162, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_163, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_164, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_165, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_166, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_167, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_168, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_169, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_170, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_171, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_172, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_173, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_174, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_175, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_176, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_177, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_178, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_179, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_180, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_181, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_182, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_183, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_184, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_185, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_186, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_187, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_188, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_189, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_190, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_191, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_192, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_193, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_194, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_195, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_196, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_197, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_198, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_199, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogBeta, type_vv_100> AgradCcdfLogBeta_vv_100;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_101> AgradCcdfLogBeta_vv_101;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_102> AgradCcdfLogBeta_vv_102;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_103> AgradCcdfLogBeta_vv_103;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_104> AgradCcdfLogBeta_vv_104;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_105> AgradCcdfLogBeta_vv_105;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_106> AgradCcdfLogBeta_vv_106;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_107> AgradCcdfLogBeta_vv_107;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_108> AgradCcdfLogBeta_vv_108;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_109> AgradCcdfLogBeta_vv_109;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_110> AgradCcdfLogBeta_vv_110;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_111> AgradCcdfLogBeta_vv_111;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_112> AgradCcdfLogBeta_vv_112;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_113> AgradCcdfLogBeta_vv_113;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_114> AgradCcdfLogBeta_vv_114;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_115> AgradCcdfLogBeta_vv_115;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_116> AgradCcdfLogBeta_vv_116;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_117> AgradCcdfLogBeta_vv_117;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_118> AgradCcdfLogBeta_vv_118;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_119> AgradCcdfLogBeta_vv_119;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_120> AgradCcdfLogBeta_vv_120;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_121> AgradCcdfLogBeta_vv_121;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_122> AgradCcdfLogBeta_vv_122;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_123> AgradCcdfLogBeta_vv_123;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_124> AgradCcdfLogBeta_vv_124;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_125> AgradCcdfLogBeta_vv_125;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_126> AgradCcdfLogBeta_vv_126;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_127> AgradCcdfLogBeta_vv_127;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_128> AgradCcdfLogBeta_vv_128;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_129> AgradCcdfLogBeta_vv_129;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_130> AgradCcdfLogBeta_vv_130;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_131> AgradCcdfLogBeta_vv_131;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_132> AgradCcdfLogBeta_vv_132;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_133> AgradCcdfLogBeta_vv_133;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_134> AgradCcdfLogBeta_vv_134;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_135> AgradCcdfLogBeta_vv_135;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_136> AgradCcdfLogBeta_vv_136;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_137> AgradCcdfLogBeta_vv_137;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_138> AgradCcdfLogBeta_vv_138;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_139> AgradCcdfLogBeta_vv_139;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_140> AgradCcdfLogBeta_vv_140;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_141> AgradCcdfLogBeta_vv_141;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_142> AgradCcdfLogBeta_vv_142;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_143> AgradCcdfLogBeta_vv_143;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_144> AgradCcdfLogBeta_vv_144;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_145> AgradCcdfLogBeta_vv_145;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_146> AgradCcdfLogBeta_vv_146;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_147> AgradCcdfLogBeta_vv_147;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_148> AgradCcdfLogBeta_vv_148;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_149> AgradCcdfLogBeta_vv_149;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_150> AgradCcdfLogBeta_vv_150;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_151> AgradCcdfLogBeta_vv_151;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_152> AgradCcdfLogBeta_vv_152;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_153> AgradCcdfLogBeta_vv_153;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_154> AgradCcdfLogBeta_vv_154;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_155> AgradCcdfLogBeta_vv_155;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_156> AgradCcdfLogBeta_vv_156;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_157> AgradCcdfLogBeta_vv_157;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_158> AgradCcdfLogBeta_vv_158;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_159> AgradCcdfLogBeta_vv_159;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_160> AgradCcdfLogBeta_vv_160;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_161> AgradCcdfLogBeta_vv_161;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_162> AgradCcdfLogBeta_vv_162;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_163> AgradCcdfLogBeta_vv_163;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_164> AgradCcdfLogBeta_vv_164;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_165> AgradCcdfLogBeta_vv_165;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_166> AgradCcdfLogBeta_vv_166;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_167> AgradCcdfLogBeta_vv_167;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_168> AgradCcdfLogBeta_vv_168;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_169> AgradCcdfLogBeta_vv_169;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_170> AgradCcdfLogBeta_vv_170;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_171> AgradCcdfLogBeta_vv_171;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_172> AgradCcdfLogBeta_vv_172;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_173> AgradCcdfLogBeta_vv_173;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_174> AgradCcdfLogBeta_vv_174;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_175> AgradCcdfLogBeta_vv_175;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_176> AgradCcdfLogBeta_vv_176;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_177> AgradCcdfLogBeta_vv_177;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_178> AgradCcdfLogBeta_vv_178;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_179> AgradCcdfLogBeta_vv_179;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_180> AgradCcdfLogBeta_vv_180;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_181> AgradCcdfLogBeta_vv_181;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_182> AgradCcdfLogBeta_vv_182;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_183> AgradCcdfLogBeta_vv_183;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_184> AgradCcdfLogBeta_vv_184;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_185> AgradCcdfLogBeta_vv_185;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_186> AgradCcdfLogBeta_vv_186;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_187> AgradCcdfLogBeta_vv_187;
+typedef std::tuple<AgradCcdfLogBeta, type_vv_188> AgradCcdfLogBeta_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogBeta_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCcdfLogBeta, type_v_200> AgradCcdfLogBeta_v_200;
+typedef std::tuple<AgradCcdfLogBeta, type_v_201> AgradCcdfLogBeta_v_201;
+typedef std::tuple<AgradCcdfLogBeta, type_v_202> AgradCcdfLogBeta_v_202;
+typedef std::tuple<AgradCcdfLogBeta, type_v_203> AgradCcdfLogBeta_v_203;
+typedef std::tuple<AgradCcdfLogBeta, type_v_204> AgradCcdfLogBeta_v_204;
+typedef std::tuple<AgradCcdfLogBeta, type_v_205> AgradCcdfLogBeta_v_205;
+typedef std::tuple<AgradCcdfLogBeta, type_v_206> AgradCcdfLogBeta_v_206;
+typedef std::tuple<AgradCcdfLogBeta, type_v_207> AgradCcdfLogBeta_v_207;
+typedef std::tuple<AgradCcdfLogBeta, type_v_208> AgradCcdfLogBeta_v_208;
+typedef std::tuple<AgradCcdfLogBeta, type_v_209> AgradCcdfLogBeta_v_209;
+typedef std::tuple<AgradCcdfLogBeta, type_v_210> AgradCcdfLogBeta_v_210;
+typedef std::tuple<AgradCcdfLogBeta, type_v_211> AgradCcdfLogBeta_v_211;
+typedef std::tuple<AgradCcdfLogBeta, type_v_212> AgradCcdfLogBeta_v_212;
+typedef std::tuple<AgradCcdfLogBeta, type_v_213> AgradCcdfLogBeta_v_213;
+typedef std::tuple<AgradCcdfLogBeta, type_v_214> AgradCcdfLogBeta_v_214;
+typedef std::tuple<AgradCcdfLogBeta, type_v_215> AgradCcdfLogBeta_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_200, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_201, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_202, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_203, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_204, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_205, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_206, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_207, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_208, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_209, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_210, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_211, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_212, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_213, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_214, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBeta_v_215, AgradCcdfLogTestFixture, AgradCcdfLogBeta_v_215);
+
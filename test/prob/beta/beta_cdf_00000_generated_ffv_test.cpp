@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfBeta, type_ffv_0> AgradCdfBeta_ffv_0;
+typedef std::tuple<AgradCdfBeta, type_ffv_1> AgradCdfBeta_ffv_1;
+typedef std::tuple<AgradCdfBeta, type_ffv_2> AgradCdfBeta_ffv_2;
+typedef std::tuple<AgradCdfBeta, type_ffv_3> AgradCdfBeta_ffv_3;
+typedef std::tuple<AgradCdfBeta, type_ffv_4> AgradCdfBeta_ffv_4;
+typedef std::tuple<AgradCdfBeta, type_ffv_5> AgradCdfBeta_ffv_5;
+typedef std::tuple<AgradCdfBeta, type_ffv_6> AgradCdfBeta_ffv_6;
+typedef std::tuple<AgradCdfBeta, type_ffv_7> AgradCdfBeta_ffv_7;
+typedef std::tuple<AgradCdfBeta, type_ffv_8> AgradCdfBeta_ffv_8;
+typedef std::tuple<AgradCdfBeta, type_ffv_9> AgradCdfBeta_ffv_9;
+typedef std::tuple<AgradCdfBeta, type_ffv_10> AgradCdfBeta_ffv_10;
+typedef std::tuple<AgradCdfBeta, type_ffv_11> AgradCdfBeta_ffv_11;
+typedef std::tuple<AgradCdfBeta, type_ffv_12> AgradCdfBeta_ffv_12;
+typedef std::tuple<AgradCdfBeta, type_ffv_13> AgradCdfBeta_ffv_13;
+typedef std::tuple<AgradCdfBeta, type_ffv_14> AgradCdfBeta_ffv_14;
+typedef std::tuple<AgradCdfBeta, type_ffv_15> AgradCdfBeta_ffv_15;
+typedef std::tuple<AgradCdfBeta, type_ffv_16> AgradCdfBeta_ffv_16;
+typedef std::tuple<AgradCdfBeta, type_ffv_17> AgradCdfBeta_ffv_17;
+typedef std::tuple<AgradCdfBeta, type_ffv_18> AgradCdfBeta_ffv_18;
+typedef std::tuple<AgradCdfBeta, type_ffv_19> AgradCdfBeta_ffv_19;
+typedef std::tuple<AgradCdfBeta, type_ffv_20> AgradCdfBeta_ffv_20;
+typedef std::tuple<AgradCdfBeta, type_ffv_21> AgradCdfBeta_ffv_21;
+typedef std::tuple<AgradCdfBeta, type_ffv_22> AgradCdfBeta_ffv_22;
+typedef std::tuple<AgradCdfBeta, type_ffv_23> AgradCdfBeta_ffv_23;
+typedef std::tuple<AgradCdfBeta, type_ffv_24> AgradCdfBeta_ffv_24;
+typedef std::tuple<AgradCdfBeta, type_ffv_25> AgradCdfBeta_ffv_25;
+typedef std::tuple<AgradCdfBeta, type_ffv_26> AgradCdfBeta_ffv_26;
+typedef std::tuple<AgradCdfBeta, type_ffv_27> AgradCdfBeta_ffv_27;
+typedef std::tuple<AgradCdfBeta, type_ffv_28> AgradCdfBeta_ffv_28;
+typedef std::tuple<AgradCdfBeta, type_ffv_29> AgradCdfBeta_ffv_29;
+typedef std::tuple<AgradCdfBeta, type_ffv_30> AgradCdfBeta_ffv_30;
+typedef std::tuple<AgradCdfBeta, type_ffv_31> AgradCdfBeta_ffv_31;
+typedef std::tuple<AgradCdfBeta, type_ffv_32> AgradCdfBeta_ffv_32;
+typedef std::tuple<AgradCdfBeta, type_ffv_33> AgradCdfBeta_ffv_33;
+typedef std::tuple<AgradCdfBeta, type_ffv_34> AgradCdfBeta_ffv_34;
+typedef std::tuple<AgradCdfBeta, type_ffv_35> AgradCdfBeta_ffv_35;
+typedef std::tuple<AgradCdfBeta, type_ffv_36> AgradCdfBeta_ffv_36;
+typedef std::tuple<AgradCdfBeta, type_ffv_37> AgradCdfBeta_ffv_37;
+typedef std::tuple<AgradCdfBeta, type_ffv_38> AgradCdfBeta_ffv_38;
+typedef std::tuple<AgradCdfBeta, type_ffv_39> AgradCdfBeta_ffv_39;
+typedef std::tuple<AgradCdfBeta, type_ffv_40> AgradCdfBeta_ffv_40;
+typedef std::tuple<AgradCdfBeta, type_ffv_41> AgradCdfBeta_ffv_41;
+typedef std::tuple<AgradCdfBeta, type_ffv_42> AgradCdfBeta_ffv_42;
+typedef std::tuple<AgradCdfBeta, type_ffv_43> AgradCdfBeta_ffv_43;
+typedef std::tuple<AgradCdfBeta, type_ffv_44> AgradCdfBeta_ffv_44;
+typedef std::tuple<AgradCdfBeta, type_ffv_45> AgradCdfBeta_ffv_45;
+typedef std::tuple<AgradCdfBeta, type_ffv_46> AgradCdfBeta_ffv_46;
+typedef std::tuple<AgradCdfBeta, type_ffv_47> AgradCdfBeta_ffv_47;
+typedef std::tuple<AgradCdfBeta, type_ffv_48> AgradCdfBeta_ffv_48;
+typedef std::tuple<AgradCdfBeta, type_ffv_49> AgradCdfBeta_ffv_49;
+typedef std::tuple<AgradCdfBeta, type_ffv_50> AgradCdfBeta_ffv_50;
+typedef std::tuple<AgradCdfBeta, type_ffv_51> AgradCdfBeta_ffv_51;
+typedef std::tuple<AgradCdfBeta, type_ffv_52> AgradCdfBeta_ffv_52;
+typedef std::tuple<AgradCdfBeta, type_ffv_53> AgradCdfBeta_ffv_53;
+typedef std::tuple<AgradCdfBeta, type_ffv_54> AgradCdfBeta_ffv_54;
+typedef std::tuple<AgradCdfBeta, type_ffv_55> AgradCdfBeta_ffv_55;
+typedef std::tuple<AgradCdfBeta, type_ffv_56> AgradCdfBeta_ffv_56;
+typedef std::tuple<AgradCdfBeta, type_ffv_57> AgradCdfBeta_ffv_57;
+typedef std::tuple<AgradCdfBeta, type_ffv_58> AgradCdfBeta_ffv_58;
+typedef std::tuple<AgradCdfBeta, type_ffv_59> AgradCdfBeta_ffv_59;
+typedef std::tuple<AgradCdfBeta, type_ffv_60> AgradCdfBeta_ffv_60;
+typedef std::tuple<AgradCdfBeta, type_ffv_61> AgradCdfBeta_ffv_61;
+typedef std::tuple<AgradCdfBeta, type_ffv_62> AgradCdfBeta_ffv_62;
+typedef std::tuple<AgradCdfBeta, type_ffv_63> AgradCdfBeta_ffv_63;
+typedef std::tuple<AgradCdfBeta, type_ffv_64> AgradCdfBeta_ffv_64;
+typedef std::tuple<AgradCdfBeta, type_ffv_65> AgradCdfBeta_ffv_65;
+typedef std::tuple<AgradCdfBeta, type_ffv_66> AgradCdfBeta_ffv_66;
+typedef std::tuple<AgradCdfBeta, type_ffv_67> AgradCdfBeta_ffv_67;
+typedef std::tuple<AgradCdfBeta, type_ffv_68> AgradCdfBeta_ffv_68;
+typedef std::tuple<AgradCdfBeta, type_ffv_69> AgradCdfBeta_ffv_69;
+typedef std::tuple<AgradCdfBeta, type_ffv_70> AgradCdfBeta_ffv_70;
+typedef std::tuple<AgradCdfBeta, type_ffv_71> AgradCdfBeta_ffv_71;
+typedef std::tuple<AgradCdfBeta, type_ffv_72> AgradCdfBeta_ffv_72;
+typedef std::tuple<AgradCdfBeta, type_ffv_73> AgradCdfBeta_ffv_73;
+typedef std::tuple<AgradCdfBeta, type_ffv_74> AgradCdfBeta_ffv_74;
+typedef std::tuple<AgradCdfBeta, type_ffv_75> AgradCdfBeta_ffv_75;
+typedef std::tuple<AgradCdfBeta, type_ffv_76> AgradCdfBeta_ffv_76;
+typedef std::tuple<AgradCdfBeta, type_ffv_77> AgradCdfBeta_ffv_77;
+typedef std::tuple<AgradCdfBeta, type_ffv_78> AgradCdfBeta_ffv_78;
+typedef std::tuple<AgradCdfBeta, type_ffv_79> AgradCdfBeta_ffv_79;
+typedef std::tuple<AgradCdfBeta, type_ffv_80> AgradCdfBeta_ffv_80;
+typedef std::tuple<AgradCdfBeta, type_ffv_81> AgradCdfBeta_ffv_81;
+typedef std::tuple<AgradCdfBeta, type_ffv_82> AgradCdfBeta_ffv_82;
+typedef std::tuple<AgradCdfBeta, type_ffv_83> AgradCdfBeta_ffv_83;
+typedef std::tuple<AgradCdfBeta, type_ffv_84> AgradCdfBeta_ffv_84;
+typedef std::tuple<AgradCdfBeta, type_ffv_85> AgradCdfBeta_ffv_85;
+typedef std::tuple<AgradCdfBeta, type_ffv_86> AgradCdfBeta_ffv_86;
+typedef std::tuple<AgradCdfBeta, type_ffv_87> AgradCdfBeta_ffv_87;
+typedef std::tuple<AgradCdfBeta, type_ffv_88> AgradCdfBeta_ffv_88;
+typedef std::tuple<AgradCdfBeta, type_ffv_89> AgradCdfBeta_ffv_89;
+typedef std::tuple<AgradCdfBeta, type_ffv_90> AgradCdfBeta_ffv_90;
+typedef std::tuple<AgradCdfBeta, type_ffv_91> AgradCdfBeta_ffv_91;
+typedef std::tuple<AgradCdfBeta, type_ffv_92> AgradCdfBeta_ffv_92;
+typedef std::tuple<AgradCdfBeta, type_ffv_93> AgradCdfBeta_ffv_93;
+typedef std::tuple<AgradCdfBeta, type_ffv_94> AgradCdfBeta_ffv_94;
+typedef std::tuple<AgradCdfBeta, type_ffv_95> AgradCdfBeta_ffv_95;
+typedef std::tuple<AgradCdfBeta, type_ffv_96> AgradCdfBeta_ffv_96;
+typedef std::tuple<AgradCdfBeta, type_ffv_97> AgradCdfBeta_ffv_97;
+typedef std::tuple<AgradCdfBeta, type_ffv_98> AgradCdfBeta_ffv_98;
+typedef std::tuple<AgradCdfBeta, type_ffv_99> AgradCdfBeta_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_0, AgradCdfTestFixture, AgradCdfBeta_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_1, AgradCdfTestFixture, AgradCdfBeta_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_2, AgradCdfTestFixture, AgradCdfBeta_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_3, AgradCdfTestFixture, AgradCdfBeta_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_4, AgradCdfTestFixture, AgradCdfBeta_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_5, AgradCdfTestFixture, AgradCdfBeta_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_6, AgradCdfTestFixture, AgradCdfBeta_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_7, AgradCdfTestFixture, AgradCdfBeta_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_8, AgradCdfTestFixture, AgradCdfBeta_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_9, AgradCdfTestFixture, AgradCdfBeta_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_10, AgradCdfTestFixture, AgradCdfBeta_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_11, AgradCdfTestFixture, AgradCdfBeta_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_12, AgradCdfTestFixture, AgradCdfBeta_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_13, AgradCdfTestFixture, AgradCdfBeta_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_14, AgradCdfTestFixture, AgradCdfBeta_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_15, AgradCdfTestFixture, AgradCdfBeta_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_16, AgradCdfTestFixture, AgradCdfBeta_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_17, AgradCdfTestFixture, AgradCdfBeta_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_18, AgradCdfTestFixture, AgradCdfBeta_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_19, AgradCdfTestFixture, AgradCdfBeta_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_20, AgradCdfTestFixture, AgradCdfBeta_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_21, AgradCdfTestFixture, AgradCdfBeta_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_22, AgradCdfTestFixture, AgradCdfBeta_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_23, AgradCdfTestFixture, AgradCdfBeta_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_24, AgradCdfTestFixture, AgradCdfBeta_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_25, AgradCdfTestFixture, AgradCdfBeta_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_26, AgradCdfTestFixture, AgradCdfBeta_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_27, AgradCdfTestFixture, AgradCdfBeta_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_28, AgradCdfTestFixture, AgradCdfBeta_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_29, AgradCdfTestFixture, AgradCdfBeta_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_30, AgradCdfTestFixture, AgradCdfBeta_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_31, AgradCdfTestFixture, AgradCdfBeta_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_32, AgradCdfTestFixture, AgradCdfBeta_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_33, AgradCdfTestFixture, AgradCdfBeta_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_34, AgradCdfTestFixture, AgradCdfBeta_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_35, AgradCdfTestFixture, AgradCdfBeta_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_36, AgradCdfTestFixture, AgradCdfBeta_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_37, AgradCdfTestFixture, AgradCdfBeta_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_38, AgradCdfTestFixture, AgradCdfBeta_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_39, AgradCdfTestFixture, AgradCdfBeta_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_40, AgradCdfTestFixture, AgradCdfBeta_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_41, AgradCdfTestFixture, AgradCdfBeta_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_42, AgradCdfTestFixture, AgradCdfBeta_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_43, AgradCdfTestFixture, AgradCdfBeta_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_44, AgradCdfTestFixture, AgradCdfBeta_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_45, AgradCdfTestFixture, AgradCdfBeta_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_46, AgradCdfTestFixture, AgradCdfBeta_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_47, AgradCdfTestFixture, AgradCdfBeta_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_48, AgradCdfTestFixture, AgradCdfBeta_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_49, AgradCdfTestFixture, AgradCdfBeta_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_50, AgradCdfTestFixture, AgradCdfBeta_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_51, AgradCdfTestFixture, AgradCdfBeta_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_52, AgradCdfTestFixture, AgradCdfBeta_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_53, AgradCdfTestFixture, AgradCdfBeta_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_54, AgradCdfTestFixture, AgradCdfBeta_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_55, AgradCdfTestFixture, AgradCdfBeta_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_56, AgradCdfTestFixture, AgradCdfBeta_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_57, AgradCdfTestFixture, AgradCdfBeta_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_58, AgradCdfTestFixture, AgradCdfBeta_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_59, AgradCdfTestFixture, AgradCdfBeta_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_60, AgradCdfTestFixture, AgradCdfBeta_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_61, AgradCdfTestFixture, AgradCdfBeta_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_62, AgradCdfTestFixture, AgradCdfBeta_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_63, AgradCdfTestFixture, AgradCdfBeta_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_64, AgradCdfTestFixture, AgradCdfBeta_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_65, AgradCdfTestFixture, AgradCdfBeta_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_66, AgradCdfTestFixture, AgradCdfBeta_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_67, AgradCdfTestFixture, AgradCdfBeta_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_68, AgradCdfTestFixture, AgradCdfBeta_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_69, AgradCdfTestFixture, AgradCdfBeta_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_70, AgradCdfTestFixture, AgradCdfBeta_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_71, AgradCdfTestFixture, AgradCdfBeta_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_72, AgradCdfTestFixture, AgradCdfBeta_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_73, AgradCdfTestFixture, AgradCdfBeta_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_74, AgradCdfTestFixture, AgradCdfBeta_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_75, AgradCdfTestFixture, AgradCdfBeta_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_76, AgradCdfTestFixture, AgradCdfBeta_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_77, AgradCdfTestFixture, AgradCdfBeta_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_78, AgradCdfTestFixture, AgradCdfBeta_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_79, AgradCdfTestFixture, AgradCdfBeta_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_80, AgradCdfTestFixture, AgradCdfBeta_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_81, AgradCdfTestFixture, AgradCdfBeta_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_82, AgradCdfTestFixture, AgradCdfBeta_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_83, AgradCdfTestFixture, AgradCdfBeta_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_84, AgradCdfTestFixture, AgradCdfBeta_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_85, AgradCdfTestFixture, AgradCdfBeta_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_86, AgradCdfTestFixture, AgradCdfBeta_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_87, AgradCdfTestFixture, AgradCdfBeta_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_88, AgradCdfTestFixture, AgradCdfBeta_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_89, AgradCdfTestFixture, AgradCdfBeta_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_90, AgradCdfTestFixture, AgradCdfBeta_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_91, AgradCdfTestFixture, AgradCdfBeta_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_92, AgradCdfTestFixture, AgradCdfBeta_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_93, AgradCdfTestFixture, AgradCdfBeta_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_94, AgradCdfTestFixture, AgradCdfBeta_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_95, AgradCdfTestFixture, AgradCdfBeta_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_96, AgradCdfTestFixture, AgradCdfBeta_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_97, AgradCdfTestFixture, AgradCdfBeta_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_98, AgradCdfTestFixture, AgradCdfBeta_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_99, AgradCdfTestFixture, AgradCdfBeta_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfBeta, type_v_0> AgradCdfBeta_v_0;
+typedef std::tuple<AgradCdfBeta, type_v_1> AgradCdfBeta_v_1;
+typedef std::tuple<AgradCdfBeta, type_v_2> AgradCdfBeta_v_2;
+typedef std::tuple<AgradCdfBeta, type_v_3> AgradCdfBeta_v_3;
+typedef std::tuple<AgradCdfBeta, type_v_4> AgradCdfBeta_v_4;
+typedef std::tuple<AgradCdfBeta, type_v_5> AgradCdfBeta_v_5;
+typedef std::tuple<AgradCdfBeta, type_v_6> AgradCdfBeta_v_6;
+typedef std::tuple<AgradCdfBeta, type_v_7> AgradCdfBeta_v_7;
+typedef std::tuple<AgradCdfBeta, type_v_8> AgradCdfBeta_v_8;
+typedef std::tuple<AgradCdfBeta, type_v_9> AgradCdfBeta_v_9;
+typedef std::tuple<AgradCdfBeta, type_v_10> AgradCdfBeta_v_10;
+typedef std::tuple<AgradCdfBeta, type_v_11> AgradCdfBeta_v_11;
+typedef std::tuple<AgradCdfBeta, type_v_12> AgradCdfBeta_v_12;
+typedef std::tuple<AgradCdfBeta, type_v_13> AgradCdfBeta_v_13;
+typedef std::tuple<AgradCdfBeta, type_v_14> AgradCdfBeta_v_14;
+typedef std::tuple<AgradCdfBeta, type_v_15> AgradCdfBeta_v_15;
+typedef std::tuple<AgradCdfBeta, type_v_16> AgradCdfBeta_v_16;
+typedef std::tuple<AgradCdfBeta, type_v_17> AgradCdfBeta_v_17;
+typedef std::tuple<AgradCdfBeta, type_v_18> AgradCdfBeta_v_18;
+typedef std::tuple<AgradCdfBeta, type_v_19> AgradCdfBeta_v_19;
+typedef std::tuple<AgradCdfBeta, type_v_20> AgradCdfBeta_v_20;
+typedef std::tuple<AgradCdfBeta, type_v_21> AgradCdfBeta_v_21;
+typedef std::tuple<AgradCdfBeta, type_v_22> AgradCdfBeta_v_22;
+typedef std::tuple<AgradCdfBeta, type_v_23> AgradCdfBeta_v_23;
+typedef std::tuple<AgradCdfBeta, type_v_24> AgradCdfBeta_v_24;
+typedef std::tuple<AgradCdfBeta, type_v_25> AgradCdfBeta_v_25;
+typedef std::tuple<AgradCdfBeta, type_v_26> AgradCdfBeta_v_26;
+typedef std::tuple<AgradCdfBeta, type_v_27> AgradCdfBeta_v_27;
+typedef std::tuple<AgradCdfBeta, type_v_28> AgradCdfBeta_v_28;
+typedef std::tuple<AgradCdfBeta, type_v_29> AgradCdfBeta_v_29;
+typedef std::tuple<AgradCdfBeta, type_v_30> AgradCdfBeta_v_30;
+typedef std::tuple<AgradCdfBeta, type_v_31> AgradCdfBeta_v_31;
+typedef std::tuple<AgradCdfBeta, type_v_32> AgradCdfBeta_v_32;
+typedef std::tuple<AgradCdfBeta, type_v_33> AgradCdfBeta_v_33;
+typedef std::tuple<AgradCdfBeta, type_v_34> AgradCdfBeta_v_34;
+typedef std::tuple<AgradCdfBeta, type_v_35> AgradCdfBeta_v_35;
+typedef std::tuple<AgradCdfBeta, type_v_36> AgradCdfBeta_v_36;
+typedef std::tuple<AgradCdfBeta, type_v_37> AgradCdfBeta_v_37;
+typedef std::tuple<AgradCdfBeta, type_v_38> AgradCdfBeta_v_38;
+typedef std::tuple<AgradCdfBeta, type_v_39> AgradCdfBeta_v_39;
+typedef std::tuple<AgradCdfBeta, type_v_40> AgradCdfBeta_v_40;
+typedef std::tuple<AgradCdfBeta, type_v_41> AgradCdfBeta_v_41;
+typedef std::tuple<AgradCdfBeta, type_v_42> AgradCdfBeta_v_42;
+typedef std::tuple<AgradCdfBeta, type_v_43> AgradCdfBeta_v_43;
+typedef std::tuple<AgradCdfBeta, type_v_44> AgradCdfBeta_v_44;
+typedef std::tuple<AgradCdfBeta, type_v_45> AgradCdfBeta_v_45;
+typedef std::tuple<AgradCdfBeta, type_v_46> AgradCdfBeta_v_46;
+typedef std::tuple<AgradCdfBeta, type_v_47> AgradCdfBeta_v_47;
+typedef std::tuple<AgradCdfBeta, type_v_48> AgradCdfBeta_v_48;
+typedef std::tuple<AgradCdfBeta, type_v_49> AgradCdfBeta_v_49;
+typedef std::tuple<AgradCdfBeta, type_v_50> AgradCdfBeta_v_50;
+typedef std::tuple<AgradCdfBeta, type_v_51> AgradCdfBeta_v_51;
+typedef std::tuple<AgradCdfBeta, type_v_52> AgradCdfBeta_v_52;
+typedef std::tuple<AgradCdfBeta, type_v_53> AgradCdfBeta_v_53;
+typedef std::tuple<AgradCdfBeta, type_v_54> AgradCdfBeta_v_54;
+typedef std::tuple<AgradCdfBeta, type_v_55> AgradCdfBeta_v_55;
+typedef std::tuple<AgradCdfBeta, type_v_56> AgradCdfBeta_v_56;
+typedef std::tuple<AgradCdfBeta, type_v_57> AgradCdfBeta_v_57;
+typedef std::tuple<AgradCdfBeta, type_v_58> AgradCdfBeta_v_58;
+typedef std::tuple<AgradCdfBeta, type_v_59> AgradCdfBeta_v_59;
+typedef std::tuple<AgradCdfBeta, type_v_60> AgradCdfBeta_v_60;
+typedef std::tuple<AgradCdfBeta, type_v_61> AgradCdfBeta_v_61;
+typedef std::tuple<AgradCdfBeta, type_v_62> AgradCdfBeta_v_62;
+typedef std::tuple<AgradCdfBeta, type_v_63> AgradCdfBeta_v_63;
+typedef std::tuple<AgradCdfBeta, type_v_64> AgradCdfBeta_v_64;
+typedef std::tuple<AgradCdfBeta, type_v_65> AgradCdfBeta_v_65;
+typedef std::tuple<AgradCdfBeta, type_v_66> AgradCdfBeta_v_66;
+typedef std::tuple<AgradCdfBeta, type_v_67> AgradCdfBeta_v_67;
+typedef std::tuple<AgradCdfBeta, type_v_68> AgradCdfBeta_v_68;
+typedef std::tuple<AgradCdfBeta, type_v_69> AgradCdfBeta_v_69;
+typedef std::tuple<AgradCdfBeta, type_v_70> AgradCdfBeta_v_70;
+typedef std::tuple<AgradCdfBeta, type_v_71> AgradCdfBeta_v_71;
+typedef std::tuple<AgradCdfBeta, type_v_72> AgradCdfBeta_v_72;
+typedef std::tuple<AgradCdfBeta, type_v_73> AgradCdfBeta_v_73;
+typedef std::tuple<AgradCdfBeta, type_v_74> AgradCdfBeta_v_74;
+typedef std::tuple<AgradCdfBeta, type_v_75> AgradCdfBeta_v_75;
+typedef std::tuple<AgradCdfBeta, type_v_76> AgradCdfBeta_v_76;
+typedef std::tuple<AgradCdfBeta, type_v_77> AgradCdfBeta_v_77;
+typedef std::tuple<AgradCdfBeta, type_v_78> AgradCdfBeta_v_78;
+typedef std::tuple<AgradCdfBeta, type_v_79> AgradCdfBeta_v_79;
+typedef std::tuple<AgradCdfBeta, type_v_80> AgradCdfBeta_v_80;
+typedef std::tuple<AgradCdfBeta, type_v_81> AgradCdfBeta_v_81;
+typedef std::tuple<AgradCdfBeta, type_v_82> AgradCdfBeta_v_82;
+typedef std::tuple<AgradCdfBeta, type_v_83> AgradCdfBeta_v_83;
+typedef std::tuple<AgradCdfBeta, type_v_84> AgradCdfBeta_v_84;
+typedef std::tuple<AgradCdfBeta, type_v_85> AgradCdfBeta_v_85;
+typedef std::tuple<AgradCdfBeta, type_v_86> AgradCdfBeta_v_86;
+typedef std::tuple<AgradCdfBeta, type_v_87> AgradCdfBeta_v_87;
+typedef std::tuple<AgradCdfBeta, type_v_88> AgradCdfBeta_v_88;
+typedef std::tuple<AgradCdfBeta, type_v_89> AgradCdfBeta_v_89;
+typedef std::tuple<AgradCdfBeta, type_v_90> AgradCdfBeta_v_90;
+typedef std::tuple<AgradCdfBeta, type_v_91> AgradCdfBeta_v_91;
+typedef std::tuple<AgradCdfBeta, type_v_92> AgradCdfBeta_v_92;
+typedef std::tuple<AgradCdfBeta, type_v_93> AgradCdfBeta_v_93;
+typedef std::tuple<AgradCdfBeta, type_v_94> AgradCdfBeta_v_94;
+typedef std::tuple<AgradCdfBeta, type_v_95> AgradCdfBeta_v_95;
+typedef std::tuple<AgradCdfBeta, type_v_96> AgradCdfBeta_v_96;
+typedef std::tuple<AgradCdfBeta, type_v_97> AgradCdfBeta_v_97;
+typedef std::tuple<AgradCdfBeta, type_v_98> AgradCdfBeta_v_98;
+typedef std::tuple<AgradCdfBeta, type_v_99> AgradCdfBeta_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_0, AgradCdfTestFixture, AgradCdfBeta_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_1, AgradCdfTestFixture, AgradCdfBeta_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_2, AgradCdfTestFixture, AgradCdfBeta_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_3, AgradCdfTestFixture, AgradCdfBeta_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_4, AgradCdfTestFixture, AgradCdfBeta_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_5, AgradCdfTestFixture, AgradCdfBeta_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_6, AgradCdfTestFixture, AgradCdfBeta_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_7, AgradCdfTestFixture, AgradCdfBeta_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_8, AgradCdfTestFixture, AgradCdfBeta_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_9, AgradCdfTestFixture, AgradCdfBeta_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_10, AgradCdfTestFixture, AgradCdfBeta_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_11, AgradCdfTestFixture, AgradCdfBeta_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_12, AgradCdfTestFixture, AgradCdfBeta_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_13, AgradCdfTestFixture, AgradCdfBeta_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_14, AgradCdfTestFixture, AgradCdfBeta_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_15, AgradCdfTestFixture, AgradCdfBeta_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_16, AgradCdfTestFixture, AgradCdfBeta_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_17, AgradCdfTestFixture, AgradCdfBeta_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_18, AgradCdfTestFixture, AgradCdfBeta_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_19, AgradCdfTestFixture, AgradCdfBeta_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_20, AgradCdfTestFixture, AgradCdfBeta_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_21, AgradCdfTestFixture, AgradCdfBeta_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_22, AgradCdfTestFixture, AgradCdfBeta_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_23, AgradCdfTestFixture, AgradCdfBeta_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_24, AgradCdfTestFixture, AgradCdfBeta_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_25, AgradCdfTestFixture, AgradCdfBeta_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_26, AgradCdfTestFixture, AgradCdfBeta_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_27, AgradCdfTestFixture, AgradCdfBeta_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_28, AgradCdfTestFixture, AgradCdfBeta_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_29, AgradCdfTestFixture, AgradCdfBeta_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_30, AgradCdfTestFixture, AgradCdfBeta_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_31, AgradCdfTestFixture, AgradCdfBeta_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_32, AgradCdfTestFixture, AgradCdfBeta_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_33, AgradCdfTestFixture, AgradCdfBeta_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_34, AgradCdfTestFixture, AgradCdfBeta_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_35, AgradCdfTestFixture, AgradCdfBeta_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_36, AgradCdfTestFixture, AgradCdfBeta_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_37, AgradCdfTestFixture, AgradCdfBeta_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_38, AgradCdfTestFixture, AgradCdfBeta_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_39, AgradCdfTestFixture, AgradCdfBeta_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_40, AgradCdfTestFixture, AgradCdfBeta_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_41, AgradCdfTestFixture, AgradCdfBeta_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_42, AgradCdfTestFixture, AgradCdfBeta_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_43, AgradCdfTestFixture, AgradCdfBeta_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_44, AgradCdfTestFixture, AgradCdfBeta_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_45, AgradCdfTestFixture, AgradCdfBeta_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_46, AgradCdfTestFixture, AgradCdfBeta_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_47, AgradCdfTestFixture, AgradCdfBeta_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_48, AgradCdfTestFixture, AgradCdfBeta_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_49, AgradCdfTestFixture, AgradCdfBeta_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_50, AgradCdfTestFixture, AgradCdfBeta_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_51, AgradCdfTestFixture, AgradCdfBeta_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_52, AgradCdfTestFixture, AgradCdfBeta_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_53, AgradCdfTestFixture, AgradCdfBeta_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_54, AgradCdfTestFixture, AgradCdfBeta_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_55, AgradCdfTestFixture, AgradCdfBeta_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_56, AgradCdfTestFixture, AgradCdfBeta_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_57, AgradCdfTestFixture, AgradCdfBeta_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_58, AgradCdfTestFixture, AgradCdfBeta_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_59, AgradCdfTestFixture, AgradCdfBeta_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_60, AgradCdfTestFixture, AgradCdfBeta_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_61, AgradCdfTestFixture, AgradCdfBeta_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_62, AgradCdfTestFixture, AgradCdfBeta_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_63, AgradCdfTestFixture, AgradCdfBeta_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_64, AgradCdfTestFixture, AgradCdfBeta_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_65, AgradCdfTestFixture, AgradCdfBeta_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_66, AgradCdfTestFixture, AgradCdfBeta_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_67, AgradCdfTestFixture, AgradCdfBeta_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_68, AgradCdfTestFixture, AgradCdfBeta_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_69, AgradCdfTestFixture, AgradCdfBeta_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_70, AgradCdfTestFixture, AgradCdfBeta_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_71, AgradCdfTestFixture, AgradCdfBeta_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_72, AgradCdfTestFixture, AgradCdfBeta_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_73, AgradCdfTestFixture, AgradCdfBeta_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_74, AgradCdfTestFixture, AgradCdfBeta_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_75, AgradCdfTestFixture, AgradCdfBeta_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_76, AgradCdfTestFixture, AgradCdfBeta_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_77, AgradCdfTestFixture, AgradCdfBeta_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_78, AgradCdfTestFixture, AgradCdfBeta_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_79, AgradCdfTestFixture, AgradCdfBeta_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_80, AgradCdfTestFixture, AgradCdfBeta_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_81, AgradCdfTestFixture, AgradCdfBeta_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_82, AgradCdfTestFixture, AgradCdfBeta_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_83, AgradCdfTestFixture, AgradCdfBeta_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_84, AgradCdfTestFixture, AgradCdfBeta_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_85, AgradCdfTestFixture, AgradCdfBeta_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_86, AgradCdfTestFixture, AgradCdfBeta_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_87, AgradCdfTestFixture, AgradCdfBeta_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_88, AgradCdfTestFixture, AgradCdfBeta_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_89, AgradCdfTestFixture, AgradCdfBeta_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_90, AgradCdfTestFixture, AgradCdfBeta_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_91, AgradCdfTestFixture, AgradCdfBeta_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_92, AgradCdfTestFixture, AgradCdfBeta_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_93, AgradCdfTestFixture, AgradCdfBeta_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_94, AgradCdfTestFixture, AgradCdfBeta_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_95, AgradCdfTestFixture, AgradCdfBeta_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_96, AgradCdfTestFixture, AgradCdfBeta_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_97, AgradCdfTestFixture, AgradCdfBeta_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_98, AgradCdfTestFixture, AgradCdfBeta_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_99, AgradCdfTestFixture, AgradCdfBeta_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfBeta, type_vv_0> AgradCdfBeta_vv_0;
+typedef std::tuple<AgradCdfBeta, type_vv_1> AgradCdfBeta_vv_1;
+typedef std::tuple<AgradCdfBeta, type_vv_2> AgradCdfBeta_vv_2;
+typedef std::tuple<AgradCdfBeta, type_vv_3> AgradCdfBeta_vv_3;
+typedef std::tuple<AgradCdfBeta, type_vv_4> AgradCdfBeta_vv_4;
+typedef std::tuple<AgradCdfBeta, type_vv_5> AgradCdfBeta_vv_5;
+typedef std::tuple<AgradCdfBeta, type_vv_6> AgradCdfBeta_vv_6;
+typedef std::tuple<AgradCdfBeta, type_vv_7> AgradCdfBeta_vv_7;
+typedef std::tuple<AgradCdfBeta, type_vv_8> AgradCdfBeta_vv_8;
+typedef std::tuple<AgradCdfBeta, type_vv_9> AgradCdfBeta_vv_9;
+typedef std::tuple<AgradCdfBeta, type_vv_10> AgradCdfBeta_vv_10;
+typedef std::tuple<AgradCdfBeta, type_vv_11> AgradCdfBeta_vv_11;
+typedef std::tuple<AgradCdfBeta, type_vv_12> AgradCdfBeta_vv_12;
+typedef std::tuple<AgradCdfBeta, type_vv_13> AgradCdfBeta_vv_13;
+typedef std::tuple<AgradCdfBeta, type_vv_14> AgradCdfBeta_vv_14;
+typedef std::tuple<AgradCdfBeta, type_vv_15> AgradCdfBeta_vv_15;
+typedef std::tuple<AgradCdfBeta, type_vv_16> AgradCdfBeta_vv_16;
+typedef std::tuple<AgradCdfBeta, type_vv_17> AgradCdfBeta_vv_17;
+typedef std::tuple<AgradCdfBeta, type_vv_18> AgradCdfBeta_vv_18;
+typedef std::tuple<AgradCdfBeta, type_vv_19> AgradCdfBeta_vv_19;
+typedef std::tuple<AgradCdfBeta, type_vv_20> AgradCdfBeta_vv_20;
+typedef std::tuple<AgradCdfBeta, type_vv_21> AgradCdfBeta_vv_21;
+typedef std::tuple<AgradCdfBeta, type_vv_22> AgradCdfBeta_vv_22;
+typedef std::tuple<AgradCdfBeta, type_vv_23> AgradCdfBeta_vv_23;
+typedef std::tuple<AgradCdfBeta, type_vv_24> AgradCdfBeta_vv_24;
+typedef std::tuple<AgradCdfBeta, type_vv_25> AgradCdfBeta_vv_25;
+typedef std::tuple<AgradCdfBeta, type_vv_26> AgradCdfBeta_vv_26;
+typedef std::tuple<AgradCdfBeta, type_vv_27> AgradCdfBeta_vv_27;
+typedef std::tuple<AgradCdfBeta, type_vv_28> AgradCdfBeta_vv_28;
+typedef std::tuple<AgradCdfBeta, type_vv_29> AgradCdfBeta_vv_29;
+typedef std::tuple<AgradCdfBeta, type_vv_30> AgradCdfBeta_vv_30;
+typedef std::tuple<AgradCdfBeta, type_vv_31> AgradCdfBeta_vv_31;
+typedef std::tuple<AgradCdfBeta, type_vv_32> AgradCdfBeta_vv_32;
+typedef std::tuple<AgradCdfBeta, type_vv_33> AgradCdfBeta_vv_33;
+typedef std::tuple<AgradCdfBeta, type_vv_34> AgradCdfBeta_vv_34;
+typedef std::tuple<AgradCdfBeta, type_vv_35> AgradCdfBeta_vv_35;
+typedef std::tuple<AgradCdfBeta, type_vv_36> AgradCdfBeta_vv_36;
+typedef std::tuple<AgradCdfBeta, type_vv_37> AgradCdfBeta_vv_37;
+typedef std::tuple<AgradCdfBeta, type_vv_38> AgradCdfBeta_vv_38;
+typedef std::tuple<AgradCdfBeta, type_vv_39> AgradCdfBeta_vv_39;
+typedef std::tuple<AgradCdfBeta, type_vv_40> AgradCdfBeta_vv_40;
+typedef std::tuple<AgradCdfBeta, type_vv_41> AgradCdfBeta_vv_41;
+typedef std::tuple<AgradCdfBeta, type_vv_42> AgradCdfBeta_vv_42;
+typedef std::tuple<AgradCdfBeta, type_vv_43> AgradCdfBeta_vv_43;
+typedef std::tuple<AgradCdfBeta, type_vv_44> AgradCdfBeta_vv_44;
+typedef std::tuple<AgradCdfBeta, type_vv_45> AgradCdfBeta_vv_45;
+typedef std::tuple<AgradCdfBeta, type_vv_46> AgradCdfBeta_vv_46;
+typedef std::tuple<AgradCdfBeta, type_vv_47> AgradCdfBeta_vv_47;
+typedef std::tuple<AgradCdfBeta, type_vv_48> AgradCdfBeta_vv_48;
+typedef std::tuple<AgradCdfBeta, type_vv_49> AgradCdfBeta_vv_49;
+typedef std::tuple<AgradCdfBeta, type_vv_50> AgradCdfBeta_vv_50;
+typedef std::tuple<AgradCdfBeta, type_vv_51> AgradCdfBeta_vv_51;
+typedef std::tuple<AgradCdfBeta, type_vv_52> AgradCdfBeta_vv_52;
+typedef std::tuple<AgradCdfBeta, type_vv_53> AgradCdfBeta_vv_53;
+typedef std::tuple<AgradCdfBeta, type_vv_54> AgradCdfBeta_vv_54;
+typedef std::tuple<AgradCdfBeta, type_vv_55> AgradCdfBeta_vv_55;
+typedef std::tuple<AgradCdfBeta, type_vv_56> AgradCdfBeta_vv_56;
+typedef std::tuple<AgradCdfBeta, type_vv_57> AgradCdfBeta_vv_57;
+typedef std::tuple<AgradCdfBeta, type_vv_58> AgradCdfBeta_vv_58;
+typedef std::tuple<AgradCdfBeta, type_vv_59> AgradCdfBeta_vv_59;
+typedef std::tuple<AgradCdfBeta, type_vv_60> AgradCdfBeta_vv_60;
+typedef std::tuple<AgradCdfBeta, type_vv_61> AgradCdfBeta_vv_61;
+typedef std::tuple<AgradCdfBeta, type_vv_62> AgradCdfBeta_vv_62;
+typedef std::tuple<AgradCdfBeta, type_vv_63> AgradCdfBeta_vv_63;
+typedef std::tuple<AgradCdfBeta, type_vv_64> AgradCdfBeta_vv_64;
+typedef std::tuple<AgradCdfBeta, type_vv_65> AgradCdfBeta_vv_65;
+typedef std::tuple<AgradCdfBeta, type_vv_66> AgradCdfBeta_vv_66;
+typedef std::tuple<AgradCdfBeta, type_vv_67> AgradCdfBeta_vv_67;
+typedef std::tuple<AgradCdfBeta, type_vv_68> AgradCdfBeta_vv_68;
+typedef std::tuple<AgradCdfBeta, type_vv_69> AgradCdfBeta_vv_69;
+typedef std::tuple<AgradCdfBeta, type_vv_70> AgradCdfBeta_vv_70;
+typedef std::tuple<AgradCdfBeta, type_vv_71> AgradCdfBeta_vv_71;
+typedef std::tuple<AgradCdfBeta, type_vv_72> AgradCdfBeta_vv_72;
+typedef std::tuple<AgradCdfBeta, type_vv_73> AgradCdfBeta_vv_73;
+typedef std::tuple<AgradCdfBeta, type_vv_74> AgradCdfBeta_vv_74;
+typedef std::tuple<AgradCdfBeta, type_vv_75> AgradCdfBeta_vv_75;
+typedef std::tuple<AgradCdfBeta, type_vv_76> AgradCdfBeta_vv_76;
+typedef std::tuple<AgradCdfBeta, type_vv_77> AgradCdfBeta_vv_77;
+typedef std::tuple<AgradCdfBeta, type_vv_78> AgradCdfBeta_vv_78;
+typedef std::tuple<AgradCdfBeta, type_vv_79> AgradCdfBeta_vv_79;
+typedef std::tuple<AgradCdfBeta, type_vv_80> AgradCdfBeta_vv_80;
+typedef std::tuple<AgradCdfBeta, type_vv_81> AgradCdfBeta_vv_81;
+typedef std::tuple<AgradCdfBeta, type_vv_82> AgradCdfBeta_vv_82;
+typedef std::tuple<AgradCdfBeta, type_vv_83> AgradCdfBeta_vv_83;
+typedef std::tuple<AgradCdfBeta, type_vv_84> AgradCdfBeta_vv_84;
+typedef std::tuple<AgradCdfBeta, type_vv_85> AgradCdfBeta_vv_85;
+typedef std::tuple<AgradCdfBeta, type_vv_86> AgradCdfBeta_vv_86;
+typedef std::tuple<AgradCdfBeta, type_vv_87> AgradCdfBeta_vv_87;
+typedef std::tuple<AgradCdfBeta, type_vv_88> AgradCdfBeta_vv_88;
+typedef std::tuple<AgradCdfBeta, type_vv_89> AgradCdfBeta_vv_89;
+typedef std::tuple<AgradCdfBeta, type_vv_90> AgradCdfBeta_vv_90;
+typedef std::tuple<AgradCdfBeta, type_vv_91> AgradCdfBeta_vv_91;
+typedef std::tuple<AgradCdfBeta, type_vv_92> AgradCdfBeta_vv_92;
+typedef std::tuple<AgradCdfBeta, type_vv_93> AgradCdfBeta_vv_93;
+typedef std::tuple<AgradCdfBeta, type_vv_94> AgradCdfBeta_vv_94;
+typedef std::tuple<AgradCdfBeta, type_vv_95> AgradCdfBeta_vv_95;
+typedef std::tuple<AgradCdfBeta, type_vv_96> AgradCdfBeta_vv_96;
+typedef std::tuple<AgradCdfBeta, type_vv_97> AgradCdfBeta_vv_97;
+typedef std::tuple<AgradCdfBeta, type_vv_98> AgradCdfBeta_vv_98;
+typedef std::tuple<AgradCdfBeta, type_vv_99> AgradCdfBeta_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_0, AgradCdfTestFixture, AgradCdfBeta_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_1, AgradCdfTestFixture, AgradCdfBeta_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_2, AgradCdfTestFixture, AgradCdfBeta_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_3, AgradCdfTestFixture, AgradCdfBeta_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_4, AgradCdfTestFixture, AgradCdfBeta_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_5, AgradCdfTestFixture, AgradCdfBeta_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_6, AgradCdfTestFixture, AgradCdfBeta_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_7, AgradCdfTestFixture, AgradCdfBeta_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_8, AgradCdfTestFixture, AgradCdfBeta_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_9, AgradCdfTestFixture, AgradCdfBeta_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_10, AgradCdfTestFixture, AgradCdfBeta_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_11, AgradCdfTestFixture, AgradCdfBeta_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_12, AgradCdfTestFixture, AgradCdfBeta_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_13, AgradCdfTestFixture, AgradCdfBeta_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_14, AgradCdfTestFixture, AgradCdfBeta_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_15, AgradCdfTestFixture, AgradCdfBeta_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_16, AgradCdfTestFixture, AgradCdfBeta_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_17, AgradCdfTestFixture, AgradCdfBeta_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_18, AgradCdfTestFixture, AgradCdfBeta_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_19, AgradCdfTestFixture, AgradCdfBeta_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_20, AgradCdfTestFixture, AgradCdfBeta_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_21, AgradCdfTestFixture, AgradCdfBeta_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_22, AgradCdfTestFixture, AgradCdfBeta_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_23, AgradCdfTestFixture, AgradCdfBeta_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_24, AgradCdfTestFixture, AgradCdfBeta_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_25, AgradCdfTestFixture, AgradCdfBeta_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_26, AgradCdfTestFixture, AgradCdfBeta_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_27, AgradCdfTestFixture, AgradCdfBeta_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_28, AgradCdfTestFixture, AgradCdfBeta_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_29, AgradCdfTestFixture, AgradCdfBeta_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_30, AgradCdfTestFixture, AgradCdfBeta_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_31, AgradCdfTestFixture, AgradCdfBeta_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_32, AgradCdfTestFixture, AgradCdfBeta_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_33, AgradCdfTestFixture, AgradCdfBeta_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_34, AgradCdfTestFixture, AgradCdfBeta_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_35, AgradCdfTestFixture, AgradCdfBeta_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_36, AgradCdfTestFixture, AgradCdfBeta_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_37, AgradCdfTestFixture, AgradCdfBeta_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_38, AgradCdfTestFixture, AgradCdfBeta_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_39, AgradCdfTestFixture, AgradCdfBeta_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_40, AgradCdfTestFixture, AgradCdfBeta_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_41, AgradCdfTestFixture, AgradCdfBeta_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_42, AgradCdfTestFixture, AgradCdfBeta_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_43, AgradCdfTestFixture, AgradCdfBeta_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_44, AgradCdfTestFixture, AgradCdfBeta_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_45, AgradCdfTestFixture, AgradCdfBeta_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_46, AgradCdfTestFixture, AgradCdfBeta_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_47, AgradCdfTestFixture, AgradCdfBeta_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_48, AgradCdfTestFixture, AgradCdfBeta_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_49, AgradCdfTestFixture, AgradCdfBeta_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_50, AgradCdfTestFixture, AgradCdfBeta_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_51, AgradCdfTestFixture, AgradCdfBeta_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_52, AgradCdfTestFixture, AgradCdfBeta_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_53, AgradCdfTestFixture, AgradCdfBeta_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_54, AgradCdfTestFixture, AgradCdfBeta_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_55, AgradCdfTestFixture, AgradCdfBeta_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_56, AgradCdfTestFixture, AgradCdfBeta_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_57, AgradCdfTestFixture, AgradCdfBeta_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_58, AgradCdfTestFixture, AgradCdfBeta_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_59, AgradCdfTestFixture, AgradCdfBeta_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_60, AgradCdfTestFixture, AgradCdfBeta_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_61, AgradCdfTestFixture, AgradCdfBeta_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_62, AgradCdfTestFixture, AgradCdfBeta_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_63, AgradCdfTestFixture, AgradCdfBeta_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_64, AgradCdfTestFixture, AgradCdfBeta_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_65, AgradCdfTestFixture, AgradCdfBeta_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_66, AgradCdfTestFixture, AgradCdfBeta_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_67, AgradCdfTestFixture, AgradCdfBeta_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_68, AgradCdfTestFixture, AgradCdfBeta_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_69, AgradCdfTestFixture, AgradCdfBeta_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_70, AgradCdfTestFixture, AgradCdfBeta_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_71, AgradCdfTestFixture, AgradCdfBeta_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_72, AgradCdfTestFixture, AgradCdfBeta_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_73, AgradCdfTestFixture, AgradCdfBeta_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_74, AgradCdfTestFixture, AgradCdfBeta_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_75, AgradCdfTestFixture, AgradCdfBeta_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_76, AgradCdfTestFixture, AgradCdfBeta_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_77, AgradCdfTestFixture, AgradCdfBeta_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_78, AgradCdfTestFixture, AgradCdfBeta_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_79, AgradCdfTestFixture, AgradCdfBeta_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_80, AgradCdfTestFixture, AgradCdfBeta_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_81, AgradCdfTestFixture, AgradCdfBeta_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_82, AgradCdfTestFixture, AgradCdfBeta_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_83, AgradCdfTestFixture, AgradCdfBeta_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_84, AgradCdfTestFixture, AgradCdfBeta_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_85, AgradCdfTestFixture, AgradCdfBeta_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_86, AgradCdfTestFixture, AgradCdfBeta_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_87, AgradCdfTestFixture, AgradCdfBeta_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_88, AgradCdfTestFixture, AgradCdfBeta_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_89, AgradCdfTestFixture, AgradCdfBeta_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_90, AgradCdfTestFixture, AgradCdfBeta_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_91, AgradCdfTestFixture, AgradCdfBeta_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_92, AgradCdfTestFixture, AgradCdfBeta_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_93, AgradCdfTestFixture, AgradCdfBeta_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_94, AgradCdfTestFixture, AgradCdfBeta_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_95, AgradCdfTestFixture, AgradCdfBeta_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_96, AgradCdfTestFixture, AgradCdfBeta_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_97, AgradCdfTestFixture, AgradCdfBeta_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_98, AgradCdfTestFixture, AgradCdfBeta_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_99, AgradCdfTestFixture, AgradCdfBeta_vv_99);
+
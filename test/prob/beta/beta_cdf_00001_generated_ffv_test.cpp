@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfBeta, type_ffv_100> AgradCdfBeta_ffv_100;
+typedef std::tuple<AgradCdfBeta, type_ffv_101> AgradCdfBeta_ffv_101;
+typedef std::tuple<AgradCdfBeta, type_ffv_102> AgradCdfBeta_ffv_102;
+typedef std::tuple<AgradCdfBeta, type_ffv_103> AgradCdfBeta_ffv_103;
+typedef std::tuple<AgradCdfBeta, type_ffv_104> AgradCdfBeta_ffv_104;
+typedef std::tuple<AgradCdfBeta, type_ffv_105> AgradCdfBeta_ffv_105;
+typedef std::tuple<AgradCdfBeta, type_ffv_106> AgradCdfBeta_ffv_106;
+typedef std::tuple<AgradCdfBeta, type_ffv_107> AgradCdfBeta_ffv_107;
+typedef std::tuple<AgradCdfBeta, type_ffv_108> AgradCdfBeta_ffv_108;
+typedef std::tuple<AgradCdfBeta, type_ffv_109> AgradCdfBeta_ffv_109;
+typedef std::tuple<AgradCdfBeta, type_ffv_110> AgradCdfBeta_ffv_110;
+typedef std::tuple<AgradCdfBeta, type_ffv_111> AgradCdfBeta_ffv_111;
+typedef std::tuple<AgradCdfBeta, type_ffv_112> AgradCdfBeta_ffv_112;
+typedef std::tuple<AgradCdfBeta, type_ffv_113> AgradCdfBeta_ffv_113;
+typedef std::tuple<AgradCdfBeta, type_ffv_114> AgradCdfBeta_ffv_114;
+typedef std::tuple<AgradCdfBeta, type_ffv_115> AgradCdfBeta_ffv_115;
+typedef std::tuple<AgradCdfBeta, type_ffv_116> AgradCdfBeta_ffv_116;
+typedef std::tuple<AgradCdfBeta, type_ffv_117> AgradCdfBeta_ffv_117;
+typedef std::tuple<AgradCdfBeta, type_ffv_118> AgradCdfBeta_ffv_118;
+typedef std::tuple<AgradCdfBeta, type_ffv_119> AgradCdfBeta_ffv_119;
+typedef std::tuple<AgradCdfBeta, type_ffv_120> AgradCdfBeta_ffv_120;
+typedef std::tuple<AgradCdfBeta, type_ffv_121> AgradCdfBeta_ffv_121;
+typedef std::tuple<AgradCdfBeta, type_ffv_122> AgradCdfBeta_ffv_122;
+typedef std::tuple<AgradCdfBeta, type_ffv_123> AgradCdfBeta_ffv_123;
+typedef std::tuple<AgradCdfBeta, type_ffv_124> AgradCdfBeta_ffv_124;
+typedef std::tuple<AgradCdfBeta, type_ffv_125> AgradCdfBeta_ffv_125;
+typedef std::tuple<AgradCdfBeta, type_ffv_126> AgradCdfBeta_ffv_126;
+typedef std::tuple<AgradCdfBeta, type_ffv_127> AgradCdfBeta_ffv_127;
+typedef std::tuple<AgradCdfBeta, type_ffv_128> AgradCdfBeta_ffv_128;
+typedef std::tuple<AgradCdfBeta, type_ffv_129> AgradCdfBeta_ffv_129;
+typedef std::tuple<AgradCdfBeta, type_ffv_130> AgradCdfBeta_ffv_130;
+typedef std::tuple<AgradCdfBeta, type_ffv_131> AgradCdfBeta_ffv_131;
+typedef std::tuple<AgradCdfBeta, type_ffv_132> AgradCdfBeta_ffv_132;
+typedef std::tuple<AgradCdfBeta, type_ffv_133> AgradCdfBeta_ffv_133;
+typedef std::tuple<AgradCdfBeta, type_ffv_134> AgradCdfBeta_ffv_134;
+typedef std::tuple<AgradCdfBeta, type_ffv_135> AgradCdfBeta_ffv_135;
+typedef std::tuple<AgradCdfBeta, type_ffv_136> AgradCdfBeta_ffv_136;
+typedef std::tuple<AgradCdfBeta, type_ffv_137> AgradCdfBeta_ffv_137;
+typedef std::tuple<AgradCdfBeta, type_ffv_138> AgradCdfBeta_ffv_138;
+typedef std::tuple<AgradCdfBeta, type_ffv_139> AgradCdfBeta_ffv_139;
+typedef std::tuple<AgradCdfBeta, type_ffv_140> AgradCdfBeta_ffv_140;
+typedef std::tuple<AgradCdfBeta, type_ffv_141> AgradCdfBeta_ffv_141;
+typedef std::tuple<AgradCdfBeta, type_ffv_142> AgradCdfBeta_ffv_142;
+typedef std::tuple<AgradCdfBeta, type_ffv_143> AgradCdfBeta_ffv_143;
+typedef std::tuple<AgradCdfBeta, type_ffv_144> AgradCdfBeta_ffv_144;
+typedef std::tuple<AgradCdfBeta, type_ffv_145> AgradCdfBeta_ffv_145;
+typedef std::tuple<AgradCdfBeta, type_ffv_146> AgradCdfBeta_ffv_146;
+typedef std::tuple<AgradCdfBeta, type_ffv_147> AgradCdfBeta_ffv_147;
+typedef std::tuple<AgradCdfBeta, type_ffv_148> AgradCdfBeta_ffv_148;
+typedef std::tuple<AgradCdfBeta, type_ffv_149> AgradCdfBeta_ffv_149;
+typedef std::tuple<AgradCdfBeta, type_ffv_150> AgradCdfBeta_ffv_150;
+typedef std::tuple<AgradCdfBeta, type_ffv_151> AgradCdfBeta_ffv_151;
+typedef std::tuple<AgradCdfBeta, type_ffv_152> AgradCdfBeta_ffv_152;
+typedef std::tuple<AgradCdfBeta, type_ffv_153> AgradCdfBeta_ffv_153;
+typedef std::tuple<AgradCdfBeta, type_ffv_154> AgradCdfBeta_ffv_154;
+typedef std::tuple<AgradCdfBeta, type_ffv_155> AgradCdfBeta_ffv_155;
+typedef std::tuple<AgradCdfBeta, type_ffv_156> AgradCdfBeta_ffv_156;
+typedef std::tuple<AgradCdfBeta, type_ffv_157> AgradCdfBeta_ffv_157;
+typedef std::tuple<AgradCdfBeta, type_ffv_158> AgradCdfBeta_ffv_158;
+typedef std::tuple<AgradCdfBeta, type_ffv_159> AgradCdfBeta_ffv_159;
+typedef std::tuple<AgradCdfBeta, type_ffv_160> AgradCdfBeta_ffv_160;
+typedef std::tuple<AgradCdfBeta, type_ffv_161> AgradCdfBeta_ffv_161;
+typedef std::tuple<AgradCdfBeta, type_ffv_162> AgradCdfBeta_ffv_162;
+typedef std::tuple<AgradCdfBeta, type_ffv_163> AgradCdfBeta_ffv_163;
+typedef std::tuple<AgradCdfBeta, type_ffv_164> AgradCdfBeta_ffv_164;
+typedef std::tuple<AgradCdfBeta, type_ffv_165> AgradCdfBeta_ffv_165;
+typedef std::tuple<AgradCdfBeta, type_ffv_166> AgradCdfBeta_ffv_166;
+typedef std::tuple<AgradCdfBeta, type_ffv_167> AgradCdfBeta_ffv_167;
+typedef std::tuple<AgradCdfBeta, type_ffv_168> AgradCdfBeta_ffv_168;
+typedef std::tuple<AgradCdfBeta, type_ffv_169> AgradCdfBeta_ffv_169;
+typedef std::tuple<AgradCdfBeta, type_ffv_170> AgradCdfBeta_ffv_170;
+typedef std::tuple<AgradCdfBeta, type_ffv_171> AgradCdfBeta_ffv_171;
+typedef std::tuple<AgradCdfBeta, type_ffv_172> AgradCdfBeta_ffv_172;
+typedef std::tuple<AgradCdfBeta, type_ffv_173> AgradCdfBeta_ffv_173;
+typedef std::tuple<AgradCdfBeta, type_ffv_174> AgradCdfBeta_ffv_174;
+typedef std::tuple<AgradCdfBeta, type_ffv_175> AgradCdfBeta_ffv_175;
+typedef std::tuple<AgradCdfBeta, type_ffv_176> AgradCdfBeta_ffv_176;
+typedef std::tuple<AgradCdfBeta, type_ffv_177> AgradCdfBeta_ffv_177;
+typedef std::tuple<AgradCdfBeta, type_ffv_178> AgradCdfBeta_ffv_178;
+typedef std::tuple<AgradCdfBeta, type_ffv_179> AgradCdfBeta_ffv_179;
+typedef std::tuple<AgradCdfBeta, type_ffv_180> AgradCdfBeta_ffv_180;
+typedef std::tuple<AgradCdfBeta, type_ffv_181> AgradCdfBeta_ffv_181;
+typedef std::tuple<AgradCdfBeta, type_ffv_182> AgradCdfBeta_ffv_182;
+typedef std::tuple<AgradCdfBeta, type_ffv_183> AgradCdfBeta_ffv_183;
+typedef std::tuple<AgradCdfBeta, type_ffv_184> AgradCdfBeta_ffv_184;
+typedef std::tuple<AgradCdfBeta, type_ffv_185> AgradCdfBeta_ffv_185;
+typedef std::tuple<AgradCdfBeta, type_ffv_186> AgradCdfBeta_ffv_186;
+typedef std::tuple<AgradCdfBeta, type_ffv_187> AgradCdfBeta_ffv_187;
+typedef std::tuple<AgradCdfBeta, type_ffv_188> AgradCdfBeta_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_100, AgradCdfTestFixture, AgradCdfBeta_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_101, AgradCdfTestFixture, AgradCdfBeta_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_102, AgradCdfTestFixture, AgradCdfBeta_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_103, AgradCdfTestFixture, AgradCdfBeta_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_104, AgradCdfTestFixture, AgradCdfBeta_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_105, AgradCdfTestFixture, AgradCdfBeta_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_106, AgradCdfTestFixture, AgradCdfBeta_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_107, AgradCdfTestFixture, AgradCdfBeta_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_108, AgradCdfTestFixture, AgradCdfBeta_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_109, AgradCdfTestFixture, AgradCdfBeta_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_110, AgradCdfTestFixture, AgradCdfBeta_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_111, AgradCdfTestFixture, AgradCdfBeta_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_112, AgradCdfTestFixture, AgradCdfBeta_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_113, AgradCdfTestFixture, AgradCdfBeta_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_114, AgradCdfTestFixture, AgradCdfBeta_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_115, AgradCdfTestFixture, AgradCdfBeta_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_116, AgradCdfTestFixture, AgradCdfBeta_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_117, AgradCdfTestFixture, AgradCdfBeta_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_118, AgradCdfTestFixture, AgradCdfBeta_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_119, AgradCdfTestFixture, AgradCdfBeta_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_120, AgradCdfTestFixture, AgradCdfBeta_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_121, AgradCdfTestFixture, AgradCdfBeta_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_122, AgradCdfTestFixture, AgradCdfBeta_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_123, AgradCdfTestFixture, AgradCdfBeta_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_124, AgradCdfTestFixture, AgradCdfBeta_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_125, AgradCdfTestFixture, AgradCdfBeta_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_126, AgradCdfTestFixture, AgradCdfBeta_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_127, AgradCdfTestFixture, AgradCdfBeta_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_128, AgradCdfTestFixture, AgradCdfBeta_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_129, AgradCdfTestFixture, AgradCdfBeta_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_130, AgradCdfTestFixture, AgradCdfBeta_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_131, AgradCdfTestFixture, AgradCdfBeta_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_132, AgradCdfTestFixture, AgradCdfBeta_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_133, AgradCdfTestFixture, AgradCdfBeta_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_134, AgradCdfTestFixture, AgradCdfBeta_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_135, AgradCdfTestFixture, AgradCdfBeta_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_136, AgradCdfTestFixture, AgradCdfBeta_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_137, AgradCdfTestFixture, AgradCdfBeta_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_138, AgradCdfTestFixture, AgradCdfBeta_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_139, AgradCdfTestFixture, AgradCdfBeta_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_140, AgradCdfTestFixture, AgradCdfBeta_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_141, AgradCdfTestFixture, AgradCdfBeta_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_142, AgradCdfTestFixture, AgradCdfBeta_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_143, AgradCdfTestFixture, AgradCdfBeta_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_144, AgradCdfTestFixture, AgradCdfBeta_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_145, AgradCdfTestFixture, AgradCdfBeta_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_146, AgradCdfTestFixture, AgradCdfBeta_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_147, AgradCdfTestFixture, AgradCdfBeta_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_148, AgradCdfTestFixture, AgradCdfBeta_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_149, AgradCdfTestFixture, AgradCdfBeta_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_150, AgradCdfTestFixture, AgradCdfBeta_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_151, AgradCdfTestFixture, AgradCdfBeta_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_152, AgradCdfTestFixture, AgradCdfBeta_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_153, AgradCdfTestFixture, AgradCdfBeta_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_154, AgradCdfTestFixture, AgradCdfBeta_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_155, AgradCdfTestFixture, AgradCdfBeta_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_156, AgradCdfTestFixture, AgradCdfBeta_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_157, AgradCdfTestFixture, AgradCdfBeta_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_158, AgradCdfTestFixture, AgradCdfBeta_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_159, AgradCdfTestFixture, AgradCdfBeta_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_160, AgradCdfTestFixture, AgradCdfBeta_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_161, AgradCdfTestFixture, AgradCdfBeta_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_162, AgradCdfTestFixture, AgradCdfBeta_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_163, AgradCdfTestFixture, AgradCdfBeta_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_164, AgradCdfTestFixture, AgradCdfBeta_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_165, AgradCdfTestFixture, AgradCdfBeta_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_166, AgradCdfTestFixture, AgradCdfBeta_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_167, AgradCdfTestFixture, AgradCdfBeta_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_168, AgradCdfTestFixture, AgradCdfBeta_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_169, AgradCdfTestFixture, AgradCdfBeta_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_170, AgradCdfTestFixture, AgradCdfBeta_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_171, AgradCdfTestFixture, AgradCdfBeta_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_172, AgradCdfTestFixture, AgradCdfBeta_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_173, AgradCdfTestFixture, AgradCdfBeta_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_174, AgradCdfTestFixture, AgradCdfBeta_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_175, AgradCdfTestFixture, AgradCdfBeta_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_176, AgradCdfTestFixture, AgradCdfBeta_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_177, AgradCdfTestFixture, AgradCdfBeta_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_178, AgradCdfTestFixture, AgradCdfBeta_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_179, AgradCdfTestFixture, AgradCdfBeta_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_180, AgradCdfTestFixture, AgradCdfBeta_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_181, AgradCdfTestFixture, AgradCdfBeta_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_182, AgradCdfTestFixture, AgradCdfBeta_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_183, AgradCdfTestFixture, AgradCdfBeta_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_184, AgradCdfTestFixture, AgradCdfBeta_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_185, AgradCdfTestFixture, AgradCdfBeta_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_186, AgradCdfTestFixture, AgradCdfBeta_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_187, AgradCdfTestFixture, AgradCdfBeta_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_ffv_188, AgradCdfTestFixture, AgradCdfBeta_ffv_188);
+
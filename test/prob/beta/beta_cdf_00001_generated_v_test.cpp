@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfBeta, type_v_100> AgradCdfBeta_v_100;
+typedef std::tuple<AgradCdfBeta, type_v_101> AgradCdfBeta_v_101;
+typedef std::tuple<AgradCdfBeta, type_v_102> AgradCdfBeta_v_102;
+typedef std::tuple<AgradCdfBeta, type_v_103> AgradCdfBeta_v_103;
+typedef std::tuple<AgradCdfBeta, type_v_104> AgradCdfBeta_v_104;
+typedef std::tuple<AgradCdfBeta, type_v_105> AgradCdfBeta_v_105;
+typedef std::tuple<AgradCdfBeta, type_v_106> AgradCdfBeta_v_106;
+typedef std::tuple<AgradCdfBeta, type_v_107> AgradCdfBeta_v_107;
+typedef std::tuple<AgradCdfBeta, type_v_108> AgradCdfBeta_v_108;
+typedef std::tuple<AgradCdfBeta, type_v_109> AgradCdfBeta_v_109;
+typedef std::tuple<AgradCdfBeta, type_v_110> AgradCdfBeta_v_110;
+typedef std::tuple<AgradCdfBeta, type_v_111> AgradCdfBeta_v_111;
+typedef std::tuple<AgradCdfBeta, type_v_112> AgradCdfBeta_v_112;
+typedef std::tuple<AgradCdfBeta, type_v_113> AgradCdfBeta_v_113;
+typedef std::tuple<AgradCdfBeta, type_v_114> AgradCdfBeta_v_114;
+typedef std::tuple<AgradCdfBeta, type_v_115> AgradCdfBeta_v_115;
+typedef std::tuple<AgradCdfBeta, type_v_116> AgradCdfBeta_v_116;
+typedef std::tuple<AgradCdfBeta, type_v_117> AgradCdfBeta_v_117;
+typedef std::tuple<AgradCdfBeta, type_v_118> AgradCdfBeta_v_118;
+typedef std::tuple<AgradCdfBeta, type_v_119> AgradCdfBeta_v_119;
+typedef std::tuple<AgradCdfBeta, type_v_120> AgradCdfBeta_v_120;
+typedef std::tuple<AgradCdfBeta, type_v_121> AgradCdfBeta_v_121;
+typedef std::tuple<AgradCdfBeta, type_v_122> AgradCdfBeta_v_122;
+typedef std::tuple<AgradCdfBeta, type_v_123> AgradCdfBeta_v_123;
+typedef std::tuple<AgradCdfBeta, type_v_124> AgradCdfBeta_v_124;
+typedef std::tuple<AgradCdfBeta, type_v_125> AgradCdfBeta_v_125;
+typedef std::tuple<AgradCdfBeta, type_v_126> AgradCdfBeta_v_126;
+typedef std::tuple<AgradCdfBeta, type_v_127> AgradCdfBeta_v_127;
+typedef std::tuple<AgradCdfBeta, type_v_128> AgradCdfBeta_v_128;
+typedef std::tuple<AgradCdfBeta, type_v_129> AgradCdfBeta_v_129;
+typedef std::tuple<AgradCdfBeta, type_v_130> AgradCdfBeta_v_130;
+typedef std::tuple<AgradCdfBeta, type_v_131> AgradCdfBeta_v_131;
+typedef std::tuple<AgradCdfBeta, type_v_132> AgradCdfBeta_v_132;
+typedef std::tuple<AgradCdfBeta, type_v_133> AgradCdfBeta_v_133;
+typedef std::tuple<AgradCdfBeta, type_v_134> AgradCdfBeta_v_134;
+typedef std::tuple<AgradCdfBeta, type_v_135> AgradCdfBeta_v_135;
+typedef std::tuple<AgradCdfBeta, type_v_136> AgradCdfBeta_v_136;
+typedef std::tuple<AgradCdfBeta, type_v_137> AgradCdfBeta_v_137;
+typedef std::tuple<AgradCdfBeta, type_v_138> AgradCdfBeta_v_138;
+typedef std::tuple<AgradCdfBeta, type_v_139> AgradCdfBeta_v_139;
+typedef std::tuple<AgradCdfBeta, type_v_140> AgradCdfBeta_v_140;
+typedef std::tuple<AgradCdfBeta, type_v_141> AgradCdfBeta_v_141;
+typedef std::tuple<AgradCdfBeta, type_v_142> AgradCdfBeta_v_142;
+typedef std::tuple<AgradCdfBeta, type_v_143> AgradCdfBeta_v_143;
+typedef std::tuple<AgradCdfBeta, type_v_144> AgradCdfBeta_v_144;
+typedef std::tuple<AgradCdfBeta, type_v_145> AgradCdfBeta_v_145;
+typedef std::tuple<AgradCdfBeta, type_v_146> AgradCdfBeta_v_146;
+typedef std::tuple<AgradCdfBeta, type_v_147> AgradCdfBeta_v_147;
+typedef std::tuple<AgradCdfBeta, type_v_148> AgradCdfBeta_v_148;
+typedef std::tuple<AgradCdfBeta, type_v_149> AgradCdfBeta_v_149;
+typedef std::tuple<AgradCdfBeta, type_v_150> AgradCdfBeta_v_150;
+typedef std::tuple<AgradCdfBeta, type_v_151> AgradCdfBeta_v_151;
+typedef std::tuple<AgradCdfBeta, type_v_152> AgradCdfBeta_v_152;
+typedef std::tuple<AgradCdfBeta, type_v_153> AgradCdfBeta_v_153;
+typedef std::tuple<AgradCdfBeta, type_v_154> AgradCdfBeta_v_154;
+typedef std::tuple<AgradCdfBeta, type_v_155> AgradCdfBeta_v_155;
+typedef std::tuple<AgradCdfBeta, type_v_156> AgradCdfBeta_v_156;
+typedef std::tuple<AgradCdfBeta, type_v_157> AgradCdfBeta_v_157;
+typedef std::tuple<AgradCdfBeta, type_v_158> AgradCdfBeta_v_158;
+typedef std::tuple<AgradCdfBeta, type_v_159> AgradCdfBeta_v_159;
+typedef std::tuple<AgradCdfBeta, type_v_160> AgradCdfBeta_v_160;
+typedef std::tuple<AgradCdfBeta, type_v_161> AgradCdfBeta_v_161;
+typedef std::tuple<AgradCdfBeta, type_v_162> AgradCdfBeta_v_162;
+typedef std::tuple<AgradCdfBeta, type_v_163> AgradCdfBeta_v_163;
+typedef std::tuple<AgradCdfBeta, type_v_164> AgradCdfBeta_v_164;
+typedef std::tuple<AgradCdfBeta, type_v_165> AgradCdfBeta_v_165;
+typedef std::tuple<AgradCdfBeta, type_v_166> AgradCdfBeta_v_166;
+typedef std::tuple<AgradCdfBeta, type_v_167> AgradCdfBeta_v_167;
+typedef std::tuple<AgradCdfBeta, type_v_168> AgradCdfBeta_v_168;
+typedef std::tuple<AgradCdfBeta, type_v_169> AgradCdfBeta_v_169;
+typedef std::tuple<AgradCdfBeta, type_v_170> AgradCdfBeta_v_170;
+typedef std::tuple<AgradCdfBeta, type_v_171> AgradCdfBeta_v_171;
+typedef std::tuple<AgradCdfBeta, type_v_172> AgradCdfBeta_v_172;
+typedef std::tuple<AgradCdfBeta, type_v_173> AgradCdfBeta_v_173;
+typedef std::tuple<AgradCdfBeta, type_v_174> AgradCdfBeta_v_174;
+typedef std::tuple<AgradCdfBeta, type_v_175> AgradCdfBeta_v_175;
+typedef std::tuple<AgradCdfBeta, type_v_176> AgradCdfBeta_v_176;
+typedef std::tuple<AgradCdfBeta, type_v_177> AgradCdfBeta_v_177;
+typedef std::tuple<AgradCdfBeta, type_v_178> AgradCdfBeta_v_178;
+typedef std::tuple<AgradCdfBeta, type_v_179> AgradCdfBeta_v_179;
+typedef std::tuple<AgradCdfBeta, type_v_180> AgradCdfBeta_v_180;
+typedef std::tuple<AgradCdfBeta, type_v_181> AgradCdfBeta_v_181;
+typedef std::tuple<AgradCdfBeta, type_v_182> AgradCdfBeta_v_182;
+typedef std::tuple<AgradCdfBeta, type_v_183> AgradCdfBeta_v_183;
+typedef std::tuple<AgradCdfBeta, type_v_184> AgradCdfBeta_v_184;
+typedef std::tuple<AgradCdfBeta, type_v_185> AgradCdfBeta_v_185;
+typedef std::tuple<AgradCdfBeta, type_v_186> AgradCdfBeta_v_186;
+typedef std::tuple<AgradCdfBeta, type_v_187> AgradCdfBeta_v_187;
+typedef std::tuple<AgradCdfBeta, type_v_188> AgradCdfBeta_v_188;
+typedef std::tuple<AgradCdfBeta, type_v_189> AgradCdfBeta_v_189;
+typedef std::tuple<AgradCdfBeta, type_v_190> AgradCdfBeta_v_190;
+typedef std::tuple<AgradCdfBeta, type_v_191> AgradCdfBeta_v_191;
+typedef std::tuple<AgradCdfBeta, type_v_192> AgradCdfBeta_v_192;
+typedef std::tuple<AgradCdfBeta, type_v_193> AgradCdfBeta_v_193;
+typedef std::tuple<AgradCdfBeta, type_v_194> AgradCdfBeta_v_194;
+typedef std::tuple<AgradCdfBeta, type_v_195> AgradCdfBeta_v_195;
+typedef std::tuple<AgradCdfBeta, type_v_196> AgradCdfBeta_v_196;
+typedef std::tuple<AgradCdfBeta, type_v_197> AgradCdfBeta_v_197;
+typedef std::tuple<AgradCdfBeta, type_v_198> AgradCdfBeta_v_198;
+typedef std::tuple<AgradCdfBeta, type_v_199> AgradCdfBeta_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_100, AgradCdfTestFixture, AgradCdfBeta_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_101, AgradCdfTestFixture, AgradCdfBeta_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_102, AgradCdfTestFixture, AgradCdfBeta_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_103, AgradCdfTestFixture, AgradCdfBeta_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_104, AgradCdfTestFixture, AgradCdfBeta_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_105, AgradCdfTestFixture, AgradCdfBeta_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_106, AgradCdfTestFixture, AgradCdfBeta_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_107, AgradCdfTestFixture, AgradCdfBeta_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_108, AgradCdfTestFixture, AgradCdfBeta_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_109, AgradCdfTestFixture, AgradCdfBeta_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_110, AgradCdfTestFixture, AgradCdfBeta_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_111, AgradCdfTestFixture, AgradCdfBeta_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_112, AgradCdfTestFixture, AgradCdfBeta_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_113, AgradCdfTestFixture, AgradCdfBeta_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_114, AgradCdfTestFixture, AgradCdfBeta_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_115, AgradCdfTestFixture, AgradCdfBeta_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_116, AgradCdfTestFixture, AgradCdfBeta_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_117, AgradCdfTestFixture, AgradCdfBeta_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_118, AgradCdfTestFixture, AgradCdfBeta_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_119, AgradCdfTestFixture, AgradCdfBeta_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_120, AgradCdfTestFixture, AgradCdfBeta_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_121, AgradCdfTestFixture, AgradCdfBeta_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_122, AgradCdfTestFixture, AgradCdfBeta_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_123, AgradCdfTestFixture, AgradCdfBeta_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_124, AgradCdfTestFixture, AgradCdfBeta_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_125, AgradCdfTestFixture, AgradCdfBeta_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_126, AgradCdfTestFixture, AgradCdfBeta_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_127, AgradCdfTestFixture, AgradCdfBeta_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_128, AgradCdfTestFixture, AgradCdfBeta_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_129, AgradCdfTestFixture, AgradCdfBeta_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_130, AgradCdfTestFixture, AgradCdfBeta_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_131, AgradCdfTestFixture, AgradCdfBeta_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_132, AgradCdfTestFixture, AgradCdfBeta_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_133, AgradCdfTestFixture, AgradCdfBeta_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_134, AgradCdfTestFixture, AgradCdfBeta_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_135, AgradCdfTestFixture, AgradCdfBeta_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_136, AgradCdfTestFixture, AgradCdfBeta_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_137, AgradCdfTestFixture, AgradCdfBeta_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_138, AgradCdfTestFixture, AgradCdfBeta_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_139, AgradCdfTestFixture, AgradCdfBeta_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_140, AgradCdfTestFixture, AgradCdfBeta_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_141, AgradCdfTestFixture, AgradCdfBeta_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_142, AgradCdfTestFixture, AgradCdfBeta_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_143, AgradCdfTestFixture, AgradCdfBeta_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_144, AgradCdfTestFixture, AgradCdfBeta_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_145, AgradCdfTestFixture, AgradCdfBeta_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_146, AgradCdfTestFixture, AgradCdfBeta_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_147, AgradCdfTestFixture, AgradCdfBeta_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_148, AgradCdfTestFixture, AgradCdfBeta_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_149, AgradCdfTestFixture, AgradCdfBeta_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_150, AgradCdfTestFixture, AgradCdfBeta_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_151, AgradCdfTestFixture, AgradCdfBeta_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_152, AgradCdfTestFixture, AgradCdfBeta_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_153, AgradCdfTestFixture, AgradCdfBeta_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_154, AgradCdfTestFixture, AgradCdfBeta_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_155, AgradCdfTestFixture, AgradCdfBeta_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_156, AgradCdfTestFixture, AgradCdfBeta_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_157, AgradCdfTestFixture, AgradCdfBeta_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_158, AgradCdfTestFixture, AgradCdfBeta_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_159, AgradCdfTestFixture, AgradCdfBeta_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_160, AgradCdfTestFixture, AgradCdfBeta_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_161, AgradCdfTestFixture, AgradCdfBeta_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_162, AgradCdfTestFixture, AgradCdfBeta_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_163, AgradCdfTestFixture, AgradCdfBeta_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_164, AgradCdfTestFixture, AgradCdfBeta_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_165, AgradCdfTestFixture, AgradCdfBeta_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_166, AgradCdfTestFixture, AgradCdfBeta_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_167, AgradCdfTestFixture, AgradCdfBeta_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_168, AgradCdfTestFixture, AgradCdfBeta_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_169, AgradCdfTestFixture, AgradCdfBeta_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_170, AgradCdfTestFixture, AgradCdfBeta_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_171, AgradCdfTestFixture, AgradCdfBeta_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_172, AgradCdfTestFixture, AgradCdfBeta_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_173, AgradCdfTestFixture, AgradCdfBeta_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_174, AgradCdfTestFixture, AgradCdfBeta_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_175, AgradCdfTestFixture, AgradCdfBeta_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_176, AgradCdfTestFixture, AgradCdfBeta_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_177, AgradCdfTestFixture, AgradCdfBeta_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_178, AgradCdfTestFixture, AgradCdfBeta_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_179, AgradCdfTestFixture, AgradCdfBeta_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_180, AgradCdfTestFixture, AgradCdfBeta_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_181, AgradCdfTestFixture, AgradCdfBeta_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_182, AgradCdfTestFixture, AgradCdfBeta_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_183, AgradCdfTestFixture, AgradCdfBeta_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_184, AgradCdfTestFixture, AgradCdfBeta_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_185, AgradCdfTestFixture, AgradCdfBeta_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_186, AgradCdfTestFixture, AgradCdfBeta_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_187, AgradCdfTestFixture, AgradCdfBeta_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_188, AgradCdfTestFixture, AgradCdfBeta_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_189, AgradCdfTestFixture, AgradCdfBeta_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_190, AgradCdfTestFixture, AgradCdfBeta_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_191, AgradCdfTestFixture, AgradCdfBeta_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_192, AgradCdfTestFixture, AgradCdfBeta_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_193, AgradCdfTestFixture, AgradCdfBeta_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_194, AgradCdfTestFixture, AgradCdfBeta_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_195, AgradCdfTestFixture, AgradCdfBeta_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_196, AgradCdfTestFixture, AgradCdfBeta_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_197, AgradCdfTestFixture, AgradCdfBeta_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_198, AgradCdfTestFixture, AgradCdfBeta_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_v_199, AgradCdfTestFixture, AgradCdfBeta_v_199);
+
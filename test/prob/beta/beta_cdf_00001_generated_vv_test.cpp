@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfBeta, type_vv_100> AgradCdfBeta_vv_100;
+typedef std::tuple<AgradCdfBeta, type_vv_101> AgradCdfBeta_vv_101;
+typedef std::tuple<AgradCdfBeta, type_vv_102> AgradCdfBeta_vv_102;
+typedef std::tuple<AgradCdfBeta, type_vv_103> AgradCdfBeta_vv_103;
+typedef std::tuple<AgradCdfBeta, type_vv_104> AgradCdfBeta_vv_104;
+typedef std::tuple<AgradCdfBeta, type_vv_105> AgradCdfBeta_vv_105;
+typedef std::tuple<AgradCdfBeta, type_vv_106> AgradCdfBeta_vv_106;
+typedef std::tuple<AgradCdfBeta, type_vv_107> AgradCdfBeta_vv_107;
+typedef std::tuple<AgradCdfBeta, type_vv_108> AgradCdfBeta_vv_108;
+typedef std::tuple<AgradCdfBeta, type_vv_109> AgradCdfBeta_vv_109;
+typedef std::tuple<AgradCdfBeta, type_vv_110> AgradCdfBeta_vv_110;
+typedef std::tuple<AgradCdfBeta, type_vv_111> AgradCdfBeta_vv_111;
+typedef std::tuple<AgradCdfBeta, type_vv_112> AgradCdfBeta_vv_112;
+typedef std::tuple<AgradCdfBeta, type_vv_113> AgradCdfBeta_vv_113;
+typedef std::tuple<AgradCdfBeta, type_vv_114> AgradCdfBeta_vv_114;
+typedef std::tuple<AgradCdfBeta, type_vv_115> AgradCdfBeta_vv_115;
+typedef std::tuple<AgradCdfBeta, type_vv_116> AgradCdfBeta_vv_116;
+typedef std::tuple<AgradCdfBeta, type_vv_117> AgradCdfBeta_vv_117;
+typedef std::tuple<AgradCdfBeta, type_vv_118> AgradCdfBeta_vv_118;
+typedef std::tuple<AgradCdfBeta, type_vv_119> AgradCdfBeta_vv_119;
+typedef std::tuple<AgradCdfBeta, type_vv_120> AgradCdfBeta_vv_120;
+typedef std::tuple<AgradCdfBeta, type_vv_121> AgradCdfBeta_vv_121;
+typedef std::tuple<AgradCdfBeta, type_vv_122> AgradCdfBeta_vv_122;
+typedef std::tuple<AgradCdfBeta, type_vv_123> AgradCdfBeta_vv_123;
+typedef std::tuple<AgradCdfBeta, type_vv_124> AgradCdfBeta_vv_124;
+typedef std::tuple<AgradCdfBeta, type_vv_125> AgradCdfBeta_vv_125;
+typedef std::tuple<AgradCdfBeta, type_vv_126> AgradCdfBeta_vv_126;
+typedef std::tuple<AgradCdfBeta, type_vv_127> AgradCdfBeta_vv_127;
+typedef std::tuple<AgradCdfBeta, type_vv_128> AgradCdfBeta_vv_128;
+typedef std::tuple<AgradCdfBeta, type_vv_129> AgradCdfBeta_vv_129;
+typedef std::tuple<AgradCdfBeta, type_vv_130> AgradCdfBeta_vv_130;
+typedef std::tuple<AgradCdfBeta, type_vv_131> AgradCdfBeta_vv_131;
+typedef std::tuple<AgradCdfBeta, type_vv_132> AgradCdfBeta_vv_132;
+typedef std::tuple<AgradCdfBeta, type_vv_133> AgradCdfBeta_vv_133;
+typedef std::tuple<AgradCdfBeta, type_vv_134> AgradCdfBeta_vv_134;
+typedef std::tuple<AgradCdfBeta, type_vv_135> AgradCdfBeta_vv_135;
+typedef std::tuple<AgradCdfBeta, type_vv_136> AgradCdfBeta_vv_136;
+typedef std::tuple<AgradCdfBeta, type_vv_137> AgradCdfBeta_vv_137;
+typedef std::tuple<AgradCdfBeta, type_vv_138> AgradCdfBeta_vv_138;
+typedef std::tuple<AgradCdfBeta, type_vv_139> AgradCdfBeta_vv_139;
+typedef std::tuple<AgradCdfBeta, type_vv_140> AgradCdfBeta_vv_140;
+typedef std::tuple<AgradCdfBeta, type_vv_141> AgradCdfBeta_vv_141;
+typedef std::tuple<AgradCdfBeta, type_vv_142> AgradCdfBeta_vv_142;
+typedef std::tuple<AgradCdfBeta, type_vv_143> AgradCdfBeta_vv_143;
+typedef std::tuple<AgradCdfBeta, type_vv_144> AgradCdfBeta_vv_144;
+typedef std::tuple<AgradCdfBeta, type_vv_145> AgradCdfBeta_vv_145;
+typedef std::tuple<AgradCdfBeta, type_vv_146> AgradCdfBeta_vv_146;
+typedef std::tuple<AgradCdfBeta, type_vv_147> AgradCdfBeta_vv_147;
+typedef std::tuple<AgradCdfBeta, type_vv_148> AgradCdfBeta_vv_148;
+typedef std::tuple<AgradCdfBeta, type_vv_149> AgradCdfBeta_vv_149;
+typedef std::tuple<AgradCdfBeta, type_vv_150> AgradCdfBeta_vv_150;
+typedef std::tuple<AgradCdfBeta, type_vv_151> AgradCdfBeta_vv_151;
+typedef std::tuple<AgradCdfBeta, type_vv_152> AgradCdfBeta_vv_152;
+typedef std::tuple<AgradCdfBeta, type_vv_153> AgradCdfBeta_vv_153;
+typedef std::tuple<AgradCdfBeta, type_vv_154> AgradCdfBeta_vv_154;
+typedef std::tuple<AgradCdfBeta, type_vv_155> AgradCdfBeta_vv_155;
+typedef std::tuple<AgradCdfBeta, type_vv_156> AgradCdfBeta_vv_156;
+typedef std::tuple<AgradCdfBeta, type_vv_157> AgradCdfBeta_vv_157;
+typedef std::tuple<AgradCdfBeta, type_vv_158> AgradCdfBeta_vv_158;
+typedef std::tuple<AgradCdfBeta, type_vv_159> AgradCdfBeta_vv_159;
+typedef std::tuple<AgradCdfBeta, type_vv_160> AgradCdfBeta_vv_160;
+typedef std::tuple<AgradCdfBeta, type_vv_161> AgradCdfBeta_vv_161;
+typedef std::tuple<AgradCdfBeta, type_vv_162> AgradCdfBeta_vv_162;
+typedef std::tuple<AgradCdfBeta, type_vv_163> AgradCdfBeta_vv_163;
+typedef std::tuple<AgradCdfBeta, type_vv_164> AgradCdfBeta_vv_164;
+typedef std::tuple<AgradCdfBeta, type_vv_165> AgradCdfBeta_vv_165;
+typedef std::tuple<AgradCdfBeta, type_vv_166> AgradCdfBeta_vv_166;
+typedef std::tuple<AgradCdfBeta, type_vv_167> AgradCdfBeta_vv_167;
+typedef std::tuple<AgradCdfBeta, type_vv_168> AgradCdfBeta_vv_168;
+typedef std::tuple<AgradCdfBeta, type_vv_169> AgradCdfBeta_vv_169;
+typedef std::tuple<AgradCdfBeta, type_vv_170> AgradCdfBeta_vv_170;
+typedef std::tuple<AgradCdfBeta, type_vv_171> AgradCdfBeta_vv_171;
+typedef std::tuple<AgradCdfBeta, type_vv_172> AgradCdfBeta_vv_172;
+typedef std::tuple<AgradCdfBeta, type_vv_173> AgradCdfBeta_vv_173;
+typedef std::tuple<AgradCdfBeta, type_vv_174> AgradCdfBeta_vv_174;
+typedef std::tuple<AgradCdfBeta, type_vv_175> AgradCdfBeta_vv_175;
+typedef std::tuple<AgradCdfBeta, type_vv_176> AgradCdfBeta_vv_176;
+typedef std::tuple<AgradCdfBeta, type_vv_177> AgradCdfBeta_vv_177;
+typedef std::tuple<AgradCdfBeta, type_vv_178> AgradCdfBeta_vv_178;
+typedef std::tuple<AgradCdfBeta, type_vv_179> AgradCdfBeta_vv_179;
+typedef std::tuple<AgradCdfBeta, type_vv_180> AgradCdfBeta_vv_180;
+typedef std::tuple<AgradCdfBeta, type_vv_181> AgradCdfBeta_vv_181;
+typedef std::tuple<AgradCdfBeta, type_vv_182> AgradCdfBeta_vv_182;
+typedef std::tuple<AgradCdfBeta, type_vv_183> AgradCdfBeta_vv_183;
+typedef std::tuple<AgradCdfBeta, type_vv_184> AgradCdfBeta_vv_184;
+typedef std::tuple<AgradCdfBeta, type_vv_185> AgradCdfBeta_vv_185;
+typedef std::tuple<AgradCdfBeta, type_vv_186> AgradCdfBeta_vv_186;
+typedef std::tuple<AgradCdfBeta, type_vv_187> AgradCdfBeta_vv_187;
+typedef std::tuple<AgradCdfBeta, type_vv_188> AgradCdfBeta_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_100, AgradCdfTestFixture, AgradCdfBeta_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_101, AgradCdfTestFixture, AgradCdfBeta_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_102, AgradCdfTestFixture, AgradCdfBeta_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_103, AgradCdfTestFixture, AgradCdfBeta_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_104, AgradCdfTestFixture, AgradCdfBeta_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_105, AgradCdfTestFixture, AgradCdfBeta_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_106, AgradCdfTestFixture, AgradCdfBeta_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_107, AgradCdfTestFixture, AgradCdfBeta_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_108, AgradCdfTestFixture, AgradCdfBeta_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_109, AgradCdfTestFixture, AgradCdfBeta_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_110, AgradCdfTestFixture, AgradCdfBeta_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_111, AgradCdfTestFixture, AgradCdfBeta_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_112, AgradCdfTestFixture, AgradCdfBeta_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_113, AgradCdfTestFixture, AgradCdfBeta_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_114, AgradCdfTestFixture, AgradCdfBeta_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_115, AgradCdfTestFixture, AgradCdfBeta_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_116, AgradCdfTestFixture, AgradCdfBeta_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_117, AgradCdfTestFixture, AgradCdfBeta_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_118, AgradCdfTestFixture, AgradCdfBeta_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_119, AgradCdfTestFixture, AgradCdfBeta_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_120, AgradCdfTestFixture, AgradCdfBeta_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_121, AgradCdfTestFixture, AgradCdfBeta_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_122, AgradCdfTestFixture, AgradCdfBeta_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_123, AgradCdfTestFixture, AgradCdfBeta_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_124, AgradCdfTestFixture, AgradCdfBeta_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_125, AgradCdfTestFixture, AgradCdfBeta_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_126, AgradCdfTestFixture, AgradCdfBeta_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_127, AgradCdfTestFixture, AgradCdfBeta_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_128, AgradCdfTestFixture, AgradCdfBeta_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_129, AgradCdfTestFixture, AgradCdfBeta_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_130, AgradCdfTestFixture, AgradCdfBeta_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_131, AgradCdfTestFixture, AgradCdfBeta_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_132, AgradCdfTestFixture, AgradCdfBeta_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_133, AgradCdfTestFixture, AgradCdfBeta_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_134, AgradCdfTestFixture, AgradCdfBeta_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_135, AgradCdfTestFixture, AgradCdfBeta_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_136, AgradCdfTestFixture, AgradCdfBeta_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_137, AgradCdfTestFixture, AgradCdfBeta_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_138, AgradCdfTestFixture, AgradCdfBeta_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_139, AgradCdfTestFixture, AgradCdfBeta_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_140, AgradCdfTestFixture, AgradCdfBeta_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_141, AgradCdfTestFixture, AgradCdfBeta_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_142, AgradCdfTestFixture, AgradCdfBeta_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_143, AgradCdfTestFixture, AgradCdfBeta_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_144, AgradCdfTestFixture, AgradCdfBeta_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_145, AgradCdfTestFixture, AgradCdfBeta_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_146, AgradCdfTestFixture, AgradCdfBeta_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_147, AgradCdfTestFixture, AgradCdfBeta_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_148, AgradCdfTestFixture, AgradCdfBeta_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_149, AgradCdfTestFixture, AgradCdfBeta_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_150, AgradCdfTestFixture, AgradCdfBeta_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_151, AgradCdfTestFixture, AgradCdfBeta_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_152, AgradCdfTestFixture, AgradCdfBeta_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_153, AgradCdfTestFixture, AgradCdfBeta_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_154, AgradCdfTestFixture, AgradCdfBeta_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_155, AgradCdfTestFixture, AgradCdfBeta_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_156, AgradCdfTestFixture, AgradCdfBeta_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_157, AgradCdfTestFixture, AgradCdfBeta_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_158, AgradCdfTestFixture, AgradCdfBeta_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_159, AgradCdfTestFixture, AgradCdfBeta_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_160, AgradCdfTestFixture, AgradCdfBeta_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_161, AgradCdfTestFixture, AgradCdfBeta_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_162, AgradCdfTestFixture, AgradCdfBeta_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_163, AgradCdfTestFixture, AgradCdfBeta_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_164, AgradCdfTestFixture, AgradCdfBeta_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_165, AgradCdfTestFixture, AgradCdfBeta_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_166, AgradCdfTestFixture, AgradCdfBeta_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_167, AgradCdfTestFixture, AgradCdfBeta_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_168, AgradCdfTestFixture, AgradCdfBeta_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_169, AgradCdfTestFixture, AgradCdfBeta_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_170, AgradCdfTestFixture, AgradCdfBeta_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_171, AgradCdfTestFixture, AgradCdfBeta_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_172, AgradCdfTestFixture, AgradCdfBeta_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_173, AgradCdfTestFixture, AgradCdfBeta_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_174, AgradCdfTestFixture, AgradCdfBeta_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_175, AgradCdfTestFixture, AgradCdfBeta_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_176, AgradCdfTestFixture, AgradCdfBeta_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_177, AgradCdfTestFixture, AgradCdfBeta_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_178, AgradCdfTestFixture, AgradCdfBeta_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_179, AgradCdfTestFixture, AgradCdfBeta_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_180, AgradCdfTestFixture, AgradCdfBeta_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_181, AgradCdfTestFixture, AgradCdfBeta_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_182, AgradCdfTestFixture, AgradCdfBeta_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_183, AgradCdfTestFixture, AgradCdfBeta_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_184, AgradCdfTestFixture, AgradCdfBeta_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_185, AgradCdfTestFixture, AgradCdfBeta_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_186, AgradCdfTestFixture, AgradCdfBeta_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_187, AgradCdfTestFixture, AgradCdfBeta_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBeta_vv_188, AgradCdfTestFixture, AgradCdfBeta_vv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogBeta, type_ffv_0> AgradCdfLogBeta_ffv_0;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_1> AgradCdfLogBeta_ffv_1;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_2> AgradCdfLogBeta_ffv_2;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_3> AgradCdfLogBeta_ffv_3;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_4> AgradCdfLogBeta_ffv_4;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_5> AgradCdfLogBeta_ffv_5;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_6> AgradCdfLogBeta_ffv_6;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_7> AgradCdfLogBeta_ffv_7;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_8> AgradCdfLogBeta_ffv_8;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_9> AgradCdfLogBeta_ffv_9;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_10> AgradCdfLogBeta_ffv_10;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_11> AgradCdfLogBeta_ffv_11;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_12> AgradCdfLogBeta_ffv_12;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_13> AgradCdfLogBeta_ffv_13;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_14> AgradCdfLogBeta_ffv_14;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_15> AgradCdfLogBeta_ffv_15;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_16> AgradCdfLogBeta_ffv_16;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_17> AgradCdfLogBeta_ffv_17;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_18> AgradCdfLogBeta_ffv_18;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_19> AgradCdfLogBeta_ffv_19;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_20> AgradCdfLogBeta_ffv_20;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_21> AgradCdfLogBeta_ffv_21;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_22> AgradCdfLogBeta_ffv_22;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_23> AgradCdfLogBeta_ffv_23;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_24> AgradCdfLogBeta_ffv_24;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_25> AgradCdfLogBeta_ffv_25;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_26> AgradCdfLogBeta_ffv_26;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_27> AgradCdfLogBeta_ffv_27;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_28> AgradCdfLogBeta_ffv_28;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_29> AgradCdfLogBeta_ffv_29;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_30> AgradCdfLogBeta_ffv_30;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_31> AgradCdfLogBeta_ffv_31;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_32> AgradCdfLogBeta_ffv_32;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_33> AgradCdfLogBeta_ffv_33;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_34> AgradCdfLogBeta_ffv_34;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_35> AgradCdfLogBeta_ffv_35;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_36> AgradCdfLogBeta_ffv_36;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_37> AgradCdfLogBeta_ffv_37;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_38> AgradCdfLogBeta_ffv_38;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_39> AgradCdfLogBeta_ffv_39;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_40> AgradCdfLogBeta_ffv_40;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_41> AgradCdfLogBeta_ffv_41;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_42> AgradCdfLogBeta_ffv_42;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_43> AgradCdfLogBeta_ffv_43;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_44> AgradCdfLogBeta_ffv_44;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_45> AgradCdfLogBeta_ffv_45;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_46> AgradCdfLogBeta_ffv_46;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_47> AgradCdfLogBeta_ffv_47;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_48> AgradCdfLogBeta_ffv_48;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_49> AgradCdfLogBeta_ffv_49;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_50> AgradCdfLogBeta_ffv_50;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_51> AgradCdfLogBeta_ffv_51;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_52> AgradCdfLogBeta_ffv_52;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_53> AgradCdfLogBeta_ffv_53;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_54> AgradCdfLogBeta_ffv_54;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_55> AgradCdfLogBeta_ffv_55;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_56> AgradCdfLogBeta_ffv_56;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_57> AgradCdfLogBeta_ffv_57;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_58> AgradCdfLogBeta_ffv_58;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_59> AgradCdfLogBeta_ffv_59;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_60> AgradCdfLogBeta_ffv_60;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_61> AgradCdfLogBeta_ffv_61;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_62> AgradCdfLogBeta_ffv_62;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_63> AgradCdfLogBeta_ffv_63;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_64> AgradCdfLogBeta_ffv_64;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_65> AgradCdfLogBeta_ffv_65;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_66> AgradCdfLogBeta_ffv_66;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_67> AgradCdfLogBeta_ffv_67;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_68> AgradCdfLogBeta_ffv_68;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_69> AgradCdfLogBeta_ffv_69;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_70> AgradCdfLogBeta_ffv_70;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_71> AgradCdfLogBeta_ffv_71;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_72> AgradCdfLogBeta_ffv_72;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_73> AgradCdfLogBeta_ffv_73;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_74> AgradCdfLogBeta_ffv_74;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_75> AgradCdfLogBeta_ffv_75;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_76> AgradCdfLogBeta_ffv_76;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_77> AgradCdfLogBeta_ffv_77;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_78> AgradCdfLogBeta_ffv_78;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_79> AgradCdfLogBeta_ffv_79;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_80> AgradCdfLogBeta_ffv_80;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_81> AgradCdfLogBeta_ffv_81;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_82> AgradCdfLogBeta_ffv_82;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_83> AgradCdfLogBeta_ffv_83;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_84> AgradCdfLogBeta_ffv_84;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_85> AgradCdfLogBeta_ffv_85;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_86> AgradCdfLogBeta_ffv_86;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_87> AgradCdfLogBeta_ffv_87;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_88> AgradCdfLogBeta_ffv_88;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_89> AgradCdfLogBeta_ffv_89;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_90> AgradCdfLogBeta_ffv_90;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_91> AgradCdfLogBeta_ffv_91;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_92> AgradCdfLogBeta_ffv_92;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_93> AgradCdfLogBeta_ffv_93;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_94> AgradCdfLogBeta_ffv_94;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_95> AgradCdfLogBeta_ffv_95;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_96> AgradCdfLogBeta_ffv_96;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_97> AgradCdfLogBeta_ffv_97;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_98> AgradCdfLogBeta_ffv_98;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_99> AgradCdfLogBeta_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_0, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_1, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_2, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_3, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_4, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_5, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_6, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_7, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_8, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_9, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_10, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_11, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_12, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_13, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_14, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_15, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_16, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_17, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_18, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_19, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_20, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_21, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_22, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_23, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_24, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_25, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_26, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_27, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_28, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_29, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_30, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_31, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_32, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_33, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_34, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_35, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_36, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_37, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_38, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_39, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_40, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_41, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_42, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_43, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_44, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_45, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_46, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_47, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_48, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_49, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_50, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_51, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_52, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_53, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_54, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_55, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_56, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_57, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_58, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_59, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_60, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_61, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_62, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_63, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_64, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_65, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_66, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_67, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_68, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_69, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_70, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_71, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_72, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_73, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_74, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_75, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_76, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_77, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_78, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_79, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_80, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_81, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_82, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_83, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_84, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_85, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_86, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_87, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_88, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_89, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_90, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_91, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_92, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_93, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_94, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_95, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_96, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_97, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_98, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_99, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_99);
+
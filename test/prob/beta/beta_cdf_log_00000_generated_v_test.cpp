@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogBeta, type_v_0> AgradCdfLogBeta_v_0;
+typedef std::tuple<AgradCdfLogBeta, type_v_1> AgradCdfLogBeta_v_1;
+typedef std::tuple<AgradCdfLogBeta, type_v_2> AgradCdfLogBeta_v_2;
+typedef std::tuple<AgradCdfLogBeta, type_v_3> AgradCdfLogBeta_v_3;
+typedef std::tuple<AgradCdfLogBeta, type_v_4> AgradCdfLogBeta_v_4;
+typedef std::tuple<AgradCdfLogBeta, type_v_5> AgradCdfLogBeta_v_5;
+typedef std::tuple<AgradCdfLogBeta, type_v_6> AgradCdfLogBeta_v_6;
+typedef std::tuple<AgradCdfLogBeta, type_v_7> AgradCdfLogBeta_v_7;
+typedef std::tuple<AgradCdfLogBeta, type_v_8> AgradCdfLogBeta_v_8;
+typedef std::tuple<AgradCdfLogBeta, type_v_9> AgradCdfLogBeta_v_9;
+typedef std::tuple<AgradCdfLogBeta, type_v_10> AgradCdfLogBeta_v_10;
+typedef std::tuple<AgradCdfLogBeta, type_v_11> AgradCdfLogBeta_v_11;
+typedef std::tuple<AgradCdfLogBeta, type_v_12> AgradCdfLogBeta_v_12;
+typedef std::tuple<AgradCdfLogBeta, type_v_13> AgradCdfLogBeta_v_13;
+typedef std::tuple<AgradCdfLogBeta, type_v_14> AgradCdfLogBeta_v_14;
+typedef std::tuple<AgradCdfLogBeta, type_v_15> AgradCdfLogBeta_v_15;
+typedef std::tuple<AgradCdfLogBeta, type_v_16> AgradCdfLogBeta_v_16;
+typedef std::tuple<AgradCdfLogBeta, type_v_17> AgradCdfLogBeta_v_17;
+typedef std::tuple<AgradCdfLogBeta, type_v_18> AgradCdfLogBeta_v_18;
+typedef std::tuple<AgradCdfLogBeta, type_v_19> AgradCdfLogBeta_v_19;
+typedef std::tuple<AgradCdfLogBeta, type_v_20> AgradCdfLogBeta_v_20;
+typedef std::tuple<AgradCdfLogBeta, type_v_21> AgradCdfLogBeta_v_21;
+typedef std::tuple<AgradCdfLogBeta, type_v_22> AgradCdfLogBeta_v_22;
+typedef std::tuple<AgradCdfLogBeta, type_v_23> AgradCdfLogBeta_v_23;
+typedef std::tuple<AgradCdfLogBeta, type_v_24> AgradCdfLogBeta_v_24;
+typedef std::tuple<AgradCdfLogBeta, type_v_25> AgradCdfLogBeta_v_25;
+typedef std::tuple<AgradCdfLogBeta, type_v_26> AgradCdfLogBeta_v_26;
+typedef std::tuple<AgradCdfLogBeta, type_v_27> AgradCdfLogBeta_v_27;
+typedef std::tuple<AgradCdfLogBeta, type_v_28> AgradCdfLogBeta_v_28;
+typedef std::tuple<AgradCdfLogBeta, type_v_29> AgradCdfLogBeta_v_29;
+typedef std::tuple<AgradCdfLogBeta, type_v_30> AgradCdfLogBeta_v_30;
+typedef std::tuple<AgradCdfLogBeta, type_v_31> AgradCdfLogBeta_v_31;
+typedef std::tuple<AgradCdfLogBeta, type_v_32> AgradCdfLogBeta_v_32;
+typedef std::tuple<AgradCdfLogBeta, type_v_33> AgradCdfLogBeta_v_33;
+typedef std::tuple<AgradCdfLogBeta, type_v_34> AgradCdfLogBeta_v_34;
+typedef std::tuple<AgradCdfLogBeta, type_v_35> AgradCdfLogBeta_v_35;
+typedef std::tuple<AgradCdfLogBeta, type_v_36> AgradCdfLogBeta_v_36;
+typedef std::tuple<AgradCdfLogBeta, type_v_37> AgradCdfLogBeta_v_37;
+typedef std::tuple<AgradCdfLogBeta, type_v_38> AgradCdfLogBeta_v_38;
+typedef std::tuple<AgradCdfLogBeta, type_v_39> AgradCdfLogBeta_v_39;
+typedef std::tuple<AgradCdfLogBeta, type_v_40> AgradCdfLogBeta_v_40;
+typedef std::tuple<AgradCdfLogBeta, type_v_41> AgradCdfLogBeta_v_41;
+typedef std::tuple<AgradCdfLogBeta, type_v_42> AgradCdfLogBeta_v_42;
+typedef std::tuple<AgradCdfLogBeta, type_v_43> AgradCdfLogBeta_v_43;
+typedef std::tuple<AgradCdfLogBeta, type_v_44> AgradCdfLogBeta_v_44;
+typedef std::tuple<AgradCdfLogBeta, type_v_45> AgradCdfLogBeta_v_45;
+typedef std::tuple<AgradCdfLogBeta, type_v_46> AgradCdfLogBeta_v_46;
+typedef std::tuple<AgradCdfLogBeta, type_v_47> AgradCdfLogBeta_v_47;
+typedef std::tuple<AgradCdfLogBeta, type_v_48> AgradCdfLogBeta_v_48;
+typedef std::tuple<AgradCdfLogBeta, type_v_49> AgradCdfLogBeta_v_49;
+typedef std::tuple<AgradCdfLogBeta, type_v_50> AgradCdfLogBeta_v_50;
+typedef std::tuple<AgradCdfLogBeta, type_v_51> AgradCdfLogBeta_v_51;
+typedef std::tuple<AgradCdfLogBeta, type_v_52> AgradCdfLogBeta_v_52;
+typedef std::tuple<AgradCdfLogBeta, type_v_53> AgradCdfLogBeta_v_53;
+typedef std::tuple<AgradCdfLogBeta, type_v_54> AgradCdfLogBeta_v_54;
+typedef std::tuple<AgradCdfLogBeta, type_v_55> AgradCdfLogBeta_v_55;
+typedef std::tuple<AgradCdfLogBeta, type_v_56> AgradCdfLogBeta_v_56;
+typedef std::tuple<AgradCdfLogBeta, type_v_57> AgradCdfLogBeta_v_57;
+typedef std::tuple<AgradCdfLogBeta, type_v_58> AgradCdfLogBeta_v_58;
+typedef std::tuple<AgradCdfLogBeta, type_v_59> AgradCdfLogBeta_v_59;
+typedef std::tuple<AgradCdfLogBeta, type_v_60> AgradCdfLogBeta_v_60;
+typedef std::tuple<AgradCdfLogBeta, type_v_61> AgradCdfLogBeta_v_61;
+typedef std::tuple<AgradCdfLogBeta, type_v_62> AgradCdfLogBeta_v_62;
+typedef std::tuple<AgradCdfLogBeta, type_v_63> AgradCdfLogBeta_v_63;
+typedef std::tuple<AgradCdfLogBeta, type_v_64> AgradCdfLogBeta_v_64;
+typedef std::tuple<AgradCdfLogBeta, type_v_65> AgradCdfLogBeta_v_65;
+typedef std::tuple<AgradCdfLogBeta, type_v_66> AgradCdfLogBeta_v_66;
+typedef std::tuple<AgradCdfLogBeta, type_v_67> AgradCdfLogBeta_v_67;
+typedef std::tuple<AgradCdfLogBeta, type_v_68> AgradCdfLogBeta_v_68;
+typedef std::tuple<AgradCdfLogBeta, type_v_69> AgradCdfLogBeta_v_69;
+typedef std::tuple<AgradCdfLogBeta, type_v_70> AgradCdfLogBeta_v_70;
+typedef std::tuple<AgradCdfLogBeta, type_v_71> AgradCdfLogBeta_v_71;
+typedef std::tuple<AgradCdfLogBeta, type_v_72> AgradCdfLogBeta_v_72;
+typedef std::tuple<AgradCdfLogBeta, type_v_73> AgradCdfLogBeta_v_73;
+typedef std::tuple<AgradCdfLogBeta, type_v_74> AgradCdfLogBeta_v_74;
+typedef std::tuple<AgradCdfLogBeta, type_v_75> AgradCdfLogBeta_v_75;
+typedef std::tuple<AgradCdfLogBeta, type_v_76> AgradCdfLogBeta_v_76;
+typedef std::tuple<AgradCdfLogBeta, type_v_77> AgradCdfLogBeta_v_77;
+typedef std::tuple<AgradCdfLogBeta, type_v_78> AgradCdfLogBeta_v_78;
+typedef std::tuple<AgradCdfLogBeta, type_v_79> AgradCdfLogBeta_v_79;
+typedef std::tuple<AgradCdfLogBeta, type_v_80> AgradCdfLogBeta_v_80;
+typedef std::tuple<AgradCdfLogBeta, type_v_81> AgradCdfLogBeta_v_81;
+typedef std::tuple<AgradCdfLogBeta, type_v_82> AgradCdfLogBeta_v_82;
+typedef std::tuple<AgradCdfLogBeta, type_v_83> AgradCdfLogBeta_v_83;
+typedef std::tuple<AgradCdfLogBeta, type_v_84> AgradCdfLogBeta_v_84;
+typedef std::tuple<AgradCdfLogBeta, type_v_85> AgradCdfLogBeta_v_85;
+typedef std::tuple<AgradCdfLogBeta, type_v_86> AgradCdfLogBeta_v_86;
+typedef std::tuple<AgradCdfLogBeta, type_v_87> AgradCdfLogBeta_v_87;
+typedef std::tuple<AgradCdfLogBeta, type_v_88> AgradCdfLogBeta_v_88;
+typedef std::tuple<AgradCdfLogBeta, type_v_89> AgradCdfLogBeta_v_89;
+typedef std::tuple<AgradCdfLogBeta, type_v_90> AgradCdfLogBeta_v_90;
+typedef std::tuple<AgradCdfLogBeta, type_v_91> AgradCdfLogBeta_v_91;
+typedef std::tuple<AgradCdfLogBeta, type_v_92> AgradCdfLogBeta_v_92;
+typedef std::tuple<AgradCdfLogBeta, type_v_93> AgradCdfLogBeta_v_93;
+typedef std::tuple<AgradCdfLogBeta, type_v_94> AgradCdfLogBeta_v_94;
+typedef std::tuple<AgradCdfLogBeta, type_v_95> AgradCdfLogBeta_v_95;
+typedef std::tuple<AgradCdfLogBeta, type_v_96> AgradCdfLogBeta_v_96;
+typedef std::tuple<AgradCdfLogBeta, type_v_97> AgradCdfLogBeta_v_97;
+typedef std::tuple<AgradCdfLogBeta, type_v_98> AgradCdfLogBeta_v_98;
+typedef std::tuple<AgradCdfLogBeta, type_v_99> AgradCdfLogBeta_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_0, AgradCdfLogTestFixture, AgradCdfLogBeta_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_1, AgradCdfLogTestFixture, AgradCdfLogBeta_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_2, AgradCdfLogTestFixture, AgradCdfLogBeta_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_3, AgradCdfLogTestFixture, AgradCdfLogBeta_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_4, AgradCdfLogTestFixture, AgradCdfLogBeta_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_5, AgradCdfLogTestFixture, AgradCdfLogBeta_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_6, AgradCdfLogTestFixture, AgradCdfLogBeta_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_7, AgradCdfLogTestFixture, AgradCdfLogBeta_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_8, AgradCdfLogTestFixture, AgradCdfLogBeta_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_9, AgradCdfLogTestFixture, AgradCdfLogBeta_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_10, AgradCdfLogTestFixture, AgradCdfLogBeta_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_11, AgradCdfLogTestFixture, AgradCdfLogBeta_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_12, AgradCdfLogTestFixture, AgradCdfLogBeta_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_13, AgradCdfLogTestFixture, AgradCdfLogBeta_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_14, AgradCdfLogTestFixture, AgradCdfLogBeta_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_15, AgradCdfLogTestFixture, AgradCdfLogBeta_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_16, AgradCdfLogTestFixture, AgradCdfLogBeta_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_17, AgradCdfLogTestFixture, AgradCdfLogBeta_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_18, AgradCdfLogTestFixture, AgradCdfLogBeta_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_19, AgradCdfLogTestFixture, AgradCdfLogBeta_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_20, AgradCdfLogTestFixture, AgradCdfLogBeta_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_21, AgradCdfLogTestFixture, AgradCdfLogBeta_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_22, AgradCdfLogTestFixture, AgradCdfLogBeta_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_23, AgradCdfLogTestFixture, AgradCdfLogBeta_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_24, AgradCdfLogTestFixture, AgradCdfLogBeta_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_25, AgradCdfLogTestFixture, AgradCdfLogBeta_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_26, AgradCdfLogTestFixture, AgradCdfLogBeta_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_27, AgradCdfLogTestFixture, AgradCdfLogBeta_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_28, AgradCdfLogTestFixture, AgradCdfLogBeta_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_29, AgradCdfLogTestFixture, AgradCdfLogBeta_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_30, AgradCdfLogTestFixture, AgradCdfLogBeta_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_31, AgradCdfLogTestFixture, AgradCdfLogBeta_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_32, AgradCdfLogTestFixture, AgradCdfLogBeta_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_33, AgradCdfLogTestFixture, AgradCdfLogBeta_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_34, AgradCdfLogTestFixture, AgradCdfLogBeta_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_35, AgradCdfLogTestFixture, AgradCdfLogBeta_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_36, AgradCdfLogTestFixture, AgradCdfLogBeta_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_37, AgradCdfLogTestFixture, AgradCdfLogBeta_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_38, AgradCdfLogTestFixture, AgradCdfLogBeta_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_39, AgradCdfLogTestFixture, AgradCdfLogBeta_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_40, AgradCdfLogTestFixture, AgradCdfLogBeta_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_41, AgradCdfLogTestFixture, AgradCdfLogBeta_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_42, AgradCdfLogTestFixture, AgradCdfLogBeta_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_43, AgradCdfLogTestFixture, AgradCdfLogBeta_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_44, AgradCdfLogTestFixture, AgradCdfLogBeta_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_45, AgradCdfLogTestFixture, AgradCdfLogBeta_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_46, AgradCdfLogTestFixture, AgradCdfLogBeta_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_47, AgradCdfLogTestFixture, AgradCdfLogBeta_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_48, AgradCdfLogTestFixture, AgradCdfLogBeta_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_49, AgradCdfLogTestFixture, AgradCdfLogBeta_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_50, AgradCdfLogTestFixture, AgradCdfLogBeta_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_51, AgradCdfLogTestFixture, AgradCdfLogBeta_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_52, AgradCdfLogTestFixture, AgradCdfLogBeta_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_53, AgradCdfLogTestFixture, AgradCdfLogBeta_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_54, AgradCdfLogTestFixture, AgradCdfLogBeta_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_55, AgradCdfLogTestFixture, AgradCdfLogBeta_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_56, AgradCdfLogTestFixture, AgradCdfLogBeta_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_57, AgradCdfLogTestFixture, AgradCdfLogBeta_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_58, AgradCdfLogTestFixture, AgradCdfLogBeta_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_59, AgradCdfLogTestFixture, AgradCdfLogBeta_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_60, AgradCdfLogTestFixture, AgradCdfLogBeta_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_61, AgradCdfLogTestFixture, AgradCdfLogBeta_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_62, AgradCdfLogTestFixture, AgradCdfLogBeta_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_63, AgradCdfLogTestFixture, AgradCdfLogBeta_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_64, AgradCdfLogTestFixture, AgradCdfLogBeta_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_65, AgradCdfLogTestFixture, AgradCdfLogBeta_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_66, AgradCdfLogTestFixture, AgradCdfLogBeta_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_67, AgradCdfLogTestFixture, AgradCdfLogBeta_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_68, AgradCdfLogTestFixture, AgradCdfLogBeta_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_69, AgradCdfLogTestFixture, AgradCdfLogBeta_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_70, AgradCdfLogTestFixture, AgradCdfLogBeta_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_71, AgradCdfLogTestFixture, AgradCdfLogBeta_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_72, AgradCdfLogTestFixture, AgradCdfLogBeta_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_73, AgradCdfLogTestFixture, AgradCdfLogBeta_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_74, AgradCdfLogTestFixture, AgradCdfLogBeta_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_75, AgradCdfLogTestFixture, AgradCdfLogBeta_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_76, AgradCdfLogTestFixture, AgradCdfLogBeta_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_77, AgradCdfLogTestFixture, AgradCdfLogBeta_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_78, AgradCdfLogTestFixture, AgradCdfLogBeta_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_79, AgradCdfLogTestFixture, AgradCdfLogBeta_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_80, AgradCdfLogTestFixture, AgradCdfLogBeta_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_81, AgradCdfLogTestFixture, AgradCdfLogBeta_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_82, AgradCdfLogTestFixture, AgradCdfLogBeta_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_83, AgradCdfLogTestFixture, AgradCdfLogBeta_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_84, AgradCdfLogTestFixture, AgradCdfLogBeta_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_85, AgradCdfLogTestFixture, AgradCdfLogBeta_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_86, AgradCdfLogTestFixture, AgradCdfLogBeta_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_87, AgradCdfLogTestFixture, AgradCdfLogBeta_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_88, AgradCdfLogTestFixture, AgradCdfLogBeta_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_89, AgradCdfLogTestFixture, AgradCdfLogBeta_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_90, AgradCdfLogTestFixture, AgradCdfLogBeta_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_91, AgradCdfLogTestFixture, AgradCdfLogBeta_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_92, AgradCdfLogTestFixture, AgradCdfLogBeta_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_93, AgradCdfLogTestFixture, AgradCdfLogBeta_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_94, AgradCdfLogTestFixture, AgradCdfLogBeta_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_95, AgradCdfLogTestFixture, AgradCdfLogBeta_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_96, AgradCdfLogTestFixture, AgradCdfLogBeta_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_97, AgradCdfLogTestFixture, AgradCdfLogBeta_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_98, AgradCdfLogTestFixture, AgradCdfLogBeta_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_99, AgradCdfLogTestFixture, AgradCdfLogBeta_v_99);
+
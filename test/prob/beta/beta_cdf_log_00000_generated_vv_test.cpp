@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogBeta, type_vv_0> AgradCdfLogBeta_vv_0;
+typedef std::tuple<AgradCdfLogBeta, type_vv_1> AgradCdfLogBeta_vv_1;
+typedef std::tuple<AgradCdfLogBeta, type_vv_2> AgradCdfLogBeta_vv_2;
+typedef std::tuple<AgradCdfLogBeta, type_vv_3> AgradCdfLogBeta_vv_3;
+typedef std::tuple<AgradCdfLogBeta, type_vv_4> AgradCdfLogBeta_vv_4;
+typedef std::tuple<AgradCdfLogBeta, type_vv_5> AgradCdfLogBeta_vv_5;
+typedef std::tuple<AgradCdfLogBeta, type_vv_6> AgradCdfLogBeta_vv_6;
+typedef std::tuple<AgradCdfLogBeta, type_vv_7> AgradCdfLogBeta_vv_7;
+typedef std::tuple<AgradCdfLogBeta, type_vv_8> AgradCdfLogBeta_vv_8;
+typedef std::tuple<AgradCdfLogBeta, type_vv_9> AgradCdfLogBeta_vv_9;
+typedef std::tuple<AgradCdfLogBeta, type_vv_10> AgradCdfLogBeta_vv_10;
+typedef std::tuple<AgradCdfLogBeta, type_vv_11> AgradCdfLogBeta_vv_11;
+typedef std::tuple<AgradCdfLogBeta, type_vv_12> AgradCdfLogBeta_vv_12;
+typedef std::tuple<AgradCdfLogBeta, type_vv_13> AgradCdfLogBeta_vv_13;
+typedef std::tuple<AgradCdfLogBeta, type_vv_14> AgradCdfLogBeta_vv_14;
+typedef std::tuple<AgradCdfLogBeta, type_vv_15> AgradCdfLogBeta_vv_15;
+typedef std::tuple<AgradCdfLogBeta, type_vv_16> AgradCdfLogBeta_vv_16;
+typedef std::tuple<AgradCdfLogBeta, type_vv_17> AgradCdfLogBeta_vv_17;
+typedef std::tuple<AgradCdfLogBeta, type_vv_18> AgradCdfLogBeta_vv_18;
+typedef std::tuple<AgradCdfLogBeta, type_vv_19> AgradCdfLogBeta_vv_19;
+typedef std::tuple<AgradCdfLogBeta, type_vv_20> AgradCdfLogBeta_vv_20;
+typedef std::tuple<AgradCdfLogBeta, type_vv_21> AgradCdfLogBeta_vv_21;
+typedef std::tuple<AgradCdfLogBeta, type_vv_22> AgradCdfLogBeta_vv_22;
+typedef std::tuple<AgradCdfLogBeta, type_vv_23> AgradCdfLogBeta_vv_23;
+typedef std::tuple<AgradCdfLogBeta, type_vv_24> AgradCdfLogBeta_vv_24;
+typedef std::tuple<AgradCdfLogBeta, type_vv_25> AgradCdfLogBeta_vv_25;
+typedef std::tuple<AgradCdfLogBeta, type_vv_26> AgradCdfLogBeta_vv_26;
+typedef std::tuple<AgradCdfLogBeta, type_vv_27> AgradCdfLogBeta_vv_27;
+typedef std::tuple<AgradCdfLogBeta, type_vv_28> AgradCdfLogBeta_vv_28;
+typedef std::tuple<AgradCdfLogBeta, type_vv_29> AgradCdfLogBeta_vv_29;
+typedef std::tuple<AgradCdfLogBeta, type_vv_30> AgradCdfLogBeta_vv_30;
+typedef std::tuple<AgradCdfLogBeta, type_vv_31> AgradCdfLogBeta_vv_31;
+typedef std::tuple<AgradCdfLogBeta, type_vv_32> AgradCdfLogBeta_vv_32;
+typedef std::tuple<AgradCdfLogBeta, type_vv_33> AgradCdfLogBeta_vv_33;
+typedef std::tuple<AgradCdfLogBeta, type_vv_34> AgradCdfLogBeta_vv_34;
+typedef std::tuple<AgradCdfLogBeta, type_vv_35> AgradCdfLogBeta_vv_35;
+typedef std::tuple<AgradCdfLogBeta, type_vv_36> AgradCdfLogBeta_vv_36;
+typedef std::tuple<AgradCdfLogBeta, type_vv_37> AgradCdfLogBeta_vv_37;
+typedef std::tuple<AgradCdfLogBeta, type_vv_38> AgradCdfLogBeta_vv_38;
+typedef std::tuple<AgradCdfLogBeta, type_vv_39> AgradCdfLogBeta_vv_39;
+typedef std::tuple<AgradCdfLogBeta, type_vv_40> AgradCdfLogBeta_vv_40;
+typedef std::tuple<AgradCdfLogBeta, type_vv_41> AgradCdfLogBeta_vv_41;
+typedef std::tuple<AgradCdfLogBeta, type_vv_42> AgradCdfLogBeta_vv_42;
+typedef std::tuple<AgradCdfLogBeta, type_vv_43> AgradCdfLogBeta_vv_43;
+typedef std::tuple<AgradCdfLogBeta, type_vv_44> AgradCdfLogBeta_vv_44;
+typedef std::tuple<AgradCdfLogBeta, type_vv_45> AgradCdfLogBeta_vv_45;
+typedef std::tuple<AgradCdfLogBeta, type_vv_46> AgradCdfLogBeta_vv_46;
+typedef std::tuple<AgradCdfLogBeta, type_vv_47> AgradCdfLogBeta_vv_47;
+typedef std::tuple<AgradCdfLogBeta, type_vv_48> AgradCdfLogBeta_vv_48;
+typedef std::tuple<AgradCdfLogBeta, type_vv_49> AgradCdfLogBeta_vv_49;
+typedef std::tuple<AgradCdfLogBeta, type_vv_50> AgradCdfLogBeta_vv_50;
+typedef std::tuple<AgradCdfLogBeta, type_vv_51> AgradCdfLogBeta_vv_51;
+typedef std::tuple<AgradCdfLogBeta, type_vv_52> AgradCdfLogBeta_vv_52;
+typedef std::tuple<AgradCdfLogBeta, type_vv_53> AgradCdfLogBeta_vv_53;
+typedef std::tuple<AgradCdfLogBeta, type_vv_54> AgradCdfLogBeta_vv_54;
+typedef std::tuple<AgradCdfLogBeta, type_vv_55> AgradCdfLogBeta_vv_55;
+typedef std::tuple<AgradCdfLogBeta, type_vv_56> AgradCdfLogBeta_vv_56;
+typedef std::tuple<AgradCdfLogBeta, type_vv_57> AgradCdfLogBeta_vv_57;
+typedef std::tuple<AgradCdfLogBeta, type_vv_58> AgradCdfLogBeta_vv_58;
+typedef std::tuple<AgradCdfLogBeta, type_vv_59> AgradCdfLogBeta_vv_59;
+typedef std::tuple<AgradCdfLogBeta, type_vv_60> AgradCdfLogBeta_vv_60;
+typedef std::tuple<AgradCdfLogBeta, type_vv_61> AgradCdfLogBeta_vv_61;
+typedef std::tuple<AgradCdfLogBeta, type_vv_62> AgradCdfLogBeta_vv_62;
+typedef std::tuple<AgradCdfLogBeta, type_vv_63> AgradCdfLogBeta_vv_63;
+typedef std::tuple<AgradCdfLogBeta, type_vv_64> AgradCdfLogBeta_vv_64;
+typedef std::tuple<AgradCdfLogBeta, type_vv_65> AgradCdfLogBeta_vv_65;
+typedef std::tuple<AgradCdfLogBeta, type_vv_66> AgradCdfLogBeta_vv_66;
+typedef std::tuple<AgradCdfLogBeta, type_vv_67> AgradCdfLogBeta_vv_67;
+typedef std::tuple<AgradCdfLogBeta, type_vv_68> AgradCdfLogBeta_vv_68;
+typedef std::tuple<AgradCdfLogBeta, type_vv_69> AgradCdfLogBeta_vv_69;
+typedef std::tuple<AgradCdfLogBeta, type_vv_70> AgradCdfLogBeta_vv_70;
+typedef std::tuple<AgradCdfLogBeta, type_vv_71> AgradCdfLogBeta_vv_71;
+typedef std::tuple<AgradCdfLogBeta, type_vv_72> AgradCdfLogBeta_vv_72;
+typedef std::tuple<AgradCdfLogBeta, type_vv_73> AgradCdfLogBeta_vv_73;
+typedef std::tuple<AgradCdfLogBeta, type_vv_74> AgradCdfLogBeta_vv_74;
+typedef std::tuple<AgradCdfLogBeta, type_vv_75> AgradCdfLogBeta_vv_75;
+typedef std::tuple<AgradCdfLogBeta, type_vv_76> AgradCdfLogBeta_vv_76;
+typedef std::tuple<AgradCdfLogBeta, type_vv_77> AgradCdfLogBeta_vv_77;
+typedef std::tuple<AgradCdfLogBeta, type_vv_78> AgradCdfLogBeta_vv_78;
+typedef std::tuple<AgradCdfLogBeta, type_vv_79> AgradCdfLogBeta_vv_79;
+typedef std::tuple<AgradCdfLogBeta, type_vv_80> AgradCdfLogBeta_vv_80;
+typedef std::tuple<AgradCdfLogBeta, type_vv_81> AgradCdfLogBeta_vv_81;
+typedef std::tuple<AgradCdfLogBeta, type_vv_82> AgradCdfLogBeta_vv_82;
+typedef std::tuple<AgradCdfLogBeta, type_vv_83> AgradCdfLogBeta_vv_83;
+typedef std::tuple<AgradCdfLogBeta, type_vv_84> AgradCdfLogBeta_vv_84;
+typedef std::tuple<AgradCdfLogBeta, type_vv_85> AgradCdfLogBeta_vv_85;
+typedef std::tuple<AgradCdfLogBeta, type_vv_86> AgradCdfLogBeta_vv_86;
+typedef std::tuple<AgradCdfLogBeta, type_vv_87> AgradCdfLogBeta_vv_87;
+typedef std::tuple<AgradCdfLogBeta, type_vv_88> AgradCdfLogBeta_vv_88;
+typedef std::tuple<AgradCdfLogBeta, type_vv_89> AgradCdfLogBeta_vv_89;
+typedef std::tuple<AgradCdfLogBeta, type_vv_90> AgradCdfLogBeta_vv_90;
+typedef std::tuple<AgradCdfLogBeta, type_vv_91> AgradCdfLogBeta_vv_91;
+typedef std::tuple<AgradCdfLogBeta, type_vv_92> AgradCdfLogBeta_vv_92;
+typedef std::tuple<AgradCdfLogBeta, type_vv_93> AgradCdfLogBeta_vv_93;
+typedef std::tuple<AgradCdfLogBeta, type_vv_94> AgradCdfLogBeta_vv_94;
+typedef std::tuple<AgradCdfLogBeta, type_vv_95> AgradCdfLogBeta_vv_95;
+typedef std::tuple<AgradCdfLogBeta, type_vv_96> AgradCdfLogBeta_vv_96;
+typedef std::tuple<AgradCdfLogBeta, type_vv_97> AgradCdfLogBeta_vv_97;
+typedef std::tuple<AgradCdfLogBeta, type_vv_98> AgradCdfLogBeta_vv_98;
+typedef std::tuple<AgradCdfLogBeta, type_vv_99> AgradCdfLogBeta_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_0, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_1, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_2, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_3, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_4, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_5, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_6, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_7, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_8, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_9, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_10, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_11, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_12, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_13, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_14, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_15, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_16, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_17, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_18, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_19, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_20, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_21, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_22, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_23, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_24, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_25, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_26, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_27, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_28, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_29, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_30, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_31, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_32, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_33, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_34, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_35, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_36, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_37, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_38, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_39, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_40, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_41, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_42, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_43, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_44, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_45, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_46, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_47, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_48, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_49, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_50, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_51, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_52, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_53, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_54, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_55, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_56, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_57, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_58, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_59, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_60, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_61, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_62, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_63, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_64, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_65, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_66, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_67, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_68, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_69, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_70, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_71, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_72, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_73, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_74, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_75, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_76, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_77, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_78, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_79, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_80, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_81, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_82, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_83, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_84, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_85, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_86, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_87, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_88, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_89, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_90, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_91, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_92, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_93, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_94, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_95, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_96, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_97, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_98, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_99, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_99);
+
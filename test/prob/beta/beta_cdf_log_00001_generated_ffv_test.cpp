@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogBeta, type_ffv_100> AgradCdfLogBeta_ffv_100;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_101> AgradCdfLogBeta_ffv_101;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_102> AgradCdfLogBeta_ffv_102;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_103> AgradCdfLogBeta_ffv_103;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_104> AgradCdfLogBeta_ffv_104;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_105> AgradCdfLogBeta_ffv_105;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_106> AgradCdfLogBeta_ffv_106;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_107> AgradCdfLogBeta_ffv_107;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_108> AgradCdfLogBeta_ffv_108;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_109> AgradCdfLogBeta_ffv_109;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_110> AgradCdfLogBeta_ffv_110;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_111> AgradCdfLogBeta_ffv_111;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_112> AgradCdfLogBeta_ffv_112;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_113> AgradCdfLogBeta_ffv_113;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_114> AgradCdfLogBeta_ffv_114;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_115> AgradCdfLogBeta_ffv_115;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_116> AgradCdfLogBeta_ffv_116;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_117> AgradCdfLogBeta_ffv_117;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_118> AgradCdfLogBeta_ffv_118;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_119> AgradCdfLogBeta_ffv_119;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_120> AgradCdfLogBeta_ffv_120;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_121> AgradCdfLogBeta_ffv_121;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_122> AgradCdfLogBeta_ffv_122;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_123> AgradCdfLogBeta_ffv_123;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_124> AgradCdfLogBeta_ffv_124;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_125> AgradCdfLogBeta_ffv_125;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_126> AgradCdfLogBeta_ffv_126;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_127> AgradCdfLogBeta_ffv_127;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_128> AgradCdfLogBeta_ffv_128;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_129> AgradCdfLogBeta_ffv_129;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_130> AgradCdfLogBeta_ffv_130;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_131> AgradCdfLogBeta_ffv_131;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_132> AgradCdfLogBeta_ffv_132;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_133> AgradCdfLogBeta_ffv_133;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_134> AgradCdfLogBeta_ffv_134;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_135> AgradCdfLogBeta_ffv_135;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_136> AgradCdfLogBeta_ffv_136;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_137> AgradCdfLogBeta_ffv_137;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_138> AgradCdfLogBeta_ffv_138;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_139> AgradCdfLogBeta_ffv_139;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_140> AgradCdfLogBeta_ffv_140;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_141> AgradCdfLogBeta_ffv_141;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_142> AgradCdfLogBeta_ffv_142;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_143> AgradCdfLogBeta_ffv_143;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_144> AgradCdfLogBeta_ffv_144;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_145> AgradCdfLogBeta_ffv_145;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_146> AgradCdfLogBeta_ffv_146;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_147> AgradCdfLogBeta_ffv_147;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_148> AgradCdfLogBeta_ffv_148;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_149> AgradCdfLogBeta_ffv_149;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_150> AgradCdfLogBeta_ffv_150;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_151> AgradCdfLogBeta_ffv_151;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_152> AgradCdfLogBeta_ffv_152;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_153> AgradCdfLogBeta_ffv_153;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_154> AgradCdfLogBeta_ffv_154;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_155> AgradCdfLogBeta_ffv_155;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_156> AgradCdfLogBeta_ffv_156;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_157> AgradCdfLogBeta_ffv_157;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_158> AgradCdfLogBeta_ffv_158;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_159> AgradCdfLogBeta_ffv_159;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_160> AgradCdfLogBeta_ffv_160;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_161> AgradCdfLogBeta_ffv_161;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_162> AgradCdfLogBeta_ffv_162;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_163> AgradCdfLogBeta_ffv_163;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_164> AgradCdfLogBeta_ffv_164;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_165> AgradCdfLogBeta_ffv_165;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_166> AgradCdfLogBeta_ffv_166;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_167> AgradCdfLogBeta_ffv_167;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_168> AgradCdfLogBeta_ffv_168;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_169> AgradCdfLogBeta_ffv_169;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_170> AgradCdfLogBeta_ffv_170;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_171> AgradCdfLogBeta_ffv_171;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_172> AgradCdfLogBeta_ffv_172;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_173> AgradCdfLogBeta_ffv_173;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_174> AgradCdfLogBeta_ffv_174;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_175> AgradCdfLogBeta_ffv_175;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_176> AgradCdfLogBeta_ffv_176;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_177> AgradCdfLogBeta_ffv_177;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_178> AgradCdfLogBeta_ffv_178;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_179> AgradCdfLogBeta_ffv_179;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_180> AgradCdfLogBeta_ffv_180;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_181> AgradCdfLogBeta_ffv_181;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_182> AgradCdfLogBeta_ffv_182;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_183> AgradCdfLogBeta_ffv_183;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_184> AgradCdfLogBeta_ffv_184;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_185> AgradCdfLogBeta_ffv_185;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_186> AgradCdfLogBeta_ffv_186;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_187> AgradCdfLogBeta_ffv_187;
+typedef std::tuple<AgradCdfLogBeta, type_ffv_188> AgradCdfLogBeta_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_100, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_101, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_102, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_103, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_104, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_105, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_106, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_107, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_108, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_109, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_110, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_111, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_112, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_113, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_114, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_115, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_116, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_117, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_118, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_119, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_120, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_121, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_122, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_123, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_124, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_125, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_126, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_127, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_128, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_129, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_130, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_131, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_132, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_133, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_134, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_135, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_136, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_137, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_138, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_139, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_140, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_141, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_142, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_143, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_144, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_145, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_146, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_147, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_148, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_149, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_150, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_151, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_152, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_153, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_154, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_155, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_156, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_157, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_158, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_159, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_160, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_161, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_162, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_163, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_164, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_165, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_166, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_167, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_168, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_169, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_170, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_171, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_172, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_173, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_174, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_175, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_176, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_177, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_178, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_179, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_180, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_181, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_182, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_183, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_184, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_185, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_186, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_187, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_ffv_188, AgradCdfLogTestFixture, AgradCdfLogBeta_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogBeta, type_v_100> AgradCdfLogBeta_v_100;
+typedef std::tuple<AgradCdfLogBeta, type_v_101> AgradCdfLogBeta_v_101;
+typedef std::tuple<AgradCdfLogBeta, type_v_102> AgradCdfLogBeta_v_102;
+typedef std::tuple<AgradCdfLogBeta, type_v_103> AgradCdfLogBeta_v_103;
+typedef std::tuple<AgradCdfLogBeta, type_v_104> AgradCdfLogBeta_v_104;
+typedef std::tuple<AgradCdfLogBeta, type_v_105> AgradCdfLogBeta_v_105;
+typedef std::tuple<AgradCdfLogBeta, type_v_106> AgradCdfLogBeta_v_106;
+typedef std::tuple<AgradCdfLogBeta, type_v_107> AgradCdfLogBeta_v_107;
+typedef std::tuple<AgradCdfLogBeta, type_v_108> AgradCdfLogBeta_v_108;
+typedef std::tuple<AgradCdfLogBeta, type_v_109> AgradCdfLogBeta_v_109;
+typedef std::tuple<AgradCdfLogBeta, type_v_110> AgradCdfLogBeta_v_110;
+typedef std::tuple<AgradCdfLogBeta, type_v_111> AgradCdfLogBeta_v_111;
+typedef std::tuple<AgradCdfLogBeta, type_v_112> AgradCdfLogBeta_v_112;
+typedef std::tuple<AgradCdfLogBeta, type_v_113> AgradCdfLogBeta_v_113;
+typedef std::tuple<AgradCdfLogBeta, type_v_114> AgradCdfLogBeta_v_114;
+typedef std::tuple<AgradCdfLogBeta, type_v_115> AgradCdfLogBeta_v_115;
+typedef std::tuple<AgradCdfLogBeta, type_v_116> AgradCdfLogBeta_v_116;
+typedef std::tuple<AgradCdfLogBeta, type_v_117> AgradCdfLogBeta_v_117;
+typedef std::tuple<AgradCdfLogBeta, type_v_118> AgradCdfLogBeta_v_118;
+typedef std::tuple<AgradCdfLogBeta, type_v_119> AgradCdfLogBeta_v_119;
+typedef std::tuple<AgradCdfLogBeta, type_v_120> AgradCdfLogBeta_v_120;
+typedef std::tuple<AgradCdfLogBeta, type_v_121> AgradCdfLogBeta_v_121;
+typedef std::tuple<AgradCdfLogBeta, type_v_122> AgradCdfLogBeta_v_122;
+typedef std::tuple<AgradCdfLogBeta, type_v_123> AgradCdfLogBeta_v_123;
+typedef std::tuple<AgradCdfLogBeta, type_v_124> AgradCdfLogBeta_v_124;
+typedef std::tuple<AgradCdfLogBeta, type_v_125> AgradCdfLogBeta_v_125;
+typedef std::tuple<AgradCdfLogBeta, type_v_126> AgradCdfLogBeta_v_126;
+typedef std::tuple<AgradCdfLogBeta, type_v_127> AgradCdfLogBeta_v_127;
+typedef std::tuple<AgradCdfLogBeta, type_v_128> AgradCdfLogBeta_v_128;
+typedef std::tuple<AgradCdfLogBeta, type_v_129> AgradCdfLogBeta_v_129;
+typedef std::tuple<AgradCdfLogBeta, type_v_130> AgradCdfLogBeta_v_130;
+typedef std::tuple<AgradCdfLogBeta, type_v_131> AgradCdfLogBeta_v_131;
+typedef std::tuple<AgradCdfLogBeta, type_v_132> AgradCdfLogBeta_v_132;
+typedef std::tuple<AgradCdfLogBeta, type_v_133> AgradCdfLogBeta_v_133;
+typedef std::tuple<AgradCdfLogBeta, type_v_134> AgradCdfLogBeta_v_134;
+typedef std::tuple<AgradCdfLogBeta, type_v_135> AgradCdfLogBeta_v_135;
+typedef std::tuple<AgradCdfLogBeta, type_v_136> AgradCdfLogBeta_v_136;
+typedef std::tuple<AgradCdfLogBeta, type_v_137> AgradCdfLogBeta_v_137;
+typedef std::tuple<AgradCdfLogBeta, type_v_138> AgradCdfLogBeta_v_138;
+typedef std::tuple<AgradCdfLogBeta, type_v_139> AgradCdfLogBeta_v_139;
+typedef std::tuple<AgradCdfLogBeta, type_v_140> AgradCdfLogBeta_v_140;
+typedef std::tuple<AgradCdfLogBeta, type_v_141> AgradCdfLogBeta_v_141;
+typedef std::tuple<AgradCdfLogBeta, type_v_142> AgradCdfLogBeta_v_142;
+typedef std::tuple<AgradCdfLogBeta, type_v_143> AgradCdfLogBeta_v_143;
+typedef std::tuple<AgradCdfLogBeta, type_v_144> AgradCdfLogBeta_v_144;
+typedef std::tuple<AgradCdfLogBeta, type_v_145> AgradCdfLogBeta_v_145;
+typedef std::tuple<AgradCdfLogBeta, type_v_146> AgradCdfLogBeta_v_146;
+typedef std::tuple<AgradCdfLogBeta, type_v_147> AgradCdfLogBeta_v_147;
+typedef std::tuple<AgradCdfLogBeta, type_v_148> AgradCdfLogBeta_v_148;
+typedef std::tuple<AgradCdfLogBeta, type_v_149> AgradCdfLogBeta_v_149;
+typedef std::tuple<AgradCdfLogBeta, type_v_150> AgradCdfLogBeta_v_150;
+typedef std::tuple<AgradCdfLogBeta, type_v_151> AgradCdfLogBeta_v_151;
+typedef std::tuple<AgradCdfLogBeta, type_v_152> AgradCdfLogBeta_v_152;
+typedef std::tuple<AgradCdfLogBeta, type_v_153> AgradCdfLogBeta_v_153;
+typedef std::tuple<AgradCdfLogBeta, type_v_154> AgradCdfLogBeta_v_154;
+typedef std::tuple<AgradCdfLogBeta, type_v_155> AgradCdfLogBeta_v_155;
+typedef std::tuple<AgradCdfLogBeta, type_v_156> AgradCdfLogBeta_v_156;
+typedef std::tuple<AgradCdfLogBeta, type_v_157> AgradCdfLogBeta_v_157;
+typedef std::tuple<AgradCdfLogBeta, type_v_158> AgradCdfLogBeta_v_158;
+typedef std::tuple<AgradCdfLogBeta, type_v_159> AgradCdfLogBeta_v_159;
+typedef std::tuple<AgradCdfLogBeta, type_v_160> AgradCdfLogBeta_v_160;
+typedef std::tuple<AgradCdfLogBeta, type_v_161> AgradCdfLogBeta_v_161;
+typedef std::tuple<AgradCdfLogBeta, type_v_162> AgradCdfLogBeta_v_162;
+typedef std::tuple<AgradCdfLogBeta, type_v_163> AgradCdfLogBeta_v_163;
+typedef std::tuple<AgradCdfLogBeta, type_v_164> AgradCdfLogBeta_v_164;
+typedef std::tuple<AgradCdfLogBeta, type_v_165> AgradCdfLogBeta_v_165;
+typedef std::tuple<AgradCdfLogBeta, type_v_166> AgradCdfLogBeta_v_166;
+typedef std::tuple<AgradCdfLogBeta, type_v_167> AgradCdfLogBeta_v_167;
+typedef std::tuple<AgradCdfLogBeta, type_v_168> AgradCdfLogBeta_v_168;
+typedef std::tuple<AgradCdfLogBeta, type_v_169> AgradCdfLogBeta_v_169;
+typedef std::tuple<AgradCdfLogBeta, type_v_170> AgradCdfLogBeta_v_170;
+typedef std::tuple<AgradCdfLogBeta, type_v_171> AgradCdfLogBeta_v_171;
+typedef std::tuple<AgradCdfLogBeta, type_v_172> AgradCdfLogBeta_v_172;
+typedef std::tuple<AgradCdfLogBeta, type_v_173> AgradCdfLogBeta_v_173;
+typedef std::tuple<AgradCdfLogBeta, type_v_174> AgradCdfLogBeta_v_174;
+typedef std::tuple<AgradCdfLogBeta, type_v_175> AgradCdfLogBeta_v_175;
+typedef std::tuple<AgradCdfLogBeta, type_v_176> AgradCdfLogBeta_v_176;
+typedef std::tuple<AgradCdfLogBeta, type_v_177> AgradCdfLogBeta_v_177;
+typedef std::tuple<AgradCdfLogBeta, type_v_178> AgradCdfLogBeta_v_178;
+typedef std::tuple<AgradCdfLogBeta, type_v_179> AgradCdfLogBeta_v_179;
+typedef std::tuple<AgradCdfLogBeta, type_v_180> AgradCdfLogBeta_v_180;
+typedef std::tuple<AgradCdfLogBeta, type_v_181> AgradCdfLogBeta_v_181;
+typedef std::tuple<AgradCdfLogBeta, type_v_182> AgradCdfLogBeta_v_182;
+typedef std::tuple<AgradCdfLogBeta, type_v_183> AgradCdfLogBeta_v_183;
+typedef std::tuple<AgradCdfLogBeta, type_v_184> AgradCdfLogBeta_v_184;
+typedef std::tuple<AgradCdfLogBeta, type_v_185> AgradCdfLogBeta_v_185;
+typedef std::tuple<AgradCdfLogBeta, type_v_186> AgradCdfLogBeta_v_186;
+typedef std::tuple<AgradCdfLogBeta, type_v_187> AgradCdfLogBeta_v_187;
+typedef std::tuple<AgradCdfLogBeta, type_v_188> AgradCdfLogBeta_v_188;
+typedef std::tuple<AgradCdfLogBeta, type_v_189> AgradCdfLogBeta_v_189;
+typedef std::tuple<AgradCdfLogBeta, type_v_190> AgradCdfLogBeta_v_190;
+typedef std::tuple<AgradCdfLogBeta, type_v_191> AgradCdfLogBeta_v_191;
+typedef std::tuple<AgradCdfLogBeta, type_v_192> AgradCdfLogBeta_v_192;
+typedef std::tuple<AgradCdfLogBeta, type_v_193> AgradCdfLogBeta_v_193;
+typedef std::tuple<AgradCdfLogBeta, type_v_194> AgradCdfLogBeta_v_194;
+typedef std::tuple<AgradCdfLogBeta, type_v_195> AgradCdfLogBeta_v_195;
+typedef std::tuple<AgradCdfLogBeta, type_v_196> AgradCdfLogBeta_v_196;
+typedef std::tuple<AgradCdfLogBeta, type_v_197> AgradCdfLogBeta_v_197;
+typedef std::tuple<AgradCdfLogBeta, type_v_198> AgradCdfLogBeta_v_198;
+typedef std::tuple<AgradCdfLogBeta, type_v_199> AgradCdfLogBeta_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_100, AgradCdfLogTestFixture, AgradCdfLogBeta_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_101, AgradCdfLogTestFixture, AgradCdfLogBeta_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_102, AgradCdfLogTestFixture, AgradCdfLogBeta_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_103, AgradCdfLogTestFixture, AgradCdfLogBeta_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_104, AgradCdfLogTestFixture, AgradCdfLogBeta_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_105, AgradCdfLogTestFixture, AgradCdfLogBeta_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_106, AgradCdfLogTestFixture, AgradCdfLogBeta_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_107, AgradCdfLogTestFixture, AgradCdfLogBeta_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_108, AgradCdfLogTestFixture, AgradCdfLogBeta_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_109, AgradCdfLogTestFixture, AgradCdfLogBeta_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_110, AgradCdfLogTestFixture, AgradCdfLogBeta_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_111, AgradCdfLogTestFixture, AgradCdfLogBeta_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_112, AgradCdfLogTestFixture, AgradCdfLogBeta_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_113, AgradCdfLogTestFixture, AgradCdfLogBeta_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_114, AgradCdfLogTestFixture, AgradCdfLogBeta_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_115, AgradCdfLogTestFixture, AgradCdfLogBeta_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_116, AgradCdfLogTestFixture, AgradCdfLogBeta_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_117, AgradCdfLogTestFixture, AgradCdfLogBeta_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_118, AgradCdfLogTestFixture, AgradCdfLogBeta_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_119, AgradCdfLogTestFixture, AgradCdfLogBeta_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_120, AgradCdfLogTestFixture, AgradCdfLogBeta_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_121, AgradCdfLogTestFixture, AgradCdfLogBeta_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_122, AgradCdfLogTestFixture, AgradCdfLogBeta_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_123, AgradCdfLogTestFixture, AgradCdfLogBeta_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_124, AgradCdfLogTestFixture, AgradCdfLogBeta_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_125, AgradCdfLogTestFixture, AgradCdfLogBeta_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_126, AgradCdfLogTestFixture, AgradCdfLogBeta_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_127, AgradCdfLogTestFixture, AgradCdfLogBeta_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_128, AgradCdfLogTestFixture, AgradCdfLogBeta_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_129, AgradCdfLogTestFixture, AgradCdfLogBeta_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_130, AgradCdfLogTestFixture, AgradCdfLogBeta_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_131, AgradCdfLogTestFixture, AgradCdfLogBeta_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_132, AgradCdfLogTestFixture, AgradCdfLogBeta_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_133, AgradCdfLogTestFixture, AgradCdfLogBeta_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_134, AgradCdfLogTestFixture, AgradCdfLogBeta_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_135, AgradCdfLogTestFixture, AgradCdfLogBeta_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_136, AgradCdfLogTestFixture, AgradCdfLogBeta_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_137, AgradCdfLogTestFixture, AgradCdfLogBeta_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_138, AgradCdfLogTestFixture, AgradCdfLogBeta_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_139, AgradCdfLogTestFixture, AgradCdfLogBeta_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_140, AgradCdfLogTestFixture, AgradCdfLogBeta_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_141, AgradCdfLogTestFixture, AgradCdfLogBeta_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_142, AgradCdfLogTestFixture, AgradCdfLogBeta_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_143, AgradCdfLogTestFixture, AgradCdfLogBeta_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_144, AgradCdfLogTestFixture, AgradCdfLogBeta_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_145, AgradCdfLogTestFixture, AgradCdfLogBeta_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_146, AgradCdfLogTestFixture, AgradCdfLogBeta_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_147, AgradCdfLogTestFixture, AgradCdfLogBeta_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_148, AgradCdfLogTestFixture, AgradCdfLogBeta_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_149, AgradCdfLogTestFixture, AgradCdfLogBeta_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_150, AgradCdfLogTestFixture, AgradCdfLogBeta_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_151, AgradCdfLogTestFixture, AgradCdfLogBeta_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_152, AgradCdfLogTestFixture, AgradCdfLogBeta_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_153, AgradCdfLogTestFixture, AgradCdfLogBeta_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_154, AgradCdfLogTestFixture, AgradCdfLogBeta_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_155, AgradCdfLogTestFixture, AgradCdfLogBeta_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_156, AgradCdfLogTestFixture, AgradCdfLogBeta_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_157, AgradCdfLogTestFixture, AgradCdfLogBeta_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_158, AgradCdfLogTestFixture, AgradCdfLogBeta_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_159, AgradCdfLogTestFixture, AgradCdfLogBeta_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_160, AgradCdfLogTestFixture, AgradCdfLogBeta_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_161, AgradCdfLogTestFixture, AgradCdfLogBeta_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_162, AgradCdfLogTestFixture, AgradCdfLogBeta_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_163, AgradCdfLogTestFixture, AgradCdfLogBeta_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_164, AgradCdfLogTestFixture, AgradCdfLogBeta_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_165, AgradCdfLogTestFixture, AgradCdfLogBeta_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_166, AgradCdfLogTestFixture, AgradCdfLogBeta_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_167, AgradCdfLogTestFixture, AgradCdfLogBeta_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_168, AgradCdfLogTestFixture, AgradCdfLogBeta_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_169, AgradCdfLogTestFixture, AgradCdfLogBeta_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_170, AgradCdfLogTestFixture, AgradCdfLogBeta_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_171, AgradCdfLogTestFixture, AgradCdfLogBeta_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_172, AgradCdfLogTestFixture, AgradCdfLogBeta_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_173, AgradCdfLogTestFixture, AgradCdfLogBeta_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_174, AgradCdfLogTestFixture, AgradCdfLogBeta_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_175, AgradCdfLogTestFixture, AgradCdfLogBeta_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_176, AgradCdfLogTestFixture, AgradCdfLogBeta_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_177, AgradCdfLogTestFixture, AgradCdfLogBeta_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_178, AgradCdfLogTestFixture, AgradCdfLogBeta_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_179, AgradCdfLogTestFixture, AgradCdfLogBeta_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_180, AgradCdfLogTestFixture, AgradCdfLogBeta_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_181, AgradCdfLogTestFixture, AgradCdfLogBeta_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_182, AgradCdfLogTestFixture, AgradCdfLogBeta_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_183, AgradCdfLogTestFixture, AgradCdfLogBeta_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_184, AgradCdfLogTestFixture, AgradCdfLogBeta_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_185, AgradCdfLogTestFixture, AgradCdfLogBeta_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_186, AgradCdfLogTestFixture, AgradCdfLogBeta_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_187, AgradCdfLogTestFixture, AgradCdfLogBeta_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_188, AgradCdfLogTestFixture, AgradCdfLogBeta_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_189, AgradCdfLogTestFixture, AgradCdfLogBeta_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_190, AgradCdfLogTestFixture, AgradCdfLogBeta_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_191, AgradCdfLogTestFixture, AgradCdfLogBeta_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_192, AgradCdfLogTestFixture, AgradCdfLogBeta_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_193, AgradCdfLogTestFixture, AgradCdfLogBeta_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_194, AgradCdfLogTestFixture, AgradCdfLogBeta_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_195, AgradCdfLogTestFixture, AgradCdfLogBeta_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_196, AgradCdfLogTestFixture, AgradCdfLogBeta_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_197, AgradCdfLogTestFixture, AgradCdfLogBeta_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_198, AgradCdfLogTestFixture, AgradCdfLogBeta_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_199, AgradCdfLogTestFixture, AgradCdfLogBeta_v_199);
+
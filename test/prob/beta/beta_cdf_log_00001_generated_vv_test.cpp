@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogBeta, type_vv_100> AgradCdfLogBeta_vv_100;
+typedef std::tuple<AgradCdfLogBeta, type_vv_101> AgradCdfLogBeta_vv_101;
+typedef std::tuple<AgradCdfLogBeta, type_vv_102> AgradCdfLogBeta_vv_102;
+typedef std::tuple<AgradCdfLogBeta, type_vv_103> AgradCdfLogBeta_vv_103;
+typedef std::tuple<AgradCdfLogBeta, type_vv_104> AgradCdfLogBeta_vv_104;
+typedef std::tuple<AgradCdfLogBeta, type_vv_105> AgradCdfLogBeta_vv_105;
+typedef std::tuple<AgradCdfLogBeta, type_vv_106> AgradCdfLogBeta_vv_106;
+typedef std::tuple<AgradCdfLogBeta, type_vv_107> AgradCdfLogBeta_vv_107;
+typedef std::tuple<AgradCdfLogBeta, type_vv_108> AgradCdfLogBeta_vv_108;
+typedef std::tuple<AgradCdfLogBeta, type_vv_109> AgradCdfLogBeta_vv_109;
+typedef std::tuple<AgradCdfLogBeta, type_vv_110> AgradCdfLogBeta_vv_110;
+typedef std::tuple<AgradCdfLogBeta, type_vv_111> AgradCdfLogBeta_vv_111;
+typedef std::tuple<AgradCdfLogBeta, type_vv_112> AgradCdfLogBeta_vv_112;
+typedef std::tuple<AgradCdfLogBeta, type_vv_113> AgradCdfLogBeta_vv_113;
+typedef std::tuple<AgradCdfLogBeta, type_vv_114> AgradCdfLogBeta_vv_114;
+typedef std::tuple<AgradCdfLogBeta, type_vv_115> AgradCdfLogBeta_vv_115;
+typedef std::tuple<AgradCdfLogBeta, type_vv_116> AgradCdfLogBeta_vv_116;
+typedef std::tuple<AgradCdfLogBeta, type_vv_117> AgradCdfLogBeta_vv_117;
+typedef std::tuple<AgradCdfLogBeta, type_vv_118> AgradCdfLogBeta_vv_118;
+typedef std::tuple<AgradCdfLogBeta, type_vv_119> AgradCdfLogBeta_vv_119;
+typedef std::tuple<AgradCdfLogBeta, type_vv_120> AgradCdfLogBeta_vv_120;
+typedef std::tuple<AgradCdfLogBeta, type_vv_121> AgradCdfLogBeta_vv_121;
+typedef std::tuple<AgradCdfLogBeta, type_vv_122> AgradCdfLogBeta_vv_122;
+typedef std::tuple<AgradCdfLogBeta, type_vv_123> AgradCdfLogBeta_vv_123;
+typedef std::tuple<AgradCdfLogBeta, type_vv_124> AgradCdfLogBeta_vv_124;
+typedef std::tuple<AgradCdfLogBeta, type_vv_125> AgradCdfLogBeta_vv_125;
+typedef std::tuple<AgradCdfLogBeta, type_vv_126> AgradCdfLogBeta_vv_126;
+typedef std::tuple<AgradCdfLogBeta, type_vv_127> AgradCdfLogBeta_vv_127;
+typedef std::tuple<AgradCdfLogBeta, type_vv_128> AgradCdfLogBeta_vv_128;
+typedef std::tuple<AgradCdfLogBeta, type_vv_129> AgradCdfLogBeta_vv_129;
+typedef std::tuple<AgradCdfLogBeta, type_vv_130> AgradCdfLogBeta_vv_130;
+typedef std::tuple<AgradCdfLogBeta, type_vv_131> AgradCdfLogBeta_vv_131;
+typedef std::tuple<AgradCdfLogBeta, type_vv_132> AgradCdfLogBeta_vv_132;
+typedef std::tuple<AgradCdfLogBeta, type_vv_133> AgradCdfLogBeta_vv_133;
+typedef std::tuple<AgradCdfLogBeta, type_vv_134> AgradCdfLogBeta_vv_134;
+typedef std::tuple<AgradCdfLogBeta, type_vv_135> AgradCdfLogBeta_vv_135;
+typedef std::tuple<AgradCdfLogBeta, type_vv_136> AgradCdfLogBeta_vv_136;
+typedef std::tuple<AgradCdfLogBeta, type_vv_137> AgradCdfLogBeta_vv_137;
+typedef std::tuple<AgradCdfLogBeta, type_vv_138> AgradCdfLogBeta_vv_138;
+typedef std::tuple<AgradCdfLogBeta, type_vv_139> AgradCdfLogBeta_vv_139;
+typedef std::tuple<AgradCdfLogBeta, type_vv_140> AgradCdfLogBeta_vv_140;
+typedef std::tuple<AgradCdfLogBeta, type_vv_141> AgradCdfLogBeta_vv_141;
+typedef std::tuple<AgradCdfLogBeta, type_vv_142> AgradCdfLogBeta_vv_142;
+typedef std::tuple<AgradCdfLogBeta, type_vv_143> AgradCdfLogBeta_vv_143;
+typedef std::tuple<AgradCdfLogBeta, type_vv_144> AgradCdfLogBeta_vv_144;
+typedef std::tuple<AgradCdfLogBeta, type_vv_145> AgradCdfLogBeta_vv_145;
+typedef std::tuple<AgradCdfLogBeta, type_vv_146> AgradCdfLogBeta_vv_146;
+typedef std::tuple<AgradCdfLogBeta, type_vv_147> AgradCdfLogBeta_vv_147;
+typedef std::tuple<AgradCdfLogBeta, type_vv_148> AgradCdfLogBeta_vv_148;
+typedef std::tuple<AgradCdfLogBeta, type_vv_149> AgradCdfLogBeta_vv_149;
+typedef std::tuple<AgradCdfLogBeta, type_vv_150> AgradCdfLogBeta_vv_150;
+typedef std::tuple<AgradCdfLogBeta, type_vv_151> AgradCdfLogBeta_vv_151;
+typedef std::tuple<AgradCdfLogBeta, type_vv_152> AgradCdfLogBeta_vv_152;
+typedef std::tuple<AgradCdfLogBeta, type_vv_153> AgradCdfLogBeta_vv_153;
+typedef std::tuple<AgradCdfLogBeta, type_vv_154> AgradCdfLogBeta_vv_154;
+typedef std::tuple<AgradCdfLogBeta, type_vv_155> AgradCdfLogBeta_vv_155;
+typedef std::tuple<AgradCdfLogBeta, type_vv_156> AgradCdfLogBeta_vv_156;
+typedef std::tuple<AgradCdfLogBeta, type_vv_157> AgradCdfLogBeta_vv_157;
+typedef std::tuple<AgradCdfLogBeta, type_vv_158> AgradCdfLogBeta_vv_158;
+typedef std::tuple<AgradCdfLogBeta, type_vv_159> AgradCdfLogBeta_vv_159;
+typedef std::tuple<AgradCdfLogBeta, type_vv_160> AgradCdfLogBeta_vv_160;
+typedef std::tuple<AgradCdfLogBeta, type_vv_161> AgradCdfLogBeta_vv_161;
+typedef std::tuple<AgradCdfLogBeta, type_vv_162> AgradCdfLogBeta_vv_162;
+typedef std::tuple<AgradCdfLogBeta, type_vv_163> AgradCdfLogBeta_vv_163;
+typedef std::tuple<AgradCdfLogBeta, type_vv_164> AgradCdfLogBeta_vv_164;
+typedef std::tuple<AgradCdfLogBeta, type_vv_165> AgradCdfLogBeta_vv_165;
+typedef std::tuple<AgradCdfLogBeta, type_vv_166> AgradCdfLogBeta_vv_166;
+typedef std::tuple<AgradCdfLogBeta, type_vv_167> AgradCdfLogBeta_vv_167;
+typedef std::tuple<AgradCdfLogBeta, type_vv_168> AgradCdfLogBeta_vv_168;
+typedef std::tuple<AgradCdfLogBeta, type_vv_169> AgradCdfLogBeta_vv_169;
+typedef std::tuple<AgradCdfLogBeta, type_vv_170> AgradCdfLogBeta_vv_170;
+typedef std::tuple<AgradCdfLogBeta, type_vv_171> AgradCdfLogBeta_vv_171;
+typedef std::tuple<AgradCdfLogBeta, type_vv_172> AgradCdfLogBeta_vv_172;
+typedef std::tuple<AgradCdfLogBeta, type_vv_173> AgradCdfLogBeta_vv_173;
+typedef std::tuple<AgradCdfLogBeta, type_vv_174> AgradCdfLogBeta_vv_174;
+typedef std::tuple<AgradCdfLogBeta, type_vv_175> AgradCdfLogBeta_vv_175;
+typedef std::tuple<AgradCdfLogBeta, type_vv_176> AgradCdfLogBeta_vv_176;
+typedef std::tuple<AgradCdfLogBeta, type_vv_177> AgradCdfLogBeta_vv_177;
+typedef std::tuple<AgradCdfLogBeta, type_vv_178> AgradCdfLogBeta_vv_178;
+typedef std::tuple<AgradCdfLogBeta, type_vv_179> AgradCdfLogBeta_vv_179;
+typedef std::tuple<AgradCdfLogBeta, type_vv_180> AgradCdfLogBeta_vv_180;
+typedef std::tuple<AgradCdfLogBeta, type_vv_181> AgradCdfLogBeta_vv_181;
+typedef std::tuple<AgradCdfLogBeta, type_vv_182> AgradCdfLogBeta_vv_182;
+typedef std::tuple<AgradCdfLogBeta, type_vv_183> AgradCdfLogBeta_vv_183;
+typedef std::tuple<AgradCdfLogBeta, type_vv_184> AgradCdfLogBeta_vv_184;
+typedef std::tuple<AgradCdfLogBeta, type_vv_185> AgradCdfLogBeta_vv_185;
+typedef std::tuple<AgradCdfLogBeta, type_vv_186> AgradCdfLogBeta_vv_186;
+typedef std::tuple<AgradCdfLogBeta, type_vv_187> AgradCdfLogBeta_vv_187;
+typedef std::tuple<AgradCdfLogBeta, type_vv_188> AgradCdfLogBeta_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_100, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_101, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_102, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_103, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_104, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_105, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_106, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_107, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_108, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_109, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_110, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_111, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_112, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_113, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_114, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_115, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_116, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_117, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_118, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_119, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_120, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_121, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_122, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_123, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_124, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_125, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_126, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_127, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_128, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_129, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_130, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_131, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_132, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_133, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_134, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_135, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_136, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_137, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_138, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_139, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_140, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_141, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_142, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_143, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_144, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_145, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_146, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_147, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_148, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_149, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_150, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_151, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_152, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_153, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_154, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_155, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_156, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_157, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_158, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_159, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_160, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_161, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_162, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_163, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_164, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_165, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_166, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_167, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_168, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_169, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_170, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_171, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_172, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_173, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_174, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_175, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_176, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_177, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_178, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_179, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_180, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_181, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_182, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_183, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_184, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_185, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_186, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_187, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_vv_188, AgradCdfLogTestFixture, AgradCdfLogBeta_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta/beta_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCdfLogBeta, type_v_200> AgradCdfLogBeta_v_200;
+typedef std::tuple<AgradCdfLogBeta, type_v_201> AgradCdfLogBeta_v_201;
+typedef std::tuple<AgradCdfLogBeta, type_v_202> AgradCdfLogBeta_v_202;
+typedef std::tuple<AgradCdfLogBeta, type_v_203> AgradCdfLogBeta_v_203;
+typedef std::tuple<AgradCdfLogBeta, type_v_204> AgradCdfLogBeta_v_204;
+typedef std::tuple<AgradCdfLogBeta, type_v_205> AgradCdfLogBeta_v_205;
+typedef std::tuple<AgradCdfLogBeta, type_v_206> AgradCdfLogBeta_v_206;
+typedef std::tuple<AgradCdfLogBeta, type_v_207> AgradCdfLogBeta_v_207;
+typedef std::tuple<AgradCdfLogBeta, type_v_208> AgradCdfLogBeta_v_208;
+typedef std::tuple<AgradCdfLogBeta, type_v_209> AgradCdfLogBeta_v_209;
+typedef std::tuple<AgradCdfLogBeta, type_v_210> AgradCdfLogBeta_v_210;
+typedef std::tuple<AgradCdfLogBeta, type_v_211> AgradCdfLogBeta_v_211;
+typedef std::tuple<AgradCdfLogBeta, type_v_212> AgradCdfLogBeta_v_212;
+typedef std::tuple<AgradCdfLogBeta, type_v_213> AgradCdfLogBeta_v_213;
+typedef std::tuple<AgradCdfLogBeta, type_v_214> AgradCdfLogBeta_v_214;
+typedef std::tuple<AgradCdfLogBeta, type_v_215> AgradCdfLogBeta_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_200, AgradCdfLogTestFixture, AgradCdfLogBeta_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_201, AgradCdfLogTestFixture, AgradCdfLogBeta_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_202, AgradCdfLogTestFixture, AgradCdfLogBeta_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_203, AgradCdfLogTestFixture, AgradCdfLogBeta_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_204, AgradCdfLogTestFixture, AgradCdfLogBeta_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_205, AgradCdfLogTestFixture, AgradCdfLogBeta_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_206, AgradCdfLogTestFixture, AgradCdfLogBeta_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_207, AgradCdfLogTestFixture, AgradCdfLogBeta_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_208, AgradCdfLogTestFixture, AgradCdfLogBeta_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_209, AgradCdfLogTestFixture, AgradCdfLogBeta_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_210, AgradCdfLogTestFixture, AgradCdfLogBeta_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_211, AgradCdfLogTestFixture, AgradCdfLogBeta_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_212, AgradCdfLogTestFixture, AgradCdfLogBeta_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_213, AgradCdfLogTestFixture, AgradCdfLogBeta_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_214, AgradCdfLogTestFixture, AgradCdfLogBeta_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBeta_v_215, AgradCdfLogTestFixture, AgradCdfLogBeta_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_test.hpp>
+
+typedef std::tuple<int, int, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<int, int, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<int, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<int, int, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<int, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<int, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<int, int, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<int, int, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<int, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<int, int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<int, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<int, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<int, std::vector<int>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<int, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<int, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<std::vector<int>, int, double, fvar<fvar<var> >, empty, empty> type_ffv_81;
+typedef std::tuple<std::vector<int>, int, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_82;
+typedef std::tuple<std::vector<int>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_87;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_88;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, double, empty, empty> type_ffv_90;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_91;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_93;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_94;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_96;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_97;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_0> AgradDistributionsBetaBinomial_ffv_0;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_1> AgradDistributionsBetaBinomial_ffv_1;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_2> AgradDistributionsBetaBinomial_ffv_2;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_3> AgradDistributionsBetaBinomial_ffv_3;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_4> AgradDistributionsBetaBinomial_ffv_4;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_5> AgradDistributionsBetaBinomial_ffv_5;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_6> AgradDistributionsBetaBinomial_ffv_6;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_7> AgradDistributionsBetaBinomial_ffv_7;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_8> AgradDistributionsBetaBinomial_ffv_8;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_9> AgradDistributionsBetaBinomial_ffv_9;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_10> AgradDistributionsBetaBinomial_ffv_10;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_11> AgradDistributionsBetaBinomial_ffv_11;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_12> AgradDistributionsBetaBinomial_ffv_12;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_13> AgradDistributionsBetaBinomial_ffv_13;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_14> AgradDistributionsBetaBinomial_ffv_14;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_15> AgradDistributionsBetaBinomial_ffv_15;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_16> AgradDistributionsBetaBinomial_ffv_16;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_17> AgradDistributionsBetaBinomial_ffv_17;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_18> AgradDistributionsBetaBinomial_ffv_18;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_19> AgradDistributionsBetaBinomial_ffv_19;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_20> AgradDistributionsBetaBinomial_ffv_20;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_21> AgradDistributionsBetaBinomial_ffv_21;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_22> AgradDistributionsBetaBinomial_ffv_22;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_23> AgradDistributionsBetaBinomial_ffv_23;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_24> AgradDistributionsBetaBinomial_ffv_24;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_25> AgradDistributionsBetaBinomial_ffv_25;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_26> AgradDistributionsBetaBinomial_ffv_26;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_27> AgradDistributionsBetaBinomial_ffv_27;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_28> AgradDistributionsBetaBinomial_ffv_28;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_29> AgradDistributionsBetaBinomial_ffv_29;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_30> AgradDistributionsBetaBinomial_ffv_30;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_31> AgradDistributionsBetaBinomial_ffv_31;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_32> AgradDistributionsBetaBinomial_ffv_32;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_33> AgradDistributionsBetaBinomial_ffv_33;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_34> AgradDistributionsBetaBinomial_ffv_34;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_35> AgradDistributionsBetaBinomial_ffv_35;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_36> AgradDistributionsBetaBinomial_ffv_36;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_37> AgradDistributionsBetaBinomial_ffv_37;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_38> AgradDistributionsBetaBinomial_ffv_38;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_39> AgradDistributionsBetaBinomial_ffv_39;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_40> AgradDistributionsBetaBinomial_ffv_40;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_41> AgradDistributionsBetaBinomial_ffv_41;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_42> AgradDistributionsBetaBinomial_ffv_42;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_43> AgradDistributionsBetaBinomial_ffv_43;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_44> AgradDistributionsBetaBinomial_ffv_44;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_45> AgradDistributionsBetaBinomial_ffv_45;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_46> AgradDistributionsBetaBinomial_ffv_46;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_47> AgradDistributionsBetaBinomial_ffv_47;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_48> AgradDistributionsBetaBinomial_ffv_48;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_49> AgradDistributionsBetaBinomial_ffv_49;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_50> AgradDistributionsBetaBinomial_ffv_50;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_51> AgradDistributionsBetaBinomial_ffv_51;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_52> AgradDistributionsBetaBinomial_ffv_52;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_53> AgradDistributionsBetaBinomial_ffv_53;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_54> AgradDistributionsBetaBinomial_ffv_54;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_55> AgradDistributionsBetaBinomial_ffv_55;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_56> AgradDistributionsBetaBinomial_ffv_56;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_57> AgradDistributionsBetaBinomial_ffv_57;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_58> AgradDistributionsBetaBinomial_ffv_58;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_59> AgradDistributionsBetaBinomial_ffv_59;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_60> AgradDistributionsBetaBinomial_ffv_60;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_61> AgradDistributionsBetaBinomial_ffv_61;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_62> AgradDistributionsBetaBinomial_ffv_62;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_63> AgradDistributionsBetaBinomial_ffv_63;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_64> AgradDistributionsBetaBinomial_ffv_64;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_65> AgradDistributionsBetaBinomial_ffv_65;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_66> AgradDistributionsBetaBinomial_ffv_66;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_67> AgradDistributionsBetaBinomial_ffv_67;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_68> AgradDistributionsBetaBinomial_ffv_68;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_69> AgradDistributionsBetaBinomial_ffv_69;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_70> AgradDistributionsBetaBinomial_ffv_70;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_71> AgradDistributionsBetaBinomial_ffv_71;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_72> AgradDistributionsBetaBinomial_ffv_72;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_73> AgradDistributionsBetaBinomial_ffv_73;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_74> AgradDistributionsBetaBinomial_ffv_74;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_75> AgradDistributionsBetaBinomial_ffv_75;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_76> AgradDistributionsBetaBinomial_ffv_76;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_77> AgradDistributionsBetaBinomial_ffv_77;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_78> AgradDistributionsBetaBinomial_ffv_78;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_79> AgradDistributionsBetaBinomial_ffv_79;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_80> AgradDistributionsBetaBinomial_ffv_80;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_81> AgradDistributionsBetaBinomial_ffv_81;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_82> AgradDistributionsBetaBinomial_ffv_82;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_83> AgradDistributionsBetaBinomial_ffv_83;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_84> AgradDistributionsBetaBinomial_ffv_84;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_85> AgradDistributionsBetaBinomial_ffv_85;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_86> AgradDistributionsBetaBinomial_ffv_86;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_87> AgradDistributionsBetaBinomial_ffv_87;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_88> AgradDistributionsBetaBinomial_ffv_88;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_89> AgradDistributionsBetaBinomial_ffv_89;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_90> AgradDistributionsBetaBinomial_ffv_90;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_91> AgradDistributionsBetaBinomial_ffv_91;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_92> AgradDistributionsBetaBinomial_ffv_92;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_93> AgradDistributionsBetaBinomial_ffv_93;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_94> AgradDistributionsBetaBinomial_ffv_94;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_95> AgradDistributionsBetaBinomial_ffv_95;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_96> AgradDistributionsBetaBinomial_ffv_96;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_97> AgradDistributionsBetaBinomial_ffv_97;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_98> AgradDistributionsBetaBinomial_ffv_98;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_99> AgradDistributionsBetaBinomial_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_0, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_1, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_2, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_3, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_4, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_5, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_6, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_7, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_8, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_9, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_10, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_11, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_12, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_13, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_14, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_15, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_16, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_17, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_18, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_19, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_20, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_21, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_22, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_23, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_24, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_25, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_26, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_27, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_28, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_29, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_30, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_31, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_32, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_33, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_34, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_35, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_36, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_37, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_38, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_39, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_40, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_41, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_42, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_43, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_44, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_45, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_46, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_47, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_48, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_49, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_50, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_51, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_52, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_53, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_54, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_55, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_56, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_57, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_58, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_59, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_60, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_61, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_62, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_63, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_64, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_65, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_66, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_67, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_68, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_69, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_70, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_71, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_72, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_73, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_74, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_75, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_76, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_77, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_78, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_79, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_80, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_81, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_82, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_83, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_84, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_85, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_86, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_87, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_88, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_89, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_90, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_91, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_92, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_93, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_94, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_95, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_96, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_97, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_98, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_99, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_test.hpp>
+
+typedef std::tuple<int, int, double, double, empty, empty> type_v_0;
+typedef std::tuple<int, int, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<int, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<int, int, double, var, empty, empty> type_v_3;
+typedef std::tuple<int, int, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<int, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<int, int, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<int, int, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<int, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<int, int, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<int, int, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<int, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<int, int, var, double, empty, empty> type_v_18;
+typedef std::tuple<int, int, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<int, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<int, int, var, var, empty, empty> type_v_21;
+typedef std::tuple<int, int, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<int, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<int, int, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<int, int, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<int, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<int, int, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<int, int, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<int, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<int, std::vector<int>, double, double, empty, empty> type_v_36;
+typedef std::tuple<int, std::vector<int>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<int, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<int, std::vector<int>, double, var, empty, empty> type_v_39;
+typedef std::tuple<int, std::vector<int>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<int, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<int, std::vector<int>, var, double, empty, empty> type_v_54;
+typedef std::tuple<int, std::vector<int>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<int, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<int, std::vector<int>, var, var, empty, empty> type_v_57;
+typedef std::tuple<int, std::vector<int>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<int, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_0> AgradDistributionsBetaBinomial_v_0;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_1> AgradDistributionsBetaBinomial_v_1;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_2> AgradDistributionsBetaBinomial_v_2;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_3> AgradDistributionsBetaBinomial_v_3;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_4> AgradDistributionsBetaBinomial_v_4;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_5> AgradDistributionsBetaBinomial_v_5;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_6> AgradDistributionsBetaBinomial_v_6;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_7> AgradDistributionsBetaBinomial_v_7;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_8> AgradDistributionsBetaBinomial_v_8;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_9> AgradDistributionsBetaBinomial_v_9;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_10> AgradDistributionsBetaBinomial_v_10;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_11> AgradDistributionsBetaBinomial_v_11;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_12> AgradDistributionsBetaBinomial_v_12;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_13> AgradDistributionsBetaBinomial_v_13;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_14> AgradDistributionsBetaBinomial_v_14;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_15> AgradDistributionsBetaBinomial_v_15;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_16> AgradDistributionsBetaBinomial_v_16;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_17> AgradDistributionsBetaBinomial_v_17;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_18> AgradDistributionsBetaBinomial_v_18;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_19> AgradDistributionsBetaBinomial_v_19;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_20> AgradDistributionsBetaBinomial_v_20;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_21> AgradDistributionsBetaBinomial_v_21;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_22> AgradDistributionsBetaBinomial_v_22;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_23> AgradDistributionsBetaBinomial_v_23;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_24> AgradDistributionsBetaBinomial_v_24;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_25> AgradDistributionsBetaBinomial_v_25;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_26> AgradDistributionsBetaBinomial_v_26;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_27> AgradDistributionsBetaBinomial_v_27;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_28> AgradDistributionsBetaBinomial_v_28;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_29> AgradDistributionsBetaBinomial_v_29;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_30> AgradDistributionsBetaBinomial_v_30;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_31> AgradDistributionsBetaBinomial_v_31;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_32> AgradDistributionsBetaBinomial_v_32;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_33> AgradDistributionsBetaBinomial_v_33;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_34> AgradDistributionsBetaBinomial_v_34;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_35> AgradDistributionsBetaBinomial_v_35;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_36> AgradDistributionsBetaBinomial_v_36;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_37> AgradDistributionsBetaBinomial_v_37;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_38> AgradDistributionsBetaBinomial_v_38;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_39> AgradDistributionsBetaBinomial_v_39;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_40> AgradDistributionsBetaBinomial_v_40;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_41> AgradDistributionsBetaBinomial_v_41;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_42> AgradDistributionsBetaBinomial_v_42;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_43> AgradDistributionsBetaBinomial_v_43;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_44> AgradDistributionsBetaBinomial_v_44;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_45> AgradDistributionsBetaBinomial_v_45;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_46> AgradDistributionsBetaBinomial_v_46;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_47> AgradDistributionsBetaBinomial_v_47;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_48> AgradDistributionsBetaBinomial_v_48;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_49> AgradDistributionsBetaBinomial_v_49;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_50> AgradDistributionsBetaBinomial_v_50;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_51> AgradDistributionsBetaBinomial_v_51;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_52> AgradDistributionsBetaBinomial_v_52;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_53> AgradDistributionsBetaBinomial_v_53;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_54> AgradDistributionsBetaBinomial_v_54;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_55> AgradDistributionsBetaBinomial_v_55;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_56> AgradDistributionsBetaBinomial_v_56;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_57> AgradDistributionsBetaBinomial_v_57;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_58> AgradDistributionsBetaBinomial_v_58;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_59> AgradDistributionsBetaBinomial_v_59;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_60> AgradDistributionsBetaBinomial_v_60;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_61> AgradDistributionsBetaBinomial_v_61;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_62> AgradDistributionsBetaBinomial_v_62;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_63> AgradDistributionsBetaBinomial_v_63;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_64> AgradDistributionsBetaBinomial_v_64;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_65> AgradDistributionsBetaBinomial_v_65;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_66> AgradDistributionsBetaBinomial_v_66;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_67> AgradDistributionsBetaBinomial_v_67;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_68> AgradDistributionsBetaBinomial_v_68;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_69> AgradDistributionsBetaBinomial_v_69;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_70> AgradDistributionsBetaBinomial_v_70;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_71> AgradDistributionsBetaBinomial_v_71;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_72> AgradDistributionsBetaBinomial_v_72;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_73> AgradDistributionsBetaBinomial_v_73;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_74> AgradDistributionsBetaBinomial_v_74;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_75> AgradDistributionsBetaBinomial_v_75;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_76> AgradDistributionsBetaBinomial_v_76;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_77> AgradDistributionsBetaBinomial_v_77;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_78> AgradDistributionsBetaBinomial_v_78;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_79> AgradDistributionsBetaBinomial_v_79;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_80> AgradDistributionsBetaBinomial_v_80;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_81> AgradDistributionsBetaBinomial_v_81;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_82> AgradDistributionsBetaBinomial_v_82;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_83> AgradDistributionsBetaBinomial_v_83;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_84> AgradDistributionsBetaBinomial_v_84;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_85> AgradDistributionsBetaBinomial_v_85;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_86> AgradDistributionsBetaBinomial_v_86;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_87> AgradDistributionsBetaBinomial_v_87;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_88> AgradDistributionsBetaBinomial_v_88;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_89> AgradDistributionsBetaBinomial_v_89;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_90> AgradDistributionsBetaBinomial_v_90;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_91> AgradDistributionsBetaBinomial_v_91;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_92> AgradDistributionsBetaBinomial_v_92;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_93> AgradDistributionsBetaBinomial_v_93;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_94> AgradDistributionsBetaBinomial_v_94;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_95> AgradDistributionsBetaBinomial_v_95;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_96> AgradDistributionsBetaBinomial_v_96;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_97> AgradDistributionsBetaBinomial_v_97;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_98> AgradDistributionsBetaBinomial_v_98;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_99> AgradDistributionsBetaBinomial_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_0, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_1, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_2, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_3, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_4, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_5, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_6, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_7, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_8, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_9, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_10, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_11, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_12, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_13, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_14, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_15, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_16, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_17, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_18, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_19, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_20, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_21, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_22, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_23, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_24, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_25, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_26, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_27, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_28, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_29, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_30, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_31, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_32, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_33, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_34, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_35, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_36, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_37, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_38, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_39, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_40, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_41, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_42, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_43, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_44, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_45, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_46, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_47, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_48, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_49, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_50, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_51, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_52, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_53, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_54, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_55, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_56, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_57, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_58, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_59, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_60, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_61, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_62, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_63, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_64, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_65, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_66, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_67, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_68, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_69, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_70, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_71, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_72, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_73, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_74, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_75, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_76, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_77, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_78, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_79, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_80, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_81, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_82, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_83, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_84, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_85, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_86, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_87, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_88, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_89, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_90, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_91, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_92, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_93, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_94, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_95, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_96, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_97, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_98, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_99, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_test.hpp>
+
+typedef std::tuple<int, int, double, var, empty, empty> type_vv_0;
+typedef std::tuple<int, int, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<int, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<int, int, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<int, int, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<int, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<int, int, var, double, empty, empty> type_vv_9;
+typedef std::tuple<int, int, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<int, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<int, int, var, var, empty, empty> type_vv_12;
+typedef std::tuple<int, int, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<int, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<int, int, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<int, int, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<int, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<int, int, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<int, int, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<int, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<int, std::vector<int>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<int, std::vector<int>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<int, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<int, std::vector<int>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<int, std::vector<int>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<int, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<int, std::vector<int>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<int, std::vector<int>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<int, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<std::vector<int>, int, double, var, empty, empty> type_vv_81;
+typedef std::tuple<std::vector<int>, int, double, std::vector<var>, empty, empty> type_vv_82;
+typedef std::tuple<std::vector<int>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_83;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, var, empty, empty> type_vv_84;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_87;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_88;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_89;
+typedef std::tuple<std::vector<int>, int, var, double, empty, empty> type_vv_90;
+typedef std::tuple<std::vector<int>, int, var, std::vector<double>, empty, empty> type_vv_91;
+typedef std::tuple<std::vector<int>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_92;
+typedef std::tuple<std::vector<int>, int, var, var, empty, empty> type_vv_93;
+typedef std::tuple<std::vector<int>, int, var, std::vector<var>, empty, empty> type_vv_94;
+typedef std::tuple<std::vector<int>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_95;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, double, empty, empty> type_vv_96;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<double>, empty, empty> type_vv_97;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_98;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, var, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_0> AgradDistributionsBetaBinomial_vv_0;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_1> AgradDistributionsBetaBinomial_vv_1;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_2> AgradDistributionsBetaBinomial_vv_2;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_3> AgradDistributionsBetaBinomial_vv_3;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_4> AgradDistributionsBetaBinomial_vv_4;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_5> AgradDistributionsBetaBinomial_vv_5;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_6> AgradDistributionsBetaBinomial_vv_6;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_7> AgradDistributionsBetaBinomial_vv_7;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_8> AgradDistributionsBetaBinomial_vv_8;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_9> AgradDistributionsBetaBinomial_vv_9;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_10> AgradDistributionsBetaBinomial_vv_10;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_11> AgradDistributionsBetaBinomial_vv_11;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_12> AgradDistributionsBetaBinomial_vv_12;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_13> AgradDistributionsBetaBinomial_vv_13;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_14> AgradDistributionsBetaBinomial_vv_14;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_15> AgradDistributionsBetaBinomial_vv_15;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_16> AgradDistributionsBetaBinomial_vv_16;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_17> AgradDistributionsBetaBinomial_vv_17;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_18> AgradDistributionsBetaBinomial_vv_18;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_19> AgradDistributionsBetaBinomial_vv_19;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_20> AgradDistributionsBetaBinomial_vv_20;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_21> AgradDistributionsBetaBinomial_vv_21;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_22> AgradDistributionsBetaBinomial_vv_22;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_23> AgradDistributionsBetaBinomial_vv_23;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_24> AgradDistributionsBetaBinomial_vv_24;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_25> AgradDistributionsBetaBinomial_vv_25;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_26> AgradDistributionsBetaBinomial_vv_26;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_27> AgradDistributionsBetaBinomial_vv_27;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_28> AgradDistributionsBetaBinomial_vv_28;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_29> AgradDistributionsBetaBinomial_vv_29;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_30> AgradDistributionsBetaBinomial_vv_30;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_31> AgradDistributionsBetaBinomial_vv_31;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_32> AgradDistributionsBetaBinomial_vv_32;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_33> AgradDistributionsBetaBinomial_vv_33;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_34> AgradDistributionsBetaBinomial_vv_34;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_35> AgradDistributionsBetaBinomial_vv_35;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_36> AgradDistributionsBetaBinomial_vv_36;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_37> AgradDistributionsBetaBinomial_vv_37;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_38> AgradDistributionsBetaBinomial_vv_38;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_39> AgradDistributionsBetaBinomial_vv_39;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_40> AgradDistributionsBetaBinomial_vv_40;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_41> AgradDistributionsBetaBinomial_vv_41;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_42> AgradDistributionsBetaBinomial_vv_42;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_43> AgradDistributionsBetaBinomial_vv_43;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_44> AgradDistributionsBetaBinomial_vv_44;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_45> AgradDistributionsBetaBinomial_vv_45;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_46> AgradDistributionsBetaBinomial_vv_46;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_47> AgradDistributionsBetaBinomial_vv_47;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_48> AgradDistributionsBetaBinomial_vv_48;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_49> AgradDistributionsBetaBinomial_vv_49;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_50> AgradDistributionsBetaBinomial_vv_50;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_51> AgradDistributionsBetaBinomial_vv_51;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_52> AgradDistributionsBetaBinomial_vv_52;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_53> AgradDistributionsBetaBinomial_vv_53;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_54> AgradDistributionsBetaBinomial_vv_54;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_55> AgradDistributionsBetaBinomial_vv_55;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_56> AgradDistributionsBetaBinomial_vv_56;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_57> AgradDistributionsBetaBinomial_vv_57;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_58> AgradDistributionsBetaBinomial_vv_58;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_59> AgradDistributionsBetaBinomial_vv_59;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_60> AgradDistributionsBetaBinomial_vv_60;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_61> AgradDistributionsBetaBinomial_vv_61;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_62> AgradDistributionsBetaBinomial_vv_62;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_63> AgradDistributionsBetaBinomial_vv_63;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_64> AgradDistributionsBetaBinomial_vv_64;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_65> AgradDistributionsBetaBinomial_vv_65;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_66> AgradDistributionsBetaBinomial_vv_66;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_67> AgradDistributionsBetaBinomial_vv_67;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_68> AgradDistributionsBetaBinomial_vv_68;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_69> AgradDistributionsBetaBinomial_vv_69;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_70> AgradDistributionsBetaBinomial_vv_70;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_71> AgradDistributionsBetaBinomial_vv_71;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_72> AgradDistributionsBetaBinomial_vv_72;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_73> AgradDistributionsBetaBinomial_vv_73;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_74> AgradDistributionsBetaBinomial_vv_74;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_75> AgradDistributionsBetaBinomial_vv_75;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_76> AgradDistributionsBetaBinomial_vv_76;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_77> AgradDistributionsBetaBinomial_vv_77;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_78> AgradDistributionsBetaBinomial_vv_78;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_79> AgradDistributionsBetaBinomial_vv_79;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_80> AgradDistributionsBetaBinomial_vv_80;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_81> AgradDistributionsBetaBinomial_vv_81;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_82> AgradDistributionsBetaBinomial_vv_82;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_83> AgradDistributionsBetaBinomial_vv_83;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_84> AgradDistributionsBetaBinomial_vv_84;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_85> AgradDistributionsBetaBinomial_vv_85;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_86> AgradDistributionsBetaBinomial_vv_86;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_87> AgradDistributionsBetaBinomial_vv_87;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_88> AgradDistributionsBetaBinomial_vv_88;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_89> AgradDistributionsBetaBinomial_vv_89;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_90> AgradDistributionsBetaBinomial_vv_90;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_91> AgradDistributionsBetaBinomial_vv_91;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_92> AgradDistributionsBetaBinomial_vv_92;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_93> AgradDistributionsBetaBinomial_vv_93;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_94> AgradDistributionsBetaBinomial_vv_94;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_95> AgradDistributionsBetaBinomial_vv_95;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_96> AgradDistributionsBetaBinomial_vv_96;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_97> AgradDistributionsBetaBinomial_vv_97;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_98> AgradDistributionsBetaBinomial_vv_98;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_99> AgradDistributionsBetaBinomial_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_0, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_1, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_2, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_3, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_4, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_5, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_6, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_7, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_8, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_9, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_10, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_11, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_12, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_13, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_14, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_15, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_16, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_17, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_18, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_19, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_20, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_21, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_22, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_23, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_24, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_25, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_26, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_27, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_28, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_29, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_30, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_31, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_32, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_33, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_34, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_35, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_36, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_37, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_38, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_39, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_40, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_41, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_42, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_43, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_44, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_45, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_46, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_47, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_48, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_49, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_50, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_51, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_52, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_53, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_54, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_55, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_56, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_57, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_58, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_59, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_60, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_61, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_62, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_63, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_64, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_65, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_66, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_67, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_68, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_69, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_70, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_71, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_72, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_73, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_74, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_75, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_76, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_77, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_78, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_79, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_80, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_81, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_82, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_83, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_84, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_85, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_86, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_87, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_88, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_89, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_90, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_91, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_92, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_93, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_94, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_95, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_96, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_97, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_98, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_99, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_99);
+
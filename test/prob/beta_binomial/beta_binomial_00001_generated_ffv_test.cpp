@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_test.hpp>
+
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_100;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_102;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_103;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_105;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_106;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_111;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_112;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, double, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_153;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_154;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_156;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_157;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_159;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_160;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_100> AgradDistributionsBetaBinomial_ffv_100;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_101> AgradDistributionsBetaBinomial_ffv_101;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_102> AgradDistributionsBetaBinomial_ffv_102;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_103> AgradDistributionsBetaBinomial_ffv_103;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_104> AgradDistributionsBetaBinomial_ffv_104;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_105> AgradDistributionsBetaBinomial_ffv_105;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_106> AgradDistributionsBetaBinomial_ffv_106;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_107> AgradDistributionsBetaBinomial_ffv_107;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_108> AgradDistributionsBetaBinomial_ffv_108;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_109> AgradDistributionsBetaBinomial_ffv_109;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_110> AgradDistributionsBetaBinomial_ffv_110;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_111> AgradDistributionsBetaBinomial_ffv_111;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_112> AgradDistributionsBetaBinomial_ffv_112;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_113> AgradDistributionsBetaBinomial_ffv_113;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_114> AgradDistributionsBetaBinomial_ffv_114;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_115> AgradDistributionsBetaBinomial_ffv_115;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_116> AgradDistributionsBetaBinomial_ffv_116;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_117> AgradDistributionsBetaBinomial_ffv_117;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_118> AgradDistributionsBetaBinomial_ffv_118;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_119> AgradDistributionsBetaBinomial_ffv_119;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_120> AgradDistributionsBetaBinomial_ffv_120;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_121> AgradDistributionsBetaBinomial_ffv_121;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_122> AgradDistributionsBetaBinomial_ffv_122;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_123> AgradDistributionsBetaBinomial_ffv_123;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_124> AgradDistributionsBetaBinomial_ffv_124;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_125> AgradDistributionsBetaBinomial_ffv_125;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_126> AgradDistributionsBetaBinomial_ffv_126;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_127> AgradDistributionsBetaBinomial_ffv_127;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_128> AgradDistributionsBetaBinomial_ffv_128;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_129> AgradDistributionsBetaBinomial_ffv_129;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_130> AgradDistributionsBetaBinomial_ffv_130;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_131> AgradDistributionsBetaBinomial_ffv_131;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_132> AgradDistributionsBetaBinomial_ffv_132;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_133> AgradDistributionsBetaBinomial_ffv_133;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_134> AgradDistributionsBetaBinomial_ffv_134;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_135> AgradDistributionsBetaBinomial_ffv_135;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_136> AgradDistributionsBetaBinomial_ffv_136;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_137> AgradDistributionsBetaBinomial_ffv_137;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_138> AgradDistributionsBetaBinomial_ffv_138;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_139> AgradDistributionsBetaBinomial_ffv_139;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_140> AgradDistributionsBetaBinomial_ffv_140;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_141> AgradDistributionsBetaBinomial_ffv_141;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_142> AgradDistributionsBetaBinomial_ffv_142;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_143> AgradDistributionsBetaBinomial_ffv_143;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_144> AgradDistributionsBetaBinomial_ffv_144;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_145> AgradDistributionsBetaBinomial_ffv_145;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_146> AgradDistributionsBetaBinomial_ffv_146;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_147> AgradDistributionsBetaBinomial_ffv_147;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_148> AgradDistributionsBetaBinomial_ffv_148;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_149> AgradDistributionsBetaBinomial_ffv_149;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_150> AgradDistributionsBetaBinomial_ffv_150;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_151> AgradDistributionsBetaBinomial_ffv_151;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_152> AgradDistributionsBetaBinomial_ffv_152;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_153> AgradDistributionsBetaBinomial_ffv_153;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_154> AgradDistributionsBetaBinomial_ffv_154;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_155> AgradDistributionsBetaBinomial_ffv_155;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_156> AgradDistributionsBetaBinomial_ffv_156;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_157> AgradDistributionsBetaBinomial_ffv_157;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_158> AgradDistributionsBetaBinomial_ffv_158;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_159> AgradDistributionsBetaBinomial_ffv_159;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_160> AgradDistributionsBetaBinomial_ffv_160;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_161> AgradDistributionsBetaBinomial_ffv_161;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_162> AgradDistributionsBetaBinomial_ffv_162;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_163> AgradDistributionsBetaBinomial_ffv_163;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_164> AgradDistributionsBetaBinomial_ffv_164;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_165> AgradDistributionsBetaBinomial_ffv_165;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_166> AgradDistributionsBetaBinomial_ffv_166;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_167> AgradDistributionsBetaBinomial_ffv_167;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_168> AgradDistributionsBetaBinomial_ffv_168;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_169> AgradDistributionsBetaBinomial_ffv_169;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_170> AgradDistributionsBetaBinomial_ffv_170;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_171> AgradDistributionsBetaBinomial_ffv_171;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_172> AgradDistributionsBetaBinomial_ffv_172;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_173> AgradDistributionsBetaBinomial_ffv_173;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_174> AgradDistributionsBetaBinomial_ffv_174;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_175> AgradDistributionsBetaBinomial_ffv_175;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_176> AgradDistributionsBetaBinomial_ffv_176;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_177> AgradDistributionsBetaBinomial_ffv_177;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_178> AgradDistributionsBetaBinomial_ffv_178;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_179> AgradDistributionsBetaBinomial_ffv_179;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_180> AgradDistributionsBetaBinomial_ffv_180;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_181> AgradDistributionsBetaBinomial_ffv_181;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_182> AgradDistributionsBetaBinomial_ffv_182;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_183> AgradDistributionsBetaBinomial_ffv_183;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_184> AgradDistributionsBetaBinomial_ffv_184;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_185> AgradDistributionsBetaBinomial_ffv_185;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_186> AgradDistributionsBetaBinomial_ffv_186;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_187> AgradDistributionsBetaBinomial_ffv_187;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_188> AgradDistributionsBetaBinomial_ffv_188;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_189> AgradDistributionsBetaBinomial_ffv_189;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_190> AgradDistributionsBetaBinomial_ffv_190;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_191> AgradDistributionsBetaBinomial_ffv_191;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_192> AgradDistributionsBetaBinomial_ffv_192;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_193> AgradDistributionsBetaBinomial_ffv_193;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_194> AgradDistributionsBetaBinomial_ffv_194;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_195> AgradDistributionsBetaBinomial_ffv_195;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_196> AgradDistributionsBetaBinomial_ffv_196;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_197> AgradDistributionsBetaBinomial_ffv_197;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_198> AgradDistributionsBetaBinomial_ffv_198;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_199> AgradDistributionsBetaBinomial_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_100, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_101, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_102, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_103, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_104, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_105, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_106, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_107, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_108, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_109, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_110, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_111, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_112, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_113, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_114, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_115, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_116, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_117, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_118, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_119, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_120, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_121, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_122, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_123, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_124, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_125, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_126, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_127, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_128, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_129, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_130, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_131, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_132, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_133, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_134, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_135, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_136, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_137, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_138, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_139, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_140, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_141, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_142, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_143, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_144, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_145, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_146, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_147, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_148, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_149, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_150, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_151, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_152, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_153, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_154, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_155, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_156, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_157, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_158, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_159, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_160, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_161, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_162, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_163, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_164, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_165, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_166, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_167, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_168, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_169, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_170, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_171, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_172, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_173, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_174, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_175, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_176, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_177, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_178, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_179, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_180, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_181, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_182, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_183, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_184, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_185, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_186, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_187, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_188, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_189, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_190, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_191, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_192, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_193, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_194, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_195, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_196, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_197, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_198, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_199, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_test.hpp>
+
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<std::vector<int>, int, double, double, empty, empty> type_v_108;
+typedef std::tuple<std::vector<int>, int, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<std::vector<int>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<std::vector<int>, int, double, var, empty, empty> type_v_111;
+typedef std::tuple<std::vector<int>, int, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<std::vector<int>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<std::vector<int>, int, var, double, empty, empty> type_v_126;
+typedef std::tuple<std::vector<int>, int, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<std::vector<int>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<std::vector<int>, int, var, var, empty, empty> type_v_129;
+typedef std::tuple<std::vector<int>, int, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<std::vector<int>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, double, empty, empty> type_v_144;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, var, empty, empty> type_v_147;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, double, empty, empty> type_v_162;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, var, empty, empty> type_v_165;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_100> AgradDistributionsBetaBinomial_v_100;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_101> AgradDistributionsBetaBinomial_v_101;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_102> AgradDistributionsBetaBinomial_v_102;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_103> AgradDistributionsBetaBinomial_v_103;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_104> AgradDistributionsBetaBinomial_v_104;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_105> AgradDistributionsBetaBinomial_v_105;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_106> AgradDistributionsBetaBinomial_v_106;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_107> AgradDistributionsBetaBinomial_v_107;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_108> AgradDistributionsBetaBinomial_v_108;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_109> AgradDistributionsBetaBinomial_v_109;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_110> AgradDistributionsBetaBinomial_v_110;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_111> AgradDistributionsBetaBinomial_v_111;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_112> AgradDistributionsBetaBinomial_v_112;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_113> AgradDistributionsBetaBinomial_v_113;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_114> AgradDistributionsBetaBinomial_v_114;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_115> AgradDistributionsBetaBinomial_v_115;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_116> AgradDistributionsBetaBinomial_v_116;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_117> AgradDistributionsBetaBinomial_v_117;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_118> AgradDistributionsBetaBinomial_v_118;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_119> AgradDistributionsBetaBinomial_v_119;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_120> AgradDistributionsBetaBinomial_v_120;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_121> AgradDistributionsBetaBinomial_v_121;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_122> AgradDistributionsBetaBinomial_v_122;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_123> AgradDistributionsBetaBinomial_v_123;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_124> AgradDistributionsBetaBinomial_v_124;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_125> AgradDistributionsBetaBinomial_v_125;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_126> AgradDistributionsBetaBinomial_v_126;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_127> AgradDistributionsBetaBinomial_v_127;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_128> AgradDistributionsBetaBinomial_v_128;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_129> AgradDistributionsBetaBinomial_v_129;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_130> AgradDistributionsBetaBinomial_v_130;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_131> AgradDistributionsBetaBinomial_v_131;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_132> AgradDistributionsBetaBinomial_v_132;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_133> AgradDistributionsBetaBinomial_v_133;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_134> AgradDistributionsBetaBinomial_v_134;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_135> AgradDistributionsBetaBinomial_v_135;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_136> AgradDistributionsBetaBinomial_v_136;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_137> AgradDistributionsBetaBinomial_v_137;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_138> AgradDistributionsBetaBinomial_v_138;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_139> AgradDistributionsBetaBinomial_v_139;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_140> AgradDistributionsBetaBinomial_v_140;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_141> AgradDistributionsBetaBinomial_v_141;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_142> AgradDistributionsBetaBinomial_v_142;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_143> AgradDistributionsBetaBinomial_v_143;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_144> AgradDistributionsBetaBinomial_v_144;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_145> AgradDistributionsBetaBinomial_v_145;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_146> AgradDistributionsBetaBinomial_v_146;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_147> AgradDistributionsBetaBinomial_v_147;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_148> AgradDistributionsBetaBinomial_v_148;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_149> AgradDistributionsBetaBinomial_v_149;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_150> AgradDistributionsBetaBinomial_v_150;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_151> AgradDistributionsBetaBinomial_v_151;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_152> AgradDistributionsBetaBinomial_v_152;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_153> AgradDistributionsBetaBinomial_v_153;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_154> AgradDistributionsBetaBinomial_v_154;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_155> AgradDistributionsBetaBinomial_v_155;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_156> AgradDistributionsBetaBinomial_v_156;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_157> AgradDistributionsBetaBinomial_v_157;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_158> AgradDistributionsBetaBinomial_v_158;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_159> AgradDistributionsBetaBinomial_v_159;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_160> AgradDistributionsBetaBinomial_v_160;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_161> AgradDistributionsBetaBinomial_v_161;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_162> AgradDistributionsBetaBinomial_v_162;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_163> AgradDistributionsBetaBinomial_v_163;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_164> AgradDistributionsBetaBinomial_v_164;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_165> AgradDistributionsBetaBinomial_v_165;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_166> AgradDistributionsBetaBinomial_v_166;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_167> AgradDistributionsBetaBinomial_v_167;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_168> AgradDistributionsBetaBinomial_v_168;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_169> AgradDistributionsBetaBinomial_v_169;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_170> AgradDistributionsBetaBinomial_v_170;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_171> AgradDistributionsBetaBinomial_v_171;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_172> AgradDistributionsBetaBinomial_v_172;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_173> AgradDistributionsBetaBinomial_v_173;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_174> AgradDistributionsBetaBinomial_v_174;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_175> AgradDistributionsBetaBinomial_v_175;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_176> AgradDistributionsBetaBinomial_v_176;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_177> AgradDistributionsBetaBinomial_v_177;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_178> AgradDistributionsBetaBinomial_v_178;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_179> AgradDistributionsBetaBinomial_v_179;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_180> AgradDistributionsBetaBinomial_v_180;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_181> AgradDistributionsBetaBinomial_v_181;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_182> AgradDistributionsBetaBinomial_v_182;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_183> AgradDistributionsBetaBinomial_v_183;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_184> AgradDistributionsBetaBinomial_v_184;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_185> AgradDistributionsBetaBinomial_v_185;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_186> AgradDistributionsBetaBinomial_v_186;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_187> AgradDistributionsBetaBinomial_v_187;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_188> AgradDistributionsBetaBinomial_v_188;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_189> AgradDistributionsBetaBinomial_v_189;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_190> AgradDistributionsBetaBinomial_v_190;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_191> AgradDistributionsBetaBinomial_v_191;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_192> AgradDistributionsBetaBinomial_v_192;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_193> AgradDistributionsBetaBinomial_v_193;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_194> AgradDistributionsBetaBinomial_v_194;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_195> AgradDistributionsBetaBinomial_v_195;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_196> AgradDistributionsBetaBinomial_v_196;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_197> AgradDistributionsBetaBinomial_v_197;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_198> AgradDistributionsBetaBinomial_v_198;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_199> AgradDistributionsBetaBinomial_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_100, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_101, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_102, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_103, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_104, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_105, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_106, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_107, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_108, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_109, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_110, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_111, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_112, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_113, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_114, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_115, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_116, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_117, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_118, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_119, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_120, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_121, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_122, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_123, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_124, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_125, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_126, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_127, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_128, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_129, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_130, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_131, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_132, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_133, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_134, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_135, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_136, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_137, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_138, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_139, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_140, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_141, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_142, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_143, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_144, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_145, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_146, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_147, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_148, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_149, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_150, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_151, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_152, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_153, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_154, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_155, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_156, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_157, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_158, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_159, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_160, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_161, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_162, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_163, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_164, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_165, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_166, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_167, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_168, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_169, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_170, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_171, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_172, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_173, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_174, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_175, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_176, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_177, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_178, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_179, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_180, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_181, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_182, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_183, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_184, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_185, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_186, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_187, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_188, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_189, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_190, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_191, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_192, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_193, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_194, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_195, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_196, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_197, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_198, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_199, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_199);
+
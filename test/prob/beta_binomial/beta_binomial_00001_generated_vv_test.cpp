@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_test.hpp>
+
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<var>, empty, empty> type_vv_100;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_101;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_102;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_103;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_104;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_105;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_106;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_107;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, var, empty, empty> type_vv_108;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, var, empty, empty> type_vv_111;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_vv_112;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_113;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_114;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, double, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, var, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, double, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, var, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_152;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_153;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_154;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_155;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_156;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_157;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_158;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_159;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_160;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_161;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, var, empty, empty> type_vv_162;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty, empty> type_vv_165;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty, empty> type_vv_166;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_167;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, double, empty, empty> type_vv_171;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, var, empty, empty> type_vv_174;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty, empty> type_vv_189;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty, empty> type_vv_198;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_100> AgradDistributionsBetaBinomial_vv_100;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_101> AgradDistributionsBetaBinomial_vv_101;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_102> AgradDistributionsBetaBinomial_vv_102;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_103> AgradDistributionsBetaBinomial_vv_103;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_104> AgradDistributionsBetaBinomial_vv_104;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_105> AgradDistributionsBetaBinomial_vv_105;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_106> AgradDistributionsBetaBinomial_vv_106;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_107> AgradDistributionsBetaBinomial_vv_107;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_108> AgradDistributionsBetaBinomial_vv_108;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_109> AgradDistributionsBetaBinomial_vv_109;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_110> AgradDistributionsBetaBinomial_vv_110;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_111> AgradDistributionsBetaBinomial_vv_111;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_112> AgradDistributionsBetaBinomial_vv_112;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_113> AgradDistributionsBetaBinomial_vv_113;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_114> AgradDistributionsBetaBinomial_vv_114;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_115> AgradDistributionsBetaBinomial_vv_115;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_116> AgradDistributionsBetaBinomial_vv_116;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_117> AgradDistributionsBetaBinomial_vv_117;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_118> AgradDistributionsBetaBinomial_vv_118;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_119> AgradDistributionsBetaBinomial_vv_119;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_120> AgradDistributionsBetaBinomial_vv_120;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_121> AgradDistributionsBetaBinomial_vv_121;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_122> AgradDistributionsBetaBinomial_vv_122;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_123> AgradDistributionsBetaBinomial_vv_123;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_124> AgradDistributionsBetaBinomial_vv_124;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_125> AgradDistributionsBetaBinomial_vv_125;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_126> AgradDistributionsBetaBinomial_vv_126;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_127> AgradDistributionsBetaBinomial_vv_127;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_128> AgradDistributionsBetaBinomial_vv_128;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_129> AgradDistributionsBetaBinomial_vv_129;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_130> AgradDistributionsBetaBinomial_vv_130;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_131> AgradDistributionsBetaBinomial_vv_131;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_132> AgradDistributionsBetaBinomial_vv_132;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_133> AgradDistributionsBetaBinomial_vv_133;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_134> AgradDistributionsBetaBinomial_vv_134;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_135> AgradDistributionsBetaBinomial_vv_135;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_136> AgradDistributionsBetaBinomial_vv_136;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_137> AgradDistributionsBetaBinomial_vv_137;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_138> AgradDistributionsBetaBinomial_vv_138;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_139> AgradDistributionsBetaBinomial_vv_139;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_140> AgradDistributionsBetaBinomial_vv_140;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_141> AgradDistributionsBetaBinomial_vv_141;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_142> AgradDistributionsBetaBinomial_vv_142;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_143> AgradDistributionsBetaBinomial_vv_143;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_144> AgradDistributionsBetaBinomial_vv_144;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_145> AgradDistributionsBetaBinomial_vv_145;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_146> AgradDistributionsBetaBinomial_vv_146;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_147> AgradDistributionsBetaBinomial_vv_147;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_148> AgradDistributionsBetaBinomial_vv_148;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_149> AgradDistributionsBetaBinomial_vv_149;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_150> AgradDistributionsBetaBinomial_vv_150;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_151> AgradDistributionsBetaBinomial_vv_151;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_152> AgradDistributionsBetaBinomial_vv_152;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_153> AgradDistributionsBetaBinomial_vv_153;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_154> AgradDistributionsBetaBinomial_vv_154;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_155> AgradDistributionsBetaBinomial_vv_155;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_156> AgradDistributionsBetaBinomial_vv_156;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_157> AgradDistributionsBetaBinomial_vv_157;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_158> AgradDistributionsBetaBinomial_vv_158;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_159> AgradDistributionsBetaBinomial_vv_159;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_160> AgradDistributionsBetaBinomial_vv_160;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_161> AgradDistributionsBetaBinomial_vv_161;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_162> AgradDistributionsBetaBinomial_vv_162;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_163> AgradDistributionsBetaBinomial_vv_163;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_164> AgradDistributionsBetaBinomial_vv_164;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_165> AgradDistributionsBetaBinomial_vv_165;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_166> AgradDistributionsBetaBinomial_vv_166;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_167> AgradDistributionsBetaBinomial_vv_167;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_168> AgradDistributionsBetaBinomial_vv_168;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_169> AgradDistributionsBetaBinomial_vv_169;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_170> AgradDistributionsBetaBinomial_vv_170;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_171> AgradDistributionsBetaBinomial_vv_171;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_172> AgradDistributionsBetaBinomial_vv_172;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_173> AgradDistributionsBetaBinomial_vv_173;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_174> AgradDistributionsBetaBinomial_vv_174;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_175> AgradDistributionsBetaBinomial_vv_175;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_176> AgradDistributionsBetaBinomial_vv_176;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_177> AgradDistributionsBetaBinomial_vv_177;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_178> AgradDistributionsBetaBinomial_vv_178;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_179> AgradDistributionsBetaBinomial_vv_179;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_180> AgradDistributionsBetaBinomial_vv_180;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_181> AgradDistributionsBetaBinomial_vv_181;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_182> AgradDistributionsBetaBinomial_vv_182;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_183> AgradDistributionsBetaBinomial_vv_183;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_184> AgradDistributionsBetaBinomial_vv_184;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_185> AgradDistributionsBetaBinomial_vv_185;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_186> AgradDistributionsBetaBinomial_vv_186;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_187> AgradDistributionsBetaBinomial_vv_187;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_188> AgradDistributionsBetaBinomial_vv_188;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_189> AgradDistributionsBetaBinomial_vv_189;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_190> AgradDistributionsBetaBinomial_vv_190;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_191> AgradDistributionsBetaBinomial_vv_191;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_192> AgradDistributionsBetaBinomial_vv_192;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_193> AgradDistributionsBetaBinomial_vv_193;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_194> AgradDistributionsBetaBinomial_vv_194;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_195> AgradDistributionsBetaBinomial_vv_195;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_196> AgradDistributionsBetaBinomial_vv_196;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_197> AgradDistributionsBetaBinomial_vv_197;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_198> AgradDistributionsBetaBinomial_vv_198;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_199> AgradDistributionsBetaBinomial_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_100, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_101, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_102, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_103, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_104, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_105, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_106, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_107, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_108, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_109, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_110, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_111, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_112, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_113, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_114, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_115, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_116, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_117, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_118, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_119, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_120, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_121, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_122, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_123, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_124, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_125, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_126, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_127, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_128, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_129, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_130, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_131, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_132, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_133, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_134, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_135, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_136, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_137, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_138, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_139, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_140, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_141, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_142, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_143, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_144, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_145, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_146, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_147, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_148, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_149, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_150, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_151, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_152, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_153, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_154, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_155, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_156, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_157, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_158, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_159, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_160, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_161, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_162, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_163, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_164, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_165, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_166, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_167, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_168, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_169, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_170, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_171, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_172, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_173, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_174, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_175, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_176, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_177, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_178, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_179, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_180, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_181, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_182, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_183, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_184, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_185, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_186, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_187, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_188, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_189, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_190, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_191, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_192, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_193, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_194, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_195, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_196, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_197, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_198, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_199, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_199);
+
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_200> AgradDistributionsBetaBinomial_ffv_200;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_201> AgradDistributionsBetaBinomial_ffv_201;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_202> AgradDistributionsBetaBinomial_ffv_202;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_203> AgradDistributionsBetaBinomial_ffv_203;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_204> AgradDistributionsBetaBinomial_ffv_204;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_205> AgradDistributionsBetaBinomial_ffv_205;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_206> AgradDistributionsBetaBinomial_ffv_206;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_207> AgradDistributionsBetaBinomial_ffv_207;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_208> AgradDistributionsBetaBinomial_ffv_208;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_209> AgradDistributionsBetaBinomial_ffv_209;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_210> AgradDistributionsBetaBinomial_ffv_210;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_211> AgradDistributionsBetaBinomial_ffv_211;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_212> AgradDistributionsBetaBinomial_ffv_212;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_213> AgradDistributionsBetaBinomial_ffv_213;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_214> AgradDistributionsBetaBinomial_ffv_214;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_215> AgradDistributionsBetaBinomial_ffv_215;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_216> AgradDistributionsBetaBinomial_ffv_216;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_217> AgradDistributionsBetaBinomial_ffv_217;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_218> AgradDistributionsBetaBinomial_ffv_218;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_219> AgradDistributionsBetaBinomial_ffv_219;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_220> AgradDistributionsBetaBinomial_ffv_220;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_221> AgradDistributionsBetaBinomial_ffv_221;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_222> AgradDistributionsBetaBinomial_ffv_222;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_223> AgradDistributionsBetaBinomial_ffv_223;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_224> AgradDistributionsBetaBinomial_ffv_224;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_225> AgradDistributionsBetaBinomial_ffv_225;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_226> AgradDistributionsBetaBinomial_ffv_226;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_227> AgradDistributionsBetaBinomial_ffv_227;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_228> AgradDistributionsBetaBinomial_ffv_228;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_229> AgradDistributionsBetaBinomial_ffv_229;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_230> AgradDistributionsBetaBinomial_ffv_230;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_231> AgradDistributionsBetaBinomial_ffv_231;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_232> AgradDistributionsBetaBinomial_ffv_232;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_233> AgradDistributionsBetaBinomial_ffv_233;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_234> AgradDistributionsBetaBinomial_ffv_234;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_235> AgradDistributionsBetaBinomial_ffv_235;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_236> AgradDistributionsBetaBinomial_ffv_236;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_237> AgradDistributionsBetaBinomial_ffv_237;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_238> AgradDistributionsBetaBinomial_ffv_238;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_239> AgradDistributionsBetaBinomial_ffv_239;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_240> AgradDistributionsBetaBinomial_ffv_240;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_241> AgradDistributionsBetaBinomial_ffv_241;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_ffv_242> AgradDistributionsBetaBinomial_ffv_242;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_200, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_201, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_202, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_203, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_204, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_205, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_206, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_207, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_208, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_209, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_210, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_211, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_212, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_213, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_214, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_215, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_216, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_217, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_218, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_219, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_220, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_221, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_222, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_223, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_224, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_225, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_226, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_227, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_228, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_229, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_230, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_231, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_232, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_233, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_234, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_235, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_236, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_237, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_238, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_239, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_240, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_241, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_ffv_242, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_ffv_242);
+
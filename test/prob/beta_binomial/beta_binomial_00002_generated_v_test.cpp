@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_test.hpp>
+
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, double, empty, empty> type_v_216;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, var, empty, empty> type_v_219;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, double, empty, empty> type_v_234;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, var, empty, empty> type_v_237;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty, empty> type_v_252;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty, empty> type_v_255;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty, empty> type_v_270;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty, empty> type_v_273;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_200> AgradDistributionsBetaBinomial_v_200;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_201> AgradDistributionsBetaBinomial_v_201;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_202> AgradDistributionsBetaBinomial_v_202;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_203> AgradDistributionsBetaBinomial_v_203;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_204> AgradDistributionsBetaBinomial_v_204;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_205> AgradDistributionsBetaBinomial_v_205;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_206> AgradDistributionsBetaBinomial_v_206;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_207> AgradDistributionsBetaBinomial_v_207;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_208> AgradDistributionsBetaBinomial_v_208;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_209> AgradDistributionsBetaBinomial_v_209;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_210> AgradDistributionsBetaBinomial_v_210;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_211> AgradDistributionsBetaBinomial_v_211;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_212> AgradDistributionsBetaBinomial_v_212;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_213> AgradDistributionsBetaBinomial_v_213;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_214> AgradDistributionsBetaBinomial_v_214;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_215> AgradDistributionsBetaBinomial_v_215;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_216> AgradDistributionsBetaBinomial_v_216;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_217> AgradDistributionsBetaBinomial_v_217;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_218> AgradDistributionsBetaBinomial_v_218;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_219> AgradDistributionsBetaBinomial_v_219;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_220> AgradDistributionsBetaBinomial_v_220;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_221> AgradDistributionsBetaBinomial_v_221;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_222> AgradDistributionsBetaBinomial_v_222;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_223> AgradDistributionsBetaBinomial_v_223;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_224> AgradDistributionsBetaBinomial_v_224;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_225> AgradDistributionsBetaBinomial_v_225;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_226> AgradDistributionsBetaBinomial_v_226;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_227> AgradDistributionsBetaBinomial_v_227;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_228> AgradDistributionsBetaBinomial_v_228;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_229> AgradDistributionsBetaBinomial_v_229;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_230> AgradDistributionsBetaBinomial_v_230;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_231> AgradDistributionsBetaBinomial_v_231;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_232> AgradDistributionsBetaBinomial_v_232;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_233> AgradDistributionsBetaBinomial_v_233;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_234> AgradDistributionsBetaBinomial_v_234;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_235> AgradDistributionsBetaBinomial_v_235;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_236> AgradDistributionsBetaBinomial_v_236;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_237> AgradDistributionsBetaBinomial_v_237;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_238> AgradDistributionsBetaBinomial_v_238;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_239> AgradDistributionsBetaBinomial_v_239;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_240> AgradDistributionsBetaBinomial_v_240;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_241> AgradDistributionsBetaBinomial_v_241;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_242> AgradDistributionsBetaBinomial_v_242;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_243> AgradDistributionsBetaBinomial_v_243;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_244> AgradDistributionsBetaBinomial_v_244;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_245> AgradDistributionsBetaBinomial_v_245;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_246> AgradDistributionsBetaBinomial_v_246;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_247> AgradDistributionsBetaBinomial_v_247;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_248> AgradDistributionsBetaBinomial_v_248;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_249> AgradDistributionsBetaBinomial_v_249;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_250> AgradDistributionsBetaBinomial_v_250;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_251> AgradDistributionsBetaBinomial_v_251;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_252> AgradDistributionsBetaBinomial_v_252;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_253> AgradDistributionsBetaBinomial_v_253;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_254> AgradDistributionsBetaBinomial_v_254;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_255> AgradDistributionsBetaBinomial_v_255;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_256> AgradDistributionsBetaBinomial_v_256;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_257> AgradDistributionsBetaBinomial_v_257;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_258> AgradDistributionsBetaBinomial_v_258;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_259> AgradDistributionsBetaBinomial_v_259;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_260> AgradDistributionsBetaBinomial_v_260;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_261> AgradDistributionsBetaBinomial_v_261;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_262> AgradDistributionsBetaBinomial_v_262;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_263> AgradDistributionsBetaBinomial_v_263;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_264> AgradDistributionsBetaBinomial_v_264;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_265> AgradDistributionsBetaBinomial_v_265;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_266> AgradDistributionsBetaBinomial_v_266;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_267> AgradDistributionsBetaBinomial_v_267;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_268> AgradDistributionsBetaBinomial_v_268;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_269> AgradDistributionsBetaBinomial_v_269;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_270> AgradDistributionsBetaBinomial_v_270;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_271> AgradDistributionsBetaBinomial_v_271;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_272> AgradDistributionsBetaBinomial_v_272;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_273> AgradDistributionsBetaBinomial_v_273;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_274> AgradDistributionsBetaBinomial_v_274;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_275> AgradDistributionsBetaBinomial_v_275;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_276> AgradDistributionsBetaBinomial_v_276;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_277> AgradDistributionsBetaBinomial_v_277;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_278> AgradDistributionsBetaBinomial_v_278;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_279> AgradDistributionsBetaBinomial_v_279;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_280> AgradDistributionsBetaBinomial_v_280;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_281> AgradDistributionsBetaBinomial_v_281;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_282> AgradDistributionsBetaBinomial_v_282;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_283> AgradDistributionsBetaBinomial_v_283;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_284> AgradDistributionsBetaBinomial_v_284;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_285> AgradDistributionsBetaBinomial_v_285;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_286> AgradDistributionsBetaBinomial_v_286;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_287> AgradDistributionsBetaBinomial_v_287;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_288> AgradDistributionsBetaBinomial_v_288;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_289> AgradDistributionsBetaBinomial_v_289;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_290> AgradDistributionsBetaBinomial_v_290;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_291> AgradDistributionsBetaBinomial_v_291;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_292> AgradDistributionsBetaBinomial_v_292;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_293> AgradDistributionsBetaBinomial_v_293;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_294> AgradDistributionsBetaBinomial_v_294;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_295> AgradDistributionsBetaBinomial_v_295;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_296> AgradDistributionsBetaBinomial_v_296;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_297> AgradDistributionsBetaBinomial_v_297;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_298> AgradDistributionsBetaBinomial_v_298;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_299> AgradDistributionsBetaBinomial_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_200, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_201, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_202, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_203, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_204, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_205, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_206, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_207, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_208, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_209, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_210, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_211, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_212, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_213, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_214, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_215, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_216, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_217, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_218, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_219, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_220, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_221, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_222, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_223, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_224, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_225, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_226, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_227, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_228, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_229, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_230, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_231, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_232, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_233, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_234, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_235, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_236, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_237, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_238, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_239, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_240, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_241, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_242, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_243, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_244, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_245, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_246, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_247, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_248, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_249, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_250, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_251, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_252, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_253, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_254, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_255, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_256, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_257, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_258, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_259, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_260, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_261, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_262, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_263, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_264, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_265, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_266, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_267, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_268, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_269, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_270, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_271, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_272, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_273, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_274, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_275, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_276, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_277, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_278, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_279, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_280, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_281, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_282, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_283, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_284, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_285, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_286, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_287, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_288, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_289, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_290, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_291, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_292, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_293, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_294, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_295, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_296, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_297, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_298, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_299, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_299);
+
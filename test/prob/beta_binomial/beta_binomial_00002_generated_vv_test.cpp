@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty, empty> type_vv_201;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_200> AgradDistributionsBetaBinomial_vv_200;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_201> AgradDistributionsBetaBinomial_vv_201;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_202> AgradDistributionsBetaBinomial_vv_202;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_203> AgradDistributionsBetaBinomial_vv_203;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_204> AgradDistributionsBetaBinomial_vv_204;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_205> AgradDistributionsBetaBinomial_vv_205;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_206> AgradDistributionsBetaBinomial_vv_206;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_207> AgradDistributionsBetaBinomial_vv_207;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_208> AgradDistributionsBetaBinomial_vv_208;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_209> AgradDistributionsBetaBinomial_vv_209;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_210> AgradDistributionsBetaBinomial_vv_210;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_211> AgradDistributionsBetaBinomial_vv_211;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_212> AgradDistributionsBetaBinomial_vv_212;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_213> AgradDistributionsBetaBinomial_vv_213;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_214> AgradDistributionsBetaBinomial_vv_214;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_215> AgradDistributionsBetaBinomial_vv_215;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_216> AgradDistributionsBetaBinomial_vv_216;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_217> AgradDistributionsBetaBinomial_vv_217;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_218> AgradDistributionsBetaBinomial_vv_218;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_219> AgradDistributionsBetaBinomial_vv_219;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_220> AgradDistributionsBetaBinomial_vv_220;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_221> AgradDistributionsBetaBinomial_vv_221;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_222> AgradDistributionsBetaBinomial_vv_222;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_223> AgradDistributionsBetaBinomial_vv_223;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_224> AgradDistributionsBetaBinomial_vv_224;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_225> AgradDistributionsBetaBinomial_vv_225;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_226> AgradDistributionsBetaBinomial_vv_226;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_227> AgradDistributionsBetaBinomial_vv_227;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_228> AgradDistributionsBetaBinomial_vv_228;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_229> AgradDistributionsBetaBinomial_vv_229;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_230> AgradDistributionsBetaBinomial_vv_230;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_231> AgradDistributionsBetaBinomial_vv_231;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_232> AgradDistributionsBetaBinomial_vv_232;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_233> AgradDistributionsBetaBinomial_vv_233;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_234> AgradDistributionsBetaBinomial_vv_234;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_235> AgradDistributionsBetaBinomial_vv_235;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_236> AgradDistributionsBetaBinomial_vv_236;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_237> AgradDistributionsBetaBinomial_vv_237;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_238> AgradDistributionsBetaBinomial_vv_238;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_239> AgradDistributionsBetaBinomial_vv_239;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_240> AgradDistributionsBetaBinomial_vv_240;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_241> AgradDistributionsBetaBinomial_vv_241;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_vv_242> AgradDistributionsBetaBinomial_vv_242;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_200, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_201, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_202, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_203, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_204, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_205, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_206, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_207, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_208, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_209, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_210, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_211, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_212, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_213, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_214, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_215, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_216, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_217, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_218, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_219, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_220, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_221, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_222, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_223, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_224, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_225, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_226, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_227, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_228, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_229, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_230, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_231, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_232, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_233, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_234, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_235, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_236, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_237, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_238, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_239, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_240, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_241, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_vv_242, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_vv_242);
+
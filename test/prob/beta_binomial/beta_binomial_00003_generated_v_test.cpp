@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_300> AgradDistributionsBetaBinomial_v_300;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_301> AgradDistributionsBetaBinomial_v_301;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_302> AgradDistributionsBetaBinomial_v_302;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_303> AgradDistributionsBetaBinomial_v_303;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_304> AgradDistributionsBetaBinomial_v_304;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_305> AgradDistributionsBetaBinomial_v_305;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_306> AgradDistributionsBetaBinomial_v_306;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_307> AgradDistributionsBetaBinomial_v_307;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_308> AgradDistributionsBetaBinomial_v_308;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_309> AgradDistributionsBetaBinomial_v_309;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_310> AgradDistributionsBetaBinomial_v_310;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_311> AgradDistributionsBetaBinomial_v_311;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_312> AgradDistributionsBetaBinomial_v_312;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_313> AgradDistributionsBetaBinomial_v_313;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_314> AgradDistributionsBetaBinomial_v_314;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_315> AgradDistributionsBetaBinomial_v_315;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_316> AgradDistributionsBetaBinomial_v_316;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_317> AgradDistributionsBetaBinomial_v_317;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_318> AgradDistributionsBetaBinomial_v_318;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_319> AgradDistributionsBetaBinomial_v_319;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_320> AgradDistributionsBetaBinomial_v_320;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_321> AgradDistributionsBetaBinomial_v_321;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_322> AgradDistributionsBetaBinomial_v_322;
+typedef std::tuple<AgradDistributionsBetaBinomial, type_v_323> AgradDistributionsBetaBinomial_v_323;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_300, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_301, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_302, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_303, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_304, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_305, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_306, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_307, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_308, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_309, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_310, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_311, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_312, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_313, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_314, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_315, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_316, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_317, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_318, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_319, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_320, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_321, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_322, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaBinomial_v_323, AgradDistributionTestFixture, AgradDistributionsBetaBinomial_v_323);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, int, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<int, int, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<int, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<int, int, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<int, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<int, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<int, int, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<int, int, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<int, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<int, int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<int, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<int, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<int, std::vector<int>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<int, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<int, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<std::vector<int>, int, double, fvar<fvar<var> >, empty, empty> type_ffv_81;
+typedef std::tuple<std::vector<int>, int, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_82;
+typedef std::tuple<std::vector<int>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_87;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_88;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, double, empty, empty> type_ffv_90;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_91;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_93;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_94;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_96;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_97;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_0> AgradCcdfLogBetaBinomial_ffv_0;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_1> AgradCcdfLogBetaBinomial_ffv_1;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_2> AgradCcdfLogBetaBinomial_ffv_2;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_3> AgradCcdfLogBetaBinomial_ffv_3;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_4> AgradCcdfLogBetaBinomial_ffv_4;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_5> AgradCcdfLogBetaBinomial_ffv_5;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_6> AgradCcdfLogBetaBinomial_ffv_6;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_7> AgradCcdfLogBetaBinomial_ffv_7;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_8> AgradCcdfLogBetaBinomial_ffv_8;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_9> AgradCcdfLogBetaBinomial_ffv_9;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_10> AgradCcdfLogBetaBinomial_ffv_10;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_11> AgradCcdfLogBetaBinomial_ffv_11;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_12> AgradCcdfLogBetaBinomial_ffv_12;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_13> AgradCcdfLogBetaBinomial_ffv_13;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_14> AgradCcdfLogBetaBinomial_ffv_14;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_15> AgradCcdfLogBetaBinomial_ffv_15;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_16> AgradCcdfLogBetaBinomial_ffv_16;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_17> AgradCcdfLogBetaBinomial_ffv_17;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_18> AgradCcdfLogBetaBinomial_ffv_18;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_19> AgradCcdfLogBetaBinomial_ffv_19;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_20> AgradCcdfLogBetaBinomial_ffv_20;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_21> AgradCcdfLogBetaBinomial_ffv_21;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_22> AgradCcdfLogBetaBinomial_ffv_22;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_23> AgradCcdfLogBetaBinomial_ffv_23;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_24> AgradCcdfLogBetaBinomial_ffv_24;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_25> AgradCcdfLogBetaBinomial_ffv_25;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_26> AgradCcdfLogBetaBinomial_ffv_26;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_27> AgradCcdfLogBetaBinomial_ffv_27;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_28> AgradCcdfLogBetaBinomial_ffv_28;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_29> AgradCcdfLogBetaBinomial_ffv_29;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_30> AgradCcdfLogBetaBinomial_ffv_30;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_31> AgradCcdfLogBetaBinomial_ffv_31;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_32> AgradCcdfLogBetaBinomial_ffv_32;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_33> AgradCcdfLogBetaBinomial_ffv_33;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_34> AgradCcdfLogBetaBinomial_ffv_34;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_35> AgradCcdfLogBetaBinomial_ffv_35;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_36> AgradCcdfLogBetaBinomial_ffv_36;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_37> AgradCcdfLogBetaBinomial_ffv_37;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_38> AgradCcdfLogBetaBinomial_ffv_38;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_39> AgradCcdfLogBetaBinomial_ffv_39;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_40> AgradCcdfLogBetaBinomial_ffv_40;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_41> AgradCcdfLogBetaBinomial_ffv_41;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_42> AgradCcdfLogBetaBinomial_ffv_42;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_43> AgradCcdfLogBetaBinomial_ffv_43;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_44> AgradCcdfLogBetaBinomial_ffv_44;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_45> AgradCcdfLogBetaBinomial_ffv_45;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_46> AgradCcdfLogBetaBinomial_ffv_46;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_47> AgradCcdfLogBetaBinomial_ffv_47;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_48> AgradCcdfLogBetaBinomial_ffv_48;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_49> AgradCcdfLogBetaBinomial_ffv_49;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_50> AgradCcdfLogBetaBinomial_ffv_50;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_51> AgradCcdfLogBetaBinomial_ffv_51;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_52> AgradCcdfLogBetaBinomial_ffv_52;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_53> AgradCcdfLogBetaBinomial_ffv_53;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_54> AgradCcdfLogBetaBinomial_ffv_54;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_55> AgradCcdfLogBetaBinomial_ffv_55;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_56> AgradCcdfLogBetaBinomial_ffv_56;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_57> AgradCcdfLogBetaBinomial_ffv_57;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_58> AgradCcdfLogBetaBinomial_ffv_58;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_59> AgradCcdfLogBetaBinomial_ffv_59;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_60> AgradCcdfLogBetaBinomial_ffv_60;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_61> AgradCcdfLogBetaBinomial_ffv_61;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_62> AgradCcdfLogBetaBinomial_ffv_62;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_63> AgradCcdfLogBetaBinomial_ffv_63;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_64> AgradCcdfLogBetaBinomial_ffv_64;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_65> AgradCcdfLogBetaBinomial_ffv_65;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_66> AgradCcdfLogBetaBinomial_ffv_66;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_67> AgradCcdfLogBetaBinomial_ffv_67;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_68> AgradCcdfLogBetaBinomial_ffv_68;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_69> AgradCcdfLogBetaBinomial_ffv_69;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_70> AgradCcdfLogBetaBinomial_ffv_70;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_71> AgradCcdfLogBetaBinomial_ffv_71;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_72> AgradCcdfLogBetaBinomial_ffv_72;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_73> AgradCcdfLogBetaBinomial_ffv_73;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_74> AgradCcdfLogBetaBinomial_ffv_74;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_75> AgradCcdfLogBetaBinomial_ffv_75;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_76> AgradCcdfLogBetaBinomial_ffv_76;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_77> AgradCcdfLogBetaBinomial_ffv_77;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_78> AgradCcdfLogBetaBinomial_ffv_78;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_79> AgradCcdfLogBetaBinomial_ffv_79;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_80> AgradCcdfLogBetaBinomial_ffv_80;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_81> AgradCcdfLogBetaBinomial_ffv_81;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_82> AgradCcdfLogBetaBinomial_ffv_82;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_83> AgradCcdfLogBetaBinomial_ffv_83;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_84> AgradCcdfLogBetaBinomial_ffv_84;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_85> AgradCcdfLogBetaBinomial_ffv_85;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_86> AgradCcdfLogBetaBinomial_ffv_86;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_87> AgradCcdfLogBetaBinomial_ffv_87;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_88> AgradCcdfLogBetaBinomial_ffv_88;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_89> AgradCcdfLogBetaBinomial_ffv_89;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_90> AgradCcdfLogBetaBinomial_ffv_90;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_91> AgradCcdfLogBetaBinomial_ffv_91;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_92> AgradCcdfLogBetaBinomial_ffv_92;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_93> AgradCcdfLogBetaBinomial_ffv_93;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_94> AgradCcdfLogBetaBinomial_ffv_94;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_95> AgradCcdfLogBetaBinomial_ffv_95;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_96> AgradCcdfLogBetaBinomial_ffv_96;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_97> AgradCcdfLogBetaBinomial_ffv_97;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_98> AgradCcdfLogBetaBinomial_ffv_98;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_99> AgradCcdfLogBetaBinomial_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_99);
+
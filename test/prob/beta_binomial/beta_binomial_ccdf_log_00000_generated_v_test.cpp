@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, int, double, double, empty, empty> type_v_0;
+typedef std::tuple<int, int, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<int, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<int, int, double, var, empty, empty> type_v_3;
+typedef std::tuple<int, int, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<int, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<int, int, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<int, int, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<int, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<int, int, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<int, int, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<int, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<int, int, var, double, empty, empty> type_v_18;
+typedef std::tuple<int, int, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<int, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<int, int, var, var, empty, empty> type_v_21;
+typedef std::tuple<int, int, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<int, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<int, int, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<int, int, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<int, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<int, int, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<int, int, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<int, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<int, std::vector<int>, double, double, empty, empty> type_v_36;
+typedef std::tuple<int, std::vector<int>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<int, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<int, std::vector<int>, double, var, empty, empty> type_v_39;
+typedef std::tuple<int, std::vector<int>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<int, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<int, std::vector<int>, var, double, empty, empty> type_v_54;
+typedef std::tuple<int, std::vector<int>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<int, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<int, std::vector<int>, var, var, empty, empty> type_v_57;
+typedef std::tuple<int, std::vector<int>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<int, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_0> AgradCcdfLogBetaBinomial_v_0;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_1> AgradCcdfLogBetaBinomial_v_1;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_2> AgradCcdfLogBetaBinomial_v_2;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_3> AgradCcdfLogBetaBinomial_v_3;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_4> AgradCcdfLogBetaBinomial_v_4;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_5> AgradCcdfLogBetaBinomial_v_5;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_6> AgradCcdfLogBetaBinomial_v_6;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_7> AgradCcdfLogBetaBinomial_v_7;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_8> AgradCcdfLogBetaBinomial_v_8;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_9> AgradCcdfLogBetaBinomial_v_9;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_10> AgradCcdfLogBetaBinomial_v_10;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_11> AgradCcdfLogBetaBinomial_v_11;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_12> AgradCcdfLogBetaBinomial_v_12;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_13> AgradCcdfLogBetaBinomial_v_13;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_14> AgradCcdfLogBetaBinomial_v_14;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_15> AgradCcdfLogBetaBinomial_v_15;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_16> AgradCcdfLogBetaBinomial_v_16;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_17> AgradCcdfLogBetaBinomial_v_17;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_18> AgradCcdfLogBetaBinomial_v_18;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_19> AgradCcdfLogBetaBinomial_v_19;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_20> AgradCcdfLogBetaBinomial_v_20;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_21> AgradCcdfLogBetaBinomial_v_21;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_22> AgradCcdfLogBetaBinomial_v_22;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_23> AgradCcdfLogBetaBinomial_v_23;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_24> AgradCcdfLogBetaBinomial_v_24;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_25> AgradCcdfLogBetaBinomial_v_25;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_26> AgradCcdfLogBetaBinomial_v_26;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_27> AgradCcdfLogBetaBinomial_v_27;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_28> AgradCcdfLogBetaBinomial_v_28;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_29> AgradCcdfLogBetaBinomial_v_29;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_30> AgradCcdfLogBetaBinomial_v_30;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_31> AgradCcdfLogBetaBinomial_v_31;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_32> AgradCcdfLogBetaBinomial_v_32;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_33> AgradCcdfLogBetaBinomial_v_33;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_34> AgradCcdfLogBetaBinomial_v_34;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_35> AgradCcdfLogBetaBinomial_v_35;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_36> AgradCcdfLogBetaBinomial_v_36;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_37> AgradCcdfLogBetaBinomial_v_37;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_38> AgradCcdfLogBetaBinomial_v_38;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_39> AgradCcdfLogBetaBinomial_v_39;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_40> AgradCcdfLogBetaBinomial_v_40;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_41> AgradCcdfLogBetaBinomial_v_41;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_42> AgradCcdfLogBetaBinomial_v_42;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_43> AgradCcdfLogBetaBinomial_v_43;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_44> AgradCcdfLogBetaBinomial_v_44;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_45> AgradCcdfLogBetaBinomial_v_45;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_46> AgradCcdfLogBetaBinomial_v_46;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_47> AgradCcdfLogBetaBinomial_v_47;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_48> AgradCcdfLogBetaBinomial_v_48;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_49> AgradCcdfLogBetaBinomial_v_49;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_50> AgradCcdfLogBetaBinomial_v_50;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_51> AgradCcdfLogBetaBinomial_v_51;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_52> AgradCcdfLogBetaBinomial_v_52;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_53> AgradCcdfLogBetaBinomial_v_53;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_54> AgradCcdfLogBetaBinomial_v_54;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_55> AgradCcdfLogBetaBinomial_v_55;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_56> AgradCcdfLogBetaBinomial_v_56;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_57> AgradCcdfLogBetaBinomial_v_57;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_58> AgradCcdfLogBetaBinomial_v_58;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_59> AgradCcdfLogBetaBinomial_v_59;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_60> AgradCcdfLogBetaBinomial_v_60;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_61> AgradCcdfLogBetaBinomial_v_61;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_62> AgradCcdfLogBetaBinomial_v_62;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_63> AgradCcdfLogBetaBinomial_v_63;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_64> AgradCcdfLogBetaBinomial_v_64;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_65> AgradCcdfLogBetaBinomial_v_65;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_66> AgradCcdfLogBetaBinomial_v_66;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_67> AgradCcdfLogBetaBinomial_v_67;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_68> AgradCcdfLogBetaBinomial_v_68;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_69> AgradCcdfLogBetaBinomial_v_69;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_70> AgradCcdfLogBetaBinomial_v_70;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_71> AgradCcdfLogBetaBinomial_v_71;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_72> AgradCcdfLogBetaBinomial_v_72;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_73> AgradCcdfLogBetaBinomial_v_73;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_74> AgradCcdfLogBetaBinomial_v_74;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_75> AgradCcdfLogBetaBinomial_v_75;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_76> AgradCcdfLogBetaBinomial_v_76;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_77> AgradCcdfLogBetaBinomial_v_77;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_78> AgradCcdfLogBetaBinomial_v_78;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_79> AgradCcdfLogBetaBinomial_v_79;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_80> AgradCcdfLogBetaBinomial_v_80;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_81> AgradCcdfLogBetaBinomial_v_81;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_82> AgradCcdfLogBetaBinomial_v_82;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_83> AgradCcdfLogBetaBinomial_v_83;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_84> AgradCcdfLogBetaBinomial_v_84;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_85> AgradCcdfLogBetaBinomial_v_85;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_86> AgradCcdfLogBetaBinomial_v_86;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_87> AgradCcdfLogBetaBinomial_v_87;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_88> AgradCcdfLogBetaBinomial_v_88;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_89> AgradCcdfLogBetaBinomial_v_89;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_90> AgradCcdfLogBetaBinomial_v_90;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_91> AgradCcdfLogBetaBinomial_v_91;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_92> AgradCcdfLogBetaBinomial_v_92;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_93> AgradCcdfLogBetaBinomial_v_93;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_94> AgradCcdfLogBetaBinomial_v_94;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_95> AgradCcdfLogBetaBinomial_v_95;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_96> AgradCcdfLogBetaBinomial_v_96;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_97> AgradCcdfLogBetaBinomial_v_97;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_98> AgradCcdfLogBetaBinomial_v_98;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_99> AgradCcdfLogBetaBinomial_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_0, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_1, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_2, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_3, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_4, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_5, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_6, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_7, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_8, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_9, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_10, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_11, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_12, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_13, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_14, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_15, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_16, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_17, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_18, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_19, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_20, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_21, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_22, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_23, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_24, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_25, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_26, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_27, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_28, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_29, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_30, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_31, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_32, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_33, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_34, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_35, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_36, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_37, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_38, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_39, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_40, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_41, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_42, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_43, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_44, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_45, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_46, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_47, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_48, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_49, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_50, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_51, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_52, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_53, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_54, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_55, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_56, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_57, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_58, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_59, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_60, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_61, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_62, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_63, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_64, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_65, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_66, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_67, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_68, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_69, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_70, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_71, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_72, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_73, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_74, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_75, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_76, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_77, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_78, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_79, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_80, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_81, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_82, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_83, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_84, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_85, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_86, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_87, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_88, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_89, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_90, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_91, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_92, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_93, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_94, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_95, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_96, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_97, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_98, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_99, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_99);
+
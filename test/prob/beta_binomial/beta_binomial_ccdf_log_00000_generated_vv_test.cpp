@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, int, double, var, empty, empty> type_vv_0;
+typedef std::tuple<int, int, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<int, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<int, int, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<int, int, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<int, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<int, int, var, double, empty, empty> type_vv_9;
+typedef std::tuple<int, int, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<int, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<int, int, var, var, empty, empty> type_vv_12;
+typedef std::tuple<int, int, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<int, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<int, int, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<int, int, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<int, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<int, int, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<int, int, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<int, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<int, std::vector<int>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<int, std::vector<int>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<int, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<int, std::vector<int>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<int, std::vector<int>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<int, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<int, std::vector<int>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<int, std::vector<int>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<int, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<std::vector<int>, int, double, var, empty, empty> type_vv_81;
+typedef std::tuple<std::vector<int>, int, double, std::vector<var>, empty, empty> type_vv_82;
+typedef std::tuple<std::vector<int>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_83;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, var, empty, empty> type_vv_84;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_87;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_88;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_89;
+typedef std::tuple<std::vector<int>, int, var, double, empty, empty> type_vv_90;
+typedef std::tuple<std::vector<int>, int, var, std::vector<double>, empty, empty> type_vv_91;
+typedef std::tuple<std::vector<int>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_92;
+typedef std::tuple<std::vector<int>, int, var, var, empty, empty> type_vv_93;
+typedef std::tuple<std::vector<int>, int, var, std::vector<var>, empty, empty> type_vv_94;
+typedef std::tuple<std::vector<int>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_95;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, double, empty, empty> type_vv_96;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<double>, empty, empty> type_vv_97;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_98;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, var, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_0> AgradCcdfLogBetaBinomial_vv_0;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_1> AgradCcdfLogBetaBinomial_vv_1;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_2> AgradCcdfLogBetaBinomial_vv_2;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_3> AgradCcdfLogBetaBinomial_vv_3;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_4> AgradCcdfLogBetaBinomial_vv_4;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_5> AgradCcdfLogBetaBinomial_vv_5;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_6> AgradCcdfLogBetaBinomial_vv_6;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_7> AgradCcdfLogBetaBinomial_vv_7;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_8> AgradCcdfLogBetaBinomial_vv_8;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_9> AgradCcdfLogBetaBinomial_vv_9;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_10> AgradCcdfLogBetaBinomial_vv_10;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_11> AgradCcdfLogBetaBinomial_vv_11;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_12> AgradCcdfLogBetaBinomial_vv_12;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_13> AgradCcdfLogBetaBinomial_vv_13;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_14> AgradCcdfLogBetaBinomial_vv_14;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_15> AgradCcdfLogBetaBinomial_vv_15;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_16> AgradCcdfLogBetaBinomial_vv_16;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_17> AgradCcdfLogBetaBinomial_vv_17;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_18> AgradCcdfLogBetaBinomial_vv_18;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_19> AgradCcdfLogBetaBinomial_vv_19;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_20> AgradCcdfLogBetaBinomial_vv_20;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_21> AgradCcdfLogBetaBinomial_vv_21;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_22> AgradCcdfLogBetaBinomial_vv_22;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_23> AgradCcdfLogBetaBinomial_vv_23;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_24> AgradCcdfLogBetaBinomial_vv_24;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_25> AgradCcdfLogBetaBinomial_vv_25;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_26> AgradCcdfLogBetaBinomial_vv_26;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_27> AgradCcdfLogBetaBinomial_vv_27;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_28> AgradCcdfLogBetaBinomial_vv_28;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_29> AgradCcdfLogBetaBinomial_vv_29;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_30> AgradCcdfLogBetaBinomial_vv_30;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_31> AgradCcdfLogBetaBinomial_vv_31;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_32> AgradCcdfLogBetaBinomial_vv_32;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_33> AgradCcdfLogBetaBinomial_vv_33;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_34> AgradCcdfLogBetaBinomial_vv_34;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_35> AgradCcdfLogBetaBinomial_vv_35;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_36> AgradCcdfLogBetaBinomial_vv_36;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_37> AgradCcdfLogBetaBinomial_vv_37;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_38> AgradCcdfLogBetaBinomial_vv_38;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_39> AgradCcdfLogBetaBinomial_vv_39;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_40> AgradCcdfLogBetaBinomial_vv_40;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_41> AgradCcdfLogBetaBinomial_vv_41;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_42> AgradCcdfLogBetaBinomial_vv_42;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_43> AgradCcdfLogBetaBinomial_vv_43;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_44> AgradCcdfLogBetaBinomial_vv_44;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_45> AgradCcdfLogBetaBinomial_vv_45;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_46> AgradCcdfLogBetaBinomial_vv_46;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_47> AgradCcdfLogBetaBinomial_vv_47;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_48> AgradCcdfLogBetaBinomial_vv_48;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_49> AgradCcdfLogBetaBinomial_vv_49;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_50> AgradCcdfLogBetaBinomial_vv_50;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_51> AgradCcdfLogBetaBinomial_vv_51;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_52> AgradCcdfLogBetaBinomial_vv_52;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_53> AgradCcdfLogBetaBinomial_vv_53;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_54> AgradCcdfLogBetaBinomial_vv_54;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_55> AgradCcdfLogBetaBinomial_vv_55;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_56> AgradCcdfLogBetaBinomial_vv_56;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_57> AgradCcdfLogBetaBinomial_vv_57;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_58> AgradCcdfLogBetaBinomial_vv_58;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_59> AgradCcdfLogBetaBinomial_vv_59;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_60> AgradCcdfLogBetaBinomial_vv_60;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_61> AgradCcdfLogBetaBinomial_vv_61;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_62> AgradCcdfLogBetaBinomial_vv_62;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_63> AgradCcdfLogBetaBinomial_vv_63;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_64> AgradCcdfLogBetaBinomial_vv_64;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_65> AgradCcdfLogBetaBinomial_vv_65;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_66> AgradCcdfLogBetaBinomial_vv_66;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_67> AgradCcdfLogBetaBinomial_vv_67;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_68> AgradCcdfLogBetaBinomial_vv_68;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_69> AgradCcdfLogBetaBinomial_vv_69;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_70> AgradCcdfLogBetaBinomial_vv_70;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_71> AgradCcdfLogBetaBinomial_vv_71;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_72> AgradCcdfLogBetaBinomial_vv_72;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_73> AgradCcdfLogBetaBinomial_vv_73;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_74> AgradCcdfLogBetaBinomial_vv_74;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_75> AgradCcdfLogBetaBinomial_vv_75;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_76> AgradCcdfLogBetaBinomial_vv_76;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_77> AgradCcdfLogBetaBinomial_vv_77;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_78> AgradCcdfLogBetaBinomial_vv_78;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_79> AgradCcdfLogBetaBinomial_vv_79;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_80> AgradCcdfLogBetaBinomial_vv_80;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_81> AgradCcdfLogBetaBinomial_vv_81;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_82> AgradCcdfLogBetaBinomial_vv_82;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_83> AgradCcdfLogBetaBinomial_vv_83;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_84> AgradCcdfLogBetaBinomial_vv_84;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_85> AgradCcdfLogBetaBinomial_vv_85;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_86> AgradCcdfLogBetaBinomial_vv_86;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_87> AgradCcdfLogBetaBinomial_vv_87;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_88> AgradCcdfLogBetaBinomial_vv_88;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_89> AgradCcdfLogBetaBinomial_vv_89;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_90> AgradCcdfLogBetaBinomial_vv_90;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_91> AgradCcdfLogBetaBinomial_vv_91;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_92> AgradCcdfLogBetaBinomial_vv_92;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_93> AgradCcdfLogBetaBinomial_vv_93;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_94> AgradCcdfLogBetaBinomial_vv_94;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_95> AgradCcdfLogBetaBinomial_vv_95;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_96> AgradCcdfLogBetaBinomial_vv_96;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_97> AgradCcdfLogBetaBinomial_vv_97;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_98> AgradCcdfLogBetaBinomial_vv_98;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_99> AgradCcdfLogBetaBinomial_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_100;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_102;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_103;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_105;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_106;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_111;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_112;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, double, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_153;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_154;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_156;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_157;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_159;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_160;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_100> AgradCcdfLogBetaBinomial_ffv_100;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_101> AgradCcdfLogBetaBinomial_ffv_101;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_102> AgradCcdfLogBetaBinomial_ffv_102;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_103> AgradCcdfLogBetaBinomial_ffv_103;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_104> AgradCcdfLogBetaBinomial_ffv_104;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_105> AgradCcdfLogBetaBinomial_ffv_105;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_106> AgradCcdfLogBetaBinomial_ffv_106;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_107> AgradCcdfLogBetaBinomial_ffv_107;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_108> AgradCcdfLogBetaBinomial_ffv_108;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_109> AgradCcdfLogBetaBinomial_ffv_109;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_110> AgradCcdfLogBetaBinomial_ffv_110;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_111> AgradCcdfLogBetaBinomial_ffv_111;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_112> AgradCcdfLogBetaBinomial_ffv_112;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_113> AgradCcdfLogBetaBinomial_ffv_113;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_114> AgradCcdfLogBetaBinomial_ffv_114;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_115> AgradCcdfLogBetaBinomial_ffv_115;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_116> AgradCcdfLogBetaBinomial_ffv_116;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_117> AgradCcdfLogBetaBinomial_ffv_117;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_118> AgradCcdfLogBetaBinomial_ffv_118;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_119> AgradCcdfLogBetaBinomial_ffv_119;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_120> AgradCcdfLogBetaBinomial_ffv_120;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_121> AgradCcdfLogBetaBinomial_ffv_121;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_122> AgradCcdfLogBetaBinomial_ffv_122;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_123> AgradCcdfLogBetaBinomial_ffv_123;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_124> AgradCcdfLogBetaBinomial_ffv_124;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_125> AgradCcdfLogBetaBinomial_ffv_125;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_126> AgradCcdfLogBetaBinomial_ffv_126;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_127> AgradCcdfLogBetaBinomial_ffv_127;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_128> AgradCcdfLogBetaBinomial_ffv_128;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_129> AgradCcdfLogBetaBinomial_ffv_129;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_130> AgradCcdfLogBetaBinomial_ffv_130;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_131> AgradCcdfLogBetaBinomial_ffv_131;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_132> AgradCcdfLogBetaBinomial_ffv_132;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_133> AgradCcdfLogBetaBinomial_ffv_133;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_134> AgradCcdfLogBetaBinomial_ffv_134;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_135> AgradCcdfLogBetaBinomial_ffv_135;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_136> AgradCcdfLogBetaBinomial_ffv_136;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_137> AgradCcdfLogBetaBinomial_ffv_137;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_138> AgradCcdfLogBetaBinomial_ffv_138;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_139> AgradCcdfLogBetaBinomial_ffv_139;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_140> AgradCcdfLogBetaBinomial_ffv_140;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_141> AgradCcdfLogBetaBinomial_ffv_141;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_142> AgradCcdfLogBetaBinomial_ffv_142;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_143> AgradCcdfLogBetaBinomial_ffv_143;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_144> AgradCcdfLogBetaBinomial_ffv_144;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_145> AgradCcdfLogBetaBinomial_ffv_145;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_146> AgradCcdfLogBetaBinomial_ffv_146;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_147> AgradCcdfLogBetaBinomial_ffv_147;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_148> AgradCcdfLogBetaBinomial_ffv_148;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_149> AgradCcdfLogBetaBinomial_ffv_149;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_150> AgradCcdfLogBetaBinomial_ffv_150;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_151> AgradCcdfLogBetaBinomial_ffv_151;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_152> AgradCcdfLogBetaBinomial_ffv_152;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_153> AgradCcdfLogBetaBinomial_ffv_153;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_154> AgradCcdfLogBetaBinomial_ffv_154;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_155> AgradCcdfLogBetaBinomial_ffv_155;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_156> AgradCcdfLogBetaBinomial_ffv_156;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_157> AgradCcdfLogBetaBinomial_ffv_157;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_158> AgradCcdfLogBetaBinomial_ffv_158;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_159> AgradCcdfLogBetaBinomial_ffv_159;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_160> AgradCcdfLogBetaBinomial_ffv_160;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_161> AgradCcdfLogBetaBinomial_ffv_161;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_162> AgradCcdfLogBetaBinomial_ffv_162;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_163> AgradCcdfLogBetaBinomial_ffv_163;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_164> AgradCcdfLogBetaBinomial_ffv_164;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_165> AgradCcdfLogBetaBinomial_ffv_165;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_166> AgradCcdfLogBetaBinomial_ffv_166;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_167> AgradCcdfLogBetaBinomial_ffv_167;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_168> AgradCcdfLogBetaBinomial_ffv_168;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_169> AgradCcdfLogBetaBinomial_ffv_169;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_170> AgradCcdfLogBetaBinomial_ffv_170;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_171> AgradCcdfLogBetaBinomial_ffv_171;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_172> AgradCcdfLogBetaBinomial_ffv_172;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_173> AgradCcdfLogBetaBinomial_ffv_173;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_174> AgradCcdfLogBetaBinomial_ffv_174;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_175> AgradCcdfLogBetaBinomial_ffv_175;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_176> AgradCcdfLogBetaBinomial_ffv_176;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_177> AgradCcdfLogBetaBinomial_ffv_177;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_178> AgradCcdfLogBetaBinomial_ffv_178;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_179> AgradCcdfLogBetaBinomial_ffv_179;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_180> AgradCcdfLogBetaBinomial_ffv_180;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_181> AgradCcdfLogBetaBinomial_ffv_181;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_182> AgradCcdfLogBetaBinomial_ffv_182;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_183> AgradCcdfLogBetaBinomial_ffv_183;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_184> AgradCcdfLogBetaBinomial_ffv_184;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_185> AgradCcdfLogBetaBinomial_ffv_185;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_186> AgradCcdfLogBetaBinomial_ffv_186;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_187> AgradCcdfLogBetaBinomial_ffv_187;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_188> AgradCcdfLogBetaBinomial_ffv_188;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_189> AgradCcdfLogBetaBinomial_ffv_189;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_190> AgradCcdfLogBetaBinomial_ffv_190;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_191> AgradCcdfLogBetaBinomial_ffv_191;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_192> AgradCcdfLogBetaBinomial_ffv_192;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_193> AgradCcdfLogBetaBinomial_ffv_193;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_194> AgradCcdfLogBetaBinomial_ffv_194;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_195> AgradCcdfLogBetaBinomial_ffv_195;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_196> AgradCcdfLogBetaBinomial_ffv_196;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_197> AgradCcdfLogBetaBinomial_ffv_197;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_198> AgradCcdfLogBetaBinomial_ffv_198;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_199> AgradCcdfLogBetaBinomial_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_189, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_190, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_191, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_192, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_193, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_194, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_195, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_196, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_197, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_198, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_199, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_199);
+
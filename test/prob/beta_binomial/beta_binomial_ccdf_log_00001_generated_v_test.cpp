@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<std::vector<int>, int, double, double, empty, empty> type_v_108;
+typedef std::tuple<std::vector<int>, int, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<std::vector<int>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<std::vector<int>, int, double, var, empty, empty> type_v_111;
+typedef std::tuple<std::vector<int>, int, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<std::vector<int>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<std::vector<int>, int, var, double, empty, empty> type_v_126;
+typedef std::tuple<std::vector<int>, int, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<std::vector<int>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<std::vector<int>, int, var, var, empty, empty> type_v_129;
+typedef std::tuple<std::vector<int>, int, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<std::vector<int>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, double, empty, empty> type_v_144;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, var, empty, empty> type_v_147;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, double, empty, empty> type_v_162;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, var, empty, empty> type_v_165;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_100> AgradCcdfLogBetaBinomial_v_100;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_101> AgradCcdfLogBetaBinomial_v_101;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_102> AgradCcdfLogBetaBinomial_v_102;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_103> AgradCcdfLogBetaBinomial_v_103;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_104> AgradCcdfLogBetaBinomial_v_104;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_105> AgradCcdfLogBetaBinomial_v_105;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_106> AgradCcdfLogBetaBinomial_v_106;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_107> AgradCcdfLogBetaBinomial_v_107;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_108> AgradCcdfLogBetaBinomial_v_108;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_109> AgradCcdfLogBetaBinomial_v_109;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_110> AgradCcdfLogBetaBinomial_v_110;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_111> AgradCcdfLogBetaBinomial_v_111;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_112> AgradCcdfLogBetaBinomial_v_112;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_113> AgradCcdfLogBetaBinomial_v_113;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_114> AgradCcdfLogBetaBinomial_v_114;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_115> AgradCcdfLogBetaBinomial_v_115;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_116> AgradCcdfLogBetaBinomial_v_116;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_117> AgradCcdfLogBetaBinomial_v_117;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_118> AgradCcdfLogBetaBinomial_v_118;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_119> AgradCcdfLogBetaBinomial_v_119;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_120> AgradCcdfLogBetaBinomial_v_120;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_121> AgradCcdfLogBetaBinomial_v_121;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_122> AgradCcdfLogBetaBinomial_v_122;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_123> AgradCcdfLogBetaBinomial_v_123;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_124> AgradCcdfLogBetaBinomial_v_124;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_125> AgradCcdfLogBetaBinomial_v_125;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_126> AgradCcdfLogBetaBinomial_v_126;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_127> AgradCcdfLogBetaBinomial_v_127;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_128> AgradCcdfLogBetaBinomial_v_128;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_129> AgradCcdfLogBetaBinomial_v_129;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_130> AgradCcdfLogBetaBinomial_v_130;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_131> AgradCcdfLogBetaBinomial_v_131;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_132> AgradCcdfLogBetaBinomial_v_132;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_133> AgradCcdfLogBetaBinomial_v_133;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_134> AgradCcdfLogBetaBinomial_v_134;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_135> AgradCcdfLogBetaBinomial_v_135;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_136> AgradCcdfLogBetaBinomial_v_136;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_137> AgradCcdfLogBetaBinomial_v_137;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_138> AgradCcdfLogBetaBinomial_v_138;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_139> AgradCcdfLogBetaBinomial_v_139;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_140> AgradCcdfLogBetaBinomial_v_140;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_141> AgradCcdfLogBetaBinomial_v_141;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_142> AgradCcdfLogBetaBinomial_v_142;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_143> AgradCcdfLogBetaBinomial_v_143;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_144> AgradCcdfLogBetaBinomial_v_144;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_145> AgradCcdfLogBetaBinomial_v_145;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_146> AgradCcdfLogBetaBinomial_v_146;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_147> AgradCcdfLogBetaBinomial_v_147;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_148> AgradCcdfLogBetaBinomial_v_148;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_149> AgradCcdfLogBetaBinomial_v_149;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_150> AgradCcdfLogBetaBinomial_v_150;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_151> AgradCcdfLogBetaBinomial_v_151;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_152> AgradCcdfLogBetaBinomial_v_152;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_153> AgradCcdfLogBetaBinomial_v_153;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_154> AgradCcdfLogBetaBinomial_v_154;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_155> AgradCcdfLogBetaBinomial_v_155;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_156> AgradCcdfLogBetaBinomial_v_156;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_157> AgradCcdfLogBetaBinomial_v_157;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_158> AgradCcdfLogBetaBinomial_v_158;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_159> AgradCcdfLogBetaBinomial_v_159;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_160> AgradCcdfLogBetaBinomial_v_160;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_161> AgradCcdfLogBetaBinomial_v_161;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_162> AgradCcdfLogBetaBinomial_v_162;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_163> AgradCcdfLogBetaBinomial_v_163;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_164> AgradCcdfLogBetaBinomial_v_164;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_165> AgradCcdfLogBetaBinomial_v_165;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_166> AgradCcdfLogBetaBinomial_v_166;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_167> AgradCcdfLogBetaBinomial_v_167;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_168> AgradCcdfLogBetaBinomial_v_168;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_169> AgradCcdfLogBetaBinomial_v_169;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_170> AgradCcdfLogBetaBinomial_v_170;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_171> AgradCcdfLogBetaBinomial_v_171;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_172> AgradCcdfLogBetaBinomial_v_172;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_173> AgradCcdfLogBetaBinomial_v_173;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_174> AgradCcdfLogBetaBinomial_v_174;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_175> AgradCcdfLogBetaBinomial_v_175;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_176> AgradCcdfLogBetaBinomial_v_176;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_177> AgradCcdfLogBetaBinomial_v_177;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_178> AgradCcdfLogBetaBinomial_v_178;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_179> AgradCcdfLogBetaBinomial_v_179;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_180> AgradCcdfLogBetaBinomial_v_180;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_181> AgradCcdfLogBetaBinomial_v_181;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_182> AgradCcdfLogBetaBinomial_v_182;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_183> AgradCcdfLogBetaBinomial_v_183;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_184> AgradCcdfLogBetaBinomial_v_184;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_185> AgradCcdfLogBetaBinomial_v_185;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_186> AgradCcdfLogBetaBinomial_v_186;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_187> AgradCcdfLogBetaBinomial_v_187;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_188> AgradCcdfLogBetaBinomial_v_188;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_189> AgradCcdfLogBetaBinomial_v_189;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_190> AgradCcdfLogBetaBinomial_v_190;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_191> AgradCcdfLogBetaBinomial_v_191;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_192> AgradCcdfLogBetaBinomial_v_192;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_193> AgradCcdfLogBetaBinomial_v_193;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_194> AgradCcdfLogBetaBinomial_v_194;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_195> AgradCcdfLogBetaBinomial_v_195;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_196> AgradCcdfLogBetaBinomial_v_196;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_197> AgradCcdfLogBetaBinomial_v_197;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_198> AgradCcdfLogBetaBinomial_v_198;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_199> AgradCcdfLogBetaBinomial_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_100, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_101, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_102, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_103, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_104, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_105, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_106, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_107, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_108, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_109, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_110, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_111, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_112, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_113, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_114, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_115, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_116, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_117, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_118, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_119, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_120, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_121, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_122, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_123, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_124, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_125, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_126, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_127, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_128, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_129, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_130, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_131, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_132, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_133, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_134, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_135, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_136, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_137, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_138, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_139, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_140, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_141, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_142, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_143, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_144, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_145, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_146, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_147, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_148, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_149, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_150, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_151, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_152, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_153, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_154, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_155, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_156, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_157, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_158, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_159, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_160, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_161, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_162, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_163, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_164, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_165, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_166, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_167, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_168, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_169, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_170, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_171, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_172, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_173, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_174, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_175, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_176, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_177, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_178, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_179, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_180, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_181, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_182, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_183, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_184, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_185, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_186, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_187, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_188, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_189, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_190, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_191, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_192, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_193, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_194, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_195, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_196, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_197, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_198, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_199, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_199);
+
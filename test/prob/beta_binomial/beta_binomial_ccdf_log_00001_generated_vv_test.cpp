@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<var>, empty, empty> type_vv_100;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_101;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_102;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_103;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_104;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_105;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_106;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_107;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, var, empty, empty> type_vv_108;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, var, empty, empty> type_vv_111;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_vv_112;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_113;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_114;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, double, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, var, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, double, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, var, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_152;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_153;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_154;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_155;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_156;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_157;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_158;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_159;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_160;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_161;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, var, empty, empty> type_vv_162;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty, empty> type_vv_165;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty, empty> type_vv_166;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_167;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, double, empty, empty> type_vv_171;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, var, empty, empty> type_vv_174;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty, empty> type_vv_189;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty, empty> type_vv_198;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_100> AgradCcdfLogBetaBinomial_vv_100;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_101> AgradCcdfLogBetaBinomial_vv_101;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_102> AgradCcdfLogBetaBinomial_vv_102;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_103> AgradCcdfLogBetaBinomial_vv_103;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_104> AgradCcdfLogBetaBinomial_vv_104;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_105> AgradCcdfLogBetaBinomial_vv_105;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_106> AgradCcdfLogBetaBinomial_vv_106;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_107> AgradCcdfLogBetaBinomial_vv_107;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_108> AgradCcdfLogBetaBinomial_vv_108;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_109> AgradCcdfLogBetaBinomial_vv_109;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_110> AgradCcdfLogBetaBinomial_vv_110;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_111> AgradCcdfLogBetaBinomial_vv_111;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_112> AgradCcdfLogBetaBinomial_vv_112;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_113> AgradCcdfLogBetaBinomial_vv_113;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_114> AgradCcdfLogBetaBinomial_vv_114;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_115> AgradCcdfLogBetaBinomial_vv_115;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_116> AgradCcdfLogBetaBinomial_vv_116;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_117> AgradCcdfLogBetaBinomial_vv_117;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_118> AgradCcdfLogBetaBinomial_vv_118;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_119> AgradCcdfLogBetaBinomial_vv_119;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_120> AgradCcdfLogBetaBinomial_vv_120;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_121> AgradCcdfLogBetaBinomial_vv_121;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_122> AgradCcdfLogBetaBinomial_vv_122;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_123> AgradCcdfLogBetaBinomial_vv_123;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_124> AgradCcdfLogBetaBinomial_vv_124;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_125> AgradCcdfLogBetaBinomial_vv_125;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_126> AgradCcdfLogBetaBinomial_vv_126;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_127> AgradCcdfLogBetaBinomial_vv_127;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_128> AgradCcdfLogBetaBinomial_vv_128;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_129> AgradCcdfLogBetaBinomial_vv_129;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_130> AgradCcdfLogBetaBinomial_vv_130;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_131> AgradCcdfLogBetaBinomial_vv_131;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_132> AgradCcdfLogBetaBinomial_vv_132;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_133> AgradCcdfLogBetaBinomial_vv_133;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_134> AgradCcdfLogBetaBinomial_vv_134;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_135> AgradCcdfLogBetaBinomial_vv_135;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_136> AgradCcdfLogBetaBinomial_vv_136;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_137> AgradCcdfLogBetaBinomial_vv_137;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_138> AgradCcdfLogBetaBinomial_vv_138;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_139> AgradCcdfLogBetaBinomial_vv_139;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_140> AgradCcdfLogBetaBinomial_vv_140;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_141> AgradCcdfLogBetaBinomial_vv_141;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_142> AgradCcdfLogBetaBinomial_vv_142;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_143> AgradCcdfLogBetaBinomial_vv_143;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_144> AgradCcdfLogBetaBinomial_vv_144;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_145> AgradCcdfLogBetaBinomial_vv_145;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_146> AgradCcdfLogBetaBinomial_vv_146;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_147> AgradCcdfLogBetaBinomial_vv_147;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_148> AgradCcdfLogBetaBinomial_vv_148;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_149> AgradCcdfLogBetaBinomial_vv_149;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_150> AgradCcdfLogBetaBinomial_vv_150;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_151> AgradCcdfLogBetaBinomial_vv_151;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_152> AgradCcdfLogBetaBinomial_vv_152;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_153> AgradCcdfLogBetaBinomial_vv_153;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_154> AgradCcdfLogBetaBinomial_vv_154;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_155> AgradCcdfLogBetaBinomial_vv_155;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_156> AgradCcdfLogBetaBinomial_vv_156;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_157> AgradCcdfLogBetaBinomial_vv_157;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_158> AgradCcdfLogBetaBinomial_vv_158;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_159> AgradCcdfLogBetaBinomial_vv_159;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_160> AgradCcdfLogBetaBinomial_vv_160;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_161> AgradCcdfLogBetaBinomial_vv_161;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_162> AgradCcdfLogBetaBinomial_vv_162;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_163> AgradCcdfLogBetaBinomial_vv_163;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_164> AgradCcdfLogBetaBinomial_vv_164;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_165> AgradCcdfLogBetaBinomial_vv_165;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_166> AgradCcdfLogBetaBinomial_vv_166;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_167> AgradCcdfLogBetaBinomial_vv_167;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_168> AgradCcdfLogBetaBinomial_vv_168;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_169> AgradCcdfLogBetaBinomial_vv_169;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_170> AgradCcdfLogBetaBinomial_vv_170;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_171> AgradCcdfLogBetaBinomial_vv_171;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_172> AgradCcdfLogBetaBinomial_vv_172;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_173> AgradCcdfLogBetaBinomial_vv_173;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_174> AgradCcdfLogBetaBinomial_vv_174;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_175> AgradCcdfLogBetaBinomial_vv_175;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_176> AgradCcdfLogBetaBinomial_vv_176;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_177> AgradCcdfLogBetaBinomial_vv_177;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_178> AgradCcdfLogBetaBinomial_vv_178;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_179> AgradCcdfLogBetaBinomial_vv_179;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_180> AgradCcdfLogBetaBinomial_vv_180;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_181> AgradCcdfLogBetaBinomial_vv_181;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_182> AgradCcdfLogBetaBinomial_vv_182;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_183> AgradCcdfLogBetaBinomial_vv_183;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_184> AgradCcdfLogBetaBinomial_vv_184;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_185> AgradCcdfLogBetaBinomial_vv_185;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_186> AgradCcdfLogBetaBinomial_vv_186;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_187> AgradCcdfLogBetaBinomial_vv_187;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_188> AgradCcdfLogBetaBinomial_vv_188;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_189> AgradCcdfLogBetaBinomial_vv_189;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_190> AgradCcdfLogBetaBinomial_vv_190;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_191> AgradCcdfLogBetaBinomial_vv_191;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_192> AgradCcdfLogBetaBinomial_vv_192;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_193> AgradCcdfLogBetaBinomial_vv_193;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_194> AgradCcdfLogBetaBinomial_vv_194;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_195> AgradCcdfLogBetaBinomial_vv_195;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_196> AgradCcdfLogBetaBinomial_vv_196;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_197> AgradCcdfLogBetaBinomial_vv_197;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_198> AgradCcdfLogBetaBinomial_vv_198;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_199> AgradCcdfLogBetaBinomial_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_189, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_190, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_191, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_192, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_193, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_194, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_195, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_196, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_197, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_198, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_199, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_199);
+
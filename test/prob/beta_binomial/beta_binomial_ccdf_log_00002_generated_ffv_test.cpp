@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_200> AgradCcdfLogBetaBinomial_ffv_200;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_201> AgradCcdfLogBetaBinomial_ffv_201;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_202> AgradCcdfLogBetaBinomial_ffv_202;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_203> AgradCcdfLogBetaBinomial_ffv_203;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_204> AgradCcdfLogBetaBinomial_ffv_204;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_205> AgradCcdfLogBetaBinomial_ffv_205;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_206> AgradCcdfLogBetaBinomial_ffv_206;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_207> AgradCcdfLogBetaBinomial_ffv_207;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_208> AgradCcdfLogBetaBinomial_ffv_208;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_209> AgradCcdfLogBetaBinomial_ffv_209;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_210> AgradCcdfLogBetaBinomial_ffv_210;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_211> AgradCcdfLogBetaBinomial_ffv_211;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_212> AgradCcdfLogBetaBinomial_ffv_212;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_213> AgradCcdfLogBetaBinomial_ffv_213;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_214> AgradCcdfLogBetaBinomial_ffv_214;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_215> AgradCcdfLogBetaBinomial_ffv_215;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_216> AgradCcdfLogBetaBinomial_ffv_216;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_217> AgradCcdfLogBetaBinomial_ffv_217;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_218> AgradCcdfLogBetaBinomial_ffv_218;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_219> AgradCcdfLogBetaBinomial_ffv_219;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_220> AgradCcdfLogBetaBinomial_ffv_220;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_221> AgradCcdfLogBetaBinomial_ffv_221;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_222> AgradCcdfLogBetaBinomial_ffv_222;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_223> AgradCcdfLogBetaBinomial_ffv_223;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_224> AgradCcdfLogBetaBinomial_ffv_224;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_225> AgradCcdfLogBetaBinomial_ffv_225;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_226> AgradCcdfLogBetaBinomial_ffv_226;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_227> AgradCcdfLogBetaBinomial_ffv_227;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_228> AgradCcdfLogBetaBinomial_ffv_228;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_229> AgradCcdfLogBetaBinomial_ffv_229;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_230> AgradCcdfLogBetaBinomial_ffv_230;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_231> AgradCcdfLogBetaBinomial_ffv_231;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_232> AgradCcdfLogBetaBinomial_ffv_232;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_233> AgradCcdfLogBetaBinomial_ffv_233;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_234> AgradCcdfLogBetaBinomial_ffv_234;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_235> AgradCcdfLogBetaBinomial_ffv_235;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_236> AgradCcdfLogBetaBinomial_ffv_236;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_237> AgradCcdfLogBetaBinomial_ffv_237;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_238> AgradCcdfLogBetaBinomial_ffv_238;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_239> AgradCcdfLogBetaBinomial_ffv_239;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_240> AgradCcdfLogBetaBinomial_ffv_240;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_241> AgradCcdfLogBetaBinomial_ffv_241;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_ffv_242> AgradCcdfLogBetaBinomial_ffv_242;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_200, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_201, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_202, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_203, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_204, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_205, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_206, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_207, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_208, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_209, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_210, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_211, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_212, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_213, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_214, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_215, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_216, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_217, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_218, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_219, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_220, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_221, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_222, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_223, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_224, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_225, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_226, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_227, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_228, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_229, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_230, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_231, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_232, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_233, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_234, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_235, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_236, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_237, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_238, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_239, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_240, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_241, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_ffv_242, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_ffv_242);
+
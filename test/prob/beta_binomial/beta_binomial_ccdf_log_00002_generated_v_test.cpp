@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, double, empty, empty> type_v_216;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, var, empty, empty> type_v_219;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, double, empty, empty> type_v_234;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, var, empty, empty> type_v_237;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty, empty> type_v_252;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty, empty> type_v_255;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty, empty> type_v_270;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty, empty> type_v_273;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_200> AgradCcdfLogBetaBinomial_v_200;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_201> AgradCcdfLogBetaBinomial_v_201;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_202> AgradCcdfLogBetaBinomial_v_202;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_203> AgradCcdfLogBetaBinomial_v_203;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_204> AgradCcdfLogBetaBinomial_v_204;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_205> AgradCcdfLogBetaBinomial_v_205;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_206> AgradCcdfLogBetaBinomial_v_206;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_207> AgradCcdfLogBetaBinomial_v_207;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_208> AgradCcdfLogBetaBinomial_v_208;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_209> AgradCcdfLogBetaBinomial_v_209;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_210> AgradCcdfLogBetaBinomial_v_210;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_211> AgradCcdfLogBetaBinomial_v_211;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_212> AgradCcdfLogBetaBinomial_v_212;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_213> AgradCcdfLogBetaBinomial_v_213;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_214> AgradCcdfLogBetaBinomial_v_214;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_215> AgradCcdfLogBetaBinomial_v_215;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_216> AgradCcdfLogBetaBinomial_v_216;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_217> AgradCcdfLogBetaBinomial_v_217;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_218> AgradCcdfLogBetaBinomial_v_218;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_219> AgradCcdfLogBetaBinomial_v_219;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_220> AgradCcdfLogBetaBinomial_v_220;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_221> AgradCcdfLogBetaBinomial_v_221;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_222> AgradCcdfLogBetaBinomial_v_222;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_223> AgradCcdfLogBetaBinomial_v_223;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_224> AgradCcdfLogBetaBinomial_v_224;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_225> AgradCcdfLogBetaBinomial_v_225;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_226> AgradCcdfLogBetaBinomial_v_226;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_227> AgradCcdfLogBetaBinomial_v_227;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_228> AgradCcdfLogBetaBinomial_v_228;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_229> AgradCcdfLogBetaBinomial_v_229;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_230> AgradCcdfLogBetaBinomial_v_230;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_231> AgradCcdfLogBetaBinomial_v_231;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_232> AgradCcdfLogBetaBinomial_v_232;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_233> AgradCcdfLogBetaBinomial_v_233;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_234> AgradCcdfLogBetaBinomial_v_234;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_235> AgradCcdfLogBetaBinomial_v_235;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_236> AgradCcdfLogBetaBinomial_v_236;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_237> AgradCcdfLogBetaBinomial_v_237;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_238> AgradCcdfLogBetaBinomial_v_238;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_239> AgradCcdfLogBetaBinomial_v_239;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_240> AgradCcdfLogBetaBinomial_v_240;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_241> AgradCcdfLogBetaBinomial_v_241;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_242> AgradCcdfLogBetaBinomial_v_242;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_243> AgradCcdfLogBetaBinomial_v_243;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_244> AgradCcdfLogBetaBinomial_v_244;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_245> AgradCcdfLogBetaBinomial_v_245;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_246> AgradCcdfLogBetaBinomial_v_246;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_247> AgradCcdfLogBetaBinomial_v_247;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_248> AgradCcdfLogBetaBinomial_v_248;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_249> AgradCcdfLogBetaBinomial_v_249;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_250> AgradCcdfLogBetaBinomial_v_250;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_251> AgradCcdfLogBetaBinomial_v_251;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_252> AgradCcdfLogBetaBinomial_v_252;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_253> AgradCcdfLogBetaBinomial_v_253;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_254> AgradCcdfLogBetaBinomial_v_254;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_255> AgradCcdfLogBetaBinomial_v_255;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_256> AgradCcdfLogBetaBinomial_v_256;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_257> AgradCcdfLogBetaBinomial_v_257;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_258> AgradCcdfLogBetaBinomial_v_258;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_259> AgradCcdfLogBetaBinomial_v_259;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_260> AgradCcdfLogBetaBinomial_v_260;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_261> AgradCcdfLogBetaBinomial_v_261;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_262> AgradCcdfLogBetaBinomial_v_262;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_263> AgradCcdfLogBetaBinomial_v_263;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_264> AgradCcdfLogBetaBinomial_v_264;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_265> AgradCcdfLogBetaBinomial_v_265;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_266> AgradCcdfLogBetaBinomial_v_266;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_267> AgradCcdfLogBetaBinomial_v_267;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_268> AgradCcdfLogBetaBinomial_v_268;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_269> AgradCcdfLogBetaBinomial_v_269;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_270> AgradCcdfLogBetaBinomial_v_270;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_271> AgradCcdfLogBetaBinomial_v_271;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_272> AgradCcdfLogBetaBinomial_v_272;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_273> AgradCcdfLogBetaBinomial_v_273;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_274> AgradCcdfLogBetaBinomial_v_274;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_275> AgradCcdfLogBetaBinomial_v_275;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_276> AgradCcdfLogBetaBinomial_v_276;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_277> AgradCcdfLogBetaBinomial_v_277;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_278> AgradCcdfLogBetaBinomial_v_278;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_279> AgradCcdfLogBetaBinomial_v_279;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_280> AgradCcdfLogBetaBinomial_v_280;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_281> AgradCcdfLogBetaBinomial_v_281;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_282> AgradCcdfLogBetaBinomial_v_282;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_283> AgradCcdfLogBetaBinomial_v_283;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_284> AgradCcdfLogBetaBinomial_v_284;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_285> AgradCcdfLogBetaBinomial_v_285;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_286> AgradCcdfLogBetaBinomial_v_286;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_287> AgradCcdfLogBetaBinomial_v_287;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_288> AgradCcdfLogBetaBinomial_v_288;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_289> AgradCcdfLogBetaBinomial_v_289;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_290> AgradCcdfLogBetaBinomial_v_290;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_291> AgradCcdfLogBetaBinomial_v_291;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_292> AgradCcdfLogBetaBinomial_v_292;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_293> AgradCcdfLogBetaBinomial_v_293;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_294> AgradCcdfLogBetaBinomial_v_294;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_295> AgradCcdfLogBetaBinomial_v_295;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_296> AgradCcdfLogBetaBinomial_v_296;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_297> AgradCcdfLogBetaBinomial_v_297;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_298> AgradCcdfLogBetaBinomial_v_298;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_299> AgradCcdfLogBetaBinomial_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_200, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_201, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_202, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_203, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_204, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_205, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_206, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_207, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_208, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_209, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_210, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_211, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_212, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_213, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_214, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_215, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_216, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_217, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_218, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_219, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_220, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_221, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_222, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_223, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_224, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_225, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_226, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_227, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_228, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_229, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_230, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_231, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_232, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_233, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_234, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_235, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_236, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_237, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_238, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_239, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_240, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_241, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_242, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_243, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_244, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_245, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_246, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_247, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_248, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_249, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_250, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_251, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_252, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_253, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_254, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_255, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_256, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_257, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_258, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_259, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_260, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_261, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_262, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_263, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_264, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_265, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_266, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_267, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_268, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_269, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_270, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_271, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_272, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_273, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_274, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_275, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_276, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_277, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_278, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_279, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_280, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_281, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_282, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_283, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_284, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_285, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_286, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_287, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_288, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_289, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_290, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_291, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_292, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_293, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_294, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_295, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_296, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_297, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_298, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_299, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_299);
+
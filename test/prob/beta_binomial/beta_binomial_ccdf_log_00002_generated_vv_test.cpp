@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty, empty> type_vv_201;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_200> AgradCcdfLogBetaBinomial_vv_200;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_201> AgradCcdfLogBetaBinomial_vv_201;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_202> AgradCcdfLogBetaBinomial_vv_202;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_203> AgradCcdfLogBetaBinomial_vv_203;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_204> AgradCcdfLogBetaBinomial_vv_204;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_205> AgradCcdfLogBetaBinomial_vv_205;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_206> AgradCcdfLogBetaBinomial_vv_206;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_207> AgradCcdfLogBetaBinomial_vv_207;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_208> AgradCcdfLogBetaBinomial_vv_208;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_209> AgradCcdfLogBetaBinomial_vv_209;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_210> AgradCcdfLogBetaBinomial_vv_210;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_211> AgradCcdfLogBetaBinomial_vv_211;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_212> AgradCcdfLogBetaBinomial_vv_212;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_213> AgradCcdfLogBetaBinomial_vv_213;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_214> AgradCcdfLogBetaBinomial_vv_214;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_215> AgradCcdfLogBetaBinomial_vv_215;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_216> AgradCcdfLogBetaBinomial_vv_216;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_217> AgradCcdfLogBetaBinomial_vv_217;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_218> AgradCcdfLogBetaBinomial_vv_218;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_219> AgradCcdfLogBetaBinomial_vv_219;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_220> AgradCcdfLogBetaBinomial_vv_220;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_221> AgradCcdfLogBetaBinomial_vv_221;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_222> AgradCcdfLogBetaBinomial_vv_222;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_223> AgradCcdfLogBetaBinomial_vv_223;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_224> AgradCcdfLogBetaBinomial_vv_224;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_225> AgradCcdfLogBetaBinomial_vv_225;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_226> AgradCcdfLogBetaBinomial_vv_226;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_227> AgradCcdfLogBetaBinomial_vv_227;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_228> AgradCcdfLogBetaBinomial_vv_228;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_229> AgradCcdfLogBetaBinomial_vv_229;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_230> AgradCcdfLogBetaBinomial_vv_230;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_231> AgradCcdfLogBetaBinomial_vv_231;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_232> AgradCcdfLogBetaBinomial_vv_232;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_233> AgradCcdfLogBetaBinomial_vv_233;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_234> AgradCcdfLogBetaBinomial_vv_234;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_235> AgradCcdfLogBetaBinomial_vv_235;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_236> AgradCcdfLogBetaBinomial_vv_236;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_237> AgradCcdfLogBetaBinomial_vv_237;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_238> AgradCcdfLogBetaBinomial_vv_238;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_239> AgradCcdfLogBetaBinomial_vv_239;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_240> AgradCcdfLogBetaBinomial_vv_240;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_241> AgradCcdfLogBetaBinomial_vv_241;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_vv_242> AgradCcdfLogBetaBinomial_vv_242;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_200, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_201, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_202, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_203, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_204, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_205, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_206, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_207, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_208, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_209, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_210, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_211, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_212, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_213, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_214, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_215, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_216, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_217, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_218, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_219, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_220, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_221, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_222, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_223, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_224, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_225, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_226, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_227, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_228, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_229, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_230, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_231, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_232, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_233, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_234, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_235, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_236, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_237, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_238, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_239, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_240, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_241, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_vv_242, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_vv_242);
+
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_300> AgradCcdfLogBetaBinomial_v_300;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_301> AgradCcdfLogBetaBinomial_v_301;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_302> AgradCcdfLogBetaBinomial_v_302;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_303> AgradCcdfLogBetaBinomial_v_303;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_304> AgradCcdfLogBetaBinomial_v_304;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_305> AgradCcdfLogBetaBinomial_v_305;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_306> AgradCcdfLogBetaBinomial_v_306;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_307> AgradCcdfLogBetaBinomial_v_307;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_308> AgradCcdfLogBetaBinomial_v_308;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_309> AgradCcdfLogBetaBinomial_v_309;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_310> AgradCcdfLogBetaBinomial_v_310;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_311> AgradCcdfLogBetaBinomial_v_311;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_312> AgradCcdfLogBetaBinomial_v_312;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_313> AgradCcdfLogBetaBinomial_v_313;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_314> AgradCcdfLogBetaBinomial_v_314;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_315> AgradCcdfLogBetaBinomial_v_315;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_316> AgradCcdfLogBetaBinomial_v_316;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_317> AgradCcdfLogBetaBinomial_v_317;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_318> AgradCcdfLogBetaBinomial_v_318;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_319> AgradCcdfLogBetaBinomial_v_319;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_320> AgradCcdfLogBetaBinomial_v_320;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_321> AgradCcdfLogBetaBinomial_v_321;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_322> AgradCcdfLogBetaBinomial_v_322;
+typedef std::tuple<AgradCcdfLogBetaBinomial, type_v_323> AgradCcdfLogBetaBinomial_v_323;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_300, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_301, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_302, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_303, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_304, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_305, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_306, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_307, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_308, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_309, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_310, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_311, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_312, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_313, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_314, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_315, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_316, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_317, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_318, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_319, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_320, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_321, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_322, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaBinomial_v_323, AgradCcdfLogTestFixture, AgradCcdfLogBetaBinomial_v_323);
+
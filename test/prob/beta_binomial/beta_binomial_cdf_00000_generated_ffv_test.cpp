@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, int, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<int, int, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<int, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<int, int, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<int, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<int, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<int, int, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<int, int, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<int, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<int, int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<int, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<int, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<int, std::vector<int>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<int, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<int, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<std::vector<int>, int, double, fvar<fvar<var> >, empty, empty> type_ffv_81;
+typedef std::tuple<std::vector<int>, int, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_82;
+typedef std::tuple<std::vector<int>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_87;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_88;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, double, empty, empty> type_ffv_90;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_91;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_93;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_94;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_96;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_97;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_0> AgradCdfBetaBinomial_ffv_0;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_1> AgradCdfBetaBinomial_ffv_1;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_2> AgradCdfBetaBinomial_ffv_2;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_3> AgradCdfBetaBinomial_ffv_3;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_4> AgradCdfBetaBinomial_ffv_4;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_5> AgradCdfBetaBinomial_ffv_5;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_6> AgradCdfBetaBinomial_ffv_6;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_7> AgradCdfBetaBinomial_ffv_7;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_8> AgradCdfBetaBinomial_ffv_8;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_9> AgradCdfBetaBinomial_ffv_9;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_10> AgradCdfBetaBinomial_ffv_10;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_11> AgradCdfBetaBinomial_ffv_11;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_12> AgradCdfBetaBinomial_ffv_12;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_13> AgradCdfBetaBinomial_ffv_13;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_14> AgradCdfBetaBinomial_ffv_14;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_15> AgradCdfBetaBinomial_ffv_15;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_16> AgradCdfBetaBinomial_ffv_16;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_17> AgradCdfBetaBinomial_ffv_17;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_18> AgradCdfBetaBinomial_ffv_18;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_19> AgradCdfBetaBinomial_ffv_19;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_20> AgradCdfBetaBinomial_ffv_20;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_21> AgradCdfBetaBinomial_ffv_21;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_22> AgradCdfBetaBinomial_ffv_22;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_23> AgradCdfBetaBinomial_ffv_23;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_24> AgradCdfBetaBinomial_ffv_24;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_25> AgradCdfBetaBinomial_ffv_25;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_26> AgradCdfBetaBinomial_ffv_26;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_27> AgradCdfBetaBinomial_ffv_27;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_28> AgradCdfBetaBinomial_ffv_28;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_29> AgradCdfBetaBinomial_ffv_29;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_30> AgradCdfBetaBinomial_ffv_30;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_31> AgradCdfBetaBinomial_ffv_31;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_32> AgradCdfBetaBinomial_ffv_32;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_33> AgradCdfBetaBinomial_ffv_33;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_34> AgradCdfBetaBinomial_ffv_34;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_35> AgradCdfBetaBinomial_ffv_35;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_36> AgradCdfBetaBinomial_ffv_36;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_37> AgradCdfBetaBinomial_ffv_37;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_38> AgradCdfBetaBinomial_ffv_38;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_39> AgradCdfBetaBinomial_ffv_39;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_40> AgradCdfBetaBinomial_ffv_40;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_41> AgradCdfBetaBinomial_ffv_41;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_42> AgradCdfBetaBinomial_ffv_42;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_43> AgradCdfBetaBinomial_ffv_43;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_44> AgradCdfBetaBinomial_ffv_44;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_45> AgradCdfBetaBinomial_ffv_45;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_46> AgradCdfBetaBinomial_ffv_46;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_47> AgradCdfBetaBinomial_ffv_47;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_48> AgradCdfBetaBinomial_ffv_48;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_49> AgradCdfBetaBinomial_ffv_49;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_50> AgradCdfBetaBinomial_ffv_50;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_51> AgradCdfBetaBinomial_ffv_51;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_52> AgradCdfBetaBinomial_ffv_52;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_53> AgradCdfBetaBinomial_ffv_53;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_54> AgradCdfBetaBinomial_ffv_54;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_55> AgradCdfBetaBinomial_ffv_55;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_56> AgradCdfBetaBinomial_ffv_56;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_57> AgradCdfBetaBinomial_ffv_57;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_58> AgradCdfBetaBinomial_ffv_58;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_59> AgradCdfBetaBinomial_ffv_59;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_60> AgradCdfBetaBinomial_ffv_60;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_61> AgradCdfBetaBinomial_ffv_61;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_62> AgradCdfBetaBinomial_ffv_62;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_63> AgradCdfBetaBinomial_ffv_63;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_64> AgradCdfBetaBinomial_ffv_64;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_65> AgradCdfBetaBinomial_ffv_65;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_66> AgradCdfBetaBinomial_ffv_66;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_67> AgradCdfBetaBinomial_ffv_67;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_68> AgradCdfBetaBinomial_ffv_68;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_69> AgradCdfBetaBinomial_ffv_69;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_70> AgradCdfBetaBinomial_ffv_70;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_71> AgradCdfBetaBinomial_ffv_71;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_72> AgradCdfBetaBinomial_ffv_72;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_73> AgradCdfBetaBinomial_ffv_73;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_74> AgradCdfBetaBinomial_ffv_74;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_75> AgradCdfBetaBinomial_ffv_75;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_76> AgradCdfBetaBinomial_ffv_76;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_77> AgradCdfBetaBinomial_ffv_77;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_78> AgradCdfBetaBinomial_ffv_78;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_79> AgradCdfBetaBinomial_ffv_79;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_80> AgradCdfBetaBinomial_ffv_80;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_81> AgradCdfBetaBinomial_ffv_81;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_82> AgradCdfBetaBinomial_ffv_82;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_83> AgradCdfBetaBinomial_ffv_83;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_84> AgradCdfBetaBinomial_ffv_84;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_85> AgradCdfBetaBinomial_ffv_85;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_86> AgradCdfBetaBinomial_ffv_86;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_87> AgradCdfBetaBinomial_ffv_87;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_88> AgradCdfBetaBinomial_ffv_88;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_89> AgradCdfBetaBinomial_ffv_89;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_90> AgradCdfBetaBinomial_ffv_90;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_91> AgradCdfBetaBinomial_ffv_91;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_92> AgradCdfBetaBinomial_ffv_92;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_93> AgradCdfBetaBinomial_ffv_93;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_94> AgradCdfBetaBinomial_ffv_94;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_95> AgradCdfBetaBinomial_ffv_95;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_96> AgradCdfBetaBinomial_ffv_96;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_97> AgradCdfBetaBinomial_ffv_97;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_98> AgradCdfBetaBinomial_ffv_98;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_99> AgradCdfBetaBinomial_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_0, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_1, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_2, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_3, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_4, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_5, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_6, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_7, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_8, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_9, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_10, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_11, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_12, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_13, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_14, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_15, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_16, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_17, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_18, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_19, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_20, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_21, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_22, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_23, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_24, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_25, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_26, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_27, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_28, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_29, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_30, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_31, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_32, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_33, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_34, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_35, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_36, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_37, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_38, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_39, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_40, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_41, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_42, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_43, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_44, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_45, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_46, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_47, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_48, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_49, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_50, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_51, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_52, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_53, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_54, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_55, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_56, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_57, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_58, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_59, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_60, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_61, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_62, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_63, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_64, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_65, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_66, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_67, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_68, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_69, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_70, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_71, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_72, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_73, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_74, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_75, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_76, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_77, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_78, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_79, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_80, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_81, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_82, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_83, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_84, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_85, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_86, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_87, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_88, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_89, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_90, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_91, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_92, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_93, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_94, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_95, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_96, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_97, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_98, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_99, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_99);
+
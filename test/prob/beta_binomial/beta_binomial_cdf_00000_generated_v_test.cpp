@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, int, double, double, empty, empty> type_v_0;
+typedef std::tuple<int, int, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<int, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<int, int, double, var, empty, empty> type_v_3;
+typedef std::tuple<int, int, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<int, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<int, int, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<int, int, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<int, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<int, int, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<int, int, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<int, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<int, int, var, double, empty, empty> type_v_18;
+typedef std::tuple<int, int, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<int, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<int, int, var, var, empty, empty> type_v_21;
+typedef std::tuple<int, int, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<int, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<int, int, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<int, int, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<int, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<int, int, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<int, int, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<int, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<int, std::vector<int>, double, double, empty, empty> type_v_36;
+typedef std::tuple<int, std::vector<int>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<int, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<int, std::vector<int>, double, var, empty, empty> type_v_39;
+typedef std::tuple<int, std::vector<int>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<int, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<int, std::vector<int>, var, double, empty, empty> type_v_54;
+typedef std::tuple<int, std::vector<int>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<int, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<int, std::vector<int>, var, var, empty, empty> type_v_57;
+typedef std::tuple<int, std::vector<int>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<int, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfBetaBinomial, type_v_0> AgradCdfBetaBinomial_v_0;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_1> AgradCdfBetaBinomial_v_1;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_2> AgradCdfBetaBinomial_v_2;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_3> AgradCdfBetaBinomial_v_3;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_4> AgradCdfBetaBinomial_v_4;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_5> AgradCdfBetaBinomial_v_5;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_6> AgradCdfBetaBinomial_v_6;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_7> AgradCdfBetaBinomial_v_7;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_8> AgradCdfBetaBinomial_v_8;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_9> AgradCdfBetaBinomial_v_9;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_10> AgradCdfBetaBinomial_v_10;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_11> AgradCdfBetaBinomial_v_11;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_12> AgradCdfBetaBinomial_v_12;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_13> AgradCdfBetaBinomial_v_13;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_14> AgradCdfBetaBinomial_v_14;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_15> AgradCdfBetaBinomial_v_15;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_16> AgradCdfBetaBinomial_v_16;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_17> AgradCdfBetaBinomial_v_17;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_18> AgradCdfBetaBinomial_v_18;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_19> AgradCdfBetaBinomial_v_19;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_20> AgradCdfBetaBinomial_v_20;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_21> AgradCdfBetaBinomial_v_21;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_22> AgradCdfBetaBinomial_v_22;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_23> AgradCdfBetaBinomial_v_23;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_24> AgradCdfBetaBinomial_v_24;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_25> AgradCdfBetaBinomial_v_25;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_26> AgradCdfBetaBinomial_v_26;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_27> AgradCdfBetaBinomial_v_27;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_28> AgradCdfBetaBinomial_v_28;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_29> AgradCdfBetaBinomial_v_29;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_30> AgradCdfBetaBinomial_v_30;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_31> AgradCdfBetaBinomial_v_31;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_32> AgradCdfBetaBinomial_v_32;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_33> AgradCdfBetaBinomial_v_33;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_34> AgradCdfBetaBinomial_v_34;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_35> AgradCdfBetaBinomial_v_35;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_36> AgradCdfBetaBinomial_v_36;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_37> AgradCdfBetaBinomial_v_37;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_38> AgradCdfBetaBinomial_v_38;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_39> AgradCdfBetaBinomial_v_39;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_40> AgradCdfBetaBinomial_v_40;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_41> AgradCdfBetaBinomial_v_41;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_42> AgradCdfBetaBinomial_v_42;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_43> AgradCdfBetaBinomial_v_43;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_44> AgradCdfBetaBinomial_v_44;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_45> AgradCdfBetaBinomial_v_45;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_46> AgradCdfBetaBinomial_v_46;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_47> AgradCdfBetaBinomial_v_47;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_48> AgradCdfBetaBinomial_v_48;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_49> AgradCdfBetaBinomial_v_49;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_50> AgradCdfBetaBinomial_v_50;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_51> AgradCdfBetaBinomial_v_51;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_52> AgradCdfBetaBinomial_v_52;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_53> AgradCdfBetaBinomial_v_53;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_54> AgradCdfBetaBinomial_v_54;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_55> AgradCdfBetaBinomial_v_55;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_56> AgradCdfBetaBinomial_v_56;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_57> AgradCdfBetaBinomial_v_57;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_58> AgradCdfBetaBinomial_v_58;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_59> AgradCdfBetaBinomial_v_59;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_60> AgradCdfBetaBinomial_v_60;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_61> AgradCdfBetaBinomial_v_61;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_62> AgradCdfBetaBinomial_v_62;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_63> AgradCdfBetaBinomial_v_63;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_64> AgradCdfBetaBinomial_v_64;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_65> AgradCdfBetaBinomial_v_65;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_66> AgradCdfBetaBinomial_v_66;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_67> AgradCdfBetaBinomial_v_67;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_68> AgradCdfBetaBinomial_v_68;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_69> AgradCdfBetaBinomial_v_69;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_70> AgradCdfBetaBinomial_v_70;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_71> AgradCdfBetaBinomial_v_71;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_72> AgradCdfBetaBinomial_v_72;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_73> AgradCdfBetaBinomial_v_73;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_74> AgradCdfBetaBinomial_v_74;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_75> AgradCdfBetaBinomial_v_75;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_76> AgradCdfBetaBinomial_v_76;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_77> AgradCdfBetaBinomial_v_77;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_78> AgradCdfBetaBinomial_v_78;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_79> AgradCdfBetaBinomial_v_79;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_80> AgradCdfBetaBinomial_v_80;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_81> AgradCdfBetaBinomial_v_81;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_82> AgradCdfBetaBinomial_v_82;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_83> AgradCdfBetaBinomial_v_83;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_84> AgradCdfBetaBinomial_v_84;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_85> AgradCdfBetaBinomial_v_85;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_86> AgradCdfBetaBinomial_v_86;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_87> AgradCdfBetaBinomial_v_87;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_88> AgradCdfBetaBinomial_v_88;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_89> AgradCdfBetaBinomial_v_89;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_90> AgradCdfBetaBinomial_v_90;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_91> AgradCdfBetaBinomial_v_91;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_92> AgradCdfBetaBinomial_v_92;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_93> AgradCdfBetaBinomial_v_93;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_94> AgradCdfBetaBinomial_v_94;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_95> AgradCdfBetaBinomial_v_95;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_96> AgradCdfBetaBinomial_v_96;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_97> AgradCdfBetaBinomial_v_97;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_98> AgradCdfBetaBinomial_v_98;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_99> AgradCdfBetaBinomial_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_0, AgradCdfTestFixture, AgradCdfBetaBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_1, AgradCdfTestFixture, AgradCdfBetaBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_2, AgradCdfTestFixture, AgradCdfBetaBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_3, AgradCdfTestFixture, AgradCdfBetaBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_4, AgradCdfTestFixture, AgradCdfBetaBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_5, AgradCdfTestFixture, AgradCdfBetaBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_6, AgradCdfTestFixture, AgradCdfBetaBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_7, AgradCdfTestFixture, AgradCdfBetaBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_8, AgradCdfTestFixture, AgradCdfBetaBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_9, AgradCdfTestFixture, AgradCdfBetaBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_10, AgradCdfTestFixture, AgradCdfBetaBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_11, AgradCdfTestFixture, AgradCdfBetaBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_12, AgradCdfTestFixture, AgradCdfBetaBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_13, AgradCdfTestFixture, AgradCdfBetaBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_14, AgradCdfTestFixture, AgradCdfBetaBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_15, AgradCdfTestFixture, AgradCdfBetaBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_16, AgradCdfTestFixture, AgradCdfBetaBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_17, AgradCdfTestFixture, AgradCdfBetaBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_18, AgradCdfTestFixture, AgradCdfBetaBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_19, AgradCdfTestFixture, AgradCdfBetaBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_20, AgradCdfTestFixture, AgradCdfBetaBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_21, AgradCdfTestFixture, AgradCdfBetaBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_22, AgradCdfTestFixture, AgradCdfBetaBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_23, AgradCdfTestFixture, AgradCdfBetaBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_24, AgradCdfTestFixture, AgradCdfBetaBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_25, AgradCdfTestFixture, AgradCdfBetaBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_26, AgradCdfTestFixture, AgradCdfBetaBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_27, AgradCdfTestFixture, AgradCdfBetaBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_28, AgradCdfTestFixture, AgradCdfBetaBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_29, AgradCdfTestFixture, AgradCdfBetaBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_30, AgradCdfTestFixture, AgradCdfBetaBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_31, AgradCdfTestFixture, AgradCdfBetaBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_32, AgradCdfTestFixture, AgradCdfBetaBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_33, AgradCdfTestFixture, AgradCdfBetaBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_34, AgradCdfTestFixture, AgradCdfBetaBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_35, AgradCdfTestFixture, AgradCdfBetaBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_36, AgradCdfTestFixture, AgradCdfBetaBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_37, AgradCdfTestFixture, AgradCdfBetaBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_38, AgradCdfTestFixture, AgradCdfBetaBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_39, AgradCdfTestFixture, AgradCdfBetaBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_40, AgradCdfTestFixture, AgradCdfBetaBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_41, AgradCdfTestFixture, AgradCdfBetaBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_42, AgradCdfTestFixture, AgradCdfBetaBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_43, AgradCdfTestFixture, AgradCdfBetaBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_44, AgradCdfTestFixture, AgradCdfBetaBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_45, AgradCdfTestFixture, AgradCdfBetaBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_46, AgradCdfTestFixture, AgradCdfBetaBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_47, AgradCdfTestFixture, AgradCdfBetaBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_48, AgradCdfTestFixture, AgradCdfBetaBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_49, AgradCdfTestFixture, AgradCdfBetaBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_50, AgradCdfTestFixture, AgradCdfBetaBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_51, AgradCdfTestFixture, AgradCdfBetaBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_52, AgradCdfTestFixture, AgradCdfBetaBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_53, AgradCdfTestFixture, AgradCdfBetaBinomial_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_54, AgradCdfTestFixture, AgradCdfBetaBinomial_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_55, AgradCdfTestFixture, AgradCdfBetaBinomial_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_56, AgradCdfTestFixture, AgradCdfBetaBinomial_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_57, AgradCdfTestFixture, AgradCdfBetaBinomial_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_58, AgradCdfTestFixture, AgradCdfBetaBinomial_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_59, AgradCdfTestFixture, AgradCdfBetaBinomial_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_60, AgradCdfTestFixture, AgradCdfBetaBinomial_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_61, AgradCdfTestFixture, AgradCdfBetaBinomial_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_62, AgradCdfTestFixture, AgradCdfBetaBinomial_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_63, AgradCdfTestFixture, AgradCdfBetaBinomial_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_64, AgradCdfTestFixture, AgradCdfBetaBinomial_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_65, AgradCdfTestFixture, AgradCdfBetaBinomial_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_66, AgradCdfTestFixture, AgradCdfBetaBinomial_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_67, AgradCdfTestFixture, AgradCdfBetaBinomial_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_68, AgradCdfTestFixture, AgradCdfBetaBinomial_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_69, AgradCdfTestFixture, AgradCdfBetaBinomial_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_70, AgradCdfTestFixture, AgradCdfBetaBinomial_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_71, AgradCdfTestFixture, AgradCdfBetaBinomial_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_72, AgradCdfTestFixture, AgradCdfBetaBinomial_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_73, AgradCdfTestFixture, AgradCdfBetaBinomial_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_74, AgradCdfTestFixture, AgradCdfBetaBinomial_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_75, AgradCdfTestFixture, AgradCdfBetaBinomial_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_76, AgradCdfTestFixture, AgradCdfBetaBinomial_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_77, AgradCdfTestFixture, AgradCdfBetaBinomial_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_78, AgradCdfTestFixture, AgradCdfBetaBinomial_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_79, AgradCdfTestFixture, AgradCdfBetaBinomial_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_80, AgradCdfTestFixture, AgradCdfBetaBinomial_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_81, AgradCdfTestFixture, AgradCdfBetaBinomial_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_82, AgradCdfTestFixture, AgradCdfBetaBinomial_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_83, AgradCdfTestFixture, AgradCdfBetaBinomial_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_84, AgradCdfTestFixture, AgradCdfBetaBinomial_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_85, AgradCdfTestFixture, AgradCdfBetaBinomial_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_86, AgradCdfTestFixture, AgradCdfBetaBinomial_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_87, AgradCdfTestFixture, AgradCdfBetaBinomial_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_88, AgradCdfTestFixture, AgradCdfBetaBinomial_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_89, AgradCdfTestFixture, AgradCdfBetaBinomial_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_90, AgradCdfTestFixture, AgradCdfBetaBinomial_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_91, AgradCdfTestFixture, AgradCdfBetaBinomial_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_92, AgradCdfTestFixture, AgradCdfBetaBinomial_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_93, AgradCdfTestFixture, AgradCdfBetaBinomial_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_94, AgradCdfTestFixture, AgradCdfBetaBinomial_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_95, AgradCdfTestFixture, AgradCdfBetaBinomial_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_96, AgradCdfTestFixture, AgradCdfBetaBinomial_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_97, AgradCdfTestFixture, AgradCdfBetaBinomial_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_98, AgradCdfTestFixture, AgradCdfBetaBinomial_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_99, AgradCdfTestFixture, AgradCdfBetaBinomial_v_99);
+
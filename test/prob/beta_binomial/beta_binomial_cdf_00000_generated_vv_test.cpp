@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, int, double, var, empty, empty> type_vv_0;
+typedef std::tuple<int, int, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<int, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<int, int, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<int, int, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<int, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<int, int, var, double, empty, empty> type_vv_9;
+typedef std::tuple<int, int, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<int, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<int, int, var, var, empty, empty> type_vv_12;
+typedef std::tuple<int, int, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<int, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<int, int, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<int, int, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<int, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<int, int, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<int, int, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<int, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<int, std::vector<int>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<int, std::vector<int>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<int, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<int, std::vector<int>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<int, std::vector<int>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<int, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<int, std::vector<int>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<int, std::vector<int>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<int, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<std::vector<int>, int, double, var, empty, empty> type_vv_81;
+typedef std::tuple<std::vector<int>, int, double, std::vector<var>, empty, empty> type_vv_82;
+typedef std::tuple<std::vector<int>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_83;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, var, empty, empty> type_vv_84;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_87;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_88;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_89;
+typedef std::tuple<std::vector<int>, int, var, double, empty, empty> type_vv_90;
+typedef std::tuple<std::vector<int>, int, var, std::vector<double>, empty, empty> type_vv_91;
+typedef std::tuple<std::vector<int>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_92;
+typedef std::tuple<std::vector<int>, int, var, var, empty, empty> type_vv_93;
+typedef std::tuple<std::vector<int>, int, var, std::vector<var>, empty, empty> type_vv_94;
+typedef std::tuple<std::vector<int>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_95;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, double, empty, empty> type_vv_96;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<double>, empty, empty> type_vv_97;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_98;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, var, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_0> AgradCdfBetaBinomial_vv_0;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_1> AgradCdfBetaBinomial_vv_1;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_2> AgradCdfBetaBinomial_vv_2;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_3> AgradCdfBetaBinomial_vv_3;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_4> AgradCdfBetaBinomial_vv_4;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_5> AgradCdfBetaBinomial_vv_5;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_6> AgradCdfBetaBinomial_vv_6;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_7> AgradCdfBetaBinomial_vv_7;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_8> AgradCdfBetaBinomial_vv_8;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_9> AgradCdfBetaBinomial_vv_9;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_10> AgradCdfBetaBinomial_vv_10;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_11> AgradCdfBetaBinomial_vv_11;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_12> AgradCdfBetaBinomial_vv_12;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_13> AgradCdfBetaBinomial_vv_13;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_14> AgradCdfBetaBinomial_vv_14;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_15> AgradCdfBetaBinomial_vv_15;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_16> AgradCdfBetaBinomial_vv_16;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_17> AgradCdfBetaBinomial_vv_17;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_18> AgradCdfBetaBinomial_vv_18;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_19> AgradCdfBetaBinomial_vv_19;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_20> AgradCdfBetaBinomial_vv_20;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_21> AgradCdfBetaBinomial_vv_21;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_22> AgradCdfBetaBinomial_vv_22;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_23> AgradCdfBetaBinomial_vv_23;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_24> AgradCdfBetaBinomial_vv_24;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_25> AgradCdfBetaBinomial_vv_25;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_26> AgradCdfBetaBinomial_vv_26;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_27> AgradCdfBetaBinomial_vv_27;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_28> AgradCdfBetaBinomial_vv_28;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_29> AgradCdfBetaBinomial_vv_29;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_30> AgradCdfBetaBinomial_vv_30;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_31> AgradCdfBetaBinomial_vv_31;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_32> AgradCdfBetaBinomial_vv_32;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_33> AgradCdfBetaBinomial_vv_33;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_34> AgradCdfBetaBinomial_vv_34;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_35> AgradCdfBetaBinomial_vv_35;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_36> AgradCdfBetaBinomial_vv_36;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_37> AgradCdfBetaBinomial_vv_37;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_38> AgradCdfBetaBinomial_vv_38;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_39> AgradCdfBetaBinomial_vv_39;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_40> AgradCdfBetaBinomial_vv_40;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_41> AgradCdfBetaBinomial_vv_41;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_42> AgradCdfBetaBinomial_vv_42;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_43> AgradCdfBetaBinomial_vv_43;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_44> AgradCdfBetaBinomial_vv_44;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_45> AgradCdfBetaBinomial_vv_45;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_46> AgradCdfBetaBinomial_vv_46;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_47> AgradCdfBetaBinomial_vv_47;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_48> AgradCdfBetaBinomial_vv_48;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_49> AgradCdfBetaBinomial_vv_49;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_50> AgradCdfBetaBinomial_vv_50;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_51> AgradCdfBetaBinomial_vv_51;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_52> AgradCdfBetaBinomial_vv_52;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_53> AgradCdfBetaBinomial_vv_53;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_54> AgradCdfBetaBinomial_vv_54;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_55> AgradCdfBetaBinomial_vv_55;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_56> AgradCdfBetaBinomial_vv_56;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_57> AgradCdfBetaBinomial_vv_57;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_58> AgradCdfBetaBinomial_vv_58;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_59> AgradCdfBetaBinomial_vv_59;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_60> AgradCdfBetaBinomial_vv_60;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_61> AgradCdfBetaBinomial_vv_61;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_62> AgradCdfBetaBinomial_vv_62;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_63> AgradCdfBetaBinomial_vv_63;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_64> AgradCdfBetaBinomial_vv_64;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_65> AgradCdfBetaBinomial_vv_65;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_66> AgradCdfBetaBinomial_vv_66;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_67> AgradCdfBetaBinomial_vv_67;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_68> AgradCdfBetaBinomial_vv_68;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_69> AgradCdfBetaBinomial_vv_69;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_70> AgradCdfBetaBinomial_vv_70;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_71> AgradCdfBetaBinomial_vv_71;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_72> AgradCdfBetaBinomial_vv_72;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_73> AgradCdfBetaBinomial_vv_73;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_74> AgradCdfBetaBinomial_vv_74;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_75> AgradCdfBetaBinomial_vv_75;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_76> AgradCdfBetaBinomial_vv_76;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_77> AgradCdfBetaBinomial_vv_77;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_78> AgradCdfBetaBinomial_vv_78;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_79> AgradCdfBetaBinomial_vv_79;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_80> AgradCdfBetaBinomial_vv_80;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_81> AgradCdfBetaBinomial_vv_81;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_82> AgradCdfBetaBinomial_vv_82;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_83> AgradCdfBetaBinomial_vv_83;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_84> AgradCdfBetaBinomial_vv_84;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_85> AgradCdfBetaBinomial_vv_85;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_86> AgradCdfBetaBinomial_vv_86;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_87> AgradCdfBetaBinomial_vv_87;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_88> AgradCdfBetaBinomial_vv_88;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_89> AgradCdfBetaBinomial_vv_89;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_90> AgradCdfBetaBinomial_vv_90;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_91> AgradCdfBetaBinomial_vv_91;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_92> AgradCdfBetaBinomial_vv_92;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_93> AgradCdfBetaBinomial_vv_93;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_94> AgradCdfBetaBinomial_vv_94;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_95> AgradCdfBetaBinomial_vv_95;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_96> AgradCdfBetaBinomial_vv_96;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_97> AgradCdfBetaBinomial_vv_97;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_98> AgradCdfBetaBinomial_vv_98;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_99> AgradCdfBetaBinomial_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_0, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_1, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_2, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_3, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_4, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_5, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_6, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_7, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_8, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_9, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_10, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_11, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_12, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_13, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_14, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_15, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_16, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_17, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_18, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_19, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_20, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_21, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_22, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_23, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_24, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_25, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_26, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_27, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_28, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_29, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_30, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_31, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_32, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_33, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_34, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_35, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_36, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_37, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_38, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_39, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_40, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_41, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_42, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_43, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_44, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_45, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_46, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_47, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_48, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_49, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_50, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_51, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_52, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_53, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_54, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_55, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_56, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_57, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_58, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_59, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_60, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_61, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_62, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_63, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_64, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_65, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_66, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_67, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_68, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_69, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_70, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_71, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_72, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_73, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_74, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_75, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_76, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_77, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_78, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_79, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_80, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_81, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_82, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_83, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_84, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_85, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_86, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_87, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_88, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_89, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_90, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_91, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_92, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_93, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_94, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_95, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_96, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_97, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_98, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_99, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_99);
+
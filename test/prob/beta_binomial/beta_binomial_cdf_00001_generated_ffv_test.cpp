@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_test.hpp>
+
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_100;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_102;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_103;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_105;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_106;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_111;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_112;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, double, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_153;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_154;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_156;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_157;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_159;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_160;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_100> AgradCdfBetaBinomial_ffv_100;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_101> AgradCdfBetaBinomial_ffv_101;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_102> AgradCdfBetaBinomial_ffv_102;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_103> AgradCdfBetaBinomial_ffv_103;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_104> AgradCdfBetaBinomial_ffv_104;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_105> AgradCdfBetaBinomial_ffv_105;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_106> AgradCdfBetaBinomial_ffv_106;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_107> AgradCdfBetaBinomial_ffv_107;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_108> AgradCdfBetaBinomial_ffv_108;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_109> AgradCdfBetaBinomial_ffv_109;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_110> AgradCdfBetaBinomial_ffv_110;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_111> AgradCdfBetaBinomial_ffv_111;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_112> AgradCdfBetaBinomial_ffv_112;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_113> AgradCdfBetaBinomial_ffv_113;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_114> AgradCdfBetaBinomial_ffv_114;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_115> AgradCdfBetaBinomial_ffv_115;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_116> AgradCdfBetaBinomial_ffv_116;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_117> AgradCdfBetaBinomial_ffv_117;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_118> AgradCdfBetaBinomial_ffv_118;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_119> AgradCdfBetaBinomial_ffv_119;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_120> AgradCdfBetaBinomial_ffv_120;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_121> AgradCdfBetaBinomial_ffv_121;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_122> AgradCdfBetaBinomial_ffv_122;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_123> AgradCdfBetaBinomial_ffv_123;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_124> AgradCdfBetaBinomial_ffv_124;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_125> AgradCdfBetaBinomial_ffv_125;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_126> AgradCdfBetaBinomial_ffv_126;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_127> AgradCdfBetaBinomial_ffv_127;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_128> AgradCdfBetaBinomial_ffv_128;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_129> AgradCdfBetaBinomial_ffv_129;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_130> AgradCdfBetaBinomial_ffv_130;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_131> AgradCdfBetaBinomial_ffv_131;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_132> AgradCdfBetaBinomial_ffv_132;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_133> AgradCdfBetaBinomial_ffv_133;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_134> AgradCdfBetaBinomial_ffv_134;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_135> AgradCdfBetaBinomial_ffv_135;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_136> AgradCdfBetaBinomial_ffv_136;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_137> AgradCdfBetaBinomial_ffv_137;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_138> AgradCdfBetaBinomial_ffv_138;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_139> AgradCdfBetaBinomial_ffv_139;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_140> AgradCdfBetaBinomial_ffv_140;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_141> AgradCdfBetaBinomial_ffv_141;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_142> AgradCdfBetaBinomial_ffv_142;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_143> AgradCdfBetaBinomial_ffv_143;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_144> AgradCdfBetaBinomial_ffv_144;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_145> AgradCdfBetaBinomial_ffv_145;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_146> AgradCdfBetaBinomial_ffv_146;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_147> AgradCdfBetaBinomial_ffv_147;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_148> AgradCdfBetaBinomial_ffv_148;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_149> AgradCdfBetaBinomial_ffv_149;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_150> AgradCdfBetaBinomial_ffv_150;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_151> AgradCdfBetaBinomial_ffv_151;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_152> AgradCdfBetaBinomial_ffv_152;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_153> AgradCdfBetaBinomial_ffv_153;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_154> AgradCdfBetaBinomial_ffv_154;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_155> AgradCdfBetaBinomial_ffv_155;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_156> AgradCdfBetaBinomial_ffv_156;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_157> AgradCdfBetaBinomial_ffv_157;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_158> AgradCdfBetaBinomial_ffv_158;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_159> AgradCdfBetaBinomial_ffv_159;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_160> AgradCdfBetaBinomial_ffv_160;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_161> AgradCdfBetaBinomial_ffv_161;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_162> AgradCdfBetaBinomial_ffv_162;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_163> AgradCdfBetaBinomial_ffv_163;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_164> AgradCdfBetaBinomial_ffv_164;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_165> AgradCdfBetaBinomial_ffv_165;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_166> AgradCdfBetaBinomial_ffv_166;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_167> AgradCdfBetaBinomial_ffv_167;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_168> AgradCdfBetaBinomial_ffv_168;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_169> AgradCdfBetaBinomial_ffv_169;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_170> AgradCdfBetaBinomial_ffv_170;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_171> AgradCdfBetaBinomial_ffv_171;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_172> AgradCdfBetaBinomial_ffv_172;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_173> AgradCdfBetaBinomial_ffv_173;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_174> AgradCdfBetaBinomial_ffv_174;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_175> AgradCdfBetaBinomial_ffv_175;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_176> AgradCdfBetaBinomial_ffv_176;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_177> AgradCdfBetaBinomial_ffv_177;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_178> AgradCdfBetaBinomial_ffv_178;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_179> AgradCdfBetaBinomial_ffv_179;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_180> AgradCdfBetaBinomial_ffv_180;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_181> AgradCdfBetaBinomial_ffv_181;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_182> AgradCdfBetaBinomial_ffv_182;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_183> AgradCdfBetaBinomial_ffv_183;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_184> AgradCdfBetaBinomial_ffv_184;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_185> AgradCdfBetaBinomial_ffv_185;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_186> AgradCdfBetaBinomial_ffv_186;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_187> AgradCdfBetaBinomial_ffv_187;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_188> AgradCdfBetaBinomial_ffv_188;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_189> AgradCdfBetaBinomial_ffv_189;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_190> AgradCdfBetaBinomial_ffv_190;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_191> AgradCdfBetaBinomial_ffv_191;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_192> AgradCdfBetaBinomial_ffv_192;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_193> AgradCdfBetaBinomial_ffv_193;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_194> AgradCdfBetaBinomial_ffv_194;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_195> AgradCdfBetaBinomial_ffv_195;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_196> AgradCdfBetaBinomial_ffv_196;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_197> AgradCdfBetaBinomial_ffv_197;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_198> AgradCdfBetaBinomial_ffv_198;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_199> AgradCdfBetaBinomial_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_100, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_101, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_102, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_103, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_104, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_105, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_106, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_107, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_108, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_109, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_110, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_111, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_112, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_113, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_114, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_115, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_116, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_117, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_118, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_119, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_120, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_121, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_122, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_123, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_124, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_125, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_126, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_127, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_128, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_129, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_130, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_131, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_132, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_133, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_134, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_135, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_136, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_137, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_138, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_139, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_140, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_141, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_142, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_143, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_144, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_145, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_146, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_147, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_148, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_149, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_150, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_151, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_152, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_153, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_154, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_155, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_156, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_157, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_158, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_159, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_160, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_161, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_162, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_163, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_164, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_165, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_166, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_167, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_168, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_169, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_170, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_171, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_172, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_173, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_174, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_175, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_176, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_177, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_178, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_179, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_180, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_181, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_182, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_183, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_184, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_185, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_186, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_187, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_188, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_189, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_190, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_191, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_192, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_193, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_194, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_195, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_196, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_197, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_198, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_199, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_199);
+
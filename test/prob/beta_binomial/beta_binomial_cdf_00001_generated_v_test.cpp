@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<std::vector<int>, int, double, double, empty, empty> type_v_108;
+typedef std::tuple<std::vector<int>, int, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<std::vector<int>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<std::vector<int>, int, double, var, empty, empty> type_v_111;
+typedef std::tuple<std::vector<int>, int, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<std::vector<int>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<std::vector<int>, int, var, double, empty, empty> type_v_126;
+typedef std::tuple<std::vector<int>, int, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<std::vector<int>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<std::vector<int>, int, var, var, empty, empty> type_v_129;
+typedef std::tuple<std::vector<int>, int, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<std::vector<int>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, double, empty, empty> type_v_144;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, var, empty, empty> type_v_147;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, double, empty, empty> type_v_162;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, var, empty, empty> type_v_165;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfBetaBinomial, type_v_100> AgradCdfBetaBinomial_v_100;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_101> AgradCdfBetaBinomial_v_101;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_102> AgradCdfBetaBinomial_v_102;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_103> AgradCdfBetaBinomial_v_103;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_104> AgradCdfBetaBinomial_v_104;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_105> AgradCdfBetaBinomial_v_105;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_106> AgradCdfBetaBinomial_v_106;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_107> AgradCdfBetaBinomial_v_107;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_108> AgradCdfBetaBinomial_v_108;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_109> AgradCdfBetaBinomial_v_109;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_110> AgradCdfBetaBinomial_v_110;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_111> AgradCdfBetaBinomial_v_111;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_112> AgradCdfBetaBinomial_v_112;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_113> AgradCdfBetaBinomial_v_113;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_114> AgradCdfBetaBinomial_v_114;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_115> AgradCdfBetaBinomial_v_115;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_116> AgradCdfBetaBinomial_v_116;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_117> AgradCdfBetaBinomial_v_117;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_118> AgradCdfBetaBinomial_v_118;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_119> AgradCdfBetaBinomial_v_119;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_120> AgradCdfBetaBinomial_v_120;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_121> AgradCdfBetaBinomial_v_121;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_122> AgradCdfBetaBinomial_v_122;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_123> AgradCdfBetaBinomial_v_123;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_124> AgradCdfBetaBinomial_v_124;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_125> AgradCdfBetaBinomial_v_125;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_126> AgradCdfBetaBinomial_v_126;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_127> AgradCdfBetaBinomial_v_127;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_128> AgradCdfBetaBinomial_v_128;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_129> AgradCdfBetaBinomial_v_129;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_130> AgradCdfBetaBinomial_v_130;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_131> AgradCdfBetaBinomial_v_131;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_132> AgradCdfBetaBinomial_v_132;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_133> AgradCdfBetaBinomial_v_133;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_134> AgradCdfBetaBinomial_v_134;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_135> AgradCdfBetaBinomial_v_135;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_136> AgradCdfBetaBinomial_v_136;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_137> AgradCdfBetaBinomial_v_137;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_138> AgradCdfBetaBinomial_v_138;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_139> AgradCdfBetaBinomial_v_139;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_140> AgradCdfBetaBinomial_v_140;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_141> AgradCdfBetaBinomial_v_141;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_142> AgradCdfBetaBinomial_v_142;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_143> AgradCdfBetaBinomial_v_143;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_144> AgradCdfBetaBinomial_v_144;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_145> AgradCdfBetaBinomial_v_145;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_146> AgradCdfBetaBinomial_v_146;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_147> AgradCdfBetaBinomial_v_147;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_148> AgradCdfBetaBinomial_v_148;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_149> AgradCdfBetaBinomial_v_149;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_150> AgradCdfBetaBinomial_v_150;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_151> AgradCdfBetaBinomial_v_151;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_152> AgradCdfBetaBinomial_v_152;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_153> AgradCdfBetaBinomial_v_153;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_154> AgradCdfBetaBinomial_v_154;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_155> AgradCdfBetaBinomial_v_155;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_156> AgradCdfBetaBinomial_v_156;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_157> AgradCdfBetaBinomial_v_157;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_158> AgradCdfBetaBinomial_v_158;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_159> AgradCdfBetaBinomial_v_159;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_160> AgradCdfBetaBinomial_v_160;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_161> AgradCdfBetaBinomial_v_161;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_162> AgradCdfBetaBinomial_v_162;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_163> AgradCdfBetaBinomial_v_163;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_164> AgradCdfBetaBinomial_v_164;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_165> AgradCdfBetaBinomial_v_165;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_166> AgradCdfBetaBinomial_v_166;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_167> AgradCdfBetaBinomial_v_167;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_168> AgradCdfBetaBinomial_v_168;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_169> AgradCdfBetaBinomial_v_169;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_170> AgradCdfBetaBinomial_v_170;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_171> AgradCdfBetaBinomial_v_171;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_172> AgradCdfBetaBinomial_v_172;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_173> AgradCdfBetaBinomial_v_173;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_174> AgradCdfBetaBinomial_v_174;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_175> AgradCdfBetaBinomial_v_175;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_176> AgradCdfBetaBinomial_v_176;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_177> AgradCdfBetaBinomial_v_177;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_178> AgradCdfBetaBinomial_v_178;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_179> AgradCdfBetaBinomial_v_179;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_180> AgradCdfBetaBinomial_v_180;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_181> AgradCdfBetaBinomial_v_181;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_182> AgradCdfBetaBinomial_v_182;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_183> AgradCdfBetaBinomial_v_183;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_184> AgradCdfBetaBinomial_v_184;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_185> AgradCdfBetaBinomial_v_185;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_186> AgradCdfBetaBinomial_v_186;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_187> AgradCdfBetaBinomial_v_187;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_188> AgradCdfBetaBinomial_v_188;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_189> AgradCdfBetaBinomial_v_189;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_190> AgradCdfBetaBinomial_v_190;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_191> AgradCdfBetaBinomial_v_191;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_192> AgradCdfBetaBinomial_v_192;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_193> AgradCdfBetaBinomial_v_193;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_194> AgradCdfBetaBinomial_v_194;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_195> AgradCdfBetaBinomial_v_195;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_196> AgradCdfBetaBinomial_v_196;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_197> AgradCdfBetaBinomial_v_197;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_198> AgradCdfBetaBinomial_v_198;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_199> AgradCdfBetaBinomial_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_100, AgradCdfTestFixture, AgradCdfBetaBinomial_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_101, AgradCdfTestFixture, AgradCdfBetaBinomial_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_102, AgradCdfTestFixture, AgradCdfBetaBinomial_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_103, AgradCdfTestFixture, AgradCdfBetaBinomial_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_104, AgradCdfTestFixture, AgradCdfBetaBinomial_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_105, AgradCdfTestFixture, AgradCdfBetaBinomial_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_106, AgradCdfTestFixture, AgradCdfBetaBinomial_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_107, AgradCdfTestFixture, AgradCdfBetaBinomial_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_108, AgradCdfTestFixture, AgradCdfBetaBinomial_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_109, AgradCdfTestFixture, AgradCdfBetaBinomial_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_110, AgradCdfTestFixture, AgradCdfBetaBinomial_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_111, AgradCdfTestFixture, AgradCdfBetaBinomial_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_112, AgradCdfTestFixture, AgradCdfBetaBinomial_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_113, AgradCdfTestFixture, AgradCdfBetaBinomial_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_114, AgradCdfTestFixture, AgradCdfBetaBinomial_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_115, AgradCdfTestFixture, AgradCdfBetaBinomial_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_116, AgradCdfTestFixture, AgradCdfBetaBinomial_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_117, AgradCdfTestFixture, AgradCdfBetaBinomial_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_118, AgradCdfTestFixture, AgradCdfBetaBinomial_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_119, AgradCdfTestFixture, AgradCdfBetaBinomial_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_120, AgradCdfTestFixture, AgradCdfBetaBinomial_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_121, AgradCdfTestFixture, AgradCdfBetaBinomial_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_122, AgradCdfTestFixture, AgradCdfBetaBinomial_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_123, AgradCdfTestFixture, AgradCdfBetaBinomial_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_124, AgradCdfTestFixture, AgradCdfBetaBinomial_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_125, AgradCdfTestFixture, AgradCdfBetaBinomial_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_126, AgradCdfTestFixture, AgradCdfBetaBinomial_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_127, AgradCdfTestFixture, AgradCdfBetaBinomial_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_128, AgradCdfTestFixture, AgradCdfBetaBinomial_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_129, AgradCdfTestFixture, AgradCdfBetaBinomial_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_130, AgradCdfTestFixture, AgradCdfBetaBinomial_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_131, AgradCdfTestFixture, AgradCdfBetaBinomial_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_132, AgradCdfTestFixture, AgradCdfBetaBinomial_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_133, AgradCdfTestFixture, AgradCdfBetaBinomial_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_134, AgradCdfTestFixture, AgradCdfBetaBinomial_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_135, AgradCdfTestFixture, AgradCdfBetaBinomial_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_136, AgradCdfTestFixture, AgradCdfBetaBinomial_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_137, AgradCdfTestFixture, AgradCdfBetaBinomial_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_138, AgradCdfTestFixture, AgradCdfBetaBinomial_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_139, AgradCdfTestFixture, AgradCdfBetaBinomial_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_140, AgradCdfTestFixture, AgradCdfBetaBinomial_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_141, AgradCdfTestFixture, AgradCdfBetaBinomial_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_142, AgradCdfTestFixture, AgradCdfBetaBinomial_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_143, AgradCdfTestFixture, AgradCdfBetaBinomial_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_144, AgradCdfTestFixture, AgradCdfBetaBinomial_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_145, AgradCdfTestFixture, AgradCdfBetaBinomial_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_146, AgradCdfTestFixture, AgradCdfBetaBinomial_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_147, AgradCdfTestFixture, AgradCdfBetaBinomial_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_148, AgradCdfTestFixture, AgradCdfBetaBinomial_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_149, AgradCdfTestFixture, AgradCdfBetaBinomial_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_150, AgradCdfTestFixture, AgradCdfBetaBinomial_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_151, AgradCdfTestFixture, AgradCdfBetaBinomial_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_152, AgradCdfTestFixture, AgradCdfBetaBinomial_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_153, AgradCdfTestFixture, AgradCdfBetaBinomial_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_154, AgradCdfTestFixture, AgradCdfBetaBinomial_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_155, AgradCdfTestFixture, AgradCdfBetaBinomial_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_156, AgradCdfTestFixture, AgradCdfBetaBinomial_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_157, AgradCdfTestFixture, AgradCdfBetaBinomial_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_158, AgradCdfTestFixture, AgradCdfBetaBinomial_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_159, AgradCdfTestFixture, AgradCdfBetaBinomial_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_160, AgradCdfTestFixture, AgradCdfBetaBinomial_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_161, AgradCdfTestFixture, AgradCdfBetaBinomial_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_162, AgradCdfTestFixture, AgradCdfBetaBinomial_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_163, AgradCdfTestFixture, AgradCdfBetaBinomial_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_164, AgradCdfTestFixture, AgradCdfBetaBinomial_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_165, AgradCdfTestFixture, AgradCdfBetaBinomial_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_166, AgradCdfTestFixture, AgradCdfBetaBinomial_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_167, AgradCdfTestFixture, AgradCdfBetaBinomial_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_168, AgradCdfTestFixture, AgradCdfBetaBinomial_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_169, AgradCdfTestFixture, AgradCdfBetaBinomial_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_170, AgradCdfTestFixture, AgradCdfBetaBinomial_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_171, AgradCdfTestFixture, AgradCdfBetaBinomial_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_172, AgradCdfTestFixture, AgradCdfBetaBinomial_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_173, AgradCdfTestFixture, AgradCdfBetaBinomial_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_174, AgradCdfTestFixture, AgradCdfBetaBinomial_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_175, AgradCdfTestFixture, AgradCdfBetaBinomial_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_176, AgradCdfTestFixture, AgradCdfBetaBinomial_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_177, AgradCdfTestFixture, AgradCdfBetaBinomial_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_178, AgradCdfTestFixture, AgradCdfBetaBinomial_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_179, AgradCdfTestFixture, AgradCdfBetaBinomial_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_180, AgradCdfTestFixture, AgradCdfBetaBinomial_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_181, AgradCdfTestFixture, AgradCdfBetaBinomial_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_182, AgradCdfTestFixture, AgradCdfBetaBinomial_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_183, AgradCdfTestFixture, AgradCdfBetaBinomial_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_184, AgradCdfTestFixture, AgradCdfBetaBinomial_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_185, AgradCdfTestFixture, AgradCdfBetaBinomial_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_186, AgradCdfTestFixture, AgradCdfBetaBinomial_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_187, AgradCdfTestFixture, AgradCdfBetaBinomial_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_188, AgradCdfTestFixture, AgradCdfBetaBinomial_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_189, AgradCdfTestFixture, AgradCdfBetaBinomial_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_190, AgradCdfTestFixture, AgradCdfBetaBinomial_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_191, AgradCdfTestFixture, AgradCdfBetaBinomial_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_192, AgradCdfTestFixture, AgradCdfBetaBinomial_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_193, AgradCdfTestFixture, AgradCdfBetaBinomial_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_194, AgradCdfTestFixture, AgradCdfBetaBinomial_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_195, AgradCdfTestFixture, AgradCdfBetaBinomial_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_196, AgradCdfTestFixture, AgradCdfBetaBinomial_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_197, AgradCdfTestFixture, AgradCdfBetaBinomial_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_198, AgradCdfTestFixture, AgradCdfBetaBinomial_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_199, AgradCdfTestFixture, AgradCdfBetaBinomial_v_199);
+
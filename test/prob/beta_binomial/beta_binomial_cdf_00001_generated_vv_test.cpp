@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_test.hpp>
+
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<var>, empty, empty> type_vv_100;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_101;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_102;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_103;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_104;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_105;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_106;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_107;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, var, empty, empty> type_vv_108;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, var, empty, empty> type_vv_111;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_vv_112;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_113;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_114;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, double, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, var, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, double, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, var, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_152;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_153;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_154;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_155;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_156;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_157;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_158;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_159;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_160;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_161;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, var, empty, empty> type_vv_162;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty, empty> type_vv_165;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty, empty> type_vv_166;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_167;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, double, empty, empty> type_vv_171;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, var, empty, empty> type_vv_174;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty, empty> type_vv_189;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty, empty> type_vv_198;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_100> AgradCdfBetaBinomial_vv_100;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_101> AgradCdfBetaBinomial_vv_101;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_102> AgradCdfBetaBinomial_vv_102;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_103> AgradCdfBetaBinomial_vv_103;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_104> AgradCdfBetaBinomial_vv_104;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_105> AgradCdfBetaBinomial_vv_105;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_106> AgradCdfBetaBinomial_vv_106;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_107> AgradCdfBetaBinomial_vv_107;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_108> AgradCdfBetaBinomial_vv_108;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_109> AgradCdfBetaBinomial_vv_109;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_110> AgradCdfBetaBinomial_vv_110;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_111> AgradCdfBetaBinomial_vv_111;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_112> AgradCdfBetaBinomial_vv_112;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_113> AgradCdfBetaBinomial_vv_113;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_114> AgradCdfBetaBinomial_vv_114;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_115> AgradCdfBetaBinomial_vv_115;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_116> AgradCdfBetaBinomial_vv_116;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_117> AgradCdfBetaBinomial_vv_117;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_118> AgradCdfBetaBinomial_vv_118;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_119> AgradCdfBetaBinomial_vv_119;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_120> AgradCdfBetaBinomial_vv_120;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_121> AgradCdfBetaBinomial_vv_121;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_122> AgradCdfBetaBinomial_vv_122;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_123> AgradCdfBetaBinomial_vv_123;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_124> AgradCdfBetaBinomial_vv_124;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_125> AgradCdfBetaBinomial_vv_125;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_126> AgradCdfBetaBinomial_vv_126;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_127> AgradCdfBetaBinomial_vv_127;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_128> AgradCdfBetaBinomial_vv_128;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_129> AgradCdfBetaBinomial_vv_129;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_130> AgradCdfBetaBinomial_vv_130;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_131> AgradCdfBetaBinomial_vv_131;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_132> AgradCdfBetaBinomial_vv_132;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_133> AgradCdfBetaBinomial_vv_133;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_134> AgradCdfBetaBinomial_vv_134;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_135> AgradCdfBetaBinomial_vv_135;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_136> AgradCdfBetaBinomial_vv_136;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_137> AgradCdfBetaBinomial_vv_137;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_138> AgradCdfBetaBinomial_vv_138;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_139> AgradCdfBetaBinomial_vv_139;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_140> AgradCdfBetaBinomial_vv_140;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_141> AgradCdfBetaBinomial_vv_141;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_142> AgradCdfBetaBinomial_vv_142;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_143> AgradCdfBetaBinomial_vv_143;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_144> AgradCdfBetaBinomial_vv_144;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_145> AgradCdfBetaBinomial_vv_145;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_146> AgradCdfBetaBinomial_vv_146;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_147> AgradCdfBetaBinomial_vv_147;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_148> AgradCdfBetaBinomial_vv_148;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_149> AgradCdfBetaBinomial_vv_149;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_150> AgradCdfBetaBinomial_vv_150;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_151> AgradCdfBetaBinomial_vv_151;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_152> AgradCdfBetaBinomial_vv_152;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_153> AgradCdfBetaBinomial_vv_153;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_154> AgradCdfBetaBinomial_vv_154;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_155> AgradCdfBetaBinomial_vv_155;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_156> AgradCdfBetaBinomial_vv_156;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_157> AgradCdfBetaBinomial_vv_157;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_158> AgradCdfBetaBinomial_vv_158;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_159> AgradCdfBetaBinomial_vv_159;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_160> AgradCdfBetaBinomial_vv_160;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_161> AgradCdfBetaBinomial_vv_161;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_162> AgradCdfBetaBinomial_vv_162;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_163> AgradCdfBetaBinomial_vv_163;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_164> AgradCdfBetaBinomial_vv_164;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_165> AgradCdfBetaBinomial_vv_165;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_166> AgradCdfBetaBinomial_vv_166;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_167> AgradCdfBetaBinomial_vv_167;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_168> AgradCdfBetaBinomial_vv_168;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_169> AgradCdfBetaBinomial_vv_169;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_170> AgradCdfBetaBinomial_vv_170;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_171> AgradCdfBetaBinomial_vv_171;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_172> AgradCdfBetaBinomial_vv_172;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_173> AgradCdfBetaBinomial_vv_173;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_174> AgradCdfBetaBinomial_vv_174;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_175> AgradCdfBetaBinomial_vv_175;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_176> AgradCdfBetaBinomial_vv_176;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_177> AgradCdfBetaBinomial_vv_177;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_178> AgradCdfBetaBinomial_vv_178;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_179> AgradCdfBetaBinomial_vv_179;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_180> AgradCdfBetaBinomial_vv_180;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_181> AgradCdfBetaBinomial_vv_181;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_182> AgradCdfBetaBinomial_vv_182;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_183> AgradCdfBetaBinomial_vv_183;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_184> AgradCdfBetaBinomial_vv_184;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_185> AgradCdfBetaBinomial_vv_185;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_186> AgradCdfBetaBinomial_vv_186;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_187> AgradCdfBetaBinomial_vv_187;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_188> AgradCdfBetaBinomial_vv_188;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_189> AgradCdfBetaBinomial_vv_189;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_190> AgradCdfBetaBinomial_vv_190;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_191> AgradCdfBetaBinomial_vv_191;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_192> AgradCdfBetaBinomial_vv_192;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_193> AgradCdfBetaBinomial_vv_193;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_194> AgradCdfBetaBinomial_vv_194;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_195> AgradCdfBetaBinomial_vv_195;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_196> AgradCdfBetaBinomial_vv_196;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_197> AgradCdfBetaBinomial_vv_197;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_198> AgradCdfBetaBinomial_vv_198;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_199> AgradCdfBetaBinomial_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_100, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_101, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_102, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_103, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_104, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_105, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_106, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_107, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_108, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_109, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_110, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_111, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_112, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_113, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_114, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_115, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_116, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_117, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_118, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_119, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_120, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_121, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_122, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_123, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_124, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_125, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_126, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_127, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_128, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_129, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_130, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_131, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_132, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_133, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_134, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_135, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_136, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_137, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_138, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_139, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_140, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_141, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_142, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_143, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_144, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_145, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_146, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_147, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_148, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_149, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_150, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_151, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_152, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_153, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_154, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_155, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_156, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_157, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_158, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_159, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_160, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_161, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_162, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_163, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_164, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_165, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_166, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_167, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_168, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_169, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_170, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_171, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_172, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_173, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_174, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_175, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_176, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_177, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_178, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_179, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_180, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_181, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_182, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_183, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_184, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_185, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_186, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_187, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_188, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_189, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_190, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_191, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_192, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_193, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_194, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_195, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_196, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_197, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_198, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_199, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_199);
+
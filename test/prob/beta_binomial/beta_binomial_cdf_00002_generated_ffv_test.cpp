@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_200> AgradCdfBetaBinomial_ffv_200;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_201> AgradCdfBetaBinomial_ffv_201;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_202> AgradCdfBetaBinomial_ffv_202;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_203> AgradCdfBetaBinomial_ffv_203;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_204> AgradCdfBetaBinomial_ffv_204;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_205> AgradCdfBetaBinomial_ffv_205;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_206> AgradCdfBetaBinomial_ffv_206;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_207> AgradCdfBetaBinomial_ffv_207;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_208> AgradCdfBetaBinomial_ffv_208;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_209> AgradCdfBetaBinomial_ffv_209;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_210> AgradCdfBetaBinomial_ffv_210;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_211> AgradCdfBetaBinomial_ffv_211;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_212> AgradCdfBetaBinomial_ffv_212;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_213> AgradCdfBetaBinomial_ffv_213;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_214> AgradCdfBetaBinomial_ffv_214;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_215> AgradCdfBetaBinomial_ffv_215;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_216> AgradCdfBetaBinomial_ffv_216;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_217> AgradCdfBetaBinomial_ffv_217;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_218> AgradCdfBetaBinomial_ffv_218;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_219> AgradCdfBetaBinomial_ffv_219;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_220> AgradCdfBetaBinomial_ffv_220;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_221> AgradCdfBetaBinomial_ffv_221;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_222> AgradCdfBetaBinomial_ffv_222;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_223> AgradCdfBetaBinomial_ffv_223;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_224> AgradCdfBetaBinomial_ffv_224;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_225> AgradCdfBetaBinomial_ffv_225;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_226> AgradCdfBetaBinomial_ffv_226;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_227> AgradCdfBetaBinomial_ffv_227;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_228> AgradCdfBetaBinomial_ffv_228;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_229> AgradCdfBetaBinomial_ffv_229;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_230> AgradCdfBetaBinomial_ffv_230;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_231> AgradCdfBetaBinomial_ffv_231;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_232> AgradCdfBetaBinomial_ffv_232;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_233> AgradCdfBetaBinomial_ffv_233;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_234> AgradCdfBetaBinomial_ffv_234;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_235> AgradCdfBetaBinomial_ffv_235;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_236> AgradCdfBetaBinomial_ffv_236;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_237> AgradCdfBetaBinomial_ffv_237;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_238> AgradCdfBetaBinomial_ffv_238;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_239> AgradCdfBetaBinomial_ffv_239;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_240> AgradCdfBetaBinomial_ffv_240;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_241> AgradCdfBetaBinomial_ffv_241;
+typedef std::tuple<AgradCdfBetaBinomial, type_ffv_242> AgradCdfBetaBinomial_ffv_242;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_200, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_201, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_202, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_203, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_204, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_205, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_206, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_207, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_208, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_209, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_210, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_211, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_212, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_213, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_214, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_215, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_216, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_217, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_218, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_219, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_220, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_221, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_222, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_223, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_224, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_225, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_226, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_227, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_228, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_229, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_230, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_231, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_232, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_233, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_234, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_235, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_236, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_237, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_238, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_239, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_240, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_241, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_ffv_242, AgradCdfTestFixture, AgradCdfBetaBinomial_ffv_242);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_test.hpp>
+
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, double, empty, empty> type_v_216;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, var, empty, empty> type_v_219;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, double, empty, empty> type_v_234;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, var, empty, empty> type_v_237;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty, empty> type_v_252;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty, empty> type_v_255;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty, empty> type_v_270;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty, empty> type_v_273;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCdfBetaBinomial, type_v_200> AgradCdfBetaBinomial_v_200;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_201> AgradCdfBetaBinomial_v_201;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_202> AgradCdfBetaBinomial_v_202;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_203> AgradCdfBetaBinomial_v_203;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_204> AgradCdfBetaBinomial_v_204;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_205> AgradCdfBetaBinomial_v_205;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_206> AgradCdfBetaBinomial_v_206;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_207> AgradCdfBetaBinomial_v_207;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_208> AgradCdfBetaBinomial_v_208;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_209> AgradCdfBetaBinomial_v_209;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_210> AgradCdfBetaBinomial_v_210;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_211> AgradCdfBetaBinomial_v_211;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_212> AgradCdfBetaBinomial_v_212;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_213> AgradCdfBetaBinomial_v_213;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_214> AgradCdfBetaBinomial_v_214;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_215> AgradCdfBetaBinomial_v_215;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_216> AgradCdfBetaBinomial_v_216;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_217> AgradCdfBetaBinomial_v_217;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_218> AgradCdfBetaBinomial_v_218;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_219> AgradCdfBetaBinomial_v_219;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_220> AgradCdfBetaBinomial_v_220;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_221> AgradCdfBetaBinomial_v_221;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_222> AgradCdfBetaBinomial_v_222;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_223> AgradCdfBetaBinomial_v_223;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_224> AgradCdfBetaBinomial_v_224;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_225> AgradCdfBetaBinomial_v_225;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_226> AgradCdfBetaBinomial_v_226;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_227> AgradCdfBetaBinomial_v_227;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_228> AgradCdfBetaBinomial_v_228;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_229> AgradCdfBetaBinomial_v_229;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_230> AgradCdfBetaBinomial_v_230;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_231> AgradCdfBetaBinomial_v_231;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_232> AgradCdfBetaBinomial_v_232;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_233> AgradCdfBetaBinomial_v_233;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_234> AgradCdfBetaBinomial_v_234;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_235> AgradCdfBetaBinomial_v_235;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_236> AgradCdfBetaBinomial_v_236;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_237> AgradCdfBetaBinomial_v_237;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_238> AgradCdfBetaBinomial_v_238;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_239> AgradCdfBetaBinomial_v_239;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_240> AgradCdfBetaBinomial_v_240;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_241> AgradCdfBetaBinomial_v_241;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_242> AgradCdfBetaBinomial_v_242;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_243> AgradCdfBetaBinomial_v_243;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_244> AgradCdfBetaBinomial_v_244;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_245> AgradCdfBetaBinomial_v_245;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_246> AgradCdfBetaBinomial_v_246;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_247> AgradCdfBetaBinomial_v_247;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_248> AgradCdfBetaBinomial_v_248;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_249> AgradCdfBetaBinomial_v_249;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_250> AgradCdfBetaBinomial_v_250;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_251> AgradCdfBetaBinomial_v_251;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_252> AgradCdfBetaBinomial_v_252;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_253> AgradCdfBetaBinomial_v_253;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_254> AgradCdfBetaBinomial_v_254;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_255> AgradCdfBetaBinomial_v_255;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_256> AgradCdfBetaBinomial_v_256;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_257> AgradCdfBetaBinomial_v_257;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_258> AgradCdfBetaBinomial_v_258;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_259> AgradCdfBetaBinomial_v_259;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_260> AgradCdfBetaBinomial_v_260;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_261> AgradCdfBetaBinomial_v_261;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_262> AgradCdfBetaBinomial_v_262;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_263> AgradCdfBetaBinomial_v_263;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_264> AgradCdfBetaBinomial_v_264;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_265> AgradCdfBetaBinomial_v_265;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_266> AgradCdfBetaBinomial_v_266;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_267> AgradCdfBetaBinomial_v_267;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_268> AgradCdfBetaBinomial_v_268;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_269> AgradCdfBetaBinomial_v_269;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_270> AgradCdfBetaBinomial_v_270;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_271> AgradCdfBetaBinomial_v_271;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_272> AgradCdfBetaBinomial_v_272;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_273> AgradCdfBetaBinomial_v_273;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_274> AgradCdfBetaBinomial_v_274;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_275> AgradCdfBetaBinomial_v_275;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_276> AgradCdfBetaBinomial_v_276;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_277> AgradCdfBetaBinomial_v_277;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_278> AgradCdfBetaBinomial_v_278;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_279> AgradCdfBetaBinomial_v_279;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_280> AgradCdfBetaBinomial_v_280;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_281> AgradCdfBetaBinomial_v_281;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_282> AgradCdfBetaBinomial_v_282;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_283> AgradCdfBetaBinomial_v_283;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_284> AgradCdfBetaBinomial_v_284;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_285> AgradCdfBetaBinomial_v_285;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_286> AgradCdfBetaBinomial_v_286;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_287> AgradCdfBetaBinomial_v_287;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_288> AgradCdfBetaBinomial_v_288;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_289> AgradCdfBetaBinomial_v_289;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_290> AgradCdfBetaBinomial_v_290;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_291> AgradCdfBetaBinomial_v_291;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_292> AgradCdfBetaBinomial_v_292;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_293> AgradCdfBetaBinomial_v_293;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_294> AgradCdfBetaBinomial_v_294;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_295> AgradCdfBetaBinomial_v_295;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_296> AgradCdfBetaBinomial_v_296;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_297> AgradCdfBetaBinomial_v_297;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_298> AgradCdfBetaBinomial_v_298;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_299> AgradCdfBetaBinomial_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_200, AgradCdfTestFixture, AgradCdfBetaBinomial_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_201, AgradCdfTestFixture, AgradCdfBetaBinomial_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_202, AgradCdfTestFixture, AgradCdfBetaBinomial_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_203, AgradCdfTestFixture, AgradCdfBetaBinomial_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_204, AgradCdfTestFixture, AgradCdfBetaBinomial_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_205, AgradCdfTestFixture, AgradCdfBetaBinomial_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_206, AgradCdfTestFixture, AgradCdfBetaBinomial_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_207, AgradCdfTestFixture, AgradCdfBetaBinomial_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_208, AgradCdfTestFixture, AgradCdfBetaBinomial_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_209, AgradCdfTestFixture, AgradCdfBetaBinomial_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_210, AgradCdfTestFixture, AgradCdfBetaBinomial_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_211, AgradCdfTestFixture, AgradCdfBetaBinomial_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_212, AgradCdfTestFixture, AgradCdfBetaBinomial_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_213, AgradCdfTestFixture, AgradCdfBetaBinomial_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_214, AgradCdfTestFixture, AgradCdfBetaBinomial_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_215, AgradCdfTestFixture, AgradCdfBetaBinomial_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_216, AgradCdfTestFixture, AgradCdfBetaBinomial_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_217, AgradCdfTestFixture, AgradCdfBetaBinomial_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_218, AgradCdfTestFixture, AgradCdfBetaBinomial_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_219, AgradCdfTestFixture, AgradCdfBetaBinomial_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_220, AgradCdfTestFixture, AgradCdfBetaBinomial_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_221, AgradCdfTestFixture, AgradCdfBetaBinomial_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_222, AgradCdfTestFixture, AgradCdfBetaBinomial_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_223, AgradCdfTestFixture, AgradCdfBetaBinomial_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_224, AgradCdfTestFixture, AgradCdfBetaBinomial_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_225, AgradCdfTestFixture, AgradCdfBetaBinomial_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_226, AgradCdfTestFixture, AgradCdfBetaBinomial_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_227, AgradCdfTestFixture, AgradCdfBetaBinomial_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_228, AgradCdfTestFixture, AgradCdfBetaBinomial_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_229, AgradCdfTestFixture, AgradCdfBetaBinomial_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_230, AgradCdfTestFixture, AgradCdfBetaBinomial_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_231, AgradCdfTestFixture, AgradCdfBetaBinomial_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_232, AgradCdfTestFixture, AgradCdfBetaBinomial_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_233, AgradCdfTestFixture, AgradCdfBetaBinomial_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_234, AgradCdfTestFixture, AgradCdfBetaBinomial_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_235, AgradCdfTestFixture, AgradCdfBetaBinomial_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_236, AgradCdfTestFixture, AgradCdfBetaBinomial_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_237, AgradCdfTestFixture, AgradCdfBetaBinomial_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_238, AgradCdfTestFixture, AgradCdfBetaBinomial_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_239, AgradCdfTestFixture, AgradCdfBetaBinomial_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_240, AgradCdfTestFixture, AgradCdfBetaBinomial_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_241, AgradCdfTestFixture, AgradCdfBetaBinomial_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_242, AgradCdfTestFixture, AgradCdfBetaBinomial_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_243, AgradCdfTestFixture, AgradCdfBetaBinomial_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_244, AgradCdfTestFixture, AgradCdfBetaBinomial_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_245, AgradCdfTestFixture, AgradCdfBetaBinomial_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_246, AgradCdfTestFixture, AgradCdfBetaBinomial_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_247, AgradCdfTestFixture, AgradCdfBetaBinomial_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_248, AgradCdfTestFixture, AgradCdfBetaBinomial_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_249, AgradCdfTestFixture, AgradCdfBetaBinomial_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_250, AgradCdfTestFixture, AgradCdfBetaBinomial_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_251, AgradCdfTestFixture, AgradCdfBetaBinomial_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_252, AgradCdfTestFixture, AgradCdfBetaBinomial_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_253, AgradCdfTestFixture, AgradCdfBetaBinomial_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_254, AgradCdfTestFixture, AgradCdfBetaBinomial_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_255, AgradCdfTestFixture, AgradCdfBetaBinomial_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_256, AgradCdfTestFixture, AgradCdfBetaBinomial_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_257, AgradCdfTestFixture, AgradCdfBetaBinomial_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_258, AgradCdfTestFixture, AgradCdfBetaBinomial_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_259, AgradCdfTestFixture, AgradCdfBetaBinomial_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_260, AgradCdfTestFixture, AgradCdfBetaBinomial_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_261, AgradCdfTestFixture, AgradCdfBetaBinomial_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_262, AgradCdfTestFixture, AgradCdfBetaBinomial_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_263, AgradCdfTestFixture, AgradCdfBetaBinomial_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_264, AgradCdfTestFixture, AgradCdfBetaBinomial_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_265, AgradCdfTestFixture, AgradCdfBetaBinomial_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_266, AgradCdfTestFixture, AgradCdfBetaBinomial_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_267, AgradCdfTestFixture, AgradCdfBetaBinomial_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_268, AgradCdfTestFixture, AgradCdfBetaBinomial_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_269, AgradCdfTestFixture, AgradCdfBetaBinomial_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_270, AgradCdfTestFixture, AgradCdfBetaBinomial_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_271, AgradCdfTestFixture, AgradCdfBetaBinomial_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_272, AgradCdfTestFixture, AgradCdfBetaBinomial_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_273, AgradCdfTestFixture, AgradCdfBetaBinomial_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_274, AgradCdfTestFixture, AgradCdfBetaBinomial_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_275, AgradCdfTestFixture, AgradCdfBetaBinomial_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_276, AgradCdfTestFixture, AgradCdfBetaBinomial_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_277, AgradCdfTestFixture, AgradCdfBetaBinomial_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_278, AgradCdfTestFixture, AgradCdfBetaBinomial_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_279, AgradCdfTestFixture, AgradCdfBetaBinomial_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_280, AgradCdfTestFixture, AgradCdfBetaBinomial_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_281, AgradCdfTestFixture, AgradCdfBetaBinomial_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_282, AgradCdfTestFixture, AgradCdfBetaBinomial_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_283, AgradCdfTestFixture, AgradCdfBetaBinomial_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_284, AgradCdfTestFixture, AgradCdfBetaBinomial_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_285, AgradCdfTestFixture, AgradCdfBetaBinomial_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_286, AgradCdfTestFixture, AgradCdfBetaBinomial_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_287, AgradCdfTestFixture, AgradCdfBetaBinomial_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_288, AgradCdfTestFixture, AgradCdfBetaBinomial_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_289, AgradCdfTestFixture, AgradCdfBetaBinomial_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_290, AgradCdfTestFixture, AgradCdfBetaBinomial_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_291, AgradCdfTestFixture, AgradCdfBetaBinomial_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_292, AgradCdfTestFixture, AgradCdfBetaBinomial_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_293, AgradCdfTestFixture, AgradCdfBetaBinomial_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_294, AgradCdfTestFixture, AgradCdfBetaBinomial_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_295, AgradCdfTestFixture, AgradCdfBetaBinomial_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_296, AgradCdfTestFixture, AgradCdfBetaBinomial_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_297, AgradCdfTestFixture, AgradCdfBetaBinomial_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_298, AgradCdfTestFixture, AgradCdfBetaBinomial_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_299, AgradCdfTestFixture, AgradCdfBetaBinomial_v_299);
+
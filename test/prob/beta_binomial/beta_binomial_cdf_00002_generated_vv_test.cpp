@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty, empty> type_vv_201;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_200> AgradCdfBetaBinomial_vv_200;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_201> AgradCdfBetaBinomial_vv_201;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_202> AgradCdfBetaBinomial_vv_202;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_203> AgradCdfBetaBinomial_vv_203;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_204> AgradCdfBetaBinomial_vv_204;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_205> AgradCdfBetaBinomial_vv_205;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_206> AgradCdfBetaBinomial_vv_206;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_207> AgradCdfBetaBinomial_vv_207;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_208> AgradCdfBetaBinomial_vv_208;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_209> AgradCdfBetaBinomial_vv_209;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_210> AgradCdfBetaBinomial_vv_210;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_211> AgradCdfBetaBinomial_vv_211;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_212> AgradCdfBetaBinomial_vv_212;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_213> AgradCdfBetaBinomial_vv_213;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_214> AgradCdfBetaBinomial_vv_214;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_215> AgradCdfBetaBinomial_vv_215;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_216> AgradCdfBetaBinomial_vv_216;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_217> AgradCdfBetaBinomial_vv_217;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_218> AgradCdfBetaBinomial_vv_218;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_219> AgradCdfBetaBinomial_vv_219;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_220> AgradCdfBetaBinomial_vv_220;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_221> AgradCdfBetaBinomial_vv_221;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_222> AgradCdfBetaBinomial_vv_222;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_223> AgradCdfBetaBinomial_vv_223;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_224> AgradCdfBetaBinomial_vv_224;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_225> AgradCdfBetaBinomial_vv_225;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_226> AgradCdfBetaBinomial_vv_226;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_227> AgradCdfBetaBinomial_vv_227;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_228> AgradCdfBetaBinomial_vv_228;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_229> AgradCdfBetaBinomial_vv_229;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_230> AgradCdfBetaBinomial_vv_230;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_231> AgradCdfBetaBinomial_vv_231;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_232> AgradCdfBetaBinomial_vv_232;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_233> AgradCdfBetaBinomial_vv_233;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_234> AgradCdfBetaBinomial_vv_234;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_235> AgradCdfBetaBinomial_vv_235;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_236> AgradCdfBetaBinomial_vv_236;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_237> AgradCdfBetaBinomial_vv_237;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_238> AgradCdfBetaBinomial_vv_238;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_239> AgradCdfBetaBinomial_vv_239;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_240> AgradCdfBetaBinomial_vv_240;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_241> AgradCdfBetaBinomial_vv_241;
+typedef std::tuple<AgradCdfBetaBinomial, type_vv_242> AgradCdfBetaBinomial_vv_242;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_200, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_201, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_202, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_203, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_204, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_205, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_206, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_207, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_208, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_209, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_210, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_211, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_212, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_213, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_214, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_215, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_216, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_217, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_218, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_219, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_220, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_221, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_222, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_223, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_224, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_225, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_226, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_227, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_228, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_229, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_230, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_231, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_232, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_233, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_234, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_235, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_236, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_237, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_238, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_239, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_240, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_241, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_vv_242, AgradCdfTestFixture, AgradCdfBetaBinomial_vv_242);
+
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+
+typedef std::tuple<AgradCdfBetaBinomial, type_v_300> AgradCdfBetaBinomial_v_300;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_301> AgradCdfBetaBinomial_v_301;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_302> AgradCdfBetaBinomial_v_302;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_303> AgradCdfBetaBinomial_v_303;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_304> AgradCdfBetaBinomial_v_304;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_305> AgradCdfBetaBinomial_v_305;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_306> AgradCdfBetaBinomial_v_306;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_307> AgradCdfBetaBinomial_v_307;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_308> AgradCdfBetaBinomial_v_308;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_309> AgradCdfBetaBinomial_v_309;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_310> AgradCdfBetaBinomial_v_310;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_311> AgradCdfBetaBinomial_v_311;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_312> AgradCdfBetaBinomial_v_312;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_313> AgradCdfBetaBinomial_v_313;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_314> AgradCdfBetaBinomial_v_314;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_315> AgradCdfBetaBinomial_v_315;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_316> AgradCdfBetaBinomial_v_316;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_317> AgradCdfBetaBinomial_v_317;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_318> AgradCdfBetaBinomial_v_318;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_319> AgradCdfBetaBinomial_v_319;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_320> AgradCdfBetaBinomial_v_320;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_321> AgradCdfBetaBinomial_v_321;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_322> AgradCdfBetaBinomial_v_322;
+typedef std::tuple<AgradCdfBetaBinomial, type_v_323> AgradCdfBetaBinomial_v_323;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_300, AgradCdfTestFixture, AgradCdfBetaBinomial_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_301, AgradCdfTestFixture, AgradCdfBetaBinomial_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_302, AgradCdfTestFixture, AgradCdfBetaBinomial_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_303, AgradCdfTestFixture, AgradCdfBetaBinomial_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_304, AgradCdfTestFixture, AgradCdfBetaBinomial_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_305, AgradCdfTestFixture, AgradCdfBetaBinomial_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_306, AgradCdfTestFixture, AgradCdfBetaBinomial_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_307, AgradCdfTestFixture, AgradCdfBetaBinomial_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_308, AgradCdfTestFixture, AgradCdfBetaBinomial_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_309, AgradCdfTestFixture, AgradCdfBetaBinomial_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_310, AgradCdfTestFixture, AgradCdfBetaBinomial_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_311, AgradCdfTestFixture, AgradCdfBetaBinomial_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_312, AgradCdfTestFixture, AgradCdfBetaBinomial_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_313, AgradCdfTestFixture, AgradCdfBetaBinomial_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_314, AgradCdfTestFixture, AgradCdfBetaBinomial_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_315, AgradCdfTestFixture, AgradCdfBetaBinomial_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_316, AgradCdfTestFixture, AgradCdfBetaBinomial_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_317, AgradCdfTestFixture, AgradCdfBetaBinomial_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_318, AgradCdfTestFixture, AgradCdfBetaBinomial_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_319, AgradCdfTestFixture, AgradCdfBetaBinomial_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_320, AgradCdfTestFixture, AgradCdfBetaBinomial_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_321, AgradCdfTestFixture, AgradCdfBetaBinomial_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_322, AgradCdfTestFixture, AgradCdfBetaBinomial_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaBinomial_v_323, AgradCdfTestFixture, AgradCdfBetaBinomial_v_323);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, int, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<int, int, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<int, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<int, int, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<int, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<int, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<int, int, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<int, int, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<int, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<int, int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<int, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<int, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<int, std::vector<int>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<int, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<int, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<std::vector<int>, int, double, fvar<fvar<var> >, empty, empty> type_ffv_81;
+typedef std::tuple<std::vector<int>, int, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_82;
+typedef std::tuple<std::vector<int>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_87;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_88;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, double, empty, empty> type_ffv_90;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_91;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_93;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_94;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_96;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_97;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_0> AgradCdfLogBetaBinomial_ffv_0;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_1> AgradCdfLogBetaBinomial_ffv_1;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_2> AgradCdfLogBetaBinomial_ffv_2;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_3> AgradCdfLogBetaBinomial_ffv_3;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_4> AgradCdfLogBetaBinomial_ffv_4;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_5> AgradCdfLogBetaBinomial_ffv_5;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_6> AgradCdfLogBetaBinomial_ffv_6;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_7> AgradCdfLogBetaBinomial_ffv_7;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_8> AgradCdfLogBetaBinomial_ffv_8;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_9> AgradCdfLogBetaBinomial_ffv_9;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_10> AgradCdfLogBetaBinomial_ffv_10;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_11> AgradCdfLogBetaBinomial_ffv_11;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_12> AgradCdfLogBetaBinomial_ffv_12;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_13> AgradCdfLogBetaBinomial_ffv_13;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_14> AgradCdfLogBetaBinomial_ffv_14;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_15> AgradCdfLogBetaBinomial_ffv_15;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_16> AgradCdfLogBetaBinomial_ffv_16;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_17> AgradCdfLogBetaBinomial_ffv_17;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_18> AgradCdfLogBetaBinomial_ffv_18;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_19> AgradCdfLogBetaBinomial_ffv_19;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_20> AgradCdfLogBetaBinomial_ffv_20;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_21> AgradCdfLogBetaBinomial_ffv_21;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_22> AgradCdfLogBetaBinomial_ffv_22;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_23> AgradCdfLogBetaBinomial_ffv_23;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_24> AgradCdfLogBetaBinomial_ffv_24;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_25> AgradCdfLogBetaBinomial_ffv_25;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_26> AgradCdfLogBetaBinomial_ffv_26;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_27> AgradCdfLogBetaBinomial_ffv_27;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_28> AgradCdfLogBetaBinomial_ffv_28;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_29> AgradCdfLogBetaBinomial_ffv_29;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_30> AgradCdfLogBetaBinomial_ffv_30;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_31> AgradCdfLogBetaBinomial_ffv_31;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_32> AgradCdfLogBetaBinomial_ffv_32;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_33> AgradCdfLogBetaBinomial_ffv_33;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_34> AgradCdfLogBetaBinomial_ffv_34;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_35> AgradCdfLogBetaBinomial_ffv_35;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_36> AgradCdfLogBetaBinomial_ffv_36;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_37> AgradCdfLogBetaBinomial_ffv_37;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_38> AgradCdfLogBetaBinomial_ffv_38;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_39> AgradCdfLogBetaBinomial_ffv_39;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_40> AgradCdfLogBetaBinomial_ffv_40;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_41> AgradCdfLogBetaBinomial_ffv_41;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_42> AgradCdfLogBetaBinomial_ffv_42;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_43> AgradCdfLogBetaBinomial_ffv_43;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_44> AgradCdfLogBetaBinomial_ffv_44;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_45> AgradCdfLogBetaBinomial_ffv_45;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_46> AgradCdfLogBetaBinomial_ffv_46;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_47> AgradCdfLogBetaBinomial_ffv_47;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_48> AgradCdfLogBetaBinomial_ffv_48;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_49> AgradCdfLogBetaBinomial_ffv_49;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_50> AgradCdfLogBetaBinomial_ffv_50;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_51> AgradCdfLogBetaBinomial_ffv_51;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_52> AgradCdfLogBetaBinomial_ffv_52;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_53> AgradCdfLogBetaBinomial_ffv_53;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_54> AgradCdfLogBetaBinomial_ffv_54;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_55> AgradCdfLogBetaBinomial_ffv_55;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_56> AgradCdfLogBetaBinomial_ffv_56;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_57> AgradCdfLogBetaBinomial_ffv_57;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_58> AgradCdfLogBetaBinomial_ffv_58;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_59> AgradCdfLogBetaBinomial_ffv_59;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_60> AgradCdfLogBetaBinomial_ffv_60;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_61> AgradCdfLogBetaBinomial_ffv_61;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_62> AgradCdfLogBetaBinomial_ffv_62;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_63> AgradCdfLogBetaBinomial_ffv_63;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_64> AgradCdfLogBetaBinomial_ffv_64;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_65> AgradCdfLogBetaBinomial_ffv_65;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_66> AgradCdfLogBetaBinomial_ffv_66;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_67> AgradCdfLogBetaBinomial_ffv_67;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_68> AgradCdfLogBetaBinomial_ffv_68;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_69> AgradCdfLogBetaBinomial_ffv_69;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_70> AgradCdfLogBetaBinomial_ffv_70;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_71> AgradCdfLogBetaBinomial_ffv_71;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_72> AgradCdfLogBetaBinomial_ffv_72;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_73> AgradCdfLogBetaBinomial_ffv_73;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_74> AgradCdfLogBetaBinomial_ffv_74;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_75> AgradCdfLogBetaBinomial_ffv_75;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_76> AgradCdfLogBetaBinomial_ffv_76;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_77> AgradCdfLogBetaBinomial_ffv_77;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_78> AgradCdfLogBetaBinomial_ffv_78;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_79> AgradCdfLogBetaBinomial_ffv_79;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_80> AgradCdfLogBetaBinomial_ffv_80;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_81> AgradCdfLogBetaBinomial_ffv_81;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_82> AgradCdfLogBetaBinomial_ffv_82;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_83> AgradCdfLogBetaBinomial_ffv_83;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_84> AgradCdfLogBetaBinomial_ffv_84;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_85> AgradCdfLogBetaBinomial_ffv_85;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_86> AgradCdfLogBetaBinomial_ffv_86;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_87> AgradCdfLogBetaBinomial_ffv_87;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_88> AgradCdfLogBetaBinomial_ffv_88;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_89> AgradCdfLogBetaBinomial_ffv_89;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_90> AgradCdfLogBetaBinomial_ffv_90;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_91> AgradCdfLogBetaBinomial_ffv_91;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_92> AgradCdfLogBetaBinomial_ffv_92;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_93> AgradCdfLogBetaBinomial_ffv_93;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_94> AgradCdfLogBetaBinomial_ffv_94;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_95> AgradCdfLogBetaBinomial_ffv_95;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_96> AgradCdfLogBetaBinomial_ffv_96;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_97> AgradCdfLogBetaBinomial_ffv_97;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_98> AgradCdfLogBetaBinomial_ffv_98;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_99> AgradCdfLogBetaBinomial_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_0, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_1, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_2, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_3, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_4, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_5, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_6, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_7, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_8, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_9, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_10, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_11, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_12, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_13, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_14, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_15, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_16, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_17, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_18, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_19, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_20, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_21, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_22, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_23, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_24, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_25, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_26, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_27, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_28, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_29, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_30, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_31, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_32, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_33, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_34, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_35, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_36, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_37, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_38, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_39, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_40, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_41, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_42, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_43, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_44, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_45, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_46, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_47, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_48, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_49, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_50, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_51, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_52, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_53, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_54, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_55, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_56, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_57, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_58, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_59, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_60, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_61, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_62, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_63, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_64, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_65, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_66, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_67, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_68, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_69, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_70, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_71, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_72, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_73, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_74, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_75, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_76, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_77, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_78, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_79, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_80, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_81, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_82, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_83, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_84, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_85, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_86, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_87, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_88, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_89, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_90, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_91, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_92, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_93, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_94, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_95, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_96, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_97, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_98, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_99, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, int, double, double, empty, empty> type_v_0;
+typedef std::tuple<int, int, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<int, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<int, int, double, var, empty, empty> type_v_3;
+typedef std::tuple<int, int, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<int, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<int, int, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<int, int, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<int, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<int, int, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<int, int, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<int, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<int, int, var, double, empty, empty> type_v_18;
+typedef std::tuple<int, int, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<int, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<int, int, var, var, empty, empty> type_v_21;
+typedef std::tuple<int, int, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<int, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<int, int, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<int, int, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<int, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<int, int, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<int, int, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<int, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<int, std::vector<int>, double, double, empty, empty> type_v_36;
+typedef std::tuple<int, std::vector<int>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<int, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<int, std::vector<int>, double, var, empty, empty> type_v_39;
+typedef std::tuple<int, std::vector<int>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<int, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<int, std::vector<int>, var, double, empty, empty> type_v_54;
+typedef std::tuple<int, std::vector<int>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<int, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<int, std::vector<int>, var, var, empty, empty> type_v_57;
+typedef std::tuple<int, std::vector<int>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<int, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_0> AgradCdfLogBetaBinomial_v_0;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_1> AgradCdfLogBetaBinomial_v_1;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_2> AgradCdfLogBetaBinomial_v_2;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_3> AgradCdfLogBetaBinomial_v_3;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_4> AgradCdfLogBetaBinomial_v_4;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_5> AgradCdfLogBetaBinomial_v_5;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_6> AgradCdfLogBetaBinomial_v_6;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_7> AgradCdfLogBetaBinomial_v_7;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_8> AgradCdfLogBetaBinomial_v_8;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_9> AgradCdfLogBetaBinomial_v_9;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_10> AgradCdfLogBetaBinomial_v_10;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_11> AgradCdfLogBetaBinomial_v_11;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_12> AgradCdfLogBetaBinomial_v_12;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_13> AgradCdfLogBetaBinomial_v_13;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_14> AgradCdfLogBetaBinomial_v_14;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_15> AgradCdfLogBetaBinomial_v_15;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_16> AgradCdfLogBetaBinomial_v_16;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_17> AgradCdfLogBetaBinomial_v_17;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_18> AgradCdfLogBetaBinomial_v_18;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_19> AgradCdfLogBetaBinomial_v_19;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_20> AgradCdfLogBetaBinomial_v_20;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_21> AgradCdfLogBetaBinomial_v_21;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_22> AgradCdfLogBetaBinomial_v_22;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_23> AgradCdfLogBetaBinomial_v_23;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_24> AgradCdfLogBetaBinomial_v_24;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_25> AgradCdfLogBetaBinomial_v_25;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_26> AgradCdfLogBetaBinomial_v_26;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_27> AgradCdfLogBetaBinomial_v_27;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_28> AgradCdfLogBetaBinomial_v_28;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_29> AgradCdfLogBetaBinomial_v_29;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_30> AgradCdfLogBetaBinomial_v_30;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_31> AgradCdfLogBetaBinomial_v_31;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_32> AgradCdfLogBetaBinomial_v_32;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_33> AgradCdfLogBetaBinomial_v_33;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_34> AgradCdfLogBetaBinomial_v_34;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_35> AgradCdfLogBetaBinomial_v_35;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_36> AgradCdfLogBetaBinomial_v_36;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_37> AgradCdfLogBetaBinomial_v_37;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_38> AgradCdfLogBetaBinomial_v_38;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_39> AgradCdfLogBetaBinomial_v_39;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_40> AgradCdfLogBetaBinomial_v_40;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_41> AgradCdfLogBetaBinomial_v_41;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_42> AgradCdfLogBetaBinomial_v_42;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_43> AgradCdfLogBetaBinomial_v_43;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_44> AgradCdfLogBetaBinomial_v_44;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_45> AgradCdfLogBetaBinomial_v_45;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_46> AgradCdfLogBetaBinomial_v_46;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_47> AgradCdfLogBetaBinomial_v_47;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_48> AgradCdfLogBetaBinomial_v_48;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_49> AgradCdfLogBetaBinomial_v_49;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_50> AgradCdfLogBetaBinomial_v_50;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_51> AgradCdfLogBetaBinomial_v_51;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_52> AgradCdfLogBetaBinomial_v_52;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_53> AgradCdfLogBetaBinomial_v_53;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_54> AgradCdfLogBetaBinomial_v_54;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_55> AgradCdfLogBetaBinomial_v_55;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_56> AgradCdfLogBetaBinomial_v_56;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_57> AgradCdfLogBetaBinomial_v_57;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_58> AgradCdfLogBetaBinomial_v_58;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_59> AgradCdfLogBetaBinomial_v_59;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_60> AgradCdfLogBetaBinomial_v_60;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_61> AgradCdfLogBetaBinomial_v_61;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_62> AgradCdfLogBetaBinomial_v_62;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_63> AgradCdfLogBetaBinomial_v_63;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_64> AgradCdfLogBetaBinomial_v_64;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_65> AgradCdfLogBetaBinomial_v_65;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_66> AgradCdfLogBetaBinomial_v_66;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_67> AgradCdfLogBetaBinomial_v_67;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_68> AgradCdfLogBetaBinomial_v_68;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_69> AgradCdfLogBetaBinomial_v_69;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_70> AgradCdfLogBetaBinomial_v_70;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_71> AgradCdfLogBetaBinomial_v_71;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_72> AgradCdfLogBetaBinomial_v_72;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_73> AgradCdfLogBetaBinomial_v_73;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_74> AgradCdfLogBetaBinomial_v_74;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_75> AgradCdfLogBetaBinomial_v_75;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_76> AgradCdfLogBetaBinomial_v_76;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_77> AgradCdfLogBetaBinomial_v_77;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_78> AgradCdfLogBetaBinomial_v_78;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_79> AgradCdfLogBetaBinomial_v_79;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_80> AgradCdfLogBetaBinomial_v_80;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_81> AgradCdfLogBetaBinomial_v_81;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_82> AgradCdfLogBetaBinomial_v_82;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_83> AgradCdfLogBetaBinomial_v_83;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_84> AgradCdfLogBetaBinomial_v_84;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_85> AgradCdfLogBetaBinomial_v_85;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_86> AgradCdfLogBetaBinomial_v_86;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_87> AgradCdfLogBetaBinomial_v_87;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_88> AgradCdfLogBetaBinomial_v_88;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_89> AgradCdfLogBetaBinomial_v_89;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_90> AgradCdfLogBetaBinomial_v_90;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_91> AgradCdfLogBetaBinomial_v_91;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_92> AgradCdfLogBetaBinomial_v_92;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_93> AgradCdfLogBetaBinomial_v_93;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_94> AgradCdfLogBetaBinomial_v_94;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_95> AgradCdfLogBetaBinomial_v_95;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_96> AgradCdfLogBetaBinomial_v_96;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_97> AgradCdfLogBetaBinomial_v_97;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_98> AgradCdfLogBetaBinomial_v_98;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_99> AgradCdfLogBetaBinomial_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_0, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_1, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_2, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_3, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_4, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_5, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_6, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_7, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_8, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_9, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_10, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_11, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_12, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_13, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_14, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_15, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_16, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_17, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_18, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_19, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_20, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_21, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_22, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_23, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_24, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_25, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_26, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_27, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_28, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_29, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_30, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_31, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_32, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_33, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_34, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_35, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_36, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_37, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_38, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_39, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_40, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_41, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_42, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_43, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_44, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_45, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_46, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_47, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_48, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_49, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_50, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_51, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_52, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_53, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_54, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_55, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_56, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_57, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_58, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_59, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_60, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_61, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_62, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_63, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_64, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_65, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_66, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_67, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_68, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_69, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_70, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_71, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_72, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_73, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_74, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_75, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_76, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_77, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_78, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_79, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_80, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_81, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_82, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_83, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_84, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_85, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_86, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_87, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_88, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_89, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_90, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_91, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_92, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_93, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_94, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_95, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_96, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_97, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_98, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_99, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, int, double, var, empty, empty> type_vv_0;
+typedef std::tuple<int, int, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<int, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<int, int, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<int, int, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<int, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<int, int, var, double, empty, empty> type_vv_9;
+typedef std::tuple<int, int, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<int, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<int, int, var, var, empty, empty> type_vv_12;
+typedef std::tuple<int, int, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<int, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<int, int, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<int, int, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<int, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<int, int, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<int, int, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<int, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<int, std::vector<int>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<int, std::vector<int>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<int, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<int, std::vector<int>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<int, std::vector<int>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<int, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<int, std::vector<int>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<int, std::vector<int>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<int, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<std::vector<int>, int, double, var, empty, empty> type_vv_81;
+typedef std::tuple<std::vector<int>, int, double, std::vector<var>, empty, empty> type_vv_82;
+typedef std::tuple<std::vector<int>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_83;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, var, empty, empty> type_vv_84;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_87;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_88;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_89;
+typedef std::tuple<std::vector<int>, int, var, double, empty, empty> type_vv_90;
+typedef std::tuple<std::vector<int>, int, var, std::vector<double>, empty, empty> type_vv_91;
+typedef std::tuple<std::vector<int>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_92;
+typedef std::tuple<std::vector<int>, int, var, var, empty, empty> type_vv_93;
+typedef std::tuple<std::vector<int>, int, var, std::vector<var>, empty, empty> type_vv_94;
+typedef std::tuple<std::vector<int>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_95;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, double, empty, empty> type_vv_96;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<double>, empty, empty> type_vv_97;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_98;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, var, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_0> AgradCdfLogBetaBinomial_vv_0;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_1> AgradCdfLogBetaBinomial_vv_1;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_2> AgradCdfLogBetaBinomial_vv_2;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_3> AgradCdfLogBetaBinomial_vv_3;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_4> AgradCdfLogBetaBinomial_vv_4;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_5> AgradCdfLogBetaBinomial_vv_5;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_6> AgradCdfLogBetaBinomial_vv_6;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_7> AgradCdfLogBetaBinomial_vv_7;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_8> AgradCdfLogBetaBinomial_vv_8;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_9> AgradCdfLogBetaBinomial_vv_9;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_10> AgradCdfLogBetaBinomial_vv_10;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_11> AgradCdfLogBetaBinomial_vv_11;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_12> AgradCdfLogBetaBinomial_vv_12;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_13> AgradCdfLogBetaBinomial_vv_13;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_14> AgradCdfLogBetaBinomial_vv_14;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_15> AgradCdfLogBetaBinomial_vv_15;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_16> AgradCdfLogBetaBinomial_vv_16;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_17> AgradCdfLogBetaBinomial_vv_17;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_18> AgradCdfLogBetaBinomial_vv_18;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_19> AgradCdfLogBetaBinomial_vv_19;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_20> AgradCdfLogBetaBinomial_vv_20;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_21> AgradCdfLogBetaBinomial_vv_21;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_22> AgradCdfLogBetaBinomial_vv_22;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_23> AgradCdfLogBetaBinomial_vv_23;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_24> AgradCdfLogBetaBinomial_vv_24;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_25> AgradCdfLogBetaBinomial_vv_25;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_26> AgradCdfLogBetaBinomial_vv_26;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_27> AgradCdfLogBetaBinomial_vv_27;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_28> AgradCdfLogBetaBinomial_vv_28;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_29> AgradCdfLogBetaBinomial_vv_29;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_30> AgradCdfLogBetaBinomial_vv_30;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_31> AgradCdfLogBetaBinomial_vv_31;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_32> AgradCdfLogBetaBinomial_vv_32;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_33> AgradCdfLogBetaBinomial_vv_33;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_34> AgradCdfLogBetaBinomial_vv_34;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_35> AgradCdfLogBetaBinomial_vv_35;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_36> AgradCdfLogBetaBinomial_vv_36;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_37> AgradCdfLogBetaBinomial_vv_37;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_38> AgradCdfLogBetaBinomial_vv_38;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_39> AgradCdfLogBetaBinomial_vv_39;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_40> AgradCdfLogBetaBinomial_vv_40;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_41> AgradCdfLogBetaBinomial_vv_41;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_42> AgradCdfLogBetaBinomial_vv_42;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_43> AgradCdfLogBetaBinomial_vv_43;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_44> AgradCdfLogBetaBinomial_vv_44;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_45> AgradCdfLogBetaBinomial_vv_45;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_46> AgradCdfLogBetaBinomial_vv_46;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_47> AgradCdfLogBetaBinomial_vv_47;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_48> AgradCdfLogBetaBinomial_vv_48;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_49> AgradCdfLogBetaBinomial_vv_49;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_50> AgradCdfLogBetaBinomial_vv_50;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_51> AgradCdfLogBetaBinomial_vv_51;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_52> AgradCdfLogBetaBinomial_vv_52;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_53> AgradCdfLogBetaBinomial_vv_53;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_54> AgradCdfLogBetaBinomial_vv_54;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_55> AgradCdfLogBetaBinomial_vv_55;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_56> AgradCdfLogBetaBinomial_vv_56;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_57> AgradCdfLogBetaBinomial_vv_57;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_58> AgradCdfLogBetaBinomial_vv_58;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_59> AgradCdfLogBetaBinomial_vv_59;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_60> AgradCdfLogBetaBinomial_vv_60;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_61> AgradCdfLogBetaBinomial_vv_61;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_62> AgradCdfLogBetaBinomial_vv_62;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_63> AgradCdfLogBetaBinomial_vv_63;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_64> AgradCdfLogBetaBinomial_vv_64;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_65> AgradCdfLogBetaBinomial_vv_65;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_66> AgradCdfLogBetaBinomial_vv_66;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_67> AgradCdfLogBetaBinomial_vv_67;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_68> AgradCdfLogBetaBinomial_vv_68;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_69> AgradCdfLogBetaBinomial_vv_69;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_70> AgradCdfLogBetaBinomial_vv_70;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_71> AgradCdfLogBetaBinomial_vv_71;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_72> AgradCdfLogBetaBinomial_vv_72;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_73> AgradCdfLogBetaBinomial_vv_73;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_74> AgradCdfLogBetaBinomial_vv_74;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_75> AgradCdfLogBetaBinomial_vv_75;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_76> AgradCdfLogBetaBinomial_vv_76;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_77> AgradCdfLogBetaBinomial_vv_77;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_78> AgradCdfLogBetaBinomial_vv_78;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_79> AgradCdfLogBetaBinomial_vv_79;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_80> AgradCdfLogBetaBinomial_vv_80;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_81> AgradCdfLogBetaBinomial_vv_81;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_82> AgradCdfLogBetaBinomial_vv_82;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_83> AgradCdfLogBetaBinomial_vv_83;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_84> AgradCdfLogBetaBinomial_vv_84;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_85> AgradCdfLogBetaBinomial_vv_85;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_86> AgradCdfLogBetaBinomial_vv_86;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_87> AgradCdfLogBetaBinomial_vv_87;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_88> AgradCdfLogBetaBinomial_vv_88;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_89> AgradCdfLogBetaBinomial_vv_89;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_90> AgradCdfLogBetaBinomial_vv_90;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_91> AgradCdfLogBetaBinomial_vv_91;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_92> AgradCdfLogBetaBinomial_vv_92;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_93> AgradCdfLogBetaBinomial_vv_93;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_94> AgradCdfLogBetaBinomial_vv_94;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_95> AgradCdfLogBetaBinomial_vv_95;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_96> AgradCdfLogBetaBinomial_vv_96;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_97> AgradCdfLogBetaBinomial_vv_97;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_98> AgradCdfLogBetaBinomial_vv_98;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_99> AgradCdfLogBetaBinomial_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_0, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_1, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_2, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_3, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_4, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_5, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_6, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_7, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_8, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_9, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_10, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_11, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_12, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_13, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_14, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_15, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_16, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_17, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_18, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_19, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_20, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_21, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_22, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_23, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_24, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_25, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_26, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_27, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_28, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_29, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_30, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_31, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_32, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_33, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_34, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_35, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_36, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_37, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_38, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_39, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_40, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_41, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_42, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_43, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_44, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_45, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_46, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_47, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_48, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_49, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_50, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_51, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_52, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_53, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_54, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_55, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_56, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_57, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_58, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_59, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_60, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_61, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_62, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_63, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_64, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_65, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_66, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_67, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_68, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_69, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_70, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_71, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_72, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_73, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_74, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_75, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_76, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_77, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_78, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_79, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_80, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_81, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_82, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_83, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_84, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_85, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_86, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_87, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_88, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_89, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_90, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_91, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_92, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_93, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_94, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_95, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_96, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_97, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_98, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_99, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_99);
+
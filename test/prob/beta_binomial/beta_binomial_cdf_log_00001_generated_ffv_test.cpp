@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_100;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_102;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_103;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_105;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_106;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_111;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_112;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, double, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_153;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_154;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_156;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_157;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_159;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_160;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_100> AgradCdfLogBetaBinomial_ffv_100;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_101> AgradCdfLogBetaBinomial_ffv_101;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_102> AgradCdfLogBetaBinomial_ffv_102;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_103> AgradCdfLogBetaBinomial_ffv_103;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_104> AgradCdfLogBetaBinomial_ffv_104;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_105> AgradCdfLogBetaBinomial_ffv_105;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_106> AgradCdfLogBetaBinomial_ffv_106;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_107> AgradCdfLogBetaBinomial_ffv_107;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_108> AgradCdfLogBetaBinomial_ffv_108;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_109> AgradCdfLogBetaBinomial_ffv_109;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_110> AgradCdfLogBetaBinomial_ffv_110;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_111> AgradCdfLogBetaBinomial_ffv_111;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_112> AgradCdfLogBetaBinomial_ffv_112;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_113> AgradCdfLogBetaBinomial_ffv_113;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_114> AgradCdfLogBetaBinomial_ffv_114;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_115> AgradCdfLogBetaBinomial_ffv_115;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_116> AgradCdfLogBetaBinomial_ffv_116;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_117> AgradCdfLogBetaBinomial_ffv_117;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_118> AgradCdfLogBetaBinomial_ffv_118;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_119> AgradCdfLogBetaBinomial_ffv_119;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_120> AgradCdfLogBetaBinomial_ffv_120;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_121> AgradCdfLogBetaBinomial_ffv_121;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_122> AgradCdfLogBetaBinomial_ffv_122;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_123> AgradCdfLogBetaBinomial_ffv_123;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_124> AgradCdfLogBetaBinomial_ffv_124;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_125> AgradCdfLogBetaBinomial_ffv_125;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_126> AgradCdfLogBetaBinomial_ffv_126;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_127> AgradCdfLogBetaBinomial_ffv_127;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_128> AgradCdfLogBetaBinomial_ffv_128;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_129> AgradCdfLogBetaBinomial_ffv_129;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_130> AgradCdfLogBetaBinomial_ffv_130;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_131> AgradCdfLogBetaBinomial_ffv_131;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_132> AgradCdfLogBetaBinomial_ffv_132;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_133> AgradCdfLogBetaBinomial_ffv_133;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_134> AgradCdfLogBetaBinomial_ffv_134;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_135> AgradCdfLogBetaBinomial_ffv_135;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_136> AgradCdfLogBetaBinomial_ffv_136;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_137> AgradCdfLogBetaBinomial_ffv_137;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_138> AgradCdfLogBetaBinomial_ffv_138;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_139> AgradCdfLogBetaBinomial_ffv_139;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_140> AgradCdfLogBetaBinomial_ffv_140;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_141> AgradCdfLogBetaBinomial_ffv_141;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_142> AgradCdfLogBetaBinomial_ffv_142;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_143> AgradCdfLogBetaBinomial_ffv_143;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_144> AgradCdfLogBetaBinomial_ffv_144;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_145> AgradCdfLogBetaBinomial_ffv_145;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_146> AgradCdfLogBetaBinomial_ffv_146;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_147> AgradCdfLogBetaBinomial_ffv_147;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_148> AgradCdfLogBetaBinomial_ffv_148;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_149> AgradCdfLogBetaBinomial_ffv_149;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_150> AgradCdfLogBetaBinomial_ffv_150;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_151> AgradCdfLogBetaBinomial_ffv_151;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_152> AgradCdfLogBetaBinomial_ffv_152;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_153> AgradCdfLogBetaBinomial_ffv_153;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_154> AgradCdfLogBetaBinomial_ffv_154;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_155> AgradCdfLogBetaBinomial_ffv_155;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_156> AgradCdfLogBetaBinomial_ffv_156;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_157> AgradCdfLogBetaBinomial_ffv_157;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_158> AgradCdfLogBetaBinomial_ffv_158;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_159> AgradCdfLogBetaBinomial_ffv_159;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_160> AgradCdfLogBetaBinomial_ffv_160;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_161> AgradCdfLogBetaBinomial_ffv_161;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_162> AgradCdfLogBetaBinomial_ffv_162;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_163> AgradCdfLogBetaBinomial_ffv_163;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_164> AgradCdfLogBetaBinomial_ffv_164;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_165> AgradCdfLogBetaBinomial_ffv_165;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_166> AgradCdfLogBetaBinomial_ffv_166;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_167> AgradCdfLogBetaBinomial_ffv_167;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_168> AgradCdfLogBetaBinomial_ffv_168;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_169> AgradCdfLogBetaBinomial_ffv_169;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_170> AgradCdfLogBetaBinomial_ffv_170;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_171> AgradCdfLogBetaBinomial_ffv_171;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_172> AgradCdfLogBetaBinomial_ffv_172;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_173> AgradCdfLogBetaBinomial_ffv_173;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_174> AgradCdfLogBetaBinomial_ffv_174;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_175> AgradCdfLogBetaBinomial_ffv_175;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_176> AgradCdfLogBetaBinomial_ffv_176;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_177> AgradCdfLogBetaBinomial_ffv_177;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_178> AgradCdfLogBetaBinomial_ffv_178;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_179> AgradCdfLogBetaBinomial_ffv_179;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_180> AgradCdfLogBetaBinomial_ffv_180;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_181> AgradCdfLogBetaBinomial_ffv_181;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_182> AgradCdfLogBetaBinomial_ffv_182;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_183> AgradCdfLogBetaBinomial_ffv_183;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_184> AgradCdfLogBetaBinomial_ffv_184;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_185> AgradCdfLogBetaBinomial_ffv_185;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_186> AgradCdfLogBetaBinomial_ffv_186;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_187> AgradCdfLogBetaBinomial_ffv_187;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_188> AgradCdfLogBetaBinomial_ffv_188;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_189> AgradCdfLogBetaBinomial_ffv_189;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_190> AgradCdfLogBetaBinomial_ffv_190;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_191> AgradCdfLogBetaBinomial_ffv_191;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_192> AgradCdfLogBetaBinomial_ffv_192;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_193> AgradCdfLogBetaBinomial_ffv_193;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_194> AgradCdfLogBetaBinomial_ffv_194;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_195> AgradCdfLogBetaBinomial_ffv_195;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_196> AgradCdfLogBetaBinomial_ffv_196;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_197> AgradCdfLogBetaBinomial_ffv_197;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_198> AgradCdfLogBetaBinomial_ffv_198;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_199> AgradCdfLogBetaBinomial_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_100, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_101, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_102, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_103, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_104, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_105, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_106, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_107, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_108, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_109, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_110, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_111, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_112, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_113, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_114, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_115, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_116, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_117, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_118, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_119, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_120, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_121, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_122, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_123, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_124, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_125, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_126, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_127, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_128, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_129, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_130, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_131, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_132, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_133, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_134, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_135, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_136, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_137, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_138, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_139, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_140, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_141, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_142, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_143, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_144, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_145, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_146, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_147, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_148, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_149, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_150, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_151, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_152, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_153, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_154, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_155, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_156, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_157, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_158, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_159, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_160, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_161, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_162, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_163, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_164, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_165, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_166, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_167, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_168, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_169, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_170, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_171, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_172, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_173, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_174, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_175, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_176, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_177, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_178, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_179, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_180, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_181, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_182, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_183, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_184, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_185, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_186, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_187, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_188, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_189, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_190, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_191, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_192, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_193, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_194, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_195, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_196, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_197, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_198, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_199, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<std::vector<int>, int, double, double, empty, empty> type_v_108;
+typedef std::tuple<std::vector<int>, int, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<std::vector<int>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<std::vector<int>, int, double, var, empty, empty> type_v_111;
+typedef std::tuple<std::vector<int>, int, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<std::vector<int>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<std::vector<int>, int, var, double, empty, empty> type_v_126;
+typedef std::tuple<std::vector<int>, int, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<std::vector<int>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<std::vector<int>, int, var, var, empty, empty> type_v_129;
+typedef std::tuple<std::vector<int>, int, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<std::vector<int>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, double, empty, empty> type_v_144;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, var, empty, empty> type_v_147;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, double, empty, empty> type_v_162;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, var, empty, empty> type_v_165;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_100> AgradCdfLogBetaBinomial_v_100;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_101> AgradCdfLogBetaBinomial_v_101;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_102> AgradCdfLogBetaBinomial_v_102;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_103> AgradCdfLogBetaBinomial_v_103;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_104> AgradCdfLogBetaBinomial_v_104;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_105> AgradCdfLogBetaBinomial_v_105;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_106> AgradCdfLogBetaBinomial_v_106;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_107> AgradCdfLogBetaBinomial_v_107;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_108> AgradCdfLogBetaBinomial_v_108;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_109> AgradCdfLogBetaBinomial_v_109;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_110> AgradCdfLogBetaBinomial_v_110;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_111> AgradCdfLogBetaBinomial_v_111;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_112> AgradCdfLogBetaBinomial_v_112;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_113> AgradCdfLogBetaBinomial_v_113;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_114> AgradCdfLogBetaBinomial_v_114;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_115> AgradCdfLogBetaBinomial_v_115;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_116> AgradCdfLogBetaBinomial_v_116;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_117> AgradCdfLogBetaBinomial_v_117;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_118> AgradCdfLogBetaBinomial_v_118;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_119> AgradCdfLogBetaBinomial_v_119;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_120> AgradCdfLogBetaBinomial_v_120;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_121> AgradCdfLogBetaBinomial_v_121;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_122> AgradCdfLogBetaBinomial_v_122;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_123> AgradCdfLogBetaBinomial_v_123;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_124> AgradCdfLogBetaBinomial_v_124;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_125> AgradCdfLogBetaBinomial_v_125;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_126> AgradCdfLogBetaBinomial_v_126;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_127> AgradCdfLogBetaBinomial_v_127;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_128> AgradCdfLogBetaBinomial_v_128;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_129> AgradCdfLogBetaBinomial_v_129;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_130> AgradCdfLogBetaBinomial_v_130;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_131> AgradCdfLogBetaBinomial_v_131;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_132> AgradCdfLogBetaBinomial_v_132;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_133> AgradCdfLogBetaBinomial_v_133;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_134> AgradCdfLogBetaBinomial_v_134;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_135> AgradCdfLogBetaBinomial_v_135;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_136> AgradCdfLogBetaBinomial_v_136;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_137> AgradCdfLogBetaBinomial_v_137;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_138> AgradCdfLogBetaBinomial_v_138;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_139> AgradCdfLogBetaBinomial_v_139;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_140> AgradCdfLogBetaBinomial_v_140;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_141> AgradCdfLogBetaBinomial_v_141;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_142> AgradCdfLogBetaBinomial_v_142;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_143> AgradCdfLogBetaBinomial_v_143;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_144> AgradCdfLogBetaBinomial_v_144;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_145> AgradCdfLogBetaBinomial_v_145;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_146> AgradCdfLogBetaBinomial_v_146;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_147> AgradCdfLogBetaBinomial_v_147;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_148> AgradCdfLogBetaBinomial_v_148;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_149> AgradCdfLogBetaBinomial_v_149;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_150> AgradCdfLogBetaBinomial_v_150;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_151> AgradCdfLogBetaBinomial_v_151;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_152> AgradCdfLogBetaBinomial_v_152;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_153> AgradCdfLogBetaBinomial_v_153;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_154> AgradCdfLogBetaBinomial_v_154;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_155> AgradCdfLogBetaBinomial_v_155;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_156> AgradCdfLogBetaBinomial_v_156;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_157> AgradCdfLogBetaBinomial_v_157;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_158> AgradCdfLogBetaBinomial_v_158;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_159> AgradCdfLogBetaBinomial_v_159;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_160> AgradCdfLogBetaBinomial_v_160;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_161> AgradCdfLogBetaBinomial_v_161;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_162> AgradCdfLogBetaBinomial_v_162;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_163> AgradCdfLogBetaBinomial_v_163;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_164> AgradCdfLogBetaBinomial_v_164;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_165> AgradCdfLogBetaBinomial_v_165;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_166> AgradCdfLogBetaBinomial_v_166;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_167> AgradCdfLogBetaBinomial_v_167;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_168> AgradCdfLogBetaBinomial_v_168;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_169> AgradCdfLogBetaBinomial_v_169;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_170> AgradCdfLogBetaBinomial_v_170;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_171> AgradCdfLogBetaBinomial_v_171;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_172> AgradCdfLogBetaBinomial_v_172;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_173> AgradCdfLogBetaBinomial_v_173;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_174> AgradCdfLogBetaBinomial_v_174;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_175> AgradCdfLogBetaBinomial_v_175;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_176> AgradCdfLogBetaBinomial_v_176;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_177> AgradCdfLogBetaBinomial_v_177;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_178> AgradCdfLogBetaBinomial_v_178;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_179> AgradCdfLogBetaBinomial_v_179;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_180> AgradCdfLogBetaBinomial_v_180;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_181> AgradCdfLogBetaBinomial_v_181;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_182> AgradCdfLogBetaBinomial_v_182;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_183> AgradCdfLogBetaBinomial_v_183;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_184> AgradCdfLogBetaBinomial_v_184;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_185> AgradCdfLogBetaBinomial_v_185;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_186> AgradCdfLogBetaBinomial_v_186;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_187> AgradCdfLogBetaBinomial_v_187;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_188> AgradCdfLogBetaBinomial_v_188;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_189> AgradCdfLogBetaBinomial_v_189;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_190> AgradCdfLogBetaBinomial_v_190;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_191> AgradCdfLogBetaBinomial_v_191;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_192> AgradCdfLogBetaBinomial_v_192;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_193> AgradCdfLogBetaBinomial_v_193;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_194> AgradCdfLogBetaBinomial_v_194;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_195> AgradCdfLogBetaBinomial_v_195;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_196> AgradCdfLogBetaBinomial_v_196;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_197> AgradCdfLogBetaBinomial_v_197;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_198> AgradCdfLogBetaBinomial_v_198;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_199> AgradCdfLogBetaBinomial_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_100, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_101, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_102, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_103, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_104, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_105, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_106, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_107, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_108, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_109, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_110, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_111, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_112, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_113, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_114, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_115, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_116, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_117, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_118, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_119, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_120, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_121, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_122, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_123, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_124, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_125, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_126, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_127, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_128, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_129, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_130, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_131, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_132, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_133, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_134, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_135, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_136, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_137, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_138, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_139, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_140, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_141, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_142, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_143, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_144, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_145, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_146, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_147, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_148, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_149, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_150, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_151, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_152, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_153, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_154, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_155, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_156, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_157, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_158, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_159, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_160, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_161, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_162, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_163, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_164, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_165, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_166, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_167, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_168, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_169, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_170, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_171, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_172, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_173, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_174, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_175, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_176, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_177, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_178, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_179, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_180, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_181, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_182, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_183, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_184, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_185, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_186, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_187, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_188, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_189, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_190, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_191, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_192, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_193, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_194, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_195, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_196, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_197, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_198, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_199, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_199);
+
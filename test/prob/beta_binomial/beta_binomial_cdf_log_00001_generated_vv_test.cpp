@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, int, std::vector<var>, std::vector<var>, empty, empty> type_vv_100;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_101;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_102;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_103;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_104;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_105;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_106;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_107;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, var, empty, empty> type_vv_108;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, var, empty, empty> type_vv_111;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_vv_112;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_113;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_114;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, double, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, var, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, double, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, var, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_152;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_153;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_154;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_155;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_156;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_157;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_158;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_159;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_160;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_161;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, var, empty, empty> type_vv_162;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty, empty> type_vv_165;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty, empty> type_vv_166;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_167;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, double, empty, empty> type_vv_171;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, var, empty, empty> type_vv_174;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty, empty> type_vv_189;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty, empty> type_vv_198;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_100> AgradCdfLogBetaBinomial_vv_100;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_101> AgradCdfLogBetaBinomial_vv_101;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_102> AgradCdfLogBetaBinomial_vv_102;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_103> AgradCdfLogBetaBinomial_vv_103;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_104> AgradCdfLogBetaBinomial_vv_104;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_105> AgradCdfLogBetaBinomial_vv_105;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_106> AgradCdfLogBetaBinomial_vv_106;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_107> AgradCdfLogBetaBinomial_vv_107;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_108> AgradCdfLogBetaBinomial_vv_108;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_109> AgradCdfLogBetaBinomial_vv_109;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_110> AgradCdfLogBetaBinomial_vv_110;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_111> AgradCdfLogBetaBinomial_vv_111;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_112> AgradCdfLogBetaBinomial_vv_112;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_113> AgradCdfLogBetaBinomial_vv_113;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_114> AgradCdfLogBetaBinomial_vv_114;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_115> AgradCdfLogBetaBinomial_vv_115;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_116> AgradCdfLogBetaBinomial_vv_116;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_117> AgradCdfLogBetaBinomial_vv_117;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_118> AgradCdfLogBetaBinomial_vv_118;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_119> AgradCdfLogBetaBinomial_vv_119;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_120> AgradCdfLogBetaBinomial_vv_120;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_121> AgradCdfLogBetaBinomial_vv_121;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_122> AgradCdfLogBetaBinomial_vv_122;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_123> AgradCdfLogBetaBinomial_vv_123;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_124> AgradCdfLogBetaBinomial_vv_124;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_125> AgradCdfLogBetaBinomial_vv_125;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_126> AgradCdfLogBetaBinomial_vv_126;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_127> AgradCdfLogBetaBinomial_vv_127;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_128> AgradCdfLogBetaBinomial_vv_128;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_129> AgradCdfLogBetaBinomial_vv_129;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_130> AgradCdfLogBetaBinomial_vv_130;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_131> AgradCdfLogBetaBinomial_vv_131;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_132> AgradCdfLogBetaBinomial_vv_132;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_133> AgradCdfLogBetaBinomial_vv_133;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_134> AgradCdfLogBetaBinomial_vv_134;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_135> AgradCdfLogBetaBinomial_vv_135;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_136> AgradCdfLogBetaBinomial_vv_136;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_137> AgradCdfLogBetaBinomial_vv_137;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_138> AgradCdfLogBetaBinomial_vv_138;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_139> AgradCdfLogBetaBinomial_vv_139;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_140> AgradCdfLogBetaBinomial_vv_140;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_141> AgradCdfLogBetaBinomial_vv_141;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_142> AgradCdfLogBetaBinomial_vv_142;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_143> AgradCdfLogBetaBinomial_vv_143;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_144> AgradCdfLogBetaBinomial_vv_144;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_145> AgradCdfLogBetaBinomial_vv_145;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_146> AgradCdfLogBetaBinomial_vv_146;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_147> AgradCdfLogBetaBinomial_vv_147;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_148> AgradCdfLogBetaBinomial_vv_148;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_149> AgradCdfLogBetaBinomial_vv_149;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_150> AgradCdfLogBetaBinomial_vv_150;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_151> AgradCdfLogBetaBinomial_vv_151;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_152> AgradCdfLogBetaBinomial_vv_152;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_153> AgradCdfLogBetaBinomial_vv_153;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_154> AgradCdfLogBetaBinomial_vv_154;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_155> AgradCdfLogBetaBinomial_vv_155;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_156> AgradCdfLogBetaBinomial_vv_156;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_157> AgradCdfLogBetaBinomial_vv_157;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_158> AgradCdfLogBetaBinomial_vv_158;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_159> AgradCdfLogBetaBinomial_vv_159;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_160> AgradCdfLogBetaBinomial_vv_160;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_161> AgradCdfLogBetaBinomial_vv_161;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_162> AgradCdfLogBetaBinomial_vv_162;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_163> AgradCdfLogBetaBinomial_vv_163;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_164> AgradCdfLogBetaBinomial_vv_164;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_165> AgradCdfLogBetaBinomial_vv_165;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_166> AgradCdfLogBetaBinomial_vv_166;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_167> AgradCdfLogBetaBinomial_vv_167;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_168> AgradCdfLogBetaBinomial_vv_168;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_169> AgradCdfLogBetaBinomial_vv_169;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_170> AgradCdfLogBetaBinomial_vv_170;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_171> AgradCdfLogBetaBinomial_vv_171;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_172> AgradCdfLogBetaBinomial_vv_172;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_173> AgradCdfLogBetaBinomial_vv_173;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_174> AgradCdfLogBetaBinomial_vv_174;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_175> AgradCdfLogBetaBinomial_vv_175;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_176> AgradCdfLogBetaBinomial_vv_176;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_177> AgradCdfLogBetaBinomial_vv_177;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_178> AgradCdfLogBetaBinomial_vv_178;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_179> AgradCdfLogBetaBinomial_vv_179;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_180> AgradCdfLogBetaBinomial_vv_180;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_181> AgradCdfLogBetaBinomial_vv_181;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_182> AgradCdfLogBetaBinomial_vv_182;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_183> AgradCdfLogBetaBinomial_vv_183;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_184> AgradCdfLogBetaBinomial_vv_184;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_185> AgradCdfLogBetaBinomial_vv_185;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_186> AgradCdfLogBetaBinomial_vv_186;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_187> AgradCdfLogBetaBinomial_vv_187;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_188> AgradCdfLogBetaBinomial_vv_188;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_189> AgradCdfLogBetaBinomial_vv_189;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_190> AgradCdfLogBetaBinomial_vv_190;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_191> AgradCdfLogBetaBinomial_vv_191;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_192> AgradCdfLogBetaBinomial_vv_192;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_193> AgradCdfLogBetaBinomial_vv_193;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_194> AgradCdfLogBetaBinomial_vv_194;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_195> AgradCdfLogBetaBinomial_vv_195;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_196> AgradCdfLogBetaBinomial_vv_196;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_197> AgradCdfLogBetaBinomial_vv_197;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_198> AgradCdfLogBetaBinomial_vv_198;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_199> AgradCdfLogBetaBinomial_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_100, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_101, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_102, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_103, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_104, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_105, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_106, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_107, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_108, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_109, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_110, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_111, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_112, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_113, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_114, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_115, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_116, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_117, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_118, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_119, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_120, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_121, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_122, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_123, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_124, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_125, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_126, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_127, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_128, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_129, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_130, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_131, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_132, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_133, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_134, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_135, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_136, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_137, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_138, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_139, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_140, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_141, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_142, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_143, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_144, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_145, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_146, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_147, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_148, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_149, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_150, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_151, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_152, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_153, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_154, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_155, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_156, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_157, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_158, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_159, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_160, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_161, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_162, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_163, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_164, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_165, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_166, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_167, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_168, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_169, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_170, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_171, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_172, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_173, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_174, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_175, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_176, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_177, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_178, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_179, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_180, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_181, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_182, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_183, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_184, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_185, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_186, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_187, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_188, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_189, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_190, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_191, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_192, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_193, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_194, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_195, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_196, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_197, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_198, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_199, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_199);
+
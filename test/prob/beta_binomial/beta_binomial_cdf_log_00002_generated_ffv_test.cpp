@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_200> AgradCdfLogBetaBinomial_ffv_200;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_201> AgradCdfLogBetaBinomial_ffv_201;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_202> AgradCdfLogBetaBinomial_ffv_202;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_203> AgradCdfLogBetaBinomial_ffv_203;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_204> AgradCdfLogBetaBinomial_ffv_204;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_205> AgradCdfLogBetaBinomial_ffv_205;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_206> AgradCdfLogBetaBinomial_ffv_206;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_207> AgradCdfLogBetaBinomial_ffv_207;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_208> AgradCdfLogBetaBinomial_ffv_208;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_209> AgradCdfLogBetaBinomial_ffv_209;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_210> AgradCdfLogBetaBinomial_ffv_210;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_211> AgradCdfLogBetaBinomial_ffv_211;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_212> AgradCdfLogBetaBinomial_ffv_212;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_213> AgradCdfLogBetaBinomial_ffv_213;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_214> AgradCdfLogBetaBinomial_ffv_214;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_215> AgradCdfLogBetaBinomial_ffv_215;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_216> AgradCdfLogBetaBinomial_ffv_216;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_217> AgradCdfLogBetaBinomial_ffv_217;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_218> AgradCdfLogBetaBinomial_ffv_218;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_219> AgradCdfLogBetaBinomial_ffv_219;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_220> AgradCdfLogBetaBinomial_ffv_220;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_221> AgradCdfLogBetaBinomial_ffv_221;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_222> AgradCdfLogBetaBinomial_ffv_222;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_223> AgradCdfLogBetaBinomial_ffv_223;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_224> AgradCdfLogBetaBinomial_ffv_224;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_225> AgradCdfLogBetaBinomial_ffv_225;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_226> AgradCdfLogBetaBinomial_ffv_226;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_227> AgradCdfLogBetaBinomial_ffv_227;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_228> AgradCdfLogBetaBinomial_ffv_228;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_229> AgradCdfLogBetaBinomial_ffv_229;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_230> AgradCdfLogBetaBinomial_ffv_230;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_231> AgradCdfLogBetaBinomial_ffv_231;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_232> AgradCdfLogBetaBinomial_ffv_232;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_233> AgradCdfLogBetaBinomial_ffv_233;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_234> AgradCdfLogBetaBinomial_ffv_234;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_235> AgradCdfLogBetaBinomial_ffv_235;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_236> AgradCdfLogBetaBinomial_ffv_236;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_237> AgradCdfLogBetaBinomial_ffv_237;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_238> AgradCdfLogBetaBinomial_ffv_238;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_239> AgradCdfLogBetaBinomial_ffv_239;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_240> AgradCdfLogBetaBinomial_ffv_240;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_241> AgradCdfLogBetaBinomial_ffv_241;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_ffv_242> AgradCdfLogBetaBinomial_ffv_242;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_200, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_201, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_202, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_203, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_204, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_205, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_206, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_207, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_208, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_209, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_210, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_211, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_212, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_213, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_214, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_215, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_216, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_217, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_218, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_219, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_220, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_221, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_222, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_223, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_224, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_225, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_226, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_227, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_228, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_229, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_230, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_231, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_232, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_233, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_234, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_235, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_236, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_237, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_238, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_239, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_240, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_241, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_ffv_242, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_ffv_242);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, double, empty, empty> type_v_216;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, var, empty, empty> type_v_219;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, double, empty, empty> type_v_234;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, var, empty, empty> type_v_237;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty, empty> type_v_252;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty, empty> type_v_255;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty, empty> type_v_270;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty, empty> type_v_273;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_200> AgradCdfLogBetaBinomial_v_200;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_201> AgradCdfLogBetaBinomial_v_201;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_202> AgradCdfLogBetaBinomial_v_202;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_203> AgradCdfLogBetaBinomial_v_203;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_204> AgradCdfLogBetaBinomial_v_204;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_205> AgradCdfLogBetaBinomial_v_205;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_206> AgradCdfLogBetaBinomial_v_206;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_207> AgradCdfLogBetaBinomial_v_207;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_208> AgradCdfLogBetaBinomial_v_208;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_209> AgradCdfLogBetaBinomial_v_209;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_210> AgradCdfLogBetaBinomial_v_210;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_211> AgradCdfLogBetaBinomial_v_211;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_212> AgradCdfLogBetaBinomial_v_212;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_213> AgradCdfLogBetaBinomial_v_213;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_214> AgradCdfLogBetaBinomial_v_214;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_215> AgradCdfLogBetaBinomial_v_215;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_216> AgradCdfLogBetaBinomial_v_216;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_217> AgradCdfLogBetaBinomial_v_217;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_218> AgradCdfLogBetaBinomial_v_218;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_219> AgradCdfLogBetaBinomial_v_219;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_220> AgradCdfLogBetaBinomial_v_220;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_221> AgradCdfLogBetaBinomial_v_221;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_222> AgradCdfLogBetaBinomial_v_222;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_223> AgradCdfLogBetaBinomial_v_223;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_224> AgradCdfLogBetaBinomial_v_224;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_225> AgradCdfLogBetaBinomial_v_225;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_226> AgradCdfLogBetaBinomial_v_226;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_227> AgradCdfLogBetaBinomial_v_227;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_228> AgradCdfLogBetaBinomial_v_228;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_229> AgradCdfLogBetaBinomial_v_229;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_230> AgradCdfLogBetaBinomial_v_230;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_231> AgradCdfLogBetaBinomial_v_231;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_232> AgradCdfLogBetaBinomial_v_232;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_233> AgradCdfLogBetaBinomial_v_233;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_234> AgradCdfLogBetaBinomial_v_234;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_235> AgradCdfLogBetaBinomial_v_235;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_236> AgradCdfLogBetaBinomial_v_236;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_237> AgradCdfLogBetaBinomial_v_237;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_238> AgradCdfLogBetaBinomial_v_238;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_239> AgradCdfLogBetaBinomial_v_239;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_240> AgradCdfLogBetaBinomial_v_240;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_241> AgradCdfLogBetaBinomial_v_241;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_242> AgradCdfLogBetaBinomial_v_242;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_243> AgradCdfLogBetaBinomial_v_243;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_244> AgradCdfLogBetaBinomial_v_244;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_245> AgradCdfLogBetaBinomial_v_245;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_246> AgradCdfLogBetaBinomial_v_246;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_247> AgradCdfLogBetaBinomial_v_247;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_248> AgradCdfLogBetaBinomial_v_248;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_249> AgradCdfLogBetaBinomial_v_249;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_250> AgradCdfLogBetaBinomial_v_250;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_251> AgradCdfLogBetaBinomial_v_251;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_252> AgradCdfLogBetaBinomial_v_252;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_253> AgradCdfLogBetaBinomial_v_253;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_254> AgradCdfLogBetaBinomial_v_254;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_255> AgradCdfLogBetaBinomial_v_255;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_256> AgradCdfLogBetaBinomial_v_256;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_257> AgradCdfLogBetaBinomial_v_257;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_258> AgradCdfLogBetaBinomial_v_258;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_259> AgradCdfLogBetaBinomial_v_259;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_260> AgradCdfLogBetaBinomial_v_260;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_261> AgradCdfLogBetaBinomial_v_261;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_262> AgradCdfLogBetaBinomial_v_262;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_263> AgradCdfLogBetaBinomial_v_263;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_264> AgradCdfLogBetaBinomial_v_264;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_265> AgradCdfLogBetaBinomial_v_265;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_266> AgradCdfLogBetaBinomial_v_266;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_267> AgradCdfLogBetaBinomial_v_267;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_268> AgradCdfLogBetaBinomial_v_268;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_269> AgradCdfLogBetaBinomial_v_269;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_270> AgradCdfLogBetaBinomial_v_270;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_271> AgradCdfLogBetaBinomial_v_271;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_272> AgradCdfLogBetaBinomial_v_272;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_273> AgradCdfLogBetaBinomial_v_273;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_274> AgradCdfLogBetaBinomial_v_274;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_275> AgradCdfLogBetaBinomial_v_275;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_276> AgradCdfLogBetaBinomial_v_276;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_277> AgradCdfLogBetaBinomial_v_277;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_278> AgradCdfLogBetaBinomial_v_278;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_279> AgradCdfLogBetaBinomial_v_279;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_280> AgradCdfLogBetaBinomial_v_280;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_281> AgradCdfLogBetaBinomial_v_281;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_282> AgradCdfLogBetaBinomial_v_282;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_283> AgradCdfLogBetaBinomial_v_283;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_284> AgradCdfLogBetaBinomial_v_284;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_285> AgradCdfLogBetaBinomial_v_285;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_286> AgradCdfLogBetaBinomial_v_286;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_287> AgradCdfLogBetaBinomial_v_287;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_288> AgradCdfLogBetaBinomial_v_288;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_289> AgradCdfLogBetaBinomial_v_289;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_290> AgradCdfLogBetaBinomial_v_290;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_291> AgradCdfLogBetaBinomial_v_291;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_292> AgradCdfLogBetaBinomial_v_292;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_293> AgradCdfLogBetaBinomial_v_293;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_294> AgradCdfLogBetaBinomial_v_294;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_295> AgradCdfLogBetaBinomial_v_295;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_296> AgradCdfLogBetaBinomial_v_296;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_297> AgradCdfLogBetaBinomial_v_297;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_298> AgradCdfLogBetaBinomial_v_298;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_299> AgradCdfLogBetaBinomial_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_200, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_201, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_202, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_203, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_204, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_205, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_206, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_207, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_208, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_209, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_210, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_211, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_212, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_213, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_214, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_215, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_216, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_217, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_218, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_219, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_220, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_221, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_222, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_223, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_224, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_225, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_226, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_227, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_228, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_229, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_230, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_231, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_232, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_233, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_234, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_235, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_236, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_237, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_238, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_239, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_240, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_241, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_242, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_243, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_244, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_245, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_246, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_247, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_248, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_249, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_250, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_251, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_252, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_253, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_254, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_255, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_256, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_257, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_258, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_259, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_260, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_261, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_262, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_263, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_264, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_265, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_266, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_267, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_268, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_269, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_270, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_271, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_272, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_273, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_274, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_275, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_276, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_277, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_278, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_279, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_280, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_281, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_282, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_283, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_284, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_285, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_286, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_287, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_288, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_289, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_290, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_291, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_292, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_293, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_294, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_295, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_296, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_297, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_298, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_299, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_299);
+
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty, empty> type_vv_201;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_200> AgradCdfLogBetaBinomial_vv_200;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_201> AgradCdfLogBetaBinomial_vv_201;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_202> AgradCdfLogBetaBinomial_vv_202;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_203> AgradCdfLogBetaBinomial_vv_203;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_204> AgradCdfLogBetaBinomial_vv_204;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_205> AgradCdfLogBetaBinomial_vv_205;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_206> AgradCdfLogBetaBinomial_vv_206;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_207> AgradCdfLogBetaBinomial_vv_207;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_208> AgradCdfLogBetaBinomial_vv_208;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_209> AgradCdfLogBetaBinomial_vv_209;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_210> AgradCdfLogBetaBinomial_vv_210;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_211> AgradCdfLogBetaBinomial_vv_211;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_212> AgradCdfLogBetaBinomial_vv_212;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_213> AgradCdfLogBetaBinomial_vv_213;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_214> AgradCdfLogBetaBinomial_vv_214;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_215> AgradCdfLogBetaBinomial_vv_215;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_216> AgradCdfLogBetaBinomial_vv_216;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_217> AgradCdfLogBetaBinomial_vv_217;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_218> AgradCdfLogBetaBinomial_vv_218;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_219> AgradCdfLogBetaBinomial_vv_219;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_220> AgradCdfLogBetaBinomial_vv_220;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_221> AgradCdfLogBetaBinomial_vv_221;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_222> AgradCdfLogBetaBinomial_vv_222;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_223> AgradCdfLogBetaBinomial_vv_223;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_224> AgradCdfLogBetaBinomial_vv_224;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_225> AgradCdfLogBetaBinomial_vv_225;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_226> AgradCdfLogBetaBinomial_vv_226;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_227> AgradCdfLogBetaBinomial_vv_227;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_228> AgradCdfLogBetaBinomial_vv_228;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_229> AgradCdfLogBetaBinomial_vv_229;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_230> AgradCdfLogBetaBinomial_vv_230;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_231> AgradCdfLogBetaBinomial_vv_231;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_232> AgradCdfLogBetaBinomial_vv_232;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_233> AgradCdfLogBetaBinomial_vv_233;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_234> AgradCdfLogBetaBinomial_vv_234;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_235> AgradCdfLogBetaBinomial_vv_235;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_236> AgradCdfLogBetaBinomial_vv_236;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_237> AgradCdfLogBetaBinomial_vv_237;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_238> AgradCdfLogBetaBinomial_vv_238;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_239> AgradCdfLogBetaBinomial_vv_239;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_240> AgradCdfLogBetaBinomial_vv_240;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_241> AgradCdfLogBetaBinomial_vv_241;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_vv_242> AgradCdfLogBetaBinomial_vv_242;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_200, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_201, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_202, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_203, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_204, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_205, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_206, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_207, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_208, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_209, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_210, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_211, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_212, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_213, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_214, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_215, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_216, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_217, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_218, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_219, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_220, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_221, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_222, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_223, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_224, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_225, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_226, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_227, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_228, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_229, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_230, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_231, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_232, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_233, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_234, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_235, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_236, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_237, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_238, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_239, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_240, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_241, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_vv_242, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_vv_242);
+
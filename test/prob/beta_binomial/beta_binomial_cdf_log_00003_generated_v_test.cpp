@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_binomial/beta_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_300> AgradCdfLogBetaBinomial_v_300;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_301> AgradCdfLogBetaBinomial_v_301;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_302> AgradCdfLogBetaBinomial_v_302;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_303> AgradCdfLogBetaBinomial_v_303;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_304> AgradCdfLogBetaBinomial_v_304;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_305> AgradCdfLogBetaBinomial_v_305;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_306> AgradCdfLogBetaBinomial_v_306;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_307> AgradCdfLogBetaBinomial_v_307;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_308> AgradCdfLogBetaBinomial_v_308;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_309> AgradCdfLogBetaBinomial_v_309;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_310> AgradCdfLogBetaBinomial_v_310;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_311> AgradCdfLogBetaBinomial_v_311;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_312> AgradCdfLogBetaBinomial_v_312;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_313> AgradCdfLogBetaBinomial_v_313;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_314> AgradCdfLogBetaBinomial_v_314;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_315> AgradCdfLogBetaBinomial_v_315;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_316> AgradCdfLogBetaBinomial_v_316;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_317> AgradCdfLogBetaBinomial_v_317;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_318> AgradCdfLogBetaBinomial_v_318;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_319> AgradCdfLogBetaBinomial_v_319;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_320> AgradCdfLogBetaBinomial_v_320;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_321> AgradCdfLogBetaBinomial_v_321;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_322> AgradCdfLogBetaBinomial_v_322;
+typedef std::tuple<AgradCdfLogBetaBinomial, type_v_323> AgradCdfLogBetaBinomial_v_323;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_300, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_301, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_302, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_303, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_304, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_305, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_306, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_307, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_308, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_309, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_310, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_311, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_312, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_313, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_314, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_315, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_316, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_317, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_318, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_319, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_320, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_321, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_322, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaBinomial_v_323, AgradCdfLogTestFixture, AgradCdfLogBetaBinomial_v_323);
+
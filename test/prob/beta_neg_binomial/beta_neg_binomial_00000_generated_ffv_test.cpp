@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<int, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<int, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<int, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<int, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<int, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<int, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<int, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<int, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<int, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<int, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<int, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<int, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<int, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<int, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<int, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<int, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<int, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<int, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<int, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<int, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<int, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_0> AgradDistributionsBetaNegBinomial_ffv_0;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_1> AgradDistributionsBetaNegBinomial_ffv_1;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_2> AgradDistributionsBetaNegBinomial_ffv_2;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_3> AgradDistributionsBetaNegBinomial_ffv_3;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_4> AgradDistributionsBetaNegBinomial_ffv_4;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_5> AgradDistributionsBetaNegBinomial_ffv_5;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_6> AgradDistributionsBetaNegBinomial_ffv_6;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_7> AgradDistributionsBetaNegBinomial_ffv_7;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_8> AgradDistributionsBetaNegBinomial_ffv_8;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_9> AgradDistributionsBetaNegBinomial_ffv_9;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_10> AgradDistributionsBetaNegBinomial_ffv_10;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_11> AgradDistributionsBetaNegBinomial_ffv_11;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_12> AgradDistributionsBetaNegBinomial_ffv_12;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_13> AgradDistributionsBetaNegBinomial_ffv_13;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_14> AgradDistributionsBetaNegBinomial_ffv_14;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_15> AgradDistributionsBetaNegBinomial_ffv_15;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_16> AgradDistributionsBetaNegBinomial_ffv_16;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_17> AgradDistributionsBetaNegBinomial_ffv_17;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_18> AgradDistributionsBetaNegBinomial_ffv_18;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_19> AgradDistributionsBetaNegBinomial_ffv_19;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_20> AgradDistributionsBetaNegBinomial_ffv_20;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_21> AgradDistributionsBetaNegBinomial_ffv_21;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_22> AgradDistributionsBetaNegBinomial_ffv_22;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_23> AgradDistributionsBetaNegBinomial_ffv_23;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_24> AgradDistributionsBetaNegBinomial_ffv_24;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_25> AgradDistributionsBetaNegBinomial_ffv_25;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_26> AgradDistributionsBetaNegBinomial_ffv_26;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_27> AgradDistributionsBetaNegBinomial_ffv_27;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_28> AgradDistributionsBetaNegBinomial_ffv_28;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_29> AgradDistributionsBetaNegBinomial_ffv_29;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_30> AgradDistributionsBetaNegBinomial_ffv_30;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_31> AgradDistributionsBetaNegBinomial_ffv_31;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_32> AgradDistributionsBetaNegBinomial_ffv_32;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_33> AgradDistributionsBetaNegBinomial_ffv_33;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_34> AgradDistributionsBetaNegBinomial_ffv_34;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_35> AgradDistributionsBetaNegBinomial_ffv_35;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_36> AgradDistributionsBetaNegBinomial_ffv_36;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_37> AgradDistributionsBetaNegBinomial_ffv_37;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_38> AgradDistributionsBetaNegBinomial_ffv_38;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_39> AgradDistributionsBetaNegBinomial_ffv_39;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_40> AgradDistributionsBetaNegBinomial_ffv_40;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_41> AgradDistributionsBetaNegBinomial_ffv_41;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_42> AgradDistributionsBetaNegBinomial_ffv_42;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_43> AgradDistributionsBetaNegBinomial_ffv_43;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_44> AgradDistributionsBetaNegBinomial_ffv_44;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_45> AgradDistributionsBetaNegBinomial_ffv_45;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_46> AgradDistributionsBetaNegBinomial_ffv_46;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_47> AgradDistributionsBetaNegBinomial_ffv_47;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_48> AgradDistributionsBetaNegBinomial_ffv_48;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_49> AgradDistributionsBetaNegBinomial_ffv_49;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_50> AgradDistributionsBetaNegBinomial_ffv_50;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_51> AgradDistributionsBetaNegBinomial_ffv_51;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_52> AgradDistributionsBetaNegBinomial_ffv_52;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_53> AgradDistributionsBetaNegBinomial_ffv_53;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_54> AgradDistributionsBetaNegBinomial_ffv_54;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_55> AgradDistributionsBetaNegBinomial_ffv_55;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_56> AgradDistributionsBetaNegBinomial_ffv_56;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_57> AgradDistributionsBetaNegBinomial_ffv_57;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_58> AgradDistributionsBetaNegBinomial_ffv_58;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_59> AgradDistributionsBetaNegBinomial_ffv_59;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_60> AgradDistributionsBetaNegBinomial_ffv_60;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_61> AgradDistributionsBetaNegBinomial_ffv_61;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_62> AgradDistributionsBetaNegBinomial_ffv_62;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_63> AgradDistributionsBetaNegBinomial_ffv_63;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_64> AgradDistributionsBetaNegBinomial_ffv_64;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_65> AgradDistributionsBetaNegBinomial_ffv_65;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_66> AgradDistributionsBetaNegBinomial_ffv_66;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_67> AgradDistributionsBetaNegBinomial_ffv_67;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_68> AgradDistributionsBetaNegBinomial_ffv_68;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_69> AgradDistributionsBetaNegBinomial_ffv_69;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_70> AgradDistributionsBetaNegBinomial_ffv_70;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_71> AgradDistributionsBetaNegBinomial_ffv_71;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_72> AgradDistributionsBetaNegBinomial_ffv_72;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_73> AgradDistributionsBetaNegBinomial_ffv_73;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_74> AgradDistributionsBetaNegBinomial_ffv_74;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_75> AgradDistributionsBetaNegBinomial_ffv_75;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_76> AgradDistributionsBetaNegBinomial_ffv_76;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_77> AgradDistributionsBetaNegBinomial_ffv_77;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_78> AgradDistributionsBetaNegBinomial_ffv_78;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_79> AgradDistributionsBetaNegBinomial_ffv_79;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_80> AgradDistributionsBetaNegBinomial_ffv_80;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_81> AgradDistributionsBetaNegBinomial_ffv_81;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_82> AgradDistributionsBetaNegBinomial_ffv_82;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_83> AgradDistributionsBetaNegBinomial_ffv_83;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_84> AgradDistributionsBetaNegBinomial_ffv_84;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_85> AgradDistributionsBetaNegBinomial_ffv_85;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_86> AgradDistributionsBetaNegBinomial_ffv_86;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_87> AgradDistributionsBetaNegBinomial_ffv_87;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_88> AgradDistributionsBetaNegBinomial_ffv_88;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_89> AgradDistributionsBetaNegBinomial_ffv_89;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_90> AgradDistributionsBetaNegBinomial_ffv_90;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_91> AgradDistributionsBetaNegBinomial_ffv_91;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_92> AgradDistributionsBetaNegBinomial_ffv_92;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_93> AgradDistributionsBetaNegBinomial_ffv_93;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_94> AgradDistributionsBetaNegBinomial_ffv_94;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_95> AgradDistributionsBetaNegBinomial_ffv_95;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_96> AgradDistributionsBetaNegBinomial_ffv_96;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_97> AgradDistributionsBetaNegBinomial_ffv_97;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_98> AgradDistributionsBetaNegBinomial_ffv_98;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_99> AgradDistributionsBetaNegBinomial_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_0, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_1, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_2, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_3, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_4, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_5, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_6, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_7, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_8, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_9, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_10, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_11, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_12, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_13, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_14, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_15, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_16, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_17, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_18, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_19, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_20, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_21, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_22, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_23, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_24, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_25, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_26, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_27, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_28, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_29, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_30, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_31, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_32, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_33, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_34, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_35, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_36, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_37, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_38, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_39, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_40, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_41, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_42, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_43, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_44, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_45, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_46, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_47, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_48, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_49, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_50, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_51, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_52, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_53, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_54, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_55, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_56, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_57, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_58, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_59, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_60, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_61, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_62, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_63, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_64, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_65, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_66, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_67, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_68, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_69, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_70, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_71, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_72, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_73, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_74, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_75, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_76, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_77, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_78, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_79, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_80, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_81, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_82, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_83, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_84, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_85, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_86, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_87, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_88, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_89, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_90, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_91, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_92, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_93, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_94, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_95, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_96, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_97, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_98, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_99, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<int, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<int, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<int, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<int, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<int, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<int, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<int, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<int, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<int, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<int, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<int, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<int, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<int, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<int, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<int, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<int, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<int, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<int, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<int, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<int, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<int, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<int, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<int, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<int, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<int, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<int, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<int, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<int, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<int, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<int, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<int, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<int, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<int, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<int, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<int, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<int, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_0> AgradDistributionsBetaNegBinomial_v_0;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_1> AgradDistributionsBetaNegBinomial_v_1;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_2> AgradDistributionsBetaNegBinomial_v_2;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_3> AgradDistributionsBetaNegBinomial_v_3;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_4> AgradDistributionsBetaNegBinomial_v_4;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_5> AgradDistributionsBetaNegBinomial_v_5;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_6> AgradDistributionsBetaNegBinomial_v_6;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_7> AgradDistributionsBetaNegBinomial_v_7;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_8> AgradDistributionsBetaNegBinomial_v_8;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_9> AgradDistributionsBetaNegBinomial_v_9;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_10> AgradDistributionsBetaNegBinomial_v_10;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_11> AgradDistributionsBetaNegBinomial_v_11;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_12> AgradDistributionsBetaNegBinomial_v_12;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_13> AgradDistributionsBetaNegBinomial_v_13;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_14> AgradDistributionsBetaNegBinomial_v_14;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_15> AgradDistributionsBetaNegBinomial_v_15;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_16> AgradDistributionsBetaNegBinomial_v_16;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_17> AgradDistributionsBetaNegBinomial_v_17;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_18> AgradDistributionsBetaNegBinomial_v_18;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_19> AgradDistributionsBetaNegBinomial_v_19;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_20> AgradDistributionsBetaNegBinomial_v_20;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_21> AgradDistributionsBetaNegBinomial_v_21;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_22> AgradDistributionsBetaNegBinomial_v_22;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_23> AgradDistributionsBetaNegBinomial_v_23;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_24> AgradDistributionsBetaNegBinomial_v_24;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_25> AgradDistributionsBetaNegBinomial_v_25;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_26> AgradDistributionsBetaNegBinomial_v_26;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_27> AgradDistributionsBetaNegBinomial_v_27;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_28> AgradDistributionsBetaNegBinomial_v_28;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_29> AgradDistributionsBetaNegBinomial_v_29;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_30> AgradDistributionsBetaNegBinomial_v_30;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_31> AgradDistributionsBetaNegBinomial_v_31;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_32> AgradDistributionsBetaNegBinomial_v_32;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_33> AgradDistributionsBetaNegBinomial_v_33;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_34> AgradDistributionsBetaNegBinomial_v_34;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_35> AgradDistributionsBetaNegBinomial_v_35;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_36> AgradDistributionsBetaNegBinomial_v_36;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_37> AgradDistributionsBetaNegBinomial_v_37;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_38> AgradDistributionsBetaNegBinomial_v_38;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_39> AgradDistributionsBetaNegBinomial_v_39;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_40> AgradDistributionsBetaNegBinomial_v_40;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_41> AgradDistributionsBetaNegBinomial_v_41;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_42> AgradDistributionsBetaNegBinomial_v_42;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_43> AgradDistributionsBetaNegBinomial_v_43;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_44> AgradDistributionsBetaNegBinomial_v_44;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_45> AgradDistributionsBetaNegBinomial_v_45;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_46> AgradDistributionsBetaNegBinomial_v_46;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_47> AgradDistributionsBetaNegBinomial_v_47;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_48> AgradDistributionsBetaNegBinomial_v_48;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_49> AgradDistributionsBetaNegBinomial_v_49;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_50> AgradDistributionsBetaNegBinomial_v_50;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_51> AgradDistributionsBetaNegBinomial_v_51;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_52> AgradDistributionsBetaNegBinomial_v_52;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_53> AgradDistributionsBetaNegBinomial_v_53;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_54> AgradDistributionsBetaNegBinomial_v_54;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_55> AgradDistributionsBetaNegBinomial_v_55;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_56> AgradDistributionsBetaNegBinomial_v_56;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_57> AgradDistributionsBetaNegBinomial_v_57;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_58> AgradDistributionsBetaNegBinomial_v_58;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_59> AgradDistributionsBetaNegBinomial_v_59;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_60> AgradDistributionsBetaNegBinomial_v_60;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_61> AgradDistributionsBetaNegBinomial_v_61;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_62> AgradDistributionsBetaNegBinomial_v_62;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_63> AgradDistributionsBetaNegBinomial_v_63;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_64> AgradDistributionsBetaNegBinomial_v_64;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_65> AgradDistributionsBetaNegBinomial_v_65;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_66> AgradDistributionsBetaNegBinomial_v_66;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_67> AgradDistributionsBetaNegBinomial_v_67;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_68> AgradDistributionsBetaNegBinomial_v_68;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_69> AgradDistributionsBetaNegBinomial_v_69;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_70> AgradDistributionsBetaNegBinomial_v_70;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_71> AgradDistributionsBetaNegBinomial_v_71;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_72> AgradDistributionsBetaNegBinomial_v_72;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_73> AgradDistributionsBetaNegBinomial_v_73;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_74> AgradDistributionsBetaNegBinomial_v_74;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_75> AgradDistributionsBetaNegBinomial_v_75;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_76> AgradDistributionsBetaNegBinomial_v_76;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_77> AgradDistributionsBetaNegBinomial_v_77;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_78> AgradDistributionsBetaNegBinomial_v_78;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_79> AgradDistributionsBetaNegBinomial_v_79;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_80> AgradDistributionsBetaNegBinomial_v_80;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_81> AgradDistributionsBetaNegBinomial_v_81;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_82> AgradDistributionsBetaNegBinomial_v_82;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_83> AgradDistributionsBetaNegBinomial_v_83;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_84> AgradDistributionsBetaNegBinomial_v_84;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_85> AgradDistributionsBetaNegBinomial_v_85;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_86> AgradDistributionsBetaNegBinomial_v_86;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_87> AgradDistributionsBetaNegBinomial_v_87;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_88> AgradDistributionsBetaNegBinomial_v_88;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_89> AgradDistributionsBetaNegBinomial_v_89;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_90> AgradDistributionsBetaNegBinomial_v_90;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_91> AgradDistributionsBetaNegBinomial_v_91;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_92> AgradDistributionsBetaNegBinomial_v_92;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_93> AgradDistributionsBetaNegBinomial_v_93;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_94> AgradDistributionsBetaNegBinomial_v_94;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_95> AgradDistributionsBetaNegBinomial_v_95;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_96> AgradDistributionsBetaNegBinomial_v_96;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_97> AgradDistributionsBetaNegBinomial_v_97;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_98> AgradDistributionsBetaNegBinomial_v_98;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_99> AgradDistributionsBetaNegBinomial_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_0, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_1, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_2, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_3, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_4, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_5, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_6, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_7, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_8, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_9, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_10, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_11, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_12, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_13, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_14, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_15, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_16, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_17, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_18, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_19, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_20, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_21, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_22, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_23, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_24, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_25, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_26, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_27, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_28, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_29, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_30, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_31, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_32, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_33, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_34, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_35, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_36, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_37, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_38, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_39, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_40, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_41, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_42, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_43, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_44, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_45, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_46, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_47, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_48, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_49, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_50, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_51, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_52, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_53, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_54, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_55, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_56, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_57, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_58, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_59, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_60, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_61, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_62, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_63, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_64, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_65, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_66, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_67, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_68, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_69, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_70, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_71, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_72, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_73, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_74, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_75, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_76, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_77, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_78, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_79, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_80, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_81, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_82, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_83, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_84, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_85, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_86, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_87, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_88, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_89, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_90, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_91, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_92, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_93, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_94, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_95, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_96, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_97, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_98, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_99, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_99);
+
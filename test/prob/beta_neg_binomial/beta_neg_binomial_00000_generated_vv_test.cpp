@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<int, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<int, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<int, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<int, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<int, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<int, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<int, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<int, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<int, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<int, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<int, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<int, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<int, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<int, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<int, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<int, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<int, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<int, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<int, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<int, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<int, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<int, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<int, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<int, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<int, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<int, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<int, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<int, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<int, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<int, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<int, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<int, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<int, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<int, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<int, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<int, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<int, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<int, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<int, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<int, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_0> AgradDistributionsBetaNegBinomial_vv_0;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_1> AgradDistributionsBetaNegBinomial_vv_1;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_2> AgradDistributionsBetaNegBinomial_vv_2;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_3> AgradDistributionsBetaNegBinomial_vv_3;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_4> AgradDistributionsBetaNegBinomial_vv_4;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_5> AgradDistributionsBetaNegBinomial_vv_5;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_6> AgradDistributionsBetaNegBinomial_vv_6;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_7> AgradDistributionsBetaNegBinomial_vv_7;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_8> AgradDistributionsBetaNegBinomial_vv_8;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_9> AgradDistributionsBetaNegBinomial_vv_9;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_10> AgradDistributionsBetaNegBinomial_vv_10;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_11> AgradDistributionsBetaNegBinomial_vv_11;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_12> AgradDistributionsBetaNegBinomial_vv_12;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_13> AgradDistributionsBetaNegBinomial_vv_13;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_14> AgradDistributionsBetaNegBinomial_vv_14;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_15> AgradDistributionsBetaNegBinomial_vv_15;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_16> AgradDistributionsBetaNegBinomial_vv_16;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_17> AgradDistributionsBetaNegBinomial_vv_17;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_18> AgradDistributionsBetaNegBinomial_vv_18;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_19> AgradDistributionsBetaNegBinomial_vv_19;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_20> AgradDistributionsBetaNegBinomial_vv_20;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_21> AgradDistributionsBetaNegBinomial_vv_21;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_22> AgradDistributionsBetaNegBinomial_vv_22;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_23> AgradDistributionsBetaNegBinomial_vv_23;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_24> AgradDistributionsBetaNegBinomial_vv_24;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_25> AgradDistributionsBetaNegBinomial_vv_25;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_26> AgradDistributionsBetaNegBinomial_vv_26;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_27> AgradDistributionsBetaNegBinomial_vv_27;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_28> AgradDistributionsBetaNegBinomial_vv_28;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_29> AgradDistributionsBetaNegBinomial_vv_29;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_30> AgradDistributionsBetaNegBinomial_vv_30;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_31> AgradDistributionsBetaNegBinomial_vv_31;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_32> AgradDistributionsBetaNegBinomial_vv_32;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_33> AgradDistributionsBetaNegBinomial_vv_33;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_34> AgradDistributionsBetaNegBinomial_vv_34;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_35> AgradDistributionsBetaNegBinomial_vv_35;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_36> AgradDistributionsBetaNegBinomial_vv_36;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_37> AgradDistributionsBetaNegBinomial_vv_37;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_38> AgradDistributionsBetaNegBinomial_vv_38;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_39> AgradDistributionsBetaNegBinomial_vv_39;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_40> AgradDistributionsBetaNegBinomial_vv_40;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_41> AgradDistributionsBetaNegBinomial_vv_41;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_42> AgradDistributionsBetaNegBinomial_vv_42;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_43> AgradDistributionsBetaNegBinomial_vv_43;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_44> AgradDistributionsBetaNegBinomial_vv_44;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_45> AgradDistributionsBetaNegBinomial_vv_45;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_46> AgradDistributionsBetaNegBinomial_vv_46;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_47> AgradDistributionsBetaNegBinomial_vv_47;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_48> AgradDistributionsBetaNegBinomial_vv_48;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_49> AgradDistributionsBetaNegBinomial_vv_49;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_50> AgradDistributionsBetaNegBinomial_vv_50;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_51> AgradDistributionsBetaNegBinomial_vv_51;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_52> AgradDistributionsBetaNegBinomial_vv_52;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_53> AgradDistributionsBetaNegBinomial_vv_53;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_54> AgradDistributionsBetaNegBinomial_vv_54;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_55> AgradDistributionsBetaNegBinomial_vv_55;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_56> AgradDistributionsBetaNegBinomial_vv_56;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_57> AgradDistributionsBetaNegBinomial_vv_57;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_58> AgradDistributionsBetaNegBinomial_vv_58;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_59> AgradDistributionsBetaNegBinomial_vv_59;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_60> AgradDistributionsBetaNegBinomial_vv_60;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_61> AgradDistributionsBetaNegBinomial_vv_61;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_62> AgradDistributionsBetaNegBinomial_vv_62;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_63> AgradDistributionsBetaNegBinomial_vv_63;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_64> AgradDistributionsBetaNegBinomial_vv_64;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_65> AgradDistributionsBetaNegBinomial_vv_65;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_66> AgradDistributionsBetaNegBinomial_vv_66;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_67> AgradDistributionsBetaNegBinomial_vv_67;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_68> AgradDistributionsBetaNegBinomial_vv_68;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_69> AgradDistributionsBetaNegBinomial_vv_69;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_70> AgradDistributionsBetaNegBinomial_vv_70;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_71> AgradDistributionsBetaNegBinomial_vv_71;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_72> AgradDistributionsBetaNegBinomial_vv_72;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_73> AgradDistributionsBetaNegBinomial_vv_73;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_74> AgradDistributionsBetaNegBinomial_vv_74;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_75> AgradDistributionsBetaNegBinomial_vv_75;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_76> AgradDistributionsBetaNegBinomial_vv_76;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_77> AgradDistributionsBetaNegBinomial_vv_77;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_78> AgradDistributionsBetaNegBinomial_vv_78;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_79> AgradDistributionsBetaNegBinomial_vv_79;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_80> AgradDistributionsBetaNegBinomial_vv_80;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_81> AgradDistributionsBetaNegBinomial_vv_81;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_82> AgradDistributionsBetaNegBinomial_vv_82;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_83> AgradDistributionsBetaNegBinomial_vv_83;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_84> AgradDistributionsBetaNegBinomial_vv_84;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_85> AgradDistributionsBetaNegBinomial_vv_85;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_86> AgradDistributionsBetaNegBinomial_vv_86;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_87> AgradDistributionsBetaNegBinomial_vv_87;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_88> AgradDistributionsBetaNegBinomial_vv_88;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_89> AgradDistributionsBetaNegBinomial_vv_89;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_90> AgradDistributionsBetaNegBinomial_vv_90;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_91> AgradDistributionsBetaNegBinomial_vv_91;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_92> AgradDistributionsBetaNegBinomial_vv_92;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_93> AgradDistributionsBetaNegBinomial_vv_93;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_94> AgradDistributionsBetaNegBinomial_vv_94;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_95> AgradDistributionsBetaNegBinomial_vv_95;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_96> AgradDistributionsBetaNegBinomial_vv_96;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_97> AgradDistributionsBetaNegBinomial_vv_97;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_98> AgradDistributionsBetaNegBinomial_vv_98;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_99> AgradDistributionsBetaNegBinomial_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_0, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_1, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_2, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_3, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_4, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_5, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_6, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_7, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_8, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_9, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_10, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_11, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_12, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_13, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_14, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_15, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_16, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_17, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_18, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_19, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_20, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_21, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_22, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_23, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_24, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_25, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_26, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_27, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_28, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_29, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_30, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_31, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_32, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_33, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_34, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_35, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_36, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_37, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_38, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_39, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_40, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_41, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_42, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_43, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_44, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_45, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_46, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_47, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_48, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_49, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_50, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_51, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_52, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_53, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_54, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_55, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_56, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_57, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_58, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_59, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_60, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_61, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_62, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_63, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_64, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_65, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_66, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_67, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_68, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_69, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_70, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_71, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_72, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_73, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_74, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_75, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_76, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_77, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_78, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_79, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_80, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_81, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_82, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_83, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_84, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_85, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_86, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_87, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_88, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_89, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_90, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_91, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_92, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_93, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_94, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_95, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_96, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_97, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_98, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_99, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_99);
+
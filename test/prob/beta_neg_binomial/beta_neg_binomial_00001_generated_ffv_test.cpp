@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<int>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<int>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<int>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_100> AgradDistributionsBetaNegBinomial_ffv_100;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_101> AgradDistributionsBetaNegBinomial_ffv_101;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_102> AgradDistributionsBetaNegBinomial_ffv_102;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_103> AgradDistributionsBetaNegBinomial_ffv_103;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_104> AgradDistributionsBetaNegBinomial_ffv_104;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_105> AgradDistributionsBetaNegBinomial_ffv_105;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_106> AgradDistributionsBetaNegBinomial_ffv_106;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_107> AgradDistributionsBetaNegBinomial_ffv_107;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_108> AgradDistributionsBetaNegBinomial_ffv_108;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_109> AgradDistributionsBetaNegBinomial_ffv_109;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_110> AgradDistributionsBetaNegBinomial_ffv_110;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_111> AgradDistributionsBetaNegBinomial_ffv_111;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_112> AgradDistributionsBetaNegBinomial_ffv_112;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_113> AgradDistributionsBetaNegBinomial_ffv_113;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_114> AgradDistributionsBetaNegBinomial_ffv_114;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_115> AgradDistributionsBetaNegBinomial_ffv_115;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_116> AgradDistributionsBetaNegBinomial_ffv_116;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_117> AgradDistributionsBetaNegBinomial_ffv_117;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_118> AgradDistributionsBetaNegBinomial_ffv_118;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_119> AgradDistributionsBetaNegBinomial_ffv_119;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_120> AgradDistributionsBetaNegBinomial_ffv_120;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_121> AgradDistributionsBetaNegBinomial_ffv_121;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_122> AgradDistributionsBetaNegBinomial_ffv_122;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_123> AgradDistributionsBetaNegBinomial_ffv_123;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_124> AgradDistributionsBetaNegBinomial_ffv_124;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_125> AgradDistributionsBetaNegBinomial_ffv_125;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_126> AgradDistributionsBetaNegBinomial_ffv_126;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_127> AgradDistributionsBetaNegBinomial_ffv_127;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_128> AgradDistributionsBetaNegBinomial_ffv_128;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_129> AgradDistributionsBetaNegBinomial_ffv_129;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_130> AgradDistributionsBetaNegBinomial_ffv_130;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_131> AgradDistributionsBetaNegBinomial_ffv_131;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_132> AgradDistributionsBetaNegBinomial_ffv_132;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_133> AgradDistributionsBetaNegBinomial_ffv_133;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_134> AgradDistributionsBetaNegBinomial_ffv_134;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_135> AgradDistributionsBetaNegBinomial_ffv_135;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_136> AgradDistributionsBetaNegBinomial_ffv_136;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_137> AgradDistributionsBetaNegBinomial_ffv_137;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_138> AgradDistributionsBetaNegBinomial_ffv_138;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_139> AgradDistributionsBetaNegBinomial_ffv_139;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_140> AgradDistributionsBetaNegBinomial_ffv_140;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_141> AgradDistributionsBetaNegBinomial_ffv_141;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_142> AgradDistributionsBetaNegBinomial_ffv_142;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_143> AgradDistributionsBetaNegBinomial_ffv_143;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_144> AgradDistributionsBetaNegBinomial_ffv_144;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_145> AgradDistributionsBetaNegBinomial_ffv_145;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_146> AgradDistributionsBetaNegBinomial_ffv_146;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_147> AgradDistributionsBetaNegBinomial_ffv_147;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_148> AgradDistributionsBetaNegBinomial_ffv_148;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_149> AgradDistributionsBetaNegBinomial_ffv_149;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_150> AgradDistributionsBetaNegBinomial_ffv_150;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_151> AgradDistributionsBetaNegBinomial_ffv_151;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_152> AgradDistributionsBetaNegBinomial_ffv_152;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_153> AgradDistributionsBetaNegBinomial_ffv_153;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_154> AgradDistributionsBetaNegBinomial_ffv_154;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_155> AgradDistributionsBetaNegBinomial_ffv_155;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_156> AgradDistributionsBetaNegBinomial_ffv_156;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_157> AgradDistributionsBetaNegBinomial_ffv_157;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_158> AgradDistributionsBetaNegBinomial_ffv_158;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_159> AgradDistributionsBetaNegBinomial_ffv_159;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_160> AgradDistributionsBetaNegBinomial_ffv_160;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_161> AgradDistributionsBetaNegBinomial_ffv_161;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_162> AgradDistributionsBetaNegBinomial_ffv_162;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_163> AgradDistributionsBetaNegBinomial_ffv_163;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_164> AgradDistributionsBetaNegBinomial_ffv_164;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_165> AgradDistributionsBetaNegBinomial_ffv_165;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_166> AgradDistributionsBetaNegBinomial_ffv_166;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_167> AgradDistributionsBetaNegBinomial_ffv_167;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_168> AgradDistributionsBetaNegBinomial_ffv_168;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_169> AgradDistributionsBetaNegBinomial_ffv_169;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_170> AgradDistributionsBetaNegBinomial_ffv_170;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_171> AgradDistributionsBetaNegBinomial_ffv_171;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_172> AgradDistributionsBetaNegBinomial_ffv_172;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_173> AgradDistributionsBetaNegBinomial_ffv_173;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_174> AgradDistributionsBetaNegBinomial_ffv_174;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_175> AgradDistributionsBetaNegBinomial_ffv_175;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_176> AgradDistributionsBetaNegBinomial_ffv_176;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_177> AgradDistributionsBetaNegBinomial_ffv_177;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_178> AgradDistributionsBetaNegBinomial_ffv_178;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_179> AgradDistributionsBetaNegBinomial_ffv_179;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_180> AgradDistributionsBetaNegBinomial_ffv_180;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_181> AgradDistributionsBetaNegBinomial_ffv_181;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_182> AgradDistributionsBetaNegBinomial_ffv_182;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_183> AgradDistributionsBetaNegBinomial_ffv_183;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_184> AgradDistributionsBetaNegBinomial_ffv_184;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_185> AgradDistributionsBetaNegBinomial_ffv_185;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_186> AgradDistributionsBetaNegBinomial_ffv_186;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_187> AgradDistributionsBetaNegBinomial_ffv_187;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_188> AgradDistributionsBetaNegBinomial_ffv_188;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_189> AgradDistributionsBetaNegBinomial_ffv_189;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_190> AgradDistributionsBetaNegBinomial_ffv_190;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_191> AgradDistributionsBetaNegBinomial_ffv_191;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_192> AgradDistributionsBetaNegBinomial_ffv_192;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_193> AgradDistributionsBetaNegBinomial_ffv_193;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_194> AgradDistributionsBetaNegBinomial_ffv_194;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_195> AgradDistributionsBetaNegBinomial_ffv_195;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_196> AgradDistributionsBetaNegBinomial_ffv_196;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_197> AgradDistributionsBetaNegBinomial_ffv_197;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_198> AgradDistributionsBetaNegBinomial_ffv_198;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_199> AgradDistributionsBetaNegBinomial_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_100, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_101, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_102, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_103, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_104, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_105, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_106, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_107, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_108, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_109, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_110, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_111, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_112, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_113, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_114, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_115, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_116, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_117, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_118, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_119, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_120, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_121, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_122, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_123, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_124, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_125, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_126, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_127, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_128, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_129, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_130, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_131, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_132, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_133, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_134, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_135, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_136, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_137, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_138, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_139, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_140, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_141, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_142, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_143, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_144, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_145, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_146, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_147, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_148, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_149, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_150, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_151, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_152, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_153, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_154, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_155, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_156, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_157, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_158, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_159, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_160, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_161, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_162, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_163, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_164, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_165, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_166, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_167, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_168, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_169, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_170, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_171, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_172, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_173, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_174, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_175, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_176, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_177, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_178, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_179, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_180, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_181, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_182, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_183, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_184, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_185, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_186, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_187, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_188, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_189, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_190, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_191, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_192, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_193, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_194, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_195, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_196, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_197, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_198, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_199, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_199);
+
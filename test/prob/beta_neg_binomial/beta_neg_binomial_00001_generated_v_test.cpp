@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<int, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<int, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<int, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<int, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<int, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<int, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<int, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<int, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<int, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<int, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<int, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<int, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<int, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<int, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<int, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<int, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<int, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<int, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<int, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<int, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<int, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<int, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<int, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<int, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<int, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<int, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<int, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<int, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<int, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<int, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<int, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<int, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<int, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<int, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<int, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<int, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_100> AgradDistributionsBetaNegBinomial_v_100;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_101> AgradDistributionsBetaNegBinomial_v_101;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_102> AgradDistributionsBetaNegBinomial_v_102;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_103> AgradDistributionsBetaNegBinomial_v_103;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_104> AgradDistributionsBetaNegBinomial_v_104;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_105> AgradDistributionsBetaNegBinomial_v_105;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_106> AgradDistributionsBetaNegBinomial_v_106;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_107> AgradDistributionsBetaNegBinomial_v_107;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_108> AgradDistributionsBetaNegBinomial_v_108;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_109> AgradDistributionsBetaNegBinomial_v_109;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_110> AgradDistributionsBetaNegBinomial_v_110;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_111> AgradDistributionsBetaNegBinomial_v_111;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_112> AgradDistributionsBetaNegBinomial_v_112;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_113> AgradDistributionsBetaNegBinomial_v_113;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_114> AgradDistributionsBetaNegBinomial_v_114;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_115> AgradDistributionsBetaNegBinomial_v_115;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_116> AgradDistributionsBetaNegBinomial_v_116;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_117> AgradDistributionsBetaNegBinomial_v_117;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_118> AgradDistributionsBetaNegBinomial_v_118;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_119> AgradDistributionsBetaNegBinomial_v_119;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_120> AgradDistributionsBetaNegBinomial_v_120;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_121> AgradDistributionsBetaNegBinomial_v_121;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_122> AgradDistributionsBetaNegBinomial_v_122;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_123> AgradDistributionsBetaNegBinomial_v_123;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_124> AgradDistributionsBetaNegBinomial_v_124;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_125> AgradDistributionsBetaNegBinomial_v_125;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_126> AgradDistributionsBetaNegBinomial_v_126;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_127> AgradDistributionsBetaNegBinomial_v_127;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_128> AgradDistributionsBetaNegBinomial_v_128;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_129> AgradDistributionsBetaNegBinomial_v_129;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_130> AgradDistributionsBetaNegBinomial_v_130;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_131> AgradDistributionsBetaNegBinomial_v_131;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_132> AgradDistributionsBetaNegBinomial_v_132;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_133> AgradDistributionsBetaNegBinomial_v_133;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_134> AgradDistributionsBetaNegBinomial_v_134;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_135> AgradDistributionsBetaNegBinomial_v_135;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_136> AgradDistributionsBetaNegBinomial_v_136;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_137> AgradDistributionsBetaNegBinomial_v_137;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_138> AgradDistributionsBetaNegBinomial_v_138;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_139> AgradDistributionsBetaNegBinomial_v_139;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_140> AgradDistributionsBetaNegBinomial_v_140;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_141> AgradDistributionsBetaNegBinomial_v_141;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_142> AgradDistributionsBetaNegBinomial_v_142;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_143> AgradDistributionsBetaNegBinomial_v_143;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_144> AgradDistributionsBetaNegBinomial_v_144;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_145> AgradDistributionsBetaNegBinomial_v_145;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_146> AgradDistributionsBetaNegBinomial_v_146;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_147> AgradDistributionsBetaNegBinomial_v_147;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_148> AgradDistributionsBetaNegBinomial_v_148;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_149> AgradDistributionsBetaNegBinomial_v_149;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_150> AgradDistributionsBetaNegBinomial_v_150;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_151> AgradDistributionsBetaNegBinomial_v_151;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_152> AgradDistributionsBetaNegBinomial_v_152;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_153> AgradDistributionsBetaNegBinomial_v_153;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_154> AgradDistributionsBetaNegBinomial_v_154;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_155> AgradDistributionsBetaNegBinomial_v_155;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_156> AgradDistributionsBetaNegBinomial_v_156;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_157> AgradDistributionsBetaNegBinomial_v_157;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_158> AgradDistributionsBetaNegBinomial_v_158;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_159> AgradDistributionsBetaNegBinomial_v_159;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_160> AgradDistributionsBetaNegBinomial_v_160;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_161> AgradDistributionsBetaNegBinomial_v_161;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_162> AgradDistributionsBetaNegBinomial_v_162;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_163> AgradDistributionsBetaNegBinomial_v_163;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_164> AgradDistributionsBetaNegBinomial_v_164;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_165> AgradDistributionsBetaNegBinomial_v_165;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_166> AgradDistributionsBetaNegBinomial_v_166;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_167> AgradDistributionsBetaNegBinomial_v_167;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_168> AgradDistributionsBetaNegBinomial_v_168;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_169> AgradDistributionsBetaNegBinomial_v_169;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_170> AgradDistributionsBetaNegBinomial_v_170;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_171> AgradDistributionsBetaNegBinomial_v_171;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_172> AgradDistributionsBetaNegBinomial_v_172;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_173> AgradDistributionsBetaNegBinomial_v_173;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_174> AgradDistributionsBetaNegBinomial_v_174;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_175> AgradDistributionsBetaNegBinomial_v_175;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_176> AgradDistributionsBetaNegBinomial_v_176;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_177> AgradDistributionsBetaNegBinomial_v_177;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_178> AgradDistributionsBetaNegBinomial_v_178;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_179> AgradDistributionsBetaNegBinomial_v_179;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_180> AgradDistributionsBetaNegBinomial_v_180;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_181> AgradDistributionsBetaNegBinomial_v_181;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_182> AgradDistributionsBetaNegBinomial_v_182;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_183> AgradDistributionsBetaNegBinomial_v_183;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_184> AgradDistributionsBetaNegBinomial_v_184;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_185> AgradDistributionsBetaNegBinomial_v_185;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_186> AgradDistributionsBetaNegBinomial_v_186;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_187> AgradDistributionsBetaNegBinomial_v_187;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_188> AgradDistributionsBetaNegBinomial_v_188;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_189> AgradDistributionsBetaNegBinomial_v_189;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_190> AgradDistributionsBetaNegBinomial_v_190;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_191> AgradDistributionsBetaNegBinomial_v_191;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_192> AgradDistributionsBetaNegBinomial_v_192;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_193> AgradDistributionsBetaNegBinomial_v_193;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_194> AgradDistributionsBetaNegBinomial_v_194;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_195> AgradDistributionsBetaNegBinomial_v_195;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_196> AgradDistributionsBetaNegBinomial_v_196;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_197> AgradDistributionsBetaNegBinomial_v_197;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_198> AgradDistributionsBetaNegBinomial_v_198;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_199> AgradDistributionsBetaNegBinomial_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_100, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_101, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_102, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_103, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_104, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_105, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_106, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_107, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_108, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_109, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_110, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_111, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_112, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_113, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_114, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_115, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_116, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_117, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_118, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_119, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_120, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_121, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_122, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_123, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_124, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_125, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_126, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_127, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_128, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_129, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_130, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_131, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_132, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_133, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_134, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_135, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_136, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_137, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_138, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_139, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_140, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_141, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_142, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_143, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_144, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_145, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_146, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_147, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_148, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_149, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_150, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_151, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_152, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_153, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_154, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_155, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_156, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_157, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_158, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_159, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_160, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_161, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_162, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_163, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_164, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_165, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_166, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_167, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_168, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_169, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_170, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_171, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_172, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_173, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_174, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_175, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_176, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_177, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_178, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_179, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_180, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_181, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_182, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_183, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_184, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_185, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_186, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_187, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_188, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_189, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_190, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_191, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_192, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_193, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_194, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_195, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_196, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_197, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_198, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_199, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_199);
+
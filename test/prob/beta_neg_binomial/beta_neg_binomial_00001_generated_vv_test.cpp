@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<int, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<int, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<int, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<int, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<int, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<int, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<int, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<int, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<int, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<int, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<int, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<int, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<int, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<int, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<int, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<int, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<int, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<int, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<int, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<int, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<int, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<int, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<int, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<int>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<int>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<int>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<int>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<int>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_100> AgradDistributionsBetaNegBinomial_vv_100;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_101> AgradDistributionsBetaNegBinomial_vv_101;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_102> AgradDistributionsBetaNegBinomial_vv_102;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_103> AgradDistributionsBetaNegBinomial_vv_103;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_104> AgradDistributionsBetaNegBinomial_vv_104;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_105> AgradDistributionsBetaNegBinomial_vv_105;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_106> AgradDistributionsBetaNegBinomial_vv_106;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_107> AgradDistributionsBetaNegBinomial_vv_107;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_108> AgradDistributionsBetaNegBinomial_vv_108;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_109> AgradDistributionsBetaNegBinomial_vv_109;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_110> AgradDistributionsBetaNegBinomial_vv_110;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_111> AgradDistributionsBetaNegBinomial_vv_111;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_112> AgradDistributionsBetaNegBinomial_vv_112;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_113> AgradDistributionsBetaNegBinomial_vv_113;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_114> AgradDistributionsBetaNegBinomial_vv_114;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_115> AgradDistributionsBetaNegBinomial_vv_115;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_116> AgradDistributionsBetaNegBinomial_vv_116;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_117> AgradDistributionsBetaNegBinomial_vv_117;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_118> AgradDistributionsBetaNegBinomial_vv_118;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_119> AgradDistributionsBetaNegBinomial_vv_119;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_120> AgradDistributionsBetaNegBinomial_vv_120;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_121> AgradDistributionsBetaNegBinomial_vv_121;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_122> AgradDistributionsBetaNegBinomial_vv_122;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_123> AgradDistributionsBetaNegBinomial_vv_123;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_124> AgradDistributionsBetaNegBinomial_vv_124;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_125> AgradDistributionsBetaNegBinomial_vv_125;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_126> AgradDistributionsBetaNegBinomial_vv_126;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_127> AgradDistributionsBetaNegBinomial_vv_127;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_128> AgradDistributionsBetaNegBinomial_vv_128;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_129> AgradDistributionsBetaNegBinomial_vv_129;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_130> AgradDistributionsBetaNegBinomial_vv_130;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_131> AgradDistributionsBetaNegBinomial_vv_131;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_132> AgradDistributionsBetaNegBinomial_vv_132;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_133> AgradDistributionsBetaNegBinomial_vv_133;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_134> AgradDistributionsBetaNegBinomial_vv_134;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_135> AgradDistributionsBetaNegBinomial_vv_135;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_136> AgradDistributionsBetaNegBinomial_vv_136;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_137> AgradDistributionsBetaNegBinomial_vv_137;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_138> AgradDistributionsBetaNegBinomial_vv_138;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_139> AgradDistributionsBetaNegBinomial_vv_139;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_140> AgradDistributionsBetaNegBinomial_vv_140;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_141> AgradDistributionsBetaNegBinomial_vv_141;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_142> AgradDistributionsBetaNegBinomial_vv_142;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_143> AgradDistributionsBetaNegBinomial_vv_143;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_144> AgradDistributionsBetaNegBinomial_vv_144;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_145> AgradDistributionsBetaNegBinomial_vv_145;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_146> AgradDistributionsBetaNegBinomial_vv_146;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_147> AgradDistributionsBetaNegBinomial_vv_147;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_148> AgradDistributionsBetaNegBinomial_vv_148;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_149> AgradDistributionsBetaNegBinomial_vv_149;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_150> AgradDistributionsBetaNegBinomial_vv_150;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_151> AgradDistributionsBetaNegBinomial_vv_151;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_152> AgradDistributionsBetaNegBinomial_vv_152;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_153> AgradDistributionsBetaNegBinomial_vv_153;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_154> AgradDistributionsBetaNegBinomial_vv_154;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_155> AgradDistributionsBetaNegBinomial_vv_155;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_156> AgradDistributionsBetaNegBinomial_vv_156;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_157> AgradDistributionsBetaNegBinomial_vv_157;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_158> AgradDistributionsBetaNegBinomial_vv_158;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_159> AgradDistributionsBetaNegBinomial_vv_159;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_160> AgradDistributionsBetaNegBinomial_vv_160;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_161> AgradDistributionsBetaNegBinomial_vv_161;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_162> AgradDistributionsBetaNegBinomial_vv_162;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_163> AgradDistributionsBetaNegBinomial_vv_163;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_164> AgradDistributionsBetaNegBinomial_vv_164;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_165> AgradDistributionsBetaNegBinomial_vv_165;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_166> AgradDistributionsBetaNegBinomial_vv_166;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_167> AgradDistributionsBetaNegBinomial_vv_167;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_168> AgradDistributionsBetaNegBinomial_vv_168;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_169> AgradDistributionsBetaNegBinomial_vv_169;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_170> AgradDistributionsBetaNegBinomial_vv_170;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_171> AgradDistributionsBetaNegBinomial_vv_171;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_172> AgradDistributionsBetaNegBinomial_vv_172;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_173> AgradDistributionsBetaNegBinomial_vv_173;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_174> AgradDistributionsBetaNegBinomial_vv_174;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_175> AgradDistributionsBetaNegBinomial_vv_175;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_176> AgradDistributionsBetaNegBinomial_vv_176;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_177> AgradDistributionsBetaNegBinomial_vv_177;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_178> AgradDistributionsBetaNegBinomial_vv_178;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_179> AgradDistributionsBetaNegBinomial_vv_179;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_180> AgradDistributionsBetaNegBinomial_vv_180;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_181> AgradDistributionsBetaNegBinomial_vv_181;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_182> AgradDistributionsBetaNegBinomial_vv_182;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_183> AgradDistributionsBetaNegBinomial_vv_183;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_184> AgradDistributionsBetaNegBinomial_vv_184;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_185> AgradDistributionsBetaNegBinomial_vv_185;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_186> AgradDistributionsBetaNegBinomial_vv_186;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_187> AgradDistributionsBetaNegBinomial_vv_187;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_188> AgradDistributionsBetaNegBinomial_vv_188;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_189> AgradDistributionsBetaNegBinomial_vv_189;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_190> AgradDistributionsBetaNegBinomial_vv_190;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_191> AgradDistributionsBetaNegBinomial_vv_191;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_192> AgradDistributionsBetaNegBinomial_vv_192;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_193> AgradDistributionsBetaNegBinomial_vv_193;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_194> AgradDistributionsBetaNegBinomial_vv_194;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_195> AgradDistributionsBetaNegBinomial_vv_195;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_196> AgradDistributionsBetaNegBinomial_vv_196;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_197> AgradDistributionsBetaNegBinomial_vv_197;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_198> AgradDistributionsBetaNegBinomial_vv_198;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_199> AgradDistributionsBetaNegBinomial_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_100, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_101, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_102, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_103, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_104, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_105, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_106, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_107, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_108, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_109, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_110, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_111, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_112, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_113, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_114, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_115, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_116, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_117, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_118, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_119, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_120, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_121, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_122, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_123, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_124, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_125, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_126, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_127, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_128, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_129, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_130, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_131, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_132, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_133, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_134, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_135, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_136, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_137, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_138, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_139, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_140, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_141, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_142, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_143, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_144, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_145, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_146, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_147, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_148, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_149, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_150, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_151, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_152, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_153, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_154, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_155, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_156, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_157, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_158, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_159, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_160, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_161, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_162, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_163, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_164, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_165, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_166, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_167, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_168, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_169, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_170, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_171, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_172, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_173, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_174, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_175, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_176, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_177, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_178, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_179, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_180, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_181, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_182, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_183, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_184, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_185, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_186, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_187, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_188, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_189, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_190, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_191, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_192, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_193, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_194, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_195, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_196, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_197, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_198, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_199, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_199);
+
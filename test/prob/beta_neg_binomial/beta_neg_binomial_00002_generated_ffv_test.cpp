@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_200> AgradDistributionsBetaNegBinomial_ffv_200;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_201> AgradDistributionsBetaNegBinomial_ffv_201;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_202> AgradDistributionsBetaNegBinomial_ffv_202;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_203> AgradDistributionsBetaNegBinomial_ffv_203;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_204> AgradDistributionsBetaNegBinomial_ffv_204;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_205> AgradDistributionsBetaNegBinomial_ffv_205;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_206> AgradDistributionsBetaNegBinomial_ffv_206;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_207> AgradDistributionsBetaNegBinomial_ffv_207;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_208> AgradDistributionsBetaNegBinomial_ffv_208;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_209> AgradDistributionsBetaNegBinomial_ffv_209;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_210> AgradDistributionsBetaNegBinomial_ffv_210;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_211> AgradDistributionsBetaNegBinomial_ffv_211;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_212> AgradDistributionsBetaNegBinomial_ffv_212;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_213> AgradDistributionsBetaNegBinomial_ffv_213;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_214> AgradDistributionsBetaNegBinomial_ffv_214;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_215> AgradDistributionsBetaNegBinomial_ffv_215;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_216> AgradDistributionsBetaNegBinomial_ffv_216;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_217> AgradDistributionsBetaNegBinomial_ffv_217;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_218> AgradDistributionsBetaNegBinomial_ffv_218;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_219> AgradDistributionsBetaNegBinomial_ffv_219;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_220> AgradDistributionsBetaNegBinomial_ffv_220;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_221> AgradDistributionsBetaNegBinomial_ffv_221;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_222> AgradDistributionsBetaNegBinomial_ffv_222;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_223> AgradDistributionsBetaNegBinomial_ffv_223;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_224> AgradDistributionsBetaNegBinomial_ffv_224;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_225> AgradDistributionsBetaNegBinomial_ffv_225;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_226> AgradDistributionsBetaNegBinomial_ffv_226;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_227> AgradDistributionsBetaNegBinomial_ffv_227;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_228> AgradDistributionsBetaNegBinomial_ffv_228;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_229> AgradDistributionsBetaNegBinomial_ffv_229;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_230> AgradDistributionsBetaNegBinomial_ffv_230;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_231> AgradDistributionsBetaNegBinomial_ffv_231;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_232> AgradDistributionsBetaNegBinomial_ffv_232;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_233> AgradDistributionsBetaNegBinomial_ffv_233;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_234> AgradDistributionsBetaNegBinomial_ffv_234;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_235> AgradDistributionsBetaNegBinomial_ffv_235;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_236> AgradDistributionsBetaNegBinomial_ffv_236;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_237> AgradDistributionsBetaNegBinomial_ffv_237;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_238> AgradDistributionsBetaNegBinomial_ffv_238;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_239> AgradDistributionsBetaNegBinomial_ffv_239;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_240> AgradDistributionsBetaNegBinomial_ffv_240;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_241> AgradDistributionsBetaNegBinomial_ffv_241;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_242> AgradDistributionsBetaNegBinomial_ffv_242;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_243> AgradDistributionsBetaNegBinomial_ffv_243;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_244> AgradDistributionsBetaNegBinomial_ffv_244;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_245> AgradDistributionsBetaNegBinomial_ffv_245;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_246> AgradDistributionsBetaNegBinomial_ffv_246;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_247> AgradDistributionsBetaNegBinomial_ffv_247;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_248> AgradDistributionsBetaNegBinomial_ffv_248;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_249> AgradDistributionsBetaNegBinomial_ffv_249;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_250> AgradDistributionsBetaNegBinomial_ffv_250;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_251> AgradDistributionsBetaNegBinomial_ffv_251;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_252> AgradDistributionsBetaNegBinomial_ffv_252;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_253> AgradDistributionsBetaNegBinomial_ffv_253;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_254> AgradDistributionsBetaNegBinomial_ffv_254;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_255> AgradDistributionsBetaNegBinomial_ffv_255;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_256> AgradDistributionsBetaNegBinomial_ffv_256;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_257> AgradDistributionsBetaNegBinomial_ffv_257;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_258> AgradDistributionsBetaNegBinomial_ffv_258;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_259> AgradDistributionsBetaNegBinomial_ffv_259;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_260> AgradDistributionsBetaNegBinomial_ffv_260;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_261> AgradDistributionsBetaNegBinomial_ffv_261;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_262> AgradDistributionsBetaNegBinomial_ffv_262;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_263> AgradDistributionsBetaNegBinomial_ffv_263;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_264> AgradDistributionsBetaNegBinomial_ffv_264;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_265> AgradDistributionsBetaNegBinomial_ffv_265;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_266> AgradDistributionsBetaNegBinomial_ffv_266;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_267> AgradDistributionsBetaNegBinomial_ffv_267;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_268> AgradDistributionsBetaNegBinomial_ffv_268;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_269> AgradDistributionsBetaNegBinomial_ffv_269;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_270> AgradDistributionsBetaNegBinomial_ffv_270;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_271> AgradDistributionsBetaNegBinomial_ffv_271;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_272> AgradDistributionsBetaNegBinomial_ffv_272;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_273> AgradDistributionsBetaNegBinomial_ffv_273;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_274> AgradDistributionsBetaNegBinomial_ffv_274;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_275> AgradDistributionsBetaNegBinomial_ffv_275;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_276> AgradDistributionsBetaNegBinomial_ffv_276;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_277> AgradDistributionsBetaNegBinomial_ffv_277;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_278> AgradDistributionsBetaNegBinomial_ffv_278;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_279> AgradDistributionsBetaNegBinomial_ffv_279;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_280> AgradDistributionsBetaNegBinomial_ffv_280;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_281> AgradDistributionsBetaNegBinomial_ffv_281;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_282> AgradDistributionsBetaNegBinomial_ffv_282;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_283> AgradDistributionsBetaNegBinomial_ffv_283;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_284> AgradDistributionsBetaNegBinomial_ffv_284;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_285> AgradDistributionsBetaNegBinomial_ffv_285;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_286> AgradDistributionsBetaNegBinomial_ffv_286;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_287> AgradDistributionsBetaNegBinomial_ffv_287;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_288> AgradDistributionsBetaNegBinomial_ffv_288;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_289> AgradDistributionsBetaNegBinomial_ffv_289;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_290> AgradDistributionsBetaNegBinomial_ffv_290;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_291> AgradDistributionsBetaNegBinomial_ffv_291;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_292> AgradDistributionsBetaNegBinomial_ffv_292;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_293> AgradDistributionsBetaNegBinomial_ffv_293;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_294> AgradDistributionsBetaNegBinomial_ffv_294;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_295> AgradDistributionsBetaNegBinomial_ffv_295;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_296> AgradDistributionsBetaNegBinomial_ffv_296;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_297> AgradDistributionsBetaNegBinomial_ffv_297;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_298> AgradDistributionsBetaNegBinomial_ffv_298;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_299> AgradDistributionsBetaNegBinomial_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_200, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_201, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_202, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_203, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_204, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_205, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_206, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_207, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_208, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_209, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_210, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_211, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_212, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_213, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_214, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_215, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_216, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_217, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_218, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_219, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_220, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_221, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_222, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_223, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_224, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_225, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_226, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_227, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_228, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_229, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_230, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_231, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_232, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_233, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_234, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_235, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_236, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_237, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_238, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_239, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_240, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_241, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_242, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_243, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_244, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_245, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_246, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_247, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_248, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_249, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_250, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_251, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_252, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_253, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_254, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_255, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_256, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_257, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_258, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_259, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_260, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_261, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_262, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_263, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_264, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_265, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_266, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_267, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_268, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_269, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_270, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_271, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_272, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_273, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_274, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_275, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_276, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_277, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_278, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_279, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_280, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_281, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_282, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_283, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_284, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_285, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_286, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_287, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_288, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_289, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_290, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_291, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_292, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_293, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_294, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_295, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_296, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_297, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_298, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_299, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<int>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<int>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<int>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<int>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<int>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<int>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<int>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<int>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<int>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<int>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<int>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<int>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_200> AgradDistributionsBetaNegBinomial_v_200;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_201> AgradDistributionsBetaNegBinomial_v_201;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_202> AgradDistributionsBetaNegBinomial_v_202;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_203> AgradDistributionsBetaNegBinomial_v_203;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_204> AgradDistributionsBetaNegBinomial_v_204;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_205> AgradDistributionsBetaNegBinomial_v_205;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_206> AgradDistributionsBetaNegBinomial_v_206;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_207> AgradDistributionsBetaNegBinomial_v_207;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_208> AgradDistributionsBetaNegBinomial_v_208;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_209> AgradDistributionsBetaNegBinomial_v_209;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_210> AgradDistributionsBetaNegBinomial_v_210;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_211> AgradDistributionsBetaNegBinomial_v_211;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_212> AgradDistributionsBetaNegBinomial_v_212;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_213> AgradDistributionsBetaNegBinomial_v_213;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_214> AgradDistributionsBetaNegBinomial_v_214;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_215> AgradDistributionsBetaNegBinomial_v_215;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_216> AgradDistributionsBetaNegBinomial_v_216;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_217> AgradDistributionsBetaNegBinomial_v_217;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_218> AgradDistributionsBetaNegBinomial_v_218;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_219> AgradDistributionsBetaNegBinomial_v_219;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_220> AgradDistributionsBetaNegBinomial_v_220;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_221> AgradDistributionsBetaNegBinomial_v_221;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_222> AgradDistributionsBetaNegBinomial_v_222;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_223> AgradDistributionsBetaNegBinomial_v_223;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_224> AgradDistributionsBetaNegBinomial_v_224;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_225> AgradDistributionsBetaNegBinomial_v_225;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_226> AgradDistributionsBetaNegBinomial_v_226;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_227> AgradDistributionsBetaNegBinomial_v_227;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_228> AgradDistributionsBetaNegBinomial_v_228;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_229> AgradDistributionsBetaNegBinomial_v_229;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_230> AgradDistributionsBetaNegBinomial_v_230;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_231> AgradDistributionsBetaNegBinomial_v_231;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_232> AgradDistributionsBetaNegBinomial_v_232;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_233> AgradDistributionsBetaNegBinomial_v_233;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_234> AgradDistributionsBetaNegBinomial_v_234;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_235> AgradDistributionsBetaNegBinomial_v_235;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_236> AgradDistributionsBetaNegBinomial_v_236;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_237> AgradDistributionsBetaNegBinomial_v_237;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_238> AgradDistributionsBetaNegBinomial_v_238;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_239> AgradDistributionsBetaNegBinomial_v_239;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_240> AgradDistributionsBetaNegBinomial_v_240;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_241> AgradDistributionsBetaNegBinomial_v_241;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_242> AgradDistributionsBetaNegBinomial_v_242;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_243> AgradDistributionsBetaNegBinomial_v_243;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_244> AgradDistributionsBetaNegBinomial_v_244;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_245> AgradDistributionsBetaNegBinomial_v_245;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_246> AgradDistributionsBetaNegBinomial_v_246;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_247> AgradDistributionsBetaNegBinomial_v_247;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_248> AgradDistributionsBetaNegBinomial_v_248;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_249> AgradDistributionsBetaNegBinomial_v_249;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_250> AgradDistributionsBetaNegBinomial_v_250;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_251> AgradDistributionsBetaNegBinomial_v_251;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_252> AgradDistributionsBetaNegBinomial_v_252;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_253> AgradDistributionsBetaNegBinomial_v_253;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_254> AgradDistributionsBetaNegBinomial_v_254;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_255> AgradDistributionsBetaNegBinomial_v_255;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_256> AgradDistributionsBetaNegBinomial_v_256;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_257> AgradDistributionsBetaNegBinomial_v_257;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_258> AgradDistributionsBetaNegBinomial_v_258;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_259> AgradDistributionsBetaNegBinomial_v_259;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_260> AgradDistributionsBetaNegBinomial_v_260;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_261> AgradDistributionsBetaNegBinomial_v_261;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_262> AgradDistributionsBetaNegBinomial_v_262;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_263> AgradDistributionsBetaNegBinomial_v_263;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_264> AgradDistributionsBetaNegBinomial_v_264;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_265> AgradDistributionsBetaNegBinomial_v_265;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_266> AgradDistributionsBetaNegBinomial_v_266;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_267> AgradDistributionsBetaNegBinomial_v_267;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_268> AgradDistributionsBetaNegBinomial_v_268;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_269> AgradDistributionsBetaNegBinomial_v_269;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_270> AgradDistributionsBetaNegBinomial_v_270;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_271> AgradDistributionsBetaNegBinomial_v_271;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_272> AgradDistributionsBetaNegBinomial_v_272;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_273> AgradDistributionsBetaNegBinomial_v_273;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_274> AgradDistributionsBetaNegBinomial_v_274;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_275> AgradDistributionsBetaNegBinomial_v_275;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_276> AgradDistributionsBetaNegBinomial_v_276;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_277> AgradDistributionsBetaNegBinomial_v_277;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_278> AgradDistributionsBetaNegBinomial_v_278;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_279> AgradDistributionsBetaNegBinomial_v_279;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_280> AgradDistributionsBetaNegBinomial_v_280;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_281> AgradDistributionsBetaNegBinomial_v_281;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_282> AgradDistributionsBetaNegBinomial_v_282;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_283> AgradDistributionsBetaNegBinomial_v_283;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_284> AgradDistributionsBetaNegBinomial_v_284;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_285> AgradDistributionsBetaNegBinomial_v_285;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_286> AgradDistributionsBetaNegBinomial_v_286;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_287> AgradDistributionsBetaNegBinomial_v_287;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_288> AgradDistributionsBetaNegBinomial_v_288;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_289> AgradDistributionsBetaNegBinomial_v_289;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_290> AgradDistributionsBetaNegBinomial_v_290;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_291> AgradDistributionsBetaNegBinomial_v_291;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_292> AgradDistributionsBetaNegBinomial_v_292;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_293> AgradDistributionsBetaNegBinomial_v_293;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_294> AgradDistributionsBetaNegBinomial_v_294;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_295> AgradDistributionsBetaNegBinomial_v_295;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_296> AgradDistributionsBetaNegBinomial_v_296;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_297> AgradDistributionsBetaNegBinomial_v_297;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_298> AgradDistributionsBetaNegBinomial_v_298;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_299> AgradDistributionsBetaNegBinomial_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_200, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_201, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_202, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_203, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_204, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_205, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_206, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_207, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_208, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_209, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_210, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_211, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_212, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_213, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_214, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_215, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_216, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_217, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_218, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_219, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_220, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_221, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_222, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_223, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_224, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_225, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_226, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_227, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_228, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_229, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_230, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_231, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_232, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_233, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_234, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_235, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_236, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_237, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_238, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_239, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_240, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_241, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_242, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_243, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_244, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_245, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_246, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_247, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_248, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_249, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_250, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_251, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_252, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_253, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_254, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_255, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_256, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_257, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_258, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_259, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_260, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_261, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_262, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_263, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_264, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_265, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_266, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_267, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_268, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_269, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_270, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_271, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_272, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_273, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_274, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_275, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_276, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_277, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_278, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_279, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_280, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_281, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_282, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_283, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_284, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_285, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_286, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_287, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_288, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_289, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_290, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_291, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_292, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_293, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_294, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_295, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_296, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_297, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_298, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_299, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_299);
+
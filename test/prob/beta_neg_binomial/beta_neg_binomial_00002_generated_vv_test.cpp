@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<std::vector<int>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<int>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<int>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<int>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<int>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<int>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<int>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<int>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<int>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<int>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<int>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<int>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<int>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<int>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<int>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<int>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_200> AgradDistributionsBetaNegBinomial_vv_200;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_201> AgradDistributionsBetaNegBinomial_vv_201;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_202> AgradDistributionsBetaNegBinomial_vv_202;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_203> AgradDistributionsBetaNegBinomial_vv_203;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_204> AgradDistributionsBetaNegBinomial_vv_204;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_205> AgradDistributionsBetaNegBinomial_vv_205;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_206> AgradDistributionsBetaNegBinomial_vv_206;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_207> AgradDistributionsBetaNegBinomial_vv_207;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_208> AgradDistributionsBetaNegBinomial_vv_208;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_209> AgradDistributionsBetaNegBinomial_vv_209;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_210> AgradDistributionsBetaNegBinomial_vv_210;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_211> AgradDistributionsBetaNegBinomial_vv_211;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_212> AgradDistributionsBetaNegBinomial_vv_212;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_213> AgradDistributionsBetaNegBinomial_vv_213;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_214> AgradDistributionsBetaNegBinomial_vv_214;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_215> AgradDistributionsBetaNegBinomial_vv_215;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_216> AgradDistributionsBetaNegBinomial_vv_216;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_217> AgradDistributionsBetaNegBinomial_vv_217;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_218> AgradDistributionsBetaNegBinomial_vv_218;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_219> AgradDistributionsBetaNegBinomial_vv_219;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_220> AgradDistributionsBetaNegBinomial_vv_220;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_221> AgradDistributionsBetaNegBinomial_vv_221;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_222> AgradDistributionsBetaNegBinomial_vv_222;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_223> AgradDistributionsBetaNegBinomial_vv_223;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_224> AgradDistributionsBetaNegBinomial_vv_224;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_225> AgradDistributionsBetaNegBinomial_vv_225;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_226> AgradDistributionsBetaNegBinomial_vv_226;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_227> AgradDistributionsBetaNegBinomial_vv_227;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_228> AgradDistributionsBetaNegBinomial_vv_228;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_229> AgradDistributionsBetaNegBinomial_vv_229;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_230> AgradDistributionsBetaNegBinomial_vv_230;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_231> AgradDistributionsBetaNegBinomial_vv_231;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_232> AgradDistributionsBetaNegBinomial_vv_232;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_233> AgradDistributionsBetaNegBinomial_vv_233;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_234> AgradDistributionsBetaNegBinomial_vv_234;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_235> AgradDistributionsBetaNegBinomial_vv_235;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_236> AgradDistributionsBetaNegBinomial_vv_236;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_237> AgradDistributionsBetaNegBinomial_vv_237;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_238> AgradDistributionsBetaNegBinomial_vv_238;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_239> AgradDistributionsBetaNegBinomial_vv_239;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_240> AgradDistributionsBetaNegBinomial_vv_240;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_241> AgradDistributionsBetaNegBinomial_vv_241;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_242> AgradDistributionsBetaNegBinomial_vv_242;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_243> AgradDistributionsBetaNegBinomial_vv_243;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_244> AgradDistributionsBetaNegBinomial_vv_244;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_245> AgradDistributionsBetaNegBinomial_vv_245;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_246> AgradDistributionsBetaNegBinomial_vv_246;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_247> AgradDistributionsBetaNegBinomial_vv_247;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_248> AgradDistributionsBetaNegBinomial_vv_248;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_249> AgradDistributionsBetaNegBinomial_vv_249;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_250> AgradDistributionsBetaNegBinomial_vv_250;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_251> AgradDistributionsBetaNegBinomial_vv_251;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_252> AgradDistributionsBetaNegBinomial_vv_252;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_253> AgradDistributionsBetaNegBinomial_vv_253;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_254> AgradDistributionsBetaNegBinomial_vv_254;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_255> AgradDistributionsBetaNegBinomial_vv_255;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_256> AgradDistributionsBetaNegBinomial_vv_256;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_257> AgradDistributionsBetaNegBinomial_vv_257;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_258> AgradDistributionsBetaNegBinomial_vv_258;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_259> AgradDistributionsBetaNegBinomial_vv_259;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_260> AgradDistributionsBetaNegBinomial_vv_260;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_261> AgradDistributionsBetaNegBinomial_vv_261;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_262> AgradDistributionsBetaNegBinomial_vv_262;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_263> AgradDistributionsBetaNegBinomial_vv_263;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_264> AgradDistributionsBetaNegBinomial_vv_264;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_265> AgradDistributionsBetaNegBinomial_vv_265;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_266> AgradDistributionsBetaNegBinomial_vv_266;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_267> AgradDistributionsBetaNegBinomial_vv_267;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_268> AgradDistributionsBetaNegBinomial_vv_268;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_269> AgradDistributionsBetaNegBinomial_vv_269;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_270> AgradDistributionsBetaNegBinomial_vv_270;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_271> AgradDistributionsBetaNegBinomial_vv_271;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_272> AgradDistributionsBetaNegBinomial_vv_272;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_273> AgradDistributionsBetaNegBinomial_vv_273;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_274> AgradDistributionsBetaNegBinomial_vv_274;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_275> AgradDistributionsBetaNegBinomial_vv_275;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_276> AgradDistributionsBetaNegBinomial_vv_276;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_277> AgradDistributionsBetaNegBinomial_vv_277;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_278> AgradDistributionsBetaNegBinomial_vv_278;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_279> AgradDistributionsBetaNegBinomial_vv_279;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_280> AgradDistributionsBetaNegBinomial_vv_280;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_281> AgradDistributionsBetaNegBinomial_vv_281;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_282> AgradDistributionsBetaNegBinomial_vv_282;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_283> AgradDistributionsBetaNegBinomial_vv_283;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_284> AgradDistributionsBetaNegBinomial_vv_284;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_285> AgradDistributionsBetaNegBinomial_vv_285;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_286> AgradDistributionsBetaNegBinomial_vv_286;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_287> AgradDistributionsBetaNegBinomial_vv_287;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_288> AgradDistributionsBetaNegBinomial_vv_288;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_289> AgradDistributionsBetaNegBinomial_vv_289;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_290> AgradDistributionsBetaNegBinomial_vv_290;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_291> AgradDistributionsBetaNegBinomial_vv_291;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_292> AgradDistributionsBetaNegBinomial_vv_292;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_293> AgradDistributionsBetaNegBinomial_vv_293;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_294> AgradDistributionsBetaNegBinomial_vv_294;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_295> AgradDistributionsBetaNegBinomial_vv_295;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_296> AgradDistributionsBetaNegBinomial_vv_296;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_297> AgradDistributionsBetaNegBinomial_vv_297;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_298> AgradDistributionsBetaNegBinomial_vv_298;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_299> AgradDistributionsBetaNegBinomial_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_200, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_201, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_202, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_203, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_204, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_205, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_206, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_207, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_208, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_209, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_210, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_211, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_212, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_213, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_214, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_215, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_216, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_217, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_218, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_219, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_220, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_221, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_222, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_223, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_224, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_225, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_226, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_227, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_228, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_229, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_230, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_231, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_232, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_233, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_234, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_235, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_236, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_237, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_238, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_239, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_240, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_241, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_242, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_243, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_244, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_245, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_246, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_247, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_248, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_249, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_250, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_251, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_252, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_253, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_254, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_255, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_256, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_257, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_258, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_259, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_260, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_261, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_262, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_263, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_264, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_265, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_266, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_267, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_268, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_269, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_270, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_271, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_272, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_273, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_274, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_275, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_276, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_277, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_278, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_279, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_280, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_281, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_282, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_283, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_284, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_285, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_286, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_287, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_288, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_289, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_290, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_291, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_292, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_293, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_294, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_295, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_296, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_297, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_298, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_299, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_300> AgradDistributionsBetaNegBinomial_ffv_300;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_301> AgradDistributionsBetaNegBinomial_ffv_301;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_302> AgradDistributionsBetaNegBinomial_ffv_302;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_303> AgradDistributionsBetaNegBinomial_ffv_303;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_304> AgradDistributionsBetaNegBinomial_ffv_304;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_305> AgradDistributionsBetaNegBinomial_ffv_305;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_306> AgradDistributionsBetaNegBinomial_ffv_306;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_307> AgradDistributionsBetaNegBinomial_ffv_307;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_308> AgradDistributionsBetaNegBinomial_ffv_308;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_309> AgradDistributionsBetaNegBinomial_ffv_309;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_310> AgradDistributionsBetaNegBinomial_ffv_310;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_311> AgradDistributionsBetaNegBinomial_ffv_311;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_312> AgradDistributionsBetaNegBinomial_ffv_312;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_313> AgradDistributionsBetaNegBinomial_ffv_313;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_314> AgradDistributionsBetaNegBinomial_ffv_314;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_315> AgradDistributionsBetaNegBinomial_ffv_315;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_316> AgradDistributionsBetaNegBinomial_ffv_316;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_317> AgradDistributionsBetaNegBinomial_ffv_317;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_318> AgradDistributionsBetaNegBinomial_ffv_318;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_319> AgradDistributionsBetaNegBinomial_ffv_319;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_320> AgradDistributionsBetaNegBinomial_ffv_320;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_321> AgradDistributionsBetaNegBinomial_ffv_321;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_322> AgradDistributionsBetaNegBinomial_ffv_322;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_323> AgradDistributionsBetaNegBinomial_ffv_323;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_324> AgradDistributionsBetaNegBinomial_ffv_324;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_325> AgradDistributionsBetaNegBinomial_ffv_325;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_326> AgradDistributionsBetaNegBinomial_ffv_326;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_327> AgradDistributionsBetaNegBinomial_ffv_327;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_328> AgradDistributionsBetaNegBinomial_ffv_328;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_329> AgradDistributionsBetaNegBinomial_ffv_329;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_330> AgradDistributionsBetaNegBinomial_ffv_330;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_331> AgradDistributionsBetaNegBinomial_ffv_331;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_332> AgradDistributionsBetaNegBinomial_ffv_332;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_333> AgradDistributionsBetaNegBinomial_ffv_333;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_334> AgradDistributionsBetaNegBinomial_ffv_334;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_335> AgradDistributionsBetaNegBinomial_ffv_335;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_336> AgradDistributionsBetaNegBinomial_ffv_336;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_337> AgradDistributionsBetaNegBinomial_ffv_337;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_338> AgradDistributionsBetaNegBinomial_ffv_338;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_339> AgradDistributionsBetaNegBinomial_ffv_339;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_340> AgradDistributionsBetaNegBinomial_ffv_340;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_341> AgradDistributionsBetaNegBinomial_ffv_341;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_342> AgradDistributionsBetaNegBinomial_ffv_342;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_343> AgradDistributionsBetaNegBinomial_ffv_343;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_344> AgradDistributionsBetaNegBinomial_ffv_344;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_345> AgradDistributionsBetaNegBinomial_ffv_345;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_346> AgradDistributionsBetaNegBinomial_ffv_346;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_347> AgradDistributionsBetaNegBinomial_ffv_347;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_348> AgradDistributionsBetaNegBinomial_ffv_348;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_349> AgradDistributionsBetaNegBinomial_ffv_349;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_350> AgradDistributionsBetaNegBinomial_ffv_350;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_351> AgradDistributionsBetaNegBinomial_ffv_351;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_352> AgradDistributionsBetaNegBinomial_ffv_352;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_353> AgradDistributionsBetaNegBinomial_ffv_353;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_354> AgradDistributionsBetaNegBinomial_ffv_354;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_355> AgradDistributionsBetaNegBinomial_ffv_355;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_356> AgradDistributionsBetaNegBinomial_ffv_356;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_357> AgradDistributionsBetaNegBinomial_ffv_357;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_358> AgradDistributionsBetaNegBinomial_ffv_358;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_359> AgradDistributionsBetaNegBinomial_ffv_359;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_360> AgradDistributionsBetaNegBinomial_ffv_360;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_361> AgradDistributionsBetaNegBinomial_ffv_361;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_362> AgradDistributionsBetaNegBinomial_ffv_362;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_363> AgradDistributionsBetaNegBinomial_ffv_363;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_364> AgradDistributionsBetaNegBinomial_ffv_364;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_365> AgradDistributionsBetaNegBinomial_ffv_365;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_366> AgradDistributionsBetaNegBinomial_ffv_366;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_367> AgradDistributionsBetaNegBinomial_ffv_367;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_368> AgradDistributionsBetaNegBinomial_ffv_368;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_369> AgradDistributionsBetaNegBinomial_ffv_369;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_370> AgradDistributionsBetaNegBinomial_ffv_370;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_371> AgradDistributionsBetaNegBinomial_ffv_371;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_372> AgradDistributionsBetaNegBinomial_ffv_372;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_373> AgradDistributionsBetaNegBinomial_ffv_373;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_374> AgradDistributionsBetaNegBinomial_ffv_374;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_375> AgradDistributionsBetaNegBinomial_ffv_375;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_376> AgradDistributionsBetaNegBinomial_ffv_376;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_377> AgradDistributionsBetaNegBinomial_ffv_377;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_378> AgradDistributionsBetaNegBinomial_ffv_378;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_379> AgradDistributionsBetaNegBinomial_ffv_379;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_380> AgradDistributionsBetaNegBinomial_ffv_380;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_381> AgradDistributionsBetaNegBinomial_ffv_381;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_382> AgradDistributionsBetaNegBinomial_ffv_382;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_383> AgradDistributionsBetaNegBinomial_ffv_383;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_384> AgradDistributionsBetaNegBinomial_ffv_384;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_385> AgradDistributionsBetaNegBinomial_ffv_385;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_386> AgradDistributionsBetaNegBinomial_ffv_386;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_387> AgradDistributionsBetaNegBinomial_ffv_387;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_388> AgradDistributionsBetaNegBinomial_ffv_388;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_389> AgradDistributionsBetaNegBinomial_ffv_389;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_390> AgradDistributionsBetaNegBinomial_ffv_390;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_391> AgradDistributionsBetaNegBinomial_ffv_391;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_392> AgradDistributionsBetaNegBinomial_ffv_392;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_393> AgradDistributionsBetaNegBinomial_ffv_393;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_394> AgradDistributionsBetaNegBinomial_ffv_394;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_395> AgradDistributionsBetaNegBinomial_ffv_395;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_396> AgradDistributionsBetaNegBinomial_ffv_396;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_397> AgradDistributionsBetaNegBinomial_ffv_397;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_398> AgradDistributionsBetaNegBinomial_ffv_398;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_399> AgradDistributionsBetaNegBinomial_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_300, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_301, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_302, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_303, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_304, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_305, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_306, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_307, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_308, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_309, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_310, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_311, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_312, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_313, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_314, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_315, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_316, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_317, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_318, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_319, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_320, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_321, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_322, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_323, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_324, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_325, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_326, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_327, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_328, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_329, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_330, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_331, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_332, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_333, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_334, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_335, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_336, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_337, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_338, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_339, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_340, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_341, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_342, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_343, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_344, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_345, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_346, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_347, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_348, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_349, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_350, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_351, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_352, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_353, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_354, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_355, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_356, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_357, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_358, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_359, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_360, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_361, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_362, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_363, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_364, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_365, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_366, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_367, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_368, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_369, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_370, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_371, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_372, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_373, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_374, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_375, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_376, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_377, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_378, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_379, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_380, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_381, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_382, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_383, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_384, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_385, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_386, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_387, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_388, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_389, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_390, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_391, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_392, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_393, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_394, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_395, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_396, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_397, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_398, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_399, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_399);
+
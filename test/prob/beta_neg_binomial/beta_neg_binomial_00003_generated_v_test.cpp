@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<int>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<int>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<int>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<int>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<int>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<int>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<int>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<int>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<int>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<int>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<int>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<int>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_300> AgradDistributionsBetaNegBinomial_v_300;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_301> AgradDistributionsBetaNegBinomial_v_301;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_302> AgradDistributionsBetaNegBinomial_v_302;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_303> AgradDistributionsBetaNegBinomial_v_303;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_304> AgradDistributionsBetaNegBinomial_v_304;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_305> AgradDistributionsBetaNegBinomial_v_305;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_306> AgradDistributionsBetaNegBinomial_v_306;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_307> AgradDistributionsBetaNegBinomial_v_307;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_308> AgradDistributionsBetaNegBinomial_v_308;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_309> AgradDistributionsBetaNegBinomial_v_309;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_310> AgradDistributionsBetaNegBinomial_v_310;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_311> AgradDistributionsBetaNegBinomial_v_311;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_312> AgradDistributionsBetaNegBinomial_v_312;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_313> AgradDistributionsBetaNegBinomial_v_313;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_314> AgradDistributionsBetaNegBinomial_v_314;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_315> AgradDistributionsBetaNegBinomial_v_315;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_316> AgradDistributionsBetaNegBinomial_v_316;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_317> AgradDistributionsBetaNegBinomial_v_317;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_318> AgradDistributionsBetaNegBinomial_v_318;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_319> AgradDistributionsBetaNegBinomial_v_319;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_320> AgradDistributionsBetaNegBinomial_v_320;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_321> AgradDistributionsBetaNegBinomial_v_321;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_322> AgradDistributionsBetaNegBinomial_v_322;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_323> AgradDistributionsBetaNegBinomial_v_323;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_324> AgradDistributionsBetaNegBinomial_v_324;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_325> AgradDistributionsBetaNegBinomial_v_325;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_326> AgradDistributionsBetaNegBinomial_v_326;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_327> AgradDistributionsBetaNegBinomial_v_327;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_328> AgradDistributionsBetaNegBinomial_v_328;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_329> AgradDistributionsBetaNegBinomial_v_329;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_330> AgradDistributionsBetaNegBinomial_v_330;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_331> AgradDistributionsBetaNegBinomial_v_331;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_332> AgradDistributionsBetaNegBinomial_v_332;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_333> AgradDistributionsBetaNegBinomial_v_333;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_334> AgradDistributionsBetaNegBinomial_v_334;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_335> AgradDistributionsBetaNegBinomial_v_335;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_336> AgradDistributionsBetaNegBinomial_v_336;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_337> AgradDistributionsBetaNegBinomial_v_337;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_338> AgradDistributionsBetaNegBinomial_v_338;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_339> AgradDistributionsBetaNegBinomial_v_339;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_340> AgradDistributionsBetaNegBinomial_v_340;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_341> AgradDistributionsBetaNegBinomial_v_341;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_342> AgradDistributionsBetaNegBinomial_v_342;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_343> AgradDistributionsBetaNegBinomial_v_343;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_344> AgradDistributionsBetaNegBinomial_v_344;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_345> AgradDistributionsBetaNegBinomial_v_345;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_346> AgradDistributionsBetaNegBinomial_v_346;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_347> AgradDistributionsBetaNegBinomial_v_347;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_348> AgradDistributionsBetaNegBinomial_v_348;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_349> AgradDistributionsBetaNegBinomial_v_349;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_350> AgradDistributionsBetaNegBinomial_v_350;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_351> AgradDistributionsBetaNegBinomial_v_351;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_352> AgradDistributionsBetaNegBinomial_v_352;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_353> AgradDistributionsBetaNegBinomial_v_353;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_354> AgradDistributionsBetaNegBinomial_v_354;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_355> AgradDistributionsBetaNegBinomial_v_355;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_356> AgradDistributionsBetaNegBinomial_v_356;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_357> AgradDistributionsBetaNegBinomial_v_357;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_358> AgradDistributionsBetaNegBinomial_v_358;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_359> AgradDistributionsBetaNegBinomial_v_359;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_360> AgradDistributionsBetaNegBinomial_v_360;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_361> AgradDistributionsBetaNegBinomial_v_361;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_362> AgradDistributionsBetaNegBinomial_v_362;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_363> AgradDistributionsBetaNegBinomial_v_363;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_364> AgradDistributionsBetaNegBinomial_v_364;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_365> AgradDistributionsBetaNegBinomial_v_365;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_366> AgradDistributionsBetaNegBinomial_v_366;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_367> AgradDistributionsBetaNegBinomial_v_367;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_368> AgradDistributionsBetaNegBinomial_v_368;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_369> AgradDistributionsBetaNegBinomial_v_369;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_370> AgradDistributionsBetaNegBinomial_v_370;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_371> AgradDistributionsBetaNegBinomial_v_371;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_372> AgradDistributionsBetaNegBinomial_v_372;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_373> AgradDistributionsBetaNegBinomial_v_373;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_374> AgradDistributionsBetaNegBinomial_v_374;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_375> AgradDistributionsBetaNegBinomial_v_375;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_376> AgradDistributionsBetaNegBinomial_v_376;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_377> AgradDistributionsBetaNegBinomial_v_377;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_378> AgradDistributionsBetaNegBinomial_v_378;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_379> AgradDistributionsBetaNegBinomial_v_379;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_380> AgradDistributionsBetaNegBinomial_v_380;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_381> AgradDistributionsBetaNegBinomial_v_381;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_382> AgradDistributionsBetaNegBinomial_v_382;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_383> AgradDistributionsBetaNegBinomial_v_383;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_384> AgradDistributionsBetaNegBinomial_v_384;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_385> AgradDistributionsBetaNegBinomial_v_385;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_386> AgradDistributionsBetaNegBinomial_v_386;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_387> AgradDistributionsBetaNegBinomial_v_387;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_388> AgradDistributionsBetaNegBinomial_v_388;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_389> AgradDistributionsBetaNegBinomial_v_389;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_390> AgradDistributionsBetaNegBinomial_v_390;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_391> AgradDistributionsBetaNegBinomial_v_391;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_392> AgradDistributionsBetaNegBinomial_v_392;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_393> AgradDistributionsBetaNegBinomial_v_393;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_394> AgradDistributionsBetaNegBinomial_v_394;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_395> AgradDistributionsBetaNegBinomial_v_395;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_396> AgradDistributionsBetaNegBinomial_v_396;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_397> AgradDistributionsBetaNegBinomial_v_397;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_398> AgradDistributionsBetaNegBinomial_v_398;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_399> AgradDistributionsBetaNegBinomial_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_300, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_301, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_302, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_303, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_304, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_305, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_306, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_307, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_308, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_309, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_310, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_311, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_312, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_313, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_314, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_315, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_316, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_317, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_318, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_319, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_320, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_321, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_322, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_323, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_324, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_325, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_326, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_327, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_328, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_329, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_330, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_331, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_332, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_333, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_334, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_335, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_336, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_337, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_338, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_339, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_340, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_341, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_342, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_343, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_344, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_345, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_346, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_347, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_348, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_349, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_350, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_351, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_352, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_353, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_354, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_355, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_356, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_357, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_358, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_359, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_360, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_361, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_362, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_363, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_364, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_365, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_366, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_367, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_368, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_369, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_370, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_371, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_372, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_373, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_374, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_375, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_376, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_377, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_378, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_379, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_380, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_381, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_382, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_383, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_384, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_385, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_386, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_387, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_388, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_389, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_390, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_391, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_392, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_393, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_394, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_395, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_396, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_397, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_398, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_399, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_300> AgradDistributionsBetaNegBinomial_vv_300;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_301> AgradDistributionsBetaNegBinomial_vv_301;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_302> AgradDistributionsBetaNegBinomial_vv_302;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_303> AgradDistributionsBetaNegBinomial_vv_303;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_304> AgradDistributionsBetaNegBinomial_vv_304;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_305> AgradDistributionsBetaNegBinomial_vv_305;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_306> AgradDistributionsBetaNegBinomial_vv_306;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_307> AgradDistributionsBetaNegBinomial_vv_307;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_308> AgradDistributionsBetaNegBinomial_vv_308;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_309> AgradDistributionsBetaNegBinomial_vv_309;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_310> AgradDistributionsBetaNegBinomial_vv_310;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_311> AgradDistributionsBetaNegBinomial_vv_311;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_312> AgradDistributionsBetaNegBinomial_vv_312;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_313> AgradDistributionsBetaNegBinomial_vv_313;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_314> AgradDistributionsBetaNegBinomial_vv_314;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_315> AgradDistributionsBetaNegBinomial_vv_315;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_316> AgradDistributionsBetaNegBinomial_vv_316;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_317> AgradDistributionsBetaNegBinomial_vv_317;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_318> AgradDistributionsBetaNegBinomial_vv_318;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_319> AgradDistributionsBetaNegBinomial_vv_319;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_320> AgradDistributionsBetaNegBinomial_vv_320;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_321> AgradDistributionsBetaNegBinomial_vv_321;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_322> AgradDistributionsBetaNegBinomial_vv_322;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_323> AgradDistributionsBetaNegBinomial_vv_323;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_324> AgradDistributionsBetaNegBinomial_vv_324;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_325> AgradDistributionsBetaNegBinomial_vv_325;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_326> AgradDistributionsBetaNegBinomial_vv_326;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_327> AgradDistributionsBetaNegBinomial_vv_327;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_328> AgradDistributionsBetaNegBinomial_vv_328;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_329> AgradDistributionsBetaNegBinomial_vv_329;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_330> AgradDistributionsBetaNegBinomial_vv_330;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_331> AgradDistributionsBetaNegBinomial_vv_331;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_332> AgradDistributionsBetaNegBinomial_vv_332;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_333> AgradDistributionsBetaNegBinomial_vv_333;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_334> AgradDistributionsBetaNegBinomial_vv_334;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_335> AgradDistributionsBetaNegBinomial_vv_335;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_336> AgradDistributionsBetaNegBinomial_vv_336;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_337> AgradDistributionsBetaNegBinomial_vv_337;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_338> AgradDistributionsBetaNegBinomial_vv_338;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_339> AgradDistributionsBetaNegBinomial_vv_339;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_340> AgradDistributionsBetaNegBinomial_vv_340;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_341> AgradDistributionsBetaNegBinomial_vv_341;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_342> AgradDistributionsBetaNegBinomial_vv_342;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_343> AgradDistributionsBetaNegBinomial_vv_343;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_344> AgradDistributionsBetaNegBinomial_vv_344;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_345> AgradDistributionsBetaNegBinomial_vv_345;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_346> AgradDistributionsBetaNegBinomial_vv_346;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_347> AgradDistributionsBetaNegBinomial_vv_347;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_348> AgradDistributionsBetaNegBinomial_vv_348;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_349> AgradDistributionsBetaNegBinomial_vv_349;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_350> AgradDistributionsBetaNegBinomial_vv_350;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_351> AgradDistributionsBetaNegBinomial_vv_351;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_352> AgradDistributionsBetaNegBinomial_vv_352;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_353> AgradDistributionsBetaNegBinomial_vv_353;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_354> AgradDistributionsBetaNegBinomial_vv_354;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_355> AgradDistributionsBetaNegBinomial_vv_355;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_356> AgradDistributionsBetaNegBinomial_vv_356;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_357> AgradDistributionsBetaNegBinomial_vv_357;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_358> AgradDistributionsBetaNegBinomial_vv_358;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_359> AgradDistributionsBetaNegBinomial_vv_359;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_360> AgradDistributionsBetaNegBinomial_vv_360;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_361> AgradDistributionsBetaNegBinomial_vv_361;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_362> AgradDistributionsBetaNegBinomial_vv_362;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_363> AgradDistributionsBetaNegBinomial_vv_363;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_364> AgradDistributionsBetaNegBinomial_vv_364;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_365> AgradDistributionsBetaNegBinomial_vv_365;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_366> AgradDistributionsBetaNegBinomial_vv_366;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_367> AgradDistributionsBetaNegBinomial_vv_367;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_368> AgradDistributionsBetaNegBinomial_vv_368;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_369> AgradDistributionsBetaNegBinomial_vv_369;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_370> AgradDistributionsBetaNegBinomial_vv_370;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_371> AgradDistributionsBetaNegBinomial_vv_371;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_372> AgradDistributionsBetaNegBinomial_vv_372;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_373> AgradDistributionsBetaNegBinomial_vv_373;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_374> AgradDistributionsBetaNegBinomial_vv_374;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_375> AgradDistributionsBetaNegBinomial_vv_375;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_376> AgradDistributionsBetaNegBinomial_vv_376;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_377> AgradDistributionsBetaNegBinomial_vv_377;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_378> AgradDistributionsBetaNegBinomial_vv_378;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_379> AgradDistributionsBetaNegBinomial_vv_379;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_380> AgradDistributionsBetaNegBinomial_vv_380;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_381> AgradDistributionsBetaNegBinomial_vv_381;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_382> AgradDistributionsBetaNegBinomial_vv_382;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_383> AgradDistributionsBetaNegBinomial_vv_383;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_384> AgradDistributionsBetaNegBinomial_vv_384;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_385> AgradDistributionsBetaNegBinomial_vv_385;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_386> AgradDistributionsBetaNegBinomial_vv_386;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_387> AgradDistributionsBetaNegBinomial_vv_387;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_388> AgradDistributionsBetaNegBinomial_vv_388;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_389> AgradDistributionsBetaNegBinomial_vv_389;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_390> AgradDistributionsBetaNegBinomial_vv_390;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_391> AgradDistributionsBetaNegBinomial_vv_391;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_392> AgradDistributionsBetaNegBinomial_vv_392;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_393> AgradDistributionsBetaNegBinomial_vv_393;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_394> AgradDistributionsBetaNegBinomial_vv_394;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_395> AgradDistributionsBetaNegBinomial_vv_395;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_396> AgradDistributionsBetaNegBinomial_vv_396;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_397> AgradDistributionsBetaNegBinomial_vv_397;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_398> AgradDistributionsBetaNegBinomial_vv_398;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_399> AgradDistributionsBetaNegBinomial_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_300, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_301, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_302, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_303, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_304, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_305, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_306, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_307, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_308, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_309, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_310, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_311, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_312, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_313, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_314, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_315, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_316, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_317, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_318, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_319, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_320, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_321, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_322, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_323, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_324, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_325, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_326, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_327, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_328, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_329, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_330, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_331, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_332, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_333, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_334, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_335, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_336, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_337, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_338, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_339, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_340, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_341, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_342, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_343, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_344, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_345, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_346, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_347, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_348, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_349, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_350, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_351, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_352, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_353, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_354, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_355, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_356, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_357, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_358, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_359, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_360, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_361, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_362, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_363, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_364, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_365, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_366, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_367, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_368, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_369, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_370, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_371, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_372, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_373, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_374, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_375, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_376, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_377, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_378, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_379, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_380, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_381, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_382, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_383, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_384, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_385, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_386, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_387, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_388, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_389, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_390, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_391, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_392, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_393, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_394, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_395, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_396, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_397, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_398, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_399, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_400> AgradDistributionsBetaNegBinomial_ffv_400;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_401> AgradDistributionsBetaNegBinomial_ffv_401;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_402> AgradDistributionsBetaNegBinomial_ffv_402;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_403> AgradDistributionsBetaNegBinomial_ffv_403;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_404> AgradDistributionsBetaNegBinomial_ffv_404;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_405> AgradDistributionsBetaNegBinomial_ffv_405;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_406> AgradDistributionsBetaNegBinomial_ffv_406;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_407> AgradDistributionsBetaNegBinomial_ffv_407;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_408> AgradDistributionsBetaNegBinomial_ffv_408;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_409> AgradDistributionsBetaNegBinomial_ffv_409;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_410> AgradDistributionsBetaNegBinomial_ffv_410;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_411> AgradDistributionsBetaNegBinomial_ffv_411;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_412> AgradDistributionsBetaNegBinomial_ffv_412;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_413> AgradDistributionsBetaNegBinomial_ffv_413;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_414> AgradDistributionsBetaNegBinomial_ffv_414;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_415> AgradDistributionsBetaNegBinomial_ffv_415;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_416> AgradDistributionsBetaNegBinomial_ffv_416;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_417> AgradDistributionsBetaNegBinomial_ffv_417;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_418> AgradDistributionsBetaNegBinomial_ffv_418;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_419> AgradDistributionsBetaNegBinomial_ffv_419;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_420> AgradDistributionsBetaNegBinomial_ffv_420;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_421> AgradDistributionsBetaNegBinomial_ffv_421;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_422> AgradDistributionsBetaNegBinomial_ffv_422;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_423> AgradDistributionsBetaNegBinomial_ffv_423;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_424> AgradDistributionsBetaNegBinomial_ffv_424;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_425> AgradDistributionsBetaNegBinomial_ffv_425;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_426> AgradDistributionsBetaNegBinomial_ffv_426;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_427> AgradDistributionsBetaNegBinomial_ffv_427;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_428> AgradDistributionsBetaNegBinomial_ffv_428;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_429> AgradDistributionsBetaNegBinomial_ffv_429;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_430> AgradDistributionsBetaNegBinomial_ffv_430;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_431> AgradDistributionsBetaNegBinomial_ffv_431;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_432> AgradDistributionsBetaNegBinomial_ffv_432;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_433> AgradDistributionsBetaNegBinomial_ffv_433;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_434> AgradDistributionsBetaNegBinomial_ffv_434;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_435> AgradDistributionsBetaNegBinomial_ffv_435;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_436> AgradDistributionsBetaNegBinomial_ffv_436;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_437> AgradDistributionsBetaNegBinomial_ffv_437;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_438> AgradDistributionsBetaNegBinomial_ffv_438;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_439> AgradDistributionsBetaNegBinomial_ffv_439;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_440> AgradDistributionsBetaNegBinomial_ffv_440;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_441> AgradDistributionsBetaNegBinomial_ffv_441;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_442> AgradDistributionsBetaNegBinomial_ffv_442;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_443> AgradDistributionsBetaNegBinomial_ffv_443;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_444> AgradDistributionsBetaNegBinomial_ffv_444;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_445> AgradDistributionsBetaNegBinomial_ffv_445;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_446> AgradDistributionsBetaNegBinomial_ffv_446;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_447> AgradDistributionsBetaNegBinomial_ffv_447;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_448> AgradDistributionsBetaNegBinomial_ffv_448;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_449> AgradDistributionsBetaNegBinomial_ffv_449;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_450> AgradDistributionsBetaNegBinomial_ffv_450;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_451> AgradDistributionsBetaNegBinomial_ffv_451;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_452> AgradDistributionsBetaNegBinomial_ffv_452;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_453> AgradDistributionsBetaNegBinomial_ffv_453;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_454> AgradDistributionsBetaNegBinomial_ffv_454;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_455> AgradDistributionsBetaNegBinomial_ffv_455;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_456> AgradDistributionsBetaNegBinomial_ffv_456;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_457> AgradDistributionsBetaNegBinomial_ffv_457;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_458> AgradDistributionsBetaNegBinomial_ffv_458;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_459> AgradDistributionsBetaNegBinomial_ffv_459;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_460> AgradDistributionsBetaNegBinomial_ffv_460;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_461> AgradDistributionsBetaNegBinomial_ffv_461;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_462> AgradDistributionsBetaNegBinomial_ffv_462;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_463> AgradDistributionsBetaNegBinomial_ffv_463;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_464> AgradDistributionsBetaNegBinomial_ffv_464;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_465> AgradDistributionsBetaNegBinomial_ffv_465;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_466> AgradDistributionsBetaNegBinomial_ffv_466;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_467> AgradDistributionsBetaNegBinomial_ffv_467;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_468> AgradDistributionsBetaNegBinomial_ffv_468;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_469> AgradDistributionsBetaNegBinomial_ffv_469;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_470> AgradDistributionsBetaNegBinomial_ffv_470;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_471> AgradDistributionsBetaNegBinomial_ffv_471;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_472> AgradDistributionsBetaNegBinomial_ffv_472;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_473> AgradDistributionsBetaNegBinomial_ffv_473;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_474> AgradDistributionsBetaNegBinomial_ffv_474;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_475> AgradDistributionsBetaNegBinomial_ffv_475;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_476> AgradDistributionsBetaNegBinomial_ffv_476;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_477> AgradDistributionsBetaNegBinomial_ffv_477;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_478> AgradDistributionsBetaNegBinomial_ffv_478;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_479> AgradDistributionsBetaNegBinomial_ffv_479;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_480> AgradDistributionsBetaNegBinomial_ffv_480;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_481> AgradDistributionsBetaNegBinomial_ffv_481;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_482> AgradDistributionsBetaNegBinomial_ffv_482;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_483> AgradDistributionsBetaNegBinomial_ffv_483;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_484> AgradDistributionsBetaNegBinomial_ffv_484;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_485> AgradDistributionsBetaNegBinomial_ffv_485;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_486> AgradDistributionsBetaNegBinomial_ffv_486;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_487> AgradDistributionsBetaNegBinomial_ffv_487;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_488> AgradDistributionsBetaNegBinomial_ffv_488;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_489> AgradDistributionsBetaNegBinomial_ffv_489;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_490> AgradDistributionsBetaNegBinomial_ffv_490;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_491> AgradDistributionsBetaNegBinomial_ffv_491;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_492> AgradDistributionsBetaNegBinomial_ffv_492;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_493> AgradDistributionsBetaNegBinomial_ffv_493;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_494> AgradDistributionsBetaNegBinomial_ffv_494;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_495> AgradDistributionsBetaNegBinomial_ffv_495;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_496> AgradDistributionsBetaNegBinomial_ffv_496;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_497> AgradDistributionsBetaNegBinomial_ffv_497;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_498> AgradDistributionsBetaNegBinomial_ffv_498;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_499> AgradDistributionsBetaNegBinomial_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_400, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_401, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_402, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_403, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_404, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_405, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_406, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_407, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_408, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_409, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_410, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_411, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_412, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_413, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_414, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_415, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_416, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_417, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_418, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_419, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_420, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_421, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_422, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_423, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_424, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_425, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_426, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_427, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_428, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_429, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_430, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_431, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_432, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_433, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_434, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_435, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_436, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_437, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_438, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_439, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_440, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_441, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_442, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_443, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_444, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_445, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_446, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_447, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_448, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_449, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_450, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_451, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_452, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_453, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_454, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_455, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_456, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_457, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_458, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_459, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_460, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_461, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_462, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_463, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_464, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_465, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_466, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_467, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_468, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_469, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_470, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_471, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_472, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_473, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_474, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_475, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_476, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_477, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_478, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_479, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_480, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_481, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_482, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_483, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_484, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_485, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_486, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_487, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_488, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_489, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_490, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_491, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_492, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_493, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_494, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_495, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_496, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_497, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_498, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_499, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_400> AgradDistributionsBetaNegBinomial_v_400;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_401> AgradDistributionsBetaNegBinomial_v_401;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_402> AgradDistributionsBetaNegBinomial_v_402;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_403> AgradDistributionsBetaNegBinomial_v_403;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_404> AgradDistributionsBetaNegBinomial_v_404;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_405> AgradDistributionsBetaNegBinomial_v_405;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_406> AgradDistributionsBetaNegBinomial_v_406;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_407> AgradDistributionsBetaNegBinomial_v_407;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_408> AgradDistributionsBetaNegBinomial_v_408;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_409> AgradDistributionsBetaNegBinomial_v_409;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_410> AgradDistributionsBetaNegBinomial_v_410;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_411> AgradDistributionsBetaNegBinomial_v_411;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_412> AgradDistributionsBetaNegBinomial_v_412;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_413> AgradDistributionsBetaNegBinomial_v_413;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_414> AgradDistributionsBetaNegBinomial_v_414;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_415> AgradDistributionsBetaNegBinomial_v_415;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_416> AgradDistributionsBetaNegBinomial_v_416;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_417> AgradDistributionsBetaNegBinomial_v_417;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_418> AgradDistributionsBetaNegBinomial_v_418;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_419> AgradDistributionsBetaNegBinomial_v_419;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_420> AgradDistributionsBetaNegBinomial_v_420;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_421> AgradDistributionsBetaNegBinomial_v_421;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_422> AgradDistributionsBetaNegBinomial_v_422;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_423> AgradDistributionsBetaNegBinomial_v_423;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_424> AgradDistributionsBetaNegBinomial_v_424;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_425> AgradDistributionsBetaNegBinomial_v_425;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_426> AgradDistributionsBetaNegBinomial_v_426;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_427> AgradDistributionsBetaNegBinomial_v_427;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_428> AgradDistributionsBetaNegBinomial_v_428;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_429> AgradDistributionsBetaNegBinomial_v_429;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_430> AgradDistributionsBetaNegBinomial_v_430;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_431> AgradDistributionsBetaNegBinomial_v_431;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_432> AgradDistributionsBetaNegBinomial_v_432;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_433> AgradDistributionsBetaNegBinomial_v_433;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_434> AgradDistributionsBetaNegBinomial_v_434;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_435> AgradDistributionsBetaNegBinomial_v_435;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_436> AgradDistributionsBetaNegBinomial_v_436;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_437> AgradDistributionsBetaNegBinomial_v_437;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_438> AgradDistributionsBetaNegBinomial_v_438;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_439> AgradDistributionsBetaNegBinomial_v_439;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_440> AgradDistributionsBetaNegBinomial_v_440;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_441> AgradDistributionsBetaNegBinomial_v_441;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_442> AgradDistributionsBetaNegBinomial_v_442;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_443> AgradDistributionsBetaNegBinomial_v_443;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_444> AgradDistributionsBetaNegBinomial_v_444;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_445> AgradDistributionsBetaNegBinomial_v_445;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_446> AgradDistributionsBetaNegBinomial_v_446;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_447> AgradDistributionsBetaNegBinomial_v_447;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_448> AgradDistributionsBetaNegBinomial_v_448;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_449> AgradDistributionsBetaNegBinomial_v_449;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_450> AgradDistributionsBetaNegBinomial_v_450;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_451> AgradDistributionsBetaNegBinomial_v_451;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_452> AgradDistributionsBetaNegBinomial_v_452;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_453> AgradDistributionsBetaNegBinomial_v_453;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_454> AgradDistributionsBetaNegBinomial_v_454;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_455> AgradDistributionsBetaNegBinomial_v_455;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_456> AgradDistributionsBetaNegBinomial_v_456;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_457> AgradDistributionsBetaNegBinomial_v_457;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_458> AgradDistributionsBetaNegBinomial_v_458;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_459> AgradDistributionsBetaNegBinomial_v_459;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_460> AgradDistributionsBetaNegBinomial_v_460;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_461> AgradDistributionsBetaNegBinomial_v_461;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_462> AgradDistributionsBetaNegBinomial_v_462;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_463> AgradDistributionsBetaNegBinomial_v_463;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_464> AgradDistributionsBetaNegBinomial_v_464;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_465> AgradDistributionsBetaNegBinomial_v_465;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_466> AgradDistributionsBetaNegBinomial_v_466;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_467> AgradDistributionsBetaNegBinomial_v_467;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_468> AgradDistributionsBetaNegBinomial_v_468;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_469> AgradDistributionsBetaNegBinomial_v_469;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_470> AgradDistributionsBetaNegBinomial_v_470;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_471> AgradDistributionsBetaNegBinomial_v_471;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_472> AgradDistributionsBetaNegBinomial_v_472;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_473> AgradDistributionsBetaNegBinomial_v_473;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_474> AgradDistributionsBetaNegBinomial_v_474;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_475> AgradDistributionsBetaNegBinomial_v_475;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_476> AgradDistributionsBetaNegBinomial_v_476;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_477> AgradDistributionsBetaNegBinomial_v_477;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_478> AgradDistributionsBetaNegBinomial_v_478;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_479> AgradDistributionsBetaNegBinomial_v_479;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_480> AgradDistributionsBetaNegBinomial_v_480;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_481> AgradDistributionsBetaNegBinomial_v_481;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_482> AgradDistributionsBetaNegBinomial_v_482;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_483> AgradDistributionsBetaNegBinomial_v_483;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_484> AgradDistributionsBetaNegBinomial_v_484;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_485> AgradDistributionsBetaNegBinomial_v_485;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_486> AgradDistributionsBetaNegBinomial_v_486;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_487> AgradDistributionsBetaNegBinomial_v_487;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_488> AgradDistributionsBetaNegBinomial_v_488;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_489> AgradDistributionsBetaNegBinomial_v_489;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_490> AgradDistributionsBetaNegBinomial_v_490;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_491> AgradDistributionsBetaNegBinomial_v_491;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_492> AgradDistributionsBetaNegBinomial_v_492;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_493> AgradDistributionsBetaNegBinomial_v_493;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_494> AgradDistributionsBetaNegBinomial_v_494;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_495> AgradDistributionsBetaNegBinomial_v_495;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_496> AgradDistributionsBetaNegBinomial_v_496;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_497> AgradDistributionsBetaNegBinomial_v_497;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_498> AgradDistributionsBetaNegBinomial_v_498;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_499> AgradDistributionsBetaNegBinomial_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_400, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_401, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_402, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_403, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_404, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_405, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_406, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_407, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_408, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_409, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_410, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_411, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_412, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_413, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_414, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_415, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_416, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_417, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_418, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_419, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_420, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_421, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_422, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_423, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_424, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_425, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_426, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_427, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_428, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_429, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_430, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_431, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_432, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_433, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_434, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_435, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_436, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_437, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_438, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_439, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_440, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_441, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_442, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_443, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_444, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_445, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_446, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_447, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_448, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_449, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_450, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_451, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_452, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_453, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_454, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_455, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_456, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_457, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_458, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_459, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_460, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_461, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_462, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_463, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_464, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_465, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_466, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_467, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_468, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_469, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_470, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_471, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_472, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_473, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_474, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_475, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_476, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_477, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_478, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_479, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_480, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_481, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_482, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_483, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_484, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_485, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_486, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_487, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_488, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_489, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_490, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_491, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_492, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_493, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_494, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_495, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_496, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_497, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_498, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_499, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_499);
+
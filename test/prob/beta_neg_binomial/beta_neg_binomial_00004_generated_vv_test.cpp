@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_400> AgradDistributionsBetaNegBinomial_vv_400;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_401> AgradDistributionsBetaNegBinomial_vv_401;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_402> AgradDistributionsBetaNegBinomial_vv_402;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_403> AgradDistributionsBetaNegBinomial_vv_403;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_404> AgradDistributionsBetaNegBinomial_vv_404;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_405> AgradDistributionsBetaNegBinomial_vv_405;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_406> AgradDistributionsBetaNegBinomial_vv_406;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_407> AgradDistributionsBetaNegBinomial_vv_407;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_408> AgradDistributionsBetaNegBinomial_vv_408;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_409> AgradDistributionsBetaNegBinomial_vv_409;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_410> AgradDistributionsBetaNegBinomial_vv_410;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_411> AgradDistributionsBetaNegBinomial_vv_411;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_412> AgradDistributionsBetaNegBinomial_vv_412;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_413> AgradDistributionsBetaNegBinomial_vv_413;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_414> AgradDistributionsBetaNegBinomial_vv_414;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_415> AgradDistributionsBetaNegBinomial_vv_415;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_416> AgradDistributionsBetaNegBinomial_vv_416;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_417> AgradDistributionsBetaNegBinomial_vv_417;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_418> AgradDistributionsBetaNegBinomial_vv_418;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_419> AgradDistributionsBetaNegBinomial_vv_419;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_420> AgradDistributionsBetaNegBinomial_vv_420;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_421> AgradDistributionsBetaNegBinomial_vv_421;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_422> AgradDistributionsBetaNegBinomial_vv_422;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_423> AgradDistributionsBetaNegBinomial_vv_423;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_424> AgradDistributionsBetaNegBinomial_vv_424;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_425> AgradDistributionsBetaNegBinomial_vv_425;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_426> AgradDistributionsBetaNegBinomial_vv_426;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_427> AgradDistributionsBetaNegBinomial_vv_427;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_428> AgradDistributionsBetaNegBinomial_vv_428;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_429> AgradDistributionsBetaNegBinomial_vv_429;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_430> AgradDistributionsBetaNegBinomial_vv_430;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_431> AgradDistributionsBetaNegBinomial_vv_431;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_432> AgradDistributionsBetaNegBinomial_vv_432;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_433> AgradDistributionsBetaNegBinomial_vv_433;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_434> AgradDistributionsBetaNegBinomial_vv_434;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_435> AgradDistributionsBetaNegBinomial_vv_435;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_436> AgradDistributionsBetaNegBinomial_vv_436;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_437> AgradDistributionsBetaNegBinomial_vv_437;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_438> AgradDistributionsBetaNegBinomial_vv_438;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_439> AgradDistributionsBetaNegBinomial_vv_439;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_440> AgradDistributionsBetaNegBinomial_vv_440;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_441> AgradDistributionsBetaNegBinomial_vv_441;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_442> AgradDistributionsBetaNegBinomial_vv_442;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_443> AgradDistributionsBetaNegBinomial_vv_443;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_444> AgradDistributionsBetaNegBinomial_vv_444;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_445> AgradDistributionsBetaNegBinomial_vv_445;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_446> AgradDistributionsBetaNegBinomial_vv_446;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_447> AgradDistributionsBetaNegBinomial_vv_447;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_448> AgradDistributionsBetaNegBinomial_vv_448;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_449> AgradDistributionsBetaNegBinomial_vv_449;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_450> AgradDistributionsBetaNegBinomial_vv_450;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_451> AgradDistributionsBetaNegBinomial_vv_451;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_452> AgradDistributionsBetaNegBinomial_vv_452;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_453> AgradDistributionsBetaNegBinomial_vv_453;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_454> AgradDistributionsBetaNegBinomial_vv_454;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_455> AgradDistributionsBetaNegBinomial_vv_455;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_456> AgradDistributionsBetaNegBinomial_vv_456;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_457> AgradDistributionsBetaNegBinomial_vv_457;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_458> AgradDistributionsBetaNegBinomial_vv_458;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_459> AgradDistributionsBetaNegBinomial_vv_459;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_460> AgradDistributionsBetaNegBinomial_vv_460;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_461> AgradDistributionsBetaNegBinomial_vv_461;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_462> AgradDistributionsBetaNegBinomial_vv_462;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_463> AgradDistributionsBetaNegBinomial_vv_463;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_464> AgradDistributionsBetaNegBinomial_vv_464;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_465> AgradDistributionsBetaNegBinomial_vv_465;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_466> AgradDistributionsBetaNegBinomial_vv_466;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_467> AgradDistributionsBetaNegBinomial_vv_467;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_468> AgradDistributionsBetaNegBinomial_vv_468;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_469> AgradDistributionsBetaNegBinomial_vv_469;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_470> AgradDistributionsBetaNegBinomial_vv_470;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_471> AgradDistributionsBetaNegBinomial_vv_471;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_472> AgradDistributionsBetaNegBinomial_vv_472;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_473> AgradDistributionsBetaNegBinomial_vv_473;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_474> AgradDistributionsBetaNegBinomial_vv_474;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_475> AgradDistributionsBetaNegBinomial_vv_475;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_476> AgradDistributionsBetaNegBinomial_vv_476;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_477> AgradDistributionsBetaNegBinomial_vv_477;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_478> AgradDistributionsBetaNegBinomial_vv_478;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_479> AgradDistributionsBetaNegBinomial_vv_479;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_480> AgradDistributionsBetaNegBinomial_vv_480;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_481> AgradDistributionsBetaNegBinomial_vv_481;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_482> AgradDistributionsBetaNegBinomial_vv_482;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_483> AgradDistributionsBetaNegBinomial_vv_483;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_484> AgradDistributionsBetaNegBinomial_vv_484;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_485> AgradDistributionsBetaNegBinomial_vv_485;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_486> AgradDistributionsBetaNegBinomial_vv_486;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_487> AgradDistributionsBetaNegBinomial_vv_487;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_488> AgradDistributionsBetaNegBinomial_vv_488;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_489> AgradDistributionsBetaNegBinomial_vv_489;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_490> AgradDistributionsBetaNegBinomial_vv_490;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_491> AgradDistributionsBetaNegBinomial_vv_491;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_492> AgradDistributionsBetaNegBinomial_vv_492;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_493> AgradDistributionsBetaNegBinomial_vv_493;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_494> AgradDistributionsBetaNegBinomial_vv_494;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_495> AgradDistributionsBetaNegBinomial_vv_495;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_496> AgradDistributionsBetaNegBinomial_vv_496;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_497> AgradDistributionsBetaNegBinomial_vv_497;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_498> AgradDistributionsBetaNegBinomial_vv_498;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_499> AgradDistributionsBetaNegBinomial_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_400, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_401, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_402, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_403, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_404, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_405, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_406, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_407, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_408, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_409, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_410, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_411, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_412, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_413, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_414, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_415, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_416, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_417, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_418, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_419, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_420, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_421, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_422, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_423, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_424, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_425, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_426, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_427, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_428, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_429, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_430, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_431, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_432, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_433, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_434, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_435, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_436, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_437, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_438, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_439, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_440, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_441, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_442, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_443, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_444, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_445, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_446, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_447, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_448, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_449, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_450, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_451, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_452, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_453, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_454, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_455, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_456, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_457, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_458, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_459, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_460, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_461, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_462, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_463, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_464, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_465, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_466, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_467, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_468, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_469, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_470, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_471, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_472, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_473, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_474, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_475, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_476, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_477, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_478, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_479, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_480, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_481, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_482, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_483, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_484, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_485, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_486, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_487, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_488, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_489, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_490, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_491, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_492, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_493, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_494, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_495, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_496, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_497, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_498, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_499, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_499);
+
@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_500> AgradDistributionsBetaNegBinomial_ffv_500;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_501> AgradDistributionsBetaNegBinomial_ffv_501;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_502> AgradDistributionsBetaNegBinomial_ffv_502;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_503> AgradDistributionsBetaNegBinomial_ffv_503;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_504> AgradDistributionsBetaNegBinomial_ffv_504;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_505> AgradDistributionsBetaNegBinomial_ffv_505;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_506> AgradDistributionsBetaNegBinomial_ffv_506;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_507> AgradDistributionsBetaNegBinomial_ffv_507;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_508> AgradDistributionsBetaNegBinomial_ffv_508;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_509> AgradDistributionsBetaNegBinomial_ffv_509;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_510> AgradDistributionsBetaNegBinomial_ffv_510;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_511> AgradDistributionsBetaNegBinomial_ffv_511;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_512> AgradDistributionsBetaNegBinomial_ffv_512;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_513> AgradDistributionsBetaNegBinomial_ffv_513;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_514> AgradDistributionsBetaNegBinomial_ffv_514;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_515> AgradDistributionsBetaNegBinomial_ffv_515;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_516> AgradDistributionsBetaNegBinomial_ffv_516;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_517> AgradDistributionsBetaNegBinomial_ffv_517;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_518> AgradDistributionsBetaNegBinomial_ffv_518;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_519> AgradDistributionsBetaNegBinomial_ffv_519;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_520> AgradDistributionsBetaNegBinomial_ffv_520;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_521> AgradDistributionsBetaNegBinomial_ffv_521;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_522> AgradDistributionsBetaNegBinomial_ffv_522;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_523> AgradDistributionsBetaNegBinomial_ffv_523;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_524> AgradDistributionsBetaNegBinomial_ffv_524;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_525> AgradDistributionsBetaNegBinomial_ffv_525;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_526> AgradDistributionsBetaNegBinomial_ffv_526;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_527> AgradDistributionsBetaNegBinomial_ffv_527;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_528> AgradDistributionsBetaNegBinomial_ffv_528;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_529> AgradDistributionsBetaNegBinomial_ffv_529;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_530> AgradDistributionsBetaNegBinomial_ffv_530;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_531> AgradDistributionsBetaNegBinomial_ffv_531;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_532> AgradDistributionsBetaNegBinomial_ffv_532;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_533> AgradDistributionsBetaNegBinomial_ffv_533;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_534> AgradDistributionsBetaNegBinomial_ffv_534;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_535> AgradDistributionsBetaNegBinomial_ffv_535;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_536> AgradDistributionsBetaNegBinomial_ffv_536;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_537> AgradDistributionsBetaNegBinomial_ffv_537;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_538> AgradDistributionsBetaNegBinomial_ffv_538;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_539> AgradDistributionsBetaNegBinomial_ffv_539;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_540> AgradDistributionsBetaNegBinomial_ffv_540;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_541> AgradDistributionsBetaNegBinomial_ffv_541;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_542> AgradDistributionsBetaNegBinomial_ffv_542;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_543> AgradDistributionsBetaNegBinomial_ffv_543;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_544> AgradDistributionsBetaNegBinomial_ffv_544;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_545> AgradDistributionsBetaNegBinomial_ffv_545;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_546> AgradDistributionsBetaNegBinomial_ffv_546;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_547> AgradDistributionsBetaNegBinomial_ffv_547;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_548> AgradDistributionsBetaNegBinomial_ffv_548;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_549> AgradDistributionsBetaNegBinomial_ffv_549;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_550> AgradDistributionsBetaNegBinomial_ffv_550;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_551> AgradDistributionsBetaNegBinomial_ffv_551;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_552> AgradDistributionsBetaNegBinomial_ffv_552;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_553> AgradDistributionsBetaNegBinomial_ffv_553;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_554> AgradDistributionsBetaNegBinomial_ffv_554;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_555> AgradDistributionsBetaNegBinomial_ffv_555;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_556> AgradDistributionsBetaNegBinomial_ffv_556;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_557> AgradDistributionsBetaNegBinomial_ffv_557;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_558> AgradDistributionsBetaNegBinomial_ffv_558;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_559> AgradDistributionsBetaNegBinomial_ffv_559;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_560> AgradDistributionsBetaNegBinomial_ffv_560;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_561> AgradDistributionsBetaNegBinomial_ffv_561;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_562> AgradDistributionsBetaNegBinomial_ffv_562;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_563> AgradDistributionsBetaNegBinomial_ffv_563;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_564> AgradDistributionsBetaNegBinomial_ffv_564;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_565> AgradDistributionsBetaNegBinomial_ffv_565;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_ffv_566> AgradDistributionsBetaNegBinomial_ffv_566;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_500, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_501, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_502, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_503, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_504, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_505, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_506, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_507, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_508, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_509, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_510, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_511, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_512, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_513, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_514, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_515, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_516, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_517, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_518, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_519, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_520, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_521, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_522, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_523, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_524, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_525, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_526, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_527, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_528, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_529, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_530, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_531, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_532, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_533, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_534, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_535, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_536, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_537, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_538, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_539, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_540, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_541, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_542, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_543, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_544, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_545, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_546, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_547, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_548, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_549, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_550, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_551, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_552, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_553, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_554, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_555, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_556, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_557, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_558, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_559, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_560, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_561, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_562, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_563, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_564, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_565, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_ffv_566, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_ffv_566);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_500> AgradDistributionsBetaNegBinomial_v_500;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_501> AgradDistributionsBetaNegBinomial_v_501;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_502> AgradDistributionsBetaNegBinomial_v_502;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_503> AgradDistributionsBetaNegBinomial_v_503;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_504> AgradDistributionsBetaNegBinomial_v_504;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_505> AgradDistributionsBetaNegBinomial_v_505;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_506> AgradDistributionsBetaNegBinomial_v_506;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_507> AgradDistributionsBetaNegBinomial_v_507;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_508> AgradDistributionsBetaNegBinomial_v_508;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_509> AgradDistributionsBetaNegBinomial_v_509;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_510> AgradDistributionsBetaNegBinomial_v_510;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_511> AgradDistributionsBetaNegBinomial_v_511;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_512> AgradDistributionsBetaNegBinomial_v_512;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_513> AgradDistributionsBetaNegBinomial_v_513;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_514> AgradDistributionsBetaNegBinomial_v_514;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_515> AgradDistributionsBetaNegBinomial_v_515;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_516> AgradDistributionsBetaNegBinomial_v_516;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_517> AgradDistributionsBetaNegBinomial_v_517;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_518> AgradDistributionsBetaNegBinomial_v_518;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_519> AgradDistributionsBetaNegBinomial_v_519;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_520> AgradDistributionsBetaNegBinomial_v_520;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_521> AgradDistributionsBetaNegBinomial_v_521;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_522> AgradDistributionsBetaNegBinomial_v_522;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_523> AgradDistributionsBetaNegBinomial_v_523;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_524> AgradDistributionsBetaNegBinomial_v_524;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_525> AgradDistributionsBetaNegBinomial_v_525;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_526> AgradDistributionsBetaNegBinomial_v_526;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_527> AgradDistributionsBetaNegBinomial_v_527;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_528> AgradDistributionsBetaNegBinomial_v_528;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_529> AgradDistributionsBetaNegBinomial_v_529;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_530> AgradDistributionsBetaNegBinomial_v_530;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_531> AgradDistributionsBetaNegBinomial_v_531;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_532> AgradDistributionsBetaNegBinomial_v_532;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_533> AgradDistributionsBetaNegBinomial_v_533;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_534> AgradDistributionsBetaNegBinomial_v_534;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_535> AgradDistributionsBetaNegBinomial_v_535;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_536> AgradDistributionsBetaNegBinomial_v_536;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_537> AgradDistributionsBetaNegBinomial_v_537;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_538> AgradDistributionsBetaNegBinomial_v_538;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_539> AgradDistributionsBetaNegBinomial_v_539;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_540> AgradDistributionsBetaNegBinomial_v_540;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_541> AgradDistributionsBetaNegBinomial_v_541;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_542> AgradDistributionsBetaNegBinomial_v_542;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_543> AgradDistributionsBetaNegBinomial_v_543;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_544> AgradDistributionsBetaNegBinomial_v_544;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_545> AgradDistributionsBetaNegBinomial_v_545;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_546> AgradDistributionsBetaNegBinomial_v_546;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_547> AgradDistributionsBetaNegBinomial_v_547;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_548> AgradDistributionsBetaNegBinomial_v_548;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_549> AgradDistributionsBetaNegBinomial_v_549;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_550> AgradDistributionsBetaNegBinomial_v_550;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_551> AgradDistributionsBetaNegBinomial_v_551;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_552> AgradDistributionsBetaNegBinomial_v_552;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_553> AgradDistributionsBetaNegBinomial_v_553;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_554> AgradDistributionsBetaNegBinomial_v_554;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_555> AgradDistributionsBetaNegBinomial_v_555;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_556> AgradDistributionsBetaNegBinomial_v_556;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_557> AgradDistributionsBetaNegBinomial_v_557;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_558> AgradDistributionsBetaNegBinomial_v_558;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_559> AgradDistributionsBetaNegBinomial_v_559;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_560> AgradDistributionsBetaNegBinomial_v_560;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_561> AgradDistributionsBetaNegBinomial_v_561;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_562> AgradDistributionsBetaNegBinomial_v_562;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_563> AgradDistributionsBetaNegBinomial_v_563;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_564> AgradDistributionsBetaNegBinomial_v_564;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_565> AgradDistributionsBetaNegBinomial_v_565;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_566> AgradDistributionsBetaNegBinomial_v_566;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_567> AgradDistributionsBetaNegBinomial_v_567;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_568> AgradDistributionsBetaNegBinomial_v_568;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_569> AgradDistributionsBetaNegBinomial_v_569;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_570> AgradDistributionsBetaNegBinomial_v_570;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_571> AgradDistributionsBetaNegBinomial_v_571;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_572> AgradDistributionsBetaNegBinomial_v_572;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_573> AgradDistributionsBetaNegBinomial_v_573;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_574> AgradDistributionsBetaNegBinomial_v_574;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_575> AgradDistributionsBetaNegBinomial_v_575;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_576> AgradDistributionsBetaNegBinomial_v_576;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_577> AgradDistributionsBetaNegBinomial_v_577;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_578> AgradDistributionsBetaNegBinomial_v_578;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_579> AgradDistributionsBetaNegBinomial_v_579;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_580> AgradDistributionsBetaNegBinomial_v_580;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_581> AgradDistributionsBetaNegBinomial_v_581;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_582> AgradDistributionsBetaNegBinomial_v_582;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_583> AgradDistributionsBetaNegBinomial_v_583;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_584> AgradDistributionsBetaNegBinomial_v_584;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_585> AgradDistributionsBetaNegBinomial_v_585;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_586> AgradDistributionsBetaNegBinomial_v_586;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_587> AgradDistributionsBetaNegBinomial_v_587;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_588> AgradDistributionsBetaNegBinomial_v_588;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_589> AgradDistributionsBetaNegBinomial_v_589;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_590> AgradDistributionsBetaNegBinomial_v_590;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_591> AgradDistributionsBetaNegBinomial_v_591;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_592> AgradDistributionsBetaNegBinomial_v_592;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_593> AgradDistributionsBetaNegBinomial_v_593;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_594> AgradDistributionsBetaNegBinomial_v_594;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_595> AgradDistributionsBetaNegBinomial_v_595;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_596> AgradDistributionsBetaNegBinomial_v_596;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_597> AgradDistributionsBetaNegBinomial_v_597;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_598> AgradDistributionsBetaNegBinomial_v_598;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_599> AgradDistributionsBetaNegBinomial_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_500, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_501, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_502, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_503, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_504, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_505, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_506, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_507, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_508, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_509, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_510, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_511, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_512, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_513, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_514, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_515, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_516, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_517, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_518, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_519, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_520, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_521, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_522, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_523, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_524, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_525, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_526, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_527, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_528, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_529, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_530, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_531, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_532, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_533, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_534, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_535, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_536, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_537, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_538, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_539, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_540, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_541, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_542, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_543, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_544, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_545, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_546, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_547, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_548, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_549, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_550, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_551, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_552, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_553, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_554, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_555, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_556, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_557, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_558, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_559, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_560, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_561, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_562, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_563, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_564, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_565, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_566, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_567, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_568, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_569, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_570, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_571, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_572, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_573, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_574, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_575, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_576, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_577, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_578, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_579, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_580, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_581, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_582, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_583, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_584, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_585, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_586, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_587, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_588, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_589, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_590, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_591, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_592, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_593, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_594, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_595, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_596, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_597, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_598, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_599, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_599);
+
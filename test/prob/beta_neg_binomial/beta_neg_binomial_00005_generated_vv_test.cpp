@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_500> AgradDistributionsBetaNegBinomial_vv_500;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_501> AgradDistributionsBetaNegBinomial_vv_501;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_502> AgradDistributionsBetaNegBinomial_vv_502;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_503> AgradDistributionsBetaNegBinomial_vv_503;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_504> AgradDistributionsBetaNegBinomial_vv_504;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_505> AgradDistributionsBetaNegBinomial_vv_505;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_506> AgradDistributionsBetaNegBinomial_vv_506;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_507> AgradDistributionsBetaNegBinomial_vv_507;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_508> AgradDistributionsBetaNegBinomial_vv_508;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_509> AgradDistributionsBetaNegBinomial_vv_509;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_510> AgradDistributionsBetaNegBinomial_vv_510;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_511> AgradDistributionsBetaNegBinomial_vv_511;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_512> AgradDistributionsBetaNegBinomial_vv_512;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_513> AgradDistributionsBetaNegBinomial_vv_513;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_514> AgradDistributionsBetaNegBinomial_vv_514;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_515> AgradDistributionsBetaNegBinomial_vv_515;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_516> AgradDistributionsBetaNegBinomial_vv_516;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_517> AgradDistributionsBetaNegBinomial_vv_517;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_518> AgradDistributionsBetaNegBinomial_vv_518;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_519> AgradDistributionsBetaNegBinomial_vv_519;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_520> AgradDistributionsBetaNegBinomial_vv_520;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_521> AgradDistributionsBetaNegBinomial_vv_521;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_522> AgradDistributionsBetaNegBinomial_vv_522;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_523> AgradDistributionsBetaNegBinomial_vv_523;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_524> AgradDistributionsBetaNegBinomial_vv_524;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_525> AgradDistributionsBetaNegBinomial_vv_525;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_526> AgradDistributionsBetaNegBinomial_vv_526;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_527> AgradDistributionsBetaNegBinomial_vv_527;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_528> AgradDistributionsBetaNegBinomial_vv_528;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_529> AgradDistributionsBetaNegBinomial_vv_529;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_530> AgradDistributionsBetaNegBinomial_vv_530;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_531> AgradDistributionsBetaNegBinomial_vv_531;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_532> AgradDistributionsBetaNegBinomial_vv_532;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_533> AgradDistributionsBetaNegBinomial_vv_533;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_534> AgradDistributionsBetaNegBinomial_vv_534;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_535> AgradDistributionsBetaNegBinomial_vv_535;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_536> AgradDistributionsBetaNegBinomial_vv_536;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_537> AgradDistributionsBetaNegBinomial_vv_537;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_538> AgradDistributionsBetaNegBinomial_vv_538;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_539> AgradDistributionsBetaNegBinomial_vv_539;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_540> AgradDistributionsBetaNegBinomial_vv_540;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_541> AgradDistributionsBetaNegBinomial_vv_541;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_542> AgradDistributionsBetaNegBinomial_vv_542;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_543> AgradDistributionsBetaNegBinomial_vv_543;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_544> AgradDistributionsBetaNegBinomial_vv_544;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_545> AgradDistributionsBetaNegBinomial_vv_545;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_546> AgradDistributionsBetaNegBinomial_vv_546;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_547> AgradDistributionsBetaNegBinomial_vv_547;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_548> AgradDistributionsBetaNegBinomial_vv_548;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_549> AgradDistributionsBetaNegBinomial_vv_549;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_550> AgradDistributionsBetaNegBinomial_vv_550;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_551> AgradDistributionsBetaNegBinomial_vv_551;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_552> AgradDistributionsBetaNegBinomial_vv_552;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_553> AgradDistributionsBetaNegBinomial_vv_553;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_554> AgradDistributionsBetaNegBinomial_vv_554;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_555> AgradDistributionsBetaNegBinomial_vv_555;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_556> AgradDistributionsBetaNegBinomial_vv_556;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_557> AgradDistributionsBetaNegBinomial_vv_557;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_558> AgradDistributionsBetaNegBinomial_vv_558;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_559> AgradDistributionsBetaNegBinomial_vv_559;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_560> AgradDistributionsBetaNegBinomial_vv_560;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_561> AgradDistributionsBetaNegBinomial_vv_561;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_562> AgradDistributionsBetaNegBinomial_vv_562;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_563> AgradDistributionsBetaNegBinomial_vv_563;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_564> AgradDistributionsBetaNegBinomial_vv_564;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_565> AgradDistributionsBetaNegBinomial_vv_565;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_vv_566> AgradDistributionsBetaNegBinomial_vv_566;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_500, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_501, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_502, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_503, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_504, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_505, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_506, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_507, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_508, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_509, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_510, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_511, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_512, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_513, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_514, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_515, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_516, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_517, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_518, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_519, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_520, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_521, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_522, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_523, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_524, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_525, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_526, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_527, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_528, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_529, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_530, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_531, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_532, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_533, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_534, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_535, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_536, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_537, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_538, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_539, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_540, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_541, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_542, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_543, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_544, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_545, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_546, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_547, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_548, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_549, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_550, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_551, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_552, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_553, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_554, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_555, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_556, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_557, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_558, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_559, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_560, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_561, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_562, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_563, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_564, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_565, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_vv_566, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_vv_566);
+
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_600> AgradDistributionsBetaNegBinomial_v_600;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_601> AgradDistributionsBetaNegBinomial_v_601;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_602> AgradDistributionsBetaNegBinomial_v_602;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_603> AgradDistributionsBetaNegBinomial_v_603;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_604> AgradDistributionsBetaNegBinomial_v_604;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_605> AgradDistributionsBetaNegBinomial_v_605;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_606> AgradDistributionsBetaNegBinomial_v_606;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_607> AgradDistributionsBetaNegBinomial_v_607;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_608> AgradDistributionsBetaNegBinomial_v_608;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_609> AgradDistributionsBetaNegBinomial_v_609;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_610> AgradDistributionsBetaNegBinomial_v_610;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_611> AgradDistributionsBetaNegBinomial_v_611;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_612> AgradDistributionsBetaNegBinomial_v_612;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_613> AgradDistributionsBetaNegBinomial_v_613;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_614> AgradDistributionsBetaNegBinomial_v_614;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_615> AgradDistributionsBetaNegBinomial_v_615;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_616> AgradDistributionsBetaNegBinomial_v_616;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_617> AgradDistributionsBetaNegBinomial_v_617;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_618> AgradDistributionsBetaNegBinomial_v_618;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_619> AgradDistributionsBetaNegBinomial_v_619;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_620> AgradDistributionsBetaNegBinomial_v_620;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_621> AgradDistributionsBetaNegBinomial_v_621;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_622> AgradDistributionsBetaNegBinomial_v_622;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_623> AgradDistributionsBetaNegBinomial_v_623;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_624> AgradDistributionsBetaNegBinomial_v_624;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_625> AgradDistributionsBetaNegBinomial_v_625;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_626> AgradDistributionsBetaNegBinomial_v_626;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_627> AgradDistributionsBetaNegBinomial_v_627;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_628> AgradDistributionsBetaNegBinomial_v_628;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_629> AgradDistributionsBetaNegBinomial_v_629;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_630> AgradDistributionsBetaNegBinomial_v_630;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_631> AgradDistributionsBetaNegBinomial_v_631;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_632> AgradDistributionsBetaNegBinomial_v_632;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_633> AgradDistributionsBetaNegBinomial_v_633;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_634> AgradDistributionsBetaNegBinomial_v_634;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_635> AgradDistributionsBetaNegBinomial_v_635;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_636> AgradDistributionsBetaNegBinomial_v_636;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_637> AgradDistributionsBetaNegBinomial_v_637;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_638> AgradDistributionsBetaNegBinomial_v_638;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_639> AgradDistributionsBetaNegBinomial_v_639;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_640> AgradDistributionsBetaNegBinomial_v_640;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_641> AgradDistributionsBetaNegBinomial_v_641;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_642> AgradDistributionsBetaNegBinomial_v_642;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_643> AgradDistributionsBetaNegBinomial_v_643;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_644> AgradDistributionsBetaNegBinomial_v_644;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_645> AgradDistributionsBetaNegBinomial_v_645;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_646> AgradDistributionsBetaNegBinomial_v_646;
+typedef std::tuple<AgradDistributionsBetaNegBinomial, type_v_647> AgradDistributionsBetaNegBinomial_v_647;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_600, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_601, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_602, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_603, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_604, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_605, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_606, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_607, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_608, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_609, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_610, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_611, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_612, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_613, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_614, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_615, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_616, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_617, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_618, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_619, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_620, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_621, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_622, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_623, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_624, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_625, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_626, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_627, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_628, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_629, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_630, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_631, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_632, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_633, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_634, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_635, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_636, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_637, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_638, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_639, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_640, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_641, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_642, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_643, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_644, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_645, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_646, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaNegBinomial_v_647, AgradDistributionTestFixture, AgradDistributionsBetaNegBinomial_v_647);
+
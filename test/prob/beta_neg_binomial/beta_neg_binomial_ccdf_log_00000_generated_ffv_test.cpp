@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<int, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<int, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<int, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<int, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<int, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<int, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<int, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<int, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<int, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<int, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<int, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<int, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<int, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<int, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<int, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<int, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<int, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<int, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<int, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<int, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_0> AgradCcdfLogBetaNegBinomial_ffv_0;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_1> AgradCcdfLogBetaNegBinomial_ffv_1;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_2> AgradCcdfLogBetaNegBinomial_ffv_2;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_3> AgradCcdfLogBetaNegBinomial_ffv_3;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_4> AgradCcdfLogBetaNegBinomial_ffv_4;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_5> AgradCcdfLogBetaNegBinomial_ffv_5;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_6> AgradCcdfLogBetaNegBinomial_ffv_6;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_7> AgradCcdfLogBetaNegBinomial_ffv_7;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_8> AgradCcdfLogBetaNegBinomial_ffv_8;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_9> AgradCcdfLogBetaNegBinomial_ffv_9;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_10> AgradCcdfLogBetaNegBinomial_ffv_10;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_11> AgradCcdfLogBetaNegBinomial_ffv_11;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_12> AgradCcdfLogBetaNegBinomial_ffv_12;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_13> AgradCcdfLogBetaNegBinomial_ffv_13;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_14> AgradCcdfLogBetaNegBinomial_ffv_14;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_15> AgradCcdfLogBetaNegBinomial_ffv_15;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_16> AgradCcdfLogBetaNegBinomial_ffv_16;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_17> AgradCcdfLogBetaNegBinomial_ffv_17;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_18> AgradCcdfLogBetaNegBinomial_ffv_18;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_19> AgradCcdfLogBetaNegBinomial_ffv_19;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_20> AgradCcdfLogBetaNegBinomial_ffv_20;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_21> AgradCcdfLogBetaNegBinomial_ffv_21;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_22> AgradCcdfLogBetaNegBinomial_ffv_22;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_23> AgradCcdfLogBetaNegBinomial_ffv_23;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_24> AgradCcdfLogBetaNegBinomial_ffv_24;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_25> AgradCcdfLogBetaNegBinomial_ffv_25;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_26> AgradCcdfLogBetaNegBinomial_ffv_26;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_27> AgradCcdfLogBetaNegBinomial_ffv_27;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_28> AgradCcdfLogBetaNegBinomial_ffv_28;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_29> AgradCcdfLogBetaNegBinomial_ffv_29;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_30> AgradCcdfLogBetaNegBinomial_ffv_30;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_31> AgradCcdfLogBetaNegBinomial_ffv_31;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_32> AgradCcdfLogBetaNegBinomial_ffv_32;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_33> AgradCcdfLogBetaNegBinomial_ffv_33;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_34> AgradCcdfLogBetaNegBinomial_ffv_34;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_35> AgradCcdfLogBetaNegBinomial_ffv_35;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_36> AgradCcdfLogBetaNegBinomial_ffv_36;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_37> AgradCcdfLogBetaNegBinomial_ffv_37;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_38> AgradCcdfLogBetaNegBinomial_ffv_38;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_39> AgradCcdfLogBetaNegBinomial_ffv_39;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_40> AgradCcdfLogBetaNegBinomial_ffv_40;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_41> AgradCcdfLogBetaNegBinomial_ffv_41;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_42> AgradCcdfLogBetaNegBinomial_ffv_42;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_43> AgradCcdfLogBetaNegBinomial_ffv_43;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_44> AgradCcdfLogBetaNegBinomial_ffv_44;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_45> AgradCcdfLogBetaNegBinomial_ffv_45;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_46> AgradCcdfLogBetaNegBinomial_ffv_46;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_47> AgradCcdfLogBetaNegBinomial_ffv_47;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_48> AgradCcdfLogBetaNegBinomial_ffv_48;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_49> AgradCcdfLogBetaNegBinomial_ffv_49;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_50> AgradCcdfLogBetaNegBinomial_ffv_50;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_51> AgradCcdfLogBetaNegBinomial_ffv_51;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_52> AgradCcdfLogBetaNegBinomial_ffv_52;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_53> AgradCcdfLogBetaNegBinomial_ffv_53;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_54> AgradCcdfLogBetaNegBinomial_ffv_54;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_55> AgradCcdfLogBetaNegBinomial_ffv_55;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_56> AgradCcdfLogBetaNegBinomial_ffv_56;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_57> AgradCcdfLogBetaNegBinomial_ffv_57;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_58> AgradCcdfLogBetaNegBinomial_ffv_58;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_59> AgradCcdfLogBetaNegBinomial_ffv_59;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_60> AgradCcdfLogBetaNegBinomial_ffv_60;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_61> AgradCcdfLogBetaNegBinomial_ffv_61;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_62> AgradCcdfLogBetaNegBinomial_ffv_62;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_63> AgradCcdfLogBetaNegBinomial_ffv_63;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_64> AgradCcdfLogBetaNegBinomial_ffv_64;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_65> AgradCcdfLogBetaNegBinomial_ffv_65;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_66> AgradCcdfLogBetaNegBinomial_ffv_66;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_67> AgradCcdfLogBetaNegBinomial_ffv_67;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_68> AgradCcdfLogBetaNegBinomial_ffv_68;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_69> AgradCcdfLogBetaNegBinomial_ffv_69;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_70> AgradCcdfLogBetaNegBinomial_ffv_70;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_71> AgradCcdfLogBetaNegBinomial_ffv_71;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_72> AgradCcdfLogBetaNegBinomial_ffv_72;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_73> AgradCcdfLogBetaNegBinomial_ffv_73;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_74> AgradCcdfLogBetaNegBinomial_ffv_74;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_75> AgradCcdfLogBetaNegBinomial_ffv_75;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_76> AgradCcdfLogBetaNegBinomial_ffv_76;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_77> AgradCcdfLogBetaNegBinomial_ffv_77;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_78> AgradCcdfLogBetaNegBinomial_ffv_78;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_79> AgradCcdfLogBetaNegBinomial_ffv_79;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_80> AgradCcdfLogBetaNegBinomial_ffv_80;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_81> AgradCcdfLogBetaNegBinomial_ffv_81;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_82> AgradCcdfLogBetaNegBinomial_ffv_82;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_83> AgradCcdfLogBetaNegBinomial_ffv_83;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_84> AgradCcdfLogBetaNegBinomial_ffv_84;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_85> AgradCcdfLogBetaNegBinomial_ffv_85;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_86> AgradCcdfLogBetaNegBinomial_ffv_86;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_87> AgradCcdfLogBetaNegBinomial_ffv_87;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_88> AgradCcdfLogBetaNegBinomial_ffv_88;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_89> AgradCcdfLogBetaNegBinomial_ffv_89;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_90> AgradCcdfLogBetaNegBinomial_ffv_90;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_91> AgradCcdfLogBetaNegBinomial_ffv_91;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_92> AgradCcdfLogBetaNegBinomial_ffv_92;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_93> AgradCcdfLogBetaNegBinomial_ffv_93;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_94> AgradCcdfLogBetaNegBinomial_ffv_94;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_95> AgradCcdfLogBetaNegBinomial_ffv_95;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_96> AgradCcdfLogBetaNegBinomial_ffv_96;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_97> AgradCcdfLogBetaNegBinomial_ffv_97;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_98> AgradCcdfLogBetaNegBinomial_ffv_98;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_99> AgradCcdfLogBetaNegBinomial_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_99);
+
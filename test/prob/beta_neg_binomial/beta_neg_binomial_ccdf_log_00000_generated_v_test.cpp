@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<int, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<int, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<int, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<int, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<int, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<int, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<int, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<int, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<int, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<int, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<int, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<int, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<int, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<int, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<int, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<int, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<int, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<int, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<int, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<int, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<int, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<int, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<int, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<int, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<int, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<int, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<int, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<int, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<int, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<int, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<int, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<int, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<int, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<int, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<int, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_0> AgradCcdfLogBetaNegBinomial_v_0;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_1> AgradCcdfLogBetaNegBinomial_v_1;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_2> AgradCcdfLogBetaNegBinomial_v_2;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_3> AgradCcdfLogBetaNegBinomial_v_3;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_4> AgradCcdfLogBetaNegBinomial_v_4;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_5> AgradCcdfLogBetaNegBinomial_v_5;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_6> AgradCcdfLogBetaNegBinomial_v_6;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_7> AgradCcdfLogBetaNegBinomial_v_7;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_8> AgradCcdfLogBetaNegBinomial_v_8;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_9> AgradCcdfLogBetaNegBinomial_v_9;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_10> AgradCcdfLogBetaNegBinomial_v_10;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_11> AgradCcdfLogBetaNegBinomial_v_11;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_12> AgradCcdfLogBetaNegBinomial_v_12;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_13> AgradCcdfLogBetaNegBinomial_v_13;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_14> AgradCcdfLogBetaNegBinomial_v_14;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_15> AgradCcdfLogBetaNegBinomial_v_15;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_16> AgradCcdfLogBetaNegBinomial_v_16;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_17> AgradCcdfLogBetaNegBinomial_v_17;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_18> AgradCcdfLogBetaNegBinomial_v_18;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_19> AgradCcdfLogBetaNegBinomial_v_19;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_20> AgradCcdfLogBetaNegBinomial_v_20;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_21> AgradCcdfLogBetaNegBinomial_v_21;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_22> AgradCcdfLogBetaNegBinomial_v_22;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_23> AgradCcdfLogBetaNegBinomial_v_23;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_24> AgradCcdfLogBetaNegBinomial_v_24;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_25> AgradCcdfLogBetaNegBinomial_v_25;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_26> AgradCcdfLogBetaNegBinomial_v_26;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_27> AgradCcdfLogBetaNegBinomial_v_27;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_28> AgradCcdfLogBetaNegBinomial_v_28;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_29> AgradCcdfLogBetaNegBinomial_v_29;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_30> AgradCcdfLogBetaNegBinomial_v_30;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_31> AgradCcdfLogBetaNegBinomial_v_31;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_32> AgradCcdfLogBetaNegBinomial_v_32;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_33> AgradCcdfLogBetaNegBinomial_v_33;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_34> AgradCcdfLogBetaNegBinomial_v_34;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_35> AgradCcdfLogBetaNegBinomial_v_35;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_36> AgradCcdfLogBetaNegBinomial_v_36;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_37> AgradCcdfLogBetaNegBinomial_v_37;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_38> AgradCcdfLogBetaNegBinomial_v_38;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_39> AgradCcdfLogBetaNegBinomial_v_39;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_40> AgradCcdfLogBetaNegBinomial_v_40;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_41> AgradCcdfLogBetaNegBinomial_v_41;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_42> AgradCcdfLogBetaNegBinomial_v_42;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_43> AgradCcdfLogBetaNegBinomial_v_43;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_44> AgradCcdfLogBetaNegBinomial_v_44;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_45> AgradCcdfLogBetaNegBinomial_v_45;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_46> AgradCcdfLogBetaNegBinomial_v_46;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_47> AgradCcdfLogBetaNegBinomial_v_47;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_48> AgradCcdfLogBetaNegBinomial_v_48;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_49> AgradCcdfLogBetaNegBinomial_v_49;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_50> AgradCcdfLogBetaNegBinomial_v_50;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_51> AgradCcdfLogBetaNegBinomial_v_51;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_52> AgradCcdfLogBetaNegBinomial_v_52;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_53> AgradCcdfLogBetaNegBinomial_v_53;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_54> AgradCcdfLogBetaNegBinomial_v_54;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_55> AgradCcdfLogBetaNegBinomial_v_55;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_56> AgradCcdfLogBetaNegBinomial_v_56;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_57> AgradCcdfLogBetaNegBinomial_v_57;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_58> AgradCcdfLogBetaNegBinomial_v_58;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_59> AgradCcdfLogBetaNegBinomial_v_59;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_60> AgradCcdfLogBetaNegBinomial_v_60;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_61> AgradCcdfLogBetaNegBinomial_v_61;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_62> AgradCcdfLogBetaNegBinomial_v_62;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_63> AgradCcdfLogBetaNegBinomial_v_63;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_64> AgradCcdfLogBetaNegBinomial_v_64;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_65> AgradCcdfLogBetaNegBinomial_v_65;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_66> AgradCcdfLogBetaNegBinomial_v_66;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_67> AgradCcdfLogBetaNegBinomial_v_67;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_68> AgradCcdfLogBetaNegBinomial_v_68;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_69> AgradCcdfLogBetaNegBinomial_v_69;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_70> AgradCcdfLogBetaNegBinomial_v_70;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_71> AgradCcdfLogBetaNegBinomial_v_71;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_72> AgradCcdfLogBetaNegBinomial_v_72;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_73> AgradCcdfLogBetaNegBinomial_v_73;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_74> AgradCcdfLogBetaNegBinomial_v_74;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_75> AgradCcdfLogBetaNegBinomial_v_75;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_76> AgradCcdfLogBetaNegBinomial_v_76;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_77> AgradCcdfLogBetaNegBinomial_v_77;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_78> AgradCcdfLogBetaNegBinomial_v_78;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_79> AgradCcdfLogBetaNegBinomial_v_79;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_80> AgradCcdfLogBetaNegBinomial_v_80;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_81> AgradCcdfLogBetaNegBinomial_v_81;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_82> AgradCcdfLogBetaNegBinomial_v_82;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_83> AgradCcdfLogBetaNegBinomial_v_83;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_84> AgradCcdfLogBetaNegBinomial_v_84;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_85> AgradCcdfLogBetaNegBinomial_v_85;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_86> AgradCcdfLogBetaNegBinomial_v_86;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_87> AgradCcdfLogBetaNegBinomial_v_87;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_88> AgradCcdfLogBetaNegBinomial_v_88;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_89> AgradCcdfLogBetaNegBinomial_v_89;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_90> AgradCcdfLogBetaNegBinomial_v_90;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_91> AgradCcdfLogBetaNegBinomial_v_91;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_92> AgradCcdfLogBetaNegBinomial_v_92;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_93> AgradCcdfLogBetaNegBinomial_v_93;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_94> AgradCcdfLogBetaNegBinomial_v_94;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_95> AgradCcdfLogBetaNegBinomial_v_95;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_96> AgradCcdfLogBetaNegBinomial_v_96;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_97> AgradCcdfLogBetaNegBinomial_v_97;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_98> AgradCcdfLogBetaNegBinomial_v_98;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_99> AgradCcdfLogBetaNegBinomial_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_0, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_1, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_2, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_3, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_4, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_5, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_6, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_7, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_8, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_9, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_10, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_11, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_12, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_13, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_14, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_15, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_16, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_17, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_18, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_19, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_20, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_21, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_22, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_23, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_24, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_25, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_26, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_27, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_28, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_29, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_30, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_31, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_32, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_33, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_34, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_35, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_36, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_37, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_38, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_39, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_40, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_41, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_42, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_43, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_44, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_45, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_46, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_47, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_48, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_49, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_50, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_51, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_52, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_53, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_54, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_55, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_56, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_57, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_58, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_59, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_60, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_61, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_62, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_63, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_64, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_65, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_66, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_67, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_68, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_69, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_70, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_71, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_72, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_73, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_74, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_75, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_76, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_77, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_78, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_79, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_80, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_81, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_82, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_83, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_84, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_85, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_86, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_87, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_88, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_89, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_90, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_91, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_92, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_93, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_94, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_95, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_96, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_97, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_98, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_99, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<int, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<int, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<int, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<int, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<int, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<int, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<int, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<int, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<int, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<int, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<int, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<int, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<int, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<int, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<int, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<int, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<int, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<int, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<int, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<int, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<int, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<int, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<int, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<int, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<int, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<int, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<int, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<int, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<int, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<int, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<int, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<int, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<int, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<int, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<int, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<int, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<int, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<int, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<int, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_0> AgradCcdfLogBetaNegBinomial_vv_0;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_1> AgradCcdfLogBetaNegBinomial_vv_1;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_2> AgradCcdfLogBetaNegBinomial_vv_2;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_3> AgradCcdfLogBetaNegBinomial_vv_3;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_4> AgradCcdfLogBetaNegBinomial_vv_4;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_5> AgradCcdfLogBetaNegBinomial_vv_5;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_6> AgradCcdfLogBetaNegBinomial_vv_6;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_7> AgradCcdfLogBetaNegBinomial_vv_7;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_8> AgradCcdfLogBetaNegBinomial_vv_8;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_9> AgradCcdfLogBetaNegBinomial_vv_9;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_10> AgradCcdfLogBetaNegBinomial_vv_10;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_11> AgradCcdfLogBetaNegBinomial_vv_11;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_12> AgradCcdfLogBetaNegBinomial_vv_12;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_13> AgradCcdfLogBetaNegBinomial_vv_13;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_14> AgradCcdfLogBetaNegBinomial_vv_14;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_15> AgradCcdfLogBetaNegBinomial_vv_15;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_16> AgradCcdfLogBetaNegBinomial_vv_16;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_17> AgradCcdfLogBetaNegBinomial_vv_17;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_18> AgradCcdfLogBetaNegBinomial_vv_18;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_19> AgradCcdfLogBetaNegBinomial_vv_19;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_20> AgradCcdfLogBetaNegBinomial_vv_20;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_21> AgradCcdfLogBetaNegBinomial_vv_21;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_22> AgradCcdfLogBetaNegBinomial_vv_22;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_23> AgradCcdfLogBetaNegBinomial_vv_23;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_24> AgradCcdfLogBetaNegBinomial_vv_24;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_25> AgradCcdfLogBetaNegBinomial_vv_25;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_26> AgradCcdfLogBetaNegBinomial_vv_26;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_27> AgradCcdfLogBetaNegBinomial_vv_27;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_28> AgradCcdfLogBetaNegBinomial_vv_28;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_29> AgradCcdfLogBetaNegBinomial_vv_29;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_30> AgradCcdfLogBetaNegBinomial_vv_30;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_31> AgradCcdfLogBetaNegBinomial_vv_31;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_32> AgradCcdfLogBetaNegBinomial_vv_32;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_33> AgradCcdfLogBetaNegBinomial_vv_33;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_34> AgradCcdfLogBetaNegBinomial_vv_34;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_35> AgradCcdfLogBetaNegBinomial_vv_35;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_36> AgradCcdfLogBetaNegBinomial_vv_36;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_37> AgradCcdfLogBetaNegBinomial_vv_37;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_38> AgradCcdfLogBetaNegBinomial_vv_38;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_39> AgradCcdfLogBetaNegBinomial_vv_39;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_40> AgradCcdfLogBetaNegBinomial_vv_40;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_41> AgradCcdfLogBetaNegBinomial_vv_41;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_42> AgradCcdfLogBetaNegBinomial_vv_42;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_43> AgradCcdfLogBetaNegBinomial_vv_43;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_44> AgradCcdfLogBetaNegBinomial_vv_44;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_45> AgradCcdfLogBetaNegBinomial_vv_45;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_46> AgradCcdfLogBetaNegBinomial_vv_46;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_47> AgradCcdfLogBetaNegBinomial_vv_47;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_48> AgradCcdfLogBetaNegBinomial_vv_48;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_49> AgradCcdfLogBetaNegBinomial_vv_49;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_50> AgradCcdfLogBetaNegBinomial_vv_50;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_51> AgradCcdfLogBetaNegBinomial_vv_51;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_52> AgradCcdfLogBetaNegBinomial_vv_52;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_53> AgradCcdfLogBetaNegBinomial_vv_53;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_54> AgradCcdfLogBetaNegBinomial_vv_54;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_55> AgradCcdfLogBetaNegBinomial_vv_55;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_56> AgradCcdfLogBetaNegBinomial_vv_56;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_57> AgradCcdfLogBetaNegBinomial_vv_57;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_58> AgradCcdfLogBetaNegBinomial_vv_58;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_59> AgradCcdfLogBetaNegBinomial_vv_59;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_60> AgradCcdfLogBetaNegBinomial_vv_60;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_61> AgradCcdfLogBetaNegBinomial_vv_61;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_62> AgradCcdfLogBetaNegBinomial_vv_62;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_63> AgradCcdfLogBetaNegBinomial_vv_63;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_64> AgradCcdfLogBetaNegBinomial_vv_64;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_65> AgradCcdfLogBetaNegBinomial_vv_65;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_66> AgradCcdfLogBetaNegBinomial_vv_66;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_67> AgradCcdfLogBetaNegBinomial_vv_67;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_68> AgradCcdfLogBetaNegBinomial_vv_68;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_69> AgradCcdfLogBetaNegBinomial_vv_69;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_70> AgradCcdfLogBetaNegBinomial_vv_70;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_71> AgradCcdfLogBetaNegBinomial_vv_71;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_72> AgradCcdfLogBetaNegBinomial_vv_72;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_73> AgradCcdfLogBetaNegBinomial_vv_73;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_74> AgradCcdfLogBetaNegBinomial_vv_74;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_75> AgradCcdfLogBetaNegBinomial_vv_75;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_76> AgradCcdfLogBetaNegBinomial_vv_76;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_77> AgradCcdfLogBetaNegBinomial_vv_77;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_78> AgradCcdfLogBetaNegBinomial_vv_78;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_79> AgradCcdfLogBetaNegBinomial_vv_79;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_80> AgradCcdfLogBetaNegBinomial_vv_80;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_81> AgradCcdfLogBetaNegBinomial_vv_81;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_82> AgradCcdfLogBetaNegBinomial_vv_82;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_83> AgradCcdfLogBetaNegBinomial_vv_83;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_84> AgradCcdfLogBetaNegBinomial_vv_84;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_85> AgradCcdfLogBetaNegBinomial_vv_85;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_86> AgradCcdfLogBetaNegBinomial_vv_86;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_87> AgradCcdfLogBetaNegBinomial_vv_87;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_88> AgradCcdfLogBetaNegBinomial_vv_88;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_89> AgradCcdfLogBetaNegBinomial_vv_89;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_90> AgradCcdfLogBetaNegBinomial_vv_90;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_91> AgradCcdfLogBetaNegBinomial_vv_91;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_92> AgradCcdfLogBetaNegBinomial_vv_92;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_93> AgradCcdfLogBetaNegBinomial_vv_93;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_94> AgradCcdfLogBetaNegBinomial_vv_94;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_95> AgradCcdfLogBetaNegBinomial_vv_95;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_96> AgradCcdfLogBetaNegBinomial_vv_96;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_97> AgradCcdfLogBetaNegBinomial_vv_97;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_98> AgradCcdfLogBetaNegBinomial_vv_98;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_99> AgradCcdfLogBetaNegBinomial_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<int>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<int>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<int>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_100> AgradCcdfLogBetaNegBinomial_ffv_100;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_101> AgradCcdfLogBetaNegBinomial_ffv_101;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_102> AgradCcdfLogBetaNegBinomial_ffv_102;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_103> AgradCcdfLogBetaNegBinomial_ffv_103;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_104> AgradCcdfLogBetaNegBinomial_ffv_104;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_105> AgradCcdfLogBetaNegBinomial_ffv_105;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_106> AgradCcdfLogBetaNegBinomial_ffv_106;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_107> AgradCcdfLogBetaNegBinomial_ffv_107;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_108> AgradCcdfLogBetaNegBinomial_ffv_108;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_109> AgradCcdfLogBetaNegBinomial_ffv_109;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_110> AgradCcdfLogBetaNegBinomial_ffv_110;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_111> AgradCcdfLogBetaNegBinomial_ffv_111;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_112> AgradCcdfLogBetaNegBinomial_ffv_112;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_113> AgradCcdfLogBetaNegBinomial_ffv_113;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_114> AgradCcdfLogBetaNegBinomial_ffv_114;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_115> AgradCcdfLogBetaNegBinomial_ffv_115;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_116> AgradCcdfLogBetaNegBinomial_ffv_116;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_117> AgradCcdfLogBetaNegBinomial_ffv_117;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_118> AgradCcdfLogBetaNegBinomial_ffv_118;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_119> AgradCcdfLogBetaNegBinomial_ffv_119;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_120> AgradCcdfLogBetaNegBinomial_ffv_120;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_121> AgradCcdfLogBetaNegBinomial_ffv_121;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_122> AgradCcdfLogBetaNegBinomial_ffv_122;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_123> AgradCcdfLogBetaNegBinomial_ffv_123;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_124> AgradCcdfLogBetaNegBinomial_ffv_124;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_125> AgradCcdfLogBetaNegBinomial_ffv_125;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_126> AgradCcdfLogBetaNegBinomial_ffv_126;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_127> AgradCcdfLogBetaNegBinomial_ffv_127;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_128> AgradCcdfLogBetaNegBinomial_ffv_128;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_129> AgradCcdfLogBetaNegBinomial_ffv_129;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_130> AgradCcdfLogBetaNegBinomial_ffv_130;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_131> AgradCcdfLogBetaNegBinomial_ffv_131;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_132> AgradCcdfLogBetaNegBinomial_ffv_132;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_133> AgradCcdfLogBetaNegBinomial_ffv_133;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_134> AgradCcdfLogBetaNegBinomial_ffv_134;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_135> AgradCcdfLogBetaNegBinomial_ffv_135;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_136> AgradCcdfLogBetaNegBinomial_ffv_136;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_137> AgradCcdfLogBetaNegBinomial_ffv_137;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_138> AgradCcdfLogBetaNegBinomial_ffv_138;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_139> AgradCcdfLogBetaNegBinomial_ffv_139;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_140> AgradCcdfLogBetaNegBinomial_ffv_140;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_141> AgradCcdfLogBetaNegBinomial_ffv_141;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_142> AgradCcdfLogBetaNegBinomial_ffv_142;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_143> AgradCcdfLogBetaNegBinomial_ffv_143;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_144> AgradCcdfLogBetaNegBinomial_ffv_144;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_145> AgradCcdfLogBetaNegBinomial_ffv_145;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_146> AgradCcdfLogBetaNegBinomial_ffv_146;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_147> AgradCcdfLogBetaNegBinomial_ffv_147;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_148> AgradCcdfLogBetaNegBinomial_ffv_148;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_149> AgradCcdfLogBetaNegBinomial_ffv_149;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_150> AgradCcdfLogBetaNegBinomial_ffv_150;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_151> AgradCcdfLogBetaNegBinomial_ffv_151;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_152> AgradCcdfLogBetaNegBinomial_ffv_152;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_153> AgradCcdfLogBetaNegBinomial_ffv_153;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_154> AgradCcdfLogBetaNegBinomial_ffv_154;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_155> AgradCcdfLogBetaNegBinomial_ffv_155;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_156> AgradCcdfLogBetaNegBinomial_ffv_156;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_157> AgradCcdfLogBetaNegBinomial_ffv_157;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_158> AgradCcdfLogBetaNegBinomial_ffv_158;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_159> AgradCcdfLogBetaNegBinomial_ffv_159;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_160> AgradCcdfLogBetaNegBinomial_ffv_160;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_161> AgradCcdfLogBetaNegBinomial_ffv_161;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_162> AgradCcdfLogBetaNegBinomial_ffv_162;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_163> AgradCcdfLogBetaNegBinomial_ffv_163;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_164> AgradCcdfLogBetaNegBinomial_ffv_164;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_165> AgradCcdfLogBetaNegBinomial_ffv_165;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_166> AgradCcdfLogBetaNegBinomial_ffv_166;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_167> AgradCcdfLogBetaNegBinomial_ffv_167;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_168> AgradCcdfLogBetaNegBinomial_ffv_168;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_169> AgradCcdfLogBetaNegBinomial_ffv_169;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_170> AgradCcdfLogBetaNegBinomial_ffv_170;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_171> AgradCcdfLogBetaNegBinomial_ffv_171;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_172> AgradCcdfLogBetaNegBinomial_ffv_172;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_173> AgradCcdfLogBetaNegBinomial_ffv_173;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_174> AgradCcdfLogBetaNegBinomial_ffv_174;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_175> AgradCcdfLogBetaNegBinomial_ffv_175;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_176> AgradCcdfLogBetaNegBinomial_ffv_176;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_177> AgradCcdfLogBetaNegBinomial_ffv_177;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_178> AgradCcdfLogBetaNegBinomial_ffv_178;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_179> AgradCcdfLogBetaNegBinomial_ffv_179;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_180> AgradCcdfLogBetaNegBinomial_ffv_180;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_181> AgradCcdfLogBetaNegBinomial_ffv_181;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_182> AgradCcdfLogBetaNegBinomial_ffv_182;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_183> AgradCcdfLogBetaNegBinomial_ffv_183;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_184> AgradCcdfLogBetaNegBinomial_ffv_184;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_185> AgradCcdfLogBetaNegBinomial_ffv_185;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_186> AgradCcdfLogBetaNegBinomial_ffv_186;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_187> AgradCcdfLogBetaNegBinomial_ffv_187;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_188> AgradCcdfLogBetaNegBinomial_ffv_188;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_189> AgradCcdfLogBetaNegBinomial_ffv_189;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_190> AgradCcdfLogBetaNegBinomial_ffv_190;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_191> AgradCcdfLogBetaNegBinomial_ffv_191;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_192> AgradCcdfLogBetaNegBinomial_ffv_192;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_193> AgradCcdfLogBetaNegBinomial_ffv_193;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_194> AgradCcdfLogBetaNegBinomial_ffv_194;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_195> AgradCcdfLogBetaNegBinomial_ffv_195;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_196> AgradCcdfLogBetaNegBinomial_ffv_196;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_197> AgradCcdfLogBetaNegBinomial_ffv_197;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_198> AgradCcdfLogBetaNegBinomial_ffv_198;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_199> AgradCcdfLogBetaNegBinomial_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_189, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_190, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_191, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_192, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_193, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_194, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_195, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_196, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_197, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_198, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_199, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<int, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<int, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<int, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<int, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<int, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<int, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<int, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<int, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<int, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<int, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<int, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<int, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<int, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<int, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<int, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<int, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<int, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<int, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<int, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<int, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<int, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<int, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<int, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<int, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<int, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<int, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<int, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<int, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<int, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<int, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<int, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<int, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<int, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<int, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<int, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<int, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_100> AgradCcdfLogBetaNegBinomial_v_100;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_101> AgradCcdfLogBetaNegBinomial_v_101;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_102> AgradCcdfLogBetaNegBinomial_v_102;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_103> AgradCcdfLogBetaNegBinomial_v_103;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_104> AgradCcdfLogBetaNegBinomial_v_104;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_105> AgradCcdfLogBetaNegBinomial_v_105;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_106> AgradCcdfLogBetaNegBinomial_v_106;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_107> AgradCcdfLogBetaNegBinomial_v_107;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_108> AgradCcdfLogBetaNegBinomial_v_108;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_109> AgradCcdfLogBetaNegBinomial_v_109;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_110> AgradCcdfLogBetaNegBinomial_v_110;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_111> AgradCcdfLogBetaNegBinomial_v_111;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_112> AgradCcdfLogBetaNegBinomial_v_112;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_113> AgradCcdfLogBetaNegBinomial_v_113;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_114> AgradCcdfLogBetaNegBinomial_v_114;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_115> AgradCcdfLogBetaNegBinomial_v_115;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_116> AgradCcdfLogBetaNegBinomial_v_116;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_117> AgradCcdfLogBetaNegBinomial_v_117;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_118> AgradCcdfLogBetaNegBinomial_v_118;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_119> AgradCcdfLogBetaNegBinomial_v_119;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_120> AgradCcdfLogBetaNegBinomial_v_120;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_121> AgradCcdfLogBetaNegBinomial_v_121;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_122> AgradCcdfLogBetaNegBinomial_v_122;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_123> AgradCcdfLogBetaNegBinomial_v_123;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_124> AgradCcdfLogBetaNegBinomial_v_124;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_125> AgradCcdfLogBetaNegBinomial_v_125;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_126> AgradCcdfLogBetaNegBinomial_v_126;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_127> AgradCcdfLogBetaNegBinomial_v_127;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_128> AgradCcdfLogBetaNegBinomial_v_128;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_129> AgradCcdfLogBetaNegBinomial_v_129;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_130> AgradCcdfLogBetaNegBinomial_v_130;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_131> AgradCcdfLogBetaNegBinomial_v_131;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_132> AgradCcdfLogBetaNegBinomial_v_132;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_133> AgradCcdfLogBetaNegBinomial_v_133;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_134> AgradCcdfLogBetaNegBinomial_v_134;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_135> AgradCcdfLogBetaNegBinomial_v_135;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_136> AgradCcdfLogBetaNegBinomial_v_136;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_137> AgradCcdfLogBetaNegBinomial_v_137;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_138> AgradCcdfLogBetaNegBinomial_v_138;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_139> AgradCcdfLogBetaNegBinomial_v_139;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_140> AgradCcdfLogBetaNegBinomial_v_140;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_141> AgradCcdfLogBetaNegBinomial_v_141;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_142> AgradCcdfLogBetaNegBinomial_v_142;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_143> AgradCcdfLogBetaNegBinomial_v_143;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_144> AgradCcdfLogBetaNegBinomial_v_144;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_145> AgradCcdfLogBetaNegBinomial_v_145;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_146> AgradCcdfLogBetaNegBinomial_v_146;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_147> AgradCcdfLogBetaNegBinomial_v_147;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_148> AgradCcdfLogBetaNegBinomial_v_148;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_149> AgradCcdfLogBetaNegBinomial_v_149;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_150> AgradCcdfLogBetaNegBinomial_v_150;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_151> AgradCcdfLogBetaNegBinomial_v_151;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_152> AgradCcdfLogBetaNegBinomial_v_152;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_153> AgradCcdfLogBetaNegBinomial_v_153;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_154> AgradCcdfLogBetaNegBinomial_v_154;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_155> AgradCcdfLogBetaNegBinomial_v_155;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_156> AgradCcdfLogBetaNegBinomial_v_156;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_157> AgradCcdfLogBetaNegBinomial_v_157;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_158> AgradCcdfLogBetaNegBinomial_v_158;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_159> AgradCcdfLogBetaNegBinomial_v_159;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_160> AgradCcdfLogBetaNegBinomial_v_160;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_161> AgradCcdfLogBetaNegBinomial_v_161;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_162> AgradCcdfLogBetaNegBinomial_v_162;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_163> AgradCcdfLogBetaNegBinomial_v_163;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_164> AgradCcdfLogBetaNegBinomial_v_164;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_165> AgradCcdfLogBetaNegBinomial_v_165;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_166> AgradCcdfLogBetaNegBinomial_v_166;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_167> AgradCcdfLogBetaNegBinomial_v_167;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_168> AgradCcdfLogBetaNegBinomial_v_168;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_169> AgradCcdfLogBetaNegBinomial_v_169;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_170> AgradCcdfLogBetaNegBinomial_v_170;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_171> AgradCcdfLogBetaNegBinomial_v_171;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_172> AgradCcdfLogBetaNegBinomial_v_172;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_173> AgradCcdfLogBetaNegBinomial_v_173;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_174> AgradCcdfLogBetaNegBinomial_v_174;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_175> AgradCcdfLogBetaNegBinomial_v_175;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_176> AgradCcdfLogBetaNegBinomial_v_176;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_177> AgradCcdfLogBetaNegBinomial_v_177;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_178> AgradCcdfLogBetaNegBinomial_v_178;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_179> AgradCcdfLogBetaNegBinomial_v_179;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_180> AgradCcdfLogBetaNegBinomial_v_180;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_181> AgradCcdfLogBetaNegBinomial_v_181;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_182> AgradCcdfLogBetaNegBinomial_v_182;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_183> AgradCcdfLogBetaNegBinomial_v_183;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_184> AgradCcdfLogBetaNegBinomial_v_184;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_185> AgradCcdfLogBetaNegBinomial_v_185;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_186> AgradCcdfLogBetaNegBinomial_v_186;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_187> AgradCcdfLogBetaNegBinomial_v_187;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_188> AgradCcdfLogBetaNegBinomial_v_188;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_189> AgradCcdfLogBetaNegBinomial_v_189;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_190> AgradCcdfLogBetaNegBinomial_v_190;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_191> AgradCcdfLogBetaNegBinomial_v_191;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_192> AgradCcdfLogBetaNegBinomial_v_192;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_193> AgradCcdfLogBetaNegBinomial_v_193;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_194> AgradCcdfLogBetaNegBinomial_v_194;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_195> AgradCcdfLogBetaNegBinomial_v_195;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_196> AgradCcdfLogBetaNegBinomial_v_196;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_197> AgradCcdfLogBetaNegBinomial_v_197;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_198> AgradCcdfLogBetaNegBinomial_v_198;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_199> AgradCcdfLogBetaNegBinomial_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_100, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_101, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_102, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_103, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_104, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_105, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_106, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_107, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_108, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_109, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_110, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_111, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_112, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_113, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_114, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_115, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_116, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_117, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_118, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_119, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_120, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_121, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_122, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_123, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_124, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_125, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_126, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_127, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_128, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_129, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_130, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_131, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_132, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_133, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_134, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_135, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_136, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_137, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_138, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_139, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_140, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_141, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_142, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_143, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_144, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_145, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_146, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_147, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_148, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_149, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_150, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_151, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_152, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_153, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_154, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_155, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_156, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_157, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_158, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_159, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_160, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_161, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_162, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_163, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_164, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_165, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_166, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_167, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_168, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_169, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_170, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_171, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_172, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_173, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_174, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_175, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_176, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_177, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_178, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_179, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_180, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_181, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_182, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_183, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_184, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_185, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_186, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_187, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_188, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_189, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_190, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_191, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_192, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_193, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_194, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_195, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_196, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_197, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_198, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_199, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_199);
+
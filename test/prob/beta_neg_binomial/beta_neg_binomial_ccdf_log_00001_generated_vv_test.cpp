@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<int, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<int, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<int, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<int, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<int, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<int, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<int, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<int, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<int, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<int, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<int, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<int, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<int, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<int, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<int, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<int, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<int, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<int, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<int, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<int, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<int, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<int, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<int>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<int>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<int>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<int>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<int>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_100> AgradCcdfLogBetaNegBinomial_vv_100;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_101> AgradCcdfLogBetaNegBinomial_vv_101;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_102> AgradCcdfLogBetaNegBinomial_vv_102;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_103> AgradCcdfLogBetaNegBinomial_vv_103;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_104> AgradCcdfLogBetaNegBinomial_vv_104;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_105> AgradCcdfLogBetaNegBinomial_vv_105;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_106> AgradCcdfLogBetaNegBinomial_vv_106;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_107> AgradCcdfLogBetaNegBinomial_vv_107;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_108> AgradCcdfLogBetaNegBinomial_vv_108;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_109> AgradCcdfLogBetaNegBinomial_vv_109;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_110> AgradCcdfLogBetaNegBinomial_vv_110;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_111> AgradCcdfLogBetaNegBinomial_vv_111;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_112> AgradCcdfLogBetaNegBinomial_vv_112;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_113> AgradCcdfLogBetaNegBinomial_vv_113;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_114> AgradCcdfLogBetaNegBinomial_vv_114;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_115> AgradCcdfLogBetaNegBinomial_vv_115;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_116> AgradCcdfLogBetaNegBinomial_vv_116;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_117> AgradCcdfLogBetaNegBinomial_vv_117;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_118> AgradCcdfLogBetaNegBinomial_vv_118;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_119> AgradCcdfLogBetaNegBinomial_vv_119;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_120> AgradCcdfLogBetaNegBinomial_vv_120;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_121> AgradCcdfLogBetaNegBinomial_vv_121;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_122> AgradCcdfLogBetaNegBinomial_vv_122;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_123> AgradCcdfLogBetaNegBinomial_vv_123;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_124> AgradCcdfLogBetaNegBinomial_vv_124;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_125> AgradCcdfLogBetaNegBinomial_vv_125;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_126> AgradCcdfLogBetaNegBinomial_vv_126;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_127> AgradCcdfLogBetaNegBinomial_vv_127;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_128> AgradCcdfLogBetaNegBinomial_vv_128;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_129> AgradCcdfLogBetaNegBinomial_vv_129;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_130> AgradCcdfLogBetaNegBinomial_vv_130;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_131> AgradCcdfLogBetaNegBinomial_vv_131;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_132> AgradCcdfLogBetaNegBinomial_vv_132;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_133> AgradCcdfLogBetaNegBinomial_vv_133;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_134> AgradCcdfLogBetaNegBinomial_vv_134;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_135> AgradCcdfLogBetaNegBinomial_vv_135;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_136> AgradCcdfLogBetaNegBinomial_vv_136;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_137> AgradCcdfLogBetaNegBinomial_vv_137;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_138> AgradCcdfLogBetaNegBinomial_vv_138;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_139> AgradCcdfLogBetaNegBinomial_vv_139;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_140> AgradCcdfLogBetaNegBinomial_vv_140;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_141> AgradCcdfLogBetaNegBinomial_vv_141;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_142> AgradCcdfLogBetaNegBinomial_vv_142;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_143> AgradCcdfLogBetaNegBinomial_vv_143;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_144> AgradCcdfLogBetaNegBinomial_vv_144;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_145> AgradCcdfLogBetaNegBinomial_vv_145;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_146> AgradCcdfLogBetaNegBinomial_vv_146;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_147> AgradCcdfLogBetaNegBinomial_vv_147;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_148> AgradCcdfLogBetaNegBinomial_vv_148;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_149> AgradCcdfLogBetaNegBinomial_vv_149;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_150> AgradCcdfLogBetaNegBinomial_vv_150;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_151> AgradCcdfLogBetaNegBinomial_vv_151;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_152> AgradCcdfLogBetaNegBinomial_vv_152;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_153> AgradCcdfLogBetaNegBinomial_vv_153;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_154> AgradCcdfLogBetaNegBinomial_vv_154;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_155> AgradCcdfLogBetaNegBinomial_vv_155;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_156> AgradCcdfLogBetaNegBinomial_vv_156;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_157> AgradCcdfLogBetaNegBinomial_vv_157;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_158> AgradCcdfLogBetaNegBinomial_vv_158;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_159> AgradCcdfLogBetaNegBinomial_vv_159;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_160> AgradCcdfLogBetaNegBinomial_vv_160;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_161> AgradCcdfLogBetaNegBinomial_vv_161;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_162> AgradCcdfLogBetaNegBinomial_vv_162;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_163> AgradCcdfLogBetaNegBinomial_vv_163;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_164> AgradCcdfLogBetaNegBinomial_vv_164;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_165> AgradCcdfLogBetaNegBinomial_vv_165;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_166> AgradCcdfLogBetaNegBinomial_vv_166;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_167> AgradCcdfLogBetaNegBinomial_vv_167;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_168> AgradCcdfLogBetaNegBinomial_vv_168;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_169> AgradCcdfLogBetaNegBinomial_vv_169;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_170> AgradCcdfLogBetaNegBinomial_vv_170;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_171> AgradCcdfLogBetaNegBinomial_vv_171;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_172> AgradCcdfLogBetaNegBinomial_vv_172;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_173> AgradCcdfLogBetaNegBinomial_vv_173;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_174> AgradCcdfLogBetaNegBinomial_vv_174;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_175> AgradCcdfLogBetaNegBinomial_vv_175;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_176> AgradCcdfLogBetaNegBinomial_vv_176;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_177> AgradCcdfLogBetaNegBinomial_vv_177;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_178> AgradCcdfLogBetaNegBinomial_vv_178;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_179> AgradCcdfLogBetaNegBinomial_vv_179;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_180> AgradCcdfLogBetaNegBinomial_vv_180;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_181> AgradCcdfLogBetaNegBinomial_vv_181;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_182> AgradCcdfLogBetaNegBinomial_vv_182;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_183> AgradCcdfLogBetaNegBinomial_vv_183;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_184> AgradCcdfLogBetaNegBinomial_vv_184;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_185> AgradCcdfLogBetaNegBinomial_vv_185;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_186> AgradCcdfLogBetaNegBinomial_vv_186;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_187> AgradCcdfLogBetaNegBinomial_vv_187;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_188> AgradCcdfLogBetaNegBinomial_vv_188;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_189> AgradCcdfLogBetaNegBinomial_vv_189;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_190> AgradCcdfLogBetaNegBinomial_vv_190;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_191> AgradCcdfLogBetaNegBinomial_vv_191;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_192> AgradCcdfLogBetaNegBinomial_vv_192;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_193> AgradCcdfLogBetaNegBinomial_vv_193;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_194> AgradCcdfLogBetaNegBinomial_vv_194;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_195> AgradCcdfLogBetaNegBinomial_vv_195;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_196> AgradCcdfLogBetaNegBinomial_vv_196;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_197> AgradCcdfLogBetaNegBinomial_vv_197;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_198> AgradCcdfLogBetaNegBinomial_vv_198;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_199> AgradCcdfLogBetaNegBinomial_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_189, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_190, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_191, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_192, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_193, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_194, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_195, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_196, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_197, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_198, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_199, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_199);
+
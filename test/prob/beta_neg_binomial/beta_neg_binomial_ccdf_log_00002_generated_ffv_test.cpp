@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_200> AgradCcdfLogBetaNegBinomial_ffv_200;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_201> AgradCcdfLogBetaNegBinomial_ffv_201;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_202> AgradCcdfLogBetaNegBinomial_ffv_202;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_203> AgradCcdfLogBetaNegBinomial_ffv_203;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_204> AgradCcdfLogBetaNegBinomial_ffv_204;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_205> AgradCcdfLogBetaNegBinomial_ffv_205;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_206> AgradCcdfLogBetaNegBinomial_ffv_206;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_207> AgradCcdfLogBetaNegBinomial_ffv_207;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_208> AgradCcdfLogBetaNegBinomial_ffv_208;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_209> AgradCcdfLogBetaNegBinomial_ffv_209;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_210> AgradCcdfLogBetaNegBinomial_ffv_210;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_211> AgradCcdfLogBetaNegBinomial_ffv_211;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_212> AgradCcdfLogBetaNegBinomial_ffv_212;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_213> AgradCcdfLogBetaNegBinomial_ffv_213;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_214> AgradCcdfLogBetaNegBinomial_ffv_214;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_215> AgradCcdfLogBetaNegBinomial_ffv_215;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_216> AgradCcdfLogBetaNegBinomial_ffv_216;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_217> AgradCcdfLogBetaNegBinomial_ffv_217;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_218> AgradCcdfLogBetaNegBinomial_ffv_218;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_219> AgradCcdfLogBetaNegBinomial_ffv_219;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_220> AgradCcdfLogBetaNegBinomial_ffv_220;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_221> AgradCcdfLogBetaNegBinomial_ffv_221;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_222> AgradCcdfLogBetaNegBinomial_ffv_222;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_223> AgradCcdfLogBetaNegBinomial_ffv_223;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_224> AgradCcdfLogBetaNegBinomial_ffv_224;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_225> AgradCcdfLogBetaNegBinomial_ffv_225;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_226> AgradCcdfLogBetaNegBinomial_ffv_226;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_227> AgradCcdfLogBetaNegBinomial_ffv_227;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_228> AgradCcdfLogBetaNegBinomial_ffv_228;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_229> AgradCcdfLogBetaNegBinomial_ffv_229;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_230> AgradCcdfLogBetaNegBinomial_ffv_230;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_231> AgradCcdfLogBetaNegBinomial_ffv_231;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_232> AgradCcdfLogBetaNegBinomial_ffv_232;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_233> AgradCcdfLogBetaNegBinomial_ffv_233;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_234> AgradCcdfLogBetaNegBinomial_ffv_234;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_235> AgradCcdfLogBetaNegBinomial_ffv_235;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_236> AgradCcdfLogBetaNegBinomial_ffv_236;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_237> AgradCcdfLogBetaNegBinomial_ffv_237;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_238> AgradCcdfLogBetaNegBinomial_ffv_238;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_239> AgradCcdfLogBetaNegBinomial_ffv_239;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_240> AgradCcdfLogBetaNegBinomial_ffv_240;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_241> AgradCcdfLogBetaNegBinomial_ffv_241;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_242> AgradCcdfLogBetaNegBinomial_ffv_242;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_243> AgradCcdfLogBetaNegBinomial_ffv_243;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_244> AgradCcdfLogBetaNegBinomial_ffv_244;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_245> AgradCcdfLogBetaNegBinomial_ffv_245;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_246> AgradCcdfLogBetaNegBinomial_ffv_246;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_247> AgradCcdfLogBetaNegBinomial_ffv_247;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_248> AgradCcdfLogBetaNegBinomial_ffv_248;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_249> AgradCcdfLogBetaNegBinomial_ffv_249;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_250> AgradCcdfLogBetaNegBinomial_ffv_250;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_251> AgradCcdfLogBetaNegBinomial_ffv_251;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_252> AgradCcdfLogBetaNegBinomial_ffv_252;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_253> AgradCcdfLogBetaNegBinomial_ffv_253;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_254> AgradCcdfLogBetaNegBinomial_ffv_254;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_255> AgradCcdfLogBetaNegBinomial_ffv_255;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_256> AgradCcdfLogBetaNegBinomial_ffv_256;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_257> AgradCcdfLogBetaNegBinomial_ffv_257;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_258> AgradCcdfLogBetaNegBinomial_ffv_258;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_259> AgradCcdfLogBetaNegBinomial_ffv_259;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_260> AgradCcdfLogBetaNegBinomial_ffv_260;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_261> AgradCcdfLogBetaNegBinomial_ffv_261;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_262> AgradCcdfLogBetaNegBinomial_ffv_262;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_263> AgradCcdfLogBetaNegBinomial_ffv_263;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_264> AgradCcdfLogBetaNegBinomial_ffv_264;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_265> AgradCcdfLogBetaNegBinomial_ffv_265;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_266> AgradCcdfLogBetaNegBinomial_ffv_266;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_267> AgradCcdfLogBetaNegBinomial_ffv_267;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_268> AgradCcdfLogBetaNegBinomial_ffv_268;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_269> AgradCcdfLogBetaNegBinomial_ffv_269;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_270> AgradCcdfLogBetaNegBinomial_ffv_270;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_271> AgradCcdfLogBetaNegBinomial_ffv_271;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_272> AgradCcdfLogBetaNegBinomial_ffv_272;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_273> AgradCcdfLogBetaNegBinomial_ffv_273;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_274> AgradCcdfLogBetaNegBinomial_ffv_274;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_275> AgradCcdfLogBetaNegBinomial_ffv_275;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_276> AgradCcdfLogBetaNegBinomial_ffv_276;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_277> AgradCcdfLogBetaNegBinomial_ffv_277;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_278> AgradCcdfLogBetaNegBinomial_ffv_278;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_279> AgradCcdfLogBetaNegBinomial_ffv_279;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_280> AgradCcdfLogBetaNegBinomial_ffv_280;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_281> AgradCcdfLogBetaNegBinomial_ffv_281;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_282> AgradCcdfLogBetaNegBinomial_ffv_282;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_283> AgradCcdfLogBetaNegBinomial_ffv_283;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_284> AgradCcdfLogBetaNegBinomial_ffv_284;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_285> AgradCcdfLogBetaNegBinomial_ffv_285;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_286> AgradCcdfLogBetaNegBinomial_ffv_286;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_287> AgradCcdfLogBetaNegBinomial_ffv_287;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_288> AgradCcdfLogBetaNegBinomial_ffv_288;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_289> AgradCcdfLogBetaNegBinomial_ffv_289;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_290> AgradCcdfLogBetaNegBinomial_ffv_290;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_291> AgradCcdfLogBetaNegBinomial_ffv_291;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_292> AgradCcdfLogBetaNegBinomial_ffv_292;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_293> AgradCcdfLogBetaNegBinomial_ffv_293;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_294> AgradCcdfLogBetaNegBinomial_ffv_294;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_295> AgradCcdfLogBetaNegBinomial_ffv_295;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_296> AgradCcdfLogBetaNegBinomial_ffv_296;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_297> AgradCcdfLogBetaNegBinomial_ffv_297;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_298> AgradCcdfLogBetaNegBinomial_ffv_298;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_299> AgradCcdfLogBetaNegBinomial_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_200, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_201, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_202, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_203, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_204, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_205, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_206, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_207, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_208, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_209, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_210, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_211, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_212, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_213, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_214, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_215, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_216, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_217, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_218, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_219, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_220, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_221, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_222, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_223, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_224, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_225, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_226, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_227, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_228, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_229, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_230, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_231, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_232, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_233, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_234, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_235, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_236, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_237, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_238, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_239, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_240, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_241, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_242, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_243, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_244, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_245, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_246, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_247, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_248, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_249, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_250, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_251, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_252, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_253, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_254, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_255, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_256, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_257, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_258, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_259, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_260, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_261, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_262, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_263, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_264, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_265, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_266, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_267, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_268, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_269, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_270, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_271, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_272, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_273, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_274, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_275, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_276, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_277, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_278, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_279, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_280, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_281, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_282, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_283, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_284, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_285, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_286, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_287, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_288, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_289, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_290, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_291, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_292, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_293, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_294, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_295, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_296, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_297, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_298, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_299, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_299);
+
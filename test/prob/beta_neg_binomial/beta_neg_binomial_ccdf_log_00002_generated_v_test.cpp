@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<int>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<int>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<int>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<int>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<int>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<int>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<int>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<int>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<int>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<int>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<int>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<int>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_200> AgradCcdfLogBetaNegBinomial_v_200;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_201> AgradCcdfLogBetaNegBinomial_v_201;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_202> AgradCcdfLogBetaNegBinomial_v_202;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_203> AgradCcdfLogBetaNegBinomial_v_203;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_204> AgradCcdfLogBetaNegBinomial_v_204;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_205> AgradCcdfLogBetaNegBinomial_v_205;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_206> AgradCcdfLogBetaNegBinomial_v_206;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_207> AgradCcdfLogBetaNegBinomial_v_207;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_208> AgradCcdfLogBetaNegBinomial_v_208;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_209> AgradCcdfLogBetaNegBinomial_v_209;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_210> AgradCcdfLogBetaNegBinomial_v_210;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_211> AgradCcdfLogBetaNegBinomial_v_211;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_212> AgradCcdfLogBetaNegBinomial_v_212;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_213> AgradCcdfLogBetaNegBinomial_v_213;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_214> AgradCcdfLogBetaNegBinomial_v_214;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_215> AgradCcdfLogBetaNegBinomial_v_215;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_216> AgradCcdfLogBetaNegBinomial_v_216;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_217> AgradCcdfLogBetaNegBinomial_v_217;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_218> AgradCcdfLogBetaNegBinomial_v_218;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_219> AgradCcdfLogBetaNegBinomial_v_219;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_220> AgradCcdfLogBetaNegBinomial_v_220;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_221> AgradCcdfLogBetaNegBinomial_v_221;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_222> AgradCcdfLogBetaNegBinomial_v_222;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_223> AgradCcdfLogBetaNegBinomial_v_223;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_224> AgradCcdfLogBetaNegBinomial_v_224;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_225> AgradCcdfLogBetaNegBinomial_v_225;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_226> AgradCcdfLogBetaNegBinomial_v_226;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_227> AgradCcdfLogBetaNegBinomial_v_227;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_228> AgradCcdfLogBetaNegBinomial_v_228;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_229> AgradCcdfLogBetaNegBinomial_v_229;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_230> AgradCcdfLogBetaNegBinomial_v_230;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_231> AgradCcdfLogBetaNegBinomial_v_231;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_232> AgradCcdfLogBetaNegBinomial_v_232;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_233> AgradCcdfLogBetaNegBinomial_v_233;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_234> AgradCcdfLogBetaNegBinomial_v_234;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_235> AgradCcdfLogBetaNegBinomial_v_235;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_236> AgradCcdfLogBetaNegBinomial_v_236;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_237> AgradCcdfLogBetaNegBinomial_v_237;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_238> AgradCcdfLogBetaNegBinomial_v_238;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_239> AgradCcdfLogBetaNegBinomial_v_239;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_240> AgradCcdfLogBetaNegBinomial_v_240;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_241> AgradCcdfLogBetaNegBinomial_v_241;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_242> AgradCcdfLogBetaNegBinomial_v_242;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_243> AgradCcdfLogBetaNegBinomial_v_243;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_244> AgradCcdfLogBetaNegBinomial_v_244;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_245> AgradCcdfLogBetaNegBinomial_v_245;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_246> AgradCcdfLogBetaNegBinomial_v_246;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_247> AgradCcdfLogBetaNegBinomial_v_247;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_248> AgradCcdfLogBetaNegBinomial_v_248;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_249> AgradCcdfLogBetaNegBinomial_v_249;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_250> AgradCcdfLogBetaNegBinomial_v_250;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_251> AgradCcdfLogBetaNegBinomial_v_251;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_252> AgradCcdfLogBetaNegBinomial_v_252;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_253> AgradCcdfLogBetaNegBinomial_v_253;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_254> AgradCcdfLogBetaNegBinomial_v_254;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_255> AgradCcdfLogBetaNegBinomial_v_255;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_256> AgradCcdfLogBetaNegBinomial_v_256;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_257> AgradCcdfLogBetaNegBinomial_v_257;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_258> AgradCcdfLogBetaNegBinomial_v_258;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_259> AgradCcdfLogBetaNegBinomial_v_259;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_260> AgradCcdfLogBetaNegBinomial_v_260;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_261> AgradCcdfLogBetaNegBinomial_v_261;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_262> AgradCcdfLogBetaNegBinomial_v_262;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_263> AgradCcdfLogBetaNegBinomial_v_263;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_264> AgradCcdfLogBetaNegBinomial_v_264;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_265> AgradCcdfLogBetaNegBinomial_v_265;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_266> AgradCcdfLogBetaNegBinomial_v_266;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_267> AgradCcdfLogBetaNegBinomial_v_267;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_268> AgradCcdfLogBetaNegBinomial_v_268;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_269> AgradCcdfLogBetaNegBinomial_v_269;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_270> AgradCcdfLogBetaNegBinomial_v_270;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_271> AgradCcdfLogBetaNegBinomial_v_271;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_272> AgradCcdfLogBetaNegBinomial_v_272;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_273> AgradCcdfLogBetaNegBinomial_v_273;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_274> AgradCcdfLogBetaNegBinomial_v_274;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_275> AgradCcdfLogBetaNegBinomial_v_275;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_276> AgradCcdfLogBetaNegBinomial_v_276;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_277> AgradCcdfLogBetaNegBinomial_v_277;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_278> AgradCcdfLogBetaNegBinomial_v_278;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_279> AgradCcdfLogBetaNegBinomial_v_279;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_280> AgradCcdfLogBetaNegBinomial_v_280;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_281> AgradCcdfLogBetaNegBinomial_v_281;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_282> AgradCcdfLogBetaNegBinomial_v_282;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_283> AgradCcdfLogBetaNegBinomial_v_283;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_284> AgradCcdfLogBetaNegBinomial_v_284;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_285> AgradCcdfLogBetaNegBinomial_v_285;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_286> AgradCcdfLogBetaNegBinomial_v_286;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_287> AgradCcdfLogBetaNegBinomial_v_287;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_288> AgradCcdfLogBetaNegBinomial_v_288;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_289> AgradCcdfLogBetaNegBinomial_v_289;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_290> AgradCcdfLogBetaNegBinomial_v_290;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_291> AgradCcdfLogBetaNegBinomial_v_291;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_292> AgradCcdfLogBetaNegBinomial_v_292;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_293> AgradCcdfLogBetaNegBinomial_v_293;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_294> AgradCcdfLogBetaNegBinomial_v_294;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_295> AgradCcdfLogBetaNegBinomial_v_295;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_296> AgradCcdfLogBetaNegBinomial_v_296;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_297> AgradCcdfLogBetaNegBinomial_v_297;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_298> AgradCcdfLogBetaNegBinomial_v_298;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_299> AgradCcdfLogBetaNegBinomial_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_200, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_201, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_202, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_203, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_204, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_205, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_206, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_207, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_208, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_209, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_210, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_211, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_212, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_213, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_214, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_215, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_216, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_217, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_218, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_219, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_220, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_221, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_222, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_223, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_224, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_225, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_226, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_227, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_228, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_229, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_230, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_231, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_232, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_233, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_234, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_235, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_236, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_237, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_238, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_239, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_240, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_241, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_242, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_243, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_244, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_245, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_246, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_247, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_248, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_249, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_250, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_251, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_252, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_253, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_254, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_255, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_256, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_257, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_258, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_259, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_260, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_261, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_262, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_263, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_264, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_265, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_266, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_267, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_268, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_269, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_270, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_271, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_272, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_273, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_274, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_275, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_276, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_277, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_278, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_279, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_280, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_281, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_282, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_283, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_284, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_285, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_286, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_287, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_288, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_289, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_290, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_291, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_292, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_293, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_294, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_295, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_296, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_297, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_298, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_299, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_299);
+
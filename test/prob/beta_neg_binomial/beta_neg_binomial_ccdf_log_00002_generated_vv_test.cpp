@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<int>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<int>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<int>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<int>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<int>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<int>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<int>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<int>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<int>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<int>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<int>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<int>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<int>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<int>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<int>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_200> AgradCcdfLogBetaNegBinomial_vv_200;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_201> AgradCcdfLogBetaNegBinomial_vv_201;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_202> AgradCcdfLogBetaNegBinomial_vv_202;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_203> AgradCcdfLogBetaNegBinomial_vv_203;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_204> AgradCcdfLogBetaNegBinomial_vv_204;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_205> AgradCcdfLogBetaNegBinomial_vv_205;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_206> AgradCcdfLogBetaNegBinomial_vv_206;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_207> AgradCcdfLogBetaNegBinomial_vv_207;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_208> AgradCcdfLogBetaNegBinomial_vv_208;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_209> AgradCcdfLogBetaNegBinomial_vv_209;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_210> AgradCcdfLogBetaNegBinomial_vv_210;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_211> AgradCcdfLogBetaNegBinomial_vv_211;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_212> AgradCcdfLogBetaNegBinomial_vv_212;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_213> AgradCcdfLogBetaNegBinomial_vv_213;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_214> AgradCcdfLogBetaNegBinomial_vv_214;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_215> AgradCcdfLogBetaNegBinomial_vv_215;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_216> AgradCcdfLogBetaNegBinomial_vv_216;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_217> AgradCcdfLogBetaNegBinomial_vv_217;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_218> AgradCcdfLogBetaNegBinomial_vv_218;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_219> AgradCcdfLogBetaNegBinomial_vv_219;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_220> AgradCcdfLogBetaNegBinomial_vv_220;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_221> AgradCcdfLogBetaNegBinomial_vv_221;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_222> AgradCcdfLogBetaNegBinomial_vv_222;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_223> AgradCcdfLogBetaNegBinomial_vv_223;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_224> AgradCcdfLogBetaNegBinomial_vv_224;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_225> AgradCcdfLogBetaNegBinomial_vv_225;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_226> AgradCcdfLogBetaNegBinomial_vv_226;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_227> AgradCcdfLogBetaNegBinomial_vv_227;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_228> AgradCcdfLogBetaNegBinomial_vv_228;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_229> AgradCcdfLogBetaNegBinomial_vv_229;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_230> AgradCcdfLogBetaNegBinomial_vv_230;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_231> AgradCcdfLogBetaNegBinomial_vv_231;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_232> AgradCcdfLogBetaNegBinomial_vv_232;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_233> AgradCcdfLogBetaNegBinomial_vv_233;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_234> AgradCcdfLogBetaNegBinomial_vv_234;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_235> AgradCcdfLogBetaNegBinomial_vv_235;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_236> AgradCcdfLogBetaNegBinomial_vv_236;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_237> AgradCcdfLogBetaNegBinomial_vv_237;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_238> AgradCcdfLogBetaNegBinomial_vv_238;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_239> AgradCcdfLogBetaNegBinomial_vv_239;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_240> AgradCcdfLogBetaNegBinomial_vv_240;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_241> AgradCcdfLogBetaNegBinomial_vv_241;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_242> AgradCcdfLogBetaNegBinomial_vv_242;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_243> AgradCcdfLogBetaNegBinomial_vv_243;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_244> AgradCcdfLogBetaNegBinomial_vv_244;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_245> AgradCcdfLogBetaNegBinomial_vv_245;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_246> AgradCcdfLogBetaNegBinomial_vv_246;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_247> AgradCcdfLogBetaNegBinomial_vv_247;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_248> AgradCcdfLogBetaNegBinomial_vv_248;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_249> AgradCcdfLogBetaNegBinomial_vv_249;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_250> AgradCcdfLogBetaNegBinomial_vv_250;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_251> AgradCcdfLogBetaNegBinomial_vv_251;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_252> AgradCcdfLogBetaNegBinomial_vv_252;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_253> AgradCcdfLogBetaNegBinomial_vv_253;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_254> AgradCcdfLogBetaNegBinomial_vv_254;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_255> AgradCcdfLogBetaNegBinomial_vv_255;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_256> AgradCcdfLogBetaNegBinomial_vv_256;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_257> AgradCcdfLogBetaNegBinomial_vv_257;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_258> AgradCcdfLogBetaNegBinomial_vv_258;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_259> AgradCcdfLogBetaNegBinomial_vv_259;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_260> AgradCcdfLogBetaNegBinomial_vv_260;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_261> AgradCcdfLogBetaNegBinomial_vv_261;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_262> AgradCcdfLogBetaNegBinomial_vv_262;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_263> AgradCcdfLogBetaNegBinomial_vv_263;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_264> AgradCcdfLogBetaNegBinomial_vv_264;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_265> AgradCcdfLogBetaNegBinomial_vv_265;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_266> AgradCcdfLogBetaNegBinomial_vv_266;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_267> AgradCcdfLogBetaNegBinomial_vv_267;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_268> AgradCcdfLogBetaNegBinomial_vv_268;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_269> AgradCcdfLogBetaNegBinomial_vv_269;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_270> AgradCcdfLogBetaNegBinomial_vv_270;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_271> AgradCcdfLogBetaNegBinomial_vv_271;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_272> AgradCcdfLogBetaNegBinomial_vv_272;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_273> AgradCcdfLogBetaNegBinomial_vv_273;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_274> AgradCcdfLogBetaNegBinomial_vv_274;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_275> AgradCcdfLogBetaNegBinomial_vv_275;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_276> AgradCcdfLogBetaNegBinomial_vv_276;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_277> AgradCcdfLogBetaNegBinomial_vv_277;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_278> AgradCcdfLogBetaNegBinomial_vv_278;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_279> AgradCcdfLogBetaNegBinomial_vv_279;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_280> AgradCcdfLogBetaNegBinomial_vv_280;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_281> AgradCcdfLogBetaNegBinomial_vv_281;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_282> AgradCcdfLogBetaNegBinomial_vv_282;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_283> AgradCcdfLogBetaNegBinomial_vv_283;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_284> AgradCcdfLogBetaNegBinomial_vv_284;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_285> AgradCcdfLogBetaNegBinomial_vv_285;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_286> AgradCcdfLogBetaNegBinomial_vv_286;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_287> AgradCcdfLogBetaNegBinomial_vv_287;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_288> AgradCcdfLogBetaNegBinomial_vv_288;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_289> AgradCcdfLogBetaNegBinomial_vv_289;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_290> AgradCcdfLogBetaNegBinomial_vv_290;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_291> AgradCcdfLogBetaNegBinomial_vv_291;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_292> AgradCcdfLogBetaNegBinomial_vv_292;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_293> AgradCcdfLogBetaNegBinomial_vv_293;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_294> AgradCcdfLogBetaNegBinomial_vv_294;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_295> AgradCcdfLogBetaNegBinomial_vv_295;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_296> AgradCcdfLogBetaNegBinomial_vv_296;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_297> AgradCcdfLogBetaNegBinomial_vv_297;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_298> AgradCcdfLogBetaNegBinomial_vv_298;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_299> AgradCcdfLogBetaNegBinomial_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_200, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_201, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_202, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_203, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_204, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_205, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_206, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_207, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_208, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_209, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_210, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_211, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_212, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_213, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_214, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_215, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_216, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_217, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_218, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_219, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_220, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_221, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_222, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_223, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_224, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_225, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_226, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_227, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_228, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_229, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_230, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_231, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_232, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_233, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_234, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_235, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_236, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_237, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_238, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_239, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_240, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_241, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_242, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_243, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_244, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_245, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_246, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_247, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_248, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_249, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_250, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_251, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_252, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_253, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_254, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_255, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_256, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_257, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_258, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_259, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_260, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_261, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_262, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_263, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_264, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_265, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_266, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_267, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_268, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_269, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_270, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_271, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_272, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_273, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_274, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_275, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_276, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_277, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_278, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_279, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_280, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_281, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_282, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_283, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_284, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_285, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_286, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_287, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_288, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_289, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_290, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_291, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_292, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_293, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_294, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_295, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_296, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_297, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_298, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_299, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_300> AgradCcdfLogBetaNegBinomial_ffv_300;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_301> AgradCcdfLogBetaNegBinomial_ffv_301;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_302> AgradCcdfLogBetaNegBinomial_ffv_302;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_303> AgradCcdfLogBetaNegBinomial_ffv_303;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_304> AgradCcdfLogBetaNegBinomial_ffv_304;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_305> AgradCcdfLogBetaNegBinomial_ffv_305;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_306> AgradCcdfLogBetaNegBinomial_ffv_306;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_307> AgradCcdfLogBetaNegBinomial_ffv_307;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_308> AgradCcdfLogBetaNegBinomial_ffv_308;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_309> AgradCcdfLogBetaNegBinomial_ffv_309;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_310> AgradCcdfLogBetaNegBinomial_ffv_310;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_311> AgradCcdfLogBetaNegBinomial_ffv_311;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_312> AgradCcdfLogBetaNegBinomial_ffv_312;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_313> AgradCcdfLogBetaNegBinomial_ffv_313;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_314> AgradCcdfLogBetaNegBinomial_ffv_314;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_315> AgradCcdfLogBetaNegBinomial_ffv_315;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_316> AgradCcdfLogBetaNegBinomial_ffv_316;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_317> AgradCcdfLogBetaNegBinomial_ffv_317;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_318> AgradCcdfLogBetaNegBinomial_ffv_318;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_319> AgradCcdfLogBetaNegBinomial_ffv_319;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_320> AgradCcdfLogBetaNegBinomial_ffv_320;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_321> AgradCcdfLogBetaNegBinomial_ffv_321;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_322> AgradCcdfLogBetaNegBinomial_ffv_322;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_323> AgradCcdfLogBetaNegBinomial_ffv_323;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_324> AgradCcdfLogBetaNegBinomial_ffv_324;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_325> AgradCcdfLogBetaNegBinomial_ffv_325;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_326> AgradCcdfLogBetaNegBinomial_ffv_326;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_327> AgradCcdfLogBetaNegBinomial_ffv_327;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_328> AgradCcdfLogBetaNegBinomial_ffv_328;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_329> AgradCcdfLogBetaNegBinomial_ffv_329;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_330> AgradCcdfLogBetaNegBinomial_ffv_330;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_331> AgradCcdfLogBetaNegBinomial_ffv_331;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_332> AgradCcdfLogBetaNegBinomial_ffv_332;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_333> AgradCcdfLogBetaNegBinomial_ffv_333;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_334> AgradCcdfLogBetaNegBinomial_ffv_334;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_335> AgradCcdfLogBetaNegBinomial_ffv_335;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_336> AgradCcdfLogBetaNegBinomial_ffv_336;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_337> AgradCcdfLogBetaNegBinomial_ffv_337;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_338> AgradCcdfLogBetaNegBinomial_ffv_338;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_339> AgradCcdfLogBetaNegBinomial_ffv_339;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_340> AgradCcdfLogBetaNegBinomial_ffv_340;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_341> AgradCcdfLogBetaNegBinomial_ffv_341;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_342> AgradCcdfLogBetaNegBinomial_ffv_342;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_343> AgradCcdfLogBetaNegBinomial_ffv_343;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_344> AgradCcdfLogBetaNegBinomial_ffv_344;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_345> AgradCcdfLogBetaNegBinomial_ffv_345;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_346> AgradCcdfLogBetaNegBinomial_ffv_346;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_347> AgradCcdfLogBetaNegBinomial_ffv_347;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_348> AgradCcdfLogBetaNegBinomial_ffv_348;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_349> AgradCcdfLogBetaNegBinomial_ffv_349;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_350> AgradCcdfLogBetaNegBinomial_ffv_350;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_351> AgradCcdfLogBetaNegBinomial_ffv_351;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_352> AgradCcdfLogBetaNegBinomial_ffv_352;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_353> AgradCcdfLogBetaNegBinomial_ffv_353;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_354> AgradCcdfLogBetaNegBinomial_ffv_354;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_355> AgradCcdfLogBetaNegBinomial_ffv_355;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_356> AgradCcdfLogBetaNegBinomial_ffv_356;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_357> AgradCcdfLogBetaNegBinomial_ffv_357;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_358> AgradCcdfLogBetaNegBinomial_ffv_358;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_359> AgradCcdfLogBetaNegBinomial_ffv_359;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_360> AgradCcdfLogBetaNegBinomial_ffv_360;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_361> AgradCcdfLogBetaNegBinomial_ffv_361;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_362> AgradCcdfLogBetaNegBinomial_ffv_362;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_363> AgradCcdfLogBetaNegBinomial_ffv_363;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_364> AgradCcdfLogBetaNegBinomial_ffv_364;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_365> AgradCcdfLogBetaNegBinomial_ffv_365;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_366> AgradCcdfLogBetaNegBinomial_ffv_366;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_367> AgradCcdfLogBetaNegBinomial_ffv_367;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_368> AgradCcdfLogBetaNegBinomial_ffv_368;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_369> AgradCcdfLogBetaNegBinomial_ffv_369;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_370> AgradCcdfLogBetaNegBinomial_ffv_370;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_371> AgradCcdfLogBetaNegBinomial_ffv_371;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_372> AgradCcdfLogBetaNegBinomial_ffv_372;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_373> AgradCcdfLogBetaNegBinomial_ffv_373;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_374> AgradCcdfLogBetaNegBinomial_ffv_374;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_375> AgradCcdfLogBetaNegBinomial_ffv_375;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_376> AgradCcdfLogBetaNegBinomial_ffv_376;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_377> AgradCcdfLogBetaNegBinomial_ffv_377;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_378> AgradCcdfLogBetaNegBinomial_ffv_378;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_379> AgradCcdfLogBetaNegBinomial_ffv_379;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_380> AgradCcdfLogBetaNegBinomial_ffv_380;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_381> AgradCcdfLogBetaNegBinomial_ffv_381;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_382> AgradCcdfLogBetaNegBinomial_ffv_382;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_383> AgradCcdfLogBetaNegBinomial_ffv_383;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_384> AgradCcdfLogBetaNegBinomial_ffv_384;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_385> AgradCcdfLogBetaNegBinomial_ffv_385;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_386> AgradCcdfLogBetaNegBinomial_ffv_386;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_387> AgradCcdfLogBetaNegBinomial_ffv_387;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_388> AgradCcdfLogBetaNegBinomial_ffv_388;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_389> AgradCcdfLogBetaNegBinomial_ffv_389;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_390> AgradCcdfLogBetaNegBinomial_ffv_390;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_391> AgradCcdfLogBetaNegBinomial_ffv_391;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_392> AgradCcdfLogBetaNegBinomial_ffv_392;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_393> AgradCcdfLogBetaNegBinomial_ffv_393;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_394> AgradCcdfLogBetaNegBinomial_ffv_394;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_395> AgradCcdfLogBetaNegBinomial_ffv_395;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_396> AgradCcdfLogBetaNegBinomial_ffv_396;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_397> AgradCcdfLogBetaNegBinomial_ffv_397;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_398> AgradCcdfLogBetaNegBinomial_ffv_398;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_399> AgradCcdfLogBetaNegBinomial_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_300, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_301, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_302, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_303, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_304, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_305, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_306, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_307, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_308, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_309, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_310, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_311, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_312, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_313, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_314, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_315, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_316, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_317, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_318, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_319, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_320, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_321, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_322, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_323, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_324, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_325, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_326, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_327, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_328, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_329, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_330, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_331, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_332, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_333, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_334, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_335, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_336, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_337, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_338, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_339, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_340, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_341, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_342, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_343, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_344, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_345, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_346, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_347, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_348, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_349, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_350, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_351, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_352, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_353, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_354, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_355, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_356, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_357, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_358, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_359, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_360, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_361, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_362, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_363, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_364, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_365, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_366, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_367, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_368, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_369, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_370, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_371, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_372, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_373, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_374, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_375, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_376, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_377, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_378, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_379, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_380, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_381, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_382, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_383, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_384, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_385, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_386, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_387, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_388, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_389, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_390, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_391, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_392, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_393, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_394, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_395, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_396, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_397, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_398, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_399, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_399);
+
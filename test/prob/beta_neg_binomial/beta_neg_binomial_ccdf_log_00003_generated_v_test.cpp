@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<int>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<int>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<int>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<int>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<int>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<int>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<int>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<int>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<int>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<int>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<int>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<int>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_300> AgradCcdfLogBetaNegBinomial_v_300;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_301> AgradCcdfLogBetaNegBinomial_v_301;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_302> AgradCcdfLogBetaNegBinomial_v_302;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_303> AgradCcdfLogBetaNegBinomial_v_303;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_304> AgradCcdfLogBetaNegBinomial_v_304;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_305> AgradCcdfLogBetaNegBinomial_v_305;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_306> AgradCcdfLogBetaNegBinomial_v_306;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_307> AgradCcdfLogBetaNegBinomial_v_307;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_308> AgradCcdfLogBetaNegBinomial_v_308;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_309> AgradCcdfLogBetaNegBinomial_v_309;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_310> AgradCcdfLogBetaNegBinomial_v_310;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_311> AgradCcdfLogBetaNegBinomial_v_311;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_312> AgradCcdfLogBetaNegBinomial_v_312;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_313> AgradCcdfLogBetaNegBinomial_v_313;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_314> AgradCcdfLogBetaNegBinomial_v_314;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_315> AgradCcdfLogBetaNegBinomial_v_315;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_316> AgradCcdfLogBetaNegBinomial_v_316;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_317> AgradCcdfLogBetaNegBinomial_v_317;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_318> AgradCcdfLogBetaNegBinomial_v_318;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_319> AgradCcdfLogBetaNegBinomial_v_319;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_320> AgradCcdfLogBetaNegBinomial_v_320;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_321> AgradCcdfLogBetaNegBinomial_v_321;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_322> AgradCcdfLogBetaNegBinomial_v_322;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_323> AgradCcdfLogBetaNegBinomial_v_323;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_324> AgradCcdfLogBetaNegBinomial_v_324;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_325> AgradCcdfLogBetaNegBinomial_v_325;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_326> AgradCcdfLogBetaNegBinomial_v_326;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_327> AgradCcdfLogBetaNegBinomial_v_327;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_328> AgradCcdfLogBetaNegBinomial_v_328;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_329> AgradCcdfLogBetaNegBinomial_v_329;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_330> AgradCcdfLogBetaNegBinomial_v_330;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_331> AgradCcdfLogBetaNegBinomial_v_331;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_332> AgradCcdfLogBetaNegBinomial_v_332;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_333> AgradCcdfLogBetaNegBinomial_v_333;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_334> AgradCcdfLogBetaNegBinomial_v_334;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_335> AgradCcdfLogBetaNegBinomial_v_335;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_336> AgradCcdfLogBetaNegBinomial_v_336;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_337> AgradCcdfLogBetaNegBinomial_v_337;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_338> AgradCcdfLogBetaNegBinomial_v_338;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_339> AgradCcdfLogBetaNegBinomial_v_339;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_340> AgradCcdfLogBetaNegBinomial_v_340;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_341> AgradCcdfLogBetaNegBinomial_v_341;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_342> AgradCcdfLogBetaNegBinomial_v_342;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_343> AgradCcdfLogBetaNegBinomial_v_343;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_344> AgradCcdfLogBetaNegBinomial_v_344;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_345> AgradCcdfLogBetaNegBinomial_v_345;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_346> AgradCcdfLogBetaNegBinomial_v_346;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_347> AgradCcdfLogBetaNegBinomial_v_347;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_348> AgradCcdfLogBetaNegBinomial_v_348;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_349> AgradCcdfLogBetaNegBinomial_v_349;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_350> AgradCcdfLogBetaNegBinomial_v_350;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_351> AgradCcdfLogBetaNegBinomial_v_351;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_352> AgradCcdfLogBetaNegBinomial_v_352;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_353> AgradCcdfLogBetaNegBinomial_v_353;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_354> AgradCcdfLogBetaNegBinomial_v_354;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_355> AgradCcdfLogBetaNegBinomial_v_355;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_356> AgradCcdfLogBetaNegBinomial_v_356;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_357> AgradCcdfLogBetaNegBinomial_v_357;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_358> AgradCcdfLogBetaNegBinomial_v_358;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_359> AgradCcdfLogBetaNegBinomial_v_359;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_360> AgradCcdfLogBetaNegBinomial_v_360;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_361> AgradCcdfLogBetaNegBinomial_v_361;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_362> AgradCcdfLogBetaNegBinomial_v_362;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_363> AgradCcdfLogBetaNegBinomial_v_363;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_364> AgradCcdfLogBetaNegBinomial_v_364;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_365> AgradCcdfLogBetaNegBinomial_v_365;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_366> AgradCcdfLogBetaNegBinomial_v_366;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_367> AgradCcdfLogBetaNegBinomial_v_367;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_368> AgradCcdfLogBetaNegBinomial_v_368;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_369> AgradCcdfLogBetaNegBinomial_v_369;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_370> AgradCcdfLogBetaNegBinomial_v_370;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_371> AgradCcdfLogBetaNegBinomial_v_371;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_372> AgradCcdfLogBetaNegBinomial_v_372;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_373> AgradCcdfLogBetaNegBinomial_v_373;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_374> AgradCcdfLogBetaNegBinomial_v_374;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_375> AgradCcdfLogBetaNegBinomial_v_375;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_376> AgradCcdfLogBetaNegBinomial_v_376;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_377> AgradCcdfLogBetaNegBinomial_v_377;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_378> AgradCcdfLogBetaNegBinomial_v_378;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_379> AgradCcdfLogBetaNegBinomial_v_379;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_380> AgradCcdfLogBetaNegBinomial_v_380;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_381> AgradCcdfLogBetaNegBinomial_v_381;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_382> AgradCcdfLogBetaNegBinomial_v_382;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_383> AgradCcdfLogBetaNegBinomial_v_383;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_384> AgradCcdfLogBetaNegBinomial_v_384;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_385> AgradCcdfLogBetaNegBinomial_v_385;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_386> AgradCcdfLogBetaNegBinomial_v_386;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_387> AgradCcdfLogBetaNegBinomial_v_387;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_388> AgradCcdfLogBetaNegBinomial_v_388;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_389> AgradCcdfLogBetaNegBinomial_v_389;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_390> AgradCcdfLogBetaNegBinomial_v_390;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_391> AgradCcdfLogBetaNegBinomial_v_391;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_392> AgradCcdfLogBetaNegBinomial_v_392;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_393> AgradCcdfLogBetaNegBinomial_v_393;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_394> AgradCcdfLogBetaNegBinomial_v_394;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_395> AgradCcdfLogBetaNegBinomial_v_395;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_396> AgradCcdfLogBetaNegBinomial_v_396;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_397> AgradCcdfLogBetaNegBinomial_v_397;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_398> AgradCcdfLogBetaNegBinomial_v_398;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_399> AgradCcdfLogBetaNegBinomial_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_300, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_301, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_302, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_303, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_304, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_305, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_306, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_307, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_308, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_309, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_310, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_311, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_312, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_313, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_314, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_315, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_316, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_317, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_318, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_319, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_320, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_321, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_322, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_323, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_324, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_325, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_326, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_327, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_328, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_329, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_330, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_331, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_332, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_333, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_334, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_335, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_336, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_337, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_338, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_339, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_340, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_341, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_342, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_343, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_344, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_345, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_346, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_347, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_348, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_349, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_350, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_351, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_352, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_353, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_354, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_355, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_356, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_357, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_358, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_359, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_360, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_361, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_362, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_363, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_364, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_365, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_366, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_367, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_368, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_369, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_370, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_371, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_372, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_373, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_374, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_375, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_376, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_377, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_378, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_379, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_380, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_381, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_382, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_383, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_384, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_385, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_386, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_387, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_388, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_389, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_390, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_391, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_392, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_393, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_394, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_395, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_396, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_397, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_398, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_399, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_399);
+
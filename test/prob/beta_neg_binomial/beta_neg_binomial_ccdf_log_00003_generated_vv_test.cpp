@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_300> AgradCcdfLogBetaNegBinomial_vv_300;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_301> AgradCcdfLogBetaNegBinomial_vv_301;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_302> AgradCcdfLogBetaNegBinomial_vv_302;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_303> AgradCcdfLogBetaNegBinomial_vv_303;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_304> AgradCcdfLogBetaNegBinomial_vv_304;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_305> AgradCcdfLogBetaNegBinomial_vv_305;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_306> AgradCcdfLogBetaNegBinomial_vv_306;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_307> AgradCcdfLogBetaNegBinomial_vv_307;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_308> AgradCcdfLogBetaNegBinomial_vv_308;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_309> AgradCcdfLogBetaNegBinomial_vv_309;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_310> AgradCcdfLogBetaNegBinomial_vv_310;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_311> AgradCcdfLogBetaNegBinomial_vv_311;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_312> AgradCcdfLogBetaNegBinomial_vv_312;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_313> AgradCcdfLogBetaNegBinomial_vv_313;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_314> AgradCcdfLogBetaNegBinomial_vv_314;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_315> AgradCcdfLogBetaNegBinomial_vv_315;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_316> AgradCcdfLogBetaNegBinomial_vv_316;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_317> AgradCcdfLogBetaNegBinomial_vv_317;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_318> AgradCcdfLogBetaNegBinomial_vv_318;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_319> AgradCcdfLogBetaNegBinomial_vv_319;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_320> AgradCcdfLogBetaNegBinomial_vv_320;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_321> AgradCcdfLogBetaNegBinomial_vv_321;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_322> AgradCcdfLogBetaNegBinomial_vv_322;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_323> AgradCcdfLogBetaNegBinomial_vv_323;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_324> AgradCcdfLogBetaNegBinomial_vv_324;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_325> AgradCcdfLogBetaNegBinomial_vv_325;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_326> AgradCcdfLogBetaNegBinomial_vv_326;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_327> AgradCcdfLogBetaNegBinomial_vv_327;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_328> AgradCcdfLogBetaNegBinomial_vv_328;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_329> AgradCcdfLogBetaNegBinomial_vv_329;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_330> AgradCcdfLogBetaNegBinomial_vv_330;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_331> AgradCcdfLogBetaNegBinomial_vv_331;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_332> AgradCcdfLogBetaNegBinomial_vv_332;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_333> AgradCcdfLogBetaNegBinomial_vv_333;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_334> AgradCcdfLogBetaNegBinomial_vv_334;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_335> AgradCcdfLogBetaNegBinomial_vv_335;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_336> AgradCcdfLogBetaNegBinomial_vv_336;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_337> AgradCcdfLogBetaNegBinomial_vv_337;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_338> AgradCcdfLogBetaNegBinomial_vv_338;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_339> AgradCcdfLogBetaNegBinomial_vv_339;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_340> AgradCcdfLogBetaNegBinomial_vv_340;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_341> AgradCcdfLogBetaNegBinomial_vv_341;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_342> AgradCcdfLogBetaNegBinomial_vv_342;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_343> AgradCcdfLogBetaNegBinomial_vv_343;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_344> AgradCcdfLogBetaNegBinomial_vv_344;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_345> AgradCcdfLogBetaNegBinomial_vv_345;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_346> AgradCcdfLogBetaNegBinomial_vv_346;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_347> AgradCcdfLogBetaNegBinomial_vv_347;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_348> AgradCcdfLogBetaNegBinomial_vv_348;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_349> AgradCcdfLogBetaNegBinomial_vv_349;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_350> AgradCcdfLogBetaNegBinomial_vv_350;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_351> AgradCcdfLogBetaNegBinomial_vv_351;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_352> AgradCcdfLogBetaNegBinomial_vv_352;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_353> AgradCcdfLogBetaNegBinomial_vv_353;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_354> AgradCcdfLogBetaNegBinomial_vv_354;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_355> AgradCcdfLogBetaNegBinomial_vv_355;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_356> AgradCcdfLogBetaNegBinomial_vv_356;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_357> AgradCcdfLogBetaNegBinomial_vv_357;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_358> AgradCcdfLogBetaNegBinomial_vv_358;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_359> AgradCcdfLogBetaNegBinomial_vv_359;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_360> AgradCcdfLogBetaNegBinomial_vv_360;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_361> AgradCcdfLogBetaNegBinomial_vv_361;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_362> AgradCcdfLogBetaNegBinomial_vv_362;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_363> AgradCcdfLogBetaNegBinomial_vv_363;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_364> AgradCcdfLogBetaNegBinomial_vv_364;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_365> AgradCcdfLogBetaNegBinomial_vv_365;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_366> AgradCcdfLogBetaNegBinomial_vv_366;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_367> AgradCcdfLogBetaNegBinomial_vv_367;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_368> AgradCcdfLogBetaNegBinomial_vv_368;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_369> AgradCcdfLogBetaNegBinomial_vv_369;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_370> AgradCcdfLogBetaNegBinomial_vv_370;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_371> AgradCcdfLogBetaNegBinomial_vv_371;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_372> AgradCcdfLogBetaNegBinomial_vv_372;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_373> AgradCcdfLogBetaNegBinomial_vv_373;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_374> AgradCcdfLogBetaNegBinomial_vv_374;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_375> AgradCcdfLogBetaNegBinomial_vv_375;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_376> AgradCcdfLogBetaNegBinomial_vv_376;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_377> AgradCcdfLogBetaNegBinomial_vv_377;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_378> AgradCcdfLogBetaNegBinomial_vv_378;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_379> AgradCcdfLogBetaNegBinomial_vv_379;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_380> AgradCcdfLogBetaNegBinomial_vv_380;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_381> AgradCcdfLogBetaNegBinomial_vv_381;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_382> AgradCcdfLogBetaNegBinomial_vv_382;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_383> AgradCcdfLogBetaNegBinomial_vv_383;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_384> AgradCcdfLogBetaNegBinomial_vv_384;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_385> AgradCcdfLogBetaNegBinomial_vv_385;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_386> AgradCcdfLogBetaNegBinomial_vv_386;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_387> AgradCcdfLogBetaNegBinomial_vv_387;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_388> AgradCcdfLogBetaNegBinomial_vv_388;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_389> AgradCcdfLogBetaNegBinomial_vv_389;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_390> AgradCcdfLogBetaNegBinomial_vv_390;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_391> AgradCcdfLogBetaNegBinomial_vv_391;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_392> AgradCcdfLogBetaNegBinomial_vv_392;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_393> AgradCcdfLogBetaNegBinomial_vv_393;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_394> AgradCcdfLogBetaNegBinomial_vv_394;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_395> AgradCcdfLogBetaNegBinomial_vv_395;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_396> AgradCcdfLogBetaNegBinomial_vv_396;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_397> AgradCcdfLogBetaNegBinomial_vv_397;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_398> AgradCcdfLogBetaNegBinomial_vv_398;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_399> AgradCcdfLogBetaNegBinomial_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_300, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_301, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_302, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_303, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_304, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_305, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_306, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_307, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_308, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_309, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_310, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_311, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_312, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_313, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_314, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_315, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_316, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_317, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_318, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_319, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_320, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_321, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_322, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_323, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_324, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_325, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_326, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_327, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_328, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_329, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_330, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_331, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_332, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_333, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_334, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_335, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_336, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_337, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_338, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_339, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_340, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_341, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_342, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_343, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_344, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_345, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_346, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_347, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_348, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_349, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_350, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_351, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_352, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_353, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_354, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_355, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_356, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_357, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_358, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_359, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_360, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_361, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_362, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_363, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_364, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_365, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_366, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_367, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_368, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_369, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_370, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_371, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_372, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_373, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_374, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_375, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_376, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_377, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_378, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_379, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_380, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_381, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_382, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_383, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_384, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_385, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_386, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_387, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_388, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_389, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_390, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_391, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_392, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_393, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_394, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_395, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_396, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_397, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_398, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_399, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_399);
+
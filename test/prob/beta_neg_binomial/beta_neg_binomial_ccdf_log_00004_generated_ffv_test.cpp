@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_400> AgradCcdfLogBetaNegBinomial_ffv_400;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_401> AgradCcdfLogBetaNegBinomial_ffv_401;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_402> AgradCcdfLogBetaNegBinomial_ffv_402;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_403> AgradCcdfLogBetaNegBinomial_ffv_403;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_404> AgradCcdfLogBetaNegBinomial_ffv_404;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_405> AgradCcdfLogBetaNegBinomial_ffv_405;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_406> AgradCcdfLogBetaNegBinomial_ffv_406;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_407> AgradCcdfLogBetaNegBinomial_ffv_407;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_408> AgradCcdfLogBetaNegBinomial_ffv_408;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_409> AgradCcdfLogBetaNegBinomial_ffv_409;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_410> AgradCcdfLogBetaNegBinomial_ffv_410;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_411> AgradCcdfLogBetaNegBinomial_ffv_411;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_412> AgradCcdfLogBetaNegBinomial_ffv_412;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_413> AgradCcdfLogBetaNegBinomial_ffv_413;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_414> AgradCcdfLogBetaNegBinomial_ffv_414;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_415> AgradCcdfLogBetaNegBinomial_ffv_415;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_416> AgradCcdfLogBetaNegBinomial_ffv_416;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_417> AgradCcdfLogBetaNegBinomial_ffv_417;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_418> AgradCcdfLogBetaNegBinomial_ffv_418;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_419> AgradCcdfLogBetaNegBinomial_ffv_419;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_420> AgradCcdfLogBetaNegBinomial_ffv_420;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_421> AgradCcdfLogBetaNegBinomial_ffv_421;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_422> AgradCcdfLogBetaNegBinomial_ffv_422;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_423> AgradCcdfLogBetaNegBinomial_ffv_423;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_424> AgradCcdfLogBetaNegBinomial_ffv_424;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_425> AgradCcdfLogBetaNegBinomial_ffv_425;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_426> AgradCcdfLogBetaNegBinomial_ffv_426;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_427> AgradCcdfLogBetaNegBinomial_ffv_427;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_428> AgradCcdfLogBetaNegBinomial_ffv_428;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_429> AgradCcdfLogBetaNegBinomial_ffv_429;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_430> AgradCcdfLogBetaNegBinomial_ffv_430;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_431> AgradCcdfLogBetaNegBinomial_ffv_431;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_432> AgradCcdfLogBetaNegBinomial_ffv_432;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_433> AgradCcdfLogBetaNegBinomial_ffv_433;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_434> AgradCcdfLogBetaNegBinomial_ffv_434;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_435> AgradCcdfLogBetaNegBinomial_ffv_435;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_436> AgradCcdfLogBetaNegBinomial_ffv_436;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_437> AgradCcdfLogBetaNegBinomial_ffv_437;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_438> AgradCcdfLogBetaNegBinomial_ffv_438;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_439> AgradCcdfLogBetaNegBinomial_ffv_439;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_440> AgradCcdfLogBetaNegBinomial_ffv_440;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_441> AgradCcdfLogBetaNegBinomial_ffv_441;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_442> AgradCcdfLogBetaNegBinomial_ffv_442;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_443> AgradCcdfLogBetaNegBinomial_ffv_443;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_444> AgradCcdfLogBetaNegBinomial_ffv_444;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_445> AgradCcdfLogBetaNegBinomial_ffv_445;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_446> AgradCcdfLogBetaNegBinomial_ffv_446;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_447> AgradCcdfLogBetaNegBinomial_ffv_447;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_448> AgradCcdfLogBetaNegBinomial_ffv_448;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_449> AgradCcdfLogBetaNegBinomial_ffv_449;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_450> AgradCcdfLogBetaNegBinomial_ffv_450;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_451> AgradCcdfLogBetaNegBinomial_ffv_451;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_452> AgradCcdfLogBetaNegBinomial_ffv_452;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_453> AgradCcdfLogBetaNegBinomial_ffv_453;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_454> AgradCcdfLogBetaNegBinomial_ffv_454;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_455> AgradCcdfLogBetaNegBinomial_ffv_455;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_456> AgradCcdfLogBetaNegBinomial_ffv_456;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_457> AgradCcdfLogBetaNegBinomial_ffv_457;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_458> AgradCcdfLogBetaNegBinomial_ffv_458;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_459> AgradCcdfLogBetaNegBinomial_ffv_459;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_460> AgradCcdfLogBetaNegBinomial_ffv_460;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_461> AgradCcdfLogBetaNegBinomial_ffv_461;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_462> AgradCcdfLogBetaNegBinomial_ffv_462;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_463> AgradCcdfLogBetaNegBinomial_ffv_463;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_464> AgradCcdfLogBetaNegBinomial_ffv_464;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_465> AgradCcdfLogBetaNegBinomial_ffv_465;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_466> AgradCcdfLogBetaNegBinomial_ffv_466;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_467> AgradCcdfLogBetaNegBinomial_ffv_467;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_468> AgradCcdfLogBetaNegBinomial_ffv_468;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_469> AgradCcdfLogBetaNegBinomial_ffv_469;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_470> AgradCcdfLogBetaNegBinomial_ffv_470;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_471> AgradCcdfLogBetaNegBinomial_ffv_471;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_472> AgradCcdfLogBetaNegBinomial_ffv_472;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_473> AgradCcdfLogBetaNegBinomial_ffv_473;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_474> AgradCcdfLogBetaNegBinomial_ffv_474;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_475> AgradCcdfLogBetaNegBinomial_ffv_475;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_476> AgradCcdfLogBetaNegBinomial_ffv_476;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_477> AgradCcdfLogBetaNegBinomial_ffv_477;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_478> AgradCcdfLogBetaNegBinomial_ffv_478;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_479> AgradCcdfLogBetaNegBinomial_ffv_479;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_480> AgradCcdfLogBetaNegBinomial_ffv_480;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_481> AgradCcdfLogBetaNegBinomial_ffv_481;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_482> AgradCcdfLogBetaNegBinomial_ffv_482;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_483> AgradCcdfLogBetaNegBinomial_ffv_483;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_484> AgradCcdfLogBetaNegBinomial_ffv_484;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_485> AgradCcdfLogBetaNegBinomial_ffv_485;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_486> AgradCcdfLogBetaNegBinomial_ffv_486;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_487> AgradCcdfLogBetaNegBinomial_ffv_487;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_488> AgradCcdfLogBetaNegBinomial_ffv_488;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_489> AgradCcdfLogBetaNegBinomial_ffv_489;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_490> AgradCcdfLogBetaNegBinomial_ffv_490;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_491> AgradCcdfLogBetaNegBinomial_ffv_491;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_492> AgradCcdfLogBetaNegBinomial_ffv_492;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_493> AgradCcdfLogBetaNegBinomial_ffv_493;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_494> AgradCcdfLogBetaNegBinomial_ffv_494;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_495> AgradCcdfLogBetaNegBinomial_ffv_495;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_496> AgradCcdfLogBetaNegBinomial_ffv_496;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_497> AgradCcdfLogBetaNegBinomial_ffv_497;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_498> AgradCcdfLogBetaNegBinomial_ffv_498;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_499> AgradCcdfLogBetaNegBinomial_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_400, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_401, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_402, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_403, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_404, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_405, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_406, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_407, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_408, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_409, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_410, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_411, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_412, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_413, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_414, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_415, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_416, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_417, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_418, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_419, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_420, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_421, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_422, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_423, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_424, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_425, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_426, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_427, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_428, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_429, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_430, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_431, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_432, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_433, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_434, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_435, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_436, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_437, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_438, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_439, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_440, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_441, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_442, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_443, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_444, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_445, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_446, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_447, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_448, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_449, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_450, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_451, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_452, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_453, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_454, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_455, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_456, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_457, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_458, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_459, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_460, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_461, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_462, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_463, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_464, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_465, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_466, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_467, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_468, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_469, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_470, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_471, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_472, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_473, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_474, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_475, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_476, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_477, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_478, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_479, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_480, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_481, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_482, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_483, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_484, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_485, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_486, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_487, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_488, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_489, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_490, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_491, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_492, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_493, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_494, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_495, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_496, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_497, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_498, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_499, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_499);
+
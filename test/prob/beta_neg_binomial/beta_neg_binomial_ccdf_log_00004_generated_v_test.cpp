@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_400> AgradCcdfLogBetaNegBinomial_v_400;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_401> AgradCcdfLogBetaNegBinomial_v_401;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_402> AgradCcdfLogBetaNegBinomial_v_402;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_403> AgradCcdfLogBetaNegBinomial_v_403;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_404> AgradCcdfLogBetaNegBinomial_v_404;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_405> AgradCcdfLogBetaNegBinomial_v_405;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_406> AgradCcdfLogBetaNegBinomial_v_406;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_407> AgradCcdfLogBetaNegBinomial_v_407;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_408> AgradCcdfLogBetaNegBinomial_v_408;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_409> AgradCcdfLogBetaNegBinomial_v_409;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_410> AgradCcdfLogBetaNegBinomial_v_410;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_411> AgradCcdfLogBetaNegBinomial_v_411;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_412> AgradCcdfLogBetaNegBinomial_v_412;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_413> AgradCcdfLogBetaNegBinomial_v_413;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_414> AgradCcdfLogBetaNegBinomial_v_414;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_415> AgradCcdfLogBetaNegBinomial_v_415;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_416> AgradCcdfLogBetaNegBinomial_v_416;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_417> AgradCcdfLogBetaNegBinomial_v_417;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_418> AgradCcdfLogBetaNegBinomial_v_418;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_419> AgradCcdfLogBetaNegBinomial_v_419;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_420> AgradCcdfLogBetaNegBinomial_v_420;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_421> AgradCcdfLogBetaNegBinomial_v_421;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_422> AgradCcdfLogBetaNegBinomial_v_422;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_423> AgradCcdfLogBetaNegBinomial_v_423;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_424> AgradCcdfLogBetaNegBinomial_v_424;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_425> AgradCcdfLogBetaNegBinomial_v_425;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_426> AgradCcdfLogBetaNegBinomial_v_426;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_427> AgradCcdfLogBetaNegBinomial_v_427;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_428> AgradCcdfLogBetaNegBinomial_v_428;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_429> AgradCcdfLogBetaNegBinomial_v_429;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_430> AgradCcdfLogBetaNegBinomial_v_430;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_431> AgradCcdfLogBetaNegBinomial_v_431;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_432> AgradCcdfLogBetaNegBinomial_v_432;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_433> AgradCcdfLogBetaNegBinomial_v_433;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_434> AgradCcdfLogBetaNegBinomial_v_434;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_435> AgradCcdfLogBetaNegBinomial_v_435;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_436> AgradCcdfLogBetaNegBinomial_v_436;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_437> AgradCcdfLogBetaNegBinomial_v_437;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_438> AgradCcdfLogBetaNegBinomial_v_438;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_439> AgradCcdfLogBetaNegBinomial_v_439;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_440> AgradCcdfLogBetaNegBinomial_v_440;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_441> AgradCcdfLogBetaNegBinomial_v_441;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_442> AgradCcdfLogBetaNegBinomial_v_442;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_443> AgradCcdfLogBetaNegBinomial_v_443;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_444> AgradCcdfLogBetaNegBinomial_v_444;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_445> AgradCcdfLogBetaNegBinomial_v_445;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_446> AgradCcdfLogBetaNegBinomial_v_446;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_447> AgradCcdfLogBetaNegBinomial_v_447;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_448> AgradCcdfLogBetaNegBinomial_v_448;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_449> AgradCcdfLogBetaNegBinomial_v_449;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_450> AgradCcdfLogBetaNegBinomial_v_450;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_451> AgradCcdfLogBetaNegBinomial_v_451;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_452> AgradCcdfLogBetaNegBinomial_v_452;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_453> AgradCcdfLogBetaNegBinomial_v_453;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_454> AgradCcdfLogBetaNegBinomial_v_454;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_455> AgradCcdfLogBetaNegBinomial_v_455;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_456> AgradCcdfLogBetaNegBinomial_v_456;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_457> AgradCcdfLogBetaNegBinomial_v_457;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_458> AgradCcdfLogBetaNegBinomial_v_458;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_459> AgradCcdfLogBetaNegBinomial_v_459;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_460> AgradCcdfLogBetaNegBinomial_v_460;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_461> AgradCcdfLogBetaNegBinomial_v_461;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_462> AgradCcdfLogBetaNegBinomial_v_462;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_463> AgradCcdfLogBetaNegBinomial_v_463;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_464> AgradCcdfLogBetaNegBinomial_v_464;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_465> AgradCcdfLogBetaNegBinomial_v_465;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_466> AgradCcdfLogBetaNegBinomial_v_466;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_467> AgradCcdfLogBetaNegBinomial_v_467;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_468> AgradCcdfLogBetaNegBinomial_v_468;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_469> AgradCcdfLogBetaNegBinomial_v_469;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_470> AgradCcdfLogBetaNegBinomial_v_470;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_471> AgradCcdfLogBetaNegBinomial_v_471;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_472> AgradCcdfLogBetaNegBinomial_v_472;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_473> AgradCcdfLogBetaNegBinomial_v_473;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_474> AgradCcdfLogBetaNegBinomial_v_474;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_475> AgradCcdfLogBetaNegBinomial_v_475;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_476> AgradCcdfLogBetaNegBinomial_v_476;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_477> AgradCcdfLogBetaNegBinomial_v_477;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_478> AgradCcdfLogBetaNegBinomial_v_478;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_479> AgradCcdfLogBetaNegBinomial_v_479;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_480> AgradCcdfLogBetaNegBinomial_v_480;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_481> AgradCcdfLogBetaNegBinomial_v_481;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_482> AgradCcdfLogBetaNegBinomial_v_482;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_483> AgradCcdfLogBetaNegBinomial_v_483;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_484> AgradCcdfLogBetaNegBinomial_v_484;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_485> AgradCcdfLogBetaNegBinomial_v_485;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_486> AgradCcdfLogBetaNegBinomial_v_486;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_487> AgradCcdfLogBetaNegBinomial_v_487;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_488> AgradCcdfLogBetaNegBinomial_v_488;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_489> AgradCcdfLogBetaNegBinomial_v_489;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_490> AgradCcdfLogBetaNegBinomial_v_490;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_491> AgradCcdfLogBetaNegBinomial_v_491;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_492> AgradCcdfLogBetaNegBinomial_v_492;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_493> AgradCcdfLogBetaNegBinomial_v_493;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_494> AgradCcdfLogBetaNegBinomial_v_494;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_495> AgradCcdfLogBetaNegBinomial_v_495;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_496> AgradCcdfLogBetaNegBinomial_v_496;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_497> AgradCcdfLogBetaNegBinomial_v_497;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_498> AgradCcdfLogBetaNegBinomial_v_498;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_499> AgradCcdfLogBetaNegBinomial_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_400, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_401, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_402, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_403, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_404, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_405, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_406, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_407, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_408, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_409, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_410, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_411, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_412, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_413, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_414, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_415, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_416, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_417, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_418, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_419, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_420, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_421, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_422, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_423, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_424, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_425, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_426, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_427, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_428, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_429, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_430, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_431, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_432, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_433, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_434, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_435, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_436, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_437, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_438, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_439, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_440, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_441, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_442, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_443, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_444, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_445, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_446, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_447, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_448, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_449, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_450, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_451, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_452, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_453, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_454, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_455, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_456, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_457, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_458, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_459, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_460, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_461, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_462, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_463, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_464, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_465, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_466, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_467, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_468, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_469, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_470, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_471, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_472, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_473, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_474, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_475, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_476, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_477, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_478, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_479, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_480, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_481, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_482, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_483, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_484, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_485, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_486, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_487, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_488, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_489, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_490, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_491, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_492, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_493, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_494, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_495, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_496, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_497, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_498, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_499, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_499);
+
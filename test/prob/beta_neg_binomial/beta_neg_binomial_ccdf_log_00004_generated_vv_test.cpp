@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_400> AgradCcdfLogBetaNegBinomial_vv_400;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_401> AgradCcdfLogBetaNegBinomial_vv_401;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_402> AgradCcdfLogBetaNegBinomial_vv_402;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_403> AgradCcdfLogBetaNegBinomial_vv_403;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_404> AgradCcdfLogBetaNegBinomial_vv_404;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_405> AgradCcdfLogBetaNegBinomial_vv_405;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_406> AgradCcdfLogBetaNegBinomial_vv_406;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_407> AgradCcdfLogBetaNegBinomial_vv_407;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_408> AgradCcdfLogBetaNegBinomial_vv_408;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_409> AgradCcdfLogBetaNegBinomial_vv_409;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_410> AgradCcdfLogBetaNegBinomial_vv_410;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_411> AgradCcdfLogBetaNegBinomial_vv_411;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_412> AgradCcdfLogBetaNegBinomial_vv_412;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_413> AgradCcdfLogBetaNegBinomial_vv_413;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_414> AgradCcdfLogBetaNegBinomial_vv_414;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_415> AgradCcdfLogBetaNegBinomial_vv_415;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_416> AgradCcdfLogBetaNegBinomial_vv_416;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_417> AgradCcdfLogBetaNegBinomial_vv_417;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_418> AgradCcdfLogBetaNegBinomial_vv_418;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_419> AgradCcdfLogBetaNegBinomial_vv_419;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_420> AgradCcdfLogBetaNegBinomial_vv_420;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_421> AgradCcdfLogBetaNegBinomial_vv_421;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_422> AgradCcdfLogBetaNegBinomial_vv_422;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_423> AgradCcdfLogBetaNegBinomial_vv_423;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_424> AgradCcdfLogBetaNegBinomial_vv_424;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_425> AgradCcdfLogBetaNegBinomial_vv_425;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_426> AgradCcdfLogBetaNegBinomial_vv_426;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_427> AgradCcdfLogBetaNegBinomial_vv_427;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_428> AgradCcdfLogBetaNegBinomial_vv_428;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_429> AgradCcdfLogBetaNegBinomial_vv_429;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_430> AgradCcdfLogBetaNegBinomial_vv_430;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_431> AgradCcdfLogBetaNegBinomial_vv_431;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_432> AgradCcdfLogBetaNegBinomial_vv_432;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_433> AgradCcdfLogBetaNegBinomial_vv_433;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_434> AgradCcdfLogBetaNegBinomial_vv_434;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_435> AgradCcdfLogBetaNegBinomial_vv_435;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_436> AgradCcdfLogBetaNegBinomial_vv_436;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_437> AgradCcdfLogBetaNegBinomial_vv_437;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_438> AgradCcdfLogBetaNegBinomial_vv_438;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_439> AgradCcdfLogBetaNegBinomial_vv_439;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_440> AgradCcdfLogBetaNegBinomial_vv_440;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_441> AgradCcdfLogBetaNegBinomial_vv_441;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_442> AgradCcdfLogBetaNegBinomial_vv_442;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_443> AgradCcdfLogBetaNegBinomial_vv_443;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_444> AgradCcdfLogBetaNegBinomial_vv_444;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_445> AgradCcdfLogBetaNegBinomial_vv_445;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_446> AgradCcdfLogBetaNegBinomial_vv_446;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_447> AgradCcdfLogBetaNegBinomial_vv_447;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_448> AgradCcdfLogBetaNegBinomial_vv_448;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_449> AgradCcdfLogBetaNegBinomial_vv_449;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_450> AgradCcdfLogBetaNegBinomial_vv_450;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_451> AgradCcdfLogBetaNegBinomial_vv_451;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_452> AgradCcdfLogBetaNegBinomial_vv_452;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_453> AgradCcdfLogBetaNegBinomial_vv_453;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_454> AgradCcdfLogBetaNegBinomial_vv_454;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_455> AgradCcdfLogBetaNegBinomial_vv_455;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_456> AgradCcdfLogBetaNegBinomial_vv_456;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_457> AgradCcdfLogBetaNegBinomial_vv_457;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_458> AgradCcdfLogBetaNegBinomial_vv_458;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_459> AgradCcdfLogBetaNegBinomial_vv_459;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_460> AgradCcdfLogBetaNegBinomial_vv_460;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_461> AgradCcdfLogBetaNegBinomial_vv_461;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_462> AgradCcdfLogBetaNegBinomial_vv_462;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_463> AgradCcdfLogBetaNegBinomial_vv_463;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_464> AgradCcdfLogBetaNegBinomial_vv_464;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_465> AgradCcdfLogBetaNegBinomial_vv_465;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_466> AgradCcdfLogBetaNegBinomial_vv_466;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_467> AgradCcdfLogBetaNegBinomial_vv_467;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_468> AgradCcdfLogBetaNegBinomial_vv_468;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_469> AgradCcdfLogBetaNegBinomial_vv_469;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_470> AgradCcdfLogBetaNegBinomial_vv_470;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_471> AgradCcdfLogBetaNegBinomial_vv_471;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_472> AgradCcdfLogBetaNegBinomial_vv_472;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_473> AgradCcdfLogBetaNegBinomial_vv_473;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_474> AgradCcdfLogBetaNegBinomial_vv_474;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_475> AgradCcdfLogBetaNegBinomial_vv_475;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_476> AgradCcdfLogBetaNegBinomial_vv_476;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_477> AgradCcdfLogBetaNegBinomial_vv_477;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_478> AgradCcdfLogBetaNegBinomial_vv_478;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_479> AgradCcdfLogBetaNegBinomial_vv_479;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_480> AgradCcdfLogBetaNegBinomial_vv_480;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_481> AgradCcdfLogBetaNegBinomial_vv_481;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_482> AgradCcdfLogBetaNegBinomial_vv_482;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_483> AgradCcdfLogBetaNegBinomial_vv_483;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_484> AgradCcdfLogBetaNegBinomial_vv_484;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_485> AgradCcdfLogBetaNegBinomial_vv_485;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_486> AgradCcdfLogBetaNegBinomial_vv_486;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_487> AgradCcdfLogBetaNegBinomial_vv_487;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_488> AgradCcdfLogBetaNegBinomial_vv_488;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_489> AgradCcdfLogBetaNegBinomial_vv_489;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_490> AgradCcdfLogBetaNegBinomial_vv_490;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_491> AgradCcdfLogBetaNegBinomial_vv_491;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_492> AgradCcdfLogBetaNegBinomial_vv_492;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_493> AgradCcdfLogBetaNegBinomial_vv_493;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_494> AgradCcdfLogBetaNegBinomial_vv_494;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_495> AgradCcdfLogBetaNegBinomial_vv_495;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_496> AgradCcdfLogBetaNegBinomial_vv_496;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_497> AgradCcdfLogBetaNegBinomial_vv_497;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_498> AgradCcdfLogBetaNegBinomial_vv_498;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_499> AgradCcdfLogBetaNegBinomial_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_400, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_401, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_402, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_403, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_404, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_405, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_406, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_407, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_408, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_409, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_410, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_411, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_412, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_413, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_414, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_415, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_416, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_417, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_418, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_419, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_420, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_421, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_422, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_423, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_424, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_425, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_426, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_427, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_428, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_429, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_430, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_431, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_432, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_433, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_434, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_435, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_436, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_437, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_438, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_439, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_440, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_441, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_442, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_443, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_444, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_445, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_446, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_447, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_448, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_449, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_450, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_451, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_452, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_453, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_454, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_455, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_456, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_457, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_458, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_459, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_460, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_461, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_462, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_463, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_464, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_465, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_466, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_467, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_468, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_469, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_470, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_471, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_472, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_473, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_474, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_475, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_476, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_477, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_478, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_479, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_480, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_481, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_482, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_483, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_484, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_485, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_486, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_487, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_488, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_489, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_490, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_491, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_492, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_493, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_494, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_495, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_496, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_497, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_498, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_499, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_499);
+
@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_500> AgradCcdfLogBetaNegBinomial_ffv_500;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_501> AgradCcdfLogBetaNegBinomial_ffv_501;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_502> AgradCcdfLogBetaNegBinomial_ffv_502;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_503> AgradCcdfLogBetaNegBinomial_ffv_503;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_504> AgradCcdfLogBetaNegBinomial_ffv_504;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_505> AgradCcdfLogBetaNegBinomial_ffv_505;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_506> AgradCcdfLogBetaNegBinomial_ffv_506;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_507> AgradCcdfLogBetaNegBinomial_ffv_507;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_508> AgradCcdfLogBetaNegBinomial_ffv_508;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_509> AgradCcdfLogBetaNegBinomial_ffv_509;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_510> AgradCcdfLogBetaNegBinomial_ffv_510;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_511> AgradCcdfLogBetaNegBinomial_ffv_511;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_512> AgradCcdfLogBetaNegBinomial_ffv_512;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_513> AgradCcdfLogBetaNegBinomial_ffv_513;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_514> AgradCcdfLogBetaNegBinomial_ffv_514;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_515> AgradCcdfLogBetaNegBinomial_ffv_515;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_516> AgradCcdfLogBetaNegBinomial_ffv_516;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_517> AgradCcdfLogBetaNegBinomial_ffv_517;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_518> AgradCcdfLogBetaNegBinomial_ffv_518;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_519> AgradCcdfLogBetaNegBinomial_ffv_519;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_520> AgradCcdfLogBetaNegBinomial_ffv_520;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_521> AgradCcdfLogBetaNegBinomial_ffv_521;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_522> AgradCcdfLogBetaNegBinomial_ffv_522;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_523> AgradCcdfLogBetaNegBinomial_ffv_523;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_524> AgradCcdfLogBetaNegBinomial_ffv_524;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_525> AgradCcdfLogBetaNegBinomial_ffv_525;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_526> AgradCcdfLogBetaNegBinomial_ffv_526;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_527> AgradCcdfLogBetaNegBinomial_ffv_527;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_528> AgradCcdfLogBetaNegBinomial_ffv_528;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_529> AgradCcdfLogBetaNegBinomial_ffv_529;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_530> AgradCcdfLogBetaNegBinomial_ffv_530;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_531> AgradCcdfLogBetaNegBinomial_ffv_531;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_532> AgradCcdfLogBetaNegBinomial_ffv_532;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_533> AgradCcdfLogBetaNegBinomial_ffv_533;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_534> AgradCcdfLogBetaNegBinomial_ffv_534;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_535> AgradCcdfLogBetaNegBinomial_ffv_535;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_536> AgradCcdfLogBetaNegBinomial_ffv_536;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_537> AgradCcdfLogBetaNegBinomial_ffv_537;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_538> AgradCcdfLogBetaNegBinomial_ffv_538;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_539> AgradCcdfLogBetaNegBinomial_ffv_539;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_540> AgradCcdfLogBetaNegBinomial_ffv_540;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_541> AgradCcdfLogBetaNegBinomial_ffv_541;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_542> AgradCcdfLogBetaNegBinomial_ffv_542;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_543> AgradCcdfLogBetaNegBinomial_ffv_543;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_544> AgradCcdfLogBetaNegBinomial_ffv_544;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_545> AgradCcdfLogBetaNegBinomial_ffv_545;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_546> AgradCcdfLogBetaNegBinomial_ffv_546;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_547> AgradCcdfLogBetaNegBinomial_ffv_547;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_548> AgradCcdfLogBetaNegBinomial_ffv_548;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_549> AgradCcdfLogBetaNegBinomial_ffv_549;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_550> AgradCcdfLogBetaNegBinomial_ffv_550;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_551> AgradCcdfLogBetaNegBinomial_ffv_551;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_552> AgradCcdfLogBetaNegBinomial_ffv_552;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_553> AgradCcdfLogBetaNegBinomial_ffv_553;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_554> AgradCcdfLogBetaNegBinomial_ffv_554;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_555> AgradCcdfLogBetaNegBinomial_ffv_555;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_556> AgradCcdfLogBetaNegBinomial_ffv_556;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_557> AgradCcdfLogBetaNegBinomial_ffv_557;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_558> AgradCcdfLogBetaNegBinomial_ffv_558;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_559> AgradCcdfLogBetaNegBinomial_ffv_559;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_560> AgradCcdfLogBetaNegBinomial_ffv_560;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_561> AgradCcdfLogBetaNegBinomial_ffv_561;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_562> AgradCcdfLogBetaNegBinomial_ffv_562;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_563> AgradCcdfLogBetaNegBinomial_ffv_563;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_564> AgradCcdfLogBetaNegBinomial_ffv_564;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_565> AgradCcdfLogBetaNegBinomial_ffv_565;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_ffv_566> AgradCcdfLogBetaNegBinomial_ffv_566;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_500, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_501, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_502, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_503, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_504, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_505, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_506, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_507, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_508, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_509, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_510, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_511, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_512, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_513, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_514, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_515, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_516, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_517, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_518, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_519, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_520, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_521, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_522, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_523, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_524, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_525, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_526, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_527, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_528, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_529, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_530, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_531, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_532, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_533, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_534, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_535, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_536, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_537, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_538, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_539, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_540, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_541, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_542, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_543, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_544, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_545, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_546, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_547, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_548, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_549, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_550, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_551, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_552, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_553, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_554, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_555, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_556, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_557, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_558, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_559, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_560, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_561, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_562, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_563, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_564, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_565, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_ffv_566, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_ffv_566);
+
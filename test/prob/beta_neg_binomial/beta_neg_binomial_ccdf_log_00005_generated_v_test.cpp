@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_500> AgradCcdfLogBetaNegBinomial_v_500;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_501> AgradCcdfLogBetaNegBinomial_v_501;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_502> AgradCcdfLogBetaNegBinomial_v_502;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_503> AgradCcdfLogBetaNegBinomial_v_503;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_504> AgradCcdfLogBetaNegBinomial_v_504;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_505> AgradCcdfLogBetaNegBinomial_v_505;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_506> AgradCcdfLogBetaNegBinomial_v_506;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_507> AgradCcdfLogBetaNegBinomial_v_507;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_508> AgradCcdfLogBetaNegBinomial_v_508;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_509> AgradCcdfLogBetaNegBinomial_v_509;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_510> AgradCcdfLogBetaNegBinomial_v_510;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_511> AgradCcdfLogBetaNegBinomial_v_511;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_512> AgradCcdfLogBetaNegBinomial_v_512;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_513> AgradCcdfLogBetaNegBinomial_v_513;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_514> AgradCcdfLogBetaNegBinomial_v_514;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_515> AgradCcdfLogBetaNegBinomial_v_515;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_516> AgradCcdfLogBetaNegBinomial_v_516;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_517> AgradCcdfLogBetaNegBinomial_v_517;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_518> AgradCcdfLogBetaNegBinomial_v_518;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_519> AgradCcdfLogBetaNegBinomial_v_519;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_520> AgradCcdfLogBetaNegBinomial_v_520;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_521> AgradCcdfLogBetaNegBinomial_v_521;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_522> AgradCcdfLogBetaNegBinomial_v_522;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_523> AgradCcdfLogBetaNegBinomial_v_523;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_524> AgradCcdfLogBetaNegBinomial_v_524;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_525> AgradCcdfLogBetaNegBinomial_v_525;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_526> AgradCcdfLogBetaNegBinomial_v_526;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_527> AgradCcdfLogBetaNegBinomial_v_527;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_528> AgradCcdfLogBetaNegBinomial_v_528;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_529> AgradCcdfLogBetaNegBinomial_v_529;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_530> AgradCcdfLogBetaNegBinomial_v_530;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_531> AgradCcdfLogBetaNegBinomial_v_531;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_532> AgradCcdfLogBetaNegBinomial_v_532;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_533> AgradCcdfLogBetaNegBinomial_v_533;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_534> AgradCcdfLogBetaNegBinomial_v_534;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_535> AgradCcdfLogBetaNegBinomial_v_535;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_536> AgradCcdfLogBetaNegBinomial_v_536;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_537> AgradCcdfLogBetaNegBinomial_v_537;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_538> AgradCcdfLogBetaNegBinomial_v_538;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_539> AgradCcdfLogBetaNegBinomial_v_539;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_540> AgradCcdfLogBetaNegBinomial_v_540;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_541> AgradCcdfLogBetaNegBinomial_v_541;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_542> AgradCcdfLogBetaNegBinomial_v_542;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_543> AgradCcdfLogBetaNegBinomial_v_543;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_544> AgradCcdfLogBetaNegBinomial_v_544;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_545> AgradCcdfLogBetaNegBinomial_v_545;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_546> AgradCcdfLogBetaNegBinomial_v_546;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_547> AgradCcdfLogBetaNegBinomial_v_547;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_548> AgradCcdfLogBetaNegBinomial_v_548;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_549> AgradCcdfLogBetaNegBinomial_v_549;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_550> AgradCcdfLogBetaNegBinomial_v_550;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_551> AgradCcdfLogBetaNegBinomial_v_551;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_552> AgradCcdfLogBetaNegBinomial_v_552;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_553> AgradCcdfLogBetaNegBinomial_v_553;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_554> AgradCcdfLogBetaNegBinomial_v_554;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_555> AgradCcdfLogBetaNegBinomial_v_555;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_556> AgradCcdfLogBetaNegBinomial_v_556;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_557> AgradCcdfLogBetaNegBinomial_v_557;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_558> AgradCcdfLogBetaNegBinomial_v_558;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_559> AgradCcdfLogBetaNegBinomial_v_559;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_560> AgradCcdfLogBetaNegBinomial_v_560;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_561> AgradCcdfLogBetaNegBinomial_v_561;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_562> AgradCcdfLogBetaNegBinomial_v_562;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_563> AgradCcdfLogBetaNegBinomial_v_563;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_564> AgradCcdfLogBetaNegBinomial_v_564;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_565> AgradCcdfLogBetaNegBinomial_v_565;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_566> AgradCcdfLogBetaNegBinomial_v_566;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_567> AgradCcdfLogBetaNegBinomial_v_567;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_568> AgradCcdfLogBetaNegBinomial_v_568;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_569> AgradCcdfLogBetaNegBinomial_v_569;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_570> AgradCcdfLogBetaNegBinomial_v_570;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_571> AgradCcdfLogBetaNegBinomial_v_571;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_572> AgradCcdfLogBetaNegBinomial_v_572;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_573> AgradCcdfLogBetaNegBinomial_v_573;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_574> AgradCcdfLogBetaNegBinomial_v_574;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_575> AgradCcdfLogBetaNegBinomial_v_575;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_576> AgradCcdfLogBetaNegBinomial_v_576;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_577> AgradCcdfLogBetaNegBinomial_v_577;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_578> AgradCcdfLogBetaNegBinomial_v_578;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_579> AgradCcdfLogBetaNegBinomial_v_579;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_580> AgradCcdfLogBetaNegBinomial_v_580;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_581> AgradCcdfLogBetaNegBinomial_v_581;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_582> AgradCcdfLogBetaNegBinomial_v_582;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_583> AgradCcdfLogBetaNegBinomial_v_583;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_584> AgradCcdfLogBetaNegBinomial_v_584;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_585> AgradCcdfLogBetaNegBinomial_v_585;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_586> AgradCcdfLogBetaNegBinomial_v_586;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_587> AgradCcdfLogBetaNegBinomial_v_587;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_588> AgradCcdfLogBetaNegBinomial_v_588;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_589> AgradCcdfLogBetaNegBinomial_v_589;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_590> AgradCcdfLogBetaNegBinomial_v_590;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_591> AgradCcdfLogBetaNegBinomial_v_591;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_592> AgradCcdfLogBetaNegBinomial_v_592;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_593> AgradCcdfLogBetaNegBinomial_v_593;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_594> AgradCcdfLogBetaNegBinomial_v_594;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_595> AgradCcdfLogBetaNegBinomial_v_595;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_596> AgradCcdfLogBetaNegBinomial_v_596;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_597> AgradCcdfLogBetaNegBinomial_v_597;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_598> AgradCcdfLogBetaNegBinomial_v_598;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_599> AgradCcdfLogBetaNegBinomial_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_500, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_501, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_502, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_503, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_504, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_505, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_506, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_507, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_508, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_509, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_510, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_511, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_512, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_513, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_514, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_515, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_516, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_517, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_518, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_519, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_520, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_521, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_522, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_523, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_524, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_525, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_526, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_527, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_528, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_529, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_530, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_531, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_532, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_533, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_534, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_535, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_536, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_537, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_538, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_539, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_540, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_541, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_542, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_543, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_544, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_545, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_546, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_547, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_548, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_549, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_550, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_551, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_552, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_553, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_554, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_555, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_556, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_557, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_558, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_559, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_560, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_561, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_562, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_563, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_564, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_565, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_566, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_567, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_568, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_569, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_570, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_571, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_572, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_573, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_574, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_575, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_576, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_577, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_578, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_579, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_580, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_581, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_582, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_583, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_584, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_585, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_586, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_587, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_588, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_589, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_590, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_591, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_592, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_593, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_594, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_595, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_596, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_597, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_598, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_599, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_599);
+
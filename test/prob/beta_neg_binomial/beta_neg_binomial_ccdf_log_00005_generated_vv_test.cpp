@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_500> AgradCcdfLogBetaNegBinomial_vv_500;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_501> AgradCcdfLogBetaNegBinomial_vv_501;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_502> AgradCcdfLogBetaNegBinomial_vv_502;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_503> AgradCcdfLogBetaNegBinomial_vv_503;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_504> AgradCcdfLogBetaNegBinomial_vv_504;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_505> AgradCcdfLogBetaNegBinomial_vv_505;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_506> AgradCcdfLogBetaNegBinomial_vv_506;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_507> AgradCcdfLogBetaNegBinomial_vv_507;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_508> AgradCcdfLogBetaNegBinomial_vv_508;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_509> AgradCcdfLogBetaNegBinomial_vv_509;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_510> AgradCcdfLogBetaNegBinomial_vv_510;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_511> AgradCcdfLogBetaNegBinomial_vv_511;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_512> AgradCcdfLogBetaNegBinomial_vv_512;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_513> AgradCcdfLogBetaNegBinomial_vv_513;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_514> AgradCcdfLogBetaNegBinomial_vv_514;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_515> AgradCcdfLogBetaNegBinomial_vv_515;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_516> AgradCcdfLogBetaNegBinomial_vv_516;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_517> AgradCcdfLogBetaNegBinomial_vv_517;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_518> AgradCcdfLogBetaNegBinomial_vv_518;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_519> AgradCcdfLogBetaNegBinomial_vv_519;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_520> AgradCcdfLogBetaNegBinomial_vv_520;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_521> AgradCcdfLogBetaNegBinomial_vv_521;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_522> AgradCcdfLogBetaNegBinomial_vv_522;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_523> AgradCcdfLogBetaNegBinomial_vv_523;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_524> AgradCcdfLogBetaNegBinomial_vv_524;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_525> AgradCcdfLogBetaNegBinomial_vv_525;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_526> AgradCcdfLogBetaNegBinomial_vv_526;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_527> AgradCcdfLogBetaNegBinomial_vv_527;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_528> AgradCcdfLogBetaNegBinomial_vv_528;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_529> AgradCcdfLogBetaNegBinomial_vv_529;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_530> AgradCcdfLogBetaNegBinomial_vv_530;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_531> AgradCcdfLogBetaNegBinomial_vv_531;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_532> AgradCcdfLogBetaNegBinomial_vv_532;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_533> AgradCcdfLogBetaNegBinomial_vv_533;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_534> AgradCcdfLogBetaNegBinomial_vv_534;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_535> AgradCcdfLogBetaNegBinomial_vv_535;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_536> AgradCcdfLogBetaNegBinomial_vv_536;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_537> AgradCcdfLogBetaNegBinomial_vv_537;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_538> AgradCcdfLogBetaNegBinomial_vv_538;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_539> AgradCcdfLogBetaNegBinomial_vv_539;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_540> AgradCcdfLogBetaNegBinomial_vv_540;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_541> AgradCcdfLogBetaNegBinomial_vv_541;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_542> AgradCcdfLogBetaNegBinomial_vv_542;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_543> AgradCcdfLogBetaNegBinomial_vv_543;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_544> AgradCcdfLogBetaNegBinomial_vv_544;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_545> AgradCcdfLogBetaNegBinomial_vv_545;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_546> AgradCcdfLogBetaNegBinomial_vv_546;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_547> AgradCcdfLogBetaNegBinomial_vv_547;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_548> AgradCcdfLogBetaNegBinomial_vv_548;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_549> AgradCcdfLogBetaNegBinomial_vv_549;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_550> AgradCcdfLogBetaNegBinomial_vv_550;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_551> AgradCcdfLogBetaNegBinomial_vv_551;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_552> AgradCcdfLogBetaNegBinomial_vv_552;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_553> AgradCcdfLogBetaNegBinomial_vv_553;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_554> AgradCcdfLogBetaNegBinomial_vv_554;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_555> AgradCcdfLogBetaNegBinomial_vv_555;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_556> AgradCcdfLogBetaNegBinomial_vv_556;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_557> AgradCcdfLogBetaNegBinomial_vv_557;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_558> AgradCcdfLogBetaNegBinomial_vv_558;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_559> AgradCcdfLogBetaNegBinomial_vv_559;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_560> AgradCcdfLogBetaNegBinomial_vv_560;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_561> AgradCcdfLogBetaNegBinomial_vv_561;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_562> AgradCcdfLogBetaNegBinomial_vv_562;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_563> AgradCcdfLogBetaNegBinomial_vv_563;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_564> AgradCcdfLogBetaNegBinomial_vv_564;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_565> AgradCcdfLogBetaNegBinomial_vv_565;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_vv_566> AgradCcdfLogBetaNegBinomial_vv_566;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_500, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_501, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_502, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_503, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_504, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_505, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_506, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_507, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_508, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_509, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_510, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_511, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_512, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_513, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_514, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_515, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_516, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_517, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_518, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_519, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_520, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_521, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_522, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_523, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_524, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_525, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_526, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_527, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_528, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_529, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_530, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_531, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_532, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_533, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_534, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_535, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_536, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_537, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_538, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_539, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_540, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_541, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_542, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_543, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_544, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_545, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_546, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_547, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_548, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_549, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_550, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_551, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_552, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_553, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_554, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_555, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_556, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_557, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_558, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_559, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_560, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_561, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_562, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_563, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_564, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_565, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_vv_566, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_vv_566);
+
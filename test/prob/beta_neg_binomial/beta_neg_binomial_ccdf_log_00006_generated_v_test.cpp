@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_600> AgradCcdfLogBetaNegBinomial_v_600;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_601> AgradCcdfLogBetaNegBinomial_v_601;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_602> AgradCcdfLogBetaNegBinomial_v_602;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_603> AgradCcdfLogBetaNegBinomial_v_603;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_604> AgradCcdfLogBetaNegBinomial_v_604;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_605> AgradCcdfLogBetaNegBinomial_v_605;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_606> AgradCcdfLogBetaNegBinomial_v_606;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_607> AgradCcdfLogBetaNegBinomial_v_607;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_608> AgradCcdfLogBetaNegBinomial_v_608;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_609> AgradCcdfLogBetaNegBinomial_v_609;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_610> AgradCcdfLogBetaNegBinomial_v_610;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_611> AgradCcdfLogBetaNegBinomial_v_611;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_612> AgradCcdfLogBetaNegBinomial_v_612;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_613> AgradCcdfLogBetaNegBinomial_v_613;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_614> AgradCcdfLogBetaNegBinomial_v_614;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_615> AgradCcdfLogBetaNegBinomial_v_615;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_616> AgradCcdfLogBetaNegBinomial_v_616;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_617> AgradCcdfLogBetaNegBinomial_v_617;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_618> AgradCcdfLogBetaNegBinomial_v_618;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_619> AgradCcdfLogBetaNegBinomial_v_619;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_620> AgradCcdfLogBetaNegBinomial_v_620;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_621> AgradCcdfLogBetaNegBinomial_v_621;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_622> AgradCcdfLogBetaNegBinomial_v_622;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_623> AgradCcdfLogBetaNegBinomial_v_623;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_624> AgradCcdfLogBetaNegBinomial_v_624;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_625> AgradCcdfLogBetaNegBinomial_v_625;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_626> AgradCcdfLogBetaNegBinomial_v_626;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_627> AgradCcdfLogBetaNegBinomial_v_627;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_628> AgradCcdfLogBetaNegBinomial_v_628;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_629> AgradCcdfLogBetaNegBinomial_v_629;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_630> AgradCcdfLogBetaNegBinomial_v_630;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_631> AgradCcdfLogBetaNegBinomial_v_631;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_632> AgradCcdfLogBetaNegBinomial_v_632;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_633> AgradCcdfLogBetaNegBinomial_v_633;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_634> AgradCcdfLogBetaNegBinomial_v_634;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_635> AgradCcdfLogBetaNegBinomial_v_635;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_636> AgradCcdfLogBetaNegBinomial_v_636;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_637> AgradCcdfLogBetaNegBinomial_v_637;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_638> AgradCcdfLogBetaNegBinomial_v_638;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_639> AgradCcdfLogBetaNegBinomial_v_639;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_640> AgradCcdfLogBetaNegBinomial_v_640;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_641> AgradCcdfLogBetaNegBinomial_v_641;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_642> AgradCcdfLogBetaNegBinomial_v_642;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_643> AgradCcdfLogBetaNegBinomial_v_643;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_644> AgradCcdfLogBetaNegBinomial_v_644;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_645> AgradCcdfLogBetaNegBinomial_v_645;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_646> AgradCcdfLogBetaNegBinomial_v_646;
+typedef std::tuple<AgradCcdfLogBetaNegBinomial, type_v_647> AgradCcdfLogBetaNegBinomial_v_647;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_600, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_601, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_602, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_603, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_604, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_605, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_606, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_607, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_608, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_609, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_610, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_611, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_612, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_613, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_614, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_615, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_616, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_617, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_618, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_619, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_620, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_621, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_622, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_623, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_624, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_625, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_626, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_627, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_628, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_629, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_630, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_631, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_632, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_633, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_634, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_635, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_636, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_637, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_638, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_639, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_640, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_641, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_642, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_643, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_644, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_645, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_646, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaNegBinomial_v_647, AgradCcdfLogTestFixture, AgradCcdfLogBetaNegBinomial_v_647);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<int, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<int, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<int, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<int, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<int, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<int, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<int, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<int, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<int, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<int, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<int, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<int, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<int, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<int, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<int, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<int, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<int, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<int, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<int, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<int, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_0> AgradCdfBetaNegBinomial_ffv_0;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_1> AgradCdfBetaNegBinomial_ffv_1;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_2> AgradCdfBetaNegBinomial_ffv_2;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_3> AgradCdfBetaNegBinomial_ffv_3;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_4> AgradCdfBetaNegBinomial_ffv_4;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_5> AgradCdfBetaNegBinomial_ffv_5;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_6> AgradCdfBetaNegBinomial_ffv_6;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_7> AgradCdfBetaNegBinomial_ffv_7;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_8> AgradCdfBetaNegBinomial_ffv_8;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_9> AgradCdfBetaNegBinomial_ffv_9;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_10> AgradCdfBetaNegBinomial_ffv_10;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_11> AgradCdfBetaNegBinomial_ffv_11;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_12> AgradCdfBetaNegBinomial_ffv_12;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_13> AgradCdfBetaNegBinomial_ffv_13;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_14> AgradCdfBetaNegBinomial_ffv_14;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_15> AgradCdfBetaNegBinomial_ffv_15;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_16> AgradCdfBetaNegBinomial_ffv_16;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_17> AgradCdfBetaNegBinomial_ffv_17;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_18> AgradCdfBetaNegBinomial_ffv_18;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_19> AgradCdfBetaNegBinomial_ffv_19;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_20> AgradCdfBetaNegBinomial_ffv_20;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_21> AgradCdfBetaNegBinomial_ffv_21;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_22> AgradCdfBetaNegBinomial_ffv_22;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_23> AgradCdfBetaNegBinomial_ffv_23;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_24> AgradCdfBetaNegBinomial_ffv_24;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_25> AgradCdfBetaNegBinomial_ffv_25;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_26> AgradCdfBetaNegBinomial_ffv_26;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_27> AgradCdfBetaNegBinomial_ffv_27;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_28> AgradCdfBetaNegBinomial_ffv_28;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_29> AgradCdfBetaNegBinomial_ffv_29;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_30> AgradCdfBetaNegBinomial_ffv_30;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_31> AgradCdfBetaNegBinomial_ffv_31;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_32> AgradCdfBetaNegBinomial_ffv_32;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_33> AgradCdfBetaNegBinomial_ffv_33;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_34> AgradCdfBetaNegBinomial_ffv_34;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_35> AgradCdfBetaNegBinomial_ffv_35;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_36> AgradCdfBetaNegBinomial_ffv_36;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_37> AgradCdfBetaNegBinomial_ffv_37;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_38> AgradCdfBetaNegBinomial_ffv_38;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_39> AgradCdfBetaNegBinomial_ffv_39;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_40> AgradCdfBetaNegBinomial_ffv_40;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_41> AgradCdfBetaNegBinomial_ffv_41;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_42> AgradCdfBetaNegBinomial_ffv_42;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_43> AgradCdfBetaNegBinomial_ffv_43;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_44> AgradCdfBetaNegBinomial_ffv_44;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_45> AgradCdfBetaNegBinomial_ffv_45;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_46> AgradCdfBetaNegBinomial_ffv_46;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_47> AgradCdfBetaNegBinomial_ffv_47;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_48> AgradCdfBetaNegBinomial_ffv_48;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_49> AgradCdfBetaNegBinomial_ffv_49;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_50> AgradCdfBetaNegBinomial_ffv_50;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_51> AgradCdfBetaNegBinomial_ffv_51;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_52> AgradCdfBetaNegBinomial_ffv_52;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_53> AgradCdfBetaNegBinomial_ffv_53;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_54> AgradCdfBetaNegBinomial_ffv_54;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_55> AgradCdfBetaNegBinomial_ffv_55;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_56> AgradCdfBetaNegBinomial_ffv_56;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_57> AgradCdfBetaNegBinomial_ffv_57;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_58> AgradCdfBetaNegBinomial_ffv_58;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_59> AgradCdfBetaNegBinomial_ffv_59;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_60> AgradCdfBetaNegBinomial_ffv_60;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_61> AgradCdfBetaNegBinomial_ffv_61;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_62> AgradCdfBetaNegBinomial_ffv_62;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_63> AgradCdfBetaNegBinomial_ffv_63;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_64> AgradCdfBetaNegBinomial_ffv_64;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_65> AgradCdfBetaNegBinomial_ffv_65;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_66> AgradCdfBetaNegBinomial_ffv_66;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_67> AgradCdfBetaNegBinomial_ffv_67;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_68> AgradCdfBetaNegBinomial_ffv_68;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_69> AgradCdfBetaNegBinomial_ffv_69;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_70> AgradCdfBetaNegBinomial_ffv_70;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_71> AgradCdfBetaNegBinomial_ffv_71;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_72> AgradCdfBetaNegBinomial_ffv_72;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_73> AgradCdfBetaNegBinomial_ffv_73;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_74> AgradCdfBetaNegBinomial_ffv_74;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_75> AgradCdfBetaNegBinomial_ffv_75;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_76> AgradCdfBetaNegBinomial_ffv_76;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_77> AgradCdfBetaNegBinomial_ffv_77;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_78> AgradCdfBetaNegBinomial_ffv_78;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_79> AgradCdfBetaNegBinomial_ffv_79;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_80> AgradCdfBetaNegBinomial_ffv_80;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_81> AgradCdfBetaNegBinomial_ffv_81;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_82> AgradCdfBetaNegBinomial_ffv_82;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_83> AgradCdfBetaNegBinomial_ffv_83;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_84> AgradCdfBetaNegBinomial_ffv_84;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_85> AgradCdfBetaNegBinomial_ffv_85;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_86> AgradCdfBetaNegBinomial_ffv_86;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_87> AgradCdfBetaNegBinomial_ffv_87;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_88> AgradCdfBetaNegBinomial_ffv_88;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_89> AgradCdfBetaNegBinomial_ffv_89;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_90> AgradCdfBetaNegBinomial_ffv_90;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_91> AgradCdfBetaNegBinomial_ffv_91;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_92> AgradCdfBetaNegBinomial_ffv_92;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_93> AgradCdfBetaNegBinomial_ffv_93;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_94> AgradCdfBetaNegBinomial_ffv_94;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_95> AgradCdfBetaNegBinomial_ffv_95;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_96> AgradCdfBetaNegBinomial_ffv_96;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_97> AgradCdfBetaNegBinomial_ffv_97;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_98> AgradCdfBetaNegBinomial_ffv_98;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_99> AgradCdfBetaNegBinomial_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_0, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_1, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_2, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_3, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_4, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_5, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_6, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_7, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_8, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_9, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_10, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_11, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_12, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_13, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_14, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_15, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_16, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_17, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_18, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_19, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_20, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_21, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_22, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_23, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_24, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_25, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_26, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_27, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_28, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_29, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_30, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_31, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_32, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_33, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_34, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_35, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_36, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_37, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_38, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_39, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_40, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_41, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_42, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_43, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_44, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_45, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_46, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_47, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_48, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_49, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_50, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_51, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_52, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_53, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_54, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_55, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_56, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_57, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_58, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_59, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_60, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_61, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_62, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_63, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_64, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_65, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_66, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_67, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_68, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_69, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_70, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_71, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_72, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_73, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_74, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_75, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_76, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_77, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_78, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_79, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_80, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_81, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_82, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_83, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_84, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_85, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_86, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_87, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_88, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_89, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_90, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_91, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_92, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_93, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_94, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_95, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_96, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_97, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_98, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_99, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_99);
+
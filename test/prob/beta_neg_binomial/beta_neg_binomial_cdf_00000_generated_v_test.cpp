@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<int, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<int, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<int, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<int, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<int, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<int, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<int, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<int, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<int, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<int, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<int, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<int, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<int, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<int, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<int, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<int, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<int, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<int, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<int, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<int, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<int, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<int, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<int, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<int, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<int, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<int, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<int, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<int, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<int, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<int, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<int, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<int, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<int, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<int, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<int, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_0> AgradCdfBetaNegBinomial_v_0;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_1> AgradCdfBetaNegBinomial_v_1;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_2> AgradCdfBetaNegBinomial_v_2;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_3> AgradCdfBetaNegBinomial_v_3;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_4> AgradCdfBetaNegBinomial_v_4;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_5> AgradCdfBetaNegBinomial_v_5;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_6> AgradCdfBetaNegBinomial_v_6;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_7> AgradCdfBetaNegBinomial_v_7;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_8> AgradCdfBetaNegBinomial_v_8;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_9> AgradCdfBetaNegBinomial_v_9;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_10> AgradCdfBetaNegBinomial_v_10;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_11> AgradCdfBetaNegBinomial_v_11;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_12> AgradCdfBetaNegBinomial_v_12;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_13> AgradCdfBetaNegBinomial_v_13;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_14> AgradCdfBetaNegBinomial_v_14;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_15> AgradCdfBetaNegBinomial_v_15;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_16> AgradCdfBetaNegBinomial_v_16;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_17> AgradCdfBetaNegBinomial_v_17;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_18> AgradCdfBetaNegBinomial_v_18;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_19> AgradCdfBetaNegBinomial_v_19;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_20> AgradCdfBetaNegBinomial_v_20;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_21> AgradCdfBetaNegBinomial_v_21;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_22> AgradCdfBetaNegBinomial_v_22;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_23> AgradCdfBetaNegBinomial_v_23;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_24> AgradCdfBetaNegBinomial_v_24;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_25> AgradCdfBetaNegBinomial_v_25;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_26> AgradCdfBetaNegBinomial_v_26;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_27> AgradCdfBetaNegBinomial_v_27;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_28> AgradCdfBetaNegBinomial_v_28;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_29> AgradCdfBetaNegBinomial_v_29;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_30> AgradCdfBetaNegBinomial_v_30;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_31> AgradCdfBetaNegBinomial_v_31;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_32> AgradCdfBetaNegBinomial_v_32;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_33> AgradCdfBetaNegBinomial_v_33;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_34> AgradCdfBetaNegBinomial_v_34;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_35> AgradCdfBetaNegBinomial_v_35;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_36> AgradCdfBetaNegBinomial_v_36;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_37> AgradCdfBetaNegBinomial_v_37;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_38> AgradCdfBetaNegBinomial_v_38;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_39> AgradCdfBetaNegBinomial_v_39;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_40> AgradCdfBetaNegBinomial_v_40;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_41> AgradCdfBetaNegBinomial_v_41;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_42> AgradCdfBetaNegBinomial_v_42;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_43> AgradCdfBetaNegBinomial_v_43;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_44> AgradCdfBetaNegBinomial_v_44;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_45> AgradCdfBetaNegBinomial_v_45;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_46> AgradCdfBetaNegBinomial_v_46;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_47> AgradCdfBetaNegBinomial_v_47;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_48> AgradCdfBetaNegBinomial_v_48;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_49> AgradCdfBetaNegBinomial_v_49;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_50> AgradCdfBetaNegBinomial_v_50;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_51> AgradCdfBetaNegBinomial_v_51;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_52> AgradCdfBetaNegBinomial_v_52;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_53> AgradCdfBetaNegBinomial_v_53;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_54> AgradCdfBetaNegBinomial_v_54;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_55> AgradCdfBetaNegBinomial_v_55;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_56> AgradCdfBetaNegBinomial_v_56;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_57> AgradCdfBetaNegBinomial_v_57;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_58> AgradCdfBetaNegBinomial_v_58;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_59> AgradCdfBetaNegBinomial_v_59;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_60> AgradCdfBetaNegBinomial_v_60;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_61> AgradCdfBetaNegBinomial_v_61;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_62> AgradCdfBetaNegBinomial_v_62;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_63> AgradCdfBetaNegBinomial_v_63;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_64> AgradCdfBetaNegBinomial_v_64;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_65> AgradCdfBetaNegBinomial_v_65;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_66> AgradCdfBetaNegBinomial_v_66;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_67> AgradCdfBetaNegBinomial_v_67;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_68> AgradCdfBetaNegBinomial_v_68;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_69> AgradCdfBetaNegBinomial_v_69;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_70> AgradCdfBetaNegBinomial_v_70;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_71> AgradCdfBetaNegBinomial_v_71;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_72> AgradCdfBetaNegBinomial_v_72;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_73> AgradCdfBetaNegBinomial_v_73;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_74> AgradCdfBetaNegBinomial_v_74;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_75> AgradCdfBetaNegBinomial_v_75;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_76> AgradCdfBetaNegBinomial_v_76;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_77> AgradCdfBetaNegBinomial_v_77;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_78> AgradCdfBetaNegBinomial_v_78;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_79> AgradCdfBetaNegBinomial_v_79;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_80> AgradCdfBetaNegBinomial_v_80;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_81> AgradCdfBetaNegBinomial_v_81;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_82> AgradCdfBetaNegBinomial_v_82;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_83> AgradCdfBetaNegBinomial_v_83;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_84> AgradCdfBetaNegBinomial_v_84;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_85> AgradCdfBetaNegBinomial_v_85;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_86> AgradCdfBetaNegBinomial_v_86;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_87> AgradCdfBetaNegBinomial_v_87;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_88> AgradCdfBetaNegBinomial_v_88;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_89> AgradCdfBetaNegBinomial_v_89;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_90> AgradCdfBetaNegBinomial_v_90;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_91> AgradCdfBetaNegBinomial_v_91;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_92> AgradCdfBetaNegBinomial_v_92;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_93> AgradCdfBetaNegBinomial_v_93;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_94> AgradCdfBetaNegBinomial_v_94;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_95> AgradCdfBetaNegBinomial_v_95;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_96> AgradCdfBetaNegBinomial_v_96;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_97> AgradCdfBetaNegBinomial_v_97;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_98> AgradCdfBetaNegBinomial_v_98;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_99> AgradCdfBetaNegBinomial_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_0, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_1, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_2, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_3, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_4, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_5, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_6, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_7, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_8, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_9, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_10, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_11, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_12, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_13, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_14, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_15, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_16, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_17, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_18, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_19, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_20, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_21, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_22, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_23, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_24, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_25, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_26, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_27, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_28, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_29, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_30, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_31, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_32, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_33, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_34, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_35, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_36, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_37, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_38, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_39, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_40, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_41, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_42, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_43, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_44, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_45, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_46, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_47, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_48, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_49, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_50, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_51, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_52, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_53, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_54, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_55, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_56, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_57, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_58, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_59, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_60, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_61, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_62, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_63, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_64, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_65, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_66, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_67, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_68, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_69, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_70, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_71, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_72, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_73, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_74, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_75, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_76, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_77, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_78, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_79, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_80, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_81, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_82, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_83, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_84, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_85, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_86, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_87, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_88, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_89, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_90, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_91, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_92, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_93, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_94, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_95, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_96, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_97, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_98, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_99, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<int, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<int, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<int, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<int, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<int, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<int, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<int, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<int, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<int, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<int, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<int, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<int, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<int, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<int, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<int, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<int, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<int, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<int, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<int, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<int, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<int, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<int, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<int, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<int, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<int, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<int, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<int, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<int, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<int, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<int, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<int, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<int, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<int, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<int, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<int, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<int, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<int, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<int, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<int, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_0> AgradCdfBetaNegBinomial_vv_0;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_1> AgradCdfBetaNegBinomial_vv_1;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_2> AgradCdfBetaNegBinomial_vv_2;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_3> AgradCdfBetaNegBinomial_vv_3;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_4> AgradCdfBetaNegBinomial_vv_4;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_5> AgradCdfBetaNegBinomial_vv_5;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_6> AgradCdfBetaNegBinomial_vv_6;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_7> AgradCdfBetaNegBinomial_vv_7;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_8> AgradCdfBetaNegBinomial_vv_8;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_9> AgradCdfBetaNegBinomial_vv_9;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_10> AgradCdfBetaNegBinomial_vv_10;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_11> AgradCdfBetaNegBinomial_vv_11;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_12> AgradCdfBetaNegBinomial_vv_12;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_13> AgradCdfBetaNegBinomial_vv_13;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_14> AgradCdfBetaNegBinomial_vv_14;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_15> AgradCdfBetaNegBinomial_vv_15;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_16> AgradCdfBetaNegBinomial_vv_16;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_17> AgradCdfBetaNegBinomial_vv_17;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_18> AgradCdfBetaNegBinomial_vv_18;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_19> AgradCdfBetaNegBinomial_vv_19;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_20> AgradCdfBetaNegBinomial_vv_20;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_21> AgradCdfBetaNegBinomial_vv_21;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_22> AgradCdfBetaNegBinomial_vv_22;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_23> AgradCdfBetaNegBinomial_vv_23;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_24> AgradCdfBetaNegBinomial_vv_24;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_25> AgradCdfBetaNegBinomial_vv_25;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_26> AgradCdfBetaNegBinomial_vv_26;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_27> AgradCdfBetaNegBinomial_vv_27;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_28> AgradCdfBetaNegBinomial_vv_28;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_29> AgradCdfBetaNegBinomial_vv_29;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_30> AgradCdfBetaNegBinomial_vv_30;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_31> AgradCdfBetaNegBinomial_vv_31;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_32> AgradCdfBetaNegBinomial_vv_32;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_33> AgradCdfBetaNegBinomial_vv_33;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_34> AgradCdfBetaNegBinomial_vv_34;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_35> AgradCdfBetaNegBinomial_vv_35;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_36> AgradCdfBetaNegBinomial_vv_36;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_37> AgradCdfBetaNegBinomial_vv_37;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_38> AgradCdfBetaNegBinomial_vv_38;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_39> AgradCdfBetaNegBinomial_vv_39;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_40> AgradCdfBetaNegBinomial_vv_40;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_41> AgradCdfBetaNegBinomial_vv_41;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_42> AgradCdfBetaNegBinomial_vv_42;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_43> AgradCdfBetaNegBinomial_vv_43;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_44> AgradCdfBetaNegBinomial_vv_44;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_45> AgradCdfBetaNegBinomial_vv_45;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_46> AgradCdfBetaNegBinomial_vv_46;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_47> AgradCdfBetaNegBinomial_vv_47;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_48> AgradCdfBetaNegBinomial_vv_48;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_49> AgradCdfBetaNegBinomial_vv_49;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_50> AgradCdfBetaNegBinomial_vv_50;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_51> AgradCdfBetaNegBinomial_vv_51;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_52> AgradCdfBetaNegBinomial_vv_52;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_53> AgradCdfBetaNegBinomial_vv_53;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_54> AgradCdfBetaNegBinomial_vv_54;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_55> AgradCdfBetaNegBinomial_vv_55;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_56> AgradCdfBetaNegBinomial_vv_56;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_57> AgradCdfBetaNegBinomial_vv_57;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_58> AgradCdfBetaNegBinomial_vv_58;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_59> AgradCdfBetaNegBinomial_vv_59;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_60> AgradCdfBetaNegBinomial_vv_60;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_61> AgradCdfBetaNegBinomial_vv_61;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_62> AgradCdfBetaNegBinomial_vv_62;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_63> AgradCdfBetaNegBinomial_vv_63;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_64> AgradCdfBetaNegBinomial_vv_64;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_65> AgradCdfBetaNegBinomial_vv_65;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_66> AgradCdfBetaNegBinomial_vv_66;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_67> AgradCdfBetaNegBinomial_vv_67;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_68> AgradCdfBetaNegBinomial_vv_68;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_69> AgradCdfBetaNegBinomial_vv_69;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_70> AgradCdfBetaNegBinomial_vv_70;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_71> AgradCdfBetaNegBinomial_vv_71;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_72> AgradCdfBetaNegBinomial_vv_72;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_73> AgradCdfBetaNegBinomial_vv_73;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_74> AgradCdfBetaNegBinomial_vv_74;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_75> AgradCdfBetaNegBinomial_vv_75;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_76> AgradCdfBetaNegBinomial_vv_76;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_77> AgradCdfBetaNegBinomial_vv_77;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_78> AgradCdfBetaNegBinomial_vv_78;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_79> AgradCdfBetaNegBinomial_vv_79;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_80> AgradCdfBetaNegBinomial_vv_80;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_81> AgradCdfBetaNegBinomial_vv_81;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_82> AgradCdfBetaNegBinomial_vv_82;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_83> AgradCdfBetaNegBinomial_vv_83;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_84> AgradCdfBetaNegBinomial_vv_84;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_85> AgradCdfBetaNegBinomial_vv_85;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_86> AgradCdfBetaNegBinomial_vv_86;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_87> AgradCdfBetaNegBinomial_vv_87;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_88> AgradCdfBetaNegBinomial_vv_88;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_89> AgradCdfBetaNegBinomial_vv_89;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_90> AgradCdfBetaNegBinomial_vv_90;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_91> AgradCdfBetaNegBinomial_vv_91;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_92> AgradCdfBetaNegBinomial_vv_92;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_93> AgradCdfBetaNegBinomial_vv_93;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_94> AgradCdfBetaNegBinomial_vv_94;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_95> AgradCdfBetaNegBinomial_vv_95;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_96> AgradCdfBetaNegBinomial_vv_96;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_97> AgradCdfBetaNegBinomial_vv_97;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_98> AgradCdfBetaNegBinomial_vv_98;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_99> AgradCdfBetaNegBinomial_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_0, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_1, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_2, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_3, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_4, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_5, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_6, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_7, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_8, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_9, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_10, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_11, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_12, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_13, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_14, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_15, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_16, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_17, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_18, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_19, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_20, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_21, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_22, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_23, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_24, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_25, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_26, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_27, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_28, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_29, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_30, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_31, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_32, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_33, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_34, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_35, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_36, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_37, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_38, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_39, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_40, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_41, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_42, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_43, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_44, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_45, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_46, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_47, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_48, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_49, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_50, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_51, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_52, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_53, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_54, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_55, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_56, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_57, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_58, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_59, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_60, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_61, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_62, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_63, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_64, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_65, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_66, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_67, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_68, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_69, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_70, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_71, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_72, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_73, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_74, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_75, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_76, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_77, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_78, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_79, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_80, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_81, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_82, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_83, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_84, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_85, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_86, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_87, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_88, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_89, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_90, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_91, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_92, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_93, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_94, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_95, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_96, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_97, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_98, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_99, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<int>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<int>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<int>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_100> AgradCdfBetaNegBinomial_ffv_100;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_101> AgradCdfBetaNegBinomial_ffv_101;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_102> AgradCdfBetaNegBinomial_ffv_102;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_103> AgradCdfBetaNegBinomial_ffv_103;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_104> AgradCdfBetaNegBinomial_ffv_104;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_105> AgradCdfBetaNegBinomial_ffv_105;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_106> AgradCdfBetaNegBinomial_ffv_106;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_107> AgradCdfBetaNegBinomial_ffv_107;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_108> AgradCdfBetaNegBinomial_ffv_108;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_109> AgradCdfBetaNegBinomial_ffv_109;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_110> AgradCdfBetaNegBinomial_ffv_110;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_111> AgradCdfBetaNegBinomial_ffv_111;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_112> AgradCdfBetaNegBinomial_ffv_112;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_113> AgradCdfBetaNegBinomial_ffv_113;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_114> AgradCdfBetaNegBinomial_ffv_114;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_115> AgradCdfBetaNegBinomial_ffv_115;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_116> AgradCdfBetaNegBinomial_ffv_116;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_117> AgradCdfBetaNegBinomial_ffv_117;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_118> AgradCdfBetaNegBinomial_ffv_118;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_119> AgradCdfBetaNegBinomial_ffv_119;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_120> AgradCdfBetaNegBinomial_ffv_120;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_121> AgradCdfBetaNegBinomial_ffv_121;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_122> AgradCdfBetaNegBinomial_ffv_122;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_123> AgradCdfBetaNegBinomial_ffv_123;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_124> AgradCdfBetaNegBinomial_ffv_124;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_125> AgradCdfBetaNegBinomial_ffv_125;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_126> AgradCdfBetaNegBinomial_ffv_126;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_127> AgradCdfBetaNegBinomial_ffv_127;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_128> AgradCdfBetaNegBinomial_ffv_128;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_129> AgradCdfBetaNegBinomial_ffv_129;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_130> AgradCdfBetaNegBinomial_ffv_130;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_131> AgradCdfBetaNegBinomial_ffv_131;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_132> AgradCdfBetaNegBinomial_ffv_132;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_133> AgradCdfBetaNegBinomial_ffv_133;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_134> AgradCdfBetaNegBinomial_ffv_134;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_135> AgradCdfBetaNegBinomial_ffv_135;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_136> AgradCdfBetaNegBinomial_ffv_136;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_137> AgradCdfBetaNegBinomial_ffv_137;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_138> AgradCdfBetaNegBinomial_ffv_138;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_139> AgradCdfBetaNegBinomial_ffv_139;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_140> AgradCdfBetaNegBinomial_ffv_140;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_141> AgradCdfBetaNegBinomial_ffv_141;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_142> AgradCdfBetaNegBinomial_ffv_142;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_143> AgradCdfBetaNegBinomial_ffv_143;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_144> AgradCdfBetaNegBinomial_ffv_144;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_145> AgradCdfBetaNegBinomial_ffv_145;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_146> AgradCdfBetaNegBinomial_ffv_146;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_147> AgradCdfBetaNegBinomial_ffv_147;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_148> AgradCdfBetaNegBinomial_ffv_148;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_149> AgradCdfBetaNegBinomial_ffv_149;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_150> AgradCdfBetaNegBinomial_ffv_150;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_151> AgradCdfBetaNegBinomial_ffv_151;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_152> AgradCdfBetaNegBinomial_ffv_152;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_153> AgradCdfBetaNegBinomial_ffv_153;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_154> AgradCdfBetaNegBinomial_ffv_154;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_155> AgradCdfBetaNegBinomial_ffv_155;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_156> AgradCdfBetaNegBinomial_ffv_156;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_157> AgradCdfBetaNegBinomial_ffv_157;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_158> AgradCdfBetaNegBinomial_ffv_158;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_159> AgradCdfBetaNegBinomial_ffv_159;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_160> AgradCdfBetaNegBinomial_ffv_160;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_161> AgradCdfBetaNegBinomial_ffv_161;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_162> AgradCdfBetaNegBinomial_ffv_162;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_163> AgradCdfBetaNegBinomial_ffv_163;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_164> AgradCdfBetaNegBinomial_ffv_164;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_165> AgradCdfBetaNegBinomial_ffv_165;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_166> AgradCdfBetaNegBinomial_ffv_166;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_167> AgradCdfBetaNegBinomial_ffv_167;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_168> AgradCdfBetaNegBinomial_ffv_168;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_169> AgradCdfBetaNegBinomial_ffv_169;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_170> AgradCdfBetaNegBinomial_ffv_170;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_171> AgradCdfBetaNegBinomial_ffv_171;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_172> AgradCdfBetaNegBinomial_ffv_172;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_173> AgradCdfBetaNegBinomial_ffv_173;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_174> AgradCdfBetaNegBinomial_ffv_174;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_175> AgradCdfBetaNegBinomial_ffv_175;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_176> AgradCdfBetaNegBinomial_ffv_176;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_177> AgradCdfBetaNegBinomial_ffv_177;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_178> AgradCdfBetaNegBinomial_ffv_178;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_179> AgradCdfBetaNegBinomial_ffv_179;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_180> AgradCdfBetaNegBinomial_ffv_180;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_181> AgradCdfBetaNegBinomial_ffv_181;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_182> AgradCdfBetaNegBinomial_ffv_182;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_183> AgradCdfBetaNegBinomial_ffv_183;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_184> AgradCdfBetaNegBinomial_ffv_184;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_185> AgradCdfBetaNegBinomial_ffv_185;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_186> AgradCdfBetaNegBinomial_ffv_186;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_187> AgradCdfBetaNegBinomial_ffv_187;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_188> AgradCdfBetaNegBinomial_ffv_188;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_189> AgradCdfBetaNegBinomial_ffv_189;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_190> AgradCdfBetaNegBinomial_ffv_190;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_191> AgradCdfBetaNegBinomial_ffv_191;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_192> AgradCdfBetaNegBinomial_ffv_192;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_193> AgradCdfBetaNegBinomial_ffv_193;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_194> AgradCdfBetaNegBinomial_ffv_194;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_195> AgradCdfBetaNegBinomial_ffv_195;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_196> AgradCdfBetaNegBinomial_ffv_196;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_197> AgradCdfBetaNegBinomial_ffv_197;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_198> AgradCdfBetaNegBinomial_ffv_198;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_199> AgradCdfBetaNegBinomial_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_100, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_101, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_102, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_103, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_104, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_105, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_106, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_107, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_108, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_109, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_110, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_111, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_112, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_113, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_114, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_115, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_116, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_117, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_118, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_119, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_120, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_121, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_122, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_123, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_124, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_125, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_126, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_127, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_128, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_129, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_130, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_131, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_132, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_133, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_134, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_135, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_136, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_137, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_138, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_139, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_140, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_141, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_142, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_143, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_144, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_145, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_146, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_147, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_148, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_149, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_150, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_151, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_152, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_153, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_154, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_155, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_156, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_157, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_158, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_159, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_160, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_161, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_162, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_163, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_164, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_165, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_166, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_167, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_168, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_169, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_170, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_171, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_172, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_173, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_174, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_175, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_176, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_177, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_178, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_179, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_180, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_181, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_182, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_183, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_184, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_185, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_186, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_187, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_188, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_189, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_190, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_191, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_192, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_193, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_194, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_195, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_196, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_197, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_198, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_199, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_199);
+
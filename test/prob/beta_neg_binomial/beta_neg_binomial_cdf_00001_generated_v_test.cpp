@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<int, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<int, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<int, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<int, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<int, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<int, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<int, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<int, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<int, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<int, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<int, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<int, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<int, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<int, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<int, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<int, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<int, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<int, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<int, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<int, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<int, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<int, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<int, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<int, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<int, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<int, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<int, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<int, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<int, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<int, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<int, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<int, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<int, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<int, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<int, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<int, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_100> AgradCdfBetaNegBinomial_v_100;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_101> AgradCdfBetaNegBinomial_v_101;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_102> AgradCdfBetaNegBinomial_v_102;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_103> AgradCdfBetaNegBinomial_v_103;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_104> AgradCdfBetaNegBinomial_v_104;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_105> AgradCdfBetaNegBinomial_v_105;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_106> AgradCdfBetaNegBinomial_v_106;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_107> AgradCdfBetaNegBinomial_v_107;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_108> AgradCdfBetaNegBinomial_v_108;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_109> AgradCdfBetaNegBinomial_v_109;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_110> AgradCdfBetaNegBinomial_v_110;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_111> AgradCdfBetaNegBinomial_v_111;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_112> AgradCdfBetaNegBinomial_v_112;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_113> AgradCdfBetaNegBinomial_v_113;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_114> AgradCdfBetaNegBinomial_v_114;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_115> AgradCdfBetaNegBinomial_v_115;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_116> AgradCdfBetaNegBinomial_v_116;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_117> AgradCdfBetaNegBinomial_v_117;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_118> AgradCdfBetaNegBinomial_v_118;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_119> AgradCdfBetaNegBinomial_v_119;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_120> AgradCdfBetaNegBinomial_v_120;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_121> AgradCdfBetaNegBinomial_v_121;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_122> AgradCdfBetaNegBinomial_v_122;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_123> AgradCdfBetaNegBinomial_v_123;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_124> AgradCdfBetaNegBinomial_v_124;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_125> AgradCdfBetaNegBinomial_v_125;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_126> AgradCdfBetaNegBinomial_v_126;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_127> AgradCdfBetaNegBinomial_v_127;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_128> AgradCdfBetaNegBinomial_v_128;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_129> AgradCdfBetaNegBinomial_v_129;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_130> AgradCdfBetaNegBinomial_v_130;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_131> AgradCdfBetaNegBinomial_v_131;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_132> AgradCdfBetaNegBinomial_v_132;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_133> AgradCdfBetaNegBinomial_v_133;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_134> AgradCdfBetaNegBinomial_v_134;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_135> AgradCdfBetaNegBinomial_v_135;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_136> AgradCdfBetaNegBinomial_v_136;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_137> AgradCdfBetaNegBinomial_v_137;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_138> AgradCdfBetaNegBinomial_v_138;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_139> AgradCdfBetaNegBinomial_v_139;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_140> AgradCdfBetaNegBinomial_v_140;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_141> AgradCdfBetaNegBinomial_v_141;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_142> AgradCdfBetaNegBinomial_v_142;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_143> AgradCdfBetaNegBinomial_v_143;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_144> AgradCdfBetaNegBinomial_v_144;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_145> AgradCdfBetaNegBinomial_v_145;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_146> AgradCdfBetaNegBinomial_v_146;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_147> AgradCdfBetaNegBinomial_v_147;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_148> AgradCdfBetaNegBinomial_v_148;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_149> AgradCdfBetaNegBinomial_v_149;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_150> AgradCdfBetaNegBinomial_v_150;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_151> AgradCdfBetaNegBinomial_v_151;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_152> AgradCdfBetaNegBinomial_v_152;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_153> AgradCdfBetaNegBinomial_v_153;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_154> AgradCdfBetaNegBinomial_v_154;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_155> AgradCdfBetaNegBinomial_v_155;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_156> AgradCdfBetaNegBinomial_v_156;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_157> AgradCdfBetaNegBinomial_v_157;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_158> AgradCdfBetaNegBinomial_v_158;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_159> AgradCdfBetaNegBinomial_v_159;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_160> AgradCdfBetaNegBinomial_v_160;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_161> AgradCdfBetaNegBinomial_v_161;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_162> AgradCdfBetaNegBinomial_v_162;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_163> AgradCdfBetaNegBinomial_v_163;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_164> AgradCdfBetaNegBinomial_v_164;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_165> AgradCdfBetaNegBinomial_v_165;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_166> AgradCdfBetaNegBinomial_v_166;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_167> AgradCdfBetaNegBinomial_v_167;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_168> AgradCdfBetaNegBinomial_v_168;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_169> AgradCdfBetaNegBinomial_v_169;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_170> AgradCdfBetaNegBinomial_v_170;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_171> AgradCdfBetaNegBinomial_v_171;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_172> AgradCdfBetaNegBinomial_v_172;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_173> AgradCdfBetaNegBinomial_v_173;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_174> AgradCdfBetaNegBinomial_v_174;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_175> AgradCdfBetaNegBinomial_v_175;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_176> AgradCdfBetaNegBinomial_v_176;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_177> AgradCdfBetaNegBinomial_v_177;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_178> AgradCdfBetaNegBinomial_v_178;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_179> AgradCdfBetaNegBinomial_v_179;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_180> AgradCdfBetaNegBinomial_v_180;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_181> AgradCdfBetaNegBinomial_v_181;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_182> AgradCdfBetaNegBinomial_v_182;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_183> AgradCdfBetaNegBinomial_v_183;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_184> AgradCdfBetaNegBinomial_v_184;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_185> AgradCdfBetaNegBinomial_v_185;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_186> AgradCdfBetaNegBinomial_v_186;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_187> AgradCdfBetaNegBinomial_v_187;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_188> AgradCdfBetaNegBinomial_v_188;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_189> AgradCdfBetaNegBinomial_v_189;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_190> AgradCdfBetaNegBinomial_v_190;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_191> AgradCdfBetaNegBinomial_v_191;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_192> AgradCdfBetaNegBinomial_v_192;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_193> AgradCdfBetaNegBinomial_v_193;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_194> AgradCdfBetaNegBinomial_v_194;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_195> AgradCdfBetaNegBinomial_v_195;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_196> AgradCdfBetaNegBinomial_v_196;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_197> AgradCdfBetaNegBinomial_v_197;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_198> AgradCdfBetaNegBinomial_v_198;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_199> AgradCdfBetaNegBinomial_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_100, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_101, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_102, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_103, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_104, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_105, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_106, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_107, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_108, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_109, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_110, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_111, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_112, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_113, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_114, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_115, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_116, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_117, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_118, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_119, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_120, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_121, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_122, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_123, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_124, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_125, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_126, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_127, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_128, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_129, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_130, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_131, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_132, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_133, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_134, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_135, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_136, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_137, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_138, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_139, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_140, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_141, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_142, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_143, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_144, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_145, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_146, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_147, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_148, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_149, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_150, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_151, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_152, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_153, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_154, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_155, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_156, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_157, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_158, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_159, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_160, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_161, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_162, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_163, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_164, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_165, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_166, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_167, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_168, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_169, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_170, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_171, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_172, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_173, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_174, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_175, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_176, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_177, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_178, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_179, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_180, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_181, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_182, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_183, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_184, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_185, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_186, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_187, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_188, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_189, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_190, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_191, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_192, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_193, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_194, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_195, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_196, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_197, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_198, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_199, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_199);
+
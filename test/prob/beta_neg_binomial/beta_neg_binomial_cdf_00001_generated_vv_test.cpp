@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<int, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<int, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<int, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<int, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<int, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<int, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<int, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<int, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<int, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<int, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<int, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<int, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<int, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<int, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<int, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<int, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<int, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<int, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<int, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<int, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<int, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<int, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<int>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<int>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<int>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<int>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<int>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_100> AgradCdfBetaNegBinomial_vv_100;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_101> AgradCdfBetaNegBinomial_vv_101;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_102> AgradCdfBetaNegBinomial_vv_102;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_103> AgradCdfBetaNegBinomial_vv_103;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_104> AgradCdfBetaNegBinomial_vv_104;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_105> AgradCdfBetaNegBinomial_vv_105;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_106> AgradCdfBetaNegBinomial_vv_106;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_107> AgradCdfBetaNegBinomial_vv_107;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_108> AgradCdfBetaNegBinomial_vv_108;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_109> AgradCdfBetaNegBinomial_vv_109;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_110> AgradCdfBetaNegBinomial_vv_110;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_111> AgradCdfBetaNegBinomial_vv_111;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_112> AgradCdfBetaNegBinomial_vv_112;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_113> AgradCdfBetaNegBinomial_vv_113;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_114> AgradCdfBetaNegBinomial_vv_114;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_115> AgradCdfBetaNegBinomial_vv_115;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_116> AgradCdfBetaNegBinomial_vv_116;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_117> AgradCdfBetaNegBinomial_vv_117;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_118> AgradCdfBetaNegBinomial_vv_118;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_119> AgradCdfBetaNegBinomial_vv_119;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_120> AgradCdfBetaNegBinomial_vv_120;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_121> AgradCdfBetaNegBinomial_vv_121;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_122> AgradCdfBetaNegBinomial_vv_122;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_123> AgradCdfBetaNegBinomial_vv_123;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_124> AgradCdfBetaNegBinomial_vv_124;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_125> AgradCdfBetaNegBinomial_vv_125;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_126> AgradCdfBetaNegBinomial_vv_126;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_127> AgradCdfBetaNegBinomial_vv_127;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_128> AgradCdfBetaNegBinomial_vv_128;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_129> AgradCdfBetaNegBinomial_vv_129;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_130> AgradCdfBetaNegBinomial_vv_130;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_131> AgradCdfBetaNegBinomial_vv_131;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_132> AgradCdfBetaNegBinomial_vv_132;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_133> AgradCdfBetaNegBinomial_vv_133;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_134> AgradCdfBetaNegBinomial_vv_134;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_135> AgradCdfBetaNegBinomial_vv_135;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_136> AgradCdfBetaNegBinomial_vv_136;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_137> AgradCdfBetaNegBinomial_vv_137;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_138> AgradCdfBetaNegBinomial_vv_138;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_139> AgradCdfBetaNegBinomial_vv_139;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_140> AgradCdfBetaNegBinomial_vv_140;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_141> AgradCdfBetaNegBinomial_vv_141;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_142> AgradCdfBetaNegBinomial_vv_142;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_143> AgradCdfBetaNegBinomial_vv_143;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_144> AgradCdfBetaNegBinomial_vv_144;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_145> AgradCdfBetaNegBinomial_vv_145;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_146> AgradCdfBetaNegBinomial_vv_146;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_147> AgradCdfBetaNegBinomial_vv_147;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_148> AgradCdfBetaNegBinomial_vv_148;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_149> AgradCdfBetaNegBinomial_vv_149;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_150> AgradCdfBetaNegBinomial_vv_150;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_151> AgradCdfBetaNegBinomial_vv_151;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_152> AgradCdfBetaNegBinomial_vv_152;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_153> AgradCdfBetaNegBinomial_vv_153;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_154> AgradCdfBetaNegBinomial_vv_154;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_155> AgradCdfBetaNegBinomial_vv_155;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_156> AgradCdfBetaNegBinomial_vv_156;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_157> AgradCdfBetaNegBinomial_vv_157;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_158> AgradCdfBetaNegBinomial_vv_158;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_159> AgradCdfBetaNegBinomial_vv_159;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_160> AgradCdfBetaNegBinomial_vv_160;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_161> AgradCdfBetaNegBinomial_vv_161;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_162> AgradCdfBetaNegBinomial_vv_162;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_163> AgradCdfBetaNegBinomial_vv_163;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_164> AgradCdfBetaNegBinomial_vv_164;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_165> AgradCdfBetaNegBinomial_vv_165;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_166> AgradCdfBetaNegBinomial_vv_166;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_167> AgradCdfBetaNegBinomial_vv_167;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_168> AgradCdfBetaNegBinomial_vv_168;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_169> AgradCdfBetaNegBinomial_vv_169;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_170> AgradCdfBetaNegBinomial_vv_170;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_171> AgradCdfBetaNegBinomial_vv_171;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_172> AgradCdfBetaNegBinomial_vv_172;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_173> AgradCdfBetaNegBinomial_vv_173;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_174> AgradCdfBetaNegBinomial_vv_174;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_175> AgradCdfBetaNegBinomial_vv_175;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_176> AgradCdfBetaNegBinomial_vv_176;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_177> AgradCdfBetaNegBinomial_vv_177;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_178> AgradCdfBetaNegBinomial_vv_178;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_179> AgradCdfBetaNegBinomial_vv_179;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_180> AgradCdfBetaNegBinomial_vv_180;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_181> AgradCdfBetaNegBinomial_vv_181;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_182> AgradCdfBetaNegBinomial_vv_182;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_183> AgradCdfBetaNegBinomial_vv_183;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_184> AgradCdfBetaNegBinomial_vv_184;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_185> AgradCdfBetaNegBinomial_vv_185;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_186> AgradCdfBetaNegBinomial_vv_186;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_187> AgradCdfBetaNegBinomial_vv_187;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_188> AgradCdfBetaNegBinomial_vv_188;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_189> AgradCdfBetaNegBinomial_vv_189;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_190> AgradCdfBetaNegBinomial_vv_190;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_191> AgradCdfBetaNegBinomial_vv_191;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_192> AgradCdfBetaNegBinomial_vv_192;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_193> AgradCdfBetaNegBinomial_vv_193;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_194> AgradCdfBetaNegBinomial_vv_194;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_195> AgradCdfBetaNegBinomial_vv_195;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_196> AgradCdfBetaNegBinomial_vv_196;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_197> AgradCdfBetaNegBinomial_vv_197;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_198> AgradCdfBetaNegBinomial_vv_198;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_199> AgradCdfBetaNegBinomial_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_100, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_101, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_102, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_103, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_104, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_105, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_106, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_107, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_108, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_109, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_110, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_111, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_112, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_113, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_114, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_115, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_116, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_117, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_118, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_119, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_120, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_121, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_122, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_123, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_124, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_125, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_126, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_127, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_128, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_129, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_130, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_131, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_132, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_133, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_134, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_135, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_136, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_137, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_138, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_139, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_140, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_141, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_142, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_143, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_144, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_145, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_146, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_147, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_148, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_149, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_150, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_151, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_152, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_153, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_154, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_155, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_156, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_157, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_158, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_159, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_160, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_161, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_162, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_163, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_164, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_165, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_166, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_167, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_168, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_169, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_170, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_171, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_172, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_173, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_174, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_175, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_176, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_177, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_178, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_179, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_180, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_181, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_182, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_183, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_184, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_185, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_186, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_187, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_188, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_189, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_190, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_191, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_192, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_193, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_194, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_195, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_196, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_197, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_198, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_199, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_200> AgradCdfBetaNegBinomial_ffv_200;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_201> AgradCdfBetaNegBinomial_ffv_201;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_202> AgradCdfBetaNegBinomial_ffv_202;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_203> AgradCdfBetaNegBinomial_ffv_203;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_204> AgradCdfBetaNegBinomial_ffv_204;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_205> AgradCdfBetaNegBinomial_ffv_205;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_206> AgradCdfBetaNegBinomial_ffv_206;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_207> AgradCdfBetaNegBinomial_ffv_207;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_208> AgradCdfBetaNegBinomial_ffv_208;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_209> AgradCdfBetaNegBinomial_ffv_209;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_210> AgradCdfBetaNegBinomial_ffv_210;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_211> AgradCdfBetaNegBinomial_ffv_211;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_212> AgradCdfBetaNegBinomial_ffv_212;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_213> AgradCdfBetaNegBinomial_ffv_213;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_214> AgradCdfBetaNegBinomial_ffv_214;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_215> AgradCdfBetaNegBinomial_ffv_215;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_216> AgradCdfBetaNegBinomial_ffv_216;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_217> AgradCdfBetaNegBinomial_ffv_217;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_218> AgradCdfBetaNegBinomial_ffv_218;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_219> AgradCdfBetaNegBinomial_ffv_219;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_220> AgradCdfBetaNegBinomial_ffv_220;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_221> AgradCdfBetaNegBinomial_ffv_221;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_222> AgradCdfBetaNegBinomial_ffv_222;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_223> AgradCdfBetaNegBinomial_ffv_223;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_224> AgradCdfBetaNegBinomial_ffv_224;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_225> AgradCdfBetaNegBinomial_ffv_225;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_226> AgradCdfBetaNegBinomial_ffv_226;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_227> AgradCdfBetaNegBinomial_ffv_227;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_228> AgradCdfBetaNegBinomial_ffv_228;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_229> AgradCdfBetaNegBinomial_ffv_229;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_230> AgradCdfBetaNegBinomial_ffv_230;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_231> AgradCdfBetaNegBinomial_ffv_231;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_232> AgradCdfBetaNegBinomial_ffv_232;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_233> AgradCdfBetaNegBinomial_ffv_233;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_234> AgradCdfBetaNegBinomial_ffv_234;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_235> AgradCdfBetaNegBinomial_ffv_235;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_236> AgradCdfBetaNegBinomial_ffv_236;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_237> AgradCdfBetaNegBinomial_ffv_237;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_238> AgradCdfBetaNegBinomial_ffv_238;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_239> AgradCdfBetaNegBinomial_ffv_239;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_240> AgradCdfBetaNegBinomial_ffv_240;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_241> AgradCdfBetaNegBinomial_ffv_241;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_242> AgradCdfBetaNegBinomial_ffv_242;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_243> AgradCdfBetaNegBinomial_ffv_243;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_244> AgradCdfBetaNegBinomial_ffv_244;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_245> AgradCdfBetaNegBinomial_ffv_245;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_246> AgradCdfBetaNegBinomial_ffv_246;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_247> AgradCdfBetaNegBinomial_ffv_247;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_248> AgradCdfBetaNegBinomial_ffv_248;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_249> AgradCdfBetaNegBinomial_ffv_249;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_250> AgradCdfBetaNegBinomial_ffv_250;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_251> AgradCdfBetaNegBinomial_ffv_251;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_252> AgradCdfBetaNegBinomial_ffv_252;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_253> AgradCdfBetaNegBinomial_ffv_253;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_254> AgradCdfBetaNegBinomial_ffv_254;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_255> AgradCdfBetaNegBinomial_ffv_255;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_256> AgradCdfBetaNegBinomial_ffv_256;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_257> AgradCdfBetaNegBinomial_ffv_257;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_258> AgradCdfBetaNegBinomial_ffv_258;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_259> AgradCdfBetaNegBinomial_ffv_259;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_260> AgradCdfBetaNegBinomial_ffv_260;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_261> AgradCdfBetaNegBinomial_ffv_261;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_262> AgradCdfBetaNegBinomial_ffv_262;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_263> AgradCdfBetaNegBinomial_ffv_263;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_264> AgradCdfBetaNegBinomial_ffv_264;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_265> AgradCdfBetaNegBinomial_ffv_265;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_266> AgradCdfBetaNegBinomial_ffv_266;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_267> AgradCdfBetaNegBinomial_ffv_267;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_268> AgradCdfBetaNegBinomial_ffv_268;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_269> AgradCdfBetaNegBinomial_ffv_269;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_270> AgradCdfBetaNegBinomial_ffv_270;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_271> AgradCdfBetaNegBinomial_ffv_271;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_272> AgradCdfBetaNegBinomial_ffv_272;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_273> AgradCdfBetaNegBinomial_ffv_273;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_274> AgradCdfBetaNegBinomial_ffv_274;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_275> AgradCdfBetaNegBinomial_ffv_275;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_276> AgradCdfBetaNegBinomial_ffv_276;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_277> AgradCdfBetaNegBinomial_ffv_277;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_278> AgradCdfBetaNegBinomial_ffv_278;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_279> AgradCdfBetaNegBinomial_ffv_279;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_280> AgradCdfBetaNegBinomial_ffv_280;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_281> AgradCdfBetaNegBinomial_ffv_281;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_282> AgradCdfBetaNegBinomial_ffv_282;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_283> AgradCdfBetaNegBinomial_ffv_283;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_284> AgradCdfBetaNegBinomial_ffv_284;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_285> AgradCdfBetaNegBinomial_ffv_285;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_286> AgradCdfBetaNegBinomial_ffv_286;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_287> AgradCdfBetaNegBinomial_ffv_287;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_288> AgradCdfBetaNegBinomial_ffv_288;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_289> AgradCdfBetaNegBinomial_ffv_289;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_290> AgradCdfBetaNegBinomial_ffv_290;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_291> AgradCdfBetaNegBinomial_ffv_291;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_292> AgradCdfBetaNegBinomial_ffv_292;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_293> AgradCdfBetaNegBinomial_ffv_293;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_294> AgradCdfBetaNegBinomial_ffv_294;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_295> AgradCdfBetaNegBinomial_ffv_295;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_296> AgradCdfBetaNegBinomial_ffv_296;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_297> AgradCdfBetaNegBinomial_ffv_297;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_298> AgradCdfBetaNegBinomial_ffv_298;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_299> AgradCdfBetaNegBinomial_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_200, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_201, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_202, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_203, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_204, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_205, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_206, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_207, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_208, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_209, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_210, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_211, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_212, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_213, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_214, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_215, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_216, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_217, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_218, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_219, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_220, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_221, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_222, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_223, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_224, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_225, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_226, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_227, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_228, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_229, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_230, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_231, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_232, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_233, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_234, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_235, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_236, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_237, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_238, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_239, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_240, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_241, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_242, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_243, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_244, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_245, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_246, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_247, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_248, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_249, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_250, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_251, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_252, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_253, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_254, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_255, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_256, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_257, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_258, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_259, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_260, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_261, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_262, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_263, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_264, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_265, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_266, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_267, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_268, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_269, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_270, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_271, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_272, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_273, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_274, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_275, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_276, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_277, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_278, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_279, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_280, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_281, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_282, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_283, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_284, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_285, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_286, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_287, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_288, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_289, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_290, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_291, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_292, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_293, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_294, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_295, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_296, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_297, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_298, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_299, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<int>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<int>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<int>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<int>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<int>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<int>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<int>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<int>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<int>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<int>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<int>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<int>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_200> AgradCdfBetaNegBinomial_v_200;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_201> AgradCdfBetaNegBinomial_v_201;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_202> AgradCdfBetaNegBinomial_v_202;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_203> AgradCdfBetaNegBinomial_v_203;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_204> AgradCdfBetaNegBinomial_v_204;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_205> AgradCdfBetaNegBinomial_v_205;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_206> AgradCdfBetaNegBinomial_v_206;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_207> AgradCdfBetaNegBinomial_v_207;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_208> AgradCdfBetaNegBinomial_v_208;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_209> AgradCdfBetaNegBinomial_v_209;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_210> AgradCdfBetaNegBinomial_v_210;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_211> AgradCdfBetaNegBinomial_v_211;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_212> AgradCdfBetaNegBinomial_v_212;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_213> AgradCdfBetaNegBinomial_v_213;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_214> AgradCdfBetaNegBinomial_v_214;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_215> AgradCdfBetaNegBinomial_v_215;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_216> AgradCdfBetaNegBinomial_v_216;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_217> AgradCdfBetaNegBinomial_v_217;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_218> AgradCdfBetaNegBinomial_v_218;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_219> AgradCdfBetaNegBinomial_v_219;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_220> AgradCdfBetaNegBinomial_v_220;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_221> AgradCdfBetaNegBinomial_v_221;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_222> AgradCdfBetaNegBinomial_v_222;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_223> AgradCdfBetaNegBinomial_v_223;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_224> AgradCdfBetaNegBinomial_v_224;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_225> AgradCdfBetaNegBinomial_v_225;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_226> AgradCdfBetaNegBinomial_v_226;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_227> AgradCdfBetaNegBinomial_v_227;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_228> AgradCdfBetaNegBinomial_v_228;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_229> AgradCdfBetaNegBinomial_v_229;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_230> AgradCdfBetaNegBinomial_v_230;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_231> AgradCdfBetaNegBinomial_v_231;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_232> AgradCdfBetaNegBinomial_v_232;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_233> AgradCdfBetaNegBinomial_v_233;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_234> AgradCdfBetaNegBinomial_v_234;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_235> AgradCdfBetaNegBinomial_v_235;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_236> AgradCdfBetaNegBinomial_v_236;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_237> AgradCdfBetaNegBinomial_v_237;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_238> AgradCdfBetaNegBinomial_v_238;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_239> AgradCdfBetaNegBinomial_v_239;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_240> AgradCdfBetaNegBinomial_v_240;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_241> AgradCdfBetaNegBinomial_v_241;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_242> AgradCdfBetaNegBinomial_v_242;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_243> AgradCdfBetaNegBinomial_v_243;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_244> AgradCdfBetaNegBinomial_v_244;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_245> AgradCdfBetaNegBinomial_v_245;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_246> AgradCdfBetaNegBinomial_v_246;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_247> AgradCdfBetaNegBinomial_v_247;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_248> AgradCdfBetaNegBinomial_v_248;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_249> AgradCdfBetaNegBinomial_v_249;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_250> AgradCdfBetaNegBinomial_v_250;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_251> AgradCdfBetaNegBinomial_v_251;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_252> AgradCdfBetaNegBinomial_v_252;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_253> AgradCdfBetaNegBinomial_v_253;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_254> AgradCdfBetaNegBinomial_v_254;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_255> AgradCdfBetaNegBinomial_v_255;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_256> AgradCdfBetaNegBinomial_v_256;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_257> AgradCdfBetaNegBinomial_v_257;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_258> AgradCdfBetaNegBinomial_v_258;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_259> AgradCdfBetaNegBinomial_v_259;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_260> AgradCdfBetaNegBinomial_v_260;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_261> AgradCdfBetaNegBinomial_v_261;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_262> AgradCdfBetaNegBinomial_v_262;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_263> AgradCdfBetaNegBinomial_v_263;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_264> AgradCdfBetaNegBinomial_v_264;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_265> AgradCdfBetaNegBinomial_v_265;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_266> AgradCdfBetaNegBinomial_v_266;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_267> AgradCdfBetaNegBinomial_v_267;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_268> AgradCdfBetaNegBinomial_v_268;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_269> AgradCdfBetaNegBinomial_v_269;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_270> AgradCdfBetaNegBinomial_v_270;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_271> AgradCdfBetaNegBinomial_v_271;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_272> AgradCdfBetaNegBinomial_v_272;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_273> AgradCdfBetaNegBinomial_v_273;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_274> AgradCdfBetaNegBinomial_v_274;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_275> AgradCdfBetaNegBinomial_v_275;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_276> AgradCdfBetaNegBinomial_v_276;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_277> AgradCdfBetaNegBinomial_v_277;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_278> AgradCdfBetaNegBinomial_v_278;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_279> AgradCdfBetaNegBinomial_v_279;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_280> AgradCdfBetaNegBinomial_v_280;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_281> AgradCdfBetaNegBinomial_v_281;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_282> AgradCdfBetaNegBinomial_v_282;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_283> AgradCdfBetaNegBinomial_v_283;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_284> AgradCdfBetaNegBinomial_v_284;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_285> AgradCdfBetaNegBinomial_v_285;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_286> AgradCdfBetaNegBinomial_v_286;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_287> AgradCdfBetaNegBinomial_v_287;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_288> AgradCdfBetaNegBinomial_v_288;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_289> AgradCdfBetaNegBinomial_v_289;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_290> AgradCdfBetaNegBinomial_v_290;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_291> AgradCdfBetaNegBinomial_v_291;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_292> AgradCdfBetaNegBinomial_v_292;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_293> AgradCdfBetaNegBinomial_v_293;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_294> AgradCdfBetaNegBinomial_v_294;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_295> AgradCdfBetaNegBinomial_v_295;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_296> AgradCdfBetaNegBinomial_v_296;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_297> AgradCdfBetaNegBinomial_v_297;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_298> AgradCdfBetaNegBinomial_v_298;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_299> AgradCdfBetaNegBinomial_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_200, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_201, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_202, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_203, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_204, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_205, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_206, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_207, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_208, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_209, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_210, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_211, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_212, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_213, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_214, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_215, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_216, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_217, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_218, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_219, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_220, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_221, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_222, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_223, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_224, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_225, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_226, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_227, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_228, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_229, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_230, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_231, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_232, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_233, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_234, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_235, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_236, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_237, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_238, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_239, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_240, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_241, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_242, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_243, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_244, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_245, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_246, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_247, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_248, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_249, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_250, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_251, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_252, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_253, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_254, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_255, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_256, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_257, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_258, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_259, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_260, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_261, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_262, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_263, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_264, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_265, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_266, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_267, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_268, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_269, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_270, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_271, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_272, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_273, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_274, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_275, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_276, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_277, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_278, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_279, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_280, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_281, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_282, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_283, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_284, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_285, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_286, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_287, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_288, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_289, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_290, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_291, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_292, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_293, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_294, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_295, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_296, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_297, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_298, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_299, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_299);
+
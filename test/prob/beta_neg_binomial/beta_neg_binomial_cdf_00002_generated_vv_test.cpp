@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<std::vector<int>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<int>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<int>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<int>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<int>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<int>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<int>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<int>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<int>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<int>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<int>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<int>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<int>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<int>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<int>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<int>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_200> AgradCdfBetaNegBinomial_vv_200;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_201> AgradCdfBetaNegBinomial_vv_201;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_202> AgradCdfBetaNegBinomial_vv_202;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_203> AgradCdfBetaNegBinomial_vv_203;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_204> AgradCdfBetaNegBinomial_vv_204;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_205> AgradCdfBetaNegBinomial_vv_205;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_206> AgradCdfBetaNegBinomial_vv_206;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_207> AgradCdfBetaNegBinomial_vv_207;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_208> AgradCdfBetaNegBinomial_vv_208;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_209> AgradCdfBetaNegBinomial_vv_209;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_210> AgradCdfBetaNegBinomial_vv_210;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_211> AgradCdfBetaNegBinomial_vv_211;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_212> AgradCdfBetaNegBinomial_vv_212;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_213> AgradCdfBetaNegBinomial_vv_213;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_214> AgradCdfBetaNegBinomial_vv_214;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_215> AgradCdfBetaNegBinomial_vv_215;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_216> AgradCdfBetaNegBinomial_vv_216;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_217> AgradCdfBetaNegBinomial_vv_217;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_218> AgradCdfBetaNegBinomial_vv_218;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_219> AgradCdfBetaNegBinomial_vv_219;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_220> AgradCdfBetaNegBinomial_vv_220;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_221> AgradCdfBetaNegBinomial_vv_221;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_222> AgradCdfBetaNegBinomial_vv_222;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_223> AgradCdfBetaNegBinomial_vv_223;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_224> AgradCdfBetaNegBinomial_vv_224;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_225> AgradCdfBetaNegBinomial_vv_225;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_226> AgradCdfBetaNegBinomial_vv_226;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_227> AgradCdfBetaNegBinomial_vv_227;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_228> AgradCdfBetaNegBinomial_vv_228;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_229> AgradCdfBetaNegBinomial_vv_229;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_230> AgradCdfBetaNegBinomial_vv_230;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_231> AgradCdfBetaNegBinomial_vv_231;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_232> AgradCdfBetaNegBinomial_vv_232;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_233> AgradCdfBetaNegBinomial_vv_233;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_234> AgradCdfBetaNegBinomial_vv_234;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_235> AgradCdfBetaNegBinomial_vv_235;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_236> AgradCdfBetaNegBinomial_vv_236;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_237> AgradCdfBetaNegBinomial_vv_237;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_238> AgradCdfBetaNegBinomial_vv_238;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_239> AgradCdfBetaNegBinomial_vv_239;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_240> AgradCdfBetaNegBinomial_vv_240;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_241> AgradCdfBetaNegBinomial_vv_241;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_242> AgradCdfBetaNegBinomial_vv_242;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_243> AgradCdfBetaNegBinomial_vv_243;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_244> AgradCdfBetaNegBinomial_vv_244;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_245> AgradCdfBetaNegBinomial_vv_245;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_246> AgradCdfBetaNegBinomial_vv_246;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_247> AgradCdfBetaNegBinomial_vv_247;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_248> AgradCdfBetaNegBinomial_vv_248;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_249> AgradCdfBetaNegBinomial_vv_249;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_250> AgradCdfBetaNegBinomial_vv_250;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_251> AgradCdfBetaNegBinomial_vv_251;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_252> AgradCdfBetaNegBinomial_vv_252;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_253> AgradCdfBetaNegBinomial_vv_253;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_254> AgradCdfBetaNegBinomial_vv_254;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_255> AgradCdfBetaNegBinomial_vv_255;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_256> AgradCdfBetaNegBinomial_vv_256;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_257> AgradCdfBetaNegBinomial_vv_257;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_258> AgradCdfBetaNegBinomial_vv_258;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_259> AgradCdfBetaNegBinomial_vv_259;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_260> AgradCdfBetaNegBinomial_vv_260;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_261> AgradCdfBetaNegBinomial_vv_261;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_262> AgradCdfBetaNegBinomial_vv_262;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_263> AgradCdfBetaNegBinomial_vv_263;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_264> AgradCdfBetaNegBinomial_vv_264;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_265> AgradCdfBetaNegBinomial_vv_265;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_266> AgradCdfBetaNegBinomial_vv_266;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_267> AgradCdfBetaNegBinomial_vv_267;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_268> AgradCdfBetaNegBinomial_vv_268;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_269> AgradCdfBetaNegBinomial_vv_269;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_270> AgradCdfBetaNegBinomial_vv_270;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_271> AgradCdfBetaNegBinomial_vv_271;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_272> AgradCdfBetaNegBinomial_vv_272;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_273> AgradCdfBetaNegBinomial_vv_273;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_274> AgradCdfBetaNegBinomial_vv_274;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_275> AgradCdfBetaNegBinomial_vv_275;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_276> AgradCdfBetaNegBinomial_vv_276;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_277> AgradCdfBetaNegBinomial_vv_277;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_278> AgradCdfBetaNegBinomial_vv_278;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_279> AgradCdfBetaNegBinomial_vv_279;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_280> AgradCdfBetaNegBinomial_vv_280;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_281> AgradCdfBetaNegBinomial_vv_281;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_282> AgradCdfBetaNegBinomial_vv_282;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_283> AgradCdfBetaNegBinomial_vv_283;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_284> AgradCdfBetaNegBinomial_vv_284;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_285> AgradCdfBetaNegBinomial_vv_285;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_286> AgradCdfBetaNegBinomial_vv_286;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_287> AgradCdfBetaNegBinomial_vv_287;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_288> AgradCdfBetaNegBinomial_vv_288;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_289> AgradCdfBetaNegBinomial_vv_289;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_290> AgradCdfBetaNegBinomial_vv_290;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_291> AgradCdfBetaNegBinomial_vv_291;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_292> AgradCdfBetaNegBinomial_vv_292;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_293> AgradCdfBetaNegBinomial_vv_293;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_294> AgradCdfBetaNegBinomial_vv_294;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_295> AgradCdfBetaNegBinomial_vv_295;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_296> AgradCdfBetaNegBinomial_vv_296;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_297> AgradCdfBetaNegBinomial_vv_297;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_298> AgradCdfBetaNegBinomial_vv_298;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_299> AgradCdfBetaNegBinomial_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_200, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_201, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_202, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_203, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_204, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_205, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_206, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_207, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_208, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_209, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_210, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_211, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_212, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_213, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_214, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_215, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_216, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_217, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_218, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_219, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_220, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_221, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_222, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_223, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_224, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_225, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_226, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_227, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_228, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_229, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_230, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_231, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_232, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_233, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_234, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_235, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_236, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_237, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_238, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_239, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_240, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_241, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_242, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_243, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_244, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_245, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_246, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_247, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_248, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_249, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_250, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_251, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_252, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_253, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_254, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_255, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_256, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_257, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_258, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_259, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_260, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_261, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_262, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_263, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_264, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_265, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_266, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_267, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_268, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_269, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_270, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_271, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_272, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_273, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_274, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_275, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_276, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_277, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_278, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_279, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_280, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_281, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_282, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_283, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_284, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_285, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_286, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_287, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_288, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_289, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_290, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_291, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_292, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_293, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_294, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_295, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_296, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_297, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_298, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_299, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_300> AgradCdfBetaNegBinomial_ffv_300;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_301> AgradCdfBetaNegBinomial_ffv_301;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_302> AgradCdfBetaNegBinomial_ffv_302;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_303> AgradCdfBetaNegBinomial_ffv_303;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_304> AgradCdfBetaNegBinomial_ffv_304;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_305> AgradCdfBetaNegBinomial_ffv_305;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_306> AgradCdfBetaNegBinomial_ffv_306;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_307> AgradCdfBetaNegBinomial_ffv_307;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_308> AgradCdfBetaNegBinomial_ffv_308;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_309> AgradCdfBetaNegBinomial_ffv_309;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_310> AgradCdfBetaNegBinomial_ffv_310;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_311> AgradCdfBetaNegBinomial_ffv_311;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_312> AgradCdfBetaNegBinomial_ffv_312;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_313> AgradCdfBetaNegBinomial_ffv_313;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_314> AgradCdfBetaNegBinomial_ffv_314;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_315> AgradCdfBetaNegBinomial_ffv_315;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_316> AgradCdfBetaNegBinomial_ffv_316;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_317> AgradCdfBetaNegBinomial_ffv_317;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_318> AgradCdfBetaNegBinomial_ffv_318;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_319> AgradCdfBetaNegBinomial_ffv_319;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_320> AgradCdfBetaNegBinomial_ffv_320;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_321> AgradCdfBetaNegBinomial_ffv_321;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_322> AgradCdfBetaNegBinomial_ffv_322;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_323> AgradCdfBetaNegBinomial_ffv_323;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_324> AgradCdfBetaNegBinomial_ffv_324;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_325> AgradCdfBetaNegBinomial_ffv_325;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_326> AgradCdfBetaNegBinomial_ffv_326;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_327> AgradCdfBetaNegBinomial_ffv_327;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_328> AgradCdfBetaNegBinomial_ffv_328;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_329> AgradCdfBetaNegBinomial_ffv_329;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_330> AgradCdfBetaNegBinomial_ffv_330;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_331> AgradCdfBetaNegBinomial_ffv_331;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_332> AgradCdfBetaNegBinomial_ffv_332;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_333> AgradCdfBetaNegBinomial_ffv_333;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_334> AgradCdfBetaNegBinomial_ffv_334;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_335> AgradCdfBetaNegBinomial_ffv_335;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_336> AgradCdfBetaNegBinomial_ffv_336;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_337> AgradCdfBetaNegBinomial_ffv_337;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_338> AgradCdfBetaNegBinomial_ffv_338;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_339> AgradCdfBetaNegBinomial_ffv_339;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_340> AgradCdfBetaNegBinomial_ffv_340;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_341> AgradCdfBetaNegBinomial_ffv_341;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_342> AgradCdfBetaNegBinomial_ffv_342;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_343> AgradCdfBetaNegBinomial_ffv_343;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_344> AgradCdfBetaNegBinomial_ffv_344;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_345> AgradCdfBetaNegBinomial_ffv_345;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_346> AgradCdfBetaNegBinomial_ffv_346;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_347> AgradCdfBetaNegBinomial_ffv_347;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_348> AgradCdfBetaNegBinomial_ffv_348;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_349> AgradCdfBetaNegBinomial_ffv_349;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_350> AgradCdfBetaNegBinomial_ffv_350;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_351> AgradCdfBetaNegBinomial_ffv_351;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_352> AgradCdfBetaNegBinomial_ffv_352;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_353> AgradCdfBetaNegBinomial_ffv_353;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_354> AgradCdfBetaNegBinomial_ffv_354;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_355> AgradCdfBetaNegBinomial_ffv_355;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_356> AgradCdfBetaNegBinomial_ffv_356;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_357> AgradCdfBetaNegBinomial_ffv_357;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_358> AgradCdfBetaNegBinomial_ffv_358;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_359> AgradCdfBetaNegBinomial_ffv_359;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_360> AgradCdfBetaNegBinomial_ffv_360;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_361> AgradCdfBetaNegBinomial_ffv_361;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_362> AgradCdfBetaNegBinomial_ffv_362;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_363> AgradCdfBetaNegBinomial_ffv_363;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_364> AgradCdfBetaNegBinomial_ffv_364;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_365> AgradCdfBetaNegBinomial_ffv_365;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_366> AgradCdfBetaNegBinomial_ffv_366;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_367> AgradCdfBetaNegBinomial_ffv_367;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_368> AgradCdfBetaNegBinomial_ffv_368;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_369> AgradCdfBetaNegBinomial_ffv_369;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_370> AgradCdfBetaNegBinomial_ffv_370;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_371> AgradCdfBetaNegBinomial_ffv_371;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_372> AgradCdfBetaNegBinomial_ffv_372;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_373> AgradCdfBetaNegBinomial_ffv_373;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_374> AgradCdfBetaNegBinomial_ffv_374;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_375> AgradCdfBetaNegBinomial_ffv_375;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_376> AgradCdfBetaNegBinomial_ffv_376;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_377> AgradCdfBetaNegBinomial_ffv_377;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_378> AgradCdfBetaNegBinomial_ffv_378;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_379> AgradCdfBetaNegBinomial_ffv_379;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_380> AgradCdfBetaNegBinomial_ffv_380;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_381> AgradCdfBetaNegBinomial_ffv_381;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_382> AgradCdfBetaNegBinomial_ffv_382;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_383> AgradCdfBetaNegBinomial_ffv_383;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_384> AgradCdfBetaNegBinomial_ffv_384;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_385> AgradCdfBetaNegBinomial_ffv_385;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_386> AgradCdfBetaNegBinomial_ffv_386;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_387> AgradCdfBetaNegBinomial_ffv_387;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_388> AgradCdfBetaNegBinomial_ffv_388;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_389> AgradCdfBetaNegBinomial_ffv_389;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_390> AgradCdfBetaNegBinomial_ffv_390;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_391> AgradCdfBetaNegBinomial_ffv_391;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_392> AgradCdfBetaNegBinomial_ffv_392;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_393> AgradCdfBetaNegBinomial_ffv_393;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_394> AgradCdfBetaNegBinomial_ffv_394;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_395> AgradCdfBetaNegBinomial_ffv_395;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_396> AgradCdfBetaNegBinomial_ffv_396;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_397> AgradCdfBetaNegBinomial_ffv_397;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_398> AgradCdfBetaNegBinomial_ffv_398;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_399> AgradCdfBetaNegBinomial_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_300, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_301, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_302, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_303, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_304, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_305, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_306, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_307, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_308, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_309, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_310, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_311, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_312, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_313, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_314, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_315, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_316, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_317, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_318, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_319, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_320, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_321, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_322, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_323, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_324, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_325, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_326, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_327, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_328, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_329, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_330, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_331, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_332, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_333, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_334, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_335, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_336, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_337, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_338, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_339, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_340, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_341, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_342, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_343, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_344, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_345, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_346, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_347, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_348, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_349, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_350, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_351, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_352, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_353, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_354, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_355, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_356, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_357, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_358, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_359, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_360, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_361, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_362, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_363, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_364, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_365, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_366, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_367, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_368, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_369, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_370, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_371, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_372, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_373, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_374, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_375, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_376, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_377, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_378, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_379, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_380, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_381, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_382, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_383, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_384, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_385, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_386, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_387, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_388, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_389, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_390, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_391, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_392, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_393, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_394, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_395, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_396, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_397, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_398, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_399, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<int>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<int>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<int>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<int>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<int>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<int>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<int>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<int>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<int>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<int>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<int>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<int>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_300> AgradCdfBetaNegBinomial_v_300;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_301> AgradCdfBetaNegBinomial_v_301;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_302> AgradCdfBetaNegBinomial_v_302;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_303> AgradCdfBetaNegBinomial_v_303;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_304> AgradCdfBetaNegBinomial_v_304;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_305> AgradCdfBetaNegBinomial_v_305;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_306> AgradCdfBetaNegBinomial_v_306;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_307> AgradCdfBetaNegBinomial_v_307;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_308> AgradCdfBetaNegBinomial_v_308;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_309> AgradCdfBetaNegBinomial_v_309;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_310> AgradCdfBetaNegBinomial_v_310;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_311> AgradCdfBetaNegBinomial_v_311;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_312> AgradCdfBetaNegBinomial_v_312;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_313> AgradCdfBetaNegBinomial_v_313;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_314> AgradCdfBetaNegBinomial_v_314;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_315> AgradCdfBetaNegBinomial_v_315;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_316> AgradCdfBetaNegBinomial_v_316;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_317> AgradCdfBetaNegBinomial_v_317;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_318> AgradCdfBetaNegBinomial_v_318;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_319> AgradCdfBetaNegBinomial_v_319;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_320> AgradCdfBetaNegBinomial_v_320;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_321> AgradCdfBetaNegBinomial_v_321;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_322> AgradCdfBetaNegBinomial_v_322;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_323> AgradCdfBetaNegBinomial_v_323;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_324> AgradCdfBetaNegBinomial_v_324;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_325> AgradCdfBetaNegBinomial_v_325;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_326> AgradCdfBetaNegBinomial_v_326;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_327> AgradCdfBetaNegBinomial_v_327;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_328> AgradCdfBetaNegBinomial_v_328;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_329> AgradCdfBetaNegBinomial_v_329;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_330> AgradCdfBetaNegBinomial_v_330;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_331> AgradCdfBetaNegBinomial_v_331;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_332> AgradCdfBetaNegBinomial_v_332;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_333> AgradCdfBetaNegBinomial_v_333;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_334> AgradCdfBetaNegBinomial_v_334;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_335> AgradCdfBetaNegBinomial_v_335;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_336> AgradCdfBetaNegBinomial_v_336;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_337> AgradCdfBetaNegBinomial_v_337;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_338> AgradCdfBetaNegBinomial_v_338;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_339> AgradCdfBetaNegBinomial_v_339;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_340> AgradCdfBetaNegBinomial_v_340;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_341> AgradCdfBetaNegBinomial_v_341;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_342> AgradCdfBetaNegBinomial_v_342;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_343> AgradCdfBetaNegBinomial_v_343;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_344> AgradCdfBetaNegBinomial_v_344;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_345> AgradCdfBetaNegBinomial_v_345;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_346> AgradCdfBetaNegBinomial_v_346;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_347> AgradCdfBetaNegBinomial_v_347;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_348> AgradCdfBetaNegBinomial_v_348;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_349> AgradCdfBetaNegBinomial_v_349;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_350> AgradCdfBetaNegBinomial_v_350;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_351> AgradCdfBetaNegBinomial_v_351;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_352> AgradCdfBetaNegBinomial_v_352;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_353> AgradCdfBetaNegBinomial_v_353;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_354> AgradCdfBetaNegBinomial_v_354;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_355> AgradCdfBetaNegBinomial_v_355;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_356> AgradCdfBetaNegBinomial_v_356;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_357> AgradCdfBetaNegBinomial_v_357;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_358> AgradCdfBetaNegBinomial_v_358;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_359> AgradCdfBetaNegBinomial_v_359;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_360> AgradCdfBetaNegBinomial_v_360;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_361> AgradCdfBetaNegBinomial_v_361;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_362> AgradCdfBetaNegBinomial_v_362;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_363> AgradCdfBetaNegBinomial_v_363;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_364> AgradCdfBetaNegBinomial_v_364;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_365> AgradCdfBetaNegBinomial_v_365;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_366> AgradCdfBetaNegBinomial_v_366;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_367> AgradCdfBetaNegBinomial_v_367;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_368> AgradCdfBetaNegBinomial_v_368;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_369> AgradCdfBetaNegBinomial_v_369;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_370> AgradCdfBetaNegBinomial_v_370;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_371> AgradCdfBetaNegBinomial_v_371;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_372> AgradCdfBetaNegBinomial_v_372;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_373> AgradCdfBetaNegBinomial_v_373;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_374> AgradCdfBetaNegBinomial_v_374;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_375> AgradCdfBetaNegBinomial_v_375;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_376> AgradCdfBetaNegBinomial_v_376;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_377> AgradCdfBetaNegBinomial_v_377;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_378> AgradCdfBetaNegBinomial_v_378;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_379> AgradCdfBetaNegBinomial_v_379;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_380> AgradCdfBetaNegBinomial_v_380;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_381> AgradCdfBetaNegBinomial_v_381;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_382> AgradCdfBetaNegBinomial_v_382;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_383> AgradCdfBetaNegBinomial_v_383;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_384> AgradCdfBetaNegBinomial_v_384;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_385> AgradCdfBetaNegBinomial_v_385;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_386> AgradCdfBetaNegBinomial_v_386;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_387> AgradCdfBetaNegBinomial_v_387;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_388> AgradCdfBetaNegBinomial_v_388;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_389> AgradCdfBetaNegBinomial_v_389;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_390> AgradCdfBetaNegBinomial_v_390;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_391> AgradCdfBetaNegBinomial_v_391;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_392> AgradCdfBetaNegBinomial_v_392;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_393> AgradCdfBetaNegBinomial_v_393;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_394> AgradCdfBetaNegBinomial_v_394;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_395> AgradCdfBetaNegBinomial_v_395;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_396> AgradCdfBetaNegBinomial_v_396;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_397> AgradCdfBetaNegBinomial_v_397;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_398> AgradCdfBetaNegBinomial_v_398;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_399> AgradCdfBetaNegBinomial_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_300, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_301, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_302, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_303, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_304, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_305, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_306, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_307, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_308, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_309, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_310, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_311, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_312, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_313, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_314, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_315, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_316, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_317, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_318, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_319, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_320, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_321, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_322, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_323, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_324, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_325, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_326, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_327, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_328, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_329, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_330, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_331, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_332, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_333, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_334, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_335, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_336, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_337, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_338, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_339, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_340, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_341, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_342, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_343, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_344, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_345, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_346, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_347, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_348, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_349, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_350, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_351, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_352, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_353, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_354, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_355, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_356, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_357, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_358, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_359, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_360, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_361, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_362, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_363, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_364, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_365, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_366, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_367, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_368, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_369, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_370, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_371, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_372, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_373, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_374, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_375, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_376, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_377, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_378, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_379, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_380, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_381, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_382, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_383, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_384, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_385, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_386, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_387, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_388, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_389, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_390, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_391, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_392, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_393, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_394, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_395, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_396, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_397, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_398, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_399, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_399);
+
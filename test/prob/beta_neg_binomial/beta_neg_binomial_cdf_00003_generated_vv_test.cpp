@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_300> AgradCdfBetaNegBinomial_vv_300;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_301> AgradCdfBetaNegBinomial_vv_301;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_302> AgradCdfBetaNegBinomial_vv_302;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_303> AgradCdfBetaNegBinomial_vv_303;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_304> AgradCdfBetaNegBinomial_vv_304;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_305> AgradCdfBetaNegBinomial_vv_305;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_306> AgradCdfBetaNegBinomial_vv_306;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_307> AgradCdfBetaNegBinomial_vv_307;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_308> AgradCdfBetaNegBinomial_vv_308;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_309> AgradCdfBetaNegBinomial_vv_309;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_310> AgradCdfBetaNegBinomial_vv_310;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_311> AgradCdfBetaNegBinomial_vv_311;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_312> AgradCdfBetaNegBinomial_vv_312;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_313> AgradCdfBetaNegBinomial_vv_313;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_314> AgradCdfBetaNegBinomial_vv_314;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_315> AgradCdfBetaNegBinomial_vv_315;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_316> AgradCdfBetaNegBinomial_vv_316;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_317> AgradCdfBetaNegBinomial_vv_317;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_318> AgradCdfBetaNegBinomial_vv_318;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_319> AgradCdfBetaNegBinomial_vv_319;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_320> AgradCdfBetaNegBinomial_vv_320;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_321> AgradCdfBetaNegBinomial_vv_321;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_322> AgradCdfBetaNegBinomial_vv_322;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_323> AgradCdfBetaNegBinomial_vv_323;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_324> AgradCdfBetaNegBinomial_vv_324;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_325> AgradCdfBetaNegBinomial_vv_325;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_326> AgradCdfBetaNegBinomial_vv_326;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_327> AgradCdfBetaNegBinomial_vv_327;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_328> AgradCdfBetaNegBinomial_vv_328;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_329> AgradCdfBetaNegBinomial_vv_329;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_330> AgradCdfBetaNegBinomial_vv_330;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_331> AgradCdfBetaNegBinomial_vv_331;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_332> AgradCdfBetaNegBinomial_vv_332;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_333> AgradCdfBetaNegBinomial_vv_333;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_334> AgradCdfBetaNegBinomial_vv_334;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_335> AgradCdfBetaNegBinomial_vv_335;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_336> AgradCdfBetaNegBinomial_vv_336;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_337> AgradCdfBetaNegBinomial_vv_337;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_338> AgradCdfBetaNegBinomial_vv_338;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_339> AgradCdfBetaNegBinomial_vv_339;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_340> AgradCdfBetaNegBinomial_vv_340;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_341> AgradCdfBetaNegBinomial_vv_341;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_342> AgradCdfBetaNegBinomial_vv_342;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_343> AgradCdfBetaNegBinomial_vv_343;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_344> AgradCdfBetaNegBinomial_vv_344;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_345> AgradCdfBetaNegBinomial_vv_345;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_346> AgradCdfBetaNegBinomial_vv_346;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_347> AgradCdfBetaNegBinomial_vv_347;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_348> AgradCdfBetaNegBinomial_vv_348;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_349> AgradCdfBetaNegBinomial_vv_349;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_350> AgradCdfBetaNegBinomial_vv_350;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_351> AgradCdfBetaNegBinomial_vv_351;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_352> AgradCdfBetaNegBinomial_vv_352;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_353> AgradCdfBetaNegBinomial_vv_353;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_354> AgradCdfBetaNegBinomial_vv_354;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_355> AgradCdfBetaNegBinomial_vv_355;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_356> AgradCdfBetaNegBinomial_vv_356;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_357> AgradCdfBetaNegBinomial_vv_357;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_358> AgradCdfBetaNegBinomial_vv_358;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_359> AgradCdfBetaNegBinomial_vv_359;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_360> AgradCdfBetaNegBinomial_vv_360;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_361> AgradCdfBetaNegBinomial_vv_361;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_362> AgradCdfBetaNegBinomial_vv_362;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_363> AgradCdfBetaNegBinomial_vv_363;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_364> AgradCdfBetaNegBinomial_vv_364;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_365> AgradCdfBetaNegBinomial_vv_365;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_366> AgradCdfBetaNegBinomial_vv_366;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_367> AgradCdfBetaNegBinomial_vv_367;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_368> AgradCdfBetaNegBinomial_vv_368;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_369> AgradCdfBetaNegBinomial_vv_369;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_370> AgradCdfBetaNegBinomial_vv_370;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_371> AgradCdfBetaNegBinomial_vv_371;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_372> AgradCdfBetaNegBinomial_vv_372;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_373> AgradCdfBetaNegBinomial_vv_373;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_374> AgradCdfBetaNegBinomial_vv_374;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_375> AgradCdfBetaNegBinomial_vv_375;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_376> AgradCdfBetaNegBinomial_vv_376;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_377> AgradCdfBetaNegBinomial_vv_377;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_378> AgradCdfBetaNegBinomial_vv_378;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_379> AgradCdfBetaNegBinomial_vv_379;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_380> AgradCdfBetaNegBinomial_vv_380;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_381> AgradCdfBetaNegBinomial_vv_381;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_382> AgradCdfBetaNegBinomial_vv_382;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_383> AgradCdfBetaNegBinomial_vv_383;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_384> AgradCdfBetaNegBinomial_vv_384;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_385> AgradCdfBetaNegBinomial_vv_385;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_386> AgradCdfBetaNegBinomial_vv_386;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_387> AgradCdfBetaNegBinomial_vv_387;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_388> AgradCdfBetaNegBinomial_vv_388;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_389> AgradCdfBetaNegBinomial_vv_389;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_390> AgradCdfBetaNegBinomial_vv_390;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_391> AgradCdfBetaNegBinomial_vv_391;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_392> AgradCdfBetaNegBinomial_vv_392;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_393> AgradCdfBetaNegBinomial_vv_393;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_394> AgradCdfBetaNegBinomial_vv_394;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_395> AgradCdfBetaNegBinomial_vv_395;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_396> AgradCdfBetaNegBinomial_vv_396;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_397> AgradCdfBetaNegBinomial_vv_397;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_398> AgradCdfBetaNegBinomial_vv_398;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_399> AgradCdfBetaNegBinomial_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_300, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_301, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_302, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_303, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_304, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_305, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_306, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_307, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_308, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_309, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_310, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_311, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_312, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_313, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_314, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_315, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_316, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_317, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_318, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_319, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_320, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_321, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_322, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_323, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_324, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_325, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_326, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_327, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_328, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_329, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_330, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_331, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_332, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_333, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_334, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_335, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_336, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_337, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_338, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_339, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_340, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_341, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_342, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_343, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_344, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_345, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_346, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_347, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_348, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_349, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_350, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_351, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_352, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_353, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_354, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_355, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_356, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_357, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_358, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_359, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_360, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_361, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_362, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_363, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_364, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_365, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_366, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_367, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_368, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_369, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_370, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_371, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_372, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_373, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_374, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_375, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_376, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_377, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_378, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_379, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_380, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_381, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_382, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_383, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_384, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_385, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_386, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_387, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_388, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_389, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_390, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_391, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_392, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_393, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_394, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_395, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_396, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_397, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_398, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_399, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_400> AgradCdfBetaNegBinomial_ffv_400;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_401> AgradCdfBetaNegBinomial_ffv_401;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_402> AgradCdfBetaNegBinomial_ffv_402;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_403> AgradCdfBetaNegBinomial_ffv_403;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_404> AgradCdfBetaNegBinomial_ffv_404;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_405> AgradCdfBetaNegBinomial_ffv_405;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_406> AgradCdfBetaNegBinomial_ffv_406;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_407> AgradCdfBetaNegBinomial_ffv_407;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_408> AgradCdfBetaNegBinomial_ffv_408;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_409> AgradCdfBetaNegBinomial_ffv_409;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_410> AgradCdfBetaNegBinomial_ffv_410;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_411> AgradCdfBetaNegBinomial_ffv_411;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_412> AgradCdfBetaNegBinomial_ffv_412;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_413> AgradCdfBetaNegBinomial_ffv_413;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_414> AgradCdfBetaNegBinomial_ffv_414;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_415> AgradCdfBetaNegBinomial_ffv_415;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_416> AgradCdfBetaNegBinomial_ffv_416;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_417> AgradCdfBetaNegBinomial_ffv_417;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_418> AgradCdfBetaNegBinomial_ffv_418;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_419> AgradCdfBetaNegBinomial_ffv_419;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_420> AgradCdfBetaNegBinomial_ffv_420;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_421> AgradCdfBetaNegBinomial_ffv_421;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_422> AgradCdfBetaNegBinomial_ffv_422;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_423> AgradCdfBetaNegBinomial_ffv_423;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_424> AgradCdfBetaNegBinomial_ffv_424;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_425> AgradCdfBetaNegBinomial_ffv_425;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_426> AgradCdfBetaNegBinomial_ffv_426;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_427> AgradCdfBetaNegBinomial_ffv_427;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_428> AgradCdfBetaNegBinomial_ffv_428;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_429> AgradCdfBetaNegBinomial_ffv_429;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_430> AgradCdfBetaNegBinomial_ffv_430;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_431> AgradCdfBetaNegBinomial_ffv_431;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_432> AgradCdfBetaNegBinomial_ffv_432;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_433> AgradCdfBetaNegBinomial_ffv_433;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_434> AgradCdfBetaNegBinomial_ffv_434;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_435> AgradCdfBetaNegBinomial_ffv_435;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_436> AgradCdfBetaNegBinomial_ffv_436;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_437> AgradCdfBetaNegBinomial_ffv_437;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_438> AgradCdfBetaNegBinomial_ffv_438;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_439> AgradCdfBetaNegBinomial_ffv_439;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_440> AgradCdfBetaNegBinomial_ffv_440;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_441> AgradCdfBetaNegBinomial_ffv_441;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_442> AgradCdfBetaNegBinomial_ffv_442;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_443> AgradCdfBetaNegBinomial_ffv_443;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_444> AgradCdfBetaNegBinomial_ffv_444;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_445> AgradCdfBetaNegBinomial_ffv_445;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_446> AgradCdfBetaNegBinomial_ffv_446;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_447> AgradCdfBetaNegBinomial_ffv_447;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_448> AgradCdfBetaNegBinomial_ffv_448;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_449> AgradCdfBetaNegBinomial_ffv_449;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_450> AgradCdfBetaNegBinomial_ffv_450;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_451> AgradCdfBetaNegBinomial_ffv_451;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_452> AgradCdfBetaNegBinomial_ffv_452;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_453> AgradCdfBetaNegBinomial_ffv_453;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_454> AgradCdfBetaNegBinomial_ffv_454;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_455> AgradCdfBetaNegBinomial_ffv_455;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_456> AgradCdfBetaNegBinomial_ffv_456;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_457> AgradCdfBetaNegBinomial_ffv_457;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_458> AgradCdfBetaNegBinomial_ffv_458;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_459> AgradCdfBetaNegBinomial_ffv_459;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_460> AgradCdfBetaNegBinomial_ffv_460;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_461> AgradCdfBetaNegBinomial_ffv_461;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_462> AgradCdfBetaNegBinomial_ffv_462;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_463> AgradCdfBetaNegBinomial_ffv_463;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_464> AgradCdfBetaNegBinomial_ffv_464;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_465> AgradCdfBetaNegBinomial_ffv_465;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_466> AgradCdfBetaNegBinomial_ffv_466;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_467> AgradCdfBetaNegBinomial_ffv_467;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_468> AgradCdfBetaNegBinomial_ffv_468;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_469> AgradCdfBetaNegBinomial_ffv_469;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_470> AgradCdfBetaNegBinomial_ffv_470;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_471> AgradCdfBetaNegBinomial_ffv_471;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_472> AgradCdfBetaNegBinomial_ffv_472;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_473> AgradCdfBetaNegBinomial_ffv_473;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_474> AgradCdfBetaNegBinomial_ffv_474;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_475> AgradCdfBetaNegBinomial_ffv_475;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_476> AgradCdfBetaNegBinomial_ffv_476;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_477> AgradCdfBetaNegBinomial_ffv_477;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_478> AgradCdfBetaNegBinomial_ffv_478;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_479> AgradCdfBetaNegBinomial_ffv_479;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_480> AgradCdfBetaNegBinomial_ffv_480;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_481> AgradCdfBetaNegBinomial_ffv_481;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_482> AgradCdfBetaNegBinomial_ffv_482;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_483> AgradCdfBetaNegBinomial_ffv_483;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_484> AgradCdfBetaNegBinomial_ffv_484;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_485> AgradCdfBetaNegBinomial_ffv_485;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_486> AgradCdfBetaNegBinomial_ffv_486;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_487> AgradCdfBetaNegBinomial_ffv_487;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_488> AgradCdfBetaNegBinomial_ffv_488;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_489> AgradCdfBetaNegBinomial_ffv_489;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_490> AgradCdfBetaNegBinomial_ffv_490;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_491> AgradCdfBetaNegBinomial_ffv_491;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_492> AgradCdfBetaNegBinomial_ffv_492;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_493> AgradCdfBetaNegBinomial_ffv_493;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_494> AgradCdfBetaNegBinomial_ffv_494;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_495> AgradCdfBetaNegBinomial_ffv_495;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_496> AgradCdfBetaNegBinomial_ffv_496;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_497> AgradCdfBetaNegBinomial_ffv_497;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_498> AgradCdfBetaNegBinomial_ffv_498;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_499> AgradCdfBetaNegBinomial_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_400, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_401, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_402, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_403, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_404, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_405, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_406, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_407, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_408, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_409, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_410, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_411, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_412, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_413, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_414, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_415, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_416, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_417, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_418, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_419, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_420, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_421, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_422, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_423, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_424, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_425, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_426, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_427, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_428, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_429, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_430, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_431, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_432, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_433, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_434, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_435, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_436, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_437, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_438, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_439, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_440, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_441, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_442, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_443, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_444, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_445, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_446, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_447, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_448, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_449, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_450, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_451, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_452, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_453, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_454, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_455, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_456, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_457, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_458, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_459, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_460, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_461, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_462, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_463, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_464, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_465, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_466, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_467, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_468, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_469, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_470, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_471, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_472, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_473, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_474, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_475, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_476, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_477, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_478, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_479, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_480, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_481, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_482, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_483, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_484, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_485, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_486, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_487, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_488, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_489, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_490, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_491, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_492, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_493, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_494, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_495, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_496, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_497, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_498, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_499, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_499);
+
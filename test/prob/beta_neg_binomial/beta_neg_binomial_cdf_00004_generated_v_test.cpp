@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_400> AgradCdfBetaNegBinomial_v_400;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_401> AgradCdfBetaNegBinomial_v_401;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_402> AgradCdfBetaNegBinomial_v_402;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_403> AgradCdfBetaNegBinomial_v_403;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_404> AgradCdfBetaNegBinomial_v_404;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_405> AgradCdfBetaNegBinomial_v_405;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_406> AgradCdfBetaNegBinomial_v_406;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_407> AgradCdfBetaNegBinomial_v_407;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_408> AgradCdfBetaNegBinomial_v_408;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_409> AgradCdfBetaNegBinomial_v_409;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_410> AgradCdfBetaNegBinomial_v_410;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_411> AgradCdfBetaNegBinomial_v_411;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_412> AgradCdfBetaNegBinomial_v_412;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_413> AgradCdfBetaNegBinomial_v_413;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_414> AgradCdfBetaNegBinomial_v_414;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_415> AgradCdfBetaNegBinomial_v_415;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_416> AgradCdfBetaNegBinomial_v_416;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_417> AgradCdfBetaNegBinomial_v_417;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_418> AgradCdfBetaNegBinomial_v_418;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_419> AgradCdfBetaNegBinomial_v_419;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_420> AgradCdfBetaNegBinomial_v_420;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_421> AgradCdfBetaNegBinomial_v_421;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_422> AgradCdfBetaNegBinomial_v_422;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_423> AgradCdfBetaNegBinomial_v_423;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_424> AgradCdfBetaNegBinomial_v_424;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_425> AgradCdfBetaNegBinomial_v_425;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_426> AgradCdfBetaNegBinomial_v_426;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_427> AgradCdfBetaNegBinomial_v_427;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_428> AgradCdfBetaNegBinomial_v_428;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_429> AgradCdfBetaNegBinomial_v_429;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_430> AgradCdfBetaNegBinomial_v_430;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_431> AgradCdfBetaNegBinomial_v_431;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_432> AgradCdfBetaNegBinomial_v_432;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_433> AgradCdfBetaNegBinomial_v_433;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_434> AgradCdfBetaNegBinomial_v_434;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_435> AgradCdfBetaNegBinomial_v_435;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_436> AgradCdfBetaNegBinomial_v_436;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_437> AgradCdfBetaNegBinomial_v_437;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_438> AgradCdfBetaNegBinomial_v_438;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_439> AgradCdfBetaNegBinomial_v_439;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_440> AgradCdfBetaNegBinomial_v_440;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_441> AgradCdfBetaNegBinomial_v_441;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_442> AgradCdfBetaNegBinomial_v_442;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_443> AgradCdfBetaNegBinomial_v_443;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_444> AgradCdfBetaNegBinomial_v_444;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_445> AgradCdfBetaNegBinomial_v_445;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_446> AgradCdfBetaNegBinomial_v_446;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_447> AgradCdfBetaNegBinomial_v_447;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_448> AgradCdfBetaNegBinomial_v_448;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_449> AgradCdfBetaNegBinomial_v_449;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_450> AgradCdfBetaNegBinomial_v_450;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_451> AgradCdfBetaNegBinomial_v_451;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_452> AgradCdfBetaNegBinomial_v_452;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_453> AgradCdfBetaNegBinomial_v_453;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_454> AgradCdfBetaNegBinomial_v_454;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_455> AgradCdfBetaNegBinomial_v_455;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_456> AgradCdfBetaNegBinomial_v_456;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_457> AgradCdfBetaNegBinomial_v_457;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_458> AgradCdfBetaNegBinomial_v_458;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_459> AgradCdfBetaNegBinomial_v_459;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_460> AgradCdfBetaNegBinomial_v_460;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_461> AgradCdfBetaNegBinomial_v_461;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_462> AgradCdfBetaNegBinomial_v_462;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_463> AgradCdfBetaNegBinomial_v_463;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_464> AgradCdfBetaNegBinomial_v_464;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_465> AgradCdfBetaNegBinomial_v_465;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_466> AgradCdfBetaNegBinomial_v_466;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_467> AgradCdfBetaNegBinomial_v_467;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_468> AgradCdfBetaNegBinomial_v_468;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_469> AgradCdfBetaNegBinomial_v_469;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_470> AgradCdfBetaNegBinomial_v_470;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_471> AgradCdfBetaNegBinomial_v_471;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_472> AgradCdfBetaNegBinomial_v_472;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_473> AgradCdfBetaNegBinomial_v_473;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_474> AgradCdfBetaNegBinomial_v_474;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_475> AgradCdfBetaNegBinomial_v_475;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_476> AgradCdfBetaNegBinomial_v_476;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_477> AgradCdfBetaNegBinomial_v_477;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_478> AgradCdfBetaNegBinomial_v_478;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_479> AgradCdfBetaNegBinomial_v_479;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_480> AgradCdfBetaNegBinomial_v_480;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_481> AgradCdfBetaNegBinomial_v_481;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_482> AgradCdfBetaNegBinomial_v_482;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_483> AgradCdfBetaNegBinomial_v_483;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_484> AgradCdfBetaNegBinomial_v_484;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_485> AgradCdfBetaNegBinomial_v_485;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_486> AgradCdfBetaNegBinomial_v_486;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_487> AgradCdfBetaNegBinomial_v_487;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_488> AgradCdfBetaNegBinomial_v_488;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_489> AgradCdfBetaNegBinomial_v_489;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_490> AgradCdfBetaNegBinomial_v_490;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_491> AgradCdfBetaNegBinomial_v_491;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_492> AgradCdfBetaNegBinomial_v_492;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_493> AgradCdfBetaNegBinomial_v_493;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_494> AgradCdfBetaNegBinomial_v_494;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_495> AgradCdfBetaNegBinomial_v_495;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_496> AgradCdfBetaNegBinomial_v_496;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_497> AgradCdfBetaNegBinomial_v_497;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_498> AgradCdfBetaNegBinomial_v_498;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_499> AgradCdfBetaNegBinomial_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_400, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_401, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_402, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_403, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_404, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_405, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_406, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_407, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_408, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_409, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_410, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_411, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_412, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_413, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_414, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_415, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_416, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_417, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_418, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_419, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_420, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_421, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_422, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_423, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_424, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_425, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_426, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_427, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_428, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_429, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_430, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_431, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_432, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_433, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_434, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_435, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_436, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_437, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_438, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_439, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_440, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_441, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_442, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_443, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_444, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_445, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_446, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_447, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_448, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_449, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_450, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_451, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_452, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_453, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_454, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_455, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_456, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_457, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_458, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_459, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_460, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_461, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_462, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_463, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_464, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_465, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_466, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_467, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_468, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_469, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_470, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_471, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_472, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_473, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_474, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_475, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_476, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_477, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_478, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_479, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_480, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_481, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_482, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_483, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_484, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_485, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_486, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_487, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_488, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_489, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_490, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_491, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_492, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_493, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_494, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_495, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_496, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_497, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_498, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_499, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_499);
+
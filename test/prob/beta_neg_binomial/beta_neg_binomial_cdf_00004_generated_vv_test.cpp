@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_400> AgradCdfBetaNegBinomial_vv_400;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_401> AgradCdfBetaNegBinomial_vv_401;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_402> AgradCdfBetaNegBinomial_vv_402;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_403> AgradCdfBetaNegBinomial_vv_403;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_404> AgradCdfBetaNegBinomial_vv_404;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_405> AgradCdfBetaNegBinomial_vv_405;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_406> AgradCdfBetaNegBinomial_vv_406;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_407> AgradCdfBetaNegBinomial_vv_407;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_408> AgradCdfBetaNegBinomial_vv_408;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_409> AgradCdfBetaNegBinomial_vv_409;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_410> AgradCdfBetaNegBinomial_vv_410;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_411> AgradCdfBetaNegBinomial_vv_411;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_412> AgradCdfBetaNegBinomial_vv_412;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_413> AgradCdfBetaNegBinomial_vv_413;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_414> AgradCdfBetaNegBinomial_vv_414;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_415> AgradCdfBetaNegBinomial_vv_415;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_416> AgradCdfBetaNegBinomial_vv_416;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_417> AgradCdfBetaNegBinomial_vv_417;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_418> AgradCdfBetaNegBinomial_vv_418;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_419> AgradCdfBetaNegBinomial_vv_419;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_420> AgradCdfBetaNegBinomial_vv_420;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_421> AgradCdfBetaNegBinomial_vv_421;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_422> AgradCdfBetaNegBinomial_vv_422;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_423> AgradCdfBetaNegBinomial_vv_423;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_424> AgradCdfBetaNegBinomial_vv_424;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_425> AgradCdfBetaNegBinomial_vv_425;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_426> AgradCdfBetaNegBinomial_vv_426;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_427> AgradCdfBetaNegBinomial_vv_427;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_428> AgradCdfBetaNegBinomial_vv_428;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_429> AgradCdfBetaNegBinomial_vv_429;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_430> AgradCdfBetaNegBinomial_vv_430;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_431> AgradCdfBetaNegBinomial_vv_431;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_432> AgradCdfBetaNegBinomial_vv_432;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_433> AgradCdfBetaNegBinomial_vv_433;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_434> AgradCdfBetaNegBinomial_vv_434;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_435> AgradCdfBetaNegBinomial_vv_435;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_436> AgradCdfBetaNegBinomial_vv_436;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_437> AgradCdfBetaNegBinomial_vv_437;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_438> AgradCdfBetaNegBinomial_vv_438;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_439> AgradCdfBetaNegBinomial_vv_439;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_440> AgradCdfBetaNegBinomial_vv_440;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_441> AgradCdfBetaNegBinomial_vv_441;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_442> AgradCdfBetaNegBinomial_vv_442;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_443> AgradCdfBetaNegBinomial_vv_443;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_444> AgradCdfBetaNegBinomial_vv_444;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_445> AgradCdfBetaNegBinomial_vv_445;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_446> AgradCdfBetaNegBinomial_vv_446;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_447> AgradCdfBetaNegBinomial_vv_447;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_448> AgradCdfBetaNegBinomial_vv_448;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_449> AgradCdfBetaNegBinomial_vv_449;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_450> AgradCdfBetaNegBinomial_vv_450;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_451> AgradCdfBetaNegBinomial_vv_451;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_452> AgradCdfBetaNegBinomial_vv_452;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_453> AgradCdfBetaNegBinomial_vv_453;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_454> AgradCdfBetaNegBinomial_vv_454;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_455> AgradCdfBetaNegBinomial_vv_455;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_456> AgradCdfBetaNegBinomial_vv_456;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_457> AgradCdfBetaNegBinomial_vv_457;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_458> AgradCdfBetaNegBinomial_vv_458;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_459> AgradCdfBetaNegBinomial_vv_459;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_460> AgradCdfBetaNegBinomial_vv_460;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_461> AgradCdfBetaNegBinomial_vv_461;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_462> AgradCdfBetaNegBinomial_vv_462;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_463> AgradCdfBetaNegBinomial_vv_463;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_464> AgradCdfBetaNegBinomial_vv_464;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_465> AgradCdfBetaNegBinomial_vv_465;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_466> AgradCdfBetaNegBinomial_vv_466;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_467> AgradCdfBetaNegBinomial_vv_467;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_468> AgradCdfBetaNegBinomial_vv_468;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_469> AgradCdfBetaNegBinomial_vv_469;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_470> AgradCdfBetaNegBinomial_vv_470;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_471> AgradCdfBetaNegBinomial_vv_471;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_472> AgradCdfBetaNegBinomial_vv_472;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_473> AgradCdfBetaNegBinomial_vv_473;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_474> AgradCdfBetaNegBinomial_vv_474;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_475> AgradCdfBetaNegBinomial_vv_475;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_476> AgradCdfBetaNegBinomial_vv_476;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_477> AgradCdfBetaNegBinomial_vv_477;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_478> AgradCdfBetaNegBinomial_vv_478;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_479> AgradCdfBetaNegBinomial_vv_479;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_480> AgradCdfBetaNegBinomial_vv_480;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_481> AgradCdfBetaNegBinomial_vv_481;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_482> AgradCdfBetaNegBinomial_vv_482;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_483> AgradCdfBetaNegBinomial_vv_483;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_484> AgradCdfBetaNegBinomial_vv_484;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_485> AgradCdfBetaNegBinomial_vv_485;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_486> AgradCdfBetaNegBinomial_vv_486;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_487> AgradCdfBetaNegBinomial_vv_487;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_488> AgradCdfBetaNegBinomial_vv_488;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_489> AgradCdfBetaNegBinomial_vv_489;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_490> AgradCdfBetaNegBinomial_vv_490;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_491> AgradCdfBetaNegBinomial_vv_491;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_492> AgradCdfBetaNegBinomial_vv_492;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_493> AgradCdfBetaNegBinomial_vv_493;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_494> AgradCdfBetaNegBinomial_vv_494;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_495> AgradCdfBetaNegBinomial_vv_495;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_496> AgradCdfBetaNegBinomial_vv_496;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_497> AgradCdfBetaNegBinomial_vv_497;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_498> AgradCdfBetaNegBinomial_vv_498;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_499> AgradCdfBetaNegBinomial_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_400, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_401, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_402, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_403, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_404, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_405, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_406, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_407, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_408, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_409, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_410, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_411, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_412, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_413, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_414, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_415, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_416, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_417, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_418, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_419, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_420, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_421, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_422, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_423, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_424, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_425, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_426, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_427, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_428, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_429, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_430, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_431, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_432, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_433, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_434, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_435, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_436, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_437, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_438, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_439, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_440, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_441, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_442, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_443, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_444, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_445, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_446, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_447, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_448, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_449, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_450, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_451, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_452, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_453, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_454, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_455, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_456, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_457, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_458, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_459, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_460, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_461, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_462, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_463, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_464, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_465, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_466, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_467, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_468, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_469, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_470, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_471, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_472, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_473, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_474, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_475, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_476, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_477, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_478, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_479, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_480, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_481, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_482, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_483, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_484, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_485, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_486, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_487, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_488, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_489, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_490, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_491, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_492, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_493, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_494, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_495, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_496, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_497, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_498, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_499, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_499);
+
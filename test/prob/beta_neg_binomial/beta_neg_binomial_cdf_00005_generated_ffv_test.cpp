@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_500> AgradCdfBetaNegBinomial_ffv_500;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_501> AgradCdfBetaNegBinomial_ffv_501;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_502> AgradCdfBetaNegBinomial_ffv_502;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_503> AgradCdfBetaNegBinomial_ffv_503;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_504> AgradCdfBetaNegBinomial_ffv_504;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_505> AgradCdfBetaNegBinomial_ffv_505;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_506> AgradCdfBetaNegBinomial_ffv_506;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_507> AgradCdfBetaNegBinomial_ffv_507;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_508> AgradCdfBetaNegBinomial_ffv_508;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_509> AgradCdfBetaNegBinomial_ffv_509;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_510> AgradCdfBetaNegBinomial_ffv_510;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_511> AgradCdfBetaNegBinomial_ffv_511;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_512> AgradCdfBetaNegBinomial_ffv_512;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_513> AgradCdfBetaNegBinomial_ffv_513;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_514> AgradCdfBetaNegBinomial_ffv_514;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_515> AgradCdfBetaNegBinomial_ffv_515;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_516> AgradCdfBetaNegBinomial_ffv_516;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_517> AgradCdfBetaNegBinomial_ffv_517;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_518> AgradCdfBetaNegBinomial_ffv_518;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_519> AgradCdfBetaNegBinomial_ffv_519;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_520> AgradCdfBetaNegBinomial_ffv_520;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_521> AgradCdfBetaNegBinomial_ffv_521;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_522> AgradCdfBetaNegBinomial_ffv_522;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_523> AgradCdfBetaNegBinomial_ffv_523;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_524> AgradCdfBetaNegBinomial_ffv_524;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_525> AgradCdfBetaNegBinomial_ffv_525;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_526> AgradCdfBetaNegBinomial_ffv_526;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_527> AgradCdfBetaNegBinomial_ffv_527;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_528> AgradCdfBetaNegBinomial_ffv_528;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_529> AgradCdfBetaNegBinomial_ffv_529;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_530> AgradCdfBetaNegBinomial_ffv_530;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_531> AgradCdfBetaNegBinomial_ffv_531;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_532> AgradCdfBetaNegBinomial_ffv_532;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_533> AgradCdfBetaNegBinomial_ffv_533;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_534> AgradCdfBetaNegBinomial_ffv_534;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_535> AgradCdfBetaNegBinomial_ffv_535;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_536> AgradCdfBetaNegBinomial_ffv_536;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_537> AgradCdfBetaNegBinomial_ffv_537;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_538> AgradCdfBetaNegBinomial_ffv_538;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_539> AgradCdfBetaNegBinomial_ffv_539;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_540> AgradCdfBetaNegBinomial_ffv_540;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_541> AgradCdfBetaNegBinomial_ffv_541;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_542> AgradCdfBetaNegBinomial_ffv_542;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_543> AgradCdfBetaNegBinomial_ffv_543;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_544> AgradCdfBetaNegBinomial_ffv_544;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_545> AgradCdfBetaNegBinomial_ffv_545;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_546> AgradCdfBetaNegBinomial_ffv_546;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_547> AgradCdfBetaNegBinomial_ffv_547;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_548> AgradCdfBetaNegBinomial_ffv_548;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_549> AgradCdfBetaNegBinomial_ffv_549;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_550> AgradCdfBetaNegBinomial_ffv_550;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_551> AgradCdfBetaNegBinomial_ffv_551;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_552> AgradCdfBetaNegBinomial_ffv_552;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_553> AgradCdfBetaNegBinomial_ffv_553;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_554> AgradCdfBetaNegBinomial_ffv_554;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_555> AgradCdfBetaNegBinomial_ffv_555;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_556> AgradCdfBetaNegBinomial_ffv_556;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_557> AgradCdfBetaNegBinomial_ffv_557;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_558> AgradCdfBetaNegBinomial_ffv_558;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_559> AgradCdfBetaNegBinomial_ffv_559;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_560> AgradCdfBetaNegBinomial_ffv_560;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_561> AgradCdfBetaNegBinomial_ffv_561;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_562> AgradCdfBetaNegBinomial_ffv_562;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_563> AgradCdfBetaNegBinomial_ffv_563;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_564> AgradCdfBetaNegBinomial_ffv_564;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_565> AgradCdfBetaNegBinomial_ffv_565;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_ffv_566> AgradCdfBetaNegBinomial_ffv_566;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_500, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_501, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_502, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_503, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_504, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_505, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_506, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_507, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_508, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_509, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_510, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_511, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_512, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_513, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_514, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_515, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_516, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_517, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_518, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_519, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_520, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_521, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_522, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_523, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_524, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_525, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_526, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_527, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_528, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_529, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_530, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_531, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_532, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_533, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_534, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_535, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_536, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_537, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_538, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_539, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_540, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_541, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_542, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_543, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_544, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_545, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_546, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_547, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_548, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_549, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_550, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_551, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_552, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_553, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_554, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_555, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_556, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_557, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_558, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_559, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_560, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_561, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_562, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_563, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_564, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_565, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_ffv_566, AgradCdfTestFixture, AgradCdfBetaNegBinomial_ffv_566);
+
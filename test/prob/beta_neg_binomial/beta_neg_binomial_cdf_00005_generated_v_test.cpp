@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_500> AgradCdfBetaNegBinomial_v_500;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_501> AgradCdfBetaNegBinomial_v_501;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_502> AgradCdfBetaNegBinomial_v_502;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_503> AgradCdfBetaNegBinomial_v_503;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_504> AgradCdfBetaNegBinomial_v_504;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_505> AgradCdfBetaNegBinomial_v_505;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_506> AgradCdfBetaNegBinomial_v_506;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_507> AgradCdfBetaNegBinomial_v_507;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_508> AgradCdfBetaNegBinomial_v_508;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_509> AgradCdfBetaNegBinomial_v_509;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_510> AgradCdfBetaNegBinomial_v_510;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_511> AgradCdfBetaNegBinomial_v_511;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_512> AgradCdfBetaNegBinomial_v_512;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_513> AgradCdfBetaNegBinomial_v_513;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_514> AgradCdfBetaNegBinomial_v_514;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_515> AgradCdfBetaNegBinomial_v_515;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_516> AgradCdfBetaNegBinomial_v_516;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_517> AgradCdfBetaNegBinomial_v_517;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_518> AgradCdfBetaNegBinomial_v_518;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_519> AgradCdfBetaNegBinomial_v_519;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_520> AgradCdfBetaNegBinomial_v_520;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_521> AgradCdfBetaNegBinomial_v_521;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_522> AgradCdfBetaNegBinomial_v_522;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_523> AgradCdfBetaNegBinomial_v_523;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_524> AgradCdfBetaNegBinomial_v_524;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_525> AgradCdfBetaNegBinomial_v_525;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_526> AgradCdfBetaNegBinomial_v_526;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_527> AgradCdfBetaNegBinomial_v_527;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_528> AgradCdfBetaNegBinomial_v_528;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_529> AgradCdfBetaNegBinomial_v_529;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_530> AgradCdfBetaNegBinomial_v_530;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_531> AgradCdfBetaNegBinomial_v_531;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_532> AgradCdfBetaNegBinomial_v_532;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_533> AgradCdfBetaNegBinomial_v_533;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_534> AgradCdfBetaNegBinomial_v_534;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_535> AgradCdfBetaNegBinomial_v_535;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_536> AgradCdfBetaNegBinomial_v_536;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_537> AgradCdfBetaNegBinomial_v_537;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_538> AgradCdfBetaNegBinomial_v_538;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_539> AgradCdfBetaNegBinomial_v_539;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_540> AgradCdfBetaNegBinomial_v_540;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_541> AgradCdfBetaNegBinomial_v_541;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_542> AgradCdfBetaNegBinomial_v_542;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_543> AgradCdfBetaNegBinomial_v_543;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_544> AgradCdfBetaNegBinomial_v_544;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_545> AgradCdfBetaNegBinomial_v_545;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_546> AgradCdfBetaNegBinomial_v_546;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_547> AgradCdfBetaNegBinomial_v_547;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_548> AgradCdfBetaNegBinomial_v_548;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_549> AgradCdfBetaNegBinomial_v_549;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_550> AgradCdfBetaNegBinomial_v_550;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_551> AgradCdfBetaNegBinomial_v_551;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_552> AgradCdfBetaNegBinomial_v_552;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_553> AgradCdfBetaNegBinomial_v_553;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_554> AgradCdfBetaNegBinomial_v_554;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_555> AgradCdfBetaNegBinomial_v_555;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_556> AgradCdfBetaNegBinomial_v_556;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_557> AgradCdfBetaNegBinomial_v_557;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_558> AgradCdfBetaNegBinomial_v_558;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_559> AgradCdfBetaNegBinomial_v_559;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_560> AgradCdfBetaNegBinomial_v_560;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_561> AgradCdfBetaNegBinomial_v_561;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_562> AgradCdfBetaNegBinomial_v_562;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_563> AgradCdfBetaNegBinomial_v_563;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_564> AgradCdfBetaNegBinomial_v_564;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_565> AgradCdfBetaNegBinomial_v_565;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_566> AgradCdfBetaNegBinomial_v_566;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_567> AgradCdfBetaNegBinomial_v_567;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_568> AgradCdfBetaNegBinomial_v_568;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_569> AgradCdfBetaNegBinomial_v_569;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_570> AgradCdfBetaNegBinomial_v_570;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_571> AgradCdfBetaNegBinomial_v_571;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_572> AgradCdfBetaNegBinomial_v_572;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_573> AgradCdfBetaNegBinomial_v_573;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_574> AgradCdfBetaNegBinomial_v_574;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_575> AgradCdfBetaNegBinomial_v_575;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_576> AgradCdfBetaNegBinomial_v_576;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_577> AgradCdfBetaNegBinomial_v_577;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_578> AgradCdfBetaNegBinomial_v_578;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_579> AgradCdfBetaNegBinomial_v_579;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_580> AgradCdfBetaNegBinomial_v_580;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_581> AgradCdfBetaNegBinomial_v_581;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_582> AgradCdfBetaNegBinomial_v_582;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_583> AgradCdfBetaNegBinomial_v_583;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_584> AgradCdfBetaNegBinomial_v_584;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_585> AgradCdfBetaNegBinomial_v_585;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_586> AgradCdfBetaNegBinomial_v_586;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_587> AgradCdfBetaNegBinomial_v_587;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_588> AgradCdfBetaNegBinomial_v_588;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_589> AgradCdfBetaNegBinomial_v_589;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_590> AgradCdfBetaNegBinomial_v_590;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_591> AgradCdfBetaNegBinomial_v_591;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_592> AgradCdfBetaNegBinomial_v_592;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_593> AgradCdfBetaNegBinomial_v_593;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_594> AgradCdfBetaNegBinomial_v_594;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_595> AgradCdfBetaNegBinomial_v_595;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_596> AgradCdfBetaNegBinomial_v_596;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_597> AgradCdfBetaNegBinomial_v_597;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_598> AgradCdfBetaNegBinomial_v_598;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_599> AgradCdfBetaNegBinomial_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_500, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_501, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_502, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_503, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_504, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_505, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_506, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_507, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_508, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_509, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_510, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_511, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_512, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_513, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_514, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_515, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_516, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_517, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_518, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_519, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_520, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_521, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_522, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_523, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_524, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_525, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_526, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_527, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_528, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_529, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_530, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_531, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_532, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_533, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_534, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_535, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_536, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_537, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_538, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_539, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_540, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_541, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_542, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_543, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_544, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_545, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_546, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_547, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_548, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_549, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_550, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_551, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_552, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_553, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_554, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_555, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_556, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_557, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_558, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_559, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_560, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_561, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_562, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_563, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_564, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_565, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_566, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_567, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_568, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_569, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_570, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_571, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_572, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_573, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_574, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_575, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_576, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_577, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_578, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_579, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_580, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_581, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_582, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_583, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_584, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_585, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_586, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_587, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_588, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_589, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_590, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_591, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_592, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_593, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_594, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_595, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_596, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_597, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_598, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_599, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_599);
+
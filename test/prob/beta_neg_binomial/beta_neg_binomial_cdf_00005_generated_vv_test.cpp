@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_500> AgradCdfBetaNegBinomial_vv_500;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_501> AgradCdfBetaNegBinomial_vv_501;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_502> AgradCdfBetaNegBinomial_vv_502;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_503> AgradCdfBetaNegBinomial_vv_503;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_504> AgradCdfBetaNegBinomial_vv_504;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_505> AgradCdfBetaNegBinomial_vv_505;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_506> AgradCdfBetaNegBinomial_vv_506;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_507> AgradCdfBetaNegBinomial_vv_507;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_508> AgradCdfBetaNegBinomial_vv_508;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_509> AgradCdfBetaNegBinomial_vv_509;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_510> AgradCdfBetaNegBinomial_vv_510;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_511> AgradCdfBetaNegBinomial_vv_511;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_512> AgradCdfBetaNegBinomial_vv_512;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_513> AgradCdfBetaNegBinomial_vv_513;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_514> AgradCdfBetaNegBinomial_vv_514;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_515> AgradCdfBetaNegBinomial_vv_515;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_516> AgradCdfBetaNegBinomial_vv_516;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_517> AgradCdfBetaNegBinomial_vv_517;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_518> AgradCdfBetaNegBinomial_vv_518;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_519> AgradCdfBetaNegBinomial_vv_519;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_520> AgradCdfBetaNegBinomial_vv_520;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_521> AgradCdfBetaNegBinomial_vv_521;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_522> AgradCdfBetaNegBinomial_vv_522;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_523> AgradCdfBetaNegBinomial_vv_523;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_524> AgradCdfBetaNegBinomial_vv_524;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_525> AgradCdfBetaNegBinomial_vv_525;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_526> AgradCdfBetaNegBinomial_vv_526;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_527> AgradCdfBetaNegBinomial_vv_527;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_528> AgradCdfBetaNegBinomial_vv_528;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_529> AgradCdfBetaNegBinomial_vv_529;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_530> AgradCdfBetaNegBinomial_vv_530;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_531> AgradCdfBetaNegBinomial_vv_531;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_532> AgradCdfBetaNegBinomial_vv_532;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_533> AgradCdfBetaNegBinomial_vv_533;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_534> AgradCdfBetaNegBinomial_vv_534;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_535> AgradCdfBetaNegBinomial_vv_535;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_536> AgradCdfBetaNegBinomial_vv_536;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_537> AgradCdfBetaNegBinomial_vv_537;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_538> AgradCdfBetaNegBinomial_vv_538;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_539> AgradCdfBetaNegBinomial_vv_539;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_540> AgradCdfBetaNegBinomial_vv_540;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_541> AgradCdfBetaNegBinomial_vv_541;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_542> AgradCdfBetaNegBinomial_vv_542;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_543> AgradCdfBetaNegBinomial_vv_543;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_544> AgradCdfBetaNegBinomial_vv_544;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_545> AgradCdfBetaNegBinomial_vv_545;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_546> AgradCdfBetaNegBinomial_vv_546;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_547> AgradCdfBetaNegBinomial_vv_547;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_548> AgradCdfBetaNegBinomial_vv_548;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_549> AgradCdfBetaNegBinomial_vv_549;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_550> AgradCdfBetaNegBinomial_vv_550;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_551> AgradCdfBetaNegBinomial_vv_551;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_552> AgradCdfBetaNegBinomial_vv_552;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_553> AgradCdfBetaNegBinomial_vv_553;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_554> AgradCdfBetaNegBinomial_vv_554;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_555> AgradCdfBetaNegBinomial_vv_555;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_556> AgradCdfBetaNegBinomial_vv_556;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_557> AgradCdfBetaNegBinomial_vv_557;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_558> AgradCdfBetaNegBinomial_vv_558;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_559> AgradCdfBetaNegBinomial_vv_559;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_560> AgradCdfBetaNegBinomial_vv_560;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_561> AgradCdfBetaNegBinomial_vv_561;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_562> AgradCdfBetaNegBinomial_vv_562;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_563> AgradCdfBetaNegBinomial_vv_563;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_564> AgradCdfBetaNegBinomial_vv_564;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_565> AgradCdfBetaNegBinomial_vv_565;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_vv_566> AgradCdfBetaNegBinomial_vv_566;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_500, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_501, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_502, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_503, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_504, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_505, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_506, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_507, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_508, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_509, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_510, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_511, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_512, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_513, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_514, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_515, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_516, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_517, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_518, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_519, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_520, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_521, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_522, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_523, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_524, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_525, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_526, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_527, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_528, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_529, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_530, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_531, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_532, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_533, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_534, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_535, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_536, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_537, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_538, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_539, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_540, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_541, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_542, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_543, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_544, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_545, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_546, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_547, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_548, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_549, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_550, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_551, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_552, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_553, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_554, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_555, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_556, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_557, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_558, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_559, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_560, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_561, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_562, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_563, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_564, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_565, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_vv_566, AgradCdfTestFixture, AgradCdfBetaNegBinomial_vv_566);
+
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_600> AgradCdfBetaNegBinomial_v_600;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_601> AgradCdfBetaNegBinomial_v_601;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_602> AgradCdfBetaNegBinomial_v_602;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_603> AgradCdfBetaNegBinomial_v_603;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_604> AgradCdfBetaNegBinomial_v_604;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_605> AgradCdfBetaNegBinomial_v_605;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_606> AgradCdfBetaNegBinomial_v_606;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_607> AgradCdfBetaNegBinomial_v_607;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_608> AgradCdfBetaNegBinomial_v_608;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_609> AgradCdfBetaNegBinomial_v_609;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_610> AgradCdfBetaNegBinomial_v_610;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_611> AgradCdfBetaNegBinomial_v_611;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_612> AgradCdfBetaNegBinomial_v_612;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_613> AgradCdfBetaNegBinomial_v_613;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_614> AgradCdfBetaNegBinomial_v_614;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_615> AgradCdfBetaNegBinomial_v_615;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_616> AgradCdfBetaNegBinomial_v_616;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_617> AgradCdfBetaNegBinomial_v_617;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_618> AgradCdfBetaNegBinomial_v_618;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_619> AgradCdfBetaNegBinomial_v_619;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_620> AgradCdfBetaNegBinomial_v_620;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_621> AgradCdfBetaNegBinomial_v_621;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_622> AgradCdfBetaNegBinomial_v_622;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_623> AgradCdfBetaNegBinomial_v_623;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_624> AgradCdfBetaNegBinomial_v_624;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_625> AgradCdfBetaNegBinomial_v_625;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_626> AgradCdfBetaNegBinomial_v_626;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_627> AgradCdfBetaNegBinomial_v_627;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_628> AgradCdfBetaNegBinomial_v_628;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_629> AgradCdfBetaNegBinomial_v_629;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_630> AgradCdfBetaNegBinomial_v_630;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_631> AgradCdfBetaNegBinomial_v_631;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_632> AgradCdfBetaNegBinomial_v_632;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_633> AgradCdfBetaNegBinomial_v_633;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_634> AgradCdfBetaNegBinomial_v_634;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_635> AgradCdfBetaNegBinomial_v_635;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_636> AgradCdfBetaNegBinomial_v_636;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_637> AgradCdfBetaNegBinomial_v_637;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_638> AgradCdfBetaNegBinomial_v_638;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_639> AgradCdfBetaNegBinomial_v_639;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_640> AgradCdfBetaNegBinomial_v_640;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_641> AgradCdfBetaNegBinomial_v_641;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_642> AgradCdfBetaNegBinomial_v_642;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_643> AgradCdfBetaNegBinomial_v_643;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_644> AgradCdfBetaNegBinomial_v_644;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_645> AgradCdfBetaNegBinomial_v_645;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_646> AgradCdfBetaNegBinomial_v_646;
+typedef std::tuple<AgradCdfBetaNegBinomial, type_v_647> AgradCdfBetaNegBinomial_v_647;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_600, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_601, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_602, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_603, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_604, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_605, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_606, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_607, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_608, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_609, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_610, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_611, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_612, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_613, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_614, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_615, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_616, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_617, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_618, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_619, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_620, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_621, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_622, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_623, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_624, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_625, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_626, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_627, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_628, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_629, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_630, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_631, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_632, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_633, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_634, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_635, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_636, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_637, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_638, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_639, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_640, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_641, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_642, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_643, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_644, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_645, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_646, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBetaNegBinomial_v_647, AgradCdfTestFixture, AgradCdfBetaNegBinomial_v_647);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<int, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<int, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<int, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<int, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<int, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<int, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<int, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<int, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<int, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<int, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<int, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<int, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<int, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<int, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<int, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<int, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<int, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<int, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<int, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<int, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_0> AgradCdfLogBetaNegBinomial_ffv_0;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_1> AgradCdfLogBetaNegBinomial_ffv_1;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_2> AgradCdfLogBetaNegBinomial_ffv_2;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_3> AgradCdfLogBetaNegBinomial_ffv_3;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_4> AgradCdfLogBetaNegBinomial_ffv_4;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_5> AgradCdfLogBetaNegBinomial_ffv_5;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_6> AgradCdfLogBetaNegBinomial_ffv_6;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_7> AgradCdfLogBetaNegBinomial_ffv_7;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_8> AgradCdfLogBetaNegBinomial_ffv_8;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_9> AgradCdfLogBetaNegBinomial_ffv_9;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_10> AgradCdfLogBetaNegBinomial_ffv_10;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_11> AgradCdfLogBetaNegBinomial_ffv_11;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_12> AgradCdfLogBetaNegBinomial_ffv_12;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_13> AgradCdfLogBetaNegBinomial_ffv_13;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_14> AgradCdfLogBetaNegBinomial_ffv_14;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_15> AgradCdfLogBetaNegBinomial_ffv_15;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_16> AgradCdfLogBetaNegBinomial_ffv_16;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_17> AgradCdfLogBetaNegBinomial_ffv_17;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_18> AgradCdfLogBetaNegBinomial_ffv_18;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_19> AgradCdfLogBetaNegBinomial_ffv_19;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_20> AgradCdfLogBetaNegBinomial_ffv_20;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_21> AgradCdfLogBetaNegBinomial_ffv_21;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_22> AgradCdfLogBetaNegBinomial_ffv_22;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_23> AgradCdfLogBetaNegBinomial_ffv_23;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_24> AgradCdfLogBetaNegBinomial_ffv_24;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_25> AgradCdfLogBetaNegBinomial_ffv_25;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_26> AgradCdfLogBetaNegBinomial_ffv_26;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_27> AgradCdfLogBetaNegBinomial_ffv_27;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_28> AgradCdfLogBetaNegBinomial_ffv_28;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_29> AgradCdfLogBetaNegBinomial_ffv_29;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_30> AgradCdfLogBetaNegBinomial_ffv_30;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_31> AgradCdfLogBetaNegBinomial_ffv_31;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_32> AgradCdfLogBetaNegBinomial_ffv_32;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_33> AgradCdfLogBetaNegBinomial_ffv_33;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_34> AgradCdfLogBetaNegBinomial_ffv_34;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_35> AgradCdfLogBetaNegBinomial_ffv_35;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_36> AgradCdfLogBetaNegBinomial_ffv_36;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_37> AgradCdfLogBetaNegBinomial_ffv_37;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_38> AgradCdfLogBetaNegBinomial_ffv_38;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_39> AgradCdfLogBetaNegBinomial_ffv_39;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_40> AgradCdfLogBetaNegBinomial_ffv_40;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_41> AgradCdfLogBetaNegBinomial_ffv_41;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_42> AgradCdfLogBetaNegBinomial_ffv_42;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_43> AgradCdfLogBetaNegBinomial_ffv_43;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_44> AgradCdfLogBetaNegBinomial_ffv_44;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_45> AgradCdfLogBetaNegBinomial_ffv_45;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_46> AgradCdfLogBetaNegBinomial_ffv_46;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_47> AgradCdfLogBetaNegBinomial_ffv_47;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_48> AgradCdfLogBetaNegBinomial_ffv_48;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_49> AgradCdfLogBetaNegBinomial_ffv_49;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_50> AgradCdfLogBetaNegBinomial_ffv_50;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_51> AgradCdfLogBetaNegBinomial_ffv_51;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_52> AgradCdfLogBetaNegBinomial_ffv_52;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_53> AgradCdfLogBetaNegBinomial_ffv_53;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_54> AgradCdfLogBetaNegBinomial_ffv_54;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_55> AgradCdfLogBetaNegBinomial_ffv_55;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_56> AgradCdfLogBetaNegBinomial_ffv_56;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_57> AgradCdfLogBetaNegBinomial_ffv_57;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_58> AgradCdfLogBetaNegBinomial_ffv_58;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_59> AgradCdfLogBetaNegBinomial_ffv_59;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_60> AgradCdfLogBetaNegBinomial_ffv_60;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_61> AgradCdfLogBetaNegBinomial_ffv_61;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_62> AgradCdfLogBetaNegBinomial_ffv_62;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_63> AgradCdfLogBetaNegBinomial_ffv_63;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_64> AgradCdfLogBetaNegBinomial_ffv_64;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_65> AgradCdfLogBetaNegBinomial_ffv_65;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_66> AgradCdfLogBetaNegBinomial_ffv_66;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_67> AgradCdfLogBetaNegBinomial_ffv_67;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_68> AgradCdfLogBetaNegBinomial_ffv_68;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_69> AgradCdfLogBetaNegBinomial_ffv_69;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_70> AgradCdfLogBetaNegBinomial_ffv_70;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_71> AgradCdfLogBetaNegBinomial_ffv_71;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_72> AgradCdfLogBetaNegBinomial_ffv_72;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_73> AgradCdfLogBetaNegBinomial_ffv_73;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_74> AgradCdfLogBetaNegBinomial_ffv_74;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_75> AgradCdfLogBetaNegBinomial_ffv_75;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_76> AgradCdfLogBetaNegBinomial_ffv_76;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_77> AgradCdfLogBetaNegBinomial_ffv_77;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_78> AgradCdfLogBetaNegBinomial_ffv_78;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_79> AgradCdfLogBetaNegBinomial_ffv_79;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_80> AgradCdfLogBetaNegBinomial_ffv_80;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_81> AgradCdfLogBetaNegBinomial_ffv_81;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_82> AgradCdfLogBetaNegBinomial_ffv_82;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_83> AgradCdfLogBetaNegBinomial_ffv_83;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_84> AgradCdfLogBetaNegBinomial_ffv_84;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_85> AgradCdfLogBetaNegBinomial_ffv_85;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_86> AgradCdfLogBetaNegBinomial_ffv_86;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_87> AgradCdfLogBetaNegBinomial_ffv_87;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_88> AgradCdfLogBetaNegBinomial_ffv_88;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_89> AgradCdfLogBetaNegBinomial_ffv_89;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_90> AgradCdfLogBetaNegBinomial_ffv_90;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_91> AgradCdfLogBetaNegBinomial_ffv_91;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_92> AgradCdfLogBetaNegBinomial_ffv_92;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_93> AgradCdfLogBetaNegBinomial_ffv_93;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_94> AgradCdfLogBetaNegBinomial_ffv_94;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_95> AgradCdfLogBetaNegBinomial_ffv_95;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_96> AgradCdfLogBetaNegBinomial_ffv_96;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_97> AgradCdfLogBetaNegBinomial_ffv_97;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_98> AgradCdfLogBetaNegBinomial_ffv_98;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_99> AgradCdfLogBetaNegBinomial_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_0, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_1, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_2, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_3, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_4, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_5, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_6, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_7, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_8, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_9, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_10, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_11, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_12, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_13, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_14, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_15, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_16, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_17, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_18, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_19, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_20, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_21, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_22, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_23, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_24, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_25, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_26, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_27, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_28, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_29, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_30, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_31, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_32, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_33, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_34, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_35, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_36, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_37, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_38, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_39, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_40, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_41, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_42, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_43, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_44, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_45, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_46, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_47, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_48, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_49, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_50, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_51, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_52, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_53, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_54, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_55, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_56, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_57, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_58, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_59, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_60, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_61, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_62, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_63, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_64, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_65, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_66, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_67, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_68, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_69, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_70, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_71, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_72, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_73, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_74, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_75, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_76, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_77, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_78, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_79, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_80, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_81, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_82, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_83, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_84, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_85, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_86, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_87, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_88, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_89, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_90, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_91, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_92, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_93, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_94, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_95, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_96, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_97, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_98, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_99, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<int, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<int, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<int, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<int, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<int, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<int, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<int, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<int, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<int, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<int, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<int, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<int, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<int, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<int, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<int, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<int, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<int, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<int, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<int, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<int, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<int, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<int, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<int, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<int, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<int, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<int, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<int, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<int, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<int, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<int, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<int, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<int, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<int, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<int, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<int, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_0> AgradCdfLogBetaNegBinomial_v_0;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_1> AgradCdfLogBetaNegBinomial_v_1;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_2> AgradCdfLogBetaNegBinomial_v_2;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_3> AgradCdfLogBetaNegBinomial_v_3;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_4> AgradCdfLogBetaNegBinomial_v_4;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_5> AgradCdfLogBetaNegBinomial_v_5;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_6> AgradCdfLogBetaNegBinomial_v_6;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_7> AgradCdfLogBetaNegBinomial_v_7;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_8> AgradCdfLogBetaNegBinomial_v_8;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_9> AgradCdfLogBetaNegBinomial_v_9;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_10> AgradCdfLogBetaNegBinomial_v_10;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_11> AgradCdfLogBetaNegBinomial_v_11;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_12> AgradCdfLogBetaNegBinomial_v_12;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_13> AgradCdfLogBetaNegBinomial_v_13;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_14> AgradCdfLogBetaNegBinomial_v_14;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_15> AgradCdfLogBetaNegBinomial_v_15;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_16> AgradCdfLogBetaNegBinomial_v_16;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_17> AgradCdfLogBetaNegBinomial_v_17;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_18> AgradCdfLogBetaNegBinomial_v_18;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_19> AgradCdfLogBetaNegBinomial_v_19;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_20> AgradCdfLogBetaNegBinomial_v_20;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_21> AgradCdfLogBetaNegBinomial_v_21;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_22> AgradCdfLogBetaNegBinomial_v_22;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_23> AgradCdfLogBetaNegBinomial_v_23;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_24> AgradCdfLogBetaNegBinomial_v_24;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_25> AgradCdfLogBetaNegBinomial_v_25;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_26> AgradCdfLogBetaNegBinomial_v_26;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_27> AgradCdfLogBetaNegBinomial_v_27;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_28> AgradCdfLogBetaNegBinomial_v_28;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_29> AgradCdfLogBetaNegBinomial_v_29;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_30> AgradCdfLogBetaNegBinomial_v_30;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_31> AgradCdfLogBetaNegBinomial_v_31;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_32> AgradCdfLogBetaNegBinomial_v_32;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_33> AgradCdfLogBetaNegBinomial_v_33;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_34> AgradCdfLogBetaNegBinomial_v_34;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_35> AgradCdfLogBetaNegBinomial_v_35;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_36> AgradCdfLogBetaNegBinomial_v_36;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_37> AgradCdfLogBetaNegBinomial_v_37;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_38> AgradCdfLogBetaNegBinomial_v_38;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_39> AgradCdfLogBetaNegBinomial_v_39;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_40> AgradCdfLogBetaNegBinomial_v_40;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_41> AgradCdfLogBetaNegBinomial_v_41;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_42> AgradCdfLogBetaNegBinomial_v_42;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_43> AgradCdfLogBetaNegBinomial_v_43;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_44> AgradCdfLogBetaNegBinomial_v_44;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_45> AgradCdfLogBetaNegBinomial_v_45;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_46> AgradCdfLogBetaNegBinomial_v_46;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_47> AgradCdfLogBetaNegBinomial_v_47;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_48> AgradCdfLogBetaNegBinomial_v_48;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_49> AgradCdfLogBetaNegBinomial_v_49;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_50> AgradCdfLogBetaNegBinomial_v_50;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_51> AgradCdfLogBetaNegBinomial_v_51;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_52> AgradCdfLogBetaNegBinomial_v_52;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_53> AgradCdfLogBetaNegBinomial_v_53;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_54> AgradCdfLogBetaNegBinomial_v_54;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_55> AgradCdfLogBetaNegBinomial_v_55;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_56> AgradCdfLogBetaNegBinomial_v_56;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_57> AgradCdfLogBetaNegBinomial_v_57;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_58> AgradCdfLogBetaNegBinomial_v_58;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_59> AgradCdfLogBetaNegBinomial_v_59;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_60> AgradCdfLogBetaNegBinomial_v_60;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_61> AgradCdfLogBetaNegBinomial_v_61;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_62> AgradCdfLogBetaNegBinomial_v_62;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_63> AgradCdfLogBetaNegBinomial_v_63;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_64> AgradCdfLogBetaNegBinomial_v_64;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_65> AgradCdfLogBetaNegBinomial_v_65;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_66> AgradCdfLogBetaNegBinomial_v_66;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_67> AgradCdfLogBetaNegBinomial_v_67;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_68> AgradCdfLogBetaNegBinomial_v_68;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_69> AgradCdfLogBetaNegBinomial_v_69;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_70> AgradCdfLogBetaNegBinomial_v_70;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_71> AgradCdfLogBetaNegBinomial_v_71;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_72> AgradCdfLogBetaNegBinomial_v_72;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_73> AgradCdfLogBetaNegBinomial_v_73;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_74> AgradCdfLogBetaNegBinomial_v_74;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_75> AgradCdfLogBetaNegBinomial_v_75;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_76> AgradCdfLogBetaNegBinomial_v_76;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_77> AgradCdfLogBetaNegBinomial_v_77;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_78> AgradCdfLogBetaNegBinomial_v_78;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_79> AgradCdfLogBetaNegBinomial_v_79;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_80> AgradCdfLogBetaNegBinomial_v_80;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_81> AgradCdfLogBetaNegBinomial_v_81;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_82> AgradCdfLogBetaNegBinomial_v_82;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_83> AgradCdfLogBetaNegBinomial_v_83;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_84> AgradCdfLogBetaNegBinomial_v_84;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_85> AgradCdfLogBetaNegBinomial_v_85;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_86> AgradCdfLogBetaNegBinomial_v_86;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_87> AgradCdfLogBetaNegBinomial_v_87;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_88> AgradCdfLogBetaNegBinomial_v_88;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_89> AgradCdfLogBetaNegBinomial_v_89;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_90> AgradCdfLogBetaNegBinomial_v_90;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_91> AgradCdfLogBetaNegBinomial_v_91;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_92> AgradCdfLogBetaNegBinomial_v_92;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_93> AgradCdfLogBetaNegBinomial_v_93;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_94> AgradCdfLogBetaNegBinomial_v_94;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_95> AgradCdfLogBetaNegBinomial_v_95;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_96> AgradCdfLogBetaNegBinomial_v_96;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_97> AgradCdfLogBetaNegBinomial_v_97;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_98> AgradCdfLogBetaNegBinomial_v_98;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_99> AgradCdfLogBetaNegBinomial_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_0, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_1, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_2, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_3, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_4, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_5, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_6, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_7, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_8, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_9, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_10, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_11, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_12, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_13, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_14, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_15, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_16, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_17, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_18, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_19, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_20, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_21, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_22, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_23, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_24, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_25, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_26, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_27, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_28, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_29, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_30, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_31, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_32, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_33, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_34, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_35, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_36, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_37, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_38, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_39, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_40, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_41, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_42, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_43, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_44, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_45, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_46, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_47, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_48, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_49, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_50, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_51, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_52, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_53, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_54, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_55, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_56, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_57, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_58, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_59, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_60, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_61, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_62, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_63, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_64, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_65, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_66, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_67, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_68, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_69, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_70, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_71, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_72, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_73, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_74, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_75, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_76, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_77, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_78, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_79, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_80, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_81, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_82, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_83, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_84, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_85, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_86, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_87, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_88, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_89, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_90, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_91, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_92, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_93, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_94, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_95, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_96, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_97, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_98, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_99, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<int, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<int, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<int, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<int, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<int, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<int, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<int, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<int, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<int, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<int, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<int, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<int, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<int, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<int, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<int, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<int, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<int, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<int, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<int, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<int, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<int, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<int, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<int, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<int, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<int, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<int, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<int, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<int, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<int, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<int, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<int, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<int, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<int, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<int, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<int, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<int, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<int, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<int, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<int, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_0> AgradCdfLogBetaNegBinomial_vv_0;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_1> AgradCdfLogBetaNegBinomial_vv_1;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_2> AgradCdfLogBetaNegBinomial_vv_2;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_3> AgradCdfLogBetaNegBinomial_vv_3;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_4> AgradCdfLogBetaNegBinomial_vv_4;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_5> AgradCdfLogBetaNegBinomial_vv_5;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_6> AgradCdfLogBetaNegBinomial_vv_6;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_7> AgradCdfLogBetaNegBinomial_vv_7;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_8> AgradCdfLogBetaNegBinomial_vv_8;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_9> AgradCdfLogBetaNegBinomial_vv_9;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_10> AgradCdfLogBetaNegBinomial_vv_10;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_11> AgradCdfLogBetaNegBinomial_vv_11;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_12> AgradCdfLogBetaNegBinomial_vv_12;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_13> AgradCdfLogBetaNegBinomial_vv_13;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_14> AgradCdfLogBetaNegBinomial_vv_14;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_15> AgradCdfLogBetaNegBinomial_vv_15;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_16> AgradCdfLogBetaNegBinomial_vv_16;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_17> AgradCdfLogBetaNegBinomial_vv_17;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_18> AgradCdfLogBetaNegBinomial_vv_18;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_19> AgradCdfLogBetaNegBinomial_vv_19;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_20> AgradCdfLogBetaNegBinomial_vv_20;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_21> AgradCdfLogBetaNegBinomial_vv_21;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_22> AgradCdfLogBetaNegBinomial_vv_22;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_23> AgradCdfLogBetaNegBinomial_vv_23;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_24> AgradCdfLogBetaNegBinomial_vv_24;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_25> AgradCdfLogBetaNegBinomial_vv_25;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_26> AgradCdfLogBetaNegBinomial_vv_26;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_27> AgradCdfLogBetaNegBinomial_vv_27;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_28> AgradCdfLogBetaNegBinomial_vv_28;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_29> AgradCdfLogBetaNegBinomial_vv_29;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_30> AgradCdfLogBetaNegBinomial_vv_30;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_31> AgradCdfLogBetaNegBinomial_vv_31;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_32> AgradCdfLogBetaNegBinomial_vv_32;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_33> AgradCdfLogBetaNegBinomial_vv_33;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_34> AgradCdfLogBetaNegBinomial_vv_34;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_35> AgradCdfLogBetaNegBinomial_vv_35;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_36> AgradCdfLogBetaNegBinomial_vv_36;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_37> AgradCdfLogBetaNegBinomial_vv_37;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_38> AgradCdfLogBetaNegBinomial_vv_38;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_39> AgradCdfLogBetaNegBinomial_vv_39;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_40> AgradCdfLogBetaNegBinomial_vv_40;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_41> AgradCdfLogBetaNegBinomial_vv_41;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_42> AgradCdfLogBetaNegBinomial_vv_42;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_43> AgradCdfLogBetaNegBinomial_vv_43;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_44> AgradCdfLogBetaNegBinomial_vv_44;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_45> AgradCdfLogBetaNegBinomial_vv_45;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_46> AgradCdfLogBetaNegBinomial_vv_46;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_47> AgradCdfLogBetaNegBinomial_vv_47;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_48> AgradCdfLogBetaNegBinomial_vv_48;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_49> AgradCdfLogBetaNegBinomial_vv_49;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_50> AgradCdfLogBetaNegBinomial_vv_50;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_51> AgradCdfLogBetaNegBinomial_vv_51;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_52> AgradCdfLogBetaNegBinomial_vv_52;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_53> AgradCdfLogBetaNegBinomial_vv_53;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_54> AgradCdfLogBetaNegBinomial_vv_54;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_55> AgradCdfLogBetaNegBinomial_vv_55;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_56> AgradCdfLogBetaNegBinomial_vv_56;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_57> AgradCdfLogBetaNegBinomial_vv_57;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_58> AgradCdfLogBetaNegBinomial_vv_58;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_59> AgradCdfLogBetaNegBinomial_vv_59;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_60> AgradCdfLogBetaNegBinomial_vv_60;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_61> AgradCdfLogBetaNegBinomial_vv_61;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_62> AgradCdfLogBetaNegBinomial_vv_62;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_63> AgradCdfLogBetaNegBinomial_vv_63;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_64> AgradCdfLogBetaNegBinomial_vv_64;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_65> AgradCdfLogBetaNegBinomial_vv_65;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_66> AgradCdfLogBetaNegBinomial_vv_66;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_67> AgradCdfLogBetaNegBinomial_vv_67;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_68> AgradCdfLogBetaNegBinomial_vv_68;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_69> AgradCdfLogBetaNegBinomial_vv_69;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_70> AgradCdfLogBetaNegBinomial_vv_70;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_71> AgradCdfLogBetaNegBinomial_vv_71;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_72> AgradCdfLogBetaNegBinomial_vv_72;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_73> AgradCdfLogBetaNegBinomial_vv_73;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_74> AgradCdfLogBetaNegBinomial_vv_74;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_75> AgradCdfLogBetaNegBinomial_vv_75;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_76> AgradCdfLogBetaNegBinomial_vv_76;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_77> AgradCdfLogBetaNegBinomial_vv_77;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_78> AgradCdfLogBetaNegBinomial_vv_78;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_79> AgradCdfLogBetaNegBinomial_vv_79;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_80> AgradCdfLogBetaNegBinomial_vv_80;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_81> AgradCdfLogBetaNegBinomial_vv_81;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_82> AgradCdfLogBetaNegBinomial_vv_82;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_83> AgradCdfLogBetaNegBinomial_vv_83;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_84> AgradCdfLogBetaNegBinomial_vv_84;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_85> AgradCdfLogBetaNegBinomial_vv_85;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_86> AgradCdfLogBetaNegBinomial_vv_86;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_87> AgradCdfLogBetaNegBinomial_vv_87;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_88> AgradCdfLogBetaNegBinomial_vv_88;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_89> AgradCdfLogBetaNegBinomial_vv_89;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_90> AgradCdfLogBetaNegBinomial_vv_90;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_91> AgradCdfLogBetaNegBinomial_vv_91;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_92> AgradCdfLogBetaNegBinomial_vv_92;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_93> AgradCdfLogBetaNegBinomial_vv_93;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_94> AgradCdfLogBetaNegBinomial_vv_94;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_95> AgradCdfLogBetaNegBinomial_vv_95;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_96> AgradCdfLogBetaNegBinomial_vv_96;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_97> AgradCdfLogBetaNegBinomial_vv_97;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_98> AgradCdfLogBetaNegBinomial_vv_98;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_99> AgradCdfLogBetaNegBinomial_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_0, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_1, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_2, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_3, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_4, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_5, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_6, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_7, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_8, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_9, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_10, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_11, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_12, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_13, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_14, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_15, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_16, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_17, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_18, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_19, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_20, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_21, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_22, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_23, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_24, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_25, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_26, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_27, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_28, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_29, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_30, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_31, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_32, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_33, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_34, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_35, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_36, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_37, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_38, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_39, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_40, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_41, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_42, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_43, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_44, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_45, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_46, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_47, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_48, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_49, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_50, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_51, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_52, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_53, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_54, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_55, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_56, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_57, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_58, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_59, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_60, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_61, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_62, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_63, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_64, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_65, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_66, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_67, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_68, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_69, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_70, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_71, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_72, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_73, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_74, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_75, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_76, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_77, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_78, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_79, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_80, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_81, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_82, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_83, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_84, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_85, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_86, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_87, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_88, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_89, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_90, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_91, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_92, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_93, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_94, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_95, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_96, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_97, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_98, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_99, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_99);
+
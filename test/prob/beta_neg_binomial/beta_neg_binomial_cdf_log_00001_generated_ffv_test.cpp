@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<int>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<int>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<int>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_100> AgradCdfLogBetaNegBinomial_ffv_100;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_101> AgradCdfLogBetaNegBinomial_ffv_101;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_102> AgradCdfLogBetaNegBinomial_ffv_102;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_103> AgradCdfLogBetaNegBinomial_ffv_103;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_104> AgradCdfLogBetaNegBinomial_ffv_104;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_105> AgradCdfLogBetaNegBinomial_ffv_105;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_106> AgradCdfLogBetaNegBinomial_ffv_106;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_107> AgradCdfLogBetaNegBinomial_ffv_107;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_108> AgradCdfLogBetaNegBinomial_ffv_108;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_109> AgradCdfLogBetaNegBinomial_ffv_109;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_110> AgradCdfLogBetaNegBinomial_ffv_110;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_111> AgradCdfLogBetaNegBinomial_ffv_111;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_112> AgradCdfLogBetaNegBinomial_ffv_112;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_113> AgradCdfLogBetaNegBinomial_ffv_113;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_114> AgradCdfLogBetaNegBinomial_ffv_114;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_115> AgradCdfLogBetaNegBinomial_ffv_115;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_116> AgradCdfLogBetaNegBinomial_ffv_116;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_117> AgradCdfLogBetaNegBinomial_ffv_117;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_118> AgradCdfLogBetaNegBinomial_ffv_118;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_119> AgradCdfLogBetaNegBinomial_ffv_119;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_120> AgradCdfLogBetaNegBinomial_ffv_120;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_121> AgradCdfLogBetaNegBinomial_ffv_121;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_122> AgradCdfLogBetaNegBinomial_ffv_122;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_123> AgradCdfLogBetaNegBinomial_ffv_123;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_124> AgradCdfLogBetaNegBinomial_ffv_124;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_125> AgradCdfLogBetaNegBinomial_ffv_125;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_126> AgradCdfLogBetaNegBinomial_ffv_126;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_127> AgradCdfLogBetaNegBinomial_ffv_127;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_128> AgradCdfLogBetaNegBinomial_ffv_128;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_129> AgradCdfLogBetaNegBinomial_ffv_129;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_130> AgradCdfLogBetaNegBinomial_ffv_130;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_131> AgradCdfLogBetaNegBinomial_ffv_131;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_132> AgradCdfLogBetaNegBinomial_ffv_132;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_133> AgradCdfLogBetaNegBinomial_ffv_133;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_134> AgradCdfLogBetaNegBinomial_ffv_134;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_135> AgradCdfLogBetaNegBinomial_ffv_135;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_136> AgradCdfLogBetaNegBinomial_ffv_136;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_137> AgradCdfLogBetaNegBinomial_ffv_137;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_138> AgradCdfLogBetaNegBinomial_ffv_138;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_139> AgradCdfLogBetaNegBinomial_ffv_139;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_140> AgradCdfLogBetaNegBinomial_ffv_140;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_141> AgradCdfLogBetaNegBinomial_ffv_141;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_142> AgradCdfLogBetaNegBinomial_ffv_142;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_143> AgradCdfLogBetaNegBinomial_ffv_143;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_144> AgradCdfLogBetaNegBinomial_ffv_144;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_145> AgradCdfLogBetaNegBinomial_ffv_145;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_146> AgradCdfLogBetaNegBinomial_ffv_146;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_147> AgradCdfLogBetaNegBinomial_ffv_147;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_148> AgradCdfLogBetaNegBinomial_ffv_148;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_149> AgradCdfLogBetaNegBinomial_ffv_149;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_150> AgradCdfLogBetaNegBinomial_ffv_150;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_151> AgradCdfLogBetaNegBinomial_ffv_151;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_152> AgradCdfLogBetaNegBinomial_ffv_152;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_153> AgradCdfLogBetaNegBinomial_ffv_153;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_154> AgradCdfLogBetaNegBinomial_ffv_154;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_155> AgradCdfLogBetaNegBinomial_ffv_155;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_156> AgradCdfLogBetaNegBinomial_ffv_156;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_157> AgradCdfLogBetaNegBinomial_ffv_157;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_158> AgradCdfLogBetaNegBinomial_ffv_158;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_159> AgradCdfLogBetaNegBinomial_ffv_159;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_160> AgradCdfLogBetaNegBinomial_ffv_160;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_161> AgradCdfLogBetaNegBinomial_ffv_161;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_162> AgradCdfLogBetaNegBinomial_ffv_162;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_163> AgradCdfLogBetaNegBinomial_ffv_163;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_164> AgradCdfLogBetaNegBinomial_ffv_164;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_165> AgradCdfLogBetaNegBinomial_ffv_165;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_166> AgradCdfLogBetaNegBinomial_ffv_166;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_167> AgradCdfLogBetaNegBinomial_ffv_167;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_168> AgradCdfLogBetaNegBinomial_ffv_168;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_169> AgradCdfLogBetaNegBinomial_ffv_169;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_170> AgradCdfLogBetaNegBinomial_ffv_170;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_171> AgradCdfLogBetaNegBinomial_ffv_171;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_172> AgradCdfLogBetaNegBinomial_ffv_172;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_173> AgradCdfLogBetaNegBinomial_ffv_173;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_174> AgradCdfLogBetaNegBinomial_ffv_174;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_175> AgradCdfLogBetaNegBinomial_ffv_175;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_176> AgradCdfLogBetaNegBinomial_ffv_176;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_177> AgradCdfLogBetaNegBinomial_ffv_177;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_178> AgradCdfLogBetaNegBinomial_ffv_178;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_179> AgradCdfLogBetaNegBinomial_ffv_179;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_180> AgradCdfLogBetaNegBinomial_ffv_180;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_181> AgradCdfLogBetaNegBinomial_ffv_181;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_182> AgradCdfLogBetaNegBinomial_ffv_182;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_183> AgradCdfLogBetaNegBinomial_ffv_183;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_184> AgradCdfLogBetaNegBinomial_ffv_184;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_185> AgradCdfLogBetaNegBinomial_ffv_185;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_186> AgradCdfLogBetaNegBinomial_ffv_186;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_187> AgradCdfLogBetaNegBinomial_ffv_187;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_188> AgradCdfLogBetaNegBinomial_ffv_188;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_189> AgradCdfLogBetaNegBinomial_ffv_189;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_190> AgradCdfLogBetaNegBinomial_ffv_190;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_191> AgradCdfLogBetaNegBinomial_ffv_191;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_192> AgradCdfLogBetaNegBinomial_ffv_192;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_193> AgradCdfLogBetaNegBinomial_ffv_193;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_194> AgradCdfLogBetaNegBinomial_ffv_194;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_195> AgradCdfLogBetaNegBinomial_ffv_195;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_196> AgradCdfLogBetaNegBinomial_ffv_196;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_197> AgradCdfLogBetaNegBinomial_ffv_197;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_198> AgradCdfLogBetaNegBinomial_ffv_198;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_199> AgradCdfLogBetaNegBinomial_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_100, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_101, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_102, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_103, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_104, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_105, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_106, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_107, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_108, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_109, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_110, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_111, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_112, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_113, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_114, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_115, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_116, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_117, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_118, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_119, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_120, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_121, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_122, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_123, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_124, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_125, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_126, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_127, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_128, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_129, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_130, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_131, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_132, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_133, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_134, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_135, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_136, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_137, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_138, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_139, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_140, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_141, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_142, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_143, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_144, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_145, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_146, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_147, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_148, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_149, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_150, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_151, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_152, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_153, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_154, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_155, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_156, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_157, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_158, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_159, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_160, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_161, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_162, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_163, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_164, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_165, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_166, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_167, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_168, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_169, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_170, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_171, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_172, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_173, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_174, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_175, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_176, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_177, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_178, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_179, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_180, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_181, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_182, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_183, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_184, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_185, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_186, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_187, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_188, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_189, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_190, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_191, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_192, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_193, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_194, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_195, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_196, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_197, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_198, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_199, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_199);
+
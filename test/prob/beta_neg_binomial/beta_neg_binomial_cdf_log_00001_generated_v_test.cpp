@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<int, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<int, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<int, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<int, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<int, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<int, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<int, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<int, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<int, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<int, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<int, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<int, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<int, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<int, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<int, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<int, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<int, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<int, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<int, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<int, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<int, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<int, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<int, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<int, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<int, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<int, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<int, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<int, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<int, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<int, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<int, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<int, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<int, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<int, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<int, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<int, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_100> AgradCdfLogBetaNegBinomial_v_100;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_101> AgradCdfLogBetaNegBinomial_v_101;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_102> AgradCdfLogBetaNegBinomial_v_102;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_103> AgradCdfLogBetaNegBinomial_v_103;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_104> AgradCdfLogBetaNegBinomial_v_104;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_105> AgradCdfLogBetaNegBinomial_v_105;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_106> AgradCdfLogBetaNegBinomial_v_106;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_107> AgradCdfLogBetaNegBinomial_v_107;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_108> AgradCdfLogBetaNegBinomial_v_108;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_109> AgradCdfLogBetaNegBinomial_v_109;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_110> AgradCdfLogBetaNegBinomial_v_110;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_111> AgradCdfLogBetaNegBinomial_v_111;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_112> AgradCdfLogBetaNegBinomial_v_112;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_113> AgradCdfLogBetaNegBinomial_v_113;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_114> AgradCdfLogBetaNegBinomial_v_114;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_115> AgradCdfLogBetaNegBinomial_v_115;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_116> AgradCdfLogBetaNegBinomial_v_116;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_117> AgradCdfLogBetaNegBinomial_v_117;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_118> AgradCdfLogBetaNegBinomial_v_118;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_119> AgradCdfLogBetaNegBinomial_v_119;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_120> AgradCdfLogBetaNegBinomial_v_120;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_121> AgradCdfLogBetaNegBinomial_v_121;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_122> AgradCdfLogBetaNegBinomial_v_122;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_123> AgradCdfLogBetaNegBinomial_v_123;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_124> AgradCdfLogBetaNegBinomial_v_124;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_125> AgradCdfLogBetaNegBinomial_v_125;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_126> AgradCdfLogBetaNegBinomial_v_126;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_127> AgradCdfLogBetaNegBinomial_v_127;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_128> AgradCdfLogBetaNegBinomial_v_128;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_129> AgradCdfLogBetaNegBinomial_v_129;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_130> AgradCdfLogBetaNegBinomial_v_130;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_131> AgradCdfLogBetaNegBinomial_v_131;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_132> AgradCdfLogBetaNegBinomial_v_132;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_133> AgradCdfLogBetaNegBinomial_v_133;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_134> AgradCdfLogBetaNegBinomial_v_134;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_135> AgradCdfLogBetaNegBinomial_v_135;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_136> AgradCdfLogBetaNegBinomial_v_136;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_137> AgradCdfLogBetaNegBinomial_v_137;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_138> AgradCdfLogBetaNegBinomial_v_138;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_139> AgradCdfLogBetaNegBinomial_v_139;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_140> AgradCdfLogBetaNegBinomial_v_140;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_141> AgradCdfLogBetaNegBinomial_v_141;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_142> AgradCdfLogBetaNegBinomial_v_142;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_143> AgradCdfLogBetaNegBinomial_v_143;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_144> AgradCdfLogBetaNegBinomial_v_144;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_145> AgradCdfLogBetaNegBinomial_v_145;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_146> AgradCdfLogBetaNegBinomial_v_146;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_147> AgradCdfLogBetaNegBinomial_v_147;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_148> AgradCdfLogBetaNegBinomial_v_148;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_149> AgradCdfLogBetaNegBinomial_v_149;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_150> AgradCdfLogBetaNegBinomial_v_150;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_151> AgradCdfLogBetaNegBinomial_v_151;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_152> AgradCdfLogBetaNegBinomial_v_152;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_153> AgradCdfLogBetaNegBinomial_v_153;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_154> AgradCdfLogBetaNegBinomial_v_154;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_155> AgradCdfLogBetaNegBinomial_v_155;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_156> AgradCdfLogBetaNegBinomial_v_156;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_157> AgradCdfLogBetaNegBinomial_v_157;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_158> AgradCdfLogBetaNegBinomial_v_158;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_159> AgradCdfLogBetaNegBinomial_v_159;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_160> AgradCdfLogBetaNegBinomial_v_160;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_161> AgradCdfLogBetaNegBinomial_v_161;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_162> AgradCdfLogBetaNegBinomial_v_162;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_163> AgradCdfLogBetaNegBinomial_v_163;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_164> AgradCdfLogBetaNegBinomial_v_164;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_165> AgradCdfLogBetaNegBinomial_v_165;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_166> AgradCdfLogBetaNegBinomial_v_166;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_167> AgradCdfLogBetaNegBinomial_v_167;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_168> AgradCdfLogBetaNegBinomial_v_168;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_169> AgradCdfLogBetaNegBinomial_v_169;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_170> AgradCdfLogBetaNegBinomial_v_170;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_171> AgradCdfLogBetaNegBinomial_v_171;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_172> AgradCdfLogBetaNegBinomial_v_172;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_173> AgradCdfLogBetaNegBinomial_v_173;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_174> AgradCdfLogBetaNegBinomial_v_174;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_175> AgradCdfLogBetaNegBinomial_v_175;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_176> AgradCdfLogBetaNegBinomial_v_176;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_177> AgradCdfLogBetaNegBinomial_v_177;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_178> AgradCdfLogBetaNegBinomial_v_178;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_179> AgradCdfLogBetaNegBinomial_v_179;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_180> AgradCdfLogBetaNegBinomial_v_180;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_181> AgradCdfLogBetaNegBinomial_v_181;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_182> AgradCdfLogBetaNegBinomial_v_182;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_183> AgradCdfLogBetaNegBinomial_v_183;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_184> AgradCdfLogBetaNegBinomial_v_184;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_185> AgradCdfLogBetaNegBinomial_v_185;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_186> AgradCdfLogBetaNegBinomial_v_186;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_187> AgradCdfLogBetaNegBinomial_v_187;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_188> AgradCdfLogBetaNegBinomial_v_188;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_189> AgradCdfLogBetaNegBinomial_v_189;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_190> AgradCdfLogBetaNegBinomial_v_190;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_191> AgradCdfLogBetaNegBinomial_v_191;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_192> AgradCdfLogBetaNegBinomial_v_192;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_193> AgradCdfLogBetaNegBinomial_v_193;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_194> AgradCdfLogBetaNegBinomial_v_194;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_195> AgradCdfLogBetaNegBinomial_v_195;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_196> AgradCdfLogBetaNegBinomial_v_196;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_197> AgradCdfLogBetaNegBinomial_v_197;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_198> AgradCdfLogBetaNegBinomial_v_198;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_199> AgradCdfLogBetaNegBinomial_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_100, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_101, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_102, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_103, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_104, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_105, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_106, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_107, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_108, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_109, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_110, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_111, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_112, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_113, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_114, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_115, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_116, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_117, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_118, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_119, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_120, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_121, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_122, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_123, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_124, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_125, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_126, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_127, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_128, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_129, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_130, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_131, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_132, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_133, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_134, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_135, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_136, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_137, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_138, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_139, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_140, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_141, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_142, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_143, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_144, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_145, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_146, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_147, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_148, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_149, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_150, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_151, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_152, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_153, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_154, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_155, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_156, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_157, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_158, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_159, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_160, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_161, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_162, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_163, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_164, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_165, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_166, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_167, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_168, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_169, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_170, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_171, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_172, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_173, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_174, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_175, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_176, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_177, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_178, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_179, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_180, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_181, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_182, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_183, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_184, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_185, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_186, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_187, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_188, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_189, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_190, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_191, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_192, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_193, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_194, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_195, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_196, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_197, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_198, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_199, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<int, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<int, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<int, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<int, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<int, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<int, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<int, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<int, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<int, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<int, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<int, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<int, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<int, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<int, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<int, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<int, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<int, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<int, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<int, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<int, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<int, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<int, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<int>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<int>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<int>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<int>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<int>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_100> AgradCdfLogBetaNegBinomial_vv_100;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_101> AgradCdfLogBetaNegBinomial_vv_101;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_102> AgradCdfLogBetaNegBinomial_vv_102;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_103> AgradCdfLogBetaNegBinomial_vv_103;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_104> AgradCdfLogBetaNegBinomial_vv_104;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_105> AgradCdfLogBetaNegBinomial_vv_105;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_106> AgradCdfLogBetaNegBinomial_vv_106;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_107> AgradCdfLogBetaNegBinomial_vv_107;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_108> AgradCdfLogBetaNegBinomial_vv_108;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_109> AgradCdfLogBetaNegBinomial_vv_109;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_110> AgradCdfLogBetaNegBinomial_vv_110;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_111> AgradCdfLogBetaNegBinomial_vv_111;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_112> AgradCdfLogBetaNegBinomial_vv_112;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_113> AgradCdfLogBetaNegBinomial_vv_113;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_114> AgradCdfLogBetaNegBinomial_vv_114;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_115> AgradCdfLogBetaNegBinomial_vv_115;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_116> AgradCdfLogBetaNegBinomial_vv_116;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_117> AgradCdfLogBetaNegBinomial_vv_117;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_118> AgradCdfLogBetaNegBinomial_vv_118;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_119> AgradCdfLogBetaNegBinomial_vv_119;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_120> AgradCdfLogBetaNegBinomial_vv_120;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_121> AgradCdfLogBetaNegBinomial_vv_121;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_122> AgradCdfLogBetaNegBinomial_vv_122;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_123> AgradCdfLogBetaNegBinomial_vv_123;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_124> AgradCdfLogBetaNegBinomial_vv_124;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_125> AgradCdfLogBetaNegBinomial_vv_125;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_126> AgradCdfLogBetaNegBinomial_vv_126;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_127> AgradCdfLogBetaNegBinomial_vv_127;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_128> AgradCdfLogBetaNegBinomial_vv_128;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_129> AgradCdfLogBetaNegBinomial_vv_129;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_130> AgradCdfLogBetaNegBinomial_vv_130;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_131> AgradCdfLogBetaNegBinomial_vv_131;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_132> AgradCdfLogBetaNegBinomial_vv_132;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_133> AgradCdfLogBetaNegBinomial_vv_133;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_134> AgradCdfLogBetaNegBinomial_vv_134;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_135> AgradCdfLogBetaNegBinomial_vv_135;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_136> AgradCdfLogBetaNegBinomial_vv_136;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_137> AgradCdfLogBetaNegBinomial_vv_137;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_138> AgradCdfLogBetaNegBinomial_vv_138;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_139> AgradCdfLogBetaNegBinomial_vv_139;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_140> AgradCdfLogBetaNegBinomial_vv_140;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_141> AgradCdfLogBetaNegBinomial_vv_141;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_142> AgradCdfLogBetaNegBinomial_vv_142;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_143> AgradCdfLogBetaNegBinomial_vv_143;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_144> AgradCdfLogBetaNegBinomial_vv_144;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_145> AgradCdfLogBetaNegBinomial_vv_145;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_146> AgradCdfLogBetaNegBinomial_vv_146;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_147> AgradCdfLogBetaNegBinomial_vv_147;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_148> AgradCdfLogBetaNegBinomial_vv_148;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_149> AgradCdfLogBetaNegBinomial_vv_149;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_150> AgradCdfLogBetaNegBinomial_vv_150;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_151> AgradCdfLogBetaNegBinomial_vv_151;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_152> AgradCdfLogBetaNegBinomial_vv_152;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_153> AgradCdfLogBetaNegBinomial_vv_153;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_154> AgradCdfLogBetaNegBinomial_vv_154;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_155> AgradCdfLogBetaNegBinomial_vv_155;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_156> AgradCdfLogBetaNegBinomial_vv_156;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_157> AgradCdfLogBetaNegBinomial_vv_157;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_158> AgradCdfLogBetaNegBinomial_vv_158;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_159> AgradCdfLogBetaNegBinomial_vv_159;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_160> AgradCdfLogBetaNegBinomial_vv_160;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_161> AgradCdfLogBetaNegBinomial_vv_161;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_162> AgradCdfLogBetaNegBinomial_vv_162;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_163> AgradCdfLogBetaNegBinomial_vv_163;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_164> AgradCdfLogBetaNegBinomial_vv_164;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_165> AgradCdfLogBetaNegBinomial_vv_165;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_166> AgradCdfLogBetaNegBinomial_vv_166;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_167> AgradCdfLogBetaNegBinomial_vv_167;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_168> AgradCdfLogBetaNegBinomial_vv_168;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_169> AgradCdfLogBetaNegBinomial_vv_169;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_170> AgradCdfLogBetaNegBinomial_vv_170;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_171> AgradCdfLogBetaNegBinomial_vv_171;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_172> AgradCdfLogBetaNegBinomial_vv_172;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_173> AgradCdfLogBetaNegBinomial_vv_173;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_174> AgradCdfLogBetaNegBinomial_vv_174;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_175> AgradCdfLogBetaNegBinomial_vv_175;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_176> AgradCdfLogBetaNegBinomial_vv_176;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_177> AgradCdfLogBetaNegBinomial_vv_177;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_178> AgradCdfLogBetaNegBinomial_vv_178;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_179> AgradCdfLogBetaNegBinomial_vv_179;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_180> AgradCdfLogBetaNegBinomial_vv_180;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_181> AgradCdfLogBetaNegBinomial_vv_181;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_182> AgradCdfLogBetaNegBinomial_vv_182;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_183> AgradCdfLogBetaNegBinomial_vv_183;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_184> AgradCdfLogBetaNegBinomial_vv_184;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_185> AgradCdfLogBetaNegBinomial_vv_185;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_186> AgradCdfLogBetaNegBinomial_vv_186;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_187> AgradCdfLogBetaNegBinomial_vv_187;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_188> AgradCdfLogBetaNegBinomial_vv_188;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_189> AgradCdfLogBetaNegBinomial_vv_189;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_190> AgradCdfLogBetaNegBinomial_vv_190;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_191> AgradCdfLogBetaNegBinomial_vv_191;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_192> AgradCdfLogBetaNegBinomial_vv_192;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_193> AgradCdfLogBetaNegBinomial_vv_193;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_194> AgradCdfLogBetaNegBinomial_vv_194;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_195> AgradCdfLogBetaNegBinomial_vv_195;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_196> AgradCdfLogBetaNegBinomial_vv_196;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_197> AgradCdfLogBetaNegBinomial_vv_197;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_198> AgradCdfLogBetaNegBinomial_vv_198;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_199> AgradCdfLogBetaNegBinomial_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_100, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_101, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_102, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_103, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_104, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_105, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_106, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_107, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_108, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_109, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_110, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_111, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_112, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_113, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_114, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_115, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_116, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_117, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_118, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_119, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_120, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_121, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_122, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_123, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_124, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_125, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_126, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_127, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_128, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_129, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_130, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_131, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_132, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_133, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_134, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_135, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_136, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_137, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_138, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_139, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_140, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_141, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_142, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_143, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_144, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_145, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_146, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_147, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_148, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_149, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_150, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_151, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_152, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_153, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_154, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_155, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_156, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_157, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_158, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_159, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_160, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_161, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_162, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_163, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_164, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_165, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_166, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_167, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_168, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_169, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_170, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_171, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_172, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_173, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_174, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_175, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_176, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_177, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_178, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_179, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_180, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_181, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_182, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_183, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_184, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_185, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_186, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_187, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_188, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_189, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_190, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_191, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_192, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_193, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_194, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_195, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_196, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_197, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_198, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_199, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_199);
+
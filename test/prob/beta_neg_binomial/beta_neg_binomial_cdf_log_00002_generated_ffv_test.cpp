@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_200> AgradCdfLogBetaNegBinomial_ffv_200;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_201> AgradCdfLogBetaNegBinomial_ffv_201;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_202> AgradCdfLogBetaNegBinomial_ffv_202;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_203> AgradCdfLogBetaNegBinomial_ffv_203;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_204> AgradCdfLogBetaNegBinomial_ffv_204;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_205> AgradCdfLogBetaNegBinomial_ffv_205;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_206> AgradCdfLogBetaNegBinomial_ffv_206;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_207> AgradCdfLogBetaNegBinomial_ffv_207;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_208> AgradCdfLogBetaNegBinomial_ffv_208;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_209> AgradCdfLogBetaNegBinomial_ffv_209;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_210> AgradCdfLogBetaNegBinomial_ffv_210;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_211> AgradCdfLogBetaNegBinomial_ffv_211;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_212> AgradCdfLogBetaNegBinomial_ffv_212;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_213> AgradCdfLogBetaNegBinomial_ffv_213;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_214> AgradCdfLogBetaNegBinomial_ffv_214;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_215> AgradCdfLogBetaNegBinomial_ffv_215;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_216> AgradCdfLogBetaNegBinomial_ffv_216;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_217> AgradCdfLogBetaNegBinomial_ffv_217;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_218> AgradCdfLogBetaNegBinomial_ffv_218;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_219> AgradCdfLogBetaNegBinomial_ffv_219;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_220> AgradCdfLogBetaNegBinomial_ffv_220;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_221> AgradCdfLogBetaNegBinomial_ffv_221;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_222> AgradCdfLogBetaNegBinomial_ffv_222;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_223> AgradCdfLogBetaNegBinomial_ffv_223;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_224> AgradCdfLogBetaNegBinomial_ffv_224;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_225> AgradCdfLogBetaNegBinomial_ffv_225;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_226> AgradCdfLogBetaNegBinomial_ffv_226;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_227> AgradCdfLogBetaNegBinomial_ffv_227;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_228> AgradCdfLogBetaNegBinomial_ffv_228;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_229> AgradCdfLogBetaNegBinomial_ffv_229;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_230> AgradCdfLogBetaNegBinomial_ffv_230;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_231> AgradCdfLogBetaNegBinomial_ffv_231;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_232> AgradCdfLogBetaNegBinomial_ffv_232;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_233> AgradCdfLogBetaNegBinomial_ffv_233;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_234> AgradCdfLogBetaNegBinomial_ffv_234;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_235> AgradCdfLogBetaNegBinomial_ffv_235;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_236> AgradCdfLogBetaNegBinomial_ffv_236;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_237> AgradCdfLogBetaNegBinomial_ffv_237;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_238> AgradCdfLogBetaNegBinomial_ffv_238;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_239> AgradCdfLogBetaNegBinomial_ffv_239;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_240> AgradCdfLogBetaNegBinomial_ffv_240;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_241> AgradCdfLogBetaNegBinomial_ffv_241;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_242> AgradCdfLogBetaNegBinomial_ffv_242;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_243> AgradCdfLogBetaNegBinomial_ffv_243;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_244> AgradCdfLogBetaNegBinomial_ffv_244;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_245> AgradCdfLogBetaNegBinomial_ffv_245;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_246> AgradCdfLogBetaNegBinomial_ffv_246;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_247> AgradCdfLogBetaNegBinomial_ffv_247;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_248> AgradCdfLogBetaNegBinomial_ffv_248;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_249> AgradCdfLogBetaNegBinomial_ffv_249;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_250> AgradCdfLogBetaNegBinomial_ffv_250;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_251> AgradCdfLogBetaNegBinomial_ffv_251;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_252> AgradCdfLogBetaNegBinomial_ffv_252;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_253> AgradCdfLogBetaNegBinomial_ffv_253;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_254> AgradCdfLogBetaNegBinomial_ffv_254;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_255> AgradCdfLogBetaNegBinomial_ffv_255;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_256> AgradCdfLogBetaNegBinomial_ffv_256;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_257> AgradCdfLogBetaNegBinomial_ffv_257;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_258> AgradCdfLogBetaNegBinomial_ffv_258;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_259> AgradCdfLogBetaNegBinomial_ffv_259;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_260> AgradCdfLogBetaNegBinomial_ffv_260;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_261> AgradCdfLogBetaNegBinomial_ffv_261;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_262> AgradCdfLogBetaNegBinomial_ffv_262;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_263> AgradCdfLogBetaNegBinomial_ffv_263;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_264> AgradCdfLogBetaNegBinomial_ffv_264;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_265> AgradCdfLogBetaNegBinomial_ffv_265;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_266> AgradCdfLogBetaNegBinomial_ffv_266;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_267> AgradCdfLogBetaNegBinomial_ffv_267;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_268> AgradCdfLogBetaNegBinomial_ffv_268;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_269> AgradCdfLogBetaNegBinomial_ffv_269;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_270> AgradCdfLogBetaNegBinomial_ffv_270;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_271> AgradCdfLogBetaNegBinomial_ffv_271;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_272> AgradCdfLogBetaNegBinomial_ffv_272;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_273> AgradCdfLogBetaNegBinomial_ffv_273;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_274> AgradCdfLogBetaNegBinomial_ffv_274;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_275> AgradCdfLogBetaNegBinomial_ffv_275;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_276> AgradCdfLogBetaNegBinomial_ffv_276;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_277> AgradCdfLogBetaNegBinomial_ffv_277;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_278> AgradCdfLogBetaNegBinomial_ffv_278;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_279> AgradCdfLogBetaNegBinomial_ffv_279;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_280> AgradCdfLogBetaNegBinomial_ffv_280;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_281> AgradCdfLogBetaNegBinomial_ffv_281;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_282> AgradCdfLogBetaNegBinomial_ffv_282;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_283> AgradCdfLogBetaNegBinomial_ffv_283;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_284> AgradCdfLogBetaNegBinomial_ffv_284;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_285> AgradCdfLogBetaNegBinomial_ffv_285;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_286> AgradCdfLogBetaNegBinomial_ffv_286;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_287> AgradCdfLogBetaNegBinomial_ffv_287;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_288> AgradCdfLogBetaNegBinomial_ffv_288;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_289> AgradCdfLogBetaNegBinomial_ffv_289;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_290> AgradCdfLogBetaNegBinomial_ffv_290;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_291> AgradCdfLogBetaNegBinomial_ffv_291;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_292> AgradCdfLogBetaNegBinomial_ffv_292;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_293> AgradCdfLogBetaNegBinomial_ffv_293;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_294> AgradCdfLogBetaNegBinomial_ffv_294;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_295> AgradCdfLogBetaNegBinomial_ffv_295;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_296> AgradCdfLogBetaNegBinomial_ffv_296;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_297> AgradCdfLogBetaNegBinomial_ffv_297;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_298> AgradCdfLogBetaNegBinomial_ffv_298;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_299> AgradCdfLogBetaNegBinomial_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_200, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_201, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_202, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_203, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_204, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_205, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_206, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_207, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_208, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_209, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_210, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_211, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_212, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_213, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_214, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_215, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_216, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_217, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_218, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_219, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_220, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_221, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_222, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_223, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_224, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_225, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_226, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_227, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_228, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_229, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_230, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_231, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_232, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_233, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_234, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_235, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_236, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_237, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_238, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_239, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_240, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_241, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_242, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_243, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_244, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_245, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_246, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_247, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_248, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_249, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_250, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_251, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_252, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_253, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_254, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_255, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_256, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_257, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_258, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_259, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_260, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_261, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_262, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_263, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_264, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_265, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_266, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_267, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_268, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_269, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_270, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_271, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_272, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_273, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_274, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_275, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_276, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_277, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_278, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_279, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_280, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_281, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_282, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_283, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_284, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_285, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_286, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_287, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_288, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_289, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_290, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_291, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_292, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_293, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_294, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_295, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_296, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_297, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_298, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_299, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<int>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<int>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<int>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<int>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<int>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<int>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<int>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<int>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<int>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<int>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<int>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<int>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_200> AgradCdfLogBetaNegBinomial_v_200;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_201> AgradCdfLogBetaNegBinomial_v_201;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_202> AgradCdfLogBetaNegBinomial_v_202;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_203> AgradCdfLogBetaNegBinomial_v_203;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_204> AgradCdfLogBetaNegBinomial_v_204;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_205> AgradCdfLogBetaNegBinomial_v_205;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_206> AgradCdfLogBetaNegBinomial_v_206;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_207> AgradCdfLogBetaNegBinomial_v_207;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_208> AgradCdfLogBetaNegBinomial_v_208;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_209> AgradCdfLogBetaNegBinomial_v_209;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_210> AgradCdfLogBetaNegBinomial_v_210;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_211> AgradCdfLogBetaNegBinomial_v_211;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_212> AgradCdfLogBetaNegBinomial_v_212;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_213> AgradCdfLogBetaNegBinomial_v_213;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_214> AgradCdfLogBetaNegBinomial_v_214;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_215> AgradCdfLogBetaNegBinomial_v_215;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_216> AgradCdfLogBetaNegBinomial_v_216;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_217> AgradCdfLogBetaNegBinomial_v_217;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_218> AgradCdfLogBetaNegBinomial_v_218;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_219> AgradCdfLogBetaNegBinomial_v_219;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_220> AgradCdfLogBetaNegBinomial_v_220;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_221> AgradCdfLogBetaNegBinomial_v_221;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_222> AgradCdfLogBetaNegBinomial_v_222;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_223> AgradCdfLogBetaNegBinomial_v_223;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_224> AgradCdfLogBetaNegBinomial_v_224;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_225> AgradCdfLogBetaNegBinomial_v_225;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_226> AgradCdfLogBetaNegBinomial_v_226;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_227> AgradCdfLogBetaNegBinomial_v_227;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_228> AgradCdfLogBetaNegBinomial_v_228;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_229> AgradCdfLogBetaNegBinomial_v_229;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_230> AgradCdfLogBetaNegBinomial_v_230;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_231> AgradCdfLogBetaNegBinomial_v_231;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_232> AgradCdfLogBetaNegBinomial_v_232;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_233> AgradCdfLogBetaNegBinomial_v_233;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_234> AgradCdfLogBetaNegBinomial_v_234;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_235> AgradCdfLogBetaNegBinomial_v_235;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_236> AgradCdfLogBetaNegBinomial_v_236;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_237> AgradCdfLogBetaNegBinomial_v_237;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_238> AgradCdfLogBetaNegBinomial_v_238;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_239> AgradCdfLogBetaNegBinomial_v_239;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_240> AgradCdfLogBetaNegBinomial_v_240;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_241> AgradCdfLogBetaNegBinomial_v_241;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_242> AgradCdfLogBetaNegBinomial_v_242;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_243> AgradCdfLogBetaNegBinomial_v_243;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_244> AgradCdfLogBetaNegBinomial_v_244;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_245> AgradCdfLogBetaNegBinomial_v_245;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_246> AgradCdfLogBetaNegBinomial_v_246;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_247> AgradCdfLogBetaNegBinomial_v_247;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_248> AgradCdfLogBetaNegBinomial_v_248;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_249> AgradCdfLogBetaNegBinomial_v_249;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_250> AgradCdfLogBetaNegBinomial_v_250;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_251> AgradCdfLogBetaNegBinomial_v_251;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_252> AgradCdfLogBetaNegBinomial_v_252;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_253> AgradCdfLogBetaNegBinomial_v_253;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_254> AgradCdfLogBetaNegBinomial_v_254;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_255> AgradCdfLogBetaNegBinomial_v_255;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_256> AgradCdfLogBetaNegBinomial_v_256;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_257> AgradCdfLogBetaNegBinomial_v_257;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_258> AgradCdfLogBetaNegBinomial_v_258;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_259> AgradCdfLogBetaNegBinomial_v_259;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_260> AgradCdfLogBetaNegBinomial_v_260;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_261> AgradCdfLogBetaNegBinomial_v_261;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_262> AgradCdfLogBetaNegBinomial_v_262;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_263> AgradCdfLogBetaNegBinomial_v_263;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_264> AgradCdfLogBetaNegBinomial_v_264;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_265> AgradCdfLogBetaNegBinomial_v_265;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_266> AgradCdfLogBetaNegBinomial_v_266;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_267> AgradCdfLogBetaNegBinomial_v_267;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_268> AgradCdfLogBetaNegBinomial_v_268;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_269> AgradCdfLogBetaNegBinomial_v_269;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_270> AgradCdfLogBetaNegBinomial_v_270;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_271> AgradCdfLogBetaNegBinomial_v_271;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_272> AgradCdfLogBetaNegBinomial_v_272;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_273> AgradCdfLogBetaNegBinomial_v_273;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_274> AgradCdfLogBetaNegBinomial_v_274;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_275> AgradCdfLogBetaNegBinomial_v_275;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_276> AgradCdfLogBetaNegBinomial_v_276;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_277> AgradCdfLogBetaNegBinomial_v_277;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_278> AgradCdfLogBetaNegBinomial_v_278;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_279> AgradCdfLogBetaNegBinomial_v_279;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_280> AgradCdfLogBetaNegBinomial_v_280;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_281> AgradCdfLogBetaNegBinomial_v_281;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_282> AgradCdfLogBetaNegBinomial_v_282;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_283> AgradCdfLogBetaNegBinomial_v_283;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_284> AgradCdfLogBetaNegBinomial_v_284;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_285> AgradCdfLogBetaNegBinomial_v_285;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_286> AgradCdfLogBetaNegBinomial_v_286;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_287> AgradCdfLogBetaNegBinomial_v_287;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_288> AgradCdfLogBetaNegBinomial_v_288;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_289> AgradCdfLogBetaNegBinomial_v_289;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_290> AgradCdfLogBetaNegBinomial_v_290;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_291> AgradCdfLogBetaNegBinomial_v_291;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_292> AgradCdfLogBetaNegBinomial_v_292;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_293> AgradCdfLogBetaNegBinomial_v_293;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_294> AgradCdfLogBetaNegBinomial_v_294;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_295> AgradCdfLogBetaNegBinomial_v_295;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_296> AgradCdfLogBetaNegBinomial_v_296;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_297> AgradCdfLogBetaNegBinomial_v_297;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_298> AgradCdfLogBetaNegBinomial_v_298;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_299> AgradCdfLogBetaNegBinomial_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_200, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_201, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_202, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_203, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_204, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_205, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_206, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_207, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_208, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_209, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_210, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_211, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_212, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_213, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_214, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_215, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_216, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_217, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_218, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_219, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_220, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_221, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_222, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_223, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_224, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_225, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_226, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_227, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_228, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_229, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_230, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_231, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_232, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_233, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_234, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_235, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_236, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_237, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_238, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_239, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_240, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_241, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_242, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_243, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_244, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_245, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_246, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_247, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_248, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_249, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_250, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_251, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_252, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_253, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_254, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_255, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_256, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_257, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_258, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_259, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_260, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_261, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_262, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_263, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_264, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_265, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_266, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_267, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_268, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_269, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_270, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_271, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_272, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_273, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_274, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_275, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_276, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_277, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_278, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_279, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_280, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_281, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_282, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_283, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_284, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_285, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_286, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_287, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_288, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_289, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_290, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_291, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_292, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_293, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_294, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_295, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_296, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_297, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_298, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_299, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_299);
+
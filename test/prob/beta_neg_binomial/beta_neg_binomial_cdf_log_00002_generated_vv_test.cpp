@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<int>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<int>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<int>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<int>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<int>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<int>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<int>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<int>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<int>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<int>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<int>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<int>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<int>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<int>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<int>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_200> AgradCdfLogBetaNegBinomial_vv_200;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_201> AgradCdfLogBetaNegBinomial_vv_201;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_202> AgradCdfLogBetaNegBinomial_vv_202;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_203> AgradCdfLogBetaNegBinomial_vv_203;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_204> AgradCdfLogBetaNegBinomial_vv_204;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_205> AgradCdfLogBetaNegBinomial_vv_205;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_206> AgradCdfLogBetaNegBinomial_vv_206;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_207> AgradCdfLogBetaNegBinomial_vv_207;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_208> AgradCdfLogBetaNegBinomial_vv_208;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_209> AgradCdfLogBetaNegBinomial_vv_209;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_210> AgradCdfLogBetaNegBinomial_vv_210;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_211> AgradCdfLogBetaNegBinomial_vv_211;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_212> AgradCdfLogBetaNegBinomial_vv_212;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_213> AgradCdfLogBetaNegBinomial_vv_213;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_214> AgradCdfLogBetaNegBinomial_vv_214;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_215> AgradCdfLogBetaNegBinomial_vv_215;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_216> AgradCdfLogBetaNegBinomial_vv_216;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_217> AgradCdfLogBetaNegBinomial_vv_217;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_218> AgradCdfLogBetaNegBinomial_vv_218;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_219> AgradCdfLogBetaNegBinomial_vv_219;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_220> AgradCdfLogBetaNegBinomial_vv_220;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_221> AgradCdfLogBetaNegBinomial_vv_221;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_222> AgradCdfLogBetaNegBinomial_vv_222;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_223> AgradCdfLogBetaNegBinomial_vv_223;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_224> AgradCdfLogBetaNegBinomial_vv_224;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_225> AgradCdfLogBetaNegBinomial_vv_225;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_226> AgradCdfLogBetaNegBinomial_vv_226;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_227> AgradCdfLogBetaNegBinomial_vv_227;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_228> AgradCdfLogBetaNegBinomial_vv_228;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_229> AgradCdfLogBetaNegBinomial_vv_229;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_230> AgradCdfLogBetaNegBinomial_vv_230;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_231> AgradCdfLogBetaNegBinomial_vv_231;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_232> AgradCdfLogBetaNegBinomial_vv_232;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_233> AgradCdfLogBetaNegBinomial_vv_233;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_234> AgradCdfLogBetaNegBinomial_vv_234;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_235> AgradCdfLogBetaNegBinomial_vv_235;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_236> AgradCdfLogBetaNegBinomial_vv_236;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_237> AgradCdfLogBetaNegBinomial_vv_237;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_238> AgradCdfLogBetaNegBinomial_vv_238;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_239> AgradCdfLogBetaNegBinomial_vv_239;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_240> AgradCdfLogBetaNegBinomial_vv_240;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_241> AgradCdfLogBetaNegBinomial_vv_241;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_242> AgradCdfLogBetaNegBinomial_vv_242;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_243> AgradCdfLogBetaNegBinomial_vv_243;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_244> AgradCdfLogBetaNegBinomial_vv_244;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_245> AgradCdfLogBetaNegBinomial_vv_245;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_246> AgradCdfLogBetaNegBinomial_vv_246;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_247> AgradCdfLogBetaNegBinomial_vv_247;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_248> AgradCdfLogBetaNegBinomial_vv_248;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_249> AgradCdfLogBetaNegBinomial_vv_249;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_250> AgradCdfLogBetaNegBinomial_vv_250;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_251> AgradCdfLogBetaNegBinomial_vv_251;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_252> AgradCdfLogBetaNegBinomial_vv_252;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_253> AgradCdfLogBetaNegBinomial_vv_253;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_254> AgradCdfLogBetaNegBinomial_vv_254;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_255> AgradCdfLogBetaNegBinomial_vv_255;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_256> AgradCdfLogBetaNegBinomial_vv_256;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_257> AgradCdfLogBetaNegBinomial_vv_257;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_258> AgradCdfLogBetaNegBinomial_vv_258;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_259> AgradCdfLogBetaNegBinomial_vv_259;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_260> AgradCdfLogBetaNegBinomial_vv_260;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_261> AgradCdfLogBetaNegBinomial_vv_261;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_262> AgradCdfLogBetaNegBinomial_vv_262;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_263> AgradCdfLogBetaNegBinomial_vv_263;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_264> AgradCdfLogBetaNegBinomial_vv_264;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_265> AgradCdfLogBetaNegBinomial_vv_265;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_266> AgradCdfLogBetaNegBinomial_vv_266;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_267> AgradCdfLogBetaNegBinomial_vv_267;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_268> AgradCdfLogBetaNegBinomial_vv_268;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_269> AgradCdfLogBetaNegBinomial_vv_269;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_270> AgradCdfLogBetaNegBinomial_vv_270;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_271> AgradCdfLogBetaNegBinomial_vv_271;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_272> AgradCdfLogBetaNegBinomial_vv_272;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_273> AgradCdfLogBetaNegBinomial_vv_273;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_274> AgradCdfLogBetaNegBinomial_vv_274;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_275> AgradCdfLogBetaNegBinomial_vv_275;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_276> AgradCdfLogBetaNegBinomial_vv_276;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_277> AgradCdfLogBetaNegBinomial_vv_277;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_278> AgradCdfLogBetaNegBinomial_vv_278;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_279> AgradCdfLogBetaNegBinomial_vv_279;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_280> AgradCdfLogBetaNegBinomial_vv_280;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_281> AgradCdfLogBetaNegBinomial_vv_281;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_282> AgradCdfLogBetaNegBinomial_vv_282;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_283> AgradCdfLogBetaNegBinomial_vv_283;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_284> AgradCdfLogBetaNegBinomial_vv_284;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_285> AgradCdfLogBetaNegBinomial_vv_285;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_286> AgradCdfLogBetaNegBinomial_vv_286;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_287> AgradCdfLogBetaNegBinomial_vv_287;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_288> AgradCdfLogBetaNegBinomial_vv_288;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_289> AgradCdfLogBetaNegBinomial_vv_289;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_290> AgradCdfLogBetaNegBinomial_vv_290;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_291> AgradCdfLogBetaNegBinomial_vv_291;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_292> AgradCdfLogBetaNegBinomial_vv_292;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_293> AgradCdfLogBetaNegBinomial_vv_293;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_294> AgradCdfLogBetaNegBinomial_vv_294;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_295> AgradCdfLogBetaNegBinomial_vv_295;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_296> AgradCdfLogBetaNegBinomial_vv_296;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_297> AgradCdfLogBetaNegBinomial_vv_297;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_298> AgradCdfLogBetaNegBinomial_vv_298;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_299> AgradCdfLogBetaNegBinomial_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_200, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_201, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_202, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_203, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_204, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_205, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_206, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_207, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_208, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_209, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_210, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_211, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_212, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_213, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_214, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_215, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_216, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_217, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_218, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_219, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_220, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_221, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_222, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_223, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_224, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_225, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_226, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_227, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_228, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_229, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_230, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_231, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_232, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_233, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_234, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_235, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_236, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_237, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_238, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_239, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_240, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_241, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_242, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_243, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_244, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_245, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_246, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_247, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_248, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_249, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_250, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_251, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_252, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_253, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_254, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_255, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_256, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_257, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_258, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_259, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_260, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_261, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_262, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_263, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_264, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_265, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_266, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_267, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_268, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_269, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_270, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_271, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_272, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_273, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_274, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_275, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_276, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_277, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_278, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_279, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_280, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_281, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_282, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_283, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_284, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_285, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_286, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_287, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_288, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_289, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_290, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_291, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_292, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_293, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_294, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_295, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_296, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_297, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_298, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_299, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_300> AgradCdfLogBetaNegBinomial_ffv_300;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_301> AgradCdfLogBetaNegBinomial_ffv_301;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_302> AgradCdfLogBetaNegBinomial_ffv_302;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_303> AgradCdfLogBetaNegBinomial_ffv_303;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_304> AgradCdfLogBetaNegBinomial_ffv_304;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_305> AgradCdfLogBetaNegBinomial_ffv_305;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_306> AgradCdfLogBetaNegBinomial_ffv_306;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_307> AgradCdfLogBetaNegBinomial_ffv_307;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_308> AgradCdfLogBetaNegBinomial_ffv_308;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_309> AgradCdfLogBetaNegBinomial_ffv_309;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_310> AgradCdfLogBetaNegBinomial_ffv_310;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_311> AgradCdfLogBetaNegBinomial_ffv_311;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_312> AgradCdfLogBetaNegBinomial_ffv_312;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_313> AgradCdfLogBetaNegBinomial_ffv_313;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_314> AgradCdfLogBetaNegBinomial_ffv_314;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_315> AgradCdfLogBetaNegBinomial_ffv_315;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_316> AgradCdfLogBetaNegBinomial_ffv_316;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_317> AgradCdfLogBetaNegBinomial_ffv_317;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_318> AgradCdfLogBetaNegBinomial_ffv_318;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_319> AgradCdfLogBetaNegBinomial_ffv_319;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_320> AgradCdfLogBetaNegBinomial_ffv_320;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_321> AgradCdfLogBetaNegBinomial_ffv_321;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_322> AgradCdfLogBetaNegBinomial_ffv_322;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_323> AgradCdfLogBetaNegBinomial_ffv_323;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_324> AgradCdfLogBetaNegBinomial_ffv_324;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_325> AgradCdfLogBetaNegBinomial_ffv_325;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_326> AgradCdfLogBetaNegBinomial_ffv_326;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_327> AgradCdfLogBetaNegBinomial_ffv_327;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_328> AgradCdfLogBetaNegBinomial_ffv_328;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_329> AgradCdfLogBetaNegBinomial_ffv_329;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_330> AgradCdfLogBetaNegBinomial_ffv_330;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_331> AgradCdfLogBetaNegBinomial_ffv_331;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_332> AgradCdfLogBetaNegBinomial_ffv_332;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_333> AgradCdfLogBetaNegBinomial_ffv_333;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_334> AgradCdfLogBetaNegBinomial_ffv_334;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_335> AgradCdfLogBetaNegBinomial_ffv_335;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_336> AgradCdfLogBetaNegBinomial_ffv_336;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_337> AgradCdfLogBetaNegBinomial_ffv_337;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_338> AgradCdfLogBetaNegBinomial_ffv_338;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_339> AgradCdfLogBetaNegBinomial_ffv_339;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_340> AgradCdfLogBetaNegBinomial_ffv_340;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_341> AgradCdfLogBetaNegBinomial_ffv_341;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_342> AgradCdfLogBetaNegBinomial_ffv_342;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_343> AgradCdfLogBetaNegBinomial_ffv_343;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_344> AgradCdfLogBetaNegBinomial_ffv_344;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_345> AgradCdfLogBetaNegBinomial_ffv_345;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_346> AgradCdfLogBetaNegBinomial_ffv_346;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_347> AgradCdfLogBetaNegBinomial_ffv_347;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_348> AgradCdfLogBetaNegBinomial_ffv_348;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_349> AgradCdfLogBetaNegBinomial_ffv_349;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_350> AgradCdfLogBetaNegBinomial_ffv_350;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_351> AgradCdfLogBetaNegBinomial_ffv_351;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_352> AgradCdfLogBetaNegBinomial_ffv_352;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_353> AgradCdfLogBetaNegBinomial_ffv_353;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_354> AgradCdfLogBetaNegBinomial_ffv_354;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_355> AgradCdfLogBetaNegBinomial_ffv_355;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_356> AgradCdfLogBetaNegBinomial_ffv_356;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_357> AgradCdfLogBetaNegBinomial_ffv_357;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_358> AgradCdfLogBetaNegBinomial_ffv_358;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_359> AgradCdfLogBetaNegBinomial_ffv_359;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_360> AgradCdfLogBetaNegBinomial_ffv_360;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_361> AgradCdfLogBetaNegBinomial_ffv_361;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_362> AgradCdfLogBetaNegBinomial_ffv_362;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_363> AgradCdfLogBetaNegBinomial_ffv_363;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_364> AgradCdfLogBetaNegBinomial_ffv_364;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_365> AgradCdfLogBetaNegBinomial_ffv_365;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_366> AgradCdfLogBetaNegBinomial_ffv_366;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_367> AgradCdfLogBetaNegBinomial_ffv_367;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_368> AgradCdfLogBetaNegBinomial_ffv_368;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_369> AgradCdfLogBetaNegBinomial_ffv_369;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_370> AgradCdfLogBetaNegBinomial_ffv_370;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_371> AgradCdfLogBetaNegBinomial_ffv_371;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_372> AgradCdfLogBetaNegBinomial_ffv_372;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_373> AgradCdfLogBetaNegBinomial_ffv_373;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_374> AgradCdfLogBetaNegBinomial_ffv_374;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_375> AgradCdfLogBetaNegBinomial_ffv_375;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_376> AgradCdfLogBetaNegBinomial_ffv_376;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_377> AgradCdfLogBetaNegBinomial_ffv_377;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_378> AgradCdfLogBetaNegBinomial_ffv_378;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_379> AgradCdfLogBetaNegBinomial_ffv_379;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_380> AgradCdfLogBetaNegBinomial_ffv_380;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_381> AgradCdfLogBetaNegBinomial_ffv_381;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_382> AgradCdfLogBetaNegBinomial_ffv_382;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_383> AgradCdfLogBetaNegBinomial_ffv_383;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_384> AgradCdfLogBetaNegBinomial_ffv_384;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_385> AgradCdfLogBetaNegBinomial_ffv_385;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_386> AgradCdfLogBetaNegBinomial_ffv_386;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_387> AgradCdfLogBetaNegBinomial_ffv_387;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_388> AgradCdfLogBetaNegBinomial_ffv_388;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_389> AgradCdfLogBetaNegBinomial_ffv_389;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_390> AgradCdfLogBetaNegBinomial_ffv_390;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_391> AgradCdfLogBetaNegBinomial_ffv_391;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_392> AgradCdfLogBetaNegBinomial_ffv_392;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_393> AgradCdfLogBetaNegBinomial_ffv_393;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_394> AgradCdfLogBetaNegBinomial_ffv_394;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_395> AgradCdfLogBetaNegBinomial_ffv_395;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_396> AgradCdfLogBetaNegBinomial_ffv_396;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_397> AgradCdfLogBetaNegBinomial_ffv_397;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_398> AgradCdfLogBetaNegBinomial_ffv_398;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_399> AgradCdfLogBetaNegBinomial_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_300, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_301, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_302, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_303, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_304, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_305, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_306, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_307, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_308, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_309, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_310, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_311, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_312, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_313, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_314, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_315, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_316, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_317, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_318, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_319, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_320, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_321, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_322, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_323, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_324, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_325, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_326, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_327, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_328, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_329, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_330, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_331, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_332, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_333, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_334, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_335, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_336, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_337, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_338, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_339, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_340, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_341, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_342, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_343, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_344, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_345, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_346, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_347, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_348, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_349, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_350, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_351, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_352, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_353, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_354, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_355, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_356, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_357, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_358, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_359, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_360, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_361, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_362, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_363, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_364, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_365, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_366, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_367, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_368, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_369, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_370, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_371, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_372, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_373, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_374, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_375, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_376, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_377, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_378, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_379, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_380, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_381, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_382, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_383, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_384, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_385, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_386, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_387, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_388, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_389, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_390, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_391, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_392, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_393, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_394, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_395, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_396, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_397, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_398, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_399, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<int>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<int>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<int>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<int>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<int>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<int>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<int>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<int>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<int>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<int>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<int>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<int>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_300> AgradCdfLogBetaNegBinomial_v_300;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_301> AgradCdfLogBetaNegBinomial_v_301;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_302> AgradCdfLogBetaNegBinomial_v_302;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_303> AgradCdfLogBetaNegBinomial_v_303;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_304> AgradCdfLogBetaNegBinomial_v_304;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_305> AgradCdfLogBetaNegBinomial_v_305;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_306> AgradCdfLogBetaNegBinomial_v_306;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_307> AgradCdfLogBetaNegBinomial_v_307;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_308> AgradCdfLogBetaNegBinomial_v_308;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_309> AgradCdfLogBetaNegBinomial_v_309;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_310> AgradCdfLogBetaNegBinomial_v_310;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_311> AgradCdfLogBetaNegBinomial_v_311;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_312> AgradCdfLogBetaNegBinomial_v_312;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_313> AgradCdfLogBetaNegBinomial_v_313;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_314> AgradCdfLogBetaNegBinomial_v_314;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_315> AgradCdfLogBetaNegBinomial_v_315;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_316> AgradCdfLogBetaNegBinomial_v_316;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_317> AgradCdfLogBetaNegBinomial_v_317;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_318> AgradCdfLogBetaNegBinomial_v_318;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_319> AgradCdfLogBetaNegBinomial_v_319;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_320> AgradCdfLogBetaNegBinomial_v_320;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_321> AgradCdfLogBetaNegBinomial_v_321;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_322> AgradCdfLogBetaNegBinomial_v_322;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_323> AgradCdfLogBetaNegBinomial_v_323;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_324> AgradCdfLogBetaNegBinomial_v_324;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_325> AgradCdfLogBetaNegBinomial_v_325;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_326> AgradCdfLogBetaNegBinomial_v_326;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_327> AgradCdfLogBetaNegBinomial_v_327;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_328> AgradCdfLogBetaNegBinomial_v_328;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_329> AgradCdfLogBetaNegBinomial_v_329;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_330> AgradCdfLogBetaNegBinomial_v_330;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_331> AgradCdfLogBetaNegBinomial_v_331;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_332> AgradCdfLogBetaNegBinomial_v_332;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_333> AgradCdfLogBetaNegBinomial_v_333;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_334> AgradCdfLogBetaNegBinomial_v_334;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_335> AgradCdfLogBetaNegBinomial_v_335;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_336> AgradCdfLogBetaNegBinomial_v_336;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_337> AgradCdfLogBetaNegBinomial_v_337;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_338> AgradCdfLogBetaNegBinomial_v_338;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_339> AgradCdfLogBetaNegBinomial_v_339;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_340> AgradCdfLogBetaNegBinomial_v_340;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_341> AgradCdfLogBetaNegBinomial_v_341;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_342> AgradCdfLogBetaNegBinomial_v_342;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_343> AgradCdfLogBetaNegBinomial_v_343;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_344> AgradCdfLogBetaNegBinomial_v_344;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_345> AgradCdfLogBetaNegBinomial_v_345;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_346> AgradCdfLogBetaNegBinomial_v_346;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_347> AgradCdfLogBetaNegBinomial_v_347;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_348> AgradCdfLogBetaNegBinomial_v_348;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_349> AgradCdfLogBetaNegBinomial_v_349;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_350> AgradCdfLogBetaNegBinomial_v_350;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_351> AgradCdfLogBetaNegBinomial_v_351;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_352> AgradCdfLogBetaNegBinomial_v_352;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_353> AgradCdfLogBetaNegBinomial_v_353;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_354> AgradCdfLogBetaNegBinomial_v_354;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_355> AgradCdfLogBetaNegBinomial_v_355;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_356> AgradCdfLogBetaNegBinomial_v_356;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_357> AgradCdfLogBetaNegBinomial_v_357;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_358> AgradCdfLogBetaNegBinomial_v_358;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_359> AgradCdfLogBetaNegBinomial_v_359;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_360> AgradCdfLogBetaNegBinomial_v_360;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_361> AgradCdfLogBetaNegBinomial_v_361;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_362> AgradCdfLogBetaNegBinomial_v_362;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_363> AgradCdfLogBetaNegBinomial_v_363;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_364> AgradCdfLogBetaNegBinomial_v_364;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_365> AgradCdfLogBetaNegBinomial_v_365;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_366> AgradCdfLogBetaNegBinomial_v_366;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_367> AgradCdfLogBetaNegBinomial_v_367;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_368> AgradCdfLogBetaNegBinomial_v_368;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_369> AgradCdfLogBetaNegBinomial_v_369;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_370> AgradCdfLogBetaNegBinomial_v_370;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_371> AgradCdfLogBetaNegBinomial_v_371;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_372> AgradCdfLogBetaNegBinomial_v_372;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_373> AgradCdfLogBetaNegBinomial_v_373;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_374> AgradCdfLogBetaNegBinomial_v_374;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_375> AgradCdfLogBetaNegBinomial_v_375;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_376> AgradCdfLogBetaNegBinomial_v_376;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_377> AgradCdfLogBetaNegBinomial_v_377;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_378> AgradCdfLogBetaNegBinomial_v_378;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_379> AgradCdfLogBetaNegBinomial_v_379;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_380> AgradCdfLogBetaNegBinomial_v_380;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_381> AgradCdfLogBetaNegBinomial_v_381;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_382> AgradCdfLogBetaNegBinomial_v_382;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_383> AgradCdfLogBetaNegBinomial_v_383;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_384> AgradCdfLogBetaNegBinomial_v_384;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_385> AgradCdfLogBetaNegBinomial_v_385;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_386> AgradCdfLogBetaNegBinomial_v_386;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_387> AgradCdfLogBetaNegBinomial_v_387;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_388> AgradCdfLogBetaNegBinomial_v_388;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_389> AgradCdfLogBetaNegBinomial_v_389;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_390> AgradCdfLogBetaNegBinomial_v_390;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_391> AgradCdfLogBetaNegBinomial_v_391;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_392> AgradCdfLogBetaNegBinomial_v_392;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_393> AgradCdfLogBetaNegBinomial_v_393;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_394> AgradCdfLogBetaNegBinomial_v_394;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_395> AgradCdfLogBetaNegBinomial_v_395;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_396> AgradCdfLogBetaNegBinomial_v_396;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_397> AgradCdfLogBetaNegBinomial_v_397;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_398> AgradCdfLogBetaNegBinomial_v_398;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_399> AgradCdfLogBetaNegBinomial_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_300, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_301, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_302, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_303, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_304, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_305, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_306, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_307, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_308, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_309, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_310, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_311, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_312, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_313, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_314, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_315, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_316, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_317, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_318, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_319, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_320, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_321, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_322, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_323, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_324, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_325, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_326, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_327, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_328, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_329, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_330, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_331, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_332, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_333, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_334, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_335, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_336, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_337, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_338, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_339, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_340, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_341, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_342, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_343, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_344, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_345, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_346, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_347, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_348, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_349, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_350, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_351, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_352, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_353, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_354, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_355, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_356, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_357, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_358, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_359, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_360, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_361, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_362, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_363, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_364, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_365, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_366, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_367, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_368, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_369, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_370, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_371, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_372, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_373, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_374, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_375, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_376, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_377, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_378, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_379, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_380, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_381, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_382, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_383, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_384, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_385, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_386, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_387, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_388, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_389, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_390, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_391, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_392, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_393, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_394, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_395, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_396, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_397, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_398, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_399, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_300> AgradCdfLogBetaNegBinomial_vv_300;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_301> AgradCdfLogBetaNegBinomial_vv_301;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_302> AgradCdfLogBetaNegBinomial_vv_302;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_303> AgradCdfLogBetaNegBinomial_vv_303;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_304> AgradCdfLogBetaNegBinomial_vv_304;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_305> AgradCdfLogBetaNegBinomial_vv_305;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_306> AgradCdfLogBetaNegBinomial_vv_306;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_307> AgradCdfLogBetaNegBinomial_vv_307;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_308> AgradCdfLogBetaNegBinomial_vv_308;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_309> AgradCdfLogBetaNegBinomial_vv_309;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_310> AgradCdfLogBetaNegBinomial_vv_310;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_311> AgradCdfLogBetaNegBinomial_vv_311;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_312> AgradCdfLogBetaNegBinomial_vv_312;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_313> AgradCdfLogBetaNegBinomial_vv_313;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_314> AgradCdfLogBetaNegBinomial_vv_314;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_315> AgradCdfLogBetaNegBinomial_vv_315;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_316> AgradCdfLogBetaNegBinomial_vv_316;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_317> AgradCdfLogBetaNegBinomial_vv_317;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_318> AgradCdfLogBetaNegBinomial_vv_318;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_319> AgradCdfLogBetaNegBinomial_vv_319;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_320> AgradCdfLogBetaNegBinomial_vv_320;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_321> AgradCdfLogBetaNegBinomial_vv_321;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_322> AgradCdfLogBetaNegBinomial_vv_322;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_323> AgradCdfLogBetaNegBinomial_vv_323;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_324> AgradCdfLogBetaNegBinomial_vv_324;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_325> AgradCdfLogBetaNegBinomial_vv_325;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_326> AgradCdfLogBetaNegBinomial_vv_326;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_327> AgradCdfLogBetaNegBinomial_vv_327;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_328> AgradCdfLogBetaNegBinomial_vv_328;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_329> AgradCdfLogBetaNegBinomial_vv_329;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_330> AgradCdfLogBetaNegBinomial_vv_330;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_331> AgradCdfLogBetaNegBinomial_vv_331;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_332> AgradCdfLogBetaNegBinomial_vv_332;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_333> AgradCdfLogBetaNegBinomial_vv_333;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_334> AgradCdfLogBetaNegBinomial_vv_334;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_335> AgradCdfLogBetaNegBinomial_vv_335;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_336> AgradCdfLogBetaNegBinomial_vv_336;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_337> AgradCdfLogBetaNegBinomial_vv_337;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_338> AgradCdfLogBetaNegBinomial_vv_338;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_339> AgradCdfLogBetaNegBinomial_vv_339;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_340> AgradCdfLogBetaNegBinomial_vv_340;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_341> AgradCdfLogBetaNegBinomial_vv_341;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_342> AgradCdfLogBetaNegBinomial_vv_342;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_343> AgradCdfLogBetaNegBinomial_vv_343;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_344> AgradCdfLogBetaNegBinomial_vv_344;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_345> AgradCdfLogBetaNegBinomial_vv_345;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_346> AgradCdfLogBetaNegBinomial_vv_346;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_347> AgradCdfLogBetaNegBinomial_vv_347;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_348> AgradCdfLogBetaNegBinomial_vv_348;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_349> AgradCdfLogBetaNegBinomial_vv_349;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_350> AgradCdfLogBetaNegBinomial_vv_350;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_351> AgradCdfLogBetaNegBinomial_vv_351;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_352> AgradCdfLogBetaNegBinomial_vv_352;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_353> AgradCdfLogBetaNegBinomial_vv_353;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_354> AgradCdfLogBetaNegBinomial_vv_354;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_355> AgradCdfLogBetaNegBinomial_vv_355;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_356> AgradCdfLogBetaNegBinomial_vv_356;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_357> AgradCdfLogBetaNegBinomial_vv_357;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_358> AgradCdfLogBetaNegBinomial_vv_358;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_359> AgradCdfLogBetaNegBinomial_vv_359;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_360> AgradCdfLogBetaNegBinomial_vv_360;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_361> AgradCdfLogBetaNegBinomial_vv_361;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_362> AgradCdfLogBetaNegBinomial_vv_362;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_363> AgradCdfLogBetaNegBinomial_vv_363;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_364> AgradCdfLogBetaNegBinomial_vv_364;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_365> AgradCdfLogBetaNegBinomial_vv_365;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_366> AgradCdfLogBetaNegBinomial_vv_366;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_367> AgradCdfLogBetaNegBinomial_vv_367;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_368> AgradCdfLogBetaNegBinomial_vv_368;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_369> AgradCdfLogBetaNegBinomial_vv_369;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_370> AgradCdfLogBetaNegBinomial_vv_370;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_371> AgradCdfLogBetaNegBinomial_vv_371;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_372> AgradCdfLogBetaNegBinomial_vv_372;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_373> AgradCdfLogBetaNegBinomial_vv_373;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_374> AgradCdfLogBetaNegBinomial_vv_374;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_375> AgradCdfLogBetaNegBinomial_vv_375;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_376> AgradCdfLogBetaNegBinomial_vv_376;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_377> AgradCdfLogBetaNegBinomial_vv_377;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_378> AgradCdfLogBetaNegBinomial_vv_378;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_379> AgradCdfLogBetaNegBinomial_vv_379;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_380> AgradCdfLogBetaNegBinomial_vv_380;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_381> AgradCdfLogBetaNegBinomial_vv_381;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_382> AgradCdfLogBetaNegBinomial_vv_382;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_383> AgradCdfLogBetaNegBinomial_vv_383;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_384> AgradCdfLogBetaNegBinomial_vv_384;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_385> AgradCdfLogBetaNegBinomial_vv_385;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_386> AgradCdfLogBetaNegBinomial_vv_386;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_387> AgradCdfLogBetaNegBinomial_vv_387;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_388> AgradCdfLogBetaNegBinomial_vv_388;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_389> AgradCdfLogBetaNegBinomial_vv_389;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_390> AgradCdfLogBetaNegBinomial_vv_390;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_391> AgradCdfLogBetaNegBinomial_vv_391;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_392> AgradCdfLogBetaNegBinomial_vv_392;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_393> AgradCdfLogBetaNegBinomial_vv_393;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_394> AgradCdfLogBetaNegBinomial_vv_394;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_395> AgradCdfLogBetaNegBinomial_vv_395;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_396> AgradCdfLogBetaNegBinomial_vv_396;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_397> AgradCdfLogBetaNegBinomial_vv_397;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_398> AgradCdfLogBetaNegBinomial_vv_398;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_399> AgradCdfLogBetaNegBinomial_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_300, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_301, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_302, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_303, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_304, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_305, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_306, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_307, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_308, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_309, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_310, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_311, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_312, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_313, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_314, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_315, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_316, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_317, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_318, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_319, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_320, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_321, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_322, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_323, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_324, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_325, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_326, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_327, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_328, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_329, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_330, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_331, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_332, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_333, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_334, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_335, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_336, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_337, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_338, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_339, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_340, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_341, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_342, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_343, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_344, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_345, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_346, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_347, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_348, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_349, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_350, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_351, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_352, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_353, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_354, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_355, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_356, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_357, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_358, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_359, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_360, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_361, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_362, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_363, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_364, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_365, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_366, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_367, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_368, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_369, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_370, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_371, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_372, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_373, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_374, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_375, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_376, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_377, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_378, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_379, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_380, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_381, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_382, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_383, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_384, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_385, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_386, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_387, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_388, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_389, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_390, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_391, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_392, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_393, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_394, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_395, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_396, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_397, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_398, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_399, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_399);
+
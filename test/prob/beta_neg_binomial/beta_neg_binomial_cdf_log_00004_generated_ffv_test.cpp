@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_400> AgradCdfLogBetaNegBinomial_ffv_400;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_401> AgradCdfLogBetaNegBinomial_ffv_401;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_402> AgradCdfLogBetaNegBinomial_ffv_402;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_403> AgradCdfLogBetaNegBinomial_ffv_403;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_404> AgradCdfLogBetaNegBinomial_ffv_404;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_405> AgradCdfLogBetaNegBinomial_ffv_405;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_406> AgradCdfLogBetaNegBinomial_ffv_406;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_407> AgradCdfLogBetaNegBinomial_ffv_407;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_408> AgradCdfLogBetaNegBinomial_ffv_408;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_409> AgradCdfLogBetaNegBinomial_ffv_409;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_410> AgradCdfLogBetaNegBinomial_ffv_410;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_411> AgradCdfLogBetaNegBinomial_ffv_411;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_412> AgradCdfLogBetaNegBinomial_ffv_412;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_413> AgradCdfLogBetaNegBinomial_ffv_413;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_414> AgradCdfLogBetaNegBinomial_ffv_414;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_415> AgradCdfLogBetaNegBinomial_ffv_415;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_416> AgradCdfLogBetaNegBinomial_ffv_416;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_417> AgradCdfLogBetaNegBinomial_ffv_417;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_418> AgradCdfLogBetaNegBinomial_ffv_418;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_419> AgradCdfLogBetaNegBinomial_ffv_419;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_420> AgradCdfLogBetaNegBinomial_ffv_420;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_421> AgradCdfLogBetaNegBinomial_ffv_421;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_422> AgradCdfLogBetaNegBinomial_ffv_422;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_423> AgradCdfLogBetaNegBinomial_ffv_423;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_424> AgradCdfLogBetaNegBinomial_ffv_424;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_425> AgradCdfLogBetaNegBinomial_ffv_425;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_426> AgradCdfLogBetaNegBinomial_ffv_426;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_427> AgradCdfLogBetaNegBinomial_ffv_427;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_428> AgradCdfLogBetaNegBinomial_ffv_428;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_429> AgradCdfLogBetaNegBinomial_ffv_429;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_430> AgradCdfLogBetaNegBinomial_ffv_430;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_431> AgradCdfLogBetaNegBinomial_ffv_431;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_432> AgradCdfLogBetaNegBinomial_ffv_432;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_433> AgradCdfLogBetaNegBinomial_ffv_433;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_434> AgradCdfLogBetaNegBinomial_ffv_434;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_435> AgradCdfLogBetaNegBinomial_ffv_435;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_436> AgradCdfLogBetaNegBinomial_ffv_436;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_437> AgradCdfLogBetaNegBinomial_ffv_437;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_438> AgradCdfLogBetaNegBinomial_ffv_438;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_439> AgradCdfLogBetaNegBinomial_ffv_439;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_440> AgradCdfLogBetaNegBinomial_ffv_440;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_441> AgradCdfLogBetaNegBinomial_ffv_441;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_442> AgradCdfLogBetaNegBinomial_ffv_442;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_443> AgradCdfLogBetaNegBinomial_ffv_443;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_444> AgradCdfLogBetaNegBinomial_ffv_444;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_445> AgradCdfLogBetaNegBinomial_ffv_445;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_446> AgradCdfLogBetaNegBinomial_ffv_446;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_447> AgradCdfLogBetaNegBinomial_ffv_447;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_448> AgradCdfLogBetaNegBinomial_ffv_448;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_449> AgradCdfLogBetaNegBinomial_ffv_449;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_450> AgradCdfLogBetaNegBinomial_ffv_450;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_451> AgradCdfLogBetaNegBinomial_ffv_451;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_452> AgradCdfLogBetaNegBinomial_ffv_452;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_453> AgradCdfLogBetaNegBinomial_ffv_453;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_454> AgradCdfLogBetaNegBinomial_ffv_454;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_455> AgradCdfLogBetaNegBinomial_ffv_455;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_456> AgradCdfLogBetaNegBinomial_ffv_456;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_457> AgradCdfLogBetaNegBinomial_ffv_457;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_458> AgradCdfLogBetaNegBinomial_ffv_458;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_459> AgradCdfLogBetaNegBinomial_ffv_459;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_460> AgradCdfLogBetaNegBinomial_ffv_460;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_461> AgradCdfLogBetaNegBinomial_ffv_461;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_462> AgradCdfLogBetaNegBinomial_ffv_462;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_463> AgradCdfLogBetaNegBinomial_ffv_463;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_464> AgradCdfLogBetaNegBinomial_ffv_464;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_465> AgradCdfLogBetaNegBinomial_ffv_465;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_466> AgradCdfLogBetaNegBinomial_ffv_466;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_467> AgradCdfLogBetaNegBinomial_ffv_467;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_468> AgradCdfLogBetaNegBinomial_ffv_468;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_469> AgradCdfLogBetaNegBinomial_ffv_469;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_470> AgradCdfLogBetaNegBinomial_ffv_470;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_471> AgradCdfLogBetaNegBinomial_ffv_471;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_472> AgradCdfLogBetaNegBinomial_ffv_472;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_473> AgradCdfLogBetaNegBinomial_ffv_473;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_474> AgradCdfLogBetaNegBinomial_ffv_474;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_475> AgradCdfLogBetaNegBinomial_ffv_475;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_476> AgradCdfLogBetaNegBinomial_ffv_476;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_477> AgradCdfLogBetaNegBinomial_ffv_477;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_478> AgradCdfLogBetaNegBinomial_ffv_478;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_479> AgradCdfLogBetaNegBinomial_ffv_479;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_480> AgradCdfLogBetaNegBinomial_ffv_480;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_481> AgradCdfLogBetaNegBinomial_ffv_481;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_482> AgradCdfLogBetaNegBinomial_ffv_482;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_483> AgradCdfLogBetaNegBinomial_ffv_483;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_484> AgradCdfLogBetaNegBinomial_ffv_484;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_485> AgradCdfLogBetaNegBinomial_ffv_485;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_486> AgradCdfLogBetaNegBinomial_ffv_486;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_487> AgradCdfLogBetaNegBinomial_ffv_487;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_488> AgradCdfLogBetaNegBinomial_ffv_488;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_489> AgradCdfLogBetaNegBinomial_ffv_489;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_490> AgradCdfLogBetaNegBinomial_ffv_490;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_491> AgradCdfLogBetaNegBinomial_ffv_491;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_492> AgradCdfLogBetaNegBinomial_ffv_492;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_493> AgradCdfLogBetaNegBinomial_ffv_493;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_494> AgradCdfLogBetaNegBinomial_ffv_494;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_495> AgradCdfLogBetaNegBinomial_ffv_495;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_496> AgradCdfLogBetaNegBinomial_ffv_496;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_497> AgradCdfLogBetaNegBinomial_ffv_497;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_498> AgradCdfLogBetaNegBinomial_ffv_498;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_499> AgradCdfLogBetaNegBinomial_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_400, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_401, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_402, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_403, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_404, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_405, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_406, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_407, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_408, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_409, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_410, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_411, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_412, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_413, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_414, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_415, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_416, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_417, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_418, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_419, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_420, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_421, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_422, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_423, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_424, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_425, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_426, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_427, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_428, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_429, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_430, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_431, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_432, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_433, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_434, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_435, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_436, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_437, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_438, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_439, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_440, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_441, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_442, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_443, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_444, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_445, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_446, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_447, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_448, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_449, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_450, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_451, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_452, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_453, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_454, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_455, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_456, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_457, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_458, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_459, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_460, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_461, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_462, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_463, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_464, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_465, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_466, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_467, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_468, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_469, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_470, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_471, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_472, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_473, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_474, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_475, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_476, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_477, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_478, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_479, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_480, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_481, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_482, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_483, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_484, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_485, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_486, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_487, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_488, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_489, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_490, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_491, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_492, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_493, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_494, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_495, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_496, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_497, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_498, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_499, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_499);
+
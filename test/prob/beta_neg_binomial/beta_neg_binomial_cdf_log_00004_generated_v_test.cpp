@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_400> AgradCdfLogBetaNegBinomial_v_400;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_401> AgradCdfLogBetaNegBinomial_v_401;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_402> AgradCdfLogBetaNegBinomial_v_402;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_403> AgradCdfLogBetaNegBinomial_v_403;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_404> AgradCdfLogBetaNegBinomial_v_404;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_405> AgradCdfLogBetaNegBinomial_v_405;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_406> AgradCdfLogBetaNegBinomial_v_406;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_407> AgradCdfLogBetaNegBinomial_v_407;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_408> AgradCdfLogBetaNegBinomial_v_408;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_409> AgradCdfLogBetaNegBinomial_v_409;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_410> AgradCdfLogBetaNegBinomial_v_410;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_411> AgradCdfLogBetaNegBinomial_v_411;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_412> AgradCdfLogBetaNegBinomial_v_412;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_413> AgradCdfLogBetaNegBinomial_v_413;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_414> AgradCdfLogBetaNegBinomial_v_414;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_415> AgradCdfLogBetaNegBinomial_v_415;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_416> AgradCdfLogBetaNegBinomial_v_416;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_417> AgradCdfLogBetaNegBinomial_v_417;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_418> AgradCdfLogBetaNegBinomial_v_418;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_419> AgradCdfLogBetaNegBinomial_v_419;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_420> AgradCdfLogBetaNegBinomial_v_420;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_421> AgradCdfLogBetaNegBinomial_v_421;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_422> AgradCdfLogBetaNegBinomial_v_422;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_423> AgradCdfLogBetaNegBinomial_v_423;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_424> AgradCdfLogBetaNegBinomial_v_424;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_425> AgradCdfLogBetaNegBinomial_v_425;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_426> AgradCdfLogBetaNegBinomial_v_426;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_427> AgradCdfLogBetaNegBinomial_v_427;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_428> AgradCdfLogBetaNegBinomial_v_428;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_429> AgradCdfLogBetaNegBinomial_v_429;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_430> AgradCdfLogBetaNegBinomial_v_430;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_431> AgradCdfLogBetaNegBinomial_v_431;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_432> AgradCdfLogBetaNegBinomial_v_432;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_433> AgradCdfLogBetaNegBinomial_v_433;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_434> AgradCdfLogBetaNegBinomial_v_434;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_435> AgradCdfLogBetaNegBinomial_v_435;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_436> AgradCdfLogBetaNegBinomial_v_436;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_437> AgradCdfLogBetaNegBinomial_v_437;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_438> AgradCdfLogBetaNegBinomial_v_438;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_439> AgradCdfLogBetaNegBinomial_v_439;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_440> AgradCdfLogBetaNegBinomial_v_440;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_441> AgradCdfLogBetaNegBinomial_v_441;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_442> AgradCdfLogBetaNegBinomial_v_442;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_443> AgradCdfLogBetaNegBinomial_v_443;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_444> AgradCdfLogBetaNegBinomial_v_444;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_445> AgradCdfLogBetaNegBinomial_v_445;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_446> AgradCdfLogBetaNegBinomial_v_446;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_447> AgradCdfLogBetaNegBinomial_v_447;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_448> AgradCdfLogBetaNegBinomial_v_448;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_449> AgradCdfLogBetaNegBinomial_v_449;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_450> AgradCdfLogBetaNegBinomial_v_450;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_451> AgradCdfLogBetaNegBinomial_v_451;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_452> AgradCdfLogBetaNegBinomial_v_452;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_453> AgradCdfLogBetaNegBinomial_v_453;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_454> AgradCdfLogBetaNegBinomial_v_454;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_455> AgradCdfLogBetaNegBinomial_v_455;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_456> AgradCdfLogBetaNegBinomial_v_456;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_457> AgradCdfLogBetaNegBinomial_v_457;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_458> AgradCdfLogBetaNegBinomial_v_458;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_459> AgradCdfLogBetaNegBinomial_v_459;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_460> AgradCdfLogBetaNegBinomial_v_460;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_461> AgradCdfLogBetaNegBinomial_v_461;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_462> AgradCdfLogBetaNegBinomial_v_462;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_463> AgradCdfLogBetaNegBinomial_v_463;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_464> AgradCdfLogBetaNegBinomial_v_464;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_465> AgradCdfLogBetaNegBinomial_v_465;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_466> AgradCdfLogBetaNegBinomial_v_466;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_467> AgradCdfLogBetaNegBinomial_v_467;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_468> AgradCdfLogBetaNegBinomial_v_468;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_469> AgradCdfLogBetaNegBinomial_v_469;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_470> AgradCdfLogBetaNegBinomial_v_470;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_471> AgradCdfLogBetaNegBinomial_v_471;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_472> AgradCdfLogBetaNegBinomial_v_472;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_473> AgradCdfLogBetaNegBinomial_v_473;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_474> AgradCdfLogBetaNegBinomial_v_474;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_475> AgradCdfLogBetaNegBinomial_v_475;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_476> AgradCdfLogBetaNegBinomial_v_476;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_477> AgradCdfLogBetaNegBinomial_v_477;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_478> AgradCdfLogBetaNegBinomial_v_478;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_479> AgradCdfLogBetaNegBinomial_v_479;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_480> AgradCdfLogBetaNegBinomial_v_480;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_481> AgradCdfLogBetaNegBinomial_v_481;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_482> AgradCdfLogBetaNegBinomial_v_482;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_483> AgradCdfLogBetaNegBinomial_v_483;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_484> AgradCdfLogBetaNegBinomial_v_484;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_485> AgradCdfLogBetaNegBinomial_v_485;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_486> AgradCdfLogBetaNegBinomial_v_486;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_487> AgradCdfLogBetaNegBinomial_v_487;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_488> AgradCdfLogBetaNegBinomial_v_488;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_489> AgradCdfLogBetaNegBinomial_v_489;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_490> AgradCdfLogBetaNegBinomial_v_490;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_491> AgradCdfLogBetaNegBinomial_v_491;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_492> AgradCdfLogBetaNegBinomial_v_492;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_493> AgradCdfLogBetaNegBinomial_v_493;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_494> AgradCdfLogBetaNegBinomial_v_494;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_495> AgradCdfLogBetaNegBinomial_v_495;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_496> AgradCdfLogBetaNegBinomial_v_496;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_497> AgradCdfLogBetaNegBinomial_v_497;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_498> AgradCdfLogBetaNegBinomial_v_498;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_499> AgradCdfLogBetaNegBinomial_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_400, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_401, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_402, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_403, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_404, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_405, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_406, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_407, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_408, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_409, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_410, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_411, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_412, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_413, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_414, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_415, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_416, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_417, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_418, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_419, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_420, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_421, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_422, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_423, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_424, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_425, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_426, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_427, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_428, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_429, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_430, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_431, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_432, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_433, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_434, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_435, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_436, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_437, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_438, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_439, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_440, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_441, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_442, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_443, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_444, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_445, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_446, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_447, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_448, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_449, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_450, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_451, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_452, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_453, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_454, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_455, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_456, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_457, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_458, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_459, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_460, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_461, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_462, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_463, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_464, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_465, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_466, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_467, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_468, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_469, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_470, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_471, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_472, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_473, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_474, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_475, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_476, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_477, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_478, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_479, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_480, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_481, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_482, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_483, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_484, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_485, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_486, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_487, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_488, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_489, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_490, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_491, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_492, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_493, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_494, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_495, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_496, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_497, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_498, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_499, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_499);
+
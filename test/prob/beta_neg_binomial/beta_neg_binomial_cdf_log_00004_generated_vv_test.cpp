@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_400> AgradCdfLogBetaNegBinomial_vv_400;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_401> AgradCdfLogBetaNegBinomial_vv_401;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_402> AgradCdfLogBetaNegBinomial_vv_402;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_403> AgradCdfLogBetaNegBinomial_vv_403;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_404> AgradCdfLogBetaNegBinomial_vv_404;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_405> AgradCdfLogBetaNegBinomial_vv_405;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_406> AgradCdfLogBetaNegBinomial_vv_406;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_407> AgradCdfLogBetaNegBinomial_vv_407;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_408> AgradCdfLogBetaNegBinomial_vv_408;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_409> AgradCdfLogBetaNegBinomial_vv_409;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_410> AgradCdfLogBetaNegBinomial_vv_410;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_411> AgradCdfLogBetaNegBinomial_vv_411;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_412> AgradCdfLogBetaNegBinomial_vv_412;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_413> AgradCdfLogBetaNegBinomial_vv_413;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_414> AgradCdfLogBetaNegBinomial_vv_414;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_415> AgradCdfLogBetaNegBinomial_vv_415;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_416> AgradCdfLogBetaNegBinomial_vv_416;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_417> AgradCdfLogBetaNegBinomial_vv_417;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_418> AgradCdfLogBetaNegBinomial_vv_418;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_419> AgradCdfLogBetaNegBinomial_vv_419;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_420> AgradCdfLogBetaNegBinomial_vv_420;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_421> AgradCdfLogBetaNegBinomial_vv_421;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_422> AgradCdfLogBetaNegBinomial_vv_422;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_423> AgradCdfLogBetaNegBinomial_vv_423;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_424> AgradCdfLogBetaNegBinomial_vv_424;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_425> AgradCdfLogBetaNegBinomial_vv_425;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_426> AgradCdfLogBetaNegBinomial_vv_426;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_427> AgradCdfLogBetaNegBinomial_vv_427;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_428> AgradCdfLogBetaNegBinomial_vv_428;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_429> AgradCdfLogBetaNegBinomial_vv_429;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_430> AgradCdfLogBetaNegBinomial_vv_430;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_431> AgradCdfLogBetaNegBinomial_vv_431;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_432> AgradCdfLogBetaNegBinomial_vv_432;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_433> AgradCdfLogBetaNegBinomial_vv_433;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_434> AgradCdfLogBetaNegBinomial_vv_434;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_435> AgradCdfLogBetaNegBinomial_vv_435;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_436> AgradCdfLogBetaNegBinomial_vv_436;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_437> AgradCdfLogBetaNegBinomial_vv_437;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_438> AgradCdfLogBetaNegBinomial_vv_438;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_439> AgradCdfLogBetaNegBinomial_vv_439;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_440> AgradCdfLogBetaNegBinomial_vv_440;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_441> AgradCdfLogBetaNegBinomial_vv_441;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_442> AgradCdfLogBetaNegBinomial_vv_442;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_443> AgradCdfLogBetaNegBinomial_vv_443;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_444> AgradCdfLogBetaNegBinomial_vv_444;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_445> AgradCdfLogBetaNegBinomial_vv_445;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_446> AgradCdfLogBetaNegBinomial_vv_446;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_447> AgradCdfLogBetaNegBinomial_vv_447;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_448> AgradCdfLogBetaNegBinomial_vv_448;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_449> AgradCdfLogBetaNegBinomial_vv_449;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_450> AgradCdfLogBetaNegBinomial_vv_450;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_451> AgradCdfLogBetaNegBinomial_vv_451;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_452> AgradCdfLogBetaNegBinomial_vv_452;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_453> AgradCdfLogBetaNegBinomial_vv_453;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_454> AgradCdfLogBetaNegBinomial_vv_454;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_455> AgradCdfLogBetaNegBinomial_vv_455;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_456> AgradCdfLogBetaNegBinomial_vv_456;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_457> AgradCdfLogBetaNegBinomial_vv_457;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_458> AgradCdfLogBetaNegBinomial_vv_458;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_459> AgradCdfLogBetaNegBinomial_vv_459;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_460> AgradCdfLogBetaNegBinomial_vv_460;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_461> AgradCdfLogBetaNegBinomial_vv_461;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_462> AgradCdfLogBetaNegBinomial_vv_462;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_463> AgradCdfLogBetaNegBinomial_vv_463;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_464> AgradCdfLogBetaNegBinomial_vv_464;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_465> AgradCdfLogBetaNegBinomial_vv_465;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_466> AgradCdfLogBetaNegBinomial_vv_466;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_467> AgradCdfLogBetaNegBinomial_vv_467;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_468> AgradCdfLogBetaNegBinomial_vv_468;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_469> AgradCdfLogBetaNegBinomial_vv_469;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_470> AgradCdfLogBetaNegBinomial_vv_470;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_471> AgradCdfLogBetaNegBinomial_vv_471;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_472> AgradCdfLogBetaNegBinomial_vv_472;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_473> AgradCdfLogBetaNegBinomial_vv_473;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_474> AgradCdfLogBetaNegBinomial_vv_474;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_475> AgradCdfLogBetaNegBinomial_vv_475;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_476> AgradCdfLogBetaNegBinomial_vv_476;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_477> AgradCdfLogBetaNegBinomial_vv_477;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_478> AgradCdfLogBetaNegBinomial_vv_478;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_479> AgradCdfLogBetaNegBinomial_vv_479;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_480> AgradCdfLogBetaNegBinomial_vv_480;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_481> AgradCdfLogBetaNegBinomial_vv_481;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_482> AgradCdfLogBetaNegBinomial_vv_482;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_483> AgradCdfLogBetaNegBinomial_vv_483;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_484> AgradCdfLogBetaNegBinomial_vv_484;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_485> AgradCdfLogBetaNegBinomial_vv_485;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_486> AgradCdfLogBetaNegBinomial_vv_486;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_487> AgradCdfLogBetaNegBinomial_vv_487;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_488> AgradCdfLogBetaNegBinomial_vv_488;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_489> AgradCdfLogBetaNegBinomial_vv_489;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_490> AgradCdfLogBetaNegBinomial_vv_490;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_491> AgradCdfLogBetaNegBinomial_vv_491;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_492> AgradCdfLogBetaNegBinomial_vv_492;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_493> AgradCdfLogBetaNegBinomial_vv_493;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_494> AgradCdfLogBetaNegBinomial_vv_494;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_495> AgradCdfLogBetaNegBinomial_vv_495;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_496> AgradCdfLogBetaNegBinomial_vv_496;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_497> AgradCdfLogBetaNegBinomial_vv_497;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_498> AgradCdfLogBetaNegBinomial_vv_498;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_499> AgradCdfLogBetaNegBinomial_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_400, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_401, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_402, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_403, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_404, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_405, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_406, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_407, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_408, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_409, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_410, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_411, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_412, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_413, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_414, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_415, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_416, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_417, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_418, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_419, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_420, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_421, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_422, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_423, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_424, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_425, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_426, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_427, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_428, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_429, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_430, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_431, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_432, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_433, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_434, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_435, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_436, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_437, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_438, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_439, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_440, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_441, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_442, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_443, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_444, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_445, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_446, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_447, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_448, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_449, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_450, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_451, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_452, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_453, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_454, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_455, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_456, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_457, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_458, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_459, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_460, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_461, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_462, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_463, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_464, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_465, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_466, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_467, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_468, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_469, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_470, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_471, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_472, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_473, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_474, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_475, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_476, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_477, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_478, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_479, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_480, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_481, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_482, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_483, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_484, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_485, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_486, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_487, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_488, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_489, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_490, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_491, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_492, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_493, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_494, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_495, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_496, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_497, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_498, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_499, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_499);
+
@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_500> AgradCdfLogBetaNegBinomial_ffv_500;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_501> AgradCdfLogBetaNegBinomial_ffv_501;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_502> AgradCdfLogBetaNegBinomial_ffv_502;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_503> AgradCdfLogBetaNegBinomial_ffv_503;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_504> AgradCdfLogBetaNegBinomial_ffv_504;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_505> AgradCdfLogBetaNegBinomial_ffv_505;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_506> AgradCdfLogBetaNegBinomial_ffv_506;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_507> AgradCdfLogBetaNegBinomial_ffv_507;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_508> AgradCdfLogBetaNegBinomial_ffv_508;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_509> AgradCdfLogBetaNegBinomial_ffv_509;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_510> AgradCdfLogBetaNegBinomial_ffv_510;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_511> AgradCdfLogBetaNegBinomial_ffv_511;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_512> AgradCdfLogBetaNegBinomial_ffv_512;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_513> AgradCdfLogBetaNegBinomial_ffv_513;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_514> AgradCdfLogBetaNegBinomial_ffv_514;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_515> AgradCdfLogBetaNegBinomial_ffv_515;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_516> AgradCdfLogBetaNegBinomial_ffv_516;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_517> AgradCdfLogBetaNegBinomial_ffv_517;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_518> AgradCdfLogBetaNegBinomial_ffv_518;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_519> AgradCdfLogBetaNegBinomial_ffv_519;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_520> AgradCdfLogBetaNegBinomial_ffv_520;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_521> AgradCdfLogBetaNegBinomial_ffv_521;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_522> AgradCdfLogBetaNegBinomial_ffv_522;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_523> AgradCdfLogBetaNegBinomial_ffv_523;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_524> AgradCdfLogBetaNegBinomial_ffv_524;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_525> AgradCdfLogBetaNegBinomial_ffv_525;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_526> AgradCdfLogBetaNegBinomial_ffv_526;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_527> AgradCdfLogBetaNegBinomial_ffv_527;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_528> AgradCdfLogBetaNegBinomial_ffv_528;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_529> AgradCdfLogBetaNegBinomial_ffv_529;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_530> AgradCdfLogBetaNegBinomial_ffv_530;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_531> AgradCdfLogBetaNegBinomial_ffv_531;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_532> AgradCdfLogBetaNegBinomial_ffv_532;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_533> AgradCdfLogBetaNegBinomial_ffv_533;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_534> AgradCdfLogBetaNegBinomial_ffv_534;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_535> AgradCdfLogBetaNegBinomial_ffv_535;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_536> AgradCdfLogBetaNegBinomial_ffv_536;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_537> AgradCdfLogBetaNegBinomial_ffv_537;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_538> AgradCdfLogBetaNegBinomial_ffv_538;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_539> AgradCdfLogBetaNegBinomial_ffv_539;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_540> AgradCdfLogBetaNegBinomial_ffv_540;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_541> AgradCdfLogBetaNegBinomial_ffv_541;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_542> AgradCdfLogBetaNegBinomial_ffv_542;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_543> AgradCdfLogBetaNegBinomial_ffv_543;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_544> AgradCdfLogBetaNegBinomial_ffv_544;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_545> AgradCdfLogBetaNegBinomial_ffv_545;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_546> AgradCdfLogBetaNegBinomial_ffv_546;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_547> AgradCdfLogBetaNegBinomial_ffv_547;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_548> AgradCdfLogBetaNegBinomial_ffv_548;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_549> AgradCdfLogBetaNegBinomial_ffv_549;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_550> AgradCdfLogBetaNegBinomial_ffv_550;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_551> AgradCdfLogBetaNegBinomial_ffv_551;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_552> AgradCdfLogBetaNegBinomial_ffv_552;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_553> AgradCdfLogBetaNegBinomial_ffv_553;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_554> AgradCdfLogBetaNegBinomial_ffv_554;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_555> AgradCdfLogBetaNegBinomial_ffv_555;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_556> AgradCdfLogBetaNegBinomial_ffv_556;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_557> AgradCdfLogBetaNegBinomial_ffv_557;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_558> AgradCdfLogBetaNegBinomial_ffv_558;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_559> AgradCdfLogBetaNegBinomial_ffv_559;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_560> AgradCdfLogBetaNegBinomial_ffv_560;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_561> AgradCdfLogBetaNegBinomial_ffv_561;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_562> AgradCdfLogBetaNegBinomial_ffv_562;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_563> AgradCdfLogBetaNegBinomial_ffv_563;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_564> AgradCdfLogBetaNegBinomial_ffv_564;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_565> AgradCdfLogBetaNegBinomial_ffv_565;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_ffv_566> AgradCdfLogBetaNegBinomial_ffv_566;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_500, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_501, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_502, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_503, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_504, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_505, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_506, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_507, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_508, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_509, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_510, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_511, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_512, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_513, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_514, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_515, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_516, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_517, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_518, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_519, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_520, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_521, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_522, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_523, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_524, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_525, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_526, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_527, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_528, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_529, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_530, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_531, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_532, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_533, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_534, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_535, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_536, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_537, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_538, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_539, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_540, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_541, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_542, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_543, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_544, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_545, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_546, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_547, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_548, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_549, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_550, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_551, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_552, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_553, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_554, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_555, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_556, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_557, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_558, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_559, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_560, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_561, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_562, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_563, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_564, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_565, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_ffv_566, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_ffv_566);
+
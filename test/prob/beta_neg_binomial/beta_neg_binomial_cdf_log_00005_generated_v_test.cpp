@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_500> AgradCdfLogBetaNegBinomial_v_500;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_501> AgradCdfLogBetaNegBinomial_v_501;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_502> AgradCdfLogBetaNegBinomial_v_502;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_503> AgradCdfLogBetaNegBinomial_v_503;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_504> AgradCdfLogBetaNegBinomial_v_504;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_505> AgradCdfLogBetaNegBinomial_v_505;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_506> AgradCdfLogBetaNegBinomial_v_506;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_507> AgradCdfLogBetaNegBinomial_v_507;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_508> AgradCdfLogBetaNegBinomial_v_508;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_509> AgradCdfLogBetaNegBinomial_v_509;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_510> AgradCdfLogBetaNegBinomial_v_510;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_511> AgradCdfLogBetaNegBinomial_v_511;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_512> AgradCdfLogBetaNegBinomial_v_512;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_513> AgradCdfLogBetaNegBinomial_v_513;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_514> AgradCdfLogBetaNegBinomial_v_514;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_515> AgradCdfLogBetaNegBinomial_v_515;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_516> AgradCdfLogBetaNegBinomial_v_516;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_517> AgradCdfLogBetaNegBinomial_v_517;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_518> AgradCdfLogBetaNegBinomial_v_518;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_519> AgradCdfLogBetaNegBinomial_v_519;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_520> AgradCdfLogBetaNegBinomial_v_520;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_521> AgradCdfLogBetaNegBinomial_v_521;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_522> AgradCdfLogBetaNegBinomial_v_522;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_523> AgradCdfLogBetaNegBinomial_v_523;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_524> AgradCdfLogBetaNegBinomial_v_524;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_525> AgradCdfLogBetaNegBinomial_v_525;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_526> AgradCdfLogBetaNegBinomial_v_526;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_527> AgradCdfLogBetaNegBinomial_v_527;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_528> AgradCdfLogBetaNegBinomial_v_528;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_529> AgradCdfLogBetaNegBinomial_v_529;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_530> AgradCdfLogBetaNegBinomial_v_530;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_531> AgradCdfLogBetaNegBinomial_v_531;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_532> AgradCdfLogBetaNegBinomial_v_532;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_533> AgradCdfLogBetaNegBinomial_v_533;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_534> AgradCdfLogBetaNegBinomial_v_534;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_535> AgradCdfLogBetaNegBinomial_v_535;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_536> AgradCdfLogBetaNegBinomial_v_536;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_537> AgradCdfLogBetaNegBinomial_v_537;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_538> AgradCdfLogBetaNegBinomial_v_538;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_539> AgradCdfLogBetaNegBinomial_v_539;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_540> AgradCdfLogBetaNegBinomial_v_540;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_541> AgradCdfLogBetaNegBinomial_v_541;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_542> AgradCdfLogBetaNegBinomial_v_542;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_543> AgradCdfLogBetaNegBinomial_v_543;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_544> AgradCdfLogBetaNegBinomial_v_544;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_545> AgradCdfLogBetaNegBinomial_v_545;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_546> AgradCdfLogBetaNegBinomial_v_546;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_547> AgradCdfLogBetaNegBinomial_v_547;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_548> AgradCdfLogBetaNegBinomial_v_548;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_549> AgradCdfLogBetaNegBinomial_v_549;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_550> AgradCdfLogBetaNegBinomial_v_550;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_551> AgradCdfLogBetaNegBinomial_v_551;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_552> AgradCdfLogBetaNegBinomial_v_552;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_553> AgradCdfLogBetaNegBinomial_v_553;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_554> AgradCdfLogBetaNegBinomial_v_554;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_555> AgradCdfLogBetaNegBinomial_v_555;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_556> AgradCdfLogBetaNegBinomial_v_556;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_557> AgradCdfLogBetaNegBinomial_v_557;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_558> AgradCdfLogBetaNegBinomial_v_558;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_559> AgradCdfLogBetaNegBinomial_v_559;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_560> AgradCdfLogBetaNegBinomial_v_560;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_561> AgradCdfLogBetaNegBinomial_v_561;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_562> AgradCdfLogBetaNegBinomial_v_562;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_563> AgradCdfLogBetaNegBinomial_v_563;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_564> AgradCdfLogBetaNegBinomial_v_564;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_565> AgradCdfLogBetaNegBinomial_v_565;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_566> AgradCdfLogBetaNegBinomial_v_566;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_567> AgradCdfLogBetaNegBinomial_v_567;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_568> AgradCdfLogBetaNegBinomial_v_568;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_569> AgradCdfLogBetaNegBinomial_v_569;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_570> AgradCdfLogBetaNegBinomial_v_570;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_571> AgradCdfLogBetaNegBinomial_v_571;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_572> AgradCdfLogBetaNegBinomial_v_572;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_573> AgradCdfLogBetaNegBinomial_v_573;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_574> AgradCdfLogBetaNegBinomial_v_574;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_575> AgradCdfLogBetaNegBinomial_v_575;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_576> AgradCdfLogBetaNegBinomial_v_576;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_577> AgradCdfLogBetaNegBinomial_v_577;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_578> AgradCdfLogBetaNegBinomial_v_578;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_579> AgradCdfLogBetaNegBinomial_v_579;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_580> AgradCdfLogBetaNegBinomial_v_580;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_581> AgradCdfLogBetaNegBinomial_v_581;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_582> AgradCdfLogBetaNegBinomial_v_582;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_583> AgradCdfLogBetaNegBinomial_v_583;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_584> AgradCdfLogBetaNegBinomial_v_584;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_585> AgradCdfLogBetaNegBinomial_v_585;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_586> AgradCdfLogBetaNegBinomial_v_586;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_587> AgradCdfLogBetaNegBinomial_v_587;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_588> AgradCdfLogBetaNegBinomial_v_588;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_589> AgradCdfLogBetaNegBinomial_v_589;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_590> AgradCdfLogBetaNegBinomial_v_590;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_591> AgradCdfLogBetaNegBinomial_v_591;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_592> AgradCdfLogBetaNegBinomial_v_592;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_593> AgradCdfLogBetaNegBinomial_v_593;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_594> AgradCdfLogBetaNegBinomial_v_594;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_595> AgradCdfLogBetaNegBinomial_v_595;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_596> AgradCdfLogBetaNegBinomial_v_596;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_597> AgradCdfLogBetaNegBinomial_v_597;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_598> AgradCdfLogBetaNegBinomial_v_598;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_599> AgradCdfLogBetaNegBinomial_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_500, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_501, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_502, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_503, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_504, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_505, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_506, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_507, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_508, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_509, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_510, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_511, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_512, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_513, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_514, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_515, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_516, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_517, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_518, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_519, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_520, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_521, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_522, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_523, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_524, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_525, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_526, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_527, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_528, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_529, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_530, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_531, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_532, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_533, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_534, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_535, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_536, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_537, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_538, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_539, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_540, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_541, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_542, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_543, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_544, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_545, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_546, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_547, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_548, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_549, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_550, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_551, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_552, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_553, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_554, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_555, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_556, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_557, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_558, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_559, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_560, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_561, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_562, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_563, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_564, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_565, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_566, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_567, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_568, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_569, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_570, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_571, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_572, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_573, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_574, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_575, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_576, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_577, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_578, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_579, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_580, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_581, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_582, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_583, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_584, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_585, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_586, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_587, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_588, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_589, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_590, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_591, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_592, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_593, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_594, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_595, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_596, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_597, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_598, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_599, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_599);
+
@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_500> AgradCdfLogBetaNegBinomial_vv_500;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_501> AgradCdfLogBetaNegBinomial_vv_501;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_502> AgradCdfLogBetaNegBinomial_vv_502;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_503> AgradCdfLogBetaNegBinomial_vv_503;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_504> AgradCdfLogBetaNegBinomial_vv_504;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_505> AgradCdfLogBetaNegBinomial_vv_505;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_506> AgradCdfLogBetaNegBinomial_vv_506;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_507> AgradCdfLogBetaNegBinomial_vv_507;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_508> AgradCdfLogBetaNegBinomial_vv_508;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_509> AgradCdfLogBetaNegBinomial_vv_509;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_510> AgradCdfLogBetaNegBinomial_vv_510;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_511> AgradCdfLogBetaNegBinomial_vv_511;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_512> AgradCdfLogBetaNegBinomial_vv_512;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_513> AgradCdfLogBetaNegBinomial_vv_513;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_514> AgradCdfLogBetaNegBinomial_vv_514;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_515> AgradCdfLogBetaNegBinomial_vv_515;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_516> AgradCdfLogBetaNegBinomial_vv_516;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_517> AgradCdfLogBetaNegBinomial_vv_517;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_518> AgradCdfLogBetaNegBinomial_vv_518;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_519> AgradCdfLogBetaNegBinomial_vv_519;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_520> AgradCdfLogBetaNegBinomial_vv_520;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_521> AgradCdfLogBetaNegBinomial_vv_521;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_522> AgradCdfLogBetaNegBinomial_vv_522;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_523> AgradCdfLogBetaNegBinomial_vv_523;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_524> AgradCdfLogBetaNegBinomial_vv_524;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_525> AgradCdfLogBetaNegBinomial_vv_525;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_526> AgradCdfLogBetaNegBinomial_vv_526;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_527> AgradCdfLogBetaNegBinomial_vv_527;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_528> AgradCdfLogBetaNegBinomial_vv_528;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_529> AgradCdfLogBetaNegBinomial_vv_529;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_530> AgradCdfLogBetaNegBinomial_vv_530;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_531> AgradCdfLogBetaNegBinomial_vv_531;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_532> AgradCdfLogBetaNegBinomial_vv_532;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_533> AgradCdfLogBetaNegBinomial_vv_533;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_534> AgradCdfLogBetaNegBinomial_vv_534;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_535> AgradCdfLogBetaNegBinomial_vv_535;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_536> AgradCdfLogBetaNegBinomial_vv_536;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_537> AgradCdfLogBetaNegBinomial_vv_537;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_538> AgradCdfLogBetaNegBinomial_vv_538;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_539> AgradCdfLogBetaNegBinomial_vv_539;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_540> AgradCdfLogBetaNegBinomial_vv_540;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_541> AgradCdfLogBetaNegBinomial_vv_541;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_542> AgradCdfLogBetaNegBinomial_vv_542;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_543> AgradCdfLogBetaNegBinomial_vv_543;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_544> AgradCdfLogBetaNegBinomial_vv_544;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_545> AgradCdfLogBetaNegBinomial_vv_545;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_546> AgradCdfLogBetaNegBinomial_vv_546;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_547> AgradCdfLogBetaNegBinomial_vv_547;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_548> AgradCdfLogBetaNegBinomial_vv_548;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_549> AgradCdfLogBetaNegBinomial_vv_549;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_550> AgradCdfLogBetaNegBinomial_vv_550;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_551> AgradCdfLogBetaNegBinomial_vv_551;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_552> AgradCdfLogBetaNegBinomial_vv_552;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_553> AgradCdfLogBetaNegBinomial_vv_553;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_554> AgradCdfLogBetaNegBinomial_vv_554;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_555> AgradCdfLogBetaNegBinomial_vv_555;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_556> AgradCdfLogBetaNegBinomial_vv_556;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_557> AgradCdfLogBetaNegBinomial_vv_557;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_558> AgradCdfLogBetaNegBinomial_vv_558;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_559> AgradCdfLogBetaNegBinomial_vv_559;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_560> AgradCdfLogBetaNegBinomial_vv_560;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_561> AgradCdfLogBetaNegBinomial_vv_561;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_562> AgradCdfLogBetaNegBinomial_vv_562;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_563> AgradCdfLogBetaNegBinomial_vv_563;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_564> AgradCdfLogBetaNegBinomial_vv_564;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_565> AgradCdfLogBetaNegBinomial_vv_565;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_vv_566> AgradCdfLogBetaNegBinomial_vv_566;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_500, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_501, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_502, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_503, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_504, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_505, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_506, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_507, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_508, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_509, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_510, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_511, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_512, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_513, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_514, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_515, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_516, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_517, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_518, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_519, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_520, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_521, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_522, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_523, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_524, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_525, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_526, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_527, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_528, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_529, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_530, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_531, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_532, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_533, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_534, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_535, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_536, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_537, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_538, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_539, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_540, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_541, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_542, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_543, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_544, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_545, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_546, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_547, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_548, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_549, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_550, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_551, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_552, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_553, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_554, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_555, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_556, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_557, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_558, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_559, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_560, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_561, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_562, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_563, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_564, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_565, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_vv_566, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_vv_566);
+
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_neg_binomial/beta_neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_600> AgradCdfLogBetaNegBinomial_v_600;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_601> AgradCdfLogBetaNegBinomial_v_601;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_602> AgradCdfLogBetaNegBinomial_v_602;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_603> AgradCdfLogBetaNegBinomial_v_603;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_604> AgradCdfLogBetaNegBinomial_v_604;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_605> AgradCdfLogBetaNegBinomial_v_605;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_606> AgradCdfLogBetaNegBinomial_v_606;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_607> AgradCdfLogBetaNegBinomial_v_607;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_608> AgradCdfLogBetaNegBinomial_v_608;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_609> AgradCdfLogBetaNegBinomial_v_609;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_610> AgradCdfLogBetaNegBinomial_v_610;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_611> AgradCdfLogBetaNegBinomial_v_611;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_612> AgradCdfLogBetaNegBinomial_v_612;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_613> AgradCdfLogBetaNegBinomial_v_613;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_614> AgradCdfLogBetaNegBinomial_v_614;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_615> AgradCdfLogBetaNegBinomial_v_615;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_616> AgradCdfLogBetaNegBinomial_v_616;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_617> AgradCdfLogBetaNegBinomial_v_617;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_618> AgradCdfLogBetaNegBinomial_v_618;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_619> AgradCdfLogBetaNegBinomial_v_619;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_620> AgradCdfLogBetaNegBinomial_v_620;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_621> AgradCdfLogBetaNegBinomial_v_621;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_622> AgradCdfLogBetaNegBinomial_v_622;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_623> AgradCdfLogBetaNegBinomial_v_623;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_624> AgradCdfLogBetaNegBinomial_v_624;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_625> AgradCdfLogBetaNegBinomial_v_625;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_626> AgradCdfLogBetaNegBinomial_v_626;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_627> AgradCdfLogBetaNegBinomial_v_627;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_628> AgradCdfLogBetaNegBinomial_v_628;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_629> AgradCdfLogBetaNegBinomial_v_629;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_630> AgradCdfLogBetaNegBinomial_v_630;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_631> AgradCdfLogBetaNegBinomial_v_631;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_632> AgradCdfLogBetaNegBinomial_v_632;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_633> AgradCdfLogBetaNegBinomial_v_633;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_634> AgradCdfLogBetaNegBinomial_v_634;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_635> AgradCdfLogBetaNegBinomial_v_635;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_636> AgradCdfLogBetaNegBinomial_v_636;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_637> AgradCdfLogBetaNegBinomial_v_637;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_638> AgradCdfLogBetaNegBinomial_v_638;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_639> AgradCdfLogBetaNegBinomial_v_639;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_640> AgradCdfLogBetaNegBinomial_v_640;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_641> AgradCdfLogBetaNegBinomial_v_641;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_642> AgradCdfLogBetaNegBinomial_v_642;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_643> AgradCdfLogBetaNegBinomial_v_643;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_644> AgradCdfLogBetaNegBinomial_v_644;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_645> AgradCdfLogBetaNegBinomial_v_645;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_646> AgradCdfLogBetaNegBinomial_v_646;
+typedef std::tuple<AgradCdfLogBetaNegBinomial, type_v_647> AgradCdfLogBetaNegBinomial_v_647;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_600, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_601, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_602, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_603, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_604, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_605, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_606, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_607, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_608, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_609, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_610, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_611, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_612, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_613, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_614, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_615, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_616, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_617, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_618, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_619, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_620, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_621, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_622, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_623, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_624, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_625, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_626, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_627, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_628, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_629, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_630, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_631, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_632, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_633, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_634, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_635, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_636, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_637, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_638, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_639, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_640, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_641, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_642, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_643, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_644, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_645, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_646, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaNegBinomial_v_647, AgradCdfLogTestFixture, AgradCdfLogBetaNegBinomial_v_647);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_0> AgradDistributionsBetaProportion_ffv_0;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_1> AgradDistributionsBetaProportion_ffv_1;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_2> AgradDistributionsBetaProportion_ffv_2;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_3> AgradDistributionsBetaProportion_ffv_3;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_4> AgradDistributionsBetaProportion_ffv_4;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_5> AgradDistributionsBetaProportion_ffv_5;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_6> AgradDistributionsBetaProportion_ffv_6;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_7> AgradDistributionsBetaProportion_ffv_7;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_8> AgradDistributionsBetaProportion_ffv_8;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_9> AgradDistributionsBetaProportion_ffv_9;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_10> AgradDistributionsBetaProportion_ffv_10;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_11> AgradDistributionsBetaProportion_ffv_11;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_12> AgradDistributionsBetaProportion_ffv_12;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_13> AgradDistributionsBetaProportion_ffv_13;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_14> AgradDistributionsBetaProportion_ffv_14;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_15> AgradDistributionsBetaProportion_ffv_15;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_16> AgradDistributionsBetaProportion_ffv_16;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_17> AgradDistributionsBetaProportion_ffv_17;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_18> AgradDistributionsBetaProportion_ffv_18;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_19> AgradDistributionsBetaProportion_ffv_19;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_20> AgradDistributionsBetaProportion_ffv_20;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_21> AgradDistributionsBetaProportion_ffv_21;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_22> AgradDistributionsBetaProportion_ffv_22;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_23> AgradDistributionsBetaProportion_ffv_23;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_24> AgradDistributionsBetaProportion_ffv_24;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_25> AgradDistributionsBetaProportion_ffv_25;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_26> AgradDistributionsBetaProportion_ffv_26;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_27> AgradDistributionsBetaProportion_ffv_27;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_28> AgradDistributionsBetaProportion_ffv_28;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_29> AgradDistributionsBetaProportion_ffv_29;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_30> AgradDistributionsBetaProportion_ffv_30;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_31> AgradDistributionsBetaProportion_ffv_31;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_32> AgradDistributionsBetaProportion_ffv_32;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_33> AgradDistributionsBetaProportion_ffv_33;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_34> AgradDistributionsBetaProportion_ffv_34;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_35> AgradDistributionsBetaProportion_ffv_35;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_36> AgradDistributionsBetaProportion_ffv_36;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_37> AgradDistributionsBetaProportion_ffv_37;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_38> AgradDistributionsBetaProportion_ffv_38;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_39> AgradDistributionsBetaProportion_ffv_39;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_40> AgradDistributionsBetaProportion_ffv_40;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_41> AgradDistributionsBetaProportion_ffv_41;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_42> AgradDistributionsBetaProportion_ffv_42;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_43> AgradDistributionsBetaProportion_ffv_43;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_44> AgradDistributionsBetaProportion_ffv_44;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_45> AgradDistributionsBetaProportion_ffv_45;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_46> AgradDistributionsBetaProportion_ffv_46;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_47> AgradDistributionsBetaProportion_ffv_47;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_48> AgradDistributionsBetaProportion_ffv_48;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_49> AgradDistributionsBetaProportion_ffv_49;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_50> AgradDistributionsBetaProportion_ffv_50;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_51> AgradDistributionsBetaProportion_ffv_51;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_52> AgradDistributionsBetaProportion_ffv_52;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_53> AgradDistributionsBetaProportion_ffv_53;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_54> AgradDistributionsBetaProportion_ffv_54;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_55> AgradDistributionsBetaProportion_ffv_55;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_56> AgradDistributionsBetaProportion_ffv_56;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_57> AgradDistributionsBetaProportion_ffv_57;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_58> AgradDistributionsBetaProportion_ffv_58;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_59> AgradDistributionsBetaProportion_ffv_59;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_60> AgradDistributionsBetaProportion_ffv_60;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_61> AgradDistributionsBetaProportion_ffv_61;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_62> AgradDistributionsBetaProportion_ffv_62;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_63> AgradDistributionsBetaProportion_ffv_63;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_64> AgradDistributionsBetaProportion_ffv_64;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_65> AgradDistributionsBetaProportion_ffv_65;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_66> AgradDistributionsBetaProportion_ffv_66;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_67> AgradDistributionsBetaProportion_ffv_67;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_68> AgradDistributionsBetaProportion_ffv_68;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_69> AgradDistributionsBetaProportion_ffv_69;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_70> AgradDistributionsBetaProportion_ffv_70;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_71> AgradDistributionsBetaProportion_ffv_71;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_72> AgradDistributionsBetaProportion_ffv_72;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_73> AgradDistributionsBetaProportion_ffv_73;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_74> AgradDistributionsBetaProportion_ffv_74;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_75> AgradDistributionsBetaProportion_ffv_75;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_76> AgradDistributionsBetaProportion_ffv_76;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_77> AgradDistributionsBetaProportion_ffv_77;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_78> AgradDistributionsBetaProportion_ffv_78;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_79> AgradDistributionsBetaProportion_ffv_79;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_80> AgradDistributionsBetaProportion_ffv_80;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_81> AgradDistributionsBetaProportion_ffv_81;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_82> AgradDistributionsBetaProportion_ffv_82;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_83> AgradDistributionsBetaProportion_ffv_83;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_84> AgradDistributionsBetaProportion_ffv_84;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_85> AgradDistributionsBetaProportion_ffv_85;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_86> AgradDistributionsBetaProportion_ffv_86;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_87> AgradDistributionsBetaProportion_ffv_87;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_88> AgradDistributionsBetaProportion_ffv_88;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_89> AgradDistributionsBetaProportion_ffv_89;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_90> AgradDistributionsBetaProportion_ffv_90;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_91> AgradDistributionsBetaProportion_ffv_91;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_92> AgradDistributionsBetaProportion_ffv_92;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_93> AgradDistributionsBetaProportion_ffv_93;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_94> AgradDistributionsBetaProportion_ffv_94;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_95> AgradDistributionsBetaProportion_ffv_95;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_96> AgradDistributionsBetaProportion_ffv_96;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_97> AgradDistributionsBetaProportion_ffv_97;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_98> AgradDistributionsBetaProportion_ffv_98;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_99> AgradDistributionsBetaProportion_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_0, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_1, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_2, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_3, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_4, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_5, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_6, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_7, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_8, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_9, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_10, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_11, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_12, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_13, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_14, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_15, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_16, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_17, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_18, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_19, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_20, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_21, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_22, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_23, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_24, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_25, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_26, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_27, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_28, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_29, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_30, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_31, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_32, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_33, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_34, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_35, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_36, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_37, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_38, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_39, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_40, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_41, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_42, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_43, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_44, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_45, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_46, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_47, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_48, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_49, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_50, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_51, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_52, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_53, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_54, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_55, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_56, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_57, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_58, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_59, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_60, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_61, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_62, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_63, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_64, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_65, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_66, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_67, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_68, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_69, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_70, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_71, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_72, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_73, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_74, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_75, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_76, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_77, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_78, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_79, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_80, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_81, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_82, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_83, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_84, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_85, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_86, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_87, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_88, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_89, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_90, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_91, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_92, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_93, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_94, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_95, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_96, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_97, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_98, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_99, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_99);
+
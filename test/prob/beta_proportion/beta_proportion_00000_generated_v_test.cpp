@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_0> AgradDistributionsBetaProportion_v_0;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_1> AgradDistributionsBetaProportion_v_1;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_2> AgradDistributionsBetaProportion_v_2;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_3> AgradDistributionsBetaProportion_v_3;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_4> AgradDistributionsBetaProportion_v_4;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_5> AgradDistributionsBetaProportion_v_5;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_6> AgradDistributionsBetaProportion_v_6;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_7> AgradDistributionsBetaProportion_v_7;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_8> AgradDistributionsBetaProportion_v_8;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_9> AgradDistributionsBetaProportion_v_9;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_10> AgradDistributionsBetaProportion_v_10;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_11> AgradDistributionsBetaProportion_v_11;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_12> AgradDistributionsBetaProportion_v_12;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_13> AgradDistributionsBetaProportion_v_13;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_14> AgradDistributionsBetaProportion_v_14;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_15> AgradDistributionsBetaProportion_v_15;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_16> AgradDistributionsBetaProportion_v_16;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_17> AgradDistributionsBetaProportion_v_17;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_18> AgradDistributionsBetaProportion_v_18;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_19> AgradDistributionsBetaProportion_v_19;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_20> AgradDistributionsBetaProportion_v_20;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_21> AgradDistributionsBetaProportion_v_21;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_22> AgradDistributionsBetaProportion_v_22;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_23> AgradDistributionsBetaProportion_v_23;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_24> AgradDistributionsBetaProportion_v_24;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_25> AgradDistributionsBetaProportion_v_25;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_26> AgradDistributionsBetaProportion_v_26;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_27> AgradDistributionsBetaProportion_v_27;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_28> AgradDistributionsBetaProportion_v_28;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_29> AgradDistributionsBetaProportion_v_29;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_30> AgradDistributionsBetaProportion_v_30;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_31> AgradDistributionsBetaProportion_v_31;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_32> AgradDistributionsBetaProportion_v_32;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_33> AgradDistributionsBetaProportion_v_33;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_34> AgradDistributionsBetaProportion_v_34;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_35> AgradDistributionsBetaProportion_v_35;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_36> AgradDistributionsBetaProportion_v_36;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_37> AgradDistributionsBetaProportion_v_37;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_38> AgradDistributionsBetaProportion_v_38;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_39> AgradDistributionsBetaProportion_v_39;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_40> AgradDistributionsBetaProportion_v_40;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_41> AgradDistributionsBetaProportion_v_41;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_42> AgradDistributionsBetaProportion_v_42;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_43> AgradDistributionsBetaProportion_v_43;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_44> AgradDistributionsBetaProportion_v_44;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_45> AgradDistributionsBetaProportion_v_45;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_46> AgradDistributionsBetaProportion_v_46;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_47> AgradDistributionsBetaProportion_v_47;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_48> AgradDistributionsBetaProportion_v_48;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_49> AgradDistributionsBetaProportion_v_49;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_50> AgradDistributionsBetaProportion_v_50;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_51> AgradDistributionsBetaProportion_v_51;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_52> AgradDistributionsBetaProportion_v_52;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_53> AgradDistributionsBetaProportion_v_53;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_54> AgradDistributionsBetaProportion_v_54;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_55> AgradDistributionsBetaProportion_v_55;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_56> AgradDistributionsBetaProportion_v_56;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_57> AgradDistributionsBetaProportion_v_57;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_58> AgradDistributionsBetaProportion_v_58;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_59> AgradDistributionsBetaProportion_v_59;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_60> AgradDistributionsBetaProportion_v_60;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_61> AgradDistributionsBetaProportion_v_61;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_62> AgradDistributionsBetaProportion_v_62;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_63> AgradDistributionsBetaProportion_v_63;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_64> AgradDistributionsBetaProportion_v_64;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_65> AgradDistributionsBetaProportion_v_65;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_66> AgradDistributionsBetaProportion_v_66;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_67> AgradDistributionsBetaProportion_v_67;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_68> AgradDistributionsBetaProportion_v_68;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_69> AgradDistributionsBetaProportion_v_69;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_70> AgradDistributionsBetaProportion_v_70;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_71> AgradDistributionsBetaProportion_v_71;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_72> AgradDistributionsBetaProportion_v_72;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_73> AgradDistributionsBetaProportion_v_73;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_74> AgradDistributionsBetaProportion_v_74;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_75> AgradDistributionsBetaProportion_v_75;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_76> AgradDistributionsBetaProportion_v_76;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_77> AgradDistributionsBetaProportion_v_77;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_78> AgradDistributionsBetaProportion_v_78;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_79> AgradDistributionsBetaProportion_v_79;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_80> AgradDistributionsBetaProportion_v_80;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_81> AgradDistributionsBetaProportion_v_81;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_82> AgradDistributionsBetaProportion_v_82;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_83> AgradDistributionsBetaProportion_v_83;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_84> AgradDistributionsBetaProportion_v_84;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_85> AgradDistributionsBetaProportion_v_85;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_86> AgradDistributionsBetaProportion_v_86;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_87> AgradDistributionsBetaProportion_v_87;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_88> AgradDistributionsBetaProportion_v_88;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_89> AgradDistributionsBetaProportion_v_89;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_90> AgradDistributionsBetaProportion_v_90;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_91> AgradDistributionsBetaProportion_v_91;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_92> AgradDistributionsBetaProportion_v_92;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_93> AgradDistributionsBetaProportion_v_93;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_94> AgradDistributionsBetaProportion_v_94;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_95> AgradDistributionsBetaProportion_v_95;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_96> AgradDistributionsBetaProportion_v_96;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_97> AgradDistributionsBetaProportion_v_97;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_98> AgradDistributionsBetaProportion_v_98;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_99> AgradDistributionsBetaProportion_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_0, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_1, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_2, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_3, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_4, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_5, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_6, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_7, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_8, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_9, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_10, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_11, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_12, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_13, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_14, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_15, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_16, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_17, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_18, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_19, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_20, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_21, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_22, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_23, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_24, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_25, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_26, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_27, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_28, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_29, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_30, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_31, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_32, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_33, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_34, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_35, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_36, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_37, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_38, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_39, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_40, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_41, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_42, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_43, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_44, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_45, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_46, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_47, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_48, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_49, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_50, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_51, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_52, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_53, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_54, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_55, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_56, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_57, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_58, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_59, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_60, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_61, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_62, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_63, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_64, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_65, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_66, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_67, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_68, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_69, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_70, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_71, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_72, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_73, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_74, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_75, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_76, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_77, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_78, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_79, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_80, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_81, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_82, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_83, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_84, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_85, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_86, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_87, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_88, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_89, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_90, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_91, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_92, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_93, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_94, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_95, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_96, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_97, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_98, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_99, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_99);
+
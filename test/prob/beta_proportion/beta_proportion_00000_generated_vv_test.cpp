@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_0> AgradDistributionsBetaProportion_vv_0;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_1> AgradDistributionsBetaProportion_vv_1;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_2> AgradDistributionsBetaProportion_vv_2;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_3> AgradDistributionsBetaProportion_vv_3;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_4> AgradDistributionsBetaProportion_vv_4;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_5> AgradDistributionsBetaProportion_vv_5;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_6> AgradDistributionsBetaProportion_vv_6;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_7> AgradDistributionsBetaProportion_vv_7;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_8> AgradDistributionsBetaProportion_vv_8;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_9> AgradDistributionsBetaProportion_vv_9;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_10> AgradDistributionsBetaProportion_vv_10;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_11> AgradDistributionsBetaProportion_vv_11;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_12> AgradDistributionsBetaProportion_vv_12;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_13> AgradDistributionsBetaProportion_vv_13;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_14> AgradDistributionsBetaProportion_vv_14;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_15> AgradDistributionsBetaProportion_vv_15;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_16> AgradDistributionsBetaProportion_vv_16;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_17> AgradDistributionsBetaProportion_vv_17;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_18> AgradDistributionsBetaProportion_vv_18;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_19> AgradDistributionsBetaProportion_vv_19;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_20> AgradDistributionsBetaProportion_vv_20;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_21> AgradDistributionsBetaProportion_vv_21;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_22> AgradDistributionsBetaProportion_vv_22;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_23> AgradDistributionsBetaProportion_vv_23;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_24> AgradDistributionsBetaProportion_vv_24;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_25> AgradDistributionsBetaProportion_vv_25;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_26> AgradDistributionsBetaProportion_vv_26;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_27> AgradDistributionsBetaProportion_vv_27;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_28> AgradDistributionsBetaProportion_vv_28;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_29> AgradDistributionsBetaProportion_vv_29;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_30> AgradDistributionsBetaProportion_vv_30;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_31> AgradDistributionsBetaProportion_vv_31;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_32> AgradDistributionsBetaProportion_vv_32;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_33> AgradDistributionsBetaProportion_vv_33;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_34> AgradDistributionsBetaProportion_vv_34;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_35> AgradDistributionsBetaProportion_vv_35;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_36> AgradDistributionsBetaProportion_vv_36;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_37> AgradDistributionsBetaProportion_vv_37;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_38> AgradDistributionsBetaProportion_vv_38;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_39> AgradDistributionsBetaProportion_vv_39;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_40> AgradDistributionsBetaProportion_vv_40;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_41> AgradDistributionsBetaProportion_vv_41;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_42> AgradDistributionsBetaProportion_vv_42;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_43> AgradDistributionsBetaProportion_vv_43;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_44> AgradDistributionsBetaProportion_vv_44;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_45> AgradDistributionsBetaProportion_vv_45;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_46> AgradDistributionsBetaProportion_vv_46;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_47> AgradDistributionsBetaProportion_vv_47;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_48> AgradDistributionsBetaProportion_vv_48;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_49> AgradDistributionsBetaProportion_vv_49;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_50> AgradDistributionsBetaProportion_vv_50;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_51> AgradDistributionsBetaProportion_vv_51;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_52> AgradDistributionsBetaProportion_vv_52;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_53> AgradDistributionsBetaProportion_vv_53;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_54> AgradDistributionsBetaProportion_vv_54;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_55> AgradDistributionsBetaProportion_vv_55;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_56> AgradDistributionsBetaProportion_vv_56;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_57> AgradDistributionsBetaProportion_vv_57;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_58> AgradDistributionsBetaProportion_vv_58;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_59> AgradDistributionsBetaProportion_vv_59;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_60> AgradDistributionsBetaProportion_vv_60;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_61> AgradDistributionsBetaProportion_vv_61;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_62> AgradDistributionsBetaProportion_vv_62;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_63> AgradDistributionsBetaProportion_vv_63;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_64> AgradDistributionsBetaProportion_vv_64;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_65> AgradDistributionsBetaProportion_vv_65;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_66> AgradDistributionsBetaProportion_vv_66;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_67> AgradDistributionsBetaProportion_vv_67;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_68> AgradDistributionsBetaProportion_vv_68;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_69> AgradDistributionsBetaProportion_vv_69;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_70> AgradDistributionsBetaProportion_vv_70;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_71> AgradDistributionsBetaProportion_vv_71;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_72> AgradDistributionsBetaProportion_vv_72;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_73> AgradDistributionsBetaProportion_vv_73;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_74> AgradDistributionsBetaProportion_vv_74;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_75> AgradDistributionsBetaProportion_vv_75;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_76> AgradDistributionsBetaProportion_vv_76;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_77> AgradDistributionsBetaProportion_vv_77;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_78> AgradDistributionsBetaProportion_vv_78;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_79> AgradDistributionsBetaProportion_vv_79;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_80> AgradDistributionsBetaProportion_vv_80;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_81> AgradDistributionsBetaProportion_vv_81;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_82> AgradDistributionsBetaProportion_vv_82;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_83> AgradDistributionsBetaProportion_vv_83;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_84> AgradDistributionsBetaProportion_vv_84;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_85> AgradDistributionsBetaProportion_vv_85;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_86> AgradDistributionsBetaProportion_vv_86;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_87> AgradDistributionsBetaProportion_vv_87;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_88> AgradDistributionsBetaProportion_vv_88;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_89> AgradDistributionsBetaProportion_vv_89;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_90> AgradDistributionsBetaProportion_vv_90;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_91> AgradDistributionsBetaProportion_vv_91;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_92> AgradDistributionsBetaProportion_vv_92;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_93> AgradDistributionsBetaProportion_vv_93;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_94> AgradDistributionsBetaProportion_vv_94;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_95> AgradDistributionsBetaProportion_vv_95;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_96> AgradDistributionsBetaProportion_vv_96;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_97> AgradDistributionsBetaProportion_vv_97;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_98> AgradDistributionsBetaProportion_vv_98;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_99> AgradDistributionsBetaProportion_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_0, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_1, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_2, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_3, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_4, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_5, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_6, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_7, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_8, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_9, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_10, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_11, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_12, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_13, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_14, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_15, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_16, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_17, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_18, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_19, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_20, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_21, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_22, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_23, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_24, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_25, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_26, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_27, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_28, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_29, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_30, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_31, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_32, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_33, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_34, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_35, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_36, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_37, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_38, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_39, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_40, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_41, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_42, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_43, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_44, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_45, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_46, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_47, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_48, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_49, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_50, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_51, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_52, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_53, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_54, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_55, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_56, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_57, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_58, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_59, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_60, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_61, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_62, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_63, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_64, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_65, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_66, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_67, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_68, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_69, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_70, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_71, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_72, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_73, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_74, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_75, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_76, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_77, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_78, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_79, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_80, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_81, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_82, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_83, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_84, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_85, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_86, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_87, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_88, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_89, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_90, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_91, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_92, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_93, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_94, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_95, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_96, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_97, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_98, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_99, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_100> AgradDistributionsBetaProportion_ffv_100;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_101> AgradDistributionsBetaProportion_ffv_101;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_102> AgradDistributionsBetaProportion_ffv_102;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_103> AgradDistributionsBetaProportion_ffv_103;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_104> AgradDistributionsBetaProportion_ffv_104;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_105> AgradDistributionsBetaProportion_ffv_105;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_106> AgradDistributionsBetaProportion_ffv_106;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_107> AgradDistributionsBetaProportion_ffv_107;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_108> AgradDistributionsBetaProportion_ffv_108;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_109> AgradDistributionsBetaProportion_ffv_109;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_110> AgradDistributionsBetaProportion_ffv_110;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_111> AgradDistributionsBetaProportion_ffv_111;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_112> AgradDistributionsBetaProportion_ffv_112;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_113> AgradDistributionsBetaProportion_ffv_113;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_114> AgradDistributionsBetaProportion_ffv_114;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_115> AgradDistributionsBetaProportion_ffv_115;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_116> AgradDistributionsBetaProportion_ffv_116;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_117> AgradDistributionsBetaProportion_ffv_117;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_118> AgradDistributionsBetaProportion_ffv_118;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_119> AgradDistributionsBetaProportion_ffv_119;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_120> AgradDistributionsBetaProportion_ffv_120;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_121> AgradDistributionsBetaProportion_ffv_121;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_122> AgradDistributionsBetaProportion_ffv_122;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_123> AgradDistributionsBetaProportion_ffv_123;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_124> AgradDistributionsBetaProportion_ffv_124;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_125> AgradDistributionsBetaProportion_ffv_125;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_126> AgradDistributionsBetaProportion_ffv_126;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_127> AgradDistributionsBetaProportion_ffv_127;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_128> AgradDistributionsBetaProportion_ffv_128;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_129> AgradDistributionsBetaProportion_ffv_129;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_130> AgradDistributionsBetaProportion_ffv_130;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_131> AgradDistributionsBetaProportion_ffv_131;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_132> AgradDistributionsBetaProportion_ffv_132;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_133> AgradDistributionsBetaProportion_ffv_133;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_134> AgradDistributionsBetaProportion_ffv_134;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_135> AgradDistributionsBetaProportion_ffv_135;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_136> AgradDistributionsBetaProportion_ffv_136;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_137> AgradDistributionsBetaProportion_ffv_137;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_138> AgradDistributionsBetaProportion_ffv_138;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_139> AgradDistributionsBetaProportion_ffv_139;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_140> AgradDistributionsBetaProportion_ffv_140;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_141> AgradDistributionsBetaProportion_ffv_141;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_142> AgradDistributionsBetaProportion_ffv_142;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_143> AgradDistributionsBetaProportion_ffv_143;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_144> AgradDistributionsBetaProportion_ffv_144;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_145> AgradDistributionsBetaProportion_ffv_145;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_146> AgradDistributionsBetaProportion_ffv_146;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_147> AgradDistributionsBetaProportion_ffv_147;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_148> AgradDistributionsBetaProportion_ffv_148;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_149> AgradDistributionsBetaProportion_ffv_149;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_150> AgradDistributionsBetaProportion_ffv_150;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_151> AgradDistributionsBetaProportion_ffv_151;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_152> AgradDistributionsBetaProportion_ffv_152;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_153> AgradDistributionsBetaProportion_ffv_153;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_154> AgradDistributionsBetaProportion_ffv_154;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_155> AgradDistributionsBetaProportion_ffv_155;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_156> AgradDistributionsBetaProportion_ffv_156;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_157> AgradDistributionsBetaProportion_ffv_157;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_158> AgradDistributionsBetaProportion_ffv_158;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_159> AgradDistributionsBetaProportion_ffv_159;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_160> AgradDistributionsBetaProportion_ffv_160;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_161> AgradDistributionsBetaProportion_ffv_161;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_162> AgradDistributionsBetaProportion_ffv_162;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_163> AgradDistributionsBetaProportion_ffv_163;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_164> AgradDistributionsBetaProportion_ffv_164;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_165> AgradDistributionsBetaProportion_ffv_165;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_166> AgradDistributionsBetaProportion_ffv_166;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_167> AgradDistributionsBetaProportion_ffv_167;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_168> AgradDistributionsBetaProportion_ffv_168;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_169> AgradDistributionsBetaProportion_ffv_169;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_170> AgradDistributionsBetaProportion_ffv_170;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_171> AgradDistributionsBetaProportion_ffv_171;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_172> AgradDistributionsBetaProportion_ffv_172;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_173> AgradDistributionsBetaProportion_ffv_173;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_174> AgradDistributionsBetaProportion_ffv_174;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_175> AgradDistributionsBetaProportion_ffv_175;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_176> AgradDistributionsBetaProportion_ffv_176;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_177> AgradDistributionsBetaProportion_ffv_177;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_178> AgradDistributionsBetaProportion_ffv_178;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_179> AgradDistributionsBetaProportion_ffv_179;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_180> AgradDistributionsBetaProportion_ffv_180;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_181> AgradDistributionsBetaProportion_ffv_181;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_182> AgradDistributionsBetaProportion_ffv_182;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_183> AgradDistributionsBetaProportion_ffv_183;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_184> AgradDistributionsBetaProportion_ffv_184;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_185> AgradDistributionsBetaProportion_ffv_185;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_186> AgradDistributionsBetaProportion_ffv_186;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_187> AgradDistributionsBetaProportion_ffv_187;
+typedef std::tuple<AgradDistributionsBetaProportion, type_ffv_188> AgradDistributionsBetaProportion_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_100, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_101, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_102, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_103, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_104, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_105, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_106, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_107, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_108, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_109, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_110, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_111, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_112, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_113, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_114, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_115, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_116, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_117, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_118, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_119, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_120, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_121, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_122, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_123, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_124, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_125, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_126, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_127, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_128, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_129, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_130, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_131, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_132, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_133, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_134, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_135, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_136, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_137, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_138, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_139, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_140, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_141, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_142, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_143, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_144, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_145, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_146, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_147, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_148, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_149, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_150, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_151, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_152, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_153, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_154, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_155, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_156, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_157, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_158, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_159, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_160, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_161, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_162, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_163, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_164, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_165, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_166, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_167, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_168, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_169, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_170, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_171, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_172, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_173, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_174, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_175, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_176, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_177, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_178, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_179, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_180, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_181, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_182, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_183, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_184, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_185, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_186, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_187, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_ffv_188, AgradDistributionTestFixture, AgradDistributionsBetaProportion_ffv_188);
+
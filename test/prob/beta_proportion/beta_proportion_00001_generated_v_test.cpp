@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_100> AgradDistributionsBetaProportion_v_100;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_101> AgradDistributionsBetaProportion_v_101;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_102> AgradDistributionsBetaProportion_v_102;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_103> AgradDistributionsBetaProportion_v_103;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_104> AgradDistributionsBetaProportion_v_104;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_105> AgradDistributionsBetaProportion_v_105;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_106> AgradDistributionsBetaProportion_v_106;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_107> AgradDistributionsBetaProportion_v_107;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_108> AgradDistributionsBetaProportion_v_108;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_109> AgradDistributionsBetaProportion_v_109;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_110> AgradDistributionsBetaProportion_v_110;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_111> AgradDistributionsBetaProportion_v_111;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_112> AgradDistributionsBetaProportion_v_112;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_113> AgradDistributionsBetaProportion_v_113;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_114> AgradDistributionsBetaProportion_v_114;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_115> AgradDistributionsBetaProportion_v_115;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_116> AgradDistributionsBetaProportion_v_116;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_117> AgradDistributionsBetaProportion_v_117;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_118> AgradDistributionsBetaProportion_v_118;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_119> AgradDistributionsBetaProportion_v_119;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_120> AgradDistributionsBetaProportion_v_120;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_121> AgradDistributionsBetaProportion_v_121;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_122> AgradDistributionsBetaProportion_v_122;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_123> AgradDistributionsBetaProportion_v_123;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_124> AgradDistributionsBetaProportion_v_124;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_125> AgradDistributionsBetaProportion_v_125;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_126> AgradDistributionsBetaProportion_v_126;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_127> AgradDistributionsBetaProportion_v_127;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_128> AgradDistributionsBetaProportion_v_128;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_129> AgradDistributionsBetaProportion_v_129;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_130> AgradDistributionsBetaProportion_v_130;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_131> AgradDistributionsBetaProportion_v_131;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_132> AgradDistributionsBetaProportion_v_132;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_133> AgradDistributionsBetaProportion_v_133;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_134> AgradDistributionsBetaProportion_v_134;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_135> AgradDistributionsBetaProportion_v_135;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_136> AgradDistributionsBetaProportion_v_136;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_137> AgradDistributionsBetaProportion_v_137;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_138> AgradDistributionsBetaProportion_v_138;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_139> AgradDistributionsBetaProportion_v_139;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_140> AgradDistributionsBetaProportion_v_140;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_141> AgradDistributionsBetaProportion_v_141;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_142> AgradDistributionsBetaProportion_v_142;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_143> AgradDistributionsBetaProportion_v_143;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_144> AgradDistributionsBetaProportion_v_144;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_145> AgradDistributionsBetaProportion_v_145;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_146> AgradDistributionsBetaProportion_v_146;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_147> AgradDistributionsBetaProportion_v_147;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_148> AgradDistributionsBetaProportion_v_148;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_149> AgradDistributionsBetaProportion_v_149;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_150> AgradDistributionsBetaProportion_v_150;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_151> AgradDistributionsBetaProportion_v_151;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_152> AgradDistributionsBetaProportion_v_152;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_153> AgradDistributionsBetaProportion_v_153;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_154> AgradDistributionsBetaProportion_v_154;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_155> AgradDistributionsBetaProportion_v_155;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_156> AgradDistributionsBetaProportion_v_156;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_157> AgradDistributionsBetaProportion_v_157;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_158> AgradDistributionsBetaProportion_v_158;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_159> AgradDistributionsBetaProportion_v_159;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_160> AgradDistributionsBetaProportion_v_160;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_161> AgradDistributionsBetaProportion_v_161;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_162> AgradDistributionsBetaProportion_v_162;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_163> AgradDistributionsBetaProportion_v_163;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_164> AgradDistributionsBetaProportion_v_164;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_165> AgradDistributionsBetaProportion_v_165;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_166> AgradDistributionsBetaProportion_v_166;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_167> AgradDistributionsBetaProportion_v_167;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_168> AgradDistributionsBetaProportion_v_168;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_169> AgradDistributionsBetaProportion_v_169;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_170> AgradDistributionsBetaProportion_v_170;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_171> AgradDistributionsBetaProportion_v_171;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_172> AgradDistributionsBetaProportion_v_172;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_173> AgradDistributionsBetaProportion_v_173;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_174> AgradDistributionsBetaProportion_v_174;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_175> AgradDistributionsBetaProportion_v_175;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_176> AgradDistributionsBetaProportion_v_176;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_177> AgradDistributionsBetaProportion_v_177;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_178> AgradDistributionsBetaProportion_v_178;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_179> AgradDistributionsBetaProportion_v_179;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_180> AgradDistributionsBetaProportion_v_180;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_181> AgradDistributionsBetaProportion_v_181;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_182> AgradDistributionsBetaProportion_v_182;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_183> AgradDistributionsBetaProportion_v_183;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_184> AgradDistributionsBetaProportion_v_184;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_185> AgradDistributionsBetaProportion_v_185;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_186> AgradDistributionsBetaProportion_v_186;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_187> AgradDistributionsBetaProportion_v_187;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_188> AgradDistributionsBetaProportion_v_188;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_189> AgradDistributionsBetaProportion_v_189;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_190> AgradDistributionsBetaProportion_v_190;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_191> AgradDistributionsBetaProportion_v_191;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_192> AgradDistributionsBetaProportion_v_192;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_193> AgradDistributionsBetaProportion_v_193;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_194> AgradDistributionsBetaProportion_v_194;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_195> AgradDistributionsBetaProportion_v_195;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_196> AgradDistributionsBetaProportion_v_196;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_197> AgradDistributionsBetaProportion_v_197;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_198> AgradDistributionsBetaProportion_v_198;
+typedef std::tuple<AgradDistributionsBetaProportion, type_v_199> AgradDistributionsBetaProportion_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_100, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_101, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_102, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_103, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_104, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_105, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_106, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_107, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_108, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_109, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_110, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_111, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_112, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_113, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_114, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_115, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_116, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_117, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_118, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_119, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_120, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_121, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_122, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_123, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_124, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_125, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_126, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_127, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_128, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_129, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_130, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_131, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_132, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_133, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_134, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_135, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_136, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_137, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_138, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_139, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_140, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_141, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_142, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_143, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_144, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_145, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_146, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_147, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_148, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_149, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_150, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_151, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_152, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_153, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_154, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_155, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_156, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_157, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_158, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_159, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_160, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_161, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_162, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_163, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_164, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_165, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_166, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_167, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_168, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_169, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_170, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_171, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_172, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_173, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_174, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_175, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_176, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_177, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_178, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_179, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_180, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_181, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_182, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_183, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_184, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_185, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_186, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_187, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_188, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_189, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_190, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_191, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_192, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_193, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_194, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_195, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_196, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_197, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_198, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_v_199, AgradDistributionTestFixture, AgradDistributionsBetaProportion_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_100> AgradDistributionsBetaProportion_vv_100;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_101> AgradDistributionsBetaProportion_vv_101;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_102> AgradDistributionsBetaProportion_vv_102;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_103> AgradDistributionsBetaProportion_vv_103;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_104> AgradDistributionsBetaProportion_vv_104;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_105> AgradDistributionsBetaProportion_vv_105;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_106> AgradDistributionsBetaProportion_vv_106;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_107> AgradDistributionsBetaProportion_vv_107;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_108> AgradDistributionsBetaProportion_vv_108;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_109> AgradDistributionsBetaProportion_vv_109;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_110> AgradDistributionsBetaProportion_vv_110;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_111> AgradDistributionsBetaProportion_vv_111;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_112> AgradDistributionsBetaProportion_vv_112;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_113> AgradDistributionsBetaProportion_vv_113;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_114> AgradDistributionsBetaProportion_vv_114;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_115> AgradDistributionsBetaProportion_vv_115;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_116> AgradDistributionsBetaProportion_vv_116;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_117> AgradDistributionsBetaProportion_vv_117;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_118> AgradDistributionsBetaProportion_vv_118;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_119> AgradDistributionsBetaProportion_vv_119;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_120> AgradDistributionsBetaProportion_vv_120;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_121> AgradDistributionsBetaProportion_vv_121;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_122> AgradDistributionsBetaProportion_vv_122;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_123> AgradDistributionsBetaProportion_vv_123;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_124> AgradDistributionsBetaProportion_vv_124;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_125> AgradDistributionsBetaProportion_vv_125;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_126> AgradDistributionsBetaProportion_vv_126;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_127> AgradDistributionsBetaProportion_vv_127;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_128> AgradDistributionsBetaProportion_vv_128;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_129> AgradDistributionsBetaProportion_vv_129;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_130> AgradDistributionsBetaProportion_vv_130;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_131> AgradDistributionsBetaProportion_vv_131;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_132> AgradDistributionsBetaProportion_vv_132;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_133> AgradDistributionsBetaProportion_vv_133;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_134> AgradDistributionsBetaProportion_vv_134;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_135> AgradDistributionsBetaProportion_vv_135;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_136> AgradDistributionsBetaProportion_vv_136;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_137> AgradDistributionsBetaProportion_vv_137;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_138> AgradDistributionsBetaProportion_vv_138;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_139> AgradDistributionsBetaProportion_vv_139;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_140> AgradDistributionsBetaProportion_vv_140;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_141> AgradDistributionsBetaProportion_vv_141;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_142> AgradDistributionsBetaProportion_vv_142;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_143> AgradDistributionsBetaProportion_vv_143;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_144> AgradDistributionsBetaProportion_vv_144;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_145> AgradDistributionsBetaProportion_vv_145;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_146> AgradDistributionsBetaProportion_vv_146;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_147> AgradDistributionsBetaProportion_vv_147;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_148> AgradDistributionsBetaProportion_vv_148;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_149> AgradDistributionsBetaProportion_vv_149;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_150> AgradDistributionsBetaProportion_vv_150;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_151> AgradDistributionsBetaProportion_vv_151;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_152> AgradDistributionsBetaProportion_vv_152;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_153> AgradDistributionsBetaProportion_vv_153;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_154> AgradDistributionsBetaProportion_vv_154;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_155> AgradDistributionsBetaProportion_vv_155;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_156> AgradDistributionsBetaProportion_vv_156;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_157> AgradDistributionsBetaProportion_vv_157;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_158> AgradDistributionsBetaProportion_vv_158;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_159> AgradDistributionsBetaProportion_vv_159;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_160> AgradDistributionsBetaProportion_vv_160;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_161> AgradDistributionsBetaProportion_vv_161;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_162> AgradDistributionsBetaProportion_vv_162;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_163> AgradDistributionsBetaProportion_vv_163;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_164> AgradDistributionsBetaProportion_vv_164;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_165> AgradDistributionsBetaProportion_vv_165;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_166> AgradDistributionsBetaProportion_vv_166;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_167> AgradDistributionsBetaProportion_vv_167;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_168> AgradDistributionsBetaProportion_vv_168;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_169> AgradDistributionsBetaProportion_vv_169;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_170> AgradDistributionsBetaProportion_vv_170;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_171> AgradDistributionsBetaProportion_vv_171;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_172> AgradDistributionsBetaProportion_vv_172;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_173> AgradDistributionsBetaProportion_vv_173;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_174> AgradDistributionsBetaProportion_vv_174;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_175> AgradDistributionsBetaProportion_vv_175;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_176> AgradDistributionsBetaProportion_vv_176;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_177> AgradDistributionsBetaProportion_vv_177;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_178> AgradDistributionsBetaProportion_vv_178;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_179> AgradDistributionsBetaProportion_vv_179;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_180> AgradDistributionsBetaProportion_vv_180;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_181> AgradDistributionsBetaProportion_vv_181;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_182> AgradDistributionsBetaProportion_vv_182;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_183> AgradDistributionsBetaProportion_vv_183;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_184> AgradDistributionsBetaProportion_vv_184;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_185> AgradDistributionsBetaProportion_vv_185;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_186> AgradDistributionsBetaProportion_vv_186;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_187> AgradDistributionsBetaProportion_vv_187;
+typedef std::tuple<AgradDistributionsBetaProportion, type_vv_188> AgradDistributionsBetaProportion_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_100, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_101, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_102, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_103, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_104, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_105, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_106, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_107, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_108, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_109, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_110, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_111, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_112, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_113, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_114, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_115, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_116, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_117, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_118, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_119, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_120, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_121, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_122, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_123, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_124, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_125, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_126, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_127, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_128, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_129, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_130, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_131, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_132, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_133, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_134, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_135, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_136, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_137, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_138, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_139, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_140, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_141, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_142, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_143, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_144, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_145, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_146, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_147, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_148, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_149, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_150, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_151, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_152, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_153, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_154, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_155, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_156, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_157, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_158, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_159, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_160, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_161, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_162, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_163, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_164, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_165, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_166, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_167, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_168, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_169, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_170, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_171, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_172, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_173, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_174, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_175, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_176, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_177, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_178, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_179, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_180, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_181, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_182, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_183, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_184, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_185, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_186, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_187, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBetaProportion_vv_188, AgradDistributionTestFixture, AgradDistributionsBetaProportion_vv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_0> AgradCcdfLogBetaProportion_ffv_0;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_1> AgradCcdfLogBetaProportion_ffv_1;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_2> AgradCcdfLogBetaProportion_ffv_2;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_3> AgradCcdfLogBetaProportion_ffv_3;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_4> AgradCcdfLogBetaProportion_ffv_4;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_5> AgradCcdfLogBetaProportion_ffv_5;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_6> AgradCcdfLogBetaProportion_ffv_6;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_7> AgradCcdfLogBetaProportion_ffv_7;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_8> AgradCcdfLogBetaProportion_ffv_8;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_9> AgradCcdfLogBetaProportion_ffv_9;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_10> AgradCcdfLogBetaProportion_ffv_10;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_11> AgradCcdfLogBetaProportion_ffv_11;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_12> AgradCcdfLogBetaProportion_ffv_12;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_13> AgradCcdfLogBetaProportion_ffv_13;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_14> AgradCcdfLogBetaProportion_ffv_14;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_15> AgradCcdfLogBetaProportion_ffv_15;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_16> AgradCcdfLogBetaProportion_ffv_16;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_17> AgradCcdfLogBetaProportion_ffv_17;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_18> AgradCcdfLogBetaProportion_ffv_18;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_19> AgradCcdfLogBetaProportion_ffv_19;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_20> AgradCcdfLogBetaProportion_ffv_20;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_21> AgradCcdfLogBetaProportion_ffv_21;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_22> AgradCcdfLogBetaProportion_ffv_22;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_23> AgradCcdfLogBetaProportion_ffv_23;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_24> AgradCcdfLogBetaProportion_ffv_24;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_25> AgradCcdfLogBetaProportion_ffv_25;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_26> AgradCcdfLogBetaProportion_ffv_26;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_27> AgradCcdfLogBetaProportion_ffv_27;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_28> AgradCcdfLogBetaProportion_ffv_28;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_29> AgradCcdfLogBetaProportion_ffv_29;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_30> AgradCcdfLogBetaProportion_ffv_30;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_31> AgradCcdfLogBetaProportion_ffv_31;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_32> AgradCcdfLogBetaProportion_ffv_32;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_33> AgradCcdfLogBetaProportion_ffv_33;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_34> AgradCcdfLogBetaProportion_ffv_34;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_35> AgradCcdfLogBetaProportion_ffv_35;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_36> AgradCcdfLogBetaProportion_ffv_36;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_37> AgradCcdfLogBetaProportion_ffv_37;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_38> AgradCcdfLogBetaProportion_ffv_38;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_39> AgradCcdfLogBetaProportion_ffv_39;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_40> AgradCcdfLogBetaProportion_ffv_40;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_41> AgradCcdfLogBetaProportion_ffv_41;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_42> AgradCcdfLogBetaProportion_ffv_42;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_43> AgradCcdfLogBetaProportion_ffv_43;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_44> AgradCcdfLogBetaProportion_ffv_44;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_45> AgradCcdfLogBetaProportion_ffv_45;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_46> AgradCcdfLogBetaProportion_ffv_46;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_47> AgradCcdfLogBetaProportion_ffv_47;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_48> AgradCcdfLogBetaProportion_ffv_48;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_49> AgradCcdfLogBetaProportion_ffv_49;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_50> AgradCcdfLogBetaProportion_ffv_50;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_51> AgradCcdfLogBetaProportion_ffv_51;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_52> AgradCcdfLogBetaProportion_ffv_52;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_53> AgradCcdfLogBetaProportion_ffv_53;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_54> AgradCcdfLogBetaProportion_ffv_54;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_55> AgradCcdfLogBetaProportion_ffv_55;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_56> AgradCcdfLogBetaProportion_ffv_56;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_57> AgradCcdfLogBetaProportion_ffv_57;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_58> AgradCcdfLogBetaProportion_ffv_58;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_59> AgradCcdfLogBetaProportion_ffv_59;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_60> AgradCcdfLogBetaProportion_ffv_60;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_61> AgradCcdfLogBetaProportion_ffv_61;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_62> AgradCcdfLogBetaProportion_ffv_62;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_63> AgradCcdfLogBetaProportion_ffv_63;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_64> AgradCcdfLogBetaProportion_ffv_64;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_65> AgradCcdfLogBetaProportion_ffv_65;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_66> AgradCcdfLogBetaProportion_ffv_66;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_67> AgradCcdfLogBetaProportion_ffv_67;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_68> AgradCcdfLogBetaProportion_ffv_68;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_69> AgradCcdfLogBetaProportion_ffv_69;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_70> AgradCcdfLogBetaProportion_ffv_70;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_71> AgradCcdfLogBetaProportion_ffv_71;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_72> AgradCcdfLogBetaProportion_ffv_72;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_73> AgradCcdfLogBetaProportion_ffv_73;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_74> AgradCcdfLogBetaProportion_ffv_74;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_75> AgradCcdfLogBetaProportion_ffv_75;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_76> AgradCcdfLogBetaProportion_ffv_76;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_77> AgradCcdfLogBetaProportion_ffv_77;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_78> AgradCcdfLogBetaProportion_ffv_78;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_79> AgradCcdfLogBetaProportion_ffv_79;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_80> AgradCcdfLogBetaProportion_ffv_80;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_81> AgradCcdfLogBetaProportion_ffv_81;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_82> AgradCcdfLogBetaProportion_ffv_82;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_83> AgradCcdfLogBetaProportion_ffv_83;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_84> AgradCcdfLogBetaProportion_ffv_84;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_85> AgradCcdfLogBetaProportion_ffv_85;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_86> AgradCcdfLogBetaProportion_ffv_86;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_87> AgradCcdfLogBetaProportion_ffv_87;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_88> AgradCcdfLogBetaProportion_ffv_88;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_89> AgradCcdfLogBetaProportion_ffv_89;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_90> AgradCcdfLogBetaProportion_ffv_90;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_91> AgradCcdfLogBetaProportion_ffv_91;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_92> AgradCcdfLogBetaProportion_ffv_92;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_93> AgradCcdfLogBetaProportion_ffv_93;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_94> AgradCcdfLogBetaProportion_ffv_94;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_95> AgradCcdfLogBetaProportion_ffv_95;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_96> AgradCcdfLogBetaProportion_ffv_96;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_97> AgradCcdfLogBetaProportion_ffv_97;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_98> AgradCcdfLogBetaProportion_ffv_98;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_99> AgradCcdfLogBetaProportion_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_0> AgradCcdfLogBetaProportion_v_0;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_1> AgradCcdfLogBetaProportion_v_1;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_2> AgradCcdfLogBetaProportion_v_2;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_3> AgradCcdfLogBetaProportion_v_3;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_4> AgradCcdfLogBetaProportion_v_4;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_5> AgradCcdfLogBetaProportion_v_5;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_6> AgradCcdfLogBetaProportion_v_6;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_7> AgradCcdfLogBetaProportion_v_7;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_8> AgradCcdfLogBetaProportion_v_8;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_9> AgradCcdfLogBetaProportion_v_9;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_10> AgradCcdfLogBetaProportion_v_10;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_11> AgradCcdfLogBetaProportion_v_11;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_12> AgradCcdfLogBetaProportion_v_12;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_13> AgradCcdfLogBetaProportion_v_13;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_14> AgradCcdfLogBetaProportion_v_14;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_15> AgradCcdfLogBetaProportion_v_15;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_16> AgradCcdfLogBetaProportion_v_16;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_17> AgradCcdfLogBetaProportion_v_17;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_18> AgradCcdfLogBetaProportion_v_18;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_19> AgradCcdfLogBetaProportion_v_19;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_20> AgradCcdfLogBetaProportion_v_20;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_21> AgradCcdfLogBetaProportion_v_21;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_22> AgradCcdfLogBetaProportion_v_22;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_23> AgradCcdfLogBetaProportion_v_23;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_24> AgradCcdfLogBetaProportion_v_24;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_25> AgradCcdfLogBetaProportion_v_25;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_26> AgradCcdfLogBetaProportion_v_26;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_27> AgradCcdfLogBetaProportion_v_27;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_28> AgradCcdfLogBetaProportion_v_28;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_29> AgradCcdfLogBetaProportion_v_29;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_30> AgradCcdfLogBetaProportion_v_30;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_31> AgradCcdfLogBetaProportion_v_31;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_32> AgradCcdfLogBetaProportion_v_32;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_33> AgradCcdfLogBetaProportion_v_33;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_34> AgradCcdfLogBetaProportion_v_34;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_35> AgradCcdfLogBetaProportion_v_35;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_36> AgradCcdfLogBetaProportion_v_36;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_37> AgradCcdfLogBetaProportion_v_37;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_38> AgradCcdfLogBetaProportion_v_38;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_39> AgradCcdfLogBetaProportion_v_39;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_40> AgradCcdfLogBetaProportion_v_40;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_41> AgradCcdfLogBetaProportion_v_41;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_42> AgradCcdfLogBetaProportion_v_42;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_43> AgradCcdfLogBetaProportion_v_43;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_44> AgradCcdfLogBetaProportion_v_44;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_45> AgradCcdfLogBetaProportion_v_45;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_46> AgradCcdfLogBetaProportion_v_46;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_47> AgradCcdfLogBetaProportion_v_47;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_48> AgradCcdfLogBetaProportion_v_48;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_49> AgradCcdfLogBetaProportion_v_49;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_50> AgradCcdfLogBetaProportion_v_50;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_51> AgradCcdfLogBetaProportion_v_51;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_52> AgradCcdfLogBetaProportion_v_52;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_53> AgradCcdfLogBetaProportion_v_53;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_54> AgradCcdfLogBetaProportion_v_54;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_55> AgradCcdfLogBetaProportion_v_55;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_56> AgradCcdfLogBetaProportion_v_56;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_57> AgradCcdfLogBetaProportion_v_57;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_58> AgradCcdfLogBetaProportion_v_58;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_59> AgradCcdfLogBetaProportion_v_59;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_60> AgradCcdfLogBetaProportion_v_60;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_61> AgradCcdfLogBetaProportion_v_61;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_62> AgradCcdfLogBetaProportion_v_62;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_63> AgradCcdfLogBetaProportion_v_63;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_64> AgradCcdfLogBetaProportion_v_64;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_65> AgradCcdfLogBetaProportion_v_65;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_66> AgradCcdfLogBetaProportion_v_66;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_67> AgradCcdfLogBetaProportion_v_67;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_68> AgradCcdfLogBetaProportion_v_68;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_69> AgradCcdfLogBetaProportion_v_69;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_70> AgradCcdfLogBetaProportion_v_70;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_71> AgradCcdfLogBetaProportion_v_71;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_72> AgradCcdfLogBetaProportion_v_72;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_73> AgradCcdfLogBetaProportion_v_73;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_74> AgradCcdfLogBetaProportion_v_74;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_75> AgradCcdfLogBetaProportion_v_75;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_76> AgradCcdfLogBetaProportion_v_76;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_77> AgradCcdfLogBetaProportion_v_77;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_78> AgradCcdfLogBetaProportion_v_78;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_79> AgradCcdfLogBetaProportion_v_79;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_80> AgradCcdfLogBetaProportion_v_80;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_81> AgradCcdfLogBetaProportion_v_81;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_82> AgradCcdfLogBetaProportion_v_82;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_83> AgradCcdfLogBetaProportion_v_83;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_84> AgradCcdfLogBetaProportion_v_84;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_85> AgradCcdfLogBetaProportion_v_85;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_86> AgradCcdfLogBetaProportion_v_86;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_87> AgradCcdfLogBetaProportion_v_87;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_88> AgradCcdfLogBetaProportion_v_88;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_89> AgradCcdfLogBetaProportion_v_89;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_90> AgradCcdfLogBetaProportion_v_90;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_91> AgradCcdfLogBetaProportion_v_91;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_92> AgradCcdfLogBetaProportion_v_92;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_93> AgradCcdfLogBetaProportion_v_93;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_94> AgradCcdfLogBetaProportion_v_94;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_95> AgradCcdfLogBetaProportion_v_95;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_96> AgradCcdfLogBetaProportion_v_96;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_97> AgradCcdfLogBetaProportion_v_97;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_98> AgradCcdfLogBetaProportion_v_98;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_99> AgradCcdfLogBetaProportion_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_0, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_1, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_2, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_3, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_4, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_5, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_6, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_7, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_8, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_9, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_10, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_11, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_12, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_13, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_14, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_15, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_16, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_17, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_18, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_19, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_20, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_21, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_22, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_23, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_24, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_25, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_26, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_27, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_28, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_29, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_30, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_31, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_32, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_33, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_34, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_35, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_36, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_37, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_38, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_39, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_40, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_41, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_42, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_43, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_44, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_45, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_46, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_47, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_48, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_49, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_50, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_51, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_52, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_53, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_54, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_55, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_56, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_57, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_58, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_59, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_60, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_61, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_62, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_63, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_64, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_65, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_66, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_67, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_68, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_69, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_70, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_71, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_72, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_73, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_74, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_75, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_76, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_77, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_78, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_79, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_80, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_81, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_82, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_83, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_84, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_85, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_86, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_87, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_88, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_89, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_90, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_91, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_92, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_93, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_94, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_95, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_96, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_97, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_98, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_99, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_99);
+
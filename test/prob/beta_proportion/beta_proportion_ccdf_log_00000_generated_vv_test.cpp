@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_0> AgradCcdfLogBetaProportion_vv_0;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_1> AgradCcdfLogBetaProportion_vv_1;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_2> AgradCcdfLogBetaProportion_vv_2;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_3> AgradCcdfLogBetaProportion_vv_3;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_4> AgradCcdfLogBetaProportion_vv_4;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_5> AgradCcdfLogBetaProportion_vv_5;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_6> AgradCcdfLogBetaProportion_vv_6;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_7> AgradCcdfLogBetaProportion_vv_7;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_8> AgradCcdfLogBetaProportion_vv_8;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_9> AgradCcdfLogBetaProportion_vv_9;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_10> AgradCcdfLogBetaProportion_vv_10;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_11> AgradCcdfLogBetaProportion_vv_11;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_12> AgradCcdfLogBetaProportion_vv_12;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_13> AgradCcdfLogBetaProportion_vv_13;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_14> AgradCcdfLogBetaProportion_vv_14;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_15> AgradCcdfLogBetaProportion_vv_15;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_16> AgradCcdfLogBetaProportion_vv_16;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_17> AgradCcdfLogBetaProportion_vv_17;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_18> AgradCcdfLogBetaProportion_vv_18;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_19> AgradCcdfLogBetaProportion_vv_19;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_20> AgradCcdfLogBetaProportion_vv_20;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_21> AgradCcdfLogBetaProportion_vv_21;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_22> AgradCcdfLogBetaProportion_vv_22;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_23> AgradCcdfLogBetaProportion_vv_23;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_24> AgradCcdfLogBetaProportion_vv_24;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_25> AgradCcdfLogBetaProportion_vv_25;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_26> AgradCcdfLogBetaProportion_vv_26;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_27> AgradCcdfLogBetaProportion_vv_27;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_28> AgradCcdfLogBetaProportion_vv_28;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_29> AgradCcdfLogBetaProportion_vv_29;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_30> AgradCcdfLogBetaProportion_vv_30;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_31> AgradCcdfLogBetaProportion_vv_31;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_32> AgradCcdfLogBetaProportion_vv_32;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_33> AgradCcdfLogBetaProportion_vv_33;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_34> AgradCcdfLogBetaProportion_vv_34;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_35> AgradCcdfLogBetaProportion_vv_35;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_36> AgradCcdfLogBetaProportion_vv_36;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_37> AgradCcdfLogBetaProportion_vv_37;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_38> AgradCcdfLogBetaProportion_vv_38;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_39> AgradCcdfLogBetaProportion_vv_39;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_40> AgradCcdfLogBetaProportion_vv_40;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_41> AgradCcdfLogBetaProportion_vv_41;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_42> AgradCcdfLogBetaProportion_vv_42;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_43> AgradCcdfLogBetaProportion_vv_43;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_44> AgradCcdfLogBetaProportion_vv_44;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_45> AgradCcdfLogBetaProportion_vv_45;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_46> AgradCcdfLogBetaProportion_vv_46;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_47> AgradCcdfLogBetaProportion_vv_47;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_48> AgradCcdfLogBetaProportion_vv_48;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_49> AgradCcdfLogBetaProportion_vv_49;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_50> AgradCcdfLogBetaProportion_vv_50;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_51> AgradCcdfLogBetaProportion_vv_51;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_52> AgradCcdfLogBetaProportion_vv_52;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_53> AgradCcdfLogBetaProportion_vv_53;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_54> AgradCcdfLogBetaProportion_vv_54;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_55> AgradCcdfLogBetaProportion_vv_55;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_56> AgradCcdfLogBetaProportion_vv_56;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_57> AgradCcdfLogBetaProportion_vv_57;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_58> AgradCcdfLogBetaProportion_vv_58;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_59> AgradCcdfLogBetaProportion_vv_59;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_60> AgradCcdfLogBetaProportion_vv_60;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_61> AgradCcdfLogBetaProportion_vv_61;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_62> AgradCcdfLogBetaProportion_vv_62;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_63> AgradCcdfLogBetaProportion_vv_63;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_64> AgradCcdfLogBetaProportion_vv_64;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_65> AgradCcdfLogBetaProportion_vv_65;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_66> AgradCcdfLogBetaProportion_vv_66;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_67> AgradCcdfLogBetaProportion_vv_67;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_68> AgradCcdfLogBetaProportion_vv_68;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_69> AgradCcdfLogBetaProportion_vv_69;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_70> AgradCcdfLogBetaProportion_vv_70;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_71> AgradCcdfLogBetaProportion_vv_71;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_72> AgradCcdfLogBetaProportion_vv_72;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_73> AgradCcdfLogBetaProportion_vv_73;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_74> AgradCcdfLogBetaProportion_vv_74;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_75> AgradCcdfLogBetaProportion_vv_75;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_76> AgradCcdfLogBetaProportion_vv_76;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_77> AgradCcdfLogBetaProportion_vv_77;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_78> AgradCcdfLogBetaProportion_vv_78;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_79> AgradCcdfLogBetaProportion_vv_79;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_80> AgradCcdfLogBetaProportion_vv_80;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_81> AgradCcdfLogBetaProportion_vv_81;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_82> AgradCcdfLogBetaProportion_vv_82;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_83> AgradCcdfLogBetaProportion_vv_83;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_84> AgradCcdfLogBetaProportion_vv_84;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_85> AgradCcdfLogBetaProportion_vv_85;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_86> AgradCcdfLogBetaProportion_vv_86;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_87> AgradCcdfLogBetaProportion_vv_87;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_88> AgradCcdfLogBetaProportion_vv_88;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_89> AgradCcdfLogBetaProportion_vv_89;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_90> AgradCcdfLogBetaProportion_vv_90;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_91> AgradCcdfLogBetaProportion_vv_91;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_92> AgradCcdfLogBetaProportion_vv_92;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_93> AgradCcdfLogBetaProportion_vv_93;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_94> AgradCcdfLogBetaProportion_vv_94;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_95> AgradCcdfLogBetaProportion_vv_95;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_96> AgradCcdfLogBetaProportion_vv_96;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_97> AgradCcdfLogBetaProportion_vv_97;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_98> AgradCcdfLogBetaProportion_vv_98;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_99> AgradCcdfLogBetaProportion_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_100> AgradCcdfLogBetaProportion_ffv_100;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_101> AgradCcdfLogBetaProportion_ffv_101;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_102> AgradCcdfLogBetaProportion_ffv_102;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_103> AgradCcdfLogBetaProportion_ffv_103;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_104> AgradCcdfLogBetaProportion_ffv_104;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_105> AgradCcdfLogBetaProportion_ffv_105;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_106> AgradCcdfLogBetaProportion_ffv_106;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_107> AgradCcdfLogBetaProportion_ffv_107;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_108> AgradCcdfLogBetaProportion_ffv_108;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_109> AgradCcdfLogBetaProportion_ffv_109;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_110> AgradCcdfLogBetaProportion_ffv_110;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_111> AgradCcdfLogBetaProportion_ffv_111;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_112> AgradCcdfLogBetaProportion_ffv_112;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_113> AgradCcdfLogBetaProportion_ffv_113;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_114> AgradCcdfLogBetaProportion_ffv_114;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_115> AgradCcdfLogBetaProportion_ffv_115;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_116> AgradCcdfLogBetaProportion_ffv_116;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_117> AgradCcdfLogBetaProportion_ffv_117;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_118> AgradCcdfLogBetaProportion_ffv_118;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_119> AgradCcdfLogBetaProportion_ffv_119;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_120> AgradCcdfLogBetaProportion_ffv_120;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_121> AgradCcdfLogBetaProportion_ffv_121;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_122> AgradCcdfLogBetaProportion_ffv_122;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_123> AgradCcdfLogBetaProportion_ffv_123;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_124> AgradCcdfLogBetaProportion_ffv_124;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_125> AgradCcdfLogBetaProportion_ffv_125;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_126> AgradCcdfLogBetaProportion_ffv_126;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_127> AgradCcdfLogBetaProportion_ffv_127;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_128> AgradCcdfLogBetaProportion_ffv_128;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_129> AgradCcdfLogBetaProportion_ffv_129;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_130> AgradCcdfLogBetaProportion_ffv_130;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_131> AgradCcdfLogBetaProportion_ffv_131;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_132> AgradCcdfLogBetaProportion_ffv_132;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_133> AgradCcdfLogBetaProportion_ffv_133;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_134> AgradCcdfLogBetaProportion_ffv_134;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_135> AgradCcdfLogBetaProportion_ffv_135;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_136> AgradCcdfLogBetaProportion_ffv_136;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_137> AgradCcdfLogBetaProportion_ffv_137;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_138> AgradCcdfLogBetaProportion_ffv_138;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_139> AgradCcdfLogBetaProportion_ffv_139;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_140> AgradCcdfLogBetaProportion_ffv_140;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_141> AgradCcdfLogBetaProportion_ffv_141;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_142> AgradCcdfLogBetaProportion_ffv_142;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_143> AgradCcdfLogBetaProportion_ffv_143;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_144> AgradCcdfLogBetaProportion_ffv_144;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_145> AgradCcdfLogBetaProportion_ffv_145;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_146> AgradCcdfLogBetaProportion_ffv_146;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_147> AgradCcdfLogBetaProportion_ffv_147;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_148> AgradCcdfLogBetaProportion_ffv_148;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_149> AgradCcdfLogBetaProportion_ffv_149;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_150> AgradCcdfLogBetaProportion_ffv_150;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_151> AgradCcdfLogBetaProportion_ffv_151;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_152> AgradCcdfLogBetaProportion_ffv_152;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_153> AgradCcdfLogBetaProportion_ffv_153;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_154> AgradCcdfLogBetaProportion_ffv_154;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_155> AgradCcdfLogBetaProportion_ffv_155;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_156> AgradCcdfLogBetaProportion_ffv_156;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_157> AgradCcdfLogBetaProportion_ffv_157;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_158> AgradCcdfLogBetaProportion_ffv_158;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_159> AgradCcdfLogBetaProportion_ffv_159;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_160> AgradCcdfLogBetaProportion_ffv_160;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_161> AgradCcdfLogBetaProportion_ffv_161;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_162> AgradCcdfLogBetaProportion_ffv_162;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_163> AgradCcdfLogBetaProportion_ffv_163;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_164> AgradCcdfLogBetaProportion_ffv_164;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_165> AgradCcdfLogBetaProportion_ffv_165;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_166> AgradCcdfLogBetaProportion_ffv_166;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_167> AgradCcdfLogBetaProportion_ffv_167;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_168> AgradCcdfLogBetaProportion_ffv_168;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_169> AgradCcdfLogBetaProportion_ffv_169;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_170> AgradCcdfLogBetaProportion_ffv_170;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_171> AgradCcdfLogBetaProportion_ffv_171;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_172> AgradCcdfLogBetaProportion_ffv_172;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_173> AgradCcdfLogBetaProportion_ffv_173;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_174> AgradCcdfLogBetaProportion_ffv_174;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_175> AgradCcdfLogBetaProportion_ffv_175;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_176> AgradCcdfLogBetaProportion_ffv_176;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_177> AgradCcdfLogBetaProportion_ffv_177;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_178> AgradCcdfLogBetaProportion_ffv_178;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_179> AgradCcdfLogBetaProportion_ffv_179;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_180> AgradCcdfLogBetaProportion_ffv_180;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_181> AgradCcdfLogBetaProportion_ffv_181;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_182> AgradCcdfLogBetaProportion_ffv_182;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_183> AgradCcdfLogBetaProportion_ffv_183;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_184> AgradCcdfLogBetaProportion_ffv_184;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_185> AgradCcdfLogBetaProportion_ffv_185;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_186> AgradCcdfLogBetaProportion_ffv_186;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_187> AgradCcdfLogBetaProportion_ffv_187;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_ffv_188> AgradCcdfLogBetaProportion_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_100> AgradCcdfLogBetaProportion_v_100;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_101> AgradCcdfLogBetaProportion_v_101;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_102> AgradCcdfLogBetaProportion_v_102;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_103> AgradCcdfLogBetaProportion_v_103;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_104> AgradCcdfLogBetaProportion_v_104;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_105> AgradCcdfLogBetaProportion_v_105;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_106> AgradCcdfLogBetaProportion_v_106;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_107> AgradCcdfLogBetaProportion_v_107;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_108> AgradCcdfLogBetaProportion_v_108;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_109> AgradCcdfLogBetaProportion_v_109;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_110> AgradCcdfLogBetaProportion_v_110;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_111> AgradCcdfLogBetaProportion_v_111;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_112> AgradCcdfLogBetaProportion_v_112;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_113> AgradCcdfLogBetaProportion_v_113;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_114> AgradCcdfLogBetaProportion_v_114;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_115> AgradCcdfLogBetaProportion_v_115;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_116> AgradCcdfLogBetaProportion_v_116;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_117> AgradCcdfLogBetaProportion_v_117;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_118> AgradCcdfLogBetaProportion_v_118;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_119> AgradCcdfLogBetaProportion_v_119;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_120> AgradCcdfLogBetaProportion_v_120;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_121> AgradCcdfLogBetaProportion_v_121;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_122> AgradCcdfLogBetaProportion_v_122;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_123> AgradCcdfLogBetaProportion_v_123;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_124> AgradCcdfLogBetaProportion_v_124;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_125> AgradCcdfLogBetaProportion_v_125;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_126> AgradCcdfLogBetaProportion_v_126;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_127> AgradCcdfLogBetaProportion_v_127;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_128> AgradCcdfLogBetaProportion_v_128;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_129> AgradCcdfLogBetaProportion_v_129;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_130> AgradCcdfLogBetaProportion_v_130;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_131> AgradCcdfLogBetaProportion_v_131;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_132> AgradCcdfLogBetaProportion_v_132;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_133> AgradCcdfLogBetaProportion_v_133;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_134> AgradCcdfLogBetaProportion_v_134;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_135> AgradCcdfLogBetaProportion_v_135;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_136> AgradCcdfLogBetaProportion_v_136;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_137> AgradCcdfLogBetaProportion_v_137;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_138> AgradCcdfLogBetaProportion_v_138;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_139> AgradCcdfLogBetaProportion_v_139;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_140> AgradCcdfLogBetaProportion_v_140;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_141> AgradCcdfLogBetaProportion_v_141;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_142> AgradCcdfLogBetaProportion_v_142;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_143> AgradCcdfLogBetaProportion_v_143;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_144> AgradCcdfLogBetaProportion_v_144;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_145> AgradCcdfLogBetaProportion_v_145;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_146> AgradCcdfLogBetaProportion_v_146;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_147> AgradCcdfLogBetaProportion_v_147;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_148> AgradCcdfLogBetaProportion_v_148;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_149> AgradCcdfLogBetaProportion_v_149;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_150> AgradCcdfLogBetaProportion_v_150;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_151> AgradCcdfLogBetaProportion_v_151;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_152> AgradCcdfLogBetaProportion_v_152;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_153> AgradCcdfLogBetaProportion_v_153;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_154> AgradCcdfLogBetaProportion_v_154;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_155> AgradCcdfLogBetaProportion_v_155;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_156> AgradCcdfLogBetaProportion_v_156;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_157> AgradCcdfLogBetaProportion_v_157;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_158> AgradCcdfLogBetaProportion_v_158;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_159> AgradCcdfLogBetaProportion_v_159;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_160> AgradCcdfLogBetaProportion_v_160;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_161> AgradCcdfLogBetaProportion_v_161;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_162> AgradCcdfLogBetaProportion_v_162;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_163> AgradCcdfLogBetaProportion_v_163;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_164> AgradCcdfLogBetaProportion_v_164;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_165> AgradCcdfLogBetaProportion_v_165;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_166> AgradCcdfLogBetaProportion_v_166;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_167> AgradCcdfLogBetaProportion_v_167;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_168> AgradCcdfLogBetaProportion_v_168;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_169> AgradCcdfLogBetaProportion_v_169;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_170> AgradCcdfLogBetaProportion_v_170;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_171> AgradCcdfLogBetaProportion_v_171;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_172> AgradCcdfLogBetaProportion_v_172;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_173> AgradCcdfLogBetaProportion_v_173;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_174> AgradCcdfLogBetaProportion_v_174;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_175> AgradCcdfLogBetaProportion_v_175;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_176> AgradCcdfLogBetaProportion_v_176;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_177> AgradCcdfLogBetaProportion_v_177;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_178> AgradCcdfLogBetaProportion_v_178;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_179> AgradCcdfLogBetaProportion_v_179;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_180> AgradCcdfLogBetaProportion_v_180;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_181> AgradCcdfLogBetaProportion_v_181;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_182> AgradCcdfLogBetaProportion_v_182;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_183> AgradCcdfLogBetaProportion_v_183;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_184> AgradCcdfLogBetaProportion_v_184;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_185> AgradCcdfLogBetaProportion_v_185;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_186> AgradCcdfLogBetaProportion_v_186;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_187> AgradCcdfLogBetaProportion_v_187;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_188> AgradCcdfLogBetaProportion_v_188;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_189> AgradCcdfLogBetaProportion_v_189;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_190> AgradCcdfLogBetaProportion_v_190;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_191> AgradCcdfLogBetaProportion_v_191;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_192> AgradCcdfLogBetaProportion_v_192;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_193> AgradCcdfLogBetaProportion_v_193;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_194> AgradCcdfLogBetaProportion_v_194;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_195> AgradCcdfLogBetaProportion_v_195;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_196> AgradCcdfLogBetaProportion_v_196;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_197> AgradCcdfLogBetaProportion_v_197;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_198> AgradCcdfLogBetaProportion_v_198;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_v_199> AgradCcdfLogBetaProportion_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_100, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_101, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_102, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_103, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_104, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_105, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_106, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_107, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_108, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_109, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_110, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_111, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_112, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_113, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_114, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_115, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_116, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_117, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_118, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_119, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_120, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_121, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_122, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_123, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_124, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_125, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_126, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_127, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_128, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_129, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_130, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_131, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_132, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_133, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_134, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_135, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_136, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_137, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_138, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_139, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_140, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_141, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_142, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_143, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_144, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_145, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_146, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_147, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_148, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_149, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_150, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_151, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_152, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_153, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_154, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_155, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_156, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_157, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_158, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_159, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_160, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_161, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_162, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_163, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_164, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_165, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_166, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_167, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_168, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_169, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_170, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_171, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_172, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_173, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_174, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_175, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_176, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_177, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_178, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_179, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_180, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_181, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_182, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_183, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_184, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_185, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_186, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_187, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_188, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_189, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_190, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_191, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_192, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_193, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_194, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_195, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_196, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_197, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_198, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_v_199, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_100> AgradCcdfLogBetaProportion_vv_100;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_101> AgradCcdfLogBetaProportion_vv_101;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_102> AgradCcdfLogBetaProportion_vv_102;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_103> AgradCcdfLogBetaProportion_vv_103;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_104> AgradCcdfLogBetaProportion_vv_104;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_105> AgradCcdfLogBetaProportion_vv_105;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_106> AgradCcdfLogBetaProportion_vv_106;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_107> AgradCcdfLogBetaProportion_vv_107;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_108> AgradCcdfLogBetaProportion_vv_108;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_109> AgradCcdfLogBetaProportion_vv_109;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_110> AgradCcdfLogBetaProportion_vv_110;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_111> AgradCcdfLogBetaProportion_vv_111;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_112> AgradCcdfLogBetaProportion_vv_112;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_113> AgradCcdfLogBetaProportion_vv_113;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_114> AgradCcdfLogBetaProportion_vv_114;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_115> AgradCcdfLogBetaProportion_vv_115;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_116> AgradCcdfLogBetaProportion_vv_116;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_117> AgradCcdfLogBetaProportion_vv_117;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_118> AgradCcdfLogBetaProportion_vv_118;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_119> AgradCcdfLogBetaProportion_vv_119;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_120> AgradCcdfLogBetaProportion_vv_120;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_121> AgradCcdfLogBetaProportion_vv_121;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_122> AgradCcdfLogBetaProportion_vv_122;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_123> AgradCcdfLogBetaProportion_vv_123;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_124> AgradCcdfLogBetaProportion_vv_124;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_125> AgradCcdfLogBetaProportion_vv_125;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_126> AgradCcdfLogBetaProportion_vv_126;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_127> AgradCcdfLogBetaProportion_vv_127;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_128> AgradCcdfLogBetaProportion_vv_128;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_129> AgradCcdfLogBetaProportion_vv_129;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_130> AgradCcdfLogBetaProportion_vv_130;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_131> AgradCcdfLogBetaProportion_vv_131;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_132> AgradCcdfLogBetaProportion_vv_132;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_133> AgradCcdfLogBetaProportion_vv_133;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_134> AgradCcdfLogBetaProportion_vv_134;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_135> AgradCcdfLogBetaProportion_vv_135;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_136> AgradCcdfLogBetaProportion_vv_136;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_137> AgradCcdfLogBetaProportion_vv_137;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_138> AgradCcdfLogBetaProportion_vv_138;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_139> AgradCcdfLogBetaProportion_vv_139;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_140> AgradCcdfLogBetaProportion_vv_140;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_141> AgradCcdfLogBetaProportion_vv_141;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_142> AgradCcdfLogBetaProportion_vv_142;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_143> AgradCcdfLogBetaProportion_vv_143;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_144> AgradCcdfLogBetaProportion_vv_144;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_145> AgradCcdfLogBetaProportion_vv_145;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_146> AgradCcdfLogBetaProportion_vv_146;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_147> AgradCcdfLogBetaProportion_vv_147;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_148> AgradCcdfLogBetaProportion_vv_148;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_149> AgradCcdfLogBetaProportion_vv_149;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_150> AgradCcdfLogBetaProportion_vv_150;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_151> AgradCcdfLogBetaProportion_vv_151;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_152> AgradCcdfLogBetaProportion_vv_152;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_153> AgradCcdfLogBetaProportion_vv_153;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_154> AgradCcdfLogBetaProportion_vv_154;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_155> AgradCcdfLogBetaProportion_vv_155;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_156> AgradCcdfLogBetaProportion_vv_156;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_157> AgradCcdfLogBetaProportion_vv_157;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_158> AgradCcdfLogBetaProportion_vv_158;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_159> AgradCcdfLogBetaProportion_vv_159;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_160> AgradCcdfLogBetaProportion_vv_160;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_161> AgradCcdfLogBetaProportion_vv_161;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_162> AgradCcdfLogBetaProportion_vv_162;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_163> AgradCcdfLogBetaProportion_vv_163;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_164> AgradCcdfLogBetaProportion_vv_164;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_165> AgradCcdfLogBetaProportion_vv_165;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_166> AgradCcdfLogBetaProportion_vv_166;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_167> AgradCcdfLogBetaProportion_vv_167;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_168> AgradCcdfLogBetaProportion_vv_168;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_169> AgradCcdfLogBetaProportion_vv_169;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_170> AgradCcdfLogBetaProportion_vv_170;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_171> AgradCcdfLogBetaProportion_vv_171;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_172> AgradCcdfLogBetaProportion_vv_172;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_173> AgradCcdfLogBetaProportion_vv_173;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_174> AgradCcdfLogBetaProportion_vv_174;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_175> AgradCcdfLogBetaProportion_vv_175;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_176> AgradCcdfLogBetaProportion_vv_176;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_177> AgradCcdfLogBetaProportion_vv_177;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_178> AgradCcdfLogBetaProportion_vv_178;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_179> AgradCcdfLogBetaProportion_vv_179;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_180> AgradCcdfLogBetaProportion_vv_180;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_181> AgradCcdfLogBetaProportion_vv_181;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_182> AgradCcdfLogBetaProportion_vv_182;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_183> AgradCcdfLogBetaProportion_vv_183;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_184> AgradCcdfLogBetaProportion_vv_184;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_185> AgradCcdfLogBetaProportion_vv_185;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_186> AgradCcdfLogBetaProportion_vv_186;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_187> AgradCcdfLogBetaProportion_vv_187;
+typedef std::tuple<AgradCcdfLogBetaProportion, type_vv_188> AgradCcdfLogBetaProportion_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBetaProportion_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogBetaProportion_vv_188);
+
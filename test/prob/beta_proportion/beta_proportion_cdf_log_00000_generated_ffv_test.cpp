@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_0> AgradCdfLogBetaProportion_ffv_0;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_1> AgradCdfLogBetaProportion_ffv_1;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_2> AgradCdfLogBetaProportion_ffv_2;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_3> AgradCdfLogBetaProportion_ffv_3;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_4> AgradCdfLogBetaProportion_ffv_4;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_5> AgradCdfLogBetaProportion_ffv_5;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_6> AgradCdfLogBetaProportion_ffv_6;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_7> AgradCdfLogBetaProportion_ffv_7;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_8> AgradCdfLogBetaProportion_ffv_8;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_9> AgradCdfLogBetaProportion_ffv_9;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_10> AgradCdfLogBetaProportion_ffv_10;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_11> AgradCdfLogBetaProportion_ffv_11;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_12> AgradCdfLogBetaProportion_ffv_12;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_13> AgradCdfLogBetaProportion_ffv_13;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_14> AgradCdfLogBetaProportion_ffv_14;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_15> AgradCdfLogBetaProportion_ffv_15;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_16> AgradCdfLogBetaProportion_ffv_16;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_17> AgradCdfLogBetaProportion_ffv_17;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_18> AgradCdfLogBetaProportion_ffv_18;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_19> AgradCdfLogBetaProportion_ffv_19;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_20> AgradCdfLogBetaProportion_ffv_20;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_21> AgradCdfLogBetaProportion_ffv_21;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_22> AgradCdfLogBetaProportion_ffv_22;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_23> AgradCdfLogBetaProportion_ffv_23;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_24> AgradCdfLogBetaProportion_ffv_24;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_25> AgradCdfLogBetaProportion_ffv_25;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_26> AgradCdfLogBetaProportion_ffv_26;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_27> AgradCdfLogBetaProportion_ffv_27;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_28> AgradCdfLogBetaProportion_ffv_28;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_29> AgradCdfLogBetaProportion_ffv_29;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_30> AgradCdfLogBetaProportion_ffv_30;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_31> AgradCdfLogBetaProportion_ffv_31;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_32> AgradCdfLogBetaProportion_ffv_32;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_33> AgradCdfLogBetaProportion_ffv_33;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_34> AgradCdfLogBetaProportion_ffv_34;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_35> AgradCdfLogBetaProportion_ffv_35;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_36> AgradCdfLogBetaProportion_ffv_36;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_37> AgradCdfLogBetaProportion_ffv_37;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_38> AgradCdfLogBetaProportion_ffv_38;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_39> AgradCdfLogBetaProportion_ffv_39;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_40> AgradCdfLogBetaProportion_ffv_40;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_41> AgradCdfLogBetaProportion_ffv_41;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_42> AgradCdfLogBetaProportion_ffv_42;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_43> AgradCdfLogBetaProportion_ffv_43;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_44> AgradCdfLogBetaProportion_ffv_44;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_45> AgradCdfLogBetaProportion_ffv_45;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_46> AgradCdfLogBetaProportion_ffv_46;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_47> AgradCdfLogBetaProportion_ffv_47;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_48> AgradCdfLogBetaProportion_ffv_48;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_49> AgradCdfLogBetaProportion_ffv_49;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_50> AgradCdfLogBetaProportion_ffv_50;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_51> AgradCdfLogBetaProportion_ffv_51;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_52> AgradCdfLogBetaProportion_ffv_52;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_53> AgradCdfLogBetaProportion_ffv_53;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_54> AgradCdfLogBetaProportion_ffv_54;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_55> AgradCdfLogBetaProportion_ffv_55;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_56> AgradCdfLogBetaProportion_ffv_56;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_57> AgradCdfLogBetaProportion_ffv_57;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_58> AgradCdfLogBetaProportion_ffv_58;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_59> AgradCdfLogBetaProportion_ffv_59;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_60> AgradCdfLogBetaProportion_ffv_60;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_61> AgradCdfLogBetaProportion_ffv_61;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_62> AgradCdfLogBetaProportion_ffv_62;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_63> AgradCdfLogBetaProportion_ffv_63;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_64> AgradCdfLogBetaProportion_ffv_64;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_65> AgradCdfLogBetaProportion_ffv_65;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_66> AgradCdfLogBetaProportion_ffv_66;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_67> AgradCdfLogBetaProportion_ffv_67;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_68> AgradCdfLogBetaProportion_ffv_68;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_69> AgradCdfLogBetaProportion_ffv_69;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_70> AgradCdfLogBetaProportion_ffv_70;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_71> AgradCdfLogBetaProportion_ffv_71;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_72> AgradCdfLogBetaProportion_ffv_72;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_73> AgradCdfLogBetaProportion_ffv_73;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_74> AgradCdfLogBetaProportion_ffv_74;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_75> AgradCdfLogBetaProportion_ffv_75;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_76> AgradCdfLogBetaProportion_ffv_76;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_77> AgradCdfLogBetaProportion_ffv_77;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_78> AgradCdfLogBetaProportion_ffv_78;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_79> AgradCdfLogBetaProportion_ffv_79;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_80> AgradCdfLogBetaProportion_ffv_80;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_81> AgradCdfLogBetaProportion_ffv_81;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_82> AgradCdfLogBetaProportion_ffv_82;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_83> AgradCdfLogBetaProportion_ffv_83;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_84> AgradCdfLogBetaProportion_ffv_84;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_85> AgradCdfLogBetaProportion_ffv_85;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_86> AgradCdfLogBetaProportion_ffv_86;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_87> AgradCdfLogBetaProportion_ffv_87;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_88> AgradCdfLogBetaProportion_ffv_88;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_89> AgradCdfLogBetaProportion_ffv_89;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_90> AgradCdfLogBetaProportion_ffv_90;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_91> AgradCdfLogBetaProportion_ffv_91;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_92> AgradCdfLogBetaProportion_ffv_92;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_93> AgradCdfLogBetaProportion_ffv_93;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_94> AgradCdfLogBetaProportion_ffv_94;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_95> AgradCdfLogBetaProportion_ffv_95;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_96> AgradCdfLogBetaProportion_ffv_96;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_97> AgradCdfLogBetaProportion_ffv_97;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_98> AgradCdfLogBetaProportion_ffv_98;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_99> AgradCdfLogBetaProportion_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_0, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_1, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_2, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_3, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_4, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_5, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_6, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_7, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_8, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_9, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_10, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_11, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_12, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_13, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_14, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_15, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_16, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_17, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_18, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_19, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_20, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_21, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_22, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_23, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_24, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_25, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_26, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_27, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_28, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_29, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_30, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_31, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_32, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_33, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_34, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_35, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_36, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_37, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_38, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_39, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_40, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_41, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_42, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_43, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_44, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_45, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_46, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_47, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_48, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_49, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_50, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_51, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_52, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_53, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_54, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_55, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_56, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_57, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_58, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_59, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_60, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_61, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_62, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_63, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_64, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_65, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_66, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_67, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_68, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_69, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_70, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_71, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_72, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_73, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_74, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_75, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_76, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_77, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_78, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_79, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_80, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_81, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_82, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_83, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_84, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_85, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_86, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_87, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_88, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_89, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_90, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_91, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_92, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_93, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_94, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_95, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_96, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_97, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_98, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_99, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_0> AgradCdfLogBetaProportion_v_0;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_1> AgradCdfLogBetaProportion_v_1;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_2> AgradCdfLogBetaProportion_v_2;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_3> AgradCdfLogBetaProportion_v_3;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_4> AgradCdfLogBetaProportion_v_4;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_5> AgradCdfLogBetaProportion_v_5;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_6> AgradCdfLogBetaProportion_v_6;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_7> AgradCdfLogBetaProportion_v_7;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_8> AgradCdfLogBetaProportion_v_8;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_9> AgradCdfLogBetaProportion_v_9;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_10> AgradCdfLogBetaProportion_v_10;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_11> AgradCdfLogBetaProportion_v_11;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_12> AgradCdfLogBetaProportion_v_12;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_13> AgradCdfLogBetaProportion_v_13;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_14> AgradCdfLogBetaProportion_v_14;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_15> AgradCdfLogBetaProportion_v_15;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_16> AgradCdfLogBetaProportion_v_16;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_17> AgradCdfLogBetaProportion_v_17;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_18> AgradCdfLogBetaProportion_v_18;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_19> AgradCdfLogBetaProportion_v_19;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_20> AgradCdfLogBetaProportion_v_20;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_21> AgradCdfLogBetaProportion_v_21;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_22> AgradCdfLogBetaProportion_v_22;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_23> AgradCdfLogBetaProportion_v_23;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_24> AgradCdfLogBetaProportion_v_24;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_25> AgradCdfLogBetaProportion_v_25;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_26> AgradCdfLogBetaProportion_v_26;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_27> AgradCdfLogBetaProportion_v_27;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_28> AgradCdfLogBetaProportion_v_28;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_29> AgradCdfLogBetaProportion_v_29;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_30> AgradCdfLogBetaProportion_v_30;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_31> AgradCdfLogBetaProportion_v_31;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_32> AgradCdfLogBetaProportion_v_32;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_33> AgradCdfLogBetaProportion_v_33;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_34> AgradCdfLogBetaProportion_v_34;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_35> AgradCdfLogBetaProportion_v_35;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_36> AgradCdfLogBetaProportion_v_36;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_37> AgradCdfLogBetaProportion_v_37;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_38> AgradCdfLogBetaProportion_v_38;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_39> AgradCdfLogBetaProportion_v_39;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_40> AgradCdfLogBetaProportion_v_40;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_41> AgradCdfLogBetaProportion_v_41;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_42> AgradCdfLogBetaProportion_v_42;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_43> AgradCdfLogBetaProportion_v_43;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_44> AgradCdfLogBetaProportion_v_44;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_45> AgradCdfLogBetaProportion_v_45;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_46> AgradCdfLogBetaProportion_v_46;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_47> AgradCdfLogBetaProportion_v_47;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_48> AgradCdfLogBetaProportion_v_48;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_49> AgradCdfLogBetaProportion_v_49;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_50> AgradCdfLogBetaProportion_v_50;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_51> AgradCdfLogBetaProportion_v_51;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_52> AgradCdfLogBetaProportion_v_52;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_53> AgradCdfLogBetaProportion_v_53;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_54> AgradCdfLogBetaProportion_v_54;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_55> AgradCdfLogBetaProportion_v_55;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_56> AgradCdfLogBetaProportion_v_56;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_57> AgradCdfLogBetaProportion_v_57;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_58> AgradCdfLogBetaProportion_v_58;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_59> AgradCdfLogBetaProportion_v_59;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_60> AgradCdfLogBetaProportion_v_60;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_61> AgradCdfLogBetaProportion_v_61;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_62> AgradCdfLogBetaProportion_v_62;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_63> AgradCdfLogBetaProportion_v_63;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_64> AgradCdfLogBetaProportion_v_64;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_65> AgradCdfLogBetaProportion_v_65;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_66> AgradCdfLogBetaProportion_v_66;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_67> AgradCdfLogBetaProportion_v_67;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_68> AgradCdfLogBetaProportion_v_68;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_69> AgradCdfLogBetaProportion_v_69;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_70> AgradCdfLogBetaProportion_v_70;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_71> AgradCdfLogBetaProportion_v_71;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_72> AgradCdfLogBetaProportion_v_72;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_73> AgradCdfLogBetaProportion_v_73;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_74> AgradCdfLogBetaProportion_v_74;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_75> AgradCdfLogBetaProportion_v_75;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_76> AgradCdfLogBetaProportion_v_76;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_77> AgradCdfLogBetaProportion_v_77;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_78> AgradCdfLogBetaProportion_v_78;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_79> AgradCdfLogBetaProportion_v_79;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_80> AgradCdfLogBetaProportion_v_80;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_81> AgradCdfLogBetaProportion_v_81;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_82> AgradCdfLogBetaProportion_v_82;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_83> AgradCdfLogBetaProportion_v_83;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_84> AgradCdfLogBetaProportion_v_84;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_85> AgradCdfLogBetaProportion_v_85;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_86> AgradCdfLogBetaProportion_v_86;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_87> AgradCdfLogBetaProportion_v_87;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_88> AgradCdfLogBetaProportion_v_88;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_89> AgradCdfLogBetaProportion_v_89;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_90> AgradCdfLogBetaProportion_v_90;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_91> AgradCdfLogBetaProportion_v_91;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_92> AgradCdfLogBetaProportion_v_92;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_93> AgradCdfLogBetaProportion_v_93;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_94> AgradCdfLogBetaProportion_v_94;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_95> AgradCdfLogBetaProportion_v_95;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_96> AgradCdfLogBetaProportion_v_96;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_97> AgradCdfLogBetaProportion_v_97;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_98> AgradCdfLogBetaProportion_v_98;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_99> AgradCdfLogBetaProportion_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_0, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_1, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_2, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_3, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_4, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_5, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_6, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_7, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_8, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_9, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_10, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_11, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_12, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_13, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_14, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_15, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_16, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_17, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_18, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_19, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_20, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_21, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_22, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_23, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_24, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_25, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_26, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_27, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_28, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_29, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_30, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_31, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_32, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_33, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_34, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_35, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_36, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_37, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_38, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_39, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_40, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_41, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_42, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_43, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_44, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_45, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_46, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_47, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_48, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_49, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_50, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_51, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_52, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_53, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_54, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_55, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_56, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_57, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_58, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_59, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_60, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_61, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_62, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_63, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_64, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_65, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_66, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_67, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_68, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_69, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_70, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_71, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_72, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_73, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_74, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_75, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_76, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_77, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_78, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_79, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_80, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_81, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_82, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_83, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_84, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_85, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_86, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_87, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_88, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_89, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_90, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_91, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_92, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_93, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_94, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_95, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_96, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_97, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_98, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_99, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_99);
+
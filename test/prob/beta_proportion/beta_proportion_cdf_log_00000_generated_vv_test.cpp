@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_0> AgradCdfLogBetaProportion_vv_0;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_1> AgradCdfLogBetaProportion_vv_1;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_2> AgradCdfLogBetaProportion_vv_2;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_3> AgradCdfLogBetaProportion_vv_3;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_4> AgradCdfLogBetaProportion_vv_4;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_5> AgradCdfLogBetaProportion_vv_5;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_6> AgradCdfLogBetaProportion_vv_6;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_7> AgradCdfLogBetaProportion_vv_7;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_8> AgradCdfLogBetaProportion_vv_8;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_9> AgradCdfLogBetaProportion_vv_9;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_10> AgradCdfLogBetaProportion_vv_10;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_11> AgradCdfLogBetaProportion_vv_11;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_12> AgradCdfLogBetaProportion_vv_12;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_13> AgradCdfLogBetaProportion_vv_13;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_14> AgradCdfLogBetaProportion_vv_14;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_15> AgradCdfLogBetaProportion_vv_15;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_16> AgradCdfLogBetaProportion_vv_16;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_17> AgradCdfLogBetaProportion_vv_17;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_18> AgradCdfLogBetaProportion_vv_18;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_19> AgradCdfLogBetaProportion_vv_19;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_20> AgradCdfLogBetaProportion_vv_20;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_21> AgradCdfLogBetaProportion_vv_21;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_22> AgradCdfLogBetaProportion_vv_22;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_23> AgradCdfLogBetaProportion_vv_23;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_24> AgradCdfLogBetaProportion_vv_24;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_25> AgradCdfLogBetaProportion_vv_25;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_26> AgradCdfLogBetaProportion_vv_26;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_27> AgradCdfLogBetaProportion_vv_27;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_28> AgradCdfLogBetaProportion_vv_28;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_29> AgradCdfLogBetaProportion_vv_29;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_30> AgradCdfLogBetaProportion_vv_30;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_31> AgradCdfLogBetaProportion_vv_31;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_32> AgradCdfLogBetaProportion_vv_32;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_33> AgradCdfLogBetaProportion_vv_33;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_34> AgradCdfLogBetaProportion_vv_34;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_35> AgradCdfLogBetaProportion_vv_35;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_36> AgradCdfLogBetaProportion_vv_36;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_37> AgradCdfLogBetaProportion_vv_37;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_38> AgradCdfLogBetaProportion_vv_38;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_39> AgradCdfLogBetaProportion_vv_39;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_40> AgradCdfLogBetaProportion_vv_40;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_41> AgradCdfLogBetaProportion_vv_41;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_42> AgradCdfLogBetaProportion_vv_42;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_43> AgradCdfLogBetaProportion_vv_43;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_44> AgradCdfLogBetaProportion_vv_44;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_45> AgradCdfLogBetaProportion_vv_45;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_46> AgradCdfLogBetaProportion_vv_46;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_47> AgradCdfLogBetaProportion_vv_47;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_48> AgradCdfLogBetaProportion_vv_48;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_49> AgradCdfLogBetaProportion_vv_49;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_50> AgradCdfLogBetaProportion_vv_50;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_51> AgradCdfLogBetaProportion_vv_51;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_52> AgradCdfLogBetaProportion_vv_52;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_53> AgradCdfLogBetaProportion_vv_53;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_54> AgradCdfLogBetaProportion_vv_54;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_55> AgradCdfLogBetaProportion_vv_55;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_56> AgradCdfLogBetaProportion_vv_56;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_57> AgradCdfLogBetaProportion_vv_57;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_58> AgradCdfLogBetaProportion_vv_58;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_59> AgradCdfLogBetaProportion_vv_59;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_60> AgradCdfLogBetaProportion_vv_60;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_61> AgradCdfLogBetaProportion_vv_61;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_62> AgradCdfLogBetaProportion_vv_62;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_63> AgradCdfLogBetaProportion_vv_63;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_64> AgradCdfLogBetaProportion_vv_64;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_65> AgradCdfLogBetaProportion_vv_65;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_66> AgradCdfLogBetaProportion_vv_66;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_67> AgradCdfLogBetaProportion_vv_67;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_68> AgradCdfLogBetaProportion_vv_68;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_69> AgradCdfLogBetaProportion_vv_69;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_70> AgradCdfLogBetaProportion_vv_70;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_71> AgradCdfLogBetaProportion_vv_71;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_72> AgradCdfLogBetaProportion_vv_72;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_73> AgradCdfLogBetaProportion_vv_73;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_74> AgradCdfLogBetaProportion_vv_74;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_75> AgradCdfLogBetaProportion_vv_75;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_76> AgradCdfLogBetaProportion_vv_76;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_77> AgradCdfLogBetaProportion_vv_77;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_78> AgradCdfLogBetaProportion_vv_78;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_79> AgradCdfLogBetaProportion_vv_79;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_80> AgradCdfLogBetaProportion_vv_80;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_81> AgradCdfLogBetaProportion_vv_81;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_82> AgradCdfLogBetaProportion_vv_82;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_83> AgradCdfLogBetaProportion_vv_83;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_84> AgradCdfLogBetaProportion_vv_84;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_85> AgradCdfLogBetaProportion_vv_85;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_86> AgradCdfLogBetaProportion_vv_86;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_87> AgradCdfLogBetaProportion_vv_87;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_88> AgradCdfLogBetaProportion_vv_88;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_89> AgradCdfLogBetaProportion_vv_89;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_90> AgradCdfLogBetaProportion_vv_90;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_91> AgradCdfLogBetaProportion_vv_91;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_92> AgradCdfLogBetaProportion_vv_92;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_93> AgradCdfLogBetaProportion_vv_93;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_94> AgradCdfLogBetaProportion_vv_94;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_95> AgradCdfLogBetaProportion_vv_95;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_96> AgradCdfLogBetaProportion_vv_96;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_97> AgradCdfLogBetaProportion_vv_97;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_98> AgradCdfLogBetaProportion_vv_98;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_99> AgradCdfLogBetaProportion_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_0, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_1, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_2, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_3, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_4, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_5, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_6, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_7, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_8, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_9, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_10, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_11, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_12, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_13, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_14, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_15, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_16, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_17, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_18, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_19, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_20, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_21, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_22, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_23, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_24, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_25, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_26, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_27, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_28, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_29, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_30, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_31, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_32, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_33, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_34, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_35, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_36, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_37, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_38, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_39, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_40, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_41, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_42, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_43, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_44, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_45, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_46, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_47, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_48, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_49, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_50, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_51, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_52, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_53, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_54, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_55, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_56, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_57, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_58, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_59, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_60, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_61, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_62, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_63, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_64, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_65, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_66, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_67, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_68, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_69, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_70, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_71, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_72, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_73, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_74, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_75, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_76, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_77, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_78, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_79, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_80, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_81, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_82, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_83, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_84, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_85, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_86, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_87, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_88, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_89, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_90, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_91, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_92, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_93, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_94, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_95, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_96, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_97, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_98, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_99, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_99);
+
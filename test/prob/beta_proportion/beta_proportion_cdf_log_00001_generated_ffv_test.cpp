@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_100> AgradCdfLogBetaProportion_ffv_100;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_101> AgradCdfLogBetaProportion_ffv_101;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_102> AgradCdfLogBetaProportion_ffv_102;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_103> AgradCdfLogBetaProportion_ffv_103;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_104> AgradCdfLogBetaProportion_ffv_104;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_105> AgradCdfLogBetaProportion_ffv_105;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_106> AgradCdfLogBetaProportion_ffv_106;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_107> AgradCdfLogBetaProportion_ffv_107;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_108> AgradCdfLogBetaProportion_ffv_108;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_109> AgradCdfLogBetaProportion_ffv_109;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_110> AgradCdfLogBetaProportion_ffv_110;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_111> AgradCdfLogBetaProportion_ffv_111;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_112> AgradCdfLogBetaProportion_ffv_112;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_113> AgradCdfLogBetaProportion_ffv_113;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_114> AgradCdfLogBetaProportion_ffv_114;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_115> AgradCdfLogBetaProportion_ffv_115;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_116> AgradCdfLogBetaProportion_ffv_116;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_117> AgradCdfLogBetaProportion_ffv_117;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_118> AgradCdfLogBetaProportion_ffv_118;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_119> AgradCdfLogBetaProportion_ffv_119;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_120> AgradCdfLogBetaProportion_ffv_120;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_121> AgradCdfLogBetaProportion_ffv_121;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_122> AgradCdfLogBetaProportion_ffv_122;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_123> AgradCdfLogBetaProportion_ffv_123;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_124> AgradCdfLogBetaProportion_ffv_124;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_125> AgradCdfLogBetaProportion_ffv_125;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_126> AgradCdfLogBetaProportion_ffv_126;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_127> AgradCdfLogBetaProportion_ffv_127;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_128> AgradCdfLogBetaProportion_ffv_128;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_129> AgradCdfLogBetaProportion_ffv_129;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_130> AgradCdfLogBetaProportion_ffv_130;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_131> AgradCdfLogBetaProportion_ffv_131;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_132> AgradCdfLogBetaProportion_ffv_132;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_133> AgradCdfLogBetaProportion_ffv_133;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_134> AgradCdfLogBetaProportion_ffv_134;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_135> AgradCdfLogBetaProportion_ffv_135;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_136> AgradCdfLogBetaProportion_ffv_136;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_137> AgradCdfLogBetaProportion_ffv_137;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_138> AgradCdfLogBetaProportion_ffv_138;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_139> AgradCdfLogBetaProportion_ffv_139;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_140> AgradCdfLogBetaProportion_ffv_140;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_141> AgradCdfLogBetaProportion_ffv_141;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_142> AgradCdfLogBetaProportion_ffv_142;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_143> AgradCdfLogBetaProportion_ffv_143;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_144> AgradCdfLogBetaProportion_ffv_144;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_145> AgradCdfLogBetaProportion_ffv_145;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_146> AgradCdfLogBetaProportion_ffv_146;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_147> AgradCdfLogBetaProportion_ffv_147;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_148> AgradCdfLogBetaProportion_ffv_148;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_149> AgradCdfLogBetaProportion_ffv_149;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_150> AgradCdfLogBetaProportion_ffv_150;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_151> AgradCdfLogBetaProportion_ffv_151;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_152> AgradCdfLogBetaProportion_ffv_152;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_153> AgradCdfLogBetaProportion_ffv_153;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_154> AgradCdfLogBetaProportion_ffv_154;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_155> AgradCdfLogBetaProportion_ffv_155;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_156> AgradCdfLogBetaProportion_ffv_156;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_157> AgradCdfLogBetaProportion_ffv_157;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_158> AgradCdfLogBetaProportion_ffv_158;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_159> AgradCdfLogBetaProportion_ffv_159;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_160> AgradCdfLogBetaProportion_ffv_160;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_161> AgradCdfLogBetaProportion_ffv_161;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_162> AgradCdfLogBetaProportion_ffv_162;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_163> AgradCdfLogBetaProportion_ffv_163;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_164> AgradCdfLogBetaProportion_ffv_164;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_165> AgradCdfLogBetaProportion_ffv_165;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_166> AgradCdfLogBetaProportion_ffv_166;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_167> AgradCdfLogBetaProportion_ffv_167;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_168> AgradCdfLogBetaProportion_ffv_168;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_169> AgradCdfLogBetaProportion_ffv_169;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_170> AgradCdfLogBetaProportion_ffv_170;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_171> AgradCdfLogBetaProportion_ffv_171;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_172> AgradCdfLogBetaProportion_ffv_172;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_173> AgradCdfLogBetaProportion_ffv_173;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_174> AgradCdfLogBetaProportion_ffv_174;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_175> AgradCdfLogBetaProportion_ffv_175;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_176> AgradCdfLogBetaProportion_ffv_176;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_177> AgradCdfLogBetaProportion_ffv_177;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_178> AgradCdfLogBetaProportion_ffv_178;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_179> AgradCdfLogBetaProportion_ffv_179;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_180> AgradCdfLogBetaProportion_ffv_180;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_181> AgradCdfLogBetaProportion_ffv_181;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_182> AgradCdfLogBetaProportion_ffv_182;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_183> AgradCdfLogBetaProportion_ffv_183;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_184> AgradCdfLogBetaProportion_ffv_184;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_185> AgradCdfLogBetaProportion_ffv_185;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_186> AgradCdfLogBetaProportion_ffv_186;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_187> AgradCdfLogBetaProportion_ffv_187;
+typedef std::tuple<AgradCdfLogBetaProportion, type_ffv_188> AgradCdfLogBetaProportion_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_100, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_101, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_102, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_103, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_104, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_105, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_106, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_107, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_108, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_109, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_110, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_111, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_112, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_113, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_114, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_115, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_116, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_117, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_118, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_119, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_120, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_121, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_122, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_123, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_124, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_125, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_126, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_127, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_128, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_129, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_130, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_131, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_132, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_133, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_134, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_135, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_136, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_137, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_138, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_139, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_140, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_141, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_142, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_143, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_144, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_145, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_146, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_147, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_148, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_149, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_150, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_151, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_152, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_153, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_154, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_155, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_156, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_157, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_158, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_159, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_160, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_161, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_162, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_163, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_164, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_165, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_166, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_167, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_168, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_169, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_170, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_171, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_172, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_173, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_174, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_175, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_176, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_177, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_178, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_179, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_180, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_181, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_182, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_183, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_184, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_185, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_186, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_187, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_ffv_188, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_100> AgradCdfLogBetaProportion_v_100;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_101> AgradCdfLogBetaProportion_v_101;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_102> AgradCdfLogBetaProportion_v_102;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_103> AgradCdfLogBetaProportion_v_103;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_104> AgradCdfLogBetaProportion_v_104;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_105> AgradCdfLogBetaProportion_v_105;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_106> AgradCdfLogBetaProportion_v_106;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_107> AgradCdfLogBetaProportion_v_107;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_108> AgradCdfLogBetaProportion_v_108;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_109> AgradCdfLogBetaProportion_v_109;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_110> AgradCdfLogBetaProportion_v_110;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_111> AgradCdfLogBetaProportion_v_111;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_112> AgradCdfLogBetaProportion_v_112;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_113> AgradCdfLogBetaProportion_v_113;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_114> AgradCdfLogBetaProportion_v_114;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_115> AgradCdfLogBetaProportion_v_115;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_116> AgradCdfLogBetaProportion_v_116;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_117> AgradCdfLogBetaProportion_v_117;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_118> AgradCdfLogBetaProportion_v_118;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_119> AgradCdfLogBetaProportion_v_119;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_120> AgradCdfLogBetaProportion_v_120;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_121> AgradCdfLogBetaProportion_v_121;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_122> AgradCdfLogBetaProportion_v_122;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_123> AgradCdfLogBetaProportion_v_123;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_124> AgradCdfLogBetaProportion_v_124;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_125> AgradCdfLogBetaProportion_v_125;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_126> AgradCdfLogBetaProportion_v_126;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_127> AgradCdfLogBetaProportion_v_127;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_128> AgradCdfLogBetaProportion_v_128;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_129> AgradCdfLogBetaProportion_v_129;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_130> AgradCdfLogBetaProportion_v_130;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_131> AgradCdfLogBetaProportion_v_131;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_132> AgradCdfLogBetaProportion_v_132;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_133> AgradCdfLogBetaProportion_v_133;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_134> AgradCdfLogBetaProportion_v_134;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_135> AgradCdfLogBetaProportion_v_135;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_136> AgradCdfLogBetaProportion_v_136;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_137> AgradCdfLogBetaProportion_v_137;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_138> AgradCdfLogBetaProportion_v_138;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_139> AgradCdfLogBetaProportion_v_139;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_140> AgradCdfLogBetaProportion_v_140;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_141> AgradCdfLogBetaProportion_v_141;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_142> AgradCdfLogBetaProportion_v_142;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_143> AgradCdfLogBetaProportion_v_143;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_144> AgradCdfLogBetaProportion_v_144;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_145> AgradCdfLogBetaProportion_v_145;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_146> AgradCdfLogBetaProportion_v_146;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_147> AgradCdfLogBetaProportion_v_147;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_148> AgradCdfLogBetaProportion_v_148;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_149> AgradCdfLogBetaProportion_v_149;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_150> AgradCdfLogBetaProportion_v_150;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_151> AgradCdfLogBetaProportion_v_151;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_152> AgradCdfLogBetaProportion_v_152;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_153> AgradCdfLogBetaProportion_v_153;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_154> AgradCdfLogBetaProportion_v_154;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_155> AgradCdfLogBetaProportion_v_155;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_156> AgradCdfLogBetaProportion_v_156;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_157> AgradCdfLogBetaProportion_v_157;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_158> AgradCdfLogBetaProportion_v_158;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_159> AgradCdfLogBetaProportion_v_159;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_160> AgradCdfLogBetaProportion_v_160;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_161> AgradCdfLogBetaProportion_v_161;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_162> AgradCdfLogBetaProportion_v_162;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_163> AgradCdfLogBetaProportion_v_163;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_164> AgradCdfLogBetaProportion_v_164;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_165> AgradCdfLogBetaProportion_v_165;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_166> AgradCdfLogBetaProportion_v_166;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_167> AgradCdfLogBetaProportion_v_167;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_168> AgradCdfLogBetaProportion_v_168;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_169> AgradCdfLogBetaProportion_v_169;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_170> AgradCdfLogBetaProportion_v_170;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_171> AgradCdfLogBetaProportion_v_171;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_172> AgradCdfLogBetaProportion_v_172;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_173> AgradCdfLogBetaProportion_v_173;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_174> AgradCdfLogBetaProportion_v_174;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_175> AgradCdfLogBetaProportion_v_175;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_176> AgradCdfLogBetaProportion_v_176;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_177> AgradCdfLogBetaProportion_v_177;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_178> AgradCdfLogBetaProportion_v_178;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_179> AgradCdfLogBetaProportion_v_179;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_180> AgradCdfLogBetaProportion_v_180;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_181> AgradCdfLogBetaProportion_v_181;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_182> AgradCdfLogBetaProportion_v_182;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_183> AgradCdfLogBetaProportion_v_183;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_184> AgradCdfLogBetaProportion_v_184;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_185> AgradCdfLogBetaProportion_v_185;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_186> AgradCdfLogBetaProportion_v_186;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_187> AgradCdfLogBetaProportion_v_187;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_188> AgradCdfLogBetaProportion_v_188;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_189> AgradCdfLogBetaProportion_v_189;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_190> AgradCdfLogBetaProportion_v_190;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_191> AgradCdfLogBetaProportion_v_191;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_192> AgradCdfLogBetaProportion_v_192;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_193> AgradCdfLogBetaProportion_v_193;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_194> AgradCdfLogBetaProportion_v_194;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_195> AgradCdfLogBetaProportion_v_195;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_196> AgradCdfLogBetaProportion_v_196;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_197> AgradCdfLogBetaProportion_v_197;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_198> AgradCdfLogBetaProportion_v_198;
+typedef std::tuple<AgradCdfLogBetaProportion, type_v_199> AgradCdfLogBetaProportion_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_100, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_101, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_102, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_103, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_104, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_105, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_106, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_107, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_108, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_109, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_110, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_111, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_112, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_113, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_114, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_115, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_116, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_117, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_118, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_119, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_120, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_121, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_122, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_123, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_124, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_125, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_126, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_127, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_128, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_129, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_130, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_131, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_132, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_133, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_134, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_135, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_136, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_137, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_138, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_139, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_140, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_141, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_142, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_143, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_144, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_145, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_146, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_147, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_148, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_149, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_150, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_151, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_152, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_153, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_154, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_155, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_156, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_157, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_158, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_159, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_160, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_161, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_162, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_163, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_164, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_165, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_166, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_167, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_168, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_169, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_170, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_171, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_172, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_173, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_174, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_175, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_176, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_177, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_178, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_179, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_180, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_181, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_182, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_183, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_184, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_185, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_186, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_187, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_188, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_189, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_190, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_191, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_192, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_193, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_194, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_195, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_196, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_197, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_198, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_v_199, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_v_199);
+
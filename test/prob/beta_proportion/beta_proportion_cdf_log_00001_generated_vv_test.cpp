@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/beta_proportion/beta_proportion_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_100> AgradCdfLogBetaProportion_vv_100;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_101> AgradCdfLogBetaProportion_vv_101;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_102> AgradCdfLogBetaProportion_vv_102;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_103> AgradCdfLogBetaProportion_vv_103;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_104> AgradCdfLogBetaProportion_vv_104;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_105> AgradCdfLogBetaProportion_vv_105;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_106> AgradCdfLogBetaProportion_vv_106;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_107> AgradCdfLogBetaProportion_vv_107;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_108> AgradCdfLogBetaProportion_vv_108;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_109> AgradCdfLogBetaProportion_vv_109;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_110> AgradCdfLogBetaProportion_vv_110;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_111> AgradCdfLogBetaProportion_vv_111;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_112> AgradCdfLogBetaProportion_vv_112;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_113> AgradCdfLogBetaProportion_vv_113;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_114> AgradCdfLogBetaProportion_vv_114;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_115> AgradCdfLogBetaProportion_vv_115;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_116> AgradCdfLogBetaProportion_vv_116;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_117> AgradCdfLogBetaProportion_vv_117;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_118> AgradCdfLogBetaProportion_vv_118;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_119> AgradCdfLogBetaProportion_vv_119;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_120> AgradCdfLogBetaProportion_vv_120;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_121> AgradCdfLogBetaProportion_vv_121;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_122> AgradCdfLogBetaProportion_vv_122;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_123> AgradCdfLogBetaProportion_vv_123;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_124> AgradCdfLogBetaProportion_vv_124;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_125> AgradCdfLogBetaProportion_vv_125;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_126> AgradCdfLogBetaProportion_vv_126;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_127> AgradCdfLogBetaProportion_vv_127;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_128> AgradCdfLogBetaProportion_vv_128;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_129> AgradCdfLogBetaProportion_vv_129;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_130> AgradCdfLogBetaProportion_vv_130;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_131> AgradCdfLogBetaProportion_vv_131;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_132> AgradCdfLogBetaProportion_vv_132;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_133> AgradCdfLogBetaProportion_vv_133;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_134> AgradCdfLogBetaProportion_vv_134;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_135> AgradCdfLogBetaProportion_vv_135;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_136> AgradCdfLogBetaProportion_vv_136;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_137> AgradCdfLogBetaProportion_vv_137;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_138> AgradCdfLogBetaProportion_vv_138;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_139> AgradCdfLogBetaProportion_vv_139;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_140> AgradCdfLogBetaProportion_vv_140;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_141> AgradCdfLogBetaProportion_vv_141;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_142> AgradCdfLogBetaProportion_vv_142;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_143> AgradCdfLogBetaProportion_vv_143;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_144> AgradCdfLogBetaProportion_vv_144;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_145> AgradCdfLogBetaProportion_vv_145;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_146> AgradCdfLogBetaProportion_vv_146;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_147> AgradCdfLogBetaProportion_vv_147;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_148> AgradCdfLogBetaProportion_vv_148;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_149> AgradCdfLogBetaProportion_vv_149;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_150> AgradCdfLogBetaProportion_vv_150;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_151> AgradCdfLogBetaProportion_vv_151;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_152> AgradCdfLogBetaProportion_vv_152;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_153> AgradCdfLogBetaProportion_vv_153;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_154> AgradCdfLogBetaProportion_vv_154;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_155> AgradCdfLogBetaProportion_vv_155;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_156> AgradCdfLogBetaProportion_vv_156;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_157> AgradCdfLogBetaProportion_vv_157;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_158> AgradCdfLogBetaProportion_vv_158;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_159> AgradCdfLogBetaProportion_vv_159;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_160> AgradCdfLogBetaProportion_vv_160;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_161> AgradCdfLogBetaProportion_vv_161;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_162> AgradCdfLogBetaProportion_vv_162;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_163> AgradCdfLogBetaProportion_vv_163;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_164> AgradCdfLogBetaProportion_vv_164;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_165> AgradCdfLogBetaProportion_vv_165;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_166> AgradCdfLogBetaProportion_vv_166;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_167> AgradCdfLogBetaProportion_vv_167;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_168> AgradCdfLogBetaProportion_vv_168;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_169> AgradCdfLogBetaProportion_vv_169;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_170> AgradCdfLogBetaProportion_vv_170;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_171> AgradCdfLogBetaProportion_vv_171;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_172> AgradCdfLogBetaProportion_vv_172;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_173> AgradCdfLogBetaProportion_vv_173;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_174> AgradCdfLogBetaProportion_vv_174;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_175> AgradCdfLogBetaProportion_vv_175;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_176> AgradCdfLogBetaProportion_vv_176;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_177> AgradCdfLogBetaProportion_vv_177;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_178> AgradCdfLogBetaProportion_vv_178;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_179> AgradCdfLogBetaProportion_vv_179;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_180> AgradCdfLogBetaProportion_vv_180;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_181> AgradCdfLogBetaProportion_vv_181;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_182> AgradCdfLogBetaProportion_vv_182;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_183> AgradCdfLogBetaProportion_vv_183;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_184> AgradCdfLogBetaProportion_vv_184;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_185> AgradCdfLogBetaProportion_vv_185;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_186> AgradCdfLogBetaProportion_vv_186;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_187> AgradCdfLogBetaProportion_vv_187;
+typedef std::tuple<AgradCdfLogBetaProportion, type_vv_188> AgradCdfLogBetaProportion_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_100, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_101, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_102, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_103, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_104, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_105, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_106, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_107, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_108, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_109, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_110, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_111, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_112, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_113, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_114, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_115, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_116, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_117, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_118, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_119, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_120, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_121, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_122, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_123, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_124, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_125, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_126, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_127, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_128, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_129, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_130, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_131, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_132, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_133, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_134, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_135, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_136, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_137, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_138, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_139, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_140, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_141, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_142, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_143, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_144, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_145, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_146, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_147, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_148, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_149, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_150, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_151, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_152, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_153, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_154, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_155, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_156, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_157, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_158, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_159, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_160, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_161, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_162, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_163, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_164, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_165, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_166, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_167, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_168, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_169, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_170, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_171, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_172, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_173, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_174, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_175, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_176, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_177, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_178, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_179, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_180, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_181, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_182, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_183, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_184, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_185, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_186, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_187, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBetaProportion_vv_188, AgradCdfLogTestFixture, AgradCdfLogBetaProportion_vv_188);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_test.hpp>
+
+typedef std::tuple<int, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_9;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_0> AgradDistributionsBinomial_ffv_0;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_1> AgradDistributionsBinomial_ffv_1;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_2> AgradDistributionsBinomial_ffv_2;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_3> AgradDistributionsBinomial_ffv_3;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_4> AgradDistributionsBinomial_ffv_4;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_5> AgradDistributionsBinomial_ffv_5;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_6> AgradDistributionsBinomial_ffv_6;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_7> AgradDistributionsBinomial_ffv_7;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_8> AgradDistributionsBinomial_ffv_8;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_9> AgradDistributionsBinomial_ffv_9;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_10> AgradDistributionsBinomial_ffv_10;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_11> AgradDistributionsBinomial_ffv_11;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_12> AgradDistributionsBinomial_ffv_12;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_13> AgradDistributionsBinomial_ffv_13;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_14> AgradDistributionsBinomial_ffv_14;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_15> AgradDistributionsBinomial_ffv_15;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_16> AgradDistributionsBinomial_ffv_16;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_17> AgradDistributionsBinomial_ffv_17;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_18> AgradDistributionsBinomial_ffv_18;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_19> AgradDistributionsBinomial_ffv_19;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_20> AgradDistributionsBinomial_ffv_20;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_21> AgradDistributionsBinomial_ffv_21;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_22> AgradDistributionsBinomial_ffv_22;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_23> AgradDistributionsBinomial_ffv_23;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_24> AgradDistributionsBinomial_ffv_24;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_25> AgradDistributionsBinomial_ffv_25;
+typedef std::tuple<AgradDistributionsBinomial, type_ffv_26> AgradDistributionsBinomial_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_0, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_1, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_2, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_3, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_4, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_5, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_6, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_7, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_8, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_9, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_10, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_11, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_12, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_13, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_14, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_15, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_16, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_17, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_18, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_19, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_20, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_21, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_22, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_23, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_24, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_25, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_ffv_26, AgradDistributionTestFixture, AgradDistributionsBinomial_ffv_26);
+
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_test.hpp>
+
+typedef std::tuple<int, int, double, empty, empty, empty> type_v_0;
+typedef std::tuple<int, int, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, int, var, empty, empty, empty> type_v_3;
+typedef std::tuple<int, int, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, std::vector<int>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<int, std::vector<int>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<std::vector<int>, int, double, empty, empty, empty> type_v_18;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<std::vector<int>, int, var, empty, empty, empty> type_v_21;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, empty, empty, empty> type_v_36;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, empty, empty, empty> type_v_39;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+
+typedef std::tuple<AgradDistributionsBinomial, type_v_0> AgradDistributionsBinomial_v_0;
+typedef std::tuple<AgradDistributionsBinomial, type_v_1> AgradDistributionsBinomial_v_1;
+typedef std::tuple<AgradDistributionsBinomial, type_v_2> AgradDistributionsBinomial_v_2;
+typedef std::tuple<AgradDistributionsBinomial, type_v_3> AgradDistributionsBinomial_v_3;
+typedef std::tuple<AgradDistributionsBinomial, type_v_4> AgradDistributionsBinomial_v_4;
+typedef std::tuple<AgradDistributionsBinomial, type_v_5> AgradDistributionsBinomial_v_5;
+typedef std::tuple<AgradDistributionsBinomial, type_v_6> AgradDistributionsBinomial_v_6;
+typedef std::tuple<AgradDistributionsBinomial, type_v_7> AgradDistributionsBinomial_v_7;
+typedef std::tuple<AgradDistributionsBinomial, type_v_8> AgradDistributionsBinomial_v_8;
+typedef std::tuple<AgradDistributionsBinomial, type_v_9> AgradDistributionsBinomial_v_9;
+typedef std::tuple<AgradDistributionsBinomial, type_v_10> AgradDistributionsBinomial_v_10;
+typedef std::tuple<AgradDistributionsBinomial, type_v_11> AgradDistributionsBinomial_v_11;
+typedef std::tuple<AgradDistributionsBinomial, type_v_12> AgradDistributionsBinomial_v_12;
+typedef std::tuple<AgradDistributionsBinomial, type_v_13> AgradDistributionsBinomial_v_13;
+typedef std::tuple<AgradDistributionsBinomial, type_v_14> AgradDistributionsBinomial_v_14;
+typedef std::tuple<AgradDistributionsBinomial, type_v_15> AgradDistributionsBinomial_v_15;
+typedef std::tuple<AgradDistributionsBinomial, type_v_16> AgradDistributionsBinomial_v_16;
+typedef std::tuple<AgradDistributionsBinomial, type_v_17> AgradDistributionsBinomial_v_17;
+typedef std::tuple<AgradDistributionsBinomial, type_v_18> AgradDistributionsBinomial_v_18;
+typedef std::tuple<AgradDistributionsBinomial, type_v_19> AgradDistributionsBinomial_v_19;
+typedef std::tuple<AgradDistributionsBinomial, type_v_20> AgradDistributionsBinomial_v_20;
+typedef std::tuple<AgradDistributionsBinomial, type_v_21> AgradDistributionsBinomial_v_21;
+typedef std::tuple<AgradDistributionsBinomial, type_v_22> AgradDistributionsBinomial_v_22;
+typedef std::tuple<AgradDistributionsBinomial, type_v_23> AgradDistributionsBinomial_v_23;
+typedef std::tuple<AgradDistributionsBinomial, type_v_24> AgradDistributionsBinomial_v_24;
+typedef std::tuple<AgradDistributionsBinomial, type_v_25> AgradDistributionsBinomial_v_25;
+typedef std::tuple<AgradDistributionsBinomial, type_v_26> AgradDistributionsBinomial_v_26;
+typedef std::tuple<AgradDistributionsBinomial, type_v_27> AgradDistributionsBinomial_v_27;
+typedef std::tuple<AgradDistributionsBinomial, type_v_28> AgradDistributionsBinomial_v_28;
+typedef std::tuple<AgradDistributionsBinomial, type_v_29> AgradDistributionsBinomial_v_29;
+typedef std::tuple<AgradDistributionsBinomial, type_v_30> AgradDistributionsBinomial_v_30;
+typedef std::tuple<AgradDistributionsBinomial, type_v_31> AgradDistributionsBinomial_v_31;
+typedef std::tuple<AgradDistributionsBinomial, type_v_32> AgradDistributionsBinomial_v_32;
+typedef std::tuple<AgradDistributionsBinomial, type_v_33> AgradDistributionsBinomial_v_33;
+typedef std::tuple<AgradDistributionsBinomial, type_v_34> AgradDistributionsBinomial_v_34;
+typedef std::tuple<AgradDistributionsBinomial, type_v_35> AgradDistributionsBinomial_v_35;
+typedef std::tuple<AgradDistributionsBinomial, type_v_36> AgradDistributionsBinomial_v_36;
+typedef std::tuple<AgradDistributionsBinomial, type_v_37> AgradDistributionsBinomial_v_37;
+typedef std::tuple<AgradDistributionsBinomial, type_v_38> AgradDistributionsBinomial_v_38;
+typedef std::tuple<AgradDistributionsBinomial, type_v_39> AgradDistributionsBinomial_v_39;
+typedef std::tuple<AgradDistributionsBinomial, type_v_40> AgradDistributionsBinomial_v_40;
+typedef std::tuple<AgradDistributionsBinomial, type_v_41> AgradDistributionsBinomial_v_41;
+typedef std::tuple<AgradDistributionsBinomial, type_v_42> AgradDistributionsBinomial_v_42;
+typedef std::tuple<AgradDistributionsBinomial, type_v_43> AgradDistributionsBinomial_v_43;
+typedef std::tuple<AgradDistributionsBinomial, type_v_44> AgradDistributionsBinomial_v_44;
+typedef std::tuple<AgradDistributionsBinomial, type_v_45> AgradDistributionsBinomial_v_45;
+typedef std::tuple<AgradDistributionsBinomial, type_v_46> AgradDistributionsBinomial_v_46;
+typedef std::tuple<AgradDistributionsBinomial, type_v_47> AgradDistributionsBinomial_v_47;
+typedef std::tuple<AgradDistributionsBinomial, type_v_48> AgradDistributionsBinomial_v_48;
+typedef std::tuple<AgradDistributionsBinomial, type_v_49> AgradDistributionsBinomial_v_49;
+typedef std::tuple<AgradDistributionsBinomial, type_v_50> AgradDistributionsBinomial_v_50;
+typedef std::tuple<AgradDistributionsBinomial, type_v_51> AgradDistributionsBinomial_v_51;
+typedef std::tuple<AgradDistributionsBinomial, type_v_52> AgradDistributionsBinomial_v_52;
+typedef std::tuple<AgradDistributionsBinomial, type_v_53> AgradDistributionsBinomial_v_53;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_0, AgradDistributionTestFixture, AgradDistributionsBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_1, AgradDistributionTestFixture, AgradDistributionsBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_2, AgradDistributionTestFixture, AgradDistributionsBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_3, AgradDistributionTestFixture, AgradDistributionsBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_4, AgradDistributionTestFixture, AgradDistributionsBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_5, AgradDistributionTestFixture, AgradDistributionsBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_6, AgradDistributionTestFixture, AgradDistributionsBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_7, AgradDistributionTestFixture, AgradDistributionsBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_8, AgradDistributionTestFixture, AgradDistributionsBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_9, AgradDistributionTestFixture, AgradDistributionsBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_10, AgradDistributionTestFixture, AgradDistributionsBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_11, AgradDistributionTestFixture, AgradDistributionsBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_12, AgradDistributionTestFixture, AgradDistributionsBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_13, AgradDistributionTestFixture, AgradDistributionsBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_14, AgradDistributionTestFixture, AgradDistributionsBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_15, AgradDistributionTestFixture, AgradDistributionsBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_16, AgradDistributionTestFixture, AgradDistributionsBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_17, AgradDistributionTestFixture, AgradDistributionsBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_18, AgradDistributionTestFixture, AgradDistributionsBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_19, AgradDistributionTestFixture, AgradDistributionsBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_20, AgradDistributionTestFixture, AgradDistributionsBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_21, AgradDistributionTestFixture, AgradDistributionsBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_22, AgradDistributionTestFixture, AgradDistributionsBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_23, AgradDistributionTestFixture, AgradDistributionsBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_24, AgradDistributionTestFixture, AgradDistributionsBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_25, AgradDistributionTestFixture, AgradDistributionsBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_26, AgradDistributionTestFixture, AgradDistributionsBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_27, AgradDistributionTestFixture, AgradDistributionsBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_28, AgradDistributionTestFixture, AgradDistributionsBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_29, AgradDistributionTestFixture, AgradDistributionsBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_30, AgradDistributionTestFixture, AgradDistributionsBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_31, AgradDistributionTestFixture, AgradDistributionsBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_32, AgradDistributionTestFixture, AgradDistributionsBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_33, AgradDistributionTestFixture, AgradDistributionsBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_34, AgradDistributionTestFixture, AgradDistributionsBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_35, AgradDistributionTestFixture, AgradDistributionsBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_36, AgradDistributionTestFixture, AgradDistributionsBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_37, AgradDistributionTestFixture, AgradDistributionsBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_38, AgradDistributionTestFixture, AgradDistributionsBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_39, AgradDistributionTestFixture, AgradDistributionsBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_40, AgradDistributionTestFixture, AgradDistributionsBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_41, AgradDistributionTestFixture, AgradDistributionsBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_42, AgradDistributionTestFixture, AgradDistributionsBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_43, AgradDistributionTestFixture, AgradDistributionsBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_44, AgradDistributionTestFixture, AgradDistributionsBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_45, AgradDistributionTestFixture, AgradDistributionsBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_46, AgradDistributionTestFixture, AgradDistributionsBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_47, AgradDistributionTestFixture, AgradDistributionsBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_48, AgradDistributionTestFixture, AgradDistributionsBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_49, AgradDistributionTestFixture, AgradDistributionsBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_50, AgradDistributionTestFixture, AgradDistributionsBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_51, AgradDistributionTestFixture, AgradDistributionsBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_52, AgradDistributionTestFixture, AgradDistributionsBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_v_53, AgradDistributionTestFixture, AgradDistributionsBinomial_v_53);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_test.hpp>
+
+typedef std::tuple<int, int, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, int, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<int, std::vector<int>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<std::vector<int>, int, var, empty, empty, empty> type_vv_9;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, empty, empty, empty> type_vv_10;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, empty, empty, empty> type_vv_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradDistributionsBinomial, type_vv_0> AgradDistributionsBinomial_vv_0;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_1> AgradDistributionsBinomial_vv_1;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_2> AgradDistributionsBinomial_vv_2;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_3> AgradDistributionsBinomial_vv_3;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_4> AgradDistributionsBinomial_vv_4;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_5> AgradDistributionsBinomial_vv_5;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_6> AgradDistributionsBinomial_vv_6;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_7> AgradDistributionsBinomial_vv_7;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_8> AgradDistributionsBinomial_vv_8;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_9> AgradDistributionsBinomial_vv_9;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_10> AgradDistributionsBinomial_vv_10;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_11> AgradDistributionsBinomial_vv_11;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_12> AgradDistributionsBinomial_vv_12;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_13> AgradDistributionsBinomial_vv_13;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_14> AgradDistributionsBinomial_vv_14;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_15> AgradDistributionsBinomial_vv_15;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_16> AgradDistributionsBinomial_vv_16;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_17> AgradDistributionsBinomial_vv_17;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_18> AgradDistributionsBinomial_vv_18;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_19> AgradDistributionsBinomial_vv_19;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_20> AgradDistributionsBinomial_vv_20;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_21> AgradDistributionsBinomial_vv_21;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_22> AgradDistributionsBinomial_vv_22;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_23> AgradDistributionsBinomial_vv_23;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_24> AgradDistributionsBinomial_vv_24;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_25> AgradDistributionsBinomial_vv_25;
+typedef std::tuple<AgradDistributionsBinomial, type_vv_26> AgradDistributionsBinomial_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_0, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_1, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_2, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_3, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_4, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_5, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_6, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_7, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_8, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_9, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_10, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_11, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_12, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_13, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_14, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_15, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_16, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_17, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_18, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_19, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_20, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_21, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_22, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_23, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_24, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_25, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomial_vv_26, AgradDistributionTestFixture, AgradDistributionsBinomial_vv_26);
+
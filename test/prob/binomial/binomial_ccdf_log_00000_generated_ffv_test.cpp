@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_9;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_0> AgradCcdfLogBinomial_ffv_0;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_1> AgradCcdfLogBinomial_ffv_1;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_2> AgradCcdfLogBinomial_ffv_2;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_3> AgradCcdfLogBinomial_ffv_3;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_4> AgradCcdfLogBinomial_ffv_4;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_5> AgradCcdfLogBinomial_ffv_5;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_6> AgradCcdfLogBinomial_ffv_6;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_7> AgradCcdfLogBinomial_ffv_7;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_8> AgradCcdfLogBinomial_ffv_8;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_9> AgradCcdfLogBinomial_ffv_9;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_10> AgradCcdfLogBinomial_ffv_10;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_11> AgradCcdfLogBinomial_ffv_11;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_12> AgradCcdfLogBinomial_ffv_12;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_13> AgradCcdfLogBinomial_ffv_13;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_14> AgradCcdfLogBinomial_ffv_14;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_15> AgradCcdfLogBinomial_ffv_15;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_16> AgradCcdfLogBinomial_ffv_16;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_17> AgradCcdfLogBinomial_ffv_17;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_18> AgradCcdfLogBinomial_ffv_18;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_19> AgradCcdfLogBinomial_ffv_19;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_20> AgradCcdfLogBinomial_ffv_20;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_21> AgradCcdfLogBinomial_ffv_21;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_22> AgradCcdfLogBinomial_ffv_22;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_23> AgradCcdfLogBinomial_ffv_23;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_24> AgradCcdfLogBinomial_ffv_24;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_25> AgradCcdfLogBinomial_ffv_25;
+typedef std::tuple<AgradCcdfLogBinomial, type_ffv_26> AgradCcdfLogBinomial_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_ffv_26);
+
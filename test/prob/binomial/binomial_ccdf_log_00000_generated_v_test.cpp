@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, int, double, empty, empty, empty> type_v_0;
+typedef std::tuple<int, int, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, int, var, empty, empty, empty> type_v_3;
+typedef std::tuple<int, int, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, std::vector<int>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<int, std::vector<int>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<std::vector<int>, int, double, empty, empty, empty> type_v_18;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<std::vector<int>, int, var, empty, empty, empty> type_v_21;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, empty, empty, empty> type_v_36;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, empty, empty, empty> type_v_39;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+
+typedef std::tuple<AgradCcdfLogBinomial, type_v_0> AgradCcdfLogBinomial_v_0;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_1> AgradCcdfLogBinomial_v_1;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_2> AgradCcdfLogBinomial_v_2;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_3> AgradCcdfLogBinomial_v_3;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_4> AgradCcdfLogBinomial_v_4;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_5> AgradCcdfLogBinomial_v_5;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_6> AgradCcdfLogBinomial_v_6;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_7> AgradCcdfLogBinomial_v_7;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_8> AgradCcdfLogBinomial_v_8;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_9> AgradCcdfLogBinomial_v_9;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_10> AgradCcdfLogBinomial_v_10;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_11> AgradCcdfLogBinomial_v_11;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_12> AgradCcdfLogBinomial_v_12;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_13> AgradCcdfLogBinomial_v_13;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_14> AgradCcdfLogBinomial_v_14;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_15> AgradCcdfLogBinomial_v_15;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_16> AgradCcdfLogBinomial_v_16;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_17> AgradCcdfLogBinomial_v_17;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_18> AgradCcdfLogBinomial_v_18;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_19> AgradCcdfLogBinomial_v_19;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_20> AgradCcdfLogBinomial_v_20;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_21> AgradCcdfLogBinomial_v_21;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_22> AgradCcdfLogBinomial_v_22;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_23> AgradCcdfLogBinomial_v_23;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_24> AgradCcdfLogBinomial_v_24;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_25> AgradCcdfLogBinomial_v_25;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_26> AgradCcdfLogBinomial_v_26;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_27> AgradCcdfLogBinomial_v_27;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_28> AgradCcdfLogBinomial_v_28;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_29> AgradCcdfLogBinomial_v_29;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_30> AgradCcdfLogBinomial_v_30;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_31> AgradCcdfLogBinomial_v_31;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_32> AgradCcdfLogBinomial_v_32;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_33> AgradCcdfLogBinomial_v_33;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_34> AgradCcdfLogBinomial_v_34;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_35> AgradCcdfLogBinomial_v_35;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_36> AgradCcdfLogBinomial_v_36;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_37> AgradCcdfLogBinomial_v_37;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_38> AgradCcdfLogBinomial_v_38;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_39> AgradCcdfLogBinomial_v_39;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_40> AgradCcdfLogBinomial_v_40;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_41> AgradCcdfLogBinomial_v_41;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_42> AgradCcdfLogBinomial_v_42;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_43> AgradCcdfLogBinomial_v_43;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_44> AgradCcdfLogBinomial_v_44;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_45> AgradCcdfLogBinomial_v_45;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_46> AgradCcdfLogBinomial_v_46;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_47> AgradCcdfLogBinomial_v_47;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_48> AgradCcdfLogBinomial_v_48;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_49> AgradCcdfLogBinomial_v_49;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_50> AgradCcdfLogBinomial_v_50;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_51> AgradCcdfLogBinomial_v_51;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_52> AgradCcdfLogBinomial_v_52;
+typedef std::tuple<AgradCcdfLogBinomial, type_v_53> AgradCcdfLogBinomial_v_53;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_0, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_1, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_2, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_3, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_4, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_5, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_6, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_7, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_8, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_9, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_10, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_11, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_12, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_13, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_14, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_15, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_16, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_17, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_18, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_19, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_20, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_21, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_22, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_23, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_24, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_25, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_26, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_27, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_28, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_29, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_30, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_31, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_32, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_33, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_34, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_35, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_36, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_37, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_38, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_39, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_40, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_41, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_42, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_43, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_44, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_45, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_46, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_47, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_48, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_49, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_50, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_51, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_52, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_v_53, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_v_53);
+
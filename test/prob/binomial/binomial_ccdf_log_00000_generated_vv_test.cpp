@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, int, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, int, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<int, std::vector<int>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<std::vector<int>, int, var, empty, empty, empty> type_vv_9;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, empty, empty, empty> type_vv_10;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, empty, empty, empty> type_vv_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_0> AgradCcdfLogBinomial_vv_0;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_1> AgradCcdfLogBinomial_vv_1;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_2> AgradCcdfLogBinomial_vv_2;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_3> AgradCcdfLogBinomial_vv_3;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_4> AgradCcdfLogBinomial_vv_4;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_5> AgradCcdfLogBinomial_vv_5;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_6> AgradCcdfLogBinomial_vv_6;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_7> AgradCcdfLogBinomial_vv_7;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_8> AgradCcdfLogBinomial_vv_8;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_9> AgradCcdfLogBinomial_vv_9;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_10> AgradCcdfLogBinomial_vv_10;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_11> AgradCcdfLogBinomial_vv_11;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_12> AgradCcdfLogBinomial_vv_12;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_13> AgradCcdfLogBinomial_vv_13;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_14> AgradCcdfLogBinomial_vv_14;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_15> AgradCcdfLogBinomial_vv_15;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_16> AgradCcdfLogBinomial_vv_16;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_17> AgradCcdfLogBinomial_vv_17;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_18> AgradCcdfLogBinomial_vv_18;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_19> AgradCcdfLogBinomial_vv_19;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_20> AgradCcdfLogBinomial_vv_20;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_21> AgradCcdfLogBinomial_vv_21;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_22> AgradCcdfLogBinomial_vv_22;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_23> AgradCcdfLogBinomial_vv_23;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_24> AgradCcdfLogBinomial_vv_24;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_25> AgradCcdfLogBinomial_vv_25;
+typedef std::tuple<AgradCcdfLogBinomial, type_vv_26> AgradCcdfLogBinomial_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogBinomial_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogBinomial_vv_26);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_cdf_test.hpp>
+
+typedef std::tuple<int, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_9;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradCdfBinomial, type_ffv_0> AgradCdfBinomial_ffv_0;
+typedef std::tuple<AgradCdfBinomial, type_ffv_1> AgradCdfBinomial_ffv_1;
+typedef std::tuple<AgradCdfBinomial, type_ffv_2> AgradCdfBinomial_ffv_2;
+typedef std::tuple<AgradCdfBinomial, type_ffv_3> AgradCdfBinomial_ffv_3;
+typedef std::tuple<AgradCdfBinomial, type_ffv_4> AgradCdfBinomial_ffv_4;
+typedef std::tuple<AgradCdfBinomial, type_ffv_5> AgradCdfBinomial_ffv_5;
+typedef std::tuple<AgradCdfBinomial, type_ffv_6> AgradCdfBinomial_ffv_6;
+typedef std::tuple<AgradCdfBinomial, type_ffv_7> AgradCdfBinomial_ffv_7;
+typedef std::tuple<AgradCdfBinomial, type_ffv_8> AgradCdfBinomial_ffv_8;
+typedef std::tuple<AgradCdfBinomial, type_ffv_9> AgradCdfBinomial_ffv_9;
+typedef std::tuple<AgradCdfBinomial, type_ffv_10> AgradCdfBinomial_ffv_10;
+typedef std::tuple<AgradCdfBinomial, type_ffv_11> AgradCdfBinomial_ffv_11;
+typedef std::tuple<AgradCdfBinomial, type_ffv_12> AgradCdfBinomial_ffv_12;
+typedef std::tuple<AgradCdfBinomial, type_ffv_13> AgradCdfBinomial_ffv_13;
+typedef std::tuple<AgradCdfBinomial, type_ffv_14> AgradCdfBinomial_ffv_14;
+typedef std::tuple<AgradCdfBinomial, type_ffv_15> AgradCdfBinomial_ffv_15;
+typedef std::tuple<AgradCdfBinomial, type_ffv_16> AgradCdfBinomial_ffv_16;
+typedef std::tuple<AgradCdfBinomial, type_ffv_17> AgradCdfBinomial_ffv_17;
+typedef std::tuple<AgradCdfBinomial, type_ffv_18> AgradCdfBinomial_ffv_18;
+typedef std::tuple<AgradCdfBinomial, type_ffv_19> AgradCdfBinomial_ffv_19;
+typedef std::tuple<AgradCdfBinomial, type_ffv_20> AgradCdfBinomial_ffv_20;
+typedef std::tuple<AgradCdfBinomial, type_ffv_21> AgradCdfBinomial_ffv_21;
+typedef std::tuple<AgradCdfBinomial, type_ffv_22> AgradCdfBinomial_ffv_22;
+typedef std::tuple<AgradCdfBinomial, type_ffv_23> AgradCdfBinomial_ffv_23;
+typedef std::tuple<AgradCdfBinomial, type_ffv_24> AgradCdfBinomial_ffv_24;
+typedef std::tuple<AgradCdfBinomial, type_ffv_25> AgradCdfBinomial_ffv_25;
+typedef std::tuple<AgradCdfBinomial, type_ffv_26> AgradCdfBinomial_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_0, AgradCdfTestFixture, AgradCdfBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_1, AgradCdfTestFixture, AgradCdfBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_2, AgradCdfTestFixture, AgradCdfBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_3, AgradCdfTestFixture, AgradCdfBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_4, AgradCdfTestFixture, AgradCdfBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_5, AgradCdfTestFixture, AgradCdfBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_6, AgradCdfTestFixture, AgradCdfBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_7, AgradCdfTestFixture, AgradCdfBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_8, AgradCdfTestFixture, AgradCdfBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_9, AgradCdfTestFixture, AgradCdfBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_10, AgradCdfTestFixture, AgradCdfBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_11, AgradCdfTestFixture, AgradCdfBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_12, AgradCdfTestFixture, AgradCdfBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_13, AgradCdfTestFixture, AgradCdfBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_14, AgradCdfTestFixture, AgradCdfBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_15, AgradCdfTestFixture, AgradCdfBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_16, AgradCdfTestFixture, AgradCdfBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_17, AgradCdfTestFixture, AgradCdfBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_18, AgradCdfTestFixture, AgradCdfBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_19, AgradCdfTestFixture, AgradCdfBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_20, AgradCdfTestFixture, AgradCdfBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_21, AgradCdfTestFixture, AgradCdfBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_22, AgradCdfTestFixture, AgradCdfBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_23, AgradCdfTestFixture, AgradCdfBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_24, AgradCdfTestFixture, AgradCdfBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_25, AgradCdfTestFixture, AgradCdfBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_ffv_26, AgradCdfTestFixture, AgradCdfBinomial_ffv_26);
+
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_cdf_test.hpp>
+
+typedef std::tuple<int, int, double, empty, empty, empty> type_v_0;
+typedef std::tuple<int, int, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, int, var, empty, empty, empty> type_v_3;
+typedef std::tuple<int, int, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, std::vector<int>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<int, std::vector<int>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<std::vector<int>, int, double, empty, empty, empty> type_v_18;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<std::vector<int>, int, var, empty, empty, empty> type_v_21;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, empty, empty, empty> type_v_36;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, empty, empty, empty> type_v_39;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+
+typedef std::tuple<AgradCdfBinomial, type_v_0> AgradCdfBinomial_v_0;
+typedef std::tuple<AgradCdfBinomial, type_v_1> AgradCdfBinomial_v_1;
+typedef std::tuple<AgradCdfBinomial, type_v_2> AgradCdfBinomial_v_2;
+typedef std::tuple<AgradCdfBinomial, type_v_3> AgradCdfBinomial_v_3;
+typedef std::tuple<AgradCdfBinomial, type_v_4> AgradCdfBinomial_v_4;
+typedef std::tuple<AgradCdfBinomial, type_v_5> AgradCdfBinomial_v_5;
+typedef std::tuple<AgradCdfBinomial, type_v_6> AgradCdfBinomial_v_6;
+typedef std::tuple<AgradCdfBinomial, type_v_7> AgradCdfBinomial_v_7;
+typedef std::tuple<AgradCdfBinomial, type_v_8> AgradCdfBinomial_v_8;
+typedef std::tuple<AgradCdfBinomial, type_v_9> AgradCdfBinomial_v_9;
+typedef std::tuple<AgradCdfBinomial, type_v_10> AgradCdfBinomial_v_10;
+typedef std::tuple<AgradCdfBinomial, type_v_11> AgradCdfBinomial_v_11;
+typedef std::tuple<AgradCdfBinomial, type_v_12> AgradCdfBinomial_v_12;
+typedef std::tuple<AgradCdfBinomial, type_v_13> AgradCdfBinomial_v_13;
+typedef std::tuple<AgradCdfBinomial, type_v_14> AgradCdfBinomial_v_14;
+typedef std::tuple<AgradCdfBinomial, type_v_15> AgradCdfBinomial_v_15;
+typedef std::tuple<AgradCdfBinomial, type_v_16> AgradCdfBinomial_v_16;
+typedef std::tuple<AgradCdfBinomial, type_v_17> AgradCdfBinomial_v_17;
+typedef std::tuple<AgradCdfBinomial, type_v_18> AgradCdfBinomial_v_18;
+typedef std::tuple<AgradCdfBinomial, type_v_19> AgradCdfBinomial_v_19;
+typedef std::tuple<AgradCdfBinomial, type_v_20> AgradCdfBinomial_v_20;
+typedef std::tuple<AgradCdfBinomial, type_v_21> AgradCdfBinomial_v_21;
+typedef std::tuple<AgradCdfBinomial, type_v_22> AgradCdfBinomial_v_22;
+typedef std::tuple<AgradCdfBinomial, type_v_23> AgradCdfBinomial_v_23;
+typedef std::tuple<AgradCdfBinomial, type_v_24> AgradCdfBinomial_v_24;
+typedef std::tuple<AgradCdfBinomial, type_v_25> AgradCdfBinomial_v_25;
+typedef std::tuple<AgradCdfBinomial, type_v_26> AgradCdfBinomial_v_26;
+typedef std::tuple<AgradCdfBinomial, type_v_27> AgradCdfBinomial_v_27;
+typedef std::tuple<AgradCdfBinomial, type_v_28> AgradCdfBinomial_v_28;
+typedef std::tuple<AgradCdfBinomial, type_v_29> AgradCdfBinomial_v_29;
+typedef std::tuple<AgradCdfBinomial, type_v_30> AgradCdfBinomial_v_30;
+typedef std::tuple<AgradCdfBinomial, type_v_31> AgradCdfBinomial_v_31;
+typedef std::tuple<AgradCdfBinomial, type_v_32> AgradCdfBinomial_v_32;
+typedef std::tuple<AgradCdfBinomial, type_v_33> AgradCdfBinomial_v_33;
+typedef std::tuple<AgradCdfBinomial, type_v_34> AgradCdfBinomial_v_34;
+typedef std::tuple<AgradCdfBinomial, type_v_35> AgradCdfBinomial_v_35;
+typedef std::tuple<AgradCdfBinomial, type_v_36> AgradCdfBinomial_v_36;
+typedef std::tuple<AgradCdfBinomial, type_v_37> AgradCdfBinomial_v_37;
+typedef std::tuple<AgradCdfBinomial, type_v_38> AgradCdfBinomial_v_38;
+typedef std::tuple<AgradCdfBinomial, type_v_39> AgradCdfBinomial_v_39;
+typedef std::tuple<AgradCdfBinomial, type_v_40> AgradCdfBinomial_v_40;
+typedef std::tuple<AgradCdfBinomial, type_v_41> AgradCdfBinomial_v_41;
+typedef std::tuple<AgradCdfBinomial, type_v_42> AgradCdfBinomial_v_42;
+typedef std::tuple<AgradCdfBinomial, type_v_43> AgradCdfBinomial_v_43;
+typedef std::tuple<AgradCdfBinomial, type_v_44> AgradCdfBinomial_v_44;
+typedef std::tuple<AgradCdfBinomial, type_v_45> AgradCdfBinomial_v_45;
+typedef std::tuple<AgradCdfBinomial, type_v_46> AgradCdfBinomial_v_46;
+typedef std::tuple<AgradCdfBinomial, type_v_47> AgradCdfBinomial_v_47;
+typedef std::tuple<AgradCdfBinomial, type_v_48> AgradCdfBinomial_v_48;
+typedef std::tuple<AgradCdfBinomial, type_v_49> AgradCdfBinomial_v_49;
+typedef std::tuple<AgradCdfBinomial, type_v_50> AgradCdfBinomial_v_50;
+typedef std::tuple<AgradCdfBinomial, type_v_51> AgradCdfBinomial_v_51;
+typedef std::tuple<AgradCdfBinomial, type_v_52> AgradCdfBinomial_v_52;
+typedef std::tuple<AgradCdfBinomial, type_v_53> AgradCdfBinomial_v_53;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_0, AgradCdfTestFixture, AgradCdfBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_1, AgradCdfTestFixture, AgradCdfBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_2, AgradCdfTestFixture, AgradCdfBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_3, AgradCdfTestFixture, AgradCdfBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_4, AgradCdfTestFixture, AgradCdfBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_5, AgradCdfTestFixture, AgradCdfBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_6, AgradCdfTestFixture, AgradCdfBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_7, AgradCdfTestFixture, AgradCdfBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_8, AgradCdfTestFixture, AgradCdfBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_9, AgradCdfTestFixture, AgradCdfBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_10, AgradCdfTestFixture, AgradCdfBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_11, AgradCdfTestFixture, AgradCdfBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_12, AgradCdfTestFixture, AgradCdfBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_13, AgradCdfTestFixture, AgradCdfBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_14, AgradCdfTestFixture, AgradCdfBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_15, AgradCdfTestFixture, AgradCdfBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_16, AgradCdfTestFixture, AgradCdfBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_17, AgradCdfTestFixture, AgradCdfBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_18, AgradCdfTestFixture, AgradCdfBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_19, AgradCdfTestFixture, AgradCdfBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_20, AgradCdfTestFixture, AgradCdfBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_21, AgradCdfTestFixture, AgradCdfBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_22, AgradCdfTestFixture, AgradCdfBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_23, AgradCdfTestFixture, AgradCdfBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_24, AgradCdfTestFixture, AgradCdfBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_25, AgradCdfTestFixture, AgradCdfBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_26, AgradCdfTestFixture, AgradCdfBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_27, AgradCdfTestFixture, AgradCdfBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_28, AgradCdfTestFixture, AgradCdfBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_29, AgradCdfTestFixture, AgradCdfBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_30, AgradCdfTestFixture, AgradCdfBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_31, AgradCdfTestFixture, AgradCdfBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_32, AgradCdfTestFixture, AgradCdfBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_33, AgradCdfTestFixture, AgradCdfBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_34, AgradCdfTestFixture, AgradCdfBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_35, AgradCdfTestFixture, AgradCdfBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_36, AgradCdfTestFixture, AgradCdfBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_37, AgradCdfTestFixture, AgradCdfBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_38, AgradCdfTestFixture, AgradCdfBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_39, AgradCdfTestFixture, AgradCdfBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_40, AgradCdfTestFixture, AgradCdfBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_41, AgradCdfTestFixture, AgradCdfBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_42, AgradCdfTestFixture, AgradCdfBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_43, AgradCdfTestFixture, AgradCdfBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_44, AgradCdfTestFixture, AgradCdfBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_45, AgradCdfTestFixture, AgradCdfBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_46, AgradCdfTestFixture, AgradCdfBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_47, AgradCdfTestFixture, AgradCdfBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_48, AgradCdfTestFixture, AgradCdfBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_49, AgradCdfTestFixture, AgradCdfBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_50, AgradCdfTestFixture, AgradCdfBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_51, AgradCdfTestFixture, AgradCdfBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_52, AgradCdfTestFixture, AgradCdfBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_v_53, AgradCdfTestFixture, AgradCdfBinomial_v_53);
+
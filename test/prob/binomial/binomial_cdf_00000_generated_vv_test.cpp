@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_cdf_test.hpp>
+
+typedef std::tuple<int, int, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, int, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<int, std::vector<int>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<std::vector<int>, int, var, empty, empty, empty> type_vv_9;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, empty, empty, empty> type_vv_10;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, empty, empty, empty> type_vv_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCdfBinomial, type_vv_0> AgradCdfBinomial_vv_0;
+typedef std::tuple<AgradCdfBinomial, type_vv_1> AgradCdfBinomial_vv_1;
+typedef std::tuple<AgradCdfBinomial, type_vv_2> AgradCdfBinomial_vv_2;
+typedef std::tuple<AgradCdfBinomial, type_vv_3> AgradCdfBinomial_vv_3;
+typedef std::tuple<AgradCdfBinomial, type_vv_4> AgradCdfBinomial_vv_4;
+typedef std::tuple<AgradCdfBinomial, type_vv_5> AgradCdfBinomial_vv_5;
+typedef std::tuple<AgradCdfBinomial, type_vv_6> AgradCdfBinomial_vv_6;
+typedef std::tuple<AgradCdfBinomial, type_vv_7> AgradCdfBinomial_vv_7;
+typedef std::tuple<AgradCdfBinomial, type_vv_8> AgradCdfBinomial_vv_8;
+typedef std::tuple<AgradCdfBinomial, type_vv_9> AgradCdfBinomial_vv_9;
+typedef std::tuple<AgradCdfBinomial, type_vv_10> AgradCdfBinomial_vv_10;
+typedef std::tuple<AgradCdfBinomial, type_vv_11> AgradCdfBinomial_vv_11;
+typedef std::tuple<AgradCdfBinomial, type_vv_12> AgradCdfBinomial_vv_12;
+typedef std::tuple<AgradCdfBinomial, type_vv_13> AgradCdfBinomial_vv_13;
+typedef std::tuple<AgradCdfBinomial, type_vv_14> AgradCdfBinomial_vv_14;
+typedef std::tuple<AgradCdfBinomial, type_vv_15> AgradCdfBinomial_vv_15;
+typedef std::tuple<AgradCdfBinomial, type_vv_16> AgradCdfBinomial_vv_16;
+typedef std::tuple<AgradCdfBinomial, type_vv_17> AgradCdfBinomial_vv_17;
+typedef std::tuple<AgradCdfBinomial, type_vv_18> AgradCdfBinomial_vv_18;
+typedef std::tuple<AgradCdfBinomial, type_vv_19> AgradCdfBinomial_vv_19;
+typedef std::tuple<AgradCdfBinomial, type_vv_20> AgradCdfBinomial_vv_20;
+typedef std::tuple<AgradCdfBinomial, type_vv_21> AgradCdfBinomial_vv_21;
+typedef std::tuple<AgradCdfBinomial, type_vv_22> AgradCdfBinomial_vv_22;
+typedef std::tuple<AgradCdfBinomial, type_vv_23> AgradCdfBinomial_vv_23;
+typedef std::tuple<AgradCdfBinomial, type_vv_24> AgradCdfBinomial_vv_24;
+typedef std::tuple<AgradCdfBinomial, type_vv_25> AgradCdfBinomial_vv_25;
+typedef std::tuple<AgradCdfBinomial, type_vv_26> AgradCdfBinomial_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_0, AgradCdfTestFixture, AgradCdfBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_1, AgradCdfTestFixture, AgradCdfBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_2, AgradCdfTestFixture, AgradCdfBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_3, AgradCdfTestFixture, AgradCdfBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_4, AgradCdfTestFixture, AgradCdfBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_5, AgradCdfTestFixture, AgradCdfBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_6, AgradCdfTestFixture, AgradCdfBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_7, AgradCdfTestFixture, AgradCdfBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_8, AgradCdfTestFixture, AgradCdfBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_9, AgradCdfTestFixture, AgradCdfBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_10, AgradCdfTestFixture, AgradCdfBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_11, AgradCdfTestFixture, AgradCdfBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_12, AgradCdfTestFixture, AgradCdfBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_13, AgradCdfTestFixture, AgradCdfBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_14, AgradCdfTestFixture, AgradCdfBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_15, AgradCdfTestFixture, AgradCdfBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_16, AgradCdfTestFixture, AgradCdfBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_17, AgradCdfTestFixture, AgradCdfBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_18, AgradCdfTestFixture, AgradCdfBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_19, AgradCdfTestFixture, AgradCdfBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_20, AgradCdfTestFixture, AgradCdfBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_21, AgradCdfTestFixture, AgradCdfBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_22, AgradCdfTestFixture, AgradCdfBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_23, AgradCdfTestFixture, AgradCdfBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_24, AgradCdfTestFixture, AgradCdfBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_25, AgradCdfTestFixture, AgradCdfBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfBinomial_vv_26, AgradCdfTestFixture, AgradCdfBinomial_vv_26);
+
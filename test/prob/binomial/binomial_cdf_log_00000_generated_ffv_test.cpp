@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_9;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_0> AgradCdfLogBinomial_ffv_0;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_1> AgradCdfLogBinomial_ffv_1;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_2> AgradCdfLogBinomial_ffv_2;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_3> AgradCdfLogBinomial_ffv_3;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_4> AgradCdfLogBinomial_ffv_4;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_5> AgradCdfLogBinomial_ffv_5;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_6> AgradCdfLogBinomial_ffv_6;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_7> AgradCdfLogBinomial_ffv_7;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_8> AgradCdfLogBinomial_ffv_8;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_9> AgradCdfLogBinomial_ffv_9;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_10> AgradCdfLogBinomial_ffv_10;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_11> AgradCdfLogBinomial_ffv_11;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_12> AgradCdfLogBinomial_ffv_12;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_13> AgradCdfLogBinomial_ffv_13;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_14> AgradCdfLogBinomial_ffv_14;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_15> AgradCdfLogBinomial_ffv_15;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_16> AgradCdfLogBinomial_ffv_16;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_17> AgradCdfLogBinomial_ffv_17;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_18> AgradCdfLogBinomial_ffv_18;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_19> AgradCdfLogBinomial_ffv_19;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_20> AgradCdfLogBinomial_ffv_20;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_21> AgradCdfLogBinomial_ffv_21;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_22> AgradCdfLogBinomial_ffv_22;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_23> AgradCdfLogBinomial_ffv_23;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_24> AgradCdfLogBinomial_ffv_24;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_25> AgradCdfLogBinomial_ffv_25;
+typedef std::tuple<AgradCdfLogBinomial, type_ffv_26> AgradCdfLogBinomial_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_0, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_1, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_2, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_3, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_4, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_5, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_6, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_7, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_8, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_9, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_10, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_11, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_12, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_13, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_14, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_15, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_16, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_17, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_18, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_19, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_20, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_21, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_22, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_23, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_24, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_25, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_ffv_26, AgradCdfLogTestFixture, AgradCdfLogBinomial_ffv_26);
+
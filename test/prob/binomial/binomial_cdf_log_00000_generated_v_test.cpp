@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, int, double, empty, empty, empty> type_v_0;
+typedef std::tuple<int, int, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, int, var, empty, empty, empty> type_v_3;
+typedef std::tuple<int, int, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, std::vector<int>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<int, std::vector<int>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<std::vector<int>, int, double, empty, empty, empty> type_v_18;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<std::vector<int>, int, var, empty, empty, empty> type_v_21;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, empty, empty, empty> type_v_36;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, empty, empty, empty> type_v_39;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+
+typedef std::tuple<AgradCdfLogBinomial, type_v_0> AgradCdfLogBinomial_v_0;
+typedef std::tuple<AgradCdfLogBinomial, type_v_1> AgradCdfLogBinomial_v_1;
+typedef std::tuple<AgradCdfLogBinomial, type_v_2> AgradCdfLogBinomial_v_2;
+typedef std::tuple<AgradCdfLogBinomial, type_v_3> AgradCdfLogBinomial_v_3;
+typedef std::tuple<AgradCdfLogBinomial, type_v_4> AgradCdfLogBinomial_v_4;
+typedef std::tuple<AgradCdfLogBinomial, type_v_5> AgradCdfLogBinomial_v_5;
+typedef std::tuple<AgradCdfLogBinomial, type_v_6> AgradCdfLogBinomial_v_6;
+typedef std::tuple<AgradCdfLogBinomial, type_v_7> AgradCdfLogBinomial_v_7;
+typedef std::tuple<AgradCdfLogBinomial, type_v_8> AgradCdfLogBinomial_v_8;
+typedef std::tuple<AgradCdfLogBinomial, type_v_9> AgradCdfLogBinomial_v_9;
+typedef std::tuple<AgradCdfLogBinomial, type_v_10> AgradCdfLogBinomial_v_10;
+typedef std::tuple<AgradCdfLogBinomial, type_v_11> AgradCdfLogBinomial_v_11;
+typedef std::tuple<AgradCdfLogBinomial, type_v_12> AgradCdfLogBinomial_v_12;
+typedef std::tuple<AgradCdfLogBinomial, type_v_13> AgradCdfLogBinomial_v_13;
+typedef std::tuple<AgradCdfLogBinomial, type_v_14> AgradCdfLogBinomial_v_14;
+typedef std::tuple<AgradCdfLogBinomial, type_v_15> AgradCdfLogBinomial_v_15;
+typedef std::tuple<AgradCdfLogBinomial, type_v_16> AgradCdfLogBinomial_v_16;
+typedef std::tuple<AgradCdfLogBinomial, type_v_17> AgradCdfLogBinomial_v_17;
+typedef std::tuple<AgradCdfLogBinomial, type_v_18> AgradCdfLogBinomial_v_18;
+typedef std::tuple<AgradCdfLogBinomial, type_v_19> AgradCdfLogBinomial_v_19;
+typedef std::tuple<AgradCdfLogBinomial, type_v_20> AgradCdfLogBinomial_v_20;
+typedef std::tuple<AgradCdfLogBinomial, type_v_21> AgradCdfLogBinomial_v_21;
+typedef std::tuple<AgradCdfLogBinomial, type_v_22> AgradCdfLogBinomial_v_22;
+typedef std::tuple<AgradCdfLogBinomial, type_v_23> AgradCdfLogBinomial_v_23;
+typedef std::tuple<AgradCdfLogBinomial, type_v_24> AgradCdfLogBinomial_v_24;
+typedef std::tuple<AgradCdfLogBinomial, type_v_25> AgradCdfLogBinomial_v_25;
+typedef std::tuple<AgradCdfLogBinomial, type_v_26> AgradCdfLogBinomial_v_26;
+typedef std::tuple<AgradCdfLogBinomial, type_v_27> AgradCdfLogBinomial_v_27;
+typedef std::tuple<AgradCdfLogBinomial, type_v_28> AgradCdfLogBinomial_v_28;
+typedef std::tuple<AgradCdfLogBinomial, type_v_29> AgradCdfLogBinomial_v_29;
+typedef std::tuple<AgradCdfLogBinomial, type_v_30> AgradCdfLogBinomial_v_30;
+typedef std::tuple<AgradCdfLogBinomial, type_v_31> AgradCdfLogBinomial_v_31;
+typedef std::tuple<AgradCdfLogBinomial, type_v_32> AgradCdfLogBinomial_v_32;
+typedef std::tuple<AgradCdfLogBinomial, type_v_33> AgradCdfLogBinomial_v_33;
+typedef std::tuple<AgradCdfLogBinomial, type_v_34> AgradCdfLogBinomial_v_34;
+typedef std::tuple<AgradCdfLogBinomial, type_v_35> AgradCdfLogBinomial_v_35;
+typedef std::tuple<AgradCdfLogBinomial, type_v_36> AgradCdfLogBinomial_v_36;
+typedef std::tuple<AgradCdfLogBinomial, type_v_37> AgradCdfLogBinomial_v_37;
+typedef std::tuple<AgradCdfLogBinomial, type_v_38> AgradCdfLogBinomial_v_38;
+typedef std::tuple<AgradCdfLogBinomial, type_v_39> AgradCdfLogBinomial_v_39;
+typedef std::tuple<AgradCdfLogBinomial, type_v_40> AgradCdfLogBinomial_v_40;
+typedef std::tuple<AgradCdfLogBinomial, type_v_41> AgradCdfLogBinomial_v_41;
+typedef std::tuple<AgradCdfLogBinomial, type_v_42> AgradCdfLogBinomial_v_42;
+typedef std::tuple<AgradCdfLogBinomial, type_v_43> AgradCdfLogBinomial_v_43;
+typedef std::tuple<AgradCdfLogBinomial, type_v_44> AgradCdfLogBinomial_v_44;
+typedef std::tuple<AgradCdfLogBinomial, type_v_45> AgradCdfLogBinomial_v_45;
+typedef std::tuple<AgradCdfLogBinomial, type_v_46> AgradCdfLogBinomial_v_46;
+typedef std::tuple<AgradCdfLogBinomial, type_v_47> AgradCdfLogBinomial_v_47;
+typedef std::tuple<AgradCdfLogBinomial, type_v_48> AgradCdfLogBinomial_v_48;
+typedef std::tuple<AgradCdfLogBinomial, type_v_49> AgradCdfLogBinomial_v_49;
+typedef std::tuple<AgradCdfLogBinomial, type_v_50> AgradCdfLogBinomial_v_50;
+typedef std::tuple<AgradCdfLogBinomial, type_v_51> AgradCdfLogBinomial_v_51;
+typedef std::tuple<AgradCdfLogBinomial, type_v_52> AgradCdfLogBinomial_v_52;
+typedef std::tuple<AgradCdfLogBinomial, type_v_53> AgradCdfLogBinomial_v_53;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_0, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_1, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_2, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_3, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_4, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_5, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_6, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_7, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_8, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_9, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_10, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_11, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_12, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_13, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_14, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_15, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_16, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_17, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_18, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_19, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_20, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_21, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_22, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_23, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_24, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_25, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_26, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_27, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_28, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_29, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_30, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_31, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_32, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_33, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_34, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_35, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_36, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_37, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_38, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_39, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_40, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_41, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_42, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_43, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_44, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_45, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_46, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_47, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_48, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_49, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_50, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_51, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_52, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_v_53, AgradCdfLogTestFixture, AgradCdfLogBinomial_v_53);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, int, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, int, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<int, std::vector<int>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<std::vector<int>, int, var, empty, empty, empty> type_vv_9;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, empty, empty, empty> type_vv_10;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, empty, empty, empty> type_vv_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCdfLogBinomial, type_vv_0> AgradCdfLogBinomial_vv_0;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_1> AgradCdfLogBinomial_vv_1;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_2> AgradCdfLogBinomial_vv_2;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_3> AgradCdfLogBinomial_vv_3;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_4> AgradCdfLogBinomial_vv_4;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_5> AgradCdfLogBinomial_vv_5;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_6> AgradCdfLogBinomial_vv_6;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_7> AgradCdfLogBinomial_vv_7;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_8> AgradCdfLogBinomial_vv_8;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_9> AgradCdfLogBinomial_vv_9;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_10> AgradCdfLogBinomial_vv_10;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_11> AgradCdfLogBinomial_vv_11;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_12> AgradCdfLogBinomial_vv_12;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_13> AgradCdfLogBinomial_vv_13;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_14> AgradCdfLogBinomial_vv_14;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_15> AgradCdfLogBinomial_vv_15;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_16> AgradCdfLogBinomial_vv_16;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_17> AgradCdfLogBinomial_vv_17;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_18> AgradCdfLogBinomial_vv_18;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_19> AgradCdfLogBinomial_vv_19;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_20> AgradCdfLogBinomial_vv_20;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_21> AgradCdfLogBinomial_vv_21;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_22> AgradCdfLogBinomial_vv_22;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_23> AgradCdfLogBinomial_vv_23;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_24> AgradCdfLogBinomial_vv_24;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_25> AgradCdfLogBinomial_vv_25;
+typedef std::tuple<AgradCdfLogBinomial, type_vv_26> AgradCdfLogBinomial_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_0, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_1, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_2, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_3, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_4, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_5, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_6, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_7, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_8, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_9, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_10, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_11, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_12, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_13, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_14, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_15, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_16, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_17, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_18, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_19, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_20, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_21, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_22, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_23, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_24, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_25, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogBinomial_vv_26, AgradCdfLogTestFixture, AgradCdfLogBinomial_vv_26);
+
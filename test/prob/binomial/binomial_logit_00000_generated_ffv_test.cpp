@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_logit_test.hpp>
+
+typedef std::tuple<int, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<int, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<int, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<std::vector<int>, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_9;
+typedef std::tuple<std::vector<int>, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_0> AgradDistributionsBinomialLogit_ffv_0;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_1> AgradDistributionsBinomialLogit_ffv_1;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_2> AgradDistributionsBinomialLogit_ffv_2;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_3> AgradDistributionsBinomialLogit_ffv_3;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_4> AgradDistributionsBinomialLogit_ffv_4;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_5> AgradDistributionsBinomialLogit_ffv_5;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_6> AgradDistributionsBinomialLogit_ffv_6;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_7> AgradDistributionsBinomialLogit_ffv_7;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_8> AgradDistributionsBinomialLogit_ffv_8;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_9> AgradDistributionsBinomialLogit_ffv_9;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_10> AgradDistributionsBinomialLogit_ffv_10;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_11> AgradDistributionsBinomialLogit_ffv_11;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_12> AgradDistributionsBinomialLogit_ffv_12;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_13> AgradDistributionsBinomialLogit_ffv_13;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_14> AgradDistributionsBinomialLogit_ffv_14;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_15> AgradDistributionsBinomialLogit_ffv_15;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_16> AgradDistributionsBinomialLogit_ffv_16;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_17> AgradDistributionsBinomialLogit_ffv_17;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_18> AgradDistributionsBinomialLogit_ffv_18;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_19> AgradDistributionsBinomialLogit_ffv_19;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_20> AgradDistributionsBinomialLogit_ffv_20;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_21> AgradDistributionsBinomialLogit_ffv_21;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_22> AgradDistributionsBinomialLogit_ffv_22;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_23> AgradDistributionsBinomialLogit_ffv_23;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_24> AgradDistributionsBinomialLogit_ffv_24;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_25> AgradDistributionsBinomialLogit_ffv_25;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_ffv_26> AgradDistributionsBinomialLogit_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_0, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_1, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_2, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_3, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_4, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_5, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_6, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_7, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_8, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_9, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_10, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_11, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_12, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_13, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_14, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_15, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_16, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_17, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_18, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_19, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_20, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_21, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_22, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_23, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_24, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_25, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_ffv_26, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_ffv_26);
+
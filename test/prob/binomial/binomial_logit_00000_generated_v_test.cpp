@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_logit_test.hpp>
+
+typedef std::tuple<int, int, double, empty, empty, empty> type_v_0;
+typedef std::tuple<int, int, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, int, var, empty, empty, empty> type_v_3;
+typedef std::tuple<int, int, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, std::vector<int>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<int, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<int, std::vector<int>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<std::vector<int>, int, double, empty, empty, empty> type_v_18;
+typedef std::tuple<std::vector<int>, int, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<std::vector<int>, int, var, empty, empty, empty> type_v_21;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<int>, std::vector<int>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, double, empty, empty, empty> type_v_36;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, empty, empty, empty> type_v_39;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_0> AgradDistributionsBinomialLogit_v_0;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_1> AgradDistributionsBinomialLogit_v_1;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_2> AgradDistributionsBinomialLogit_v_2;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_3> AgradDistributionsBinomialLogit_v_3;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_4> AgradDistributionsBinomialLogit_v_4;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_5> AgradDistributionsBinomialLogit_v_5;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_6> AgradDistributionsBinomialLogit_v_6;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_7> AgradDistributionsBinomialLogit_v_7;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_8> AgradDistributionsBinomialLogit_v_8;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_9> AgradDistributionsBinomialLogit_v_9;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_10> AgradDistributionsBinomialLogit_v_10;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_11> AgradDistributionsBinomialLogit_v_11;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_12> AgradDistributionsBinomialLogit_v_12;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_13> AgradDistributionsBinomialLogit_v_13;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_14> AgradDistributionsBinomialLogit_v_14;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_15> AgradDistributionsBinomialLogit_v_15;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_16> AgradDistributionsBinomialLogit_v_16;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_17> AgradDistributionsBinomialLogit_v_17;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_18> AgradDistributionsBinomialLogit_v_18;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_19> AgradDistributionsBinomialLogit_v_19;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_20> AgradDistributionsBinomialLogit_v_20;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_21> AgradDistributionsBinomialLogit_v_21;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_22> AgradDistributionsBinomialLogit_v_22;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_23> AgradDistributionsBinomialLogit_v_23;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_24> AgradDistributionsBinomialLogit_v_24;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_25> AgradDistributionsBinomialLogit_v_25;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_26> AgradDistributionsBinomialLogit_v_26;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_27> AgradDistributionsBinomialLogit_v_27;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_28> AgradDistributionsBinomialLogit_v_28;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_29> AgradDistributionsBinomialLogit_v_29;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_30> AgradDistributionsBinomialLogit_v_30;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_31> AgradDistributionsBinomialLogit_v_31;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_32> AgradDistributionsBinomialLogit_v_32;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_33> AgradDistributionsBinomialLogit_v_33;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_34> AgradDistributionsBinomialLogit_v_34;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_35> AgradDistributionsBinomialLogit_v_35;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_36> AgradDistributionsBinomialLogit_v_36;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_37> AgradDistributionsBinomialLogit_v_37;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_38> AgradDistributionsBinomialLogit_v_38;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_39> AgradDistributionsBinomialLogit_v_39;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_40> AgradDistributionsBinomialLogit_v_40;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_41> AgradDistributionsBinomialLogit_v_41;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_42> AgradDistributionsBinomialLogit_v_42;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_43> AgradDistributionsBinomialLogit_v_43;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_44> AgradDistributionsBinomialLogit_v_44;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_45> AgradDistributionsBinomialLogit_v_45;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_46> AgradDistributionsBinomialLogit_v_46;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_47> AgradDistributionsBinomialLogit_v_47;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_48> AgradDistributionsBinomialLogit_v_48;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_49> AgradDistributionsBinomialLogit_v_49;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_50> AgradDistributionsBinomialLogit_v_50;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_51> AgradDistributionsBinomialLogit_v_51;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_52> AgradDistributionsBinomialLogit_v_52;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_v_53> AgradDistributionsBinomialLogit_v_53;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_0, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_1, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_2, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_3, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_4, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_5, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_6, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_7, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_8, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_9, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_10, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_11, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_12, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_13, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_14, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_15, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_16, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_17, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_18, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_19, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_20, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_21, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_22, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_23, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_24, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_25, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_26, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_27, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_28, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_29, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_30, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_31, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_32, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_33, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_34, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_35, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_36, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_37, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_38, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_39, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_40, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_41, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_42, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_43, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_44, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_45, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_46, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_47, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_48, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_49, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_50, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_51, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_52, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_v_53, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_v_53);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/binomial/binomial_logit_test.hpp>
+
+typedef std::tuple<int, int, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, int, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<int, std::vector<int>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<int, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<int, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<std::vector<int>, int, var, empty, empty, empty> type_vv_9;
+typedef std::tuple<std::vector<int>, int, std::vector<var>, empty, empty, empty> type_vv_10;
+typedef std::tuple<std::vector<int>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, var, empty, empty, empty> type_vv_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, empty, empty, empty> type_vv_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_0> AgradDistributionsBinomialLogit_vv_0;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_1> AgradDistributionsBinomialLogit_vv_1;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_2> AgradDistributionsBinomialLogit_vv_2;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_3> AgradDistributionsBinomialLogit_vv_3;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_4> AgradDistributionsBinomialLogit_vv_4;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_5> AgradDistributionsBinomialLogit_vv_5;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_6> AgradDistributionsBinomialLogit_vv_6;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_7> AgradDistributionsBinomialLogit_vv_7;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_8> AgradDistributionsBinomialLogit_vv_8;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_9> AgradDistributionsBinomialLogit_vv_9;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_10> AgradDistributionsBinomialLogit_vv_10;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_11> AgradDistributionsBinomialLogit_vv_11;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_12> AgradDistributionsBinomialLogit_vv_12;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_13> AgradDistributionsBinomialLogit_vv_13;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_14> AgradDistributionsBinomialLogit_vv_14;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_15> AgradDistributionsBinomialLogit_vv_15;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_16> AgradDistributionsBinomialLogit_vv_16;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_17> AgradDistributionsBinomialLogit_vv_17;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_18> AgradDistributionsBinomialLogit_vv_18;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_19> AgradDistributionsBinomialLogit_vv_19;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_20> AgradDistributionsBinomialLogit_vv_20;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_21> AgradDistributionsBinomialLogit_vv_21;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_22> AgradDistributionsBinomialLogit_vv_22;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_23> AgradDistributionsBinomialLogit_vv_23;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_24> AgradDistributionsBinomialLogit_vv_24;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_25> AgradDistributionsBinomialLogit_vv_25;
+typedef std::tuple<AgradDistributionsBinomialLogit, type_vv_26> AgradDistributionsBinomialLogit_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_0, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_1, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_2, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_3, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_4, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_5, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_6, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_7, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_8, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_9, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_10, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_11, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_12, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_13, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_14, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_15, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_16, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_17, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_18, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_19, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_20, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_21, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_22, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_23, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_24, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_25, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsBinomialLogit_vv_26, AgradDistributionTestFixture, AgradDistributionsBinomialLogit_vv_26);
+
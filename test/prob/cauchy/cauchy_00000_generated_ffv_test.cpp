@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_0> AgradDistributionsCauchy_ffv_0;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_1> AgradDistributionsCauchy_ffv_1;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_2> AgradDistributionsCauchy_ffv_2;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_3> AgradDistributionsCauchy_ffv_3;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_4> AgradDistributionsCauchy_ffv_4;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_5> AgradDistributionsCauchy_ffv_5;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_6> AgradDistributionsCauchy_ffv_6;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_7> AgradDistributionsCauchy_ffv_7;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_8> AgradDistributionsCauchy_ffv_8;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_9> AgradDistributionsCauchy_ffv_9;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_10> AgradDistributionsCauchy_ffv_10;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_11> AgradDistributionsCauchy_ffv_11;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_12> AgradDistributionsCauchy_ffv_12;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_13> AgradDistributionsCauchy_ffv_13;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_14> AgradDistributionsCauchy_ffv_14;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_15> AgradDistributionsCauchy_ffv_15;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_16> AgradDistributionsCauchy_ffv_16;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_17> AgradDistributionsCauchy_ffv_17;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_18> AgradDistributionsCauchy_ffv_18;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_19> AgradDistributionsCauchy_ffv_19;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_20> AgradDistributionsCauchy_ffv_20;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_21> AgradDistributionsCauchy_ffv_21;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_22> AgradDistributionsCauchy_ffv_22;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_23> AgradDistributionsCauchy_ffv_23;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_24> AgradDistributionsCauchy_ffv_24;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_25> AgradDistributionsCauchy_ffv_25;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_26> AgradDistributionsCauchy_ffv_26;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_27> AgradDistributionsCauchy_ffv_27;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_28> AgradDistributionsCauchy_ffv_28;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_29> AgradDistributionsCauchy_ffv_29;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_30> AgradDistributionsCauchy_ffv_30;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_31> AgradDistributionsCauchy_ffv_31;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_32> AgradDistributionsCauchy_ffv_32;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_33> AgradDistributionsCauchy_ffv_33;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_34> AgradDistributionsCauchy_ffv_34;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_35> AgradDistributionsCauchy_ffv_35;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_36> AgradDistributionsCauchy_ffv_36;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_37> AgradDistributionsCauchy_ffv_37;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_38> AgradDistributionsCauchy_ffv_38;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_39> AgradDistributionsCauchy_ffv_39;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_40> AgradDistributionsCauchy_ffv_40;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_41> AgradDistributionsCauchy_ffv_41;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_42> AgradDistributionsCauchy_ffv_42;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_43> AgradDistributionsCauchy_ffv_43;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_44> AgradDistributionsCauchy_ffv_44;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_45> AgradDistributionsCauchy_ffv_45;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_46> AgradDistributionsCauchy_ffv_46;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_47> AgradDistributionsCauchy_ffv_47;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_48> AgradDistributionsCauchy_ffv_48;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_49> AgradDistributionsCauchy_ffv_49;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_50> AgradDistributionsCauchy_ffv_50;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_51> AgradDistributionsCauchy_ffv_51;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_52> AgradDistributionsCauchy_ffv_52;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_53> AgradDistributionsCauchy_ffv_53;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_54> AgradDistributionsCauchy_ffv_54;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_55> AgradDistributionsCauchy_ffv_55;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_56> AgradDistributionsCauchy_ffv_56;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_57> AgradDistributionsCauchy_ffv_57;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_58> AgradDistributionsCauchy_ffv_58;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_59> AgradDistributionsCauchy_ffv_59;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_60> AgradDistributionsCauchy_ffv_60;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_61> AgradDistributionsCauchy_ffv_61;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_62> AgradDistributionsCauchy_ffv_62;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_63> AgradDistributionsCauchy_ffv_63;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_64> AgradDistributionsCauchy_ffv_64;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_65> AgradDistributionsCauchy_ffv_65;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_66> AgradDistributionsCauchy_ffv_66;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_67> AgradDistributionsCauchy_ffv_67;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_68> AgradDistributionsCauchy_ffv_68;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_69> AgradDistributionsCauchy_ffv_69;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_70> AgradDistributionsCauchy_ffv_70;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_71> AgradDistributionsCauchy_ffv_71;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_72> AgradDistributionsCauchy_ffv_72;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_73> AgradDistributionsCauchy_ffv_73;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_74> AgradDistributionsCauchy_ffv_74;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_75> AgradDistributionsCauchy_ffv_75;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_76> AgradDistributionsCauchy_ffv_76;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_77> AgradDistributionsCauchy_ffv_77;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_78> AgradDistributionsCauchy_ffv_78;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_79> AgradDistributionsCauchy_ffv_79;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_80> AgradDistributionsCauchy_ffv_80;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_81> AgradDistributionsCauchy_ffv_81;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_82> AgradDistributionsCauchy_ffv_82;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_83> AgradDistributionsCauchy_ffv_83;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_84> AgradDistributionsCauchy_ffv_84;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_85> AgradDistributionsCauchy_ffv_85;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_86> AgradDistributionsCauchy_ffv_86;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_87> AgradDistributionsCauchy_ffv_87;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_88> AgradDistributionsCauchy_ffv_88;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_89> AgradDistributionsCauchy_ffv_89;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_90> AgradDistributionsCauchy_ffv_90;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_91> AgradDistributionsCauchy_ffv_91;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_92> AgradDistributionsCauchy_ffv_92;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_93> AgradDistributionsCauchy_ffv_93;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_94> AgradDistributionsCauchy_ffv_94;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_95> AgradDistributionsCauchy_ffv_95;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_96> AgradDistributionsCauchy_ffv_96;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_97> AgradDistributionsCauchy_ffv_97;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_98> AgradDistributionsCauchy_ffv_98;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_99> AgradDistributionsCauchy_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_0, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_1, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_2, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_3, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_4, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_5, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_6, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_7, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_8, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_9, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_10, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_11, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_12, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_13, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_14, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_15, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_16, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_17, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_18, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_19, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_20, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_21, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_22, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_23, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_24, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_25, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_26, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_27, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_28, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_29, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_30, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_31, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_32, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_33, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_34, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_35, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_36, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_37, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_38, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_39, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_40, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_41, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_42, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_43, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_44, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_45, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_46, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_47, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_48, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_49, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_50, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_51, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_52, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_53, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_54, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_55, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_56, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_57, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_58, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_59, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_60, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_61, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_62, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_63, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_64, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_65, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_66, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_67, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_68, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_69, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_70, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_71, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_72, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_73, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_74, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_75, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_76, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_77, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_78, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_79, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_80, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_81, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_82, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_83, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_84, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_85, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_86, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_87, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_88, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_89, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_90, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_91, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_92, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_93, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_94, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_95, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_96, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_97, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_98, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_99, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsCauchy, type_v_0> AgradDistributionsCauchy_v_0;
+typedef std::tuple<AgradDistributionsCauchy, type_v_1> AgradDistributionsCauchy_v_1;
+typedef std::tuple<AgradDistributionsCauchy, type_v_2> AgradDistributionsCauchy_v_2;
+typedef std::tuple<AgradDistributionsCauchy, type_v_3> AgradDistributionsCauchy_v_3;
+typedef std::tuple<AgradDistributionsCauchy, type_v_4> AgradDistributionsCauchy_v_4;
+typedef std::tuple<AgradDistributionsCauchy, type_v_5> AgradDistributionsCauchy_v_5;
+typedef std::tuple<AgradDistributionsCauchy, type_v_6> AgradDistributionsCauchy_v_6;
+typedef std::tuple<AgradDistributionsCauchy, type_v_7> AgradDistributionsCauchy_v_7;
+typedef std::tuple<AgradDistributionsCauchy, type_v_8> AgradDistributionsCauchy_v_8;
+typedef std::tuple<AgradDistributionsCauchy, type_v_9> AgradDistributionsCauchy_v_9;
+typedef std::tuple<AgradDistributionsCauchy, type_v_10> AgradDistributionsCauchy_v_10;
+typedef std::tuple<AgradDistributionsCauchy, type_v_11> AgradDistributionsCauchy_v_11;
+typedef std::tuple<AgradDistributionsCauchy, type_v_12> AgradDistributionsCauchy_v_12;
+typedef std::tuple<AgradDistributionsCauchy, type_v_13> AgradDistributionsCauchy_v_13;
+typedef std::tuple<AgradDistributionsCauchy, type_v_14> AgradDistributionsCauchy_v_14;
+typedef std::tuple<AgradDistributionsCauchy, type_v_15> AgradDistributionsCauchy_v_15;
+typedef std::tuple<AgradDistributionsCauchy, type_v_16> AgradDistributionsCauchy_v_16;
+typedef std::tuple<AgradDistributionsCauchy, type_v_17> AgradDistributionsCauchy_v_17;
+typedef std::tuple<AgradDistributionsCauchy, type_v_18> AgradDistributionsCauchy_v_18;
+typedef std::tuple<AgradDistributionsCauchy, type_v_19> AgradDistributionsCauchy_v_19;
+typedef std::tuple<AgradDistributionsCauchy, type_v_20> AgradDistributionsCauchy_v_20;
+typedef std::tuple<AgradDistributionsCauchy, type_v_21> AgradDistributionsCauchy_v_21;
+typedef std::tuple<AgradDistributionsCauchy, type_v_22> AgradDistributionsCauchy_v_22;
+typedef std::tuple<AgradDistributionsCauchy, type_v_23> AgradDistributionsCauchy_v_23;
+typedef std::tuple<AgradDistributionsCauchy, type_v_24> AgradDistributionsCauchy_v_24;
+typedef std::tuple<AgradDistributionsCauchy, type_v_25> AgradDistributionsCauchy_v_25;
+typedef std::tuple<AgradDistributionsCauchy, type_v_26> AgradDistributionsCauchy_v_26;
+typedef std::tuple<AgradDistributionsCauchy, type_v_27> AgradDistributionsCauchy_v_27;
+typedef std::tuple<AgradDistributionsCauchy, type_v_28> AgradDistributionsCauchy_v_28;
+typedef std::tuple<AgradDistributionsCauchy, type_v_29> AgradDistributionsCauchy_v_29;
+typedef std::tuple<AgradDistributionsCauchy, type_v_30> AgradDistributionsCauchy_v_30;
+typedef std::tuple<AgradDistributionsCauchy, type_v_31> AgradDistributionsCauchy_v_31;
+typedef std::tuple<AgradDistributionsCauchy, type_v_32> AgradDistributionsCauchy_v_32;
+typedef std::tuple<AgradDistributionsCauchy, type_v_33> AgradDistributionsCauchy_v_33;
+typedef std::tuple<AgradDistributionsCauchy, type_v_34> AgradDistributionsCauchy_v_34;
+typedef std::tuple<AgradDistributionsCauchy, type_v_35> AgradDistributionsCauchy_v_35;
+typedef std::tuple<AgradDistributionsCauchy, type_v_36> AgradDistributionsCauchy_v_36;
+typedef std::tuple<AgradDistributionsCauchy, type_v_37> AgradDistributionsCauchy_v_37;
+typedef std::tuple<AgradDistributionsCauchy, type_v_38> AgradDistributionsCauchy_v_38;
+typedef std::tuple<AgradDistributionsCauchy, type_v_39> AgradDistributionsCauchy_v_39;
+typedef std::tuple<AgradDistributionsCauchy, type_v_40> AgradDistributionsCauchy_v_40;
+typedef std::tuple<AgradDistributionsCauchy, type_v_41> AgradDistributionsCauchy_v_41;
+typedef std::tuple<AgradDistributionsCauchy, type_v_42> AgradDistributionsCauchy_v_42;
+typedef std::tuple<AgradDistributionsCauchy, type_v_43> AgradDistributionsCauchy_v_43;
+typedef std::tuple<AgradDistributionsCauchy, type_v_44> AgradDistributionsCauchy_v_44;
+typedef std::tuple<AgradDistributionsCauchy, type_v_45> AgradDistributionsCauchy_v_45;
+typedef std::tuple<AgradDistributionsCauchy, type_v_46> AgradDistributionsCauchy_v_46;
+typedef std::tuple<AgradDistributionsCauchy, type_v_47> AgradDistributionsCauchy_v_47;
+typedef std::tuple<AgradDistributionsCauchy, type_v_48> AgradDistributionsCauchy_v_48;
+typedef std::tuple<AgradDistributionsCauchy, type_v_49> AgradDistributionsCauchy_v_49;
+typedef std::tuple<AgradDistributionsCauchy, type_v_50> AgradDistributionsCauchy_v_50;
+typedef std::tuple<AgradDistributionsCauchy, type_v_51> AgradDistributionsCauchy_v_51;
+typedef std::tuple<AgradDistributionsCauchy, type_v_52> AgradDistributionsCauchy_v_52;
+typedef std::tuple<AgradDistributionsCauchy, type_v_53> AgradDistributionsCauchy_v_53;
+typedef std::tuple<AgradDistributionsCauchy, type_v_54> AgradDistributionsCauchy_v_54;
+typedef std::tuple<AgradDistributionsCauchy, type_v_55> AgradDistributionsCauchy_v_55;
+typedef std::tuple<AgradDistributionsCauchy, type_v_56> AgradDistributionsCauchy_v_56;
+typedef std::tuple<AgradDistributionsCauchy, type_v_57> AgradDistributionsCauchy_v_57;
+typedef std::tuple<AgradDistributionsCauchy, type_v_58> AgradDistributionsCauchy_v_58;
+typedef std::tuple<AgradDistributionsCauchy, type_v_59> AgradDistributionsCauchy_v_59;
+typedef std::tuple<AgradDistributionsCauchy, type_v_60> AgradDistributionsCauchy_v_60;
+typedef std::tuple<AgradDistributionsCauchy, type_v_61> AgradDistributionsCauchy_v_61;
+typedef std::tuple<AgradDistributionsCauchy, type_v_62> AgradDistributionsCauchy_v_62;
+typedef std::tuple<AgradDistributionsCauchy, type_v_63> AgradDistributionsCauchy_v_63;
+typedef std::tuple<AgradDistributionsCauchy, type_v_64> AgradDistributionsCauchy_v_64;
+typedef std::tuple<AgradDistributionsCauchy, type_v_65> AgradDistributionsCauchy_v_65;
+typedef std::tuple<AgradDistributionsCauchy, type_v_66> AgradDistributionsCauchy_v_66;
+typedef std::tuple<AgradDistributionsCauchy, type_v_67> AgradDistributionsCauchy_v_67;
+typedef std::tuple<AgradDistributionsCauchy, type_v_68> AgradDistributionsCauchy_v_68;
+typedef std::tuple<AgradDistributionsCauchy, type_v_69> AgradDistributionsCauchy_v_69;
+typedef std::tuple<AgradDistributionsCauchy, type_v_70> AgradDistributionsCauchy_v_70;
+typedef std::tuple<AgradDistributionsCauchy, type_v_71> AgradDistributionsCauchy_v_71;
+typedef std::tuple<AgradDistributionsCauchy, type_v_72> AgradDistributionsCauchy_v_72;
+typedef std::tuple<AgradDistributionsCauchy, type_v_73> AgradDistributionsCauchy_v_73;
+typedef std::tuple<AgradDistributionsCauchy, type_v_74> AgradDistributionsCauchy_v_74;
+typedef std::tuple<AgradDistributionsCauchy, type_v_75> AgradDistributionsCauchy_v_75;
+typedef std::tuple<AgradDistributionsCauchy, type_v_76> AgradDistributionsCauchy_v_76;
+typedef std::tuple<AgradDistributionsCauchy, type_v_77> AgradDistributionsCauchy_v_77;
+typedef std::tuple<AgradDistributionsCauchy, type_v_78> AgradDistributionsCauchy_v_78;
+typedef std::tuple<AgradDistributionsCauchy, type_v_79> AgradDistributionsCauchy_v_79;
+typedef std::tuple<AgradDistributionsCauchy, type_v_80> AgradDistributionsCauchy_v_80;
+typedef std::tuple<AgradDistributionsCauchy, type_v_81> AgradDistributionsCauchy_v_81;
+typedef std::tuple<AgradDistributionsCauchy, type_v_82> AgradDistributionsCauchy_v_82;
+typedef std::tuple<AgradDistributionsCauchy, type_v_83> AgradDistributionsCauchy_v_83;
+typedef std::tuple<AgradDistributionsCauchy, type_v_84> AgradDistributionsCauchy_v_84;
+typedef std::tuple<AgradDistributionsCauchy, type_v_85> AgradDistributionsCauchy_v_85;
+typedef std::tuple<AgradDistributionsCauchy, type_v_86> AgradDistributionsCauchy_v_86;
+typedef std::tuple<AgradDistributionsCauchy, type_v_87> AgradDistributionsCauchy_v_87;
+typedef std::tuple<AgradDistributionsCauchy, type_v_88> AgradDistributionsCauchy_v_88;
+typedef std::tuple<AgradDistributionsCauchy, type_v_89> AgradDistributionsCauchy_v_89;
+typedef std::tuple<AgradDistributionsCauchy, type_v_90> AgradDistributionsCauchy_v_90;
+typedef std::tuple<AgradDistributionsCauchy, type_v_91> AgradDistributionsCauchy_v_91;
+typedef std::tuple<AgradDistributionsCauchy, type_v_92> AgradDistributionsCauchy_v_92;
+typedef std::tuple<AgradDistributionsCauchy, type_v_93> AgradDistributionsCauchy_v_93;
+typedef std::tuple<AgradDistributionsCauchy, type_v_94> AgradDistributionsCauchy_v_94;
+typedef std::tuple<AgradDistributionsCauchy, type_v_95> AgradDistributionsCauchy_v_95;
+typedef std::tuple<AgradDistributionsCauchy, type_v_96> AgradDistributionsCauchy_v_96;
+typedef std::tuple<AgradDistributionsCauchy, type_v_97> AgradDistributionsCauchy_v_97;
+typedef std::tuple<AgradDistributionsCauchy, type_v_98> AgradDistributionsCauchy_v_98;
+typedef std::tuple<AgradDistributionsCauchy, type_v_99> AgradDistributionsCauchy_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_0, AgradDistributionTestFixture, AgradDistributionsCauchy_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_1, AgradDistributionTestFixture, AgradDistributionsCauchy_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_2, AgradDistributionTestFixture, AgradDistributionsCauchy_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_3, AgradDistributionTestFixture, AgradDistributionsCauchy_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_4, AgradDistributionTestFixture, AgradDistributionsCauchy_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_5, AgradDistributionTestFixture, AgradDistributionsCauchy_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_6, AgradDistributionTestFixture, AgradDistributionsCauchy_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_7, AgradDistributionTestFixture, AgradDistributionsCauchy_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_8, AgradDistributionTestFixture, AgradDistributionsCauchy_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_9, AgradDistributionTestFixture, AgradDistributionsCauchy_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_10, AgradDistributionTestFixture, AgradDistributionsCauchy_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_11, AgradDistributionTestFixture, AgradDistributionsCauchy_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_12, AgradDistributionTestFixture, AgradDistributionsCauchy_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_13, AgradDistributionTestFixture, AgradDistributionsCauchy_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_14, AgradDistributionTestFixture, AgradDistributionsCauchy_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_15, AgradDistributionTestFixture, AgradDistributionsCauchy_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_16, AgradDistributionTestFixture, AgradDistributionsCauchy_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_17, AgradDistributionTestFixture, AgradDistributionsCauchy_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_18, AgradDistributionTestFixture, AgradDistributionsCauchy_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_19, AgradDistributionTestFixture, AgradDistributionsCauchy_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_20, AgradDistributionTestFixture, AgradDistributionsCauchy_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_21, AgradDistributionTestFixture, AgradDistributionsCauchy_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_22, AgradDistributionTestFixture, AgradDistributionsCauchy_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_23, AgradDistributionTestFixture, AgradDistributionsCauchy_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_24, AgradDistributionTestFixture, AgradDistributionsCauchy_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_25, AgradDistributionTestFixture, AgradDistributionsCauchy_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_26, AgradDistributionTestFixture, AgradDistributionsCauchy_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_27, AgradDistributionTestFixture, AgradDistributionsCauchy_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_28, AgradDistributionTestFixture, AgradDistributionsCauchy_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_29, AgradDistributionTestFixture, AgradDistributionsCauchy_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_30, AgradDistributionTestFixture, AgradDistributionsCauchy_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_31, AgradDistributionTestFixture, AgradDistributionsCauchy_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_32, AgradDistributionTestFixture, AgradDistributionsCauchy_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_33, AgradDistributionTestFixture, AgradDistributionsCauchy_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_34, AgradDistributionTestFixture, AgradDistributionsCauchy_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_35, AgradDistributionTestFixture, AgradDistributionsCauchy_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_36, AgradDistributionTestFixture, AgradDistributionsCauchy_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_37, AgradDistributionTestFixture, AgradDistributionsCauchy_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_38, AgradDistributionTestFixture, AgradDistributionsCauchy_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_39, AgradDistributionTestFixture, AgradDistributionsCauchy_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_40, AgradDistributionTestFixture, AgradDistributionsCauchy_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_41, AgradDistributionTestFixture, AgradDistributionsCauchy_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_42, AgradDistributionTestFixture, AgradDistributionsCauchy_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_43, AgradDistributionTestFixture, AgradDistributionsCauchy_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_44, AgradDistributionTestFixture, AgradDistributionsCauchy_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_45, AgradDistributionTestFixture, AgradDistributionsCauchy_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_46, AgradDistributionTestFixture, AgradDistributionsCauchy_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_47, AgradDistributionTestFixture, AgradDistributionsCauchy_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_48, AgradDistributionTestFixture, AgradDistributionsCauchy_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_49, AgradDistributionTestFixture, AgradDistributionsCauchy_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_50, AgradDistributionTestFixture, AgradDistributionsCauchy_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_51, AgradDistributionTestFixture, AgradDistributionsCauchy_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_52, AgradDistributionTestFixture, AgradDistributionsCauchy_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_53, AgradDistributionTestFixture, AgradDistributionsCauchy_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_54, AgradDistributionTestFixture, AgradDistributionsCauchy_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_55, AgradDistributionTestFixture, AgradDistributionsCauchy_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_56, AgradDistributionTestFixture, AgradDistributionsCauchy_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_57, AgradDistributionTestFixture, AgradDistributionsCauchy_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_58, AgradDistributionTestFixture, AgradDistributionsCauchy_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_59, AgradDistributionTestFixture, AgradDistributionsCauchy_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_60, AgradDistributionTestFixture, AgradDistributionsCauchy_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_61, AgradDistributionTestFixture, AgradDistributionsCauchy_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_62, AgradDistributionTestFixture, AgradDistributionsCauchy_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_63, AgradDistributionTestFixture, AgradDistributionsCauchy_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_64, AgradDistributionTestFixture, AgradDistributionsCauchy_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_65, AgradDistributionTestFixture, AgradDistributionsCauchy_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_66, AgradDistributionTestFixture, AgradDistributionsCauchy_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_67, AgradDistributionTestFixture, AgradDistributionsCauchy_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_68, AgradDistributionTestFixture, AgradDistributionsCauchy_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_69, AgradDistributionTestFixture, AgradDistributionsCauchy_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_70, AgradDistributionTestFixture, AgradDistributionsCauchy_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_71, AgradDistributionTestFixture, AgradDistributionsCauchy_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_72, AgradDistributionTestFixture, AgradDistributionsCauchy_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_73, AgradDistributionTestFixture, AgradDistributionsCauchy_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_74, AgradDistributionTestFixture, AgradDistributionsCauchy_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_75, AgradDistributionTestFixture, AgradDistributionsCauchy_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_76, AgradDistributionTestFixture, AgradDistributionsCauchy_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_77, AgradDistributionTestFixture, AgradDistributionsCauchy_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_78, AgradDistributionTestFixture, AgradDistributionsCauchy_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_79, AgradDistributionTestFixture, AgradDistributionsCauchy_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_80, AgradDistributionTestFixture, AgradDistributionsCauchy_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_81, AgradDistributionTestFixture, AgradDistributionsCauchy_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_82, AgradDistributionTestFixture, AgradDistributionsCauchy_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_83, AgradDistributionTestFixture, AgradDistributionsCauchy_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_84, AgradDistributionTestFixture, AgradDistributionsCauchy_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_85, AgradDistributionTestFixture, AgradDistributionsCauchy_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_86, AgradDistributionTestFixture, AgradDistributionsCauchy_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_87, AgradDistributionTestFixture, AgradDistributionsCauchy_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_88, AgradDistributionTestFixture, AgradDistributionsCauchy_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_89, AgradDistributionTestFixture, AgradDistributionsCauchy_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_90, AgradDistributionTestFixture, AgradDistributionsCauchy_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_91, AgradDistributionTestFixture, AgradDistributionsCauchy_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_92, AgradDistributionTestFixture, AgradDistributionsCauchy_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_93, AgradDistributionTestFixture, AgradDistributionsCauchy_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_94, AgradDistributionTestFixture, AgradDistributionsCauchy_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_95, AgradDistributionTestFixture, AgradDistributionsCauchy_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_96, AgradDistributionTestFixture, AgradDistributionsCauchy_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_97, AgradDistributionTestFixture, AgradDistributionsCauchy_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_98, AgradDistributionTestFixture, AgradDistributionsCauchy_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_99, AgradDistributionTestFixture, AgradDistributionsCauchy_v_99);
+
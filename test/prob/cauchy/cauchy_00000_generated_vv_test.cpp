@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsCauchy, type_vv_0> AgradDistributionsCauchy_vv_0;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_1> AgradDistributionsCauchy_vv_1;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_2> AgradDistributionsCauchy_vv_2;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_3> AgradDistributionsCauchy_vv_3;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_4> AgradDistributionsCauchy_vv_4;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_5> AgradDistributionsCauchy_vv_5;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_6> AgradDistributionsCauchy_vv_6;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_7> AgradDistributionsCauchy_vv_7;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_8> AgradDistributionsCauchy_vv_8;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_9> AgradDistributionsCauchy_vv_9;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_10> AgradDistributionsCauchy_vv_10;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_11> AgradDistributionsCauchy_vv_11;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_12> AgradDistributionsCauchy_vv_12;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_13> AgradDistributionsCauchy_vv_13;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_14> AgradDistributionsCauchy_vv_14;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_15> AgradDistributionsCauchy_vv_15;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_16> AgradDistributionsCauchy_vv_16;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_17> AgradDistributionsCauchy_vv_17;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_18> AgradDistributionsCauchy_vv_18;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_19> AgradDistributionsCauchy_vv_19;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_20> AgradDistributionsCauchy_vv_20;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_21> AgradDistributionsCauchy_vv_21;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_22> AgradDistributionsCauchy_vv_22;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_23> AgradDistributionsCauchy_vv_23;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_24> AgradDistributionsCauchy_vv_24;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_25> AgradDistributionsCauchy_vv_25;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_26> AgradDistributionsCauchy_vv_26;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_27> AgradDistributionsCauchy_vv_27;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_28> AgradDistributionsCauchy_vv_28;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_29> AgradDistributionsCauchy_vv_29;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_30> AgradDistributionsCauchy_vv_30;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_31> AgradDistributionsCauchy_vv_31;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_32> AgradDistributionsCauchy_vv_32;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_33> AgradDistributionsCauchy_vv_33;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_34> AgradDistributionsCauchy_vv_34;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_35> AgradDistributionsCauchy_vv_35;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_36> AgradDistributionsCauchy_vv_36;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_37> AgradDistributionsCauchy_vv_37;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_38> AgradDistributionsCauchy_vv_38;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_39> AgradDistributionsCauchy_vv_39;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_40> AgradDistributionsCauchy_vv_40;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_41> AgradDistributionsCauchy_vv_41;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_42> AgradDistributionsCauchy_vv_42;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_43> AgradDistributionsCauchy_vv_43;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_44> AgradDistributionsCauchy_vv_44;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_45> AgradDistributionsCauchy_vv_45;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_46> AgradDistributionsCauchy_vv_46;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_47> AgradDistributionsCauchy_vv_47;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_48> AgradDistributionsCauchy_vv_48;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_49> AgradDistributionsCauchy_vv_49;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_50> AgradDistributionsCauchy_vv_50;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_51> AgradDistributionsCauchy_vv_51;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_52> AgradDistributionsCauchy_vv_52;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_53> AgradDistributionsCauchy_vv_53;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_54> AgradDistributionsCauchy_vv_54;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_55> AgradDistributionsCauchy_vv_55;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_56> AgradDistributionsCauchy_vv_56;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_57> AgradDistributionsCauchy_vv_57;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_58> AgradDistributionsCauchy_vv_58;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_59> AgradDistributionsCauchy_vv_59;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_60> AgradDistributionsCauchy_vv_60;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_61> AgradDistributionsCauchy_vv_61;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_62> AgradDistributionsCauchy_vv_62;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_63> AgradDistributionsCauchy_vv_63;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_64> AgradDistributionsCauchy_vv_64;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_65> AgradDistributionsCauchy_vv_65;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_66> AgradDistributionsCauchy_vv_66;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_67> AgradDistributionsCauchy_vv_67;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_68> AgradDistributionsCauchy_vv_68;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_69> AgradDistributionsCauchy_vv_69;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_70> AgradDistributionsCauchy_vv_70;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_71> AgradDistributionsCauchy_vv_71;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_72> AgradDistributionsCauchy_vv_72;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_73> AgradDistributionsCauchy_vv_73;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_74> AgradDistributionsCauchy_vv_74;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_75> AgradDistributionsCauchy_vv_75;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_76> AgradDistributionsCauchy_vv_76;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_77> AgradDistributionsCauchy_vv_77;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_78> AgradDistributionsCauchy_vv_78;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_79> AgradDistributionsCauchy_vv_79;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_80> AgradDistributionsCauchy_vv_80;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_81> AgradDistributionsCauchy_vv_81;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_82> AgradDistributionsCauchy_vv_82;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_83> AgradDistributionsCauchy_vv_83;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_84> AgradDistributionsCauchy_vv_84;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_85> AgradDistributionsCauchy_vv_85;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_86> AgradDistributionsCauchy_vv_86;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_87> AgradDistributionsCauchy_vv_87;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_88> AgradDistributionsCauchy_vv_88;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_89> AgradDistributionsCauchy_vv_89;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_90> AgradDistributionsCauchy_vv_90;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_91> AgradDistributionsCauchy_vv_91;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_92> AgradDistributionsCauchy_vv_92;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_93> AgradDistributionsCauchy_vv_93;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_94> AgradDistributionsCauchy_vv_94;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_95> AgradDistributionsCauchy_vv_95;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_96> AgradDistributionsCauchy_vv_96;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_97> AgradDistributionsCauchy_vv_97;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_98> AgradDistributionsCauchy_vv_98;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_99> AgradDistributionsCauchy_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_0, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_1, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_2, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_3, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_4, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_5, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_6, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_7, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_8, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_9, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_10, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_11, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_12, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_13, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_14, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_15, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_16, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_17, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_18, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_19, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_20, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_21, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_22, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_23, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_24, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_25, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_26, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_27, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_28, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_29, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_30, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_31, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_32, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_33, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_34, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_35, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_36, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_37, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_38, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_39, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_40, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_41, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_42, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_43, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_44, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_45, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_46, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_47, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_48, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_49, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_50, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_51, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_52, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_53, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_54, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_55, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_56, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_57, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_58, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_59, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_60, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_61, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_62, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_63, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_64, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_65, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_66, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_67, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_68, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_69, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_70, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_71, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_72, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_73, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_74, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_75, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_76, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_77, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_78, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_79, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_80, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_81, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_82, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_83, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_84, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_85, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_86, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_87, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_88, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_89, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_90, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_91, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_92, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_93, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_94, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_95, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_96, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_97, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_98, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_99, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_100> AgradDistributionsCauchy_ffv_100;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_101> AgradDistributionsCauchy_ffv_101;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_102> AgradDistributionsCauchy_ffv_102;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_103> AgradDistributionsCauchy_ffv_103;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_104> AgradDistributionsCauchy_ffv_104;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_105> AgradDistributionsCauchy_ffv_105;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_106> AgradDistributionsCauchy_ffv_106;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_107> AgradDistributionsCauchy_ffv_107;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_108> AgradDistributionsCauchy_ffv_108;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_109> AgradDistributionsCauchy_ffv_109;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_110> AgradDistributionsCauchy_ffv_110;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_111> AgradDistributionsCauchy_ffv_111;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_112> AgradDistributionsCauchy_ffv_112;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_113> AgradDistributionsCauchy_ffv_113;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_114> AgradDistributionsCauchy_ffv_114;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_115> AgradDistributionsCauchy_ffv_115;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_116> AgradDistributionsCauchy_ffv_116;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_117> AgradDistributionsCauchy_ffv_117;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_118> AgradDistributionsCauchy_ffv_118;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_119> AgradDistributionsCauchy_ffv_119;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_120> AgradDistributionsCauchy_ffv_120;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_121> AgradDistributionsCauchy_ffv_121;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_122> AgradDistributionsCauchy_ffv_122;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_123> AgradDistributionsCauchy_ffv_123;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_124> AgradDistributionsCauchy_ffv_124;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_125> AgradDistributionsCauchy_ffv_125;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_126> AgradDistributionsCauchy_ffv_126;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_127> AgradDistributionsCauchy_ffv_127;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_128> AgradDistributionsCauchy_ffv_128;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_129> AgradDistributionsCauchy_ffv_129;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_130> AgradDistributionsCauchy_ffv_130;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_131> AgradDistributionsCauchy_ffv_131;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_132> AgradDistributionsCauchy_ffv_132;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_133> AgradDistributionsCauchy_ffv_133;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_134> AgradDistributionsCauchy_ffv_134;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_135> AgradDistributionsCauchy_ffv_135;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_136> AgradDistributionsCauchy_ffv_136;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_137> AgradDistributionsCauchy_ffv_137;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_138> AgradDistributionsCauchy_ffv_138;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_139> AgradDistributionsCauchy_ffv_139;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_140> AgradDistributionsCauchy_ffv_140;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_141> AgradDistributionsCauchy_ffv_141;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_142> AgradDistributionsCauchy_ffv_142;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_143> AgradDistributionsCauchy_ffv_143;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_144> AgradDistributionsCauchy_ffv_144;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_145> AgradDistributionsCauchy_ffv_145;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_146> AgradDistributionsCauchy_ffv_146;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_147> AgradDistributionsCauchy_ffv_147;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_148> AgradDistributionsCauchy_ffv_148;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_149> AgradDistributionsCauchy_ffv_149;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_150> AgradDistributionsCauchy_ffv_150;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_151> AgradDistributionsCauchy_ffv_151;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_152> AgradDistributionsCauchy_ffv_152;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_153> AgradDistributionsCauchy_ffv_153;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_154> AgradDistributionsCauchy_ffv_154;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_155> AgradDistributionsCauchy_ffv_155;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_156> AgradDistributionsCauchy_ffv_156;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_157> AgradDistributionsCauchy_ffv_157;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_158> AgradDistributionsCauchy_ffv_158;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_159> AgradDistributionsCauchy_ffv_159;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_160> AgradDistributionsCauchy_ffv_160;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_161> AgradDistributionsCauchy_ffv_161;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_162> AgradDistributionsCauchy_ffv_162;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_163> AgradDistributionsCauchy_ffv_163;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_164> AgradDistributionsCauchy_ffv_164;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_165> AgradDistributionsCauchy_ffv_165;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_166> AgradDistributionsCauchy_ffv_166;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_167> AgradDistributionsCauchy_ffv_167;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_168> AgradDistributionsCauchy_ffv_168;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_169> AgradDistributionsCauchy_ffv_169;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_170> AgradDistributionsCauchy_ffv_170;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_171> AgradDistributionsCauchy_ffv_171;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_172> AgradDistributionsCauchy_ffv_172;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_173> AgradDistributionsCauchy_ffv_173;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_174> AgradDistributionsCauchy_ffv_174;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_175> AgradDistributionsCauchy_ffv_175;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_176> AgradDistributionsCauchy_ffv_176;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_177> AgradDistributionsCauchy_ffv_177;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_178> AgradDistributionsCauchy_ffv_178;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_179> AgradDistributionsCauchy_ffv_179;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_180> AgradDistributionsCauchy_ffv_180;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_181> AgradDistributionsCauchy_ffv_181;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_182> AgradDistributionsCauchy_ffv_182;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_183> AgradDistributionsCauchy_ffv_183;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_184> AgradDistributionsCauchy_ffv_184;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_185> AgradDistributionsCauchy_ffv_185;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_186> AgradDistributionsCauchy_ffv_186;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_187> AgradDistributionsCauchy_ffv_187;
+typedef std::tuple<AgradDistributionsCauchy, type_ffv_188> AgradDistributionsCauchy_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_100, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_101, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_102, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_103, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_104, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_105, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_106, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_107, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_108, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_109, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_110, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_111, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_112, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_113, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_114, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_115, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_116, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_117, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_118, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_119, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_120, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_121, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_122, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_123, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_124, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_125, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_126, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_127, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_128, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_129, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_130, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_131, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_132, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_133, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_134, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_135, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_136, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_137, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_138, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_139, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_140, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_141, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_142, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_143, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_144, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_145, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_146, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_147, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_148, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_149, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_150, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_151, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_152, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_153, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_154, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_155, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_156, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_157, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_158, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_159, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_160, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_161, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_162, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_163, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_164, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_165, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_166, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_167, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_168, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_169, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_170, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_171, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_172, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_173, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_174, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_175, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_176, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_177, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_178, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_179, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_180, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_181, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_182, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_183, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_184, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_185, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_186, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_187, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_ffv_188, AgradDistributionTestFixture, AgradDistributionsCauchy_ffv_188);
+
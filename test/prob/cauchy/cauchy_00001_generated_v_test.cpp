@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsCauchy, type_v_100> AgradDistributionsCauchy_v_100;
+typedef std::tuple<AgradDistributionsCauchy, type_v_101> AgradDistributionsCauchy_v_101;
+typedef std::tuple<AgradDistributionsCauchy, type_v_102> AgradDistributionsCauchy_v_102;
+typedef std::tuple<AgradDistributionsCauchy, type_v_103> AgradDistributionsCauchy_v_103;
+typedef std::tuple<AgradDistributionsCauchy, type_v_104> AgradDistributionsCauchy_v_104;
+typedef std::tuple<AgradDistributionsCauchy, type_v_105> AgradDistributionsCauchy_v_105;
+typedef std::tuple<AgradDistributionsCauchy, type_v_106> AgradDistributionsCauchy_v_106;
+typedef std::tuple<AgradDistributionsCauchy, type_v_107> AgradDistributionsCauchy_v_107;
+typedef std::tuple<AgradDistributionsCauchy, type_v_108> AgradDistributionsCauchy_v_108;
+typedef std::tuple<AgradDistributionsCauchy, type_v_109> AgradDistributionsCauchy_v_109;
+typedef std::tuple<AgradDistributionsCauchy, type_v_110> AgradDistributionsCauchy_v_110;
+typedef std::tuple<AgradDistributionsCauchy, type_v_111> AgradDistributionsCauchy_v_111;
+typedef std::tuple<AgradDistributionsCauchy, type_v_112> AgradDistributionsCauchy_v_112;
+typedef std::tuple<AgradDistributionsCauchy, type_v_113> AgradDistributionsCauchy_v_113;
+typedef std::tuple<AgradDistributionsCauchy, type_v_114> AgradDistributionsCauchy_v_114;
+typedef std::tuple<AgradDistributionsCauchy, type_v_115> AgradDistributionsCauchy_v_115;
+typedef std::tuple<AgradDistributionsCauchy, type_v_116> AgradDistributionsCauchy_v_116;
+typedef std::tuple<AgradDistributionsCauchy, type_v_117> AgradDistributionsCauchy_v_117;
+typedef std::tuple<AgradDistributionsCauchy, type_v_118> AgradDistributionsCauchy_v_118;
+typedef std::tuple<AgradDistributionsCauchy, type_v_119> AgradDistributionsCauchy_v_119;
+typedef std::tuple<AgradDistributionsCauchy, type_v_120> AgradDistributionsCauchy_v_120;
+typedef std::tuple<AgradDistributionsCauchy, type_v_121> AgradDistributionsCauchy_v_121;
+typedef std::tuple<AgradDistributionsCauchy, type_v_122> AgradDistributionsCauchy_v_122;
+typedef std::tuple<AgradDistributionsCauchy, type_v_123> AgradDistributionsCauchy_v_123;
+typedef std::tuple<AgradDistributionsCauchy, type_v_124> AgradDistributionsCauchy_v_124;
+typedef std::tuple<AgradDistributionsCauchy, type_v_125> AgradDistributionsCauchy_v_125;
+typedef std::tuple<AgradDistributionsCauchy, type_v_126> AgradDistributionsCauchy_v_126;
+typedef std::tuple<AgradDistributionsCauchy, type_v_127> AgradDistributionsCauchy_v_127;
+typedef std::tuple<AgradDistributionsCauchy, type_v_128> AgradDistributionsCauchy_v_128;
+typedef std::tuple<AgradDistributionsCauchy, type_v_129> AgradDistributionsCauchy_v_129;
+typedef std::tuple<AgradDistributionsCauchy, type_v_130> AgradDistributionsCauchy_v_130;
+typedef std::tuple<AgradDistributionsCauchy, type_v_131> AgradDistributionsCauchy_v_131;
+typedef std::tuple<AgradDistributionsCauchy, type_v_132> AgradDistributionsCauchy_v_132;
+typedef std::tuple<AgradDistributionsCauchy, type_v_133> AgradDistributionsCauchy_v_133;
+typedef std::tuple<AgradDistributionsCauchy, type_v_134> AgradDistributionsCauchy_v_134;
+typedef std::tuple<AgradDistributionsCauchy, type_v_135> AgradDistributionsCauchy_v_135;
+typedef std::tuple<AgradDistributionsCauchy, type_v_136> AgradDistributionsCauchy_v_136;
+typedef std::tuple<AgradDistributionsCauchy, type_v_137> AgradDistributionsCauchy_v_137;
+typedef std::tuple<AgradDistributionsCauchy, type_v_138> AgradDistributionsCauchy_v_138;
+typedef std::tuple<AgradDistributionsCauchy, type_v_139> AgradDistributionsCauchy_v_139;
+typedef std::tuple<AgradDistributionsCauchy, type_v_140> AgradDistributionsCauchy_v_140;
+typedef std::tuple<AgradDistributionsCauchy, type_v_141> AgradDistributionsCauchy_v_141;
+typedef std::tuple<AgradDistributionsCauchy, type_v_142> AgradDistributionsCauchy_v_142;
+typedef std::tuple<AgradDistributionsCauchy, type_v_143> AgradDistributionsCauchy_v_143;
+typedef std::tuple<AgradDistributionsCauchy, type_v_144> AgradDistributionsCauchy_v_144;
+typedef std::tuple<AgradDistributionsCauchy, type_v_145> AgradDistributionsCauchy_v_145;
+typedef std::tuple<AgradDistributionsCauchy, type_v_146> AgradDistributionsCauchy_v_146;
+typedef std::tuple<AgradDistributionsCauchy, type_v_147> AgradDistributionsCauchy_v_147;
+typedef std::tuple<AgradDistributionsCauchy, type_v_148> AgradDistributionsCauchy_v_148;
+typedef std::tuple<AgradDistributionsCauchy, type_v_149> AgradDistributionsCauchy_v_149;
+typedef std::tuple<AgradDistributionsCauchy, type_v_150> AgradDistributionsCauchy_v_150;
+typedef std::tuple<AgradDistributionsCauchy, type_v_151> AgradDistributionsCauchy_v_151;
+typedef std::tuple<AgradDistributionsCauchy, type_v_152> AgradDistributionsCauchy_v_152;
+typedef std::tuple<AgradDistributionsCauchy, type_v_153> AgradDistributionsCauchy_v_153;
+typedef std::tuple<AgradDistributionsCauchy, type_v_154> AgradDistributionsCauchy_v_154;
+typedef std::tuple<AgradDistributionsCauchy, type_v_155> AgradDistributionsCauchy_v_155;
+typedef std::tuple<AgradDistributionsCauchy, type_v_156> AgradDistributionsCauchy_v_156;
+typedef std::tuple<AgradDistributionsCauchy, type_v_157> AgradDistributionsCauchy_v_157;
+typedef std::tuple<AgradDistributionsCauchy, type_v_158> AgradDistributionsCauchy_v_158;
+typedef std::tuple<AgradDistributionsCauchy, type_v_159> AgradDistributionsCauchy_v_159;
+typedef std::tuple<AgradDistributionsCauchy, type_v_160> AgradDistributionsCauchy_v_160;
+typedef std::tuple<AgradDistributionsCauchy, type_v_161> AgradDistributionsCauchy_v_161;
+typedef std::tuple<AgradDistributionsCauchy, type_v_162> AgradDistributionsCauchy_v_162;
+typedef std::tuple<AgradDistributionsCauchy, type_v_163> AgradDistributionsCauchy_v_163;
+typedef std::tuple<AgradDistributionsCauchy, type_v_164> AgradDistributionsCauchy_v_164;
+typedef std::tuple<AgradDistributionsCauchy, type_v_165> AgradDistributionsCauchy_v_165;
+typedef std::tuple<AgradDistributionsCauchy, type_v_166> AgradDistributionsCauchy_v_166;
+typedef std::tuple<AgradDistributionsCauchy, type_v_167> AgradDistributionsCauchy_v_167;
+typedef std::tuple<AgradDistributionsCauchy, type_v_168> AgradDistributionsCauchy_v_168;
+typedef std::tuple<AgradDistributionsCauchy, type_v_169> AgradDistributionsCauchy_v_169;
+typedef std::tuple<AgradDistributionsCauchy, type_v_170> AgradDistributionsCauchy_v_170;
+typedef std::tuple<AgradDistributionsCauchy, type_v_171> AgradDistributionsCauchy_v_171;
+typedef std::tuple<AgradDistributionsCauchy, type_v_172> AgradDistributionsCauchy_v_172;
+typedef std::tuple<AgradDistributionsCauchy, type_v_173> AgradDistributionsCauchy_v_173;
+typedef std::tuple<AgradDistributionsCauchy, type_v_174> AgradDistributionsCauchy_v_174;
+typedef std::tuple<AgradDistributionsCauchy, type_v_175> AgradDistributionsCauchy_v_175;
+typedef std::tuple<AgradDistributionsCauchy, type_v_176> AgradDistributionsCauchy_v_176;
+typedef std::tuple<AgradDistributionsCauchy, type_v_177> AgradDistributionsCauchy_v_177;
+typedef std::tuple<AgradDistributionsCauchy, type_v_178> AgradDistributionsCauchy_v_178;
+typedef std::tuple<AgradDistributionsCauchy, type_v_179> AgradDistributionsCauchy_v_179;
+typedef std::tuple<AgradDistributionsCauchy, type_v_180> AgradDistributionsCauchy_v_180;
+typedef std::tuple<AgradDistributionsCauchy, type_v_181> AgradDistributionsCauchy_v_181;
+typedef std::tuple<AgradDistributionsCauchy, type_v_182> AgradDistributionsCauchy_v_182;
+typedef std::tuple<AgradDistributionsCauchy, type_v_183> AgradDistributionsCauchy_v_183;
+typedef std::tuple<AgradDistributionsCauchy, type_v_184> AgradDistributionsCauchy_v_184;
+typedef std::tuple<AgradDistributionsCauchy, type_v_185> AgradDistributionsCauchy_v_185;
+typedef std::tuple<AgradDistributionsCauchy, type_v_186> AgradDistributionsCauchy_v_186;
+typedef std::tuple<AgradDistributionsCauchy, type_v_187> AgradDistributionsCauchy_v_187;
+typedef std::tuple<AgradDistributionsCauchy, type_v_188> AgradDistributionsCauchy_v_188;
+typedef std::tuple<AgradDistributionsCauchy, type_v_189> AgradDistributionsCauchy_v_189;
+typedef std::tuple<AgradDistributionsCauchy, type_v_190> AgradDistributionsCauchy_v_190;
+typedef std::tuple<AgradDistributionsCauchy, type_v_191> AgradDistributionsCauchy_v_191;
+typedef std::tuple<AgradDistributionsCauchy, type_v_192> AgradDistributionsCauchy_v_192;
+typedef std::tuple<AgradDistributionsCauchy, type_v_193> AgradDistributionsCauchy_v_193;
+typedef std::tuple<AgradDistributionsCauchy, type_v_194> AgradDistributionsCauchy_v_194;
+typedef std::tuple<AgradDistributionsCauchy, type_v_195> AgradDistributionsCauchy_v_195;
+typedef std::tuple<AgradDistributionsCauchy, type_v_196> AgradDistributionsCauchy_v_196;
+typedef std::tuple<AgradDistributionsCauchy, type_v_197> AgradDistributionsCauchy_v_197;
+typedef std::tuple<AgradDistributionsCauchy, type_v_198> AgradDistributionsCauchy_v_198;
+typedef std::tuple<AgradDistributionsCauchy, type_v_199> AgradDistributionsCauchy_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_100, AgradDistributionTestFixture, AgradDistributionsCauchy_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_101, AgradDistributionTestFixture, AgradDistributionsCauchy_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_102, AgradDistributionTestFixture, AgradDistributionsCauchy_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_103, AgradDistributionTestFixture, AgradDistributionsCauchy_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_104, AgradDistributionTestFixture, AgradDistributionsCauchy_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_105, AgradDistributionTestFixture, AgradDistributionsCauchy_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_106, AgradDistributionTestFixture, AgradDistributionsCauchy_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_107, AgradDistributionTestFixture, AgradDistributionsCauchy_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_108, AgradDistributionTestFixture, AgradDistributionsCauchy_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_109, AgradDistributionTestFixture, AgradDistributionsCauchy_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_110, AgradDistributionTestFixture, AgradDistributionsCauchy_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_111, AgradDistributionTestFixture, AgradDistributionsCauchy_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_112, AgradDistributionTestFixture, AgradDistributionsCauchy_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_113, AgradDistributionTestFixture, AgradDistributionsCauchy_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_114, AgradDistributionTestFixture, AgradDistributionsCauchy_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_115, AgradDistributionTestFixture, AgradDistributionsCauchy_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_116, AgradDistributionTestFixture, AgradDistributionsCauchy_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_117, AgradDistributionTestFixture, AgradDistributionsCauchy_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_118, AgradDistributionTestFixture, AgradDistributionsCauchy_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_119, AgradDistributionTestFixture, AgradDistributionsCauchy_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_120, AgradDistributionTestFixture, AgradDistributionsCauchy_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_121, AgradDistributionTestFixture, AgradDistributionsCauchy_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_122, AgradDistributionTestFixture, AgradDistributionsCauchy_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_123, AgradDistributionTestFixture, AgradDistributionsCauchy_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_124, AgradDistributionTestFixture, AgradDistributionsCauchy_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_125, AgradDistributionTestFixture, AgradDistributionsCauchy_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_126, AgradDistributionTestFixture, AgradDistributionsCauchy_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_127, AgradDistributionTestFixture, AgradDistributionsCauchy_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_128, AgradDistributionTestFixture, AgradDistributionsCauchy_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_129, AgradDistributionTestFixture, AgradDistributionsCauchy_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_130, AgradDistributionTestFixture, AgradDistributionsCauchy_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_131, AgradDistributionTestFixture, AgradDistributionsCauchy_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_132, AgradDistributionTestFixture, AgradDistributionsCauchy_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_133, AgradDistributionTestFixture, AgradDistributionsCauchy_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_134, AgradDistributionTestFixture, AgradDistributionsCauchy_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_135, AgradDistributionTestFixture, AgradDistributionsCauchy_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_136, AgradDistributionTestFixture, AgradDistributionsCauchy_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_137, AgradDistributionTestFixture, AgradDistributionsCauchy_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_138, AgradDistributionTestFixture, AgradDistributionsCauchy_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_139, AgradDistributionTestFixture, AgradDistributionsCauchy_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_140, AgradDistributionTestFixture, AgradDistributionsCauchy_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_141, AgradDistributionTestFixture, AgradDistributionsCauchy_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_142, AgradDistributionTestFixture, AgradDistributionsCauchy_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_143, AgradDistributionTestFixture, AgradDistributionsCauchy_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_144, AgradDistributionTestFixture, AgradDistributionsCauchy_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_145, AgradDistributionTestFixture, AgradDistributionsCauchy_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_146, AgradDistributionTestFixture, AgradDistributionsCauchy_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_147, AgradDistributionTestFixture, AgradDistributionsCauchy_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_148, AgradDistributionTestFixture, AgradDistributionsCauchy_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_149, AgradDistributionTestFixture, AgradDistributionsCauchy_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_150, AgradDistributionTestFixture, AgradDistributionsCauchy_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_151, AgradDistributionTestFixture, AgradDistributionsCauchy_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_152, AgradDistributionTestFixture, AgradDistributionsCauchy_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_153, AgradDistributionTestFixture, AgradDistributionsCauchy_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_154, AgradDistributionTestFixture, AgradDistributionsCauchy_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_155, AgradDistributionTestFixture, AgradDistributionsCauchy_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_156, AgradDistributionTestFixture, AgradDistributionsCauchy_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_157, AgradDistributionTestFixture, AgradDistributionsCauchy_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_158, AgradDistributionTestFixture, AgradDistributionsCauchy_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_159, AgradDistributionTestFixture, AgradDistributionsCauchy_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_160, AgradDistributionTestFixture, AgradDistributionsCauchy_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_161, AgradDistributionTestFixture, AgradDistributionsCauchy_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_162, AgradDistributionTestFixture, AgradDistributionsCauchy_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_163, AgradDistributionTestFixture, AgradDistributionsCauchy_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_164, AgradDistributionTestFixture, AgradDistributionsCauchy_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_165, AgradDistributionTestFixture, AgradDistributionsCauchy_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_166, AgradDistributionTestFixture, AgradDistributionsCauchy_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_167, AgradDistributionTestFixture, AgradDistributionsCauchy_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_168, AgradDistributionTestFixture, AgradDistributionsCauchy_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_169, AgradDistributionTestFixture, AgradDistributionsCauchy_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_170, AgradDistributionTestFixture, AgradDistributionsCauchy_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_171, AgradDistributionTestFixture, AgradDistributionsCauchy_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_172, AgradDistributionTestFixture, AgradDistributionsCauchy_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_173, AgradDistributionTestFixture, AgradDistributionsCauchy_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_174, AgradDistributionTestFixture, AgradDistributionsCauchy_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_175, AgradDistributionTestFixture, AgradDistributionsCauchy_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_176, AgradDistributionTestFixture, AgradDistributionsCauchy_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_177, AgradDistributionTestFixture, AgradDistributionsCauchy_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_178, AgradDistributionTestFixture, AgradDistributionsCauchy_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_179, AgradDistributionTestFixture, AgradDistributionsCauchy_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_180, AgradDistributionTestFixture, AgradDistributionsCauchy_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_181, AgradDistributionTestFixture, AgradDistributionsCauchy_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_182, AgradDistributionTestFixture, AgradDistributionsCauchy_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_183, AgradDistributionTestFixture, AgradDistributionsCauchy_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_184, AgradDistributionTestFixture, AgradDistributionsCauchy_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_185, AgradDistributionTestFixture, AgradDistributionsCauchy_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_186, AgradDistributionTestFixture, AgradDistributionsCauchy_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_187, AgradDistributionTestFixture, AgradDistributionsCauchy_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_188, AgradDistributionTestFixture, AgradDistributionsCauchy_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_189, AgradDistributionTestFixture, AgradDistributionsCauchy_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_190, AgradDistributionTestFixture, AgradDistributionsCauchy_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_191, AgradDistributionTestFixture, AgradDistributionsCauchy_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_192, AgradDistributionTestFixture, AgradDistributionsCauchy_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_193, AgradDistributionTestFixture, AgradDistributionsCauchy_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_194, AgradDistributionTestFixture, AgradDistributionsCauchy_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_195, AgradDistributionTestFixture, AgradDistributionsCauchy_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_196, AgradDistributionTestFixture, AgradDistributionsCauchy_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_197, AgradDistributionTestFixture, AgradDistributionsCauchy_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_198, AgradDistributionTestFixture, AgradDistributionsCauchy_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_199, AgradDistributionTestFixture, AgradDistributionsCauchy_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionsCauchy, type_vv_100> AgradDistributionsCauchy_vv_100;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_101> AgradDistributionsCauchy_vv_101;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_102> AgradDistributionsCauchy_vv_102;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_103> AgradDistributionsCauchy_vv_103;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_104> AgradDistributionsCauchy_vv_104;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_105> AgradDistributionsCauchy_vv_105;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_106> AgradDistributionsCauchy_vv_106;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_107> AgradDistributionsCauchy_vv_107;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_108> AgradDistributionsCauchy_vv_108;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_109> AgradDistributionsCauchy_vv_109;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_110> AgradDistributionsCauchy_vv_110;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_111> AgradDistributionsCauchy_vv_111;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_112> AgradDistributionsCauchy_vv_112;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_113> AgradDistributionsCauchy_vv_113;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_114> AgradDistributionsCauchy_vv_114;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_115> AgradDistributionsCauchy_vv_115;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_116> AgradDistributionsCauchy_vv_116;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_117> AgradDistributionsCauchy_vv_117;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_118> AgradDistributionsCauchy_vv_118;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_119> AgradDistributionsCauchy_vv_119;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_120> AgradDistributionsCauchy_vv_120;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_121> AgradDistributionsCauchy_vv_121;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_122> AgradDistributionsCauchy_vv_122;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_123> AgradDistributionsCauchy_vv_123;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_124> AgradDistributionsCauchy_vv_124;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_125> AgradDistributionsCauchy_vv_125;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_126> AgradDistributionsCauchy_vv_126;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_127> AgradDistributionsCauchy_vv_127;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_128> AgradDistributionsCauchy_vv_128;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_129> AgradDistributionsCauchy_vv_129;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_130> AgradDistributionsCauchy_vv_130;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_131> AgradDistributionsCauchy_vv_131;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_132> AgradDistributionsCauchy_vv_132;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_133> AgradDistributionsCauchy_vv_133;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_134> AgradDistributionsCauchy_vv_134;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_135> AgradDistributionsCauchy_vv_135;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_136> AgradDistributionsCauchy_vv_136;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_137> AgradDistributionsCauchy_vv_137;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_138> AgradDistributionsCauchy_vv_138;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_139> AgradDistributionsCauchy_vv_139;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_140> AgradDistributionsCauchy_vv_140;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_141> AgradDistributionsCauchy_vv_141;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_142> AgradDistributionsCauchy_vv_142;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_143> AgradDistributionsCauchy_vv_143;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_144> AgradDistributionsCauchy_vv_144;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_145> AgradDistributionsCauchy_vv_145;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_146> AgradDistributionsCauchy_vv_146;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_147> AgradDistributionsCauchy_vv_147;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_148> AgradDistributionsCauchy_vv_148;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_149> AgradDistributionsCauchy_vv_149;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_150> AgradDistributionsCauchy_vv_150;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_151> AgradDistributionsCauchy_vv_151;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_152> AgradDistributionsCauchy_vv_152;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_153> AgradDistributionsCauchy_vv_153;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_154> AgradDistributionsCauchy_vv_154;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_155> AgradDistributionsCauchy_vv_155;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_156> AgradDistributionsCauchy_vv_156;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_157> AgradDistributionsCauchy_vv_157;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_158> AgradDistributionsCauchy_vv_158;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_159> AgradDistributionsCauchy_vv_159;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_160> AgradDistributionsCauchy_vv_160;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_161> AgradDistributionsCauchy_vv_161;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_162> AgradDistributionsCauchy_vv_162;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_163> AgradDistributionsCauchy_vv_163;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_164> AgradDistributionsCauchy_vv_164;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_165> AgradDistributionsCauchy_vv_165;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_166> AgradDistributionsCauchy_vv_166;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_167> AgradDistributionsCauchy_vv_167;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_168> AgradDistributionsCauchy_vv_168;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_169> AgradDistributionsCauchy_vv_169;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_170> AgradDistributionsCauchy_vv_170;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_171> AgradDistributionsCauchy_vv_171;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_172> AgradDistributionsCauchy_vv_172;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_173> AgradDistributionsCauchy_vv_173;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_174> AgradDistributionsCauchy_vv_174;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_175> AgradDistributionsCauchy_vv_175;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_176> AgradDistributionsCauchy_vv_176;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_177> AgradDistributionsCauchy_vv_177;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_178> AgradDistributionsCauchy_vv_178;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_179> AgradDistributionsCauchy_vv_179;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_180> AgradDistributionsCauchy_vv_180;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_181> AgradDistributionsCauchy_vv_181;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_182> AgradDistributionsCauchy_vv_182;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_183> AgradDistributionsCauchy_vv_183;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_184> AgradDistributionsCauchy_vv_184;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_185> AgradDistributionsCauchy_vv_185;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_186> AgradDistributionsCauchy_vv_186;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_187> AgradDistributionsCauchy_vv_187;
+typedef std::tuple<AgradDistributionsCauchy, type_vv_188> AgradDistributionsCauchy_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_100, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_101, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_102, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_103, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_104, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_105, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_106, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_107, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_108, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_109, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_110, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_111, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_112, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_113, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_114, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_115, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_116, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_117, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_118, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_119, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_120, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_121, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_122, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_123, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_124, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_125, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_126, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_127, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_128, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_129, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_130, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_131, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_132, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_133, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_134, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_135, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_136, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_137, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_138, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_139, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_140, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_141, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_142, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_143, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_144, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_145, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_146, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_147, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_148, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_149, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_150, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_151, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_152, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_153, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_154, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_155, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_156, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_157, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_158, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_159, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_160, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_161, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_162, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_163, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_164, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_165, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_166, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_167, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_168, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_169, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_170, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_171, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_172, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_173, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_174, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_175, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_176, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_177, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_178, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_179, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_180, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_181, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_182, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_183, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_184, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_185, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_186, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_187, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_vv_188, AgradDistributionTestFixture, AgradDistributionsCauchy_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradDistributionsCauchy, type_v_200> AgradDistributionsCauchy_v_200;
+typedef std::tuple<AgradDistributionsCauchy, type_v_201> AgradDistributionsCauchy_v_201;
+typedef std::tuple<AgradDistributionsCauchy, type_v_202> AgradDistributionsCauchy_v_202;
+typedef std::tuple<AgradDistributionsCauchy, type_v_203> AgradDistributionsCauchy_v_203;
+typedef std::tuple<AgradDistributionsCauchy, type_v_204> AgradDistributionsCauchy_v_204;
+typedef std::tuple<AgradDistributionsCauchy, type_v_205> AgradDistributionsCauchy_v_205;
+typedef std::tuple<AgradDistributionsCauchy, type_v_206> AgradDistributionsCauchy_v_206;
+typedef std::tuple<AgradDistributionsCauchy, type_v_207> AgradDistributionsCauchy_v_207;
+typedef std::tuple<AgradDistributionsCauchy, type_v_208> AgradDistributionsCauchy_v_208;
+typedef std::tuple<AgradDistributionsCauchy, type_v_209> AgradDistributionsCauchy_v_209;
+typedef std::tuple<AgradDistributionsCauchy, type_v_210> AgradDistributionsCauchy_v_210;
+typedef std::tuple<AgradDistributionsCauchy, type_v_211> AgradDistributionsCauchy_v_211;
+typedef std::tuple<AgradDistributionsCauchy, type_v_212> AgradDistributionsCauchy_v_212;
+typedef std::tuple<AgradDistributionsCauchy, type_v_213> AgradDistributionsCauchy_v_213;
+typedef std::tuple<AgradDistributionsCauchy, type_v_214> AgradDistributionsCauchy_v_214;
+typedef std::tuple<AgradDistributionsCauchy, type_v_215> AgradDistributionsCauchy_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_200, AgradDistributionTestFixture, AgradDistributionsCauchy_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_201, AgradDistributionTestFixture, AgradDistributionsCauchy_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_202, AgradDistributionTestFixture, AgradDistributionsCauchy_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_203, AgradDistributionTestFixture, AgradDistributionsCauchy_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_204, AgradDistributionTestFixture, AgradDistributionsCauchy_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_205, AgradDistributionTestFixture, AgradDistributionsCauchy_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_206, AgradDistributionTestFixture, AgradDistributionsCauchy_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_207, AgradDistributionTestFixture, AgradDistributionsCauchy_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_208, AgradDistributionTestFixture, AgradDistributionsCauchy_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_209, AgradDistributionTestFixture, AgradDistributionsCauchy_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_210, AgradDistributionTestFixture, AgradDistributionsCauchy_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_211, AgradDistributionTestFixture, AgradDistributionsCauchy_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_212, AgradDistributionTestFixture, AgradDistributionsCauchy_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_213, AgradDistributionTestFixture, AgradDistributionsCauchy_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_214, AgradDistributionTestFixture, AgradDistributionsCauchy_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsCauchy_v_215, AgradDistributionTestFixture, AgradDistributionsCauchy_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_0> AgradCcdfLogCauchy_ffv_0;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_1> AgradCcdfLogCauchy_ffv_1;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_2> AgradCcdfLogCauchy_ffv_2;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_3> AgradCcdfLogCauchy_ffv_3;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_4> AgradCcdfLogCauchy_ffv_4;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_5> AgradCcdfLogCauchy_ffv_5;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_6> AgradCcdfLogCauchy_ffv_6;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_7> AgradCcdfLogCauchy_ffv_7;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_8> AgradCcdfLogCauchy_ffv_8;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_9> AgradCcdfLogCauchy_ffv_9;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_10> AgradCcdfLogCauchy_ffv_10;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_11> AgradCcdfLogCauchy_ffv_11;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_12> AgradCcdfLogCauchy_ffv_12;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_13> AgradCcdfLogCauchy_ffv_13;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_14> AgradCcdfLogCauchy_ffv_14;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_15> AgradCcdfLogCauchy_ffv_15;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_16> AgradCcdfLogCauchy_ffv_16;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_17> AgradCcdfLogCauchy_ffv_17;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_18> AgradCcdfLogCauchy_ffv_18;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_19> AgradCcdfLogCauchy_ffv_19;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_20> AgradCcdfLogCauchy_ffv_20;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_21> AgradCcdfLogCauchy_ffv_21;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_22> AgradCcdfLogCauchy_ffv_22;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_23> AgradCcdfLogCauchy_ffv_23;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_24> AgradCcdfLogCauchy_ffv_24;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_25> AgradCcdfLogCauchy_ffv_25;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_26> AgradCcdfLogCauchy_ffv_26;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_27> AgradCcdfLogCauchy_ffv_27;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_28> AgradCcdfLogCauchy_ffv_28;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_29> AgradCcdfLogCauchy_ffv_29;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_30> AgradCcdfLogCauchy_ffv_30;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_31> AgradCcdfLogCauchy_ffv_31;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_32> AgradCcdfLogCauchy_ffv_32;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_33> AgradCcdfLogCauchy_ffv_33;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_34> AgradCcdfLogCauchy_ffv_34;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_35> AgradCcdfLogCauchy_ffv_35;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_36> AgradCcdfLogCauchy_ffv_36;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_37> AgradCcdfLogCauchy_ffv_37;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_38> AgradCcdfLogCauchy_ffv_38;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_39> AgradCcdfLogCauchy_ffv_39;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_40> AgradCcdfLogCauchy_ffv_40;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_41> AgradCcdfLogCauchy_ffv_41;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_42> AgradCcdfLogCauchy_ffv_42;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_43> AgradCcdfLogCauchy_ffv_43;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_44> AgradCcdfLogCauchy_ffv_44;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_45> AgradCcdfLogCauchy_ffv_45;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_46> AgradCcdfLogCauchy_ffv_46;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_47> AgradCcdfLogCauchy_ffv_47;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_48> AgradCcdfLogCauchy_ffv_48;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_49> AgradCcdfLogCauchy_ffv_49;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_50> AgradCcdfLogCauchy_ffv_50;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_51> AgradCcdfLogCauchy_ffv_51;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_52> AgradCcdfLogCauchy_ffv_52;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_53> AgradCcdfLogCauchy_ffv_53;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_54> AgradCcdfLogCauchy_ffv_54;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_55> AgradCcdfLogCauchy_ffv_55;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_56> AgradCcdfLogCauchy_ffv_56;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_57> AgradCcdfLogCauchy_ffv_57;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_58> AgradCcdfLogCauchy_ffv_58;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_59> AgradCcdfLogCauchy_ffv_59;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_60> AgradCcdfLogCauchy_ffv_60;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_61> AgradCcdfLogCauchy_ffv_61;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_62> AgradCcdfLogCauchy_ffv_62;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_63> AgradCcdfLogCauchy_ffv_63;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_64> AgradCcdfLogCauchy_ffv_64;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_65> AgradCcdfLogCauchy_ffv_65;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_66> AgradCcdfLogCauchy_ffv_66;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_67> AgradCcdfLogCauchy_ffv_67;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_68> AgradCcdfLogCauchy_ffv_68;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_69> AgradCcdfLogCauchy_ffv_69;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_70> AgradCcdfLogCauchy_ffv_70;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_71> AgradCcdfLogCauchy_ffv_71;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_72> AgradCcdfLogCauchy_ffv_72;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_73> AgradCcdfLogCauchy_ffv_73;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_74> AgradCcdfLogCauchy_ffv_74;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_75> AgradCcdfLogCauchy_ffv_75;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_76> AgradCcdfLogCauchy_ffv_76;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_77> AgradCcdfLogCauchy_ffv_77;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_78> AgradCcdfLogCauchy_ffv_78;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_79> AgradCcdfLogCauchy_ffv_79;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_80> AgradCcdfLogCauchy_ffv_80;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_81> AgradCcdfLogCauchy_ffv_81;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_82> AgradCcdfLogCauchy_ffv_82;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_83> AgradCcdfLogCauchy_ffv_83;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_84> AgradCcdfLogCauchy_ffv_84;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_85> AgradCcdfLogCauchy_ffv_85;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_86> AgradCcdfLogCauchy_ffv_86;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_87> AgradCcdfLogCauchy_ffv_87;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_88> AgradCcdfLogCauchy_ffv_88;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_89> AgradCcdfLogCauchy_ffv_89;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_90> AgradCcdfLogCauchy_ffv_90;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_91> AgradCcdfLogCauchy_ffv_91;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_92> AgradCcdfLogCauchy_ffv_92;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_93> AgradCcdfLogCauchy_ffv_93;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_94> AgradCcdfLogCauchy_ffv_94;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_95> AgradCcdfLogCauchy_ffv_95;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_96> AgradCcdfLogCauchy_ffv_96;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_97> AgradCcdfLogCauchy_ffv_97;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_98> AgradCcdfLogCauchy_ffv_98;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_99> AgradCcdfLogCauchy_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogCauchy, type_v_0> AgradCcdfLogCauchy_v_0;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_1> AgradCcdfLogCauchy_v_1;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_2> AgradCcdfLogCauchy_v_2;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_3> AgradCcdfLogCauchy_v_3;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_4> AgradCcdfLogCauchy_v_4;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_5> AgradCcdfLogCauchy_v_5;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_6> AgradCcdfLogCauchy_v_6;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_7> AgradCcdfLogCauchy_v_7;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_8> AgradCcdfLogCauchy_v_8;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_9> AgradCcdfLogCauchy_v_9;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_10> AgradCcdfLogCauchy_v_10;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_11> AgradCcdfLogCauchy_v_11;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_12> AgradCcdfLogCauchy_v_12;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_13> AgradCcdfLogCauchy_v_13;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_14> AgradCcdfLogCauchy_v_14;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_15> AgradCcdfLogCauchy_v_15;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_16> AgradCcdfLogCauchy_v_16;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_17> AgradCcdfLogCauchy_v_17;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_18> AgradCcdfLogCauchy_v_18;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_19> AgradCcdfLogCauchy_v_19;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_20> AgradCcdfLogCauchy_v_20;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_21> AgradCcdfLogCauchy_v_21;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_22> AgradCcdfLogCauchy_v_22;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_23> AgradCcdfLogCauchy_v_23;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_24> AgradCcdfLogCauchy_v_24;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_25> AgradCcdfLogCauchy_v_25;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_26> AgradCcdfLogCauchy_v_26;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_27> AgradCcdfLogCauchy_v_27;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_28> AgradCcdfLogCauchy_v_28;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_29> AgradCcdfLogCauchy_v_29;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_30> AgradCcdfLogCauchy_v_30;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_31> AgradCcdfLogCauchy_v_31;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_32> AgradCcdfLogCauchy_v_32;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_33> AgradCcdfLogCauchy_v_33;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_34> AgradCcdfLogCauchy_v_34;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_35> AgradCcdfLogCauchy_v_35;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_36> AgradCcdfLogCauchy_v_36;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_37> AgradCcdfLogCauchy_v_37;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_38> AgradCcdfLogCauchy_v_38;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_39> AgradCcdfLogCauchy_v_39;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_40> AgradCcdfLogCauchy_v_40;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_41> AgradCcdfLogCauchy_v_41;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_42> AgradCcdfLogCauchy_v_42;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_43> AgradCcdfLogCauchy_v_43;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_44> AgradCcdfLogCauchy_v_44;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_45> AgradCcdfLogCauchy_v_45;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_46> AgradCcdfLogCauchy_v_46;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_47> AgradCcdfLogCauchy_v_47;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_48> AgradCcdfLogCauchy_v_48;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_49> AgradCcdfLogCauchy_v_49;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_50> AgradCcdfLogCauchy_v_50;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_51> AgradCcdfLogCauchy_v_51;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_52> AgradCcdfLogCauchy_v_52;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_53> AgradCcdfLogCauchy_v_53;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_54> AgradCcdfLogCauchy_v_54;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_55> AgradCcdfLogCauchy_v_55;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_56> AgradCcdfLogCauchy_v_56;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_57> AgradCcdfLogCauchy_v_57;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_58> AgradCcdfLogCauchy_v_58;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_59> AgradCcdfLogCauchy_v_59;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_60> AgradCcdfLogCauchy_v_60;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_61> AgradCcdfLogCauchy_v_61;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_62> AgradCcdfLogCauchy_v_62;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_63> AgradCcdfLogCauchy_v_63;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_64> AgradCcdfLogCauchy_v_64;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_65> AgradCcdfLogCauchy_v_65;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_66> AgradCcdfLogCauchy_v_66;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_67> AgradCcdfLogCauchy_v_67;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_68> AgradCcdfLogCauchy_v_68;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_69> AgradCcdfLogCauchy_v_69;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_70> AgradCcdfLogCauchy_v_70;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_71> AgradCcdfLogCauchy_v_71;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_72> AgradCcdfLogCauchy_v_72;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_73> AgradCcdfLogCauchy_v_73;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_74> AgradCcdfLogCauchy_v_74;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_75> AgradCcdfLogCauchy_v_75;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_76> AgradCcdfLogCauchy_v_76;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_77> AgradCcdfLogCauchy_v_77;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_78> AgradCcdfLogCauchy_v_78;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_79> AgradCcdfLogCauchy_v_79;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_80> AgradCcdfLogCauchy_v_80;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_81> AgradCcdfLogCauchy_v_81;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_82> AgradCcdfLogCauchy_v_82;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_83> AgradCcdfLogCauchy_v_83;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_84> AgradCcdfLogCauchy_v_84;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_85> AgradCcdfLogCauchy_v_85;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_86> AgradCcdfLogCauchy_v_86;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_87> AgradCcdfLogCauchy_v_87;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_88> AgradCcdfLogCauchy_v_88;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_89> AgradCcdfLogCauchy_v_89;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_90> AgradCcdfLogCauchy_v_90;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_91> AgradCcdfLogCauchy_v_91;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_92> AgradCcdfLogCauchy_v_92;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_93> AgradCcdfLogCauchy_v_93;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_94> AgradCcdfLogCauchy_v_94;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_95> AgradCcdfLogCauchy_v_95;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_96> AgradCcdfLogCauchy_v_96;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_97> AgradCcdfLogCauchy_v_97;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_98> AgradCcdfLogCauchy_v_98;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_99> AgradCcdfLogCauchy_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_0, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_1, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_2, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_3, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_4, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_5, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_6, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_7, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_8, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_9, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_10, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_11, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_12, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_13, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_14, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_15, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_16, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_17, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_18, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_19, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_20, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_21, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_22, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_23, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_24, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_25, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_26, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_27, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_28, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_29, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_30, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_31, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_32, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_33, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_34, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_35, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_36, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_37, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_38, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_39, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_40, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_41, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_42, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_43, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_44, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_45, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_46, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_47, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_48, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_49, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_50, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_51, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_52, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_53, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_54, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_55, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_56, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_57, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_58, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_59, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_60, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_61, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_62, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_63, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_64, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_65, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_66, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_67, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_68, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_69, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_70, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_71, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_72, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_73, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_74, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_75, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_76, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_77, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_78, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_79, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_80, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_81, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_82, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_83, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_84, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_85, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_86, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_87, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_88, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_89, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_90, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_91, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_92, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_93, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_94, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_95, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_96, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_97, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_98, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_99, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_0> AgradCcdfLogCauchy_vv_0;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_1> AgradCcdfLogCauchy_vv_1;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_2> AgradCcdfLogCauchy_vv_2;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_3> AgradCcdfLogCauchy_vv_3;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_4> AgradCcdfLogCauchy_vv_4;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_5> AgradCcdfLogCauchy_vv_5;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_6> AgradCcdfLogCauchy_vv_6;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_7> AgradCcdfLogCauchy_vv_7;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_8> AgradCcdfLogCauchy_vv_8;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_9> AgradCcdfLogCauchy_vv_9;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_10> AgradCcdfLogCauchy_vv_10;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_11> AgradCcdfLogCauchy_vv_11;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_12> AgradCcdfLogCauchy_vv_12;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_13> AgradCcdfLogCauchy_vv_13;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_14> AgradCcdfLogCauchy_vv_14;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_15> AgradCcdfLogCauchy_vv_15;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_16> AgradCcdfLogCauchy_vv_16;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_17> AgradCcdfLogCauchy_vv_17;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_18> AgradCcdfLogCauchy_vv_18;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_19> AgradCcdfLogCauchy_vv_19;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_20> AgradCcdfLogCauchy_vv_20;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_21> AgradCcdfLogCauchy_vv_21;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_22> AgradCcdfLogCauchy_vv_22;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_23> AgradCcdfLogCauchy_vv_23;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_24> AgradCcdfLogCauchy_vv_24;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_25> AgradCcdfLogCauchy_vv_25;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_26> AgradCcdfLogCauchy_vv_26;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_27> AgradCcdfLogCauchy_vv_27;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_28> AgradCcdfLogCauchy_vv_28;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_29> AgradCcdfLogCauchy_vv_29;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_30> AgradCcdfLogCauchy_vv_30;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_31> AgradCcdfLogCauchy_vv_31;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_32> AgradCcdfLogCauchy_vv_32;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_33> AgradCcdfLogCauchy_vv_33;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_34> AgradCcdfLogCauchy_vv_34;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_35> AgradCcdfLogCauchy_vv_35;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_36> AgradCcdfLogCauchy_vv_36;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_37> AgradCcdfLogCauchy_vv_37;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_38> AgradCcdfLogCauchy_vv_38;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_39> AgradCcdfLogCauchy_vv_39;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_40> AgradCcdfLogCauchy_vv_40;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_41> AgradCcdfLogCauchy_vv_41;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_42> AgradCcdfLogCauchy_vv_42;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_43> AgradCcdfLogCauchy_vv_43;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_44> AgradCcdfLogCauchy_vv_44;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_45> AgradCcdfLogCauchy_vv_45;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_46> AgradCcdfLogCauchy_vv_46;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_47> AgradCcdfLogCauchy_vv_47;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_48> AgradCcdfLogCauchy_vv_48;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_49> AgradCcdfLogCauchy_vv_49;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_50> AgradCcdfLogCauchy_vv_50;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_51> AgradCcdfLogCauchy_vv_51;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_52> AgradCcdfLogCauchy_vv_52;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_53> AgradCcdfLogCauchy_vv_53;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_54> AgradCcdfLogCauchy_vv_54;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_55> AgradCcdfLogCauchy_vv_55;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_56> AgradCcdfLogCauchy_vv_56;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_57> AgradCcdfLogCauchy_vv_57;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_58> AgradCcdfLogCauchy_vv_58;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_59> AgradCcdfLogCauchy_vv_59;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_60> AgradCcdfLogCauchy_vv_60;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_61> AgradCcdfLogCauchy_vv_61;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_62> AgradCcdfLogCauchy_vv_62;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_63> AgradCcdfLogCauchy_vv_63;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_64> AgradCcdfLogCauchy_vv_64;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_65> AgradCcdfLogCauchy_vv_65;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_66> AgradCcdfLogCauchy_vv_66;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_67> AgradCcdfLogCauchy_vv_67;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_68> AgradCcdfLogCauchy_vv_68;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_69> AgradCcdfLogCauchy_vv_69;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_70> AgradCcdfLogCauchy_vv_70;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_71> AgradCcdfLogCauchy_vv_71;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_72> AgradCcdfLogCauchy_vv_72;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_73> AgradCcdfLogCauchy_vv_73;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_74> AgradCcdfLogCauchy_vv_74;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_75> AgradCcdfLogCauchy_vv_75;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_76> AgradCcdfLogCauchy_vv_76;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_77> AgradCcdfLogCauchy_vv_77;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_78> AgradCcdfLogCauchy_vv_78;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_79> AgradCcdfLogCauchy_vv_79;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_80> AgradCcdfLogCauchy_vv_80;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_81> AgradCcdfLogCauchy_vv_81;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_82> AgradCcdfLogCauchy_vv_82;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_83> AgradCcdfLogCauchy_vv_83;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_84> AgradCcdfLogCauchy_vv_84;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_85> AgradCcdfLogCauchy_vv_85;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_86> AgradCcdfLogCauchy_vv_86;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_87> AgradCcdfLogCauchy_vv_87;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_88> AgradCcdfLogCauchy_vv_88;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_89> AgradCcdfLogCauchy_vv_89;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_90> AgradCcdfLogCauchy_vv_90;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_91> AgradCcdfLogCauchy_vv_91;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_92> AgradCcdfLogCauchy_vv_92;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_93> AgradCcdfLogCauchy_vv_93;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_94> AgradCcdfLogCauchy_vv_94;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_95> AgradCcdfLogCauchy_vv_95;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_96> AgradCcdfLogCauchy_vv_96;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_97> AgradCcdfLogCauchy_vv_97;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_98> AgradCcdfLogCauchy_vv_98;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_99> AgradCcdfLogCauchy_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_100> AgradCcdfLogCauchy_ffv_100;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_101> AgradCcdfLogCauchy_ffv_101;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_102> AgradCcdfLogCauchy_ffv_102;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_103> AgradCcdfLogCauchy_ffv_103;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_104> AgradCcdfLogCauchy_ffv_104;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_105> AgradCcdfLogCauchy_ffv_105;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_106> AgradCcdfLogCauchy_ffv_106;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_107> AgradCcdfLogCauchy_ffv_107;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_108> AgradCcdfLogCauchy_ffv_108;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_109> AgradCcdfLogCauchy_ffv_109;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_110> AgradCcdfLogCauchy_ffv_110;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_111> AgradCcdfLogCauchy_ffv_111;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_112> AgradCcdfLogCauchy_ffv_112;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_113> AgradCcdfLogCauchy_ffv_113;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_114> AgradCcdfLogCauchy_ffv_114;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_115> AgradCcdfLogCauchy_ffv_115;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_116> AgradCcdfLogCauchy_ffv_116;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_117> AgradCcdfLogCauchy_ffv_117;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_118> AgradCcdfLogCauchy_ffv_118;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_119> AgradCcdfLogCauchy_ffv_119;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_120> AgradCcdfLogCauchy_ffv_120;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_121> AgradCcdfLogCauchy_ffv_121;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_122> AgradCcdfLogCauchy_ffv_122;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_123> AgradCcdfLogCauchy_ffv_123;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_124> AgradCcdfLogCauchy_ffv_124;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_125> AgradCcdfLogCauchy_ffv_125;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_126> AgradCcdfLogCauchy_ffv_126;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_127> AgradCcdfLogCauchy_ffv_127;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_128> AgradCcdfLogCauchy_ffv_128;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_129> AgradCcdfLogCauchy_ffv_129;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_130> AgradCcdfLogCauchy_ffv_130;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_131> AgradCcdfLogCauchy_ffv_131;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_132> AgradCcdfLogCauchy_ffv_132;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_133> AgradCcdfLogCauchy_ffv_133;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_134> AgradCcdfLogCauchy_ffv_134;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_135> AgradCcdfLogCauchy_ffv_135;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_136> AgradCcdfLogCauchy_ffv_136;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_137> AgradCcdfLogCauchy_ffv_137;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_138> AgradCcdfLogCauchy_ffv_138;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_139> AgradCcdfLogCauchy_ffv_139;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_140> AgradCcdfLogCauchy_ffv_140;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_141> AgradCcdfLogCauchy_ffv_141;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_142> AgradCcdfLogCauchy_ffv_142;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_143> AgradCcdfLogCauchy_ffv_143;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_144> AgradCcdfLogCauchy_ffv_144;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_145> AgradCcdfLogCauchy_ffv_145;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_146> AgradCcdfLogCauchy_ffv_146;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_147> AgradCcdfLogCauchy_ffv_147;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_148> AgradCcdfLogCauchy_ffv_148;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_149> AgradCcdfLogCauchy_ffv_149;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_150> AgradCcdfLogCauchy_ffv_150;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_151> AgradCcdfLogCauchy_ffv_151;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_152> AgradCcdfLogCauchy_ffv_152;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_153> AgradCcdfLogCauchy_ffv_153;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_154> AgradCcdfLogCauchy_ffv_154;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_155> AgradCcdfLogCauchy_ffv_155;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_156> AgradCcdfLogCauchy_ffv_156;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_157> AgradCcdfLogCauchy_ffv_157;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_158> AgradCcdfLogCauchy_ffv_158;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_159> AgradCcdfLogCauchy_ffv_159;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_160> AgradCcdfLogCauchy_ffv_160;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_161> AgradCcdfLogCauchy_ffv_161;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_162> AgradCcdfLogCauchy_ffv_162;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_163> AgradCcdfLogCauchy_ffv_163;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_164> AgradCcdfLogCauchy_ffv_164;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_165> AgradCcdfLogCauchy_ffv_165;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_166> AgradCcdfLogCauchy_ffv_166;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_167> AgradCcdfLogCauchy_ffv_167;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_168> AgradCcdfLogCauchy_ffv_168;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_169> AgradCcdfLogCauchy_ffv_169;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_170> AgradCcdfLogCauchy_ffv_170;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_171> AgradCcdfLogCauchy_ffv_171;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_172> AgradCcdfLogCauchy_ffv_172;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_173> AgradCcdfLogCauchy_ffv_173;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_174> AgradCcdfLogCauchy_ffv_174;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_175> AgradCcdfLogCauchy_ffv_175;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_176> AgradCcdfLogCauchy_ffv_176;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_177> AgradCcdfLogCauchy_ffv_177;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_178> AgradCcdfLogCauchy_ffv_178;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_179> AgradCcdfLogCauchy_ffv_179;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_180> AgradCcdfLogCauchy_ffv_180;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_181> AgradCcdfLogCauchy_ffv_181;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_182> AgradCcdfLogCauchy_ffv_182;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_183> AgradCcdfLogCauchy_ffv_183;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_184> AgradCcdfLogCauchy_ffv_184;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_185> AgradCcdfLogCauchy_ffv_185;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_186> AgradCcdfLogCauchy_ffv_186;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_187> AgradCcdfLogCauchy_ffv_187;
+typedef std::tuple<AgradCcdfLogCauchy, type_ffv_188> AgradCcdfLogCauchy_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogCauchy, type_v_100> AgradCcdfLogCauchy_v_100;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_101> AgradCcdfLogCauchy_v_101;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_102> AgradCcdfLogCauchy_v_102;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_103> AgradCcdfLogCauchy_v_103;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_104> AgradCcdfLogCauchy_v_104;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_105> AgradCcdfLogCauchy_v_105;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_106> AgradCcdfLogCauchy_v_106;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_107> AgradCcdfLogCauchy_v_107;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_108> AgradCcdfLogCauchy_v_108;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_109> AgradCcdfLogCauchy_v_109;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_110> AgradCcdfLogCauchy_v_110;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_111> AgradCcdfLogCauchy_v_111;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_112> AgradCcdfLogCauchy_v_112;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_113> AgradCcdfLogCauchy_v_113;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_114> AgradCcdfLogCauchy_v_114;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_115> AgradCcdfLogCauchy_v_115;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_116> AgradCcdfLogCauchy_v_116;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_117> AgradCcdfLogCauchy_v_117;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_118> AgradCcdfLogCauchy_v_118;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_119> AgradCcdfLogCauchy_v_119;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_120> AgradCcdfLogCauchy_v_120;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_121> AgradCcdfLogCauchy_v_121;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_122> AgradCcdfLogCauchy_v_122;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_123> AgradCcdfLogCauchy_v_123;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_124> AgradCcdfLogCauchy_v_124;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_125> AgradCcdfLogCauchy_v_125;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_126> AgradCcdfLogCauchy_v_126;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_127> AgradCcdfLogCauchy_v_127;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_128> AgradCcdfLogCauchy_v_128;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_129> AgradCcdfLogCauchy_v_129;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_130> AgradCcdfLogCauchy_v_130;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_131> AgradCcdfLogCauchy_v_131;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_132> AgradCcdfLogCauchy_v_132;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_133> AgradCcdfLogCauchy_v_133;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_134> AgradCcdfLogCauchy_v_134;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_135> AgradCcdfLogCauchy_v_135;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_136> AgradCcdfLogCauchy_v_136;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_137> AgradCcdfLogCauchy_v_137;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_138> AgradCcdfLogCauchy_v_138;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_139> AgradCcdfLogCauchy_v_139;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_140> AgradCcdfLogCauchy_v_140;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_141> AgradCcdfLogCauchy_v_141;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_142> AgradCcdfLogCauchy_v_142;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_143> AgradCcdfLogCauchy_v_143;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_144> AgradCcdfLogCauchy_v_144;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_145> AgradCcdfLogCauchy_v_145;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_146> AgradCcdfLogCauchy_v_146;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_147> AgradCcdfLogCauchy_v_147;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_148> AgradCcdfLogCauchy_v_148;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_149> AgradCcdfLogCauchy_v_149;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_150> AgradCcdfLogCauchy_v_150;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_151> AgradCcdfLogCauchy_v_151;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_152> AgradCcdfLogCauchy_v_152;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_153> AgradCcdfLogCauchy_v_153;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_154> AgradCcdfLogCauchy_v_154;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_155> AgradCcdfLogCauchy_v_155;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_156> AgradCcdfLogCauchy_v_156;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_157> AgradCcdfLogCauchy_v_157;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_158> AgradCcdfLogCauchy_v_158;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_159> AgradCcdfLogCauchy_v_159;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_160> AgradCcdfLogCauchy_v_160;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_161> AgradCcdfLogCauchy_v_161;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_162> AgradCcdfLogCauchy_v_162;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_163> AgradCcdfLogCauchy_v_163;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_164> AgradCcdfLogCauchy_v_164;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_165> AgradCcdfLogCauchy_v_165;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_166> AgradCcdfLogCauchy_v_166;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_167> AgradCcdfLogCauchy_v_167;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_168> AgradCcdfLogCauchy_v_168;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_169> AgradCcdfLogCauchy_v_169;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_170> AgradCcdfLogCauchy_v_170;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_171> AgradCcdfLogCauchy_v_171;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_172> AgradCcdfLogCauchy_v_172;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_173> AgradCcdfLogCauchy_v_173;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_174> AgradCcdfLogCauchy_v_174;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_175> AgradCcdfLogCauchy_v_175;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_176> AgradCcdfLogCauchy_v_176;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_177> AgradCcdfLogCauchy_v_177;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_178> AgradCcdfLogCauchy_v_178;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_179> AgradCcdfLogCauchy_v_179;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_180> AgradCcdfLogCauchy_v_180;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_181> AgradCcdfLogCauchy_v_181;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_182> AgradCcdfLogCauchy_v_182;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_183> AgradCcdfLogCauchy_v_183;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_184> AgradCcdfLogCauchy_v_184;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_185> AgradCcdfLogCauchy_v_185;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_186> AgradCcdfLogCauchy_v_186;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_187> AgradCcdfLogCauchy_v_187;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_188> AgradCcdfLogCauchy_v_188;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_189> AgradCcdfLogCauchy_v_189;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_190> AgradCcdfLogCauchy_v_190;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_191> AgradCcdfLogCauchy_v_191;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_192> AgradCcdfLogCauchy_v_192;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_193> AgradCcdfLogCauchy_v_193;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_194> AgradCcdfLogCauchy_v_194;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_195> AgradCcdfLogCauchy_v_195;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_196> AgradCcdfLogCauchy_v_196;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_197> AgradCcdfLogCauchy_v_197;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_198> AgradCcdfLogCauchy_v_198;
+typedef std::tuple<AgradCcdfLogCauchy, type_v_199> AgradCcdfLogCauchy_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_100, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_101, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_102, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_103, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_104, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_105, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_106, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_107, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_108, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_109, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_110, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_111, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_112, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_113, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_114, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_115, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_116, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_117, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_118, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_119, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_120, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_121, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_122, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_123, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_124, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_125, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_126, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_127, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_128, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_129, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_130, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_131, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_132, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_133, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_134, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_135, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_136, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_137, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_138, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_139, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_140, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_141, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_142, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_143, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_144, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_145, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_146, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_147, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_148, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_149, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_150, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_151, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_152, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_153, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_154, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_155, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_156, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_157, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_158, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_159, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_160, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_161, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_162, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_163, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_164, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_165, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_166, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_167, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_168, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_169, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_170, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_171, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_172, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_173, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_174, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_175, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_176, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_177, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_178, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_179, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_180, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_181, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_182, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_183, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_184, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_185, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_186, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_187, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_188, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_189, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_190, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_191, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_192, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_193, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_194, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_195, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_196, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_197, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_198, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_v_199, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_100> AgradCcdfLogCauchy_vv_100;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_101> AgradCcdfLogCauchy_vv_101;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_102> AgradCcdfLogCauchy_vv_102;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_103> AgradCcdfLogCauchy_vv_103;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_104> AgradCcdfLogCauchy_vv_104;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_105> AgradCcdfLogCauchy_vv_105;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_106> AgradCcdfLogCauchy_vv_106;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_107> AgradCcdfLogCauchy_vv_107;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_108> AgradCcdfLogCauchy_vv_108;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_109> AgradCcdfLogCauchy_vv_109;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_110> AgradCcdfLogCauchy_vv_110;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_111> AgradCcdfLogCauchy_vv_111;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_112> AgradCcdfLogCauchy_vv_112;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_113> AgradCcdfLogCauchy_vv_113;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_114> AgradCcdfLogCauchy_vv_114;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_115> AgradCcdfLogCauchy_vv_115;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_116> AgradCcdfLogCauchy_vv_116;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_117> AgradCcdfLogCauchy_vv_117;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_118> AgradCcdfLogCauchy_vv_118;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_119> AgradCcdfLogCauchy_vv_119;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_120> AgradCcdfLogCauchy_vv_120;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_121> AgradCcdfLogCauchy_vv_121;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_122> AgradCcdfLogCauchy_vv_122;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_123> AgradCcdfLogCauchy_vv_123;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_124> AgradCcdfLogCauchy_vv_124;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_125> AgradCcdfLogCauchy_vv_125;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_126> AgradCcdfLogCauchy_vv_126;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_127> AgradCcdfLogCauchy_vv_127;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_128> AgradCcdfLogCauchy_vv_128;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_129> AgradCcdfLogCauchy_vv_129;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_130> AgradCcdfLogCauchy_vv_130;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_131> AgradCcdfLogCauchy_vv_131;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_132> AgradCcdfLogCauchy_vv_132;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_133> AgradCcdfLogCauchy_vv_133;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_134> AgradCcdfLogCauchy_vv_134;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_135> AgradCcdfLogCauchy_vv_135;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_136> AgradCcdfLogCauchy_vv_136;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_137> AgradCcdfLogCauchy_vv_137;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_138> AgradCcdfLogCauchy_vv_138;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_139> AgradCcdfLogCauchy_vv_139;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_140> AgradCcdfLogCauchy_vv_140;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_141> AgradCcdfLogCauchy_vv_141;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_142> AgradCcdfLogCauchy_vv_142;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_143> AgradCcdfLogCauchy_vv_143;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_144> AgradCcdfLogCauchy_vv_144;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_145> AgradCcdfLogCauchy_vv_145;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_146> AgradCcdfLogCauchy_vv_146;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_147> AgradCcdfLogCauchy_vv_147;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_148> AgradCcdfLogCauchy_vv_148;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_149> AgradCcdfLogCauchy_vv_149;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_150> AgradCcdfLogCauchy_vv_150;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_151> AgradCcdfLogCauchy_vv_151;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_152> AgradCcdfLogCauchy_vv_152;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_153> AgradCcdfLogCauchy_vv_153;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_154> AgradCcdfLogCauchy_vv_154;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_155> AgradCcdfLogCauchy_vv_155;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_156> AgradCcdfLogCauchy_vv_156;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_157> AgradCcdfLogCauchy_vv_157;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_158> AgradCcdfLogCauchy_vv_158;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_159> AgradCcdfLogCauchy_vv_159;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_160> AgradCcdfLogCauchy_vv_160;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_161> AgradCcdfLogCauchy_vv_161;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_162> AgradCcdfLogCauchy_vv_162;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_163> AgradCcdfLogCauchy_vv_163;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_164> AgradCcdfLogCauchy_vv_164;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_165> AgradCcdfLogCauchy_vv_165;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_166> AgradCcdfLogCauchy_vv_166;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_167> AgradCcdfLogCauchy_vv_167;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_168> AgradCcdfLogCauchy_vv_168;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_169> AgradCcdfLogCauchy_vv_169;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_170> AgradCcdfLogCauchy_vv_170;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_171> AgradCcdfLogCauchy_vv_171;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_172> AgradCcdfLogCauchy_vv_172;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_173> AgradCcdfLogCauchy_vv_173;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_174> AgradCcdfLogCauchy_vv_174;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_175> AgradCcdfLogCauchy_vv_175;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_176> AgradCcdfLogCauchy_vv_176;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_177> AgradCcdfLogCauchy_vv_177;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_178> AgradCcdfLogCauchy_vv_178;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_179> AgradCcdfLogCauchy_vv_179;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_180> AgradCcdfLogCauchy_vv_180;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_181> AgradCcdfLogCauchy_vv_181;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_182> AgradCcdfLogCauchy_vv_182;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_183> AgradCcdfLogCauchy_vv_183;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_184> AgradCcdfLogCauchy_vv_184;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_185> AgradCcdfLogCauchy_vv_185;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_186> AgradCcdfLogCauchy_vv_186;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_187> AgradCcdfLogCauchy_vv_187;
+typedef std::tuple<AgradCcdfLogCauchy, type_vv_188> AgradCcdfLogCauchy_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogCauchy_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogCauchy_vv_188);
+
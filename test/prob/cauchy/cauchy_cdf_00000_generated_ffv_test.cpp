@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfCauchy, type_ffv_0> AgradCdfCauchy_ffv_0;
+typedef std::tuple<AgradCdfCauchy, type_ffv_1> AgradCdfCauchy_ffv_1;
+typedef std::tuple<AgradCdfCauchy, type_ffv_2> AgradCdfCauchy_ffv_2;
+typedef std::tuple<AgradCdfCauchy, type_ffv_3> AgradCdfCauchy_ffv_3;
+typedef std::tuple<AgradCdfCauchy, type_ffv_4> AgradCdfCauchy_ffv_4;
+typedef std::tuple<AgradCdfCauchy, type_ffv_5> AgradCdfCauchy_ffv_5;
+typedef std::tuple<AgradCdfCauchy, type_ffv_6> AgradCdfCauchy_ffv_6;
+typedef std::tuple<AgradCdfCauchy, type_ffv_7> AgradCdfCauchy_ffv_7;
+typedef std::tuple<AgradCdfCauchy, type_ffv_8> AgradCdfCauchy_ffv_8;
+typedef std::tuple<AgradCdfCauchy, type_ffv_9> AgradCdfCauchy_ffv_9;
+typedef std::tuple<AgradCdfCauchy, type_ffv_10> AgradCdfCauchy_ffv_10;
+typedef std::tuple<AgradCdfCauchy, type_ffv_11> AgradCdfCauchy_ffv_11;
+typedef std::tuple<AgradCdfCauchy, type_ffv_12> AgradCdfCauchy_ffv_12;
+typedef std::tuple<AgradCdfCauchy, type_ffv_13> AgradCdfCauchy_ffv_13;
+typedef std::tuple<AgradCdfCauchy, type_ffv_14> AgradCdfCauchy_ffv_14;
+typedef std::tuple<AgradCdfCauchy, type_ffv_15> AgradCdfCauchy_ffv_15;
+typedef std::tuple<AgradCdfCauchy, type_ffv_16> AgradCdfCauchy_ffv_16;
+typedef std::tuple<AgradCdfCauchy, type_ffv_17> AgradCdfCauchy_ffv_17;
+typedef std::tuple<AgradCdfCauchy, type_ffv_18> AgradCdfCauchy_ffv_18;
+typedef std::tuple<AgradCdfCauchy, type_ffv_19> AgradCdfCauchy_ffv_19;
+typedef std::tuple<AgradCdfCauchy, type_ffv_20> AgradCdfCauchy_ffv_20;
+typedef std::tuple<AgradCdfCauchy, type_ffv_21> AgradCdfCauchy_ffv_21;
+typedef std::tuple<AgradCdfCauchy, type_ffv_22> AgradCdfCauchy_ffv_22;
+typedef std::tuple<AgradCdfCauchy, type_ffv_23> AgradCdfCauchy_ffv_23;
+typedef std::tuple<AgradCdfCauchy, type_ffv_24> AgradCdfCauchy_ffv_24;
+typedef std::tuple<AgradCdfCauchy, type_ffv_25> AgradCdfCauchy_ffv_25;
+typedef std::tuple<AgradCdfCauchy, type_ffv_26> AgradCdfCauchy_ffv_26;
+typedef std::tuple<AgradCdfCauchy, type_ffv_27> AgradCdfCauchy_ffv_27;
+typedef std::tuple<AgradCdfCauchy, type_ffv_28> AgradCdfCauchy_ffv_28;
+typedef std::tuple<AgradCdfCauchy, type_ffv_29> AgradCdfCauchy_ffv_29;
+typedef std::tuple<AgradCdfCauchy, type_ffv_30> AgradCdfCauchy_ffv_30;
+typedef std::tuple<AgradCdfCauchy, type_ffv_31> AgradCdfCauchy_ffv_31;
+typedef std::tuple<AgradCdfCauchy, type_ffv_32> AgradCdfCauchy_ffv_32;
+typedef std::tuple<AgradCdfCauchy, type_ffv_33> AgradCdfCauchy_ffv_33;
+typedef std::tuple<AgradCdfCauchy, type_ffv_34> AgradCdfCauchy_ffv_34;
+typedef std::tuple<AgradCdfCauchy, type_ffv_35> AgradCdfCauchy_ffv_35;
+typedef std::tuple<AgradCdfCauchy, type_ffv_36> AgradCdfCauchy_ffv_36;
+typedef std::tuple<AgradCdfCauchy, type_ffv_37> AgradCdfCauchy_ffv_37;
+typedef std::tuple<AgradCdfCauchy, type_ffv_38> AgradCdfCauchy_ffv_38;
+typedef std::tuple<AgradCdfCauchy, type_ffv_39> AgradCdfCauchy_ffv_39;
+typedef std::tuple<AgradCdfCauchy, type_ffv_40> AgradCdfCauchy_ffv_40;
+typedef std::tuple<AgradCdfCauchy, type_ffv_41> AgradCdfCauchy_ffv_41;
+typedef std::tuple<AgradCdfCauchy, type_ffv_42> AgradCdfCauchy_ffv_42;
+typedef std::tuple<AgradCdfCauchy, type_ffv_43> AgradCdfCauchy_ffv_43;
+typedef std::tuple<AgradCdfCauchy, type_ffv_44> AgradCdfCauchy_ffv_44;
+typedef std::tuple<AgradCdfCauchy, type_ffv_45> AgradCdfCauchy_ffv_45;
+typedef std::tuple<AgradCdfCauchy, type_ffv_46> AgradCdfCauchy_ffv_46;
+typedef std::tuple<AgradCdfCauchy, type_ffv_47> AgradCdfCauchy_ffv_47;
+typedef std::tuple<AgradCdfCauchy, type_ffv_48> AgradCdfCauchy_ffv_48;
+typedef std::tuple<AgradCdfCauchy, type_ffv_49> AgradCdfCauchy_ffv_49;
+typedef std::tuple<AgradCdfCauchy, type_ffv_50> AgradCdfCauchy_ffv_50;
+typedef std::tuple<AgradCdfCauchy, type_ffv_51> AgradCdfCauchy_ffv_51;
+typedef std::tuple<AgradCdfCauchy, type_ffv_52> AgradCdfCauchy_ffv_52;
+typedef std::tuple<AgradCdfCauchy, type_ffv_53> AgradCdfCauchy_ffv_53;
+typedef std::tuple<AgradCdfCauchy, type_ffv_54> AgradCdfCauchy_ffv_54;
+typedef std::tuple<AgradCdfCauchy, type_ffv_55> AgradCdfCauchy_ffv_55;
+typedef std::tuple<AgradCdfCauchy, type_ffv_56> AgradCdfCauchy_ffv_56;
+typedef std::tuple<AgradCdfCauchy, type_ffv_57> AgradCdfCauchy_ffv_57;
+typedef std::tuple<AgradCdfCauchy, type_ffv_58> AgradCdfCauchy_ffv_58;
+typedef std::tuple<AgradCdfCauchy, type_ffv_59> AgradCdfCauchy_ffv_59;
+typedef std::tuple<AgradCdfCauchy, type_ffv_60> AgradCdfCauchy_ffv_60;
+typedef std::tuple<AgradCdfCauchy, type_ffv_61> AgradCdfCauchy_ffv_61;
+typedef std::tuple<AgradCdfCauchy, type_ffv_62> AgradCdfCauchy_ffv_62;
+typedef std::tuple<AgradCdfCauchy, type_ffv_63> AgradCdfCauchy_ffv_63;
+typedef std::tuple<AgradCdfCauchy, type_ffv_64> AgradCdfCauchy_ffv_64;
+typedef std::tuple<AgradCdfCauchy, type_ffv_65> AgradCdfCauchy_ffv_65;
+typedef std::tuple<AgradCdfCauchy, type_ffv_66> AgradCdfCauchy_ffv_66;
+typedef std::tuple<AgradCdfCauchy, type_ffv_67> AgradCdfCauchy_ffv_67;
+typedef std::tuple<AgradCdfCauchy, type_ffv_68> AgradCdfCauchy_ffv_68;
+typedef std::tuple<AgradCdfCauchy, type_ffv_69> AgradCdfCauchy_ffv_69;
+typedef std::tuple<AgradCdfCauchy, type_ffv_70> AgradCdfCauchy_ffv_70;
+typedef std::tuple<AgradCdfCauchy, type_ffv_71> AgradCdfCauchy_ffv_71;
+typedef std::tuple<AgradCdfCauchy, type_ffv_72> AgradCdfCauchy_ffv_72;
+typedef std::tuple<AgradCdfCauchy, type_ffv_73> AgradCdfCauchy_ffv_73;
+typedef std::tuple<AgradCdfCauchy, type_ffv_74> AgradCdfCauchy_ffv_74;
+typedef std::tuple<AgradCdfCauchy, type_ffv_75> AgradCdfCauchy_ffv_75;
+typedef std::tuple<AgradCdfCauchy, type_ffv_76> AgradCdfCauchy_ffv_76;
+typedef std::tuple<AgradCdfCauchy, type_ffv_77> AgradCdfCauchy_ffv_77;
+typedef std::tuple<AgradCdfCauchy, type_ffv_78> AgradCdfCauchy_ffv_78;
+typedef std::tuple<AgradCdfCauchy, type_ffv_79> AgradCdfCauchy_ffv_79;
+typedef std::tuple<AgradCdfCauchy, type_ffv_80> AgradCdfCauchy_ffv_80;
+typedef std::tuple<AgradCdfCauchy, type_ffv_81> AgradCdfCauchy_ffv_81;
+typedef std::tuple<AgradCdfCauchy, type_ffv_82> AgradCdfCauchy_ffv_82;
+typedef std::tuple<AgradCdfCauchy, type_ffv_83> AgradCdfCauchy_ffv_83;
+typedef std::tuple<AgradCdfCauchy, type_ffv_84> AgradCdfCauchy_ffv_84;
+typedef std::tuple<AgradCdfCauchy, type_ffv_85> AgradCdfCauchy_ffv_85;
+typedef std::tuple<AgradCdfCauchy, type_ffv_86> AgradCdfCauchy_ffv_86;
+typedef std::tuple<AgradCdfCauchy, type_ffv_87> AgradCdfCauchy_ffv_87;
+typedef std::tuple<AgradCdfCauchy, type_ffv_88> AgradCdfCauchy_ffv_88;
+typedef std::tuple<AgradCdfCauchy, type_ffv_89> AgradCdfCauchy_ffv_89;
+typedef std::tuple<AgradCdfCauchy, type_ffv_90> AgradCdfCauchy_ffv_90;
+typedef std::tuple<AgradCdfCauchy, type_ffv_91> AgradCdfCauchy_ffv_91;
+typedef std::tuple<AgradCdfCauchy, type_ffv_92> AgradCdfCauchy_ffv_92;
+typedef std::tuple<AgradCdfCauchy, type_ffv_93> AgradCdfCauchy_ffv_93;
+typedef std::tuple<AgradCdfCauchy, type_ffv_94> AgradCdfCauchy_ffv_94;
+typedef std::tuple<AgradCdfCauchy, type_ffv_95> AgradCdfCauchy_ffv_95;
+typedef std::tuple<AgradCdfCauchy, type_ffv_96> AgradCdfCauchy_ffv_96;
+typedef std::tuple<AgradCdfCauchy, type_ffv_97> AgradCdfCauchy_ffv_97;
+typedef std::tuple<AgradCdfCauchy, type_ffv_98> AgradCdfCauchy_ffv_98;
+typedef std::tuple<AgradCdfCauchy, type_ffv_99> AgradCdfCauchy_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_0, AgradCdfTestFixture, AgradCdfCauchy_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_1, AgradCdfTestFixture, AgradCdfCauchy_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_2, AgradCdfTestFixture, AgradCdfCauchy_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_3, AgradCdfTestFixture, AgradCdfCauchy_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_4, AgradCdfTestFixture, AgradCdfCauchy_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_5, AgradCdfTestFixture, AgradCdfCauchy_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_6, AgradCdfTestFixture, AgradCdfCauchy_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_7, AgradCdfTestFixture, AgradCdfCauchy_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_8, AgradCdfTestFixture, AgradCdfCauchy_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_9, AgradCdfTestFixture, AgradCdfCauchy_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_10, AgradCdfTestFixture, AgradCdfCauchy_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_11, AgradCdfTestFixture, AgradCdfCauchy_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_12, AgradCdfTestFixture, AgradCdfCauchy_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_13, AgradCdfTestFixture, AgradCdfCauchy_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_14, AgradCdfTestFixture, AgradCdfCauchy_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_15, AgradCdfTestFixture, AgradCdfCauchy_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_16, AgradCdfTestFixture, AgradCdfCauchy_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_17, AgradCdfTestFixture, AgradCdfCauchy_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_18, AgradCdfTestFixture, AgradCdfCauchy_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_19, AgradCdfTestFixture, AgradCdfCauchy_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_20, AgradCdfTestFixture, AgradCdfCauchy_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_21, AgradCdfTestFixture, AgradCdfCauchy_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_22, AgradCdfTestFixture, AgradCdfCauchy_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_23, AgradCdfTestFixture, AgradCdfCauchy_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_24, AgradCdfTestFixture, AgradCdfCauchy_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_25, AgradCdfTestFixture, AgradCdfCauchy_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_26, AgradCdfTestFixture, AgradCdfCauchy_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_27, AgradCdfTestFixture, AgradCdfCauchy_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_28, AgradCdfTestFixture, AgradCdfCauchy_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_29, AgradCdfTestFixture, AgradCdfCauchy_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_30, AgradCdfTestFixture, AgradCdfCauchy_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_31, AgradCdfTestFixture, AgradCdfCauchy_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_32, AgradCdfTestFixture, AgradCdfCauchy_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_33, AgradCdfTestFixture, AgradCdfCauchy_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_34, AgradCdfTestFixture, AgradCdfCauchy_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_35, AgradCdfTestFixture, AgradCdfCauchy_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_36, AgradCdfTestFixture, AgradCdfCauchy_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_37, AgradCdfTestFixture, AgradCdfCauchy_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_38, AgradCdfTestFixture, AgradCdfCauchy_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_39, AgradCdfTestFixture, AgradCdfCauchy_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_40, AgradCdfTestFixture, AgradCdfCauchy_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_41, AgradCdfTestFixture, AgradCdfCauchy_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_42, AgradCdfTestFixture, AgradCdfCauchy_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_43, AgradCdfTestFixture, AgradCdfCauchy_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_44, AgradCdfTestFixture, AgradCdfCauchy_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_45, AgradCdfTestFixture, AgradCdfCauchy_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_46, AgradCdfTestFixture, AgradCdfCauchy_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_47, AgradCdfTestFixture, AgradCdfCauchy_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_48, AgradCdfTestFixture, AgradCdfCauchy_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_49, AgradCdfTestFixture, AgradCdfCauchy_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_50, AgradCdfTestFixture, AgradCdfCauchy_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_51, AgradCdfTestFixture, AgradCdfCauchy_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_52, AgradCdfTestFixture, AgradCdfCauchy_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_53, AgradCdfTestFixture, AgradCdfCauchy_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_54, AgradCdfTestFixture, AgradCdfCauchy_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_55, AgradCdfTestFixture, AgradCdfCauchy_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_56, AgradCdfTestFixture, AgradCdfCauchy_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_57, AgradCdfTestFixture, AgradCdfCauchy_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_58, AgradCdfTestFixture, AgradCdfCauchy_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_59, AgradCdfTestFixture, AgradCdfCauchy_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_60, AgradCdfTestFixture, AgradCdfCauchy_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_61, AgradCdfTestFixture, AgradCdfCauchy_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_62, AgradCdfTestFixture, AgradCdfCauchy_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_63, AgradCdfTestFixture, AgradCdfCauchy_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_64, AgradCdfTestFixture, AgradCdfCauchy_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_65, AgradCdfTestFixture, AgradCdfCauchy_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_66, AgradCdfTestFixture, AgradCdfCauchy_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_67, AgradCdfTestFixture, AgradCdfCauchy_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_68, AgradCdfTestFixture, AgradCdfCauchy_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_69, AgradCdfTestFixture, AgradCdfCauchy_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_70, AgradCdfTestFixture, AgradCdfCauchy_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_71, AgradCdfTestFixture, AgradCdfCauchy_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_72, AgradCdfTestFixture, AgradCdfCauchy_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_73, AgradCdfTestFixture, AgradCdfCauchy_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_74, AgradCdfTestFixture, AgradCdfCauchy_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_75, AgradCdfTestFixture, AgradCdfCauchy_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_76, AgradCdfTestFixture, AgradCdfCauchy_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_77, AgradCdfTestFixture, AgradCdfCauchy_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_78, AgradCdfTestFixture, AgradCdfCauchy_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_79, AgradCdfTestFixture, AgradCdfCauchy_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_80, AgradCdfTestFixture, AgradCdfCauchy_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_81, AgradCdfTestFixture, AgradCdfCauchy_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_82, AgradCdfTestFixture, AgradCdfCauchy_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_83, AgradCdfTestFixture, AgradCdfCauchy_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_84, AgradCdfTestFixture, AgradCdfCauchy_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_85, AgradCdfTestFixture, AgradCdfCauchy_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_86, AgradCdfTestFixture, AgradCdfCauchy_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_87, AgradCdfTestFixture, AgradCdfCauchy_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_88, AgradCdfTestFixture, AgradCdfCauchy_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_89, AgradCdfTestFixture, AgradCdfCauchy_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_90, AgradCdfTestFixture, AgradCdfCauchy_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_91, AgradCdfTestFixture, AgradCdfCauchy_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_92, AgradCdfTestFixture, AgradCdfCauchy_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_93, AgradCdfTestFixture, AgradCdfCauchy_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_94, AgradCdfTestFixture, AgradCdfCauchy_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_95, AgradCdfTestFixture, AgradCdfCauchy_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_96, AgradCdfTestFixture, AgradCdfCauchy_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_97, AgradCdfTestFixture, AgradCdfCauchy_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_98, AgradCdfTestFixture, AgradCdfCauchy_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_99, AgradCdfTestFixture, AgradCdfCauchy_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfCauchy, type_v_0> AgradCdfCauchy_v_0;
+typedef std::tuple<AgradCdfCauchy, type_v_1> AgradCdfCauchy_v_1;
+typedef std::tuple<AgradCdfCauchy, type_v_2> AgradCdfCauchy_v_2;
+typedef std::tuple<AgradCdfCauchy, type_v_3> AgradCdfCauchy_v_3;
+typedef std::tuple<AgradCdfCauchy, type_v_4> AgradCdfCauchy_v_4;
+typedef std::tuple<AgradCdfCauchy, type_v_5> AgradCdfCauchy_v_5;
+typedef std::tuple<AgradCdfCauchy, type_v_6> AgradCdfCauchy_v_6;
+typedef std::tuple<AgradCdfCauchy, type_v_7> AgradCdfCauchy_v_7;
+typedef std::tuple<AgradCdfCauchy, type_v_8> AgradCdfCauchy_v_8;
+typedef std::tuple<AgradCdfCauchy, type_v_9> AgradCdfCauchy_v_9;
+typedef std::tuple<AgradCdfCauchy, type_v_10> AgradCdfCauchy_v_10;
+typedef std::tuple<AgradCdfCauchy, type_v_11> AgradCdfCauchy_v_11;
+typedef std::tuple<AgradCdfCauchy, type_v_12> AgradCdfCauchy_v_12;
+typedef std::tuple<AgradCdfCauchy, type_v_13> AgradCdfCauchy_v_13;
+typedef std::tuple<AgradCdfCauchy, type_v_14> AgradCdfCauchy_v_14;
+typedef std::tuple<AgradCdfCauchy, type_v_15> AgradCdfCauchy_v_15;
+typedef std::tuple<AgradCdfCauchy, type_v_16> AgradCdfCauchy_v_16;
+typedef std::tuple<AgradCdfCauchy, type_v_17> AgradCdfCauchy_v_17;
+typedef std::tuple<AgradCdfCauchy, type_v_18> AgradCdfCauchy_v_18;
+typedef std::tuple<AgradCdfCauchy, type_v_19> AgradCdfCauchy_v_19;
+typedef std::tuple<AgradCdfCauchy, type_v_20> AgradCdfCauchy_v_20;
+typedef std::tuple<AgradCdfCauchy, type_v_21> AgradCdfCauchy_v_21;
+typedef std::tuple<AgradCdfCauchy, type_v_22> AgradCdfCauchy_v_22;
+typedef std::tuple<AgradCdfCauchy, type_v_23> AgradCdfCauchy_v_23;
+typedef std::tuple<AgradCdfCauchy, type_v_24> AgradCdfCauchy_v_24;
+typedef std::tuple<AgradCdfCauchy, type_v_25> AgradCdfCauchy_v_25;
+typedef std::tuple<AgradCdfCauchy, type_v_26> AgradCdfCauchy_v_26;
+typedef std::tuple<AgradCdfCauchy, type_v_27> AgradCdfCauchy_v_27;
+typedef std::tuple<AgradCdfCauchy, type_v_28> AgradCdfCauchy_v_28;
+typedef std::tuple<AgradCdfCauchy, type_v_29> AgradCdfCauchy_v_29;
+typedef std::tuple<AgradCdfCauchy, type_v_30> AgradCdfCauchy_v_30;
+typedef std::tuple<AgradCdfCauchy, type_v_31> AgradCdfCauchy_v_31;
+typedef std::tuple<AgradCdfCauchy, type_v_32> AgradCdfCauchy_v_32;
+typedef std::tuple<AgradCdfCauchy, type_v_33> AgradCdfCauchy_v_33;
+typedef std::tuple<AgradCdfCauchy, type_v_34> AgradCdfCauchy_v_34;
+typedef std::tuple<AgradCdfCauchy, type_v_35> AgradCdfCauchy_v_35;
+typedef std::tuple<AgradCdfCauchy, type_v_36> AgradCdfCauchy_v_36;
+typedef std::tuple<AgradCdfCauchy, type_v_37> AgradCdfCauchy_v_37;
+typedef std::tuple<AgradCdfCauchy, type_v_38> AgradCdfCauchy_v_38;
+typedef std::tuple<AgradCdfCauchy, type_v_39> AgradCdfCauchy_v_39;
+typedef std::tuple<AgradCdfCauchy, type_v_40> AgradCdfCauchy_v_40;
+typedef std::tuple<AgradCdfCauchy, type_v_41> AgradCdfCauchy_v_41;
+typedef std::tuple<AgradCdfCauchy, type_v_42> AgradCdfCauchy_v_42;
+typedef std::tuple<AgradCdfCauchy, type_v_43> AgradCdfCauchy_v_43;
+typedef std::tuple<AgradCdfCauchy, type_v_44> AgradCdfCauchy_v_44;
+typedef std::tuple<AgradCdfCauchy, type_v_45> AgradCdfCauchy_v_45;
+typedef std::tuple<AgradCdfCauchy, type_v_46> AgradCdfCauchy_v_46;
+typedef std::tuple<AgradCdfCauchy, type_v_47> AgradCdfCauchy_v_47;
+typedef std::tuple<AgradCdfCauchy, type_v_48> AgradCdfCauchy_v_48;
+typedef std::tuple<AgradCdfCauchy, type_v_49> AgradCdfCauchy_v_49;
+typedef std::tuple<AgradCdfCauchy, type_v_50> AgradCdfCauchy_v_50;
+typedef std::tuple<AgradCdfCauchy, type_v_51> AgradCdfCauchy_v_51;
+typedef std::tuple<AgradCdfCauchy, type_v_52> AgradCdfCauchy_v_52;
+typedef std::tuple<AgradCdfCauchy, type_v_53> AgradCdfCauchy_v_53;
+typedef std::tuple<AgradCdfCauchy, type_v_54> AgradCdfCauchy_v_54;
+typedef std::tuple<AgradCdfCauchy, type_v_55> AgradCdfCauchy_v_55;
+typedef std::tuple<AgradCdfCauchy, type_v_56> AgradCdfCauchy_v_56;
+typedef std::tuple<AgradCdfCauchy, type_v_57> AgradCdfCauchy_v_57;
+typedef std::tuple<AgradCdfCauchy, type_v_58> AgradCdfCauchy_v_58;
+typedef std::tuple<AgradCdfCauchy, type_v_59> AgradCdfCauchy_v_59;
+typedef std::tuple<AgradCdfCauchy, type_v_60> AgradCdfCauchy_v_60;
+typedef std::tuple<AgradCdfCauchy, type_v_61> AgradCdfCauchy_v_61;
+typedef std::tuple<AgradCdfCauchy, type_v_62> AgradCdfCauchy_v_62;
+typedef std::tuple<AgradCdfCauchy, type_v_63> AgradCdfCauchy_v_63;
+typedef std::tuple<AgradCdfCauchy, type_v_64> AgradCdfCauchy_v_64;
+typedef std::tuple<AgradCdfCauchy, type_v_65> AgradCdfCauchy_v_65;
+typedef std::tuple<AgradCdfCauchy, type_v_66> AgradCdfCauchy_v_66;
+typedef std::tuple<AgradCdfCauchy, type_v_67> AgradCdfCauchy_v_67;
+typedef std::tuple<AgradCdfCauchy, type_v_68> AgradCdfCauchy_v_68;
+typedef std::tuple<AgradCdfCauchy, type_v_69> AgradCdfCauchy_v_69;
+typedef std::tuple<AgradCdfCauchy, type_v_70> AgradCdfCauchy_v_70;
+typedef std::tuple<AgradCdfCauchy, type_v_71> AgradCdfCauchy_v_71;
+typedef std::tuple<AgradCdfCauchy, type_v_72> AgradCdfCauchy_v_72;
+typedef std::tuple<AgradCdfCauchy, type_v_73> AgradCdfCauchy_v_73;
+typedef std::tuple<AgradCdfCauchy, type_v_74> AgradCdfCauchy_v_74;
+typedef std::tuple<AgradCdfCauchy, type_v_75> AgradCdfCauchy_v_75;
+typedef std::tuple<AgradCdfCauchy, type_v_76> AgradCdfCauchy_v_76;
+typedef std::tuple<AgradCdfCauchy, type_v_77> AgradCdfCauchy_v_77;
+typedef std::tuple<AgradCdfCauchy, type_v_78> AgradCdfCauchy_v_78;
+typedef std::tuple<AgradCdfCauchy, type_v_79> AgradCdfCauchy_v_79;
+typedef std::tuple<AgradCdfCauchy, type_v_80> AgradCdfCauchy_v_80;
+typedef std::tuple<AgradCdfCauchy, type_v_81> AgradCdfCauchy_v_81;
+typedef std::tuple<AgradCdfCauchy, type_v_82> AgradCdfCauchy_v_82;
+typedef std::tuple<AgradCdfCauchy, type_v_83> AgradCdfCauchy_v_83;
+typedef std::tuple<AgradCdfCauchy, type_v_84> AgradCdfCauchy_v_84;
+typedef std::tuple<AgradCdfCauchy, type_v_85> AgradCdfCauchy_v_85;
+typedef std::tuple<AgradCdfCauchy, type_v_86> AgradCdfCauchy_v_86;
+typedef std::tuple<AgradCdfCauchy, type_v_87> AgradCdfCauchy_v_87;
+typedef std::tuple<AgradCdfCauchy, type_v_88> AgradCdfCauchy_v_88;
+typedef std::tuple<AgradCdfCauchy, type_v_89> AgradCdfCauchy_v_89;
+typedef std::tuple<AgradCdfCauchy, type_v_90> AgradCdfCauchy_v_90;
+typedef std::tuple<AgradCdfCauchy, type_v_91> AgradCdfCauchy_v_91;
+typedef std::tuple<AgradCdfCauchy, type_v_92> AgradCdfCauchy_v_92;
+typedef std::tuple<AgradCdfCauchy, type_v_93> AgradCdfCauchy_v_93;
+typedef std::tuple<AgradCdfCauchy, type_v_94> AgradCdfCauchy_v_94;
+typedef std::tuple<AgradCdfCauchy, type_v_95> AgradCdfCauchy_v_95;
+typedef std::tuple<AgradCdfCauchy, type_v_96> AgradCdfCauchy_v_96;
+typedef std::tuple<AgradCdfCauchy, type_v_97> AgradCdfCauchy_v_97;
+typedef std::tuple<AgradCdfCauchy, type_v_98> AgradCdfCauchy_v_98;
+typedef std::tuple<AgradCdfCauchy, type_v_99> AgradCdfCauchy_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_0, AgradCdfTestFixture, AgradCdfCauchy_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_1, AgradCdfTestFixture, AgradCdfCauchy_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_2, AgradCdfTestFixture, AgradCdfCauchy_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_3, AgradCdfTestFixture, AgradCdfCauchy_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_4, AgradCdfTestFixture, AgradCdfCauchy_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_5, AgradCdfTestFixture, AgradCdfCauchy_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_6, AgradCdfTestFixture, AgradCdfCauchy_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_7, AgradCdfTestFixture, AgradCdfCauchy_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_8, AgradCdfTestFixture, AgradCdfCauchy_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_9, AgradCdfTestFixture, AgradCdfCauchy_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_10, AgradCdfTestFixture, AgradCdfCauchy_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_11, AgradCdfTestFixture, AgradCdfCauchy_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_12, AgradCdfTestFixture, AgradCdfCauchy_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_13, AgradCdfTestFixture, AgradCdfCauchy_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_14, AgradCdfTestFixture, AgradCdfCauchy_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_15, AgradCdfTestFixture, AgradCdfCauchy_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_16, AgradCdfTestFixture, AgradCdfCauchy_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_17, AgradCdfTestFixture, AgradCdfCauchy_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_18, AgradCdfTestFixture, AgradCdfCauchy_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_19, AgradCdfTestFixture, AgradCdfCauchy_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_20, AgradCdfTestFixture, AgradCdfCauchy_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_21, AgradCdfTestFixture, AgradCdfCauchy_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_22, AgradCdfTestFixture, AgradCdfCauchy_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_23, AgradCdfTestFixture, AgradCdfCauchy_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_24, AgradCdfTestFixture, AgradCdfCauchy_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_25, AgradCdfTestFixture, AgradCdfCauchy_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_26, AgradCdfTestFixture, AgradCdfCauchy_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_27, AgradCdfTestFixture, AgradCdfCauchy_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_28, AgradCdfTestFixture, AgradCdfCauchy_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_29, AgradCdfTestFixture, AgradCdfCauchy_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_30, AgradCdfTestFixture, AgradCdfCauchy_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_31, AgradCdfTestFixture, AgradCdfCauchy_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_32, AgradCdfTestFixture, AgradCdfCauchy_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_33, AgradCdfTestFixture, AgradCdfCauchy_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_34, AgradCdfTestFixture, AgradCdfCauchy_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_35, AgradCdfTestFixture, AgradCdfCauchy_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_36, AgradCdfTestFixture, AgradCdfCauchy_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_37, AgradCdfTestFixture, AgradCdfCauchy_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_38, AgradCdfTestFixture, AgradCdfCauchy_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_39, AgradCdfTestFixture, AgradCdfCauchy_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_40, AgradCdfTestFixture, AgradCdfCauchy_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_41, AgradCdfTestFixture, AgradCdfCauchy_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_42, AgradCdfTestFixture, AgradCdfCauchy_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_43, AgradCdfTestFixture, AgradCdfCauchy_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_44, AgradCdfTestFixture, AgradCdfCauchy_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_45, AgradCdfTestFixture, AgradCdfCauchy_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_46, AgradCdfTestFixture, AgradCdfCauchy_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_47, AgradCdfTestFixture, AgradCdfCauchy_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_48, AgradCdfTestFixture, AgradCdfCauchy_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_49, AgradCdfTestFixture, AgradCdfCauchy_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_50, AgradCdfTestFixture, AgradCdfCauchy_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_51, AgradCdfTestFixture, AgradCdfCauchy_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_52, AgradCdfTestFixture, AgradCdfCauchy_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_53, AgradCdfTestFixture, AgradCdfCauchy_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_54, AgradCdfTestFixture, AgradCdfCauchy_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_55, AgradCdfTestFixture, AgradCdfCauchy_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_56, AgradCdfTestFixture, AgradCdfCauchy_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_57, AgradCdfTestFixture, AgradCdfCauchy_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_58, AgradCdfTestFixture, AgradCdfCauchy_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_59, AgradCdfTestFixture, AgradCdfCauchy_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_60, AgradCdfTestFixture, AgradCdfCauchy_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_61, AgradCdfTestFixture, AgradCdfCauchy_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_62, AgradCdfTestFixture, AgradCdfCauchy_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_63, AgradCdfTestFixture, AgradCdfCauchy_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_64, AgradCdfTestFixture, AgradCdfCauchy_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_65, AgradCdfTestFixture, AgradCdfCauchy_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_66, AgradCdfTestFixture, AgradCdfCauchy_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_67, AgradCdfTestFixture, AgradCdfCauchy_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_68, AgradCdfTestFixture, AgradCdfCauchy_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_69, AgradCdfTestFixture, AgradCdfCauchy_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_70, AgradCdfTestFixture, AgradCdfCauchy_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_71, AgradCdfTestFixture, AgradCdfCauchy_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_72, AgradCdfTestFixture, AgradCdfCauchy_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_73, AgradCdfTestFixture, AgradCdfCauchy_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_74, AgradCdfTestFixture, AgradCdfCauchy_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_75, AgradCdfTestFixture, AgradCdfCauchy_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_76, AgradCdfTestFixture, AgradCdfCauchy_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_77, AgradCdfTestFixture, AgradCdfCauchy_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_78, AgradCdfTestFixture, AgradCdfCauchy_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_79, AgradCdfTestFixture, AgradCdfCauchy_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_80, AgradCdfTestFixture, AgradCdfCauchy_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_81, AgradCdfTestFixture, AgradCdfCauchy_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_82, AgradCdfTestFixture, AgradCdfCauchy_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_83, AgradCdfTestFixture, AgradCdfCauchy_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_84, AgradCdfTestFixture, AgradCdfCauchy_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_85, AgradCdfTestFixture, AgradCdfCauchy_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_86, AgradCdfTestFixture, AgradCdfCauchy_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_87, AgradCdfTestFixture, AgradCdfCauchy_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_88, AgradCdfTestFixture, AgradCdfCauchy_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_89, AgradCdfTestFixture, AgradCdfCauchy_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_90, AgradCdfTestFixture, AgradCdfCauchy_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_91, AgradCdfTestFixture, AgradCdfCauchy_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_92, AgradCdfTestFixture, AgradCdfCauchy_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_93, AgradCdfTestFixture, AgradCdfCauchy_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_94, AgradCdfTestFixture, AgradCdfCauchy_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_95, AgradCdfTestFixture, AgradCdfCauchy_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_96, AgradCdfTestFixture, AgradCdfCauchy_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_97, AgradCdfTestFixture, AgradCdfCauchy_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_98, AgradCdfTestFixture, AgradCdfCauchy_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_99, AgradCdfTestFixture, AgradCdfCauchy_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfCauchy, type_vv_0> AgradCdfCauchy_vv_0;
+typedef std::tuple<AgradCdfCauchy, type_vv_1> AgradCdfCauchy_vv_1;
+typedef std::tuple<AgradCdfCauchy, type_vv_2> AgradCdfCauchy_vv_2;
+typedef std::tuple<AgradCdfCauchy, type_vv_3> AgradCdfCauchy_vv_3;
+typedef std::tuple<AgradCdfCauchy, type_vv_4> AgradCdfCauchy_vv_4;
+typedef std::tuple<AgradCdfCauchy, type_vv_5> AgradCdfCauchy_vv_5;
+typedef std::tuple<AgradCdfCauchy, type_vv_6> AgradCdfCauchy_vv_6;
+typedef std::tuple<AgradCdfCauchy, type_vv_7> AgradCdfCauchy_vv_7;
+typedef std::tuple<AgradCdfCauchy, type_vv_8> AgradCdfCauchy_vv_8;
+typedef std::tuple<AgradCdfCauchy, type_vv_9> AgradCdfCauchy_vv_9;
+typedef std::tuple<AgradCdfCauchy, type_vv_10> AgradCdfCauchy_vv_10;
+typedef std::tuple<AgradCdfCauchy, type_vv_11> AgradCdfCauchy_vv_11;
+typedef std::tuple<AgradCdfCauchy, type_vv_12> AgradCdfCauchy_vv_12;
+typedef std::tuple<AgradCdfCauchy, type_vv_13> AgradCdfCauchy_vv_13;
+typedef std::tuple<AgradCdfCauchy, type_vv_14> AgradCdfCauchy_vv_14;
+typedef std::tuple<AgradCdfCauchy, type_vv_15> AgradCdfCauchy_vv_15;
+typedef std::tuple<AgradCdfCauchy, type_vv_16> AgradCdfCauchy_vv_16;
+typedef std::tuple<AgradCdfCauchy, type_vv_17> AgradCdfCauchy_vv_17;
+typedef std::tuple<AgradCdfCauchy, type_vv_18> AgradCdfCauchy_vv_18;
+typedef std::tuple<AgradCdfCauchy, type_vv_19> AgradCdfCauchy_vv_19;
+typedef std::tuple<AgradCdfCauchy, type_vv_20> AgradCdfCauchy_vv_20;
+typedef std::tuple<AgradCdfCauchy, type_vv_21> AgradCdfCauchy_vv_21;
+typedef std::tuple<AgradCdfCauchy, type_vv_22> AgradCdfCauchy_vv_22;
+typedef std::tuple<AgradCdfCauchy, type_vv_23> AgradCdfCauchy_vv_23;
+typedef std::tuple<AgradCdfCauchy, type_vv_24> AgradCdfCauchy_vv_24;
+typedef std::tuple<AgradCdfCauchy, type_vv_25> AgradCdfCauchy_vv_25;
+typedef std::tuple<AgradCdfCauchy, type_vv_26> AgradCdfCauchy_vv_26;
+typedef std::tuple<AgradCdfCauchy, type_vv_27> AgradCdfCauchy_vv_27;
+typedef std::tuple<AgradCdfCauchy, type_vv_28> AgradCdfCauchy_vv_28;
+typedef std::tuple<AgradCdfCauchy, type_vv_29> AgradCdfCauchy_vv_29;
+typedef std::tuple<AgradCdfCauchy, type_vv_30> AgradCdfCauchy_vv_30;
+typedef std::tuple<AgradCdfCauchy, type_vv_31> AgradCdfCauchy_vv_31;
+typedef std::tuple<AgradCdfCauchy, type_vv_32> AgradCdfCauchy_vv_32;
+typedef std::tuple<AgradCdfCauchy, type_vv_33> AgradCdfCauchy_vv_33;
+typedef std::tuple<AgradCdfCauchy, type_vv_34> AgradCdfCauchy_vv_34;
+typedef std::tuple<AgradCdfCauchy, type_vv_35> AgradCdfCauchy_vv_35;
+typedef std::tuple<AgradCdfCauchy, type_vv_36> AgradCdfCauchy_vv_36;
+typedef std::tuple<AgradCdfCauchy, type_vv_37> AgradCdfCauchy_vv_37;
+typedef std::tuple<AgradCdfCauchy, type_vv_38> AgradCdfCauchy_vv_38;
+typedef std::tuple<AgradCdfCauchy, type_vv_39> AgradCdfCauchy_vv_39;
+typedef std::tuple<AgradCdfCauchy, type_vv_40> AgradCdfCauchy_vv_40;
+typedef std::tuple<AgradCdfCauchy, type_vv_41> AgradCdfCauchy_vv_41;
+typedef std::tuple<AgradCdfCauchy, type_vv_42> AgradCdfCauchy_vv_42;
+typedef std::tuple<AgradCdfCauchy, type_vv_43> AgradCdfCauchy_vv_43;
+typedef std::tuple<AgradCdfCauchy, type_vv_44> AgradCdfCauchy_vv_44;
+typedef std::tuple<AgradCdfCauchy, type_vv_45> AgradCdfCauchy_vv_45;
+typedef std::tuple<AgradCdfCauchy, type_vv_46> AgradCdfCauchy_vv_46;
+typedef std::tuple<AgradCdfCauchy, type_vv_47> AgradCdfCauchy_vv_47;
+typedef std::tuple<AgradCdfCauchy, type_vv_48> AgradCdfCauchy_vv_48;
+typedef std::tuple<AgradCdfCauchy, type_vv_49> AgradCdfCauchy_vv_49;
+typedef std::tuple<AgradCdfCauchy, type_vv_50> AgradCdfCauchy_vv_50;
+typedef std::tuple<AgradCdfCauchy, type_vv_51> AgradCdfCauchy_vv_51;
+typedef std::tuple<AgradCdfCauchy, type_vv_52> AgradCdfCauchy_vv_52;
+typedef std::tuple<AgradCdfCauchy, type_vv_53> AgradCdfCauchy_vv_53;
+typedef std::tuple<AgradCdfCauchy, type_vv_54> AgradCdfCauchy_vv_54;
+typedef std::tuple<AgradCdfCauchy, type_vv_55> AgradCdfCauchy_vv_55;
+typedef std::tuple<AgradCdfCauchy, type_vv_56> AgradCdfCauchy_vv_56;
+typedef std::tuple<AgradCdfCauchy, type_vv_57> AgradCdfCauchy_vv_57;
+typedef std::tuple<AgradCdfCauchy, type_vv_58> AgradCdfCauchy_vv_58;
+typedef std::tuple<AgradCdfCauchy, type_vv_59> AgradCdfCauchy_vv_59;
+typedef std::tuple<AgradCdfCauchy, type_vv_60> AgradCdfCauchy_vv_60;
+typedef std::tuple<AgradCdfCauchy, type_vv_61> AgradCdfCauchy_vv_61;
+typedef std::tuple<AgradCdfCauchy, type_vv_62> AgradCdfCauchy_vv_62;
+typedef std::tuple<AgradCdfCauchy, type_vv_63> AgradCdfCauchy_vv_63;
+typedef std::tuple<AgradCdfCauchy, type_vv_64> AgradCdfCauchy_vv_64;
+typedef std::tuple<AgradCdfCauchy, type_vv_65> AgradCdfCauchy_vv_65;
+typedef std::tuple<AgradCdfCauchy, type_vv_66> AgradCdfCauchy_vv_66;
+typedef std::tuple<AgradCdfCauchy, type_vv_67> AgradCdfCauchy_vv_67;
+typedef std::tuple<AgradCdfCauchy, type_vv_68> AgradCdfCauchy_vv_68;
+typedef std::tuple<AgradCdfCauchy, type_vv_69> AgradCdfCauchy_vv_69;
+typedef std::tuple<AgradCdfCauchy, type_vv_70> AgradCdfCauchy_vv_70;
+typedef std::tuple<AgradCdfCauchy, type_vv_71> AgradCdfCauchy_vv_71;
+typedef std::tuple<AgradCdfCauchy, type_vv_72> AgradCdfCauchy_vv_72;
+typedef std::tuple<AgradCdfCauchy, type_vv_73> AgradCdfCauchy_vv_73;
+typedef std::tuple<AgradCdfCauchy, type_vv_74> AgradCdfCauchy_vv_74;
+typedef std::tuple<AgradCdfCauchy, type_vv_75> AgradCdfCauchy_vv_75;
+typedef std::tuple<AgradCdfCauchy, type_vv_76> AgradCdfCauchy_vv_76;
+typedef std::tuple<AgradCdfCauchy, type_vv_77> AgradCdfCauchy_vv_77;
+typedef std::tuple<AgradCdfCauchy, type_vv_78> AgradCdfCauchy_vv_78;
+typedef std::tuple<AgradCdfCauchy, type_vv_79> AgradCdfCauchy_vv_79;
+typedef std::tuple<AgradCdfCauchy, type_vv_80> AgradCdfCauchy_vv_80;
+typedef std::tuple<AgradCdfCauchy, type_vv_81> AgradCdfCauchy_vv_81;
+typedef std::tuple<AgradCdfCauchy, type_vv_82> AgradCdfCauchy_vv_82;
+typedef std::tuple<AgradCdfCauchy, type_vv_83> AgradCdfCauchy_vv_83;
+typedef std::tuple<AgradCdfCauchy, type_vv_84> AgradCdfCauchy_vv_84;
+typedef std::tuple<AgradCdfCauchy, type_vv_85> AgradCdfCauchy_vv_85;
+typedef std::tuple<AgradCdfCauchy, type_vv_86> AgradCdfCauchy_vv_86;
+typedef std::tuple<AgradCdfCauchy, type_vv_87> AgradCdfCauchy_vv_87;
+typedef std::tuple<AgradCdfCauchy, type_vv_88> AgradCdfCauchy_vv_88;
+typedef std::tuple<AgradCdfCauchy, type_vv_89> AgradCdfCauchy_vv_89;
+typedef std::tuple<AgradCdfCauchy, type_vv_90> AgradCdfCauchy_vv_90;
+typedef std::tuple<AgradCdfCauchy, type_vv_91> AgradCdfCauchy_vv_91;
+typedef std::tuple<AgradCdfCauchy, type_vv_92> AgradCdfCauchy_vv_92;
+typedef std::tuple<AgradCdfCauchy, type_vv_93> AgradCdfCauchy_vv_93;
+typedef std::tuple<AgradCdfCauchy, type_vv_94> AgradCdfCauchy_vv_94;
+typedef std::tuple<AgradCdfCauchy, type_vv_95> AgradCdfCauchy_vv_95;
+typedef std::tuple<AgradCdfCauchy, type_vv_96> AgradCdfCauchy_vv_96;
+typedef std::tuple<AgradCdfCauchy, type_vv_97> AgradCdfCauchy_vv_97;
+typedef std::tuple<AgradCdfCauchy, type_vv_98> AgradCdfCauchy_vv_98;
+typedef std::tuple<AgradCdfCauchy, type_vv_99> AgradCdfCauchy_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_0, AgradCdfTestFixture, AgradCdfCauchy_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_1, AgradCdfTestFixture, AgradCdfCauchy_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_2, AgradCdfTestFixture, AgradCdfCauchy_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_3, AgradCdfTestFixture, AgradCdfCauchy_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_4, AgradCdfTestFixture, AgradCdfCauchy_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_5, AgradCdfTestFixture, AgradCdfCauchy_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_6, AgradCdfTestFixture, AgradCdfCauchy_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_7, AgradCdfTestFixture, AgradCdfCauchy_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_8, AgradCdfTestFixture, AgradCdfCauchy_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_9, AgradCdfTestFixture, AgradCdfCauchy_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_10, AgradCdfTestFixture, AgradCdfCauchy_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_11, AgradCdfTestFixture, AgradCdfCauchy_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_12, AgradCdfTestFixture, AgradCdfCauchy_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_13, AgradCdfTestFixture, AgradCdfCauchy_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_14, AgradCdfTestFixture, AgradCdfCauchy_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_15, AgradCdfTestFixture, AgradCdfCauchy_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_16, AgradCdfTestFixture, AgradCdfCauchy_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_17, AgradCdfTestFixture, AgradCdfCauchy_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_18, AgradCdfTestFixture, AgradCdfCauchy_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_19, AgradCdfTestFixture, AgradCdfCauchy_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_20, AgradCdfTestFixture, AgradCdfCauchy_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_21, AgradCdfTestFixture, AgradCdfCauchy_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_22, AgradCdfTestFixture, AgradCdfCauchy_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_23, AgradCdfTestFixture, AgradCdfCauchy_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_24, AgradCdfTestFixture, AgradCdfCauchy_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_25, AgradCdfTestFixture, AgradCdfCauchy_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_26, AgradCdfTestFixture, AgradCdfCauchy_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_27, AgradCdfTestFixture, AgradCdfCauchy_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_28, AgradCdfTestFixture, AgradCdfCauchy_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_29, AgradCdfTestFixture, AgradCdfCauchy_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_30, AgradCdfTestFixture, AgradCdfCauchy_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_31, AgradCdfTestFixture, AgradCdfCauchy_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_32, AgradCdfTestFixture, AgradCdfCauchy_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_33, AgradCdfTestFixture, AgradCdfCauchy_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_34, AgradCdfTestFixture, AgradCdfCauchy_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_35, AgradCdfTestFixture, AgradCdfCauchy_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_36, AgradCdfTestFixture, AgradCdfCauchy_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_37, AgradCdfTestFixture, AgradCdfCauchy_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_38, AgradCdfTestFixture, AgradCdfCauchy_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_39, AgradCdfTestFixture, AgradCdfCauchy_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_40, AgradCdfTestFixture, AgradCdfCauchy_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_41, AgradCdfTestFixture, AgradCdfCauchy_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_42, AgradCdfTestFixture, AgradCdfCauchy_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_43, AgradCdfTestFixture, AgradCdfCauchy_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_44, AgradCdfTestFixture, AgradCdfCauchy_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_45, AgradCdfTestFixture, AgradCdfCauchy_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_46, AgradCdfTestFixture, AgradCdfCauchy_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_47, AgradCdfTestFixture, AgradCdfCauchy_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_48, AgradCdfTestFixture, AgradCdfCauchy_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_49, AgradCdfTestFixture, AgradCdfCauchy_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_50, AgradCdfTestFixture, AgradCdfCauchy_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_51, AgradCdfTestFixture, AgradCdfCauchy_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_52, AgradCdfTestFixture, AgradCdfCauchy_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_53, AgradCdfTestFixture, AgradCdfCauchy_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_54, AgradCdfTestFixture, AgradCdfCauchy_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_55, AgradCdfTestFixture, AgradCdfCauchy_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_56, AgradCdfTestFixture, AgradCdfCauchy_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_57, AgradCdfTestFixture, AgradCdfCauchy_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_58, AgradCdfTestFixture, AgradCdfCauchy_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_59, AgradCdfTestFixture, AgradCdfCauchy_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_60, AgradCdfTestFixture, AgradCdfCauchy_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_61, AgradCdfTestFixture, AgradCdfCauchy_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_62, AgradCdfTestFixture, AgradCdfCauchy_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_63, AgradCdfTestFixture, AgradCdfCauchy_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_64, AgradCdfTestFixture, AgradCdfCauchy_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_65, AgradCdfTestFixture, AgradCdfCauchy_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_66, AgradCdfTestFixture, AgradCdfCauchy_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_67, AgradCdfTestFixture, AgradCdfCauchy_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_68, AgradCdfTestFixture, AgradCdfCauchy_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_69, AgradCdfTestFixture, AgradCdfCauchy_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_70, AgradCdfTestFixture, AgradCdfCauchy_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_71, AgradCdfTestFixture, AgradCdfCauchy_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_72, AgradCdfTestFixture, AgradCdfCauchy_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_73, AgradCdfTestFixture, AgradCdfCauchy_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_74, AgradCdfTestFixture, AgradCdfCauchy_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_75, AgradCdfTestFixture, AgradCdfCauchy_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_76, AgradCdfTestFixture, AgradCdfCauchy_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_77, AgradCdfTestFixture, AgradCdfCauchy_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_78, AgradCdfTestFixture, AgradCdfCauchy_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_79, AgradCdfTestFixture, AgradCdfCauchy_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_80, AgradCdfTestFixture, AgradCdfCauchy_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_81, AgradCdfTestFixture, AgradCdfCauchy_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_82, AgradCdfTestFixture, AgradCdfCauchy_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_83, AgradCdfTestFixture, AgradCdfCauchy_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_84, AgradCdfTestFixture, AgradCdfCauchy_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_85, AgradCdfTestFixture, AgradCdfCauchy_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_86, AgradCdfTestFixture, AgradCdfCauchy_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_87, AgradCdfTestFixture, AgradCdfCauchy_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_88, AgradCdfTestFixture, AgradCdfCauchy_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_89, AgradCdfTestFixture, AgradCdfCauchy_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_90, AgradCdfTestFixture, AgradCdfCauchy_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_91, AgradCdfTestFixture, AgradCdfCauchy_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_92, AgradCdfTestFixture, AgradCdfCauchy_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_93, AgradCdfTestFixture, AgradCdfCauchy_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_94, AgradCdfTestFixture, AgradCdfCauchy_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_95, AgradCdfTestFixture, AgradCdfCauchy_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_96, AgradCdfTestFixture, AgradCdfCauchy_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_97, AgradCdfTestFixture, AgradCdfCauchy_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_98, AgradCdfTestFixture, AgradCdfCauchy_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_99, AgradCdfTestFixture, AgradCdfCauchy_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfCauchy, type_ffv_100> AgradCdfCauchy_ffv_100;
+typedef std::tuple<AgradCdfCauchy, type_ffv_101> AgradCdfCauchy_ffv_101;
+typedef std::tuple<AgradCdfCauchy, type_ffv_102> AgradCdfCauchy_ffv_102;
+typedef std::tuple<AgradCdfCauchy, type_ffv_103> AgradCdfCauchy_ffv_103;
+typedef std::tuple<AgradCdfCauchy, type_ffv_104> AgradCdfCauchy_ffv_104;
+typedef std::tuple<AgradCdfCauchy, type_ffv_105> AgradCdfCauchy_ffv_105;
+typedef std::tuple<AgradCdfCauchy, type_ffv_106> AgradCdfCauchy_ffv_106;
+typedef std::tuple<AgradCdfCauchy, type_ffv_107> AgradCdfCauchy_ffv_107;
+typedef std::tuple<AgradCdfCauchy, type_ffv_108> AgradCdfCauchy_ffv_108;
+typedef std::tuple<AgradCdfCauchy, type_ffv_109> AgradCdfCauchy_ffv_109;
+typedef std::tuple<AgradCdfCauchy, type_ffv_110> AgradCdfCauchy_ffv_110;
+typedef std::tuple<AgradCdfCauchy, type_ffv_111> AgradCdfCauchy_ffv_111;
+typedef std::tuple<AgradCdfCauchy, type_ffv_112> AgradCdfCauchy_ffv_112;
+typedef std::tuple<AgradCdfCauchy, type_ffv_113> AgradCdfCauchy_ffv_113;
+typedef std::tuple<AgradCdfCauchy, type_ffv_114> AgradCdfCauchy_ffv_114;
+typedef std::tuple<AgradCdfCauchy, type_ffv_115> AgradCdfCauchy_ffv_115;
+typedef std::tuple<AgradCdfCauchy, type_ffv_116> AgradCdfCauchy_ffv_116;
+typedef std::tuple<AgradCdfCauchy, type_ffv_117> AgradCdfCauchy_ffv_117;
+typedef std::tuple<AgradCdfCauchy, type_ffv_118> AgradCdfCauchy_ffv_118;
+typedef std::tuple<AgradCdfCauchy, type_ffv_119> AgradCdfCauchy_ffv_119;
+typedef std::tuple<AgradCdfCauchy, type_ffv_120> AgradCdfCauchy_ffv_120;
+typedef std::tuple<AgradCdfCauchy, type_ffv_121> AgradCdfCauchy_ffv_121;
+typedef std::tuple<AgradCdfCauchy, type_ffv_122> AgradCdfCauchy_ffv_122;
+typedef std::tuple<AgradCdfCauchy, type_ffv_123> AgradCdfCauchy_ffv_123;
+typedef std::tuple<AgradCdfCauchy, type_ffv_124> AgradCdfCauchy_ffv_124;
+typedef std::tuple<AgradCdfCauchy, type_ffv_125> AgradCdfCauchy_ffv_125;
+typedef std::tuple<AgradCdfCauchy, type_ffv_126> AgradCdfCauchy_ffv_126;
+typedef std::tuple<AgradCdfCauchy, type_ffv_127> AgradCdfCauchy_ffv_127;
+typedef std::tuple<AgradCdfCauchy, type_ffv_128> AgradCdfCauchy_ffv_128;
+typedef std::tuple<AgradCdfCauchy, type_ffv_129> AgradCdfCauchy_ffv_129;
+typedef std::tuple<AgradCdfCauchy, type_ffv_130> AgradCdfCauchy_ffv_130;
+typedef std::tuple<AgradCdfCauchy, type_ffv_131> AgradCdfCauchy_ffv_131;
+typedef std::tuple<AgradCdfCauchy, type_ffv_132> AgradCdfCauchy_ffv_132;
+typedef std::tuple<AgradCdfCauchy, type_ffv_133> AgradCdfCauchy_ffv_133;
+typedef std::tuple<AgradCdfCauchy, type_ffv_134> AgradCdfCauchy_ffv_134;
+typedef std::tuple<AgradCdfCauchy, type_ffv_135> AgradCdfCauchy_ffv_135;
+typedef std::tuple<AgradCdfCauchy, type_ffv_136> AgradCdfCauchy_ffv_136;
+typedef std::tuple<AgradCdfCauchy, type_ffv_137> AgradCdfCauchy_ffv_137;
+typedef std::tuple<AgradCdfCauchy, type_ffv_138> AgradCdfCauchy_ffv_138;
+typedef std::tuple<AgradCdfCauchy, type_ffv_139> AgradCdfCauchy_ffv_139;
+typedef std::tuple<AgradCdfCauchy, type_ffv_140> AgradCdfCauchy_ffv_140;
+typedef std::tuple<AgradCdfCauchy, type_ffv_141> AgradCdfCauchy_ffv_141;
+typedef std::tuple<AgradCdfCauchy, type_ffv_142> AgradCdfCauchy_ffv_142;
+typedef std::tuple<AgradCdfCauchy, type_ffv_143> AgradCdfCauchy_ffv_143;
+typedef std::tuple<AgradCdfCauchy, type_ffv_144> AgradCdfCauchy_ffv_144;
+typedef std::tuple<AgradCdfCauchy, type_ffv_145> AgradCdfCauchy_ffv_145;
+typedef std::tuple<AgradCdfCauchy, type_ffv_146> AgradCdfCauchy_ffv_146;
+typedef std::tuple<AgradCdfCauchy, type_ffv_147> AgradCdfCauchy_ffv_147;
+typedef std::tuple<AgradCdfCauchy, type_ffv_148> AgradCdfCauchy_ffv_148;
+typedef std::tuple<AgradCdfCauchy, type_ffv_149> AgradCdfCauchy_ffv_149;
+typedef std::tuple<AgradCdfCauchy, type_ffv_150> AgradCdfCauchy_ffv_150;
+typedef std::tuple<AgradCdfCauchy, type_ffv_151> AgradCdfCauchy_ffv_151;
+typedef std::tuple<AgradCdfCauchy, type_ffv_152> AgradCdfCauchy_ffv_152;
+typedef std::tuple<AgradCdfCauchy, type_ffv_153> AgradCdfCauchy_ffv_153;
+typedef std::tuple<AgradCdfCauchy, type_ffv_154> AgradCdfCauchy_ffv_154;
+typedef std::tuple<AgradCdfCauchy, type_ffv_155> AgradCdfCauchy_ffv_155;
+typedef std::tuple<AgradCdfCauchy, type_ffv_156> AgradCdfCauchy_ffv_156;
+typedef std::tuple<AgradCdfCauchy, type_ffv_157> AgradCdfCauchy_ffv_157;
+typedef std::tuple<AgradCdfCauchy, type_ffv_158> AgradCdfCauchy_ffv_158;
+typedef std::tuple<AgradCdfCauchy, type_ffv_159> AgradCdfCauchy_ffv_159;
+typedef std::tuple<AgradCdfCauchy, type_ffv_160> AgradCdfCauchy_ffv_160;
+typedef std::tuple<AgradCdfCauchy, type_ffv_161> AgradCdfCauchy_ffv_161;
+typedef std::tuple<AgradCdfCauchy, type_ffv_162> AgradCdfCauchy_ffv_162;
+typedef std::tuple<AgradCdfCauchy, type_ffv_163> AgradCdfCauchy_ffv_163;
+typedef std::tuple<AgradCdfCauchy, type_ffv_164> AgradCdfCauchy_ffv_164;
+typedef std::tuple<AgradCdfCauchy, type_ffv_165> AgradCdfCauchy_ffv_165;
+typedef std::tuple<AgradCdfCauchy, type_ffv_166> AgradCdfCauchy_ffv_166;
+typedef std::tuple<AgradCdfCauchy, type_ffv_167> AgradCdfCauchy_ffv_167;
+typedef std::tuple<AgradCdfCauchy, type_ffv_168> AgradCdfCauchy_ffv_168;
+typedef std::tuple<AgradCdfCauchy, type_ffv_169> AgradCdfCauchy_ffv_169;
+typedef std::tuple<AgradCdfCauchy, type_ffv_170> AgradCdfCauchy_ffv_170;
+typedef std::tuple<AgradCdfCauchy, type_ffv_171> AgradCdfCauchy_ffv_171;
+typedef std::tuple<AgradCdfCauchy, type_ffv_172> AgradCdfCauchy_ffv_172;
+typedef std::tuple<AgradCdfCauchy, type_ffv_173> AgradCdfCauchy_ffv_173;
+typedef std::tuple<AgradCdfCauchy, type_ffv_174> AgradCdfCauchy_ffv_174;
+typedef std::tuple<AgradCdfCauchy, type_ffv_175> AgradCdfCauchy_ffv_175;
+typedef std::tuple<AgradCdfCauchy, type_ffv_176> AgradCdfCauchy_ffv_176;
+typedef std::tuple<AgradCdfCauchy, type_ffv_177> AgradCdfCauchy_ffv_177;
+typedef std::tuple<AgradCdfCauchy, type_ffv_178> AgradCdfCauchy_ffv_178;
+typedef std::tuple<AgradCdfCauchy, type_ffv_179> AgradCdfCauchy_ffv_179;
+typedef std::tuple<AgradCdfCauchy, type_ffv_180> AgradCdfCauchy_ffv_180;
+typedef std::tuple<AgradCdfCauchy, type_ffv_181> AgradCdfCauchy_ffv_181;
+typedef std::tuple<AgradCdfCauchy, type_ffv_182> AgradCdfCauchy_ffv_182;
+typedef std::tuple<AgradCdfCauchy, type_ffv_183> AgradCdfCauchy_ffv_183;
+typedef std::tuple<AgradCdfCauchy, type_ffv_184> AgradCdfCauchy_ffv_184;
+typedef std::tuple<AgradCdfCauchy, type_ffv_185> AgradCdfCauchy_ffv_185;
+typedef std::tuple<AgradCdfCauchy, type_ffv_186> AgradCdfCauchy_ffv_186;
+typedef std::tuple<AgradCdfCauchy, type_ffv_187> AgradCdfCauchy_ffv_187;
+typedef std::tuple<AgradCdfCauchy, type_ffv_188> AgradCdfCauchy_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_100, AgradCdfTestFixture, AgradCdfCauchy_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_101, AgradCdfTestFixture, AgradCdfCauchy_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_102, AgradCdfTestFixture, AgradCdfCauchy_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_103, AgradCdfTestFixture, AgradCdfCauchy_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_104, AgradCdfTestFixture, AgradCdfCauchy_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_105, AgradCdfTestFixture, AgradCdfCauchy_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_106, AgradCdfTestFixture, AgradCdfCauchy_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_107, AgradCdfTestFixture, AgradCdfCauchy_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_108, AgradCdfTestFixture, AgradCdfCauchy_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_109, AgradCdfTestFixture, AgradCdfCauchy_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_110, AgradCdfTestFixture, AgradCdfCauchy_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_111, AgradCdfTestFixture, AgradCdfCauchy_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_112, AgradCdfTestFixture, AgradCdfCauchy_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_113, AgradCdfTestFixture, AgradCdfCauchy_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_114, AgradCdfTestFixture, AgradCdfCauchy_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_115, AgradCdfTestFixture, AgradCdfCauchy_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_116, AgradCdfTestFixture, AgradCdfCauchy_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_117, AgradCdfTestFixture, AgradCdfCauchy_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_118, AgradCdfTestFixture, AgradCdfCauchy_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_119, AgradCdfTestFixture, AgradCdfCauchy_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_120, AgradCdfTestFixture, AgradCdfCauchy_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_121, AgradCdfTestFixture, AgradCdfCauchy_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_122, AgradCdfTestFixture, AgradCdfCauchy_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_123, AgradCdfTestFixture, AgradCdfCauchy_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_124, AgradCdfTestFixture, AgradCdfCauchy_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_125, AgradCdfTestFixture, AgradCdfCauchy_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_126, AgradCdfTestFixture, AgradCdfCauchy_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_127, AgradCdfTestFixture, AgradCdfCauchy_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_128, AgradCdfTestFixture, AgradCdfCauchy_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_129, AgradCdfTestFixture, AgradCdfCauchy_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_130, AgradCdfTestFixture, AgradCdfCauchy_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_131, AgradCdfTestFixture, AgradCdfCauchy_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_132, AgradCdfTestFixture, AgradCdfCauchy_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_133, AgradCdfTestFixture, AgradCdfCauchy_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_134, AgradCdfTestFixture, AgradCdfCauchy_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_135, AgradCdfTestFixture, AgradCdfCauchy_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_136, AgradCdfTestFixture, AgradCdfCauchy_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_137, AgradCdfTestFixture, AgradCdfCauchy_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_138, AgradCdfTestFixture, AgradCdfCauchy_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_139, AgradCdfTestFixture, AgradCdfCauchy_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_140, AgradCdfTestFixture, AgradCdfCauchy_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_141, AgradCdfTestFixture, AgradCdfCauchy_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_142, AgradCdfTestFixture, AgradCdfCauchy_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_143, AgradCdfTestFixture, AgradCdfCauchy_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_144, AgradCdfTestFixture, AgradCdfCauchy_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_145, AgradCdfTestFixture, AgradCdfCauchy_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_146, AgradCdfTestFixture, AgradCdfCauchy_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_147, AgradCdfTestFixture, AgradCdfCauchy_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_148, AgradCdfTestFixture, AgradCdfCauchy_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_149, AgradCdfTestFixture, AgradCdfCauchy_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_150, AgradCdfTestFixture, AgradCdfCauchy_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_151, AgradCdfTestFixture, AgradCdfCauchy_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_152, AgradCdfTestFixture, AgradCdfCauchy_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_153, AgradCdfTestFixture, AgradCdfCauchy_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_154, AgradCdfTestFixture, AgradCdfCauchy_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_155, AgradCdfTestFixture, AgradCdfCauchy_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_156, AgradCdfTestFixture, AgradCdfCauchy_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_157, AgradCdfTestFixture, AgradCdfCauchy_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_158, AgradCdfTestFixture, AgradCdfCauchy_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_159, AgradCdfTestFixture, AgradCdfCauchy_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_160, AgradCdfTestFixture, AgradCdfCauchy_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_161, AgradCdfTestFixture, AgradCdfCauchy_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_162, AgradCdfTestFixture, AgradCdfCauchy_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_163, AgradCdfTestFixture, AgradCdfCauchy_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_164, AgradCdfTestFixture, AgradCdfCauchy_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_165, AgradCdfTestFixture, AgradCdfCauchy_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_166, AgradCdfTestFixture, AgradCdfCauchy_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_167, AgradCdfTestFixture, AgradCdfCauchy_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_168, AgradCdfTestFixture, AgradCdfCauchy_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_169, AgradCdfTestFixture, AgradCdfCauchy_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_170, AgradCdfTestFixture, AgradCdfCauchy_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_171, AgradCdfTestFixture, AgradCdfCauchy_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_172, AgradCdfTestFixture, AgradCdfCauchy_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_173, AgradCdfTestFixture, AgradCdfCauchy_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_174, AgradCdfTestFixture, AgradCdfCauchy_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_175, AgradCdfTestFixture, AgradCdfCauchy_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_176, AgradCdfTestFixture, AgradCdfCauchy_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_177, AgradCdfTestFixture, AgradCdfCauchy_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_178, AgradCdfTestFixture, AgradCdfCauchy_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_179, AgradCdfTestFixture, AgradCdfCauchy_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_180, AgradCdfTestFixture, AgradCdfCauchy_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_181, AgradCdfTestFixture, AgradCdfCauchy_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_182, AgradCdfTestFixture, AgradCdfCauchy_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_183, AgradCdfTestFixture, AgradCdfCauchy_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_184, AgradCdfTestFixture, AgradCdfCauchy_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_185, AgradCdfTestFixture, AgradCdfCauchy_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_186, AgradCdfTestFixture, AgradCdfCauchy_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_187, AgradCdfTestFixture, AgradCdfCauchy_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_ffv_188, AgradCdfTestFixture, AgradCdfCauchy_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfCauchy, type_v_100> AgradCdfCauchy_v_100;
+typedef std::tuple<AgradCdfCauchy, type_v_101> AgradCdfCauchy_v_101;
+typedef std::tuple<AgradCdfCauchy, type_v_102> AgradCdfCauchy_v_102;
+typedef std::tuple<AgradCdfCauchy, type_v_103> AgradCdfCauchy_v_103;
+typedef std::tuple<AgradCdfCauchy, type_v_104> AgradCdfCauchy_v_104;
+typedef std::tuple<AgradCdfCauchy, type_v_105> AgradCdfCauchy_v_105;
+typedef std::tuple<AgradCdfCauchy, type_v_106> AgradCdfCauchy_v_106;
+typedef std::tuple<AgradCdfCauchy, type_v_107> AgradCdfCauchy_v_107;
+typedef std::tuple<AgradCdfCauchy, type_v_108> AgradCdfCauchy_v_108;
+typedef std::tuple<AgradCdfCauchy, type_v_109> AgradCdfCauchy_v_109;
+typedef std::tuple<AgradCdfCauchy, type_v_110> AgradCdfCauchy_v_110;
+typedef std::tuple<AgradCdfCauchy, type_v_111> AgradCdfCauchy_v_111;
+typedef std::tuple<AgradCdfCauchy, type_v_112> AgradCdfCauchy_v_112;
+typedef std::tuple<AgradCdfCauchy, type_v_113> AgradCdfCauchy_v_113;
+typedef std::tuple<AgradCdfCauchy, type_v_114> AgradCdfCauchy_v_114;
+typedef std::tuple<AgradCdfCauchy, type_v_115> AgradCdfCauchy_v_115;
+typedef std::tuple<AgradCdfCauchy, type_v_116> AgradCdfCauchy_v_116;
+typedef std::tuple<AgradCdfCauchy, type_v_117> AgradCdfCauchy_v_117;
+typedef std::tuple<AgradCdfCauchy, type_v_118> AgradCdfCauchy_v_118;
+typedef std::tuple<AgradCdfCauchy, type_v_119> AgradCdfCauchy_v_119;
+typedef std::tuple<AgradCdfCauchy, type_v_120> AgradCdfCauchy_v_120;
+typedef std::tuple<AgradCdfCauchy, type_v_121> AgradCdfCauchy_v_121;
+typedef std::tuple<AgradCdfCauchy, type_v_122> AgradCdfCauchy_v_122;
+typedef std::tuple<AgradCdfCauchy, type_v_123> AgradCdfCauchy_v_123;
+typedef std::tuple<AgradCdfCauchy, type_v_124> AgradCdfCauchy_v_124;
+typedef std::tuple<AgradCdfCauchy, type_v_125> AgradCdfCauchy_v_125;
+typedef std::tuple<AgradCdfCauchy, type_v_126> AgradCdfCauchy_v_126;
+typedef std::tuple<AgradCdfCauchy, type_v_127> AgradCdfCauchy_v_127;
+typedef std::tuple<AgradCdfCauchy, type_v_128> AgradCdfCauchy_v_128;
+typedef std::tuple<AgradCdfCauchy, type_v_129> AgradCdfCauchy_v_129;
+typedef std::tuple<AgradCdfCauchy, type_v_130> AgradCdfCauchy_v_130;
+typedef std::tuple<AgradCdfCauchy, type_v_131> AgradCdfCauchy_v_131;
+typedef std::tuple<AgradCdfCauchy, type_v_132> AgradCdfCauchy_v_132;
+typedef std::tuple<AgradCdfCauchy, type_v_133> AgradCdfCauchy_v_133;
+typedef std::tuple<AgradCdfCauchy, type_v_134> AgradCdfCauchy_v_134;
+typedef std::tuple<AgradCdfCauchy, type_v_135> AgradCdfCauchy_v_135;
+typedef std::tuple<AgradCdfCauchy, type_v_136> AgradCdfCauchy_v_136;
+typedef std::tuple<AgradCdfCauchy, type_v_137> AgradCdfCauchy_v_137;
+typedef std::tuple<AgradCdfCauchy, type_v_138> AgradCdfCauchy_v_138;
+typedef std::tuple<AgradCdfCauchy, type_v_139> AgradCdfCauchy_v_139;
+typedef std::tuple<AgradCdfCauchy, type_v_140> AgradCdfCauchy_v_140;
+typedef std::tuple<AgradCdfCauchy, type_v_141> AgradCdfCauchy_v_141;
+typedef std::tuple<AgradCdfCauchy, type_v_142> AgradCdfCauchy_v_142;
+typedef std::tuple<AgradCdfCauchy, type_v_143> AgradCdfCauchy_v_143;
+typedef std::tuple<AgradCdfCauchy, type_v_144> AgradCdfCauchy_v_144;
+typedef std::tuple<AgradCdfCauchy, type_v_145> AgradCdfCauchy_v_145;
+typedef std::tuple<AgradCdfCauchy, type_v_146> AgradCdfCauchy_v_146;
+typedef std::tuple<AgradCdfCauchy, type_v_147> AgradCdfCauchy_v_147;
+typedef std::tuple<AgradCdfCauchy, type_v_148> AgradCdfCauchy_v_148;
+typedef std::tuple<AgradCdfCauchy, type_v_149> AgradCdfCauchy_v_149;
+typedef std::tuple<AgradCdfCauchy, type_v_150> AgradCdfCauchy_v_150;
+typedef std::tuple<AgradCdfCauchy, type_v_151> AgradCdfCauchy_v_151;
+typedef std::tuple<AgradCdfCauchy, type_v_152> AgradCdfCauchy_v_152;
+typedef std::tuple<AgradCdfCauchy, type_v_153> AgradCdfCauchy_v_153;
+typedef std::tuple<AgradCdfCauchy, type_v_154> AgradCdfCauchy_v_154;
+typedef std::tuple<AgradCdfCauchy, type_v_155> AgradCdfCauchy_v_155;
+typedef std::tuple<AgradCdfCauchy, type_v_156> AgradCdfCauchy_v_156;
+typedef std::tuple<AgradCdfCauchy, type_v_157> AgradCdfCauchy_v_157;
+typedef std::tuple<AgradCdfCauchy, type_v_158> AgradCdfCauchy_v_158;
+typedef std::tuple<AgradCdfCauchy, type_v_159> AgradCdfCauchy_v_159;
+typedef std::tuple<AgradCdfCauchy, type_v_160> AgradCdfCauchy_v_160;
+typedef std::tuple<AgradCdfCauchy, type_v_161> AgradCdfCauchy_v_161;
+typedef std::tuple<AgradCdfCauchy, type_v_162> AgradCdfCauchy_v_162;
+typedef std::tuple<AgradCdfCauchy, type_v_163> AgradCdfCauchy_v_163;
+typedef std::tuple<AgradCdfCauchy, type_v_164> AgradCdfCauchy_v_164;
+typedef std::tuple<AgradCdfCauchy, type_v_165> AgradCdfCauchy_v_165;
+typedef std::tuple<AgradCdfCauchy, type_v_166> AgradCdfCauchy_v_166;
+typedef std::tuple<AgradCdfCauchy, type_v_167> AgradCdfCauchy_v_167;
+typedef std::tuple<AgradCdfCauchy, type_v_168> AgradCdfCauchy_v_168;
+typedef std::tuple<AgradCdfCauchy, type_v_169> AgradCdfCauchy_v_169;
+typedef std::tuple<AgradCdfCauchy, type_v_170> AgradCdfCauchy_v_170;
+typedef std::tuple<AgradCdfCauchy, type_v_171> AgradCdfCauchy_v_171;
+typedef std::tuple<AgradCdfCauchy, type_v_172> AgradCdfCauchy_v_172;
+typedef std::tuple<AgradCdfCauchy, type_v_173> AgradCdfCauchy_v_173;
+typedef std::tuple<AgradCdfCauchy, type_v_174> AgradCdfCauchy_v_174;
+typedef std::tuple<AgradCdfCauchy, type_v_175> AgradCdfCauchy_v_175;
+typedef std::tuple<AgradCdfCauchy, type_v_176> AgradCdfCauchy_v_176;
+typedef std::tuple<AgradCdfCauchy, type_v_177> AgradCdfCauchy_v_177;
+typedef std::tuple<AgradCdfCauchy, type_v_178> AgradCdfCauchy_v_178;
+typedef std::tuple<AgradCdfCauchy, type_v_179> AgradCdfCauchy_v_179;
+typedef std::tuple<AgradCdfCauchy, type_v_180> AgradCdfCauchy_v_180;
+typedef std::tuple<AgradCdfCauchy, type_v_181> AgradCdfCauchy_v_181;
+typedef std::tuple<AgradCdfCauchy, type_v_182> AgradCdfCauchy_v_182;
+typedef std::tuple<AgradCdfCauchy, type_v_183> AgradCdfCauchy_v_183;
+typedef std::tuple<AgradCdfCauchy, type_v_184> AgradCdfCauchy_v_184;
+typedef std::tuple<AgradCdfCauchy, type_v_185> AgradCdfCauchy_v_185;
+typedef std::tuple<AgradCdfCauchy, type_v_186> AgradCdfCauchy_v_186;
+typedef std::tuple<AgradCdfCauchy, type_v_187> AgradCdfCauchy_v_187;
+typedef std::tuple<AgradCdfCauchy, type_v_188> AgradCdfCauchy_v_188;
+typedef std::tuple<AgradCdfCauchy, type_v_189> AgradCdfCauchy_v_189;
+typedef std::tuple<AgradCdfCauchy, type_v_190> AgradCdfCauchy_v_190;
+typedef std::tuple<AgradCdfCauchy, type_v_191> AgradCdfCauchy_v_191;
+typedef std::tuple<AgradCdfCauchy, type_v_192> AgradCdfCauchy_v_192;
+typedef std::tuple<AgradCdfCauchy, type_v_193> AgradCdfCauchy_v_193;
+typedef std::tuple<AgradCdfCauchy, type_v_194> AgradCdfCauchy_v_194;
+typedef std::tuple<AgradCdfCauchy, type_v_195> AgradCdfCauchy_v_195;
+typedef std::tuple<AgradCdfCauchy, type_v_196> AgradCdfCauchy_v_196;
+typedef std::tuple<AgradCdfCauchy, type_v_197> AgradCdfCauchy_v_197;
+typedef std::tuple<AgradCdfCauchy, type_v_198> AgradCdfCauchy_v_198;
+typedef std::tuple<AgradCdfCauchy, type_v_199> AgradCdfCauchy_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_100, AgradCdfTestFixture, AgradCdfCauchy_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_101, AgradCdfTestFixture, AgradCdfCauchy_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_102, AgradCdfTestFixture, AgradCdfCauchy_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_103, AgradCdfTestFixture, AgradCdfCauchy_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_104, AgradCdfTestFixture, AgradCdfCauchy_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_105, AgradCdfTestFixture, AgradCdfCauchy_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_106, AgradCdfTestFixture, AgradCdfCauchy_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_107, AgradCdfTestFixture, AgradCdfCauchy_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_108, AgradCdfTestFixture, AgradCdfCauchy_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_109, AgradCdfTestFixture, AgradCdfCauchy_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_110, AgradCdfTestFixture, AgradCdfCauchy_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_111, AgradCdfTestFixture, AgradCdfCauchy_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_112, AgradCdfTestFixture, AgradCdfCauchy_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_113, AgradCdfTestFixture, AgradCdfCauchy_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_114, AgradCdfTestFixture, AgradCdfCauchy_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_115, AgradCdfTestFixture, AgradCdfCauchy_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_116, AgradCdfTestFixture, AgradCdfCauchy_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_117, AgradCdfTestFixture, AgradCdfCauchy_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_118, AgradCdfTestFixture, AgradCdfCauchy_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_119, AgradCdfTestFixture, AgradCdfCauchy_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_120, AgradCdfTestFixture, AgradCdfCauchy_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_121, AgradCdfTestFixture, AgradCdfCauchy_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_122, AgradCdfTestFixture, AgradCdfCauchy_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_123, AgradCdfTestFixture, AgradCdfCauchy_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_124, AgradCdfTestFixture, AgradCdfCauchy_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_125, AgradCdfTestFixture, AgradCdfCauchy_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_126, AgradCdfTestFixture, AgradCdfCauchy_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_127, AgradCdfTestFixture, AgradCdfCauchy_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_128, AgradCdfTestFixture, AgradCdfCauchy_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_129, AgradCdfTestFixture, AgradCdfCauchy_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_130, AgradCdfTestFixture, AgradCdfCauchy_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_131, AgradCdfTestFixture, AgradCdfCauchy_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_132, AgradCdfTestFixture, AgradCdfCauchy_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_133, AgradCdfTestFixture, AgradCdfCauchy_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_134, AgradCdfTestFixture, AgradCdfCauchy_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_135, AgradCdfTestFixture, AgradCdfCauchy_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_136, AgradCdfTestFixture, AgradCdfCauchy_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_137, AgradCdfTestFixture, AgradCdfCauchy_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_138, AgradCdfTestFixture, AgradCdfCauchy_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_139, AgradCdfTestFixture, AgradCdfCauchy_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_140, AgradCdfTestFixture, AgradCdfCauchy_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_141, AgradCdfTestFixture, AgradCdfCauchy_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_142, AgradCdfTestFixture, AgradCdfCauchy_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_143, AgradCdfTestFixture, AgradCdfCauchy_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_144, AgradCdfTestFixture, AgradCdfCauchy_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_145, AgradCdfTestFixture, AgradCdfCauchy_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_146, AgradCdfTestFixture, AgradCdfCauchy_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_147, AgradCdfTestFixture, AgradCdfCauchy_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_148, AgradCdfTestFixture, AgradCdfCauchy_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_149, AgradCdfTestFixture, AgradCdfCauchy_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_150, AgradCdfTestFixture, AgradCdfCauchy_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_151, AgradCdfTestFixture, AgradCdfCauchy_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_152, AgradCdfTestFixture, AgradCdfCauchy_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_153, AgradCdfTestFixture, AgradCdfCauchy_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_154, AgradCdfTestFixture, AgradCdfCauchy_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_155, AgradCdfTestFixture, AgradCdfCauchy_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_156, AgradCdfTestFixture, AgradCdfCauchy_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_157, AgradCdfTestFixture, AgradCdfCauchy_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_158, AgradCdfTestFixture, AgradCdfCauchy_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_159, AgradCdfTestFixture, AgradCdfCauchy_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_160, AgradCdfTestFixture, AgradCdfCauchy_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_161, AgradCdfTestFixture, AgradCdfCauchy_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_162, AgradCdfTestFixture, AgradCdfCauchy_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_163, AgradCdfTestFixture, AgradCdfCauchy_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_164, AgradCdfTestFixture, AgradCdfCauchy_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_165, AgradCdfTestFixture, AgradCdfCauchy_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_166, AgradCdfTestFixture, AgradCdfCauchy_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_167, AgradCdfTestFixture, AgradCdfCauchy_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_168, AgradCdfTestFixture, AgradCdfCauchy_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_169, AgradCdfTestFixture, AgradCdfCauchy_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_170, AgradCdfTestFixture, AgradCdfCauchy_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_171, AgradCdfTestFixture, AgradCdfCauchy_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_172, AgradCdfTestFixture, AgradCdfCauchy_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_173, AgradCdfTestFixture, AgradCdfCauchy_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_174, AgradCdfTestFixture, AgradCdfCauchy_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_175, AgradCdfTestFixture, AgradCdfCauchy_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_176, AgradCdfTestFixture, AgradCdfCauchy_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_177, AgradCdfTestFixture, AgradCdfCauchy_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_178, AgradCdfTestFixture, AgradCdfCauchy_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_179, AgradCdfTestFixture, AgradCdfCauchy_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_180, AgradCdfTestFixture, AgradCdfCauchy_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_181, AgradCdfTestFixture, AgradCdfCauchy_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_182, AgradCdfTestFixture, AgradCdfCauchy_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_183, AgradCdfTestFixture, AgradCdfCauchy_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_184, AgradCdfTestFixture, AgradCdfCauchy_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_185, AgradCdfTestFixture, AgradCdfCauchy_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_186, AgradCdfTestFixture, AgradCdfCauchy_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_187, AgradCdfTestFixture, AgradCdfCauchy_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_188, AgradCdfTestFixture, AgradCdfCauchy_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_189, AgradCdfTestFixture, AgradCdfCauchy_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_190, AgradCdfTestFixture, AgradCdfCauchy_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_191, AgradCdfTestFixture, AgradCdfCauchy_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_192, AgradCdfTestFixture, AgradCdfCauchy_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_193, AgradCdfTestFixture, AgradCdfCauchy_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_194, AgradCdfTestFixture, AgradCdfCauchy_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_195, AgradCdfTestFixture, AgradCdfCauchy_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_196, AgradCdfTestFixture, AgradCdfCauchy_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_197, AgradCdfTestFixture, AgradCdfCauchy_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_198, AgradCdfTestFixture, AgradCdfCauchy_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_199, AgradCdfTestFixture, AgradCdfCauchy_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfCauchy, type_vv_100> AgradCdfCauchy_vv_100;
+typedef std::tuple<AgradCdfCauchy, type_vv_101> AgradCdfCauchy_vv_101;
+typedef std::tuple<AgradCdfCauchy, type_vv_102> AgradCdfCauchy_vv_102;
+typedef std::tuple<AgradCdfCauchy, type_vv_103> AgradCdfCauchy_vv_103;
+typedef std::tuple<AgradCdfCauchy, type_vv_104> AgradCdfCauchy_vv_104;
+typedef std::tuple<AgradCdfCauchy, type_vv_105> AgradCdfCauchy_vv_105;
+typedef std::tuple<AgradCdfCauchy, type_vv_106> AgradCdfCauchy_vv_106;
+typedef std::tuple<AgradCdfCauchy, type_vv_107> AgradCdfCauchy_vv_107;
+typedef std::tuple<AgradCdfCauchy, type_vv_108> AgradCdfCauchy_vv_108;
+typedef std::tuple<AgradCdfCauchy, type_vv_109> AgradCdfCauchy_vv_109;
+typedef std::tuple<AgradCdfCauchy, type_vv_110> AgradCdfCauchy_vv_110;
+typedef std::tuple<AgradCdfCauchy, type_vv_111> AgradCdfCauchy_vv_111;
+typedef std::tuple<AgradCdfCauchy, type_vv_112> AgradCdfCauchy_vv_112;
+typedef std::tuple<AgradCdfCauchy, type_vv_113> AgradCdfCauchy_vv_113;
+typedef std::tuple<AgradCdfCauchy, type_vv_114> AgradCdfCauchy_vv_114;
+typedef std::tuple<AgradCdfCauchy, type_vv_115> AgradCdfCauchy_vv_115;
+typedef std::tuple<AgradCdfCauchy, type_vv_116> AgradCdfCauchy_vv_116;
+typedef std::tuple<AgradCdfCauchy, type_vv_117> AgradCdfCauchy_vv_117;
+typedef std::tuple<AgradCdfCauchy, type_vv_118> AgradCdfCauchy_vv_118;
+typedef std::tuple<AgradCdfCauchy, type_vv_119> AgradCdfCauchy_vv_119;
+typedef std::tuple<AgradCdfCauchy, type_vv_120> AgradCdfCauchy_vv_120;
+typedef std::tuple<AgradCdfCauchy, type_vv_121> AgradCdfCauchy_vv_121;
+typedef std::tuple<AgradCdfCauchy, type_vv_122> AgradCdfCauchy_vv_122;
+typedef std::tuple<AgradCdfCauchy, type_vv_123> AgradCdfCauchy_vv_123;
+typedef std::tuple<AgradCdfCauchy, type_vv_124> AgradCdfCauchy_vv_124;
+typedef std::tuple<AgradCdfCauchy, type_vv_125> AgradCdfCauchy_vv_125;
+typedef std::tuple<AgradCdfCauchy, type_vv_126> AgradCdfCauchy_vv_126;
+typedef std::tuple<AgradCdfCauchy, type_vv_127> AgradCdfCauchy_vv_127;
+typedef std::tuple<AgradCdfCauchy, type_vv_128> AgradCdfCauchy_vv_128;
+typedef std::tuple<AgradCdfCauchy, type_vv_129> AgradCdfCauchy_vv_129;
+typedef std::tuple<AgradCdfCauchy, type_vv_130> AgradCdfCauchy_vv_130;
+typedef std::tuple<AgradCdfCauchy, type_vv_131> AgradCdfCauchy_vv_131;
+typedef std::tuple<AgradCdfCauchy, type_vv_132> AgradCdfCauchy_vv_132;
+typedef std::tuple<AgradCdfCauchy, type_vv_133> AgradCdfCauchy_vv_133;
+typedef std::tuple<AgradCdfCauchy, type_vv_134> AgradCdfCauchy_vv_134;
+typedef std::tuple<AgradCdfCauchy, type_vv_135> AgradCdfCauchy_vv_135;
+typedef std::tuple<AgradCdfCauchy, type_vv_136> AgradCdfCauchy_vv_136;
+typedef std::tuple<AgradCdfCauchy, type_vv_137> AgradCdfCauchy_vv_137;
+typedef std::tuple<AgradCdfCauchy, type_vv_138> AgradCdfCauchy_vv_138;
+typedef std::tuple<AgradCdfCauchy, type_vv_139> AgradCdfCauchy_vv_139;
+typedef std::tuple<AgradCdfCauchy, type_vv_140> AgradCdfCauchy_vv_140;
+typedef std::tuple<AgradCdfCauchy, type_vv_141> AgradCdfCauchy_vv_141;
+typedef std::tuple<AgradCdfCauchy, type_vv_142> AgradCdfCauchy_vv_142;
+typedef std::tuple<AgradCdfCauchy, type_vv_143> AgradCdfCauchy_vv_143;
+typedef std::tuple<AgradCdfCauchy, type_vv_144> AgradCdfCauchy_vv_144;
+typedef std::tuple<AgradCdfCauchy, type_vv_145> AgradCdfCauchy_vv_145;
+typedef std::tuple<AgradCdfCauchy, type_vv_146> AgradCdfCauchy_vv_146;
+typedef std::tuple<AgradCdfCauchy, type_vv_147> AgradCdfCauchy_vv_147;
+typedef std::tuple<AgradCdfCauchy, type_vv_148> AgradCdfCauchy_vv_148;
+typedef std::tuple<AgradCdfCauchy, type_vv_149> AgradCdfCauchy_vv_149;
+typedef std::tuple<AgradCdfCauchy, type_vv_150> AgradCdfCauchy_vv_150;
+typedef std::tuple<AgradCdfCauchy, type_vv_151> AgradCdfCauchy_vv_151;
+typedef std::tuple<AgradCdfCauchy, type_vv_152> AgradCdfCauchy_vv_152;
+typedef std::tuple<AgradCdfCauchy, type_vv_153> AgradCdfCauchy_vv_153;
+typedef std::tuple<AgradCdfCauchy, type_vv_154> AgradCdfCauchy_vv_154;
+typedef std::tuple<AgradCdfCauchy, type_vv_155> AgradCdfCauchy_vv_155;
+typedef std::tuple<AgradCdfCauchy, type_vv_156> AgradCdfCauchy_vv_156;
+typedef std::tuple<AgradCdfCauchy, type_vv_157> AgradCdfCauchy_vv_157;
+typedef std::tuple<AgradCdfCauchy, type_vv_158> AgradCdfCauchy_vv_158;
+typedef std::tuple<AgradCdfCauchy, type_vv_159> AgradCdfCauchy_vv_159;
+typedef std::tuple<AgradCdfCauchy, type_vv_160> AgradCdfCauchy_vv_160;
+typedef std::tuple<AgradCdfCauchy, type_vv_161> AgradCdfCauchy_vv_161;
+typedef std::tuple<AgradCdfCauchy, type_vv_162> AgradCdfCauchy_vv_162;
+typedef std::tuple<AgradCdfCauchy, type_vv_163> AgradCdfCauchy_vv_163;
+typedef std::tuple<AgradCdfCauchy, type_vv_164> AgradCdfCauchy_vv_164;
+typedef std::tuple<AgradCdfCauchy, type_vv_165> AgradCdfCauchy_vv_165;
+typedef std::tuple<AgradCdfCauchy, type_vv_166> AgradCdfCauchy_vv_166;
+typedef std::tuple<AgradCdfCauchy, type_vv_167> AgradCdfCauchy_vv_167;
+typedef std::tuple<AgradCdfCauchy, type_vv_168> AgradCdfCauchy_vv_168;
+typedef std::tuple<AgradCdfCauchy, type_vv_169> AgradCdfCauchy_vv_169;
+typedef std::tuple<AgradCdfCauchy, type_vv_170> AgradCdfCauchy_vv_170;
+typedef std::tuple<AgradCdfCauchy, type_vv_171> AgradCdfCauchy_vv_171;
+typedef std::tuple<AgradCdfCauchy, type_vv_172> AgradCdfCauchy_vv_172;
+typedef std::tuple<AgradCdfCauchy, type_vv_173> AgradCdfCauchy_vv_173;
+typedef std::tuple<AgradCdfCauchy, type_vv_174> AgradCdfCauchy_vv_174;
+typedef std::tuple<AgradCdfCauchy, type_vv_175> AgradCdfCauchy_vv_175;
+typedef std::tuple<AgradCdfCauchy, type_vv_176> AgradCdfCauchy_vv_176;
+typedef std::tuple<AgradCdfCauchy, type_vv_177> AgradCdfCauchy_vv_177;
+typedef std::tuple<AgradCdfCauchy, type_vv_178> AgradCdfCauchy_vv_178;
+typedef std::tuple<AgradCdfCauchy, type_vv_179> AgradCdfCauchy_vv_179;
+typedef std::tuple<AgradCdfCauchy, type_vv_180> AgradCdfCauchy_vv_180;
+typedef std::tuple<AgradCdfCauchy, type_vv_181> AgradCdfCauchy_vv_181;
+typedef std::tuple<AgradCdfCauchy, type_vv_182> AgradCdfCauchy_vv_182;
+typedef std::tuple<AgradCdfCauchy, type_vv_183> AgradCdfCauchy_vv_183;
+typedef std::tuple<AgradCdfCauchy, type_vv_184> AgradCdfCauchy_vv_184;
+typedef std::tuple<AgradCdfCauchy, type_vv_185> AgradCdfCauchy_vv_185;
+typedef std::tuple<AgradCdfCauchy, type_vv_186> AgradCdfCauchy_vv_186;
+typedef std::tuple<AgradCdfCauchy, type_vv_187> AgradCdfCauchy_vv_187;
+typedef std::tuple<AgradCdfCauchy, type_vv_188> AgradCdfCauchy_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_100, AgradCdfTestFixture, AgradCdfCauchy_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_101, AgradCdfTestFixture, AgradCdfCauchy_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_102, AgradCdfTestFixture, AgradCdfCauchy_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_103, AgradCdfTestFixture, AgradCdfCauchy_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_104, AgradCdfTestFixture, AgradCdfCauchy_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_105, AgradCdfTestFixture, AgradCdfCauchy_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_106, AgradCdfTestFixture, AgradCdfCauchy_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_107, AgradCdfTestFixture, AgradCdfCauchy_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_108, AgradCdfTestFixture, AgradCdfCauchy_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_109, AgradCdfTestFixture, AgradCdfCauchy_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_110, AgradCdfTestFixture, AgradCdfCauchy_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_111, AgradCdfTestFixture, AgradCdfCauchy_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_112, AgradCdfTestFixture, AgradCdfCauchy_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_113, AgradCdfTestFixture, AgradCdfCauchy_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_114, AgradCdfTestFixture, AgradCdfCauchy_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_115, AgradCdfTestFixture, AgradCdfCauchy_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_116, AgradCdfTestFixture, AgradCdfCauchy_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_117, AgradCdfTestFixture, AgradCdfCauchy_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_118, AgradCdfTestFixture, AgradCdfCauchy_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_119, AgradCdfTestFixture, AgradCdfCauchy_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_120, AgradCdfTestFixture, AgradCdfCauchy_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_121, AgradCdfTestFixture, AgradCdfCauchy_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_122, AgradCdfTestFixture, AgradCdfCauchy_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_123, AgradCdfTestFixture, AgradCdfCauchy_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_124, AgradCdfTestFixture, AgradCdfCauchy_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_125, AgradCdfTestFixture, AgradCdfCauchy_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_126, AgradCdfTestFixture, AgradCdfCauchy_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_127, AgradCdfTestFixture, AgradCdfCauchy_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_128, AgradCdfTestFixture, AgradCdfCauchy_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_129, AgradCdfTestFixture, AgradCdfCauchy_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_130, AgradCdfTestFixture, AgradCdfCauchy_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_131, AgradCdfTestFixture, AgradCdfCauchy_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_132, AgradCdfTestFixture, AgradCdfCauchy_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_133, AgradCdfTestFixture, AgradCdfCauchy_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_134, AgradCdfTestFixture, AgradCdfCauchy_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_135, AgradCdfTestFixture, AgradCdfCauchy_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_136, AgradCdfTestFixture, AgradCdfCauchy_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_137, AgradCdfTestFixture, AgradCdfCauchy_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_138, AgradCdfTestFixture, AgradCdfCauchy_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_139, AgradCdfTestFixture, AgradCdfCauchy_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_140, AgradCdfTestFixture, AgradCdfCauchy_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_141, AgradCdfTestFixture, AgradCdfCauchy_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_142, AgradCdfTestFixture, AgradCdfCauchy_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_143, AgradCdfTestFixture, AgradCdfCauchy_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_144, AgradCdfTestFixture, AgradCdfCauchy_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_145, AgradCdfTestFixture, AgradCdfCauchy_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_146, AgradCdfTestFixture, AgradCdfCauchy_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_147, AgradCdfTestFixture, AgradCdfCauchy_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_148, AgradCdfTestFixture, AgradCdfCauchy_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_149, AgradCdfTestFixture, AgradCdfCauchy_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_150, AgradCdfTestFixture, AgradCdfCauchy_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_151, AgradCdfTestFixture, AgradCdfCauchy_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_152, AgradCdfTestFixture, AgradCdfCauchy_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_153, AgradCdfTestFixture, AgradCdfCauchy_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_154, AgradCdfTestFixture, AgradCdfCauchy_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_155, AgradCdfTestFixture, AgradCdfCauchy_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_156, AgradCdfTestFixture, AgradCdfCauchy_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_157, AgradCdfTestFixture, AgradCdfCauchy_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_158, AgradCdfTestFixture, AgradCdfCauchy_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_159, AgradCdfTestFixture, AgradCdfCauchy_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_160, AgradCdfTestFixture, AgradCdfCauchy_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_161, AgradCdfTestFixture, AgradCdfCauchy_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_162, AgradCdfTestFixture, AgradCdfCauchy_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_163, AgradCdfTestFixture, AgradCdfCauchy_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_164, AgradCdfTestFixture, AgradCdfCauchy_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_165, AgradCdfTestFixture, AgradCdfCauchy_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_166, AgradCdfTestFixture, AgradCdfCauchy_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_167, AgradCdfTestFixture, AgradCdfCauchy_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_168, AgradCdfTestFixture, AgradCdfCauchy_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_169, AgradCdfTestFixture, AgradCdfCauchy_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_170, AgradCdfTestFixture, AgradCdfCauchy_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_171, AgradCdfTestFixture, AgradCdfCauchy_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_172, AgradCdfTestFixture, AgradCdfCauchy_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_173, AgradCdfTestFixture, AgradCdfCauchy_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_174, AgradCdfTestFixture, AgradCdfCauchy_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_175, AgradCdfTestFixture, AgradCdfCauchy_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_176, AgradCdfTestFixture, AgradCdfCauchy_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_177, AgradCdfTestFixture, AgradCdfCauchy_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_178, AgradCdfTestFixture, AgradCdfCauchy_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_179, AgradCdfTestFixture, AgradCdfCauchy_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_180, AgradCdfTestFixture, AgradCdfCauchy_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_181, AgradCdfTestFixture, AgradCdfCauchy_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_182, AgradCdfTestFixture, AgradCdfCauchy_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_183, AgradCdfTestFixture, AgradCdfCauchy_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_184, AgradCdfTestFixture, AgradCdfCauchy_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_185, AgradCdfTestFixture, AgradCdfCauchy_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_186, AgradCdfTestFixture, AgradCdfCauchy_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_187, AgradCdfTestFixture, AgradCdfCauchy_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_vv_188, AgradCdfTestFixture, AgradCdfCauchy_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCdfCauchy, type_v_200> AgradCdfCauchy_v_200;
+typedef std::tuple<AgradCdfCauchy, type_v_201> AgradCdfCauchy_v_201;
+typedef std::tuple<AgradCdfCauchy, type_v_202> AgradCdfCauchy_v_202;
+typedef std::tuple<AgradCdfCauchy, type_v_203> AgradCdfCauchy_v_203;
+typedef std::tuple<AgradCdfCauchy, type_v_204> AgradCdfCauchy_v_204;
+typedef std::tuple<AgradCdfCauchy, type_v_205> AgradCdfCauchy_v_205;
+typedef std::tuple<AgradCdfCauchy, type_v_206> AgradCdfCauchy_v_206;
+typedef std::tuple<AgradCdfCauchy, type_v_207> AgradCdfCauchy_v_207;
+typedef std::tuple<AgradCdfCauchy, type_v_208> AgradCdfCauchy_v_208;
+typedef std::tuple<AgradCdfCauchy, type_v_209> AgradCdfCauchy_v_209;
+typedef std::tuple<AgradCdfCauchy, type_v_210> AgradCdfCauchy_v_210;
+typedef std::tuple<AgradCdfCauchy, type_v_211> AgradCdfCauchy_v_211;
+typedef std::tuple<AgradCdfCauchy, type_v_212> AgradCdfCauchy_v_212;
+typedef std::tuple<AgradCdfCauchy, type_v_213> AgradCdfCauchy_v_213;
+typedef std::tuple<AgradCdfCauchy, type_v_214> AgradCdfCauchy_v_214;
+typedef std::tuple<AgradCdfCauchy, type_v_215> AgradCdfCauchy_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_200, AgradCdfTestFixture, AgradCdfCauchy_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_201, AgradCdfTestFixture, AgradCdfCauchy_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_202, AgradCdfTestFixture, AgradCdfCauchy_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_203, AgradCdfTestFixture, AgradCdfCauchy_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_204, AgradCdfTestFixture, AgradCdfCauchy_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_205, AgradCdfTestFixture, AgradCdfCauchy_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_206, AgradCdfTestFixture, AgradCdfCauchy_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_207, AgradCdfTestFixture, AgradCdfCauchy_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_208, AgradCdfTestFixture, AgradCdfCauchy_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_209, AgradCdfTestFixture, AgradCdfCauchy_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_210, AgradCdfTestFixture, AgradCdfCauchy_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_211, AgradCdfTestFixture, AgradCdfCauchy_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_212, AgradCdfTestFixture, AgradCdfCauchy_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_213, AgradCdfTestFixture, AgradCdfCauchy_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_214, AgradCdfTestFixture, AgradCdfCauchy_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfCauchy_v_215, AgradCdfTestFixture, AgradCdfCauchy_v_215);
+
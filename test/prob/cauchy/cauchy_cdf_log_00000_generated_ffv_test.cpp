@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_0> AgradCdfLogCauchy_ffv_0;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_1> AgradCdfLogCauchy_ffv_1;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_2> AgradCdfLogCauchy_ffv_2;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_3> AgradCdfLogCauchy_ffv_3;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_4> AgradCdfLogCauchy_ffv_4;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_5> AgradCdfLogCauchy_ffv_5;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_6> AgradCdfLogCauchy_ffv_6;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_7> AgradCdfLogCauchy_ffv_7;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_8> AgradCdfLogCauchy_ffv_8;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_9> AgradCdfLogCauchy_ffv_9;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_10> AgradCdfLogCauchy_ffv_10;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_11> AgradCdfLogCauchy_ffv_11;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_12> AgradCdfLogCauchy_ffv_12;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_13> AgradCdfLogCauchy_ffv_13;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_14> AgradCdfLogCauchy_ffv_14;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_15> AgradCdfLogCauchy_ffv_15;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_16> AgradCdfLogCauchy_ffv_16;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_17> AgradCdfLogCauchy_ffv_17;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_18> AgradCdfLogCauchy_ffv_18;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_19> AgradCdfLogCauchy_ffv_19;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_20> AgradCdfLogCauchy_ffv_20;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_21> AgradCdfLogCauchy_ffv_21;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_22> AgradCdfLogCauchy_ffv_22;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_23> AgradCdfLogCauchy_ffv_23;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_24> AgradCdfLogCauchy_ffv_24;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_25> AgradCdfLogCauchy_ffv_25;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_26> AgradCdfLogCauchy_ffv_26;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_27> AgradCdfLogCauchy_ffv_27;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_28> AgradCdfLogCauchy_ffv_28;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_29> AgradCdfLogCauchy_ffv_29;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_30> AgradCdfLogCauchy_ffv_30;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_31> AgradCdfLogCauchy_ffv_31;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_32> AgradCdfLogCauchy_ffv_32;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_33> AgradCdfLogCauchy_ffv_33;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_34> AgradCdfLogCauchy_ffv_34;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_35> AgradCdfLogCauchy_ffv_35;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_36> AgradCdfLogCauchy_ffv_36;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_37> AgradCdfLogCauchy_ffv_37;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_38> AgradCdfLogCauchy_ffv_38;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_39> AgradCdfLogCauchy_ffv_39;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_40> AgradCdfLogCauchy_ffv_40;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_41> AgradCdfLogCauchy_ffv_41;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_42> AgradCdfLogCauchy_ffv_42;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_43> AgradCdfLogCauchy_ffv_43;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_44> AgradCdfLogCauchy_ffv_44;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_45> AgradCdfLogCauchy_ffv_45;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_46> AgradCdfLogCauchy_ffv_46;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_47> AgradCdfLogCauchy_ffv_47;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_48> AgradCdfLogCauchy_ffv_48;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_49> AgradCdfLogCauchy_ffv_49;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_50> AgradCdfLogCauchy_ffv_50;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_51> AgradCdfLogCauchy_ffv_51;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_52> AgradCdfLogCauchy_ffv_52;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_53> AgradCdfLogCauchy_ffv_53;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_54> AgradCdfLogCauchy_ffv_54;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_55> AgradCdfLogCauchy_ffv_55;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_56> AgradCdfLogCauchy_ffv_56;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_57> AgradCdfLogCauchy_ffv_57;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_58> AgradCdfLogCauchy_ffv_58;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_59> AgradCdfLogCauchy_ffv_59;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_60> AgradCdfLogCauchy_ffv_60;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_61> AgradCdfLogCauchy_ffv_61;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_62> AgradCdfLogCauchy_ffv_62;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_63> AgradCdfLogCauchy_ffv_63;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_64> AgradCdfLogCauchy_ffv_64;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_65> AgradCdfLogCauchy_ffv_65;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_66> AgradCdfLogCauchy_ffv_66;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_67> AgradCdfLogCauchy_ffv_67;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_68> AgradCdfLogCauchy_ffv_68;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_69> AgradCdfLogCauchy_ffv_69;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_70> AgradCdfLogCauchy_ffv_70;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_71> AgradCdfLogCauchy_ffv_71;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_72> AgradCdfLogCauchy_ffv_72;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_73> AgradCdfLogCauchy_ffv_73;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_74> AgradCdfLogCauchy_ffv_74;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_75> AgradCdfLogCauchy_ffv_75;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_76> AgradCdfLogCauchy_ffv_76;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_77> AgradCdfLogCauchy_ffv_77;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_78> AgradCdfLogCauchy_ffv_78;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_79> AgradCdfLogCauchy_ffv_79;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_80> AgradCdfLogCauchy_ffv_80;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_81> AgradCdfLogCauchy_ffv_81;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_82> AgradCdfLogCauchy_ffv_82;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_83> AgradCdfLogCauchy_ffv_83;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_84> AgradCdfLogCauchy_ffv_84;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_85> AgradCdfLogCauchy_ffv_85;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_86> AgradCdfLogCauchy_ffv_86;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_87> AgradCdfLogCauchy_ffv_87;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_88> AgradCdfLogCauchy_ffv_88;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_89> AgradCdfLogCauchy_ffv_89;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_90> AgradCdfLogCauchy_ffv_90;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_91> AgradCdfLogCauchy_ffv_91;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_92> AgradCdfLogCauchy_ffv_92;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_93> AgradCdfLogCauchy_ffv_93;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_94> AgradCdfLogCauchy_ffv_94;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_95> AgradCdfLogCauchy_ffv_95;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_96> AgradCdfLogCauchy_ffv_96;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_97> AgradCdfLogCauchy_ffv_97;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_98> AgradCdfLogCauchy_ffv_98;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_99> AgradCdfLogCauchy_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_0, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_1, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_2, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_3, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_4, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_5, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_6, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_7, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_8, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_9, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_10, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_11, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_12, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_13, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_14, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_15, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_16, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_17, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_18, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_19, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_20, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_21, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_22, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_23, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_24, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_25, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_26, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_27, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_28, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_29, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_30, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_31, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_32, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_33, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_34, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_35, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_36, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_37, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_38, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_39, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_40, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_41, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_42, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_43, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_44, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_45, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_46, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_47, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_48, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_49, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_50, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_51, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_52, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_53, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_54, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_55, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_56, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_57, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_58, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_59, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_60, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_61, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_62, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_63, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_64, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_65, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_66, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_67, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_68, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_69, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_70, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_71, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_72, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_73, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_74, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_75, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_76, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_77, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_78, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_79, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_80, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_81, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_82, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_83, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_84, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_85, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_86, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_87, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_88, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_89, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_90, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_91, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_92, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_93, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_94, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_95, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_96, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_97, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_98, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_99, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogCauchy, type_v_0> AgradCdfLogCauchy_v_0;
+typedef std::tuple<AgradCdfLogCauchy, type_v_1> AgradCdfLogCauchy_v_1;
+typedef std::tuple<AgradCdfLogCauchy, type_v_2> AgradCdfLogCauchy_v_2;
+typedef std::tuple<AgradCdfLogCauchy, type_v_3> AgradCdfLogCauchy_v_3;
+typedef std::tuple<AgradCdfLogCauchy, type_v_4> AgradCdfLogCauchy_v_4;
+typedef std::tuple<AgradCdfLogCauchy, type_v_5> AgradCdfLogCauchy_v_5;
+typedef std::tuple<AgradCdfLogCauchy, type_v_6> AgradCdfLogCauchy_v_6;
+typedef std::tuple<AgradCdfLogCauchy, type_v_7> AgradCdfLogCauchy_v_7;
+typedef std::tuple<AgradCdfLogCauchy, type_v_8> AgradCdfLogCauchy_v_8;
+typedef std::tuple<AgradCdfLogCauchy, type_v_9> AgradCdfLogCauchy_v_9;
+typedef std::tuple<AgradCdfLogCauchy, type_v_10> AgradCdfLogCauchy_v_10;
+typedef std::tuple<AgradCdfLogCauchy, type_v_11> AgradCdfLogCauchy_v_11;
+typedef std::tuple<AgradCdfLogCauchy, type_v_12> AgradCdfLogCauchy_v_12;
+typedef std::tuple<AgradCdfLogCauchy, type_v_13> AgradCdfLogCauchy_v_13;
+typedef std::tuple<AgradCdfLogCauchy, type_v_14> AgradCdfLogCauchy_v_14;
+typedef std::tuple<AgradCdfLogCauchy, type_v_15> AgradCdfLogCauchy_v_15;
+typedef std::tuple<AgradCdfLogCauchy, type_v_16> AgradCdfLogCauchy_v_16;
+typedef std::tuple<AgradCdfLogCauchy, type_v_17> AgradCdfLogCauchy_v_17;
+typedef std::tuple<AgradCdfLogCauchy, type_v_18> AgradCdfLogCauchy_v_18;
+typedef std::tuple<AgradCdfLogCauchy, type_v_19> AgradCdfLogCauchy_v_19;
+typedef std::tuple<AgradCdfLogCauchy, type_v_20> AgradCdfLogCauchy_v_20;
+typedef std::tuple<AgradCdfLogCauchy, type_v_21> AgradCdfLogCauchy_v_21;
+typedef std::tuple<AgradCdfLogCauchy, type_v_22> AgradCdfLogCauchy_v_22;
+typedef std::tuple<AgradCdfLogCauchy, type_v_23> AgradCdfLogCauchy_v_23;
+typedef std::tuple<AgradCdfLogCauchy, type_v_24> AgradCdfLogCauchy_v_24;
+typedef std::tuple<AgradCdfLogCauchy, type_v_25> AgradCdfLogCauchy_v_25;
+typedef std::tuple<AgradCdfLogCauchy, type_v_26> AgradCdfLogCauchy_v_26;
+typedef std::tuple<AgradCdfLogCauchy, type_v_27> AgradCdfLogCauchy_v_27;
+typedef std::tuple<AgradCdfLogCauchy, type_v_28> AgradCdfLogCauchy_v_28;
+typedef std::tuple<AgradCdfLogCauchy, type_v_29> AgradCdfLogCauchy_v_29;
+typedef std::tuple<AgradCdfLogCauchy, type_v_30> AgradCdfLogCauchy_v_30;
+typedef std::tuple<AgradCdfLogCauchy, type_v_31> AgradCdfLogCauchy_v_31;
+typedef std::tuple<AgradCdfLogCauchy, type_v_32> AgradCdfLogCauchy_v_32;
+typedef std::tuple<AgradCdfLogCauchy, type_v_33> AgradCdfLogCauchy_v_33;
+typedef std::tuple<AgradCdfLogCauchy, type_v_34> AgradCdfLogCauchy_v_34;
+typedef std::tuple<AgradCdfLogCauchy, type_v_35> AgradCdfLogCauchy_v_35;
+typedef std::tuple<AgradCdfLogCauchy, type_v_36> AgradCdfLogCauchy_v_36;
+typedef std::tuple<AgradCdfLogCauchy, type_v_37> AgradCdfLogCauchy_v_37;
+typedef std::tuple<AgradCdfLogCauchy, type_v_38> AgradCdfLogCauchy_v_38;
+typedef std::tuple<AgradCdfLogCauchy, type_v_39> AgradCdfLogCauchy_v_39;
+typedef std::tuple<AgradCdfLogCauchy, type_v_40> AgradCdfLogCauchy_v_40;
+typedef std::tuple<AgradCdfLogCauchy, type_v_41> AgradCdfLogCauchy_v_41;
+typedef std::tuple<AgradCdfLogCauchy, type_v_42> AgradCdfLogCauchy_v_42;
+typedef std::tuple<AgradCdfLogCauchy, type_v_43> AgradCdfLogCauchy_v_43;
+typedef std::tuple<AgradCdfLogCauchy, type_v_44> AgradCdfLogCauchy_v_44;
+typedef std::tuple<AgradCdfLogCauchy, type_v_45> AgradCdfLogCauchy_v_45;
+typedef std::tuple<AgradCdfLogCauchy, type_v_46> AgradCdfLogCauchy_v_46;
+typedef std::tuple<AgradCdfLogCauchy, type_v_47> AgradCdfLogCauchy_v_47;
+typedef std::tuple<AgradCdfLogCauchy, type_v_48> AgradCdfLogCauchy_v_48;
+typedef std::tuple<AgradCdfLogCauchy, type_v_49> AgradCdfLogCauchy_v_49;
+typedef std::tuple<AgradCdfLogCauchy, type_v_50> AgradCdfLogCauchy_v_50;
+typedef std::tuple<AgradCdfLogCauchy, type_v_51> AgradCdfLogCauchy_v_51;
+typedef std::tuple<AgradCdfLogCauchy, type_v_52> AgradCdfLogCauchy_v_52;
+typedef std::tuple<AgradCdfLogCauchy, type_v_53> AgradCdfLogCauchy_v_53;
+typedef std::tuple<AgradCdfLogCauchy, type_v_54> AgradCdfLogCauchy_v_54;
+typedef std::tuple<AgradCdfLogCauchy, type_v_55> AgradCdfLogCauchy_v_55;
+typedef std::tuple<AgradCdfLogCauchy, type_v_56> AgradCdfLogCauchy_v_56;
+typedef std::tuple<AgradCdfLogCauchy, type_v_57> AgradCdfLogCauchy_v_57;
+typedef std::tuple<AgradCdfLogCauchy, type_v_58> AgradCdfLogCauchy_v_58;
+typedef std::tuple<AgradCdfLogCauchy, type_v_59> AgradCdfLogCauchy_v_59;
+typedef std::tuple<AgradCdfLogCauchy, type_v_60> AgradCdfLogCauchy_v_60;
+typedef std::tuple<AgradCdfLogCauchy, type_v_61> AgradCdfLogCauchy_v_61;
+typedef std::tuple<AgradCdfLogCauchy, type_v_62> AgradCdfLogCauchy_v_62;
+typedef std::tuple<AgradCdfLogCauchy, type_v_63> AgradCdfLogCauchy_v_63;
+typedef std::tuple<AgradCdfLogCauchy, type_v_64> AgradCdfLogCauchy_v_64;
+typedef std::tuple<AgradCdfLogCauchy, type_v_65> AgradCdfLogCauchy_v_65;
+typedef std::tuple<AgradCdfLogCauchy, type_v_66> AgradCdfLogCauchy_v_66;
+typedef std::tuple<AgradCdfLogCauchy, type_v_67> AgradCdfLogCauchy_v_67;
+typedef std::tuple<AgradCdfLogCauchy, type_v_68> AgradCdfLogCauchy_v_68;
+typedef std::tuple<AgradCdfLogCauchy, type_v_69> AgradCdfLogCauchy_v_69;
+typedef std::tuple<AgradCdfLogCauchy, type_v_70> AgradCdfLogCauchy_v_70;
+typedef std::tuple<AgradCdfLogCauchy, type_v_71> AgradCdfLogCauchy_v_71;
+typedef std::tuple<AgradCdfLogCauchy, type_v_72> AgradCdfLogCauchy_v_72;
+typedef std::tuple<AgradCdfLogCauchy, type_v_73> AgradCdfLogCauchy_v_73;
+typedef std::tuple<AgradCdfLogCauchy, type_v_74> AgradCdfLogCauchy_v_74;
+typedef std::tuple<AgradCdfLogCauchy, type_v_75> AgradCdfLogCauchy_v_75;
+typedef std::tuple<AgradCdfLogCauchy, type_v_76> AgradCdfLogCauchy_v_76;
+typedef std::tuple<AgradCdfLogCauchy, type_v_77> AgradCdfLogCauchy_v_77;
+typedef std::tuple<AgradCdfLogCauchy, type_v_78> AgradCdfLogCauchy_v_78;
+typedef std::tuple<AgradCdfLogCauchy, type_v_79> AgradCdfLogCauchy_v_79;
+typedef std::tuple<AgradCdfLogCauchy, type_v_80> AgradCdfLogCauchy_v_80;
+typedef std::tuple<AgradCdfLogCauchy, type_v_81> AgradCdfLogCauchy_v_81;
+typedef std::tuple<AgradCdfLogCauchy, type_v_82> AgradCdfLogCauchy_v_82;
+typedef std::tuple<AgradCdfLogCauchy, type_v_83> AgradCdfLogCauchy_v_83;
+typedef std::tuple<AgradCdfLogCauchy, type_v_84> AgradCdfLogCauchy_v_84;
+typedef std::tuple<AgradCdfLogCauchy, type_v_85> AgradCdfLogCauchy_v_85;
+typedef std::tuple<AgradCdfLogCauchy, type_v_86> AgradCdfLogCauchy_v_86;
+typedef std::tuple<AgradCdfLogCauchy, type_v_87> AgradCdfLogCauchy_v_87;
+typedef std::tuple<AgradCdfLogCauchy, type_v_88> AgradCdfLogCauchy_v_88;
+typedef std::tuple<AgradCdfLogCauchy, type_v_89> AgradCdfLogCauchy_v_89;
+typedef std::tuple<AgradCdfLogCauchy, type_v_90> AgradCdfLogCauchy_v_90;
+typedef std::tuple<AgradCdfLogCauchy, type_v_91> AgradCdfLogCauchy_v_91;
+typedef std::tuple<AgradCdfLogCauchy, type_v_92> AgradCdfLogCauchy_v_92;
+typedef std::tuple<AgradCdfLogCauchy, type_v_93> AgradCdfLogCauchy_v_93;
+typedef std::tuple<AgradCdfLogCauchy, type_v_94> AgradCdfLogCauchy_v_94;
+typedef std::tuple<AgradCdfLogCauchy, type_v_95> AgradCdfLogCauchy_v_95;
+typedef std::tuple<AgradCdfLogCauchy, type_v_96> AgradCdfLogCauchy_v_96;
+typedef std::tuple<AgradCdfLogCauchy, type_v_97> AgradCdfLogCauchy_v_97;
+typedef std::tuple<AgradCdfLogCauchy, type_v_98> AgradCdfLogCauchy_v_98;
+typedef std::tuple<AgradCdfLogCauchy, type_v_99> AgradCdfLogCauchy_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_0, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_1, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_2, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_3, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_4, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_5, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_6, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_7, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_8, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_9, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_10, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_11, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_12, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_13, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_14, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_15, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_16, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_17, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_18, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_19, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_20, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_21, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_22, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_23, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_24, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_25, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_26, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_27, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_28, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_29, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_30, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_31, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_32, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_33, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_34, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_35, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_36, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_37, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_38, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_39, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_40, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_41, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_42, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_43, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_44, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_45, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_46, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_47, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_48, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_49, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_50, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_51, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_52, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_53, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_54, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_55, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_56, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_57, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_58, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_59, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_60, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_61, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_62, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_63, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_64, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_65, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_66, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_67, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_68, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_69, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_70, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_71, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_72, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_73, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_74, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_75, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_76, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_77, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_78, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_79, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_80, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_81, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_82, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_83, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_84, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_85, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_86, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_87, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_88, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_89, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_90, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_91, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_92, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_93, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_94, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_95, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_96, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_97, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_98, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_99, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogCauchy, type_vv_0> AgradCdfLogCauchy_vv_0;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_1> AgradCdfLogCauchy_vv_1;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_2> AgradCdfLogCauchy_vv_2;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_3> AgradCdfLogCauchy_vv_3;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_4> AgradCdfLogCauchy_vv_4;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_5> AgradCdfLogCauchy_vv_5;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_6> AgradCdfLogCauchy_vv_6;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_7> AgradCdfLogCauchy_vv_7;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_8> AgradCdfLogCauchy_vv_8;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_9> AgradCdfLogCauchy_vv_9;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_10> AgradCdfLogCauchy_vv_10;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_11> AgradCdfLogCauchy_vv_11;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_12> AgradCdfLogCauchy_vv_12;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_13> AgradCdfLogCauchy_vv_13;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_14> AgradCdfLogCauchy_vv_14;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_15> AgradCdfLogCauchy_vv_15;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_16> AgradCdfLogCauchy_vv_16;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_17> AgradCdfLogCauchy_vv_17;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_18> AgradCdfLogCauchy_vv_18;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_19> AgradCdfLogCauchy_vv_19;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_20> AgradCdfLogCauchy_vv_20;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_21> AgradCdfLogCauchy_vv_21;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_22> AgradCdfLogCauchy_vv_22;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_23> AgradCdfLogCauchy_vv_23;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_24> AgradCdfLogCauchy_vv_24;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_25> AgradCdfLogCauchy_vv_25;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_26> AgradCdfLogCauchy_vv_26;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_27> AgradCdfLogCauchy_vv_27;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_28> AgradCdfLogCauchy_vv_28;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_29> AgradCdfLogCauchy_vv_29;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_30> AgradCdfLogCauchy_vv_30;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_31> AgradCdfLogCauchy_vv_31;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_32> AgradCdfLogCauchy_vv_32;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_33> AgradCdfLogCauchy_vv_33;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_34> AgradCdfLogCauchy_vv_34;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_35> AgradCdfLogCauchy_vv_35;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_36> AgradCdfLogCauchy_vv_36;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_37> AgradCdfLogCauchy_vv_37;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_38> AgradCdfLogCauchy_vv_38;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_39> AgradCdfLogCauchy_vv_39;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_40> AgradCdfLogCauchy_vv_40;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_41> AgradCdfLogCauchy_vv_41;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_42> AgradCdfLogCauchy_vv_42;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_43> AgradCdfLogCauchy_vv_43;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_44> AgradCdfLogCauchy_vv_44;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_45> AgradCdfLogCauchy_vv_45;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_46> AgradCdfLogCauchy_vv_46;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_47> AgradCdfLogCauchy_vv_47;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_48> AgradCdfLogCauchy_vv_48;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_49> AgradCdfLogCauchy_vv_49;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_50> AgradCdfLogCauchy_vv_50;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_51> AgradCdfLogCauchy_vv_51;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_52> AgradCdfLogCauchy_vv_52;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_53> AgradCdfLogCauchy_vv_53;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_54> AgradCdfLogCauchy_vv_54;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_55> AgradCdfLogCauchy_vv_55;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_56> AgradCdfLogCauchy_vv_56;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_57> AgradCdfLogCauchy_vv_57;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_58> AgradCdfLogCauchy_vv_58;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_59> AgradCdfLogCauchy_vv_59;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_60> AgradCdfLogCauchy_vv_60;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_61> AgradCdfLogCauchy_vv_61;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_62> AgradCdfLogCauchy_vv_62;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_63> AgradCdfLogCauchy_vv_63;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_64> AgradCdfLogCauchy_vv_64;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_65> AgradCdfLogCauchy_vv_65;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_66> AgradCdfLogCauchy_vv_66;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_67> AgradCdfLogCauchy_vv_67;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_68> AgradCdfLogCauchy_vv_68;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_69> AgradCdfLogCauchy_vv_69;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_70> AgradCdfLogCauchy_vv_70;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_71> AgradCdfLogCauchy_vv_71;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_72> AgradCdfLogCauchy_vv_72;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_73> AgradCdfLogCauchy_vv_73;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_74> AgradCdfLogCauchy_vv_74;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_75> AgradCdfLogCauchy_vv_75;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_76> AgradCdfLogCauchy_vv_76;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_77> AgradCdfLogCauchy_vv_77;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_78> AgradCdfLogCauchy_vv_78;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_79> AgradCdfLogCauchy_vv_79;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_80> AgradCdfLogCauchy_vv_80;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_81> AgradCdfLogCauchy_vv_81;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_82> AgradCdfLogCauchy_vv_82;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_83> AgradCdfLogCauchy_vv_83;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_84> AgradCdfLogCauchy_vv_84;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_85> AgradCdfLogCauchy_vv_85;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_86> AgradCdfLogCauchy_vv_86;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_87> AgradCdfLogCauchy_vv_87;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_88> AgradCdfLogCauchy_vv_88;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_89> AgradCdfLogCauchy_vv_89;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_90> AgradCdfLogCauchy_vv_90;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_91> AgradCdfLogCauchy_vv_91;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_92> AgradCdfLogCauchy_vv_92;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_93> AgradCdfLogCauchy_vv_93;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_94> AgradCdfLogCauchy_vv_94;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_95> AgradCdfLogCauchy_vv_95;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_96> AgradCdfLogCauchy_vv_96;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_97> AgradCdfLogCauchy_vv_97;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_98> AgradCdfLogCauchy_vv_98;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_99> AgradCdfLogCauchy_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_0, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_1, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_2, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_3, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_4, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_5, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_6, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_7, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_8, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_9, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_10, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_11, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_12, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_13, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_14, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_15, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_16, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_17, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_18, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_19, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_20, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_21, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_22, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_23, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_24, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_25, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_26, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_27, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_28, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_29, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_30, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_31, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_32, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_33, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_34, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_35, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_36, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_37, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_38, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_39, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_40, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_41, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_42, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_43, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_44, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_45, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_46, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_47, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_48, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_49, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_50, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_51, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_52, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_53, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_54, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_55, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_56, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_57, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_58, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_59, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_60, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_61, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_62, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_63, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_64, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_65, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_66, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_67, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_68, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_69, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_70, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_71, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_72, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_73, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_74, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_75, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_76, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_77, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_78, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_79, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_80, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_81, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_82, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_83, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_84, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_85, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_86, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_87, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_88, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_89, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_90, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_91, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_92, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_93, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_94, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_95, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_96, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_97, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_98, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_99, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_99);
+
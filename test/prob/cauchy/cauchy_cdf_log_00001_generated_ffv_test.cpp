@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_100> AgradCdfLogCauchy_ffv_100;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_101> AgradCdfLogCauchy_ffv_101;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_102> AgradCdfLogCauchy_ffv_102;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_103> AgradCdfLogCauchy_ffv_103;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_104> AgradCdfLogCauchy_ffv_104;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_105> AgradCdfLogCauchy_ffv_105;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_106> AgradCdfLogCauchy_ffv_106;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_107> AgradCdfLogCauchy_ffv_107;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_108> AgradCdfLogCauchy_ffv_108;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_109> AgradCdfLogCauchy_ffv_109;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_110> AgradCdfLogCauchy_ffv_110;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_111> AgradCdfLogCauchy_ffv_111;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_112> AgradCdfLogCauchy_ffv_112;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_113> AgradCdfLogCauchy_ffv_113;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_114> AgradCdfLogCauchy_ffv_114;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_115> AgradCdfLogCauchy_ffv_115;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_116> AgradCdfLogCauchy_ffv_116;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_117> AgradCdfLogCauchy_ffv_117;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_118> AgradCdfLogCauchy_ffv_118;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_119> AgradCdfLogCauchy_ffv_119;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_120> AgradCdfLogCauchy_ffv_120;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_121> AgradCdfLogCauchy_ffv_121;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_122> AgradCdfLogCauchy_ffv_122;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_123> AgradCdfLogCauchy_ffv_123;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_124> AgradCdfLogCauchy_ffv_124;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_125> AgradCdfLogCauchy_ffv_125;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_126> AgradCdfLogCauchy_ffv_126;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_127> AgradCdfLogCauchy_ffv_127;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_128> AgradCdfLogCauchy_ffv_128;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_129> AgradCdfLogCauchy_ffv_129;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_130> AgradCdfLogCauchy_ffv_130;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_131> AgradCdfLogCauchy_ffv_131;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_132> AgradCdfLogCauchy_ffv_132;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_133> AgradCdfLogCauchy_ffv_133;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_134> AgradCdfLogCauchy_ffv_134;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_135> AgradCdfLogCauchy_ffv_135;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_136> AgradCdfLogCauchy_ffv_136;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_137> AgradCdfLogCauchy_ffv_137;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_138> AgradCdfLogCauchy_ffv_138;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_139> AgradCdfLogCauchy_ffv_139;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_140> AgradCdfLogCauchy_ffv_140;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_141> AgradCdfLogCauchy_ffv_141;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_142> AgradCdfLogCauchy_ffv_142;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_143> AgradCdfLogCauchy_ffv_143;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_144> AgradCdfLogCauchy_ffv_144;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_145> AgradCdfLogCauchy_ffv_145;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_146> AgradCdfLogCauchy_ffv_146;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_147> AgradCdfLogCauchy_ffv_147;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_148> AgradCdfLogCauchy_ffv_148;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_149> AgradCdfLogCauchy_ffv_149;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_150> AgradCdfLogCauchy_ffv_150;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_151> AgradCdfLogCauchy_ffv_151;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_152> AgradCdfLogCauchy_ffv_152;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_153> AgradCdfLogCauchy_ffv_153;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_154> AgradCdfLogCauchy_ffv_154;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_155> AgradCdfLogCauchy_ffv_155;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_156> AgradCdfLogCauchy_ffv_156;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_157> AgradCdfLogCauchy_ffv_157;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_158> AgradCdfLogCauchy_ffv_158;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_159> AgradCdfLogCauchy_ffv_159;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_160> AgradCdfLogCauchy_ffv_160;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_161> AgradCdfLogCauchy_ffv_161;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_162> AgradCdfLogCauchy_ffv_162;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_163> AgradCdfLogCauchy_ffv_163;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_164> AgradCdfLogCauchy_ffv_164;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_165> AgradCdfLogCauchy_ffv_165;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_166> AgradCdfLogCauchy_ffv_166;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_167> AgradCdfLogCauchy_ffv_167;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_168> AgradCdfLogCauchy_ffv_168;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_169> AgradCdfLogCauchy_ffv_169;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_170> AgradCdfLogCauchy_ffv_170;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_171> AgradCdfLogCauchy_ffv_171;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_172> AgradCdfLogCauchy_ffv_172;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_173> AgradCdfLogCauchy_ffv_173;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_174> AgradCdfLogCauchy_ffv_174;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_175> AgradCdfLogCauchy_ffv_175;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_176> AgradCdfLogCauchy_ffv_176;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_177> AgradCdfLogCauchy_ffv_177;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_178> AgradCdfLogCauchy_ffv_178;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_179> AgradCdfLogCauchy_ffv_179;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_180> AgradCdfLogCauchy_ffv_180;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_181> AgradCdfLogCauchy_ffv_181;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_182> AgradCdfLogCauchy_ffv_182;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_183> AgradCdfLogCauchy_ffv_183;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_184> AgradCdfLogCauchy_ffv_184;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_185> AgradCdfLogCauchy_ffv_185;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_186> AgradCdfLogCauchy_ffv_186;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_187> AgradCdfLogCauchy_ffv_187;
+typedef std::tuple<AgradCdfLogCauchy, type_ffv_188> AgradCdfLogCauchy_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_100, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_101, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_102, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_103, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_104, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_105, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_106, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_107, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_108, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_109, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_110, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_111, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_112, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_113, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_114, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_115, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_116, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_117, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_118, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_119, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_120, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_121, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_122, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_123, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_124, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_125, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_126, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_127, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_128, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_129, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_130, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_131, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_132, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_133, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_134, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_135, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_136, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_137, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_138, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_139, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_140, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_141, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_142, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_143, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_144, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_145, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_146, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_147, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_148, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_149, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_150, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_151, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_152, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_153, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_154, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_155, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_156, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_157, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_158, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_159, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_160, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_161, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_162, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_163, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_164, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_165, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_166, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_167, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_168, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_169, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_170, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_171, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_172, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_173, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_174, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_175, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_176, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_177, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_178, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_179, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_180, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_181, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_182, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_183, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_184, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_185, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_186, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_187, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_ffv_188, AgradCdfLogTestFixture, AgradCdfLogCauchy_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogCauchy, type_v_100> AgradCdfLogCauchy_v_100;
+typedef std::tuple<AgradCdfLogCauchy, type_v_101> AgradCdfLogCauchy_v_101;
+typedef std::tuple<AgradCdfLogCauchy, type_v_102> AgradCdfLogCauchy_v_102;
+typedef std::tuple<AgradCdfLogCauchy, type_v_103> AgradCdfLogCauchy_v_103;
+typedef std::tuple<AgradCdfLogCauchy, type_v_104> AgradCdfLogCauchy_v_104;
+typedef std::tuple<AgradCdfLogCauchy, type_v_105> AgradCdfLogCauchy_v_105;
+typedef std::tuple<AgradCdfLogCauchy, type_v_106> AgradCdfLogCauchy_v_106;
+typedef std::tuple<AgradCdfLogCauchy, type_v_107> AgradCdfLogCauchy_v_107;
+typedef std::tuple<AgradCdfLogCauchy, type_v_108> AgradCdfLogCauchy_v_108;
+typedef std::tuple<AgradCdfLogCauchy, type_v_109> AgradCdfLogCauchy_v_109;
+typedef std::tuple<AgradCdfLogCauchy, type_v_110> AgradCdfLogCauchy_v_110;
+typedef std::tuple<AgradCdfLogCauchy, type_v_111> AgradCdfLogCauchy_v_111;
+typedef std::tuple<AgradCdfLogCauchy, type_v_112> AgradCdfLogCauchy_v_112;
+typedef std::tuple<AgradCdfLogCauchy, type_v_113> AgradCdfLogCauchy_v_113;
+typedef std::tuple<AgradCdfLogCauchy, type_v_114> AgradCdfLogCauchy_v_114;
+typedef std::tuple<AgradCdfLogCauchy, type_v_115> AgradCdfLogCauchy_v_115;
+typedef std::tuple<AgradCdfLogCauchy, type_v_116> AgradCdfLogCauchy_v_116;
+typedef std::tuple<AgradCdfLogCauchy, type_v_117> AgradCdfLogCauchy_v_117;
+typedef std::tuple<AgradCdfLogCauchy, type_v_118> AgradCdfLogCauchy_v_118;
+typedef std::tuple<AgradCdfLogCauchy, type_v_119> AgradCdfLogCauchy_v_119;
+typedef std::tuple<AgradCdfLogCauchy, type_v_120> AgradCdfLogCauchy_v_120;
+typedef std::tuple<AgradCdfLogCauchy, type_v_121> AgradCdfLogCauchy_v_121;
+typedef std::tuple<AgradCdfLogCauchy, type_v_122> AgradCdfLogCauchy_v_122;
+typedef std::tuple<AgradCdfLogCauchy, type_v_123> AgradCdfLogCauchy_v_123;
+typedef std::tuple<AgradCdfLogCauchy, type_v_124> AgradCdfLogCauchy_v_124;
+typedef std::tuple<AgradCdfLogCauchy, type_v_125> AgradCdfLogCauchy_v_125;
+typedef std::tuple<AgradCdfLogCauchy, type_v_126> AgradCdfLogCauchy_v_126;
+typedef std::tuple<AgradCdfLogCauchy, type_v_127> AgradCdfLogCauchy_v_127;
+typedef std::tuple<AgradCdfLogCauchy, type_v_128> AgradCdfLogCauchy_v_128;
+typedef std::tuple<AgradCdfLogCauchy, type_v_129> AgradCdfLogCauchy_v_129;
+typedef std::tuple<AgradCdfLogCauchy, type_v_130> AgradCdfLogCauchy_v_130;
+typedef std::tuple<AgradCdfLogCauchy, type_v_131> AgradCdfLogCauchy_v_131;
+typedef std::tuple<AgradCdfLogCauchy, type_v_132> AgradCdfLogCauchy_v_132;
+typedef std::tuple<AgradCdfLogCauchy, type_v_133> AgradCdfLogCauchy_v_133;
+typedef std::tuple<AgradCdfLogCauchy, type_v_134> AgradCdfLogCauchy_v_134;
+typedef std::tuple<AgradCdfLogCauchy, type_v_135> AgradCdfLogCauchy_v_135;
+typedef std::tuple<AgradCdfLogCauchy, type_v_136> AgradCdfLogCauchy_v_136;
+typedef std::tuple<AgradCdfLogCauchy, type_v_137> AgradCdfLogCauchy_v_137;
+typedef std::tuple<AgradCdfLogCauchy, type_v_138> AgradCdfLogCauchy_v_138;
+typedef std::tuple<AgradCdfLogCauchy, type_v_139> AgradCdfLogCauchy_v_139;
+typedef std::tuple<AgradCdfLogCauchy, type_v_140> AgradCdfLogCauchy_v_140;
+typedef std::tuple<AgradCdfLogCauchy, type_v_141> AgradCdfLogCauchy_v_141;
+typedef std::tuple<AgradCdfLogCauchy, type_v_142> AgradCdfLogCauchy_v_142;
+typedef std::tuple<AgradCdfLogCauchy, type_v_143> AgradCdfLogCauchy_v_143;
+typedef std::tuple<AgradCdfLogCauchy, type_v_144> AgradCdfLogCauchy_v_144;
+typedef std::tuple<AgradCdfLogCauchy, type_v_145> AgradCdfLogCauchy_v_145;
+typedef std::tuple<AgradCdfLogCauchy, type_v_146> AgradCdfLogCauchy_v_146;
+typedef std::tuple<AgradCdfLogCauchy, type_v_147> AgradCdfLogCauchy_v_147;
+typedef std::tuple<AgradCdfLogCauchy, type_v_148> AgradCdfLogCauchy_v_148;
+typedef std::tuple<AgradCdfLogCauchy, type_v_149> AgradCdfLogCauchy_v_149;
+typedef std::tuple<AgradCdfLogCauchy, type_v_150> AgradCdfLogCauchy_v_150;
+typedef std::tuple<AgradCdfLogCauchy, type_v_151> AgradCdfLogCauchy_v_151;
+typedef std::tuple<AgradCdfLogCauchy, type_v_152> AgradCdfLogCauchy_v_152;
+typedef std::tuple<AgradCdfLogCauchy, type_v_153> AgradCdfLogCauchy_v_153;
+typedef std::tuple<AgradCdfLogCauchy, type_v_154> AgradCdfLogCauchy_v_154;
+typedef std::tuple<AgradCdfLogCauchy, type_v_155> AgradCdfLogCauchy_v_155;
+typedef std::tuple<AgradCdfLogCauchy, type_v_156> AgradCdfLogCauchy_v_156;
+typedef std::tuple<AgradCdfLogCauchy, type_v_157> AgradCdfLogCauchy_v_157;
+typedef std::tuple<AgradCdfLogCauchy, type_v_158> AgradCdfLogCauchy_v_158;
+typedef std::tuple<AgradCdfLogCauchy, type_v_159> AgradCdfLogCauchy_v_159;
+typedef std::tuple<AgradCdfLogCauchy, type_v_160> AgradCdfLogCauchy_v_160;
+typedef std::tuple<AgradCdfLogCauchy, type_v_161> AgradCdfLogCauchy_v_161;
+typedef std::tuple<AgradCdfLogCauchy, type_v_162> AgradCdfLogCauchy_v_162;
+typedef std::tuple<AgradCdfLogCauchy, type_v_163> AgradCdfLogCauchy_v_163;
+typedef std::tuple<AgradCdfLogCauchy, type_v_164> AgradCdfLogCauchy_v_164;
+typedef std::tuple<AgradCdfLogCauchy, type_v_165> AgradCdfLogCauchy_v_165;
+typedef std::tuple<AgradCdfLogCauchy, type_v_166> AgradCdfLogCauchy_v_166;
+typedef std::tuple<AgradCdfLogCauchy, type_v_167> AgradCdfLogCauchy_v_167;
+typedef std::tuple<AgradCdfLogCauchy, type_v_168> AgradCdfLogCauchy_v_168;
+typedef std::tuple<AgradCdfLogCauchy, type_v_169> AgradCdfLogCauchy_v_169;
+typedef std::tuple<AgradCdfLogCauchy, type_v_170> AgradCdfLogCauchy_v_170;
+typedef std::tuple<AgradCdfLogCauchy, type_v_171> AgradCdfLogCauchy_v_171;
+typedef std::tuple<AgradCdfLogCauchy, type_v_172> AgradCdfLogCauchy_v_172;
+typedef std::tuple<AgradCdfLogCauchy, type_v_173> AgradCdfLogCauchy_v_173;
+typedef std::tuple<AgradCdfLogCauchy, type_v_174> AgradCdfLogCauchy_v_174;
+typedef std::tuple<AgradCdfLogCauchy, type_v_175> AgradCdfLogCauchy_v_175;
+typedef std::tuple<AgradCdfLogCauchy, type_v_176> AgradCdfLogCauchy_v_176;
+typedef std::tuple<AgradCdfLogCauchy, type_v_177> AgradCdfLogCauchy_v_177;
+typedef std::tuple<AgradCdfLogCauchy, type_v_178> AgradCdfLogCauchy_v_178;
+typedef std::tuple<AgradCdfLogCauchy, type_v_179> AgradCdfLogCauchy_v_179;
+typedef std::tuple<AgradCdfLogCauchy, type_v_180> AgradCdfLogCauchy_v_180;
+typedef std::tuple<AgradCdfLogCauchy, type_v_181> AgradCdfLogCauchy_v_181;
+typedef std::tuple<AgradCdfLogCauchy, type_v_182> AgradCdfLogCauchy_v_182;
+typedef std::tuple<AgradCdfLogCauchy, type_v_183> AgradCdfLogCauchy_v_183;
+typedef std::tuple<AgradCdfLogCauchy, type_v_184> AgradCdfLogCauchy_v_184;
+typedef std::tuple<AgradCdfLogCauchy, type_v_185> AgradCdfLogCauchy_v_185;
+typedef std::tuple<AgradCdfLogCauchy, type_v_186> AgradCdfLogCauchy_v_186;
+typedef std::tuple<AgradCdfLogCauchy, type_v_187> AgradCdfLogCauchy_v_187;
+typedef std::tuple<AgradCdfLogCauchy, type_v_188> AgradCdfLogCauchy_v_188;
+typedef std::tuple<AgradCdfLogCauchy, type_v_189> AgradCdfLogCauchy_v_189;
+typedef std::tuple<AgradCdfLogCauchy, type_v_190> AgradCdfLogCauchy_v_190;
+typedef std::tuple<AgradCdfLogCauchy, type_v_191> AgradCdfLogCauchy_v_191;
+typedef std::tuple<AgradCdfLogCauchy, type_v_192> AgradCdfLogCauchy_v_192;
+typedef std::tuple<AgradCdfLogCauchy, type_v_193> AgradCdfLogCauchy_v_193;
+typedef std::tuple<AgradCdfLogCauchy, type_v_194> AgradCdfLogCauchy_v_194;
+typedef std::tuple<AgradCdfLogCauchy, type_v_195> AgradCdfLogCauchy_v_195;
+typedef std::tuple<AgradCdfLogCauchy, type_v_196> AgradCdfLogCauchy_v_196;
+typedef std::tuple<AgradCdfLogCauchy, type_v_197> AgradCdfLogCauchy_v_197;
+typedef std::tuple<AgradCdfLogCauchy, type_v_198> AgradCdfLogCauchy_v_198;
+typedef std::tuple<AgradCdfLogCauchy, type_v_199> AgradCdfLogCauchy_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_100, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_101, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_102, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_103, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_104, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_105, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_106, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_107, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_108, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_109, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_110, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_111, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_112, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_113, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_114, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_115, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_116, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_117, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_118, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_119, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_120, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_121, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_122, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_123, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_124, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_125, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_126, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_127, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_128, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_129, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_130, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_131, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_132, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_133, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_134, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_135, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_136, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_137, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_138, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_139, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_140, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_141, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_142, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_143, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_144, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_145, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_146, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_147, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_148, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_149, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_150, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_151, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_152, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_153, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_154, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_155, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_156, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_157, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_158, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_159, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_160, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_161, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_162, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_163, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_164, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_165, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_166, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_167, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_168, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_169, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_170, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_171, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_172, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_173, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_174, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_175, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_176, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_177, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_178, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_179, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_180, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_181, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_182, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_183, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_184, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_185, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_186, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_187, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_188, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_189, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_190, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_191, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_192, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_193, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_194, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_195, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_196, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_197, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_198, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_199, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_199);
+
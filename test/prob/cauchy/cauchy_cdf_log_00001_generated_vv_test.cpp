@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogCauchy, type_vv_100> AgradCdfLogCauchy_vv_100;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_101> AgradCdfLogCauchy_vv_101;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_102> AgradCdfLogCauchy_vv_102;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_103> AgradCdfLogCauchy_vv_103;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_104> AgradCdfLogCauchy_vv_104;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_105> AgradCdfLogCauchy_vv_105;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_106> AgradCdfLogCauchy_vv_106;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_107> AgradCdfLogCauchy_vv_107;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_108> AgradCdfLogCauchy_vv_108;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_109> AgradCdfLogCauchy_vv_109;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_110> AgradCdfLogCauchy_vv_110;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_111> AgradCdfLogCauchy_vv_111;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_112> AgradCdfLogCauchy_vv_112;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_113> AgradCdfLogCauchy_vv_113;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_114> AgradCdfLogCauchy_vv_114;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_115> AgradCdfLogCauchy_vv_115;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_116> AgradCdfLogCauchy_vv_116;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_117> AgradCdfLogCauchy_vv_117;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_118> AgradCdfLogCauchy_vv_118;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_119> AgradCdfLogCauchy_vv_119;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_120> AgradCdfLogCauchy_vv_120;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_121> AgradCdfLogCauchy_vv_121;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_122> AgradCdfLogCauchy_vv_122;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_123> AgradCdfLogCauchy_vv_123;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_124> AgradCdfLogCauchy_vv_124;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_125> AgradCdfLogCauchy_vv_125;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_126> AgradCdfLogCauchy_vv_126;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_127> AgradCdfLogCauchy_vv_127;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_128> AgradCdfLogCauchy_vv_128;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_129> AgradCdfLogCauchy_vv_129;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_130> AgradCdfLogCauchy_vv_130;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_131> AgradCdfLogCauchy_vv_131;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_132> AgradCdfLogCauchy_vv_132;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_133> AgradCdfLogCauchy_vv_133;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_134> AgradCdfLogCauchy_vv_134;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_135> AgradCdfLogCauchy_vv_135;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_136> AgradCdfLogCauchy_vv_136;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_137> AgradCdfLogCauchy_vv_137;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_138> AgradCdfLogCauchy_vv_138;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_139> AgradCdfLogCauchy_vv_139;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_140> AgradCdfLogCauchy_vv_140;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_141> AgradCdfLogCauchy_vv_141;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_142> AgradCdfLogCauchy_vv_142;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_143> AgradCdfLogCauchy_vv_143;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_144> AgradCdfLogCauchy_vv_144;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_145> AgradCdfLogCauchy_vv_145;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_146> AgradCdfLogCauchy_vv_146;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_147> AgradCdfLogCauchy_vv_147;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_148> AgradCdfLogCauchy_vv_148;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_149> AgradCdfLogCauchy_vv_149;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_150> AgradCdfLogCauchy_vv_150;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_151> AgradCdfLogCauchy_vv_151;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_152> AgradCdfLogCauchy_vv_152;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_153> AgradCdfLogCauchy_vv_153;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_154> AgradCdfLogCauchy_vv_154;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_155> AgradCdfLogCauchy_vv_155;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_156> AgradCdfLogCauchy_vv_156;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_157> AgradCdfLogCauchy_vv_157;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_158> AgradCdfLogCauchy_vv_158;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_159> AgradCdfLogCauchy_vv_159;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_160> AgradCdfLogCauchy_vv_160;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_161> AgradCdfLogCauchy_vv_161;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_162> AgradCdfLogCauchy_vv_162;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_163> AgradCdfLogCauchy_vv_163;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_164> AgradCdfLogCauchy_vv_164;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_165> AgradCdfLogCauchy_vv_165;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_166> AgradCdfLogCauchy_vv_166;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_167> AgradCdfLogCauchy_vv_167;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_168> AgradCdfLogCauchy_vv_168;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_169> AgradCdfLogCauchy_vv_169;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_170> AgradCdfLogCauchy_vv_170;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_171> AgradCdfLogCauchy_vv_171;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_172> AgradCdfLogCauchy_vv_172;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_173> AgradCdfLogCauchy_vv_173;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_174> AgradCdfLogCauchy_vv_174;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_175> AgradCdfLogCauchy_vv_175;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_176> AgradCdfLogCauchy_vv_176;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_177> AgradCdfLogCauchy_vv_177;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_178> AgradCdfLogCauchy_vv_178;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_179> AgradCdfLogCauchy_vv_179;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_180> AgradCdfLogCauchy_vv_180;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_181> AgradCdfLogCauchy_vv_181;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_182> AgradCdfLogCauchy_vv_182;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_183> AgradCdfLogCauchy_vv_183;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_184> AgradCdfLogCauchy_vv_184;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_185> AgradCdfLogCauchy_vv_185;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_186> AgradCdfLogCauchy_vv_186;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_187> AgradCdfLogCauchy_vv_187;
+typedef std::tuple<AgradCdfLogCauchy, type_vv_188> AgradCdfLogCauchy_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_100, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_101, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_102, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_103, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_104, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_105, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_106, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_107, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_108, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_109, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_110, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_111, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_112, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_113, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_114, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_115, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_116, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_117, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_118, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_119, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_120, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_121, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_122, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_123, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_124, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_125, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_126, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_127, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_128, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_129, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_130, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_131, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_132, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_133, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_134, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_135, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_136, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_137, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_138, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_139, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_140, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_141, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_142, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_143, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_144, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_145, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_146, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_147, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_148, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_149, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_150, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_151, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_152, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_153, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_154, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_155, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_156, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_157, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_158, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_159, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_160, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_161, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_162, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_163, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_164, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_165, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_166, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_167, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_168, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_169, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_170, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_171, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_172, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_173, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_174, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_175, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_176, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_177, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_178, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_179, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_180, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_181, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_182, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_183, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_184, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_185, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_186, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_187, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_vv_188, AgradCdfLogTestFixture, AgradCdfLogCauchy_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/cauchy/cauchy_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCdfLogCauchy, type_v_200> AgradCdfLogCauchy_v_200;
+typedef std::tuple<AgradCdfLogCauchy, type_v_201> AgradCdfLogCauchy_v_201;
+typedef std::tuple<AgradCdfLogCauchy, type_v_202> AgradCdfLogCauchy_v_202;
+typedef std::tuple<AgradCdfLogCauchy, type_v_203> AgradCdfLogCauchy_v_203;
+typedef std::tuple<AgradCdfLogCauchy, type_v_204> AgradCdfLogCauchy_v_204;
+typedef std::tuple<AgradCdfLogCauchy, type_v_205> AgradCdfLogCauchy_v_205;
+typedef std::tuple<AgradCdfLogCauchy, type_v_206> AgradCdfLogCauchy_v_206;
+typedef std::tuple<AgradCdfLogCauchy, type_v_207> AgradCdfLogCauchy_v_207;
+typedef std::tuple<AgradCdfLogCauchy, type_v_208> AgradCdfLogCauchy_v_208;
+typedef std::tuple<AgradCdfLogCauchy, type_v_209> AgradCdfLogCauchy_v_209;
+typedef std::tuple<AgradCdfLogCauchy, type_v_210> AgradCdfLogCauchy_v_210;
+typedef std::tuple<AgradCdfLogCauchy, type_v_211> AgradCdfLogCauchy_v_211;
+typedef std::tuple<AgradCdfLogCauchy, type_v_212> AgradCdfLogCauchy_v_212;
+typedef std::tuple<AgradCdfLogCauchy, type_v_213> AgradCdfLogCauchy_v_213;
+typedef std::tuple<AgradCdfLogCauchy, type_v_214> AgradCdfLogCauchy_v_214;
+typedef std::tuple<AgradCdfLogCauchy, type_v_215> AgradCdfLogCauchy_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_200, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_201, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_202, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_203, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_204, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_205, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_206, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_207, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_208, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_209, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_210, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_211, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_212, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_213, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_214, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogCauchy_v_215, AgradCdfLogTestFixture, AgradCdfLogCauchy_v_215);
+
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/chi_square/chi_square_test.hpp>
+
+typedef std::tuple<double, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<double, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<double, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<double>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<double>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_v_18;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_v_19;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_20;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_v_21;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_v_22;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_29;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_30;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_31;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_32;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_33;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_34;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_35;
+
+typedef std::tuple<AgradDistributionsChiSquare, type_v_0> AgradDistributionsChiSquare_v_0;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_1> AgradDistributionsChiSquare_v_1;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_2> AgradDistributionsChiSquare_v_2;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_3> AgradDistributionsChiSquare_v_3;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_4> AgradDistributionsChiSquare_v_4;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_5> AgradDistributionsChiSquare_v_5;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_6> AgradDistributionsChiSquare_v_6;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_7> AgradDistributionsChiSquare_v_7;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_8> AgradDistributionsChiSquare_v_8;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_9> AgradDistributionsChiSquare_v_9;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_10> AgradDistributionsChiSquare_v_10;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_11> AgradDistributionsChiSquare_v_11;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_12> AgradDistributionsChiSquare_v_12;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_13> AgradDistributionsChiSquare_v_13;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_14> AgradDistributionsChiSquare_v_14;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_15> AgradDistributionsChiSquare_v_15;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_16> AgradDistributionsChiSquare_v_16;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_17> AgradDistributionsChiSquare_v_17;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_18> AgradDistributionsChiSquare_v_18;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_19> AgradDistributionsChiSquare_v_19;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_20> AgradDistributionsChiSquare_v_20;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_21> AgradDistributionsChiSquare_v_21;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_22> AgradDistributionsChiSquare_v_22;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_23> AgradDistributionsChiSquare_v_23;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_24> AgradDistributionsChiSquare_v_24;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_25> AgradDistributionsChiSquare_v_25;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_26> AgradDistributionsChiSquare_v_26;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_27> AgradDistributionsChiSquare_v_27;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_28> AgradDistributionsChiSquare_v_28;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_29> AgradDistributionsChiSquare_v_29;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_30> AgradDistributionsChiSquare_v_30;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_31> AgradDistributionsChiSquare_v_31;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_32> AgradDistributionsChiSquare_v_32;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_33> AgradDistributionsChiSquare_v_33;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_34> AgradDistributionsChiSquare_v_34;
+typedef std::tuple<AgradDistributionsChiSquare, type_v_35> AgradDistributionsChiSquare_v_35;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_0, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_1, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_2, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_3, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_4, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_5, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_6, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_7, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_8, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_9, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_10, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_11, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_12, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_13, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_14, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_15, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_16, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_17, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_18, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_19, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_20, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_21, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_22, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_23, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_24, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_25, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_26, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_27, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_28, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_29, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_30, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_31, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_32, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_33, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_34, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsChiSquare_v_35, AgradDistributionTestFixture, AgradDistributionsChiSquare_v_35);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/chi_square/chi_square_ccdf_log_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_2;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_3;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_4;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_8;
+typedef std::tuple<fvar<fvar<var> >, double, empty, empty, empty, empty> type_ffv_9;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, empty, empty, empty, empty> type_ffv_10;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_11;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_12;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_13;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, empty, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_17;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_18;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_19;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_0> AgradCcdfLogChiSquare_ffv_0;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_1> AgradCcdfLogChiSquare_ffv_1;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_2> AgradCcdfLogChiSquare_ffv_2;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_3> AgradCcdfLogChiSquare_ffv_3;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_4> AgradCcdfLogChiSquare_ffv_4;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_5> AgradCcdfLogChiSquare_ffv_5;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_6> AgradCcdfLogChiSquare_ffv_6;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_7> AgradCcdfLogChiSquare_ffv_7;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_8> AgradCcdfLogChiSquare_ffv_8;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_9> AgradCcdfLogChiSquare_ffv_9;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_10> AgradCcdfLogChiSquare_ffv_10;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_11> AgradCcdfLogChiSquare_ffv_11;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_12> AgradCcdfLogChiSquare_ffv_12;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_13> AgradCcdfLogChiSquare_ffv_13;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_14> AgradCcdfLogChiSquare_ffv_14;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_15> AgradCcdfLogChiSquare_ffv_15;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_16> AgradCcdfLogChiSquare_ffv_16;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_17> AgradCcdfLogChiSquare_ffv_17;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_18> AgradCcdfLogChiSquare_ffv_18;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_19> AgradCcdfLogChiSquare_ffv_19;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_20> AgradCcdfLogChiSquare_ffv_20;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_21> AgradCcdfLogChiSquare_ffv_21;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_22> AgradCcdfLogChiSquare_ffv_22;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_23> AgradCcdfLogChiSquare_ffv_23;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_24> AgradCcdfLogChiSquare_ffv_24;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_25> AgradCcdfLogChiSquare_ffv_25;
+typedef std::tuple<AgradCcdfLogChiSquare, type_ffv_26> AgradCcdfLogChiSquare_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogChiSquare_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogChiSquare_ffv_26);
+
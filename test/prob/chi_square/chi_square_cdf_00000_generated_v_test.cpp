@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/chi_square/chi_square_cdf_test.hpp>
+
+typedef std::tuple<double, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<double, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<double, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<double>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<double>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_v_18;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_v_19;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_20;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_v_21;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_v_22;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_29;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_30;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_31;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_32;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_33;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_34;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_35;
+
+typedef std::tuple<AgradCdfChiSquare, type_v_0> AgradCdfChiSquare_v_0;
+typedef std::tuple<AgradCdfChiSquare, type_v_1> AgradCdfChiSquare_v_1;
+typedef std::tuple<AgradCdfChiSquare, type_v_2> AgradCdfChiSquare_v_2;
+typedef std::tuple<AgradCdfChiSquare, type_v_3> AgradCdfChiSquare_v_3;
+typedef std::tuple<AgradCdfChiSquare, type_v_4> AgradCdfChiSquare_v_4;
+typedef std::tuple<AgradCdfChiSquare, type_v_5> AgradCdfChiSquare_v_5;
+typedef std::tuple<AgradCdfChiSquare, type_v_6> AgradCdfChiSquare_v_6;
+typedef std::tuple<AgradCdfChiSquare, type_v_7> AgradCdfChiSquare_v_7;
+typedef std::tuple<AgradCdfChiSquare, type_v_8> AgradCdfChiSquare_v_8;
+typedef std::tuple<AgradCdfChiSquare, type_v_9> AgradCdfChiSquare_v_9;
+typedef std::tuple<AgradCdfChiSquare, type_v_10> AgradCdfChiSquare_v_10;
+typedef std::tuple<AgradCdfChiSquare, type_v_11> AgradCdfChiSquare_v_11;
+typedef std::tuple<AgradCdfChiSquare, type_v_12> AgradCdfChiSquare_v_12;
+typedef std::tuple<AgradCdfChiSquare, type_v_13> AgradCdfChiSquare_v_13;
+typedef std::tuple<AgradCdfChiSquare, type_v_14> AgradCdfChiSquare_v_14;
+typedef std::tuple<AgradCdfChiSquare, type_v_15> AgradCdfChiSquare_v_15;
+typedef std::tuple<AgradCdfChiSquare, type_v_16> AgradCdfChiSquare_v_16;
+typedef std::tuple<AgradCdfChiSquare, type_v_17> AgradCdfChiSquare_v_17;
+typedef std::tuple<AgradCdfChiSquare, type_v_18> AgradCdfChiSquare_v_18;
+typedef std::tuple<AgradCdfChiSquare, type_v_19> AgradCdfChiSquare_v_19;
+typedef std::tuple<AgradCdfChiSquare, type_v_20> AgradCdfChiSquare_v_20;
+typedef std::tuple<AgradCdfChiSquare, type_v_21> AgradCdfChiSquare_v_21;
+typedef std::tuple<AgradCdfChiSquare, type_v_22> AgradCdfChiSquare_v_22;
+typedef std::tuple<AgradCdfChiSquare, type_v_23> AgradCdfChiSquare_v_23;
+typedef std::tuple<AgradCdfChiSquare, type_v_24> AgradCdfChiSquare_v_24;
+typedef std::tuple<AgradCdfChiSquare, type_v_25> AgradCdfChiSquare_v_25;
+typedef std::tuple<AgradCdfChiSquare, type_v_26> AgradCdfChiSquare_v_26;
+typedef std::tuple<AgradCdfChiSquare, type_v_27> AgradCdfChiSquare_v_27;
+typedef std::tuple<AgradCdfChiSquare, type_v_28> AgradCdfChiSquare_v_28;
+typedef std::tuple<AgradCdfChiSquare, type_v_29> AgradCdfChiSquare_v_29;
+typedef std::tuple<AgradCdfChiSquare, type_v_30> AgradCdfChiSquare_v_30;
+typedef std::tuple<AgradCdfChiSquare, type_v_31> AgradCdfChiSquare_v_31;
+typedef std::tuple<AgradCdfChiSquare, type_v_32> AgradCdfChiSquare_v_32;
+typedef std::tuple<AgradCdfChiSquare, type_v_33> AgradCdfChiSquare_v_33;
+typedef std::tuple<AgradCdfChiSquare, type_v_34> AgradCdfChiSquare_v_34;
+typedef std::tuple<AgradCdfChiSquare, type_v_35> AgradCdfChiSquare_v_35;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_0, AgradCdfTestFixture, AgradCdfChiSquare_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_1, AgradCdfTestFixture, AgradCdfChiSquare_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_2, AgradCdfTestFixture, AgradCdfChiSquare_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_3, AgradCdfTestFixture, AgradCdfChiSquare_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_4, AgradCdfTestFixture, AgradCdfChiSquare_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_5, AgradCdfTestFixture, AgradCdfChiSquare_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_6, AgradCdfTestFixture, AgradCdfChiSquare_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_7, AgradCdfTestFixture, AgradCdfChiSquare_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_8, AgradCdfTestFixture, AgradCdfChiSquare_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_9, AgradCdfTestFixture, AgradCdfChiSquare_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_10, AgradCdfTestFixture, AgradCdfChiSquare_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_11, AgradCdfTestFixture, AgradCdfChiSquare_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_12, AgradCdfTestFixture, AgradCdfChiSquare_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_13, AgradCdfTestFixture, AgradCdfChiSquare_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_14, AgradCdfTestFixture, AgradCdfChiSquare_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_15, AgradCdfTestFixture, AgradCdfChiSquare_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_16, AgradCdfTestFixture, AgradCdfChiSquare_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_17, AgradCdfTestFixture, AgradCdfChiSquare_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_18, AgradCdfTestFixture, AgradCdfChiSquare_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_19, AgradCdfTestFixture, AgradCdfChiSquare_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_20, AgradCdfTestFixture, AgradCdfChiSquare_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_21, AgradCdfTestFixture, AgradCdfChiSquare_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_22, AgradCdfTestFixture, AgradCdfChiSquare_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_23, AgradCdfTestFixture, AgradCdfChiSquare_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_24, AgradCdfTestFixture, AgradCdfChiSquare_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_25, AgradCdfTestFixture, AgradCdfChiSquare_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_26, AgradCdfTestFixture, AgradCdfChiSquare_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_27, AgradCdfTestFixture, AgradCdfChiSquare_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_28, AgradCdfTestFixture, AgradCdfChiSquare_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_29, AgradCdfTestFixture, AgradCdfChiSquare_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_30, AgradCdfTestFixture, AgradCdfChiSquare_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_31, AgradCdfTestFixture, AgradCdfChiSquare_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_32, AgradCdfTestFixture, AgradCdfChiSquare_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_33, AgradCdfTestFixture, AgradCdfChiSquare_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_34, AgradCdfTestFixture, AgradCdfChiSquare_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_v_35, AgradCdfTestFixture, AgradCdfChiSquare_v_35);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/chi_square/chi_square_cdf_test.hpp>
+
+typedef std::tuple<double, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_vv_9;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_vv_10;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_11;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_vv_12;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_vv_13;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_17;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_vv_18;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_vv_19;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_20;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty, empty> type_vv_21;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty, empty> type_vv_22;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_23;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty, empty> type_vv_24;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty, empty> type_vv_25;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCdfChiSquare, type_vv_0> AgradCdfChiSquare_vv_0;
+typedef std::tuple<AgradCdfChiSquare, type_vv_1> AgradCdfChiSquare_vv_1;
+typedef std::tuple<AgradCdfChiSquare, type_vv_2> AgradCdfChiSquare_vv_2;
+typedef std::tuple<AgradCdfChiSquare, type_vv_3> AgradCdfChiSquare_vv_3;
+typedef std::tuple<AgradCdfChiSquare, type_vv_4> AgradCdfChiSquare_vv_4;
+typedef std::tuple<AgradCdfChiSquare, type_vv_5> AgradCdfChiSquare_vv_5;
+typedef std::tuple<AgradCdfChiSquare, type_vv_6> AgradCdfChiSquare_vv_6;
+typedef std::tuple<AgradCdfChiSquare, type_vv_7> AgradCdfChiSquare_vv_7;
+typedef std::tuple<AgradCdfChiSquare, type_vv_8> AgradCdfChiSquare_vv_8;
+typedef std::tuple<AgradCdfChiSquare, type_vv_9> AgradCdfChiSquare_vv_9;
+typedef std::tuple<AgradCdfChiSquare, type_vv_10> AgradCdfChiSquare_vv_10;
+typedef std::tuple<AgradCdfChiSquare, type_vv_11> AgradCdfChiSquare_vv_11;
+typedef std::tuple<AgradCdfChiSquare, type_vv_12> AgradCdfChiSquare_vv_12;
+typedef std::tuple<AgradCdfChiSquare, type_vv_13> AgradCdfChiSquare_vv_13;
+typedef std::tuple<AgradCdfChiSquare, type_vv_14> AgradCdfChiSquare_vv_14;
+typedef std::tuple<AgradCdfChiSquare, type_vv_15> AgradCdfChiSquare_vv_15;
+typedef std::tuple<AgradCdfChiSquare, type_vv_16> AgradCdfChiSquare_vv_16;
+typedef std::tuple<AgradCdfChiSquare, type_vv_17> AgradCdfChiSquare_vv_17;
+typedef std::tuple<AgradCdfChiSquare, type_vv_18> AgradCdfChiSquare_vv_18;
+typedef std::tuple<AgradCdfChiSquare, type_vv_19> AgradCdfChiSquare_vv_19;
+typedef std::tuple<AgradCdfChiSquare, type_vv_20> AgradCdfChiSquare_vv_20;
+typedef std::tuple<AgradCdfChiSquare, type_vv_21> AgradCdfChiSquare_vv_21;
+typedef std::tuple<AgradCdfChiSquare, type_vv_22> AgradCdfChiSquare_vv_22;
+typedef std::tuple<AgradCdfChiSquare, type_vv_23> AgradCdfChiSquare_vv_23;
+typedef std::tuple<AgradCdfChiSquare, type_vv_24> AgradCdfChiSquare_vv_24;
+typedef std::tuple<AgradCdfChiSquare, type_vv_25> AgradCdfChiSquare_vv_25;
+typedef std::tuple<AgradCdfChiSquare, type_vv_26> AgradCdfChiSquare_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_0, AgradCdfTestFixture, AgradCdfChiSquare_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_1, AgradCdfTestFixture, AgradCdfChiSquare_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_2, AgradCdfTestFixture, AgradCdfChiSquare_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_3, AgradCdfTestFixture, AgradCdfChiSquare_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_4, AgradCdfTestFixture, AgradCdfChiSquare_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_5, AgradCdfTestFixture, AgradCdfChiSquare_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_6, AgradCdfTestFixture, AgradCdfChiSquare_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_7, AgradCdfTestFixture, AgradCdfChiSquare_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_8, AgradCdfTestFixture, AgradCdfChiSquare_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_9, AgradCdfTestFixture, AgradCdfChiSquare_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_10, AgradCdfTestFixture, AgradCdfChiSquare_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_11, AgradCdfTestFixture, AgradCdfChiSquare_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_12, AgradCdfTestFixture, AgradCdfChiSquare_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_13, AgradCdfTestFixture, AgradCdfChiSquare_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_14, AgradCdfTestFixture, AgradCdfChiSquare_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_15, AgradCdfTestFixture, AgradCdfChiSquare_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_16, AgradCdfTestFixture, AgradCdfChiSquare_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_17, AgradCdfTestFixture, AgradCdfChiSquare_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_18, AgradCdfTestFixture, AgradCdfChiSquare_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_19, AgradCdfTestFixture, AgradCdfChiSquare_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_20, AgradCdfTestFixture, AgradCdfChiSquare_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_21, AgradCdfTestFixture, AgradCdfChiSquare_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_22, AgradCdfTestFixture, AgradCdfChiSquare_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_23, AgradCdfTestFixture, AgradCdfChiSquare_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_24, AgradCdfTestFixture, AgradCdfChiSquare_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_25, AgradCdfTestFixture, AgradCdfChiSquare_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfChiSquare_vv_26, AgradCdfTestFixture, AgradCdfChiSquare_vv_26);
+
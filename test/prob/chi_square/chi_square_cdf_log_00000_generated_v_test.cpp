@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/chi_square/chi_square_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<double, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<double, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<double>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<double>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_v_18;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_v_19;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_20;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_v_21;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_v_22;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_29;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_30;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_31;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_32;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_33;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_34;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_35;
+
+typedef std::tuple<AgradCdfLogChiSquare, type_v_0> AgradCdfLogChiSquare_v_0;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_1> AgradCdfLogChiSquare_v_1;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_2> AgradCdfLogChiSquare_v_2;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_3> AgradCdfLogChiSquare_v_3;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_4> AgradCdfLogChiSquare_v_4;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_5> AgradCdfLogChiSquare_v_5;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_6> AgradCdfLogChiSquare_v_6;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_7> AgradCdfLogChiSquare_v_7;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_8> AgradCdfLogChiSquare_v_8;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_9> AgradCdfLogChiSquare_v_9;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_10> AgradCdfLogChiSquare_v_10;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_11> AgradCdfLogChiSquare_v_11;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_12> AgradCdfLogChiSquare_v_12;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_13> AgradCdfLogChiSquare_v_13;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_14> AgradCdfLogChiSquare_v_14;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_15> AgradCdfLogChiSquare_v_15;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_16> AgradCdfLogChiSquare_v_16;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_17> AgradCdfLogChiSquare_v_17;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_18> AgradCdfLogChiSquare_v_18;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_19> AgradCdfLogChiSquare_v_19;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_20> AgradCdfLogChiSquare_v_20;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_21> AgradCdfLogChiSquare_v_21;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_22> AgradCdfLogChiSquare_v_22;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_23> AgradCdfLogChiSquare_v_23;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_24> AgradCdfLogChiSquare_v_24;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_25> AgradCdfLogChiSquare_v_25;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_26> AgradCdfLogChiSquare_v_26;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_27> AgradCdfLogChiSquare_v_27;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_28> AgradCdfLogChiSquare_v_28;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_29> AgradCdfLogChiSquare_v_29;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_30> AgradCdfLogChiSquare_v_30;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_31> AgradCdfLogChiSquare_v_31;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_32> AgradCdfLogChiSquare_v_32;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_33> AgradCdfLogChiSquare_v_33;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_34> AgradCdfLogChiSquare_v_34;
+typedef std::tuple<AgradCdfLogChiSquare, type_v_35> AgradCdfLogChiSquare_v_35;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_0, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_1, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_2, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_3, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_4, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_5, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_6, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_7, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_8, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_9, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_10, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_11, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_12, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_13, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_14, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_15, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_16, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_17, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_18, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_19, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_20, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_21, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_22, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_23, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_24, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_25, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_26, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_27, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_28, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_29, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_30, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_31, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_32, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_33, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_34, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_v_35, AgradCdfLogTestFixture, AgradCdfLogChiSquare_v_35);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/chi_square/chi_square_cdf_log_test.hpp>
+
+typedef std::tuple<double, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_vv_9;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_vv_10;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_11;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_vv_12;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_vv_13;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_17;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_vv_18;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_vv_19;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_20;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty, empty> type_vv_21;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty, empty> type_vv_22;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_23;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty, empty> type_vv_24;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty, empty> type_vv_25;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_0> AgradCdfLogChiSquare_vv_0;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_1> AgradCdfLogChiSquare_vv_1;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_2> AgradCdfLogChiSquare_vv_2;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_3> AgradCdfLogChiSquare_vv_3;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_4> AgradCdfLogChiSquare_vv_4;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_5> AgradCdfLogChiSquare_vv_5;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_6> AgradCdfLogChiSquare_vv_6;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_7> AgradCdfLogChiSquare_vv_7;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_8> AgradCdfLogChiSquare_vv_8;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_9> AgradCdfLogChiSquare_vv_9;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_10> AgradCdfLogChiSquare_vv_10;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_11> AgradCdfLogChiSquare_vv_11;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_12> AgradCdfLogChiSquare_vv_12;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_13> AgradCdfLogChiSquare_vv_13;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_14> AgradCdfLogChiSquare_vv_14;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_15> AgradCdfLogChiSquare_vv_15;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_16> AgradCdfLogChiSquare_vv_16;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_17> AgradCdfLogChiSquare_vv_17;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_18> AgradCdfLogChiSquare_vv_18;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_19> AgradCdfLogChiSquare_vv_19;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_20> AgradCdfLogChiSquare_vv_20;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_21> AgradCdfLogChiSquare_vv_21;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_22> AgradCdfLogChiSquare_vv_22;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_23> AgradCdfLogChiSquare_vv_23;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_24> AgradCdfLogChiSquare_vv_24;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_25> AgradCdfLogChiSquare_vv_25;
+typedef std::tuple<AgradCdfLogChiSquare, type_vv_26> AgradCdfLogChiSquare_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_0, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_1, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_2, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_3, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_4, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_5, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_6, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_7, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_8, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_9, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_10, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_11, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_12, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_13, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_14, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_15, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_16, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_17, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_18, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_19, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_20, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_21, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_22, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_23, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_24, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_25, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogChiSquare_vv_26, AgradCdfLogTestFixture, AgradCdfLogChiSquare_vv_26);
+
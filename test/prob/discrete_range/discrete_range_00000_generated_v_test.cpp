@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/discrete_range/discrete_range_test.hpp>
+
+typedef std::tuple<int, int, int, empty, empty, empty> type_v_0;
+typedef std::tuple<int, int, std::vector<int>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, std::vector<int>, int, empty, empty, empty> type_v_3;
+typedef std::tuple<int, std::vector<int>, std::vector<int>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty, empty> type_v_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<int>, int, int, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<int>, int, std::vector<int>, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, int, empty, empty, empty> type_v_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<int>, empty, empty, empty> type_v_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty, empty> type_v_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty, empty> type_v_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, int, empty, empty, empty> type_v_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<int>, empty, empty, empty> type_v_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, int, empty, empty, empty> type_v_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<int>, empty, empty, empty> type_v_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty, empty> type_v_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty, empty> type_v_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_0> AgradDistributionsDiscreteRange_v_0;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_1> AgradDistributionsDiscreteRange_v_1;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_2> AgradDistributionsDiscreteRange_v_2;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_3> AgradDistributionsDiscreteRange_v_3;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_4> AgradDistributionsDiscreteRange_v_4;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_5> AgradDistributionsDiscreteRange_v_5;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_6> AgradDistributionsDiscreteRange_v_6;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_7> AgradDistributionsDiscreteRange_v_7;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_8> AgradDistributionsDiscreteRange_v_8;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_9> AgradDistributionsDiscreteRange_v_9;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_10> AgradDistributionsDiscreteRange_v_10;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_11> AgradDistributionsDiscreteRange_v_11;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_12> AgradDistributionsDiscreteRange_v_12;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_13> AgradDistributionsDiscreteRange_v_13;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_14> AgradDistributionsDiscreteRange_v_14;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_15> AgradDistributionsDiscreteRange_v_15;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_16> AgradDistributionsDiscreteRange_v_16;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_17> AgradDistributionsDiscreteRange_v_17;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_18> AgradDistributionsDiscreteRange_v_18;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_19> AgradDistributionsDiscreteRange_v_19;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_20> AgradDistributionsDiscreteRange_v_20;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_21> AgradDistributionsDiscreteRange_v_21;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_22> AgradDistributionsDiscreteRange_v_22;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_23> AgradDistributionsDiscreteRange_v_23;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_24> AgradDistributionsDiscreteRange_v_24;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_25> AgradDistributionsDiscreteRange_v_25;
+typedef std::tuple<AgradDistributionsDiscreteRange, type_v_26> AgradDistributionsDiscreteRange_v_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_0, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_1, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_2, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_3, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_4, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_5, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_6, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_7, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_8, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_9, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_10, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_11, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_12, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_13, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_14, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_15, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_16, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_17, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_18, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_19, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_20, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_21, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_22, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_23, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_24, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_25, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDiscreteRange_v_26, AgradDistributionTestFixture, AgradDistributionsDiscreteRange_v_26);
+
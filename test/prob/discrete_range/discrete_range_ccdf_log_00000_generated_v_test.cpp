@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/discrete_range/discrete_range_ccdf_log_test.hpp>
+
+typedef std::tuple<int, int, int, empty, empty, empty> type_v_0;
+typedef std::tuple<int, int, std::vector<int>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, std::vector<int>, int, empty, empty, empty> type_v_3;
+typedef std::tuple<int, std::vector<int>, std::vector<int>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty, empty> type_v_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<int>, int, int, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<int>, int, std::vector<int>, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, int, empty, empty, empty> type_v_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<int>, empty, empty, empty> type_v_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty, empty> type_v_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty, empty> type_v_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, int, empty, empty, empty> type_v_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<int>, empty, empty, empty> type_v_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, int, empty, empty, empty> type_v_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<int>, empty, empty, empty> type_v_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty, empty> type_v_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty, empty> type_v_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_0> AgradCcdfLogDiscreteRange_v_0;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_1> AgradCcdfLogDiscreteRange_v_1;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_2> AgradCcdfLogDiscreteRange_v_2;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_3> AgradCcdfLogDiscreteRange_v_3;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_4> AgradCcdfLogDiscreteRange_v_4;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_5> AgradCcdfLogDiscreteRange_v_5;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_6> AgradCcdfLogDiscreteRange_v_6;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_7> AgradCcdfLogDiscreteRange_v_7;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_8> AgradCcdfLogDiscreteRange_v_8;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_9> AgradCcdfLogDiscreteRange_v_9;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_10> AgradCcdfLogDiscreteRange_v_10;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_11> AgradCcdfLogDiscreteRange_v_11;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_12> AgradCcdfLogDiscreteRange_v_12;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_13> AgradCcdfLogDiscreteRange_v_13;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_14> AgradCcdfLogDiscreteRange_v_14;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_15> AgradCcdfLogDiscreteRange_v_15;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_16> AgradCcdfLogDiscreteRange_v_16;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_17> AgradCcdfLogDiscreteRange_v_17;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_18> AgradCcdfLogDiscreteRange_v_18;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_19> AgradCcdfLogDiscreteRange_v_19;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_20> AgradCcdfLogDiscreteRange_v_20;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_21> AgradCcdfLogDiscreteRange_v_21;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_22> AgradCcdfLogDiscreteRange_v_22;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_23> AgradCcdfLogDiscreteRange_v_23;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_24> AgradCcdfLogDiscreteRange_v_24;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_25> AgradCcdfLogDiscreteRange_v_25;
+typedef std::tuple<AgradCcdfLogDiscreteRange, type_v_26> AgradCcdfLogDiscreteRange_v_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_0, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_1, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_2, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_3, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_4, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_5, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_6, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_7, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_8, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_9, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_10, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_11, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_12, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_13, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_14, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_15, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_16, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_17, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_18, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_19, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_20, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_21, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_22, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_23, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_24, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_25, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDiscreteRange_v_26, AgradCcdfLogTestFixture, AgradCcdfLogDiscreteRange_v_26);
+
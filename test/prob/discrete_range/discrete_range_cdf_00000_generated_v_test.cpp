@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/discrete_range/discrete_range_cdf_test.hpp>
+
+typedef std::tuple<int, int, int, empty, empty, empty> type_v_0;
+typedef std::tuple<int, int, std::vector<int>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, std::vector<int>, int, empty, empty, empty> type_v_3;
+typedef std::tuple<int, std::vector<int>, std::vector<int>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty, empty> type_v_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<int>, int, int, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<int>, int, std::vector<int>, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, int, empty, empty, empty> type_v_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<int>, empty, empty, empty> type_v_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty, empty> type_v_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty, empty> type_v_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, int, empty, empty, empty> type_v_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<int>, empty, empty, empty> type_v_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, int, empty, empty, empty> type_v_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<int>, empty, empty, empty> type_v_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty, empty> type_v_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty, empty> type_v_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+
+typedef std::tuple<AgradCdfDiscreteRange, type_v_0> AgradCdfDiscreteRange_v_0;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_1> AgradCdfDiscreteRange_v_1;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_2> AgradCdfDiscreteRange_v_2;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_3> AgradCdfDiscreteRange_v_3;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_4> AgradCdfDiscreteRange_v_4;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_5> AgradCdfDiscreteRange_v_5;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_6> AgradCdfDiscreteRange_v_6;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_7> AgradCdfDiscreteRange_v_7;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_8> AgradCdfDiscreteRange_v_8;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_9> AgradCdfDiscreteRange_v_9;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_10> AgradCdfDiscreteRange_v_10;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_11> AgradCdfDiscreteRange_v_11;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_12> AgradCdfDiscreteRange_v_12;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_13> AgradCdfDiscreteRange_v_13;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_14> AgradCdfDiscreteRange_v_14;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_15> AgradCdfDiscreteRange_v_15;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_16> AgradCdfDiscreteRange_v_16;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_17> AgradCdfDiscreteRange_v_17;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_18> AgradCdfDiscreteRange_v_18;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_19> AgradCdfDiscreteRange_v_19;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_20> AgradCdfDiscreteRange_v_20;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_21> AgradCdfDiscreteRange_v_21;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_22> AgradCdfDiscreteRange_v_22;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_23> AgradCdfDiscreteRange_v_23;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_24> AgradCdfDiscreteRange_v_24;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_25> AgradCdfDiscreteRange_v_25;
+typedef std::tuple<AgradCdfDiscreteRange, type_v_26> AgradCdfDiscreteRange_v_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_0, AgradCdfTestFixture, AgradCdfDiscreteRange_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_1, AgradCdfTestFixture, AgradCdfDiscreteRange_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_2, AgradCdfTestFixture, AgradCdfDiscreteRange_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_3, AgradCdfTestFixture, AgradCdfDiscreteRange_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_4, AgradCdfTestFixture, AgradCdfDiscreteRange_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_5, AgradCdfTestFixture, AgradCdfDiscreteRange_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_6, AgradCdfTestFixture, AgradCdfDiscreteRange_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_7, AgradCdfTestFixture, AgradCdfDiscreteRange_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_8, AgradCdfTestFixture, AgradCdfDiscreteRange_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_9, AgradCdfTestFixture, AgradCdfDiscreteRange_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_10, AgradCdfTestFixture, AgradCdfDiscreteRange_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_11, AgradCdfTestFixture, AgradCdfDiscreteRange_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_12, AgradCdfTestFixture, AgradCdfDiscreteRange_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_13, AgradCdfTestFixture, AgradCdfDiscreteRange_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_14, AgradCdfTestFixture, AgradCdfDiscreteRange_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_15, AgradCdfTestFixture, AgradCdfDiscreteRange_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_16, AgradCdfTestFixture, AgradCdfDiscreteRange_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_17, AgradCdfTestFixture, AgradCdfDiscreteRange_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_18, AgradCdfTestFixture, AgradCdfDiscreteRange_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_19, AgradCdfTestFixture, AgradCdfDiscreteRange_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_20, AgradCdfTestFixture, AgradCdfDiscreteRange_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_21, AgradCdfTestFixture, AgradCdfDiscreteRange_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_22, AgradCdfTestFixture, AgradCdfDiscreteRange_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_23, AgradCdfTestFixture, AgradCdfDiscreteRange_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_24, AgradCdfTestFixture, AgradCdfDiscreteRange_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_25, AgradCdfTestFixture, AgradCdfDiscreteRange_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDiscreteRange_v_26, AgradCdfTestFixture, AgradCdfDiscreteRange_v_26);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/discrete_range/discrete_range_cdf_log_test.hpp>
+
+typedef std::tuple<int, int, int, empty, empty, empty> type_v_0;
+typedef std::tuple<int, int, std::vector<int>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, std::vector<int>, int, empty, empty, empty> type_v_3;
+typedef std::tuple<int, std::vector<int>, std::vector<int>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty, empty> type_v_6;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<int>, int, int, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<int>, int, std::vector<int>, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<std::vector<int>, std::vector<int>, int, empty, empty, empty> type_v_12;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<int>, empty, empty, empty> type_v_13;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty, empty> type_v_15;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty, empty> type_v_16;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, int, empty, empty, empty> type_v_18;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<int>, empty, empty, empty> type_v_19;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, int, empty, empty, empty> type_v_21;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<int>, empty, empty, empty> type_v_22;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty, empty> type_v_24;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty, empty> type_v_25;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_0> AgradCdfLogDiscreteRange_v_0;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_1> AgradCdfLogDiscreteRange_v_1;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_2> AgradCdfLogDiscreteRange_v_2;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_3> AgradCdfLogDiscreteRange_v_3;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_4> AgradCdfLogDiscreteRange_v_4;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_5> AgradCdfLogDiscreteRange_v_5;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_6> AgradCdfLogDiscreteRange_v_6;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_7> AgradCdfLogDiscreteRange_v_7;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_8> AgradCdfLogDiscreteRange_v_8;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_9> AgradCdfLogDiscreteRange_v_9;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_10> AgradCdfLogDiscreteRange_v_10;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_11> AgradCdfLogDiscreteRange_v_11;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_12> AgradCdfLogDiscreteRange_v_12;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_13> AgradCdfLogDiscreteRange_v_13;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_14> AgradCdfLogDiscreteRange_v_14;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_15> AgradCdfLogDiscreteRange_v_15;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_16> AgradCdfLogDiscreteRange_v_16;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_17> AgradCdfLogDiscreteRange_v_17;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_18> AgradCdfLogDiscreteRange_v_18;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_19> AgradCdfLogDiscreteRange_v_19;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_20> AgradCdfLogDiscreteRange_v_20;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_21> AgradCdfLogDiscreteRange_v_21;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_22> AgradCdfLogDiscreteRange_v_22;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_23> AgradCdfLogDiscreteRange_v_23;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_24> AgradCdfLogDiscreteRange_v_24;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_25> AgradCdfLogDiscreteRange_v_25;
+typedef std::tuple<AgradCdfLogDiscreteRange, type_v_26> AgradCdfLogDiscreteRange_v_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_0, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_1, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_2, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_3, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_4, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_5, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_6, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_7, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_8, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_9, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_10, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_11, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_12, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_13, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_14, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_15, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_16, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_17, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_18, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_19, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_20, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_21, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_22, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_23, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_24, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_25, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDiscreteRange_v_26, AgradCdfLogTestFixture, AgradCdfLogDiscreteRange_v_26);
+
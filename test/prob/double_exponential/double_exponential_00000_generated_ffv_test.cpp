@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_0> AgradDistributionsDoubleExponential_ffv_0;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_1> AgradDistributionsDoubleExponential_ffv_1;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_2> AgradDistributionsDoubleExponential_ffv_2;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_3> AgradDistributionsDoubleExponential_ffv_3;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_4> AgradDistributionsDoubleExponential_ffv_4;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_5> AgradDistributionsDoubleExponential_ffv_5;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_6> AgradDistributionsDoubleExponential_ffv_6;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_7> AgradDistributionsDoubleExponential_ffv_7;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_8> AgradDistributionsDoubleExponential_ffv_8;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_9> AgradDistributionsDoubleExponential_ffv_9;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_10> AgradDistributionsDoubleExponential_ffv_10;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_11> AgradDistributionsDoubleExponential_ffv_11;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_12> AgradDistributionsDoubleExponential_ffv_12;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_13> AgradDistributionsDoubleExponential_ffv_13;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_14> AgradDistributionsDoubleExponential_ffv_14;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_15> AgradDistributionsDoubleExponential_ffv_15;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_16> AgradDistributionsDoubleExponential_ffv_16;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_17> AgradDistributionsDoubleExponential_ffv_17;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_18> AgradDistributionsDoubleExponential_ffv_18;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_19> AgradDistributionsDoubleExponential_ffv_19;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_20> AgradDistributionsDoubleExponential_ffv_20;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_21> AgradDistributionsDoubleExponential_ffv_21;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_22> AgradDistributionsDoubleExponential_ffv_22;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_23> AgradDistributionsDoubleExponential_ffv_23;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_24> AgradDistributionsDoubleExponential_ffv_24;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_25> AgradDistributionsDoubleExponential_ffv_25;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_26> AgradDistributionsDoubleExponential_ffv_26;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_27> AgradDistributionsDoubleExponential_ffv_27;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_28> AgradDistributionsDoubleExponential_ffv_28;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_29> AgradDistributionsDoubleExponential_ffv_29;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_30> AgradDistributionsDoubleExponential_ffv_30;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_31> AgradDistributionsDoubleExponential_ffv_31;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_32> AgradDistributionsDoubleExponential_ffv_32;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_33> AgradDistributionsDoubleExponential_ffv_33;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_34> AgradDistributionsDoubleExponential_ffv_34;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_35> AgradDistributionsDoubleExponential_ffv_35;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_36> AgradDistributionsDoubleExponential_ffv_36;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_37> AgradDistributionsDoubleExponential_ffv_37;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_38> AgradDistributionsDoubleExponential_ffv_38;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_39> AgradDistributionsDoubleExponential_ffv_39;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_40> AgradDistributionsDoubleExponential_ffv_40;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_41> AgradDistributionsDoubleExponential_ffv_41;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_42> AgradDistributionsDoubleExponential_ffv_42;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_43> AgradDistributionsDoubleExponential_ffv_43;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_44> AgradDistributionsDoubleExponential_ffv_44;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_45> AgradDistributionsDoubleExponential_ffv_45;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_46> AgradDistributionsDoubleExponential_ffv_46;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_47> AgradDistributionsDoubleExponential_ffv_47;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_48> AgradDistributionsDoubleExponential_ffv_48;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_49> AgradDistributionsDoubleExponential_ffv_49;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_50> AgradDistributionsDoubleExponential_ffv_50;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_51> AgradDistributionsDoubleExponential_ffv_51;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_52> AgradDistributionsDoubleExponential_ffv_52;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_53> AgradDistributionsDoubleExponential_ffv_53;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_54> AgradDistributionsDoubleExponential_ffv_54;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_55> AgradDistributionsDoubleExponential_ffv_55;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_56> AgradDistributionsDoubleExponential_ffv_56;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_57> AgradDistributionsDoubleExponential_ffv_57;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_58> AgradDistributionsDoubleExponential_ffv_58;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_59> AgradDistributionsDoubleExponential_ffv_59;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_60> AgradDistributionsDoubleExponential_ffv_60;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_61> AgradDistributionsDoubleExponential_ffv_61;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_62> AgradDistributionsDoubleExponential_ffv_62;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_63> AgradDistributionsDoubleExponential_ffv_63;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_64> AgradDistributionsDoubleExponential_ffv_64;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_65> AgradDistributionsDoubleExponential_ffv_65;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_66> AgradDistributionsDoubleExponential_ffv_66;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_67> AgradDistributionsDoubleExponential_ffv_67;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_68> AgradDistributionsDoubleExponential_ffv_68;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_69> AgradDistributionsDoubleExponential_ffv_69;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_70> AgradDistributionsDoubleExponential_ffv_70;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_71> AgradDistributionsDoubleExponential_ffv_71;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_72> AgradDistributionsDoubleExponential_ffv_72;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_73> AgradDistributionsDoubleExponential_ffv_73;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_74> AgradDistributionsDoubleExponential_ffv_74;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_75> AgradDistributionsDoubleExponential_ffv_75;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_76> AgradDistributionsDoubleExponential_ffv_76;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_77> AgradDistributionsDoubleExponential_ffv_77;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_78> AgradDistributionsDoubleExponential_ffv_78;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_79> AgradDistributionsDoubleExponential_ffv_79;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_80> AgradDistributionsDoubleExponential_ffv_80;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_81> AgradDistributionsDoubleExponential_ffv_81;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_82> AgradDistributionsDoubleExponential_ffv_82;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_83> AgradDistributionsDoubleExponential_ffv_83;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_84> AgradDistributionsDoubleExponential_ffv_84;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_85> AgradDistributionsDoubleExponential_ffv_85;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_86> AgradDistributionsDoubleExponential_ffv_86;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_87> AgradDistributionsDoubleExponential_ffv_87;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_88> AgradDistributionsDoubleExponential_ffv_88;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_89> AgradDistributionsDoubleExponential_ffv_89;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_90> AgradDistributionsDoubleExponential_ffv_90;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_91> AgradDistributionsDoubleExponential_ffv_91;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_92> AgradDistributionsDoubleExponential_ffv_92;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_93> AgradDistributionsDoubleExponential_ffv_93;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_94> AgradDistributionsDoubleExponential_ffv_94;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_95> AgradDistributionsDoubleExponential_ffv_95;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_96> AgradDistributionsDoubleExponential_ffv_96;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_97> AgradDistributionsDoubleExponential_ffv_97;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_98> AgradDistributionsDoubleExponential_ffv_98;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_99> AgradDistributionsDoubleExponential_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_0, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_1, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_2, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_3, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_4, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_5, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_6, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_7, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_8, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_9, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_10, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_11, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_12, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_13, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_14, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_15, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_16, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_17, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_18, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_19, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_20, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_21, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_22, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_23, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_24, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_25, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_26, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_27, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_28, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_29, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_30, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_31, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_32, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_33, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_34, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_35, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_36, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_37, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_38, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_39, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_40, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_41, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_42, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_43, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_44, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_45, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_46, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_47, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_48, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_49, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_50, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_51, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_52, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_53, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_54, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_55, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_56, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_57, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_58, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_59, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_60, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_61, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_62, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_63, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_64, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_65, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_66, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_67, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_68, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_69, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_70, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_71, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_72, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_73, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_74, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_75, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_76, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_77, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_78, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_79, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_80, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_81, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_82, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_83, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_84, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_85, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_86, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_87, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_88, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_89, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_90, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_91, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_92, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_93, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_94, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_95, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_96, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_97, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_98, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_99, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_99);
+
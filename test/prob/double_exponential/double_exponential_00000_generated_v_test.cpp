@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_0> AgradDistributionsDoubleExponential_v_0;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_1> AgradDistributionsDoubleExponential_v_1;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_2> AgradDistributionsDoubleExponential_v_2;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_3> AgradDistributionsDoubleExponential_v_3;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_4> AgradDistributionsDoubleExponential_v_4;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_5> AgradDistributionsDoubleExponential_v_5;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_6> AgradDistributionsDoubleExponential_v_6;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_7> AgradDistributionsDoubleExponential_v_7;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_8> AgradDistributionsDoubleExponential_v_8;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_9> AgradDistributionsDoubleExponential_v_9;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_10> AgradDistributionsDoubleExponential_v_10;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_11> AgradDistributionsDoubleExponential_v_11;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_12> AgradDistributionsDoubleExponential_v_12;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_13> AgradDistributionsDoubleExponential_v_13;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_14> AgradDistributionsDoubleExponential_v_14;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_15> AgradDistributionsDoubleExponential_v_15;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_16> AgradDistributionsDoubleExponential_v_16;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_17> AgradDistributionsDoubleExponential_v_17;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_18> AgradDistributionsDoubleExponential_v_18;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_19> AgradDistributionsDoubleExponential_v_19;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_20> AgradDistributionsDoubleExponential_v_20;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_21> AgradDistributionsDoubleExponential_v_21;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_22> AgradDistributionsDoubleExponential_v_22;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_23> AgradDistributionsDoubleExponential_v_23;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_24> AgradDistributionsDoubleExponential_v_24;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_25> AgradDistributionsDoubleExponential_v_25;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_26> AgradDistributionsDoubleExponential_v_26;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_27> AgradDistributionsDoubleExponential_v_27;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_28> AgradDistributionsDoubleExponential_v_28;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_29> AgradDistributionsDoubleExponential_v_29;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_30> AgradDistributionsDoubleExponential_v_30;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_31> AgradDistributionsDoubleExponential_v_31;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_32> AgradDistributionsDoubleExponential_v_32;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_33> AgradDistributionsDoubleExponential_v_33;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_34> AgradDistributionsDoubleExponential_v_34;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_35> AgradDistributionsDoubleExponential_v_35;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_36> AgradDistributionsDoubleExponential_v_36;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_37> AgradDistributionsDoubleExponential_v_37;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_38> AgradDistributionsDoubleExponential_v_38;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_39> AgradDistributionsDoubleExponential_v_39;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_40> AgradDistributionsDoubleExponential_v_40;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_41> AgradDistributionsDoubleExponential_v_41;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_42> AgradDistributionsDoubleExponential_v_42;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_43> AgradDistributionsDoubleExponential_v_43;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_44> AgradDistributionsDoubleExponential_v_44;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_45> AgradDistributionsDoubleExponential_v_45;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_46> AgradDistributionsDoubleExponential_v_46;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_47> AgradDistributionsDoubleExponential_v_47;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_48> AgradDistributionsDoubleExponential_v_48;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_49> AgradDistributionsDoubleExponential_v_49;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_50> AgradDistributionsDoubleExponential_v_50;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_51> AgradDistributionsDoubleExponential_v_51;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_52> AgradDistributionsDoubleExponential_v_52;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_53> AgradDistributionsDoubleExponential_v_53;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_54> AgradDistributionsDoubleExponential_v_54;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_55> AgradDistributionsDoubleExponential_v_55;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_56> AgradDistributionsDoubleExponential_v_56;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_57> AgradDistributionsDoubleExponential_v_57;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_58> AgradDistributionsDoubleExponential_v_58;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_59> AgradDistributionsDoubleExponential_v_59;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_60> AgradDistributionsDoubleExponential_v_60;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_61> AgradDistributionsDoubleExponential_v_61;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_62> AgradDistributionsDoubleExponential_v_62;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_63> AgradDistributionsDoubleExponential_v_63;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_64> AgradDistributionsDoubleExponential_v_64;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_65> AgradDistributionsDoubleExponential_v_65;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_66> AgradDistributionsDoubleExponential_v_66;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_67> AgradDistributionsDoubleExponential_v_67;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_68> AgradDistributionsDoubleExponential_v_68;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_69> AgradDistributionsDoubleExponential_v_69;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_70> AgradDistributionsDoubleExponential_v_70;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_71> AgradDistributionsDoubleExponential_v_71;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_72> AgradDistributionsDoubleExponential_v_72;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_73> AgradDistributionsDoubleExponential_v_73;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_74> AgradDistributionsDoubleExponential_v_74;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_75> AgradDistributionsDoubleExponential_v_75;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_76> AgradDistributionsDoubleExponential_v_76;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_77> AgradDistributionsDoubleExponential_v_77;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_78> AgradDistributionsDoubleExponential_v_78;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_79> AgradDistributionsDoubleExponential_v_79;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_80> AgradDistributionsDoubleExponential_v_80;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_81> AgradDistributionsDoubleExponential_v_81;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_82> AgradDistributionsDoubleExponential_v_82;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_83> AgradDistributionsDoubleExponential_v_83;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_84> AgradDistributionsDoubleExponential_v_84;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_85> AgradDistributionsDoubleExponential_v_85;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_86> AgradDistributionsDoubleExponential_v_86;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_87> AgradDistributionsDoubleExponential_v_87;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_88> AgradDistributionsDoubleExponential_v_88;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_89> AgradDistributionsDoubleExponential_v_89;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_90> AgradDistributionsDoubleExponential_v_90;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_91> AgradDistributionsDoubleExponential_v_91;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_92> AgradDistributionsDoubleExponential_v_92;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_93> AgradDistributionsDoubleExponential_v_93;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_94> AgradDistributionsDoubleExponential_v_94;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_95> AgradDistributionsDoubleExponential_v_95;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_96> AgradDistributionsDoubleExponential_v_96;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_97> AgradDistributionsDoubleExponential_v_97;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_98> AgradDistributionsDoubleExponential_v_98;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_99> AgradDistributionsDoubleExponential_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_0, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_1, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_2, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_3, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_4, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_5, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_6, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_7, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_8, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_9, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_10, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_11, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_12, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_13, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_14, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_15, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_16, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_17, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_18, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_19, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_20, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_21, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_22, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_23, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_24, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_25, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_26, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_27, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_28, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_29, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_30, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_31, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_32, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_33, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_34, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_35, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_36, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_37, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_38, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_39, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_40, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_41, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_42, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_43, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_44, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_45, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_46, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_47, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_48, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_49, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_50, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_51, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_52, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_53, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_54, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_55, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_56, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_57, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_58, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_59, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_60, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_61, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_62, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_63, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_64, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_65, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_66, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_67, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_68, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_69, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_70, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_71, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_72, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_73, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_74, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_75, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_76, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_77, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_78, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_79, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_80, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_81, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_82, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_83, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_84, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_85, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_86, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_87, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_88, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_89, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_90, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_91, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_92, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_93, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_94, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_95, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_96, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_97, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_98, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_99, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_0> AgradDistributionsDoubleExponential_vv_0;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_1> AgradDistributionsDoubleExponential_vv_1;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_2> AgradDistributionsDoubleExponential_vv_2;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_3> AgradDistributionsDoubleExponential_vv_3;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_4> AgradDistributionsDoubleExponential_vv_4;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_5> AgradDistributionsDoubleExponential_vv_5;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_6> AgradDistributionsDoubleExponential_vv_6;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_7> AgradDistributionsDoubleExponential_vv_7;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_8> AgradDistributionsDoubleExponential_vv_8;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_9> AgradDistributionsDoubleExponential_vv_9;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_10> AgradDistributionsDoubleExponential_vv_10;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_11> AgradDistributionsDoubleExponential_vv_11;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_12> AgradDistributionsDoubleExponential_vv_12;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_13> AgradDistributionsDoubleExponential_vv_13;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_14> AgradDistributionsDoubleExponential_vv_14;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_15> AgradDistributionsDoubleExponential_vv_15;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_16> AgradDistributionsDoubleExponential_vv_16;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_17> AgradDistributionsDoubleExponential_vv_17;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_18> AgradDistributionsDoubleExponential_vv_18;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_19> AgradDistributionsDoubleExponential_vv_19;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_20> AgradDistributionsDoubleExponential_vv_20;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_21> AgradDistributionsDoubleExponential_vv_21;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_22> AgradDistributionsDoubleExponential_vv_22;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_23> AgradDistributionsDoubleExponential_vv_23;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_24> AgradDistributionsDoubleExponential_vv_24;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_25> AgradDistributionsDoubleExponential_vv_25;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_26> AgradDistributionsDoubleExponential_vv_26;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_27> AgradDistributionsDoubleExponential_vv_27;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_28> AgradDistributionsDoubleExponential_vv_28;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_29> AgradDistributionsDoubleExponential_vv_29;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_30> AgradDistributionsDoubleExponential_vv_30;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_31> AgradDistributionsDoubleExponential_vv_31;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_32> AgradDistributionsDoubleExponential_vv_32;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_33> AgradDistributionsDoubleExponential_vv_33;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_34> AgradDistributionsDoubleExponential_vv_34;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_35> AgradDistributionsDoubleExponential_vv_35;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_36> AgradDistributionsDoubleExponential_vv_36;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_37> AgradDistributionsDoubleExponential_vv_37;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_38> AgradDistributionsDoubleExponential_vv_38;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_39> AgradDistributionsDoubleExponential_vv_39;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_40> AgradDistributionsDoubleExponential_vv_40;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_41> AgradDistributionsDoubleExponential_vv_41;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_42> AgradDistributionsDoubleExponential_vv_42;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_43> AgradDistributionsDoubleExponential_vv_43;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_44> AgradDistributionsDoubleExponential_vv_44;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_45> AgradDistributionsDoubleExponential_vv_45;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_46> AgradDistributionsDoubleExponential_vv_46;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_47> AgradDistributionsDoubleExponential_vv_47;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_48> AgradDistributionsDoubleExponential_vv_48;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_49> AgradDistributionsDoubleExponential_vv_49;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_50> AgradDistributionsDoubleExponential_vv_50;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_51> AgradDistributionsDoubleExponential_vv_51;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_52> AgradDistributionsDoubleExponential_vv_52;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_53> AgradDistributionsDoubleExponential_vv_53;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_54> AgradDistributionsDoubleExponential_vv_54;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_55> AgradDistributionsDoubleExponential_vv_55;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_56> AgradDistributionsDoubleExponential_vv_56;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_57> AgradDistributionsDoubleExponential_vv_57;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_58> AgradDistributionsDoubleExponential_vv_58;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_59> AgradDistributionsDoubleExponential_vv_59;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_60> AgradDistributionsDoubleExponential_vv_60;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_61> AgradDistributionsDoubleExponential_vv_61;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_62> AgradDistributionsDoubleExponential_vv_62;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_63> AgradDistributionsDoubleExponential_vv_63;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_64> AgradDistributionsDoubleExponential_vv_64;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_65> AgradDistributionsDoubleExponential_vv_65;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_66> AgradDistributionsDoubleExponential_vv_66;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_67> AgradDistributionsDoubleExponential_vv_67;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_68> AgradDistributionsDoubleExponential_vv_68;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_69> AgradDistributionsDoubleExponential_vv_69;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_70> AgradDistributionsDoubleExponential_vv_70;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_71> AgradDistributionsDoubleExponential_vv_71;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_72> AgradDistributionsDoubleExponential_vv_72;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_73> AgradDistributionsDoubleExponential_vv_73;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_74> AgradDistributionsDoubleExponential_vv_74;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_75> AgradDistributionsDoubleExponential_vv_75;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_76> AgradDistributionsDoubleExponential_vv_76;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_77> AgradDistributionsDoubleExponential_vv_77;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_78> AgradDistributionsDoubleExponential_vv_78;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_79> AgradDistributionsDoubleExponential_vv_79;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_80> AgradDistributionsDoubleExponential_vv_80;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_81> AgradDistributionsDoubleExponential_vv_81;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_82> AgradDistributionsDoubleExponential_vv_82;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_83> AgradDistributionsDoubleExponential_vv_83;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_84> AgradDistributionsDoubleExponential_vv_84;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_85> AgradDistributionsDoubleExponential_vv_85;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_86> AgradDistributionsDoubleExponential_vv_86;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_87> AgradDistributionsDoubleExponential_vv_87;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_88> AgradDistributionsDoubleExponential_vv_88;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_89> AgradDistributionsDoubleExponential_vv_89;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_90> AgradDistributionsDoubleExponential_vv_90;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_91> AgradDistributionsDoubleExponential_vv_91;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_92> AgradDistributionsDoubleExponential_vv_92;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_93> AgradDistributionsDoubleExponential_vv_93;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_94> AgradDistributionsDoubleExponential_vv_94;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_95> AgradDistributionsDoubleExponential_vv_95;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_96> AgradDistributionsDoubleExponential_vv_96;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_97> AgradDistributionsDoubleExponential_vv_97;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_98> AgradDistributionsDoubleExponential_vv_98;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_99> AgradDistributionsDoubleExponential_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_0, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_1, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_2, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_3, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_4, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_5, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_6, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_7, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_8, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_9, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_10, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_11, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_12, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_13, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_14, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_15, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_16, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_17, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_18, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_19, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_20, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_21, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_22, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_23, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_24, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_25, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_26, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_27, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_28, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_29, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_30, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_31, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_32, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_33, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_34, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_35, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_36, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_37, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_38, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_39, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_40, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_41, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_42, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_43, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_44, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_45, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_46, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_47, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_48, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_49, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_50, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_51, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_52, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_53, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_54, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_55, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_56, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_57, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_58, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_59, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_60, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_61, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_62, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_63, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_64, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_65, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_66, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_67, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_68, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_69, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_70, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_71, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_72, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_73, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_74, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_75, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_76, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_77, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_78, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_79, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_80, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_81, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_82, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_83, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_84, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_85, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_86, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_87, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_88, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_89, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_90, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_91, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_92, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_93, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_94, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_95, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_96, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_97, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_98, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_99, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_100> AgradDistributionsDoubleExponential_ffv_100;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_101> AgradDistributionsDoubleExponential_ffv_101;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_102> AgradDistributionsDoubleExponential_ffv_102;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_103> AgradDistributionsDoubleExponential_ffv_103;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_104> AgradDistributionsDoubleExponential_ffv_104;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_105> AgradDistributionsDoubleExponential_ffv_105;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_106> AgradDistributionsDoubleExponential_ffv_106;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_107> AgradDistributionsDoubleExponential_ffv_107;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_108> AgradDistributionsDoubleExponential_ffv_108;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_109> AgradDistributionsDoubleExponential_ffv_109;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_110> AgradDistributionsDoubleExponential_ffv_110;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_111> AgradDistributionsDoubleExponential_ffv_111;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_112> AgradDistributionsDoubleExponential_ffv_112;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_113> AgradDistributionsDoubleExponential_ffv_113;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_114> AgradDistributionsDoubleExponential_ffv_114;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_115> AgradDistributionsDoubleExponential_ffv_115;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_116> AgradDistributionsDoubleExponential_ffv_116;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_117> AgradDistributionsDoubleExponential_ffv_117;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_118> AgradDistributionsDoubleExponential_ffv_118;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_119> AgradDistributionsDoubleExponential_ffv_119;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_120> AgradDistributionsDoubleExponential_ffv_120;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_121> AgradDistributionsDoubleExponential_ffv_121;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_122> AgradDistributionsDoubleExponential_ffv_122;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_123> AgradDistributionsDoubleExponential_ffv_123;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_124> AgradDistributionsDoubleExponential_ffv_124;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_125> AgradDistributionsDoubleExponential_ffv_125;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_126> AgradDistributionsDoubleExponential_ffv_126;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_127> AgradDistributionsDoubleExponential_ffv_127;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_128> AgradDistributionsDoubleExponential_ffv_128;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_129> AgradDistributionsDoubleExponential_ffv_129;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_130> AgradDistributionsDoubleExponential_ffv_130;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_131> AgradDistributionsDoubleExponential_ffv_131;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_132> AgradDistributionsDoubleExponential_ffv_132;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_133> AgradDistributionsDoubleExponential_ffv_133;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_134> AgradDistributionsDoubleExponential_ffv_134;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_135> AgradDistributionsDoubleExponential_ffv_135;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_136> AgradDistributionsDoubleExponential_ffv_136;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_137> AgradDistributionsDoubleExponential_ffv_137;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_138> AgradDistributionsDoubleExponential_ffv_138;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_139> AgradDistributionsDoubleExponential_ffv_139;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_140> AgradDistributionsDoubleExponential_ffv_140;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_141> AgradDistributionsDoubleExponential_ffv_141;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_142> AgradDistributionsDoubleExponential_ffv_142;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_143> AgradDistributionsDoubleExponential_ffv_143;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_144> AgradDistributionsDoubleExponential_ffv_144;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_145> AgradDistributionsDoubleExponential_ffv_145;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_146> AgradDistributionsDoubleExponential_ffv_146;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_147> AgradDistributionsDoubleExponential_ffv_147;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_148> AgradDistributionsDoubleExponential_ffv_148;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_149> AgradDistributionsDoubleExponential_ffv_149;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_150> AgradDistributionsDoubleExponential_ffv_150;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_151> AgradDistributionsDoubleExponential_ffv_151;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_152> AgradDistributionsDoubleExponential_ffv_152;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_153> AgradDistributionsDoubleExponential_ffv_153;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_154> AgradDistributionsDoubleExponential_ffv_154;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_155> AgradDistributionsDoubleExponential_ffv_155;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_156> AgradDistributionsDoubleExponential_ffv_156;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_157> AgradDistributionsDoubleExponential_ffv_157;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_158> AgradDistributionsDoubleExponential_ffv_158;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_159> AgradDistributionsDoubleExponential_ffv_159;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_160> AgradDistributionsDoubleExponential_ffv_160;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_161> AgradDistributionsDoubleExponential_ffv_161;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_162> AgradDistributionsDoubleExponential_ffv_162;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_163> AgradDistributionsDoubleExponential_ffv_163;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_164> AgradDistributionsDoubleExponential_ffv_164;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_165> AgradDistributionsDoubleExponential_ffv_165;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_166> AgradDistributionsDoubleExponential_ffv_166;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_167> AgradDistributionsDoubleExponential_ffv_167;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_168> AgradDistributionsDoubleExponential_ffv_168;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_169> AgradDistributionsDoubleExponential_ffv_169;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_170> AgradDistributionsDoubleExponential_ffv_170;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_171> AgradDistributionsDoubleExponential_ffv_171;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_172> AgradDistributionsDoubleExponential_ffv_172;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_173> AgradDistributionsDoubleExponential_ffv_173;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_174> AgradDistributionsDoubleExponential_ffv_174;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_175> AgradDistributionsDoubleExponential_ffv_175;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_176> AgradDistributionsDoubleExponential_ffv_176;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_177> AgradDistributionsDoubleExponential_ffv_177;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_178> AgradDistributionsDoubleExponential_ffv_178;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_179> AgradDistributionsDoubleExponential_ffv_179;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_180> AgradDistributionsDoubleExponential_ffv_180;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_181> AgradDistributionsDoubleExponential_ffv_181;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_182> AgradDistributionsDoubleExponential_ffv_182;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_183> AgradDistributionsDoubleExponential_ffv_183;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_184> AgradDistributionsDoubleExponential_ffv_184;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_185> AgradDistributionsDoubleExponential_ffv_185;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_186> AgradDistributionsDoubleExponential_ffv_186;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_187> AgradDistributionsDoubleExponential_ffv_187;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_ffv_188> AgradDistributionsDoubleExponential_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_100, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_101, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_102, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_103, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_104, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_105, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_106, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_107, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_108, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_109, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_110, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_111, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_112, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_113, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_114, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_115, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_116, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_117, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_118, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_119, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_120, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_121, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_122, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_123, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_124, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_125, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_126, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_127, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_128, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_129, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_130, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_131, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_132, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_133, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_134, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_135, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_136, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_137, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_138, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_139, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_140, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_141, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_142, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_143, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_144, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_145, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_146, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_147, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_148, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_149, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_150, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_151, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_152, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_153, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_154, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_155, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_156, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_157, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_158, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_159, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_160, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_161, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_162, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_163, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_164, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_165, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_166, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_167, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_168, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_169, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_170, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_171, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_172, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_173, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_174, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_175, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_176, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_177, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_178, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_179, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_180, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_181, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_182, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_183, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_184, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_185, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_186, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_187, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_ffv_188, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_ffv_188);
+
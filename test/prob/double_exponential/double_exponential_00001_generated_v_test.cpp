@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_100> AgradDistributionsDoubleExponential_v_100;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_101> AgradDistributionsDoubleExponential_v_101;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_102> AgradDistributionsDoubleExponential_v_102;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_103> AgradDistributionsDoubleExponential_v_103;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_104> AgradDistributionsDoubleExponential_v_104;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_105> AgradDistributionsDoubleExponential_v_105;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_106> AgradDistributionsDoubleExponential_v_106;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_107> AgradDistributionsDoubleExponential_v_107;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_108> AgradDistributionsDoubleExponential_v_108;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_109> AgradDistributionsDoubleExponential_v_109;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_110> AgradDistributionsDoubleExponential_v_110;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_111> AgradDistributionsDoubleExponential_v_111;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_112> AgradDistributionsDoubleExponential_v_112;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_113> AgradDistributionsDoubleExponential_v_113;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_114> AgradDistributionsDoubleExponential_v_114;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_115> AgradDistributionsDoubleExponential_v_115;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_116> AgradDistributionsDoubleExponential_v_116;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_117> AgradDistributionsDoubleExponential_v_117;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_118> AgradDistributionsDoubleExponential_v_118;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_119> AgradDistributionsDoubleExponential_v_119;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_120> AgradDistributionsDoubleExponential_v_120;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_121> AgradDistributionsDoubleExponential_v_121;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_122> AgradDistributionsDoubleExponential_v_122;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_123> AgradDistributionsDoubleExponential_v_123;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_124> AgradDistributionsDoubleExponential_v_124;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_125> AgradDistributionsDoubleExponential_v_125;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_126> AgradDistributionsDoubleExponential_v_126;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_127> AgradDistributionsDoubleExponential_v_127;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_128> AgradDistributionsDoubleExponential_v_128;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_129> AgradDistributionsDoubleExponential_v_129;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_130> AgradDistributionsDoubleExponential_v_130;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_131> AgradDistributionsDoubleExponential_v_131;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_132> AgradDistributionsDoubleExponential_v_132;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_133> AgradDistributionsDoubleExponential_v_133;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_134> AgradDistributionsDoubleExponential_v_134;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_135> AgradDistributionsDoubleExponential_v_135;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_136> AgradDistributionsDoubleExponential_v_136;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_137> AgradDistributionsDoubleExponential_v_137;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_138> AgradDistributionsDoubleExponential_v_138;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_139> AgradDistributionsDoubleExponential_v_139;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_140> AgradDistributionsDoubleExponential_v_140;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_141> AgradDistributionsDoubleExponential_v_141;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_142> AgradDistributionsDoubleExponential_v_142;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_143> AgradDistributionsDoubleExponential_v_143;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_144> AgradDistributionsDoubleExponential_v_144;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_145> AgradDistributionsDoubleExponential_v_145;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_146> AgradDistributionsDoubleExponential_v_146;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_147> AgradDistributionsDoubleExponential_v_147;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_148> AgradDistributionsDoubleExponential_v_148;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_149> AgradDistributionsDoubleExponential_v_149;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_150> AgradDistributionsDoubleExponential_v_150;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_151> AgradDistributionsDoubleExponential_v_151;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_152> AgradDistributionsDoubleExponential_v_152;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_153> AgradDistributionsDoubleExponential_v_153;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_154> AgradDistributionsDoubleExponential_v_154;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_155> AgradDistributionsDoubleExponential_v_155;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_156> AgradDistributionsDoubleExponential_v_156;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_157> AgradDistributionsDoubleExponential_v_157;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_158> AgradDistributionsDoubleExponential_v_158;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_159> AgradDistributionsDoubleExponential_v_159;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_160> AgradDistributionsDoubleExponential_v_160;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_161> AgradDistributionsDoubleExponential_v_161;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_162> AgradDistributionsDoubleExponential_v_162;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_163> AgradDistributionsDoubleExponential_v_163;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_164> AgradDistributionsDoubleExponential_v_164;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_165> AgradDistributionsDoubleExponential_v_165;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_166> AgradDistributionsDoubleExponential_v_166;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_167> AgradDistributionsDoubleExponential_v_167;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_168> AgradDistributionsDoubleExponential_v_168;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_169> AgradDistributionsDoubleExponential_v_169;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_170> AgradDistributionsDoubleExponential_v_170;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_171> AgradDistributionsDoubleExponential_v_171;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_172> AgradDistributionsDoubleExponential_v_172;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_173> AgradDistributionsDoubleExponential_v_173;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_174> AgradDistributionsDoubleExponential_v_174;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_175> AgradDistributionsDoubleExponential_v_175;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_176> AgradDistributionsDoubleExponential_v_176;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_177> AgradDistributionsDoubleExponential_v_177;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_178> AgradDistributionsDoubleExponential_v_178;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_179> AgradDistributionsDoubleExponential_v_179;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_180> AgradDistributionsDoubleExponential_v_180;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_181> AgradDistributionsDoubleExponential_v_181;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_182> AgradDistributionsDoubleExponential_v_182;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_183> AgradDistributionsDoubleExponential_v_183;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_184> AgradDistributionsDoubleExponential_v_184;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_185> AgradDistributionsDoubleExponential_v_185;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_186> AgradDistributionsDoubleExponential_v_186;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_187> AgradDistributionsDoubleExponential_v_187;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_188> AgradDistributionsDoubleExponential_v_188;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_189> AgradDistributionsDoubleExponential_v_189;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_190> AgradDistributionsDoubleExponential_v_190;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_191> AgradDistributionsDoubleExponential_v_191;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_192> AgradDistributionsDoubleExponential_v_192;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_193> AgradDistributionsDoubleExponential_v_193;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_194> AgradDistributionsDoubleExponential_v_194;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_195> AgradDistributionsDoubleExponential_v_195;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_196> AgradDistributionsDoubleExponential_v_196;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_197> AgradDistributionsDoubleExponential_v_197;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_198> AgradDistributionsDoubleExponential_v_198;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_199> AgradDistributionsDoubleExponential_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_100, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_101, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_102, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_103, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_104, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_105, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_106, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_107, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_108, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_109, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_110, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_111, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_112, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_113, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_114, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_115, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_116, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_117, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_118, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_119, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_120, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_121, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_122, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_123, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_124, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_125, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_126, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_127, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_128, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_129, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_130, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_131, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_132, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_133, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_134, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_135, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_136, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_137, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_138, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_139, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_140, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_141, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_142, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_143, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_144, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_145, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_146, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_147, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_148, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_149, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_150, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_151, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_152, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_153, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_154, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_155, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_156, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_157, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_158, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_159, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_160, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_161, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_162, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_163, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_164, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_165, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_166, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_167, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_168, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_169, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_170, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_171, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_172, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_173, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_174, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_175, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_176, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_177, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_178, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_179, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_180, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_181, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_182, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_183, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_184, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_185, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_186, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_187, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_188, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_189, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_190, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_191, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_192, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_193, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_194, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_195, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_196, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_197, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_198, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_199, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_100> AgradDistributionsDoubleExponential_vv_100;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_101> AgradDistributionsDoubleExponential_vv_101;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_102> AgradDistributionsDoubleExponential_vv_102;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_103> AgradDistributionsDoubleExponential_vv_103;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_104> AgradDistributionsDoubleExponential_vv_104;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_105> AgradDistributionsDoubleExponential_vv_105;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_106> AgradDistributionsDoubleExponential_vv_106;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_107> AgradDistributionsDoubleExponential_vv_107;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_108> AgradDistributionsDoubleExponential_vv_108;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_109> AgradDistributionsDoubleExponential_vv_109;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_110> AgradDistributionsDoubleExponential_vv_110;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_111> AgradDistributionsDoubleExponential_vv_111;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_112> AgradDistributionsDoubleExponential_vv_112;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_113> AgradDistributionsDoubleExponential_vv_113;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_114> AgradDistributionsDoubleExponential_vv_114;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_115> AgradDistributionsDoubleExponential_vv_115;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_116> AgradDistributionsDoubleExponential_vv_116;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_117> AgradDistributionsDoubleExponential_vv_117;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_118> AgradDistributionsDoubleExponential_vv_118;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_119> AgradDistributionsDoubleExponential_vv_119;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_120> AgradDistributionsDoubleExponential_vv_120;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_121> AgradDistributionsDoubleExponential_vv_121;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_122> AgradDistributionsDoubleExponential_vv_122;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_123> AgradDistributionsDoubleExponential_vv_123;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_124> AgradDistributionsDoubleExponential_vv_124;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_125> AgradDistributionsDoubleExponential_vv_125;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_126> AgradDistributionsDoubleExponential_vv_126;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_127> AgradDistributionsDoubleExponential_vv_127;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_128> AgradDistributionsDoubleExponential_vv_128;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_129> AgradDistributionsDoubleExponential_vv_129;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_130> AgradDistributionsDoubleExponential_vv_130;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_131> AgradDistributionsDoubleExponential_vv_131;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_132> AgradDistributionsDoubleExponential_vv_132;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_133> AgradDistributionsDoubleExponential_vv_133;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_134> AgradDistributionsDoubleExponential_vv_134;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_135> AgradDistributionsDoubleExponential_vv_135;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_136> AgradDistributionsDoubleExponential_vv_136;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_137> AgradDistributionsDoubleExponential_vv_137;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_138> AgradDistributionsDoubleExponential_vv_138;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_139> AgradDistributionsDoubleExponential_vv_139;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_140> AgradDistributionsDoubleExponential_vv_140;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_141> AgradDistributionsDoubleExponential_vv_141;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_142> AgradDistributionsDoubleExponential_vv_142;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_143> AgradDistributionsDoubleExponential_vv_143;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_144> AgradDistributionsDoubleExponential_vv_144;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_145> AgradDistributionsDoubleExponential_vv_145;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_146> AgradDistributionsDoubleExponential_vv_146;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_147> AgradDistributionsDoubleExponential_vv_147;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_148> AgradDistributionsDoubleExponential_vv_148;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_149> AgradDistributionsDoubleExponential_vv_149;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_150> AgradDistributionsDoubleExponential_vv_150;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_151> AgradDistributionsDoubleExponential_vv_151;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_152> AgradDistributionsDoubleExponential_vv_152;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_153> AgradDistributionsDoubleExponential_vv_153;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_154> AgradDistributionsDoubleExponential_vv_154;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_155> AgradDistributionsDoubleExponential_vv_155;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_156> AgradDistributionsDoubleExponential_vv_156;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_157> AgradDistributionsDoubleExponential_vv_157;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_158> AgradDistributionsDoubleExponential_vv_158;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_159> AgradDistributionsDoubleExponential_vv_159;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_160> AgradDistributionsDoubleExponential_vv_160;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_161> AgradDistributionsDoubleExponential_vv_161;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_162> AgradDistributionsDoubleExponential_vv_162;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_163> AgradDistributionsDoubleExponential_vv_163;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_164> AgradDistributionsDoubleExponential_vv_164;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_165> AgradDistributionsDoubleExponential_vv_165;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_166> AgradDistributionsDoubleExponential_vv_166;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_167> AgradDistributionsDoubleExponential_vv_167;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_168> AgradDistributionsDoubleExponential_vv_168;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_169> AgradDistributionsDoubleExponential_vv_169;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_170> AgradDistributionsDoubleExponential_vv_170;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_171> AgradDistributionsDoubleExponential_vv_171;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_172> AgradDistributionsDoubleExponential_vv_172;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_173> AgradDistributionsDoubleExponential_vv_173;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_174> AgradDistributionsDoubleExponential_vv_174;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_175> AgradDistributionsDoubleExponential_vv_175;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_176> AgradDistributionsDoubleExponential_vv_176;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_177> AgradDistributionsDoubleExponential_vv_177;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_178> AgradDistributionsDoubleExponential_vv_178;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_179> AgradDistributionsDoubleExponential_vv_179;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_180> AgradDistributionsDoubleExponential_vv_180;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_181> AgradDistributionsDoubleExponential_vv_181;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_182> AgradDistributionsDoubleExponential_vv_182;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_183> AgradDistributionsDoubleExponential_vv_183;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_184> AgradDistributionsDoubleExponential_vv_184;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_185> AgradDistributionsDoubleExponential_vv_185;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_186> AgradDistributionsDoubleExponential_vv_186;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_187> AgradDistributionsDoubleExponential_vv_187;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_vv_188> AgradDistributionsDoubleExponential_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_100, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_101, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_102, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_103, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_104, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_105, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_106, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_107, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_108, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_109, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_110, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_111, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_112, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_113, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_114, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_115, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_116, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_117, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_118, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_119, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_120, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_121, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_122, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_123, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_124, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_125, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_126, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_127, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_128, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_129, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_130, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_131, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_132, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_133, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_134, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_135, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_136, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_137, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_138, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_139, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_140, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_141, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_142, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_143, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_144, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_145, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_146, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_147, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_148, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_149, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_150, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_151, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_152, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_153, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_154, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_155, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_156, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_157, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_158, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_159, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_160, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_161, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_162, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_163, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_164, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_165, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_166, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_167, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_168, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_169, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_170, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_171, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_172, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_173, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_174, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_175, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_176, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_177, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_178, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_179, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_180, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_181, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_182, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_183, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_184, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_185, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_186, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_187, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_vv_188, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_vv_188);
+
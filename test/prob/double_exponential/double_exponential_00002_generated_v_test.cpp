@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_200> AgradDistributionsDoubleExponential_v_200;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_201> AgradDistributionsDoubleExponential_v_201;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_202> AgradDistributionsDoubleExponential_v_202;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_203> AgradDistributionsDoubleExponential_v_203;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_204> AgradDistributionsDoubleExponential_v_204;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_205> AgradDistributionsDoubleExponential_v_205;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_206> AgradDistributionsDoubleExponential_v_206;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_207> AgradDistributionsDoubleExponential_v_207;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_208> AgradDistributionsDoubleExponential_v_208;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_209> AgradDistributionsDoubleExponential_v_209;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_210> AgradDistributionsDoubleExponential_v_210;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_211> AgradDistributionsDoubleExponential_v_211;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_212> AgradDistributionsDoubleExponential_v_212;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_213> AgradDistributionsDoubleExponential_v_213;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_214> AgradDistributionsDoubleExponential_v_214;
+typedef std::tuple<AgradDistributionsDoubleExponential, type_v_215> AgradDistributionsDoubleExponential_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_200, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_201, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_202, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_203, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_204, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_205, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_206, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_207, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_208, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_209, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_210, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_211, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_212, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_213, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_214, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsDoubleExponential_v_215, AgradDistributionTestFixture, AgradDistributionsDoubleExponential_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_0> AgradCcdfLogDoubleExponential_ffv_0;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_1> AgradCcdfLogDoubleExponential_ffv_1;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_2> AgradCcdfLogDoubleExponential_ffv_2;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_3> AgradCcdfLogDoubleExponential_ffv_3;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_4> AgradCcdfLogDoubleExponential_ffv_4;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_5> AgradCcdfLogDoubleExponential_ffv_5;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_6> AgradCcdfLogDoubleExponential_ffv_6;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_7> AgradCcdfLogDoubleExponential_ffv_7;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_8> AgradCcdfLogDoubleExponential_ffv_8;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_9> AgradCcdfLogDoubleExponential_ffv_9;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_10> AgradCcdfLogDoubleExponential_ffv_10;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_11> AgradCcdfLogDoubleExponential_ffv_11;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_12> AgradCcdfLogDoubleExponential_ffv_12;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_13> AgradCcdfLogDoubleExponential_ffv_13;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_14> AgradCcdfLogDoubleExponential_ffv_14;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_15> AgradCcdfLogDoubleExponential_ffv_15;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_16> AgradCcdfLogDoubleExponential_ffv_16;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_17> AgradCcdfLogDoubleExponential_ffv_17;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_18> AgradCcdfLogDoubleExponential_ffv_18;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_19> AgradCcdfLogDoubleExponential_ffv_19;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_20> AgradCcdfLogDoubleExponential_ffv_20;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_21> AgradCcdfLogDoubleExponential_ffv_21;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_22> AgradCcdfLogDoubleExponential_ffv_22;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_23> AgradCcdfLogDoubleExponential_ffv_23;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_24> AgradCcdfLogDoubleExponential_ffv_24;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_25> AgradCcdfLogDoubleExponential_ffv_25;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_26> AgradCcdfLogDoubleExponential_ffv_26;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_27> AgradCcdfLogDoubleExponential_ffv_27;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_28> AgradCcdfLogDoubleExponential_ffv_28;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_29> AgradCcdfLogDoubleExponential_ffv_29;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_30> AgradCcdfLogDoubleExponential_ffv_30;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_31> AgradCcdfLogDoubleExponential_ffv_31;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_32> AgradCcdfLogDoubleExponential_ffv_32;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_33> AgradCcdfLogDoubleExponential_ffv_33;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_34> AgradCcdfLogDoubleExponential_ffv_34;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_35> AgradCcdfLogDoubleExponential_ffv_35;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_36> AgradCcdfLogDoubleExponential_ffv_36;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_37> AgradCcdfLogDoubleExponential_ffv_37;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_38> AgradCcdfLogDoubleExponential_ffv_38;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_39> AgradCcdfLogDoubleExponential_ffv_39;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_40> AgradCcdfLogDoubleExponential_ffv_40;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_41> AgradCcdfLogDoubleExponential_ffv_41;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_42> AgradCcdfLogDoubleExponential_ffv_42;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_43> AgradCcdfLogDoubleExponential_ffv_43;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_44> AgradCcdfLogDoubleExponential_ffv_44;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_45> AgradCcdfLogDoubleExponential_ffv_45;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_46> AgradCcdfLogDoubleExponential_ffv_46;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_47> AgradCcdfLogDoubleExponential_ffv_47;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_48> AgradCcdfLogDoubleExponential_ffv_48;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_49> AgradCcdfLogDoubleExponential_ffv_49;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_50> AgradCcdfLogDoubleExponential_ffv_50;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_51> AgradCcdfLogDoubleExponential_ffv_51;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_52> AgradCcdfLogDoubleExponential_ffv_52;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_53> AgradCcdfLogDoubleExponential_ffv_53;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_54> AgradCcdfLogDoubleExponential_ffv_54;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_55> AgradCcdfLogDoubleExponential_ffv_55;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_56> AgradCcdfLogDoubleExponential_ffv_56;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_57> AgradCcdfLogDoubleExponential_ffv_57;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_58> AgradCcdfLogDoubleExponential_ffv_58;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_59> AgradCcdfLogDoubleExponential_ffv_59;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_60> AgradCcdfLogDoubleExponential_ffv_60;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_61> AgradCcdfLogDoubleExponential_ffv_61;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_62> AgradCcdfLogDoubleExponential_ffv_62;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_63> AgradCcdfLogDoubleExponential_ffv_63;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_64> AgradCcdfLogDoubleExponential_ffv_64;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_65> AgradCcdfLogDoubleExponential_ffv_65;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_66> AgradCcdfLogDoubleExponential_ffv_66;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_67> AgradCcdfLogDoubleExponential_ffv_67;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_68> AgradCcdfLogDoubleExponential_ffv_68;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_69> AgradCcdfLogDoubleExponential_ffv_69;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_70> AgradCcdfLogDoubleExponential_ffv_70;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_71> AgradCcdfLogDoubleExponential_ffv_71;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_72> AgradCcdfLogDoubleExponential_ffv_72;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_73> AgradCcdfLogDoubleExponential_ffv_73;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_74> AgradCcdfLogDoubleExponential_ffv_74;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_75> AgradCcdfLogDoubleExponential_ffv_75;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_76> AgradCcdfLogDoubleExponential_ffv_76;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_77> AgradCcdfLogDoubleExponential_ffv_77;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_78> AgradCcdfLogDoubleExponential_ffv_78;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_79> AgradCcdfLogDoubleExponential_ffv_79;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_80> AgradCcdfLogDoubleExponential_ffv_80;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_81> AgradCcdfLogDoubleExponential_ffv_81;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_82> AgradCcdfLogDoubleExponential_ffv_82;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_83> AgradCcdfLogDoubleExponential_ffv_83;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_84> AgradCcdfLogDoubleExponential_ffv_84;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_85> AgradCcdfLogDoubleExponential_ffv_85;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_86> AgradCcdfLogDoubleExponential_ffv_86;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_87> AgradCcdfLogDoubleExponential_ffv_87;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_88> AgradCcdfLogDoubleExponential_ffv_88;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_89> AgradCcdfLogDoubleExponential_ffv_89;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_90> AgradCcdfLogDoubleExponential_ffv_90;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_91> AgradCcdfLogDoubleExponential_ffv_91;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_92> AgradCcdfLogDoubleExponential_ffv_92;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_93> AgradCcdfLogDoubleExponential_ffv_93;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_94> AgradCcdfLogDoubleExponential_ffv_94;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_95> AgradCcdfLogDoubleExponential_ffv_95;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_96> AgradCcdfLogDoubleExponential_ffv_96;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_97> AgradCcdfLogDoubleExponential_ffv_97;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_98> AgradCcdfLogDoubleExponential_ffv_98;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_99> AgradCcdfLogDoubleExponential_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_0> AgradCcdfLogDoubleExponential_v_0;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_1> AgradCcdfLogDoubleExponential_v_1;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_2> AgradCcdfLogDoubleExponential_v_2;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_3> AgradCcdfLogDoubleExponential_v_3;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_4> AgradCcdfLogDoubleExponential_v_4;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_5> AgradCcdfLogDoubleExponential_v_5;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_6> AgradCcdfLogDoubleExponential_v_6;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_7> AgradCcdfLogDoubleExponential_v_7;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_8> AgradCcdfLogDoubleExponential_v_8;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_9> AgradCcdfLogDoubleExponential_v_9;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_10> AgradCcdfLogDoubleExponential_v_10;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_11> AgradCcdfLogDoubleExponential_v_11;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_12> AgradCcdfLogDoubleExponential_v_12;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_13> AgradCcdfLogDoubleExponential_v_13;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_14> AgradCcdfLogDoubleExponential_v_14;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_15> AgradCcdfLogDoubleExponential_v_15;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_16> AgradCcdfLogDoubleExponential_v_16;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_17> AgradCcdfLogDoubleExponential_v_17;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_18> AgradCcdfLogDoubleExponential_v_18;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_19> AgradCcdfLogDoubleExponential_v_19;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_20> AgradCcdfLogDoubleExponential_v_20;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_21> AgradCcdfLogDoubleExponential_v_21;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_22> AgradCcdfLogDoubleExponential_v_22;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_23> AgradCcdfLogDoubleExponential_v_23;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_24> AgradCcdfLogDoubleExponential_v_24;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_25> AgradCcdfLogDoubleExponential_v_25;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_26> AgradCcdfLogDoubleExponential_v_26;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_27> AgradCcdfLogDoubleExponential_v_27;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_28> AgradCcdfLogDoubleExponential_v_28;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_29> AgradCcdfLogDoubleExponential_v_29;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_30> AgradCcdfLogDoubleExponential_v_30;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_31> AgradCcdfLogDoubleExponential_v_31;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_32> AgradCcdfLogDoubleExponential_v_32;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_33> AgradCcdfLogDoubleExponential_v_33;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_34> AgradCcdfLogDoubleExponential_v_34;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_35> AgradCcdfLogDoubleExponential_v_35;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_36> AgradCcdfLogDoubleExponential_v_36;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_37> AgradCcdfLogDoubleExponential_v_37;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_38> AgradCcdfLogDoubleExponential_v_38;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_39> AgradCcdfLogDoubleExponential_v_39;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_40> AgradCcdfLogDoubleExponential_v_40;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_41> AgradCcdfLogDoubleExponential_v_41;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_42> AgradCcdfLogDoubleExponential_v_42;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_43> AgradCcdfLogDoubleExponential_v_43;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_44> AgradCcdfLogDoubleExponential_v_44;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_45> AgradCcdfLogDoubleExponential_v_45;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_46> AgradCcdfLogDoubleExponential_v_46;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_47> AgradCcdfLogDoubleExponential_v_47;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_48> AgradCcdfLogDoubleExponential_v_48;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_49> AgradCcdfLogDoubleExponential_v_49;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_50> AgradCcdfLogDoubleExponential_v_50;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_51> AgradCcdfLogDoubleExponential_v_51;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_52> AgradCcdfLogDoubleExponential_v_52;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_53> AgradCcdfLogDoubleExponential_v_53;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_54> AgradCcdfLogDoubleExponential_v_54;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_55> AgradCcdfLogDoubleExponential_v_55;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_56> AgradCcdfLogDoubleExponential_v_56;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_57> AgradCcdfLogDoubleExponential_v_57;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_58> AgradCcdfLogDoubleExponential_v_58;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_59> AgradCcdfLogDoubleExponential_v_59;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_60> AgradCcdfLogDoubleExponential_v_60;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_61> AgradCcdfLogDoubleExponential_v_61;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_62> AgradCcdfLogDoubleExponential_v_62;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_63> AgradCcdfLogDoubleExponential_v_63;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_64> AgradCcdfLogDoubleExponential_v_64;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_65> AgradCcdfLogDoubleExponential_v_65;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_66> AgradCcdfLogDoubleExponential_v_66;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_67> AgradCcdfLogDoubleExponential_v_67;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_68> AgradCcdfLogDoubleExponential_v_68;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_69> AgradCcdfLogDoubleExponential_v_69;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_70> AgradCcdfLogDoubleExponential_v_70;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_71> AgradCcdfLogDoubleExponential_v_71;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_72> AgradCcdfLogDoubleExponential_v_72;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_73> AgradCcdfLogDoubleExponential_v_73;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_74> AgradCcdfLogDoubleExponential_v_74;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_75> AgradCcdfLogDoubleExponential_v_75;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_76> AgradCcdfLogDoubleExponential_v_76;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_77> AgradCcdfLogDoubleExponential_v_77;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_78> AgradCcdfLogDoubleExponential_v_78;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_79> AgradCcdfLogDoubleExponential_v_79;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_80> AgradCcdfLogDoubleExponential_v_80;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_81> AgradCcdfLogDoubleExponential_v_81;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_82> AgradCcdfLogDoubleExponential_v_82;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_83> AgradCcdfLogDoubleExponential_v_83;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_84> AgradCcdfLogDoubleExponential_v_84;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_85> AgradCcdfLogDoubleExponential_v_85;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_86> AgradCcdfLogDoubleExponential_v_86;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_87> AgradCcdfLogDoubleExponential_v_87;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_88> AgradCcdfLogDoubleExponential_v_88;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_89> AgradCcdfLogDoubleExponential_v_89;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_90> AgradCcdfLogDoubleExponential_v_90;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_91> AgradCcdfLogDoubleExponential_v_91;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_92> AgradCcdfLogDoubleExponential_v_92;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_93> AgradCcdfLogDoubleExponential_v_93;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_94> AgradCcdfLogDoubleExponential_v_94;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_95> AgradCcdfLogDoubleExponential_v_95;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_96> AgradCcdfLogDoubleExponential_v_96;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_97> AgradCcdfLogDoubleExponential_v_97;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_98> AgradCcdfLogDoubleExponential_v_98;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_99> AgradCcdfLogDoubleExponential_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_0, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_1, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_2, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_3, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_4, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_5, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_6, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_7, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_8, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_9, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_10, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_11, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_12, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_13, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_14, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_15, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_16, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_17, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_18, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_19, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_20, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_21, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_22, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_23, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_24, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_25, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_26, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_27, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_28, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_29, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_30, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_31, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_32, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_33, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_34, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_35, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_36, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_37, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_38, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_39, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_40, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_41, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_42, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_43, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_44, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_45, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_46, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_47, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_48, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_49, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_50, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_51, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_52, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_53, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_54, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_55, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_56, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_57, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_58, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_59, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_60, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_61, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_62, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_63, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_64, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_65, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_66, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_67, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_68, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_69, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_70, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_71, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_72, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_73, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_74, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_75, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_76, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_77, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_78, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_79, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_80, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_81, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_82, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_83, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_84, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_85, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_86, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_87, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_88, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_89, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_90, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_91, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_92, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_93, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_94, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_95, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_96, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_97, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_98, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_99, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_99);
+
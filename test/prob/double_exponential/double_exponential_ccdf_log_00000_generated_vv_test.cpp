@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_0> AgradCcdfLogDoubleExponential_vv_0;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_1> AgradCcdfLogDoubleExponential_vv_1;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_2> AgradCcdfLogDoubleExponential_vv_2;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_3> AgradCcdfLogDoubleExponential_vv_3;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_4> AgradCcdfLogDoubleExponential_vv_4;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_5> AgradCcdfLogDoubleExponential_vv_5;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_6> AgradCcdfLogDoubleExponential_vv_6;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_7> AgradCcdfLogDoubleExponential_vv_7;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_8> AgradCcdfLogDoubleExponential_vv_8;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_9> AgradCcdfLogDoubleExponential_vv_9;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_10> AgradCcdfLogDoubleExponential_vv_10;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_11> AgradCcdfLogDoubleExponential_vv_11;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_12> AgradCcdfLogDoubleExponential_vv_12;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_13> AgradCcdfLogDoubleExponential_vv_13;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_14> AgradCcdfLogDoubleExponential_vv_14;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_15> AgradCcdfLogDoubleExponential_vv_15;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_16> AgradCcdfLogDoubleExponential_vv_16;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_17> AgradCcdfLogDoubleExponential_vv_17;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_18> AgradCcdfLogDoubleExponential_vv_18;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_19> AgradCcdfLogDoubleExponential_vv_19;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_20> AgradCcdfLogDoubleExponential_vv_20;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_21> AgradCcdfLogDoubleExponential_vv_21;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_22> AgradCcdfLogDoubleExponential_vv_22;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_23> AgradCcdfLogDoubleExponential_vv_23;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_24> AgradCcdfLogDoubleExponential_vv_24;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_25> AgradCcdfLogDoubleExponential_vv_25;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_26> AgradCcdfLogDoubleExponential_vv_26;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_27> AgradCcdfLogDoubleExponential_vv_27;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_28> AgradCcdfLogDoubleExponential_vv_28;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_29> AgradCcdfLogDoubleExponential_vv_29;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_30> AgradCcdfLogDoubleExponential_vv_30;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_31> AgradCcdfLogDoubleExponential_vv_31;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_32> AgradCcdfLogDoubleExponential_vv_32;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_33> AgradCcdfLogDoubleExponential_vv_33;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_34> AgradCcdfLogDoubleExponential_vv_34;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_35> AgradCcdfLogDoubleExponential_vv_35;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_36> AgradCcdfLogDoubleExponential_vv_36;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_37> AgradCcdfLogDoubleExponential_vv_37;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_38> AgradCcdfLogDoubleExponential_vv_38;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_39> AgradCcdfLogDoubleExponential_vv_39;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_40> AgradCcdfLogDoubleExponential_vv_40;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_41> AgradCcdfLogDoubleExponential_vv_41;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_42> AgradCcdfLogDoubleExponential_vv_42;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_43> AgradCcdfLogDoubleExponential_vv_43;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_44> AgradCcdfLogDoubleExponential_vv_44;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_45> AgradCcdfLogDoubleExponential_vv_45;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_46> AgradCcdfLogDoubleExponential_vv_46;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_47> AgradCcdfLogDoubleExponential_vv_47;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_48> AgradCcdfLogDoubleExponential_vv_48;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_49> AgradCcdfLogDoubleExponential_vv_49;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_50> AgradCcdfLogDoubleExponential_vv_50;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_51> AgradCcdfLogDoubleExponential_vv_51;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_52> AgradCcdfLogDoubleExponential_vv_52;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_53> AgradCcdfLogDoubleExponential_vv_53;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_54> AgradCcdfLogDoubleExponential_vv_54;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_55> AgradCcdfLogDoubleExponential_vv_55;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_56> AgradCcdfLogDoubleExponential_vv_56;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_57> AgradCcdfLogDoubleExponential_vv_57;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_58> AgradCcdfLogDoubleExponential_vv_58;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_59> AgradCcdfLogDoubleExponential_vv_59;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_60> AgradCcdfLogDoubleExponential_vv_60;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_61> AgradCcdfLogDoubleExponential_vv_61;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_62> AgradCcdfLogDoubleExponential_vv_62;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_63> AgradCcdfLogDoubleExponential_vv_63;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_64> AgradCcdfLogDoubleExponential_vv_64;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_65> AgradCcdfLogDoubleExponential_vv_65;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_66> AgradCcdfLogDoubleExponential_vv_66;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_67> AgradCcdfLogDoubleExponential_vv_67;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_68> AgradCcdfLogDoubleExponential_vv_68;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_69> AgradCcdfLogDoubleExponential_vv_69;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_70> AgradCcdfLogDoubleExponential_vv_70;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_71> AgradCcdfLogDoubleExponential_vv_71;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_72> AgradCcdfLogDoubleExponential_vv_72;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_73> AgradCcdfLogDoubleExponential_vv_73;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_74> AgradCcdfLogDoubleExponential_vv_74;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_75> AgradCcdfLogDoubleExponential_vv_75;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_76> AgradCcdfLogDoubleExponential_vv_76;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_77> AgradCcdfLogDoubleExponential_vv_77;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_78> AgradCcdfLogDoubleExponential_vv_78;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_79> AgradCcdfLogDoubleExponential_vv_79;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_80> AgradCcdfLogDoubleExponential_vv_80;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_81> AgradCcdfLogDoubleExponential_vv_81;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_82> AgradCcdfLogDoubleExponential_vv_82;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_83> AgradCcdfLogDoubleExponential_vv_83;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_84> AgradCcdfLogDoubleExponential_vv_84;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_85> AgradCcdfLogDoubleExponential_vv_85;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_86> AgradCcdfLogDoubleExponential_vv_86;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_87> AgradCcdfLogDoubleExponential_vv_87;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_88> AgradCcdfLogDoubleExponential_vv_88;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_89> AgradCcdfLogDoubleExponential_vv_89;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_90> AgradCcdfLogDoubleExponential_vv_90;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_91> AgradCcdfLogDoubleExponential_vv_91;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_92> AgradCcdfLogDoubleExponential_vv_92;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_93> AgradCcdfLogDoubleExponential_vv_93;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_94> AgradCcdfLogDoubleExponential_vv_94;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_95> AgradCcdfLogDoubleExponential_vv_95;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_96> AgradCcdfLogDoubleExponential_vv_96;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_97> AgradCcdfLogDoubleExponential_vv_97;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_98> AgradCcdfLogDoubleExponential_vv_98;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_99> AgradCcdfLogDoubleExponential_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_99);
+
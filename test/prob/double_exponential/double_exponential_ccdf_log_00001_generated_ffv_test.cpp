@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_100> AgradCcdfLogDoubleExponential_ffv_100;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_101> AgradCcdfLogDoubleExponential_ffv_101;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_102> AgradCcdfLogDoubleExponential_ffv_102;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_103> AgradCcdfLogDoubleExponential_ffv_103;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_104> AgradCcdfLogDoubleExponential_ffv_104;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_105> AgradCcdfLogDoubleExponential_ffv_105;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_106> AgradCcdfLogDoubleExponential_ffv_106;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_107> AgradCcdfLogDoubleExponential_ffv_107;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_108> AgradCcdfLogDoubleExponential_ffv_108;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_109> AgradCcdfLogDoubleExponential_ffv_109;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_110> AgradCcdfLogDoubleExponential_ffv_110;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_111> AgradCcdfLogDoubleExponential_ffv_111;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_112> AgradCcdfLogDoubleExponential_ffv_112;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_113> AgradCcdfLogDoubleExponential_ffv_113;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_114> AgradCcdfLogDoubleExponential_ffv_114;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_115> AgradCcdfLogDoubleExponential_ffv_115;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_116> AgradCcdfLogDoubleExponential_ffv_116;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_117> AgradCcdfLogDoubleExponential_ffv_117;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_118> AgradCcdfLogDoubleExponential_ffv_118;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_119> AgradCcdfLogDoubleExponential_ffv_119;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_120> AgradCcdfLogDoubleExponential_ffv_120;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_121> AgradCcdfLogDoubleExponential_ffv_121;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_122> AgradCcdfLogDoubleExponential_ffv_122;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_123> AgradCcdfLogDoubleExponential_ffv_123;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_124> AgradCcdfLogDoubleExponential_ffv_124;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_125> AgradCcdfLogDoubleExponential_ffv_125;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_126> AgradCcdfLogDoubleExponential_ffv_126;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_127> AgradCcdfLogDoubleExponential_ffv_127;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_128> AgradCcdfLogDoubleExponential_ffv_128;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_129> AgradCcdfLogDoubleExponential_ffv_129;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_130> AgradCcdfLogDoubleExponential_ffv_130;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_131> AgradCcdfLogDoubleExponential_ffv_131;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_132> AgradCcdfLogDoubleExponential_ffv_132;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_133> AgradCcdfLogDoubleExponential_ffv_133;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_134> AgradCcdfLogDoubleExponential_ffv_134;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_135> AgradCcdfLogDoubleExponential_ffv_135;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_136> AgradCcdfLogDoubleExponential_ffv_136;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_137> AgradCcdfLogDoubleExponential_ffv_137;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_138> AgradCcdfLogDoubleExponential_ffv_138;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_139> AgradCcdfLogDoubleExponential_ffv_139;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_140> AgradCcdfLogDoubleExponential_ffv_140;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_141> AgradCcdfLogDoubleExponential_ffv_141;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_142> AgradCcdfLogDoubleExponential_ffv_142;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_143> AgradCcdfLogDoubleExponential_ffv_143;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_144> AgradCcdfLogDoubleExponential_ffv_144;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_145> AgradCcdfLogDoubleExponential_ffv_145;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_146> AgradCcdfLogDoubleExponential_ffv_146;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_147> AgradCcdfLogDoubleExponential_ffv_147;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_148> AgradCcdfLogDoubleExponential_ffv_148;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_149> AgradCcdfLogDoubleExponential_ffv_149;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_150> AgradCcdfLogDoubleExponential_ffv_150;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_151> AgradCcdfLogDoubleExponential_ffv_151;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_152> AgradCcdfLogDoubleExponential_ffv_152;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_153> AgradCcdfLogDoubleExponential_ffv_153;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_154> AgradCcdfLogDoubleExponential_ffv_154;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_155> AgradCcdfLogDoubleExponential_ffv_155;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_156> AgradCcdfLogDoubleExponential_ffv_156;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_157> AgradCcdfLogDoubleExponential_ffv_157;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_158> AgradCcdfLogDoubleExponential_ffv_158;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_159> AgradCcdfLogDoubleExponential_ffv_159;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_160> AgradCcdfLogDoubleExponential_ffv_160;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_161> AgradCcdfLogDoubleExponential_ffv_161;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_162> AgradCcdfLogDoubleExponential_ffv_162;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_163> AgradCcdfLogDoubleExponential_ffv_163;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_164> AgradCcdfLogDoubleExponential_ffv_164;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_165> AgradCcdfLogDoubleExponential_ffv_165;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_166> AgradCcdfLogDoubleExponential_ffv_166;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_167> AgradCcdfLogDoubleExponential_ffv_167;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_168> AgradCcdfLogDoubleExponential_ffv_168;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_169> AgradCcdfLogDoubleExponential_ffv_169;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_170> AgradCcdfLogDoubleExponential_ffv_170;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_171> AgradCcdfLogDoubleExponential_ffv_171;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_172> AgradCcdfLogDoubleExponential_ffv_172;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_173> AgradCcdfLogDoubleExponential_ffv_173;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_174> AgradCcdfLogDoubleExponential_ffv_174;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_175> AgradCcdfLogDoubleExponential_ffv_175;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_176> AgradCcdfLogDoubleExponential_ffv_176;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_177> AgradCcdfLogDoubleExponential_ffv_177;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_178> AgradCcdfLogDoubleExponential_ffv_178;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_179> AgradCcdfLogDoubleExponential_ffv_179;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_180> AgradCcdfLogDoubleExponential_ffv_180;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_181> AgradCcdfLogDoubleExponential_ffv_181;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_182> AgradCcdfLogDoubleExponential_ffv_182;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_183> AgradCcdfLogDoubleExponential_ffv_183;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_184> AgradCcdfLogDoubleExponential_ffv_184;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_185> AgradCcdfLogDoubleExponential_ffv_185;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_186> AgradCcdfLogDoubleExponential_ffv_186;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_187> AgradCcdfLogDoubleExponential_ffv_187;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_ffv_188> AgradCcdfLogDoubleExponential_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_100> AgradCcdfLogDoubleExponential_v_100;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_101> AgradCcdfLogDoubleExponential_v_101;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_102> AgradCcdfLogDoubleExponential_v_102;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_103> AgradCcdfLogDoubleExponential_v_103;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_104> AgradCcdfLogDoubleExponential_v_104;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_105> AgradCcdfLogDoubleExponential_v_105;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_106> AgradCcdfLogDoubleExponential_v_106;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_107> AgradCcdfLogDoubleExponential_v_107;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_108> AgradCcdfLogDoubleExponential_v_108;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_109> AgradCcdfLogDoubleExponential_v_109;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_110> AgradCcdfLogDoubleExponential_v_110;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_111> AgradCcdfLogDoubleExponential_v_111;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_112> AgradCcdfLogDoubleExponential_v_112;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_113> AgradCcdfLogDoubleExponential_v_113;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_114> AgradCcdfLogDoubleExponential_v_114;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_115> AgradCcdfLogDoubleExponential_v_115;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_116> AgradCcdfLogDoubleExponential_v_116;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_117> AgradCcdfLogDoubleExponential_v_117;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_118> AgradCcdfLogDoubleExponential_v_118;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_119> AgradCcdfLogDoubleExponential_v_119;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_120> AgradCcdfLogDoubleExponential_v_120;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_121> AgradCcdfLogDoubleExponential_v_121;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_122> AgradCcdfLogDoubleExponential_v_122;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_123> AgradCcdfLogDoubleExponential_v_123;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_124> AgradCcdfLogDoubleExponential_v_124;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_125> AgradCcdfLogDoubleExponential_v_125;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_126> AgradCcdfLogDoubleExponential_v_126;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_127> AgradCcdfLogDoubleExponential_v_127;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_128> AgradCcdfLogDoubleExponential_v_128;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_129> AgradCcdfLogDoubleExponential_v_129;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_130> AgradCcdfLogDoubleExponential_v_130;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_131> AgradCcdfLogDoubleExponential_v_131;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_132> AgradCcdfLogDoubleExponential_v_132;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_133> AgradCcdfLogDoubleExponential_v_133;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_134> AgradCcdfLogDoubleExponential_v_134;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_135> AgradCcdfLogDoubleExponential_v_135;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_136> AgradCcdfLogDoubleExponential_v_136;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_137> AgradCcdfLogDoubleExponential_v_137;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_138> AgradCcdfLogDoubleExponential_v_138;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_139> AgradCcdfLogDoubleExponential_v_139;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_140> AgradCcdfLogDoubleExponential_v_140;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_141> AgradCcdfLogDoubleExponential_v_141;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_142> AgradCcdfLogDoubleExponential_v_142;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_143> AgradCcdfLogDoubleExponential_v_143;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_144> AgradCcdfLogDoubleExponential_v_144;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_145> AgradCcdfLogDoubleExponential_v_145;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_146> AgradCcdfLogDoubleExponential_v_146;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_147> AgradCcdfLogDoubleExponential_v_147;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_148> AgradCcdfLogDoubleExponential_v_148;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_149> AgradCcdfLogDoubleExponential_v_149;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_150> AgradCcdfLogDoubleExponential_v_150;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_151> AgradCcdfLogDoubleExponential_v_151;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_152> AgradCcdfLogDoubleExponential_v_152;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_153> AgradCcdfLogDoubleExponential_v_153;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_154> AgradCcdfLogDoubleExponential_v_154;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_155> AgradCcdfLogDoubleExponential_v_155;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_156> AgradCcdfLogDoubleExponential_v_156;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_157> AgradCcdfLogDoubleExponential_v_157;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_158> AgradCcdfLogDoubleExponential_v_158;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_159> AgradCcdfLogDoubleExponential_v_159;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_160> AgradCcdfLogDoubleExponential_v_160;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_161> AgradCcdfLogDoubleExponential_v_161;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_162> AgradCcdfLogDoubleExponential_v_162;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_163> AgradCcdfLogDoubleExponential_v_163;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_164> AgradCcdfLogDoubleExponential_v_164;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_165> AgradCcdfLogDoubleExponential_v_165;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_166> AgradCcdfLogDoubleExponential_v_166;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_167> AgradCcdfLogDoubleExponential_v_167;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_168> AgradCcdfLogDoubleExponential_v_168;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_169> AgradCcdfLogDoubleExponential_v_169;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_170> AgradCcdfLogDoubleExponential_v_170;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_171> AgradCcdfLogDoubleExponential_v_171;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_172> AgradCcdfLogDoubleExponential_v_172;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_173> AgradCcdfLogDoubleExponential_v_173;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_174> AgradCcdfLogDoubleExponential_v_174;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_175> AgradCcdfLogDoubleExponential_v_175;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_176> AgradCcdfLogDoubleExponential_v_176;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_177> AgradCcdfLogDoubleExponential_v_177;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_178> AgradCcdfLogDoubleExponential_v_178;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_179> AgradCcdfLogDoubleExponential_v_179;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_180> AgradCcdfLogDoubleExponential_v_180;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_181> AgradCcdfLogDoubleExponential_v_181;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_182> AgradCcdfLogDoubleExponential_v_182;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_183> AgradCcdfLogDoubleExponential_v_183;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_184> AgradCcdfLogDoubleExponential_v_184;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_185> AgradCcdfLogDoubleExponential_v_185;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_186> AgradCcdfLogDoubleExponential_v_186;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_187> AgradCcdfLogDoubleExponential_v_187;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_188> AgradCcdfLogDoubleExponential_v_188;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_189> AgradCcdfLogDoubleExponential_v_189;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_190> AgradCcdfLogDoubleExponential_v_190;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_191> AgradCcdfLogDoubleExponential_v_191;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_192> AgradCcdfLogDoubleExponential_v_192;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_193> AgradCcdfLogDoubleExponential_v_193;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_194> AgradCcdfLogDoubleExponential_v_194;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_195> AgradCcdfLogDoubleExponential_v_195;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_196> AgradCcdfLogDoubleExponential_v_196;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_197> AgradCcdfLogDoubleExponential_v_197;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_198> AgradCcdfLogDoubleExponential_v_198;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_199> AgradCcdfLogDoubleExponential_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_100, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_101, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_102, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_103, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_104, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_105, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_106, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_107, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_108, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_109, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_110, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_111, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_112, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_113, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_114, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_115, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_116, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_117, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_118, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_119, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_120, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_121, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_122, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_123, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_124, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_125, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_126, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_127, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_128, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_129, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_130, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_131, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_132, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_133, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_134, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_135, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_136, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_137, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_138, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_139, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_140, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_141, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_142, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_143, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_144, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_145, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_146, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_147, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_148, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_149, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_150, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_151, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_152, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_153, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_154, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_155, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_156, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_157, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_158, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_159, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_160, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_161, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_162, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_163, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_164, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_165, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_166, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_167, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_168, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_169, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_170, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_171, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_172, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_173, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_174, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_175, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_176, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_177, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_178, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_179, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_180, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_181, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_182, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_183, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_184, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_185, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_186, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_187, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_188, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_189, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_190, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_191, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_192, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_193, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_194, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_195, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_196, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_197, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_198, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_199, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_100> AgradCcdfLogDoubleExponential_vv_100;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_101> AgradCcdfLogDoubleExponential_vv_101;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_102> AgradCcdfLogDoubleExponential_vv_102;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_103> AgradCcdfLogDoubleExponential_vv_103;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_104> AgradCcdfLogDoubleExponential_vv_104;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_105> AgradCcdfLogDoubleExponential_vv_105;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_106> AgradCcdfLogDoubleExponential_vv_106;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_107> AgradCcdfLogDoubleExponential_vv_107;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_108> AgradCcdfLogDoubleExponential_vv_108;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_109> AgradCcdfLogDoubleExponential_vv_109;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_110> AgradCcdfLogDoubleExponential_vv_110;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_111> AgradCcdfLogDoubleExponential_vv_111;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_112> AgradCcdfLogDoubleExponential_vv_112;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_113> AgradCcdfLogDoubleExponential_vv_113;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_114> AgradCcdfLogDoubleExponential_vv_114;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_115> AgradCcdfLogDoubleExponential_vv_115;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_116> AgradCcdfLogDoubleExponential_vv_116;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_117> AgradCcdfLogDoubleExponential_vv_117;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_118> AgradCcdfLogDoubleExponential_vv_118;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_119> AgradCcdfLogDoubleExponential_vv_119;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_120> AgradCcdfLogDoubleExponential_vv_120;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_121> AgradCcdfLogDoubleExponential_vv_121;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_122> AgradCcdfLogDoubleExponential_vv_122;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_123> AgradCcdfLogDoubleExponential_vv_123;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_124> AgradCcdfLogDoubleExponential_vv_124;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_125> AgradCcdfLogDoubleExponential_vv_125;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_126> AgradCcdfLogDoubleExponential_vv_126;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_127> AgradCcdfLogDoubleExponential_vv_127;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_128> AgradCcdfLogDoubleExponential_vv_128;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_129> AgradCcdfLogDoubleExponential_vv_129;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_130> AgradCcdfLogDoubleExponential_vv_130;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_131> AgradCcdfLogDoubleExponential_vv_131;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_132> AgradCcdfLogDoubleExponential_vv_132;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_133> AgradCcdfLogDoubleExponential_vv_133;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_134> AgradCcdfLogDoubleExponential_vv_134;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_135> AgradCcdfLogDoubleExponential_vv_135;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_136> AgradCcdfLogDoubleExponential_vv_136;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_137> AgradCcdfLogDoubleExponential_vv_137;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_138> AgradCcdfLogDoubleExponential_vv_138;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_139> AgradCcdfLogDoubleExponential_vv_139;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_140> AgradCcdfLogDoubleExponential_vv_140;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_141> AgradCcdfLogDoubleExponential_vv_141;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_142> AgradCcdfLogDoubleExponential_vv_142;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_143> AgradCcdfLogDoubleExponential_vv_143;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_144> AgradCcdfLogDoubleExponential_vv_144;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_145> AgradCcdfLogDoubleExponential_vv_145;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_146> AgradCcdfLogDoubleExponential_vv_146;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_147> AgradCcdfLogDoubleExponential_vv_147;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_148> AgradCcdfLogDoubleExponential_vv_148;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_149> AgradCcdfLogDoubleExponential_vv_149;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_150> AgradCcdfLogDoubleExponential_vv_150;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_151> AgradCcdfLogDoubleExponential_vv_151;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_152> AgradCcdfLogDoubleExponential_vv_152;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_153> AgradCcdfLogDoubleExponential_vv_153;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_154> AgradCcdfLogDoubleExponential_vv_154;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_155> AgradCcdfLogDoubleExponential_vv_155;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_156> AgradCcdfLogDoubleExponential_vv_156;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_157> AgradCcdfLogDoubleExponential_vv_157;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_158> AgradCcdfLogDoubleExponential_vv_158;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_159> AgradCcdfLogDoubleExponential_vv_159;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_160> AgradCcdfLogDoubleExponential_vv_160;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_161> AgradCcdfLogDoubleExponential_vv_161;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_162> AgradCcdfLogDoubleExponential_vv_162;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_163> AgradCcdfLogDoubleExponential_vv_163;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_164> AgradCcdfLogDoubleExponential_vv_164;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_165> AgradCcdfLogDoubleExponential_vv_165;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_166> AgradCcdfLogDoubleExponential_vv_166;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_167> AgradCcdfLogDoubleExponential_vv_167;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_168> AgradCcdfLogDoubleExponential_vv_168;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_169> AgradCcdfLogDoubleExponential_vv_169;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_170> AgradCcdfLogDoubleExponential_vv_170;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_171> AgradCcdfLogDoubleExponential_vv_171;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_172> AgradCcdfLogDoubleExponential_vv_172;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_173> AgradCcdfLogDoubleExponential_vv_173;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_174> AgradCcdfLogDoubleExponential_vv_174;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_175> AgradCcdfLogDoubleExponential_vv_175;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_176> AgradCcdfLogDoubleExponential_vv_176;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_177> AgradCcdfLogDoubleExponential_vv_177;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_178> AgradCcdfLogDoubleExponential_vv_178;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_179> AgradCcdfLogDoubleExponential_vv_179;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_180> AgradCcdfLogDoubleExponential_vv_180;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_181> AgradCcdfLogDoubleExponential_vv_181;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_182> AgradCcdfLogDoubleExponential_vv_182;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_183> AgradCcdfLogDoubleExponential_vv_183;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_184> AgradCcdfLogDoubleExponential_vv_184;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_185> AgradCcdfLogDoubleExponential_vv_185;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_186> AgradCcdfLogDoubleExponential_vv_186;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_187> AgradCcdfLogDoubleExponential_vv_187;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_vv_188> AgradCcdfLogDoubleExponential_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_vv_188);
+
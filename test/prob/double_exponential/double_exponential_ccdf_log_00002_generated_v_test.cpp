@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_200> AgradCcdfLogDoubleExponential_v_200;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_201> AgradCcdfLogDoubleExponential_v_201;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_202> AgradCcdfLogDoubleExponential_v_202;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_203> AgradCcdfLogDoubleExponential_v_203;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_204> AgradCcdfLogDoubleExponential_v_204;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_205> AgradCcdfLogDoubleExponential_v_205;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_206> AgradCcdfLogDoubleExponential_v_206;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_207> AgradCcdfLogDoubleExponential_v_207;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_208> AgradCcdfLogDoubleExponential_v_208;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_209> AgradCcdfLogDoubleExponential_v_209;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_210> AgradCcdfLogDoubleExponential_v_210;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_211> AgradCcdfLogDoubleExponential_v_211;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_212> AgradCcdfLogDoubleExponential_v_212;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_213> AgradCcdfLogDoubleExponential_v_213;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_214> AgradCcdfLogDoubleExponential_v_214;
+typedef std::tuple<AgradCcdfLogDoubleExponential, type_v_215> AgradCcdfLogDoubleExponential_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_200, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_201, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_202, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_203, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_204, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_205, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_206, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_207, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_208, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_209, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_210, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_211, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_212, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_213, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_214, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogDoubleExponential_v_215, AgradCcdfLogTestFixture, AgradCcdfLogDoubleExponential_v_215);
+
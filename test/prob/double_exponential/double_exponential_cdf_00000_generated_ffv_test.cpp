@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_cdf_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_0> AgradCdfDoubleExponential_ffv_0;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_1> AgradCdfDoubleExponential_ffv_1;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_2> AgradCdfDoubleExponential_ffv_2;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_3> AgradCdfDoubleExponential_ffv_3;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_4> AgradCdfDoubleExponential_ffv_4;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_5> AgradCdfDoubleExponential_ffv_5;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_6> AgradCdfDoubleExponential_ffv_6;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_7> AgradCdfDoubleExponential_ffv_7;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_8> AgradCdfDoubleExponential_ffv_8;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_9> AgradCdfDoubleExponential_ffv_9;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_10> AgradCdfDoubleExponential_ffv_10;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_11> AgradCdfDoubleExponential_ffv_11;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_12> AgradCdfDoubleExponential_ffv_12;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_13> AgradCdfDoubleExponential_ffv_13;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_14> AgradCdfDoubleExponential_ffv_14;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_15> AgradCdfDoubleExponential_ffv_15;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_16> AgradCdfDoubleExponential_ffv_16;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_17> AgradCdfDoubleExponential_ffv_17;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_18> AgradCdfDoubleExponential_ffv_18;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_19> AgradCdfDoubleExponential_ffv_19;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_20> AgradCdfDoubleExponential_ffv_20;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_21> AgradCdfDoubleExponential_ffv_21;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_22> AgradCdfDoubleExponential_ffv_22;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_23> AgradCdfDoubleExponential_ffv_23;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_24> AgradCdfDoubleExponential_ffv_24;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_25> AgradCdfDoubleExponential_ffv_25;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_26> AgradCdfDoubleExponential_ffv_26;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_27> AgradCdfDoubleExponential_ffv_27;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_28> AgradCdfDoubleExponential_ffv_28;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_29> AgradCdfDoubleExponential_ffv_29;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_30> AgradCdfDoubleExponential_ffv_30;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_31> AgradCdfDoubleExponential_ffv_31;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_32> AgradCdfDoubleExponential_ffv_32;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_33> AgradCdfDoubleExponential_ffv_33;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_34> AgradCdfDoubleExponential_ffv_34;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_35> AgradCdfDoubleExponential_ffv_35;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_36> AgradCdfDoubleExponential_ffv_36;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_37> AgradCdfDoubleExponential_ffv_37;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_38> AgradCdfDoubleExponential_ffv_38;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_39> AgradCdfDoubleExponential_ffv_39;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_40> AgradCdfDoubleExponential_ffv_40;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_41> AgradCdfDoubleExponential_ffv_41;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_42> AgradCdfDoubleExponential_ffv_42;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_43> AgradCdfDoubleExponential_ffv_43;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_44> AgradCdfDoubleExponential_ffv_44;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_45> AgradCdfDoubleExponential_ffv_45;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_46> AgradCdfDoubleExponential_ffv_46;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_47> AgradCdfDoubleExponential_ffv_47;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_48> AgradCdfDoubleExponential_ffv_48;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_49> AgradCdfDoubleExponential_ffv_49;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_50> AgradCdfDoubleExponential_ffv_50;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_51> AgradCdfDoubleExponential_ffv_51;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_52> AgradCdfDoubleExponential_ffv_52;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_53> AgradCdfDoubleExponential_ffv_53;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_54> AgradCdfDoubleExponential_ffv_54;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_55> AgradCdfDoubleExponential_ffv_55;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_56> AgradCdfDoubleExponential_ffv_56;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_57> AgradCdfDoubleExponential_ffv_57;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_58> AgradCdfDoubleExponential_ffv_58;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_59> AgradCdfDoubleExponential_ffv_59;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_60> AgradCdfDoubleExponential_ffv_60;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_61> AgradCdfDoubleExponential_ffv_61;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_62> AgradCdfDoubleExponential_ffv_62;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_63> AgradCdfDoubleExponential_ffv_63;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_64> AgradCdfDoubleExponential_ffv_64;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_65> AgradCdfDoubleExponential_ffv_65;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_66> AgradCdfDoubleExponential_ffv_66;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_67> AgradCdfDoubleExponential_ffv_67;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_68> AgradCdfDoubleExponential_ffv_68;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_69> AgradCdfDoubleExponential_ffv_69;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_70> AgradCdfDoubleExponential_ffv_70;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_71> AgradCdfDoubleExponential_ffv_71;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_72> AgradCdfDoubleExponential_ffv_72;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_73> AgradCdfDoubleExponential_ffv_73;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_74> AgradCdfDoubleExponential_ffv_74;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_75> AgradCdfDoubleExponential_ffv_75;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_76> AgradCdfDoubleExponential_ffv_76;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_77> AgradCdfDoubleExponential_ffv_77;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_78> AgradCdfDoubleExponential_ffv_78;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_79> AgradCdfDoubleExponential_ffv_79;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_80> AgradCdfDoubleExponential_ffv_80;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_81> AgradCdfDoubleExponential_ffv_81;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_82> AgradCdfDoubleExponential_ffv_82;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_83> AgradCdfDoubleExponential_ffv_83;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_84> AgradCdfDoubleExponential_ffv_84;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_85> AgradCdfDoubleExponential_ffv_85;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_86> AgradCdfDoubleExponential_ffv_86;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_87> AgradCdfDoubleExponential_ffv_87;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_88> AgradCdfDoubleExponential_ffv_88;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_89> AgradCdfDoubleExponential_ffv_89;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_90> AgradCdfDoubleExponential_ffv_90;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_91> AgradCdfDoubleExponential_ffv_91;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_92> AgradCdfDoubleExponential_ffv_92;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_93> AgradCdfDoubleExponential_ffv_93;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_94> AgradCdfDoubleExponential_ffv_94;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_95> AgradCdfDoubleExponential_ffv_95;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_96> AgradCdfDoubleExponential_ffv_96;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_97> AgradCdfDoubleExponential_ffv_97;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_98> AgradCdfDoubleExponential_ffv_98;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_99> AgradCdfDoubleExponential_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_0, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_1, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_2, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_3, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_4, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_5, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_6, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_7, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_8, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_9, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_10, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_11, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_12, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_13, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_14, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_15, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_16, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_17, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_18, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_19, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_20, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_21, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_22, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_23, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_24, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_25, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_26, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_27, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_28, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_29, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_30, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_31, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_32, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_33, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_34, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_35, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_36, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_37, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_38, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_39, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_40, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_41, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_42, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_43, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_44, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_45, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_46, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_47, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_48, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_49, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_50, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_51, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_52, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_53, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_54, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_55, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_56, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_57, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_58, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_59, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_60, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_61, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_62, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_63, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_64, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_65, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_66, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_67, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_68, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_69, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_70, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_71, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_72, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_73, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_74, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_75, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_76, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_77, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_78, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_79, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_80, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_81, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_82, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_83, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_84, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_85, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_86, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_87, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_88, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_89, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_90, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_91, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_92, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_93, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_94, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_95, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_96, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_97, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_98, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_99, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfDoubleExponential, type_v_0> AgradCdfDoubleExponential_v_0;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_1> AgradCdfDoubleExponential_v_1;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_2> AgradCdfDoubleExponential_v_2;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_3> AgradCdfDoubleExponential_v_3;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_4> AgradCdfDoubleExponential_v_4;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_5> AgradCdfDoubleExponential_v_5;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_6> AgradCdfDoubleExponential_v_6;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_7> AgradCdfDoubleExponential_v_7;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_8> AgradCdfDoubleExponential_v_8;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_9> AgradCdfDoubleExponential_v_9;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_10> AgradCdfDoubleExponential_v_10;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_11> AgradCdfDoubleExponential_v_11;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_12> AgradCdfDoubleExponential_v_12;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_13> AgradCdfDoubleExponential_v_13;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_14> AgradCdfDoubleExponential_v_14;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_15> AgradCdfDoubleExponential_v_15;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_16> AgradCdfDoubleExponential_v_16;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_17> AgradCdfDoubleExponential_v_17;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_18> AgradCdfDoubleExponential_v_18;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_19> AgradCdfDoubleExponential_v_19;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_20> AgradCdfDoubleExponential_v_20;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_21> AgradCdfDoubleExponential_v_21;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_22> AgradCdfDoubleExponential_v_22;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_23> AgradCdfDoubleExponential_v_23;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_24> AgradCdfDoubleExponential_v_24;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_25> AgradCdfDoubleExponential_v_25;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_26> AgradCdfDoubleExponential_v_26;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_27> AgradCdfDoubleExponential_v_27;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_28> AgradCdfDoubleExponential_v_28;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_29> AgradCdfDoubleExponential_v_29;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_30> AgradCdfDoubleExponential_v_30;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_31> AgradCdfDoubleExponential_v_31;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_32> AgradCdfDoubleExponential_v_32;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_33> AgradCdfDoubleExponential_v_33;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_34> AgradCdfDoubleExponential_v_34;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_35> AgradCdfDoubleExponential_v_35;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_36> AgradCdfDoubleExponential_v_36;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_37> AgradCdfDoubleExponential_v_37;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_38> AgradCdfDoubleExponential_v_38;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_39> AgradCdfDoubleExponential_v_39;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_40> AgradCdfDoubleExponential_v_40;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_41> AgradCdfDoubleExponential_v_41;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_42> AgradCdfDoubleExponential_v_42;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_43> AgradCdfDoubleExponential_v_43;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_44> AgradCdfDoubleExponential_v_44;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_45> AgradCdfDoubleExponential_v_45;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_46> AgradCdfDoubleExponential_v_46;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_47> AgradCdfDoubleExponential_v_47;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_48> AgradCdfDoubleExponential_v_48;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_49> AgradCdfDoubleExponential_v_49;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_50> AgradCdfDoubleExponential_v_50;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_51> AgradCdfDoubleExponential_v_51;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_52> AgradCdfDoubleExponential_v_52;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_53> AgradCdfDoubleExponential_v_53;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_54> AgradCdfDoubleExponential_v_54;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_55> AgradCdfDoubleExponential_v_55;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_56> AgradCdfDoubleExponential_v_56;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_57> AgradCdfDoubleExponential_v_57;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_58> AgradCdfDoubleExponential_v_58;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_59> AgradCdfDoubleExponential_v_59;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_60> AgradCdfDoubleExponential_v_60;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_61> AgradCdfDoubleExponential_v_61;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_62> AgradCdfDoubleExponential_v_62;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_63> AgradCdfDoubleExponential_v_63;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_64> AgradCdfDoubleExponential_v_64;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_65> AgradCdfDoubleExponential_v_65;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_66> AgradCdfDoubleExponential_v_66;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_67> AgradCdfDoubleExponential_v_67;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_68> AgradCdfDoubleExponential_v_68;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_69> AgradCdfDoubleExponential_v_69;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_70> AgradCdfDoubleExponential_v_70;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_71> AgradCdfDoubleExponential_v_71;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_72> AgradCdfDoubleExponential_v_72;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_73> AgradCdfDoubleExponential_v_73;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_74> AgradCdfDoubleExponential_v_74;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_75> AgradCdfDoubleExponential_v_75;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_76> AgradCdfDoubleExponential_v_76;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_77> AgradCdfDoubleExponential_v_77;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_78> AgradCdfDoubleExponential_v_78;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_79> AgradCdfDoubleExponential_v_79;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_80> AgradCdfDoubleExponential_v_80;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_81> AgradCdfDoubleExponential_v_81;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_82> AgradCdfDoubleExponential_v_82;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_83> AgradCdfDoubleExponential_v_83;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_84> AgradCdfDoubleExponential_v_84;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_85> AgradCdfDoubleExponential_v_85;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_86> AgradCdfDoubleExponential_v_86;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_87> AgradCdfDoubleExponential_v_87;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_88> AgradCdfDoubleExponential_v_88;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_89> AgradCdfDoubleExponential_v_89;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_90> AgradCdfDoubleExponential_v_90;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_91> AgradCdfDoubleExponential_v_91;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_92> AgradCdfDoubleExponential_v_92;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_93> AgradCdfDoubleExponential_v_93;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_94> AgradCdfDoubleExponential_v_94;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_95> AgradCdfDoubleExponential_v_95;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_96> AgradCdfDoubleExponential_v_96;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_97> AgradCdfDoubleExponential_v_97;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_98> AgradCdfDoubleExponential_v_98;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_99> AgradCdfDoubleExponential_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_0, AgradCdfTestFixture, AgradCdfDoubleExponential_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_1, AgradCdfTestFixture, AgradCdfDoubleExponential_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_2, AgradCdfTestFixture, AgradCdfDoubleExponential_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_3, AgradCdfTestFixture, AgradCdfDoubleExponential_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_4, AgradCdfTestFixture, AgradCdfDoubleExponential_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_5, AgradCdfTestFixture, AgradCdfDoubleExponential_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_6, AgradCdfTestFixture, AgradCdfDoubleExponential_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_7, AgradCdfTestFixture, AgradCdfDoubleExponential_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_8, AgradCdfTestFixture, AgradCdfDoubleExponential_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_9, AgradCdfTestFixture, AgradCdfDoubleExponential_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_10, AgradCdfTestFixture, AgradCdfDoubleExponential_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_11, AgradCdfTestFixture, AgradCdfDoubleExponential_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_12, AgradCdfTestFixture, AgradCdfDoubleExponential_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_13, AgradCdfTestFixture, AgradCdfDoubleExponential_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_14, AgradCdfTestFixture, AgradCdfDoubleExponential_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_15, AgradCdfTestFixture, AgradCdfDoubleExponential_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_16, AgradCdfTestFixture, AgradCdfDoubleExponential_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_17, AgradCdfTestFixture, AgradCdfDoubleExponential_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_18, AgradCdfTestFixture, AgradCdfDoubleExponential_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_19, AgradCdfTestFixture, AgradCdfDoubleExponential_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_20, AgradCdfTestFixture, AgradCdfDoubleExponential_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_21, AgradCdfTestFixture, AgradCdfDoubleExponential_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_22, AgradCdfTestFixture, AgradCdfDoubleExponential_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_23, AgradCdfTestFixture, AgradCdfDoubleExponential_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_24, AgradCdfTestFixture, AgradCdfDoubleExponential_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_25, AgradCdfTestFixture, AgradCdfDoubleExponential_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_26, AgradCdfTestFixture, AgradCdfDoubleExponential_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_27, AgradCdfTestFixture, AgradCdfDoubleExponential_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_28, AgradCdfTestFixture, AgradCdfDoubleExponential_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_29, AgradCdfTestFixture, AgradCdfDoubleExponential_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_30, AgradCdfTestFixture, AgradCdfDoubleExponential_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_31, AgradCdfTestFixture, AgradCdfDoubleExponential_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_32, AgradCdfTestFixture, AgradCdfDoubleExponential_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_33, AgradCdfTestFixture, AgradCdfDoubleExponential_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_34, AgradCdfTestFixture, AgradCdfDoubleExponential_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_35, AgradCdfTestFixture, AgradCdfDoubleExponential_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_36, AgradCdfTestFixture, AgradCdfDoubleExponential_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_37, AgradCdfTestFixture, AgradCdfDoubleExponential_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_38, AgradCdfTestFixture, AgradCdfDoubleExponential_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_39, AgradCdfTestFixture, AgradCdfDoubleExponential_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_40, AgradCdfTestFixture, AgradCdfDoubleExponential_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_41, AgradCdfTestFixture, AgradCdfDoubleExponential_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_42, AgradCdfTestFixture, AgradCdfDoubleExponential_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_43, AgradCdfTestFixture, AgradCdfDoubleExponential_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_44, AgradCdfTestFixture, AgradCdfDoubleExponential_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_45, AgradCdfTestFixture, AgradCdfDoubleExponential_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_46, AgradCdfTestFixture, AgradCdfDoubleExponential_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_47, AgradCdfTestFixture, AgradCdfDoubleExponential_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_48, AgradCdfTestFixture, AgradCdfDoubleExponential_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_49, AgradCdfTestFixture, AgradCdfDoubleExponential_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_50, AgradCdfTestFixture, AgradCdfDoubleExponential_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_51, AgradCdfTestFixture, AgradCdfDoubleExponential_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_52, AgradCdfTestFixture, AgradCdfDoubleExponential_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_53, AgradCdfTestFixture, AgradCdfDoubleExponential_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_54, AgradCdfTestFixture, AgradCdfDoubleExponential_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_55, AgradCdfTestFixture, AgradCdfDoubleExponential_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_56, AgradCdfTestFixture, AgradCdfDoubleExponential_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_57, AgradCdfTestFixture, AgradCdfDoubleExponential_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_58, AgradCdfTestFixture, AgradCdfDoubleExponential_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_59, AgradCdfTestFixture, AgradCdfDoubleExponential_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_60, AgradCdfTestFixture, AgradCdfDoubleExponential_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_61, AgradCdfTestFixture, AgradCdfDoubleExponential_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_62, AgradCdfTestFixture, AgradCdfDoubleExponential_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_63, AgradCdfTestFixture, AgradCdfDoubleExponential_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_64, AgradCdfTestFixture, AgradCdfDoubleExponential_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_65, AgradCdfTestFixture, AgradCdfDoubleExponential_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_66, AgradCdfTestFixture, AgradCdfDoubleExponential_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_67, AgradCdfTestFixture, AgradCdfDoubleExponential_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_68, AgradCdfTestFixture, AgradCdfDoubleExponential_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_69, AgradCdfTestFixture, AgradCdfDoubleExponential_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_70, AgradCdfTestFixture, AgradCdfDoubleExponential_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_71, AgradCdfTestFixture, AgradCdfDoubleExponential_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_72, AgradCdfTestFixture, AgradCdfDoubleExponential_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_73, AgradCdfTestFixture, AgradCdfDoubleExponential_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_74, AgradCdfTestFixture, AgradCdfDoubleExponential_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_75, AgradCdfTestFixture, AgradCdfDoubleExponential_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_76, AgradCdfTestFixture, AgradCdfDoubleExponential_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_77, AgradCdfTestFixture, AgradCdfDoubleExponential_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_78, AgradCdfTestFixture, AgradCdfDoubleExponential_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_79, AgradCdfTestFixture, AgradCdfDoubleExponential_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_80, AgradCdfTestFixture, AgradCdfDoubleExponential_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_81, AgradCdfTestFixture, AgradCdfDoubleExponential_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_82, AgradCdfTestFixture, AgradCdfDoubleExponential_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_83, AgradCdfTestFixture, AgradCdfDoubleExponential_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_84, AgradCdfTestFixture, AgradCdfDoubleExponential_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_85, AgradCdfTestFixture, AgradCdfDoubleExponential_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_86, AgradCdfTestFixture, AgradCdfDoubleExponential_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_87, AgradCdfTestFixture, AgradCdfDoubleExponential_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_88, AgradCdfTestFixture, AgradCdfDoubleExponential_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_89, AgradCdfTestFixture, AgradCdfDoubleExponential_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_90, AgradCdfTestFixture, AgradCdfDoubleExponential_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_91, AgradCdfTestFixture, AgradCdfDoubleExponential_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_92, AgradCdfTestFixture, AgradCdfDoubleExponential_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_93, AgradCdfTestFixture, AgradCdfDoubleExponential_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_94, AgradCdfTestFixture, AgradCdfDoubleExponential_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_95, AgradCdfTestFixture, AgradCdfDoubleExponential_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_96, AgradCdfTestFixture, AgradCdfDoubleExponential_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_97, AgradCdfTestFixture, AgradCdfDoubleExponential_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_98, AgradCdfTestFixture, AgradCdfDoubleExponential_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_99, AgradCdfTestFixture, AgradCdfDoubleExponential_v_99);
+
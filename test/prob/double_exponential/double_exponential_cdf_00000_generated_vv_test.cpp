@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_cdf_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_0> AgradCdfDoubleExponential_vv_0;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_1> AgradCdfDoubleExponential_vv_1;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_2> AgradCdfDoubleExponential_vv_2;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_3> AgradCdfDoubleExponential_vv_3;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_4> AgradCdfDoubleExponential_vv_4;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_5> AgradCdfDoubleExponential_vv_5;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_6> AgradCdfDoubleExponential_vv_6;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_7> AgradCdfDoubleExponential_vv_7;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_8> AgradCdfDoubleExponential_vv_8;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_9> AgradCdfDoubleExponential_vv_9;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_10> AgradCdfDoubleExponential_vv_10;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_11> AgradCdfDoubleExponential_vv_11;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_12> AgradCdfDoubleExponential_vv_12;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_13> AgradCdfDoubleExponential_vv_13;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_14> AgradCdfDoubleExponential_vv_14;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_15> AgradCdfDoubleExponential_vv_15;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_16> AgradCdfDoubleExponential_vv_16;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_17> AgradCdfDoubleExponential_vv_17;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_18> AgradCdfDoubleExponential_vv_18;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_19> AgradCdfDoubleExponential_vv_19;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_20> AgradCdfDoubleExponential_vv_20;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_21> AgradCdfDoubleExponential_vv_21;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_22> AgradCdfDoubleExponential_vv_22;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_23> AgradCdfDoubleExponential_vv_23;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_24> AgradCdfDoubleExponential_vv_24;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_25> AgradCdfDoubleExponential_vv_25;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_26> AgradCdfDoubleExponential_vv_26;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_27> AgradCdfDoubleExponential_vv_27;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_28> AgradCdfDoubleExponential_vv_28;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_29> AgradCdfDoubleExponential_vv_29;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_30> AgradCdfDoubleExponential_vv_30;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_31> AgradCdfDoubleExponential_vv_31;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_32> AgradCdfDoubleExponential_vv_32;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_33> AgradCdfDoubleExponential_vv_33;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_34> AgradCdfDoubleExponential_vv_34;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_35> AgradCdfDoubleExponential_vv_35;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_36> AgradCdfDoubleExponential_vv_36;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_37> AgradCdfDoubleExponential_vv_37;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_38> AgradCdfDoubleExponential_vv_38;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_39> AgradCdfDoubleExponential_vv_39;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_40> AgradCdfDoubleExponential_vv_40;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_41> AgradCdfDoubleExponential_vv_41;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_42> AgradCdfDoubleExponential_vv_42;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_43> AgradCdfDoubleExponential_vv_43;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_44> AgradCdfDoubleExponential_vv_44;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_45> AgradCdfDoubleExponential_vv_45;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_46> AgradCdfDoubleExponential_vv_46;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_47> AgradCdfDoubleExponential_vv_47;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_48> AgradCdfDoubleExponential_vv_48;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_49> AgradCdfDoubleExponential_vv_49;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_50> AgradCdfDoubleExponential_vv_50;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_51> AgradCdfDoubleExponential_vv_51;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_52> AgradCdfDoubleExponential_vv_52;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_53> AgradCdfDoubleExponential_vv_53;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_54> AgradCdfDoubleExponential_vv_54;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_55> AgradCdfDoubleExponential_vv_55;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_56> AgradCdfDoubleExponential_vv_56;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_57> AgradCdfDoubleExponential_vv_57;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_58> AgradCdfDoubleExponential_vv_58;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_59> AgradCdfDoubleExponential_vv_59;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_60> AgradCdfDoubleExponential_vv_60;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_61> AgradCdfDoubleExponential_vv_61;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_62> AgradCdfDoubleExponential_vv_62;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_63> AgradCdfDoubleExponential_vv_63;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_64> AgradCdfDoubleExponential_vv_64;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_65> AgradCdfDoubleExponential_vv_65;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_66> AgradCdfDoubleExponential_vv_66;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_67> AgradCdfDoubleExponential_vv_67;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_68> AgradCdfDoubleExponential_vv_68;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_69> AgradCdfDoubleExponential_vv_69;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_70> AgradCdfDoubleExponential_vv_70;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_71> AgradCdfDoubleExponential_vv_71;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_72> AgradCdfDoubleExponential_vv_72;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_73> AgradCdfDoubleExponential_vv_73;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_74> AgradCdfDoubleExponential_vv_74;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_75> AgradCdfDoubleExponential_vv_75;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_76> AgradCdfDoubleExponential_vv_76;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_77> AgradCdfDoubleExponential_vv_77;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_78> AgradCdfDoubleExponential_vv_78;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_79> AgradCdfDoubleExponential_vv_79;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_80> AgradCdfDoubleExponential_vv_80;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_81> AgradCdfDoubleExponential_vv_81;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_82> AgradCdfDoubleExponential_vv_82;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_83> AgradCdfDoubleExponential_vv_83;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_84> AgradCdfDoubleExponential_vv_84;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_85> AgradCdfDoubleExponential_vv_85;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_86> AgradCdfDoubleExponential_vv_86;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_87> AgradCdfDoubleExponential_vv_87;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_88> AgradCdfDoubleExponential_vv_88;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_89> AgradCdfDoubleExponential_vv_89;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_90> AgradCdfDoubleExponential_vv_90;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_91> AgradCdfDoubleExponential_vv_91;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_92> AgradCdfDoubleExponential_vv_92;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_93> AgradCdfDoubleExponential_vv_93;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_94> AgradCdfDoubleExponential_vv_94;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_95> AgradCdfDoubleExponential_vv_95;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_96> AgradCdfDoubleExponential_vv_96;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_97> AgradCdfDoubleExponential_vv_97;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_98> AgradCdfDoubleExponential_vv_98;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_99> AgradCdfDoubleExponential_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_0, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_1, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_2, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_3, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_4, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_5, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_6, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_7, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_8, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_9, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_10, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_11, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_12, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_13, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_14, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_15, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_16, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_17, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_18, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_19, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_20, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_21, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_22, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_23, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_24, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_25, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_26, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_27, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_28, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_29, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_30, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_31, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_32, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_33, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_34, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_35, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_36, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_37, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_38, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_39, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_40, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_41, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_42, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_43, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_44, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_45, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_46, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_47, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_48, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_49, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_50, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_51, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_52, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_53, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_54, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_55, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_56, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_57, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_58, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_59, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_60, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_61, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_62, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_63, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_64, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_65, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_66, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_67, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_68, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_69, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_70, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_71, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_72, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_73, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_74, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_75, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_76, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_77, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_78, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_79, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_80, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_81, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_82, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_83, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_84, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_85, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_86, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_87, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_88, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_89, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_90, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_91, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_92, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_93, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_94, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_95, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_96, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_97, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_98, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_99, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_100> AgradCdfDoubleExponential_ffv_100;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_101> AgradCdfDoubleExponential_ffv_101;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_102> AgradCdfDoubleExponential_ffv_102;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_103> AgradCdfDoubleExponential_ffv_103;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_104> AgradCdfDoubleExponential_ffv_104;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_105> AgradCdfDoubleExponential_ffv_105;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_106> AgradCdfDoubleExponential_ffv_106;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_107> AgradCdfDoubleExponential_ffv_107;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_108> AgradCdfDoubleExponential_ffv_108;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_109> AgradCdfDoubleExponential_ffv_109;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_110> AgradCdfDoubleExponential_ffv_110;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_111> AgradCdfDoubleExponential_ffv_111;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_112> AgradCdfDoubleExponential_ffv_112;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_113> AgradCdfDoubleExponential_ffv_113;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_114> AgradCdfDoubleExponential_ffv_114;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_115> AgradCdfDoubleExponential_ffv_115;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_116> AgradCdfDoubleExponential_ffv_116;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_117> AgradCdfDoubleExponential_ffv_117;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_118> AgradCdfDoubleExponential_ffv_118;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_119> AgradCdfDoubleExponential_ffv_119;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_120> AgradCdfDoubleExponential_ffv_120;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_121> AgradCdfDoubleExponential_ffv_121;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_122> AgradCdfDoubleExponential_ffv_122;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_123> AgradCdfDoubleExponential_ffv_123;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_124> AgradCdfDoubleExponential_ffv_124;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_125> AgradCdfDoubleExponential_ffv_125;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_126> AgradCdfDoubleExponential_ffv_126;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_127> AgradCdfDoubleExponential_ffv_127;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_128> AgradCdfDoubleExponential_ffv_128;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_129> AgradCdfDoubleExponential_ffv_129;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_130> AgradCdfDoubleExponential_ffv_130;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_131> AgradCdfDoubleExponential_ffv_131;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_132> AgradCdfDoubleExponential_ffv_132;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_133> AgradCdfDoubleExponential_ffv_133;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_134> AgradCdfDoubleExponential_ffv_134;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_135> AgradCdfDoubleExponential_ffv_135;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_136> AgradCdfDoubleExponential_ffv_136;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_137> AgradCdfDoubleExponential_ffv_137;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_138> AgradCdfDoubleExponential_ffv_138;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_139> AgradCdfDoubleExponential_ffv_139;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_140> AgradCdfDoubleExponential_ffv_140;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_141> AgradCdfDoubleExponential_ffv_141;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_142> AgradCdfDoubleExponential_ffv_142;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_143> AgradCdfDoubleExponential_ffv_143;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_144> AgradCdfDoubleExponential_ffv_144;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_145> AgradCdfDoubleExponential_ffv_145;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_146> AgradCdfDoubleExponential_ffv_146;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_147> AgradCdfDoubleExponential_ffv_147;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_148> AgradCdfDoubleExponential_ffv_148;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_149> AgradCdfDoubleExponential_ffv_149;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_150> AgradCdfDoubleExponential_ffv_150;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_151> AgradCdfDoubleExponential_ffv_151;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_152> AgradCdfDoubleExponential_ffv_152;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_153> AgradCdfDoubleExponential_ffv_153;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_154> AgradCdfDoubleExponential_ffv_154;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_155> AgradCdfDoubleExponential_ffv_155;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_156> AgradCdfDoubleExponential_ffv_156;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_157> AgradCdfDoubleExponential_ffv_157;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_158> AgradCdfDoubleExponential_ffv_158;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_159> AgradCdfDoubleExponential_ffv_159;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_160> AgradCdfDoubleExponential_ffv_160;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_161> AgradCdfDoubleExponential_ffv_161;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_162> AgradCdfDoubleExponential_ffv_162;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_163> AgradCdfDoubleExponential_ffv_163;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_164> AgradCdfDoubleExponential_ffv_164;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_165> AgradCdfDoubleExponential_ffv_165;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_166> AgradCdfDoubleExponential_ffv_166;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_167> AgradCdfDoubleExponential_ffv_167;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_168> AgradCdfDoubleExponential_ffv_168;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_169> AgradCdfDoubleExponential_ffv_169;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_170> AgradCdfDoubleExponential_ffv_170;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_171> AgradCdfDoubleExponential_ffv_171;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_172> AgradCdfDoubleExponential_ffv_172;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_173> AgradCdfDoubleExponential_ffv_173;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_174> AgradCdfDoubleExponential_ffv_174;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_175> AgradCdfDoubleExponential_ffv_175;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_176> AgradCdfDoubleExponential_ffv_176;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_177> AgradCdfDoubleExponential_ffv_177;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_178> AgradCdfDoubleExponential_ffv_178;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_179> AgradCdfDoubleExponential_ffv_179;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_180> AgradCdfDoubleExponential_ffv_180;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_181> AgradCdfDoubleExponential_ffv_181;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_182> AgradCdfDoubleExponential_ffv_182;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_183> AgradCdfDoubleExponential_ffv_183;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_184> AgradCdfDoubleExponential_ffv_184;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_185> AgradCdfDoubleExponential_ffv_185;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_186> AgradCdfDoubleExponential_ffv_186;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_187> AgradCdfDoubleExponential_ffv_187;
+typedef std::tuple<AgradCdfDoubleExponential, type_ffv_188> AgradCdfDoubleExponential_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_100, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_101, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_102, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_103, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_104, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_105, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_106, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_107, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_108, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_109, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_110, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_111, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_112, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_113, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_114, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_115, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_116, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_117, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_118, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_119, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_120, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_121, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_122, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_123, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_124, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_125, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_126, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_127, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_128, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_129, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_130, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_131, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_132, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_133, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_134, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_135, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_136, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_137, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_138, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_139, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_140, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_141, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_142, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_143, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_144, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_145, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_146, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_147, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_148, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_149, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_150, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_151, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_152, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_153, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_154, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_155, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_156, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_157, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_158, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_159, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_160, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_161, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_162, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_163, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_164, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_165, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_166, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_167, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_168, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_169, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_170, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_171, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_172, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_173, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_174, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_175, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_176, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_177, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_178, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_179, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_180, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_181, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_182, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_183, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_184, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_185, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_186, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_187, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_ffv_188, AgradCdfTestFixture, AgradCdfDoubleExponential_ffv_188);
+
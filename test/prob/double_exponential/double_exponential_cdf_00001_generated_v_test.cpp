@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfDoubleExponential, type_v_100> AgradCdfDoubleExponential_v_100;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_101> AgradCdfDoubleExponential_v_101;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_102> AgradCdfDoubleExponential_v_102;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_103> AgradCdfDoubleExponential_v_103;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_104> AgradCdfDoubleExponential_v_104;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_105> AgradCdfDoubleExponential_v_105;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_106> AgradCdfDoubleExponential_v_106;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_107> AgradCdfDoubleExponential_v_107;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_108> AgradCdfDoubleExponential_v_108;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_109> AgradCdfDoubleExponential_v_109;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_110> AgradCdfDoubleExponential_v_110;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_111> AgradCdfDoubleExponential_v_111;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_112> AgradCdfDoubleExponential_v_112;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_113> AgradCdfDoubleExponential_v_113;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_114> AgradCdfDoubleExponential_v_114;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_115> AgradCdfDoubleExponential_v_115;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_116> AgradCdfDoubleExponential_v_116;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_117> AgradCdfDoubleExponential_v_117;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_118> AgradCdfDoubleExponential_v_118;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_119> AgradCdfDoubleExponential_v_119;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_120> AgradCdfDoubleExponential_v_120;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_121> AgradCdfDoubleExponential_v_121;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_122> AgradCdfDoubleExponential_v_122;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_123> AgradCdfDoubleExponential_v_123;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_124> AgradCdfDoubleExponential_v_124;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_125> AgradCdfDoubleExponential_v_125;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_126> AgradCdfDoubleExponential_v_126;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_127> AgradCdfDoubleExponential_v_127;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_128> AgradCdfDoubleExponential_v_128;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_129> AgradCdfDoubleExponential_v_129;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_130> AgradCdfDoubleExponential_v_130;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_131> AgradCdfDoubleExponential_v_131;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_132> AgradCdfDoubleExponential_v_132;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_133> AgradCdfDoubleExponential_v_133;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_134> AgradCdfDoubleExponential_v_134;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_135> AgradCdfDoubleExponential_v_135;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_136> AgradCdfDoubleExponential_v_136;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_137> AgradCdfDoubleExponential_v_137;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_138> AgradCdfDoubleExponential_v_138;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_139> AgradCdfDoubleExponential_v_139;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_140> AgradCdfDoubleExponential_v_140;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_141> AgradCdfDoubleExponential_v_141;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_142> AgradCdfDoubleExponential_v_142;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_143> AgradCdfDoubleExponential_v_143;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_144> AgradCdfDoubleExponential_v_144;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_145> AgradCdfDoubleExponential_v_145;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_146> AgradCdfDoubleExponential_v_146;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_147> AgradCdfDoubleExponential_v_147;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_148> AgradCdfDoubleExponential_v_148;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_149> AgradCdfDoubleExponential_v_149;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_150> AgradCdfDoubleExponential_v_150;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_151> AgradCdfDoubleExponential_v_151;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_152> AgradCdfDoubleExponential_v_152;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_153> AgradCdfDoubleExponential_v_153;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_154> AgradCdfDoubleExponential_v_154;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_155> AgradCdfDoubleExponential_v_155;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_156> AgradCdfDoubleExponential_v_156;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_157> AgradCdfDoubleExponential_v_157;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_158> AgradCdfDoubleExponential_v_158;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_159> AgradCdfDoubleExponential_v_159;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_160> AgradCdfDoubleExponential_v_160;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_161> AgradCdfDoubleExponential_v_161;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_162> AgradCdfDoubleExponential_v_162;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_163> AgradCdfDoubleExponential_v_163;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_164> AgradCdfDoubleExponential_v_164;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_165> AgradCdfDoubleExponential_v_165;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_166> AgradCdfDoubleExponential_v_166;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_167> AgradCdfDoubleExponential_v_167;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_168> AgradCdfDoubleExponential_v_168;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_169> AgradCdfDoubleExponential_v_169;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_170> AgradCdfDoubleExponential_v_170;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_171> AgradCdfDoubleExponential_v_171;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_172> AgradCdfDoubleExponential_v_172;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_173> AgradCdfDoubleExponential_v_173;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_174> AgradCdfDoubleExponential_v_174;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_175> AgradCdfDoubleExponential_v_175;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_176> AgradCdfDoubleExponential_v_176;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_177> AgradCdfDoubleExponential_v_177;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_178> AgradCdfDoubleExponential_v_178;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_179> AgradCdfDoubleExponential_v_179;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_180> AgradCdfDoubleExponential_v_180;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_181> AgradCdfDoubleExponential_v_181;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_182> AgradCdfDoubleExponential_v_182;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_183> AgradCdfDoubleExponential_v_183;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_184> AgradCdfDoubleExponential_v_184;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_185> AgradCdfDoubleExponential_v_185;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_186> AgradCdfDoubleExponential_v_186;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_187> AgradCdfDoubleExponential_v_187;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_188> AgradCdfDoubleExponential_v_188;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_189> AgradCdfDoubleExponential_v_189;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_190> AgradCdfDoubleExponential_v_190;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_191> AgradCdfDoubleExponential_v_191;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_192> AgradCdfDoubleExponential_v_192;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_193> AgradCdfDoubleExponential_v_193;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_194> AgradCdfDoubleExponential_v_194;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_195> AgradCdfDoubleExponential_v_195;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_196> AgradCdfDoubleExponential_v_196;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_197> AgradCdfDoubleExponential_v_197;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_198> AgradCdfDoubleExponential_v_198;
+typedef std::tuple<AgradCdfDoubleExponential, type_v_199> AgradCdfDoubleExponential_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_100, AgradCdfTestFixture, AgradCdfDoubleExponential_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_101, AgradCdfTestFixture, AgradCdfDoubleExponential_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_102, AgradCdfTestFixture, AgradCdfDoubleExponential_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_103, AgradCdfTestFixture, AgradCdfDoubleExponential_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_104, AgradCdfTestFixture, AgradCdfDoubleExponential_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_105, AgradCdfTestFixture, AgradCdfDoubleExponential_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_106, AgradCdfTestFixture, AgradCdfDoubleExponential_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_107, AgradCdfTestFixture, AgradCdfDoubleExponential_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_108, AgradCdfTestFixture, AgradCdfDoubleExponential_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_109, AgradCdfTestFixture, AgradCdfDoubleExponential_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_110, AgradCdfTestFixture, AgradCdfDoubleExponential_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_111, AgradCdfTestFixture, AgradCdfDoubleExponential_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_112, AgradCdfTestFixture, AgradCdfDoubleExponential_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_113, AgradCdfTestFixture, AgradCdfDoubleExponential_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_114, AgradCdfTestFixture, AgradCdfDoubleExponential_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_115, AgradCdfTestFixture, AgradCdfDoubleExponential_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_116, AgradCdfTestFixture, AgradCdfDoubleExponential_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_117, AgradCdfTestFixture, AgradCdfDoubleExponential_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_118, AgradCdfTestFixture, AgradCdfDoubleExponential_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_119, AgradCdfTestFixture, AgradCdfDoubleExponential_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_120, AgradCdfTestFixture, AgradCdfDoubleExponential_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_121, AgradCdfTestFixture, AgradCdfDoubleExponential_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_122, AgradCdfTestFixture, AgradCdfDoubleExponential_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_123, AgradCdfTestFixture, AgradCdfDoubleExponential_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_124, AgradCdfTestFixture, AgradCdfDoubleExponential_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_125, AgradCdfTestFixture, AgradCdfDoubleExponential_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_126, AgradCdfTestFixture, AgradCdfDoubleExponential_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_127, AgradCdfTestFixture, AgradCdfDoubleExponential_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_128, AgradCdfTestFixture, AgradCdfDoubleExponential_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_129, AgradCdfTestFixture, AgradCdfDoubleExponential_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_130, AgradCdfTestFixture, AgradCdfDoubleExponential_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_131, AgradCdfTestFixture, AgradCdfDoubleExponential_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_132, AgradCdfTestFixture, AgradCdfDoubleExponential_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_133, AgradCdfTestFixture, AgradCdfDoubleExponential_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_134, AgradCdfTestFixture, AgradCdfDoubleExponential_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_135, AgradCdfTestFixture, AgradCdfDoubleExponential_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_136, AgradCdfTestFixture, AgradCdfDoubleExponential_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_137, AgradCdfTestFixture, AgradCdfDoubleExponential_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_138, AgradCdfTestFixture, AgradCdfDoubleExponential_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_139, AgradCdfTestFixture, AgradCdfDoubleExponential_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_140, AgradCdfTestFixture, AgradCdfDoubleExponential_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_141, AgradCdfTestFixture, AgradCdfDoubleExponential_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_142, AgradCdfTestFixture, AgradCdfDoubleExponential_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_143, AgradCdfTestFixture, AgradCdfDoubleExponential_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_144, AgradCdfTestFixture, AgradCdfDoubleExponential_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_145, AgradCdfTestFixture, AgradCdfDoubleExponential_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_146, AgradCdfTestFixture, AgradCdfDoubleExponential_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_147, AgradCdfTestFixture, AgradCdfDoubleExponential_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_148, AgradCdfTestFixture, AgradCdfDoubleExponential_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_149, AgradCdfTestFixture, AgradCdfDoubleExponential_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_150, AgradCdfTestFixture, AgradCdfDoubleExponential_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_151, AgradCdfTestFixture, AgradCdfDoubleExponential_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_152, AgradCdfTestFixture, AgradCdfDoubleExponential_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_153, AgradCdfTestFixture, AgradCdfDoubleExponential_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_154, AgradCdfTestFixture, AgradCdfDoubleExponential_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_155, AgradCdfTestFixture, AgradCdfDoubleExponential_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_156, AgradCdfTestFixture, AgradCdfDoubleExponential_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_157, AgradCdfTestFixture, AgradCdfDoubleExponential_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_158, AgradCdfTestFixture, AgradCdfDoubleExponential_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_159, AgradCdfTestFixture, AgradCdfDoubleExponential_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_160, AgradCdfTestFixture, AgradCdfDoubleExponential_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_161, AgradCdfTestFixture, AgradCdfDoubleExponential_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_162, AgradCdfTestFixture, AgradCdfDoubleExponential_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_163, AgradCdfTestFixture, AgradCdfDoubleExponential_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_164, AgradCdfTestFixture, AgradCdfDoubleExponential_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_165, AgradCdfTestFixture, AgradCdfDoubleExponential_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_166, AgradCdfTestFixture, AgradCdfDoubleExponential_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_167, AgradCdfTestFixture, AgradCdfDoubleExponential_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_168, AgradCdfTestFixture, AgradCdfDoubleExponential_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_169, AgradCdfTestFixture, AgradCdfDoubleExponential_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_170, AgradCdfTestFixture, AgradCdfDoubleExponential_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_171, AgradCdfTestFixture, AgradCdfDoubleExponential_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_172, AgradCdfTestFixture, AgradCdfDoubleExponential_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_173, AgradCdfTestFixture, AgradCdfDoubleExponential_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_174, AgradCdfTestFixture, AgradCdfDoubleExponential_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_175, AgradCdfTestFixture, AgradCdfDoubleExponential_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_176, AgradCdfTestFixture, AgradCdfDoubleExponential_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_177, AgradCdfTestFixture, AgradCdfDoubleExponential_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_178, AgradCdfTestFixture, AgradCdfDoubleExponential_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_179, AgradCdfTestFixture, AgradCdfDoubleExponential_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_180, AgradCdfTestFixture, AgradCdfDoubleExponential_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_181, AgradCdfTestFixture, AgradCdfDoubleExponential_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_182, AgradCdfTestFixture, AgradCdfDoubleExponential_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_183, AgradCdfTestFixture, AgradCdfDoubleExponential_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_184, AgradCdfTestFixture, AgradCdfDoubleExponential_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_185, AgradCdfTestFixture, AgradCdfDoubleExponential_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_186, AgradCdfTestFixture, AgradCdfDoubleExponential_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_187, AgradCdfTestFixture, AgradCdfDoubleExponential_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_188, AgradCdfTestFixture, AgradCdfDoubleExponential_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_189, AgradCdfTestFixture, AgradCdfDoubleExponential_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_190, AgradCdfTestFixture, AgradCdfDoubleExponential_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_191, AgradCdfTestFixture, AgradCdfDoubleExponential_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_192, AgradCdfTestFixture, AgradCdfDoubleExponential_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_193, AgradCdfTestFixture, AgradCdfDoubleExponential_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_194, AgradCdfTestFixture, AgradCdfDoubleExponential_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_195, AgradCdfTestFixture, AgradCdfDoubleExponential_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_196, AgradCdfTestFixture, AgradCdfDoubleExponential_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_197, AgradCdfTestFixture, AgradCdfDoubleExponential_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_198, AgradCdfTestFixture, AgradCdfDoubleExponential_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_v_199, AgradCdfTestFixture, AgradCdfDoubleExponential_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_100> AgradCdfDoubleExponential_vv_100;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_101> AgradCdfDoubleExponential_vv_101;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_102> AgradCdfDoubleExponential_vv_102;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_103> AgradCdfDoubleExponential_vv_103;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_104> AgradCdfDoubleExponential_vv_104;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_105> AgradCdfDoubleExponential_vv_105;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_106> AgradCdfDoubleExponential_vv_106;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_107> AgradCdfDoubleExponential_vv_107;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_108> AgradCdfDoubleExponential_vv_108;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_109> AgradCdfDoubleExponential_vv_109;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_110> AgradCdfDoubleExponential_vv_110;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_111> AgradCdfDoubleExponential_vv_111;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_112> AgradCdfDoubleExponential_vv_112;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_113> AgradCdfDoubleExponential_vv_113;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_114> AgradCdfDoubleExponential_vv_114;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_115> AgradCdfDoubleExponential_vv_115;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_116> AgradCdfDoubleExponential_vv_116;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_117> AgradCdfDoubleExponential_vv_117;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_118> AgradCdfDoubleExponential_vv_118;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_119> AgradCdfDoubleExponential_vv_119;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_120> AgradCdfDoubleExponential_vv_120;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_121> AgradCdfDoubleExponential_vv_121;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_122> AgradCdfDoubleExponential_vv_122;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_123> AgradCdfDoubleExponential_vv_123;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_124> AgradCdfDoubleExponential_vv_124;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_125> AgradCdfDoubleExponential_vv_125;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_126> AgradCdfDoubleExponential_vv_126;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_127> AgradCdfDoubleExponential_vv_127;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_128> AgradCdfDoubleExponential_vv_128;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_129> AgradCdfDoubleExponential_vv_129;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_130> AgradCdfDoubleExponential_vv_130;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_131> AgradCdfDoubleExponential_vv_131;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_132> AgradCdfDoubleExponential_vv_132;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_133> AgradCdfDoubleExponential_vv_133;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_134> AgradCdfDoubleExponential_vv_134;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_135> AgradCdfDoubleExponential_vv_135;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_136> AgradCdfDoubleExponential_vv_136;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_137> AgradCdfDoubleExponential_vv_137;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_138> AgradCdfDoubleExponential_vv_138;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_139> AgradCdfDoubleExponential_vv_139;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_140> AgradCdfDoubleExponential_vv_140;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_141> AgradCdfDoubleExponential_vv_141;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_142> AgradCdfDoubleExponential_vv_142;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_143> AgradCdfDoubleExponential_vv_143;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_144> AgradCdfDoubleExponential_vv_144;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_145> AgradCdfDoubleExponential_vv_145;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_146> AgradCdfDoubleExponential_vv_146;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_147> AgradCdfDoubleExponential_vv_147;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_148> AgradCdfDoubleExponential_vv_148;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_149> AgradCdfDoubleExponential_vv_149;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_150> AgradCdfDoubleExponential_vv_150;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_151> AgradCdfDoubleExponential_vv_151;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_152> AgradCdfDoubleExponential_vv_152;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_153> AgradCdfDoubleExponential_vv_153;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_154> AgradCdfDoubleExponential_vv_154;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_155> AgradCdfDoubleExponential_vv_155;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_156> AgradCdfDoubleExponential_vv_156;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_157> AgradCdfDoubleExponential_vv_157;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_158> AgradCdfDoubleExponential_vv_158;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_159> AgradCdfDoubleExponential_vv_159;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_160> AgradCdfDoubleExponential_vv_160;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_161> AgradCdfDoubleExponential_vv_161;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_162> AgradCdfDoubleExponential_vv_162;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_163> AgradCdfDoubleExponential_vv_163;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_164> AgradCdfDoubleExponential_vv_164;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_165> AgradCdfDoubleExponential_vv_165;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_166> AgradCdfDoubleExponential_vv_166;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_167> AgradCdfDoubleExponential_vv_167;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_168> AgradCdfDoubleExponential_vv_168;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_169> AgradCdfDoubleExponential_vv_169;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_170> AgradCdfDoubleExponential_vv_170;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_171> AgradCdfDoubleExponential_vv_171;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_172> AgradCdfDoubleExponential_vv_172;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_173> AgradCdfDoubleExponential_vv_173;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_174> AgradCdfDoubleExponential_vv_174;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_175> AgradCdfDoubleExponential_vv_175;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_176> AgradCdfDoubleExponential_vv_176;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_177> AgradCdfDoubleExponential_vv_177;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_178> AgradCdfDoubleExponential_vv_178;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_179> AgradCdfDoubleExponential_vv_179;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_180> AgradCdfDoubleExponential_vv_180;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_181> AgradCdfDoubleExponential_vv_181;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_182> AgradCdfDoubleExponential_vv_182;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_183> AgradCdfDoubleExponential_vv_183;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_184> AgradCdfDoubleExponential_vv_184;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_185> AgradCdfDoubleExponential_vv_185;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_186> AgradCdfDoubleExponential_vv_186;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_187> AgradCdfDoubleExponential_vv_187;
+typedef std::tuple<AgradCdfDoubleExponential, type_vv_188> AgradCdfDoubleExponential_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_100, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_101, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_102, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_103, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_104, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_105, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_106, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_107, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_108, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_109, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_110, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_111, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_112, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_113, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_114, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_115, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_116, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_117, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_118, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_119, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_120, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_121, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_122, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_123, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_124, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_125, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_126, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_127, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_128, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_129, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_130, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_131, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_132, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_133, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_134, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_135, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_136, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_137, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_138, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_139, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_140, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_141, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_142, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_143, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_144, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_145, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_146, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_147, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_148, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_149, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_150, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_151, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_152, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_153, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_154, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_155, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_156, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_157, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_158, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_159, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_160, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_161, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_162, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_163, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_164, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_165, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_166, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_167, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_168, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_169, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_170, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_171, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_172, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_173, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_174, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_175, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_176, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_177, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_178, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_179, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_180, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_181, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_182, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_183, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_184, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_185, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_186, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_187, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfDoubleExponential_vv_188, AgradCdfTestFixture, AgradCdfDoubleExponential_vv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_0> AgradCdfLogDoubleExponential_ffv_0;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_1> AgradCdfLogDoubleExponential_ffv_1;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_2> AgradCdfLogDoubleExponential_ffv_2;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_3> AgradCdfLogDoubleExponential_ffv_3;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_4> AgradCdfLogDoubleExponential_ffv_4;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_5> AgradCdfLogDoubleExponential_ffv_5;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_6> AgradCdfLogDoubleExponential_ffv_6;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_7> AgradCdfLogDoubleExponential_ffv_7;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_8> AgradCdfLogDoubleExponential_ffv_8;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_9> AgradCdfLogDoubleExponential_ffv_9;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_10> AgradCdfLogDoubleExponential_ffv_10;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_11> AgradCdfLogDoubleExponential_ffv_11;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_12> AgradCdfLogDoubleExponential_ffv_12;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_13> AgradCdfLogDoubleExponential_ffv_13;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_14> AgradCdfLogDoubleExponential_ffv_14;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_15> AgradCdfLogDoubleExponential_ffv_15;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_16> AgradCdfLogDoubleExponential_ffv_16;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_17> AgradCdfLogDoubleExponential_ffv_17;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_18> AgradCdfLogDoubleExponential_ffv_18;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_19> AgradCdfLogDoubleExponential_ffv_19;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_20> AgradCdfLogDoubleExponential_ffv_20;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_21> AgradCdfLogDoubleExponential_ffv_21;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_22> AgradCdfLogDoubleExponential_ffv_22;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_23> AgradCdfLogDoubleExponential_ffv_23;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_24> AgradCdfLogDoubleExponential_ffv_24;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_25> AgradCdfLogDoubleExponential_ffv_25;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_26> AgradCdfLogDoubleExponential_ffv_26;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_27> AgradCdfLogDoubleExponential_ffv_27;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_28> AgradCdfLogDoubleExponential_ffv_28;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_29> AgradCdfLogDoubleExponential_ffv_29;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_30> AgradCdfLogDoubleExponential_ffv_30;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_31> AgradCdfLogDoubleExponential_ffv_31;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_32> AgradCdfLogDoubleExponential_ffv_32;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_33> AgradCdfLogDoubleExponential_ffv_33;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_34> AgradCdfLogDoubleExponential_ffv_34;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_35> AgradCdfLogDoubleExponential_ffv_35;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_36> AgradCdfLogDoubleExponential_ffv_36;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_37> AgradCdfLogDoubleExponential_ffv_37;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_38> AgradCdfLogDoubleExponential_ffv_38;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_39> AgradCdfLogDoubleExponential_ffv_39;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_40> AgradCdfLogDoubleExponential_ffv_40;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_41> AgradCdfLogDoubleExponential_ffv_41;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_42> AgradCdfLogDoubleExponential_ffv_42;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_43> AgradCdfLogDoubleExponential_ffv_43;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_44> AgradCdfLogDoubleExponential_ffv_44;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_45> AgradCdfLogDoubleExponential_ffv_45;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_46> AgradCdfLogDoubleExponential_ffv_46;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_47> AgradCdfLogDoubleExponential_ffv_47;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_48> AgradCdfLogDoubleExponential_ffv_48;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_49> AgradCdfLogDoubleExponential_ffv_49;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_50> AgradCdfLogDoubleExponential_ffv_50;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_51> AgradCdfLogDoubleExponential_ffv_51;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_52> AgradCdfLogDoubleExponential_ffv_52;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_53> AgradCdfLogDoubleExponential_ffv_53;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_54> AgradCdfLogDoubleExponential_ffv_54;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_55> AgradCdfLogDoubleExponential_ffv_55;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_56> AgradCdfLogDoubleExponential_ffv_56;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_57> AgradCdfLogDoubleExponential_ffv_57;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_58> AgradCdfLogDoubleExponential_ffv_58;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_59> AgradCdfLogDoubleExponential_ffv_59;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_60> AgradCdfLogDoubleExponential_ffv_60;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_61> AgradCdfLogDoubleExponential_ffv_61;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_62> AgradCdfLogDoubleExponential_ffv_62;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_63> AgradCdfLogDoubleExponential_ffv_63;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_64> AgradCdfLogDoubleExponential_ffv_64;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_65> AgradCdfLogDoubleExponential_ffv_65;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_66> AgradCdfLogDoubleExponential_ffv_66;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_67> AgradCdfLogDoubleExponential_ffv_67;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_68> AgradCdfLogDoubleExponential_ffv_68;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_69> AgradCdfLogDoubleExponential_ffv_69;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_70> AgradCdfLogDoubleExponential_ffv_70;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_71> AgradCdfLogDoubleExponential_ffv_71;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_72> AgradCdfLogDoubleExponential_ffv_72;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_73> AgradCdfLogDoubleExponential_ffv_73;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_74> AgradCdfLogDoubleExponential_ffv_74;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_75> AgradCdfLogDoubleExponential_ffv_75;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_76> AgradCdfLogDoubleExponential_ffv_76;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_77> AgradCdfLogDoubleExponential_ffv_77;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_78> AgradCdfLogDoubleExponential_ffv_78;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_79> AgradCdfLogDoubleExponential_ffv_79;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_80> AgradCdfLogDoubleExponential_ffv_80;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_81> AgradCdfLogDoubleExponential_ffv_81;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_82> AgradCdfLogDoubleExponential_ffv_82;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_83> AgradCdfLogDoubleExponential_ffv_83;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_84> AgradCdfLogDoubleExponential_ffv_84;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_85> AgradCdfLogDoubleExponential_ffv_85;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_86> AgradCdfLogDoubleExponential_ffv_86;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_87> AgradCdfLogDoubleExponential_ffv_87;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_88> AgradCdfLogDoubleExponential_ffv_88;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_89> AgradCdfLogDoubleExponential_ffv_89;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_90> AgradCdfLogDoubleExponential_ffv_90;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_91> AgradCdfLogDoubleExponential_ffv_91;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_92> AgradCdfLogDoubleExponential_ffv_92;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_93> AgradCdfLogDoubleExponential_ffv_93;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_94> AgradCdfLogDoubleExponential_ffv_94;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_95> AgradCdfLogDoubleExponential_ffv_95;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_96> AgradCdfLogDoubleExponential_ffv_96;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_97> AgradCdfLogDoubleExponential_ffv_97;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_98> AgradCdfLogDoubleExponential_ffv_98;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_99> AgradCdfLogDoubleExponential_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_0, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_1, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_2, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_3, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_4, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_5, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_6, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_7, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_8, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_9, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_10, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_11, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_12, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_13, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_14, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_15, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_16, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_17, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_18, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_19, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_20, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_21, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_22, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_23, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_24, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_25, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_26, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_27, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_28, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_29, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_30, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_31, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_32, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_33, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_34, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_35, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_36, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_37, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_38, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_39, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_40, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_41, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_42, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_43, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_44, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_45, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_46, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_47, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_48, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_49, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_50, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_51, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_52, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_53, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_54, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_55, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_56, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_57, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_58, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_59, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_60, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_61, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_62, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_63, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_64, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_65, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_66, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_67, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_68, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_69, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_70, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_71, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_72, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_73, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_74, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_75, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_76, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_77, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_78, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_79, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_80, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_81, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_82, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_83, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_84, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_85, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_86, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_87, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_88, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_89, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_90, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_91, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_92, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_93, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_94, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_95, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_96, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_97, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_98, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_99, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_0> AgradCdfLogDoubleExponential_v_0;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_1> AgradCdfLogDoubleExponential_v_1;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_2> AgradCdfLogDoubleExponential_v_2;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_3> AgradCdfLogDoubleExponential_v_3;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_4> AgradCdfLogDoubleExponential_v_4;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_5> AgradCdfLogDoubleExponential_v_5;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_6> AgradCdfLogDoubleExponential_v_6;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_7> AgradCdfLogDoubleExponential_v_7;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_8> AgradCdfLogDoubleExponential_v_8;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_9> AgradCdfLogDoubleExponential_v_9;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_10> AgradCdfLogDoubleExponential_v_10;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_11> AgradCdfLogDoubleExponential_v_11;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_12> AgradCdfLogDoubleExponential_v_12;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_13> AgradCdfLogDoubleExponential_v_13;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_14> AgradCdfLogDoubleExponential_v_14;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_15> AgradCdfLogDoubleExponential_v_15;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_16> AgradCdfLogDoubleExponential_v_16;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_17> AgradCdfLogDoubleExponential_v_17;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_18> AgradCdfLogDoubleExponential_v_18;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_19> AgradCdfLogDoubleExponential_v_19;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_20> AgradCdfLogDoubleExponential_v_20;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_21> AgradCdfLogDoubleExponential_v_21;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_22> AgradCdfLogDoubleExponential_v_22;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_23> AgradCdfLogDoubleExponential_v_23;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_24> AgradCdfLogDoubleExponential_v_24;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_25> AgradCdfLogDoubleExponential_v_25;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_26> AgradCdfLogDoubleExponential_v_26;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_27> AgradCdfLogDoubleExponential_v_27;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_28> AgradCdfLogDoubleExponential_v_28;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_29> AgradCdfLogDoubleExponential_v_29;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_30> AgradCdfLogDoubleExponential_v_30;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_31> AgradCdfLogDoubleExponential_v_31;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_32> AgradCdfLogDoubleExponential_v_32;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_33> AgradCdfLogDoubleExponential_v_33;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_34> AgradCdfLogDoubleExponential_v_34;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_35> AgradCdfLogDoubleExponential_v_35;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_36> AgradCdfLogDoubleExponential_v_36;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_37> AgradCdfLogDoubleExponential_v_37;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_38> AgradCdfLogDoubleExponential_v_38;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_39> AgradCdfLogDoubleExponential_v_39;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_40> AgradCdfLogDoubleExponential_v_40;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_41> AgradCdfLogDoubleExponential_v_41;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_42> AgradCdfLogDoubleExponential_v_42;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_43> AgradCdfLogDoubleExponential_v_43;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_44> AgradCdfLogDoubleExponential_v_44;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_45> AgradCdfLogDoubleExponential_v_45;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_46> AgradCdfLogDoubleExponential_v_46;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_47> AgradCdfLogDoubleExponential_v_47;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_48> AgradCdfLogDoubleExponential_v_48;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_49> AgradCdfLogDoubleExponential_v_49;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_50> AgradCdfLogDoubleExponential_v_50;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_51> AgradCdfLogDoubleExponential_v_51;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_52> AgradCdfLogDoubleExponential_v_52;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_53> AgradCdfLogDoubleExponential_v_53;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_54> AgradCdfLogDoubleExponential_v_54;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_55> AgradCdfLogDoubleExponential_v_55;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_56> AgradCdfLogDoubleExponential_v_56;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_57> AgradCdfLogDoubleExponential_v_57;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_58> AgradCdfLogDoubleExponential_v_58;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_59> AgradCdfLogDoubleExponential_v_59;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_60> AgradCdfLogDoubleExponential_v_60;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_61> AgradCdfLogDoubleExponential_v_61;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_62> AgradCdfLogDoubleExponential_v_62;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_63> AgradCdfLogDoubleExponential_v_63;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_64> AgradCdfLogDoubleExponential_v_64;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_65> AgradCdfLogDoubleExponential_v_65;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_66> AgradCdfLogDoubleExponential_v_66;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_67> AgradCdfLogDoubleExponential_v_67;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_68> AgradCdfLogDoubleExponential_v_68;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_69> AgradCdfLogDoubleExponential_v_69;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_70> AgradCdfLogDoubleExponential_v_70;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_71> AgradCdfLogDoubleExponential_v_71;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_72> AgradCdfLogDoubleExponential_v_72;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_73> AgradCdfLogDoubleExponential_v_73;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_74> AgradCdfLogDoubleExponential_v_74;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_75> AgradCdfLogDoubleExponential_v_75;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_76> AgradCdfLogDoubleExponential_v_76;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_77> AgradCdfLogDoubleExponential_v_77;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_78> AgradCdfLogDoubleExponential_v_78;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_79> AgradCdfLogDoubleExponential_v_79;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_80> AgradCdfLogDoubleExponential_v_80;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_81> AgradCdfLogDoubleExponential_v_81;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_82> AgradCdfLogDoubleExponential_v_82;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_83> AgradCdfLogDoubleExponential_v_83;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_84> AgradCdfLogDoubleExponential_v_84;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_85> AgradCdfLogDoubleExponential_v_85;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_86> AgradCdfLogDoubleExponential_v_86;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_87> AgradCdfLogDoubleExponential_v_87;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_88> AgradCdfLogDoubleExponential_v_88;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_89> AgradCdfLogDoubleExponential_v_89;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_90> AgradCdfLogDoubleExponential_v_90;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_91> AgradCdfLogDoubleExponential_v_91;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_92> AgradCdfLogDoubleExponential_v_92;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_93> AgradCdfLogDoubleExponential_v_93;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_94> AgradCdfLogDoubleExponential_v_94;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_95> AgradCdfLogDoubleExponential_v_95;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_96> AgradCdfLogDoubleExponential_v_96;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_97> AgradCdfLogDoubleExponential_v_97;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_98> AgradCdfLogDoubleExponential_v_98;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_99> AgradCdfLogDoubleExponential_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_0, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_1, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_2, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_3, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_4, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_5, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_6, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_7, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_8, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_9, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_10, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_11, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_12, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_13, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_14, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_15, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_16, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_17, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_18, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_19, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_20, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_21, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_22, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_23, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_24, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_25, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_26, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_27, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_28, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_29, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_30, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_31, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_32, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_33, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_34, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_35, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_36, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_37, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_38, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_39, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_40, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_41, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_42, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_43, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_44, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_45, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_46, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_47, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_48, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_49, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_50, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_51, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_52, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_53, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_54, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_55, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_56, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_57, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_58, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_59, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_60, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_61, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_62, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_63, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_64, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_65, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_66, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_67, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_68, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_69, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_70, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_71, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_72, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_73, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_74, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_75, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_76, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_77, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_78, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_79, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_80, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_81, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_82, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_83, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_84, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_85, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_86, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_87, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_88, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_89, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_90, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_91, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_92, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_93, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_94, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_95, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_96, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_97, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_98, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_99, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_0> AgradCdfLogDoubleExponential_vv_0;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_1> AgradCdfLogDoubleExponential_vv_1;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_2> AgradCdfLogDoubleExponential_vv_2;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_3> AgradCdfLogDoubleExponential_vv_3;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_4> AgradCdfLogDoubleExponential_vv_4;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_5> AgradCdfLogDoubleExponential_vv_5;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_6> AgradCdfLogDoubleExponential_vv_6;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_7> AgradCdfLogDoubleExponential_vv_7;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_8> AgradCdfLogDoubleExponential_vv_8;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_9> AgradCdfLogDoubleExponential_vv_9;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_10> AgradCdfLogDoubleExponential_vv_10;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_11> AgradCdfLogDoubleExponential_vv_11;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_12> AgradCdfLogDoubleExponential_vv_12;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_13> AgradCdfLogDoubleExponential_vv_13;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_14> AgradCdfLogDoubleExponential_vv_14;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_15> AgradCdfLogDoubleExponential_vv_15;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_16> AgradCdfLogDoubleExponential_vv_16;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_17> AgradCdfLogDoubleExponential_vv_17;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_18> AgradCdfLogDoubleExponential_vv_18;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_19> AgradCdfLogDoubleExponential_vv_19;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_20> AgradCdfLogDoubleExponential_vv_20;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_21> AgradCdfLogDoubleExponential_vv_21;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_22> AgradCdfLogDoubleExponential_vv_22;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_23> AgradCdfLogDoubleExponential_vv_23;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_24> AgradCdfLogDoubleExponential_vv_24;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_25> AgradCdfLogDoubleExponential_vv_25;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_26> AgradCdfLogDoubleExponential_vv_26;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_27> AgradCdfLogDoubleExponential_vv_27;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_28> AgradCdfLogDoubleExponential_vv_28;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_29> AgradCdfLogDoubleExponential_vv_29;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_30> AgradCdfLogDoubleExponential_vv_30;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_31> AgradCdfLogDoubleExponential_vv_31;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_32> AgradCdfLogDoubleExponential_vv_32;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_33> AgradCdfLogDoubleExponential_vv_33;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_34> AgradCdfLogDoubleExponential_vv_34;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_35> AgradCdfLogDoubleExponential_vv_35;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_36> AgradCdfLogDoubleExponential_vv_36;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_37> AgradCdfLogDoubleExponential_vv_37;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_38> AgradCdfLogDoubleExponential_vv_38;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_39> AgradCdfLogDoubleExponential_vv_39;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_40> AgradCdfLogDoubleExponential_vv_40;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_41> AgradCdfLogDoubleExponential_vv_41;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_42> AgradCdfLogDoubleExponential_vv_42;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_43> AgradCdfLogDoubleExponential_vv_43;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_44> AgradCdfLogDoubleExponential_vv_44;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_45> AgradCdfLogDoubleExponential_vv_45;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_46> AgradCdfLogDoubleExponential_vv_46;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_47> AgradCdfLogDoubleExponential_vv_47;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_48> AgradCdfLogDoubleExponential_vv_48;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_49> AgradCdfLogDoubleExponential_vv_49;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_50> AgradCdfLogDoubleExponential_vv_50;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_51> AgradCdfLogDoubleExponential_vv_51;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_52> AgradCdfLogDoubleExponential_vv_52;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_53> AgradCdfLogDoubleExponential_vv_53;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_54> AgradCdfLogDoubleExponential_vv_54;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_55> AgradCdfLogDoubleExponential_vv_55;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_56> AgradCdfLogDoubleExponential_vv_56;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_57> AgradCdfLogDoubleExponential_vv_57;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_58> AgradCdfLogDoubleExponential_vv_58;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_59> AgradCdfLogDoubleExponential_vv_59;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_60> AgradCdfLogDoubleExponential_vv_60;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_61> AgradCdfLogDoubleExponential_vv_61;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_62> AgradCdfLogDoubleExponential_vv_62;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_63> AgradCdfLogDoubleExponential_vv_63;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_64> AgradCdfLogDoubleExponential_vv_64;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_65> AgradCdfLogDoubleExponential_vv_65;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_66> AgradCdfLogDoubleExponential_vv_66;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_67> AgradCdfLogDoubleExponential_vv_67;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_68> AgradCdfLogDoubleExponential_vv_68;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_69> AgradCdfLogDoubleExponential_vv_69;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_70> AgradCdfLogDoubleExponential_vv_70;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_71> AgradCdfLogDoubleExponential_vv_71;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_72> AgradCdfLogDoubleExponential_vv_72;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_73> AgradCdfLogDoubleExponential_vv_73;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_74> AgradCdfLogDoubleExponential_vv_74;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_75> AgradCdfLogDoubleExponential_vv_75;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_76> AgradCdfLogDoubleExponential_vv_76;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_77> AgradCdfLogDoubleExponential_vv_77;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_78> AgradCdfLogDoubleExponential_vv_78;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_79> AgradCdfLogDoubleExponential_vv_79;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_80> AgradCdfLogDoubleExponential_vv_80;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_81> AgradCdfLogDoubleExponential_vv_81;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_82> AgradCdfLogDoubleExponential_vv_82;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_83> AgradCdfLogDoubleExponential_vv_83;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_84> AgradCdfLogDoubleExponential_vv_84;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_85> AgradCdfLogDoubleExponential_vv_85;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_86> AgradCdfLogDoubleExponential_vv_86;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_87> AgradCdfLogDoubleExponential_vv_87;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_88> AgradCdfLogDoubleExponential_vv_88;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_89> AgradCdfLogDoubleExponential_vv_89;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_90> AgradCdfLogDoubleExponential_vv_90;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_91> AgradCdfLogDoubleExponential_vv_91;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_92> AgradCdfLogDoubleExponential_vv_92;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_93> AgradCdfLogDoubleExponential_vv_93;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_94> AgradCdfLogDoubleExponential_vv_94;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_95> AgradCdfLogDoubleExponential_vv_95;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_96> AgradCdfLogDoubleExponential_vv_96;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_97> AgradCdfLogDoubleExponential_vv_97;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_98> AgradCdfLogDoubleExponential_vv_98;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_99> AgradCdfLogDoubleExponential_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_0, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_1, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_2, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_3, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_4, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_5, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_6, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_7, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_8, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_9, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_10, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_11, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_12, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_13, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_14, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_15, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_16, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_17, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_18, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_19, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_20, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_21, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_22, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_23, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_24, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_25, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_26, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_27, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_28, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_29, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_30, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_31, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_32, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_33, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_34, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_35, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_36, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_37, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_38, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_39, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_40, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_41, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_42, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_43, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_44, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_45, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_46, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_47, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_48, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_49, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_50, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_51, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_52, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_53, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_54, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_55, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_56, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_57, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_58, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_59, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_60, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_61, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_62, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_63, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_64, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_65, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_66, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_67, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_68, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_69, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_70, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_71, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_72, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_73, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_74, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_75, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_76, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_77, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_78, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_79, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_80, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_81, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_82, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_83, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_84, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_85, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_86, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_87, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_88, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_89, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_90, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_91, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_92, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_93, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_94, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_95, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_96, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_97, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_98, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_99, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_99);
+
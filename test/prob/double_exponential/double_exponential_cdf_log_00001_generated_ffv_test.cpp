@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_100> AgradCdfLogDoubleExponential_ffv_100;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_101> AgradCdfLogDoubleExponential_ffv_101;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_102> AgradCdfLogDoubleExponential_ffv_102;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_103> AgradCdfLogDoubleExponential_ffv_103;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_104> AgradCdfLogDoubleExponential_ffv_104;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_105> AgradCdfLogDoubleExponential_ffv_105;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_106> AgradCdfLogDoubleExponential_ffv_106;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_107> AgradCdfLogDoubleExponential_ffv_107;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_108> AgradCdfLogDoubleExponential_ffv_108;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_109> AgradCdfLogDoubleExponential_ffv_109;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_110> AgradCdfLogDoubleExponential_ffv_110;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_111> AgradCdfLogDoubleExponential_ffv_111;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_112> AgradCdfLogDoubleExponential_ffv_112;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_113> AgradCdfLogDoubleExponential_ffv_113;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_114> AgradCdfLogDoubleExponential_ffv_114;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_115> AgradCdfLogDoubleExponential_ffv_115;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_116> AgradCdfLogDoubleExponential_ffv_116;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_117> AgradCdfLogDoubleExponential_ffv_117;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_118> AgradCdfLogDoubleExponential_ffv_118;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_119> AgradCdfLogDoubleExponential_ffv_119;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_120> AgradCdfLogDoubleExponential_ffv_120;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_121> AgradCdfLogDoubleExponential_ffv_121;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_122> AgradCdfLogDoubleExponential_ffv_122;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_123> AgradCdfLogDoubleExponential_ffv_123;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_124> AgradCdfLogDoubleExponential_ffv_124;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_125> AgradCdfLogDoubleExponential_ffv_125;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_126> AgradCdfLogDoubleExponential_ffv_126;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_127> AgradCdfLogDoubleExponential_ffv_127;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_128> AgradCdfLogDoubleExponential_ffv_128;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_129> AgradCdfLogDoubleExponential_ffv_129;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_130> AgradCdfLogDoubleExponential_ffv_130;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_131> AgradCdfLogDoubleExponential_ffv_131;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_132> AgradCdfLogDoubleExponential_ffv_132;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_133> AgradCdfLogDoubleExponential_ffv_133;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_134> AgradCdfLogDoubleExponential_ffv_134;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_135> AgradCdfLogDoubleExponential_ffv_135;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_136> AgradCdfLogDoubleExponential_ffv_136;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_137> AgradCdfLogDoubleExponential_ffv_137;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_138> AgradCdfLogDoubleExponential_ffv_138;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_139> AgradCdfLogDoubleExponential_ffv_139;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_140> AgradCdfLogDoubleExponential_ffv_140;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_141> AgradCdfLogDoubleExponential_ffv_141;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_142> AgradCdfLogDoubleExponential_ffv_142;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_143> AgradCdfLogDoubleExponential_ffv_143;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_144> AgradCdfLogDoubleExponential_ffv_144;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_145> AgradCdfLogDoubleExponential_ffv_145;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_146> AgradCdfLogDoubleExponential_ffv_146;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_147> AgradCdfLogDoubleExponential_ffv_147;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_148> AgradCdfLogDoubleExponential_ffv_148;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_149> AgradCdfLogDoubleExponential_ffv_149;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_150> AgradCdfLogDoubleExponential_ffv_150;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_151> AgradCdfLogDoubleExponential_ffv_151;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_152> AgradCdfLogDoubleExponential_ffv_152;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_153> AgradCdfLogDoubleExponential_ffv_153;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_154> AgradCdfLogDoubleExponential_ffv_154;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_155> AgradCdfLogDoubleExponential_ffv_155;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_156> AgradCdfLogDoubleExponential_ffv_156;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_157> AgradCdfLogDoubleExponential_ffv_157;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_158> AgradCdfLogDoubleExponential_ffv_158;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_159> AgradCdfLogDoubleExponential_ffv_159;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_160> AgradCdfLogDoubleExponential_ffv_160;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_161> AgradCdfLogDoubleExponential_ffv_161;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_162> AgradCdfLogDoubleExponential_ffv_162;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_163> AgradCdfLogDoubleExponential_ffv_163;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_164> AgradCdfLogDoubleExponential_ffv_164;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_165> AgradCdfLogDoubleExponential_ffv_165;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_166> AgradCdfLogDoubleExponential_ffv_166;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_167> AgradCdfLogDoubleExponential_ffv_167;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_168> AgradCdfLogDoubleExponential_ffv_168;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_169> AgradCdfLogDoubleExponential_ffv_169;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_170> AgradCdfLogDoubleExponential_ffv_170;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_171> AgradCdfLogDoubleExponential_ffv_171;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_172> AgradCdfLogDoubleExponential_ffv_172;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_173> AgradCdfLogDoubleExponential_ffv_173;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_174> AgradCdfLogDoubleExponential_ffv_174;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_175> AgradCdfLogDoubleExponential_ffv_175;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_176> AgradCdfLogDoubleExponential_ffv_176;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_177> AgradCdfLogDoubleExponential_ffv_177;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_178> AgradCdfLogDoubleExponential_ffv_178;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_179> AgradCdfLogDoubleExponential_ffv_179;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_180> AgradCdfLogDoubleExponential_ffv_180;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_181> AgradCdfLogDoubleExponential_ffv_181;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_182> AgradCdfLogDoubleExponential_ffv_182;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_183> AgradCdfLogDoubleExponential_ffv_183;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_184> AgradCdfLogDoubleExponential_ffv_184;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_185> AgradCdfLogDoubleExponential_ffv_185;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_186> AgradCdfLogDoubleExponential_ffv_186;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_187> AgradCdfLogDoubleExponential_ffv_187;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_ffv_188> AgradCdfLogDoubleExponential_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_100, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_101, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_102, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_103, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_104, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_105, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_106, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_107, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_108, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_109, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_110, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_111, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_112, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_113, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_114, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_115, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_116, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_117, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_118, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_119, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_120, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_121, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_122, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_123, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_124, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_125, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_126, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_127, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_128, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_129, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_130, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_131, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_132, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_133, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_134, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_135, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_136, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_137, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_138, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_139, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_140, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_141, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_142, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_143, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_144, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_145, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_146, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_147, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_148, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_149, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_150, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_151, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_152, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_153, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_154, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_155, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_156, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_157, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_158, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_159, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_160, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_161, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_162, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_163, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_164, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_165, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_166, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_167, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_168, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_169, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_170, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_171, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_172, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_173, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_174, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_175, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_176, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_177, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_178, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_179, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_180, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_181, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_182, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_183, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_184, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_185, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_186, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_187, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_ffv_188, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_ffv_188);
+
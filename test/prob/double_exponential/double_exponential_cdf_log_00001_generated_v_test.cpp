@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_100> AgradCdfLogDoubleExponential_v_100;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_101> AgradCdfLogDoubleExponential_v_101;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_102> AgradCdfLogDoubleExponential_v_102;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_103> AgradCdfLogDoubleExponential_v_103;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_104> AgradCdfLogDoubleExponential_v_104;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_105> AgradCdfLogDoubleExponential_v_105;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_106> AgradCdfLogDoubleExponential_v_106;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_107> AgradCdfLogDoubleExponential_v_107;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_108> AgradCdfLogDoubleExponential_v_108;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_109> AgradCdfLogDoubleExponential_v_109;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_110> AgradCdfLogDoubleExponential_v_110;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_111> AgradCdfLogDoubleExponential_v_111;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_112> AgradCdfLogDoubleExponential_v_112;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_113> AgradCdfLogDoubleExponential_v_113;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_114> AgradCdfLogDoubleExponential_v_114;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_115> AgradCdfLogDoubleExponential_v_115;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_116> AgradCdfLogDoubleExponential_v_116;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_117> AgradCdfLogDoubleExponential_v_117;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_118> AgradCdfLogDoubleExponential_v_118;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_119> AgradCdfLogDoubleExponential_v_119;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_120> AgradCdfLogDoubleExponential_v_120;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_121> AgradCdfLogDoubleExponential_v_121;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_122> AgradCdfLogDoubleExponential_v_122;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_123> AgradCdfLogDoubleExponential_v_123;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_124> AgradCdfLogDoubleExponential_v_124;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_125> AgradCdfLogDoubleExponential_v_125;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_126> AgradCdfLogDoubleExponential_v_126;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_127> AgradCdfLogDoubleExponential_v_127;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_128> AgradCdfLogDoubleExponential_v_128;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_129> AgradCdfLogDoubleExponential_v_129;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_130> AgradCdfLogDoubleExponential_v_130;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_131> AgradCdfLogDoubleExponential_v_131;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_132> AgradCdfLogDoubleExponential_v_132;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_133> AgradCdfLogDoubleExponential_v_133;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_134> AgradCdfLogDoubleExponential_v_134;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_135> AgradCdfLogDoubleExponential_v_135;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_136> AgradCdfLogDoubleExponential_v_136;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_137> AgradCdfLogDoubleExponential_v_137;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_138> AgradCdfLogDoubleExponential_v_138;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_139> AgradCdfLogDoubleExponential_v_139;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_140> AgradCdfLogDoubleExponential_v_140;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_141> AgradCdfLogDoubleExponential_v_141;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_142> AgradCdfLogDoubleExponential_v_142;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_143> AgradCdfLogDoubleExponential_v_143;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_144> AgradCdfLogDoubleExponential_v_144;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_145> AgradCdfLogDoubleExponential_v_145;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_146> AgradCdfLogDoubleExponential_v_146;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_147> AgradCdfLogDoubleExponential_v_147;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_148> AgradCdfLogDoubleExponential_v_148;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_149> AgradCdfLogDoubleExponential_v_149;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_150> AgradCdfLogDoubleExponential_v_150;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_151> AgradCdfLogDoubleExponential_v_151;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_152> AgradCdfLogDoubleExponential_v_152;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_153> AgradCdfLogDoubleExponential_v_153;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_154> AgradCdfLogDoubleExponential_v_154;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_155> AgradCdfLogDoubleExponential_v_155;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_156> AgradCdfLogDoubleExponential_v_156;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_157> AgradCdfLogDoubleExponential_v_157;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_158> AgradCdfLogDoubleExponential_v_158;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_159> AgradCdfLogDoubleExponential_v_159;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_160> AgradCdfLogDoubleExponential_v_160;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_161> AgradCdfLogDoubleExponential_v_161;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_162> AgradCdfLogDoubleExponential_v_162;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_163> AgradCdfLogDoubleExponential_v_163;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_164> AgradCdfLogDoubleExponential_v_164;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_165> AgradCdfLogDoubleExponential_v_165;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_166> AgradCdfLogDoubleExponential_v_166;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_167> AgradCdfLogDoubleExponential_v_167;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_168> AgradCdfLogDoubleExponential_v_168;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_169> AgradCdfLogDoubleExponential_v_169;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_170> AgradCdfLogDoubleExponential_v_170;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_171> AgradCdfLogDoubleExponential_v_171;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_172> AgradCdfLogDoubleExponential_v_172;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_173> AgradCdfLogDoubleExponential_v_173;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_174> AgradCdfLogDoubleExponential_v_174;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_175> AgradCdfLogDoubleExponential_v_175;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_176> AgradCdfLogDoubleExponential_v_176;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_177> AgradCdfLogDoubleExponential_v_177;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_178> AgradCdfLogDoubleExponential_v_178;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_179> AgradCdfLogDoubleExponential_v_179;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_180> AgradCdfLogDoubleExponential_v_180;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_181> AgradCdfLogDoubleExponential_v_181;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_182> AgradCdfLogDoubleExponential_v_182;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_183> AgradCdfLogDoubleExponential_v_183;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_184> AgradCdfLogDoubleExponential_v_184;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_185> AgradCdfLogDoubleExponential_v_185;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_186> AgradCdfLogDoubleExponential_v_186;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_187> AgradCdfLogDoubleExponential_v_187;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_188> AgradCdfLogDoubleExponential_v_188;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_189> AgradCdfLogDoubleExponential_v_189;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_190> AgradCdfLogDoubleExponential_v_190;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_191> AgradCdfLogDoubleExponential_v_191;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_192> AgradCdfLogDoubleExponential_v_192;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_193> AgradCdfLogDoubleExponential_v_193;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_194> AgradCdfLogDoubleExponential_v_194;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_195> AgradCdfLogDoubleExponential_v_195;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_196> AgradCdfLogDoubleExponential_v_196;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_197> AgradCdfLogDoubleExponential_v_197;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_198> AgradCdfLogDoubleExponential_v_198;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_v_199> AgradCdfLogDoubleExponential_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_100, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_101, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_102, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_103, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_104, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_105, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_106, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_107, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_108, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_109, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_110, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_111, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_112, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_113, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_114, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_115, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_116, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_117, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_118, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_119, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_120, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_121, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_122, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_123, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_124, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_125, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_126, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_127, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_128, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_129, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_130, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_131, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_132, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_133, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_134, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_135, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_136, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_137, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_138, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_139, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_140, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_141, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_142, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_143, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_144, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_145, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_146, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_147, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_148, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_149, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_150, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_151, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_152, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_153, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_154, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_155, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_156, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_157, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_158, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_159, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_160, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_161, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_162, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_163, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_164, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_165, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_166, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_167, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_168, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_169, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_170, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_171, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_172, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_173, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_174, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_175, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_176, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_177, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_178, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_179, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_180, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_181, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_182, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_183, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_184, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_185, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_186, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_187, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_188, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_189, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_190, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_191, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_192, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_193, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_194, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_195, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_196, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_197, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_198, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_v_199, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_v_199);
+
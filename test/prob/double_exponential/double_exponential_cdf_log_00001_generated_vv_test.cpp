@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/double_exponential/double_exponential_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_100> AgradCdfLogDoubleExponential_vv_100;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_101> AgradCdfLogDoubleExponential_vv_101;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_102> AgradCdfLogDoubleExponential_vv_102;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_103> AgradCdfLogDoubleExponential_vv_103;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_104> AgradCdfLogDoubleExponential_vv_104;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_105> AgradCdfLogDoubleExponential_vv_105;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_106> AgradCdfLogDoubleExponential_vv_106;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_107> AgradCdfLogDoubleExponential_vv_107;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_108> AgradCdfLogDoubleExponential_vv_108;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_109> AgradCdfLogDoubleExponential_vv_109;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_110> AgradCdfLogDoubleExponential_vv_110;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_111> AgradCdfLogDoubleExponential_vv_111;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_112> AgradCdfLogDoubleExponential_vv_112;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_113> AgradCdfLogDoubleExponential_vv_113;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_114> AgradCdfLogDoubleExponential_vv_114;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_115> AgradCdfLogDoubleExponential_vv_115;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_116> AgradCdfLogDoubleExponential_vv_116;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_117> AgradCdfLogDoubleExponential_vv_117;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_118> AgradCdfLogDoubleExponential_vv_118;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_119> AgradCdfLogDoubleExponential_vv_119;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_120> AgradCdfLogDoubleExponential_vv_120;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_121> AgradCdfLogDoubleExponential_vv_121;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_122> AgradCdfLogDoubleExponential_vv_122;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_123> AgradCdfLogDoubleExponential_vv_123;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_124> AgradCdfLogDoubleExponential_vv_124;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_125> AgradCdfLogDoubleExponential_vv_125;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_126> AgradCdfLogDoubleExponential_vv_126;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_127> AgradCdfLogDoubleExponential_vv_127;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_128> AgradCdfLogDoubleExponential_vv_128;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_129> AgradCdfLogDoubleExponential_vv_129;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_130> AgradCdfLogDoubleExponential_vv_130;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_131> AgradCdfLogDoubleExponential_vv_131;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_132> AgradCdfLogDoubleExponential_vv_132;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_133> AgradCdfLogDoubleExponential_vv_133;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_134> AgradCdfLogDoubleExponential_vv_134;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_135> AgradCdfLogDoubleExponential_vv_135;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_136> AgradCdfLogDoubleExponential_vv_136;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_137> AgradCdfLogDoubleExponential_vv_137;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_138> AgradCdfLogDoubleExponential_vv_138;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_139> AgradCdfLogDoubleExponential_vv_139;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_140> AgradCdfLogDoubleExponential_vv_140;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_141> AgradCdfLogDoubleExponential_vv_141;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_142> AgradCdfLogDoubleExponential_vv_142;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_143> AgradCdfLogDoubleExponential_vv_143;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_144> AgradCdfLogDoubleExponential_vv_144;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_145> AgradCdfLogDoubleExponential_vv_145;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_146> AgradCdfLogDoubleExponential_vv_146;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_147> AgradCdfLogDoubleExponential_vv_147;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_148> AgradCdfLogDoubleExponential_vv_148;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_149> AgradCdfLogDoubleExponential_vv_149;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_150> AgradCdfLogDoubleExponential_vv_150;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_151> AgradCdfLogDoubleExponential_vv_151;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_152> AgradCdfLogDoubleExponential_vv_152;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_153> AgradCdfLogDoubleExponential_vv_153;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_154> AgradCdfLogDoubleExponential_vv_154;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_155> AgradCdfLogDoubleExponential_vv_155;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_156> AgradCdfLogDoubleExponential_vv_156;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_157> AgradCdfLogDoubleExponential_vv_157;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_158> AgradCdfLogDoubleExponential_vv_158;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_159> AgradCdfLogDoubleExponential_vv_159;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_160> AgradCdfLogDoubleExponential_vv_160;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_161> AgradCdfLogDoubleExponential_vv_161;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_162> AgradCdfLogDoubleExponential_vv_162;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_163> AgradCdfLogDoubleExponential_vv_163;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_164> AgradCdfLogDoubleExponential_vv_164;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_165> AgradCdfLogDoubleExponential_vv_165;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_166> AgradCdfLogDoubleExponential_vv_166;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_167> AgradCdfLogDoubleExponential_vv_167;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_168> AgradCdfLogDoubleExponential_vv_168;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_169> AgradCdfLogDoubleExponential_vv_169;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_170> AgradCdfLogDoubleExponential_vv_170;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_171> AgradCdfLogDoubleExponential_vv_171;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_172> AgradCdfLogDoubleExponential_vv_172;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_173> AgradCdfLogDoubleExponential_vv_173;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_174> AgradCdfLogDoubleExponential_vv_174;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_175> AgradCdfLogDoubleExponential_vv_175;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_176> AgradCdfLogDoubleExponential_vv_176;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_177> AgradCdfLogDoubleExponential_vv_177;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_178> AgradCdfLogDoubleExponential_vv_178;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_179> AgradCdfLogDoubleExponential_vv_179;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_180> AgradCdfLogDoubleExponential_vv_180;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_181> AgradCdfLogDoubleExponential_vv_181;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_182> AgradCdfLogDoubleExponential_vv_182;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_183> AgradCdfLogDoubleExponential_vv_183;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_184> AgradCdfLogDoubleExponential_vv_184;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_185> AgradCdfLogDoubleExponential_vv_185;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_186> AgradCdfLogDoubleExponential_vv_186;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_187> AgradCdfLogDoubleExponential_vv_187;
+typedef std::tuple<AgradCdfLogDoubleExponential, type_vv_188> AgradCdfLogDoubleExponential_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_100, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_101, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_102, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_103, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_104, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_105, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_106, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_107, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_108, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_109, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_110, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_111, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_112, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_113, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_114, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_115, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_116, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_117, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_118, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_119, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_120, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_121, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_122, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_123, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_124, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_125, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_126, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_127, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_128, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_129, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_130, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_131, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_132, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_133, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_134, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_135, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_136, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_137, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_138, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_139, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_140, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_141, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_142, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_143, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_144, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_145, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_146, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_147, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_148, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_149, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_150, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_151, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_152, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_153, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_154, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_155, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_156, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_157, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_158, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_159, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_160, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_161, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_162, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_163, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_164, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_165, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_166, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_167, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_168, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_169, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_170, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_171, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_172, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_173, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_174, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_175, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_176, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_177, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_178, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_179, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_180, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_181, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_182, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_183, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_184, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_185, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_186, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_187, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogDoubleExponential_vv_188, AgradCdfLogTestFixture, AgradCdfLogDoubleExponential_vv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<double, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<double, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<double, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<double, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<double, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_0> AgradDistributionExpModNormal_ffv_0;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_1> AgradDistributionExpModNormal_ffv_1;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_2> AgradDistributionExpModNormal_ffv_2;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_3> AgradDistributionExpModNormal_ffv_3;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_4> AgradDistributionExpModNormal_ffv_4;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_5> AgradDistributionExpModNormal_ffv_5;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_6> AgradDistributionExpModNormal_ffv_6;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_7> AgradDistributionExpModNormal_ffv_7;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_8> AgradDistributionExpModNormal_ffv_8;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_9> AgradDistributionExpModNormal_ffv_9;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_10> AgradDistributionExpModNormal_ffv_10;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_11> AgradDistributionExpModNormal_ffv_11;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_12> AgradDistributionExpModNormal_ffv_12;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_13> AgradDistributionExpModNormal_ffv_13;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_14> AgradDistributionExpModNormal_ffv_14;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_15> AgradDistributionExpModNormal_ffv_15;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_16> AgradDistributionExpModNormal_ffv_16;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_17> AgradDistributionExpModNormal_ffv_17;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_18> AgradDistributionExpModNormal_ffv_18;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_19> AgradDistributionExpModNormal_ffv_19;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_20> AgradDistributionExpModNormal_ffv_20;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_21> AgradDistributionExpModNormal_ffv_21;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_22> AgradDistributionExpModNormal_ffv_22;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_23> AgradDistributionExpModNormal_ffv_23;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_24> AgradDistributionExpModNormal_ffv_24;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_25> AgradDistributionExpModNormal_ffv_25;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_26> AgradDistributionExpModNormal_ffv_26;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_27> AgradDistributionExpModNormal_ffv_27;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_28> AgradDistributionExpModNormal_ffv_28;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_29> AgradDistributionExpModNormal_ffv_29;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_30> AgradDistributionExpModNormal_ffv_30;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_31> AgradDistributionExpModNormal_ffv_31;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_32> AgradDistributionExpModNormal_ffv_32;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_33> AgradDistributionExpModNormal_ffv_33;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_34> AgradDistributionExpModNormal_ffv_34;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_35> AgradDistributionExpModNormal_ffv_35;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_36> AgradDistributionExpModNormal_ffv_36;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_37> AgradDistributionExpModNormal_ffv_37;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_38> AgradDistributionExpModNormal_ffv_38;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_39> AgradDistributionExpModNormal_ffv_39;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_40> AgradDistributionExpModNormal_ffv_40;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_41> AgradDistributionExpModNormal_ffv_41;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_42> AgradDistributionExpModNormal_ffv_42;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_43> AgradDistributionExpModNormal_ffv_43;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_44> AgradDistributionExpModNormal_ffv_44;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_45> AgradDistributionExpModNormal_ffv_45;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_46> AgradDistributionExpModNormal_ffv_46;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_47> AgradDistributionExpModNormal_ffv_47;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_48> AgradDistributionExpModNormal_ffv_48;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_49> AgradDistributionExpModNormal_ffv_49;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_50> AgradDistributionExpModNormal_ffv_50;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_51> AgradDistributionExpModNormal_ffv_51;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_52> AgradDistributionExpModNormal_ffv_52;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_53> AgradDistributionExpModNormal_ffv_53;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_54> AgradDistributionExpModNormal_ffv_54;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_55> AgradDistributionExpModNormal_ffv_55;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_56> AgradDistributionExpModNormal_ffv_56;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_57> AgradDistributionExpModNormal_ffv_57;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_58> AgradDistributionExpModNormal_ffv_58;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_59> AgradDistributionExpModNormal_ffv_59;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_60> AgradDistributionExpModNormal_ffv_60;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_61> AgradDistributionExpModNormal_ffv_61;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_62> AgradDistributionExpModNormal_ffv_62;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_63> AgradDistributionExpModNormal_ffv_63;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_64> AgradDistributionExpModNormal_ffv_64;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_65> AgradDistributionExpModNormal_ffv_65;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_66> AgradDistributionExpModNormal_ffv_66;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_67> AgradDistributionExpModNormal_ffv_67;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_68> AgradDistributionExpModNormal_ffv_68;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_69> AgradDistributionExpModNormal_ffv_69;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_70> AgradDistributionExpModNormal_ffv_70;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_71> AgradDistributionExpModNormal_ffv_71;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_72> AgradDistributionExpModNormal_ffv_72;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_73> AgradDistributionExpModNormal_ffv_73;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_74> AgradDistributionExpModNormal_ffv_74;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_75> AgradDistributionExpModNormal_ffv_75;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_76> AgradDistributionExpModNormal_ffv_76;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_77> AgradDistributionExpModNormal_ffv_77;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_78> AgradDistributionExpModNormal_ffv_78;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_79> AgradDistributionExpModNormal_ffv_79;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_80> AgradDistributionExpModNormal_ffv_80;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_81> AgradDistributionExpModNormal_ffv_81;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_82> AgradDistributionExpModNormal_ffv_82;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_83> AgradDistributionExpModNormal_ffv_83;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_84> AgradDistributionExpModNormal_ffv_84;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_85> AgradDistributionExpModNormal_ffv_85;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_86> AgradDistributionExpModNormal_ffv_86;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_87> AgradDistributionExpModNormal_ffv_87;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_88> AgradDistributionExpModNormal_ffv_88;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_89> AgradDistributionExpModNormal_ffv_89;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_90> AgradDistributionExpModNormal_ffv_90;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_91> AgradDistributionExpModNormal_ffv_91;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_92> AgradDistributionExpModNormal_ffv_92;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_93> AgradDistributionExpModNormal_ffv_93;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_94> AgradDistributionExpModNormal_ffv_94;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_95> AgradDistributionExpModNormal_ffv_95;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_96> AgradDistributionExpModNormal_ffv_96;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_97> AgradDistributionExpModNormal_ffv_97;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_98> AgradDistributionExpModNormal_ffv_98;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_99> AgradDistributionExpModNormal_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_0, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_1, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_2, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_3, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_4, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_5, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_6, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_7, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_8, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_9, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_10, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_11, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_12, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_13, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_14, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_15, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_16, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_17, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_18, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_19, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_20, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_21, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_22, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_23, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_24, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_25, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_26, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_27, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_28, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_29, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_30, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_31, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_32, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_33, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_34, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_35, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_36, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_37, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_38, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_39, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_40, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_41, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_42, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_43, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_44, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_45, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_46, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_47, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_48, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_49, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_50, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_51, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_52, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_53, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_54, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_55, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_56, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_57, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_58, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_59, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_60, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_61, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_62, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_63, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_64, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_65, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_66, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_67, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_68, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_69, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_70, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_71, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_72, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_73, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_74, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_75, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_76, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_77, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_78, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_79, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_80, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_81, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_82, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_83, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_84, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_85, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_86, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_87, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_88, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_89, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_90, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_91, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_92, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_93, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_94, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_95, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_96, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_97, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_98, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_99, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_99);
+
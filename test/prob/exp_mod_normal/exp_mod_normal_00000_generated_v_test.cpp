@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<double, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<double, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<double, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<double, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<double, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<double, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<double, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<double, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<double, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_0> AgradDistributionExpModNormal_v_0;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1> AgradDistributionExpModNormal_v_1;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_2> AgradDistributionExpModNormal_v_2;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_3> AgradDistributionExpModNormal_v_3;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_4> AgradDistributionExpModNormal_v_4;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_5> AgradDistributionExpModNormal_v_5;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_6> AgradDistributionExpModNormal_v_6;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_7> AgradDistributionExpModNormal_v_7;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_8> AgradDistributionExpModNormal_v_8;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_9> AgradDistributionExpModNormal_v_9;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_10> AgradDistributionExpModNormal_v_10;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_11> AgradDistributionExpModNormal_v_11;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_12> AgradDistributionExpModNormal_v_12;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_13> AgradDistributionExpModNormal_v_13;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_14> AgradDistributionExpModNormal_v_14;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_15> AgradDistributionExpModNormal_v_15;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_16> AgradDistributionExpModNormal_v_16;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_17> AgradDistributionExpModNormal_v_17;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_18> AgradDistributionExpModNormal_v_18;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_19> AgradDistributionExpModNormal_v_19;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_20> AgradDistributionExpModNormal_v_20;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_21> AgradDistributionExpModNormal_v_21;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_22> AgradDistributionExpModNormal_v_22;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_23> AgradDistributionExpModNormal_v_23;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_24> AgradDistributionExpModNormal_v_24;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_25> AgradDistributionExpModNormal_v_25;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_26> AgradDistributionExpModNormal_v_26;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_27> AgradDistributionExpModNormal_v_27;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_28> AgradDistributionExpModNormal_v_28;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_29> AgradDistributionExpModNormal_v_29;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_30> AgradDistributionExpModNormal_v_30;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_31> AgradDistributionExpModNormal_v_31;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_32> AgradDistributionExpModNormal_v_32;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_33> AgradDistributionExpModNormal_v_33;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_34> AgradDistributionExpModNormal_v_34;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_35> AgradDistributionExpModNormal_v_35;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_36> AgradDistributionExpModNormal_v_36;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_37> AgradDistributionExpModNormal_v_37;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_38> AgradDistributionExpModNormal_v_38;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_39> AgradDistributionExpModNormal_v_39;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_40> AgradDistributionExpModNormal_v_40;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_41> AgradDistributionExpModNormal_v_41;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_42> AgradDistributionExpModNormal_v_42;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_43> AgradDistributionExpModNormal_v_43;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_44> AgradDistributionExpModNormal_v_44;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_45> AgradDistributionExpModNormal_v_45;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_46> AgradDistributionExpModNormal_v_46;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_47> AgradDistributionExpModNormal_v_47;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_48> AgradDistributionExpModNormal_v_48;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_49> AgradDistributionExpModNormal_v_49;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_50> AgradDistributionExpModNormal_v_50;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_51> AgradDistributionExpModNormal_v_51;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_52> AgradDistributionExpModNormal_v_52;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_53> AgradDistributionExpModNormal_v_53;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_54> AgradDistributionExpModNormal_v_54;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_55> AgradDistributionExpModNormal_v_55;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_56> AgradDistributionExpModNormal_v_56;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_57> AgradDistributionExpModNormal_v_57;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_58> AgradDistributionExpModNormal_v_58;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_59> AgradDistributionExpModNormal_v_59;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_60> AgradDistributionExpModNormal_v_60;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_61> AgradDistributionExpModNormal_v_61;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_62> AgradDistributionExpModNormal_v_62;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_63> AgradDistributionExpModNormal_v_63;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_64> AgradDistributionExpModNormal_v_64;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_65> AgradDistributionExpModNormal_v_65;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_66> AgradDistributionExpModNormal_v_66;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_67> AgradDistributionExpModNormal_v_67;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_68> AgradDistributionExpModNormal_v_68;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_69> AgradDistributionExpModNormal_v_69;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_70> AgradDistributionExpModNormal_v_70;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_71> AgradDistributionExpModNormal_v_71;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_72> AgradDistributionExpModNormal_v_72;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_73> AgradDistributionExpModNormal_v_73;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_74> AgradDistributionExpModNormal_v_74;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_75> AgradDistributionExpModNormal_v_75;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_76> AgradDistributionExpModNormal_v_76;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_77> AgradDistributionExpModNormal_v_77;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_78> AgradDistributionExpModNormal_v_78;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_79> AgradDistributionExpModNormal_v_79;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_80> AgradDistributionExpModNormal_v_80;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_81> AgradDistributionExpModNormal_v_81;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_82> AgradDistributionExpModNormal_v_82;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_83> AgradDistributionExpModNormal_v_83;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_84> AgradDistributionExpModNormal_v_84;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_85> AgradDistributionExpModNormal_v_85;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_86> AgradDistributionExpModNormal_v_86;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_87> AgradDistributionExpModNormal_v_87;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_88> AgradDistributionExpModNormal_v_88;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_89> AgradDistributionExpModNormal_v_89;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_90> AgradDistributionExpModNormal_v_90;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_91> AgradDistributionExpModNormal_v_91;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_92> AgradDistributionExpModNormal_v_92;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_93> AgradDistributionExpModNormal_v_93;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_94> AgradDistributionExpModNormal_v_94;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_95> AgradDistributionExpModNormal_v_95;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_96> AgradDistributionExpModNormal_v_96;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_97> AgradDistributionExpModNormal_v_97;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_98> AgradDistributionExpModNormal_v_98;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_99> AgradDistributionExpModNormal_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_0, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_2, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_3, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_4, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_5, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_6, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_7, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_8, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_9, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_10, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_11, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_12, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_13, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_14, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_15, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_16, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_17, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_18, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_19, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_20, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_21, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_22, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_23, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_24, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_25, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_26, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_27, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_28, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_29, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_30, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_31, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_32, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_33, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_34, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_35, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_36, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_37, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_38, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_39, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_40, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_41, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_42, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_43, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_44, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_45, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_46, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_47, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_48, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_49, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_50, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_51, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_52, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_53, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_54, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_55, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_56, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_57, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_58, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_59, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_60, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_61, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_62, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_63, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_64, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_65, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_66, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_67, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_68, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_69, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_70, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_71, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_72, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_73, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_74, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_75, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_76, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_77, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_78, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_79, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_80, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_81, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_82, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_83, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_84, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_85, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_86, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_87, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_88, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_89, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_90, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_91, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_92, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_93, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_94, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_95, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_96, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_97, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_98, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_99, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_99);
+
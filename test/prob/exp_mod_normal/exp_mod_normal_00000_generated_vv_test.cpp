@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<double, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<double, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<double, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<double, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<double, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<double, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<double, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<double, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<double, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<double, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<double, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<double, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<double, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<double, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_0> AgradDistributionExpModNormal_vv_0;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_1> AgradDistributionExpModNormal_vv_1;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_2> AgradDistributionExpModNormal_vv_2;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_3> AgradDistributionExpModNormal_vv_3;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_4> AgradDistributionExpModNormal_vv_4;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_5> AgradDistributionExpModNormal_vv_5;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_6> AgradDistributionExpModNormal_vv_6;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_7> AgradDistributionExpModNormal_vv_7;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_8> AgradDistributionExpModNormal_vv_8;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_9> AgradDistributionExpModNormal_vv_9;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_10> AgradDistributionExpModNormal_vv_10;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_11> AgradDistributionExpModNormal_vv_11;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_12> AgradDistributionExpModNormal_vv_12;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_13> AgradDistributionExpModNormal_vv_13;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_14> AgradDistributionExpModNormal_vv_14;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_15> AgradDistributionExpModNormal_vv_15;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_16> AgradDistributionExpModNormal_vv_16;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_17> AgradDistributionExpModNormal_vv_17;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_18> AgradDistributionExpModNormal_vv_18;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_19> AgradDistributionExpModNormal_vv_19;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_20> AgradDistributionExpModNormal_vv_20;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_21> AgradDistributionExpModNormal_vv_21;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_22> AgradDistributionExpModNormal_vv_22;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_23> AgradDistributionExpModNormal_vv_23;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_24> AgradDistributionExpModNormal_vv_24;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_25> AgradDistributionExpModNormal_vv_25;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_26> AgradDistributionExpModNormal_vv_26;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_27> AgradDistributionExpModNormal_vv_27;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_28> AgradDistributionExpModNormal_vv_28;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_29> AgradDistributionExpModNormal_vv_29;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_30> AgradDistributionExpModNormal_vv_30;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_31> AgradDistributionExpModNormal_vv_31;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_32> AgradDistributionExpModNormal_vv_32;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_33> AgradDistributionExpModNormal_vv_33;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_34> AgradDistributionExpModNormal_vv_34;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_35> AgradDistributionExpModNormal_vv_35;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_36> AgradDistributionExpModNormal_vv_36;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_37> AgradDistributionExpModNormal_vv_37;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_38> AgradDistributionExpModNormal_vv_38;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_39> AgradDistributionExpModNormal_vv_39;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_40> AgradDistributionExpModNormal_vv_40;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_41> AgradDistributionExpModNormal_vv_41;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_42> AgradDistributionExpModNormal_vv_42;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_43> AgradDistributionExpModNormal_vv_43;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_44> AgradDistributionExpModNormal_vv_44;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_45> AgradDistributionExpModNormal_vv_45;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_46> AgradDistributionExpModNormal_vv_46;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_47> AgradDistributionExpModNormal_vv_47;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_48> AgradDistributionExpModNormal_vv_48;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_49> AgradDistributionExpModNormal_vv_49;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_50> AgradDistributionExpModNormal_vv_50;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_51> AgradDistributionExpModNormal_vv_51;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_52> AgradDistributionExpModNormal_vv_52;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_53> AgradDistributionExpModNormal_vv_53;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_54> AgradDistributionExpModNormal_vv_54;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_55> AgradDistributionExpModNormal_vv_55;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_56> AgradDistributionExpModNormal_vv_56;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_57> AgradDistributionExpModNormal_vv_57;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_58> AgradDistributionExpModNormal_vv_58;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_59> AgradDistributionExpModNormal_vv_59;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_60> AgradDistributionExpModNormal_vv_60;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_61> AgradDistributionExpModNormal_vv_61;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_62> AgradDistributionExpModNormal_vv_62;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_63> AgradDistributionExpModNormal_vv_63;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_64> AgradDistributionExpModNormal_vv_64;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_65> AgradDistributionExpModNormal_vv_65;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_66> AgradDistributionExpModNormal_vv_66;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_67> AgradDistributionExpModNormal_vv_67;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_68> AgradDistributionExpModNormal_vv_68;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_69> AgradDistributionExpModNormal_vv_69;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_70> AgradDistributionExpModNormal_vv_70;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_71> AgradDistributionExpModNormal_vv_71;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_72> AgradDistributionExpModNormal_vv_72;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_73> AgradDistributionExpModNormal_vv_73;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_74> AgradDistributionExpModNormal_vv_74;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_75> AgradDistributionExpModNormal_vv_75;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_76> AgradDistributionExpModNormal_vv_76;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_77> AgradDistributionExpModNormal_vv_77;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_78> AgradDistributionExpModNormal_vv_78;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_79> AgradDistributionExpModNormal_vv_79;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_80> AgradDistributionExpModNormal_vv_80;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_81> AgradDistributionExpModNormal_vv_81;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_82> AgradDistributionExpModNormal_vv_82;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_83> AgradDistributionExpModNormal_vv_83;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_84> AgradDistributionExpModNormal_vv_84;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_85> AgradDistributionExpModNormal_vv_85;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_86> AgradDistributionExpModNormal_vv_86;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_87> AgradDistributionExpModNormal_vv_87;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_88> AgradDistributionExpModNormal_vv_88;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_89> AgradDistributionExpModNormal_vv_89;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_90> AgradDistributionExpModNormal_vv_90;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_91> AgradDistributionExpModNormal_vv_91;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_92> AgradDistributionExpModNormal_vv_92;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_93> AgradDistributionExpModNormal_vv_93;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_94> AgradDistributionExpModNormal_vv_94;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_95> AgradDistributionExpModNormal_vv_95;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_96> AgradDistributionExpModNormal_vv_96;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_97> AgradDistributionExpModNormal_vv_97;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_98> AgradDistributionExpModNormal_vv_98;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_99> AgradDistributionExpModNormal_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_0, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_1, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_2, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_3, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_4, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_5, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_6, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_7, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_8, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_9, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_10, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_11, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_12, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_13, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_14, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_15, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_16, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_17, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_18, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_19, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_20, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_21, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_22, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_23, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_24, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_25, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_26, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_27, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_28, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_29, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_30, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_31, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_32, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_33, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_34, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_35, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_36, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_37, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_38, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_39, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_40, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_41, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_42, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_43, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_44, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_45, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_46, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_47, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_48, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_49, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_50, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_51, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_52, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_53, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_54, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_55, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_56, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_57, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_58, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_59, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_60, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_61, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_62, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_63, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_64, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_65, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_66, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_67, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_68, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_69, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_70, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_71, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_72, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_73, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_74, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_75, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_76, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_77, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_78, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_79, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_80, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_81, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_82, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_83, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_84, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_85, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_86, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_87, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_88, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_89, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_90, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_91, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_92, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_93, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_94, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_95, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_96, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_97, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_98, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_99, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<double>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_100> AgradDistributionExpModNormal_ffv_100;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_101> AgradDistributionExpModNormal_ffv_101;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_102> AgradDistributionExpModNormal_ffv_102;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_103> AgradDistributionExpModNormal_ffv_103;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_104> AgradDistributionExpModNormal_ffv_104;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_105> AgradDistributionExpModNormal_ffv_105;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_106> AgradDistributionExpModNormal_ffv_106;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_107> AgradDistributionExpModNormal_ffv_107;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_108> AgradDistributionExpModNormal_ffv_108;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_109> AgradDistributionExpModNormal_ffv_109;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_110> AgradDistributionExpModNormal_ffv_110;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_111> AgradDistributionExpModNormal_ffv_111;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_112> AgradDistributionExpModNormal_ffv_112;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_113> AgradDistributionExpModNormal_ffv_113;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_114> AgradDistributionExpModNormal_ffv_114;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_115> AgradDistributionExpModNormal_ffv_115;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_116> AgradDistributionExpModNormal_ffv_116;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_117> AgradDistributionExpModNormal_ffv_117;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_118> AgradDistributionExpModNormal_ffv_118;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_119> AgradDistributionExpModNormal_ffv_119;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_120> AgradDistributionExpModNormal_ffv_120;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_121> AgradDistributionExpModNormal_ffv_121;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_122> AgradDistributionExpModNormal_ffv_122;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_123> AgradDistributionExpModNormal_ffv_123;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_124> AgradDistributionExpModNormal_ffv_124;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_125> AgradDistributionExpModNormal_ffv_125;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_126> AgradDistributionExpModNormal_ffv_126;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_127> AgradDistributionExpModNormal_ffv_127;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_128> AgradDistributionExpModNormal_ffv_128;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_129> AgradDistributionExpModNormal_ffv_129;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_130> AgradDistributionExpModNormal_ffv_130;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_131> AgradDistributionExpModNormal_ffv_131;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_132> AgradDistributionExpModNormal_ffv_132;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_133> AgradDistributionExpModNormal_ffv_133;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_134> AgradDistributionExpModNormal_ffv_134;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_135> AgradDistributionExpModNormal_ffv_135;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_136> AgradDistributionExpModNormal_ffv_136;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_137> AgradDistributionExpModNormal_ffv_137;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_138> AgradDistributionExpModNormal_ffv_138;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_139> AgradDistributionExpModNormal_ffv_139;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_140> AgradDistributionExpModNormal_ffv_140;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_141> AgradDistributionExpModNormal_ffv_141;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_142> AgradDistributionExpModNormal_ffv_142;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_143> AgradDistributionExpModNormal_ffv_143;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_144> AgradDistributionExpModNormal_ffv_144;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_145> AgradDistributionExpModNormal_ffv_145;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_146> AgradDistributionExpModNormal_ffv_146;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_147> AgradDistributionExpModNormal_ffv_147;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_148> AgradDistributionExpModNormal_ffv_148;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_149> AgradDistributionExpModNormal_ffv_149;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_150> AgradDistributionExpModNormal_ffv_150;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_151> AgradDistributionExpModNormal_ffv_151;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_152> AgradDistributionExpModNormal_ffv_152;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_153> AgradDistributionExpModNormal_ffv_153;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_154> AgradDistributionExpModNormal_ffv_154;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_155> AgradDistributionExpModNormal_ffv_155;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_156> AgradDistributionExpModNormal_ffv_156;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_157> AgradDistributionExpModNormal_ffv_157;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_158> AgradDistributionExpModNormal_ffv_158;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_159> AgradDistributionExpModNormal_ffv_159;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_160> AgradDistributionExpModNormal_ffv_160;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_161> AgradDistributionExpModNormal_ffv_161;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_162> AgradDistributionExpModNormal_ffv_162;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_163> AgradDistributionExpModNormal_ffv_163;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_164> AgradDistributionExpModNormal_ffv_164;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_165> AgradDistributionExpModNormal_ffv_165;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_166> AgradDistributionExpModNormal_ffv_166;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_167> AgradDistributionExpModNormal_ffv_167;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_168> AgradDistributionExpModNormal_ffv_168;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_169> AgradDistributionExpModNormal_ffv_169;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_170> AgradDistributionExpModNormal_ffv_170;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_171> AgradDistributionExpModNormal_ffv_171;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_172> AgradDistributionExpModNormal_ffv_172;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_173> AgradDistributionExpModNormal_ffv_173;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_174> AgradDistributionExpModNormal_ffv_174;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_175> AgradDistributionExpModNormal_ffv_175;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_176> AgradDistributionExpModNormal_ffv_176;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_177> AgradDistributionExpModNormal_ffv_177;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_178> AgradDistributionExpModNormal_ffv_178;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_179> AgradDistributionExpModNormal_ffv_179;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_180> AgradDistributionExpModNormal_ffv_180;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_181> AgradDistributionExpModNormal_ffv_181;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_182> AgradDistributionExpModNormal_ffv_182;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_183> AgradDistributionExpModNormal_ffv_183;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_184> AgradDistributionExpModNormal_ffv_184;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_185> AgradDistributionExpModNormal_ffv_185;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_186> AgradDistributionExpModNormal_ffv_186;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_187> AgradDistributionExpModNormal_ffv_187;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_188> AgradDistributionExpModNormal_ffv_188;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_189> AgradDistributionExpModNormal_ffv_189;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_190> AgradDistributionExpModNormal_ffv_190;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_191> AgradDistributionExpModNormal_ffv_191;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_192> AgradDistributionExpModNormal_ffv_192;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_193> AgradDistributionExpModNormal_ffv_193;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_194> AgradDistributionExpModNormal_ffv_194;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_195> AgradDistributionExpModNormal_ffv_195;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_196> AgradDistributionExpModNormal_ffv_196;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_197> AgradDistributionExpModNormal_ffv_197;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_198> AgradDistributionExpModNormal_ffv_198;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_199> AgradDistributionExpModNormal_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_100, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_101, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_102, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_103, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_104, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_105, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_106, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_107, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_108, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_109, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_110, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_111, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_112, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_113, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_114, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_115, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_116, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_117, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_118, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_119, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_120, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_121, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_122, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_123, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_124, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_125, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_126, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_127, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_128, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_129, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_130, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_131, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_132, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_133, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_134, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_135, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_136, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_137, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_138, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_139, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_140, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_141, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_142, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_143, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_144, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_145, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_146, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_147, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_148, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_149, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_150, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_151, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_152, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_153, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_154, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_155, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_156, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_157, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_158, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_159, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_160, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_161, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_162, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_163, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_164, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_165, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_166, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_167, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_168, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_169, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_170, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_171, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_172, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_173, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_174, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_175, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_176, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_177, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_178, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_179, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_180, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_181, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_182, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_183, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_184, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_185, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_186, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_187, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_188, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_189, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_190, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_191, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_192, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_193, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_194, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_195, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_196, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_197, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_198, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_199, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<double, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<double, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<double, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<double, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_100> AgradDistributionExpModNormal_v_100;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_101> AgradDistributionExpModNormal_v_101;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_102> AgradDistributionExpModNormal_v_102;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_103> AgradDistributionExpModNormal_v_103;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_104> AgradDistributionExpModNormal_v_104;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_105> AgradDistributionExpModNormal_v_105;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_106> AgradDistributionExpModNormal_v_106;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_107> AgradDistributionExpModNormal_v_107;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_108> AgradDistributionExpModNormal_v_108;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_109> AgradDistributionExpModNormal_v_109;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_110> AgradDistributionExpModNormal_v_110;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_111> AgradDistributionExpModNormal_v_111;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_112> AgradDistributionExpModNormal_v_112;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_113> AgradDistributionExpModNormal_v_113;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_114> AgradDistributionExpModNormal_v_114;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_115> AgradDistributionExpModNormal_v_115;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_116> AgradDistributionExpModNormal_v_116;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_117> AgradDistributionExpModNormal_v_117;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_118> AgradDistributionExpModNormal_v_118;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_119> AgradDistributionExpModNormal_v_119;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_120> AgradDistributionExpModNormal_v_120;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_121> AgradDistributionExpModNormal_v_121;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_122> AgradDistributionExpModNormal_v_122;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_123> AgradDistributionExpModNormal_v_123;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_124> AgradDistributionExpModNormal_v_124;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_125> AgradDistributionExpModNormal_v_125;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_126> AgradDistributionExpModNormal_v_126;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_127> AgradDistributionExpModNormal_v_127;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_128> AgradDistributionExpModNormal_v_128;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_129> AgradDistributionExpModNormal_v_129;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_130> AgradDistributionExpModNormal_v_130;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_131> AgradDistributionExpModNormal_v_131;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_132> AgradDistributionExpModNormal_v_132;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_133> AgradDistributionExpModNormal_v_133;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_134> AgradDistributionExpModNormal_v_134;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_135> AgradDistributionExpModNormal_v_135;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_136> AgradDistributionExpModNormal_v_136;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_137> AgradDistributionExpModNormal_v_137;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_138> AgradDistributionExpModNormal_v_138;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_139> AgradDistributionExpModNormal_v_139;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_140> AgradDistributionExpModNormal_v_140;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_141> AgradDistributionExpModNormal_v_141;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_142> AgradDistributionExpModNormal_v_142;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_143> AgradDistributionExpModNormal_v_143;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_144> AgradDistributionExpModNormal_v_144;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_145> AgradDistributionExpModNormal_v_145;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_146> AgradDistributionExpModNormal_v_146;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_147> AgradDistributionExpModNormal_v_147;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_148> AgradDistributionExpModNormal_v_148;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_149> AgradDistributionExpModNormal_v_149;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_150> AgradDistributionExpModNormal_v_150;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_151> AgradDistributionExpModNormal_v_151;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_152> AgradDistributionExpModNormal_v_152;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_153> AgradDistributionExpModNormal_v_153;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_154> AgradDistributionExpModNormal_v_154;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_155> AgradDistributionExpModNormal_v_155;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_156> AgradDistributionExpModNormal_v_156;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_157> AgradDistributionExpModNormal_v_157;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_158> AgradDistributionExpModNormal_v_158;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_159> AgradDistributionExpModNormal_v_159;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_160> AgradDistributionExpModNormal_v_160;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_161> AgradDistributionExpModNormal_v_161;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_162> AgradDistributionExpModNormal_v_162;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_163> AgradDistributionExpModNormal_v_163;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_164> AgradDistributionExpModNormal_v_164;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_165> AgradDistributionExpModNormal_v_165;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_166> AgradDistributionExpModNormal_v_166;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_167> AgradDistributionExpModNormal_v_167;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_168> AgradDistributionExpModNormal_v_168;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_169> AgradDistributionExpModNormal_v_169;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_170> AgradDistributionExpModNormal_v_170;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_171> AgradDistributionExpModNormal_v_171;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_172> AgradDistributionExpModNormal_v_172;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_173> AgradDistributionExpModNormal_v_173;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_174> AgradDistributionExpModNormal_v_174;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_175> AgradDistributionExpModNormal_v_175;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_176> AgradDistributionExpModNormal_v_176;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_177> AgradDistributionExpModNormal_v_177;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_178> AgradDistributionExpModNormal_v_178;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_179> AgradDistributionExpModNormal_v_179;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_180> AgradDistributionExpModNormal_v_180;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_181> AgradDistributionExpModNormal_v_181;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_182> AgradDistributionExpModNormal_v_182;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_183> AgradDistributionExpModNormal_v_183;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_184> AgradDistributionExpModNormal_v_184;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_185> AgradDistributionExpModNormal_v_185;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_186> AgradDistributionExpModNormal_v_186;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_187> AgradDistributionExpModNormal_v_187;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_188> AgradDistributionExpModNormal_v_188;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_189> AgradDistributionExpModNormal_v_189;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_190> AgradDistributionExpModNormal_v_190;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_191> AgradDistributionExpModNormal_v_191;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_192> AgradDistributionExpModNormal_v_192;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_193> AgradDistributionExpModNormal_v_193;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_194> AgradDistributionExpModNormal_v_194;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_195> AgradDistributionExpModNormal_v_195;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_196> AgradDistributionExpModNormal_v_196;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_197> AgradDistributionExpModNormal_v_197;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_198> AgradDistributionExpModNormal_v_198;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_199> AgradDistributionExpModNormal_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_100, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_101, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_102, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_103, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_104, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_105, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_106, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_107, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_108, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_109, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_110, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_111, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_112, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_113, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_114, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_115, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_116, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_117, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_118, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_119, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_120, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_121, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_122, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_123, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_124, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_125, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_126, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_127, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_128, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_129, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_130, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_131, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_132, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_133, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_134, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_135, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_136, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_137, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_138, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_139, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_140, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_141, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_142, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_143, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_144, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_145, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_146, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_147, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_148, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_149, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_150, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_151, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_152, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_153, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_154, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_155, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_156, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_157, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_158, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_159, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_160, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_161, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_162, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_163, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_164, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_165, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_166, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_167, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_168, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_169, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_170, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_171, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_172, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_173, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_174, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_175, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_176, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_177, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_178, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_179, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_180, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_181, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_182, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_183, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_184, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_185, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_186, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_187, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_188, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_189, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_190, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_191, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_192, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_193, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_194, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_195, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_196, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_197, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_198, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_199, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<double, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<double, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<double, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<double, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<double, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<double>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_100> AgradDistributionExpModNormal_vv_100;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_101> AgradDistributionExpModNormal_vv_101;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_102> AgradDistributionExpModNormal_vv_102;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_103> AgradDistributionExpModNormal_vv_103;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_104> AgradDistributionExpModNormal_vv_104;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_105> AgradDistributionExpModNormal_vv_105;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_106> AgradDistributionExpModNormal_vv_106;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_107> AgradDistributionExpModNormal_vv_107;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_108> AgradDistributionExpModNormal_vv_108;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_109> AgradDistributionExpModNormal_vv_109;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_110> AgradDistributionExpModNormal_vv_110;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_111> AgradDistributionExpModNormal_vv_111;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_112> AgradDistributionExpModNormal_vv_112;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_113> AgradDistributionExpModNormal_vv_113;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_114> AgradDistributionExpModNormal_vv_114;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_115> AgradDistributionExpModNormal_vv_115;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_116> AgradDistributionExpModNormal_vv_116;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_117> AgradDistributionExpModNormal_vv_117;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_118> AgradDistributionExpModNormal_vv_118;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_119> AgradDistributionExpModNormal_vv_119;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_120> AgradDistributionExpModNormal_vv_120;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_121> AgradDistributionExpModNormal_vv_121;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_122> AgradDistributionExpModNormal_vv_122;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_123> AgradDistributionExpModNormal_vv_123;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_124> AgradDistributionExpModNormal_vv_124;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_125> AgradDistributionExpModNormal_vv_125;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_126> AgradDistributionExpModNormal_vv_126;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_127> AgradDistributionExpModNormal_vv_127;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_128> AgradDistributionExpModNormal_vv_128;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_129> AgradDistributionExpModNormal_vv_129;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_130> AgradDistributionExpModNormal_vv_130;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_131> AgradDistributionExpModNormal_vv_131;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_132> AgradDistributionExpModNormal_vv_132;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_133> AgradDistributionExpModNormal_vv_133;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_134> AgradDistributionExpModNormal_vv_134;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_135> AgradDistributionExpModNormal_vv_135;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_136> AgradDistributionExpModNormal_vv_136;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_137> AgradDistributionExpModNormal_vv_137;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_138> AgradDistributionExpModNormal_vv_138;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_139> AgradDistributionExpModNormal_vv_139;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_140> AgradDistributionExpModNormal_vv_140;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_141> AgradDistributionExpModNormal_vv_141;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_142> AgradDistributionExpModNormal_vv_142;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_143> AgradDistributionExpModNormal_vv_143;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_144> AgradDistributionExpModNormal_vv_144;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_145> AgradDistributionExpModNormal_vv_145;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_146> AgradDistributionExpModNormal_vv_146;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_147> AgradDistributionExpModNormal_vv_147;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_148> AgradDistributionExpModNormal_vv_148;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_149> AgradDistributionExpModNormal_vv_149;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_150> AgradDistributionExpModNormal_vv_150;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_151> AgradDistributionExpModNormal_vv_151;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_152> AgradDistributionExpModNormal_vv_152;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_153> AgradDistributionExpModNormal_vv_153;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_154> AgradDistributionExpModNormal_vv_154;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_155> AgradDistributionExpModNormal_vv_155;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_156> AgradDistributionExpModNormal_vv_156;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_157> AgradDistributionExpModNormal_vv_157;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_158> AgradDistributionExpModNormal_vv_158;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_159> AgradDistributionExpModNormal_vv_159;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_160> AgradDistributionExpModNormal_vv_160;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_161> AgradDistributionExpModNormal_vv_161;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_162> AgradDistributionExpModNormal_vv_162;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_163> AgradDistributionExpModNormal_vv_163;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_164> AgradDistributionExpModNormal_vv_164;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_165> AgradDistributionExpModNormal_vv_165;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_166> AgradDistributionExpModNormal_vv_166;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_167> AgradDistributionExpModNormal_vv_167;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_168> AgradDistributionExpModNormal_vv_168;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_169> AgradDistributionExpModNormal_vv_169;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_170> AgradDistributionExpModNormal_vv_170;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_171> AgradDistributionExpModNormal_vv_171;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_172> AgradDistributionExpModNormal_vv_172;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_173> AgradDistributionExpModNormal_vv_173;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_174> AgradDistributionExpModNormal_vv_174;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_175> AgradDistributionExpModNormal_vv_175;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_176> AgradDistributionExpModNormal_vv_176;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_177> AgradDistributionExpModNormal_vv_177;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_178> AgradDistributionExpModNormal_vv_178;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_179> AgradDistributionExpModNormal_vv_179;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_180> AgradDistributionExpModNormal_vv_180;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_181> AgradDistributionExpModNormal_vv_181;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_182> AgradDistributionExpModNormal_vv_182;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_183> AgradDistributionExpModNormal_vv_183;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_184> AgradDistributionExpModNormal_vv_184;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_185> AgradDistributionExpModNormal_vv_185;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_186> AgradDistributionExpModNormal_vv_186;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_187> AgradDistributionExpModNormal_vv_187;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_188> AgradDistributionExpModNormal_vv_188;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_189> AgradDistributionExpModNormal_vv_189;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_190> AgradDistributionExpModNormal_vv_190;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_191> AgradDistributionExpModNormal_vv_191;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_192> AgradDistributionExpModNormal_vv_192;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_193> AgradDistributionExpModNormal_vv_193;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_194> AgradDistributionExpModNormal_vv_194;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_195> AgradDistributionExpModNormal_vv_195;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_196> AgradDistributionExpModNormal_vv_196;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_197> AgradDistributionExpModNormal_vv_197;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_198> AgradDistributionExpModNormal_vv_198;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_199> AgradDistributionExpModNormal_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_100, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_101, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_102, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_103, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_104, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_105, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_106, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_107, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_108, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_109, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_110, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_111, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_112, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_113, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_114, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_115, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_116, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_117, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_118, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_119, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_120, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_121, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_122, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_123, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_124, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_125, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_126, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_127, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_128, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_129, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_130, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_131, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_132, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_133, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_134, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_135, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_136, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_137, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_138, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_139, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_140, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_141, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_142, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_143, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_144, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_145, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_146, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_147, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_148, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_149, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_150, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_151, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_152, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_153, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_154, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_155, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_156, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_157, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_158, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_159, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_160, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_161, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_162, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_163, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_164, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_165, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_166, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_167, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_168, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_169, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_170, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_171, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_172, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_173, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_174, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_175, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_176, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_177, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_178, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_179, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_180, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_181, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_182, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_183, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_184, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_185, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_186, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_187, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_188, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_189, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_190, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_191, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_192, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_193, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_194, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_195, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_196, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_197, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_198, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_199, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_200> AgradDistributionExpModNormal_ffv_200;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_201> AgradDistributionExpModNormal_ffv_201;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_202> AgradDistributionExpModNormal_ffv_202;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_203> AgradDistributionExpModNormal_ffv_203;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_204> AgradDistributionExpModNormal_ffv_204;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_205> AgradDistributionExpModNormal_ffv_205;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_206> AgradDistributionExpModNormal_ffv_206;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_207> AgradDistributionExpModNormal_ffv_207;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_208> AgradDistributionExpModNormal_ffv_208;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_209> AgradDistributionExpModNormal_ffv_209;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_210> AgradDistributionExpModNormal_ffv_210;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_211> AgradDistributionExpModNormal_ffv_211;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_212> AgradDistributionExpModNormal_ffv_212;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_213> AgradDistributionExpModNormal_ffv_213;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_214> AgradDistributionExpModNormal_ffv_214;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_215> AgradDistributionExpModNormal_ffv_215;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_216> AgradDistributionExpModNormal_ffv_216;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_217> AgradDistributionExpModNormal_ffv_217;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_218> AgradDistributionExpModNormal_ffv_218;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_219> AgradDistributionExpModNormal_ffv_219;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_220> AgradDistributionExpModNormal_ffv_220;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_221> AgradDistributionExpModNormal_ffv_221;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_222> AgradDistributionExpModNormal_ffv_222;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_223> AgradDistributionExpModNormal_ffv_223;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_224> AgradDistributionExpModNormal_ffv_224;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_225> AgradDistributionExpModNormal_ffv_225;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_226> AgradDistributionExpModNormal_ffv_226;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_227> AgradDistributionExpModNormal_ffv_227;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_228> AgradDistributionExpModNormal_ffv_228;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_229> AgradDistributionExpModNormal_ffv_229;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_230> AgradDistributionExpModNormal_ffv_230;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_231> AgradDistributionExpModNormal_ffv_231;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_232> AgradDistributionExpModNormal_ffv_232;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_233> AgradDistributionExpModNormal_ffv_233;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_234> AgradDistributionExpModNormal_ffv_234;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_235> AgradDistributionExpModNormal_ffv_235;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_236> AgradDistributionExpModNormal_ffv_236;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_237> AgradDistributionExpModNormal_ffv_237;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_238> AgradDistributionExpModNormal_ffv_238;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_239> AgradDistributionExpModNormal_ffv_239;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_240> AgradDistributionExpModNormal_ffv_240;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_241> AgradDistributionExpModNormal_ffv_241;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_242> AgradDistributionExpModNormal_ffv_242;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_243> AgradDistributionExpModNormal_ffv_243;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_244> AgradDistributionExpModNormal_ffv_244;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_245> AgradDistributionExpModNormal_ffv_245;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_246> AgradDistributionExpModNormal_ffv_246;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_247> AgradDistributionExpModNormal_ffv_247;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_248> AgradDistributionExpModNormal_ffv_248;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_249> AgradDistributionExpModNormal_ffv_249;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_250> AgradDistributionExpModNormal_ffv_250;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_251> AgradDistributionExpModNormal_ffv_251;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_252> AgradDistributionExpModNormal_ffv_252;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_253> AgradDistributionExpModNormal_ffv_253;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_254> AgradDistributionExpModNormal_ffv_254;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_255> AgradDistributionExpModNormal_ffv_255;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_256> AgradDistributionExpModNormal_ffv_256;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_257> AgradDistributionExpModNormal_ffv_257;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_258> AgradDistributionExpModNormal_ffv_258;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_259> AgradDistributionExpModNormal_ffv_259;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_260> AgradDistributionExpModNormal_ffv_260;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_261> AgradDistributionExpModNormal_ffv_261;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_262> AgradDistributionExpModNormal_ffv_262;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_263> AgradDistributionExpModNormal_ffv_263;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_264> AgradDistributionExpModNormal_ffv_264;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_265> AgradDistributionExpModNormal_ffv_265;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_266> AgradDistributionExpModNormal_ffv_266;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_267> AgradDistributionExpModNormal_ffv_267;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_268> AgradDistributionExpModNormal_ffv_268;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_269> AgradDistributionExpModNormal_ffv_269;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_270> AgradDistributionExpModNormal_ffv_270;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_271> AgradDistributionExpModNormal_ffv_271;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_272> AgradDistributionExpModNormal_ffv_272;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_273> AgradDistributionExpModNormal_ffv_273;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_274> AgradDistributionExpModNormal_ffv_274;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_275> AgradDistributionExpModNormal_ffv_275;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_276> AgradDistributionExpModNormal_ffv_276;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_277> AgradDistributionExpModNormal_ffv_277;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_278> AgradDistributionExpModNormal_ffv_278;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_279> AgradDistributionExpModNormal_ffv_279;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_280> AgradDistributionExpModNormal_ffv_280;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_281> AgradDistributionExpModNormal_ffv_281;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_282> AgradDistributionExpModNormal_ffv_282;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_283> AgradDistributionExpModNormal_ffv_283;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_284> AgradDistributionExpModNormal_ffv_284;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_285> AgradDistributionExpModNormal_ffv_285;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_286> AgradDistributionExpModNormal_ffv_286;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_287> AgradDistributionExpModNormal_ffv_287;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_288> AgradDistributionExpModNormal_ffv_288;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_289> AgradDistributionExpModNormal_ffv_289;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_290> AgradDistributionExpModNormal_ffv_290;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_291> AgradDistributionExpModNormal_ffv_291;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_292> AgradDistributionExpModNormal_ffv_292;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_293> AgradDistributionExpModNormal_ffv_293;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_294> AgradDistributionExpModNormal_ffv_294;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_295> AgradDistributionExpModNormal_ffv_295;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_296> AgradDistributionExpModNormal_ffv_296;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_297> AgradDistributionExpModNormal_ffv_297;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_298> AgradDistributionExpModNormal_ffv_298;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_299> AgradDistributionExpModNormal_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_200, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_201, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_202, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_203, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_204, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_205, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_206, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_207, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_208, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_209, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_210, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_211, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_212, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_213, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_214, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_215, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_216, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_217, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_218, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_219, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_220, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_221, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_222, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_223, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_224, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_225, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_226, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_227, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_228, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_229, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_230, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_231, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_232, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_233, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_234, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_235, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_236, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_237, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_238, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_239, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_240, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_241, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_242, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_243, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_244, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_245, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_246, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_247, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_248, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_249, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_250, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_251, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_252, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_253, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_254, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_255, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_256, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_257, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_258, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_259, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_260, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_261, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_262, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_263, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_264, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_265, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_266, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_267, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_268, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_269, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_270, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_271, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_272, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_273, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_274, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_275, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_276, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_277, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_278, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_279, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_280, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_281, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_282, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_283, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_284, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_285, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_286, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_287, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_288, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_289, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_290, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_291, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_292, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_293, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_294, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_295, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_296, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_297, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_298, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_299, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_299);
+
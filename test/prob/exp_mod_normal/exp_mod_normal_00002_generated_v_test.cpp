@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<double>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<double>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_200> AgradDistributionExpModNormal_v_200;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_201> AgradDistributionExpModNormal_v_201;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_202> AgradDistributionExpModNormal_v_202;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_203> AgradDistributionExpModNormal_v_203;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_204> AgradDistributionExpModNormal_v_204;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_205> AgradDistributionExpModNormal_v_205;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_206> AgradDistributionExpModNormal_v_206;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_207> AgradDistributionExpModNormal_v_207;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_208> AgradDistributionExpModNormal_v_208;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_209> AgradDistributionExpModNormal_v_209;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_210> AgradDistributionExpModNormal_v_210;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_211> AgradDistributionExpModNormal_v_211;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_212> AgradDistributionExpModNormal_v_212;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_213> AgradDistributionExpModNormal_v_213;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_214> AgradDistributionExpModNormal_v_214;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_215> AgradDistributionExpModNormal_v_215;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_216> AgradDistributionExpModNormal_v_216;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_217> AgradDistributionExpModNormal_v_217;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_218> AgradDistributionExpModNormal_v_218;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_219> AgradDistributionExpModNormal_v_219;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_220> AgradDistributionExpModNormal_v_220;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_221> AgradDistributionExpModNormal_v_221;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_222> AgradDistributionExpModNormal_v_222;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_223> AgradDistributionExpModNormal_v_223;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_224> AgradDistributionExpModNormal_v_224;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_225> AgradDistributionExpModNormal_v_225;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_226> AgradDistributionExpModNormal_v_226;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_227> AgradDistributionExpModNormal_v_227;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_228> AgradDistributionExpModNormal_v_228;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_229> AgradDistributionExpModNormal_v_229;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_230> AgradDistributionExpModNormal_v_230;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_231> AgradDistributionExpModNormal_v_231;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_232> AgradDistributionExpModNormal_v_232;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_233> AgradDistributionExpModNormal_v_233;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_234> AgradDistributionExpModNormal_v_234;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_235> AgradDistributionExpModNormal_v_235;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_236> AgradDistributionExpModNormal_v_236;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_237> AgradDistributionExpModNormal_v_237;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_238> AgradDistributionExpModNormal_v_238;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_239> AgradDistributionExpModNormal_v_239;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_240> AgradDistributionExpModNormal_v_240;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_241> AgradDistributionExpModNormal_v_241;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_242> AgradDistributionExpModNormal_v_242;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_243> AgradDistributionExpModNormal_v_243;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_244> AgradDistributionExpModNormal_v_244;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_245> AgradDistributionExpModNormal_v_245;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_246> AgradDistributionExpModNormal_v_246;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_247> AgradDistributionExpModNormal_v_247;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_248> AgradDistributionExpModNormal_v_248;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_249> AgradDistributionExpModNormal_v_249;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_250> AgradDistributionExpModNormal_v_250;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_251> AgradDistributionExpModNormal_v_251;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_252> AgradDistributionExpModNormal_v_252;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_253> AgradDistributionExpModNormal_v_253;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_254> AgradDistributionExpModNormal_v_254;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_255> AgradDistributionExpModNormal_v_255;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_256> AgradDistributionExpModNormal_v_256;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_257> AgradDistributionExpModNormal_v_257;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_258> AgradDistributionExpModNormal_v_258;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_259> AgradDistributionExpModNormal_v_259;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_260> AgradDistributionExpModNormal_v_260;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_261> AgradDistributionExpModNormal_v_261;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_262> AgradDistributionExpModNormal_v_262;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_263> AgradDistributionExpModNormal_v_263;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_264> AgradDistributionExpModNormal_v_264;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_265> AgradDistributionExpModNormal_v_265;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_266> AgradDistributionExpModNormal_v_266;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_267> AgradDistributionExpModNormal_v_267;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_268> AgradDistributionExpModNormal_v_268;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_269> AgradDistributionExpModNormal_v_269;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_270> AgradDistributionExpModNormal_v_270;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_271> AgradDistributionExpModNormal_v_271;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_272> AgradDistributionExpModNormal_v_272;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_273> AgradDistributionExpModNormal_v_273;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_274> AgradDistributionExpModNormal_v_274;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_275> AgradDistributionExpModNormal_v_275;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_276> AgradDistributionExpModNormal_v_276;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_277> AgradDistributionExpModNormal_v_277;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_278> AgradDistributionExpModNormal_v_278;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_279> AgradDistributionExpModNormal_v_279;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_280> AgradDistributionExpModNormal_v_280;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_281> AgradDistributionExpModNormal_v_281;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_282> AgradDistributionExpModNormal_v_282;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_283> AgradDistributionExpModNormal_v_283;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_284> AgradDistributionExpModNormal_v_284;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_285> AgradDistributionExpModNormal_v_285;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_286> AgradDistributionExpModNormal_v_286;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_287> AgradDistributionExpModNormal_v_287;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_288> AgradDistributionExpModNormal_v_288;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_289> AgradDistributionExpModNormal_v_289;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_290> AgradDistributionExpModNormal_v_290;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_291> AgradDistributionExpModNormal_v_291;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_292> AgradDistributionExpModNormal_v_292;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_293> AgradDistributionExpModNormal_v_293;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_294> AgradDistributionExpModNormal_v_294;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_295> AgradDistributionExpModNormal_v_295;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_296> AgradDistributionExpModNormal_v_296;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_297> AgradDistributionExpModNormal_v_297;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_298> AgradDistributionExpModNormal_v_298;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_299> AgradDistributionExpModNormal_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_200, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_201, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_202, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_203, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_204, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_205, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_206, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_207, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_208, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_209, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_210, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_211, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_212, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_213, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_214, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_215, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_216, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_217, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_218, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_219, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_220, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_221, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_222, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_223, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_224, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_225, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_226, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_227, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_228, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_229, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_230, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_231, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_232, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_233, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_234, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_235, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_236, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_237, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_238, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_239, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_240, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_241, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_242, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_243, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_244, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_245, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_246, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_247, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_248, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_249, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_250, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_251, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_252, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_253, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_254, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_255, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_256, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_257, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_258, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_259, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_260, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_261, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_262, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_263, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_264, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_265, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_266, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_267, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_268, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_269, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_270, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_271, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_272, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_273, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_274, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_275, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_276, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_277, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_278, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_279, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_280, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_281, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_282, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_283, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_284, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_285, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_286, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_287, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_288, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_289, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_290, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_291, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_292, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_293, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_294, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_295, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_296, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_297, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_298, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_299, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_299);
+
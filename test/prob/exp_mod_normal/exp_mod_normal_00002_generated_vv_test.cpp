@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<double>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<double>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<double>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_200> AgradDistributionExpModNormal_vv_200;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_201> AgradDistributionExpModNormal_vv_201;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_202> AgradDistributionExpModNormal_vv_202;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_203> AgradDistributionExpModNormal_vv_203;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_204> AgradDistributionExpModNormal_vv_204;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_205> AgradDistributionExpModNormal_vv_205;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_206> AgradDistributionExpModNormal_vv_206;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_207> AgradDistributionExpModNormal_vv_207;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_208> AgradDistributionExpModNormal_vv_208;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_209> AgradDistributionExpModNormal_vv_209;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_210> AgradDistributionExpModNormal_vv_210;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_211> AgradDistributionExpModNormal_vv_211;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_212> AgradDistributionExpModNormal_vv_212;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_213> AgradDistributionExpModNormal_vv_213;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_214> AgradDistributionExpModNormal_vv_214;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_215> AgradDistributionExpModNormal_vv_215;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_216> AgradDistributionExpModNormal_vv_216;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_217> AgradDistributionExpModNormal_vv_217;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_218> AgradDistributionExpModNormal_vv_218;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_219> AgradDistributionExpModNormal_vv_219;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_220> AgradDistributionExpModNormal_vv_220;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_221> AgradDistributionExpModNormal_vv_221;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_222> AgradDistributionExpModNormal_vv_222;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_223> AgradDistributionExpModNormal_vv_223;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_224> AgradDistributionExpModNormal_vv_224;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_225> AgradDistributionExpModNormal_vv_225;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_226> AgradDistributionExpModNormal_vv_226;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_227> AgradDistributionExpModNormal_vv_227;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_228> AgradDistributionExpModNormal_vv_228;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_229> AgradDistributionExpModNormal_vv_229;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_230> AgradDistributionExpModNormal_vv_230;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_231> AgradDistributionExpModNormal_vv_231;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_232> AgradDistributionExpModNormal_vv_232;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_233> AgradDistributionExpModNormal_vv_233;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_234> AgradDistributionExpModNormal_vv_234;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_235> AgradDistributionExpModNormal_vv_235;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_236> AgradDistributionExpModNormal_vv_236;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_237> AgradDistributionExpModNormal_vv_237;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_238> AgradDistributionExpModNormal_vv_238;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_239> AgradDistributionExpModNormal_vv_239;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_240> AgradDistributionExpModNormal_vv_240;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_241> AgradDistributionExpModNormal_vv_241;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_242> AgradDistributionExpModNormal_vv_242;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_243> AgradDistributionExpModNormal_vv_243;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_244> AgradDistributionExpModNormal_vv_244;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_245> AgradDistributionExpModNormal_vv_245;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_246> AgradDistributionExpModNormal_vv_246;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_247> AgradDistributionExpModNormal_vv_247;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_248> AgradDistributionExpModNormal_vv_248;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_249> AgradDistributionExpModNormal_vv_249;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_250> AgradDistributionExpModNormal_vv_250;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_251> AgradDistributionExpModNormal_vv_251;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_252> AgradDistributionExpModNormal_vv_252;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_253> AgradDistributionExpModNormal_vv_253;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_254> AgradDistributionExpModNormal_vv_254;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_255> AgradDistributionExpModNormal_vv_255;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_256> AgradDistributionExpModNormal_vv_256;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_257> AgradDistributionExpModNormal_vv_257;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_258> AgradDistributionExpModNormal_vv_258;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_259> AgradDistributionExpModNormal_vv_259;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_260> AgradDistributionExpModNormal_vv_260;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_261> AgradDistributionExpModNormal_vv_261;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_262> AgradDistributionExpModNormal_vv_262;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_263> AgradDistributionExpModNormal_vv_263;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_264> AgradDistributionExpModNormal_vv_264;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_265> AgradDistributionExpModNormal_vv_265;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_266> AgradDistributionExpModNormal_vv_266;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_267> AgradDistributionExpModNormal_vv_267;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_268> AgradDistributionExpModNormal_vv_268;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_269> AgradDistributionExpModNormal_vv_269;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_270> AgradDistributionExpModNormal_vv_270;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_271> AgradDistributionExpModNormal_vv_271;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_272> AgradDistributionExpModNormal_vv_272;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_273> AgradDistributionExpModNormal_vv_273;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_274> AgradDistributionExpModNormal_vv_274;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_275> AgradDistributionExpModNormal_vv_275;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_276> AgradDistributionExpModNormal_vv_276;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_277> AgradDistributionExpModNormal_vv_277;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_278> AgradDistributionExpModNormal_vv_278;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_279> AgradDistributionExpModNormal_vv_279;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_280> AgradDistributionExpModNormal_vv_280;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_281> AgradDistributionExpModNormal_vv_281;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_282> AgradDistributionExpModNormal_vv_282;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_283> AgradDistributionExpModNormal_vv_283;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_284> AgradDistributionExpModNormal_vv_284;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_285> AgradDistributionExpModNormal_vv_285;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_286> AgradDistributionExpModNormal_vv_286;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_287> AgradDistributionExpModNormal_vv_287;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_288> AgradDistributionExpModNormal_vv_288;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_289> AgradDistributionExpModNormal_vv_289;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_290> AgradDistributionExpModNormal_vv_290;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_291> AgradDistributionExpModNormal_vv_291;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_292> AgradDistributionExpModNormal_vv_292;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_293> AgradDistributionExpModNormal_vv_293;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_294> AgradDistributionExpModNormal_vv_294;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_295> AgradDistributionExpModNormal_vv_295;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_296> AgradDistributionExpModNormal_vv_296;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_297> AgradDistributionExpModNormal_vv_297;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_298> AgradDistributionExpModNormal_vv_298;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_299> AgradDistributionExpModNormal_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_200, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_201, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_202, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_203, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_204, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_205, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_206, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_207, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_208, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_209, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_210, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_211, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_212, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_213, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_214, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_215, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_216, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_217, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_218, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_219, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_220, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_221, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_222, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_223, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_224, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_225, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_226, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_227, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_228, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_229, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_230, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_231, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_232, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_233, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_234, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_235, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_236, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_237, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_238, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_239, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_240, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_241, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_242, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_243, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_244, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_245, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_246, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_247, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_248, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_249, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_250, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_251, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_252, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_253, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_254, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_255, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_256, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_257, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_258, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_259, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_260, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_261, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_262, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_263, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_264, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_265, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_266, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_267, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_268, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_269, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_270, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_271, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_272, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_273, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_274, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_275, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_276, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_277, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_278, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_279, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_280, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_281, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_282, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_283, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_284, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_285, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_286, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_287, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_288, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_289, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_290, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_291, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_292, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_293, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_294, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_295, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_296, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_297, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_298, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_299, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_299);
+
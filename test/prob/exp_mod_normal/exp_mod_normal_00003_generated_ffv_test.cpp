@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_300> AgradDistributionExpModNormal_ffv_300;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_301> AgradDistributionExpModNormal_ffv_301;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_302> AgradDistributionExpModNormal_ffv_302;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_303> AgradDistributionExpModNormal_ffv_303;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_304> AgradDistributionExpModNormal_ffv_304;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_305> AgradDistributionExpModNormal_ffv_305;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_306> AgradDistributionExpModNormal_ffv_306;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_307> AgradDistributionExpModNormal_ffv_307;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_308> AgradDistributionExpModNormal_ffv_308;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_309> AgradDistributionExpModNormal_ffv_309;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_310> AgradDistributionExpModNormal_ffv_310;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_311> AgradDistributionExpModNormal_ffv_311;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_312> AgradDistributionExpModNormal_ffv_312;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_313> AgradDistributionExpModNormal_ffv_313;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_314> AgradDistributionExpModNormal_ffv_314;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_315> AgradDistributionExpModNormal_ffv_315;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_316> AgradDistributionExpModNormal_ffv_316;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_317> AgradDistributionExpModNormal_ffv_317;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_318> AgradDistributionExpModNormal_ffv_318;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_319> AgradDistributionExpModNormal_ffv_319;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_320> AgradDistributionExpModNormal_ffv_320;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_321> AgradDistributionExpModNormal_ffv_321;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_322> AgradDistributionExpModNormal_ffv_322;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_323> AgradDistributionExpModNormal_ffv_323;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_324> AgradDistributionExpModNormal_ffv_324;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_325> AgradDistributionExpModNormal_ffv_325;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_326> AgradDistributionExpModNormal_ffv_326;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_327> AgradDistributionExpModNormal_ffv_327;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_328> AgradDistributionExpModNormal_ffv_328;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_329> AgradDistributionExpModNormal_ffv_329;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_330> AgradDistributionExpModNormal_ffv_330;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_331> AgradDistributionExpModNormal_ffv_331;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_332> AgradDistributionExpModNormal_ffv_332;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_333> AgradDistributionExpModNormal_ffv_333;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_334> AgradDistributionExpModNormal_ffv_334;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_335> AgradDistributionExpModNormal_ffv_335;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_336> AgradDistributionExpModNormal_ffv_336;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_337> AgradDistributionExpModNormal_ffv_337;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_338> AgradDistributionExpModNormal_ffv_338;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_339> AgradDistributionExpModNormal_ffv_339;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_340> AgradDistributionExpModNormal_ffv_340;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_341> AgradDistributionExpModNormal_ffv_341;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_342> AgradDistributionExpModNormal_ffv_342;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_343> AgradDistributionExpModNormal_ffv_343;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_344> AgradDistributionExpModNormal_ffv_344;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_345> AgradDistributionExpModNormal_ffv_345;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_346> AgradDistributionExpModNormal_ffv_346;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_347> AgradDistributionExpModNormal_ffv_347;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_348> AgradDistributionExpModNormal_ffv_348;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_349> AgradDistributionExpModNormal_ffv_349;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_350> AgradDistributionExpModNormal_ffv_350;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_351> AgradDistributionExpModNormal_ffv_351;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_352> AgradDistributionExpModNormal_ffv_352;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_353> AgradDistributionExpModNormal_ffv_353;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_354> AgradDistributionExpModNormal_ffv_354;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_355> AgradDistributionExpModNormal_ffv_355;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_356> AgradDistributionExpModNormal_ffv_356;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_357> AgradDistributionExpModNormal_ffv_357;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_358> AgradDistributionExpModNormal_ffv_358;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_359> AgradDistributionExpModNormal_ffv_359;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_360> AgradDistributionExpModNormal_ffv_360;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_361> AgradDistributionExpModNormal_ffv_361;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_362> AgradDistributionExpModNormal_ffv_362;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_363> AgradDistributionExpModNormal_ffv_363;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_364> AgradDistributionExpModNormal_ffv_364;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_365> AgradDistributionExpModNormal_ffv_365;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_366> AgradDistributionExpModNormal_ffv_366;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_367> AgradDistributionExpModNormal_ffv_367;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_368> AgradDistributionExpModNormal_ffv_368;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_369> AgradDistributionExpModNormal_ffv_369;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_370> AgradDistributionExpModNormal_ffv_370;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_371> AgradDistributionExpModNormal_ffv_371;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_372> AgradDistributionExpModNormal_ffv_372;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_373> AgradDistributionExpModNormal_ffv_373;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_374> AgradDistributionExpModNormal_ffv_374;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_375> AgradDistributionExpModNormal_ffv_375;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_376> AgradDistributionExpModNormal_ffv_376;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_377> AgradDistributionExpModNormal_ffv_377;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_378> AgradDistributionExpModNormal_ffv_378;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_379> AgradDistributionExpModNormal_ffv_379;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_380> AgradDistributionExpModNormal_ffv_380;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_381> AgradDistributionExpModNormal_ffv_381;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_382> AgradDistributionExpModNormal_ffv_382;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_383> AgradDistributionExpModNormal_ffv_383;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_384> AgradDistributionExpModNormal_ffv_384;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_385> AgradDistributionExpModNormal_ffv_385;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_386> AgradDistributionExpModNormal_ffv_386;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_387> AgradDistributionExpModNormal_ffv_387;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_388> AgradDistributionExpModNormal_ffv_388;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_389> AgradDistributionExpModNormal_ffv_389;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_390> AgradDistributionExpModNormal_ffv_390;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_391> AgradDistributionExpModNormal_ffv_391;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_392> AgradDistributionExpModNormal_ffv_392;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_393> AgradDistributionExpModNormal_ffv_393;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_394> AgradDistributionExpModNormal_ffv_394;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_395> AgradDistributionExpModNormal_ffv_395;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_396> AgradDistributionExpModNormal_ffv_396;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_397> AgradDistributionExpModNormal_ffv_397;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_398> AgradDistributionExpModNormal_ffv_398;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_399> AgradDistributionExpModNormal_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_300, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_301, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_302, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_303, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_304, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_305, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_306, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_307, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_308, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_309, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_310, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_311, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_312, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_313, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_314, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_315, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_316, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_317, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_318, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_319, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_320, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_321, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_322, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_323, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_324, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_325, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_326, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_327, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_328, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_329, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_330, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_331, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_332, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_333, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_334, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_335, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_336, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_337, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_338, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_339, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_340, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_341, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_342, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_343, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_344, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_345, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_346, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_347, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_348, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_349, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_350, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_351, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_352, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_353, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_354, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_355, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_356, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_357, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_358, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_359, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_360, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_361, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_362, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_363, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_364, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_365, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_366, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_367, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_368, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_369, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_370, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_371, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_372, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_373, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_374, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_375, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_376, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_377, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_378, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_379, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_380, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_381, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_382, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_383, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_384, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_385, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_386, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_387, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_388, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_389, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_390, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_391, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_392, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_393, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_394, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_395, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_396, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_397, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_398, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_399, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_399);
+
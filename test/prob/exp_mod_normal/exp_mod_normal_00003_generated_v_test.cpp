@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_300> AgradDistributionExpModNormal_v_300;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_301> AgradDistributionExpModNormal_v_301;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_302> AgradDistributionExpModNormal_v_302;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_303> AgradDistributionExpModNormal_v_303;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_304> AgradDistributionExpModNormal_v_304;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_305> AgradDistributionExpModNormal_v_305;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_306> AgradDistributionExpModNormal_v_306;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_307> AgradDistributionExpModNormal_v_307;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_308> AgradDistributionExpModNormal_v_308;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_309> AgradDistributionExpModNormal_v_309;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_310> AgradDistributionExpModNormal_v_310;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_311> AgradDistributionExpModNormal_v_311;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_312> AgradDistributionExpModNormal_v_312;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_313> AgradDistributionExpModNormal_v_313;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_314> AgradDistributionExpModNormal_v_314;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_315> AgradDistributionExpModNormal_v_315;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_316> AgradDistributionExpModNormal_v_316;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_317> AgradDistributionExpModNormal_v_317;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_318> AgradDistributionExpModNormal_v_318;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_319> AgradDistributionExpModNormal_v_319;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_320> AgradDistributionExpModNormal_v_320;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_321> AgradDistributionExpModNormal_v_321;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_322> AgradDistributionExpModNormal_v_322;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_323> AgradDistributionExpModNormal_v_323;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_324> AgradDistributionExpModNormal_v_324;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_325> AgradDistributionExpModNormal_v_325;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_326> AgradDistributionExpModNormal_v_326;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_327> AgradDistributionExpModNormal_v_327;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_328> AgradDistributionExpModNormal_v_328;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_329> AgradDistributionExpModNormal_v_329;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_330> AgradDistributionExpModNormal_v_330;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_331> AgradDistributionExpModNormal_v_331;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_332> AgradDistributionExpModNormal_v_332;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_333> AgradDistributionExpModNormal_v_333;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_334> AgradDistributionExpModNormal_v_334;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_335> AgradDistributionExpModNormal_v_335;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_336> AgradDistributionExpModNormal_v_336;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_337> AgradDistributionExpModNormal_v_337;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_338> AgradDistributionExpModNormal_v_338;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_339> AgradDistributionExpModNormal_v_339;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_340> AgradDistributionExpModNormal_v_340;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_341> AgradDistributionExpModNormal_v_341;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_342> AgradDistributionExpModNormal_v_342;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_343> AgradDistributionExpModNormal_v_343;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_344> AgradDistributionExpModNormal_v_344;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_345> AgradDistributionExpModNormal_v_345;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_346> AgradDistributionExpModNormal_v_346;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_347> AgradDistributionExpModNormal_v_347;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_348> AgradDistributionExpModNormal_v_348;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_349> AgradDistributionExpModNormal_v_349;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_350> AgradDistributionExpModNormal_v_350;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_351> AgradDistributionExpModNormal_v_351;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_352> AgradDistributionExpModNormal_v_352;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_353> AgradDistributionExpModNormal_v_353;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_354> AgradDistributionExpModNormal_v_354;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_355> AgradDistributionExpModNormal_v_355;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_356> AgradDistributionExpModNormal_v_356;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_357> AgradDistributionExpModNormal_v_357;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_358> AgradDistributionExpModNormal_v_358;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_359> AgradDistributionExpModNormal_v_359;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_360> AgradDistributionExpModNormal_v_360;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_361> AgradDistributionExpModNormal_v_361;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_362> AgradDistributionExpModNormal_v_362;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_363> AgradDistributionExpModNormal_v_363;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_364> AgradDistributionExpModNormal_v_364;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_365> AgradDistributionExpModNormal_v_365;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_366> AgradDistributionExpModNormal_v_366;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_367> AgradDistributionExpModNormal_v_367;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_368> AgradDistributionExpModNormal_v_368;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_369> AgradDistributionExpModNormal_v_369;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_370> AgradDistributionExpModNormal_v_370;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_371> AgradDistributionExpModNormal_v_371;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_372> AgradDistributionExpModNormal_v_372;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_373> AgradDistributionExpModNormal_v_373;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_374> AgradDistributionExpModNormal_v_374;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_375> AgradDistributionExpModNormal_v_375;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_376> AgradDistributionExpModNormal_v_376;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_377> AgradDistributionExpModNormal_v_377;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_378> AgradDistributionExpModNormal_v_378;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_379> AgradDistributionExpModNormal_v_379;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_380> AgradDistributionExpModNormal_v_380;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_381> AgradDistributionExpModNormal_v_381;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_382> AgradDistributionExpModNormal_v_382;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_383> AgradDistributionExpModNormal_v_383;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_384> AgradDistributionExpModNormal_v_384;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_385> AgradDistributionExpModNormal_v_385;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_386> AgradDistributionExpModNormal_v_386;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_387> AgradDistributionExpModNormal_v_387;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_388> AgradDistributionExpModNormal_v_388;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_389> AgradDistributionExpModNormal_v_389;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_390> AgradDistributionExpModNormal_v_390;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_391> AgradDistributionExpModNormal_v_391;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_392> AgradDistributionExpModNormal_v_392;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_393> AgradDistributionExpModNormal_v_393;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_394> AgradDistributionExpModNormal_v_394;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_395> AgradDistributionExpModNormal_v_395;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_396> AgradDistributionExpModNormal_v_396;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_397> AgradDistributionExpModNormal_v_397;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_398> AgradDistributionExpModNormal_v_398;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_399> AgradDistributionExpModNormal_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_300, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_301, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_302, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_303, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_304, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_305, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_306, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_307, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_308, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_309, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_310, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_311, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_312, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_313, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_314, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_315, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_316, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_317, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_318, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_319, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_320, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_321, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_322, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_323, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_324, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_325, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_326, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_327, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_328, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_329, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_330, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_331, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_332, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_333, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_334, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_335, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_336, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_337, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_338, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_339, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_340, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_341, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_342, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_343, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_344, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_345, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_346, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_347, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_348, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_349, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_350, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_351, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_352, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_353, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_354, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_355, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_356, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_357, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_358, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_359, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_360, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_361, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_362, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_363, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_364, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_365, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_366, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_367, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_368, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_369, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_370, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_371, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_372, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_373, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_374, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_375, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_376, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_377, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_378, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_379, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_380, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_381, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_382, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_383, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_384, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_385, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_386, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_387, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_388, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_389, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_390, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_391, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_392, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_393, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_394, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_395, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_396, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_397, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_398, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_399, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_399);
+
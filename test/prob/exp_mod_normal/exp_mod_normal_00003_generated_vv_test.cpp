@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_300> AgradDistributionExpModNormal_vv_300;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_301> AgradDistributionExpModNormal_vv_301;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_302> AgradDistributionExpModNormal_vv_302;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_303> AgradDistributionExpModNormal_vv_303;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_304> AgradDistributionExpModNormal_vv_304;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_305> AgradDistributionExpModNormal_vv_305;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_306> AgradDistributionExpModNormal_vv_306;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_307> AgradDistributionExpModNormal_vv_307;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_308> AgradDistributionExpModNormal_vv_308;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_309> AgradDistributionExpModNormal_vv_309;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_310> AgradDistributionExpModNormal_vv_310;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_311> AgradDistributionExpModNormal_vv_311;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_312> AgradDistributionExpModNormal_vv_312;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_313> AgradDistributionExpModNormal_vv_313;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_314> AgradDistributionExpModNormal_vv_314;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_315> AgradDistributionExpModNormal_vv_315;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_316> AgradDistributionExpModNormal_vv_316;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_317> AgradDistributionExpModNormal_vv_317;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_318> AgradDistributionExpModNormal_vv_318;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_319> AgradDistributionExpModNormal_vv_319;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_320> AgradDistributionExpModNormal_vv_320;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_321> AgradDistributionExpModNormal_vv_321;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_322> AgradDistributionExpModNormal_vv_322;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_323> AgradDistributionExpModNormal_vv_323;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_324> AgradDistributionExpModNormal_vv_324;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_325> AgradDistributionExpModNormal_vv_325;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_326> AgradDistributionExpModNormal_vv_326;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_327> AgradDistributionExpModNormal_vv_327;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_328> AgradDistributionExpModNormal_vv_328;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_329> AgradDistributionExpModNormal_vv_329;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_330> AgradDistributionExpModNormal_vv_330;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_331> AgradDistributionExpModNormal_vv_331;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_332> AgradDistributionExpModNormal_vv_332;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_333> AgradDistributionExpModNormal_vv_333;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_334> AgradDistributionExpModNormal_vv_334;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_335> AgradDistributionExpModNormal_vv_335;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_336> AgradDistributionExpModNormal_vv_336;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_337> AgradDistributionExpModNormal_vv_337;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_338> AgradDistributionExpModNormal_vv_338;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_339> AgradDistributionExpModNormal_vv_339;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_340> AgradDistributionExpModNormal_vv_340;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_341> AgradDistributionExpModNormal_vv_341;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_342> AgradDistributionExpModNormal_vv_342;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_343> AgradDistributionExpModNormal_vv_343;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_344> AgradDistributionExpModNormal_vv_344;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_345> AgradDistributionExpModNormal_vv_345;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_346> AgradDistributionExpModNormal_vv_346;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_347> AgradDistributionExpModNormal_vv_347;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_348> AgradDistributionExpModNormal_vv_348;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_349> AgradDistributionExpModNormal_vv_349;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_350> AgradDistributionExpModNormal_vv_350;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_351> AgradDistributionExpModNormal_vv_351;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_352> AgradDistributionExpModNormal_vv_352;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_353> AgradDistributionExpModNormal_vv_353;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_354> AgradDistributionExpModNormal_vv_354;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_355> AgradDistributionExpModNormal_vv_355;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_356> AgradDistributionExpModNormal_vv_356;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_357> AgradDistributionExpModNormal_vv_357;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_358> AgradDistributionExpModNormal_vv_358;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_359> AgradDistributionExpModNormal_vv_359;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_360> AgradDistributionExpModNormal_vv_360;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_361> AgradDistributionExpModNormal_vv_361;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_362> AgradDistributionExpModNormal_vv_362;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_363> AgradDistributionExpModNormal_vv_363;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_364> AgradDistributionExpModNormal_vv_364;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_365> AgradDistributionExpModNormal_vv_365;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_366> AgradDistributionExpModNormal_vv_366;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_367> AgradDistributionExpModNormal_vv_367;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_368> AgradDistributionExpModNormal_vv_368;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_369> AgradDistributionExpModNormal_vv_369;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_370> AgradDistributionExpModNormal_vv_370;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_371> AgradDistributionExpModNormal_vv_371;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_372> AgradDistributionExpModNormal_vv_372;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_373> AgradDistributionExpModNormal_vv_373;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_374> AgradDistributionExpModNormal_vv_374;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_375> AgradDistributionExpModNormal_vv_375;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_376> AgradDistributionExpModNormal_vv_376;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_377> AgradDistributionExpModNormal_vv_377;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_378> AgradDistributionExpModNormal_vv_378;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_379> AgradDistributionExpModNormal_vv_379;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_380> AgradDistributionExpModNormal_vv_380;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_381> AgradDistributionExpModNormal_vv_381;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_382> AgradDistributionExpModNormal_vv_382;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_383> AgradDistributionExpModNormal_vv_383;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_384> AgradDistributionExpModNormal_vv_384;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_385> AgradDistributionExpModNormal_vv_385;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_386> AgradDistributionExpModNormal_vv_386;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_387> AgradDistributionExpModNormal_vv_387;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_388> AgradDistributionExpModNormal_vv_388;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_389> AgradDistributionExpModNormal_vv_389;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_390> AgradDistributionExpModNormal_vv_390;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_391> AgradDistributionExpModNormal_vv_391;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_392> AgradDistributionExpModNormal_vv_392;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_393> AgradDistributionExpModNormal_vv_393;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_394> AgradDistributionExpModNormal_vv_394;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_395> AgradDistributionExpModNormal_vv_395;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_396> AgradDistributionExpModNormal_vv_396;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_397> AgradDistributionExpModNormal_vv_397;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_398> AgradDistributionExpModNormal_vv_398;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_399> AgradDistributionExpModNormal_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_300, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_301, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_302, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_303, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_304, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_305, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_306, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_307, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_308, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_309, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_310, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_311, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_312, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_313, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_314, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_315, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_316, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_317, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_318, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_319, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_320, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_321, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_322, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_323, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_324, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_325, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_326, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_327, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_328, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_329, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_330, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_331, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_332, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_333, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_334, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_335, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_336, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_337, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_338, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_339, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_340, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_341, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_342, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_343, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_344, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_345, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_346, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_347, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_348, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_349, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_350, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_351, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_352, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_353, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_354, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_355, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_356, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_357, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_358, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_359, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_360, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_361, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_362, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_363, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_364, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_365, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_366, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_367, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_368, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_369, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_370, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_371, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_372, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_373, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_374, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_375, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_376, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_377, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_378, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_379, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_380, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_381, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_382, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_383, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_384, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_385, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_386, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_387, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_388, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_389, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_390, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_391, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_392, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_393, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_394, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_395, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_396, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_397, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_398, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_399, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_399);
+
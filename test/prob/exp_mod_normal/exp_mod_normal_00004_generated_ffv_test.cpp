@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_400> AgradDistributionExpModNormal_ffv_400;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_401> AgradDistributionExpModNormal_ffv_401;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_402> AgradDistributionExpModNormal_ffv_402;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_403> AgradDistributionExpModNormal_ffv_403;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_404> AgradDistributionExpModNormal_ffv_404;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_405> AgradDistributionExpModNormal_ffv_405;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_406> AgradDistributionExpModNormal_ffv_406;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_407> AgradDistributionExpModNormal_ffv_407;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_408> AgradDistributionExpModNormal_ffv_408;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_409> AgradDistributionExpModNormal_ffv_409;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_410> AgradDistributionExpModNormal_ffv_410;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_411> AgradDistributionExpModNormal_ffv_411;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_412> AgradDistributionExpModNormal_ffv_412;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_413> AgradDistributionExpModNormal_ffv_413;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_414> AgradDistributionExpModNormal_ffv_414;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_415> AgradDistributionExpModNormal_ffv_415;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_416> AgradDistributionExpModNormal_ffv_416;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_417> AgradDistributionExpModNormal_ffv_417;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_418> AgradDistributionExpModNormal_ffv_418;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_419> AgradDistributionExpModNormal_ffv_419;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_420> AgradDistributionExpModNormal_ffv_420;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_421> AgradDistributionExpModNormal_ffv_421;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_422> AgradDistributionExpModNormal_ffv_422;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_423> AgradDistributionExpModNormal_ffv_423;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_424> AgradDistributionExpModNormal_ffv_424;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_425> AgradDistributionExpModNormal_ffv_425;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_426> AgradDistributionExpModNormal_ffv_426;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_427> AgradDistributionExpModNormal_ffv_427;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_428> AgradDistributionExpModNormal_ffv_428;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_429> AgradDistributionExpModNormal_ffv_429;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_430> AgradDistributionExpModNormal_ffv_430;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_431> AgradDistributionExpModNormal_ffv_431;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_432> AgradDistributionExpModNormal_ffv_432;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_433> AgradDistributionExpModNormal_ffv_433;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_434> AgradDistributionExpModNormal_ffv_434;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_435> AgradDistributionExpModNormal_ffv_435;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_436> AgradDistributionExpModNormal_ffv_436;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_437> AgradDistributionExpModNormal_ffv_437;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_438> AgradDistributionExpModNormal_ffv_438;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_439> AgradDistributionExpModNormal_ffv_439;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_440> AgradDistributionExpModNormal_ffv_440;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_441> AgradDistributionExpModNormal_ffv_441;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_442> AgradDistributionExpModNormal_ffv_442;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_443> AgradDistributionExpModNormal_ffv_443;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_444> AgradDistributionExpModNormal_ffv_444;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_445> AgradDistributionExpModNormal_ffv_445;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_446> AgradDistributionExpModNormal_ffv_446;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_447> AgradDistributionExpModNormal_ffv_447;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_448> AgradDistributionExpModNormal_ffv_448;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_449> AgradDistributionExpModNormal_ffv_449;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_450> AgradDistributionExpModNormal_ffv_450;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_451> AgradDistributionExpModNormal_ffv_451;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_452> AgradDistributionExpModNormal_ffv_452;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_453> AgradDistributionExpModNormal_ffv_453;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_454> AgradDistributionExpModNormal_ffv_454;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_455> AgradDistributionExpModNormal_ffv_455;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_456> AgradDistributionExpModNormal_ffv_456;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_457> AgradDistributionExpModNormal_ffv_457;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_458> AgradDistributionExpModNormal_ffv_458;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_459> AgradDistributionExpModNormal_ffv_459;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_460> AgradDistributionExpModNormal_ffv_460;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_461> AgradDistributionExpModNormal_ffv_461;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_462> AgradDistributionExpModNormal_ffv_462;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_463> AgradDistributionExpModNormal_ffv_463;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_464> AgradDistributionExpModNormal_ffv_464;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_465> AgradDistributionExpModNormal_ffv_465;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_466> AgradDistributionExpModNormal_ffv_466;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_467> AgradDistributionExpModNormal_ffv_467;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_468> AgradDistributionExpModNormal_ffv_468;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_469> AgradDistributionExpModNormal_ffv_469;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_470> AgradDistributionExpModNormal_ffv_470;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_471> AgradDistributionExpModNormal_ffv_471;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_472> AgradDistributionExpModNormal_ffv_472;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_473> AgradDistributionExpModNormal_ffv_473;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_474> AgradDistributionExpModNormal_ffv_474;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_475> AgradDistributionExpModNormal_ffv_475;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_476> AgradDistributionExpModNormal_ffv_476;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_477> AgradDistributionExpModNormal_ffv_477;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_478> AgradDistributionExpModNormal_ffv_478;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_479> AgradDistributionExpModNormal_ffv_479;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_480> AgradDistributionExpModNormal_ffv_480;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_481> AgradDistributionExpModNormal_ffv_481;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_482> AgradDistributionExpModNormal_ffv_482;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_483> AgradDistributionExpModNormal_ffv_483;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_484> AgradDistributionExpModNormal_ffv_484;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_485> AgradDistributionExpModNormal_ffv_485;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_486> AgradDistributionExpModNormal_ffv_486;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_487> AgradDistributionExpModNormal_ffv_487;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_488> AgradDistributionExpModNormal_ffv_488;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_489> AgradDistributionExpModNormal_ffv_489;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_490> AgradDistributionExpModNormal_ffv_490;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_491> AgradDistributionExpModNormal_ffv_491;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_492> AgradDistributionExpModNormal_ffv_492;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_493> AgradDistributionExpModNormal_ffv_493;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_494> AgradDistributionExpModNormal_ffv_494;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_495> AgradDistributionExpModNormal_ffv_495;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_496> AgradDistributionExpModNormal_ffv_496;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_497> AgradDistributionExpModNormal_ffv_497;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_498> AgradDistributionExpModNormal_ffv_498;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_499> AgradDistributionExpModNormal_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_400, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_401, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_402, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_403, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_404, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_405, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_406, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_407, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_408, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_409, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_410, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_411, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_412, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_413, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_414, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_415, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_416, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_417, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_418, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_419, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_420, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_421, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_422, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_423, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_424, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_425, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_426, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_427, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_428, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_429, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_430, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_431, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_432, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_433, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_434, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_435, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_436, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_437, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_438, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_439, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_440, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_441, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_442, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_443, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_444, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_445, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_446, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_447, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_448, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_449, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_450, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_451, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_452, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_453, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_454, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_455, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_456, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_457, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_458, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_459, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_460, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_461, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_462, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_463, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_464, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_465, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_466, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_467, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_468, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_469, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_470, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_471, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_472, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_473, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_474, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_475, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_476, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_477, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_478, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_479, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_480, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_481, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_482, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_483, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_484, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_485, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_486, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_487, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_488, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_489, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_490, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_491, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_492, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_493, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_494, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_495, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_496, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_497, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_498, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_499, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_499);
+
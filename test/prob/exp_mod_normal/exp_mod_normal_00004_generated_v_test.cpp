@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_400> AgradDistributionExpModNormal_v_400;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_401> AgradDistributionExpModNormal_v_401;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_402> AgradDistributionExpModNormal_v_402;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_403> AgradDistributionExpModNormal_v_403;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_404> AgradDistributionExpModNormal_v_404;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_405> AgradDistributionExpModNormal_v_405;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_406> AgradDistributionExpModNormal_v_406;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_407> AgradDistributionExpModNormal_v_407;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_408> AgradDistributionExpModNormal_v_408;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_409> AgradDistributionExpModNormal_v_409;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_410> AgradDistributionExpModNormal_v_410;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_411> AgradDistributionExpModNormal_v_411;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_412> AgradDistributionExpModNormal_v_412;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_413> AgradDistributionExpModNormal_v_413;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_414> AgradDistributionExpModNormal_v_414;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_415> AgradDistributionExpModNormal_v_415;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_416> AgradDistributionExpModNormal_v_416;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_417> AgradDistributionExpModNormal_v_417;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_418> AgradDistributionExpModNormal_v_418;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_419> AgradDistributionExpModNormal_v_419;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_420> AgradDistributionExpModNormal_v_420;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_421> AgradDistributionExpModNormal_v_421;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_422> AgradDistributionExpModNormal_v_422;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_423> AgradDistributionExpModNormal_v_423;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_424> AgradDistributionExpModNormal_v_424;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_425> AgradDistributionExpModNormal_v_425;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_426> AgradDistributionExpModNormal_v_426;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_427> AgradDistributionExpModNormal_v_427;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_428> AgradDistributionExpModNormal_v_428;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_429> AgradDistributionExpModNormal_v_429;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_430> AgradDistributionExpModNormal_v_430;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_431> AgradDistributionExpModNormal_v_431;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_432> AgradDistributionExpModNormal_v_432;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_433> AgradDistributionExpModNormal_v_433;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_434> AgradDistributionExpModNormal_v_434;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_435> AgradDistributionExpModNormal_v_435;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_436> AgradDistributionExpModNormal_v_436;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_437> AgradDistributionExpModNormal_v_437;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_438> AgradDistributionExpModNormal_v_438;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_439> AgradDistributionExpModNormal_v_439;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_440> AgradDistributionExpModNormal_v_440;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_441> AgradDistributionExpModNormal_v_441;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_442> AgradDistributionExpModNormal_v_442;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_443> AgradDistributionExpModNormal_v_443;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_444> AgradDistributionExpModNormal_v_444;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_445> AgradDistributionExpModNormal_v_445;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_446> AgradDistributionExpModNormal_v_446;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_447> AgradDistributionExpModNormal_v_447;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_448> AgradDistributionExpModNormal_v_448;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_449> AgradDistributionExpModNormal_v_449;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_450> AgradDistributionExpModNormal_v_450;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_451> AgradDistributionExpModNormal_v_451;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_452> AgradDistributionExpModNormal_v_452;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_453> AgradDistributionExpModNormal_v_453;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_454> AgradDistributionExpModNormal_v_454;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_455> AgradDistributionExpModNormal_v_455;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_456> AgradDistributionExpModNormal_v_456;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_457> AgradDistributionExpModNormal_v_457;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_458> AgradDistributionExpModNormal_v_458;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_459> AgradDistributionExpModNormal_v_459;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_460> AgradDistributionExpModNormal_v_460;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_461> AgradDistributionExpModNormal_v_461;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_462> AgradDistributionExpModNormal_v_462;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_463> AgradDistributionExpModNormal_v_463;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_464> AgradDistributionExpModNormal_v_464;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_465> AgradDistributionExpModNormal_v_465;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_466> AgradDistributionExpModNormal_v_466;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_467> AgradDistributionExpModNormal_v_467;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_468> AgradDistributionExpModNormal_v_468;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_469> AgradDistributionExpModNormal_v_469;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_470> AgradDistributionExpModNormal_v_470;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_471> AgradDistributionExpModNormal_v_471;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_472> AgradDistributionExpModNormal_v_472;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_473> AgradDistributionExpModNormal_v_473;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_474> AgradDistributionExpModNormal_v_474;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_475> AgradDistributionExpModNormal_v_475;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_476> AgradDistributionExpModNormal_v_476;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_477> AgradDistributionExpModNormal_v_477;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_478> AgradDistributionExpModNormal_v_478;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_479> AgradDistributionExpModNormal_v_479;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_480> AgradDistributionExpModNormal_v_480;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_481> AgradDistributionExpModNormal_v_481;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_482> AgradDistributionExpModNormal_v_482;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_483> AgradDistributionExpModNormal_v_483;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_484> AgradDistributionExpModNormal_v_484;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_485> AgradDistributionExpModNormal_v_485;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_486> AgradDistributionExpModNormal_v_486;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_487> AgradDistributionExpModNormal_v_487;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_488> AgradDistributionExpModNormal_v_488;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_489> AgradDistributionExpModNormal_v_489;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_490> AgradDistributionExpModNormal_v_490;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_491> AgradDistributionExpModNormal_v_491;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_492> AgradDistributionExpModNormal_v_492;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_493> AgradDistributionExpModNormal_v_493;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_494> AgradDistributionExpModNormal_v_494;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_495> AgradDistributionExpModNormal_v_495;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_496> AgradDistributionExpModNormal_v_496;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_497> AgradDistributionExpModNormal_v_497;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_498> AgradDistributionExpModNormal_v_498;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_499> AgradDistributionExpModNormal_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_400, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_401, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_402, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_403, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_404, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_405, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_406, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_407, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_408, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_409, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_410, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_411, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_412, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_413, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_414, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_415, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_416, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_417, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_418, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_419, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_420, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_421, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_422, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_423, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_424, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_425, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_426, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_427, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_428, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_429, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_430, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_431, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_432, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_433, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_434, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_435, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_436, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_437, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_438, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_439, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_440, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_441, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_442, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_443, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_444, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_445, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_446, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_447, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_448, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_449, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_450, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_451, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_452, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_453, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_454, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_455, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_456, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_457, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_458, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_459, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_460, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_461, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_462, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_463, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_464, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_465, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_466, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_467, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_468, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_469, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_470, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_471, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_472, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_473, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_474, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_475, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_476, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_477, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_478, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_479, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_480, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_481, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_482, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_483, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_484, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_485, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_486, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_487, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_488, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_489, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_490, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_491, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_492, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_493, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_494, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_495, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_496, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_497, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_498, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_499, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_499);
+
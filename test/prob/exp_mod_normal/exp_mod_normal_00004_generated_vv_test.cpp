@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_400> AgradDistributionExpModNormal_vv_400;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_401> AgradDistributionExpModNormal_vv_401;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_402> AgradDistributionExpModNormal_vv_402;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_403> AgradDistributionExpModNormal_vv_403;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_404> AgradDistributionExpModNormal_vv_404;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_405> AgradDistributionExpModNormal_vv_405;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_406> AgradDistributionExpModNormal_vv_406;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_407> AgradDistributionExpModNormal_vv_407;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_408> AgradDistributionExpModNormal_vv_408;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_409> AgradDistributionExpModNormal_vv_409;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_410> AgradDistributionExpModNormal_vv_410;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_411> AgradDistributionExpModNormal_vv_411;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_412> AgradDistributionExpModNormal_vv_412;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_413> AgradDistributionExpModNormal_vv_413;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_414> AgradDistributionExpModNormal_vv_414;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_415> AgradDistributionExpModNormal_vv_415;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_416> AgradDistributionExpModNormal_vv_416;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_417> AgradDistributionExpModNormal_vv_417;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_418> AgradDistributionExpModNormal_vv_418;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_419> AgradDistributionExpModNormal_vv_419;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_420> AgradDistributionExpModNormal_vv_420;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_421> AgradDistributionExpModNormal_vv_421;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_422> AgradDistributionExpModNormal_vv_422;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_423> AgradDistributionExpModNormal_vv_423;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_424> AgradDistributionExpModNormal_vv_424;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_425> AgradDistributionExpModNormal_vv_425;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_426> AgradDistributionExpModNormal_vv_426;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_427> AgradDistributionExpModNormal_vv_427;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_428> AgradDistributionExpModNormal_vv_428;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_429> AgradDistributionExpModNormal_vv_429;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_430> AgradDistributionExpModNormal_vv_430;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_431> AgradDistributionExpModNormal_vv_431;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_432> AgradDistributionExpModNormal_vv_432;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_433> AgradDistributionExpModNormal_vv_433;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_434> AgradDistributionExpModNormal_vv_434;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_435> AgradDistributionExpModNormal_vv_435;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_436> AgradDistributionExpModNormal_vv_436;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_437> AgradDistributionExpModNormal_vv_437;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_438> AgradDistributionExpModNormal_vv_438;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_439> AgradDistributionExpModNormal_vv_439;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_440> AgradDistributionExpModNormal_vv_440;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_441> AgradDistributionExpModNormal_vv_441;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_442> AgradDistributionExpModNormal_vv_442;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_443> AgradDistributionExpModNormal_vv_443;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_444> AgradDistributionExpModNormal_vv_444;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_445> AgradDistributionExpModNormal_vv_445;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_446> AgradDistributionExpModNormal_vv_446;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_447> AgradDistributionExpModNormal_vv_447;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_448> AgradDistributionExpModNormal_vv_448;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_449> AgradDistributionExpModNormal_vv_449;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_450> AgradDistributionExpModNormal_vv_450;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_451> AgradDistributionExpModNormal_vv_451;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_452> AgradDistributionExpModNormal_vv_452;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_453> AgradDistributionExpModNormal_vv_453;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_454> AgradDistributionExpModNormal_vv_454;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_455> AgradDistributionExpModNormal_vv_455;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_456> AgradDistributionExpModNormal_vv_456;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_457> AgradDistributionExpModNormal_vv_457;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_458> AgradDistributionExpModNormal_vv_458;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_459> AgradDistributionExpModNormal_vv_459;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_460> AgradDistributionExpModNormal_vv_460;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_461> AgradDistributionExpModNormal_vv_461;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_462> AgradDistributionExpModNormal_vv_462;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_463> AgradDistributionExpModNormal_vv_463;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_464> AgradDistributionExpModNormal_vv_464;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_465> AgradDistributionExpModNormal_vv_465;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_466> AgradDistributionExpModNormal_vv_466;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_467> AgradDistributionExpModNormal_vv_467;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_468> AgradDistributionExpModNormal_vv_468;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_469> AgradDistributionExpModNormal_vv_469;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_470> AgradDistributionExpModNormal_vv_470;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_471> AgradDistributionExpModNormal_vv_471;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_472> AgradDistributionExpModNormal_vv_472;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_473> AgradDistributionExpModNormal_vv_473;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_474> AgradDistributionExpModNormal_vv_474;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_475> AgradDistributionExpModNormal_vv_475;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_476> AgradDistributionExpModNormal_vv_476;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_477> AgradDistributionExpModNormal_vv_477;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_478> AgradDistributionExpModNormal_vv_478;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_479> AgradDistributionExpModNormal_vv_479;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_480> AgradDistributionExpModNormal_vv_480;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_481> AgradDistributionExpModNormal_vv_481;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_482> AgradDistributionExpModNormal_vv_482;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_483> AgradDistributionExpModNormal_vv_483;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_484> AgradDistributionExpModNormal_vv_484;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_485> AgradDistributionExpModNormal_vv_485;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_486> AgradDistributionExpModNormal_vv_486;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_487> AgradDistributionExpModNormal_vv_487;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_488> AgradDistributionExpModNormal_vv_488;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_489> AgradDistributionExpModNormal_vv_489;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_490> AgradDistributionExpModNormal_vv_490;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_491> AgradDistributionExpModNormal_vv_491;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_492> AgradDistributionExpModNormal_vv_492;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_493> AgradDistributionExpModNormal_vv_493;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_494> AgradDistributionExpModNormal_vv_494;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_495> AgradDistributionExpModNormal_vv_495;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_496> AgradDistributionExpModNormal_vv_496;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_497> AgradDistributionExpModNormal_vv_497;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_498> AgradDistributionExpModNormal_vv_498;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_499> AgradDistributionExpModNormal_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_400, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_401, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_402, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_403, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_404, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_405, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_406, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_407, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_408, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_409, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_410, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_411, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_412, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_413, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_414, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_415, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_416, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_417, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_418, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_419, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_420, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_421, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_422, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_423, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_424, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_425, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_426, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_427, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_428, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_429, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_430, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_431, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_432, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_433, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_434, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_435, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_436, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_437, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_438, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_439, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_440, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_441, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_442, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_443, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_444, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_445, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_446, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_447, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_448, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_449, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_450, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_451, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_452, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_453, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_454, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_455, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_456, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_457, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_458, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_459, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_460, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_461, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_462, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_463, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_464, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_465, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_466, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_467, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_468, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_469, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_470, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_471, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_472, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_473, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_474, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_475, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_476, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_477, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_478, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_479, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_480, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_481, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_482, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_483, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_484, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_485, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_486, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_487, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_488, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_489, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_490, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_491, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_492, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_493, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_494, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_495, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_496, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_497, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_498, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_499, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+typedef std::tuple<fvar<fvar<var> >, double, double, double, empty, empty> type_ffv_567;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<double>, empty, empty> type_ffv_568;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_569;
+typedef std::tuple<fvar<fvar<var> >, double, double, fvar<fvar<var> >, empty, empty> type_ffv_570;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_571;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_572;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, double, empty, empty> type_ffv_573;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_574;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_575;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_576;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_577;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_578;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_579;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_580;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_581;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_582;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_583;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_584;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty, empty> type_ffv_585;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_586;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_587;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_588;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_589;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_590;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_591;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_592;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_593;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_594;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_595;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_596;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_597;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_598;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_599;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_500> AgradDistributionExpModNormal_ffv_500;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_501> AgradDistributionExpModNormal_ffv_501;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_502> AgradDistributionExpModNormal_ffv_502;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_503> AgradDistributionExpModNormal_ffv_503;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_504> AgradDistributionExpModNormal_ffv_504;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_505> AgradDistributionExpModNormal_ffv_505;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_506> AgradDistributionExpModNormal_ffv_506;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_507> AgradDistributionExpModNormal_ffv_507;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_508> AgradDistributionExpModNormal_ffv_508;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_509> AgradDistributionExpModNormal_ffv_509;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_510> AgradDistributionExpModNormal_ffv_510;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_511> AgradDistributionExpModNormal_ffv_511;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_512> AgradDistributionExpModNormal_ffv_512;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_513> AgradDistributionExpModNormal_ffv_513;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_514> AgradDistributionExpModNormal_ffv_514;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_515> AgradDistributionExpModNormal_ffv_515;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_516> AgradDistributionExpModNormal_ffv_516;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_517> AgradDistributionExpModNormal_ffv_517;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_518> AgradDistributionExpModNormal_ffv_518;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_519> AgradDistributionExpModNormal_ffv_519;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_520> AgradDistributionExpModNormal_ffv_520;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_521> AgradDistributionExpModNormal_ffv_521;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_522> AgradDistributionExpModNormal_ffv_522;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_523> AgradDistributionExpModNormal_ffv_523;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_524> AgradDistributionExpModNormal_ffv_524;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_525> AgradDistributionExpModNormal_ffv_525;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_526> AgradDistributionExpModNormal_ffv_526;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_527> AgradDistributionExpModNormal_ffv_527;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_528> AgradDistributionExpModNormal_ffv_528;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_529> AgradDistributionExpModNormal_ffv_529;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_530> AgradDistributionExpModNormal_ffv_530;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_531> AgradDistributionExpModNormal_ffv_531;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_532> AgradDistributionExpModNormal_ffv_532;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_533> AgradDistributionExpModNormal_ffv_533;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_534> AgradDistributionExpModNormal_ffv_534;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_535> AgradDistributionExpModNormal_ffv_535;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_536> AgradDistributionExpModNormal_ffv_536;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_537> AgradDistributionExpModNormal_ffv_537;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_538> AgradDistributionExpModNormal_ffv_538;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_539> AgradDistributionExpModNormal_ffv_539;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_540> AgradDistributionExpModNormal_ffv_540;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_541> AgradDistributionExpModNormal_ffv_541;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_542> AgradDistributionExpModNormal_ffv_542;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_543> AgradDistributionExpModNormal_ffv_543;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_544> AgradDistributionExpModNormal_ffv_544;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_545> AgradDistributionExpModNormal_ffv_545;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_546> AgradDistributionExpModNormal_ffv_546;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_547> AgradDistributionExpModNormal_ffv_547;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_548> AgradDistributionExpModNormal_ffv_548;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_549> AgradDistributionExpModNormal_ffv_549;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_550> AgradDistributionExpModNormal_ffv_550;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_551> AgradDistributionExpModNormal_ffv_551;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_552> AgradDistributionExpModNormal_ffv_552;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_553> AgradDistributionExpModNormal_ffv_553;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_554> AgradDistributionExpModNormal_ffv_554;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_555> AgradDistributionExpModNormal_ffv_555;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_556> AgradDistributionExpModNormal_ffv_556;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_557> AgradDistributionExpModNormal_ffv_557;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_558> AgradDistributionExpModNormal_ffv_558;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_559> AgradDistributionExpModNormal_ffv_559;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_560> AgradDistributionExpModNormal_ffv_560;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_561> AgradDistributionExpModNormal_ffv_561;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_562> AgradDistributionExpModNormal_ffv_562;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_563> AgradDistributionExpModNormal_ffv_563;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_564> AgradDistributionExpModNormal_ffv_564;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_565> AgradDistributionExpModNormal_ffv_565;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_566> AgradDistributionExpModNormal_ffv_566;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_567> AgradDistributionExpModNormal_ffv_567;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_568> AgradDistributionExpModNormal_ffv_568;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_569> AgradDistributionExpModNormal_ffv_569;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_570> AgradDistributionExpModNormal_ffv_570;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_571> AgradDistributionExpModNormal_ffv_571;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_572> AgradDistributionExpModNormal_ffv_572;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_573> AgradDistributionExpModNormal_ffv_573;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_574> AgradDistributionExpModNormal_ffv_574;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_575> AgradDistributionExpModNormal_ffv_575;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_576> AgradDistributionExpModNormal_ffv_576;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_577> AgradDistributionExpModNormal_ffv_577;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_578> AgradDistributionExpModNormal_ffv_578;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_579> AgradDistributionExpModNormal_ffv_579;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_580> AgradDistributionExpModNormal_ffv_580;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_581> AgradDistributionExpModNormal_ffv_581;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_582> AgradDistributionExpModNormal_ffv_582;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_583> AgradDistributionExpModNormal_ffv_583;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_584> AgradDistributionExpModNormal_ffv_584;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_585> AgradDistributionExpModNormal_ffv_585;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_586> AgradDistributionExpModNormal_ffv_586;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_587> AgradDistributionExpModNormal_ffv_587;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_588> AgradDistributionExpModNormal_ffv_588;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_589> AgradDistributionExpModNormal_ffv_589;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_590> AgradDistributionExpModNormal_ffv_590;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_591> AgradDistributionExpModNormal_ffv_591;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_592> AgradDistributionExpModNormal_ffv_592;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_593> AgradDistributionExpModNormal_ffv_593;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_594> AgradDistributionExpModNormal_ffv_594;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_595> AgradDistributionExpModNormal_ffv_595;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_596> AgradDistributionExpModNormal_ffv_596;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_597> AgradDistributionExpModNormal_ffv_597;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_598> AgradDistributionExpModNormal_ffv_598;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_599> AgradDistributionExpModNormal_ffv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_500, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_501, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_502, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_503, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_504, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_505, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_506, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_507, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_508, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_509, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_510, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_511, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_512, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_513, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_514, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_515, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_516, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_517, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_518, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_519, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_520, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_521, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_522, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_523, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_524, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_525, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_526, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_527, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_528, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_529, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_530, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_531, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_532, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_533, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_534, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_535, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_536, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_537, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_538, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_539, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_540, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_541, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_542, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_543, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_544, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_545, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_546, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_547, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_548, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_549, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_550, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_551, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_552, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_553, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_554, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_555, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_556, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_557, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_558, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_559, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_560, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_561, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_562, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_563, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_564, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_565, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_566, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_567, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_568, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_569, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_570, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_571, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_572, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_573, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_574, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_575, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_576, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_577, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_578, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_579, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_580, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_581, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_582, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_583, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_584, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_585, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_586, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_587, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_588, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_589, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_590, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_591, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_592, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_593, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_594, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_595, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_596, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_597, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_598, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_599, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_599);
+
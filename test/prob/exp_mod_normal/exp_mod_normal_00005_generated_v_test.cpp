@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_500> AgradDistributionExpModNormal_v_500;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_501> AgradDistributionExpModNormal_v_501;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_502> AgradDistributionExpModNormal_v_502;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_503> AgradDistributionExpModNormal_v_503;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_504> AgradDistributionExpModNormal_v_504;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_505> AgradDistributionExpModNormal_v_505;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_506> AgradDistributionExpModNormal_v_506;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_507> AgradDistributionExpModNormal_v_507;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_508> AgradDistributionExpModNormal_v_508;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_509> AgradDistributionExpModNormal_v_509;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_510> AgradDistributionExpModNormal_v_510;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_511> AgradDistributionExpModNormal_v_511;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_512> AgradDistributionExpModNormal_v_512;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_513> AgradDistributionExpModNormal_v_513;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_514> AgradDistributionExpModNormal_v_514;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_515> AgradDistributionExpModNormal_v_515;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_516> AgradDistributionExpModNormal_v_516;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_517> AgradDistributionExpModNormal_v_517;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_518> AgradDistributionExpModNormal_v_518;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_519> AgradDistributionExpModNormal_v_519;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_520> AgradDistributionExpModNormal_v_520;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_521> AgradDistributionExpModNormal_v_521;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_522> AgradDistributionExpModNormal_v_522;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_523> AgradDistributionExpModNormal_v_523;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_524> AgradDistributionExpModNormal_v_524;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_525> AgradDistributionExpModNormal_v_525;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_526> AgradDistributionExpModNormal_v_526;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_527> AgradDistributionExpModNormal_v_527;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_528> AgradDistributionExpModNormal_v_528;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_529> AgradDistributionExpModNormal_v_529;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_530> AgradDistributionExpModNormal_v_530;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_531> AgradDistributionExpModNormal_v_531;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_532> AgradDistributionExpModNormal_v_532;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_533> AgradDistributionExpModNormal_v_533;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_534> AgradDistributionExpModNormal_v_534;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_535> AgradDistributionExpModNormal_v_535;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_536> AgradDistributionExpModNormal_v_536;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_537> AgradDistributionExpModNormal_v_537;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_538> AgradDistributionExpModNormal_v_538;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_539> AgradDistributionExpModNormal_v_539;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_540> AgradDistributionExpModNormal_v_540;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_541> AgradDistributionExpModNormal_v_541;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_542> AgradDistributionExpModNormal_v_542;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_543> AgradDistributionExpModNormal_v_543;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_544> AgradDistributionExpModNormal_v_544;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_545> AgradDistributionExpModNormal_v_545;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_546> AgradDistributionExpModNormal_v_546;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_547> AgradDistributionExpModNormal_v_547;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_548> AgradDistributionExpModNormal_v_548;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_549> AgradDistributionExpModNormal_v_549;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_550> AgradDistributionExpModNormal_v_550;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_551> AgradDistributionExpModNormal_v_551;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_552> AgradDistributionExpModNormal_v_552;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_553> AgradDistributionExpModNormal_v_553;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_554> AgradDistributionExpModNormal_v_554;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_555> AgradDistributionExpModNormal_v_555;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_556> AgradDistributionExpModNormal_v_556;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_557> AgradDistributionExpModNormal_v_557;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_558> AgradDistributionExpModNormal_v_558;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_559> AgradDistributionExpModNormal_v_559;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_560> AgradDistributionExpModNormal_v_560;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_561> AgradDistributionExpModNormal_v_561;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_562> AgradDistributionExpModNormal_v_562;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_563> AgradDistributionExpModNormal_v_563;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_564> AgradDistributionExpModNormal_v_564;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_565> AgradDistributionExpModNormal_v_565;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_566> AgradDistributionExpModNormal_v_566;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_567> AgradDistributionExpModNormal_v_567;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_568> AgradDistributionExpModNormal_v_568;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_569> AgradDistributionExpModNormal_v_569;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_570> AgradDistributionExpModNormal_v_570;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_571> AgradDistributionExpModNormal_v_571;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_572> AgradDistributionExpModNormal_v_572;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_573> AgradDistributionExpModNormal_v_573;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_574> AgradDistributionExpModNormal_v_574;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_575> AgradDistributionExpModNormal_v_575;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_576> AgradDistributionExpModNormal_v_576;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_577> AgradDistributionExpModNormal_v_577;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_578> AgradDistributionExpModNormal_v_578;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_579> AgradDistributionExpModNormal_v_579;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_580> AgradDistributionExpModNormal_v_580;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_581> AgradDistributionExpModNormal_v_581;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_582> AgradDistributionExpModNormal_v_582;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_583> AgradDistributionExpModNormal_v_583;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_584> AgradDistributionExpModNormal_v_584;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_585> AgradDistributionExpModNormal_v_585;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_586> AgradDistributionExpModNormal_v_586;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_587> AgradDistributionExpModNormal_v_587;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_588> AgradDistributionExpModNormal_v_588;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_589> AgradDistributionExpModNormal_v_589;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_590> AgradDistributionExpModNormal_v_590;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_591> AgradDistributionExpModNormal_v_591;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_592> AgradDistributionExpModNormal_v_592;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_593> AgradDistributionExpModNormal_v_593;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_594> AgradDistributionExpModNormal_v_594;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_595> AgradDistributionExpModNormal_v_595;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_596> AgradDistributionExpModNormal_v_596;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_597> AgradDistributionExpModNormal_v_597;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_598> AgradDistributionExpModNormal_v_598;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_599> AgradDistributionExpModNormal_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_500, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_501, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_502, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_503, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_504, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_505, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_506, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_507, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_508, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_509, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_510, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_511, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_512, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_513, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_514, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_515, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_516, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_517, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_518, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_519, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_520, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_521, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_522, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_523, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_524, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_525, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_526, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_527, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_528, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_529, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_530, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_531, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_532, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_533, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_534, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_535, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_536, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_537, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_538, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_539, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_540, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_541, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_542, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_543, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_544, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_545, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_546, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_547, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_548, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_549, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_550, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_551, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_552, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_553, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_554, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_555, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_556, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_557, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_558, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_559, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_560, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_561, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_562, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_563, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_564, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_565, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_566, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_567, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_568, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_569, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_570, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_571, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_572, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_573, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_574, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_575, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_576, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_577, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_578, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_579, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_580, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_581, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_582, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_583, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_584, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_585, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_586, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_587, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_588, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_589, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_590, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_591, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_592, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_593, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_594, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_595, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_596, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_597, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_598, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_599, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_599);
+
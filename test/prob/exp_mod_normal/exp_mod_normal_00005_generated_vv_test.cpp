@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+typedef std::tuple<var, double, double, double, empty, empty> type_vv_567;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_vv_568;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_569;
+typedef std::tuple<var, double, double, var, empty, empty> type_vv_570;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_vv_571;
+typedef std::tuple<var, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_572;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_vv_573;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_574;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_575;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_vv_576;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_577;
+typedef std::tuple<var, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_578;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_579;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_580;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_581;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_582;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_583;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_584;
+typedef std::tuple<var, double, var, double, empty, empty> type_vv_585;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_vv_586;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_587;
+typedef std::tuple<var, double, var, var, empty, empty> type_vv_588;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_vv_589;
+typedef std::tuple<var, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_590;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_vv_591;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_592;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_593;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_vv_594;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_595;
+typedef std::tuple<var, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_596;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_597;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_598;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_599;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_500> AgradDistributionExpModNormal_vv_500;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_501> AgradDistributionExpModNormal_vv_501;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_502> AgradDistributionExpModNormal_vv_502;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_503> AgradDistributionExpModNormal_vv_503;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_504> AgradDistributionExpModNormal_vv_504;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_505> AgradDistributionExpModNormal_vv_505;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_506> AgradDistributionExpModNormal_vv_506;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_507> AgradDistributionExpModNormal_vv_507;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_508> AgradDistributionExpModNormal_vv_508;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_509> AgradDistributionExpModNormal_vv_509;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_510> AgradDistributionExpModNormal_vv_510;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_511> AgradDistributionExpModNormal_vv_511;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_512> AgradDistributionExpModNormal_vv_512;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_513> AgradDistributionExpModNormal_vv_513;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_514> AgradDistributionExpModNormal_vv_514;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_515> AgradDistributionExpModNormal_vv_515;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_516> AgradDistributionExpModNormal_vv_516;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_517> AgradDistributionExpModNormal_vv_517;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_518> AgradDistributionExpModNormal_vv_518;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_519> AgradDistributionExpModNormal_vv_519;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_520> AgradDistributionExpModNormal_vv_520;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_521> AgradDistributionExpModNormal_vv_521;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_522> AgradDistributionExpModNormal_vv_522;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_523> AgradDistributionExpModNormal_vv_523;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_524> AgradDistributionExpModNormal_vv_524;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_525> AgradDistributionExpModNormal_vv_525;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_526> AgradDistributionExpModNormal_vv_526;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_527> AgradDistributionExpModNormal_vv_527;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_528> AgradDistributionExpModNormal_vv_528;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_529> AgradDistributionExpModNormal_vv_529;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_530> AgradDistributionExpModNormal_vv_530;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_531> AgradDistributionExpModNormal_vv_531;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_532> AgradDistributionExpModNormal_vv_532;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_533> AgradDistributionExpModNormal_vv_533;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_534> AgradDistributionExpModNormal_vv_534;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_535> AgradDistributionExpModNormal_vv_535;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_536> AgradDistributionExpModNormal_vv_536;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_537> AgradDistributionExpModNormal_vv_537;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_538> AgradDistributionExpModNormal_vv_538;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_539> AgradDistributionExpModNormal_vv_539;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_540> AgradDistributionExpModNormal_vv_540;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_541> AgradDistributionExpModNormal_vv_541;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_542> AgradDistributionExpModNormal_vv_542;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_543> AgradDistributionExpModNormal_vv_543;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_544> AgradDistributionExpModNormal_vv_544;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_545> AgradDistributionExpModNormal_vv_545;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_546> AgradDistributionExpModNormal_vv_546;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_547> AgradDistributionExpModNormal_vv_547;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_548> AgradDistributionExpModNormal_vv_548;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_549> AgradDistributionExpModNormal_vv_549;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_550> AgradDistributionExpModNormal_vv_550;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_551> AgradDistributionExpModNormal_vv_551;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_552> AgradDistributionExpModNormal_vv_552;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_553> AgradDistributionExpModNormal_vv_553;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_554> AgradDistributionExpModNormal_vv_554;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_555> AgradDistributionExpModNormal_vv_555;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_556> AgradDistributionExpModNormal_vv_556;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_557> AgradDistributionExpModNormal_vv_557;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_558> AgradDistributionExpModNormal_vv_558;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_559> AgradDistributionExpModNormal_vv_559;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_560> AgradDistributionExpModNormal_vv_560;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_561> AgradDistributionExpModNormal_vv_561;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_562> AgradDistributionExpModNormal_vv_562;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_563> AgradDistributionExpModNormal_vv_563;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_564> AgradDistributionExpModNormal_vv_564;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_565> AgradDistributionExpModNormal_vv_565;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_566> AgradDistributionExpModNormal_vv_566;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_567> AgradDistributionExpModNormal_vv_567;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_568> AgradDistributionExpModNormal_vv_568;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_569> AgradDistributionExpModNormal_vv_569;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_570> AgradDistributionExpModNormal_vv_570;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_571> AgradDistributionExpModNormal_vv_571;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_572> AgradDistributionExpModNormal_vv_572;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_573> AgradDistributionExpModNormal_vv_573;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_574> AgradDistributionExpModNormal_vv_574;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_575> AgradDistributionExpModNormal_vv_575;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_576> AgradDistributionExpModNormal_vv_576;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_577> AgradDistributionExpModNormal_vv_577;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_578> AgradDistributionExpModNormal_vv_578;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_579> AgradDistributionExpModNormal_vv_579;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_580> AgradDistributionExpModNormal_vv_580;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_581> AgradDistributionExpModNormal_vv_581;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_582> AgradDistributionExpModNormal_vv_582;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_583> AgradDistributionExpModNormal_vv_583;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_584> AgradDistributionExpModNormal_vv_584;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_585> AgradDistributionExpModNormal_vv_585;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_586> AgradDistributionExpModNormal_vv_586;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_587> AgradDistributionExpModNormal_vv_587;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_588> AgradDistributionExpModNormal_vv_588;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_589> AgradDistributionExpModNormal_vv_589;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_590> AgradDistributionExpModNormal_vv_590;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_591> AgradDistributionExpModNormal_vv_591;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_592> AgradDistributionExpModNormal_vv_592;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_593> AgradDistributionExpModNormal_vv_593;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_594> AgradDistributionExpModNormal_vv_594;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_595> AgradDistributionExpModNormal_vv_595;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_596> AgradDistributionExpModNormal_vv_596;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_597> AgradDistributionExpModNormal_vv_597;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_598> AgradDistributionExpModNormal_vv_598;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_599> AgradDistributionExpModNormal_vv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_500, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_501, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_502, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_503, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_504, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_505, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_506, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_507, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_508, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_509, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_510, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_511, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_512, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_513, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_514, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_515, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_516, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_517, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_518, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_519, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_520, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_521, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_522, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_523, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_524, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_525, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_526, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_527, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_528, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_529, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_530, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_531, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_532, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_533, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_534, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_535, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_536, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_537, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_538, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_539, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_540, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_541, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_542, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_543, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_544, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_545, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_546, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_547, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_548, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_549, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_550, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_551, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_552, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_553, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_554, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_555, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_556, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_557, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_558, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_559, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_560, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_561, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_562, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_563, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_564, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_565, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_566, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_567, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_568, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_569, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_570, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_571, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_572, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_573, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_574, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_575, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_576, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_577, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_578, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_579, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_580, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_581, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_582, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_583, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_584, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_585, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_586, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_587, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_588, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_589, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_590, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_591, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_592, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_593, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_594, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_595, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_596, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_597, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_598, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_599, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_600;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_601;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_602;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, double, empty, empty> type_ffv_603;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_604;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_605;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_606;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_607;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_608;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_609;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_610;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_611;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_612;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_613;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_614;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_615;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_616;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_617;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_618;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_619;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_620;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_621;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_622;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_623;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_624;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_625;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_626;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_627;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_628;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_629;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_630;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_631;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_632;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_633;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_634;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_635;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_636;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_637;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_638;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_639;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_640;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_641;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_642;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_643;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_644;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_645;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_646;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_647;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_648;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_649;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_650;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_651;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_652;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_653;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_654;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_655;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_656;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_657;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_658;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_659;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_660;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_661;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_662;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_663;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_664;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_665;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_666;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_667;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_668;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_669;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_670;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_671;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_672;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_673;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_674;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, double, empty, empty> type_ffv_675;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_676;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_677;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_678;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_679;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_680;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_681;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_682;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_683;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_684;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_685;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_686;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_687;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_688;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_689;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_690;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_691;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_692;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_693;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_694;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_695;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_696;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_697;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_698;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_699;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_600> AgradDistributionExpModNormal_ffv_600;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_601> AgradDistributionExpModNormal_ffv_601;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_602> AgradDistributionExpModNormal_ffv_602;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_603> AgradDistributionExpModNormal_ffv_603;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_604> AgradDistributionExpModNormal_ffv_604;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_605> AgradDistributionExpModNormal_ffv_605;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_606> AgradDistributionExpModNormal_ffv_606;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_607> AgradDistributionExpModNormal_ffv_607;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_608> AgradDistributionExpModNormal_ffv_608;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_609> AgradDistributionExpModNormal_ffv_609;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_610> AgradDistributionExpModNormal_ffv_610;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_611> AgradDistributionExpModNormal_ffv_611;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_612> AgradDistributionExpModNormal_ffv_612;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_613> AgradDistributionExpModNormal_ffv_613;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_614> AgradDistributionExpModNormal_ffv_614;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_615> AgradDistributionExpModNormal_ffv_615;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_616> AgradDistributionExpModNormal_ffv_616;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_617> AgradDistributionExpModNormal_ffv_617;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_618> AgradDistributionExpModNormal_ffv_618;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_619> AgradDistributionExpModNormal_ffv_619;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_620> AgradDistributionExpModNormal_ffv_620;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_621> AgradDistributionExpModNormal_ffv_621;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_622> AgradDistributionExpModNormal_ffv_622;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_623> AgradDistributionExpModNormal_ffv_623;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_624> AgradDistributionExpModNormal_ffv_624;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_625> AgradDistributionExpModNormal_ffv_625;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_626> AgradDistributionExpModNormal_ffv_626;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_627> AgradDistributionExpModNormal_ffv_627;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_628> AgradDistributionExpModNormal_ffv_628;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_629> AgradDistributionExpModNormal_ffv_629;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_630> AgradDistributionExpModNormal_ffv_630;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_631> AgradDistributionExpModNormal_ffv_631;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_632> AgradDistributionExpModNormal_ffv_632;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_633> AgradDistributionExpModNormal_ffv_633;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_634> AgradDistributionExpModNormal_ffv_634;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_635> AgradDistributionExpModNormal_ffv_635;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_636> AgradDistributionExpModNormal_ffv_636;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_637> AgradDistributionExpModNormal_ffv_637;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_638> AgradDistributionExpModNormal_ffv_638;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_639> AgradDistributionExpModNormal_ffv_639;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_640> AgradDistributionExpModNormal_ffv_640;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_641> AgradDistributionExpModNormal_ffv_641;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_642> AgradDistributionExpModNormal_ffv_642;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_643> AgradDistributionExpModNormal_ffv_643;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_644> AgradDistributionExpModNormal_ffv_644;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_645> AgradDistributionExpModNormal_ffv_645;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_646> AgradDistributionExpModNormal_ffv_646;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_647> AgradDistributionExpModNormal_ffv_647;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_648> AgradDistributionExpModNormal_ffv_648;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_649> AgradDistributionExpModNormal_ffv_649;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_650> AgradDistributionExpModNormal_ffv_650;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_651> AgradDistributionExpModNormal_ffv_651;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_652> AgradDistributionExpModNormal_ffv_652;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_653> AgradDistributionExpModNormal_ffv_653;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_654> AgradDistributionExpModNormal_ffv_654;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_655> AgradDistributionExpModNormal_ffv_655;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_656> AgradDistributionExpModNormal_ffv_656;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_657> AgradDistributionExpModNormal_ffv_657;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_658> AgradDistributionExpModNormal_ffv_658;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_659> AgradDistributionExpModNormal_ffv_659;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_660> AgradDistributionExpModNormal_ffv_660;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_661> AgradDistributionExpModNormal_ffv_661;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_662> AgradDistributionExpModNormal_ffv_662;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_663> AgradDistributionExpModNormal_ffv_663;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_664> AgradDistributionExpModNormal_ffv_664;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_665> AgradDistributionExpModNormal_ffv_665;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_666> AgradDistributionExpModNormal_ffv_666;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_667> AgradDistributionExpModNormal_ffv_667;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_668> AgradDistributionExpModNormal_ffv_668;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_669> AgradDistributionExpModNormal_ffv_669;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_670> AgradDistributionExpModNormal_ffv_670;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_671> AgradDistributionExpModNormal_ffv_671;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_672> AgradDistributionExpModNormal_ffv_672;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_673> AgradDistributionExpModNormal_ffv_673;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_674> AgradDistributionExpModNormal_ffv_674;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_675> AgradDistributionExpModNormal_ffv_675;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_676> AgradDistributionExpModNormal_ffv_676;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_677> AgradDistributionExpModNormal_ffv_677;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_678> AgradDistributionExpModNormal_ffv_678;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_679> AgradDistributionExpModNormal_ffv_679;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_680> AgradDistributionExpModNormal_ffv_680;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_681> AgradDistributionExpModNormal_ffv_681;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_682> AgradDistributionExpModNormal_ffv_682;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_683> AgradDistributionExpModNormal_ffv_683;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_684> AgradDistributionExpModNormal_ffv_684;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_685> AgradDistributionExpModNormal_ffv_685;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_686> AgradDistributionExpModNormal_ffv_686;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_687> AgradDistributionExpModNormal_ffv_687;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_688> AgradDistributionExpModNormal_ffv_688;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_689> AgradDistributionExpModNormal_ffv_689;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_690> AgradDistributionExpModNormal_ffv_690;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_691> AgradDistributionExpModNormal_ffv_691;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_692> AgradDistributionExpModNormal_ffv_692;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_693> AgradDistributionExpModNormal_ffv_693;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_694> AgradDistributionExpModNormal_ffv_694;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_695> AgradDistributionExpModNormal_ffv_695;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_696> AgradDistributionExpModNormal_ffv_696;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_697> AgradDistributionExpModNormal_ffv_697;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_698> AgradDistributionExpModNormal_ffv_698;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_699> AgradDistributionExpModNormal_ffv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_600, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_601, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_602, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_603, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_604, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_605, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_606, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_607, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_608, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_609, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_610, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_611, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_612, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_613, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_614, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_615, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_616, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_617, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_618, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_619, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_620, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_621, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_622, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_623, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_624, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_625, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_626, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_627, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_628, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_629, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_630, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_631, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_632, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_633, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_634, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_635, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_636, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_637, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_638, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_639, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_640, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_641, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_642, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_643, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_644, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_645, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_646, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_647, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_648, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_649, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_650, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_651, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_652, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_653, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_654, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_655, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_656, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_657, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_658, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_659, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_660, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_661, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_662, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_663, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_664, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_665, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_666, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_667, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_668, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_669, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_670, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_671, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_672, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_673, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_674, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_675, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_676, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_677, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_678, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_679, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_680, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_681, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_682, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_683, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_684, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_685, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_686, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_687, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_688, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_689, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_690, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_691, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_692, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_693, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_694, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_695, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_696, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_697, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_698, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_699, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+typedef std::tuple<var, double, double, double, empty, empty> type_v_648;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_v_649;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_650;
+typedef std::tuple<var, double, double, var, empty, empty> type_v_651;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_v_652;
+typedef std::tuple<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_653;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_v_654;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_v_655;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_656;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_v_657;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_v_658;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_659;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_660;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_661;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_662;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_663;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_664;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_665;
+typedef std::tuple<var, double, var, double, empty, empty> type_v_666;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_v_667;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_668;
+typedef std::tuple<var, double, var, var, empty, empty> type_v_669;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_v_670;
+typedef std::tuple<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_671;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_v_672;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_v_673;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_674;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_v_675;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_v_676;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_677;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_678;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_679;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_680;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_681;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_682;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_683;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_v_684;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_v_685;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_686;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_v_687;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_v_688;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_689;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_v_690;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_691;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_692;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_v_693;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_694;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_695;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_696;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_697;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_698;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_699;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_600> AgradDistributionExpModNormal_v_600;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_601> AgradDistributionExpModNormal_v_601;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_602> AgradDistributionExpModNormal_v_602;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_603> AgradDistributionExpModNormal_v_603;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_604> AgradDistributionExpModNormal_v_604;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_605> AgradDistributionExpModNormal_v_605;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_606> AgradDistributionExpModNormal_v_606;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_607> AgradDistributionExpModNormal_v_607;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_608> AgradDistributionExpModNormal_v_608;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_609> AgradDistributionExpModNormal_v_609;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_610> AgradDistributionExpModNormal_v_610;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_611> AgradDistributionExpModNormal_v_611;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_612> AgradDistributionExpModNormal_v_612;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_613> AgradDistributionExpModNormal_v_613;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_614> AgradDistributionExpModNormal_v_614;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_615> AgradDistributionExpModNormal_v_615;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_616> AgradDistributionExpModNormal_v_616;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_617> AgradDistributionExpModNormal_v_617;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_618> AgradDistributionExpModNormal_v_618;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_619> AgradDistributionExpModNormal_v_619;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_620> AgradDistributionExpModNormal_v_620;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_621> AgradDistributionExpModNormal_v_621;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_622> AgradDistributionExpModNormal_v_622;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_623> AgradDistributionExpModNormal_v_623;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_624> AgradDistributionExpModNormal_v_624;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_625> AgradDistributionExpModNormal_v_625;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_626> AgradDistributionExpModNormal_v_626;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_627> AgradDistributionExpModNormal_v_627;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_628> AgradDistributionExpModNormal_v_628;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_629> AgradDistributionExpModNormal_v_629;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_630> AgradDistributionExpModNormal_v_630;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_631> AgradDistributionExpModNormal_v_631;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_632> AgradDistributionExpModNormal_v_632;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_633> AgradDistributionExpModNormal_v_633;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_634> AgradDistributionExpModNormal_v_634;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_635> AgradDistributionExpModNormal_v_635;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_636> AgradDistributionExpModNormal_v_636;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_637> AgradDistributionExpModNormal_v_637;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_638> AgradDistributionExpModNormal_v_638;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_639> AgradDistributionExpModNormal_v_639;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_640> AgradDistributionExpModNormal_v_640;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_641> AgradDistributionExpModNormal_v_641;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_642> AgradDistributionExpModNormal_v_642;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_643> AgradDistributionExpModNormal_v_643;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_644> AgradDistributionExpModNormal_v_644;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_645> AgradDistributionExpModNormal_v_645;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_646> AgradDistributionExpModNormal_v_646;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_647> AgradDistributionExpModNormal_v_647;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_648> AgradDistributionExpModNormal_v_648;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_649> AgradDistributionExpModNormal_v_649;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_650> AgradDistributionExpModNormal_v_650;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_651> AgradDistributionExpModNormal_v_651;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_652> AgradDistributionExpModNormal_v_652;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_653> AgradDistributionExpModNormal_v_653;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_654> AgradDistributionExpModNormal_v_654;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_655> AgradDistributionExpModNormal_v_655;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_656> AgradDistributionExpModNormal_v_656;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_657> AgradDistributionExpModNormal_v_657;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_658> AgradDistributionExpModNormal_v_658;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_659> AgradDistributionExpModNormal_v_659;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_660> AgradDistributionExpModNormal_v_660;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_661> AgradDistributionExpModNormal_v_661;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_662> AgradDistributionExpModNormal_v_662;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_663> AgradDistributionExpModNormal_v_663;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_664> AgradDistributionExpModNormal_v_664;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_665> AgradDistributionExpModNormal_v_665;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_666> AgradDistributionExpModNormal_v_666;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_667> AgradDistributionExpModNormal_v_667;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_668> AgradDistributionExpModNormal_v_668;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_669> AgradDistributionExpModNormal_v_669;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_670> AgradDistributionExpModNormal_v_670;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_671> AgradDistributionExpModNormal_v_671;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_672> AgradDistributionExpModNormal_v_672;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_673> AgradDistributionExpModNormal_v_673;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_674> AgradDistributionExpModNormal_v_674;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_675> AgradDistributionExpModNormal_v_675;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_676> AgradDistributionExpModNormal_v_676;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_677> AgradDistributionExpModNormal_v_677;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_678> AgradDistributionExpModNormal_v_678;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_679> AgradDistributionExpModNormal_v_679;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_680> AgradDistributionExpModNormal_v_680;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_681> AgradDistributionExpModNormal_v_681;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_682> AgradDistributionExpModNormal_v_682;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_683> AgradDistributionExpModNormal_v_683;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_684> AgradDistributionExpModNormal_v_684;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_685> AgradDistributionExpModNormal_v_685;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_686> AgradDistributionExpModNormal_v_686;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_687> AgradDistributionExpModNormal_v_687;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_688> AgradDistributionExpModNormal_v_688;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_689> AgradDistributionExpModNormal_v_689;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_690> AgradDistributionExpModNormal_v_690;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_691> AgradDistributionExpModNormal_v_691;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_692> AgradDistributionExpModNormal_v_692;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_693> AgradDistributionExpModNormal_v_693;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_694> AgradDistributionExpModNormal_v_694;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_695> AgradDistributionExpModNormal_v_695;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_696> AgradDistributionExpModNormal_v_696;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_697> AgradDistributionExpModNormal_v_697;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_698> AgradDistributionExpModNormal_v_698;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_699> AgradDistributionExpModNormal_v_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_600, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_601, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_602, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_603, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_604, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_605, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_606, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_607, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_608, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_609, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_610, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_611, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_612, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_613, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_614, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_615, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_616, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_617, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_618, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_619, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_620, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_621, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_622, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_623, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_624, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_625, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_626, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_627, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_628, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_629, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_630, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_631, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_632, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_633, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_634, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_635, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_636, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_637, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_638, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_639, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_640, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_641, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_642, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_643, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_644, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_645, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_646, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_647, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_648, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_649, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_650, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_651, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_652, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_653, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_654, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_655, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_656, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_657, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_658, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_659, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_660, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_661, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_662, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_663, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_664, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_665, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_666, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_667, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_668, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_669, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_670, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_671, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_672, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_673, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_674, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_675, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_676, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_677, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_678, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_679, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_680, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_681, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_682, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_683, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_684, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_685, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_686, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_687, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_688, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_689, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_690, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_691, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_692, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_693, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_694, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_695, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_696, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_697, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_698, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_699, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_600;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_601;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_602;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_vv_603;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_604;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_605;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_vv_606;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_607;
+typedef std::tuple<var, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_608;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_609;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_610;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_611;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_612;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_613;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_614;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_615;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_616;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_617;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_618;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_619;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_620;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_vv_621;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_622;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_623;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_vv_624;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_625;
+typedef std::tuple<var, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_626;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_627;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_628;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_629;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_630;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_631;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_632;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_633;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_634;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_635;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_636;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_637;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_638;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_639;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_640;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_641;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_642;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_643;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_644;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_645;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_646;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_647;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_648;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_649;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_650;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_651;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_652;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_653;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_654;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_655;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_656;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_657;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_658;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_659;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_660;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_661;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_662;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_663;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_664;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_665;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_666;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_667;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_668;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_669;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_670;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_671;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_672;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_673;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_674;
+typedef std::tuple<var, var, double, double, empty, empty> type_vv_675;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_vv_676;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_677;
+typedef std::tuple<var, var, double, var, empty, empty> type_vv_678;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_vv_679;
+typedef std::tuple<var, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_680;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_vv_681;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_682;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_683;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_vv_684;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_685;
+typedef std::tuple<var, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_686;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_687;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_688;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_689;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_690;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_691;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_692;
+typedef std::tuple<var, var, var, double, empty, empty> type_vv_693;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_vv_694;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_695;
+typedef std::tuple<var, var, var, var, empty, empty> type_vv_696;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_vv_697;
+typedef std::tuple<var, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_698;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_vv_699;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_600> AgradDistributionExpModNormal_vv_600;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_601> AgradDistributionExpModNormal_vv_601;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_602> AgradDistributionExpModNormal_vv_602;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_603> AgradDistributionExpModNormal_vv_603;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_604> AgradDistributionExpModNormal_vv_604;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_605> AgradDistributionExpModNormal_vv_605;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_606> AgradDistributionExpModNormal_vv_606;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_607> AgradDistributionExpModNormal_vv_607;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_608> AgradDistributionExpModNormal_vv_608;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_609> AgradDistributionExpModNormal_vv_609;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_610> AgradDistributionExpModNormal_vv_610;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_611> AgradDistributionExpModNormal_vv_611;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_612> AgradDistributionExpModNormal_vv_612;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_613> AgradDistributionExpModNormal_vv_613;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_614> AgradDistributionExpModNormal_vv_614;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_615> AgradDistributionExpModNormal_vv_615;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_616> AgradDistributionExpModNormal_vv_616;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_617> AgradDistributionExpModNormal_vv_617;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_618> AgradDistributionExpModNormal_vv_618;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_619> AgradDistributionExpModNormal_vv_619;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_620> AgradDistributionExpModNormal_vv_620;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_621> AgradDistributionExpModNormal_vv_621;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_622> AgradDistributionExpModNormal_vv_622;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_623> AgradDistributionExpModNormal_vv_623;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_624> AgradDistributionExpModNormal_vv_624;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_625> AgradDistributionExpModNormal_vv_625;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_626> AgradDistributionExpModNormal_vv_626;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_627> AgradDistributionExpModNormal_vv_627;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_628> AgradDistributionExpModNormal_vv_628;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_629> AgradDistributionExpModNormal_vv_629;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_630> AgradDistributionExpModNormal_vv_630;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_631> AgradDistributionExpModNormal_vv_631;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_632> AgradDistributionExpModNormal_vv_632;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_633> AgradDistributionExpModNormal_vv_633;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_634> AgradDistributionExpModNormal_vv_634;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_635> AgradDistributionExpModNormal_vv_635;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_636> AgradDistributionExpModNormal_vv_636;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_637> AgradDistributionExpModNormal_vv_637;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_638> AgradDistributionExpModNormal_vv_638;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_639> AgradDistributionExpModNormal_vv_639;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_640> AgradDistributionExpModNormal_vv_640;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_641> AgradDistributionExpModNormal_vv_641;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_642> AgradDistributionExpModNormal_vv_642;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_643> AgradDistributionExpModNormal_vv_643;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_644> AgradDistributionExpModNormal_vv_644;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_645> AgradDistributionExpModNormal_vv_645;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_646> AgradDistributionExpModNormal_vv_646;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_647> AgradDistributionExpModNormal_vv_647;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_648> AgradDistributionExpModNormal_vv_648;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_649> AgradDistributionExpModNormal_vv_649;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_650> AgradDistributionExpModNormal_vv_650;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_651> AgradDistributionExpModNormal_vv_651;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_652> AgradDistributionExpModNormal_vv_652;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_653> AgradDistributionExpModNormal_vv_653;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_654> AgradDistributionExpModNormal_vv_654;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_655> AgradDistributionExpModNormal_vv_655;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_656> AgradDistributionExpModNormal_vv_656;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_657> AgradDistributionExpModNormal_vv_657;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_658> AgradDistributionExpModNormal_vv_658;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_659> AgradDistributionExpModNormal_vv_659;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_660> AgradDistributionExpModNormal_vv_660;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_661> AgradDistributionExpModNormal_vv_661;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_662> AgradDistributionExpModNormal_vv_662;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_663> AgradDistributionExpModNormal_vv_663;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_664> AgradDistributionExpModNormal_vv_664;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_665> AgradDistributionExpModNormal_vv_665;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_666> AgradDistributionExpModNormal_vv_666;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_667> AgradDistributionExpModNormal_vv_667;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_668> AgradDistributionExpModNormal_vv_668;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_669> AgradDistributionExpModNormal_vv_669;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_670> AgradDistributionExpModNormal_vv_670;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_671> AgradDistributionExpModNormal_vv_671;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_672> AgradDistributionExpModNormal_vv_672;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_673> AgradDistributionExpModNormal_vv_673;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_674> AgradDistributionExpModNormal_vv_674;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_675> AgradDistributionExpModNormal_vv_675;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_676> AgradDistributionExpModNormal_vv_676;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_677> AgradDistributionExpModNormal_vv_677;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_678> AgradDistributionExpModNormal_vv_678;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_679> AgradDistributionExpModNormal_vv_679;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_680> AgradDistributionExpModNormal_vv_680;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_681> AgradDistributionExpModNormal_vv_681;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_682> AgradDistributionExpModNormal_vv_682;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_683> AgradDistributionExpModNormal_vv_683;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_684> AgradDistributionExpModNormal_vv_684;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_685> AgradDistributionExpModNormal_vv_685;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_686> AgradDistributionExpModNormal_vv_686;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_687> AgradDistributionExpModNormal_vv_687;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_688> AgradDistributionExpModNormal_vv_688;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_689> AgradDistributionExpModNormal_vv_689;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_690> AgradDistributionExpModNormal_vv_690;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_691> AgradDistributionExpModNormal_vv_691;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_692> AgradDistributionExpModNormal_vv_692;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_693> AgradDistributionExpModNormal_vv_693;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_694> AgradDistributionExpModNormal_vv_694;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_695> AgradDistributionExpModNormal_vv_695;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_696> AgradDistributionExpModNormal_vv_696;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_697> AgradDistributionExpModNormal_vv_697;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_698> AgradDistributionExpModNormal_vv_698;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_699> AgradDistributionExpModNormal_vv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_600, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_601, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_602, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_603, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_604, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_605, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_606, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_607, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_608, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_609, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_610, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_611, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_612, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_613, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_614, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_615, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_616, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_617, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_618, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_619, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_620, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_621, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_622, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_623, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_624, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_625, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_626, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_627, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_628, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_629, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_630, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_631, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_632, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_633, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_634, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_635, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_636, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_637, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_638, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_639, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_640, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_641, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_642, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_643, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_644, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_645, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_646, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_647, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_648, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_649, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_650, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_651, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_652, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_653, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_654, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_655, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_656, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_657, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_658, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_659, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_660, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_661, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_662, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_663, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_664, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_665, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_666, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_667, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_668, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_669, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_670, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_671, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_672, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_673, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_674, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_675, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_676, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_677, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_678, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_679, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_680, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_681, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_682, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_683, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_684, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_685, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_686, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_687, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_688, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_689, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_690, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_691, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_692, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_693, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_694, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_695, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_696, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_697, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_698, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_699, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_700;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_701;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_702;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_703;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_704;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_705;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_706;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_707;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_708;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_709;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_710;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_711;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_712;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_713;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_714;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_715;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_716;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_717;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_718;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_719;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_720;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_721;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_722;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_723;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_724;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_725;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_726;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_727;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_728;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_729;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_730;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_731;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_732;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_733;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_734;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_735;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_736;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_737;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_738;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_739;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_740;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_741;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_742;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_743;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_744;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_745;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_746;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_747;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_748;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_749;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_750;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_751;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_752;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_753;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_754;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_755;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_756;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_757;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_758;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_759;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_760;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_761;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_762;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_763;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_764;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_765;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_766;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_767;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_768;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_769;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_770;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_771;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_772;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_773;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_774;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_775;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_776;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_777;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_778;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_779;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_780;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_781;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_782;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, double, empty, empty> type_ffv_783;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty, empty> type_ffv_784;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_785;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_786;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_787;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_788;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty, empty> type_ffv_789;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_790;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_791;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_792;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_793;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_794;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_795;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_796;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_797;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_798;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_799;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_700> AgradDistributionExpModNormal_ffv_700;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_701> AgradDistributionExpModNormal_ffv_701;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_702> AgradDistributionExpModNormal_ffv_702;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_703> AgradDistributionExpModNormal_ffv_703;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_704> AgradDistributionExpModNormal_ffv_704;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_705> AgradDistributionExpModNormal_ffv_705;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_706> AgradDistributionExpModNormal_ffv_706;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_707> AgradDistributionExpModNormal_ffv_707;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_708> AgradDistributionExpModNormal_ffv_708;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_709> AgradDistributionExpModNormal_ffv_709;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_710> AgradDistributionExpModNormal_ffv_710;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_711> AgradDistributionExpModNormal_ffv_711;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_712> AgradDistributionExpModNormal_ffv_712;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_713> AgradDistributionExpModNormal_ffv_713;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_714> AgradDistributionExpModNormal_ffv_714;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_715> AgradDistributionExpModNormal_ffv_715;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_716> AgradDistributionExpModNormal_ffv_716;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_717> AgradDistributionExpModNormal_ffv_717;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_718> AgradDistributionExpModNormal_ffv_718;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_719> AgradDistributionExpModNormal_ffv_719;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_720> AgradDistributionExpModNormal_ffv_720;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_721> AgradDistributionExpModNormal_ffv_721;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_722> AgradDistributionExpModNormal_ffv_722;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_723> AgradDistributionExpModNormal_ffv_723;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_724> AgradDistributionExpModNormal_ffv_724;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_725> AgradDistributionExpModNormal_ffv_725;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_726> AgradDistributionExpModNormal_ffv_726;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_727> AgradDistributionExpModNormal_ffv_727;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_728> AgradDistributionExpModNormal_ffv_728;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_729> AgradDistributionExpModNormal_ffv_729;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_730> AgradDistributionExpModNormal_ffv_730;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_731> AgradDistributionExpModNormal_ffv_731;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_732> AgradDistributionExpModNormal_ffv_732;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_733> AgradDistributionExpModNormal_ffv_733;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_734> AgradDistributionExpModNormal_ffv_734;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_735> AgradDistributionExpModNormal_ffv_735;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_736> AgradDistributionExpModNormal_ffv_736;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_737> AgradDistributionExpModNormal_ffv_737;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_738> AgradDistributionExpModNormal_ffv_738;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_739> AgradDistributionExpModNormal_ffv_739;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_740> AgradDistributionExpModNormal_ffv_740;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_741> AgradDistributionExpModNormal_ffv_741;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_742> AgradDistributionExpModNormal_ffv_742;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_743> AgradDistributionExpModNormal_ffv_743;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_744> AgradDistributionExpModNormal_ffv_744;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_745> AgradDistributionExpModNormal_ffv_745;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_746> AgradDistributionExpModNormal_ffv_746;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_747> AgradDistributionExpModNormal_ffv_747;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_748> AgradDistributionExpModNormal_ffv_748;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_749> AgradDistributionExpModNormal_ffv_749;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_750> AgradDistributionExpModNormal_ffv_750;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_751> AgradDistributionExpModNormal_ffv_751;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_752> AgradDistributionExpModNormal_ffv_752;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_753> AgradDistributionExpModNormal_ffv_753;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_754> AgradDistributionExpModNormal_ffv_754;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_755> AgradDistributionExpModNormal_ffv_755;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_756> AgradDistributionExpModNormal_ffv_756;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_757> AgradDistributionExpModNormal_ffv_757;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_758> AgradDistributionExpModNormal_ffv_758;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_759> AgradDistributionExpModNormal_ffv_759;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_760> AgradDistributionExpModNormal_ffv_760;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_761> AgradDistributionExpModNormal_ffv_761;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_762> AgradDistributionExpModNormal_ffv_762;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_763> AgradDistributionExpModNormal_ffv_763;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_764> AgradDistributionExpModNormal_ffv_764;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_765> AgradDistributionExpModNormal_ffv_765;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_766> AgradDistributionExpModNormal_ffv_766;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_767> AgradDistributionExpModNormal_ffv_767;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_768> AgradDistributionExpModNormal_ffv_768;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_769> AgradDistributionExpModNormal_ffv_769;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_770> AgradDistributionExpModNormal_ffv_770;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_771> AgradDistributionExpModNormal_ffv_771;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_772> AgradDistributionExpModNormal_ffv_772;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_773> AgradDistributionExpModNormal_ffv_773;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_774> AgradDistributionExpModNormal_ffv_774;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_775> AgradDistributionExpModNormal_ffv_775;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_776> AgradDistributionExpModNormal_ffv_776;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_777> AgradDistributionExpModNormal_ffv_777;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_778> AgradDistributionExpModNormal_ffv_778;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_779> AgradDistributionExpModNormal_ffv_779;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_780> AgradDistributionExpModNormal_ffv_780;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_781> AgradDistributionExpModNormal_ffv_781;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_782> AgradDistributionExpModNormal_ffv_782;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_783> AgradDistributionExpModNormal_ffv_783;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_784> AgradDistributionExpModNormal_ffv_784;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_785> AgradDistributionExpModNormal_ffv_785;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_786> AgradDistributionExpModNormal_ffv_786;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_787> AgradDistributionExpModNormal_ffv_787;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_788> AgradDistributionExpModNormal_ffv_788;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_789> AgradDistributionExpModNormal_ffv_789;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_790> AgradDistributionExpModNormal_ffv_790;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_791> AgradDistributionExpModNormal_ffv_791;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_792> AgradDistributionExpModNormal_ffv_792;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_793> AgradDistributionExpModNormal_ffv_793;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_794> AgradDistributionExpModNormal_ffv_794;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_795> AgradDistributionExpModNormal_ffv_795;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_796> AgradDistributionExpModNormal_ffv_796;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_797> AgradDistributionExpModNormal_ffv_797;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_798> AgradDistributionExpModNormal_ffv_798;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_799> AgradDistributionExpModNormal_ffv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_700, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_701, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_702, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_703, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_704, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_705, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_706, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_707, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_708, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_709, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_710, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_711, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_712, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_713, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_714, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_715, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_716, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_717, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_718, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_719, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_720, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_721, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_722, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_723, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_724, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_725, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_726, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_727, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_728, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_729, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_730, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_731, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_732, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_733, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_734, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_735, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_736, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_737, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_738, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_739, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_740, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_741, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_742, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_743, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_744, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_745, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_746, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_747, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_748, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_749, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_750, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_751, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_752, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_753, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_754, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_755, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_756, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_757, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_758, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_759, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_760, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_761, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_762, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_763, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_764, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_765, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_766, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_767, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_768, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_769, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_770, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_771, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_772, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_773, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_774, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_775, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_776, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_777, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_778, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_779, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_780, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_781, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_782, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_783, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_784, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_785, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_786, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_787, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_788, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_789, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_790, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_791, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_792, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_793, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_794, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_795, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_796, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_797, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_798, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_799, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_700;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_701;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_v_702;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_v_703;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_704;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_v_705;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_v_706;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_707;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_v_708;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_709;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_710;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_v_711;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_712;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_713;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_714;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_715;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_716;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_717;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_718;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_719;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_720;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_721;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_722;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_723;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_724;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_725;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_726;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_727;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_728;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_729;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_730;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_731;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_732;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_733;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_734;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_735;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_736;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_737;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_738;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_739;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_740;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_741;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_742;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_743;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_744;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_745;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_746;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_747;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_748;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_749;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_750;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_751;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_752;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_753;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_754;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_755;
+typedef std::tuple<var, var, double, double, empty, empty> type_v_756;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_v_757;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_758;
+typedef std::tuple<var, var, double, var, empty, empty> type_v_759;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_v_760;
+typedef std::tuple<var, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_761;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_v_762;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_v_763;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_764;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_v_765;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_v_766;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_767;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_768;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_769;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_770;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_771;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_772;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_773;
+typedef std::tuple<var, var, var, double, empty, empty> type_v_774;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_v_775;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_776;
+typedef std::tuple<var, var, var, var, empty, empty> type_v_777;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_v_778;
+typedef std::tuple<var, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_779;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_v_780;
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_v_781;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_782;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_v_783;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_v_784;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_785;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_786;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_787;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_788;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_789;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_790;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_791;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_v_792;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_v_793;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_794;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_v_795;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_v_796;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_797;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_v_798;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_799;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_700> AgradDistributionExpModNormal_v_700;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_701> AgradDistributionExpModNormal_v_701;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_702> AgradDistributionExpModNormal_v_702;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_703> AgradDistributionExpModNormal_v_703;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_704> AgradDistributionExpModNormal_v_704;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_705> AgradDistributionExpModNormal_v_705;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_706> AgradDistributionExpModNormal_v_706;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_707> AgradDistributionExpModNormal_v_707;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_708> AgradDistributionExpModNormal_v_708;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_709> AgradDistributionExpModNormal_v_709;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_710> AgradDistributionExpModNormal_v_710;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_711> AgradDistributionExpModNormal_v_711;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_712> AgradDistributionExpModNormal_v_712;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_713> AgradDistributionExpModNormal_v_713;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_714> AgradDistributionExpModNormal_v_714;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_715> AgradDistributionExpModNormal_v_715;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_716> AgradDistributionExpModNormal_v_716;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_717> AgradDistributionExpModNormal_v_717;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_718> AgradDistributionExpModNormal_v_718;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_719> AgradDistributionExpModNormal_v_719;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_720> AgradDistributionExpModNormal_v_720;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_721> AgradDistributionExpModNormal_v_721;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_722> AgradDistributionExpModNormal_v_722;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_723> AgradDistributionExpModNormal_v_723;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_724> AgradDistributionExpModNormal_v_724;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_725> AgradDistributionExpModNormal_v_725;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_726> AgradDistributionExpModNormal_v_726;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_727> AgradDistributionExpModNormal_v_727;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_728> AgradDistributionExpModNormal_v_728;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_729> AgradDistributionExpModNormal_v_729;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_730> AgradDistributionExpModNormal_v_730;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_731> AgradDistributionExpModNormal_v_731;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_732> AgradDistributionExpModNormal_v_732;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_733> AgradDistributionExpModNormal_v_733;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_734> AgradDistributionExpModNormal_v_734;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_735> AgradDistributionExpModNormal_v_735;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_736> AgradDistributionExpModNormal_v_736;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_737> AgradDistributionExpModNormal_v_737;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_738> AgradDistributionExpModNormal_v_738;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_739> AgradDistributionExpModNormal_v_739;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_740> AgradDistributionExpModNormal_v_740;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_741> AgradDistributionExpModNormal_v_741;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_742> AgradDistributionExpModNormal_v_742;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_743> AgradDistributionExpModNormal_v_743;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_744> AgradDistributionExpModNormal_v_744;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_745> AgradDistributionExpModNormal_v_745;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_746> AgradDistributionExpModNormal_v_746;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_747> AgradDistributionExpModNormal_v_747;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_748> AgradDistributionExpModNormal_v_748;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_749> AgradDistributionExpModNormal_v_749;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_750> AgradDistributionExpModNormal_v_750;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_751> AgradDistributionExpModNormal_v_751;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_752> AgradDistributionExpModNormal_v_752;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_753> AgradDistributionExpModNormal_v_753;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_754> AgradDistributionExpModNormal_v_754;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_755> AgradDistributionExpModNormal_v_755;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_756> AgradDistributionExpModNormal_v_756;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_757> AgradDistributionExpModNormal_v_757;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_758> AgradDistributionExpModNormal_v_758;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_759> AgradDistributionExpModNormal_v_759;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_760> AgradDistributionExpModNormal_v_760;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_761> AgradDistributionExpModNormal_v_761;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_762> AgradDistributionExpModNormal_v_762;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_763> AgradDistributionExpModNormal_v_763;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_764> AgradDistributionExpModNormal_v_764;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_765> AgradDistributionExpModNormal_v_765;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_766> AgradDistributionExpModNormal_v_766;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_767> AgradDistributionExpModNormal_v_767;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_768> AgradDistributionExpModNormal_v_768;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_769> AgradDistributionExpModNormal_v_769;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_770> AgradDistributionExpModNormal_v_770;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_771> AgradDistributionExpModNormal_v_771;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_772> AgradDistributionExpModNormal_v_772;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_773> AgradDistributionExpModNormal_v_773;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_774> AgradDistributionExpModNormal_v_774;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_775> AgradDistributionExpModNormal_v_775;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_776> AgradDistributionExpModNormal_v_776;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_777> AgradDistributionExpModNormal_v_777;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_778> AgradDistributionExpModNormal_v_778;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_779> AgradDistributionExpModNormal_v_779;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_780> AgradDistributionExpModNormal_v_780;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_781> AgradDistributionExpModNormal_v_781;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_782> AgradDistributionExpModNormal_v_782;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_783> AgradDistributionExpModNormal_v_783;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_784> AgradDistributionExpModNormal_v_784;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_785> AgradDistributionExpModNormal_v_785;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_786> AgradDistributionExpModNormal_v_786;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_787> AgradDistributionExpModNormal_v_787;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_788> AgradDistributionExpModNormal_v_788;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_789> AgradDistributionExpModNormal_v_789;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_790> AgradDistributionExpModNormal_v_790;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_791> AgradDistributionExpModNormal_v_791;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_792> AgradDistributionExpModNormal_v_792;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_793> AgradDistributionExpModNormal_v_793;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_794> AgradDistributionExpModNormal_v_794;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_795> AgradDistributionExpModNormal_v_795;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_796> AgradDistributionExpModNormal_v_796;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_797> AgradDistributionExpModNormal_v_797;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_798> AgradDistributionExpModNormal_v_798;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_799> AgradDistributionExpModNormal_v_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_700, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_701, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_702, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_703, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_704, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_705, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_706, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_707, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_708, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_709, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_710, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_711, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_712, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_713, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_714, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_715, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_716, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_717, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_718, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_719, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_720, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_721, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_722, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_723, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_724, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_725, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_726, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_727, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_728, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_729, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_730, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_731, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_732, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_733, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_734, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_735, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_736, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_737, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_738, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_739, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_740, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_741, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_742, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_743, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_744, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_745, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_746, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_747, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_748, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_749, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_750, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_751, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_752, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_753, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_754, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_755, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_756, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_757, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_758, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_759, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_760, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_761, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_762, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_763, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_764, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_765, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_766, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_767, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_768, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_769, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_770, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_771, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_772, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_773, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_774, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_775, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_776, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_777, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_778, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_779, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_780, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_781, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_782, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_783, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_784, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_785, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_786, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_787, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_788, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_789, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_790, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_791, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_792, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_793, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_794, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_795, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_796, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_797, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_798, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_799, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_700;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_701;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_vv_702;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_703;
+typedef std::tuple<var, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_704;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_705;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_706;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_707;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_708;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_709;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_710;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_vv_711;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_712;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_713;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_vv_714;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_715;
+typedef std::tuple<var, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_716;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_717;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_718;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_719;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_720;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_721;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_722;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_723;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_724;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_725;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_726;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_727;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_728;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_vv_729;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_730;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_731;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_vv_732;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_733;
+typedef std::tuple<var, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_734;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_735;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_736;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_737;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_738;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_739;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_740;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_741;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_742;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_743;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_744;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_745;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_746;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_747;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_748;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_749;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_750;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_751;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_752;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_753;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_754;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_755;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_756;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_757;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_758;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_759;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_760;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_761;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_762;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_763;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_764;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_765;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_766;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_767;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_768;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_769;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_770;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_771;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_772;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_773;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_774;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_775;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_776;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_777;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_778;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_779;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_780;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_781;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_782;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_vv_783;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_vv_784;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_785;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_vv_786;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_vv_787;
+typedef std::tuple<std::vector<var>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_788;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_vv_789;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_790;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_791;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_vv_792;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_793;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_794;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_795;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_796;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_797;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_798;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_799;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_700> AgradDistributionExpModNormal_vv_700;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_701> AgradDistributionExpModNormal_vv_701;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_702> AgradDistributionExpModNormal_vv_702;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_703> AgradDistributionExpModNormal_vv_703;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_704> AgradDistributionExpModNormal_vv_704;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_705> AgradDistributionExpModNormal_vv_705;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_706> AgradDistributionExpModNormal_vv_706;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_707> AgradDistributionExpModNormal_vv_707;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_708> AgradDistributionExpModNormal_vv_708;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_709> AgradDistributionExpModNormal_vv_709;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_710> AgradDistributionExpModNormal_vv_710;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_711> AgradDistributionExpModNormal_vv_711;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_712> AgradDistributionExpModNormal_vv_712;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_713> AgradDistributionExpModNormal_vv_713;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_714> AgradDistributionExpModNormal_vv_714;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_715> AgradDistributionExpModNormal_vv_715;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_716> AgradDistributionExpModNormal_vv_716;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_717> AgradDistributionExpModNormal_vv_717;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_718> AgradDistributionExpModNormal_vv_718;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_719> AgradDistributionExpModNormal_vv_719;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_720> AgradDistributionExpModNormal_vv_720;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_721> AgradDistributionExpModNormal_vv_721;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_722> AgradDistributionExpModNormal_vv_722;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_723> AgradDistributionExpModNormal_vv_723;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_724> AgradDistributionExpModNormal_vv_724;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_725> AgradDistributionExpModNormal_vv_725;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_726> AgradDistributionExpModNormal_vv_726;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_727> AgradDistributionExpModNormal_vv_727;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_728> AgradDistributionExpModNormal_vv_728;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_729> AgradDistributionExpModNormal_vv_729;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_730> AgradDistributionExpModNormal_vv_730;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_731> AgradDistributionExpModNormal_vv_731;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_732> AgradDistributionExpModNormal_vv_732;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_733> AgradDistributionExpModNormal_vv_733;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_734> AgradDistributionExpModNormal_vv_734;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_735> AgradDistributionExpModNormal_vv_735;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_736> AgradDistributionExpModNormal_vv_736;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_737> AgradDistributionExpModNormal_vv_737;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_738> AgradDistributionExpModNormal_vv_738;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_739> AgradDistributionExpModNormal_vv_739;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_740> AgradDistributionExpModNormal_vv_740;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_741> AgradDistributionExpModNormal_vv_741;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_742> AgradDistributionExpModNormal_vv_742;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_743> AgradDistributionExpModNormal_vv_743;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_744> AgradDistributionExpModNormal_vv_744;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_745> AgradDistributionExpModNormal_vv_745;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_746> AgradDistributionExpModNormal_vv_746;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_747> AgradDistributionExpModNormal_vv_747;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_748> AgradDistributionExpModNormal_vv_748;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_749> AgradDistributionExpModNormal_vv_749;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_750> AgradDistributionExpModNormal_vv_750;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_751> AgradDistributionExpModNormal_vv_751;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_752> AgradDistributionExpModNormal_vv_752;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_753> AgradDistributionExpModNormal_vv_753;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_754> AgradDistributionExpModNormal_vv_754;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_755> AgradDistributionExpModNormal_vv_755;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_756> AgradDistributionExpModNormal_vv_756;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_757> AgradDistributionExpModNormal_vv_757;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_758> AgradDistributionExpModNormal_vv_758;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_759> AgradDistributionExpModNormal_vv_759;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_760> AgradDistributionExpModNormal_vv_760;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_761> AgradDistributionExpModNormal_vv_761;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_762> AgradDistributionExpModNormal_vv_762;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_763> AgradDistributionExpModNormal_vv_763;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_764> AgradDistributionExpModNormal_vv_764;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_765> AgradDistributionExpModNormal_vv_765;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_766> AgradDistributionExpModNormal_vv_766;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_767> AgradDistributionExpModNormal_vv_767;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_768> AgradDistributionExpModNormal_vv_768;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_769> AgradDistributionExpModNormal_vv_769;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_770> AgradDistributionExpModNormal_vv_770;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_771> AgradDistributionExpModNormal_vv_771;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_772> AgradDistributionExpModNormal_vv_772;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_773> AgradDistributionExpModNormal_vv_773;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_774> AgradDistributionExpModNormal_vv_774;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_775> AgradDistributionExpModNormal_vv_775;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_776> AgradDistributionExpModNormal_vv_776;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_777> AgradDistributionExpModNormal_vv_777;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_778> AgradDistributionExpModNormal_vv_778;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_779> AgradDistributionExpModNormal_vv_779;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_780> AgradDistributionExpModNormal_vv_780;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_781> AgradDistributionExpModNormal_vv_781;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_782> AgradDistributionExpModNormal_vv_782;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_783> AgradDistributionExpModNormal_vv_783;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_784> AgradDistributionExpModNormal_vv_784;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_785> AgradDistributionExpModNormal_vv_785;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_786> AgradDistributionExpModNormal_vv_786;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_787> AgradDistributionExpModNormal_vv_787;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_788> AgradDistributionExpModNormal_vv_788;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_789> AgradDistributionExpModNormal_vv_789;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_790> AgradDistributionExpModNormal_vv_790;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_791> AgradDistributionExpModNormal_vv_791;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_792> AgradDistributionExpModNormal_vv_792;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_793> AgradDistributionExpModNormal_vv_793;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_794> AgradDistributionExpModNormal_vv_794;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_795> AgradDistributionExpModNormal_vv_795;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_796> AgradDistributionExpModNormal_vv_796;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_797> AgradDistributionExpModNormal_vv_797;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_798> AgradDistributionExpModNormal_vv_798;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_799> AgradDistributionExpModNormal_vv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_700, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_701, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_702, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_703, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_704, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_705, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_706, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_707, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_708, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_709, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_710, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_711, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_712, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_713, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_714, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_715, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_716, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_717, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_718, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_719, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_720, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_721, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_722, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_723, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_724, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_725, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_726, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_727, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_728, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_729, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_730, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_731, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_732, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_733, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_734, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_735, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_736, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_737, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_738, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_739, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_740, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_741, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_742, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_743, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_744, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_745, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_746, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_747, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_748, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_749, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_750, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_751, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_752, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_753, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_754, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_755, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_756, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_757, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_758, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_759, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_760, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_761, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_762, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_763, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_764, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_765, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_766, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_767, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_768, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_769, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_770, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_771, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_772, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_773, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_774, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_775, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_776, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_777, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_778, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_779, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_780, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_781, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_782, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_783, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_784, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_785, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_786, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_787, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_788, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_789, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_790, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_791, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_792, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_793, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_794, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_795, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_796, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_797, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_798, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_799, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_800;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_801;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_802;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_803;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_804;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_805;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_806;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_807;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_808;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_809;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_810;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_811;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_812;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_813;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_814;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_815;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_816;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_817;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_818;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty, empty> type_ffv_819;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_820;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_821;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_822;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_823;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_824;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_825;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_826;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_827;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_828;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_829;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_830;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_831;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_832;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_833;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_834;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_835;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_836;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_837;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_838;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_839;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_840;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_841;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_842;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_843;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_844;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_845;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_846;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_847;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_848;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_849;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_850;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_851;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_852;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_853;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_854;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_855;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_856;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_857;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_858;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_859;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_860;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_861;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_862;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_863;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_864;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_865;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_866;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_867;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_868;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_869;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_870;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_871;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_872;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_873;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_874;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_875;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_876;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_877;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_878;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_879;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_880;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_881;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_882;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_883;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_884;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_885;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_886;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_887;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_888;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_889;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_890;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_891;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_892;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_893;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_894;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_895;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_896;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_897;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_898;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_899;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_800> AgradDistributionExpModNormal_ffv_800;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_801> AgradDistributionExpModNormal_ffv_801;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_802> AgradDistributionExpModNormal_ffv_802;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_803> AgradDistributionExpModNormal_ffv_803;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_804> AgradDistributionExpModNormal_ffv_804;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_805> AgradDistributionExpModNormal_ffv_805;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_806> AgradDistributionExpModNormal_ffv_806;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_807> AgradDistributionExpModNormal_ffv_807;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_808> AgradDistributionExpModNormal_ffv_808;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_809> AgradDistributionExpModNormal_ffv_809;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_810> AgradDistributionExpModNormal_ffv_810;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_811> AgradDistributionExpModNormal_ffv_811;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_812> AgradDistributionExpModNormal_ffv_812;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_813> AgradDistributionExpModNormal_ffv_813;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_814> AgradDistributionExpModNormal_ffv_814;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_815> AgradDistributionExpModNormal_ffv_815;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_816> AgradDistributionExpModNormal_ffv_816;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_817> AgradDistributionExpModNormal_ffv_817;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_818> AgradDistributionExpModNormal_ffv_818;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_819> AgradDistributionExpModNormal_ffv_819;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_820> AgradDistributionExpModNormal_ffv_820;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_821> AgradDistributionExpModNormal_ffv_821;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_822> AgradDistributionExpModNormal_ffv_822;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_823> AgradDistributionExpModNormal_ffv_823;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_824> AgradDistributionExpModNormal_ffv_824;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_825> AgradDistributionExpModNormal_ffv_825;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_826> AgradDistributionExpModNormal_ffv_826;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_827> AgradDistributionExpModNormal_ffv_827;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_828> AgradDistributionExpModNormal_ffv_828;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_829> AgradDistributionExpModNormal_ffv_829;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_830> AgradDistributionExpModNormal_ffv_830;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_831> AgradDistributionExpModNormal_ffv_831;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_832> AgradDistributionExpModNormal_ffv_832;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_833> AgradDistributionExpModNormal_ffv_833;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_834> AgradDistributionExpModNormal_ffv_834;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_835> AgradDistributionExpModNormal_ffv_835;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_836> AgradDistributionExpModNormal_ffv_836;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_837> AgradDistributionExpModNormal_ffv_837;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_838> AgradDistributionExpModNormal_ffv_838;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_839> AgradDistributionExpModNormal_ffv_839;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_840> AgradDistributionExpModNormal_ffv_840;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_841> AgradDistributionExpModNormal_ffv_841;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_842> AgradDistributionExpModNormal_ffv_842;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_843> AgradDistributionExpModNormal_ffv_843;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_844> AgradDistributionExpModNormal_ffv_844;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_845> AgradDistributionExpModNormal_ffv_845;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_846> AgradDistributionExpModNormal_ffv_846;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_847> AgradDistributionExpModNormal_ffv_847;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_848> AgradDistributionExpModNormal_ffv_848;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_849> AgradDistributionExpModNormal_ffv_849;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_850> AgradDistributionExpModNormal_ffv_850;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_851> AgradDistributionExpModNormal_ffv_851;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_852> AgradDistributionExpModNormal_ffv_852;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_853> AgradDistributionExpModNormal_ffv_853;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_854> AgradDistributionExpModNormal_ffv_854;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_855> AgradDistributionExpModNormal_ffv_855;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_856> AgradDistributionExpModNormal_ffv_856;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_857> AgradDistributionExpModNormal_ffv_857;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_858> AgradDistributionExpModNormal_ffv_858;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_859> AgradDistributionExpModNormal_ffv_859;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_860> AgradDistributionExpModNormal_ffv_860;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_861> AgradDistributionExpModNormal_ffv_861;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_862> AgradDistributionExpModNormal_ffv_862;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_863> AgradDistributionExpModNormal_ffv_863;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_864> AgradDistributionExpModNormal_ffv_864;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_865> AgradDistributionExpModNormal_ffv_865;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_866> AgradDistributionExpModNormal_ffv_866;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_867> AgradDistributionExpModNormal_ffv_867;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_868> AgradDistributionExpModNormal_ffv_868;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_869> AgradDistributionExpModNormal_ffv_869;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_870> AgradDistributionExpModNormal_ffv_870;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_871> AgradDistributionExpModNormal_ffv_871;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_872> AgradDistributionExpModNormal_ffv_872;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_873> AgradDistributionExpModNormal_ffv_873;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_874> AgradDistributionExpModNormal_ffv_874;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_875> AgradDistributionExpModNormal_ffv_875;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_876> AgradDistributionExpModNormal_ffv_876;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_877> AgradDistributionExpModNormal_ffv_877;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_878> AgradDistributionExpModNormal_ffv_878;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_879> AgradDistributionExpModNormal_ffv_879;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_880> AgradDistributionExpModNormal_ffv_880;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_881> AgradDistributionExpModNormal_ffv_881;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_882> AgradDistributionExpModNormal_ffv_882;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_883> AgradDistributionExpModNormal_ffv_883;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_884> AgradDistributionExpModNormal_ffv_884;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_885> AgradDistributionExpModNormal_ffv_885;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_886> AgradDistributionExpModNormal_ffv_886;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_887> AgradDistributionExpModNormal_ffv_887;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_888> AgradDistributionExpModNormal_ffv_888;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_889> AgradDistributionExpModNormal_ffv_889;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_890> AgradDistributionExpModNormal_ffv_890;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_891> AgradDistributionExpModNormal_ffv_891;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_892> AgradDistributionExpModNormal_ffv_892;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_893> AgradDistributionExpModNormal_ffv_893;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_894> AgradDistributionExpModNormal_ffv_894;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_895> AgradDistributionExpModNormal_ffv_895;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_896> AgradDistributionExpModNormal_ffv_896;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_897> AgradDistributionExpModNormal_ffv_897;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_898> AgradDistributionExpModNormal_ffv_898;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_899> AgradDistributionExpModNormal_ffv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_800, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_801, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_802, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_803, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_804, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_805, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_806, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_807, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_808, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_809, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_810, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_811, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_812, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_813, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_814, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_815, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_816, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_817, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_818, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_819, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_820, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_821, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_822, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_823, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_824, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_825, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_826, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_827, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_828, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_829, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_830, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_831, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_832, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_833, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_834, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_835, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_836, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_837, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_838, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_839, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_840, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_841, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_842, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_843, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_844, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_845, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_846, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_847, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_848, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_849, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_850, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_851, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_852, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_853, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_854, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_855, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_856, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_857, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_858, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_859, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_860, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_861, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_862, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_863, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_864, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_865, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_866, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_867, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_868, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_869, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_870, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_871, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_872, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_873, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_874, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_875, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_876, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_877, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_878, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_879, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_880, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_881, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_882, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_883, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_884, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_885, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_886, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_887, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_888, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_889, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_890, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_891, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_892, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_893, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_894, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_895, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_896, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_897, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_898, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_899, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_899);
+
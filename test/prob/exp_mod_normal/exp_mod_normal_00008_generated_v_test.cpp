@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_800;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_v_801;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_802;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_803;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_804;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_805;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_806;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_807;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_808;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_809;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_v_810;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_v_811;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_812;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_v_813;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_v_814;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_815;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_v_816;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_817;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_818;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_v_819;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_820;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_821;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_822;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_823;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_824;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_825;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_826;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_827;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_828;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_829;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_830;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_831;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_832;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_833;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_834;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_835;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_836;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_837;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_838;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_839;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_840;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_841;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_842;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_843;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_844;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_845;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_846;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_847;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_848;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_849;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_850;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_851;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_852;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_853;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_854;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_855;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_856;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_857;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_858;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_859;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_860;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_861;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_862;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_863;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_v_864;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_v_865;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_866;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_v_867;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_v_868;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_869;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_v_870;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_871;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_872;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_v_873;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_874;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_875;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_876;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_877;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_878;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_879;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_880;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_881;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_v_882;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_v_883;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_884;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_v_885;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_v_886;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_887;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_v_888;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_889;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_890;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_v_891;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_892;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_893;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_894;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_895;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_896;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_897;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_898;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_899;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_800> AgradDistributionExpModNormal_v_800;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_801> AgradDistributionExpModNormal_v_801;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_802> AgradDistributionExpModNormal_v_802;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_803> AgradDistributionExpModNormal_v_803;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_804> AgradDistributionExpModNormal_v_804;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_805> AgradDistributionExpModNormal_v_805;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_806> AgradDistributionExpModNormal_v_806;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_807> AgradDistributionExpModNormal_v_807;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_808> AgradDistributionExpModNormal_v_808;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_809> AgradDistributionExpModNormal_v_809;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_810> AgradDistributionExpModNormal_v_810;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_811> AgradDistributionExpModNormal_v_811;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_812> AgradDistributionExpModNormal_v_812;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_813> AgradDistributionExpModNormal_v_813;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_814> AgradDistributionExpModNormal_v_814;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_815> AgradDistributionExpModNormal_v_815;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_816> AgradDistributionExpModNormal_v_816;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_817> AgradDistributionExpModNormal_v_817;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_818> AgradDistributionExpModNormal_v_818;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_819> AgradDistributionExpModNormal_v_819;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_820> AgradDistributionExpModNormal_v_820;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_821> AgradDistributionExpModNormal_v_821;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_822> AgradDistributionExpModNormal_v_822;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_823> AgradDistributionExpModNormal_v_823;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_824> AgradDistributionExpModNormal_v_824;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_825> AgradDistributionExpModNormal_v_825;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_826> AgradDistributionExpModNormal_v_826;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_827> AgradDistributionExpModNormal_v_827;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_828> AgradDistributionExpModNormal_v_828;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_829> AgradDistributionExpModNormal_v_829;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_830> AgradDistributionExpModNormal_v_830;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_831> AgradDistributionExpModNormal_v_831;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_832> AgradDistributionExpModNormal_v_832;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_833> AgradDistributionExpModNormal_v_833;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_834> AgradDistributionExpModNormal_v_834;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_835> AgradDistributionExpModNormal_v_835;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_836> AgradDistributionExpModNormal_v_836;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_837> AgradDistributionExpModNormal_v_837;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_838> AgradDistributionExpModNormal_v_838;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_839> AgradDistributionExpModNormal_v_839;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_840> AgradDistributionExpModNormal_v_840;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_841> AgradDistributionExpModNormal_v_841;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_842> AgradDistributionExpModNormal_v_842;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_843> AgradDistributionExpModNormal_v_843;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_844> AgradDistributionExpModNormal_v_844;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_845> AgradDistributionExpModNormal_v_845;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_846> AgradDistributionExpModNormal_v_846;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_847> AgradDistributionExpModNormal_v_847;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_848> AgradDistributionExpModNormal_v_848;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_849> AgradDistributionExpModNormal_v_849;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_850> AgradDistributionExpModNormal_v_850;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_851> AgradDistributionExpModNormal_v_851;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_852> AgradDistributionExpModNormal_v_852;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_853> AgradDistributionExpModNormal_v_853;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_854> AgradDistributionExpModNormal_v_854;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_855> AgradDistributionExpModNormal_v_855;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_856> AgradDistributionExpModNormal_v_856;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_857> AgradDistributionExpModNormal_v_857;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_858> AgradDistributionExpModNormal_v_858;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_859> AgradDistributionExpModNormal_v_859;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_860> AgradDistributionExpModNormal_v_860;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_861> AgradDistributionExpModNormal_v_861;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_862> AgradDistributionExpModNormal_v_862;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_863> AgradDistributionExpModNormal_v_863;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_864> AgradDistributionExpModNormal_v_864;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_865> AgradDistributionExpModNormal_v_865;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_866> AgradDistributionExpModNormal_v_866;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_867> AgradDistributionExpModNormal_v_867;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_868> AgradDistributionExpModNormal_v_868;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_869> AgradDistributionExpModNormal_v_869;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_870> AgradDistributionExpModNormal_v_870;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_871> AgradDistributionExpModNormal_v_871;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_872> AgradDistributionExpModNormal_v_872;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_873> AgradDistributionExpModNormal_v_873;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_874> AgradDistributionExpModNormal_v_874;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_875> AgradDistributionExpModNormal_v_875;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_876> AgradDistributionExpModNormal_v_876;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_877> AgradDistributionExpModNormal_v_877;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_878> AgradDistributionExpModNormal_v_878;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_879> AgradDistributionExpModNormal_v_879;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_880> AgradDistributionExpModNormal_v_880;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_881> AgradDistributionExpModNormal_v_881;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_882> AgradDistributionExpModNormal_v_882;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_883> AgradDistributionExpModNormal_v_883;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_884> AgradDistributionExpModNormal_v_884;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_885> AgradDistributionExpModNormal_v_885;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_886> AgradDistributionExpModNormal_v_886;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_887> AgradDistributionExpModNormal_v_887;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_888> AgradDistributionExpModNormal_v_888;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_889> AgradDistributionExpModNormal_v_889;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_890> AgradDistributionExpModNormal_v_890;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_891> AgradDistributionExpModNormal_v_891;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_892> AgradDistributionExpModNormal_v_892;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_893> AgradDistributionExpModNormal_v_893;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_894> AgradDistributionExpModNormal_v_894;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_895> AgradDistributionExpModNormal_v_895;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_896> AgradDistributionExpModNormal_v_896;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_897> AgradDistributionExpModNormal_v_897;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_898> AgradDistributionExpModNormal_v_898;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_899> AgradDistributionExpModNormal_v_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_800, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_801, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_802, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_803, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_804, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_805, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_806, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_807, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_808, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_809, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_810, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_811, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_812, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_813, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_814, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_815, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_816, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_817, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_818, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_819, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_820, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_821, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_822, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_823, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_824, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_825, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_826, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_827, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_828, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_829, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_830, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_831, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_832, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_833, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_834, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_835, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_836, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_837, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_838, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_839, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_840, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_841, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_842, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_843, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_844, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_845, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_846, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_847, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_848, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_849, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_850, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_851, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_852, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_853, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_854, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_855, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_856, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_857, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_858, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_859, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_860, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_861, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_862, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_863, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_864, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_865, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_866, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_867, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_868, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_869, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_870, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_871, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_872, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_873, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_874, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_875, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_876, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_877, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_878, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_879, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_880, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_881, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_882, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_883, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_884, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_885, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_886, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_887, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_888, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_889, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_890, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_891, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_892, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_893, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_894, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_895, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_896, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_897, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_898, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_899, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_800;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_vv_801;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_vv_802;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_803;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_vv_804;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_vv_805;
+typedef std::tuple<std::vector<var>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_806;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_vv_807;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_808;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_809;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_vv_810;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_811;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_812;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_813;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_814;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_815;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_816;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_817;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_818;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_vv_819;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_820;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_821;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_vv_822;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_823;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_824;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_825;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_826;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_827;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_828;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_829;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_830;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_831;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_832;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_833;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_834;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_835;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_836;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_vv_837;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_838;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_839;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_vv_840;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_841;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_842;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_843;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_844;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_845;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_846;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_847;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_848;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_849;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_850;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_851;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_852;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_853;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_854;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_855;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_856;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_857;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_858;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_859;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_860;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_861;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_862;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_863;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_864;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_865;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_866;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_867;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_868;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_869;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_870;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_871;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_872;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_873;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_874;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_875;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_876;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_877;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_878;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_879;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_880;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_881;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_882;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_883;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_884;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_885;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_886;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_887;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_888;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_889;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_890;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_vv_891;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_vv_892;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_893;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_vv_894;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_vv_895;
+typedef std::tuple<std::vector<var>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_896;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_vv_897;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_898;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_899;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_800> AgradDistributionExpModNormal_vv_800;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_801> AgradDistributionExpModNormal_vv_801;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_802> AgradDistributionExpModNormal_vv_802;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_803> AgradDistributionExpModNormal_vv_803;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_804> AgradDistributionExpModNormal_vv_804;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_805> AgradDistributionExpModNormal_vv_805;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_806> AgradDistributionExpModNormal_vv_806;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_807> AgradDistributionExpModNormal_vv_807;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_808> AgradDistributionExpModNormal_vv_808;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_809> AgradDistributionExpModNormal_vv_809;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_810> AgradDistributionExpModNormal_vv_810;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_811> AgradDistributionExpModNormal_vv_811;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_812> AgradDistributionExpModNormal_vv_812;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_813> AgradDistributionExpModNormal_vv_813;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_814> AgradDistributionExpModNormal_vv_814;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_815> AgradDistributionExpModNormal_vv_815;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_816> AgradDistributionExpModNormal_vv_816;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_817> AgradDistributionExpModNormal_vv_817;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_818> AgradDistributionExpModNormal_vv_818;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_819> AgradDistributionExpModNormal_vv_819;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_820> AgradDistributionExpModNormal_vv_820;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_821> AgradDistributionExpModNormal_vv_821;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_822> AgradDistributionExpModNormal_vv_822;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_823> AgradDistributionExpModNormal_vv_823;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_824> AgradDistributionExpModNormal_vv_824;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_825> AgradDistributionExpModNormal_vv_825;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_826> AgradDistributionExpModNormal_vv_826;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_827> AgradDistributionExpModNormal_vv_827;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_828> AgradDistributionExpModNormal_vv_828;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_829> AgradDistributionExpModNormal_vv_829;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_830> AgradDistributionExpModNormal_vv_830;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_831> AgradDistributionExpModNormal_vv_831;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_832> AgradDistributionExpModNormal_vv_832;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_833> AgradDistributionExpModNormal_vv_833;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_834> AgradDistributionExpModNormal_vv_834;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_835> AgradDistributionExpModNormal_vv_835;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_836> AgradDistributionExpModNormal_vv_836;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_837> AgradDistributionExpModNormal_vv_837;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_838> AgradDistributionExpModNormal_vv_838;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_839> AgradDistributionExpModNormal_vv_839;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_840> AgradDistributionExpModNormal_vv_840;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_841> AgradDistributionExpModNormal_vv_841;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_842> AgradDistributionExpModNormal_vv_842;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_843> AgradDistributionExpModNormal_vv_843;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_844> AgradDistributionExpModNormal_vv_844;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_845> AgradDistributionExpModNormal_vv_845;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_846> AgradDistributionExpModNormal_vv_846;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_847> AgradDistributionExpModNormal_vv_847;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_848> AgradDistributionExpModNormal_vv_848;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_849> AgradDistributionExpModNormal_vv_849;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_850> AgradDistributionExpModNormal_vv_850;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_851> AgradDistributionExpModNormal_vv_851;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_852> AgradDistributionExpModNormal_vv_852;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_853> AgradDistributionExpModNormal_vv_853;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_854> AgradDistributionExpModNormal_vv_854;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_855> AgradDistributionExpModNormal_vv_855;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_856> AgradDistributionExpModNormal_vv_856;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_857> AgradDistributionExpModNormal_vv_857;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_858> AgradDistributionExpModNormal_vv_858;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_859> AgradDistributionExpModNormal_vv_859;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_860> AgradDistributionExpModNormal_vv_860;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_861> AgradDistributionExpModNormal_vv_861;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_862> AgradDistributionExpModNormal_vv_862;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_863> AgradDistributionExpModNormal_vv_863;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_864> AgradDistributionExpModNormal_vv_864;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_865> AgradDistributionExpModNormal_vv_865;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_866> AgradDistributionExpModNormal_vv_866;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_867> AgradDistributionExpModNormal_vv_867;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_868> AgradDistributionExpModNormal_vv_868;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_869> AgradDistributionExpModNormal_vv_869;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_870> AgradDistributionExpModNormal_vv_870;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_871> AgradDistributionExpModNormal_vv_871;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_872> AgradDistributionExpModNormal_vv_872;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_873> AgradDistributionExpModNormal_vv_873;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_874> AgradDistributionExpModNormal_vv_874;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_875> AgradDistributionExpModNormal_vv_875;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_876> AgradDistributionExpModNormal_vv_876;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_877> AgradDistributionExpModNormal_vv_877;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_878> AgradDistributionExpModNormal_vv_878;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_879> AgradDistributionExpModNormal_vv_879;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_880> AgradDistributionExpModNormal_vv_880;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_881> AgradDistributionExpModNormal_vv_881;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_882> AgradDistributionExpModNormal_vv_882;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_883> AgradDistributionExpModNormal_vv_883;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_884> AgradDistributionExpModNormal_vv_884;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_885> AgradDistributionExpModNormal_vv_885;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_886> AgradDistributionExpModNormal_vv_886;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_887> AgradDistributionExpModNormal_vv_887;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_888> AgradDistributionExpModNormal_vv_888;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_889> AgradDistributionExpModNormal_vv_889;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_890> AgradDistributionExpModNormal_vv_890;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_891> AgradDistributionExpModNormal_vv_891;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_892> AgradDistributionExpModNormal_vv_892;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_893> AgradDistributionExpModNormal_vv_893;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_894> AgradDistributionExpModNormal_vv_894;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_895> AgradDistributionExpModNormal_vv_895;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_896> AgradDistributionExpModNormal_vv_896;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_897> AgradDistributionExpModNormal_vv_897;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_898> AgradDistributionExpModNormal_vv_898;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_899> AgradDistributionExpModNormal_vv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_800, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_801, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_802, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_803, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_804, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_805, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_806, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_807, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_808, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_809, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_810, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_811, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_812, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_813, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_814, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_815, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_816, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_817, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_818, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_819, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_820, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_821, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_822, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_823, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_824, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_825, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_826, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_827, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_828, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_829, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_830, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_831, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_832, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_833, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_834, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_835, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_836, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_837, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_838, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_839, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_840, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_841, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_842, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_843, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_844, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_845, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_846, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_847, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_848, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_849, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_850, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_851, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_852, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_853, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_854, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_855, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_856, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_857, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_858, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_859, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_860, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_861, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_862, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_863, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_864, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_865, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_866, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_867, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_868, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_869, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_870, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_871, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_872, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_873, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_874, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_875, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_876, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_877, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_878, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_879, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_880, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_881, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_882, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_883, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_884, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_885, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_886, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_887, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_888, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_889, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_890, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_891, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_892, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_893, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_894, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_895, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_896, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_897, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_898, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_899, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_900;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_901;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_902;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_903;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_904;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_905;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_906;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_907;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_908;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_909;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_910;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_911;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_912;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_913;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_914;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_915;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_916;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_917;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_918;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_919;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_920;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_921;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_922;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_923;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_924;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_925;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_926;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_927;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_928;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_929;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_930;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_931;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_932;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_933;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_934;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_935;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_936;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_937;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_938;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_939;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_940;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_941;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_942;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_943;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_944;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_945;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_946;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_947;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_948;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_949;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_950;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_951;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_952;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_953;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_954;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_955;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_956;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_957;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_958;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_959;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_960;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_961;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_962;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_963;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_964;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_965;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_966;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_967;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_968;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_969;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_970;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_971;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_972;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_973;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_974;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_975;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_976;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_977;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_978;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_979;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_980;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_981;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_982;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_983;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_984;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_985;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_986;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_987;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_988;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_989;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_990;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_991;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_992;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_993;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_994;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_995;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_996;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_997;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_998;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_ffv_999;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_900> AgradDistributionExpModNormal_ffv_900;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_901> AgradDistributionExpModNormal_ffv_901;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_902> AgradDistributionExpModNormal_ffv_902;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_903> AgradDistributionExpModNormal_ffv_903;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_904> AgradDistributionExpModNormal_ffv_904;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_905> AgradDistributionExpModNormal_ffv_905;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_906> AgradDistributionExpModNormal_ffv_906;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_907> AgradDistributionExpModNormal_ffv_907;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_908> AgradDistributionExpModNormal_ffv_908;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_909> AgradDistributionExpModNormal_ffv_909;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_910> AgradDistributionExpModNormal_ffv_910;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_911> AgradDistributionExpModNormal_ffv_911;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_912> AgradDistributionExpModNormal_ffv_912;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_913> AgradDistributionExpModNormal_ffv_913;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_914> AgradDistributionExpModNormal_ffv_914;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_915> AgradDistributionExpModNormal_ffv_915;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_916> AgradDistributionExpModNormal_ffv_916;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_917> AgradDistributionExpModNormal_ffv_917;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_918> AgradDistributionExpModNormal_ffv_918;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_919> AgradDistributionExpModNormal_ffv_919;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_920> AgradDistributionExpModNormal_ffv_920;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_921> AgradDistributionExpModNormal_ffv_921;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_922> AgradDistributionExpModNormal_ffv_922;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_923> AgradDistributionExpModNormal_ffv_923;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_924> AgradDistributionExpModNormal_ffv_924;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_925> AgradDistributionExpModNormal_ffv_925;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_926> AgradDistributionExpModNormal_ffv_926;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_927> AgradDistributionExpModNormal_ffv_927;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_928> AgradDistributionExpModNormal_ffv_928;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_929> AgradDistributionExpModNormal_ffv_929;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_930> AgradDistributionExpModNormal_ffv_930;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_931> AgradDistributionExpModNormal_ffv_931;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_932> AgradDistributionExpModNormal_ffv_932;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_933> AgradDistributionExpModNormal_ffv_933;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_934> AgradDistributionExpModNormal_ffv_934;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_935> AgradDistributionExpModNormal_ffv_935;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_936> AgradDistributionExpModNormal_ffv_936;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_937> AgradDistributionExpModNormal_ffv_937;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_938> AgradDistributionExpModNormal_ffv_938;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_939> AgradDistributionExpModNormal_ffv_939;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_940> AgradDistributionExpModNormal_ffv_940;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_941> AgradDistributionExpModNormal_ffv_941;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_942> AgradDistributionExpModNormal_ffv_942;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_943> AgradDistributionExpModNormal_ffv_943;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_944> AgradDistributionExpModNormal_ffv_944;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_945> AgradDistributionExpModNormal_ffv_945;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_946> AgradDistributionExpModNormal_ffv_946;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_947> AgradDistributionExpModNormal_ffv_947;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_948> AgradDistributionExpModNormal_ffv_948;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_949> AgradDistributionExpModNormal_ffv_949;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_950> AgradDistributionExpModNormal_ffv_950;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_951> AgradDistributionExpModNormal_ffv_951;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_952> AgradDistributionExpModNormal_ffv_952;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_953> AgradDistributionExpModNormal_ffv_953;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_954> AgradDistributionExpModNormal_ffv_954;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_955> AgradDistributionExpModNormal_ffv_955;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_956> AgradDistributionExpModNormal_ffv_956;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_957> AgradDistributionExpModNormal_ffv_957;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_958> AgradDistributionExpModNormal_ffv_958;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_959> AgradDistributionExpModNormal_ffv_959;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_960> AgradDistributionExpModNormal_ffv_960;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_961> AgradDistributionExpModNormal_ffv_961;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_962> AgradDistributionExpModNormal_ffv_962;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_963> AgradDistributionExpModNormal_ffv_963;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_964> AgradDistributionExpModNormal_ffv_964;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_965> AgradDistributionExpModNormal_ffv_965;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_966> AgradDistributionExpModNormal_ffv_966;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_967> AgradDistributionExpModNormal_ffv_967;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_968> AgradDistributionExpModNormal_ffv_968;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_969> AgradDistributionExpModNormal_ffv_969;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_970> AgradDistributionExpModNormal_ffv_970;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_971> AgradDistributionExpModNormal_ffv_971;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_972> AgradDistributionExpModNormal_ffv_972;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_973> AgradDistributionExpModNormal_ffv_973;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_974> AgradDistributionExpModNormal_ffv_974;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_975> AgradDistributionExpModNormal_ffv_975;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_976> AgradDistributionExpModNormal_ffv_976;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_977> AgradDistributionExpModNormal_ffv_977;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_978> AgradDistributionExpModNormal_ffv_978;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_979> AgradDistributionExpModNormal_ffv_979;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_980> AgradDistributionExpModNormal_ffv_980;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_981> AgradDistributionExpModNormal_ffv_981;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_982> AgradDistributionExpModNormal_ffv_982;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_983> AgradDistributionExpModNormal_ffv_983;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_984> AgradDistributionExpModNormal_ffv_984;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_985> AgradDistributionExpModNormal_ffv_985;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_986> AgradDistributionExpModNormal_ffv_986;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_987> AgradDistributionExpModNormal_ffv_987;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_988> AgradDistributionExpModNormal_ffv_988;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_989> AgradDistributionExpModNormal_ffv_989;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_990> AgradDistributionExpModNormal_ffv_990;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_991> AgradDistributionExpModNormal_ffv_991;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_992> AgradDistributionExpModNormal_ffv_992;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_993> AgradDistributionExpModNormal_ffv_993;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_994> AgradDistributionExpModNormal_ffv_994;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_995> AgradDistributionExpModNormal_ffv_995;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_996> AgradDistributionExpModNormal_ffv_996;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_997> AgradDistributionExpModNormal_ffv_997;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_998> AgradDistributionExpModNormal_ffv_998;
+typedef std::tuple<AgradDistributionExpModNormal, type_ffv_999> AgradDistributionExpModNormal_ffv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_900, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_901, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_902, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_903, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_904, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_905, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_906, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_907, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_908, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_909, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_910, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_911, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_912, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_913, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_914, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_915, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_916, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_917, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_918, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_919, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_920, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_921, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_922, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_923, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_924, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_925, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_926, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_927, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_928, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_929, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_930, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_931, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_932, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_933, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_934, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_935, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_936, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_937, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_938, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_939, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_940, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_941, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_942, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_943, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_944, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_945, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_946, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_947, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_948, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_949, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_950, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_951, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_952, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_953, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_954, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_955, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_956, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_957, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_958, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_959, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_960, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_961, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_962, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_963, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_964, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_965, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_966, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_967, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_968, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_969, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_970, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_971, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_972, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_973, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_974, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_975, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_976, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_977, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_978, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_979, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_980, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_981, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_982, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_983, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_984, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_985, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_986, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_987, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_988, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_989, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_990, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_991, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_992, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_993, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_994, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_995, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_996, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_997, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_998, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_ffv_999, AgradDistributionTestFixture, AgradDistributionExpModNormal_ffv_999);
+
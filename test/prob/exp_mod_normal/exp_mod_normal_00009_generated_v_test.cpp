@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_v_900;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_901;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_902;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_v_903;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_904;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_905;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_906;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_907;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_908;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_909;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_910;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_911;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_912;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_913;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_914;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_915;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_916;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_917;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_v_918;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_919;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_920;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_v_921;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_922;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_923;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_924;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_925;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_926;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_927;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_928;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_929;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_930;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_931;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_932;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_933;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_934;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_935;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_936;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_937;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_938;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_939;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_940;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_941;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_942;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_943;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_944;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_945;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_946;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_947;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_948;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_949;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_950;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_951;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_952;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_953;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_954;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_955;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_956;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_957;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_958;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_959;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_960;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_961;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_962;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_963;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_964;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_965;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_966;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_967;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_968;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_969;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_970;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_971;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_v_972;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_v_973;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_974;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_v_975;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_v_976;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_977;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_v_978;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_979;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_980;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_v_981;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_982;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_983;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_984;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_985;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_986;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_987;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_988;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_989;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_v_990;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_v_991;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_992;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_v_993;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_v_994;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_995;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_v_996;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_997;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_998;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_v_999;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_900> AgradDistributionExpModNormal_v_900;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_901> AgradDistributionExpModNormal_v_901;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_902> AgradDistributionExpModNormal_v_902;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_903> AgradDistributionExpModNormal_v_903;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_904> AgradDistributionExpModNormal_v_904;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_905> AgradDistributionExpModNormal_v_905;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_906> AgradDistributionExpModNormal_v_906;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_907> AgradDistributionExpModNormal_v_907;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_908> AgradDistributionExpModNormal_v_908;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_909> AgradDistributionExpModNormal_v_909;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_910> AgradDistributionExpModNormal_v_910;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_911> AgradDistributionExpModNormal_v_911;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_912> AgradDistributionExpModNormal_v_912;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_913> AgradDistributionExpModNormal_v_913;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_914> AgradDistributionExpModNormal_v_914;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_915> AgradDistributionExpModNormal_v_915;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_916> AgradDistributionExpModNormal_v_916;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_917> AgradDistributionExpModNormal_v_917;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_918> AgradDistributionExpModNormal_v_918;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_919> AgradDistributionExpModNormal_v_919;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_920> AgradDistributionExpModNormal_v_920;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_921> AgradDistributionExpModNormal_v_921;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_922> AgradDistributionExpModNormal_v_922;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_923> AgradDistributionExpModNormal_v_923;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_924> AgradDistributionExpModNormal_v_924;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_925> AgradDistributionExpModNormal_v_925;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_926> AgradDistributionExpModNormal_v_926;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_927> AgradDistributionExpModNormal_v_927;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_928> AgradDistributionExpModNormal_v_928;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_929> AgradDistributionExpModNormal_v_929;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_930> AgradDistributionExpModNormal_v_930;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_931> AgradDistributionExpModNormal_v_931;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_932> AgradDistributionExpModNormal_v_932;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_933> AgradDistributionExpModNormal_v_933;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_934> AgradDistributionExpModNormal_v_934;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_935> AgradDistributionExpModNormal_v_935;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_936> AgradDistributionExpModNormal_v_936;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_937> AgradDistributionExpModNormal_v_937;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_938> AgradDistributionExpModNormal_v_938;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_939> AgradDistributionExpModNormal_v_939;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_940> AgradDistributionExpModNormal_v_940;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_941> AgradDistributionExpModNormal_v_941;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_942> AgradDistributionExpModNormal_v_942;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_943> AgradDistributionExpModNormal_v_943;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_944> AgradDistributionExpModNormal_v_944;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_945> AgradDistributionExpModNormal_v_945;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_946> AgradDistributionExpModNormal_v_946;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_947> AgradDistributionExpModNormal_v_947;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_948> AgradDistributionExpModNormal_v_948;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_949> AgradDistributionExpModNormal_v_949;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_950> AgradDistributionExpModNormal_v_950;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_951> AgradDistributionExpModNormal_v_951;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_952> AgradDistributionExpModNormal_v_952;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_953> AgradDistributionExpModNormal_v_953;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_954> AgradDistributionExpModNormal_v_954;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_955> AgradDistributionExpModNormal_v_955;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_956> AgradDistributionExpModNormal_v_956;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_957> AgradDistributionExpModNormal_v_957;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_958> AgradDistributionExpModNormal_v_958;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_959> AgradDistributionExpModNormal_v_959;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_960> AgradDistributionExpModNormal_v_960;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_961> AgradDistributionExpModNormal_v_961;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_962> AgradDistributionExpModNormal_v_962;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_963> AgradDistributionExpModNormal_v_963;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_964> AgradDistributionExpModNormal_v_964;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_965> AgradDistributionExpModNormal_v_965;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_966> AgradDistributionExpModNormal_v_966;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_967> AgradDistributionExpModNormal_v_967;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_968> AgradDistributionExpModNormal_v_968;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_969> AgradDistributionExpModNormal_v_969;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_970> AgradDistributionExpModNormal_v_970;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_971> AgradDistributionExpModNormal_v_971;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_972> AgradDistributionExpModNormal_v_972;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_973> AgradDistributionExpModNormal_v_973;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_974> AgradDistributionExpModNormal_v_974;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_975> AgradDistributionExpModNormal_v_975;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_976> AgradDistributionExpModNormal_v_976;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_977> AgradDistributionExpModNormal_v_977;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_978> AgradDistributionExpModNormal_v_978;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_979> AgradDistributionExpModNormal_v_979;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_980> AgradDistributionExpModNormal_v_980;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_981> AgradDistributionExpModNormal_v_981;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_982> AgradDistributionExpModNormal_v_982;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_983> AgradDistributionExpModNormal_v_983;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_984> AgradDistributionExpModNormal_v_984;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_985> AgradDistributionExpModNormal_v_985;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_986> AgradDistributionExpModNormal_v_986;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_987> AgradDistributionExpModNormal_v_987;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_988> AgradDistributionExpModNormal_v_988;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_989> AgradDistributionExpModNormal_v_989;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_990> AgradDistributionExpModNormal_v_990;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_991> AgradDistributionExpModNormal_v_991;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_992> AgradDistributionExpModNormal_v_992;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_993> AgradDistributionExpModNormal_v_993;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_994> AgradDistributionExpModNormal_v_994;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_995> AgradDistributionExpModNormal_v_995;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_996> AgradDistributionExpModNormal_v_996;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_997> AgradDistributionExpModNormal_v_997;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_998> AgradDistributionExpModNormal_v_998;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_999> AgradDistributionExpModNormal_v_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_900, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_901, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_902, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_903, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_904, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_905, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_906, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_907, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_908, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_909, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_910, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_911, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_912, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_913, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_914, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_915, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_916, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_917, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_918, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_919, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_920, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_921, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_922, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_923, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_924, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_925, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_926, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_927, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_928, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_929, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_930, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_931, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_932, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_933, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_934, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_935, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_936, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_937, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_938, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_939, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_940, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_941, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_942, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_943, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_944, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_945, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_946, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_947, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_948, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_949, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_950, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_951, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_952, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_953, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_954, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_955, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_956, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_957, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_958, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_959, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_960, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_961, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_962, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_963, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_964, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_965, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_966, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_967, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_968, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_969, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_970, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_971, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_972, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_973, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_974, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_975, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_976, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_977, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_978, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_979, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_980, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_981, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_982, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_983, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_984, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_985, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_986, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_987, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_988, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_989, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_990, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_991, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_992, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_993, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_994, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_995, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_996, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_997, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_998, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_999, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_vv_900;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_901;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_902;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_903;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_904;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_905;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_906;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_907;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_908;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_vv_909;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_vv_910;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_911;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_vv_912;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_vv_913;
+typedef std::tuple<std::vector<var>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_914;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_vv_915;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_916;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_917;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_vv_918;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_919;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_920;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_921;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_922;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_923;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_924;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_925;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_926;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_vv_927;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_928;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_929;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_vv_930;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_931;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_932;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_933;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_934;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_935;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_936;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_937;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_938;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_939;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_940;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_941;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_942;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_943;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_944;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_vv_945;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_946;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_947;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_vv_948;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_949;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_950;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_951;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_952;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_953;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_954;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_955;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_956;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_957;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_958;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_959;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_960;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_961;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_962;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_963;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_964;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_965;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_966;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_967;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_968;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_969;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_970;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_971;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_972;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_973;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_974;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_975;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_976;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_977;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_978;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_979;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_980;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_981;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_982;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_983;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_984;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_985;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_986;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_987;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_988;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_989;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_990;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_991;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_992;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_993;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_994;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_995;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_996;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_997;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_998;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, double, empty, empty> type_vv_999;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_900> AgradDistributionExpModNormal_vv_900;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_901> AgradDistributionExpModNormal_vv_901;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_902> AgradDistributionExpModNormal_vv_902;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_903> AgradDistributionExpModNormal_vv_903;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_904> AgradDistributionExpModNormal_vv_904;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_905> AgradDistributionExpModNormal_vv_905;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_906> AgradDistributionExpModNormal_vv_906;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_907> AgradDistributionExpModNormal_vv_907;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_908> AgradDistributionExpModNormal_vv_908;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_909> AgradDistributionExpModNormal_vv_909;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_910> AgradDistributionExpModNormal_vv_910;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_911> AgradDistributionExpModNormal_vv_911;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_912> AgradDistributionExpModNormal_vv_912;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_913> AgradDistributionExpModNormal_vv_913;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_914> AgradDistributionExpModNormal_vv_914;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_915> AgradDistributionExpModNormal_vv_915;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_916> AgradDistributionExpModNormal_vv_916;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_917> AgradDistributionExpModNormal_vv_917;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_918> AgradDistributionExpModNormal_vv_918;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_919> AgradDistributionExpModNormal_vv_919;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_920> AgradDistributionExpModNormal_vv_920;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_921> AgradDistributionExpModNormal_vv_921;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_922> AgradDistributionExpModNormal_vv_922;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_923> AgradDistributionExpModNormal_vv_923;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_924> AgradDistributionExpModNormal_vv_924;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_925> AgradDistributionExpModNormal_vv_925;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_926> AgradDistributionExpModNormal_vv_926;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_927> AgradDistributionExpModNormal_vv_927;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_928> AgradDistributionExpModNormal_vv_928;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_929> AgradDistributionExpModNormal_vv_929;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_930> AgradDistributionExpModNormal_vv_930;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_931> AgradDistributionExpModNormal_vv_931;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_932> AgradDistributionExpModNormal_vv_932;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_933> AgradDistributionExpModNormal_vv_933;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_934> AgradDistributionExpModNormal_vv_934;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_935> AgradDistributionExpModNormal_vv_935;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_936> AgradDistributionExpModNormal_vv_936;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_937> AgradDistributionExpModNormal_vv_937;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_938> AgradDistributionExpModNormal_vv_938;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_939> AgradDistributionExpModNormal_vv_939;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_940> AgradDistributionExpModNormal_vv_940;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_941> AgradDistributionExpModNormal_vv_941;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_942> AgradDistributionExpModNormal_vv_942;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_943> AgradDistributionExpModNormal_vv_943;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_944> AgradDistributionExpModNormal_vv_944;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_945> AgradDistributionExpModNormal_vv_945;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_946> AgradDistributionExpModNormal_vv_946;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_947> AgradDistributionExpModNormal_vv_947;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_948> AgradDistributionExpModNormal_vv_948;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_949> AgradDistributionExpModNormal_vv_949;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_950> AgradDistributionExpModNormal_vv_950;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_951> AgradDistributionExpModNormal_vv_951;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_952> AgradDistributionExpModNormal_vv_952;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_953> AgradDistributionExpModNormal_vv_953;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_954> AgradDistributionExpModNormal_vv_954;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_955> AgradDistributionExpModNormal_vv_955;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_956> AgradDistributionExpModNormal_vv_956;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_957> AgradDistributionExpModNormal_vv_957;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_958> AgradDistributionExpModNormal_vv_958;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_959> AgradDistributionExpModNormal_vv_959;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_960> AgradDistributionExpModNormal_vv_960;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_961> AgradDistributionExpModNormal_vv_961;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_962> AgradDistributionExpModNormal_vv_962;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_963> AgradDistributionExpModNormal_vv_963;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_964> AgradDistributionExpModNormal_vv_964;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_965> AgradDistributionExpModNormal_vv_965;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_966> AgradDistributionExpModNormal_vv_966;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_967> AgradDistributionExpModNormal_vv_967;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_968> AgradDistributionExpModNormal_vv_968;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_969> AgradDistributionExpModNormal_vv_969;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_970> AgradDistributionExpModNormal_vv_970;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_971> AgradDistributionExpModNormal_vv_971;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_972> AgradDistributionExpModNormal_vv_972;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_973> AgradDistributionExpModNormal_vv_973;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_974> AgradDistributionExpModNormal_vv_974;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_975> AgradDistributionExpModNormal_vv_975;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_976> AgradDistributionExpModNormal_vv_976;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_977> AgradDistributionExpModNormal_vv_977;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_978> AgradDistributionExpModNormal_vv_978;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_979> AgradDistributionExpModNormal_vv_979;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_980> AgradDistributionExpModNormal_vv_980;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_981> AgradDistributionExpModNormal_vv_981;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_982> AgradDistributionExpModNormal_vv_982;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_983> AgradDistributionExpModNormal_vv_983;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_984> AgradDistributionExpModNormal_vv_984;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_985> AgradDistributionExpModNormal_vv_985;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_986> AgradDistributionExpModNormal_vv_986;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_987> AgradDistributionExpModNormal_vv_987;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_988> AgradDistributionExpModNormal_vv_988;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_989> AgradDistributionExpModNormal_vv_989;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_990> AgradDistributionExpModNormal_vv_990;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_991> AgradDistributionExpModNormal_vv_991;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_992> AgradDistributionExpModNormal_vv_992;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_993> AgradDistributionExpModNormal_vv_993;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_994> AgradDistributionExpModNormal_vv_994;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_995> AgradDistributionExpModNormal_vv_995;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_996> AgradDistributionExpModNormal_vv_996;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_997> AgradDistributionExpModNormal_vv_997;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_998> AgradDistributionExpModNormal_vv_998;
+typedef std::tuple<AgradDistributionExpModNormal, type_vv_999> AgradDistributionExpModNormal_vv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_900, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_901, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_902, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_903, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_904, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_905, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_906, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_907, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_908, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_909, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_910, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_911, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_912, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_913, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_914, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_915, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_916, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_917, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_918, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_919, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_920, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_921, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_922, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_923, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_924, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_925, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_926, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_927, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_928, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_929, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_930, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_931, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_932, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_933, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_934, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_935, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_936, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_937, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_938, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_939, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_940, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_941, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_942, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_943, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_944, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_945, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_946, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_947, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_948, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_949, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_950, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_951, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_952, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_953, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_954, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_955, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_956, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_957, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_958, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_959, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_960, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_961, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_962, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_963, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_964, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_965, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_966, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_967, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_968, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_969, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_970, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_971, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_972, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_973, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_974, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_975, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_976, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_977, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_978, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_979, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_980, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_981, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_982, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_983, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_984, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_985, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_986, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_987, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_988, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_989, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_990, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_991, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_992, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_993, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_994, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_995, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_996, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_997, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_998, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_vv_999, AgradDistributionTestFixture, AgradDistributionExpModNormal_vv_999);
+
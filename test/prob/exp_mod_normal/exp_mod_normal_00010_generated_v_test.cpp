@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_1000;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1001;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1002;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1003;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1004;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1005;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1006;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1007;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_v_1008;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_1009;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1010;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_v_1011;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_1012;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1013;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_1014;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_1015;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1016;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_1017;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_1018;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1019;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1020;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1021;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1022;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1023;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1024;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1025;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_v_1026;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_1027;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1028;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_v_1029;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_1030;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1031;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_1032;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_1033;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1034;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_1035;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_1036;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1037;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1038;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1039;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1040;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1041;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1042;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1043;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1044;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1045;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1046;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1047;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1048;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1049;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1050;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1051;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1052;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1053;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1054;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1055;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1056;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1057;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1058;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1059;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1060;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1061;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1062;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1063;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1064;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1065;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1066;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1067;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1068;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1069;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1070;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1071;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1072;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1073;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1074;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1075;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1076;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1077;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1078;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1079;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_1080;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_1081;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1082;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_1083;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_1084;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1085;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_1086;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_1087;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1088;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_1089;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_1090;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1091;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1092;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1093;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1094;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1095;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1096;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1097;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_1098;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_1099;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1000> AgradDistributionExpModNormal_v_1000;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1001> AgradDistributionExpModNormal_v_1001;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1002> AgradDistributionExpModNormal_v_1002;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1003> AgradDistributionExpModNormal_v_1003;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1004> AgradDistributionExpModNormal_v_1004;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1005> AgradDistributionExpModNormal_v_1005;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1006> AgradDistributionExpModNormal_v_1006;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1007> AgradDistributionExpModNormal_v_1007;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1008> AgradDistributionExpModNormal_v_1008;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1009> AgradDistributionExpModNormal_v_1009;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1010> AgradDistributionExpModNormal_v_1010;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1011> AgradDistributionExpModNormal_v_1011;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1012> AgradDistributionExpModNormal_v_1012;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1013> AgradDistributionExpModNormal_v_1013;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1014> AgradDistributionExpModNormal_v_1014;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1015> AgradDistributionExpModNormal_v_1015;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1016> AgradDistributionExpModNormal_v_1016;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1017> AgradDistributionExpModNormal_v_1017;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1018> AgradDistributionExpModNormal_v_1018;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1019> AgradDistributionExpModNormal_v_1019;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1020> AgradDistributionExpModNormal_v_1020;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1021> AgradDistributionExpModNormal_v_1021;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1022> AgradDistributionExpModNormal_v_1022;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1023> AgradDistributionExpModNormal_v_1023;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1024> AgradDistributionExpModNormal_v_1024;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1025> AgradDistributionExpModNormal_v_1025;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1026> AgradDistributionExpModNormal_v_1026;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1027> AgradDistributionExpModNormal_v_1027;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1028> AgradDistributionExpModNormal_v_1028;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1029> AgradDistributionExpModNormal_v_1029;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1030> AgradDistributionExpModNormal_v_1030;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1031> AgradDistributionExpModNormal_v_1031;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1032> AgradDistributionExpModNormal_v_1032;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1033> AgradDistributionExpModNormal_v_1033;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1034> AgradDistributionExpModNormal_v_1034;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1035> AgradDistributionExpModNormal_v_1035;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1036> AgradDistributionExpModNormal_v_1036;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1037> AgradDistributionExpModNormal_v_1037;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1038> AgradDistributionExpModNormal_v_1038;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1039> AgradDistributionExpModNormal_v_1039;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1040> AgradDistributionExpModNormal_v_1040;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1041> AgradDistributionExpModNormal_v_1041;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1042> AgradDistributionExpModNormal_v_1042;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1043> AgradDistributionExpModNormal_v_1043;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1044> AgradDistributionExpModNormal_v_1044;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1045> AgradDistributionExpModNormal_v_1045;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1046> AgradDistributionExpModNormal_v_1046;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1047> AgradDistributionExpModNormal_v_1047;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1048> AgradDistributionExpModNormal_v_1048;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1049> AgradDistributionExpModNormal_v_1049;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1050> AgradDistributionExpModNormal_v_1050;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1051> AgradDistributionExpModNormal_v_1051;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1052> AgradDistributionExpModNormal_v_1052;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1053> AgradDistributionExpModNormal_v_1053;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1054> AgradDistributionExpModNormal_v_1054;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1055> AgradDistributionExpModNormal_v_1055;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1056> AgradDistributionExpModNormal_v_1056;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1057> AgradDistributionExpModNormal_v_1057;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1058> AgradDistributionExpModNormal_v_1058;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1059> AgradDistributionExpModNormal_v_1059;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1060> AgradDistributionExpModNormal_v_1060;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1061> AgradDistributionExpModNormal_v_1061;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1062> AgradDistributionExpModNormal_v_1062;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1063> AgradDistributionExpModNormal_v_1063;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1064> AgradDistributionExpModNormal_v_1064;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1065> AgradDistributionExpModNormal_v_1065;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1066> AgradDistributionExpModNormal_v_1066;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1067> AgradDistributionExpModNormal_v_1067;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1068> AgradDistributionExpModNormal_v_1068;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1069> AgradDistributionExpModNormal_v_1069;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1070> AgradDistributionExpModNormal_v_1070;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1071> AgradDistributionExpModNormal_v_1071;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1072> AgradDistributionExpModNormal_v_1072;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1073> AgradDistributionExpModNormal_v_1073;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1074> AgradDistributionExpModNormal_v_1074;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1075> AgradDistributionExpModNormal_v_1075;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1076> AgradDistributionExpModNormal_v_1076;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1077> AgradDistributionExpModNormal_v_1077;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1078> AgradDistributionExpModNormal_v_1078;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1079> AgradDistributionExpModNormal_v_1079;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1080> AgradDistributionExpModNormal_v_1080;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1081> AgradDistributionExpModNormal_v_1081;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1082> AgradDistributionExpModNormal_v_1082;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1083> AgradDistributionExpModNormal_v_1083;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1084> AgradDistributionExpModNormal_v_1084;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1085> AgradDistributionExpModNormal_v_1085;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1086> AgradDistributionExpModNormal_v_1086;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1087> AgradDistributionExpModNormal_v_1087;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1088> AgradDistributionExpModNormal_v_1088;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1089> AgradDistributionExpModNormal_v_1089;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1090> AgradDistributionExpModNormal_v_1090;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1091> AgradDistributionExpModNormal_v_1091;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1092> AgradDistributionExpModNormal_v_1092;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1093> AgradDistributionExpModNormal_v_1093;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1094> AgradDistributionExpModNormal_v_1094;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1095> AgradDistributionExpModNormal_v_1095;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1096> AgradDistributionExpModNormal_v_1096;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1097> AgradDistributionExpModNormal_v_1097;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1098> AgradDistributionExpModNormal_v_1098;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1099> AgradDistributionExpModNormal_v_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1000, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1001, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1002, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1003, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1004, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1005, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1006, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1007, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1008, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1009, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1010, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1011, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1012, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1013, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1014, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1015, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1016, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1017, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1018, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1019, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1020, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1021, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1022, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1023, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1024, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1025, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1026, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1027, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1028, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1029, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1030, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1031, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1032, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1033, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1034, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1035, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1036, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1037, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1038, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1039, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1040, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1041, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1042, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1043, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1044, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1045, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1046, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1047, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1048, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1049, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1050, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1051, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1052, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1053, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1054, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1055, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1056, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1057, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1058, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1059, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1060, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1061, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1062, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1063, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1064, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1065, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1066, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1067, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1068, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1069, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1070, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1071, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1072, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1073, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1074, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1075, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1076, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1077, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1078, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1079, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1080, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1081, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1082, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1083, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1084, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1085, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1086, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1087, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1088, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1089, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1090, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1091, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1092, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1093, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1094, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1095, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1096, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1097, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1098, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1099, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1099);
+
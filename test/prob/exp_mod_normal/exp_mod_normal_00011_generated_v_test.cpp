@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1100;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_1101;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_1102;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1103;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_1104;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_1105;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1106;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_1107;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_1108;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1109;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1110;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1111;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1112;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1113;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1114;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1115;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_1116;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_1117;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1118;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_1119;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_1120;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1121;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_1122;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_1123;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1124;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_1125;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_1126;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1127;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1128;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1129;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1130;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1131;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1132;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1133;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_1134;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_1135;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1136;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_1137;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_1138;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1139;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_1140;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_1141;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1142;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_1143;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_1144;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1145;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1146;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1147;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1148;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1149;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1150;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1151;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1152;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1153;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1154;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1155;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1156;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1157;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1158;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1159;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1160;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1161;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1162;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1163;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1164;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1165;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1166;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1167;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1168;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1169;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1170;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1171;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1172;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1173;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1174;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1175;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1176;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1177;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1178;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_1188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_1189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_1191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_1192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_1194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_1195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_1197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_1198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1199;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1100> AgradDistributionExpModNormal_v_1100;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1101> AgradDistributionExpModNormal_v_1101;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1102> AgradDistributionExpModNormal_v_1102;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1103> AgradDistributionExpModNormal_v_1103;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1104> AgradDistributionExpModNormal_v_1104;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1105> AgradDistributionExpModNormal_v_1105;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1106> AgradDistributionExpModNormal_v_1106;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1107> AgradDistributionExpModNormal_v_1107;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1108> AgradDistributionExpModNormal_v_1108;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1109> AgradDistributionExpModNormal_v_1109;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1110> AgradDistributionExpModNormal_v_1110;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1111> AgradDistributionExpModNormal_v_1111;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1112> AgradDistributionExpModNormal_v_1112;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1113> AgradDistributionExpModNormal_v_1113;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1114> AgradDistributionExpModNormal_v_1114;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1115> AgradDistributionExpModNormal_v_1115;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1116> AgradDistributionExpModNormal_v_1116;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1117> AgradDistributionExpModNormal_v_1117;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1118> AgradDistributionExpModNormal_v_1118;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1119> AgradDistributionExpModNormal_v_1119;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1120> AgradDistributionExpModNormal_v_1120;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1121> AgradDistributionExpModNormal_v_1121;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1122> AgradDistributionExpModNormal_v_1122;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1123> AgradDistributionExpModNormal_v_1123;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1124> AgradDistributionExpModNormal_v_1124;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1125> AgradDistributionExpModNormal_v_1125;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1126> AgradDistributionExpModNormal_v_1126;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1127> AgradDistributionExpModNormal_v_1127;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1128> AgradDistributionExpModNormal_v_1128;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1129> AgradDistributionExpModNormal_v_1129;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1130> AgradDistributionExpModNormal_v_1130;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1131> AgradDistributionExpModNormal_v_1131;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1132> AgradDistributionExpModNormal_v_1132;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1133> AgradDistributionExpModNormal_v_1133;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1134> AgradDistributionExpModNormal_v_1134;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1135> AgradDistributionExpModNormal_v_1135;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1136> AgradDistributionExpModNormal_v_1136;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1137> AgradDistributionExpModNormal_v_1137;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1138> AgradDistributionExpModNormal_v_1138;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1139> AgradDistributionExpModNormal_v_1139;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1140> AgradDistributionExpModNormal_v_1140;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1141> AgradDistributionExpModNormal_v_1141;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1142> AgradDistributionExpModNormal_v_1142;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1143> AgradDistributionExpModNormal_v_1143;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1144> AgradDistributionExpModNormal_v_1144;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1145> AgradDistributionExpModNormal_v_1145;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1146> AgradDistributionExpModNormal_v_1146;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1147> AgradDistributionExpModNormal_v_1147;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1148> AgradDistributionExpModNormal_v_1148;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1149> AgradDistributionExpModNormal_v_1149;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1150> AgradDistributionExpModNormal_v_1150;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1151> AgradDistributionExpModNormal_v_1151;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1152> AgradDistributionExpModNormal_v_1152;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1153> AgradDistributionExpModNormal_v_1153;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1154> AgradDistributionExpModNormal_v_1154;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1155> AgradDistributionExpModNormal_v_1155;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1156> AgradDistributionExpModNormal_v_1156;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1157> AgradDistributionExpModNormal_v_1157;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1158> AgradDistributionExpModNormal_v_1158;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1159> AgradDistributionExpModNormal_v_1159;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1160> AgradDistributionExpModNormal_v_1160;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1161> AgradDistributionExpModNormal_v_1161;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1162> AgradDistributionExpModNormal_v_1162;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1163> AgradDistributionExpModNormal_v_1163;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1164> AgradDistributionExpModNormal_v_1164;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1165> AgradDistributionExpModNormal_v_1165;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1166> AgradDistributionExpModNormal_v_1166;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1167> AgradDistributionExpModNormal_v_1167;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1168> AgradDistributionExpModNormal_v_1168;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1169> AgradDistributionExpModNormal_v_1169;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1170> AgradDistributionExpModNormal_v_1170;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1171> AgradDistributionExpModNormal_v_1171;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1172> AgradDistributionExpModNormal_v_1172;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1173> AgradDistributionExpModNormal_v_1173;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1174> AgradDistributionExpModNormal_v_1174;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1175> AgradDistributionExpModNormal_v_1175;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1176> AgradDistributionExpModNormal_v_1176;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1177> AgradDistributionExpModNormal_v_1177;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1178> AgradDistributionExpModNormal_v_1178;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1179> AgradDistributionExpModNormal_v_1179;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1180> AgradDistributionExpModNormal_v_1180;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1181> AgradDistributionExpModNormal_v_1181;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1182> AgradDistributionExpModNormal_v_1182;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1183> AgradDistributionExpModNormal_v_1183;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1184> AgradDistributionExpModNormal_v_1184;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1185> AgradDistributionExpModNormal_v_1185;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1186> AgradDistributionExpModNormal_v_1186;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1187> AgradDistributionExpModNormal_v_1187;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1188> AgradDistributionExpModNormal_v_1188;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1189> AgradDistributionExpModNormal_v_1189;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1190> AgradDistributionExpModNormal_v_1190;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1191> AgradDistributionExpModNormal_v_1191;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1192> AgradDistributionExpModNormal_v_1192;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1193> AgradDistributionExpModNormal_v_1193;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1194> AgradDistributionExpModNormal_v_1194;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1195> AgradDistributionExpModNormal_v_1195;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1196> AgradDistributionExpModNormal_v_1196;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1197> AgradDistributionExpModNormal_v_1197;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1198> AgradDistributionExpModNormal_v_1198;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1199> AgradDistributionExpModNormal_v_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1100, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1101, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1102, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1103, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1104, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1105, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1106, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1107, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1108, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1109, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1110, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1111, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1112, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1113, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1114, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1115, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1116, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1117, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1118, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1119, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1120, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1121, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1122, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1123, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1124, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1125, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1126, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1127, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1128, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1129, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1130, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1131, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1132, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1133, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1134, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1135, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1136, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1137, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1138, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1139, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1140, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1141, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1142, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1143, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1144, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1145, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1146, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1147, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1148, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1149, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1150, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1151, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1152, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1153, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1154, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1155, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1156, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1157, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1158, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1159, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1160, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1161, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1162, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1163, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1164, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1165, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1166, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1167, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1168, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1169, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1170, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1171, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1172, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1173, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1174, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1175, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1176, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1177, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1178, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1179, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1180, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1181, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1182, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1183, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1184, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1185, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1186, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1187, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1188, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1189, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1190, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1191, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1192, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1193, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1194, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1195, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1196, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1197, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1198, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1199, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1199);
+
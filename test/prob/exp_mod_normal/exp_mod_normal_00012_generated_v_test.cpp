@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_1206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_1207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_1209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_1210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_1212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_1213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_1215;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_1216;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1217;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1218;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1219;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1220;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1221;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1222;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1223;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_1224;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_1225;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1226;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_1227;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_1228;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1229;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_1230;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_1231;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1232;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_1233;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_1234;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1235;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1236;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1237;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1238;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1239;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1240;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1241;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_1242;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_1243;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1244;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_1245;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_1246;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1247;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_1248;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_1249;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1250;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_1251;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_1252;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1253;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1254;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1255;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1256;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1257;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1258;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1259;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1260;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1261;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1262;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1263;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1264;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1265;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1266;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1267;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1268;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1269;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1270;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1271;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1272;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1273;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1274;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1275;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1276;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1277;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1278;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1279;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1280;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1281;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1282;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1283;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1284;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1285;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1286;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1287;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1288;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1289;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1290;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1291;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1292;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1293;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1294;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1295;
+
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1200> AgradDistributionExpModNormal_v_1200;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1201> AgradDistributionExpModNormal_v_1201;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1202> AgradDistributionExpModNormal_v_1202;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1203> AgradDistributionExpModNormal_v_1203;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1204> AgradDistributionExpModNormal_v_1204;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1205> AgradDistributionExpModNormal_v_1205;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1206> AgradDistributionExpModNormal_v_1206;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1207> AgradDistributionExpModNormal_v_1207;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1208> AgradDistributionExpModNormal_v_1208;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1209> AgradDistributionExpModNormal_v_1209;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1210> AgradDistributionExpModNormal_v_1210;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1211> AgradDistributionExpModNormal_v_1211;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1212> AgradDistributionExpModNormal_v_1212;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1213> AgradDistributionExpModNormal_v_1213;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1214> AgradDistributionExpModNormal_v_1214;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1215> AgradDistributionExpModNormal_v_1215;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1216> AgradDistributionExpModNormal_v_1216;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1217> AgradDistributionExpModNormal_v_1217;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1218> AgradDistributionExpModNormal_v_1218;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1219> AgradDistributionExpModNormal_v_1219;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1220> AgradDistributionExpModNormal_v_1220;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1221> AgradDistributionExpModNormal_v_1221;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1222> AgradDistributionExpModNormal_v_1222;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1223> AgradDistributionExpModNormal_v_1223;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1224> AgradDistributionExpModNormal_v_1224;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1225> AgradDistributionExpModNormal_v_1225;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1226> AgradDistributionExpModNormal_v_1226;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1227> AgradDistributionExpModNormal_v_1227;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1228> AgradDistributionExpModNormal_v_1228;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1229> AgradDistributionExpModNormal_v_1229;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1230> AgradDistributionExpModNormal_v_1230;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1231> AgradDistributionExpModNormal_v_1231;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1232> AgradDistributionExpModNormal_v_1232;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1233> AgradDistributionExpModNormal_v_1233;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1234> AgradDistributionExpModNormal_v_1234;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1235> AgradDistributionExpModNormal_v_1235;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1236> AgradDistributionExpModNormal_v_1236;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1237> AgradDistributionExpModNormal_v_1237;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1238> AgradDistributionExpModNormal_v_1238;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1239> AgradDistributionExpModNormal_v_1239;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1240> AgradDistributionExpModNormal_v_1240;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1241> AgradDistributionExpModNormal_v_1241;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1242> AgradDistributionExpModNormal_v_1242;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1243> AgradDistributionExpModNormal_v_1243;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1244> AgradDistributionExpModNormal_v_1244;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1245> AgradDistributionExpModNormal_v_1245;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1246> AgradDistributionExpModNormal_v_1246;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1247> AgradDistributionExpModNormal_v_1247;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1248> AgradDistributionExpModNormal_v_1248;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1249> AgradDistributionExpModNormal_v_1249;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1250> AgradDistributionExpModNormal_v_1250;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1251> AgradDistributionExpModNormal_v_1251;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1252> AgradDistributionExpModNormal_v_1252;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1253> AgradDistributionExpModNormal_v_1253;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1254> AgradDistributionExpModNormal_v_1254;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1255> AgradDistributionExpModNormal_v_1255;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1256> AgradDistributionExpModNormal_v_1256;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1257> AgradDistributionExpModNormal_v_1257;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1258> AgradDistributionExpModNormal_v_1258;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1259> AgradDistributionExpModNormal_v_1259;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1260> AgradDistributionExpModNormal_v_1260;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1261> AgradDistributionExpModNormal_v_1261;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1262> AgradDistributionExpModNormal_v_1262;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1263> AgradDistributionExpModNormal_v_1263;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1264> AgradDistributionExpModNormal_v_1264;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1265> AgradDistributionExpModNormal_v_1265;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1266> AgradDistributionExpModNormal_v_1266;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1267> AgradDistributionExpModNormal_v_1267;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1268> AgradDistributionExpModNormal_v_1268;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1269> AgradDistributionExpModNormal_v_1269;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1270> AgradDistributionExpModNormal_v_1270;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1271> AgradDistributionExpModNormal_v_1271;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1272> AgradDistributionExpModNormal_v_1272;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1273> AgradDistributionExpModNormal_v_1273;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1274> AgradDistributionExpModNormal_v_1274;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1275> AgradDistributionExpModNormal_v_1275;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1276> AgradDistributionExpModNormal_v_1276;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1277> AgradDistributionExpModNormal_v_1277;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1278> AgradDistributionExpModNormal_v_1278;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1279> AgradDistributionExpModNormal_v_1279;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1280> AgradDistributionExpModNormal_v_1280;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1281> AgradDistributionExpModNormal_v_1281;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1282> AgradDistributionExpModNormal_v_1282;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1283> AgradDistributionExpModNormal_v_1283;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1284> AgradDistributionExpModNormal_v_1284;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1285> AgradDistributionExpModNormal_v_1285;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1286> AgradDistributionExpModNormal_v_1286;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1287> AgradDistributionExpModNormal_v_1287;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1288> AgradDistributionExpModNormal_v_1288;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1289> AgradDistributionExpModNormal_v_1289;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1290> AgradDistributionExpModNormal_v_1290;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1291> AgradDistributionExpModNormal_v_1291;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1292> AgradDistributionExpModNormal_v_1292;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1293> AgradDistributionExpModNormal_v_1293;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1294> AgradDistributionExpModNormal_v_1294;
+typedef std::tuple<AgradDistributionExpModNormal, type_v_1295> AgradDistributionExpModNormal_v_1295;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1200, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1201, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1202, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1203, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1204, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1205, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1206, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1207, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1208, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1209, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1210, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1211, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1212, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1213, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1214, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1215, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1216, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1217, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1218, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1219, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1220, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1221, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1222, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1223, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1224, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1225, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1226, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1227, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1228, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1229, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1230, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1231, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1232, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1233, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1234, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1235, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1236, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1237, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1238, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1239, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1240, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1241, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1242, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1243, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1244, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1245, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1246, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1247, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1248, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1249, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1250, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1251, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1252, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1253, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1254, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1255, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1256, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1257, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1258, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1259, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1260, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1261, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1262, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1263, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1264, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1265, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1266, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1267, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1268, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1269, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1270, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1271, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1272, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1273, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1274, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1275, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1276, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1277, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1278, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1279, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1280, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1281, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1282, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1283, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1284, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1285, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1286, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1287, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1288, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1289, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1290, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1291, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1292, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1293, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1294, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionExpModNormal_v_1295, AgradDistributionTestFixture, AgradDistributionExpModNormal_v_1295);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<double, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<double, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<double, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<double, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_0> AgradCcdfLogExpModNormal_ffv_0;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1> AgradCcdfLogExpModNormal_ffv_1;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_2> AgradCcdfLogExpModNormal_ffv_2;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_3> AgradCcdfLogExpModNormal_ffv_3;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_4> AgradCcdfLogExpModNormal_ffv_4;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_5> AgradCcdfLogExpModNormal_ffv_5;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_6> AgradCcdfLogExpModNormal_ffv_6;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_7> AgradCcdfLogExpModNormal_ffv_7;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_8> AgradCcdfLogExpModNormal_ffv_8;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_9> AgradCcdfLogExpModNormal_ffv_9;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_10> AgradCcdfLogExpModNormal_ffv_10;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_11> AgradCcdfLogExpModNormal_ffv_11;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_12> AgradCcdfLogExpModNormal_ffv_12;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_13> AgradCcdfLogExpModNormal_ffv_13;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_14> AgradCcdfLogExpModNormal_ffv_14;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_15> AgradCcdfLogExpModNormal_ffv_15;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_16> AgradCcdfLogExpModNormal_ffv_16;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_17> AgradCcdfLogExpModNormal_ffv_17;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_18> AgradCcdfLogExpModNormal_ffv_18;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_19> AgradCcdfLogExpModNormal_ffv_19;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_20> AgradCcdfLogExpModNormal_ffv_20;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_21> AgradCcdfLogExpModNormal_ffv_21;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_22> AgradCcdfLogExpModNormal_ffv_22;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_23> AgradCcdfLogExpModNormal_ffv_23;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_24> AgradCcdfLogExpModNormal_ffv_24;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_25> AgradCcdfLogExpModNormal_ffv_25;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_26> AgradCcdfLogExpModNormal_ffv_26;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_27> AgradCcdfLogExpModNormal_ffv_27;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_28> AgradCcdfLogExpModNormal_ffv_28;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_29> AgradCcdfLogExpModNormal_ffv_29;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_30> AgradCcdfLogExpModNormal_ffv_30;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_31> AgradCcdfLogExpModNormal_ffv_31;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_32> AgradCcdfLogExpModNormal_ffv_32;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_33> AgradCcdfLogExpModNormal_ffv_33;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_34> AgradCcdfLogExpModNormal_ffv_34;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_35> AgradCcdfLogExpModNormal_ffv_35;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_36> AgradCcdfLogExpModNormal_ffv_36;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_37> AgradCcdfLogExpModNormal_ffv_37;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_38> AgradCcdfLogExpModNormal_ffv_38;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_39> AgradCcdfLogExpModNormal_ffv_39;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_40> AgradCcdfLogExpModNormal_ffv_40;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_41> AgradCcdfLogExpModNormal_ffv_41;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_42> AgradCcdfLogExpModNormal_ffv_42;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_43> AgradCcdfLogExpModNormal_ffv_43;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_44> AgradCcdfLogExpModNormal_ffv_44;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_45> AgradCcdfLogExpModNormal_ffv_45;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_46> AgradCcdfLogExpModNormal_ffv_46;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_47> AgradCcdfLogExpModNormal_ffv_47;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_48> AgradCcdfLogExpModNormal_ffv_48;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_49> AgradCcdfLogExpModNormal_ffv_49;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_50> AgradCcdfLogExpModNormal_ffv_50;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_51> AgradCcdfLogExpModNormal_ffv_51;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_52> AgradCcdfLogExpModNormal_ffv_52;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_53> AgradCcdfLogExpModNormal_ffv_53;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_54> AgradCcdfLogExpModNormal_ffv_54;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_55> AgradCcdfLogExpModNormal_ffv_55;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_56> AgradCcdfLogExpModNormal_ffv_56;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_57> AgradCcdfLogExpModNormal_ffv_57;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_58> AgradCcdfLogExpModNormal_ffv_58;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_59> AgradCcdfLogExpModNormal_ffv_59;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_60> AgradCcdfLogExpModNormal_ffv_60;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_61> AgradCcdfLogExpModNormal_ffv_61;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_62> AgradCcdfLogExpModNormal_ffv_62;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_63> AgradCcdfLogExpModNormal_ffv_63;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_64> AgradCcdfLogExpModNormal_ffv_64;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_65> AgradCcdfLogExpModNormal_ffv_65;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_66> AgradCcdfLogExpModNormal_ffv_66;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_67> AgradCcdfLogExpModNormal_ffv_67;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_68> AgradCcdfLogExpModNormal_ffv_68;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_69> AgradCcdfLogExpModNormal_ffv_69;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_70> AgradCcdfLogExpModNormal_ffv_70;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_71> AgradCcdfLogExpModNormal_ffv_71;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_72> AgradCcdfLogExpModNormal_ffv_72;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_73> AgradCcdfLogExpModNormal_ffv_73;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_74> AgradCcdfLogExpModNormal_ffv_74;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_75> AgradCcdfLogExpModNormal_ffv_75;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_76> AgradCcdfLogExpModNormal_ffv_76;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_77> AgradCcdfLogExpModNormal_ffv_77;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_78> AgradCcdfLogExpModNormal_ffv_78;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_79> AgradCcdfLogExpModNormal_ffv_79;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_80> AgradCcdfLogExpModNormal_ffv_80;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_81> AgradCcdfLogExpModNormal_ffv_81;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_82> AgradCcdfLogExpModNormal_ffv_82;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_83> AgradCcdfLogExpModNormal_ffv_83;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_84> AgradCcdfLogExpModNormal_ffv_84;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_85> AgradCcdfLogExpModNormal_ffv_85;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_86> AgradCcdfLogExpModNormal_ffv_86;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_87> AgradCcdfLogExpModNormal_ffv_87;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_88> AgradCcdfLogExpModNormal_ffv_88;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_89> AgradCcdfLogExpModNormal_ffv_89;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_90> AgradCcdfLogExpModNormal_ffv_90;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_91> AgradCcdfLogExpModNormal_ffv_91;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_92> AgradCcdfLogExpModNormal_ffv_92;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_93> AgradCcdfLogExpModNormal_ffv_93;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_94> AgradCcdfLogExpModNormal_ffv_94;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_95> AgradCcdfLogExpModNormal_ffv_95;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_96> AgradCcdfLogExpModNormal_ffv_96;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_97> AgradCcdfLogExpModNormal_ffv_97;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_98> AgradCcdfLogExpModNormal_ffv_98;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_99> AgradCcdfLogExpModNormal_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<double, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<double, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<double, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<double, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<double, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<double, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<double, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<double, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_0> AgradCcdfLogExpModNormal_v_0;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1> AgradCcdfLogExpModNormal_v_1;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_2> AgradCcdfLogExpModNormal_v_2;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_3> AgradCcdfLogExpModNormal_v_3;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_4> AgradCcdfLogExpModNormal_v_4;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_5> AgradCcdfLogExpModNormal_v_5;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_6> AgradCcdfLogExpModNormal_v_6;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_7> AgradCcdfLogExpModNormal_v_7;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_8> AgradCcdfLogExpModNormal_v_8;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_9> AgradCcdfLogExpModNormal_v_9;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_10> AgradCcdfLogExpModNormal_v_10;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_11> AgradCcdfLogExpModNormal_v_11;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_12> AgradCcdfLogExpModNormal_v_12;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_13> AgradCcdfLogExpModNormal_v_13;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_14> AgradCcdfLogExpModNormal_v_14;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_15> AgradCcdfLogExpModNormal_v_15;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_16> AgradCcdfLogExpModNormal_v_16;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_17> AgradCcdfLogExpModNormal_v_17;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_18> AgradCcdfLogExpModNormal_v_18;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_19> AgradCcdfLogExpModNormal_v_19;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_20> AgradCcdfLogExpModNormal_v_20;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_21> AgradCcdfLogExpModNormal_v_21;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_22> AgradCcdfLogExpModNormal_v_22;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_23> AgradCcdfLogExpModNormal_v_23;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_24> AgradCcdfLogExpModNormal_v_24;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_25> AgradCcdfLogExpModNormal_v_25;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_26> AgradCcdfLogExpModNormal_v_26;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_27> AgradCcdfLogExpModNormal_v_27;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_28> AgradCcdfLogExpModNormal_v_28;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_29> AgradCcdfLogExpModNormal_v_29;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_30> AgradCcdfLogExpModNormal_v_30;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_31> AgradCcdfLogExpModNormal_v_31;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_32> AgradCcdfLogExpModNormal_v_32;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_33> AgradCcdfLogExpModNormal_v_33;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_34> AgradCcdfLogExpModNormal_v_34;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_35> AgradCcdfLogExpModNormal_v_35;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_36> AgradCcdfLogExpModNormal_v_36;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_37> AgradCcdfLogExpModNormal_v_37;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_38> AgradCcdfLogExpModNormal_v_38;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_39> AgradCcdfLogExpModNormal_v_39;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_40> AgradCcdfLogExpModNormal_v_40;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_41> AgradCcdfLogExpModNormal_v_41;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_42> AgradCcdfLogExpModNormal_v_42;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_43> AgradCcdfLogExpModNormal_v_43;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_44> AgradCcdfLogExpModNormal_v_44;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_45> AgradCcdfLogExpModNormal_v_45;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_46> AgradCcdfLogExpModNormal_v_46;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_47> AgradCcdfLogExpModNormal_v_47;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_48> AgradCcdfLogExpModNormal_v_48;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_49> AgradCcdfLogExpModNormal_v_49;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_50> AgradCcdfLogExpModNormal_v_50;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_51> AgradCcdfLogExpModNormal_v_51;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_52> AgradCcdfLogExpModNormal_v_52;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_53> AgradCcdfLogExpModNormal_v_53;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_54> AgradCcdfLogExpModNormal_v_54;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_55> AgradCcdfLogExpModNormal_v_55;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_56> AgradCcdfLogExpModNormal_v_56;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_57> AgradCcdfLogExpModNormal_v_57;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_58> AgradCcdfLogExpModNormal_v_58;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_59> AgradCcdfLogExpModNormal_v_59;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_60> AgradCcdfLogExpModNormal_v_60;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_61> AgradCcdfLogExpModNormal_v_61;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_62> AgradCcdfLogExpModNormal_v_62;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_63> AgradCcdfLogExpModNormal_v_63;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_64> AgradCcdfLogExpModNormal_v_64;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_65> AgradCcdfLogExpModNormal_v_65;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_66> AgradCcdfLogExpModNormal_v_66;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_67> AgradCcdfLogExpModNormal_v_67;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_68> AgradCcdfLogExpModNormal_v_68;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_69> AgradCcdfLogExpModNormal_v_69;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_70> AgradCcdfLogExpModNormal_v_70;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_71> AgradCcdfLogExpModNormal_v_71;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_72> AgradCcdfLogExpModNormal_v_72;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_73> AgradCcdfLogExpModNormal_v_73;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_74> AgradCcdfLogExpModNormal_v_74;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_75> AgradCcdfLogExpModNormal_v_75;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_76> AgradCcdfLogExpModNormal_v_76;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_77> AgradCcdfLogExpModNormal_v_77;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_78> AgradCcdfLogExpModNormal_v_78;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_79> AgradCcdfLogExpModNormal_v_79;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_80> AgradCcdfLogExpModNormal_v_80;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_81> AgradCcdfLogExpModNormal_v_81;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_82> AgradCcdfLogExpModNormal_v_82;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_83> AgradCcdfLogExpModNormal_v_83;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_84> AgradCcdfLogExpModNormal_v_84;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_85> AgradCcdfLogExpModNormal_v_85;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_86> AgradCcdfLogExpModNormal_v_86;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_87> AgradCcdfLogExpModNormal_v_87;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_88> AgradCcdfLogExpModNormal_v_88;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_89> AgradCcdfLogExpModNormal_v_89;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_90> AgradCcdfLogExpModNormal_v_90;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_91> AgradCcdfLogExpModNormal_v_91;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_92> AgradCcdfLogExpModNormal_v_92;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_93> AgradCcdfLogExpModNormal_v_93;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_94> AgradCcdfLogExpModNormal_v_94;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_95> AgradCcdfLogExpModNormal_v_95;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_96> AgradCcdfLogExpModNormal_v_96;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_97> AgradCcdfLogExpModNormal_v_97;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_98> AgradCcdfLogExpModNormal_v_98;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_99> AgradCcdfLogExpModNormal_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_0, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_2, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_3, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_4, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_5, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_6, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_7, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_8, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_9, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_10, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_11, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_12, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_13, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_14, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_15, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_16, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_17, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_18, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_19, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_20, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_21, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_22, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_23, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_24, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_25, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_26, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_27, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_28, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_29, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_30, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_31, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_32, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_33, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_34, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_35, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_36, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_37, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_38, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_39, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_40, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_41, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_42, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_43, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_44, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_45, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_46, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_47, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_48, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_49, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_50, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_51, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_52, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_53, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_54, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_55, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_56, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_57, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_58, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_59, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_60, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_61, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_62, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_63, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_64, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_65, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_66, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_67, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_68, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_69, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_70, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_71, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_72, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_73, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_74, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_75, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_76, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_77, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_78, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_79, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_80, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_81, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_82, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_83, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_84, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_85, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_86, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_87, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_88, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_89, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_90, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_91, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_92, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_93, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_94, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_95, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_96, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_97, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_98, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_99, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<double, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<double, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<double, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<double, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<double, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<double, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<double, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<double, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<double, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<double, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<double, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<double, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<double, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_0> AgradCcdfLogExpModNormal_vv_0;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_1> AgradCcdfLogExpModNormal_vv_1;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_2> AgradCcdfLogExpModNormal_vv_2;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_3> AgradCcdfLogExpModNormal_vv_3;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_4> AgradCcdfLogExpModNormal_vv_4;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_5> AgradCcdfLogExpModNormal_vv_5;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_6> AgradCcdfLogExpModNormal_vv_6;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_7> AgradCcdfLogExpModNormal_vv_7;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_8> AgradCcdfLogExpModNormal_vv_8;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_9> AgradCcdfLogExpModNormal_vv_9;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_10> AgradCcdfLogExpModNormal_vv_10;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_11> AgradCcdfLogExpModNormal_vv_11;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_12> AgradCcdfLogExpModNormal_vv_12;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_13> AgradCcdfLogExpModNormal_vv_13;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_14> AgradCcdfLogExpModNormal_vv_14;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_15> AgradCcdfLogExpModNormal_vv_15;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_16> AgradCcdfLogExpModNormal_vv_16;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_17> AgradCcdfLogExpModNormal_vv_17;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_18> AgradCcdfLogExpModNormal_vv_18;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_19> AgradCcdfLogExpModNormal_vv_19;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_20> AgradCcdfLogExpModNormal_vv_20;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_21> AgradCcdfLogExpModNormal_vv_21;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_22> AgradCcdfLogExpModNormal_vv_22;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_23> AgradCcdfLogExpModNormal_vv_23;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_24> AgradCcdfLogExpModNormal_vv_24;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_25> AgradCcdfLogExpModNormal_vv_25;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_26> AgradCcdfLogExpModNormal_vv_26;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_27> AgradCcdfLogExpModNormal_vv_27;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_28> AgradCcdfLogExpModNormal_vv_28;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_29> AgradCcdfLogExpModNormal_vv_29;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_30> AgradCcdfLogExpModNormal_vv_30;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_31> AgradCcdfLogExpModNormal_vv_31;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_32> AgradCcdfLogExpModNormal_vv_32;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_33> AgradCcdfLogExpModNormal_vv_33;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_34> AgradCcdfLogExpModNormal_vv_34;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_35> AgradCcdfLogExpModNormal_vv_35;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_36> AgradCcdfLogExpModNormal_vv_36;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_37> AgradCcdfLogExpModNormal_vv_37;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_38> AgradCcdfLogExpModNormal_vv_38;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_39> AgradCcdfLogExpModNormal_vv_39;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_40> AgradCcdfLogExpModNormal_vv_40;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_41> AgradCcdfLogExpModNormal_vv_41;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_42> AgradCcdfLogExpModNormal_vv_42;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_43> AgradCcdfLogExpModNormal_vv_43;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_44> AgradCcdfLogExpModNormal_vv_44;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_45> AgradCcdfLogExpModNormal_vv_45;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_46> AgradCcdfLogExpModNormal_vv_46;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_47> AgradCcdfLogExpModNormal_vv_47;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_48> AgradCcdfLogExpModNormal_vv_48;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_49> AgradCcdfLogExpModNormal_vv_49;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_50> AgradCcdfLogExpModNormal_vv_50;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_51> AgradCcdfLogExpModNormal_vv_51;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_52> AgradCcdfLogExpModNormal_vv_52;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_53> AgradCcdfLogExpModNormal_vv_53;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_54> AgradCcdfLogExpModNormal_vv_54;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_55> AgradCcdfLogExpModNormal_vv_55;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_56> AgradCcdfLogExpModNormal_vv_56;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_57> AgradCcdfLogExpModNormal_vv_57;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_58> AgradCcdfLogExpModNormal_vv_58;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_59> AgradCcdfLogExpModNormal_vv_59;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_60> AgradCcdfLogExpModNormal_vv_60;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_61> AgradCcdfLogExpModNormal_vv_61;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_62> AgradCcdfLogExpModNormal_vv_62;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_63> AgradCcdfLogExpModNormal_vv_63;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_64> AgradCcdfLogExpModNormal_vv_64;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_65> AgradCcdfLogExpModNormal_vv_65;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_66> AgradCcdfLogExpModNormal_vv_66;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_67> AgradCcdfLogExpModNormal_vv_67;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_68> AgradCcdfLogExpModNormal_vv_68;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_69> AgradCcdfLogExpModNormal_vv_69;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_70> AgradCcdfLogExpModNormal_vv_70;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_71> AgradCcdfLogExpModNormal_vv_71;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_72> AgradCcdfLogExpModNormal_vv_72;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_73> AgradCcdfLogExpModNormal_vv_73;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_74> AgradCcdfLogExpModNormal_vv_74;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_75> AgradCcdfLogExpModNormal_vv_75;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_76> AgradCcdfLogExpModNormal_vv_76;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_77> AgradCcdfLogExpModNormal_vv_77;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_78> AgradCcdfLogExpModNormal_vv_78;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_79> AgradCcdfLogExpModNormal_vv_79;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_80> AgradCcdfLogExpModNormal_vv_80;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_81> AgradCcdfLogExpModNormal_vv_81;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_82> AgradCcdfLogExpModNormal_vv_82;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_83> AgradCcdfLogExpModNormal_vv_83;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_84> AgradCcdfLogExpModNormal_vv_84;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_85> AgradCcdfLogExpModNormal_vv_85;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_86> AgradCcdfLogExpModNormal_vv_86;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_87> AgradCcdfLogExpModNormal_vv_87;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_88> AgradCcdfLogExpModNormal_vv_88;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_89> AgradCcdfLogExpModNormal_vv_89;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_90> AgradCcdfLogExpModNormal_vv_90;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_91> AgradCcdfLogExpModNormal_vv_91;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_92> AgradCcdfLogExpModNormal_vv_92;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_93> AgradCcdfLogExpModNormal_vv_93;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_94> AgradCcdfLogExpModNormal_vv_94;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_95> AgradCcdfLogExpModNormal_vv_95;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_96> AgradCcdfLogExpModNormal_vv_96;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_97> AgradCcdfLogExpModNormal_vv_97;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_98> AgradCcdfLogExpModNormal_vv_98;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_99> AgradCcdfLogExpModNormal_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_99);
+
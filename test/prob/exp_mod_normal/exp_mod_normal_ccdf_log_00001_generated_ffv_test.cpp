@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<double>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_100> AgradCcdfLogExpModNormal_ffv_100;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_101> AgradCcdfLogExpModNormal_ffv_101;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_102> AgradCcdfLogExpModNormal_ffv_102;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_103> AgradCcdfLogExpModNormal_ffv_103;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_104> AgradCcdfLogExpModNormal_ffv_104;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_105> AgradCcdfLogExpModNormal_ffv_105;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_106> AgradCcdfLogExpModNormal_ffv_106;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_107> AgradCcdfLogExpModNormal_ffv_107;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_108> AgradCcdfLogExpModNormal_ffv_108;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_109> AgradCcdfLogExpModNormal_ffv_109;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_110> AgradCcdfLogExpModNormal_ffv_110;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_111> AgradCcdfLogExpModNormal_ffv_111;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_112> AgradCcdfLogExpModNormal_ffv_112;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_113> AgradCcdfLogExpModNormal_ffv_113;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_114> AgradCcdfLogExpModNormal_ffv_114;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_115> AgradCcdfLogExpModNormal_ffv_115;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_116> AgradCcdfLogExpModNormal_ffv_116;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_117> AgradCcdfLogExpModNormal_ffv_117;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_118> AgradCcdfLogExpModNormal_ffv_118;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_119> AgradCcdfLogExpModNormal_ffv_119;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_120> AgradCcdfLogExpModNormal_ffv_120;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_121> AgradCcdfLogExpModNormal_ffv_121;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_122> AgradCcdfLogExpModNormal_ffv_122;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_123> AgradCcdfLogExpModNormal_ffv_123;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_124> AgradCcdfLogExpModNormal_ffv_124;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_125> AgradCcdfLogExpModNormal_ffv_125;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_126> AgradCcdfLogExpModNormal_ffv_126;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_127> AgradCcdfLogExpModNormal_ffv_127;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_128> AgradCcdfLogExpModNormal_ffv_128;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_129> AgradCcdfLogExpModNormal_ffv_129;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_130> AgradCcdfLogExpModNormal_ffv_130;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_131> AgradCcdfLogExpModNormal_ffv_131;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_132> AgradCcdfLogExpModNormal_ffv_132;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_133> AgradCcdfLogExpModNormal_ffv_133;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_134> AgradCcdfLogExpModNormal_ffv_134;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_135> AgradCcdfLogExpModNormal_ffv_135;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_136> AgradCcdfLogExpModNormal_ffv_136;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_137> AgradCcdfLogExpModNormal_ffv_137;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_138> AgradCcdfLogExpModNormal_ffv_138;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_139> AgradCcdfLogExpModNormal_ffv_139;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_140> AgradCcdfLogExpModNormal_ffv_140;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_141> AgradCcdfLogExpModNormal_ffv_141;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_142> AgradCcdfLogExpModNormal_ffv_142;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_143> AgradCcdfLogExpModNormal_ffv_143;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_144> AgradCcdfLogExpModNormal_ffv_144;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_145> AgradCcdfLogExpModNormal_ffv_145;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_146> AgradCcdfLogExpModNormal_ffv_146;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_147> AgradCcdfLogExpModNormal_ffv_147;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_148> AgradCcdfLogExpModNormal_ffv_148;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_149> AgradCcdfLogExpModNormal_ffv_149;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_150> AgradCcdfLogExpModNormal_ffv_150;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_151> AgradCcdfLogExpModNormal_ffv_151;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_152> AgradCcdfLogExpModNormal_ffv_152;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_153> AgradCcdfLogExpModNormal_ffv_153;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_154> AgradCcdfLogExpModNormal_ffv_154;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_155> AgradCcdfLogExpModNormal_ffv_155;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_156> AgradCcdfLogExpModNormal_ffv_156;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_157> AgradCcdfLogExpModNormal_ffv_157;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_158> AgradCcdfLogExpModNormal_ffv_158;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_159> AgradCcdfLogExpModNormal_ffv_159;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_160> AgradCcdfLogExpModNormal_ffv_160;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_161> AgradCcdfLogExpModNormal_ffv_161;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_162> AgradCcdfLogExpModNormal_ffv_162;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_163> AgradCcdfLogExpModNormal_ffv_163;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_164> AgradCcdfLogExpModNormal_ffv_164;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_165> AgradCcdfLogExpModNormal_ffv_165;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_166> AgradCcdfLogExpModNormal_ffv_166;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_167> AgradCcdfLogExpModNormal_ffv_167;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_168> AgradCcdfLogExpModNormal_ffv_168;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_169> AgradCcdfLogExpModNormal_ffv_169;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_170> AgradCcdfLogExpModNormal_ffv_170;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_171> AgradCcdfLogExpModNormal_ffv_171;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_172> AgradCcdfLogExpModNormal_ffv_172;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_173> AgradCcdfLogExpModNormal_ffv_173;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_174> AgradCcdfLogExpModNormal_ffv_174;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_175> AgradCcdfLogExpModNormal_ffv_175;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_176> AgradCcdfLogExpModNormal_ffv_176;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_177> AgradCcdfLogExpModNormal_ffv_177;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_178> AgradCcdfLogExpModNormal_ffv_178;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_179> AgradCcdfLogExpModNormal_ffv_179;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_180> AgradCcdfLogExpModNormal_ffv_180;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_181> AgradCcdfLogExpModNormal_ffv_181;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_182> AgradCcdfLogExpModNormal_ffv_182;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_183> AgradCcdfLogExpModNormal_ffv_183;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_184> AgradCcdfLogExpModNormal_ffv_184;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_185> AgradCcdfLogExpModNormal_ffv_185;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_186> AgradCcdfLogExpModNormal_ffv_186;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_187> AgradCcdfLogExpModNormal_ffv_187;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_188> AgradCcdfLogExpModNormal_ffv_188;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_189> AgradCcdfLogExpModNormal_ffv_189;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_190> AgradCcdfLogExpModNormal_ffv_190;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_191> AgradCcdfLogExpModNormal_ffv_191;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_192> AgradCcdfLogExpModNormal_ffv_192;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_193> AgradCcdfLogExpModNormal_ffv_193;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_194> AgradCcdfLogExpModNormal_ffv_194;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_195> AgradCcdfLogExpModNormal_ffv_195;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_196> AgradCcdfLogExpModNormal_ffv_196;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_197> AgradCcdfLogExpModNormal_ffv_197;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_198> AgradCcdfLogExpModNormal_ffv_198;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_199> AgradCcdfLogExpModNormal_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_189, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_190, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_191, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_192, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_193, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_194, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_195, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_196, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_197, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_198, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_199, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<double, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<double, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<double, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<double, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_100> AgradCcdfLogExpModNormal_v_100;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_101> AgradCcdfLogExpModNormal_v_101;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_102> AgradCcdfLogExpModNormal_v_102;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_103> AgradCcdfLogExpModNormal_v_103;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_104> AgradCcdfLogExpModNormal_v_104;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_105> AgradCcdfLogExpModNormal_v_105;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_106> AgradCcdfLogExpModNormal_v_106;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_107> AgradCcdfLogExpModNormal_v_107;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_108> AgradCcdfLogExpModNormal_v_108;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_109> AgradCcdfLogExpModNormal_v_109;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_110> AgradCcdfLogExpModNormal_v_110;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_111> AgradCcdfLogExpModNormal_v_111;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_112> AgradCcdfLogExpModNormal_v_112;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_113> AgradCcdfLogExpModNormal_v_113;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_114> AgradCcdfLogExpModNormal_v_114;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_115> AgradCcdfLogExpModNormal_v_115;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_116> AgradCcdfLogExpModNormal_v_116;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_117> AgradCcdfLogExpModNormal_v_117;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_118> AgradCcdfLogExpModNormal_v_118;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_119> AgradCcdfLogExpModNormal_v_119;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_120> AgradCcdfLogExpModNormal_v_120;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_121> AgradCcdfLogExpModNormal_v_121;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_122> AgradCcdfLogExpModNormal_v_122;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_123> AgradCcdfLogExpModNormal_v_123;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_124> AgradCcdfLogExpModNormal_v_124;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_125> AgradCcdfLogExpModNormal_v_125;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_126> AgradCcdfLogExpModNormal_v_126;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_127> AgradCcdfLogExpModNormal_v_127;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_128> AgradCcdfLogExpModNormal_v_128;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_129> AgradCcdfLogExpModNormal_v_129;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_130> AgradCcdfLogExpModNormal_v_130;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_131> AgradCcdfLogExpModNormal_v_131;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_132> AgradCcdfLogExpModNormal_v_132;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_133> AgradCcdfLogExpModNormal_v_133;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_134> AgradCcdfLogExpModNormal_v_134;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_135> AgradCcdfLogExpModNormal_v_135;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_136> AgradCcdfLogExpModNormal_v_136;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_137> AgradCcdfLogExpModNormal_v_137;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_138> AgradCcdfLogExpModNormal_v_138;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_139> AgradCcdfLogExpModNormal_v_139;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_140> AgradCcdfLogExpModNormal_v_140;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_141> AgradCcdfLogExpModNormal_v_141;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_142> AgradCcdfLogExpModNormal_v_142;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_143> AgradCcdfLogExpModNormal_v_143;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_144> AgradCcdfLogExpModNormal_v_144;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_145> AgradCcdfLogExpModNormal_v_145;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_146> AgradCcdfLogExpModNormal_v_146;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_147> AgradCcdfLogExpModNormal_v_147;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_148> AgradCcdfLogExpModNormal_v_148;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_149> AgradCcdfLogExpModNormal_v_149;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_150> AgradCcdfLogExpModNormal_v_150;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_151> AgradCcdfLogExpModNormal_v_151;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_152> AgradCcdfLogExpModNormal_v_152;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_153> AgradCcdfLogExpModNormal_v_153;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_154> AgradCcdfLogExpModNormal_v_154;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_155> AgradCcdfLogExpModNormal_v_155;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_156> AgradCcdfLogExpModNormal_v_156;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_157> AgradCcdfLogExpModNormal_v_157;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_158> AgradCcdfLogExpModNormal_v_158;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_159> AgradCcdfLogExpModNormal_v_159;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_160> AgradCcdfLogExpModNormal_v_160;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_161> AgradCcdfLogExpModNormal_v_161;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_162> AgradCcdfLogExpModNormal_v_162;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_163> AgradCcdfLogExpModNormal_v_163;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_164> AgradCcdfLogExpModNormal_v_164;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_165> AgradCcdfLogExpModNormal_v_165;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_166> AgradCcdfLogExpModNormal_v_166;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_167> AgradCcdfLogExpModNormal_v_167;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_168> AgradCcdfLogExpModNormal_v_168;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_169> AgradCcdfLogExpModNormal_v_169;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_170> AgradCcdfLogExpModNormal_v_170;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_171> AgradCcdfLogExpModNormal_v_171;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_172> AgradCcdfLogExpModNormal_v_172;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_173> AgradCcdfLogExpModNormal_v_173;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_174> AgradCcdfLogExpModNormal_v_174;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_175> AgradCcdfLogExpModNormal_v_175;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_176> AgradCcdfLogExpModNormal_v_176;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_177> AgradCcdfLogExpModNormal_v_177;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_178> AgradCcdfLogExpModNormal_v_178;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_179> AgradCcdfLogExpModNormal_v_179;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_180> AgradCcdfLogExpModNormal_v_180;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_181> AgradCcdfLogExpModNormal_v_181;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_182> AgradCcdfLogExpModNormal_v_182;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_183> AgradCcdfLogExpModNormal_v_183;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_184> AgradCcdfLogExpModNormal_v_184;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_185> AgradCcdfLogExpModNormal_v_185;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_186> AgradCcdfLogExpModNormal_v_186;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_187> AgradCcdfLogExpModNormal_v_187;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_188> AgradCcdfLogExpModNormal_v_188;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_189> AgradCcdfLogExpModNormal_v_189;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_190> AgradCcdfLogExpModNormal_v_190;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_191> AgradCcdfLogExpModNormal_v_191;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_192> AgradCcdfLogExpModNormal_v_192;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_193> AgradCcdfLogExpModNormal_v_193;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_194> AgradCcdfLogExpModNormal_v_194;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_195> AgradCcdfLogExpModNormal_v_195;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_196> AgradCcdfLogExpModNormal_v_196;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_197> AgradCcdfLogExpModNormal_v_197;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_198> AgradCcdfLogExpModNormal_v_198;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_199> AgradCcdfLogExpModNormal_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_100, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_101, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_102, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_103, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_104, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_105, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_106, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_107, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_108, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_109, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_110, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_111, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_112, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_113, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_114, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_115, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_116, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_117, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_118, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_119, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_120, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_121, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_122, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_123, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_124, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_125, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_126, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_127, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_128, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_129, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_130, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_131, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_132, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_133, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_134, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_135, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_136, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_137, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_138, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_139, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_140, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_141, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_142, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_143, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_144, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_145, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_146, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_147, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_148, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_149, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_150, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_151, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_152, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_153, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_154, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_155, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_156, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_157, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_158, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_159, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_160, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_161, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_162, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_163, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_164, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_165, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_166, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_167, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_168, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_169, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_170, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_171, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_172, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_173, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_174, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_175, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_176, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_177, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_178, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_179, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_180, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_181, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_182, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_183, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_184, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_185, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_186, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_187, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_188, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_189, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_190, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_191, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_192, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_193, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_194, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_195, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_196, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_197, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_198, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_199, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<double, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<double, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<double, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<double, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<double, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<double>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_100> AgradCcdfLogExpModNormal_vv_100;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_101> AgradCcdfLogExpModNormal_vv_101;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_102> AgradCcdfLogExpModNormal_vv_102;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_103> AgradCcdfLogExpModNormal_vv_103;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_104> AgradCcdfLogExpModNormal_vv_104;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_105> AgradCcdfLogExpModNormal_vv_105;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_106> AgradCcdfLogExpModNormal_vv_106;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_107> AgradCcdfLogExpModNormal_vv_107;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_108> AgradCcdfLogExpModNormal_vv_108;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_109> AgradCcdfLogExpModNormal_vv_109;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_110> AgradCcdfLogExpModNormal_vv_110;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_111> AgradCcdfLogExpModNormal_vv_111;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_112> AgradCcdfLogExpModNormal_vv_112;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_113> AgradCcdfLogExpModNormal_vv_113;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_114> AgradCcdfLogExpModNormal_vv_114;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_115> AgradCcdfLogExpModNormal_vv_115;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_116> AgradCcdfLogExpModNormal_vv_116;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_117> AgradCcdfLogExpModNormal_vv_117;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_118> AgradCcdfLogExpModNormal_vv_118;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_119> AgradCcdfLogExpModNormal_vv_119;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_120> AgradCcdfLogExpModNormal_vv_120;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_121> AgradCcdfLogExpModNormal_vv_121;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_122> AgradCcdfLogExpModNormal_vv_122;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_123> AgradCcdfLogExpModNormal_vv_123;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_124> AgradCcdfLogExpModNormal_vv_124;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_125> AgradCcdfLogExpModNormal_vv_125;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_126> AgradCcdfLogExpModNormal_vv_126;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_127> AgradCcdfLogExpModNormal_vv_127;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_128> AgradCcdfLogExpModNormal_vv_128;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_129> AgradCcdfLogExpModNormal_vv_129;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_130> AgradCcdfLogExpModNormal_vv_130;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_131> AgradCcdfLogExpModNormal_vv_131;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_132> AgradCcdfLogExpModNormal_vv_132;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_133> AgradCcdfLogExpModNormal_vv_133;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_134> AgradCcdfLogExpModNormal_vv_134;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_135> AgradCcdfLogExpModNormal_vv_135;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_136> AgradCcdfLogExpModNormal_vv_136;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_137> AgradCcdfLogExpModNormal_vv_137;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_138> AgradCcdfLogExpModNormal_vv_138;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_139> AgradCcdfLogExpModNormal_vv_139;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_140> AgradCcdfLogExpModNormal_vv_140;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_141> AgradCcdfLogExpModNormal_vv_141;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_142> AgradCcdfLogExpModNormal_vv_142;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_143> AgradCcdfLogExpModNormal_vv_143;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_144> AgradCcdfLogExpModNormal_vv_144;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_145> AgradCcdfLogExpModNormal_vv_145;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_146> AgradCcdfLogExpModNormal_vv_146;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_147> AgradCcdfLogExpModNormal_vv_147;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_148> AgradCcdfLogExpModNormal_vv_148;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_149> AgradCcdfLogExpModNormal_vv_149;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_150> AgradCcdfLogExpModNormal_vv_150;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_151> AgradCcdfLogExpModNormal_vv_151;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_152> AgradCcdfLogExpModNormal_vv_152;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_153> AgradCcdfLogExpModNormal_vv_153;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_154> AgradCcdfLogExpModNormal_vv_154;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_155> AgradCcdfLogExpModNormal_vv_155;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_156> AgradCcdfLogExpModNormal_vv_156;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_157> AgradCcdfLogExpModNormal_vv_157;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_158> AgradCcdfLogExpModNormal_vv_158;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_159> AgradCcdfLogExpModNormal_vv_159;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_160> AgradCcdfLogExpModNormal_vv_160;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_161> AgradCcdfLogExpModNormal_vv_161;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_162> AgradCcdfLogExpModNormal_vv_162;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_163> AgradCcdfLogExpModNormal_vv_163;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_164> AgradCcdfLogExpModNormal_vv_164;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_165> AgradCcdfLogExpModNormal_vv_165;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_166> AgradCcdfLogExpModNormal_vv_166;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_167> AgradCcdfLogExpModNormal_vv_167;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_168> AgradCcdfLogExpModNormal_vv_168;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_169> AgradCcdfLogExpModNormal_vv_169;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_170> AgradCcdfLogExpModNormal_vv_170;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_171> AgradCcdfLogExpModNormal_vv_171;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_172> AgradCcdfLogExpModNormal_vv_172;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_173> AgradCcdfLogExpModNormal_vv_173;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_174> AgradCcdfLogExpModNormal_vv_174;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_175> AgradCcdfLogExpModNormal_vv_175;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_176> AgradCcdfLogExpModNormal_vv_176;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_177> AgradCcdfLogExpModNormal_vv_177;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_178> AgradCcdfLogExpModNormal_vv_178;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_179> AgradCcdfLogExpModNormal_vv_179;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_180> AgradCcdfLogExpModNormal_vv_180;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_181> AgradCcdfLogExpModNormal_vv_181;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_182> AgradCcdfLogExpModNormal_vv_182;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_183> AgradCcdfLogExpModNormal_vv_183;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_184> AgradCcdfLogExpModNormal_vv_184;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_185> AgradCcdfLogExpModNormal_vv_185;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_186> AgradCcdfLogExpModNormal_vv_186;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_187> AgradCcdfLogExpModNormal_vv_187;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_188> AgradCcdfLogExpModNormal_vv_188;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_189> AgradCcdfLogExpModNormal_vv_189;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_190> AgradCcdfLogExpModNormal_vv_190;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_191> AgradCcdfLogExpModNormal_vv_191;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_192> AgradCcdfLogExpModNormal_vv_192;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_193> AgradCcdfLogExpModNormal_vv_193;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_194> AgradCcdfLogExpModNormal_vv_194;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_195> AgradCcdfLogExpModNormal_vv_195;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_196> AgradCcdfLogExpModNormal_vv_196;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_197> AgradCcdfLogExpModNormal_vv_197;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_198> AgradCcdfLogExpModNormal_vv_198;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_199> AgradCcdfLogExpModNormal_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_189, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_190, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_191, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_192, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_193, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_194, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_195, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_196, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_197, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_198, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_199, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_200> AgradCcdfLogExpModNormal_ffv_200;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_201> AgradCcdfLogExpModNormal_ffv_201;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_202> AgradCcdfLogExpModNormal_ffv_202;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_203> AgradCcdfLogExpModNormal_ffv_203;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_204> AgradCcdfLogExpModNormal_ffv_204;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_205> AgradCcdfLogExpModNormal_ffv_205;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_206> AgradCcdfLogExpModNormal_ffv_206;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_207> AgradCcdfLogExpModNormal_ffv_207;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_208> AgradCcdfLogExpModNormal_ffv_208;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_209> AgradCcdfLogExpModNormal_ffv_209;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_210> AgradCcdfLogExpModNormal_ffv_210;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_211> AgradCcdfLogExpModNormal_ffv_211;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_212> AgradCcdfLogExpModNormal_ffv_212;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_213> AgradCcdfLogExpModNormal_ffv_213;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_214> AgradCcdfLogExpModNormal_ffv_214;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_215> AgradCcdfLogExpModNormal_ffv_215;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_216> AgradCcdfLogExpModNormal_ffv_216;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_217> AgradCcdfLogExpModNormal_ffv_217;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_218> AgradCcdfLogExpModNormal_ffv_218;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_219> AgradCcdfLogExpModNormal_ffv_219;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_220> AgradCcdfLogExpModNormal_ffv_220;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_221> AgradCcdfLogExpModNormal_ffv_221;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_222> AgradCcdfLogExpModNormal_ffv_222;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_223> AgradCcdfLogExpModNormal_ffv_223;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_224> AgradCcdfLogExpModNormal_ffv_224;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_225> AgradCcdfLogExpModNormal_ffv_225;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_226> AgradCcdfLogExpModNormal_ffv_226;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_227> AgradCcdfLogExpModNormal_ffv_227;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_228> AgradCcdfLogExpModNormal_ffv_228;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_229> AgradCcdfLogExpModNormal_ffv_229;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_230> AgradCcdfLogExpModNormal_ffv_230;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_231> AgradCcdfLogExpModNormal_ffv_231;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_232> AgradCcdfLogExpModNormal_ffv_232;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_233> AgradCcdfLogExpModNormal_ffv_233;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_234> AgradCcdfLogExpModNormal_ffv_234;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_235> AgradCcdfLogExpModNormal_ffv_235;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_236> AgradCcdfLogExpModNormal_ffv_236;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_237> AgradCcdfLogExpModNormal_ffv_237;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_238> AgradCcdfLogExpModNormal_ffv_238;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_239> AgradCcdfLogExpModNormal_ffv_239;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_240> AgradCcdfLogExpModNormal_ffv_240;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_241> AgradCcdfLogExpModNormal_ffv_241;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_242> AgradCcdfLogExpModNormal_ffv_242;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_243> AgradCcdfLogExpModNormal_ffv_243;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_244> AgradCcdfLogExpModNormal_ffv_244;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_245> AgradCcdfLogExpModNormal_ffv_245;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_246> AgradCcdfLogExpModNormal_ffv_246;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_247> AgradCcdfLogExpModNormal_ffv_247;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_248> AgradCcdfLogExpModNormal_ffv_248;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_249> AgradCcdfLogExpModNormal_ffv_249;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_250> AgradCcdfLogExpModNormal_ffv_250;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_251> AgradCcdfLogExpModNormal_ffv_251;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_252> AgradCcdfLogExpModNormal_ffv_252;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_253> AgradCcdfLogExpModNormal_ffv_253;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_254> AgradCcdfLogExpModNormal_ffv_254;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_255> AgradCcdfLogExpModNormal_ffv_255;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_256> AgradCcdfLogExpModNormal_ffv_256;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_257> AgradCcdfLogExpModNormal_ffv_257;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_258> AgradCcdfLogExpModNormal_ffv_258;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_259> AgradCcdfLogExpModNormal_ffv_259;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_260> AgradCcdfLogExpModNormal_ffv_260;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_261> AgradCcdfLogExpModNormal_ffv_261;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_262> AgradCcdfLogExpModNormal_ffv_262;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_263> AgradCcdfLogExpModNormal_ffv_263;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_264> AgradCcdfLogExpModNormal_ffv_264;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_265> AgradCcdfLogExpModNormal_ffv_265;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_266> AgradCcdfLogExpModNormal_ffv_266;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_267> AgradCcdfLogExpModNormal_ffv_267;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_268> AgradCcdfLogExpModNormal_ffv_268;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_269> AgradCcdfLogExpModNormal_ffv_269;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_270> AgradCcdfLogExpModNormal_ffv_270;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_271> AgradCcdfLogExpModNormal_ffv_271;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_272> AgradCcdfLogExpModNormal_ffv_272;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_273> AgradCcdfLogExpModNormal_ffv_273;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_274> AgradCcdfLogExpModNormal_ffv_274;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_275> AgradCcdfLogExpModNormal_ffv_275;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_276> AgradCcdfLogExpModNormal_ffv_276;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_277> AgradCcdfLogExpModNormal_ffv_277;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_278> AgradCcdfLogExpModNormal_ffv_278;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_279> AgradCcdfLogExpModNormal_ffv_279;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_280> AgradCcdfLogExpModNormal_ffv_280;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_281> AgradCcdfLogExpModNormal_ffv_281;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_282> AgradCcdfLogExpModNormal_ffv_282;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_283> AgradCcdfLogExpModNormal_ffv_283;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_284> AgradCcdfLogExpModNormal_ffv_284;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_285> AgradCcdfLogExpModNormal_ffv_285;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_286> AgradCcdfLogExpModNormal_ffv_286;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_287> AgradCcdfLogExpModNormal_ffv_287;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_288> AgradCcdfLogExpModNormal_ffv_288;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_289> AgradCcdfLogExpModNormal_ffv_289;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_290> AgradCcdfLogExpModNormal_ffv_290;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_291> AgradCcdfLogExpModNormal_ffv_291;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_292> AgradCcdfLogExpModNormal_ffv_292;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_293> AgradCcdfLogExpModNormal_ffv_293;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_294> AgradCcdfLogExpModNormal_ffv_294;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_295> AgradCcdfLogExpModNormal_ffv_295;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_296> AgradCcdfLogExpModNormal_ffv_296;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_297> AgradCcdfLogExpModNormal_ffv_297;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_298> AgradCcdfLogExpModNormal_ffv_298;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_299> AgradCcdfLogExpModNormal_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_200, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_201, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_202, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_203, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_204, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_205, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_206, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_207, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_208, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_209, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_210, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_211, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_212, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_213, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_214, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_215, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_216, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_217, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_218, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_219, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_220, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_221, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_222, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_223, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_224, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_225, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_226, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_227, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_228, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_229, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_230, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_231, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_232, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_233, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_234, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_235, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_236, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_237, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_238, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_239, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_240, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_241, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_242, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_243, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_244, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_245, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_246, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_247, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_248, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_249, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_250, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_251, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_252, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_253, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_254, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_255, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_256, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_257, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_258, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_259, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_260, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_261, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_262, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_263, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_264, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_265, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_266, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_267, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_268, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_269, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_270, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_271, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_272, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_273, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_274, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_275, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_276, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_277, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_278, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_279, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_280, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_281, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_282, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_283, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_284, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_285, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_286, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_287, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_288, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_289, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_290, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_291, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_292, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_293, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_294, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_295, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_296, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_297, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_298, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_299, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_299);
+
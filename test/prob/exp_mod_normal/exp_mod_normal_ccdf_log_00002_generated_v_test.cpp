@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<double>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<double>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_200> AgradCcdfLogExpModNormal_v_200;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_201> AgradCcdfLogExpModNormal_v_201;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_202> AgradCcdfLogExpModNormal_v_202;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_203> AgradCcdfLogExpModNormal_v_203;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_204> AgradCcdfLogExpModNormal_v_204;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_205> AgradCcdfLogExpModNormal_v_205;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_206> AgradCcdfLogExpModNormal_v_206;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_207> AgradCcdfLogExpModNormal_v_207;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_208> AgradCcdfLogExpModNormal_v_208;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_209> AgradCcdfLogExpModNormal_v_209;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_210> AgradCcdfLogExpModNormal_v_210;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_211> AgradCcdfLogExpModNormal_v_211;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_212> AgradCcdfLogExpModNormal_v_212;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_213> AgradCcdfLogExpModNormal_v_213;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_214> AgradCcdfLogExpModNormal_v_214;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_215> AgradCcdfLogExpModNormal_v_215;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_216> AgradCcdfLogExpModNormal_v_216;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_217> AgradCcdfLogExpModNormal_v_217;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_218> AgradCcdfLogExpModNormal_v_218;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_219> AgradCcdfLogExpModNormal_v_219;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_220> AgradCcdfLogExpModNormal_v_220;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_221> AgradCcdfLogExpModNormal_v_221;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_222> AgradCcdfLogExpModNormal_v_222;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_223> AgradCcdfLogExpModNormal_v_223;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_224> AgradCcdfLogExpModNormal_v_224;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_225> AgradCcdfLogExpModNormal_v_225;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_226> AgradCcdfLogExpModNormal_v_226;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_227> AgradCcdfLogExpModNormal_v_227;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_228> AgradCcdfLogExpModNormal_v_228;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_229> AgradCcdfLogExpModNormal_v_229;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_230> AgradCcdfLogExpModNormal_v_230;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_231> AgradCcdfLogExpModNormal_v_231;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_232> AgradCcdfLogExpModNormal_v_232;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_233> AgradCcdfLogExpModNormal_v_233;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_234> AgradCcdfLogExpModNormal_v_234;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_235> AgradCcdfLogExpModNormal_v_235;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_236> AgradCcdfLogExpModNormal_v_236;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_237> AgradCcdfLogExpModNormal_v_237;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_238> AgradCcdfLogExpModNormal_v_238;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_239> AgradCcdfLogExpModNormal_v_239;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_240> AgradCcdfLogExpModNormal_v_240;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_241> AgradCcdfLogExpModNormal_v_241;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_242> AgradCcdfLogExpModNormal_v_242;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_243> AgradCcdfLogExpModNormal_v_243;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_244> AgradCcdfLogExpModNormal_v_244;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_245> AgradCcdfLogExpModNormal_v_245;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_246> AgradCcdfLogExpModNormal_v_246;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_247> AgradCcdfLogExpModNormal_v_247;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_248> AgradCcdfLogExpModNormal_v_248;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_249> AgradCcdfLogExpModNormal_v_249;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_250> AgradCcdfLogExpModNormal_v_250;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_251> AgradCcdfLogExpModNormal_v_251;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_252> AgradCcdfLogExpModNormal_v_252;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_253> AgradCcdfLogExpModNormal_v_253;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_254> AgradCcdfLogExpModNormal_v_254;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_255> AgradCcdfLogExpModNormal_v_255;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_256> AgradCcdfLogExpModNormal_v_256;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_257> AgradCcdfLogExpModNormal_v_257;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_258> AgradCcdfLogExpModNormal_v_258;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_259> AgradCcdfLogExpModNormal_v_259;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_260> AgradCcdfLogExpModNormal_v_260;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_261> AgradCcdfLogExpModNormal_v_261;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_262> AgradCcdfLogExpModNormal_v_262;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_263> AgradCcdfLogExpModNormal_v_263;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_264> AgradCcdfLogExpModNormal_v_264;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_265> AgradCcdfLogExpModNormal_v_265;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_266> AgradCcdfLogExpModNormal_v_266;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_267> AgradCcdfLogExpModNormal_v_267;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_268> AgradCcdfLogExpModNormal_v_268;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_269> AgradCcdfLogExpModNormal_v_269;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_270> AgradCcdfLogExpModNormal_v_270;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_271> AgradCcdfLogExpModNormal_v_271;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_272> AgradCcdfLogExpModNormal_v_272;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_273> AgradCcdfLogExpModNormal_v_273;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_274> AgradCcdfLogExpModNormal_v_274;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_275> AgradCcdfLogExpModNormal_v_275;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_276> AgradCcdfLogExpModNormal_v_276;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_277> AgradCcdfLogExpModNormal_v_277;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_278> AgradCcdfLogExpModNormal_v_278;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_279> AgradCcdfLogExpModNormal_v_279;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_280> AgradCcdfLogExpModNormal_v_280;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_281> AgradCcdfLogExpModNormal_v_281;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_282> AgradCcdfLogExpModNormal_v_282;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_283> AgradCcdfLogExpModNormal_v_283;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_284> AgradCcdfLogExpModNormal_v_284;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_285> AgradCcdfLogExpModNormal_v_285;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_286> AgradCcdfLogExpModNormal_v_286;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_287> AgradCcdfLogExpModNormal_v_287;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_288> AgradCcdfLogExpModNormal_v_288;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_289> AgradCcdfLogExpModNormal_v_289;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_290> AgradCcdfLogExpModNormal_v_290;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_291> AgradCcdfLogExpModNormal_v_291;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_292> AgradCcdfLogExpModNormal_v_292;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_293> AgradCcdfLogExpModNormal_v_293;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_294> AgradCcdfLogExpModNormal_v_294;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_295> AgradCcdfLogExpModNormal_v_295;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_296> AgradCcdfLogExpModNormal_v_296;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_297> AgradCcdfLogExpModNormal_v_297;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_298> AgradCcdfLogExpModNormal_v_298;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_299> AgradCcdfLogExpModNormal_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_200, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_201, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_202, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_203, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_204, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_205, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_206, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_207, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_208, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_209, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_210, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_211, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_212, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_213, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_214, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_215, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_216, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_217, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_218, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_219, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_220, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_221, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_222, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_223, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_224, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_225, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_226, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_227, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_228, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_229, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_230, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_231, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_232, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_233, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_234, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_235, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_236, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_237, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_238, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_239, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_240, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_241, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_242, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_243, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_244, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_245, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_246, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_247, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_248, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_249, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_250, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_251, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_252, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_253, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_254, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_255, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_256, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_257, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_258, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_259, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_260, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_261, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_262, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_263, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_264, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_265, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_266, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_267, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_268, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_269, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_270, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_271, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_272, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_273, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_274, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_275, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_276, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_277, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_278, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_279, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_280, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_281, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_282, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_283, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_284, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_285, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_286, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_287, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_288, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_289, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_290, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_291, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_292, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_293, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_294, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_295, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_296, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_297, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_298, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_299, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_299);
+
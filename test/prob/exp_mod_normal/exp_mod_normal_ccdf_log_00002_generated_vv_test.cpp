@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<double>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<double>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<double>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_200> AgradCcdfLogExpModNormal_vv_200;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_201> AgradCcdfLogExpModNormal_vv_201;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_202> AgradCcdfLogExpModNormal_vv_202;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_203> AgradCcdfLogExpModNormal_vv_203;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_204> AgradCcdfLogExpModNormal_vv_204;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_205> AgradCcdfLogExpModNormal_vv_205;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_206> AgradCcdfLogExpModNormal_vv_206;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_207> AgradCcdfLogExpModNormal_vv_207;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_208> AgradCcdfLogExpModNormal_vv_208;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_209> AgradCcdfLogExpModNormal_vv_209;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_210> AgradCcdfLogExpModNormal_vv_210;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_211> AgradCcdfLogExpModNormal_vv_211;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_212> AgradCcdfLogExpModNormal_vv_212;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_213> AgradCcdfLogExpModNormal_vv_213;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_214> AgradCcdfLogExpModNormal_vv_214;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_215> AgradCcdfLogExpModNormal_vv_215;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_216> AgradCcdfLogExpModNormal_vv_216;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_217> AgradCcdfLogExpModNormal_vv_217;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_218> AgradCcdfLogExpModNormal_vv_218;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_219> AgradCcdfLogExpModNormal_vv_219;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_220> AgradCcdfLogExpModNormal_vv_220;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_221> AgradCcdfLogExpModNormal_vv_221;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_222> AgradCcdfLogExpModNormal_vv_222;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_223> AgradCcdfLogExpModNormal_vv_223;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_224> AgradCcdfLogExpModNormal_vv_224;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_225> AgradCcdfLogExpModNormal_vv_225;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_226> AgradCcdfLogExpModNormal_vv_226;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_227> AgradCcdfLogExpModNormal_vv_227;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_228> AgradCcdfLogExpModNormal_vv_228;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_229> AgradCcdfLogExpModNormal_vv_229;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_230> AgradCcdfLogExpModNormal_vv_230;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_231> AgradCcdfLogExpModNormal_vv_231;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_232> AgradCcdfLogExpModNormal_vv_232;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_233> AgradCcdfLogExpModNormal_vv_233;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_234> AgradCcdfLogExpModNormal_vv_234;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_235> AgradCcdfLogExpModNormal_vv_235;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_236> AgradCcdfLogExpModNormal_vv_236;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_237> AgradCcdfLogExpModNormal_vv_237;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_238> AgradCcdfLogExpModNormal_vv_238;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_239> AgradCcdfLogExpModNormal_vv_239;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_240> AgradCcdfLogExpModNormal_vv_240;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_241> AgradCcdfLogExpModNormal_vv_241;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_242> AgradCcdfLogExpModNormal_vv_242;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_243> AgradCcdfLogExpModNormal_vv_243;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_244> AgradCcdfLogExpModNormal_vv_244;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_245> AgradCcdfLogExpModNormal_vv_245;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_246> AgradCcdfLogExpModNormal_vv_246;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_247> AgradCcdfLogExpModNormal_vv_247;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_248> AgradCcdfLogExpModNormal_vv_248;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_249> AgradCcdfLogExpModNormal_vv_249;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_250> AgradCcdfLogExpModNormal_vv_250;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_251> AgradCcdfLogExpModNormal_vv_251;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_252> AgradCcdfLogExpModNormal_vv_252;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_253> AgradCcdfLogExpModNormal_vv_253;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_254> AgradCcdfLogExpModNormal_vv_254;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_255> AgradCcdfLogExpModNormal_vv_255;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_256> AgradCcdfLogExpModNormal_vv_256;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_257> AgradCcdfLogExpModNormal_vv_257;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_258> AgradCcdfLogExpModNormal_vv_258;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_259> AgradCcdfLogExpModNormal_vv_259;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_260> AgradCcdfLogExpModNormal_vv_260;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_261> AgradCcdfLogExpModNormal_vv_261;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_262> AgradCcdfLogExpModNormal_vv_262;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_263> AgradCcdfLogExpModNormal_vv_263;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_264> AgradCcdfLogExpModNormal_vv_264;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_265> AgradCcdfLogExpModNormal_vv_265;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_266> AgradCcdfLogExpModNormal_vv_266;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_267> AgradCcdfLogExpModNormal_vv_267;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_268> AgradCcdfLogExpModNormal_vv_268;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_269> AgradCcdfLogExpModNormal_vv_269;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_270> AgradCcdfLogExpModNormal_vv_270;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_271> AgradCcdfLogExpModNormal_vv_271;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_272> AgradCcdfLogExpModNormal_vv_272;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_273> AgradCcdfLogExpModNormal_vv_273;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_274> AgradCcdfLogExpModNormal_vv_274;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_275> AgradCcdfLogExpModNormal_vv_275;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_276> AgradCcdfLogExpModNormal_vv_276;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_277> AgradCcdfLogExpModNormal_vv_277;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_278> AgradCcdfLogExpModNormal_vv_278;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_279> AgradCcdfLogExpModNormal_vv_279;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_280> AgradCcdfLogExpModNormal_vv_280;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_281> AgradCcdfLogExpModNormal_vv_281;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_282> AgradCcdfLogExpModNormal_vv_282;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_283> AgradCcdfLogExpModNormal_vv_283;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_284> AgradCcdfLogExpModNormal_vv_284;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_285> AgradCcdfLogExpModNormal_vv_285;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_286> AgradCcdfLogExpModNormal_vv_286;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_287> AgradCcdfLogExpModNormal_vv_287;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_288> AgradCcdfLogExpModNormal_vv_288;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_289> AgradCcdfLogExpModNormal_vv_289;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_290> AgradCcdfLogExpModNormal_vv_290;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_291> AgradCcdfLogExpModNormal_vv_291;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_292> AgradCcdfLogExpModNormal_vv_292;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_293> AgradCcdfLogExpModNormal_vv_293;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_294> AgradCcdfLogExpModNormal_vv_294;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_295> AgradCcdfLogExpModNormal_vv_295;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_296> AgradCcdfLogExpModNormal_vv_296;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_297> AgradCcdfLogExpModNormal_vv_297;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_298> AgradCcdfLogExpModNormal_vv_298;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_299> AgradCcdfLogExpModNormal_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_200, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_201, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_202, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_203, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_204, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_205, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_206, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_207, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_208, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_209, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_210, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_211, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_212, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_213, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_214, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_215, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_216, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_217, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_218, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_219, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_220, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_221, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_222, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_223, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_224, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_225, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_226, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_227, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_228, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_229, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_230, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_231, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_232, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_233, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_234, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_235, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_236, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_237, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_238, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_239, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_240, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_241, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_242, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_243, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_244, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_245, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_246, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_247, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_248, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_249, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_250, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_251, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_252, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_253, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_254, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_255, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_256, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_257, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_258, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_259, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_260, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_261, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_262, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_263, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_264, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_265, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_266, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_267, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_268, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_269, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_270, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_271, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_272, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_273, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_274, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_275, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_276, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_277, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_278, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_279, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_280, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_281, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_282, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_283, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_284, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_285, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_286, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_287, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_288, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_289, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_290, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_291, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_292, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_293, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_294, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_295, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_296, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_297, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_298, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_299, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_300> AgradCcdfLogExpModNormal_ffv_300;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_301> AgradCcdfLogExpModNormal_ffv_301;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_302> AgradCcdfLogExpModNormal_ffv_302;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_303> AgradCcdfLogExpModNormal_ffv_303;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_304> AgradCcdfLogExpModNormal_ffv_304;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_305> AgradCcdfLogExpModNormal_ffv_305;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_306> AgradCcdfLogExpModNormal_ffv_306;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_307> AgradCcdfLogExpModNormal_ffv_307;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_308> AgradCcdfLogExpModNormal_ffv_308;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_309> AgradCcdfLogExpModNormal_ffv_309;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_310> AgradCcdfLogExpModNormal_ffv_310;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_311> AgradCcdfLogExpModNormal_ffv_311;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_312> AgradCcdfLogExpModNormal_ffv_312;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_313> AgradCcdfLogExpModNormal_ffv_313;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_314> AgradCcdfLogExpModNormal_ffv_314;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_315> AgradCcdfLogExpModNormal_ffv_315;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_316> AgradCcdfLogExpModNormal_ffv_316;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_317> AgradCcdfLogExpModNormal_ffv_317;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_318> AgradCcdfLogExpModNormal_ffv_318;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_319> AgradCcdfLogExpModNormal_ffv_319;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_320> AgradCcdfLogExpModNormal_ffv_320;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_321> AgradCcdfLogExpModNormal_ffv_321;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_322> AgradCcdfLogExpModNormal_ffv_322;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_323> AgradCcdfLogExpModNormal_ffv_323;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_324> AgradCcdfLogExpModNormal_ffv_324;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_325> AgradCcdfLogExpModNormal_ffv_325;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_326> AgradCcdfLogExpModNormal_ffv_326;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_327> AgradCcdfLogExpModNormal_ffv_327;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_328> AgradCcdfLogExpModNormal_ffv_328;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_329> AgradCcdfLogExpModNormal_ffv_329;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_330> AgradCcdfLogExpModNormal_ffv_330;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_331> AgradCcdfLogExpModNormal_ffv_331;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_332> AgradCcdfLogExpModNormal_ffv_332;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_333> AgradCcdfLogExpModNormal_ffv_333;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_334> AgradCcdfLogExpModNormal_ffv_334;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_335> AgradCcdfLogExpModNormal_ffv_335;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_336> AgradCcdfLogExpModNormal_ffv_336;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_337> AgradCcdfLogExpModNormal_ffv_337;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_338> AgradCcdfLogExpModNormal_ffv_338;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_339> AgradCcdfLogExpModNormal_ffv_339;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_340> AgradCcdfLogExpModNormal_ffv_340;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_341> AgradCcdfLogExpModNormal_ffv_341;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_342> AgradCcdfLogExpModNormal_ffv_342;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_343> AgradCcdfLogExpModNormal_ffv_343;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_344> AgradCcdfLogExpModNormal_ffv_344;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_345> AgradCcdfLogExpModNormal_ffv_345;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_346> AgradCcdfLogExpModNormal_ffv_346;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_347> AgradCcdfLogExpModNormal_ffv_347;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_348> AgradCcdfLogExpModNormal_ffv_348;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_349> AgradCcdfLogExpModNormal_ffv_349;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_350> AgradCcdfLogExpModNormal_ffv_350;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_351> AgradCcdfLogExpModNormal_ffv_351;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_352> AgradCcdfLogExpModNormal_ffv_352;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_353> AgradCcdfLogExpModNormal_ffv_353;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_354> AgradCcdfLogExpModNormal_ffv_354;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_355> AgradCcdfLogExpModNormal_ffv_355;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_356> AgradCcdfLogExpModNormal_ffv_356;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_357> AgradCcdfLogExpModNormal_ffv_357;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_358> AgradCcdfLogExpModNormal_ffv_358;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_359> AgradCcdfLogExpModNormal_ffv_359;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_360> AgradCcdfLogExpModNormal_ffv_360;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_361> AgradCcdfLogExpModNormal_ffv_361;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_362> AgradCcdfLogExpModNormal_ffv_362;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_363> AgradCcdfLogExpModNormal_ffv_363;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_364> AgradCcdfLogExpModNormal_ffv_364;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_365> AgradCcdfLogExpModNormal_ffv_365;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_366> AgradCcdfLogExpModNormal_ffv_366;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_367> AgradCcdfLogExpModNormal_ffv_367;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_368> AgradCcdfLogExpModNormal_ffv_368;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_369> AgradCcdfLogExpModNormal_ffv_369;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_370> AgradCcdfLogExpModNormal_ffv_370;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_371> AgradCcdfLogExpModNormal_ffv_371;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_372> AgradCcdfLogExpModNormal_ffv_372;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_373> AgradCcdfLogExpModNormal_ffv_373;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_374> AgradCcdfLogExpModNormal_ffv_374;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_375> AgradCcdfLogExpModNormal_ffv_375;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_376> AgradCcdfLogExpModNormal_ffv_376;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_377> AgradCcdfLogExpModNormal_ffv_377;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_378> AgradCcdfLogExpModNormal_ffv_378;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_379> AgradCcdfLogExpModNormal_ffv_379;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_380> AgradCcdfLogExpModNormal_ffv_380;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_381> AgradCcdfLogExpModNormal_ffv_381;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_382> AgradCcdfLogExpModNormal_ffv_382;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_383> AgradCcdfLogExpModNormal_ffv_383;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_384> AgradCcdfLogExpModNormal_ffv_384;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_385> AgradCcdfLogExpModNormal_ffv_385;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_386> AgradCcdfLogExpModNormal_ffv_386;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_387> AgradCcdfLogExpModNormal_ffv_387;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_388> AgradCcdfLogExpModNormal_ffv_388;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_389> AgradCcdfLogExpModNormal_ffv_389;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_390> AgradCcdfLogExpModNormal_ffv_390;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_391> AgradCcdfLogExpModNormal_ffv_391;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_392> AgradCcdfLogExpModNormal_ffv_392;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_393> AgradCcdfLogExpModNormal_ffv_393;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_394> AgradCcdfLogExpModNormal_ffv_394;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_395> AgradCcdfLogExpModNormal_ffv_395;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_396> AgradCcdfLogExpModNormal_ffv_396;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_397> AgradCcdfLogExpModNormal_ffv_397;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_398> AgradCcdfLogExpModNormal_ffv_398;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_399> AgradCcdfLogExpModNormal_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_300, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_301, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_302, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_303, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_304, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_305, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_306, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_307, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_308, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_309, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_310, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_311, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_312, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_313, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_314, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_315, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_316, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_317, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_318, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_319, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_320, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_321, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_322, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_323, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_324, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_325, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_326, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_327, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_328, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_329, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_330, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_331, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_332, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_333, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_334, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_335, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_336, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_337, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_338, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_339, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_340, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_341, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_342, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_343, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_344, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_345, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_346, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_347, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_348, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_349, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_350, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_351, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_352, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_353, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_354, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_355, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_356, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_357, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_358, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_359, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_360, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_361, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_362, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_363, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_364, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_365, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_366, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_367, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_368, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_369, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_370, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_371, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_372, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_373, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_374, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_375, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_376, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_377, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_378, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_379, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_380, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_381, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_382, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_383, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_384, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_385, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_386, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_387, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_388, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_389, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_390, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_391, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_392, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_393, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_394, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_395, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_396, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_397, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_398, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_399, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_399);
+
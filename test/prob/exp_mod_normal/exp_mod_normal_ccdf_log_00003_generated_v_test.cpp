@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_300> AgradCcdfLogExpModNormal_v_300;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_301> AgradCcdfLogExpModNormal_v_301;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_302> AgradCcdfLogExpModNormal_v_302;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_303> AgradCcdfLogExpModNormal_v_303;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_304> AgradCcdfLogExpModNormal_v_304;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_305> AgradCcdfLogExpModNormal_v_305;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_306> AgradCcdfLogExpModNormal_v_306;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_307> AgradCcdfLogExpModNormal_v_307;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_308> AgradCcdfLogExpModNormal_v_308;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_309> AgradCcdfLogExpModNormal_v_309;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_310> AgradCcdfLogExpModNormal_v_310;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_311> AgradCcdfLogExpModNormal_v_311;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_312> AgradCcdfLogExpModNormal_v_312;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_313> AgradCcdfLogExpModNormal_v_313;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_314> AgradCcdfLogExpModNormal_v_314;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_315> AgradCcdfLogExpModNormal_v_315;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_316> AgradCcdfLogExpModNormal_v_316;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_317> AgradCcdfLogExpModNormal_v_317;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_318> AgradCcdfLogExpModNormal_v_318;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_319> AgradCcdfLogExpModNormal_v_319;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_320> AgradCcdfLogExpModNormal_v_320;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_321> AgradCcdfLogExpModNormal_v_321;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_322> AgradCcdfLogExpModNormal_v_322;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_323> AgradCcdfLogExpModNormal_v_323;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_324> AgradCcdfLogExpModNormal_v_324;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_325> AgradCcdfLogExpModNormal_v_325;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_326> AgradCcdfLogExpModNormal_v_326;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_327> AgradCcdfLogExpModNormal_v_327;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_328> AgradCcdfLogExpModNormal_v_328;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_329> AgradCcdfLogExpModNormal_v_329;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_330> AgradCcdfLogExpModNormal_v_330;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_331> AgradCcdfLogExpModNormal_v_331;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_332> AgradCcdfLogExpModNormal_v_332;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_333> AgradCcdfLogExpModNormal_v_333;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_334> AgradCcdfLogExpModNormal_v_334;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_335> AgradCcdfLogExpModNormal_v_335;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_336> AgradCcdfLogExpModNormal_v_336;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_337> AgradCcdfLogExpModNormal_v_337;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_338> AgradCcdfLogExpModNormal_v_338;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_339> AgradCcdfLogExpModNormal_v_339;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_340> AgradCcdfLogExpModNormal_v_340;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_341> AgradCcdfLogExpModNormal_v_341;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_342> AgradCcdfLogExpModNormal_v_342;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_343> AgradCcdfLogExpModNormal_v_343;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_344> AgradCcdfLogExpModNormal_v_344;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_345> AgradCcdfLogExpModNormal_v_345;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_346> AgradCcdfLogExpModNormal_v_346;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_347> AgradCcdfLogExpModNormal_v_347;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_348> AgradCcdfLogExpModNormal_v_348;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_349> AgradCcdfLogExpModNormal_v_349;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_350> AgradCcdfLogExpModNormal_v_350;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_351> AgradCcdfLogExpModNormal_v_351;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_352> AgradCcdfLogExpModNormal_v_352;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_353> AgradCcdfLogExpModNormal_v_353;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_354> AgradCcdfLogExpModNormal_v_354;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_355> AgradCcdfLogExpModNormal_v_355;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_356> AgradCcdfLogExpModNormal_v_356;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_357> AgradCcdfLogExpModNormal_v_357;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_358> AgradCcdfLogExpModNormal_v_358;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_359> AgradCcdfLogExpModNormal_v_359;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_360> AgradCcdfLogExpModNormal_v_360;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_361> AgradCcdfLogExpModNormal_v_361;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_362> AgradCcdfLogExpModNormal_v_362;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_363> AgradCcdfLogExpModNormal_v_363;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_364> AgradCcdfLogExpModNormal_v_364;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_365> AgradCcdfLogExpModNormal_v_365;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_366> AgradCcdfLogExpModNormal_v_366;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_367> AgradCcdfLogExpModNormal_v_367;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_368> AgradCcdfLogExpModNormal_v_368;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_369> AgradCcdfLogExpModNormal_v_369;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_370> AgradCcdfLogExpModNormal_v_370;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_371> AgradCcdfLogExpModNormal_v_371;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_372> AgradCcdfLogExpModNormal_v_372;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_373> AgradCcdfLogExpModNormal_v_373;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_374> AgradCcdfLogExpModNormal_v_374;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_375> AgradCcdfLogExpModNormal_v_375;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_376> AgradCcdfLogExpModNormal_v_376;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_377> AgradCcdfLogExpModNormal_v_377;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_378> AgradCcdfLogExpModNormal_v_378;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_379> AgradCcdfLogExpModNormal_v_379;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_380> AgradCcdfLogExpModNormal_v_380;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_381> AgradCcdfLogExpModNormal_v_381;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_382> AgradCcdfLogExpModNormal_v_382;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_383> AgradCcdfLogExpModNormal_v_383;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_384> AgradCcdfLogExpModNormal_v_384;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_385> AgradCcdfLogExpModNormal_v_385;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_386> AgradCcdfLogExpModNormal_v_386;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_387> AgradCcdfLogExpModNormal_v_387;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_388> AgradCcdfLogExpModNormal_v_388;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_389> AgradCcdfLogExpModNormal_v_389;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_390> AgradCcdfLogExpModNormal_v_390;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_391> AgradCcdfLogExpModNormal_v_391;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_392> AgradCcdfLogExpModNormal_v_392;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_393> AgradCcdfLogExpModNormal_v_393;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_394> AgradCcdfLogExpModNormal_v_394;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_395> AgradCcdfLogExpModNormal_v_395;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_396> AgradCcdfLogExpModNormal_v_396;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_397> AgradCcdfLogExpModNormal_v_397;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_398> AgradCcdfLogExpModNormal_v_398;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_399> AgradCcdfLogExpModNormal_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_300, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_301, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_302, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_303, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_304, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_305, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_306, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_307, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_308, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_309, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_310, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_311, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_312, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_313, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_314, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_315, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_316, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_317, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_318, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_319, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_320, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_321, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_322, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_323, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_324, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_325, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_326, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_327, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_328, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_329, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_330, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_331, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_332, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_333, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_334, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_335, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_336, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_337, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_338, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_339, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_340, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_341, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_342, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_343, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_344, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_345, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_346, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_347, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_348, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_349, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_350, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_351, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_352, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_353, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_354, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_355, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_356, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_357, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_358, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_359, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_360, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_361, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_362, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_363, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_364, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_365, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_366, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_367, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_368, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_369, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_370, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_371, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_372, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_373, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_374, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_375, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_376, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_377, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_378, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_379, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_380, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_381, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_382, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_383, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_384, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_385, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_386, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_387, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_388, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_389, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_390, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_391, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_392, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_393, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_394, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_395, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_396, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_397, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_398, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_399, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_300> AgradCcdfLogExpModNormal_vv_300;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_301> AgradCcdfLogExpModNormal_vv_301;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_302> AgradCcdfLogExpModNormal_vv_302;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_303> AgradCcdfLogExpModNormal_vv_303;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_304> AgradCcdfLogExpModNormal_vv_304;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_305> AgradCcdfLogExpModNormal_vv_305;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_306> AgradCcdfLogExpModNormal_vv_306;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_307> AgradCcdfLogExpModNormal_vv_307;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_308> AgradCcdfLogExpModNormal_vv_308;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_309> AgradCcdfLogExpModNormal_vv_309;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_310> AgradCcdfLogExpModNormal_vv_310;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_311> AgradCcdfLogExpModNormal_vv_311;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_312> AgradCcdfLogExpModNormal_vv_312;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_313> AgradCcdfLogExpModNormal_vv_313;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_314> AgradCcdfLogExpModNormal_vv_314;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_315> AgradCcdfLogExpModNormal_vv_315;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_316> AgradCcdfLogExpModNormal_vv_316;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_317> AgradCcdfLogExpModNormal_vv_317;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_318> AgradCcdfLogExpModNormal_vv_318;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_319> AgradCcdfLogExpModNormal_vv_319;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_320> AgradCcdfLogExpModNormal_vv_320;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_321> AgradCcdfLogExpModNormal_vv_321;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_322> AgradCcdfLogExpModNormal_vv_322;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_323> AgradCcdfLogExpModNormal_vv_323;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_324> AgradCcdfLogExpModNormal_vv_324;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_325> AgradCcdfLogExpModNormal_vv_325;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_326> AgradCcdfLogExpModNormal_vv_326;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_327> AgradCcdfLogExpModNormal_vv_327;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_328> AgradCcdfLogExpModNormal_vv_328;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_329> AgradCcdfLogExpModNormal_vv_329;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_330> AgradCcdfLogExpModNormal_vv_330;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_331> AgradCcdfLogExpModNormal_vv_331;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_332> AgradCcdfLogExpModNormal_vv_332;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_333> AgradCcdfLogExpModNormal_vv_333;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_334> AgradCcdfLogExpModNormal_vv_334;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_335> AgradCcdfLogExpModNormal_vv_335;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_336> AgradCcdfLogExpModNormal_vv_336;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_337> AgradCcdfLogExpModNormal_vv_337;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_338> AgradCcdfLogExpModNormal_vv_338;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_339> AgradCcdfLogExpModNormal_vv_339;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_340> AgradCcdfLogExpModNormal_vv_340;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_341> AgradCcdfLogExpModNormal_vv_341;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_342> AgradCcdfLogExpModNormal_vv_342;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_343> AgradCcdfLogExpModNormal_vv_343;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_344> AgradCcdfLogExpModNormal_vv_344;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_345> AgradCcdfLogExpModNormal_vv_345;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_346> AgradCcdfLogExpModNormal_vv_346;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_347> AgradCcdfLogExpModNormal_vv_347;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_348> AgradCcdfLogExpModNormal_vv_348;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_349> AgradCcdfLogExpModNormal_vv_349;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_350> AgradCcdfLogExpModNormal_vv_350;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_351> AgradCcdfLogExpModNormal_vv_351;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_352> AgradCcdfLogExpModNormal_vv_352;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_353> AgradCcdfLogExpModNormal_vv_353;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_354> AgradCcdfLogExpModNormal_vv_354;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_355> AgradCcdfLogExpModNormal_vv_355;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_356> AgradCcdfLogExpModNormal_vv_356;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_357> AgradCcdfLogExpModNormal_vv_357;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_358> AgradCcdfLogExpModNormal_vv_358;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_359> AgradCcdfLogExpModNormal_vv_359;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_360> AgradCcdfLogExpModNormal_vv_360;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_361> AgradCcdfLogExpModNormal_vv_361;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_362> AgradCcdfLogExpModNormal_vv_362;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_363> AgradCcdfLogExpModNormal_vv_363;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_364> AgradCcdfLogExpModNormal_vv_364;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_365> AgradCcdfLogExpModNormal_vv_365;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_366> AgradCcdfLogExpModNormal_vv_366;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_367> AgradCcdfLogExpModNormal_vv_367;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_368> AgradCcdfLogExpModNormal_vv_368;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_369> AgradCcdfLogExpModNormal_vv_369;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_370> AgradCcdfLogExpModNormal_vv_370;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_371> AgradCcdfLogExpModNormal_vv_371;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_372> AgradCcdfLogExpModNormal_vv_372;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_373> AgradCcdfLogExpModNormal_vv_373;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_374> AgradCcdfLogExpModNormal_vv_374;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_375> AgradCcdfLogExpModNormal_vv_375;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_376> AgradCcdfLogExpModNormal_vv_376;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_377> AgradCcdfLogExpModNormal_vv_377;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_378> AgradCcdfLogExpModNormal_vv_378;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_379> AgradCcdfLogExpModNormal_vv_379;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_380> AgradCcdfLogExpModNormal_vv_380;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_381> AgradCcdfLogExpModNormal_vv_381;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_382> AgradCcdfLogExpModNormal_vv_382;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_383> AgradCcdfLogExpModNormal_vv_383;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_384> AgradCcdfLogExpModNormal_vv_384;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_385> AgradCcdfLogExpModNormal_vv_385;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_386> AgradCcdfLogExpModNormal_vv_386;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_387> AgradCcdfLogExpModNormal_vv_387;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_388> AgradCcdfLogExpModNormal_vv_388;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_389> AgradCcdfLogExpModNormal_vv_389;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_390> AgradCcdfLogExpModNormal_vv_390;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_391> AgradCcdfLogExpModNormal_vv_391;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_392> AgradCcdfLogExpModNormal_vv_392;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_393> AgradCcdfLogExpModNormal_vv_393;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_394> AgradCcdfLogExpModNormal_vv_394;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_395> AgradCcdfLogExpModNormal_vv_395;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_396> AgradCcdfLogExpModNormal_vv_396;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_397> AgradCcdfLogExpModNormal_vv_397;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_398> AgradCcdfLogExpModNormal_vv_398;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_399> AgradCcdfLogExpModNormal_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_300, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_301, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_302, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_303, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_304, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_305, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_306, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_307, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_308, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_309, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_310, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_311, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_312, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_313, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_314, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_315, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_316, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_317, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_318, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_319, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_320, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_321, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_322, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_323, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_324, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_325, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_326, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_327, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_328, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_329, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_330, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_331, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_332, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_333, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_334, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_335, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_336, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_337, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_338, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_339, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_340, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_341, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_342, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_343, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_344, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_345, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_346, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_347, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_348, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_349, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_350, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_351, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_352, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_353, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_354, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_355, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_356, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_357, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_358, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_359, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_360, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_361, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_362, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_363, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_364, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_365, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_366, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_367, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_368, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_369, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_370, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_371, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_372, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_373, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_374, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_375, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_376, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_377, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_378, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_379, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_380, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_381, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_382, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_383, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_384, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_385, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_386, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_387, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_388, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_389, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_390, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_391, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_392, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_393, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_394, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_395, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_396, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_397, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_398, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_399, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_400> AgradCcdfLogExpModNormal_ffv_400;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_401> AgradCcdfLogExpModNormal_ffv_401;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_402> AgradCcdfLogExpModNormal_ffv_402;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_403> AgradCcdfLogExpModNormal_ffv_403;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_404> AgradCcdfLogExpModNormal_ffv_404;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_405> AgradCcdfLogExpModNormal_ffv_405;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_406> AgradCcdfLogExpModNormal_ffv_406;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_407> AgradCcdfLogExpModNormal_ffv_407;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_408> AgradCcdfLogExpModNormal_ffv_408;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_409> AgradCcdfLogExpModNormal_ffv_409;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_410> AgradCcdfLogExpModNormal_ffv_410;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_411> AgradCcdfLogExpModNormal_ffv_411;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_412> AgradCcdfLogExpModNormal_ffv_412;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_413> AgradCcdfLogExpModNormal_ffv_413;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_414> AgradCcdfLogExpModNormal_ffv_414;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_415> AgradCcdfLogExpModNormal_ffv_415;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_416> AgradCcdfLogExpModNormal_ffv_416;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_417> AgradCcdfLogExpModNormal_ffv_417;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_418> AgradCcdfLogExpModNormal_ffv_418;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_419> AgradCcdfLogExpModNormal_ffv_419;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_420> AgradCcdfLogExpModNormal_ffv_420;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_421> AgradCcdfLogExpModNormal_ffv_421;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_422> AgradCcdfLogExpModNormal_ffv_422;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_423> AgradCcdfLogExpModNormal_ffv_423;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_424> AgradCcdfLogExpModNormal_ffv_424;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_425> AgradCcdfLogExpModNormal_ffv_425;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_426> AgradCcdfLogExpModNormal_ffv_426;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_427> AgradCcdfLogExpModNormal_ffv_427;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_428> AgradCcdfLogExpModNormal_ffv_428;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_429> AgradCcdfLogExpModNormal_ffv_429;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_430> AgradCcdfLogExpModNormal_ffv_430;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_431> AgradCcdfLogExpModNormal_ffv_431;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_432> AgradCcdfLogExpModNormal_ffv_432;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_433> AgradCcdfLogExpModNormal_ffv_433;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_434> AgradCcdfLogExpModNormal_ffv_434;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_435> AgradCcdfLogExpModNormal_ffv_435;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_436> AgradCcdfLogExpModNormal_ffv_436;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_437> AgradCcdfLogExpModNormal_ffv_437;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_438> AgradCcdfLogExpModNormal_ffv_438;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_439> AgradCcdfLogExpModNormal_ffv_439;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_440> AgradCcdfLogExpModNormal_ffv_440;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_441> AgradCcdfLogExpModNormal_ffv_441;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_442> AgradCcdfLogExpModNormal_ffv_442;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_443> AgradCcdfLogExpModNormal_ffv_443;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_444> AgradCcdfLogExpModNormal_ffv_444;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_445> AgradCcdfLogExpModNormal_ffv_445;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_446> AgradCcdfLogExpModNormal_ffv_446;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_447> AgradCcdfLogExpModNormal_ffv_447;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_448> AgradCcdfLogExpModNormal_ffv_448;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_449> AgradCcdfLogExpModNormal_ffv_449;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_450> AgradCcdfLogExpModNormal_ffv_450;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_451> AgradCcdfLogExpModNormal_ffv_451;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_452> AgradCcdfLogExpModNormal_ffv_452;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_453> AgradCcdfLogExpModNormal_ffv_453;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_454> AgradCcdfLogExpModNormal_ffv_454;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_455> AgradCcdfLogExpModNormal_ffv_455;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_456> AgradCcdfLogExpModNormal_ffv_456;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_457> AgradCcdfLogExpModNormal_ffv_457;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_458> AgradCcdfLogExpModNormal_ffv_458;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_459> AgradCcdfLogExpModNormal_ffv_459;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_460> AgradCcdfLogExpModNormal_ffv_460;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_461> AgradCcdfLogExpModNormal_ffv_461;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_462> AgradCcdfLogExpModNormal_ffv_462;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_463> AgradCcdfLogExpModNormal_ffv_463;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_464> AgradCcdfLogExpModNormal_ffv_464;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_465> AgradCcdfLogExpModNormal_ffv_465;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_466> AgradCcdfLogExpModNormal_ffv_466;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_467> AgradCcdfLogExpModNormal_ffv_467;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_468> AgradCcdfLogExpModNormal_ffv_468;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_469> AgradCcdfLogExpModNormal_ffv_469;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_470> AgradCcdfLogExpModNormal_ffv_470;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_471> AgradCcdfLogExpModNormal_ffv_471;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_472> AgradCcdfLogExpModNormal_ffv_472;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_473> AgradCcdfLogExpModNormal_ffv_473;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_474> AgradCcdfLogExpModNormal_ffv_474;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_475> AgradCcdfLogExpModNormal_ffv_475;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_476> AgradCcdfLogExpModNormal_ffv_476;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_477> AgradCcdfLogExpModNormal_ffv_477;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_478> AgradCcdfLogExpModNormal_ffv_478;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_479> AgradCcdfLogExpModNormal_ffv_479;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_480> AgradCcdfLogExpModNormal_ffv_480;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_481> AgradCcdfLogExpModNormal_ffv_481;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_482> AgradCcdfLogExpModNormal_ffv_482;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_483> AgradCcdfLogExpModNormal_ffv_483;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_484> AgradCcdfLogExpModNormal_ffv_484;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_485> AgradCcdfLogExpModNormal_ffv_485;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_486> AgradCcdfLogExpModNormal_ffv_486;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_487> AgradCcdfLogExpModNormal_ffv_487;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_488> AgradCcdfLogExpModNormal_ffv_488;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_489> AgradCcdfLogExpModNormal_ffv_489;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_490> AgradCcdfLogExpModNormal_ffv_490;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_491> AgradCcdfLogExpModNormal_ffv_491;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_492> AgradCcdfLogExpModNormal_ffv_492;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_493> AgradCcdfLogExpModNormal_ffv_493;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_494> AgradCcdfLogExpModNormal_ffv_494;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_495> AgradCcdfLogExpModNormal_ffv_495;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_496> AgradCcdfLogExpModNormal_ffv_496;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_497> AgradCcdfLogExpModNormal_ffv_497;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_498> AgradCcdfLogExpModNormal_ffv_498;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_499> AgradCcdfLogExpModNormal_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_400, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_401, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_402, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_403, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_404, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_405, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_406, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_407, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_408, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_409, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_410, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_411, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_412, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_413, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_414, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_415, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_416, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_417, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_418, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_419, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_420, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_421, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_422, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_423, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_424, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_425, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_426, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_427, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_428, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_429, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_430, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_431, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_432, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_433, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_434, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_435, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_436, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_437, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_438, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_439, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_440, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_441, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_442, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_443, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_444, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_445, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_446, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_447, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_448, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_449, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_450, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_451, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_452, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_453, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_454, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_455, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_456, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_457, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_458, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_459, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_460, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_461, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_462, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_463, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_464, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_465, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_466, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_467, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_468, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_469, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_470, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_471, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_472, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_473, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_474, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_475, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_476, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_477, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_478, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_479, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_480, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_481, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_482, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_483, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_484, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_485, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_486, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_487, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_488, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_489, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_490, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_491, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_492, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_493, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_494, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_495, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_496, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_497, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_498, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_499, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_400> AgradCcdfLogExpModNormal_v_400;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_401> AgradCcdfLogExpModNormal_v_401;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_402> AgradCcdfLogExpModNormal_v_402;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_403> AgradCcdfLogExpModNormal_v_403;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_404> AgradCcdfLogExpModNormal_v_404;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_405> AgradCcdfLogExpModNormal_v_405;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_406> AgradCcdfLogExpModNormal_v_406;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_407> AgradCcdfLogExpModNormal_v_407;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_408> AgradCcdfLogExpModNormal_v_408;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_409> AgradCcdfLogExpModNormal_v_409;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_410> AgradCcdfLogExpModNormal_v_410;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_411> AgradCcdfLogExpModNormal_v_411;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_412> AgradCcdfLogExpModNormal_v_412;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_413> AgradCcdfLogExpModNormal_v_413;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_414> AgradCcdfLogExpModNormal_v_414;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_415> AgradCcdfLogExpModNormal_v_415;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_416> AgradCcdfLogExpModNormal_v_416;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_417> AgradCcdfLogExpModNormal_v_417;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_418> AgradCcdfLogExpModNormal_v_418;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_419> AgradCcdfLogExpModNormal_v_419;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_420> AgradCcdfLogExpModNormal_v_420;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_421> AgradCcdfLogExpModNormal_v_421;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_422> AgradCcdfLogExpModNormal_v_422;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_423> AgradCcdfLogExpModNormal_v_423;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_424> AgradCcdfLogExpModNormal_v_424;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_425> AgradCcdfLogExpModNormal_v_425;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_426> AgradCcdfLogExpModNormal_v_426;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_427> AgradCcdfLogExpModNormal_v_427;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_428> AgradCcdfLogExpModNormal_v_428;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_429> AgradCcdfLogExpModNormal_v_429;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_430> AgradCcdfLogExpModNormal_v_430;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_431> AgradCcdfLogExpModNormal_v_431;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_432> AgradCcdfLogExpModNormal_v_432;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_433> AgradCcdfLogExpModNormal_v_433;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_434> AgradCcdfLogExpModNormal_v_434;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_435> AgradCcdfLogExpModNormal_v_435;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_436> AgradCcdfLogExpModNormal_v_436;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_437> AgradCcdfLogExpModNormal_v_437;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_438> AgradCcdfLogExpModNormal_v_438;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_439> AgradCcdfLogExpModNormal_v_439;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_440> AgradCcdfLogExpModNormal_v_440;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_441> AgradCcdfLogExpModNormal_v_441;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_442> AgradCcdfLogExpModNormal_v_442;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_443> AgradCcdfLogExpModNormal_v_443;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_444> AgradCcdfLogExpModNormal_v_444;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_445> AgradCcdfLogExpModNormal_v_445;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_446> AgradCcdfLogExpModNormal_v_446;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_447> AgradCcdfLogExpModNormal_v_447;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_448> AgradCcdfLogExpModNormal_v_448;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_449> AgradCcdfLogExpModNormal_v_449;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_450> AgradCcdfLogExpModNormal_v_450;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_451> AgradCcdfLogExpModNormal_v_451;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_452> AgradCcdfLogExpModNormal_v_452;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_453> AgradCcdfLogExpModNormal_v_453;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_454> AgradCcdfLogExpModNormal_v_454;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_455> AgradCcdfLogExpModNormal_v_455;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_456> AgradCcdfLogExpModNormal_v_456;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_457> AgradCcdfLogExpModNormal_v_457;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_458> AgradCcdfLogExpModNormal_v_458;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_459> AgradCcdfLogExpModNormal_v_459;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_460> AgradCcdfLogExpModNormal_v_460;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_461> AgradCcdfLogExpModNormal_v_461;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_462> AgradCcdfLogExpModNormal_v_462;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_463> AgradCcdfLogExpModNormal_v_463;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_464> AgradCcdfLogExpModNormal_v_464;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_465> AgradCcdfLogExpModNormal_v_465;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_466> AgradCcdfLogExpModNormal_v_466;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_467> AgradCcdfLogExpModNormal_v_467;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_468> AgradCcdfLogExpModNormal_v_468;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_469> AgradCcdfLogExpModNormal_v_469;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_470> AgradCcdfLogExpModNormal_v_470;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_471> AgradCcdfLogExpModNormal_v_471;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_472> AgradCcdfLogExpModNormal_v_472;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_473> AgradCcdfLogExpModNormal_v_473;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_474> AgradCcdfLogExpModNormal_v_474;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_475> AgradCcdfLogExpModNormal_v_475;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_476> AgradCcdfLogExpModNormal_v_476;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_477> AgradCcdfLogExpModNormal_v_477;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_478> AgradCcdfLogExpModNormal_v_478;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_479> AgradCcdfLogExpModNormal_v_479;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_480> AgradCcdfLogExpModNormal_v_480;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_481> AgradCcdfLogExpModNormal_v_481;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_482> AgradCcdfLogExpModNormal_v_482;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_483> AgradCcdfLogExpModNormal_v_483;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_484> AgradCcdfLogExpModNormal_v_484;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_485> AgradCcdfLogExpModNormal_v_485;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_486> AgradCcdfLogExpModNormal_v_486;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_487> AgradCcdfLogExpModNormal_v_487;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_488> AgradCcdfLogExpModNormal_v_488;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_489> AgradCcdfLogExpModNormal_v_489;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_490> AgradCcdfLogExpModNormal_v_490;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_491> AgradCcdfLogExpModNormal_v_491;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_492> AgradCcdfLogExpModNormal_v_492;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_493> AgradCcdfLogExpModNormal_v_493;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_494> AgradCcdfLogExpModNormal_v_494;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_495> AgradCcdfLogExpModNormal_v_495;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_496> AgradCcdfLogExpModNormal_v_496;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_497> AgradCcdfLogExpModNormal_v_497;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_498> AgradCcdfLogExpModNormal_v_498;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_499> AgradCcdfLogExpModNormal_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_400, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_401, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_402, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_403, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_404, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_405, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_406, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_407, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_408, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_409, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_410, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_411, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_412, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_413, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_414, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_415, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_416, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_417, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_418, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_419, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_420, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_421, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_422, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_423, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_424, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_425, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_426, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_427, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_428, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_429, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_430, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_431, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_432, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_433, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_434, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_435, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_436, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_437, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_438, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_439, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_440, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_441, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_442, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_443, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_444, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_445, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_446, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_447, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_448, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_449, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_450, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_451, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_452, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_453, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_454, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_455, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_456, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_457, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_458, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_459, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_460, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_461, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_462, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_463, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_464, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_465, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_466, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_467, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_468, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_469, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_470, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_471, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_472, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_473, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_474, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_475, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_476, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_477, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_478, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_479, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_480, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_481, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_482, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_483, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_484, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_485, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_486, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_487, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_488, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_489, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_490, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_491, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_492, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_493, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_494, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_495, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_496, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_497, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_498, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_499, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_499);
+
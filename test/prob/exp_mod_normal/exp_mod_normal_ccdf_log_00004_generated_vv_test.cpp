@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_400> AgradCcdfLogExpModNormal_vv_400;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_401> AgradCcdfLogExpModNormal_vv_401;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_402> AgradCcdfLogExpModNormal_vv_402;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_403> AgradCcdfLogExpModNormal_vv_403;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_404> AgradCcdfLogExpModNormal_vv_404;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_405> AgradCcdfLogExpModNormal_vv_405;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_406> AgradCcdfLogExpModNormal_vv_406;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_407> AgradCcdfLogExpModNormal_vv_407;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_408> AgradCcdfLogExpModNormal_vv_408;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_409> AgradCcdfLogExpModNormal_vv_409;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_410> AgradCcdfLogExpModNormal_vv_410;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_411> AgradCcdfLogExpModNormal_vv_411;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_412> AgradCcdfLogExpModNormal_vv_412;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_413> AgradCcdfLogExpModNormal_vv_413;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_414> AgradCcdfLogExpModNormal_vv_414;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_415> AgradCcdfLogExpModNormal_vv_415;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_416> AgradCcdfLogExpModNormal_vv_416;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_417> AgradCcdfLogExpModNormal_vv_417;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_418> AgradCcdfLogExpModNormal_vv_418;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_419> AgradCcdfLogExpModNormal_vv_419;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_420> AgradCcdfLogExpModNormal_vv_420;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_421> AgradCcdfLogExpModNormal_vv_421;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_422> AgradCcdfLogExpModNormal_vv_422;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_423> AgradCcdfLogExpModNormal_vv_423;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_424> AgradCcdfLogExpModNormal_vv_424;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_425> AgradCcdfLogExpModNormal_vv_425;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_426> AgradCcdfLogExpModNormal_vv_426;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_427> AgradCcdfLogExpModNormal_vv_427;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_428> AgradCcdfLogExpModNormal_vv_428;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_429> AgradCcdfLogExpModNormal_vv_429;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_430> AgradCcdfLogExpModNormal_vv_430;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_431> AgradCcdfLogExpModNormal_vv_431;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_432> AgradCcdfLogExpModNormal_vv_432;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_433> AgradCcdfLogExpModNormal_vv_433;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_434> AgradCcdfLogExpModNormal_vv_434;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_435> AgradCcdfLogExpModNormal_vv_435;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_436> AgradCcdfLogExpModNormal_vv_436;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_437> AgradCcdfLogExpModNormal_vv_437;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_438> AgradCcdfLogExpModNormal_vv_438;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_439> AgradCcdfLogExpModNormal_vv_439;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_440> AgradCcdfLogExpModNormal_vv_440;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_441> AgradCcdfLogExpModNormal_vv_441;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_442> AgradCcdfLogExpModNormal_vv_442;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_443> AgradCcdfLogExpModNormal_vv_443;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_444> AgradCcdfLogExpModNormal_vv_444;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_445> AgradCcdfLogExpModNormal_vv_445;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_446> AgradCcdfLogExpModNormal_vv_446;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_447> AgradCcdfLogExpModNormal_vv_447;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_448> AgradCcdfLogExpModNormal_vv_448;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_449> AgradCcdfLogExpModNormal_vv_449;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_450> AgradCcdfLogExpModNormal_vv_450;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_451> AgradCcdfLogExpModNormal_vv_451;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_452> AgradCcdfLogExpModNormal_vv_452;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_453> AgradCcdfLogExpModNormal_vv_453;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_454> AgradCcdfLogExpModNormal_vv_454;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_455> AgradCcdfLogExpModNormal_vv_455;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_456> AgradCcdfLogExpModNormal_vv_456;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_457> AgradCcdfLogExpModNormal_vv_457;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_458> AgradCcdfLogExpModNormal_vv_458;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_459> AgradCcdfLogExpModNormal_vv_459;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_460> AgradCcdfLogExpModNormal_vv_460;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_461> AgradCcdfLogExpModNormal_vv_461;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_462> AgradCcdfLogExpModNormal_vv_462;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_463> AgradCcdfLogExpModNormal_vv_463;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_464> AgradCcdfLogExpModNormal_vv_464;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_465> AgradCcdfLogExpModNormal_vv_465;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_466> AgradCcdfLogExpModNormal_vv_466;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_467> AgradCcdfLogExpModNormal_vv_467;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_468> AgradCcdfLogExpModNormal_vv_468;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_469> AgradCcdfLogExpModNormal_vv_469;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_470> AgradCcdfLogExpModNormal_vv_470;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_471> AgradCcdfLogExpModNormal_vv_471;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_472> AgradCcdfLogExpModNormal_vv_472;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_473> AgradCcdfLogExpModNormal_vv_473;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_474> AgradCcdfLogExpModNormal_vv_474;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_475> AgradCcdfLogExpModNormal_vv_475;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_476> AgradCcdfLogExpModNormal_vv_476;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_477> AgradCcdfLogExpModNormal_vv_477;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_478> AgradCcdfLogExpModNormal_vv_478;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_479> AgradCcdfLogExpModNormal_vv_479;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_480> AgradCcdfLogExpModNormal_vv_480;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_481> AgradCcdfLogExpModNormal_vv_481;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_482> AgradCcdfLogExpModNormal_vv_482;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_483> AgradCcdfLogExpModNormal_vv_483;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_484> AgradCcdfLogExpModNormal_vv_484;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_485> AgradCcdfLogExpModNormal_vv_485;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_486> AgradCcdfLogExpModNormal_vv_486;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_487> AgradCcdfLogExpModNormal_vv_487;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_488> AgradCcdfLogExpModNormal_vv_488;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_489> AgradCcdfLogExpModNormal_vv_489;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_490> AgradCcdfLogExpModNormal_vv_490;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_491> AgradCcdfLogExpModNormal_vv_491;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_492> AgradCcdfLogExpModNormal_vv_492;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_493> AgradCcdfLogExpModNormal_vv_493;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_494> AgradCcdfLogExpModNormal_vv_494;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_495> AgradCcdfLogExpModNormal_vv_495;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_496> AgradCcdfLogExpModNormal_vv_496;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_497> AgradCcdfLogExpModNormal_vv_497;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_498> AgradCcdfLogExpModNormal_vv_498;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_499> AgradCcdfLogExpModNormal_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_400, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_401, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_402, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_403, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_404, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_405, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_406, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_407, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_408, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_409, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_410, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_411, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_412, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_413, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_414, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_415, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_416, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_417, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_418, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_419, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_420, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_421, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_422, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_423, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_424, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_425, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_426, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_427, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_428, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_429, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_430, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_431, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_432, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_433, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_434, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_435, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_436, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_437, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_438, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_439, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_440, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_441, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_442, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_443, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_444, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_445, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_446, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_447, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_448, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_449, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_450, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_451, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_452, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_453, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_454, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_455, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_456, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_457, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_458, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_459, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_460, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_461, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_462, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_463, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_464, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_465, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_466, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_467, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_468, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_469, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_470, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_471, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_472, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_473, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_474, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_475, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_476, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_477, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_478, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_479, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_480, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_481, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_482, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_483, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_484, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_485, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_486, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_487, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_488, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_489, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_490, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_491, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_492, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_493, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_494, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_495, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_496, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_497, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_498, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_499, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_499);
+
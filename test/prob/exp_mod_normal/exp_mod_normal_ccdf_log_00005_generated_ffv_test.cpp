@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+typedef std::tuple<fvar<fvar<var> >, double, double, double, empty, empty> type_ffv_567;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<double>, empty, empty> type_ffv_568;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_569;
+typedef std::tuple<fvar<fvar<var> >, double, double, fvar<fvar<var> >, empty, empty> type_ffv_570;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_571;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_572;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, double, empty, empty> type_ffv_573;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_574;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_575;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_576;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_577;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_578;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_579;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_580;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_581;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_582;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_583;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_584;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty, empty> type_ffv_585;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_586;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_587;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_588;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_589;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_590;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_591;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_592;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_593;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_594;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_595;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_596;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_597;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_598;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_599;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_500> AgradCcdfLogExpModNormal_ffv_500;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_501> AgradCcdfLogExpModNormal_ffv_501;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_502> AgradCcdfLogExpModNormal_ffv_502;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_503> AgradCcdfLogExpModNormal_ffv_503;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_504> AgradCcdfLogExpModNormal_ffv_504;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_505> AgradCcdfLogExpModNormal_ffv_505;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_506> AgradCcdfLogExpModNormal_ffv_506;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_507> AgradCcdfLogExpModNormal_ffv_507;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_508> AgradCcdfLogExpModNormal_ffv_508;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_509> AgradCcdfLogExpModNormal_ffv_509;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_510> AgradCcdfLogExpModNormal_ffv_510;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_511> AgradCcdfLogExpModNormal_ffv_511;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_512> AgradCcdfLogExpModNormal_ffv_512;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_513> AgradCcdfLogExpModNormal_ffv_513;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_514> AgradCcdfLogExpModNormal_ffv_514;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_515> AgradCcdfLogExpModNormal_ffv_515;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_516> AgradCcdfLogExpModNormal_ffv_516;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_517> AgradCcdfLogExpModNormal_ffv_517;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_518> AgradCcdfLogExpModNormal_ffv_518;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_519> AgradCcdfLogExpModNormal_ffv_519;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_520> AgradCcdfLogExpModNormal_ffv_520;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_521> AgradCcdfLogExpModNormal_ffv_521;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_522> AgradCcdfLogExpModNormal_ffv_522;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_523> AgradCcdfLogExpModNormal_ffv_523;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_524> AgradCcdfLogExpModNormal_ffv_524;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_525> AgradCcdfLogExpModNormal_ffv_525;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_526> AgradCcdfLogExpModNormal_ffv_526;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_527> AgradCcdfLogExpModNormal_ffv_527;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_528> AgradCcdfLogExpModNormal_ffv_528;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_529> AgradCcdfLogExpModNormal_ffv_529;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_530> AgradCcdfLogExpModNormal_ffv_530;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_531> AgradCcdfLogExpModNormal_ffv_531;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_532> AgradCcdfLogExpModNormal_ffv_532;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_533> AgradCcdfLogExpModNormal_ffv_533;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_534> AgradCcdfLogExpModNormal_ffv_534;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_535> AgradCcdfLogExpModNormal_ffv_535;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_536> AgradCcdfLogExpModNormal_ffv_536;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_537> AgradCcdfLogExpModNormal_ffv_537;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_538> AgradCcdfLogExpModNormal_ffv_538;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_539> AgradCcdfLogExpModNormal_ffv_539;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_540> AgradCcdfLogExpModNormal_ffv_540;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_541> AgradCcdfLogExpModNormal_ffv_541;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_542> AgradCcdfLogExpModNormal_ffv_542;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_543> AgradCcdfLogExpModNormal_ffv_543;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_544> AgradCcdfLogExpModNormal_ffv_544;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_545> AgradCcdfLogExpModNormal_ffv_545;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_546> AgradCcdfLogExpModNormal_ffv_546;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_547> AgradCcdfLogExpModNormal_ffv_547;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_548> AgradCcdfLogExpModNormal_ffv_548;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_549> AgradCcdfLogExpModNormal_ffv_549;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_550> AgradCcdfLogExpModNormal_ffv_550;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_551> AgradCcdfLogExpModNormal_ffv_551;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_552> AgradCcdfLogExpModNormal_ffv_552;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_553> AgradCcdfLogExpModNormal_ffv_553;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_554> AgradCcdfLogExpModNormal_ffv_554;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_555> AgradCcdfLogExpModNormal_ffv_555;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_556> AgradCcdfLogExpModNormal_ffv_556;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_557> AgradCcdfLogExpModNormal_ffv_557;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_558> AgradCcdfLogExpModNormal_ffv_558;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_559> AgradCcdfLogExpModNormal_ffv_559;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_560> AgradCcdfLogExpModNormal_ffv_560;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_561> AgradCcdfLogExpModNormal_ffv_561;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_562> AgradCcdfLogExpModNormal_ffv_562;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_563> AgradCcdfLogExpModNormal_ffv_563;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_564> AgradCcdfLogExpModNormal_ffv_564;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_565> AgradCcdfLogExpModNormal_ffv_565;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_566> AgradCcdfLogExpModNormal_ffv_566;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_567> AgradCcdfLogExpModNormal_ffv_567;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_568> AgradCcdfLogExpModNormal_ffv_568;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_569> AgradCcdfLogExpModNormal_ffv_569;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_570> AgradCcdfLogExpModNormal_ffv_570;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_571> AgradCcdfLogExpModNormal_ffv_571;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_572> AgradCcdfLogExpModNormal_ffv_572;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_573> AgradCcdfLogExpModNormal_ffv_573;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_574> AgradCcdfLogExpModNormal_ffv_574;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_575> AgradCcdfLogExpModNormal_ffv_575;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_576> AgradCcdfLogExpModNormal_ffv_576;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_577> AgradCcdfLogExpModNormal_ffv_577;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_578> AgradCcdfLogExpModNormal_ffv_578;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_579> AgradCcdfLogExpModNormal_ffv_579;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_580> AgradCcdfLogExpModNormal_ffv_580;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_581> AgradCcdfLogExpModNormal_ffv_581;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_582> AgradCcdfLogExpModNormal_ffv_582;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_583> AgradCcdfLogExpModNormal_ffv_583;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_584> AgradCcdfLogExpModNormal_ffv_584;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_585> AgradCcdfLogExpModNormal_ffv_585;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_586> AgradCcdfLogExpModNormal_ffv_586;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_587> AgradCcdfLogExpModNormal_ffv_587;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_588> AgradCcdfLogExpModNormal_ffv_588;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_589> AgradCcdfLogExpModNormal_ffv_589;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_590> AgradCcdfLogExpModNormal_ffv_590;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_591> AgradCcdfLogExpModNormal_ffv_591;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_592> AgradCcdfLogExpModNormal_ffv_592;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_593> AgradCcdfLogExpModNormal_ffv_593;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_594> AgradCcdfLogExpModNormal_ffv_594;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_595> AgradCcdfLogExpModNormal_ffv_595;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_596> AgradCcdfLogExpModNormal_ffv_596;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_597> AgradCcdfLogExpModNormal_ffv_597;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_598> AgradCcdfLogExpModNormal_ffv_598;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_599> AgradCcdfLogExpModNormal_ffv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_500, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_501, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_502, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_503, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_504, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_505, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_506, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_507, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_508, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_509, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_510, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_511, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_512, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_513, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_514, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_515, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_516, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_517, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_518, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_519, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_520, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_521, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_522, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_523, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_524, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_525, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_526, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_527, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_528, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_529, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_530, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_531, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_532, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_533, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_534, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_535, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_536, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_537, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_538, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_539, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_540, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_541, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_542, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_543, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_544, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_545, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_546, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_547, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_548, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_549, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_550, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_551, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_552, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_553, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_554, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_555, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_556, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_557, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_558, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_559, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_560, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_561, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_562, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_563, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_564, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_565, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_566, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_567, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_568, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_569, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_570, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_571, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_572, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_573, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_574, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_575, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_576, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_577, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_578, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_579, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_580, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_581, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_582, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_583, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_584, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_585, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_586, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_587, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_588, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_589, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_590, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_591, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_592, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_593, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_594, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_595, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_596, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_597, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_598, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_599, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_599);
+
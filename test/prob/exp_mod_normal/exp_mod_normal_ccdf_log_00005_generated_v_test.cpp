@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_500> AgradCcdfLogExpModNormal_v_500;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_501> AgradCcdfLogExpModNormal_v_501;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_502> AgradCcdfLogExpModNormal_v_502;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_503> AgradCcdfLogExpModNormal_v_503;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_504> AgradCcdfLogExpModNormal_v_504;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_505> AgradCcdfLogExpModNormal_v_505;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_506> AgradCcdfLogExpModNormal_v_506;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_507> AgradCcdfLogExpModNormal_v_507;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_508> AgradCcdfLogExpModNormal_v_508;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_509> AgradCcdfLogExpModNormal_v_509;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_510> AgradCcdfLogExpModNormal_v_510;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_511> AgradCcdfLogExpModNormal_v_511;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_512> AgradCcdfLogExpModNormal_v_512;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_513> AgradCcdfLogExpModNormal_v_513;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_514> AgradCcdfLogExpModNormal_v_514;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_515> AgradCcdfLogExpModNormal_v_515;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_516> AgradCcdfLogExpModNormal_v_516;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_517> AgradCcdfLogExpModNormal_v_517;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_518> AgradCcdfLogExpModNormal_v_518;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_519> AgradCcdfLogExpModNormal_v_519;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_520> AgradCcdfLogExpModNormal_v_520;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_521> AgradCcdfLogExpModNormal_v_521;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_522> AgradCcdfLogExpModNormal_v_522;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_523> AgradCcdfLogExpModNormal_v_523;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_524> AgradCcdfLogExpModNormal_v_524;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_525> AgradCcdfLogExpModNormal_v_525;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_526> AgradCcdfLogExpModNormal_v_526;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_527> AgradCcdfLogExpModNormal_v_527;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_528> AgradCcdfLogExpModNormal_v_528;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_529> AgradCcdfLogExpModNormal_v_529;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_530> AgradCcdfLogExpModNormal_v_530;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_531> AgradCcdfLogExpModNormal_v_531;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_532> AgradCcdfLogExpModNormal_v_532;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_533> AgradCcdfLogExpModNormal_v_533;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_534> AgradCcdfLogExpModNormal_v_534;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_535> AgradCcdfLogExpModNormal_v_535;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_536> AgradCcdfLogExpModNormal_v_536;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_537> AgradCcdfLogExpModNormal_v_537;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_538> AgradCcdfLogExpModNormal_v_538;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_539> AgradCcdfLogExpModNormal_v_539;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_540> AgradCcdfLogExpModNormal_v_540;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_541> AgradCcdfLogExpModNormal_v_541;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_542> AgradCcdfLogExpModNormal_v_542;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_543> AgradCcdfLogExpModNormal_v_543;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_544> AgradCcdfLogExpModNormal_v_544;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_545> AgradCcdfLogExpModNormal_v_545;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_546> AgradCcdfLogExpModNormal_v_546;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_547> AgradCcdfLogExpModNormal_v_547;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_548> AgradCcdfLogExpModNormal_v_548;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_549> AgradCcdfLogExpModNormal_v_549;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_550> AgradCcdfLogExpModNormal_v_550;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_551> AgradCcdfLogExpModNormal_v_551;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_552> AgradCcdfLogExpModNormal_v_552;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_553> AgradCcdfLogExpModNormal_v_553;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_554> AgradCcdfLogExpModNormal_v_554;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_555> AgradCcdfLogExpModNormal_v_555;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_556> AgradCcdfLogExpModNormal_v_556;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_557> AgradCcdfLogExpModNormal_v_557;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_558> AgradCcdfLogExpModNormal_v_558;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_559> AgradCcdfLogExpModNormal_v_559;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_560> AgradCcdfLogExpModNormal_v_560;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_561> AgradCcdfLogExpModNormal_v_561;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_562> AgradCcdfLogExpModNormal_v_562;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_563> AgradCcdfLogExpModNormal_v_563;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_564> AgradCcdfLogExpModNormal_v_564;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_565> AgradCcdfLogExpModNormal_v_565;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_566> AgradCcdfLogExpModNormal_v_566;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_567> AgradCcdfLogExpModNormal_v_567;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_568> AgradCcdfLogExpModNormal_v_568;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_569> AgradCcdfLogExpModNormal_v_569;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_570> AgradCcdfLogExpModNormal_v_570;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_571> AgradCcdfLogExpModNormal_v_571;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_572> AgradCcdfLogExpModNormal_v_572;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_573> AgradCcdfLogExpModNormal_v_573;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_574> AgradCcdfLogExpModNormal_v_574;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_575> AgradCcdfLogExpModNormal_v_575;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_576> AgradCcdfLogExpModNormal_v_576;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_577> AgradCcdfLogExpModNormal_v_577;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_578> AgradCcdfLogExpModNormal_v_578;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_579> AgradCcdfLogExpModNormal_v_579;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_580> AgradCcdfLogExpModNormal_v_580;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_581> AgradCcdfLogExpModNormal_v_581;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_582> AgradCcdfLogExpModNormal_v_582;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_583> AgradCcdfLogExpModNormal_v_583;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_584> AgradCcdfLogExpModNormal_v_584;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_585> AgradCcdfLogExpModNormal_v_585;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_586> AgradCcdfLogExpModNormal_v_586;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_587> AgradCcdfLogExpModNormal_v_587;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_588> AgradCcdfLogExpModNormal_v_588;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_589> AgradCcdfLogExpModNormal_v_589;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_590> AgradCcdfLogExpModNormal_v_590;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_591> AgradCcdfLogExpModNormal_v_591;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_592> AgradCcdfLogExpModNormal_v_592;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_593> AgradCcdfLogExpModNormal_v_593;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_594> AgradCcdfLogExpModNormal_v_594;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_595> AgradCcdfLogExpModNormal_v_595;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_596> AgradCcdfLogExpModNormal_v_596;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_597> AgradCcdfLogExpModNormal_v_597;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_598> AgradCcdfLogExpModNormal_v_598;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_599> AgradCcdfLogExpModNormal_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_500, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_501, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_502, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_503, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_504, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_505, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_506, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_507, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_508, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_509, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_510, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_511, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_512, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_513, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_514, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_515, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_516, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_517, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_518, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_519, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_520, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_521, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_522, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_523, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_524, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_525, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_526, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_527, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_528, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_529, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_530, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_531, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_532, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_533, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_534, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_535, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_536, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_537, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_538, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_539, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_540, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_541, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_542, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_543, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_544, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_545, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_546, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_547, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_548, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_549, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_550, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_551, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_552, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_553, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_554, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_555, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_556, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_557, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_558, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_559, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_560, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_561, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_562, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_563, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_564, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_565, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_566, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_567, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_568, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_569, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_570, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_571, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_572, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_573, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_574, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_575, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_576, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_577, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_578, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_579, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_580, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_581, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_582, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_583, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_584, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_585, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_586, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_587, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_588, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_589, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_590, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_591, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_592, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_593, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_594, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_595, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_596, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_597, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_598, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_599, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+typedef std::tuple<var, double, double, double, empty, empty> type_vv_567;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_vv_568;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_569;
+typedef std::tuple<var, double, double, var, empty, empty> type_vv_570;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_vv_571;
+typedef std::tuple<var, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_572;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_vv_573;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_574;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_575;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_vv_576;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_577;
+typedef std::tuple<var, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_578;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_579;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_580;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_581;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_582;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_583;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_584;
+typedef std::tuple<var, double, var, double, empty, empty> type_vv_585;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_vv_586;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_587;
+typedef std::tuple<var, double, var, var, empty, empty> type_vv_588;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_vv_589;
+typedef std::tuple<var, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_590;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_vv_591;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_592;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_593;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_vv_594;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_595;
+typedef std::tuple<var, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_596;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_597;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_598;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_599;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_500> AgradCcdfLogExpModNormal_vv_500;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_501> AgradCcdfLogExpModNormal_vv_501;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_502> AgradCcdfLogExpModNormal_vv_502;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_503> AgradCcdfLogExpModNormal_vv_503;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_504> AgradCcdfLogExpModNormal_vv_504;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_505> AgradCcdfLogExpModNormal_vv_505;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_506> AgradCcdfLogExpModNormal_vv_506;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_507> AgradCcdfLogExpModNormal_vv_507;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_508> AgradCcdfLogExpModNormal_vv_508;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_509> AgradCcdfLogExpModNormal_vv_509;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_510> AgradCcdfLogExpModNormal_vv_510;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_511> AgradCcdfLogExpModNormal_vv_511;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_512> AgradCcdfLogExpModNormal_vv_512;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_513> AgradCcdfLogExpModNormal_vv_513;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_514> AgradCcdfLogExpModNormal_vv_514;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_515> AgradCcdfLogExpModNormal_vv_515;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_516> AgradCcdfLogExpModNormal_vv_516;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_517> AgradCcdfLogExpModNormal_vv_517;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_518> AgradCcdfLogExpModNormal_vv_518;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_519> AgradCcdfLogExpModNormal_vv_519;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_520> AgradCcdfLogExpModNormal_vv_520;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_521> AgradCcdfLogExpModNormal_vv_521;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_522> AgradCcdfLogExpModNormal_vv_522;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_523> AgradCcdfLogExpModNormal_vv_523;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_524> AgradCcdfLogExpModNormal_vv_524;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_525> AgradCcdfLogExpModNormal_vv_525;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_526> AgradCcdfLogExpModNormal_vv_526;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_527> AgradCcdfLogExpModNormal_vv_527;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_528> AgradCcdfLogExpModNormal_vv_528;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_529> AgradCcdfLogExpModNormal_vv_529;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_530> AgradCcdfLogExpModNormal_vv_530;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_531> AgradCcdfLogExpModNormal_vv_531;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_532> AgradCcdfLogExpModNormal_vv_532;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_533> AgradCcdfLogExpModNormal_vv_533;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_534> AgradCcdfLogExpModNormal_vv_534;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_535> AgradCcdfLogExpModNormal_vv_535;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_536> AgradCcdfLogExpModNormal_vv_536;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_537> AgradCcdfLogExpModNormal_vv_537;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_538> AgradCcdfLogExpModNormal_vv_538;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_539> AgradCcdfLogExpModNormal_vv_539;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_540> AgradCcdfLogExpModNormal_vv_540;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_541> AgradCcdfLogExpModNormal_vv_541;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_542> AgradCcdfLogExpModNormal_vv_542;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_543> AgradCcdfLogExpModNormal_vv_543;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_544> AgradCcdfLogExpModNormal_vv_544;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_545> AgradCcdfLogExpModNormal_vv_545;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_546> AgradCcdfLogExpModNormal_vv_546;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_547> AgradCcdfLogExpModNormal_vv_547;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_548> AgradCcdfLogExpModNormal_vv_548;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_549> AgradCcdfLogExpModNormal_vv_549;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_550> AgradCcdfLogExpModNormal_vv_550;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_551> AgradCcdfLogExpModNormal_vv_551;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_552> AgradCcdfLogExpModNormal_vv_552;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_553> AgradCcdfLogExpModNormal_vv_553;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_554> AgradCcdfLogExpModNormal_vv_554;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_555> AgradCcdfLogExpModNormal_vv_555;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_556> AgradCcdfLogExpModNormal_vv_556;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_557> AgradCcdfLogExpModNormal_vv_557;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_558> AgradCcdfLogExpModNormal_vv_558;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_559> AgradCcdfLogExpModNormal_vv_559;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_560> AgradCcdfLogExpModNormal_vv_560;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_561> AgradCcdfLogExpModNormal_vv_561;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_562> AgradCcdfLogExpModNormal_vv_562;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_563> AgradCcdfLogExpModNormal_vv_563;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_564> AgradCcdfLogExpModNormal_vv_564;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_565> AgradCcdfLogExpModNormal_vv_565;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_566> AgradCcdfLogExpModNormal_vv_566;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_567> AgradCcdfLogExpModNormal_vv_567;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_568> AgradCcdfLogExpModNormal_vv_568;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_569> AgradCcdfLogExpModNormal_vv_569;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_570> AgradCcdfLogExpModNormal_vv_570;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_571> AgradCcdfLogExpModNormal_vv_571;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_572> AgradCcdfLogExpModNormal_vv_572;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_573> AgradCcdfLogExpModNormal_vv_573;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_574> AgradCcdfLogExpModNormal_vv_574;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_575> AgradCcdfLogExpModNormal_vv_575;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_576> AgradCcdfLogExpModNormal_vv_576;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_577> AgradCcdfLogExpModNormal_vv_577;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_578> AgradCcdfLogExpModNormal_vv_578;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_579> AgradCcdfLogExpModNormal_vv_579;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_580> AgradCcdfLogExpModNormal_vv_580;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_581> AgradCcdfLogExpModNormal_vv_581;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_582> AgradCcdfLogExpModNormal_vv_582;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_583> AgradCcdfLogExpModNormal_vv_583;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_584> AgradCcdfLogExpModNormal_vv_584;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_585> AgradCcdfLogExpModNormal_vv_585;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_586> AgradCcdfLogExpModNormal_vv_586;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_587> AgradCcdfLogExpModNormal_vv_587;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_588> AgradCcdfLogExpModNormal_vv_588;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_589> AgradCcdfLogExpModNormal_vv_589;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_590> AgradCcdfLogExpModNormal_vv_590;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_591> AgradCcdfLogExpModNormal_vv_591;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_592> AgradCcdfLogExpModNormal_vv_592;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_593> AgradCcdfLogExpModNormal_vv_593;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_594> AgradCcdfLogExpModNormal_vv_594;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_595> AgradCcdfLogExpModNormal_vv_595;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_596> AgradCcdfLogExpModNormal_vv_596;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_597> AgradCcdfLogExpModNormal_vv_597;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_598> AgradCcdfLogExpModNormal_vv_598;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_599> AgradCcdfLogExpModNormal_vv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_500, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_501, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_502, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_503, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_504, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_505, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_506, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_507, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_508, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_509, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_510, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_511, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_512, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_513, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_514, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_515, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_516, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_517, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_518, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_519, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_520, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_521, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_522, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_523, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_524, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_525, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_526, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_527, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_528, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_529, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_530, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_531, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_532, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_533, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_534, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_535, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_536, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_537, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_538, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_539, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_540, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_541, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_542, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_543, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_544, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_545, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_546, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_547, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_548, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_549, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_550, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_551, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_552, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_553, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_554, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_555, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_556, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_557, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_558, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_559, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_560, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_561, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_562, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_563, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_564, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_565, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_566, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_567, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_568, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_569, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_570, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_571, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_572, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_573, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_574, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_575, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_576, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_577, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_578, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_579, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_580, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_581, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_582, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_583, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_584, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_585, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_586, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_587, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_588, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_589, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_590, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_591, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_592, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_593, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_594, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_595, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_596, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_597, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_598, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_599, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_599);
+
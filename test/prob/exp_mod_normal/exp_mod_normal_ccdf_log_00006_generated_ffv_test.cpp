@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_600;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_601;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_602;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, double, empty, empty> type_ffv_603;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_604;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_605;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_606;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_607;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_608;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_609;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_610;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_611;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_612;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_613;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_614;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_615;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_616;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_617;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_618;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_619;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_620;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_621;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_622;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_623;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_624;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_625;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_626;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_627;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_628;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_629;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_630;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_631;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_632;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_633;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_634;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_635;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_636;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_637;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_638;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_639;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_640;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_641;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_642;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_643;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_644;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_645;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_646;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_647;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_648;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_649;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_650;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_651;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_652;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_653;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_654;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_655;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_656;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_657;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_658;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_659;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_660;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_661;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_662;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_663;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_664;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_665;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_666;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_667;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_668;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_669;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_670;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_671;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_672;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_673;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_674;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, double, empty, empty> type_ffv_675;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_676;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_677;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_678;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_679;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_680;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_681;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_682;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_683;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_684;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_685;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_686;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_687;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_688;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_689;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_690;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_691;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_692;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_693;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_694;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_695;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_696;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_697;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_698;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_699;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_600> AgradCcdfLogExpModNormal_ffv_600;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_601> AgradCcdfLogExpModNormal_ffv_601;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_602> AgradCcdfLogExpModNormal_ffv_602;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_603> AgradCcdfLogExpModNormal_ffv_603;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_604> AgradCcdfLogExpModNormal_ffv_604;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_605> AgradCcdfLogExpModNormal_ffv_605;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_606> AgradCcdfLogExpModNormal_ffv_606;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_607> AgradCcdfLogExpModNormal_ffv_607;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_608> AgradCcdfLogExpModNormal_ffv_608;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_609> AgradCcdfLogExpModNormal_ffv_609;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_610> AgradCcdfLogExpModNormal_ffv_610;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_611> AgradCcdfLogExpModNormal_ffv_611;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_612> AgradCcdfLogExpModNormal_ffv_612;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_613> AgradCcdfLogExpModNormal_ffv_613;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_614> AgradCcdfLogExpModNormal_ffv_614;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_615> AgradCcdfLogExpModNormal_ffv_615;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_616> AgradCcdfLogExpModNormal_ffv_616;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_617> AgradCcdfLogExpModNormal_ffv_617;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_618> AgradCcdfLogExpModNormal_ffv_618;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_619> AgradCcdfLogExpModNormal_ffv_619;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_620> AgradCcdfLogExpModNormal_ffv_620;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_621> AgradCcdfLogExpModNormal_ffv_621;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_622> AgradCcdfLogExpModNormal_ffv_622;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_623> AgradCcdfLogExpModNormal_ffv_623;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_624> AgradCcdfLogExpModNormal_ffv_624;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_625> AgradCcdfLogExpModNormal_ffv_625;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_626> AgradCcdfLogExpModNormal_ffv_626;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_627> AgradCcdfLogExpModNormal_ffv_627;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_628> AgradCcdfLogExpModNormal_ffv_628;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_629> AgradCcdfLogExpModNormal_ffv_629;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_630> AgradCcdfLogExpModNormal_ffv_630;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_631> AgradCcdfLogExpModNormal_ffv_631;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_632> AgradCcdfLogExpModNormal_ffv_632;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_633> AgradCcdfLogExpModNormal_ffv_633;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_634> AgradCcdfLogExpModNormal_ffv_634;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_635> AgradCcdfLogExpModNormal_ffv_635;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_636> AgradCcdfLogExpModNormal_ffv_636;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_637> AgradCcdfLogExpModNormal_ffv_637;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_638> AgradCcdfLogExpModNormal_ffv_638;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_639> AgradCcdfLogExpModNormal_ffv_639;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_640> AgradCcdfLogExpModNormal_ffv_640;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_641> AgradCcdfLogExpModNormal_ffv_641;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_642> AgradCcdfLogExpModNormal_ffv_642;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_643> AgradCcdfLogExpModNormal_ffv_643;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_644> AgradCcdfLogExpModNormal_ffv_644;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_645> AgradCcdfLogExpModNormal_ffv_645;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_646> AgradCcdfLogExpModNormal_ffv_646;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_647> AgradCcdfLogExpModNormal_ffv_647;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_648> AgradCcdfLogExpModNormal_ffv_648;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_649> AgradCcdfLogExpModNormal_ffv_649;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_650> AgradCcdfLogExpModNormal_ffv_650;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_651> AgradCcdfLogExpModNormal_ffv_651;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_652> AgradCcdfLogExpModNormal_ffv_652;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_653> AgradCcdfLogExpModNormal_ffv_653;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_654> AgradCcdfLogExpModNormal_ffv_654;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_655> AgradCcdfLogExpModNormal_ffv_655;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_656> AgradCcdfLogExpModNormal_ffv_656;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_657> AgradCcdfLogExpModNormal_ffv_657;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_658> AgradCcdfLogExpModNormal_ffv_658;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_659> AgradCcdfLogExpModNormal_ffv_659;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_660> AgradCcdfLogExpModNormal_ffv_660;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_661> AgradCcdfLogExpModNormal_ffv_661;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_662> AgradCcdfLogExpModNormal_ffv_662;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_663> AgradCcdfLogExpModNormal_ffv_663;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_664> AgradCcdfLogExpModNormal_ffv_664;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_665> AgradCcdfLogExpModNormal_ffv_665;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_666> AgradCcdfLogExpModNormal_ffv_666;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_667> AgradCcdfLogExpModNormal_ffv_667;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_668> AgradCcdfLogExpModNormal_ffv_668;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_669> AgradCcdfLogExpModNormal_ffv_669;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_670> AgradCcdfLogExpModNormal_ffv_670;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_671> AgradCcdfLogExpModNormal_ffv_671;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_672> AgradCcdfLogExpModNormal_ffv_672;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_673> AgradCcdfLogExpModNormal_ffv_673;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_674> AgradCcdfLogExpModNormal_ffv_674;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_675> AgradCcdfLogExpModNormal_ffv_675;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_676> AgradCcdfLogExpModNormal_ffv_676;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_677> AgradCcdfLogExpModNormal_ffv_677;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_678> AgradCcdfLogExpModNormal_ffv_678;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_679> AgradCcdfLogExpModNormal_ffv_679;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_680> AgradCcdfLogExpModNormal_ffv_680;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_681> AgradCcdfLogExpModNormal_ffv_681;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_682> AgradCcdfLogExpModNormal_ffv_682;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_683> AgradCcdfLogExpModNormal_ffv_683;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_684> AgradCcdfLogExpModNormal_ffv_684;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_685> AgradCcdfLogExpModNormal_ffv_685;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_686> AgradCcdfLogExpModNormal_ffv_686;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_687> AgradCcdfLogExpModNormal_ffv_687;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_688> AgradCcdfLogExpModNormal_ffv_688;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_689> AgradCcdfLogExpModNormal_ffv_689;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_690> AgradCcdfLogExpModNormal_ffv_690;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_691> AgradCcdfLogExpModNormal_ffv_691;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_692> AgradCcdfLogExpModNormal_ffv_692;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_693> AgradCcdfLogExpModNormal_ffv_693;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_694> AgradCcdfLogExpModNormal_ffv_694;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_695> AgradCcdfLogExpModNormal_ffv_695;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_696> AgradCcdfLogExpModNormal_ffv_696;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_697> AgradCcdfLogExpModNormal_ffv_697;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_698> AgradCcdfLogExpModNormal_ffv_698;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_699> AgradCcdfLogExpModNormal_ffv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_600, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_601, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_602, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_603, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_604, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_605, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_606, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_607, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_608, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_609, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_610, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_611, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_612, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_613, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_614, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_615, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_616, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_617, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_618, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_619, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_620, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_621, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_622, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_623, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_624, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_625, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_626, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_627, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_628, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_629, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_630, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_631, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_632, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_633, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_634, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_635, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_636, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_637, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_638, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_639, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_640, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_641, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_642, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_643, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_644, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_645, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_646, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_647, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_648, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_649, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_650, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_651, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_652, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_653, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_654, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_655, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_656, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_657, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_658, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_659, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_660, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_661, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_662, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_663, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_664, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_665, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_666, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_667, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_668, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_669, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_670, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_671, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_672, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_673, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_674, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_675, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_676, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_677, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_678, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_679, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_680, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_681, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_682, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_683, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_684, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_685, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_686, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_687, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_688, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_689, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_690, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_691, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_692, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_693, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_694, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_695, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_696, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_697, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_698, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_699, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+typedef std::tuple<var, double, double, double, empty, empty> type_v_648;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_v_649;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_650;
+typedef std::tuple<var, double, double, var, empty, empty> type_v_651;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_v_652;
+typedef std::tuple<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_653;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_v_654;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_v_655;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_656;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_v_657;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_v_658;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_659;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_660;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_661;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_662;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_663;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_664;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_665;
+typedef std::tuple<var, double, var, double, empty, empty> type_v_666;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_v_667;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_668;
+typedef std::tuple<var, double, var, var, empty, empty> type_v_669;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_v_670;
+typedef std::tuple<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_671;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_v_672;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_v_673;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_674;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_v_675;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_v_676;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_677;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_678;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_679;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_680;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_681;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_682;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_683;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_v_684;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_v_685;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_686;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_v_687;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_v_688;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_689;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_v_690;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_691;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_692;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_v_693;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_694;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_695;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_696;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_697;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_698;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_699;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_600> AgradCcdfLogExpModNormal_v_600;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_601> AgradCcdfLogExpModNormal_v_601;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_602> AgradCcdfLogExpModNormal_v_602;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_603> AgradCcdfLogExpModNormal_v_603;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_604> AgradCcdfLogExpModNormal_v_604;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_605> AgradCcdfLogExpModNormal_v_605;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_606> AgradCcdfLogExpModNormal_v_606;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_607> AgradCcdfLogExpModNormal_v_607;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_608> AgradCcdfLogExpModNormal_v_608;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_609> AgradCcdfLogExpModNormal_v_609;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_610> AgradCcdfLogExpModNormal_v_610;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_611> AgradCcdfLogExpModNormal_v_611;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_612> AgradCcdfLogExpModNormal_v_612;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_613> AgradCcdfLogExpModNormal_v_613;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_614> AgradCcdfLogExpModNormal_v_614;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_615> AgradCcdfLogExpModNormal_v_615;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_616> AgradCcdfLogExpModNormal_v_616;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_617> AgradCcdfLogExpModNormal_v_617;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_618> AgradCcdfLogExpModNormal_v_618;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_619> AgradCcdfLogExpModNormal_v_619;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_620> AgradCcdfLogExpModNormal_v_620;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_621> AgradCcdfLogExpModNormal_v_621;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_622> AgradCcdfLogExpModNormal_v_622;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_623> AgradCcdfLogExpModNormal_v_623;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_624> AgradCcdfLogExpModNormal_v_624;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_625> AgradCcdfLogExpModNormal_v_625;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_626> AgradCcdfLogExpModNormal_v_626;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_627> AgradCcdfLogExpModNormal_v_627;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_628> AgradCcdfLogExpModNormal_v_628;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_629> AgradCcdfLogExpModNormal_v_629;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_630> AgradCcdfLogExpModNormal_v_630;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_631> AgradCcdfLogExpModNormal_v_631;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_632> AgradCcdfLogExpModNormal_v_632;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_633> AgradCcdfLogExpModNormal_v_633;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_634> AgradCcdfLogExpModNormal_v_634;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_635> AgradCcdfLogExpModNormal_v_635;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_636> AgradCcdfLogExpModNormal_v_636;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_637> AgradCcdfLogExpModNormal_v_637;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_638> AgradCcdfLogExpModNormal_v_638;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_639> AgradCcdfLogExpModNormal_v_639;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_640> AgradCcdfLogExpModNormal_v_640;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_641> AgradCcdfLogExpModNormal_v_641;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_642> AgradCcdfLogExpModNormal_v_642;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_643> AgradCcdfLogExpModNormal_v_643;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_644> AgradCcdfLogExpModNormal_v_644;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_645> AgradCcdfLogExpModNormal_v_645;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_646> AgradCcdfLogExpModNormal_v_646;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_647> AgradCcdfLogExpModNormal_v_647;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_648> AgradCcdfLogExpModNormal_v_648;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_649> AgradCcdfLogExpModNormal_v_649;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_650> AgradCcdfLogExpModNormal_v_650;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_651> AgradCcdfLogExpModNormal_v_651;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_652> AgradCcdfLogExpModNormal_v_652;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_653> AgradCcdfLogExpModNormal_v_653;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_654> AgradCcdfLogExpModNormal_v_654;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_655> AgradCcdfLogExpModNormal_v_655;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_656> AgradCcdfLogExpModNormal_v_656;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_657> AgradCcdfLogExpModNormal_v_657;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_658> AgradCcdfLogExpModNormal_v_658;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_659> AgradCcdfLogExpModNormal_v_659;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_660> AgradCcdfLogExpModNormal_v_660;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_661> AgradCcdfLogExpModNormal_v_661;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_662> AgradCcdfLogExpModNormal_v_662;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_663> AgradCcdfLogExpModNormal_v_663;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_664> AgradCcdfLogExpModNormal_v_664;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_665> AgradCcdfLogExpModNormal_v_665;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_666> AgradCcdfLogExpModNormal_v_666;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_667> AgradCcdfLogExpModNormal_v_667;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_668> AgradCcdfLogExpModNormal_v_668;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_669> AgradCcdfLogExpModNormal_v_669;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_670> AgradCcdfLogExpModNormal_v_670;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_671> AgradCcdfLogExpModNormal_v_671;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_672> AgradCcdfLogExpModNormal_v_672;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_673> AgradCcdfLogExpModNormal_v_673;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_674> AgradCcdfLogExpModNormal_v_674;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_675> AgradCcdfLogExpModNormal_v_675;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_676> AgradCcdfLogExpModNormal_v_676;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_677> AgradCcdfLogExpModNormal_v_677;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_678> AgradCcdfLogExpModNormal_v_678;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_679> AgradCcdfLogExpModNormal_v_679;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_680> AgradCcdfLogExpModNormal_v_680;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_681> AgradCcdfLogExpModNormal_v_681;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_682> AgradCcdfLogExpModNormal_v_682;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_683> AgradCcdfLogExpModNormal_v_683;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_684> AgradCcdfLogExpModNormal_v_684;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_685> AgradCcdfLogExpModNormal_v_685;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_686> AgradCcdfLogExpModNormal_v_686;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_687> AgradCcdfLogExpModNormal_v_687;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_688> AgradCcdfLogExpModNormal_v_688;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_689> AgradCcdfLogExpModNormal_v_689;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_690> AgradCcdfLogExpModNormal_v_690;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_691> AgradCcdfLogExpModNormal_v_691;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_692> AgradCcdfLogExpModNormal_v_692;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_693> AgradCcdfLogExpModNormal_v_693;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_694> AgradCcdfLogExpModNormal_v_694;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_695> AgradCcdfLogExpModNormal_v_695;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_696> AgradCcdfLogExpModNormal_v_696;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_697> AgradCcdfLogExpModNormal_v_697;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_698> AgradCcdfLogExpModNormal_v_698;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_699> AgradCcdfLogExpModNormal_v_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_600, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_601, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_602, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_603, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_604, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_605, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_606, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_607, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_608, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_609, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_610, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_611, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_612, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_613, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_614, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_615, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_616, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_617, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_618, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_619, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_620, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_621, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_622, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_623, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_624, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_625, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_626, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_627, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_628, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_629, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_630, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_631, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_632, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_633, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_634, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_635, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_636, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_637, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_638, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_639, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_640, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_641, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_642, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_643, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_644, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_645, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_646, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_647, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_648, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_649, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_650, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_651, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_652, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_653, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_654, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_655, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_656, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_657, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_658, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_659, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_660, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_661, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_662, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_663, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_664, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_665, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_666, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_667, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_668, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_669, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_670, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_671, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_672, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_673, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_674, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_675, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_676, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_677, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_678, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_679, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_680, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_681, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_682, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_683, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_684, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_685, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_686, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_687, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_688, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_689, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_690, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_691, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_692, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_693, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_694, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_695, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_696, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_697, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_698, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_699, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_699);
+
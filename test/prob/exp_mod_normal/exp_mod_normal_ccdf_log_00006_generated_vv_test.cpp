@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_600;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_601;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_602;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_vv_603;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_604;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_605;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_vv_606;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_607;
+typedef std::tuple<var, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_608;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_609;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_610;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_611;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_612;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_613;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_614;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_615;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_616;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_617;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_618;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_619;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_620;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_vv_621;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_622;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_623;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_vv_624;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_625;
+typedef std::tuple<var, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_626;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_627;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_628;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_629;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_630;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_631;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_632;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_633;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_634;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_635;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_636;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_637;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_638;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_639;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_640;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_641;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_642;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_643;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_644;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_645;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_646;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_647;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_648;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_649;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_650;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_651;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_652;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_653;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_654;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_655;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_656;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_657;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_658;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_659;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_660;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_661;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_662;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_663;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_664;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_665;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_666;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_667;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_668;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_669;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_670;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_671;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_672;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_673;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_674;
+typedef std::tuple<var, var, double, double, empty, empty> type_vv_675;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_vv_676;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_677;
+typedef std::tuple<var, var, double, var, empty, empty> type_vv_678;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_vv_679;
+typedef std::tuple<var, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_680;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_vv_681;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_682;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_683;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_vv_684;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_685;
+typedef std::tuple<var, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_686;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_687;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_688;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_689;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_690;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_691;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_692;
+typedef std::tuple<var, var, var, double, empty, empty> type_vv_693;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_vv_694;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_695;
+typedef std::tuple<var, var, var, var, empty, empty> type_vv_696;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_vv_697;
+typedef std::tuple<var, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_698;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_vv_699;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_600> AgradCcdfLogExpModNormal_vv_600;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_601> AgradCcdfLogExpModNormal_vv_601;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_602> AgradCcdfLogExpModNormal_vv_602;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_603> AgradCcdfLogExpModNormal_vv_603;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_604> AgradCcdfLogExpModNormal_vv_604;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_605> AgradCcdfLogExpModNormal_vv_605;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_606> AgradCcdfLogExpModNormal_vv_606;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_607> AgradCcdfLogExpModNormal_vv_607;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_608> AgradCcdfLogExpModNormal_vv_608;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_609> AgradCcdfLogExpModNormal_vv_609;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_610> AgradCcdfLogExpModNormal_vv_610;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_611> AgradCcdfLogExpModNormal_vv_611;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_612> AgradCcdfLogExpModNormal_vv_612;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_613> AgradCcdfLogExpModNormal_vv_613;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_614> AgradCcdfLogExpModNormal_vv_614;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_615> AgradCcdfLogExpModNormal_vv_615;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_616> AgradCcdfLogExpModNormal_vv_616;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_617> AgradCcdfLogExpModNormal_vv_617;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_618> AgradCcdfLogExpModNormal_vv_618;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_619> AgradCcdfLogExpModNormal_vv_619;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_620> AgradCcdfLogExpModNormal_vv_620;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_621> AgradCcdfLogExpModNormal_vv_621;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_622> AgradCcdfLogExpModNormal_vv_622;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_623> AgradCcdfLogExpModNormal_vv_623;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_624> AgradCcdfLogExpModNormal_vv_624;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_625> AgradCcdfLogExpModNormal_vv_625;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_626> AgradCcdfLogExpModNormal_vv_626;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_627> AgradCcdfLogExpModNormal_vv_627;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_628> AgradCcdfLogExpModNormal_vv_628;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_629> AgradCcdfLogExpModNormal_vv_629;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_630> AgradCcdfLogExpModNormal_vv_630;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_631> AgradCcdfLogExpModNormal_vv_631;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_632> AgradCcdfLogExpModNormal_vv_632;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_633> AgradCcdfLogExpModNormal_vv_633;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_634> AgradCcdfLogExpModNormal_vv_634;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_635> AgradCcdfLogExpModNormal_vv_635;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_636> AgradCcdfLogExpModNormal_vv_636;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_637> AgradCcdfLogExpModNormal_vv_637;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_638> AgradCcdfLogExpModNormal_vv_638;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_639> AgradCcdfLogExpModNormal_vv_639;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_640> AgradCcdfLogExpModNormal_vv_640;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_641> AgradCcdfLogExpModNormal_vv_641;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_642> AgradCcdfLogExpModNormal_vv_642;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_643> AgradCcdfLogExpModNormal_vv_643;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_644> AgradCcdfLogExpModNormal_vv_644;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_645> AgradCcdfLogExpModNormal_vv_645;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_646> AgradCcdfLogExpModNormal_vv_646;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_647> AgradCcdfLogExpModNormal_vv_647;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_648> AgradCcdfLogExpModNormal_vv_648;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_649> AgradCcdfLogExpModNormal_vv_649;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_650> AgradCcdfLogExpModNormal_vv_650;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_651> AgradCcdfLogExpModNormal_vv_651;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_652> AgradCcdfLogExpModNormal_vv_652;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_653> AgradCcdfLogExpModNormal_vv_653;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_654> AgradCcdfLogExpModNormal_vv_654;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_655> AgradCcdfLogExpModNormal_vv_655;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_656> AgradCcdfLogExpModNormal_vv_656;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_657> AgradCcdfLogExpModNormal_vv_657;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_658> AgradCcdfLogExpModNormal_vv_658;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_659> AgradCcdfLogExpModNormal_vv_659;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_660> AgradCcdfLogExpModNormal_vv_660;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_661> AgradCcdfLogExpModNormal_vv_661;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_662> AgradCcdfLogExpModNormal_vv_662;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_663> AgradCcdfLogExpModNormal_vv_663;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_664> AgradCcdfLogExpModNormal_vv_664;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_665> AgradCcdfLogExpModNormal_vv_665;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_666> AgradCcdfLogExpModNormal_vv_666;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_667> AgradCcdfLogExpModNormal_vv_667;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_668> AgradCcdfLogExpModNormal_vv_668;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_669> AgradCcdfLogExpModNormal_vv_669;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_670> AgradCcdfLogExpModNormal_vv_670;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_671> AgradCcdfLogExpModNormal_vv_671;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_672> AgradCcdfLogExpModNormal_vv_672;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_673> AgradCcdfLogExpModNormal_vv_673;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_674> AgradCcdfLogExpModNormal_vv_674;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_675> AgradCcdfLogExpModNormal_vv_675;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_676> AgradCcdfLogExpModNormal_vv_676;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_677> AgradCcdfLogExpModNormal_vv_677;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_678> AgradCcdfLogExpModNormal_vv_678;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_679> AgradCcdfLogExpModNormal_vv_679;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_680> AgradCcdfLogExpModNormal_vv_680;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_681> AgradCcdfLogExpModNormal_vv_681;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_682> AgradCcdfLogExpModNormal_vv_682;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_683> AgradCcdfLogExpModNormal_vv_683;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_684> AgradCcdfLogExpModNormal_vv_684;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_685> AgradCcdfLogExpModNormal_vv_685;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_686> AgradCcdfLogExpModNormal_vv_686;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_687> AgradCcdfLogExpModNormal_vv_687;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_688> AgradCcdfLogExpModNormal_vv_688;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_689> AgradCcdfLogExpModNormal_vv_689;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_690> AgradCcdfLogExpModNormal_vv_690;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_691> AgradCcdfLogExpModNormal_vv_691;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_692> AgradCcdfLogExpModNormal_vv_692;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_693> AgradCcdfLogExpModNormal_vv_693;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_694> AgradCcdfLogExpModNormal_vv_694;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_695> AgradCcdfLogExpModNormal_vv_695;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_696> AgradCcdfLogExpModNormal_vv_696;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_697> AgradCcdfLogExpModNormal_vv_697;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_698> AgradCcdfLogExpModNormal_vv_698;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_699> AgradCcdfLogExpModNormal_vv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_600, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_601, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_602, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_603, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_604, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_605, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_606, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_607, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_608, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_609, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_610, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_611, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_612, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_613, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_614, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_615, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_616, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_617, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_618, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_619, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_620, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_621, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_622, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_623, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_624, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_625, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_626, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_627, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_628, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_629, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_630, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_631, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_632, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_633, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_634, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_635, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_636, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_637, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_638, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_639, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_640, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_641, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_642, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_643, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_644, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_645, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_646, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_647, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_648, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_649, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_650, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_651, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_652, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_653, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_654, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_655, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_656, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_657, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_658, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_659, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_660, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_661, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_662, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_663, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_664, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_665, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_666, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_667, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_668, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_669, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_670, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_671, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_672, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_673, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_674, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_675, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_676, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_677, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_678, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_679, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_680, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_681, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_682, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_683, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_684, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_685, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_686, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_687, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_688, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_689, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_690, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_691, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_692, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_693, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_694, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_695, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_696, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_697, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_698, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_699, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_700;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_701;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_702;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_703;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_704;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_705;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_706;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_707;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_708;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_709;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_710;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_711;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_712;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_713;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_714;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_715;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_716;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_717;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_718;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_719;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_720;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_721;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_722;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_723;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_724;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_725;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_726;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_727;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_728;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_729;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_730;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_731;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_732;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_733;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_734;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_735;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_736;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_737;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_738;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_739;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_740;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_741;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_742;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_743;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_744;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_745;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_746;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_747;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_748;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_749;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_750;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_751;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_752;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_753;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_754;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_755;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_756;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_757;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_758;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_759;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_760;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_761;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_762;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_763;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_764;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_765;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_766;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_767;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_768;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_769;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_770;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_771;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_772;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_773;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_774;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_775;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_776;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_777;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_778;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_779;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_780;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_781;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_782;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, double, empty, empty> type_ffv_783;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty, empty> type_ffv_784;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_785;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_786;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_787;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_788;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty, empty> type_ffv_789;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_790;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_791;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_792;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_793;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_794;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_795;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_796;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_797;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_798;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_799;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_700> AgradCcdfLogExpModNormal_ffv_700;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_701> AgradCcdfLogExpModNormal_ffv_701;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_702> AgradCcdfLogExpModNormal_ffv_702;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_703> AgradCcdfLogExpModNormal_ffv_703;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_704> AgradCcdfLogExpModNormal_ffv_704;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_705> AgradCcdfLogExpModNormal_ffv_705;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_706> AgradCcdfLogExpModNormal_ffv_706;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_707> AgradCcdfLogExpModNormal_ffv_707;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_708> AgradCcdfLogExpModNormal_ffv_708;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_709> AgradCcdfLogExpModNormal_ffv_709;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_710> AgradCcdfLogExpModNormal_ffv_710;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_711> AgradCcdfLogExpModNormal_ffv_711;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_712> AgradCcdfLogExpModNormal_ffv_712;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_713> AgradCcdfLogExpModNormal_ffv_713;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_714> AgradCcdfLogExpModNormal_ffv_714;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_715> AgradCcdfLogExpModNormal_ffv_715;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_716> AgradCcdfLogExpModNormal_ffv_716;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_717> AgradCcdfLogExpModNormal_ffv_717;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_718> AgradCcdfLogExpModNormal_ffv_718;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_719> AgradCcdfLogExpModNormal_ffv_719;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_720> AgradCcdfLogExpModNormal_ffv_720;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_721> AgradCcdfLogExpModNormal_ffv_721;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_722> AgradCcdfLogExpModNormal_ffv_722;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_723> AgradCcdfLogExpModNormal_ffv_723;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_724> AgradCcdfLogExpModNormal_ffv_724;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_725> AgradCcdfLogExpModNormal_ffv_725;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_726> AgradCcdfLogExpModNormal_ffv_726;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_727> AgradCcdfLogExpModNormal_ffv_727;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_728> AgradCcdfLogExpModNormal_ffv_728;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_729> AgradCcdfLogExpModNormal_ffv_729;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_730> AgradCcdfLogExpModNormal_ffv_730;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_731> AgradCcdfLogExpModNormal_ffv_731;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_732> AgradCcdfLogExpModNormal_ffv_732;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_733> AgradCcdfLogExpModNormal_ffv_733;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_734> AgradCcdfLogExpModNormal_ffv_734;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_735> AgradCcdfLogExpModNormal_ffv_735;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_736> AgradCcdfLogExpModNormal_ffv_736;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_737> AgradCcdfLogExpModNormal_ffv_737;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_738> AgradCcdfLogExpModNormal_ffv_738;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_739> AgradCcdfLogExpModNormal_ffv_739;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_740> AgradCcdfLogExpModNormal_ffv_740;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_741> AgradCcdfLogExpModNormal_ffv_741;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_742> AgradCcdfLogExpModNormal_ffv_742;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_743> AgradCcdfLogExpModNormal_ffv_743;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_744> AgradCcdfLogExpModNormal_ffv_744;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_745> AgradCcdfLogExpModNormal_ffv_745;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_746> AgradCcdfLogExpModNormal_ffv_746;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_747> AgradCcdfLogExpModNormal_ffv_747;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_748> AgradCcdfLogExpModNormal_ffv_748;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_749> AgradCcdfLogExpModNormal_ffv_749;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_750> AgradCcdfLogExpModNormal_ffv_750;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_751> AgradCcdfLogExpModNormal_ffv_751;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_752> AgradCcdfLogExpModNormal_ffv_752;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_753> AgradCcdfLogExpModNormal_ffv_753;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_754> AgradCcdfLogExpModNormal_ffv_754;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_755> AgradCcdfLogExpModNormal_ffv_755;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_756> AgradCcdfLogExpModNormal_ffv_756;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_757> AgradCcdfLogExpModNormal_ffv_757;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_758> AgradCcdfLogExpModNormal_ffv_758;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_759> AgradCcdfLogExpModNormal_ffv_759;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_760> AgradCcdfLogExpModNormal_ffv_760;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_761> AgradCcdfLogExpModNormal_ffv_761;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_762> AgradCcdfLogExpModNormal_ffv_762;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_763> AgradCcdfLogExpModNormal_ffv_763;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_764> AgradCcdfLogExpModNormal_ffv_764;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_765> AgradCcdfLogExpModNormal_ffv_765;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_766> AgradCcdfLogExpModNormal_ffv_766;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_767> AgradCcdfLogExpModNormal_ffv_767;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_768> AgradCcdfLogExpModNormal_ffv_768;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_769> AgradCcdfLogExpModNormal_ffv_769;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_770> AgradCcdfLogExpModNormal_ffv_770;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_771> AgradCcdfLogExpModNormal_ffv_771;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_772> AgradCcdfLogExpModNormal_ffv_772;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_773> AgradCcdfLogExpModNormal_ffv_773;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_774> AgradCcdfLogExpModNormal_ffv_774;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_775> AgradCcdfLogExpModNormal_ffv_775;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_776> AgradCcdfLogExpModNormal_ffv_776;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_777> AgradCcdfLogExpModNormal_ffv_777;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_778> AgradCcdfLogExpModNormal_ffv_778;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_779> AgradCcdfLogExpModNormal_ffv_779;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_780> AgradCcdfLogExpModNormal_ffv_780;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_781> AgradCcdfLogExpModNormal_ffv_781;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_782> AgradCcdfLogExpModNormal_ffv_782;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_783> AgradCcdfLogExpModNormal_ffv_783;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_784> AgradCcdfLogExpModNormal_ffv_784;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_785> AgradCcdfLogExpModNormal_ffv_785;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_786> AgradCcdfLogExpModNormal_ffv_786;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_787> AgradCcdfLogExpModNormal_ffv_787;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_788> AgradCcdfLogExpModNormal_ffv_788;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_789> AgradCcdfLogExpModNormal_ffv_789;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_790> AgradCcdfLogExpModNormal_ffv_790;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_791> AgradCcdfLogExpModNormal_ffv_791;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_792> AgradCcdfLogExpModNormal_ffv_792;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_793> AgradCcdfLogExpModNormal_ffv_793;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_794> AgradCcdfLogExpModNormal_ffv_794;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_795> AgradCcdfLogExpModNormal_ffv_795;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_796> AgradCcdfLogExpModNormal_ffv_796;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_797> AgradCcdfLogExpModNormal_ffv_797;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_798> AgradCcdfLogExpModNormal_ffv_798;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_799> AgradCcdfLogExpModNormal_ffv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_700, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_701, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_702, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_703, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_704, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_705, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_706, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_707, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_708, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_709, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_710, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_711, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_712, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_713, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_714, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_715, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_716, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_717, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_718, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_719, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_720, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_721, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_722, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_723, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_724, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_725, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_726, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_727, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_728, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_729, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_730, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_731, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_732, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_733, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_734, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_735, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_736, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_737, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_738, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_739, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_740, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_741, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_742, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_743, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_744, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_745, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_746, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_747, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_748, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_749, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_750, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_751, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_752, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_753, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_754, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_755, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_756, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_757, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_758, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_759, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_760, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_761, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_762, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_763, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_764, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_765, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_766, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_767, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_768, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_769, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_770, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_771, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_772, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_773, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_774, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_775, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_776, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_777, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_778, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_779, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_780, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_781, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_782, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_783, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_784, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_785, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_786, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_787, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_788, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_789, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_790, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_791, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_792, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_793, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_794, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_795, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_796, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_797, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_798, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_799, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_799);
+
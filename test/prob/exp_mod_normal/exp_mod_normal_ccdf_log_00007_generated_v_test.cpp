@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_700;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_701;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_v_702;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_v_703;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_704;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_v_705;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_v_706;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_707;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_v_708;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_709;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_710;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_v_711;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_712;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_713;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_714;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_715;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_716;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_717;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_718;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_719;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_720;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_721;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_722;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_723;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_724;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_725;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_726;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_727;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_728;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_729;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_730;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_731;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_732;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_733;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_734;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_735;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_736;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_737;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_738;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_739;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_740;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_741;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_742;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_743;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_744;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_745;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_746;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_747;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_748;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_749;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_750;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_751;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_752;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_753;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_754;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_755;
+typedef std::tuple<var, var, double, double, empty, empty> type_v_756;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_v_757;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_758;
+typedef std::tuple<var, var, double, var, empty, empty> type_v_759;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_v_760;
+typedef std::tuple<var, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_761;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_v_762;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_v_763;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_764;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_v_765;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_v_766;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_767;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_768;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_769;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_770;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_771;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_772;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_773;
+typedef std::tuple<var, var, var, double, empty, empty> type_v_774;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_v_775;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_776;
+typedef std::tuple<var, var, var, var, empty, empty> type_v_777;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_v_778;
+typedef std::tuple<var, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_779;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_v_780;
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_v_781;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_782;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_v_783;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_v_784;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_785;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_786;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_787;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_788;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_789;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_790;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_791;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_v_792;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_v_793;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_794;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_v_795;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_v_796;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_797;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_v_798;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_799;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_700> AgradCcdfLogExpModNormal_v_700;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_701> AgradCcdfLogExpModNormal_v_701;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_702> AgradCcdfLogExpModNormal_v_702;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_703> AgradCcdfLogExpModNormal_v_703;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_704> AgradCcdfLogExpModNormal_v_704;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_705> AgradCcdfLogExpModNormal_v_705;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_706> AgradCcdfLogExpModNormal_v_706;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_707> AgradCcdfLogExpModNormal_v_707;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_708> AgradCcdfLogExpModNormal_v_708;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_709> AgradCcdfLogExpModNormal_v_709;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_710> AgradCcdfLogExpModNormal_v_710;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_711> AgradCcdfLogExpModNormal_v_711;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_712> AgradCcdfLogExpModNormal_v_712;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_713> AgradCcdfLogExpModNormal_v_713;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_714> AgradCcdfLogExpModNormal_v_714;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_715> AgradCcdfLogExpModNormal_v_715;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_716> AgradCcdfLogExpModNormal_v_716;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_717> AgradCcdfLogExpModNormal_v_717;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_718> AgradCcdfLogExpModNormal_v_718;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_719> AgradCcdfLogExpModNormal_v_719;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_720> AgradCcdfLogExpModNormal_v_720;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_721> AgradCcdfLogExpModNormal_v_721;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_722> AgradCcdfLogExpModNormal_v_722;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_723> AgradCcdfLogExpModNormal_v_723;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_724> AgradCcdfLogExpModNormal_v_724;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_725> AgradCcdfLogExpModNormal_v_725;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_726> AgradCcdfLogExpModNormal_v_726;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_727> AgradCcdfLogExpModNormal_v_727;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_728> AgradCcdfLogExpModNormal_v_728;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_729> AgradCcdfLogExpModNormal_v_729;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_730> AgradCcdfLogExpModNormal_v_730;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_731> AgradCcdfLogExpModNormal_v_731;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_732> AgradCcdfLogExpModNormal_v_732;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_733> AgradCcdfLogExpModNormal_v_733;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_734> AgradCcdfLogExpModNormal_v_734;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_735> AgradCcdfLogExpModNormal_v_735;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_736> AgradCcdfLogExpModNormal_v_736;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_737> AgradCcdfLogExpModNormal_v_737;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_738> AgradCcdfLogExpModNormal_v_738;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_739> AgradCcdfLogExpModNormal_v_739;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_740> AgradCcdfLogExpModNormal_v_740;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_741> AgradCcdfLogExpModNormal_v_741;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_742> AgradCcdfLogExpModNormal_v_742;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_743> AgradCcdfLogExpModNormal_v_743;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_744> AgradCcdfLogExpModNormal_v_744;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_745> AgradCcdfLogExpModNormal_v_745;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_746> AgradCcdfLogExpModNormal_v_746;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_747> AgradCcdfLogExpModNormal_v_747;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_748> AgradCcdfLogExpModNormal_v_748;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_749> AgradCcdfLogExpModNormal_v_749;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_750> AgradCcdfLogExpModNormal_v_750;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_751> AgradCcdfLogExpModNormal_v_751;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_752> AgradCcdfLogExpModNormal_v_752;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_753> AgradCcdfLogExpModNormal_v_753;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_754> AgradCcdfLogExpModNormal_v_754;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_755> AgradCcdfLogExpModNormal_v_755;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_756> AgradCcdfLogExpModNormal_v_756;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_757> AgradCcdfLogExpModNormal_v_757;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_758> AgradCcdfLogExpModNormal_v_758;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_759> AgradCcdfLogExpModNormal_v_759;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_760> AgradCcdfLogExpModNormal_v_760;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_761> AgradCcdfLogExpModNormal_v_761;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_762> AgradCcdfLogExpModNormal_v_762;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_763> AgradCcdfLogExpModNormal_v_763;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_764> AgradCcdfLogExpModNormal_v_764;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_765> AgradCcdfLogExpModNormal_v_765;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_766> AgradCcdfLogExpModNormal_v_766;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_767> AgradCcdfLogExpModNormal_v_767;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_768> AgradCcdfLogExpModNormal_v_768;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_769> AgradCcdfLogExpModNormal_v_769;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_770> AgradCcdfLogExpModNormal_v_770;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_771> AgradCcdfLogExpModNormal_v_771;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_772> AgradCcdfLogExpModNormal_v_772;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_773> AgradCcdfLogExpModNormal_v_773;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_774> AgradCcdfLogExpModNormal_v_774;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_775> AgradCcdfLogExpModNormal_v_775;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_776> AgradCcdfLogExpModNormal_v_776;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_777> AgradCcdfLogExpModNormal_v_777;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_778> AgradCcdfLogExpModNormal_v_778;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_779> AgradCcdfLogExpModNormal_v_779;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_780> AgradCcdfLogExpModNormal_v_780;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_781> AgradCcdfLogExpModNormal_v_781;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_782> AgradCcdfLogExpModNormal_v_782;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_783> AgradCcdfLogExpModNormal_v_783;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_784> AgradCcdfLogExpModNormal_v_784;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_785> AgradCcdfLogExpModNormal_v_785;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_786> AgradCcdfLogExpModNormal_v_786;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_787> AgradCcdfLogExpModNormal_v_787;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_788> AgradCcdfLogExpModNormal_v_788;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_789> AgradCcdfLogExpModNormal_v_789;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_790> AgradCcdfLogExpModNormal_v_790;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_791> AgradCcdfLogExpModNormal_v_791;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_792> AgradCcdfLogExpModNormal_v_792;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_793> AgradCcdfLogExpModNormal_v_793;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_794> AgradCcdfLogExpModNormal_v_794;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_795> AgradCcdfLogExpModNormal_v_795;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_796> AgradCcdfLogExpModNormal_v_796;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_797> AgradCcdfLogExpModNormal_v_797;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_798> AgradCcdfLogExpModNormal_v_798;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_799> AgradCcdfLogExpModNormal_v_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_700, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_701, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_702, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_703, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_704, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_705, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_706, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_707, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_708, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_709, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_710, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_711, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_712, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_713, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_714, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_715, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_716, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_717, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_718, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_719, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_720, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_721, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_722, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_723, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_724, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_725, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_726, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_727, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_728, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_729, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_730, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_731, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_732, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_733, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_734, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_735, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_736, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_737, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_738, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_739, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_740, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_741, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_742, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_743, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_744, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_745, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_746, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_747, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_748, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_749, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_750, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_751, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_752, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_753, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_754, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_755, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_756, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_757, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_758, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_759, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_760, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_761, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_762, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_763, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_764, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_765, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_766, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_767, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_768, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_769, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_770, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_771, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_772, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_773, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_774, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_775, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_776, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_777, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_778, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_779, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_780, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_781, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_782, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_783, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_784, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_785, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_786, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_787, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_788, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_789, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_790, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_791, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_792, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_793, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_794, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_795, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_796, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_797, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_798, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_799, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_799);
+
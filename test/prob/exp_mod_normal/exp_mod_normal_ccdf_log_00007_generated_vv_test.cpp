@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_700;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_701;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_vv_702;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_703;
+typedef std::tuple<var, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_704;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_705;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_706;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_707;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_708;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_709;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_710;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_vv_711;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_712;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_713;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_vv_714;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_715;
+typedef std::tuple<var, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_716;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_717;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_718;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_719;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_720;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_721;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_722;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_723;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_724;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_725;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_726;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_727;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_728;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_vv_729;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_730;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_731;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_vv_732;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_733;
+typedef std::tuple<var, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_734;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_735;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_736;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_737;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_738;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_739;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_740;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_741;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_742;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_743;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_744;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_745;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_746;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_747;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_748;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_749;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_750;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_751;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_752;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_753;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_754;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_755;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_756;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_757;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_758;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_759;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_760;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_761;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_762;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_763;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_764;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_765;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_766;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_767;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_768;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_769;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_770;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_771;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_772;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_773;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_774;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_775;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_776;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_777;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_778;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_779;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_780;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_781;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_782;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_vv_783;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_vv_784;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_785;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_vv_786;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_vv_787;
+typedef std::tuple<std::vector<var>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_788;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_vv_789;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_790;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_791;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_vv_792;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_793;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_794;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_795;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_796;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_797;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_798;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_799;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_700> AgradCcdfLogExpModNormal_vv_700;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_701> AgradCcdfLogExpModNormal_vv_701;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_702> AgradCcdfLogExpModNormal_vv_702;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_703> AgradCcdfLogExpModNormal_vv_703;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_704> AgradCcdfLogExpModNormal_vv_704;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_705> AgradCcdfLogExpModNormal_vv_705;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_706> AgradCcdfLogExpModNormal_vv_706;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_707> AgradCcdfLogExpModNormal_vv_707;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_708> AgradCcdfLogExpModNormal_vv_708;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_709> AgradCcdfLogExpModNormal_vv_709;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_710> AgradCcdfLogExpModNormal_vv_710;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_711> AgradCcdfLogExpModNormal_vv_711;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_712> AgradCcdfLogExpModNormal_vv_712;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_713> AgradCcdfLogExpModNormal_vv_713;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_714> AgradCcdfLogExpModNormal_vv_714;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_715> AgradCcdfLogExpModNormal_vv_715;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_716> AgradCcdfLogExpModNormal_vv_716;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_717> AgradCcdfLogExpModNormal_vv_717;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_718> AgradCcdfLogExpModNormal_vv_718;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_719> AgradCcdfLogExpModNormal_vv_719;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_720> AgradCcdfLogExpModNormal_vv_720;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_721> AgradCcdfLogExpModNormal_vv_721;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_722> AgradCcdfLogExpModNormal_vv_722;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_723> AgradCcdfLogExpModNormal_vv_723;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_724> AgradCcdfLogExpModNormal_vv_724;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_725> AgradCcdfLogExpModNormal_vv_725;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_726> AgradCcdfLogExpModNormal_vv_726;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_727> AgradCcdfLogExpModNormal_vv_727;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_728> AgradCcdfLogExpModNormal_vv_728;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_729> AgradCcdfLogExpModNormal_vv_729;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_730> AgradCcdfLogExpModNormal_vv_730;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_731> AgradCcdfLogExpModNormal_vv_731;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_732> AgradCcdfLogExpModNormal_vv_732;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_733> AgradCcdfLogExpModNormal_vv_733;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_734> AgradCcdfLogExpModNormal_vv_734;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_735> AgradCcdfLogExpModNormal_vv_735;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_736> AgradCcdfLogExpModNormal_vv_736;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_737> AgradCcdfLogExpModNormal_vv_737;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_738> AgradCcdfLogExpModNormal_vv_738;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_739> AgradCcdfLogExpModNormal_vv_739;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_740> AgradCcdfLogExpModNormal_vv_740;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_741> AgradCcdfLogExpModNormal_vv_741;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_742> AgradCcdfLogExpModNormal_vv_742;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_743> AgradCcdfLogExpModNormal_vv_743;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_744> AgradCcdfLogExpModNormal_vv_744;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_745> AgradCcdfLogExpModNormal_vv_745;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_746> AgradCcdfLogExpModNormal_vv_746;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_747> AgradCcdfLogExpModNormal_vv_747;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_748> AgradCcdfLogExpModNormal_vv_748;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_749> AgradCcdfLogExpModNormal_vv_749;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_750> AgradCcdfLogExpModNormal_vv_750;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_751> AgradCcdfLogExpModNormal_vv_751;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_752> AgradCcdfLogExpModNormal_vv_752;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_753> AgradCcdfLogExpModNormal_vv_753;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_754> AgradCcdfLogExpModNormal_vv_754;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_755> AgradCcdfLogExpModNormal_vv_755;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_756> AgradCcdfLogExpModNormal_vv_756;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_757> AgradCcdfLogExpModNormal_vv_757;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_758> AgradCcdfLogExpModNormal_vv_758;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_759> AgradCcdfLogExpModNormal_vv_759;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_760> AgradCcdfLogExpModNormal_vv_760;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_761> AgradCcdfLogExpModNormal_vv_761;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_762> AgradCcdfLogExpModNormal_vv_762;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_763> AgradCcdfLogExpModNormal_vv_763;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_764> AgradCcdfLogExpModNormal_vv_764;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_765> AgradCcdfLogExpModNormal_vv_765;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_766> AgradCcdfLogExpModNormal_vv_766;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_767> AgradCcdfLogExpModNormal_vv_767;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_768> AgradCcdfLogExpModNormal_vv_768;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_769> AgradCcdfLogExpModNormal_vv_769;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_770> AgradCcdfLogExpModNormal_vv_770;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_771> AgradCcdfLogExpModNormal_vv_771;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_772> AgradCcdfLogExpModNormal_vv_772;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_773> AgradCcdfLogExpModNormal_vv_773;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_774> AgradCcdfLogExpModNormal_vv_774;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_775> AgradCcdfLogExpModNormal_vv_775;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_776> AgradCcdfLogExpModNormal_vv_776;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_777> AgradCcdfLogExpModNormal_vv_777;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_778> AgradCcdfLogExpModNormal_vv_778;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_779> AgradCcdfLogExpModNormal_vv_779;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_780> AgradCcdfLogExpModNormal_vv_780;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_781> AgradCcdfLogExpModNormal_vv_781;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_782> AgradCcdfLogExpModNormal_vv_782;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_783> AgradCcdfLogExpModNormal_vv_783;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_784> AgradCcdfLogExpModNormal_vv_784;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_785> AgradCcdfLogExpModNormal_vv_785;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_786> AgradCcdfLogExpModNormal_vv_786;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_787> AgradCcdfLogExpModNormal_vv_787;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_788> AgradCcdfLogExpModNormal_vv_788;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_789> AgradCcdfLogExpModNormal_vv_789;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_790> AgradCcdfLogExpModNormal_vv_790;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_791> AgradCcdfLogExpModNormal_vv_791;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_792> AgradCcdfLogExpModNormal_vv_792;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_793> AgradCcdfLogExpModNormal_vv_793;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_794> AgradCcdfLogExpModNormal_vv_794;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_795> AgradCcdfLogExpModNormal_vv_795;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_796> AgradCcdfLogExpModNormal_vv_796;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_797> AgradCcdfLogExpModNormal_vv_797;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_798> AgradCcdfLogExpModNormal_vv_798;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_799> AgradCcdfLogExpModNormal_vv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_700, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_701, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_702, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_703, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_704, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_705, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_706, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_707, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_708, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_709, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_710, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_711, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_712, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_713, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_714, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_715, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_716, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_717, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_718, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_719, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_720, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_721, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_722, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_723, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_724, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_725, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_726, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_727, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_728, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_729, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_730, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_731, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_732, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_733, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_734, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_735, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_736, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_737, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_738, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_739, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_740, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_741, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_742, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_743, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_744, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_745, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_746, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_747, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_748, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_749, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_750, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_751, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_752, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_753, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_754, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_755, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_756, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_757, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_758, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_759, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_760, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_761, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_762, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_763, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_764, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_765, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_766, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_767, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_768, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_769, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_770, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_771, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_772, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_773, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_774, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_775, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_776, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_777, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_778, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_779, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_780, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_781, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_782, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_783, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_784, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_785, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_786, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_787, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_788, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_789, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_790, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_791, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_792, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_793, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_794, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_795, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_796, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_797, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_798, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_799, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_799);
+
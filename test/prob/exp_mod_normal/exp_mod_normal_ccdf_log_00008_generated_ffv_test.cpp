@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_800;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_801;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_802;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_803;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_804;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_805;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_806;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_807;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_808;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_809;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_810;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_811;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_812;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_813;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_814;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_815;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_816;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_817;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_818;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty, empty> type_ffv_819;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_820;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_821;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_822;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_823;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_824;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_825;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_826;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_827;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_828;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_829;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_830;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_831;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_832;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_833;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_834;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_835;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_836;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_837;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_838;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_839;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_840;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_841;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_842;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_843;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_844;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_845;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_846;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_847;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_848;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_849;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_850;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_851;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_852;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_853;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_854;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_855;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_856;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_857;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_858;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_859;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_860;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_861;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_862;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_863;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_864;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_865;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_866;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_867;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_868;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_869;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_870;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_871;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_872;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_873;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_874;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_875;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_876;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_877;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_878;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_879;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_880;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_881;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_882;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_883;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_884;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_885;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_886;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_887;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_888;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_889;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_890;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_891;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_892;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_893;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_894;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_895;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_896;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_897;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_898;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_899;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_800> AgradCcdfLogExpModNormal_ffv_800;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_801> AgradCcdfLogExpModNormal_ffv_801;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_802> AgradCcdfLogExpModNormal_ffv_802;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_803> AgradCcdfLogExpModNormal_ffv_803;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_804> AgradCcdfLogExpModNormal_ffv_804;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_805> AgradCcdfLogExpModNormal_ffv_805;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_806> AgradCcdfLogExpModNormal_ffv_806;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_807> AgradCcdfLogExpModNormal_ffv_807;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_808> AgradCcdfLogExpModNormal_ffv_808;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_809> AgradCcdfLogExpModNormal_ffv_809;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_810> AgradCcdfLogExpModNormal_ffv_810;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_811> AgradCcdfLogExpModNormal_ffv_811;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_812> AgradCcdfLogExpModNormal_ffv_812;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_813> AgradCcdfLogExpModNormal_ffv_813;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_814> AgradCcdfLogExpModNormal_ffv_814;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_815> AgradCcdfLogExpModNormal_ffv_815;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_816> AgradCcdfLogExpModNormal_ffv_816;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_817> AgradCcdfLogExpModNormal_ffv_817;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_818> AgradCcdfLogExpModNormal_ffv_818;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_819> AgradCcdfLogExpModNormal_ffv_819;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_820> AgradCcdfLogExpModNormal_ffv_820;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_821> AgradCcdfLogExpModNormal_ffv_821;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_822> AgradCcdfLogExpModNormal_ffv_822;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_823> AgradCcdfLogExpModNormal_ffv_823;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_824> AgradCcdfLogExpModNormal_ffv_824;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_825> AgradCcdfLogExpModNormal_ffv_825;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_826> AgradCcdfLogExpModNormal_ffv_826;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_827> AgradCcdfLogExpModNormal_ffv_827;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_828> AgradCcdfLogExpModNormal_ffv_828;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_829> AgradCcdfLogExpModNormal_ffv_829;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_830> AgradCcdfLogExpModNormal_ffv_830;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_831> AgradCcdfLogExpModNormal_ffv_831;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_832> AgradCcdfLogExpModNormal_ffv_832;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_833> AgradCcdfLogExpModNormal_ffv_833;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_834> AgradCcdfLogExpModNormal_ffv_834;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_835> AgradCcdfLogExpModNormal_ffv_835;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_836> AgradCcdfLogExpModNormal_ffv_836;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_837> AgradCcdfLogExpModNormal_ffv_837;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_838> AgradCcdfLogExpModNormal_ffv_838;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_839> AgradCcdfLogExpModNormal_ffv_839;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_840> AgradCcdfLogExpModNormal_ffv_840;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_841> AgradCcdfLogExpModNormal_ffv_841;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_842> AgradCcdfLogExpModNormal_ffv_842;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_843> AgradCcdfLogExpModNormal_ffv_843;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_844> AgradCcdfLogExpModNormal_ffv_844;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_845> AgradCcdfLogExpModNormal_ffv_845;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_846> AgradCcdfLogExpModNormal_ffv_846;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_847> AgradCcdfLogExpModNormal_ffv_847;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_848> AgradCcdfLogExpModNormal_ffv_848;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_849> AgradCcdfLogExpModNormal_ffv_849;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_850> AgradCcdfLogExpModNormal_ffv_850;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_851> AgradCcdfLogExpModNormal_ffv_851;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_852> AgradCcdfLogExpModNormal_ffv_852;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_853> AgradCcdfLogExpModNormal_ffv_853;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_854> AgradCcdfLogExpModNormal_ffv_854;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_855> AgradCcdfLogExpModNormal_ffv_855;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_856> AgradCcdfLogExpModNormal_ffv_856;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_857> AgradCcdfLogExpModNormal_ffv_857;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_858> AgradCcdfLogExpModNormal_ffv_858;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_859> AgradCcdfLogExpModNormal_ffv_859;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_860> AgradCcdfLogExpModNormal_ffv_860;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_861> AgradCcdfLogExpModNormal_ffv_861;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_862> AgradCcdfLogExpModNormal_ffv_862;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_863> AgradCcdfLogExpModNormal_ffv_863;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_864> AgradCcdfLogExpModNormal_ffv_864;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_865> AgradCcdfLogExpModNormal_ffv_865;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_866> AgradCcdfLogExpModNormal_ffv_866;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_867> AgradCcdfLogExpModNormal_ffv_867;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_868> AgradCcdfLogExpModNormal_ffv_868;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_869> AgradCcdfLogExpModNormal_ffv_869;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_870> AgradCcdfLogExpModNormal_ffv_870;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_871> AgradCcdfLogExpModNormal_ffv_871;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_872> AgradCcdfLogExpModNormal_ffv_872;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_873> AgradCcdfLogExpModNormal_ffv_873;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_874> AgradCcdfLogExpModNormal_ffv_874;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_875> AgradCcdfLogExpModNormal_ffv_875;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_876> AgradCcdfLogExpModNormal_ffv_876;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_877> AgradCcdfLogExpModNormal_ffv_877;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_878> AgradCcdfLogExpModNormal_ffv_878;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_879> AgradCcdfLogExpModNormal_ffv_879;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_880> AgradCcdfLogExpModNormal_ffv_880;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_881> AgradCcdfLogExpModNormal_ffv_881;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_882> AgradCcdfLogExpModNormal_ffv_882;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_883> AgradCcdfLogExpModNormal_ffv_883;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_884> AgradCcdfLogExpModNormal_ffv_884;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_885> AgradCcdfLogExpModNormal_ffv_885;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_886> AgradCcdfLogExpModNormal_ffv_886;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_887> AgradCcdfLogExpModNormal_ffv_887;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_888> AgradCcdfLogExpModNormal_ffv_888;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_889> AgradCcdfLogExpModNormal_ffv_889;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_890> AgradCcdfLogExpModNormal_ffv_890;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_891> AgradCcdfLogExpModNormal_ffv_891;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_892> AgradCcdfLogExpModNormal_ffv_892;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_893> AgradCcdfLogExpModNormal_ffv_893;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_894> AgradCcdfLogExpModNormal_ffv_894;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_895> AgradCcdfLogExpModNormal_ffv_895;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_896> AgradCcdfLogExpModNormal_ffv_896;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_897> AgradCcdfLogExpModNormal_ffv_897;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_898> AgradCcdfLogExpModNormal_ffv_898;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_899> AgradCcdfLogExpModNormal_ffv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_800, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_801, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_802, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_803, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_804, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_805, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_806, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_807, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_808, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_809, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_810, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_811, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_812, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_813, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_814, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_815, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_816, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_817, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_818, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_819, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_820, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_821, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_822, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_823, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_824, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_825, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_826, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_827, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_828, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_829, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_830, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_831, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_832, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_833, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_834, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_835, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_836, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_837, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_838, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_839, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_840, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_841, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_842, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_843, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_844, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_845, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_846, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_847, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_848, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_849, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_850, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_851, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_852, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_853, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_854, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_855, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_856, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_857, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_858, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_859, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_860, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_861, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_862, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_863, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_864, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_865, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_866, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_867, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_868, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_869, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_870, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_871, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_872, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_873, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_874, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_875, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_876, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_877, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_878, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_879, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_880, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_881, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_882, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_883, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_884, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_885, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_886, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_887, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_888, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_889, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_890, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_891, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_892, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_893, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_894, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_895, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_896, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_897, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_898, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_899, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_800;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_v_801;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_802;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_803;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_804;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_805;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_806;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_807;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_808;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_809;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_v_810;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_v_811;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_812;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_v_813;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_v_814;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_815;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_v_816;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_817;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_818;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_v_819;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_820;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_821;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_822;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_823;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_824;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_825;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_826;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_827;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_828;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_829;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_830;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_831;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_832;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_833;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_834;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_835;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_836;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_837;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_838;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_839;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_840;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_841;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_842;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_843;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_844;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_845;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_846;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_847;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_848;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_849;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_850;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_851;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_852;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_853;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_854;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_855;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_856;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_857;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_858;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_859;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_860;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_861;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_862;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_863;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_v_864;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_v_865;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_866;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_v_867;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_v_868;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_869;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_v_870;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_871;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_872;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_v_873;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_874;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_875;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_876;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_877;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_878;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_879;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_880;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_881;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_v_882;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_v_883;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_884;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_v_885;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_v_886;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_887;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_v_888;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_889;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_890;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_v_891;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_892;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_893;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_894;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_895;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_896;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_897;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_898;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_899;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_800> AgradCcdfLogExpModNormal_v_800;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_801> AgradCcdfLogExpModNormal_v_801;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_802> AgradCcdfLogExpModNormal_v_802;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_803> AgradCcdfLogExpModNormal_v_803;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_804> AgradCcdfLogExpModNormal_v_804;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_805> AgradCcdfLogExpModNormal_v_805;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_806> AgradCcdfLogExpModNormal_v_806;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_807> AgradCcdfLogExpModNormal_v_807;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_808> AgradCcdfLogExpModNormal_v_808;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_809> AgradCcdfLogExpModNormal_v_809;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_810> AgradCcdfLogExpModNormal_v_810;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_811> AgradCcdfLogExpModNormal_v_811;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_812> AgradCcdfLogExpModNormal_v_812;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_813> AgradCcdfLogExpModNormal_v_813;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_814> AgradCcdfLogExpModNormal_v_814;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_815> AgradCcdfLogExpModNormal_v_815;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_816> AgradCcdfLogExpModNormal_v_816;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_817> AgradCcdfLogExpModNormal_v_817;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_818> AgradCcdfLogExpModNormal_v_818;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_819> AgradCcdfLogExpModNormal_v_819;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_820> AgradCcdfLogExpModNormal_v_820;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_821> AgradCcdfLogExpModNormal_v_821;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_822> AgradCcdfLogExpModNormal_v_822;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_823> AgradCcdfLogExpModNormal_v_823;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_824> AgradCcdfLogExpModNormal_v_824;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_825> AgradCcdfLogExpModNormal_v_825;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_826> AgradCcdfLogExpModNormal_v_826;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_827> AgradCcdfLogExpModNormal_v_827;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_828> AgradCcdfLogExpModNormal_v_828;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_829> AgradCcdfLogExpModNormal_v_829;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_830> AgradCcdfLogExpModNormal_v_830;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_831> AgradCcdfLogExpModNormal_v_831;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_832> AgradCcdfLogExpModNormal_v_832;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_833> AgradCcdfLogExpModNormal_v_833;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_834> AgradCcdfLogExpModNormal_v_834;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_835> AgradCcdfLogExpModNormal_v_835;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_836> AgradCcdfLogExpModNormal_v_836;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_837> AgradCcdfLogExpModNormal_v_837;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_838> AgradCcdfLogExpModNormal_v_838;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_839> AgradCcdfLogExpModNormal_v_839;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_840> AgradCcdfLogExpModNormal_v_840;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_841> AgradCcdfLogExpModNormal_v_841;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_842> AgradCcdfLogExpModNormal_v_842;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_843> AgradCcdfLogExpModNormal_v_843;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_844> AgradCcdfLogExpModNormal_v_844;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_845> AgradCcdfLogExpModNormal_v_845;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_846> AgradCcdfLogExpModNormal_v_846;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_847> AgradCcdfLogExpModNormal_v_847;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_848> AgradCcdfLogExpModNormal_v_848;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_849> AgradCcdfLogExpModNormal_v_849;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_850> AgradCcdfLogExpModNormal_v_850;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_851> AgradCcdfLogExpModNormal_v_851;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_852> AgradCcdfLogExpModNormal_v_852;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_853> AgradCcdfLogExpModNormal_v_853;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_854> AgradCcdfLogExpModNormal_v_854;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_855> AgradCcdfLogExpModNormal_v_855;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_856> AgradCcdfLogExpModNormal_v_856;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_857> AgradCcdfLogExpModNormal_v_857;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_858> AgradCcdfLogExpModNormal_v_858;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_859> AgradCcdfLogExpModNormal_v_859;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_860> AgradCcdfLogExpModNormal_v_860;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_861> AgradCcdfLogExpModNormal_v_861;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_862> AgradCcdfLogExpModNormal_v_862;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_863> AgradCcdfLogExpModNormal_v_863;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_864> AgradCcdfLogExpModNormal_v_864;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_865> AgradCcdfLogExpModNormal_v_865;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_866> AgradCcdfLogExpModNormal_v_866;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_867> AgradCcdfLogExpModNormal_v_867;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_868> AgradCcdfLogExpModNormal_v_868;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_869> AgradCcdfLogExpModNormal_v_869;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_870> AgradCcdfLogExpModNormal_v_870;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_871> AgradCcdfLogExpModNormal_v_871;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_872> AgradCcdfLogExpModNormal_v_872;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_873> AgradCcdfLogExpModNormal_v_873;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_874> AgradCcdfLogExpModNormal_v_874;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_875> AgradCcdfLogExpModNormal_v_875;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_876> AgradCcdfLogExpModNormal_v_876;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_877> AgradCcdfLogExpModNormal_v_877;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_878> AgradCcdfLogExpModNormal_v_878;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_879> AgradCcdfLogExpModNormal_v_879;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_880> AgradCcdfLogExpModNormal_v_880;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_881> AgradCcdfLogExpModNormal_v_881;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_882> AgradCcdfLogExpModNormal_v_882;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_883> AgradCcdfLogExpModNormal_v_883;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_884> AgradCcdfLogExpModNormal_v_884;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_885> AgradCcdfLogExpModNormal_v_885;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_886> AgradCcdfLogExpModNormal_v_886;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_887> AgradCcdfLogExpModNormal_v_887;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_888> AgradCcdfLogExpModNormal_v_888;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_889> AgradCcdfLogExpModNormal_v_889;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_890> AgradCcdfLogExpModNormal_v_890;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_891> AgradCcdfLogExpModNormal_v_891;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_892> AgradCcdfLogExpModNormal_v_892;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_893> AgradCcdfLogExpModNormal_v_893;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_894> AgradCcdfLogExpModNormal_v_894;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_895> AgradCcdfLogExpModNormal_v_895;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_896> AgradCcdfLogExpModNormal_v_896;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_897> AgradCcdfLogExpModNormal_v_897;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_898> AgradCcdfLogExpModNormal_v_898;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_899> AgradCcdfLogExpModNormal_v_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_800, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_801, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_802, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_803, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_804, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_805, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_806, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_807, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_808, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_809, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_810, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_811, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_812, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_813, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_814, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_815, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_816, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_817, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_818, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_819, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_820, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_821, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_822, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_823, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_824, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_825, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_826, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_827, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_828, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_829, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_830, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_831, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_832, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_833, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_834, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_835, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_836, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_837, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_838, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_839, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_840, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_841, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_842, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_843, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_844, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_845, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_846, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_847, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_848, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_849, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_850, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_851, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_852, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_853, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_854, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_855, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_856, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_857, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_858, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_859, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_860, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_861, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_862, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_863, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_864, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_865, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_866, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_867, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_868, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_869, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_870, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_871, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_872, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_873, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_874, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_875, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_876, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_877, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_878, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_879, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_880, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_881, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_882, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_883, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_884, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_885, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_886, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_887, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_888, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_889, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_890, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_891, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_892, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_893, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_894, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_895, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_896, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_897, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_898, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_899, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_899);
+
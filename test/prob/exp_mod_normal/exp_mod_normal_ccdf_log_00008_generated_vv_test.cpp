@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_800;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_vv_801;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_vv_802;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_803;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_vv_804;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_vv_805;
+typedef std::tuple<std::vector<var>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_806;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_vv_807;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_808;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_809;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_vv_810;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_811;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_812;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_813;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_814;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_815;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_816;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_817;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_818;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_vv_819;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_820;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_821;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_vv_822;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_823;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_824;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_825;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_826;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_827;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_828;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_829;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_830;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_831;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_832;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_833;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_834;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_835;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_836;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_vv_837;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_838;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_839;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_vv_840;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_841;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_842;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_843;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_844;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_845;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_846;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_847;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_848;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_849;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_850;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_851;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_852;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_853;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_854;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_855;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_856;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_857;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_858;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_859;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_860;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_861;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_862;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_863;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_864;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_865;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_866;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_867;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_868;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_869;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_870;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_871;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_872;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_873;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_874;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_875;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_876;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_877;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_878;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_879;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_880;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_881;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_882;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_883;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_884;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_885;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_886;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_887;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_888;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_889;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_890;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_vv_891;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_vv_892;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_893;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_vv_894;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_vv_895;
+typedef std::tuple<std::vector<var>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_896;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_vv_897;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_898;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_899;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_800> AgradCcdfLogExpModNormal_vv_800;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_801> AgradCcdfLogExpModNormal_vv_801;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_802> AgradCcdfLogExpModNormal_vv_802;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_803> AgradCcdfLogExpModNormal_vv_803;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_804> AgradCcdfLogExpModNormal_vv_804;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_805> AgradCcdfLogExpModNormal_vv_805;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_806> AgradCcdfLogExpModNormal_vv_806;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_807> AgradCcdfLogExpModNormal_vv_807;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_808> AgradCcdfLogExpModNormal_vv_808;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_809> AgradCcdfLogExpModNormal_vv_809;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_810> AgradCcdfLogExpModNormal_vv_810;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_811> AgradCcdfLogExpModNormal_vv_811;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_812> AgradCcdfLogExpModNormal_vv_812;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_813> AgradCcdfLogExpModNormal_vv_813;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_814> AgradCcdfLogExpModNormal_vv_814;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_815> AgradCcdfLogExpModNormal_vv_815;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_816> AgradCcdfLogExpModNormal_vv_816;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_817> AgradCcdfLogExpModNormal_vv_817;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_818> AgradCcdfLogExpModNormal_vv_818;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_819> AgradCcdfLogExpModNormal_vv_819;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_820> AgradCcdfLogExpModNormal_vv_820;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_821> AgradCcdfLogExpModNormal_vv_821;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_822> AgradCcdfLogExpModNormal_vv_822;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_823> AgradCcdfLogExpModNormal_vv_823;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_824> AgradCcdfLogExpModNormal_vv_824;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_825> AgradCcdfLogExpModNormal_vv_825;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_826> AgradCcdfLogExpModNormal_vv_826;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_827> AgradCcdfLogExpModNormal_vv_827;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_828> AgradCcdfLogExpModNormal_vv_828;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_829> AgradCcdfLogExpModNormal_vv_829;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_830> AgradCcdfLogExpModNormal_vv_830;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_831> AgradCcdfLogExpModNormal_vv_831;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_832> AgradCcdfLogExpModNormal_vv_832;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_833> AgradCcdfLogExpModNormal_vv_833;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_834> AgradCcdfLogExpModNormal_vv_834;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_835> AgradCcdfLogExpModNormal_vv_835;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_836> AgradCcdfLogExpModNormal_vv_836;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_837> AgradCcdfLogExpModNormal_vv_837;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_838> AgradCcdfLogExpModNormal_vv_838;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_839> AgradCcdfLogExpModNormal_vv_839;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_840> AgradCcdfLogExpModNormal_vv_840;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_841> AgradCcdfLogExpModNormal_vv_841;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_842> AgradCcdfLogExpModNormal_vv_842;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_843> AgradCcdfLogExpModNormal_vv_843;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_844> AgradCcdfLogExpModNormal_vv_844;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_845> AgradCcdfLogExpModNormal_vv_845;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_846> AgradCcdfLogExpModNormal_vv_846;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_847> AgradCcdfLogExpModNormal_vv_847;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_848> AgradCcdfLogExpModNormal_vv_848;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_849> AgradCcdfLogExpModNormal_vv_849;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_850> AgradCcdfLogExpModNormal_vv_850;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_851> AgradCcdfLogExpModNormal_vv_851;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_852> AgradCcdfLogExpModNormal_vv_852;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_853> AgradCcdfLogExpModNormal_vv_853;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_854> AgradCcdfLogExpModNormal_vv_854;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_855> AgradCcdfLogExpModNormal_vv_855;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_856> AgradCcdfLogExpModNormal_vv_856;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_857> AgradCcdfLogExpModNormal_vv_857;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_858> AgradCcdfLogExpModNormal_vv_858;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_859> AgradCcdfLogExpModNormal_vv_859;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_860> AgradCcdfLogExpModNormal_vv_860;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_861> AgradCcdfLogExpModNormal_vv_861;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_862> AgradCcdfLogExpModNormal_vv_862;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_863> AgradCcdfLogExpModNormal_vv_863;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_864> AgradCcdfLogExpModNormal_vv_864;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_865> AgradCcdfLogExpModNormal_vv_865;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_866> AgradCcdfLogExpModNormal_vv_866;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_867> AgradCcdfLogExpModNormal_vv_867;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_868> AgradCcdfLogExpModNormal_vv_868;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_869> AgradCcdfLogExpModNormal_vv_869;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_870> AgradCcdfLogExpModNormal_vv_870;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_871> AgradCcdfLogExpModNormal_vv_871;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_872> AgradCcdfLogExpModNormal_vv_872;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_873> AgradCcdfLogExpModNormal_vv_873;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_874> AgradCcdfLogExpModNormal_vv_874;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_875> AgradCcdfLogExpModNormal_vv_875;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_876> AgradCcdfLogExpModNormal_vv_876;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_877> AgradCcdfLogExpModNormal_vv_877;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_878> AgradCcdfLogExpModNormal_vv_878;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_879> AgradCcdfLogExpModNormal_vv_879;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_880> AgradCcdfLogExpModNormal_vv_880;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_881> AgradCcdfLogExpModNormal_vv_881;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_882> AgradCcdfLogExpModNormal_vv_882;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_883> AgradCcdfLogExpModNormal_vv_883;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_884> AgradCcdfLogExpModNormal_vv_884;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_885> AgradCcdfLogExpModNormal_vv_885;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_886> AgradCcdfLogExpModNormal_vv_886;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_887> AgradCcdfLogExpModNormal_vv_887;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_888> AgradCcdfLogExpModNormal_vv_888;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_889> AgradCcdfLogExpModNormal_vv_889;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_890> AgradCcdfLogExpModNormal_vv_890;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_891> AgradCcdfLogExpModNormal_vv_891;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_892> AgradCcdfLogExpModNormal_vv_892;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_893> AgradCcdfLogExpModNormal_vv_893;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_894> AgradCcdfLogExpModNormal_vv_894;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_895> AgradCcdfLogExpModNormal_vv_895;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_896> AgradCcdfLogExpModNormal_vv_896;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_897> AgradCcdfLogExpModNormal_vv_897;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_898> AgradCcdfLogExpModNormal_vv_898;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_899> AgradCcdfLogExpModNormal_vv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_800, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_801, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_802, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_803, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_804, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_805, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_806, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_807, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_808, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_809, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_810, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_811, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_812, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_813, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_814, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_815, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_816, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_817, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_818, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_819, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_820, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_821, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_822, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_823, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_824, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_825, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_826, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_827, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_828, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_829, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_830, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_831, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_832, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_833, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_834, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_835, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_836, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_837, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_838, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_839, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_840, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_841, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_842, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_843, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_844, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_845, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_846, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_847, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_848, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_849, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_850, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_851, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_852, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_853, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_854, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_855, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_856, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_857, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_858, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_859, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_860, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_861, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_862, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_863, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_864, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_865, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_866, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_867, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_868, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_869, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_870, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_871, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_872, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_873, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_874, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_875, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_876, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_877, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_878, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_879, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_880, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_881, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_882, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_883, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_884, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_885, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_886, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_887, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_888, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_889, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_890, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_891, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_892, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_893, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_894, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_895, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_896, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_897, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_898, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_899, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_900;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_901;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_902;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_903;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_904;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_905;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_906;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_907;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_908;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_909;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_910;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_911;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_912;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_913;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_914;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_915;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_916;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_917;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_918;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_919;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_920;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_921;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_922;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_923;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_924;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_925;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_926;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_927;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_928;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_929;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_930;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_931;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_932;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_933;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_934;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_935;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_936;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_937;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_938;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_939;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_940;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_941;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_942;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_943;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_944;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_945;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_946;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_947;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_948;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_949;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_950;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_951;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_952;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_953;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_954;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_955;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_956;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_957;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_958;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_959;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_960;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_961;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_962;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_963;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_964;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_965;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_966;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_967;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_968;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_969;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_970;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_971;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_972;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_973;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_974;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_975;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_976;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_977;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_978;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_979;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_980;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_981;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_982;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_983;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_984;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_985;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_986;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_987;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_988;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_989;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_990;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_991;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_992;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_993;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_994;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_995;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_996;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_997;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_998;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_ffv_999;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_900> AgradCcdfLogExpModNormal_ffv_900;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_901> AgradCcdfLogExpModNormal_ffv_901;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_902> AgradCcdfLogExpModNormal_ffv_902;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_903> AgradCcdfLogExpModNormal_ffv_903;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_904> AgradCcdfLogExpModNormal_ffv_904;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_905> AgradCcdfLogExpModNormal_ffv_905;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_906> AgradCcdfLogExpModNormal_ffv_906;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_907> AgradCcdfLogExpModNormal_ffv_907;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_908> AgradCcdfLogExpModNormal_ffv_908;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_909> AgradCcdfLogExpModNormal_ffv_909;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_910> AgradCcdfLogExpModNormal_ffv_910;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_911> AgradCcdfLogExpModNormal_ffv_911;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_912> AgradCcdfLogExpModNormal_ffv_912;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_913> AgradCcdfLogExpModNormal_ffv_913;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_914> AgradCcdfLogExpModNormal_ffv_914;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_915> AgradCcdfLogExpModNormal_ffv_915;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_916> AgradCcdfLogExpModNormal_ffv_916;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_917> AgradCcdfLogExpModNormal_ffv_917;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_918> AgradCcdfLogExpModNormal_ffv_918;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_919> AgradCcdfLogExpModNormal_ffv_919;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_920> AgradCcdfLogExpModNormal_ffv_920;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_921> AgradCcdfLogExpModNormal_ffv_921;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_922> AgradCcdfLogExpModNormal_ffv_922;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_923> AgradCcdfLogExpModNormal_ffv_923;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_924> AgradCcdfLogExpModNormal_ffv_924;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_925> AgradCcdfLogExpModNormal_ffv_925;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_926> AgradCcdfLogExpModNormal_ffv_926;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_927> AgradCcdfLogExpModNormal_ffv_927;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_928> AgradCcdfLogExpModNormal_ffv_928;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_929> AgradCcdfLogExpModNormal_ffv_929;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_930> AgradCcdfLogExpModNormal_ffv_930;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_931> AgradCcdfLogExpModNormal_ffv_931;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_932> AgradCcdfLogExpModNormal_ffv_932;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_933> AgradCcdfLogExpModNormal_ffv_933;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_934> AgradCcdfLogExpModNormal_ffv_934;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_935> AgradCcdfLogExpModNormal_ffv_935;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_936> AgradCcdfLogExpModNormal_ffv_936;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_937> AgradCcdfLogExpModNormal_ffv_937;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_938> AgradCcdfLogExpModNormal_ffv_938;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_939> AgradCcdfLogExpModNormal_ffv_939;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_940> AgradCcdfLogExpModNormal_ffv_940;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_941> AgradCcdfLogExpModNormal_ffv_941;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_942> AgradCcdfLogExpModNormal_ffv_942;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_943> AgradCcdfLogExpModNormal_ffv_943;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_944> AgradCcdfLogExpModNormal_ffv_944;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_945> AgradCcdfLogExpModNormal_ffv_945;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_946> AgradCcdfLogExpModNormal_ffv_946;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_947> AgradCcdfLogExpModNormal_ffv_947;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_948> AgradCcdfLogExpModNormal_ffv_948;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_949> AgradCcdfLogExpModNormal_ffv_949;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_950> AgradCcdfLogExpModNormal_ffv_950;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_951> AgradCcdfLogExpModNormal_ffv_951;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_952> AgradCcdfLogExpModNormal_ffv_952;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_953> AgradCcdfLogExpModNormal_ffv_953;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_954> AgradCcdfLogExpModNormal_ffv_954;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_955> AgradCcdfLogExpModNormal_ffv_955;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_956> AgradCcdfLogExpModNormal_ffv_956;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_957> AgradCcdfLogExpModNormal_ffv_957;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_958> AgradCcdfLogExpModNormal_ffv_958;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_959> AgradCcdfLogExpModNormal_ffv_959;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_960> AgradCcdfLogExpModNormal_ffv_960;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_961> AgradCcdfLogExpModNormal_ffv_961;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_962> AgradCcdfLogExpModNormal_ffv_962;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_963> AgradCcdfLogExpModNormal_ffv_963;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_964> AgradCcdfLogExpModNormal_ffv_964;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_965> AgradCcdfLogExpModNormal_ffv_965;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_966> AgradCcdfLogExpModNormal_ffv_966;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_967> AgradCcdfLogExpModNormal_ffv_967;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_968> AgradCcdfLogExpModNormal_ffv_968;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_969> AgradCcdfLogExpModNormal_ffv_969;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_970> AgradCcdfLogExpModNormal_ffv_970;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_971> AgradCcdfLogExpModNormal_ffv_971;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_972> AgradCcdfLogExpModNormal_ffv_972;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_973> AgradCcdfLogExpModNormal_ffv_973;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_974> AgradCcdfLogExpModNormal_ffv_974;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_975> AgradCcdfLogExpModNormal_ffv_975;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_976> AgradCcdfLogExpModNormal_ffv_976;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_977> AgradCcdfLogExpModNormal_ffv_977;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_978> AgradCcdfLogExpModNormal_ffv_978;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_979> AgradCcdfLogExpModNormal_ffv_979;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_980> AgradCcdfLogExpModNormal_ffv_980;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_981> AgradCcdfLogExpModNormal_ffv_981;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_982> AgradCcdfLogExpModNormal_ffv_982;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_983> AgradCcdfLogExpModNormal_ffv_983;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_984> AgradCcdfLogExpModNormal_ffv_984;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_985> AgradCcdfLogExpModNormal_ffv_985;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_986> AgradCcdfLogExpModNormal_ffv_986;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_987> AgradCcdfLogExpModNormal_ffv_987;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_988> AgradCcdfLogExpModNormal_ffv_988;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_989> AgradCcdfLogExpModNormal_ffv_989;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_990> AgradCcdfLogExpModNormal_ffv_990;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_991> AgradCcdfLogExpModNormal_ffv_991;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_992> AgradCcdfLogExpModNormal_ffv_992;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_993> AgradCcdfLogExpModNormal_ffv_993;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_994> AgradCcdfLogExpModNormal_ffv_994;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_995> AgradCcdfLogExpModNormal_ffv_995;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_996> AgradCcdfLogExpModNormal_ffv_996;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_997> AgradCcdfLogExpModNormal_ffv_997;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_998> AgradCcdfLogExpModNormal_ffv_998;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_999> AgradCcdfLogExpModNormal_ffv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_900, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_901, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_902, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_903, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_904, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_905, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_906, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_907, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_908, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_909, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_910, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_911, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_912, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_913, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_914, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_915, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_916, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_917, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_918, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_919, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_920, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_921, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_922, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_923, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_924, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_925, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_926, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_927, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_928, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_929, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_930, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_931, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_932, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_933, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_934, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_935, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_936, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_937, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_938, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_939, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_940, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_941, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_942, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_943, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_944, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_945, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_946, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_947, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_948, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_949, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_950, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_951, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_952, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_953, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_954, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_955, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_956, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_957, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_958, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_959, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_960, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_961, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_962, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_963, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_964, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_965, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_966, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_967, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_968, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_969, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_970, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_971, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_972, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_973, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_974, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_975, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_976, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_977, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_978, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_979, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_980, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_981, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_982, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_983, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_984, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_985, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_986, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_987, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_988, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_989, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_990, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_991, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_992, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_993, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_994, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_995, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_996, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_997, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_998, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_999, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_999);
+
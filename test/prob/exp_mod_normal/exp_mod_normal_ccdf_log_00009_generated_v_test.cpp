@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_v_900;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_901;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_902;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_v_903;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_904;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_905;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_906;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_907;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_908;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_909;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_910;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_911;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_912;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_913;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_914;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_915;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_916;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_917;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_v_918;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_919;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_920;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_v_921;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_922;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_923;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_924;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_925;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_926;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_927;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_928;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_929;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_930;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_931;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_932;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_933;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_934;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_935;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_936;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_937;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_938;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_939;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_940;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_941;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_942;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_943;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_944;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_945;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_946;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_947;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_948;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_949;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_950;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_951;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_952;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_953;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_954;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_955;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_956;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_957;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_958;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_959;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_960;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_961;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_962;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_963;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_964;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_965;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_966;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_967;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_968;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_969;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_970;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_971;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_v_972;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_v_973;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_974;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_v_975;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_v_976;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_977;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_v_978;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_979;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_980;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_v_981;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_982;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_983;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_984;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_985;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_986;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_987;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_988;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_989;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_v_990;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_v_991;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_992;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_v_993;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_v_994;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_995;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_v_996;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_997;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_998;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_v_999;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_900> AgradCcdfLogExpModNormal_v_900;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_901> AgradCcdfLogExpModNormal_v_901;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_902> AgradCcdfLogExpModNormal_v_902;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_903> AgradCcdfLogExpModNormal_v_903;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_904> AgradCcdfLogExpModNormal_v_904;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_905> AgradCcdfLogExpModNormal_v_905;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_906> AgradCcdfLogExpModNormal_v_906;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_907> AgradCcdfLogExpModNormal_v_907;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_908> AgradCcdfLogExpModNormal_v_908;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_909> AgradCcdfLogExpModNormal_v_909;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_910> AgradCcdfLogExpModNormal_v_910;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_911> AgradCcdfLogExpModNormal_v_911;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_912> AgradCcdfLogExpModNormal_v_912;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_913> AgradCcdfLogExpModNormal_v_913;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_914> AgradCcdfLogExpModNormal_v_914;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_915> AgradCcdfLogExpModNormal_v_915;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_916> AgradCcdfLogExpModNormal_v_916;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_917> AgradCcdfLogExpModNormal_v_917;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_918> AgradCcdfLogExpModNormal_v_918;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_919> AgradCcdfLogExpModNormal_v_919;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_920> AgradCcdfLogExpModNormal_v_920;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_921> AgradCcdfLogExpModNormal_v_921;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_922> AgradCcdfLogExpModNormal_v_922;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_923> AgradCcdfLogExpModNormal_v_923;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_924> AgradCcdfLogExpModNormal_v_924;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_925> AgradCcdfLogExpModNormal_v_925;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_926> AgradCcdfLogExpModNormal_v_926;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_927> AgradCcdfLogExpModNormal_v_927;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_928> AgradCcdfLogExpModNormal_v_928;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_929> AgradCcdfLogExpModNormal_v_929;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_930> AgradCcdfLogExpModNormal_v_930;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_931> AgradCcdfLogExpModNormal_v_931;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_932> AgradCcdfLogExpModNormal_v_932;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_933> AgradCcdfLogExpModNormal_v_933;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_934> AgradCcdfLogExpModNormal_v_934;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_935> AgradCcdfLogExpModNormal_v_935;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_936> AgradCcdfLogExpModNormal_v_936;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_937> AgradCcdfLogExpModNormal_v_937;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_938> AgradCcdfLogExpModNormal_v_938;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_939> AgradCcdfLogExpModNormal_v_939;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_940> AgradCcdfLogExpModNormal_v_940;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_941> AgradCcdfLogExpModNormal_v_941;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_942> AgradCcdfLogExpModNormal_v_942;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_943> AgradCcdfLogExpModNormal_v_943;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_944> AgradCcdfLogExpModNormal_v_944;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_945> AgradCcdfLogExpModNormal_v_945;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_946> AgradCcdfLogExpModNormal_v_946;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_947> AgradCcdfLogExpModNormal_v_947;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_948> AgradCcdfLogExpModNormal_v_948;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_949> AgradCcdfLogExpModNormal_v_949;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_950> AgradCcdfLogExpModNormal_v_950;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_951> AgradCcdfLogExpModNormal_v_951;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_952> AgradCcdfLogExpModNormal_v_952;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_953> AgradCcdfLogExpModNormal_v_953;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_954> AgradCcdfLogExpModNormal_v_954;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_955> AgradCcdfLogExpModNormal_v_955;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_956> AgradCcdfLogExpModNormal_v_956;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_957> AgradCcdfLogExpModNormal_v_957;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_958> AgradCcdfLogExpModNormal_v_958;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_959> AgradCcdfLogExpModNormal_v_959;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_960> AgradCcdfLogExpModNormal_v_960;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_961> AgradCcdfLogExpModNormal_v_961;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_962> AgradCcdfLogExpModNormal_v_962;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_963> AgradCcdfLogExpModNormal_v_963;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_964> AgradCcdfLogExpModNormal_v_964;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_965> AgradCcdfLogExpModNormal_v_965;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_966> AgradCcdfLogExpModNormal_v_966;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_967> AgradCcdfLogExpModNormal_v_967;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_968> AgradCcdfLogExpModNormal_v_968;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_969> AgradCcdfLogExpModNormal_v_969;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_970> AgradCcdfLogExpModNormal_v_970;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_971> AgradCcdfLogExpModNormal_v_971;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_972> AgradCcdfLogExpModNormal_v_972;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_973> AgradCcdfLogExpModNormal_v_973;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_974> AgradCcdfLogExpModNormal_v_974;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_975> AgradCcdfLogExpModNormal_v_975;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_976> AgradCcdfLogExpModNormal_v_976;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_977> AgradCcdfLogExpModNormal_v_977;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_978> AgradCcdfLogExpModNormal_v_978;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_979> AgradCcdfLogExpModNormal_v_979;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_980> AgradCcdfLogExpModNormal_v_980;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_981> AgradCcdfLogExpModNormal_v_981;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_982> AgradCcdfLogExpModNormal_v_982;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_983> AgradCcdfLogExpModNormal_v_983;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_984> AgradCcdfLogExpModNormal_v_984;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_985> AgradCcdfLogExpModNormal_v_985;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_986> AgradCcdfLogExpModNormal_v_986;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_987> AgradCcdfLogExpModNormal_v_987;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_988> AgradCcdfLogExpModNormal_v_988;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_989> AgradCcdfLogExpModNormal_v_989;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_990> AgradCcdfLogExpModNormal_v_990;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_991> AgradCcdfLogExpModNormal_v_991;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_992> AgradCcdfLogExpModNormal_v_992;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_993> AgradCcdfLogExpModNormal_v_993;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_994> AgradCcdfLogExpModNormal_v_994;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_995> AgradCcdfLogExpModNormal_v_995;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_996> AgradCcdfLogExpModNormal_v_996;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_997> AgradCcdfLogExpModNormal_v_997;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_998> AgradCcdfLogExpModNormal_v_998;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_999> AgradCcdfLogExpModNormal_v_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_900, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_901, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_902, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_903, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_904, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_905, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_906, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_907, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_908, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_909, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_910, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_911, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_912, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_913, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_914, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_915, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_916, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_917, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_918, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_919, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_920, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_921, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_922, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_923, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_924, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_925, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_926, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_927, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_928, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_929, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_930, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_931, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_932, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_933, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_934, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_935, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_936, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_937, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_938, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_939, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_940, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_941, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_942, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_943, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_944, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_945, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_946, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_947, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_948, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_949, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_950, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_951, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_952, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_953, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_954, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_955, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_956, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_957, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_958, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_959, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_960, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_961, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_962, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_963, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_964, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_965, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_966, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_967, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_968, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_969, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_970, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_971, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_972, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_973, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_974, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_975, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_976, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_977, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_978, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_979, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_980, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_981, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_982, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_983, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_984, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_985, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_986, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_987, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_988, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_989, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_990, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_991, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_992, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_993, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_994, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_995, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_996, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_997, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_998, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_999, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_vv_900;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_901;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_902;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_903;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_904;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_905;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_906;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_907;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_908;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_vv_909;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_vv_910;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_911;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_vv_912;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_vv_913;
+typedef std::tuple<std::vector<var>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_914;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_vv_915;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_916;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_917;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_vv_918;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_919;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_920;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_921;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_922;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_923;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_924;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_925;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_926;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_vv_927;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_928;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_929;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_vv_930;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_931;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_932;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_933;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_934;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_935;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_936;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_937;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_938;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_939;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_940;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_941;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_942;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_943;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_944;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_vv_945;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_946;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_947;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_vv_948;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_949;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_950;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_951;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_952;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_953;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_954;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_955;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_956;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_957;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_958;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_959;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_960;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_961;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_962;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_963;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_964;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_965;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_966;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_967;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_968;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_969;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_970;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_971;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_972;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_973;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_974;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_975;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_976;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_977;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_978;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_979;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_980;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_981;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_982;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_983;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_984;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_985;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_986;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_987;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_988;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_989;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_990;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_991;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_992;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_993;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_994;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_995;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_996;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_997;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_998;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, double, empty, empty> type_vv_999;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_900> AgradCcdfLogExpModNormal_vv_900;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_901> AgradCcdfLogExpModNormal_vv_901;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_902> AgradCcdfLogExpModNormal_vv_902;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_903> AgradCcdfLogExpModNormal_vv_903;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_904> AgradCcdfLogExpModNormal_vv_904;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_905> AgradCcdfLogExpModNormal_vv_905;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_906> AgradCcdfLogExpModNormal_vv_906;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_907> AgradCcdfLogExpModNormal_vv_907;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_908> AgradCcdfLogExpModNormal_vv_908;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_909> AgradCcdfLogExpModNormal_vv_909;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_910> AgradCcdfLogExpModNormal_vv_910;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_911> AgradCcdfLogExpModNormal_vv_911;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_912> AgradCcdfLogExpModNormal_vv_912;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_913> AgradCcdfLogExpModNormal_vv_913;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_914> AgradCcdfLogExpModNormal_vv_914;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_915> AgradCcdfLogExpModNormal_vv_915;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_916> AgradCcdfLogExpModNormal_vv_916;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_917> AgradCcdfLogExpModNormal_vv_917;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_918> AgradCcdfLogExpModNormal_vv_918;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_919> AgradCcdfLogExpModNormal_vv_919;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_920> AgradCcdfLogExpModNormal_vv_920;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_921> AgradCcdfLogExpModNormal_vv_921;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_922> AgradCcdfLogExpModNormal_vv_922;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_923> AgradCcdfLogExpModNormal_vv_923;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_924> AgradCcdfLogExpModNormal_vv_924;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_925> AgradCcdfLogExpModNormal_vv_925;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_926> AgradCcdfLogExpModNormal_vv_926;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_927> AgradCcdfLogExpModNormal_vv_927;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_928> AgradCcdfLogExpModNormal_vv_928;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_929> AgradCcdfLogExpModNormal_vv_929;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_930> AgradCcdfLogExpModNormal_vv_930;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_931> AgradCcdfLogExpModNormal_vv_931;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_932> AgradCcdfLogExpModNormal_vv_932;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_933> AgradCcdfLogExpModNormal_vv_933;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_934> AgradCcdfLogExpModNormal_vv_934;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_935> AgradCcdfLogExpModNormal_vv_935;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_936> AgradCcdfLogExpModNormal_vv_936;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_937> AgradCcdfLogExpModNormal_vv_937;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_938> AgradCcdfLogExpModNormal_vv_938;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_939> AgradCcdfLogExpModNormal_vv_939;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_940> AgradCcdfLogExpModNormal_vv_940;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_941> AgradCcdfLogExpModNormal_vv_941;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_942> AgradCcdfLogExpModNormal_vv_942;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_943> AgradCcdfLogExpModNormal_vv_943;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_944> AgradCcdfLogExpModNormal_vv_944;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_945> AgradCcdfLogExpModNormal_vv_945;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_946> AgradCcdfLogExpModNormal_vv_946;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_947> AgradCcdfLogExpModNormal_vv_947;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_948> AgradCcdfLogExpModNormal_vv_948;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_949> AgradCcdfLogExpModNormal_vv_949;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_950> AgradCcdfLogExpModNormal_vv_950;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_951> AgradCcdfLogExpModNormal_vv_951;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_952> AgradCcdfLogExpModNormal_vv_952;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_953> AgradCcdfLogExpModNormal_vv_953;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_954> AgradCcdfLogExpModNormal_vv_954;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_955> AgradCcdfLogExpModNormal_vv_955;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_956> AgradCcdfLogExpModNormal_vv_956;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_957> AgradCcdfLogExpModNormal_vv_957;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_958> AgradCcdfLogExpModNormal_vv_958;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_959> AgradCcdfLogExpModNormal_vv_959;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_960> AgradCcdfLogExpModNormal_vv_960;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_961> AgradCcdfLogExpModNormal_vv_961;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_962> AgradCcdfLogExpModNormal_vv_962;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_963> AgradCcdfLogExpModNormal_vv_963;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_964> AgradCcdfLogExpModNormal_vv_964;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_965> AgradCcdfLogExpModNormal_vv_965;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_966> AgradCcdfLogExpModNormal_vv_966;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_967> AgradCcdfLogExpModNormal_vv_967;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_968> AgradCcdfLogExpModNormal_vv_968;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_969> AgradCcdfLogExpModNormal_vv_969;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_970> AgradCcdfLogExpModNormal_vv_970;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_971> AgradCcdfLogExpModNormal_vv_971;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_972> AgradCcdfLogExpModNormal_vv_972;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_973> AgradCcdfLogExpModNormal_vv_973;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_974> AgradCcdfLogExpModNormal_vv_974;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_975> AgradCcdfLogExpModNormal_vv_975;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_976> AgradCcdfLogExpModNormal_vv_976;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_977> AgradCcdfLogExpModNormal_vv_977;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_978> AgradCcdfLogExpModNormal_vv_978;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_979> AgradCcdfLogExpModNormal_vv_979;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_980> AgradCcdfLogExpModNormal_vv_980;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_981> AgradCcdfLogExpModNormal_vv_981;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_982> AgradCcdfLogExpModNormal_vv_982;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_983> AgradCcdfLogExpModNormal_vv_983;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_984> AgradCcdfLogExpModNormal_vv_984;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_985> AgradCcdfLogExpModNormal_vv_985;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_986> AgradCcdfLogExpModNormal_vv_986;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_987> AgradCcdfLogExpModNormal_vv_987;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_988> AgradCcdfLogExpModNormal_vv_988;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_989> AgradCcdfLogExpModNormal_vv_989;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_990> AgradCcdfLogExpModNormal_vv_990;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_991> AgradCcdfLogExpModNormal_vv_991;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_992> AgradCcdfLogExpModNormal_vv_992;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_993> AgradCcdfLogExpModNormal_vv_993;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_994> AgradCcdfLogExpModNormal_vv_994;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_995> AgradCcdfLogExpModNormal_vv_995;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_996> AgradCcdfLogExpModNormal_vv_996;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_997> AgradCcdfLogExpModNormal_vv_997;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_998> AgradCcdfLogExpModNormal_vv_998;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_vv_999> AgradCcdfLogExpModNormal_vv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_900, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_901, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_902, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_903, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_904, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_905, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_906, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_907, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_908, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_909, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_910, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_911, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_912, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_913, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_914, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_915, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_916, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_917, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_918, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_919, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_920, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_921, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_922, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_923, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_924, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_925, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_926, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_927, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_928, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_929, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_930, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_931, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_932, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_933, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_934, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_935, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_936, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_937, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_938, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_939, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_940, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_941, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_942, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_943, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_944, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_945, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_946, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_947, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_948, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_949, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_950, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_951, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_952, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_953, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_954, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_955, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_956, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_957, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_958, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_959, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_960, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_961, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_962, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_963, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_964, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_965, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_966, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_967, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_968, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_969, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_970, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_971, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_972, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_973, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_974, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_975, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_976, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_977, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_978, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_979, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_980, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_981, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_982, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_983, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_984, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_985, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_986, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_987, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_988, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_989, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_990, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_991, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_992, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_993, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_994, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_995, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_996, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_997, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_998, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_vv_999, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_vv_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_ffv_1000;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1001;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_1002;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1003;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1004;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_ffv_1005;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1006;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1007;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1008;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1009;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1010;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1011;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1012;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1013;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1014;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1015;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1016;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_1017;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1018;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1019;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1020;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1021;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1022;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1023;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1024;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1025;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1026;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1027;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1028;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1029;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1030;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1031;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1032;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1033;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1034;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_ffv_1035;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_1036;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1037;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_1038;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1039;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1040;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_1041;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1042;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1043;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1044;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1045;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1046;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1047;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1048;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1049;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1050;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1051;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1052;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_1053;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1054;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1055;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1056;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1057;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1058;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1059;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1060;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1061;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1062;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1063;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1064;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1065;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1066;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1067;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1068;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1069;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1070;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_1071;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_1072;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1073;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_1074;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1075;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1076;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_1077;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1078;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1079;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1080;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1081;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1082;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1083;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1084;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1085;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1086;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1087;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1088;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_1089;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1090;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1091;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1092;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1093;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1094;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1095;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1096;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1097;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1098;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1099;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1000> AgradCcdfLogExpModNormal_ffv_1000;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1001> AgradCcdfLogExpModNormal_ffv_1001;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1002> AgradCcdfLogExpModNormal_ffv_1002;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1003> AgradCcdfLogExpModNormal_ffv_1003;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1004> AgradCcdfLogExpModNormal_ffv_1004;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1005> AgradCcdfLogExpModNormal_ffv_1005;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1006> AgradCcdfLogExpModNormal_ffv_1006;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1007> AgradCcdfLogExpModNormal_ffv_1007;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1008> AgradCcdfLogExpModNormal_ffv_1008;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1009> AgradCcdfLogExpModNormal_ffv_1009;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1010> AgradCcdfLogExpModNormal_ffv_1010;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1011> AgradCcdfLogExpModNormal_ffv_1011;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1012> AgradCcdfLogExpModNormal_ffv_1012;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1013> AgradCcdfLogExpModNormal_ffv_1013;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1014> AgradCcdfLogExpModNormal_ffv_1014;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1015> AgradCcdfLogExpModNormal_ffv_1015;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1016> AgradCcdfLogExpModNormal_ffv_1016;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1017> AgradCcdfLogExpModNormal_ffv_1017;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1018> AgradCcdfLogExpModNormal_ffv_1018;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1019> AgradCcdfLogExpModNormal_ffv_1019;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1020> AgradCcdfLogExpModNormal_ffv_1020;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1021> AgradCcdfLogExpModNormal_ffv_1021;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1022> AgradCcdfLogExpModNormal_ffv_1022;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1023> AgradCcdfLogExpModNormal_ffv_1023;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1024> AgradCcdfLogExpModNormal_ffv_1024;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1025> AgradCcdfLogExpModNormal_ffv_1025;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1026> AgradCcdfLogExpModNormal_ffv_1026;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1027> AgradCcdfLogExpModNormal_ffv_1027;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1028> AgradCcdfLogExpModNormal_ffv_1028;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1029> AgradCcdfLogExpModNormal_ffv_1029;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1030> AgradCcdfLogExpModNormal_ffv_1030;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1031> AgradCcdfLogExpModNormal_ffv_1031;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1032> AgradCcdfLogExpModNormal_ffv_1032;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1033> AgradCcdfLogExpModNormal_ffv_1033;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1034> AgradCcdfLogExpModNormal_ffv_1034;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1035> AgradCcdfLogExpModNormal_ffv_1035;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1036> AgradCcdfLogExpModNormal_ffv_1036;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1037> AgradCcdfLogExpModNormal_ffv_1037;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1038> AgradCcdfLogExpModNormal_ffv_1038;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1039> AgradCcdfLogExpModNormal_ffv_1039;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1040> AgradCcdfLogExpModNormal_ffv_1040;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1041> AgradCcdfLogExpModNormal_ffv_1041;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1042> AgradCcdfLogExpModNormal_ffv_1042;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1043> AgradCcdfLogExpModNormal_ffv_1043;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1044> AgradCcdfLogExpModNormal_ffv_1044;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1045> AgradCcdfLogExpModNormal_ffv_1045;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1046> AgradCcdfLogExpModNormal_ffv_1046;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1047> AgradCcdfLogExpModNormal_ffv_1047;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1048> AgradCcdfLogExpModNormal_ffv_1048;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1049> AgradCcdfLogExpModNormal_ffv_1049;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1050> AgradCcdfLogExpModNormal_ffv_1050;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1051> AgradCcdfLogExpModNormal_ffv_1051;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1052> AgradCcdfLogExpModNormal_ffv_1052;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1053> AgradCcdfLogExpModNormal_ffv_1053;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1054> AgradCcdfLogExpModNormal_ffv_1054;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1055> AgradCcdfLogExpModNormal_ffv_1055;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1056> AgradCcdfLogExpModNormal_ffv_1056;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1057> AgradCcdfLogExpModNormal_ffv_1057;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1058> AgradCcdfLogExpModNormal_ffv_1058;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1059> AgradCcdfLogExpModNormal_ffv_1059;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1060> AgradCcdfLogExpModNormal_ffv_1060;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1061> AgradCcdfLogExpModNormal_ffv_1061;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1062> AgradCcdfLogExpModNormal_ffv_1062;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1063> AgradCcdfLogExpModNormal_ffv_1063;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1064> AgradCcdfLogExpModNormal_ffv_1064;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1065> AgradCcdfLogExpModNormal_ffv_1065;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1066> AgradCcdfLogExpModNormal_ffv_1066;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1067> AgradCcdfLogExpModNormal_ffv_1067;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1068> AgradCcdfLogExpModNormal_ffv_1068;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1069> AgradCcdfLogExpModNormal_ffv_1069;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1070> AgradCcdfLogExpModNormal_ffv_1070;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1071> AgradCcdfLogExpModNormal_ffv_1071;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1072> AgradCcdfLogExpModNormal_ffv_1072;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1073> AgradCcdfLogExpModNormal_ffv_1073;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1074> AgradCcdfLogExpModNormal_ffv_1074;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1075> AgradCcdfLogExpModNormal_ffv_1075;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1076> AgradCcdfLogExpModNormal_ffv_1076;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1077> AgradCcdfLogExpModNormal_ffv_1077;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1078> AgradCcdfLogExpModNormal_ffv_1078;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1079> AgradCcdfLogExpModNormal_ffv_1079;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1080> AgradCcdfLogExpModNormal_ffv_1080;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1081> AgradCcdfLogExpModNormal_ffv_1081;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1082> AgradCcdfLogExpModNormal_ffv_1082;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1083> AgradCcdfLogExpModNormal_ffv_1083;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1084> AgradCcdfLogExpModNormal_ffv_1084;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1085> AgradCcdfLogExpModNormal_ffv_1085;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1086> AgradCcdfLogExpModNormal_ffv_1086;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1087> AgradCcdfLogExpModNormal_ffv_1087;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1088> AgradCcdfLogExpModNormal_ffv_1088;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1089> AgradCcdfLogExpModNormal_ffv_1089;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1090> AgradCcdfLogExpModNormal_ffv_1090;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1091> AgradCcdfLogExpModNormal_ffv_1091;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1092> AgradCcdfLogExpModNormal_ffv_1092;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1093> AgradCcdfLogExpModNormal_ffv_1093;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1094> AgradCcdfLogExpModNormal_ffv_1094;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1095> AgradCcdfLogExpModNormal_ffv_1095;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1096> AgradCcdfLogExpModNormal_ffv_1096;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1097> AgradCcdfLogExpModNormal_ffv_1097;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1098> AgradCcdfLogExpModNormal_ffv_1098;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1099> AgradCcdfLogExpModNormal_ffv_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1000, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1001, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1002, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1003, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1004, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1005, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1006, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1007, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1008, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1009, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1010, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1011, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1012, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1013, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1014, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1015, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1016, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1017, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1018, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1019, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1020, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1021, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1022, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1023, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1024, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1025, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1026, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1027, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1028, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1029, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1030, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1031, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1032, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1033, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1034, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1035, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1036, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1037, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1038, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1039, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1040, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1041, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1042, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1043, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1044, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1045, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1046, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1047, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1048, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1049, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1050, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1051, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1052, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1053, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1054, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1055, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1056, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1057, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1058, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1059, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1060, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1061, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1062, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1063, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1064, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1065, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1066, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1067, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1068, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1069, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1070, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1071, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1072, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1073, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1074, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1075, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1076, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1077, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1078, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1079, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1080, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1081, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1082, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1083, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1084, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1085, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1086, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1087, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1088, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1089, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1090, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1091, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1092, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1093, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1094, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1095, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1096, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1097, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1098, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1099, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_1000;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1001;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1002;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1003;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1004;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1005;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1006;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1007;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_v_1008;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_1009;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1010;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_v_1011;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_1012;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1013;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_1014;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_1015;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1016;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_1017;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_1018;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1019;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1020;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1021;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1022;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1023;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1024;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1025;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_v_1026;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_1027;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1028;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_v_1029;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_1030;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1031;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_1032;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_1033;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1034;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_1035;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_1036;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1037;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1038;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1039;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1040;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1041;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1042;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1043;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1044;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1045;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1046;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1047;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1048;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1049;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1050;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1051;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1052;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1053;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1054;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1055;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1056;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1057;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1058;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1059;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1060;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1061;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1062;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1063;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1064;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1065;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1066;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1067;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1068;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1069;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1070;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1071;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1072;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1073;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1074;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1075;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1076;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1077;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1078;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1079;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_1080;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_1081;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1082;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_1083;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_1084;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1085;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_1086;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_1087;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1088;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_1089;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_1090;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1091;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1092;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1093;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1094;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1095;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1096;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1097;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_1098;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_1099;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1000> AgradCcdfLogExpModNormal_v_1000;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1001> AgradCcdfLogExpModNormal_v_1001;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1002> AgradCcdfLogExpModNormal_v_1002;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1003> AgradCcdfLogExpModNormal_v_1003;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1004> AgradCcdfLogExpModNormal_v_1004;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1005> AgradCcdfLogExpModNormal_v_1005;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1006> AgradCcdfLogExpModNormal_v_1006;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1007> AgradCcdfLogExpModNormal_v_1007;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1008> AgradCcdfLogExpModNormal_v_1008;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1009> AgradCcdfLogExpModNormal_v_1009;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1010> AgradCcdfLogExpModNormal_v_1010;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1011> AgradCcdfLogExpModNormal_v_1011;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1012> AgradCcdfLogExpModNormal_v_1012;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1013> AgradCcdfLogExpModNormal_v_1013;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1014> AgradCcdfLogExpModNormal_v_1014;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1015> AgradCcdfLogExpModNormal_v_1015;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1016> AgradCcdfLogExpModNormal_v_1016;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1017> AgradCcdfLogExpModNormal_v_1017;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1018> AgradCcdfLogExpModNormal_v_1018;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1019> AgradCcdfLogExpModNormal_v_1019;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1020> AgradCcdfLogExpModNormal_v_1020;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1021> AgradCcdfLogExpModNormal_v_1021;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1022> AgradCcdfLogExpModNormal_v_1022;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1023> AgradCcdfLogExpModNormal_v_1023;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1024> AgradCcdfLogExpModNormal_v_1024;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1025> AgradCcdfLogExpModNormal_v_1025;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1026> AgradCcdfLogExpModNormal_v_1026;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1027> AgradCcdfLogExpModNormal_v_1027;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1028> AgradCcdfLogExpModNormal_v_1028;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1029> AgradCcdfLogExpModNormal_v_1029;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1030> AgradCcdfLogExpModNormal_v_1030;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1031> AgradCcdfLogExpModNormal_v_1031;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1032> AgradCcdfLogExpModNormal_v_1032;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1033> AgradCcdfLogExpModNormal_v_1033;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1034> AgradCcdfLogExpModNormal_v_1034;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1035> AgradCcdfLogExpModNormal_v_1035;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1036> AgradCcdfLogExpModNormal_v_1036;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1037> AgradCcdfLogExpModNormal_v_1037;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1038> AgradCcdfLogExpModNormal_v_1038;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1039> AgradCcdfLogExpModNormal_v_1039;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1040> AgradCcdfLogExpModNormal_v_1040;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1041> AgradCcdfLogExpModNormal_v_1041;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1042> AgradCcdfLogExpModNormal_v_1042;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1043> AgradCcdfLogExpModNormal_v_1043;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1044> AgradCcdfLogExpModNormal_v_1044;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1045> AgradCcdfLogExpModNormal_v_1045;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1046> AgradCcdfLogExpModNormal_v_1046;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1047> AgradCcdfLogExpModNormal_v_1047;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1048> AgradCcdfLogExpModNormal_v_1048;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1049> AgradCcdfLogExpModNormal_v_1049;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1050> AgradCcdfLogExpModNormal_v_1050;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1051> AgradCcdfLogExpModNormal_v_1051;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1052> AgradCcdfLogExpModNormal_v_1052;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1053> AgradCcdfLogExpModNormal_v_1053;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1054> AgradCcdfLogExpModNormal_v_1054;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1055> AgradCcdfLogExpModNormal_v_1055;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1056> AgradCcdfLogExpModNormal_v_1056;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1057> AgradCcdfLogExpModNormal_v_1057;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1058> AgradCcdfLogExpModNormal_v_1058;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1059> AgradCcdfLogExpModNormal_v_1059;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1060> AgradCcdfLogExpModNormal_v_1060;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1061> AgradCcdfLogExpModNormal_v_1061;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1062> AgradCcdfLogExpModNormal_v_1062;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1063> AgradCcdfLogExpModNormal_v_1063;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1064> AgradCcdfLogExpModNormal_v_1064;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1065> AgradCcdfLogExpModNormal_v_1065;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1066> AgradCcdfLogExpModNormal_v_1066;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1067> AgradCcdfLogExpModNormal_v_1067;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1068> AgradCcdfLogExpModNormal_v_1068;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1069> AgradCcdfLogExpModNormal_v_1069;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1070> AgradCcdfLogExpModNormal_v_1070;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1071> AgradCcdfLogExpModNormal_v_1071;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1072> AgradCcdfLogExpModNormal_v_1072;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1073> AgradCcdfLogExpModNormal_v_1073;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1074> AgradCcdfLogExpModNormal_v_1074;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1075> AgradCcdfLogExpModNormal_v_1075;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1076> AgradCcdfLogExpModNormal_v_1076;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1077> AgradCcdfLogExpModNormal_v_1077;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1078> AgradCcdfLogExpModNormal_v_1078;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1079> AgradCcdfLogExpModNormal_v_1079;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1080> AgradCcdfLogExpModNormal_v_1080;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1081> AgradCcdfLogExpModNormal_v_1081;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1082> AgradCcdfLogExpModNormal_v_1082;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1083> AgradCcdfLogExpModNormal_v_1083;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1084> AgradCcdfLogExpModNormal_v_1084;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1085> AgradCcdfLogExpModNormal_v_1085;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1086> AgradCcdfLogExpModNormal_v_1086;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1087> AgradCcdfLogExpModNormal_v_1087;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1088> AgradCcdfLogExpModNormal_v_1088;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1089> AgradCcdfLogExpModNormal_v_1089;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1090> AgradCcdfLogExpModNormal_v_1090;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1091> AgradCcdfLogExpModNormal_v_1091;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1092> AgradCcdfLogExpModNormal_v_1092;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1093> AgradCcdfLogExpModNormal_v_1093;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1094> AgradCcdfLogExpModNormal_v_1094;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1095> AgradCcdfLogExpModNormal_v_1095;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1096> AgradCcdfLogExpModNormal_v_1096;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1097> AgradCcdfLogExpModNormal_v_1097;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1098> AgradCcdfLogExpModNormal_v_1098;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1099> AgradCcdfLogExpModNormal_v_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1000, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1001, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1002, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1003, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1004, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1005, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1006, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1007, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1008, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1009, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1010, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1011, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1012, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1013, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1014, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1015, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1016, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1017, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1018, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1019, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1020, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1021, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1022, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1023, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1024, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1025, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1026, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1027, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1028, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1029, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1030, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1031, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1032, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1033, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1034, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1035, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1036, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1037, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1038, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1039, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1040, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1041, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1042, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1043, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1044, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1045, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1046, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1047, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1048, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1049, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1050, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1051, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1052, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1053, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1054, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1055, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1056, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1057, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1058, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1059, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1060, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1061, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1062, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1063, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1064, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1065, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1066, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1067, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1068, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1069, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1070, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1071, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1072, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1073, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1074, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1075, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1076, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1077, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1078, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1079, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1080, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1081, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1082, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1083, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1084, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1085, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1086, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1087, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1088, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1089, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1090, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1091, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1092, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1093, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1094, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1095, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1096, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1097, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1098, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1099, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1100;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1101;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1102;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1103;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1104;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1105;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1106;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_1107;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_1108;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1109;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_1110;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1111;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1112;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_1113;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1114;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1115;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1116;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1117;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1118;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1119;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1120;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1121;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1122;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1123;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1124;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_1125;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1126;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1127;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1128;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1129;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1130;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1131;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1132;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1133;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1134;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1135;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1136;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1137;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1138;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1139;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1140;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1141;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1142;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_1143;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_1144;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1145;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_1146;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1147;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1148;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_1149;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1150;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1151;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_1161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_1179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_1180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_1182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_1185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1188;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1189;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1190;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1191;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1192;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1193;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1194;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1195;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1196;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_1197;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1198;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1199;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1100> AgradCcdfLogExpModNormal_ffv_1100;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1101> AgradCcdfLogExpModNormal_ffv_1101;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1102> AgradCcdfLogExpModNormal_ffv_1102;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1103> AgradCcdfLogExpModNormal_ffv_1103;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1104> AgradCcdfLogExpModNormal_ffv_1104;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1105> AgradCcdfLogExpModNormal_ffv_1105;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1106> AgradCcdfLogExpModNormal_ffv_1106;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1107> AgradCcdfLogExpModNormal_ffv_1107;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1108> AgradCcdfLogExpModNormal_ffv_1108;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1109> AgradCcdfLogExpModNormal_ffv_1109;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1110> AgradCcdfLogExpModNormal_ffv_1110;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1111> AgradCcdfLogExpModNormal_ffv_1111;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1112> AgradCcdfLogExpModNormal_ffv_1112;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1113> AgradCcdfLogExpModNormal_ffv_1113;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1114> AgradCcdfLogExpModNormal_ffv_1114;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1115> AgradCcdfLogExpModNormal_ffv_1115;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1116> AgradCcdfLogExpModNormal_ffv_1116;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1117> AgradCcdfLogExpModNormal_ffv_1117;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1118> AgradCcdfLogExpModNormal_ffv_1118;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1119> AgradCcdfLogExpModNormal_ffv_1119;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1120> AgradCcdfLogExpModNormal_ffv_1120;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1121> AgradCcdfLogExpModNormal_ffv_1121;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1122> AgradCcdfLogExpModNormal_ffv_1122;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1123> AgradCcdfLogExpModNormal_ffv_1123;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1124> AgradCcdfLogExpModNormal_ffv_1124;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1125> AgradCcdfLogExpModNormal_ffv_1125;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1126> AgradCcdfLogExpModNormal_ffv_1126;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1127> AgradCcdfLogExpModNormal_ffv_1127;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1128> AgradCcdfLogExpModNormal_ffv_1128;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1129> AgradCcdfLogExpModNormal_ffv_1129;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1130> AgradCcdfLogExpModNormal_ffv_1130;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1131> AgradCcdfLogExpModNormal_ffv_1131;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1132> AgradCcdfLogExpModNormal_ffv_1132;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1133> AgradCcdfLogExpModNormal_ffv_1133;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1134> AgradCcdfLogExpModNormal_ffv_1134;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1135> AgradCcdfLogExpModNormal_ffv_1135;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1136> AgradCcdfLogExpModNormal_ffv_1136;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1137> AgradCcdfLogExpModNormal_ffv_1137;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1138> AgradCcdfLogExpModNormal_ffv_1138;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1139> AgradCcdfLogExpModNormal_ffv_1139;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1140> AgradCcdfLogExpModNormal_ffv_1140;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1141> AgradCcdfLogExpModNormal_ffv_1141;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1142> AgradCcdfLogExpModNormal_ffv_1142;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1143> AgradCcdfLogExpModNormal_ffv_1143;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1144> AgradCcdfLogExpModNormal_ffv_1144;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1145> AgradCcdfLogExpModNormal_ffv_1145;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1146> AgradCcdfLogExpModNormal_ffv_1146;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1147> AgradCcdfLogExpModNormal_ffv_1147;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1148> AgradCcdfLogExpModNormal_ffv_1148;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1149> AgradCcdfLogExpModNormal_ffv_1149;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1150> AgradCcdfLogExpModNormal_ffv_1150;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1151> AgradCcdfLogExpModNormal_ffv_1151;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1152> AgradCcdfLogExpModNormal_ffv_1152;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1153> AgradCcdfLogExpModNormal_ffv_1153;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1154> AgradCcdfLogExpModNormal_ffv_1154;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1155> AgradCcdfLogExpModNormal_ffv_1155;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1156> AgradCcdfLogExpModNormal_ffv_1156;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1157> AgradCcdfLogExpModNormal_ffv_1157;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1158> AgradCcdfLogExpModNormal_ffv_1158;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1159> AgradCcdfLogExpModNormal_ffv_1159;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1160> AgradCcdfLogExpModNormal_ffv_1160;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1161> AgradCcdfLogExpModNormal_ffv_1161;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1162> AgradCcdfLogExpModNormal_ffv_1162;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1163> AgradCcdfLogExpModNormal_ffv_1163;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1164> AgradCcdfLogExpModNormal_ffv_1164;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1165> AgradCcdfLogExpModNormal_ffv_1165;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1166> AgradCcdfLogExpModNormal_ffv_1166;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1167> AgradCcdfLogExpModNormal_ffv_1167;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1168> AgradCcdfLogExpModNormal_ffv_1168;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1169> AgradCcdfLogExpModNormal_ffv_1169;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1170> AgradCcdfLogExpModNormal_ffv_1170;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1171> AgradCcdfLogExpModNormal_ffv_1171;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1172> AgradCcdfLogExpModNormal_ffv_1172;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1173> AgradCcdfLogExpModNormal_ffv_1173;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1174> AgradCcdfLogExpModNormal_ffv_1174;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1175> AgradCcdfLogExpModNormal_ffv_1175;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1176> AgradCcdfLogExpModNormal_ffv_1176;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1177> AgradCcdfLogExpModNormal_ffv_1177;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1178> AgradCcdfLogExpModNormal_ffv_1178;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1179> AgradCcdfLogExpModNormal_ffv_1179;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1180> AgradCcdfLogExpModNormal_ffv_1180;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1181> AgradCcdfLogExpModNormal_ffv_1181;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1182> AgradCcdfLogExpModNormal_ffv_1182;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1183> AgradCcdfLogExpModNormal_ffv_1183;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1184> AgradCcdfLogExpModNormal_ffv_1184;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1185> AgradCcdfLogExpModNormal_ffv_1185;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1186> AgradCcdfLogExpModNormal_ffv_1186;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1187> AgradCcdfLogExpModNormal_ffv_1187;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1188> AgradCcdfLogExpModNormal_ffv_1188;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1189> AgradCcdfLogExpModNormal_ffv_1189;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1190> AgradCcdfLogExpModNormal_ffv_1190;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1191> AgradCcdfLogExpModNormal_ffv_1191;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1192> AgradCcdfLogExpModNormal_ffv_1192;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1193> AgradCcdfLogExpModNormal_ffv_1193;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1194> AgradCcdfLogExpModNormal_ffv_1194;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1195> AgradCcdfLogExpModNormal_ffv_1195;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1196> AgradCcdfLogExpModNormal_ffv_1196;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1197> AgradCcdfLogExpModNormal_ffv_1197;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1198> AgradCcdfLogExpModNormal_ffv_1198;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1199> AgradCcdfLogExpModNormal_ffv_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1100, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1101, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1102, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1103, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1104, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1105, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1106, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1107, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1108, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1109, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1110, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1111, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1112, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1113, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1114, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1115, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1116, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1117, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1118, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1119, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1120, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1121, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1122, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1123, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1124, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1125, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1126, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1127, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1128, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1129, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1130, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1131, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1132, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1133, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1134, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1135, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1136, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1137, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1138, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1139, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1140, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1141, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1142, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1143, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1144, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1145, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1146, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1147, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1148, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1149, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1150, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1151, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1152, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1153, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1154, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1155, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1156, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1157, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1158, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1159, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1160, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1161, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1162, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1163, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1164, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1165, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1166, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1167, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1168, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1169, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1170, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1171, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1172, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1173, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1174, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1175, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1176, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1177, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1178, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1179, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1180, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1181, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1182, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1183, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1184, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1185, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1186, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1187, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1188, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1189, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1190, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1191, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1192, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1193, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1194, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1195, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1196, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1197, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1198, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1199, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1199);
+
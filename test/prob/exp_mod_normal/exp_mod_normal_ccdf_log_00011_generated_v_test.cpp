@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1100;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_1101;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_1102;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1103;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_1104;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_1105;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1106;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_1107;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_1108;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1109;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1110;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1111;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1112;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1113;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1114;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1115;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_1116;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_1117;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1118;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_1119;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_1120;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1121;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_1122;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_1123;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1124;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_1125;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_1126;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1127;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1128;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1129;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1130;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1131;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1132;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1133;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_1134;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_1135;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1136;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_1137;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_1138;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1139;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_1140;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_1141;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1142;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_1143;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_1144;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1145;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1146;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1147;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1148;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1149;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1150;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1151;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1152;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1153;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1154;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1155;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1156;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1157;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1158;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1159;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1160;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1161;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1162;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1163;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1164;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1165;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1166;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1167;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1168;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1169;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1170;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1171;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1172;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1173;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1174;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1175;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1176;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1177;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1178;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_1188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_1189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_1191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_1192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_1194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_1195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_1197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_1198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1199;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1100> AgradCcdfLogExpModNormal_v_1100;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1101> AgradCcdfLogExpModNormal_v_1101;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1102> AgradCcdfLogExpModNormal_v_1102;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1103> AgradCcdfLogExpModNormal_v_1103;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1104> AgradCcdfLogExpModNormal_v_1104;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1105> AgradCcdfLogExpModNormal_v_1105;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1106> AgradCcdfLogExpModNormal_v_1106;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1107> AgradCcdfLogExpModNormal_v_1107;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1108> AgradCcdfLogExpModNormal_v_1108;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1109> AgradCcdfLogExpModNormal_v_1109;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1110> AgradCcdfLogExpModNormal_v_1110;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1111> AgradCcdfLogExpModNormal_v_1111;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1112> AgradCcdfLogExpModNormal_v_1112;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1113> AgradCcdfLogExpModNormal_v_1113;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1114> AgradCcdfLogExpModNormal_v_1114;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1115> AgradCcdfLogExpModNormal_v_1115;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1116> AgradCcdfLogExpModNormal_v_1116;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1117> AgradCcdfLogExpModNormal_v_1117;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1118> AgradCcdfLogExpModNormal_v_1118;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1119> AgradCcdfLogExpModNormal_v_1119;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1120> AgradCcdfLogExpModNormal_v_1120;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1121> AgradCcdfLogExpModNormal_v_1121;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1122> AgradCcdfLogExpModNormal_v_1122;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1123> AgradCcdfLogExpModNormal_v_1123;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1124> AgradCcdfLogExpModNormal_v_1124;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1125> AgradCcdfLogExpModNormal_v_1125;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1126> AgradCcdfLogExpModNormal_v_1126;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1127> AgradCcdfLogExpModNormal_v_1127;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1128> AgradCcdfLogExpModNormal_v_1128;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1129> AgradCcdfLogExpModNormal_v_1129;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1130> AgradCcdfLogExpModNormal_v_1130;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1131> AgradCcdfLogExpModNormal_v_1131;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1132> AgradCcdfLogExpModNormal_v_1132;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1133> AgradCcdfLogExpModNormal_v_1133;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1134> AgradCcdfLogExpModNormal_v_1134;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1135> AgradCcdfLogExpModNormal_v_1135;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1136> AgradCcdfLogExpModNormal_v_1136;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1137> AgradCcdfLogExpModNormal_v_1137;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1138> AgradCcdfLogExpModNormal_v_1138;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1139> AgradCcdfLogExpModNormal_v_1139;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1140> AgradCcdfLogExpModNormal_v_1140;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1141> AgradCcdfLogExpModNormal_v_1141;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1142> AgradCcdfLogExpModNormal_v_1142;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1143> AgradCcdfLogExpModNormal_v_1143;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1144> AgradCcdfLogExpModNormal_v_1144;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1145> AgradCcdfLogExpModNormal_v_1145;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1146> AgradCcdfLogExpModNormal_v_1146;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1147> AgradCcdfLogExpModNormal_v_1147;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1148> AgradCcdfLogExpModNormal_v_1148;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1149> AgradCcdfLogExpModNormal_v_1149;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1150> AgradCcdfLogExpModNormal_v_1150;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1151> AgradCcdfLogExpModNormal_v_1151;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1152> AgradCcdfLogExpModNormal_v_1152;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1153> AgradCcdfLogExpModNormal_v_1153;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1154> AgradCcdfLogExpModNormal_v_1154;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1155> AgradCcdfLogExpModNormal_v_1155;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1156> AgradCcdfLogExpModNormal_v_1156;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1157> AgradCcdfLogExpModNormal_v_1157;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1158> AgradCcdfLogExpModNormal_v_1158;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1159> AgradCcdfLogExpModNormal_v_1159;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1160> AgradCcdfLogExpModNormal_v_1160;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1161> AgradCcdfLogExpModNormal_v_1161;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1162> AgradCcdfLogExpModNormal_v_1162;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1163> AgradCcdfLogExpModNormal_v_1163;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1164> AgradCcdfLogExpModNormal_v_1164;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1165> AgradCcdfLogExpModNormal_v_1165;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1166> AgradCcdfLogExpModNormal_v_1166;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1167> AgradCcdfLogExpModNormal_v_1167;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1168> AgradCcdfLogExpModNormal_v_1168;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1169> AgradCcdfLogExpModNormal_v_1169;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1170> AgradCcdfLogExpModNormal_v_1170;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1171> AgradCcdfLogExpModNormal_v_1171;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1172> AgradCcdfLogExpModNormal_v_1172;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1173> AgradCcdfLogExpModNormal_v_1173;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1174> AgradCcdfLogExpModNormal_v_1174;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1175> AgradCcdfLogExpModNormal_v_1175;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1176> AgradCcdfLogExpModNormal_v_1176;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1177> AgradCcdfLogExpModNormal_v_1177;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1178> AgradCcdfLogExpModNormal_v_1178;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1179> AgradCcdfLogExpModNormal_v_1179;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1180> AgradCcdfLogExpModNormal_v_1180;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1181> AgradCcdfLogExpModNormal_v_1181;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1182> AgradCcdfLogExpModNormal_v_1182;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1183> AgradCcdfLogExpModNormal_v_1183;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1184> AgradCcdfLogExpModNormal_v_1184;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1185> AgradCcdfLogExpModNormal_v_1185;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1186> AgradCcdfLogExpModNormal_v_1186;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1187> AgradCcdfLogExpModNormal_v_1187;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1188> AgradCcdfLogExpModNormal_v_1188;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1189> AgradCcdfLogExpModNormal_v_1189;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1190> AgradCcdfLogExpModNormal_v_1190;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1191> AgradCcdfLogExpModNormal_v_1191;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1192> AgradCcdfLogExpModNormal_v_1192;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1193> AgradCcdfLogExpModNormal_v_1193;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1194> AgradCcdfLogExpModNormal_v_1194;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1195> AgradCcdfLogExpModNormal_v_1195;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1196> AgradCcdfLogExpModNormal_v_1196;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1197> AgradCcdfLogExpModNormal_v_1197;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1198> AgradCcdfLogExpModNormal_v_1198;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1199> AgradCcdfLogExpModNormal_v_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1100, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1101, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1102, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1103, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1104, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1105, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1106, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1107, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1108, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1109, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1110, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1111, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1112, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1113, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1114, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1115, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1116, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1117, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1118, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1119, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1120, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1121, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1122, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1123, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1124, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1125, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1126, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1127, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1128, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1129, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1130, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1131, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1132, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1133, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1134, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1135, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1136, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1137, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1138, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1139, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1140, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1141, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1142, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1143, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1144, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1145, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1146, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1147, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1148, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1149, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1150, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1151, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1152, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1153, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1154, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1155, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1156, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1157, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1158, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1159, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1160, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1161, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1162, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1163, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1164, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1165, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1166, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1167, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1168, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1169, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1170, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1171, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1172, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1173, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1174, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1175, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1176, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1177, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1178, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1179, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1180, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1181, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1182, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1183, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1184, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1185, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1186, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1187, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1188, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1189, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1190, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1191, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1192, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1193, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1194, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1195, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1196, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1197, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1198, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1199, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1199);
+
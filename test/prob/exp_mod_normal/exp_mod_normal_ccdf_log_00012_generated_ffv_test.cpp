@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1200;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1201;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1202;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1203;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1204;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1205;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1206;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1207;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1208;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1209;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1210;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1211;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1212;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1213;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1214;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1200> AgradCcdfLogExpModNormal_ffv_1200;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1201> AgradCcdfLogExpModNormal_ffv_1201;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1202> AgradCcdfLogExpModNormal_ffv_1202;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1203> AgradCcdfLogExpModNormal_ffv_1203;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1204> AgradCcdfLogExpModNormal_ffv_1204;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1205> AgradCcdfLogExpModNormal_ffv_1205;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1206> AgradCcdfLogExpModNormal_ffv_1206;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1207> AgradCcdfLogExpModNormal_ffv_1207;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1208> AgradCcdfLogExpModNormal_ffv_1208;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1209> AgradCcdfLogExpModNormal_ffv_1209;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1210> AgradCcdfLogExpModNormal_ffv_1210;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1211> AgradCcdfLogExpModNormal_ffv_1211;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1212> AgradCcdfLogExpModNormal_ffv_1212;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1213> AgradCcdfLogExpModNormal_ffv_1213;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_ffv_1214> AgradCcdfLogExpModNormal_ffv_1214;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1200, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1201, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1202, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1203, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1204, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1205, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1206, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1207, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1208, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1209, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1210, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1211, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1212, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1213, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_ffv_1214, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_ffv_1214);
+
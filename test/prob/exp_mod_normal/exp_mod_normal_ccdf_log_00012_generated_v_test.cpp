@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_1206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_1207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_1209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_1210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_1212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_1213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_1215;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_1216;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1217;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1218;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1219;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1220;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1221;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1222;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1223;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_1224;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_1225;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1226;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_1227;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_1228;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1229;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_1230;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_1231;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1232;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_1233;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_1234;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1235;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1236;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1237;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1238;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1239;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1240;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1241;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_1242;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_1243;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1244;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_1245;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_1246;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1247;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_1248;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_1249;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1250;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_1251;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_1252;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1253;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1254;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1255;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1256;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1257;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1258;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1259;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1260;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1261;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1262;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1263;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1264;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1265;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1266;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1267;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1268;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1269;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1270;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1271;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1272;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1273;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1274;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1275;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1276;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1277;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1278;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1279;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1280;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1281;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1282;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1283;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1284;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1285;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1286;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1287;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1288;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1289;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1290;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1291;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1292;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1293;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1294;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1295;
+
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1200> AgradCcdfLogExpModNormal_v_1200;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1201> AgradCcdfLogExpModNormal_v_1201;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1202> AgradCcdfLogExpModNormal_v_1202;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1203> AgradCcdfLogExpModNormal_v_1203;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1204> AgradCcdfLogExpModNormal_v_1204;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1205> AgradCcdfLogExpModNormal_v_1205;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1206> AgradCcdfLogExpModNormal_v_1206;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1207> AgradCcdfLogExpModNormal_v_1207;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1208> AgradCcdfLogExpModNormal_v_1208;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1209> AgradCcdfLogExpModNormal_v_1209;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1210> AgradCcdfLogExpModNormal_v_1210;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1211> AgradCcdfLogExpModNormal_v_1211;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1212> AgradCcdfLogExpModNormal_v_1212;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1213> AgradCcdfLogExpModNormal_v_1213;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1214> AgradCcdfLogExpModNormal_v_1214;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1215> AgradCcdfLogExpModNormal_v_1215;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1216> AgradCcdfLogExpModNormal_v_1216;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1217> AgradCcdfLogExpModNormal_v_1217;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1218> AgradCcdfLogExpModNormal_v_1218;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1219> AgradCcdfLogExpModNormal_v_1219;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1220> AgradCcdfLogExpModNormal_v_1220;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1221> AgradCcdfLogExpModNormal_v_1221;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1222> AgradCcdfLogExpModNormal_v_1222;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1223> AgradCcdfLogExpModNormal_v_1223;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1224> AgradCcdfLogExpModNormal_v_1224;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1225> AgradCcdfLogExpModNormal_v_1225;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1226> AgradCcdfLogExpModNormal_v_1226;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1227> AgradCcdfLogExpModNormal_v_1227;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1228> AgradCcdfLogExpModNormal_v_1228;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1229> AgradCcdfLogExpModNormal_v_1229;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1230> AgradCcdfLogExpModNormal_v_1230;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1231> AgradCcdfLogExpModNormal_v_1231;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1232> AgradCcdfLogExpModNormal_v_1232;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1233> AgradCcdfLogExpModNormal_v_1233;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1234> AgradCcdfLogExpModNormal_v_1234;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1235> AgradCcdfLogExpModNormal_v_1235;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1236> AgradCcdfLogExpModNormal_v_1236;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1237> AgradCcdfLogExpModNormal_v_1237;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1238> AgradCcdfLogExpModNormal_v_1238;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1239> AgradCcdfLogExpModNormal_v_1239;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1240> AgradCcdfLogExpModNormal_v_1240;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1241> AgradCcdfLogExpModNormal_v_1241;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1242> AgradCcdfLogExpModNormal_v_1242;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1243> AgradCcdfLogExpModNormal_v_1243;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1244> AgradCcdfLogExpModNormal_v_1244;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1245> AgradCcdfLogExpModNormal_v_1245;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1246> AgradCcdfLogExpModNormal_v_1246;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1247> AgradCcdfLogExpModNormal_v_1247;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1248> AgradCcdfLogExpModNormal_v_1248;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1249> AgradCcdfLogExpModNormal_v_1249;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1250> AgradCcdfLogExpModNormal_v_1250;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1251> AgradCcdfLogExpModNormal_v_1251;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1252> AgradCcdfLogExpModNormal_v_1252;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1253> AgradCcdfLogExpModNormal_v_1253;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1254> AgradCcdfLogExpModNormal_v_1254;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1255> AgradCcdfLogExpModNormal_v_1255;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1256> AgradCcdfLogExpModNormal_v_1256;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1257> AgradCcdfLogExpModNormal_v_1257;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1258> AgradCcdfLogExpModNormal_v_1258;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1259> AgradCcdfLogExpModNormal_v_1259;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1260> AgradCcdfLogExpModNormal_v_1260;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1261> AgradCcdfLogExpModNormal_v_1261;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1262> AgradCcdfLogExpModNormal_v_1262;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1263> AgradCcdfLogExpModNormal_v_1263;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1264> AgradCcdfLogExpModNormal_v_1264;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1265> AgradCcdfLogExpModNormal_v_1265;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1266> AgradCcdfLogExpModNormal_v_1266;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1267> AgradCcdfLogExpModNormal_v_1267;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1268> AgradCcdfLogExpModNormal_v_1268;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1269> AgradCcdfLogExpModNormal_v_1269;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1270> AgradCcdfLogExpModNormal_v_1270;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1271> AgradCcdfLogExpModNormal_v_1271;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1272> AgradCcdfLogExpModNormal_v_1272;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1273> AgradCcdfLogExpModNormal_v_1273;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1274> AgradCcdfLogExpModNormal_v_1274;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1275> AgradCcdfLogExpModNormal_v_1275;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1276> AgradCcdfLogExpModNormal_v_1276;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1277> AgradCcdfLogExpModNormal_v_1277;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1278> AgradCcdfLogExpModNormal_v_1278;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1279> AgradCcdfLogExpModNormal_v_1279;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1280> AgradCcdfLogExpModNormal_v_1280;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1281> AgradCcdfLogExpModNormal_v_1281;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1282> AgradCcdfLogExpModNormal_v_1282;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1283> AgradCcdfLogExpModNormal_v_1283;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1284> AgradCcdfLogExpModNormal_v_1284;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1285> AgradCcdfLogExpModNormal_v_1285;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1286> AgradCcdfLogExpModNormal_v_1286;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1287> AgradCcdfLogExpModNormal_v_1287;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1288> AgradCcdfLogExpModNormal_v_1288;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1289> AgradCcdfLogExpModNormal_v_1289;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1290> AgradCcdfLogExpModNormal_v_1290;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1291> AgradCcdfLogExpModNormal_v_1291;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1292> AgradCcdfLogExpModNormal_v_1292;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1293> AgradCcdfLogExpModNormal_v_1293;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1294> AgradCcdfLogExpModNormal_v_1294;
+typedef std::tuple<AgradCcdfLogExpModNormal, type_v_1295> AgradCcdfLogExpModNormal_v_1295;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1200, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1201, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1202, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1203, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1204, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1205, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1206, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1207, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1208, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1209, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1210, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1211, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1212, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1213, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1214, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1215, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1216, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1217, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1218, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1219, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1220, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1221, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1222, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1223, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1224, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1225, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1226, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1227, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1228, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1229, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1230, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1231, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1232, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1233, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1234, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1235, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1236, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1237, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1238, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1239, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1240, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1241, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1242, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1243, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1244, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1245, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1246, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1247, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1248, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1249, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1250, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1251, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1252, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1253, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1254, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1255, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1256, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1257, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1258, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1259, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1260, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1261, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1262, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1263, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1264, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1265, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1266, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1267, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1268, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1269, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1270, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1271, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1272, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1273, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1274, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1275, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1276, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1277, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1278, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1279, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1280, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1281, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1282, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1283, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1284, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1285, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1286, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1287, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1288, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1289, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1290, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1291, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1292, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1293, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1294, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExpModNormal_v_1295, AgradCcdfLogTestFixture, AgradCcdfLogExpModNormal_v_1295);
+
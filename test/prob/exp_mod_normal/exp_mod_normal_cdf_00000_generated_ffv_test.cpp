@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<double, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<double, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<double, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<double, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_0> AgradCdfExpModNormal_ffv_0;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1> AgradCdfExpModNormal_ffv_1;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_2> AgradCdfExpModNormal_ffv_2;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_3> AgradCdfExpModNormal_ffv_3;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_4> AgradCdfExpModNormal_ffv_4;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_5> AgradCdfExpModNormal_ffv_5;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_6> AgradCdfExpModNormal_ffv_6;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_7> AgradCdfExpModNormal_ffv_7;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_8> AgradCdfExpModNormal_ffv_8;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_9> AgradCdfExpModNormal_ffv_9;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_10> AgradCdfExpModNormal_ffv_10;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_11> AgradCdfExpModNormal_ffv_11;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_12> AgradCdfExpModNormal_ffv_12;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_13> AgradCdfExpModNormal_ffv_13;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_14> AgradCdfExpModNormal_ffv_14;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_15> AgradCdfExpModNormal_ffv_15;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_16> AgradCdfExpModNormal_ffv_16;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_17> AgradCdfExpModNormal_ffv_17;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_18> AgradCdfExpModNormal_ffv_18;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_19> AgradCdfExpModNormal_ffv_19;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_20> AgradCdfExpModNormal_ffv_20;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_21> AgradCdfExpModNormal_ffv_21;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_22> AgradCdfExpModNormal_ffv_22;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_23> AgradCdfExpModNormal_ffv_23;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_24> AgradCdfExpModNormal_ffv_24;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_25> AgradCdfExpModNormal_ffv_25;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_26> AgradCdfExpModNormal_ffv_26;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_27> AgradCdfExpModNormal_ffv_27;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_28> AgradCdfExpModNormal_ffv_28;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_29> AgradCdfExpModNormal_ffv_29;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_30> AgradCdfExpModNormal_ffv_30;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_31> AgradCdfExpModNormal_ffv_31;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_32> AgradCdfExpModNormal_ffv_32;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_33> AgradCdfExpModNormal_ffv_33;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_34> AgradCdfExpModNormal_ffv_34;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_35> AgradCdfExpModNormal_ffv_35;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_36> AgradCdfExpModNormal_ffv_36;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_37> AgradCdfExpModNormal_ffv_37;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_38> AgradCdfExpModNormal_ffv_38;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_39> AgradCdfExpModNormal_ffv_39;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_40> AgradCdfExpModNormal_ffv_40;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_41> AgradCdfExpModNormal_ffv_41;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_42> AgradCdfExpModNormal_ffv_42;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_43> AgradCdfExpModNormal_ffv_43;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_44> AgradCdfExpModNormal_ffv_44;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_45> AgradCdfExpModNormal_ffv_45;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_46> AgradCdfExpModNormal_ffv_46;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_47> AgradCdfExpModNormal_ffv_47;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_48> AgradCdfExpModNormal_ffv_48;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_49> AgradCdfExpModNormal_ffv_49;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_50> AgradCdfExpModNormal_ffv_50;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_51> AgradCdfExpModNormal_ffv_51;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_52> AgradCdfExpModNormal_ffv_52;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_53> AgradCdfExpModNormal_ffv_53;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_54> AgradCdfExpModNormal_ffv_54;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_55> AgradCdfExpModNormal_ffv_55;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_56> AgradCdfExpModNormal_ffv_56;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_57> AgradCdfExpModNormal_ffv_57;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_58> AgradCdfExpModNormal_ffv_58;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_59> AgradCdfExpModNormal_ffv_59;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_60> AgradCdfExpModNormal_ffv_60;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_61> AgradCdfExpModNormal_ffv_61;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_62> AgradCdfExpModNormal_ffv_62;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_63> AgradCdfExpModNormal_ffv_63;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_64> AgradCdfExpModNormal_ffv_64;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_65> AgradCdfExpModNormal_ffv_65;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_66> AgradCdfExpModNormal_ffv_66;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_67> AgradCdfExpModNormal_ffv_67;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_68> AgradCdfExpModNormal_ffv_68;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_69> AgradCdfExpModNormal_ffv_69;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_70> AgradCdfExpModNormal_ffv_70;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_71> AgradCdfExpModNormal_ffv_71;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_72> AgradCdfExpModNormal_ffv_72;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_73> AgradCdfExpModNormal_ffv_73;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_74> AgradCdfExpModNormal_ffv_74;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_75> AgradCdfExpModNormal_ffv_75;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_76> AgradCdfExpModNormal_ffv_76;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_77> AgradCdfExpModNormal_ffv_77;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_78> AgradCdfExpModNormal_ffv_78;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_79> AgradCdfExpModNormal_ffv_79;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_80> AgradCdfExpModNormal_ffv_80;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_81> AgradCdfExpModNormal_ffv_81;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_82> AgradCdfExpModNormal_ffv_82;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_83> AgradCdfExpModNormal_ffv_83;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_84> AgradCdfExpModNormal_ffv_84;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_85> AgradCdfExpModNormal_ffv_85;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_86> AgradCdfExpModNormal_ffv_86;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_87> AgradCdfExpModNormal_ffv_87;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_88> AgradCdfExpModNormal_ffv_88;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_89> AgradCdfExpModNormal_ffv_89;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_90> AgradCdfExpModNormal_ffv_90;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_91> AgradCdfExpModNormal_ffv_91;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_92> AgradCdfExpModNormal_ffv_92;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_93> AgradCdfExpModNormal_ffv_93;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_94> AgradCdfExpModNormal_ffv_94;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_95> AgradCdfExpModNormal_ffv_95;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_96> AgradCdfExpModNormal_ffv_96;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_97> AgradCdfExpModNormal_ffv_97;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_98> AgradCdfExpModNormal_ffv_98;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_99> AgradCdfExpModNormal_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_0, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_2, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_3, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_4, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_5, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_6, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_7, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_8, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_9, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_10, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_11, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_12, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_13, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_14, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_15, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_16, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_17, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_18, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_19, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_20, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_21, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_22, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_23, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_24, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_25, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_26, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_27, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_28, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_29, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_30, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_31, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_32, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_33, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_34, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_35, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_36, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_37, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_38, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_39, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_40, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_41, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_42, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_43, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_44, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_45, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_46, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_47, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_48, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_49, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_50, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_51, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_52, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_53, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_54, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_55, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_56, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_57, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_58, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_59, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_60, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_61, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_62, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_63, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_64, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_65, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_66, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_67, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_68, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_69, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_70, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_71, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_72, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_73, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_74, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_75, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_76, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_77, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_78, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_79, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_80, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_81, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_82, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_83, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_84, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_85, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_86, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_87, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_88, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_89, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_90, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_91, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_92, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_93, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_94, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_95, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_96, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_97, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_98, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_99, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_99);
+
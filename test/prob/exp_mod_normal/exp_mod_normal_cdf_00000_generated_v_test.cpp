@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<double, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<double, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<double, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<double, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<double, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<double, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<double, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<double, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfExpModNormal, type_v_0> AgradCdfExpModNormal_v_0;
+typedef std::tuple<AgradCdfExpModNormal, type_v_1> AgradCdfExpModNormal_v_1;
+typedef std::tuple<AgradCdfExpModNormal, type_v_2> AgradCdfExpModNormal_v_2;
+typedef std::tuple<AgradCdfExpModNormal, type_v_3> AgradCdfExpModNormal_v_3;
+typedef std::tuple<AgradCdfExpModNormal, type_v_4> AgradCdfExpModNormal_v_4;
+typedef std::tuple<AgradCdfExpModNormal, type_v_5> AgradCdfExpModNormal_v_5;
+typedef std::tuple<AgradCdfExpModNormal, type_v_6> AgradCdfExpModNormal_v_6;
+typedef std::tuple<AgradCdfExpModNormal, type_v_7> AgradCdfExpModNormal_v_7;
+typedef std::tuple<AgradCdfExpModNormal, type_v_8> AgradCdfExpModNormal_v_8;
+typedef std::tuple<AgradCdfExpModNormal, type_v_9> AgradCdfExpModNormal_v_9;
+typedef std::tuple<AgradCdfExpModNormal, type_v_10> AgradCdfExpModNormal_v_10;
+typedef std::tuple<AgradCdfExpModNormal, type_v_11> AgradCdfExpModNormal_v_11;
+typedef std::tuple<AgradCdfExpModNormal, type_v_12> AgradCdfExpModNormal_v_12;
+typedef std::tuple<AgradCdfExpModNormal, type_v_13> AgradCdfExpModNormal_v_13;
+typedef std::tuple<AgradCdfExpModNormal, type_v_14> AgradCdfExpModNormal_v_14;
+typedef std::tuple<AgradCdfExpModNormal, type_v_15> AgradCdfExpModNormal_v_15;
+typedef std::tuple<AgradCdfExpModNormal, type_v_16> AgradCdfExpModNormal_v_16;
+typedef std::tuple<AgradCdfExpModNormal, type_v_17> AgradCdfExpModNormal_v_17;
+typedef std::tuple<AgradCdfExpModNormal, type_v_18> AgradCdfExpModNormal_v_18;
+typedef std::tuple<AgradCdfExpModNormal, type_v_19> AgradCdfExpModNormal_v_19;
+typedef std::tuple<AgradCdfExpModNormal, type_v_20> AgradCdfExpModNormal_v_20;
+typedef std::tuple<AgradCdfExpModNormal, type_v_21> AgradCdfExpModNormal_v_21;
+typedef std::tuple<AgradCdfExpModNormal, type_v_22> AgradCdfExpModNormal_v_22;
+typedef std::tuple<AgradCdfExpModNormal, type_v_23> AgradCdfExpModNormal_v_23;
+typedef std::tuple<AgradCdfExpModNormal, type_v_24> AgradCdfExpModNormal_v_24;
+typedef std::tuple<AgradCdfExpModNormal, type_v_25> AgradCdfExpModNormal_v_25;
+typedef std::tuple<AgradCdfExpModNormal, type_v_26> AgradCdfExpModNormal_v_26;
+typedef std::tuple<AgradCdfExpModNormal, type_v_27> AgradCdfExpModNormal_v_27;
+typedef std::tuple<AgradCdfExpModNormal, type_v_28> AgradCdfExpModNormal_v_28;
+typedef std::tuple<AgradCdfExpModNormal, type_v_29> AgradCdfExpModNormal_v_29;
+typedef std::tuple<AgradCdfExpModNormal, type_v_30> AgradCdfExpModNormal_v_30;
+typedef std::tuple<AgradCdfExpModNormal, type_v_31> AgradCdfExpModNormal_v_31;
+typedef std::tuple<AgradCdfExpModNormal, type_v_32> AgradCdfExpModNormal_v_32;
+typedef std::tuple<AgradCdfExpModNormal, type_v_33> AgradCdfExpModNormal_v_33;
+typedef std::tuple<AgradCdfExpModNormal, type_v_34> AgradCdfExpModNormal_v_34;
+typedef std::tuple<AgradCdfExpModNormal, type_v_35> AgradCdfExpModNormal_v_35;
+typedef std::tuple<AgradCdfExpModNormal, type_v_36> AgradCdfExpModNormal_v_36;
+typedef std::tuple<AgradCdfExpModNormal, type_v_37> AgradCdfExpModNormal_v_37;
+typedef std::tuple<AgradCdfExpModNormal, type_v_38> AgradCdfExpModNormal_v_38;
+typedef std::tuple<AgradCdfExpModNormal, type_v_39> AgradCdfExpModNormal_v_39;
+typedef std::tuple<AgradCdfExpModNormal, type_v_40> AgradCdfExpModNormal_v_40;
+typedef std::tuple<AgradCdfExpModNormal, type_v_41> AgradCdfExpModNormal_v_41;
+typedef std::tuple<AgradCdfExpModNormal, type_v_42> AgradCdfExpModNormal_v_42;
+typedef std::tuple<AgradCdfExpModNormal, type_v_43> AgradCdfExpModNormal_v_43;
+typedef std::tuple<AgradCdfExpModNormal, type_v_44> AgradCdfExpModNormal_v_44;
+typedef std::tuple<AgradCdfExpModNormal, type_v_45> AgradCdfExpModNormal_v_45;
+typedef std::tuple<AgradCdfExpModNormal, type_v_46> AgradCdfExpModNormal_v_46;
+typedef std::tuple<AgradCdfExpModNormal, type_v_47> AgradCdfExpModNormal_v_47;
+typedef std::tuple<AgradCdfExpModNormal, type_v_48> AgradCdfExpModNormal_v_48;
+typedef std::tuple<AgradCdfExpModNormal, type_v_49> AgradCdfExpModNormal_v_49;
+typedef std::tuple<AgradCdfExpModNormal, type_v_50> AgradCdfExpModNormal_v_50;
+typedef std::tuple<AgradCdfExpModNormal, type_v_51> AgradCdfExpModNormal_v_51;
+typedef std::tuple<AgradCdfExpModNormal, type_v_52> AgradCdfExpModNormal_v_52;
+typedef std::tuple<AgradCdfExpModNormal, type_v_53> AgradCdfExpModNormal_v_53;
+typedef std::tuple<AgradCdfExpModNormal, type_v_54> AgradCdfExpModNormal_v_54;
+typedef std::tuple<AgradCdfExpModNormal, type_v_55> AgradCdfExpModNormal_v_55;
+typedef std::tuple<AgradCdfExpModNormal, type_v_56> AgradCdfExpModNormal_v_56;
+typedef std::tuple<AgradCdfExpModNormal, type_v_57> AgradCdfExpModNormal_v_57;
+typedef std::tuple<AgradCdfExpModNormal, type_v_58> AgradCdfExpModNormal_v_58;
+typedef std::tuple<AgradCdfExpModNormal, type_v_59> AgradCdfExpModNormal_v_59;
+typedef std::tuple<AgradCdfExpModNormal, type_v_60> AgradCdfExpModNormal_v_60;
+typedef std::tuple<AgradCdfExpModNormal, type_v_61> AgradCdfExpModNormal_v_61;
+typedef std::tuple<AgradCdfExpModNormal, type_v_62> AgradCdfExpModNormal_v_62;
+typedef std::tuple<AgradCdfExpModNormal, type_v_63> AgradCdfExpModNormal_v_63;
+typedef std::tuple<AgradCdfExpModNormal, type_v_64> AgradCdfExpModNormal_v_64;
+typedef std::tuple<AgradCdfExpModNormal, type_v_65> AgradCdfExpModNormal_v_65;
+typedef std::tuple<AgradCdfExpModNormal, type_v_66> AgradCdfExpModNormal_v_66;
+typedef std::tuple<AgradCdfExpModNormal, type_v_67> AgradCdfExpModNormal_v_67;
+typedef std::tuple<AgradCdfExpModNormal, type_v_68> AgradCdfExpModNormal_v_68;
+typedef std::tuple<AgradCdfExpModNormal, type_v_69> AgradCdfExpModNormal_v_69;
+typedef std::tuple<AgradCdfExpModNormal, type_v_70> AgradCdfExpModNormal_v_70;
+typedef std::tuple<AgradCdfExpModNormal, type_v_71> AgradCdfExpModNormal_v_71;
+typedef std::tuple<AgradCdfExpModNormal, type_v_72> AgradCdfExpModNormal_v_72;
+typedef std::tuple<AgradCdfExpModNormal, type_v_73> AgradCdfExpModNormal_v_73;
+typedef std::tuple<AgradCdfExpModNormal, type_v_74> AgradCdfExpModNormal_v_74;
+typedef std::tuple<AgradCdfExpModNormal, type_v_75> AgradCdfExpModNormal_v_75;
+typedef std::tuple<AgradCdfExpModNormal, type_v_76> AgradCdfExpModNormal_v_76;
+typedef std::tuple<AgradCdfExpModNormal, type_v_77> AgradCdfExpModNormal_v_77;
+typedef std::tuple<AgradCdfExpModNormal, type_v_78> AgradCdfExpModNormal_v_78;
+typedef std::tuple<AgradCdfExpModNormal, type_v_79> AgradCdfExpModNormal_v_79;
+typedef std::tuple<AgradCdfExpModNormal, type_v_80> AgradCdfExpModNormal_v_80;
+typedef std::tuple<AgradCdfExpModNormal, type_v_81> AgradCdfExpModNormal_v_81;
+typedef std::tuple<AgradCdfExpModNormal, type_v_82> AgradCdfExpModNormal_v_82;
+typedef std::tuple<AgradCdfExpModNormal, type_v_83> AgradCdfExpModNormal_v_83;
+typedef std::tuple<AgradCdfExpModNormal, type_v_84> AgradCdfExpModNormal_v_84;
+typedef std::tuple<AgradCdfExpModNormal, type_v_85> AgradCdfExpModNormal_v_85;
+typedef std::tuple<AgradCdfExpModNormal, type_v_86> AgradCdfExpModNormal_v_86;
+typedef std::tuple<AgradCdfExpModNormal, type_v_87> AgradCdfExpModNormal_v_87;
+typedef std::tuple<AgradCdfExpModNormal, type_v_88> AgradCdfExpModNormal_v_88;
+typedef std::tuple<AgradCdfExpModNormal, type_v_89> AgradCdfExpModNormal_v_89;
+typedef std::tuple<AgradCdfExpModNormal, type_v_90> AgradCdfExpModNormal_v_90;
+typedef std::tuple<AgradCdfExpModNormal, type_v_91> AgradCdfExpModNormal_v_91;
+typedef std::tuple<AgradCdfExpModNormal, type_v_92> AgradCdfExpModNormal_v_92;
+typedef std::tuple<AgradCdfExpModNormal, type_v_93> AgradCdfExpModNormal_v_93;
+typedef std::tuple<AgradCdfExpModNormal, type_v_94> AgradCdfExpModNormal_v_94;
+typedef std::tuple<AgradCdfExpModNormal, type_v_95> AgradCdfExpModNormal_v_95;
+typedef std::tuple<AgradCdfExpModNormal, type_v_96> AgradCdfExpModNormal_v_96;
+typedef std::tuple<AgradCdfExpModNormal, type_v_97> AgradCdfExpModNormal_v_97;
+typedef std::tuple<AgradCdfExpModNormal, type_v_98> AgradCdfExpModNormal_v_98;
+typedef std::tuple<AgradCdfExpModNormal, type_v_99> AgradCdfExpModNormal_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_0, AgradCdfTestFixture, AgradCdfExpModNormal_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_1, AgradCdfTestFixture, AgradCdfExpModNormal_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_2, AgradCdfTestFixture, AgradCdfExpModNormal_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_3, AgradCdfTestFixture, AgradCdfExpModNormal_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_4, AgradCdfTestFixture, AgradCdfExpModNormal_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_5, AgradCdfTestFixture, AgradCdfExpModNormal_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_6, AgradCdfTestFixture, AgradCdfExpModNormal_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_7, AgradCdfTestFixture, AgradCdfExpModNormal_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_8, AgradCdfTestFixture, AgradCdfExpModNormal_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_9, AgradCdfTestFixture, AgradCdfExpModNormal_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_10, AgradCdfTestFixture, AgradCdfExpModNormal_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_11, AgradCdfTestFixture, AgradCdfExpModNormal_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_12, AgradCdfTestFixture, AgradCdfExpModNormal_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_13, AgradCdfTestFixture, AgradCdfExpModNormal_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_14, AgradCdfTestFixture, AgradCdfExpModNormal_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_15, AgradCdfTestFixture, AgradCdfExpModNormal_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_16, AgradCdfTestFixture, AgradCdfExpModNormal_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_17, AgradCdfTestFixture, AgradCdfExpModNormal_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_18, AgradCdfTestFixture, AgradCdfExpModNormal_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_19, AgradCdfTestFixture, AgradCdfExpModNormal_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_20, AgradCdfTestFixture, AgradCdfExpModNormal_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_21, AgradCdfTestFixture, AgradCdfExpModNormal_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_22, AgradCdfTestFixture, AgradCdfExpModNormal_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_23, AgradCdfTestFixture, AgradCdfExpModNormal_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_24, AgradCdfTestFixture, AgradCdfExpModNormal_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_25, AgradCdfTestFixture, AgradCdfExpModNormal_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_26, AgradCdfTestFixture, AgradCdfExpModNormal_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_27, AgradCdfTestFixture, AgradCdfExpModNormal_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_28, AgradCdfTestFixture, AgradCdfExpModNormal_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_29, AgradCdfTestFixture, AgradCdfExpModNormal_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_30, AgradCdfTestFixture, AgradCdfExpModNormal_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_31, AgradCdfTestFixture, AgradCdfExpModNormal_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_32, AgradCdfTestFixture, AgradCdfExpModNormal_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_33, AgradCdfTestFixture, AgradCdfExpModNormal_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_34, AgradCdfTestFixture, AgradCdfExpModNormal_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_35, AgradCdfTestFixture, AgradCdfExpModNormal_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_36, AgradCdfTestFixture, AgradCdfExpModNormal_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_37, AgradCdfTestFixture, AgradCdfExpModNormal_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_38, AgradCdfTestFixture, AgradCdfExpModNormal_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_39, AgradCdfTestFixture, AgradCdfExpModNormal_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_40, AgradCdfTestFixture, AgradCdfExpModNormal_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_41, AgradCdfTestFixture, AgradCdfExpModNormal_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_42, AgradCdfTestFixture, AgradCdfExpModNormal_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_43, AgradCdfTestFixture, AgradCdfExpModNormal_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_44, AgradCdfTestFixture, AgradCdfExpModNormal_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_45, AgradCdfTestFixture, AgradCdfExpModNormal_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_46, AgradCdfTestFixture, AgradCdfExpModNormal_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_47, AgradCdfTestFixture, AgradCdfExpModNormal_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_48, AgradCdfTestFixture, AgradCdfExpModNormal_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_49, AgradCdfTestFixture, AgradCdfExpModNormal_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_50, AgradCdfTestFixture, AgradCdfExpModNormal_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_51, AgradCdfTestFixture, AgradCdfExpModNormal_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_52, AgradCdfTestFixture, AgradCdfExpModNormal_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_53, AgradCdfTestFixture, AgradCdfExpModNormal_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_54, AgradCdfTestFixture, AgradCdfExpModNormal_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_55, AgradCdfTestFixture, AgradCdfExpModNormal_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_56, AgradCdfTestFixture, AgradCdfExpModNormal_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_57, AgradCdfTestFixture, AgradCdfExpModNormal_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_58, AgradCdfTestFixture, AgradCdfExpModNormal_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_59, AgradCdfTestFixture, AgradCdfExpModNormal_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_60, AgradCdfTestFixture, AgradCdfExpModNormal_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_61, AgradCdfTestFixture, AgradCdfExpModNormal_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_62, AgradCdfTestFixture, AgradCdfExpModNormal_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_63, AgradCdfTestFixture, AgradCdfExpModNormal_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_64, AgradCdfTestFixture, AgradCdfExpModNormal_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_65, AgradCdfTestFixture, AgradCdfExpModNormal_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_66, AgradCdfTestFixture, AgradCdfExpModNormal_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_67, AgradCdfTestFixture, AgradCdfExpModNormal_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_68, AgradCdfTestFixture, AgradCdfExpModNormal_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_69, AgradCdfTestFixture, AgradCdfExpModNormal_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_70, AgradCdfTestFixture, AgradCdfExpModNormal_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_71, AgradCdfTestFixture, AgradCdfExpModNormal_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_72, AgradCdfTestFixture, AgradCdfExpModNormal_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_73, AgradCdfTestFixture, AgradCdfExpModNormal_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_74, AgradCdfTestFixture, AgradCdfExpModNormal_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_75, AgradCdfTestFixture, AgradCdfExpModNormal_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_76, AgradCdfTestFixture, AgradCdfExpModNormal_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_77, AgradCdfTestFixture, AgradCdfExpModNormal_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_78, AgradCdfTestFixture, AgradCdfExpModNormal_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_79, AgradCdfTestFixture, AgradCdfExpModNormal_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_80, AgradCdfTestFixture, AgradCdfExpModNormal_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_81, AgradCdfTestFixture, AgradCdfExpModNormal_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_82, AgradCdfTestFixture, AgradCdfExpModNormal_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_83, AgradCdfTestFixture, AgradCdfExpModNormal_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_84, AgradCdfTestFixture, AgradCdfExpModNormal_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_85, AgradCdfTestFixture, AgradCdfExpModNormal_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_86, AgradCdfTestFixture, AgradCdfExpModNormal_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_87, AgradCdfTestFixture, AgradCdfExpModNormal_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_88, AgradCdfTestFixture, AgradCdfExpModNormal_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_89, AgradCdfTestFixture, AgradCdfExpModNormal_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_90, AgradCdfTestFixture, AgradCdfExpModNormal_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_91, AgradCdfTestFixture, AgradCdfExpModNormal_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_92, AgradCdfTestFixture, AgradCdfExpModNormal_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_93, AgradCdfTestFixture, AgradCdfExpModNormal_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_94, AgradCdfTestFixture, AgradCdfExpModNormal_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_95, AgradCdfTestFixture, AgradCdfExpModNormal_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_96, AgradCdfTestFixture, AgradCdfExpModNormal_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_97, AgradCdfTestFixture, AgradCdfExpModNormal_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_98, AgradCdfTestFixture, AgradCdfExpModNormal_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_99, AgradCdfTestFixture, AgradCdfExpModNormal_v_99);
+
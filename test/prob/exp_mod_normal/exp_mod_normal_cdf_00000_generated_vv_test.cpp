@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<double, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<double, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<double, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<double, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<double, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<double, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<double, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<double, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<double, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<double, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<double, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<double, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<double, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfExpModNormal, type_vv_0> AgradCdfExpModNormal_vv_0;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1> AgradCdfExpModNormal_vv_1;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_2> AgradCdfExpModNormal_vv_2;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_3> AgradCdfExpModNormal_vv_3;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_4> AgradCdfExpModNormal_vv_4;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_5> AgradCdfExpModNormal_vv_5;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_6> AgradCdfExpModNormal_vv_6;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_7> AgradCdfExpModNormal_vv_7;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_8> AgradCdfExpModNormal_vv_8;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_9> AgradCdfExpModNormal_vv_9;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_10> AgradCdfExpModNormal_vv_10;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_11> AgradCdfExpModNormal_vv_11;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_12> AgradCdfExpModNormal_vv_12;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_13> AgradCdfExpModNormal_vv_13;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_14> AgradCdfExpModNormal_vv_14;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_15> AgradCdfExpModNormal_vv_15;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_16> AgradCdfExpModNormal_vv_16;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_17> AgradCdfExpModNormal_vv_17;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_18> AgradCdfExpModNormal_vv_18;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_19> AgradCdfExpModNormal_vv_19;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_20> AgradCdfExpModNormal_vv_20;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_21> AgradCdfExpModNormal_vv_21;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_22> AgradCdfExpModNormal_vv_22;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_23> AgradCdfExpModNormal_vv_23;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_24> AgradCdfExpModNormal_vv_24;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_25> AgradCdfExpModNormal_vv_25;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_26> AgradCdfExpModNormal_vv_26;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_27> AgradCdfExpModNormal_vv_27;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_28> AgradCdfExpModNormal_vv_28;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_29> AgradCdfExpModNormal_vv_29;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_30> AgradCdfExpModNormal_vv_30;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_31> AgradCdfExpModNormal_vv_31;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_32> AgradCdfExpModNormal_vv_32;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_33> AgradCdfExpModNormal_vv_33;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_34> AgradCdfExpModNormal_vv_34;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_35> AgradCdfExpModNormal_vv_35;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_36> AgradCdfExpModNormal_vv_36;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_37> AgradCdfExpModNormal_vv_37;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_38> AgradCdfExpModNormal_vv_38;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_39> AgradCdfExpModNormal_vv_39;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_40> AgradCdfExpModNormal_vv_40;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_41> AgradCdfExpModNormal_vv_41;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_42> AgradCdfExpModNormal_vv_42;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_43> AgradCdfExpModNormal_vv_43;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_44> AgradCdfExpModNormal_vv_44;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_45> AgradCdfExpModNormal_vv_45;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_46> AgradCdfExpModNormal_vv_46;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_47> AgradCdfExpModNormal_vv_47;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_48> AgradCdfExpModNormal_vv_48;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_49> AgradCdfExpModNormal_vv_49;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_50> AgradCdfExpModNormal_vv_50;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_51> AgradCdfExpModNormal_vv_51;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_52> AgradCdfExpModNormal_vv_52;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_53> AgradCdfExpModNormal_vv_53;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_54> AgradCdfExpModNormal_vv_54;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_55> AgradCdfExpModNormal_vv_55;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_56> AgradCdfExpModNormal_vv_56;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_57> AgradCdfExpModNormal_vv_57;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_58> AgradCdfExpModNormal_vv_58;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_59> AgradCdfExpModNormal_vv_59;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_60> AgradCdfExpModNormal_vv_60;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_61> AgradCdfExpModNormal_vv_61;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_62> AgradCdfExpModNormal_vv_62;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_63> AgradCdfExpModNormal_vv_63;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_64> AgradCdfExpModNormal_vv_64;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_65> AgradCdfExpModNormal_vv_65;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_66> AgradCdfExpModNormal_vv_66;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_67> AgradCdfExpModNormal_vv_67;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_68> AgradCdfExpModNormal_vv_68;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_69> AgradCdfExpModNormal_vv_69;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_70> AgradCdfExpModNormal_vv_70;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_71> AgradCdfExpModNormal_vv_71;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_72> AgradCdfExpModNormal_vv_72;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_73> AgradCdfExpModNormal_vv_73;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_74> AgradCdfExpModNormal_vv_74;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_75> AgradCdfExpModNormal_vv_75;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_76> AgradCdfExpModNormal_vv_76;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_77> AgradCdfExpModNormal_vv_77;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_78> AgradCdfExpModNormal_vv_78;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_79> AgradCdfExpModNormal_vv_79;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_80> AgradCdfExpModNormal_vv_80;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_81> AgradCdfExpModNormal_vv_81;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_82> AgradCdfExpModNormal_vv_82;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_83> AgradCdfExpModNormal_vv_83;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_84> AgradCdfExpModNormal_vv_84;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_85> AgradCdfExpModNormal_vv_85;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_86> AgradCdfExpModNormal_vv_86;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_87> AgradCdfExpModNormal_vv_87;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_88> AgradCdfExpModNormal_vv_88;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_89> AgradCdfExpModNormal_vv_89;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_90> AgradCdfExpModNormal_vv_90;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_91> AgradCdfExpModNormal_vv_91;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_92> AgradCdfExpModNormal_vv_92;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_93> AgradCdfExpModNormal_vv_93;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_94> AgradCdfExpModNormal_vv_94;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_95> AgradCdfExpModNormal_vv_95;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_96> AgradCdfExpModNormal_vv_96;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_97> AgradCdfExpModNormal_vv_97;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_98> AgradCdfExpModNormal_vv_98;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_99> AgradCdfExpModNormal_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_0, AgradCdfTestFixture, AgradCdfExpModNormal_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_2, AgradCdfTestFixture, AgradCdfExpModNormal_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_3, AgradCdfTestFixture, AgradCdfExpModNormal_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_4, AgradCdfTestFixture, AgradCdfExpModNormal_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_5, AgradCdfTestFixture, AgradCdfExpModNormal_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_6, AgradCdfTestFixture, AgradCdfExpModNormal_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_7, AgradCdfTestFixture, AgradCdfExpModNormal_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_8, AgradCdfTestFixture, AgradCdfExpModNormal_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_9, AgradCdfTestFixture, AgradCdfExpModNormal_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_10, AgradCdfTestFixture, AgradCdfExpModNormal_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_11, AgradCdfTestFixture, AgradCdfExpModNormal_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_12, AgradCdfTestFixture, AgradCdfExpModNormal_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_13, AgradCdfTestFixture, AgradCdfExpModNormal_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_14, AgradCdfTestFixture, AgradCdfExpModNormal_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_15, AgradCdfTestFixture, AgradCdfExpModNormal_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_16, AgradCdfTestFixture, AgradCdfExpModNormal_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_17, AgradCdfTestFixture, AgradCdfExpModNormal_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_18, AgradCdfTestFixture, AgradCdfExpModNormal_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_19, AgradCdfTestFixture, AgradCdfExpModNormal_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_20, AgradCdfTestFixture, AgradCdfExpModNormal_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_21, AgradCdfTestFixture, AgradCdfExpModNormal_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_22, AgradCdfTestFixture, AgradCdfExpModNormal_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_23, AgradCdfTestFixture, AgradCdfExpModNormal_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_24, AgradCdfTestFixture, AgradCdfExpModNormal_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_25, AgradCdfTestFixture, AgradCdfExpModNormal_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_26, AgradCdfTestFixture, AgradCdfExpModNormal_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_27, AgradCdfTestFixture, AgradCdfExpModNormal_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_28, AgradCdfTestFixture, AgradCdfExpModNormal_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_29, AgradCdfTestFixture, AgradCdfExpModNormal_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_30, AgradCdfTestFixture, AgradCdfExpModNormal_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_31, AgradCdfTestFixture, AgradCdfExpModNormal_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_32, AgradCdfTestFixture, AgradCdfExpModNormal_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_33, AgradCdfTestFixture, AgradCdfExpModNormal_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_34, AgradCdfTestFixture, AgradCdfExpModNormal_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_35, AgradCdfTestFixture, AgradCdfExpModNormal_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_36, AgradCdfTestFixture, AgradCdfExpModNormal_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_37, AgradCdfTestFixture, AgradCdfExpModNormal_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_38, AgradCdfTestFixture, AgradCdfExpModNormal_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_39, AgradCdfTestFixture, AgradCdfExpModNormal_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_40, AgradCdfTestFixture, AgradCdfExpModNormal_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_41, AgradCdfTestFixture, AgradCdfExpModNormal_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_42, AgradCdfTestFixture, AgradCdfExpModNormal_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_43, AgradCdfTestFixture, AgradCdfExpModNormal_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_44, AgradCdfTestFixture, AgradCdfExpModNormal_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_45, AgradCdfTestFixture, AgradCdfExpModNormal_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_46, AgradCdfTestFixture, AgradCdfExpModNormal_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_47, AgradCdfTestFixture, AgradCdfExpModNormal_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_48, AgradCdfTestFixture, AgradCdfExpModNormal_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_49, AgradCdfTestFixture, AgradCdfExpModNormal_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_50, AgradCdfTestFixture, AgradCdfExpModNormal_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_51, AgradCdfTestFixture, AgradCdfExpModNormal_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_52, AgradCdfTestFixture, AgradCdfExpModNormal_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_53, AgradCdfTestFixture, AgradCdfExpModNormal_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_54, AgradCdfTestFixture, AgradCdfExpModNormal_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_55, AgradCdfTestFixture, AgradCdfExpModNormal_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_56, AgradCdfTestFixture, AgradCdfExpModNormal_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_57, AgradCdfTestFixture, AgradCdfExpModNormal_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_58, AgradCdfTestFixture, AgradCdfExpModNormal_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_59, AgradCdfTestFixture, AgradCdfExpModNormal_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_60, AgradCdfTestFixture, AgradCdfExpModNormal_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_61, AgradCdfTestFixture, AgradCdfExpModNormal_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_62, AgradCdfTestFixture, AgradCdfExpModNormal_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_63, AgradCdfTestFixture, AgradCdfExpModNormal_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_64, AgradCdfTestFixture, AgradCdfExpModNormal_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_65, AgradCdfTestFixture, AgradCdfExpModNormal_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_66, AgradCdfTestFixture, AgradCdfExpModNormal_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_67, AgradCdfTestFixture, AgradCdfExpModNormal_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_68, AgradCdfTestFixture, AgradCdfExpModNormal_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_69, AgradCdfTestFixture, AgradCdfExpModNormal_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_70, AgradCdfTestFixture, AgradCdfExpModNormal_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_71, AgradCdfTestFixture, AgradCdfExpModNormal_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_72, AgradCdfTestFixture, AgradCdfExpModNormal_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_73, AgradCdfTestFixture, AgradCdfExpModNormal_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_74, AgradCdfTestFixture, AgradCdfExpModNormal_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_75, AgradCdfTestFixture, AgradCdfExpModNormal_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_76, AgradCdfTestFixture, AgradCdfExpModNormal_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_77, AgradCdfTestFixture, AgradCdfExpModNormal_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_78, AgradCdfTestFixture, AgradCdfExpModNormal_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_79, AgradCdfTestFixture, AgradCdfExpModNormal_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_80, AgradCdfTestFixture, AgradCdfExpModNormal_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_81, AgradCdfTestFixture, AgradCdfExpModNormal_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_82, AgradCdfTestFixture, AgradCdfExpModNormal_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_83, AgradCdfTestFixture, AgradCdfExpModNormal_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_84, AgradCdfTestFixture, AgradCdfExpModNormal_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_85, AgradCdfTestFixture, AgradCdfExpModNormal_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_86, AgradCdfTestFixture, AgradCdfExpModNormal_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_87, AgradCdfTestFixture, AgradCdfExpModNormal_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_88, AgradCdfTestFixture, AgradCdfExpModNormal_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_89, AgradCdfTestFixture, AgradCdfExpModNormal_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_90, AgradCdfTestFixture, AgradCdfExpModNormal_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_91, AgradCdfTestFixture, AgradCdfExpModNormal_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_92, AgradCdfTestFixture, AgradCdfExpModNormal_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_93, AgradCdfTestFixture, AgradCdfExpModNormal_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_94, AgradCdfTestFixture, AgradCdfExpModNormal_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_95, AgradCdfTestFixture, AgradCdfExpModNormal_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_96, AgradCdfTestFixture, AgradCdfExpModNormal_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_97, AgradCdfTestFixture, AgradCdfExpModNormal_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_98, AgradCdfTestFixture, AgradCdfExpModNormal_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_99, AgradCdfTestFixture, AgradCdfExpModNormal_vv_99);
+
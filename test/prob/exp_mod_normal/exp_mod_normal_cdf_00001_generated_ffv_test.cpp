@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<double>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_100> AgradCdfExpModNormal_ffv_100;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_101> AgradCdfExpModNormal_ffv_101;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_102> AgradCdfExpModNormal_ffv_102;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_103> AgradCdfExpModNormal_ffv_103;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_104> AgradCdfExpModNormal_ffv_104;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_105> AgradCdfExpModNormal_ffv_105;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_106> AgradCdfExpModNormal_ffv_106;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_107> AgradCdfExpModNormal_ffv_107;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_108> AgradCdfExpModNormal_ffv_108;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_109> AgradCdfExpModNormal_ffv_109;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_110> AgradCdfExpModNormal_ffv_110;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_111> AgradCdfExpModNormal_ffv_111;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_112> AgradCdfExpModNormal_ffv_112;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_113> AgradCdfExpModNormal_ffv_113;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_114> AgradCdfExpModNormal_ffv_114;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_115> AgradCdfExpModNormal_ffv_115;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_116> AgradCdfExpModNormal_ffv_116;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_117> AgradCdfExpModNormal_ffv_117;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_118> AgradCdfExpModNormal_ffv_118;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_119> AgradCdfExpModNormal_ffv_119;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_120> AgradCdfExpModNormal_ffv_120;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_121> AgradCdfExpModNormal_ffv_121;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_122> AgradCdfExpModNormal_ffv_122;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_123> AgradCdfExpModNormal_ffv_123;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_124> AgradCdfExpModNormal_ffv_124;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_125> AgradCdfExpModNormal_ffv_125;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_126> AgradCdfExpModNormal_ffv_126;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_127> AgradCdfExpModNormal_ffv_127;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_128> AgradCdfExpModNormal_ffv_128;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_129> AgradCdfExpModNormal_ffv_129;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_130> AgradCdfExpModNormal_ffv_130;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_131> AgradCdfExpModNormal_ffv_131;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_132> AgradCdfExpModNormal_ffv_132;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_133> AgradCdfExpModNormal_ffv_133;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_134> AgradCdfExpModNormal_ffv_134;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_135> AgradCdfExpModNormal_ffv_135;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_136> AgradCdfExpModNormal_ffv_136;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_137> AgradCdfExpModNormal_ffv_137;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_138> AgradCdfExpModNormal_ffv_138;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_139> AgradCdfExpModNormal_ffv_139;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_140> AgradCdfExpModNormal_ffv_140;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_141> AgradCdfExpModNormal_ffv_141;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_142> AgradCdfExpModNormal_ffv_142;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_143> AgradCdfExpModNormal_ffv_143;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_144> AgradCdfExpModNormal_ffv_144;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_145> AgradCdfExpModNormal_ffv_145;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_146> AgradCdfExpModNormal_ffv_146;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_147> AgradCdfExpModNormal_ffv_147;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_148> AgradCdfExpModNormal_ffv_148;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_149> AgradCdfExpModNormal_ffv_149;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_150> AgradCdfExpModNormal_ffv_150;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_151> AgradCdfExpModNormal_ffv_151;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_152> AgradCdfExpModNormal_ffv_152;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_153> AgradCdfExpModNormal_ffv_153;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_154> AgradCdfExpModNormal_ffv_154;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_155> AgradCdfExpModNormal_ffv_155;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_156> AgradCdfExpModNormal_ffv_156;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_157> AgradCdfExpModNormal_ffv_157;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_158> AgradCdfExpModNormal_ffv_158;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_159> AgradCdfExpModNormal_ffv_159;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_160> AgradCdfExpModNormal_ffv_160;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_161> AgradCdfExpModNormal_ffv_161;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_162> AgradCdfExpModNormal_ffv_162;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_163> AgradCdfExpModNormal_ffv_163;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_164> AgradCdfExpModNormal_ffv_164;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_165> AgradCdfExpModNormal_ffv_165;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_166> AgradCdfExpModNormal_ffv_166;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_167> AgradCdfExpModNormal_ffv_167;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_168> AgradCdfExpModNormal_ffv_168;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_169> AgradCdfExpModNormal_ffv_169;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_170> AgradCdfExpModNormal_ffv_170;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_171> AgradCdfExpModNormal_ffv_171;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_172> AgradCdfExpModNormal_ffv_172;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_173> AgradCdfExpModNormal_ffv_173;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_174> AgradCdfExpModNormal_ffv_174;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_175> AgradCdfExpModNormal_ffv_175;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_176> AgradCdfExpModNormal_ffv_176;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_177> AgradCdfExpModNormal_ffv_177;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_178> AgradCdfExpModNormal_ffv_178;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_179> AgradCdfExpModNormal_ffv_179;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_180> AgradCdfExpModNormal_ffv_180;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_181> AgradCdfExpModNormal_ffv_181;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_182> AgradCdfExpModNormal_ffv_182;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_183> AgradCdfExpModNormal_ffv_183;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_184> AgradCdfExpModNormal_ffv_184;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_185> AgradCdfExpModNormal_ffv_185;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_186> AgradCdfExpModNormal_ffv_186;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_187> AgradCdfExpModNormal_ffv_187;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_188> AgradCdfExpModNormal_ffv_188;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_189> AgradCdfExpModNormal_ffv_189;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_190> AgradCdfExpModNormal_ffv_190;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_191> AgradCdfExpModNormal_ffv_191;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_192> AgradCdfExpModNormal_ffv_192;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_193> AgradCdfExpModNormal_ffv_193;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_194> AgradCdfExpModNormal_ffv_194;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_195> AgradCdfExpModNormal_ffv_195;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_196> AgradCdfExpModNormal_ffv_196;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_197> AgradCdfExpModNormal_ffv_197;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_198> AgradCdfExpModNormal_ffv_198;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_199> AgradCdfExpModNormal_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_100, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_101, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_102, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_103, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_104, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_105, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_106, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_107, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_108, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_109, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_110, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_111, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_112, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_113, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_114, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_115, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_116, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_117, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_118, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_119, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_120, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_121, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_122, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_123, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_124, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_125, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_126, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_127, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_128, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_129, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_130, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_131, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_132, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_133, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_134, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_135, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_136, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_137, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_138, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_139, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_140, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_141, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_142, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_143, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_144, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_145, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_146, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_147, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_148, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_149, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_150, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_151, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_152, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_153, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_154, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_155, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_156, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_157, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_158, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_159, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_160, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_161, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_162, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_163, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_164, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_165, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_166, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_167, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_168, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_169, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_170, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_171, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_172, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_173, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_174, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_175, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_176, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_177, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_178, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_179, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_180, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_181, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_182, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_183, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_184, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_185, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_186, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_187, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_188, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_189, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_190, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_191, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_192, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_193, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_194, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_195, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_196, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_197, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_198, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_199, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<double, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<double, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<double, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<double, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfExpModNormal, type_v_100> AgradCdfExpModNormal_v_100;
+typedef std::tuple<AgradCdfExpModNormal, type_v_101> AgradCdfExpModNormal_v_101;
+typedef std::tuple<AgradCdfExpModNormal, type_v_102> AgradCdfExpModNormal_v_102;
+typedef std::tuple<AgradCdfExpModNormal, type_v_103> AgradCdfExpModNormal_v_103;
+typedef std::tuple<AgradCdfExpModNormal, type_v_104> AgradCdfExpModNormal_v_104;
+typedef std::tuple<AgradCdfExpModNormal, type_v_105> AgradCdfExpModNormal_v_105;
+typedef std::tuple<AgradCdfExpModNormal, type_v_106> AgradCdfExpModNormal_v_106;
+typedef std::tuple<AgradCdfExpModNormal, type_v_107> AgradCdfExpModNormal_v_107;
+typedef std::tuple<AgradCdfExpModNormal, type_v_108> AgradCdfExpModNormal_v_108;
+typedef std::tuple<AgradCdfExpModNormal, type_v_109> AgradCdfExpModNormal_v_109;
+typedef std::tuple<AgradCdfExpModNormal, type_v_110> AgradCdfExpModNormal_v_110;
+typedef std::tuple<AgradCdfExpModNormal, type_v_111> AgradCdfExpModNormal_v_111;
+typedef std::tuple<AgradCdfExpModNormal, type_v_112> AgradCdfExpModNormal_v_112;
+typedef std::tuple<AgradCdfExpModNormal, type_v_113> AgradCdfExpModNormal_v_113;
+typedef std::tuple<AgradCdfExpModNormal, type_v_114> AgradCdfExpModNormal_v_114;
+typedef std::tuple<AgradCdfExpModNormal, type_v_115> AgradCdfExpModNormal_v_115;
+typedef std::tuple<AgradCdfExpModNormal, type_v_116> AgradCdfExpModNormal_v_116;
+typedef std::tuple<AgradCdfExpModNormal, type_v_117> AgradCdfExpModNormal_v_117;
+typedef std::tuple<AgradCdfExpModNormal, type_v_118> AgradCdfExpModNormal_v_118;
+typedef std::tuple<AgradCdfExpModNormal, type_v_119> AgradCdfExpModNormal_v_119;
+typedef std::tuple<AgradCdfExpModNormal, type_v_120> AgradCdfExpModNormal_v_120;
+typedef std::tuple<AgradCdfExpModNormal, type_v_121> AgradCdfExpModNormal_v_121;
+typedef std::tuple<AgradCdfExpModNormal, type_v_122> AgradCdfExpModNormal_v_122;
+typedef std::tuple<AgradCdfExpModNormal, type_v_123> AgradCdfExpModNormal_v_123;
+typedef std::tuple<AgradCdfExpModNormal, type_v_124> AgradCdfExpModNormal_v_124;
+typedef std::tuple<AgradCdfExpModNormal, type_v_125> AgradCdfExpModNormal_v_125;
+typedef std::tuple<AgradCdfExpModNormal, type_v_126> AgradCdfExpModNormal_v_126;
+typedef std::tuple<AgradCdfExpModNormal, type_v_127> AgradCdfExpModNormal_v_127;
+typedef std::tuple<AgradCdfExpModNormal, type_v_128> AgradCdfExpModNormal_v_128;
+typedef std::tuple<AgradCdfExpModNormal, type_v_129> AgradCdfExpModNormal_v_129;
+typedef std::tuple<AgradCdfExpModNormal, type_v_130> AgradCdfExpModNormal_v_130;
+typedef std::tuple<AgradCdfExpModNormal, type_v_131> AgradCdfExpModNormal_v_131;
+typedef std::tuple<AgradCdfExpModNormal, type_v_132> AgradCdfExpModNormal_v_132;
+typedef std::tuple<AgradCdfExpModNormal, type_v_133> AgradCdfExpModNormal_v_133;
+typedef std::tuple<AgradCdfExpModNormal, type_v_134> AgradCdfExpModNormal_v_134;
+typedef std::tuple<AgradCdfExpModNormal, type_v_135> AgradCdfExpModNormal_v_135;
+typedef std::tuple<AgradCdfExpModNormal, type_v_136> AgradCdfExpModNormal_v_136;
+typedef std::tuple<AgradCdfExpModNormal, type_v_137> AgradCdfExpModNormal_v_137;
+typedef std::tuple<AgradCdfExpModNormal, type_v_138> AgradCdfExpModNormal_v_138;
+typedef std::tuple<AgradCdfExpModNormal, type_v_139> AgradCdfExpModNormal_v_139;
+typedef std::tuple<AgradCdfExpModNormal, type_v_140> AgradCdfExpModNormal_v_140;
+typedef std::tuple<AgradCdfExpModNormal, type_v_141> AgradCdfExpModNormal_v_141;
+typedef std::tuple<AgradCdfExpModNormal, type_v_142> AgradCdfExpModNormal_v_142;
+typedef std::tuple<AgradCdfExpModNormal, type_v_143> AgradCdfExpModNormal_v_143;
+typedef std::tuple<AgradCdfExpModNormal, type_v_144> AgradCdfExpModNormal_v_144;
+typedef std::tuple<AgradCdfExpModNormal, type_v_145> AgradCdfExpModNormal_v_145;
+typedef std::tuple<AgradCdfExpModNormal, type_v_146> AgradCdfExpModNormal_v_146;
+typedef std::tuple<AgradCdfExpModNormal, type_v_147> AgradCdfExpModNormal_v_147;
+typedef std::tuple<AgradCdfExpModNormal, type_v_148> AgradCdfExpModNormal_v_148;
+typedef std::tuple<AgradCdfExpModNormal, type_v_149> AgradCdfExpModNormal_v_149;
+typedef std::tuple<AgradCdfExpModNormal, type_v_150> AgradCdfExpModNormal_v_150;
+typedef std::tuple<AgradCdfExpModNormal, type_v_151> AgradCdfExpModNormal_v_151;
+typedef std::tuple<AgradCdfExpModNormal, type_v_152> AgradCdfExpModNormal_v_152;
+typedef std::tuple<AgradCdfExpModNormal, type_v_153> AgradCdfExpModNormal_v_153;
+typedef std::tuple<AgradCdfExpModNormal, type_v_154> AgradCdfExpModNormal_v_154;
+typedef std::tuple<AgradCdfExpModNormal, type_v_155> AgradCdfExpModNormal_v_155;
+typedef std::tuple<AgradCdfExpModNormal, type_v_156> AgradCdfExpModNormal_v_156;
+typedef std::tuple<AgradCdfExpModNormal, type_v_157> AgradCdfExpModNormal_v_157;
+typedef std::tuple<AgradCdfExpModNormal, type_v_158> AgradCdfExpModNormal_v_158;
+typedef std::tuple<AgradCdfExpModNormal, type_v_159> AgradCdfExpModNormal_v_159;
+typedef std::tuple<AgradCdfExpModNormal, type_v_160> AgradCdfExpModNormal_v_160;
+typedef std::tuple<AgradCdfExpModNormal, type_v_161> AgradCdfExpModNormal_v_161;
+typedef std::tuple<AgradCdfExpModNormal, type_v_162> AgradCdfExpModNormal_v_162;
+typedef std::tuple<AgradCdfExpModNormal, type_v_163> AgradCdfExpModNormal_v_163;
+typedef std::tuple<AgradCdfExpModNormal, type_v_164> AgradCdfExpModNormal_v_164;
+typedef std::tuple<AgradCdfExpModNormal, type_v_165> AgradCdfExpModNormal_v_165;
+typedef std::tuple<AgradCdfExpModNormal, type_v_166> AgradCdfExpModNormal_v_166;
+typedef std::tuple<AgradCdfExpModNormal, type_v_167> AgradCdfExpModNormal_v_167;
+typedef std::tuple<AgradCdfExpModNormal, type_v_168> AgradCdfExpModNormal_v_168;
+typedef std::tuple<AgradCdfExpModNormal, type_v_169> AgradCdfExpModNormal_v_169;
+typedef std::tuple<AgradCdfExpModNormal, type_v_170> AgradCdfExpModNormal_v_170;
+typedef std::tuple<AgradCdfExpModNormal, type_v_171> AgradCdfExpModNormal_v_171;
+typedef std::tuple<AgradCdfExpModNormal, type_v_172> AgradCdfExpModNormal_v_172;
+typedef std::tuple<AgradCdfExpModNormal, type_v_173> AgradCdfExpModNormal_v_173;
+typedef std::tuple<AgradCdfExpModNormal, type_v_174> AgradCdfExpModNormal_v_174;
+typedef std::tuple<AgradCdfExpModNormal, type_v_175> AgradCdfExpModNormal_v_175;
+typedef std::tuple<AgradCdfExpModNormal, type_v_176> AgradCdfExpModNormal_v_176;
+typedef std::tuple<AgradCdfExpModNormal, type_v_177> AgradCdfExpModNormal_v_177;
+typedef std::tuple<AgradCdfExpModNormal, type_v_178> AgradCdfExpModNormal_v_178;
+typedef std::tuple<AgradCdfExpModNormal, type_v_179> AgradCdfExpModNormal_v_179;
+typedef std::tuple<AgradCdfExpModNormal, type_v_180> AgradCdfExpModNormal_v_180;
+typedef std::tuple<AgradCdfExpModNormal, type_v_181> AgradCdfExpModNormal_v_181;
+typedef std::tuple<AgradCdfExpModNormal, type_v_182> AgradCdfExpModNormal_v_182;
+typedef std::tuple<AgradCdfExpModNormal, type_v_183> AgradCdfExpModNormal_v_183;
+typedef std::tuple<AgradCdfExpModNormal, type_v_184> AgradCdfExpModNormal_v_184;
+typedef std::tuple<AgradCdfExpModNormal, type_v_185> AgradCdfExpModNormal_v_185;
+typedef std::tuple<AgradCdfExpModNormal, type_v_186> AgradCdfExpModNormal_v_186;
+typedef std::tuple<AgradCdfExpModNormal, type_v_187> AgradCdfExpModNormal_v_187;
+typedef std::tuple<AgradCdfExpModNormal, type_v_188> AgradCdfExpModNormal_v_188;
+typedef std::tuple<AgradCdfExpModNormal, type_v_189> AgradCdfExpModNormal_v_189;
+typedef std::tuple<AgradCdfExpModNormal, type_v_190> AgradCdfExpModNormal_v_190;
+typedef std::tuple<AgradCdfExpModNormal, type_v_191> AgradCdfExpModNormal_v_191;
+typedef std::tuple<AgradCdfExpModNormal, type_v_192> AgradCdfExpModNormal_v_192;
+typedef std::tuple<AgradCdfExpModNormal, type_v_193> AgradCdfExpModNormal_v_193;
+typedef std::tuple<AgradCdfExpModNormal, type_v_194> AgradCdfExpModNormal_v_194;
+typedef std::tuple<AgradCdfExpModNormal, type_v_195> AgradCdfExpModNormal_v_195;
+typedef std::tuple<AgradCdfExpModNormal, type_v_196> AgradCdfExpModNormal_v_196;
+typedef std::tuple<AgradCdfExpModNormal, type_v_197> AgradCdfExpModNormal_v_197;
+typedef std::tuple<AgradCdfExpModNormal, type_v_198> AgradCdfExpModNormal_v_198;
+typedef std::tuple<AgradCdfExpModNormal, type_v_199> AgradCdfExpModNormal_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_100, AgradCdfTestFixture, AgradCdfExpModNormal_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_101, AgradCdfTestFixture, AgradCdfExpModNormal_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_102, AgradCdfTestFixture, AgradCdfExpModNormal_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_103, AgradCdfTestFixture, AgradCdfExpModNormal_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_104, AgradCdfTestFixture, AgradCdfExpModNormal_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_105, AgradCdfTestFixture, AgradCdfExpModNormal_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_106, AgradCdfTestFixture, AgradCdfExpModNormal_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_107, AgradCdfTestFixture, AgradCdfExpModNormal_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_108, AgradCdfTestFixture, AgradCdfExpModNormal_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_109, AgradCdfTestFixture, AgradCdfExpModNormal_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_110, AgradCdfTestFixture, AgradCdfExpModNormal_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_111, AgradCdfTestFixture, AgradCdfExpModNormal_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_112, AgradCdfTestFixture, AgradCdfExpModNormal_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_113, AgradCdfTestFixture, AgradCdfExpModNormal_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_114, AgradCdfTestFixture, AgradCdfExpModNormal_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_115, AgradCdfTestFixture, AgradCdfExpModNormal_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_116, AgradCdfTestFixture, AgradCdfExpModNormal_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_117, AgradCdfTestFixture, AgradCdfExpModNormal_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_118, AgradCdfTestFixture, AgradCdfExpModNormal_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_119, AgradCdfTestFixture, AgradCdfExpModNormal_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_120, AgradCdfTestFixture, AgradCdfExpModNormal_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_121, AgradCdfTestFixture, AgradCdfExpModNormal_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_122, AgradCdfTestFixture, AgradCdfExpModNormal_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_123, AgradCdfTestFixture, AgradCdfExpModNormal_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_124, AgradCdfTestFixture, AgradCdfExpModNormal_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_125, AgradCdfTestFixture, AgradCdfExpModNormal_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_126, AgradCdfTestFixture, AgradCdfExpModNormal_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_127, AgradCdfTestFixture, AgradCdfExpModNormal_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_128, AgradCdfTestFixture, AgradCdfExpModNormal_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_129, AgradCdfTestFixture, AgradCdfExpModNormal_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_130, AgradCdfTestFixture, AgradCdfExpModNormal_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_131, AgradCdfTestFixture, AgradCdfExpModNormal_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_132, AgradCdfTestFixture, AgradCdfExpModNormal_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_133, AgradCdfTestFixture, AgradCdfExpModNormal_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_134, AgradCdfTestFixture, AgradCdfExpModNormal_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_135, AgradCdfTestFixture, AgradCdfExpModNormal_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_136, AgradCdfTestFixture, AgradCdfExpModNormal_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_137, AgradCdfTestFixture, AgradCdfExpModNormal_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_138, AgradCdfTestFixture, AgradCdfExpModNormal_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_139, AgradCdfTestFixture, AgradCdfExpModNormal_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_140, AgradCdfTestFixture, AgradCdfExpModNormal_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_141, AgradCdfTestFixture, AgradCdfExpModNormal_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_142, AgradCdfTestFixture, AgradCdfExpModNormal_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_143, AgradCdfTestFixture, AgradCdfExpModNormal_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_144, AgradCdfTestFixture, AgradCdfExpModNormal_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_145, AgradCdfTestFixture, AgradCdfExpModNormal_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_146, AgradCdfTestFixture, AgradCdfExpModNormal_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_147, AgradCdfTestFixture, AgradCdfExpModNormal_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_148, AgradCdfTestFixture, AgradCdfExpModNormal_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_149, AgradCdfTestFixture, AgradCdfExpModNormal_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_150, AgradCdfTestFixture, AgradCdfExpModNormal_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_151, AgradCdfTestFixture, AgradCdfExpModNormal_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_152, AgradCdfTestFixture, AgradCdfExpModNormal_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_153, AgradCdfTestFixture, AgradCdfExpModNormal_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_154, AgradCdfTestFixture, AgradCdfExpModNormal_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_155, AgradCdfTestFixture, AgradCdfExpModNormal_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_156, AgradCdfTestFixture, AgradCdfExpModNormal_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_157, AgradCdfTestFixture, AgradCdfExpModNormal_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_158, AgradCdfTestFixture, AgradCdfExpModNormal_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_159, AgradCdfTestFixture, AgradCdfExpModNormal_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_160, AgradCdfTestFixture, AgradCdfExpModNormal_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_161, AgradCdfTestFixture, AgradCdfExpModNormal_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_162, AgradCdfTestFixture, AgradCdfExpModNormal_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_163, AgradCdfTestFixture, AgradCdfExpModNormal_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_164, AgradCdfTestFixture, AgradCdfExpModNormal_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_165, AgradCdfTestFixture, AgradCdfExpModNormal_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_166, AgradCdfTestFixture, AgradCdfExpModNormal_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_167, AgradCdfTestFixture, AgradCdfExpModNormal_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_168, AgradCdfTestFixture, AgradCdfExpModNormal_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_169, AgradCdfTestFixture, AgradCdfExpModNormal_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_170, AgradCdfTestFixture, AgradCdfExpModNormal_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_171, AgradCdfTestFixture, AgradCdfExpModNormal_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_172, AgradCdfTestFixture, AgradCdfExpModNormal_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_173, AgradCdfTestFixture, AgradCdfExpModNormal_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_174, AgradCdfTestFixture, AgradCdfExpModNormal_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_175, AgradCdfTestFixture, AgradCdfExpModNormal_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_176, AgradCdfTestFixture, AgradCdfExpModNormal_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_177, AgradCdfTestFixture, AgradCdfExpModNormal_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_178, AgradCdfTestFixture, AgradCdfExpModNormal_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_179, AgradCdfTestFixture, AgradCdfExpModNormal_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_180, AgradCdfTestFixture, AgradCdfExpModNormal_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_181, AgradCdfTestFixture, AgradCdfExpModNormal_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_182, AgradCdfTestFixture, AgradCdfExpModNormal_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_183, AgradCdfTestFixture, AgradCdfExpModNormal_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_184, AgradCdfTestFixture, AgradCdfExpModNormal_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_185, AgradCdfTestFixture, AgradCdfExpModNormal_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_186, AgradCdfTestFixture, AgradCdfExpModNormal_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_187, AgradCdfTestFixture, AgradCdfExpModNormal_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_188, AgradCdfTestFixture, AgradCdfExpModNormal_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_189, AgradCdfTestFixture, AgradCdfExpModNormal_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_190, AgradCdfTestFixture, AgradCdfExpModNormal_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_191, AgradCdfTestFixture, AgradCdfExpModNormal_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_192, AgradCdfTestFixture, AgradCdfExpModNormal_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_193, AgradCdfTestFixture, AgradCdfExpModNormal_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_194, AgradCdfTestFixture, AgradCdfExpModNormal_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_195, AgradCdfTestFixture, AgradCdfExpModNormal_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_196, AgradCdfTestFixture, AgradCdfExpModNormal_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_197, AgradCdfTestFixture, AgradCdfExpModNormal_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_198, AgradCdfTestFixture, AgradCdfExpModNormal_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_199, AgradCdfTestFixture, AgradCdfExpModNormal_v_199);
+
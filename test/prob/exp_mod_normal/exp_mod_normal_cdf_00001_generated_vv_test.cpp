@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<double, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<double, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<double, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<double, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<double, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<double>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCdfExpModNormal, type_vv_100> AgradCdfExpModNormal_vv_100;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_101> AgradCdfExpModNormal_vv_101;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_102> AgradCdfExpModNormal_vv_102;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_103> AgradCdfExpModNormal_vv_103;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_104> AgradCdfExpModNormal_vv_104;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_105> AgradCdfExpModNormal_vv_105;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_106> AgradCdfExpModNormal_vv_106;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_107> AgradCdfExpModNormal_vv_107;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_108> AgradCdfExpModNormal_vv_108;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_109> AgradCdfExpModNormal_vv_109;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_110> AgradCdfExpModNormal_vv_110;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_111> AgradCdfExpModNormal_vv_111;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_112> AgradCdfExpModNormal_vv_112;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_113> AgradCdfExpModNormal_vv_113;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_114> AgradCdfExpModNormal_vv_114;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_115> AgradCdfExpModNormal_vv_115;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_116> AgradCdfExpModNormal_vv_116;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_117> AgradCdfExpModNormal_vv_117;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_118> AgradCdfExpModNormal_vv_118;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_119> AgradCdfExpModNormal_vv_119;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_120> AgradCdfExpModNormal_vv_120;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_121> AgradCdfExpModNormal_vv_121;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_122> AgradCdfExpModNormal_vv_122;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_123> AgradCdfExpModNormal_vv_123;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_124> AgradCdfExpModNormal_vv_124;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_125> AgradCdfExpModNormal_vv_125;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_126> AgradCdfExpModNormal_vv_126;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_127> AgradCdfExpModNormal_vv_127;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_128> AgradCdfExpModNormal_vv_128;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_129> AgradCdfExpModNormal_vv_129;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_130> AgradCdfExpModNormal_vv_130;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_131> AgradCdfExpModNormal_vv_131;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_132> AgradCdfExpModNormal_vv_132;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_133> AgradCdfExpModNormal_vv_133;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_134> AgradCdfExpModNormal_vv_134;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_135> AgradCdfExpModNormal_vv_135;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_136> AgradCdfExpModNormal_vv_136;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_137> AgradCdfExpModNormal_vv_137;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_138> AgradCdfExpModNormal_vv_138;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_139> AgradCdfExpModNormal_vv_139;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_140> AgradCdfExpModNormal_vv_140;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_141> AgradCdfExpModNormal_vv_141;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_142> AgradCdfExpModNormal_vv_142;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_143> AgradCdfExpModNormal_vv_143;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_144> AgradCdfExpModNormal_vv_144;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_145> AgradCdfExpModNormal_vv_145;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_146> AgradCdfExpModNormal_vv_146;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_147> AgradCdfExpModNormal_vv_147;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_148> AgradCdfExpModNormal_vv_148;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_149> AgradCdfExpModNormal_vv_149;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_150> AgradCdfExpModNormal_vv_150;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_151> AgradCdfExpModNormal_vv_151;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_152> AgradCdfExpModNormal_vv_152;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_153> AgradCdfExpModNormal_vv_153;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_154> AgradCdfExpModNormal_vv_154;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_155> AgradCdfExpModNormal_vv_155;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_156> AgradCdfExpModNormal_vv_156;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_157> AgradCdfExpModNormal_vv_157;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_158> AgradCdfExpModNormal_vv_158;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_159> AgradCdfExpModNormal_vv_159;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_160> AgradCdfExpModNormal_vv_160;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_161> AgradCdfExpModNormal_vv_161;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_162> AgradCdfExpModNormal_vv_162;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_163> AgradCdfExpModNormal_vv_163;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_164> AgradCdfExpModNormal_vv_164;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_165> AgradCdfExpModNormal_vv_165;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_166> AgradCdfExpModNormal_vv_166;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_167> AgradCdfExpModNormal_vv_167;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_168> AgradCdfExpModNormal_vv_168;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_169> AgradCdfExpModNormal_vv_169;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_170> AgradCdfExpModNormal_vv_170;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_171> AgradCdfExpModNormal_vv_171;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_172> AgradCdfExpModNormal_vv_172;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_173> AgradCdfExpModNormal_vv_173;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_174> AgradCdfExpModNormal_vv_174;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_175> AgradCdfExpModNormal_vv_175;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_176> AgradCdfExpModNormal_vv_176;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_177> AgradCdfExpModNormal_vv_177;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_178> AgradCdfExpModNormal_vv_178;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_179> AgradCdfExpModNormal_vv_179;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_180> AgradCdfExpModNormal_vv_180;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_181> AgradCdfExpModNormal_vv_181;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_182> AgradCdfExpModNormal_vv_182;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_183> AgradCdfExpModNormal_vv_183;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_184> AgradCdfExpModNormal_vv_184;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_185> AgradCdfExpModNormal_vv_185;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_186> AgradCdfExpModNormal_vv_186;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_187> AgradCdfExpModNormal_vv_187;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_188> AgradCdfExpModNormal_vv_188;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_189> AgradCdfExpModNormal_vv_189;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_190> AgradCdfExpModNormal_vv_190;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_191> AgradCdfExpModNormal_vv_191;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_192> AgradCdfExpModNormal_vv_192;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_193> AgradCdfExpModNormal_vv_193;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_194> AgradCdfExpModNormal_vv_194;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_195> AgradCdfExpModNormal_vv_195;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_196> AgradCdfExpModNormal_vv_196;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_197> AgradCdfExpModNormal_vv_197;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_198> AgradCdfExpModNormal_vv_198;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_199> AgradCdfExpModNormal_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_100, AgradCdfTestFixture, AgradCdfExpModNormal_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_101, AgradCdfTestFixture, AgradCdfExpModNormal_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_102, AgradCdfTestFixture, AgradCdfExpModNormal_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_103, AgradCdfTestFixture, AgradCdfExpModNormal_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_104, AgradCdfTestFixture, AgradCdfExpModNormal_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_105, AgradCdfTestFixture, AgradCdfExpModNormal_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_106, AgradCdfTestFixture, AgradCdfExpModNormal_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_107, AgradCdfTestFixture, AgradCdfExpModNormal_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_108, AgradCdfTestFixture, AgradCdfExpModNormal_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_109, AgradCdfTestFixture, AgradCdfExpModNormal_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_110, AgradCdfTestFixture, AgradCdfExpModNormal_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_111, AgradCdfTestFixture, AgradCdfExpModNormal_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_112, AgradCdfTestFixture, AgradCdfExpModNormal_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_113, AgradCdfTestFixture, AgradCdfExpModNormal_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_114, AgradCdfTestFixture, AgradCdfExpModNormal_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_115, AgradCdfTestFixture, AgradCdfExpModNormal_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_116, AgradCdfTestFixture, AgradCdfExpModNormal_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_117, AgradCdfTestFixture, AgradCdfExpModNormal_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_118, AgradCdfTestFixture, AgradCdfExpModNormal_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_119, AgradCdfTestFixture, AgradCdfExpModNormal_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_120, AgradCdfTestFixture, AgradCdfExpModNormal_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_121, AgradCdfTestFixture, AgradCdfExpModNormal_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_122, AgradCdfTestFixture, AgradCdfExpModNormal_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_123, AgradCdfTestFixture, AgradCdfExpModNormal_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_124, AgradCdfTestFixture, AgradCdfExpModNormal_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_125, AgradCdfTestFixture, AgradCdfExpModNormal_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_126, AgradCdfTestFixture, AgradCdfExpModNormal_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_127, AgradCdfTestFixture, AgradCdfExpModNormal_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_128, AgradCdfTestFixture, AgradCdfExpModNormal_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_129, AgradCdfTestFixture, AgradCdfExpModNormal_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_130, AgradCdfTestFixture, AgradCdfExpModNormal_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_131, AgradCdfTestFixture, AgradCdfExpModNormal_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_132, AgradCdfTestFixture, AgradCdfExpModNormal_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_133, AgradCdfTestFixture, AgradCdfExpModNormal_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_134, AgradCdfTestFixture, AgradCdfExpModNormal_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_135, AgradCdfTestFixture, AgradCdfExpModNormal_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_136, AgradCdfTestFixture, AgradCdfExpModNormal_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_137, AgradCdfTestFixture, AgradCdfExpModNormal_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_138, AgradCdfTestFixture, AgradCdfExpModNormal_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_139, AgradCdfTestFixture, AgradCdfExpModNormal_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_140, AgradCdfTestFixture, AgradCdfExpModNormal_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_141, AgradCdfTestFixture, AgradCdfExpModNormal_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_142, AgradCdfTestFixture, AgradCdfExpModNormal_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_143, AgradCdfTestFixture, AgradCdfExpModNormal_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_144, AgradCdfTestFixture, AgradCdfExpModNormal_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_145, AgradCdfTestFixture, AgradCdfExpModNormal_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_146, AgradCdfTestFixture, AgradCdfExpModNormal_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_147, AgradCdfTestFixture, AgradCdfExpModNormal_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_148, AgradCdfTestFixture, AgradCdfExpModNormal_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_149, AgradCdfTestFixture, AgradCdfExpModNormal_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_150, AgradCdfTestFixture, AgradCdfExpModNormal_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_151, AgradCdfTestFixture, AgradCdfExpModNormal_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_152, AgradCdfTestFixture, AgradCdfExpModNormal_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_153, AgradCdfTestFixture, AgradCdfExpModNormal_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_154, AgradCdfTestFixture, AgradCdfExpModNormal_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_155, AgradCdfTestFixture, AgradCdfExpModNormal_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_156, AgradCdfTestFixture, AgradCdfExpModNormal_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_157, AgradCdfTestFixture, AgradCdfExpModNormal_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_158, AgradCdfTestFixture, AgradCdfExpModNormal_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_159, AgradCdfTestFixture, AgradCdfExpModNormal_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_160, AgradCdfTestFixture, AgradCdfExpModNormal_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_161, AgradCdfTestFixture, AgradCdfExpModNormal_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_162, AgradCdfTestFixture, AgradCdfExpModNormal_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_163, AgradCdfTestFixture, AgradCdfExpModNormal_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_164, AgradCdfTestFixture, AgradCdfExpModNormal_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_165, AgradCdfTestFixture, AgradCdfExpModNormal_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_166, AgradCdfTestFixture, AgradCdfExpModNormal_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_167, AgradCdfTestFixture, AgradCdfExpModNormal_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_168, AgradCdfTestFixture, AgradCdfExpModNormal_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_169, AgradCdfTestFixture, AgradCdfExpModNormal_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_170, AgradCdfTestFixture, AgradCdfExpModNormal_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_171, AgradCdfTestFixture, AgradCdfExpModNormal_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_172, AgradCdfTestFixture, AgradCdfExpModNormal_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_173, AgradCdfTestFixture, AgradCdfExpModNormal_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_174, AgradCdfTestFixture, AgradCdfExpModNormal_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_175, AgradCdfTestFixture, AgradCdfExpModNormal_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_176, AgradCdfTestFixture, AgradCdfExpModNormal_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_177, AgradCdfTestFixture, AgradCdfExpModNormal_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_178, AgradCdfTestFixture, AgradCdfExpModNormal_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_179, AgradCdfTestFixture, AgradCdfExpModNormal_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_180, AgradCdfTestFixture, AgradCdfExpModNormal_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_181, AgradCdfTestFixture, AgradCdfExpModNormal_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_182, AgradCdfTestFixture, AgradCdfExpModNormal_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_183, AgradCdfTestFixture, AgradCdfExpModNormal_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_184, AgradCdfTestFixture, AgradCdfExpModNormal_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_185, AgradCdfTestFixture, AgradCdfExpModNormal_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_186, AgradCdfTestFixture, AgradCdfExpModNormal_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_187, AgradCdfTestFixture, AgradCdfExpModNormal_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_188, AgradCdfTestFixture, AgradCdfExpModNormal_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_189, AgradCdfTestFixture, AgradCdfExpModNormal_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_190, AgradCdfTestFixture, AgradCdfExpModNormal_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_191, AgradCdfTestFixture, AgradCdfExpModNormal_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_192, AgradCdfTestFixture, AgradCdfExpModNormal_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_193, AgradCdfTestFixture, AgradCdfExpModNormal_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_194, AgradCdfTestFixture, AgradCdfExpModNormal_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_195, AgradCdfTestFixture, AgradCdfExpModNormal_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_196, AgradCdfTestFixture, AgradCdfExpModNormal_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_197, AgradCdfTestFixture, AgradCdfExpModNormal_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_198, AgradCdfTestFixture, AgradCdfExpModNormal_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_199, AgradCdfTestFixture, AgradCdfExpModNormal_vv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_200> AgradCdfExpModNormal_ffv_200;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_201> AgradCdfExpModNormal_ffv_201;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_202> AgradCdfExpModNormal_ffv_202;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_203> AgradCdfExpModNormal_ffv_203;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_204> AgradCdfExpModNormal_ffv_204;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_205> AgradCdfExpModNormal_ffv_205;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_206> AgradCdfExpModNormal_ffv_206;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_207> AgradCdfExpModNormal_ffv_207;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_208> AgradCdfExpModNormal_ffv_208;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_209> AgradCdfExpModNormal_ffv_209;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_210> AgradCdfExpModNormal_ffv_210;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_211> AgradCdfExpModNormal_ffv_211;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_212> AgradCdfExpModNormal_ffv_212;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_213> AgradCdfExpModNormal_ffv_213;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_214> AgradCdfExpModNormal_ffv_214;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_215> AgradCdfExpModNormal_ffv_215;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_216> AgradCdfExpModNormal_ffv_216;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_217> AgradCdfExpModNormal_ffv_217;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_218> AgradCdfExpModNormal_ffv_218;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_219> AgradCdfExpModNormal_ffv_219;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_220> AgradCdfExpModNormal_ffv_220;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_221> AgradCdfExpModNormal_ffv_221;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_222> AgradCdfExpModNormal_ffv_222;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_223> AgradCdfExpModNormal_ffv_223;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_224> AgradCdfExpModNormal_ffv_224;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_225> AgradCdfExpModNormal_ffv_225;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_226> AgradCdfExpModNormal_ffv_226;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_227> AgradCdfExpModNormal_ffv_227;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_228> AgradCdfExpModNormal_ffv_228;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_229> AgradCdfExpModNormal_ffv_229;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_230> AgradCdfExpModNormal_ffv_230;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_231> AgradCdfExpModNormal_ffv_231;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_232> AgradCdfExpModNormal_ffv_232;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_233> AgradCdfExpModNormal_ffv_233;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_234> AgradCdfExpModNormal_ffv_234;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_235> AgradCdfExpModNormal_ffv_235;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_236> AgradCdfExpModNormal_ffv_236;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_237> AgradCdfExpModNormal_ffv_237;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_238> AgradCdfExpModNormal_ffv_238;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_239> AgradCdfExpModNormal_ffv_239;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_240> AgradCdfExpModNormal_ffv_240;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_241> AgradCdfExpModNormal_ffv_241;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_242> AgradCdfExpModNormal_ffv_242;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_243> AgradCdfExpModNormal_ffv_243;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_244> AgradCdfExpModNormal_ffv_244;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_245> AgradCdfExpModNormal_ffv_245;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_246> AgradCdfExpModNormal_ffv_246;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_247> AgradCdfExpModNormal_ffv_247;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_248> AgradCdfExpModNormal_ffv_248;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_249> AgradCdfExpModNormal_ffv_249;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_250> AgradCdfExpModNormal_ffv_250;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_251> AgradCdfExpModNormal_ffv_251;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_252> AgradCdfExpModNormal_ffv_252;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_253> AgradCdfExpModNormal_ffv_253;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_254> AgradCdfExpModNormal_ffv_254;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_255> AgradCdfExpModNormal_ffv_255;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_256> AgradCdfExpModNormal_ffv_256;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_257> AgradCdfExpModNormal_ffv_257;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_258> AgradCdfExpModNormal_ffv_258;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_259> AgradCdfExpModNormal_ffv_259;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_260> AgradCdfExpModNormal_ffv_260;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_261> AgradCdfExpModNormal_ffv_261;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_262> AgradCdfExpModNormal_ffv_262;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_263> AgradCdfExpModNormal_ffv_263;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_264> AgradCdfExpModNormal_ffv_264;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_265> AgradCdfExpModNormal_ffv_265;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_266> AgradCdfExpModNormal_ffv_266;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_267> AgradCdfExpModNormal_ffv_267;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_268> AgradCdfExpModNormal_ffv_268;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_269> AgradCdfExpModNormal_ffv_269;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_270> AgradCdfExpModNormal_ffv_270;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_271> AgradCdfExpModNormal_ffv_271;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_272> AgradCdfExpModNormal_ffv_272;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_273> AgradCdfExpModNormal_ffv_273;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_274> AgradCdfExpModNormal_ffv_274;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_275> AgradCdfExpModNormal_ffv_275;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_276> AgradCdfExpModNormal_ffv_276;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_277> AgradCdfExpModNormal_ffv_277;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_278> AgradCdfExpModNormal_ffv_278;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_279> AgradCdfExpModNormal_ffv_279;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_280> AgradCdfExpModNormal_ffv_280;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_281> AgradCdfExpModNormal_ffv_281;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_282> AgradCdfExpModNormal_ffv_282;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_283> AgradCdfExpModNormal_ffv_283;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_284> AgradCdfExpModNormal_ffv_284;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_285> AgradCdfExpModNormal_ffv_285;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_286> AgradCdfExpModNormal_ffv_286;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_287> AgradCdfExpModNormal_ffv_287;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_288> AgradCdfExpModNormal_ffv_288;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_289> AgradCdfExpModNormal_ffv_289;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_290> AgradCdfExpModNormal_ffv_290;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_291> AgradCdfExpModNormal_ffv_291;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_292> AgradCdfExpModNormal_ffv_292;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_293> AgradCdfExpModNormal_ffv_293;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_294> AgradCdfExpModNormal_ffv_294;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_295> AgradCdfExpModNormal_ffv_295;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_296> AgradCdfExpModNormal_ffv_296;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_297> AgradCdfExpModNormal_ffv_297;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_298> AgradCdfExpModNormal_ffv_298;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_299> AgradCdfExpModNormal_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_200, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_201, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_202, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_203, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_204, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_205, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_206, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_207, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_208, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_209, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_210, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_211, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_212, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_213, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_214, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_215, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_216, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_217, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_218, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_219, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_220, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_221, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_222, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_223, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_224, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_225, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_226, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_227, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_228, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_229, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_230, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_231, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_232, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_233, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_234, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_235, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_236, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_237, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_238, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_239, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_240, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_241, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_242, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_243, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_244, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_245, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_246, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_247, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_248, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_249, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_250, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_251, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_252, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_253, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_254, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_255, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_256, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_257, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_258, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_259, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_260, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_261, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_262, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_263, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_264, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_265, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_266, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_267, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_268, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_269, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_270, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_271, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_272, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_273, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_274, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_275, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_276, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_277, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_278, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_279, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_280, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_281, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_282, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_283, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_284, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_285, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_286, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_287, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_288, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_289, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_290, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_291, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_292, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_293, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_294, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_295, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_296, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_297, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_298, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_299, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_299);
+
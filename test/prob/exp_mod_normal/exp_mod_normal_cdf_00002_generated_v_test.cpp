@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<double>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<double>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCdfExpModNormal, type_v_200> AgradCdfExpModNormal_v_200;
+typedef std::tuple<AgradCdfExpModNormal, type_v_201> AgradCdfExpModNormal_v_201;
+typedef std::tuple<AgradCdfExpModNormal, type_v_202> AgradCdfExpModNormal_v_202;
+typedef std::tuple<AgradCdfExpModNormal, type_v_203> AgradCdfExpModNormal_v_203;
+typedef std::tuple<AgradCdfExpModNormal, type_v_204> AgradCdfExpModNormal_v_204;
+typedef std::tuple<AgradCdfExpModNormal, type_v_205> AgradCdfExpModNormal_v_205;
+typedef std::tuple<AgradCdfExpModNormal, type_v_206> AgradCdfExpModNormal_v_206;
+typedef std::tuple<AgradCdfExpModNormal, type_v_207> AgradCdfExpModNormal_v_207;
+typedef std::tuple<AgradCdfExpModNormal, type_v_208> AgradCdfExpModNormal_v_208;
+typedef std::tuple<AgradCdfExpModNormal, type_v_209> AgradCdfExpModNormal_v_209;
+typedef std::tuple<AgradCdfExpModNormal, type_v_210> AgradCdfExpModNormal_v_210;
+typedef std::tuple<AgradCdfExpModNormal, type_v_211> AgradCdfExpModNormal_v_211;
+typedef std::tuple<AgradCdfExpModNormal, type_v_212> AgradCdfExpModNormal_v_212;
+typedef std::tuple<AgradCdfExpModNormal, type_v_213> AgradCdfExpModNormal_v_213;
+typedef std::tuple<AgradCdfExpModNormal, type_v_214> AgradCdfExpModNormal_v_214;
+typedef std::tuple<AgradCdfExpModNormal, type_v_215> AgradCdfExpModNormal_v_215;
+typedef std::tuple<AgradCdfExpModNormal, type_v_216> AgradCdfExpModNormal_v_216;
+typedef std::tuple<AgradCdfExpModNormal, type_v_217> AgradCdfExpModNormal_v_217;
+typedef std::tuple<AgradCdfExpModNormal, type_v_218> AgradCdfExpModNormal_v_218;
+typedef std::tuple<AgradCdfExpModNormal, type_v_219> AgradCdfExpModNormal_v_219;
+typedef std::tuple<AgradCdfExpModNormal, type_v_220> AgradCdfExpModNormal_v_220;
+typedef std::tuple<AgradCdfExpModNormal, type_v_221> AgradCdfExpModNormal_v_221;
+typedef std::tuple<AgradCdfExpModNormal, type_v_222> AgradCdfExpModNormal_v_222;
+typedef std::tuple<AgradCdfExpModNormal, type_v_223> AgradCdfExpModNormal_v_223;
+typedef std::tuple<AgradCdfExpModNormal, type_v_224> AgradCdfExpModNormal_v_224;
+typedef std::tuple<AgradCdfExpModNormal, type_v_225> AgradCdfExpModNormal_v_225;
+typedef std::tuple<AgradCdfExpModNormal, type_v_226> AgradCdfExpModNormal_v_226;
+typedef std::tuple<AgradCdfExpModNormal, type_v_227> AgradCdfExpModNormal_v_227;
+typedef std::tuple<AgradCdfExpModNormal, type_v_228> AgradCdfExpModNormal_v_228;
+typedef std::tuple<AgradCdfExpModNormal, type_v_229> AgradCdfExpModNormal_v_229;
+typedef std::tuple<AgradCdfExpModNormal, type_v_230> AgradCdfExpModNormal_v_230;
+typedef std::tuple<AgradCdfExpModNormal, type_v_231> AgradCdfExpModNormal_v_231;
+typedef std::tuple<AgradCdfExpModNormal, type_v_232> AgradCdfExpModNormal_v_232;
+typedef std::tuple<AgradCdfExpModNormal, type_v_233> AgradCdfExpModNormal_v_233;
+typedef std::tuple<AgradCdfExpModNormal, type_v_234> AgradCdfExpModNormal_v_234;
+typedef std::tuple<AgradCdfExpModNormal, type_v_235> AgradCdfExpModNormal_v_235;
+typedef std::tuple<AgradCdfExpModNormal, type_v_236> AgradCdfExpModNormal_v_236;
+typedef std::tuple<AgradCdfExpModNormal, type_v_237> AgradCdfExpModNormal_v_237;
+typedef std::tuple<AgradCdfExpModNormal, type_v_238> AgradCdfExpModNormal_v_238;
+typedef std::tuple<AgradCdfExpModNormal, type_v_239> AgradCdfExpModNormal_v_239;
+typedef std::tuple<AgradCdfExpModNormal, type_v_240> AgradCdfExpModNormal_v_240;
+typedef std::tuple<AgradCdfExpModNormal, type_v_241> AgradCdfExpModNormal_v_241;
+typedef std::tuple<AgradCdfExpModNormal, type_v_242> AgradCdfExpModNormal_v_242;
+typedef std::tuple<AgradCdfExpModNormal, type_v_243> AgradCdfExpModNormal_v_243;
+typedef std::tuple<AgradCdfExpModNormal, type_v_244> AgradCdfExpModNormal_v_244;
+typedef std::tuple<AgradCdfExpModNormal, type_v_245> AgradCdfExpModNormal_v_245;
+typedef std::tuple<AgradCdfExpModNormal, type_v_246> AgradCdfExpModNormal_v_246;
+typedef std::tuple<AgradCdfExpModNormal, type_v_247> AgradCdfExpModNormal_v_247;
+typedef std::tuple<AgradCdfExpModNormal, type_v_248> AgradCdfExpModNormal_v_248;
+typedef std::tuple<AgradCdfExpModNormal, type_v_249> AgradCdfExpModNormal_v_249;
+typedef std::tuple<AgradCdfExpModNormal, type_v_250> AgradCdfExpModNormal_v_250;
+typedef std::tuple<AgradCdfExpModNormal, type_v_251> AgradCdfExpModNormal_v_251;
+typedef std::tuple<AgradCdfExpModNormal, type_v_252> AgradCdfExpModNormal_v_252;
+typedef std::tuple<AgradCdfExpModNormal, type_v_253> AgradCdfExpModNormal_v_253;
+typedef std::tuple<AgradCdfExpModNormal, type_v_254> AgradCdfExpModNormal_v_254;
+typedef std::tuple<AgradCdfExpModNormal, type_v_255> AgradCdfExpModNormal_v_255;
+typedef std::tuple<AgradCdfExpModNormal, type_v_256> AgradCdfExpModNormal_v_256;
+typedef std::tuple<AgradCdfExpModNormal, type_v_257> AgradCdfExpModNormal_v_257;
+typedef std::tuple<AgradCdfExpModNormal, type_v_258> AgradCdfExpModNormal_v_258;
+typedef std::tuple<AgradCdfExpModNormal, type_v_259> AgradCdfExpModNormal_v_259;
+typedef std::tuple<AgradCdfExpModNormal, type_v_260> AgradCdfExpModNormal_v_260;
+typedef std::tuple<AgradCdfExpModNormal, type_v_261> AgradCdfExpModNormal_v_261;
+typedef std::tuple<AgradCdfExpModNormal, type_v_262> AgradCdfExpModNormal_v_262;
+typedef std::tuple<AgradCdfExpModNormal, type_v_263> AgradCdfExpModNormal_v_263;
+typedef std::tuple<AgradCdfExpModNormal, type_v_264> AgradCdfExpModNormal_v_264;
+typedef std::tuple<AgradCdfExpModNormal, type_v_265> AgradCdfExpModNormal_v_265;
+typedef std::tuple<AgradCdfExpModNormal, type_v_266> AgradCdfExpModNormal_v_266;
+typedef std::tuple<AgradCdfExpModNormal, type_v_267> AgradCdfExpModNormal_v_267;
+typedef std::tuple<AgradCdfExpModNormal, type_v_268> AgradCdfExpModNormal_v_268;
+typedef std::tuple<AgradCdfExpModNormal, type_v_269> AgradCdfExpModNormal_v_269;
+typedef std::tuple<AgradCdfExpModNormal, type_v_270> AgradCdfExpModNormal_v_270;
+typedef std::tuple<AgradCdfExpModNormal, type_v_271> AgradCdfExpModNormal_v_271;
+typedef std::tuple<AgradCdfExpModNormal, type_v_272> AgradCdfExpModNormal_v_272;
+typedef std::tuple<AgradCdfExpModNormal, type_v_273> AgradCdfExpModNormal_v_273;
+typedef std::tuple<AgradCdfExpModNormal, type_v_274> AgradCdfExpModNormal_v_274;
+typedef std::tuple<AgradCdfExpModNormal, type_v_275> AgradCdfExpModNormal_v_275;
+typedef std::tuple<AgradCdfExpModNormal, type_v_276> AgradCdfExpModNormal_v_276;
+typedef std::tuple<AgradCdfExpModNormal, type_v_277> AgradCdfExpModNormal_v_277;
+typedef std::tuple<AgradCdfExpModNormal, type_v_278> AgradCdfExpModNormal_v_278;
+typedef std::tuple<AgradCdfExpModNormal, type_v_279> AgradCdfExpModNormal_v_279;
+typedef std::tuple<AgradCdfExpModNormal, type_v_280> AgradCdfExpModNormal_v_280;
+typedef std::tuple<AgradCdfExpModNormal, type_v_281> AgradCdfExpModNormal_v_281;
+typedef std::tuple<AgradCdfExpModNormal, type_v_282> AgradCdfExpModNormal_v_282;
+typedef std::tuple<AgradCdfExpModNormal, type_v_283> AgradCdfExpModNormal_v_283;
+typedef std::tuple<AgradCdfExpModNormal, type_v_284> AgradCdfExpModNormal_v_284;
+typedef std::tuple<AgradCdfExpModNormal, type_v_285> AgradCdfExpModNormal_v_285;
+typedef std::tuple<AgradCdfExpModNormal, type_v_286> AgradCdfExpModNormal_v_286;
+typedef std::tuple<AgradCdfExpModNormal, type_v_287> AgradCdfExpModNormal_v_287;
+typedef std::tuple<AgradCdfExpModNormal, type_v_288> AgradCdfExpModNormal_v_288;
+typedef std::tuple<AgradCdfExpModNormal, type_v_289> AgradCdfExpModNormal_v_289;
+typedef std::tuple<AgradCdfExpModNormal, type_v_290> AgradCdfExpModNormal_v_290;
+typedef std::tuple<AgradCdfExpModNormal, type_v_291> AgradCdfExpModNormal_v_291;
+typedef std::tuple<AgradCdfExpModNormal, type_v_292> AgradCdfExpModNormal_v_292;
+typedef std::tuple<AgradCdfExpModNormal, type_v_293> AgradCdfExpModNormal_v_293;
+typedef std::tuple<AgradCdfExpModNormal, type_v_294> AgradCdfExpModNormal_v_294;
+typedef std::tuple<AgradCdfExpModNormal, type_v_295> AgradCdfExpModNormal_v_295;
+typedef std::tuple<AgradCdfExpModNormal, type_v_296> AgradCdfExpModNormal_v_296;
+typedef std::tuple<AgradCdfExpModNormal, type_v_297> AgradCdfExpModNormal_v_297;
+typedef std::tuple<AgradCdfExpModNormal, type_v_298> AgradCdfExpModNormal_v_298;
+typedef std::tuple<AgradCdfExpModNormal, type_v_299> AgradCdfExpModNormal_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_200, AgradCdfTestFixture, AgradCdfExpModNormal_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_201, AgradCdfTestFixture, AgradCdfExpModNormal_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_202, AgradCdfTestFixture, AgradCdfExpModNormal_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_203, AgradCdfTestFixture, AgradCdfExpModNormal_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_204, AgradCdfTestFixture, AgradCdfExpModNormal_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_205, AgradCdfTestFixture, AgradCdfExpModNormal_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_206, AgradCdfTestFixture, AgradCdfExpModNormal_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_207, AgradCdfTestFixture, AgradCdfExpModNormal_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_208, AgradCdfTestFixture, AgradCdfExpModNormal_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_209, AgradCdfTestFixture, AgradCdfExpModNormal_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_210, AgradCdfTestFixture, AgradCdfExpModNormal_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_211, AgradCdfTestFixture, AgradCdfExpModNormal_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_212, AgradCdfTestFixture, AgradCdfExpModNormal_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_213, AgradCdfTestFixture, AgradCdfExpModNormal_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_214, AgradCdfTestFixture, AgradCdfExpModNormal_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_215, AgradCdfTestFixture, AgradCdfExpModNormal_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_216, AgradCdfTestFixture, AgradCdfExpModNormal_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_217, AgradCdfTestFixture, AgradCdfExpModNormal_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_218, AgradCdfTestFixture, AgradCdfExpModNormal_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_219, AgradCdfTestFixture, AgradCdfExpModNormal_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_220, AgradCdfTestFixture, AgradCdfExpModNormal_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_221, AgradCdfTestFixture, AgradCdfExpModNormal_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_222, AgradCdfTestFixture, AgradCdfExpModNormal_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_223, AgradCdfTestFixture, AgradCdfExpModNormal_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_224, AgradCdfTestFixture, AgradCdfExpModNormal_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_225, AgradCdfTestFixture, AgradCdfExpModNormal_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_226, AgradCdfTestFixture, AgradCdfExpModNormal_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_227, AgradCdfTestFixture, AgradCdfExpModNormal_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_228, AgradCdfTestFixture, AgradCdfExpModNormal_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_229, AgradCdfTestFixture, AgradCdfExpModNormal_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_230, AgradCdfTestFixture, AgradCdfExpModNormal_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_231, AgradCdfTestFixture, AgradCdfExpModNormal_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_232, AgradCdfTestFixture, AgradCdfExpModNormal_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_233, AgradCdfTestFixture, AgradCdfExpModNormal_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_234, AgradCdfTestFixture, AgradCdfExpModNormal_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_235, AgradCdfTestFixture, AgradCdfExpModNormal_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_236, AgradCdfTestFixture, AgradCdfExpModNormal_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_237, AgradCdfTestFixture, AgradCdfExpModNormal_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_238, AgradCdfTestFixture, AgradCdfExpModNormal_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_239, AgradCdfTestFixture, AgradCdfExpModNormal_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_240, AgradCdfTestFixture, AgradCdfExpModNormal_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_241, AgradCdfTestFixture, AgradCdfExpModNormal_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_242, AgradCdfTestFixture, AgradCdfExpModNormal_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_243, AgradCdfTestFixture, AgradCdfExpModNormal_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_244, AgradCdfTestFixture, AgradCdfExpModNormal_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_245, AgradCdfTestFixture, AgradCdfExpModNormal_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_246, AgradCdfTestFixture, AgradCdfExpModNormal_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_247, AgradCdfTestFixture, AgradCdfExpModNormal_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_248, AgradCdfTestFixture, AgradCdfExpModNormal_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_249, AgradCdfTestFixture, AgradCdfExpModNormal_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_250, AgradCdfTestFixture, AgradCdfExpModNormal_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_251, AgradCdfTestFixture, AgradCdfExpModNormal_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_252, AgradCdfTestFixture, AgradCdfExpModNormal_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_253, AgradCdfTestFixture, AgradCdfExpModNormal_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_254, AgradCdfTestFixture, AgradCdfExpModNormal_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_255, AgradCdfTestFixture, AgradCdfExpModNormal_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_256, AgradCdfTestFixture, AgradCdfExpModNormal_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_257, AgradCdfTestFixture, AgradCdfExpModNormal_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_258, AgradCdfTestFixture, AgradCdfExpModNormal_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_259, AgradCdfTestFixture, AgradCdfExpModNormal_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_260, AgradCdfTestFixture, AgradCdfExpModNormal_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_261, AgradCdfTestFixture, AgradCdfExpModNormal_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_262, AgradCdfTestFixture, AgradCdfExpModNormal_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_263, AgradCdfTestFixture, AgradCdfExpModNormal_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_264, AgradCdfTestFixture, AgradCdfExpModNormal_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_265, AgradCdfTestFixture, AgradCdfExpModNormal_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_266, AgradCdfTestFixture, AgradCdfExpModNormal_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_267, AgradCdfTestFixture, AgradCdfExpModNormal_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_268, AgradCdfTestFixture, AgradCdfExpModNormal_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_269, AgradCdfTestFixture, AgradCdfExpModNormal_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_270, AgradCdfTestFixture, AgradCdfExpModNormal_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_271, AgradCdfTestFixture, AgradCdfExpModNormal_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_272, AgradCdfTestFixture, AgradCdfExpModNormal_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_273, AgradCdfTestFixture, AgradCdfExpModNormal_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_274, AgradCdfTestFixture, AgradCdfExpModNormal_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_275, AgradCdfTestFixture, AgradCdfExpModNormal_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_276, AgradCdfTestFixture, AgradCdfExpModNormal_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_277, AgradCdfTestFixture, AgradCdfExpModNormal_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_278, AgradCdfTestFixture, AgradCdfExpModNormal_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_279, AgradCdfTestFixture, AgradCdfExpModNormal_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_280, AgradCdfTestFixture, AgradCdfExpModNormal_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_281, AgradCdfTestFixture, AgradCdfExpModNormal_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_282, AgradCdfTestFixture, AgradCdfExpModNormal_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_283, AgradCdfTestFixture, AgradCdfExpModNormal_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_284, AgradCdfTestFixture, AgradCdfExpModNormal_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_285, AgradCdfTestFixture, AgradCdfExpModNormal_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_286, AgradCdfTestFixture, AgradCdfExpModNormal_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_287, AgradCdfTestFixture, AgradCdfExpModNormal_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_288, AgradCdfTestFixture, AgradCdfExpModNormal_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_289, AgradCdfTestFixture, AgradCdfExpModNormal_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_290, AgradCdfTestFixture, AgradCdfExpModNormal_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_291, AgradCdfTestFixture, AgradCdfExpModNormal_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_292, AgradCdfTestFixture, AgradCdfExpModNormal_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_293, AgradCdfTestFixture, AgradCdfExpModNormal_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_294, AgradCdfTestFixture, AgradCdfExpModNormal_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_295, AgradCdfTestFixture, AgradCdfExpModNormal_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_296, AgradCdfTestFixture, AgradCdfExpModNormal_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_297, AgradCdfTestFixture, AgradCdfExpModNormal_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_298, AgradCdfTestFixture, AgradCdfExpModNormal_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_299, AgradCdfTestFixture, AgradCdfExpModNormal_v_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<double>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<double>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<double>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradCdfExpModNormal, type_vv_200> AgradCdfExpModNormal_vv_200;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_201> AgradCdfExpModNormal_vv_201;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_202> AgradCdfExpModNormal_vv_202;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_203> AgradCdfExpModNormal_vv_203;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_204> AgradCdfExpModNormal_vv_204;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_205> AgradCdfExpModNormal_vv_205;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_206> AgradCdfExpModNormal_vv_206;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_207> AgradCdfExpModNormal_vv_207;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_208> AgradCdfExpModNormal_vv_208;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_209> AgradCdfExpModNormal_vv_209;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_210> AgradCdfExpModNormal_vv_210;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_211> AgradCdfExpModNormal_vv_211;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_212> AgradCdfExpModNormal_vv_212;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_213> AgradCdfExpModNormal_vv_213;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_214> AgradCdfExpModNormal_vv_214;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_215> AgradCdfExpModNormal_vv_215;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_216> AgradCdfExpModNormal_vv_216;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_217> AgradCdfExpModNormal_vv_217;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_218> AgradCdfExpModNormal_vv_218;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_219> AgradCdfExpModNormal_vv_219;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_220> AgradCdfExpModNormal_vv_220;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_221> AgradCdfExpModNormal_vv_221;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_222> AgradCdfExpModNormal_vv_222;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_223> AgradCdfExpModNormal_vv_223;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_224> AgradCdfExpModNormal_vv_224;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_225> AgradCdfExpModNormal_vv_225;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_226> AgradCdfExpModNormal_vv_226;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_227> AgradCdfExpModNormal_vv_227;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_228> AgradCdfExpModNormal_vv_228;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_229> AgradCdfExpModNormal_vv_229;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_230> AgradCdfExpModNormal_vv_230;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_231> AgradCdfExpModNormal_vv_231;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_232> AgradCdfExpModNormal_vv_232;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_233> AgradCdfExpModNormal_vv_233;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_234> AgradCdfExpModNormal_vv_234;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_235> AgradCdfExpModNormal_vv_235;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_236> AgradCdfExpModNormal_vv_236;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_237> AgradCdfExpModNormal_vv_237;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_238> AgradCdfExpModNormal_vv_238;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_239> AgradCdfExpModNormal_vv_239;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_240> AgradCdfExpModNormal_vv_240;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_241> AgradCdfExpModNormal_vv_241;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_242> AgradCdfExpModNormal_vv_242;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_243> AgradCdfExpModNormal_vv_243;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_244> AgradCdfExpModNormal_vv_244;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_245> AgradCdfExpModNormal_vv_245;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_246> AgradCdfExpModNormal_vv_246;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_247> AgradCdfExpModNormal_vv_247;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_248> AgradCdfExpModNormal_vv_248;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_249> AgradCdfExpModNormal_vv_249;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_250> AgradCdfExpModNormal_vv_250;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_251> AgradCdfExpModNormal_vv_251;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_252> AgradCdfExpModNormal_vv_252;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_253> AgradCdfExpModNormal_vv_253;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_254> AgradCdfExpModNormal_vv_254;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_255> AgradCdfExpModNormal_vv_255;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_256> AgradCdfExpModNormal_vv_256;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_257> AgradCdfExpModNormal_vv_257;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_258> AgradCdfExpModNormal_vv_258;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_259> AgradCdfExpModNormal_vv_259;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_260> AgradCdfExpModNormal_vv_260;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_261> AgradCdfExpModNormal_vv_261;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_262> AgradCdfExpModNormal_vv_262;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_263> AgradCdfExpModNormal_vv_263;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_264> AgradCdfExpModNormal_vv_264;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_265> AgradCdfExpModNormal_vv_265;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_266> AgradCdfExpModNormal_vv_266;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_267> AgradCdfExpModNormal_vv_267;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_268> AgradCdfExpModNormal_vv_268;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_269> AgradCdfExpModNormal_vv_269;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_270> AgradCdfExpModNormal_vv_270;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_271> AgradCdfExpModNormal_vv_271;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_272> AgradCdfExpModNormal_vv_272;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_273> AgradCdfExpModNormal_vv_273;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_274> AgradCdfExpModNormal_vv_274;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_275> AgradCdfExpModNormal_vv_275;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_276> AgradCdfExpModNormal_vv_276;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_277> AgradCdfExpModNormal_vv_277;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_278> AgradCdfExpModNormal_vv_278;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_279> AgradCdfExpModNormal_vv_279;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_280> AgradCdfExpModNormal_vv_280;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_281> AgradCdfExpModNormal_vv_281;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_282> AgradCdfExpModNormal_vv_282;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_283> AgradCdfExpModNormal_vv_283;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_284> AgradCdfExpModNormal_vv_284;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_285> AgradCdfExpModNormal_vv_285;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_286> AgradCdfExpModNormal_vv_286;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_287> AgradCdfExpModNormal_vv_287;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_288> AgradCdfExpModNormal_vv_288;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_289> AgradCdfExpModNormal_vv_289;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_290> AgradCdfExpModNormal_vv_290;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_291> AgradCdfExpModNormal_vv_291;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_292> AgradCdfExpModNormal_vv_292;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_293> AgradCdfExpModNormal_vv_293;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_294> AgradCdfExpModNormal_vv_294;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_295> AgradCdfExpModNormal_vv_295;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_296> AgradCdfExpModNormal_vv_296;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_297> AgradCdfExpModNormal_vv_297;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_298> AgradCdfExpModNormal_vv_298;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_299> AgradCdfExpModNormal_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_200, AgradCdfTestFixture, AgradCdfExpModNormal_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_201, AgradCdfTestFixture, AgradCdfExpModNormal_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_202, AgradCdfTestFixture, AgradCdfExpModNormal_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_203, AgradCdfTestFixture, AgradCdfExpModNormal_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_204, AgradCdfTestFixture, AgradCdfExpModNormal_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_205, AgradCdfTestFixture, AgradCdfExpModNormal_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_206, AgradCdfTestFixture, AgradCdfExpModNormal_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_207, AgradCdfTestFixture, AgradCdfExpModNormal_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_208, AgradCdfTestFixture, AgradCdfExpModNormal_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_209, AgradCdfTestFixture, AgradCdfExpModNormal_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_210, AgradCdfTestFixture, AgradCdfExpModNormal_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_211, AgradCdfTestFixture, AgradCdfExpModNormal_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_212, AgradCdfTestFixture, AgradCdfExpModNormal_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_213, AgradCdfTestFixture, AgradCdfExpModNormal_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_214, AgradCdfTestFixture, AgradCdfExpModNormal_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_215, AgradCdfTestFixture, AgradCdfExpModNormal_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_216, AgradCdfTestFixture, AgradCdfExpModNormal_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_217, AgradCdfTestFixture, AgradCdfExpModNormal_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_218, AgradCdfTestFixture, AgradCdfExpModNormal_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_219, AgradCdfTestFixture, AgradCdfExpModNormal_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_220, AgradCdfTestFixture, AgradCdfExpModNormal_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_221, AgradCdfTestFixture, AgradCdfExpModNormal_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_222, AgradCdfTestFixture, AgradCdfExpModNormal_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_223, AgradCdfTestFixture, AgradCdfExpModNormal_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_224, AgradCdfTestFixture, AgradCdfExpModNormal_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_225, AgradCdfTestFixture, AgradCdfExpModNormal_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_226, AgradCdfTestFixture, AgradCdfExpModNormal_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_227, AgradCdfTestFixture, AgradCdfExpModNormal_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_228, AgradCdfTestFixture, AgradCdfExpModNormal_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_229, AgradCdfTestFixture, AgradCdfExpModNormal_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_230, AgradCdfTestFixture, AgradCdfExpModNormal_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_231, AgradCdfTestFixture, AgradCdfExpModNormal_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_232, AgradCdfTestFixture, AgradCdfExpModNormal_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_233, AgradCdfTestFixture, AgradCdfExpModNormal_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_234, AgradCdfTestFixture, AgradCdfExpModNormal_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_235, AgradCdfTestFixture, AgradCdfExpModNormal_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_236, AgradCdfTestFixture, AgradCdfExpModNormal_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_237, AgradCdfTestFixture, AgradCdfExpModNormal_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_238, AgradCdfTestFixture, AgradCdfExpModNormal_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_239, AgradCdfTestFixture, AgradCdfExpModNormal_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_240, AgradCdfTestFixture, AgradCdfExpModNormal_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_241, AgradCdfTestFixture, AgradCdfExpModNormal_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_242, AgradCdfTestFixture, AgradCdfExpModNormal_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_243, AgradCdfTestFixture, AgradCdfExpModNormal_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_244, AgradCdfTestFixture, AgradCdfExpModNormal_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_245, AgradCdfTestFixture, AgradCdfExpModNormal_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_246, AgradCdfTestFixture, AgradCdfExpModNormal_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_247, AgradCdfTestFixture, AgradCdfExpModNormal_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_248, AgradCdfTestFixture, AgradCdfExpModNormal_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_249, AgradCdfTestFixture, AgradCdfExpModNormal_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_250, AgradCdfTestFixture, AgradCdfExpModNormal_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_251, AgradCdfTestFixture, AgradCdfExpModNormal_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_252, AgradCdfTestFixture, AgradCdfExpModNormal_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_253, AgradCdfTestFixture, AgradCdfExpModNormal_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_254, AgradCdfTestFixture, AgradCdfExpModNormal_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_255, AgradCdfTestFixture, AgradCdfExpModNormal_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_256, AgradCdfTestFixture, AgradCdfExpModNormal_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_257, AgradCdfTestFixture, AgradCdfExpModNormal_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_258, AgradCdfTestFixture, AgradCdfExpModNormal_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_259, AgradCdfTestFixture, AgradCdfExpModNormal_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_260, AgradCdfTestFixture, AgradCdfExpModNormal_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_261, AgradCdfTestFixture, AgradCdfExpModNormal_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_262, AgradCdfTestFixture, AgradCdfExpModNormal_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_263, AgradCdfTestFixture, AgradCdfExpModNormal_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_264, AgradCdfTestFixture, AgradCdfExpModNormal_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_265, AgradCdfTestFixture, AgradCdfExpModNormal_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_266, AgradCdfTestFixture, AgradCdfExpModNormal_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_267, AgradCdfTestFixture, AgradCdfExpModNormal_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_268, AgradCdfTestFixture, AgradCdfExpModNormal_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_269, AgradCdfTestFixture, AgradCdfExpModNormal_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_270, AgradCdfTestFixture, AgradCdfExpModNormal_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_271, AgradCdfTestFixture, AgradCdfExpModNormal_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_272, AgradCdfTestFixture, AgradCdfExpModNormal_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_273, AgradCdfTestFixture, AgradCdfExpModNormal_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_274, AgradCdfTestFixture, AgradCdfExpModNormal_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_275, AgradCdfTestFixture, AgradCdfExpModNormal_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_276, AgradCdfTestFixture, AgradCdfExpModNormal_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_277, AgradCdfTestFixture, AgradCdfExpModNormal_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_278, AgradCdfTestFixture, AgradCdfExpModNormal_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_279, AgradCdfTestFixture, AgradCdfExpModNormal_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_280, AgradCdfTestFixture, AgradCdfExpModNormal_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_281, AgradCdfTestFixture, AgradCdfExpModNormal_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_282, AgradCdfTestFixture, AgradCdfExpModNormal_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_283, AgradCdfTestFixture, AgradCdfExpModNormal_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_284, AgradCdfTestFixture, AgradCdfExpModNormal_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_285, AgradCdfTestFixture, AgradCdfExpModNormal_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_286, AgradCdfTestFixture, AgradCdfExpModNormal_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_287, AgradCdfTestFixture, AgradCdfExpModNormal_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_288, AgradCdfTestFixture, AgradCdfExpModNormal_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_289, AgradCdfTestFixture, AgradCdfExpModNormal_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_290, AgradCdfTestFixture, AgradCdfExpModNormal_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_291, AgradCdfTestFixture, AgradCdfExpModNormal_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_292, AgradCdfTestFixture, AgradCdfExpModNormal_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_293, AgradCdfTestFixture, AgradCdfExpModNormal_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_294, AgradCdfTestFixture, AgradCdfExpModNormal_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_295, AgradCdfTestFixture, AgradCdfExpModNormal_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_296, AgradCdfTestFixture, AgradCdfExpModNormal_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_297, AgradCdfTestFixture, AgradCdfExpModNormal_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_298, AgradCdfTestFixture, AgradCdfExpModNormal_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_299, AgradCdfTestFixture, AgradCdfExpModNormal_vv_299);
+
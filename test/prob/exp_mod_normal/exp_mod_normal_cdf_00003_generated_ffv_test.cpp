@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_300> AgradCdfExpModNormal_ffv_300;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_301> AgradCdfExpModNormal_ffv_301;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_302> AgradCdfExpModNormal_ffv_302;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_303> AgradCdfExpModNormal_ffv_303;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_304> AgradCdfExpModNormal_ffv_304;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_305> AgradCdfExpModNormal_ffv_305;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_306> AgradCdfExpModNormal_ffv_306;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_307> AgradCdfExpModNormal_ffv_307;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_308> AgradCdfExpModNormal_ffv_308;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_309> AgradCdfExpModNormal_ffv_309;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_310> AgradCdfExpModNormal_ffv_310;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_311> AgradCdfExpModNormal_ffv_311;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_312> AgradCdfExpModNormal_ffv_312;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_313> AgradCdfExpModNormal_ffv_313;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_314> AgradCdfExpModNormal_ffv_314;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_315> AgradCdfExpModNormal_ffv_315;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_316> AgradCdfExpModNormal_ffv_316;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_317> AgradCdfExpModNormal_ffv_317;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_318> AgradCdfExpModNormal_ffv_318;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_319> AgradCdfExpModNormal_ffv_319;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_320> AgradCdfExpModNormal_ffv_320;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_321> AgradCdfExpModNormal_ffv_321;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_322> AgradCdfExpModNormal_ffv_322;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_323> AgradCdfExpModNormal_ffv_323;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_324> AgradCdfExpModNormal_ffv_324;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_325> AgradCdfExpModNormal_ffv_325;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_326> AgradCdfExpModNormal_ffv_326;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_327> AgradCdfExpModNormal_ffv_327;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_328> AgradCdfExpModNormal_ffv_328;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_329> AgradCdfExpModNormal_ffv_329;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_330> AgradCdfExpModNormal_ffv_330;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_331> AgradCdfExpModNormal_ffv_331;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_332> AgradCdfExpModNormal_ffv_332;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_333> AgradCdfExpModNormal_ffv_333;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_334> AgradCdfExpModNormal_ffv_334;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_335> AgradCdfExpModNormal_ffv_335;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_336> AgradCdfExpModNormal_ffv_336;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_337> AgradCdfExpModNormal_ffv_337;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_338> AgradCdfExpModNormal_ffv_338;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_339> AgradCdfExpModNormal_ffv_339;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_340> AgradCdfExpModNormal_ffv_340;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_341> AgradCdfExpModNormal_ffv_341;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_342> AgradCdfExpModNormal_ffv_342;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_343> AgradCdfExpModNormal_ffv_343;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_344> AgradCdfExpModNormal_ffv_344;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_345> AgradCdfExpModNormal_ffv_345;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_346> AgradCdfExpModNormal_ffv_346;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_347> AgradCdfExpModNormal_ffv_347;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_348> AgradCdfExpModNormal_ffv_348;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_349> AgradCdfExpModNormal_ffv_349;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_350> AgradCdfExpModNormal_ffv_350;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_351> AgradCdfExpModNormal_ffv_351;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_352> AgradCdfExpModNormal_ffv_352;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_353> AgradCdfExpModNormal_ffv_353;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_354> AgradCdfExpModNormal_ffv_354;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_355> AgradCdfExpModNormal_ffv_355;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_356> AgradCdfExpModNormal_ffv_356;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_357> AgradCdfExpModNormal_ffv_357;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_358> AgradCdfExpModNormal_ffv_358;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_359> AgradCdfExpModNormal_ffv_359;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_360> AgradCdfExpModNormal_ffv_360;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_361> AgradCdfExpModNormal_ffv_361;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_362> AgradCdfExpModNormal_ffv_362;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_363> AgradCdfExpModNormal_ffv_363;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_364> AgradCdfExpModNormal_ffv_364;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_365> AgradCdfExpModNormal_ffv_365;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_366> AgradCdfExpModNormal_ffv_366;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_367> AgradCdfExpModNormal_ffv_367;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_368> AgradCdfExpModNormal_ffv_368;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_369> AgradCdfExpModNormal_ffv_369;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_370> AgradCdfExpModNormal_ffv_370;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_371> AgradCdfExpModNormal_ffv_371;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_372> AgradCdfExpModNormal_ffv_372;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_373> AgradCdfExpModNormal_ffv_373;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_374> AgradCdfExpModNormal_ffv_374;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_375> AgradCdfExpModNormal_ffv_375;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_376> AgradCdfExpModNormal_ffv_376;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_377> AgradCdfExpModNormal_ffv_377;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_378> AgradCdfExpModNormal_ffv_378;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_379> AgradCdfExpModNormal_ffv_379;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_380> AgradCdfExpModNormal_ffv_380;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_381> AgradCdfExpModNormal_ffv_381;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_382> AgradCdfExpModNormal_ffv_382;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_383> AgradCdfExpModNormal_ffv_383;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_384> AgradCdfExpModNormal_ffv_384;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_385> AgradCdfExpModNormal_ffv_385;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_386> AgradCdfExpModNormal_ffv_386;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_387> AgradCdfExpModNormal_ffv_387;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_388> AgradCdfExpModNormal_ffv_388;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_389> AgradCdfExpModNormal_ffv_389;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_390> AgradCdfExpModNormal_ffv_390;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_391> AgradCdfExpModNormal_ffv_391;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_392> AgradCdfExpModNormal_ffv_392;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_393> AgradCdfExpModNormal_ffv_393;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_394> AgradCdfExpModNormal_ffv_394;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_395> AgradCdfExpModNormal_ffv_395;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_396> AgradCdfExpModNormal_ffv_396;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_397> AgradCdfExpModNormal_ffv_397;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_398> AgradCdfExpModNormal_ffv_398;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_399> AgradCdfExpModNormal_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_300, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_301, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_302, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_303, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_304, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_305, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_306, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_307, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_308, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_309, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_310, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_311, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_312, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_313, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_314, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_315, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_316, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_317, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_318, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_319, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_320, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_321, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_322, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_323, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_324, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_325, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_326, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_327, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_328, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_329, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_330, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_331, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_332, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_333, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_334, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_335, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_336, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_337, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_338, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_339, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_340, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_341, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_342, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_343, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_344, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_345, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_346, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_347, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_348, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_349, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_350, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_351, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_352, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_353, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_354, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_355, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_356, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_357, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_358, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_359, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_360, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_361, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_362, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_363, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_364, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_365, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_366, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_367, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_368, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_369, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_370, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_371, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_372, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_373, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_374, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_375, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_376, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_377, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_378, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_379, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_380, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_381, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_382, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_383, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_384, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_385, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_386, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_387, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_388, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_389, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_390, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_391, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_392, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_393, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_394, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_395, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_396, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_397, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_398, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_399, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_399);
+
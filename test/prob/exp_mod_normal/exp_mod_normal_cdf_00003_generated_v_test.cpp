@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradCdfExpModNormal, type_v_300> AgradCdfExpModNormal_v_300;
+typedef std::tuple<AgradCdfExpModNormal, type_v_301> AgradCdfExpModNormal_v_301;
+typedef std::tuple<AgradCdfExpModNormal, type_v_302> AgradCdfExpModNormal_v_302;
+typedef std::tuple<AgradCdfExpModNormal, type_v_303> AgradCdfExpModNormal_v_303;
+typedef std::tuple<AgradCdfExpModNormal, type_v_304> AgradCdfExpModNormal_v_304;
+typedef std::tuple<AgradCdfExpModNormal, type_v_305> AgradCdfExpModNormal_v_305;
+typedef std::tuple<AgradCdfExpModNormal, type_v_306> AgradCdfExpModNormal_v_306;
+typedef std::tuple<AgradCdfExpModNormal, type_v_307> AgradCdfExpModNormal_v_307;
+typedef std::tuple<AgradCdfExpModNormal, type_v_308> AgradCdfExpModNormal_v_308;
+typedef std::tuple<AgradCdfExpModNormal, type_v_309> AgradCdfExpModNormal_v_309;
+typedef std::tuple<AgradCdfExpModNormal, type_v_310> AgradCdfExpModNormal_v_310;
+typedef std::tuple<AgradCdfExpModNormal, type_v_311> AgradCdfExpModNormal_v_311;
+typedef std::tuple<AgradCdfExpModNormal, type_v_312> AgradCdfExpModNormal_v_312;
+typedef std::tuple<AgradCdfExpModNormal, type_v_313> AgradCdfExpModNormal_v_313;
+typedef std::tuple<AgradCdfExpModNormal, type_v_314> AgradCdfExpModNormal_v_314;
+typedef std::tuple<AgradCdfExpModNormal, type_v_315> AgradCdfExpModNormal_v_315;
+typedef std::tuple<AgradCdfExpModNormal, type_v_316> AgradCdfExpModNormal_v_316;
+typedef std::tuple<AgradCdfExpModNormal, type_v_317> AgradCdfExpModNormal_v_317;
+typedef std::tuple<AgradCdfExpModNormal, type_v_318> AgradCdfExpModNormal_v_318;
+typedef std::tuple<AgradCdfExpModNormal, type_v_319> AgradCdfExpModNormal_v_319;
+typedef std::tuple<AgradCdfExpModNormal, type_v_320> AgradCdfExpModNormal_v_320;
+typedef std::tuple<AgradCdfExpModNormal, type_v_321> AgradCdfExpModNormal_v_321;
+typedef std::tuple<AgradCdfExpModNormal, type_v_322> AgradCdfExpModNormal_v_322;
+typedef std::tuple<AgradCdfExpModNormal, type_v_323> AgradCdfExpModNormal_v_323;
+typedef std::tuple<AgradCdfExpModNormal, type_v_324> AgradCdfExpModNormal_v_324;
+typedef std::tuple<AgradCdfExpModNormal, type_v_325> AgradCdfExpModNormal_v_325;
+typedef std::tuple<AgradCdfExpModNormal, type_v_326> AgradCdfExpModNormal_v_326;
+typedef std::tuple<AgradCdfExpModNormal, type_v_327> AgradCdfExpModNormal_v_327;
+typedef std::tuple<AgradCdfExpModNormal, type_v_328> AgradCdfExpModNormal_v_328;
+typedef std::tuple<AgradCdfExpModNormal, type_v_329> AgradCdfExpModNormal_v_329;
+typedef std::tuple<AgradCdfExpModNormal, type_v_330> AgradCdfExpModNormal_v_330;
+typedef std::tuple<AgradCdfExpModNormal, type_v_331> AgradCdfExpModNormal_v_331;
+typedef std::tuple<AgradCdfExpModNormal, type_v_332> AgradCdfExpModNormal_v_332;
+typedef std::tuple<AgradCdfExpModNormal, type_v_333> AgradCdfExpModNormal_v_333;
+typedef std::tuple<AgradCdfExpModNormal, type_v_334> AgradCdfExpModNormal_v_334;
+typedef std::tuple<AgradCdfExpModNormal, type_v_335> AgradCdfExpModNormal_v_335;
+typedef std::tuple<AgradCdfExpModNormal, type_v_336> AgradCdfExpModNormal_v_336;
+typedef std::tuple<AgradCdfExpModNormal, type_v_337> AgradCdfExpModNormal_v_337;
+typedef std::tuple<AgradCdfExpModNormal, type_v_338> AgradCdfExpModNormal_v_338;
+typedef std::tuple<AgradCdfExpModNormal, type_v_339> AgradCdfExpModNormal_v_339;
+typedef std::tuple<AgradCdfExpModNormal, type_v_340> AgradCdfExpModNormal_v_340;
+typedef std::tuple<AgradCdfExpModNormal, type_v_341> AgradCdfExpModNormal_v_341;
+typedef std::tuple<AgradCdfExpModNormal, type_v_342> AgradCdfExpModNormal_v_342;
+typedef std::tuple<AgradCdfExpModNormal, type_v_343> AgradCdfExpModNormal_v_343;
+typedef std::tuple<AgradCdfExpModNormal, type_v_344> AgradCdfExpModNormal_v_344;
+typedef std::tuple<AgradCdfExpModNormal, type_v_345> AgradCdfExpModNormal_v_345;
+typedef std::tuple<AgradCdfExpModNormal, type_v_346> AgradCdfExpModNormal_v_346;
+typedef std::tuple<AgradCdfExpModNormal, type_v_347> AgradCdfExpModNormal_v_347;
+typedef std::tuple<AgradCdfExpModNormal, type_v_348> AgradCdfExpModNormal_v_348;
+typedef std::tuple<AgradCdfExpModNormal, type_v_349> AgradCdfExpModNormal_v_349;
+typedef std::tuple<AgradCdfExpModNormal, type_v_350> AgradCdfExpModNormal_v_350;
+typedef std::tuple<AgradCdfExpModNormal, type_v_351> AgradCdfExpModNormal_v_351;
+typedef std::tuple<AgradCdfExpModNormal, type_v_352> AgradCdfExpModNormal_v_352;
+typedef std::tuple<AgradCdfExpModNormal, type_v_353> AgradCdfExpModNormal_v_353;
+typedef std::tuple<AgradCdfExpModNormal, type_v_354> AgradCdfExpModNormal_v_354;
+typedef std::tuple<AgradCdfExpModNormal, type_v_355> AgradCdfExpModNormal_v_355;
+typedef std::tuple<AgradCdfExpModNormal, type_v_356> AgradCdfExpModNormal_v_356;
+typedef std::tuple<AgradCdfExpModNormal, type_v_357> AgradCdfExpModNormal_v_357;
+typedef std::tuple<AgradCdfExpModNormal, type_v_358> AgradCdfExpModNormal_v_358;
+typedef std::tuple<AgradCdfExpModNormal, type_v_359> AgradCdfExpModNormal_v_359;
+typedef std::tuple<AgradCdfExpModNormal, type_v_360> AgradCdfExpModNormal_v_360;
+typedef std::tuple<AgradCdfExpModNormal, type_v_361> AgradCdfExpModNormal_v_361;
+typedef std::tuple<AgradCdfExpModNormal, type_v_362> AgradCdfExpModNormal_v_362;
+typedef std::tuple<AgradCdfExpModNormal, type_v_363> AgradCdfExpModNormal_v_363;
+typedef std::tuple<AgradCdfExpModNormal, type_v_364> AgradCdfExpModNormal_v_364;
+typedef std::tuple<AgradCdfExpModNormal, type_v_365> AgradCdfExpModNormal_v_365;
+typedef std::tuple<AgradCdfExpModNormal, type_v_366> AgradCdfExpModNormal_v_366;
+typedef std::tuple<AgradCdfExpModNormal, type_v_367> AgradCdfExpModNormal_v_367;
+typedef std::tuple<AgradCdfExpModNormal, type_v_368> AgradCdfExpModNormal_v_368;
+typedef std::tuple<AgradCdfExpModNormal, type_v_369> AgradCdfExpModNormal_v_369;
+typedef std::tuple<AgradCdfExpModNormal, type_v_370> AgradCdfExpModNormal_v_370;
+typedef std::tuple<AgradCdfExpModNormal, type_v_371> AgradCdfExpModNormal_v_371;
+typedef std::tuple<AgradCdfExpModNormal, type_v_372> AgradCdfExpModNormal_v_372;
+typedef std::tuple<AgradCdfExpModNormal, type_v_373> AgradCdfExpModNormal_v_373;
+typedef std::tuple<AgradCdfExpModNormal, type_v_374> AgradCdfExpModNormal_v_374;
+typedef std::tuple<AgradCdfExpModNormal, type_v_375> AgradCdfExpModNormal_v_375;
+typedef std::tuple<AgradCdfExpModNormal, type_v_376> AgradCdfExpModNormal_v_376;
+typedef std::tuple<AgradCdfExpModNormal, type_v_377> AgradCdfExpModNormal_v_377;
+typedef std::tuple<AgradCdfExpModNormal, type_v_378> AgradCdfExpModNormal_v_378;
+typedef std::tuple<AgradCdfExpModNormal, type_v_379> AgradCdfExpModNormal_v_379;
+typedef std::tuple<AgradCdfExpModNormal, type_v_380> AgradCdfExpModNormal_v_380;
+typedef std::tuple<AgradCdfExpModNormal, type_v_381> AgradCdfExpModNormal_v_381;
+typedef std::tuple<AgradCdfExpModNormal, type_v_382> AgradCdfExpModNormal_v_382;
+typedef std::tuple<AgradCdfExpModNormal, type_v_383> AgradCdfExpModNormal_v_383;
+typedef std::tuple<AgradCdfExpModNormal, type_v_384> AgradCdfExpModNormal_v_384;
+typedef std::tuple<AgradCdfExpModNormal, type_v_385> AgradCdfExpModNormal_v_385;
+typedef std::tuple<AgradCdfExpModNormal, type_v_386> AgradCdfExpModNormal_v_386;
+typedef std::tuple<AgradCdfExpModNormal, type_v_387> AgradCdfExpModNormal_v_387;
+typedef std::tuple<AgradCdfExpModNormal, type_v_388> AgradCdfExpModNormal_v_388;
+typedef std::tuple<AgradCdfExpModNormal, type_v_389> AgradCdfExpModNormal_v_389;
+typedef std::tuple<AgradCdfExpModNormal, type_v_390> AgradCdfExpModNormal_v_390;
+typedef std::tuple<AgradCdfExpModNormal, type_v_391> AgradCdfExpModNormal_v_391;
+typedef std::tuple<AgradCdfExpModNormal, type_v_392> AgradCdfExpModNormal_v_392;
+typedef std::tuple<AgradCdfExpModNormal, type_v_393> AgradCdfExpModNormal_v_393;
+typedef std::tuple<AgradCdfExpModNormal, type_v_394> AgradCdfExpModNormal_v_394;
+typedef std::tuple<AgradCdfExpModNormal, type_v_395> AgradCdfExpModNormal_v_395;
+typedef std::tuple<AgradCdfExpModNormal, type_v_396> AgradCdfExpModNormal_v_396;
+typedef std::tuple<AgradCdfExpModNormal, type_v_397> AgradCdfExpModNormal_v_397;
+typedef std::tuple<AgradCdfExpModNormal, type_v_398> AgradCdfExpModNormal_v_398;
+typedef std::tuple<AgradCdfExpModNormal, type_v_399> AgradCdfExpModNormal_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_300, AgradCdfTestFixture, AgradCdfExpModNormal_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_301, AgradCdfTestFixture, AgradCdfExpModNormal_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_302, AgradCdfTestFixture, AgradCdfExpModNormal_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_303, AgradCdfTestFixture, AgradCdfExpModNormal_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_304, AgradCdfTestFixture, AgradCdfExpModNormal_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_305, AgradCdfTestFixture, AgradCdfExpModNormal_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_306, AgradCdfTestFixture, AgradCdfExpModNormal_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_307, AgradCdfTestFixture, AgradCdfExpModNormal_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_308, AgradCdfTestFixture, AgradCdfExpModNormal_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_309, AgradCdfTestFixture, AgradCdfExpModNormal_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_310, AgradCdfTestFixture, AgradCdfExpModNormal_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_311, AgradCdfTestFixture, AgradCdfExpModNormal_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_312, AgradCdfTestFixture, AgradCdfExpModNormal_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_313, AgradCdfTestFixture, AgradCdfExpModNormal_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_314, AgradCdfTestFixture, AgradCdfExpModNormal_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_315, AgradCdfTestFixture, AgradCdfExpModNormal_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_316, AgradCdfTestFixture, AgradCdfExpModNormal_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_317, AgradCdfTestFixture, AgradCdfExpModNormal_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_318, AgradCdfTestFixture, AgradCdfExpModNormal_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_319, AgradCdfTestFixture, AgradCdfExpModNormal_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_320, AgradCdfTestFixture, AgradCdfExpModNormal_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_321, AgradCdfTestFixture, AgradCdfExpModNormal_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_322, AgradCdfTestFixture, AgradCdfExpModNormal_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_323, AgradCdfTestFixture, AgradCdfExpModNormal_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_324, AgradCdfTestFixture, AgradCdfExpModNormal_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_325, AgradCdfTestFixture, AgradCdfExpModNormal_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_326, AgradCdfTestFixture, AgradCdfExpModNormal_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_327, AgradCdfTestFixture, AgradCdfExpModNormal_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_328, AgradCdfTestFixture, AgradCdfExpModNormal_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_329, AgradCdfTestFixture, AgradCdfExpModNormal_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_330, AgradCdfTestFixture, AgradCdfExpModNormal_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_331, AgradCdfTestFixture, AgradCdfExpModNormal_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_332, AgradCdfTestFixture, AgradCdfExpModNormal_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_333, AgradCdfTestFixture, AgradCdfExpModNormal_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_334, AgradCdfTestFixture, AgradCdfExpModNormal_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_335, AgradCdfTestFixture, AgradCdfExpModNormal_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_336, AgradCdfTestFixture, AgradCdfExpModNormal_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_337, AgradCdfTestFixture, AgradCdfExpModNormal_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_338, AgradCdfTestFixture, AgradCdfExpModNormal_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_339, AgradCdfTestFixture, AgradCdfExpModNormal_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_340, AgradCdfTestFixture, AgradCdfExpModNormal_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_341, AgradCdfTestFixture, AgradCdfExpModNormal_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_342, AgradCdfTestFixture, AgradCdfExpModNormal_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_343, AgradCdfTestFixture, AgradCdfExpModNormal_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_344, AgradCdfTestFixture, AgradCdfExpModNormal_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_345, AgradCdfTestFixture, AgradCdfExpModNormal_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_346, AgradCdfTestFixture, AgradCdfExpModNormal_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_347, AgradCdfTestFixture, AgradCdfExpModNormal_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_348, AgradCdfTestFixture, AgradCdfExpModNormal_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_349, AgradCdfTestFixture, AgradCdfExpModNormal_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_350, AgradCdfTestFixture, AgradCdfExpModNormal_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_351, AgradCdfTestFixture, AgradCdfExpModNormal_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_352, AgradCdfTestFixture, AgradCdfExpModNormal_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_353, AgradCdfTestFixture, AgradCdfExpModNormal_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_354, AgradCdfTestFixture, AgradCdfExpModNormal_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_355, AgradCdfTestFixture, AgradCdfExpModNormal_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_356, AgradCdfTestFixture, AgradCdfExpModNormal_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_357, AgradCdfTestFixture, AgradCdfExpModNormal_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_358, AgradCdfTestFixture, AgradCdfExpModNormal_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_359, AgradCdfTestFixture, AgradCdfExpModNormal_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_360, AgradCdfTestFixture, AgradCdfExpModNormal_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_361, AgradCdfTestFixture, AgradCdfExpModNormal_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_362, AgradCdfTestFixture, AgradCdfExpModNormal_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_363, AgradCdfTestFixture, AgradCdfExpModNormal_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_364, AgradCdfTestFixture, AgradCdfExpModNormal_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_365, AgradCdfTestFixture, AgradCdfExpModNormal_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_366, AgradCdfTestFixture, AgradCdfExpModNormal_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_367, AgradCdfTestFixture, AgradCdfExpModNormal_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_368, AgradCdfTestFixture, AgradCdfExpModNormal_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_369, AgradCdfTestFixture, AgradCdfExpModNormal_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_370, AgradCdfTestFixture, AgradCdfExpModNormal_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_371, AgradCdfTestFixture, AgradCdfExpModNormal_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_372, AgradCdfTestFixture, AgradCdfExpModNormal_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_373, AgradCdfTestFixture, AgradCdfExpModNormal_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_374, AgradCdfTestFixture, AgradCdfExpModNormal_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_375, AgradCdfTestFixture, AgradCdfExpModNormal_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_376, AgradCdfTestFixture, AgradCdfExpModNormal_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_377, AgradCdfTestFixture, AgradCdfExpModNormal_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_378, AgradCdfTestFixture, AgradCdfExpModNormal_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_379, AgradCdfTestFixture, AgradCdfExpModNormal_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_380, AgradCdfTestFixture, AgradCdfExpModNormal_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_381, AgradCdfTestFixture, AgradCdfExpModNormal_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_382, AgradCdfTestFixture, AgradCdfExpModNormal_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_383, AgradCdfTestFixture, AgradCdfExpModNormal_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_384, AgradCdfTestFixture, AgradCdfExpModNormal_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_385, AgradCdfTestFixture, AgradCdfExpModNormal_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_386, AgradCdfTestFixture, AgradCdfExpModNormal_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_387, AgradCdfTestFixture, AgradCdfExpModNormal_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_388, AgradCdfTestFixture, AgradCdfExpModNormal_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_389, AgradCdfTestFixture, AgradCdfExpModNormal_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_390, AgradCdfTestFixture, AgradCdfExpModNormal_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_391, AgradCdfTestFixture, AgradCdfExpModNormal_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_392, AgradCdfTestFixture, AgradCdfExpModNormal_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_393, AgradCdfTestFixture, AgradCdfExpModNormal_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_394, AgradCdfTestFixture, AgradCdfExpModNormal_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_395, AgradCdfTestFixture, AgradCdfExpModNormal_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_396, AgradCdfTestFixture, AgradCdfExpModNormal_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_397, AgradCdfTestFixture, AgradCdfExpModNormal_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_398, AgradCdfTestFixture, AgradCdfExpModNormal_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_399, AgradCdfTestFixture, AgradCdfExpModNormal_v_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradCdfExpModNormal, type_vv_300> AgradCdfExpModNormal_vv_300;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_301> AgradCdfExpModNormal_vv_301;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_302> AgradCdfExpModNormal_vv_302;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_303> AgradCdfExpModNormal_vv_303;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_304> AgradCdfExpModNormal_vv_304;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_305> AgradCdfExpModNormal_vv_305;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_306> AgradCdfExpModNormal_vv_306;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_307> AgradCdfExpModNormal_vv_307;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_308> AgradCdfExpModNormal_vv_308;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_309> AgradCdfExpModNormal_vv_309;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_310> AgradCdfExpModNormal_vv_310;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_311> AgradCdfExpModNormal_vv_311;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_312> AgradCdfExpModNormal_vv_312;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_313> AgradCdfExpModNormal_vv_313;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_314> AgradCdfExpModNormal_vv_314;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_315> AgradCdfExpModNormal_vv_315;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_316> AgradCdfExpModNormal_vv_316;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_317> AgradCdfExpModNormal_vv_317;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_318> AgradCdfExpModNormal_vv_318;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_319> AgradCdfExpModNormal_vv_319;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_320> AgradCdfExpModNormal_vv_320;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_321> AgradCdfExpModNormal_vv_321;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_322> AgradCdfExpModNormal_vv_322;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_323> AgradCdfExpModNormal_vv_323;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_324> AgradCdfExpModNormal_vv_324;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_325> AgradCdfExpModNormal_vv_325;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_326> AgradCdfExpModNormal_vv_326;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_327> AgradCdfExpModNormal_vv_327;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_328> AgradCdfExpModNormal_vv_328;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_329> AgradCdfExpModNormal_vv_329;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_330> AgradCdfExpModNormal_vv_330;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_331> AgradCdfExpModNormal_vv_331;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_332> AgradCdfExpModNormal_vv_332;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_333> AgradCdfExpModNormal_vv_333;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_334> AgradCdfExpModNormal_vv_334;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_335> AgradCdfExpModNormal_vv_335;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_336> AgradCdfExpModNormal_vv_336;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_337> AgradCdfExpModNormal_vv_337;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_338> AgradCdfExpModNormal_vv_338;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_339> AgradCdfExpModNormal_vv_339;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_340> AgradCdfExpModNormal_vv_340;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_341> AgradCdfExpModNormal_vv_341;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_342> AgradCdfExpModNormal_vv_342;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_343> AgradCdfExpModNormal_vv_343;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_344> AgradCdfExpModNormal_vv_344;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_345> AgradCdfExpModNormal_vv_345;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_346> AgradCdfExpModNormal_vv_346;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_347> AgradCdfExpModNormal_vv_347;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_348> AgradCdfExpModNormal_vv_348;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_349> AgradCdfExpModNormal_vv_349;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_350> AgradCdfExpModNormal_vv_350;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_351> AgradCdfExpModNormal_vv_351;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_352> AgradCdfExpModNormal_vv_352;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_353> AgradCdfExpModNormal_vv_353;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_354> AgradCdfExpModNormal_vv_354;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_355> AgradCdfExpModNormal_vv_355;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_356> AgradCdfExpModNormal_vv_356;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_357> AgradCdfExpModNormal_vv_357;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_358> AgradCdfExpModNormal_vv_358;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_359> AgradCdfExpModNormal_vv_359;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_360> AgradCdfExpModNormal_vv_360;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_361> AgradCdfExpModNormal_vv_361;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_362> AgradCdfExpModNormal_vv_362;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_363> AgradCdfExpModNormal_vv_363;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_364> AgradCdfExpModNormal_vv_364;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_365> AgradCdfExpModNormal_vv_365;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_366> AgradCdfExpModNormal_vv_366;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_367> AgradCdfExpModNormal_vv_367;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_368> AgradCdfExpModNormal_vv_368;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_369> AgradCdfExpModNormal_vv_369;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_370> AgradCdfExpModNormal_vv_370;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_371> AgradCdfExpModNormal_vv_371;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_372> AgradCdfExpModNormal_vv_372;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_373> AgradCdfExpModNormal_vv_373;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_374> AgradCdfExpModNormal_vv_374;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_375> AgradCdfExpModNormal_vv_375;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_376> AgradCdfExpModNormal_vv_376;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_377> AgradCdfExpModNormal_vv_377;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_378> AgradCdfExpModNormal_vv_378;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_379> AgradCdfExpModNormal_vv_379;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_380> AgradCdfExpModNormal_vv_380;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_381> AgradCdfExpModNormal_vv_381;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_382> AgradCdfExpModNormal_vv_382;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_383> AgradCdfExpModNormal_vv_383;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_384> AgradCdfExpModNormal_vv_384;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_385> AgradCdfExpModNormal_vv_385;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_386> AgradCdfExpModNormal_vv_386;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_387> AgradCdfExpModNormal_vv_387;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_388> AgradCdfExpModNormal_vv_388;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_389> AgradCdfExpModNormal_vv_389;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_390> AgradCdfExpModNormal_vv_390;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_391> AgradCdfExpModNormal_vv_391;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_392> AgradCdfExpModNormal_vv_392;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_393> AgradCdfExpModNormal_vv_393;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_394> AgradCdfExpModNormal_vv_394;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_395> AgradCdfExpModNormal_vv_395;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_396> AgradCdfExpModNormal_vv_396;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_397> AgradCdfExpModNormal_vv_397;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_398> AgradCdfExpModNormal_vv_398;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_399> AgradCdfExpModNormal_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_300, AgradCdfTestFixture, AgradCdfExpModNormal_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_301, AgradCdfTestFixture, AgradCdfExpModNormal_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_302, AgradCdfTestFixture, AgradCdfExpModNormal_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_303, AgradCdfTestFixture, AgradCdfExpModNormal_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_304, AgradCdfTestFixture, AgradCdfExpModNormal_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_305, AgradCdfTestFixture, AgradCdfExpModNormal_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_306, AgradCdfTestFixture, AgradCdfExpModNormal_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_307, AgradCdfTestFixture, AgradCdfExpModNormal_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_308, AgradCdfTestFixture, AgradCdfExpModNormal_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_309, AgradCdfTestFixture, AgradCdfExpModNormal_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_310, AgradCdfTestFixture, AgradCdfExpModNormal_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_311, AgradCdfTestFixture, AgradCdfExpModNormal_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_312, AgradCdfTestFixture, AgradCdfExpModNormal_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_313, AgradCdfTestFixture, AgradCdfExpModNormal_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_314, AgradCdfTestFixture, AgradCdfExpModNormal_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_315, AgradCdfTestFixture, AgradCdfExpModNormal_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_316, AgradCdfTestFixture, AgradCdfExpModNormal_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_317, AgradCdfTestFixture, AgradCdfExpModNormal_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_318, AgradCdfTestFixture, AgradCdfExpModNormal_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_319, AgradCdfTestFixture, AgradCdfExpModNormal_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_320, AgradCdfTestFixture, AgradCdfExpModNormal_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_321, AgradCdfTestFixture, AgradCdfExpModNormal_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_322, AgradCdfTestFixture, AgradCdfExpModNormal_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_323, AgradCdfTestFixture, AgradCdfExpModNormal_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_324, AgradCdfTestFixture, AgradCdfExpModNormal_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_325, AgradCdfTestFixture, AgradCdfExpModNormal_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_326, AgradCdfTestFixture, AgradCdfExpModNormal_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_327, AgradCdfTestFixture, AgradCdfExpModNormal_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_328, AgradCdfTestFixture, AgradCdfExpModNormal_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_329, AgradCdfTestFixture, AgradCdfExpModNormal_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_330, AgradCdfTestFixture, AgradCdfExpModNormal_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_331, AgradCdfTestFixture, AgradCdfExpModNormal_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_332, AgradCdfTestFixture, AgradCdfExpModNormal_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_333, AgradCdfTestFixture, AgradCdfExpModNormal_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_334, AgradCdfTestFixture, AgradCdfExpModNormal_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_335, AgradCdfTestFixture, AgradCdfExpModNormal_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_336, AgradCdfTestFixture, AgradCdfExpModNormal_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_337, AgradCdfTestFixture, AgradCdfExpModNormal_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_338, AgradCdfTestFixture, AgradCdfExpModNormal_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_339, AgradCdfTestFixture, AgradCdfExpModNormal_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_340, AgradCdfTestFixture, AgradCdfExpModNormal_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_341, AgradCdfTestFixture, AgradCdfExpModNormal_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_342, AgradCdfTestFixture, AgradCdfExpModNormal_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_343, AgradCdfTestFixture, AgradCdfExpModNormal_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_344, AgradCdfTestFixture, AgradCdfExpModNormal_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_345, AgradCdfTestFixture, AgradCdfExpModNormal_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_346, AgradCdfTestFixture, AgradCdfExpModNormal_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_347, AgradCdfTestFixture, AgradCdfExpModNormal_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_348, AgradCdfTestFixture, AgradCdfExpModNormal_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_349, AgradCdfTestFixture, AgradCdfExpModNormal_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_350, AgradCdfTestFixture, AgradCdfExpModNormal_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_351, AgradCdfTestFixture, AgradCdfExpModNormal_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_352, AgradCdfTestFixture, AgradCdfExpModNormal_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_353, AgradCdfTestFixture, AgradCdfExpModNormal_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_354, AgradCdfTestFixture, AgradCdfExpModNormal_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_355, AgradCdfTestFixture, AgradCdfExpModNormal_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_356, AgradCdfTestFixture, AgradCdfExpModNormal_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_357, AgradCdfTestFixture, AgradCdfExpModNormal_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_358, AgradCdfTestFixture, AgradCdfExpModNormal_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_359, AgradCdfTestFixture, AgradCdfExpModNormal_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_360, AgradCdfTestFixture, AgradCdfExpModNormal_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_361, AgradCdfTestFixture, AgradCdfExpModNormal_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_362, AgradCdfTestFixture, AgradCdfExpModNormal_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_363, AgradCdfTestFixture, AgradCdfExpModNormal_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_364, AgradCdfTestFixture, AgradCdfExpModNormal_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_365, AgradCdfTestFixture, AgradCdfExpModNormal_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_366, AgradCdfTestFixture, AgradCdfExpModNormal_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_367, AgradCdfTestFixture, AgradCdfExpModNormal_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_368, AgradCdfTestFixture, AgradCdfExpModNormal_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_369, AgradCdfTestFixture, AgradCdfExpModNormal_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_370, AgradCdfTestFixture, AgradCdfExpModNormal_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_371, AgradCdfTestFixture, AgradCdfExpModNormal_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_372, AgradCdfTestFixture, AgradCdfExpModNormal_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_373, AgradCdfTestFixture, AgradCdfExpModNormal_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_374, AgradCdfTestFixture, AgradCdfExpModNormal_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_375, AgradCdfTestFixture, AgradCdfExpModNormal_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_376, AgradCdfTestFixture, AgradCdfExpModNormal_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_377, AgradCdfTestFixture, AgradCdfExpModNormal_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_378, AgradCdfTestFixture, AgradCdfExpModNormal_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_379, AgradCdfTestFixture, AgradCdfExpModNormal_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_380, AgradCdfTestFixture, AgradCdfExpModNormal_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_381, AgradCdfTestFixture, AgradCdfExpModNormal_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_382, AgradCdfTestFixture, AgradCdfExpModNormal_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_383, AgradCdfTestFixture, AgradCdfExpModNormal_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_384, AgradCdfTestFixture, AgradCdfExpModNormal_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_385, AgradCdfTestFixture, AgradCdfExpModNormal_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_386, AgradCdfTestFixture, AgradCdfExpModNormal_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_387, AgradCdfTestFixture, AgradCdfExpModNormal_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_388, AgradCdfTestFixture, AgradCdfExpModNormal_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_389, AgradCdfTestFixture, AgradCdfExpModNormal_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_390, AgradCdfTestFixture, AgradCdfExpModNormal_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_391, AgradCdfTestFixture, AgradCdfExpModNormal_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_392, AgradCdfTestFixture, AgradCdfExpModNormal_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_393, AgradCdfTestFixture, AgradCdfExpModNormal_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_394, AgradCdfTestFixture, AgradCdfExpModNormal_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_395, AgradCdfTestFixture, AgradCdfExpModNormal_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_396, AgradCdfTestFixture, AgradCdfExpModNormal_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_397, AgradCdfTestFixture, AgradCdfExpModNormal_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_398, AgradCdfTestFixture, AgradCdfExpModNormal_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_399, AgradCdfTestFixture, AgradCdfExpModNormal_vv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_400> AgradCdfExpModNormal_ffv_400;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_401> AgradCdfExpModNormal_ffv_401;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_402> AgradCdfExpModNormal_ffv_402;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_403> AgradCdfExpModNormal_ffv_403;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_404> AgradCdfExpModNormal_ffv_404;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_405> AgradCdfExpModNormal_ffv_405;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_406> AgradCdfExpModNormal_ffv_406;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_407> AgradCdfExpModNormal_ffv_407;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_408> AgradCdfExpModNormal_ffv_408;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_409> AgradCdfExpModNormal_ffv_409;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_410> AgradCdfExpModNormal_ffv_410;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_411> AgradCdfExpModNormal_ffv_411;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_412> AgradCdfExpModNormal_ffv_412;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_413> AgradCdfExpModNormal_ffv_413;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_414> AgradCdfExpModNormal_ffv_414;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_415> AgradCdfExpModNormal_ffv_415;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_416> AgradCdfExpModNormal_ffv_416;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_417> AgradCdfExpModNormal_ffv_417;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_418> AgradCdfExpModNormal_ffv_418;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_419> AgradCdfExpModNormal_ffv_419;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_420> AgradCdfExpModNormal_ffv_420;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_421> AgradCdfExpModNormal_ffv_421;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_422> AgradCdfExpModNormal_ffv_422;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_423> AgradCdfExpModNormal_ffv_423;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_424> AgradCdfExpModNormal_ffv_424;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_425> AgradCdfExpModNormal_ffv_425;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_426> AgradCdfExpModNormal_ffv_426;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_427> AgradCdfExpModNormal_ffv_427;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_428> AgradCdfExpModNormal_ffv_428;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_429> AgradCdfExpModNormal_ffv_429;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_430> AgradCdfExpModNormal_ffv_430;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_431> AgradCdfExpModNormal_ffv_431;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_432> AgradCdfExpModNormal_ffv_432;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_433> AgradCdfExpModNormal_ffv_433;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_434> AgradCdfExpModNormal_ffv_434;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_435> AgradCdfExpModNormal_ffv_435;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_436> AgradCdfExpModNormal_ffv_436;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_437> AgradCdfExpModNormal_ffv_437;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_438> AgradCdfExpModNormal_ffv_438;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_439> AgradCdfExpModNormal_ffv_439;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_440> AgradCdfExpModNormal_ffv_440;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_441> AgradCdfExpModNormal_ffv_441;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_442> AgradCdfExpModNormal_ffv_442;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_443> AgradCdfExpModNormal_ffv_443;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_444> AgradCdfExpModNormal_ffv_444;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_445> AgradCdfExpModNormal_ffv_445;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_446> AgradCdfExpModNormal_ffv_446;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_447> AgradCdfExpModNormal_ffv_447;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_448> AgradCdfExpModNormal_ffv_448;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_449> AgradCdfExpModNormal_ffv_449;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_450> AgradCdfExpModNormal_ffv_450;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_451> AgradCdfExpModNormal_ffv_451;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_452> AgradCdfExpModNormal_ffv_452;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_453> AgradCdfExpModNormal_ffv_453;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_454> AgradCdfExpModNormal_ffv_454;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_455> AgradCdfExpModNormal_ffv_455;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_456> AgradCdfExpModNormal_ffv_456;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_457> AgradCdfExpModNormal_ffv_457;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_458> AgradCdfExpModNormal_ffv_458;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_459> AgradCdfExpModNormal_ffv_459;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_460> AgradCdfExpModNormal_ffv_460;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_461> AgradCdfExpModNormal_ffv_461;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_462> AgradCdfExpModNormal_ffv_462;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_463> AgradCdfExpModNormal_ffv_463;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_464> AgradCdfExpModNormal_ffv_464;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_465> AgradCdfExpModNormal_ffv_465;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_466> AgradCdfExpModNormal_ffv_466;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_467> AgradCdfExpModNormal_ffv_467;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_468> AgradCdfExpModNormal_ffv_468;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_469> AgradCdfExpModNormal_ffv_469;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_470> AgradCdfExpModNormal_ffv_470;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_471> AgradCdfExpModNormal_ffv_471;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_472> AgradCdfExpModNormal_ffv_472;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_473> AgradCdfExpModNormal_ffv_473;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_474> AgradCdfExpModNormal_ffv_474;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_475> AgradCdfExpModNormal_ffv_475;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_476> AgradCdfExpModNormal_ffv_476;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_477> AgradCdfExpModNormal_ffv_477;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_478> AgradCdfExpModNormal_ffv_478;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_479> AgradCdfExpModNormal_ffv_479;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_480> AgradCdfExpModNormal_ffv_480;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_481> AgradCdfExpModNormal_ffv_481;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_482> AgradCdfExpModNormal_ffv_482;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_483> AgradCdfExpModNormal_ffv_483;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_484> AgradCdfExpModNormal_ffv_484;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_485> AgradCdfExpModNormal_ffv_485;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_486> AgradCdfExpModNormal_ffv_486;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_487> AgradCdfExpModNormal_ffv_487;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_488> AgradCdfExpModNormal_ffv_488;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_489> AgradCdfExpModNormal_ffv_489;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_490> AgradCdfExpModNormal_ffv_490;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_491> AgradCdfExpModNormal_ffv_491;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_492> AgradCdfExpModNormal_ffv_492;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_493> AgradCdfExpModNormal_ffv_493;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_494> AgradCdfExpModNormal_ffv_494;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_495> AgradCdfExpModNormal_ffv_495;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_496> AgradCdfExpModNormal_ffv_496;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_497> AgradCdfExpModNormal_ffv_497;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_498> AgradCdfExpModNormal_ffv_498;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_499> AgradCdfExpModNormal_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_400, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_401, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_402, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_403, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_404, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_405, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_406, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_407, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_408, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_409, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_410, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_411, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_412, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_413, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_414, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_415, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_416, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_417, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_418, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_419, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_420, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_421, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_422, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_423, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_424, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_425, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_426, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_427, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_428, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_429, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_430, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_431, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_432, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_433, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_434, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_435, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_436, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_437, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_438, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_439, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_440, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_441, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_442, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_443, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_444, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_445, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_446, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_447, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_448, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_449, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_450, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_451, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_452, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_453, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_454, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_455, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_456, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_457, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_458, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_459, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_460, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_461, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_462, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_463, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_464, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_465, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_466, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_467, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_468, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_469, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_470, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_471, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_472, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_473, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_474, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_475, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_476, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_477, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_478, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_479, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_480, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_481, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_482, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_483, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_484, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_485, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_486, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_487, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_488, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_489, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_490, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_491, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_492, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_493, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_494, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_495, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_496, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_497, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_498, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_499, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradCdfExpModNormal, type_v_400> AgradCdfExpModNormal_v_400;
+typedef std::tuple<AgradCdfExpModNormal, type_v_401> AgradCdfExpModNormal_v_401;
+typedef std::tuple<AgradCdfExpModNormal, type_v_402> AgradCdfExpModNormal_v_402;
+typedef std::tuple<AgradCdfExpModNormal, type_v_403> AgradCdfExpModNormal_v_403;
+typedef std::tuple<AgradCdfExpModNormal, type_v_404> AgradCdfExpModNormal_v_404;
+typedef std::tuple<AgradCdfExpModNormal, type_v_405> AgradCdfExpModNormal_v_405;
+typedef std::tuple<AgradCdfExpModNormal, type_v_406> AgradCdfExpModNormal_v_406;
+typedef std::tuple<AgradCdfExpModNormal, type_v_407> AgradCdfExpModNormal_v_407;
+typedef std::tuple<AgradCdfExpModNormal, type_v_408> AgradCdfExpModNormal_v_408;
+typedef std::tuple<AgradCdfExpModNormal, type_v_409> AgradCdfExpModNormal_v_409;
+typedef std::tuple<AgradCdfExpModNormal, type_v_410> AgradCdfExpModNormal_v_410;
+typedef std::tuple<AgradCdfExpModNormal, type_v_411> AgradCdfExpModNormal_v_411;
+typedef std::tuple<AgradCdfExpModNormal, type_v_412> AgradCdfExpModNormal_v_412;
+typedef std::tuple<AgradCdfExpModNormal, type_v_413> AgradCdfExpModNormal_v_413;
+typedef std::tuple<AgradCdfExpModNormal, type_v_414> AgradCdfExpModNormal_v_414;
+typedef std::tuple<AgradCdfExpModNormal, type_v_415> AgradCdfExpModNormal_v_415;
+typedef std::tuple<AgradCdfExpModNormal, type_v_416> AgradCdfExpModNormal_v_416;
+typedef std::tuple<AgradCdfExpModNormal, type_v_417> AgradCdfExpModNormal_v_417;
+typedef std::tuple<AgradCdfExpModNormal, type_v_418> AgradCdfExpModNormal_v_418;
+typedef std::tuple<AgradCdfExpModNormal, type_v_419> AgradCdfExpModNormal_v_419;
+typedef std::tuple<AgradCdfExpModNormal, type_v_420> AgradCdfExpModNormal_v_420;
+typedef std::tuple<AgradCdfExpModNormal, type_v_421> AgradCdfExpModNormal_v_421;
+typedef std::tuple<AgradCdfExpModNormal, type_v_422> AgradCdfExpModNormal_v_422;
+typedef std::tuple<AgradCdfExpModNormal, type_v_423> AgradCdfExpModNormal_v_423;
+typedef std::tuple<AgradCdfExpModNormal, type_v_424> AgradCdfExpModNormal_v_424;
+typedef std::tuple<AgradCdfExpModNormal, type_v_425> AgradCdfExpModNormal_v_425;
+typedef std::tuple<AgradCdfExpModNormal, type_v_426> AgradCdfExpModNormal_v_426;
+typedef std::tuple<AgradCdfExpModNormal, type_v_427> AgradCdfExpModNormal_v_427;
+typedef std::tuple<AgradCdfExpModNormal, type_v_428> AgradCdfExpModNormal_v_428;
+typedef std::tuple<AgradCdfExpModNormal, type_v_429> AgradCdfExpModNormal_v_429;
+typedef std::tuple<AgradCdfExpModNormal, type_v_430> AgradCdfExpModNormal_v_430;
+typedef std::tuple<AgradCdfExpModNormal, type_v_431> AgradCdfExpModNormal_v_431;
+typedef std::tuple<AgradCdfExpModNormal, type_v_432> AgradCdfExpModNormal_v_432;
+typedef std::tuple<AgradCdfExpModNormal, type_v_433> AgradCdfExpModNormal_v_433;
+typedef std::tuple<AgradCdfExpModNormal, type_v_434> AgradCdfExpModNormal_v_434;
+typedef std::tuple<AgradCdfExpModNormal, type_v_435> AgradCdfExpModNormal_v_435;
+typedef std::tuple<AgradCdfExpModNormal, type_v_436> AgradCdfExpModNormal_v_436;
+typedef std::tuple<AgradCdfExpModNormal, type_v_437> AgradCdfExpModNormal_v_437;
+typedef std::tuple<AgradCdfExpModNormal, type_v_438> AgradCdfExpModNormal_v_438;
+typedef std::tuple<AgradCdfExpModNormal, type_v_439> AgradCdfExpModNormal_v_439;
+typedef std::tuple<AgradCdfExpModNormal, type_v_440> AgradCdfExpModNormal_v_440;
+typedef std::tuple<AgradCdfExpModNormal, type_v_441> AgradCdfExpModNormal_v_441;
+typedef std::tuple<AgradCdfExpModNormal, type_v_442> AgradCdfExpModNormal_v_442;
+typedef std::tuple<AgradCdfExpModNormal, type_v_443> AgradCdfExpModNormal_v_443;
+typedef std::tuple<AgradCdfExpModNormal, type_v_444> AgradCdfExpModNormal_v_444;
+typedef std::tuple<AgradCdfExpModNormal, type_v_445> AgradCdfExpModNormal_v_445;
+typedef std::tuple<AgradCdfExpModNormal, type_v_446> AgradCdfExpModNormal_v_446;
+typedef std::tuple<AgradCdfExpModNormal, type_v_447> AgradCdfExpModNormal_v_447;
+typedef std::tuple<AgradCdfExpModNormal, type_v_448> AgradCdfExpModNormal_v_448;
+typedef std::tuple<AgradCdfExpModNormal, type_v_449> AgradCdfExpModNormal_v_449;
+typedef std::tuple<AgradCdfExpModNormal, type_v_450> AgradCdfExpModNormal_v_450;
+typedef std::tuple<AgradCdfExpModNormal, type_v_451> AgradCdfExpModNormal_v_451;
+typedef std::tuple<AgradCdfExpModNormal, type_v_452> AgradCdfExpModNormal_v_452;
+typedef std::tuple<AgradCdfExpModNormal, type_v_453> AgradCdfExpModNormal_v_453;
+typedef std::tuple<AgradCdfExpModNormal, type_v_454> AgradCdfExpModNormal_v_454;
+typedef std::tuple<AgradCdfExpModNormal, type_v_455> AgradCdfExpModNormal_v_455;
+typedef std::tuple<AgradCdfExpModNormal, type_v_456> AgradCdfExpModNormal_v_456;
+typedef std::tuple<AgradCdfExpModNormal, type_v_457> AgradCdfExpModNormal_v_457;
+typedef std::tuple<AgradCdfExpModNormal, type_v_458> AgradCdfExpModNormal_v_458;
+typedef std::tuple<AgradCdfExpModNormal, type_v_459> AgradCdfExpModNormal_v_459;
+typedef std::tuple<AgradCdfExpModNormal, type_v_460> AgradCdfExpModNormal_v_460;
+typedef std::tuple<AgradCdfExpModNormal, type_v_461> AgradCdfExpModNormal_v_461;
+typedef std::tuple<AgradCdfExpModNormal, type_v_462> AgradCdfExpModNormal_v_462;
+typedef std::tuple<AgradCdfExpModNormal, type_v_463> AgradCdfExpModNormal_v_463;
+typedef std::tuple<AgradCdfExpModNormal, type_v_464> AgradCdfExpModNormal_v_464;
+typedef std::tuple<AgradCdfExpModNormal, type_v_465> AgradCdfExpModNormal_v_465;
+typedef std::tuple<AgradCdfExpModNormal, type_v_466> AgradCdfExpModNormal_v_466;
+typedef std::tuple<AgradCdfExpModNormal, type_v_467> AgradCdfExpModNormal_v_467;
+typedef std::tuple<AgradCdfExpModNormal, type_v_468> AgradCdfExpModNormal_v_468;
+typedef std::tuple<AgradCdfExpModNormal, type_v_469> AgradCdfExpModNormal_v_469;
+typedef std::tuple<AgradCdfExpModNormal, type_v_470> AgradCdfExpModNormal_v_470;
+typedef std::tuple<AgradCdfExpModNormal, type_v_471> AgradCdfExpModNormal_v_471;
+typedef std::tuple<AgradCdfExpModNormal, type_v_472> AgradCdfExpModNormal_v_472;
+typedef std::tuple<AgradCdfExpModNormal, type_v_473> AgradCdfExpModNormal_v_473;
+typedef std::tuple<AgradCdfExpModNormal, type_v_474> AgradCdfExpModNormal_v_474;
+typedef std::tuple<AgradCdfExpModNormal, type_v_475> AgradCdfExpModNormal_v_475;
+typedef std::tuple<AgradCdfExpModNormal, type_v_476> AgradCdfExpModNormal_v_476;
+typedef std::tuple<AgradCdfExpModNormal, type_v_477> AgradCdfExpModNormal_v_477;
+typedef std::tuple<AgradCdfExpModNormal, type_v_478> AgradCdfExpModNormal_v_478;
+typedef std::tuple<AgradCdfExpModNormal, type_v_479> AgradCdfExpModNormal_v_479;
+typedef std::tuple<AgradCdfExpModNormal, type_v_480> AgradCdfExpModNormal_v_480;
+typedef std::tuple<AgradCdfExpModNormal, type_v_481> AgradCdfExpModNormal_v_481;
+typedef std::tuple<AgradCdfExpModNormal, type_v_482> AgradCdfExpModNormal_v_482;
+typedef std::tuple<AgradCdfExpModNormal, type_v_483> AgradCdfExpModNormal_v_483;
+typedef std::tuple<AgradCdfExpModNormal, type_v_484> AgradCdfExpModNormal_v_484;
+typedef std::tuple<AgradCdfExpModNormal, type_v_485> AgradCdfExpModNormal_v_485;
+typedef std::tuple<AgradCdfExpModNormal, type_v_486> AgradCdfExpModNormal_v_486;
+typedef std::tuple<AgradCdfExpModNormal, type_v_487> AgradCdfExpModNormal_v_487;
+typedef std::tuple<AgradCdfExpModNormal, type_v_488> AgradCdfExpModNormal_v_488;
+typedef std::tuple<AgradCdfExpModNormal, type_v_489> AgradCdfExpModNormal_v_489;
+typedef std::tuple<AgradCdfExpModNormal, type_v_490> AgradCdfExpModNormal_v_490;
+typedef std::tuple<AgradCdfExpModNormal, type_v_491> AgradCdfExpModNormal_v_491;
+typedef std::tuple<AgradCdfExpModNormal, type_v_492> AgradCdfExpModNormal_v_492;
+typedef std::tuple<AgradCdfExpModNormal, type_v_493> AgradCdfExpModNormal_v_493;
+typedef std::tuple<AgradCdfExpModNormal, type_v_494> AgradCdfExpModNormal_v_494;
+typedef std::tuple<AgradCdfExpModNormal, type_v_495> AgradCdfExpModNormal_v_495;
+typedef std::tuple<AgradCdfExpModNormal, type_v_496> AgradCdfExpModNormal_v_496;
+typedef std::tuple<AgradCdfExpModNormal, type_v_497> AgradCdfExpModNormal_v_497;
+typedef std::tuple<AgradCdfExpModNormal, type_v_498> AgradCdfExpModNormal_v_498;
+typedef std::tuple<AgradCdfExpModNormal, type_v_499> AgradCdfExpModNormal_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_400, AgradCdfTestFixture, AgradCdfExpModNormal_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_401, AgradCdfTestFixture, AgradCdfExpModNormal_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_402, AgradCdfTestFixture, AgradCdfExpModNormal_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_403, AgradCdfTestFixture, AgradCdfExpModNormal_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_404, AgradCdfTestFixture, AgradCdfExpModNormal_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_405, AgradCdfTestFixture, AgradCdfExpModNormal_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_406, AgradCdfTestFixture, AgradCdfExpModNormal_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_407, AgradCdfTestFixture, AgradCdfExpModNormal_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_408, AgradCdfTestFixture, AgradCdfExpModNormal_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_409, AgradCdfTestFixture, AgradCdfExpModNormal_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_410, AgradCdfTestFixture, AgradCdfExpModNormal_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_411, AgradCdfTestFixture, AgradCdfExpModNormal_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_412, AgradCdfTestFixture, AgradCdfExpModNormal_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_413, AgradCdfTestFixture, AgradCdfExpModNormal_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_414, AgradCdfTestFixture, AgradCdfExpModNormal_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_415, AgradCdfTestFixture, AgradCdfExpModNormal_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_416, AgradCdfTestFixture, AgradCdfExpModNormal_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_417, AgradCdfTestFixture, AgradCdfExpModNormal_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_418, AgradCdfTestFixture, AgradCdfExpModNormal_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_419, AgradCdfTestFixture, AgradCdfExpModNormal_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_420, AgradCdfTestFixture, AgradCdfExpModNormal_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_421, AgradCdfTestFixture, AgradCdfExpModNormal_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_422, AgradCdfTestFixture, AgradCdfExpModNormal_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_423, AgradCdfTestFixture, AgradCdfExpModNormal_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_424, AgradCdfTestFixture, AgradCdfExpModNormal_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_425, AgradCdfTestFixture, AgradCdfExpModNormal_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_426, AgradCdfTestFixture, AgradCdfExpModNormal_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_427, AgradCdfTestFixture, AgradCdfExpModNormal_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_428, AgradCdfTestFixture, AgradCdfExpModNormal_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_429, AgradCdfTestFixture, AgradCdfExpModNormal_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_430, AgradCdfTestFixture, AgradCdfExpModNormal_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_431, AgradCdfTestFixture, AgradCdfExpModNormal_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_432, AgradCdfTestFixture, AgradCdfExpModNormal_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_433, AgradCdfTestFixture, AgradCdfExpModNormal_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_434, AgradCdfTestFixture, AgradCdfExpModNormal_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_435, AgradCdfTestFixture, AgradCdfExpModNormal_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_436, AgradCdfTestFixture, AgradCdfExpModNormal_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_437, AgradCdfTestFixture, AgradCdfExpModNormal_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_438, AgradCdfTestFixture, AgradCdfExpModNormal_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_439, AgradCdfTestFixture, AgradCdfExpModNormal_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_440, AgradCdfTestFixture, AgradCdfExpModNormal_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_441, AgradCdfTestFixture, AgradCdfExpModNormal_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_442, AgradCdfTestFixture, AgradCdfExpModNormal_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_443, AgradCdfTestFixture, AgradCdfExpModNormal_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_444, AgradCdfTestFixture, AgradCdfExpModNormal_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_445, AgradCdfTestFixture, AgradCdfExpModNormal_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_446, AgradCdfTestFixture, AgradCdfExpModNormal_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_447, AgradCdfTestFixture, AgradCdfExpModNormal_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_448, AgradCdfTestFixture, AgradCdfExpModNormal_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_449, AgradCdfTestFixture, AgradCdfExpModNormal_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_450, AgradCdfTestFixture, AgradCdfExpModNormal_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_451, AgradCdfTestFixture, AgradCdfExpModNormal_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_452, AgradCdfTestFixture, AgradCdfExpModNormal_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_453, AgradCdfTestFixture, AgradCdfExpModNormal_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_454, AgradCdfTestFixture, AgradCdfExpModNormal_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_455, AgradCdfTestFixture, AgradCdfExpModNormal_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_456, AgradCdfTestFixture, AgradCdfExpModNormal_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_457, AgradCdfTestFixture, AgradCdfExpModNormal_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_458, AgradCdfTestFixture, AgradCdfExpModNormal_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_459, AgradCdfTestFixture, AgradCdfExpModNormal_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_460, AgradCdfTestFixture, AgradCdfExpModNormal_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_461, AgradCdfTestFixture, AgradCdfExpModNormal_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_462, AgradCdfTestFixture, AgradCdfExpModNormal_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_463, AgradCdfTestFixture, AgradCdfExpModNormal_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_464, AgradCdfTestFixture, AgradCdfExpModNormal_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_465, AgradCdfTestFixture, AgradCdfExpModNormal_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_466, AgradCdfTestFixture, AgradCdfExpModNormal_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_467, AgradCdfTestFixture, AgradCdfExpModNormal_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_468, AgradCdfTestFixture, AgradCdfExpModNormal_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_469, AgradCdfTestFixture, AgradCdfExpModNormal_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_470, AgradCdfTestFixture, AgradCdfExpModNormal_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_471, AgradCdfTestFixture, AgradCdfExpModNormal_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_472, AgradCdfTestFixture, AgradCdfExpModNormal_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_473, AgradCdfTestFixture, AgradCdfExpModNormal_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_474, AgradCdfTestFixture, AgradCdfExpModNormal_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_475, AgradCdfTestFixture, AgradCdfExpModNormal_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_476, AgradCdfTestFixture, AgradCdfExpModNormal_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_477, AgradCdfTestFixture, AgradCdfExpModNormal_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_478, AgradCdfTestFixture, AgradCdfExpModNormal_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_479, AgradCdfTestFixture, AgradCdfExpModNormal_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_480, AgradCdfTestFixture, AgradCdfExpModNormal_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_481, AgradCdfTestFixture, AgradCdfExpModNormal_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_482, AgradCdfTestFixture, AgradCdfExpModNormal_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_483, AgradCdfTestFixture, AgradCdfExpModNormal_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_484, AgradCdfTestFixture, AgradCdfExpModNormal_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_485, AgradCdfTestFixture, AgradCdfExpModNormal_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_486, AgradCdfTestFixture, AgradCdfExpModNormal_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_487, AgradCdfTestFixture, AgradCdfExpModNormal_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_488, AgradCdfTestFixture, AgradCdfExpModNormal_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_489, AgradCdfTestFixture, AgradCdfExpModNormal_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_490, AgradCdfTestFixture, AgradCdfExpModNormal_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_491, AgradCdfTestFixture, AgradCdfExpModNormal_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_492, AgradCdfTestFixture, AgradCdfExpModNormal_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_493, AgradCdfTestFixture, AgradCdfExpModNormal_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_494, AgradCdfTestFixture, AgradCdfExpModNormal_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_495, AgradCdfTestFixture, AgradCdfExpModNormal_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_496, AgradCdfTestFixture, AgradCdfExpModNormal_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_497, AgradCdfTestFixture, AgradCdfExpModNormal_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_498, AgradCdfTestFixture, AgradCdfExpModNormal_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_499, AgradCdfTestFixture, AgradCdfExpModNormal_v_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradCdfExpModNormal, type_vv_400> AgradCdfExpModNormal_vv_400;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_401> AgradCdfExpModNormal_vv_401;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_402> AgradCdfExpModNormal_vv_402;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_403> AgradCdfExpModNormal_vv_403;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_404> AgradCdfExpModNormal_vv_404;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_405> AgradCdfExpModNormal_vv_405;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_406> AgradCdfExpModNormal_vv_406;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_407> AgradCdfExpModNormal_vv_407;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_408> AgradCdfExpModNormal_vv_408;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_409> AgradCdfExpModNormal_vv_409;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_410> AgradCdfExpModNormal_vv_410;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_411> AgradCdfExpModNormal_vv_411;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_412> AgradCdfExpModNormal_vv_412;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_413> AgradCdfExpModNormal_vv_413;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_414> AgradCdfExpModNormal_vv_414;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_415> AgradCdfExpModNormal_vv_415;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_416> AgradCdfExpModNormal_vv_416;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_417> AgradCdfExpModNormal_vv_417;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_418> AgradCdfExpModNormal_vv_418;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_419> AgradCdfExpModNormal_vv_419;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_420> AgradCdfExpModNormal_vv_420;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_421> AgradCdfExpModNormal_vv_421;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_422> AgradCdfExpModNormal_vv_422;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_423> AgradCdfExpModNormal_vv_423;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_424> AgradCdfExpModNormal_vv_424;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_425> AgradCdfExpModNormal_vv_425;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_426> AgradCdfExpModNormal_vv_426;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_427> AgradCdfExpModNormal_vv_427;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_428> AgradCdfExpModNormal_vv_428;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_429> AgradCdfExpModNormal_vv_429;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_430> AgradCdfExpModNormal_vv_430;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_431> AgradCdfExpModNormal_vv_431;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_432> AgradCdfExpModNormal_vv_432;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_433> AgradCdfExpModNormal_vv_433;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_434> AgradCdfExpModNormal_vv_434;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_435> AgradCdfExpModNormal_vv_435;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_436> AgradCdfExpModNormal_vv_436;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_437> AgradCdfExpModNormal_vv_437;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_438> AgradCdfExpModNormal_vv_438;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_439> AgradCdfExpModNormal_vv_439;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_440> AgradCdfExpModNormal_vv_440;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_441> AgradCdfExpModNormal_vv_441;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_442> AgradCdfExpModNormal_vv_442;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_443> AgradCdfExpModNormal_vv_443;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_444> AgradCdfExpModNormal_vv_444;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_445> AgradCdfExpModNormal_vv_445;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_446> AgradCdfExpModNormal_vv_446;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_447> AgradCdfExpModNormal_vv_447;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_448> AgradCdfExpModNormal_vv_448;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_449> AgradCdfExpModNormal_vv_449;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_450> AgradCdfExpModNormal_vv_450;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_451> AgradCdfExpModNormal_vv_451;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_452> AgradCdfExpModNormal_vv_452;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_453> AgradCdfExpModNormal_vv_453;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_454> AgradCdfExpModNormal_vv_454;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_455> AgradCdfExpModNormal_vv_455;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_456> AgradCdfExpModNormal_vv_456;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_457> AgradCdfExpModNormal_vv_457;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_458> AgradCdfExpModNormal_vv_458;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_459> AgradCdfExpModNormal_vv_459;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_460> AgradCdfExpModNormal_vv_460;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_461> AgradCdfExpModNormal_vv_461;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_462> AgradCdfExpModNormal_vv_462;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_463> AgradCdfExpModNormal_vv_463;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_464> AgradCdfExpModNormal_vv_464;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_465> AgradCdfExpModNormal_vv_465;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_466> AgradCdfExpModNormal_vv_466;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_467> AgradCdfExpModNormal_vv_467;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_468> AgradCdfExpModNormal_vv_468;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_469> AgradCdfExpModNormal_vv_469;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_470> AgradCdfExpModNormal_vv_470;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_471> AgradCdfExpModNormal_vv_471;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_472> AgradCdfExpModNormal_vv_472;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_473> AgradCdfExpModNormal_vv_473;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_474> AgradCdfExpModNormal_vv_474;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_475> AgradCdfExpModNormal_vv_475;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_476> AgradCdfExpModNormal_vv_476;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_477> AgradCdfExpModNormal_vv_477;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_478> AgradCdfExpModNormal_vv_478;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_479> AgradCdfExpModNormal_vv_479;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_480> AgradCdfExpModNormal_vv_480;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_481> AgradCdfExpModNormal_vv_481;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_482> AgradCdfExpModNormal_vv_482;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_483> AgradCdfExpModNormal_vv_483;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_484> AgradCdfExpModNormal_vv_484;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_485> AgradCdfExpModNormal_vv_485;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_486> AgradCdfExpModNormal_vv_486;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_487> AgradCdfExpModNormal_vv_487;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_488> AgradCdfExpModNormal_vv_488;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_489> AgradCdfExpModNormal_vv_489;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_490> AgradCdfExpModNormal_vv_490;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_491> AgradCdfExpModNormal_vv_491;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_492> AgradCdfExpModNormal_vv_492;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_493> AgradCdfExpModNormal_vv_493;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_494> AgradCdfExpModNormal_vv_494;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_495> AgradCdfExpModNormal_vv_495;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_496> AgradCdfExpModNormal_vv_496;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_497> AgradCdfExpModNormal_vv_497;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_498> AgradCdfExpModNormal_vv_498;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_499> AgradCdfExpModNormal_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_400, AgradCdfTestFixture, AgradCdfExpModNormal_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_401, AgradCdfTestFixture, AgradCdfExpModNormal_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_402, AgradCdfTestFixture, AgradCdfExpModNormal_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_403, AgradCdfTestFixture, AgradCdfExpModNormal_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_404, AgradCdfTestFixture, AgradCdfExpModNormal_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_405, AgradCdfTestFixture, AgradCdfExpModNormal_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_406, AgradCdfTestFixture, AgradCdfExpModNormal_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_407, AgradCdfTestFixture, AgradCdfExpModNormal_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_408, AgradCdfTestFixture, AgradCdfExpModNormal_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_409, AgradCdfTestFixture, AgradCdfExpModNormal_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_410, AgradCdfTestFixture, AgradCdfExpModNormal_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_411, AgradCdfTestFixture, AgradCdfExpModNormal_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_412, AgradCdfTestFixture, AgradCdfExpModNormal_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_413, AgradCdfTestFixture, AgradCdfExpModNormal_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_414, AgradCdfTestFixture, AgradCdfExpModNormal_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_415, AgradCdfTestFixture, AgradCdfExpModNormal_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_416, AgradCdfTestFixture, AgradCdfExpModNormal_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_417, AgradCdfTestFixture, AgradCdfExpModNormal_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_418, AgradCdfTestFixture, AgradCdfExpModNormal_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_419, AgradCdfTestFixture, AgradCdfExpModNormal_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_420, AgradCdfTestFixture, AgradCdfExpModNormal_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_421, AgradCdfTestFixture, AgradCdfExpModNormal_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_422, AgradCdfTestFixture, AgradCdfExpModNormal_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_423, AgradCdfTestFixture, AgradCdfExpModNormal_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_424, AgradCdfTestFixture, AgradCdfExpModNormal_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_425, AgradCdfTestFixture, AgradCdfExpModNormal_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_426, AgradCdfTestFixture, AgradCdfExpModNormal_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_427, AgradCdfTestFixture, AgradCdfExpModNormal_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_428, AgradCdfTestFixture, AgradCdfExpModNormal_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_429, AgradCdfTestFixture, AgradCdfExpModNormal_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_430, AgradCdfTestFixture, AgradCdfExpModNormal_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_431, AgradCdfTestFixture, AgradCdfExpModNormal_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_432, AgradCdfTestFixture, AgradCdfExpModNormal_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_433, AgradCdfTestFixture, AgradCdfExpModNormal_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_434, AgradCdfTestFixture, AgradCdfExpModNormal_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_435, AgradCdfTestFixture, AgradCdfExpModNormal_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_436, AgradCdfTestFixture, AgradCdfExpModNormal_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_437, AgradCdfTestFixture, AgradCdfExpModNormal_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_438, AgradCdfTestFixture, AgradCdfExpModNormal_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_439, AgradCdfTestFixture, AgradCdfExpModNormal_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_440, AgradCdfTestFixture, AgradCdfExpModNormal_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_441, AgradCdfTestFixture, AgradCdfExpModNormal_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_442, AgradCdfTestFixture, AgradCdfExpModNormal_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_443, AgradCdfTestFixture, AgradCdfExpModNormal_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_444, AgradCdfTestFixture, AgradCdfExpModNormal_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_445, AgradCdfTestFixture, AgradCdfExpModNormal_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_446, AgradCdfTestFixture, AgradCdfExpModNormal_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_447, AgradCdfTestFixture, AgradCdfExpModNormal_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_448, AgradCdfTestFixture, AgradCdfExpModNormal_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_449, AgradCdfTestFixture, AgradCdfExpModNormal_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_450, AgradCdfTestFixture, AgradCdfExpModNormal_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_451, AgradCdfTestFixture, AgradCdfExpModNormal_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_452, AgradCdfTestFixture, AgradCdfExpModNormal_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_453, AgradCdfTestFixture, AgradCdfExpModNormal_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_454, AgradCdfTestFixture, AgradCdfExpModNormal_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_455, AgradCdfTestFixture, AgradCdfExpModNormal_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_456, AgradCdfTestFixture, AgradCdfExpModNormal_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_457, AgradCdfTestFixture, AgradCdfExpModNormal_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_458, AgradCdfTestFixture, AgradCdfExpModNormal_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_459, AgradCdfTestFixture, AgradCdfExpModNormal_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_460, AgradCdfTestFixture, AgradCdfExpModNormal_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_461, AgradCdfTestFixture, AgradCdfExpModNormal_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_462, AgradCdfTestFixture, AgradCdfExpModNormal_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_463, AgradCdfTestFixture, AgradCdfExpModNormal_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_464, AgradCdfTestFixture, AgradCdfExpModNormal_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_465, AgradCdfTestFixture, AgradCdfExpModNormal_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_466, AgradCdfTestFixture, AgradCdfExpModNormal_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_467, AgradCdfTestFixture, AgradCdfExpModNormal_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_468, AgradCdfTestFixture, AgradCdfExpModNormal_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_469, AgradCdfTestFixture, AgradCdfExpModNormal_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_470, AgradCdfTestFixture, AgradCdfExpModNormal_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_471, AgradCdfTestFixture, AgradCdfExpModNormal_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_472, AgradCdfTestFixture, AgradCdfExpModNormal_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_473, AgradCdfTestFixture, AgradCdfExpModNormal_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_474, AgradCdfTestFixture, AgradCdfExpModNormal_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_475, AgradCdfTestFixture, AgradCdfExpModNormal_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_476, AgradCdfTestFixture, AgradCdfExpModNormal_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_477, AgradCdfTestFixture, AgradCdfExpModNormal_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_478, AgradCdfTestFixture, AgradCdfExpModNormal_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_479, AgradCdfTestFixture, AgradCdfExpModNormal_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_480, AgradCdfTestFixture, AgradCdfExpModNormal_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_481, AgradCdfTestFixture, AgradCdfExpModNormal_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_482, AgradCdfTestFixture, AgradCdfExpModNormal_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_483, AgradCdfTestFixture, AgradCdfExpModNormal_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_484, AgradCdfTestFixture, AgradCdfExpModNormal_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_485, AgradCdfTestFixture, AgradCdfExpModNormal_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_486, AgradCdfTestFixture, AgradCdfExpModNormal_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_487, AgradCdfTestFixture, AgradCdfExpModNormal_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_488, AgradCdfTestFixture, AgradCdfExpModNormal_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_489, AgradCdfTestFixture, AgradCdfExpModNormal_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_490, AgradCdfTestFixture, AgradCdfExpModNormal_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_491, AgradCdfTestFixture, AgradCdfExpModNormal_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_492, AgradCdfTestFixture, AgradCdfExpModNormal_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_493, AgradCdfTestFixture, AgradCdfExpModNormal_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_494, AgradCdfTestFixture, AgradCdfExpModNormal_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_495, AgradCdfTestFixture, AgradCdfExpModNormal_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_496, AgradCdfTestFixture, AgradCdfExpModNormal_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_497, AgradCdfTestFixture, AgradCdfExpModNormal_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_498, AgradCdfTestFixture, AgradCdfExpModNormal_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_499, AgradCdfTestFixture, AgradCdfExpModNormal_vv_499);
+
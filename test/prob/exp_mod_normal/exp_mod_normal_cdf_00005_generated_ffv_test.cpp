@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+typedef std::tuple<fvar<fvar<var> >, double, double, double, empty, empty> type_ffv_567;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<double>, empty, empty> type_ffv_568;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_569;
+typedef std::tuple<fvar<fvar<var> >, double, double, fvar<fvar<var> >, empty, empty> type_ffv_570;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_571;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_572;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, double, empty, empty> type_ffv_573;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_574;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_575;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_576;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_577;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_578;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_579;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_580;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_581;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_582;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_583;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_584;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty, empty> type_ffv_585;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_586;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_587;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_588;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_589;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_590;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_591;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_592;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_593;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_594;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_595;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_596;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_597;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_598;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_599;
+
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_500> AgradCdfExpModNormal_ffv_500;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_501> AgradCdfExpModNormal_ffv_501;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_502> AgradCdfExpModNormal_ffv_502;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_503> AgradCdfExpModNormal_ffv_503;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_504> AgradCdfExpModNormal_ffv_504;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_505> AgradCdfExpModNormal_ffv_505;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_506> AgradCdfExpModNormal_ffv_506;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_507> AgradCdfExpModNormal_ffv_507;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_508> AgradCdfExpModNormal_ffv_508;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_509> AgradCdfExpModNormal_ffv_509;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_510> AgradCdfExpModNormal_ffv_510;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_511> AgradCdfExpModNormal_ffv_511;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_512> AgradCdfExpModNormal_ffv_512;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_513> AgradCdfExpModNormal_ffv_513;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_514> AgradCdfExpModNormal_ffv_514;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_515> AgradCdfExpModNormal_ffv_515;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_516> AgradCdfExpModNormal_ffv_516;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_517> AgradCdfExpModNormal_ffv_517;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_518> AgradCdfExpModNormal_ffv_518;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_519> AgradCdfExpModNormal_ffv_519;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_520> AgradCdfExpModNormal_ffv_520;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_521> AgradCdfExpModNormal_ffv_521;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_522> AgradCdfExpModNormal_ffv_522;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_523> AgradCdfExpModNormal_ffv_523;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_524> AgradCdfExpModNormal_ffv_524;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_525> AgradCdfExpModNormal_ffv_525;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_526> AgradCdfExpModNormal_ffv_526;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_527> AgradCdfExpModNormal_ffv_527;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_528> AgradCdfExpModNormal_ffv_528;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_529> AgradCdfExpModNormal_ffv_529;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_530> AgradCdfExpModNormal_ffv_530;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_531> AgradCdfExpModNormal_ffv_531;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_532> AgradCdfExpModNormal_ffv_532;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_533> AgradCdfExpModNormal_ffv_533;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_534> AgradCdfExpModNormal_ffv_534;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_535> AgradCdfExpModNormal_ffv_535;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_536> AgradCdfExpModNormal_ffv_536;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_537> AgradCdfExpModNormal_ffv_537;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_538> AgradCdfExpModNormal_ffv_538;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_539> AgradCdfExpModNormal_ffv_539;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_540> AgradCdfExpModNormal_ffv_540;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_541> AgradCdfExpModNormal_ffv_541;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_542> AgradCdfExpModNormal_ffv_542;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_543> AgradCdfExpModNormal_ffv_543;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_544> AgradCdfExpModNormal_ffv_544;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_545> AgradCdfExpModNormal_ffv_545;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_546> AgradCdfExpModNormal_ffv_546;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_547> AgradCdfExpModNormal_ffv_547;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_548> AgradCdfExpModNormal_ffv_548;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_549> AgradCdfExpModNormal_ffv_549;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_550> AgradCdfExpModNormal_ffv_550;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_551> AgradCdfExpModNormal_ffv_551;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_552> AgradCdfExpModNormal_ffv_552;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_553> AgradCdfExpModNormal_ffv_553;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_554> AgradCdfExpModNormal_ffv_554;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_555> AgradCdfExpModNormal_ffv_555;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_556> AgradCdfExpModNormal_ffv_556;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_557> AgradCdfExpModNormal_ffv_557;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_558> AgradCdfExpModNormal_ffv_558;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_559> AgradCdfExpModNormal_ffv_559;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_560> AgradCdfExpModNormal_ffv_560;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_561> AgradCdfExpModNormal_ffv_561;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_562> AgradCdfExpModNormal_ffv_562;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_563> AgradCdfExpModNormal_ffv_563;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_564> AgradCdfExpModNormal_ffv_564;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_565> AgradCdfExpModNormal_ffv_565;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_566> AgradCdfExpModNormal_ffv_566;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_567> AgradCdfExpModNormal_ffv_567;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_568> AgradCdfExpModNormal_ffv_568;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_569> AgradCdfExpModNormal_ffv_569;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_570> AgradCdfExpModNormal_ffv_570;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_571> AgradCdfExpModNormal_ffv_571;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_572> AgradCdfExpModNormal_ffv_572;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_573> AgradCdfExpModNormal_ffv_573;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_574> AgradCdfExpModNormal_ffv_574;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_575> AgradCdfExpModNormal_ffv_575;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_576> AgradCdfExpModNormal_ffv_576;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_577> AgradCdfExpModNormal_ffv_577;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_578> AgradCdfExpModNormal_ffv_578;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_579> AgradCdfExpModNormal_ffv_579;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_580> AgradCdfExpModNormal_ffv_580;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_581> AgradCdfExpModNormal_ffv_581;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_582> AgradCdfExpModNormal_ffv_582;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_583> AgradCdfExpModNormal_ffv_583;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_584> AgradCdfExpModNormal_ffv_584;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_585> AgradCdfExpModNormal_ffv_585;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_586> AgradCdfExpModNormal_ffv_586;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_587> AgradCdfExpModNormal_ffv_587;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_588> AgradCdfExpModNormal_ffv_588;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_589> AgradCdfExpModNormal_ffv_589;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_590> AgradCdfExpModNormal_ffv_590;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_591> AgradCdfExpModNormal_ffv_591;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_592> AgradCdfExpModNormal_ffv_592;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_593> AgradCdfExpModNormal_ffv_593;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_594> AgradCdfExpModNormal_ffv_594;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_595> AgradCdfExpModNormal_ffv_595;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_596> AgradCdfExpModNormal_ffv_596;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_597> AgradCdfExpModNormal_ffv_597;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_598> AgradCdfExpModNormal_ffv_598;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_599> AgradCdfExpModNormal_ffv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_500, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_501, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_502, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_503, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_504, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_505, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_506, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_507, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_508, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_509, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_510, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_511, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_512, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_513, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_514, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_515, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_516, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_517, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_518, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_519, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_520, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_521, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_522, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_523, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_524, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_525, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_526, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_527, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_528, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_529, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_530, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_531, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_532, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_533, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_534, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_535, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_536, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_537, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_538, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_539, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_540, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_541, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_542, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_543, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_544, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_545, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_546, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_547, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_548, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_549, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_550, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_551, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_552, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_553, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_554, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_555, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_556, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_557, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_558, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_559, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_560, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_561, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_562, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_563, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_564, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_565, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_566, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_567, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_568, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_569, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_570, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_571, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_572, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_573, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_574, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_575, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_576, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_577, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_578, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_579, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_580, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_581, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_582, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_583, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_584, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_585, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_586, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_587, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_588, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_589, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_590, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_591, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_592, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_593, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_594, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_595, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_596, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_597, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_598, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_599, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradCdfExpModNormal, type_v_500> AgradCdfExpModNormal_v_500;
+typedef std::tuple<AgradCdfExpModNormal, type_v_501> AgradCdfExpModNormal_v_501;
+typedef std::tuple<AgradCdfExpModNormal, type_v_502> AgradCdfExpModNormal_v_502;
+typedef std::tuple<AgradCdfExpModNormal, type_v_503> AgradCdfExpModNormal_v_503;
+typedef std::tuple<AgradCdfExpModNormal, type_v_504> AgradCdfExpModNormal_v_504;
+typedef std::tuple<AgradCdfExpModNormal, type_v_505> AgradCdfExpModNormal_v_505;
+typedef std::tuple<AgradCdfExpModNormal, type_v_506> AgradCdfExpModNormal_v_506;
+typedef std::tuple<AgradCdfExpModNormal, type_v_507> AgradCdfExpModNormal_v_507;
+typedef std::tuple<AgradCdfExpModNormal, type_v_508> AgradCdfExpModNormal_v_508;
+typedef std::tuple<AgradCdfExpModNormal, type_v_509> AgradCdfExpModNormal_v_509;
+typedef std::tuple<AgradCdfExpModNormal, type_v_510> AgradCdfExpModNormal_v_510;
+typedef std::tuple<AgradCdfExpModNormal, type_v_511> AgradCdfExpModNormal_v_511;
+typedef std::tuple<AgradCdfExpModNormal, type_v_512> AgradCdfExpModNormal_v_512;
+typedef std::tuple<AgradCdfExpModNormal, type_v_513> AgradCdfExpModNormal_v_513;
+typedef std::tuple<AgradCdfExpModNormal, type_v_514> AgradCdfExpModNormal_v_514;
+typedef std::tuple<AgradCdfExpModNormal, type_v_515> AgradCdfExpModNormal_v_515;
+typedef std::tuple<AgradCdfExpModNormal, type_v_516> AgradCdfExpModNormal_v_516;
+typedef std::tuple<AgradCdfExpModNormal, type_v_517> AgradCdfExpModNormal_v_517;
+typedef std::tuple<AgradCdfExpModNormal, type_v_518> AgradCdfExpModNormal_v_518;
+typedef std::tuple<AgradCdfExpModNormal, type_v_519> AgradCdfExpModNormal_v_519;
+typedef std::tuple<AgradCdfExpModNormal, type_v_520> AgradCdfExpModNormal_v_520;
+typedef std::tuple<AgradCdfExpModNormal, type_v_521> AgradCdfExpModNormal_v_521;
+typedef std::tuple<AgradCdfExpModNormal, type_v_522> AgradCdfExpModNormal_v_522;
+typedef std::tuple<AgradCdfExpModNormal, type_v_523> AgradCdfExpModNormal_v_523;
+typedef std::tuple<AgradCdfExpModNormal, type_v_524> AgradCdfExpModNormal_v_524;
+typedef std::tuple<AgradCdfExpModNormal, type_v_525> AgradCdfExpModNormal_v_525;
+typedef std::tuple<AgradCdfExpModNormal, type_v_526> AgradCdfExpModNormal_v_526;
+typedef std::tuple<AgradCdfExpModNormal, type_v_527> AgradCdfExpModNormal_v_527;
+typedef std::tuple<AgradCdfExpModNormal, type_v_528> AgradCdfExpModNormal_v_528;
+typedef std::tuple<AgradCdfExpModNormal, type_v_529> AgradCdfExpModNormal_v_529;
+typedef std::tuple<AgradCdfExpModNormal, type_v_530> AgradCdfExpModNormal_v_530;
+typedef std::tuple<AgradCdfExpModNormal, type_v_531> AgradCdfExpModNormal_v_531;
+typedef std::tuple<AgradCdfExpModNormal, type_v_532> AgradCdfExpModNormal_v_532;
+typedef std::tuple<AgradCdfExpModNormal, type_v_533> AgradCdfExpModNormal_v_533;
+typedef std::tuple<AgradCdfExpModNormal, type_v_534> AgradCdfExpModNormal_v_534;
+typedef std::tuple<AgradCdfExpModNormal, type_v_535> AgradCdfExpModNormal_v_535;
+typedef std::tuple<AgradCdfExpModNormal, type_v_536> AgradCdfExpModNormal_v_536;
+typedef std::tuple<AgradCdfExpModNormal, type_v_537> AgradCdfExpModNormal_v_537;
+typedef std::tuple<AgradCdfExpModNormal, type_v_538> AgradCdfExpModNormal_v_538;
+typedef std::tuple<AgradCdfExpModNormal, type_v_539> AgradCdfExpModNormal_v_539;
+typedef std::tuple<AgradCdfExpModNormal, type_v_540> AgradCdfExpModNormal_v_540;
+typedef std::tuple<AgradCdfExpModNormal, type_v_541> AgradCdfExpModNormal_v_541;
+typedef std::tuple<AgradCdfExpModNormal, type_v_542> AgradCdfExpModNormal_v_542;
+typedef std::tuple<AgradCdfExpModNormal, type_v_543> AgradCdfExpModNormal_v_543;
+typedef std::tuple<AgradCdfExpModNormal, type_v_544> AgradCdfExpModNormal_v_544;
+typedef std::tuple<AgradCdfExpModNormal, type_v_545> AgradCdfExpModNormal_v_545;
+typedef std::tuple<AgradCdfExpModNormal, type_v_546> AgradCdfExpModNormal_v_546;
+typedef std::tuple<AgradCdfExpModNormal, type_v_547> AgradCdfExpModNormal_v_547;
+typedef std::tuple<AgradCdfExpModNormal, type_v_548> AgradCdfExpModNormal_v_548;
+typedef std::tuple<AgradCdfExpModNormal, type_v_549> AgradCdfExpModNormal_v_549;
+typedef std::tuple<AgradCdfExpModNormal, type_v_550> AgradCdfExpModNormal_v_550;
+typedef std::tuple<AgradCdfExpModNormal, type_v_551> AgradCdfExpModNormal_v_551;
+typedef std::tuple<AgradCdfExpModNormal, type_v_552> AgradCdfExpModNormal_v_552;
+typedef std::tuple<AgradCdfExpModNormal, type_v_553> AgradCdfExpModNormal_v_553;
+typedef std::tuple<AgradCdfExpModNormal, type_v_554> AgradCdfExpModNormal_v_554;
+typedef std::tuple<AgradCdfExpModNormal, type_v_555> AgradCdfExpModNormal_v_555;
+typedef std::tuple<AgradCdfExpModNormal, type_v_556> AgradCdfExpModNormal_v_556;
+typedef std::tuple<AgradCdfExpModNormal, type_v_557> AgradCdfExpModNormal_v_557;
+typedef std::tuple<AgradCdfExpModNormal, type_v_558> AgradCdfExpModNormal_v_558;
+typedef std::tuple<AgradCdfExpModNormal, type_v_559> AgradCdfExpModNormal_v_559;
+typedef std::tuple<AgradCdfExpModNormal, type_v_560> AgradCdfExpModNormal_v_560;
+typedef std::tuple<AgradCdfExpModNormal, type_v_561> AgradCdfExpModNormal_v_561;
+typedef std::tuple<AgradCdfExpModNormal, type_v_562> AgradCdfExpModNormal_v_562;
+typedef std::tuple<AgradCdfExpModNormal, type_v_563> AgradCdfExpModNormal_v_563;
+typedef std::tuple<AgradCdfExpModNormal, type_v_564> AgradCdfExpModNormal_v_564;
+typedef std::tuple<AgradCdfExpModNormal, type_v_565> AgradCdfExpModNormal_v_565;
+typedef std::tuple<AgradCdfExpModNormal, type_v_566> AgradCdfExpModNormal_v_566;
+typedef std::tuple<AgradCdfExpModNormal, type_v_567> AgradCdfExpModNormal_v_567;
+typedef std::tuple<AgradCdfExpModNormal, type_v_568> AgradCdfExpModNormal_v_568;
+typedef std::tuple<AgradCdfExpModNormal, type_v_569> AgradCdfExpModNormal_v_569;
+typedef std::tuple<AgradCdfExpModNormal, type_v_570> AgradCdfExpModNormal_v_570;
+typedef std::tuple<AgradCdfExpModNormal, type_v_571> AgradCdfExpModNormal_v_571;
+typedef std::tuple<AgradCdfExpModNormal, type_v_572> AgradCdfExpModNormal_v_572;
+typedef std::tuple<AgradCdfExpModNormal, type_v_573> AgradCdfExpModNormal_v_573;
+typedef std::tuple<AgradCdfExpModNormal, type_v_574> AgradCdfExpModNormal_v_574;
+typedef std::tuple<AgradCdfExpModNormal, type_v_575> AgradCdfExpModNormal_v_575;
+typedef std::tuple<AgradCdfExpModNormal, type_v_576> AgradCdfExpModNormal_v_576;
+typedef std::tuple<AgradCdfExpModNormal, type_v_577> AgradCdfExpModNormal_v_577;
+typedef std::tuple<AgradCdfExpModNormal, type_v_578> AgradCdfExpModNormal_v_578;
+typedef std::tuple<AgradCdfExpModNormal, type_v_579> AgradCdfExpModNormal_v_579;
+typedef std::tuple<AgradCdfExpModNormal, type_v_580> AgradCdfExpModNormal_v_580;
+typedef std::tuple<AgradCdfExpModNormal, type_v_581> AgradCdfExpModNormal_v_581;
+typedef std::tuple<AgradCdfExpModNormal, type_v_582> AgradCdfExpModNormal_v_582;
+typedef std::tuple<AgradCdfExpModNormal, type_v_583> AgradCdfExpModNormal_v_583;
+typedef std::tuple<AgradCdfExpModNormal, type_v_584> AgradCdfExpModNormal_v_584;
+typedef std::tuple<AgradCdfExpModNormal, type_v_585> AgradCdfExpModNormal_v_585;
+typedef std::tuple<AgradCdfExpModNormal, type_v_586> AgradCdfExpModNormal_v_586;
+typedef std::tuple<AgradCdfExpModNormal, type_v_587> AgradCdfExpModNormal_v_587;
+typedef std::tuple<AgradCdfExpModNormal, type_v_588> AgradCdfExpModNormal_v_588;
+typedef std::tuple<AgradCdfExpModNormal, type_v_589> AgradCdfExpModNormal_v_589;
+typedef std::tuple<AgradCdfExpModNormal, type_v_590> AgradCdfExpModNormal_v_590;
+typedef std::tuple<AgradCdfExpModNormal, type_v_591> AgradCdfExpModNormal_v_591;
+typedef std::tuple<AgradCdfExpModNormal, type_v_592> AgradCdfExpModNormal_v_592;
+typedef std::tuple<AgradCdfExpModNormal, type_v_593> AgradCdfExpModNormal_v_593;
+typedef std::tuple<AgradCdfExpModNormal, type_v_594> AgradCdfExpModNormal_v_594;
+typedef std::tuple<AgradCdfExpModNormal, type_v_595> AgradCdfExpModNormal_v_595;
+typedef std::tuple<AgradCdfExpModNormal, type_v_596> AgradCdfExpModNormal_v_596;
+typedef std::tuple<AgradCdfExpModNormal, type_v_597> AgradCdfExpModNormal_v_597;
+typedef std::tuple<AgradCdfExpModNormal, type_v_598> AgradCdfExpModNormal_v_598;
+typedef std::tuple<AgradCdfExpModNormal, type_v_599> AgradCdfExpModNormal_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_500, AgradCdfTestFixture, AgradCdfExpModNormal_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_501, AgradCdfTestFixture, AgradCdfExpModNormal_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_502, AgradCdfTestFixture, AgradCdfExpModNormal_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_503, AgradCdfTestFixture, AgradCdfExpModNormal_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_504, AgradCdfTestFixture, AgradCdfExpModNormal_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_505, AgradCdfTestFixture, AgradCdfExpModNormal_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_506, AgradCdfTestFixture, AgradCdfExpModNormal_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_507, AgradCdfTestFixture, AgradCdfExpModNormal_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_508, AgradCdfTestFixture, AgradCdfExpModNormal_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_509, AgradCdfTestFixture, AgradCdfExpModNormal_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_510, AgradCdfTestFixture, AgradCdfExpModNormal_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_511, AgradCdfTestFixture, AgradCdfExpModNormal_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_512, AgradCdfTestFixture, AgradCdfExpModNormal_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_513, AgradCdfTestFixture, AgradCdfExpModNormal_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_514, AgradCdfTestFixture, AgradCdfExpModNormal_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_515, AgradCdfTestFixture, AgradCdfExpModNormal_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_516, AgradCdfTestFixture, AgradCdfExpModNormal_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_517, AgradCdfTestFixture, AgradCdfExpModNormal_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_518, AgradCdfTestFixture, AgradCdfExpModNormal_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_519, AgradCdfTestFixture, AgradCdfExpModNormal_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_520, AgradCdfTestFixture, AgradCdfExpModNormal_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_521, AgradCdfTestFixture, AgradCdfExpModNormal_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_522, AgradCdfTestFixture, AgradCdfExpModNormal_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_523, AgradCdfTestFixture, AgradCdfExpModNormal_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_524, AgradCdfTestFixture, AgradCdfExpModNormal_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_525, AgradCdfTestFixture, AgradCdfExpModNormal_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_526, AgradCdfTestFixture, AgradCdfExpModNormal_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_527, AgradCdfTestFixture, AgradCdfExpModNormal_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_528, AgradCdfTestFixture, AgradCdfExpModNormal_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_529, AgradCdfTestFixture, AgradCdfExpModNormal_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_530, AgradCdfTestFixture, AgradCdfExpModNormal_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_531, AgradCdfTestFixture, AgradCdfExpModNormal_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_532, AgradCdfTestFixture, AgradCdfExpModNormal_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_533, AgradCdfTestFixture, AgradCdfExpModNormal_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_534, AgradCdfTestFixture, AgradCdfExpModNormal_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_535, AgradCdfTestFixture, AgradCdfExpModNormal_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_536, AgradCdfTestFixture, AgradCdfExpModNormal_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_537, AgradCdfTestFixture, AgradCdfExpModNormal_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_538, AgradCdfTestFixture, AgradCdfExpModNormal_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_539, AgradCdfTestFixture, AgradCdfExpModNormal_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_540, AgradCdfTestFixture, AgradCdfExpModNormal_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_541, AgradCdfTestFixture, AgradCdfExpModNormal_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_542, AgradCdfTestFixture, AgradCdfExpModNormal_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_543, AgradCdfTestFixture, AgradCdfExpModNormal_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_544, AgradCdfTestFixture, AgradCdfExpModNormal_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_545, AgradCdfTestFixture, AgradCdfExpModNormal_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_546, AgradCdfTestFixture, AgradCdfExpModNormal_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_547, AgradCdfTestFixture, AgradCdfExpModNormal_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_548, AgradCdfTestFixture, AgradCdfExpModNormal_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_549, AgradCdfTestFixture, AgradCdfExpModNormal_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_550, AgradCdfTestFixture, AgradCdfExpModNormal_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_551, AgradCdfTestFixture, AgradCdfExpModNormal_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_552, AgradCdfTestFixture, AgradCdfExpModNormal_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_553, AgradCdfTestFixture, AgradCdfExpModNormal_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_554, AgradCdfTestFixture, AgradCdfExpModNormal_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_555, AgradCdfTestFixture, AgradCdfExpModNormal_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_556, AgradCdfTestFixture, AgradCdfExpModNormal_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_557, AgradCdfTestFixture, AgradCdfExpModNormal_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_558, AgradCdfTestFixture, AgradCdfExpModNormal_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_559, AgradCdfTestFixture, AgradCdfExpModNormal_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_560, AgradCdfTestFixture, AgradCdfExpModNormal_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_561, AgradCdfTestFixture, AgradCdfExpModNormal_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_562, AgradCdfTestFixture, AgradCdfExpModNormal_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_563, AgradCdfTestFixture, AgradCdfExpModNormal_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_564, AgradCdfTestFixture, AgradCdfExpModNormal_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_565, AgradCdfTestFixture, AgradCdfExpModNormal_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_566, AgradCdfTestFixture, AgradCdfExpModNormal_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_567, AgradCdfTestFixture, AgradCdfExpModNormal_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_568, AgradCdfTestFixture, AgradCdfExpModNormal_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_569, AgradCdfTestFixture, AgradCdfExpModNormal_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_570, AgradCdfTestFixture, AgradCdfExpModNormal_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_571, AgradCdfTestFixture, AgradCdfExpModNormal_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_572, AgradCdfTestFixture, AgradCdfExpModNormal_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_573, AgradCdfTestFixture, AgradCdfExpModNormal_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_574, AgradCdfTestFixture, AgradCdfExpModNormal_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_575, AgradCdfTestFixture, AgradCdfExpModNormal_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_576, AgradCdfTestFixture, AgradCdfExpModNormal_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_577, AgradCdfTestFixture, AgradCdfExpModNormal_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_578, AgradCdfTestFixture, AgradCdfExpModNormal_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_579, AgradCdfTestFixture, AgradCdfExpModNormal_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_580, AgradCdfTestFixture, AgradCdfExpModNormal_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_581, AgradCdfTestFixture, AgradCdfExpModNormal_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_582, AgradCdfTestFixture, AgradCdfExpModNormal_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_583, AgradCdfTestFixture, AgradCdfExpModNormal_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_584, AgradCdfTestFixture, AgradCdfExpModNormal_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_585, AgradCdfTestFixture, AgradCdfExpModNormal_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_586, AgradCdfTestFixture, AgradCdfExpModNormal_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_587, AgradCdfTestFixture, AgradCdfExpModNormal_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_588, AgradCdfTestFixture, AgradCdfExpModNormal_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_589, AgradCdfTestFixture, AgradCdfExpModNormal_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_590, AgradCdfTestFixture, AgradCdfExpModNormal_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_591, AgradCdfTestFixture, AgradCdfExpModNormal_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_592, AgradCdfTestFixture, AgradCdfExpModNormal_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_593, AgradCdfTestFixture, AgradCdfExpModNormal_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_594, AgradCdfTestFixture, AgradCdfExpModNormal_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_595, AgradCdfTestFixture, AgradCdfExpModNormal_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_596, AgradCdfTestFixture, AgradCdfExpModNormal_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_597, AgradCdfTestFixture, AgradCdfExpModNormal_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_598, AgradCdfTestFixture, AgradCdfExpModNormal_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_599, AgradCdfTestFixture, AgradCdfExpModNormal_v_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+typedef std::tuple<var, double, double, double, empty, empty> type_vv_567;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_vv_568;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_569;
+typedef std::tuple<var, double, double, var, empty, empty> type_vv_570;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_vv_571;
+typedef std::tuple<var, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_572;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_vv_573;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_574;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_575;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_vv_576;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_577;
+typedef std::tuple<var, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_578;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_579;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_580;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_581;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_582;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_583;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_584;
+typedef std::tuple<var, double, var, double, empty, empty> type_vv_585;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_vv_586;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_587;
+typedef std::tuple<var, double, var, var, empty, empty> type_vv_588;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_vv_589;
+typedef std::tuple<var, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_590;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_vv_591;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_592;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_593;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_vv_594;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_595;
+typedef std::tuple<var, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_596;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_597;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_598;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_599;
+
+typedef std::tuple<AgradCdfExpModNormal, type_vv_500> AgradCdfExpModNormal_vv_500;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_501> AgradCdfExpModNormal_vv_501;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_502> AgradCdfExpModNormal_vv_502;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_503> AgradCdfExpModNormal_vv_503;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_504> AgradCdfExpModNormal_vv_504;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_505> AgradCdfExpModNormal_vv_505;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_506> AgradCdfExpModNormal_vv_506;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_507> AgradCdfExpModNormal_vv_507;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_508> AgradCdfExpModNormal_vv_508;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_509> AgradCdfExpModNormal_vv_509;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_510> AgradCdfExpModNormal_vv_510;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_511> AgradCdfExpModNormal_vv_511;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_512> AgradCdfExpModNormal_vv_512;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_513> AgradCdfExpModNormal_vv_513;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_514> AgradCdfExpModNormal_vv_514;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_515> AgradCdfExpModNormal_vv_515;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_516> AgradCdfExpModNormal_vv_516;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_517> AgradCdfExpModNormal_vv_517;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_518> AgradCdfExpModNormal_vv_518;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_519> AgradCdfExpModNormal_vv_519;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_520> AgradCdfExpModNormal_vv_520;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_521> AgradCdfExpModNormal_vv_521;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_522> AgradCdfExpModNormal_vv_522;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_523> AgradCdfExpModNormal_vv_523;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_524> AgradCdfExpModNormal_vv_524;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_525> AgradCdfExpModNormal_vv_525;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_526> AgradCdfExpModNormal_vv_526;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_527> AgradCdfExpModNormal_vv_527;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_528> AgradCdfExpModNormal_vv_528;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_529> AgradCdfExpModNormal_vv_529;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_530> AgradCdfExpModNormal_vv_530;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_531> AgradCdfExpModNormal_vv_531;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_532> AgradCdfExpModNormal_vv_532;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_533> AgradCdfExpModNormal_vv_533;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_534> AgradCdfExpModNormal_vv_534;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_535> AgradCdfExpModNormal_vv_535;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_536> AgradCdfExpModNormal_vv_536;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_537> AgradCdfExpModNormal_vv_537;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_538> AgradCdfExpModNormal_vv_538;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_539> AgradCdfExpModNormal_vv_539;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_540> AgradCdfExpModNormal_vv_540;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_541> AgradCdfExpModNormal_vv_541;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_542> AgradCdfExpModNormal_vv_542;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_543> AgradCdfExpModNormal_vv_543;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_544> AgradCdfExpModNormal_vv_544;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_545> AgradCdfExpModNormal_vv_545;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_546> AgradCdfExpModNormal_vv_546;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_547> AgradCdfExpModNormal_vv_547;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_548> AgradCdfExpModNormal_vv_548;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_549> AgradCdfExpModNormal_vv_549;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_550> AgradCdfExpModNormal_vv_550;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_551> AgradCdfExpModNormal_vv_551;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_552> AgradCdfExpModNormal_vv_552;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_553> AgradCdfExpModNormal_vv_553;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_554> AgradCdfExpModNormal_vv_554;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_555> AgradCdfExpModNormal_vv_555;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_556> AgradCdfExpModNormal_vv_556;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_557> AgradCdfExpModNormal_vv_557;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_558> AgradCdfExpModNormal_vv_558;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_559> AgradCdfExpModNormal_vv_559;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_560> AgradCdfExpModNormal_vv_560;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_561> AgradCdfExpModNormal_vv_561;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_562> AgradCdfExpModNormal_vv_562;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_563> AgradCdfExpModNormal_vv_563;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_564> AgradCdfExpModNormal_vv_564;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_565> AgradCdfExpModNormal_vv_565;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_566> AgradCdfExpModNormal_vv_566;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_567> AgradCdfExpModNormal_vv_567;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_568> AgradCdfExpModNormal_vv_568;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_569> AgradCdfExpModNormal_vv_569;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_570> AgradCdfExpModNormal_vv_570;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_571> AgradCdfExpModNormal_vv_571;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_572> AgradCdfExpModNormal_vv_572;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_573> AgradCdfExpModNormal_vv_573;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_574> AgradCdfExpModNormal_vv_574;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_575> AgradCdfExpModNormal_vv_575;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_576> AgradCdfExpModNormal_vv_576;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_577> AgradCdfExpModNormal_vv_577;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_578> AgradCdfExpModNormal_vv_578;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_579> AgradCdfExpModNormal_vv_579;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_580> AgradCdfExpModNormal_vv_580;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_581> AgradCdfExpModNormal_vv_581;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_582> AgradCdfExpModNormal_vv_582;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_583> AgradCdfExpModNormal_vv_583;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_584> AgradCdfExpModNormal_vv_584;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_585> AgradCdfExpModNormal_vv_585;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_586> AgradCdfExpModNormal_vv_586;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_587> AgradCdfExpModNormal_vv_587;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_588> AgradCdfExpModNormal_vv_588;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_589> AgradCdfExpModNormal_vv_589;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_590> AgradCdfExpModNormal_vv_590;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_591> AgradCdfExpModNormal_vv_591;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_592> AgradCdfExpModNormal_vv_592;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_593> AgradCdfExpModNormal_vv_593;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_594> AgradCdfExpModNormal_vv_594;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_595> AgradCdfExpModNormal_vv_595;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_596> AgradCdfExpModNormal_vv_596;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_597> AgradCdfExpModNormal_vv_597;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_598> AgradCdfExpModNormal_vv_598;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_599> AgradCdfExpModNormal_vv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_500, AgradCdfTestFixture, AgradCdfExpModNormal_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_501, AgradCdfTestFixture, AgradCdfExpModNormal_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_502, AgradCdfTestFixture, AgradCdfExpModNormal_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_503, AgradCdfTestFixture, AgradCdfExpModNormal_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_504, AgradCdfTestFixture, AgradCdfExpModNormal_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_505, AgradCdfTestFixture, AgradCdfExpModNormal_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_506, AgradCdfTestFixture, AgradCdfExpModNormal_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_507, AgradCdfTestFixture, AgradCdfExpModNormal_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_508, AgradCdfTestFixture, AgradCdfExpModNormal_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_509, AgradCdfTestFixture, AgradCdfExpModNormal_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_510, AgradCdfTestFixture, AgradCdfExpModNormal_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_511, AgradCdfTestFixture, AgradCdfExpModNormal_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_512, AgradCdfTestFixture, AgradCdfExpModNormal_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_513, AgradCdfTestFixture, AgradCdfExpModNormal_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_514, AgradCdfTestFixture, AgradCdfExpModNormal_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_515, AgradCdfTestFixture, AgradCdfExpModNormal_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_516, AgradCdfTestFixture, AgradCdfExpModNormal_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_517, AgradCdfTestFixture, AgradCdfExpModNormal_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_518, AgradCdfTestFixture, AgradCdfExpModNormal_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_519, AgradCdfTestFixture, AgradCdfExpModNormal_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_520, AgradCdfTestFixture, AgradCdfExpModNormal_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_521, AgradCdfTestFixture, AgradCdfExpModNormal_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_522, AgradCdfTestFixture, AgradCdfExpModNormal_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_523, AgradCdfTestFixture, AgradCdfExpModNormal_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_524, AgradCdfTestFixture, AgradCdfExpModNormal_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_525, AgradCdfTestFixture, AgradCdfExpModNormal_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_526, AgradCdfTestFixture, AgradCdfExpModNormal_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_527, AgradCdfTestFixture, AgradCdfExpModNormal_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_528, AgradCdfTestFixture, AgradCdfExpModNormal_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_529, AgradCdfTestFixture, AgradCdfExpModNormal_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_530, AgradCdfTestFixture, AgradCdfExpModNormal_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_531, AgradCdfTestFixture, AgradCdfExpModNormal_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_532, AgradCdfTestFixture, AgradCdfExpModNormal_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_533, AgradCdfTestFixture, AgradCdfExpModNormal_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_534, AgradCdfTestFixture, AgradCdfExpModNormal_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_535, AgradCdfTestFixture, AgradCdfExpModNormal_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_536, AgradCdfTestFixture, AgradCdfExpModNormal_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_537, AgradCdfTestFixture, AgradCdfExpModNormal_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_538, AgradCdfTestFixture, AgradCdfExpModNormal_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_539, AgradCdfTestFixture, AgradCdfExpModNormal_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_540, AgradCdfTestFixture, AgradCdfExpModNormal_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_541, AgradCdfTestFixture, AgradCdfExpModNormal_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_542, AgradCdfTestFixture, AgradCdfExpModNormal_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_543, AgradCdfTestFixture, AgradCdfExpModNormal_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_544, AgradCdfTestFixture, AgradCdfExpModNormal_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_545, AgradCdfTestFixture, AgradCdfExpModNormal_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_546, AgradCdfTestFixture, AgradCdfExpModNormal_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_547, AgradCdfTestFixture, AgradCdfExpModNormal_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_548, AgradCdfTestFixture, AgradCdfExpModNormal_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_549, AgradCdfTestFixture, AgradCdfExpModNormal_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_550, AgradCdfTestFixture, AgradCdfExpModNormal_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_551, AgradCdfTestFixture, AgradCdfExpModNormal_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_552, AgradCdfTestFixture, AgradCdfExpModNormal_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_553, AgradCdfTestFixture, AgradCdfExpModNormal_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_554, AgradCdfTestFixture, AgradCdfExpModNormal_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_555, AgradCdfTestFixture, AgradCdfExpModNormal_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_556, AgradCdfTestFixture, AgradCdfExpModNormal_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_557, AgradCdfTestFixture, AgradCdfExpModNormal_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_558, AgradCdfTestFixture, AgradCdfExpModNormal_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_559, AgradCdfTestFixture, AgradCdfExpModNormal_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_560, AgradCdfTestFixture, AgradCdfExpModNormal_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_561, AgradCdfTestFixture, AgradCdfExpModNormal_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_562, AgradCdfTestFixture, AgradCdfExpModNormal_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_563, AgradCdfTestFixture, AgradCdfExpModNormal_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_564, AgradCdfTestFixture, AgradCdfExpModNormal_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_565, AgradCdfTestFixture, AgradCdfExpModNormal_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_566, AgradCdfTestFixture, AgradCdfExpModNormal_vv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_567, AgradCdfTestFixture, AgradCdfExpModNormal_vv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_568, AgradCdfTestFixture, AgradCdfExpModNormal_vv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_569, AgradCdfTestFixture, AgradCdfExpModNormal_vv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_570, AgradCdfTestFixture, AgradCdfExpModNormal_vv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_571, AgradCdfTestFixture, AgradCdfExpModNormal_vv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_572, AgradCdfTestFixture, AgradCdfExpModNormal_vv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_573, AgradCdfTestFixture, AgradCdfExpModNormal_vv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_574, AgradCdfTestFixture, AgradCdfExpModNormal_vv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_575, AgradCdfTestFixture, AgradCdfExpModNormal_vv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_576, AgradCdfTestFixture, AgradCdfExpModNormal_vv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_577, AgradCdfTestFixture, AgradCdfExpModNormal_vv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_578, AgradCdfTestFixture, AgradCdfExpModNormal_vv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_579, AgradCdfTestFixture, AgradCdfExpModNormal_vv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_580, AgradCdfTestFixture, AgradCdfExpModNormal_vv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_581, AgradCdfTestFixture, AgradCdfExpModNormal_vv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_582, AgradCdfTestFixture, AgradCdfExpModNormal_vv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_583, AgradCdfTestFixture, AgradCdfExpModNormal_vv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_584, AgradCdfTestFixture, AgradCdfExpModNormal_vv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_585, AgradCdfTestFixture, AgradCdfExpModNormal_vv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_586, AgradCdfTestFixture, AgradCdfExpModNormal_vv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_587, AgradCdfTestFixture, AgradCdfExpModNormal_vv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_588, AgradCdfTestFixture, AgradCdfExpModNormal_vv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_589, AgradCdfTestFixture, AgradCdfExpModNormal_vv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_590, AgradCdfTestFixture, AgradCdfExpModNormal_vv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_591, AgradCdfTestFixture, AgradCdfExpModNormal_vv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_592, AgradCdfTestFixture, AgradCdfExpModNormal_vv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_593, AgradCdfTestFixture, AgradCdfExpModNormal_vv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_594, AgradCdfTestFixture, AgradCdfExpModNormal_vv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_595, AgradCdfTestFixture, AgradCdfExpModNormal_vv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_596, AgradCdfTestFixture, AgradCdfExpModNormal_vv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_597, AgradCdfTestFixture, AgradCdfExpModNormal_vv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_598, AgradCdfTestFixture, AgradCdfExpModNormal_vv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_599, AgradCdfTestFixture, AgradCdfExpModNormal_vv_599);
+
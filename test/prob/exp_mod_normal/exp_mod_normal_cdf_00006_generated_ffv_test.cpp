@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_600;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_601;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_602;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, double, empty, empty> type_ffv_603;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_604;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_605;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_606;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_607;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_608;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_609;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_610;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_611;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_612;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_613;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_614;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_615;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_616;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_617;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_618;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_619;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_620;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_621;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_622;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_623;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_624;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_625;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_626;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_627;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_628;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_629;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_630;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_631;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_632;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_633;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_634;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_635;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_636;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_637;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_638;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_639;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_640;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_641;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_642;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_643;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_644;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_645;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_646;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_647;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_648;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_649;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_650;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_651;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_652;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_653;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_654;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_655;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_656;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_657;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_658;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_659;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_660;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_661;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_662;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_663;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_664;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_665;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_666;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_667;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_668;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_669;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_670;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_671;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_672;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_673;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_674;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, double, empty, empty> type_ffv_675;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_676;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_677;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_678;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_679;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_680;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_681;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_682;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_683;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_684;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_685;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_686;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_687;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_688;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_689;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_690;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_691;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_692;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_693;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_694;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_695;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_696;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_697;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_698;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_699;
+
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_600> AgradCdfExpModNormal_ffv_600;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_601> AgradCdfExpModNormal_ffv_601;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_602> AgradCdfExpModNormal_ffv_602;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_603> AgradCdfExpModNormal_ffv_603;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_604> AgradCdfExpModNormal_ffv_604;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_605> AgradCdfExpModNormal_ffv_605;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_606> AgradCdfExpModNormal_ffv_606;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_607> AgradCdfExpModNormal_ffv_607;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_608> AgradCdfExpModNormal_ffv_608;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_609> AgradCdfExpModNormal_ffv_609;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_610> AgradCdfExpModNormal_ffv_610;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_611> AgradCdfExpModNormal_ffv_611;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_612> AgradCdfExpModNormal_ffv_612;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_613> AgradCdfExpModNormal_ffv_613;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_614> AgradCdfExpModNormal_ffv_614;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_615> AgradCdfExpModNormal_ffv_615;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_616> AgradCdfExpModNormal_ffv_616;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_617> AgradCdfExpModNormal_ffv_617;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_618> AgradCdfExpModNormal_ffv_618;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_619> AgradCdfExpModNormal_ffv_619;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_620> AgradCdfExpModNormal_ffv_620;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_621> AgradCdfExpModNormal_ffv_621;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_622> AgradCdfExpModNormal_ffv_622;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_623> AgradCdfExpModNormal_ffv_623;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_624> AgradCdfExpModNormal_ffv_624;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_625> AgradCdfExpModNormal_ffv_625;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_626> AgradCdfExpModNormal_ffv_626;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_627> AgradCdfExpModNormal_ffv_627;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_628> AgradCdfExpModNormal_ffv_628;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_629> AgradCdfExpModNormal_ffv_629;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_630> AgradCdfExpModNormal_ffv_630;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_631> AgradCdfExpModNormal_ffv_631;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_632> AgradCdfExpModNormal_ffv_632;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_633> AgradCdfExpModNormal_ffv_633;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_634> AgradCdfExpModNormal_ffv_634;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_635> AgradCdfExpModNormal_ffv_635;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_636> AgradCdfExpModNormal_ffv_636;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_637> AgradCdfExpModNormal_ffv_637;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_638> AgradCdfExpModNormal_ffv_638;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_639> AgradCdfExpModNormal_ffv_639;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_640> AgradCdfExpModNormal_ffv_640;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_641> AgradCdfExpModNormal_ffv_641;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_642> AgradCdfExpModNormal_ffv_642;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_643> AgradCdfExpModNormal_ffv_643;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_644> AgradCdfExpModNormal_ffv_644;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_645> AgradCdfExpModNormal_ffv_645;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_646> AgradCdfExpModNormal_ffv_646;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_647> AgradCdfExpModNormal_ffv_647;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_648> AgradCdfExpModNormal_ffv_648;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_649> AgradCdfExpModNormal_ffv_649;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_650> AgradCdfExpModNormal_ffv_650;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_651> AgradCdfExpModNormal_ffv_651;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_652> AgradCdfExpModNormal_ffv_652;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_653> AgradCdfExpModNormal_ffv_653;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_654> AgradCdfExpModNormal_ffv_654;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_655> AgradCdfExpModNormal_ffv_655;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_656> AgradCdfExpModNormal_ffv_656;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_657> AgradCdfExpModNormal_ffv_657;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_658> AgradCdfExpModNormal_ffv_658;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_659> AgradCdfExpModNormal_ffv_659;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_660> AgradCdfExpModNormal_ffv_660;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_661> AgradCdfExpModNormal_ffv_661;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_662> AgradCdfExpModNormal_ffv_662;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_663> AgradCdfExpModNormal_ffv_663;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_664> AgradCdfExpModNormal_ffv_664;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_665> AgradCdfExpModNormal_ffv_665;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_666> AgradCdfExpModNormal_ffv_666;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_667> AgradCdfExpModNormal_ffv_667;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_668> AgradCdfExpModNormal_ffv_668;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_669> AgradCdfExpModNormal_ffv_669;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_670> AgradCdfExpModNormal_ffv_670;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_671> AgradCdfExpModNormal_ffv_671;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_672> AgradCdfExpModNormal_ffv_672;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_673> AgradCdfExpModNormal_ffv_673;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_674> AgradCdfExpModNormal_ffv_674;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_675> AgradCdfExpModNormal_ffv_675;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_676> AgradCdfExpModNormal_ffv_676;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_677> AgradCdfExpModNormal_ffv_677;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_678> AgradCdfExpModNormal_ffv_678;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_679> AgradCdfExpModNormal_ffv_679;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_680> AgradCdfExpModNormal_ffv_680;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_681> AgradCdfExpModNormal_ffv_681;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_682> AgradCdfExpModNormal_ffv_682;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_683> AgradCdfExpModNormal_ffv_683;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_684> AgradCdfExpModNormal_ffv_684;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_685> AgradCdfExpModNormal_ffv_685;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_686> AgradCdfExpModNormal_ffv_686;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_687> AgradCdfExpModNormal_ffv_687;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_688> AgradCdfExpModNormal_ffv_688;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_689> AgradCdfExpModNormal_ffv_689;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_690> AgradCdfExpModNormal_ffv_690;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_691> AgradCdfExpModNormal_ffv_691;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_692> AgradCdfExpModNormal_ffv_692;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_693> AgradCdfExpModNormal_ffv_693;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_694> AgradCdfExpModNormal_ffv_694;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_695> AgradCdfExpModNormal_ffv_695;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_696> AgradCdfExpModNormal_ffv_696;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_697> AgradCdfExpModNormal_ffv_697;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_698> AgradCdfExpModNormal_ffv_698;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_699> AgradCdfExpModNormal_ffv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_600, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_601, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_602, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_603, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_604, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_605, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_606, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_607, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_608, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_609, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_610, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_611, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_612, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_613, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_614, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_615, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_616, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_617, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_618, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_619, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_620, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_621, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_622, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_623, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_624, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_625, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_626, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_627, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_628, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_629, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_630, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_631, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_632, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_633, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_634, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_635, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_636, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_637, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_638, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_639, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_640, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_641, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_642, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_643, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_644, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_645, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_646, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_647, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_648, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_649, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_650, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_651, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_652, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_653, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_654, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_655, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_656, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_657, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_658, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_659, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_660, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_661, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_662, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_663, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_664, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_665, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_666, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_667, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_668, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_669, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_670, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_671, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_672, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_673, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_674, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_675, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_676, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_677, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_678, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_679, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_680, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_681, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_682, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_683, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_684, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_685, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_686, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_687, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_688, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_689, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_690, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_691, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_692, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_693, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_694, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_695, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_696, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_697, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_698, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_699, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+typedef std::tuple<var, double, double, double, empty, empty> type_v_648;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_v_649;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_650;
+typedef std::tuple<var, double, double, var, empty, empty> type_v_651;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_v_652;
+typedef std::tuple<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_653;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_v_654;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_v_655;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_656;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_v_657;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_v_658;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_659;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_660;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_661;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_662;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_663;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_664;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_665;
+typedef std::tuple<var, double, var, double, empty, empty> type_v_666;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_v_667;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_668;
+typedef std::tuple<var, double, var, var, empty, empty> type_v_669;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_v_670;
+typedef std::tuple<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_671;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_v_672;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_v_673;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_674;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_v_675;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_v_676;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_677;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_678;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_679;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_680;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_681;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_682;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_683;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_v_684;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_v_685;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_686;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_v_687;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_v_688;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_689;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_v_690;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_691;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_692;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_v_693;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_694;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_695;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_696;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_697;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_698;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_699;
+
+typedef std::tuple<AgradCdfExpModNormal, type_v_600> AgradCdfExpModNormal_v_600;
+typedef std::tuple<AgradCdfExpModNormal, type_v_601> AgradCdfExpModNormal_v_601;
+typedef std::tuple<AgradCdfExpModNormal, type_v_602> AgradCdfExpModNormal_v_602;
+typedef std::tuple<AgradCdfExpModNormal, type_v_603> AgradCdfExpModNormal_v_603;
+typedef std::tuple<AgradCdfExpModNormal, type_v_604> AgradCdfExpModNormal_v_604;
+typedef std::tuple<AgradCdfExpModNormal, type_v_605> AgradCdfExpModNormal_v_605;
+typedef std::tuple<AgradCdfExpModNormal, type_v_606> AgradCdfExpModNormal_v_606;
+typedef std::tuple<AgradCdfExpModNormal, type_v_607> AgradCdfExpModNormal_v_607;
+typedef std::tuple<AgradCdfExpModNormal, type_v_608> AgradCdfExpModNormal_v_608;
+typedef std::tuple<AgradCdfExpModNormal, type_v_609> AgradCdfExpModNormal_v_609;
+typedef std::tuple<AgradCdfExpModNormal, type_v_610> AgradCdfExpModNormal_v_610;
+typedef std::tuple<AgradCdfExpModNormal, type_v_611> AgradCdfExpModNormal_v_611;
+typedef std::tuple<AgradCdfExpModNormal, type_v_612> AgradCdfExpModNormal_v_612;
+typedef std::tuple<AgradCdfExpModNormal, type_v_613> AgradCdfExpModNormal_v_613;
+typedef std::tuple<AgradCdfExpModNormal, type_v_614> AgradCdfExpModNormal_v_614;
+typedef std::tuple<AgradCdfExpModNormal, type_v_615> AgradCdfExpModNormal_v_615;
+typedef std::tuple<AgradCdfExpModNormal, type_v_616> AgradCdfExpModNormal_v_616;
+typedef std::tuple<AgradCdfExpModNormal, type_v_617> AgradCdfExpModNormal_v_617;
+typedef std::tuple<AgradCdfExpModNormal, type_v_618> AgradCdfExpModNormal_v_618;
+typedef std::tuple<AgradCdfExpModNormal, type_v_619> AgradCdfExpModNormal_v_619;
+typedef std::tuple<AgradCdfExpModNormal, type_v_620> AgradCdfExpModNormal_v_620;
+typedef std::tuple<AgradCdfExpModNormal, type_v_621> AgradCdfExpModNormal_v_621;
+typedef std::tuple<AgradCdfExpModNormal, type_v_622> AgradCdfExpModNormal_v_622;
+typedef std::tuple<AgradCdfExpModNormal, type_v_623> AgradCdfExpModNormal_v_623;
+typedef std::tuple<AgradCdfExpModNormal, type_v_624> AgradCdfExpModNormal_v_624;
+typedef std::tuple<AgradCdfExpModNormal, type_v_625> AgradCdfExpModNormal_v_625;
+typedef std::tuple<AgradCdfExpModNormal, type_v_626> AgradCdfExpModNormal_v_626;
+typedef std::tuple<AgradCdfExpModNormal, type_v_627> AgradCdfExpModNormal_v_627;
+typedef std::tuple<AgradCdfExpModNormal, type_v_628> AgradCdfExpModNormal_v_628;
+typedef std::tuple<AgradCdfExpModNormal, type_v_629> AgradCdfExpModNormal_v_629;
+typedef std::tuple<AgradCdfExpModNormal, type_v_630> AgradCdfExpModNormal_v_630;
+typedef std::tuple<AgradCdfExpModNormal, type_v_631> AgradCdfExpModNormal_v_631;
+typedef std::tuple<AgradCdfExpModNormal, type_v_632> AgradCdfExpModNormal_v_632;
+typedef std::tuple<AgradCdfExpModNormal, type_v_633> AgradCdfExpModNormal_v_633;
+typedef std::tuple<AgradCdfExpModNormal, type_v_634> AgradCdfExpModNormal_v_634;
+typedef std::tuple<AgradCdfExpModNormal, type_v_635> AgradCdfExpModNormal_v_635;
+typedef std::tuple<AgradCdfExpModNormal, type_v_636> AgradCdfExpModNormal_v_636;
+typedef std::tuple<AgradCdfExpModNormal, type_v_637> AgradCdfExpModNormal_v_637;
+typedef std::tuple<AgradCdfExpModNormal, type_v_638> AgradCdfExpModNormal_v_638;
+typedef std::tuple<AgradCdfExpModNormal, type_v_639> AgradCdfExpModNormal_v_639;
+typedef std::tuple<AgradCdfExpModNormal, type_v_640> AgradCdfExpModNormal_v_640;
+typedef std::tuple<AgradCdfExpModNormal, type_v_641> AgradCdfExpModNormal_v_641;
+typedef std::tuple<AgradCdfExpModNormal, type_v_642> AgradCdfExpModNormal_v_642;
+typedef std::tuple<AgradCdfExpModNormal, type_v_643> AgradCdfExpModNormal_v_643;
+typedef std::tuple<AgradCdfExpModNormal, type_v_644> AgradCdfExpModNormal_v_644;
+typedef std::tuple<AgradCdfExpModNormal, type_v_645> AgradCdfExpModNormal_v_645;
+typedef std::tuple<AgradCdfExpModNormal, type_v_646> AgradCdfExpModNormal_v_646;
+typedef std::tuple<AgradCdfExpModNormal, type_v_647> AgradCdfExpModNormal_v_647;
+typedef std::tuple<AgradCdfExpModNormal, type_v_648> AgradCdfExpModNormal_v_648;
+typedef std::tuple<AgradCdfExpModNormal, type_v_649> AgradCdfExpModNormal_v_649;
+typedef std::tuple<AgradCdfExpModNormal, type_v_650> AgradCdfExpModNormal_v_650;
+typedef std::tuple<AgradCdfExpModNormal, type_v_651> AgradCdfExpModNormal_v_651;
+typedef std::tuple<AgradCdfExpModNormal, type_v_652> AgradCdfExpModNormal_v_652;
+typedef std::tuple<AgradCdfExpModNormal, type_v_653> AgradCdfExpModNormal_v_653;
+typedef std::tuple<AgradCdfExpModNormal, type_v_654> AgradCdfExpModNormal_v_654;
+typedef std::tuple<AgradCdfExpModNormal, type_v_655> AgradCdfExpModNormal_v_655;
+typedef std::tuple<AgradCdfExpModNormal, type_v_656> AgradCdfExpModNormal_v_656;
+typedef std::tuple<AgradCdfExpModNormal, type_v_657> AgradCdfExpModNormal_v_657;
+typedef std::tuple<AgradCdfExpModNormal, type_v_658> AgradCdfExpModNormal_v_658;
+typedef std::tuple<AgradCdfExpModNormal, type_v_659> AgradCdfExpModNormal_v_659;
+typedef std::tuple<AgradCdfExpModNormal, type_v_660> AgradCdfExpModNormal_v_660;
+typedef std::tuple<AgradCdfExpModNormal, type_v_661> AgradCdfExpModNormal_v_661;
+typedef std::tuple<AgradCdfExpModNormal, type_v_662> AgradCdfExpModNormal_v_662;
+typedef std::tuple<AgradCdfExpModNormal, type_v_663> AgradCdfExpModNormal_v_663;
+typedef std::tuple<AgradCdfExpModNormal, type_v_664> AgradCdfExpModNormal_v_664;
+typedef std::tuple<AgradCdfExpModNormal, type_v_665> AgradCdfExpModNormal_v_665;
+typedef std::tuple<AgradCdfExpModNormal, type_v_666> AgradCdfExpModNormal_v_666;
+typedef std::tuple<AgradCdfExpModNormal, type_v_667> AgradCdfExpModNormal_v_667;
+typedef std::tuple<AgradCdfExpModNormal, type_v_668> AgradCdfExpModNormal_v_668;
+typedef std::tuple<AgradCdfExpModNormal, type_v_669> AgradCdfExpModNormal_v_669;
+typedef std::tuple<AgradCdfExpModNormal, type_v_670> AgradCdfExpModNormal_v_670;
+typedef std::tuple<AgradCdfExpModNormal, type_v_671> AgradCdfExpModNormal_v_671;
+typedef std::tuple<AgradCdfExpModNormal, type_v_672> AgradCdfExpModNormal_v_672;
+typedef std::tuple<AgradCdfExpModNormal, type_v_673> AgradCdfExpModNormal_v_673;
+typedef std::tuple<AgradCdfExpModNormal, type_v_674> AgradCdfExpModNormal_v_674;
+typedef std::tuple<AgradCdfExpModNormal, type_v_675> AgradCdfExpModNormal_v_675;
+typedef std::tuple<AgradCdfExpModNormal, type_v_676> AgradCdfExpModNormal_v_676;
+typedef std::tuple<AgradCdfExpModNormal, type_v_677> AgradCdfExpModNormal_v_677;
+typedef std::tuple<AgradCdfExpModNormal, type_v_678> AgradCdfExpModNormal_v_678;
+typedef std::tuple<AgradCdfExpModNormal, type_v_679> AgradCdfExpModNormal_v_679;
+typedef std::tuple<AgradCdfExpModNormal, type_v_680> AgradCdfExpModNormal_v_680;
+typedef std::tuple<AgradCdfExpModNormal, type_v_681> AgradCdfExpModNormal_v_681;
+typedef std::tuple<AgradCdfExpModNormal, type_v_682> AgradCdfExpModNormal_v_682;
+typedef std::tuple<AgradCdfExpModNormal, type_v_683> AgradCdfExpModNormal_v_683;
+typedef std::tuple<AgradCdfExpModNormal, type_v_684> AgradCdfExpModNormal_v_684;
+typedef std::tuple<AgradCdfExpModNormal, type_v_685> AgradCdfExpModNormal_v_685;
+typedef std::tuple<AgradCdfExpModNormal, type_v_686> AgradCdfExpModNormal_v_686;
+typedef std::tuple<AgradCdfExpModNormal, type_v_687> AgradCdfExpModNormal_v_687;
+typedef std::tuple<AgradCdfExpModNormal, type_v_688> AgradCdfExpModNormal_v_688;
+typedef std::tuple<AgradCdfExpModNormal, type_v_689> AgradCdfExpModNormal_v_689;
+typedef std::tuple<AgradCdfExpModNormal, type_v_690> AgradCdfExpModNormal_v_690;
+typedef std::tuple<AgradCdfExpModNormal, type_v_691> AgradCdfExpModNormal_v_691;
+typedef std::tuple<AgradCdfExpModNormal, type_v_692> AgradCdfExpModNormal_v_692;
+typedef std::tuple<AgradCdfExpModNormal, type_v_693> AgradCdfExpModNormal_v_693;
+typedef std::tuple<AgradCdfExpModNormal, type_v_694> AgradCdfExpModNormal_v_694;
+typedef std::tuple<AgradCdfExpModNormal, type_v_695> AgradCdfExpModNormal_v_695;
+typedef std::tuple<AgradCdfExpModNormal, type_v_696> AgradCdfExpModNormal_v_696;
+typedef std::tuple<AgradCdfExpModNormal, type_v_697> AgradCdfExpModNormal_v_697;
+typedef std::tuple<AgradCdfExpModNormal, type_v_698> AgradCdfExpModNormal_v_698;
+typedef std::tuple<AgradCdfExpModNormal, type_v_699> AgradCdfExpModNormal_v_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_600, AgradCdfTestFixture, AgradCdfExpModNormal_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_601, AgradCdfTestFixture, AgradCdfExpModNormal_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_602, AgradCdfTestFixture, AgradCdfExpModNormal_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_603, AgradCdfTestFixture, AgradCdfExpModNormal_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_604, AgradCdfTestFixture, AgradCdfExpModNormal_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_605, AgradCdfTestFixture, AgradCdfExpModNormal_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_606, AgradCdfTestFixture, AgradCdfExpModNormal_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_607, AgradCdfTestFixture, AgradCdfExpModNormal_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_608, AgradCdfTestFixture, AgradCdfExpModNormal_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_609, AgradCdfTestFixture, AgradCdfExpModNormal_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_610, AgradCdfTestFixture, AgradCdfExpModNormal_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_611, AgradCdfTestFixture, AgradCdfExpModNormal_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_612, AgradCdfTestFixture, AgradCdfExpModNormal_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_613, AgradCdfTestFixture, AgradCdfExpModNormal_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_614, AgradCdfTestFixture, AgradCdfExpModNormal_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_615, AgradCdfTestFixture, AgradCdfExpModNormal_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_616, AgradCdfTestFixture, AgradCdfExpModNormal_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_617, AgradCdfTestFixture, AgradCdfExpModNormal_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_618, AgradCdfTestFixture, AgradCdfExpModNormal_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_619, AgradCdfTestFixture, AgradCdfExpModNormal_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_620, AgradCdfTestFixture, AgradCdfExpModNormal_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_621, AgradCdfTestFixture, AgradCdfExpModNormal_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_622, AgradCdfTestFixture, AgradCdfExpModNormal_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_623, AgradCdfTestFixture, AgradCdfExpModNormal_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_624, AgradCdfTestFixture, AgradCdfExpModNormal_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_625, AgradCdfTestFixture, AgradCdfExpModNormal_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_626, AgradCdfTestFixture, AgradCdfExpModNormal_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_627, AgradCdfTestFixture, AgradCdfExpModNormal_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_628, AgradCdfTestFixture, AgradCdfExpModNormal_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_629, AgradCdfTestFixture, AgradCdfExpModNormal_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_630, AgradCdfTestFixture, AgradCdfExpModNormal_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_631, AgradCdfTestFixture, AgradCdfExpModNormal_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_632, AgradCdfTestFixture, AgradCdfExpModNormal_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_633, AgradCdfTestFixture, AgradCdfExpModNormal_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_634, AgradCdfTestFixture, AgradCdfExpModNormal_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_635, AgradCdfTestFixture, AgradCdfExpModNormal_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_636, AgradCdfTestFixture, AgradCdfExpModNormal_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_637, AgradCdfTestFixture, AgradCdfExpModNormal_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_638, AgradCdfTestFixture, AgradCdfExpModNormal_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_639, AgradCdfTestFixture, AgradCdfExpModNormal_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_640, AgradCdfTestFixture, AgradCdfExpModNormal_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_641, AgradCdfTestFixture, AgradCdfExpModNormal_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_642, AgradCdfTestFixture, AgradCdfExpModNormal_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_643, AgradCdfTestFixture, AgradCdfExpModNormal_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_644, AgradCdfTestFixture, AgradCdfExpModNormal_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_645, AgradCdfTestFixture, AgradCdfExpModNormal_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_646, AgradCdfTestFixture, AgradCdfExpModNormal_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_647, AgradCdfTestFixture, AgradCdfExpModNormal_v_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_648, AgradCdfTestFixture, AgradCdfExpModNormal_v_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_649, AgradCdfTestFixture, AgradCdfExpModNormal_v_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_650, AgradCdfTestFixture, AgradCdfExpModNormal_v_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_651, AgradCdfTestFixture, AgradCdfExpModNormal_v_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_652, AgradCdfTestFixture, AgradCdfExpModNormal_v_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_653, AgradCdfTestFixture, AgradCdfExpModNormal_v_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_654, AgradCdfTestFixture, AgradCdfExpModNormal_v_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_655, AgradCdfTestFixture, AgradCdfExpModNormal_v_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_656, AgradCdfTestFixture, AgradCdfExpModNormal_v_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_657, AgradCdfTestFixture, AgradCdfExpModNormal_v_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_658, AgradCdfTestFixture, AgradCdfExpModNormal_v_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_659, AgradCdfTestFixture, AgradCdfExpModNormal_v_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_660, AgradCdfTestFixture, AgradCdfExpModNormal_v_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_661, AgradCdfTestFixture, AgradCdfExpModNormal_v_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_662, AgradCdfTestFixture, AgradCdfExpModNormal_v_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_663, AgradCdfTestFixture, AgradCdfExpModNormal_v_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_664, AgradCdfTestFixture, AgradCdfExpModNormal_v_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_665, AgradCdfTestFixture, AgradCdfExpModNormal_v_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_666, AgradCdfTestFixture, AgradCdfExpModNormal_v_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_667, AgradCdfTestFixture, AgradCdfExpModNormal_v_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_668, AgradCdfTestFixture, AgradCdfExpModNormal_v_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_669, AgradCdfTestFixture, AgradCdfExpModNormal_v_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_670, AgradCdfTestFixture, AgradCdfExpModNormal_v_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_671, AgradCdfTestFixture, AgradCdfExpModNormal_v_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_672, AgradCdfTestFixture, AgradCdfExpModNormal_v_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_673, AgradCdfTestFixture, AgradCdfExpModNormal_v_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_674, AgradCdfTestFixture, AgradCdfExpModNormal_v_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_675, AgradCdfTestFixture, AgradCdfExpModNormal_v_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_676, AgradCdfTestFixture, AgradCdfExpModNormal_v_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_677, AgradCdfTestFixture, AgradCdfExpModNormal_v_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_678, AgradCdfTestFixture, AgradCdfExpModNormal_v_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_679, AgradCdfTestFixture, AgradCdfExpModNormal_v_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_680, AgradCdfTestFixture, AgradCdfExpModNormal_v_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_681, AgradCdfTestFixture, AgradCdfExpModNormal_v_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_682, AgradCdfTestFixture, AgradCdfExpModNormal_v_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_683, AgradCdfTestFixture, AgradCdfExpModNormal_v_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_684, AgradCdfTestFixture, AgradCdfExpModNormal_v_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_685, AgradCdfTestFixture, AgradCdfExpModNormal_v_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_686, AgradCdfTestFixture, AgradCdfExpModNormal_v_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_687, AgradCdfTestFixture, AgradCdfExpModNormal_v_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_688, AgradCdfTestFixture, AgradCdfExpModNormal_v_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_689, AgradCdfTestFixture, AgradCdfExpModNormal_v_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_690, AgradCdfTestFixture, AgradCdfExpModNormal_v_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_691, AgradCdfTestFixture, AgradCdfExpModNormal_v_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_692, AgradCdfTestFixture, AgradCdfExpModNormal_v_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_693, AgradCdfTestFixture, AgradCdfExpModNormal_v_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_694, AgradCdfTestFixture, AgradCdfExpModNormal_v_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_695, AgradCdfTestFixture, AgradCdfExpModNormal_v_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_696, AgradCdfTestFixture, AgradCdfExpModNormal_v_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_697, AgradCdfTestFixture, AgradCdfExpModNormal_v_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_698, AgradCdfTestFixture, AgradCdfExpModNormal_v_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_699, AgradCdfTestFixture, AgradCdfExpModNormal_v_699);
+
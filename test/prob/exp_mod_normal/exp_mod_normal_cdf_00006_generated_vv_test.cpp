@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_600;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_601;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_602;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_vv_603;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_604;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_605;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_vv_606;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_607;
+typedef std::tuple<var, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_608;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_609;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_610;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_611;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_612;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_613;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_614;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_615;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_616;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_617;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_618;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_619;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_620;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_vv_621;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_622;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_623;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_vv_624;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_625;
+typedef std::tuple<var, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_626;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_627;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_628;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_629;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_630;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_631;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_632;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_633;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_634;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_635;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_636;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_637;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_638;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_639;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_640;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_641;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_642;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_643;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_644;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_645;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_646;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_647;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_648;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_649;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_650;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_651;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_652;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_653;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_654;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_655;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_656;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_657;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_658;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_659;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_660;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_661;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_662;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_663;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_664;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_665;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_666;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_667;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_668;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_669;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_670;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_671;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_672;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_673;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_674;
+typedef std::tuple<var, var, double, double, empty, empty> type_vv_675;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_vv_676;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_677;
+typedef std::tuple<var, var, double, var, empty, empty> type_vv_678;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_vv_679;
+typedef std::tuple<var, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_680;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_vv_681;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_682;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_683;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_vv_684;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_685;
+typedef std::tuple<var, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_686;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_687;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_688;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_689;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_690;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_691;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_692;
+typedef std::tuple<var, var, var, double, empty, empty> type_vv_693;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_vv_694;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_695;
+typedef std::tuple<var, var, var, var, empty, empty> type_vv_696;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_vv_697;
+typedef std::tuple<var, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_698;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_vv_699;
+
+typedef std::tuple<AgradCdfExpModNormal, type_vv_600> AgradCdfExpModNormal_vv_600;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_601> AgradCdfExpModNormal_vv_601;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_602> AgradCdfExpModNormal_vv_602;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_603> AgradCdfExpModNormal_vv_603;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_604> AgradCdfExpModNormal_vv_604;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_605> AgradCdfExpModNormal_vv_605;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_606> AgradCdfExpModNormal_vv_606;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_607> AgradCdfExpModNormal_vv_607;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_608> AgradCdfExpModNormal_vv_608;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_609> AgradCdfExpModNormal_vv_609;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_610> AgradCdfExpModNormal_vv_610;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_611> AgradCdfExpModNormal_vv_611;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_612> AgradCdfExpModNormal_vv_612;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_613> AgradCdfExpModNormal_vv_613;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_614> AgradCdfExpModNormal_vv_614;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_615> AgradCdfExpModNormal_vv_615;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_616> AgradCdfExpModNormal_vv_616;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_617> AgradCdfExpModNormal_vv_617;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_618> AgradCdfExpModNormal_vv_618;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_619> AgradCdfExpModNormal_vv_619;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_620> AgradCdfExpModNormal_vv_620;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_621> AgradCdfExpModNormal_vv_621;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_622> AgradCdfExpModNormal_vv_622;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_623> AgradCdfExpModNormal_vv_623;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_624> AgradCdfExpModNormal_vv_624;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_625> AgradCdfExpModNormal_vv_625;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_626> AgradCdfExpModNormal_vv_626;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_627> AgradCdfExpModNormal_vv_627;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_628> AgradCdfExpModNormal_vv_628;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_629> AgradCdfExpModNormal_vv_629;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_630> AgradCdfExpModNormal_vv_630;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_631> AgradCdfExpModNormal_vv_631;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_632> AgradCdfExpModNormal_vv_632;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_633> AgradCdfExpModNormal_vv_633;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_634> AgradCdfExpModNormal_vv_634;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_635> AgradCdfExpModNormal_vv_635;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_636> AgradCdfExpModNormal_vv_636;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_637> AgradCdfExpModNormal_vv_637;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_638> AgradCdfExpModNormal_vv_638;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_639> AgradCdfExpModNormal_vv_639;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_640> AgradCdfExpModNormal_vv_640;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_641> AgradCdfExpModNormal_vv_641;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_642> AgradCdfExpModNormal_vv_642;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_643> AgradCdfExpModNormal_vv_643;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_644> AgradCdfExpModNormal_vv_644;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_645> AgradCdfExpModNormal_vv_645;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_646> AgradCdfExpModNormal_vv_646;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_647> AgradCdfExpModNormal_vv_647;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_648> AgradCdfExpModNormal_vv_648;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_649> AgradCdfExpModNormal_vv_649;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_650> AgradCdfExpModNormal_vv_650;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_651> AgradCdfExpModNormal_vv_651;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_652> AgradCdfExpModNormal_vv_652;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_653> AgradCdfExpModNormal_vv_653;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_654> AgradCdfExpModNormal_vv_654;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_655> AgradCdfExpModNormal_vv_655;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_656> AgradCdfExpModNormal_vv_656;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_657> AgradCdfExpModNormal_vv_657;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_658> AgradCdfExpModNormal_vv_658;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_659> AgradCdfExpModNormal_vv_659;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_660> AgradCdfExpModNormal_vv_660;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_661> AgradCdfExpModNormal_vv_661;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_662> AgradCdfExpModNormal_vv_662;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_663> AgradCdfExpModNormal_vv_663;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_664> AgradCdfExpModNormal_vv_664;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_665> AgradCdfExpModNormal_vv_665;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_666> AgradCdfExpModNormal_vv_666;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_667> AgradCdfExpModNormal_vv_667;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_668> AgradCdfExpModNormal_vv_668;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_669> AgradCdfExpModNormal_vv_669;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_670> AgradCdfExpModNormal_vv_670;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_671> AgradCdfExpModNormal_vv_671;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_672> AgradCdfExpModNormal_vv_672;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_673> AgradCdfExpModNormal_vv_673;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_674> AgradCdfExpModNormal_vv_674;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_675> AgradCdfExpModNormal_vv_675;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_676> AgradCdfExpModNormal_vv_676;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_677> AgradCdfExpModNormal_vv_677;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_678> AgradCdfExpModNormal_vv_678;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_679> AgradCdfExpModNormal_vv_679;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_680> AgradCdfExpModNormal_vv_680;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_681> AgradCdfExpModNormal_vv_681;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_682> AgradCdfExpModNormal_vv_682;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_683> AgradCdfExpModNormal_vv_683;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_684> AgradCdfExpModNormal_vv_684;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_685> AgradCdfExpModNormal_vv_685;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_686> AgradCdfExpModNormal_vv_686;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_687> AgradCdfExpModNormal_vv_687;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_688> AgradCdfExpModNormal_vv_688;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_689> AgradCdfExpModNormal_vv_689;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_690> AgradCdfExpModNormal_vv_690;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_691> AgradCdfExpModNormal_vv_691;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_692> AgradCdfExpModNormal_vv_692;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_693> AgradCdfExpModNormal_vv_693;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_694> AgradCdfExpModNormal_vv_694;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_695> AgradCdfExpModNormal_vv_695;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_696> AgradCdfExpModNormal_vv_696;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_697> AgradCdfExpModNormal_vv_697;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_698> AgradCdfExpModNormal_vv_698;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_699> AgradCdfExpModNormal_vv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_600, AgradCdfTestFixture, AgradCdfExpModNormal_vv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_601, AgradCdfTestFixture, AgradCdfExpModNormal_vv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_602, AgradCdfTestFixture, AgradCdfExpModNormal_vv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_603, AgradCdfTestFixture, AgradCdfExpModNormal_vv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_604, AgradCdfTestFixture, AgradCdfExpModNormal_vv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_605, AgradCdfTestFixture, AgradCdfExpModNormal_vv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_606, AgradCdfTestFixture, AgradCdfExpModNormal_vv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_607, AgradCdfTestFixture, AgradCdfExpModNormal_vv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_608, AgradCdfTestFixture, AgradCdfExpModNormal_vv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_609, AgradCdfTestFixture, AgradCdfExpModNormal_vv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_610, AgradCdfTestFixture, AgradCdfExpModNormal_vv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_611, AgradCdfTestFixture, AgradCdfExpModNormal_vv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_612, AgradCdfTestFixture, AgradCdfExpModNormal_vv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_613, AgradCdfTestFixture, AgradCdfExpModNormal_vv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_614, AgradCdfTestFixture, AgradCdfExpModNormal_vv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_615, AgradCdfTestFixture, AgradCdfExpModNormal_vv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_616, AgradCdfTestFixture, AgradCdfExpModNormal_vv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_617, AgradCdfTestFixture, AgradCdfExpModNormal_vv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_618, AgradCdfTestFixture, AgradCdfExpModNormal_vv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_619, AgradCdfTestFixture, AgradCdfExpModNormal_vv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_620, AgradCdfTestFixture, AgradCdfExpModNormal_vv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_621, AgradCdfTestFixture, AgradCdfExpModNormal_vv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_622, AgradCdfTestFixture, AgradCdfExpModNormal_vv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_623, AgradCdfTestFixture, AgradCdfExpModNormal_vv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_624, AgradCdfTestFixture, AgradCdfExpModNormal_vv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_625, AgradCdfTestFixture, AgradCdfExpModNormal_vv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_626, AgradCdfTestFixture, AgradCdfExpModNormal_vv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_627, AgradCdfTestFixture, AgradCdfExpModNormal_vv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_628, AgradCdfTestFixture, AgradCdfExpModNormal_vv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_629, AgradCdfTestFixture, AgradCdfExpModNormal_vv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_630, AgradCdfTestFixture, AgradCdfExpModNormal_vv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_631, AgradCdfTestFixture, AgradCdfExpModNormal_vv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_632, AgradCdfTestFixture, AgradCdfExpModNormal_vv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_633, AgradCdfTestFixture, AgradCdfExpModNormal_vv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_634, AgradCdfTestFixture, AgradCdfExpModNormal_vv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_635, AgradCdfTestFixture, AgradCdfExpModNormal_vv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_636, AgradCdfTestFixture, AgradCdfExpModNormal_vv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_637, AgradCdfTestFixture, AgradCdfExpModNormal_vv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_638, AgradCdfTestFixture, AgradCdfExpModNormal_vv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_639, AgradCdfTestFixture, AgradCdfExpModNormal_vv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_640, AgradCdfTestFixture, AgradCdfExpModNormal_vv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_641, AgradCdfTestFixture, AgradCdfExpModNormal_vv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_642, AgradCdfTestFixture, AgradCdfExpModNormal_vv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_643, AgradCdfTestFixture, AgradCdfExpModNormal_vv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_644, AgradCdfTestFixture, AgradCdfExpModNormal_vv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_645, AgradCdfTestFixture, AgradCdfExpModNormal_vv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_646, AgradCdfTestFixture, AgradCdfExpModNormal_vv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_647, AgradCdfTestFixture, AgradCdfExpModNormal_vv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_648, AgradCdfTestFixture, AgradCdfExpModNormal_vv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_649, AgradCdfTestFixture, AgradCdfExpModNormal_vv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_650, AgradCdfTestFixture, AgradCdfExpModNormal_vv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_651, AgradCdfTestFixture, AgradCdfExpModNormal_vv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_652, AgradCdfTestFixture, AgradCdfExpModNormal_vv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_653, AgradCdfTestFixture, AgradCdfExpModNormal_vv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_654, AgradCdfTestFixture, AgradCdfExpModNormal_vv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_655, AgradCdfTestFixture, AgradCdfExpModNormal_vv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_656, AgradCdfTestFixture, AgradCdfExpModNormal_vv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_657, AgradCdfTestFixture, AgradCdfExpModNormal_vv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_658, AgradCdfTestFixture, AgradCdfExpModNormal_vv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_659, AgradCdfTestFixture, AgradCdfExpModNormal_vv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_660, AgradCdfTestFixture, AgradCdfExpModNormal_vv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_661, AgradCdfTestFixture, AgradCdfExpModNormal_vv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_662, AgradCdfTestFixture, AgradCdfExpModNormal_vv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_663, AgradCdfTestFixture, AgradCdfExpModNormal_vv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_664, AgradCdfTestFixture, AgradCdfExpModNormal_vv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_665, AgradCdfTestFixture, AgradCdfExpModNormal_vv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_666, AgradCdfTestFixture, AgradCdfExpModNormal_vv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_667, AgradCdfTestFixture, AgradCdfExpModNormal_vv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_668, AgradCdfTestFixture, AgradCdfExpModNormal_vv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_669, AgradCdfTestFixture, AgradCdfExpModNormal_vv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_670, AgradCdfTestFixture, AgradCdfExpModNormal_vv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_671, AgradCdfTestFixture, AgradCdfExpModNormal_vv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_672, AgradCdfTestFixture, AgradCdfExpModNormal_vv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_673, AgradCdfTestFixture, AgradCdfExpModNormal_vv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_674, AgradCdfTestFixture, AgradCdfExpModNormal_vv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_675, AgradCdfTestFixture, AgradCdfExpModNormal_vv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_676, AgradCdfTestFixture, AgradCdfExpModNormal_vv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_677, AgradCdfTestFixture, AgradCdfExpModNormal_vv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_678, AgradCdfTestFixture, AgradCdfExpModNormal_vv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_679, AgradCdfTestFixture, AgradCdfExpModNormal_vv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_680, AgradCdfTestFixture, AgradCdfExpModNormal_vv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_681, AgradCdfTestFixture, AgradCdfExpModNormal_vv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_682, AgradCdfTestFixture, AgradCdfExpModNormal_vv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_683, AgradCdfTestFixture, AgradCdfExpModNormal_vv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_684, AgradCdfTestFixture, AgradCdfExpModNormal_vv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_685, AgradCdfTestFixture, AgradCdfExpModNormal_vv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_686, AgradCdfTestFixture, AgradCdfExpModNormal_vv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_687, AgradCdfTestFixture, AgradCdfExpModNormal_vv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_688, AgradCdfTestFixture, AgradCdfExpModNormal_vv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_689, AgradCdfTestFixture, AgradCdfExpModNormal_vv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_690, AgradCdfTestFixture, AgradCdfExpModNormal_vv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_691, AgradCdfTestFixture, AgradCdfExpModNormal_vv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_692, AgradCdfTestFixture, AgradCdfExpModNormal_vv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_693, AgradCdfTestFixture, AgradCdfExpModNormal_vv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_694, AgradCdfTestFixture, AgradCdfExpModNormal_vv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_695, AgradCdfTestFixture, AgradCdfExpModNormal_vv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_696, AgradCdfTestFixture, AgradCdfExpModNormal_vv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_697, AgradCdfTestFixture, AgradCdfExpModNormal_vv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_698, AgradCdfTestFixture, AgradCdfExpModNormal_vv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_699, AgradCdfTestFixture, AgradCdfExpModNormal_vv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_700;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_701;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_702;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_703;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_704;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_705;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_706;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_707;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_708;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_709;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_710;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_711;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_712;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_713;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_714;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_715;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_716;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_717;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_718;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_719;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_720;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_721;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_722;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_723;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_724;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_725;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_726;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_727;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_728;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_729;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_730;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_731;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_732;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_733;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_734;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_735;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_736;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_737;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_738;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_739;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_740;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_741;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_742;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_743;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_744;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_745;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_746;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_747;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_748;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_749;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_750;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_751;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_752;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_753;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_754;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_755;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_756;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_757;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_758;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_759;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_760;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_761;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_762;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_763;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_764;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_765;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_766;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_767;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_768;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_769;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_770;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_771;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_772;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_773;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_774;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_775;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_776;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_777;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_778;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_779;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_780;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_781;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_782;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, double, empty, empty> type_ffv_783;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty, empty> type_ffv_784;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_785;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_786;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_787;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_788;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty, empty> type_ffv_789;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_790;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_791;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_792;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_793;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_794;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_795;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_796;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_797;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_798;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_799;
+
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_700> AgradCdfExpModNormal_ffv_700;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_701> AgradCdfExpModNormal_ffv_701;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_702> AgradCdfExpModNormal_ffv_702;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_703> AgradCdfExpModNormal_ffv_703;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_704> AgradCdfExpModNormal_ffv_704;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_705> AgradCdfExpModNormal_ffv_705;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_706> AgradCdfExpModNormal_ffv_706;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_707> AgradCdfExpModNormal_ffv_707;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_708> AgradCdfExpModNormal_ffv_708;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_709> AgradCdfExpModNormal_ffv_709;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_710> AgradCdfExpModNormal_ffv_710;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_711> AgradCdfExpModNormal_ffv_711;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_712> AgradCdfExpModNormal_ffv_712;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_713> AgradCdfExpModNormal_ffv_713;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_714> AgradCdfExpModNormal_ffv_714;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_715> AgradCdfExpModNormal_ffv_715;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_716> AgradCdfExpModNormal_ffv_716;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_717> AgradCdfExpModNormal_ffv_717;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_718> AgradCdfExpModNormal_ffv_718;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_719> AgradCdfExpModNormal_ffv_719;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_720> AgradCdfExpModNormal_ffv_720;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_721> AgradCdfExpModNormal_ffv_721;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_722> AgradCdfExpModNormal_ffv_722;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_723> AgradCdfExpModNormal_ffv_723;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_724> AgradCdfExpModNormal_ffv_724;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_725> AgradCdfExpModNormal_ffv_725;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_726> AgradCdfExpModNormal_ffv_726;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_727> AgradCdfExpModNormal_ffv_727;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_728> AgradCdfExpModNormal_ffv_728;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_729> AgradCdfExpModNormal_ffv_729;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_730> AgradCdfExpModNormal_ffv_730;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_731> AgradCdfExpModNormal_ffv_731;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_732> AgradCdfExpModNormal_ffv_732;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_733> AgradCdfExpModNormal_ffv_733;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_734> AgradCdfExpModNormal_ffv_734;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_735> AgradCdfExpModNormal_ffv_735;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_736> AgradCdfExpModNormal_ffv_736;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_737> AgradCdfExpModNormal_ffv_737;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_738> AgradCdfExpModNormal_ffv_738;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_739> AgradCdfExpModNormal_ffv_739;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_740> AgradCdfExpModNormal_ffv_740;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_741> AgradCdfExpModNormal_ffv_741;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_742> AgradCdfExpModNormal_ffv_742;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_743> AgradCdfExpModNormal_ffv_743;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_744> AgradCdfExpModNormal_ffv_744;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_745> AgradCdfExpModNormal_ffv_745;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_746> AgradCdfExpModNormal_ffv_746;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_747> AgradCdfExpModNormal_ffv_747;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_748> AgradCdfExpModNormal_ffv_748;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_749> AgradCdfExpModNormal_ffv_749;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_750> AgradCdfExpModNormal_ffv_750;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_751> AgradCdfExpModNormal_ffv_751;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_752> AgradCdfExpModNormal_ffv_752;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_753> AgradCdfExpModNormal_ffv_753;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_754> AgradCdfExpModNormal_ffv_754;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_755> AgradCdfExpModNormal_ffv_755;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_756> AgradCdfExpModNormal_ffv_756;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_757> AgradCdfExpModNormal_ffv_757;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_758> AgradCdfExpModNormal_ffv_758;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_759> AgradCdfExpModNormal_ffv_759;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_760> AgradCdfExpModNormal_ffv_760;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_761> AgradCdfExpModNormal_ffv_761;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_762> AgradCdfExpModNormal_ffv_762;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_763> AgradCdfExpModNormal_ffv_763;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_764> AgradCdfExpModNormal_ffv_764;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_765> AgradCdfExpModNormal_ffv_765;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_766> AgradCdfExpModNormal_ffv_766;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_767> AgradCdfExpModNormal_ffv_767;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_768> AgradCdfExpModNormal_ffv_768;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_769> AgradCdfExpModNormal_ffv_769;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_770> AgradCdfExpModNormal_ffv_770;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_771> AgradCdfExpModNormal_ffv_771;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_772> AgradCdfExpModNormal_ffv_772;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_773> AgradCdfExpModNormal_ffv_773;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_774> AgradCdfExpModNormal_ffv_774;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_775> AgradCdfExpModNormal_ffv_775;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_776> AgradCdfExpModNormal_ffv_776;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_777> AgradCdfExpModNormal_ffv_777;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_778> AgradCdfExpModNormal_ffv_778;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_779> AgradCdfExpModNormal_ffv_779;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_780> AgradCdfExpModNormal_ffv_780;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_781> AgradCdfExpModNormal_ffv_781;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_782> AgradCdfExpModNormal_ffv_782;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_783> AgradCdfExpModNormal_ffv_783;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_784> AgradCdfExpModNormal_ffv_784;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_785> AgradCdfExpModNormal_ffv_785;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_786> AgradCdfExpModNormal_ffv_786;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_787> AgradCdfExpModNormal_ffv_787;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_788> AgradCdfExpModNormal_ffv_788;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_789> AgradCdfExpModNormal_ffv_789;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_790> AgradCdfExpModNormal_ffv_790;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_791> AgradCdfExpModNormal_ffv_791;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_792> AgradCdfExpModNormal_ffv_792;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_793> AgradCdfExpModNormal_ffv_793;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_794> AgradCdfExpModNormal_ffv_794;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_795> AgradCdfExpModNormal_ffv_795;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_796> AgradCdfExpModNormal_ffv_796;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_797> AgradCdfExpModNormal_ffv_797;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_798> AgradCdfExpModNormal_ffv_798;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_799> AgradCdfExpModNormal_ffv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_700, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_701, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_702, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_703, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_704, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_705, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_706, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_707, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_708, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_709, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_710, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_711, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_712, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_713, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_714, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_715, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_716, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_717, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_718, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_719, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_720, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_721, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_722, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_723, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_724, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_725, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_726, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_727, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_728, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_729, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_730, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_731, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_732, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_733, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_734, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_735, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_736, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_737, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_738, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_739, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_740, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_741, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_742, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_743, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_744, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_745, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_746, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_747, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_748, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_749, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_750, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_751, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_752, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_753, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_754, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_755, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_756, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_757, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_758, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_759, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_760, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_761, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_762, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_763, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_764, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_765, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_766, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_767, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_768, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_769, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_770, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_771, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_772, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_773, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_774, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_775, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_776, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_777, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_778, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_779, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_780, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_781, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_782, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_783, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_784, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_785, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_786, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_787, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_788, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_789, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_790, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_791, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_792, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_793, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_794, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_795, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_796, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_797, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_798, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_799, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_700;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_701;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_v_702;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_v_703;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_704;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_v_705;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_v_706;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_707;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_v_708;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_709;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_710;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_v_711;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_712;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_713;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_714;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_715;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_716;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_717;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_718;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_719;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_720;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_721;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_722;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_723;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_724;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_725;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_726;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_727;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_728;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_729;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_730;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_731;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_732;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_733;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_734;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_735;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_736;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_737;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_738;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_739;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_740;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_741;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_742;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_743;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_744;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_745;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_746;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_747;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_748;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_749;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_750;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_751;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_752;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_753;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_754;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_755;
+typedef std::tuple<var, var, double, double, empty, empty> type_v_756;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_v_757;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_758;
+typedef std::tuple<var, var, double, var, empty, empty> type_v_759;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_v_760;
+typedef std::tuple<var, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_761;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_v_762;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_v_763;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_764;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_v_765;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_v_766;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_767;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_768;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_769;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_770;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_771;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_772;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_773;
+typedef std::tuple<var, var, var, double, empty, empty> type_v_774;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_v_775;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_776;
+typedef std::tuple<var, var, var, var, empty, empty> type_v_777;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_v_778;
+typedef std::tuple<var, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_779;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_v_780;
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_v_781;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_782;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_v_783;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_v_784;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_785;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_786;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_787;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_788;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_789;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_790;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_791;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_v_792;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_v_793;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_794;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_v_795;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_v_796;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_797;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_v_798;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_799;
+
+typedef std::tuple<AgradCdfExpModNormal, type_v_700> AgradCdfExpModNormal_v_700;
+typedef std::tuple<AgradCdfExpModNormal, type_v_701> AgradCdfExpModNormal_v_701;
+typedef std::tuple<AgradCdfExpModNormal, type_v_702> AgradCdfExpModNormal_v_702;
+typedef std::tuple<AgradCdfExpModNormal, type_v_703> AgradCdfExpModNormal_v_703;
+typedef std::tuple<AgradCdfExpModNormal, type_v_704> AgradCdfExpModNormal_v_704;
+typedef std::tuple<AgradCdfExpModNormal, type_v_705> AgradCdfExpModNormal_v_705;
+typedef std::tuple<AgradCdfExpModNormal, type_v_706> AgradCdfExpModNormal_v_706;
+typedef std::tuple<AgradCdfExpModNormal, type_v_707> AgradCdfExpModNormal_v_707;
+typedef std::tuple<AgradCdfExpModNormal, type_v_708> AgradCdfExpModNormal_v_708;
+typedef std::tuple<AgradCdfExpModNormal, type_v_709> AgradCdfExpModNormal_v_709;
+typedef std::tuple<AgradCdfExpModNormal, type_v_710> AgradCdfExpModNormal_v_710;
+typedef std::tuple<AgradCdfExpModNormal, type_v_711> AgradCdfExpModNormal_v_711;
+typedef std::tuple<AgradCdfExpModNormal, type_v_712> AgradCdfExpModNormal_v_712;
+typedef std::tuple<AgradCdfExpModNormal, type_v_713> AgradCdfExpModNormal_v_713;
+typedef std::tuple<AgradCdfExpModNormal, type_v_714> AgradCdfExpModNormal_v_714;
+typedef std::tuple<AgradCdfExpModNormal, type_v_715> AgradCdfExpModNormal_v_715;
+typedef std::tuple<AgradCdfExpModNormal, type_v_716> AgradCdfExpModNormal_v_716;
+typedef std::tuple<AgradCdfExpModNormal, type_v_717> AgradCdfExpModNormal_v_717;
+typedef std::tuple<AgradCdfExpModNormal, type_v_718> AgradCdfExpModNormal_v_718;
+typedef std::tuple<AgradCdfExpModNormal, type_v_719> AgradCdfExpModNormal_v_719;
+typedef std::tuple<AgradCdfExpModNormal, type_v_720> AgradCdfExpModNormal_v_720;
+typedef std::tuple<AgradCdfExpModNormal, type_v_721> AgradCdfExpModNormal_v_721;
+typedef std::tuple<AgradCdfExpModNormal, type_v_722> AgradCdfExpModNormal_v_722;
+typedef std::tuple<AgradCdfExpModNormal, type_v_723> AgradCdfExpModNormal_v_723;
+typedef std::tuple<AgradCdfExpModNormal, type_v_724> AgradCdfExpModNormal_v_724;
+typedef std::tuple<AgradCdfExpModNormal, type_v_725> AgradCdfExpModNormal_v_725;
+typedef std::tuple<AgradCdfExpModNormal, type_v_726> AgradCdfExpModNormal_v_726;
+typedef std::tuple<AgradCdfExpModNormal, type_v_727> AgradCdfExpModNormal_v_727;
+typedef std::tuple<AgradCdfExpModNormal, type_v_728> AgradCdfExpModNormal_v_728;
+typedef std::tuple<AgradCdfExpModNormal, type_v_729> AgradCdfExpModNormal_v_729;
+typedef std::tuple<AgradCdfExpModNormal, type_v_730> AgradCdfExpModNormal_v_730;
+typedef std::tuple<AgradCdfExpModNormal, type_v_731> AgradCdfExpModNormal_v_731;
+typedef std::tuple<AgradCdfExpModNormal, type_v_732> AgradCdfExpModNormal_v_732;
+typedef std::tuple<AgradCdfExpModNormal, type_v_733> AgradCdfExpModNormal_v_733;
+typedef std::tuple<AgradCdfExpModNormal, type_v_734> AgradCdfExpModNormal_v_734;
+typedef std::tuple<AgradCdfExpModNormal, type_v_735> AgradCdfExpModNormal_v_735;
+typedef std::tuple<AgradCdfExpModNormal, type_v_736> AgradCdfExpModNormal_v_736;
+typedef std::tuple<AgradCdfExpModNormal, type_v_737> AgradCdfExpModNormal_v_737;
+typedef std::tuple<AgradCdfExpModNormal, type_v_738> AgradCdfExpModNormal_v_738;
+typedef std::tuple<AgradCdfExpModNormal, type_v_739> AgradCdfExpModNormal_v_739;
+typedef std::tuple<AgradCdfExpModNormal, type_v_740> AgradCdfExpModNormal_v_740;
+typedef std::tuple<AgradCdfExpModNormal, type_v_741> AgradCdfExpModNormal_v_741;
+typedef std::tuple<AgradCdfExpModNormal, type_v_742> AgradCdfExpModNormal_v_742;
+typedef std::tuple<AgradCdfExpModNormal, type_v_743> AgradCdfExpModNormal_v_743;
+typedef std::tuple<AgradCdfExpModNormal, type_v_744> AgradCdfExpModNormal_v_744;
+typedef std::tuple<AgradCdfExpModNormal, type_v_745> AgradCdfExpModNormal_v_745;
+typedef std::tuple<AgradCdfExpModNormal, type_v_746> AgradCdfExpModNormal_v_746;
+typedef std::tuple<AgradCdfExpModNormal, type_v_747> AgradCdfExpModNormal_v_747;
+typedef std::tuple<AgradCdfExpModNormal, type_v_748> AgradCdfExpModNormal_v_748;
+typedef std::tuple<AgradCdfExpModNormal, type_v_749> AgradCdfExpModNormal_v_749;
+typedef std::tuple<AgradCdfExpModNormal, type_v_750> AgradCdfExpModNormal_v_750;
+typedef std::tuple<AgradCdfExpModNormal, type_v_751> AgradCdfExpModNormal_v_751;
+typedef std::tuple<AgradCdfExpModNormal, type_v_752> AgradCdfExpModNormal_v_752;
+typedef std::tuple<AgradCdfExpModNormal, type_v_753> AgradCdfExpModNormal_v_753;
+typedef std::tuple<AgradCdfExpModNormal, type_v_754> AgradCdfExpModNormal_v_754;
+typedef std::tuple<AgradCdfExpModNormal, type_v_755> AgradCdfExpModNormal_v_755;
+typedef std::tuple<AgradCdfExpModNormal, type_v_756> AgradCdfExpModNormal_v_756;
+typedef std::tuple<AgradCdfExpModNormal, type_v_757> AgradCdfExpModNormal_v_757;
+typedef std::tuple<AgradCdfExpModNormal, type_v_758> AgradCdfExpModNormal_v_758;
+typedef std::tuple<AgradCdfExpModNormal, type_v_759> AgradCdfExpModNormal_v_759;
+typedef std::tuple<AgradCdfExpModNormal, type_v_760> AgradCdfExpModNormal_v_760;
+typedef std::tuple<AgradCdfExpModNormal, type_v_761> AgradCdfExpModNormal_v_761;
+typedef std::tuple<AgradCdfExpModNormal, type_v_762> AgradCdfExpModNormal_v_762;
+typedef std::tuple<AgradCdfExpModNormal, type_v_763> AgradCdfExpModNormal_v_763;
+typedef std::tuple<AgradCdfExpModNormal, type_v_764> AgradCdfExpModNormal_v_764;
+typedef std::tuple<AgradCdfExpModNormal, type_v_765> AgradCdfExpModNormal_v_765;
+typedef std::tuple<AgradCdfExpModNormal, type_v_766> AgradCdfExpModNormal_v_766;
+typedef std::tuple<AgradCdfExpModNormal, type_v_767> AgradCdfExpModNormal_v_767;
+typedef std::tuple<AgradCdfExpModNormal, type_v_768> AgradCdfExpModNormal_v_768;
+typedef std::tuple<AgradCdfExpModNormal, type_v_769> AgradCdfExpModNormal_v_769;
+typedef std::tuple<AgradCdfExpModNormal, type_v_770> AgradCdfExpModNormal_v_770;
+typedef std::tuple<AgradCdfExpModNormal, type_v_771> AgradCdfExpModNormal_v_771;
+typedef std::tuple<AgradCdfExpModNormal, type_v_772> AgradCdfExpModNormal_v_772;
+typedef std::tuple<AgradCdfExpModNormal, type_v_773> AgradCdfExpModNormal_v_773;
+typedef std::tuple<AgradCdfExpModNormal, type_v_774> AgradCdfExpModNormal_v_774;
+typedef std::tuple<AgradCdfExpModNormal, type_v_775> AgradCdfExpModNormal_v_775;
+typedef std::tuple<AgradCdfExpModNormal, type_v_776> AgradCdfExpModNormal_v_776;
+typedef std::tuple<AgradCdfExpModNormal, type_v_777> AgradCdfExpModNormal_v_777;
+typedef std::tuple<AgradCdfExpModNormal, type_v_778> AgradCdfExpModNormal_v_778;
+typedef std::tuple<AgradCdfExpModNormal, type_v_779> AgradCdfExpModNormal_v_779;
+typedef std::tuple<AgradCdfExpModNormal, type_v_780> AgradCdfExpModNormal_v_780;
+typedef std::tuple<AgradCdfExpModNormal, type_v_781> AgradCdfExpModNormal_v_781;
+typedef std::tuple<AgradCdfExpModNormal, type_v_782> AgradCdfExpModNormal_v_782;
+typedef std::tuple<AgradCdfExpModNormal, type_v_783> AgradCdfExpModNormal_v_783;
+typedef std::tuple<AgradCdfExpModNormal, type_v_784> AgradCdfExpModNormal_v_784;
+typedef std::tuple<AgradCdfExpModNormal, type_v_785> AgradCdfExpModNormal_v_785;
+typedef std::tuple<AgradCdfExpModNormal, type_v_786> AgradCdfExpModNormal_v_786;
+typedef std::tuple<AgradCdfExpModNormal, type_v_787> AgradCdfExpModNormal_v_787;
+typedef std::tuple<AgradCdfExpModNormal, type_v_788> AgradCdfExpModNormal_v_788;
+typedef std::tuple<AgradCdfExpModNormal, type_v_789> AgradCdfExpModNormal_v_789;
+typedef std::tuple<AgradCdfExpModNormal, type_v_790> AgradCdfExpModNormal_v_790;
+typedef std::tuple<AgradCdfExpModNormal, type_v_791> AgradCdfExpModNormal_v_791;
+typedef std::tuple<AgradCdfExpModNormal, type_v_792> AgradCdfExpModNormal_v_792;
+typedef std::tuple<AgradCdfExpModNormal, type_v_793> AgradCdfExpModNormal_v_793;
+typedef std::tuple<AgradCdfExpModNormal, type_v_794> AgradCdfExpModNormal_v_794;
+typedef std::tuple<AgradCdfExpModNormal, type_v_795> AgradCdfExpModNormal_v_795;
+typedef std::tuple<AgradCdfExpModNormal, type_v_796> AgradCdfExpModNormal_v_796;
+typedef std::tuple<AgradCdfExpModNormal, type_v_797> AgradCdfExpModNormal_v_797;
+typedef std::tuple<AgradCdfExpModNormal, type_v_798> AgradCdfExpModNormal_v_798;
+typedef std::tuple<AgradCdfExpModNormal, type_v_799> AgradCdfExpModNormal_v_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_700, AgradCdfTestFixture, AgradCdfExpModNormal_v_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_701, AgradCdfTestFixture, AgradCdfExpModNormal_v_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_702, AgradCdfTestFixture, AgradCdfExpModNormal_v_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_703, AgradCdfTestFixture, AgradCdfExpModNormal_v_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_704, AgradCdfTestFixture, AgradCdfExpModNormal_v_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_705, AgradCdfTestFixture, AgradCdfExpModNormal_v_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_706, AgradCdfTestFixture, AgradCdfExpModNormal_v_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_707, AgradCdfTestFixture, AgradCdfExpModNormal_v_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_708, AgradCdfTestFixture, AgradCdfExpModNormal_v_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_709, AgradCdfTestFixture, AgradCdfExpModNormal_v_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_710, AgradCdfTestFixture, AgradCdfExpModNormal_v_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_711, AgradCdfTestFixture, AgradCdfExpModNormal_v_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_712, AgradCdfTestFixture, AgradCdfExpModNormal_v_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_713, AgradCdfTestFixture, AgradCdfExpModNormal_v_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_714, AgradCdfTestFixture, AgradCdfExpModNormal_v_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_715, AgradCdfTestFixture, AgradCdfExpModNormal_v_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_716, AgradCdfTestFixture, AgradCdfExpModNormal_v_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_717, AgradCdfTestFixture, AgradCdfExpModNormal_v_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_718, AgradCdfTestFixture, AgradCdfExpModNormal_v_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_719, AgradCdfTestFixture, AgradCdfExpModNormal_v_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_720, AgradCdfTestFixture, AgradCdfExpModNormal_v_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_721, AgradCdfTestFixture, AgradCdfExpModNormal_v_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_722, AgradCdfTestFixture, AgradCdfExpModNormal_v_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_723, AgradCdfTestFixture, AgradCdfExpModNormal_v_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_724, AgradCdfTestFixture, AgradCdfExpModNormal_v_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_725, AgradCdfTestFixture, AgradCdfExpModNormal_v_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_726, AgradCdfTestFixture, AgradCdfExpModNormal_v_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_727, AgradCdfTestFixture, AgradCdfExpModNormal_v_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_728, AgradCdfTestFixture, AgradCdfExpModNormal_v_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_729, AgradCdfTestFixture, AgradCdfExpModNormal_v_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_730, AgradCdfTestFixture, AgradCdfExpModNormal_v_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_731, AgradCdfTestFixture, AgradCdfExpModNormal_v_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_732, AgradCdfTestFixture, AgradCdfExpModNormal_v_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_733, AgradCdfTestFixture, AgradCdfExpModNormal_v_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_734, AgradCdfTestFixture, AgradCdfExpModNormal_v_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_735, AgradCdfTestFixture, AgradCdfExpModNormal_v_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_736, AgradCdfTestFixture, AgradCdfExpModNormal_v_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_737, AgradCdfTestFixture, AgradCdfExpModNormal_v_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_738, AgradCdfTestFixture, AgradCdfExpModNormal_v_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_739, AgradCdfTestFixture, AgradCdfExpModNormal_v_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_740, AgradCdfTestFixture, AgradCdfExpModNormal_v_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_741, AgradCdfTestFixture, AgradCdfExpModNormal_v_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_742, AgradCdfTestFixture, AgradCdfExpModNormal_v_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_743, AgradCdfTestFixture, AgradCdfExpModNormal_v_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_744, AgradCdfTestFixture, AgradCdfExpModNormal_v_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_745, AgradCdfTestFixture, AgradCdfExpModNormal_v_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_746, AgradCdfTestFixture, AgradCdfExpModNormal_v_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_747, AgradCdfTestFixture, AgradCdfExpModNormal_v_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_748, AgradCdfTestFixture, AgradCdfExpModNormal_v_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_749, AgradCdfTestFixture, AgradCdfExpModNormal_v_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_750, AgradCdfTestFixture, AgradCdfExpModNormal_v_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_751, AgradCdfTestFixture, AgradCdfExpModNormal_v_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_752, AgradCdfTestFixture, AgradCdfExpModNormal_v_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_753, AgradCdfTestFixture, AgradCdfExpModNormal_v_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_754, AgradCdfTestFixture, AgradCdfExpModNormal_v_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_755, AgradCdfTestFixture, AgradCdfExpModNormal_v_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_756, AgradCdfTestFixture, AgradCdfExpModNormal_v_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_757, AgradCdfTestFixture, AgradCdfExpModNormal_v_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_758, AgradCdfTestFixture, AgradCdfExpModNormal_v_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_759, AgradCdfTestFixture, AgradCdfExpModNormal_v_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_760, AgradCdfTestFixture, AgradCdfExpModNormal_v_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_761, AgradCdfTestFixture, AgradCdfExpModNormal_v_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_762, AgradCdfTestFixture, AgradCdfExpModNormal_v_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_763, AgradCdfTestFixture, AgradCdfExpModNormal_v_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_764, AgradCdfTestFixture, AgradCdfExpModNormal_v_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_765, AgradCdfTestFixture, AgradCdfExpModNormal_v_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_766, AgradCdfTestFixture, AgradCdfExpModNormal_v_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_767, AgradCdfTestFixture, AgradCdfExpModNormal_v_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_768, AgradCdfTestFixture, AgradCdfExpModNormal_v_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_769, AgradCdfTestFixture, AgradCdfExpModNormal_v_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_770, AgradCdfTestFixture, AgradCdfExpModNormal_v_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_771, AgradCdfTestFixture, AgradCdfExpModNormal_v_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_772, AgradCdfTestFixture, AgradCdfExpModNormal_v_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_773, AgradCdfTestFixture, AgradCdfExpModNormal_v_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_774, AgradCdfTestFixture, AgradCdfExpModNormal_v_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_775, AgradCdfTestFixture, AgradCdfExpModNormal_v_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_776, AgradCdfTestFixture, AgradCdfExpModNormal_v_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_777, AgradCdfTestFixture, AgradCdfExpModNormal_v_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_778, AgradCdfTestFixture, AgradCdfExpModNormal_v_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_779, AgradCdfTestFixture, AgradCdfExpModNormal_v_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_780, AgradCdfTestFixture, AgradCdfExpModNormal_v_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_781, AgradCdfTestFixture, AgradCdfExpModNormal_v_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_782, AgradCdfTestFixture, AgradCdfExpModNormal_v_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_783, AgradCdfTestFixture, AgradCdfExpModNormal_v_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_784, AgradCdfTestFixture, AgradCdfExpModNormal_v_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_785, AgradCdfTestFixture, AgradCdfExpModNormal_v_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_786, AgradCdfTestFixture, AgradCdfExpModNormal_v_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_787, AgradCdfTestFixture, AgradCdfExpModNormal_v_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_788, AgradCdfTestFixture, AgradCdfExpModNormal_v_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_789, AgradCdfTestFixture, AgradCdfExpModNormal_v_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_790, AgradCdfTestFixture, AgradCdfExpModNormal_v_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_791, AgradCdfTestFixture, AgradCdfExpModNormal_v_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_792, AgradCdfTestFixture, AgradCdfExpModNormal_v_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_793, AgradCdfTestFixture, AgradCdfExpModNormal_v_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_794, AgradCdfTestFixture, AgradCdfExpModNormal_v_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_795, AgradCdfTestFixture, AgradCdfExpModNormal_v_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_796, AgradCdfTestFixture, AgradCdfExpModNormal_v_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_797, AgradCdfTestFixture, AgradCdfExpModNormal_v_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_798, AgradCdfTestFixture, AgradCdfExpModNormal_v_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_799, AgradCdfTestFixture, AgradCdfExpModNormal_v_799);
+
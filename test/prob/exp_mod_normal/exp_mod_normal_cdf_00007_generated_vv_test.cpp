@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_700;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_701;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_vv_702;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_703;
+typedef std::tuple<var, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_704;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_705;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_706;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_707;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_708;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_709;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_710;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_vv_711;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_712;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_713;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_vv_714;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_715;
+typedef std::tuple<var, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_716;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_717;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_718;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_719;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_720;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_721;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_722;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_723;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_724;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_725;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_726;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_727;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_728;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_vv_729;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_730;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_731;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_vv_732;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_733;
+typedef std::tuple<var, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_734;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_735;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_736;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_737;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_738;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_739;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_740;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_741;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_742;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_743;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_744;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_745;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_746;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_747;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_748;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_749;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_750;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_751;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_752;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_753;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_754;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_755;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_756;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_757;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_758;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_759;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_760;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_761;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_762;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_763;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_764;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_765;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_766;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_767;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_768;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_769;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_770;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_771;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_772;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_773;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_774;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_775;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_776;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_777;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_778;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_779;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_780;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_781;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_782;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_vv_783;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_vv_784;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_785;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_vv_786;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_vv_787;
+typedef std::tuple<std::vector<var>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_788;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_vv_789;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_790;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_791;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_vv_792;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_793;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_794;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_795;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_796;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_797;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_798;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_799;
+
+typedef std::tuple<AgradCdfExpModNormal, type_vv_700> AgradCdfExpModNormal_vv_700;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_701> AgradCdfExpModNormal_vv_701;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_702> AgradCdfExpModNormal_vv_702;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_703> AgradCdfExpModNormal_vv_703;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_704> AgradCdfExpModNormal_vv_704;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_705> AgradCdfExpModNormal_vv_705;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_706> AgradCdfExpModNormal_vv_706;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_707> AgradCdfExpModNormal_vv_707;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_708> AgradCdfExpModNormal_vv_708;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_709> AgradCdfExpModNormal_vv_709;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_710> AgradCdfExpModNormal_vv_710;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_711> AgradCdfExpModNormal_vv_711;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_712> AgradCdfExpModNormal_vv_712;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_713> AgradCdfExpModNormal_vv_713;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_714> AgradCdfExpModNormal_vv_714;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_715> AgradCdfExpModNormal_vv_715;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_716> AgradCdfExpModNormal_vv_716;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_717> AgradCdfExpModNormal_vv_717;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_718> AgradCdfExpModNormal_vv_718;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_719> AgradCdfExpModNormal_vv_719;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_720> AgradCdfExpModNormal_vv_720;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_721> AgradCdfExpModNormal_vv_721;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_722> AgradCdfExpModNormal_vv_722;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_723> AgradCdfExpModNormal_vv_723;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_724> AgradCdfExpModNormal_vv_724;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_725> AgradCdfExpModNormal_vv_725;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_726> AgradCdfExpModNormal_vv_726;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_727> AgradCdfExpModNormal_vv_727;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_728> AgradCdfExpModNormal_vv_728;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_729> AgradCdfExpModNormal_vv_729;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_730> AgradCdfExpModNormal_vv_730;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_731> AgradCdfExpModNormal_vv_731;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_732> AgradCdfExpModNormal_vv_732;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_733> AgradCdfExpModNormal_vv_733;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_734> AgradCdfExpModNormal_vv_734;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_735> AgradCdfExpModNormal_vv_735;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_736> AgradCdfExpModNormal_vv_736;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_737> AgradCdfExpModNormal_vv_737;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_738> AgradCdfExpModNormal_vv_738;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_739> AgradCdfExpModNormal_vv_739;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_740> AgradCdfExpModNormal_vv_740;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_741> AgradCdfExpModNormal_vv_741;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_742> AgradCdfExpModNormal_vv_742;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_743> AgradCdfExpModNormal_vv_743;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_744> AgradCdfExpModNormal_vv_744;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_745> AgradCdfExpModNormal_vv_745;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_746> AgradCdfExpModNormal_vv_746;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_747> AgradCdfExpModNormal_vv_747;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_748> AgradCdfExpModNormal_vv_748;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_749> AgradCdfExpModNormal_vv_749;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_750> AgradCdfExpModNormal_vv_750;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_751> AgradCdfExpModNormal_vv_751;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_752> AgradCdfExpModNormal_vv_752;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_753> AgradCdfExpModNormal_vv_753;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_754> AgradCdfExpModNormal_vv_754;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_755> AgradCdfExpModNormal_vv_755;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_756> AgradCdfExpModNormal_vv_756;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_757> AgradCdfExpModNormal_vv_757;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_758> AgradCdfExpModNormal_vv_758;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_759> AgradCdfExpModNormal_vv_759;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_760> AgradCdfExpModNormal_vv_760;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_761> AgradCdfExpModNormal_vv_761;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_762> AgradCdfExpModNormal_vv_762;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_763> AgradCdfExpModNormal_vv_763;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_764> AgradCdfExpModNormal_vv_764;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_765> AgradCdfExpModNormal_vv_765;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_766> AgradCdfExpModNormal_vv_766;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_767> AgradCdfExpModNormal_vv_767;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_768> AgradCdfExpModNormal_vv_768;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_769> AgradCdfExpModNormal_vv_769;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_770> AgradCdfExpModNormal_vv_770;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_771> AgradCdfExpModNormal_vv_771;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_772> AgradCdfExpModNormal_vv_772;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_773> AgradCdfExpModNormal_vv_773;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_774> AgradCdfExpModNormal_vv_774;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_775> AgradCdfExpModNormal_vv_775;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_776> AgradCdfExpModNormal_vv_776;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_777> AgradCdfExpModNormal_vv_777;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_778> AgradCdfExpModNormal_vv_778;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_779> AgradCdfExpModNormal_vv_779;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_780> AgradCdfExpModNormal_vv_780;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_781> AgradCdfExpModNormal_vv_781;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_782> AgradCdfExpModNormal_vv_782;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_783> AgradCdfExpModNormal_vv_783;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_784> AgradCdfExpModNormal_vv_784;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_785> AgradCdfExpModNormal_vv_785;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_786> AgradCdfExpModNormal_vv_786;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_787> AgradCdfExpModNormal_vv_787;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_788> AgradCdfExpModNormal_vv_788;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_789> AgradCdfExpModNormal_vv_789;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_790> AgradCdfExpModNormal_vv_790;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_791> AgradCdfExpModNormal_vv_791;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_792> AgradCdfExpModNormal_vv_792;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_793> AgradCdfExpModNormal_vv_793;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_794> AgradCdfExpModNormal_vv_794;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_795> AgradCdfExpModNormal_vv_795;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_796> AgradCdfExpModNormal_vv_796;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_797> AgradCdfExpModNormal_vv_797;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_798> AgradCdfExpModNormal_vv_798;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_799> AgradCdfExpModNormal_vv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_700, AgradCdfTestFixture, AgradCdfExpModNormal_vv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_701, AgradCdfTestFixture, AgradCdfExpModNormal_vv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_702, AgradCdfTestFixture, AgradCdfExpModNormal_vv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_703, AgradCdfTestFixture, AgradCdfExpModNormal_vv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_704, AgradCdfTestFixture, AgradCdfExpModNormal_vv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_705, AgradCdfTestFixture, AgradCdfExpModNormal_vv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_706, AgradCdfTestFixture, AgradCdfExpModNormal_vv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_707, AgradCdfTestFixture, AgradCdfExpModNormal_vv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_708, AgradCdfTestFixture, AgradCdfExpModNormal_vv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_709, AgradCdfTestFixture, AgradCdfExpModNormal_vv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_710, AgradCdfTestFixture, AgradCdfExpModNormal_vv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_711, AgradCdfTestFixture, AgradCdfExpModNormal_vv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_712, AgradCdfTestFixture, AgradCdfExpModNormal_vv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_713, AgradCdfTestFixture, AgradCdfExpModNormal_vv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_714, AgradCdfTestFixture, AgradCdfExpModNormal_vv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_715, AgradCdfTestFixture, AgradCdfExpModNormal_vv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_716, AgradCdfTestFixture, AgradCdfExpModNormal_vv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_717, AgradCdfTestFixture, AgradCdfExpModNormal_vv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_718, AgradCdfTestFixture, AgradCdfExpModNormal_vv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_719, AgradCdfTestFixture, AgradCdfExpModNormal_vv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_720, AgradCdfTestFixture, AgradCdfExpModNormal_vv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_721, AgradCdfTestFixture, AgradCdfExpModNormal_vv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_722, AgradCdfTestFixture, AgradCdfExpModNormal_vv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_723, AgradCdfTestFixture, AgradCdfExpModNormal_vv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_724, AgradCdfTestFixture, AgradCdfExpModNormal_vv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_725, AgradCdfTestFixture, AgradCdfExpModNormal_vv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_726, AgradCdfTestFixture, AgradCdfExpModNormal_vv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_727, AgradCdfTestFixture, AgradCdfExpModNormal_vv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_728, AgradCdfTestFixture, AgradCdfExpModNormal_vv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_729, AgradCdfTestFixture, AgradCdfExpModNormal_vv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_730, AgradCdfTestFixture, AgradCdfExpModNormal_vv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_731, AgradCdfTestFixture, AgradCdfExpModNormal_vv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_732, AgradCdfTestFixture, AgradCdfExpModNormal_vv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_733, AgradCdfTestFixture, AgradCdfExpModNormal_vv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_734, AgradCdfTestFixture, AgradCdfExpModNormal_vv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_735, AgradCdfTestFixture, AgradCdfExpModNormal_vv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_736, AgradCdfTestFixture, AgradCdfExpModNormal_vv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_737, AgradCdfTestFixture, AgradCdfExpModNormal_vv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_738, AgradCdfTestFixture, AgradCdfExpModNormal_vv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_739, AgradCdfTestFixture, AgradCdfExpModNormal_vv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_740, AgradCdfTestFixture, AgradCdfExpModNormal_vv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_741, AgradCdfTestFixture, AgradCdfExpModNormal_vv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_742, AgradCdfTestFixture, AgradCdfExpModNormal_vv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_743, AgradCdfTestFixture, AgradCdfExpModNormal_vv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_744, AgradCdfTestFixture, AgradCdfExpModNormal_vv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_745, AgradCdfTestFixture, AgradCdfExpModNormal_vv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_746, AgradCdfTestFixture, AgradCdfExpModNormal_vv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_747, AgradCdfTestFixture, AgradCdfExpModNormal_vv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_748, AgradCdfTestFixture, AgradCdfExpModNormal_vv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_749, AgradCdfTestFixture, AgradCdfExpModNormal_vv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_750, AgradCdfTestFixture, AgradCdfExpModNormal_vv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_751, AgradCdfTestFixture, AgradCdfExpModNormal_vv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_752, AgradCdfTestFixture, AgradCdfExpModNormal_vv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_753, AgradCdfTestFixture, AgradCdfExpModNormal_vv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_754, AgradCdfTestFixture, AgradCdfExpModNormal_vv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_755, AgradCdfTestFixture, AgradCdfExpModNormal_vv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_756, AgradCdfTestFixture, AgradCdfExpModNormal_vv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_757, AgradCdfTestFixture, AgradCdfExpModNormal_vv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_758, AgradCdfTestFixture, AgradCdfExpModNormal_vv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_759, AgradCdfTestFixture, AgradCdfExpModNormal_vv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_760, AgradCdfTestFixture, AgradCdfExpModNormal_vv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_761, AgradCdfTestFixture, AgradCdfExpModNormal_vv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_762, AgradCdfTestFixture, AgradCdfExpModNormal_vv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_763, AgradCdfTestFixture, AgradCdfExpModNormal_vv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_764, AgradCdfTestFixture, AgradCdfExpModNormal_vv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_765, AgradCdfTestFixture, AgradCdfExpModNormal_vv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_766, AgradCdfTestFixture, AgradCdfExpModNormal_vv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_767, AgradCdfTestFixture, AgradCdfExpModNormal_vv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_768, AgradCdfTestFixture, AgradCdfExpModNormal_vv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_769, AgradCdfTestFixture, AgradCdfExpModNormal_vv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_770, AgradCdfTestFixture, AgradCdfExpModNormal_vv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_771, AgradCdfTestFixture, AgradCdfExpModNormal_vv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_772, AgradCdfTestFixture, AgradCdfExpModNormal_vv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_773, AgradCdfTestFixture, AgradCdfExpModNormal_vv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_774, AgradCdfTestFixture, AgradCdfExpModNormal_vv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_775, AgradCdfTestFixture, AgradCdfExpModNormal_vv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_776, AgradCdfTestFixture, AgradCdfExpModNormal_vv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_777, AgradCdfTestFixture, AgradCdfExpModNormal_vv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_778, AgradCdfTestFixture, AgradCdfExpModNormal_vv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_779, AgradCdfTestFixture, AgradCdfExpModNormal_vv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_780, AgradCdfTestFixture, AgradCdfExpModNormal_vv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_781, AgradCdfTestFixture, AgradCdfExpModNormal_vv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_782, AgradCdfTestFixture, AgradCdfExpModNormal_vv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_783, AgradCdfTestFixture, AgradCdfExpModNormal_vv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_784, AgradCdfTestFixture, AgradCdfExpModNormal_vv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_785, AgradCdfTestFixture, AgradCdfExpModNormal_vv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_786, AgradCdfTestFixture, AgradCdfExpModNormal_vv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_787, AgradCdfTestFixture, AgradCdfExpModNormal_vv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_788, AgradCdfTestFixture, AgradCdfExpModNormal_vv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_789, AgradCdfTestFixture, AgradCdfExpModNormal_vv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_790, AgradCdfTestFixture, AgradCdfExpModNormal_vv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_791, AgradCdfTestFixture, AgradCdfExpModNormal_vv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_792, AgradCdfTestFixture, AgradCdfExpModNormal_vv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_793, AgradCdfTestFixture, AgradCdfExpModNormal_vv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_794, AgradCdfTestFixture, AgradCdfExpModNormal_vv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_795, AgradCdfTestFixture, AgradCdfExpModNormal_vv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_796, AgradCdfTestFixture, AgradCdfExpModNormal_vv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_797, AgradCdfTestFixture, AgradCdfExpModNormal_vv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_798, AgradCdfTestFixture, AgradCdfExpModNormal_vv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_799, AgradCdfTestFixture, AgradCdfExpModNormal_vv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_800;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_801;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_802;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_803;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_804;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_805;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_806;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_807;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_808;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_809;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_810;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_811;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_812;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_813;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_814;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_815;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_816;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_817;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_818;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty, empty> type_ffv_819;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_820;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_821;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_822;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_823;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_824;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_825;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_826;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_827;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_828;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_829;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_830;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_831;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_832;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_833;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_834;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_835;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_836;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_837;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_838;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_839;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_840;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_841;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_842;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_843;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_844;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_845;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_846;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_847;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_848;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_849;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_850;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_851;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_852;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_853;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_854;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_855;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_856;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_857;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_858;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_859;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_860;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_861;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_862;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_863;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_864;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_865;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_866;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_867;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_868;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_869;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_870;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_871;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_872;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_873;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_874;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_875;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_876;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_877;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_878;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_879;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_880;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_881;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_882;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_883;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_884;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_885;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_886;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_887;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_888;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_889;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_890;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_891;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_892;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_893;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_894;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_895;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_896;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_897;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_898;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_899;
+
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_800> AgradCdfExpModNormal_ffv_800;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_801> AgradCdfExpModNormal_ffv_801;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_802> AgradCdfExpModNormal_ffv_802;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_803> AgradCdfExpModNormal_ffv_803;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_804> AgradCdfExpModNormal_ffv_804;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_805> AgradCdfExpModNormal_ffv_805;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_806> AgradCdfExpModNormal_ffv_806;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_807> AgradCdfExpModNormal_ffv_807;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_808> AgradCdfExpModNormal_ffv_808;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_809> AgradCdfExpModNormal_ffv_809;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_810> AgradCdfExpModNormal_ffv_810;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_811> AgradCdfExpModNormal_ffv_811;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_812> AgradCdfExpModNormal_ffv_812;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_813> AgradCdfExpModNormal_ffv_813;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_814> AgradCdfExpModNormal_ffv_814;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_815> AgradCdfExpModNormal_ffv_815;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_816> AgradCdfExpModNormal_ffv_816;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_817> AgradCdfExpModNormal_ffv_817;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_818> AgradCdfExpModNormal_ffv_818;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_819> AgradCdfExpModNormal_ffv_819;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_820> AgradCdfExpModNormal_ffv_820;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_821> AgradCdfExpModNormal_ffv_821;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_822> AgradCdfExpModNormal_ffv_822;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_823> AgradCdfExpModNormal_ffv_823;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_824> AgradCdfExpModNormal_ffv_824;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_825> AgradCdfExpModNormal_ffv_825;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_826> AgradCdfExpModNormal_ffv_826;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_827> AgradCdfExpModNormal_ffv_827;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_828> AgradCdfExpModNormal_ffv_828;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_829> AgradCdfExpModNormal_ffv_829;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_830> AgradCdfExpModNormal_ffv_830;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_831> AgradCdfExpModNormal_ffv_831;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_832> AgradCdfExpModNormal_ffv_832;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_833> AgradCdfExpModNormal_ffv_833;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_834> AgradCdfExpModNormal_ffv_834;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_835> AgradCdfExpModNormal_ffv_835;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_836> AgradCdfExpModNormal_ffv_836;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_837> AgradCdfExpModNormal_ffv_837;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_838> AgradCdfExpModNormal_ffv_838;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_839> AgradCdfExpModNormal_ffv_839;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_840> AgradCdfExpModNormal_ffv_840;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_841> AgradCdfExpModNormal_ffv_841;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_842> AgradCdfExpModNormal_ffv_842;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_843> AgradCdfExpModNormal_ffv_843;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_844> AgradCdfExpModNormal_ffv_844;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_845> AgradCdfExpModNormal_ffv_845;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_846> AgradCdfExpModNormal_ffv_846;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_847> AgradCdfExpModNormal_ffv_847;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_848> AgradCdfExpModNormal_ffv_848;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_849> AgradCdfExpModNormal_ffv_849;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_850> AgradCdfExpModNormal_ffv_850;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_851> AgradCdfExpModNormal_ffv_851;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_852> AgradCdfExpModNormal_ffv_852;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_853> AgradCdfExpModNormal_ffv_853;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_854> AgradCdfExpModNormal_ffv_854;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_855> AgradCdfExpModNormal_ffv_855;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_856> AgradCdfExpModNormal_ffv_856;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_857> AgradCdfExpModNormal_ffv_857;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_858> AgradCdfExpModNormal_ffv_858;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_859> AgradCdfExpModNormal_ffv_859;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_860> AgradCdfExpModNormal_ffv_860;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_861> AgradCdfExpModNormal_ffv_861;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_862> AgradCdfExpModNormal_ffv_862;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_863> AgradCdfExpModNormal_ffv_863;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_864> AgradCdfExpModNormal_ffv_864;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_865> AgradCdfExpModNormal_ffv_865;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_866> AgradCdfExpModNormal_ffv_866;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_867> AgradCdfExpModNormal_ffv_867;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_868> AgradCdfExpModNormal_ffv_868;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_869> AgradCdfExpModNormal_ffv_869;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_870> AgradCdfExpModNormal_ffv_870;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_871> AgradCdfExpModNormal_ffv_871;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_872> AgradCdfExpModNormal_ffv_872;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_873> AgradCdfExpModNormal_ffv_873;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_874> AgradCdfExpModNormal_ffv_874;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_875> AgradCdfExpModNormal_ffv_875;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_876> AgradCdfExpModNormal_ffv_876;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_877> AgradCdfExpModNormal_ffv_877;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_878> AgradCdfExpModNormal_ffv_878;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_879> AgradCdfExpModNormal_ffv_879;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_880> AgradCdfExpModNormal_ffv_880;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_881> AgradCdfExpModNormal_ffv_881;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_882> AgradCdfExpModNormal_ffv_882;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_883> AgradCdfExpModNormal_ffv_883;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_884> AgradCdfExpModNormal_ffv_884;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_885> AgradCdfExpModNormal_ffv_885;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_886> AgradCdfExpModNormal_ffv_886;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_887> AgradCdfExpModNormal_ffv_887;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_888> AgradCdfExpModNormal_ffv_888;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_889> AgradCdfExpModNormal_ffv_889;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_890> AgradCdfExpModNormal_ffv_890;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_891> AgradCdfExpModNormal_ffv_891;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_892> AgradCdfExpModNormal_ffv_892;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_893> AgradCdfExpModNormal_ffv_893;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_894> AgradCdfExpModNormal_ffv_894;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_895> AgradCdfExpModNormal_ffv_895;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_896> AgradCdfExpModNormal_ffv_896;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_897> AgradCdfExpModNormal_ffv_897;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_898> AgradCdfExpModNormal_ffv_898;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_899> AgradCdfExpModNormal_ffv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_800, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_801, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_802, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_803, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_804, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_805, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_806, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_807, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_808, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_809, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_810, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_811, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_812, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_813, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_814, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_815, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_816, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_817, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_818, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_819, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_820, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_821, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_822, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_823, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_824, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_825, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_826, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_827, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_828, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_829, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_830, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_831, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_832, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_833, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_834, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_835, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_836, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_837, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_838, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_839, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_840, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_841, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_842, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_843, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_844, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_845, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_846, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_847, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_848, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_849, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_850, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_851, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_852, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_853, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_854, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_855, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_856, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_857, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_858, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_859, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_860, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_861, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_862, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_863, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_864, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_865, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_866, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_867, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_868, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_869, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_870, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_871, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_872, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_873, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_874, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_875, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_876, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_877, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_878, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_879, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_880, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_881, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_882, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_883, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_884, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_885, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_886, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_887, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_888, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_889, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_890, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_891, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_892, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_893, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_894, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_895, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_896, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_897, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_898, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_899, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_899);
+
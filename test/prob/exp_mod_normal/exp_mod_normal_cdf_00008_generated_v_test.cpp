@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_800;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_v_801;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_802;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_803;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_804;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_805;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_806;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_807;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_808;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_809;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_v_810;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_v_811;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_812;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_v_813;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_v_814;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_815;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_v_816;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_817;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_818;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_v_819;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_820;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_821;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_822;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_823;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_824;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_825;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_826;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_827;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_828;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_829;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_830;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_831;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_832;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_833;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_834;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_835;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_836;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_837;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_838;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_839;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_840;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_841;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_842;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_843;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_844;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_845;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_846;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_847;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_848;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_849;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_850;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_851;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_852;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_853;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_854;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_855;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_856;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_857;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_858;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_859;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_860;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_861;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_862;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_863;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_v_864;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_v_865;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_866;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_v_867;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_v_868;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_869;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_v_870;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_871;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_872;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_v_873;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_874;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_875;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_876;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_877;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_878;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_879;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_880;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_881;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_v_882;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_v_883;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_884;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_v_885;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_v_886;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_887;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_v_888;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_889;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_890;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_v_891;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_892;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_893;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_894;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_895;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_896;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_897;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_898;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_899;
+
+typedef std::tuple<AgradCdfExpModNormal, type_v_800> AgradCdfExpModNormal_v_800;
+typedef std::tuple<AgradCdfExpModNormal, type_v_801> AgradCdfExpModNormal_v_801;
+typedef std::tuple<AgradCdfExpModNormal, type_v_802> AgradCdfExpModNormal_v_802;
+typedef std::tuple<AgradCdfExpModNormal, type_v_803> AgradCdfExpModNormal_v_803;
+typedef std::tuple<AgradCdfExpModNormal, type_v_804> AgradCdfExpModNormal_v_804;
+typedef std::tuple<AgradCdfExpModNormal, type_v_805> AgradCdfExpModNormal_v_805;
+typedef std::tuple<AgradCdfExpModNormal, type_v_806> AgradCdfExpModNormal_v_806;
+typedef std::tuple<AgradCdfExpModNormal, type_v_807> AgradCdfExpModNormal_v_807;
+typedef std::tuple<AgradCdfExpModNormal, type_v_808> AgradCdfExpModNormal_v_808;
+typedef std::tuple<AgradCdfExpModNormal, type_v_809> AgradCdfExpModNormal_v_809;
+typedef std::tuple<AgradCdfExpModNormal, type_v_810> AgradCdfExpModNormal_v_810;
+typedef std::tuple<AgradCdfExpModNormal, type_v_811> AgradCdfExpModNormal_v_811;
+typedef std::tuple<AgradCdfExpModNormal, type_v_812> AgradCdfExpModNormal_v_812;
+typedef std::tuple<AgradCdfExpModNormal, type_v_813> AgradCdfExpModNormal_v_813;
+typedef std::tuple<AgradCdfExpModNormal, type_v_814> AgradCdfExpModNormal_v_814;
+typedef std::tuple<AgradCdfExpModNormal, type_v_815> AgradCdfExpModNormal_v_815;
+typedef std::tuple<AgradCdfExpModNormal, type_v_816> AgradCdfExpModNormal_v_816;
+typedef std::tuple<AgradCdfExpModNormal, type_v_817> AgradCdfExpModNormal_v_817;
+typedef std::tuple<AgradCdfExpModNormal, type_v_818> AgradCdfExpModNormal_v_818;
+typedef std::tuple<AgradCdfExpModNormal, type_v_819> AgradCdfExpModNormal_v_819;
+typedef std::tuple<AgradCdfExpModNormal, type_v_820> AgradCdfExpModNormal_v_820;
+typedef std::tuple<AgradCdfExpModNormal, type_v_821> AgradCdfExpModNormal_v_821;
+typedef std::tuple<AgradCdfExpModNormal, type_v_822> AgradCdfExpModNormal_v_822;
+typedef std::tuple<AgradCdfExpModNormal, type_v_823> AgradCdfExpModNormal_v_823;
+typedef std::tuple<AgradCdfExpModNormal, type_v_824> AgradCdfExpModNormal_v_824;
+typedef std::tuple<AgradCdfExpModNormal, type_v_825> AgradCdfExpModNormal_v_825;
+typedef std::tuple<AgradCdfExpModNormal, type_v_826> AgradCdfExpModNormal_v_826;
+typedef std::tuple<AgradCdfExpModNormal, type_v_827> AgradCdfExpModNormal_v_827;
+typedef std::tuple<AgradCdfExpModNormal, type_v_828> AgradCdfExpModNormal_v_828;
+typedef std::tuple<AgradCdfExpModNormal, type_v_829> AgradCdfExpModNormal_v_829;
+typedef std::tuple<AgradCdfExpModNormal, type_v_830> AgradCdfExpModNormal_v_830;
+typedef std::tuple<AgradCdfExpModNormal, type_v_831> AgradCdfExpModNormal_v_831;
+typedef std::tuple<AgradCdfExpModNormal, type_v_832> AgradCdfExpModNormal_v_832;
+typedef std::tuple<AgradCdfExpModNormal, type_v_833> AgradCdfExpModNormal_v_833;
+typedef std::tuple<AgradCdfExpModNormal, type_v_834> AgradCdfExpModNormal_v_834;
+typedef std::tuple<AgradCdfExpModNormal, type_v_835> AgradCdfExpModNormal_v_835;
+typedef std::tuple<AgradCdfExpModNormal, type_v_836> AgradCdfExpModNormal_v_836;
+typedef std::tuple<AgradCdfExpModNormal, type_v_837> AgradCdfExpModNormal_v_837;
+typedef std::tuple<AgradCdfExpModNormal, type_v_838> AgradCdfExpModNormal_v_838;
+typedef std::tuple<AgradCdfExpModNormal, type_v_839> AgradCdfExpModNormal_v_839;
+typedef std::tuple<AgradCdfExpModNormal, type_v_840> AgradCdfExpModNormal_v_840;
+typedef std::tuple<AgradCdfExpModNormal, type_v_841> AgradCdfExpModNormal_v_841;
+typedef std::tuple<AgradCdfExpModNormal, type_v_842> AgradCdfExpModNormal_v_842;
+typedef std::tuple<AgradCdfExpModNormal, type_v_843> AgradCdfExpModNormal_v_843;
+typedef std::tuple<AgradCdfExpModNormal, type_v_844> AgradCdfExpModNormal_v_844;
+typedef std::tuple<AgradCdfExpModNormal, type_v_845> AgradCdfExpModNormal_v_845;
+typedef std::tuple<AgradCdfExpModNormal, type_v_846> AgradCdfExpModNormal_v_846;
+typedef std::tuple<AgradCdfExpModNormal, type_v_847> AgradCdfExpModNormal_v_847;
+typedef std::tuple<AgradCdfExpModNormal, type_v_848> AgradCdfExpModNormal_v_848;
+typedef std::tuple<AgradCdfExpModNormal, type_v_849> AgradCdfExpModNormal_v_849;
+typedef std::tuple<AgradCdfExpModNormal, type_v_850> AgradCdfExpModNormal_v_850;
+typedef std::tuple<AgradCdfExpModNormal, type_v_851> AgradCdfExpModNormal_v_851;
+typedef std::tuple<AgradCdfExpModNormal, type_v_852> AgradCdfExpModNormal_v_852;
+typedef std::tuple<AgradCdfExpModNormal, type_v_853> AgradCdfExpModNormal_v_853;
+typedef std::tuple<AgradCdfExpModNormal, type_v_854> AgradCdfExpModNormal_v_854;
+typedef std::tuple<AgradCdfExpModNormal, type_v_855> AgradCdfExpModNormal_v_855;
+typedef std::tuple<AgradCdfExpModNormal, type_v_856> AgradCdfExpModNormal_v_856;
+typedef std::tuple<AgradCdfExpModNormal, type_v_857> AgradCdfExpModNormal_v_857;
+typedef std::tuple<AgradCdfExpModNormal, type_v_858> AgradCdfExpModNormal_v_858;
+typedef std::tuple<AgradCdfExpModNormal, type_v_859> AgradCdfExpModNormal_v_859;
+typedef std::tuple<AgradCdfExpModNormal, type_v_860> AgradCdfExpModNormal_v_860;
+typedef std::tuple<AgradCdfExpModNormal, type_v_861> AgradCdfExpModNormal_v_861;
+typedef std::tuple<AgradCdfExpModNormal, type_v_862> AgradCdfExpModNormal_v_862;
+typedef std::tuple<AgradCdfExpModNormal, type_v_863> AgradCdfExpModNormal_v_863;
+typedef std::tuple<AgradCdfExpModNormal, type_v_864> AgradCdfExpModNormal_v_864;
+typedef std::tuple<AgradCdfExpModNormal, type_v_865> AgradCdfExpModNormal_v_865;
+typedef std::tuple<AgradCdfExpModNormal, type_v_866> AgradCdfExpModNormal_v_866;
+typedef std::tuple<AgradCdfExpModNormal, type_v_867> AgradCdfExpModNormal_v_867;
+typedef std::tuple<AgradCdfExpModNormal, type_v_868> AgradCdfExpModNormal_v_868;
+typedef std::tuple<AgradCdfExpModNormal, type_v_869> AgradCdfExpModNormal_v_869;
+typedef std::tuple<AgradCdfExpModNormal, type_v_870> AgradCdfExpModNormal_v_870;
+typedef std::tuple<AgradCdfExpModNormal, type_v_871> AgradCdfExpModNormal_v_871;
+typedef std::tuple<AgradCdfExpModNormal, type_v_872> AgradCdfExpModNormal_v_872;
+typedef std::tuple<AgradCdfExpModNormal, type_v_873> AgradCdfExpModNormal_v_873;
+typedef std::tuple<AgradCdfExpModNormal, type_v_874> AgradCdfExpModNormal_v_874;
+typedef std::tuple<AgradCdfExpModNormal, type_v_875> AgradCdfExpModNormal_v_875;
+typedef std::tuple<AgradCdfExpModNormal, type_v_876> AgradCdfExpModNormal_v_876;
+typedef std::tuple<AgradCdfExpModNormal, type_v_877> AgradCdfExpModNormal_v_877;
+typedef std::tuple<AgradCdfExpModNormal, type_v_878> AgradCdfExpModNormal_v_878;
+typedef std::tuple<AgradCdfExpModNormal, type_v_879> AgradCdfExpModNormal_v_879;
+typedef std::tuple<AgradCdfExpModNormal, type_v_880> AgradCdfExpModNormal_v_880;
+typedef std::tuple<AgradCdfExpModNormal, type_v_881> AgradCdfExpModNormal_v_881;
+typedef std::tuple<AgradCdfExpModNormal, type_v_882> AgradCdfExpModNormal_v_882;
+typedef std::tuple<AgradCdfExpModNormal, type_v_883> AgradCdfExpModNormal_v_883;
+typedef std::tuple<AgradCdfExpModNormal, type_v_884> AgradCdfExpModNormal_v_884;
+typedef std::tuple<AgradCdfExpModNormal, type_v_885> AgradCdfExpModNormal_v_885;
+typedef std::tuple<AgradCdfExpModNormal, type_v_886> AgradCdfExpModNormal_v_886;
+typedef std::tuple<AgradCdfExpModNormal, type_v_887> AgradCdfExpModNormal_v_887;
+typedef std::tuple<AgradCdfExpModNormal, type_v_888> AgradCdfExpModNormal_v_888;
+typedef std::tuple<AgradCdfExpModNormal, type_v_889> AgradCdfExpModNormal_v_889;
+typedef std::tuple<AgradCdfExpModNormal, type_v_890> AgradCdfExpModNormal_v_890;
+typedef std::tuple<AgradCdfExpModNormal, type_v_891> AgradCdfExpModNormal_v_891;
+typedef std::tuple<AgradCdfExpModNormal, type_v_892> AgradCdfExpModNormal_v_892;
+typedef std::tuple<AgradCdfExpModNormal, type_v_893> AgradCdfExpModNormal_v_893;
+typedef std::tuple<AgradCdfExpModNormal, type_v_894> AgradCdfExpModNormal_v_894;
+typedef std::tuple<AgradCdfExpModNormal, type_v_895> AgradCdfExpModNormal_v_895;
+typedef std::tuple<AgradCdfExpModNormal, type_v_896> AgradCdfExpModNormal_v_896;
+typedef std::tuple<AgradCdfExpModNormal, type_v_897> AgradCdfExpModNormal_v_897;
+typedef std::tuple<AgradCdfExpModNormal, type_v_898> AgradCdfExpModNormal_v_898;
+typedef std::tuple<AgradCdfExpModNormal, type_v_899> AgradCdfExpModNormal_v_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_800, AgradCdfTestFixture, AgradCdfExpModNormal_v_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_801, AgradCdfTestFixture, AgradCdfExpModNormal_v_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_802, AgradCdfTestFixture, AgradCdfExpModNormal_v_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_803, AgradCdfTestFixture, AgradCdfExpModNormal_v_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_804, AgradCdfTestFixture, AgradCdfExpModNormal_v_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_805, AgradCdfTestFixture, AgradCdfExpModNormal_v_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_806, AgradCdfTestFixture, AgradCdfExpModNormal_v_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_807, AgradCdfTestFixture, AgradCdfExpModNormal_v_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_808, AgradCdfTestFixture, AgradCdfExpModNormal_v_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_809, AgradCdfTestFixture, AgradCdfExpModNormal_v_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_810, AgradCdfTestFixture, AgradCdfExpModNormal_v_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_811, AgradCdfTestFixture, AgradCdfExpModNormal_v_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_812, AgradCdfTestFixture, AgradCdfExpModNormal_v_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_813, AgradCdfTestFixture, AgradCdfExpModNormal_v_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_814, AgradCdfTestFixture, AgradCdfExpModNormal_v_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_815, AgradCdfTestFixture, AgradCdfExpModNormal_v_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_816, AgradCdfTestFixture, AgradCdfExpModNormal_v_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_817, AgradCdfTestFixture, AgradCdfExpModNormal_v_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_818, AgradCdfTestFixture, AgradCdfExpModNormal_v_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_819, AgradCdfTestFixture, AgradCdfExpModNormal_v_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_820, AgradCdfTestFixture, AgradCdfExpModNormal_v_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_821, AgradCdfTestFixture, AgradCdfExpModNormal_v_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_822, AgradCdfTestFixture, AgradCdfExpModNormal_v_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_823, AgradCdfTestFixture, AgradCdfExpModNormal_v_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_824, AgradCdfTestFixture, AgradCdfExpModNormal_v_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_825, AgradCdfTestFixture, AgradCdfExpModNormal_v_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_826, AgradCdfTestFixture, AgradCdfExpModNormal_v_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_827, AgradCdfTestFixture, AgradCdfExpModNormal_v_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_828, AgradCdfTestFixture, AgradCdfExpModNormal_v_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_829, AgradCdfTestFixture, AgradCdfExpModNormal_v_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_830, AgradCdfTestFixture, AgradCdfExpModNormal_v_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_831, AgradCdfTestFixture, AgradCdfExpModNormal_v_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_832, AgradCdfTestFixture, AgradCdfExpModNormal_v_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_833, AgradCdfTestFixture, AgradCdfExpModNormal_v_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_834, AgradCdfTestFixture, AgradCdfExpModNormal_v_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_835, AgradCdfTestFixture, AgradCdfExpModNormal_v_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_836, AgradCdfTestFixture, AgradCdfExpModNormal_v_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_837, AgradCdfTestFixture, AgradCdfExpModNormal_v_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_838, AgradCdfTestFixture, AgradCdfExpModNormal_v_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_839, AgradCdfTestFixture, AgradCdfExpModNormal_v_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_840, AgradCdfTestFixture, AgradCdfExpModNormal_v_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_841, AgradCdfTestFixture, AgradCdfExpModNormal_v_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_842, AgradCdfTestFixture, AgradCdfExpModNormal_v_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_843, AgradCdfTestFixture, AgradCdfExpModNormal_v_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_844, AgradCdfTestFixture, AgradCdfExpModNormal_v_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_845, AgradCdfTestFixture, AgradCdfExpModNormal_v_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_846, AgradCdfTestFixture, AgradCdfExpModNormal_v_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_847, AgradCdfTestFixture, AgradCdfExpModNormal_v_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_848, AgradCdfTestFixture, AgradCdfExpModNormal_v_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_849, AgradCdfTestFixture, AgradCdfExpModNormal_v_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_850, AgradCdfTestFixture, AgradCdfExpModNormal_v_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_851, AgradCdfTestFixture, AgradCdfExpModNormal_v_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_852, AgradCdfTestFixture, AgradCdfExpModNormal_v_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_853, AgradCdfTestFixture, AgradCdfExpModNormal_v_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_854, AgradCdfTestFixture, AgradCdfExpModNormal_v_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_855, AgradCdfTestFixture, AgradCdfExpModNormal_v_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_856, AgradCdfTestFixture, AgradCdfExpModNormal_v_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_857, AgradCdfTestFixture, AgradCdfExpModNormal_v_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_858, AgradCdfTestFixture, AgradCdfExpModNormal_v_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_859, AgradCdfTestFixture, AgradCdfExpModNormal_v_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_860, AgradCdfTestFixture, AgradCdfExpModNormal_v_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_861, AgradCdfTestFixture, AgradCdfExpModNormal_v_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_862, AgradCdfTestFixture, AgradCdfExpModNormal_v_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_863, AgradCdfTestFixture, AgradCdfExpModNormal_v_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_864, AgradCdfTestFixture, AgradCdfExpModNormal_v_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_865, AgradCdfTestFixture, AgradCdfExpModNormal_v_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_866, AgradCdfTestFixture, AgradCdfExpModNormal_v_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_867, AgradCdfTestFixture, AgradCdfExpModNormal_v_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_868, AgradCdfTestFixture, AgradCdfExpModNormal_v_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_869, AgradCdfTestFixture, AgradCdfExpModNormal_v_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_870, AgradCdfTestFixture, AgradCdfExpModNormal_v_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_871, AgradCdfTestFixture, AgradCdfExpModNormal_v_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_872, AgradCdfTestFixture, AgradCdfExpModNormal_v_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_873, AgradCdfTestFixture, AgradCdfExpModNormal_v_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_874, AgradCdfTestFixture, AgradCdfExpModNormal_v_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_875, AgradCdfTestFixture, AgradCdfExpModNormal_v_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_876, AgradCdfTestFixture, AgradCdfExpModNormal_v_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_877, AgradCdfTestFixture, AgradCdfExpModNormal_v_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_878, AgradCdfTestFixture, AgradCdfExpModNormal_v_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_879, AgradCdfTestFixture, AgradCdfExpModNormal_v_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_880, AgradCdfTestFixture, AgradCdfExpModNormal_v_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_881, AgradCdfTestFixture, AgradCdfExpModNormal_v_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_882, AgradCdfTestFixture, AgradCdfExpModNormal_v_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_883, AgradCdfTestFixture, AgradCdfExpModNormal_v_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_884, AgradCdfTestFixture, AgradCdfExpModNormal_v_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_885, AgradCdfTestFixture, AgradCdfExpModNormal_v_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_886, AgradCdfTestFixture, AgradCdfExpModNormal_v_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_887, AgradCdfTestFixture, AgradCdfExpModNormal_v_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_888, AgradCdfTestFixture, AgradCdfExpModNormal_v_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_889, AgradCdfTestFixture, AgradCdfExpModNormal_v_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_890, AgradCdfTestFixture, AgradCdfExpModNormal_v_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_891, AgradCdfTestFixture, AgradCdfExpModNormal_v_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_892, AgradCdfTestFixture, AgradCdfExpModNormal_v_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_893, AgradCdfTestFixture, AgradCdfExpModNormal_v_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_894, AgradCdfTestFixture, AgradCdfExpModNormal_v_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_895, AgradCdfTestFixture, AgradCdfExpModNormal_v_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_896, AgradCdfTestFixture, AgradCdfExpModNormal_v_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_897, AgradCdfTestFixture, AgradCdfExpModNormal_v_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_898, AgradCdfTestFixture, AgradCdfExpModNormal_v_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_899, AgradCdfTestFixture, AgradCdfExpModNormal_v_899);
+
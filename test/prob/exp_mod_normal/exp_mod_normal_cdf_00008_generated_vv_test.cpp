@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_800;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_vv_801;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_vv_802;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_803;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_vv_804;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_vv_805;
+typedef std::tuple<std::vector<var>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_806;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_vv_807;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_808;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_809;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_vv_810;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_811;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_812;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_813;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_814;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_815;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_816;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_817;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_818;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_vv_819;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_820;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_821;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_vv_822;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_823;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_824;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_825;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_826;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_827;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_828;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_829;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_830;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_831;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_832;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_833;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_834;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_835;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_836;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_vv_837;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_838;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_839;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_vv_840;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_841;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_842;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_843;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_844;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_845;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_846;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_847;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_848;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_849;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_850;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_851;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_852;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_853;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_854;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_855;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_856;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_857;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_858;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_859;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_860;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_861;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_862;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_863;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_864;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_865;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_866;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_867;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_868;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_869;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_870;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_871;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_872;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_873;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_874;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_875;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_876;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_877;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_878;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_879;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_880;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_881;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_882;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_883;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_884;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_885;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_886;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_887;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_888;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_889;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_890;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_vv_891;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_vv_892;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_893;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_vv_894;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_vv_895;
+typedef std::tuple<std::vector<var>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_896;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_vv_897;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_898;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_899;
+
+typedef std::tuple<AgradCdfExpModNormal, type_vv_800> AgradCdfExpModNormal_vv_800;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_801> AgradCdfExpModNormal_vv_801;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_802> AgradCdfExpModNormal_vv_802;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_803> AgradCdfExpModNormal_vv_803;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_804> AgradCdfExpModNormal_vv_804;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_805> AgradCdfExpModNormal_vv_805;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_806> AgradCdfExpModNormal_vv_806;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_807> AgradCdfExpModNormal_vv_807;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_808> AgradCdfExpModNormal_vv_808;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_809> AgradCdfExpModNormal_vv_809;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_810> AgradCdfExpModNormal_vv_810;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_811> AgradCdfExpModNormal_vv_811;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_812> AgradCdfExpModNormal_vv_812;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_813> AgradCdfExpModNormal_vv_813;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_814> AgradCdfExpModNormal_vv_814;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_815> AgradCdfExpModNormal_vv_815;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_816> AgradCdfExpModNormal_vv_816;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_817> AgradCdfExpModNormal_vv_817;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_818> AgradCdfExpModNormal_vv_818;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_819> AgradCdfExpModNormal_vv_819;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_820> AgradCdfExpModNormal_vv_820;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_821> AgradCdfExpModNormal_vv_821;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_822> AgradCdfExpModNormal_vv_822;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_823> AgradCdfExpModNormal_vv_823;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_824> AgradCdfExpModNormal_vv_824;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_825> AgradCdfExpModNormal_vv_825;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_826> AgradCdfExpModNormal_vv_826;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_827> AgradCdfExpModNormal_vv_827;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_828> AgradCdfExpModNormal_vv_828;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_829> AgradCdfExpModNormal_vv_829;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_830> AgradCdfExpModNormal_vv_830;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_831> AgradCdfExpModNormal_vv_831;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_832> AgradCdfExpModNormal_vv_832;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_833> AgradCdfExpModNormal_vv_833;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_834> AgradCdfExpModNormal_vv_834;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_835> AgradCdfExpModNormal_vv_835;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_836> AgradCdfExpModNormal_vv_836;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_837> AgradCdfExpModNormal_vv_837;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_838> AgradCdfExpModNormal_vv_838;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_839> AgradCdfExpModNormal_vv_839;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_840> AgradCdfExpModNormal_vv_840;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_841> AgradCdfExpModNormal_vv_841;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_842> AgradCdfExpModNormal_vv_842;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_843> AgradCdfExpModNormal_vv_843;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_844> AgradCdfExpModNormal_vv_844;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_845> AgradCdfExpModNormal_vv_845;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_846> AgradCdfExpModNormal_vv_846;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_847> AgradCdfExpModNormal_vv_847;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_848> AgradCdfExpModNormal_vv_848;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_849> AgradCdfExpModNormal_vv_849;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_850> AgradCdfExpModNormal_vv_850;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_851> AgradCdfExpModNormal_vv_851;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_852> AgradCdfExpModNormal_vv_852;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_853> AgradCdfExpModNormal_vv_853;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_854> AgradCdfExpModNormal_vv_854;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_855> AgradCdfExpModNormal_vv_855;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_856> AgradCdfExpModNormal_vv_856;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_857> AgradCdfExpModNormal_vv_857;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_858> AgradCdfExpModNormal_vv_858;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_859> AgradCdfExpModNormal_vv_859;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_860> AgradCdfExpModNormal_vv_860;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_861> AgradCdfExpModNormal_vv_861;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_862> AgradCdfExpModNormal_vv_862;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_863> AgradCdfExpModNormal_vv_863;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_864> AgradCdfExpModNormal_vv_864;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_865> AgradCdfExpModNormal_vv_865;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_866> AgradCdfExpModNormal_vv_866;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_867> AgradCdfExpModNormal_vv_867;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_868> AgradCdfExpModNormal_vv_868;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_869> AgradCdfExpModNormal_vv_869;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_870> AgradCdfExpModNormal_vv_870;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_871> AgradCdfExpModNormal_vv_871;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_872> AgradCdfExpModNormal_vv_872;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_873> AgradCdfExpModNormal_vv_873;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_874> AgradCdfExpModNormal_vv_874;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_875> AgradCdfExpModNormal_vv_875;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_876> AgradCdfExpModNormal_vv_876;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_877> AgradCdfExpModNormal_vv_877;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_878> AgradCdfExpModNormal_vv_878;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_879> AgradCdfExpModNormal_vv_879;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_880> AgradCdfExpModNormal_vv_880;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_881> AgradCdfExpModNormal_vv_881;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_882> AgradCdfExpModNormal_vv_882;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_883> AgradCdfExpModNormal_vv_883;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_884> AgradCdfExpModNormal_vv_884;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_885> AgradCdfExpModNormal_vv_885;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_886> AgradCdfExpModNormal_vv_886;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_887> AgradCdfExpModNormal_vv_887;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_888> AgradCdfExpModNormal_vv_888;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_889> AgradCdfExpModNormal_vv_889;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_890> AgradCdfExpModNormal_vv_890;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_891> AgradCdfExpModNormal_vv_891;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_892> AgradCdfExpModNormal_vv_892;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_893> AgradCdfExpModNormal_vv_893;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_894> AgradCdfExpModNormal_vv_894;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_895> AgradCdfExpModNormal_vv_895;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_896> AgradCdfExpModNormal_vv_896;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_897> AgradCdfExpModNormal_vv_897;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_898> AgradCdfExpModNormal_vv_898;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_899> AgradCdfExpModNormal_vv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_800, AgradCdfTestFixture, AgradCdfExpModNormal_vv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_801, AgradCdfTestFixture, AgradCdfExpModNormal_vv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_802, AgradCdfTestFixture, AgradCdfExpModNormal_vv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_803, AgradCdfTestFixture, AgradCdfExpModNormal_vv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_804, AgradCdfTestFixture, AgradCdfExpModNormal_vv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_805, AgradCdfTestFixture, AgradCdfExpModNormal_vv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_806, AgradCdfTestFixture, AgradCdfExpModNormal_vv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_807, AgradCdfTestFixture, AgradCdfExpModNormal_vv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_808, AgradCdfTestFixture, AgradCdfExpModNormal_vv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_809, AgradCdfTestFixture, AgradCdfExpModNormal_vv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_810, AgradCdfTestFixture, AgradCdfExpModNormal_vv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_811, AgradCdfTestFixture, AgradCdfExpModNormal_vv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_812, AgradCdfTestFixture, AgradCdfExpModNormal_vv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_813, AgradCdfTestFixture, AgradCdfExpModNormal_vv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_814, AgradCdfTestFixture, AgradCdfExpModNormal_vv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_815, AgradCdfTestFixture, AgradCdfExpModNormal_vv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_816, AgradCdfTestFixture, AgradCdfExpModNormal_vv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_817, AgradCdfTestFixture, AgradCdfExpModNormal_vv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_818, AgradCdfTestFixture, AgradCdfExpModNormal_vv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_819, AgradCdfTestFixture, AgradCdfExpModNormal_vv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_820, AgradCdfTestFixture, AgradCdfExpModNormal_vv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_821, AgradCdfTestFixture, AgradCdfExpModNormal_vv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_822, AgradCdfTestFixture, AgradCdfExpModNormal_vv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_823, AgradCdfTestFixture, AgradCdfExpModNormal_vv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_824, AgradCdfTestFixture, AgradCdfExpModNormal_vv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_825, AgradCdfTestFixture, AgradCdfExpModNormal_vv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_826, AgradCdfTestFixture, AgradCdfExpModNormal_vv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_827, AgradCdfTestFixture, AgradCdfExpModNormal_vv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_828, AgradCdfTestFixture, AgradCdfExpModNormal_vv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_829, AgradCdfTestFixture, AgradCdfExpModNormal_vv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_830, AgradCdfTestFixture, AgradCdfExpModNormal_vv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_831, AgradCdfTestFixture, AgradCdfExpModNormal_vv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_832, AgradCdfTestFixture, AgradCdfExpModNormal_vv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_833, AgradCdfTestFixture, AgradCdfExpModNormal_vv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_834, AgradCdfTestFixture, AgradCdfExpModNormal_vv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_835, AgradCdfTestFixture, AgradCdfExpModNormal_vv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_836, AgradCdfTestFixture, AgradCdfExpModNormal_vv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_837, AgradCdfTestFixture, AgradCdfExpModNormal_vv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_838, AgradCdfTestFixture, AgradCdfExpModNormal_vv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_839, AgradCdfTestFixture, AgradCdfExpModNormal_vv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_840, AgradCdfTestFixture, AgradCdfExpModNormal_vv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_841, AgradCdfTestFixture, AgradCdfExpModNormal_vv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_842, AgradCdfTestFixture, AgradCdfExpModNormal_vv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_843, AgradCdfTestFixture, AgradCdfExpModNormal_vv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_844, AgradCdfTestFixture, AgradCdfExpModNormal_vv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_845, AgradCdfTestFixture, AgradCdfExpModNormal_vv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_846, AgradCdfTestFixture, AgradCdfExpModNormal_vv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_847, AgradCdfTestFixture, AgradCdfExpModNormal_vv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_848, AgradCdfTestFixture, AgradCdfExpModNormal_vv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_849, AgradCdfTestFixture, AgradCdfExpModNormal_vv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_850, AgradCdfTestFixture, AgradCdfExpModNormal_vv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_851, AgradCdfTestFixture, AgradCdfExpModNormal_vv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_852, AgradCdfTestFixture, AgradCdfExpModNormal_vv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_853, AgradCdfTestFixture, AgradCdfExpModNormal_vv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_854, AgradCdfTestFixture, AgradCdfExpModNormal_vv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_855, AgradCdfTestFixture, AgradCdfExpModNormal_vv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_856, AgradCdfTestFixture, AgradCdfExpModNormal_vv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_857, AgradCdfTestFixture, AgradCdfExpModNormal_vv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_858, AgradCdfTestFixture, AgradCdfExpModNormal_vv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_859, AgradCdfTestFixture, AgradCdfExpModNormal_vv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_860, AgradCdfTestFixture, AgradCdfExpModNormal_vv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_861, AgradCdfTestFixture, AgradCdfExpModNormal_vv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_862, AgradCdfTestFixture, AgradCdfExpModNormal_vv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_863, AgradCdfTestFixture, AgradCdfExpModNormal_vv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_864, AgradCdfTestFixture, AgradCdfExpModNormal_vv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_865, AgradCdfTestFixture, AgradCdfExpModNormal_vv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_866, AgradCdfTestFixture, AgradCdfExpModNormal_vv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_867, AgradCdfTestFixture, AgradCdfExpModNormal_vv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_868, AgradCdfTestFixture, AgradCdfExpModNormal_vv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_869, AgradCdfTestFixture, AgradCdfExpModNormal_vv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_870, AgradCdfTestFixture, AgradCdfExpModNormal_vv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_871, AgradCdfTestFixture, AgradCdfExpModNormal_vv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_872, AgradCdfTestFixture, AgradCdfExpModNormal_vv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_873, AgradCdfTestFixture, AgradCdfExpModNormal_vv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_874, AgradCdfTestFixture, AgradCdfExpModNormal_vv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_875, AgradCdfTestFixture, AgradCdfExpModNormal_vv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_876, AgradCdfTestFixture, AgradCdfExpModNormal_vv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_877, AgradCdfTestFixture, AgradCdfExpModNormal_vv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_878, AgradCdfTestFixture, AgradCdfExpModNormal_vv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_879, AgradCdfTestFixture, AgradCdfExpModNormal_vv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_880, AgradCdfTestFixture, AgradCdfExpModNormal_vv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_881, AgradCdfTestFixture, AgradCdfExpModNormal_vv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_882, AgradCdfTestFixture, AgradCdfExpModNormal_vv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_883, AgradCdfTestFixture, AgradCdfExpModNormal_vv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_884, AgradCdfTestFixture, AgradCdfExpModNormal_vv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_885, AgradCdfTestFixture, AgradCdfExpModNormal_vv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_886, AgradCdfTestFixture, AgradCdfExpModNormal_vv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_887, AgradCdfTestFixture, AgradCdfExpModNormal_vv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_888, AgradCdfTestFixture, AgradCdfExpModNormal_vv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_889, AgradCdfTestFixture, AgradCdfExpModNormal_vv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_890, AgradCdfTestFixture, AgradCdfExpModNormal_vv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_891, AgradCdfTestFixture, AgradCdfExpModNormal_vv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_892, AgradCdfTestFixture, AgradCdfExpModNormal_vv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_893, AgradCdfTestFixture, AgradCdfExpModNormal_vv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_894, AgradCdfTestFixture, AgradCdfExpModNormal_vv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_895, AgradCdfTestFixture, AgradCdfExpModNormal_vv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_896, AgradCdfTestFixture, AgradCdfExpModNormal_vv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_897, AgradCdfTestFixture, AgradCdfExpModNormal_vv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_898, AgradCdfTestFixture, AgradCdfExpModNormal_vv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_899, AgradCdfTestFixture, AgradCdfExpModNormal_vv_899);
+
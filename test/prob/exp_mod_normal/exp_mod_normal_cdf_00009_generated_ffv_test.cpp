@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_900;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_901;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_902;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_903;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_904;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_905;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_906;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_907;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_908;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_909;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_910;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_911;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_912;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_913;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_914;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_915;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_916;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_917;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_918;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_919;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_920;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_921;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_922;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_923;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_924;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_925;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_926;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_927;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_928;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_929;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_930;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_931;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_932;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_933;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_934;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_935;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_936;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_937;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_938;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_939;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_940;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_941;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_942;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_943;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_944;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_945;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_946;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_947;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_948;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_949;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_950;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_951;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_952;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_953;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_954;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_955;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_956;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_957;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_958;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_959;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_960;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_961;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_962;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_963;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_964;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_965;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_966;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_967;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_968;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_969;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_970;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_971;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_972;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_973;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_974;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_975;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_976;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_977;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_978;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_979;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_980;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_981;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_982;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_983;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_984;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_985;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_986;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_987;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_988;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_989;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_990;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_991;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_992;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_993;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_994;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_995;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_996;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_997;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_998;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_ffv_999;
+
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_900> AgradCdfExpModNormal_ffv_900;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_901> AgradCdfExpModNormal_ffv_901;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_902> AgradCdfExpModNormal_ffv_902;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_903> AgradCdfExpModNormal_ffv_903;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_904> AgradCdfExpModNormal_ffv_904;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_905> AgradCdfExpModNormal_ffv_905;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_906> AgradCdfExpModNormal_ffv_906;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_907> AgradCdfExpModNormal_ffv_907;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_908> AgradCdfExpModNormal_ffv_908;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_909> AgradCdfExpModNormal_ffv_909;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_910> AgradCdfExpModNormal_ffv_910;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_911> AgradCdfExpModNormal_ffv_911;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_912> AgradCdfExpModNormal_ffv_912;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_913> AgradCdfExpModNormal_ffv_913;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_914> AgradCdfExpModNormal_ffv_914;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_915> AgradCdfExpModNormal_ffv_915;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_916> AgradCdfExpModNormal_ffv_916;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_917> AgradCdfExpModNormal_ffv_917;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_918> AgradCdfExpModNormal_ffv_918;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_919> AgradCdfExpModNormal_ffv_919;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_920> AgradCdfExpModNormal_ffv_920;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_921> AgradCdfExpModNormal_ffv_921;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_922> AgradCdfExpModNormal_ffv_922;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_923> AgradCdfExpModNormal_ffv_923;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_924> AgradCdfExpModNormal_ffv_924;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_925> AgradCdfExpModNormal_ffv_925;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_926> AgradCdfExpModNormal_ffv_926;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_927> AgradCdfExpModNormal_ffv_927;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_928> AgradCdfExpModNormal_ffv_928;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_929> AgradCdfExpModNormal_ffv_929;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_930> AgradCdfExpModNormal_ffv_930;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_931> AgradCdfExpModNormal_ffv_931;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_932> AgradCdfExpModNormal_ffv_932;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_933> AgradCdfExpModNormal_ffv_933;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_934> AgradCdfExpModNormal_ffv_934;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_935> AgradCdfExpModNormal_ffv_935;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_936> AgradCdfExpModNormal_ffv_936;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_937> AgradCdfExpModNormal_ffv_937;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_938> AgradCdfExpModNormal_ffv_938;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_939> AgradCdfExpModNormal_ffv_939;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_940> AgradCdfExpModNormal_ffv_940;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_941> AgradCdfExpModNormal_ffv_941;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_942> AgradCdfExpModNormal_ffv_942;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_943> AgradCdfExpModNormal_ffv_943;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_944> AgradCdfExpModNormal_ffv_944;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_945> AgradCdfExpModNormal_ffv_945;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_946> AgradCdfExpModNormal_ffv_946;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_947> AgradCdfExpModNormal_ffv_947;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_948> AgradCdfExpModNormal_ffv_948;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_949> AgradCdfExpModNormal_ffv_949;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_950> AgradCdfExpModNormal_ffv_950;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_951> AgradCdfExpModNormal_ffv_951;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_952> AgradCdfExpModNormal_ffv_952;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_953> AgradCdfExpModNormal_ffv_953;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_954> AgradCdfExpModNormal_ffv_954;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_955> AgradCdfExpModNormal_ffv_955;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_956> AgradCdfExpModNormal_ffv_956;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_957> AgradCdfExpModNormal_ffv_957;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_958> AgradCdfExpModNormal_ffv_958;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_959> AgradCdfExpModNormal_ffv_959;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_960> AgradCdfExpModNormal_ffv_960;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_961> AgradCdfExpModNormal_ffv_961;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_962> AgradCdfExpModNormal_ffv_962;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_963> AgradCdfExpModNormal_ffv_963;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_964> AgradCdfExpModNormal_ffv_964;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_965> AgradCdfExpModNormal_ffv_965;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_966> AgradCdfExpModNormal_ffv_966;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_967> AgradCdfExpModNormal_ffv_967;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_968> AgradCdfExpModNormal_ffv_968;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_969> AgradCdfExpModNormal_ffv_969;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_970> AgradCdfExpModNormal_ffv_970;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_971> AgradCdfExpModNormal_ffv_971;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_972> AgradCdfExpModNormal_ffv_972;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_973> AgradCdfExpModNormal_ffv_973;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_974> AgradCdfExpModNormal_ffv_974;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_975> AgradCdfExpModNormal_ffv_975;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_976> AgradCdfExpModNormal_ffv_976;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_977> AgradCdfExpModNormal_ffv_977;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_978> AgradCdfExpModNormal_ffv_978;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_979> AgradCdfExpModNormal_ffv_979;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_980> AgradCdfExpModNormal_ffv_980;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_981> AgradCdfExpModNormal_ffv_981;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_982> AgradCdfExpModNormal_ffv_982;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_983> AgradCdfExpModNormal_ffv_983;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_984> AgradCdfExpModNormal_ffv_984;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_985> AgradCdfExpModNormal_ffv_985;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_986> AgradCdfExpModNormal_ffv_986;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_987> AgradCdfExpModNormal_ffv_987;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_988> AgradCdfExpModNormal_ffv_988;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_989> AgradCdfExpModNormal_ffv_989;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_990> AgradCdfExpModNormal_ffv_990;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_991> AgradCdfExpModNormal_ffv_991;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_992> AgradCdfExpModNormal_ffv_992;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_993> AgradCdfExpModNormal_ffv_993;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_994> AgradCdfExpModNormal_ffv_994;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_995> AgradCdfExpModNormal_ffv_995;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_996> AgradCdfExpModNormal_ffv_996;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_997> AgradCdfExpModNormal_ffv_997;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_998> AgradCdfExpModNormal_ffv_998;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_999> AgradCdfExpModNormal_ffv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_900, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_901, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_902, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_903, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_904, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_905, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_906, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_907, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_908, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_909, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_910, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_911, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_912, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_913, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_914, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_915, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_916, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_917, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_918, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_919, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_920, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_921, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_922, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_923, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_924, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_925, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_926, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_927, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_928, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_929, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_930, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_931, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_932, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_933, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_934, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_935, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_936, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_937, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_938, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_939, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_940, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_941, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_942, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_943, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_944, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_945, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_946, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_947, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_948, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_949, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_950, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_951, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_952, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_953, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_954, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_955, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_956, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_957, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_958, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_959, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_960, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_961, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_962, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_963, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_964, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_965, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_966, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_967, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_968, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_969, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_970, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_971, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_972, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_973, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_974, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_975, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_976, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_977, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_978, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_979, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_980, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_981, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_982, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_983, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_984, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_985, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_986, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_987, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_988, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_989, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_990, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_991, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_992, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_993, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_994, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_995, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_996, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_997, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_998, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_999, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_v_900;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_901;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_902;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_v_903;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_904;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_905;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_906;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_907;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_908;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_909;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_910;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_911;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_912;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_913;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_914;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_915;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_916;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_917;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_v_918;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_919;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_920;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_v_921;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_922;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_923;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_924;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_925;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_926;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_927;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_928;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_929;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_930;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_931;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_932;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_933;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_934;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_935;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_936;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_937;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_938;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_939;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_940;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_941;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_942;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_943;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_944;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_945;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_946;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_947;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_948;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_949;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_950;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_951;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_952;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_953;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_954;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_955;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_956;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_957;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_958;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_959;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_960;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_961;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_962;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_963;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_964;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_965;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_966;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_967;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_968;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_969;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_970;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_971;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_v_972;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_v_973;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_974;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_v_975;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_v_976;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_977;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_v_978;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_979;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_980;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_v_981;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_982;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_983;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_984;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_985;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_986;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_987;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_988;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_989;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_v_990;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_v_991;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_992;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_v_993;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_v_994;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_995;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_v_996;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_997;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_998;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_v_999;
+
+typedef std::tuple<AgradCdfExpModNormal, type_v_900> AgradCdfExpModNormal_v_900;
+typedef std::tuple<AgradCdfExpModNormal, type_v_901> AgradCdfExpModNormal_v_901;
+typedef std::tuple<AgradCdfExpModNormal, type_v_902> AgradCdfExpModNormal_v_902;
+typedef std::tuple<AgradCdfExpModNormal, type_v_903> AgradCdfExpModNormal_v_903;
+typedef std::tuple<AgradCdfExpModNormal, type_v_904> AgradCdfExpModNormal_v_904;
+typedef std::tuple<AgradCdfExpModNormal, type_v_905> AgradCdfExpModNormal_v_905;
+typedef std::tuple<AgradCdfExpModNormal, type_v_906> AgradCdfExpModNormal_v_906;
+typedef std::tuple<AgradCdfExpModNormal, type_v_907> AgradCdfExpModNormal_v_907;
+typedef std::tuple<AgradCdfExpModNormal, type_v_908> AgradCdfExpModNormal_v_908;
+typedef std::tuple<AgradCdfExpModNormal, type_v_909> AgradCdfExpModNormal_v_909;
+typedef std::tuple<AgradCdfExpModNormal, type_v_910> AgradCdfExpModNormal_v_910;
+typedef std::tuple<AgradCdfExpModNormal, type_v_911> AgradCdfExpModNormal_v_911;
+typedef std::tuple<AgradCdfExpModNormal, type_v_912> AgradCdfExpModNormal_v_912;
+typedef std::tuple<AgradCdfExpModNormal, type_v_913> AgradCdfExpModNormal_v_913;
+typedef std::tuple<AgradCdfExpModNormal, type_v_914> AgradCdfExpModNormal_v_914;
+typedef std::tuple<AgradCdfExpModNormal, type_v_915> AgradCdfExpModNormal_v_915;
+typedef std::tuple<AgradCdfExpModNormal, type_v_916> AgradCdfExpModNormal_v_916;
+typedef std::tuple<AgradCdfExpModNormal, type_v_917> AgradCdfExpModNormal_v_917;
+typedef std::tuple<AgradCdfExpModNormal, type_v_918> AgradCdfExpModNormal_v_918;
+typedef std::tuple<AgradCdfExpModNormal, type_v_919> AgradCdfExpModNormal_v_919;
+typedef std::tuple<AgradCdfExpModNormal, type_v_920> AgradCdfExpModNormal_v_920;
+typedef std::tuple<AgradCdfExpModNormal, type_v_921> AgradCdfExpModNormal_v_921;
+typedef std::tuple<AgradCdfExpModNormal, type_v_922> AgradCdfExpModNormal_v_922;
+typedef std::tuple<AgradCdfExpModNormal, type_v_923> AgradCdfExpModNormal_v_923;
+typedef std::tuple<AgradCdfExpModNormal, type_v_924> AgradCdfExpModNormal_v_924;
+typedef std::tuple<AgradCdfExpModNormal, type_v_925> AgradCdfExpModNormal_v_925;
+typedef std::tuple<AgradCdfExpModNormal, type_v_926> AgradCdfExpModNormal_v_926;
+typedef std::tuple<AgradCdfExpModNormal, type_v_927> AgradCdfExpModNormal_v_927;
+typedef std::tuple<AgradCdfExpModNormal, type_v_928> AgradCdfExpModNormal_v_928;
+typedef std::tuple<AgradCdfExpModNormal, type_v_929> AgradCdfExpModNormal_v_929;
+typedef std::tuple<AgradCdfExpModNormal, type_v_930> AgradCdfExpModNormal_v_930;
+typedef std::tuple<AgradCdfExpModNormal, type_v_931> AgradCdfExpModNormal_v_931;
+typedef std::tuple<AgradCdfExpModNormal, type_v_932> AgradCdfExpModNormal_v_932;
+typedef std::tuple<AgradCdfExpModNormal, type_v_933> AgradCdfExpModNormal_v_933;
+typedef std::tuple<AgradCdfExpModNormal, type_v_934> AgradCdfExpModNormal_v_934;
+typedef std::tuple<AgradCdfExpModNormal, type_v_935> AgradCdfExpModNormal_v_935;
+typedef std::tuple<AgradCdfExpModNormal, type_v_936> AgradCdfExpModNormal_v_936;
+typedef std::tuple<AgradCdfExpModNormal, type_v_937> AgradCdfExpModNormal_v_937;
+typedef std::tuple<AgradCdfExpModNormal, type_v_938> AgradCdfExpModNormal_v_938;
+typedef std::tuple<AgradCdfExpModNormal, type_v_939> AgradCdfExpModNormal_v_939;
+typedef std::tuple<AgradCdfExpModNormal, type_v_940> AgradCdfExpModNormal_v_940;
+typedef std::tuple<AgradCdfExpModNormal, type_v_941> AgradCdfExpModNormal_v_941;
+typedef std::tuple<AgradCdfExpModNormal, type_v_942> AgradCdfExpModNormal_v_942;
+typedef std::tuple<AgradCdfExpModNormal, type_v_943> AgradCdfExpModNormal_v_943;
+typedef std::tuple<AgradCdfExpModNormal, type_v_944> AgradCdfExpModNormal_v_944;
+typedef std::tuple<AgradCdfExpModNormal, type_v_945> AgradCdfExpModNormal_v_945;
+typedef std::tuple<AgradCdfExpModNormal, type_v_946> AgradCdfExpModNormal_v_946;
+typedef std::tuple<AgradCdfExpModNormal, type_v_947> AgradCdfExpModNormal_v_947;
+typedef std::tuple<AgradCdfExpModNormal, type_v_948> AgradCdfExpModNormal_v_948;
+typedef std::tuple<AgradCdfExpModNormal, type_v_949> AgradCdfExpModNormal_v_949;
+typedef std::tuple<AgradCdfExpModNormal, type_v_950> AgradCdfExpModNormal_v_950;
+typedef std::tuple<AgradCdfExpModNormal, type_v_951> AgradCdfExpModNormal_v_951;
+typedef std::tuple<AgradCdfExpModNormal, type_v_952> AgradCdfExpModNormal_v_952;
+typedef std::tuple<AgradCdfExpModNormal, type_v_953> AgradCdfExpModNormal_v_953;
+typedef std::tuple<AgradCdfExpModNormal, type_v_954> AgradCdfExpModNormal_v_954;
+typedef std::tuple<AgradCdfExpModNormal, type_v_955> AgradCdfExpModNormal_v_955;
+typedef std::tuple<AgradCdfExpModNormal, type_v_956> AgradCdfExpModNormal_v_956;
+typedef std::tuple<AgradCdfExpModNormal, type_v_957> AgradCdfExpModNormal_v_957;
+typedef std::tuple<AgradCdfExpModNormal, type_v_958> AgradCdfExpModNormal_v_958;
+typedef std::tuple<AgradCdfExpModNormal, type_v_959> AgradCdfExpModNormal_v_959;
+typedef std::tuple<AgradCdfExpModNormal, type_v_960> AgradCdfExpModNormal_v_960;
+typedef std::tuple<AgradCdfExpModNormal, type_v_961> AgradCdfExpModNormal_v_961;
+typedef std::tuple<AgradCdfExpModNormal, type_v_962> AgradCdfExpModNormal_v_962;
+typedef std::tuple<AgradCdfExpModNormal, type_v_963> AgradCdfExpModNormal_v_963;
+typedef std::tuple<AgradCdfExpModNormal, type_v_964> AgradCdfExpModNormal_v_964;
+typedef std::tuple<AgradCdfExpModNormal, type_v_965> AgradCdfExpModNormal_v_965;
+typedef std::tuple<AgradCdfExpModNormal, type_v_966> AgradCdfExpModNormal_v_966;
+typedef std::tuple<AgradCdfExpModNormal, type_v_967> AgradCdfExpModNormal_v_967;
+typedef std::tuple<AgradCdfExpModNormal, type_v_968> AgradCdfExpModNormal_v_968;
+typedef std::tuple<AgradCdfExpModNormal, type_v_969> AgradCdfExpModNormal_v_969;
+typedef std::tuple<AgradCdfExpModNormal, type_v_970> AgradCdfExpModNormal_v_970;
+typedef std::tuple<AgradCdfExpModNormal, type_v_971> AgradCdfExpModNormal_v_971;
+typedef std::tuple<AgradCdfExpModNormal, type_v_972> AgradCdfExpModNormal_v_972;
+typedef std::tuple<AgradCdfExpModNormal, type_v_973> AgradCdfExpModNormal_v_973;
+typedef std::tuple<AgradCdfExpModNormal, type_v_974> AgradCdfExpModNormal_v_974;
+typedef std::tuple<AgradCdfExpModNormal, type_v_975> AgradCdfExpModNormal_v_975;
+typedef std::tuple<AgradCdfExpModNormal, type_v_976> AgradCdfExpModNormal_v_976;
+typedef std::tuple<AgradCdfExpModNormal, type_v_977> AgradCdfExpModNormal_v_977;
+typedef std::tuple<AgradCdfExpModNormal, type_v_978> AgradCdfExpModNormal_v_978;
+typedef std::tuple<AgradCdfExpModNormal, type_v_979> AgradCdfExpModNormal_v_979;
+typedef std::tuple<AgradCdfExpModNormal, type_v_980> AgradCdfExpModNormal_v_980;
+typedef std::tuple<AgradCdfExpModNormal, type_v_981> AgradCdfExpModNormal_v_981;
+typedef std::tuple<AgradCdfExpModNormal, type_v_982> AgradCdfExpModNormal_v_982;
+typedef std::tuple<AgradCdfExpModNormal, type_v_983> AgradCdfExpModNormal_v_983;
+typedef std::tuple<AgradCdfExpModNormal, type_v_984> AgradCdfExpModNormal_v_984;
+typedef std::tuple<AgradCdfExpModNormal, type_v_985> AgradCdfExpModNormal_v_985;
+typedef std::tuple<AgradCdfExpModNormal, type_v_986> AgradCdfExpModNormal_v_986;
+typedef std::tuple<AgradCdfExpModNormal, type_v_987> AgradCdfExpModNormal_v_987;
+typedef std::tuple<AgradCdfExpModNormal, type_v_988> AgradCdfExpModNormal_v_988;
+typedef std::tuple<AgradCdfExpModNormal, type_v_989> AgradCdfExpModNormal_v_989;
+typedef std::tuple<AgradCdfExpModNormal, type_v_990> AgradCdfExpModNormal_v_990;
+typedef std::tuple<AgradCdfExpModNormal, type_v_991> AgradCdfExpModNormal_v_991;
+typedef std::tuple<AgradCdfExpModNormal, type_v_992> AgradCdfExpModNormal_v_992;
+typedef std::tuple<AgradCdfExpModNormal, type_v_993> AgradCdfExpModNormal_v_993;
+typedef std::tuple<AgradCdfExpModNormal, type_v_994> AgradCdfExpModNormal_v_994;
+typedef std::tuple<AgradCdfExpModNormal, type_v_995> AgradCdfExpModNormal_v_995;
+typedef std::tuple<AgradCdfExpModNormal, type_v_996> AgradCdfExpModNormal_v_996;
+typedef std::tuple<AgradCdfExpModNormal, type_v_997> AgradCdfExpModNormal_v_997;
+typedef std::tuple<AgradCdfExpModNormal, type_v_998> AgradCdfExpModNormal_v_998;
+typedef std::tuple<AgradCdfExpModNormal, type_v_999> AgradCdfExpModNormal_v_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_900, AgradCdfTestFixture, AgradCdfExpModNormal_v_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_901, AgradCdfTestFixture, AgradCdfExpModNormal_v_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_902, AgradCdfTestFixture, AgradCdfExpModNormal_v_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_903, AgradCdfTestFixture, AgradCdfExpModNormal_v_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_904, AgradCdfTestFixture, AgradCdfExpModNormal_v_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_905, AgradCdfTestFixture, AgradCdfExpModNormal_v_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_906, AgradCdfTestFixture, AgradCdfExpModNormal_v_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_907, AgradCdfTestFixture, AgradCdfExpModNormal_v_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_908, AgradCdfTestFixture, AgradCdfExpModNormal_v_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_909, AgradCdfTestFixture, AgradCdfExpModNormal_v_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_910, AgradCdfTestFixture, AgradCdfExpModNormal_v_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_911, AgradCdfTestFixture, AgradCdfExpModNormal_v_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_912, AgradCdfTestFixture, AgradCdfExpModNormal_v_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_913, AgradCdfTestFixture, AgradCdfExpModNormal_v_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_914, AgradCdfTestFixture, AgradCdfExpModNormal_v_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_915, AgradCdfTestFixture, AgradCdfExpModNormal_v_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_916, AgradCdfTestFixture, AgradCdfExpModNormal_v_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_917, AgradCdfTestFixture, AgradCdfExpModNormal_v_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_918, AgradCdfTestFixture, AgradCdfExpModNormal_v_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_919, AgradCdfTestFixture, AgradCdfExpModNormal_v_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_920, AgradCdfTestFixture, AgradCdfExpModNormal_v_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_921, AgradCdfTestFixture, AgradCdfExpModNormal_v_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_922, AgradCdfTestFixture, AgradCdfExpModNormal_v_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_923, AgradCdfTestFixture, AgradCdfExpModNormal_v_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_924, AgradCdfTestFixture, AgradCdfExpModNormal_v_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_925, AgradCdfTestFixture, AgradCdfExpModNormal_v_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_926, AgradCdfTestFixture, AgradCdfExpModNormal_v_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_927, AgradCdfTestFixture, AgradCdfExpModNormal_v_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_928, AgradCdfTestFixture, AgradCdfExpModNormal_v_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_929, AgradCdfTestFixture, AgradCdfExpModNormal_v_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_930, AgradCdfTestFixture, AgradCdfExpModNormal_v_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_931, AgradCdfTestFixture, AgradCdfExpModNormal_v_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_932, AgradCdfTestFixture, AgradCdfExpModNormal_v_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_933, AgradCdfTestFixture, AgradCdfExpModNormal_v_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_934, AgradCdfTestFixture, AgradCdfExpModNormal_v_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_935, AgradCdfTestFixture, AgradCdfExpModNormal_v_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_936, AgradCdfTestFixture, AgradCdfExpModNormal_v_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_937, AgradCdfTestFixture, AgradCdfExpModNormal_v_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_938, AgradCdfTestFixture, AgradCdfExpModNormal_v_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_939, AgradCdfTestFixture, AgradCdfExpModNormal_v_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_940, AgradCdfTestFixture, AgradCdfExpModNormal_v_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_941, AgradCdfTestFixture, AgradCdfExpModNormal_v_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_942, AgradCdfTestFixture, AgradCdfExpModNormal_v_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_943, AgradCdfTestFixture, AgradCdfExpModNormal_v_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_944, AgradCdfTestFixture, AgradCdfExpModNormal_v_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_945, AgradCdfTestFixture, AgradCdfExpModNormal_v_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_946, AgradCdfTestFixture, AgradCdfExpModNormal_v_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_947, AgradCdfTestFixture, AgradCdfExpModNormal_v_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_948, AgradCdfTestFixture, AgradCdfExpModNormal_v_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_949, AgradCdfTestFixture, AgradCdfExpModNormal_v_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_950, AgradCdfTestFixture, AgradCdfExpModNormal_v_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_951, AgradCdfTestFixture, AgradCdfExpModNormal_v_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_952, AgradCdfTestFixture, AgradCdfExpModNormal_v_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_953, AgradCdfTestFixture, AgradCdfExpModNormal_v_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_954, AgradCdfTestFixture, AgradCdfExpModNormal_v_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_955, AgradCdfTestFixture, AgradCdfExpModNormal_v_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_956, AgradCdfTestFixture, AgradCdfExpModNormal_v_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_957, AgradCdfTestFixture, AgradCdfExpModNormal_v_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_958, AgradCdfTestFixture, AgradCdfExpModNormal_v_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_959, AgradCdfTestFixture, AgradCdfExpModNormal_v_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_960, AgradCdfTestFixture, AgradCdfExpModNormal_v_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_961, AgradCdfTestFixture, AgradCdfExpModNormal_v_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_962, AgradCdfTestFixture, AgradCdfExpModNormal_v_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_963, AgradCdfTestFixture, AgradCdfExpModNormal_v_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_964, AgradCdfTestFixture, AgradCdfExpModNormal_v_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_965, AgradCdfTestFixture, AgradCdfExpModNormal_v_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_966, AgradCdfTestFixture, AgradCdfExpModNormal_v_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_967, AgradCdfTestFixture, AgradCdfExpModNormal_v_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_968, AgradCdfTestFixture, AgradCdfExpModNormal_v_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_969, AgradCdfTestFixture, AgradCdfExpModNormal_v_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_970, AgradCdfTestFixture, AgradCdfExpModNormal_v_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_971, AgradCdfTestFixture, AgradCdfExpModNormal_v_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_972, AgradCdfTestFixture, AgradCdfExpModNormal_v_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_973, AgradCdfTestFixture, AgradCdfExpModNormal_v_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_974, AgradCdfTestFixture, AgradCdfExpModNormal_v_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_975, AgradCdfTestFixture, AgradCdfExpModNormal_v_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_976, AgradCdfTestFixture, AgradCdfExpModNormal_v_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_977, AgradCdfTestFixture, AgradCdfExpModNormal_v_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_978, AgradCdfTestFixture, AgradCdfExpModNormal_v_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_979, AgradCdfTestFixture, AgradCdfExpModNormal_v_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_980, AgradCdfTestFixture, AgradCdfExpModNormal_v_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_981, AgradCdfTestFixture, AgradCdfExpModNormal_v_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_982, AgradCdfTestFixture, AgradCdfExpModNormal_v_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_983, AgradCdfTestFixture, AgradCdfExpModNormal_v_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_984, AgradCdfTestFixture, AgradCdfExpModNormal_v_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_985, AgradCdfTestFixture, AgradCdfExpModNormal_v_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_986, AgradCdfTestFixture, AgradCdfExpModNormal_v_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_987, AgradCdfTestFixture, AgradCdfExpModNormal_v_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_988, AgradCdfTestFixture, AgradCdfExpModNormal_v_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_989, AgradCdfTestFixture, AgradCdfExpModNormal_v_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_990, AgradCdfTestFixture, AgradCdfExpModNormal_v_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_991, AgradCdfTestFixture, AgradCdfExpModNormal_v_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_992, AgradCdfTestFixture, AgradCdfExpModNormal_v_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_993, AgradCdfTestFixture, AgradCdfExpModNormal_v_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_994, AgradCdfTestFixture, AgradCdfExpModNormal_v_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_995, AgradCdfTestFixture, AgradCdfExpModNormal_v_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_996, AgradCdfTestFixture, AgradCdfExpModNormal_v_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_997, AgradCdfTestFixture, AgradCdfExpModNormal_v_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_998, AgradCdfTestFixture, AgradCdfExpModNormal_v_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_v_999, AgradCdfTestFixture, AgradCdfExpModNormal_v_999);
+
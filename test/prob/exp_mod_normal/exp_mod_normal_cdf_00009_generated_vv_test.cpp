@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_vv_900;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_901;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_902;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_903;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_904;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_905;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_906;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_907;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_908;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_vv_909;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_vv_910;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_911;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_vv_912;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_vv_913;
+typedef std::tuple<std::vector<var>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_914;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_vv_915;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_916;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_917;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_vv_918;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_919;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_920;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_921;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_922;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_923;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_924;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_925;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_926;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_vv_927;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_928;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_929;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_vv_930;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_931;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_932;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_933;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_934;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_935;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_936;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_937;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_938;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_939;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_940;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_941;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_942;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_943;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_944;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_vv_945;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_946;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_947;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_vv_948;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_949;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_950;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_951;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_952;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_953;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_954;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_955;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_956;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_957;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_958;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_959;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_960;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_961;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_962;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_963;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_964;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_965;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_966;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_967;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_968;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_969;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_970;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_971;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_972;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_973;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_974;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_975;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_976;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_977;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_978;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_979;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_980;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_981;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_982;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_983;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_984;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_985;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_986;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_987;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_988;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_989;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_990;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_991;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_992;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_993;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_994;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_995;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_996;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_997;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_998;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, double, empty, empty> type_vv_999;
+
+typedef std::tuple<AgradCdfExpModNormal, type_vv_900> AgradCdfExpModNormal_vv_900;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_901> AgradCdfExpModNormal_vv_901;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_902> AgradCdfExpModNormal_vv_902;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_903> AgradCdfExpModNormal_vv_903;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_904> AgradCdfExpModNormal_vv_904;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_905> AgradCdfExpModNormal_vv_905;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_906> AgradCdfExpModNormal_vv_906;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_907> AgradCdfExpModNormal_vv_907;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_908> AgradCdfExpModNormal_vv_908;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_909> AgradCdfExpModNormal_vv_909;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_910> AgradCdfExpModNormal_vv_910;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_911> AgradCdfExpModNormal_vv_911;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_912> AgradCdfExpModNormal_vv_912;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_913> AgradCdfExpModNormal_vv_913;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_914> AgradCdfExpModNormal_vv_914;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_915> AgradCdfExpModNormal_vv_915;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_916> AgradCdfExpModNormal_vv_916;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_917> AgradCdfExpModNormal_vv_917;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_918> AgradCdfExpModNormal_vv_918;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_919> AgradCdfExpModNormal_vv_919;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_920> AgradCdfExpModNormal_vv_920;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_921> AgradCdfExpModNormal_vv_921;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_922> AgradCdfExpModNormal_vv_922;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_923> AgradCdfExpModNormal_vv_923;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_924> AgradCdfExpModNormal_vv_924;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_925> AgradCdfExpModNormal_vv_925;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_926> AgradCdfExpModNormal_vv_926;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_927> AgradCdfExpModNormal_vv_927;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_928> AgradCdfExpModNormal_vv_928;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_929> AgradCdfExpModNormal_vv_929;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_930> AgradCdfExpModNormal_vv_930;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_931> AgradCdfExpModNormal_vv_931;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_932> AgradCdfExpModNormal_vv_932;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_933> AgradCdfExpModNormal_vv_933;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_934> AgradCdfExpModNormal_vv_934;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_935> AgradCdfExpModNormal_vv_935;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_936> AgradCdfExpModNormal_vv_936;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_937> AgradCdfExpModNormal_vv_937;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_938> AgradCdfExpModNormal_vv_938;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_939> AgradCdfExpModNormal_vv_939;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_940> AgradCdfExpModNormal_vv_940;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_941> AgradCdfExpModNormal_vv_941;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_942> AgradCdfExpModNormal_vv_942;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_943> AgradCdfExpModNormal_vv_943;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_944> AgradCdfExpModNormal_vv_944;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_945> AgradCdfExpModNormal_vv_945;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_946> AgradCdfExpModNormal_vv_946;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_947> AgradCdfExpModNormal_vv_947;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_948> AgradCdfExpModNormal_vv_948;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_949> AgradCdfExpModNormal_vv_949;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_950> AgradCdfExpModNormal_vv_950;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_951> AgradCdfExpModNormal_vv_951;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_952> AgradCdfExpModNormal_vv_952;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_953> AgradCdfExpModNormal_vv_953;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_954> AgradCdfExpModNormal_vv_954;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_955> AgradCdfExpModNormal_vv_955;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_956> AgradCdfExpModNormal_vv_956;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_957> AgradCdfExpModNormal_vv_957;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_958> AgradCdfExpModNormal_vv_958;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_959> AgradCdfExpModNormal_vv_959;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_960> AgradCdfExpModNormal_vv_960;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_961> AgradCdfExpModNormal_vv_961;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_962> AgradCdfExpModNormal_vv_962;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_963> AgradCdfExpModNormal_vv_963;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_964> AgradCdfExpModNormal_vv_964;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_965> AgradCdfExpModNormal_vv_965;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_966> AgradCdfExpModNormal_vv_966;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_967> AgradCdfExpModNormal_vv_967;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_968> AgradCdfExpModNormal_vv_968;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_969> AgradCdfExpModNormal_vv_969;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_970> AgradCdfExpModNormal_vv_970;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_971> AgradCdfExpModNormal_vv_971;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_972> AgradCdfExpModNormal_vv_972;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_973> AgradCdfExpModNormal_vv_973;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_974> AgradCdfExpModNormal_vv_974;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_975> AgradCdfExpModNormal_vv_975;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_976> AgradCdfExpModNormal_vv_976;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_977> AgradCdfExpModNormal_vv_977;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_978> AgradCdfExpModNormal_vv_978;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_979> AgradCdfExpModNormal_vv_979;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_980> AgradCdfExpModNormal_vv_980;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_981> AgradCdfExpModNormal_vv_981;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_982> AgradCdfExpModNormal_vv_982;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_983> AgradCdfExpModNormal_vv_983;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_984> AgradCdfExpModNormal_vv_984;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_985> AgradCdfExpModNormal_vv_985;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_986> AgradCdfExpModNormal_vv_986;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_987> AgradCdfExpModNormal_vv_987;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_988> AgradCdfExpModNormal_vv_988;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_989> AgradCdfExpModNormal_vv_989;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_990> AgradCdfExpModNormal_vv_990;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_991> AgradCdfExpModNormal_vv_991;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_992> AgradCdfExpModNormal_vv_992;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_993> AgradCdfExpModNormal_vv_993;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_994> AgradCdfExpModNormal_vv_994;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_995> AgradCdfExpModNormal_vv_995;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_996> AgradCdfExpModNormal_vv_996;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_997> AgradCdfExpModNormal_vv_997;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_998> AgradCdfExpModNormal_vv_998;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_999> AgradCdfExpModNormal_vv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_900, AgradCdfTestFixture, AgradCdfExpModNormal_vv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_901, AgradCdfTestFixture, AgradCdfExpModNormal_vv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_902, AgradCdfTestFixture, AgradCdfExpModNormal_vv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_903, AgradCdfTestFixture, AgradCdfExpModNormal_vv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_904, AgradCdfTestFixture, AgradCdfExpModNormal_vv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_905, AgradCdfTestFixture, AgradCdfExpModNormal_vv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_906, AgradCdfTestFixture, AgradCdfExpModNormal_vv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_907, AgradCdfTestFixture, AgradCdfExpModNormal_vv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_908, AgradCdfTestFixture, AgradCdfExpModNormal_vv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_909, AgradCdfTestFixture, AgradCdfExpModNormal_vv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_910, AgradCdfTestFixture, AgradCdfExpModNormal_vv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_911, AgradCdfTestFixture, AgradCdfExpModNormal_vv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_912, AgradCdfTestFixture, AgradCdfExpModNormal_vv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_913, AgradCdfTestFixture, AgradCdfExpModNormal_vv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_914, AgradCdfTestFixture, AgradCdfExpModNormal_vv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_915, AgradCdfTestFixture, AgradCdfExpModNormal_vv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_916, AgradCdfTestFixture, AgradCdfExpModNormal_vv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_917, AgradCdfTestFixture, AgradCdfExpModNormal_vv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_918, AgradCdfTestFixture, AgradCdfExpModNormal_vv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_919, AgradCdfTestFixture, AgradCdfExpModNormal_vv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_920, AgradCdfTestFixture, AgradCdfExpModNormal_vv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_921, AgradCdfTestFixture, AgradCdfExpModNormal_vv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_922, AgradCdfTestFixture, AgradCdfExpModNormal_vv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_923, AgradCdfTestFixture, AgradCdfExpModNormal_vv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_924, AgradCdfTestFixture, AgradCdfExpModNormal_vv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_925, AgradCdfTestFixture, AgradCdfExpModNormal_vv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_926, AgradCdfTestFixture, AgradCdfExpModNormal_vv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_927, AgradCdfTestFixture, AgradCdfExpModNormal_vv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_928, AgradCdfTestFixture, AgradCdfExpModNormal_vv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_929, AgradCdfTestFixture, AgradCdfExpModNormal_vv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_930, AgradCdfTestFixture, AgradCdfExpModNormal_vv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_931, AgradCdfTestFixture, AgradCdfExpModNormal_vv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_932, AgradCdfTestFixture, AgradCdfExpModNormal_vv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_933, AgradCdfTestFixture, AgradCdfExpModNormal_vv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_934, AgradCdfTestFixture, AgradCdfExpModNormal_vv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_935, AgradCdfTestFixture, AgradCdfExpModNormal_vv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_936, AgradCdfTestFixture, AgradCdfExpModNormal_vv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_937, AgradCdfTestFixture, AgradCdfExpModNormal_vv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_938, AgradCdfTestFixture, AgradCdfExpModNormal_vv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_939, AgradCdfTestFixture, AgradCdfExpModNormal_vv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_940, AgradCdfTestFixture, AgradCdfExpModNormal_vv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_941, AgradCdfTestFixture, AgradCdfExpModNormal_vv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_942, AgradCdfTestFixture, AgradCdfExpModNormal_vv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_943, AgradCdfTestFixture, AgradCdfExpModNormal_vv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_944, AgradCdfTestFixture, AgradCdfExpModNormal_vv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_945, AgradCdfTestFixture, AgradCdfExpModNormal_vv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_946, AgradCdfTestFixture, AgradCdfExpModNormal_vv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_947, AgradCdfTestFixture, AgradCdfExpModNormal_vv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_948, AgradCdfTestFixture, AgradCdfExpModNormal_vv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_949, AgradCdfTestFixture, AgradCdfExpModNormal_vv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_950, AgradCdfTestFixture, AgradCdfExpModNormal_vv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_951, AgradCdfTestFixture, AgradCdfExpModNormal_vv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_952, AgradCdfTestFixture, AgradCdfExpModNormal_vv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_953, AgradCdfTestFixture, AgradCdfExpModNormal_vv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_954, AgradCdfTestFixture, AgradCdfExpModNormal_vv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_955, AgradCdfTestFixture, AgradCdfExpModNormal_vv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_956, AgradCdfTestFixture, AgradCdfExpModNormal_vv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_957, AgradCdfTestFixture, AgradCdfExpModNormal_vv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_958, AgradCdfTestFixture, AgradCdfExpModNormal_vv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_959, AgradCdfTestFixture, AgradCdfExpModNormal_vv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_960, AgradCdfTestFixture, AgradCdfExpModNormal_vv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_961, AgradCdfTestFixture, AgradCdfExpModNormal_vv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_962, AgradCdfTestFixture, AgradCdfExpModNormal_vv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_963, AgradCdfTestFixture, AgradCdfExpModNormal_vv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_964, AgradCdfTestFixture, AgradCdfExpModNormal_vv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_965, AgradCdfTestFixture, AgradCdfExpModNormal_vv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_966, AgradCdfTestFixture, AgradCdfExpModNormal_vv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_967, AgradCdfTestFixture, AgradCdfExpModNormal_vv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_968, AgradCdfTestFixture, AgradCdfExpModNormal_vv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_969, AgradCdfTestFixture, AgradCdfExpModNormal_vv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_970, AgradCdfTestFixture, AgradCdfExpModNormal_vv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_971, AgradCdfTestFixture, AgradCdfExpModNormal_vv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_972, AgradCdfTestFixture, AgradCdfExpModNormal_vv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_973, AgradCdfTestFixture, AgradCdfExpModNormal_vv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_974, AgradCdfTestFixture, AgradCdfExpModNormal_vv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_975, AgradCdfTestFixture, AgradCdfExpModNormal_vv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_976, AgradCdfTestFixture, AgradCdfExpModNormal_vv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_977, AgradCdfTestFixture, AgradCdfExpModNormal_vv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_978, AgradCdfTestFixture, AgradCdfExpModNormal_vv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_979, AgradCdfTestFixture, AgradCdfExpModNormal_vv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_980, AgradCdfTestFixture, AgradCdfExpModNormal_vv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_981, AgradCdfTestFixture, AgradCdfExpModNormal_vv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_982, AgradCdfTestFixture, AgradCdfExpModNormal_vv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_983, AgradCdfTestFixture, AgradCdfExpModNormal_vv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_984, AgradCdfTestFixture, AgradCdfExpModNormal_vv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_985, AgradCdfTestFixture, AgradCdfExpModNormal_vv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_986, AgradCdfTestFixture, AgradCdfExpModNormal_vv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_987, AgradCdfTestFixture, AgradCdfExpModNormal_vv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_988, AgradCdfTestFixture, AgradCdfExpModNormal_vv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_989, AgradCdfTestFixture, AgradCdfExpModNormal_vv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_990, AgradCdfTestFixture, AgradCdfExpModNormal_vv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_991, AgradCdfTestFixture, AgradCdfExpModNormal_vv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_992, AgradCdfTestFixture, AgradCdfExpModNormal_vv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_993, AgradCdfTestFixture, AgradCdfExpModNormal_vv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_994, AgradCdfTestFixture, AgradCdfExpModNormal_vv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_995, AgradCdfTestFixture, AgradCdfExpModNormal_vv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_996, AgradCdfTestFixture, AgradCdfExpModNormal_vv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_997, AgradCdfTestFixture, AgradCdfExpModNormal_vv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_998, AgradCdfTestFixture, AgradCdfExpModNormal_vv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_999, AgradCdfTestFixture, AgradCdfExpModNormal_vv_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, std::vector<double>, empty, empty> type_vv_1000;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1001;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, var, empty, empty> type_vv_1002;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, std::vector<var>, empty, empty> type_vv_1003;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1004;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, double, empty, empty> type_vv_1005;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_1006;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1007;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, var, empty, empty> type_vv_1008;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_1009;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1010;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1011;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1012;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1013;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1014;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1015;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1016;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, double, empty, empty> type_vv_1017;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, std::vector<double>, empty, empty> type_vv_1018;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1019;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, var, empty, empty> type_vv_1020;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, std::vector<var>, empty, empty> type_vv_1021;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1022;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, double, empty, empty> type_vv_1023;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_1024;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1025;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, var, empty, empty> type_vv_1026;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_1027;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1028;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1029;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1030;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1031;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1032;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1033;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1034;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, double, empty, empty> type_vv_1035;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_1036;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1037;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, var, empty, empty> type_vv_1038;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_1039;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1040;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_1041;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_1042;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1043;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_1044;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_1045;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1046;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1047;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1048;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1049;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1050;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1051;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1052;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, double, empty, empty> type_vv_1053;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_1054;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1055;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, var, empty, empty> type_vv_1056;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_1057;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1058;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_1059;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_1060;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1061;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_1062;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_1063;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1064;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1065;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1066;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1067;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1068;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1069;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1070;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_1071;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_1072;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1073;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_1074;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_1075;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1076;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_1077;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_1078;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1079;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_1080;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_1081;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1082;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1083;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1084;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1085;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1086;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1087;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1088;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_1089;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_1090;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1091;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_1092;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_1093;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1094;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_1095;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_1096;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1097;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_1098;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_1099;
+
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1000> AgradCdfExpModNormal_vv_1000;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1001> AgradCdfExpModNormal_vv_1001;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1002> AgradCdfExpModNormal_vv_1002;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1003> AgradCdfExpModNormal_vv_1003;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1004> AgradCdfExpModNormal_vv_1004;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1005> AgradCdfExpModNormal_vv_1005;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1006> AgradCdfExpModNormal_vv_1006;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1007> AgradCdfExpModNormal_vv_1007;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1008> AgradCdfExpModNormal_vv_1008;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1009> AgradCdfExpModNormal_vv_1009;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1010> AgradCdfExpModNormal_vv_1010;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1011> AgradCdfExpModNormal_vv_1011;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1012> AgradCdfExpModNormal_vv_1012;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1013> AgradCdfExpModNormal_vv_1013;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1014> AgradCdfExpModNormal_vv_1014;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1015> AgradCdfExpModNormal_vv_1015;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1016> AgradCdfExpModNormal_vv_1016;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1017> AgradCdfExpModNormal_vv_1017;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1018> AgradCdfExpModNormal_vv_1018;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1019> AgradCdfExpModNormal_vv_1019;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1020> AgradCdfExpModNormal_vv_1020;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1021> AgradCdfExpModNormal_vv_1021;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1022> AgradCdfExpModNormal_vv_1022;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1023> AgradCdfExpModNormal_vv_1023;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1024> AgradCdfExpModNormal_vv_1024;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1025> AgradCdfExpModNormal_vv_1025;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1026> AgradCdfExpModNormal_vv_1026;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1027> AgradCdfExpModNormal_vv_1027;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1028> AgradCdfExpModNormal_vv_1028;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1029> AgradCdfExpModNormal_vv_1029;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1030> AgradCdfExpModNormal_vv_1030;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1031> AgradCdfExpModNormal_vv_1031;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1032> AgradCdfExpModNormal_vv_1032;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1033> AgradCdfExpModNormal_vv_1033;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1034> AgradCdfExpModNormal_vv_1034;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1035> AgradCdfExpModNormal_vv_1035;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1036> AgradCdfExpModNormal_vv_1036;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1037> AgradCdfExpModNormal_vv_1037;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1038> AgradCdfExpModNormal_vv_1038;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1039> AgradCdfExpModNormal_vv_1039;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1040> AgradCdfExpModNormal_vv_1040;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1041> AgradCdfExpModNormal_vv_1041;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1042> AgradCdfExpModNormal_vv_1042;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1043> AgradCdfExpModNormal_vv_1043;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1044> AgradCdfExpModNormal_vv_1044;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1045> AgradCdfExpModNormal_vv_1045;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1046> AgradCdfExpModNormal_vv_1046;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1047> AgradCdfExpModNormal_vv_1047;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1048> AgradCdfExpModNormal_vv_1048;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1049> AgradCdfExpModNormal_vv_1049;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1050> AgradCdfExpModNormal_vv_1050;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1051> AgradCdfExpModNormal_vv_1051;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1052> AgradCdfExpModNormal_vv_1052;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1053> AgradCdfExpModNormal_vv_1053;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1054> AgradCdfExpModNormal_vv_1054;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1055> AgradCdfExpModNormal_vv_1055;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1056> AgradCdfExpModNormal_vv_1056;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1057> AgradCdfExpModNormal_vv_1057;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1058> AgradCdfExpModNormal_vv_1058;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1059> AgradCdfExpModNormal_vv_1059;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1060> AgradCdfExpModNormal_vv_1060;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1061> AgradCdfExpModNormal_vv_1061;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1062> AgradCdfExpModNormal_vv_1062;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1063> AgradCdfExpModNormal_vv_1063;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1064> AgradCdfExpModNormal_vv_1064;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1065> AgradCdfExpModNormal_vv_1065;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1066> AgradCdfExpModNormal_vv_1066;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1067> AgradCdfExpModNormal_vv_1067;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1068> AgradCdfExpModNormal_vv_1068;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1069> AgradCdfExpModNormal_vv_1069;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1070> AgradCdfExpModNormal_vv_1070;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1071> AgradCdfExpModNormal_vv_1071;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1072> AgradCdfExpModNormal_vv_1072;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1073> AgradCdfExpModNormal_vv_1073;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1074> AgradCdfExpModNormal_vv_1074;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1075> AgradCdfExpModNormal_vv_1075;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1076> AgradCdfExpModNormal_vv_1076;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1077> AgradCdfExpModNormal_vv_1077;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1078> AgradCdfExpModNormal_vv_1078;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1079> AgradCdfExpModNormal_vv_1079;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1080> AgradCdfExpModNormal_vv_1080;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1081> AgradCdfExpModNormal_vv_1081;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1082> AgradCdfExpModNormal_vv_1082;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1083> AgradCdfExpModNormal_vv_1083;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1084> AgradCdfExpModNormal_vv_1084;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1085> AgradCdfExpModNormal_vv_1085;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1086> AgradCdfExpModNormal_vv_1086;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1087> AgradCdfExpModNormal_vv_1087;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1088> AgradCdfExpModNormal_vv_1088;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1089> AgradCdfExpModNormal_vv_1089;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1090> AgradCdfExpModNormal_vv_1090;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1091> AgradCdfExpModNormal_vv_1091;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1092> AgradCdfExpModNormal_vv_1092;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1093> AgradCdfExpModNormal_vv_1093;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1094> AgradCdfExpModNormal_vv_1094;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1095> AgradCdfExpModNormal_vv_1095;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1096> AgradCdfExpModNormal_vv_1096;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1097> AgradCdfExpModNormal_vv_1097;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1098> AgradCdfExpModNormal_vv_1098;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1099> AgradCdfExpModNormal_vv_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1000, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1001, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1002, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1003, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1004, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1005, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1006, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1007, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1008, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1009, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1010, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1011, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1012, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1013, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1014, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1015, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1016, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1017, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1018, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1019, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1020, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1021, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1022, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1023, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1024, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1025, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1026, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1027, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1028, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1029, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1030, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1031, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1032, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1033, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1034, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1035, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1036, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1037, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1038, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1039, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1040, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1041, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1042, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1043, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1044, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1045, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1046, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1047, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1048, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1049, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1050, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1051, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1052, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1053, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1054, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1055, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1056, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1057, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1058, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1059, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1060, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1061, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1062, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1063, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1064, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1065, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1066, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1067, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1068, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1069, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1070, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1071, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1072, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1073, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1074, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1075, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1076, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1077, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1078, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1079, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1080, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1081, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1082, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1083, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1084, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1085, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1086, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1087, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1088, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1089, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1090, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1091, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1092, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1093, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1094, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1095, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1096, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1097, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1098, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1099, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1099);
+
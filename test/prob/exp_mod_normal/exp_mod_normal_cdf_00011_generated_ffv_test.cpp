@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1100;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1101;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1102;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1103;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1104;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1105;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1106;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_1107;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_1108;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1109;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_1110;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1111;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1112;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_1113;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1114;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1115;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1116;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1117;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1118;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1119;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1120;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1121;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1122;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1123;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1124;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_1125;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1126;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1127;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1128;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1129;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1130;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1131;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1132;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1133;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1134;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1135;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1136;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1137;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1138;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1139;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1140;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1141;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1142;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_1143;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_1144;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1145;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_1146;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1147;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1148;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_1149;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1150;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1151;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_1161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_1179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_1180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_1182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_1185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1188;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1189;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1190;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1191;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1192;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1193;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1194;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1195;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1196;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_1197;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1198;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1199;
+
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1100> AgradCdfExpModNormal_ffv_1100;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1101> AgradCdfExpModNormal_ffv_1101;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1102> AgradCdfExpModNormal_ffv_1102;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1103> AgradCdfExpModNormal_ffv_1103;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1104> AgradCdfExpModNormal_ffv_1104;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1105> AgradCdfExpModNormal_ffv_1105;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1106> AgradCdfExpModNormal_ffv_1106;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1107> AgradCdfExpModNormal_ffv_1107;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1108> AgradCdfExpModNormal_ffv_1108;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1109> AgradCdfExpModNormal_ffv_1109;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1110> AgradCdfExpModNormal_ffv_1110;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1111> AgradCdfExpModNormal_ffv_1111;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1112> AgradCdfExpModNormal_ffv_1112;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1113> AgradCdfExpModNormal_ffv_1113;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1114> AgradCdfExpModNormal_ffv_1114;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1115> AgradCdfExpModNormal_ffv_1115;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1116> AgradCdfExpModNormal_ffv_1116;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1117> AgradCdfExpModNormal_ffv_1117;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1118> AgradCdfExpModNormal_ffv_1118;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1119> AgradCdfExpModNormal_ffv_1119;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1120> AgradCdfExpModNormal_ffv_1120;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1121> AgradCdfExpModNormal_ffv_1121;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1122> AgradCdfExpModNormal_ffv_1122;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1123> AgradCdfExpModNormal_ffv_1123;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1124> AgradCdfExpModNormal_ffv_1124;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1125> AgradCdfExpModNormal_ffv_1125;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1126> AgradCdfExpModNormal_ffv_1126;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1127> AgradCdfExpModNormal_ffv_1127;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1128> AgradCdfExpModNormal_ffv_1128;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1129> AgradCdfExpModNormal_ffv_1129;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1130> AgradCdfExpModNormal_ffv_1130;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1131> AgradCdfExpModNormal_ffv_1131;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1132> AgradCdfExpModNormal_ffv_1132;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1133> AgradCdfExpModNormal_ffv_1133;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1134> AgradCdfExpModNormal_ffv_1134;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1135> AgradCdfExpModNormal_ffv_1135;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1136> AgradCdfExpModNormal_ffv_1136;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1137> AgradCdfExpModNormal_ffv_1137;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1138> AgradCdfExpModNormal_ffv_1138;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1139> AgradCdfExpModNormal_ffv_1139;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1140> AgradCdfExpModNormal_ffv_1140;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1141> AgradCdfExpModNormal_ffv_1141;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1142> AgradCdfExpModNormal_ffv_1142;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1143> AgradCdfExpModNormal_ffv_1143;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1144> AgradCdfExpModNormal_ffv_1144;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1145> AgradCdfExpModNormal_ffv_1145;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1146> AgradCdfExpModNormal_ffv_1146;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1147> AgradCdfExpModNormal_ffv_1147;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1148> AgradCdfExpModNormal_ffv_1148;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1149> AgradCdfExpModNormal_ffv_1149;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1150> AgradCdfExpModNormal_ffv_1150;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1151> AgradCdfExpModNormal_ffv_1151;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1152> AgradCdfExpModNormal_ffv_1152;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1153> AgradCdfExpModNormal_ffv_1153;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1154> AgradCdfExpModNormal_ffv_1154;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1155> AgradCdfExpModNormal_ffv_1155;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1156> AgradCdfExpModNormal_ffv_1156;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1157> AgradCdfExpModNormal_ffv_1157;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1158> AgradCdfExpModNormal_ffv_1158;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1159> AgradCdfExpModNormal_ffv_1159;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1160> AgradCdfExpModNormal_ffv_1160;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1161> AgradCdfExpModNormal_ffv_1161;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1162> AgradCdfExpModNormal_ffv_1162;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1163> AgradCdfExpModNormal_ffv_1163;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1164> AgradCdfExpModNormal_ffv_1164;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1165> AgradCdfExpModNormal_ffv_1165;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1166> AgradCdfExpModNormal_ffv_1166;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1167> AgradCdfExpModNormal_ffv_1167;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1168> AgradCdfExpModNormal_ffv_1168;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1169> AgradCdfExpModNormal_ffv_1169;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1170> AgradCdfExpModNormal_ffv_1170;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1171> AgradCdfExpModNormal_ffv_1171;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1172> AgradCdfExpModNormal_ffv_1172;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1173> AgradCdfExpModNormal_ffv_1173;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1174> AgradCdfExpModNormal_ffv_1174;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1175> AgradCdfExpModNormal_ffv_1175;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1176> AgradCdfExpModNormal_ffv_1176;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1177> AgradCdfExpModNormal_ffv_1177;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1178> AgradCdfExpModNormal_ffv_1178;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1179> AgradCdfExpModNormal_ffv_1179;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1180> AgradCdfExpModNormal_ffv_1180;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1181> AgradCdfExpModNormal_ffv_1181;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1182> AgradCdfExpModNormal_ffv_1182;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1183> AgradCdfExpModNormal_ffv_1183;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1184> AgradCdfExpModNormal_ffv_1184;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1185> AgradCdfExpModNormal_ffv_1185;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1186> AgradCdfExpModNormal_ffv_1186;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1187> AgradCdfExpModNormal_ffv_1187;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1188> AgradCdfExpModNormal_ffv_1188;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1189> AgradCdfExpModNormal_ffv_1189;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1190> AgradCdfExpModNormal_ffv_1190;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1191> AgradCdfExpModNormal_ffv_1191;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1192> AgradCdfExpModNormal_ffv_1192;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1193> AgradCdfExpModNormal_ffv_1193;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1194> AgradCdfExpModNormal_ffv_1194;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1195> AgradCdfExpModNormal_ffv_1195;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1196> AgradCdfExpModNormal_ffv_1196;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1197> AgradCdfExpModNormal_ffv_1197;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1198> AgradCdfExpModNormal_ffv_1198;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1199> AgradCdfExpModNormal_ffv_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1100, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1101, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1102, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1103, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1104, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1105, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1106, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1107, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1108, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1109, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1110, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1111, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1112, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1113, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1114, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1115, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1116, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1117, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1118, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1119, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1120, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1121, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1122, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1123, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1124, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1125, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1126, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1127, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1128, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1129, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1130, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1131, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1132, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1133, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1134, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1135, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1136, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1137, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1138, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1139, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1140, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1141, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1142, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1143, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1144, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1145, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1146, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1147, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1148, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1149, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1150, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1151, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1152, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1153, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1154, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1155, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1156, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1157, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1158, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1159, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1160, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1161, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1162, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1163, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1164, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1165, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1166, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1167, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1168, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1169, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1170, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1171, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1172, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1173, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1174, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1175, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1176, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1177, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1178, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1179, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1180, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1181, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1182, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1183, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1184, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1185, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1186, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1187, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1188, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1189, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1190, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1191, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1192, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1193, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1194, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1195, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1196, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1197, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1198, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1199, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1199);
+
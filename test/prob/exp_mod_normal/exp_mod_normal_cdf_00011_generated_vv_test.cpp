@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1100;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1101;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1102;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1103;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1104;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1105;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1106;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, double, empty, empty> type_vv_1107;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, std::vector<double>, empty, empty> type_vv_1108;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1109;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, var, empty, empty> type_vv_1110;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, std::vector<var>, empty, empty> type_vv_1111;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1112;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, double, empty, empty> type_vv_1113;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_1114;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1115;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, var, empty, empty> type_vv_1116;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_1117;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1118;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1119;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1120;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1121;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1122;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1123;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1124;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, double, empty, empty> type_vv_1125;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, std::vector<double>, empty, empty> type_vv_1126;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1127;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, var, empty, empty> type_vv_1128;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, std::vector<var>, empty, empty> type_vv_1129;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1130;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, double, empty, empty> type_vv_1131;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_1132;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1133;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, var, empty, empty> type_vv_1134;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_1135;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1136;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1137;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1138;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1139;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1140;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1141;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1142;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, double, empty, empty> type_vv_1143;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_1144;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1145;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, var, empty, empty> type_vv_1146;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_1147;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1148;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_1149;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_1150;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1151;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_1152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_1153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, double, empty, empty> type_vv_1161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_1162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, var, empty, empty> type_vv_1164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_1165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_1167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_1168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_1170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_1171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_1179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_1180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_1182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_1183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_1185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_1186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_1188;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_1189;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1190;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1191;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1192;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1193;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1194;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1195;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1196;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_1197;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_1198;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1199;
+
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1100> AgradCdfExpModNormal_vv_1100;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1101> AgradCdfExpModNormal_vv_1101;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1102> AgradCdfExpModNormal_vv_1102;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1103> AgradCdfExpModNormal_vv_1103;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1104> AgradCdfExpModNormal_vv_1104;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1105> AgradCdfExpModNormal_vv_1105;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1106> AgradCdfExpModNormal_vv_1106;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1107> AgradCdfExpModNormal_vv_1107;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1108> AgradCdfExpModNormal_vv_1108;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1109> AgradCdfExpModNormal_vv_1109;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1110> AgradCdfExpModNormal_vv_1110;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1111> AgradCdfExpModNormal_vv_1111;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1112> AgradCdfExpModNormal_vv_1112;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1113> AgradCdfExpModNormal_vv_1113;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1114> AgradCdfExpModNormal_vv_1114;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1115> AgradCdfExpModNormal_vv_1115;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1116> AgradCdfExpModNormal_vv_1116;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1117> AgradCdfExpModNormal_vv_1117;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1118> AgradCdfExpModNormal_vv_1118;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1119> AgradCdfExpModNormal_vv_1119;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1120> AgradCdfExpModNormal_vv_1120;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1121> AgradCdfExpModNormal_vv_1121;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1122> AgradCdfExpModNormal_vv_1122;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1123> AgradCdfExpModNormal_vv_1123;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1124> AgradCdfExpModNormal_vv_1124;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1125> AgradCdfExpModNormal_vv_1125;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1126> AgradCdfExpModNormal_vv_1126;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1127> AgradCdfExpModNormal_vv_1127;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1128> AgradCdfExpModNormal_vv_1128;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1129> AgradCdfExpModNormal_vv_1129;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1130> AgradCdfExpModNormal_vv_1130;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1131> AgradCdfExpModNormal_vv_1131;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1132> AgradCdfExpModNormal_vv_1132;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1133> AgradCdfExpModNormal_vv_1133;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1134> AgradCdfExpModNormal_vv_1134;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1135> AgradCdfExpModNormal_vv_1135;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1136> AgradCdfExpModNormal_vv_1136;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1137> AgradCdfExpModNormal_vv_1137;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1138> AgradCdfExpModNormal_vv_1138;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1139> AgradCdfExpModNormal_vv_1139;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1140> AgradCdfExpModNormal_vv_1140;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1141> AgradCdfExpModNormal_vv_1141;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1142> AgradCdfExpModNormal_vv_1142;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1143> AgradCdfExpModNormal_vv_1143;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1144> AgradCdfExpModNormal_vv_1144;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1145> AgradCdfExpModNormal_vv_1145;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1146> AgradCdfExpModNormal_vv_1146;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1147> AgradCdfExpModNormal_vv_1147;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1148> AgradCdfExpModNormal_vv_1148;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1149> AgradCdfExpModNormal_vv_1149;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1150> AgradCdfExpModNormal_vv_1150;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1151> AgradCdfExpModNormal_vv_1151;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1152> AgradCdfExpModNormal_vv_1152;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1153> AgradCdfExpModNormal_vv_1153;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1154> AgradCdfExpModNormal_vv_1154;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1155> AgradCdfExpModNormal_vv_1155;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1156> AgradCdfExpModNormal_vv_1156;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1157> AgradCdfExpModNormal_vv_1157;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1158> AgradCdfExpModNormal_vv_1158;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1159> AgradCdfExpModNormal_vv_1159;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1160> AgradCdfExpModNormal_vv_1160;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1161> AgradCdfExpModNormal_vv_1161;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1162> AgradCdfExpModNormal_vv_1162;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1163> AgradCdfExpModNormal_vv_1163;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1164> AgradCdfExpModNormal_vv_1164;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1165> AgradCdfExpModNormal_vv_1165;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1166> AgradCdfExpModNormal_vv_1166;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1167> AgradCdfExpModNormal_vv_1167;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1168> AgradCdfExpModNormal_vv_1168;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1169> AgradCdfExpModNormal_vv_1169;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1170> AgradCdfExpModNormal_vv_1170;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1171> AgradCdfExpModNormal_vv_1171;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1172> AgradCdfExpModNormal_vv_1172;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1173> AgradCdfExpModNormal_vv_1173;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1174> AgradCdfExpModNormal_vv_1174;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1175> AgradCdfExpModNormal_vv_1175;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1176> AgradCdfExpModNormal_vv_1176;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1177> AgradCdfExpModNormal_vv_1177;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1178> AgradCdfExpModNormal_vv_1178;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1179> AgradCdfExpModNormal_vv_1179;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1180> AgradCdfExpModNormal_vv_1180;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1181> AgradCdfExpModNormal_vv_1181;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1182> AgradCdfExpModNormal_vv_1182;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1183> AgradCdfExpModNormal_vv_1183;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1184> AgradCdfExpModNormal_vv_1184;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1185> AgradCdfExpModNormal_vv_1185;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1186> AgradCdfExpModNormal_vv_1186;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1187> AgradCdfExpModNormal_vv_1187;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1188> AgradCdfExpModNormal_vv_1188;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1189> AgradCdfExpModNormal_vv_1189;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1190> AgradCdfExpModNormal_vv_1190;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1191> AgradCdfExpModNormal_vv_1191;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1192> AgradCdfExpModNormal_vv_1192;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1193> AgradCdfExpModNormal_vv_1193;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1194> AgradCdfExpModNormal_vv_1194;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1195> AgradCdfExpModNormal_vv_1195;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1196> AgradCdfExpModNormal_vv_1196;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1197> AgradCdfExpModNormal_vv_1197;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1198> AgradCdfExpModNormal_vv_1198;
+typedef std::tuple<AgradCdfExpModNormal, type_vv_1199> AgradCdfExpModNormal_vv_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1100, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1101, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1102, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1103, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1104, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1105, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1106, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1107, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1108, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1109, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1110, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1111, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1112, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1113, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1114, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1115, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1116, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1117, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1118, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1119, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1120, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1121, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1122, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1123, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1124, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1125, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1126, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1127, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1128, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1129, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1130, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1131, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1132, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1133, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1134, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1135, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1136, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1137, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1138, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1139, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1140, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1141, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1142, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1143, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1144, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1145, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1146, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1147, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1148, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1149, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1150, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1151, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1152, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1153, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1154, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1155, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1156, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1157, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1158, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1159, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1160, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1161, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1162, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1163, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1164, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1165, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1166, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1167, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1168, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1169, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1170, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1171, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1172, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1173, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1174, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1175, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1176, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1177, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1178, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1179, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1180, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1181, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1182, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1183, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1184, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1185, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1186, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1187, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1188, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1189, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1190, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1191, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1192, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1193, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1194, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1195, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1196, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1197, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1198, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_vv_1199, AgradCdfTestFixture, AgradCdfExpModNormal_vv_1199);
+
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1200;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1201;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1202;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1203;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1204;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1205;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1206;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1207;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1208;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1209;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1210;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1211;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1212;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1213;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1214;
+
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1200> AgradCdfExpModNormal_ffv_1200;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1201> AgradCdfExpModNormal_ffv_1201;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1202> AgradCdfExpModNormal_ffv_1202;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1203> AgradCdfExpModNormal_ffv_1203;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1204> AgradCdfExpModNormal_ffv_1204;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1205> AgradCdfExpModNormal_ffv_1205;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1206> AgradCdfExpModNormal_ffv_1206;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1207> AgradCdfExpModNormal_ffv_1207;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1208> AgradCdfExpModNormal_ffv_1208;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1209> AgradCdfExpModNormal_ffv_1209;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1210> AgradCdfExpModNormal_ffv_1210;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1211> AgradCdfExpModNormal_ffv_1211;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1212> AgradCdfExpModNormal_ffv_1212;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1213> AgradCdfExpModNormal_ffv_1213;
+typedef std::tuple<AgradCdfExpModNormal, type_ffv_1214> AgradCdfExpModNormal_ffv_1214;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1200, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1201, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1202, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1203, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1204, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1205, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1206, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1207, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1208, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1209, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1210, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1211, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1212, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1213, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExpModNormal_ffv_1214, AgradCdfTestFixture, AgradCdfExpModNormal_ffv_1214);
+
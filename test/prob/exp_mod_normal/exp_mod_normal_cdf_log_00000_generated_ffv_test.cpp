@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<double, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<double, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<double, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<double, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_0> AgradCdfLogExpModNormal_ffv_0;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1> AgradCdfLogExpModNormal_ffv_1;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_2> AgradCdfLogExpModNormal_ffv_2;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_3> AgradCdfLogExpModNormal_ffv_3;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_4> AgradCdfLogExpModNormal_ffv_4;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_5> AgradCdfLogExpModNormal_ffv_5;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_6> AgradCdfLogExpModNormal_ffv_6;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_7> AgradCdfLogExpModNormal_ffv_7;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_8> AgradCdfLogExpModNormal_ffv_8;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_9> AgradCdfLogExpModNormal_ffv_9;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_10> AgradCdfLogExpModNormal_ffv_10;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_11> AgradCdfLogExpModNormal_ffv_11;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_12> AgradCdfLogExpModNormal_ffv_12;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_13> AgradCdfLogExpModNormal_ffv_13;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_14> AgradCdfLogExpModNormal_ffv_14;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_15> AgradCdfLogExpModNormal_ffv_15;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_16> AgradCdfLogExpModNormal_ffv_16;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_17> AgradCdfLogExpModNormal_ffv_17;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_18> AgradCdfLogExpModNormal_ffv_18;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_19> AgradCdfLogExpModNormal_ffv_19;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_20> AgradCdfLogExpModNormal_ffv_20;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_21> AgradCdfLogExpModNormal_ffv_21;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_22> AgradCdfLogExpModNormal_ffv_22;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_23> AgradCdfLogExpModNormal_ffv_23;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_24> AgradCdfLogExpModNormal_ffv_24;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_25> AgradCdfLogExpModNormal_ffv_25;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_26> AgradCdfLogExpModNormal_ffv_26;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_27> AgradCdfLogExpModNormal_ffv_27;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_28> AgradCdfLogExpModNormal_ffv_28;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_29> AgradCdfLogExpModNormal_ffv_29;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_30> AgradCdfLogExpModNormal_ffv_30;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_31> AgradCdfLogExpModNormal_ffv_31;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_32> AgradCdfLogExpModNormal_ffv_32;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_33> AgradCdfLogExpModNormal_ffv_33;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_34> AgradCdfLogExpModNormal_ffv_34;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_35> AgradCdfLogExpModNormal_ffv_35;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_36> AgradCdfLogExpModNormal_ffv_36;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_37> AgradCdfLogExpModNormal_ffv_37;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_38> AgradCdfLogExpModNormal_ffv_38;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_39> AgradCdfLogExpModNormal_ffv_39;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_40> AgradCdfLogExpModNormal_ffv_40;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_41> AgradCdfLogExpModNormal_ffv_41;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_42> AgradCdfLogExpModNormal_ffv_42;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_43> AgradCdfLogExpModNormal_ffv_43;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_44> AgradCdfLogExpModNormal_ffv_44;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_45> AgradCdfLogExpModNormal_ffv_45;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_46> AgradCdfLogExpModNormal_ffv_46;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_47> AgradCdfLogExpModNormal_ffv_47;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_48> AgradCdfLogExpModNormal_ffv_48;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_49> AgradCdfLogExpModNormal_ffv_49;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_50> AgradCdfLogExpModNormal_ffv_50;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_51> AgradCdfLogExpModNormal_ffv_51;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_52> AgradCdfLogExpModNormal_ffv_52;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_53> AgradCdfLogExpModNormal_ffv_53;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_54> AgradCdfLogExpModNormal_ffv_54;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_55> AgradCdfLogExpModNormal_ffv_55;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_56> AgradCdfLogExpModNormal_ffv_56;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_57> AgradCdfLogExpModNormal_ffv_57;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_58> AgradCdfLogExpModNormal_ffv_58;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_59> AgradCdfLogExpModNormal_ffv_59;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_60> AgradCdfLogExpModNormal_ffv_60;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_61> AgradCdfLogExpModNormal_ffv_61;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_62> AgradCdfLogExpModNormal_ffv_62;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_63> AgradCdfLogExpModNormal_ffv_63;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_64> AgradCdfLogExpModNormal_ffv_64;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_65> AgradCdfLogExpModNormal_ffv_65;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_66> AgradCdfLogExpModNormal_ffv_66;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_67> AgradCdfLogExpModNormal_ffv_67;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_68> AgradCdfLogExpModNormal_ffv_68;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_69> AgradCdfLogExpModNormal_ffv_69;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_70> AgradCdfLogExpModNormal_ffv_70;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_71> AgradCdfLogExpModNormal_ffv_71;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_72> AgradCdfLogExpModNormal_ffv_72;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_73> AgradCdfLogExpModNormal_ffv_73;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_74> AgradCdfLogExpModNormal_ffv_74;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_75> AgradCdfLogExpModNormal_ffv_75;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_76> AgradCdfLogExpModNormal_ffv_76;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_77> AgradCdfLogExpModNormal_ffv_77;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_78> AgradCdfLogExpModNormal_ffv_78;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_79> AgradCdfLogExpModNormal_ffv_79;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_80> AgradCdfLogExpModNormal_ffv_80;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_81> AgradCdfLogExpModNormal_ffv_81;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_82> AgradCdfLogExpModNormal_ffv_82;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_83> AgradCdfLogExpModNormal_ffv_83;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_84> AgradCdfLogExpModNormal_ffv_84;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_85> AgradCdfLogExpModNormal_ffv_85;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_86> AgradCdfLogExpModNormal_ffv_86;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_87> AgradCdfLogExpModNormal_ffv_87;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_88> AgradCdfLogExpModNormal_ffv_88;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_89> AgradCdfLogExpModNormal_ffv_89;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_90> AgradCdfLogExpModNormal_ffv_90;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_91> AgradCdfLogExpModNormal_ffv_91;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_92> AgradCdfLogExpModNormal_ffv_92;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_93> AgradCdfLogExpModNormal_ffv_93;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_94> AgradCdfLogExpModNormal_ffv_94;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_95> AgradCdfLogExpModNormal_ffv_95;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_96> AgradCdfLogExpModNormal_ffv_96;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_97> AgradCdfLogExpModNormal_ffv_97;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_98> AgradCdfLogExpModNormal_ffv_98;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_99> AgradCdfLogExpModNormal_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_0, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_2, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_3, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_4, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_5, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_6, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_7, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_8, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_9, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_10, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_11, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_12, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_13, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_14, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_15, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_16, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_17, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_18, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_19, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_20, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_21, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_22, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_23, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_24, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_25, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_26, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_27, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_28, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_29, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_30, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_31, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_32, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_33, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_34, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_35, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_36, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_37, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_38, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_39, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_40, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_41, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_42, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_43, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_44, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_45, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_46, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_47, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_48, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_49, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_50, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_51, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_52, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_53, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_54, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_55, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_56, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_57, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_58, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_59, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_60, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_61, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_62, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_63, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_64, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_65, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_66, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_67, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_68, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_69, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_70, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_71, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_72, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_73, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_74, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_75, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_76, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_77, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_78, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_79, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_80, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_81, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_82, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_83, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_84, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_85, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_86, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_87, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_88, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_89, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_90, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_91, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_92, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_93, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_94, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_95, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_96, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_97, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_98, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_99, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_99);
+
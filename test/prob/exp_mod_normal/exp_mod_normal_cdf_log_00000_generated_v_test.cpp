@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<double, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<double, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<double, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<double, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<double, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<double, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<double, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<double, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_0> AgradCdfLogExpModNormal_v_0;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1> AgradCdfLogExpModNormal_v_1;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_2> AgradCdfLogExpModNormal_v_2;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_3> AgradCdfLogExpModNormal_v_3;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_4> AgradCdfLogExpModNormal_v_4;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_5> AgradCdfLogExpModNormal_v_5;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_6> AgradCdfLogExpModNormal_v_6;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_7> AgradCdfLogExpModNormal_v_7;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_8> AgradCdfLogExpModNormal_v_8;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_9> AgradCdfLogExpModNormal_v_9;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_10> AgradCdfLogExpModNormal_v_10;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_11> AgradCdfLogExpModNormal_v_11;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_12> AgradCdfLogExpModNormal_v_12;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_13> AgradCdfLogExpModNormal_v_13;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_14> AgradCdfLogExpModNormal_v_14;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_15> AgradCdfLogExpModNormal_v_15;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_16> AgradCdfLogExpModNormal_v_16;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_17> AgradCdfLogExpModNormal_v_17;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_18> AgradCdfLogExpModNormal_v_18;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_19> AgradCdfLogExpModNormal_v_19;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_20> AgradCdfLogExpModNormal_v_20;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_21> AgradCdfLogExpModNormal_v_21;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_22> AgradCdfLogExpModNormal_v_22;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_23> AgradCdfLogExpModNormal_v_23;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_24> AgradCdfLogExpModNormal_v_24;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_25> AgradCdfLogExpModNormal_v_25;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_26> AgradCdfLogExpModNormal_v_26;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_27> AgradCdfLogExpModNormal_v_27;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_28> AgradCdfLogExpModNormal_v_28;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_29> AgradCdfLogExpModNormal_v_29;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_30> AgradCdfLogExpModNormal_v_30;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_31> AgradCdfLogExpModNormal_v_31;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_32> AgradCdfLogExpModNormal_v_32;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_33> AgradCdfLogExpModNormal_v_33;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_34> AgradCdfLogExpModNormal_v_34;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_35> AgradCdfLogExpModNormal_v_35;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_36> AgradCdfLogExpModNormal_v_36;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_37> AgradCdfLogExpModNormal_v_37;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_38> AgradCdfLogExpModNormal_v_38;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_39> AgradCdfLogExpModNormal_v_39;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_40> AgradCdfLogExpModNormal_v_40;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_41> AgradCdfLogExpModNormal_v_41;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_42> AgradCdfLogExpModNormal_v_42;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_43> AgradCdfLogExpModNormal_v_43;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_44> AgradCdfLogExpModNormal_v_44;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_45> AgradCdfLogExpModNormal_v_45;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_46> AgradCdfLogExpModNormal_v_46;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_47> AgradCdfLogExpModNormal_v_47;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_48> AgradCdfLogExpModNormal_v_48;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_49> AgradCdfLogExpModNormal_v_49;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_50> AgradCdfLogExpModNormal_v_50;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_51> AgradCdfLogExpModNormal_v_51;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_52> AgradCdfLogExpModNormal_v_52;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_53> AgradCdfLogExpModNormal_v_53;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_54> AgradCdfLogExpModNormal_v_54;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_55> AgradCdfLogExpModNormal_v_55;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_56> AgradCdfLogExpModNormal_v_56;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_57> AgradCdfLogExpModNormal_v_57;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_58> AgradCdfLogExpModNormal_v_58;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_59> AgradCdfLogExpModNormal_v_59;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_60> AgradCdfLogExpModNormal_v_60;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_61> AgradCdfLogExpModNormal_v_61;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_62> AgradCdfLogExpModNormal_v_62;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_63> AgradCdfLogExpModNormal_v_63;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_64> AgradCdfLogExpModNormal_v_64;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_65> AgradCdfLogExpModNormal_v_65;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_66> AgradCdfLogExpModNormal_v_66;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_67> AgradCdfLogExpModNormal_v_67;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_68> AgradCdfLogExpModNormal_v_68;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_69> AgradCdfLogExpModNormal_v_69;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_70> AgradCdfLogExpModNormal_v_70;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_71> AgradCdfLogExpModNormal_v_71;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_72> AgradCdfLogExpModNormal_v_72;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_73> AgradCdfLogExpModNormal_v_73;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_74> AgradCdfLogExpModNormal_v_74;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_75> AgradCdfLogExpModNormal_v_75;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_76> AgradCdfLogExpModNormal_v_76;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_77> AgradCdfLogExpModNormal_v_77;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_78> AgradCdfLogExpModNormal_v_78;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_79> AgradCdfLogExpModNormal_v_79;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_80> AgradCdfLogExpModNormal_v_80;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_81> AgradCdfLogExpModNormal_v_81;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_82> AgradCdfLogExpModNormal_v_82;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_83> AgradCdfLogExpModNormal_v_83;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_84> AgradCdfLogExpModNormal_v_84;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_85> AgradCdfLogExpModNormal_v_85;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_86> AgradCdfLogExpModNormal_v_86;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_87> AgradCdfLogExpModNormal_v_87;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_88> AgradCdfLogExpModNormal_v_88;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_89> AgradCdfLogExpModNormal_v_89;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_90> AgradCdfLogExpModNormal_v_90;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_91> AgradCdfLogExpModNormal_v_91;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_92> AgradCdfLogExpModNormal_v_92;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_93> AgradCdfLogExpModNormal_v_93;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_94> AgradCdfLogExpModNormal_v_94;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_95> AgradCdfLogExpModNormal_v_95;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_96> AgradCdfLogExpModNormal_v_96;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_97> AgradCdfLogExpModNormal_v_97;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_98> AgradCdfLogExpModNormal_v_98;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_99> AgradCdfLogExpModNormal_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_0, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_2, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_3, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_4, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_5, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_6, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_7, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_8, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_9, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_10, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_11, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_12, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_13, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_14, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_15, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_16, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_17, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_18, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_19, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_20, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_21, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_22, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_23, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_24, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_25, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_26, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_27, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_28, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_29, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_30, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_31, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_32, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_33, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_34, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_35, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_36, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_37, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_38, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_39, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_40, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_41, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_42, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_43, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_44, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_45, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_46, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_47, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_48, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_49, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_50, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_51, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_52, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_53, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_54, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_55, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_56, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_57, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_58, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_59, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_60, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_61, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_62, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_63, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_64, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_65, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_66, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_67, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_68, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_69, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_70, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_71, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_72, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_73, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_74, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_75, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_76, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_77, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_78, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_79, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_80, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_81, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_82, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_83, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_84, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_85, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_86, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_87, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_88, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_89, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_90, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_91, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_92, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_93, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_94, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_95, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_96, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_97, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_98, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_99, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_99);
+
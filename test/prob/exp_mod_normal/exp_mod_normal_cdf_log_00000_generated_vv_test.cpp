@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<double, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<double, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<double, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<double, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<double, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<double, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<double, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<double, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<double, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<double, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<double, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<double, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<double, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_0> AgradCdfLogExpModNormal_vv_0;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1> AgradCdfLogExpModNormal_vv_1;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_2> AgradCdfLogExpModNormal_vv_2;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_3> AgradCdfLogExpModNormal_vv_3;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_4> AgradCdfLogExpModNormal_vv_4;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_5> AgradCdfLogExpModNormal_vv_5;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_6> AgradCdfLogExpModNormal_vv_6;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_7> AgradCdfLogExpModNormal_vv_7;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_8> AgradCdfLogExpModNormal_vv_8;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_9> AgradCdfLogExpModNormal_vv_9;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_10> AgradCdfLogExpModNormal_vv_10;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_11> AgradCdfLogExpModNormal_vv_11;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_12> AgradCdfLogExpModNormal_vv_12;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_13> AgradCdfLogExpModNormal_vv_13;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_14> AgradCdfLogExpModNormal_vv_14;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_15> AgradCdfLogExpModNormal_vv_15;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_16> AgradCdfLogExpModNormal_vv_16;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_17> AgradCdfLogExpModNormal_vv_17;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_18> AgradCdfLogExpModNormal_vv_18;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_19> AgradCdfLogExpModNormal_vv_19;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_20> AgradCdfLogExpModNormal_vv_20;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_21> AgradCdfLogExpModNormal_vv_21;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_22> AgradCdfLogExpModNormal_vv_22;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_23> AgradCdfLogExpModNormal_vv_23;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_24> AgradCdfLogExpModNormal_vv_24;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_25> AgradCdfLogExpModNormal_vv_25;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_26> AgradCdfLogExpModNormal_vv_26;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_27> AgradCdfLogExpModNormal_vv_27;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_28> AgradCdfLogExpModNormal_vv_28;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_29> AgradCdfLogExpModNormal_vv_29;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_30> AgradCdfLogExpModNormal_vv_30;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_31> AgradCdfLogExpModNormal_vv_31;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_32> AgradCdfLogExpModNormal_vv_32;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_33> AgradCdfLogExpModNormal_vv_33;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_34> AgradCdfLogExpModNormal_vv_34;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_35> AgradCdfLogExpModNormal_vv_35;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_36> AgradCdfLogExpModNormal_vv_36;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_37> AgradCdfLogExpModNormal_vv_37;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_38> AgradCdfLogExpModNormal_vv_38;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_39> AgradCdfLogExpModNormal_vv_39;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_40> AgradCdfLogExpModNormal_vv_40;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_41> AgradCdfLogExpModNormal_vv_41;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_42> AgradCdfLogExpModNormal_vv_42;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_43> AgradCdfLogExpModNormal_vv_43;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_44> AgradCdfLogExpModNormal_vv_44;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_45> AgradCdfLogExpModNormal_vv_45;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_46> AgradCdfLogExpModNormal_vv_46;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_47> AgradCdfLogExpModNormal_vv_47;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_48> AgradCdfLogExpModNormal_vv_48;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_49> AgradCdfLogExpModNormal_vv_49;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_50> AgradCdfLogExpModNormal_vv_50;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_51> AgradCdfLogExpModNormal_vv_51;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_52> AgradCdfLogExpModNormal_vv_52;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_53> AgradCdfLogExpModNormal_vv_53;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_54> AgradCdfLogExpModNormal_vv_54;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_55> AgradCdfLogExpModNormal_vv_55;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_56> AgradCdfLogExpModNormal_vv_56;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_57> AgradCdfLogExpModNormal_vv_57;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_58> AgradCdfLogExpModNormal_vv_58;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_59> AgradCdfLogExpModNormal_vv_59;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_60> AgradCdfLogExpModNormal_vv_60;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_61> AgradCdfLogExpModNormal_vv_61;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_62> AgradCdfLogExpModNormal_vv_62;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_63> AgradCdfLogExpModNormal_vv_63;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_64> AgradCdfLogExpModNormal_vv_64;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_65> AgradCdfLogExpModNormal_vv_65;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_66> AgradCdfLogExpModNormal_vv_66;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_67> AgradCdfLogExpModNormal_vv_67;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_68> AgradCdfLogExpModNormal_vv_68;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_69> AgradCdfLogExpModNormal_vv_69;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_70> AgradCdfLogExpModNormal_vv_70;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_71> AgradCdfLogExpModNormal_vv_71;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_72> AgradCdfLogExpModNormal_vv_72;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_73> AgradCdfLogExpModNormal_vv_73;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_74> AgradCdfLogExpModNormal_vv_74;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_75> AgradCdfLogExpModNormal_vv_75;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_76> AgradCdfLogExpModNormal_vv_76;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_77> AgradCdfLogExpModNormal_vv_77;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_78> AgradCdfLogExpModNormal_vv_78;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_79> AgradCdfLogExpModNormal_vv_79;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_80> AgradCdfLogExpModNormal_vv_80;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_81> AgradCdfLogExpModNormal_vv_81;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_82> AgradCdfLogExpModNormal_vv_82;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_83> AgradCdfLogExpModNormal_vv_83;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_84> AgradCdfLogExpModNormal_vv_84;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_85> AgradCdfLogExpModNormal_vv_85;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_86> AgradCdfLogExpModNormal_vv_86;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_87> AgradCdfLogExpModNormal_vv_87;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_88> AgradCdfLogExpModNormal_vv_88;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_89> AgradCdfLogExpModNormal_vv_89;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_90> AgradCdfLogExpModNormal_vv_90;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_91> AgradCdfLogExpModNormal_vv_91;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_92> AgradCdfLogExpModNormal_vv_92;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_93> AgradCdfLogExpModNormal_vv_93;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_94> AgradCdfLogExpModNormal_vv_94;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_95> AgradCdfLogExpModNormal_vv_95;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_96> AgradCdfLogExpModNormal_vv_96;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_97> AgradCdfLogExpModNormal_vv_97;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_98> AgradCdfLogExpModNormal_vv_98;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_99> AgradCdfLogExpModNormal_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_0, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_2, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_3, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_4, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_5, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_6, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_7, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_8, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_9, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_10, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_11, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_12, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_13, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_14, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_15, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_16, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_17, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_18, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_19, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_20, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_21, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_22, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_23, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_24, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_25, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_26, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_27, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_28, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_29, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_30, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_31, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_32, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_33, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_34, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_35, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_36, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_37, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_38, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_39, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_40, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_41, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_42, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_43, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_44, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_45, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_46, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_47, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_48, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_49, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_50, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_51, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_52, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_53, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_54, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_55, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_56, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_57, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_58, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_59, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_60, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_61, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_62, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_63, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_64, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_65, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_66, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_67, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_68, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_69, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_70, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_71, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_72, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_73, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_74, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_75, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_76, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_77, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_78, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_79, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_80, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_81, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_82, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_83, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_84, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_85, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_86, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_87, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_88, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_89, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_90, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_91, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_92, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_93, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_94, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_95, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_96, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_97, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_98, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_99, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_99);
+
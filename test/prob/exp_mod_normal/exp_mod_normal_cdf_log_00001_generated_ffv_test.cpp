@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<double>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_100> AgradCdfLogExpModNormal_ffv_100;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_101> AgradCdfLogExpModNormal_ffv_101;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_102> AgradCdfLogExpModNormal_ffv_102;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_103> AgradCdfLogExpModNormal_ffv_103;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_104> AgradCdfLogExpModNormal_ffv_104;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_105> AgradCdfLogExpModNormal_ffv_105;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_106> AgradCdfLogExpModNormal_ffv_106;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_107> AgradCdfLogExpModNormal_ffv_107;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_108> AgradCdfLogExpModNormal_ffv_108;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_109> AgradCdfLogExpModNormal_ffv_109;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_110> AgradCdfLogExpModNormal_ffv_110;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_111> AgradCdfLogExpModNormal_ffv_111;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_112> AgradCdfLogExpModNormal_ffv_112;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_113> AgradCdfLogExpModNormal_ffv_113;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_114> AgradCdfLogExpModNormal_ffv_114;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_115> AgradCdfLogExpModNormal_ffv_115;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_116> AgradCdfLogExpModNormal_ffv_116;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_117> AgradCdfLogExpModNormal_ffv_117;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_118> AgradCdfLogExpModNormal_ffv_118;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_119> AgradCdfLogExpModNormal_ffv_119;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_120> AgradCdfLogExpModNormal_ffv_120;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_121> AgradCdfLogExpModNormal_ffv_121;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_122> AgradCdfLogExpModNormal_ffv_122;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_123> AgradCdfLogExpModNormal_ffv_123;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_124> AgradCdfLogExpModNormal_ffv_124;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_125> AgradCdfLogExpModNormal_ffv_125;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_126> AgradCdfLogExpModNormal_ffv_126;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_127> AgradCdfLogExpModNormal_ffv_127;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_128> AgradCdfLogExpModNormal_ffv_128;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_129> AgradCdfLogExpModNormal_ffv_129;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_130> AgradCdfLogExpModNormal_ffv_130;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_131> AgradCdfLogExpModNormal_ffv_131;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_132> AgradCdfLogExpModNormal_ffv_132;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_133> AgradCdfLogExpModNormal_ffv_133;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_134> AgradCdfLogExpModNormal_ffv_134;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_135> AgradCdfLogExpModNormal_ffv_135;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_136> AgradCdfLogExpModNormal_ffv_136;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_137> AgradCdfLogExpModNormal_ffv_137;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_138> AgradCdfLogExpModNormal_ffv_138;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_139> AgradCdfLogExpModNormal_ffv_139;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_140> AgradCdfLogExpModNormal_ffv_140;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_141> AgradCdfLogExpModNormal_ffv_141;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_142> AgradCdfLogExpModNormal_ffv_142;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_143> AgradCdfLogExpModNormal_ffv_143;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_144> AgradCdfLogExpModNormal_ffv_144;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_145> AgradCdfLogExpModNormal_ffv_145;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_146> AgradCdfLogExpModNormal_ffv_146;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_147> AgradCdfLogExpModNormal_ffv_147;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_148> AgradCdfLogExpModNormal_ffv_148;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_149> AgradCdfLogExpModNormal_ffv_149;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_150> AgradCdfLogExpModNormal_ffv_150;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_151> AgradCdfLogExpModNormal_ffv_151;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_152> AgradCdfLogExpModNormal_ffv_152;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_153> AgradCdfLogExpModNormal_ffv_153;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_154> AgradCdfLogExpModNormal_ffv_154;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_155> AgradCdfLogExpModNormal_ffv_155;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_156> AgradCdfLogExpModNormal_ffv_156;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_157> AgradCdfLogExpModNormal_ffv_157;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_158> AgradCdfLogExpModNormal_ffv_158;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_159> AgradCdfLogExpModNormal_ffv_159;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_160> AgradCdfLogExpModNormal_ffv_160;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_161> AgradCdfLogExpModNormal_ffv_161;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_162> AgradCdfLogExpModNormal_ffv_162;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_163> AgradCdfLogExpModNormal_ffv_163;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_164> AgradCdfLogExpModNormal_ffv_164;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_165> AgradCdfLogExpModNormal_ffv_165;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_166> AgradCdfLogExpModNormal_ffv_166;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_167> AgradCdfLogExpModNormal_ffv_167;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_168> AgradCdfLogExpModNormal_ffv_168;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_169> AgradCdfLogExpModNormal_ffv_169;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_170> AgradCdfLogExpModNormal_ffv_170;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_171> AgradCdfLogExpModNormal_ffv_171;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_172> AgradCdfLogExpModNormal_ffv_172;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_173> AgradCdfLogExpModNormal_ffv_173;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_174> AgradCdfLogExpModNormal_ffv_174;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_175> AgradCdfLogExpModNormal_ffv_175;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_176> AgradCdfLogExpModNormal_ffv_176;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_177> AgradCdfLogExpModNormal_ffv_177;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_178> AgradCdfLogExpModNormal_ffv_178;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_179> AgradCdfLogExpModNormal_ffv_179;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_180> AgradCdfLogExpModNormal_ffv_180;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_181> AgradCdfLogExpModNormal_ffv_181;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_182> AgradCdfLogExpModNormal_ffv_182;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_183> AgradCdfLogExpModNormal_ffv_183;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_184> AgradCdfLogExpModNormal_ffv_184;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_185> AgradCdfLogExpModNormal_ffv_185;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_186> AgradCdfLogExpModNormal_ffv_186;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_187> AgradCdfLogExpModNormal_ffv_187;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_188> AgradCdfLogExpModNormal_ffv_188;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_189> AgradCdfLogExpModNormal_ffv_189;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_190> AgradCdfLogExpModNormal_ffv_190;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_191> AgradCdfLogExpModNormal_ffv_191;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_192> AgradCdfLogExpModNormal_ffv_192;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_193> AgradCdfLogExpModNormal_ffv_193;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_194> AgradCdfLogExpModNormal_ffv_194;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_195> AgradCdfLogExpModNormal_ffv_195;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_196> AgradCdfLogExpModNormal_ffv_196;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_197> AgradCdfLogExpModNormal_ffv_197;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_198> AgradCdfLogExpModNormal_ffv_198;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_199> AgradCdfLogExpModNormal_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_100, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_101, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_102, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_103, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_104, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_105, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_106, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_107, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_108, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_109, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_110, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_111, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_112, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_113, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_114, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_115, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_116, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_117, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_118, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_119, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_120, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_121, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_122, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_123, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_124, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_125, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_126, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_127, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_128, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_129, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_130, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_131, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_132, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_133, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_134, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_135, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_136, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_137, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_138, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_139, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_140, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_141, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_142, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_143, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_144, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_145, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_146, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_147, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_148, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_149, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_150, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_151, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_152, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_153, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_154, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_155, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_156, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_157, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_158, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_159, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_160, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_161, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_162, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_163, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_164, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_165, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_166, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_167, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_168, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_169, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_170, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_171, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_172, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_173, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_174, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_175, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_176, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_177, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_178, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_179, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_180, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_181, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_182, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_183, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_184, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_185, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_186, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_187, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_188, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_189, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_190, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_191, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_192, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_193, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_194, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_195, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_196, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_197, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_198, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_199, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_199);
+
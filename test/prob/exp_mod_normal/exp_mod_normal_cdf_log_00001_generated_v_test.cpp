@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<double, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<double, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<double, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<double, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_100> AgradCdfLogExpModNormal_v_100;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_101> AgradCdfLogExpModNormal_v_101;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_102> AgradCdfLogExpModNormal_v_102;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_103> AgradCdfLogExpModNormal_v_103;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_104> AgradCdfLogExpModNormal_v_104;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_105> AgradCdfLogExpModNormal_v_105;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_106> AgradCdfLogExpModNormal_v_106;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_107> AgradCdfLogExpModNormal_v_107;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_108> AgradCdfLogExpModNormal_v_108;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_109> AgradCdfLogExpModNormal_v_109;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_110> AgradCdfLogExpModNormal_v_110;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_111> AgradCdfLogExpModNormal_v_111;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_112> AgradCdfLogExpModNormal_v_112;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_113> AgradCdfLogExpModNormal_v_113;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_114> AgradCdfLogExpModNormal_v_114;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_115> AgradCdfLogExpModNormal_v_115;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_116> AgradCdfLogExpModNormal_v_116;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_117> AgradCdfLogExpModNormal_v_117;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_118> AgradCdfLogExpModNormal_v_118;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_119> AgradCdfLogExpModNormal_v_119;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_120> AgradCdfLogExpModNormal_v_120;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_121> AgradCdfLogExpModNormal_v_121;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_122> AgradCdfLogExpModNormal_v_122;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_123> AgradCdfLogExpModNormal_v_123;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_124> AgradCdfLogExpModNormal_v_124;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_125> AgradCdfLogExpModNormal_v_125;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_126> AgradCdfLogExpModNormal_v_126;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_127> AgradCdfLogExpModNormal_v_127;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_128> AgradCdfLogExpModNormal_v_128;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_129> AgradCdfLogExpModNormal_v_129;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_130> AgradCdfLogExpModNormal_v_130;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_131> AgradCdfLogExpModNormal_v_131;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_132> AgradCdfLogExpModNormal_v_132;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_133> AgradCdfLogExpModNormal_v_133;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_134> AgradCdfLogExpModNormal_v_134;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_135> AgradCdfLogExpModNormal_v_135;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_136> AgradCdfLogExpModNormal_v_136;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_137> AgradCdfLogExpModNormal_v_137;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_138> AgradCdfLogExpModNormal_v_138;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_139> AgradCdfLogExpModNormal_v_139;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_140> AgradCdfLogExpModNormal_v_140;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_141> AgradCdfLogExpModNormal_v_141;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_142> AgradCdfLogExpModNormal_v_142;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_143> AgradCdfLogExpModNormal_v_143;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_144> AgradCdfLogExpModNormal_v_144;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_145> AgradCdfLogExpModNormal_v_145;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_146> AgradCdfLogExpModNormal_v_146;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_147> AgradCdfLogExpModNormal_v_147;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_148> AgradCdfLogExpModNormal_v_148;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_149> AgradCdfLogExpModNormal_v_149;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_150> AgradCdfLogExpModNormal_v_150;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_151> AgradCdfLogExpModNormal_v_151;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_152> AgradCdfLogExpModNormal_v_152;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_153> AgradCdfLogExpModNormal_v_153;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_154> AgradCdfLogExpModNormal_v_154;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_155> AgradCdfLogExpModNormal_v_155;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_156> AgradCdfLogExpModNormal_v_156;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_157> AgradCdfLogExpModNormal_v_157;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_158> AgradCdfLogExpModNormal_v_158;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_159> AgradCdfLogExpModNormal_v_159;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_160> AgradCdfLogExpModNormal_v_160;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_161> AgradCdfLogExpModNormal_v_161;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_162> AgradCdfLogExpModNormal_v_162;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_163> AgradCdfLogExpModNormal_v_163;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_164> AgradCdfLogExpModNormal_v_164;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_165> AgradCdfLogExpModNormal_v_165;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_166> AgradCdfLogExpModNormal_v_166;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_167> AgradCdfLogExpModNormal_v_167;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_168> AgradCdfLogExpModNormal_v_168;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_169> AgradCdfLogExpModNormal_v_169;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_170> AgradCdfLogExpModNormal_v_170;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_171> AgradCdfLogExpModNormal_v_171;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_172> AgradCdfLogExpModNormal_v_172;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_173> AgradCdfLogExpModNormal_v_173;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_174> AgradCdfLogExpModNormal_v_174;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_175> AgradCdfLogExpModNormal_v_175;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_176> AgradCdfLogExpModNormal_v_176;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_177> AgradCdfLogExpModNormal_v_177;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_178> AgradCdfLogExpModNormal_v_178;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_179> AgradCdfLogExpModNormal_v_179;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_180> AgradCdfLogExpModNormal_v_180;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_181> AgradCdfLogExpModNormal_v_181;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_182> AgradCdfLogExpModNormal_v_182;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_183> AgradCdfLogExpModNormal_v_183;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_184> AgradCdfLogExpModNormal_v_184;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_185> AgradCdfLogExpModNormal_v_185;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_186> AgradCdfLogExpModNormal_v_186;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_187> AgradCdfLogExpModNormal_v_187;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_188> AgradCdfLogExpModNormal_v_188;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_189> AgradCdfLogExpModNormal_v_189;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_190> AgradCdfLogExpModNormal_v_190;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_191> AgradCdfLogExpModNormal_v_191;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_192> AgradCdfLogExpModNormal_v_192;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_193> AgradCdfLogExpModNormal_v_193;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_194> AgradCdfLogExpModNormal_v_194;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_195> AgradCdfLogExpModNormal_v_195;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_196> AgradCdfLogExpModNormal_v_196;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_197> AgradCdfLogExpModNormal_v_197;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_198> AgradCdfLogExpModNormal_v_198;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_199> AgradCdfLogExpModNormal_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_100, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_101, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_102, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_103, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_104, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_105, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_106, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_107, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_108, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_109, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_110, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_111, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_112, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_113, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_114, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_115, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_116, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_117, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_118, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_119, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_120, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_121, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_122, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_123, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_124, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_125, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_126, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_127, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_128, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_129, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_130, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_131, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_132, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_133, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_134, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_135, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_136, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_137, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_138, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_139, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_140, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_141, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_142, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_143, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_144, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_145, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_146, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_147, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_148, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_149, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_150, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_151, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_152, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_153, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_154, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_155, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_156, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_157, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_158, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_159, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_160, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_161, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_162, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_163, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_164, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_165, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_166, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_167, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_168, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_169, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_170, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_171, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_172, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_173, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_174, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_175, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_176, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_177, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_178, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_179, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_180, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_181, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_182, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_183, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_184, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_185, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_186, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_187, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_188, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_189, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_190, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_191, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_192, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_193, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_194, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_195, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_196, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_197, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_198, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_199, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_199);
+
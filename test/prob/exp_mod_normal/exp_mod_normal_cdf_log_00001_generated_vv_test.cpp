@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<double, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<double, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<double, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<double, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<double, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<double>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_100> AgradCdfLogExpModNormal_vv_100;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_101> AgradCdfLogExpModNormal_vv_101;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_102> AgradCdfLogExpModNormal_vv_102;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_103> AgradCdfLogExpModNormal_vv_103;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_104> AgradCdfLogExpModNormal_vv_104;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_105> AgradCdfLogExpModNormal_vv_105;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_106> AgradCdfLogExpModNormal_vv_106;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_107> AgradCdfLogExpModNormal_vv_107;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_108> AgradCdfLogExpModNormal_vv_108;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_109> AgradCdfLogExpModNormal_vv_109;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_110> AgradCdfLogExpModNormal_vv_110;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_111> AgradCdfLogExpModNormal_vv_111;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_112> AgradCdfLogExpModNormal_vv_112;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_113> AgradCdfLogExpModNormal_vv_113;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_114> AgradCdfLogExpModNormal_vv_114;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_115> AgradCdfLogExpModNormal_vv_115;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_116> AgradCdfLogExpModNormal_vv_116;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_117> AgradCdfLogExpModNormal_vv_117;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_118> AgradCdfLogExpModNormal_vv_118;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_119> AgradCdfLogExpModNormal_vv_119;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_120> AgradCdfLogExpModNormal_vv_120;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_121> AgradCdfLogExpModNormal_vv_121;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_122> AgradCdfLogExpModNormal_vv_122;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_123> AgradCdfLogExpModNormal_vv_123;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_124> AgradCdfLogExpModNormal_vv_124;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_125> AgradCdfLogExpModNormal_vv_125;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_126> AgradCdfLogExpModNormal_vv_126;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_127> AgradCdfLogExpModNormal_vv_127;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_128> AgradCdfLogExpModNormal_vv_128;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_129> AgradCdfLogExpModNormal_vv_129;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_130> AgradCdfLogExpModNormal_vv_130;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_131> AgradCdfLogExpModNormal_vv_131;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_132> AgradCdfLogExpModNormal_vv_132;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_133> AgradCdfLogExpModNormal_vv_133;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_134> AgradCdfLogExpModNormal_vv_134;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_135> AgradCdfLogExpModNormal_vv_135;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_136> AgradCdfLogExpModNormal_vv_136;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_137> AgradCdfLogExpModNormal_vv_137;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_138> AgradCdfLogExpModNormal_vv_138;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_139> AgradCdfLogExpModNormal_vv_139;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_140> AgradCdfLogExpModNormal_vv_140;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_141> AgradCdfLogExpModNormal_vv_141;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_142> AgradCdfLogExpModNormal_vv_142;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_143> AgradCdfLogExpModNormal_vv_143;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_144> AgradCdfLogExpModNormal_vv_144;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_145> AgradCdfLogExpModNormal_vv_145;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_146> AgradCdfLogExpModNormal_vv_146;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_147> AgradCdfLogExpModNormal_vv_147;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_148> AgradCdfLogExpModNormal_vv_148;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_149> AgradCdfLogExpModNormal_vv_149;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_150> AgradCdfLogExpModNormal_vv_150;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_151> AgradCdfLogExpModNormal_vv_151;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_152> AgradCdfLogExpModNormal_vv_152;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_153> AgradCdfLogExpModNormal_vv_153;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_154> AgradCdfLogExpModNormal_vv_154;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_155> AgradCdfLogExpModNormal_vv_155;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_156> AgradCdfLogExpModNormal_vv_156;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_157> AgradCdfLogExpModNormal_vv_157;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_158> AgradCdfLogExpModNormal_vv_158;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_159> AgradCdfLogExpModNormal_vv_159;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_160> AgradCdfLogExpModNormal_vv_160;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_161> AgradCdfLogExpModNormal_vv_161;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_162> AgradCdfLogExpModNormal_vv_162;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_163> AgradCdfLogExpModNormal_vv_163;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_164> AgradCdfLogExpModNormal_vv_164;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_165> AgradCdfLogExpModNormal_vv_165;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_166> AgradCdfLogExpModNormal_vv_166;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_167> AgradCdfLogExpModNormal_vv_167;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_168> AgradCdfLogExpModNormal_vv_168;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_169> AgradCdfLogExpModNormal_vv_169;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_170> AgradCdfLogExpModNormal_vv_170;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_171> AgradCdfLogExpModNormal_vv_171;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_172> AgradCdfLogExpModNormal_vv_172;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_173> AgradCdfLogExpModNormal_vv_173;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_174> AgradCdfLogExpModNormal_vv_174;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_175> AgradCdfLogExpModNormal_vv_175;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_176> AgradCdfLogExpModNormal_vv_176;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_177> AgradCdfLogExpModNormal_vv_177;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_178> AgradCdfLogExpModNormal_vv_178;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_179> AgradCdfLogExpModNormal_vv_179;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_180> AgradCdfLogExpModNormal_vv_180;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_181> AgradCdfLogExpModNormal_vv_181;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_182> AgradCdfLogExpModNormal_vv_182;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_183> AgradCdfLogExpModNormal_vv_183;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_184> AgradCdfLogExpModNormal_vv_184;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_185> AgradCdfLogExpModNormal_vv_185;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_186> AgradCdfLogExpModNormal_vv_186;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_187> AgradCdfLogExpModNormal_vv_187;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_188> AgradCdfLogExpModNormal_vv_188;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_189> AgradCdfLogExpModNormal_vv_189;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_190> AgradCdfLogExpModNormal_vv_190;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_191> AgradCdfLogExpModNormal_vv_191;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_192> AgradCdfLogExpModNormal_vv_192;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_193> AgradCdfLogExpModNormal_vv_193;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_194> AgradCdfLogExpModNormal_vv_194;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_195> AgradCdfLogExpModNormal_vv_195;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_196> AgradCdfLogExpModNormal_vv_196;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_197> AgradCdfLogExpModNormal_vv_197;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_198> AgradCdfLogExpModNormal_vv_198;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_199> AgradCdfLogExpModNormal_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_100, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_101, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_102, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_103, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_104, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_105, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_106, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_107, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_108, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_109, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_110, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_111, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_112, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_113, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_114, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_115, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_116, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_117, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_118, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_119, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_120, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_121, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_122, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_123, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_124, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_125, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_126, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_127, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_128, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_129, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_130, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_131, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_132, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_133, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_134, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_135, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_136, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_137, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_138, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_139, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_140, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_141, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_142, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_143, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_144, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_145, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_146, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_147, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_148, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_149, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_150, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_151, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_152, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_153, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_154, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_155, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_156, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_157, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_158, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_159, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_160, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_161, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_162, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_163, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_164, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_165, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_166, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_167, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_168, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_169, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_170, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_171, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_172, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_173, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_174, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_175, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_176, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_177, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_178, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_179, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_180, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_181, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_182, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_183, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_184, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_185, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_186, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_187, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_188, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_189, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_190, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_191, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_192, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_193, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_194, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_195, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_196, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_197, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_198, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_199, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_199);
+
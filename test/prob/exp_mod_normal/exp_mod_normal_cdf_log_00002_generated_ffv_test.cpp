@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_200> AgradCdfLogExpModNormal_ffv_200;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_201> AgradCdfLogExpModNormal_ffv_201;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_202> AgradCdfLogExpModNormal_ffv_202;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_203> AgradCdfLogExpModNormal_ffv_203;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_204> AgradCdfLogExpModNormal_ffv_204;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_205> AgradCdfLogExpModNormal_ffv_205;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_206> AgradCdfLogExpModNormal_ffv_206;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_207> AgradCdfLogExpModNormal_ffv_207;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_208> AgradCdfLogExpModNormal_ffv_208;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_209> AgradCdfLogExpModNormal_ffv_209;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_210> AgradCdfLogExpModNormal_ffv_210;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_211> AgradCdfLogExpModNormal_ffv_211;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_212> AgradCdfLogExpModNormal_ffv_212;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_213> AgradCdfLogExpModNormal_ffv_213;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_214> AgradCdfLogExpModNormal_ffv_214;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_215> AgradCdfLogExpModNormal_ffv_215;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_216> AgradCdfLogExpModNormal_ffv_216;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_217> AgradCdfLogExpModNormal_ffv_217;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_218> AgradCdfLogExpModNormal_ffv_218;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_219> AgradCdfLogExpModNormal_ffv_219;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_220> AgradCdfLogExpModNormal_ffv_220;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_221> AgradCdfLogExpModNormal_ffv_221;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_222> AgradCdfLogExpModNormal_ffv_222;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_223> AgradCdfLogExpModNormal_ffv_223;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_224> AgradCdfLogExpModNormal_ffv_224;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_225> AgradCdfLogExpModNormal_ffv_225;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_226> AgradCdfLogExpModNormal_ffv_226;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_227> AgradCdfLogExpModNormal_ffv_227;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_228> AgradCdfLogExpModNormal_ffv_228;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_229> AgradCdfLogExpModNormal_ffv_229;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_230> AgradCdfLogExpModNormal_ffv_230;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_231> AgradCdfLogExpModNormal_ffv_231;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_232> AgradCdfLogExpModNormal_ffv_232;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_233> AgradCdfLogExpModNormal_ffv_233;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_234> AgradCdfLogExpModNormal_ffv_234;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_235> AgradCdfLogExpModNormal_ffv_235;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_236> AgradCdfLogExpModNormal_ffv_236;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_237> AgradCdfLogExpModNormal_ffv_237;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_238> AgradCdfLogExpModNormal_ffv_238;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_239> AgradCdfLogExpModNormal_ffv_239;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_240> AgradCdfLogExpModNormal_ffv_240;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_241> AgradCdfLogExpModNormal_ffv_241;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_242> AgradCdfLogExpModNormal_ffv_242;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_243> AgradCdfLogExpModNormal_ffv_243;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_244> AgradCdfLogExpModNormal_ffv_244;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_245> AgradCdfLogExpModNormal_ffv_245;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_246> AgradCdfLogExpModNormal_ffv_246;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_247> AgradCdfLogExpModNormal_ffv_247;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_248> AgradCdfLogExpModNormal_ffv_248;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_249> AgradCdfLogExpModNormal_ffv_249;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_250> AgradCdfLogExpModNormal_ffv_250;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_251> AgradCdfLogExpModNormal_ffv_251;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_252> AgradCdfLogExpModNormal_ffv_252;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_253> AgradCdfLogExpModNormal_ffv_253;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_254> AgradCdfLogExpModNormal_ffv_254;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_255> AgradCdfLogExpModNormal_ffv_255;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_256> AgradCdfLogExpModNormal_ffv_256;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_257> AgradCdfLogExpModNormal_ffv_257;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_258> AgradCdfLogExpModNormal_ffv_258;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_259> AgradCdfLogExpModNormal_ffv_259;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_260> AgradCdfLogExpModNormal_ffv_260;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_261> AgradCdfLogExpModNormal_ffv_261;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_262> AgradCdfLogExpModNormal_ffv_262;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_263> AgradCdfLogExpModNormal_ffv_263;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_264> AgradCdfLogExpModNormal_ffv_264;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_265> AgradCdfLogExpModNormal_ffv_265;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_266> AgradCdfLogExpModNormal_ffv_266;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_267> AgradCdfLogExpModNormal_ffv_267;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_268> AgradCdfLogExpModNormal_ffv_268;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_269> AgradCdfLogExpModNormal_ffv_269;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_270> AgradCdfLogExpModNormal_ffv_270;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_271> AgradCdfLogExpModNormal_ffv_271;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_272> AgradCdfLogExpModNormal_ffv_272;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_273> AgradCdfLogExpModNormal_ffv_273;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_274> AgradCdfLogExpModNormal_ffv_274;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_275> AgradCdfLogExpModNormal_ffv_275;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_276> AgradCdfLogExpModNormal_ffv_276;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_277> AgradCdfLogExpModNormal_ffv_277;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_278> AgradCdfLogExpModNormal_ffv_278;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_279> AgradCdfLogExpModNormal_ffv_279;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_280> AgradCdfLogExpModNormal_ffv_280;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_281> AgradCdfLogExpModNormal_ffv_281;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_282> AgradCdfLogExpModNormal_ffv_282;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_283> AgradCdfLogExpModNormal_ffv_283;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_284> AgradCdfLogExpModNormal_ffv_284;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_285> AgradCdfLogExpModNormal_ffv_285;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_286> AgradCdfLogExpModNormal_ffv_286;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_287> AgradCdfLogExpModNormal_ffv_287;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_288> AgradCdfLogExpModNormal_ffv_288;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_289> AgradCdfLogExpModNormal_ffv_289;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_290> AgradCdfLogExpModNormal_ffv_290;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_291> AgradCdfLogExpModNormal_ffv_291;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_292> AgradCdfLogExpModNormal_ffv_292;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_293> AgradCdfLogExpModNormal_ffv_293;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_294> AgradCdfLogExpModNormal_ffv_294;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_295> AgradCdfLogExpModNormal_ffv_295;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_296> AgradCdfLogExpModNormal_ffv_296;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_297> AgradCdfLogExpModNormal_ffv_297;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_298> AgradCdfLogExpModNormal_ffv_298;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_299> AgradCdfLogExpModNormal_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_200, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_201, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_202, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_203, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_204, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_205, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_206, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_207, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_208, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_209, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_210, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_211, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_212, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_213, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_214, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_215, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_216, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_217, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_218, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_219, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_220, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_221, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_222, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_223, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_224, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_225, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_226, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_227, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_228, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_229, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_230, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_231, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_232, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_233, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_234, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_235, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_236, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_237, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_238, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_239, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_240, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_241, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_242, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_243, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_244, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_245, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_246, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_247, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_248, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_249, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_250, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_251, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_252, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_253, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_254, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_255, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_256, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_257, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_258, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_259, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_260, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_261, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_262, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_263, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_264, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_265, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_266, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_267, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_268, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_269, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_270, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_271, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_272, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_273, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_274, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_275, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_276, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_277, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_278, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_279, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_280, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_281, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_282, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_283, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_284, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_285, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_286, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_287, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_288, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_289, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_290, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_291, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_292, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_293, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_294, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_295, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_296, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_297, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_298, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_299, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_299);
+
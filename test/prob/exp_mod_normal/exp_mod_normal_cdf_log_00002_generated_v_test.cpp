@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<double>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<double>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_200> AgradCdfLogExpModNormal_v_200;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_201> AgradCdfLogExpModNormal_v_201;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_202> AgradCdfLogExpModNormal_v_202;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_203> AgradCdfLogExpModNormal_v_203;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_204> AgradCdfLogExpModNormal_v_204;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_205> AgradCdfLogExpModNormal_v_205;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_206> AgradCdfLogExpModNormal_v_206;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_207> AgradCdfLogExpModNormal_v_207;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_208> AgradCdfLogExpModNormal_v_208;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_209> AgradCdfLogExpModNormal_v_209;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_210> AgradCdfLogExpModNormal_v_210;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_211> AgradCdfLogExpModNormal_v_211;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_212> AgradCdfLogExpModNormal_v_212;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_213> AgradCdfLogExpModNormal_v_213;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_214> AgradCdfLogExpModNormal_v_214;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_215> AgradCdfLogExpModNormal_v_215;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_216> AgradCdfLogExpModNormal_v_216;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_217> AgradCdfLogExpModNormal_v_217;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_218> AgradCdfLogExpModNormal_v_218;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_219> AgradCdfLogExpModNormal_v_219;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_220> AgradCdfLogExpModNormal_v_220;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_221> AgradCdfLogExpModNormal_v_221;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_222> AgradCdfLogExpModNormal_v_222;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_223> AgradCdfLogExpModNormal_v_223;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_224> AgradCdfLogExpModNormal_v_224;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_225> AgradCdfLogExpModNormal_v_225;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_226> AgradCdfLogExpModNormal_v_226;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_227> AgradCdfLogExpModNormal_v_227;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_228> AgradCdfLogExpModNormal_v_228;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_229> AgradCdfLogExpModNormal_v_229;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_230> AgradCdfLogExpModNormal_v_230;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_231> AgradCdfLogExpModNormal_v_231;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_232> AgradCdfLogExpModNormal_v_232;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_233> AgradCdfLogExpModNormal_v_233;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_234> AgradCdfLogExpModNormal_v_234;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_235> AgradCdfLogExpModNormal_v_235;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_236> AgradCdfLogExpModNormal_v_236;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_237> AgradCdfLogExpModNormal_v_237;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_238> AgradCdfLogExpModNormal_v_238;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_239> AgradCdfLogExpModNormal_v_239;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_240> AgradCdfLogExpModNormal_v_240;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_241> AgradCdfLogExpModNormal_v_241;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_242> AgradCdfLogExpModNormal_v_242;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_243> AgradCdfLogExpModNormal_v_243;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_244> AgradCdfLogExpModNormal_v_244;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_245> AgradCdfLogExpModNormal_v_245;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_246> AgradCdfLogExpModNormal_v_246;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_247> AgradCdfLogExpModNormal_v_247;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_248> AgradCdfLogExpModNormal_v_248;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_249> AgradCdfLogExpModNormal_v_249;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_250> AgradCdfLogExpModNormal_v_250;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_251> AgradCdfLogExpModNormal_v_251;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_252> AgradCdfLogExpModNormal_v_252;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_253> AgradCdfLogExpModNormal_v_253;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_254> AgradCdfLogExpModNormal_v_254;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_255> AgradCdfLogExpModNormal_v_255;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_256> AgradCdfLogExpModNormal_v_256;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_257> AgradCdfLogExpModNormal_v_257;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_258> AgradCdfLogExpModNormal_v_258;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_259> AgradCdfLogExpModNormal_v_259;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_260> AgradCdfLogExpModNormal_v_260;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_261> AgradCdfLogExpModNormal_v_261;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_262> AgradCdfLogExpModNormal_v_262;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_263> AgradCdfLogExpModNormal_v_263;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_264> AgradCdfLogExpModNormal_v_264;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_265> AgradCdfLogExpModNormal_v_265;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_266> AgradCdfLogExpModNormal_v_266;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_267> AgradCdfLogExpModNormal_v_267;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_268> AgradCdfLogExpModNormal_v_268;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_269> AgradCdfLogExpModNormal_v_269;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_270> AgradCdfLogExpModNormal_v_270;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_271> AgradCdfLogExpModNormal_v_271;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_272> AgradCdfLogExpModNormal_v_272;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_273> AgradCdfLogExpModNormal_v_273;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_274> AgradCdfLogExpModNormal_v_274;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_275> AgradCdfLogExpModNormal_v_275;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_276> AgradCdfLogExpModNormal_v_276;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_277> AgradCdfLogExpModNormal_v_277;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_278> AgradCdfLogExpModNormal_v_278;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_279> AgradCdfLogExpModNormal_v_279;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_280> AgradCdfLogExpModNormal_v_280;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_281> AgradCdfLogExpModNormal_v_281;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_282> AgradCdfLogExpModNormal_v_282;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_283> AgradCdfLogExpModNormal_v_283;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_284> AgradCdfLogExpModNormal_v_284;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_285> AgradCdfLogExpModNormal_v_285;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_286> AgradCdfLogExpModNormal_v_286;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_287> AgradCdfLogExpModNormal_v_287;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_288> AgradCdfLogExpModNormal_v_288;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_289> AgradCdfLogExpModNormal_v_289;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_290> AgradCdfLogExpModNormal_v_290;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_291> AgradCdfLogExpModNormal_v_291;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_292> AgradCdfLogExpModNormal_v_292;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_293> AgradCdfLogExpModNormal_v_293;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_294> AgradCdfLogExpModNormal_v_294;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_295> AgradCdfLogExpModNormal_v_295;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_296> AgradCdfLogExpModNormal_v_296;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_297> AgradCdfLogExpModNormal_v_297;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_298> AgradCdfLogExpModNormal_v_298;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_299> AgradCdfLogExpModNormal_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_200, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_201, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_202, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_203, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_204, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_205, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_206, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_207, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_208, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_209, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_210, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_211, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_212, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_213, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_214, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_215, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_216, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_217, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_218, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_219, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_220, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_221, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_222, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_223, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_224, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_225, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_226, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_227, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_228, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_229, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_230, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_231, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_232, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_233, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_234, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_235, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_236, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_237, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_238, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_239, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_240, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_241, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_242, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_243, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_244, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_245, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_246, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_247, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_248, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_249, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_250, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_251, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_252, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_253, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_254, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_255, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_256, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_257, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_258, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_259, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_260, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_261, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_262, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_263, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_264, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_265, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_266, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_267, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_268, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_269, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_270, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_271, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_272, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_273, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_274, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_275, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_276, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_277, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_278, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_279, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_280, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_281, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_282, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_283, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_284, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_285, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_286, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_287, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_288, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_289, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_290, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_291, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_292, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_293, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_294, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_295, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_296, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_297, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_298, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_299, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<double>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<double>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<double>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_200> AgradCdfLogExpModNormal_vv_200;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_201> AgradCdfLogExpModNormal_vv_201;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_202> AgradCdfLogExpModNormal_vv_202;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_203> AgradCdfLogExpModNormal_vv_203;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_204> AgradCdfLogExpModNormal_vv_204;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_205> AgradCdfLogExpModNormal_vv_205;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_206> AgradCdfLogExpModNormal_vv_206;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_207> AgradCdfLogExpModNormal_vv_207;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_208> AgradCdfLogExpModNormal_vv_208;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_209> AgradCdfLogExpModNormal_vv_209;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_210> AgradCdfLogExpModNormal_vv_210;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_211> AgradCdfLogExpModNormal_vv_211;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_212> AgradCdfLogExpModNormal_vv_212;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_213> AgradCdfLogExpModNormal_vv_213;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_214> AgradCdfLogExpModNormal_vv_214;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_215> AgradCdfLogExpModNormal_vv_215;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_216> AgradCdfLogExpModNormal_vv_216;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_217> AgradCdfLogExpModNormal_vv_217;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_218> AgradCdfLogExpModNormal_vv_218;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_219> AgradCdfLogExpModNormal_vv_219;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_220> AgradCdfLogExpModNormal_vv_220;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_221> AgradCdfLogExpModNormal_vv_221;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_222> AgradCdfLogExpModNormal_vv_222;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_223> AgradCdfLogExpModNormal_vv_223;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_224> AgradCdfLogExpModNormal_vv_224;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_225> AgradCdfLogExpModNormal_vv_225;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_226> AgradCdfLogExpModNormal_vv_226;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_227> AgradCdfLogExpModNormal_vv_227;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_228> AgradCdfLogExpModNormal_vv_228;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_229> AgradCdfLogExpModNormal_vv_229;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_230> AgradCdfLogExpModNormal_vv_230;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_231> AgradCdfLogExpModNormal_vv_231;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_232> AgradCdfLogExpModNormal_vv_232;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_233> AgradCdfLogExpModNormal_vv_233;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_234> AgradCdfLogExpModNormal_vv_234;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_235> AgradCdfLogExpModNormal_vv_235;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_236> AgradCdfLogExpModNormal_vv_236;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_237> AgradCdfLogExpModNormal_vv_237;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_238> AgradCdfLogExpModNormal_vv_238;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_239> AgradCdfLogExpModNormal_vv_239;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_240> AgradCdfLogExpModNormal_vv_240;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_241> AgradCdfLogExpModNormal_vv_241;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_242> AgradCdfLogExpModNormal_vv_242;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_243> AgradCdfLogExpModNormal_vv_243;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_244> AgradCdfLogExpModNormal_vv_244;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_245> AgradCdfLogExpModNormal_vv_245;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_246> AgradCdfLogExpModNormal_vv_246;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_247> AgradCdfLogExpModNormal_vv_247;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_248> AgradCdfLogExpModNormal_vv_248;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_249> AgradCdfLogExpModNormal_vv_249;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_250> AgradCdfLogExpModNormal_vv_250;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_251> AgradCdfLogExpModNormal_vv_251;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_252> AgradCdfLogExpModNormal_vv_252;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_253> AgradCdfLogExpModNormal_vv_253;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_254> AgradCdfLogExpModNormal_vv_254;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_255> AgradCdfLogExpModNormal_vv_255;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_256> AgradCdfLogExpModNormal_vv_256;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_257> AgradCdfLogExpModNormal_vv_257;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_258> AgradCdfLogExpModNormal_vv_258;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_259> AgradCdfLogExpModNormal_vv_259;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_260> AgradCdfLogExpModNormal_vv_260;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_261> AgradCdfLogExpModNormal_vv_261;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_262> AgradCdfLogExpModNormal_vv_262;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_263> AgradCdfLogExpModNormal_vv_263;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_264> AgradCdfLogExpModNormal_vv_264;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_265> AgradCdfLogExpModNormal_vv_265;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_266> AgradCdfLogExpModNormal_vv_266;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_267> AgradCdfLogExpModNormal_vv_267;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_268> AgradCdfLogExpModNormal_vv_268;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_269> AgradCdfLogExpModNormal_vv_269;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_270> AgradCdfLogExpModNormal_vv_270;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_271> AgradCdfLogExpModNormal_vv_271;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_272> AgradCdfLogExpModNormal_vv_272;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_273> AgradCdfLogExpModNormal_vv_273;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_274> AgradCdfLogExpModNormal_vv_274;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_275> AgradCdfLogExpModNormal_vv_275;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_276> AgradCdfLogExpModNormal_vv_276;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_277> AgradCdfLogExpModNormal_vv_277;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_278> AgradCdfLogExpModNormal_vv_278;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_279> AgradCdfLogExpModNormal_vv_279;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_280> AgradCdfLogExpModNormal_vv_280;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_281> AgradCdfLogExpModNormal_vv_281;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_282> AgradCdfLogExpModNormal_vv_282;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_283> AgradCdfLogExpModNormal_vv_283;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_284> AgradCdfLogExpModNormal_vv_284;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_285> AgradCdfLogExpModNormal_vv_285;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_286> AgradCdfLogExpModNormal_vv_286;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_287> AgradCdfLogExpModNormal_vv_287;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_288> AgradCdfLogExpModNormal_vv_288;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_289> AgradCdfLogExpModNormal_vv_289;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_290> AgradCdfLogExpModNormal_vv_290;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_291> AgradCdfLogExpModNormal_vv_291;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_292> AgradCdfLogExpModNormal_vv_292;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_293> AgradCdfLogExpModNormal_vv_293;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_294> AgradCdfLogExpModNormal_vv_294;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_295> AgradCdfLogExpModNormal_vv_295;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_296> AgradCdfLogExpModNormal_vv_296;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_297> AgradCdfLogExpModNormal_vv_297;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_298> AgradCdfLogExpModNormal_vv_298;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_299> AgradCdfLogExpModNormal_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_200, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_201, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_202, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_203, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_204, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_205, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_206, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_207, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_208, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_209, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_210, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_211, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_212, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_213, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_214, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_215, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_216, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_217, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_218, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_219, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_220, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_221, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_222, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_223, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_224, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_225, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_226, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_227, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_228, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_229, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_230, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_231, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_232, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_233, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_234, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_235, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_236, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_237, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_238, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_239, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_240, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_241, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_242, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_243, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_244, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_245, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_246, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_247, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_248, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_249, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_250, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_251, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_252, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_253, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_254, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_255, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_256, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_257, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_258, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_259, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_260, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_261, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_262, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_263, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_264, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_265, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_266, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_267, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_268, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_269, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_270, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_271, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_272, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_273, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_274, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_275, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_276, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_277, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_278, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_279, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_280, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_281, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_282, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_283, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_284, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_285, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_286, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_287, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_288, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_289, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_290, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_291, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_292, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_293, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_294, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_295, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_296, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_297, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_298, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_299, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_300> AgradCdfLogExpModNormal_ffv_300;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_301> AgradCdfLogExpModNormal_ffv_301;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_302> AgradCdfLogExpModNormal_ffv_302;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_303> AgradCdfLogExpModNormal_ffv_303;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_304> AgradCdfLogExpModNormal_ffv_304;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_305> AgradCdfLogExpModNormal_ffv_305;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_306> AgradCdfLogExpModNormal_ffv_306;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_307> AgradCdfLogExpModNormal_ffv_307;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_308> AgradCdfLogExpModNormal_ffv_308;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_309> AgradCdfLogExpModNormal_ffv_309;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_310> AgradCdfLogExpModNormal_ffv_310;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_311> AgradCdfLogExpModNormal_ffv_311;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_312> AgradCdfLogExpModNormal_ffv_312;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_313> AgradCdfLogExpModNormal_ffv_313;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_314> AgradCdfLogExpModNormal_ffv_314;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_315> AgradCdfLogExpModNormal_ffv_315;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_316> AgradCdfLogExpModNormal_ffv_316;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_317> AgradCdfLogExpModNormal_ffv_317;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_318> AgradCdfLogExpModNormal_ffv_318;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_319> AgradCdfLogExpModNormal_ffv_319;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_320> AgradCdfLogExpModNormal_ffv_320;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_321> AgradCdfLogExpModNormal_ffv_321;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_322> AgradCdfLogExpModNormal_ffv_322;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_323> AgradCdfLogExpModNormal_ffv_323;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_324> AgradCdfLogExpModNormal_ffv_324;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_325> AgradCdfLogExpModNormal_ffv_325;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_326> AgradCdfLogExpModNormal_ffv_326;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_327> AgradCdfLogExpModNormal_ffv_327;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_328> AgradCdfLogExpModNormal_ffv_328;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_329> AgradCdfLogExpModNormal_ffv_329;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_330> AgradCdfLogExpModNormal_ffv_330;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_331> AgradCdfLogExpModNormal_ffv_331;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_332> AgradCdfLogExpModNormal_ffv_332;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_333> AgradCdfLogExpModNormal_ffv_333;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_334> AgradCdfLogExpModNormal_ffv_334;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_335> AgradCdfLogExpModNormal_ffv_335;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_336> AgradCdfLogExpModNormal_ffv_336;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_337> AgradCdfLogExpModNormal_ffv_337;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_338> AgradCdfLogExpModNormal_ffv_338;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_339> AgradCdfLogExpModNormal_ffv_339;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_340> AgradCdfLogExpModNormal_ffv_340;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_341> AgradCdfLogExpModNormal_ffv_341;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_342> AgradCdfLogExpModNormal_ffv_342;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_343> AgradCdfLogExpModNormal_ffv_343;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_344> AgradCdfLogExpModNormal_ffv_344;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_345> AgradCdfLogExpModNormal_ffv_345;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_346> AgradCdfLogExpModNormal_ffv_346;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_347> AgradCdfLogExpModNormal_ffv_347;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_348> AgradCdfLogExpModNormal_ffv_348;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_349> AgradCdfLogExpModNormal_ffv_349;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_350> AgradCdfLogExpModNormal_ffv_350;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_351> AgradCdfLogExpModNormal_ffv_351;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_352> AgradCdfLogExpModNormal_ffv_352;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_353> AgradCdfLogExpModNormal_ffv_353;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_354> AgradCdfLogExpModNormal_ffv_354;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_355> AgradCdfLogExpModNormal_ffv_355;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_356> AgradCdfLogExpModNormal_ffv_356;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_357> AgradCdfLogExpModNormal_ffv_357;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_358> AgradCdfLogExpModNormal_ffv_358;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_359> AgradCdfLogExpModNormal_ffv_359;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_360> AgradCdfLogExpModNormal_ffv_360;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_361> AgradCdfLogExpModNormal_ffv_361;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_362> AgradCdfLogExpModNormal_ffv_362;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_363> AgradCdfLogExpModNormal_ffv_363;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_364> AgradCdfLogExpModNormal_ffv_364;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_365> AgradCdfLogExpModNormal_ffv_365;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_366> AgradCdfLogExpModNormal_ffv_366;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_367> AgradCdfLogExpModNormal_ffv_367;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_368> AgradCdfLogExpModNormal_ffv_368;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_369> AgradCdfLogExpModNormal_ffv_369;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_370> AgradCdfLogExpModNormal_ffv_370;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_371> AgradCdfLogExpModNormal_ffv_371;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_372> AgradCdfLogExpModNormal_ffv_372;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_373> AgradCdfLogExpModNormal_ffv_373;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_374> AgradCdfLogExpModNormal_ffv_374;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_375> AgradCdfLogExpModNormal_ffv_375;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_376> AgradCdfLogExpModNormal_ffv_376;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_377> AgradCdfLogExpModNormal_ffv_377;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_378> AgradCdfLogExpModNormal_ffv_378;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_379> AgradCdfLogExpModNormal_ffv_379;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_380> AgradCdfLogExpModNormal_ffv_380;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_381> AgradCdfLogExpModNormal_ffv_381;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_382> AgradCdfLogExpModNormal_ffv_382;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_383> AgradCdfLogExpModNormal_ffv_383;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_384> AgradCdfLogExpModNormal_ffv_384;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_385> AgradCdfLogExpModNormal_ffv_385;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_386> AgradCdfLogExpModNormal_ffv_386;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_387> AgradCdfLogExpModNormal_ffv_387;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_388> AgradCdfLogExpModNormal_ffv_388;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_389> AgradCdfLogExpModNormal_ffv_389;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_390> AgradCdfLogExpModNormal_ffv_390;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_391> AgradCdfLogExpModNormal_ffv_391;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_392> AgradCdfLogExpModNormal_ffv_392;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_393> AgradCdfLogExpModNormal_ffv_393;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_394> AgradCdfLogExpModNormal_ffv_394;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_395> AgradCdfLogExpModNormal_ffv_395;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_396> AgradCdfLogExpModNormal_ffv_396;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_397> AgradCdfLogExpModNormal_ffv_397;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_398> AgradCdfLogExpModNormal_ffv_398;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_399> AgradCdfLogExpModNormal_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_300, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_301, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_302, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_303, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_304, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_305, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_306, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_307, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_308, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_309, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_310, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_311, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_312, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_313, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_314, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_315, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_316, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_317, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_318, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_319, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_320, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_321, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_322, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_323, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_324, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_325, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_326, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_327, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_328, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_329, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_330, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_331, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_332, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_333, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_334, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_335, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_336, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_337, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_338, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_339, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_340, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_341, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_342, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_343, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_344, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_345, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_346, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_347, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_348, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_349, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_350, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_351, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_352, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_353, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_354, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_355, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_356, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_357, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_358, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_359, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_360, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_361, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_362, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_363, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_364, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_365, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_366, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_367, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_368, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_369, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_370, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_371, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_372, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_373, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_374, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_375, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_376, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_377, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_378, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_379, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_380, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_381, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_382, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_383, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_384, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_385, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_386, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_387, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_388, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_389, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_390, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_391, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_392, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_393, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_394, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_395, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_396, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_397, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_398, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_399, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_399);
+
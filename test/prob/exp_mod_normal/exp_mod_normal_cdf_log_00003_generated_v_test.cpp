@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_300> AgradCdfLogExpModNormal_v_300;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_301> AgradCdfLogExpModNormal_v_301;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_302> AgradCdfLogExpModNormal_v_302;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_303> AgradCdfLogExpModNormal_v_303;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_304> AgradCdfLogExpModNormal_v_304;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_305> AgradCdfLogExpModNormal_v_305;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_306> AgradCdfLogExpModNormal_v_306;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_307> AgradCdfLogExpModNormal_v_307;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_308> AgradCdfLogExpModNormal_v_308;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_309> AgradCdfLogExpModNormal_v_309;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_310> AgradCdfLogExpModNormal_v_310;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_311> AgradCdfLogExpModNormal_v_311;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_312> AgradCdfLogExpModNormal_v_312;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_313> AgradCdfLogExpModNormal_v_313;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_314> AgradCdfLogExpModNormal_v_314;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_315> AgradCdfLogExpModNormal_v_315;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_316> AgradCdfLogExpModNormal_v_316;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_317> AgradCdfLogExpModNormal_v_317;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_318> AgradCdfLogExpModNormal_v_318;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_319> AgradCdfLogExpModNormal_v_319;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_320> AgradCdfLogExpModNormal_v_320;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_321> AgradCdfLogExpModNormal_v_321;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_322> AgradCdfLogExpModNormal_v_322;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_323> AgradCdfLogExpModNormal_v_323;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_324> AgradCdfLogExpModNormal_v_324;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_325> AgradCdfLogExpModNormal_v_325;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_326> AgradCdfLogExpModNormal_v_326;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_327> AgradCdfLogExpModNormal_v_327;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_328> AgradCdfLogExpModNormal_v_328;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_329> AgradCdfLogExpModNormal_v_329;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_330> AgradCdfLogExpModNormal_v_330;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_331> AgradCdfLogExpModNormal_v_331;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_332> AgradCdfLogExpModNormal_v_332;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_333> AgradCdfLogExpModNormal_v_333;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_334> AgradCdfLogExpModNormal_v_334;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_335> AgradCdfLogExpModNormal_v_335;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_336> AgradCdfLogExpModNormal_v_336;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_337> AgradCdfLogExpModNormal_v_337;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_338> AgradCdfLogExpModNormal_v_338;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_339> AgradCdfLogExpModNormal_v_339;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_340> AgradCdfLogExpModNormal_v_340;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_341> AgradCdfLogExpModNormal_v_341;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_342> AgradCdfLogExpModNormal_v_342;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_343> AgradCdfLogExpModNormal_v_343;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_344> AgradCdfLogExpModNormal_v_344;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_345> AgradCdfLogExpModNormal_v_345;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_346> AgradCdfLogExpModNormal_v_346;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_347> AgradCdfLogExpModNormal_v_347;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_348> AgradCdfLogExpModNormal_v_348;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_349> AgradCdfLogExpModNormal_v_349;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_350> AgradCdfLogExpModNormal_v_350;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_351> AgradCdfLogExpModNormal_v_351;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_352> AgradCdfLogExpModNormal_v_352;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_353> AgradCdfLogExpModNormal_v_353;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_354> AgradCdfLogExpModNormal_v_354;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_355> AgradCdfLogExpModNormal_v_355;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_356> AgradCdfLogExpModNormal_v_356;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_357> AgradCdfLogExpModNormal_v_357;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_358> AgradCdfLogExpModNormal_v_358;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_359> AgradCdfLogExpModNormal_v_359;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_360> AgradCdfLogExpModNormal_v_360;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_361> AgradCdfLogExpModNormal_v_361;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_362> AgradCdfLogExpModNormal_v_362;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_363> AgradCdfLogExpModNormal_v_363;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_364> AgradCdfLogExpModNormal_v_364;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_365> AgradCdfLogExpModNormal_v_365;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_366> AgradCdfLogExpModNormal_v_366;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_367> AgradCdfLogExpModNormal_v_367;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_368> AgradCdfLogExpModNormal_v_368;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_369> AgradCdfLogExpModNormal_v_369;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_370> AgradCdfLogExpModNormal_v_370;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_371> AgradCdfLogExpModNormal_v_371;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_372> AgradCdfLogExpModNormal_v_372;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_373> AgradCdfLogExpModNormal_v_373;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_374> AgradCdfLogExpModNormal_v_374;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_375> AgradCdfLogExpModNormal_v_375;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_376> AgradCdfLogExpModNormal_v_376;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_377> AgradCdfLogExpModNormal_v_377;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_378> AgradCdfLogExpModNormal_v_378;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_379> AgradCdfLogExpModNormal_v_379;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_380> AgradCdfLogExpModNormal_v_380;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_381> AgradCdfLogExpModNormal_v_381;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_382> AgradCdfLogExpModNormal_v_382;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_383> AgradCdfLogExpModNormal_v_383;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_384> AgradCdfLogExpModNormal_v_384;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_385> AgradCdfLogExpModNormal_v_385;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_386> AgradCdfLogExpModNormal_v_386;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_387> AgradCdfLogExpModNormal_v_387;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_388> AgradCdfLogExpModNormal_v_388;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_389> AgradCdfLogExpModNormal_v_389;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_390> AgradCdfLogExpModNormal_v_390;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_391> AgradCdfLogExpModNormal_v_391;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_392> AgradCdfLogExpModNormal_v_392;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_393> AgradCdfLogExpModNormal_v_393;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_394> AgradCdfLogExpModNormal_v_394;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_395> AgradCdfLogExpModNormal_v_395;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_396> AgradCdfLogExpModNormal_v_396;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_397> AgradCdfLogExpModNormal_v_397;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_398> AgradCdfLogExpModNormal_v_398;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_399> AgradCdfLogExpModNormal_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_300, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_301, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_302, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_303, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_304, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_305, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_306, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_307, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_308, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_309, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_310, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_311, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_312, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_313, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_314, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_315, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_316, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_317, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_318, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_319, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_320, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_321, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_322, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_323, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_324, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_325, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_326, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_327, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_328, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_329, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_330, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_331, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_332, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_333, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_334, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_335, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_336, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_337, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_338, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_339, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_340, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_341, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_342, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_343, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_344, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_345, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_346, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_347, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_348, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_349, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_350, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_351, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_352, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_353, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_354, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_355, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_356, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_357, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_358, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_359, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_360, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_361, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_362, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_363, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_364, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_365, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_366, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_367, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_368, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_369, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_370, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_371, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_372, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_373, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_374, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_375, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_376, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_377, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_378, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_379, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_380, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_381, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_382, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_383, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_384, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_385, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_386, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_387, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_388, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_389, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_390, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_391, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_392, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_393, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_394, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_395, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_396, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_397, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_398, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_399, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_399);
+
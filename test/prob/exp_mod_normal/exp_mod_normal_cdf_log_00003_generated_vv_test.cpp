@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_300> AgradCdfLogExpModNormal_vv_300;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_301> AgradCdfLogExpModNormal_vv_301;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_302> AgradCdfLogExpModNormal_vv_302;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_303> AgradCdfLogExpModNormal_vv_303;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_304> AgradCdfLogExpModNormal_vv_304;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_305> AgradCdfLogExpModNormal_vv_305;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_306> AgradCdfLogExpModNormal_vv_306;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_307> AgradCdfLogExpModNormal_vv_307;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_308> AgradCdfLogExpModNormal_vv_308;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_309> AgradCdfLogExpModNormal_vv_309;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_310> AgradCdfLogExpModNormal_vv_310;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_311> AgradCdfLogExpModNormal_vv_311;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_312> AgradCdfLogExpModNormal_vv_312;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_313> AgradCdfLogExpModNormal_vv_313;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_314> AgradCdfLogExpModNormal_vv_314;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_315> AgradCdfLogExpModNormal_vv_315;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_316> AgradCdfLogExpModNormal_vv_316;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_317> AgradCdfLogExpModNormal_vv_317;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_318> AgradCdfLogExpModNormal_vv_318;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_319> AgradCdfLogExpModNormal_vv_319;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_320> AgradCdfLogExpModNormal_vv_320;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_321> AgradCdfLogExpModNormal_vv_321;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_322> AgradCdfLogExpModNormal_vv_322;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_323> AgradCdfLogExpModNormal_vv_323;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_324> AgradCdfLogExpModNormal_vv_324;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_325> AgradCdfLogExpModNormal_vv_325;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_326> AgradCdfLogExpModNormal_vv_326;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_327> AgradCdfLogExpModNormal_vv_327;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_328> AgradCdfLogExpModNormal_vv_328;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_329> AgradCdfLogExpModNormal_vv_329;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_330> AgradCdfLogExpModNormal_vv_330;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_331> AgradCdfLogExpModNormal_vv_331;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_332> AgradCdfLogExpModNormal_vv_332;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_333> AgradCdfLogExpModNormal_vv_333;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_334> AgradCdfLogExpModNormal_vv_334;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_335> AgradCdfLogExpModNormal_vv_335;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_336> AgradCdfLogExpModNormal_vv_336;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_337> AgradCdfLogExpModNormal_vv_337;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_338> AgradCdfLogExpModNormal_vv_338;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_339> AgradCdfLogExpModNormal_vv_339;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_340> AgradCdfLogExpModNormal_vv_340;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_341> AgradCdfLogExpModNormal_vv_341;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_342> AgradCdfLogExpModNormal_vv_342;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_343> AgradCdfLogExpModNormal_vv_343;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_344> AgradCdfLogExpModNormal_vv_344;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_345> AgradCdfLogExpModNormal_vv_345;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_346> AgradCdfLogExpModNormal_vv_346;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_347> AgradCdfLogExpModNormal_vv_347;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_348> AgradCdfLogExpModNormal_vv_348;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_349> AgradCdfLogExpModNormal_vv_349;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_350> AgradCdfLogExpModNormal_vv_350;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_351> AgradCdfLogExpModNormal_vv_351;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_352> AgradCdfLogExpModNormal_vv_352;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_353> AgradCdfLogExpModNormal_vv_353;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_354> AgradCdfLogExpModNormal_vv_354;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_355> AgradCdfLogExpModNormal_vv_355;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_356> AgradCdfLogExpModNormal_vv_356;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_357> AgradCdfLogExpModNormal_vv_357;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_358> AgradCdfLogExpModNormal_vv_358;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_359> AgradCdfLogExpModNormal_vv_359;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_360> AgradCdfLogExpModNormal_vv_360;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_361> AgradCdfLogExpModNormal_vv_361;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_362> AgradCdfLogExpModNormal_vv_362;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_363> AgradCdfLogExpModNormal_vv_363;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_364> AgradCdfLogExpModNormal_vv_364;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_365> AgradCdfLogExpModNormal_vv_365;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_366> AgradCdfLogExpModNormal_vv_366;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_367> AgradCdfLogExpModNormal_vv_367;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_368> AgradCdfLogExpModNormal_vv_368;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_369> AgradCdfLogExpModNormal_vv_369;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_370> AgradCdfLogExpModNormal_vv_370;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_371> AgradCdfLogExpModNormal_vv_371;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_372> AgradCdfLogExpModNormal_vv_372;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_373> AgradCdfLogExpModNormal_vv_373;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_374> AgradCdfLogExpModNormal_vv_374;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_375> AgradCdfLogExpModNormal_vv_375;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_376> AgradCdfLogExpModNormal_vv_376;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_377> AgradCdfLogExpModNormal_vv_377;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_378> AgradCdfLogExpModNormal_vv_378;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_379> AgradCdfLogExpModNormal_vv_379;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_380> AgradCdfLogExpModNormal_vv_380;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_381> AgradCdfLogExpModNormal_vv_381;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_382> AgradCdfLogExpModNormal_vv_382;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_383> AgradCdfLogExpModNormal_vv_383;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_384> AgradCdfLogExpModNormal_vv_384;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_385> AgradCdfLogExpModNormal_vv_385;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_386> AgradCdfLogExpModNormal_vv_386;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_387> AgradCdfLogExpModNormal_vv_387;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_388> AgradCdfLogExpModNormal_vv_388;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_389> AgradCdfLogExpModNormal_vv_389;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_390> AgradCdfLogExpModNormal_vv_390;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_391> AgradCdfLogExpModNormal_vv_391;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_392> AgradCdfLogExpModNormal_vv_392;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_393> AgradCdfLogExpModNormal_vv_393;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_394> AgradCdfLogExpModNormal_vv_394;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_395> AgradCdfLogExpModNormal_vv_395;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_396> AgradCdfLogExpModNormal_vv_396;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_397> AgradCdfLogExpModNormal_vv_397;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_398> AgradCdfLogExpModNormal_vv_398;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_399> AgradCdfLogExpModNormal_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_300, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_301, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_302, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_303, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_304, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_305, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_306, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_307, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_308, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_309, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_310, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_311, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_312, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_313, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_314, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_315, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_316, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_317, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_318, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_319, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_320, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_321, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_322, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_323, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_324, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_325, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_326, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_327, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_328, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_329, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_330, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_331, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_332, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_333, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_334, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_335, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_336, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_337, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_338, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_339, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_340, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_341, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_342, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_343, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_344, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_345, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_346, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_347, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_348, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_349, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_350, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_351, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_352, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_353, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_354, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_355, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_356, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_357, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_358, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_359, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_360, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_361, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_362, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_363, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_364, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_365, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_366, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_367, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_368, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_369, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_370, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_371, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_372, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_373, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_374, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_375, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_376, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_377, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_378, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_379, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_380, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_381, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_382, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_383, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_384, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_385, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_386, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_387, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_388, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_389, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_390, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_391, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_392, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_393, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_394, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_395, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_396, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_397, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_398, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_399, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_400> AgradCdfLogExpModNormal_ffv_400;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_401> AgradCdfLogExpModNormal_ffv_401;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_402> AgradCdfLogExpModNormal_ffv_402;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_403> AgradCdfLogExpModNormal_ffv_403;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_404> AgradCdfLogExpModNormal_ffv_404;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_405> AgradCdfLogExpModNormal_ffv_405;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_406> AgradCdfLogExpModNormal_ffv_406;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_407> AgradCdfLogExpModNormal_ffv_407;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_408> AgradCdfLogExpModNormal_ffv_408;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_409> AgradCdfLogExpModNormal_ffv_409;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_410> AgradCdfLogExpModNormal_ffv_410;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_411> AgradCdfLogExpModNormal_ffv_411;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_412> AgradCdfLogExpModNormal_ffv_412;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_413> AgradCdfLogExpModNormal_ffv_413;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_414> AgradCdfLogExpModNormal_ffv_414;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_415> AgradCdfLogExpModNormal_ffv_415;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_416> AgradCdfLogExpModNormal_ffv_416;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_417> AgradCdfLogExpModNormal_ffv_417;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_418> AgradCdfLogExpModNormal_ffv_418;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_419> AgradCdfLogExpModNormal_ffv_419;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_420> AgradCdfLogExpModNormal_ffv_420;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_421> AgradCdfLogExpModNormal_ffv_421;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_422> AgradCdfLogExpModNormal_ffv_422;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_423> AgradCdfLogExpModNormal_ffv_423;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_424> AgradCdfLogExpModNormal_ffv_424;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_425> AgradCdfLogExpModNormal_ffv_425;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_426> AgradCdfLogExpModNormal_ffv_426;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_427> AgradCdfLogExpModNormal_ffv_427;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_428> AgradCdfLogExpModNormal_ffv_428;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_429> AgradCdfLogExpModNormal_ffv_429;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_430> AgradCdfLogExpModNormal_ffv_430;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_431> AgradCdfLogExpModNormal_ffv_431;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_432> AgradCdfLogExpModNormal_ffv_432;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_433> AgradCdfLogExpModNormal_ffv_433;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_434> AgradCdfLogExpModNormal_ffv_434;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_435> AgradCdfLogExpModNormal_ffv_435;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_436> AgradCdfLogExpModNormal_ffv_436;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_437> AgradCdfLogExpModNormal_ffv_437;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_438> AgradCdfLogExpModNormal_ffv_438;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_439> AgradCdfLogExpModNormal_ffv_439;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_440> AgradCdfLogExpModNormal_ffv_440;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_441> AgradCdfLogExpModNormal_ffv_441;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_442> AgradCdfLogExpModNormal_ffv_442;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_443> AgradCdfLogExpModNormal_ffv_443;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_444> AgradCdfLogExpModNormal_ffv_444;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_445> AgradCdfLogExpModNormal_ffv_445;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_446> AgradCdfLogExpModNormal_ffv_446;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_447> AgradCdfLogExpModNormal_ffv_447;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_448> AgradCdfLogExpModNormal_ffv_448;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_449> AgradCdfLogExpModNormal_ffv_449;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_450> AgradCdfLogExpModNormal_ffv_450;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_451> AgradCdfLogExpModNormal_ffv_451;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_452> AgradCdfLogExpModNormal_ffv_452;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_453> AgradCdfLogExpModNormal_ffv_453;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_454> AgradCdfLogExpModNormal_ffv_454;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_455> AgradCdfLogExpModNormal_ffv_455;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_456> AgradCdfLogExpModNormal_ffv_456;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_457> AgradCdfLogExpModNormal_ffv_457;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_458> AgradCdfLogExpModNormal_ffv_458;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_459> AgradCdfLogExpModNormal_ffv_459;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_460> AgradCdfLogExpModNormal_ffv_460;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_461> AgradCdfLogExpModNormal_ffv_461;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_462> AgradCdfLogExpModNormal_ffv_462;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_463> AgradCdfLogExpModNormal_ffv_463;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_464> AgradCdfLogExpModNormal_ffv_464;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_465> AgradCdfLogExpModNormal_ffv_465;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_466> AgradCdfLogExpModNormal_ffv_466;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_467> AgradCdfLogExpModNormal_ffv_467;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_468> AgradCdfLogExpModNormal_ffv_468;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_469> AgradCdfLogExpModNormal_ffv_469;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_470> AgradCdfLogExpModNormal_ffv_470;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_471> AgradCdfLogExpModNormal_ffv_471;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_472> AgradCdfLogExpModNormal_ffv_472;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_473> AgradCdfLogExpModNormal_ffv_473;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_474> AgradCdfLogExpModNormal_ffv_474;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_475> AgradCdfLogExpModNormal_ffv_475;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_476> AgradCdfLogExpModNormal_ffv_476;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_477> AgradCdfLogExpModNormal_ffv_477;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_478> AgradCdfLogExpModNormal_ffv_478;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_479> AgradCdfLogExpModNormal_ffv_479;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_480> AgradCdfLogExpModNormal_ffv_480;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_481> AgradCdfLogExpModNormal_ffv_481;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_482> AgradCdfLogExpModNormal_ffv_482;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_483> AgradCdfLogExpModNormal_ffv_483;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_484> AgradCdfLogExpModNormal_ffv_484;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_485> AgradCdfLogExpModNormal_ffv_485;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_486> AgradCdfLogExpModNormal_ffv_486;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_487> AgradCdfLogExpModNormal_ffv_487;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_488> AgradCdfLogExpModNormal_ffv_488;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_489> AgradCdfLogExpModNormal_ffv_489;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_490> AgradCdfLogExpModNormal_ffv_490;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_491> AgradCdfLogExpModNormal_ffv_491;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_492> AgradCdfLogExpModNormal_ffv_492;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_493> AgradCdfLogExpModNormal_ffv_493;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_494> AgradCdfLogExpModNormal_ffv_494;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_495> AgradCdfLogExpModNormal_ffv_495;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_496> AgradCdfLogExpModNormal_ffv_496;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_497> AgradCdfLogExpModNormal_ffv_497;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_498> AgradCdfLogExpModNormal_ffv_498;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_499> AgradCdfLogExpModNormal_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_400, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_401, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_402, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_403, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_404, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_405, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_406, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_407, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_408, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_409, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_410, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_411, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_412, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_413, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_414, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_415, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_416, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_417, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_418, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_419, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_420, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_421, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_422, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_423, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_424, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_425, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_426, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_427, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_428, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_429, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_430, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_431, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_432, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_433, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_434, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_435, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_436, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_437, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_438, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_439, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_440, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_441, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_442, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_443, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_444, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_445, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_446, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_447, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_448, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_449, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_450, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_451, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_452, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_453, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_454, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_455, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_456, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_457, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_458, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_459, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_460, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_461, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_462, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_463, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_464, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_465, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_466, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_467, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_468, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_469, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_470, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_471, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_472, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_473, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_474, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_475, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_476, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_477, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_478, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_479, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_480, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_481, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_482, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_483, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_484, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_485, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_486, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_487, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_488, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_489, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_490, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_491, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_492, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_493, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_494, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_495, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_496, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_497, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_498, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_499, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_499);
+
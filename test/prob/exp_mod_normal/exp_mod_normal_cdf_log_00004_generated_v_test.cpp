@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_400> AgradCdfLogExpModNormal_v_400;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_401> AgradCdfLogExpModNormal_v_401;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_402> AgradCdfLogExpModNormal_v_402;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_403> AgradCdfLogExpModNormal_v_403;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_404> AgradCdfLogExpModNormal_v_404;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_405> AgradCdfLogExpModNormal_v_405;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_406> AgradCdfLogExpModNormal_v_406;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_407> AgradCdfLogExpModNormal_v_407;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_408> AgradCdfLogExpModNormal_v_408;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_409> AgradCdfLogExpModNormal_v_409;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_410> AgradCdfLogExpModNormal_v_410;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_411> AgradCdfLogExpModNormal_v_411;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_412> AgradCdfLogExpModNormal_v_412;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_413> AgradCdfLogExpModNormal_v_413;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_414> AgradCdfLogExpModNormal_v_414;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_415> AgradCdfLogExpModNormal_v_415;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_416> AgradCdfLogExpModNormal_v_416;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_417> AgradCdfLogExpModNormal_v_417;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_418> AgradCdfLogExpModNormal_v_418;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_419> AgradCdfLogExpModNormal_v_419;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_420> AgradCdfLogExpModNormal_v_420;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_421> AgradCdfLogExpModNormal_v_421;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_422> AgradCdfLogExpModNormal_v_422;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_423> AgradCdfLogExpModNormal_v_423;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_424> AgradCdfLogExpModNormal_v_424;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_425> AgradCdfLogExpModNormal_v_425;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_426> AgradCdfLogExpModNormal_v_426;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_427> AgradCdfLogExpModNormal_v_427;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_428> AgradCdfLogExpModNormal_v_428;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_429> AgradCdfLogExpModNormal_v_429;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_430> AgradCdfLogExpModNormal_v_430;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_431> AgradCdfLogExpModNormal_v_431;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_432> AgradCdfLogExpModNormal_v_432;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_433> AgradCdfLogExpModNormal_v_433;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_434> AgradCdfLogExpModNormal_v_434;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_435> AgradCdfLogExpModNormal_v_435;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_436> AgradCdfLogExpModNormal_v_436;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_437> AgradCdfLogExpModNormal_v_437;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_438> AgradCdfLogExpModNormal_v_438;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_439> AgradCdfLogExpModNormal_v_439;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_440> AgradCdfLogExpModNormal_v_440;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_441> AgradCdfLogExpModNormal_v_441;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_442> AgradCdfLogExpModNormal_v_442;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_443> AgradCdfLogExpModNormal_v_443;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_444> AgradCdfLogExpModNormal_v_444;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_445> AgradCdfLogExpModNormal_v_445;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_446> AgradCdfLogExpModNormal_v_446;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_447> AgradCdfLogExpModNormal_v_447;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_448> AgradCdfLogExpModNormal_v_448;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_449> AgradCdfLogExpModNormal_v_449;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_450> AgradCdfLogExpModNormal_v_450;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_451> AgradCdfLogExpModNormal_v_451;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_452> AgradCdfLogExpModNormal_v_452;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_453> AgradCdfLogExpModNormal_v_453;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_454> AgradCdfLogExpModNormal_v_454;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_455> AgradCdfLogExpModNormal_v_455;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_456> AgradCdfLogExpModNormal_v_456;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_457> AgradCdfLogExpModNormal_v_457;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_458> AgradCdfLogExpModNormal_v_458;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_459> AgradCdfLogExpModNormal_v_459;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_460> AgradCdfLogExpModNormal_v_460;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_461> AgradCdfLogExpModNormal_v_461;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_462> AgradCdfLogExpModNormal_v_462;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_463> AgradCdfLogExpModNormal_v_463;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_464> AgradCdfLogExpModNormal_v_464;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_465> AgradCdfLogExpModNormal_v_465;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_466> AgradCdfLogExpModNormal_v_466;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_467> AgradCdfLogExpModNormal_v_467;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_468> AgradCdfLogExpModNormal_v_468;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_469> AgradCdfLogExpModNormal_v_469;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_470> AgradCdfLogExpModNormal_v_470;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_471> AgradCdfLogExpModNormal_v_471;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_472> AgradCdfLogExpModNormal_v_472;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_473> AgradCdfLogExpModNormal_v_473;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_474> AgradCdfLogExpModNormal_v_474;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_475> AgradCdfLogExpModNormal_v_475;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_476> AgradCdfLogExpModNormal_v_476;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_477> AgradCdfLogExpModNormal_v_477;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_478> AgradCdfLogExpModNormal_v_478;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_479> AgradCdfLogExpModNormal_v_479;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_480> AgradCdfLogExpModNormal_v_480;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_481> AgradCdfLogExpModNormal_v_481;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_482> AgradCdfLogExpModNormal_v_482;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_483> AgradCdfLogExpModNormal_v_483;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_484> AgradCdfLogExpModNormal_v_484;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_485> AgradCdfLogExpModNormal_v_485;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_486> AgradCdfLogExpModNormal_v_486;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_487> AgradCdfLogExpModNormal_v_487;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_488> AgradCdfLogExpModNormal_v_488;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_489> AgradCdfLogExpModNormal_v_489;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_490> AgradCdfLogExpModNormal_v_490;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_491> AgradCdfLogExpModNormal_v_491;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_492> AgradCdfLogExpModNormal_v_492;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_493> AgradCdfLogExpModNormal_v_493;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_494> AgradCdfLogExpModNormal_v_494;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_495> AgradCdfLogExpModNormal_v_495;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_496> AgradCdfLogExpModNormal_v_496;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_497> AgradCdfLogExpModNormal_v_497;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_498> AgradCdfLogExpModNormal_v_498;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_499> AgradCdfLogExpModNormal_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_400, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_401, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_402, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_403, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_404, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_405, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_406, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_407, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_408, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_409, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_410, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_411, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_412, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_413, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_414, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_415, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_416, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_417, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_418, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_419, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_420, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_421, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_422, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_423, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_424, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_425, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_426, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_427, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_428, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_429, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_430, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_431, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_432, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_433, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_434, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_435, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_436, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_437, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_438, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_439, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_440, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_441, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_442, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_443, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_444, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_445, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_446, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_447, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_448, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_449, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_450, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_451, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_452, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_453, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_454, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_455, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_456, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_457, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_458, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_459, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_460, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_461, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_462, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_463, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_464, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_465, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_466, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_467, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_468, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_469, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_470, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_471, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_472, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_473, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_474, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_475, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_476, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_477, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_478, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_479, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_480, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_481, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_482, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_483, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_484, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_485, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_486, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_487, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_488, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_489, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_490, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_491, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_492, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_493, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_494, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_495, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_496, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_497, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_498, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_499, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_499);
+
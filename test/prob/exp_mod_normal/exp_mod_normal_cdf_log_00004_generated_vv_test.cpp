@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_400> AgradCdfLogExpModNormal_vv_400;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_401> AgradCdfLogExpModNormal_vv_401;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_402> AgradCdfLogExpModNormal_vv_402;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_403> AgradCdfLogExpModNormal_vv_403;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_404> AgradCdfLogExpModNormal_vv_404;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_405> AgradCdfLogExpModNormal_vv_405;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_406> AgradCdfLogExpModNormal_vv_406;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_407> AgradCdfLogExpModNormal_vv_407;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_408> AgradCdfLogExpModNormal_vv_408;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_409> AgradCdfLogExpModNormal_vv_409;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_410> AgradCdfLogExpModNormal_vv_410;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_411> AgradCdfLogExpModNormal_vv_411;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_412> AgradCdfLogExpModNormal_vv_412;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_413> AgradCdfLogExpModNormal_vv_413;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_414> AgradCdfLogExpModNormal_vv_414;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_415> AgradCdfLogExpModNormal_vv_415;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_416> AgradCdfLogExpModNormal_vv_416;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_417> AgradCdfLogExpModNormal_vv_417;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_418> AgradCdfLogExpModNormal_vv_418;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_419> AgradCdfLogExpModNormal_vv_419;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_420> AgradCdfLogExpModNormal_vv_420;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_421> AgradCdfLogExpModNormal_vv_421;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_422> AgradCdfLogExpModNormal_vv_422;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_423> AgradCdfLogExpModNormal_vv_423;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_424> AgradCdfLogExpModNormal_vv_424;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_425> AgradCdfLogExpModNormal_vv_425;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_426> AgradCdfLogExpModNormal_vv_426;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_427> AgradCdfLogExpModNormal_vv_427;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_428> AgradCdfLogExpModNormal_vv_428;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_429> AgradCdfLogExpModNormal_vv_429;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_430> AgradCdfLogExpModNormal_vv_430;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_431> AgradCdfLogExpModNormal_vv_431;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_432> AgradCdfLogExpModNormal_vv_432;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_433> AgradCdfLogExpModNormal_vv_433;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_434> AgradCdfLogExpModNormal_vv_434;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_435> AgradCdfLogExpModNormal_vv_435;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_436> AgradCdfLogExpModNormal_vv_436;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_437> AgradCdfLogExpModNormal_vv_437;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_438> AgradCdfLogExpModNormal_vv_438;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_439> AgradCdfLogExpModNormal_vv_439;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_440> AgradCdfLogExpModNormal_vv_440;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_441> AgradCdfLogExpModNormal_vv_441;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_442> AgradCdfLogExpModNormal_vv_442;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_443> AgradCdfLogExpModNormal_vv_443;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_444> AgradCdfLogExpModNormal_vv_444;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_445> AgradCdfLogExpModNormal_vv_445;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_446> AgradCdfLogExpModNormal_vv_446;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_447> AgradCdfLogExpModNormal_vv_447;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_448> AgradCdfLogExpModNormal_vv_448;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_449> AgradCdfLogExpModNormal_vv_449;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_450> AgradCdfLogExpModNormal_vv_450;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_451> AgradCdfLogExpModNormal_vv_451;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_452> AgradCdfLogExpModNormal_vv_452;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_453> AgradCdfLogExpModNormal_vv_453;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_454> AgradCdfLogExpModNormal_vv_454;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_455> AgradCdfLogExpModNormal_vv_455;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_456> AgradCdfLogExpModNormal_vv_456;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_457> AgradCdfLogExpModNormal_vv_457;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_458> AgradCdfLogExpModNormal_vv_458;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_459> AgradCdfLogExpModNormal_vv_459;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_460> AgradCdfLogExpModNormal_vv_460;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_461> AgradCdfLogExpModNormal_vv_461;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_462> AgradCdfLogExpModNormal_vv_462;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_463> AgradCdfLogExpModNormal_vv_463;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_464> AgradCdfLogExpModNormal_vv_464;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_465> AgradCdfLogExpModNormal_vv_465;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_466> AgradCdfLogExpModNormal_vv_466;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_467> AgradCdfLogExpModNormal_vv_467;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_468> AgradCdfLogExpModNormal_vv_468;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_469> AgradCdfLogExpModNormal_vv_469;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_470> AgradCdfLogExpModNormal_vv_470;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_471> AgradCdfLogExpModNormal_vv_471;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_472> AgradCdfLogExpModNormal_vv_472;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_473> AgradCdfLogExpModNormal_vv_473;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_474> AgradCdfLogExpModNormal_vv_474;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_475> AgradCdfLogExpModNormal_vv_475;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_476> AgradCdfLogExpModNormal_vv_476;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_477> AgradCdfLogExpModNormal_vv_477;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_478> AgradCdfLogExpModNormal_vv_478;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_479> AgradCdfLogExpModNormal_vv_479;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_480> AgradCdfLogExpModNormal_vv_480;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_481> AgradCdfLogExpModNormal_vv_481;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_482> AgradCdfLogExpModNormal_vv_482;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_483> AgradCdfLogExpModNormal_vv_483;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_484> AgradCdfLogExpModNormal_vv_484;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_485> AgradCdfLogExpModNormal_vv_485;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_486> AgradCdfLogExpModNormal_vv_486;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_487> AgradCdfLogExpModNormal_vv_487;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_488> AgradCdfLogExpModNormal_vv_488;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_489> AgradCdfLogExpModNormal_vv_489;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_490> AgradCdfLogExpModNormal_vv_490;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_491> AgradCdfLogExpModNormal_vv_491;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_492> AgradCdfLogExpModNormal_vv_492;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_493> AgradCdfLogExpModNormal_vv_493;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_494> AgradCdfLogExpModNormal_vv_494;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_495> AgradCdfLogExpModNormal_vv_495;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_496> AgradCdfLogExpModNormal_vv_496;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_497> AgradCdfLogExpModNormal_vv_497;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_498> AgradCdfLogExpModNormal_vv_498;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_499> AgradCdfLogExpModNormal_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_400, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_401, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_402, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_403, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_404, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_405, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_406, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_407, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_408, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_409, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_410, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_411, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_412, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_413, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_414, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_415, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_416, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_417, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_418, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_419, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_420, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_421, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_422, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_423, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_424, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_425, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_426, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_427, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_428, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_429, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_430, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_431, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_432, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_433, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_434, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_435, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_436, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_437, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_438, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_439, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_440, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_441, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_442, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_443, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_444, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_445, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_446, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_447, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_448, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_449, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_450, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_451, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_452, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_453, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_454, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_455, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_456, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_457, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_458, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_459, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_460, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_461, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_462, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_463, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_464, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_465, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_466, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_467, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_468, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_469, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_470, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_471, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_472, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_473, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_474, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_475, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_476, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_477, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_478, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_479, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_480, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_481, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_482, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_483, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_484, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_485, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_486, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_487, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_488, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_489, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_490, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_491, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_492, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_493, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_494, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_495, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_496, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_497, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_498, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_499, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+typedef std::tuple<fvar<fvar<var> >, double, double, double, empty, empty> type_ffv_567;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<double>, empty, empty> type_ffv_568;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_569;
+typedef std::tuple<fvar<fvar<var> >, double, double, fvar<fvar<var> >, empty, empty> type_ffv_570;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_571;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_572;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, double, empty, empty> type_ffv_573;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_574;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_575;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_576;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_577;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_578;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_579;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_580;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_581;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_582;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_583;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_584;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty, empty> type_ffv_585;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_586;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_587;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_588;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_589;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_590;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_591;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_592;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_593;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_594;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_595;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_596;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_597;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_598;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_599;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_500> AgradCdfLogExpModNormal_ffv_500;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_501> AgradCdfLogExpModNormal_ffv_501;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_502> AgradCdfLogExpModNormal_ffv_502;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_503> AgradCdfLogExpModNormal_ffv_503;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_504> AgradCdfLogExpModNormal_ffv_504;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_505> AgradCdfLogExpModNormal_ffv_505;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_506> AgradCdfLogExpModNormal_ffv_506;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_507> AgradCdfLogExpModNormal_ffv_507;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_508> AgradCdfLogExpModNormal_ffv_508;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_509> AgradCdfLogExpModNormal_ffv_509;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_510> AgradCdfLogExpModNormal_ffv_510;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_511> AgradCdfLogExpModNormal_ffv_511;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_512> AgradCdfLogExpModNormal_ffv_512;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_513> AgradCdfLogExpModNormal_ffv_513;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_514> AgradCdfLogExpModNormal_ffv_514;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_515> AgradCdfLogExpModNormal_ffv_515;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_516> AgradCdfLogExpModNormal_ffv_516;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_517> AgradCdfLogExpModNormal_ffv_517;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_518> AgradCdfLogExpModNormal_ffv_518;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_519> AgradCdfLogExpModNormal_ffv_519;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_520> AgradCdfLogExpModNormal_ffv_520;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_521> AgradCdfLogExpModNormal_ffv_521;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_522> AgradCdfLogExpModNormal_ffv_522;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_523> AgradCdfLogExpModNormal_ffv_523;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_524> AgradCdfLogExpModNormal_ffv_524;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_525> AgradCdfLogExpModNormal_ffv_525;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_526> AgradCdfLogExpModNormal_ffv_526;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_527> AgradCdfLogExpModNormal_ffv_527;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_528> AgradCdfLogExpModNormal_ffv_528;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_529> AgradCdfLogExpModNormal_ffv_529;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_530> AgradCdfLogExpModNormal_ffv_530;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_531> AgradCdfLogExpModNormal_ffv_531;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_532> AgradCdfLogExpModNormal_ffv_532;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_533> AgradCdfLogExpModNormal_ffv_533;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_534> AgradCdfLogExpModNormal_ffv_534;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_535> AgradCdfLogExpModNormal_ffv_535;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_536> AgradCdfLogExpModNormal_ffv_536;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_537> AgradCdfLogExpModNormal_ffv_537;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_538> AgradCdfLogExpModNormal_ffv_538;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_539> AgradCdfLogExpModNormal_ffv_539;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_540> AgradCdfLogExpModNormal_ffv_540;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_541> AgradCdfLogExpModNormal_ffv_541;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_542> AgradCdfLogExpModNormal_ffv_542;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_543> AgradCdfLogExpModNormal_ffv_543;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_544> AgradCdfLogExpModNormal_ffv_544;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_545> AgradCdfLogExpModNormal_ffv_545;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_546> AgradCdfLogExpModNormal_ffv_546;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_547> AgradCdfLogExpModNormal_ffv_547;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_548> AgradCdfLogExpModNormal_ffv_548;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_549> AgradCdfLogExpModNormal_ffv_549;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_550> AgradCdfLogExpModNormal_ffv_550;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_551> AgradCdfLogExpModNormal_ffv_551;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_552> AgradCdfLogExpModNormal_ffv_552;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_553> AgradCdfLogExpModNormal_ffv_553;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_554> AgradCdfLogExpModNormal_ffv_554;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_555> AgradCdfLogExpModNormal_ffv_555;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_556> AgradCdfLogExpModNormal_ffv_556;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_557> AgradCdfLogExpModNormal_ffv_557;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_558> AgradCdfLogExpModNormal_ffv_558;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_559> AgradCdfLogExpModNormal_ffv_559;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_560> AgradCdfLogExpModNormal_ffv_560;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_561> AgradCdfLogExpModNormal_ffv_561;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_562> AgradCdfLogExpModNormal_ffv_562;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_563> AgradCdfLogExpModNormal_ffv_563;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_564> AgradCdfLogExpModNormal_ffv_564;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_565> AgradCdfLogExpModNormal_ffv_565;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_566> AgradCdfLogExpModNormal_ffv_566;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_567> AgradCdfLogExpModNormal_ffv_567;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_568> AgradCdfLogExpModNormal_ffv_568;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_569> AgradCdfLogExpModNormal_ffv_569;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_570> AgradCdfLogExpModNormal_ffv_570;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_571> AgradCdfLogExpModNormal_ffv_571;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_572> AgradCdfLogExpModNormal_ffv_572;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_573> AgradCdfLogExpModNormal_ffv_573;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_574> AgradCdfLogExpModNormal_ffv_574;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_575> AgradCdfLogExpModNormal_ffv_575;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_576> AgradCdfLogExpModNormal_ffv_576;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_577> AgradCdfLogExpModNormal_ffv_577;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_578> AgradCdfLogExpModNormal_ffv_578;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_579> AgradCdfLogExpModNormal_ffv_579;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_580> AgradCdfLogExpModNormal_ffv_580;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_581> AgradCdfLogExpModNormal_ffv_581;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_582> AgradCdfLogExpModNormal_ffv_582;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_583> AgradCdfLogExpModNormal_ffv_583;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_584> AgradCdfLogExpModNormal_ffv_584;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_585> AgradCdfLogExpModNormal_ffv_585;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_586> AgradCdfLogExpModNormal_ffv_586;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_587> AgradCdfLogExpModNormal_ffv_587;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_588> AgradCdfLogExpModNormal_ffv_588;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_589> AgradCdfLogExpModNormal_ffv_589;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_590> AgradCdfLogExpModNormal_ffv_590;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_591> AgradCdfLogExpModNormal_ffv_591;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_592> AgradCdfLogExpModNormal_ffv_592;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_593> AgradCdfLogExpModNormal_ffv_593;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_594> AgradCdfLogExpModNormal_ffv_594;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_595> AgradCdfLogExpModNormal_ffv_595;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_596> AgradCdfLogExpModNormal_ffv_596;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_597> AgradCdfLogExpModNormal_ffv_597;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_598> AgradCdfLogExpModNormal_ffv_598;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_599> AgradCdfLogExpModNormal_ffv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_500, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_501, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_502, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_503, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_504, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_505, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_506, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_507, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_508, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_509, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_510, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_511, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_512, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_513, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_514, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_515, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_516, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_517, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_518, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_519, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_520, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_521, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_522, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_523, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_524, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_525, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_526, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_527, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_528, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_529, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_530, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_531, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_532, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_533, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_534, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_535, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_536, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_537, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_538, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_539, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_540, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_541, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_542, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_543, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_544, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_545, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_546, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_547, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_548, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_549, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_550, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_551, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_552, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_553, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_554, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_555, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_556, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_557, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_558, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_559, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_560, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_561, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_562, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_563, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_564, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_565, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_566, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_567, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_568, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_569, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_570, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_571, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_572, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_573, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_574, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_575, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_576, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_577, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_578, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_579, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_580, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_581, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_582, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_583, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_584, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_585, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_586, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_587, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_588, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_589, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_590, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_591, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_592, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_593, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_594, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_595, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_596, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_597, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_598, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_599, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_599);
+
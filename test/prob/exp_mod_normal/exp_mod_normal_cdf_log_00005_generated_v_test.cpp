@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_500> AgradCdfLogExpModNormal_v_500;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_501> AgradCdfLogExpModNormal_v_501;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_502> AgradCdfLogExpModNormal_v_502;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_503> AgradCdfLogExpModNormal_v_503;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_504> AgradCdfLogExpModNormal_v_504;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_505> AgradCdfLogExpModNormal_v_505;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_506> AgradCdfLogExpModNormal_v_506;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_507> AgradCdfLogExpModNormal_v_507;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_508> AgradCdfLogExpModNormal_v_508;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_509> AgradCdfLogExpModNormal_v_509;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_510> AgradCdfLogExpModNormal_v_510;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_511> AgradCdfLogExpModNormal_v_511;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_512> AgradCdfLogExpModNormal_v_512;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_513> AgradCdfLogExpModNormal_v_513;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_514> AgradCdfLogExpModNormal_v_514;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_515> AgradCdfLogExpModNormal_v_515;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_516> AgradCdfLogExpModNormal_v_516;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_517> AgradCdfLogExpModNormal_v_517;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_518> AgradCdfLogExpModNormal_v_518;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_519> AgradCdfLogExpModNormal_v_519;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_520> AgradCdfLogExpModNormal_v_520;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_521> AgradCdfLogExpModNormal_v_521;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_522> AgradCdfLogExpModNormal_v_522;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_523> AgradCdfLogExpModNormal_v_523;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_524> AgradCdfLogExpModNormal_v_524;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_525> AgradCdfLogExpModNormal_v_525;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_526> AgradCdfLogExpModNormal_v_526;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_527> AgradCdfLogExpModNormal_v_527;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_528> AgradCdfLogExpModNormal_v_528;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_529> AgradCdfLogExpModNormal_v_529;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_530> AgradCdfLogExpModNormal_v_530;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_531> AgradCdfLogExpModNormal_v_531;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_532> AgradCdfLogExpModNormal_v_532;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_533> AgradCdfLogExpModNormal_v_533;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_534> AgradCdfLogExpModNormal_v_534;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_535> AgradCdfLogExpModNormal_v_535;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_536> AgradCdfLogExpModNormal_v_536;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_537> AgradCdfLogExpModNormal_v_537;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_538> AgradCdfLogExpModNormal_v_538;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_539> AgradCdfLogExpModNormal_v_539;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_540> AgradCdfLogExpModNormal_v_540;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_541> AgradCdfLogExpModNormal_v_541;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_542> AgradCdfLogExpModNormal_v_542;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_543> AgradCdfLogExpModNormal_v_543;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_544> AgradCdfLogExpModNormal_v_544;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_545> AgradCdfLogExpModNormal_v_545;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_546> AgradCdfLogExpModNormal_v_546;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_547> AgradCdfLogExpModNormal_v_547;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_548> AgradCdfLogExpModNormal_v_548;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_549> AgradCdfLogExpModNormal_v_549;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_550> AgradCdfLogExpModNormal_v_550;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_551> AgradCdfLogExpModNormal_v_551;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_552> AgradCdfLogExpModNormal_v_552;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_553> AgradCdfLogExpModNormal_v_553;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_554> AgradCdfLogExpModNormal_v_554;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_555> AgradCdfLogExpModNormal_v_555;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_556> AgradCdfLogExpModNormal_v_556;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_557> AgradCdfLogExpModNormal_v_557;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_558> AgradCdfLogExpModNormal_v_558;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_559> AgradCdfLogExpModNormal_v_559;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_560> AgradCdfLogExpModNormal_v_560;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_561> AgradCdfLogExpModNormal_v_561;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_562> AgradCdfLogExpModNormal_v_562;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_563> AgradCdfLogExpModNormal_v_563;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_564> AgradCdfLogExpModNormal_v_564;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_565> AgradCdfLogExpModNormal_v_565;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_566> AgradCdfLogExpModNormal_v_566;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_567> AgradCdfLogExpModNormal_v_567;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_568> AgradCdfLogExpModNormal_v_568;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_569> AgradCdfLogExpModNormal_v_569;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_570> AgradCdfLogExpModNormal_v_570;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_571> AgradCdfLogExpModNormal_v_571;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_572> AgradCdfLogExpModNormal_v_572;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_573> AgradCdfLogExpModNormal_v_573;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_574> AgradCdfLogExpModNormal_v_574;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_575> AgradCdfLogExpModNormal_v_575;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_576> AgradCdfLogExpModNormal_v_576;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_577> AgradCdfLogExpModNormal_v_577;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_578> AgradCdfLogExpModNormal_v_578;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_579> AgradCdfLogExpModNormal_v_579;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_580> AgradCdfLogExpModNormal_v_580;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_581> AgradCdfLogExpModNormal_v_581;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_582> AgradCdfLogExpModNormal_v_582;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_583> AgradCdfLogExpModNormal_v_583;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_584> AgradCdfLogExpModNormal_v_584;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_585> AgradCdfLogExpModNormal_v_585;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_586> AgradCdfLogExpModNormal_v_586;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_587> AgradCdfLogExpModNormal_v_587;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_588> AgradCdfLogExpModNormal_v_588;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_589> AgradCdfLogExpModNormal_v_589;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_590> AgradCdfLogExpModNormal_v_590;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_591> AgradCdfLogExpModNormal_v_591;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_592> AgradCdfLogExpModNormal_v_592;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_593> AgradCdfLogExpModNormal_v_593;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_594> AgradCdfLogExpModNormal_v_594;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_595> AgradCdfLogExpModNormal_v_595;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_596> AgradCdfLogExpModNormal_v_596;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_597> AgradCdfLogExpModNormal_v_597;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_598> AgradCdfLogExpModNormal_v_598;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_599> AgradCdfLogExpModNormal_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_500, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_501, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_502, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_503, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_504, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_505, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_506, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_507, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_508, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_509, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_510, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_511, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_512, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_513, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_514, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_515, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_516, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_517, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_518, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_519, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_520, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_521, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_522, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_523, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_524, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_525, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_526, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_527, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_528, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_529, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_530, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_531, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_532, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_533, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_534, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_535, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_536, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_537, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_538, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_539, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_540, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_541, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_542, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_543, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_544, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_545, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_546, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_547, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_548, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_549, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_550, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_551, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_552, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_553, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_554, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_555, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_556, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_557, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_558, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_559, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_560, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_561, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_562, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_563, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_564, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_565, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_566, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_567, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_568, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_569, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_570, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_571, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_572, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_573, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_574, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_575, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_576, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_577, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_578, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_579, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_580, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_581, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_582, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_583, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_584, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_585, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_586, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_587, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_588, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_589, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_590, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_591, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_592, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_593, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_594, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_595, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_596, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_597, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_598, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_599, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_599);
+
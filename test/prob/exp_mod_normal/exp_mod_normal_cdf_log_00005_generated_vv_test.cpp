@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+typedef std::tuple<var, double, double, double, empty, empty> type_vv_567;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_vv_568;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_569;
+typedef std::tuple<var, double, double, var, empty, empty> type_vv_570;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_vv_571;
+typedef std::tuple<var, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_572;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_vv_573;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_574;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_575;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_vv_576;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_577;
+typedef std::tuple<var, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_578;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_579;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_580;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_581;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_582;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_583;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_584;
+typedef std::tuple<var, double, var, double, empty, empty> type_vv_585;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_vv_586;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_587;
+typedef std::tuple<var, double, var, var, empty, empty> type_vv_588;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_vv_589;
+typedef std::tuple<var, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_590;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_vv_591;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_592;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_593;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_vv_594;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_595;
+typedef std::tuple<var, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_596;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_597;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_598;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_599;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_500> AgradCdfLogExpModNormal_vv_500;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_501> AgradCdfLogExpModNormal_vv_501;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_502> AgradCdfLogExpModNormal_vv_502;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_503> AgradCdfLogExpModNormal_vv_503;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_504> AgradCdfLogExpModNormal_vv_504;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_505> AgradCdfLogExpModNormal_vv_505;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_506> AgradCdfLogExpModNormal_vv_506;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_507> AgradCdfLogExpModNormal_vv_507;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_508> AgradCdfLogExpModNormal_vv_508;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_509> AgradCdfLogExpModNormal_vv_509;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_510> AgradCdfLogExpModNormal_vv_510;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_511> AgradCdfLogExpModNormal_vv_511;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_512> AgradCdfLogExpModNormal_vv_512;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_513> AgradCdfLogExpModNormal_vv_513;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_514> AgradCdfLogExpModNormal_vv_514;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_515> AgradCdfLogExpModNormal_vv_515;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_516> AgradCdfLogExpModNormal_vv_516;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_517> AgradCdfLogExpModNormal_vv_517;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_518> AgradCdfLogExpModNormal_vv_518;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_519> AgradCdfLogExpModNormal_vv_519;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_520> AgradCdfLogExpModNormal_vv_520;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_521> AgradCdfLogExpModNormal_vv_521;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_522> AgradCdfLogExpModNormal_vv_522;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_523> AgradCdfLogExpModNormal_vv_523;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_524> AgradCdfLogExpModNormal_vv_524;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_525> AgradCdfLogExpModNormal_vv_525;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_526> AgradCdfLogExpModNormal_vv_526;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_527> AgradCdfLogExpModNormal_vv_527;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_528> AgradCdfLogExpModNormal_vv_528;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_529> AgradCdfLogExpModNormal_vv_529;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_530> AgradCdfLogExpModNormal_vv_530;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_531> AgradCdfLogExpModNormal_vv_531;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_532> AgradCdfLogExpModNormal_vv_532;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_533> AgradCdfLogExpModNormal_vv_533;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_534> AgradCdfLogExpModNormal_vv_534;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_535> AgradCdfLogExpModNormal_vv_535;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_536> AgradCdfLogExpModNormal_vv_536;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_537> AgradCdfLogExpModNormal_vv_537;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_538> AgradCdfLogExpModNormal_vv_538;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_539> AgradCdfLogExpModNormal_vv_539;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_540> AgradCdfLogExpModNormal_vv_540;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_541> AgradCdfLogExpModNormal_vv_541;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_542> AgradCdfLogExpModNormal_vv_542;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_543> AgradCdfLogExpModNormal_vv_543;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_544> AgradCdfLogExpModNormal_vv_544;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_545> AgradCdfLogExpModNormal_vv_545;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_546> AgradCdfLogExpModNormal_vv_546;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_547> AgradCdfLogExpModNormal_vv_547;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_548> AgradCdfLogExpModNormal_vv_548;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_549> AgradCdfLogExpModNormal_vv_549;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_550> AgradCdfLogExpModNormal_vv_550;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_551> AgradCdfLogExpModNormal_vv_551;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_552> AgradCdfLogExpModNormal_vv_552;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_553> AgradCdfLogExpModNormal_vv_553;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_554> AgradCdfLogExpModNormal_vv_554;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_555> AgradCdfLogExpModNormal_vv_555;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_556> AgradCdfLogExpModNormal_vv_556;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_557> AgradCdfLogExpModNormal_vv_557;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_558> AgradCdfLogExpModNormal_vv_558;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_559> AgradCdfLogExpModNormal_vv_559;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_560> AgradCdfLogExpModNormal_vv_560;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_561> AgradCdfLogExpModNormal_vv_561;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_562> AgradCdfLogExpModNormal_vv_562;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_563> AgradCdfLogExpModNormal_vv_563;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_564> AgradCdfLogExpModNormal_vv_564;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_565> AgradCdfLogExpModNormal_vv_565;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_566> AgradCdfLogExpModNormal_vv_566;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_567> AgradCdfLogExpModNormal_vv_567;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_568> AgradCdfLogExpModNormal_vv_568;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_569> AgradCdfLogExpModNormal_vv_569;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_570> AgradCdfLogExpModNormal_vv_570;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_571> AgradCdfLogExpModNormal_vv_571;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_572> AgradCdfLogExpModNormal_vv_572;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_573> AgradCdfLogExpModNormal_vv_573;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_574> AgradCdfLogExpModNormal_vv_574;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_575> AgradCdfLogExpModNormal_vv_575;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_576> AgradCdfLogExpModNormal_vv_576;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_577> AgradCdfLogExpModNormal_vv_577;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_578> AgradCdfLogExpModNormal_vv_578;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_579> AgradCdfLogExpModNormal_vv_579;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_580> AgradCdfLogExpModNormal_vv_580;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_581> AgradCdfLogExpModNormal_vv_581;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_582> AgradCdfLogExpModNormal_vv_582;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_583> AgradCdfLogExpModNormal_vv_583;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_584> AgradCdfLogExpModNormal_vv_584;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_585> AgradCdfLogExpModNormal_vv_585;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_586> AgradCdfLogExpModNormal_vv_586;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_587> AgradCdfLogExpModNormal_vv_587;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_588> AgradCdfLogExpModNormal_vv_588;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_589> AgradCdfLogExpModNormal_vv_589;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_590> AgradCdfLogExpModNormal_vv_590;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_591> AgradCdfLogExpModNormal_vv_591;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_592> AgradCdfLogExpModNormal_vv_592;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_593> AgradCdfLogExpModNormal_vv_593;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_594> AgradCdfLogExpModNormal_vv_594;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_595> AgradCdfLogExpModNormal_vv_595;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_596> AgradCdfLogExpModNormal_vv_596;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_597> AgradCdfLogExpModNormal_vv_597;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_598> AgradCdfLogExpModNormal_vv_598;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_599> AgradCdfLogExpModNormal_vv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_500, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_501, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_502, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_503, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_504, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_505, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_506, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_507, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_508, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_509, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_510, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_511, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_512, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_513, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_514, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_515, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_516, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_517, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_518, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_519, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_520, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_521, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_522, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_523, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_524, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_525, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_526, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_527, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_528, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_529, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_530, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_531, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_532, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_533, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_534, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_535, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_536, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_537, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_538, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_539, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_540, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_541, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_542, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_543, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_544, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_545, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_546, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_547, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_548, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_549, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_550, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_551, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_552, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_553, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_554, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_555, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_556, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_557, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_558, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_559, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_560, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_561, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_562, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_563, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_564, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_565, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_566, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_567, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_568, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_569, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_570, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_571, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_572, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_573, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_574, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_575, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_576, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_577, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_578, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_579, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_580, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_581, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_582, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_583, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_584, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_585, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_586, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_587, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_588, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_589, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_590, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_591, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_592, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_593, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_594, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_595, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_596, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_597, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_598, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_599, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_599);
+
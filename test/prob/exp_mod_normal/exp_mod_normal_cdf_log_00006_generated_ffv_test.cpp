@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_600;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_601;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_602;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, double, empty, empty> type_ffv_603;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_604;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_605;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_606;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_607;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_608;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_609;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_610;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_611;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_612;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_613;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_614;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_615;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_616;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_617;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_618;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_619;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_620;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_621;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_622;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_623;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_624;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_625;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_626;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_627;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_628;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_629;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_630;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_631;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_632;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_633;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_634;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_635;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_636;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_637;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_638;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_639;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_640;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_641;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_642;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_643;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_644;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_645;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_646;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_647;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_648;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_649;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_650;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_651;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_652;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_653;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_654;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_655;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_656;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_657;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_658;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_659;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_660;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_661;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_662;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_663;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_664;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_665;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_666;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_667;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_668;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_669;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_670;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_671;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_672;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_673;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_674;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, double, empty, empty> type_ffv_675;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_676;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_677;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_678;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_679;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_680;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_681;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_682;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_683;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_684;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_685;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_686;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_687;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_688;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_689;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_690;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_691;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_692;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_693;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_694;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_695;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_696;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_697;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_698;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_699;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_600> AgradCdfLogExpModNormal_ffv_600;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_601> AgradCdfLogExpModNormal_ffv_601;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_602> AgradCdfLogExpModNormal_ffv_602;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_603> AgradCdfLogExpModNormal_ffv_603;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_604> AgradCdfLogExpModNormal_ffv_604;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_605> AgradCdfLogExpModNormal_ffv_605;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_606> AgradCdfLogExpModNormal_ffv_606;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_607> AgradCdfLogExpModNormal_ffv_607;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_608> AgradCdfLogExpModNormal_ffv_608;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_609> AgradCdfLogExpModNormal_ffv_609;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_610> AgradCdfLogExpModNormal_ffv_610;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_611> AgradCdfLogExpModNormal_ffv_611;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_612> AgradCdfLogExpModNormal_ffv_612;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_613> AgradCdfLogExpModNormal_ffv_613;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_614> AgradCdfLogExpModNormal_ffv_614;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_615> AgradCdfLogExpModNormal_ffv_615;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_616> AgradCdfLogExpModNormal_ffv_616;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_617> AgradCdfLogExpModNormal_ffv_617;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_618> AgradCdfLogExpModNormal_ffv_618;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_619> AgradCdfLogExpModNormal_ffv_619;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_620> AgradCdfLogExpModNormal_ffv_620;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_621> AgradCdfLogExpModNormal_ffv_621;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_622> AgradCdfLogExpModNormal_ffv_622;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_623> AgradCdfLogExpModNormal_ffv_623;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_624> AgradCdfLogExpModNormal_ffv_624;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_625> AgradCdfLogExpModNormal_ffv_625;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_626> AgradCdfLogExpModNormal_ffv_626;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_627> AgradCdfLogExpModNormal_ffv_627;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_628> AgradCdfLogExpModNormal_ffv_628;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_629> AgradCdfLogExpModNormal_ffv_629;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_630> AgradCdfLogExpModNormal_ffv_630;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_631> AgradCdfLogExpModNormal_ffv_631;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_632> AgradCdfLogExpModNormal_ffv_632;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_633> AgradCdfLogExpModNormal_ffv_633;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_634> AgradCdfLogExpModNormal_ffv_634;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_635> AgradCdfLogExpModNormal_ffv_635;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_636> AgradCdfLogExpModNormal_ffv_636;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_637> AgradCdfLogExpModNormal_ffv_637;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_638> AgradCdfLogExpModNormal_ffv_638;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_639> AgradCdfLogExpModNormal_ffv_639;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_640> AgradCdfLogExpModNormal_ffv_640;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_641> AgradCdfLogExpModNormal_ffv_641;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_642> AgradCdfLogExpModNormal_ffv_642;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_643> AgradCdfLogExpModNormal_ffv_643;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_644> AgradCdfLogExpModNormal_ffv_644;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_645> AgradCdfLogExpModNormal_ffv_645;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_646> AgradCdfLogExpModNormal_ffv_646;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_647> AgradCdfLogExpModNormal_ffv_647;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_648> AgradCdfLogExpModNormal_ffv_648;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_649> AgradCdfLogExpModNormal_ffv_649;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_650> AgradCdfLogExpModNormal_ffv_650;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_651> AgradCdfLogExpModNormal_ffv_651;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_652> AgradCdfLogExpModNormal_ffv_652;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_653> AgradCdfLogExpModNormal_ffv_653;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_654> AgradCdfLogExpModNormal_ffv_654;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_655> AgradCdfLogExpModNormal_ffv_655;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_656> AgradCdfLogExpModNormal_ffv_656;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_657> AgradCdfLogExpModNormal_ffv_657;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_658> AgradCdfLogExpModNormal_ffv_658;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_659> AgradCdfLogExpModNormal_ffv_659;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_660> AgradCdfLogExpModNormal_ffv_660;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_661> AgradCdfLogExpModNormal_ffv_661;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_662> AgradCdfLogExpModNormal_ffv_662;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_663> AgradCdfLogExpModNormal_ffv_663;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_664> AgradCdfLogExpModNormal_ffv_664;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_665> AgradCdfLogExpModNormal_ffv_665;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_666> AgradCdfLogExpModNormal_ffv_666;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_667> AgradCdfLogExpModNormal_ffv_667;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_668> AgradCdfLogExpModNormal_ffv_668;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_669> AgradCdfLogExpModNormal_ffv_669;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_670> AgradCdfLogExpModNormal_ffv_670;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_671> AgradCdfLogExpModNormal_ffv_671;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_672> AgradCdfLogExpModNormal_ffv_672;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_673> AgradCdfLogExpModNormal_ffv_673;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_674> AgradCdfLogExpModNormal_ffv_674;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_675> AgradCdfLogExpModNormal_ffv_675;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_676> AgradCdfLogExpModNormal_ffv_676;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_677> AgradCdfLogExpModNormal_ffv_677;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_678> AgradCdfLogExpModNormal_ffv_678;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_679> AgradCdfLogExpModNormal_ffv_679;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_680> AgradCdfLogExpModNormal_ffv_680;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_681> AgradCdfLogExpModNormal_ffv_681;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_682> AgradCdfLogExpModNormal_ffv_682;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_683> AgradCdfLogExpModNormal_ffv_683;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_684> AgradCdfLogExpModNormal_ffv_684;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_685> AgradCdfLogExpModNormal_ffv_685;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_686> AgradCdfLogExpModNormal_ffv_686;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_687> AgradCdfLogExpModNormal_ffv_687;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_688> AgradCdfLogExpModNormal_ffv_688;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_689> AgradCdfLogExpModNormal_ffv_689;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_690> AgradCdfLogExpModNormal_ffv_690;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_691> AgradCdfLogExpModNormal_ffv_691;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_692> AgradCdfLogExpModNormal_ffv_692;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_693> AgradCdfLogExpModNormal_ffv_693;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_694> AgradCdfLogExpModNormal_ffv_694;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_695> AgradCdfLogExpModNormal_ffv_695;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_696> AgradCdfLogExpModNormal_ffv_696;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_697> AgradCdfLogExpModNormal_ffv_697;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_698> AgradCdfLogExpModNormal_ffv_698;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_699> AgradCdfLogExpModNormal_ffv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_600, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_601, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_602, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_603, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_604, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_605, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_606, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_607, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_608, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_609, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_610, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_611, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_612, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_613, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_614, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_615, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_616, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_617, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_618, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_619, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_620, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_621, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_622, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_623, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_624, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_625, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_626, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_627, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_628, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_629, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_630, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_631, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_632, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_633, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_634, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_635, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_636, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_637, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_638, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_639, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_640, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_641, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_642, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_643, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_644, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_645, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_646, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_647, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_648, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_649, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_650, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_651, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_652, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_653, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_654, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_655, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_656, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_657, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_658, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_659, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_660, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_661, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_662, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_663, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_664, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_665, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_666, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_667, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_668, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_669, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_670, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_671, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_672, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_673, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_674, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_675, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_676, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_677, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_678, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_679, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_680, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_681, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_682, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_683, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_684, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_685, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_686, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_687, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_688, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_689, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_690, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_691, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_692, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_693, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_694, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_695, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_696, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_697, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_698, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_699, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+typedef std::tuple<var, double, double, double, empty, empty> type_v_648;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_v_649;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_650;
+typedef std::tuple<var, double, double, var, empty, empty> type_v_651;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_v_652;
+typedef std::tuple<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_653;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_v_654;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_v_655;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_656;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_v_657;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_v_658;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_659;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_660;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_661;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_662;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_663;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_664;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_665;
+typedef std::tuple<var, double, var, double, empty, empty> type_v_666;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_v_667;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_668;
+typedef std::tuple<var, double, var, var, empty, empty> type_v_669;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_v_670;
+typedef std::tuple<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_671;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_v_672;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_v_673;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_674;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_v_675;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_v_676;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_677;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_678;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_679;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_680;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_681;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_682;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_683;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_v_684;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_v_685;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_686;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_v_687;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_v_688;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_689;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_v_690;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_691;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_692;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_v_693;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_694;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_695;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_696;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_697;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_698;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_699;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_600> AgradCdfLogExpModNormal_v_600;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_601> AgradCdfLogExpModNormal_v_601;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_602> AgradCdfLogExpModNormal_v_602;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_603> AgradCdfLogExpModNormal_v_603;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_604> AgradCdfLogExpModNormal_v_604;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_605> AgradCdfLogExpModNormal_v_605;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_606> AgradCdfLogExpModNormal_v_606;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_607> AgradCdfLogExpModNormal_v_607;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_608> AgradCdfLogExpModNormal_v_608;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_609> AgradCdfLogExpModNormal_v_609;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_610> AgradCdfLogExpModNormal_v_610;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_611> AgradCdfLogExpModNormal_v_611;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_612> AgradCdfLogExpModNormal_v_612;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_613> AgradCdfLogExpModNormal_v_613;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_614> AgradCdfLogExpModNormal_v_614;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_615> AgradCdfLogExpModNormal_v_615;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_616> AgradCdfLogExpModNormal_v_616;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_617> AgradCdfLogExpModNormal_v_617;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_618> AgradCdfLogExpModNormal_v_618;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_619> AgradCdfLogExpModNormal_v_619;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_620> AgradCdfLogExpModNormal_v_620;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_621> AgradCdfLogExpModNormal_v_621;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_622> AgradCdfLogExpModNormal_v_622;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_623> AgradCdfLogExpModNormal_v_623;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_624> AgradCdfLogExpModNormal_v_624;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_625> AgradCdfLogExpModNormal_v_625;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_626> AgradCdfLogExpModNormal_v_626;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_627> AgradCdfLogExpModNormal_v_627;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_628> AgradCdfLogExpModNormal_v_628;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_629> AgradCdfLogExpModNormal_v_629;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_630> AgradCdfLogExpModNormal_v_630;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_631> AgradCdfLogExpModNormal_v_631;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_632> AgradCdfLogExpModNormal_v_632;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_633> AgradCdfLogExpModNormal_v_633;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_634> AgradCdfLogExpModNormal_v_634;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_635> AgradCdfLogExpModNormal_v_635;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_636> AgradCdfLogExpModNormal_v_636;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_637> AgradCdfLogExpModNormal_v_637;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_638> AgradCdfLogExpModNormal_v_638;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_639> AgradCdfLogExpModNormal_v_639;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_640> AgradCdfLogExpModNormal_v_640;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_641> AgradCdfLogExpModNormal_v_641;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_642> AgradCdfLogExpModNormal_v_642;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_643> AgradCdfLogExpModNormal_v_643;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_644> AgradCdfLogExpModNormal_v_644;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_645> AgradCdfLogExpModNormal_v_645;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_646> AgradCdfLogExpModNormal_v_646;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_647> AgradCdfLogExpModNormal_v_647;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_648> AgradCdfLogExpModNormal_v_648;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_649> AgradCdfLogExpModNormal_v_649;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_650> AgradCdfLogExpModNormal_v_650;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_651> AgradCdfLogExpModNormal_v_651;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_652> AgradCdfLogExpModNormal_v_652;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_653> AgradCdfLogExpModNormal_v_653;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_654> AgradCdfLogExpModNormal_v_654;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_655> AgradCdfLogExpModNormal_v_655;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_656> AgradCdfLogExpModNormal_v_656;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_657> AgradCdfLogExpModNormal_v_657;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_658> AgradCdfLogExpModNormal_v_658;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_659> AgradCdfLogExpModNormal_v_659;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_660> AgradCdfLogExpModNormal_v_660;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_661> AgradCdfLogExpModNormal_v_661;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_662> AgradCdfLogExpModNormal_v_662;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_663> AgradCdfLogExpModNormal_v_663;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_664> AgradCdfLogExpModNormal_v_664;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_665> AgradCdfLogExpModNormal_v_665;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_666> AgradCdfLogExpModNormal_v_666;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_667> AgradCdfLogExpModNormal_v_667;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_668> AgradCdfLogExpModNormal_v_668;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_669> AgradCdfLogExpModNormal_v_669;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_670> AgradCdfLogExpModNormal_v_670;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_671> AgradCdfLogExpModNormal_v_671;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_672> AgradCdfLogExpModNormal_v_672;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_673> AgradCdfLogExpModNormal_v_673;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_674> AgradCdfLogExpModNormal_v_674;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_675> AgradCdfLogExpModNormal_v_675;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_676> AgradCdfLogExpModNormal_v_676;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_677> AgradCdfLogExpModNormal_v_677;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_678> AgradCdfLogExpModNormal_v_678;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_679> AgradCdfLogExpModNormal_v_679;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_680> AgradCdfLogExpModNormal_v_680;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_681> AgradCdfLogExpModNormal_v_681;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_682> AgradCdfLogExpModNormal_v_682;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_683> AgradCdfLogExpModNormal_v_683;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_684> AgradCdfLogExpModNormal_v_684;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_685> AgradCdfLogExpModNormal_v_685;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_686> AgradCdfLogExpModNormal_v_686;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_687> AgradCdfLogExpModNormal_v_687;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_688> AgradCdfLogExpModNormal_v_688;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_689> AgradCdfLogExpModNormal_v_689;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_690> AgradCdfLogExpModNormal_v_690;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_691> AgradCdfLogExpModNormal_v_691;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_692> AgradCdfLogExpModNormal_v_692;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_693> AgradCdfLogExpModNormal_v_693;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_694> AgradCdfLogExpModNormal_v_694;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_695> AgradCdfLogExpModNormal_v_695;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_696> AgradCdfLogExpModNormal_v_696;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_697> AgradCdfLogExpModNormal_v_697;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_698> AgradCdfLogExpModNormal_v_698;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_699> AgradCdfLogExpModNormal_v_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_600, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_601, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_602, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_603, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_604, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_605, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_606, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_607, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_608, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_609, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_610, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_611, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_612, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_613, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_614, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_615, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_616, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_617, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_618, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_619, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_620, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_621, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_622, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_623, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_624, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_625, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_626, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_627, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_628, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_629, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_630, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_631, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_632, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_633, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_634, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_635, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_636, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_637, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_638, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_639, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_640, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_641, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_642, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_643, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_644, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_645, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_646, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_647, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_648, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_649, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_650, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_651, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_652, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_653, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_654, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_655, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_656, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_657, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_658, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_659, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_660, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_661, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_662, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_663, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_664, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_665, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_666, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_667, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_668, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_669, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_670, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_671, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_672, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_673, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_674, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_675, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_676, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_677, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_678, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_679, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_680, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_681, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_682, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_683, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_684, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_685, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_686, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_687, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_688, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_689, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_690, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_691, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_692, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_693, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_694, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_695, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_696, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_697, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_698, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_699, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_600;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_601;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_602;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_vv_603;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_604;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_605;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_vv_606;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_607;
+typedef std::tuple<var, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_608;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_609;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_610;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_611;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_612;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_613;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_614;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_615;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_616;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_617;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_618;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_619;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_620;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_vv_621;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_622;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_623;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_vv_624;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_625;
+typedef std::tuple<var, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_626;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_627;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_628;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_629;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_630;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_631;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_632;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_633;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_634;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_635;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_636;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_637;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_638;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_639;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_640;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_641;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_642;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_643;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_644;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_645;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_646;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_647;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_648;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_649;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_650;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_651;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_652;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_653;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_654;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_655;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_656;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_657;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_658;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_659;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_660;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_661;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_662;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_663;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_664;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_665;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_666;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_667;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_668;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_669;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_670;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_671;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_672;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_673;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_674;
+typedef std::tuple<var, var, double, double, empty, empty> type_vv_675;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_vv_676;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_677;
+typedef std::tuple<var, var, double, var, empty, empty> type_vv_678;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_vv_679;
+typedef std::tuple<var, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_680;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_vv_681;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_682;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_683;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_vv_684;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_685;
+typedef std::tuple<var, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_686;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_687;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_688;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_689;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_690;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_691;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_692;
+typedef std::tuple<var, var, var, double, empty, empty> type_vv_693;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_vv_694;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_695;
+typedef std::tuple<var, var, var, var, empty, empty> type_vv_696;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_vv_697;
+typedef std::tuple<var, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_698;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_vv_699;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_600> AgradCdfLogExpModNormal_vv_600;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_601> AgradCdfLogExpModNormal_vv_601;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_602> AgradCdfLogExpModNormal_vv_602;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_603> AgradCdfLogExpModNormal_vv_603;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_604> AgradCdfLogExpModNormal_vv_604;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_605> AgradCdfLogExpModNormal_vv_605;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_606> AgradCdfLogExpModNormal_vv_606;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_607> AgradCdfLogExpModNormal_vv_607;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_608> AgradCdfLogExpModNormal_vv_608;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_609> AgradCdfLogExpModNormal_vv_609;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_610> AgradCdfLogExpModNormal_vv_610;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_611> AgradCdfLogExpModNormal_vv_611;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_612> AgradCdfLogExpModNormal_vv_612;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_613> AgradCdfLogExpModNormal_vv_613;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_614> AgradCdfLogExpModNormal_vv_614;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_615> AgradCdfLogExpModNormal_vv_615;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_616> AgradCdfLogExpModNormal_vv_616;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_617> AgradCdfLogExpModNormal_vv_617;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_618> AgradCdfLogExpModNormal_vv_618;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_619> AgradCdfLogExpModNormal_vv_619;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_620> AgradCdfLogExpModNormal_vv_620;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_621> AgradCdfLogExpModNormal_vv_621;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_622> AgradCdfLogExpModNormal_vv_622;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_623> AgradCdfLogExpModNormal_vv_623;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_624> AgradCdfLogExpModNormal_vv_624;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_625> AgradCdfLogExpModNormal_vv_625;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_626> AgradCdfLogExpModNormal_vv_626;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_627> AgradCdfLogExpModNormal_vv_627;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_628> AgradCdfLogExpModNormal_vv_628;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_629> AgradCdfLogExpModNormal_vv_629;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_630> AgradCdfLogExpModNormal_vv_630;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_631> AgradCdfLogExpModNormal_vv_631;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_632> AgradCdfLogExpModNormal_vv_632;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_633> AgradCdfLogExpModNormal_vv_633;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_634> AgradCdfLogExpModNormal_vv_634;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_635> AgradCdfLogExpModNormal_vv_635;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_636> AgradCdfLogExpModNormal_vv_636;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_637> AgradCdfLogExpModNormal_vv_637;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_638> AgradCdfLogExpModNormal_vv_638;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_639> AgradCdfLogExpModNormal_vv_639;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_640> AgradCdfLogExpModNormal_vv_640;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_641> AgradCdfLogExpModNormal_vv_641;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_642> AgradCdfLogExpModNormal_vv_642;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_643> AgradCdfLogExpModNormal_vv_643;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_644> AgradCdfLogExpModNormal_vv_644;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_645> AgradCdfLogExpModNormal_vv_645;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_646> AgradCdfLogExpModNormal_vv_646;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_647> AgradCdfLogExpModNormal_vv_647;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_648> AgradCdfLogExpModNormal_vv_648;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_649> AgradCdfLogExpModNormal_vv_649;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_650> AgradCdfLogExpModNormal_vv_650;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_651> AgradCdfLogExpModNormal_vv_651;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_652> AgradCdfLogExpModNormal_vv_652;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_653> AgradCdfLogExpModNormal_vv_653;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_654> AgradCdfLogExpModNormal_vv_654;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_655> AgradCdfLogExpModNormal_vv_655;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_656> AgradCdfLogExpModNormal_vv_656;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_657> AgradCdfLogExpModNormal_vv_657;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_658> AgradCdfLogExpModNormal_vv_658;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_659> AgradCdfLogExpModNormal_vv_659;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_660> AgradCdfLogExpModNormal_vv_660;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_661> AgradCdfLogExpModNormal_vv_661;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_662> AgradCdfLogExpModNormal_vv_662;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_663> AgradCdfLogExpModNormal_vv_663;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_664> AgradCdfLogExpModNormal_vv_664;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_665> AgradCdfLogExpModNormal_vv_665;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_666> AgradCdfLogExpModNormal_vv_666;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_667> AgradCdfLogExpModNormal_vv_667;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_668> AgradCdfLogExpModNormal_vv_668;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_669> AgradCdfLogExpModNormal_vv_669;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_670> AgradCdfLogExpModNormal_vv_670;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_671> AgradCdfLogExpModNormal_vv_671;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_672> AgradCdfLogExpModNormal_vv_672;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_673> AgradCdfLogExpModNormal_vv_673;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_674> AgradCdfLogExpModNormal_vv_674;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_675> AgradCdfLogExpModNormal_vv_675;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_676> AgradCdfLogExpModNormal_vv_676;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_677> AgradCdfLogExpModNormal_vv_677;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_678> AgradCdfLogExpModNormal_vv_678;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_679> AgradCdfLogExpModNormal_vv_679;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_680> AgradCdfLogExpModNormal_vv_680;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_681> AgradCdfLogExpModNormal_vv_681;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_682> AgradCdfLogExpModNormal_vv_682;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_683> AgradCdfLogExpModNormal_vv_683;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_684> AgradCdfLogExpModNormal_vv_684;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_685> AgradCdfLogExpModNormal_vv_685;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_686> AgradCdfLogExpModNormal_vv_686;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_687> AgradCdfLogExpModNormal_vv_687;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_688> AgradCdfLogExpModNormal_vv_688;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_689> AgradCdfLogExpModNormal_vv_689;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_690> AgradCdfLogExpModNormal_vv_690;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_691> AgradCdfLogExpModNormal_vv_691;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_692> AgradCdfLogExpModNormal_vv_692;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_693> AgradCdfLogExpModNormal_vv_693;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_694> AgradCdfLogExpModNormal_vv_694;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_695> AgradCdfLogExpModNormal_vv_695;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_696> AgradCdfLogExpModNormal_vv_696;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_697> AgradCdfLogExpModNormal_vv_697;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_698> AgradCdfLogExpModNormal_vv_698;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_699> AgradCdfLogExpModNormal_vv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_600, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_601, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_602, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_603, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_604, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_605, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_606, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_607, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_608, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_609, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_610, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_611, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_612, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_613, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_614, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_615, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_616, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_617, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_618, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_619, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_620, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_621, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_622, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_623, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_624, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_625, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_626, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_627, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_628, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_629, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_630, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_631, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_632, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_633, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_634, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_635, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_636, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_637, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_638, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_639, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_640, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_641, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_642, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_643, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_644, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_645, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_646, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_647, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_648, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_649, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_650, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_651, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_652, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_653, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_654, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_655, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_656, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_657, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_658, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_659, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_660, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_661, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_662, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_663, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_664, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_665, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_666, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_667, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_668, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_669, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_670, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_671, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_672, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_673, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_674, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_675, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_676, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_677, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_678, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_679, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_680, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_681, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_682, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_683, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_684, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_685, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_686, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_687, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_688, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_689, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_690, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_691, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_692, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_693, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_694, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_695, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_696, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_697, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_698, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_699, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_700;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_701;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_702;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_703;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_704;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_705;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_706;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_707;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_708;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_709;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_710;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_711;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_712;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_713;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_714;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_715;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_716;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_717;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_718;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_719;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_720;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_721;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_722;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_723;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_724;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_725;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_726;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_727;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_728;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_729;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_730;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_731;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_732;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_733;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_734;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_735;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_736;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_737;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_738;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_739;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_740;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_741;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_742;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_743;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_744;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_745;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_746;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_747;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_748;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_749;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_750;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_751;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_752;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_753;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_754;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_755;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_756;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_757;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_758;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_759;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_760;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_761;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_762;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_763;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_764;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_765;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_766;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_767;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_768;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_769;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_770;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_771;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_772;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_773;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_774;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_775;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_776;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_777;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_778;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_779;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_780;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_781;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_782;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, double, empty, empty> type_ffv_783;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty, empty> type_ffv_784;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_785;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_786;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_787;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_788;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty, empty> type_ffv_789;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_790;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_791;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_792;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_793;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_794;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_795;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_796;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_797;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_798;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_799;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_700> AgradCdfLogExpModNormal_ffv_700;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_701> AgradCdfLogExpModNormal_ffv_701;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_702> AgradCdfLogExpModNormal_ffv_702;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_703> AgradCdfLogExpModNormal_ffv_703;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_704> AgradCdfLogExpModNormal_ffv_704;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_705> AgradCdfLogExpModNormal_ffv_705;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_706> AgradCdfLogExpModNormal_ffv_706;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_707> AgradCdfLogExpModNormal_ffv_707;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_708> AgradCdfLogExpModNormal_ffv_708;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_709> AgradCdfLogExpModNormal_ffv_709;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_710> AgradCdfLogExpModNormal_ffv_710;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_711> AgradCdfLogExpModNormal_ffv_711;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_712> AgradCdfLogExpModNormal_ffv_712;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_713> AgradCdfLogExpModNormal_ffv_713;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_714> AgradCdfLogExpModNormal_ffv_714;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_715> AgradCdfLogExpModNormal_ffv_715;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_716> AgradCdfLogExpModNormal_ffv_716;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_717> AgradCdfLogExpModNormal_ffv_717;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_718> AgradCdfLogExpModNormal_ffv_718;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_719> AgradCdfLogExpModNormal_ffv_719;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_720> AgradCdfLogExpModNormal_ffv_720;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_721> AgradCdfLogExpModNormal_ffv_721;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_722> AgradCdfLogExpModNormal_ffv_722;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_723> AgradCdfLogExpModNormal_ffv_723;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_724> AgradCdfLogExpModNormal_ffv_724;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_725> AgradCdfLogExpModNormal_ffv_725;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_726> AgradCdfLogExpModNormal_ffv_726;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_727> AgradCdfLogExpModNormal_ffv_727;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_728> AgradCdfLogExpModNormal_ffv_728;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_729> AgradCdfLogExpModNormal_ffv_729;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_730> AgradCdfLogExpModNormal_ffv_730;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_731> AgradCdfLogExpModNormal_ffv_731;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_732> AgradCdfLogExpModNormal_ffv_732;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_733> AgradCdfLogExpModNormal_ffv_733;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_734> AgradCdfLogExpModNormal_ffv_734;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_735> AgradCdfLogExpModNormal_ffv_735;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_736> AgradCdfLogExpModNormal_ffv_736;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_737> AgradCdfLogExpModNormal_ffv_737;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_738> AgradCdfLogExpModNormal_ffv_738;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_739> AgradCdfLogExpModNormal_ffv_739;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_740> AgradCdfLogExpModNormal_ffv_740;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_741> AgradCdfLogExpModNormal_ffv_741;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_742> AgradCdfLogExpModNormal_ffv_742;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_743> AgradCdfLogExpModNormal_ffv_743;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_744> AgradCdfLogExpModNormal_ffv_744;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_745> AgradCdfLogExpModNormal_ffv_745;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_746> AgradCdfLogExpModNormal_ffv_746;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_747> AgradCdfLogExpModNormal_ffv_747;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_748> AgradCdfLogExpModNormal_ffv_748;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_749> AgradCdfLogExpModNormal_ffv_749;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_750> AgradCdfLogExpModNormal_ffv_750;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_751> AgradCdfLogExpModNormal_ffv_751;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_752> AgradCdfLogExpModNormal_ffv_752;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_753> AgradCdfLogExpModNormal_ffv_753;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_754> AgradCdfLogExpModNormal_ffv_754;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_755> AgradCdfLogExpModNormal_ffv_755;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_756> AgradCdfLogExpModNormal_ffv_756;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_757> AgradCdfLogExpModNormal_ffv_757;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_758> AgradCdfLogExpModNormal_ffv_758;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_759> AgradCdfLogExpModNormal_ffv_759;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_760> AgradCdfLogExpModNormal_ffv_760;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_761> AgradCdfLogExpModNormal_ffv_761;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_762> AgradCdfLogExpModNormal_ffv_762;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_763> AgradCdfLogExpModNormal_ffv_763;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_764> AgradCdfLogExpModNormal_ffv_764;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_765> AgradCdfLogExpModNormal_ffv_765;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_766> AgradCdfLogExpModNormal_ffv_766;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_767> AgradCdfLogExpModNormal_ffv_767;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_768> AgradCdfLogExpModNormal_ffv_768;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_769> AgradCdfLogExpModNormal_ffv_769;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_770> AgradCdfLogExpModNormal_ffv_770;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_771> AgradCdfLogExpModNormal_ffv_771;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_772> AgradCdfLogExpModNormal_ffv_772;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_773> AgradCdfLogExpModNormal_ffv_773;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_774> AgradCdfLogExpModNormal_ffv_774;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_775> AgradCdfLogExpModNormal_ffv_775;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_776> AgradCdfLogExpModNormal_ffv_776;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_777> AgradCdfLogExpModNormal_ffv_777;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_778> AgradCdfLogExpModNormal_ffv_778;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_779> AgradCdfLogExpModNormal_ffv_779;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_780> AgradCdfLogExpModNormal_ffv_780;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_781> AgradCdfLogExpModNormal_ffv_781;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_782> AgradCdfLogExpModNormal_ffv_782;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_783> AgradCdfLogExpModNormal_ffv_783;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_784> AgradCdfLogExpModNormal_ffv_784;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_785> AgradCdfLogExpModNormal_ffv_785;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_786> AgradCdfLogExpModNormal_ffv_786;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_787> AgradCdfLogExpModNormal_ffv_787;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_788> AgradCdfLogExpModNormal_ffv_788;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_789> AgradCdfLogExpModNormal_ffv_789;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_790> AgradCdfLogExpModNormal_ffv_790;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_791> AgradCdfLogExpModNormal_ffv_791;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_792> AgradCdfLogExpModNormal_ffv_792;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_793> AgradCdfLogExpModNormal_ffv_793;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_794> AgradCdfLogExpModNormal_ffv_794;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_795> AgradCdfLogExpModNormal_ffv_795;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_796> AgradCdfLogExpModNormal_ffv_796;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_797> AgradCdfLogExpModNormal_ffv_797;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_798> AgradCdfLogExpModNormal_ffv_798;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_799> AgradCdfLogExpModNormal_ffv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_700, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_701, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_702, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_703, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_704, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_705, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_706, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_707, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_708, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_709, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_710, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_711, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_712, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_713, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_714, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_715, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_716, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_717, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_718, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_719, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_720, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_721, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_722, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_723, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_724, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_725, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_726, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_727, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_728, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_729, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_730, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_731, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_732, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_733, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_734, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_735, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_736, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_737, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_738, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_739, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_740, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_741, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_742, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_743, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_744, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_745, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_746, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_747, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_748, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_749, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_750, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_751, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_752, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_753, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_754, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_755, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_756, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_757, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_758, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_759, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_760, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_761, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_762, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_763, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_764, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_765, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_766, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_767, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_768, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_769, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_770, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_771, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_772, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_773, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_774, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_775, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_776, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_777, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_778, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_779, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_780, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_781, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_782, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_783, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_784, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_785, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_786, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_787, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_788, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_789, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_790, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_791, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_792, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_793, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_794, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_795, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_796, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_797, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_798, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_799, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_799);
+
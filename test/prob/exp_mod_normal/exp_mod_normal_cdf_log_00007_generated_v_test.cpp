@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_700;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_701;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_v_702;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_v_703;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_704;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_v_705;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_v_706;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_707;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_v_708;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_709;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_710;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_v_711;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_712;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_713;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_714;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_715;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_716;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_717;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_718;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_719;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_720;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_721;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_722;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_723;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_724;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_725;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_726;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_727;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_728;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_729;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_730;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_731;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_732;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_733;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_734;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_735;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_736;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_737;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_738;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_739;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_740;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_741;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_742;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_743;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_744;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_745;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_746;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_747;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_748;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_749;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_750;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_751;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_752;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_753;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_754;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_755;
+typedef std::tuple<var, var, double, double, empty, empty> type_v_756;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_v_757;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_758;
+typedef std::tuple<var, var, double, var, empty, empty> type_v_759;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_v_760;
+typedef std::tuple<var, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_761;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_v_762;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_v_763;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_764;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_v_765;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_v_766;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_767;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_768;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_769;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_770;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_771;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_772;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_773;
+typedef std::tuple<var, var, var, double, empty, empty> type_v_774;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_v_775;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_776;
+typedef std::tuple<var, var, var, var, empty, empty> type_v_777;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_v_778;
+typedef std::tuple<var, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_779;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_v_780;
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_v_781;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_782;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_v_783;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_v_784;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_785;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_786;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_787;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_788;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_789;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_790;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_791;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_v_792;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_v_793;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_794;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_v_795;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_v_796;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_797;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_v_798;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_799;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_700> AgradCdfLogExpModNormal_v_700;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_701> AgradCdfLogExpModNormal_v_701;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_702> AgradCdfLogExpModNormal_v_702;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_703> AgradCdfLogExpModNormal_v_703;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_704> AgradCdfLogExpModNormal_v_704;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_705> AgradCdfLogExpModNormal_v_705;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_706> AgradCdfLogExpModNormal_v_706;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_707> AgradCdfLogExpModNormal_v_707;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_708> AgradCdfLogExpModNormal_v_708;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_709> AgradCdfLogExpModNormal_v_709;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_710> AgradCdfLogExpModNormal_v_710;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_711> AgradCdfLogExpModNormal_v_711;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_712> AgradCdfLogExpModNormal_v_712;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_713> AgradCdfLogExpModNormal_v_713;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_714> AgradCdfLogExpModNormal_v_714;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_715> AgradCdfLogExpModNormal_v_715;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_716> AgradCdfLogExpModNormal_v_716;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_717> AgradCdfLogExpModNormal_v_717;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_718> AgradCdfLogExpModNormal_v_718;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_719> AgradCdfLogExpModNormal_v_719;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_720> AgradCdfLogExpModNormal_v_720;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_721> AgradCdfLogExpModNormal_v_721;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_722> AgradCdfLogExpModNormal_v_722;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_723> AgradCdfLogExpModNormal_v_723;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_724> AgradCdfLogExpModNormal_v_724;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_725> AgradCdfLogExpModNormal_v_725;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_726> AgradCdfLogExpModNormal_v_726;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_727> AgradCdfLogExpModNormal_v_727;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_728> AgradCdfLogExpModNormal_v_728;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_729> AgradCdfLogExpModNormal_v_729;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_730> AgradCdfLogExpModNormal_v_730;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_731> AgradCdfLogExpModNormal_v_731;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_732> AgradCdfLogExpModNormal_v_732;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_733> AgradCdfLogExpModNormal_v_733;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_734> AgradCdfLogExpModNormal_v_734;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_735> AgradCdfLogExpModNormal_v_735;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_736> AgradCdfLogExpModNormal_v_736;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_737> AgradCdfLogExpModNormal_v_737;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_738> AgradCdfLogExpModNormal_v_738;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_739> AgradCdfLogExpModNormal_v_739;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_740> AgradCdfLogExpModNormal_v_740;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_741> AgradCdfLogExpModNormal_v_741;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_742> AgradCdfLogExpModNormal_v_742;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_743> AgradCdfLogExpModNormal_v_743;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_744> AgradCdfLogExpModNormal_v_744;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_745> AgradCdfLogExpModNormal_v_745;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_746> AgradCdfLogExpModNormal_v_746;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_747> AgradCdfLogExpModNormal_v_747;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_748> AgradCdfLogExpModNormal_v_748;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_749> AgradCdfLogExpModNormal_v_749;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_750> AgradCdfLogExpModNormal_v_750;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_751> AgradCdfLogExpModNormal_v_751;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_752> AgradCdfLogExpModNormal_v_752;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_753> AgradCdfLogExpModNormal_v_753;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_754> AgradCdfLogExpModNormal_v_754;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_755> AgradCdfLogExpModNormal_v_755;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_756> AgradCdfLogExpModNormal_v_756;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_757> AgradCdfLogExpModNormal_v_757;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_758> AgradCdfLogExpModNormal_v_758;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_759> AgradCdfLogExpModNormal_v_759;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_760> AgradCdfLogExpModNormal_v_760;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_761> AgradCdfLogExpModNormal_v_761;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_762> AgradCdfLogExpModNormal_v_762;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_763> AgradCdfLogExpModNormal_v_763;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_764> AgradCdfLogExpModNormal_v_764;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_765> AgradCdfLogExpModNormal_v_765;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_766> AgradCdfLogExpModNormal_v_766;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_767> AgradCdfLogExpModNormal_v_767;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_768> AgradCdfLogExpModNormal_v_768;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_769> AgradCdfLogExpModNormal_v_769;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_770> AgradCdfLogExpModNormal_v_770;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_771> AgradCdfLogExpModNormal_v_771;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_772> AgradCdfLogExpModNormal_v_772;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_773> AgradCdfLogExpModNormal_v_773;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_774> AgradCdfLogExpModNormal_v_774;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_775> AgradCdfLogExpModNormal_v_775;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_776> AgradCdfLogExpModNormal_v_776;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_777> AgradCdfLogExpModNormal_v_777;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_778> AgradCdfLogExpModNormal_v_778;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_779> AgradCdfLogExpModNormal_v_779;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_780> AgradCdfLogExpModNormal_v_780;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_781> AgradCdfLogExpModNormal_v_781;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_782> AgradCdfLogExpModNormal_v_782;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_783> AgradCdfLogExpModNormal_v_783;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_784> AgradCdfLogExpModNormal_v_784;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_785> AgradCdfLogExpModNormal_v_785;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_786> AgradCdfLogExpModNormal_v_786;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_787> AgradCdfLogExpModNormal_v_787;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_788> AgradCdfLogExpModNormal_v_788;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_789> AgradCdfLogExpModNormal_v_789;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_790> AgradCdfLogExpModNormal_v_790;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_791> AgradCdfLogExpModNormal_v_791;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_792> AgradCdfLogExpModNormal_v_792;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_793> AgradCdfLogExpModNormal_v_793;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_794> AgradCdfLogExpModNormal_v_794;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_795> AgradCdfLogExpModNormal_v_795;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_796> AgradCdfLogExpModNormal_v_796;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_797> AgradCdfLogExpModNormal_v_797;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_798> AgradCdfLogExpModNormal_v_798;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_799> AgradCdfLogExpModNormal_v_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_700, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_701, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_702, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_703, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_704, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_705, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_706, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_707, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_708, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_709, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_710, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_711, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_712, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_713, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_714, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_715, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_716, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_717, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_718, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_719, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_720, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_721, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_722, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_723, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_724, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_725, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_726, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_727, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_728, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_729, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_730, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_731, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_732, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_733, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_734, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_735, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_736, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_737, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_738, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_739, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_740, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_741, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_742, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_743, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_744, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_745, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_746, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_747, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_748, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_749, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_750, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_751, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_752, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_753, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_754, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_755, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_756, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_757, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_758, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_759, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_760, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_761, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_762, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_763, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_764, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_765, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_766, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_767, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_768, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_769, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_770, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_771, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_772, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_773, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_774, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_775, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_776, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_777, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_778, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_779, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_780, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_781, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_782, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_783, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_784, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_785, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_786, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_787, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_788, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_789, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_790, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_791, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_792, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_793, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_794, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_795, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_796, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_797, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_798, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_799, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_700;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_701;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_vv_702;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_703;
+typedef std::tuple<var, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_704;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_705;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_706;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_707;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_708;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_709;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_710;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_vv_711;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_712;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_713;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_vv_714;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_715;
+typedef std::tuple<var, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_716;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_717;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_718;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_719;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_720;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_721;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_722;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_723;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_724;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_725;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_726;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_727;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_728;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_vv_729;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_730;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_731;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_vv_732;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_733;
+typedef std::tuple<var, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_734;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_735;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_736;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_737;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_738;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_739;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_740;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_741;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_742;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_743;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_744;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_745;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_746;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_747;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_748;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_749;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_750;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_751;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_752;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_753;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_754;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_755;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_756;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_757;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_758;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_759;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_760;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_761;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_762;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_763;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_764;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_765;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_766;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_767;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_768;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_769;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_770;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_771;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_772;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_773;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_774;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_775;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_776;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_777;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_778;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_779;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_780;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_781;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_782;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_vv_783;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_vv_784;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_785;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_vv_786;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_vv_787;
+typedef std::tuple<std::vector<var>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_788;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_vv_789;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_790;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_791;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_vv_792;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_793;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_794;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_795;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_796;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_797;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_798;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_799;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_700> AgradCdfLogExpModNormal_vv_700;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_701> AgradCdfLogExpModNormal_vv_701;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_702> AgradCdfLogExpModNormal_vv_702;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_703> AgradCdfLogExpModNormal_vv_703;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_704> AgradCdfLogExpModNormal_vv_704;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_705> AgradCdfLogExpModNormal_vv_705;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_706> AgradCdfLogExpModNormal_vv_706;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_707> AgradCdfLogExpModNormal_vv_707;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_708> AgradCdfLogExpModNormal_vv_708;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_709> AgradCdfLogExpModNormal_vv_709;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_710> AgradCdfLogExpModNormal_vv_710;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_711> AgradCdfLogExpModNormal_vv_711;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_712> AgradCdfLogExpModNormal_vv_712;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_713> AgradCdfLogExpModNormal_vv_713;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_714> AgradCdfLogExpModNormal_vv_714;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_715> AgradCdfLogExpModNormal_vv_715;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_716> AgradCdfLogExpModNormal_vv_716;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_717> AgradCdfLogExpModNormal_vv_717;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_718> AgradCdfLogExpModNormal_vv_718;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_719> AgradCdfLogExpModNormal_vv_719;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_720> AgradCdfLogExpModNormal_vv_720;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_721> AgradCdfLogExpModNormal_vv_721;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_722> AgradCdfLogExpModNormal_vv_722;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_723> AgradCdfLogExpModNormal_vv_723;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_724> AgradCdfLogExpModNormal_vv_724;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_725> AgradCdfLogExpModNormal_vv_725;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_726> AgradCdfLogExpModNormal_vv_726;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_727> AgradCdfLogExpModNormal_vv_727;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_728> AgradCdfLogExpModNormal_vv_728;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_729> AgradCdfLogExpModNormal_vv_729;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_730> AgradCdfLogExpModNormal_vv_730;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_731> AgradCdfLogExpModNormal_vv_731;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_732> AgradCdfLogExpModNormal_vv_732;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_733> AgradCdfLogExpModNormal_vv_733;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_734> AgradCdfLogExpModNormal_vv_734;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_735> AgradCdfLogExpModNormal_vv_735;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_736> AgradCdfLogExpModNormal_vv_736;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_737> AgradCdfLogExpModNormal_vv_737;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_738> AgradCdfLogExpModNormal_vv_738;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_739> AgradCdfLogExpModNormal_vv_739;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_740> AgradCdfLogExpModNormal_vv_740;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_741> AgradCdfLogExpModNormal_vv_741;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_742> AgradCdfLogExpModNormal_vv_742;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_743> AgradCdfLogExpModNormal_vv_743;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_744> AgradCdfLogExpModNormal_vv_744;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_745> AgradCdfLogExpModNormal_vv_745;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_746> AgradCdfLogExpModNormal_vv_746;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_747> AgradCdfLogExpModNormal_vv_747;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_748> AgradCdfLogExpModNormal_vv_748;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_749> AgradCdfLogExpModNormal_vv_749;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_750> AgradCdfLogExpModNormal_vv_750;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_751> AgradCdfLogExpModNormal_vv_751;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_752> AgradCdfLogExpModNormal_vv_752;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_753> AgradCdfLogExpModNormal_vv_753;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_754> AgradCdfLogExpModNormal_vv_754;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_755> AgradCdfLogExpModNormal_vv_755;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_756> AgradCdfLogExpModNormal_vv_756;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_757> AgradCdfLogExpModNormal_vv_757;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_758> AgradCdfLogExpModNormal_vv_758;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_759> AgradCdfLogExpModNormal_vv_759;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_760> AgradCdfLogExpModNormal_vv_760;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_761> AgradCdfLogExpModNormal_vv_761;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_762> AgradCdfLogExpModNormal_vv_762;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_763> AgradCdfLogExpModNormal_vv_763;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_764> AgradCdfLogExpModNormal_vv_764;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_765> AgradCdfLogExpModNormal_vv_765;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_766> AgradCdfLogExpModNormal_vv_766;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_767> AgradCdfLogExpModNormal_vv_767;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_768> AgradCdfLogExpModNormal_vv_768;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_769> AgradCdfLogExpModNormal_vv_769;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_770> AgradCdfLogExpModNormal_vv_770;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_771> AgradCdfLogExpModNormal_vv_771;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_772> AgradCdfLogExpModNormal_vv_772;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_773> AgradCdfLogExpModNormal_vv_773;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_774> AgradCdfLogExpModNormal_vv_774;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_775> AgradCdfLogExpModNormal_vv_775;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_776> AgradCdfLogExpModNormal_vv_776;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_777> AgradCdfLogExpModNormal_vv_777;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_778> AgradCdfLogExpModNormal_vv_778;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_779> AgradCdfLogExpModNormal_vv_779;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_780> AgradCdfLogExpModNormal_vv_780;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_781> AgradCdfLogExpModNormal_vv_781;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_782> AgradCdfLogExpModNormal_vv_782;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_783> AgradCdfLogExpModNormal_vv_783;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_784> AgradCdfLogExpModNormal_vv_784;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_785> AgradCdfLogExpModNormal_vv_785;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_786> AgradCdfLogExpModNormal_vv_786;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_787> AgradCdfLogExpModNormal_vv_787;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_788> AgradCdfLogExpModNormal_vv_788;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_789> AgradCdfLogExpModNormal_vv_789;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_790> AgradCdfLogExpModNormal_vv_790;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_791> AgradCdfLogExpModNormal_vv_791;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_792> AgradCdfLogExpModNormal_vv_792;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_793> AgradCdfLogExpModNormal_vv_793;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_794> AgradCdfLogExpModNormal_vv_794;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_795> AgradCdfLogExpModNormal_vv_795;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_796> AgradCdfLogExpModNormal_vv_796;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_797> AgradCdfLogExpModNormal_vv_797;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_798> AgradCdfLogExpModNormal_vv_798;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_799> AgradCdfLogExpModNormal_vv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_700, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_701, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_702, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_703, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_704, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_705, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_706, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_707, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_708, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_709, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_710, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_711, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_712, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_713, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_714, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_715, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_716, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_717, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_718, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_719, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_720, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_721, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_722, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_723, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_724, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_725, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_726, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_727, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_728, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_729, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_730, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_731, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_732, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_733, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_734, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_735, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_736, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_737, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_738, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_739, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_740, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_741, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_742, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_743, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_744, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_745, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_746, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_747, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_748, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_749, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_750, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_751, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_752, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_753, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_754, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_755, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_756, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_757, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_758, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_759, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_760, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_761, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_762, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_763, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_764, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_765, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_766, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_767, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_768, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_769, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_770, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_771, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_772, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_773, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_774, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_775, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_776, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_777, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_778, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_779, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_780, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_781, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_782, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_783, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_784, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_785, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_786, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_787, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_788, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_789, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_790, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_791, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_792, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_793, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_794, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_795, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_796, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_797, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_798, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_799, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_800;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_801;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_802;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_803;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_804;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_805;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_806;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_807;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_808;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_809;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_810;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_811;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_812;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_813;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_814;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_815;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_816;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_817;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_818;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty, empty> type_ffv_819;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_820;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_821;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_822;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_823;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_824;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_825;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_826;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_827;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_828;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_829;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_830;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_831;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_832;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_833;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_834;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_835;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_836;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_837;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_838;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_839;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_840;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_841;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_842;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_843;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_844;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_845;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_846;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_847;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_848;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_849;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_850;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_851;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_852;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_853;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_854;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_855;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_856;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_857;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_858;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_859;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_860;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_861;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_862;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_863;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_864;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_865;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_866;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_867;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_868;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_869;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_870;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_871;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_872;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_873;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_874;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_875;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_876;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_877;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_878;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_879;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_880;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_881;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_882;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_883;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_884;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_885;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_886;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_887;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_888;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_889;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_890;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_891;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_892;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_893;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_894;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_895;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_896;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_897;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_898;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_899;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_800> AgradCdfLogExpModNormal_ffv_800;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_801> AgradCdfLogExpModNormal_ffv_801;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_802> AgradCdfLogExpModNormal_ffv_802;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_803> AgradCdfLogExpModNormal_ffv_803;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_804> AgradCdfLogExpModNormal_ffv_804;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_805> AgradCdfLogExpModNormal_ffv_805;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_806> AgradCdfLogExpModNormal_ffv_806;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_807> AgradCdfLogExpModNormal_ffv_807;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_808> AgradCdfLogExpModNormal_ffv_808;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_809> AgradCdfLogExpModNormal_ffv_809;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_810> AgradCdfLogExpModNormal_ffv_810;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_811> AgradCdfLogExpModNormal_ffv_811;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_812> AgradCdfLogExpModNormal_ffv_812;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_813> AgradCdfLogExpModNormal_ffv_813;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_814> AgradCdfLogExpModNormal_ffv_814;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_815> AgradCdfLogExpModNormal_ffv_815;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_816> AgradCdfLogExpModNormal_ffv_816;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_817> AgradCdfLogExpModNormal_ffv_817;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_818> AgradCdfLogExpModNormal_ffv_818;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_819> AgradCdfLogExpModNormal_ffv_819;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_820> AgradCdfLogExpModNormal_ffv_820;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_821> AgradCdfLogExpModNormal_ffv_821;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_822> AgradCdfLogExpModNormal_ffv_822;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_823> AgradCdfLogExpModNormal_ffv_823;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_824> AgradCdfLogExpModNormal_ffv_824;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_825> AgradCdfLogExpModNormal_ffv_825;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_826> AgradCdfLogExpModNormal_ffv_826;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_827> AgradCdfLogExpModNormal_ffv_827;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_828> AgradCdfLogExpModNormal_ffv_828;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_829> AgradCdfLogExpModNormal_ffv_829;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_830> AgradCdfLogExpModNormal_ffv_830;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_831> AgradCdfLogExpModNormal_ffv_831;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_832> AgradCdfLogExpModNormal_ffv_832;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_833> AgradCdfLogExpModNormal_ffv_833;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_834> AgradCdfLogExpModNormal_ffv_834;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_835> AgradCdfLogExpModNormal_ffv_835;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_836> AgradCdfLogExpModNormal_ffv_836;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_837> AgradCdfLogExpModNormal_ffv_837;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_838> AgradCdfLogExpModNormal_ffv_838;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_839> AgradCdfLogExpModNormal_ffv_839;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_840> AgradCdfLogExpModNormal_ffv_840;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_841> AgradCdfLogExpModNormal_ffv_841;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_842> AgradCdfLogExpModNormal_ffv_842;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_843> AgradCdfLogExpModNormal_ffv_843;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_844> AgradCdfLogExpModNormal_ffv_844;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_845> AgradCdfLogExpModNormal_ffv_845;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_846> AgradCdfLogExpModNormal_ffv_846;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_847> AgradCdfLogExpModNormal_ffv_847;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_848> AgradCdfLogExpModNormal_ffv_848;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_849> AgradCdfLogExpModNormal_ffv_849;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_850> AgradCdfLogExpModNormal_ffv_850;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_851> AgradCdfLogExpModNormal_ffv_851;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_852> AgradCdfLogExpModNormal_ffv_852;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_853> AgradCdfLogExpModNormal_ffv_853;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_854> AgradCdfLogExpModNormal_ffv_854;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_855> AgradCdfLogExpModNormal_ffv_855;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_856> AgradCdfLogExpModNormal_ffv_856;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_857> AgradCdfLogExpModNormal_ffv_857;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_858> AgradCdfLogExpModNormal_ffv_858;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_859> AgradCdfLogExpModNormal_ffv_859;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_860> AgradCdfLogExpModNormal_ffv_860;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_861> AgradCdfLogExpModNormal_ffv_861;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_862> AgradCdfLogExpModNormal_ffv_862;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_863> AgradCdfLogExpModNormal_ffv_863;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_864> AgradCdfLogExpModNormal_ffv_864;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_865> AgradCdfLogExpModNormal_ffv_865;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_866> AgradCdfLogExpModNormal_ffv_866;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_867> AgradCdfLogExpModNormal_ffv_867;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_868> AgradCdfLogExpModNormal_ffv_868;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_869> AgradCdfLogExpModNormal_ffv_869;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_870> AgradCdfLogExpModNormal_ffv_870;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_871> AgradCdfLogExpModNormal_ffv_871;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_872> AgradCdfLogExpModNormal_ffv_872;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_873> AgradCdfLogExpModNormal_ffv_873;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_874> AgradCdfLogExpModNormal_ffv_874;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_875> AgradCdfLogExpModNormal_ffv_875;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_876> AgradCdfLogExpModNormal_ffv_876;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_877> AgradCdfLogExpModNormal_ffv_877;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_878> AgradCdfLogExpModNormal_ffv_878;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_879> AgradCdfLogExpModNormal_ffv_879;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_880> AgradCdfLogExpModNormal_ffv_880;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_881> AgradCdfLogExpModNormal_ffv_881;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_882> AgradCdfLogExpModNormal_ffv_882;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_883> AgradCdfLogExpModNormal_ffv_883;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_884> AgradCdfLogExpModNormal_ffv_884;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_885> AgradCdfLogExpModNormal_ffv_885;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_886> AgradCdfLogExpModNormal_ffv_886;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_887> AgradCdfLogExpModNormal_ffv_887;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_888> AgradCdfLogExpModNormal_ffv_888;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_889> AgradCdfLogExpModNormal_ffv_889;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_890> AgradCdfLogExpModNormal_ffv_890;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_891> AgradCdfLogExpModNormal_ffv_891;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_892> AgradCdfLogExpModNormal_ffv_892;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_893> AgradCdfLogExpModNormal_ffv_893;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_894> AgradCdfLogExpModNormal_ffv_894;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_895> AgradCdfLogExpModNormal_ffv_895;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_896> AgradCdfLogExpModNormal_ffv_896;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_897> AgradCdfLogExpModNormal_ffv_897;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_898> AgradCdfLogExpModNormal_ffv_898;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_899> AgradCdfLogExpModNormal_ffv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_800, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_801, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_802, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_803, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_804, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_805, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_806, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_807, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_808, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_809, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_810, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_811, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_812, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_813, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_814, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_815, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_816, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_817, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_818, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_819, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_820, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_821, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_822, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_823, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_824, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_825, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_826, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_827, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_828, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_829, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_830, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_831, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_832, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_833, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_834, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_835, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_836, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_837, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_838, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_839, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_840, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_841, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_842, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_843, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_844, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_845, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_846, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_847, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_848, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_849, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_850, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_851, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_852, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_853, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_854, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_855, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_856, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_857, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_858, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_859, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_860, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_861, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_862, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_863, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_864, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_865, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_866, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_867, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_868, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_869, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_870, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_871, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_872, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_873, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_874, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_875, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_876, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_877, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_878, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_879, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_880, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_881, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_882, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_883, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_884, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_885, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_886, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_887, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_888, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_889, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_890, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_891, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_892, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_893, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_894, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_895, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_896, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_897, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_898, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_899, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_899);
+
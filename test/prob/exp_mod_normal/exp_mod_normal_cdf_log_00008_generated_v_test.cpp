@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_800;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_v_801;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_802;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_803;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_804;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_805;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_806;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_807;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_808;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_809;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_v_810;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_v_811;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_812;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_v_813;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_v_814;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_815;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_v_816;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_817;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_818;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_v_819;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_820;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_821;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_822;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_823;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_824;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_825;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_826;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_827;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_828;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_829;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_830;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_831;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_832;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_833;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_834;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_835;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_836;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_837;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_838;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_839;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_840;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_841;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_842;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_843;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_844;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_845;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_846;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_847;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_848;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_849;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_850;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_851;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_852;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_853;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_854;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_855;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_856;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_857;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_858;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_859;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_860;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_861;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_862;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_863;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_v_864;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_v_865;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_866;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_v_867;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_v_868;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_869;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_v_870;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_871;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_872;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_v_873;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_874;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_875;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_876;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_877;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_878;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_879;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_880;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_881;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_v_882;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_v_883;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_884;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_v_885;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_v_886;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_887;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_v_888;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_889;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_890;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_v_891;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_892;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_893;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_894;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_895;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_896;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_897;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_898;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_899;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_800> AgradCdfLogExpModNormal_v_800;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_801> AgradCdfLogExpModNormal_v_801;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_802> AgradCdfLogExpModNormal_v_802;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_803> AgradCdfLogExpModNormal_v_803;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_804> AgradCdfLogExpModNormal_v_804;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_805> AgradCdfLogExpModNormal_v_805;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_806> AgradCdfLogExpModNormal_v_806;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_807> AgradCdfLogExpModNormal_v_807;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_808> AgradCdfLogExpModNormal_v_808;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_809> AgradCdfLogExpModNormal_v_809;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_810> AgradCdfLogExpModNormal_v_810;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_811> AgradCdfLogExpModNormal_v_811;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_812> AgradCdfLogExpModNormal_v_812;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_813> AgradCdfLogExpModNormal_v_813;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_814> AgradCdfLogExpModNormal_v_814;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_815> AgradCdfLogExpModNormal_v_815;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_816> AgradCdfLogExpModNormal_v_816;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_817> AgradCdfLogExpModNormal_v_817;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_818> AgradCdfLogExpModNormal_v_818;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_819> AgradCdfLogExpModNormal_v_819;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_820> AgradCdfLogExpModNormal_v_820;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_821> AgradCdfLogExpModNormal_v_821;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_822> AgradCdfLogExpModNormal_v_822;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_823> AgradCdfLogExpModNormal_v_823;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_824> AgradCdfLogExpModNormal_v_824;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_825> AgradCdfLogExpModNormal_v_825;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_826> AgradCdfLogExpModNormal_v_826;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_827> AgradCdfLogExpModNormal_v_827;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_828> AgradCdfLogExpModNormal_v_828;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_829> AgradCdfLogExpModNormal_v_829;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_830> AgradCdfLogExpModNormal_v_830;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_831> AgradCdfLogExpModNormal_v_831;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_832> AgradCdfLogExpModNormal_v_832;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_833> AgradCdfLogExpModNormal_v_833;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_834> AgradCdfLogExpModNormal_v_834;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_835> AgradCdfLogExpModNormal_v_835;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_836> AgradCdfLogExpModNormal_v_836;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_837> AgradCdfLogExpModNormal_v_837;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_838> AgradCdfLogExpModNormal_v_838;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_839> AgradCdfLogExpModNormal_v_839;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_840> AgradCdfLogExpModNormal_v_840;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_841> AgradCdfLogExpModNormal_v_841;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_842> AgradCdfLogExpModNormal_v_842;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_843> AgradCdfLogExpModNormal_v_843;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_844> AgradCdfLogExpModNormal_v_844;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_845> AgradCdfLogExpModNormal_v_845;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_846> AgradCdfLogExpModNormal_v_846;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_847> AgradCdfLogExpModNormal_v_847;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_848> AgradCdfLogExpModNormal_v_848;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_849> AgradCdfLogExpModNormal_v_849;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_850> AgradCdfLogExpModNormal_v_850;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_851> AgradCdfLogExpModNormal_v_851;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_852> AgradCdfLogExpModNormal_v_852;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_853> AgradCdfLogExpModNormal_v_853;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_854> AgradCdfLogExpModNormal_v_854;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_855> AgradCdfLogExpModNormal_v_855;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_856> AgradCdfLogExpModNormal_v_856;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_857> AgradCdfLogExpModNormal_v_857;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_858> AgradCdfLogExpModNormal_v_858;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_859> AgradCdfLogExpModNormal_v_859;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_860> AgradCdfLogExpModNormal_v_860;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_861> AgradCdfLogExpModNormal_v_861;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_862> AgradCdfLogExpModNormal_v_862;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_863> AgradCdfLogExpModNormal_v_863;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_864> AgradCdfLogExpModNormal_v_864;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_865> AgradCdfLogExpModNormal_v_865;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_866> AgradCdfLogExpModNormal_v_866;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_867> AgradCdfLogExpModNormal_v_867;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_868> AgradCdfLogExpModNormal_v_868;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_869> AgradCdfLogExpModNormal_v_869;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_870> AgradCdfLogExpModNormal_v_870;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_871> AgradCdfLogExpModNormal_v_871;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_872> AgradCdfLogExpModNormal_v_872;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_873> AgradCdfLogExpModNormal_v_873;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_874> AgradCdfLogExpModNormal_v_874;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_875> AgradCdfLogExpModNormal_v_875;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_876> AgradCdfLogExpModNormal_v_876;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_877> AgradCdfLogExpModNormal_v_877;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_878> AgradCdfLogExpModNormal_v_878;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_879> AgradCdfLogExpModNormal_v_879;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_880> AgradCdfLogExpModNormal_v_880;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_881> AgradCdfLogExpModNormal_v_881;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_882> AgradCdfLogExpModNormal_v_882;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_883> AgradCdfLogExpModNormal_v_883;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_884> AgradCdfLogExpModNormal_v_884;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_885> AgradCdfLogExpModNormal_v_885;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_886> AgradCdfLogExpModNormal_v_886;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_887> AgradCdfLogExpModNormal_v_887;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_888> AgradCdfLogExpModNormal_v_888;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_889> AgradCdfLogExpModNormal_v_889;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_890> AgradCdfLogExpModNormal_v_890;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_891> AgradCdfLogExpModNormal_v_891;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_892> AgradCdfLogExpModNormal_v_892;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_893> AgradCdfLogExpModNormal_v_893;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_894> AgradCdfLogExpModNormal_v_894;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_895> AgradCdfLogExpModNormal_v_895;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_896> AgradCdfLogExpModNormal_v_896;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_897> AgradCdfLogExpModNormal_v_897;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_898> AgradCdfLogExpModNormal_v_898;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_899> AgradCdfLogExpModNormal_v_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_800, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_801, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_802, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_803, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_804, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_805, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_806, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_807, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_808, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_809, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_810, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_811, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_812, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_813, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_814, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_815, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_816, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_817, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_818, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_819, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_820, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_821, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_822, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_823, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_824, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_825, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_826, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_827, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_828, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_829, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_830, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_831, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_832, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_833, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_834, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_835, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_836, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_837, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_838, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_839, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_840, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_841, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_842, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_843, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_844, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_845, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_846, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_847, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_848, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_849, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_850, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_851, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_852, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_853, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_854, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_855, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_856, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_857, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_858, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_859, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_860, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_861, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_862, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_863, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_864, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_865, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_866, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_867, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_868, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_869, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_870, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_871, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_872, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_873, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_874, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_875, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_876, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_877, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_878, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_879, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_880, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_881, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_882, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_883, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_884, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_885, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_886, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_887, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_888, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_889, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_890, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_891, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_892, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_893, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_894, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_895, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_896, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_897, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_898, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_899, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_800;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_vv_801;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_vv_802;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_803;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_vv_804;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_vv_805;
+typedef std::tuple<std::vector<var>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_806;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_vv_807;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_808;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_809;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_vv_810;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_811;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_812;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_813;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_814;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_815;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_816;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_817;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_818;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_vv_819;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_820;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_821;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_vv_822;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_823;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_824;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_825;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_826;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_827;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_828;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_829;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_830;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_831;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_832;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_833;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_834;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_835;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_836;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_vv_837;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_838;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_839;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_vv_840;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_841;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_842;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_843;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_844;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_845;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_846;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_847;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_848;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_849;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_850;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_851;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_852;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_853;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_854;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_855;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_856;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_857;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_858;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_859;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_860;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_861;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_862;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_863;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_864;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_865;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_866;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_867;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_868;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_869;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_870;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_871;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_872;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_873;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_874;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_875;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_876;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_877;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_878;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_879;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_880;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_881;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_882;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_883;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_884;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_885;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_886;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_887;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_888;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_889;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_890;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_vv_891;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_vv_892;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_893;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_vv_894;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_vv_895;
+typedef std::tuple<std::vector<var>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_896;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_vv_897;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_898;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_899;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_800> AgradCdfLogExpModNormal_vv_800;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_801> AgradCdfLogExpModNormal_vv_801;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_802> AgradCdfLogExpModNormal_vv_802;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_803> AgradCdfLogExpModNormal_vv_803;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_804> AgradCdfLogExpModNormal_vv_804;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_805> AgradCdfLogExpModNormal_vv_805;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_806> AgradCdfLogExpModNormal_vv_806;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_807> AgradCdfLogExpModNormal_vv_807;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_808> AgradCdfLogExpModNormal_vv_808;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_809> AgradCdfLogExpModNormal_vv_809;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_810> AgradCdfLogExpModNormal_vv_810;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_811> AgradCdfLogExpModNormal_vv_811;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_812> AgradCdfLogExpModNormal_vv_812;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_813> AgradCdfLogExpModNormal_vv_813;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_814> AgradCdfLogExpModNormal_vv_814;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_815> AgradCdfLogExpModNormal_vv_815;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_816> AgradCdfLogExpModNormal_vv_816;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_817> AgradCdfLogExpModNormal_vv_817;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_818> AgradCdfLogExpModNormal_vv_818;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_819> AgradCdfLogExpModNormal_vv_819;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_820> AgradCdfLogExpModNormal_vv_820;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_821> AgradCdfLogExpModNormal_vv_821;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_822> AgradCdfLogExpModNormal_vv_822;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_823> AgradCdfLogExpModNormal_vv_823;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_824> AgradCdfLogExpModNormal_vv_824;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_825> AgradCdfLogExpModNormal_vv_825;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_826> AgradCdfLogExpModNormal_vv_826;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_827> AgradCdfLogExpModNormal_vv_827;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_828> AgradCdfLogExpModNormal_vv_828;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_829> AgradCdfLogExpModNormal_vv_829;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_830> AgradCdfLogExpModNormal_vv_830;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_831> AgradCdfLogExpModNormal_vv_831;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_832> AgradCdfLogExpModNormal_vv_832;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_833> AgradCdfLogExpModNormal_vv_833;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_834> AgradCdfLogExpModNormal_vv_834;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_835> AgradCdfLogExpModNormal_vv_835;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_836> AgradCdfLogExpModNormal_vv_836;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_837> AgradCdfLogExpModNormal_vv_837;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_838> AgradCdfLogExpModNormal_vv_838;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_839> AgradCdfLogExpModNormal_vv_839;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_840> AgradCdfLogExpModNormal_vv_840;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_841> AgradCdfLogExpModNormal_vv_841;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_842> AgradCdfLogExpModNormal_vv_842;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_843> AgradCdfLogExpModNormal_vv_843;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_844> AgradCdfLogExpModNormal_vv_844;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_845> AgradCdfLogExpModNormal_vv_845;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_846> AgradCdfLogExpModNormal_vv_846;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_847> AgradCdfLogExpModNormal_vv_847;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_848> AgradCdfLogExpModNormal_vv_848;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_849> AgradCdfLogExpModNormal_vv_849;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_850> AgradCdfLogExpModNormal_vv_850;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_851> AgradCdfLogExpModNormal_vv_851;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_852> AgradCdfLogExpModNormal_vv_852;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_853> AgradCdfLogExpModNormal_vv_853;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_854> AgradCdfLogExpModNormal_vv_854;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_855> AgradCdfLogExpModNormal_vv_855;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_856> AgradCdfLogExpModNormal_vv_856;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_857> AgradCdfLogExpModNormal_vv_857;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_858> AgradCdfLogExpModNormal_vv_858;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_859> AgradCdfLogExpModNormal_vv_859;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_860> AgradCdfLogExpModNormal_vv_860;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_861> AgradCdfLogExpModNormal_vv_861;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_862> AgradCdfLogExpModNormal_vv_862;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_863> AgradCdfLogExpModNormal_vv_863;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_864> AgradCdfLogExpModNormal_vv_864;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_865> AgradCdfLogExpModNormal_vv_865;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_866> AgradCdfLogExpModNormal_vv_866;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_867> AgradCdfLogExpModNormal_vv_867;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_868> AgradCdfLogExpModNormal_vv_868;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_869> AgradCdfLogExpModNormal_vv_869;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_870> AgradCdfLogExpModNormal_vv_870;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_871> AgradCdfLogExpModNormal_vv_871;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_872> AgradCdfLogExpModNormal_vv_872;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_873> AgradCdfLogExpModNormal_vv_873;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_874> AgradCdfLogExpModNormal_vv_874;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_875> AgradCdfLogExpModNormal_vv_875;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_876> AgradCdfLogExpModNormal_vv_876;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_877> AgradCdfLogExpModNormal_vv_877;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_878> AgradCdfLogExpModNormal_vv_878;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_879> AgradCdfLogExpModNormal_vv_879;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_880> AgradCdfLogExpModNormal_vv_880;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_881> AgradCdfLogExpModNormal_vv_881;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_882> AgradCdfLogExpModNormal_vv_882;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_883> AgradCdfLogExpModNormal_vv_883;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_884> AgradCdfLogExpModNormal_vv_884;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_885> AgradCdfLogExpModNormal_vv_885;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_886> AgradCdfLogExpModNormal_vv_886;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_887> AgradCdfLogExpModNormal_vv_887;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_888> AgradCdfLogExpModNormal_vv_888;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_889> AgradCdfLogExpModNormal_vv_889;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_890> AgradCdfLogExpModNormal_vv_890;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_891> AgradCdfLogExpModNormal_vv_891;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_892> AgradCdfLogExpModNormal_vv_892;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_893> AgradCdfLogExpModNormal_vv_893;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_894> AgradCdfLogExpModNormal_vv_894;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_895> AgradCdfLogExpModNormal_vv_895;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_896> AgradCdfLogExpModNormal_vv_896;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_897> AgradCdfLogExpModNormal_vv_897;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_898> AgradCdfLogExpModNormal_vv_898;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_899> AgradCdfLogExpModNormal_vv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_800, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_801, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_802, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_803, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_804, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_805, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_806, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_807, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_808, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_809, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_810, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_811, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_812, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_813, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_814, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_815, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_816, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_817, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_818, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_819, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_820, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_821, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_822, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_823, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_824, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_825, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_826, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_827, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_828, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_829, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_830, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_831, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_832, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_833, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_834, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_835, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_836, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_837, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_838, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_839, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_840, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_841, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_842, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_843, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_844, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_845, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_846, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_847, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_848, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_849, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_850, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_851, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_852, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_853, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_854, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_855, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_856, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_857, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_858, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_859, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_860, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_861, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_862, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_863, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_864, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_865, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_866, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_867, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_868, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_869, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_870, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_871, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_872, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_873, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_874, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_875, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_876, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_877, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_878, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_879, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_880, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_881, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_882, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_883, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_884, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_885, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_886, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_887, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_888, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_889, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_890, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_891, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_892, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_893, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_894, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_895, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_896, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_897, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_898, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_899, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_900;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_901;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_902;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_903;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_904;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_905;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_906;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_907;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_908;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_909;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_910;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_911;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_912;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_913;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_914;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_915;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_916;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_917;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_918;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_919;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_920;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_921;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_922;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_923;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_924;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_925;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_926;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_927;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_928;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_929;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_930;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_931;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_932;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_933;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_934;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_935;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_936;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_937;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_938;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_939;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_940;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_941;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_942;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_943;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_944;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_945;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_946;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_947;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_948;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_949;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_950;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_951;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_952;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_953;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_954;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_955;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_956;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_957;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_958;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_959;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_960;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_961;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_962;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_963;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_964;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_965;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_966;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_967;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_968;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_969;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_970;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_971;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_972;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_973;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_974;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_975;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_976;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_977;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_978;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_979;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_980;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_981;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_982;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_983;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_984;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_985;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_986;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_987;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_988;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_989;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_990;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_991;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_992;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_993;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_994;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_995;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_996;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_997;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_998;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_ffv_999;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_900> AgradCdfLogExpModNormal_ffv_900;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_901> AgradCdfLogExpModNormal_ffv_901;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_902> AgradCdfLogExpModNormal_ffv_902;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_903> AgradCdfLogExpModNormal_ffv_903;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_904> AgradCdfLogExpModNormal_ffv_904;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_905> AgradCdfLogExpModNormal_ffv_905;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_906> AgradCdfLogExpModNormal_ffv_906;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_907> AgradCdfLogExpModNormal_ffv_907;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_908> AgradCdfLogExpModNormal_ffv_908;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_909> AgradCdfLogExpModNormal_ffv_909;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_910> AgradCdfLogExpModNormal_ffv_910;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_911> AgradCdfLogExpModNormal_ffv_911;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_912> AgradCdfLogExpModNormal_ffv_912;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_913> AgradCdfLogExpModNormal_ffv_913;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_914> AgradCdfLogExpModNormal_ffv_914;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_915> AgradCdfLogExpModNormal_ffv_915;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_916> AgradCdfLogExpModNormal_ffv_916;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_917> AgradCdfLogExpModNormal_ffv_917;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_918> AgradCdfLogExpModNormal_ffv_918;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_919> AgradCdfLogExpModNormal_ffv_919;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_920> AgradCdfLogExpModNormal_ffv_920;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_921> AgradCdfLogExpModNormal_ffv_921;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_922> AgradCdfLogExpModNormal_ffv_922;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_923> AgradCdfLogExpModNormal_ffv_923;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_924> AgradCdfLogExpModNormal_ffv_924;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_925> AgradCdfLogExpModNormal_ffv_925;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_926> AgradCdfLogExpModNormal_ffv_926;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_927> AgradCdfLogExpModNormal_ffv_927;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_928> AgradCdfLogExpModNormal_ffv_928;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_929> AgradCdfLogExpModNormal_ffv_929;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_930> AgradCdfLogExpModNormal_ffv_930;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_931> AgradCdfLogExpModNormal_ffv_931;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_932> AgradCdfLogExpModNormal_ffv_932;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_933> AgradCdfLogExpModNormal_ffv_933;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_934> AgradCdfLogExpModNormal_ffv_934;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_935> AgradCdfLogExpModNormal_ffv_935;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_936> AgradCdfLogExpModNormal_ffv_936;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_937> AgradCdfLogExpModNormal_ffv_937;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_938> AgradCdfLogExpModNormal_ffv_938;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_939> AgradCdfLogExpModNormal_ffv_939;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_940> AgradCdfLogExpModNormal_ffv_940;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_941> AgradCdfLogExpModNormal_ffv_941;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_942> AgradCdfLogExpModNormal_ffv_942;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_943> AgradCdfLogExpModNormal_ffv_943;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_944> AgradCdfLogExpModNormal_ffv_944;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_945> AgradCdfLogExpModNormal_ffv_945;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_946> AgradCdfLogExpModNormal_ffv_946;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_947> AgradCdfLogExpModNormal_ffv_947;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_948> AgradCdfLogExpModNormal_ffv_948;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_949> AgradCdfLogExpModNormal_ffv_949;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_950> AgradCdfLogExpModNormal_ffv_950;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_951> AgradCdfLogExpModNormal_ffv_951;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_952> AgradCdfLogExpModNormal_ffv_952;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_953> AgradCdfLogExpModNormal_ffv_953;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_954> AgradCdfLogExpModNormal_ffv_954;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_955> AgradCdfLogExpModNormal_ffv_955;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_956> AgradCdfLogExpModNormal_ffv_956;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_957> AgradCdfLogExpModNormal_ffv_957;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_958> AgradCdfLogExpModNormal_ffv_958;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_959> AgradCdfLogExpModNormal_ffv_959;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_960> AgradCdfLogExpModNormal_ffv_960;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_961> AgradCdfLogExpModNormal_ffv_961;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_962> AgradCdfLogExpModNormal_ffv_962;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_963> AgradCdfLogExpModNormal_ffv_963;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_964> AgradCdfLogExpModNormal_ffv_964;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_965> AgradCdfLogExpModNormal_ffv_965;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_966> AgradCdfLogExpModNormal_ffv_966;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_967> AgradCdfLogExpModNormal_ffv_967;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_968> AgradCdfLogExpModNormal_ffv_968;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_969> AgradCdfLogExpModNormal_ffv_969;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_970> AgradCdfLogExpModNormal_ffv_970;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_971> AgradCdfLogExpModNormal_ffv_971;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_972> AgradCdfLogExpModNormal_ffv_972;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_973> AgradCdfLogExpModNormal_ffv_973;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_974> AgradCdfLogExpModNormal_ffv_974;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_975> AgradCdfLogExpModNormal_ffv_975;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_976> AgradCdfLogExpModNormal_ffv_976;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_977> AgradCdfLogExpModNormal_ffv_977;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_978> AgradCdfLogExpModNormal_ffv_978;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_979> AgradCdfLogExpModNormal_ffv_979;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_980> AgradCdfLogExpModNormal_ffv_980;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_981> AgradCdfLogExpModNormal_ffv_981;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_982> AgradCdfLogExpModNormal_ffv_982;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_983> AgradCdfLogExpModNormal_ffv_983;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_984> AgradCdfLogExpModNormal_ffv_984;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_985> AgradCdfLogExpModNormal_ffv_985;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_986> AgradCdfLogExpModNormal_ffv_986;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_987> AgradCdfLogExpModNormal_ffv_987;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_988> AgradCdfLogExpModNormal_ffv_988;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_989> AgradCdfLogExpModNormal_ffv_989;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_990> AgradCdfLogExpModNormal_ffv_990;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_991> AgradCdfLogExpModNormal_ffv_991;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_992> AgradCdfLogExpModNormal_ffv_992;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_993> AgradCdfLogExpModNormal_ffv_993;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_994> AgradCdfLogExpModNormal_ffv_994;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_995> AgradCdfLogExpModNormal_ffv_995;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_996> AgradCdfLogExpModNormal_ffv_996;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_997> AgradCdfLogExpModNormal_ffv_997;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_998> AgradCdfLogExpModNormal_ffv_998;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_999> AgradCdfLogExpModNormal_ffv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_900, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_901, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_902, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_903, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_904, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_905, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_906, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_907, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_908, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_909, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_910, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_911, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_912, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_913, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_914, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_915, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_916, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_917, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_918, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_919, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_920, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_921, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_922, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_923, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_924, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_925, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_926, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_927, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_928, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_929, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_930, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_931, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_932, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_933, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_934, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_935, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_936, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_937, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_938, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_939, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_940, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_941, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_942, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_943, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_944, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_945, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_946, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_947, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_948, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_949, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_950, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_951, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_952, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_953, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_954, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_955, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_956, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_957, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_958, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_959, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_960, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_961, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_962, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_963, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_964, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_965, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_966, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_967, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_968, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_969, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_970, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_971, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_972, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_973, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_974, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_975, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_976, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_977, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_978, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_979, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_980, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_981, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_982, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_983, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_984, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_985, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_986, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_987, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_988, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_989, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_990, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_991, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_992, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_993, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_994, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_995, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_996, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_997, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_998, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_999, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_v_900;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_901;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_902;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_v_903;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_904;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_905;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_906;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_907;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_908;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_909;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_910;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_911;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_912;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_913;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_914;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_915;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_916;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_917;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_v_918;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_919;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_920;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_v_921;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_922;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_923;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_924;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_925;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_926;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_927;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_928;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_929;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_930;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_931;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_932;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_933;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_934;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_935;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_936;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_937;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_938;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_939;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_940;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_941;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_942;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_943;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_944;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_945;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_946;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_947;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_948;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_949;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_950;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_951;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_952;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_953;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_954;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_955;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_956;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_957;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_958;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_959;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_960;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_961;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_962;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_963;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_964;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_965;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_966;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_967;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_968;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_969;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_970;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_971;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_v_972;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_v_973;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_974;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_v_975;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_v_976;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_977;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_v_978;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_979;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_980;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_v_981;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_982;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_983;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_984;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_985;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_986;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_987;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_988;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_989;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_v_990;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_v_991;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_992;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_v_993;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_v_994;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_995;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_v_996;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_997;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_998;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_v_999;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_900> AgradCdfLogExpModNormal_v_900;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_901> AgradCdfLogExpModNormal_v_901;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_902> AgradCdfLogExpModNormal_v_902;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_903> AgradCdfLogExpModNormal_v_903;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_904> AgradCdfLogExpModNormal_v_904;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_905> AgradCdfLogExpModNormal_v_905;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_906> AgradCdfLogExpModNormal_v_906;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_907> AgradCdfLogExpModNormal_v_907;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_908> AgradCdfLogExpModNormal_v_908;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_909> AgradCdfLogExpModNormal_v_909;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_910> AgradCdfLogExpModNormal_v_910;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_911> AgradCdfLogExpModNormal_v_911;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_912> AgradCdfLogExpModNormal_v_912;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_913> AgradCdfLogExpModNormal_v_913;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_914> AgradCdfLogExpModNormal_v_914;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_915> AgradCdfLogExpModNormal_v_915;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_916> AgradCdfLogExpModNormal_v_916;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_917> AgradCdfLogExpModNormal_v_917;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_918> AgradCdfLogExpModNormal_v_918;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_919> AgradCdfLogExpModNormal_v_919;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_920> AgradCdfLogExpModNormal_v_920;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_921> AgradCdfLogExpModNormal_v_921;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_922> AgradCdfLogExpModNormal_v_922;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_923> AgradCdfLogExpModNormal_v_923;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_924> AgradCdfLogExpModNormal_v_924;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_925> AgradCdfLogExpModNormal_v_925;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_926> AgradCdfLogExpModNormal_v_926;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_927> AgradCdfLogExpModNormal_v_927;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_928> AgradCdfLogExpModNormal_v_928;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_929> AgradCdfLogExpModNormal_v_929;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_930> AgradCdfLogExpModNormal_v_930;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_931> AgradCdfLogExpModNormal_v_931;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_932> AgradCdfLogExpModNormal_v_932;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_933> AgradCdfLogExpModNormal_v_933;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_934> AgradCdfLogExpModNormal_v_934;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_935> AgradCdfLogExpModNormal_v_935;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_936> AgradCdfLogExpModNormal_v_936;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_937> AgradCdfLogExpModNormal_v_937;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_938> AgradCdfLogExpModNormal_v_938;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_939> AgradCdfLogExpModNormal_v_939;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_940> AgradCdfLogExpModNormal_v_940;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_941> AgradCdfLogExpModNormal_v_941;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_942> AgradCdfLogExpModNormal_v_942;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_943> AgradCdfLogExpModNormal_v_943;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_944> AgradCdfLogExpModNormal_v_944;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_945> AgradCdfLogExpModNormal_v_945;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_946> AgradCdfLogExpModNormal_v_946;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_947> AgradCdfLogExpModNormal_v_947;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_948> AgradCdfLogExpModNormal_v_948;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_949> AgradCdfLogExpModNormal_v_949;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_950> AgradCdfLogExpModNormal_v_950;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_951> AgradCdfLogExpModNormal_v_951;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_952> AgradCdfLogExpModNormal_v_952;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_953> AgradCdfLogExpModNormal_v_953;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_954> AgradCdfLogExpModNormal_v_954;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_955> AgradCdfLogExpModNormal_v_955;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_956> AgradCdfLogExpModNormal_v_956;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_957> AgradCdfLogExpModNormal_v_957;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_958> AgradCdfLogExpModNormal_v_958;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_959> AgradCdfLogExpModNormal_v_959;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_960> AgradCdfLogExpModNormal_v_960;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_961> AgradCdfLogExpModNormal_v_961;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_962> AgradCdfLogExpModNormal_v_962;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_963> AgradCdfLogExpModNormal_v_963;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_964> AgradCdfLogExpModNormal_v_964;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_965> AgradCdfLogExpModNormal_v_965;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_966> AgradCdfLogExpModNormal_v_966;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_967> AgradCdfLogExpModNormal_v_967;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_968> AgradCdfLogExpModNormal_v_968;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_969> AgradCdfLogExpModNormal_v_969;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_970> AgradCdfLogExpModNormal_v_970;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_971> AgradCdfLogExpModNormal_v_971;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_972> AgradCdfLogExpModNormal_v_972;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_973> AgradCdfLogExpModNormal_v_973;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_974> AgradCdfLogExpModNormal_v_974;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_975> AgradCdfLogExpModNormal_v_975;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_976> AgradCdfLogExpModNormal_v_976;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_977> AgradCdfLogExpModNormal_v_977;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_978> AgradCdfLogExpModNormal_v_978;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_979> AgradCdfLogExpModNormal_v_979;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_980> AgradCdfLogExpModNormal_v_980;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_981> AgradCdfLogExpModNormal_v_981;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_982> AgradCdfLogExpModNormal_v_982;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_983> AgradCdfLogExpModNormal_v_983;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_984> AgradCdfLogExpModNormal_v_984;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_985> AgradCdfLogExpModNormal_v_985;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_986> AgradCdfLogExpModNormal_v_986;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_987> AgradCdfLogExpModNormal_v_987;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_988> AgradCdfLogExpModNormal_v_988;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_989> AgradCdfLogExpModNormal_v_989;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_990> AgradCdfLogExpModNormal_v_990;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_991> AgradCdfLogExpModNormal_v_991;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_992> AgradCdfLogExpModNormal_v_992;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_993> AgradCdfLogExpModNormal_v_993;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_994> AgradCdfLogExpModNormal_v_994;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_995> AgradCdfLogExpModNormal_v_995;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_996> AgradCdfLogExpModNormal_v_996;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_997> AgradCdfLogExpModNormal_v_997;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_998> AgradCdfLogExpModNormal_v_998;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_999> AgradCdfLogExpModNormal_v_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_900, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_901, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_902, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_903, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_904, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_905, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_906, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_907, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_908, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_909, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_910, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_911, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_912, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_913, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_914, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_915, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_916, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_917, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_918, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_919, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_920, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_921, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_922, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_923, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_924, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_925, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_926, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_927, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_928, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_929, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_930, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_931, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_932, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_933, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_934, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_935, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_936, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_937, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_938, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_939, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_940, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_941, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_942, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_943, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_944, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_945, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_946, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_947, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_948, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_949, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_950, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_951, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_952, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_953, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_954, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_955, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_956, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_957, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_958, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_959, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_960, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_961, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_962, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_963, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_964, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_965, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_966, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_967, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_968, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_969, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_970, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_971, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_972, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_973, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_974, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_975, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_976, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_977, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_978, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_979, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_980, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_981, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_982, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_983, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_984, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_985, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_986, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_987, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_988, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_989, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_990, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_991, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_992, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_993, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_994, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_995, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_996, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_997, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_998, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_999, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_vv_900;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_901;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_902;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_903;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_904;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_905;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_906;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_907;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_908;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_vv_909;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_vv_910;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_911;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_vv_912;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_vv_913;
+typedef std::tuple<std::vector<var>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_914;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_vv_915;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_916;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_917;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_vv_918;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_919;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_920;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_921;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_922;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_923;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_924;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_925;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_926;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_vv_927;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_928;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_929;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_vv_930;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_931;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_932;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_933;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_934;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_935;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_936;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_937;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_938;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_939;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_940;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_941;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_942;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_943;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_944;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_vv_945;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_946;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_947;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_vv_948;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_949;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_950;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_951;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_952;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_953;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_954;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_955;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_956;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_957;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_958;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_959;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_960;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_961;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_962;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_963;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_964;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_965;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_966;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_967;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_968;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_969;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_970;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_971;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_972;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_973;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_974;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_975;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_976;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_977;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_978;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_979;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_980;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_981;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_982;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_983;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_984;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_985;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_986;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_987;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_988;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_989;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_990;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_991;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_992;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_993;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_994;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_995;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_996;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_997;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_998;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, double, empty, empty> type_vv_999;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_900> AgradCdfLogExpModNormal_vv_900;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_901> AgradCdfLogExpModNormal_vv_901;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_902> AgradCdfLogExpModNormal_vv_902;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_903> AgradCdfLogExpModNormal_vv_903;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_904> AgradCdfLogExpModNormal_vv_904;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_905> AgradCdfLogExpModNormal_vv_905;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_906> AgradCdfLogExpModNormal_vv_906;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_907> AgradCdfLogExpModNormal_vv_907;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_908> AgradCdfLogExpModNormal_vv_908;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_909> AgradCdfLogExpModNormal_vv_909;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_910> AgradCdfLogExpModNormal_vv_910;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_911> AgradCdfLogExpModNormal_vv_911;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_912> AgradCdfLogExpModNormal_vv_912;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_913> AgradCdfLogExpModNormal_vv_913;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_914> AgradCdfLogExpModNormal_vv_914;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_915> AgradCdfLogExpModNormal_vv_915;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_916> AgradCdfLogExpModNormal_vv_916;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_917> AgradCdfLogExpModNormal_vv_917;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_918> AgradCdfLogExpModNormal_vv_918;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_919> AgradCdfLogExpModNormal_vv_919;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_920> AgradCdfLogExpModNormal_vv_920;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_921> AgradCdfLogExpModNormal_vv_921;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_922> AgradCdfLogExpModNormal_vv_922;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_923> AgradCdfLogExpModNormal_vv_923;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_924> AgradCdfLogExpModNormal_vv_924;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_925> AgradCdfLogExpModNormal_vv_925;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_926> AgradCdfLogExpModNormal_vv_926;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_927> AgradCdfLogExpModNormal_vv_927;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_928> AgradCdfLogExpModNormal_vv_928;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_929> AgradCdfLogExpModNormal_vv_929;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_930> AgradCdfLogExpModNormal_vv_930;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_931> AgradCdfLogExpModNormal_vv_931;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_932> AgradCdfLogExpModNormal_vv_932;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_933> AgradCdfLogExpModNormal_vv_933;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_934> AgradCdfLogExpModNormal_vv_934;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_935> AgradCdfLogExpModNormal_vv_935;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_936> AgradCdfLogExpModNormal_vv_936;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_937> AgradCdfLogExpModNormal_vv_937;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_938> AgradCdfLogExpModNormal_vv_938;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_939> AgradCdfLogExpModNormal_vv_939;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_940> AgradCdfLogExpModNormal_vv_940;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_941> AgradCdfLogExpModNormal_vv_941;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_942> AgradCdfLogExpModNormal_vv_942;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_943> AgradCdfLogExpModNormal_vv_943;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_944> AgradCdfLogExpModNormal_vv_944;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_945> AgradCdfLogExpModNormal_vv_945;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_946> AgradCdfLogExpModNormal_vv_946;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_947> AgradCdfLogExpModNormal_vv_947;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_948> AgradCdfLogExpModNormal_vv_948;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_949> AgradCdfLogExpModNormal_vv_949;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_950> AgradCdfLogExpModNormal_vv_950;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_951> AgradCdfLogExpModNormal_vv_951;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_952> AgradCdfLogExpModNormal_vv_952;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_953> AgradCdfLogExpModNormal_vv_953;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_954> AgradCdfLogExpModNormal_vv_954;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_955> AgradCdfLogExpModNormal_vv_955;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_956> AgradCdfLogExpModNormal_vv_956;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_957> AgradCdfLogExpModNormal_vv_957;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_958> AgradCdfLogExpModNormal_vv_958;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_959> AgradCdfLogExpModNormal_vv_959;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_960> AgradCdfLogExpModNormal_vv_960;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_961> AgradCdfLogExpModNormal_vv_961;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_962> AgradCdfLogExpModNormal_vv_962;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_963> AgradCdfLogExpModNormal_vv_963;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_964> AgradCdfLogExpModNormal_vv_964;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_965> AgradCdfLogExpModNormal_vv_965;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_966> AgradCdfLogExpModNormal_vv_966;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_967> AgradCdfLogExpModNormal_vv_967;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_968> AgradCdfLogExpModNormal_vv_968;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_969> AgradCdfLogExpModNormal_vv_969;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_970> AgradCdfLogExpModNormal_vv_970;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_971> AgradCdfLogExpModNormal_vv_971;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_972> AgradCdfLogExpModNormal_vv_972;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_973> AgradCdfLogExpModNormal_vv_973;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_974> AgradCdfLogExpModNormal_vv_974;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_975> AgradCdfLogExpModNormal_vv_975;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_976> AgradCdfLogExpModNormal_vv_976;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_977> AgradCdfLogExpModNormal_vv_977;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_978> AgradCdfLogExpModNormal_vv_978;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_979> AgradCdfLogExpModNormal_vv_979;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_980> AgradCdfLogExpModNormal_vv_980;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_981> AgradCdfLogExpModNormal_vv_981;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_982> AgradCdfLogExpModNormal_vv_982;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_983> AgradCdfLogExpModNormal_vv_983;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_984> AgradCdfLogExpModNormal_vv_984;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_985> AgradCdfLogExpModNormal_vv_985;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_986> AgradCdfLogExpModNormal_vv_986;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_987> AgradCdfLogExpModNormal_vv_987;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_988> AgradCdfLogExpModNormal_vv_988;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_989> AgradCdfLogExpModNormal_vv_989;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_990> AgradCdfLogExpModNormal_vv_990;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_991> AgradCdfLogExpModNormal_vv_991;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_992> AgradCdfLogExpModNormal_vv_992;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_993> AgradCdfLogExpModNormal_vv_993;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_994> AgradCdfLogExpModNormal_vv_994;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_995> AgradCdfLogExpModNormal_vv_995;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_996> AgradCdfLogExpModNormal_vv_996;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_997> AgradCdfLogExpModNormal_vv_997;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_998> AgradCdfLogExpModNormal_vv_998;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_999> AgradCdfLogExpModNormal_vv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_900, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_901, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_902, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_903, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_904, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_905, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_906, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_907, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_908, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_909, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_910, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_911, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_912, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_913, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_914, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_915, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_916, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_917, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_918, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_919, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_920, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_921, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_922, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_923, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_924, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_925, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_926, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_927, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_928, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_929, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_930, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_931, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_932, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_933, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_934, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_935, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_936, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_937, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_938, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_939, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_940, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_941, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_942, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_943, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_944, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_945, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_946, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_947, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_948, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_949, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_950, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_951, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_952, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_953, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_954, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_955, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_956, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_957, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_958, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_959, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_960, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_961, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_962, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_963, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_964, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_965, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_966, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_967, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_968, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_969, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_970, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_971, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_972, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_973, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_974, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_975, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_976, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_977, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_978, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_979, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_980, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_981, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_982, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_983, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_984, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_985, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_986, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_987, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_988, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_989, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_990, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_991, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_992, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_993, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_994, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_995, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_996, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_997, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_998, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_999, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_999);
+
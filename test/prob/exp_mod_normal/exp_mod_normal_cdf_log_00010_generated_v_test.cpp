@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_1000;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1001;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1002;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1003;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1004;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1005;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1006;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1007;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_v_1008;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_1009;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1010;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_v_1011;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_1012;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1013;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_1014;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_1015;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1016;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_1017;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_1018;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1019;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1020;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1021;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1022;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1023;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1024;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1025;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_v_1026;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_1027;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1028;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_v_1029;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_1030;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1031;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_1032;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_1033;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1034;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_1035;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_1036;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1037;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1038;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1039;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1040;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1041;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1042;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1043;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1044;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1045;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1046;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1047;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1048;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1049;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1050;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1051;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1052;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1053;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1054;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1055;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1056;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1057;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1058;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1059;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1060;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1061;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1062;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1063;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1064;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1065;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1066;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1067;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1068;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1069;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1070;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1071;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1072;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1073;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1074;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1075;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1076;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1077;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1078;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1079;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_1080;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_1081;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1082;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_1083;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_1084;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1085;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_1086;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_1087;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1088;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_1089;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_1090;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1091;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1092;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1093;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1094;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1095;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1096;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1097;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_1098;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_1099;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1000> AgradCdfLogExpModNormal_v_1000;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1001> AgradCdfLogExpModNormal_v_1001;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1002> AgradCdfLogExpModNormal_v_1002;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1003> AgradCdfLogExpModNormal_v_1003;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1004> AgradCdfLogExpModNormal_v_1004;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1005> AgradCdfLogExpModNormal_v_1005;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1006> AgradCdfLogExpModNormal_v_1006;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1007> AgradCdfLogExpModNormal_v_1007;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1008> AgradCdfLogExpModNormal_v_1008;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1009> AgradCdfLogExpModNormal_v_1009;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1010> AgradCdfLogExpModNormal_v_1010;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1011> AgradCdfLogExpModNormal_v_1011;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1012> AgradCdfLogExpModNormal_v_1012;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1013> AgradCdfLogExpModNormal_v_1013;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1014> AgradCdfLogExpModNormal_v_1014;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1015> AgradCdfLogExpModNormal_v_1015;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1016> AgradCdfLogExpModNormal_v_1016;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1017> AgradCdfLogExpModNormal_v_1017;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1018> AgradCdfLogExpModNormal_v_1018;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1019> AgradCdfLogExpModNormal_v_1019;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1020> AgradCdfLogExpModNormal_v_1020;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1021> AgradCdfLogExpModNormal_v_1021;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1022> AgradCdfLogExpModNormal_v_1022;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1023> AgradCdfLogExpModNormal_v_1023;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1024> AgradCdfLogExpModNormal_v_1024;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1025> AgradCdfLogExpModNormal_v_1025;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1026> AgradCdfLogExpModNormal_v_1026;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1027> AgradCdfLogExpModNormal_v_1027;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1028> AgradCdfLogExpModNormal_v_1028;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1029> AgradCdfLogExpModNormal_v_1029;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1030> AgradCdfLogExpModNormal_v_1030;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1031> AgradCdfLogExpModNormal_v_1031;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1032> AgradCdfLogExpModNormal_v_1032;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1033> AgradCdfLogExpModNormal_v_1033;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1034> AgradCdfLogExpModNormal_v_1034;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1035> AgradCdfLogExpModNormal_v_1035;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1036> AgradCdfLogExpModNormal_v_1036;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1037> AgradCdfLogExpModNormal_v_1037;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1038> AgradCdfLogExpModNormal_v_1038;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1039> AgradCdfLogExpModNormal_v_1039;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1040> AgradCdfLogExpModNormal_v_1040;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1041> AgradCdfLogExpModNormal_v_1041;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1042> AgradCdfLogExpModNormal_v_1042;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1043> AgradCdfLogExpModNormal_v_1043;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1044> AgradCdfLogExpModNormal_v_1044;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1045> AgradCdfLogExpModNormal_v_1045;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1046> AgradCdfLogExpModNormal_v_1046;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1047> AgradCdfLogExpModNormal_v_1047;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1048> AgradCdfLogExpModNormal_v_1048;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1049> AgradCdfLogExpModNormal_v_1049;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1050> AgradCdfLogExpModNormal_v_1050;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1051> AgradCdfLogExpModNormal_v_1051;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1052> AgradCdfLogExpModNormal_v_1052;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1053> AgradCdfLogExpModNormal_v_1053;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1054> AgradCdfLogExpModNormal_v_1054;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1055> AgradCdfLogExpModNormal_v_1055;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1056> AgradCdfLogExpModNormal_v_1056;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1057> AgradCdfLogExpModNormal_v_1057;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1058> AgradCdfLogExpModNormal_v_1058;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1059> AgradCdfLogExpModNormal_v_1059;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1060> AgradCdfLogExpModNormal_v_1060;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1061> AgradCdfLogExpModNormal_v_1061;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1062> AgradCdfLogExpModNormal_v_1062;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1063> AgradCdfLogExpModNormal_v_1063;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1064> AgradCdfLogExpModNormal_v_1064;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1065> AgradCdfLogExpModNormal_v_1065;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1066> AgradCdfLogExpModNormal_v_1066;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1067> AgradCdfLogExpModNormal_v_1067;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1068> AgradCdfLogExpModNormal_v_1068;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1069> AgradCdfLogExpModNormal_v_1069;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1070> AgradCdfLogExpModNormal_v_1070;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1071> AgradCdfLogExpModNormal_v_1071;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1072> AgradCdfLogExpModNormal_v_1072;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1073> AgradCdfLogExpModNormal_v_1073;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1074> AgradCdfLogExpModNormal_v_1074;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1075> AgradCdfLogExpModNormal_v_1075;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1076> AgradCdfLogExpModNormal_v_1076;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1077> AgradCdfLogExpModNormal_v_1077;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1078> AgradCdfLogExpModNormal_v_1078;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1079> AgradCdfLogExpModNormal_v_1079;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1080> AgradCdfLogExpModNormal_v_1080;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1081> AgradCdfLogExpModNormal_v_1081;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1082> AgradCdfLogExpModNormal_v_1082;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1083> AgradCdfLogExpModNormal_v_1083;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1084> AgradCdfLogExpModNormal_v_1084;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1085> AgradCdfLogExpModNormal_v_1085;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1086> AgradCdfLogExpModNormal_v_1086;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1087> AgradCdfLogExpModNormal_v_1087;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1088> AgradCdfLogExpModNormal_v_1088;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1089> AgradCdfLogExpModNormal_v_1089;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1090> AgradCdfLogExpModNormal_v_1090;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1091> AgradCdfLogExpModNormal_v_1091;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1092> AgradCdfLogExpModNormal_v_1092;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1093> AgradCdfLogExpModNormal_v_1093;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1094> AgradCdfLogExpModNormal_v_1094;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1095> AgradCdfLogExpModNormal_v_1095;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1096> AgradCdfLogExpModNormal_v_1096;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1097> AgradCdfLogExpModNormal_v_1097;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1098> AgradCdfLogExpModNormal_v_1098;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1099> AgradCdfLogExpModNormal_v_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1000, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1001, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1002, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1003, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1004, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1005, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1006, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1007, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1008, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1009, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1010, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1011, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1012, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1013, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1014, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1015, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1016, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1017, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1018, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1019, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1020, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1021, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1022, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1023, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1024, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1025, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1026, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1027, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1028, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1029, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1030, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1031, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1032, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1033, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1034, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1035, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1036, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1037, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1038, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1039, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1040, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1041, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1042, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1043, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1044, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1045, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1046, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1047, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1048, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1049, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1050, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1051, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1052, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1053, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1054, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1055, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1056, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1057, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1058, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1059, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1060, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1061, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1062, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1063, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1064, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1065, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1066, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1067, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1068, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1069, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1070, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1071, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1072, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1073, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1074, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1075, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1076, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1077, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1078, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1079, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1080, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1081, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1082, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1083, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1084, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1085, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1086, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1087, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1088, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1089, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1090, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1091, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1092, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1093, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1094, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1095, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1096, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1097, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1098, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1099, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1100;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1101;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1102;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1103;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1104;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1105;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1106;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_1107;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_1108;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1109;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_1110;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1111;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1112;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_1113;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1114;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1115;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1116;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1117;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1118;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1119;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1120;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1121;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1122;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1123;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1124;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_1125;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1126;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1127;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1128;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1129;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1130;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1131;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1132;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1133;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1134;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1135;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1136;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1137;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1138;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1139;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1140;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1141;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1142;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_1143;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_1144;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1145;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_1146;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1147;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1148;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_1149;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1150;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1151;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_1161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_1179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_1180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_1182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_1185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1188;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1189;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1190;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1191;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1192;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1193;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1194;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1195;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1196;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_1197;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1198;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1199;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1100> AgradCdfLogExpModNormal_ffv_1100;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1101> AgradCdfLogExpModNormal_ffv_1101;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1102> AgradCdfLogExpModNormal_ffv_1102;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1103> AgradCdfLogExpModNormal_ffv_1103;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1104> AgradCdfLogExpModNormal_ffv_1104;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1105> AgradCdfLogExpModNormal_ffv_1105;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1106> AgradCdfLogExpModNormal_ffv_1106;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1107> AgradCdfLogExpModNormal_ffv_1107;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1108> AgradCdfLogExpModNormal_ffv_1108;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1109> AgradCdfLogExpModNormal_ffv_1109;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1110> AgradCdfLogExpModNormal_ffv_1110;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1111> AgradCdfLogExpModNormal_ffv_1111;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1112> AgradCdfLogExpModNormal_ffv_1112;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1113> AgradCdfLogExpModNormal_ffv_1113;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1114> AgradCdfLogExpModNormal_ffv_1114;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1115> AgradCdfLogExpModNormal_ffv_1115;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1116> AgradCdfLogExpModNormal_ffv_1116;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1117> AgradCdfLogExpModNormal_ffv_1117;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1118> AgradCdfLogExpModNormal_ffv_1118;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1119> AgradCdfLogExpModNormal_ffv_1119;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1120> AgradCdfLogExpModNormal_ffv_1120;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1121> AgradCdfLogExpModNormal_ffv_1121;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1122> AgradCdfLogExpModNormal_ffv_1122;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1123> AgradCdfLogExpModNormal_ffv_1123;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1124> AgradCdfLogExpModNormal_ffv_1124;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1125> AgradCdfLogExpModNormal_ffv_1125;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1126> AgradCdfLogExpModNormal_ffv_1126;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1127> AgradCdfLogExpModNormal_ffv_1127;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1128> AgradCdfLogExpModNormal_ffv_1128;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1129> AgradCdfLogExpModNormal_ffv_1129;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1130> AgradCdfLogExpModNormal_ffv_1130;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1131> AgradCdfLogExpModNormal_ffv_1131;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1132> AgradCdfLogExpModNormal_ffv_1132;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1133> AgradCdfLogExpModNormal_ffv_1133;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1134> AgradCdfLogExpModNormal_ffv_1134;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1135> AgradCdfLogExpModNormal_ffv_1135;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1136> AgradCdfLogExpModNormal_ffv_1136;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1137> AgradCdfLogExpModNormal_ffv_1137;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1138> AgradCdfLogExpModNormal_ffv_1138;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1139> AgradCdfLogExpModNormal_ffv_1139;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1140> AgradCdfLogExpModNormal_ffv_1140;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1141> AgradCdfLogExpModNormal_ffv_1141;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1142> AgradCdfLogExpModNormal_ffv_1142;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1143> AgradCdfLogExpModNormal_ffv_1143;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1144> AgradCdfLogExpModNormal_ffv_1144;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1145> AgradCdfLogExpModNormal_ffv_1145;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1146> AgradCdfLogExpModNormal_ffv_1146;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1147> AgradCdfLogExpModNormal_ffv_1147;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1148> AgradCdfLogExpModNormal_ffv_1148;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1149> AgradCdfLogExpModNormal_ffv_1149;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1150> AgradCdfLogExpModNormal_ffv_1150;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1151> AgradCdfLogExpModNormal_ffv_1151;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1152> AgradCdfLogExpModNormal_ffv_1152;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1153> AgradCdfLogExpModNormal_ffv_1153;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1154> AgradCdfLogExpModNormal_ffv_1154;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1155> AgradCdfLogExpModNormal_ffv_1155;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1156> AgradCdfLogExpModNormal_ffv_1156;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1157> AgradCdfLogExpModNormal_ffv_1157;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1158> AgradCdfLogExpModNormal_ffv_1158;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1159> AgradCdfLogExpModNormal_ffv_1159;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1160> AgradCdfLogExpModNormal_ffv_1160;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1161> AgradCdfLogExpModNormal_ffv_1161;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1162> AgradCdfLogExpModNormal_ffv_1162;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1163> AgradCdfLogExpModNormal_ffv_1163;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1164> AgradCdfLogExpModNormal_ffv_1164;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1165> AgradCdfLogExpModNormal_ffv_1165;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1166> AgradCdfLogExpModNormal_ffv_1166;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1167> AgradCdfLogExpModNormal_ffv_1167;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1168> AgradCdfLogExpModNormal_ffv_1168;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1169> AgradCdfLogExpModNormal_ffv_1169;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1170> AgradCdfLogExpModNormal_ffv_1170;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1171> AgradCdfLogExpModNormal_ffv_1171;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1172> AgradCdfLogExpModNormal_ffv_1172;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1173> AgradCdfLogExpModNormal_ffv_1173;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1174> AgradCdfLogExpModNormal_ffv_1174;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1175> AgradCdfLogExpModNormal_ffv_1175;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1176> AgradCdfLogExpModNormal_ffv_1176;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1177> AgradCdfLogExpModNormal_ffv_1177;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1178> AgradCdfLogExpModNormal_ffv_1178;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1179> AgradCdfLogExpModNormal_ffv_1179;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1180> AgradCdfLogExpModNormal_ffv_1180;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1181> AgradCdfLogExpModNormal_ffv_1181;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1182> AgradCdfLogExpModNormal_ffv_1182;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1183> AgradCdfLogExpModNormal_ffv_1183;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1184> AgradCdfLogExpModNormal_ffv_1184;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1185> AgradCdfLogExpModNormal_ffv_1185;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1186> AgradCdfLogExpModNormal_ffv_1186;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1187> AgradCdfLogExpModNormal_ffv_1187;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1188> AgradCdfLogExpModNormal_ffv_1188;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1189> AgradCdfLogExpModNormal_ffv_1189;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1190> AgradCdfLogExpModNormal_ffv_1190;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1191> AgradCdfLogExpModNormal_ffv_1191;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1192> AgradCdfLogExpModNormal_ffv_1192;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1193> AgradCdfLogExpModNormal_ffv_1193;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1194> AgradCdfLogExpModNormal_ffv_1194;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1195> AgradCdfLogExpModNormal_ffv_1195;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1196> AgradCdfLogExpModNormal_ffv_1196;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1197> AgradCdfLogExpModNormal_ffv_1197;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1198> AgradCdfLogExpModNormal_ffv_1198;
+typedef std::tuple<AgradCdfLogExpModNormal, type_ffv_1199> AgradCdfLogExpModNormal_ffv_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1100, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1101, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1102, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1103, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1104, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1105, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1106, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1107, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1108, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1109, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1110, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1111, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1112, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1113, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1114, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1115, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1116, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1117, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1118, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1119, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1120, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1121, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1122, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1123, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1124, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1125, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1126, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1127, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1128, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1129, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1130, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1131, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1132, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1133, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1134, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1135, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1136, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1137, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1138, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1139, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1140, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1141, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1142, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1143, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1144, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1145, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1146, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1147, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1148, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1149, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1150, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1151, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1152, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1153, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1154, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1155, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1156, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1157, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1158, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1159, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1160, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1161, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1162, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1163, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1164, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1165, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1166, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1167, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1168, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1169, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1170, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1171, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1172, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1173, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1174, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1175, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1176, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1177, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1178, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1179, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1180, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1181, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1182, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1183, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1184, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1185, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1186, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1187, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1188, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1189, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1190, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1191, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1192, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1193, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1194, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1195, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1196, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1197, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1198, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_ffv_1199, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_ffv_1199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1100;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1101;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1102;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1103;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1104;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1105;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1106;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, double, empty, empty> type_vv_1107;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, std::vector<double>, empty, empty> type_vv_1108;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1109;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, var, empty, empty> type_vv_1110;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, std::vector<var>, empty, empty> type_vv_1111;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1112;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, double, empty, empty> type_vv_1113;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_1114;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1115;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, var, empty, empty> type_vv_1116;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_1117;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1118;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1119;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1120;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1121;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1122;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1123;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1124;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, double, empty, empty> type_vv_1125;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, std::vector<double>, empty, empty> type_vv_1126;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1127;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, var, empty, empty> type_vv_1128;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, std::vector<var>, empty, empty> type_vv_1129;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1130;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, double, empty, empty> type_vv_1131;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_1132;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1133;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, var, empty, empty> type_vv_1134;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_1135;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1136;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1137;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1138;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1139;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1140;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1141;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1142;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, double, empty, empty> type_vv_1143;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_1144;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1145;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, var, empty, empty> type_vv_1146;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_1147;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1148;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_1149;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_1150;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1151;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_1152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_1153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, double, empty, empty> type_vv_1161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_1162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, var, empty, empty> type_vv_1164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_1165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_1167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_1168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_1170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_1171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_1179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_1180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_1182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_1183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_1185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_1186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_1188;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_1189;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1190;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1191;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1192;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1193;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1194;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1195;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1196;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_1197;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_1198;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1199;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1100> AgradCdfLogExpModNormal_vv_1100;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1101> AgradCdfLogExpModNormal_vv_1101;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1102> AgradCdfLogExpModNormal_vv_1102;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1103> AgradCdfLogExpModNormal_vv_1103;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1104> AgradCdfLogExpModNormal_vv_1104;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1105> AgradCdfLogExpModNormal_vv_1105;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1106> AgradCdfLogExpModNormal_vv_1106;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1107> AgradCdfLogExpModNormal_vv_1107;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1108> AgradCdfLogExpModNormal_vv_1108;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1109> AgradCdfLogExpModNormal_vv_1109;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1110> AgradCdfLogExpModNormal_vv_1110;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1111> AgradCdfLogExpModNormal_vv_1111;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1112> AgradCdfLogExpModNormal_vv_1112;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1113> AgradCdfLogExpModNormal_vv_1113;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1114> AgradCdfLogExpModNormal_vv_1114;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1115> AgradCdfLogExpModNormal_vv_1115;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1116> AgradCdfLogExpModNormal_vv_1116;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1117> AgradCdfLogExpModNormal_vv_1117;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1118> AgradCdfLogExpModNormal_vv_1118;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1119> AgradCdfLogExpModNormal_vv_1119;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1120> AgradCdfLogExpModNormal_vv_1120;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1121> AgradCdfLogExpModNormal_vv_1121;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1122> AgradCdfLogExpModNormal_vv_1122;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1123> AgradCdfLogExpModNormal_vv_1123;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1124> AgradCdfLogExpModNormal_vv_1124;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1125> AgradCdfLogExpModNormal_vv_1125;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1126> AgradCdfLogExpModNormal_vv_1126;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1127> AgradCdfLogExpModNormal_vv_1127;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1128> AgradCdfLogExpModNormal_vv_1128;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1129> AgradCdfLogExpModNormal_vv_1129;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1130> AgradCdfLogExpModNormal_vv_1130;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1131> AgradCdfLogExpModNormal_vv_1131;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1132> AgradCdfLogExpModNormal_vv_1132;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1133> AgradCdfLogExpModNormal_vv_1133;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1134> AgradCdfLogExpModNormal_vv_1134;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1135> AgradCdfLogExpModNormal_vv_1135;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1136> AgradCdfLogExpModNormal_vv_1136;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1137> AgradCdfLogExpModNormal_vv_1137;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1138> AgradCdfLogExpModNormal_vv_1138;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1139> AgradCdfLogExpModNormal_vv_1139;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1140> AgradCdfLogExpModNormal_vv_1140;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1141> AgradCdfLogExpModNormal_vv_1141;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1142> AgradCdfLogExpModNormal_vv_1142;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1143> AgradCdfLogExpModNormal_vv_1143;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1144> AgradCdfLogExpModNormal_vv_1144;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1145> AgradCdfLogExpModNormal_vv_1145;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1146> AgradCdfLogExpModNormal_vv_1146;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1147> AgradCdfLogExpModNormal_vv_1147;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1148> AgradCdfLogExpModNormal_vv_1148;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1149> AgradCdfLogExpModNormal_vv_1149;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1150> AgradCdfLogExpModNormal_vv_1150;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1151> AgradCdfLogExpModNormal_vv_1151;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1152> AgradCdfLogExpModNormal_vv_1152;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1153> AgradCdfLogExpModNormal_vv_1153;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1154> AgradCdfLogExpModNormal_vv_1154;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1155> AgradCdfLogExpModNormal_vv_1155;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1156> AgradCdfLogExpModNormal_vv_1156;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1157> AgradCdfLogExpModNormal_vv_1157;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1158> AgradCdfLogExpModNormal_vv_1158;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1159> AgradCdfLogExpModNormal_vv_1159;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1160> AgradCdfLogExpModNormal_vv_1160;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1161> AgradCdfLogExpModNormal_vv_1161;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1162> AgradCdfLogExpModNormal_vv_1162;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1163> AgradCdfLogExpModNormal_vv_1163;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1164> AgradCdfLogExpModNormal_vv_1164;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1165> AgradCdfLogExpModNormal_vv_1165;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1166> AgradCdfLogExpModNormal_vv_1166;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1167> AgradCdfLogExpModNormal_vv_1167;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1168> AgradCdfLogExpModNormal_vv_1168;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1169> AgradCdfLogExpModNormal_vv_1169;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1170> AgradCdfLogExpModNormal_vv_1170;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1171> AgradCdfLogExpModNormal_vv_1171;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1172> AgradCdfLogExpModNormal_vv_1172;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1173> AgradCdfLogExpModNormal_vv_1173;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1174> AgradCdfLogExpModNormal_vv_1174;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1175> AgradCdfLogExpModNormal_vv_1175;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1176> AgradCdfLogExpModNormal_vv_1176;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1177> AgradCdfLogExpModNormal_vv_1177;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1178> AgradCdfLogExpModNormal_vv_1178;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1179> AgradCdfLogExpModNormal_vv_1179;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1180> AgradCdfLogExpModNormal_vv_1180;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1181> AgradCdfLogExpModNormal_vv_1181;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1182> AgradCdfLogExpModNormal_vv_1182;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1183> AgradCdfLogExpModNormal_vv_1183;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1184> AgradCdfLogExpModNormal_vv_1184;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1185> AgradCdfLogExpModNormal_vv_1185;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1186> AgradCdfLogExpModNormal_vv_1186;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1187> AgradCdfLogExpModNormal_vv_1187;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1188> AgradCdfLogExpModNormal_vv_1188;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1189> AgradCdfLogExpModNormal_vv_1189;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1190> AgradCdfLogExpModNormal_vv_1190;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1191> AgradCdfLogExpModNormal_vv_1191;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1192> AgradCdfLogExpModNormal_vv_1192;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1193> AgradCdfLogExpModNormal_vv_1193;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1194> AgradCdfLogExpModNormal_vv_1194;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1195> AgradCdfLogExpModNormal_vv_1195;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1196> AgradCdfLogExpModNormal_vv_1196;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1197> AgradCdfLogExpModNormal_vv_1197;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1198> AgradCdfLogExpModNormal_vv_1198;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1199> AgradCdfLogExpModNormal_vv_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1100, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1101, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1102, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1103, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1104, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1105, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1106, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1107, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1108, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1109, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1110, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1111, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1112, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1113, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1114, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1115, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1116, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1117, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1118, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1119, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1120, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1121, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1122, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1123, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1124, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1125, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1126, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1127, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1128, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1129, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1130, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1131, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1132, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1133, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1134, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1135, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1136, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1137, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1138, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1139, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1140, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1141, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1142, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1143, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1144, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1145, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1146, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1147, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1148, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1149, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1150, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1151, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1152, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1153, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1154, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1155, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1156, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1157, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1158, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1159, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1160, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1161, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1162, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1163, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1164, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1165, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1166, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1167, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1168, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1169, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1170, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1171, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1172, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1173, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1174, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1175, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1176, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1177, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1178, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1179, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1180, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1181, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1182, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1183, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1184, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1185, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1186, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1187, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1188, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1189, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1190, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1191, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1192, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1193, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1194, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1195, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1196, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1197, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1198, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1199, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1199);
+
@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_1206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_1207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_1209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_1210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_1212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_1213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_1215;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_1216;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1217;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1218;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1219;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1220;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1221;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1222;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1223;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_1224;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_1225;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1226;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_1227;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_1228;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1229;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_1230;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_1231;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1232;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_1233;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_1234;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1235;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1236;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1237;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1238;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1239;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1240;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1241;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_1242;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_1243;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1244;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_1245;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_1246;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1247;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_1248;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_1249;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1250;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_1251;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_1252;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1253;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1254;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1255;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1256;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1257;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1258;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1259;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1260;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1261;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1262;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1263;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1264;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1265;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1266;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1267;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1268;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1269;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1270;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1271;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1272;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1273;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1274;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1275;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1276;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1277;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1278;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1279;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1280;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1281;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1282;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1283;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1284;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1285;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1286;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1287;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1288;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1289;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1290;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1291;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1292;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1293;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1294;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1295;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1200> AgradCdfLogExpModNormal_v_1200;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1201> AgradCdfLogExpModNormal_v_1201;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1202> AgradCdfLogExpModNormal_v_1202;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1203> AgradCdfLogExpModNormal_v_1203;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1204> AgradCdfLogExpModNormal_v_1204;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1205> AgradCdfLogExpModNormal_v_1205;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1206> AgradCdfLogExpModNormal_v_1206;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1207> AgradCdfLogExpModNormal_v_1207;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1208> AgradCdfLogExpModNormal_v_1208;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1209> AgradCdfLogExpModNormal_v_1209;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1210> AgradCdfLogExpModNormal_v_1210;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1211> AgradCdfLogExpModNormal_v_1211;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1212> AgradCdfLogExpModNormal_v_1212;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1213> AgradCdfLogExpModNormal_v_1213;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1214> AgradCdfLogExpModNormal_v_1214;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1215> AgradCdfLogExpModNormal_v_1215;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1216> AgradCdfLogExpModNormal_v_1216;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1217> AgradCdfLogExpModNormal_v_1217;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1218> AgradCdfLogExpModNormal_v_1218;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1219> AgradCdfLogExpModNormal_v_1219;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1220> AgradCdfLogExpModNormal_v_1220;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1221> AgradCdfLogExpModNormal_v_1221;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1222> AgradCdfLogExpModNormal_v_1222;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1223> AgradCdfLogExpModNormal_v_1223;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1224> AgradCdfLogExpModNormal_v_1224;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1225> AgradCdfLogExpModNormal_v_1225;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1226> AgradCdfLogExpModNormal_v_1226;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1227> AgradCdfLogExpModNormal_v_1227;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1228> AgradCdfLogExpModNormal_v_1228;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1229> AgradCdfLogExpModNormal_v_1229;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1230> AgradCdfLogExpModNormal_v_1230;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1231> AgradCdfLogExpModNormal_v_1231;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1232> AgradCdfLogExpModNormal_v_1232;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1233> AgradCdfLogExpModNormal_v_1233;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1234> AgradCdfLogExpModNormal_v_1234;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1235> AgradCdfLogExpModNormal_v_1235;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1236> AgradCdfLogExpModNormal_v_1236;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1237> AgradCdfLogExpModNormal_v_1237;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1238> AgradCdfLogExpModNormal_v_1238;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1239> AgradCdfLogExpModNormal_v_1239;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1240> AgradCdfLogExpModNormal_v_1240;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1241> AgradCdfLogExpModNormal_v_1241;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1242> AgradCdfLogExpModNormal_v_1242;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1243> AgradCdfLogExpModNormal_v_1243;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1244> AgradCdfLogExpModNormal_v_1244;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1245> AgradCdfLogExpModNormal_v_1245;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1246> AgradCdfLogExpModNormal_v_1246;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1247> AgradCdfLogExpModNormal_v_1247;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1248> AgradCdfLogExpModNormal_v_1248;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1249> AgradCdfLogExpModNormal_v_1249;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1250> AgradCdfLogExpModNormal_v_1250;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1251> AgradCdfLogExpModNormal_v_1251;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1252> AgradCdfLogExpModNormal_v_1252;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1253> AgradCdfLogExpModNormal_v_1253;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1254> AgradCdfLogExpModNormal_v_1254;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1255> AgradCdfLogExpModNormal_v_1255;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1256> AgradCdfLogExpModNormal_v_1256;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1257> AgradCdfLogExpModNormal_v_1257;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1258> AgradCdfLogExpModNormal_v_1258;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1259> AgradCdfLogExpModNormal_v_1259;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1260> AgradCdfLogExpModNormal_v_1260;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1261> AgradCdfLogExpModNormal_v_1261;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1262> AgradCdfLogExpModNormal_v_1262;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1263> AgradCdfLogExpModNormal_v_1263;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1264> AgradCdfLogExpModNormal_v_1264;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1265> AgradCdfLogExpModNormal_v_1265;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1266> AgradCdfLogExpModNormal_v_1266;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1267> AgradCdfLogExpModNormal_v_1267;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1268> AgradCdfLogExpModNormal_v_1268;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1269> AgradCdfLogExpModNormal_v_1269;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1270> AgradCdfLogExpModNormal_v_1270;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1271> AgradCdfLogExpModNormal_v_1271;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1272> AgradCdfLogExpModNormal_v_1272;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1273> AgradCdfLogExpModNormal_v_1273;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1274> AgradCdfLogExpModNormal_v_1274;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1275> AgradCdfLogExpModNormal_v_1275;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1276> AgradCdfLogExpModNormal_v_1276;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1277> AgradCdfLogExpModNormal_v_1277;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1278> AgradCdfLogExpModNormal_v_1278;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1279> AgradCdfLogExpModNormal_v_1279;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1280> AgradCdfLogExpModNormal_v_1280;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1281> AgradCdfLogExpModNormal_v_1281;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1282> AgradCdfLogExpModNormal_v_1282;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1283> AgradCdfLogExpModNormal_v_1283;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1284> AgradCdfLogExpModNormal_v_1284;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1285> AgradCdfLogExpModNormal_v_1285;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1286> AgradCdfLogExpModNormal_v_1286;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1287> AgradCdfLogExpModNormal_v_1287;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1288> AgradCdfLogExpModNormal_v_1288;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1289> AgradCdfLogExpModNormal_v_1289;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1290> AgradCdfLogExpModNormal_v_1290;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1291> AgradCdfLogExpModNormal_v_1291;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1292> AgradCdfLogExpModNormal_v_1292;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1293> AgradCdfLogExpModNormal_v_1293;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1294> AgradCdfLogExpModNormal_v_1294;
+typedef std::tuple<AgradCdfLogExpModNormal, type_v_1295> AgradCdfLogExpModNormal_v_1295;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1200, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1201, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1202, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1203, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1204, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1205, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1206, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1207, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1208, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1209, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1210, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1211, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1212, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1213, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1214, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1215, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1216, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1217, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1218, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1219, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1220, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1221, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1222, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1223, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1224, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1225, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1226, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1227, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1228, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1229, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1230, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1231, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1232, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1233, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1234, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1235, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1236, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1237, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1238, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1239, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1240, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1241, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1242, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1243, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1244, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1245, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1246, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1247, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1248, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1249, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1250, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1251, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1252, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1253, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1254, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1255, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1256, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1257, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1258, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1259, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1260, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1261, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1262, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1263, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1264, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1265, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1266, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1267, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1268, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1269, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1270, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1271, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1272, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1273, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1274, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1275, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1276, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1277, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1278, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1279, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1280, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1281, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1282, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1283, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1284, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1285, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1286, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1287, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1288, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1289, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1290, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1291, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1292, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1293, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1294, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_v_1295, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_v_1295);
+
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exp_mod_normal/exp_mod_normal_cdf_log_test.hpp>
+
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_1200;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_1201;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1202;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_1203;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_1204;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1205;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_1206;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_1207;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1208;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1209;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1210;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1211;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1212;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1213;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1214;
+
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1200> AgradCdfLogExpModNormal_vv_1200;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1201> AgradCdfLogExpModNormal_vv_1201;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1202> AgradCdfLogExpModNormal_vv_1202;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1203> AgradCdfLogExpModNormal_vv_1203;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1204> AgradCdfLogExpModNormal_vv_1204;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1205> AgradCdfLogExpModNormal_vv_1205;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1206> AgradCdfLogExpModNormal_vv_1206;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1207> AgradCdfLogExpModNormal_vv_1207;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1208> AgradCdfLogExpModNormal_vv_1208;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1209> AgradCdfLogExpModNormal_vv_1209;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1210> AgradCdfLogExpModNormal_vv_1210;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1211> AgradCdfLogExpModNormal_vv_1211;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1212> AgradCdfLogExpModNormal_vv_1212;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1213> AgradCdfLogExpModNormal_vv_1213;
+typedef std::tuple<AgradCdfLogExpModNormal, type_vv_1214> AgradCdfLogExpModNormal_vv_1214;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1200, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1201, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1202, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1203, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1204, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1205, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1206, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1207, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1208, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1209, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1210, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1211, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1212, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1213, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExpModNormal_vv_1214, AgradCdfLogTestFixture, AgradCdfLogExpModNormal_vv_1214);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exponential/exponential_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_2;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_3;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_4;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_8;
+typedef std::tuple<fvar<fvar<var> >, double, empty, empty, empty, empty> type_ffv_9;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, empty, empty, empty, empty> type_ffv_10;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_11;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_12;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_13;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, empty, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_17;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_18;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_19;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradDistributionsExponential, type_ffv_0> AgradDistributionsExponential_ffv_0;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_1> AgradDistributionsExponential_ffv_1;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_2> AgradDistributionsExponential_ffv_2;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_3> AgradDistributionsExponential_ffv_3;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_4> AgradDistributionsExponential_ffv_4;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_5> AgradDistributionsExponential_ffv_5;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_6> AgradDistributionsExponential_ffv_6;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_7> AgradDistributionsExponential_ffv_7;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_8> AgradDistributionsExponential_ffv_8;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_9> AgradDistributionsExponential_ffv_9;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_10> AgradDistributionsExponential_ffv_10;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_11> AgradDistributionsExponential_ffv_11;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_12> AgradDistributionsExponential_ffv_12;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_13> AgradDistributionsExponential_ffv_13;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_14> AgradDistributionsExponential_ffv_14;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_15> AgradDistributionsExponential_ffv_15;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_16> AgradDistributionsExponential_ffv_16;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_17> AgradDistributionsExponential_ffv_17;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_18> AgradDistributionsExponential_ffv_18;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_19> AgradDistributionsExponential_ffv_19;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_20> AgradDistributionsExponential_ffv_20;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_21> AgradDistributionsExponential_ffv_21;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_22> AgradDistributionsExponential_ffv_22;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_23> AgradDistributionsExponential_ffv_23;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_24> AgradDistributionsExponential_ffv_24;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_25> AgradDistributionsExponential_ffv_25;
+typedef std::tuple<AgradDistributionsExponential, type_ffv_26> AgradDistributionsExponential_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_0, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_1, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_2, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_3, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_4, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_5, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_6, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_7, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_8, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_9, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_10, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_11, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_12, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_13, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_14, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_15, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_16, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_17, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_18, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_19, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_20, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_21, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_22, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_23, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_24, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_25, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_ffv_26, AgradDistributionTestFixture, AgradDistributionsExponential_ffv_26);
+
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exponential/exponential_test.hpp>
+
+typedef std::tuple<double, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<double, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<double, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<double>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<double>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_v_18;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_v_19;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_20;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_v_21;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_v_22;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_29;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_30;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_31;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_32;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_33;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_34;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_35;
+
+typedef std::tuple<AgradDistributionsExponential, type_v_0> AgradDistributionsExponential_v_0;
+typedef std::tuple<AgradDistributionsExponential, type_v_1> AgradDistributionsExponential_v_1;
+typedef std::tuple<AgradDistributionsExponential, type_v_2> AgradDistributionsExponential_v_2;
+typedef std::tuple<AgradDistributionsExponential, type_v_3> AgradDistributionsExponential_v_3;
+typedef std::tuple<AgradDistributionsExponential, type_v_4> AgradDistributionsExponential_v_4;
+typedef std::tuple<AgradDistributionsExponential, type_v_5> AgradDistributionsExponential_v_5;
+typedef std::tuple<AgradDistributionsExponential, type_v_6> AgradDistributionsExponential_v_6;
+typedef std::tuple<AgradDistributionsExponential, type_v_7> AgradDistributionsExponential_v_7;
+typedef std::tuple<AgradDistributionsExponential, type_v_8> AgradDistributionsExponential_v_8;
+typedef std::tuple<AgradDistributionsExponential, type_v_9> AgradDistributionsExponential_v_9;
+typedef std::tuple<AgradDistributionsExponential, type_v_10> AgradDistributionsExponential_v_10;
+typedef std::tuple<AgradDistributionsExponential, type_v_11> AgradDistributionsExponential_v_11;
+typedef std::tuple<AgradDistributionsExponential, type_v_12> AgradDistributionsExponential_v_12;
+typedef std::tuple<AgradDistributionsExponential, type_v_13> AgradDistributionsExponential_v_13;
+typedef std::tuple<AgradDistributionsExponential, type_v_14> AgradDistributionsExponential_v_14;
+typedef std::tuple<AgradDistributionsExponential, type_v_15> AgradDistributionsExponential_v_15;
+typedef std::tuple<AgradDistributionsExponential, type_v_16> AgradDistributionsExponential_v_16;
+typedef std::tuple<AgradDistributionsExponential, type_v_17> AgradDistributionsExponential_v_17;
+typedef std::tuple<AgradDistributionsExponential, type_v_18> AgradDistributionsExponential_v_18;
+typedef std::tuple<AgradDistributionsExponential, type_v_19> AgradDistributionsExponential_v_19;
+typedef std::tuple<AgradDistributionsExponential, type_v_20> AgradDistributionsExponential_v_20;
+typedef std::tuple<AgradDistributionsExponential, type_v_21> AgradDistributionsExponential_v_21;
+typedef std::tuple<AgradDistributionsExponential, type_v_22> AgradDistributionsExponential_v_22;
+typedef std::tuple<AgradDistributionsExponential, type_v_23> AgradDistributionsExponential_v_23;
+typedef std::tuple<AgradDistributionsExponential, type_v_24> AgradDistributionsExponential_v_24;
+typedef std::tuple<AgradDistributionsExponential, type_v_25> AgradDistributionsExponential_v_25;
+typedef std::tuple<AgradDistributionsExponential, type_v_26> AgradDistributionsExponential_v_26;
+typedef std::tuple<AgradDistributionsExponential, type_v_27> AgradDistributionsExponential_v_27;
+typedef std::tuple<AgradDistributionsExponential, type_v_28> AgradDistributionsExponential_v_28;
+typedef std::tuple<AgradDistributionsExponential, type_v_29> AgradDistributionsExponential_v_29;
+typedef std::tuple<AgradDistributionsExponential, type_v_30> AgradDistributionsExponential_v_30;
+typedef std::tuple<AgradDistributionsExponential, type_v_31> AgradDistributionsExponential_v_31;
+typedef std::tuple<AgradDistributionsExponential, type_v_32> AgradDistributionsExponential_v_32;
+typedef std::tuple<AgradDistributionsExponential, type_v_33> AgradDistributionsExponential_v_33;
+typedef std::tuple<AgradDistributionsExponential, type_v_34> AgradDistributionsExponential_v_34;
+typedef std::tuple<AgradDistributionsExponential, type_v_35> AgradDistributionsExponential_v_35;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_0, AgradDistributionTestFixture, AgradDistributionsExponential_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_1, AgradDistributionTestFixture, AgradDistributionsExponential_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_2, AgradDistributionTestFixture, AgradDistributionsExponential_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_3, AgradDistributionTestFixture, AgradDistributionsExponential_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_4, AgradDistributionTestFixture, AgradDistributionsExponential_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_5, AgradDistributionTestFixture, AgradDistributionsExponential_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_6, AgradDistributionTestFixture, AgradDistributionsExponential_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_7, AgradDistributionTestFixture, AgradDistributionsExponential_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_8, AgradDistributionTestFixture, AgradDistributionsExponential_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_9, AgradDistributionTestFixture, AgradDistributionsExponential_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_10, AgradDistributionTestFixture, AgradDistributionsExponential_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_11, AgradDistributionTestFixture, AgradDistributionsExponential_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_12, AgradDistributionTestFixture, AgradDistributionsExponential_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_13, AgradDistributionTestFixture, AgradDistributionsExponential_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_14, AgradDistributionTestFixture, AgradDistributionsExponential_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_15, AgradDistributionTestFixture, AgradDistributionsExponential_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_16, AgradDistributionTestFixture, AgradDistributionsExponential_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_17, AgradDistributionTestFixture, AgradDistributionsExponential_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_18, AgradDistributionTestFixture, AgradDistributionsExponential_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_19, AgradDistributionTestFixture, AgradDistributionsExponential_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_20, AgradDistributionTestFixture, AgradDistributionsExponential_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_21, AgradDistributionTestFixture, AgradDistributionsExponential_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_22, AgradDistributionTestFixture, AgradDistributionsExponential_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_23, AgradDistributionTestFixture, AgradDistributionsExponential_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_24, AgradDistributionTestFixture, AgradDistributionsExponential_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_25, AgradDistributionTestFixture, AgradDistributionsExponential_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_26, AgradDistributionTestFixture, AgradDistributionsExponential_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_27, AgradDistributionTestFixture, AgradDistributionsExponential_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_28, AgradDistributionTestFixture, AgradDistributionsExponential_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_29, AgradDistributionTestFixture, AgradDistributionsExponential_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_30, AgradDistributionTestFixture, AgradDistributionsExponential_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_31, AgradDistributionTestFixture, AgradDistributionsExponential_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_32, AgradDistributionTestFixture, AgradDistributionsExponential_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_33, AgradDistributionTestFixture, AgradDistributionsExponential_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_34, AgradDistributionTestFixture, AgradDistributionsExponential_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_v_35, AgradDistributionTestFixture, AgradDistributionsExponential_v_35);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exponential/exponential_test.hpp>
+
+typedef std::tuple<double, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_vv_9;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_vv_10;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_11;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_vv_12;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_vv_13;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_17;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_vv_18;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_vv_19;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_20;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty, empty> type_vv_21;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty, empty> type_vv_22;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_23;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty, empty> type_vv_24;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty, empty> type_vv_25;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradDistributionsExponential, type_vv_0> AgradDistributionsExponential_vv_0;
+typedef std::tuple<AgradDistributionsExponential, type_vv_1> AgradDistributionsExponential_vv_1;
+typedef std::tuple<AgradDistributionsExponential, type_vv_2> AgradDistributionsExponential_vv_2;
+typedef std::tuple<AgradDistributionsExponential, type_vv_3> AgradDistributionsExponential_vv_3;
+typedef std::tuple<AgradDistributionsExponential, type_vv_4> AgradDistributionsExponential_vv_4;
+typedef std::tuple<AgradDistributionsExponential, type_vv_5> AgradDistributionsExponential_vv_5;
+typedef std::tuple<AgradDistributionsExponential, type_vv_6> AgradDistributionsExponential_vv_6;
+typedef std::tuple<AgradDistributionsExponential, type_vv_7> AgradDistributionsExponential_vv_7;
+typedef std::tuple<AgradDistributionsExponential, type_vv_8> AgradDistributionsExponential_vv_8;
+typedef std::tuple<AgradDistributionsExponential, type_vv_9> AgradDistributionsExponential_vv_9;
+typedef std::tuple<AgradDistributionsExponential, type_vv_10> AgradDistributionsExponential_vv_10;
+typedef std::tuple<AgradDistributionsExponential, type_vv_11> AgradDistributionsExponential_vv_11;
+typedef std::tuple<AgradDistributionsExponential, type_vv_12> AgradDistributionsExponential_vv_12;
+typedef std::tuple<AgradDistributionsExponential, type_vv_13> AgradDistributionsExponential_vv_13;
+typedef std::tuple<AgradDistributionsExponential, type_vv_14> AgradDistributionsExponential_vv_14;
+typedef std::tuple<AgradDistributionsExponential, type_vv_15> AgradDistributionsExponential_vv_15;
+typedef std::tuple<AgradDistributionsExponential, type_vv_16> AgradDistributionsExponential_vv_16;
+typedef std::tuple<AgradDistributionsExponential, type_vv_17> AgradDistributionsExponential_vv_17;
+typedef std::tuple<AgradDistributionsExponential, type_vv_18> AgradDistributionsExponential_vv_18;
+typedef std::tuple<AgradDistributionsExponential, type_vv_19> AgradDistributionsExponential_vv_19;
+typedef std::tuple<AgradDistributionsExponential, type_vv_20> AgradDistributionsExponential_vv_20;
+typedef std::tuple<AgradDistributionsExponential, type_vv_21> AgradDistributionsExponential_vv_21;
+typedef std::tuple<AgradDistributionsExponential, type_vv_22> AgradDistributionsExponential_vv_22;
+typedef std::tuple<AgradDistributionsExponential, type_vv_23> AgradDistributionsExponential_vv_23;
+typedef std::tuple<AgradDistributionsExponential, type_vv_24> AgradDistributionsExponential_vv_24;
+typedef std::tuple<AgradDistributionsExponential, type_vv_25> AgradDistributionsExponential_vv_25;
+typedef std::tuple<AgradDistributionsExponential, type_vv_26> AgradDistributionsExponential_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_0, AgradDistributionTestFixture, AgradDistributionsExponential_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_1, AgradDistributionTestFixture, AgradDistributionsExponential_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_2, AgradDistributionTestFixture, AgradDistributionsExponential_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_3, AgradDistributionTestFixture, AgradDistributionsExponential_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_4, AgradDistributionTestFixture, AgradDistributionsExponential_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_5, AgradDistributionTestFixture, AgradDistributionsExponential_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_6, AgradDistributionTestFixture, AgradDistributionsExponential_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_7, AgradDistributionTestFixture, AgradDistributionsExponential_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_8, AgradDistributionTestFixture, AgradDistributionsExponential_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_9, AgradDistributionTestFixture, AgradDistributionsExponential_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_10, AgradDistributionTestFixture, AgradDistributionsExponential_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_11, AgradDistributionTestFixture, AgradDistributionsExponential_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_12, AgradDistributionTestFixture, AgradDistributionsExponential_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_13, AgradDistributionTestFixture, AgradDistributionsExponential_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_14, AgradDistributionTestFixture, AgradDistributionsExponential_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_15, AgradDistributionTestFixture, AgradDistributionsExponential_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_16, AgradDistributionTestFixture, AgradDistributionsExponential_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_17, AgradDistributionTestFixture, AgradDistributionsExponential_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_18, AgradDistributionTestFixture, AgradDistributionsExponential_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_19, AgradDistributionTestFixture, AgradDistributionsExponential_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_20, AgradDistributionTestFixture, AgradDistributionsExponential_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_21, AgradDistributionTestFixture, AgradDistributionsExponential_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_22, AgradDistributionTestFixture, AgradDistributionsExponential_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_23, AgradDistributionTestFixture, AgradDistributionsExponential_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_24, AgradDistributionTestFixture, AgradDistributionsExponential_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_25, AgradDistributionTestFixture, AgradDistributionsExponential_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsExponential_vv_26, AgradDistributionTestFixture, AgradDistributionsExponential_vv_26);
+
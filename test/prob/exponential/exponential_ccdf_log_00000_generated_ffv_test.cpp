@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exponential/exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_2;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_3;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_4;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_8;
+typedef std::tuple<fvar<fvar<var> >, double, empty, empty, empty, empty> type_ffv_9;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, empty, empty, empty, empty> type_ffv_10;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_11;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_12;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_13;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, empty, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_17;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_18;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_19;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_0> AgradCcdfLogExponential_ffv_0;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_1> AgradCcdfLogExponential_ffv_1;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_2> AgradCcdfLogExponential_ffv_2;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_3> AgradCcdfLogExponential_ffv_3;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_4> AgradCcdfLogExponential_ffv_4;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_5> AgradCcdfLogExponential_ffv_5;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_6> AgradCcdfLogExponential_ffv_6;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_7> AgradCcdfLogExponential_ffv_7;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_8> AgradCcdfLogExponential_ffv_8;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_9> AgradCcdfLogExponential_ffv_9;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_10> AgradCcdfLogExponential_ffv_10;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_11> AgradCcdfLogExponential_ffv_11;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_12> AgradCcdfLogExponential_ffv_12;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_13> AgradCcdfLogExponential_ffv_13;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_14> AgradCcdfLogExponential_ffv_14;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_15> AgradCcdfLogExponential_ffv_15;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_16> AgradCcdfLogExponential_ffv_16;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_17> AgradCcdfLogExponential_ffv_17;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_18> AgradCcdfLogExponential_ffv_18;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_19> AgradCcdfLogExponential_ffv_19;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_20> AgradCcdfLogExponential_ffv_20;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_21> AgradCcdfLogExponential_ffv_21;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_22> AgradCcdfLogExponential_ffv_22;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_23> AgradCcdfLogExponential_ffv_23;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_24> AgradCcdfLogExponential_ffv_24;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_25> AgradCcdfLogExponential_ffv_25;
+typedef std::tuple<AgradCcdfLogExponential, type_ffv_26> AgradCcdfLogExponential_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogExponential_ffv_26);
+
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exponential/exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<double, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<double, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<double>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<double>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_v_18;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_v_19;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_20;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_v_21;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_v_22;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_29;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_30;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_31;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_32;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_33;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_34;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_35;
+
+typedef std::tuple<AgradCcdfLogExponential, type_v_0> AgradCcdfLogExponential_v_0;
+typedef std::tuple<AgradCcdfLogExponential, type_v_1> AgradCcdfLogExponential_v_1;
+typedef std::tuple<AgradCcdfLogExponential, type_v_2> AgradCcdfLogExponential_v_2;
+typedef std::tuple<AgradCcdfLogExponential, type_v_3> AgradCcdfLogExponential_v_3;
+typedef std::tuple<AgradCcdfLogExponential, type_v_4> AgradCcdfLogExponential_v_4;
+typedef std::tuple<AgradCcdfLogExponential, type_v_5> AgradCcdfLogExponential_v_5;
+typedef std::tuple<AgradCcdfLogExponential, type_v_6> AgradCcdfLogExponential_v_6;
+typedef std::tuple<AgradCcdfLogExponential, type_v_7> AgradCcdfLogExponential_v_7;
+typedef std::tuple<AgradCcdfLogExponential, type_v_8> AgradCcdfLogExponential_v_8;
+typedef std::tuple<AgradCcdfLogExponential, type_v_9> AgradCcdfLogExponential_v_9;
+typedef std::tuple<AgradCcdfLogExponential, type_v_10> AgradCcdfLogExponential_v_10;
+typedef std::tuple<AgradCcdfLogExponential, type_v_11> AgradCcdfLogExponential_v_11;
+typedef std::tuple<AgradCcdfLogExponential, type_v_12> AgradCcdfLogExponential_v_12;
+typedef std::tuple<AgradCcdfLogExponential, type_v_13> AgradCcdfLogExponential_v_13;
+typedef std::tuple<AgradCcdfLogExponential, type_v_14> AgradCcdfLogExponential_v_14;
+typedef std::tuple<AgradCcdfLogExponential, type_v_15> AgradCcdfLogExponential_v_15;
+typedef std::tuple<AgradCcdfLogExponential, type_v_16> AgradCcdfLogExponential_v_16;
+typedef std::tuple<AgradCcdfLogExponential, type_v_17> AgradCcdfLogExponential_v_17;
+typedef std::tuple<AgradCcdfLogExponential, type_v_18> AgradCcdfLogExponential_v_18;
+typedef std::tuple<AgradCcdfLogExponential, type_v_19> AgradCcdfLogExponential_v_19;
+typedef std::tuple<AgradCcdfLogExponential, type_v_20> AgradCcdfLogExponential_v_20;
+typedef std::tuple<AgradCcdfLogExponential, type_v_21> AgradCcdfLogExponential_v_21;
+typedef std::tuple<AgradCcdfLogExponential, type_v_22> AgradCcdfLogExponential_v_22;
+typedef std::tuple<AgradCcdfLogExponential, type_v_23> AgradCcdfLogExponential_v_23;
+typedef std::tuple<AgradCcdfLogExponential, type_v_24> AgradCcdfLogExponential_v_24;
+typedef std::tuple<AgradCcdfLogExponential, type_v_25> AgradCcdfLogExponential_v_25;
+typedef std::tuple<AgradCcdfLogExponential, type_v_26> AgradCcdfLogExponential_v_26;
+typedef std::tuple<AgradCcdfLogExponential, type_v_27> AgradCcdfLogExponential_v_27;
+typedef std::tuple<AgradCcdfLogExponential, type_v_28> AgradCcdfLogExponential_v_28;
+typedef std::tuple<AgradCcdfLogExponential, type_v_29> AgradCcdfLogExponential_v_29;
+typedef std::tuple<AgradCcdfLogExponential, type_v_30> AgradCcdfLogExponential_v_30;
+typedef std::tuple<AgradCcdfLogExponential, type_v_31> AgradCcdfLogExponential_v_31;
+typedef std::tuple<AgradCcdfLogExponential, type_v_32> AgradCcdfLogExponential_v_32;
+typedef std::tuple<AgradCcdfLogExponential, type_v_33> AgradCcdfLogExponential_v_33;
+typedef std::tuple<AgradCcdfLogExponential, type_v_34> AgradCcdfLogExponential_v_34;
+typedef std::tuple<AgradCcdfLogExponential, type_v_35> AgradCcdfLogExponential_v_35;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_0, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_1, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_2, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_3, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_4, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_5, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_6, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_7, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_8, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_9, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_10, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_11, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_12, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_13, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_14, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_15, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_16, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_17, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_18, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_19, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_20, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_21, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_22, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_23, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_24, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_25, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_26, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_27, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_28, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_29, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_30, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_31, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_32, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_33, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_34, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_v_35, AgradCcdfLogTestFixture, AgradCcdfLogExponential_v_35);
+
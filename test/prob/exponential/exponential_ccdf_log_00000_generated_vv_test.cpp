@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exponential/exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_vv_9;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_vv_10;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_11;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_vv_12;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_vv_13;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_17;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_vv_18;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_vv_19;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_20;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty, empty> type_vv_21;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty, empty> type_vv_22;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_23;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty, empty> type_vv_24;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty, empty> type_vv_25;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCcdfLogExponential, type_vv_0> AgradCcdfLogExponential_vv_0;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_1> AgradCcdfLogExponential_vv_1;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_2> AgradCcdfLogExponential_vv_2;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_3> AgradCcdfLogExponential_vv_3;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_4> AgradCcdfLogExponential_vv_4;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_5> AgradCcdfLogExponential_vv_5;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_6> AgradCcdfLogExponential_vv_6;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_7> AgradCcdfLogExponential_vv_7;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_8> AgradCcdfLogExponential_vv_8;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_9> AgradCcdfLogExponential_vv_9;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_10> AgradCcdfLogExponential_vv_10;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_11> AgradCcdfLogExponential_vv_11;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_12> AgradCcdfLogExponential_vv_12;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_13> AgradCcdfLogExponential_vv_13;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_14> AgradCcdfLogExponential_vv_14;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_15> AgradCcdfLogExponential_vv_15;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_16> AgradCcdfLogExponential_vv_16;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_17> AgradCcdfLogExponential_vv_17;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_18> AgradCcdfLogExponential_vv_18;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_19> AgradCcdfLogExponential_vv_19;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_20> AgradCcdfLogExponential_vv_20;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_21> AgradCcdfLogExponential_vv_21;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_22> AgradCcdfLogExponential_vv_22;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_23> AgradCcdfLogExponential_vv_23;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_24> AgradCcdfLogExponential_vv_24;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_25> AgradCcdfLogExponential_vv_25;
+typedef std::tuple<AgradCcdfLogExponential, type_vv_26> AgradCcdfLogExponential_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogExponential_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogExponential_vv_26);
+
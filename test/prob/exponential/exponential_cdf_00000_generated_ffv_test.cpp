@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exponential/exponential_cdf_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_2;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_3;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_4;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_8;
+typedef std::tuple<fvar<fvar<var> >, double, empty, empty, empty, empty> type_ffv_9;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, empty, empty, empty, empty> type_ffv_10;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_11;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_12;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_13;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, empty, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_17;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_18;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_19;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradCdfExponential, type_ffv_0> AgradCdfExponential_ffv_0;
+typedef std::tuple<AgradCdfExponential, type_ffv_1> AgradCdfExponential_ffv_1;
+typedef std::tuple<AgradCdfExponential, type_ffv_2> AgradCdfExponential_ffv_2;
+typedef std::tuple<AgradCdfExponential, type_ffv_3> AgradCdfExponential_ffv_3;
+typedef std::tuple<AgradCdfExponential, type_ffv_4> AgradCdfExponential_ffv_4;
+typedef std::tuple<AgradCdfExponential, type_ffv_5> AgradCdfExponential_ffv_5;
+typedef std::tuple<AgradCdfExponential, type_ffv_6> AgradCdfExponential_ffv_6;
+typedef std::tuple<AgradCdfExponential, type_ffv_7> AgradCdfExponential_ffv_7;
+typedef std::tuple<AgradCdfExponential, type_ffv_8> AgradCdfExponential_ffv_8;
+typedef std::tuple<AgradCdfExponential, type_ffv_9> AgradCdfExponential_ffv_9;
+typedef std::tuple<AgradCdfExponential, type_ffv_10> AgradCdfExponential_ffv_10;
+typedef std::tuple<AgradCdfExponential, type_ffv_11> AgradCdfExponential_ffv_11;
+typedef std::tuple<AgradCdfExponential, type_ffv_12> AgradCdfExponential_ffv_12;
+typedef std::tuple<AgradCdfExponential, type_ffv_13> AgradCdfExponential_ffv_13;
+typedef std::tuple<AgradCdfExponential, type_ffv_14> AgradCdfExponential_ffv_14;
+typedef std::tuple<AgradCdfExponential, type_ffv_15> AgradCdfExponential_ffv_15;
+typedef std::tuple<AgradCdfExponential, type_ffv_16> AgradCdfExponential_ffv_16;
+typedef std::tuple<AgradCdfExponential, type_ffv_17> AgradCdfExponential_ffv_17;
+typedef std::tuple<AgradCdfExponential, type_ffv_18> AgradCdfExponential_ffv_18;
+typedef std::tuple<AgradCdfExponential, type_ffv_19> AgradCdfExponential_ffv_19;
+typedef std::tuple<AgradCdfExponential, type_ffv_20> AgradCdfExponential_ffv_20;
+typedef std::tuple<AgradCdfExponential, type_ffv_21> AgradCdfExponential_ffv_21;
+typedef std::tuple<AgradCdfExponential, type_ffv_22> AgradCdfExponential_ffv_22;
+typedef std::tuple<AgradCdfExponential, type_ffv_23> AgradCdfExponential_ffv_23;
+typedef std::tuple<AgradCdfExponential, type_ffv_24> AgradCdfExponential_ffv_24;
+typedef std::tuple<AgradCdfExponential, type_ffv_25> AgradCdfExponential_ffv_25;
+typedef std::tuple<AgradCdfExponential, type_ffv_26> AgradCdfExponential_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_0, AgradCdfTestFixture, AgradCdfExponential_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_1, AgradCdfTestFixture, AgradCdfExponential_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_2, AgradCdfTestFixture, AgradCdfExponential_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_3, AgradCdfTestFixture, AgradCdfExponential_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_4, AgradCdfTestFixture, AgradCdfExponential_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_5, AgradCdfTestFixture, AgradCdfExponential_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_6, AgradCdfTestFixture, AgradCdfExponential_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_7, AgradCdfTestFixture, AgradCdfExponential_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_8, AgradCdfTestFixture, AgradCdfExponential_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_9, AgradCdfTestFixture, AgradCdfExponential_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_10, AgradCdfTestFixture, AgradCdfExponential_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_11, AgradCdfTestFixture, AgradCdfExponential_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_12, AgradCdfTestFixture, AgradCdfExponential_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_13, AgradCdfTestFixture, AgradCdfExponential_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_14, AgradCdfTestFixture, AgradCdfExponential_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_15, AgradCdfTestFixture, AgradCdfExponential_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_16, AgradCdfTestFixture, AgradCdfExponential_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_17, AgradCdfTestFixture, AgradCdfExponential_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_18, AgradCdfTestFixture, AgradCdfExponential_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_19, AgradCdfTestFixture, AgradCdfExponential_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_20, AgradCdfTestFixture, AgradCdfExponential_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_21, AgradCdfTestFixture, AgradCdfExponential_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_22, AgradCdfTestFixture, AgradCdfExponential_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_23, AgradCdfTestFixture, AgradCdfExponential_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_24, AgradCdfTestFixture, AgradCdfExponential_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_25, AgradCdfTestFixture, AgradCdfExponential_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_ffv_26, AgradCdfTestFixture, AgradCdfExponential_ffv_26);
+
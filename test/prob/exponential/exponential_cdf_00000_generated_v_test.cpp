@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exponential/exponential_cdf_test.hpp>
+
+typedef std::tuple<double, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<double, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<double, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<double>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<double>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_v_18;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_v_19;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_20;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_v_21;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_v_22;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_29;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_30;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_31;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_32;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_33;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_34;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_35;
+
+typedef std::tuple<AgradCdfExponential, type_v_0> AgradCdfExponential_v_0;
+typedef std::tuple<AgradCdfExponential, type_v_1> AgradCdfExponential_v_1;
+typedef std::tuple<AgradCdfExponential, type_v_2> AgradCdfExponential_v_2;
+typedef std::tuple<AgradCdfExponential, type_v_3> AgradCdfExponential_v_3;
+typedef std::tuple<AgradCdfExponential, type_v_4> AgradCdfExponential_v_4;
+typedef std::tuple<AgradCdfExponential, type_v_5> AgradCdfExponential_v_5;
+typedef std::tuple<AgradCdfExponential, type_v_6> AgradCdfExponential_v_6;
+typedef std::tuple<AgradCdfExponential, type_v_7> AgradCdfExponential_v_7;
+typedef std::tuple<AgradCdfExponential, type_v_8> AgradCdfExponential_v_8;
+typedef std::tuple<AgradCdfExponential, type_v_9> AgradCdfExponential_v_9;
+typedef std::tuple<AgradCdfExponential, type_v_10> AgradCdfExponential_v_10;
+typedef std::tuple<AgradCdfExponential, type_v_11> AgradCdfExponential_v_11;
+typedef std::tuple<AgradCdfExponential, type_v_12> AgradCdfExponential_v_12;
+typedef std::tuple<AgradCdfExponential, type_v_13> AgradCdfExponential_v_13;
+typedef std::tuple<AgradCdfExponential, type_v_14> AgradCdfExponential_v_14;
+typedef std::tuple<AgradCdfExponential, type_v_15> AgradCdfExponential_v_15;
+typedef std::tuple<AgradCdfExponential, type_v_16> AgradCdfExponential_v_16;
+typedef std::tuple<AgradCdfExponential, type_v_17> AgradCdfExponential_v_17;
+typedef std::tuple<AgradCdfExponential, type_v_18> AgradCdfExponential_v_18;
+typedef std::tuple<AgradCdfExponential, type_v_19> AgradCdfExponential_v_19;
+typedef std::tuple<AgradCdfExponential, type_v_20> AgradCdfExponential_v_20;
+typedef std::tuple<AgradCdfExponential, type_v_21> AgradCdfExponential_v_21;
+typedef std::tuple<AgradCdfExponential, type_v_22> AgradCdfExponential_v_22;
+typedef std::tuple<AgradCdfExponential, type_v_23> AgradCdfExponential_v_23;
+typedef std::tuple<AgradCdfExponential, type_v_24> AgradCdfExponential_v_24;
+typedef std::tuple<AgradCdfExponential, type_v_25> AgradCdfExponential_v_25;
+typedef std::tuple<AgradCdfExponential, type_v_26> AgradCdfExponential_v_26;
+typedef std::tuple<AgradCdfExponential, type_v_27> AgradCdfExponential_v_27;
+typedef std::tuple<AgradCdfExponential, type_v_28> AgradCdfExponential_v_28;
+typedef std::tuple<AgradCdfExponential, type_v_29> AgradCdfExponential_v_29;
+typedef std::tuple<AgradCdfExponential, type_v_30> AgradCdfExponential_v_30;
+typedef std::tuple<AgradCdfExponential, type_v_31> AgradCdfExponential_v_31;
+typedef std::tuple<AgradCdfExponential, type_v_32> AgradCdfExponential_v_32;
+typedef std::tuple<AgradCdfExponential, type_v_33> AgradCdfExponential_v_33;
+typedef std::tuple<AgradCdfExponential, type_v_34> AgradCdfExponential_v_34;
+typedef std::tuple<AgradCdfExponential, type_v_35> AgradCdfExponential_v_35;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_0, AgradCdfTestFixture, AgradCdfExponential_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_1, AgradCdfTestFixture, AgradCdfExponential_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_2, AgradCdfTestFixture, AgradCdfExponential_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_3, AgradCdfTestFixture, AgradCdfExponential_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_4, AgradCdfTestFixture, AgradCdfExponential_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_5, AgradCdfTestFixture, AgradCdfExponential_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_6, AgradCdfTestFixture, AgradCdfExponential_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_7, AgradCdfTestFixture, AgradCdfExponential_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_8, AgradCdfTestFixture, AgradCdfExponential_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_9, AgradCdfTestFixture, AgradCdfExponential_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_10, AgradCdfTestFixture, AgradCdfExponential_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_11, AgradCdfTestFixture, AgradCdfExponential_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_12, AgradCdfTestFixture, AgradCdfExponential_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_13, AgradCdfTestFixture, AgradCdfExponential_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_14, AgradCdfTestFixture, AgradCdfExponential_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_15, AgradCdfTestFixture, AgradCdfExponential_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_16, AgradCdfTestFixture, AgradCdfExponential_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_17, AgradCdfTestFixture, AgradCdfExponential_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_18, AgradCdfTestFixture, AgradCdfExponential_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_19, AgradCdfTestFixture, AgradCdfExponential_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_20, AgradCdfTestFixture, AgradCdfExponential_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_21, AgradCdfTestFixture, AgradCdfExponential_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_22, AgradCdfTestFixture, AgradCdfExponential_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_23, AgradCdfTestFixture, AgradCdfExponential_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_24, AgradCdfTestFixture, AgradCdfExponential_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_25, AgradCdfTestFixture, AgradCdfExponential_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_26, AgradCdfTestFixture, AgradCdfExponential_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_27, AgradCdfTestFixture, AgradCdfExponential_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_28, AgradCdfTestFixture, AgradCdfExponential_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_29, AgradCdfTestFixture, AgradCdfExponential_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_30, AgradCdfTestFixture, AgradCdfExponential_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_31, AgradCdfTestFixture, AgradCdfExponential_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_32, AgradCdfTestFixture, AgradCdfExponential_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_33, AgradCdfTestFixture, AgradCdfExponential_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_34, AgradCdfTestFixture, AgradCdfExponential_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_v_35, AgradCdfTestFixture, AgradCdfExponential_v_35);
+
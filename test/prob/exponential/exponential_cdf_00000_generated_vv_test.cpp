@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exponential/exponential_cdf_test.hpp>
+
+typedef std::tuple<double, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_vv_9;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_vv_10;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_11;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_vv_12;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_vv_13;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_17;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_vv_18;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_vv_19;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_20;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty, empty> type_vv_21;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty, empty> type_vv_22;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_23;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty, empty> type_vv_24;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty, empty> type_vv_25;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCdfExponential, type_vv_0> AgradCdfExponential_vv_0;
+typedef std::tuple<AgradCdfExponential, type_vv_1> AgradCdfExponential_vv_1;
+typedef std::tuple<AgradCdfExponential, type_vv_2> AgradCdfExponential_vv_2;
+typedef std::tuple<AgradCdfExponential, type_vv_3> AgradCdfExponential_vv_3;
+typedef std::tuple<AgradCdfExponential, type_vv_4> AgradCdfExponential_vv_4;
+typedef std::tuple<AgradCdfExponential, type_vv_5> AgradCdfExponential_vv_5;
+typedef std::tuple<AgradCdfExponential, type_vv_6> AgradCdfExponential_vv_6;
+typedef std::tuple<AgradCdfExponential, type_vv_7> AgradCdfExponential_vv_7;
+typedef std::tuple<AgradCdfExponential, type_vv_8> AgradCdfExponential_vv_8;
+typedef std::tuple<AgradCdfExponential, type_vv_9> AgradCdfExponential_vv_9;
+typedef std::tuple<AgradCdfExponential, type_vv_10> AgradCdfExponential_vv_10;
+typedef std::tuple<AgradCdfExponential, type_vv_11> AgradCdfExponential_vv_11;
+typedef std::tuple<AgradCdfExponential, type_vv_12> AgradCdfExponential_vv_12;
+typedef std::tuple<AgradCdfExponential, type_vv_13> AgradCdfExponential_vv_13;
+typedef std::tuple<AgradCdfExponential, type_vv_14> AgradCdfExponential_vv_14;
+typedef std::tuple<AgradCdfExponential, type_vv_15> AgradCdfExponential_vv_15;
+typedef std::tuple<AgradCdfExponential, type_vv_16> AgradCdfExponential_vv_16;
+typedef std::tuple<AgradCdfExponential, type_vv_17> AgradCdfExponential_vv_17;
+typedef std::tuple<AgradCdfExponential, type_vv_18> AgradCdfExponential_vv_18;
+typedef std::tuple<AgradCdfExponential, type_vv_19> AgradCdfExponential_vv_19;
+typedef std::tuple<AgradCdfExponential, type_vv_20> AgradCdfExponential_vv_20;
+typedef std::tuple<AgradCdfExponential, type_vv_21> AgradCdfExponential_vv_21;
+typedef std::tuple<AgradCdfExponential, type_vv_22> AgradCdfExponential_vv_22;
+typedef std::tuple<AgradCdfExponential, type_vv_23> AgradCdfExponential_vv_23;
+typedef std::tuple<AgradCdfExponential, type_vv_24> AgradCdfExponential_vv_24;
+typedef std::tuple<AgradCdfExponential, type_vv_25> AgradCdfExponential_vv_25;
+typedef std::tuple<AgradCdfExponential, type_vv_26> AgradCdfExponential_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_0, AgradCdfTestFixture, AgradCdfExponential_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_1, AgradCdfTestFixture, AgradCdfExponential_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_2, AgradCdfTestFixture, AgradCdfExponential_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_3, AgradCdfTestFixture, AgradCdfExponential_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_4, AgradCdfTestFixture, AgradCdfExponential_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_5, AgradCdfTestFixture, AgradCdfExponential_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_6, AgradCdfTestFixture, AgradCdfExponential_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_7, AgradCdfTestFixture, AgradCdfExponential_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_8, AgradCdfTestFixture, AgradCdfExponential_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_9, AgradCdfTestFixture, AgradCdfExponential_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_10, AgradCdfTestFixture, AgradCdfExponential_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_11, AgradCdfTestFixture, AgradCdfExponential_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_12, AgradCdfTestFixture, AgradCdfExponential_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_13, AgradCdfTestFixture, AgradCdfExponential_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_14, AgradCdfTestFixture, AgradCdfExponential_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_15, AgradCdfTestFixture, AgradCdfExponential_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_16, AgradCdfTestFixture, AgradCdfExponential_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_17, AgradCdfTestFixture, AgradCdfExponential_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_18, AgradCdfTestFixture, AgradCdfExponential_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_19, AgradCdfTestFixture, AgradCdfExponential_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_20, AgradCdfTestFixture, AgradCdfExponential_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_21, AgradCdfTestFixture, AgradCdfExponential_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_22, AgradCdfTestFixture, AgradCdfExponential_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_23, AgradCdfTestFixture, AgradCdfExponential_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_24, AgradCdfTestFixture, AgradCdfExponential_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_25, AgradCdfTestFixture, AgradCdfExponential_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfExponential_vv_26, AgradCdfTestFixture, AgradCdfExponential_vv_26);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exponential/exponential_cdf_log_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_2;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_3;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_4;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_8;
+typedef std::tuple<fvar<fvar<var> >, double, empty, empty, empty, empty> type_ffv_9;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, empty, empty, empty, empty> type_ffv_10;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_11;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_12;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_13;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, empty, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_17;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_18;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_19;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradCdfLogExponential, type_ffv_0> AgradCdfLogExponential_ffv_0;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_1> AgradCdfLogExponential_ffv_1;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_2> AgradCdfLogExponential_ffv_2;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_3> AgradCdfLogExponential_ffv_3;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_4> AgradCdfLogExponential_ffv_4;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_5> AgradCdfLogExponential_ffv_5;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_6> AgradCdfLogExponential_ffv_6;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_7> AgradCdfLogExponential_ffv_7;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_8> AgradCdfLogExponential_ffv_8;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_9> AgradCdfLogExponential_ffv_9;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_10> AgradCdfLogExponential_ffv_10;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_11> AgradCdfLogExponential_ffv_11;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_12> AgradCdfLogExponential_ffv_12;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_13> AgradCdfLogExponential_ffv_13;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_14> AgradCdfLogExponential_ffv_14;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_15> AgradCdfLogExponential_ffv_15;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_16> AgradCdfLogExponential_ffv_16;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_17> AgradCdfLogExponential_ffv_17;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_18> AgradCdfLogExponential_ffv_18;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_19> AgradCdfLogExponential_ffv_19;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_20> AgradCdfLogExponential_ffv_20;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_21> AgradCdfLogExponential_ffv_21;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_22> AgradCdfLogExponential_ffv_22;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_23> AgradCdfLogExponential_ffv_23;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_24> AgradCdfLogExponential_ffv_24;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_25> AgradCdfLogExponential_ffv_25;
+typedef std::tuple<AgradCdfLogExponential, type_ffv_26> AgradCdfLogExponential_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_0, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_1, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_2, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_3, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_4, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_5, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_6, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_7, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_8, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_9, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_10, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_11, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_12, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_13, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_14, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_15, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_16, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_17, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_18, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_19, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_20, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_21, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_22, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_23, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_24, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_25, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_ffv_26, AgradCdfLogTestFixture, AgradCdfLogExponential_ffv_26);
+
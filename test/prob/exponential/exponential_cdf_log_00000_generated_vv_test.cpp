@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/exponential/exponential_cdf_log_test.hpp>
+
+typedef std::tuple<double, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_vv_9;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_vv_10;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_11;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_vv_12;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_vv_13;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_17;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_vv_18;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_vv_19;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_20;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty, empty> type_vv_21;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty, empty> type_vv_22;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_23;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty, empty> type_vv_24;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty, empty> type_vv_25;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCdfLogExponential, type_vv_0> AgradCdfLogExponential_vv_0;
+typedef std::tuple<AgradCdfLogExponential, type_vv_1> AgradCdfLogExponential_vv_1;
+typedef std::tuple<AgradCdfLogExponential, type_vv_2> AgradCdfLogExponential_vv_2;
+typedef std::tuple<AgradCdfLogExponential, type_vv_3> AgradCdfLogExponential_vv_3;
+typedef std::tuple<AgradCdfLogExponential, type_vv_4> AgradCdfLogExponential_vv_4;
+typedef std::tuple<AgradCdfLogExponential, type_vv_5> AgradCdfLogExponential_vv_5;
+typedef std::tuple<AgradCdfLogExponential, type_vv_6> AgradCdfLogExponential_vv_6;
+typedef std::tuple<AgradCdfLogExponential, type_vv_7> AgradCdfLogExponential_vv_7;
+typedef std::tuple<AgradCdfLogExponential, type_vv_8> AgradCdfLogExponential_vv_8;
+typedef std::tuple<AgradCdfLogExponential, type_vv_9> AgradCdfLogExponential_vv_9;
+typedef std::tuple<AgradCdfLogExponential, type_vv_10> AgradCdfLogExponential_vv_10;
+typedef std::tuple<AgradCdfLogExponential, type_vv_11> AgradCdfLogExponential_vv_11;
+typedef std::tuple<AgradCdfLogExponential, type_vv_12> AgradCdfLogExponential_vv_12;
+typedef std::tuple<AgradCdfLogExponential, type_vv_13> AgradCdfLogExponential_vv_13;
+typedef std::tuple<AgradCdfLogExponential, type_vv_14> AgradCdfLogExponential_vv_14;
+typedef std::tuple<AgradCdfLogExponential, type_vv_15> AgradCdfLogExponential_vv_15;
+typedef std::tuple<AgradCdfLogExponential, type_vv_16> AgradCdfLogExponential_vv_16;
+typedef std::tuple<AgradCdfLogExponential, type_vv_17> AgradCdfLogExponential_vv_17;
+typedef std::tuple<AgradCdfLogExponential, type_vv_18> AgradCdfLogExponential_vv_18;
+typedef std::tuple<AgradCdfLogExponential, type_vv_19> AgradCdfLogExponential_vv_19;
+typedef std::tuple<AgradCdfLogExponential, type_vv_20> AgradCdfLogExponential_vv_20;
+typedef std::tuple<AgradCdfLogExponential, type_vv_21> AgradCdfLogExponential_vv_21;
+typedef std::tuple<AgradCdfLogExponential, type_vv_22> AgradCdfLogExponential_vv_22;
+typedef std::tuple<AgradCdfLogExponential, type_vv_23> AgradCdfLogExponential_vv_23;
+typedef std::tuple<AgradCdfLogExponential, type_vv_24> AgradCdfLogExponential_vv_24;
+typedef std::tuple<AgradCdfLogExponential, type_vv_25> AgradCdfLogExponential_vv_25;
+typedef std::tuple<AgradCdfLogExponential, type_vv_26> AgradCdfLogExponential_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_0, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_1, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_2, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_3, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_4, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_5, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_6, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_7, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_8, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_9, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_10, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_11, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_12, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_13, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_14, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_15, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_16, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_17, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_18, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_19, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_20, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_21, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_22, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_23, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_24, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_25, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogExponential_vv_26, AgradCdfLogTestFixture, AgradCdfLogExponential_vv_26);
+
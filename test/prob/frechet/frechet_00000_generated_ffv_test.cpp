@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_0> AgradDistributionsFrechet_ffv_0;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_1> AgradDistributionsFrechet_ffv_1;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_2> AgradDistributionsFrechet_ffv_2;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_3> AgradDistributionsFrechet_ffv_3;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_4> AgradDistributionsFrechet_ffv_4;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_5> AgradDistributionsFrechet_ffv_5;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_6> AgradDistributionsFrechet_ffv_6;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_7> AgradDistributionsFrechet_ffv_7;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_8> AgradDistributionsFrechet_ffv_8;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_9> AgradDistributionsFrechet_ffv_9;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_10> AgradDistributionsFrechet_ffv_10;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_11> AgradDistributionsFrechet_ffv_11;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_12> AgradDistributionsFrechet_ffv_12;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_13> AgradDistributionsFrechet_ffv_13;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_14> AgradDistributionsFrechet_ffv_14;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_15> AgradDistributionsFrechet_ffv_15;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_16> AgradDistributionsFrechet_ffv_16;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_17> AgradDistributionsFrechet_ffv_17;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_18> AgradDistributionsFrechet_ffv_18;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_19> AgradDistributionsFrechet_ffv_19;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_20> AgradDistributionsFrechet_ffv_20;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_21> AgradDistributionsFrechet_ffv_21;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_22> AgradDistributionsFrechet_ffv_22;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_23> AgradDistributionsFrechet_ffv_23;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_24> AgradDistributionsFrechet_ffv_24;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_25> AgradDistributionsFrechet_ffv_25;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_26> AgradDistributionsFrechet_ffv_26;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_27> AgradDistributionsFrechet_ffv_27;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_28> AgradDistributionsFrechet_ffv_28;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_29> AgradDistributionsFrechet_ffv_29;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_30> AgradDistributionsFrechet_ffv_30;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_31> AgradDistributionsFrechet_ffv_31;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_32> AgradDistributionsFrechet_ffv_32;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_33> AgradDistributionsFrechet_ffv_33;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_34> AgradDistributionsFrechet_ffv_34;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_35> AgradDistributionsFrechet_ffv_35;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_36> AgradDistributionsFrechet_ffv_36;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_37> AgradDistributionsFrechet_ffv_37;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_38> AgradDistributionsFrechet_ffv_38;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_39> AgradDistributionsFrechet_ffv_39;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_40> AgradDistributionsFrechet_ffv_40;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_41> AgradDistributionsFrechet_ffv_41;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_42> AgradDistributionsFrechet_ffv_42;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_43> AgradDistributionsFrechet_ffv_43;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_44> AgradDistributionsFrechet_ffv_44;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_45> AgradDistributionsFrechet_ffv_45;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_46> AgradDistributionsFrechet_ffv_46;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_47> AgradDistributionsFrechet_ffv_47;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_48> AgradDistributionsFrechet_ffv_48;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_49> AgradDistributionsFrechet_ffv_49;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_50> AgradDistributionsFrechet_ffv_50;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_51> AgradDistributionsFrechet_ffv_51;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_52> AgradDistributionsFrechet_ffv_52;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_53> AgradDistributionsFrechet_ffv_53;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_54> AgradDistributionsFrechet_ffv_54;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_55> AgradDistributionsFrechet_ffv_55;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_56> AgradDistributionsFrechet_ffv_56;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_57> AgradDistributionsFrechet_ffv_57;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_58> AgradDistributionsFrechet_ffv_58;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_59> AgradDistributionsFrechet_ffv_59;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_60> AgradDistributionsFrechet_ffv_60;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_61> AgradDistributionsFrechet_ffv_61;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_62> AgradDistributionsFrechet_ffv_62;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_63> AgradDistributionsFrechet_ffv_63;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_64> AgradDistributionsFrechet_ffv_64;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_65> AgradDistributionsFrechet_ffv_65;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_66> AgradDistributionsFrechet_ffv_66;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_67> AgradDistributionsFrechet_ffv_67;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_68> AgradDistributionsFrechet_ffv_68;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_69> AgradDistributionsFrechet_ffv_69;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_70> AgradDistributionsFrechet_ffv_70;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_71> AgradDistributionsFrechet_ffv_71;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_72> AgradDistributionsFrechet_ffv_72;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_73> AgradDistributionsFrechet_ffv_73;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_74> AgradDistributionsFrechet_ffv_74;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_75> AgradDistributionsFrechet_ffv_75;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_76> AgradDistributionsFrechet_ffv_76;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_77> AgradDistributionsFrechet_ffv_77;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_78> AgradDistributionsFrechet_ffv_78;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_79> AgradDistributionsFrechet_ffv_79;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_80> AgradDistributionsFrechet_ffv_80;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_81> AgradDistributionsFrechet_ffv_81;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_82> AgradDistributionsFrechet_ffv_82;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_83> AgradDistributionsFrechet_ffv_83;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_84> AgradDistributionsFrechet_ffv_84;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_85> AgradDistributionsFrechet_ffv_85;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_86> AgradDistributionsFrechet_ffv_86;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_87> AgradDistributionsFrechet_ffv_87;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_88> AgradDistributionsFrechet_ffv_88;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_89> AgradDistributionsFrechet_ffv_89;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_90> AgradDistributionsFrechet_ffv_90;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_91> AgradDistributionsFrechet_ffv_91;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_92> AgradDistributionsFrechet_ffv_92;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_93> AgradDistributionsFrechet_ffv_93;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_94> AgradDistributionsFrechet_ffv_94;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_95> AgradDistributionsFrechet_ffv_95;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_96> AgradDistributionsFrechet_ffv_96;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_97> AgradDistributionsFrechet_ffv_97;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_98> AgradDistributionsFrechet_ffv_98;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_99> AgradDistributionsFrechet_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_0, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_1, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_2, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_3, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_4, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_5, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_6, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_7, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_8, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_9, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_10, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_11, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_12, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_13, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_14, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_15, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_16, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_17, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_18, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_19, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_20, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_21, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_22, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_23, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_24, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_25, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_26, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_27, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_28, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_29, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_30, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_31, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_32, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_33, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_34, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_35, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_36, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_37, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_38, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_39, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_40, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_41, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_42, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_43, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_44, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_45, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_46, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_47, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_48, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_49, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_50, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_51, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_52, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_53, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_54, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_55, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_56, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_57, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_58, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_59, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_60, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_61, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_62, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_63, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_64, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_65, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_66, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_67, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_68, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_69, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_70, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_71, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_72, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_73, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_74, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_75, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_76, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_77, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_78, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_79, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_80, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_81, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_82, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_83, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_84, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_85, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_86, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_87, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_88, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_89, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_90, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_91, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_92, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_93, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_94, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_95, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_96, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_97, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_98, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_99, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_99);
+
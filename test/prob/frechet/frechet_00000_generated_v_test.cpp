@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsFrechet, type_v_0> AgradDistributionsFrechet_v_0;
+typedef std::tuple<AgradDistributionsFrechet, type_v_1> AgradDistributionsFrechet_v_1;
+typedef std::tuple<AgradDistributionsFrechet, type_v_2> AgradDistributionsFrechet_v_2;
+typedef std::tuple<AgradDistributionsFrechet, type_v_3> AgradDistributionsFrechet_v_3;
+typedef std::tuple<AgradDistributionsFrechet, type_v_4> AgradDistributionsFrechet_v_4;
+typedef std::tuple<AgradDistributionsFrechet, type_v_5> AgradDistributionsFrechet_v_5;
+typedef std::tuple<AgradDistributionsFrechet, type_v_6> AgradDistributionsFrechet_v_6;
+typedef std::tuple<AgradDistributionsFrechet, type_v_7> AgradDistributionsFrechet_v_7;
+typedef std::tuple<AgradDistributionsFrechet, type_v_8> AgradDistributionsFrechet_v_8;
+typedef std::tuple<AgradDistributionsFrechet, type_v_9> AgradDistributionsFrechet_v_9;
+typedef std::tuple<AgradDistributionsFrechet, type_v_10> AgradDistributionsFrechet_v_10;
+typedef std::tuple<AgradDistributionsFrechet, type_v_11> AgradDistributionsFrechet_v_11;
+typedef std::tuple<AgradDistributionsFrechet, type_v_12> AgradDistributionsFrechet_v_12;
+typedef std::tuple<AgradDistributionsFrechet, type_v_13> AgradDistributionsFrechet_v_13;
+typedef std::tuple<AgradDistributionsFrechet, type_v_14> AgradDistributionsFrechet_v_14;
+typedef std::tuple<AgradDistributionsFrechet, type_v_15> AgradDistributionsFrechet_v_15;
+typedef std::tuple<AgradDistributionsFrechet, type_v_16> AgradDistributionsFrechet_v_16;
+typedef std::tuple<AgradDistributionsFrechet, type_v_17> AgradDistributionsFrechet_v_17;
+typedef std::tuple<AgradDistributionsFrechet, type_v_18> AgradDistributionsFrechet_v_18;
+typedef std::tuple<AgradDistributionsFrechet, type_v_19> AgradDistributionsFrechet_v_19;
+typedef std::tuple<AgradDistributionsFrechet, type_v_20> AgradDistributionsFrechet_v_20;
+typedef std::tuple<AgradDistributionsFrechet, type_v_21> AgradDistributionsFrechet_v_21;
+typedef std::tuple<AgradDistributionsFrechet, type_v_22> AgradDistributionsFrechet_v_22;
+typedef std::tuple<AgradDistributionsFrechet, type_v_23> AgradDistributionsFrechet_v_23;
+typedef std::tuple<AgradDistributionsFrechet, type_v_24> AgradDistributionsFrechet_v_24;
+typedef std::tuple<AgradDistributionsFrechet, type_v_25> AgradDistributionsFrechet_v_25;
+typedef std::tuple<AgradDistributionsFrechet, type_v_26> AgradDistributionsFrechet_v_26;
+typedef std::tuple<AgradDistributionsFrechet, type_v_27> AgradDistributionsFrechet_v_27;
+typedef std::tuple<AgradDistributionsFrechet, type_v_28> AgradDistributionsFrechet_v_28;
+typedef std::tuple<AgradDistributionsFrechet, type_v_29> AgradDistributionsFrechet_v_29;
+typedef std::tuple<AgradDistributionsFrechet, type_v_30> AgradDistributionsFrechet_v_30;
+typedef std::tuple<AgradDistributionsFrechet, type_v_31> AgradDistributionsFrechet_v_31;
+typedef std::tuple<AgradDistributionsFrechet, type_v_32> AgradDistributionsFrechet_v_32;
+typedef std::tuple<AgradDistributionsFrechet, type_v_33> AgradDistributionsFrechet_v_33;
+typedef std::tuple<AgradDistributionsFrechet, type_v_34> AgradDistributionsFrechet_v_34;
+typedef std::tuple<AgradDistributionsFrechet, type_v_35> AgradDistributionsFrechet_v_35;
+typedef std::tuple<AgradDistributionsFrechet, type_v_36> AgradDistributionsFrechet_v_36;
+typedef std::tuple<AgradDistributionsFrechet, type_v_37> AgradDistributionsFrechet_v_37;
+typedef std::tuple<AgradDistributionsFrechet, type_v_38> AgradDistributionsFrechet_v_38;
+typedef std::tuple<AgradDistributionsFrechet, type_v_39> AgradDistributionsFrechet_v_39;
+typedef std::tuple<AgradDistributionsFrechet, type_v_40> AgradDistributionsFrechet_v_40;
+typedef std::tuple<AgradDistributionsFrechet, type_v_41> AgradDistributionsFrechet_v_41;
+typedef std::tuple<AgradDistributionsFrechet, type_v_42> AgradDistributionsFrechet_v_42;
+typedef std::tuple<AgradDistributionsFrechet, type_v_43> AgradDistributionsFrechet_v_43;
+typedef std::tuple<AgradDistributionsFrechet, type_v_44> AgradDistributionsFrechet_v_44;
+typedef std::tuple<AgradDistributionsFrechet, type_v_45> AgradDistributionsFrechet_v_45;
+typedef std::tuple<AgradDistributionsFrechet, type_v_46> AgradDistributionsFrechet_v_46;
+typedef std::tuple<AgradDistributionsFrechet, type_v_47> AgradDistributionsFrechet_v_47;
+typedef std::tuple<AgradDistributionsFrechet, type_v_48> AgradDistributionsFrechet_v_48;
+typedef std::tuple<AgradDistributionsFrechet, type_v_49> AgradDistributionsFrechet_v_49;
+typedef std::tuple<AgradDistributionsFrechet, type_v_50> AgradDistributionsFrechet_v_50;
+typedef std::tuple<AgradDistributionsFrechet, type_v_51> AgradDistributionsFrechet_v_51;
+typedef std::tuple<AgradDistributionsFrechet, type_v_52> AgradDistributionsFrechet_v_52;
+typedef std::tuple<AgradDistributionsFrechet, type_v_53> AgradDistributionsFrechet_v_53;
+typedef std::tuple<AgradDistributionsFrechet, type_v_54> AgradDistributionsFrechet_v_54;
+typedef std::tuple<AgradDistributionsFrechet, type_v_55> AgradDistributionsFrechet_v_55;
+typedef std::tuple<AgradDistributionsFrechet, type_v_56> AgradDistributionsFrechet_v_56;
+typedef std::tuple<AgradDistributionsFrechet, type_v_57> AgradDistributionsFrechet_v_57;
+typedef std::tuple<AgradDistributionsFrechet, type_v_58> AgradDistributionsFrechet_v_58;
+typedef std::tuple<AgradDistributionsFrechet, type_v_59> AgradDistributionsFrechet_v_59;
+typedef std::tuple<AgradDistributionsFrechet, type_v_60> AgradDistributionsFrechet_v_60;
+typedef std::tuple<AgradDistributionsFrechet, type_v_61> AgradDistributionsFrechet_v_61;
+typedef std::tuple<AgradDistributionsFrechet, type_v_62> AgradDistributionsFrechet_v_62;
+typedef std::tuple<AgradDistributionsFrechet, type_v_63> AgradDistributionsFrechet_v_63;
+typedef std::tuple<AgradDistributionsFrechet, type_v_64> AgradDistributionsFrechet_v_64;
+typedef std::tuple<AgradDistributionsFrechet, type_v_65> AgradDistributionsFrechet_v_65;
+typedef std::tuple<AgradDistributionsFrechet, type_v_66> AgradDistributionsFrechet_v_66;
+typedef std::tuple<AgradDistributionsFrechet, type_v_67> AgradDistributionsFrechet_v_67;
+typedef std::tuple<AgradDistributionsFrechet, type_v_68> AgradDistributionsFrechet_v_68;
+typedef std::tuple<AgradDistributionsFrechet, type_v_69> AgradDistributionsFrechet_v_69;
+typedef std::tuple<AgradDistributionsFrechet, type_v_70> AgradDistributionsFrechet_v_70;
+typedef std::tuple<AgradDistributionsFrechet, type_v_71> AgradDistributionsFrechet_v_71;
+typedef std::tuple<AgradDistributionsFrechet, type_v_72> AgradDistributionsFrechet_v_72;
+typedef std::tuple<AgradDistributionsFrechet, type_v_73> AgradDistributionsFrechet_v_73;
+typedef std::tuple<AgradDistributionsFrechet, type_v_74> AgradDistributionsFrechet_v_74;
+typedef std::tuple<AgradDistributionsFrechet, type_v_75> AgradDistributionsFrechet_v_75;
+typedef std::tuple<AgradDistributionsFrechet, type_v_76> AgradDistributionsFrechet_v_76;
+typedef std::tuple<AgradDistributionsFrechet, type_v_77> AgradDistributionsFrechet_v_77;
+typedef std::tuple<AgradDistributionsFrechet, type_v_78> AgradDistributionsFrechet_v_78;
+typedef std::tuple<AgradDistributionsFrechet, type_v_79> AgradDistributionsFrechet_v_79;
+typedef std::tuple<AgradDistributionsFrechet, type_v_80> AgradDistributionsFrechet_v_80;
+typedef std::tuple<AgradDistributionsFrechet, type_v_81> AgradDistributionsFrechet_v_81;
+typedef std::tuple<AgradDistributionsFrechet, type_v_82> AgradDistributionsFrechet_v_82;
+typedef std::tuple<AgradDistributionsFrechet, type_v_83> AgradDistributionsFrechet_v_83;
+typedef std::tuple<AgradDistributionsFrechet, type_v_84> AgradDistributionsFrechet_v_84;
+typedef std::tuple<AgradDistributionsFrechet, type_v_85> AgradDistributionsFrechet_v_85;
+typedef std::tuple<AgradDistributionsFrechet, type_v_86> AgradDistributionsFrechet_v_86;
+typedef std::tuple<AgradDistributionsFrechet, type_v_87> AgradDistributionsFrechet_v_87;
+typedef std::tuple<AgradDistributionsFrechet, type_v_88> AgradDistributionsFrechet_v_88;
+typedef std::tuple<AgradDistributionsFrechet, type_v_89> AgradDistributionsFrechet_v_89;
+typedef std::tuple<AgradDistributionsFrechet, type_v_90> AgradDistributionsFrechet_v_90;
+typedef std::tuple<AgradDistributionsFrechet, type_v_91> AgradDistributionsFrechet_v_91;
+typedef std::tuple<AgradDistributionsFrechet, type_v_92> AgradDistributionsFrechet_v_92;
+typedef std::tuple<AgradDistributionsFrechet, type_v_93> AgradDistributionsFrechet_v_93;
+typedef std::tuple<AgradDistributionsFrechet, type_v_94> AgradDistributionsFrechet_v_94;
+typedef std::tuple<AgradDistributionsFrechet, type_v_95> AgradDistributionsFrechet_v_95;
+typedef std::tuple<AgradDistributionsFrechet, type_v_96> AgradDistributionsFrechet_v_96;
+typedef std::tuple<AgradDistributionsFrechet, type_v_97> AgradDistributionsFrechet_v_97;
+typedef std::tuple<AgradDistributionsFrechet, type_v_98> AgradDistributionsFrechet_v_98;
+typedef std::tuple<AgradDistributionsFrechet, type_v_99> AgradDistributionsFrechet_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_0, AgradDistributionTestFixture, AgradDistributionsFrechet_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_1, AgradDistributionTestFixture, AgradDistributionsFrechet_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_2, AgradDistributionTestFixture, AgradDistributionsFrechet_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_3, AgradDistributionTestFixture, AgradDistributionsFrechet_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_4, AgradDistributionTestFixture, AgradDistributionsFrechet_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_5, AgradDistributionTestFixture, AgradDistributionsFrechet_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_6, AgradDistributionTestFixture, AgradDistributionsFrechet_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_7, AgradDistributionTestFixture, AgradDistributionsFrechet_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_8, AgradDistributionTestFixture, AgradDistributionsFrechet_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_9, AgradDistributionTestFixture, AgradDistributionsFrechet_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_10, AgradDistributionTestFixture, AgradDistributionsFrechet_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_11, AgradDistributionTestFixture, AgradDistributionsFrechet_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_12, AgradDistributionTestFixture, AgradDistributionsFrechet_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_13, AgradDistributionTestFixture, AgradDistributionsFrechet_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_14, AgradDistributionTestFixture, AgradDistributionsFrechet_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_15, AgradDistributionTestFixture, AgradDistributionsFrechet_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_16, AgradDistributionTestFixture, AgradDistributionsFrechet_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_17, AgradDistributionTestFixture, AgradDistributionsFrechet_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_18, AgradDistributionTestFixture, AgradDistributionsFrechet_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_19, AgradDistributionTestFixture, AgradDistributionsFrechet_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_20, AgradDistributionTestFixture, AgradDistributionsFrechet_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_21, AgradDistributionTestFixture, AgradDistributionsFrechet_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_22, AgradDistributionTestFixture, AgradDistributionsFrechet_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_23, AgradDistributionTestFixture, AgradDistributionsFrechet_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_24, AgradDistributionTestFixture, AgradDistributionsFrechet_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_25, AgradDistributionTestFixture, AgradDistributionsFrechet_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_26, AgradDistributionTestFixture, AgradDistributionsFrechet_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_27, AgradDistributionTestFixture, AgradDistributionsFrechet_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_28, AgradDistributionTestFixture, AgradDistributionsFrechet_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_29, AgradDistributionTestFixture, AgradDistributionsFrechet_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_30, AgradDistributionTestFixture, AgradDistributionsFrechet_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_31, AgradDistributionTestFixture, AgradDistributionsFrechet_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_32, AgradDistributionTestFixture, AgradDistributionsFrechet_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_33, AgradDistributionTestFixture, AgradDistributionsFrechet_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_34, AgradDistributionTestFixture, AgradDistributionsFrechet_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_35, AgradDistributionTestFixture, AgradDistributionsFrechet_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_36, AgradDistributionTestFixture, AgradDistributionsFrechet_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_37, AgradDistributionTestFixture, AgradDistributionsFrechet_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_38, AgradDistributionTestFixture, AgradDistributionsFrechet_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_39, AgradDistributionTestFixture, AgradDistributionsFrechet_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_40, AgradDistributionTestFixture, AgradDistributionsFrechet_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_41, AgradDistributionTestFixture, AgradDistributionsFrechet_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_42, AgradDistributionTestFixture, AgradDistributionsFrechet_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_43, AgradDistributionTestFixture, AgradDistributionsFrechet_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_44, AgradDistributionTestFixture, AgradDistributionsFrechet_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_45, AgradDistributionTestFixture, AgradDistributionsFrechet_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_46, AgradDistributionTestFixture, AgradDistributionsFrechet_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_47, AgradDistributionTestFixture, AgradDistributionsFrechet_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_48, AgradDistributionTestFixture, AgradDistributionsFrechet_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_49, AgradDistributionTestFixture, AgradDistributionsFrechet_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_50, AgradDistributionTestFixture, AgradDistributionsFrechet_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_51, AgradDistributionTestFixture, AgradDistributionsFrechet_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_52, AgradDistributionTestFixture, AgradDistributionsFrechet_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_53, AgradDistributionTestFixture, AgradDistributionsFrechet_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_54, AgradDistributionTestFixture, AgradDistributionsFrechet_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_55, AgradDistributionTestFixture, AgradDistributionsFrechet_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_56, AgradDistributionTestFixture, AgradDistributionsFrechet_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_57, AgradDistributionTestFixture, AgradDistributionsFrechet_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_58, AgradDistributionTestFixture, AgradDistributionsFrechet_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_59, AgradDistributionTestFixture, AgradDistributionsFrechet_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_60, AgradDistributionTestFixture, AgradDistributionsFrechet_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_61, AgradDistributionTestFixture, AgradDistributionsFrechet_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_62, AgradDistributionTestFixture, AgradDistributionsFrechet_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_63, AgradDistributionTestFixture, AgradDistributionsFrechet_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_64, AgradDistributionTestFixture, AgradDistributionsFrechet_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_65, AgradDistributionTestFixture, AgradDistributionsFrechet_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_66, AgradDistributionTestFixture, AgradDistributionsFrechet_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_67, AgradDistributionTestFixture, AgradDistributionsFrechet_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_68, AgradDistributionTestFixture, AgradDistributionsFrechet_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_69, AgradDistributionTestFixture, AgradDistributionsFrechet_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_70, AgradDistributionTestFixture, AgradDistributionsFrechet_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_71, AgradDistributionTestFixture, AgradDistributionsFrechet_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_72, AgradDistributionTestFixture, AgradDistributionsFrechet_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_73, AgradDistributionTestFixture, AgradDistributionsFrechet_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_74, AgradDistributionTestFixture, AgradDistributionsFrechet_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_75, AgradDistributionTestFixture, AgradDistributionsFrechet_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_76, AgradDistributionTestFixture, AgradDistributionsFrechet_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_77, AgradDistributionTestFixture, AgradDistributionsFrechet_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_78, AgradDistributionTestFixture, AgradDistributionsFrechet_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_79, AgradDistributionTestFixture, AgradDistributionsFrechet_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_80, AgradDistributionTestFixture, AgradDistributionsFrechet_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_81, AgradDistributionTestFixture, AgradDistributionsFrechet_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_82, AgradDistributionTestFixture, AgradDistributionsFrechet_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_83, AgradDistributionTestFixture, AgradDistributionsFrechet_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_84, AgradDistributionTestFixture, AgradDistributionsFrechet_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_85, AgradDistributionTestFixture, AgradDistributionsFrechet_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_86, AgradDistributionTestFixture, AgradDistributionsFrechet_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_87, AgradDistributionTestFixture, AgradDistributionsFrechet_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_88, AgradDistributionTestFixture, AgradDistributionsFrechet_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_89, AgradDistributionTestFixture, AgradDistributionsFrechet_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_90, AgradDistributionTestFixture, AgradDistributionsFrechet_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_91, AgradDistributionTestFixture, AgradDistributionsFrechet_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_92, AgradDistributionTestFixture, AgradDistributionsFrechet_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_93, AgradDistributionTestFixture, AgradDistributionsFrechet_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_94, AgradDistributionTestFixture, AgradDistributionsFrechet_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_95, AgradDistributionTestFixture, AgradDistributionsFrechet_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_96, AgradDistributionTestFixture, AgradDistributionsFrechet_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_97, AgradDistributionTestFixture, AgradDistributionsFrechet_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_98, AgradDistributionTestFixture, AgradDistributionsFrechet_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_99, AgradDistributionTestFixture, AgradDistributionsFrechet_v_99);
+
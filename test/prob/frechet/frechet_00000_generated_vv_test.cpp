@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsFrechet, type_vv_0> AgradDistributionsFrechet_vv_0;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_1> AgradDistributionsFrechet_vv_1;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_2> AgradDistributionsFrechet_vv_2;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_3> AgradDistributionsFrechet_vv_3;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_4> AgradDistributionsFrechet_vv_4;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_5> AgradDistributionsFrechet_vv_5;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_6> AgradDistributionsFrechet_vv_6;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_7> AgradDistributionsFrechet_vv_7;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_8> AgradDistributionsFrechet_vv_8;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_9> AgradDistributionsFrechet_vv_9;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_10> AgradDistributionsFrechet_vv_10;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_11> AgradDistributionsFrechet_vv_11;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_12> AgradDistributionsFrechet_vv_12;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_13> AgradDistributionsFrechet_vv_13;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_14> AgradDistributionsFrechet_vv_14;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_15> AgradDistributionsFrechet_vv_15;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_16> AgradDistributionsFrechet_vv_16;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_17> AgradDistributionsFrechet_vv_17;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_18> AgradDistributionsFrechet_vv_18;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_19> AgradDistributionsFrechet_vv_19;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_20> AgradDistributionsFrechet_vv_20;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_21> AgradDistributionsFrechet_vv_21;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_22> AgradDistributionsFrechet_vv_22;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_23> AgradDistributionsFrechet_vv_23;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_24> AgradDistributionsFrechet_vv_24;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_25> AgradDistributionsFrechet_vv_25;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_26> AgradDistributionsFrechet_vv_26;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_27> AgradDistributionsFrechet_vv_27;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_28> AgradDistributionsFrechet_vv_28;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_29> AgradDistributionsFrechet_vv_29;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_30> AgradDistributionsFrechet_vv_30;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_31> AgradDistributionsFrechet_vv_31;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_32> AgradDistributionsFrechet_vv_32;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_33> AgradDistributionsFrechet_vv_33;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_34> AgradDistributionsFrechet_vv_34;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_35> AgradDistributionsFrechet_vv_35;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_36> AgradDistributionsFrechet_vv_36;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_37> AgradDistributionsFrechet_vv_37;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_38> AgradDistributionsFrechet_vv_38;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_39> AgradDistributionsFrechet_vv_39;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_40> AgradDistributionsFrechet_vv_40;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_41> AgradDistributionsFrechet_vv_41;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_42> AgradDistributionsFrechet_vv_42;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_43> AgradDistributionsFrechet_vv_43;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_44> AgradDistributionsFrechet_vv_44;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_45> AgradDistributionsFrechet_vv_45;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_46> AgradDistributionsFrechet_vv_46;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_47> AgradDistributionsFrechet_vv_47;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_48> AgradDistributionsFrechet_vv_48;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_49> AgradDistributionsFrechet_vv_49;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_50> AgradDistributionsFrechet_vv_50;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_51> AgradDistributionsFrechet_vv_51;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_52> AgradDistributionsFrechet_vv_52;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_53> AgradDistributionsFrechet_vv_53;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_54> AgradDistributionsFrechet_vv_54;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_55> AgradDistributionsFrechet_vv_55;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_56> AgradDistributionsFrechet_vv_56;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_57> AgradDistributionsFrechet_vv_57;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_58> AgradDistributionsFrechet_vv_58;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_59> AgradDistributionsFrechet_vv_59;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_60> AgradDistributionsFrechet_vv_60;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_61> AgradDistributionsFrechet_vv_61;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_62> AgradDistributionsFrechet_vv_62;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_63> AgradDistributionsFrechet_vv_63;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_64> AgradDistributionsFrechet_vv_64;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_65> AgradDistributionsFrechet_vv_65;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_66> AgradDistributionsFrechet_vv_66;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_67> AgradDistributionsFrechet_vv_67;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_68> AgradDistributionsFrechet_vv_68;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_69> AgradDistributionsFrechet_vv_69;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_70> AgradDistributionsFrechet_vv_70;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_71> AgradDistributionsFrechet_vv_71;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_72> AgradDistributionsFrechet_vv_72;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_73> AgradDistributionsFrechet_vv_73;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_74> AgradDistributionsFrechet_vv_74;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_75> AgradDistributionsFrechet_vv_75;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_76> AgradDistributionsFrechet_vv_76;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_77> AgradDistributionsFrechet_vv_77;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_78> AgradDistributionsFrechet_vv_78;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_79> AgradDistributionsFrechet_vv_79;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_80> AgradDistributionsFrechet_vv_80;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_81> AgradDistributionsFrechet_vv_81;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_82> AgradDistributionsFrechet_vv_82;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_83> AgradDistributionsFrechet_vv_83;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_84> AgradDistributionsFrechet_vv_84;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_85> AgradDistributionsFrechet_vv_85;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_86> AgradDistributionsFrechet_vv_86;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_87> AgradDistributionsFrechet_vv_87;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_88> AgradDistributionsFrechet_vv_88;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_89> AgradDistributionsFrechet_vv_89;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_90> AgradDistributionsFrechet_vv_90;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_91> AgradDistributionsFrechet_vv_91;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_92> AgradDistributionsFrechet_vv_92;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_93> AgradDistributionsFrechet_vv_93;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_94> AgradDistributionsFrechet_vv_94;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_95> AgradDistributionsFrechet_vv_95;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_96> AgradDistributionsFrechet_vv_96;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_97> AgradDistributionsFrechet_vv_97;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_98> AgradDistributionsFrechet_vv_98;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_99> AgradDistributionsFrechet_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_0, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_1, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_2, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_3, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_4, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_5, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_6, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_7, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_8, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_9, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_10, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_11, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_12, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_13, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_14, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_15, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_16, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_17, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_18, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_19, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_20, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_21, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_22, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_23, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_24, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_25, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_26, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_27, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_28, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_29, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_30, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_31, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_32, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_33, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_34, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_35, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_36, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_37, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_38, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_39, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_40, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_41, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_42, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_43, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_44, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_45, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_46, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_47, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_48, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_49, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_50, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_51, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_52, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_53, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_54, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_55, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_56, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_57, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_58, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_59, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_60, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_61, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_62, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_63, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_64, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_65, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_66, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_67, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_68, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_69, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_70, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_71, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_72, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_73, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_74, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_75, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_76, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_77, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_78, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_79, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_80, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_81, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_82, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_83, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_84, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_85, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_86, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_87, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_88, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_89, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_90, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_91, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_92, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_93, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_94, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_95, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_96, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_97, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_98, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_99, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_99);
+
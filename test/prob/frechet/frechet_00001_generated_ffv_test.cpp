@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_100> AgradDistributionsFrechet_ffv_100;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_101> AgradDistributionsFrechet_ffv_101;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_102> AgradDistributionsFrechet_ffv_102;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_103> AgradDistributionsFrechet_ffv_103;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_104> AgradDistributionsFrechet_ffv_104;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_105> AgradDistributionsFrechet_ffv_105;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_106> AgradDistributionsFrechet_ffv_106;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_107> AgradDistributionsFrechet_ffv_107;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_108> AgradDistributionsFrechet_ffv_108;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_109> AgradDistributionsFrechet_ffv_109;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_110> AgradDistributionsFrechet_ffv_110;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_111> AgradDistributionsFrechet_ffv_111;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_112> AgradDistributionsFrechet_ffv_112;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_113> AgradDistributionsFrechet_ffv_113;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_114> AgradDistributionsFrechet_ffv_114;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_115> AgradDistributionsFrechet_ffv_115;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_116> AgradDistributionsFrechet_ffv_116;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_117> AgradDistributionsFrechet_ffv_117;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_118> AgradDistributionsFrechet_ffv_118;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_119> AgradDistributionsFrechet_ffv_119;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_120> AgradDistributionsFrechet_ffv_120;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_121> AgradDistributionsFrechet_ffv_121;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_122> AgradDistributionsFrechet_ffv_122;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_123> AgradDistributionsFrechet_ffv_123;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_124> AgradDistributionsFrechet_ffv_124;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_125> AgradDistributionsFrechet_ffv_125;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_126> AgradDistributionsFrechet_ffv_126;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_127> AgradDistributionsFrechet_ffv_127;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_128> AgradDistributionsFrechet_ffv_128;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_129> AgradDistributionsFrechet_ffv_129;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_130> AgradDistributionsFrechet_ffv_130;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_131> AgradDistributionsFrechet_ffv_131;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_132> AgradDistributionsFrechet_ffv_132;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_133> AgradDistributionsFrechet_ffv_133;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_134> AgradDistributionsFrechet_ffv_134;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_135> AgradDistributionsFrechet_ffv_135;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_136> AgradDistributionsFrechet_ffv_136;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_137> AgradDistributionsFrechet_ffv_137;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_138> AgradDistributionsFrechet_ffv_138;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_139> AgradDistributionsFrechet_ffv_139;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_140> AgradDistributionsFrechet_ffv_140;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_141> AgradDistributionsFrechet_ffv_141;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_142> AgradDistributionsFrechet_ffv_142;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_143> AgradDistributionsFrechet_ffv_143;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_144> AgradDistributionsFrechet_ffv_144;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_145> AgradDistributionsFrechet_ffv_145;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_146> AgradDistributionsFrechet_ffv_146;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_147> AgradDistributionsFrechet_ffv_147;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_148> AgradDistributionsFrechet_ffv_148;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_149> AgradDistributionsFrechet_ffv_149;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_150> AgradDistributionsFrechet_ffv_150;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_151> AgradDistributionsFrechet_ffv_151;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_152> AgradDistributionsFrechet_ffv_152;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_153> AgradDistributionsFrechet_ffv_153;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_154> AgradDistributionsFrechet_ffv_154;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_155> AgradDistributionsFrechet_ffv_155;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_156> AgradDistributionsFrechet_ffv_156;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_157> AgradDistributionsFrechet_ffv_157;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_158> AgradDistributionsFrechet_ffv_158;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_159> AgradDistributionsFrechet_ffv_159;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_160> AgradDistributionsFrechet_ffv_160;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_161> AgradDistributionsFrechet_ffv_161;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_162> AgradDistributionsFrechet_ffv_162;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_163> AgradDistributionsFrechet_ffv_163;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_164> AgradDistributionsFrechet_ffv_164;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_165> AgradDistributionsFrechet_ffv_165;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_166> AgradDistributionsFrechet_ffv_166;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_167> AgradDistributionsFrechet_ffv_167;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_168> AgradDistributionsFrechet_ffv_168;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_169> AgradDistributionsFrechet_ffv_169;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_170> AgradDistributionsFrechet_ffv_170;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_171> AgradDistributionsFrechet_ffv_171;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_172> AgradDistributionsFrechet_ffv_172;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_173> AgradDistributionsFrechet_ffv_173;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_174> AgradDistributionsFrechet_ffv_174;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_175> AgradDistributionsFrechet_ffv_175;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_176> AgradDistributionsFrechet_ffv_176;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_177> AgradDistributionsFrechet_ffv_177;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_178> AgradDistributionsFrechet_ffv_178;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_179> AgradDistributionsFrechet_ffv_179;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_180> AgradDistributionsFrechet_ffv_180;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_181> AgradDistributionsFrechet_ffv_181;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_182> AgradDistributionsFrechet_ffv_182;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_183> AgradDistributionsFrechet_ffv_183;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_184> AgradDistributionsFrechet_ffv_184;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_185> AgradDistributionsFrechet_ffv_185;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_186> AgradDistributionsFrechet_ffv_186;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_187> AgradDistributionsFrechet_ffv_187;
+typedef std::tuple<AgradDistributionsFrechet, type_ffv_188> AgradDistributionsFrechet_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_100, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_101, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_102, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_103, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_104, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_105, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_106, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_107, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_108, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_109, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_110, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_111, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_112, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_113, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_114, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_115, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_116, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_117, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_118, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_119, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_120, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_121, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_122, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_123, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_124, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_125, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_126, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_127, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_128, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_129, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_130, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_131, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_132, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_133, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_134, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_135, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_136, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_137, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_138, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_139, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_140, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_141, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_142, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_143, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_144, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_145, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_146, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_147, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_148, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_149, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_150, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_151, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_152, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_153, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_154, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_155, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_156, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_157, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_158, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_159, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_160, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_161, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_162, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_163, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_164, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_165, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_166, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_167, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_168, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_169, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_170, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_171, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_172, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_173, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_174, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_175, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_176, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_177, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_178, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_179, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_180, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_181, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_182, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_183, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_184, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_185, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_186, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_187, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_ffv_188, AgradDistributionTestFixture, AgradDistributionsFrechet_ffv_188);
+
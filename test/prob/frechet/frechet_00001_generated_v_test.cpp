@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsFrechet, type_v_100> AgradDistributionsFrechet_v_100;
+typedef std::tuple<AgradDistributionsFrechet, type_v_101> AgradDistributionsFrechet_v_101;
+typedef std::tuple<AgradDistributionsFrechet, type_v_102> AgradDistributionsFrechet_v_102;
+typedef std::tuple<AgradDistributionsFrechet, type_v_103> AgradDistributionsFrechet_v_103;
+typedef std::tuple<AgradDistributionsFrechet, type_v_104> AgradDistributionsFrechet_v_104;
+typedef std::tuple<AgradDistributionsFrechet, type_v_105> AgradDistributionsFrechet_v_105;
+typedef std::tuple<AgradDistributionsFrechet, type_v_106> AgradDistributionsFrechet_v_106;
+typedef std::tuple<AgradDistributionsFrechet, type_v_107> AgradDistributionsFrechet_v_107;
+typedef std::tuple<AgradDistributionsFrechet, type_v_108> AgradDistributionsFrechet_v_108;
+typedef std::tuple<AgradDistributionsFrechet, type_v_109> AgradDistributionsFrechet_v_109;
+typedef std::tuple<AgradDistributionsFrechet, type_v_110> AgradDistributionsFrechet_v_110;
+typedef std::tuple<AgradDistributionsFrechet, type_v_111> AgradDistributionsFrechet_v_111;
+typedef std::tuple<AgradDistributionsFrechet, type_v_112> AgradDistributionsFrechet_v_112;
+typedef std::tuple<AgradDistributionsFrechet, type_v_113> AgradDistributionsFrechet_v_113;
+typedef std::tuple<AgradDistributionsFrechet, type_v_114> AgradDistributionsFrechet_v_114;
+typedef std::tuple<AgradDistributionsFrechet, type_v_115> AgradDistributionsFrechet_v_115;
+typedef std::tuple<AgradDistributionsFrechet, type_v_116> AgradDistributionsFrechet_v_116;
+typedef std::tuple<AgradDistributionsFrechet, type_v_117> AgradDistributionsFrechet_v_117;
+typedef std::tuple<AgradDistributionsFrechet, type_v_118> AgradDistributionsFrechet_v_118;
+typedef std::tuple<AgradDistributionsFrechet, type_v_119> AgradDistributionsFrechet_v_119;
+typedef std::tuple<AgradDistributionsFrechet, type_v_120> AgradDistributionsFrechet_v_120;
+typedef std::tuple<AgradDistributionsFrechet, type_v_121> AgradDistributionsFrechet_v_121;
+typedef std::tuple<AgradDistributionsFrechet, type_v_122> AgradDistributionsFrechet_v_122;
+typedef std::tuple<AgradDistributionsFrechet, type_v_123> AgradDistributionsFrechet_v_123;
+typedef std::tuple<AgradDistributionsFrechet, type_v_124> AgradDistributionsFrechet_v_124;
+typedef std::tuple<AgradDistributionsFrechet, type_v_125> AgradDistributionsFrechet_v_125;
+typedef std::tuple<AgradDistributionsFrechet, type_v_126> AgradDistributionsFrechet_v_126;
+typedef std::tuple<AgradDistributionsFrechet, type_v_127> AgradDistributionsFrechet_v_127;
+typedef std::tuple<AgradDistributionsFrechet, type_v_128> AgradDistributionsFrechet_v_128;
+typedef std::tuple<AgradDistributionsFrechet, type_v_129> AgradDistributionsFrechet_v_129;
+typedef std::tuple<AgradDistributionsFrechet, type_v_130> AgradDistributionsFrechet_v_130;
+typedef std::tuple<AgradDistributionsFrechet, type_v_131> AgradDistributionsFrechet_v_131;
+typedef std::tuple<AgradDistributionsFrechet, type_v_132> AgradDistributionsFrechet_v_132;
+typedef std::tuple<AgradDistributionsFrechet, type_v_133> AgradDistributionsFrechet_v_133;
+typedef std::tuple<AgradDistributionsFrechet, type_v_134> AgradDistributionsFrechet_v_134;
+typedef std::tuple<AgradDistributionsFrechet, type_v_135> AgradDistributionsFrechet_v_135;
+typedef std::tuple<AgradDistributionsFrechet, type_v_136> AgradDistributionsFrechet_v_136;
+typedef std::tuple<AgradDistributionsFrechet, type_v_137> AgradDistributionsFrechet_v_137;
+typedef std::tuple<AgradDistributionsFrechet, type_v_138> AgradDistributionsFrechet_v_138;
+typedef std::tuple<AgradDistributionsFrechet, type_v_139> AgradDistributionsFrechet_v_139;
+typedef std::tuple<AgradDistributionsFrechet, type_v_140> AgradDistributionsFrechet_v_140;
+typedef std::tuple<AgradDistributionsFrechet, type_v_141> AgradDistributionsFrechet_v_141;
+typedef std::tuple<AgradDistributionsFrechet, type_v_142> AgradDistributionsFrechet_v_142;
+typedef std::tuple<AgradDistributionsFrechet, type_v_143> AgradDistributionsFrechet_v_143;
+typedef std::tuple<AgradDistributionsFrechet, type_v_144> AgradDistributionsFrechet_v_144;
+typedef std::tuple<AgradDistributionsFrechet, type_v_145> AgradDistributionsFrechet_v_145;
+typedef std::tuple<AgradDistributionsFrechet, type_v_146> AgradDistributionsFrechet_v_146;
+typedef std::tuple<AgradDistributionsFrechet, type_v_147> AgradDistributionsFrechet_v_147;
+typedef std::tuple<AgradDistributionsFrechet, type_v_148> AgradDistributionsFrechet_v_148;
+typedef std::tuple<AgradDistributionsFrechet, type_v_149> AgradDistributionsFrechet_v_149;
+typedef std::tuple<AgradDistributionsFrechet, type_v_150> AgradDistributionsFrechet_v_150;
+typedef std::tuple<AgradDistributionsFrechet, type_v_151> AgradDistributionsFrechet_v_151;
+typedef std::tuple<AgradDistributionsFrechet, type_v_152> AgradDistributionsFrechet_v_152;
+typedef std::tuple<AgradDistributionsFrechet, type_v_153> AgradDistributionsFrechet_v_153;
+typedef std::tuple<AgradDistributionsFrechet, type_v_154> AgradDistributionsFrechet_v_154;
+typedef std::tuple<AgradDistributionsFrechet, type_v_155> AgradDistributionsFrechet_v_155;
+typedef std::tuple<AgradDistributionsFrechet, type_v_156> AgradDistributionsFrechet_v_156;
+typedef std::tuple<AgradDistributionsFrechet, type_v_157> AgradDistributionsFrechet_v_157;
+typedef std::tuple<AgradDistributionsFrechet, type_v_158> AgradDistributionsFrechet_v_158;
+typedef std::tuple<AgradDistributionsFrechet, type_v_159> AgradDistributionsFrechet_v_159;
+typedef std::tuple<AgradDistributionsFrechet, type_v_160> AgradDistributionsFrechet_v_160;
+typedef std::tuple<AgradDistributionsFrechet, type_v_161> AgradDistributionsFrechet_v_161;
+typedef std::tuple<AgradDistributionsFrechet, type_v_162> AgradDistributionsFrechet_v_162;
+typedef std::tuple<AgradDistributionsFrechet, type_v_163> AgradDistributionsFrechet_v_163;
+typedef std::tuple<AgradDistributionsFrechet, type_v_164> AgradDistributionsFrechet_v_164;
+typedef std::tuple<AgradDistributionsFrechet, type_v_165> AgradDistributionsFrechet_v_165;
+typedef std::tuple<AgradDistributionsFrechet, type_v_166> AgradDistributionsFrechet_v_166;
+typedef std::tuple<AgradDistributionsFrechet, type_v_167> AgradDistributionsFrechet_v_167;
+typedef std::tuple<AgradDistributionsFrechet, type_v_168> AgradDistributionsFrechet_v_168;
+typedef std::tuple<AgradDistributionsFrechet, type_v_169> AgradDistributionsFrechet_v_169;
+typedef std::tuple<AgradDistributionsFrechet, type_v_170> AgradDistributionsFrechet_v_170;
+typedef std::tuple<AgradDistributionsFrechet, type_v_171> AgradDistributionsFrechet_v_171;
+typedef std::tuple<AgradDistributionsFrechet, type_v_172> AgradDistributionsFrechet_v_172;
+typedef std::tuple<AgradDistributionsFrechet, type_v_173> AgradDistributionsFrechet_v_173;
+typedef std::tuple<AgradDistributionsFrechet, type_v_174> AgradDistributionsFrechet_v_174;
+typedef std::tuple<AgradDistributionsFrechet, type_v_175> AgradDistributionsFrechet_v_175;
+typedef std::tuple<AgradDistributionsFrechet, type_v_176> AgradDistributionsFrechet_v_176;
+typedef std::tuple<AgradDistributionsFrechet, type_v_177> AgradDistributionsFrechet_v_177;
+typedef std::tuple<AgradDistributionsFrechet, type_v_178> AgradDistributionsFrechet_v_178;
+typedef std::tuple<AgradDistributionsFrechet, type_v_179> AgradDistributionsFrechet_v_179;
+typedef std::tuple<AgradDistributionsFrechet, type_v_180> AgradDistributionsFrechet_v_180;
+typedef std::tuple<AgradDistributionsFrechet, type_v_181> AgradDistributionsFrechet_v_181;
+typedef std::tuple<AgradDistributionsFrechet, type_v_182> AgradDistributionsFrechet_v_182;
+typedef std::tuple<AgradDistributionsFrechet, type_v_183> AgradDistributionsFrechet_v_183;
+typedef std::tuple<AgradDistributionsFrechet, type_v_184> AgradDistributionsFrechet_v_184;
+typedef std::tuple<AgradDistributionsFrechet, type_v_185> AgradDistributionsFrechet_v_185;
+typedef std::tuple<AgradDistributionsFrechet, type_v_186> AgradDistributionsFrechet_v_186;
+typedef std::tuple<AgradDistributionsFrechet, type_v_187> AgradDistributionsFrechet_v_187;
+typedef std::tuple<AgradDistributionsFrechet, type_v_188> AgradDistributionsFrechet_v_188;
+typedef std::tuple<AgradDistributionsFrechet, type_v_189> AgradDistributionsFrechet_v_189;
+typedef std::tuple<AgradDistributionsFrechet, type_v_190> AgradDistributionsFrechet_v_190;
+typedef std::tuple<AgradDistributionsFrechet, type_v_191> AgradDistributionsFrechet_v_191;
+typedef std::tuple<AgradDistributionsFrechet, type_v_192> AgradDistributionsFrechet_v_192;
+typedef std::tuple<AgradDistributionsFrechet, type_v_193> AgradDistributionsFrechet_v_193;
+typedef std::tuple<AgradDistributionsFrechet, type_v_194> AgradDistributionsFrechet_v_194;
+typedef std::tuple<AgradDistributionsFrechet, type_v_195> AgradDistributionsFrechet_v_195;
+typedef std::tuple<AgradDistributionsFrechet, type_v_196> AgradDistributionsFrechet_v_196;
+typedef std::tuple<AgradDistributionsFrechet, type_v_197> AgradDistributionsFrechet_v_197;
+typedef std::tuple<AgradDistributionsFrechet, type_v_198> AgradDistributionsFrechet_v_198;
+typedef std::tuple<AgradDistributionsFrechet, type_v_199> AgradDistributionsFrechet_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_100, AgradDistributionTestFixture, AgradDistributionsFrechet_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_101, AgradDistributionTestFixture, AgradDistributionsFrechet_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_102, AgradDistributionTestFixture, AgradDistributionsFrechet_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_103, AgradDistributionTestFixture, AgradDistributionsFrechet_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_104, AgradDistributionTestFixture, AgradDistributionsFrechet_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_105, AgradDistributionTestFixture, AgradDistributionsFrechet_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_106, AgradDistributionTestFixture, AgradDistributionsFrechet_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_107, AgradDistributionTestFixture, AgradDistributionsFrechet_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_108, AgradDistributionTestFixture, AgradDistributionsFrechet_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_109, AgradDistributionTestFixture, AgradDistributionsFrechet_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_110, AgradDistributionTestFixture, AgradDistributionsFrechet_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_111, AgradDistributionTestFixture, AgradDistributionsFrechet_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_112, AgradDistributionTestFixture, AgradDistributionsFrechet_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_113, AgradDistributionTestFixture, AgradDistributionsFrechet_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_114, AgradDistributionTestFixture, AgradDistributionsFrechet_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_115, AgradDistributionTestFixture, AgradDistributionsFrechet_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_116, AgradDistributionTestFixture, AgradDistributionsFrechet_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_117, AgradDistributionTestFixture, AgradDistributionsFrechet_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_118, AgradDistributionTestFixture, AgradDistributionsFrechet_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_119, AgradDistributionTestFixture, AgradDistributionsFrechet_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_120, AgradDistributionTestFixture, AgradDistributionsFrechet_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_121, AgradDistributionTestFixture, AgradDistributionsFrechet_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_122, AgradDistributionTestFixture, AgradDistributionsFrechet_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_123, AgradDistributionTestFixture, AgradDistributionsFrechet_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_124, AgradDistributionTestFixture, AgradDistributionsFrechet_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_125, AgradDistributionTestFixture, AgradDistributionsFrechet_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_126, AgradDistributionTestFixture, AgradDistributionsFrechet_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_127, AgradDistributionTestFixture, AgradDistributionsFrechet_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_128, AgradDistributionTestFixture, AgradDistributionsFrechet_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_129, AgradDistributionTestFixture, AgradDistributionsFrechet_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_130, AgradDistributionTestFixture, AgradDistributionsFrechet_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_131, AgradDistributionTestFixture, AgradDistributionsFrechet_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_132, AgradDistributionTestFixture, AgradDistributionsFrechet_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_133, AgradDistributionTestFixture, AgradDistributionsFrechet_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_134, AgradDistributionTestFixture, AgradDistributionsFrechet_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_135, AgradDistributionTestFixture, AgradDistributionsFrechet_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_136, AgradDistributionTestFixture, AgradDistributionsFrechet_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_137, AgradDistributionTestFixture, AgradDistributionsFrechet_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_138, AgradDistributionTestFixture, AgradDistributionsFrechet_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_139, AgradDistributionTestFixture, AgradDistributionsFrechet_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_140, AgradDistributionTestFixture, AgradDistributionsFrechet_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_141, AgradDistributionTestFixture, AgradDistributionsFrechet_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_142, AgradDistributionTestFixture, AgradDistributionsFrechet_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_143, AgradDistributionTestFixture, AgradDistributionsFrechet_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_144, AgradDistributionTestFixture, AgradDistributionsFrechet_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_145, AgradDistributionTestFixture, AgradDistributionsFrechet_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_146, AgradDistributionTestFixture, AgradDistributionsFrechet_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_147, AgradDistributionTestFixture, AgradDistributionsFrechet_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_148, AgradDistributionTestFixture, AgradDistributionsFrechet_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_149, AgradDistributionTestFixture, AgradDistributionsFrechet_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_150, AgradDistributionTestFixture, AgradDistributionsFrechet_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_151, AgradDistributionTestFixture, AgradDistributionsFrechet_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_152, AgradDistributionTestFixture, AgradDistributionsFrechet_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_153, AgradDistributionTestFixture, AgradDistributionsFrechet_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_154, AgradDistributionTestFixture, AgradDistributionsFrechet_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_155, AgradDistributionTestFixture, AgradDistributionsFrechet_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_156, AgradDistributionTestFixture, AgradDistributionsFrechet_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_157, AgradDistributionTestFixture, AgradDistributionsFrechet_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_158, AgradDistributionTestFixture, AgradDistributionsFrechet_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_159, AgradDistributionTestFixture, AgradDistributionsFrechet_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_160, AgradDistributionTestFixture, AgradDistributionsFrechet_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_161, AgradDistributionTestFixture, AgradDistributionsFrechet_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_162, AgradDistributionTestFixture, AgradDistributionsFrechet_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_163, AgradDistributionTestFixture, AgradDistributionsFrechet_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_164, AgradDistributionTestFixture, AgradDistributionsFrechet_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_165, AgradDistributionTestFixture, AgradDistributionsFrechet_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_166, AgradDistributionTestFixture, AgradDistributionsFrechet_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_167, AgradDistributionTestFixture, AgradDistributionsFrechet_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_168, AgradDistributionTestFixture, AgradDistributionsFrechet_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_169, AgradDistributionTestFixture, AgradDistributionsFrechet_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_170, AgradDistributionTestFixture, AgradDistributionsFrechet_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_171, AgradDistributionTestFixture, AgradDistributionsFrechet_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_172, AgradDistributionTestFixture, AgradDistributionsFrechet_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_173, AgradDistributionTestFixture, AgradDistributionsFrechet_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_174, AgradDistributionTestFixture, AgradDistributionsFrechet_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_175, AgradDistributionTestFixture, AgradDistributionsFrechet_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_176, AgradDistributionTestFixture, AgradDistributionsFrechet_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_177, AgradDistributionTestFixture, AgradDistributionsFrechet_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_178, AgradDistributionTestFixture, AgradDistributionsFrechet_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_179, AgradDistributionTestFixture, AgradDistributionsFrechet_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_180, AgradDistributionTestFixture, AgradDistributionsFrechet_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_181, AgradDistributionTestFixture, AgradDistributionsFrechet_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_182, AgradDistributionTestFixture, AgradDistributionsFrechet_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_183, AgradDistributionTestFixture, AgradDistributionsFrechet_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_184, AgradDistributionTestFixture, AgradDistributionsFrechet_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_185, AgradDistributionTestFixture, AgradDistributionsFrechet_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_186, AgradDistributionTestFixture, AgradDistributionsFrechet_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_187, AgradDistributionTestFixture, AgradDistributionsFrechet_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_188, AgradDistributionTestFixture, AgradDistributionsFrechet_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_189, AgradDistributionTestFixture, AgradDistributionsFrechet_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_190, AgradDistributionTestFixture, AgradDistributionsFrechet_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_191, AgradDistributionTestFixture, AgradDistributionsFrechet_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_192, AgradDistributionTestFixture, AgradDistributionsFrechet_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_193, AgradDistributionTestFixture, AgradDistributionsFrechet_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_194, AgradDistributionTestFixture, AgradDistributionsFrechet_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_195, AgradDistributionTestFixture, AgradDistributionsFrechet_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_196, AgradDistributionTestFixture, AgradDistributionsFrechet_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_197, AgradDistributionTestFixture, AgradDistributionsFrechet_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_198, AgradDistributionTestFixture, AgradDistributionsFrechet_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_199, AgradDistributionTestFixture, AgradDistributionsFrechet_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionsFrechet, type_vv_100> AgradDistributionsFrechet_vv_100;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_101> AgradDistributionsFrechet_vv_101;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_102> AgradDistributionsFrechet_vv_102;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_103> AgradDistributionsFrechet_vv_103;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_104> AgradDistributionsFrechet_vv_104;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_105> AgradDistributionsFrechet_vv_105;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_106> AgradDistributionsFrechet_vv_106;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_107> AgradDistributionsFrechet_vv_107;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_108> AgradDistributionsFrechet_vv_108;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_109> AgradDistributionsFrechet_vv_109;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_110> AgradDistributionsFrechet_vv_110;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_111> AgradDistributionsFrechet_vv_111;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_112> AgradDistributionsFrechet_vv_112;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_113> AgradDistributionsFrechet_vv_113;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_114> AgradDistributionsFrechet_vv_114;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_115> AgradDistributionsFrechet_vv_115;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_116> AgradDistributionsFrechet_vv_116;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_117> AgradDistributionsFrechet_vv_117;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_118> AgradDistributionsFrechet_vv_118;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_119> AgradDistributionsFrechet_vv_119;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_120> AgradDistributionsFrechet_vv_120;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_121> AgradDistributionsFrechet_vv_121;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_122> AgradDistributionsFrechet_vv_122;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_123> AgradDistributionsFrechet_vv_123;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_124> AgradDistributionsFrechet_vv_124;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_125> AgradDistributionsFrechet_vv_125;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_126> AgradDistributionsFrechet_vv_126;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_127> AgradDistributionsFrechet_vv_127;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_128> AgradDistributionsFrechet_vv_128;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_129> AgradDistributionsFrechet_vv_129;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_130> AgradDistributionsFrechet_vv_130;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_131> AgradDistributionsFrechet_vv_131;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_132> AgradDistributionsFrechet_vv_132;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_133> AgradDistributionsFrechet_vv_133;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_134> AgradDistributionsFrechet_vv_134;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_135> AgradDistributionsFrechet_vv_135;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_136> AgradDistributionsFrechet_vv_136;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_137> AgradDistributionsFrechet_vv_137;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_138> AgradDistributionsFrechet_vv_138;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_139> AgradDistributionsFrechet_vv_139;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_140> AgradDistributionsFrechet_vv_140;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_141> AgradDistributionsFrechet_vv_141;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_142> AgradDistributionsFrechet_vv_142;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_143> AgradDistributionsFrechet_vv_143;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_144> AgradDistributionsFrechet_vv_144;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_145> AgradDistributionsFrechet_vv_145;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_146> AgradDistributionsFrechet_vv_146;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_147> AgradDistributionsFrechet_vv_147;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_148> AgradDistributionsFrechet_vv_148;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_149> AgradDistributionsFrechet_vv_149;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_150> AgradDistributionsFrechet_vv_150;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_151> AgradDistributionsFrechet_vv_151;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_152> AgradDistributionsFrechet_vv_152;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_153> AgradDistributionsFrechet_vv_153;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_154> AgradDistributionsFrechet_vv_154;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_155> AgradDistributionsFrechet_vv_155;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_156> AgradDistributionsFrechet_vv_156;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_157> AgradDistributionsFrechet_vv_157;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_158> AgradDistributionsFrechet_vv_158;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_159> AgradDistributionsFrechet_vv_159;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_160> AgradDistributionsFrechet_vv_160;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_161> AgradDistributionsFrechet_vv_161;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_162> AgradDistributionsFrechet_vv_162;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_163> AgradDistributionsFrechet_vv_163;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_164> AgradDistributionsFrechet_vv_164;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_165> AgradDistributionsFrechet_vv_165;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_166> AgradDistributionsFrechet_vv_166;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_167> AgradDistributionsFrechet_vv_167;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_168> AgradDistributionsFrechet_vv_168;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_169> AgradDistributionsFrechet_vv_169;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_170> AgradDistributionsFrechet_vv_170;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_171> AgradDistributionsFrechet_vv_171;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_172> AgradDistributionsFrechet_vv_172;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_173> AgradDistributionsFrechet_vv_173;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_174> AgradDistributionsFrechet_vv_174;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_175> AgradDistributionsFrechet_vv_175;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_176> AgradDistributionsFrechet_vv_176;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_177> AgradDistributionsFrechet_vv_177;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_178> AgradDistributionsFrechet_vv_178;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_179> AgradDistributionsFrechet_vv_179;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_180> AgradDistributionsFrechet_vv_180;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_181> AgradDistributionsFrechet_vv_181;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_182> AgradDistributionsFrechet_vv_182;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_183> AgradDistributionsFrechet_vv_183;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_184> AgradDistributionsFrechet_vv_184;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_185> AgradDistributionsFrechet_vv_185;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_186> AgradDistributionsFrechet_vv_186;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_187> AgradDistributionsFrechet_vv_187;
+typedef std::tuple<AgradDistributionsFrechet, type_vv_188> AgradDistributionsFrechet_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_100, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_101, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_102, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_103, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_104, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_105, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_106, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_107, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_108, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_109, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_110, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_111, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_112, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_113, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_114, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_115, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_116, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_117, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_118, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_119, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_120, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_121, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_122, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_123, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_124, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_125, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_126, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_127, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_128, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_129, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_130, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_131, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_132, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_133, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_134, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_135, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_136, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_137, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_138, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_139, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_140, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_141, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_142, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_143, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_144, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_145, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_146, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_147, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_148, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_149, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_150, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_151, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_152, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_153, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_154, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_155, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_156, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_157, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_158, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_159, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_160, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_161, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_162, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_163, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_164, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_165, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_166, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_167, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_168, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_169, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_170, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_171, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_172, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_173, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_174, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_175, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_176, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_177, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_178, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_179, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_180, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_181, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_182, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_183, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_184, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_185, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_186, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_187, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_vv_188, AgradDistributionTestFixture, AgradDistributionsFrechet_vv_188);
+
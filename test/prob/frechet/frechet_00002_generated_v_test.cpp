@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradDistributionsFrechet, type_v_200> AgradDistributionsFrechet_v_200;
+typedef std::tuple<AgradDistributionsFrechet, type_v_201> AgradDistributionsFrechet_v_201;
+typedef std::tuple<AgradDistributionsFrechet, type_v_202> AgradDistributionsFrechet_v_202;
+typedef std::tuple<AgradDistributionsFrechet, type_v_203> AgradDistributionsFrechet_v_203;
+typedef std::tuple<AgradDistributionsFrechet, type_v_204> AgradDistributionsFrechet_v_204;
+typedef std::tuple<AgradDistributionsFrechet, type_v_205> AgradDistributionsFrechet_v_205;
+typedef std::tuple<AgradDistributionsFrechet, type_v_206> AgradDistributionsFrechet_v_206;
+typedef std::tuple<AgradDistributionsFrechet, type_v_207> AgradDistributionsFrechet_v_207;
+typedef std::tuple<AgradDistributionsFrechet, type_v_208> AgradDistributionsFrechet_v_208;
+typedef std::tuple<AgradDistributionsFrechet, type_v_209> AgradDistributionsFrechet_v_209;
+typedef std::tuple<AgradDistributionsFrechet, type_v_210> AgradDistributionsFrechet_v_210;
+typedef std::tuple<AgradDistributionsFrechet, type_v_211> AgradDistributionsFrechet_v_211;
+typedef std::tuple<AgradDistributionsFrechet, type_v_212> AgradDistributionsFrechet_v_212;
+typedef std::tuple<AgradDistributionsFrechet, type_v_213> AgradDistributionsFrechet_v_213;
+typedef std::tuple<AgradDistributionsFrechet, type_v_214> AgradDistributionsFrechet_v_214;
+typedef std::tuple<AgradDistributionsFrechet, type_v_215> AgradDistributionsFrechet_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_200, AgradDistributionTestFixture, AgradDistributionsFrechet_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_201, AgradDistributionTestFixture, AgradDistributionsFrechet_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_202, AgradDistributionTestFixture, AgradDistributionsFrechet_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_203, AgradDistributionTestFixture, AgradDistributionsFrechet_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_204, AgradDistributionTestFixture, AgradDistributionsFrechet_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_205, AgradDistributionTestFixture, AgradDistributionsFrechet_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_206, AgradDistributionTestFixture, AgradDistributionsFrechet_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_207, AgradDistributionTestFixture, AgradDistributionsFrechet_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_208, AgradDistributionTestFixture, AgradDistributionsFrechet_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_209, AgradDistributionTestFixture, AgradDistributionsFrechet_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_210, AgradDistributionTestFixture, AgradDistributionsFrechet_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_211, AgradDistributionTestFixture, AgradDistributionsFrechet_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_212, AgradDistributionTestFixture, AgradDistributionsFrechet_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_213, AgradDistributionTestFixture, AgradDistributionsFrechet_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_214, AgradDistributionTestFixture, AgradDistributionsFrechet_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsFrechet_v_215, AgradDistributionTestFixture, AgradDistributionsFrechet_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_0> AgradCcdfLogFrechet_ffv_0;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_1> AgradCcdfLogFrechet_ffv_1;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_2> AgradCcdfLogFrechet_ffv_2;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_3> AgradCcdfLogFrechet_ffv_3;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_4> AgradCcdfLogFrechet_ffv_4;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_5> AgradCcdfLogFrechet_ffv_5;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_6> AgradCcdfLogFrechet_ffv_6;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_7> AgradCcdfLogFrechet_ffv_7;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_8> AgradCcdfLogFrechet_ffv_8;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_9> AgradCcdfLogFrechet_ffv_9;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_10> AgradCcdfLogFrechet_ffv_10;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_11> AgradCcdfLogFrechet_ffv_11;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_12> AgradCcdfLogFrechet_ffv_12;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_13> AgradCcdfLogFrechet_ffv_13;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_14> AgradCcdfLogFrechet_ffv_14;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_15> AgradCcdfLogFrechet_ffv_15;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_16> AgradCcdfLogFrechet_ffv_16;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_17> AgradCcdfLogFrechet_ffv_17;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_18> AgradCcdfLogFrechet_ffv_18;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_19> AgradCcdfLogFrechet_ffv_19;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_20> AgradCcdfLogFrechet_ffv_20;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_21> AgradCcdfLogFrechet_ffv_21;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_22> AgradCcdfLogFrechet_ffv_22;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_23> AgradCcdfLogFrechet_ffv_23;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_24> AgradCcdfLogFrechet_ffv_24;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_25> AgradCcdfLogFrechet_ffv_25;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_26> AgradCcdfLogFrechet_ffv_26;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_27> AgradCcdfLogFrechet_ffv_27;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_28> AgradCcdfLogFrechet_ffv_28;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_29> AgradCcdfLogFrechet_ffv_29;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_30> AgradCcdfLogFrechet_ffv_30;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_31> AgradCcdfLogFrechet_ffv_31;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_32> AgradCcdfLogFrechet_ffv_32;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_33> AgradCcdfLogFrechet_ffv_33;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_34> AgradCcdfLogFrechet_ffv_34;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_35> AgradCcdfLogFrechet_ffv_35;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_36> AgradCcdfLogFrechet_ffv_36;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_37> AgradCcdfLogFrechet_ffv_37;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_38> AgradCcdfLogFrechet_ffv_38;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_39> AgradCcdfLogFrechet_ffv_39;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_40> AgradCcdfLogFrechet_ffv_40;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_41> AgradCcdfLogFrechet_ffv_41;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_42> AgradCcdfLogFrechet_ffv_42;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_43> AgradCcdfLogFrechet_ffv_43;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_44> AgradCcdfLogFrechet_ffv_44;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_45> AgradCcdfLogFrechet_ffv_45;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_46> AgradCcdfLogFrechet_ffv_46;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_47> AgradCcdfLogFrechet_ffv_47;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_48> AgradCcdfLogFrechet_ffv_48;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_49> AgradCcdfLogFrechet_ffv_49;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_50> AgradCcdfLogFrechet_ffv_50;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_51> AgradCcdfLogFrechet_ffv_51;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_52> AgradCcdfLogFrechet_ffv_52;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_53> AgradCcdfLogFrechet_ffv_53;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_54> AgradCcdfLogFrechet_ffv_54;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_55> AgradCcdfLogFrechet_ffv_55;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_56> AgradCcdfLogFrechet_ffv_56;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_57> AgradCcdfLogFrechet_ffv_57;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_58> AgradCcdfLogFrechet_ffv_58;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_59> AgradCcdfLogFrechet_ffv_59;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_60> AgradCcdfLogFrechet_ffv_60;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_61> AgradCcdfLogFrechet_ffv_61;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_62> AgradCcdfLogFrechet_ffv_62;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_63> AgradCcdfLogFrechet_ffv_63;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_64> AgradCcdfLogFrechet_ffv_64;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_65> AgradCcdfLogFrechet_ffv_65;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_66> AgradCcdfLogFrechet_ffv_66;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_67> AgradCcdfLogFrechet_ffv_67;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_68> AgradCcdfLogFrechet_ffv_68;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_69> AgradCcdfLogFrechet_ffv_69;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_70> AgradCcdfLogFrechet_ffv_70;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_71> AgradCcdfLogFrechet_ffv_71;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_72> AgradCcdfLogFrechet_ffv_72;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_73> AgradCcdfLogFrechet_ffv_73;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_74> AgradCcdfLogFrechet_ffv_74;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_75> AgradCcdfLogFrechet_ffv_75;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_76> AgradCcdfLogFrechet_ffv_76;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_77> AgradCcdfLogFrechet_ffv_77;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_78> AgradCcdfLogFrechet_ffv_78;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_79> AgradCcdfLogFrechet_ffv_79;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_80> AgradCcdfLogFrechet_ffv_80;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_81> AgradCcdfLogFrechet_ffv_81;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_82> AgradCcdfLogFrechet_ffv_82;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_83> AgradCcdfLogFrechet_ffv_83;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_84> AgradCcdfLogFrechet_ffv_84;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_85> AgradCcdfLogFrechet_ffv_85;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_86> AgradCcdfLogFrechet_ffv_86;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_87> AgradCcdfLogFrechet_ffv_87;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_88> AgradCcdfLogFrechet_ffv_88;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_89> AgradCcdfLogFrechet_ffv_89;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_90> AgradCcdfLogFrechet_ffv_90;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_91> AgradCcdfLogFrechet_ffv_91;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_92> AgradCcdfLogFrechet_ffv_92;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_93> AgradCcdfLogFrechet_ffv_93;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_94> AgradCcdfLogFrechet_ffv_94;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_95> AgradCcdfLogFrechet_ffv_95;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_96> AgradCcdfLogFrechet_ffv_96;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_97> AgradCcdfLogFrechet_ffv_97;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_98> AgradCcdfLogFrechet_ffv_98;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_99> AgradCcdfLogFrechet_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_99);
+
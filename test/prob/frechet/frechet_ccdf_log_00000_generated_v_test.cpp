@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogFrechet, type_v_0> AgradCcdfLogFrechet_v_0;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_1> AgradCcdfLogFrechet_v_1;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_2> AgradCcdfLogFrechet_v_2;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_3> AgradCcdfLogFrechet_v_3;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_4> AgradCcdfLogFrechet_v_4;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_5> AgradCcdfLogFrechet_v_5;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_6> AgradCcdfLogFrechet_v_6;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_7> AgradCcdfLogFrechet_v_7;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_8> AgradCcdfLogFrechet_v_8;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_9> AgradCcdfLogFrechet_v_9;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_10> AgradCcdfLogFrechet_v_10;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_11> AgradCcdfLogFrechet_v_11;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_12> AgradCcdfLogFrechet_v_12;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_13> AgradCcdfLogFrechet_v_13;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_14> AgradCcdfLogFrechet_v_14;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_15> AgradCcdfLogFrechet_v_15;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_16> AgradCcdfLogFrechet_v_16;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_17> AgradCcdfLogFrechet_v_17;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_18> AgradCcdfLogFrechet_v_18;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_19> AgradCcdfLogFrechet_v_19;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_20> AgradCcdfLogFrechet_v_20;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_21> AgradCcdfLogFrechet_v_21;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_22> AgradCcdfLogFrechet_v_22;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_23> AgradCcdfLogFrechet_v_23;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_24> AgradCcdfLogFrechet_v_24;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_25> AgradCcdfLogFrechet_v_25;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_26> AgradCcdfLogFrechet_v_26;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_27> AgradCcdfLogFrechet_v_27;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_28> AgradCcdfLogFrechet_v_28;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_29> AgradCcdfLogFrechet_v_29;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_30> AgradCcdfLogFrechet_v_30;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_31> AgradCcdfLogFrechet_v_31;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_32> AgradCcdfLogFrechet_v_32;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_33> AgradCcdfLogFrechet_v_33;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_34> AgradCcdfLogFrechet_v_34;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_35> AgradCcdfLogFrechet_v_35;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_36> AgradCcdfLogFrechet_v_36;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_37> AgradCcdfLogFrechet_v_37;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_38> AgradCcdfLogFrechet_v_38;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_39> AgradCcdfLogFrechet_v_39;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_40> AgradCcdfLogFrechet_v_40;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_41> AgradCcdfLogFrechet_v_41;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_42> AgradCcdfLogFrechet_v_42;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_43> AgradCcdfLogFrechet_v_43;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_44> AgradCcdfLogFrechet_v_44;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_45> AgradCcdfLogFrechet_v_45;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_46> AgradCcdfLogFrechet_v_46;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_47> AgradCcdfLogFrechet_v_47;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_48> AgradCcdfLogFrechet_v_48;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_49> AgradCcdfLogFrechet_v_49;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_50> AgradCcdfLogFrechet_v_50;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_51> AgradCcdfLogFrechet_v_51;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_52> AgradCcdfLogFrechet_v_52;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_53> AgradCcdfLogFrechet_v_53;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_54> AgradCcdfLogFrechet_v_54;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_55> AgradCcdfLogFrechet_v_55;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_56> AgradCcdfLogFrechet_v_56;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_57> AgradCcdfLogFrechet_v_57;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_58> AgradCcdfLogFrechet_v_58;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_59> AgradCcdfLogFrechet_v_59;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_60> AgradCcdfLogFrechet_v_60;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_61> AgradCcdfLogFrechet_v_61;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_62> AgradCcdfLogFrechet_v_62;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_63> AgradCcdfLogFrechet_v_63;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_64> AgradCcdfLogFrechet_v_64;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_65> AgradCcdfLogFrechet_v_65;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_66> AgradCcdfLogFrechet_v_66;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_67> AgradCcdfLogFrechet_v_67;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_68> AgradCcdfLogFrechet_v_68;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_69> AgradCcdfLogFrechet_v_69;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_70> AgradCcdfLogFrechet_v_70;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_71> AgradCcdfLogFrechet_v_71;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_72> AgradCcdfLogFrechet_v_72;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_73> AgradCcdfLogFrechet_v_73;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_74> AgradCcdfLogFrechet_v_74;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_75> AgradCcdfLogFrechet_v_75;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_76> AgradCcdfLogFrechet_v_76;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_77> AgradCcdfLogFrechet_v_77;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_78> AgradCcdfLogFrechet_v_78;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_79> AgradCcdfLogFrechet_v_79;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_80> AgradCcdfLogFrechet_v_80;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_81> AgradCcdfLogFrechet_v_81;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_82> AgradCcdfLogFrechet_v_82;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_83> AgradCcdfLogFrechet_v_83;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_84> AgradCcdfLogFrechet_v_84;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_85> AgradCcdfLogFrechet_v_85;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_86> AgradCcdfLogFrechet_v_86;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_87> AgradCcdfLogFrechet_v_87;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_88> AgradCcdfLogFrechet_v_88;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_89> AgradCcdfLogFrechet_v_89;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_90> AgradCcdfLogFrechet_v_90;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_91> AgradCcdfLogFrechet_v_91;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_92> AgradCcdfLogFrechet_v_92;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_93> AgradCcdfLogFrechet_v_93;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_94> AgradCcdfLogFrechet_v_94;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_95> AgradCcdfLogFrechet_v_95;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_96> AgradCcdfLogFrechet_v_96;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_97> AgradCcdfLogFrechet_v_97;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_98> AgradCcdfLogFrechet_v_98;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_99> AgradCcdfLogFrechet_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_0, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_1, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_2, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_3, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_4, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_5, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_6, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_7, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_8, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_9, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_10, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_11, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_12, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_13, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_14, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_15, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_16, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_17, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_18, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_19, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_20, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_21, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_22, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_23, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_24, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_25, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_26, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_27, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_28, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_29, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_30, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_31, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_32, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_33, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_34, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_35, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_36, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_37, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_38, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_39, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_40, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_41, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_42, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_43, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_44, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_45, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_46, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_47, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_48, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_49, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_50, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_51, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_52, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_53, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_54, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_55, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_56, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_57, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_58, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_59, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_60, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_61, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_62, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_63, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_64, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_65, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_66, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_67, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_68, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_69, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_70, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_71, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_72, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_73, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_74, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_75, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_76, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_77, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_78, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_79, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_80, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_81, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_82, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_83, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_84, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_85, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_86, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_87, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_88, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_89, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_90, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_91, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_92, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_93, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_94, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_95, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_96, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_97, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_98, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_99, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_99);
+
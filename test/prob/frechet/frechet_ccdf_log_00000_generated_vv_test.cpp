@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_0> AgradCcdfLogFrechet_vv_0;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_1> AgradCcdfLogFrechet_vv_1;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_2> AgradCcdfLogFrechet_vv_2;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_3> AgradCcdfLogFrechet_vv_3;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_4> AgradCcdfLogFrechet_vv_4;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_5> AgradCcdfLogFrechet_vv_5;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_6> AgradCcdfLogFrechet_vv_6;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_7> AgradCcdfLogFrechet_vv_7;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_8> AgradCcdfLogFrechet_vv_8;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_9> AgradCcdfLogFrechet_vv_9;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_10> AgradCcdfLogFrechet_vv_10;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_11> AgradCcdfLogFrechet_vv_11;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_12> AgradCcdfLogFrechet_vv_12;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_13> AgradCcdfLogFrechet_vv_13;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_14> AgradCcdfLogFrechet_vv_14;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_15> AgradCcdfLogFrechet_vv_15;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_16> AgradCcdfLogFrechet_vv_16;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_17> AgradCcdfLogFrechet_vv_17;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_18> AgradCcdfLogFrechet_vv_18;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_19> AgradCcdfLogFrechet_vv_19;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_20> AgradCcdfLogFrechet_vv_20;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_21> AgradCcdfLogFrechet_vv_21;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_22> AgradCcdfLogFrechet_vv_22;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_23> AgradCcdfLogFrechet_vv_23;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_24> AgradCcdfLogFrechet_vv_24;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_25> AgradCcdfLogFrechet_vv_25;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_26> AgradCcdfLogFrechet_vv_26;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_27> AgradCcdfLogFrechet_vv_27;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_28> AgradCcdfLogFrechet_vv_28;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_29> AgradCcdfLogFrechet_vv_29;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_30> AgradCcdfLogFrechet_vv_30;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_31> AgradCcdfLogFrechet_vv_31;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_32> AgradCcdfLogFrechet_vv_32;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_33> AgradCcdfLogFrechet_vv_33;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_34> AgradCcdfLogFrechet_vv_34;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_35> AgradCcdfLogFrechet_vv_35;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_36> AgradCcdfLogFrechet_vv_36;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_37> AgradCcdfLogFrechet_vv_37;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_38> AgradCcdfLogFrechet_vv_38;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_39> AgradCcdfLogFrechet_vv_39;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_40> AgradCcdfLogFrechet_vv_40;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_41> AgradCcdfLogFrechet_vv_41;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_42> AgradCcdfLogFrechet_vv_42;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_43> AgradCcdfLogFrechet_vv_43;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_44> AgradCcdfLogFrechet_vv_44;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_45> AgradCcdfLogFrechet_vv_45;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_46> AgradCcdfLogFrechet_vv_46;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_47> AgradCcdfLogFrechet_vv_47;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_48> AgradCcdfLogFrechet_vv_48;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_49> AgradCcdfLogFrechet_vv_49;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_50> AgradCcdfLogFrechet_vv_50;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_51> AgradCcdfLogFrechet_vv_51;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_52> AgradCcdfLogFrechet_vv_52;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_53> AgradCcdfLogFrechet_vv_53;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_54> AgradCcdfLogFrechet_vv_54;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_55> AgradCcdfLogFrechet_vv_55;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_56> AgradCcdfLogFrechet_vv_56;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_57> AgradCcdfLogFrechet_vv_57;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_58> AgradCcdfLogFrechet_vv_58;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_59> AgradCcdfLogFrechet_vv_59;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_60> AgradCcdfLogFrechet_vv_60;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_61> AgradCcdfLogFrechet_vv_61;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_62> AgradCcdfLogFrechet_vv_62;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_63> AgradCcdfLogFrechet_vv_63;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_64> AgradCcdfLogFrechet_vv_64;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_65> AgradCcdfLogFrechet_vv_65;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_66> AgradCcdfLogFrechet_vv_66;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_67> AgradCcdfLogFrechet_vv_67;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_68> AgradCcdfLogFrechet_vv_68;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_69> AgradCcdfLogFrechet_vv_69;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_70> AgradCcdfLogFrechet_vv_70;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_71> AgradCcdfLogFrechet_vv_71;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_72> AgradCcdfLogFrechet_vv_72;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_73> AgradCcdfLogFrechet_vv_73;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_74> AgradCcdfLogFrechet_vv_74;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_75> AgradCcdfLogFrechet_vv_75;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_76> AgradCcdfLogFrechet_vv_76;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_77> AgradCcdfLogFrechet_vv_77;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_78> AgradCcdfLogFrechet_vv_78;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_79> AgradCcdfLogFrechet_vv_79;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_80> AgradCcdfLogFrechet_vv_80;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_81> AgradCcdfLogFrechet_vv_81;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_82> AgradCcdfLogFrechet_vv_82;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_83> AgradCcdfLogFrechet_vv_83;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_84> AgradCcdfLogFrechet_vv_84;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_85> AgradCcdfLogFrechet_vv_85;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_86> AgradCcdfLogFrechet_vv_86;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_87> AgradCcdfLogFrechet_vv_87;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_88> AgradCcdfLogFrechet_vv_88;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_89> AgradCcdfLogFrechet_vv_89;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_90> AgradCcdfLogFrechet_vv_90;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_91> AgradCcdfLogFrechet_vv_91;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_92> AgradCcdfLogFrechet_vv_92;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_93> AgradCcdfLogFrechet_vv_93;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_94> AgradCcdfLogFrechet_vv_94;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_95> AgradCcdfLogFrechet_vv_95;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_96> AgradCcdfLogFrechet_vv_96;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_97> AgradCcdfLogFrechet_vv_97;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_98> AgradCcdfLogFrechet_vv_98;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_99> AgradCcdfLogFrechet_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_99);
+
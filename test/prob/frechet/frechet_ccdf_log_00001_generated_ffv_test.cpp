@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_100> AgradCcdfLogFrechet_ffv_100;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_101> AgradCcdfLogFrechet_ffv_101;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_102> AgradCcdfLogFrechet_ffv_102;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_103> AgradCcdfLogFrechet_ffv_103;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_104> AgradCcdfLogFrechet_ffv_104;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_105> AgradCcdfLogFrechet_ffv_105;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_106> AgradCcdfLogFrechet_ffv_106;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_107> AgradCcdfLogFrechet_ffv_107;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_108> AgradCcdfLogFrechet_ffv_108;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_109> AgradCcdfLogFrechet_ffv_109;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_110> AgradCcdfLogFrechet_ffv_110;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_111> AgradCcdfLogFrechet_ffv_111;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_112> AgradCcdfLogFrechet_ffv_112;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_113> AgradCcdfLogFrechet_ffv_113;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_114> AgradCcdfLogFrechet_ffv_114;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_115> AgradCcdfLogFrechet_ffv_115;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_116> AgradCcdfLogFrechet_ffv_116;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_117> AgradCcdfLogFrechet_ffv_117;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_118> AgradCcdfLogFrechet_ffv_118;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_119> AgradCcdfLogFrechet_ffv_119;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_120> AgradCcdfLogFrechet_ffv_120;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_121> AgradCcdfLogFrechet_ffv_121;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_122> AgradCcdfLogFrechet_ffv_122;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_123> AgradCcdfLogFrechet_ffv_123;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_124> AgradCcdfLogFrechet_ffv_124;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_125> AgradCcdfLogFrechet_ffv_125;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_126> AgradCcdfLogFrechet_ffv_126;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_127> AgradCcdfLogFrechet_ffv_127;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_128> AgradCcdfLogFrechet_ffv_128;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_129> AgradCcdfLogFrechet_ffv_129;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_130> AgradCcdfLogFrechet_ffv_130;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_131> AgradCcdfLogFrechet_ffv_131;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_132> AgradCcdfLogFrechet_ffv_132;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_133> AgradCcdfLogFrechet_ffv_133;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_134> AgradCcdfLogFrechet_ffv_134;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_135> AgradCcdfLogFrechet_ffv_135;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_136> AgradCcdfLogFrechet_ffv_136;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_137> AgradCcdfLogFrechet_ffv_137;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_138> AgradCcdfLogFrechet_ffv_138;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_139> AgradCcdfLogFrechet_ffv_139;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_140> AgradCcdfLogFrechet_ffv_140;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_141> AgradCcdfLogFrechet_ffv_141;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_142> AgradCcdfLogFrechet_ffv_142;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_143> AgradCcdfLogFrechet_ffv_143;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_144> AgradCcdfLogFrechet_ffv_144;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_145> AgradCcdfLogFrechet_ffv_145;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_146> AgradCcdfLogFrechet_ffv_146;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_147> AgradCcdfLogFrechet_ffv_147;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_148> AgradCcdfLogFrechet_ffv_148;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_149> AgradCcdfLogFrechet_ffv_149;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_150> AgradCcdfLogFrechet_ffv_150;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_151> AgradCcdfLogFrechet_ffv_151;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_152> AgradCcdfLogFrechet_ffv_152;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_153> AgradCcdfLogFrechet_ffv_153;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_154> AgradCcdfLogFrechet_ffv_154;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_155> AgradCcdfLogFrechet_ffv_155;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_156> AgradCcdfLogFrechet_ffv_156;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_157> AgradCcdfLogFrechet_ffv_157;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_158> AgradCcdfLogFrechet_ffv_158;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_159> AgradCcdfLogFrechet_ffv_159;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_160> AgradCcdfLogFrechet_ffv_160;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_161> AgradCcdfLogFrechet_ffv_161;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_162> AgradCcdfLogFrechet_ffv_162;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_163> AgradCcdfLogFrechet_ffv_163;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_164> AgradCcdfLogFrechet_ffv_164;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_165> AgradCcdfLogFrechet_ffv_165;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_166> AgradCcdfLogFrechet_ffv_166;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_167> AgradCcdfLogFrechet_ffv_167;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_168> AgradCcdfLogFrechet_ffv_168;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_169> AgradCcdfLogFrechet_ffv_169;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_170> AgradCcdfLogFrechet_ffv_170;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_171> AgradCcdfLogFrechet_ffv_171;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_172> AgradCcdfLogFrechet_ffv_172;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_173> AgradCcdfLogFrechet_ffv_173;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_174> AgradCcdfLogFrechet_ffv_174;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_175> AgradCcdfLogFrechet_ffv_175;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_176> AgradCcdfLogFrechet_ffv_176;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_177> AgradCcdfLogFrechet_ffv_177;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_178> AgradCcdfLogFrechet_ffv_178;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_179> AgradCcdfLogFrechet_ffv_179;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_180> AgradCcdfLogFrechet_ffv_180;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_181> AgradCcdfLogFrechet_ffv_181;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_182> AgradCcdfLogFrechet_ffv_182;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_183> AgradCcdfLogFrechet_ffv_183;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_184> AgradCcdfLogFrechet_ffv_184;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_185> AgradCcdfLogFrechet_ffv_185;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_186> AgradCcdfLogFrechet_ffv_186;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_187> AgradCcdfLogFrechet_ffv_187;
+typedef std::tuple<AgradCcdfLogFrechet, type_ffv_188> AgradCcdfLogFrechet_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_ffv_188);
+
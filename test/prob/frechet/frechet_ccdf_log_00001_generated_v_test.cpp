@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogFrechet, type_v_100> AgradCcdfLogFrechet_v_100;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_101> AgradCcdfLogFrechet_v_101;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_102> AgradCcdfLogFrechet_v_102;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_103> AgradCcdfLogFrechet_v_103;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_104> AgradCcdfLogFrechet_v_104;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_105> AgradCcdfLogFrechet_v_105;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_106> AgradCcdfLogFrechet_v_106;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_107> AgradCcdfLogFrechet_v_107;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_108> AgradCcdfLogFrechet_v_108;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_109> AgradCcdfLogFrechet_v_109;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_110> AgradCcdfLogFrechet_v_110;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_111> AgradCcdfLogFrechet_v_111;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_112> AgradCcdfLogFrechet_v_112;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_113> AgradCcdfLogFrechet_v_113;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_114> AgradCcdfLogFrechet_v_114;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_115> AgradCcdfLogFrechet_v_115;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_116> AgradCcdfLogFrechet_v_116;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_117> AgradCcdfLogFrechet_v_117;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_118> AgradCcdfLogFrechet_v_118;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_119> AgradCcdfLogFrechet_v_119;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_120> AgradCcdfLogFrechet_v_120;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_121> AgradCcdfLogFrechet_v_121;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_122> AgradCcdfLogFrechet_v_122;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_123> AgradCcdfLogFrechet_v_123;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_124> AgradCcdfLogFrechet_v_124;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_125> AgradCcdfLogFrechet_v_125;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_126> AgradCcdfLogFrechet_v_126;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_127> AgradCcdfLogFrechet_v_127;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_128> AgradCcdfLogFrechet_v_128;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_129> AgradCcdfLogFrechet_v_129;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_130> AgradCcdfLogFrechet_v_130;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_131> AgradCcdfLogFrechet_v_131;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_132> AgradCcdfLogFrechet_v_132;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_133> AgradCcdfLogFrechet_v_133;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_134> AgradCcdfLogFrechet_v_134;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_135> AgradCcdfLogFrechet_v_135;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_136> AgradCcdfLogFrechet_v_136;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_137> AgradCcdfLogFrechet_v_137;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_138> AgradCcdfLogFrechet_v_138;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_139> AgradCcdfLogFrechet_v_139;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_140> AgradCcdfLogFrechet_v_140;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_141> AgradCcdfLogFrechet_v_141;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_142> AgradCcdfLogFrechet_v_142;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_143> AgradCcdfLogFrechet_v_143;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_144> AgradCcdfLogFrechet_v_144;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_145> AgradCcdfLogFrechet_v_145;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_146> AgradCcdfLogFrechet_v_146;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_147> AgradCcdfLogFrechet_v_147;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_148> AgradCcdfLogFrechet_v_148;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_149> AgradCcdfLogFrechet_v_149;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_150> AgradCcdfLogFrechet_v_150;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_151> AgradCcdfLogFrechet_v_151;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_152> AgradCcdfLogFrechet_v_152;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_153> AgradCcdfLogFrechet_v_153;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_154> AgradCcdfLogFrechet_v_154;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_155> AgradCcdfLogFrechet_v_155;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_156> AgradCcdfLogFrechet_v_156;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_157> AgradCcdfLogFrechet_v_157;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_158> AgradCcdfLogFrechet_v_158;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_159> AgradCcdfLogFrechet_v_159;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_160> AgradCcdfLogFrechet_v_160;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_161> AgradCcdfLogFrechet_v_161;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_162> AgradCcdfLogFrechet_v_162;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_163> AgradCcdfLogFrechet_v_163;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_164> AgradCcdfLogFrechet_v_164;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_165> AgradCcdfLogFrechet_v_165;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_166> AgradCcdfLogFrechet_v_166;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_167> AgradCcdfLogFrechet_v_167;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_168> AgradCcdfLogFrechet_v_168;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_169> AgradCcdfLogFrechet_v_169;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_170> AgradCcdfLogFrechet_v_170;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_171> AgradCcdfLogFrechet_v_171;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_172> AgradCcdfLogFrechet_v_172;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_173> AgradCcdfLogFrechet_v_173;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_174> AgradCcdfLogFrechet_v_174;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_175> AgradCcdfLogFrechet_v_175;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_176> AgradCcdfLogFrechet_v_176;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_177> AgradCcdfLogFrechet_v_177;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_178> AgradCcdfLogFrechet_v_178;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_179> AgradCcdfLogFrechet_v_179;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_180> AgradCcdfLogFrechet_v_180;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_181> AgradCcdfLogFrechet_v_181;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_182> AgradCcdfLogFrechet_v_182;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_183> AgradCcdfLogFrechet_v_183;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_184> AgradCcdfLogFrechet_v_184;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_185> AgradCcdfLogFrechet_v_185;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_186> AgradCcdfLogFrechet_v_186;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_187> AgradCcdfLogFrechet_v_187;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_188> AgradCcdfLogFrechet_v_188;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_189> AgradCcdfLogFrechet_v_189;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_190> AgradCcdfLogFrechet_v_190;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_191> AgradCcdfLogFrechet_v_191;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_192> AgradCcdfLogFrechet_v_192;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_193> AgradCcdfLogFrechet_v_193;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_194> AgradCcdfLogFrechet_v_194;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_195> AgradCcdfLogFrechet_v_195;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_196> AgradCcdfLogFrechet_v_196;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_197> AgradCcdfLogFrechet_v_197;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_198> AgradCcdfLogFrechet_v_198;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_199> AgradCcdfLogFrechet_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_100, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_101, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_102, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_103, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_104, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_105, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_106, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_107, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_108, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_109, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_110, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_111, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_112, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_113, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_114, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_115, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_116, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_117, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_118, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_119, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_120, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_121, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_122, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_123, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_124, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_125, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_126, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_127, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_128, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_129, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_130, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_131, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_132, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_133, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_134, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_135, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_136, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_137, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_138, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_139, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_140, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_141, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_142, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_143, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_144, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_145, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_146, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_147, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_148, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_149, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_150, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_151, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_152, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_153, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_154, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_155, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_156, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_157, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_158, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_159, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_160, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_161, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_162, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_163, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_164, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_165, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_166, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_167, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_168, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_169, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_170, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_171, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_172, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_173, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_174, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_175, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_176, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_177, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_178, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_179, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_180, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_181, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_182, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_183, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_184, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_185, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_186, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_187, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_188, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_189, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_190, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_191, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_192, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_193, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_194, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_195, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_196, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_197, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_198, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_199, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_100> AgradCcdfLogFrechet_vv_100;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_101> AgradCcdfLogFrechet_vv_101;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_102> AgradCcdfLogFrechet_vv_102;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_103> AgradCcdfLogFrechet_vv_103;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_104> AgradCcdfLogFrechet_vv_104;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_105> AgradCcdfLogFrechet_vv_105;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_106> AgradCcdfLogFrechet_vv_106;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_107> AgradCcdfLogFrechet_vv_107;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_108> AgradCcdfLogFrechet_vv_108;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_109> AgradCcdfLogFrechet_vv_109;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_110> AgradCcdfLogFrechet_vv_110;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_111> AgradCcdfLogFrechet_vv_111;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_112> AgradCcdfLogFrechet_vv_112;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_113> AgradCcdfLogFrechet_vv_113;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_114> AgradCcdfLogFrechet_vv_114;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_115> AgradCcdfLogFrechet_vv_115;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_116> AgradCcdfLogFrechet_vv_116;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_117> AgradCcdfLogFrechet_vv_117;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_118> AgradCcdfLogFrechet_vv_118;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_119> AgradCcdfLogFrechet_vv_119;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_120> AgradCcdfLogFrechet_vv_120;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_121> AgradCcdfLogFrechet_vv_121;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_122> AgradCcdfLogFrechet_vv_122;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_123> AgradCcdfLogFrechet_vv_123;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_124> AgradCcdfLogFrechet_vv_124;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_125> AgradCcdfLogFrechet_vv_125;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_126> AgradCcdfLogFrechet_vv_126;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_127> AgradCcdfLogFrechet_vv_127;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_128> AgradCcdfLogFrechet_vv_128;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_129> AgradCcdfLogFrechet_vv_129;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_130> AgradCcdfLogFrechet_vv_130;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_131> AgradCcdfLogFrechet_vv_131;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_132> AgradCcdfLogFrechet_vv_132;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_133> AgradCcdfLogFrechet_vv_133;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_134> AgradCcdfLogFrechet_vv_134;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_135> AgradCcdfLogFrechet_vv_135;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_136> AgradCcdfLogFrechet_vv_136;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_137> AgradCcdfLogFrechet_vv_137;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_138> AgradCcdfLogFrechet_vv_138;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_139> AgradCcdfLogFrechet_vv_139;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_140> AgradCcdfLogFrechet_vv_140;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_141> AgradCcdfLogFrechet_vv_141;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_142> AgradCcdfLogFrechet_vv_142;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_143> AgradCcdfLogFrechet_vv_143;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_144> AgradCcdfLogFrechet_vv_144;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_145> AgradCcdfLogFrechet_vv_145;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_146> AgradCcdfLogFrechet_vv_146;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_147> AgradCcdfLogFrechet_vv_147;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_148> AgradCcdfLogFrechet_vv_148;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_149> AgradCcdfLogFrechet_vv_149;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_150> AgradCcdfLogFrechet_vv_150;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_151> AgradCcdfLogFrechet_vv_151;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_152> AgradCcdfLogFrechet_vv_152;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_153> AgradCcdfLogFrechet_vv_153;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_154> AgradCcdfLogFrechet_vv_154;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_155> AgradCcdfLogFrechet_vv_155;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_156> AgradCcdfLogFrechet_vv_156;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_157> AgradCcdfLogFrechet_vv_157;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_158> AgradCcdfLogFrechet_vv_158;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_159> AgradCcdfLogFrechet_vv_159;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_160> AgradCcdfLogFrechet_vv_160;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_161> AgradCcdfLogFrechet_vv_161;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_162> AgradCcdfLogFrechet_vv_162;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_163> AgradCcdfLogFrechet_vv_163;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_164> AgradCcdfLogFrechet_vv_164;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_165> AgradCcdfLogFrechet_vv_165;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_166> AgradCcdfLogFrechet_vv_166;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_167> AgradCcdfLogFrechet_vv_167;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_168> AgradCcdfLogFrechet_vv_168;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_169> AgradCcdfLogFrechet_vv_169;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_170> AgradCcdfLogFrechet_vv_170;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_171> AgradCcdfLogFrechet_vv_171;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_172> AgradCcdfLogFrechet_vv_172;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_173> AgradCcdfLogFrechet_vv_173;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_174> AgradCcdfLogFrechet_vv_174;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_175> AgradCcdfLogFrechet_vv_175;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_176> AgradCcdfLogFrechet_vv_176;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_177> AgradCcdfLogFrechet_vv_177;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_178> AgradCcdfLogFrechet_vv_178;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_179> AgradCcdfLogFrechet_vv_179;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_180> AgradCcdfLogFrechet_vv_180;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_181> AgradCcdfLogFrechet_vv_181;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_182> AgradCcdfLogFrechet_vv_182;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_183> AgradCcdfLogFrechet_vv_183;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_184> AgradCcdfLogFrechet_vv_184;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_185> AgradCcdfLogFrechet_vv_185;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_186> AgradCcdfLogFrechet_vv_186;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_187> AgradCcdfLogFrechet_vv_187;
+typedef std::tuple<AgradCcdfLogFrechet, type_vv_188> AgradCcdfLogFrechet_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCcdfLogFrechet, type_v_200> AgradCcdfLogFrechet_v_200;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_201> AgradCcdfLogFrechet_v_201;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_202> AgradCcdfLogFrechet_v_202;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_203> AgradCcdfLogFrechet_v_203;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_204> AgradCcdfLogFrechet_v_204;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_205> AgradCcdfLogFrechet_v_205;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_206> AgradCcdfLogFrechet_v_206;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_207> AgradCcdfLogFrechet_v_207;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_208> AgradCcdfLogFrechet_v_208;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_209> AgradCcdfLogFrechet_v_209;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_210> AgradCcdfLogFrechet_v_210;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_211> AgradCcdfLogFrechet_v_211;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_212> AgradCcdfLogFrechet_v_212;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_213> AgradCcdfLogFrechet_v_213;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_214> AgradCcdfLogFrechet_v_214;
+typedef std::tuple<AgradCcdfLogFrechet, type_v_215> AgradCcdfLogFrechet_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_200, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_201, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_202, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_203, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_204, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_205, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_206, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_207, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_208, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_209, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_210, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_211, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_212, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_213, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_214, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogFrechet_v_215, AgradCcdfLogTestFixture, AgradCcdfLogFrechet_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfFrechet, type_ffv_0> AgradCdfFrechet_ffv_0;
+typedef std::tuple<AgradCdfFrechet, type_ffv_1> AgradCdfFrechet_ffv_1;
+typedef std::tuple<AgradCdfFrechet, type_ffv_2> AgradCdfFrechet_ffv_2;
+typedef std::tuple<AgradCdfFrechet, type_ffv_3> AgradCdfFrechet_ffv_3;
+typedef std::tuple<AgradCdfFrechet, type_ffv_4> AgradCdfFrechet_ffv_4;
+typedef std::tuple<AgradCdfFrechet, type_ffv_5> AgradCdfFrechet_ffv_5;
+typedef std::tuple<AgradCdfFrechet, type_ffv_6> AgradCdfFrechet_ffv_6;
+typedef std::tuple<AgradCdfFrechet, type_ffv_7> AgradCdfFrechet_ffv_7;
+typedef std::tuple<AgradCdfFrechet, type_ffv_8> AgradCdfFrechet_ffv_8;
+typedef std::tuple<AgradCdfFrechet, type_ffv_9> AgradCdfFrechet_ffv_9;
+typedef std::tuple<AgradCdfFrechet, type_ffv_10> AgradCdfFrechet_ffv_10;
+typedef std::tuple<AgradCdfFrechet, type_ffv_11> AgradCdfFrechet_ffv_11;
+typedef std::tuple<AgradCdfFrechet, type_ffv_12> AgradCdfFrechet_ffv_12;
+typedef std::tuple<AgradCdfFrechet, type_ffv_13> AgradCdfFrechet_ffv_13;
+typedef std::tuple<AgradCdfFrechet, type_ffv_14> AgradCdfFrechet_ffv_14;
+typedef std::tuple<AgradCdfFrechet, type_ffv_15> AgradCdfFrechet_ffv_15;
+typedef std::tuple<AgradCdfFrechet, type_ffv_16> AgradCdfFrechet_ffv_16;
+typedef std::tuple<AgradCdfFrechet, type_ffv_17> AgradCdfFrechet_ffv_17;
+typedef std::tuple<AgradCdfFrechet, type_ffv_18> AgradCdfFrechet_ffv_18;
+typedef std::tuple<AgradCdfFrechet, type_ffv_19> AgradCdfFrechet_ffv_19;
+typedef std::tuple<AgradCdfFrechet, type_ffv_20> AgradCdfFrechet_ffv_20;
+typedef std::tuple<AgradCdfFrechet, type_ffv_21> AgradCdfFrechet_ffv_21;
+typedef std::tuple<AgradCdfFrechet, type_ffv_22> AgradCdfFrechet_ffv_22;
+typedef std::tuple<AgradCdfFrechet, type_ffv_23> AgradCdfFrechet_ffv_23;
+typedef std::tuple<AgradCdfFrechet, type_ffv_24> AgradCdfFrechet_ffv_24;
+typedef std::tuple<AgradCdfFrechet, type_ffv_25> AgradCdfFrechet_ffv_25;
+typedef std::tuple<AgradCdfFrechet, type_ffv_26> AgradCdfFrechet_ffv_26;
+typedef std::tuple<AgradCdfFrechet, type_ffv_27> AgradCdfFrechet_ffv_27;
+typedef std::tuple<AgradCdfFrechet, type_ffv_28> AgradCdfFrechet_ffv_28;
+typedef std::tuple<AgradCdfFrechet, type_ffv_29> AgradCdfFrechet_ffv_29;
+typedef std::tuple<AgradCdfFrechet, type_ffv_30> AgradCdfFrechet_ffv_30;
+typedef std::tuple<AgradCdfFrechet, type_ffv_31> AgradCdfFrechet_ffv_31;
+typedef std::tuple<AgradCdfFrechet, type_ffv_32> AgradCdfFrechet_ffv_32;
+typedef std::tuple<AgradCdfFrechet, type_ffv_33> AgradCdfFrechet_ffv_33;
+typedef std::tuple<AgradCdfFrechet, type_ffv_34> AgradCdfFrechet_ffv_34;
+typedef std::tuple<AgradCdfFrechet, type_ffv_35> AgradCdfFrechet_ffv_35;
+typedef std::tuple<AgradCdfFrechet, type_ffv_36> AgradCdfFrechet_ffv_36;
+typedef std::tuple<AgradCdfFrechet, type_ffv_37> AgradCdfFrechet_ffv_37;
+typedef std::tuple<AgradCdfFrechet, type_ffv_38> AgradCdfFrechet_ffv_38;
+typedef std::tuple<AgradCdfFrechet, type_ffv_39> AgradCdfFrechet_ffv_39;
+typedef std::tuple<AgradCdfFrechet, type_ffv_40> AgradCdfFrechet_ffv_40;
+typedef std::tuple<AgradCdfFrechet, type_ffv_41> AgradCdfFrechet_ffv_41;
+typedef std::tuple<AgradCdfFrechet, type_ffv_42> AgradCdfFrechet_ffv_42;
+typedef std::tuple<AgradCdfFrechet, type_ffv_43> AgradCdfFrechet_ffv_43;
+typedef std::tuple<AgradCdfFrechet, type_ffv_44> AgradCdfFrechet_ffv_44;
+typedef std::tuple<AgradCdfFrechet, type_ffv_45> AgradCdfFrechet_ffv_45;
+typedef std::tuple<AgradCdfFrechet, type_ffv_46> AgradCdfFrechet_ffv_46;
+typedef std::tuple<AgradCdfFrechet, type_ffv_47> AgradCdfFrechet_ffv_47;
+typedef std::tuple<AgradCdfFrechet, type_ffv_48> AgradCdfFrechet_ffv_48;
+typedef std::tuple<AgradCdfFrechet, type_ffv_49> AgradCdfFrechet_ffv_49;
+typedef std::tuple<AgradCdfFrechet, type_ffv_50> AgradCdfFrechet_ffv_50;
+typedef std::tuple<AgradCdfFrechet, type_ffv_51> AgradCdfFrechet_ffv_51;
+typedef std::tuple<AgradCdfFrechet, type_ffv_52> AgradCdfFrechet_ffv_52;
+typedef std::tuple<AgradCdfFrechet, type_ffv_53> AgradCdfFrechet_ffv_53;
+typedef std::tuple<AgradCdfFrechet, type_ffv_54> AgradCdfFrechet_ffv_54;
+typedef std::tuple<AgradCdfFrechet, type_ffv_55> AgradCdfFrechet_ffv_55;
+typedef std::tuple<AgradCdfFrechet, type_ffv_56> AgradCdfFrechet_ffv_56;
+typedef std::tuple<AgradCdfFrechet, type_ffv_57> AgradCdfFrechet_ffv_57;
+typedef std::tuple<AgradCdfFrechet, type_ffv_58> AgradCdfFrechet_ffv_58;
+typedef std::tuple<AgradCdfFrechet, type_ffv_59> AgradCdfFrechet_ffv_59;
+typedef std::tuple<AgradCdfFrechet, type_ffv_60> AgradCdfFrechet_ffv_60;
+typedef std::tuple<AgradCdfFrechet, type_ffv_61> AgradCdfFrechet_ffv_61;
+typedef std::tuple<AgradCdfFrechet, type_ffv_62> AgradCdfFrechet_ffv_62;
+typedef std::tuple<AgradCdfFrechet, type_ffv_63> AgradCdfFrechet_ffv_63;
+typedef std::tuple<AgradCdfFrechet, type_ffv_64> AgradCdfFrechet_ffv_64;
+typedef std::tuple<AgradCdfFrechet, type_ffv_65> AgradCdfFrechet_ffv_65;
+typedef std::tuple<AgradCdfFrechet, type_ffv_66> AgradCdfFrechet_ffv_66;
+typedef std::tuple<AgradCdfFrechet, type_ffv_67> AgradCdfFrechet_ffv_67;
+typedef std::tuple<AgradCdfFrechet, type_ffv_68> AgradCdfFrechet_ffv_68;
+typedef std::tuple<AgradCdfFrechet, type_ffv_69> AgradCdfFrechet_ffv_69;
+typedef std::tuple<AgradCdfFrechet, type_ffv_70> AgradCdfFrechet_ffv_70;
+typedef std::tuple<AgradCdfFrechet, type_ffv_71> AgradCdfFrechet_ffv_71;
+typedef std::tuple<AgradCdfFrechet, type_ffv_72> AgradCdfFrechet_ffv_72;
+typedef std::tuple<AgradCdfFrechet, type_ffv_73> AgradCdfFrechet_ffv_73;
+typedef std::tuple<AgradCdfFrechet, type_ffv_74> AgradCdfFrechet_ffv_74;
+typedef std::tuple<AgradCdfFrechet, type_ffv_75> AgradCdfFrechet_ffv_75;
+typedef std::tuple<AgradCdfFrechet, type_ffv_76> AgradCdfFrechet_ffv_76;
+typedef std::tuple<AgradCdfFrechet, type_ffv_77> AgradCdfFrechet_ffv_77;
+typedef std::tuple<AgradCdfFrechet, type_ffv_78> AgradCdfFrechet_ffv_78;
+typedef std::tuple<AgradCdfFrechet, type_ffv_79> AgradCdfFrechet_ffv_79;
+typedef std::tuple<AgradCdfFrechet, type_ffv_80> AgradCdfFrechet_ffv_80;
+typedef std::tuple<AgradCdfFrechet, type_ffv_81> AgradCdfFrechet_ffv_81;
+typedef std::tuple<AgradCdfFrechet, type_ffv_82> AgradCdfFrechet_ffv_82;
+typedef std::tuple<AgradCdfFrechet, type_ffv_83> AgradCdfFrechet_ffv_83;
+typedef std::tuple<AgradCdfFrechet, type_ffv_84> AgradCdfFrechet_ffv_84;
+typedef std::tuple<AgradCdfFrechet, type_ffv_85> AgradCdfFrechet_ffv_85;
+typedef std::tuple<AgradCdfFrechet, type_ffv_86> AgradCdfFrechet_ffv_86;
+typedef std::tuple<AgradCdfFrechet, type_ffv_87> AgradCdfFrechet_ffv_87;
+typedef std::tuple<AgradCdfFrechet, type_ffv_88> AgradCdfFrechet_ffv_88;
+typedef std::tuple<AgradCdfFrechet, type_ffv_89> AgradCdfFrechet_ffv_89;
+typedef std::tuple<AgradCdfFrechet, type_ffv_90> AgradCdfFrechet_ffv_90;
+typedef std::tuple<AgradCdfFrechet, type_ffv_91> AgradCdfFrechet_ffv_91;
+typedef std::tuple<AgradCdfFrechet, type_ffv_92> AgradCdfFrechet_ffv_92;
+typedef std::tuple<AgradCdfFrechet, type_ffv_93> AgradCdfFrechet_ffv_93;
+typedef std::tuple<AgradCdfFrechet, type_ffv_94> AgradCdfFrechet_ffv_94;
+typedef std::tuple<AgradCdfFrechet, type_ffv_95> AgradCdfFrechet_ffv_95;
+typedef std::tuple<AgradCdfFrechet, type_ffv_96> AgradCdfFrechet_ffv_96;
+typedef std::tuple<AgradCdfFrechet, type_ffv_97> AgradCdfFrechet_ffv_97;
+typedef std::tuple<AgradCdfFrechet, type_ffv_98> AgradCdfFrechet_ffv_98;
+typedef std::tuple<AgradCdfFrechet, type_ffv_99> AgradCdfFrechet_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_0, AgradCdfTestFixture, AgradCdfFrechet_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_1, AgradCdfTestFixture, AgradCdfFrechet_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_2, AgradCdfTestFixture, AgradCdfFrechet_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_3, AgradCdfTestFixture, AgradCdfFrechet_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_4, AgradCdfTestFixture, AgradCdfFrechet_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_5, AgradCdfTestFixture, AgradCdfFrechet_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_6, AgradCdfTestFixture, AgradCdfFrechet_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_7, AgradCdfTestFixture, AgradCdfFrechet_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_8, AgradCdfTestFixture, AgradCdfFrechet_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_9, AgradCdfTestFixture, AgradCdfFrechet_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_10, AgradCdfTestFixture, AgradCdfFrechet_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_11, AgradCdfTestFixture, AgradCdfFrechet_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_12, AgradCdfTestFixture, AgradCdfFrechet_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_13, AgradCdfTestFixture, AgradCdfFrechet_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_14, AgradCdfTestFixture, AgradCdfFrechet_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_15, AgradCdfTestFixture, AgradCdfFrechet_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_16, AgradCdfTestFixture, AgradCdfFrechet_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_17, AgradCdfTestFixture, AgradCdfFrechet_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_18, AgradCdfTestFixture, AgradCdfFrechet_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_19, AgradCdfTestFixture, AgradCdfFrechet_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_20, AgradCdfTestFixture, AgradCdfFrechet_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_21, AgradCdfTestFixture, AgradCdfFrechet_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_22, AgradCdfTestFixture, AgradCdfFrechet_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_23, AgradCdfTestFixture, AgradCdfFrechet_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_24, AgradCdfTestFixture, AgradCdfFrechet_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_25, AgradCdfTestFixture, AgradCdfFrechet_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_26, AgradCdfTestFixture, AgradCdfFrechet_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_27, AgradCdfTestFixture, AgradCdfFrechet_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_28, AgradCdfTestFixture, AgradCdfFrechet_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_29, AgradCdfTestFixture, AgradCdfFrechet_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_30, AgradCdfTestFixture, AgradCdfFrechet_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_31, AgradCdfTestFixture, AgradCdfFrechet_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_32, AgradCdfTestFixture, AgradCdfFrechet_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_33, AgradCdfTestFixture, AgradCdfFrechet_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_34, AgradCdfTestFixture, AgradCdfFrechet_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_35, AgradCdfTestFixture, AgradCdfFrechet_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_36, AgradCdfTestFixture, AgradCdfFrechet_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_37, AgradCdfTestFixture, AgradCdfFrechet_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_38, AgradCdfTestFixture, AgradCdfFrechet_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_39, AgradCdfTestFixture, AgradCdfFrechet_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_40, AgradCdfTestFixture, AgradCdfFrechet_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_41, AgradCdfTestFixture, AgradCdfFrechet_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_42, AgradCdfTestFixture, AgradCdfFrechet_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_43, AgradCdfTestFixture, AgradCdfFrechet_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_44, AgradCdfTestFixture, AgradCdfFrechet_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_45, AgradCdfTestFixture, AgradCdfFrechet_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_46, AgradCdfTestFixture, AgradCdfFrechet_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_47, AgradCdfTestFixture, AgradCdfFrechet_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_48, AgradCdfTestFixture, AgradCdfFrechet_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_49, AgradCdfTestFixture, AgradCdfFrechet_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_50, AgradCdfTestFixture, AgradCdfFrechet_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_51, AgradCdfTestFixture, AgradCdfFrechet_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_52, AgradCdfTestFixture, AgradCdfFrechet_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_53, AgradCdfTestFixture, AgradCdfFrechet_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_54, AgradCdfTestFixture, AgradCdfFrechet_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_55, AgradCdfTestFixture, AgradCdfFrechet_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_56, AgradCdfTestFixture, AgradCdfFrechet_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_57, AgradCdfTestFixture, AgradCdfFrechet_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_58, AgradCdfTestFixture, AgradCdfFrechet_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_59, AgradCdfTestFixture, AgradCdfFrechet_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_60, AgradCdfTestFixture, AgradCdfFrechet_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_61, AgradCdfTestFixture, AgradCdfFrechet_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_62, AgradCdfTestFixture, AgradCdfFrechet_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_63, AgradCdfTestFixture, AgradCdfFrechet_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_64, AgradCdfTestFixture, AgradCdfFrechet_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_65, AgradCdfTestFixture, AgradCdfFrechet_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_66, AgradCdfTestFixture, AgradCdfFrechet_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_67, AgradCdfTestFixture, AgradCdfFrechet_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_68, AgradCdfTestFixture, AgradCdfFrechet_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_69, AgradCdfTestFixture, AgradCdfFrechet_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_70, AgradCdfTestFixture, AgradCdfFrechet_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_71, AgradCdfTestFixture, AgradCdfFrechet_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_72, AgradCdfTestFixture, AgradCdfFrechet_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_73, AgradCdfTestFixture, AgradCdfFrechet_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_74, AgradCdfTestFixture, AgradCdfFrechet_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_75, AgradCdfTestFixture, AgradCdfFrechet_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_76, AgradCdfTestFixture, AgradCdfFrechet_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_77, AgradCdfTestFixture, AgradCdfFrechet_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_78, AgradCdfTestFixture, AgradCdfFrechet_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_79, AgradCdfTestFixture, AgradCdfFrechet_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_80, AgradCdfTestFixture, AgradCdfFrechet_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_81, AgradCdfTestFixture, AgradCdfFrechet_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_82, AgradCdfTestFixture, AgradCdfFrechet_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_83, AgradCdfTestFixture, AgradCdfFrechet_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_84, AgradCdfTestFixture, AgradCdfFrechet_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_85, AgradCdfTestFixture, AgradCdfFrechet_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_86, AgradCdfTestFixture, AgradCdfFrechet_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_87, AgradCdfTestFixture, AgradCdfFrechet_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_88, AgradCdfTestFixture, AgradCdfFrechet_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_89, AgradCdfTestFixture, AgradCdfFrechet_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_90, AgradCdfTestFixture, AgradCdfFrechet_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_91, AgradCdfTestFixture, AgradCdfFrechet_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_92, AgradCdfTestFixture, AgradCdfFrechet_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_93, AgradCdfTestFixture, AgradCdfFrechet_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_94, AgradCdfTestFixture, AgradCdfFrechet_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_95, AgradCdfTestFixture, AgradCdfFrechet_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_96, AgradCdfTestFixture, AgradCdfFrechet_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_97, AgradCdfTestFixture, AgradCdfFrechet_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_98, AgradCdfTestFixture, AgradCdfFrechet_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_99, AgradCdfTestFixture, AgradCdfFrechet_ffv_99);
+
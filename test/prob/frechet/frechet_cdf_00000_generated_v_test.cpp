@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfFrechet, type_v_0> AgradCdfFrechet_v_0;
+typedef std::tuple<AgradCdfFrechet, type_v_1> AgradCdfFrechet_v_1;
+typedef std::tuple<AgradCdfFrechet, type_v_2> AgradCdfFrechet_v_2;
+typedef std::tuple<AgradCdfFrechet, type_v_3> AgradCdfFrechet_v_3;
+typedef std::tuple<AgradCdfFrechet, type_v_4> AgradCdfFrechet_v_4;
+typedef std::tuple<AgradCdfFrechet, type_v_5> AgradCdfFrechet_v_5;
+typedef std::tuple<AgradCdfFrechet, type_v_6> AgradCdfFrechet_v_6;
+typedef std::tuple<AgradCdfFrechet, type_v_7> AgradCdfFrechet_v_7;
+typedef std::tuple<AgradCdfFrechet, type_v_8> AgradCdfFrechet_v_8;
+typedef std::tuple<AgradCdfFrechet, type_v_9> AgradCdfFrechet_v_9;
+typedef std::tuple<AgradCdfFrechet, type_v_10> AgradCdfFrechet_v_10;
+typedef std::tuple<AgradCdfFrechet, type_v_11> AgradCdfFrechet_v_11;
+typedef std::tuple<AgradCdfFrechet, type_v_12> AgradCdfFrechet_v_12;
+typedef std::tuple<AgradCdfFrechet, type_v_13> AgradCdfFrechet_v_13;
+typedef std::tuple<AgradCdfFrechet, type_v_14> AgradCdfFrechet_v_14;
+typedef std::tuple<AgradCdfFrechet, type_v_15> AgradCdfFrechet_v_15;
+typedef std::tuple<AgradCdfFrechet, type_v_16> AgradCdfFrechet_v_16;
+typedef std::tuple<AgradCdfFrechet, type_v_17> AgradCdfFrechet_v_17;
+typedef std::tuple<AgradCdfFrechet, type_v_18> AgradCdfFrechet_v_18;
+typedef std::tuple<AgradCdfFrechet, type_v_19> AgradCdfFrechet_v_19;
+typedef std::tuple<AgradCdfFrechet, type_v_20> AgradCdfFrechet_v_20;
+typedef std::tuple<AgradCdfFrechet, type_v_21> AgradCdfFrechet_v_21;
+typedef std::tuple<AgradCdfFrechet, type_v_22> AgradCdfFrechet_v_22;
+typedef std::tuple<AgradCdfFrechet, type_v_23> AgradCdfFrechet_v_23;
+typedef std::tuple<AgradCdfFrechet, type_v_24> AgradCdfFrechet_v_24;
+typedef std::tuple<AgradCdfFrechet, type_v_25> AgradCdfFrechet_v_25;
+typedef std::tuple<AgradCdfFrechet, type_v_26> AgradCdfFrechet_v_26;
+typedef std::tuple<AgradCdfFrechet, type_v_27> AgradCdfFrechet_v_27;
+typedef std::tuple<AgradCdfFrechet, type_v_28> AgradCdfFrechet_v_28;
+typedef std::tuple<AgradCdfFrechet, type_v_29> AgradCdfFrechet_v_29;
+typedef std::tuple<AgradCdfFrechet, type_v_30> AgradCdfFrechet_v_30;
+typedef std::tuple<AgradCdfFrechet, type_v_31> AgradCdfFrechet_v_31;
+typedef std::tuple<AgradCdfFrechet, type_v_32> AgradCdfFrechet_v_32;
+typedef std::tuple<AgradCdfFrechet, type_v_33> AgradCdfFrechet_v_33;
+typedef std::tuple<AgradCdfFrechet, type_v_34> AgradCdfFrechet_v_34;
+typedef std::tuple<AgradCdfFrechet, type_v_35> AgradCdfFrechet_v_35;
+typedef std::tuple<AgradCdfFrechet, type_v_36> AgradCdfFrechet_v_36;
+typedef std::tuple<AgradCdfFrechet, type_v_37> AgradCdfFrechet_v_37;
+typedef std::tuple<AgradCdfFrechet, type_v_38> AgradCdfFrechet_v_38;
+typedef std::tuple<AgradCdfFrechet, type_v_39> AgradCdfFrechet_v_39;
+typedef std::tuple<AgradCdfFrechet, type_v_40> AgradCdfFrechet_v_40;
+typedef std::tuple<AgradCdfFrechet, type_v_41> AgradCdfFrechet_v_41;
+typedef std::tuple<AgradCdfFrechet, type_v_42> AgradCdfFrechet_v_42;
+typedef std::tuple<AgradCdfFrechet, type_v_43> AgradCdfFrechet_v_43;
+typedef std::tuple<AgradCdfFrechet, type_v_44> AgradCdfFrechet_v_44;
+typedef std::tuple<AgradCdfFrechet, type_v_45> AgradCdfFrechet_v_45;
+typedef std::tuple<AgradCdfFrechet, type_v_46> AgradCdfFrechet_v_46;
+typedef std::tuple<AgradCdfFrechet, type_v_47> AgradCdfFrechet_v_47;
+typedef std::tuple<AgradCdfFrechet, type_v_48> AgradCdfFrechet_v_48;
+typedef std::tuple<AgradCdfFrechet, type_v_49> AgradCdfFrechet_v_49;
+typedef std::tuple<AgradCdfFrechet, type_v_50> AgradCdfFrechet_v_50;
+typedef std::tuple<AgradCdfFrechet, type_v_51> AgradCdfFrechet_v_51;
+typedef std::tuple<AgradCdfFrechet, type_v_52> AgradCdfFrechet_v_52;
+typedef std::tuple<AgradCdfFrechet, type_v_53> AgradCdfFrechet_v_53;
+typedef std::tuple<AgradCdfFrechet, type_v_54> AgradCdfFrechet_v_54;
+typedef std::tuple<AgradCdfFrechet, type_v_55> AgradCdfFrechet_v_55;
+typedef std::tuple<AgradCdfFrechet, type_v_56> AgradCdfFrechet_v_56;
+typedef std::tuple<AgradCdfFrechet, type_v_57> AgradCdfFrechet_v_57;
+typedef std::tuple<AgradCdfFrechet, type_v_58> AgradCdfFrechet_v_58;
+typedef std::tuple<AgradCdfFrechet, type_v_59> AgradCdfFrechet_v_59;
+typedef std::tuple<AgradCdfFrechet, type_v_60> AgradCdfFrechet_v_60;
+typedef std::tuple<AgradCdfFrechet, type_v_61> AgradCdfFrechet_v_61;
+typedef std::tuple<AgradCdfFrechet, type_v_62> AgradCdfFrechet_v_62;
+typedef std::tuple<AgradCdfFrechet, type_v_63> AgradCdfFrechet_v_63;
+typedef std::tuple<AgradCdfFrechet, type_v_64> AgradCdfFrechet_v_64;
+typedef std::tuple<AgradCdfFrechet, type_v_65> AgradCdfFrechet_v_65;
+typedef std::tuple<AgradCdfFrechet, type_v_66> AgradCdfFrechet_v_66;
+typedef std::tuple<AgradCdfFrechet, type_v_67> AgradCdfFrechet_v_67;
+typedef std::tuple<AgradCdfFrechet, type_v_68> AgradCdfFrechet_v_68;
+typedef std::tuple<AgradCdfFrechet, type_v_69> AgradCdfFrechet_v_69;
+typedef std::tuple<AgradCdfFrechet, type_v_70> AgradCdfFrechet_v_70;
+typedef std::tuple<AgradCdfFrechet, type_v_71> AgradCdfFrechet_v_71;
+typedef std::tuple<AgradCdfFrechet, type_v_72> AgradCdfFrechet_v_72;
+typedef std::tuple<AgradCdfFrechet, type_v_73> AgradCdfFrechet_v_73;
+typedef std::tuple<AgradCdfFrechet, type_v_74> AgradCdfFrechet_v_74;
+typedef std::tuple<AgradCdfFrechet, type_v_75> AgradCdfFrechet_v_75;
+typedef std::tuple<AgradCdfFrechet, type_v_76> AgradCdfFrechet_v_76;
+typedef std::tuple<AgradCdfFrechet, type_v_77> AgradCdfFrechet_v_77;
+typedef std::tuple<AgradCdfFrechet, type_v_78> AgradCdfFrechet_v_78;
+typedef std::tuple<AgradCdfFrechet, type_v_79> AgradCdfFrechet_v_79;
+typedef std::tuple<AgradCdfFrechet, type_v_80> AgradCdfFrechet_v_80;
+typedef std::tuple<AgradCdfFrechet, type_v_81> AgradCdfFrechet_v_81;
+typedef std::tuple<AgradCdfFrechet, type_v_82> AgradCdfFrechet_v_82;
+typedef std::tuple<AgradCdfFrechet, type_v_83> AgradCdfFrechet_v_83;
+typedef std::tuple<AgradCdfFrechet, type_v_84> AgradCdfFrechet_v_84;
+typedef std::tuple<AgradCdfFrechet, type_v_85> AgradCdfFrechet_v_85;
+typedef std::tuple<AgradCdfFrechet, type_v_86> AgradCdfFrechet_v_86;
+typedef std::tuple<AgradCdfFrechet, type_v_87> AgradCdfFrechet_v_87;
+typedef std::tuple<AgradCdfFrechet, type_v_88> AgradCdfFrechet_v_88;
+typedef std::tuple<AgradCdfFrechet, type_v_89> AgradCdfFrechet_v_89;
+typedef std::tuple<AgradCdfFrechet, type_v_90> AgradCdfFrechet_v_90;
+typedef std::tuple<AgradCdfFrechet, type_v_91> AgradCdfFrechet_v_91;
+typedef std::tuple<AgradCdfFrechet, type_v_92> AgradCdfFrechet_v_92;
+typedef std::tuple<AgradCdfFrechet, type_v_93> AgradCdfFrechet_v_93;
+typedef std::tuple<AgradCdfFrechet, type_v_94> AgradCdfFrechet_v_94;
+typedef std::tuple<AgradCdfFrechet, type_v_95> AgradCdfFrechet_v_95;
+typedef std::tuple<AgradCdfFrechet, type_v_96> AgradCdfFrechet_v_96;
+typedef std::tuple<AgradCdfFrechet, type_v_97> AgradCdfFrechet_v_97;
+typedef std::tuple<AgradCdfFrechet, type_v_98> AgradCdfFrechet_v_98;
+typedef std::tuple<AgradCdfFrechet, type_v_99> AgradCdfFrechet_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_0, AgradCdfTestFixture, AgradCdfFrechet_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_1, AgradCdfTestFixture, AgradCdfFrechet_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_2, AgradCdfTestFixture, AgradCdfFrechet_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_3, AgradCdfTestFixture, AgradCdfFrechet_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_4, AgradCdfTestFixture, AgradCdfFrechet_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_5, AgradCdfTestFixture, AgradCdfFrechet_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_6, AgradCdfTestFixture, AgradCdfFrechet_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_7, AgradCdfTestFixture, AgradCdfFrechet_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_8, AgradCdfTestFixture, AgradCdfFrechet_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_9, AgradCdfTestFixture, AgradCdfFrechet_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_10, AgradCdfTestFixture, AgradCdfFrechet_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_11, AgradCdfTestFixture, AgradCdfFrechet_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_12, AgradCdfTestFixture, AgradCdfFrechet_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_13, AgradCdfTestFixture, AgradCdfFrechet_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_14, AgradCdfTestFixture, AgradCdfFrechet_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_15, AgradCdfTestFixture, AgradCdfFrechet_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_16, AgradCdfTestFixture, AgradCdfFrechet_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_17, AgradCdfTestFixture, AgradCdfFrechet_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_18, AgradCdfTestFixture, AgradCdfFrechet_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_19, AgradCdfTestFixture, AgradCdfFrechet_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_20, AgradCdfTestFixture, AgradCdfFrechet_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_21, AgradCdfTestFixture, AgradCdfFrechet_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_22, AgradCdfTestFixture, AgradCdfFrechet_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_23, AgradCdfTestFixture, AgradCdfFrechet_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_24, AgradCdfTestFixture, AgradCdfFrechet_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_25, AgradCdfTestFixture, AgradCdfFrechet_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_26, AgradCdfTestFixture, AgradCdfFrechet_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_27, AgradCdfTestFixture, AgradCdfFrechet_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_28, AgradCdfTestFixture, AgradCdfFrechet_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_29, AgradCdfTestFixture, AgradCdfFrechet_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_30, AgradCdfTestFixture, AgradCdfFrechet_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_31, AgradCdfTestFixture, AgradCdfFrechet_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_32, AgradCdfTestFixture, AgradCdfFrechet_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_33, AgradCdfTestFixture, AgradCdfFrechet_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_34, AgradCdfTestFixture, AgradCdfFrechet_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_35, AgradCdfTestFixture, AgradCdfFrechet_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_36, AgradCdfTestFixture, AgradCdfFrechet_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_37, AgradCdfTestFixture, AgradCdfFrechet_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_38, AgradCdfTestFixture, AgradCdfFrechet_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_39, AgradCdfTestFixture, AgradCdfFrechet_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_40, AgradCdfTestFixture, AgradCdfFrechet_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_41, AgradCdfTestFixture, AgradCdfFrechet_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_42, AgradCdfTestFixture, AgradCdfFrechet_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_43, AgradCdfTestFixture, AgradCdfFrechet_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_44, AgradCdfTestFixture, AgradCdfFrechet_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_45, AgradCdfTestFixture, AgradCdfFrechet_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_46, AgradCdfTestFixture, AgradCdfFrechet_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_47, AgradCdfTestFixture, AgradCdfFrechet_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_48, AgradCdfTestFixture, AgradCdfFrechet_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_49, AgradCdfTestFixture, AgradCdfFrechet_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_50, AgradCdfTestFixture, AgradCdfFrechet_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_51, AgradCdfTestFixture, AgradCdfFrechet_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_52, AgradCdfTestFixture, AgradCdfFrechet_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_53, AgradCdfTestFixture, AgradCdfFrechet_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_54, AgradCdfTestFixture, AgradCdfFrechet_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_55, AgradCdfTestFixture, AgradCdfFrechet_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_56, AgradCdfTestFixture, AgradCdfFrechet_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_57, AgradCdfTestFixture, AgradCdfFrechet_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_58, AgradCdfTestFixture, AgradCdfFrechet_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_59, AgradCdfTestFixture, AgradCdfFrechet_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_60, AgradCdfTestFixture, AgradCdfFrechet_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_61, AgradCdfTestFixture, AgradCdfFrechet_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_62, AgradCdfTestFixture, AgradCdfFrechet_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_63, AgradCdfTestFixture, AgradCdfFrechet_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_64, AgradCdfTestFixture, AgradCdfFrechet_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_65, AgradCdfTestFixture, AgradCdfFrechet_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_66, AgradCdfTestFixture, AgradCdfFrechet_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_67, AgradCdfTestFixture, AgradCdfFrechet_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_68, AgradCdfTestFixture, AgradCdfFrechet_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_69, AgradCdfTestFixture, AgradCdfFrechet_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_70, AgradCdfTestFixture, AgradCdfFrechet_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_71, AgradCdfTestFixture, AgradCdfFrechet_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_72, AgradCdfTestFixture, AgradCdfFrechet_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_73, AgradCdfTestFixture, AgradCdfFrechet_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_74, AgradCdfTestFixture, AgradCdfFrechet_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_75, AgradCdfTestFixture, AgradCdfFrechet_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_76, AgradCdfTestFixture, AgradCdfFrechet_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_77, AgradCdfTestFixture, AgradCdfFrechet_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_78, AgradCdfTestFixture, AgradCdfFrechet_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_79, AgradCdfTestFixture, AgradCdfFrechet_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_80, AgradCdfTestFixture, AgradCdfFrechet_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_81, AgradCdfTestFixture, AgradCdfFrechet_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_82, AgradCdfTestFixture, AgradCdfFrechet_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_83, AgradCdfTestFixture, AgradCdfFrechet_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_84, AgradCdfTestFixture, AgradCdfFrechet_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_85, AgradCdfTestFixture, AgradCdfFrechet_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_86, AgradCdfTestFixture, AgradCdfFrechet_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_87, AgradCdfTestFixture, AgradCdfFrechet_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_88, AgradCdfTestFixture, AgradCdfFrechet_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_89, AgradCdfTestFixture, AgradCdfFrechet_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_90, AgradCdfTestFixture, AgradCdfFrechet_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_91, AgradCdfTestFixture, AgradCdfFrechet_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_92, AgradCdfTestFixture, AgradCdfFrechet_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_93, AgradCdfTestFixture, AgradCdfFrechet_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_94, AgradCdfTestFixture, AgradCdfFrechet_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_95, AgradCdfTestFixture, AgradCdfFrechet_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_96, AgradCdfTestFixture, AgradCdfFrechet_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_97, AgradCdfTestFixture, AgradCdfFrechet_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_98, AgradCdfTestFixture, AgradCdfFrechet_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_99, AgradCdfTestFixture, AgradCdfFrechet_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfFrechet, type_vv_0> AgradCdfFrechet_vv_0;
+typedef std::tuple<AgradCdfFrechet, type_vv_1> AgradCdfFrechet_vv_1;
+typedef std::tuple<AgradCdfFrechet, type_vv_2> AgradCdfFrechet_vv_2;
+typedef std::tuple<AgradCdfFrechet, type_vv_3> AgradCdfFrechet_vv_3;
+typedef std::tuple<AgradCdfFrechet, type_vv_4> AgradCdfFrechet_vv_4;
+typedef std::tuple<AgradCdfFrechet, type_vv_5> AgradCdfFrechet_vv_5;
+typedef std::tuple<AgradCdfFrechet, type_vv_6> AgradCdfFrechet_vv_6;
+typedef std::tuple<AgradCdfFrechet, type_vv_7> AgradCdfFrechet_vv_7;
+typedef std::tuple<AgradCdfFrechet, type_vv_8> AgradCdfFrechet_vv_8;
+typedef std::tuple<AgradCdfFrechet, type_vv_9> AgradCdfFrechet_vv_9;
+typedef std::tuple<AgradCdfFrechet, type_vv_10> AgradCdfFrechet_vv_10;
+typedef std::tuple<AgradCdfFrechet, type_vv_11> AgradCdfFrechet_vv_11;
+typedef std::tuple<AgradCdfFrechet, type_vv_12> AgradCdfFrechet_vv_12;
+typedef std::tuple<AgradCdfFrechet, type_vv_13> AgradCdfFrechet_vv_13;
+typedef std::tuple<AgradCdfFrechet, type_vv_14> AgradCdfFrechet_vv_14;
+typedef std::tuple<AgradCdfFrechet, type_vv_15> AgradCdfFrechet_vv_15;
+typedef std::tuple<AgradCdfFrechet, type_vv_16> AgradCdfFrechet_vv_16;
+typedef std::tuple<AgradCdfFrechet, type_vv_17> AgradCdfFrechet_vv_17;
+typedef std::tuple<AgradCdfFrechet, type_vv_18> AgradCdfFrechet_vv_18;
+typedef std::tuple<AgradCdfFrechet, type_vv_19> AgradCdfFrechet_vv_19;
+typedef std::tuple<AgradCdfFrechet, type_vv_20> AgradCdfFrechet_vv_20;
+typedef std::tuple<AgradCdfFrechet, type_vv_21> AgradCdfFrechet_vv_21;
+typedef std::tuple<AgradCdfFrechet, type_vv_22> AgradCdfFrechet_vv_22;
+typedef std::tuple<AgradCdfFrechet, type_vv_23> AgradCdfFrechet_vv_23;
+typedef std::tuple<AgradCdfFrechet, type_vv_24> AgradCdfFrechet_vv_24;
+typedef std::tuple<AgradCdfFrechet, type_vv_25> AgradCdfFrechet_vv_25;
+typedef std::tuple<AgradCdfFrechet, type_vv_26> AgradCdfFrechet_vv_26;
+typedef std::tuple<AgradCdfFrechet, type_vv_27> AgradCdfFrechet_vv_27;
+typedef std::tuple<AgradCdfFrechet, type_vv_28> AgradCdfFrechet_vv_28;
+typedef std::tuple<AgradCdfFrechet, type_vv_29> AgradCdfFrechet_vv_29;
+typedef std::tuple<AgradCdfFrechet, type_vv_30> AgradCdfFrechet_vv_30;
+typedef std::tuple<AgradCdfFrechet, type_vv_31> AgradCdfFrechet_vv_31;
+typedef std::tuple<AgradCdfFrechet, type_vv_32> AgradCdfFrechet_vv_32;
+typedef std::tuple<AgradCdfFrechet, type_vv_33> AgradCdfFrechet_vv_33;
+typedef std::tuple<AgradCdfFrechet, type_vv_34> AgradCdfFrechet_vv_34;
+typedef std::tuple<AgradCdfFrechet, type_vv_35> AgradCdfFrechet_vv_35;
+typedef std::tuple<AgradCdfFrechet, type_vv_36> AgradCdfFrechet_vv_36;
+typedef std::tuple<AgradCdfFrechet, type_vv_37> AgradCdfFrechet_vv_37;
+typedef std::tuple<AgradCdfFrechet, type_vv_38> AgradCdfFrechet_vv_38;
+typedef std::tuple<AgradCdfFrechet, type_vv_39> AgradCdfFrechet_vv_39;
+typedef std::tuple<AgradCdfFrechet, type_vv_40> AgradCdfFrechet_vv_40;
+typedef std::tuple<AgradCdfFrechet, type_vv_41> AgradCdfFrechet_vv_41;
+typedef std::tuple<AgradCdfFrechet, type_vv_42> AgradCdfFrechet_vv_42;
+typedef std::tuple<AgradCdfFrechet, type_vv_43> AgradCdfFrechet_vv_43;
+typedef std::tuple<AgradCdfFrechet, type_vv_44> AgradCdfFrechet_vv_44;
+typedef std::tuple<AgradCdfFrechet, type_vv_45> AgradCdfFrechet_vv_45;
+typedef std::tuple<AgradCdfFrechet, type_vv_46> AgradCdfFrechet_vv_46;
+typedef std::tuple<AgradCdfFrechet, type_vv_47> AgradCdfFrechet_vv_47;
+typedef std::tuple<AgradCdfFrechet, type_vv_48> AgradCdfFrechet_vv_48;
+typedef std::tuple<AgradCdfFrechet, type_vv_49> AgradCdfFrechet_vv_49;
+typedef std::tuple<AgradCdfFrechet, type_vv_50> AgradCdfFrechet_vv_50;
+typedef std::tuple<AgradCdfFrechet, type_vv_51> AgradCdfFrechet_vv_51;
+typedef std::tuple<AgradCdfFrechet, type_vv_52> AgradCdfFrechet_vv_52;
+typedef std::tuple<AgradCdfFrechet, type_vv_53> AgradCdfFrechet_vv_53;
+typedef std::tuple<AgradCdfFrechet, type_vv_54> AgradCdfFrechet_vv_54;
+typedef std::tuple<AgradCdfFrechet, type_vv_55> AgradCdfFrechet_vv_55;
+typedef std::tuple<AgradCdfFrechet, type_vv_56> AgradCdfFrechet_vv_56;
+typedef std::tuple<AgradCdfFrechet, type_vv_57> AgradCdfFrechet_vv_57;
+typedef std::tuple<AgradCdfFrechet, type_vv_58> AgradCdfFrechet_vv_58;
+typedef std::tuple<AgradCdfFrechet, type_vv_59> AgradCdfFrechet_vv_59;
+typedef std::tuple<AgradCdfFrechet, type_vv_60> AgradCdfFrechet_vv_60;
+typedef std::tuple<AgradCdfFrechet, type_vv_61> AgradCdfFrechet_vv_61;
+typedef std::tuple<AgradCdfFrechet, type_vv_62> AgradCdfFrechet_vv_62;
+typedef std::tuple<AgradCdfFrechet, type_vv_63> AgradCdfFrechet_vv_63;
+typedef std::tuple<AgradCdfFrechet, type_vv_64> AgradCdfFrechet_vv_64;
+typedef std::tuple<AgradCdfFrechet, type_vv_65> AgradCdfFrechet_vv_65;
+typedef std::tuple<AgradCdfFrechet, type_vv_66> AgradCdfFrechet_vv_66;
+typedef std::tuple<AgradCdfFrechet, type_vv_67> AgradCdfFrechet_vv_67;
+typedef std::tuple<AgradCdfFrechet, type_vv_68> AgradCdfFrechet_vv_68;
+typedef std::tuple<AgradCdfFrechet, type_vv_69> AgradCdfFrechet_vv_69;
+typedef std::tuple<AgradCdfFrechet, type_vv_70> AgradCdfFrechet_vv_70;
+typedef std::tuple<AgradCdfFrechet, type_vv_71> AgradCdfFrechet_vv_71;
+typedef std::tuple<AgradCdfFrechet, type_vv_72> AgradCdfFrechet_vv_72;
+typedef std::tuple<AgradCdfFrechet, type_vv_73> AgradCdfFrechet_vv_73;
+typedef std::tuple<AgradCdfFrechet, type_vv_74> AgradCdfFrechet_vv_74;
+typedef std::tuple<AgradCdfFrechet, type_vv_75> AgradCdfFrechet_vv_75;
+typedef std::tuple<AgradCdfFrechet, type_vv_76> AgradCdfFrechet_vv_76;
+typedef std::tuple<AgradCdfFrechet, type_vv_77> AgradCdfFrechet_vv_77;
+typedef std::tuple<AgradCdfFrechet, type_vv_78> AgradCdfFrechet_vv_78;
+typedef std::tuple<AgradCdfFrechet, type_vv_79> AgradCdfFrechet_vv_79;
+typedef std::tuple<AgradCdfFrechet, type_vv_80> AgradCdfFrechet_vv_80;
+typedef std::tuple<AgradCdfFrechet, type_vv_81> AgradCdfFrechet_vv_81;
+typedef std::tuple<AgradCdfFrechet, type_vv_82> AgradCdfFrechet_vv_82;
+typedef std::tuple<AgradCdfFrechet, type_vv_83> AgradCdfFrechet_vv_83;
+typedef std::tuple<AgradCdfFrechet, type_vv_84> AgradCdfFrechet_vv_84;
+typedef std::tuple<AgradCdfFrechet, type_vv_85> AgradCdfFrechet_vv_85;
+typedef std::tuple<AgradCdfFrechet, type_vv_86> AgradCdfFrechet_vv_86;
+typedef std::tuple<AgradCdfFrechet, type_vv_87> AgradCdfFrechet_vv_87;
+typedef std::tuple<AgradCdfFrechet, type_vv_88> AgradCdfFrechet_vv_88;
+typedef std::tuple<AgradCdfFrechet, type_vv_89> AgradCdfFrechet_vv_89;
+typedef std::tuple<AgradCdfFrechet, type_vv_90> AgradCdfFrechet_vv_90;
+typedef std::tuple<AgradCdfFrechet, type_vv_91> AgradCdfFrechet_vv_91;
+typedef std::tuple<AgradCdfFrechet, type_vv_92> AgradCdfFrechet_vv_92;
+typedef std::tuple<AgradCdfFrechet, type_vv_93> AgradCdfFrechet_vv_93;
+typedef std::tuple<AgradCdfFrechet, type_vv_94> AgradCdfFrechet_vv_94;
+typedef std::tuple<AgradCdfFrechet, type_vv_95> AgradCdfFrechet_vv_95;
+typedef std::tuple<AgradCdfFrechet, type_vv_96> AgradCdfFrechet_vv_96;
+typedef std::tuple<AgradCdfFrechet, type_vv_97> AgradCdfFrechet_vv_97;
+typedef std::tuple<AgradCdfFrechet, type_vv_98> AgradCdfFrechet_vv_98;
+typedef std::tuple<AgradCdfFrechet, type_vv_99> AgradCdfFrechet_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_0, AgradCdfTestFixture, AgradCdfFrechet_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_1, AgradCdfTestFixture, AgradCdfFrechet_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_2, AgradCdfTestFixture, AgradCdfFrechet_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_3, AgradCdfTestFixture, AgradCdfFrechet_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_4, AgradCdfTestFixture, AgradCdfFrechet_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_5, AgradCdfTestFixture, AgradCdfFrechet_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_6, AgradCdfTestFixture, AgradCdfFrechet_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_7, AgradCdfTestFixture, AgradCdfFrechet_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_8, AgradCdfTestFixture, AgradCdfFrechet_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_9, AgradCdfTestFixture, AgradCdfFrechet_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_10, AgradCdfTestFixture, AgradCdfFrechet_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_11, AgradCdfTestFixture, AgradCdfFrechet_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_12, AgradCdfTestFixture, AgradCdfFrechet_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_13, AgradCdfTestFixture, AgradCdfFrechet_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_14, AgradCdfTestFixture, AgradCdfFrechet_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_15, AgradCdfTestFixture, AgradCdfFrechet_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_16, AgradCdfTestFixture, AgradCdfFrechet_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_17, AgradCdfTestFixture, AgradCdfFrechet_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_18, AgradCdfTestFixture, AgradCdfFrechet_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_19, AgradCdfTestFixture, AgradCdfFrechet_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_20, AgradCdfTestFixture, AgradCdfFrechet_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_21, AgradCdfTestFixture, AgradCdfFrechet_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_22, AgradCdfTestFixture, AgradCdfFrechet_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_23, AgradCdfTestFixture, AgradCdfFrechet_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_24, AgradCdfTestFixture, AgradCdfFrechet_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_25, AgradCdfTestFixture, AgradCdfFrechet_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_26, AgradCdfTestFixture, AgradCdfFrechet_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_27, AgradCdfTestFixture, AgradCdfFrechet_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_28, AgradCdfTestFixture, AgradCdfFrechet_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_29, AgradCdfTestFixture, AgradCdfFrechet_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_30, AgradCdfTestFixture, AgradCdfFrechet_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_31, AgradCdfTestFixture, AgradCdfFrechet_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_32, AgradCdfTestFixture, AgradCdfFrechet_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_33, AgradCdfTestFixture, AgradCdfFrechet_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_34, AgradCdfTestFixture, AgradCdfFrechet_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_35, AgradCdfTestFixture, AgradCdfFrechet_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_36, AgradCdfTestFixture, AgradCdfFrechet_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_37, AgradCdfTestFixture, AgradCdfFrechet_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_38, AgradCdfTestFixture, AgradCdfFrechet_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_39, AgradCdfTestFixture, AgradCdfFrechet_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_40, AgradCdfTestFixture, AgradCdfFrechet_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_41, AgradCdfTestFixture, AgradCdfFrechet_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_42, AgradCdfTestFixture, AgradCdfFrechet_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_43, AgradCdfTestFixture, AgradCdfFrechet_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_44, AgradCdfTestFixture, AgradCdfFrechet_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_45, AgradCdfTestFixture, AgradCdfFrechet_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_46, AgradCdfTestFixture, AgradCdfFrechet_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_47, AgradCdfTestFixture, AgradCdfFrechet_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_48, AgradCdfTestFixture, AgradCdfFrechet_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_49, AgradCdfTestFixture, AgradCdfFrechet_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_50, AgradCdfTestFixture, AgradCdfFrechet_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_51, AgradCdfTestFixture, AgradCdfFrechet_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_52, AgradCdfTestFixture, AgradCdfFrechet_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_53, AgradCdfTestFixture, AgradCdfFrechet_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_54, AgradCdfTestFixture, AgradCdfFrechet_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_55, AgradCdfTestFixture, AgradCdfFrechet_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_56, AgradCdfTestFixture, AgradCdfFrechet_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_57, AgradCdfTestFixture, AgradCdfFrechet_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_58, AgradCdfTestFixture, AgradCdfFrechet_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_59, AgradCdfTestFixture, AgradCdfFrechet_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_60, AgradCdfTestFixture, AgradCdfFrechet_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_61, AgradCdfTestFixture, AgradCdfFrechet_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_62, AgradCdfTestFixture, AgradCdfFrechet_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_63, AgradCdfTestFixture, AgradCdfFrechet_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_64, AgradCdfTestFixture, AgradCdfFrechet_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_65, AgradCdfTestFixture, AgradCdfFrechet_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_66, AgradCdfTestFixture, AgradCdfFrechet_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_67, AgradCdfTestFixture, AgradCdfFrechet_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_68, AgradCdfTestFixture, AgradCdfFrechet_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_69, AgradCdfTestFixture, AgradCdfFrechet_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_70, AgradCdfTestFixture, AgradCdfFrechet_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_71, AgradCdfTestFixture, AgradCdfFrechet_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_72, AgradCdfTestFixture, AgradCdfFrechet_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_73, AgradCdfTestFixture, AgradCdfFrechet_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_74, AgradCdfTestFixture, AgradCdfFrechet_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_75, AgradCdfTestFixture, AgradCdfFrechet_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_76, AgradCdfTestFixture, AgradCdfFrechet_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_77, AgradCdfTestFixture, AgradCdfFrechet_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_78, AgradCdfTestFixture, AgradCdfFrechet_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_79, AgradCdfTestFixture, AgradCdfFrechet_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_80, AgradCdfTestFixture, AgradCdfFrechet_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_81, AgradCdfTestFixture, AgradCdfFrechet_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_82, AgradCdfTestFixture, AgradCdfFrechet_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_83, AgradCdfTestFixture, AgradCdfFrechet_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_84, AgradCdfTestFixture, AgradCdfFrechet_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_85, AgradCdfTestFixture, AgradCdfFrechet_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_86, AgradCdfTestFixture, AgradCdfFrechet_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_87, AgradCdfTestFixture, AgradCdfFrechet_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_88, AgradCdfTestFixture, AgradCdfFrechet_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_89, AgradCdfTestFixture, AgradCdfFrechet_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_90, AgradCdfTestFixture, AgradCdfFrechet_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_91, AgradCdfTestFixture, AgradCdfFrechet_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_92, AgradCdfTestFixture, AgradCdfFrechet_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_93, AgradCdfTestFixture, AgradCdfFrechet_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_94, AgradCdfTestFixture, AgradCdfFrechet_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_95, AgradCdfTestFixture, AgradCdfFrechet_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_96, AgradCdfTestFixture, AgradCdfFrechet_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_97, AgradCdfTestFixture, AgradCdfFrechet_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_98, AgradCdfTestFixture, AgradCdfFrechet_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_99, AgradCdfTestFixture, AgradCdfFrechet_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfFrechet, type_ffv_100> AgradCdfFrechet_ffv_100;
+typedef std::tuple<AgradCdfFrechet, type_ffv_101> AgradCdfFrechet_ffv_101;
+typedef std::tuple<AgradCdfFrechet, type_ffv_102> AgradCdfFrechet_ffv_102;
+typedef std::tuple<AgradCdfFrechet, type_ffv_103> AgradCdfFrechet_ffv_103;
+typedef std::tuple<AgradCdfFrechet, type_ffv_104> AgradCdfFrechet_ffv_104;
+typedef std::tuple<AgradCdfFrechet, type_ffv_105> AgradCdfFrechet_ffv_105;
+typedef std::tuple<AgradCdfFrechet, type_ffv_106> AgradCdfFrechet_ffv_106;
+typedef std::tuple<AgradCdfFrechet, type_ffv_107> AgradCdfFrechet_ffv_107;
+typedef std::tuple<AgradCdfFrechet, type_ffv_108> AgradCdfFrechet_ffv_108;
+typedef std::tuple<AgradCdfFrechet, type_ffv_109> AgradCdfFrechet_ffv_109;
+typedef std::tuple<AgradCdfFrechet, type_ffv_110> AgradCdfFrechet_ffv_110;
+typedef std::tuple<AgradCdfFrechet, type_ffv_111> AgradCdfFrechet_ffv_111;
+typedef std::tuple<AgradCdfFrechet, type_ffv_112> AgradCdfFrechet_ffv_112;
+typedef std::tuple<AgradCdfFrechet, type_ffv_113> AgradCdfFrechet_ffv_113;
+typedef std::tuple<AgradCdfFrechet, type_ffv_114> AgradCdfFrechet_ffv_114;
+typedef std::tuple<AgradCdfFrechet, type_ffv_115> AgradCdfFrechet_ffv_115;
+typedef std::tuple<AgradCdfFrechet, type_ffv_116> AgradCdfFrechet_ffv_116;
+typedef std::tuple<AgradCdfFrechet, type_ffv_117> AgradCdfFrechet_ffv_117;
+typedef std::tuple<AgradCdfFrechet, type_ffv_118> AgradCdfFrechet_ffv_118;
+typedef std::tuple<AgradCdfFrechet, type_ffv_119> AgradCdfFrechet_ffv_119;
+typedef std::tuple<AgradCdfFrechet, type_ffv_120> AgradCdfFrechet_ffv_120;
+typedef std::tuple<AgradCdfFrechet, type_ffv_121> AgradCdfFrechet_ffv_121;
+typedef std::tuple<AgradCdfFrechet, type_ffv_122> AgradCdfFrechet_ffv_122;
+typedef std::tuple<AgradCdfFrechet, type_ffv_123> AgradCdfFrechet_ffv_123;
+typedef std::tuple<AgradCdfFrechet, type_ffv_124> AgradCdfFrechet_ffv_124;
+typedef std::tuple<AgradCdfFrechet, type_ffv_125> AgradCdfFrechet_ffv_125;
+typedef std::tuple<AgradCdfFrechet, type_ffv_126> AgradCdfFrechet_ffv_126;
+typedef std::tuple<AgradCdfFrechet, type_ffv_127> AgradCdfFrechet_ffv_127;
+typedef std::tuple<AgradCdfFrechet, type_ffv_128> AgradCdfFrechet_ffv_128;
+typedef std::tuple<AgradCdfFrechet, type_ffv_129> AgradCdfFrechet_ffv_129;
+typedef std::tuple<AgradCdfFrechet, type_ffv_130> AgradCdfFrechet_ffv_130;
+typedef std::tuple<AgradCdfFrechet, type_ffv_131> AgradCdfFrechet_ffv_131;
+typedef std::tuple<AgradCdfFrechet, type_ffv_132> AgradCdfFrechet_ffv_132;
+typedef std::tuple<AgradCdfFrechet, type_ffv_133> AgradCdfFrechet_ffv_133;
+typedef std::tuple<AgradCdfFrechet, type_ffv_134> AgradCdfFrechet_ffv_134;
+typedef std::tuple<AgradCdfFrechet, type_ffv_135> AgradCdfFrechet_ffv_135;
+typedef std::tuple<AgradCdfFrechet, type_ffv_136> AgradCdfFrechet_ffv_136;
+typedef std::tuple<AgradCdfFrechet, type_ffv_137> AgradCdfFrechet_ffv_137;
+typedef std::tuple<AgradCdfFrechet, type_ffv_138> AgradCdfFrechet_ffv_138;
+typedef std::tuple<AgradCdfFrechet, type_ffv_139> AgradCdfFrechet_ffv_139;
+typedef std::tuple<AgradCdfFrechet, type_ffv_140> AgradCdfFrechet_ffv_140;
+typedef std::tuple<AgradCdfFrechet, type_ffv_141> AgradCdfFrechet_ffv_141;
+typedef std::tuple<AgradCdfFrechet, type_ffv_142> AgradCdfFrechet_ffv_142;
+typedef std::tuple<AgradCdfFrechet, type_ffv_143> AgradCdfFrechet_ffv_143;
+typedef std::tuple<AgradCdfFrechet, type_ffv_144> AgradCdfFrechet_ffv_144;
+typedef std::tuple<AgradCdfFrechet, type_ffv_145> AgradCdfFrechet_ffv_145;
+typedef std::tuple<AgradCdfFrechet, type_ffv_146> AgradCdfFrechet_ffv_146;
+typedef std::tuple<AgradCdfFrechet, type_ffv_147> AgradCdfFrechet_ffv_147;
+typedef std::tuple<AgradCdfFrechet, type_ffv_148> AgradCdfFrechet_ffv_148;
+typedef std::tuple<AgradCdfFrechet, type_ffv_149> AgradCdfFrechet_ffv_149;
+typedef std::tuple<AgradCdfFrechet, type_ffv_150> AgradCdfFrechet_ffv_150;
+typedef std::tuple<AgradCdfFrechet, type_ffv_151> AgradCdfFrechet_ffv_151;
+typedef std::tuple<AgradCdfFrechet, type_ffv_152> AgradCdfFrechet_ffv_152;
+typedef std::tuple<AgradCdfFrechet, type_ffv_153> AgradCdfFrechet_ffv_153;
+typedef std::tuple<AgradCdfFrechet, type_ffv_154> AgradCdfFrechet_ffv_154;
+typedef std::tuple<AgradCdfFrechet, type_ffv_155> AgradCdfFrechet_ffv_155;
+typedef std::tuple<AgradCdfFrechet, type_ffv_156> AgradCdfFrechet_ffv_156;
+typedef std::tuple<AgradCdfFrechet, type_ffv_157> AgradCdfFrechet_ffv_157;
+typedef std::tuple<AgradCdfFrechet, type_ffv_158> AgradCdfFrechet_ffv_158;
+typedef std::tuple<AgradCdfFrechet, type_ffv_159> AgradCdfFrechet_ffv_159;
+typedef std::tuple<AgradCdfFrechet, type_ffv_160> AgradCdfFrechet_ffv_160;
+typedef std::tuple<AgradCdfFrechet, type_ffv_161> AgradCdfFrechet_ffv_161;
+typedef std::tuple<AgradCdfFrechet, type_ffv_162> AgradCdfFrechet_ffv_162;
+typedef std::tuple<AgradCdfFrechet, type_ffv_163> AgradCdfFrechet_ffv_163;
+typedef std::tuple<AgradCdfFrechet, type_ffv_164> AgradCdfFrechet_ffv_164;
+typedef std::tuple<AgradCdfFrechet, type_ffv_165> AgradCdfFrechet_ffv_165;
+typedef std::tuple<AgradCdfFrechet, type_ffv_166> AgradCdfFrechet_ffv_166;
+typedef std::tuple<AgradCdfFrechet, type_ffv_167> AgradCdfFrechet_ffv_167;
+typedef std::tuple<AgradCdfFrechet, type_ffv_168> AgradCdfFrechet_ffv_168;
+typedef std::tuple<AgradCdfFrechet, type_ffv_169> AgradCdfFrechet_ffv_169;
+typedef std::tuple<AgradCdfFrechet, type_ffv_170> AgradCdfFrechet_ffv_170;
+typedef std::tuple<AgradCdfFrechet, type_ffv_171> AgradCdfFrechet_ffv_171;
+typedef std::tuple<AgradCdfFrechet, type_ffv_172> AgradCdfFrechet_ffv_172;
+typedef std::tuple<AgradCdfFrechet, type_ffv_173> AgradCdfFrechet_ffv_173;
+typedef std::tuple<AgradCdfFrechet, type_ffv_174> AgradCdfFrechet_ffv_174;
+typedef std::tuple<AgradCdfFrechet, type_ffv_175> AgradCdfFrechet_ffv_175;
+typedef std::tuple<AgradCdfFrechet, type_ffv_176> AgradCdfFrechet_ffv_176;
+typedef std::tuple<AgradCdfFrechet, type_ffv_177> AgradCdfFrechet_ffv_177;
+typedef std::tuple<AgradCdfFrechet, type_ffv_178> AgradCdfFrechet_ffv_178;
+typedef std::tuple<AgradCdfFrechet, type_ffv_179> AgradCdfFrechet_ffv_179;
+typedef std::tuple<AgradCdfFrechet, type_ffv_180> AgradCdfFrechet_ffv_180;
+typedef std::tuple<AgradCdfFrechet, type_ffv_181> AgradCdfFrechet_ffv_181;
+typedef std::tuple<AgradCdfFrechet, type_ffv_182> AgradCdfFrechet_ffv_182;
+typedef std::tuple<AgradCdfFrechet, type_ffv_183> AgradCdfFrechet_ffv_183;
+typedef std::tuple<AgradCdfFrechet, type_ffv_184> AgradCdfFrechet_ffv_184;
+typedef std::tuple<AgradCdfFrechet, type_ffv_185> AgradCdfFrechet_ffv_185;
+typedef std::tuple<AgradCdfFrechet, type_ffv_186> AgradCdfFrechet_ffv_186;
+typedef std::tuple<AgradCdfFrechet, type_ffv_187> AgradCdfFrechet_ffv_187;
+typedef std::tuple<AgradCdfFrechet, type_ffv_188> AgradCdfFrechet_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_100, AgradCdfTestFixture, AgradCdfFrechet_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_101, AgradCdfTestFixture, AgradCdfFrechet_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_102, AgradCdfTestFixture, AgradCdfFrechet_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_103, AgradCdfTestFixture, AgradCdfFrechet_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_104, AgradCdfTestFixture, AgradCdfFrechet_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_105, AgradCdfTestFixture, AgradCdfFrechet_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_106, AgradCdfTestFixture, AgradCdfFrechet_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_107, AgradCdfTestFixture, AgradCdfFrechet_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_108, AgradCdfTestFixture, AgradCdfFrechet_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_109, AgradCdfTestFixture, AgradCdfFrechet_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_110, AgradCdfTestFixture, AgradCdfFrechet_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_111, AgradCdfTestFixture, AgradCdfFrechet_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_112, AgradCdfTestFixture, AgradCdfFrechet_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_113, AgradCdfTestFixture, AgradCdfFrechet_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_114, AgradCdfTestFixture, AgradCdfFrechet_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_115, AgradCdfTestFixture, AgradCdfFrechet_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_116, AgradCdfTestFixture, AgradCdfFrechet_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_117, AgradCdfTestFixture, AgradCdfFrechet_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_118, AgradCdfTestFixture, AgradCdfFrechet_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_119, AgradCdfTestFixture, AgradCdfFrechet_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_120, AgradCdfTestFixture, AgradCdfFrechet_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_121, AgradCdfTestFixture, AgradCdfFrechet_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_122, AgradCdfTestFixture, AgradCdfFrechet_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_123, AgradCdfTestFixture, AgradCdfFrechet_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_124, AgradCdfTestFixture, AgradCdfFrechet_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_125, AgradCdfTestFixture, AgradCdfFrechet_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_126, AgradCdfTestFixture, AgradCdfFrechet_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_127, AgradCdfTestFixture, AgradCdfFrechet_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_128, AgradCdfTestFixture, AgradCdfFrechet_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_129, AgradCdfTestFixture, AgradCdfFrechet_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_130, AgradCdfTestFixture, AgradCdfFrechet_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_131, AgradCdfTestFixture, AgradCdfFrechet_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_132, AgradCdfTestFixture, AgradCdfFrechet_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_133, AgradCdfTestFixture, AgradCdfFrechet_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_134, AgradCdfTestFixture, AgradCdfFrechet_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_135, AgradCdfTestFixture, AgradCdfFrechet_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_136, AgradCdfTestFixture, AgradCdfFrechet_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_137, AgradCdfTestFixture, AgradCdfFrechet_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_138, AgradCdfTestFixture, AgradCdfFrechet_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_139, AgradCdfTestFixture, AgradCdfFrechet_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_140, AgradCdfTestFixture, AgradCdfFrechet_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_141, AgradCdfTestFixture, AgradCdfFrechet_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_142, AgradCdfTestFixture, AgradCdfFrechet_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_143, AgradCdfTestFixture, AgradCdfFrechet_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_144, AgradCdfTestFixture, AgradCdfFrechet_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_145, AgradCdfTestFixture, AgradCdfFrechet_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_146, AgradCdfTestFixture, AgradCdfFrechet_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_147, AgradCdfTestFixture, AgradCdfFrechet_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_148, AgradCdfTestFixture, AgradCdfFrechet_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_149, AgradCdfTestFixture, AgradCdfFrechet_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_150, AgradCdfTestFixture, AgradCdfFrechet_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_151, AgradCdfTestFixture, AgradCdfFrechet_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_152, AgradCdfTestFixture, AgradCdfFrechet_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_153, AgradCdfTestFixture, AgradCdfFrechet_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_154, AgradCdfTestFixture, AgradCdfFrechet_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_155, AgradCdfTestFixture, AgradCdfFrechet_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_156, AgradCdfTestFixture, AgradCdfFrechet_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_157, AgradCdfTestFixture, AgradCdfFrechet_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_158, AgradCdfTestFixture, AgradCdfFrechet_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_159, AgradCdfTestFixture, AgradCdfFrechet_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_160, AgradCdfTestFixture, AgradCdfFrechet_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_161, AgradCdfTestFixture, AgradCdfFrechet_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_162, AgradCdfTestFixture, AgradCdfFrechet_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_163, AgradCdfTestFixture, AgradCdfFrechet_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_164, AgradCdfTestFixture, AgradCdfFrechet_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_165, AgradCdfTestFixture, AgradCdfFrechet_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_166, AgradCdfTestFixture, AgradCdfFrechet_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_167, AgradCdfTestFixture, AgradCdfFrechet_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_168, AgradCdfTestFixture, AgradCdfFrechet_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_169, AgradCdfTestFixture, AgradCdfFrechet_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_170, AgradCdfTestFixture, AgradCdfFrechet_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_171, AgradCdfTestFixture, AgradCdfFrechet_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_172, AgradCdfTestFixture, AgradCdfFrechet_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_173, AgradCdfTestFixture, AgradCdfFrechet_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_174, AgradCdfTestFixture, AgradCdfFrechet_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_175, AgradCdfTestFixture, AgradCdfFrechet_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_176, AgradCdfTestFixture, AgradCdfFrechet_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_177, AgradCdfTestFixture, AgradCdfFrechet_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_178, AgradCdfTestFixture, AgradCdfFrechet_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_179, AgradCdfTestFixture, AgradCdfFrechet_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_180, AgradCdfTestFixture, AgradCdfFrechet_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_181, AgradCdfTestFixture, AgradCdfFrechet_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_182, AgradCdfTestFixture, AgradCdfFrechet_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_183, AgradCdfTestFixture, AgradCdfFrechet_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_184, AgradCdfTestFixture, AgradCdfFrechet_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_185, AgradCdfTestFixture, AgradCdfFrechet_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_186, AgradCdfTestFixture, AgradCdfFrechet_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_187, AgradCdfTestFixture, AgradCdfFrechet_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_ffv_188, AgradCdfTestFixture, AgradCdfFrechet_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfFrechet, type_v_100> AgradCdfFrechet_v_100;
+typedef std::tuple<AgradCdfFrechet, type_v_101> AgradCdfFrechet_v_101;
+typedef std::tuple<AgradCdfFrechet, type_v_102> AgradCdfFrechet_v_102;
+typedef std::tuple<AgradCdfFrechet, type_v_103> AgradCdfFrechet_v_103;
+typedef std::tuple<AgradCdfFrechet, type_v_104> AgradCdfFrechet_v_104;
+typedef std::tuple<AgradCdfFrechet, type_v_105> AgradCdfFrechet_v_105;
+typedef std::tuple<AgradCdfFrechet, type_v_106> AgradCdfFrechet_v_106;
+typedef std::tuple<AgradCdfFrechet, type_v_107> AgradCdfFrechet_v_107;
+typedef std::tuple<AgradCdfFrechet, type_v_108> AgradCdfFrechet_v_108;
+typedef std::tuple<AgradCdfFrechet, type_v_109> AgradCdfFrechet_v_109;
+typedef std::tuple<AgradCdfFrechet, type_v_110> AgradCdfFrechet_v_110;
+typedef std::tuple<AgradCdfFrechet, type_v_111> AgradCdfFrechet_v_111;
+typedef std::tuple<AgradCdfFrechet, type_v_112> AgradCdfFrechet_v_112;
+typedef std::tuple<AgradCdfFrechet, type_v_113> AgradCdfFrechet_v_113;
+typedef std::tuple<AgradCdfFrechet, type_v_114> AgradCdfFrechet_v_114;
+typedef std::tuple<AgradCdfFrechet, type_v_115> AgradCdfFrechet_v_115;
+typedef std::tuple<AgradCdfFrechet, type_v_116> AgradCdfFrechet_v_116;
+typedef std::tuple<AgradCdfFrechet, type_v_117> AgradCdfFrechet_v_117;
+typedef std::tuple<AgradCdfFrechet, type_v_118> AgradCdfFrechet_v_118;
+typedef std::tuple<AgradCdfFrechet, type_v_119> AgradCdfFrechet_v_119;
+typedef std::tuple<AgradCdfFrechet, type_v_120> AgradCdfFrechet_v_120;
+typedef std::tuple<AgradCdfFrechet, type_v_121> AgradCdfFrechet_v_121;
+typedef std::tuple<AgradCdfFrechet, type_v_122> AgradCdfFrechet_v_122;
+typedef std::tuple<AgradCdfFrechet, type_v_123> AgradCdfFrechet_v_123;
+typedef std::tuple<AgradCdfFrechet, type_v_124> AgradCdfFrechet_v_124;
+typedef std::tuple<AgradCdfFrechet, type_v_125> AgradCdfFrechet_v_125;
+typedef std::tuple<AgradCdfFrechet, type_v_126> AgradCdfFrechet_v_126;
+typedef std::tuple<AgradCdfFrechet, type_v_127> AgradCdfFrechet_v_127;
+typedef std::tuple<AgradCdfFrechet, type_v_128> AgradCdfFrechet_v_128;
+typedef std::tuple<AgradCdfFrechet, type_v_129> AgradCdfFrechet_v_129;
+typedef std::tuple<AgradCdfFrechet, type_v_130> AgradCdfFrechet_v_130;
+typedef std::tuple<AgradCdfFrechet, type_v_131> AgradCdfFrechet_v_131;
+typedef std::tuple<AgradCdfFrechet, type_v_132> AgradCdfFrechet_v_132;
+typedef std::tuple<AgradCdfFrechet, type_v_133> AgradCdfFrechet_v_133;
+typedef std::tuple<AgradCdfFrechet, type_v_134> AgradCdfFrechet_v_134;
+typedef std::tuple<AgradCdfFrechet, type_v_135> AgradCdfFrechet_v_135;
+typedef std::tuple<AgradCdfFrechet, type_v_136> AgradCdfFrechet_v_136;
+typedef std::tuple<AgradCdfFrechet, type_v_137> AgradCdfFrechet_v_137;
+typedef std::tuple<AgradCdfFrechet, type_v_138> AgradCdfFrechet_v_138;
+typedef std::tuple<AgradCdfFrechet, type_v_139> AgradCdfFrechet_v_139;
+typedef std::tuple<AgradCdfFrechet, type_v_140> AgradCdfFrechet_v_140;
+typedef std::tuple<AgradCdfFrechet, type_v_141> AgradCdfFrechet_v_141;
+typedef std::tuple<AgradCdfFrechet, type_v_142> AgradCdfFrechet_v_142;
+typedef std::tuple<AgradCdfFrechet, type_v_143> AgradCdfFrechet_v_143;
+typedef std::tuple<AgradCdfFrechet, type_v_144> AgradCdfFrechet_v_144;
+typedef std::tuple<AgradCdfFrechet, type_v_145> AgradCdfFrechet_v_145;
+typedef std::tuple<AgradCdfFrechet, type_v_146> AgradCdfFrechet_v_146;
+typedef std::tuple<AgradCdfFrechet, type_v_147> AgradCdfFrechet_v_147;
+typedef std::tuple<AgradCdfFrechet, type_v_148> AgradCdfFrechet_v_148;
+typedef std::tuple<AgradCdfFrechet, type_v_149> AgradCdfFrechet_v_149;
+typedef std::tuple<AgradCdfFrechet, type_v_150> AgradCdfFrechet_v_150;
+typedef std::tuple<AgradCdfFrechet, type_v_151> AgradCdfFrechet_v_151;
+typedef std::tuple<AgradCdfFrechet, type_v_152> AgradCdfFrechet_v_152;
+typedef std::tuple<AgradCdfFrechet, type_v_153> AgradCdfFrechet_v_153;
+typedef std::tuple<AgradCdfFrechet, type_v_154> AgradCdfFrechet_v_154;
+typedef std::tuple<AgradCdfFrechet, type_v_155> AgradCdfFrechet_v_155;
+typedef std::tuple<AgradCdfFrechet, type_v_156> AgradCdfFrechet_v_156;
+typedef std::tuple<AgradCdfFrechet, type_v_157> AgradCdfFrechet_v_157;
+typedef std::tuple<AgradCdfFrechet, type_v_158> AgradCdfFrechet_v_158;
+typedef std::tuple<AgradCdfFrechet, type_v_159> AgradCdfFrechet_v_159;
+typedef std::tuple<AgradCdfFrechet, type_v_160> AgradCdfFrechet_v_160;
+typedef std::tuple<AgradCdfFrechet, type_v_161> AgradCdfFrechet_v_161;
+typedef std::tuple<AgradCdfFrechet, type_v_162> AgradCdfFrechet_v_162;
+typedef std::tuple<AgradCdfFrechet, type_v_163> AgradCdfFrechet_v_163;
+typedef std::tuple<AgradCdfFrechet, type_v_164> AgradCdfFrechet_v_164;
+typedef std::tuple<AgradCdfFrechet, type_v_165> AgradCdfFrechet_v_165;
+typedef std::tuple<AgradCdfFrechet, type_v_166> AgradCdfFrechet_v_166;
+typedef std::tuple<AgradCdfFrechet, type_v_167> AgradCdfFrechet_v_167;
+typedef std::tuple<AgradCdfFrechet, type_v_168> AgradCdfFrechet_v_168;
+typedef std::tuple<AgradCdfFrechet, type_v_169> AgradCdfFrechet_v_169;
+typedef std::tuple<AgradCdfFrechet, type_v_170> AgradCdfFrechet_v_170;
+typedef std::tuple<AgradCdfFrechet, type_v_171> AgradCdfFrechet_v_171;
+typedef std::tuple<AgradCdfFrechet, type_v_172> AgradCdfFrechet_v_172;
+typedef std::tuple<AgradCdfFrechet, type_v_173> AgradCdfFrechet_v_173;
+typedef std::tuple<AgradCdfFrechet, type_v_174> AgradCdfFrechet_v_174;
+typedef std::tuple<AgradCdfFrechet, type_v_175> AgradCdfFrechet_v_175;
+typedef std::tuple<AgradCdfFrechet, type_v_176> AgradCdfFrechet_v_176;
+typedef std::tuple<AgradCdfFrechet, type_v_177> AgradCdfFrechet_v_177;
+typedef std::tuple<AgradCdfFrechet, type_v_178> AgradCdfFrechet_v_178;
+typedef std::tuple<AgradCdfFrechet, type_v_179> AgradCdfFrechet_v_179;
+typedef std::tuple<AgradCdfFrechet, type_v_180> AgradCdfFrechet_v_180;
+typedef std::tuple<AgradCdfFrechet, type_v_181> AgradCdfFrechet_v_181;
+typedef std::tuple<AgradCdfFrechet, type_v_182> AgradCdfFrechet_v_182;
+typedef std::tuple<AgradCdfFrechet, type_v_183> AgradCdfFrechet_v_183;
+typedef std::tuple<AgradCdfFrechet, type_v_184> AgradCdfFrechet_v_184;
+typedef std::tuple<AgradCdfFrechet, type_v_185> AgradCdfFrechet_v_185;
+typedef std::tuple<AgradCdfFrechet, type_v_186> AgradCdfFrechet_v_186;
+typedef std::tuple<AgradCdfFrechet, type_v_187> AgradCdfFrechet_v_187;
+typedef std::tuple<AgradCdfFrechet, type_v_188> AgradCdfFrechet_v_188;
+typedef std::tuple<AgradCdfFrechet, type_v_189> AgradCdfFrechet_v_189;
+typedef std::tuple<AgradCdfFrechet, type_v_190> AgradCdfFrechet_v_190;
+typedef std::tuple<AgradCdfFrechet, type_v_191> AgradCdfFrechet_v_191;
+typedef std::tuple<AgradCdfFrechet, type_v_192> AgradCdfFrechet_v_192;
+typedef std::tuple<AgradCdfFrechet, type_v_193> AgradCdfFrechet_v_193;
+typedef std::tuple<AgradCdfFrechet, type_v_194> AgradCdfFrechet_v_194;
+typedef std::tuple<AgradCdfFrechet, type_v_195> AgradCdfFrechet_v_195;
+typedef std::tuple<AgradCdfFrechet, type_v_196> AgradCdfFrechet_v_196;
+typedef std::tuple<AgradCdfFrechet, type_v_197> AgradCdfFrechet_v_197;
+typedef std::tuple<AgradCdfFrechet, type_v_198> AgradCdfFrechet_v_198;
+typedef std::tuple<AgradCdfFrechet, type_v_199> AgradCdfFrechet_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_100, AgradCdfTestFixture, AgradCdfFrechet_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_101, AgradCdfTestFixture, AgradCdfFrechet_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_102, AgradCdfTestFixture, AgradCdfFrechet_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_103, AgradCdfTestFixture, AgradCdfFrechet_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_104, AgradCdfTestFixture, AgradCdfFrechet_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_105, AgradCdfTestFixture, AgradCdfFrechet_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_106, AgradCdfTestFixture, AgradCdfFrechet_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_107, AgradCdfTestFixture, AgradCdfFrechet_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_108, AgradCdfTestFixture, AgradCdfFrechet_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_109, AgradCdfTestFixture, AgradCdfFrechet_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_110, AgradCdfTestFixture, AgradCdfFrechet_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_111, AgradCdfTestFixture, AgradCdfFrechet_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_112, AgradCdfTestFixture, AgradCdfFrechet_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_113, AgradCdfTestFixture, AgradCdfFrechet_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_114, AgradCdfTestFixture, AgradCdfFrechet_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_115, AgradCdfTestFixture, AgradCdfFrechet_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_116, AgradCdfTestFixture, AgradCdfFrechet_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_117, AgradCdfTestFixture, AgradCdfFrechet_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_118, AgradCdfTestFixture, AgradCdfFrechet_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_119, AgradCdfTestFixture, AgradCdfFrechet_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_120, AgradCdfTestFixture, AgradCdfFrechet_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_121, AgradCdfTestFixture, AgradCdfFrechet_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_122, AgradCdfTestFixture, AgradCdfFrechet_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_123, AgradCdfTestFixture, AgradCdfFrechet_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_124, AgradCdfTestFixture, AgradCdfFrechet_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_125, AgradCdfTestFixture, AgradCdfFrechet_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_126, AgradCdfTestFixture, AgradCdfFrechet_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_127, AgradCdfTestFixture, AgradCdfFrechet_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_128, AgradCdfTestFixture, AgradCdfFrechet_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_129, AgradCdfTestFixture, AgradCdfFrechet_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_130, AgradCdfTestFixture, AgradCdfFrechet_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_131, AgradCdfTestFixture, AgradCdfFrechet_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_132, AgradCdfTestFixture, AgradCdfFrechet_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_133, AgradCdfTestFixture, AgradCdfFrechet_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_134, AgradCdfTestFixture, AgradCdfFrechet_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_135, AgradCdfTestFixture, AgradCdfFrechet_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_136, AgradCdfTestFixture, AgradCdfFrechet_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_137, AgradCdfTestFixture, AgradCdfFrechet_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_138, AgradCdfTestFixture, AgradCdfFrechet_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_139, AgradCdfTestFixture, AgradCdfFrechet_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_140, AgradCdfTestFixture, AgradCdfFrechet_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_141, AgradCdfTestFixture, AgradCdfFrechet_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_142, AgradCdfTestFixture, AgradCdfFrechet_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_143, AgradCdfTestFixture, AgradCdfFrechet_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_144, AgradCdfTestFixture, AgradCdfFrechet_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_145, AgradCdfTestFixture, AgradCdfFrechet_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_146, AgradCdfTestFixture, AgradCdfFrechet_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_147, AgradCdfTestFixture, AgradCdfFrechet_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_148, AgradCdfTestFixture, AgradCdfFrechet_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_149, AgradCdfTestFixture, AgradCdfFrechet_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_150, AgradCdfTestFixture, AgradCdfFrechet_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_151, AgradCdfTestFixture, AgradCdfFrechet_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_152, AgradCdfTestFixture, AgradCdfFrechet_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_153, AgradCdfTestFixture, AgradCdfFrechet_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_154, AgradCdfTestFixture, AgradCdfFrechet_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_155, AgradCdfTestFixture, AgradCdfFrechet_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_156, AgradCdfTestFixture, AgradCdfFrechet_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_157, AgradCdfTestFixture, AgradCdfFrechet_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_158, AgradCdfTestFixture, AgradCdfFrechet_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_159, AgradCdfTestFixture, AgradCdfFrechet_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_160, AgradCdfTestFixture, AgradCdfFrechet_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_161, AgradCdfTestFixture, AgradCdfFrechet_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_162, AgradCdfTestFixture, AgradCdfFrechet_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_163, AgradCdfTestFixture, AgradCdfFrechet_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_164, AgradCdfTestFixture, AgradCdfFrechet_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_165, AgradCdfTestFixture, AgradCdfFrechet_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_166, AgradCdfTestFixture, AgradCdfFrechet_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_167, AgradCdfTestFixture, AgradCdfFrechet_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_168, AgradCdfTestFixture, AgradCdfFrechet_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_169, AgradCdfTestFixture, AgradCdfFrechet_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_170, AgradCdfTestFixture, AgradCdfFrechet_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_171, AgradCdfTestFixture, AgradCdfFrechet_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_172, AgradCdfTestFixture, AgradCdfFrechet_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_173, AgradCdfTestFixture, AgradCdfFrechet_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_174, AgradCdfTestFixture, AgradCdfFrechet_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_175, AgradCdfTestFixture, AgradCdfFrechet_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_176, AgradCdfTestFixture, AgradCdfFrechet_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_177, AgradCdfTestFixture, AgradCdfFrechet_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_178, AgradCdfTestFixture, AgradCdfFrechet_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_179, AgradCdfTestFixture, AgradCdfFrechet_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_180, AgradCdfTestFixture, AgradCdfFrechet_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_181, AgradCdfTestFixture, AgradCdfFrechet_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_182, AgradCdfTestFixture, AgradCdfFrechet_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_183, AgradCdfTestFixture, AgradCdfFrechet_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_184, AgradCdfTestFixture, AgradCdfFrechet_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_185, AgradCdfTestFixture, AgradCdfFrechet_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_186, AgradCdfTestFixture, AgradCdfFrechet_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_187, AgradCdfTestFixture, AgradCdfFrechet_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_188, AgradCdfTestFixture, AgradCdfFrechet_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_189, AgradCdfTestFixture, AgradCdfFrechet_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_190, AgradCdfTestFixture, AgradCdfFrechet_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_191, AgradCdfTestFixture, AgradCdfFrechet_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_192, AgradCdfTestFixture, AgradCdfFrechet_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_193, AgradCdfTestFixture, AgradCdfFrechet_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_194, AgradCdfTestFixture, AgradCdfFrechet_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_195, AgradCdfTestFixture, AgradCdfFrechet_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_196, AgradCdfTestFixture, AgradCdfFrechet_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_197, AgradCdfTestFixture, AgradCdfFrechet_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_198, AgradCdfTestFixture, AgradCdfFrechet_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_v_199, AgradCdfTestFixture, AgradCdfFrechet_v_199);
+
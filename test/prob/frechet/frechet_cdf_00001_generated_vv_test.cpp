@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfFrechet, type_vv_100> AgradCdfFrechet_vv_100;
+typedef std::tuple<AgradCdfFrechet, type_vv_101> AgradCdfFrechet_vv_101;
+typedef std::tuple<AgradCdfFrechet, type_vv_102> AgradCdfFrechet_vv_102;
+typedef std::tuple<AgradCdfFrechet, type_vv_103> AgradCdfFrechet_vv_103;
+typedef std::tuple<AgradCdfFrechet, type_vv_104> AgradCdfFrechet_vv_104;
+typedef std::tuple<AgradCdfFrechet, type_vv_105> AgradCdfFrechet_vv_105;
+typedef std::tuple<AgradCdfFrechet, type_vv_106> AgradCdfFrechet_vv_106;
+typedef std::tuple<AgradCdfFrechet, type_vv_107> AgradCdfFrechet_vv_107;
+typedef std::tuple<AgradCdfFrechet, type_vv_108> AgradCdfFrechet_vv_108;
+typedef std::tuple<AgradCdfFrechet, type_vv_109> AgradCdfFrechet_vv_109;
+typedef std::tuple<AgradCdfFrechet, type_vv_110> AgradCdfFrechet_vv_110;
+typedef std::tuple<AgradCdfFrechet, type_vv_111> AgradCdfFrechet_vv_111;
+typedef std::tuple<AgradCdfFrechet, type_vv_112> AgradCdfFrechet_vv_112;
+typedef std::tuple<AgradCdfFrechet, type_vv_113> AgradCdfFrechet_vv_113;
+typedef std::tuple<AgradCdfFrechet, type_vv_114> AgradCdfFrechet_vv_114;
+typedef std::tuple<AgradCdfFrechet, type_vv_115> AgradCdfFrechet_vv_115;
+typedef std::tuple<AgradCdfFrechet, type_vv_116> AgradCdfFrechet_vv_116;
+typedef std::tuple<AgradCdfFrechet, type_vv_117> AgradCdfFrechet_vv_117;
+typedef std::tuple<AgradCdfFrechet, type_vv_118> AgradCdfFrechet_vv_118;
+typedef std::tuple<AgradCdfFrechet, type_vv_119> AgradCdfFrechet_vv_119;
+typedef std::tuple<AgradCdfFrechet, type_vv_120> AgradCdfFrechet_vv_120;
+typedef std::tuple<AgradCdfFrechet, type_vv_121> AgradCdfFrechet_vv_121;
+typedef std::tuple<AgradCdfFrechet, type_vv_122> AgradCdfFrechet_vv_122;
+typedef std::tuple<AgradCdfFrechet, type_vv_123> AgradCdfFrechet_vv_123;
+typedef std::tuple<AgradCdfFrechet, type_vv_124> AgradCdfFrechet_vv_124;
+typedef std::tuple<AgradCdfFrechet, type_vv_125> AgradCdfFrechet_vv_125;
+typedef std::tuple<AgradCdfFrechet, type_vv_126> AgradCdfFrechet_vv_126;
+typedef std::tuple<AgradCdfFrechet, type_vv_127> AgradCdfFrechet_vv_127;
+typedef std::tuple<AgradCdfFrechet, type_vv_128> AgradCdfFrechet_vv_128;
+typedef std::tuple<AgradCdfFrechet, type_vv_129> AgradCdfFrechet_vv_129;
+typedef std::tuple<AgradCdfFrechet, type_vv_130> AgradCdfFrechet_vv_130;
+typedef std::tuple<AgradCdfFrechet, type_vv_131> AgradCdfFrechet_vv_131;
+typedef std::tuple<AgradCdfFrechet, type_vv_132> AgradCdfFrechet_vv_132;
+typedef std::tuple<AgradCdfFrechet, type_vv_133> AgradCdfFrechet_vv_133;
+typedef std::tuple<AgradCdfFrechet, type_vv_134> AgradCdfFrechet_vv_134;
+typedef std::tuple<AgradCdfFrechet, type_vv_135> AgradCdfFrechet_vv_135;
+typedef std::tuple<AgradCdfFrechet, type_vv_136> AgradCdfFrechet_vv_136;
+typedef std::tuple<AgradCdfFrechet, type_vv_137> AgradCdfFrechet_vv_137;
+typedef std::tuple<AgradCdfFrechet, type_vv_138> AgradCdfFrechet_vv_138;
+typedef std::tuple<AgradCdfFrechet, type_vv_139> AgradCdfFrechet_vv_139;
+typedef std::tuple<AgradCdfFrechet, type_vv_140> AgradCdfFrechet_vv_140;
+typedef std::tuple<AgradCdfFrechet, type_vv_141> AgradCdfFrechet_vv_141;
+typedef std::tuple<AgradCdfFrechet, type_vv_142> AgradCdfFrechet_vv_142;
+typedef std::tuple<AgradCdfFrechet, type_vv_143> AgradCdfFrechet_vv_143;
+typedef std::tuple<AgradCdfFrechet, type_vv_144> AgradCdfFrechet_vv_144;
+typedef std::tuple<AgradCdfFrechet, type_vv_145> AgradCdfFrechet_vv_145;
+typedef std::tuple<AgradCdfFrechet, type_vv_146> AgradCdfFrechet_vv_146;
+typedef std::tuple<AgradCdfFrechet, type_vv_147> AgradCdfFrechet_vv_147;
+typedef std::tuple<AgradCdfFrechet, type_vv_148> AgradCdfFrechet_vv_148;
+typedef std::tuple<AgradCdfFrechet, type_vv_149> AgradCdfFrechet_vv_149;
+typedef std::tuple<AgradCdfFrechet, type_vv_150> AgradCdfFrechet_vv_150;
+typedef std::tuple<AgradCdfFrechet, type_vv_151> AgradCdfFrechet_vv_151;
+typedef std::tuple<AgradCdfFrechet, type_vv_152> AgradCdfFrechet_vv_152;
+typedef std::tuple<AgradCdfFrechet, type_vv_153> AgradCdfFrechet_vv_153;
+typedef std::tuple<AgradCdfFrechet, type_vv_154> AgradCdfFrechet_vv_154;
+typedef std::tuple<AgradCdfFrechet, type_vv_155> AgradCdfFrechet_vv_155;
+typedef std::tuple<AgradCdfFrechet, type_vv_156> AgradCdfFrechet_vv_156;
+typedef std::tuple<AgradCdfFrechet, type_vv_157> AgradCdfFrechet_vv_157;
+typedef std::tuple<AgradCdfFrechet, type_vv_158> AgradCdfFrechet_vv_158;
+typedef std::tuple<AgradCdfFrechet, type_vv_159> AgradCdfFrechet_vv_159;
+typedef std::tuple<AgradCdfFrechet, type_vv_160> AgradCdfFrechet_vv_160;
+typedef std::tuple<AgradCdfFrechet, type_vv_161> AgradCdfFrechet_vv_161;
+typedef std::tuple<AgradCdfFrechet, type_vv_162> AgradCdfFrechet_vv_162;
+typedef std::tuple<AgradCdfFrechet, type_vv_163> AgradCdfFrechet_vv_163;
+typedef std::tuple<AgradCdfFrechet, type_vv_164> AgradCdfFrechet_vv_164;
+typedef std::tuple<AgradCdfFrechet, type_vv_165> AgradCdfFrechet_vv_165;
+typedef std::tuple<AgradCdfFrechet, type_vv_166> AgradCdfFrechet_vv_166;
+typedef std::tuple<AgradCdfFrechet, type_vv_167> AgradCdfFrechet_vv_167;
+typedef std::tuple<AgradCdfFrechet, type_vv_168> AgradCdfFrechet_vv_168;
+typedef std::tuple<AgradCdfFrechet, type_vv_169> AgradCdfFrechet_vv_169;
+typedef std::tuple<AgradCdfFrechet, type_vv_170> AgradCdfFrechet_vv_170;
+typedef std::tuple<AgradCdfFrechet, type_vv_171> AgradCdfFrechet_vv_171;
+typedef std::tuple<AgradCdfFrechet, type_vv_172> AgradCdfFrechet_vv_172;
+typedef std::tuple<AgradCdfFrechet, type_vv_173> AgradCdfFrechet_vv_173;
+typedef std::tuple<AgradCdfFrechet, type_vv_174> AgradCdfFrechet_vv_174;
+typedef std::tuple<AgradCdfFrechet, type_vv_175> AgradCdfFrechet_vv_175;
+typedef std::tuple<AgradCdfFrechet, type_vv_176> AgradCdfFrechet_vv_176;
+typedef std::tuple<AgradCdfFrechet, type_vv_177> AgradCdfFrechet_vv_177;
+typedef std::tuple<AgradCdfFrechet, type_vv_178> AgradCdfFrechet_vv_178;
+typedef std::tuple<AgradCdfFrechet, type_vv_179> AgradCdfFrechet_vv_179;
+typedef std::tuple<AgradCdfFrechet, type_vv_180> AgradCdfFrechet_vv_180;
+typedef std::tuple<AgradCdfFrechet, type_vv_181> AgradCdfFrechet_vv_181;
+typedef std::tuple<AgradCdfFrechet, type_vv_182> AgradCdfFrechet_vv_182;
+typedef std::tuple<AgradCdfFrechet, type_vv_183> AgradCdfFrechet_vv_183;
+typedef std::tuple<AgradCdfFrechet, type_vv_184> AgradCdfFrechet_vv_184;
+typedef std::tuple<AgradCdfFrechet, type_vv_185> AgradCdfFrechet_vv_185;
+typedef std::tuple<AgradCdfFrechet, type_vv_186> AgradCdfFrechet_vv_186;
+typedef std::tuple<AgradCdfFrechet, type_vv_187> AgradCdfFrechet_vv_187;
+typedef std::tuple<AgradCdfFrechet, type_vv_188> AgradCdfFrechet_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_100, AgradCdfTestFixture, AgradCdfFrechet_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_101, AgradCdfTestFixture, AgradCdfFrechet_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_102, AgradCdfTestFixture, AgradCdfFrechet_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_103, AgradCdfTestFixture, AgradCdfFrechet_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_104, AgradCdfTestFixture, AgradCdfFrechet_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_105, AgradCdfTestFixture, AgradCdfFrechet_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_106, AgradCdfTestFixture, AgradCdfFrechet_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_107, AgradCdfTestFixture, AgradCdfFrechet_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_108, AgradCdfTestFixture, AgradCdfFrechet_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_109, AgradCdfTestFixture, AgradCdfFrechet_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_110, AgradCdfTestFixture, AgradCdfFrechet_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_111, AgradCdfTestFixture, AgradCdfFrechet_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_112, AgradCdfTestFixture, AgradCdfFrechet_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_113, AgradCdfTestFixture, AgradCdfFrechet_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_114, AgradCdfTestFixture, AgradCdfFrechet_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_115, AgradCdfTestFixture, AgradCdfFrechet_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_116, AgradCdfTestFixture, AgradCdfFrechet_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_117, AgradCdfTestFixture, AgradCdfFrechet_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_118, AgradCdfTestFixture, AgradCdfFrechet_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_119, AgradCdfTestFixture, AgradCdfFrechet_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_120, AgradCdfTestFixture, AgradCdfFrechet_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_121, AgradCdfTestFixture, AgradCdfFrechet_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_122, AgradCdfTestFixture, AgradCdfFrechet_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_123, AgradCdfTestFixture, AgradCdfFrechet_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_124, AgradCdfTestFixture, AgradCdfFrechet_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_125, AgradCdfTestFixture, AgradCdfFrechet_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_126, AgradCdfTestFixture, AgradCdfFrechet_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_127, AgradCdfTestFixture, AgradCdfFrechet_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_128, AgradCdfTestFixture, AgradCdfFrechet_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_129, AgradCdfTestFixture, AgradCdfFrechet_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_130, AgradCdfTestFixture, AgradCdfFrechet_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_131, AgradCdfTestFixture, AgradCdfFrechet_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_132, AgradCdfTestFixture, AgradCdfFrechet_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_133, AgradCdfTestFixture, AgradCdfFrechet_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_134, AgradCdfTestFixture, AgradCdfFrechet_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_135, AgradCdfTestFixture, AgradCdfFrechet_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_136, AgradCdfTestFixture, AgradCdfFrechet_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_137, AgradCdfTestFixture, AgradCdfFrechet_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_138, AgradCdfTestFixture, AgradCdfFrechet_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_139, AgradCdfTestFixture, AgradCdfFrechet_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_140, AgradCdfTestFixture, AgradCdfFrechet_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_141, AgradCdfTestFixture, AgradCdfFrechet_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_142, AgradCdfTestFixture, AgradCdfFrechet_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_143, AgradCdfTestFixture, AgradCdfFrechet_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_144, AgradCdfTestFixture, AgradCdfFrechet_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_145, AgradCdfTestFixture, AgradCdfFrechet_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_146, AgradCdfTestFixture, AgradCdfFrechet_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_147, AgradCdfTestFixture, AgradCdfFrechet_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_148, AgradCdfTestFixture, AgradCdfFrechet_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_149, AgradCdfTestFixture, AgradCdfFrechet_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_150, AgradCdfTestFixture, AgradCdfFrechet_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_151, AgradCdfTestFixture, AgradCdfFrechet_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_152, AgradCdfTestFixture, AgradCdfFrechet_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_153, AgradCdfTestFixture, AgradCdfFrechet_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_154, AgradCdfTestFixture, AgradCdfFrechet_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_155, AgradCdfTestFixture, AgradCdfFrechet_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_156, AgradCdfTestFixture, AgradCdfFrechet_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_157, AgradCdfTestFixture, AgradCdfFrechet_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_158, AgradCdfTestFixture, AgradCdfFrechet_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_159, AgradCdfTestFixture, AgradCdfFrechet_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_160, AgradCdfTestFixture, AgradCdfFrechet_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_161, AgradCdfTestFixture, AgradCdfFrechet_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_162, AgradCdfTestFixture, AgradCdfFrechet_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_163, AgradCdfTestFixture, AgradCdfFrechet_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_164, AgradCdfTestFixture, AgradCdfFrechet_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_165, AgradCdfTestFixture, AgradCdfFrechet_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_166, AgradCdfTestFixture, AgradCdfFrechet_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_167, AgradCdfTestFixture, AgradCdfFrechet_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_168, AgradCdfTestFixture, AgradCdfFrechet_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_169, AgradCdfTestFixture, AgradCdfFrechet_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_170, AgradCdfTestFixture, AgradCdfFrechet_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_171, AgradCdfTestFixture, AgradCdfFrechet_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_172, AgradCdfTestFixture, AgradCdfFrechet_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_173, AgradCdfTestFixture, AgradCdfFrechet_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_174, AgradCdfTestFixture, AgradCdfFrechet_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_175, AgradCdfTestFixture, AgradCdfFrechet_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_176, AgradCdfTestFixture, AgradCdfFrechet_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_177, AgradCdfTestFixture, AgradCdfFrechet_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_178, AgradCdfTestFixture, AgradCdfFrechet_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_179, AgradCdfTestFixture, AgradCdfFrechet_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_180, AgradCdfTestFixture, AgradCdfFrechet_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_181, AgradCdfTestFixture, AgradCdfFrechet_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_182, AgradCdfTestFixture, AgradCdfFrechet_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_183, AgradCdfTestFixture, AgradCdfFrechet_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_184, AgradCdfTestFixture, AgradCdfFrechet_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_185, AgradCdfTestFixture, AgradCdfFrechet_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_186, AgradCdfTestFixture, AgradCdfFrechet_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_187, AgradCdfTestFixture, AgradCdfFrechet_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfFrechet_vv_188, AgradCdfTestFixture, AgradCdfFrechet_vv_188);
+
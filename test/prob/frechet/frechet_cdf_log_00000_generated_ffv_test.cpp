@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_0> AgradCdfLogFrechet_ffv_0;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_1> AgradCdfLogFrechet_ffv_1;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_2> AgradCdfLogFrechet_ffv_2;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_3> AgradCdfLogFrechet_ffv_3;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_4> AgradCdfLogFrechet_ffv_4;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_5> AgradCdfLogFrechet_ffv_5;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_6> AgradCdfLogFrechet_ffv_6;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_7> AgradCdfLogFrechet_ffv_7;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_8> AgradCdfLogFrechet_ffv_8;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_9> AgradCdfLogFrechet_ffv_9;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_10> AgradCdfLogFrechet_ffv_10;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_11> AgradCdfLogFrechet_ffv_11;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_12> AgradCdfLogFrechet_ffv_12;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_13> AgradCdfLogFrechet_ffv_13;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_14> AgradCdfLogFrechet_ffv_14;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_15> AgradCdfLogFrechet_ffv_15;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_16> AgradCdfLogFrechet_ffv_16;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_17> AgradCdfLogFrechet_ffv_17;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_18> AgradCdfLogFrechet_ffv_18;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_19> AgradCdfLogFrechet_ffv_19;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_20> AgradCdfLogFrechet_ffv_20;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_21> AgradCdfLogFrechet_ffv_21;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_22> AgradCdfLogFrechet_ffv_22;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_23> AgradCdfLogFrechet_ffv_23;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_24> AgradCdfLogFrechet_ffv_24;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_25> AgradCdfLogFrechet_ffv_25;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_26> AgradCdfLogFrechet_ffv_26;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_27> AgradCdfLogFrechet_ffv_27;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_28> AgradCdfLogFrechet_ffv_28;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_29> AgradCdfLogFrechet_ffv_29;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_30> AgradCdfLogFrechet_ffv_30;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_31> AgradCdfLogFrechet_ffv_31;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_32> AgradCdfLogFrechet_ffv_32;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_33> AgradCdfLogFrechet_ffv_33;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_34> AgradCdfLogFrechet_ffv_34;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_35> AgradCdfLogFrechet_ffv_35;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_36> AgradCdfLogFrechet_ffv_36;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_37> AgradCdfLogFrechet_ffv_37;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_38> AgradCdfLogFrechet_ffv_38;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_39> AgradCdfLogFrechet_ffv_39;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_40> AgradCdfLogFrechet_ffv_40;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_41> AgradCdfLogFrechet_ffv_41;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_42> AgradCdfLogFrechet_ffv_42;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_43> AgradCdfLogFrechet_ffv_43;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_44> AgradCdfLogFrechet_ffv_44;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_45> AgradCdfLogFrechet_ffv_45;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_46> AgradCdfLogFrechet_ffv_46;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_47> AgradCdfLogFrechet_ffv_47;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_48> AgradCdfLogFrechet_ffv_48;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_49> AgradCdfLogFrechet_ffv_49;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_50> AgradCdfLogFrechet_ffv_50;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_51> AgradCdfLogFrechet_ffv_51;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_52> AgradCdfLogFrechet_ffv_52;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_53> AgradCdfLogFrechet_ffv_53;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_54> AgradCdfLogFrechet_ffv_54;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_55> AgradCdfLogFrechet_ffv_55;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_56> AgradCdfLogFrechet_ffv_56;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_57> AgradCdfLogFrechet_ffv_57;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_58> AgradCdfLogFrechet_ffv_58;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_59> AgradCdfLogFrechet_ffv_59;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_60> AgradCdfLogFrechet_ffv_60;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_61> AgradCdfLogFrechet_ffv_61;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_62> AgradCdfLogFrechet_ffv_62;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_63> AgradCdfLogFrechet_ffv_63;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_64> AgradCdfLogFrechet_ffv_64;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_65> AgradCdfLogFrechet_ffv_65;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_66> AgradCdfLogFrechet_ffv_66;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_67> AgradCdfLogFrechet_ffv_67;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_68> AgradCdfLogFrechet_ffv_68;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_69> AgradCdfLogFrechet_ffv_69;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_70> AgradCdfLogFrechet_ffv_70;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_71> AgradCdfLogFrechet_ffv_71;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_72> AgradCdfLogFrechet_ffv_72;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_73> AgradCdfLogFrechet_ffv_73;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_74> AgradCdfLogFrechet_ffv_74;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_75> AgradCdfLogFrechet_ffv_75;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_76> AgradCdfLogFrechet_ffv_76;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_77> AgradCdfLogFrechet_ffv_77;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_78> AgradCdfLogFrechet_ffv_78;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_79> AgradCdfLogFrechet_ffv_79;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_80> AgradCdfLogFrechet_ffv_80;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_81> AgradCdfLogFrechet_ffv_81;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_82> AgradCdfLogFrechet_ffv_82;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_83> AgradCdfLogFrechet_ffv_83;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_84> AgradCdfLogFrechet_ffv_84;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_85> AgradCdfLogFrechet_ffv_85;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_86> AgradCdfLogFrechet_ffv_86;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_87> AgradCdfLogFrechet_ffv_87;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_88> AgradCdfLogFrechet_ffv_88;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_89> AgradCdfLogFrechet_ffv_89;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_90> AgradCdfLogFrechet_ffv_90;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_91> AgradCdfLogFrechet_ffv_91;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_92> AgradCdfLogFrechet_ffv_92;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_93> AgradCdfLogFrechet_ffv_93;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_94> AgradCdfLogFrechet_ffv_94;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_95> AgradCdfLogFrechet_ffv_95;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_96> AgradCdfLogFrechet_ffv_96;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_97> AgradCdfLogFrechet_ffv_97;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_98> AgradCdfLogFrechet_ffv_98;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_99> AgradCdfLogFrechet_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_0, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_1, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_2, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_3, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_4, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_5, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_6, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_7, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_8, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_9, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_10, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_11, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_12, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_13, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_14, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_15, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_16, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_17, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_18, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_19, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_20, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_21, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_22, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_23, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_24, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_25, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_26, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_27, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_28, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_29, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_30, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_31, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_32, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_33, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_34, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_35, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_36, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_37, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_38, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_39, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_40, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_41, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_42, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_43, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_44, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_45, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_46, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_47, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_48, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_49, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_50, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_51, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_52, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_53, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_54, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_55, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_56, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_57, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_58, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_59, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_60, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_61, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_62, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_63, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_64, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_65, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_66, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_67, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_68, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_69, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_70, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_71, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_72, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_73, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_74, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_75, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_76, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_77, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_78, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_79, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_80, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_81, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_82, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_83, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_84, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_85, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_86, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_87, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_88, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_89, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_90, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_91, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_92, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_93, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_94, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_95, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_96, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_97, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_98, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_99, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogFrechet, type_v_0> AgradCdfLogFrechet_v_0;
+typedef std::tuple<AgradCdfLogFrechet, type_v_1> AgradCdfLogFrechet_v_1;
+typedef std::tuple<AgradCdfLogFrechet, type_v_2> AgradCdfLogFrechet_v_2;
+typedef std::tuple<AgradCdfLogFrechet, type_v_3> AgradCdfLogFrechet_v_3;
+typedef std::tuple<AgradCdfLogFrechet, type_v_4> AgradCdfLogFrechet_v_4;
+typedef std::tuple<AgradCdfLogFrechet, type_v_5> AgradCdfLogFrechet_v_5;
+typedef std::tuple<AgradCdfLogFrechet, type_v_6> AgradCdfLogFrechet_v_6;
+typedef std::tuple<AgradCdfLogFrechet, type_v_7> AgradCdfLogFrechet_v_7;
+typedef std::tuple<AgradCdfLogFrechet, type_v_8> AgradCdfLogFrechet_v_8;
+typedef std::tuple<AgradCdfLogFrechet, type_v_9> AgradCdfLogFrechet_v_9;
+typedef std::tuple<AgradCdfLogFrechet, type_v_10> AgradCdfLogFrechet_v_10;
+typedef std::tuple<AgradCdfLogFrechet, type_v_11> AgradCdfLogFrechet_v_11;
+typedef std::tuple<AgradCdfLogFrechet, type_v_12> AgradCdfLogFrechet_v_12;
+typedef std::tuple<AgradCdfLogFrechet, type_v_13> AgradCdfLogFrechet_v_13;
+typedef std::tuple<AgradCdfLogFrechet, type_v_14> AgradCdfLogFrechet_v_14;
+typedef std::tuple<AgradCdfLogFrechet, type_v_15> AgradCdfLogFrechet_v_15;
+typedef std::tuple<AgradCdfLogFrechet, type_v_16> AgradCdfLogFrechet_v_16;
+typedef std::tuple<AgradCdfLogFrechet, type_v_17> AgradCdfLogFrechet_v_17;
+typedef std::tuple<AgradCdfLogFrechet, type_v_18> AgradCdfLogFrechet_v_18;
+typedef std::tuple<AgradCdfLogFrechet, type_v_19> AgradCdfLogFrechet_v_19;
+typedef std::tuple<AgradCdfLogFrechet, type_v_20> AgradCdfLogFrechet_v_20;
+typedef std::tuple<AgradCdfLogFrechet, type_v_21> AgradCdfLogFrechet_v_21;
+typedef std::tuple<AgradCdfLogFrechet, type_v_22> AgradCdfLogFrechet_v_22;
+typedef std::tuple<AgradCdfLogFrechet, type_v_23> AgradCdfLogFrechet_v_23;
+typedef std::tuple<AgradCdfLogFrechet, type_v_24> AgradCdfLogFrechet_v_24;
+typedef std::tuple<AgradCdfLogFrechet, type_v_25> AgradCdfLogFrechet_v_25;
+typedef std::tuple<AgradCdfLogFrechet, type_v_26> AgradCdfLogFrechet_v_26;
+typedef std::tuple<AgradCdfLogFrechet, type_v_27> AgradCdfLogFrechet_v_27;
+typedef std::tuple<AgradCdfLogFrechet, type_v_28> AgradCdfLogFrechet_v_28;
+typedef std::tuple<AgradCdfLogFrechet, type_v_29> AgradCdfLogFrechet_v_29;
+typedef std::tuple<AgradCdfLogFrechet, type_v_30> AgradCdfLogFrechet_v_30;
+typedef std::tuple<AgradCdfLogFrechet, type_v_31> AgradCdfLogFrechet_v_31;
+typedef std::tuple<AgradCdfLogFrechet, type_v_32> AgradCdfLogFrechet_v_32;
+typedef std::tuple<AgradCdfLogFrechet, type_v_33> AgradCdfLogFrechet_v_33;
+typedef std::tuple<AgradCdfLogFrechet, type_v_34> AgradCdfLogFrechet_v_34;
+typedef std::tuple<AgradCdfLogFrechet, type_v_35> AgradCdfLogFrechet_v_35;
+typedef std::tuple<AgradCdfLogFrechet, type_v_36> AgradCdfLogFrechet_v_36;
+typedef std::tuple<AgradCdfLogFrechet, type_v_37> AgradCdfLogFrechet_v_37;
+typedef std::tuple<AgradCdfLogFrechet, type_v_38> AgradCdfLogFrechet_v_38;
+typedef std::tuple<AgradCdfLogFrechet, type_v_39> AgradCdfLogFrechet_v_39;
+typedef std::tuple<AgradCdfLogFrechet, type_v_40> AgradCdfLogFrechet_v_40;
+typedef std::tuple<AgradCdfLogFrechet, type_v_41> AgradCdfLogFrechet_v_41;
+typedef std::tuple<AgradCdfLogFrechet, type_v_42> AgradCdfLogFrechet_v_42;
+typedef std::tuple<AgradCdfLogFrechet, type_v_43> AgradCdfLogFrechet_v_43;
+typedef std::tuple<AgradCdfLogFrechet, type_v_44> AgradCdfLogFrechet_v_44;
+typedef std::tuple<AgradCdfLogFrechet, type_v_45> AgradCdfLogFrechet_v_45;
+typedef std::tuple<AgradCdfLogFrechet, type_v_46> AgradCdfLogFrechet_v_46;
+typedef std::tuple<AgradCdfLogFrechet, type_v_47> AgradCdfLogFrechet_v_47;
+typedef std::tuple<AgradCdfLogFrechet, type_v_48> AgradCdfLogFrechet_v_48;
+typedef std::tuple<AgradCdfLogFrechet, type_v_49> AgradCdfLogFrechet_v_49;
+typedef std::tuple<AgradCdfLogFrechet, type_v_50> AgradCdfLogFrechet_v_50;
+typedef std::tuple<AgradCdfLogFrechet, type_v_51> AgradCdfLogFrechet_v_51;
+typedef std::tuple<AgradCdfLogFrechet, type_v_52> AgradCdfLogFrechet_v_52;
+typedef std::tuple<AgradCdfLogFrechet, type_v_53> AgradCdfLogFrechet_v_53;
+typedef std::tuple<AgradCdfLogFrechet, type_v_54> AgradCdfLogFrechet_v_54;
+typedef std::tuple<AgradCdfLogFrechet, type_v_55> AgradCdfLogFrechet_v_55;
+typedef std::tuple<AgradCdfLogFrechet, type_v_56> AgradCdfLogFrechet_v_56;
+typedef std::tuple<AgradCdfLogFrechet, type_v_57> AgradCdfLogFrechet_v_57;
+typedef std::tuple<AgradCdfLogFrechet, type_v_58> AgradCdfLogFrechet_v_58;
+typedef std::tuple<AgradCdfLogFrechet, type_v_59> AgradCdfLogFrechet_v_59;
+typedef std::tuple<AgradCdfLogFrechet, type_v_60> AgradCdfLogFrechet_v_60;
+typedef std::tuple<AgradCdfLogFrechet, type_v_61> AgradCdfLogFrechet_v_61;
+typedef std::tuple<AgradCdfLogFrechet, type_v_62> AgradCdfLogFrechet_v_62;
+typedef std::tuple<AgradCdfLogFrechet, type_v_63> AgradCdfLogFrechet_v_63;
+typedef std::tuple<AgradCdfLogFrechet, type_v_64> AgradCdfLogFrechet_v_64;
+typedef std::tuple<AgradCdfLogFrechet, type_v_65> AgradCdfLogFrechet_v_65;
+typedef std::tuple<AgradCdfLogFrechet, type_v_66> AgradCdfLogFrechet_v_66;
+typedef std::tuple<AgradCdfLogFrechet, type_v_67> AgradCdfLogFrechet_v_67;
+typedef std::tuple<AgradCdfLogFrechet, type_v_68> AgradCdfLogFrechet_v_68;
+typedef std::tuple<AgradCdfLogFrechet, type_v_69> AgradCdfLogFrechet_v_69;
+typedef std::tuple<AgradCdfLogFrechet, type_v_70> AgradCdfLogFrechet_v_70;
+typedef std::tuple<AgradCdfLogFrechet, type_v_71> AgradCdfLogFrechet_v_71;
+typedef std::tuple<AgradCdfLogFrechet, type_v_72> AgradCdfLogFrechet_v_72;
+typedef std::tuple<AgradCdfLogFrechet, type_v_73> AgradCdfLogFrechet_v_73;
+typedef std::tuple<AgradCdfLogFrechet, type_v_74> AgradCdfLogFrechet_v_74;
+typedef std::tuple<AgradCdfLogFrechet, type_v_75> AgradCdfLogFrechet_v_75;
+typedef std::tuple<AgradCdfLogFrechet, type_v_76> AgradCdfLogFrechet_v_76;
+typedef std::tuple<AgradCdfLogFrechet, type_v_77> AgradCdfLogFrechet_v_77;
+typedef std::tuple<AgradCdfLogFrechet, type_v_78> AgradCdfLogFrechet_v_78;
+typedef std::tuple<AgradCdfLogFrechet, type_v_79> AgradCdfLogFrechet_v_79;
+typedef std::tuple<AgradCdfLogFrechet, type_v_80> AgradCdfLogFrechet_v_80;
+typedef std::tuple<AgradCdfLogFrechet, type_v_81> AgradCdfLogFrechet_v_81;
+typedef std::tuple<AgradCdfLogFrechet, type_v_82> AgradCdfLogFrechet_v_82;
+typedef std::tuple<AgradCdfLogFrechet, type_v_83> AgradCdfLogFrechet_v_83;
+typedef std::tuple<AgradCdfLogFrechet, type_v_84> AgradCdfLogFrechet_v_84;
+typedef std::tuple<AgradCdfLogFrechet, type_v_85> AgradCdfLogFrechet_v_85;
+typedef std::tuple<AgradCdfLogFrechet, type_v_86> AgradCdfLogFrechet_v_86;
+typedef std::tuple<AgradCdfLogFrechet, type_v_87> AgradCdfLogFrechet_v_87;
+typedef std::tuple<AgradCdfLogFrechet, type_v_88> AgradCdfLogFrechet_v_88;
+typedef std::tuple<AgradCdfLogFrechet, type_v_89> AgradCdfLogFrechet_v_89;
+typedef std::tuple<AgradCdfLogFrechet, type_v_90> AgradCdfLogFrechet_v_90;
+typedef std::tuple<AgradCdfLogFrechet, type_v_91> AgradCdfLogFrechet_v_91;
+typedef std::tuple<AgradCdfLogFrechet, type_v_92> AgradCdfLogFrechet_v_92;
+typedef std::tuple<AgradCdfLogFrechet, type_v_93> AgradCdfLogFrechet_v_93;
+typedef std::tuple<AgradCdfLogFrechet, type_v_94> AgradCdfLogFrechet_v_94;
+typedef std::tuple<AgradCdfLogFrechet, type_v_95> AgradCdfLogFrechet_v_95;
+typedef std::tuple<AgradCdfLogFrechet, type_v_96> AgradCdfLogFrechet_v_96;
+typedef std::tuple<AgradCdfLogFrechet, type_v_97> AgradCdfLogFrechet_v_97;
+typedef std::tuple<AgradCdfLogFrechet, type_v_98> AgradCdfLogFrechet_v_98;
+typedef std::tuple<AgradCdfLogFrechet, type_v_99> AgradCdfLogFrechet_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_0, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_1, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_2, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_3, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_4, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_5, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_6, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_7, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_8, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_9, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_10, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_11, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_12, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_13, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_14, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_15, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_16, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_17, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_18, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_19, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_20, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_21, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_22, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_23, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_24, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_25, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_26, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_27, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_28, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_29, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_30, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_31, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_32, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_33, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_34, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_35, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_36, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_37, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_38, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_39, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_40, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_41, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_42, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_43, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_44, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_45, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_46, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_47, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_48, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_49, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_50, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_51, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_52, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_53, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_54, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_55, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_56, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_57, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_58, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_59, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_60, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_61, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_62, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_63, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_64, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_65, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_66, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_67, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_68, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_69, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_70, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_71, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_72, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_73, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_74, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_75, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_76, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_77, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_78, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_79, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_80, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_81, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_82, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_83, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_84, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_85, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_86, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_87, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_88, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_89, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_90, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_91, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_92, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_93, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_94, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_95, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_96, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_97, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_98, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_99, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogFrechet, type_vv_0> AgradCdfLogFrechet_vv_0;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_1> AgradCdfLogFrechet_vv_1;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_2> AgradCdfLogFrechet_vv_2;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_3> AgradCdfLogFrechet_vv_3;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_4> AgradCdfLogFrechet_vv_4;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_5> AgradCdfLogFrechet_vv_5;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_6> AgradCdfLogFrechet_vv_6;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_7> AgradCdfLogFrechet_vv_7;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_8> AgradCdfLogFrechet_vv_8;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_9> AgradCdfLogFrechet_vv_9;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_10> AgradCdfLogFrechet_vv_10;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_11> AgradCdfLogFrechet_vv_11;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_12> AgradCdfLogFrechet_vv_12;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_13> AgradCdfLogFrechet_vv_13;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_14> AgradCdfLogFrechet_vv_14;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_15> AgradCdfLogFrechet_vv_15;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_16> AgradCdfLogFrechet_vv_16;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_17> AgradCdfLogFrechet_vv_17;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_18> AgradCdfLogFrechet_vv_18;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_19> AgradCdfLogFrechet_vv_19;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_20> AgradCdfLogFrechet_vv_20;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_21> AgradCdfLogFrechet_vv_21;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_22> AgradCdfLogFrechet_vv_22;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_23> AgradCdfLogFrechet_vv_23;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_24> AgradCdfLogFrechet_vv_24;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_25> AgradCdfLogFrechet_vv_25;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_26> AgradCdfLogFrechet_vv_26;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_27> AgradCdfLogFrechet_vv_27;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_28> AgradCdfLogFrechet_vv_28;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_29> AgradCdfLogFrechet_vv_29;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_30> AgradCdfLogFrechet_vv_30;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_31> AgradCdfLogFrechet_vv_31;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_32> AgradCdfLogFrechet_vv_32;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_33> AgradCdfLogFrechet_vv_33;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_34> AgradCdfLogFrechet_vv_34;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_35> AgradCdfLogFrechet_vv_35;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_36> AgradCdfLogFrechet_vv_36;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_37> AgradCdfLogFrechet_vv_37;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_38> AgradCdfLogFrechet_vv_38;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_39> AgradCdfLogFrechet_vv_39;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_40> AgradCdfLogFrechet_vv_40;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_41> AgradCdfLogFrechet_vv_41;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_42> AgradCdfLogFrechet_vv_42;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_43> AgradCdfLogFrechet_vv_43;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_44> AgradCdfLogFrechet_vv_44;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_45> AgradCdfLogFrechet_vv_45;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_46> AgradCdfLogFrechet_vv_46;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_47> AgradCdfLogFrechet_vv_47;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_48> AgradCdfLogFrechet_vv_48;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_49> AgradCdfLogFrechet_vv_49;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_50> AgradCdfLogFrechet_vv_50;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_51> AgradCdfLogFrechet_vv_51;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_52> AgradCdfLogFrechet_vv_52;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_53> AgradCdfLogFrechet_vv_53;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_54> AgradCdfLogFrechet_vv_54;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_55> AgradCdfLogFrechet_vv_55;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_56> AgradCdfLogFrechet_vv_56;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_57> AgradCdfLogFrechet_vv_57;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_58> AgradCdfLogFrechet_vv_58;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_59> AgradCdfLogFrechet_vv_59;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_60> AgradCdfLogFrechet_vv_60;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_61> AgradCdfLogFrechet_vv_61;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_62> AgradCdfLogFrechet_vv_62;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_63> AgradCdfLogFrechet_vv_63;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_64> AgradCdfLogFrechet_vv_64;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_65> AgradCdfLogFrechet_vv_65;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_66> AgradCdfLogFrechet_vv_66;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_67> AgradCdfLogFrechet_vv_67;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_68> AgradCdfLogFrechet_vv_68;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_69> AgradCdfLogFrechet_vv_69;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_70> AgradCdfLogFrechet_vv_70;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_71> AgradCdfLogFrechet_vv_71;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_72> AgradCdfLogFrechet_vv_72;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_73> AgradCdfLogFrechet_vv_73;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_74> AgradCdfLogFrechet_vv_74;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_75> AgradCdfLogFrechet_vv_75;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_76> AgradCdfLogFrechet_vv_76;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_77> AgradCdfLogFrechet_vv_77;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_78> AgradCdfLogFrechet_vv_78;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_79> AgradCdfLogFrechet_vv_79;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_80> AgradCdfLogFrechet_vv_80;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_81> AgradCdfLogFrechet_vv_81;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_82> AgradCdfLogFrechet_vv_82;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_83> AgradCdfLogFrechet_vv_83;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_84> AgradCdfLogFrechet_vv_84;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_85> AgradCdfLogFrechet_vv_85;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_86> AgradCdfLogFrechet_vv_86;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_87> AgradCdfLogFrechet_vv_87;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_88> AgradCdfLogFrechet_vv_88;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_89> AgradCdfLogFrechet_vv_89;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_90> AgradCdfLogFrechet_vv_90;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_91> AgradCdfLogFrechet_vv_91;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_92> AgradCdfLogFrechet_vv_92;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_93> AgradCdfLogFrechet_vv_93;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_94> AgradCdfLogFrechet_vv_94;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_95> AgradCdfLogFrechet_vv_95;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_96> AgradCdfLogFrechet_vv_96;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_97> AgradCdfLogFrechet_vv_97;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_98> AgradCdfLogFrechet_vv_98;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_99> AgradCdfLogFrechet_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_0, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_1, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_2, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_3, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_4, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_5, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_6, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_7, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_8, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_9, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_10, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_11, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_12, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_13, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_14, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_15, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_16, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_17, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_18, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_19, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_20, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_21, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_22, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_23, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_24, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_25, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_26, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_27, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_28, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_29, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_30, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_31, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_32, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_33, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_34, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_35, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_36, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_37, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_38, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_39, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_40, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_41, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_42, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_43, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_44, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_45, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_46, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_47, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_48, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_49, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_50, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_51, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_52, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_53, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_54, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_55, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_56, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_57, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_58, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_59, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_60, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_61, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_62, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_63, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_64, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_65, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_66, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_67, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_68, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_69, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_70, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_71, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_72, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_73, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_74, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_75, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_76, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_77, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_78, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_79, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_80, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_81, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_82, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_83, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_84, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_85, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_86, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_87, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_88, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_89, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_90, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_91, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_92, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_93, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_94, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_95, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_96, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_97, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_98, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_99, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_100> AgradCdfLogFrechet_ffv_100;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_101> AgradCdfLogFrechet_ffv_101;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_102> AgradCdfLogFrechet_ffv_102;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_103> AgradCdfLogFrechet_ffv_103;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_104> AgradCdfLogFrechet_ffv_104;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_105> AgradCdfLogFrechet_ffv_105;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_106> AgradCdfLogFrechet_ffv_106;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_107> AgradCdfLogFrechet_ffv_107;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_108> AgradCdfLogFrechet_ffv_108;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_109> AgradCdfLogFrechet_ffv_109;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_110> AgradCdfLogFrechet_ffv_110;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_111> AgradCdfLogFrechet_ffv_111;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_112> AgradCdfLogFrechet_ffv_112;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_113> AgradCdfLogFrechet_ffv_113;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_114> AgradCdfLogFrechet_ffv_114;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_115> AgradCdfLogFrechet_ffv_115;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_116> AgradCdfLogFrechet_ffv_116;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_117> AgradCdfLogFrechet_ffv_117;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_118> AgradCdfLogFrechet_ffv_118;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_119> AgradCdfLogFrechet_ffv_119;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_120> AgradCdfLogFrechet_ffv_120;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_121> AgradCdfLogFrechet_ffv_121;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_122> AgradCdfLogFrechet_ffv_122;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_123> AgradCdfLogFrechet_ffv_123;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_124> AgradCdfLogFrechet_ffv_124;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_125> AgradCdfLogFrechet_ffv_125;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_126> AgradCdfLogFrechet_ffv_126;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_127> AgradCdfLogFrechet_ffv_127;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_128> AgradCdfLogFrechet_ffv_128;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_129> AgradCdfLogFrechet_ffv_129;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_130> AgradCdfLogFrechet_ffv_130;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_131> AgradCdfLogFrechet_ffv_131;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_132> AgradCdfLogFrechet_ffv_132;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_133> AgradCdfLogFrechet_ffv_133;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_134> AgradCdfLogFrechet_ffv_134;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_135> AgradCdfLogFrechet_ffv_135;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_136> AgradCdfLogFrechet_ffv_136;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_137> AgradCdfLogFrechet_ffv_137;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_138> AgradCdfLogFrechet_ffv_138;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_139> AgradCdfLogFrechet_ffv_139;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_140> AgradCdfLogFrechet_ffv_140;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_141> AgradCdfLogFrechet_ffv_141;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_142> AgradCdfLogFrechet_ffv_142;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_143> AgradCdfLogFrechet_ffv_143;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_144> AgradCdfLogFrechet_ffv_144;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_145> AgradCdfLogFrechet_ffv_145;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_146> AgradCdfLogFrechet_ffv_146;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_147> AgradCdfLogFrechet_ffv_147;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_148> AgradCdfLogFrechet_ffv_148;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_149> AgradCdfLogFrechet_ffv_149;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_150> AgradCdfLogFrechet_ffv_150;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_151> AgradCdfLogFrechet_ffv_151;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_152> AgradCdfLogFrechet_ffv_152;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_153> AgradCdfLogFrechet_ffv_153;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_154> AgradCdfLogFrechet_ffv_154;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_155> AgradCdfLogFrechet_ffv_155;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_156> AgradCdfLogFrechet_ffv_156;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_157> AgradCdfLogFrechet_ffv_157;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_158> AgradCdfLogFrechet_ffv_158;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_159> AgradCdfLogFrechet_ffv_159;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_160> AgradCdfLogFrechet_ffv_160;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_161> AgradCdfLogFrechet_ffv_161;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_162> AgradCdfLogFrechet_ffv_162;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_163> AgradCdfLogFrechet_ffv_163;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_164> AgradCdfLogFrechet_ffv_164;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_165> AgradCdfLogFrechet_ffv_165;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_166> AgradCdfLogFrechet_ffv_166;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_167> AgradCdfLogFrechet_ffv_167;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_168> AgradCdfLogFrechet_ffv_168;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_169> AgradCdfLogFrechet_ffv_169;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_170> AgradCdfLogFrechet_ffv_170;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_171> AgradCdfLogFrechet_ffv_171;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_172> AgradCdfLogFrechet_ffv_172;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_173> AgradCdfLogFrechet_ffv_173;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_174> AgradCdfLogFrechet_ffv_174;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_175> AgradCdfLogFrechet_ffv_175;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_176> AgradCdfLogFrechet_ffv_176;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_177> AgradCdfLogFrechet_ffv_177;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_178> AgradCdfLogFrechet_ffv_178;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_179> AgradCdfLogFrechet_ffv_179;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_180> AgradCdfLogFrechet_ffv_180;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_181> AgradCdfLogFrechet_ffv_181;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_182> AgradCdfLogFrechet_ffv_182;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_183> AgradCdfLogFrechet_ffv_183;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_184> AgradCdfLogFrechet_ffv_184;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_185> AgradCdfLogFrechet_ffv_185;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_186> AgradCdfLogFrechet_ffv_186;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_187> AgradCdfLogFrechet_ffv_187;
+typedef std::tuple<AgradCdfLogFrechet, type_ffv_188> AgradCdfLogFrechet_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_100, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_101, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_102, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_103, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_104, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_105, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_106, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_107, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_108, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_109, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_110, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_111, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_112, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_113, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_114, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_115, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_116, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_117, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_118, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_119, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_120, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_121, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_122, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_123, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_124, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_125, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_126, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_127, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_128, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_129, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_130, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_131, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_132, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_133, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_134, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_135, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_136, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_137, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_138, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_139, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_140, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_141, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_142, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_143, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_144, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_145, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_146, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_147, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_148, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_149, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_150, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_151, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_152, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_153, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_154, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_155, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_156, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_157, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_158, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_159, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_160, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_161, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_162, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_163, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_164, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_165, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_166, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_167, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_168, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_169, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_170, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_171, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_172, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_173, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_174, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_175, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_176, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_177, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_178, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_179, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_180, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_181, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_182, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_183, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_184, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_185, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_186, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_187, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_ffv_188, AgradCdfLogTestFixture, AgradCdfLogFrechet_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogFrechet, type_v_100> AgradCdfLogFrechet_v_100;
+typedef std::tuple<AgradCdfLogFrechet, type_v_101> AgradCdfLogFrechet_v_101;
+typedef std::tuple<AgradCdfLogFrechet, type_v_102> AgradCdfLogFrechet_v_102;
+typedef std::tuple<AgradCdfLogFrechet, type_v_103> AgradCdfLogFrechet_v_103;
+typedef std::tuple<AgradCdfLogFrechet, type_v_104> AgradCdfLogFrechet_v_104;
+typedef std::tuple<AgradCdfLogFrechet, type_v_105> AgradCdfLogFrechet_v_105;
+typedef std::tuple<AgradCdfLogFrechet, type_v_106> AgradCdfLogFrechet_v_106;
+typedef std::tuple<AgradCdfLogFrechet, type_v_107> AgradCdfLogFrechet_v_107;
+typedef std::tuple<AgradCdfLogFrechet, type_v_108> AgradCdfLogFrechet_v_108;
+typedef std::tuple<AgradCdfLogFrechet, type_v_109> AgradCdfLogFrechet_v_109;
+typedef std::tuple<AgradCdfLogFrechet, type_v_110> AgradCdfLogFrechet_v_110;
+typedef std::tuple<AgradCdfLogFrechet, type_v_111> AgradCdfLogFrechet_v_111;
+typedef std::tuple<AgradCdfLogFrechet, type_v_112> AgradCdfLogFrechet_v_112;
+typedef std::tuple<AgradCdfLogFrechet, type_v_113> AgradCdfLogFrechet_v_113;
+typedef std::tuple<AgradCdfLogFrechet, type_v_114> AgradCdfLogFrechet_v_114;
+typedef std::tuple<AgradCdfLogFrechet, type_v_115> AgradCdfLogFrechet_v_115;
+typedef std::tuple<AgradCdfLogFrechet, type_v_116> AgradCdfLogFrechet_v_116;
+typedef std::tuple<AgradCdfLogFrechet, type_v_117> AgradCdfLogFrechet_v_117;
+typedef std::tuple<AgradCdfLogFrechet, type_v_118> AgradCdfLogFrechet_v_118;
+typedef std::tuple<AgradCdfLogFrechet, type_v_119> AgradCdfLogFrechet_v_119;
+typedef std::tuple<AgradCdfLogFrechet, type_v_120> AgradCdfLogFrechet_v_120;
+typedef std::tuple<AgradCdfLogFrechet, type_v_121> AgradCdfLogFrechet_v_121;
+typedef std::tuple<AgradCdfLogFrechet, type_v_122> AgradCdfLogFrechet_v_122;
+typedef std::tuple<AgradCdfLogFrechet, type_v_123> AgradCdfLogFrechet_v_123;
+typedef std::tuple<AgradCdfLogFrechet, type_v_124> AgradCdfLogFrechet_v_124;
+typedef std::tuple<AgradCdfLogFrechet, type_v_125> AgradCdfLogFrechet_v_125;
+typedef std::tuple<AgradCdfLogFrechet, type_v_126> AgradCdfLogFrechet_v_126;
+typedef std::tuple<AgradCdfLogFrechet, type_v_127> AgradCdfLogFrechet_v_127;
+typedef std::tuple<AgradCdfLogFrechet, type_v_128> AgradCdfLogFrechet_v_128;
+typedef std::tuple<AgradCdfLogFrechet, type_v_129> AgradCdfLogFrechet_v_129;
+typedef std::tuple<AgradCdfLogFrechet, type_v_130> AgradCdfLogFrechet_v_130;
+typedef std::tuple<AgradCdfLogFrechet, type_v_131> AgradCdfLogFrechet_v_131;
+typedef std::tuple<AgradCdfLogFrechet, type_v_132> AgradCdfLogFrechet_v_132;
+typedef std::tuple<AgradCdfLogFrechet, type_v_133> AgradCdfLogFrechet_v_133;
+typedef std::tuple<AgradCdfLogFrechet, type_v_134> AgradCdfLogFrechet_v_134;
+typedef std::tuple<AgradCdfLogFrechet, type_v_135> AgradCdfLogFrechet_v_135;
+typedef std::tuple<AgradCdfLogFrechet, type_v_136> AgradCdfLogFrechet_v_136;
+typedef std::tuple<AgradCdfLogFrechet, type_v_137> AgradCdfLogFrechet_v_137;
+typedef std::tuple<AgradCdfLogFrechet, type_v_138> AgradCdfLogFrechet_v_138;
+typedef std::tuple<AgradCdfLogFrechet, type_v_139> AgradCdfLogFrechet_v_139;
+typedef std::tuple<AgradCdfLogFrechet, type_v_140> AgradCdfLogFrechet_v_140;
+typedef std::tuple<AgradCdfLogFrechet, type_v_141> AgradCdfLogFrechet_v_141;
+typedef std::tuple<AgradCdfLogFrechet, type_v_142> AgradCdfLogFrechet_v_142;
+typedef std::tuple<AgradCdfLogFrechet, type_v_143> AgradCdfLogFrechet_v_143;
+typedef std::tuple<AgradCdfLogFrechet, type_v_144> AgradCdfLogFrechet_v_144;
+typedef std::tuple<AgradCdfLogFrechet, type_v_145> AgradCdfLogFrechet_v_145;
+typedef std::tuple<AgradCdfLogFrechet, type_v_146> AgradCdfLogFrechet_v_146;
+typedef std::tuple<AgradCdfLogFrechet, type_v_147> AgradCdfLogFrechet_v_147;
+typedef std::tuple<AgradCdfLogFrechet, type_v_148> AgradCdfLogFrechet_v_148;
+typedef std::tuple<AgradCdfLogFrechet, type_v_149> AgradCdfLogFrechet_v_149;
+typedef std::tuple<AgradCdfLogFrechet, type_v_150> AgradCdfLogFrechet_v_150;
+typedef std::tuple<AgradCdfLogFrechet, type_v_151> AgradCdfLogFrechet_v_151;
+typedef std::tuple<AgradCdfLogFrechet, type_v_152> AgradCdfLogFrechet_v_152;
+typedef std::tuple<AgradCdfLogFrechet, type_v_153> AgradCdfLogFrechet_v_153;
+typedef std::tuple<AgradCdfLogFrechet, type_v_154> AgradCdfLogFrechet_v_154;
+typedef std::tuple<AgradCdfLogFrechet, type_v_155> AgradCdfLogFrechet_v_155;
+typedef std::tuple<AgradCdfLogFrechet, type_v_156> AgradCdfLogFrechet_v_156;
+typedef std::tuple<AgradCdfLogFrechet, type_v_157> AgradCdfLogFrechet_v_157;
+typedef std::tuple<AgradCdfLogFrechet, type_v_158> AgradCdfLogFrechet_v_158;
+typedef std::tuple<AgradCdfLogFrechet, type_v_159> AgradCdfLogFrechet_v_159;
+typedef std::tuple<AgradCdfLogFrechet, type_v_160> AgradCdfLogFrechet_v_160;
+typedef std::tuple<AgradCdfLogFrechet, type_v_161> AgradCdfLogFrechet_v_161;
+typedef std::tuple<AgradCdfLogFrechet, type_v_162> AgradCdfLogFrechet_v_162;
+typedef std::tuple<AgradCdfLogFrechet, type_v_163> AgradCdfLogFrechet_v_163;
+typedef std::tuple<AgradCdfLogFrechet, type_v_164> AgradCdfLogFrechet_v_164;
+typedef std::tuple<AgradCdfLogFrechet, type_v_165> AgradCdfLogFrechet_v_165;
+typedef std::tuple<AgradCdfLogFrechet, type_v_166> AgradCdfLogFrechet_v_166;
+typedef std::tuple<AgradCdfLogFrechet, type_v_167> AgradCdfLogFrechet_v_167;
+typedef std::tuple<AgradCdfLogFrechet, type_v_168> AgradCdfLogFrechet_v_168;
+typedef std::tuple<AgradCdfLogFrechet, type_v_169> AgradCdfLogFrechet_v_169;
+typedef std::tuple<AgradCdfLogFrechet, type_v_170> AgradCdfLogFrechet_v_170;
+typedef std::tuple<AgradCdfLogFrechet, type_v_171> AgradCdfLogFrechet_v_171;
+typedef std::tuple<AgradCdfLogFrechet, type_v_172> AgradCdfLogFrechet_v_172;
+typedef std::tuple<AgradCdfLogFrechet, type_v_173> AgradCdfLogFrechet_v_173;
+typedef std::tuple<AgradCdfLogFrechet, type_v_174> AgradCdfLogFrechet_v_174;
+typedef std::tuple<AgradCdfLogFrechet, type_v_175> AgradCdfLogFrechet_v_175;
+typedef std::tuple<AgradCdfLogFrechet, type_v_176> AgradCdfLogFrechet_v_176;
+typedef std::tuple<AgradCdfLogFrechet, type_v_177> AgradCdfLogFrechet_v_177;
+typedef std::tuple<AgradCdfLogFrechet, type_v_178> AgradCdfLogFrechet_v_178;
+typedef std::tuple<AgradCdfLogFrechet, type_v_179> AgradCdfLogFrechet_v_179;
+typedef std::tuple<AgradCdfLogFrechet, type_v_180> AgradCdfLogFrechet_v_180;
+typedef std::tuple<AgradCdfLogFrechet, type_v_181> AgradCdfLogFrechet_v_181;
+typedef std::tuple<AgradCdfLogFrechet, type_v_182> AgradCdfLogFrechet_v_182;
+typedef std::tuple<AgradCdfLogFrechet, type_v_183> AgradCdfLogFrechet_v_183;
+typedef std::tuple<AgradCdfLogFrechet, type_v_184> AgradCdfLogFrechet_v_184;
+typedef std::tuple<AgradCdfLogFrechet, type_v_185> AgradCdfLogFrechet_v_185;
+typedef std::tuple<AgradCdfLogFrechet, type_v_186> AgradCdfLogFrechet_v_186;
+typedef std::tuple<AgradCdfLogFrechet, type_v_187> AgradCdfLogFrechet_v_187;
+typedef std::tuple<AgradCdfLogFrechet, type_v_188> AgradCdfLogFrechet_v_188;
+typedef std::tuple<AgradCdfLogFrechet, type_v_189> AgradCdfLogFrechet_v_189;
+typedef std::tuple<AgradCdfLogFrechet, type_v_190> AgradCdfLogFrechet_v_190;
+typedef std::tuple<AgradCdfLogFrechet, type_v_191> AgradCdfLogFrechet_v_191;
+typedef std::tuple<AgradCdfLogFrechet, type_v_192> AgradCdfLogFrechet_v_192;
+typedef std::tuple<AgradCdfLogFrechet, type_v_193> AgradCdfLogFrechet_v_193;
+typedef std::tuple<AgradCdfLogFrechet, type_v_194> AgradCdfLogFrechet_v_194;
+typedef std::tuple<AgradCdfLogFrechet, type_v_195> AgradCdfLogFrechet_v_195;
+typedef std::tuple<AgradCdfLogFrechet, type_v_196> AgradCdfLogFrechet_v_196;
+typedef std::tuple<AgradCdfLogFrechet, type_v_197> AgradCdfLogFrechet_v_197;
+typedef std::tuple<AgradCdfLogFrechet, type_v_198> AgradCdfLogFrechet_v_198;
+typedef std::tuple<AgradCdfLogFrechet, type_v_199> AgradCdfLogFrechet_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_100, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_101, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_102, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_103, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_104, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_105, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_106, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_107, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_108, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_109, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_110, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_111, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_112, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_113, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_114, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_115, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_116, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_117, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_118, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_119, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_120, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_121, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_122, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_123, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_124, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_125, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_126, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_127, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_128, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_129, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_130, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_131, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_132, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_133, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_134, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_135, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_136, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_137, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_138, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_139, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_140, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_141, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_142, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_143, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_144, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_145, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_146, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_147, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_148, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_149, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_150, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_151, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_152, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_153, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_154, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_155, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_156, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_157, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_158, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_159, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_160, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_161, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_162, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_163, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_164, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_165, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_166, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_167, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_168, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_169, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_170, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_171, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_172, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_173, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_174, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_175, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_176, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_177, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_178, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_179, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_180, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_181, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_182, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_183, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_184, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_185, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_186, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_187, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_188, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_189, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_190, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_191, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_192, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_193, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_194, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_195, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_196, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_197, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_198, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_199, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogFrechet, type_vv_100> AgradCdfLogFrechet_vv_100;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_101> AgradCdfLogFrechet_vv_101;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_102> AgradCdfLogFrechet_vv_102;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_103> AgradCdfLogFrechet_vv_103;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_104> AgradCdfLogFrechet_vv_104;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_105> AgradCdfLogFrechet_vv_105;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_106> AgradCdfLogFrechet_vv_106;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_107> AgradCdfLogFrechet_vv_107;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_108> AgradCdfLogFrechet_vv_108;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_109> AgradCdfLogFrechet_vv_109;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_110> AgradCdfLogFrechet_vv_110;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_111> AgradCdfLogFrechet_vv_111;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_112> AgradCdfLogFrechet_vv_112;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_113> AgradCdfLogFrechet_vv_113;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_114> AgradCdfLogFrechet_vv_114;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_115> AgradCdfLogFrechet_vv_115;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_116> AgradCdfLogFrechet_vv_116;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_117> AgradCdfLogFrechet_vv_117;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_118> AgradCdfLogFrechet_vv_118;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_119> AgradCdfLogFrechet_vv_119;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_120> AgradCdfLogFrechet_vv_120;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_121> AgradCdfLogFrechet_vv_121;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_122> AgradCdfLogFrechet_vv_122;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_123> AgradCdfLogFrechet_vv_123;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_124> AgradCdfLogFrechet_vv_124;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_125> AgradCdfLogFrechet_vv_125;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_126> AgradCdfLogFrechet_vv_126;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_127> AgradCdfLogFrechet_vv_127;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_128> AgradCdfLogFrechet_vv_128;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_129> AgradCdfLogFrechet_vv_129;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_130> AgradCdfLogFrechet_vv_130;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_131> AgradCdfLogFrechet_vv_131;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_132> AgradCdfLogFrechet_vv_132;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_133> AgradCdfLogFrechet_vv_133;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_134> AgradCdfLogFrechet_vv_134;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_135> AgradCdfLogFrechet_vv_135;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_136> AgradCdfLogFrechet_vv_136;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_137> AgradCdfLogFrechet_vv_137;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_138> AgradCdfLogFrechet_vv_138;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_139> AgradCdfLogFrechet_vv_139;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_140> AgradCdfLogFrechet_vv_140;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_141> AgradCdfLogFrechet_vv_141;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_142> AgradCdfLogFrechet_vv_142;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_143> AgradCdfLogFrechet_vv_143;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_144> AgradCdfLogFrechet_vv_144;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_145> AgradCdfLogFrechet_vv_145;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_146> AgradCdfLogFrechet_vv_146;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_147> AgradCdfLogFrechet_vv_147;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_148> AgradCdfLogFrechet_vv_148;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_149> AgradCdfLogFrechet_vv_149;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_150> AgradCdfLogFrechet_vv_150;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_151> AgradCdfLogFrechet_vv_151;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_152> AgradCdfLogFrechet_vv_152;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_153> AgradCdfLogFrechet_vv_153;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_154> AgradCdfLogFrechet_vv_154;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_155> AgradCdfLogFrechet_vv_155;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_156> AgradCdfLogFrechet_vv_156;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_157> AgradCdfLogFrechet_vv_157;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_158> AgradCdfLogFrechet_vv_158;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_159> AgradCdfLogFrechet_vv_159;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_160> AgradCdfLogFrechet_vv_160;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_161> AgradCdfLogFrechet_vv_161;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_162> AgradCdfLogFrechet_vv_162;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_163> AgradCdfLogFrechet_vv_163;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_164> AgradCdfLogFrechet_vv_164;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_165> AgradCdfLogFrechet_vv_165;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_166> AgradCdfLogFrechet_vv_166;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_167> AgradCdfLogFrechet_vv_167;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_168> AgradCdfLogFrechet_vv_168;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_169> AgradCdfLogFrechet_vv_169;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_170> AgradCdfLogFrechet_vv_170;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_171> AgradCdfLogFrechet_vv_171;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_172> AgradCdfLogFrechet_vv_172;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_173> AgradCdfLogFrechet_vv_173;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_174> AgradCdfLogFrechet_vv_174;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_175> AgradCdfLogFrechet_vv_175;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_176> AgradCdfLogFrechet_vv_176;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_177> AgradCdfLogFrechet_vv_177;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_178> AgradCdfLogFrechet_vv_178;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_179> AgradCdfLogFrechet_vv_179;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_180> AgradCdfLogFrechet_vv_180;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_181> AgradCdfLogFrechet_vv_181;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_182> AgradCdfLogFrechet_vv_182;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_183> AgradCdfLogFrechet_vv_183;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_184> AgradCdfLogFrechet_vv_184;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_185> AgradCdfLogFrechet_vv_185;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_186> AgradCdfLogFrechet_vv_186;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_187> AgradCdfLogFrechet_vv_187;
+typedef std::tuple<AgradCdfLogFrechet, type_vv_188> AgradCdfLogFrechet_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_100, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_101, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_102, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_103, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_104, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_105, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_106, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_107, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_108, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_109, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_110, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_111, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_112, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_113, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_114, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_115, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_116, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_117, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_118, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_119, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_120, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_121, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_122, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_123, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_124, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_125, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_126, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_127, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_128, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_129, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_130, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_131, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_132, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_133, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_134, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_135, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_136, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_137, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_138, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_139, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_140, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_141, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_142, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_143, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_144, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_145, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_146, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_147, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_148, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_149, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_150, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_151, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_152, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_153, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_154, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_155, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_156, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_157, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_158, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_159, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_160, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_161, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_162, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_163, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_164, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_165, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_166, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_167, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_168, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_169, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_170, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_171, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_172, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_173, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_174, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_175, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_176, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_177, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_178, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_179, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_180, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_181, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_182, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_183, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_184, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_185, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_186, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_187, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_vv_188, AgradCdfLogTestFixture, AgradCdfLogFrechet_vv_188);
+
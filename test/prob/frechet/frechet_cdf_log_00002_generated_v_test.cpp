@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/frechet/frechet_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCdfLogFrechet, type_v_200> AgradCdfLogFrechet_v_200;
+typedef std::tuple<AgradCdfLogFrechet, type_v_201> AgradCdfLogFrechet_v_201;
+typedef std::tuple<AgradCdfLogFrechet, type_v_202> AgradCdfLogFrechet_v_202;
+typedef std::tuple<AgradCdfLogFrechet, type_v_203> AgradCdfLogFrechet_v_203;
+typedef std::tuple<AgradCdfLogFrechet, type_v_204> AgradCdfLogFrechet_v_204;
+typedef std::tuple<AgradCdfLogFrechet, type_v_205> AgradCdfLogFrechet_v_205;
+typedef std::tuple<AgradCdfLogFrechet, type_v_206> AgradCdfLogFrechet_v_206;
+typedef std::tuple<AgradCdfLogFrechet, type_v_207> AgradCdfLogFrechet_v_207;
+typedef std::tuple<AgradCdfLogFrechet, type_v_208> AgradCdfLogFrechet_v_208;
+typedef std::tuple<AgradCdfLogFrechet, type_v_209> AgradCdfLogFrechet_v_209;
+typedef std::tuple<AgradCdfLogFrechet, type_v_210> AgradCdfLogFrechet_v_210;
+typedef std::tuple<AgradCdfLogFrechet, type_v_211> AgradCdfLogFrechet_v_211;
+typedef std::tuple<AgradCdfLogFrechet, type_v_212> AgradCdfLogFrechet_v_212;
+typedef std::tuple<AgradCdfLogFrechet, type_v_213> AgradCdfLogFrechet_v_213;
+typedef std::tuple<AgradCdfLogFrechet, type_v_214> AgradCdfLogFrechet_v_214;
+typedef std::tuple<AgradCdfLogFrechet, type_v_215> AgradCdfLogFrechet_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_200, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_201, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_202, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_203, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_204, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_205, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_206, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_207, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_208, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_209, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_210, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_211, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_212, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_213, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_214, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogFrechet_v_215, AgradCdfLogTestFixture, AgradCdfLogFrechet_v_215);
+
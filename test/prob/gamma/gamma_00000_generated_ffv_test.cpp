@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsGamma, type_ffv_0> AgradDistributionsGamma_ffv_0;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_1> AgradDistributionsGamma_ffv_1;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_2> AgradDistributionsGamma_ffv_2;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_3> AgradDistributionsGamma_ffv_3;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_4> AgradDistributionsGamma_ffv_4;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_5> AgradDistributionsGamma_ffv_5;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_6> AgradDistributionsGamma_ffv_6;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_7> AgradDistributionsGamma_ffv_7;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_8> AgradDistributionsGamma_ffv_8;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_9> AgradDistributionsGamma_ffv_9;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_10> AgradDistributionsGamma_ffv_10;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_11> AgradDistributionsGamma_ffv_11;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_12> AgradDistributionsGamma_ffv_12;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_13> AgradDistributionsGamma_ffv_13;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_14> AgradDistributionsGamma_ffv_14;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_15> AgradDistributionsGamma_ffv_15;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_16> AgradDistributionsGamma_ffv_16;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_17> AgradDistributionsGamma_ffv_17;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_18> AgradDistributionsGamma_ffv_18;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_19> AgradDistributionsGamma_ffv_19;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_20> AgradDistributionsGamma_ffv_20;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_21> AgradDistributionsGamma_ffv_21;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_22> AgradDistributionsGamma_ffv_22;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_23> AgradDistributionsGamma_ffv_23;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_24> AgradDistributionsGamma_ffv_24;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_25> AgradDistributionsGamma_ffv_25;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_26> AgradDistributionsGamma_ffv_26;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_27> AgradDistributionsGamma_ffv_27;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_28> AgradDistributionsGamma_ffv_28;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_29> AgradDistributionsGamma_ffv_29;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_30> AgradDistributionsGamma_ffv_30;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_31> AgradDistributionsGamma_ffv_31;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_32> AgradDistributionsGamma_ffv_32;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_33> AgradDistributionsGamma_ffv_33;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_34> AgradDistributionsGamma_ffv_34;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_35> AgradDistributionsGamma_ffv_35;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_36> AgradDistributionsGamma_ffv_36;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_37> AgradDistributionsGamma_ffv_37;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_38> AgradDistributionsGamma_ffv_38;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_39> AgradDistributionsGamma_ffv_39;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_40> AgradDistributionsGamma_ffv_40;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_41> AgradDistributionsGamma_ffv_41;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_42> AgradDistributionsGamma_ffv_42;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_43> AgradDistributionsGamma_ffv_43;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_44> AgradDistributionsGamma_ffv_44;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_45> AgradDistributionsGamma_ffv_45;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_46> AgradDistributionsGamma_ffv_46;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_47> AgradDistributionsGamma_ffv_47;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_48> AgradDistributionsGamma_ffv_48;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_49> AgradDistributionsGamma_ffv_49;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_50> AgradDistributionsGamma_ffv_50;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_51> AgradDistributionsGamma_ffv_51;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_52> AgradDistributionsGamma_ffv_52;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_53> AgradDistributionsGamma_ffv_53;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_54> AgradDistributionsGamma_ffv_54;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_55> AgradDistributionsGamma_ffv_55;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_56> AgradDistributionsGamma_ffv_56;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_57> AgradDistributionsGamma_ffv_57;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_58> AgradDistributionsGamma_ffv_58;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_59> AgradDistributionsGamma_ffv_59;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_60> AgradDistributionsGamma_ffv_60;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_61> AgradDistributionsGamma_ffv_61;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_62> AgradDistributionsGamma_ffv_62;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_63> AgradDistributionsGamma_ffv_63;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_64> AgradDistributionsGamma_ffv_64;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_65> AgradDistributionsGamma_ffv_65;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_66> AgradDistributionsGamma_ffv_66;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_67> AgradDistributionsGamma_ffv_67;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_68> AgradDistributionsGamma_ffv_68;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_69> AgradDistributionsGamma_ffv_69;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_70> AgradDistributionsGamma_ffv_70;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_71> AgradDistributionsGamma_ffv_71;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_72> AgradDistributionsGamma_ffv_72;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_73> AgradDistributionsGamma_ffv_73;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_74> AgradDistributionsGamma_ffv_74;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_75> AgradDistributionsGamma_ffv_75;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_76> AgradDistributionsGamma_ffv_76;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_77> AgradDistributionsGamma_ffv_77;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_78> AgradDistributionsGamma_ffv_78;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_79> AgradDistributionsGamma_ffv_79;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_80> AgradDistributionsGamma_ffv_80;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_81> AgradDistributionsGamma_ffv_81;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_82> AgradDistributionsGamma_ffv_82;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_83> AgradDistributionsGamma_ffv_83;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_84> AgradDistributionsGamma_ffv_84;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_85> AgradDistributionsGamma_ffv_85;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_86> AgradDistributionsGamma_ffv_86;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_87> AgradDistributionsGamma_ffv_87;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_88> AgradDistributionsGamma_ffv_88;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_89> AgradDistributionsGamma_ffv_89;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_90> AgradDistributionsGamma_ffv_90;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_91> AgradDistributionsGamma_ffv_91;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_92> AgradDistributionsGamma_ffv_92;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_93> AgradDistributionsGamma_ffv_93;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_94> AgradDistributionsGamma_ffv_94;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_95> AgradDistributionsGamma_ffv_95;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_96> AgradDistributionsGamma_ffv_96;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_97> AgradDistributionsGamma_ffv_97;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_98> AgradDistributionsGamma_ffv_98;
+typedef std::tuple<AgradDistributionsGamma, type_ffv_99> AgradDistributionsGamma_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_0, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_1, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_2, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_3, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_4, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_5, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_6, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_7, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_8, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_9, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_10, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_11, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_12, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_13, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_14, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_15, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_16, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_17, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_18, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_19, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_20, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_21, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_22, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_23, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_24, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_25, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_26, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_27, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_28, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_29, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_30, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_31, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_32, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_33, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_34, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_35, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_36, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_37, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_38, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_39, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_40, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_41, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_42, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_43, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_44, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_45, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_46, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_47, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_48, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_49, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_50, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_51, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_52, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_53, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_54, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_55, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_56, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_57, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_58, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_59, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_60, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_61, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_62, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_63, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_64, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_65, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_66, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_67, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_68, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_69, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_70, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_71, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_72, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_73, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_74, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_75, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_76, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_77, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_78, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_79, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_80, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_81, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_82, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_83, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_84, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_85, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_86, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_87, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_88, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_89, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_90, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_91, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_92, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_93, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_94, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_95, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_96, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_97, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_98, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_ffv_99, AgradDistributionTestFixture, AgradDistributionsGamma_ffv_99);
+
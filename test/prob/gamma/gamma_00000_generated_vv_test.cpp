@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsGamma, type_vv_0> AgradDistributionsGamma_vv_0;
+typedef std::tuple<AgradDistributionsGamma, type_vv_1> AgradDistributionsGamma_vv_1;
+typedef std::tuple<AgradDistributionsGamma, type_vv_2> AgradDistributionsGamma_vv_2;
+typedef std::tuple<AgradDistributionsGamma, type_vv_3> AgradDistributionsGamma_vv_3;
+typedef std::tuple<AgradDistributionsGamma, type_vv_4> AgradDistributionsGamma_vv_4;
+typedef std::tuple<AgradDistributionsGamma, type_vv_5> AgradDistributionsGamma_vv_5;
+typedef std::tuple<AgradDistributionsGamma, type_vv_6> AgradDistributionsGamma_vv_6;
+typedef std::tuple<AgradDistributionsGamma, type_vv_7> AgradDistributionsGamma_vv_7;
+typedef std::tuple<AgradDistributionsGamma, type_vv_8> AgradDistributionsGamma_vv_8;
+typedef std::tuple<AgradDistributionsGamma, type_vv_9> AgradDistributionsGamma_vv_9;
+typedef std::tuple<AgradDistributionsGamma, type_vv_10> AgradDistributionsGamma_vv_10;
+typedef std::tuple<AgradDistributionsGamma, type_vv_11> AgradDistributionsGamma_vv_11;
+typedef std::tuple<AgradDistributionsGamma, type_vv_12> AgradDistributionsGamma_vv_12;
+typedef std::tuple<AgradDistributionsGamma, type_vv_13> AgradDistributionsGamma_vv_13;
+typedef std::tuple<AgradDistributionsGamma, type_vv_14> AgradDistributionsGamma_vv_14;
+typedef std::tuple<AgradDistributionsGamma, type_vv_15> AgradDistributionsGamma_vv_15;
+typedef std::tuple<AgradDistributionsGamma, type_vv_16> AgradDistributionsGamma_vv_16;
+typedef std::tuple<AgradDistributionsGamma, type_vv_17> AgradDistributionsGamma_vv_17;
+typedef std::tuple<AgradDistributionsGamma, type_vv_18> AgradDistributionsGamma_vv_18;
+typedef std::tuple<AgradDistributionsGamma, type_vv_19> AgradDistributionsGamma_vv_19;
+typedef std::tuple<AgradDistributionsGamma, type_vv_20> AgradDistributionsGamma_vv_20;
+typedef std::tuple<AgradDistributionsGamma, type_vv_21> AgradDistributionsGamma_vv_21;
+typedef std::tuple<AgradDistributionsGamma, type_vv_22> AgradDistributionsGamma_vv_22;
+typedef std::tuple<AgradDistributionsGamma, type_vv_23> AgradDistributionsGamma_vv_23;
+typedef std::tuple<AgradDistributionsGamma, type_vv_24> AgradDistributionsGamma_vv_24;
+typedef std::tuple<AgradDistributionsGamma, type_vv_25> AgradDistributionsGamma_vv_25;
+typedef std::tuple<AgradDistributionsGamma, type_vv_26> AgradDistributionsGamma_vv_26;
+typedef std::tuple<AgradDistributionsGamma, type_vv_27> AgradDistributionsGamma_vv_27;
+typedef std::tuple<AgradDistributionsGamma, type_vv_28> AgradDistributionsGamma_vv_28;
+typedef std::tuple<AgradDistributionsGamma, type_vv_29> AgradDistributionsGamma_vv_29;
+typedef std::tuple<AgradDistributionsGamma, type_vv_30> AgradDistributionsGamma_vv_30;
+typedef std::tuple<AgradDistributionsGamma, type_vv_31> AgradDistributionsGamma_vv_31;
+typedef std::tuple<AgradDistributionsGamma, type_vv_32> AgradDistributionsGamma_vv_32;
+typedef std::tuple<AgradDistributionsGamma, type_vv_33> AgradDistributionsGamma_vv_33;
+typedef std::tuple<AgradDistributionsGamma, type_vv_34> AgradDistributionsGamma_vv_34;
+typedef std::tuple<AgradDistributionsGamma, type_vv_35> AgradDistributionsGamma_vv_35;
+typedef std::tuple<AgradDistributionsGamma, type_vv_36> AgradDistributionsGamma_vv_36;
+typedef std::tuple<AgradDistributionsGamma, type_vv_37> AgradDistributionsGamma_vv_37;
+typedef std::tuple<AgradDistributionsGamma, type_vv_38> AgradDistributionsGamma_vv_38;
+typedef std::tuple<AgradDistributionsGamma, type_vv_39> AgradDistributionsGamma_vv_39;
+typedef std::tuple<AgradDistributionsGamma, type_vv_40> AgradDistributionsGamma_vv_40;
+typedef std::tuple<AgradDistributionsGamma, type_vv_41> AgradDistributionsGamma_vv_41;
+typedef std::tuple<AgradDistributionsGamma, type_vv_42> AgradDistributionsGamma_vv_42;
+typedef std::tuple<AgradDistributionsGamma, type_vv_43> AgradDistributionsGamma_vv_43;
+typedef std::tuple<AgradDistributionsGamma, type_vv_44> AgradDistributionsGamma_vv_44;
+typedef std::tuple<AgradDistributionsGamma, type_vv_45> AgradDistributionsGamma_vv_45;
+typedef std::tuple<AgradDistributionsGamma, type_vv_46> AgradDistributionsGamma_vv_46;
+typedef std::tuple<AgradDistributionsGamma, type_vv_47> AgradDistributionsGamma_vv_47;
+typedef std::tuple<AgradDistributionsGamma, type_vv_48> AgradDistributionsGamma_vv_48;
+typedef std::tuple<AgradDistributionsGamma, type_vv_49> AgradDistributionsGamma_vv_49;
+typedef std::tuple<AgradDistributionsGamma, type_vv_50> AgradDistributionsGamma_vv_50;
+typedef std::tuple<AgradDistributionsGamma, type_vv_51> AgradDistributionsGamma_vv_51;
+typedef std::tuple<AgradDistributionsGamma, type_vv_52> AgradDistributionsGamma_vv_52;
+typedef std::tuple<AgradDistributionsGamma, type_vv_53> AgradDistributionsGamma_vv_53;
+typedef std::tuple<AgradDistributionsGamma, type_vv_54> AgradDistributionsGamma_vv_54;
+typedef std::tuple<AgradDistributionsGamma, type_vv_55> AgradDistributionsGamma_vv_55;
+typedef std::tuple<AgradDistributionsGamma, type_vv_56> AgradDistributionsGamma_vv_56;
+typedef std::tuple<AgradDistributionsGamma, type_vv_57> AgradDistributionsGamma_vv_57;
+typedef std::tuple<AgradDistributionsGamma, type_vv_58> AgradDistributionsGamma_vv_58;
+typedef std::tuple<AgradDistributionsGamma, type_vv_59> AgradDistributionsGamma_vv_59;
+typedef std::tuple<AgradDistributionsGamma, type_vv_60> AgradDistributionsGamma_vv_60;
+typedef std::tuple<AgradDistributionsGamma, type_vv_61> AgradDistributionsGamma_vv_61;
+typedef std::tuple<AgradDistributionsGamma, type_vv_62> AgradDistributionsGamma_vv_62;
+typedef std::tuple<AgradDistributionsGamma, type_vv_63> AgradDistributionsGamma_vv_63;
+typedef std::tuple<AgradDistributionsGamma, type_vv_64> AgradDistributionsGamma_vv_64;
+typedef std::tuple<AgradDistributionsGamma, type_vv_65> AgradDistributionsGamma_vv_65;
+typedef std::tuple<AgradDistributionsGamma, type_vv_66> AgradDistributionsGamma_vv_66;
+typedef std::tuple<AgradDistributionsGamma, type_vv_67> AgradDistributionsGamma_vv_67;
+typedef std::tuple<AgradDistributionsGamma, type_vv_68> AgradDistributionsGamma_vv_68;
+typedef std::tuple<AgradDistributionsGamma, type_vv_69> AgradDistributionsGamma_vv_69;
+typedef std::tuple<AgradDistributionsGamma, type_vv_70> AgradDistributionsGamma_vv_70;
+typedef std::tuple<AgradDistributionsGamma, type_vv_71> AgradDistributionsGamma_vv_71;
+typedef std::tuple<AgradDistributionsGamma, type_vv_72> AgradDistributionsGamma_vv_72;
+typedef std::tuple<AgradDistributionsGamma, type_vv_73> AgradDistributionsGamma_vv_73;
+typedef std::tuple<AgradDistributionsGamma, type_vv_74> AgradDistributionsGamma_vv_74;
+typedef std::tuple<AgradDistributionsGamma, type_vv_75> AgradDistributionsGamma_vv_75;
+typedef std::tuple<AgradDistributionsGamma, type_vv_76> AgradDistributionsGamma_vv_76;
+typedef std::tuple<AgradDistributionsGamma, type_vv_77> AgradDistributionsGamma_vv_77;
+typedef std::tuple<AgradDistributionsGamma, type_vv_78> AgradDistributionsGamma_vv_78;
+typedef std::tuple<AgradDistributionsGamma, type_vv_79> AgradDistributionsGamma_vv_79;
+typedef std::tuple<AgradDistributionsGamma, type_vv_80> AgradDistributionsGamma_vv_80;
+typedef std::tuple<AgradDistributionsGamma, type_vv_81> AgradDistributionsGamma_vv_81;
+typedef std::tuple<AgradDistributionsGamma, type_vv_82> AgradDistributionsGamma_vv_82;
+typedef std::tuple<AgradDistributionsGamma, type_vv_83> AgradDistributionsGamma_vv_83;
+typedef std::tuple<AgradDistributionsGamma, type_vv_84> AgradDistributionsGamma_vv_84;
+typedef std::tuple<AgradDistributionsGamma, type_vv_85> AgradDistributionsGamma_vv_85;
+typedef std::tuple<AgradDistributionsGamma, type_vv_86> AgradDistributionsGamma_vv_86;
+typedef std::tuple<AgradDistributionsGamma, type_vv_87> AgradDistributionsGamma_vv_87;
+typedef std::tuple<AgradDistributionsGamma, type_vv_88> AgradDistributionsGamma_vv_88;
+typedef std::tuple<AgradDistributionsGamma, type_vv_89> AgradDistributionsGamma_vv_89;
+typedef std::tuple<AgradDistributionsGamma, type_vv_90> AgradDistributionsGamma_vv_90;
+typedef std::tuple<AgradDistributionsGamma, type_vv_91> AgradDistributionsGamma_vv_91;
+typedef std::tuple<AgradDistributionsGamma, type_vv_92> AgradDistributionsGamma_vv_92;
+typedef std::tuple<AgradDistributionsGamma, type_vv_93> AgradDistributionsGamma_vv_93;
+typedef std::tuple<AgradDistributionsGamma, type_vv_94> AgradDistributionsGamma_vv_94;
+typedef std::tuple<AgradDistributionsGamma, type_vv_95> AgradDistributionsGamma_vv_95;
+typedef std::tuple<AgradDistributionsGamma, type_vv_96> AgradDistributionsGamma_vv_96;
+typedef std::tuple<AgradDistributionsGamma, type_vv_97> AgradDistributionsGamma_vv_97;
+typedef std::tuple<AgradDistributionsGamma, type_vv_98> AgradDistributionsGamma_vv_98;
+typedef std::tuple<AgradDistributionsGamma, type_vv_99> AgradDistributionsGamma_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_0, AgradDistributionTestFixture, AgradDistributionsGamma_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_1, AgradDistributionTestFixture, AgradDistributionsGamma_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_2, AgradDistributionTestFixture, AgradDistributionsGamma_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_3, AgradDistributionTestFixture, AgradDistributionsGamma_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_4, AgradDistributionTestFixture, AgradDistributionsGamma_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_5, AgradDistributionTestFixture, AgradDistributionsGamma_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_6, AgradDistributionTestFixture, AgradDistributionsGamma_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_7, AgradDistributionTestFixture, AgradDistributionsGamma_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_8, AgradDistributionTestFixture, AgradDistributionsGamma_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_9, AgradDistributionTestFixture, AgradDistributionsGamma_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_10, AgradDistributionTestFixture, AgradDistributionsGamma_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_11, AgradDistributionTestFixture, AgradDistributionsGamma_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_12, AgradDistributionTestFixture, AgradDistributionsGamma_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_13, AgradDistributionTestFixture, AgradDistributionsGamma_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_14, AgradDistributionTestFixture, AgradDistributionsGamma_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_15, AgradDistributionTestFixture, AgradDistributionsGamma_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_16, AgradDistributionTestFixture, AgradDistributionsGamma_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_17, AgradDistributionTestFixture, AgradDistributionsGamma_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_18, AgradDistributionTestFixture, AgradDistributionsGamma_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_19, AgradDistributionTestFixture, AgradDistributionsGamma_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_20, AgradDistributionTestFixture, AgradDistributionsGamma_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_21, AgradDistributionTestFixture, AgradDistributionsGamma_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_22, AgradDistributionTestFixture, AgradDistributionsGamma_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_23, AgradDistributionTestFixture, AgradDistributionsGamma_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_24, AgradDistributionTestFixture, AgradDistributionsGamma_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_25, AgradDistributionTestFixture, AgradDistributionsGamma_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_26, AgradDistributionTestFixture, AgradDistributionsGamma_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_27, AgradDistributionTestFixture, AgradDistributionsGamma_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_28, AgradDistributionTestFixture, AgradDistributionsGamma_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_29, AgradDistributionTestFixture, AgradDistributionsGamma_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_30, AgradDistributionTestFixture, AgradDistributionsGamma_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_31, AgradDistributionTestFixture, AgradDistributionsGamma_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_32, AgradDistributionTestFixture, AgradDistributionsGamma_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_33, AgradDistributionTestFixture, AgradDistributionsGamma_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_34, AgradDistributionTestFixture, AgradDistributionsGamma_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_35, AgradDistributionTestFixture, AgradDistributionsGamma_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_36, AgradDistributionTestFixture, AgradDistributionsGamma_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_37, AgradDistributionTestFixture, AgradDistributionsGamma_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_38, AgradDistributionTestFixture, AgradDistributionsGamma_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_39, AgradDistributionTestFixture, AgradDistributionsGamma_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_40, AgradDistributionTestFixture, AgradDistributionsGamma_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_41, AgradDistributionTestFixture, AgradDistributionsGamma_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_42, AgradDistributionTestFixture, AgradDistributionsGamma_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_43, AgradDistributionTestFixture, AgradDistributionsGamma_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_44, AgradDistributionTestFixture, AgradDistributionsGamma_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_45, AgradDistributionTestFixture, AgradDistributionsGamma_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_46, AgradDistributionTestFixture, AgradDistributionsGamma_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_47, AgradDistributionTestFixture, AgradDistributionsGamma_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_48, AgradDistributionTestFixture, AgradDistributionsGamma_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_49, AgradDistributionTestFixture, AgradDistributionsGamma_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_50, AgradDistributionTestFixture, AgradDistributionsGamma_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_51, AgradDistributionTestFixture, AgradDistributionsGamma_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_52, AgradDistributionTestFixture, AgradDistributionsGamma_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_53, AgradDistributionTestFixture, AgradDistributionsGamma_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_54, AgradDistributionTestFixture, AgradDistributionsGamma_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_55, AgradDistributionTestFixture, AgradDistributionsGamma_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_56, AgradDistributionTestFixture, AgradDistributionsGamma_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_57, AgradDistributionTestFixture, AgradDistributionsGamma_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_58, AgradDistributionTestFixture, AgradDistributionsGamma_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_59, AgradDistributionTestFixture, AgradDistributionsGamma_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_60, AgradDistributionTestFixture, AgradDistributionsGamma_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_61, AgradDistributionTestFixture, AgradDistributionsGamma_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_62, AgradDistributionTestFixture, AgradDistributionsGamma_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_63, AgradDistributionTestFixture, AgradDistributionsGamma_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_64, AgradDistributionTestFixture, AgradDistributionsGamma_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_65, AgradDistributionTestFixture, AgradDistributionsGamma_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_66, AgradDistributionTestFixture, AgradDistributionsGamma_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_67, AgradDistributionTestFixture, AgradDistributionsGamma_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_68, AgradDistributionTestFixture, AgradDistributionsGamma_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_69, AgradDistributionTestFixture, AgradDistributionsGamma_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_70, AgradDistributionTestFixture, AgradDistributionsGamma_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_71, AgradDistributionTestFixture, AgradDistributionsGamma_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_72, AgradDistributionTestFixture, AgradDistributionsGamma_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_73, AgradDistributionTestFixture, AgradDistributionsGamma_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_74, AgradDistributionTestFixture, AgradDistributionsGamma_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_75, AgradDistributionTestFixture, AgradDistributionsGamma_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_76, AgradDistributionTestFixture, AgradDistributionsGamma_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_77, AgradDistributionTestFixture, AgradDistributionsGamma_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_78, AgradDistributionTestFixture, AgradDistributionsGamma_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_79, AgradDistributionTestFixture, AgradDistributionsGamma_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_80, AgradDistributionTestFixture, AgradDistributionsGamma_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_81, AgradDistributionTestFixture, AgradDistributionsGamma_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_82, AgradDistributionTestFixture, AgradDistributionsGamma_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_83, AgradDistributionTestFixture, AgradDistributionsGamma_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_84, AgradDistributionTestFixture, AgradDistributionsGamma_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_85, AgradDistributionTestFixture, AgradDistributionsGamma_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_86, AgradDistributionTestFixture, AgradDistributionsGamma_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_87, AgradDistributionTestFixture, AgradDistributionsGamma_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_88, AgradDistributionTestFixture, AgradDistributionsGamma_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_89, AgradDistributionTestFixture, AgradDistributionsGamma_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_90, AgradDistributionTestFixture, AgradDistributionsGamma_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_91, AgradDistributionTestFixture, AgradDistributionsGamma_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_92, AgradDistributionTestFixture, AgradDistributionsGamma_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_93, AgradDistributionTestFixture, AgradDistributionsGamma_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_94, AgradDistributionTestFixture, AgradDistributionsGamma_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_95, AgradDistributionTestFixture, AgradDistributionsGamma_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_96, AgradDistributionTestFixture, AgradDistributionsGamma_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_97, AgradDistributionTestFixture, AgradDistributionsGamma_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_98, AgradDistributionTestFixture, AgradDistributionsGamma_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_99, AgradDistributionTestFixture, AgradDistributionsGamma_vv_99);
+
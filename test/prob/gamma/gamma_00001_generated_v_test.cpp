@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsGamma, type_v_100> AgradDistributionsGamma_v_100;
+typedef std::tuple<AgradDistributionsGamma, type_v_101> AgradDistributionsGamma_v_101;
+typedef std::tuple<AgradDistributionsGamma, type_v_102> AgradDistributionsGamma_v_102;
+typedef std::tuple<AgradDistributionsGamma, type_v_103> AgradDistributionsGamma_v_103;
+typedef std::tuple<AgradDistributionsGamma, type_v_104> AgradDistributionsGamma_v_104;
+typedef std::tuple<AgradDistributionsGamma, type_v_105> AgradDistributionsGamma_v_105;
+typedef std::tuple<AgradDistributionsGamma, type_v_106> AgradDistributionsGamma_v_106;
+typedef std::tuple<AgradDistributionsGamma, type_v_107> AgradDistributionsGamma_v_107;
+typedef std::tuple<AgradDistributionsGamma, type_v_108> AgradDistributionsGamma_v_108;
+typedef std::tuple<AgradDistributionsGamma, type_v_109> AgradDistributionsGamma_v_109;
+typedef std::tuple<AgradDistributionsGamma, type_v_110> AgradDistributionsGamma_v_110;
+typedef std::tuple<AgradDistributionsGamma, type_v_111> AgradDistributionsGamma_v_111;
+typedef std::tuple<AgradDistributionsGamma, type_v_112> AgradDistributionsGamma_v_112;
+typedef std::tuple<AgradDistributionsGamma, type_v_113> AgradDistributionsGamma_v_113;
+typedef std::tuple<AgradDistributionsGamma, type_v_114> AgradDistributionsGamma_v_114;
+typedef std::tuple<AgradDistributionsGamma, type_v_115> AgradDistributionsGamma_v_115;
+typedef std::tuple<AgradDistributionsGamma, type_v_116> AgradDistributionsGamma_v_116;
+typedef std::tuple<AgradDistributionsGamma, type_v_117> AgradDistributionsGamma_v_117;
+typedef std::tuple<AgradDistributionsGamma, type_v_118> AgradDistributionsGamma_v_118;
+typedef std::tuple<AgradDistributionsGamma, type_v_119> AgradDistributionsGamma_v_119;
+typedef std::tuple<AgradDistributionsGamma, type_v_120> AgradDistributionsGamma_v_120;
+typedef std::tuple<AgradDistributionsGamma, type_v_121> AgradDistributionsGamma_v_121;
+typedef std::tuple<AgradDistributionsGamma, type_v_122> AgradDistributionsGamma_v_122;
+typedef std::tuple<AgradDistributionsGamma, type_v_123> AgradDistributionsGamma_v_123;
+typedef std::tuple<AgradDistributionsGamma, type_v_124> AgradDistributionsGamma_v_124;
+typedef std::tuple<AgradDistributionsGamma, type_v_125> AgradDistributionsGamma_v_125;
+typedef std::tuple<AgradDistributionsGamma, type_v_126> AgradDistributionsGamma_v_126;
+typedef std::tuple<AgradDistributionsGamma, type_v_127> AgradDistributionsGamma_v_127;
+typedef std::tuple<AgradDistributionsGamma, type_v_128> AgradDistributionsGamma_v_128;
+typedef std::tuple<AgradDistributionsGamma, type_v_129> AgradDistributionsGamma_v_129;
+typedef std::tuple<AgradDistributionsGamma, type_v_130> AgradDistributionsGamma_v_130;
+typedef std::tuple<AgradDistributionsGamma, type_v_131> AgradDistributionsGamma_v_131;
+typedef std::tuple<AgradDistributionsGamma, type_v_132> AgradDistributionsGamma_v_132;
+typedef std::tuple<AgradDistributionsGamma, type_v_133> AgradDistributionsGamma_v_133;
+typedef std::tuple<AgradDistributionsGamma, type_v_134> AgradDistributionsGamma_v_134;
+typedef std::tuple<AgradDistributionsGamma, type_v_135> AgradDistributionsGamma_v_135;
+typedef std::tuple<AgradDistributionsGamma, type_v_136> AgradDistributionsGamma_v_136;
+typedef std::tuple<AgradDistributionsGamma, type_v_137> AgradDistributionsGamma_v_137;
+typedef std::tuple<AgradDistributionsGamma, type_v_138> AgradDistributionsGamma_v_138;
+typedef std::tuple<AgradDistributionsGamma, type_v_139> AgradDistributionsGamma_v_139;
+typedef std::tuple<AgradDistributionsGamma, type_v_140> AgradDistributionsGamma_v_140;
+typedef std::tuple<AgradDistributionsGamma, type_v_141> AgradDistributionsGamma_v_141;
+typedef std::tuple<AgradDistributionsGamma, type_v_142> AgradDistributionsGamma_v_142;
+typedef std::tuple<AgradDistributionsGamma, type_v_143> AgradDistributionsGamma_v_143;
+typedef std::tuple<AgradDistributionsGamma, type_v_144> AgradDistributionsGamma_v_144;
+typedef std::tuple<AgradDistributionsGamma, type_v_145> AgradDistributionsGamma_v_145;
+typedef std::tuple<AgradDistributionsGamma, type_v_146> AgradDistributionsGamma_v_146;
+typedef std::tuple<AgradDistributionsGamma, type_v_147> AgradDistributionsGamma_v_147;
+typedef std::tuple<AgradDistributionsGamma, type_v_148> AgradDistributionsGamma_v_148;
+typedef std::tuple<AgradDistributionsGamma, type_v_149> AgradDistributionsGamma_v_149;
+typedef std::tuple<AgradDistributionsGamma, type_v_150> AgradDistributionsGamma_v_150;
+typedef std::tuple<AgradDistributionsGamma, type_v_151> AgradDistributionsGamma_v_151;
+typedef std::tuple<AgradDistributionsGamma, type_v_152> AgradDistributionsGamma_v_152;
+typedef std::tuple<AgradDistributionsGamma, type_v_153> AgradDistributionsGamma_v_153;
+typedef std::tuple<AgradDistributionsGamma, type_v_154> AgradDistributionsGamma_v_154;
+typedef std::tuple<AgradDistributionsGamma, type_v_155> AgradDistributionsGamma_v_155;
+typedef std::tuple<AgradDistributionsGamma, type_v_156> AgradDistributionsGamma_v_156;
+typedef std::tuple<AgradDistributionsGamma, type_v_157> AgradDistributionsGamma_v_157;
+typedef std::tuple<AgradDistributionsGamma, type_v_158> AgradDistributionsGamma_v_158;
+typedef std::tuple<AgradDistributionsGamma, type_v_159> AgradDistributionsGamma_v_159;
+typedef std::tuple<AgradDistributionsGamma, type_v_160> AgradDistributionsGamma_v_160;
+typedef std::tuple<AgradDistributionsGamma, type_v_161> AgradDistributionsGamma_v_161;
+typedef std::tuple<AgradDistributionsGamma, type_v_162> AgradDistributionsGamma_v_162;
+typedef std::tuple<AgradDistributionsGamma, type_v_163> AgradDistributionsGamma_v_163;
+typedef std::tuple<AgradDistributionsGamma, type_v_164> AgradDistributionsGamma_v_164;
+typedef std::tuple<AgradDistributionsGamma, type_v_165> AgradDistributionsGamma_v_165;
+typedef std::tuple<AgradDistributionsGamma, type_v_166> AgradDistributionsGamma_v_166;
+typedef std::tuple<AgradDistributionsGamma, type_v_167> AgradDistributionsGamma_v_167;
+typedef std::tuple<AgradDistributionsGamma, type_v_168> AgradDistributionsGamma_v_168;
+typedef std::tuple<AgradDistributionsGamma, type_v_169> AgradDistributionsGamma_v_169;
+typedef std::tuple<AgradDistributionsGamma, type_v_170> AgradDistributionsGamma_v_170;
+typedef std::tuple<AgradDistributionsGamma, type_v_171> AgradDistributionsGamma_v_171;
+typedef std::tuple<AgradDistributionsGamma, type_v_172> AgradDistributionsGamma_v_172;
+typedef std::tuple<AgradDistributionsGamma, type_v_173> AgradDistributionsGamma_v_173;
+typedef std::tuple<AgradDistributionsGamma, type_v_174> AgradDistributionsGamma_v_174;
+typedef std::tuple<AgradDistributionsGamma, type_v_175> AgradDistributionsGamma_v_175;
+typedef std::tuple<AgradDistributionsGamma, type_v_176> AgradDistributionsGamma_v_176;
+typedef std::tuple<AgradDistributionsGamma, type_v_177> AgradDistributionsGamma_v_177;
+typedef std::tuple<AgradDistributionsGamma, type_v_178> AgradDistributionsGamma_v_178;
+typedef std::tuple<AgradDistributionsGamma, type_v_179> AgradDistributionsGamma_v_179;
+typedef std::tuple<AgradDistributionsGamma, type_v_180> AgradDistributionsGamma_v_180;
+typedef std::tuple<AgradDistributionsGamma, type_v_181> AgradDistributionsGamma_v_181;
+typedef std::tuple<AgradDistributionsGamma, type_v_182> AgradDistributionsGamma_v_182;
+typedef std::tuple<AgradDistributionsGamma, type_v_183> AgradDistributionsGamma_v_183;
+typedef std::tuple<AgradDistributionsGamma, type_v_184> AgradDistributionsGamma_v_184;
+typedef std::tuple<AgradDistributionsGamma, type_v_185> AgradDistributionsGamma_v_185;
+typedef std::tuple<AgradDistributionsGamma, type_v_186> AgradDistributionsGamma_v_186;
+typedef std::tuple<AgradDistributionsGamma, type_v_187> AgradDistributionsGamma_v_187;
+typedef std::tuple<AgradDistributionsGamma, type_v_188> AgradDistributionsGamma_v_188;
+typedef std::tuple<AgradDistributionsGamma, type_v_189> AgradDistributionsGamma_v_189;
+typedef std::tuple<AgradDistributionsGamma, type_v_190> AgradDistributionsGamma_v_190;
+typedef std::tuple<AgradDistributionsGamma, type_v_191> AgradDistributionsGamma_v_191;
+typedef std::tuple<AgradDistributionsGamma, type_v_192> AgradDistributionsGamma_v_192;
+typedef std::tuple<AgradDistributionsGamma, type_v_193> AgradDistributionsGamma_v_193;
+typedef std::tuple<AgradDistributionsGamma, type_v_194> AgradDistributionsGamma_v_194;
+typedef std::tuple<AgradDistributionsGamma, type_v_195> AgradDistributionsGamma_v_195;
+typedef std::tuple<AgradDistributionsGamma, type_v_196> AgradDistributionsGamma_v_196;
+typedef std::tuple<AgradDistributionsGamma, type_v_197> AgradDistributionsGamma_v_197;
+typedef std::tuple<AgradDistributionsGamma, type_v_198> AgradDistributionsGamma_v_198;
+typedef std::tuple<AgradDistributionsGamma, type_v_199> AgradDistributionsGamma_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_100, AgradDistributionTestFixture, AgradDistributionsGamma_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_101, AgradDistributionTestFixture, AgradDistributionsGamma_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_102, AgradDistributionTestFixture, AgradDistributionsGamma_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_103, AgradDistributionTestFixture, AgradDistributionsGamma_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_104, AgradDistributionTestFixture, AgradDistributionsGamma_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_105, AgradDistributionTestFixture, AgradDistributionsGamma_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_106, AgradDistributionTestFixture, AgradDistributionsGamma_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_107, AgradDistributionTestFixture, AgradDistributionsGamma_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_108, AgradDistributionTestFixture, AgradDistributionsGamma_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_109, AgradDistributionTestFixture, AgradDistributionsGamma_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_110, AgradDistributionTestFixture, AgradDistributionsGamma_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_111, AgradDistributionTestFixture, AgradDistributionsGamma_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_112, AgradDistributionTestFixture, AgradDistributionsGamma_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_113, AgradDistributionTestFixture, AgradDistributionsGamma_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_114, AgradDistributionTestFixture, AgradDistributionsGamma_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_115, AgradDistributionTestFixture, AgradDistributionsGamma_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_116, AgradDistributionTestFixture, AgradDistributionsGamma_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_117, AgradDistributionTestFixture, AgradDistributionsGamma_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_118, AgradDistributionTestFixture, AgradDistributionsGamma_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_119, AgradDistributionTestFixture, AgradDistributionsGamma_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_120, AgradDistributionTestFixture, AgradDistributionsGamma_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_121, AgradDistributionTestFixture, AgradDistributionsGamma_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_122, AgradDistributionTestFixture, AgradDistributionsGamma_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_123, AgradDistributionTestFixture, AgradDistributionsGamma_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_124, AgradDistributionTestFixture, AgradDistributionsGamma_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_125, AgradDistributionTestFixture, AgradDistributionsGamma_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_126, AgradDistributionTestFixture, AgradDistributionsGamma_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_127, AgradDistributionTestFixture, AgradDistributionsGamma_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_128, AgradDistributionTestFixture, AgradDistributionsGamma_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_129, AgradDistributionTestFixture, AgradDistributionsGamma_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_130, AgradDistributionTestFixture, AgradDistributionsGamma_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_131, AgradDistributionTestFixture, AgradDistributionsGamma_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_132, AgradDistributionTestFixture, AgradDistributionsGamma_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_133, AgradDistributionTestFixture, AgradDistributionsGamma_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_134, AgradDistributionTestFixture, AgradDistributionsGamma_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_135, AgradDistributionTestFixture, AgradDistributionsGamma_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_136, AgradDistributionTestFixture, AgradDistributionsGamma_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_137, AgradDistributionTestFixture, AgradDistributionsGamma_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_138, AgradDistributionTestFixture, AgradDistributionsGamma_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_139, AgradDistributionTestFixture, AgradDistributionsGamma_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_140, AgradDistributionTestFixture, AgradDistributionsGamma_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_141, AgradDistributionTestFixture, AgradDistributionsGamma_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_142, AgradDistributionTestFixture, AgradDistributionsGamma_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_143, AgradDistributionTestFixture, AgradDistributionsGamma_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_144, AgradDistributionTestFixture, AgradDistributionsGamma_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_145, AgradDistributionTestFixture, AgradDistributionsGamma_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_146, AgradDistributionTestFixture, AgradDistributionsGamma_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_147, AgradDistributionTestFixture, AgradDistributionsGamma_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_148, AgradDistributionTestFixture, AgradDistributionsGamma_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_149, AgradDistributionTestFixture, AgradDistributionsGamma_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_150, AgradDistributionTestFixture, AgradDistributionsGamma_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_151, AgradDistributionTestFixture, AgradDistributionsGamma_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_152, AgradDistributionTestFixture, AgradDistributionsGamma_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_153, AgradDistributionTestFixture, AgradDistributionsGamma_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_154, AgradDistributionTestFixture, AgradDistributionsGamma_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_155, AgradDistributionTestFixture, AgradDistributionsGamma_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_156, AgradDistributionTestFixture, AgradDistributionsGamma_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_157, AgradDistributionTestFixture, AgradDistributionsGamma_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_158, AgradDistributionTestFixture, AgradDistributionsGamma_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_159, AgradDistributionTestFixture, AgradDistributionsGamma_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_160, AgradDistributionTestFixture, AgradDistributionsGamma_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_161, AgradDistributionTestFixture, AgradDistributionsGamma_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_162, AgradDistributionTestFixture, AgradDistributionsGamma_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_163, AgradDistributionTestFixture, AgradDistributionsGamma_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_164, AgradDistributionTestFixture, AgradDistributionsGamma_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_165, AgradDistributionTestFixture, AgradDistributionsGamma_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_166, AgradDistributionTestFixture, AgradDistributionsGamma_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_167, AgradDistributionTestFixture, AgradDistributionsGamma_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_168, AgradDistributionTestFixture, AgradDistributionsGamma_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_169, AgradDistributionTestFixture, AgradDistributionsGamma_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_170, AgradDistributionTestFixture, AgradDistributionsGamma_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_171, AgradDistributionTestFixture, AgradDistributionsGamma_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_172, AgradDistributionTestFixture, AgradDistributionsGamma_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_173, AgradDistributionTestFixture, AgradDistributionsGamma_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_174, AgradDistributionTestFixture, AgradDistributionsGamma_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_175, AgradDistributionTestFixture, AgradDistributionsGamma_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_176, AgradDistributionTestFixture, AgradDistributionsGamma_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_177, AgradDistributionTestFixture, AgradDistributionsGamma_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_178, AgradDistributionTestFixture, AgradDistributionsGamma_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_179, AgradDistributionTestFixture, AgradDistributionsGamma_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_180, AgradDistributionTestFixture, AgradDistributionsGamma_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_181, AgradDistributionTestFixture, AgradDistributionsGamma_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_182, AgradDistributionTestFixture, AgradDistributionsGamma_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_183, AgradDistributionTestFixture, AgradDistributionsGamma_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_184, AgradDistributionTestFixture, AgradDistributionsGamma_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_185, AgradDistributionTestFixture, AgradDistributionsGamma_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_186, AgradDistributionTestFixture, AgradDistributionsGamma_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_187, AgradDistributionTestFixture, AgradDistributionsGamma_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_188, AgradDistributionTestFixture, AgradDistributionsGamma_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_189, AgradDistributionTestFixture, AgradDistributionsGamma_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_190, AgradDistributionTestFixture, AgradDistributionsGamma_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_191, AgradDistributionTestFixture, AgradDistributionsGamma_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_192, AgradDistributionTestFixture, AgradDistributionsGamma_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_193, AgradDistributionTestFixture, AgradDistributionsGamma_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_194, AgradDistributionTestFixture, AgradDistributionsGamma_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_195, AgradDistributionTestFixture, AgradDistributionsGamma_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_196, AgradDistributionTestFixture, AgradDistributionsGamma_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_197, AgradDistributionTestFixture, AgradDistributionsGamma_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_198, AgradDistributionTestFixture, AgradDistributionsGamma_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_199, AgradDistributionTestFixture, AgradDistributionsGamma_v_199);
+
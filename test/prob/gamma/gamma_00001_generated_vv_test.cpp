@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionsGamma, type_vv_100> AgradDistributionsGamma_vv_100;
+typedef std::tuple<AgradDistributionsGamma, type_vv_101> AgradDistributionsGamma_vv_101;
+typedef std::tuple<AgradDistributionsGamma, type_vv_102> AgradDistributionsGamma_vv_102;
+typedef std::tuple<AgradDistributionsGamma, type_vv_103> AgradDistributionsGamma_vv_103;
+typedef std::tuple<AgradDistributionsGamma, type_vv_104> AgradDistributionsGamma_vv_104;
+typedef std::tuple<AgradDistributionsGamma, type_vv_105> AgradDistributionsGamma_vv_105;
+typedef std::tuple<AgradDistributionsGamma, type_vv_106> AgradDistributionsGamma_vv_106;
+typedef std::tuple<AgradDistributionsGamma, type_vv_107> AgradDistributionsGamma_vv_107;
+typedef std::tuple<AgradDistributionsGamma, type_vv_108> AgradDistributionsGamma_vv_108;
+typedef std::tuple<AgradDistributionsGamma, type_vv_109> AgradDistributionsGamma_vv_109;
+typedef std::tuple<AgradDistributionsGamma, type_vv_110> AgradDistributionsGamma_vv_110;
+typedef std::tuple<AgradDistributionsGamma, type_vv_111> AgradDistributionsGamma_vv_111;
+typedef std::tuple<AgradDistributionsGamma, type_vv_112> AgradDistributionsGamma_vv_112;
+typedef std::tuple<AgradDistributionsGamma, type_vv_113> AgradDistributionsGamma_vv_113;
+typedef std::tuple<AgradDistributionsGamma, type_vv_114> AgradDistributionsGamma_vv_114;
+typedef std::tuple<AgradDistributionsGamma, type_vv_115> AgradDistributionsGamma_vv_115;
+typedef std::tuple<AgradDistributionsGamma, type_vv_116> AgradDistributionsGamma_vv_116;
+typedef std::tuple<AgradDistributionsGamma, type_vv_117> AgradDistributionsGamma_vv_117;
+typedef std::tuple<AgradDistributionsGamma, type_vv_118> AgradDistributionsGamma_vv_118;
+typedef std::tuple<AgradDistributionsGamma, type_vv_119> AgradDistributionsGamma_vv_119;
+typedef std::tuple<AgradDistributionsGamma, type_vv_120> AgradDistributionsGamma_vv_120;
+typedef std::tuple<AgradDistributionsGamma, type_vv_121> AgradDistributionsGamma_vv_121;
+typedef std::tuple<AgradDistributionsGamma, type_vv_122> AgradDistributionsGamma_vv_122;
+typedef std::tuple<AgradDistributionsGamma, type_vv_123> AgradDistributionsGamma_vv_123;
+typedef std::tuple<AgradDistributionsGamma, type_vv_124> AgradDistributionsGamma_vv_124;
+typedef std::tuple<AgradDistributionsGamma, type_vv_125> AgradDistributionsGamma_vv_125;
+typedef std::tuple<AgradDistributionsGamma, type_vv_126> AgradDistributionsGamma_vv_126;
+typedef std::tuple<AgradDistributionsGamma, type_vv_127> AgradDistributionsGamma_vv_127;
+typedef std::tuple<AgradDistributionsGamma, type_vv_128> AgradDistributionsGamma_vv_128;
+typedef std::tuple<AgradDistributionsGamma, type_vv_129> AgradDistributionsGamma_vv_129;
+typedef std::tuple<AgradDistributionsGamma, type_vv_130> AgradDistributionsGamma_vv_130;
+typedef std::tuple<AgradDistributionsGamma, type_vv_131> AgradDistributionsGamma_vv_131;
+typedef std::tuple<AgradDistributionsGamma, type_vv_132> AgradDistributionsGamma_vv_132;
+typedef std::tuple<AgradDistributionsGamma, type_vv_133> AgradDistributionsGamma_vv_133;
+typedef std::tuple<AgradDistributionsGamma, type_vv_134> AgradDistributionsGamma_vv_134;
+typedef std::tuple<AgradDistributionsGamma, type_vv_135> AgradDistributionsGamma_vv_135;
+typedef std::tuple<AgradDistributionsGamma, type_vv_136> AgradDistributionsGamma_vv_136;
+typedef std::tuple<AgradDistributionsGamma, type_vv_137> AgradDistributionsGamma_vv_137;
+typedef std::tuple<AgradDistributionsGamma, type_vv_138> AgradDistributionsGamma_vv_138;
+typedef std::tuple<AgradDistributionsGamma, type_vv_139> AgradDistributionsGamma_vv_139;
+typedef std::tuple<AgradDistributionsGamma, type_vv_140> AgradDistributionsGamma_vv_140;
+typedef std::tuple<AgradDistributionsGamma, type_vv_141> AgradDistributionsGamma_vv_141;
+typedef std::tuple<AgradDistributionsGamma, type_vv_142> AgradDistributionsGamma_vv_142;
+typedef std::tuple<AgradDistributionsGamma, type_vv_143> AgradDistributionsGamma_vv_143;
+typedef std::tuple<AgradDistributionsGamma, type_vv_144> AgradDistributionsGamma_vv_144;
+typedef std::tuple<AgradDistributionsGamma, type_vv_145> AgradDistributionsGamma_vv_145;
+typedef std::tuple<AgradDistributionsGamma, type_vv_146> AgradDistributionsGamma_vv_146;
+typedef std::tuple<AgradDistributionsGamma, type_vv_147> AgradDistributionsGamma_vv_147;
+typedef std::tuple<AgradDistributionsGamma, type_vv_148> AgradDistributionsGamma_vv_148;
+typedef std::tuple<AgradDistributionsGamma, type_vv_149> AgradDistributionsGamma_vv_149;
+typedef std::tuple<AgradDistributionsGamma, type_vv_150> AgradDistributionsGamma_vv_150;
+typedef std::tuple<AgradDistributionsGamma, type_vv_151> AgradDistributionsGamma_vv_151;
+typedef std::tuple<AgradDistributionsGamma, type_vv_152> AgradDistributionsGamma_vv_152;
+typedef std::tuple<AgradDistributionsGamma, type_vv_153> AgradDistributionsGamma_vv_153;
+typedef std::tuple<AgradDistributionsGamma, type_vv_154> AgradDistributionsGamma_vv_154;
+typedef std::tuple<AgradDistributionsGamma, type_vv_155> AgradDistributionsGamma_vv_155;
+typedef std::tuple<AgradDistributionsGamma, type_vv_156> AgradDistributionsGamma_vv_156;
+typedef std::tuple<AgradDistributionsGamma, type_vv_157> AgradDistributionsGamma_vv_157;
+typedef std::tuple<AgradDistributionsGamma, type_vv_158> AgradDistributionsGamma_vv_158;
+typedef std::tuple<AgradDistributionsGamma, type_vv_159> AgradDistributionsGamma_vv_159;
+typedef std::tuple<AgradDistributionsGamma, type_vv_160> AgradDistributionsGamma_vv_160;
+typedef std::tuple<AgradDistributionsGamma, type_vv_161> AgradDistributionsGamma_vv_161;
+typedef std::tuple<AgradDistributionsGamma, type_vv_162> AgradDistributionsGamma_vv_162;
+typedef std::tuple<AgradDistributionsGamma, type_vv_163> AgradDistributionsGamma_vv_163;
+typedef std::tuple<AgradDistributionsGamma, type_vv_164> AgradDistributionsGamma_vv_164;
+typedef std::tuple<AgradDistributionsGamma, type_vv_165> AgradDistributionsGamma_vv_165;
+typedef std::tuple<AgradDistributionsGamma, type_vv_166> AgradDistributionsGamma_vv_166;
+typedef std::tuple<AgradDistributionsGamma, type_vv_167> AgradDistributionsGamma_vv_167;
+typedef std::tuple<AgradDistributionsGamma, type_vv_168> AgradDistributionsGamma_vv_168;
+typedef std::tuple<AgradDistributionsGamma, type_vv_169> AgradDistributionsGamma_vv_169;
+typedef std::tuple<AgradDistributionsGamma, type_vv_170> AgradDistributionsGamma_vv_170;
+typedef std::tuple<AgradDistributionsGamma, type_vv_171> AgradDistributionsGamma_vv_171;
+typedef std::tuple<AgradDistributionsGamma, type_vv_172> AgradDistributionsGamma_vv_172;
+typedef std::tuple<AgradDistributionsGamma, type_vv_173> AgradDistributionsGamma_vv_173;
+typedef std::tuple<AgradDistributionsGamma, type_vv_174> AgradDistributionsGamma_vv_174;
+typedef std::tuple<AgradDistributionsGamma, type_vv_175> AgradDistributionsGamma_vv_175;
+typedef std::tuple<AgradDistributionsGamma, type_vv_176> AgradDistributionsGamma_vv_176;
+typedef std::tuple<AgradDistributionsGamma, type_vv_177> AgradDistributionsGamma_vv_177;
+typedef std::tuple<AgradDistributionsGamma, type_vv_178> AgradDistributionsGamma_vv_178;
+typedef std::tuple<AgradDistributionsGamma, type_vv_179> AgradDistributionsGamma_vv_179;
+typedef std::tuple<AgradDistributionsGamma, type_vv_180> AgradDistributionsGamma_vv_180;
+typedef std::tuple<AgradDistributionsGamma, type_vv_181> AgradDistributionsGamma_vv_181;
+typedef std::tuple<AgradDistributionsGamma, type_vv_182> AgradDistributionsGamma_vv_182;
+typedef std::tuple<AgradDistributionsGamma, type_vv_183> AgradDistributionsGamma_vv_183;
+typedef std::tuple<AgradDistributionsGamma, type_vv_184> AgradDistributionsGamma_vv_184;
+typedef std::tuple<AgradDistributionsGamma, type_vv_185> AgradDistributionsGamma_vv_185;
+typedef std::tuple<AgradDistributionsGamma, type_vv_186> AgradDistributionsGamma_vv_186;
+typedef std::tuple<AgradDistributionsGamma, type_vv_187> AgradDistributionsGamma_vv_187;
+typedef std::tuple<AgradDistributionsGamma, type_vv_188> AgradDistributionsGamma_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_100, AgradDistributionTestFixture, AgradDistributionsGamma_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_101, AgradDistributionTestFixture, AgradDistributionsGamma_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_102, AgradDistributionTestFixture, AgradDistributionsGamma_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_103, AgradDistributionTestFixture, AgradDistributionsGamma_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_104, AgradDistributionTestFixture, AgradDistributionsGamma_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_105, AgradDistributionTestFixture, AgradDistributionsGamma_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_106, AgradDistributionTestFixture, AgradDistributionsGamma_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_107, AgradDistributionTestFixture, AgradDistributionsGamma_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_108, AgradDistributionTestFixture, AgradDistributionsGamma_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_109, AgradDistributionTestFixture, AgradDistributionsGamma_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_110, AgradDistributionTestFixture, AgradDistributionsGamma_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_111, AgradDistributionTestFixture, AgradDistributionsGamma_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_112, AgradDistributionTestFixture, AgradDistributionsGamma_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_113, AgradDistributionTestFixture, AgradDistributionsGamma_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_114, AgradDistributionTestFixture, AgradDistributionsGamma_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_115, AgradDistributionTestFixture, AgradDistributionsGamma_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_116, AgradDistributionTestFixture, AgradDistributionsGamma_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_117, AgradDistributionTestFixture, AgradDistributionsGamma_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_118, AgradDistributionTestFixture, AgradDistributionsGamma_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_119, AgradDistributionTestFixture, AgradDistributionsGamma_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_120, AgradDistributionTestFixture, AgradDistributionsGamma_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_121, AgradDistributionTestFixture, AgradDistributionsGamma_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_122, AgradDistributionTestFixture, AgradDistributionsGamma_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_123, AgradDistributionTestFixture, AgradDistributionsGamma_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_124, AgradDistributionTestFixture, AgradDistributionsGamma_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_125, AgradDistributionTestFixture, AgradDistributionsGamma_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_126, AgradDistributionTestFixture, AgradDistributionsGamma_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_127, AgradDistributionTestFixture, AgradDistributionsGamma_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_128, AgradDistributionTestFixture, AgradDistributionsGamma_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_129, AgradDistributionTestFixture, AgradDistributionsGamma_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_130, AgradDistributionTestFixture, AgradDistributionsGamma_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_131, AgradDistributionTestFixture, AgradDistributionsGamma_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_132, AgradDistributionTestFixture, AgradDistributionsGamma_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_133, AgradDistributionTestFixture, AgradDistributionsGamma_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_134, AgradDistributionTestFixture, AgradDistributionsGamma_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_135, AgradDistributionTestFixture, AgradDistributionsGamma_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_136, AgradDistributionTestFixture, AgradDistributionsGamma_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_137, AgradDistributionTestFixture, AgradDistributionsGamma_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_138, AgradDistributionTestFixture, AgradDistributionsGamma_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_139, AgradDistributionTestFixture, AgradDistributionsGamma_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_140, AgradDistributionTestFixture, AgradDistributionsGamma_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_141, AgradDistributionTestFixture, AgradDistributionsGamma_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_142, AgradDistributionTestFixture, AgradDistributionsGamma_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_143, AgradDistributionTestFixture, AgradDistributionsGamma_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_144, AgradDistributionTestFixture, AgradDistributionsGamma_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_145, AgradDistributionTestFixture, AgradDistributionsGamma_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_146, AgradDistributionTestFixture, AgradDistributionsGamma_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_147, AgradDistributionTestFixture, AgradDistributionsGamma_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_148, AgradDistributionTestFixture, AgradDistributionsGamma_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_149, AgradDistributionTestFixture, AgradDistributionsGamma_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_150, AgradDistributionTestFixture, AgradDistributionsGamma_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_151, AgradDistributionTestFixture, AgradDistributionsGamma_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_152, AgradDistributionTestFixture, AgradDistributionsGamma_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_153, AgradDistributionTestFixture, AgradDistributionsGamma_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_154, AgradDistributionTestFixture, AgradDistributionsGamma_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_155, AgradDistributionTestFixture, AgradDistributionsGamma_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_156, AgradDistributionTestFixture, AgradDistributionsGamma_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_157, AgradDistributionTestFixture, AgradDistributionsGamma_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_158, AgradDistributionTestFixture, AgradDistributionsGamma_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_159, AgradDistributionTestFixture, AgradDistributionsGamma_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_160, AgradDistributionTestFixture, AgradDistributionsGamma_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_161, AgradDistributionTestFixture, AgradDistributionsGamma_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_162, AgradDistributionTestFixture, AgradDistributionsGamma_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_163, AgradDistributionTestFixture, AgradDistributionsGamma_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_164, AgradDistributionTestFixture, AgradDistributionsGamma_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_165, AgradDistributionTestFixture, AgradDistributionsGamma_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_166, AgradDistributionTestFixture, AgradDistributionsGamma_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_167, AgradDistributionTestFixture, AgradDistributionsGamma_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_168, AgradDistributionTestFixture, AgradDistributionsGamma_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_169, AgradDistributionTestFixture, AgradDistributionsGamma_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_170, AgradDistributionTestFixture, AgradDistributionsGamma_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_171, AgradDistributionTestFixture, AgradDistributionsGamma_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_172, AgradDistributionTestFixture, AgradDistributionsGamma_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_173, AgradDistributionTestFixture, AgradDistributionsGamma_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_174, AgradDistributionTestFixture, AgradDistributionsGamma_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_175, AgradDistributionTestFixture, AgradDistributionsGamma_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_176, AgradDistributionTestFixture, AgradDistributionsGamma_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_177, AgradDistributionTestFixture, AgradDistributionsGamma_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_178, AgradDistributionTestFixture, AgradDistributionsGamma_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_179, AgradDistributionTestFixture, AgradDistributionsGamma_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_180, AgradDistributionTestFixture, AgradDistributionsGamma_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_181, AgradDistributionTestFixture, AgradDistributionsGamma_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_182, AgradDistributionTestFixture, AgradDistributionsGamma_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_183, AgradDistributionTestFixture, AgradDistributionsGamma_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_184, AgradDistributionTestFixture, AgradDistributionsGamma_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_185, AgradDistributionTestFixture, AgradDistributionsGamma_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_186, AgradDistributionTestFixture, AgradDistributionsGamma_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_187, AgradDistributionTestFixture, AgradDistributionsGamma_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_vv_188, AgradDistributionTestFixture, AgradDistributionsGamma_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradDistributionsGamma, type_v_200> AgradDistributionsGamma_v_200;
+typedef std::tuple<AgradDistributionsGamma, type_v_201> AgradDistributionsGamma_v_201;
+typedef std::tuple<AgradDistributionsGamma, type_v_202> AgradDistributionsGamma_v_202;
+typedef std::tuple<AgradDistributionsGamma, type_v_203> AgradDistributionsGamma_v_203;
+typedef std::tuple<AgradDistributionsGamma, type_v_204> AgradDistributionsGamma_v_204;
+typedef std::tuple<AgradDistributionsGamma, type_v_205> AgradDistributionsGamma_v_205;
+typedef std::tuple<AgradDistributionsGamma, type_v_206> AgradDistributionsGamma_v_206;
+typedef std::tuple<AgradDistributionsGamma, type_v_207> AgradDistributionsGamma_v_207;
+typedef std::tuple<AgradDistributionsGamma, type_v_208> AgradDistributionsGamma_v_208;
+typedef std::tuple<AgradDistributionsGamma, type_v_209> AgradDistributionsGamma_v_209;
+typedef std::tuple<AgradDistributionsGamma, type_v_210> AgradDistributionsGamma_v_210;
+typedef std::tuple<AgradDistributionsGamma, type_v_211> AgradDistributionsGamma_v_211;
+typedef std::tuple<AgradDistributionsGamma, type_v_212> AgradDistributionsGamma_v_212;
+typedef std::tuple<AgradDistributionsGamma, type_v_213> AgradDistributionsGamma_v_213;
+typedef std::tuple<AgradDistributionsGamma, type_v_214> AgradDistributionsGamma_v_214;
+typedef std::tuple<AgradDistributionsGamma, type_v_215> AgradDistributionsGamma_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_200, AgradDistributionTestFixture, AgradDistributionsGamma_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_201, AgradDistributionTestFixture, AgradDistributionsGamma_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_202, AgradDistributionTestFixture, AgradDistributionsGamma_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_203, AgradDistributionTestFixture, AgradDistributionsGamma_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_204, AgradDistributionTestFixture, AgradDistributionsGamma_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_205, AgradDistributionTestFixture, AgradDistributionsGamma_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_206, AgradDistributionTestFixture, AgradDistributionsGamma_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_207, AgradDistributionTestFixture, AgradDistributionsGamma_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_208, AgradDistributionTestFixture, AgradDistributionsGamma_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_209, AgradDistributionTestFixture, AgradDistributionsGamma_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_210, AgradDistributionTestFixture, AgradDistributionsGamma_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_211, AgradDistributionTestFixture, AgradDistributionsGamma_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_212, AgradDistributionTestFixture, AgradDistributionsGamma_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_213, AgradDistributionTestFixture, AgradDistributionsGamma_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_214, AgradDistributionTestFixture, AgradDistributionsGamma_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsGamma_v_215, AgradDistributionTestFixture, AgradDistributionsGamma_v_215);
+
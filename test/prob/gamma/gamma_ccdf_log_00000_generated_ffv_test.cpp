@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_0> AgradCcdfLogGamma_ffv_0;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_1> AgradCcdfLogGamma_ffv_1;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_2> AgradCcdfLogGamma_ffv_2;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_3> AgradCcdfLogGamma_ffv_3;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_4> AgradCcdfLogGamma_ffv_4;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_5> AgradCcdfLogGamma_ffv_5;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_6> AgradCcdfLogGamma_ffv_6;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_7> AgradCcdfLogGamma_ffv_7;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_8> AgradCcdfLogGamma_ffv_8;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_9> AgradCcdfLogGamma_ffv_9;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_10> AgradCcdfLogGamma_ffv_10;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_11> AgradCcdfLogGamma_ffv_11;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_12> AgradCcdfLogGamma_ffv_12;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_13> AgradCcdfLogGamma_ffv_13;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_14> AgradCcdfLogGamma_ffv_14;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_15> AgradCcdfLogGamma_ffv_15;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_16> AgradCcdfLogGamma_ffv_16;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_17> AgradCcdfLogGamma_ffv_17;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_18> AgradCcdfLogGamma_ffv_18;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_19> AgradCcdfLogGamma_ffv_19;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_20> AgradCcdfLogGamma_ffv_20;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_21> AgradCcdfLogGamma_ffv_21;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_22> AgradCcdfLogGamma_ffv_22;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_23> AgradCcdfLogGamma_ffv_23;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_24> AgradCcdfLogGamma_ffv_24;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_25> AgradCcdfLogGamma_ffv_25;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_26> AgradCcdfLogGamma_ffv_26;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_27> AgradCcdfLogGamma_ffv_27;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_28> AgradCcdfLogGamma_ffv_28;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_29> AgradCcdfLogGamma_ffv_29;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_30> AgradCcdfLogGamma_ffv_30;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_31> AgradCcdfLogGamma_ffv_31;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_32> AgradCcdfLogGamma_ffv_32;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_33> AgradCcdfLogGamma_ffv_33;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_34> AgradCcdfLogGamma_ffv_34;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_35> AgradCcdfLogGamma_ffv_35;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_36> AgradCcdfLogGamma_ffv_36;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_37> AgradCcdfLogGamma_ffv_37;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_38> AgradCcdfLogGamma_ffv_38;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_39> AgradCcdfLogGamma_ffv_39;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_40> AgradCcdfLogGamma_ffv_40;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_41> AgradCcdfLogGamma_ffv_41;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_42> AgradCcdfLogGamma_ffv_42;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_43> AgradCcdfLogGamma_ffv_43;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_44> AgradCcdfLogGamma_ffv_44;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_45> AgradCcdfLogGamma_ffv_45;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_46> AgradCcdfLogGamma_ffv_46;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_47> AgradCcdfLogGamma_ffv_47;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_48> AgradCcdfLogGamma_ffv_48;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_49> AgradCcdfLogGamma_ffv_49;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_50> AgradCcdfLogGamma_ffv_50;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_51> AgradCcdfLogGamma_ffv_51;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_52> AgradCcdfLogGamma_ffv_52;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_53> AgradCcdfLogGamma_ffv_53;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_54> AgradCcdfLogGamma_ffv_54;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_55> AgradCcdfLogGamma_ffv_55;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_56> AgradCcdfLogGamma_ffv_56;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_57> AgradCcdfLogGamma_ffv_57;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_58> AgradCcdfLogGamma_ffv_58;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_59> AgradCcdfLogGamma_ffv_59;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_60> AgradCcdfLogGamma_ffv_60;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_61> AgradCcdfLogGamma_ffv_61;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_62> AgradCcdfLogGamma_ffv_62;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_63> AgradCcdfLogGamma_ffv_63;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_64> AgradCcdfLogGamma_ffv_64;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_65> AgradCcdfLogGamma_ffv_65;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_66> AgradCcdfLogGamma_ffv_66;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_67> AgradCcdfLogGamma_ffv_67;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_68> AgradCcdfLogGamma_ffv_68;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_69> AgradCcdfLogGamma_ffv_69;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_70> AgradCcdfLogGamma_ffv_70;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_71> AgradCcdfLogGamma_ffv_71;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_72> AgradCcdfLogGamma_ffv_72;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_73> AgradCcdfLogGamma_ffv_73;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_74> AgradCcdfLogGamma_ffv_74;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_75> AgradCcdfLogGamma_ffv_75;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_76> AgradCcdfLogGamma_ffv_76;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_77> AgradCcdfLogGamma_ffv_77;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_78> AgradCcdfLogGamma_ffv_78;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_79> AgradCcdfLogGamma_ffv_79;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_80> AgradCcdfLogGamma_ffv_80;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_81> AgradCcdfLogGamma_ffv_81;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_82> AgradCcdfLogGamma_ffv_82;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_83> AgradCcdfLogGamma_ffv_83;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_84> AgradCcdfLogGamma_ffv_84;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_85> AgradCcdfLogGamma_ffv_85;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_86> AgradCcdfLogGamma_ffv_86;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_87> AgradCcdfLogGamma_ffv_87;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_88> AgradCcdfLogGamma_ffv_88;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_89> AgradCcdfLogGamma_ffv_89;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_90> AgradCcdfLogGamma_ffv_90;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_91> AgradCcdfLogGamma_ffv_91;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_92> AgradCcdfLogGamma_ffv_92;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_93> AgradCcdfLogGamma_ffv_93;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_94> AgradCcdfLogGamma_ffv_94;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_95> AgradCcdfLogGamma_ffv_95;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_96> AgradCcdfLogGamma_ffv_96;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_97> AgradCcdfLogGamma_ffv_97;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_98> AgradCcdfLogGamma_ffv_98;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_99> AgradCcdfLogGamma_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogGamma, type_v_0> AgradCcdfLogGamma_v_0;
+typedef std::tuple<AgradCcdfLogGamma, type_v_1> AgradCcdfLogGamma_v_1;
+typedef std::tuple<AgradCcdfLogGamma, type_v_2> AgradCcdfLogGamma_v_2;
+typedef std::tuple<AgradCcdfLogGamma, type_v_3> AgradCcdfLogGamma_v_3;
+typedef std::tuple<AgradCcdfLogGamma, type_v_4> AgradCcdfLogGamma_v_4;
+typedef std::tuple<AgradCcdfLogGamma, type_v_5> AgradCcdfLogGamma_v_5;
+typedef std::tuple<AgradCcdfLogGamma, type_v_6> AgradCcdfLogGamma_v_6;
+typedef std::tuple<AgradCcdfLogGamma, type_v_7> AgradCcdfLogGamma_v_7;
+typedef std::tuple<AgradCcdfLogGamma, type_v_8> AgradCcdfLogGamma_v_8;
+typedef std::tuple<AgradCcdfLogGamma, type_v_9> AgradCcdfLogGamma_v_9;
+typedef std::tuple<AgradCcdfLogGamma, type_v_10> AgradCcdfLogGamma_v_10;
+typedef std::tuple<AgradCcdfLogGamma, type_v_11> AgradCcdfLogGamma_v_11;
+typedef std::tuple<AgradCcdfLogGamma, type_v_12> AgradCcdfLogGamma_v_12;
+typedef std::tuple<AgradCcdfLogGamma, type_v_13> AgradCcdfLogGamma_v_13;
+typedef std::tuple<AgradCcdfLogGamma, type_v_14> AgradCcdfLogGamma_v_14;
+typedef std::tuple<AgradCcdfLogGamma, type_v_15> AgradCcdfLogGamma_v_15;
+typedef std::tuple<AgradCcdfLogGamma, type_v_16> AgradCcdfLogGamma_v_16;
+typedef std::tuple<AgradCcdfLogGamma, type_v_17> AgradCcdfLogGamma_v_17;
+typedef std::tuple<AgradCcdfLogGamma, type_v_18> AgradCcdfLogGamma_v_18;
+typedef std::tuple<AgradCcdfLogGamma, type_v_19> AgradCcdfLogGamma_v_19;
+typedef std::tuple<AgradCcdfLogGamma, type_v_20> AgradCcdfLogGamma_v_20;
+typedef std::tuple<AgradCcdfLogGamma, type_v_21> AgradCcdfLogGamma_v_21;
+typedef std::tuple<AgradCcdfLogGamma, type_v_22> AgradCcdfLogGamma_v_22;
+typedef std::tuple<AgradCcdfLogGamma, type_v_23> AgradCcdfLogGamma_v_23;
+typedef std::tuple<AgradCcdfLogGamma, type_v_24> AgradCcdfLogGamma_v_24;
+typedef std::tuple<AgradCcdfLogGamma, type_v_25> AgradCcdfLogGamma_v_25;
+typedef std::tuple<AgradCcdfLogGamma, type_v_26> AgradCcdfLogGamma_v_26;
+typedef std::tuple<AgradCcdfLogGamma, type_v_27> AgradCcdfLogGamma_v_27;
+typedef std::tuple<AgradCcdfLogGamma, type_v_28> AgradCcdfLogGamma_v_28;
+typedef std::tuple<AgradCcdfLogGamma, type_v_29> AgradCcdfLogGamma_v_29;
+typedef std::tuple<AgradCcdfLogGamma, type_v_30> AgradCcdfLogGamma_v_30;
+typedef std::tuple<AgradCcdfLogGamma, type_v_31> AgradCcdfLogGamma_v_31;
+typedef std::tuple<AgradCcdfLogGamma, type_v_32> AgradCcdfLogGamma_v_32;
+typedef std::tuple<AgradCcdfLogGamma, type_v_33> AgradCcdfLogGamma_v_33;
+typedef std::tuple<AgradCcdfLogGamma, type_v_34> AgradCcdfLogGamma_v_34;
+typedef std::tuple<AgradCcdfLogGamma, type_v_35> AgradCcdfLogGamma_v_35;
+typedef std::tuple<AgradCcdfLogGamma, type_v_36> AgradCcdfLogGamma_v_36;
+typedef std::tuple<AgradCcdfLogGamma, type_v_37> AgradCcdfLogGamma_v_37;
+typedef std::tuple<AgradCcdfLogGamma, type_v_38> AgradCcdfLogGamma_v_38;
+typedef std::tuple<AgradCcdfLogGamma, type_v_39> AgradCcdfLogGamma_v_39;
+typedef std::tuple<AgradCcdfLogGamma, type_v_40> AgradCcdfLogGamma_v_40;
+typedef std::tuple<AgradCcdfLogGamma, type_v_41> AgradCcdfLogGamma_v_41;
+typedef std::tuple<AgradCcdfLogGamma, type_v_42> AgradCcdfLogGamma_v_42;
+typedef std::tuple<AgradCcdfLogGamma, type_v_43> AgradCcdfLogGamma_v_43;
+typedef std::tuple<AgradCcdfLogGamma, type_v_44> AgradCcdfLogGamma_v_44;
+typedef std::tuple<AgradCcdfLogGamma, type_v_45> AgradCcdfLogGamma_v_45;
+typedef std::tuple<AgradCcdfLogGamma, type_v_46> AgradCcdfLogGamma_v_46;
+typedef std::tuple<AgradCcdfLogGamma, type_v_47> AgradCcdfLogGamma_v_47;
+typedef std::tuple<AgradCcdfLogGamma, type_v_48> AgradCcdfLogGamma_v_48;
+typedef std::tuple<AgradCcdfLogGamma, type_v_49> AgradCcdfLogGamma_v_49;
+typedef std::tuple<AgradCcdfLogGamma, type_v_50> AgradCcdfLogGamma_v_50;
+typedef std::tuple<AgradCcdfLogGamma, type_v_51> AgradCcdfLogGamma_v_51;
+typedef std::tuple<AgradCcdfLogGamma, type_v_52> AgradCcdfLogGamma_v_52;
+typedef std::tuple<AgradCcdfLogGamma, type_v_53> AgradCcdfLogGamma_v_53;
+typedef std::tuple<AgradCcdfLogGamma, type_v_54> AgradCcdfLogGamma_v_54;
+typedef std::tuple<AgradCcdfLogGamma, type_v_55> AgradCcdfLogGamma_v_55;
+typedef std::tuple<AgradCcdfLogGamma, type_v_56> AgradCcdfLogGamma_v_56;
+typedef std::tuple<AgradCcdfLogGamma, type_v_57> AgradCcdfLogGamma_v_57;
+typedef std::tuple<AgradCcdfLogGamma, type_v_58> AgradCcdfLogGamma_v_58;
+typedef std::tuple<AgradCcdfLogGamma, type_v_59> AgradCcdfLogGamma_v_59;
+typedef std::tuple<AgradCcdfLogGamma, type_v_60> AgradCcdfLogGamma_v_60;
+typedef std::tuple<AgradCcdfLogGamma, type_v_61> AgradCcdfLogGamma_v_61;
+typedef std::tuple<AgradCcdfLogGamma, type_v_62> AgradCcdfLogGamma_v_62;
+typedef std::tuple<AgradCcdfLogGamma, type_v_63> AgradCcdfLogGamma_v_63;
+typedef std::tuple<AgradCcdfLogGamma, type_v_64> AgradCcdfLogGamma_v_64;
+typedef std::tuple<AgradCcdfLogGamma, type_v_65> AgradCcdfLogGamma_v_65;
+typedef std::tuple<AgradCcdfLogGamma, type_v_66> AgradCcdfLogGamma_v_66;
+typedef std::tuple<AgradCcdfLogGamma, type_v_67> AgradCcdfLogGamma_v_67;
+typedef std::tuple<AgradCcdfLogGamma, type_v_68> AgradCcdfLogGamma_v_68;
+typedef std::tuple<AgradCcdfLogGamma, type_v_69> AgradCcdfLogGamma_v_69;
+typedef std::tuple<AgradCcdfLogGamma, type_v_70> AgradCcdfLogGamma_v_70;
+typedef std::tuple<AgradCcdfLogGamma, type_v_71> AgradCcdfLogGamma_v_71;
+typedef std::tuple<AgradCcdfLogGamma, type_v_72> AgradCcdfLogGamma_v_72;
+typedef std::tuple<AgradCcdfLogGamma, type_v_73> AgradCcdfLogGamma_v_73;
+typedef std::tuple<AgradCcdfLogGamma, type_v_74> AgradCcdfLogGamma_v_74;
+typedef std::tuple<AgradCcdfLogGamma, type_v_75> AgradCcdfLogGamma_v_75;
+typedef std::tuple<AgradCcdfLogGamma, type_v_76> AgradCcdfLogGamma_v_76;
+typedef std::tuple<AgradCcdfLogGamma, type_v_77> AgradCcdfLogGamma_v_77;
+typedef std::tuple<AgradCcdfLogGamma, type_v_78> AgradCcdfLogGamma_v_78;
+typedef std::tuple<AgradCcdfLogGamma, type_v_79> AgradCcdfLogGamma_v_79;
+typedef std::tuple<AgradCcdfLogGamma, type_v_80> AgradCcdfLogGamma_v_80;
+typedef std::tuple<AgradCcdfLogGamma, type_v_81> AgradCcdfLogGamma_v_81;
+typedef std::tuple<AgradCcdfLogGamma, type_v_82> AgradCcdfLogGamma_v_82;
+typedef std::tuple<AgradCcdfLogGamma, type_v_83> AgradCcdfLogGamma_v_83;
+typedef std::tuple<AgradCcdfLogGamma, type_v_84> AgradCcdfLogGamma_v_84;
+typedef std::tuple<AgradCcdfLogGamma, type_v_85> AgradCcdfLogGamma_v_85;
+typedef std::tuple<AgradCcdfLogGamma, type_v_86> AgradCcdfLogGamma_v_86;
+typedef std::tuple<AgradCcdfLogGamma, type_v_87> AgradCcdfLogGamma_v_87;
+typedef std::tuple<AgradCcdfLogGamma, type_v_88> AgradCcdfLogGamma_v_88;
+typedef std::tuple<AgradCcdfLogGamma, type_v_89> AgradCcdfLogGamma_v_89;
+typedef std::tuple<AgradCcdfLogGamma, type_v_90> AgradCcdfLogGamma_v_90;
+typedef std::tuple<AgradCcdfLogGamma, type_v_91> AgradCcdfLogGamma_v_91;
+typedef std::tuple<AgradCcdfLogGamma, type_v_92> AgradCcdfLogGamma_v_92;
+typedef std::tuple<AgradCcdfLogGamma, type_v_93> AgradCcdfLogGamma_v_93;
+typedef std::tuple<AgradCcdfLogGamma, type_v_94> AgradCcdfLogGamma_v_94;
+typedef std::tuple<AgradCcdfLogGamma, type_v_95> AgradCcdfLogGamma_v_95;
+typedef std::tuple<AgradCcdfLogGamma, type_v_96> AgradCcdfLogGamma_v_96;
+typedef std::tuple<AgradCcdfLogGamma, type_v_97> AgradCcdfLogGamma_v_97;
+typedef std::tuple<AgradCcdfLogGamma, type_v_98> AgradCcdfLogGamma_v_98;
+typedef std::tuple<AgradCcdfLogGamma, type_v_99> AgradCcdfLogGamma_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_0, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_1, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_2, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_3, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_4, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_5, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_6, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_7, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_8, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_9, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_10, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_11, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_12, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_13, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_14, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_15, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_16, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_17, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_18, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_19, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_20, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_21, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_22, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_23, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_24, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_25, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_26, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_27, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_28, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_29, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_30, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_31, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_32, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_33, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_34, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_35, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_36, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_37, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_38, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_39, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_40, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_41, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_42, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_43, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_44, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_45, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_46, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_47, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_48, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_49, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_50, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_51, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_52, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_53, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_54, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_55, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_56, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_57, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_58, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_59, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_60, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_61, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_62, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_63, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_64, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_65, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_66, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_67, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_68, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_69, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_70, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_71, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_72, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_73, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_74, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_75, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_76, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_77, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_78, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_79, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_80, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_81, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_82, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_83, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_84, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_85, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_86, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_87, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_88, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_89, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_90, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_91, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_92, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_93, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_94, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_95, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_96, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_97, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_98, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_99, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogGamma, type_vv_0> AgradCcdfLogGamma_vv_0;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_1> AgradCcdfLogGamma_vv_1;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_2> AgradCcdfLogGamma_vv_2;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_3> AgradCcdfLogGamma_vv_3;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_4> AgradCcdfLogGamma_vv_4;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_5> AgradCcdfLogGamma_vv_5;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_6> AgradCcdfLogGamma_vv_6;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_7> AgradCcdfLogGamma_vv_7;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_8> AgradCcdfLogGamma_vv_8;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_9> AgradCcdfLogGamma_vv_9;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_10> AgradCcdfLogGamma_vv_10;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_11> AgradCcdfLogGamma_vv_11;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_12> AgradCcdfLogGamma_vv_12;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_13> AgradCcdfLogGamma_vv_13;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_14> AgradCcdfLogGamma_vv_14;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_15> AgradCcdfLogGamma_vv_15;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_16> AgradCcdfLogGamma_vv_16;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_17> AgradCcdfLogGamma_vv_17;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_18> AgradCcdfLogGamma_vv_18;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_19> AgradCcdfLogGamma_vv_19;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_20> AgradCcdfLogGamma_vv_20;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_21> AgradCcdfLogGamma_vv_21;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_22> AgradCcdfLogGamma_vv_22;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_23> AgradCcdfLogGamma_vv_23;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_24> AgradCcdfLogGamma_vv_24;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_25> AgradCcdfLogGamma_vv_25;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_26> AgradCcdfLogGamma_vv_26;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_27> AgradCcdfLogGamma_vv_27;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_28> AgradCcdfLogGamma_vv_28;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_29> AgradCcdfLogGamma_vv_29;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_30> AgradCcdfLogGamma_vv_30;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_31> AgradCcdfLogGamma_vv_31;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_32> AgradCcdfLogGamma_vv_32;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_33> AgradCcdfLogGamma_vv_33;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_34> AgradCcdfLogGamma_vv_34;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_35> AgradCcdfLogGamma_vv_35;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_36> AgradCcdfLogGamma_vv_36;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_37> AgradCcdfLogGamma_vv_37;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_38> AgradCcdfLogGamma_vv_38;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_39> AgradCcdfLogGamma_vv_39;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_40> AgradCcdfLogGamma_vv_40;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_41> AgradCcdfLogGamma_vv_41;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_42> AgradCcdfLogGamma_vv_42;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_43> AgradCcdfLogGamma_vv_43;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_44> AgradCcdfLogGamma_vv_44;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_45> AgradCcdfLogGamma_vv_45;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_46> AgradCcdfLogGamma_vv_46;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_47> AgradCcdfLogGamma_vv_47;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_48> AgradCcdfLogGamma_vv_48;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_49> AgradCcdfLogGamma_vv_49;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_50> AgradCcdfLogGamma_vv_50;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_51> AgradCcdfLogGamma_vv_51;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_52> AgradCcdfLogGamma_vv_52;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_53> AgradCcdfLogGamma_vv_53;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_54> AgradCcdfLogGamma_vv_54;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_55> AgradCcdfLogGamma_vv_55;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_56> AgradCcdfLogGamma_vv_56;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_57> AgradCcdfLogGamma_vv_57;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_58> AgradCcdfLogGamma_vv_58;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_59> AgradCcdfLogGamma_vv_59;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_60> AgradCcdfLogGamma_vv_60;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_61> AgradCcdfLogGamma_vv_61;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_62> AgradCcdfLogGamma_vv_62;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_63> AgradCcdfLogGamma_vv_63;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_64> AgradCcdfLogGamma_vv_64;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_65> AgradCcdfLogGamma_vv_65;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_66> AgradCcdfLogGamma_vv_66;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_67> AgradCcdfLogGamma_vv_67;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_68> AgradCcdfLogGamma_vv_68;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_69> AgradCcdfLogGamma_vv_69;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_70> AgradCcdfLogGamma_vv_70;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_71> AgradCcdfLogGamma_vv_71;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_72> AgradCcdfLogGamma_vv_72;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_73> AgradCcdfLogGamma_vv_73;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_74> AgradCcdfLogGamma_vv_74;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_75> AgradCcdfLogGamma_vv_75;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_76> AgradCcdfLogGamma_vv_76;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_77> AgradCcdfLogGamma_vv_77;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_78> AgradCcdfLogGamma_vv_78;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_79> AgradCcdfLogGamma_vv_79;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_80> AgradCcdfLogGamma_vv_80;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_81> AgradCcdfLogGamma_vv_81;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_82> AgradCcdfLogGamma_vv_82;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_83> AgradCcdfLogGamma_vv_83;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_84> AgradCcdfLogGamma_vv_84;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_85> AgradCcdfLogGamma_vv_85;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_86> AgradCcdfLogGamma_vv_86;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_87> AgradCcdfLogGamma_vv_87;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_88> AgradCcdfLogGamma_vv_88;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_89> AgradCcdfLogGamma_vv_89;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_90> AgradCcdfLogGamma_vv_90;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_91> AgradCcdfLogGamma_vv_91;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_92> AgradCcdfLogGamma_vv_92;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_93> AgradCcdfLogGamma_vv_93;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_94> AgradCcdfLogGamma_vv_94;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_95> AgradCcdfLogGamma_vv_95;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_96> AgradCcdfLogGamma_vv_96;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_97> AgradCcdfLogGamma_vv_97;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_98> AgradCcdfLogGamma_vv_98;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_99> AgradCcdfLogGamma_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_99);
+
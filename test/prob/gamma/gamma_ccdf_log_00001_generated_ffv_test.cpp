@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_100> AgradCcdfLogGamma_ffv_100;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_101> AgradCcdfLogGamma_ffv_101;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_102> AgradCcdfLogGamma_ffv_102;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_103> AgradCcdfLogGamma_ffv_103;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_104> AgradCcdfLogGamma_ffv_104;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_105> AgradCcdfLogGamma_ffv_105;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_106> AgradCcdfLogGamma_ffv_106;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_107> AgradCcdfLogGamma_ffv_107;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_108> AgradCcdfLogGamma_ffv_108;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_109> AgradCcdfLogGamma_ffv_109;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_110> AgradCcdfLogGamma_ffv_110;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_111> AgradCcdfLogGamma_ffv_111;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_112> AgradCcdfLogGamma_ffv_112;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_113> AgradCcdfLogGamma_ffv_113;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_114> AgradCcdfLogGamma_ffv_114;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_115> AgradCcdfLogGamma_ffv_115;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_116> AgradCcdfLogGamma_ffv_116;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_117> AgradCcdfLogGamma_ffv_117;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_118> AgradCcdfLogGamma_ffv_118;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_119> AgradCcdfLogGamma_ffv_119;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_120> AgradCcdfLogGamma_ffv_120;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_121> AgradCcdfLogGamma_ffv_121;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_122> AgradCcdfLogGamma_ffv_122;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_123> AgradCcdfLogGamma_ffv_123;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_124> AgradCcdfLogGamma_ffv_124;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_125> AgradCcdfLogGamma_ffv_125;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_126> AgradCcdfLogGamma_ffv_126;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_127> AgradCcdfLogGamma_ffv_127;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_128> AgradCcdfLogGamma_ffv_128;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_129> AgradCcdfLogGamma_ffv_129;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_130> AgradCcdfLogGamma_ffv_130;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_131> AgradCcdfLogGamma_ffv_131;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_132> AgradCcdfLogGamma_ffv_132;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_133> AgradCcdfLogGamma_ffv_133;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_134> AgradCcdfLogGamma_ffv_134;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_135> AgradCcdfLogGamma_ffv_135;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_136> AgradCcdfLogGamma_ffv_136;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_137> AgradCcdfLogGamma_ffv_137;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_138> AgradCcdfLogGamma_ffv_138;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_139> AgradCcdfLogGamma_ffv_139;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_140> AgradCcdfLogGamma_ffv_140;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_141> AgradCcdfLogGamma_ffv_141;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_142> AgradCcdfLogGamma_ffv_142;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_143> AgradCcdfLogGamma_ffv_143;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_144> AgradCcdfLogGamma_ffv_144;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_145> AgradCcdfLogGamma_ffv_145;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_146> AgradCcdfLogGamma_ffv_146;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_147> AgradCcdfLogGamma_ffv_147;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_148> AgradCcdfLogGamma_ffv_148;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_149> AgradCcdfLogGamma_ffv_149;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_150> AgradCcdfLogGamma_ffv_150;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_151> AgradCcdfLogGamma_ffv_151;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_152> AgradCcdfLogGamma_ffv_152;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_153> AgradCcdfLogGamma_ffv_153;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_154> AgradCcdfLogGamma_ffv_154;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_155> AgradCcdfLogGamma_ffv_155;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_156> AgradCcdfLogGamma_ffv_156;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_157> AgradCcdfLogGamma_ffv_157;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_158> AgradCcdfLogGamma_ffv_158;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_159> AgradCcdfLogGamma_ffv_159;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_160> AgradCcdfLogGamma_ffv_160;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_161> AgradCcdfLogGamma_ffv_161;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_162> AgradCcdfLogGamma_ffv_162;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_163> AgradCcdfLogGamma_ffv_163;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_164> AgradCcdfLogGamma_ffv_164;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_165> AgradCcdfLogGamma_ffv_165;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_166> AgradCcdfLogGamma_ffv_166;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_167> AgradCcdfLogGamma_ffv_167;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_168> AgradCcdfLogGamma_ffv_168;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_169> AgradCcdfLogGamma_ffv_169;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_170> AgradCcdfLogGamma_ffv_170;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_171> AgradCcdfLogGamma_ffv_171;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_172> AgradCcdfLogGamma_ffv_172;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_173> AgradCcdfLogGamma_ffv_173;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_174> AgradCcdfLogGamma_ffv_174;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_175> AgradCcdfLogGamma_ffv_175;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_176> AgradCcdfLogGamma_ffv_176;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_177> AgradCcdfLogGamma_ffv_177;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_178> AgradCcdfLogGamma_ffv_178;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_179> AgradCcdfLogGamma_ffv_179;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_180> AgradCcdfLogGamma_ffv_180;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_181> AgradCcdfLogGamma_ffv_181;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_182> AgradCcdfLogGamma_ffv_182;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_183> AgradCcdfLogGamma_ffv_183;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_184> AgradCcdfLogGamma_ffv_184;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_185> AgradCcdfLogGamma_ffv_185;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_186> AgradCcdfLogGamma_ffv_186;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_187> AgradCcdfLogGamma_ffv_187;
+typedef std::tuple<AgradCcdfLogGamma, type_ffv_188> AgradCcdfLogGamma_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogGamma_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogGamma, type_v_100> AgradCcdfLogGamma_v_100;
+typedef std::tuple<AgradCcdfLogGamma, type_v_101> AgradCcdfLogGamma_v_101;
+typedef std::tuple<AgradCcdfLogGamma, type_v_102> AgradCcdfLogGamma_v_102;
+typedef std::tuple<AgradCcdfLogGamma, type_v_103> AgradCcdfLogGamma_v_103;
+typedef std::tuple<AgradCcdfLogGamma, type_v_104> AgradCcdfLogGamma_v_104;
+typedef std::tuple<AgradCcdfLogGamma, type_v_105> AgradCcdfLogGamma_v_105;
+typedef std::tuple<AgradCcdfLogGamma, type_v_106> AgradCcdfLogGamma_v_106;
+typedef std::tuple<AgradCcdfLogGamma, type_v_107> AgradCcdfLogGamma_v_107;
+typedef std::tuple<AgradCcdfLogGamma, type_v_108> AgradCcdfLogGamma_v_108;
+typedef std::tuple<AgradCcdfLogGamma, type_v_109> AgradCcdfLogGamma_v_109;
+typedef std::tuple<AgradCcdfLogGamma, type_v_110> AgradCcdfLogGamma_v_110;
+typedef std::tuple<AgradCcdfLogGamma, type_v_111> AgradCcdfLogGamma_v_111;
+typedef std::tuple<AgradCcdfLogGamma, type_v_112> AgradCcdfLogGamma_v_112;
+typedef std::tuple<AgradCcdfLogGamma, type_v_113> AgradCcdfLogGamma_v_113;
+typedef std::tuple<AgradCcdfLogGamma, type_v_114> AgradCcdfLogGamma_v_114;
+typedef std::tuple<AgradCcdfLogGamma, type_v_115> AgradCcdfLogGamma_v_115;
+typedef std::tuple<AgradCcdfLogGamma, type_v_116> AgradCcdfLogGamma_v_116;
+typedef std::tuple<AgradCcdfLogGamma, type_v_117> AgradCcdfLogGamma_v_117;
+typedef std::tuple<AgradCcdfLogGamma, type_v_118> AgradCcdfLogGamma_v_118;
+typedef std::tuple<AgradCcdfLogGamma, type_v_119> AgradCcdfLogGamma_v_119;
+typedef std::tuple<AgradCcdfLogGamma, type_v_120> AgradCcdfLogGamma_v_120;
+typedef std::tuple<AgradCcdfLogGamma, type_v_121> AgradCcdfLogGamma_v_121;
+typedef std::tuple<AgradCcdfLogGamma, type_v_122> AgradCcdfLogGamma_v_122;
+typedef std::tuple<AgradCcdfLogGamma, type_v_123> AgradCcdfLogGamma_v_123;
+typedef std::tuple<AgradCcdfLogGamma, type_v_124> AgradCcdfLogGamma_v_124;
+typedef std::tuple<AgradCcdfLogGamma, type_v_125> AgradCcdfLogGamma_v_125;
+typedef std::tuple<AgradCcdfLogGamma, type_v_126> AgradCcdfLogGamma_v_126;
+typedef std::tuple<AgradCcdfLogGamma, type_v_127> AgradCcdfLogGamma_v_127;
+typedef std::tuple<AgradCcdfLogGamma, type_v_128> AgradCcdfLogGamma_v_128;
+typedef std::tuple<AgradCcdfLogGamma, type_v_129> AgradCcdfLogGamma_v_129;
+typedef std::tuple<AgradCcdfLogGamma, type_v_130> AgradCcdfLogGamma_v_130;
+typedef std::tuple<AgradCcdfLogGamma, type_v_131> AgradCcdfLogGamma_v_131;
+typedef std::tuple<AgradCcdfLogGamma, type_v_132> AgradCcdfLogGamma_v_132;
+typedef std::tuple<AgradCcdfLogGamma, type_v_133> AgradCcdfLogGamma_v_133;
+typedef std::tuple<AgradCcdfLogGamma, type_v_134> AgradCcdfLogGamma_v_134;
+typedef std::tuple<AgradCcdfLogGamma, type_v_135> AgradCcdfLogGamma_v_135;
+typedef std::tuple<AgradCcdfLogGamma, type_v_136> AgradCcdfLogGamma_v_136;
+typedef std::tuple<AgradCcdfLogGamma, type_v_137> AgradCcdfLogGamma_v_137;
+typedef std::tuple<AgradCcdfLogGamma, type_v_138> AgradCcdfLogGamma_v_138;
+typedef std::tuple<AgradCcdfLogGamma, type_v_139> AgradCcdfLogGamma_v_139;
+typedef std::tuple<AgradCcdfLogGamma, type_v_140> AgradCcdfLogGamma_v_140;
+typedef std::tuple<AgradCcdfLogGamma, type_v_141> AgradCcdfLogGamma_v_141;
+typedef std::tuple<AgradCcdfLogGamma, type_v_142> AgradCcdfLogGamma_v_142;
+typedef std::tuple<AgradCcdfLogGamma, type_v_143> AgradCcdfLogGamma_v_143;
+typedef std::tuple<AgradCcdfLogGamma, type_v_144> AgradCcdfLogGamma_v_144;
+typedef std::tuple<AgradCcdfLogGamma, type_v_145> AgradCcdfLogGamma_v_145;
+typedef std::tuple<AgradCcdfLogGamma, type_v_146> AgradCcdfLogGamma_v_146;
+typedef std::tuple<AgradCcdfLogGamma, type_v_147> AgradCcdfLogGamma_v_147;
+typedef std::tuple<AgradCcdfLogGamma, type_v_148> AgradCcdfLogGamma_v_148;
+typedef std::tuple<AgradCcdfLogGamma, type_v_149> AgradCcdfLogGamma_v_149;
+typedef std::tuple<AgradCcdfLogGamma, type_v_150> AgradCcdfLogGamma_v_150;
+typedef std::tuple<AgradCcdfLogGamma, type_v_151> AgradCcdfLogGamma_v_151;
+typedef std::tuple<AgradCcdfLogGamma, type_v_152> AgradCcdfLogGamma_v_152;
+typedef std::tuple<AgradCcdfLogGamma, type_v_153> AgradCcdfLogGamma_v_153;
+typedef std::tuple<AgradCcdfLogGamma, type_v_154> AgradCcdfLogGamma_v_154;
+typedef std::tuple<AgradCcdfLogGamma, type_v_155> AgradCcdfLogGamma_v_155;
+typedef std::tuple<AgradCcdfLogGamma, type_v_156> AgradCcdfLogGamma_v_156;
+typedef std::tuple<AgradCcdfLogGamma, type_v_157> AgradCcdfLogGamma_v_157;
+typedef std::tuple<AgradCcdfLogGamma, type_v_158> AgradCcdfLogGamma_v_158;
+typedef std::tuple<AgradCcdfLogGamma, type_v_159> AgradCcdfLogGamma_v_159;
+typedef std::tuple<AgradCcdfLogGamma, type_v_160> AgradCcdfLogGamma_v_160;
+typedef std::tuple<AgradCcdfLogGamma, type_v_161> AgradCcdfLogGamma_v_161;
+typedef std::tuple<AgradCcdfLogGamma, type_v_162> AgradCcdfLogGamma_v_162;
+typedef std::tuple<AgradCcdfLogGamma, type_v_163> AgradCcdfLogGamma_v_163;
+typedef std::tuple<AgradCcdfLogGamma, type_v_164> AgradCcdfLogGamma_v_164;
+typedef std::tuple<AgradCcdfLogGamma, type_v_165> AgradCcdfLogGamma_v_165;
+typedef std::tuple<AgradCcdfLogGamma, type_v_166> AgradCcdfLogGamma_v_166;
+typedef std::tuple<AgradCcdfLogGamma, type_v_167> AgradCcdfLogGamma_v_167;
+typedef std::tuple<AgradCcdfLogGamma, type_v_168> AgradCcdfLogGamma_v_168;
+typedef std::tuple<AgradCcdfLogGamma, type_v_169> AgradCcdfLogGamma_v_169;
+typedef std::tuple<AgradCcdfLogGamma, type_v_170> AgradCcdfLogGamma_v_170;
+typedef std::tuple<AgradCcdfLogGamma, type_v_171> AgradCcdfLogGamma_v_171;
+typedef std::tuple<AgradCcdfLogGamma, type_v_172> AgradCcdfLogGamma_v_172;
+typedef std::tuple<AgradCcdfLogGamma, type_v_173> AgradCcdfLogGamma_v_173;
+typedef std::tuple<AgradCcdfLogGamma, type_v_174> AgradCcdfLogGamma_v_174;
+typedef std::tuple<AgradCcdfLogGamma, type_v_175> AgradCcdfLogGamma_v_175;
+typedef std::tuple<AgradCcdfLogGamma, type_v_176> AgradCcdfLogGamma_v_176;
+typedef std::tuple<AgradCcdfLogGamma, type_v_177> AgradCcdfLogGamma_v_177;
+typedef std::tuple<AgradCcdfLogGamma, type_v_178> AgradCcdfLogGamma_v_178;
+typedef std::tuple<AgradCcdfLogGamma, type_v_179> AgradCcdfLogGamma_v_179;
+typedef std::tuple<AgradCcdfLogGamma, type_v_180> AgradCcdfLogGamma_v_180;
+typedef std::tuple<AgradCcdfLogGamma, type_v_181> AgradCcdfLogGamma_v_181;
+typedef std::tuple<AgradCcdfLogGamma, type_v_182> AgradCcdfLogGamma_v_182;
+typedef std::tuple<AgradCcdfLogGamma, type_v_183> AgradCcdfLogGamma_v_183;
+typedef std::tuple<AgradCcdfLogGamma, type_v_184> AgradCcdfLogGamma_v_184;
+typedef std::tuple<AgradCcdfLogGamma, type_v_185> AgradCcdfLogGamma_v_185;
+typedef std::tuple<AgradCcdfLogGamma, type_v_186> AgradCcdfLogGamma_v_186;
+typedef std::tuple<AgradCcdfLogGamma, type_v_187> AgradCcdfLogGamma_v_187;
+typedef std::tuple<AgradCcdfLogGamma, type_v_188> AgradCcdfLogGamma_v_188;
+typedef std::tuple<AgradCcdfLogGamma, type_v_189> AgradCcdfLogGamma_v_189;
+typedef std::tuple<AgradCcdfLogGamma, type_v_190> AgradCcdfLogGamma_v_190;
+typedef std::tuple<AgradCcdfLogGamma, type_v_191> AgradCcdfLogGamma_v_191;
+typedef std::tuple<AgradCcdfLogGamma, type_v_192> AgradCcdfLogGamma_v_192;
+typedef std::tuple<AgradCcdfLogGamma, type_v_193> AgradCcdfLogGamma_v_193;
+typedef std::tuple<AgradCcdfLogGamma, type_v_194> AgradCcdfLogGamma_v_194;
+typedef std::tuple<AgradCcdfLogGamma, type_v_195> AgradCcdfLogGamma_v_195;
+typedef std::tuple<AgradCcdfLogGamma, type_v_196> AgradCcdfLogGamma_v_196;
+typedef std::tuple<AgradCcdfLogGamma, type_v_197> AgradCcdfLogGamma_v_197;
+typedef std::tuple<AgradCcdfLogGamma, type_v_198> AgradCcdfLogGamma_v_198;
+typedef std::tuple<AgradCcdfLogGamma, type_v_199> AgradCcdfLogGamma_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_100, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_101, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_102, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_103, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_104, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_105, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_106, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_107, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_108, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_109, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_110, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_111, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_112, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_113, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_114, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_115, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_116, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_117, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_118, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_119, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_120, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_121, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_122, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_123, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_124, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_125, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_126, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_127, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_128, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_129, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_130, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_131, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_132, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_133, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_134, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_135, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_136, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_137, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_138, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_139, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_140, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_141, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_142, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_143, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_144, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_145, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_146, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_147, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_148, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_149, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_150, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_151, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_152, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_153, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_154, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_155, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_156, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_157, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_158, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_159, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_160, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_161, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_162, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_163, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_164, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_165, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_166, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_167, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_168, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_169, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_170, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_171, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_172, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_173, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_174, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_175, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_176, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_177, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_178, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_179, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_180, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_181, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_182, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_183, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_184, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_185, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_186, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_187, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_188, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_189, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_190, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_191, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_192, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_193, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_194, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_195, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_196, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_197, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_198, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_199, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogGamma, type_vv_100> AgradCcdfLogGamma_vv_100;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_101> AgradCcdfLogGamma_vv_101;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_102> AgradCcdfLogGamma_vv_102;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_103> AgradCcdfLogGamma_vv_103;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_104> AgradCcdfLogGamma_vv_104;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_105> AgradCcdfLogGamma_vv_105;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_106> AgradCcdfLogGamma_vv_106;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_107> AgradCcdfLogGamma_vv_107;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_108> AgradCcdfLogGamma_vv_108;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_109> AgradCcdfLogGamma_vv_109;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_110> AgradCcdfLogGamma_vv_110;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_111> AgradCcdfLogGamma_vv_111;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_112> AgradCcdfLogGamma_vv_112;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_113> AgradCcdfLogGamma_vv_113;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_114> AgradCcdfLogGamma_vv_114;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_115> AgradCcdfLogGamma_vv_115;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_116> AgradCcdfLogGamma_vv_116;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_117> AgradCcdfLogGamma_vv_117;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_118> AgradCcdfLogGamma_vv_118;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_119> AgradCcdfLogGamma_vv_119;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_120> AgradCcdfLogGamma_vv_120;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_121> AgradCcdfLogGamma_vv_121;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_122> AgradCcdfLogGamma_vv_122;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_123> AgradCcdfLogGamma_vv_123;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_124> AgradCcdfLogGamma_vv_124;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_125> AgradCcdfLogGamma_vv_125;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_126> AgradCcdfLogGamma_vv_126;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_127> AgradCcdfLogGamma_vv_127;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_128> AgradCcdfLogGamma_vv_128;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_129> AgradCcdfLogGamma_vv_129;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_130> AgradCcdfLogGamma_vv_130;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_131> AgradCcdfLogGamma_vv_131;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_132> AgradCcdfLogGamma_vv_132;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_133> AgradCcdfLogGamma_vv_133;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_134> AgradCcdfLogGamma_vv_134;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_135> AgradCcdfLogGamma_vv_135;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_136> AgradCcdfLogGamma_vv_136;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_137> AgradCcdfLogGamma_vv_137;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_138> AgradCcdfLogGamma_vv_138;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_139> AgradCcdfLogGamma_vv_139;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_140> AgradCcdfLogGamma_vv_140;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_141> AgradCcdfLogGamma_vv_141;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_142> AgradCcdfLogGamma_vv_142;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_143> AgradCcdfLogGamma_vv_143;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_144> AgradCcdfLogGamma_vv_144;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_145> AgradCcdfLogGamma_vv_145;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_146> AgradCcdfLogGamma_vv_146;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_147> AgradCcdfLogGamma_vv_147;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_148> AgradCcdfLogGamma_vv_148;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_149> AgradCcdfLogGamma_vv_149;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_150> AgradCcdfLogGamma_vv_150;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_151> AgradCcdfLogGamma_vv_151;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_152> AgradCcdfLogGamma_vv_152;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_153> AgradCcdfLogGamma_vv_153;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_154> AgradCcdfLogGamma_vv_154;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_155> AgradCcdfLogGamma_vv_155;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_156> AgradCcdfLogGamma_vv_156;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_157> AgradCcdfLogGamma_vv_157;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_158> AgradCcdfLogGamma_vv_158;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_159> AgradCcdfLogGamma_vv_159;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_160> AgradCcdfLogGamma_vv_160;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_161> AgradCcdfLogGamma_vv_161;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_162> AgradCcdfLogGamma_vv_162;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_163> AgradCcdfLogGamma_vv_163;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_164> AgradCcdfLogGamma_vv_164;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_165> AgradCcdfLogGamma_vv_165;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_166> AgradCcdfLogGamma_vv_166;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_167> AgradCcdfLogGamma_vv_167;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_168> AgradCcdfLogGamma_vv_168;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_169> AgradCcdfLogGamma_vv_169;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_170> AgradCcdfLogGamma_vv_170;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_171> AgradCcdfLogGamma_vv_171;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_172> AgradCcdfLogGamma_vv_172;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_173> AgradCcdfLogGamma_vv_173;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_174> AgradCcdfLogGamma_vv_174;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_175> AgradCcdfLogGamma_vv_175;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_176> AgradCcdfLogGamma_vv_176;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_177> AgradCcdfLogGamma_vv_177;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_178> AgradCcdfLogGamma_vv_178;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_179> AgradCcdfLogGamma_vv_179;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_180> AgradCcdfLogGamma_vv_180;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_181> AgradCcdfLogGamma_vv_181;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_182> AgradCcdfLogGamma_vv_182;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_183> AgradCcdfLogGamma_vv_183;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_184> AgradCcdfLogGamma_vv_184;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_185> AgradCcdfLogGamma_vv_185;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_186> AgradCcdfLogGamma_vv_186;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_187> AgradCcdfLogGamma_vv_187;
+typedef std::tuple<AgradCcdfLogGamma, type_vv_188> AgradCcdfLogGamma_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogGamma_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCcdfLogGamma, type_v_200> AgradCcdfLogGamma_v_200;
+typedef std::tuple<AgradCcdfLogGamma, type_v_201> AgradCcdfLogGamma_v_201;
+typedef std::tuple<AgradCcdfLogGamma, type_v_202> AgradCcdfLogGamma_v_202;
+typedef std::tuple<AgradCcdfLogGamma, type_v_203> AgradCcdfLogGamma_v_203;
+typedef std::tuple<AgradCcdfLogGamma, type_v_204> AgradCcdfLogGamma_v_204;
+typedef std::tuple<AgradCcdfLogGamma, type_v_205> AgradCcdfLogGamma_v_205;
+typedef std::tuple<AgradCcdfLogGamma, type_v_206> AgradCcdfLogGamma_v_206;
+typedef std::tuple<AgradCcdfLogGamma, type_v_207> AgradCcdfLogGamma_v_207;
+typedef std::tuple<AgradCcdfLogGamma, type_v_208> AgradCcdfLogGamma_v_208;
+typedef std::tuple<AgradCcdfLogGamma, type_v_209> AgradCcdfLogGamma_v_209;
+typedef std::tuple<AgradCcdfLogGamma, type_v_210> AgradCcdfLogGamma_v_210;
+typedef std::tuple<AgradCcdfLogGamma, type_v_211> AgradCcdfLogGamma_v_211;
+typedef std::tuple<AgradCcdfLogGamma, type_v_212> AgradCcdfLogGamma_v_212;
+typedef std::tuple<AgradCcdfLogGamma, type_v_213> AgradCcdfLogGamma_v_213;
+typedef std::tuple<AgradCcdfLogGamma, type_v_214> AgradCcdfLogGamma_v_214;
+typedef std::tuple<AgradCcdfLogGamma, type_v_215> AgradCcdfLogGamma_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_200, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_201, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_202, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_203, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_204, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_205, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_206, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_207, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_208, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_209, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_210, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_211, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_212, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_213, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_214, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGamma_v_215, AgradCcdfLogTestFixture, AgradCcdfLogGamma_v_215);
+
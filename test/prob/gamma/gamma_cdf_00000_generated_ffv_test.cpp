@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfGamma, type_ffv_0> AgradCdfGamma_ffv_0;
+typedef std::tuple<AgradCdfGamma, type_ffv_1> AgradCdfGamma_ffv_1;
+typedef std::tuple<AgradCdfGamma, type_ffv_2> AgradCdfGamma_ffv_2;
+typedef std::tuple<AgradCdfGamma, type_ffv_3> AgradCdfGamma_ffv_3;
+typedef std::tuple<AgradCdfGamma, type_ffv_4> AgradCdfGamma_ffv_4;
+typedef std::tuple<AgradCdfGamma, type_ffv_5> AgradCdfGamma_ffv_5;
+typedef std::tuple<AgradCdfGamma, type_ffv_6> AgradCdfGamma_ffv_6;
+typedef std::tuple<AgradCdfGamma, type_ffv_7> AgradCdfGamma_ffv_7;
+typedef std::tuple<AgradCdfGamma, type_ffv_8> AgradCdfGamma_ffv_8;
+typedef std::tuple<AgradCdfGamma, type_ffv_9> AgradCdfGamma_ffv_9;
+typedef std::tuple<AgradCdfGamma, type_ffv_10> AgradCdfGamma_ffv_10;
+typedef std::tuple<AgradCdfGamma, type_ffv_11> AgradCdfGamma_ffv_11;
+typedef std::tuple<AgradCdfGamma, type_ffv_12> AgradCdfGamma_ffv_12;
+typedef std::tuple<AgradCdfGamma, type_ffv_13> AgradCdfGamma_ffv_13;
+typedef std::tuple<AgradCdfGamma, type_ffv_14> AgradCdfGamma_ffv_14;
+typedef std::tuple<AgradCdfGamma, type_ffv_15> AgradCdfGamma_ffv_15;
+typedef std::tuple<AgradCdfGamma, type_ffv_16> AgradCdfGamma_ffv_16;
+typedef std::tuple<AgradCdfGamma, type_ffv_17> AgradCdfGamma_ffv_17;
+typedef std::tuple<AgradCdfGamma, type_ffv_18> AgradCdfGamma_ffv_18;
+typedef std::tuple<AgradCdfGamma, type_ffv_19> AgradCdfGamma_ffv_19;
+typedef std::tuple<AgradCdfGamma, type_ffv_20> AgradCdfGamma_ffv_20;
+typedef std::tuple<AgradCdfGamma, type_ffv_21> AgradCdfGamma_ffv_21;
+typedef std::tuple<AgradCdfGamma, type_ffv_22> AgradCdfGamma_ffv_22;
+typedef std::tuple<AgradCdfGamma, type_ffv_23> AgradCdfGamma_ffv_23;
+typedef std::tuple<AgradCdfGamma, type_ffv_24> AgradCdfGamma_ffv_24;
+typedef std::tuple<AgradCdfGamma, type_ffv_25> AgradCdfGamma_ffv_25;
+typedef std::tuple<AgradCdfGamma, type_ffv_26> AgradCdfGamma_ffv_26;
+typedef std::tuple<AgradCdfGamma, type_ffv_27> AgradCdfGamma_ffv_27;
+typedef std::tuple<AgradCdfGamma, type_ffv_28> AgradCdfGamma_ffv_28;
+typedef std::tuple<AgradCdfGamma, type_ffv_29> AgradCdfGamma_ffv_29;
+typedef std::tuple<AgradCdfGamma, type_ffv_30> AgradCdfGamma_ffv_30;
+typedef std::tuple<AgradCdfGamma, type_ffv_31> AgradCdfGamma_ffv_31;
+typedef std::tuple<AgradCdfGamma, type_ffv_32> AgradCdfGamma_ffv_32;
+typedef std::tuple<AgradCdfGamma, type_ffv_33> AgradCdfGamma_ffv_33;
+typedef std::tuple<AgradCdfGamma, type_ffv_34> AgradCdfGamma_ffv_34;
+typedef std::tuple<AgradCdfGamma, type_ffv_35> AgradCdfGamma_ffv_35;
+typedef std::tuple<AgradCdfGamma, type_ffv_36> AgradCdfGamma_ffv_36;
+typedef std::tuple<AgradCdfGamma, type_ffv_37> AgradCdfGamma_ffv_37;
+typedef std::tuple<AgradCdfGamma, type_ffv_38> AgradCdfGamma_ffv_38;
+typedef std::tuple<AgradCdfGamma, type_ffv_39> AgradCdfGamma_ffv_39;
+typedef std::tuple<AgradCdfGamma, type_ffv_40> AgradCdfGamma_ffv_40;
+typedef std::tuple<AgradCdfGamma, type_ffv_41> AgradCdfGamma_ffv_41;
+typedef std::tuple<AgradCdfGamma, type_ffv_42> AgradCdfGamma_ffv_42;
+typedef std::tuple<AgradCdfGamma, type_ffv_43> AgradCdfGamma_ffv_43;
+typedef std::tuple<AgradCdfGamma, type_ffv_44> AgradCdfGamma_ffv_44;
+typedef std::tuple<AgradCdfGamma, type_ffv_45> AgradCdfGamma_ffv_45;
+typedef std::tuple<AgradCdfGamma, type_ffv_46> AgradCdfGamma_ffv_46;
+typedef std::tuple<AgradCdfGamma, type_ffv_47> AgradCdfGamma_ffv_47;
+typedef std::tuple<AgradCdfGamma, type_ffv_48> AgradCdfGamma_ffv_48;
+typedef std::tuple<AgradCdfGamma, type_ffv_49> AgradCdfGamma_ffv_49;
+typedef std::tuple<AgradCdfGamma, type_ffv_50> AgradCdfGamma_ffv_50;
+typedef std::tuple<AgradCdfGamma, type_ffv_51> AgradCdfGamma_ffv_51;
+typedef std::tuple<AgradCdfGamma, type_ffv_52> AgradCdfGamma_ffv_52;
+typedef std::tuple<AgradCdfGamma, type_ffv_53> AgradCdfGamma_ffv_53;
+typedef std::tuple<AgradCdfGamma, type_ffv_54> AgradCdfGamma_ffv_54;
+typedef std::tuple<AgradCdfGamma, type_ffv_55> AgradCdfGamma_ffv_55;
+typedef std::tuple<AgradCdfGamma, type_ffv_56> AgradCdfGamma_ffv_56;
+typedef std::tuple<AgradCdfGamma, type_ffv_57> AgradCdfGamma_ffv_57;
+typedef std::tuple<AgradCdfGamma, type_ffv_58> AgradCdfGamma_ffv_58;
+typedef std::tuple<AgradCdfGamma, type_ffv_59> AgradCdfGamma_ffv_59;
+typedef std::tuple<AgradCdfGamma, type_ffv_60> AgradCdfGamma_ffv_60;
+typedef std::tuple<AgradCdfGamma, type_ffv_61> AgradCdfGamma_ffv_61;
+typedef std::tuple<AgradCdfGamma, type_ffv_62> AgradCdfGamma_ffv_62;
+typedef std::tuple<AgradCdfGamma, type_ffv_63> AgradCdfGamma_ffv_63;
+typedef std::tuple<AgradCdfGamma, type_ffv_64> AgradCdfGamma_ffv_64;
+typedef std::tuple<AgradCdfGamma, type_ffv_65> AgradCdfGamma_ffv_65;
+typedef std::tuple<AgradCdfGamma, type_ffv_66> AgradCdfGamma_ffv_66;
+typedef std::tuple<AgradCdfGamma, type_ffv_67> AgradCdfGamma_ffv_67;
+typedef std::tuple<AgradCdfGamma, type_ffv_68> AgradCdfGamma_ffv_68;
+typedef std::tuple<AgradCdfGamma, type_ffv_69> AgradCdfGamma_ffv_69;
+typedef std::tuple<AgradCdfGamma, type_ffv_70> AgradCdfGamma_ffv_70;
+typedef std::tuple<AgradCdfGamma, type_ffv_71> AgradCdfGamma_ffv_71;
+typedef std::tuple<AgradCdfGamma, type_ffv_72> AgradCdfGamma_ffv_72;
+typedef std::tuple<AgradCdfGamma, type_ffv_73> AgradCdfGamma_ffv_73;
+typedef std::tuple<AgradCdfGamma, type_ffv_74> AgradCdfGamma_ffv_74;
+typedef std::tuple<AgradCdfGamma, type_ffv_75> AgradCdfGamma_ffv_75;
+typedef std::tuple<AgradCdfGamma, type_ffv_76> AgradCdfGamma_ffv_76;
+typedef std::tuple<AgradCdfGamma, type_ffv_77> AgradCdfGamma_ffv_77;
+typedef std::tuple<AgradCdfGamma, type_ffv_78> AgradCdfGamma_ffv_78;
+typedef std::tuple<AgradCdfGamma, type_ffv_79> AgradCdfGamma_ffv_79;
+typedef std::tuple<AgradCdfGamma, type_ffv_80> AgradCdfGamma_ffv_80;
+typedef std::tuple<AgradCdfGamma, type_ffv_81> AgradCdfGamma_ffv_81;
+typedef std::tuple<AgradCdfGamma, type_ffv_82> AgradCdfGamma_ffv_82;
+typedef std::tuple<AgradCdfGamma, type_ffv_83> AgradCdfGamma_ffv_83;
+typedef std::tuple<AgradCdfGamma, type_ffv_84> AgradCdfGamma_ffv_84;
+typedef std::tuple<AgradCdfGamma, type_ffv_85> AgradCdfGamma_ffv_85;
+typedef std::tuple<AgradCdfGamma, type_ffv_86> AgradCdfGamma_ffv_86;
+typedef std::tuple<AgradCdfGamma, type_ffv_87> AgradCdfGamma_ffv_87;
+typedef std::tuple<AgradCdfGamma, type_ffv_88> AgradCdfGamma_ffv_88;
+typedef std::tuple<AgradCdfGamma, type_ffv_89> AgradCdfGamma_ffv_89;
+typedef std::tuple<AgradCdfGamma, type_ffv_90> AgradCdfGamma_ffv_90;
+typedef std::tuple<AgradCdfGamma, type_ffv_91> AgradCdfGamma_ffv_91;
+typedef std::tuple<AgradCdfGamma, type_ffv_92> AgradCdfGamma_ffv_92;
+typedef std::tuple<AgradCdfGamma, type_ffv_93> AgradCdfGamma_ffv_93;
+typedef std::tuple<AgradCdfGamma, type_ffv_94> AgradCdfGamma_ffv_94;
+typedef std::tuple<AgradCdfGamma, type_ffv_95> AgradCdfGamma_ffv_95;
+typedef std::tuple<AgradCdfGamma, type_ffv_96> AgradCdfGamma_ffv_96;
+typedef std::tuple<AgradCdfGamma, type_ffv_97> AgradCdfGamma_ffv_97;
+typedef std::tuple<AgradCdfGamma, type_ffv_98> AgradCdfGamma_ffv_98;
+typedef std::tuple<AgradCdfGamma, type_ffv_99> AgradCdfGamma_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_0, AgradCdfTestFixture, AgradCdfGamma_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_1, AgradCdfTestFixture, AgradCdfGamma_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_2, AgradCdfTestFixture, AgradCdfGamma_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_3, AgradCdfTestFixture, AgradCdfGamma_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_4, AgradCdfTestFixture, AgradCdfGamma_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_5, AgradCdfTestFixture, AgradCdfGamma_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_6, AgradCdfTestFixture, AgradCdfGamma_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_7, AgradCdfTestFixture, AgradCdfGamma_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_8, AgradCdfTestFixture, AgradCdfGamma_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_9, AgradCdfTestFixture, AgradCdfGamma_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_10, AgradCdfTestFixture, AgradCdfGamma_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_11, AgradCdfTestFixture, AgradCdfGamma_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_12, AgradCdfTestFixture, AgradCdfGamma_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_13, AgradCdfTestFixture, AgradCdfGamma_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_14, AgradCdfTestFixture, AgradCdfGamma_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_15, AgradCdfTestFixture, AgradCdfGamma_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_16, AgradCdfTestFixture, AgradCdfGamma_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_17, AgradCdfTestFixture, AgradCdfGamma_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_18, AgradCdfTestFixture, AgradCdfGamma_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_19, AgradCdfTestFixture, AgradCdfGamma_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_20, AgradCdfTestFixture, AgradCdfGamma_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_21, AgradCdfTestFixture, AgradCdfGamma_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_22, AgradCdfTestFixture, AgradCdfGamma_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_23, AgradCdfTestFixture, AgradCdfGamma_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_24, AgradCdfTestFixture, AgradCdfGamma_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_25, AgradCdfTestFixture, AgradCdfGamma_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_26, AgradCdfTestFixture, AgradCdfGamma_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_27, AgradCdfTestFixture, AgradCdfGamma_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_28, AgradCdfTestFixture, AgradCdfGamma_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_29, AgradCdfTestFixture, AgradCdfGamma_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_30, AgradCdfTestFixture, AgradCdfGamma_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_31, AgradCdfTestFixture, AgradCdfGamma_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_32, AgradCdfTestFixture, AgradCdfGamma_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_33, AgradCdfTestFixture, AgradCdfGamma_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_34, AgradCdfTestFixture, AgradCdfGamma_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_35, AgradCdfTestFixture, AgradCdfGamma_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_36, AgradCdfTestFixture, AgradCdfGamma_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_37, AgradCdfTestFixture, AgradCdfGamma_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_38, AgradCdfTestFixture, AgradCdfGamma_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_39, AgradCdfTestFixture, AgradCdfGamma_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_40, AgradCdfTestFixture, AgradCdfGamma_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_41, AgradCdfTestFixture, AgradCdfGamma_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_42, AgradCdfTestFixture, AgradCdfGamma_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_43, AgradCdfTestFixture, AgradCdfGamma_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_44, AgradCdfTestFixture, AgradCdfGamma_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_45, AgradCdfTestFixture, AgradCdfGamma_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_46, AgradCdfTestFixture, AgradCdfGamma_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_47, AgradCdfTestFixture, AgradCdfGamma_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_48, AgradCdfTestFixture, AgradCdfGamma_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_49, AgradCdfTestFixture, AgradCdfGamma_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_50, AgradCdfTestFixture, AgradCdfGamma_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_51, AgradCdfTestFixture, AgradCdfGamma_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_52, AgradCdfTestFixture, AgradCdfGamma_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_53, AgradCdfTestFixture, AgradCdfGamma_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_54, AgradCdfTestFixture, AgradCdfGamma_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_55, AgradCdfTestFixture, AgradCdfGamma_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_56, AgradCdfTestFixture, AgradCdfGamma_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_57, AgradCdfTestFixture, AgradCdfGamma_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_58, AgradCdfTestFixture, AgradCdfGamma_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_59, AgradCdfTestFixture, AgradCdfGamma_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_60, AgradCdfTestFixture, AgradCdfGamma_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_61, AgradCdfTestFixture, AgradCdfGamma_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_62, AgradCdfTestFixture, AgradCdfGamma_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_63, AgradCdfTestFixture, AgradCdfGamma_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_64, AgradCdfTestFixture, AgradCdfGamma_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_65, AgradCdfTestFixture, AgradCdfGamma_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_66, AgradCdfTestFixture, AgradCdfGamma_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_67, AgradCdfTestFixture, AgradCdfGamma_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_68, AgradCdfTestFixture, AgradCdfGamma_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_69, AgradCdfTestFixture, AgradCdfGamma_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_70, AgradCdfTestFixture, AgradCdfGamma_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_71, AgradCdfTestFixture, AgradCdfGamma_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_72, AgradCdfTestFixture, AgradCdfGamma_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_73, AgradCdfTestFixture, AgradCdfGamma_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_74, AgradCdfTestFixture, AgradCdfGamma_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_75, AgradCdfTestFixture, AgradCdfGamma_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_76, AgradCdfTestFixture, AgradCdfGamma_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_77, AgradCdfTestFixture, AgradCdfGamma_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_78, AgradCdfTestFixture, AgradCdfGamma_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_79, AgradCdfTestFixture, AgradCdfGamma_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_80, AgradCdfTestFixture, AgradCdfGamma_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_81, AgradCdfTestFixture, AgradCdfGamma_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_82, AgradCdfTestFixture, AgradCdfGamma_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_83, AgradCdfTestFixture, AgradCdfGamma_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_84, AgradCdfTestFixture, AgradCdfGamma_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_85, AgradCdfTestFixture, AgradCdfGamma_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_86, AgradCdfTestFixture, AgradCdfGamma_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_87, AgradCdfTestFixture, AgradCdfGamma_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_88, AgradCdfTestFixture, AgradCdfGamma_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_89, AgradCdfTestFixture, AgradCdfGamma_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_90, AgradCdfTestFixture, AgradCdfGamma_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_91, AgradCdfTestFixture, AgradCdfGamma_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_92, AgradCdfTestFixture, AgradCdfGamma_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_93, AgradCdfTestFixture, AgradCdfGamma_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_94, AgradCdfTestFixture, AgradCdfGamma_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_95, AgradCdfTestFixture, AgradCdfGamma_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_96, AgradCdfTestFixture, AgradCdfGamma_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_97, AgradCdfTestFixture, AgradCdfGamma_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_98, AgradCdfTestFixture, AgradCdfGamma_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_99, AgradCdfTestFixture, AgradCdfGamma_ffv_99);
+
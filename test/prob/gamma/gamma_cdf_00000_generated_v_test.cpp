@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfGamma, type_v_0> AgradCdfGamma_v_0;
+typedef std::tuple<AgradCdfGamma, type_v_1> AgradCdfGamma_v_1;
+typedef std::tuple<AgradCdfGamma, type_v_2> AgradCdfGamma_v_2;
+typedef std::tuple<AgradCdfGamma, type_v_3> AgradCdfGamma_v_3;
+typedef std::tuple<AgradCdfGamma, type_v_4> AgradCdfGamma_v_4;
+typedef std::tuple<AgradCdfGamma, type_v_5> AgradCdfGamma_v_5;
+typedef std::tuple<AgradCdfGamma, type_v_6> AgradCdfGamma_v_6;
+typedef std::tuple<AgradCdfGamma, type_v_7> AgradCdfGamma_v_7;
+typedef std::tuple<AgradCdfGamma, type_v_8> AgradCdfGamma_v_8;
+typedef std::tuple<AgradCdfGamma, type_v_9> AgradCdfGamma_v_9;
+typedef std::tuple<AgradCdfGamma, type_v_10> AgradCdfGamma_v_10;
+typedef std::tuple<AgradCdfGamma, type_v_11> AgradCdfGamma_v_11;
+typedef std::tuple<AgradCdfGamma, type_v_12> AgradCdfGamma_v_12;
+typedef std::tuple<AgradCdfGamma, type_v_13> AgradCdfGamma_v_13;
+typedef std::tuple<AgradCdfGamma, type_v_14> AgradCdfGamma_v_14;
+typedef std::tuple<AgradCdfGamma, type_v_15> AgradCdfGamma_v_15;
+typedef std::tuple<AgradCdfGamma, type_v_16> AgradCdfGamma_v_16;
+typedef std::tuple<AgradCdfGamma, type_v_17> AgradCdfGamma_v_17;
+typedef std::tuple<AgradCdfGamma, type_v_18> AgradCdfGamma_v_18;
+typedef std::tuple<AgradCdfGamma, type_v_19> AgradCdfGamma_v_19;
+typedef std::tuple<AgradCdfGamma, type_v_20> AgradCdfGamma_v_20;
+typedef std::tuple<AgradCdfGamma, type_v_21> AgradCdfGamma_v_21;
+typedef std::tuple<AgradCdfGamma, type_v_22> AgradCdfGamma_v_22;
+typedef std::tuple<AgradCdfGamma, type_v_23> AgradCdfGamma_v_23;
+typedef std::tuple<AgradCdfGamma, type_v_24> AgradCdfGamma_v_24;
+typedef std::tuple<AgradCdfGamma, type_v_25> AgradCdfGamma_v_25;
+typedef std::tuple<AgradCdfGamma, type_v_26> AgradCdfGamma_v_26;
+typedef std::tuple<AgradCdfGamma, type_v_27> AgradCdfGamma_v_27;
+typedef std::tuple<AgradCdfGamma, type_v_28> AgradCdfGamma_v_28;
+typedef std::tuple<AgradCdfGamma, type_v_29> AgradCdfGamma_v_29;
+typedef std::tuple<AgradCdfGamma, type_v_30> AgradCdfGamma_v_30;
+typedef std::tuple<AgradCdfGamma, type_v_31> AgradCdfGamma_v_31;
+typedef std::tuple<AgradCdfGamma, type_v_32> AgradCdfGamma_v_32;
+typedef std::tuple<AgradCdfGamma, type_v_33> AgradCdfGamma_v_33;
+typedef std::tuple<AgradCdfGamma, type_v_34> AgradCdfGamma_v_34;
+typedef std::tuple<AgradCdfGamma, type_v_35> AgradCdfGamma_v_35;
+typedef std::tuple<AgradCdfGamma, type_v_36> AgradCdfGamma_v_36;
+typedef std::tuple<AgradCdfGamma, type_v_37> AgradCdfGamma_v_37;
+typedef std::tuple<AgradCdfGamma, type_v_38> AgradCdfGamma_v_38;
+typedef std::tuple<AgradCdfGamma, type_v_39> AgradCdfGamma_v_39;
+typedef std::tuple<AgradCdfGamma, type_v_40> AgradCdfGamma_v_40;
+typedef std::tuple<AgradCdfGamma, type_v_41> AgradCdfGamma_v_41;
+typedef std::tuple<AgradCdfGamma, type_v_42> AgradCdfGamma_v_42;
+typedef std::tuple<AgradCdfGamma, type_v_43> AgradCdfGamma_v_43;
+typedef std::tuple<AgradCdfGamma, type_v_44> AgradCdfGamma_v_44;
+typedef std::tuple<AgradCdfGamma, type_v_45> AgradCdfGamma_v_45;
+typedef std::tuple<AgradCdfGamma, type_v_46> AgradCdfGamma_v_46;
+typedef std::tuple<AgradCdfGamma, type_v_47> AgradCdfGamma_v_47;
+typedef std::tuple<AgradCdfGamma, type_v_48> AgradCdfGamma_v_48;
+typedef std::tuple<AgradCdfGamma, type_v_49> AgradCdfGamma_v_49;
+typedef std::tuple<AgradCdfGamma, type_v_50> AgradCdfGamma_v_50;
+typedef std::tuple<AgradCdfGamma, type_v_51> AgradCdfGamma_v_51;
+typedef std::tuple<AgradCdfGamma, type_v_52> AgradCdfGamma_v_52;
+typedef std::tuple<AgradCdfGamma, type_v_53> AgradCdfGamma_v_53;
+typedef std::tuple<AgradCdfGamma, type_v_54> AgradCdfGamma_v_54;
+typedef std::tuple<AgradCdfGamma, type_v_55> AgradCdfGamma_v_55;
+typedef std::tuple<AgradCdfGamma, type_v_56> AgradCdfGamma_v_56;
+typedef std::tuple<AgradCdfGamma, type_v_57> AgradCdfGamma_v_57;
+typedef std::tuple<AgradCdfGamma, type_v_58> AgradCdfGamma_v_58;
+typedef std::tuple<AgradCdfGamma, type_v_59> AgradCdfGamma_v_59;
+typedef std::tuple<AgradCdfGamma, type_v_60> AgradCdfGamma_v_60;
+typedef std::tuple<AgradCdfGamma, type_v_61> AgradCdfGamma_v_61;
+typedef std::tuple<AgradCdfGamma, type_v_62> AgradCdfGamma_v_62;
+typedef std::tuple<AgradCdfGamma, type_v_63> AgradCdfGamma_v_63;
+typedef std::tuple<AgradCdfGamma, type_v_64> AgradCdfGamma_v_64;
+typedef std::tuple<AgradCdfGamma, type_v_65> AgradCdfGamma_v_65;
+typedef std::tuple<AgradCdfGamma, type_v_66> AgradCdfGamma_v_66;
+typedef std::tuple<AgradCdfGamma, type_v_67> AgradCdfGamma_v_67;
+typedef std::tuple<AgradCdfGamma, type_v_68> AgradCdfGamma_v_68;
+typedef std::tuple<AgradCdfGamma, type_v_69> AgradCdfGamma_v_69;
+typedef std::tuple<AgradCdfGamma, type_v_70> AgradCdfGamma_v_70;
+typedef std::tuple<AgradCdfGamma, type_v_71> AgradCdfGamma_v_71;
+typedef std::tuple<AgradCdfGamma, type_v_72> AgradCdfGamma_v_72;
+typedef std::tuple<AgradCdfGamma, type_v_73> AgradCdfGamma_v_73;
+typedef std::tuple<AgradCdfGamma, type_v_74> AgradCdfGamma_v_74;
+typedef std::tuple<AgradCdfGamma, type_v_75> AgradCdfGamma_v_75;
+typedef std::tuple<AgradCdfGamma, type_v_76> AgradCdfGamma_v_76;
+typedef std::tuple<AgradCdfGamma, type_v_77> AgradCdfGamma_v_77;
+typedef std::tuple<AgradCdfGamma, type_v_78> AgradCdfGamma_v_78;
+typedef std::tuple<AgradCdfGamma, type_v_79> AgradCdfGamma_v_79;
+typedef std::tuple<AgradCdfGamma, type_v_80> AgradCdfGamma_v_80;
+typedef std::tuple<AgradCdfGamma, type_v_81> AgradCdfGamma_v_81;
+typedef std::tuple<AgradCdfGamma, type_v_82> AgradCdfGamma_v_82;
+typedef std::tuple<AgradCdfGamma, type_v_83> AgradCdfGamma_v_83;
+typedef std::tuple<AgradCdfGamma, type_v_84> AgradCdfGamma_v_84;
+typedef std::tuple<AgradCdfGamma, type_v_85> AgradCdfGamma_v_85;
+typedef std::tuple<AgradCdfGamma, type_v_86> AgradCdfGamma_v_86;
+typedef std::tuple<AgradCdfGamma, type_v_87> AgradCdfGamma_v_87;
+typedef std::tuple<AgradCdfGamma, type_v_88> AgradCdfGamma_v_88;
+typedef std::tuple<AgradCdfGamma, type_v_89> AgradCdfGamma_v_89;
+typedef std::tuple<AgradCdfGamma, type_v_90> AgradCdfGamma_v_90;
+typedef std::tuple<AgradCdfGamma, type_v_91> AgradCdfGamma_v_91;
+typedef std::tuple<AgradCdfGamma, type_v_92> AgradCdfGamma_v_92;
+typedef std::tuple<AgradCdfGamma, type_v_93> AgradCdfGamma_v_93;
+typedef std::tuple<AgradCdfGamma, type_v_94> AgradCdfGamma_v_94;
+typedef std::tuple<AgradCdfGamma, type_v_95> AgradCdfGamma_v_95;
+typedef std::tuple<AgradCdfGamma, type_v_96> AgradCdfGamma_v_96;
+typedef std::tuple<AgradCdfGamma, type_v_97> AgradCdfGamma_v_97;
+typedef std::tuple<AgradCdfGamma, type_v_98> AgradCdfGamma_v_98;
+typedef std::tuple<AgradCdfGamma, type_v_99> AgradCdfGamma_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_0, AgradCdfTestFixture, AgradCdfGamma_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_1, AgradCdfTestFixture, AgradCdfGamma_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_2, AgradCdfTestFixture, AgradCdfGamma_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_3, AgradCdfTestFixture, AgradCdfGamma_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_4, AgradCdfTestFixture, AgradCdfGamma_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_5, AgradCdfTestFixture, AgradCdfGamma_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_6, AgradCdfTestFixture, AgradCdfGamma_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_7, AgradCdfTestFixture, AgradCdfGamma_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_8, AgradCdfTestFixture, AgradCdfGamma_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_9, AgradCdfTestFixture, AgradCdfGamma_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_10, AgradCdfTestFixture, AgradCdfGamma_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_11, AgradCdfTestFixture, AgradCdfGamma_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_12, AgradCdfTestFixture, AgradCdfGamma_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_13, AgradCdfTestFixture, AgradCdfGamma_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_14, AgradCdfTestFixture, AgradCdfGamma_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_15, AgradCdfTestFixture, AgradCdfGamma_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_16, AgradCdfTestFixture, AgradCdfGamma_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_17, AgradCdfTestFixture, AgradCdfGamma_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_18, AgradCdfTestFixture, AgradCdfGamma_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_19, AgradCdfTestFixture, AgradCdfGamma_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_20, AgradCdfTestFixture, AgradCdfGamma_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_21, AgradCdfTestFixture, AgradCdfGamma_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_22, AgradCdfTestFixture, AgradCdfGamma_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_23, AgradCdfTestFixture, AgradCdfGamma_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_24, AgradCdfTestFixture, AgradCdfGamma_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_25, AgradCdfTestFixture, AgradCdfGamma_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_26, AgradCdfTestFixture, AgradCdfGamma_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_27, AgradCdfTestFixture, AgradCdfGamma_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_28, AgradCdfTestFixture, AgradCdfGamma_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_29, AgradCdfTestFixture, AgradCdfGamma_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_30, AgradCdfTestFixture, AgradCdfGamma_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_31, AgradCdfTestFixture, AgradCdfGamma_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_32, AgradCdfTestFixture, AgradCdfGamma_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_33, AgradCdfTestFixture, AgradCdfGamma_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_34, AgradCdfTestFixture, AgradCdfGamma_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_35, AgradCdfTestFixture, AgradCdfGamma_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_36, AgradCdfTestFixture, AgradCdfGamma_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_37, AgradCdfTestFixture, AgradCdfGamma_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_38, AgradCdfTestFixture, AgradCdfGamma_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_39, AgradCdfTestFixture, AgradCdfGamma_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_40, AgradCdfTestFixture, AgradCdfGamma_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_41, AgradCdfTestFixture, AgradCdfGamma_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_42, AgradCdfTestFixture, AgradCdfGamma_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_43, AgradCdfTestFixture, AgradCdfGamma_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_44, AgradCdfTestFixture, AgradCdfGamma_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_45, AgradCdfTestFixture, AgradCdfGamma_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_46, AgradCdfTestFixture, AgradCdfGamma_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_47, AgradCdfTestFixture, AgradCdfGamma_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_48, AgradCdfTestFixture, AgradCdfGamma_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_49, AgradCdfTestFixture, AgradCdfGamma_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_50, AgradCdfTestFixture, AgradCdfGamma_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_51, AgradCdfTestFixture, AgradCdfGamma_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_52, AgradCdfTestFixture, AgradCdfGamma_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_53, AgradCdfTestFixture, AgradCdfGamma_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_54, AgradCdfTestFixture, AgradCdfGamma_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_55, AgradCdfTestFixture, AgradCdfGamma_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_56, AgradCdfTestFixture, AgradCdfGamma_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_57, AgradCdfTestFixture, AgradCdfGamma_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_58, AgradCdfTestFixture, AgradCdfGamma_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_59, AgradCdfTestFixture, AgradCdfGamma_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_60, AgradCdfTestFixture, AgradCdfGamma_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_61, AgradCdfTestFixture, AgradCdfGamma_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_62, AgradCdfTestFixture, AgradCdfGamma_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_63, AgradCdfTestFixture, AgradCdfGamma_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_64, AgradCdfTestFixture, AgradCdfGamma_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_65, AgradCdfTestFixture, AgradCdfGamma_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_66, AgradCdfTestFixture, AgradCdfGamma_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_67, AgradCdfTestFixture, AgradCdfGamma_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_68, AgradCdfTestFixture, AgradCdfGamma_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_69, AgradCdfTestFixture, AgradCdfGamma_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_70, AgradCdfTestFixture, AgradCdfGamma_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_71, AgradCdfTestFixture, AgradCdfGamma_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_72, AgradCdfTestFixture, AgradCdfGamma_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_73, AgradCdfTestFixture, AgradCdfGamma_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_74, AgradCdfTestFixture, AgradCdfGamma_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_75, AgradCdfTestFixture, AgradCdfGamma_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_76, AgradCdfTestFixture, AgradCdfGamma_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_77, AgradCdfTestFixture, AgradCdfGamma_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_78, AgradCdfTestFixture, AgradCdfGamma_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_79, AgradCdfTestFixture, AgradCdfGamma_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_80, AgradCdfTestFixture, AgradCdfGamma_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_81, AgradCdfTestFixture, AgradCdfGamma_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_82, AgradCdfTestFixture, AgradCdfGamma_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_83, AgradCdfTestFixture, AgradCdfGamma_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_84, AgradCdfTestFixture, AgradCdfGamma_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_85, AgradCdfTestFixture, AgradCdfGamma_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_86, AgradCdfTestFixture, AgradCdfGamma_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_87, AgradCdfTestFixture, AgradCdfGamma_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_88, AgradCdfTestFixture, AgradCdfGamma_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_89, AgradCdfTestFixture, AgradCdfGamma_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_90, AgradCdfTestFixture, AgradCdfGamma_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_91, AgradCdfTestFixture, AgradCdfGamma_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_92, AgradCdfTestFixture, AgradCdfGamma_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_93, AgradCdfTestFixture, AgradCdfGamma_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_94, AgradCdfTestFixture, AgradCdfGamma_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_95, AgradCdfTestFixture, AgradCdfGamma_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_96, AgradCdfTestFixture, AgradCdfGamma_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_97, AgradCdfTestFixture, AgradCdfGamma_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_98, AgradCdfTestFixture, AgradCdfGamma_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_99, AgradCdfTestFixture, AgradCdfGamma_v_99);
+
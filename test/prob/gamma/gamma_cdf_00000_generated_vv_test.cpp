@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfGamma, type_vv_0> AgradCdfGamma_vv_0;
+typedef std::tuple<AgradCdfGamma, type_vv_1> AgradCdfGamma_vv_1;
+typedef std::tuple<AgradCdfGamma, type_vv_2> AgradCdfGamma_vv_2;
+typedef std::tuple<AgradCdfGamma, type_vv_3> AgradCdfGamma_vv_3;
+typedef std::tuple<AgradCdfGamma, type_vv_4> AgradCdfGamma_vv_4;
+typedef std::tuple<AgradCdfGamma, type_vv_5> AgradCdfGamma_vv_5;
+typedef std::tuple<AgradCdfGamma, type_vv_6> AgradCdfGamma_vv_6;
+typedef std::tuple<AgradCdfGamma, type_vv_7> AgradCdfGamma_vv_7;
+typedef std::tuple<AgradCdfGamma, type_vv_8> AgradCdfGamma_vv_8;
+typedef std::tuple<AgradCdfGamma, type_vv_9> AgradCdfGamma_vv_9;
+typedef std::tuple<AgradCdfGamma, type_vv_10> AgradCdfGamma_vv_10;
+typedef std::tuple<AgradCdfGamma, type_vv_11> AgradCdfGamma_vv_11;
+typedef std::tuple<AgradCdfGamma, type_vv_12> AgradCdfGamma_vv_12;
+typedef std::tuple<AgradCdfGamma, type_vv_13> AgradCdfGamma_vv_13;
+typedef std::tuple<AgradCdfGamma, type_vv_14> AgradCdfGamma_vv_14;
+typedef std::tuple<AgradCdfGamma, type_vv_15> AgradCdfGamma_vv_15;
+typedef std::tuple<AgradCdfGamma, type_vv_16> AgradCdfGamma_vv_16;
+typedef std::tuple<AgradCdfGamma, type_vv_17> AgradCdfGamma_vv_17;
+typedef std::tuple<AgradCdfGamma, type_vv_18> AgradCdfGamma_vv_18;
+typedef std::tuple<AgradCdfGamma, type_vv_19> AgradCdfGamma_vv_19;
+typedef std::tuple<AgradCdfGamma, type_vv_20> AgradCdfGamma_vv_20;
+typedef std::tuple<AgradCdfGamma, type_vv_21> AgradCdfGamma_vv_21;
+typedef std::tuple<AgradCdfGamma, type_vv_22> AgradCdfGamma_vv_22;
+typedef std::tuple<AgradCdfGamma, type_vv_23> AgradCdfGamma_vv_23;
+typedef std::tuple<AgradCdfGamma, type_vv_24> AgradCdfGamma_vv_24;
+typedef std::tuple<AgradCdfGamma, type_vv_25> AgradCdfGamma_vv_25;
+typedef std::tuple<AgradCdfGamma, type_vv_26> AgradCdfGamma_vv_26;
+typedef std::tuple<AgradCdfGamma, type_vv_27> AgradCdfGamma_vv_27;
+typedef std::tuple<AgradCdfGamma, type_vv_28> AgradCdfGamma_vv_28;
+typedef std::tuple<AgradCdfGamma, type_vv_29> AgradCdfGamma_vv_29;
+typedef std::tuple<AgradCdfGamma, type_vv_30> AgradCdfGamma_vv_30;
+typedef std::tuple<AgradCdfGamma, type_vv_31> AgradCdfGamma_vv_31;
+typedef std::tuple<AgradCdfGamma, type_vv_32> AgradCdfGamma_vv_32;
+typedef std::tuple<AgradCdfGamma, type_vv_33> AgradCdfGamma_vv_33;
+typedef std::tuple<AgradCdfGamma, type_vv_34> AgradCdfGamma_vv_34;
+typedef std::tuple<AgradCdfGamma, type_vv_35> AgradCdfGamma_vv_35;
+typedef std::tuple<AgradCdfGamma, type_vv_36> AgradCdfGamma_vv_36;
+typedef std::tuple<AgradCdfGamma, type_vv_37> AgradCdfGamma_vv_37;
+typedef std::tuple<AgradCdfGamma, type_vv_38> AgradCdfGamma_vv_38;
+typedef std::tuple<AgradCdfGamma, type_vv_39> AgradCdfGamma_vv_39;
+typedef std::tuple<AgradCdfGamma, type_vv_40> AgradCdfGamma_vv_40;
+typedef std::tuple<AgradCdfGamma, type_vv_41> AgradCdfGamma_vv_41;
+typedef std::tuple<AgradCdfGamma, type_vv_42> AgradCdfGamma_vv_42;
+typedef std::tuple<AgradCdfGamma, type_vv_43> AgradCdfGamma_vv_43;
+typedef std::tuple<AgradCdfGamma, type_vv_44> AgradCdfGamma_vv_44;
+typedef std::tuple<AgradCdfGamma, type_vv_45> AgradCdfGamma_vv_45;
+typedef std::tuple<AgradCdfGamma, type_vv_46> AgradCdfGamma_vv_46;
+typedef std::tuple<AgradCdfGamma, type_vv_47> AgradCdfGamma_vv_47;
+typedef std::tuple<AgradCdfGamma, type_vv_48> AgradCdfGamma_vv_48;
+typedef std::tuple<AgradCdfGamma, type_vv_49> AgradCdfGamma_vv_49;
+typedef std::tuple<AgradCdfGamma, type_vv_50> AgradCdfGamma_vv_50;
+typedef std::tuple<AgradCdfGamma, type_vv_51> AgradCdfGamma_vv_51;
+typedef std::tuple<AgradCdfGamma, type_vv_52> AgradCdfGamma_vv_52;
+typedef std::tuple<AgradCdfGamma, type_vv_53> AgradCdfGamma_vv_53;
+typedef std::tuple<AgradCdfGamma, type_vv_54> AgradCdfGamma_vv_54;
+typedef std::tuple<AgradCdfGamma, type_vv_55> AgradCdfGamma_vv_55;
+typedef std::tuple<AgradCdfGamma, type_vv_56> AgradCdfGamma_vv_56;
+typedef std::tuple<AgradCdfGamma, type_vv_57> AgradCdfGamma_vv_57;
+typedef std::tuple<AgradCdfGamma, type_vv_58> AgradCdfGamma_vv_58;
+typedef std::tuple<AgradCdfGamma, type_vv_59> AgradCdfGamma_vv_59;
+typedef std::tuple<AgradCdfGamma, type_vv_60> AgradCdfGamma_vv_60;
+typedef std::tuple<AgradCdfGamma, type_vv_61> AgradCdfGamma_vv_61;
+typedef std::tuple<AgradCdfGamma, type_vv_62> AgradCdfGamma_vv_62;
+typedef std::tuple<AgradCdfGamma, type_vv_63> AgradCdfGamma_vv_63;
+typedef std::tuple<AgradCdfGamma, type_vv_64> AgradCdfGamma_vv_64;
+typedef std::tuple<AgradCdfGamma, type_vv_65> AgradCdfGamma_vv_65;
+typedef std::tuple<AgradCdfGamma, type_vv_66> AgradCdfGamma_vv_66;
+typedef std::tuple<AgradCdfGamma, type_vv_67> AgradCdfGamma_vv_67;
+typedef std::tuple<AgradCdfGamma, type_vv_68> AgradCdfGamma_vv_68;
+typedef std::tuple<AgradCdfGamma, type_vv_69> AgradCdfGamma_vv_69;
+typedef std::tuple<AgradCdfGamma, type_vv_70> AgradCdfGamma_vv_70;
+typedef std::tuple<AgradCdfGamma, type_vv_71> AgradCdfGamma_vv_71;
+typedef std::tuple<AgradCdfGamma, type_vv_72> AgradCdfGamma_vv_72;
+typedef std::tuple<AgradCdfGamma, type_vv_73> AgradCdfGamma_vv_73;
+typedef std::tuple<AgradCdfGamma, type_vv_74> AgradCdfGamma_vv_74;
+typedef std::tuple<AgradCdfGamma, type_vv_75> AgradCdfGamma_vv_75;
+typedef std::tuple<AgradCdfGamma, type_vv_76> AgradCdfGamma_vv_76;
+typedef std::tuple<AgradCdfGamma, type_vv_77> AgradCdfGamma_vv_77;
+typedef std::tuple<AgradCdfGamma, type_vv_78> AgradCdfGamma_vv_78;
+typedef std::tuple<AgradCdfGamma, type_vv_79> AgradCdfGamma_vv_79;
+typedef std::tuple<AgradCdfGamma, type_vv_80> AgradCdfGamma_vv_80;
+typedef std::tuple<AgradCdfGamma, type_vv_81> AgradCdfGamma_vv_81;
+typedef std::tuple<AgradCdfGamma, type_vv_82> AgradCdfGamma_vv_82;
+typedef std::tuple<AgradCdfGamma, type_vv_83> AgradCdfGamma_vv_83;
+typedef std::tuple<AgradCdfGamma, type_vv_84> AgradCdfGamma_vv_84;
+typedef std::tuple<AgradCdfGamma, type_vv_85> AgradCdfGamma_vv_85;
+typedef std::tuple<AgradCdfGamma, type_vv_86> AgradCdfGamma_vv_86;
+typedef std::tuple<AgradCdfGamma, type_vv_87> AgradCdfGamma_vv_87;
+typedef std::tuple<AgradCdfGamma, type_vv_88> AgradCdfGamma_vv_88;
+typedef std::tuple<AgradCdfGamma, type_vv_89> AgradCdfGamma_vv_89;
+typedef std::tuple<AgradCdfGamma, type_vv_90> AgradCdfGamma_vv_90;
+typedef std::tuple<AgradCdfGamma, type_vv_91> AgradCdfGamma_vv_91;
+typedef std::tuple<AgradCdfGamma, type_vv_92> AgradCdfGamma_vv_92;
+typedef std::tuple<AgradCdfGamma, type_vv_93> AgradCdfGamma_vv_93;
+typedef std::tuple<AgradCdfGamma, type_vv_94> AgradCdfGamma_vv_94;
+typedef std::tuple<AgradCdfGamma, type_vv_95> AgradCdfGamma_vv_95;
+typedef std::tuple<AgradCdfGamma, type_vv_96> AgradCdfGamma_vv_96;
+typedef std::tuple<AgradCdfGamma, type_vv_97> AgradCdfGamma_vv_97;
+typedef std::tuple<AgradCdfGamma, type_vv_98> AgradCdfGamma_vv_98;
+typedef std::tuple<AgradCdfGamma, type_vv_99> AgradCdfGamma_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_0, AgradCdfTestFixture, AgradCdfGamma_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_1, AgradCdfTestFixture, AgradCdfGamma_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_2, AgradCdfTestFixture, AgradCdfGamma_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_3, AgradCdfTestFixture, AgradCdfGamma_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_4, AgradCdfTestFixture, AgradCdfGamma_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_5, AgradCdfTestFixture, AgradCdfGamma_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_6, AgradCdfTestFixture, AgradCdfGamma_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_7, AgradCdfTestFixture, AgradCdfGamma_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_8, AgradCdfTestFixture, AgradCdfGamma_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_9, AgradCdfTestFixture, AgradCdfGamma_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_10, AgradCdfTestFixture, AgradCdfGamma_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_11, AgradCdfTestFixture, AgradCdfGamma_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_12, AgradCdfTestFixture, AgradCdfGamma_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_13, AgradCdfTestFixture, AgradCdfGamma_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_14, AgradCdfTestFixture, AgradCdfGamma_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_15, AgradCdfTestFixture, AgradCdfGamma_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_16, AgradCdfTestFixture, AgradCdfGamma_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_17, AgradCdfTestFixture, AgradCdfGamma_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_18, AgradCdfTestFixture, AgradCdfGamma_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_19, AgradCdfTestFixture, AgradCdfGamma_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_20, AgradCdfTestFixture, AgradCdfGamma_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_21, AgradCdfTestFixture, AgradCdfGamma_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_22, AgradCdfTestFixture, AgradCdfGamma_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_23, AgradCdfTestFixture, AgradCdfGamma_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_24, AgradCdfTestFixture, AgradCdfGamma_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_25, AgradCdfTestFixture, AgradCdfGamma_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_26, AgradCdfTestFixture, AgradCdfGamma_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_27, AgradCdfTestFixture, AgradCdfGamma_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_28, AgradCdfTestFixture, AgradCdfGamma_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_29, AgradCdfTestFixture, AgradCdfGamma_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_30, AgradCdfTestFixture, AgradCdfGamma_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_31, AgradCdfTestFixture, AgradCdfGamma_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_32, AgradCdfTestFixture, AgradCdfGamma_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_33, AgradCdfTestFixture, AgradCdfGamma_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_34, AgradCdfTestFixture, AgradCdfGamma_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_35, AgradCdfTestFixture, AgradCdfGamma_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_36, AgradCdfTestFixture, AgradCdfGamma_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_37, AgradCdfTestFixture, AgradCdfGamma_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_38, AgradCdfTestFixture, AgradCdfGamma_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_39, AgradCdfTestFixture, AgradCdfGamma_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_40, AgradCdfTestFixture, AgradCdfGamma_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_41, AgradCdfTestFixture, AgradCdfGamma_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_42, AgradCdfTestFixture, AgradCdfGamma_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_43, AgradCdfTestFixture, AgradCdfGamma_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_44, AgradCdfTestFixture, AgradCdfGamma_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_45, AgradCdfTestFixture, AgradCdfGamma_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_46, AgradCdfTestFixture, AgradCdfGamma_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_47, AgradCdfTestFixture, AgradCdfGamma_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_48, AgradCdfTestFixture, AgradCdfGamma_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_49, AgradCdfTestFixture, AgradCdfGamma_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_50, AgradCdfTestFixture, AgradCdfGamma_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_51, AgradCdfTestFixture, AgradCdfGamma_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_52, AgradCdfTestFixture, AgradCdfGamma_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_53, AgradCdfTestFixture, AgradCdfGamma_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_54, AgradCdfTestFixture, AgradCdfGamma_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_55, AgradCdfTestFixture, AgradCdfGamma_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_56, AgradCdfTestFixture, AgradCdfGamma_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_57, AgradCdfTestFixture, AgradCdfGamma_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_58, AgradCdfTestFixture, AgradCdfGamma_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_59, AgradCdfTestFixture, AgradCdfGamma_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_60, AgradCdfTestFixture, AgradCdfGamma_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_61, AgradCdfTestFixture, AgradCdfGamma_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_62, AgradCdfTestFixture, AgradCdfGamma_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_63, AgradCdfTestFixture, AgradCdfGamma_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_64, AgradCdfTestFixture, AgradCdfGamma_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_65, AgradCdfTestFixture, AgradCdfGamma_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_66, AgradCdfTestFixture, AgradCdfGamma_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_67, AgradCdfTestFixture, AgradCdfGamma_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_68, AgradCdfTestFixture, AgradCdfGamma_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_69, AgradCdfTestFixture, AgradCdfGamma_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_70, AgradCdfTestFixture, AgradCdfGamma_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_71, AgradCdfTestFixture, AgradCdfGamma_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_72, AgradCdfTestFixture, AgradCdfGamma_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_73, AgradCdfTestFixture, AgradCdfGamma_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_74, AgradCdfTestFixture, AgradCdfGamma_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_75, AgradCdfTestFixture, AgradCdfGamma_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_76, AgradCdfTestFixture, AgradCdfGamma_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_77, AgradCdfTestFixture, AgradCdfGamma_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_78, AgradCdfTestFixture, AgradCdfGamma_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_79, AgradCdfTestFixture, AgradCdfGamma_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_80, AgradCdfTestFixture, AgradCdfGamma_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_81, AgradCdfTestFixture, AgradCdfGamma_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_82, AgradCdfTestFixture, AgradCdfGamma_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_83, AgradCdfTestFixture, AgradCdfGamma_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_84, AgradCdfTestFixture, AgradCdfGamma_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_85, AgradCdfTestFixture, AgradCdfGamma_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_86, AgradCdfTestFixture, AgradCdfGamma_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_87, AgradCdfTestFixture, AgradCdfGamma_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_88, AgradCdfTestFixture, AgradCdfGamma_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_89, AgradCdfTestFixture, AgradCdfGamma_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_90, AgradCdfTestFixture, AgradCdfGamma_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_91, AgradCdfTestFixture, AgradCdfGamma_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_92, AgradCdfTestFixture, AgradCdfGamma_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_93, AgradCdfTestFixture, AgradCdfGamma_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_94, AgradCdfTestFixture, AgradCdfGamma_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_95, AgradCdfTestFixture, AgradCdfGamma_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_96, AgradCdfTestFixture, AgradCdfGamma_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_97, AgradCdfTestFixture, AgradCdfGamma_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_98, AgradCdfTestFixture, AgradCdfGamma_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_99, AgradCdfTestFixture, AgradCdfGamma_vv_99);
+
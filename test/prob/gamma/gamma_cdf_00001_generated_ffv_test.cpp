@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfGamma, type_ffv_100> AgradCdfGamma_ffv_100;
+typedef std::tuple<AgradCdfGamma, type_ffv_101> AgradCdfGamma_ffv_101;
+typedef std::tuple<AgradCdfGamma, type_ffv_102> AgradCdfGamma_ffv_102;
+typedef std::tuple<AgradCdfGamma, type_ffv_103> AgradCdfGamma_ffv_103;
+typedef std::tuple<AgradCdfGamma, type_ffv_104> AgradCdfGamma_ffv_104;
+typedef std::tuple<AgradCdfGamma, type_ffv_105> AgradCdfGamma_ffv_105;
+typedef std::tuple<AgradCdfGamma, type_ffv_106> AgradCdfGamma_ffv_106;
+typedef std::tuple<AgradCdfGamma, type_ffv_107> AgradCdfGamma_ffv_107;
+typedef std::tuple<AgradCdfGamma, type_ffv_108> AgradCdfGamma_ffv_108;
+typedef std::tuple<AgradCdfGamma, type_ffv_109> AgradCdfGamma_ffv_109;
+typedef std::tuple<AgradCdfGamma, type_ffv_110> AgradCdfGamma_ffv_110;
+typedef std::tuple<AgradCdfGamma, type_ffv_111> AgradCdfGamma_ffv_111;
+typedef std::tuple<AgradCdfGamma, type_ffv_112> AgradCdfGamma_ffv_112;
+typedef std::tuple<AgradCdfGamma, type_ffv_113> AgradCdfGamma_ffv_113;
+typedef std::tuple<AgradCdfGamma, type_ffv_114> AgradCdfGamma_ffv_114;
+typedef std::tuple<AgradCdfGamma, type_ffv_115> AgradCdfGamma_ffv_115;
+typedef std::tuple<AgradCdfGamma, type_ffv_116> AgradCdfGamma_ffv_116;
+typedef std::tuple<AgradCdfGamma, type_ffv_117> AgradCdfGamma_ffv_117;
+typedef std::tuple<AgradCdfGamma, type_ffv_118> AgradCdfGamma_ffv_118;
+typedef std::tuple<AgradCdfGamma, type_ffv_119> AgradCdfGamma_ffv_119;
+typedef std::tuple<AgradCdfGamma, type_ffv_120> AgradCdfGamma_ffv_120;
+typedef std::tuple<AgradCdfGamma, type_ffv_121> AgradCdfGamma_ffv_121;
+typedef std::tuple<AgradCdfGamma, type_ffv_122> AgradCdfGamma_ffv_122;
+typedef std::tuple<AgradCdfGamma, type_ffv_123> AgradCdfGamma_ffv_123;
+typedef std::tuple<AgradCdfGamma, type_ffv_124> AgradCdfGamma_ffv_124;
+typedef std::tuple<AgradCdfGamma, type_ffv_125> AgradCdfGamma_ffv_125;
+typedef std::tuple<AgradCdfGamma, type_ffv_126> AgradCdfGamma_ffv_126;
+typedef std::tuple<AgradCdfGamma, type_ffv_127> AgradCdfGamma_ffv_127;
+typedef std::tuple<AgradCdfGamma, type_ffv_128> AgradCdfGamma_ffv_128;
+typedef std::tuple<AgradCdfGamma, type_ffv_129> AgradCdfGamma_ffv_129;
+typedef std::tuple<AgradCdfGamma, type_ffv_130> AgradCdfGamma_ffv_130;
+typedef std::tuple<AgradCdfGamma, type_ffv_131> AgradCdfGamma_ffv_131;
+typedef std::tuple<AgradCdfGamma, type_ffv_132> AgradCdfGamma_ffv_132;
+typedef std::tuple<AgradCdfGamma, type_ffv_133> AgradCdfGamma_ffv_133;
+typedef std::tuple<AgradCdfGamma, type_ffv_134> AgradCdfGamma_ffv_134;
+typedef std::tuple<AgradCdfGamma, type_ffv_135> AgradCdfGamma_ffv_135;
+typedef std::tuple<AgradCdfGamma, type_ffv_136> AgradCdfGamma_ffv_136;
+typedef std::tuple<AgradCdfGamma, type_ffv_137> AgradCdfGamma_ffv_137;
+typedef std::tuple<AgradCdfGamma, type_ffv_138> AgradCdfGamma_ffv_138;
+typedef std::tuple<AgradCdfGamma, type_ffv_139> AgradCdfGamma_ffv_139;
+typedef std::tuple<AgradCdfGamma, type_ffv_140> AgradCdfGamma_ffv_140;
+typedef std::tuple<AgradCdfGamma, type_ffv_141> AgradCdfGamma_ffv_141;
+typedef std::tuple<AgradCdfGamma, type_ffv_142> AgradCdfGamma_ffv_142;
+typedef std::tuple<AgradCdfGamma, type_ffv_143> AgradCdfGamma_ffv_143;
+typedef std::tuple<AgradCdfGamma, type_ffv_144> AgradCdfGamma_ffv_144;
+typedef std::tuple<AgradCdfGamma, type_ffv_145> AgradCdfGamma_ffv_145;
+typedef std::tuple<AgradCdfGamma, type_ffv_146> AgradCdfGamma_ffv_146;
+typedef std::tuple<AgradCdfGamma, type_ffv_147> AgradCdfGamma_ffv_147;
+typedef std::tuple<AgradCdfGamma, type_ffv_148> AgradCdfGamma_ffv_148;
+typedef std::tuple<AgradCdfGamma, type_ffv_149> AgradCdfGamma_ffv_149;
+typedef std::tuple<AgradCdfGamma, type_ffv_150> AgradCdfGamma_ffv_150;
+typedef std::tuple<AgradCdfGamma, type_ffv_151> AgradCdfGamma_ffv_151;
+typedef std::tuple<AgradCdfGamma, type_ffv_152> AgradCdfGamma_ffv_152;
+typedef std::tuple<AgradCdfGamma, type_ffv_153> AgradCdfGamma_ffv_153;
+typedef std::tuple<AgradCdfGamma, type_ffv_154> AgradCdfGamma_ffv_154;
+typedef std::tuple<AgradCdfGamma, type_ffv_155> AgradCdfGamma_ffv_155;
+typedef std::tuple<AgradCdfGamma, type_ffv_156> AgradCdfGamma_ffv_156;
+typedef std::tuple<AgradCdfGamma, type_ffv_157> AgradCdfGamma_ffv_157;
+typedef std::tuple<AgradCdfGamma, type_ffv_158> AgradCdfGamma_ffv_158;
+typedef std::tuple<AgradCdfGamma, type_ffv_159> AgradCdfGamma_ffv_159;
+typedef std::tuple<AgradCdfGamma, type_ffv_160> AgradCdfGamma_ffv_160;
+typedef std::tuple<AgradCdfGamma, type_ffv_161> AgradCdfGamma_ffv_161;
+typedef std::tuple<AgradCdfGamma, type_ffv_162> AgradCdfGamma_ffv_162;
+typedef std::tuple<AgradCdfGamma, type_ffv_163> AgradCdfGamma_ffv_163;
+typedef std::tuple<AgradCdfGamma, type_ffv_164> AgradCdfGamma_ffv_164;
+typedef std::tuple<AgradCdfGamma, type_ffv_165> AgradCdfGamma_ffv_165;
+typedef std::tuple<AgradCdfGamma, type_ffv_166> AgradCdfGamma_ffv_166;
+typedef std::tuple<AgradCdfGamma, type_ffv_167> AgradCdfGamma_ffv_167;
+typedef std::tuple<AgradCdfGamma, type_ffv_168> AgradCdfGamma_ffv_168;
+typedef std::tuple<AgradCdfGamma, type_ffv_169> AgradCdfGamma_ffv_169;
+typedef std::tuple<AgradCdfGamma, type_ffv_170> AgradCdfGamma_ffv_170;
+typedef std::tuple<AgradCdfGamma, type_ffv_171> AgradCdfGamma_ffv_171;
+typedef std::tuple<AgradCdfGamma, type_ffv_172> AgradCdfGamma_ffv_172;
+typedef std::tuple<AgradCdfGamma, type_ffv_173> AgradCdfGamma_ffv_173;
+typedef std::tuple<AgradCdfGamma, type_ffv_174> AgradCdfGamma_ffv_174;
+typedef std::tuple<AgradCdfGamma, type_ffv_175> AgradCdfGamma_ffv_175;
+typedef std::tuple<AgradCdfGamma, type_ffv_176> AgradCdfGamma_ffv_176;
+typedef std::tuple<AgradCdfGamma, type_ffv_177> AgradCdfGamma_ffv_177;
+typedef std::tuple<AgradCdfGamma, type_ffv_178> AgradCdfGamma_ffv_178;
+typedef std::tuple<AgradCdfGamma, type_ffv_179> AgradCdfGamma_ffv_179;
+typedef std::tuple<AgradCdfGamma, type_ffv_180> AgradCdfGamma_ffv_180;
+typedef std::tuple<AgradCdfGamma, type_ffv_181> AgradCdfGamma_ffv_181;
+typedef std::tuple<AgradCdfGamma, type_ffv_182> AgradCdfGamma_ffv_182;
+typedef std::tuple<AgradCdfGamma, type_ffv_183> AgradCdfGamma_ffv_183;
+typedef std::tuple<AgradCdfGamma, type_ffv_184> AgradCdfGamma_ffv_184;
+typedef std::tuple<AgradCdfGamma, type_ffv_185> AgradCdfGamma_ffv_185;
+typedef std::tuple<AgradCdfGamma, type_ffv_186> AgradCdfGamma_ffv_186;
+typedef std::tuple<AgradCdfGamma, type_ffv_187> AgradCdfGamma_ffv_187;
+typedef std::tuple<AgradCdfGamma, type_ffv_188> AgradCdfGamma_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_100, AgradCdfTestFixture, AgradCdfGamma_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_101, AgradCdfTestFixture, AgradCdfGamma_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_102, AgradCdfTestFixture, AgradCdfGamma_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_103, AgradCdfTestFixture, AgradCdfGamma_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_104, AgradCdfTestFixture, AgradCdfGamma_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_105, AgradCdfTestFixture, AgradCdfGamma_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_106, AgradCdfTestFixture, AgradCdfGamma_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_107, AgradCdfTestFixture, AgradCdfGamma_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_108, AgradCdfTestFixture, AgradCdfGamma_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_109, AgradCdfTestFixture, AgradCdfGamma_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_110, AgradCdfTestFixture, AgradCdfGamma_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_111, AgradCdfTestFixture, AgradCdfGamma_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_112, AgradCdfTestFixture, AgradCdfGamma_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_113, AgradCdfTestFixture, AgradCdfGamma_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_114, AgradCdfTestFixture, AgradCdfGamma_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_115, AgradCdfTestFixture, AgradCdfGamma_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_116, AgradCdfTestFixture, AgradCdfGamma_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_117, AgradCdfTestFixture, AgradCdfGamma_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_118, AgradCdfTestFixture, AgradCdfGamma_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_119, AgradCdfTestFixture, AgradCdfGamma_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_120, AgradCdfTestFixture, AgradCdfGamma_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_121, AgradCdfTestFixture, AgradCdfGamma_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_122, AgradCdfTestFixture, AgradCdfGamma_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_123, AgradCdfTestFixture, AgradCdfGamma_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_124, AgradCdfTestFixture, AgradCdfGamma_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_125, AgradCdfTestFixture, AgradCdfGamma_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_126, AgradCdfTestFixture, AgradCdfGamma_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_127, AgradCdfTestFixture, AgradCdfGamma_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_128, AgradCdfTestFixture, AgradCdfGamma_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_129, AgradCdfTestFixture, AgradCdfGamma_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_130, AgradCdfTestFixture, AgradCdfGamma_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_131, AgradCdfTestFixture, AgradCdfGamma_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_132, AgradCdfTestFixture, AgradCdfGamma_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_133, AgradCdfTestFixture, AgradCdfGamma_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_134, AgradCdfTestFixture, AgradCdfGamma_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_135, AgradCdfTestFixture, AgradCdfGamma_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_136, AgradCdfTestFixture, AgradCdfGamma_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_137, AgradCdfTestFixture, AgradCdfGamma_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_138, AgradCdfTestFixture, AgradCdfGamma_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_139, AgradCdfTestFixture, AgradCdfGamma_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_140, AgradCdfTestFixture, AgradCdfGamma_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_141, AgradCdfTestFixture, AgradCdfGamma_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_142, AgradCdfTestFixture, AgradCdfGamma_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_143, AgradCdfTestFixture, AgradCdfGamma_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_144, AgradCdfTestFixture, AgradCdfGamma_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_145, AgradCdfTestFixture, AgradCdfGamma_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_146, AgradCdfTestFixture, AgradCdfGamma_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_147, AgradCdfTestFixture, AgradCdfGamma_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_148, AgradCdfTestFixture, AgradCdfGamma_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_149, AgradCdfTestFixture, AgradCdfGamma_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_150, AgradCdfTestFixture, AgradCdfGamma_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_151, AgradCdfTestFixture, AgradCdfGamma_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_152, AgradCdfTestFixture, AgradCdfGamma_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_153, AgradCdfTestFixture, AgradCdfGamma_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_154, AgradCdfTestFixture, AgradCdfGamma_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_155, AgradCdfTestFixture, AgradCdfGamma_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_156, AgradCdfTestFixture, AgradCdfGamma_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_157, AgradCdfTestFixture, AgradCdfGamma_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_158, AgradCdfTestFixture, AgradCdfGamma_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_159, AgradCdfTestFixture, AgradCdfGamma_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_160, AgradCdfTestFixture, AgradCdfGamma_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_161, AgradCdfTestFixture, AgradCdfGamma_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_162, AgradCdfTestFixture, AgradCdfGamma_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_163, AgradCdfTestFixture, AgradCdfGamma_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_164, AgradCdfTestFixture, AgradCdfGamma_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_165, AgradCdfTestFixture, AgradCdfGamma_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_166, AgradCdfTestFixture, AgradCdfGamma_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_167, AgradCdfTestFixture, AgradCdfGamma_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_168, AgradCdfTestFixture, AgradCdfGamma_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_169, AgradCdfTestFixture, AgradCdfGamma_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_170, AgradCdfTestFixture, AgradCdfGamma_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_171, AgradCdfTestFixture, AgradCdfGamma_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_172, AgradCdfTestFixture, AgradCdfGamma_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_173, AgradCdfTestFixture, AgradCdfGamma_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_174, AgradCdfTestFixture, AgradCdfGamma_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_175, AgradCdfTestFixture, AgradCdfGamma_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_176, AgradCdfTestFixture, AgradCdfGamma_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_177, AgradCdfTestFixture, AgradCdfGamma_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_178, AgradCdfTestFixture, AgradCdfGamma_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_179, AgradCdfTestFixture, AgradCdfGamma_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_180, AgradCdfTestFixture, AgradCdfGamma_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_181, AgradCdfTestFixture, AgradCdfGamma_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_182, AgradCdfTestFixture, AgradCdfGamma_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_183, AgradCdfTestFixture, AgradCdfGamma_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_184, AgradCdfTestFixture, AgradCdfGamma_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_185, AgradCdfTestFixture, AgradCdfGamma_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_186, AgradCdfTestFixture, AgradCdfGamma_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_187, AgradCdfTestFixture, AgradCdfGamma_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_ffv_188, AgradCdfTestFixture, AgradCdfGamma_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfGamma, type_v_100> AgradCdfGamma_v_100;
+typedef std::tuple<AgradCdfGamma, type_v_101> AgradCdfGamma_v_101;
+typedef std::tuple<AgradCdfGamma, type_v_102> AgradCdfGamma_v_102;
+typedef std::tuple<AgradCdfGamma, type_v_103> AgradCdfGamma_v_103;
+typedef std::tuple<AgradCdfGamma, type_v_104> AgradCdfGamma_v_104;
+typedef std::tuple<AgradCdfGamma, type_v_105> AgradCdfGamma_v_105;
+typedef std::tuple<AgradCdfGamma, type_v_106> AgradCdfGamma_v_106;
+typedef std::tuple<AgradCdfGamma, type_v_107> AgradCdfGamma_v_107;
+typedef std::tuple<AgradCdfGamma, type_v_108> AgradCdfGamma_v_108;
+typedef std::tuple<AgradCdfGamma, type_v_109> AgradCdfGamma_v_109;
+typedef std::tuple<AgradCdfGamma, type_v_110> AgradCdfGamma_v_110;
+typedef std::tuple<AgradCdfGamma, type_v_111> AgradCdfGamma_v_111;
+typedef std::tuple<AgradCdfGamma, type_v_112> AgradCdfGamma_v_112;
+typedef std::tuple<AgradCdfGamma, type_v_113> AgradCdfGamma_v_113;
+typedef std::tuple<AgradCdfGamma, type_v_114> AgradCdfGamma_v_114;
+typedef std::tuple<AgradCdfGamma, type_v_115> AgradCdfGamma_v_115;
+typedef std::tuple<AgradCdfGamma, type_v_116> AgradCdfGamma_v_116;
+typedef std::tuple<AgradCdfGamma, type_v_117> AgradCdfGamma_v_117;
+typedef std::tuple<AgradCdfGamma, type_v_118> AgradCdfGamma_v_118;
+typedef std::tuple<AgradCdfGamma, type_v_119> AgradCdfGamma_v_119;
+typedef std::tuple<AgradCdfGamma, type_v_120> AgradCdfGamma_v_120;
+typedef std::tuple<AgradCdfGamma, type_v_121> AgradCdfGamma_v_121;
+typedef std::tuple<AgradCdfGamma, type_v_122> AgradCdfGamma_v_122;
+typedef std::tuple<AgradCdfGamma, type_v_123> AgradCdfGamma_v_123;
+typedef std::tuple<AgradCdfGamma, type_v_124> AgradCdfGamma_v_124;
+typedef std::tuple<AgradCdfGamma, type_v_125> AgradCdfGamma_v_125;
+typedef std::tuple<AgradCdfGamma, type_v_126> AgradCdfGamma_v_126;
+typedef std::tuple<AgradCdfGamma, type_v_127> AgradCdfGamma_v_127;
+typedef std::tuple<AgradCdfGamma, type_v_128> AgradCdfGamma_v_128;
+typedef std::tuple<AgradCdfGamma, type_v_129> AgradCdfGamma_v_129;
+typedef std::tuple<AgradCdfGamma, type_v_130> AgradCdfGamma_v_130;
+typedef std::tuple<AgradCdfGamma, type_v_131> AgradCdfGamma_v_131;
+typedef std::tuple<AgradCdfGamma, type_v_132> AgradCdfGamma_v_132;
+typedef std::tuple<AgradCdfGamma, type_v_133> AgradCdfGamma_v_133;
+typedef std::tuple<AgradCdfGamma, type_v_134> AgradCdfGamma_v_134;
+typedef std::tuple<AgradCdfGamma, type_v_135> AgradCdfGamma_v_135;
+typedef std::tuple<AgradCdfGamma, type_v_136> AgradCdfGamma_v_136;
+typedef std::tuple<AgradCdfGamma, type_v_137> AgradCdfGamma_v_137;
+typedef std::tuple<AgradCdfGamma, type_v_138> AgradCdfGamma_v_138;
+typedef std::tuple<AgradCdfGamma, type_v_139> AgradCdfGamma_v_139;
+typedef std::tuple<AgradCdfGamma, type_v_140> AgradCdfGamma_v_140;
+typedef std::tuple<AgradCdfGamma, type_v_141> AgradCdfGamma_v_141;
+typedef std::tuple<AgradCdfGamma, type_v_142> AgradCdfGamma_v_142;
+typedef std::tuple<AgradCdfGamma, type_v_143> AgradCdfGamma_v_143;
+typedef std::tuple<AgradCdfGamma, type_v_144> AgradCdfGamma_v_144;
+typedef std::tuple<AgradCdfGamma, type_v_145> AgradCdfGamma_v_145;
+typedef std::tuple<AgradCdfGamma, type_v_146> AgradCdfGamma_v_146;
+typedef std::tuple<AgradCdfGamma, type_v_147> AgradCdfGamma_v_147;
+typedef std::tuple<AgradCdfGamma, type_v_148> AgradCdfGamma_v_148;
+typedef std::tuple<AgradCdfGamma, type_v_149> AgradCdfGamma_v_149;
+typedef std::tuple<AgradCdfGamma, type_v_150> AgradCdfGamma_v_150;
+typedef std::tuple<AgradCdfGamma, type_v_151> AgradCdfGamma_v_151;
+typedef std::tuple<AgradCdfGamma, type_v_152> AgradCdfGamma_v_152;
+typedef std::tuple<AgradCdfGamma, type_v_153> AgradCdfGamma_v_153;
+typedef std::tuple<AgradCdfGamma, type_v_154> AgradCdfGamma_v_154;
+typedef std::tuple<AgradCdfGamma, type_v_155> AgradCdfGamma_v_155;
+typedef std::tuple<AgradCdfGamma, type_v_156> AgradCdfGamma_v_156;
+typedef std::tuple<AgradCdfGamma, type_v_157> AgradCdfGamma_v_157;
+typedef std::tuple<AgradCdfGamma, type_v_158> AgradCdfGamma_v_158;
+typedef std::tuple<AgradCdfGamma, type_v_159> AgradCdfGamma_v_159;
+typedef std::tuple<AgradCdfGamma, type_v_160> AgradCdfGamma_v_160;
+typedef std::tuple<AgradCdfGamma, type_v_161> AgradCdfGamma_v_161;
+typedef std::tuple<AgradCdfGamma, type_v_162> AgradCdfGamma_v_162;
+typedef std::tuple<AgradCdfGamma, type_v_163> AgradCdfGamma_v_163;
+typedef std::tuple<AgradCdfGamma, type_v_164> AgradCdfGamma_v_164;
+typedef std::tuple<AgradCdfGamma, type_v_165> AgradCdfGamma_v_165;
+typedef std::tuple<AgradCdfGamma, type_v_166> AgradCdfGamma_v_166;
+typedef std::tuple<AgradCdfGamma, type_v_167> AgradCdfGamma_v_167;
+typedef std::tuple<AgradCdfGamma, type_v_168> AgradCdfGamma_v_168;
+typedef std::tuple<AgradCdfGamma, type_v_169> AgradCdfGamma_v_169;
+typedef std::tuple<AgradCdfGamma, type_v_170> AgradCdfGamma_v_170;
+typedef std::tuple<AgradCdfGamma, type_v_171> AgradCdfGamma_v_171;
+typedef std::tuple<AgradCdfGamma, type_v_172> AgradCdfGamma_v_172;
+typedef std::tuple<AgradCdfGamma, type_v_173> AgradCdfGamma_v_173;
+typedef std::tuple<AgradCdfGamma, type_v_174> AgradCdfGamma_v_174;
+typedef std::tuple<AgradCdfGamma, type_v_175> AgradCdfGamma_v_175;
+typedef std::tuple<AgradCdfGamma, type_v_176> AgradCdfGamma_v_176;
+typedef std::tuple<AgradCdfGamma, type_v_177> AgradCdfGamma_v_177;
+typedef std::tuple<AgradCdfGamma, type_v_178> AgradCdfGamma_v_178;
+typedef std::tuple<AgradCdfGamma, type_v_179> AgradCdfGamma_v_179;
+typedef std::tuple<AgradCdfGamma, type_v_180> AgradCdfGamma_v_180;
+typedef std::tuple<AgradCdfGamma, type_v_181> AgradCdfGamma_v_181;
+typedef std::tuple<AgradCdfGamma, type_v_182> AgradCdfGamma_v_182;
+typedef std::tuple<AgradCdfGamma, type_v_183> AgradCdfGamma_v_183;
+typedef std::tuple<AgradCdfGamma, type_v_184> AgradCdfGamma_v_184;
+typedef std::tuple<AgradCdfGamma, type_v_185> AgradCdfGamma_v_185;
+typedef std::tuple<AgradCdfGamma, type_v_186> AgradCdfGamma_v_186;
+typedef std::tuple<AgradCdfGamma, type_v_187> AgradCdfGamma_v_187;
+typedef std::tuple<AgradCdfGamma, type_v_188> AgradCdfGamma_v_188;
+typedef std::tuple<AgradCdfGamma, type_v_189> AgradCdfGamma_v_189;
+typedef std::tuple<AgradCdfGamma, type_v_190> AgradCdfGamma_v_190;
+typedef std::tuple<AgradCdfGamma, type_v_191> AgradCdfGamma_v_191;
+typedef std::tuple<AgradCdfGamma, type_v_192> AgradCdfGamma_v_192;
+typedef std::tuple<AgradCdfGamma, type_v_193> AgradCdfGamma_v_193;
+typedef std::tuple<AgradCdfGamma, type_v_194> AgradCdfGamma_v_194;
+typedef std::tuple<AgradCdfGamma, type_v_195> AgradCdfGamma_v_195;
+typedef std::tuple<AgradCdfGamma, type_v_196> AgradCdfGamma_v_196;
+typedef std::tuple<AgradCdfGamma, type_v_197> AgradCdfGamma_v_197;
+typedef std::tuple<AgradCdfGamma, type_v_198> AgradCdfGamma_v_198;
+typedef std::tuple<AgradCdfGamma, type_v_199> AgradCdfGamma_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_100, AgradCdfTestFixture, AgradCdfGamma_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_101, AgradCdfTestFixture, AgradCdfGamma_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_102, AgradCdfTestFixture, AgradCdfGamma_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_103, AgradCdfTestFixture, AgradCdfGamma_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_104, AgradCdfTestFixture, AgradCdfGamma_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_105, AgradCdfTestFixture, AgradCdfGamma_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_106, AgradCdfTestFixture, AgradCdfGamma_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_107, AgradCdfTestFixture, AgradCdfGamma_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_108, AgradCdfTestFixture, AgradCdfGamma_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_109, AgradCdfTestFixture, AgradCdfGamma_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_110, AgradCdfTestFixture, AgradCdfGamma_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_111, AgradCdfTestFixture, AgradCdfGamma_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_112, AgradCdfTestFixture, AgradCdfGamma_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_113, AgradCdfTestFixture, AgradCdfGamma_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_114, AgradCdfTestFixture, AgradCdfGamma_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_115, AgradCdfTestFixture, AgradCdfGamma_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_116, AgradCdfTestFixture, AgradCdfGamma_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_117, AgradCdfTestFixture, AgradCdfGamma_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_118, AgradCdfTestFixture, AgradCdfGamma_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_119, AgradCdfTestFixture, AgradCdfGamma_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_120, AgradCdfTestFixture, AgradCdfGamma_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_121, AgradCdfTestFixture, AgradCdfGamma_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_122, AgradCdfTestFixture, AgradCdfGamma_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_123, AgradCdfTestFixture, AgradCdfGamma_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_124, AgradCdfTestFixture, AgradCdfGamma_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_125, AgradCdfTestFixture, AgradCdfGamma_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_126, AgradCdfTestFixture, AgradCdfGamma_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_127, AgradCdfTestFixture, AgradCdfGamma_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_128, AgradCdfTestFixture, AgradCdfGamma_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_129, AgradCdfTestFixture, AgradCdfGamma_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_130, AgradCdfTestFixture, AgradCdfGamma_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_131, AgradCdfTestFixture, AgradCdfGamma_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_132, AgradCdfTestFixture, AgradCdfGamma_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_133, AgradCdfTestFixture, AgradCdfGamma_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_134, AgradCdfTestFixture, AgradCdfGamma_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_135, AgradCdfTestFixture, AgradCdfGamma_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_136, AgradCdfTestFixture, AgradCdfGamma_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_137, AgradCdfTestFixture, AgradCdfGamma_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_138, AgradCdfTestFixture, AgradCdfGamma_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_139, AgradCdfTestFixture, AgradCdfGamma_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_140, AgradCdfTestFixture, AgradCdfGamma_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_141, AgradCdfTestFixture, AgradCdfGamma_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_142, AgradCdfTestFixture, AgradCdfGamma_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_143, AgradCdfTestFixture, AgradCdfGamma_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_144, AgradCdfTestFixture, AgradCdfGamma_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_145, AgradCdfTestFixture, AgradCdfGamma_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_146, AgradCdfTestFixture, AgradCdfGamma_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_147, AgradCdfTestFixture, AgradCdfGamma_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_148, AgradCdfTestFixture, AgradCdfGamma_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_149, AgradCdfTestFixture, AgradCdfGamma_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_150, AgradCdfTestFixture, AgradCdfGamma_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_151, AgradCdfTestFixture, AgradCdfGamma_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_152, AgradCdfTestFixture, AgradCdfGamma_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_153, AgradCdfTestFixture, AgradCdfGamma_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_154, AgradCdfTestFixture, AgradCdfGamma_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_155, AgradCdfTestFixture, AgradCdfGamma_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_156, AgradCdfTestFixture, AgradCdfGamma_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_157, AgradCdfTestFixture, AgradCdfGamma_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_158, AgradCdfTestFixture, AgradCdfGamma_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_159, AgradCdfTestFixture, AgradCdfGamma_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_160, AgradCdfTestFixture, AgradCdfGamma_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_161, AgradCdfTestFixture, AgradCdfGamma_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_162, AgradCdfTestFixture, AgradCdfGamma_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_163, AgradCdfTestFixture, AgradCdfGamma_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_164, AgradCdfTestFixture, AgradCdfGamma_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_165, AgradCdfTestFixture, AgradCdfGamma_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_166, AgradCdfTestFixture, AgradCdfGamma_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_167, AgradCdfTestFixture, AgradCdfGamma_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_168, AgradCdfTestFixture, AgradCdfGamma_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_169, AgradCdfTestFixture, AgradCdfGamma_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_170, AgradCdfTestFixture, AgradCdfGamma_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_171, AgradCdfTestFixture, AgradCdfGamma_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_172, AgradCdfTestFixture, AgradCdfGamma_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_173, AgradCdfTestFixture, AgradCdfGamma_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_174, AgradCdfTestFixture, AgradCdfGamma_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_175, AgradCdfTestFixture, AgradCdfGamma_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_176, AgradCdfTestFixture, AgradCdfGamma_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_177, AgradCdfTestFixture, AgradCdfGamma_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_178, AgradCdfTestFixture, AgradCdfGamma_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_179, AgradCdfTestFixture, AgradCdfGamma_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_180, AgradCdfTestFixture, AgradCdfGamma_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_181, AgradCdfTestFixture, AgradCdfGamma_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_182, AgradCdfTestFixture, AgradCdfGamma_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_183, AgradCdfTestFixture, AgradCdfGamma_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_184, AgradCdfTestFixture, AgradCdfGamma_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_185, AgradCdfTestFixture, AgradCdfGamma_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_186, AgradCdfTestFixture, AgradCdfGamma_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_187, AgradCdfTestFixture, AgradCdfGamma_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_188, AgradCdfTestFixture, AgradCdfGamma_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_189, AgradCdfTestFixture, AgradCdfGamma_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_190, AgradCdfTestFixture, AgradCdfGamma_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_191, AgradCdfTestFixture, AgradCdfGamma_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_192, AgradCdfTestFixture, AgradCdfGamma_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_193, AgradCdfTestFixture, AgradCdfGamma_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_194, AgradCdfTestFixture, AgradCdfGamma_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_195, AgradCdfTestFixture, AgradCdfGamma_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_196, AgradCdfTestFixture, AgradCdfGamma_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_197, AgradCdfTestFixture, AgradCdfGamma_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_198, AgradCdfTestFixture, AgradCdfGamma_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_v_199, AgradCdfTestFixture, AgradCdfGamma_v_199);
+
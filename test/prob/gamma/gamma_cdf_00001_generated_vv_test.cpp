@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfGamma, type_vv_100> AgradCdfGamma_vv_100;
+typedef std::tuple<AgradCdfGamma, type_vv_101> AgradCdfGamma_vv_101;
+typedef std::tuple<AgradCdfGamma, type_vv_102> AgradCdfGamma_vv_102;
+typedef std::tuple<AgradCdfGamma, type_vv_103> AgradCdfGamma_vv_103;
+typedef std::tuple<AgradCdfGamma, type_vv_104> AgradCdfGamma_vv_104;
+typedef std::tuple<AgradCdfGamma, type_vv_105> AgradCdfGamma_vv_105;
+typedef std::tuple<AgradCdfGamma, type_vv_106> AgradCdfGamma_vv_106;
+typedef std::tuple<AgradCdfGamma, type_vv_107> AgradCdfGamma_vv_107;
+typedef std::tuple<AgradCdfGamma, type_vv_108> AgradCdfGamma_vv_108;
+typedef std::tuple<AgradCdfGamma, type_vv_109> AgradCdfGamma_vv_109;
+typedef std::tuple<AgradCdfGamma, type_vv_110> AgradCdfGamma_vv_110;
+typedef std::tuple<AgradCdfGamma, type_vv_111> AgradCdfGamma_vv_111;
+typedef std::tuple<AgradCdfGamma, type_vv_112> AgradCdfGamma_vv_112;
+typedef std::tuple<AgradCdfGamma, type_vv_113> AgradCdfGamma_vv_113;
+typedef std::tuple<AgradCdfGamma, type_vv_114> AgradCdfGamma_vv_114;
+typedef std::tuple<AgradCdfGamma, type_vv_115> AgradCdfGamma_vv_115;
+typedef std::tuple<AgradCdfGamma, type_vv_116> AgradCdfGamma_vv_116;
+typedef std::tuple<AgradCdfGamma, type_vv_117> AgradCdfGamma_vv_117;
+typedef std::tuple<AgradCdfGamma, type_vv_118> AgradCdfGamma_vv_118;
+typedef std::tuple<AgradCdfGamma, type_vv_119> AgradCdfGamma_vv_119;
+typedef std::tuple<AgradCdfGamma, type_vv_120> AgradCdfGamma_vv_120;
+typedef std::tuple<AgradCdfGamma, type_vv_121> AgradCdfGamma_vv_121;
+typedef std::tuple<AgradCdfGamma, type_vv_122> AgradCdfGamma_vv_122;
+typedef std::tuple<AgradCdfGamma, type_vv_123> AgradCdfGamma_vv_123;
+typedef std::tuple<AgradCdfGamma, type_vv_124> AgradCdfGamma_vv_124;
+typedef std::tuple<AgradCdfGamma, type_vv_125> AgradCdfGamma_vv_125;
+typedef std::tuple<AgradCdfGamma, type_vv_126> AgradCdfGamma_vv_126;
+typedef std::tuple<AgradCdfGamma, type_vv_127> AgradCdfGamma_vv_127;
+typedef std::tuple<AgradCdfGamma, type_vv_128> AgradCdfGamma_vv_128;
+typedef std::tuple<AgradCdfGamma, type_vv_129> AgradCdfGamma_vv_129;
+typedef std::tuple<AgradCdfGamma, type_vv_130> AgradCdfGamma_vv_130;
+typedef std::tuple<AgradCdfGamma, type_vv_131> AgradCdfGamma_vv_131;
+typedef std::tuple<AgradCdfGamma, type_vv_132> AgradCdfGamma_vv_132;
+typedef std::tuple<AgradCdfGamma, type_vv_133> AgradCdfGamma_vv_133;
+typedef std::tuple<AgradCdfGamma, type_vv_134> AgradCdfGamma_vv_134;
+typedef std::tuple<AgradCdfGamma, type_vv_135> AgradCdfGamma_vv_135;
+typedef std::tuple<AgradCdfGamma, type_vv_136> AgradCdfGamma_vv_136;
+typedef std::tuple<AgradCdfGamma, type_vv_137> AgradCdfGamma_vv_137;
+typedef std::tuple<AgradCdfGamma, type_vv_138> AgradCdfGamma_vv_138;
+typedef std::tuple<AgradCdfGamma, type_vv_139> AgradCdfGamma_vv_139;
+typedef std::tuple<AgradCdfGamma, type_vv_140> AgradCdfGamma_vv_140;
+typedef std::tuple<AgradCdfGamma, type_vv_141> AgradCdfGamma_vv_141;
+typedef std::tuple<AgradCdfGamma, type_vv_142> AgradCdfGamma_vv_142;
+typedef std::tuple<AgradCdfGamma, type_vv_143> AgradCdfGamma_vv_143;
+typedef std::tuple<AgradCdfGamma, type_vv_144> AgradCdfGamma_vv_144;
+typedef std::tuple<AgradCdfGamma, type_vv_145> AgradCdfGamma_vv_145;
+typedef std::tuple<AgradCdfGamma, type_vv_146> AgradCdfGamma_vv_146;
+typedef std::tuple<AgradCdfGamma, type_vv_147> AgradCdfGamma_vv_147;
+typedef std::tuple<AgradCdfGamma, type_vv_148> AgradCdfGamma_vv_148;
+typedef std::tuple<AgradCdfGamma, type_vv_149> AgradCdfGamma_vv_149;
+typedef std::tuple<AgradCdfGamma, type_vv_150> AgradCdfGamma_vv_150;
+typedef std::tuple<AgradCdfGamma, type_vv_151> AgradCdfGamma_vv_151;
+typedef std::tuple<AgradCdfGamma, type_vv_152> AgradCdfGamma_vv_152;
+typedef std::tuple<AgradCdfGamma, type_vv_153> AgradCdfGamma_vv_153;
+typedef std::tuple<AgradCdfGamma, type_vv_154> AgradCdfGamma_vv_154;
+typedef std::tuple<AgradCdfGamma, type_vv_155> AgradCdfGamma_vv_155;
+typedef std::tuple<AgradCdfGamma, type_vv_156> AgradCdfGamma_vv_156;
+typedef std::tuple<AgradCdfGamma, type_vv_157> AgradCdfGamma_vv_157;
+typedef std::tuple<AgradCdfGamma, type_vv_158> AgradCdfGamma_vv_158;
+typedef std::tuple<AgradCdfGamma, type_vv_159> AgradCdfGamma_vv_159;
+typedef std::tuple<AgradCdfGamma, type_vv_160> AgradCdfGamma_vv_160;
+typedef std::tuple<AgradCdfGamma, type_vv_161> AgradCdfGamma_vv_161;
+typedef std::tuple<AgradCdfGamma, type_vv_162> AgradCdfGamma_vv_162;
+typedef std::tuple<AgradCdfGamma, type_vv_163> AgradCdfGamma_vv_163;
+typedef std::tuple<AgradCdfGamma, type_vv_164> AgradCdfGamma_vv_164;
+typedef std::tuple<AgradCdfGamma, type_vv_165> AgradCdfGamma_vv_165;
+typedef std::tuple<AgradCdfGamma, type_vv_166> AgradCdfGamma_vv_166;
+typedef std::tuple<AgradCdfGamma, type_vv_167> AgradCdfGamma_vv_167;
+typedef std::tuple<AgradCdfGamma, type_vv_168> AgradCdfGamma_vv_168;
+typedef std::tuple<AgradCdfGamma, type_vv_169> AgradCdfGamma_vv_169;
+typedef std::tuple<AgradCdfGamma, type_vv_170> AgradCdfGamma_vv_170;
+typedef std::tuple<AgradCdfGamma, type_vv_171> AgradCdfGamma_vv_171;
+typedef std::tuple<AgradCdfGamma, type_vv_172> AgradCdfGamma_vv_172;
+typedef std::tuple<AgradCdfGamma, type_vv_173> AgradCdfGamma_vv_173;
+typedef std::tuple<AgradCdfGamma, type_vv_174> AgradCdfGamma_vv_174;
+typedef std::tuple<AgradCdfGamma, type_vv_175> AgradCdfGamma_vv_175;
+typedef std::tuple<AgradCdfGamma, type_vv_176> AgradCdfGamma_vv_176;
+typedef std::tuple<AgradCdfGamma, type_vv_177> AgradCdfGamma_vv_177;
+typedef std::tuple<AgradCdfGamma, type_vv_178> AgradCdfGamma_vv_178;
+typedef std::tuple<AgradCdfGamma, type_vv_179> AgradCdfGamma_vv_179;
+typedef std::tuple<AgradCdfGamma, type_vv_180> AgradCdfGamma_vv_180;
+typedef std::tuple<AgradCdfGamma, type_vv_181> AgradCdfGamma_vv_181;
+typedef std::tuple<AgradCdfGamma, type_vv_182> AgradCdfGamma_vv_182;
+typedef std::tuple<AgradCdfGamma, type_vv_183> AgradCdfGamma_vv_183;
+typedef std::tuple<AgradCdfGamma, type_vv_184> AgradCdfGamma_vv_184;
+typedef std::tuple<AgradCdfGamma, type_vv_185> AgradCdfGamma_vv_185;
+typedef std::tuple<AgradCdfGamma, type_vv_186> AgradCdfGamma_vv_186;
+typedef std::tuple<AgradCdfGamma, type_vv_187> AgradCdfGamma_vv_187;
+typedef std::tuple<AgradCdfGamma, type_vv_188> AgradCdfGamma_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_100, AgradCdfTestFixture, AgradCdfGamma_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_101, AgradCdfTestFixture, AgradCdfGamma_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_102, AgradCdfTestFixture, AgradCdfGamma_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_103, AgradCdfTestFixture, AgradCdfGamma_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_104, AgradCdfTestFixture, AgradCdfGamma_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_105, AgradCdfTestFixture, AgradCdfGamma_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_106, AgradCdfTestFixture, AgradCdfGamma_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_107, AgradCdfTestFixture, AgradCdfGamma_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_108, AgradCdfTestFixture, AgradCdfGamma_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_109, AgradCdfTestFixture, AgradCdfGamma_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_110, AgradCdfTestFixture, AgradCdfGamma_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_111, AgradCdfTestFixture, AgradCdfGamma_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_112, AgradCdfTestFixture, AgradCdfGamma_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_113, AgradCdfTestFixture, AgradCdfGamma_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_114, AgradCdfTestFixture, AgradCdfGamma_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_115, AgradCdfTestFixture, AgradCdfGamma_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_116, AgradCdfTestFixture, AgradCdfGamma_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_117, AgradCdfTestFixture, AgradCdfGamma_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_118, AgradCdfTestFixture, AgradCdfGamma_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_119, AgradCdfTestFixture, AgradCdfGamma_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_120, AgradCdfTestFixture, AgradCdfGamma_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_121, AgradCdfTestFixture, AgradCdfGamma_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_122, AgradCdfTestFixture, AgradCdfGamma_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_123, AgradCdfTestFixture, AgradCdfGamma_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_124, AgradCdfTestFixture, AgradCdfGamma_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_125, AgradCdfTestFixture, AgradCdfGamma_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_126, AgradCdfTestFixture, AgradCdfGamma_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_127, AgradCdfTestFixture, AgradCdfGamma_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_128, AgradCdfTestFixture, AgradCdfGamma_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_129, AgradCdfTestFixture, AgradCdfGamma_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_130, AgradCdfTestFixture, AgradCdfGamma_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_131, AgradCdfTestFixture, AgradCdfGamma_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_132, AgradCdfTestFixture, AgradCdfGamma_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_133, AgradCdfTestFixture, AgradCdfGamma_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_134, AgradCdfTestFixture, AgradCdfGamma_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_135, AgradCdfTestFixture, AgradCdfGamma_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_136, AgradCdfTestFixture, AgradCdfGamma_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_137, AgradCdfTestFixture, AgradCdfGamma_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_138, AgradCdfTestFixture, AgradCdfGamma_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_139, AgradCdfTestFixture, AgradCdfGamma_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_140, AgradCdfTestFixture, AgradCdfGamma_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_141, AgradCdfTestFixture, AgradCdfGamma_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_142, AgradCdfTestFixture, AgradCdfGamma_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_143, AgradCdfTestFixture, AgradCdfGamma_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_144, AgradCdfTestFixture, AgradCdfGamma_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_145, AgradCdfTestFixture, AgradCdfGamma_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_146, AgradCdfTestFixture, AgradCdfGamma_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_147, AgradCdfTestFixture, AgradCdfGamma_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_148, AgradCdfTestFixture, AgradCdfGamma_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_149, AgradCdfTestFixture, AgradCdfGamma_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_150, AgradCdfTestFixture, AgradCdfGamma_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_151, AgradCdfTestFixture, AgradCdfGamma_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_152, AgradCdfTestFixture, AgradCdfGamma_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_153, AgradCdfTestFixture, AgradCdfGamma_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_154, AgradCdfTestFixture, AgradCdfGamma_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_155, AgradCdfTestFixture, AgradCdfGamma_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_156, AgradCdfTestFixture, AgradCdfGamma_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_157, AgradCdfTestFixture, AgradCdfGamma_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_158, AgradCdfTestFixture, AgradCdfGamma_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_159, AgradCdfTestFixture, AgradCdfGamma_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_160, AgradCdfTestFixture, AgradCdfGamma_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_161, AgradCdfTestFixture, AgradCdfGamma_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_162, AgradCdfTestFixture, AgradCdfGamma_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_163, AgradCdfTestFixture, AgradCdfGamma_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_164, AgradCdfTestFixture, AgradCdfGamma_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_165, AgradCdfTestFixture, AgradCdfGamma_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_166, AgradCdfTestFixture, AgradCdfGamma_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_167, AgradCdfTestFixture, AgradCdfGamma_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_168, AgradCdfTestFixture, AgradCdfGamma_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_169, AgradCdfTestFixture, AgradCdfGamma_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_170, AgradCdfTestFixture, AgradCdfGamma_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_171, AgradCdfTestFixture, AgradCdfGamma_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_172, AgradCdfTestFixture, AgradCdfGamma_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_173, AgradCdfTestFixture, AgradCdfGamma_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_174, AgradCdfTestFixture, AgradCdfGamma_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_175, AgradCdfTestFixture, AgradCdfGamma_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_176, AgradCdfTestFixture, AgradCdfGamma_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_177, AgradCdfTestFixture, AgradCdfGamma_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_178, AgradCdfTestFixture, AgradCdfGamma_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_179, AgradCdfTestFixture, AgradCdfGamma_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_180, AgradCdfTestFixture, AgradCdfGamma_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_181, AgradCdfTestFixture, AgradCdfGamma_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_182, AgradCdfTestFixture, AgradCdfGamma_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_183, AgradCdfTestFixture, AgradCdfGamma_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_184, AgradCdfTestFixture, AgradCdfGamma_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_185, AgradCdfTestFixture, AgradCdfGamma_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_186, AgradCdfTestFixture, AgradCdfGamma_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_187, AgradCdfTestFixture, AgradCdfGamma_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGamma_vv_188, AgradCdfTestFixture, AgradCdfGamma_vv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogGamma, type_ffv_0> AgradCdfLogGamma_ffv_0;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_1> AgradCdfLogGamma_ffv_1;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_2> AgradCdfLogGamma_ffv_2;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_3> AgradCdfLogGamma_ffv_3;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_4> AgradCdfLogGamma_ffv_4;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_5> AgradCdfLogGamma_ffv_5;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_6> AgradCdfLogGamma_ffv_6;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_7> AgradCdfLogGamma_ffv_7;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_8> AgradCdfLogGamma_ffv_8;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_9> AgradCdfLogGamma_ffv_9;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_10> AgradCdfLogGamma_ffv_10;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_11> AgradCdfLogGamma_ffv_11;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_12> AgradCdfLogGamma_ffv_12;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_13> AgradCdfLogGamma_ffv_13;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_14> AgradCdfLogGamma_ffv_14;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_15> AgradCdfLogGamma_ffv_15;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_16> AgradCdfLogGamma_ffv_16;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_17> AgradCdfLogGamma_ffv_17;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_18> AgradCdfLogGamma_ffv_18;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_19> AgradCdfLogGamma_ffv_19;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_20> AgradCdfLogGamma_ffv_20;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_21> AgradCdfLogGamma_ffv_21;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_22> AgradCdfLogGamma_ffv_22;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_23> AgradCdfLogGamma_ffv_23;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_24> AgradCdfLogGamma_ffv_24;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_25> AgradCdfLogGamma_ffv_25;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_26> AgradCdfLogGamma_ffv_26;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_27> AgradCdfLogGamma_ffv_27;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_28> AgradCdfLogGamma_ffv_28;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_29> AgradCdfLogGamma_ffv_29;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_30> AgradCdfLogGamma_ffv_30;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_31> AgradCdfLogGamma_ffv_31;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_32> AgradCdfLogGamma_ffv_32;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_33> AgradCdfLogGamma_ffv_33;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_34> AgradCdfLogGamma_ffv_34;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_35> AgradCdfLogGamma_ffv_35;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_36> AgradCdfLogGamma_ffv_36;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_37> AgradCdfLogGamma_ffv_37;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_38> AgradCdfLogGamma_ffv_38;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_39> AgradCdfLogGamma_ffv_39;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_40> AgradCdfLogGamma_ffv_40;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_41> AgradCdfLogGamma_ffv_41;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_42> AgradCdfLogGamma_ffv_42;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_43> AgradCdfLogGamma_ffv_43;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_44> AgradCdfLogGamma_ffv_44;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_45> AgradCdfLogGamma_ffv_45;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_46> AgradCdfLogGamma_ffv_46;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_47> AgradCdfLogGamma_ffv_47;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_48> AgradCdfLogGamma_ffv_48;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_49> AgradCdfLogGamma_ffv_49;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_50> AgradCdfLogGamma_ffv_50;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_51> AgradCdfLogGamma_ffv_51;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_52> AgradCdfLogGamma_ffv_52;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_53> AgradCdfLogGamma_ffv_53;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_54> AgradCdfLogGamma_ffv_54;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_55> AgradCdfLogGamma_ffv_55;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_56> AgradCdfLogGamma_ffv_56;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_57> AgradCdfLogGamma_ffv_57;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_58> AgradCdfLogGamma_ffv_58;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_59> AgradCdfLogGamma_ffv_59;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_60> AgradCdfLogGamma_ffv_60;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_61> AgradCdfLogGamma_ffv_61;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_62> AgradCdfLogGamma_ffv_62;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_63> AgradCdfLogGamma_ffv_63;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_64> AgradCdfLogGamma_ffv_64;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_65> AgradCdfLogGamma_ffv_65;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_66> AgradCdfLogGamma_ffv_66;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_67> AgradCdfLogGamma_ffv_67;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_68> AgradCdfLogGamma_ffv_68;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_69> AgradCdfLogGamma_ffv_69;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_70> AgradCdfLogGamma_ffv_70;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_71> AgradCdfLogGamma_ffv_71;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_72> AgradCdfLogGamma_ffv_72;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_73> AgradCdfLogGamma_ffv_73;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_74> AgradCdfLogGamma_ffv_74;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_75> AgradCdfLogGamma_ffv_75;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_76> AgradCdfLogGamma_ffv_76;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_77> AgradCdfLogGamma_ffv_77;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_78> AgradCdfLogGamma_ffv_78;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_79> AgradCdfLogGamma_ffv_79;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_80> AgradCdfLogGamma_ffv_80;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_81> AgradCdfLogGamma_ffv_81;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_82> AgradCdfLogGamma_ffv_82;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_83> AgradCdfLogGamma_ffv_83;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_84> AgradCdfLogGamma_ffv_84;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_85> AgradCdfLogGamma_ffv_85;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_86> AgradCdfLogGamma_ffv_86;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_87> AgradCdfLogGamma_ffv_87;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_88> AgradCdfLogGamma_ffv_88;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_89> AgradCdfLogGamma_ffv_89;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_90> AgradCdfLogGamma_ffv_90;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_91> AgradCdfLogGamma_ffv_91;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_92> AgradCdfLogGamma_ffv_92;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_93> AgradCdfLogGamma_ffv_93;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_94> AgradCdfLogGamma_ffv_94;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_95> AgradCdfLogGamma_ffv_95;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_96> AgradCdfLogGamma_ffv_96;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_97> AgradCdfLogGamma_ffv_97;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_98> AgradCdfLogGamma_ffv_98;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_99> AgradCdfLogGamma_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_0, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_1, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_2, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_3, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_4, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_5, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_6, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_7, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_8, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_9, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_10, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_11, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_12, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_13, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_14, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_15, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_16, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_17, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_18, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_19, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_20, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_21, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_22, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_23, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_24, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_25, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_26, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_27, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_28, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_29, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_30, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_31, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_32, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_33, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_34, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_35, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_36, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_37, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_38, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_39, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_40, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_41, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_42, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_43, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_44, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_45, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_46, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_47, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_48, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_49, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_50, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_51, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_52, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_53, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_54, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_55, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_56, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_57, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_58, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_59, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_60, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_61, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_62, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_63, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_64, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_65, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_66, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_67, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_68, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_69, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_70, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_71, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_72, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_73, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_74, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_75, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_76, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_77, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_78, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_79, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_80, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_81, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_82, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_83, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_84, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_85, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_86, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_87, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_88, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_89, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_90, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_91, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_92, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_93, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_94, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_95, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_96, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_97, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_98, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_99, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_99);
+
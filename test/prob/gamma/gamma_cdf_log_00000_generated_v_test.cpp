@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogGamma, type_v_0> AgradCdfLogGamma_v_0;
+typedef std::tuple<AgradCdfLogGamma, type_v_1> AgradCdfLogGamma_v_1;
+typedef std::tuple<AgradCdfLogGamma, type_v_2> AgradCdfLogGamma_v_2;
+typedef std::tuple<AgradCdfLogGamma, type_v_3> AgradCdfLogGamma_v_3;
+typedef std::tuple<AgradCdfLogGamma, type_v_4> AgradCdfLogGamma_v_4;
+typedef std::tuple<AgradCdfLogGamma, type_v_5> AgradCdfLogGamma_v_5;
+typedef std::tuple<AgradCdfLogGamma, type_v_6> AgradCdfLogGamma_v_6;
+typedef std::tuple<AgradCdfLogGamma, type_v_7> AgradCdfLogGamma_v_7;
+typedef std::tuple<AgradCdfLogGamma, type_v_8> AgradCdfLogGamma_v_8;
+typedef std::tuple<AgradCdfLogGamma, type_v_9> AgradCdfLogGamma_v_9;
+typedef std::tuple<AgradCdfLogGamma, type_v_10> AgradCdfLogGamma_v_10;
+typedef std::tuple<AgradCdfLogGamma, type_v_11> AgradCdfLogGamma_v_11;
+typedef std::tuple<AgradCdfLogGamma, type_v_12> AgradCdfLogGamma_v_12;
+typedef std::tuple<AgradCdfLogGamma, type_v_13> AgradCdfLogGamma_v_13;
+typedef std::tuple<AgradCdfLogGamma, type_v_14> AgradCdfLogGamma_v_14;
+typedef std::tuple<AgradCdfLogGamma, type_v_15> AgradCdfLogGamma_v_15;
+typedef std::tuple<AgradCdfLogGamma, type_v_16> AgradCdfLogGamma_v_16;
+typedef std::tuple<AgradCdfLogGamma, type_v_17> AgradCdfLogGamma_v_17;
+typedef std::tuple<AgradCdfLogGamma, type_v_18> AgradCdfLogGamma_v_18;
+typedef std::tuple<AgradCdfLogGamma, type_v_19> AgradCdfLogGamma_v_19;
+typedef std::tuple<AgradCdfLogGamma, type_v_20> AgradCdfLogGamma_v_20;
+typedef std::tuple<AgradCdfLogGamma, type_v_21> AgradCdfLogGamma_v_21;
+typedef std::tuple<AgradCdfLogGamma, type_v_22> AgradCdfLogGamma_v_22;
+typedef std::tuple<AgradCdfLogGamma, type_v_23> AgradCdfLogGamma_v_23;
+typedef std::tuple<AgradCdfLogGamma, type_v_24> AgradCdfLogGamma_v_24;
+typedef std::tuple<AgradCdfLogGamma, type_v_25> AgradCdfLogGamma_v_25;
+typedef std::tuple<AgradCdfLogGamma, type_v_26> AgradCdfLogGamma_v_26;
+typedef std::tuple<AgradCdfLogGamma, type_v_27> AgradCdfLogGamma_v_27;
+typedef std::tuple<AgradCdfLogGamma, type_v_28> AgradCdfLogGamma_v_28;
+typedef std::tuple<AgradCdfLogGamma, type_v_29> AgradCdfLogGamma_v_29;
+typedef std::tuple<AgradCdfLogGamma, type_v_30> AgradCdfLogGamma_v_30;
+typedef std::tuple<AgradCdfLogGamma, type_v_31> AgradCdfLogGamma_v_31;
+typedef std::tuple<AgradCdfLogGamma, type_v_32> AgradCdfLogGamma_v_32;
+typedef std::tuple<AgradCdfLogGamma, type_v_33> AgradCdfLogGamma_v_33;
+typedef std::tuple<AgradCdfLogGamma, type_v_34> AgradCdfLogGamma_v_34;
+typedef std::tuple<AgradCdfLogGamma, type_v_35> AgradCdfLogGamma_v_35;
+typedef std::tuple<AgradCdfLogGamma, type_v_36> AgradCdfLogGamma_v_36;
+typedef std::tuple<AgradCdfLogGamma, type_v_37> AgradCdfLogGamma_v_37;
+typedef std::tuple<AgradCdfLogGamma, type_v_38> AgradCdfLogGamma_v_38;
+typedef std::tuple<AgradCdfLogGamma, type_v_39> AgradCdfLogGamma_v_39;
+typedef std::tuple<AgradCdfLogGamma, type_v_40> AgradCdfLogGamma_v_40;
+typedef std::tuple<AgradCdfLogGamma, type_v_41> AgradCdfLogGamma_v_41;
+typedef std::tuple<AgradCdfLogGamma, type_v_42> AgradCdfLogGamma_v_42;
+typedef std::tuple<AgradCdfLogGamma, type_v_43> AgradCdfLogGamma_v_43;
+typedef std::tuple<AgradCdfLogGamma, type_v_44> AgradCdfLogGamma_v_44;
+typedef std::tuple<AgradCdfLogGamma, type_v_45> AgradCdfLogGamma_v_45;
+typedef std::tuple<AgradCdfLogGamma, type_v_46> AgradCdfLogGamma_v_46;
+typedef std::tuple<AgradCdfLogGamma, type_v_47> AgradCdfLogGamma_v_47;
+typedef std::tuple<AgradCdfLogGamma, type_v_48> AgradCdfLogGamma_v_48;
+typedef std::tuple<AgradCdfLogGamma, type_v_49> AgradCdfLogGamma_v_49;
+typedef std::tuple<AgradCdfLogGamma, type_v_50> AgradCdfLogGamma_v_50;
+typedef std::tuple<AgradCdfLogGamma, type_v_51> AgradCdfLogGamma_v_51;
+typedef std::tuple<AgradCdfLogGamma, type_v_52> AgradCdfLogGamma_v_52;
+typedef std::tuple<AgradCdfLogGamma, type_v_53> AgradCdfLogGamma_v_53;
+typedef std::tuple<AgradCdfLogGamma, type_v_54> AgradCdfLogGamma_v_54;
+typedef std::tuple<AgradCdfLogGamma, type_v_55> AgradCdfLogGamma_v_55;
+typedef std::tuple<AgradCdfLogGamma, type_v_56> AgradCdfLogGamma_v_56;
+typedef std::tuple<AgradCdfLogGamma, type_v_57> AgradCdfLogGamma_v_57;
+typedef std::tuple<AgradCdfLogGamma, type_v_58> AgradCdfLogGamma_v_58;
+typedef std::tuple<AgradCdfLogGamma, type_v_59> AgradCdfLogGamma_v_59;
+typedef std::tuple<AgradCdfLogGamma, type_v_60> AgradCdfLogGamma_v_60;
+typedef std::tuple<AgradCdfLogGamma, type_v_61> AgradCdfLogGamma_v_61;
+typedef std::tuple<AgradCdfLogGamma, type_v_62> AgradCdfLogGamma_v_62;
+typedef std::tuple<AgradCdfLogGamma, type_v_63> AgradCdfLogGamma_v_63;
+typedef std::tuple<AgradCdfLogGamma, type_v_64> AgradCdfLogGamma_v_64;
+typedef std::tuple<AgradCdfLogGamma, type_v_65> AgradCdfLogGamma_v_65;
+typedef std::tuple<AgradCdfLogGamma, type_v_66> AgradCdfLogGamma_v_66;
+typedef std::tuple<AgradCdfLogGamma, type_v_67> AgradCdfLogGamma_v_67;
+typedef std::tuple<AgradCdfLogGamma, type_v_68> AgradCdfLogGamma_v_68;
+typedef std::tuple<AgradCdfLogGamma, type_v_69> AgradCdfLogGamma_v_69;
+typedef std::tuple<AgradCdfLogGamma, type_v_70> AgradCdfLogGamma_v_70;
+typedef std::tuple<AgradCdfLogGamma, type_v_71> AgradCdfLogGamma_v_71;
+typedef std::tuple<AgradCdfLogGamma, type_v_72> AgradCdfLogGamma_v_72;
+typedef std::tuple<AgradCdfLogGamma, type_v_73> AgradCdfLogGamma_v_73;
+typedef std::tuple<AgradCdfLogGamma, type_v_74> AgradCdfLogGamma_v_74;
+typedef std::tuple<AgradCdfLogGamma, type_v_75> AgradCdfLogGamma_v_75;
+typedef std::tuple<AgradCdfLogGamma, type_v_76> AgradCdfLogGamma_v_76;
+typedef std::tuple<AgradCdfLogGamma, type_v_77> AgradCdfLogGamma_v_77;
+typedef std::tuple<AgradCdfLogGamma, type_v_78> AgradCdfLogGamma_v_78;
+typedef std::tuple<AgradCdfLogGamma, type_v_79> AgradCdfLogGamma_v_79;
+typedef std::tuple<AgradCdfLogGamma, type_v_80> AgradCdfLogGamma_v_80;
+typedef std::tuple<AgradCdfLogGamma, type_v_81> AgradCdfLogGamma_v_81;
+typedef std::tuple<AgradCdfLogGamma, type_v_82> AgradCdfLogGamma_v_82;
+typedef std::tuple<AgradCdfLogGamma, type_v_83> AgradCdfLogGamma_v_83;
+typedef std::tuple<AgradCdfLogGamma, type_v_84> AgradCdfLogGamma_v_84;
+typedef std::tuple<AgradCdfLogGamma, type_v_85> AgradCdfLogGamma_v_85;
+typedef std::tuple<AgradCdfLogGamma, type_v_86> AgradCdfLogGamma_v_86;
+typedef std::tuple<AgradCdfLogGamma, type_v_87> AgradCdfLogGamma_v_87;
+typedef std::tuple<AgradCdfLogGamma, type_v_88> AgradCdfLogGamma_v_88;
+typedef std::tuple<AgradCdfLogGamma, type_v_89> AgradCdfLogGamma_v_89;
+typedef std::tuple<AgradCdfLogGamma, type_v_90> AgradCdfLogGamma_v_90;
+typedef std::tuple<AgradCdfLogGamma, type_v_91> AgradCdfLogGamma_v_91;
+typedef std::tuple<AgradCdfLogGamma, type_v_92> AgradCdfLogGamma_v_92;
+typedef std::tuple<AgradCdfLogGamma, type_v_93> AgradCdfLogGamma_v_93;
+typedef std::tuple<AgradCdfLogGamma, type_v_94> AgradCdfLogGamma_v_94;
+typedef std::tuple<AgradCdfLogGamma, type_v_95> AgradCdfLogGamma_v_95;
+typedef std::tuple<AgradCdfLogGamma, type_v_96> AgradCdfLogGamma_v_96;
+typedef std::tuple<AgradCdfLogGamma, type_v_97> AgradCdfLogGamma_v_97;
+typedef std::tuple<AgradCdfLogGamma, type_v_98> AgradCdfLogGamma_v_98;
+typedef std::tuple<AgradCdfLogGamma, type_v_99> AgradCdfLogGamma_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_0, AgradCdfLogTestFixture, AgradCdfLogGamma_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_1, AgradCdfLogTestFixture, AgradCdfLogGamma_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_2, AgradCdfLogTestFixture, AgradCdfLogGamma_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_3, AgradCdfLogTestFixture, AgradCdfLogGamma_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_4, AgradCdfLogTestFixture, AgradCdfLogGamma_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_5, AgradCdfLogTestFixture, AgradCdfLogGamma_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_6, AgradCdfLogTestFixture, AgradCdfLogGamma_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_7, AgradCdfLogTestFixture, AgradCdfLogGamma_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_8, AgradCdfLogTestFixture, AgradCdfLogGamma_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_9, AgradCdfLogTestFixture, AgradCdfLogGamma_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_10, AgradCdfLogTestFixture, AgradCdfLogGamma_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_11, AgradCdfLogTestFixture, AgradCdfLogGamma_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_12, AgradCdfLogTestFixture, AgradCdfLogGamma_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_13, AgradCdfLogTestFixture, AgradCdfLogGamma_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_14, AgradCdfLogTestFixture, AgradCdfLogGamma_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_15, AgradCdfLogTestFixture, AgradCdfLogGamma_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_16, AgradCdfLogTestFixture, AgradCdfLogGamma_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_17, AgradCdfLogTestFixture, AgradCdfLogGamma_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_18, AgradCdfLogTestFixture, AgradCdfLogGamma_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_19, AgradCdfLogTestFixture, AgradCdfLogGamma_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_20, AgradCdfLogTestFixture, AgradCdfLogGamma_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_21, AgradCdfLogTestFixture, AgradCdfLogGamma_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_22, AgradCdfLogTestFixture, AgradCdfLogGamma_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_23, AgradCdfLogTestFixture, AgradCdfLogGamma_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_24, AgradCdfLogTestFixture, AgradCdfLogGamma_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_25, AgradCdfLogTestFixture, AgradCdfLogGamma_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_26, AgradCdfLogTestFixture, AgradCdfLogGamma_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_27, AgradCdfLogTestFixture, AgradCdfLogGamma_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_28, AgradCdfLogTestFixture, AgradCdfLogGamma_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_29, AgradCdfLogTestFixture, AgradCdfLogGamma_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_30, AgradCdfLogTestFixture, AgradCdfLogGamma_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_31, AgradCdfLogTestFixture, AgradCdfLogGamma_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_32, AgradCdfLogTestFixture, AgradCdfLogGamma_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_33, AgradCdfLogTestFixture, AgradCdfLogGamma_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_34, AgradCdfLogTestFixture, AgradCdfLogGamma_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_35, AgradCdfLogTestFixture, AgradCdfLogGamma_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_36, AgradCdfLogTestFixture, AgradCdfLogGamma_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_37, AgradCdfLogTestFixture, AgradCdfLogGamma_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_38, AgradCdfLogTestFixture, AgradCdfLogGamma_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_39, AgradCdfLogTestFixture, AgradCdfLogGamma_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_40, AgradCdfLogTestFixture, AgradCdfLogGamma_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_41, AgradCdfLogTestFixture, AgradCdfLogGamma_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_42, AgradCdfLogTestFixture, AgradCdfLogGamma_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_43, AgradCdfLogTestFixture, AgradCdfLogGamma_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_44, AgradCdfLogTestFixture, AgradCdfLogGamma_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_45, AgradCdfLogTestFixture, AgradCdfLogGamma_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_46, AgradCdfLogTestFixture, AgradCdfLogGamma_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_47, AgradCdfLogTestFixture, AgradCdfLogGamma_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_48, AgradCdfLogTestFixture, AgradCdfLogGamma_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_49, AgradCdfLogTestFixture, AgradCdfLogGamma_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_50, AgradCdfLogTestFixture, AgradCdfLogGamma_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_51, AgradCdfLogTestFixture, AgradCdfLogGamma_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_52, AgradCdfLogTestFixture, AgradCdfLogGamma_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_53, AgradCdfLogTestFixture, AgradCdfLogGamma_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_54, AgradCdfLogTestFixture, AgradCdfLogGamma_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_55, AgradCdfLogTestFixture, AgradCdfLogGamma_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_56, AgradCdfLogTestFixture, AgradCdfLogGamma_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_57, AgradCdfLogTestFixture, AgradCdfLogGamma_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_58, AgradCdfLogTestFixture, AgradCdfLogGamma_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_59, AgradCdfLogTestFixture, AgradCdfLogGamma_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_60, AgradCdfLogTestFixture, AgradCdfLogGamma_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_61, AgradCdfLogTestFixture, AgradCdfLogGamma_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_62, AgradCdfLogTestFixture, AgradCdfLogGamma_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_63, AgradCdfLogTestFixture, AgradCdfLogGamma_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_64, AgradCdfLogTestFixture, AgradCdfLogGamma_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_65, AgradCdfLogTestFixture, AgradCdfLogGamma_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_66, AgradCdfLogTestFixture, AgradCdfLogGamma_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_67, AgradCdfLogTestFixture, AgradCdfLogGamma_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_68, AgradCdfLogTestFixture, AgradCdfLogGamma_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_69, AgradCdfLogTestFixture, AgradCdfLogGamma_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_70, AgradCdfLogTestFixture, AgradCdfLogGamma_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_71, AgradCdfLogTestFixture, AgradCdfLogGamma_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_72, AgradCdfLogTestFixture, AgradCdfLogGamma_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_73, AgradCdfLogTestFixture, AgradCdfLogGamma_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_74, AgradCdfLogTestFixture, AgradCdfLogGamma_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_75, AgradCdfLogTestFixture, AgradCdfLogGamma_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_76, AgradCdfLogTestFixture, AgradCdfLogGamma_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_77, AgradCdfLogTestFixture, AgradCdfLogGamma_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_78, AgradCdfLogTestFixture, AgradCdfLogGamma_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_79, AgradCdfLogTestFixture, AgradCdfLogGamma_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_80, AgradCdfLogTestFixture, AgradCdfLogGamma_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_81, AgradCdfLogTestFixture, AgradCdfLogGamma_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_82, AgradCdfLogTestFixture, AgradCdfLogGamma_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_83, AgradCdfLogTestFixture, AgradCdfLogGamma_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_84, AgradCdfLogTestFixture, AgradCdfLogGamma_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_85, AgradCdfLogTestFixture, AgradCdfLogGamma_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_86, AgradCdfLogTestFixture, AgradCdfLogGamma_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_87, AgradCdfLogTestFixture, AgradCdfLogGamma_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_88, AgradCdfLogTestFixture, AgradCdfLogGamma_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_89, AgradCdfLogTestFixture, AgradCdfLogGamma_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_90, AgradCdfLogTestFixture, AgradCdfLogGamma_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_91, AgradCdfLogTestFixture, AgradCdfLogGamma_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_92, AgradCdfLogTestFixture, AgradCdfLogGamma_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_93, AgradCdfLogTestFixture, AgradCdfLogGamma_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_94, AgradCdfLogTestFixture, AgradCdfLogGamma_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_95, AgradCdfLogTestFixture, AgradCdfLogGamma_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_96, AgradCdfLogTestFixture, AgradCdfLogGamma_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_97, AgradCdfLogTestFixture, AgradCdfLogGamma_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_98, AgradCdfLogTestFixture, AgradCdfLogGamma_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_99, AgradCdfLogTestFixture, AgradCdfLogGamma_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogGamma, type_vv_0> AgradCdfLogGamma_vv_0;
+typedef std::tuple<AgradCdfLogGamma, type_vv_1> AgradCdfLogGamma_vv_1;
+typedef std::tuple<AgradCdfLogGamma, type_vv_2> AgradCdfLogGamma_vv_2;
+typedef std::tuple<AgradCdfLogGamma, type_vv_3> AgradCdfLogGamma_vv_3;
+typedef std::tuple<AgradCdfLogGamma, type_vv_4> AgradCdfLogGamma_vv_4;
+typedef std::tuple<AgradCdfLogGamma, type_vv_5> AgradCdfLogGamma_vv_5;
+typedef std::tuple<AgradCdfLogGamma, type_vv_6> AgradCdfLogGamma_vv_6;
+typedef std::tuple<AgradCdfLogGamma, type_vv_7> AgradCdfLogGamma_vv_7;
+typedef std::tuple<AgradCdfLogGamma, type_vv_8> AgradCdfLogGamma_vv_8;
+typedef std::tuple<AgradCdfLogGamma, type_vv_9> AgradCdfLogGamma_vv_9;
+typedef std::tuple<AgradCdfLogGamma, type_vv_10> AgradCdfLogGamma_vv_10;
+typedef std::tuple<AgradCdfLogGamma, type_vv_11> AgradCdfLogGamma_vv_11;
+typedef std::tuple<AgradCdfLogGamma, type_vv_12> AgradCdfLogGamma_vv_12;
+typedef std::tuple<AgradCdfLogGamma, type_vv_13> AgradCdfLogGamma_vv_13;
+typedef std::tuple<AgradCdfLogGamma, type_vv_14> AgradCdfLogGamma_vv_14;
+typedef std::tuple<AgradCdfLogGamma, type_vv_15> AgradCdfLogGamma_vv_15;
+typedef std::tuple<AgradCdfLogGamma, type_vv_16> AgradCdfLogGamma_vv_16;
+typedef std::tuple<AgradCdfLogGamma, type_vv_17> AgradCdfLogGamma_vv_17;
+typedef std::tuple<AgradCdfLogGamma, type_vv_18> AgradCdfLogGamma_vv_18;
+typedef std::tuple<AgradCdfLogGamma, type_vv_19> AgradCdfLogGamma_vv_19;
+typedef std::tuple<AgradCdfLogGamma, type_vv_20> AgradCdfLogGamma_vv_20;
+typedef std::tuple<AgradCdfLogGamma, type_vv_21> AgradCdfLogGamma_vv_21;
+typedef std::tuple<AgradCdfLogGamma, type_vv_22> AgradCdfLogGamma_vv_22;
+typedef std::tuple<AgradCdfLogGamma, type_vv_23> AgradCdfLogGamma_vv_23;
+typedef std::tuple<AgradCdfLogGamma, type_vv_24> AgradCdfLogGamma_vv_24;
+typedef std::tuple<AgradCdfLogGamma, type_vv_25> AgradCdfLogGamma_vv_25;
+typedef std::tuple<AgradCdfLogGamma, type_vv_26> AgradCdfLogGamma_vv_26;
+typedef std::tuple<AgradCdfLogGamma, type_vv_27> AgradCdfLogGamma_vv_27;
+typedef std::tuple<AgradCdfLogGamma, type_vv_28> AgradCdfLogGamma_vv_28;
+typedef std::tuple<AgradCdfLogGamma, type_vv_29> AgradCdfLogGamma_vv_29;
+typedef std::tuple<AgradCdfLogGamma, type_vv_30> AgradCdfLogGamma_vv_30;
+typedef std::tuple<AgradCdfLogGamma, type_vv_31> AgradCdfLogGamma_vv_31;
+typedef std::tuple<AgradCdfLogGamma, type_vv_32> AgradCdfLogGamma_vv_32;
+typedef std::tuple<AgradCdfLogGamma, type_vv_33> AgradCdfLogGamma_vv_33;
+typedef std::tuple<AgradCdfLogGamma, type_vv_34> AgradCdfLogGamma_vv_34;
+typedef std::tuple<AgradCdfLogGamma, type_vv_35> AgradCdfLogGamma_vv_35;
+typedef std::tuple<AgradCdfLogGamma, type_vv_36> AgradCdfLogGamma_vv_36;
+typedef std::tuple<AgradCdfLogGamma, type_vv_37> AgradCdfLogGamma_vv_37;
+typedef std::tuple<AgradCdfLogGamma, type_vv_38> AgradCdfLogGamma_vv_38;
+typedef std::tuple<AgradCdfLogGamma, type_vv_39> AgradCdfLogGamma_vv_39;
+typedef std::tuple<AgradCdfLogGamma, type_vv_40> AgradCdfLogGamma_vv_40;
+typedef std::tuple<AgradCdfLogGamma, type_vv_41> AgradCdfLogGamma_vv_41;
+typedef std::tuple<AgradCdfLogGamma, type_vv_42> AgradCdfLogGamma_vv_42;
+typedef std::tuple<AgradCdfLogGamma, type_vv_43> AgradCdfLogGamma_vv_43;
+typedef std::tuple<AgradCdfLogGamma, type_vv_44> AgradCdfLogGamma_vv_44;
+typedef std::tuple<AgradCdfLogGamma, type_vv_45> AgradCdfLogGamma_vv_45;
+typedef std::tuple<AgradCdfLogGamma, type_vv_46> AgradCdfLogGamma_vv_46;
+typedef std::tuple<AgradCdfLogGamma, type_vv_47> AgradCdfLogGamma_vv_47;
+typedef std::tuple<AgradCdfLogGamma, type_vv_48> AgradCdfLogGamma_vv_48;
+typedef std::tuple<AgradCdfLogGamma, type_vv_49> AgradCdfLogGamma_vv_49;
+typedef std::tuple<AgradCdfLogGamma, type_vv_50> AgradCdfLogGamma_vv_50;
+typedef std::tuple<AgradCdfLogGamma, type_vv_51> AgradCdfLogGamma_vv_51;
+typedef std::tuple<AgradCdfLogGamma, type_vv_52> AgradCdfLogGamma_vv_52;
+typedef std::tuple<AgradCdfLogGamma, type_vv_53> AgradCdfLogGamma_vv_53;
+typedef std::tuple<AgradCdfLogGamma, type_vv_54> AgradCdfLogGamma_vv_54;
+typedef std::tuple<AgradCdfLogGamma, type_vv_55> AgradCdfLogGamma_vv_55;
+typedef std::tuple<AgradCdfLogGamma, type_vv_56> AgradCdfLogGamma_vv_56;
+typedef std::tuple<AgradCdfLogGamma, type_vv_57> AgradCdfLogGamma_vv_57;
+typedef std::tuple<AgradCdfLogGamma, type_vv_58> AgradCdfLogGamma_vv_58;
+typedef std::tuple<AgradCdfLogGamma, type_vv_59> AgradCdfLogGamma_vv_59;
+typedef std::tuple<AgradCdfLogGamma, type_vv_60> AgradCdfLogGamma_vv_60;
+typedef std::tuple<AgradCdfLogGamma, type_vv_61> AgradCdfLogGamma_vv_61;
+typedef std::tuple<AgradCdfLogGamma, type_vv_62> AgradCdfLogGamma_vv_62;
+typedef std::tuple<AgradCdfLogGamma, type_vv_63> AgradCdfLogGamma_vv_63;
+typedef std::tuple<AgradCdfLogGamma, type_vv_64> AgradCdfLogGamma_vv_64;
+typedef std::tuple<AgradCdfLogGamma, type_vv_65> AgradCdfLogGamma_vv_65;
+typedef std::tuple<AgradCdfLogGamma, type_vv_66> AgradCdfLogGamma_vv_66;
+typedef std::tuple<AgradCdfLogGamma, type_vv_67> AgradCdfLogGamma_vv_67;
+typedef std::tuple<AgradCdfLogGamma, type_vv_68> AgradCdfLogGamma_vv_68;
+typedef std::tuple<AgradCdfLogGamma, type_vv_69> AgradCdfLogGamma_vv_69;
+typedef std::tuple<AgradCdfLogGamma, type_vv_70> AgradCdfLogGamma_vv_70;
+typedef std::tuple<AgradCdfLogGamma, type_vv_71> AgradCdfLogGamma_vv_71;
+typedef std::tuple<AgradCdfLogGamma, type_vv_72> AgradCdfLogGamma_vv_72;
+typedef std::tuple<AgradCdfLogGamma, type_vv_73> AgradCdfLogGamma_vv_73;
+typedef std::tuple<AgradCdfLogGamma, type_vv_74> AgradCdfLogGamma_vv_74;
+typedef std::tuple<AgradCdfLogGamma, type_vv_75> AgradCdfLogGamma_vv_75;
+typedef std::tuple<AgradCdfLogGamma, type_vv_76> AgradCdfLogGamma_vv_76;
+typedef std::tuple<AgradCdfLogGamma, type_vv_77> AgradCdfLogGamma_vv_77;
+typedef std::tuple<AgradCdfLogGamma, type_vv_78> AgradCdfLogGamma_vv_78;
+typedef std::tuple<AgradCdfLogGamma, type_vv_79> AgradCdfLogGamma_vv_79;
+typedef std::tuple<AgradCdfLogGamma, type_vv_80> AgradCdfLogGamma_vv_80;
+typedef std::tuple<AgradCdfLogGamma, type_vv_81> AgradCdfLogGamma_vv_81;
+typedef std::tuple<AgradCdfLogGamma, type_vv_82> AgradCdfLogGamma_vv_82;
+typedef std::tuple<AgradCdfLogGamma, type_vv_83> AgradCdfLogGamma_vv_83;
+typedef std::tuple<AgradCdfLogGamma, type_vv_84> AgradCdfLogGamma_vv_84;
+typedef std::tuple<AgradCdfLogGamma, type_vv_85> AgradCdfLogGamma_vv_85;
+typedef std::tuple<AgradCdfLogGamma, type_vv_86> AgradCdfLogGamma_vv_86;
+typedef std::tuple<AgradCdfLogGamma, type_vv_87> AgradCdfLogGamma_vv_87;
+typedef std::tuple<AgradCdfLogGamma, type_vv_88> AgradCdfLogGamma_vv_88;
+typedef std::tuple<AgradCdfLogGamma, type_vv_89> AgradCdfLogGamma_vv_89;
+typedef std::tuple<AgradCdfLogGamma, type_vv_90> AgradCdfLogGamma_vv_90;
+typedef std::tuple<AgradCdfLogGamma, type_vv_91> AgradCdfLogGamma_vv_91;
+typedef std::tuple<AgradCdfLogGamma, type_vv_92> AgradCdfLogGamma_vv_92;
+typedef std::tuple<AgradCdfLogGamma, type_vv_93> AgradCdfLogGamma_vv_93;
+typedef std::tuple<AgradCdfLogGamma, type_vv_94> AgradCdfLogGamma_vv_94;
+typedef std::tuple<AgradCdfLogGamma, type_vv_95> AgradCdfLogGamma_vv_95;
+typedef std::tuple<AgradCdfLogGamma, type_vv_96> AgradCdfLogGamma_vv_96;
+typedef std::tuple<AgradCdfLogGamma, type_vv_97> AgradCdfLogGamma_vv_97;
+typedef std::tuple<AgradCdfLogGamma, type_vv_98> AgradCdfLogGamma_vv_98;
+typedef std::tuple<AgradCdfLogGamma, type_vv_99> AgradCdfLogGamma_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_0, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_1, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_2, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_3, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_4, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_5, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_6, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_7, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_8, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_9, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_10, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_11, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_12, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_13, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_14, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_15, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_16, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_17, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_18, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_19, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_20, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_21, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_22, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_23, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_24, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_25, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_26, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_27, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_28, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_29, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_30, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_31, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_32, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_33, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_34, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_35, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_36, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_37, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_38, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_39, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_40, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_41, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_42, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_43, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_44, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_45, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_46, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_47, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_48, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_49, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_50, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_51, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_52, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_53, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_54, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_55, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_56, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_57, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_58, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_59, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_60, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_61, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_62, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_63, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_64, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_65, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_66, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_67, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_68, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_69, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_70, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_71, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_72, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_73, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_74, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_75, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_76, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_77, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_78, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_79, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_80, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_81, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_82, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_83, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_84, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_85, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_86, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_87, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_88, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_89, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_90, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_91, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_92, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_93, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_94, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_95, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_96, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_97, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_98, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_99, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogGamma, type_ffv_100> AgradCdfLogGamma_ffv_100;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_101> AgradCdfLogGamma_ffv_101;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_102> AgradCdfLogGamma_ffv_102;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_103> AgradCdfLogGamma_ffv_103;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_104> AgradCdfLogGamma_ffv_104;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_105> AgradCdfLogGamma_ffv_105;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_106> AgradCdfLogGamma_ffv_106;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_107> AgradCdfLogGamma_ffv_107;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_108> AgradCdfLogGamma_ffv_108;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_109> AgradCdfLogGamma_ffv_109;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_110> AgradCdfLogGamma_ffv_110;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_111> AgradCdfLogGamma_ffv_111;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_112> AgradCdfLogGamma_ffv_112;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_113> AgradCdfLogGamma_ffv_113;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_114> AgradCdfLogGamma_ffv_114;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_115> AgradCdfLogGamma_ffv_115;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_116> AgradCdfLogGamma_ffv_116;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_117> AgradCdfLogGamma_ffv_117;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_118> AgradCdfLogGamma_ffv_118;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_119> AgradCdfLogGamma_ffv_119;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_120> AgradCdfLogGamma_ffv_120;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_121> AgradCdfLogGamma_ffv_121;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_122> AgradCdfLogGamma_ffv_122;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_123> AgradCdfLogGamma_ffv_123;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_124> AgradCdfLogGamma_ffv_124;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_125> AgradCdfLogGamma_ffv_125;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_126> AgradCdfLogGamma_ffv_126;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_127> AgradCdfLogGamma_ffv_127;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_128> AgradCdfLogGamma_ffv_128;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_129> AgradCdfLogGamma_ffv_129;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_130> AgradCdfLogGamma_ffv_130;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_131> AgradCdfLogGamma_ffv_131;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_132> AgradCdfLogGamma_ffv_132;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_133> AgradCdfLogGamma_ffv_133;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_134> AgradCdfLogGamma_ffv_134;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_135> AgradCdfLogGamma_ffv_135;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_136> AgradCdfLogGamma_ffv_136;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_137> AgradCdfLogGamma_ffv_137;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_138> AgradCdfLogGamma_ffv_138;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_139> AgradCdfLogGamma_ffv_139;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_140> AgradCdfLogGamma_ffv_140;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_141> AgradCdfLogGamma_ffv_141;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_142> AgradCdfLogGamma_ffv_142;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_143> AgradCdfLogGamma_ffv_143;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_144> AgradCdfLogGamma_ffv_144;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_145> AgradCdfLogGamma_ffv_145;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_146> AgradCdfLogGamma_ffv_146;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_147> AgradCdfLogGamma_ffv_147;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_148> AgradCdfLogGamma_ffv_148;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_149> AgradCdfLogGamma_ffv_149;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_150> AgradCdfLogGamma_ffv_150;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_151> AgradCdfLogGamma_ffv_151;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_152> AgradCdfLogGamma_ffv_152;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_153> AgradCdfLogGamma_ffv_153;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_154> AgradCdfLogGamma_ffv_154;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_155> AgradCdfLogGamma_ffv_155;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_156> AgradCdfLogGamma_ffv_156;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_157> AgradCdfLogGamma_ffv_157;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_158> AgradCdfLogGamma_ffv_158;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_159> AgradCdfLogGamma_ffv_159;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_160> AgradCdfLogGamma_ffv_160;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_161> AgradCdfLogGamma_ffv_161;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_162> AgradCdfLogGamma_ffv_162;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_163> AgradCdfLogGamma_ffv_163;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_164> AgradCdfLogGamma_ffv_164;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_165> AgradCdfLogGamma_ffv_165;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_166> AgradCdfLogGamma_ffv_166;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_167> AgradCdfLogGamma_ffv_167;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_168> AgradCdfLogGamma_ffv_168;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_169> AgradCdfLogGamma_ffv_169;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_170> AgradCdfLogGamma_ffv_170;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_171> AgradCdfLogGamma_ffv_171;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_172> AgradCdfLogGamma_ffv_172;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_173> AgradCdfLogGamma_ffv_173;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_174> AgradCdfLogGamma_ffv_174;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_175> AgradCdfLogGamma_ffv_175;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_176> AgradCdfLogGamma_ffv_176;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_177> AgradCdfLogGamma_ffv_177;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_178> AgradCdfLogGamma_ffv_178;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_179> AgradCdfLogGamma_ffv_179;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_180> AgradCdfLogGamma_ffv_180;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_181> AgradCdfLogGamma_ffv_181;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_182> AgradCdfLogGamma_ffv_182;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_183> AgradCdfLogGamma_ffv_183;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_184> AgradCdfLogGamma_ffv_184;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_185> AgradCdfLogGamma_ffv_185;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_186> AgradCdfLogGamma_ffv_186;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_187> AgradCdfLogGamma_ffv_187;
+typedef std::tuple<AgradCdfLogGamma, type_ffv_188> AgradCdfLogGamma_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_100, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_101, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_102, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_103, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_104, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_105, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_106, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_107, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_108, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_109, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_110, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_111, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_112, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_113, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_114, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_115, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_116, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_117, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_118, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_119, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_120, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_121, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_122, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_123, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_124, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_125, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_126, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_127, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_128, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_129, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_130, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_131, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_132, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_133, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_134, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_135, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_136, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_137, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_138, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_139, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_140, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_141, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_142, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_143, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_144, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_145, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_146, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_147, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_148, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_149, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_150, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_151, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_152, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_153, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_154, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_155, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_156, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_157, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_158, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_159, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_160, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_161, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_162, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_163, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_164, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_165, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_166, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_167, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_168, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_169, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_170, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_171, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_172, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_173, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_174, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_175, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_176, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_177, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_178, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_179, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_180, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_181, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_182, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_183, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_184, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_185, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_186, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_187, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_ffv_188, AgradCdfLogTestFixture, AgradCdfLogGamma_ffv_188);
+
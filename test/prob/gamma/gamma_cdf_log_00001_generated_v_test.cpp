@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogGamma, type_v_100> AgradCdfLogGamma_v_100;
+typedef std::tuple<AgradCdfLogGamma, type_v_101> AgradCdfLogGamma_v_101;
+typedef std::tuple<AgradCdfLogGamma, type_v_102> AgradCdfLogGamma_v_102;
+typedef std::tuple<AgradCdfLogGamma, type_v_103> AgradCdfLogGamma_v_103;
+typedef std::tuple<AgradCdfLogGamma, type_v_104> AgradCdfLogGamma_v_104;
+typedef std::tuple<AgradCdfLogGamma, type_v_105> AgradCdfLogGamma_v_105;
+typedef std::tuple<AgradCdfLogGamma, type_v_106> AgradCdfLogGamma_v_106;
+typedef std::tuple<AgradCdfLogGamma, type_v_107> AgradCdfLogGamma_v_107;
+typedef std::tuple<AgradCdfLogGamma, type_v_108> AgradCdfLogGamma_v_108;
+typedef std::tuple<AgradCdfLogGamma, type_v_109> AgradCdfLogGamma_v_109;
+typedef std::tuple<AgradCdfLogGamma, type_v_110> AgradCdfLogGamma_v_110;
+typedef std::tuple<AgradCdfLogGamma, type_v_111> AgradCdfLogGamma_v_111;
+typedef std::tuple<AgradCdfLogGamma, type_v_112> AgradCdfLogGamma_v_112;
+typedef std::tuple<AgradCdfLogGamma, type_v_113> AgradCdfLogGamma_v_113;
+typedef std::tuple<AgradCdfLogGamma, type_v_114> AgradCdfLogGamma_v_114;
+typedef std::tuple<AgradCdfLogGamma, type_v_115> AgradCdfLogGamma_v_115;
+typedef std::tuple<AgradCdfLogGamma, type_v_116> AgradCdfLogGamma_v_116;
+typedef std::tuple<AgradCdfLogGamma, type_v_117> AgradCdfLogGamma_v_117;
+typedef std::tuple<AgradCdfLogGamma, type_v_118> AgradCdfLogGamma_v_118;
+typedef std::tuple<AgradCdfLogGamma, type_v_119> AgradCdfLogGamma_v_119;
+typedef std::tuple<AgradCdfLogGamma, type_v_120> AgradCdfLogGamma_v_120;
+typedef std::tuple<AgradCdfLogGamma, type_v_121> AgradCdfLogGamma_v_121;
+typedef std::tuple<AgradCdfLogGamma, type_v_122> AgradCdfLogGamma_v_122;
+typedef std::tuple<AgradCdfLogGamma, type_v_123> AgradCdfLogGamma_v_123;
+typedef std::tuple<AgradCdfLogGamma, type_v_124> AgradCdfLogGamma_v_124;
+typedef std::tuple<AgradCdfLogGamma, type_v_125> AgradCdfLogGamma_v_125;
+typedef std::tuple<AgradCdfLogGamma, type_v_126> AgradCdfLogGamma_v_126;
+typedef std::tuple<AgradCdfLogGamma, type_v_127> AgradCdfLogGamma_v_127;
+typedef std::tuple<AgradCdfLogGamma, type_v_128> AgradCdfLogGamma_v_128;
+typedef std::tuple<AgradCdfLogGamma, type_v_129> AgradCdfLogGamma_v_129;
+typedef std::tuple<AgradCdfLogGamma, type_v_130> AgradCdfLogGamma_v_130;
+typedef std::tuple<AgradCdfLogGamma, type_v_131> AgradCdfLogGamma_v_131;
+typedef std::tuple<AgradCdfLogGamma, type_v_132> AgradCdfLogGamma_v_132;
+typedef std::tuple<AgradCdfLogGamma, type_v_133> AgradCdfLogGamma_v_133;
+typedef std::tuple<AgradCdfLogGamma, type_v_134> AgradCdfLogGamma_v_134;
+typedef std::tuple<AgradCdfLogGamma, type_v_135> AgradCdfLogGamma_v_135;
+typedef std::tuple<AgradCdfLogGamma, type_v_136> AgradCdfLogGamma_v_136;
+typedef std::tuple<AgradCdfLogGamma, type_v_137> AgradCdfLogGamma_v_137;
+typedef std::tuple<AgradCdfLogGamma, type_v_138> AgradCdfLogGamma_v_138;
+typedef std::tuple<AgradCdfLogGamma, type_v_139> AgradCdfLogGamma_v_139;
+typedef std::tuple<AgradCdfLogGamma, type_v_140> AgradCdfLogGamma_v_140;
+typedef std::tuple<AgradCdfLogGamma, type_v_141> AgradCdfLogGamma_v_141;
+typedef std::tuple<AgradCdfLogGamma, type_v_142> AgradCdfLogGamma_v_142;
+typedef std::tuple<AgradCdfLogGamma, type_v_143> AgradCdfLogGamma_v_143;
+typedef std::tuple<AgradCdfLogGamma, type_v_144> AgradCdfLogGamma_v_144;
+typedef std::tuple<AgradCdfLogGamma, type_v_145> AgradCdfLogGamma_v_145;
+typedef std::tuple<AgradCdfLogGamma, type_v_146> AgradCdfLogGamma_v_146;
+typedef std::tuple<AgradCdfLogGamma, type_v_147> AgradCdfLogGamma_v_147;
+typedef std::tuple<AgradCdfLogGamma, type_v_148> AgradCdfLogGamma_v_148;
+typedef std::tuple<AgradCdfLogGamma, type_v_149> AgradCdfLogGamma_v_149;
+typedef std::tuple<AgradCdfLogGamma, type_v_150> AgradCdfLogGamma_v_150;
+typedef std::tuple<AgradCdfLogGamma, type_v_151> AgradCdfLogGamma_v_151;
+typedef std::tuple<AgradCdfLogGamma, type_v_152> AgradCdfLogGamma_v_152;
+typedef std::tuple<AgradCdfLogGamma, type_v_153> AgradCdfLogGamma_v_153;
+typedef std::tuple<AgradCdfLogGamma, type_v_154> AgradCdfLogGamma_v_154;
+typedef std::tuple<AgradCdfLogGamma, type_v_155> AgradCdfLogGamma_v_155;
+typedef std::tuple<AgradCdfLogGamma, type_v_156> AgradCdfLogGamma_v_156;
+typedef std::tuple<AgradCdfLogGamma, type_v_157> AgradCdfLogGamma_v_157;
+typedef std::tuple<AgradCdfLogGamma, type_v_158> AgradCdfLogGamma_v_158;
+typedef std::tuple<AgradCdfLogGamma, type_v_159> AgradCdfLogGamma_v_159;
+typedef std::tuple<AgradCdfLogGamma, type_v_160> AgradCdfLogGamma_v_160;
+typedef std::tuple<AgradCdfLogGamma, type_v_161> AgradCdfLogGamma_v_161;
+typedef std::tuple<AgradCdfLogGamma, type_v_162> AgradCdfLogGamma_v_162;
+typedef std::tuple<AgradCdfLogGamma, type_v_163> AgradCdfLogGamma_v_163;
+typedef std::tuple<AgradCdfLogGamma, type_v_164> AgradCdfLogGamma_v_164;
+typedef std::tuple<AgradCdfLogGamma, type_v_165> AgradCdfLogGamma_v_165;
+typedef std::tuple<AgradCdfLogGamma, type_v_166> AgradCdfLogGamma_v_166;
+typedef std::tuple<AgradCdfLogGamma, type_v_167> AgradCdfLogGamma_v_167;
+typedef std::tuple<AgradCdfLogGamma, type_v_168> AgradCdfLogGamma_v_168;
+typedef std::tuple<AgradCdfLogGamma, type_v_169> AgradCdfLogGamma_v_169;
+typedef std::tuple<AgradCdfLogGamma, type_v_170> AgradCdfLogGamma_v_170;
+typedef std::tuple<AgradCdfLogGamma, type_v_171> AgradCdfLogGamma_v_171;
+typedef std::tuple<AgradCdfLogGamma, type_v_172> AgradCdfLogGamma_v_172;
+typedef std::tuple<AgradCdfLogGamma, type_v_173> AgradCdfLogGamma_v_173;
+typedef std::tuple<AgradCdfLogGamma, type_v_174> AgradCdfLogGamma_v_174;
+typedef std::tuple<AgradCdfLogGamma, type_v_175> AgradCdfLogGamma_v_175;
+typedef std::tuple<AgradCdfLogGamma, type_v_176> AgradCdfLogGamma_v_176;
+typedef std::tuple<AgradCdfLogGamma, type_v_177> AgradCdfLogGamma_v_177;
+typedef std::tuple<AgradCdfLogGamma, type_v_178> AgradCdfLogGamma_v_178;
+typedef std::tuple<AgradCdfLogGamma, type_v_179> AgradCdfLogGamma_v_179;
+typedef std::tuple<AgradCdfLogGamma, type_v_180> AgradCdfLogGamma_v_180;
+typedef std::tuple<AgradCdfLogGamma, type_v_181> AgradCdfLogGamma_v_181;
+typedef std::tuple<AgradCdfLogGamma, type_v_182> AgradCdfLogGamma_v_182;
+typedef std::tuple<AgradCdfLogGamma, type_v_183> AgradCdfLogGamma_v_183;
+typedef std::tuple<AgradCdfLogGamma, type_v_184> AgradCdfLogGamma_v_184;
+typedef std::tuple<AgradCdfLogGamma, type_v_185> AgradCdfLogGamma_v_185;
+typedef std::tuple<AgradCdfLogGamma, type_v_186> AgradCdfLogGamma_v_186;
+typedef std::tuple<AgradCdfLogGamma, type_v_187> AgradCdfLogGamma_v_187;
+typedef std::tuple<AgradCdfLogGamma, type_v_188> AgradCdfLogGamma_v_188;
+typedef std::tuple<AgradCdfLogGamma, type_v_189> AgradCdfLogGamma_v_189;
+typedef std::tuple<AgradCdfLogGamma, type_v_190> AgradCdfLogGamma_v_190;
+typedef std::tuple<AgradCdfLogGamma, type_v_191> AgradCdfLogGamma_v_191;
+typedef std::tuple<AgradCdfLogGamma, type_v_192> AgradCdfLogGamma_v_192;
+typedef std::tuple<AgradCdfLogGamma, type_v_193> AgradCdfLogGamma_v_193;
+typedef std::tuple<AgradCdfLogGamma, type_v_194> AgradCdfLogGamma_v_194;
+typedef std::tuple<AgradCdfLogGamma, type_v_195> AgradCdfLogGamma_v_195;
+typedef std::tuple<AgradCdfLogGamma, type_v_196> AgradCdfLogGamma_v_196;
+typedef std::tuple<AgradCdfLogGamma, type_v_197> AgradCdfLogGamma_v_197;
+typedef std::tuple<AgradCdfLogGamma, type_v_198> AgradCdfLogGamma_v_198;
+typedef std::tuple<AgradCdfLogGamma, type_v_199> AgradCdfLogGamma_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_100, AgradCdfLogTestFixture, AgradCdfLogGamma_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_101, AgradCdfLogTestFixture, AgradCdfLogGamma_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_102, AgradCdfLogTestFixture, AgradCdfLogGamma_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_103, AgradCdfLogTestFixture, AgradCdfLogGamma_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_104, AgradCdfLogTestFixture, AgradCdfLogGamma_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_105, AgradCdfLogTestFixture, AgradCdfLogGamma_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_106, AgradCdfLogTestFixture, AgradCdfLogGamma_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_107, AgradCdfLogTestFixture, AgradCdfLogGamma_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_108, AgradCdfLogTestFixture, AgradCdfLogGamma_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_109, AgradCdfLogTestFixture, AgradCdfLogGamma_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_110, AgradCdfLogTestFixture, AgradCdfLogGamma_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_111, AgradCdfLogTestFixture, AgradCdfLogGamma_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_112, AgradCdfLogTestFixture, AgradCdfLogGamma_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_113, AgradCdfLogTestFixture, AgradCdfLogGamma_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_114, AgradCdfLogTestFixture, AgradCdfLogGamma_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_115, AgradCdfLogTestFixture, AgradCdfLogGamma_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_116, AgradCdfLogTestFixture, AgradCdfLogGamma_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_117, AgradCdfLogTestFixture, AgradCdfLogGamma_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_118, AgradCdfLogTestFixture, AgradCdfLogGamma_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_119, AgradCdfLogTestFixture, AgradCdfLogGamma_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_120, AgradCdfLogTestFixture, AgradCdfLogGamma_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_121, AgradCdfLogTestFixture, AgradCdfLogGamma_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_122, AgradCdfLogTestFixture, AgradCdfLogGamma_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_123, AgradCdfLogTestFixture, AgradCdfLogGamma_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_124, AgradCdfLogTestFixture, AgradCdfLogGamma_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_125, AgradCdfLogTestFixture, AgradCdfLogGamma_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_126, AgradCdfLogTestFixture, AgradCdfLogGamma_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_127, AgradCdfLogTestFixture, AgradCdfLogGamma_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_128, AgradCdfLogTestFixture, AgradCdfLogGamma_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_129, AgradCdfLogTestFixture, AgradCdfLogGamma_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_130, AgradCdfLogTestFixture, AgradCdfLogGamma_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_131, AgradCdfLogTestFixture, AgradCdfLogGamma_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_132, AgradCdfLogTestFixture, AgradCdfLogGamma_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_133, AgradCdfLogTestFixture, AgradCdfLogGamma_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_134, AgradCdfLogTestFixture, AgradCdfLogGamma_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_135, AgradCdfLogTestFixture, AgradCdfLogGamma_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_136, AgradCdfLogTestFixture, AgradCdfLogGamma_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_137, AgradCdfLogTestFixture, AgradCdfLogGamma_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_138, AgradCdfLogTestFixture, AgradCdfLogGamma_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_139, AgradCdfLogTestFixture, AgradCdfLogGamma_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_140, AgradCdfLogTestFixture, AgradCdfLogGamma_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_141, AgradCdfLogTestFixture, AgradCdfLogGamma_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_142, AgradCdfLogTestFixture, AgradCdfLogGamma_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_143, AgradCdfLogTestFixture, AgradCdfLogGamma_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_144, AgradCdfLogTestFixture, AgradCdfLogGamma_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_145, AgradCdfLogTestFixture, AgradCdfLogGamma_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_146, AgradCdfLogTestFixture, AgradCdfLogGamma_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_147, AgradCdfLogTestFixture, AgradCdfLogGamma_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_148, AgradCdfLogTestFixture, AgradCdfLogGamma_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_149, AgradCdfLogTestFixture, AgradCdfLogGamma_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_150, AgradCdfLogTestFixture, AgradCdfLogGamma_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_151, AgradCdfLogTestFixture, AgradCdfLogGamma_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_152, AgradCdfLogTestFixture, AgradCdfLogGamma_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_153, AgradCdfLogTestFixture, AgradCdfLogGamma_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_154, AgradCdfLogTestFixture, AgradCdfLogGamma_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_155, AgradCdfLogTestFixture, AgradCdfLogGamma_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_156, AgradCdfLogTestFixture, AgradCdfLogGamma_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_157, AgradCdfLogTestFixture, AgradCdfLogGamma_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_158, AgradCdfLogTestFixture, AgradCdfLogGamma_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_159, AgradCdfLogTestFixture, AgradCdfLogGamma_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_160, AgradCdfLogTestFixture, AgradCdfLogGamma_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_161, AgradCdfLogTestFixture, AgradCdfLogGamma_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_162, AgradCdfLogTestFixture, AgradCdfLogGamma_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_163, AgradCdfLogTestFixture, AgradCdfLogGamma_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_164, AgradCdfLogTestFixture, AgradCdfLogGamma_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_165, AgradCdfLogTestFixture, AgradCdfLogGamma_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_166, AgradCdfLogTestFixture, AgradCdfLogGamma_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_167, AgradCdfLogTestFixture, AgradCdfLogGamma_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_168, AgradCdfLogTestFixture, AgradCdfLogGamma_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_169, AgradCdfLogTestFixture, AgradCdfLogGamma_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_170, AgradCdfLogTestFixture, AgradCdfLogGamma_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_171, AgradCdfLogTestFixture, AgradCdfLogGamma_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_172, AgradCdfLogTestFixture, AgradCdfLogGamma_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_173, AgradCdfLogTestFixture, AgradCdfLogGamma_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_174, AgradCdfLogTestFixture, AgradCdfLogGamma_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_175, AgradCdfLogTestFixture, AgradCdfLogGamma_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_176, AgradCdfLogTestFixture, AgradCdfLogGamma_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_177, AgradCdfLogTestFixture, AgradCdfLogGamma_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_178, AgradCdfLogTestFixture, AgradCdfLogGamma_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_179, AgradCdfLogTestFixture, AgradCdfLogGamma_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_180, AgradCdfLogTestFixture, AgradCdfLogGamma_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_181, AgradCdfLogTestFixture, AgradCdfLogGamma_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_182, AgradCdfLogTestFixture, AgradCdfLogGamma_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_183, AgradCdfLogTestFixture, AgradCdfLogGamma_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_184, AgradCdfLogTestFixture, AgradCdfLogGamma_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_185, AgradCdfLogTestFixture, AgradCdfLogGamma_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_186, AgradCdfLogTestFixture, AgradCdfLogGamma_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_187, AgradCdfLogTestFixture, AgradCdfLogGamma_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_188, AgradCdfLogTestFixture, AgradCdfLogGamma_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_189, AgradCdfLogTestFixture, AgradCdfLogGamma_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_190, AgradCdfLogTestFixture, AgradCdfLogGamma_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_191, AgradCdfLogTestFixture, AgradCdfLogGamma_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_192, AgradCdfLogTestFixture, AgradCdfLogGamma_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_193, AgradCdfLogTestFixture, AgradCdfLogGamma_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_194, AgradCdfLogTestFixture, AgradCdfLogGamma_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_195, AgradCdfLogTestFixture, AgradCdfLogGamma_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_196, AgradCdfLogTestFixture, AgradCdfLogGamma_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_197, AgradCdfLogTestFixture, AgradCdfLogGamma_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_198, AgradCdfLogTestFixture, AgradCdfLogGamma_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_199, AgradCdfLogTestFixture, AgradCdfLogGamma_v_199);
+
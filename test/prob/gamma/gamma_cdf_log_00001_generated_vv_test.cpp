@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogGamma, type_vv_100> AgradCdfLogGamma_vv_100;
+typedef std::tuple<AgradCdfLogGamma, type_vv_101> AgradCdfLogGamma_vv_101;
+typedef std::tuple<AgradCdfLogGamma, type_vv_102> AgradCdfLogGamma_vv_102;
+typedef std::tuple<AgradCdfLogGamma, type_vv_103> AgradCdfLogGamma_vv_103;
+typedef std::tuple<AgradCdfLogGamma, type_vv_104> AgradCdfLogGamma_vv_104;
+typedef std::tuple<AgradCdfLogGamma, type_vv_105> AgradCdfLogGamma_vv_105;
+typedef std::tuple<AgradCdfLogGamma, type_vv_106> AgradCdfLogGamma_vv_106;
+typedef std::tuple<AgradCdfLogGamma, type_vv_107> AgradCdfLogGamma_vv_107;
+typedef std::tuple<AgradCdfLogGamma, type_vv_108> AgradCdfLogGamma_vv_108;
+typedef std::tuple<AgradCdfLogGamma, type_vv_109> AgradCdfLogGamma_vv_109;
+typedef std::tuple<AgradCdfLogGamma, type_vv_110> AgradCdfLogGamma_vv_110;
+typedef std::tuple<AgradCdfLogGamma, type_vv_111> AgradCdfLogGamma_vv_111;
+typedef std::tuple<AgradCdfLogGamma, type_vv_112> AgradCdfLogGamma_vv_112;
+typedef std::tuple<AgradCdfLogGamma, type_vv_113> AgradCdfLogGamma_vv_113;
+typedef std::tuple<AgradCdfLogGamma, type_vv_114> AgradCdfLogGamma_vv_114;
+typedef std::tuple<AgradCdfLogGamma, type_vv_115> AgradCdfLogGamma_vv_115;
+typedef std::tuple<AgradCdfLogGamma, type_vv_116> AgradCdfLogGamma_vv_116;
+typedef std::tuple<AgradCdfLogGamma, type_vv_117> AgradCdfLogGamma_vv_117;
+typedef std::tuple<AgradCdfLogGamma, type_vv_118> AgradCdfLogGamma_vv_118;
+typedef std::tuple<AgradCdfLogGamma, type_vv_119> AgradCdfLogGamma_vv_119;
+typedef std::tuple<AgradCdfLogGamma, type_vv_120> AgradCdfLogGamma_vv_120;
+typedef std::tuple<AgradCdfLogGamma, type_vv_121> AgradCdfLogGamma_vv_121;
+typedef std::tuple<AgradCdfLogGamma, type_vv_122> AgradCdfLogGamma_vv_122;
+typedef std::tuple<AgradCdfLogGamma, type_vv_123> AgradCdfLogGamma_vv_123;
+typedef std::tuple<AgradCdfLogGamma, type_vv_124> AgradCdfLogGamma_vv_124;
+typedef std::tuple<AgradCdfLogGamma, type_vv_125> AgradCdfLogGamma_vv_125;
+typedef std::tuple<AgradCdfLogGamma, type_vv_126> AgradCdfLogGamma_vv_126;
+typedef std::tuple<AgradCdfLogGamma, type_vv_127> AgradCdfLogGamma_vv_127;
+typedef std::tuple<AgradCdfLogGamma, type_vv_128> AgradCdfLogGamma_vv_128;
+typedef std::tuple<AgradCdfLogGamma, type_vv_129> AgradCdfLogGamma_vv_129;
+typedef std::tuple<AgradCdfLogGamma, type_vv_130> AgradCdfLogGamma_vv_130;
+typedef std::tuple<AgradCdfLogGamma, type_vv_131> AgradCdfLogGamma_vv_131;
+typedef std::tuple<AgradCdfLogGamma, type_vv_132> AgradCdfLogGamma_vv_132;
+typedef std::tuple<AgradCdfLogGamma, type_vv_133> AgradCdfLogGamma_vv_133;
+typedef std::tuple<AgradCdfLogGamma, type_vv_134> AgradCdfLogGamma_vv_134;
+typedef std::tuple<AgradCdfLogGamma, type_vv_135> AgradCdfLogGamma_vv_135;
+typedef std::tuple<AgradCdfLogGamma, type_vv_136> AgradCdfLogGamma_vv_136;
+typedef std::tuple<AgradCdfLogGamma, type_vv_137> AgradCdfLogGamma_vv_137;
+typedef std::tuple<AgradCdfLogGamma, type_vv_138> AgradCdfLogGamma_vv_138;
+typedef std::tuple<AgradCdfLogGamma, type_vv_139> AgradCdfLogGamma_vv_139;
+typedef std::tuple<AgradCdfLogGamma, type_vv_140> AgradCdfLogGamma_vv_140;
+typedef std::tuple<AgradCdfLogGamma, type_vv_141> AgradCdfLogGamma_vv_141;
+typedef std::tuple<AgradCdfLogGamma, type_vv_142> AgradCdfLogGamma_vv_142;
+typedef std::tuple<AgradCdfLogGamma, type_vv_143> AgradCdfLogGamma_vv_143;
+typedef std::tuple<AgradCdfLogGamma, type_vv_144> AgradCdfLogGamma_vv_144;
+typedef std::tuple<AgradCdfLogGamma, type_vv_145> AgradCdfLogGamma_vv_145;
+typedef std::tuple<AgradCdfLogGamma, type_vv_146> AgradCdfLogGamma_vv_146;
+typedef std::tuple<AgradCdfLogGamma, type_vv_147> AgradCdfLogGamma_vv_147;
+typedef std::tuple<AgradCdfLogGamma, type_vv_148> AgradCdfLogGamma_vv_148;
+typedef std::tuple<AgradCdfLogGamma, type_vv_149> AgradCdfLogGamma_vv_149;
+typedef std::tuple<AgradCdfLogGamma, type_vv_150> AgradCdfLogGamma_vv_150;
+typedef std::tuple<AgradCdfLogGamma, type_vv_151> AgradCdfLogGamma_vv_151;
+typedef std::tuple<AgradCdfLogGamma, type_vv_152> AgradCdfLogGamma_vv_152;
+typedef std::tuple<AgradCdfLogGamma, type_vv_153> AgradCdfLogGamma_vv_153;
+typedef std::tuple<AgradCdfLogGamma, type_vv_154> AgradCdfLogGamma_vv_154;
+typedef std::tuple<AgradCdfLogGamma, type_vv_155> AgradCdfLogGamma_vv_155;
+typedef std::tuple<AgradCdfLogGamma, type_vv_156> AgradCdfLogGamma_vv_156;
+typedef std::tuple<AgradCdfLogGamma, type_vv_157> AgradCdfLogGamma_vv_157;
+typedef std::tuple<AgradCdfLogGamma, type_vv_158> AgradCdfLogGamma_vv_158;
+typedef std::tuple<AgradCdfLogGamma, type_vv_159> AgradCdfLogGamma_vv_159;
+typedef std::tuple<AgradCdfLogGamma, type_vv_160> AgradCdfLogGamma_vv_160;
+typedef std::tuple<AgradCdfLogGamma, type_vv_161> AgradCdfLogGamma_vv_161;
+typedef std::tuple<AgradCdfLogGamma, type_vv_162> AgradCdfLogGamma_vv_162;
+typedef std::tuple<AgradCdfLogGamma, type_vv_163> AgradCdfLogGamma_vv_163;
+typedef std::tuple<AgradCdfLogGamma, type_vv_164> AgradCdfLogGamma_vv_164;
+typedef std::tuple<AgradCdfLogGamma, type_vv_165> AgradCdfLogGamma_vv_165;
+typedef std::tuple<AgradCdfLogGamma, type_vv_166> AgradCdfLogGamma_vv_166;
+typedef std::tuple<AgradCdfLogGamma, type_vv_167> AgradCdfLogGamma_vv_167;
+typedef std::tuple<AgradCdfLogGamma, type_vv_168> AgradCdfLogGamma_vv_168;
+typedef std::tuple<AgradCdfLogGamma, type_vv_169> AgradCdfLogGamma_vv_169;
+typedef std::tuple<AgradCdfLogGamma, type_vv_170> AgradCdfLogGamma_vv_170;
+typedef std::tuple<AgradCdfLogGamma, type_vv_171> AgradCdfLogGamma_vv_171;
+typedef std::tuple<AgradCdfLogGamma, type_vv_172> AgradCdfLogGamma_vv_172;
+typedef std::tuple<AgradCdfLogGamma, type_vv_173> AgradCdfLogGamma_vv_173;
+typedef std::tuple<AgradCdfLogGamma, type_vv_174> AgradCdfLogGamma_vv_174;
+typedef std::tuple<AgradCdfLogGamma, type_vv_175> AgradCdfLogGamma_vv_175;
+typedef std::tuple<AgradCdfLogGamma, type_vv_176> AgradCdfLogGamma_vv_176;
+typedef std::tuple<AgradCdfLogGamma, type_vv_177> AgradCdfLogGamma_vv_177;
+typedef std::tuple<AgradCdfLogGamma, type_vv_178> AgradCdfLogGamma_vv_178;
+typedef std::tuple<AgradCdfLogGamma, type_vv_179> AgradCdfLogGamma_vv_179;
+typedef std::tuple<AgradCdfLogGamma, type_vv_180> AgradCdfLogGamma_vv_180;
+typedef std::tuple<AgradCdfLogGamma, type_vv_181> AgradCdfLogGamma_vv_181;
+typedef std::tuple<AgradCdfLogGamma, type_vv_182> AgradCdfLogGamma_vv_182;
+typedef std::tuple<AgradCdfLogGamma, type_vv_183> AgradCdfLogGamma_vv_183;
+typedef std::tuple<AgradCdfLogGamma, type_vv_184> AgradCdfLogGamma_vv_184;
+typedef std::tuple<AgradCdfLogGamma, type_vv_185> AgradCdfLogGamma_vv_185;
+typedef std::tuple<AgradCdfLogGamma, type_vv_186> AgradCdfLogGamma_vv_186;
+typedef std::tuple<AgradCdfLogGamma, type_vv_187> AgradCdfLogGamma_vv_187;
+typedef std::tuple<AgradCdfLogGamma, type_vv_188> AgradCdfLogGamma_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_100, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_101, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_102, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_103, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_104, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_105, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_106, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_107, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_108, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_109, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_110, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_111, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_112, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_113, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_114, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_115, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_116, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_117, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_118, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_119, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_120, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_121, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_122, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_123, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_124, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_125, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_126, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_127, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_128, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_129, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_130, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_131, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_132, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_133, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_134, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_135, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_136, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_137, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_138, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_139, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_140, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_141, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_142, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_143, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_144, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_145, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_146, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_147, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_148, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_149, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_150, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_151, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_152, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_153, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_154, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_155, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_156, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_157, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_158, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_159, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_160, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_161, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_162, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_163, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_164, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_165, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_166, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_167, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_168, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_169, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_170, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_171, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_172, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_173, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_174, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_175, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_176, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_177, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_178, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_179, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_180, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_181, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_182, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_183, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_184, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_185, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_186, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_187, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_vv_188, AgradCdfLogTestFixture, AgradCdfLogGamma_vv_188);
+
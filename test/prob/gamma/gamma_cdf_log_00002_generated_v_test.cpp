@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gamma/gamma_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCdfLogGamma, type_v_200> AgradCdfLogGamma_v_200;
+typedef std::tuple<AgradCdfLogGamma, type_v_201> AgradCdfLogGamma_v_201;
+typedef std::tuple<AgradCdfLogGamma, type_v_202> AgradCdfLogGamma_v_202;
+typedef std::tuple<AgradCdfLogGamma, type_v_203> AgradCdfLogGamma_v_203;
+typedef std::tuple<AgradCdfLogGamma, type_v_204> AgradCdfLogGamma_v_204;
+typedef std::tuple<AgradCdfLogGamma, type_v_205> AgradCdfLogGamma_v_205;
+typedef std::tuple<AgradCdfLogGamma, type_v_206> AgradCdfLogGamma_v_206;
+typedef std::tuple<AgradCdfLogGamma, type_v_207> AgradCdfLogGamma_v_207;
+typedef std::tuple<AgradCdfLogGamma, type_v_208> AgradCdfLogGamma_v_208;
+typedef std::tuple<AgradCdfLogGamma, type_v_209> AgradCdfLogGamma_v_209;
+typedef std::tuple<AgradCdfLogGamma, type_v_210> AgradCdfLogGamma_v_210;
+typedef std::tuple<AgradCdfLogGamma, type_v_211> AgradCdfLogGamma_v_211;
+typedef std::tuple<AgradCdfLogGamma, type_v_212> AgradCdfLogGamma_v_212;
+typedef std::tuple<AgradCdfLogGamma, type_v_213> AgradCdfLogGamma_v_213;
+typedef std::tuple<AgradCdfLogGamma, type_v_214> AgradCdfLogGamma_v_214;
+typedef std::tuple<AgradCdfLogGamma, type_v_215> AgradCdfLogGamma_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_200, AgradCdfLogTestFixture, AgradCdfLogGamma_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_201, AgradCdfLogTestFixture, AgradCdfLogGamma_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_202, AgradCdfLogTestFixture, AgradCdfLogGamma_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_203, AgradCdfLogTestFixture, AgradCdfLogGamma_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_204, AgradCdfLogTestFixture, AgradCdfLogGamma_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_205, AgradCdfLogTestFixture, AgradCdfLogGamma_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_206, AgradCdfLogTestFixture, AgradCdfLogGamma_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_207, AgradCdfLogTestFixture, AgradCdfLogGamma_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_208, AgradCdfLogTestFixture, AgradCdfLogGamma_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_209, AgradCdfLogTestFixture, AgradCdfLogGamma_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_210, AgradCdfLogTestFixture, AgradCdfLogGamma_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_211, AgradCdfLogTestFixture, AgradCdfLogGamma_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_212, AgradCdfLogTestFixture, AgradCdfLogGamma_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_213, AgradCdfLogTestFixture, AgradCdfLogGamma_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_214, AgradCdfLogTestFixture, AgradCdfLogGamma_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGamma_v_215, AgradCdfLogTestFixture, AgradCdfLogGamma_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionGumbel, type_ffv_0> AgradDistributionGumbel_ffv_0;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_1> AgradDistributionGumbel_ffv_1;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_2> AgradDistributionGumbel_ffv_2;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_3> AgradDistributionGumbel_ffv_3;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_4> AgradDistributionGumbel_ffv_4;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_5> AgradDistributionGumbel_ffv_5;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_6> AgradDistributionGumbel_ffv_6;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_7> AgradDistributionGumbel_ffv_7;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_8> AgradDistributionGumbel_ffv_8;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_9> AgradDistributionGumbel_ffv_9;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_10> AgradDistributionGumbel_ffv_10;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_11> AgradDistributionGumbel_ffv_11;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_12> AgradDistributionGumbel_ffv_12;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_13> AgradDistributionGumbel_ffv_13;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_14> AgradDistributionGumbel_ffv_14;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_15> AgradDistributionGumbel_ffv_15;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_16> AgradDistributionGumbel_ffv_16;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_17> AgradDistributionGumbel_ffv_17;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_18> AgradDistributionGumbel_ffv_18;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_19> AgradDistributionGumbel_ffv_19;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_20> AgradDistributionGumbel_ffv_20;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_21> AgradDistributionGumbel_ffv_21;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_22> AgradDistributionGumbel_ffv_22;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_23> AgradDistributionGumbel_ffv_23;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_24> AgradDistributionGumbel_ffv_24;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_25> AgradDistributionGumbel_ffv_25;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_26> AgradDistributionGumbel_ffv_26;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_27> AgradDistributionGumbel_ffv_27;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_28> AgradDistributionGumbel_ffv_28;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_29> AgradDistributionGumbel_ffv_29;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_30> AgradDistributionGumbel_ffv_30;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_31> AgradDistributionGumbel_ffv_31;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_32> AgradDistributionGumbel_ffv_32;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_33> AgradDistributionGumbel_ffv_33;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_34> AgradDistributionGumbel_ffv_34;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_35> AgradDistributionGumbel_ffv_35;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_36> AgradDistributionGumbel_ffv_36;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_37> AgradDistributionGumbel_ffv_37;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_38> AgradDistributionGumbel_ffv_38;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_39> AgradDistributionGumbel_ffv_39;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_40> AgradDistributionGumbel_ffv_40;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_41> AgradDistributionGumbel_ffv_41;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_42> AgradDistributionGumbel_ffv_42;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_43> AgradDistributionGumbel_ffv_43;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_44> AgradDistributionGumbel_ffv_44;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_45> AgradDistributionGumbel_ffv_45;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_46> AgradDistributionGumbel_ffv_46;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_47> AgradDistributionGumbel_ffv_47;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_48> AgradDistributionGumbel_ffv_48;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_49> AgradDistributionGumbel_ffv_49;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_50> AgradDistributionGumbel_ffv_50;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_51> AgradDistributionGumbel_ffv_51;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_52> AgradDistributionGumbel_ffv_52;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_53> AgradDistributionGumbel_ffv_53;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_54> AgradDistributionGumbel_ffv_54;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_55> AgradDistributionGumbel_ffv_55;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_56> AgradDistributionGumbel_ffv_56;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_57> AgradDistributionGumbel_ffv_57;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_58> AgradDistributionGumbel_ffv_58;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_59> AgradDistributionGumbel_ffv_59;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_60> AgradDistributionGumbel_ffv_60;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_61> AgradDistributionGumbel_ffv_61;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_62> AgradDistributionGumbel_ffv_62;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_63> AgradDistributionGumbel_ffv_63;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_64> AgradDistributionGumbel_ffv_64;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_65> AgradDistributionGumbel_ffv_65;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_66> AgradDistributionGumbel_ffv_66;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_67> AgradDistributionGumbel_ffv_67;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_68> AgradDistributionGumbel_ffv_68;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_69> AgradDistributionGumbel_ffv_69;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_70> AgradDistributionGumbel_ffv_70;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_71> AgradDistributionGumbel_ffv_71;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_72> AgradDistributionGumbel_ffv_72;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_73> AgradDistributionGumbel_ffv_73;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_74> AgradDistributionGumbel_ffv_74;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_75> AgradDistributionGumbel_ffv_75;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_76> AgradDistributionGumbel_ffv_76;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_77> AgradDistributionGumbel_ffv_77;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_78> AgradDistributionGumbel_ffv_78;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_79> AgradDistributionGumbel_ffv_79;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_80> AgradDistributionGumbel_ffv_80;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_81> AgradDistributionGumbel_ffv_81;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_82> AgradDistributionGumbel_ffv_82;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_83> AgradDistributionGumbel_ffv_83;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_84> AgradDistributionGumbel_ffv_84;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_85> AgradDistributionGumbel_ffv_85;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_86> AgradDistributionGumbel_ffv_86;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_87> AgradDistributionGumbel_ffv_87;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_88> AgradDistributionGumbel_ffv_88;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_89> AgradDistributionGumbel_ffv_89;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_90> AgradDistributionGumbel_ffv_90;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_91> AgradDistributionGumbel_ffv_91;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_92> AgradDistributionGumbel_ffv_92;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_93> AgradDistributionGumbel_ffv_93;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_94> AgradDistributionGumbel_ffv_94;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_95> AgradDistributionGumbel_ffv_95;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_96> AgradDistributionGumbel_ffv_96;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_97> AgradDistributionGumbel_ffv_97;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_98> AgradDistributionGumbel_ffv_98;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_99> AgradDistributionGumbel_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_0, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_1, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_2, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_3, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_4, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_5, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_6, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_7, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_8, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_9, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_10, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_11, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_12, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_13, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_14, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_15, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_16, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_17, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_18, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_19, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_20, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_21, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_22, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_23, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_24, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_25, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_26, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_27, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_28, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_29, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_30, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_31, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_32, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_33, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_34, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_35, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_36, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_37, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_38, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_39, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_40, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_41, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_42, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_43, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_44, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_45, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_46, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_47, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_48, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_49, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_50, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_51, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_52, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_53, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_54, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_55, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_56, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_57, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_58, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_59, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_60, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_61, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_62, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_63, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_64, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_65, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_66, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_67, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_68, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_69, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_70, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_71, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_72, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_73, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_74, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_75, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_76, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_77, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_78, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_79, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_80, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_81, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_82, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_83, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_84, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_85, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_86, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_87, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_88, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_89, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_90, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_91, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_92, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_93, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_94, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_95, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_96, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_97, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_98, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_99, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionGumbel, type_v_0> AgradDistributionGumbel_v_0;
+typedef std::tuple<AgradDistributionGumbel, type_v_1> AgradDistributionGumbel_v_1;
+typedef std::tuple<AgradDistributionGumbel, type_v_2> AgradDistributionGumbel_v_2;
+typedef std::tuple<AgradDistributionGumbel, type_v_3> AgradDistributionGumbel_v_3;
+typedef std::tuple<AgradDistributionGumbel, type_v_4> AgradDistributionGumbel_v_4;
+typedef std::tuple<AgradDistributionGumbel, type_v_5> AgradDistributionGumbel_v_5;
+typedef std::tuple<AgradDistributionGumbel, type_v_6> AgradDistributionGumbel_v_6;
+typedef std::tuple<AgradDistributionGumbel, type_v_7> AgradDistributionGumbel_v_7;
+typedef std::tuple<AgradDistributionGumbel, type_v_8> AgradDistributionGumbel_v_8;
+typedef std::tuple<AgradDistributionGumbel, type_v_9> AgradDistributionGumbel_v_9;
+typedef std::tuple<AgradDistributionGumbel, type_v_10> AgradDistributionGumbel_v_10;
+typedef std::tuple<AgradDistributionGumbel, type_v_11> AgradDistributionGumbel_v_11;
+typedef std::tuple<AgradDistributionGumbel, type_v_12> AgradDistributionGumbel_v_12;
+typedef std::tuple<AgradDistributionGumbel, type_v_13> AgradDistributionGumbel_v_13;
+typedef std::tuple<AgradDistributionGumbel, type_v_14> AgradDistributionGumbel_v_14;
+typedef std::tuple<AgradDistributionGumbel, type_v_15> AgradDistributionGumbel_v_15;
+typedef std::tuple<AgradDistributionGumbel, type_v_16> AgradDistributionGumbel_v_16;
+typedef std::tuple<AgradDistributionGumbel, type_v_17> AgradDistributionGumbel_v_17;
+typedef std::tuple<AgradDistributionGumbel, type_v_18> AgradDistributionGumbel_v_18;
+typedef std::tuple<AgradDistributionGumbel, type_v_19> AgradDistributionGumbel_v_19;
+typedef std::tuple<AgradDistributionGumbel, type_v_20> AgradDistributionGumbel_v_20;
+typedef std::tuple<AgradDistributionGumbel, type_v_21> AgradDistributionGumbel_v_21;
+typedef std::tuple<AgradDistributionGumbel, type_v_22> AgradDistributionGumbel_v_22;
+typedef std::tuple<AgradDistributionGumbel, type_v_23> AgradDistributionGumbel_v_23;
+typedef std::tuple<AgradDistributionGumbel, type_v_24> AgradDistributionGumbel_v_24;
+typedef std::tuple<AgradDistributionGumbel, type_v_25> AgradDistributionGumbel_v_25;
+typedef std::tuple<AgradDistributionGumbel, type_v_26> AgradDistributionGumbel_v_26;
+typedef std::tuple<AgradDistributionGumbel, type_v_27> AgradDistributionGumbel_v_27;
+typedef std::tuple<AgradDistributionGumbel, type_v_28> AgradDistributionGumbel_v_28;
+typedef std::tuple<AgradDistributionGumbel, type_v_29> AgradDistributionGumbel_v_29;
+typedef std::tuple<AgradDistributionGumbel, type_v_30> AgradDistributionGumbel_v_30;
+typedef std::tuple<AgradDistributionGumbel, type_v_31> AgradDistributionGumbel_v_31;
+typedef std::tuple<AgradDistributionGumbel, type_v_32> AgradDistributionGumbel_v_32;
+typedef std::tuple<AgradDistributionGumbel, type_v_33> AgradDistributionGumbel_v_33;
+typedef std::tuple<AgradDistributionGumbel, type_v_34> AgradDistributionGumbel_v_34;
+typedef std::tuple<AgradDistributionGumbel, type_v_35> AgradDistributionGumbel_v_35;
+typedef std::tuple<AgradDistributionGumbel, type_v_36> AgradDistributionGumbel_v_36;
+typedef std::tuple<AgradDistributionGumbel, type_v_37> AgradDistributionGumbel_v_37;
+typedef std::tuple<AgradDistributionGumbel, type_v_38> AgradDistributionGumbel_v_38;
+typedef std::tuple<AgradDistributionGumbel, type_v_39> AgradDistributionGumbel_v_39;
+typedef std::tuple<AgradDistributionGumbel, type_v_40> AgradDistributionGumbel_v_40;
+typedef std::tuple<AgradDistributionGumbel, type_v_41> AgradDistributionGumbel_v_41;
+typedef std::tuple<AgradDistributionGumbel, type_v_42> AgradDistributionGumbel_v_42;
+typedef std::tuple<AgradDistributionGumbel, type_v_43> AgradDistributionGumbel_v_43;
+typedef std::tuple<AgradDistributionGumbel, type_v_44> AgradDistributionGumbel_v_44;
+typedef std::tuple<AgradDistributionGumbel, type_v_45> AgradDistributionGumbel_v_45;
+typedef std::tuple<AgradDistributionGumbel, type_v_46> AgradDistributionGumbel_v_46;
+typedef std::tuple<AgradDistributionGumbel, type_v_47> AgradDistributionGumbel_v_47;
+typedef std::tuple<AgradDistributionGumbel, type_v_48> AgradDistributionGumbel_v_48;
+typedef std::tuple<AgradDistributionGumbel, type_v_49> AgradDistributionGumbel_v_49;
+typedef std::tuple<AgradDistributionGumbel, type_v_50> AgradDistributionGumbel_v_50;
+typedef std::tuple<AgradDistributionGumbel, type_v_51> AgradDistributionGumbel_v_51;
+typedef std::tuple<AgradDistributionGumbel, type_v_52> AgradDistributionGumbel_v_52;
+typedef std::tuple<AgradDistributionGumbel, type_v_53> AgradDistributionGumbel_v_53;
+typedef std::tuple<AgradDistributionGumbel, type_v_54> AgradDistributionGumbel_v_54;
+typedef std::tuple<AgradDistributionGumbel, type_v_55> AgradDistributionGumbel_v_55;
+typedef std::tuple<AgradDistributionGumbel, type_v_56> AgradDistributionGumbel_v_56;
+typedef std::tuple<AgradDistributionGumbel, type_v_57> AgradDistributionGumbel_v_57;
+typedef std::tuple<AgradDistributionGumbel, type_v_58> AgradDistributionGumbel_v_58;
+typedef std::tuple<AgradDistributionGumbel, type_v_59> AgradDistributionGumbel_v_59;
+typedef std::tuple<AgradDistributionGumbel, type_v_60> AgradDistributionGumbel_v_60;
+typedef std::tuple<AgradDistributionGumbel, type_v_61> AgradDistributionGumbel_v_61;
+typedef std::tuple<AgradDistributionGumbel, type_v_62> AgradDistributionGumbel_v_62;
+typedef std::tuple<AgradDistributionGumbel, type_v_63> AgradDistributionGumbel_v_63;
+typedef std::tuple<AgradDistributionGumbel, type_v_64> AgradDistributionGumbel_v_64;
+typedef std::tuple<AgradDistributionGumbel, type_v_65> AgradDistributionGumbel_v_65;
+typedef std::tuple<AgradDistributionGumbel, type_v_66> AgradDistributionGumbel_v_66;
+typedef std::tuple<AgradDistributionGumbel, type_v_67> AgradDistributionGumbel_v_67;
+typedef std::tuple<AgradDistributionGumbel, type_v_68> AgradDistributionGumbel_v_68;
+typedef std::tuple<AgradDistributionGumbel, type_v_69> AgradDistributionGumbel_v_69;
+typedef std::tuple<AgradDistributionGumbel, type_v_70> AgradDistributionGumbel_v_70;
+typedef std::tuple<AgradDistributionGumbel, type_v_71> AgradDistributionGumbel_v_71;
+typedef std::tuple<AgradDistributionGumbel, type_v_72> AgradDistributionGumbel_v_72;
+typedef std::tuple<AgradDistributionGumbel, type_v_73> AgradDistributionGumbel_v_73;
+typedef std::tuple<AgradDistributionGumbel, type_v_74> AgradDistributionGumbel_v_74;
+typedef std::tuple<AgradDistributionGumbel, type_v_75> AgradDistributionGumbel_v_75;
+typedef std::tuple<AgradDistributionGumbel, type_v_76> AgradDistributionGumbel_v_76;
+typedef std::tuple<AgradDistributionGumbel, type_v_77> AgradDistributionGumbel_v_77;
+typedef std::tuple<AgradDistributionGumbel, type_v_78> AgradDistributionGumbel_v_78;
+typedef std::tuple<AgradDistributionGumbel, type_v_79> AgradDistributionGumbel_v_79;
+typedef std::tuple<AgradDistributionGumbel, type_v_80> AgradDistributionGumbel_v_80;
+typedef std::tuple<AgradDistributionGumbel, type_v_81> AgradDistributionGumbel_v_81;
+typedef std::tuple<AgradDistributionGumbel, type_v_82> AgradDistributionGumbel_v_82;
+typedef std::tuple<AgradDistributionGumbel, type_v_83> AgradDistributionGumbel_v_83;
+typedef std::tuple<AgradDistributionGumbel, type_v_84> AgradDistributionGumbel_v_84;
+typedef std::tuple<AgradDistributionGumbel, type_v_85> AgradDistributionGumbel_v_85;
+typedef std::tuple<AgradDistributionGumbel, type_v_86> AgradDistributionGumbel_v_86;
+typedef std::tuple<AgradDistributionGumbel, type_v_87> AgradDistributionGumbel_v_87;
+typedef std::tuple<AgradDistributionGumbel, type_v_88> AgradDistributionGumbel_v_88;
+typedef std::tuple<AgradDistributionGumbel, type_v_89> AgradDistributionGumbel_v_89;
+typedef std::tuple<AgradDistributionGumbel, type_v_90> AgradDistributionGumbel_v_90;
+typedef std::tuple<AgradDistributionGumbel, type_v_91> AgradDistributionGumbel_v_91;
+typedef std::tuple<AgradDistributionGumbel, type_v_92> AgradDistributionGumbel_v_92;
+typedef std::tuple<AgradDistributionGumbel, type_v_93> AgradDistributionGumbel_v_93;
+typedef std::tuple<AgradDistributionGumbel, type_v_94> AgradDistributionGumbel_v_94;
+typedef std::tuple<AgradDistributionGumbel, type_v_95> AgradDistributionGumbel_v_95;
+typedef std::tuple<AgradDistributionGumbel, type_v_96> AgradDistributionGumbel_v_96;
+typedef std::tuple<AgradDistributionGumbel, type_v_97> AgradDistributionGumbel_v_97;
+typedef std::tuple<AgradDistributionGumbel, type_v_98> AgradDistributionGumbel_v_98;
+typedef std::tuple<AgradDistributionGumbel, type_v_99> AgradDistributionGumbel_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_0, AgradDistributionTestFixture, AgradDistributionGumbel_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_1, AgradDistributionTestFixture, AgradDistributionGumbel_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_2, AgradDistributionTestFixture, AgradDistributionGumbel_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_3, AgradDistributionTestFixture, AgradDistributionGumbel_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_4, AgradDistributionTestFixture, AgradDistributionGumbel_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_5, AgradDistributionTestFixture, AgradDistributionGumbel_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_6, AgradDistributionTestFixture, AgradDistributionGumbel_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_7, AgradDistributionTestFixture, AgradDistributionGumbel_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_8, AgradDistributionTestFixture, AgradDistributionGumbel_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_9, AgradDistributionTestFixture, AgradDistributionGumbel_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_10, AgradDistributionTestFixture, AgradDistributionGumbel_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_11, AgradDistributionTestFixture, AgradDistributionGumbel_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_12, AgradDistributionTestFixture, AgradDistributionGumbel_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_13, AgradDistributionTestFixture, AgradDistributionGumbel_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_14, AgradDistributionTestFixture, AgradDistributionGumbel_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_15, AgradDistributionTestFixture, AgradDistributionGumbel_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_16, AgradDistributionTestFixture, AgradDistributionGumbel_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_17, AgradDistributionTestFixture, AgradDistributionGumbel_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_18, AgradDistributionTestFixture, AgradDistributionGumbel_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_19, AgradDistributionTestFixture, AgradDistributionGumbel_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_20, AgradDistributionTestFixture, AgradDistributionGumbel_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_21, AgradDistributionTestFixture, AgradDistributionGumbel_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_22, AgradDistributionTestFixture, AgradDistributionGumbel_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_23, AgradDistributionTestFixture, AgradDistributionGumbel_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_24, AgradDistributionTestFixture, AgradDistributionGumbel_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_25, AgradDistributionTestFixture, AgradDistributionGumbel_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_26, AgradDistributionTestFixture, AgradDistributionGumbel_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_27, AgradDistributionTestFixture, AgradDistributionGumbel_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_28, AgradDistributionTestFixture, AgradDistributionGumbel_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_29, AgradDistributionTestFixture, AgradDistributionGumbel_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_30, AgradDistributionTestFixture, AgradDistributionGumbel_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_31, AgradDistributionTestFixture, AgradDistributionGumbel_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_32, AgradDistributionTestFixture, AgradDistributionGumbel_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_33, AgradDistributionTestFixture, AgradDistributionGumbel_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_34, AgradDistributionTestFixture, AgradDistributionGumbel_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_35, AgradDistributionTestFixture, AgradDistributionGumbel_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_36, AgradDistributionTestFixture, AgradDistributionGumbel_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_37, AgradDistributionTestFixture, AgradDistributionGumbel_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_38, AgradDistributionTestFixture, AgradDistributionGumbel_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_39, AgradDistributionTestFixture, AgradDistributionGumbel_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_40, AgradDistributionTestFixture, AgradDistributionGumbel_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_41, AgradDistributionTestFixture, AgradDistributionGumbel_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_42, AgradDistributionTestFixture, AgradDistributionGumbel_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_43, AgradDistributionTestFixture, AgradDistributionGumbel_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_44, AgradDistributionTestFixture, AgradDistributionGumbel_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_45, AgradDistributionTestFixture, AgradDistributionGumbel_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_46, AgradDistributionTestFixture, AgradDistributionGumbel_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_47, AgradDistributionTestFixture, AgradDistributionGumbel_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_48, AgradDistributionTestFixture, AgradDistributionGumbel_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_49, AgradDistributionTestFixture, AgradDistributionGumbel_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_50, AgradDistributionTestFixture, AgradDistributionGumbel_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_51, AgradDistributionTestFixture, AgradDistributionGumbel_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_52, AgradDistributionTestFixture, AgradDistributionGumbel_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_53, AgradDistributionTestFixture, AgradDistributionGumbel_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_54, AgradDistributionTestFixture, AgradDistributionGumbel_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_55, AgradDistributionTestFixture, AgradDistributionGumbel_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_56, AgradDistributionTestFixture, AgradDistributionGumbel_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_57, AgradDistributionTestFixture, AgradDistributionGumbel_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_58, AgradDistributionTestFixture, AgradDistributionGumbel_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_59, AgradDistributionTestFixture, AgradDistributionGumbel_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_60, AgradDistributionTestFixture, AgradDistributionGumbel_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_61, AgradDistributionTestFixture, AgradDistributionGumbel_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_62, AgradDistributionTestFixture, AgradDistributionGumbel_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_63, AgradDistributionTestFixture, AgradDistributionGumbel_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_64, AgradDistributionTestFixture, AgradDistributionGumbel_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_65, AgradDistributionTestFixture, AgradDistributionGumbel_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_66, AgradDistributionTestFixture, AgradDistributionGumbel_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_67, AgradDistributionTestFixture, AgradDistributionGumbel_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_68, AgradDistributionTestFixture, AgradDistributionGumbel_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_69, AgradDistributionTestFixture, AgradDistributionGumbel_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_70, AgradDistributionTestFixture, AgradDistributionGumbel_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_71, AgradDistributionTestFixture, AgradDistributionGumbel_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_72, AgradDistributionTestFixture, AgradDistributionGumbel_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_73, AgradDistributionTestFixture, AgradDistributionGumbel_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_74, AgradDistributionTestFixture, AgradDistributionGumbel_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_75, AgradDistributionTestFixture, AgradDistributionGumbel_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_76, AgradDistributionTestFixture, AgradDistributionGumbel_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_77, AgradDistributionTestFixture, AgradDistributionGumbel_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_78, AgradDistributionTestFixture, AgradDistributionGumbel_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_79, AgradDistributionTestFixture, AgradDistributionGumbel_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_80, AgradDistributionTestFixture, AgradDistributionGumbel_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_81, AgradDistributionTestFixture, AgradDistributionGumbel_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_82, AgradDistributionTestFixture, AgradDistributionGumbel_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_83, AgradDistributionTestFixture, AgradDistributionGumbel_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_84, AgradDistributionTestFixture, AgradDistributionGumbel_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_85, AgradDistributionTestFixture, AgradDistributionGumbel_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_86, AgradDistributionTestFixture, AgradDistributionGumbel_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_87, AgradDistributionTestFixture, AgradDistributionGumbel_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_88, AgradDistributionTestFixture, AgradDistributionGumbel_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_89, AgradDistributionTestFixture, AgradDistributionGumbel_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_90, AgradDistributionTestFixture, AgradDistributionGumbel_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_91, AgradDistributionTestFixture, AgradDistributionGumbel_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_92, AgradDistributionTestFixture, AgradDistributionGumbel_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_93, AgradDistributionTestFixture, AgradDistributionGumbel_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_94, AgradDistributionTestFixture, AgradDistributionGumbel_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_95, AgradDistributionTestFixture, AgradDistributionGumbel_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_96, AgradDistributionTestFixture, AgradDistributionGumbel_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_97, AgradDistributionTestFixture, AgradDistributionGumbel_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_98, AgradDistributionTestFixture, AgradDistributionGumbel_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_99, AgradDistributionTestFixture, AgradDistributionGumbel_v_99);
+
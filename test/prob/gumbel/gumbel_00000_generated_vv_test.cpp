@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionGumbel, type_vv_0> AgradDistributionGumbel_vv_0;
+typedef std::tuple<AgradDistributionGumbel, type_vv_1> AgradDistributionGumbel_vv_1;
+typedef std::tuple<AgradDistributionGumbel, type_vv_2> AgradDistributionGumbel_vv_2;
+typedef std::tuple<AgradDistributionGumbel, type_vv_3> AgradDistributionGumbel_vv_3;
+typedef std::tuple<AgradDistributionGumbel, type_vv_4> AgradDistributionGumbel_vv_4;
+typedef std::tuple<AgradDistributionGumbel, type_vv_5> AgradDistributionGumbel_vv_5;
+typedef std::tuple<AgradDistributionGumbel, type_vv_6> AgradDistributionGumbel_vv_6;
+typedef std::tuple<AgradDistributionGumbel, type_vv_7> AgradDistributionGumbel_vv_7;
+typedef std::tuple<AgradDistributionGumbel, type_vv_8> AgradDistributionGumbel_vv_8;
+typedef std::tuple<AgradDistributionGumbel, type_vv_9> AgradDistributionGumbel_vv_9;
+typedef std::tuple<AgradDistributionGumbel, type_vv_10> AgradDistributionGumbel_vv_10;
+typedef std::tuple<AgradDistributionGumbel, type_vv_11> AgradDistributionGumbel_vv_11;
+typedef std::tuple<AgradDistributionGumbel, type_vv_12> AgradDistributionGumbel_vv_12;
+typedef std::tuple<AgradDistributionGumbel, type_vv_13> AgradDistributionGumbel_vv_13;
+typedef std::tuple<AgradDistributionGumbel, type_vv_14> AgradDistributionGumbel_vv_14;
+typedef std::tuple<AgradDistributionGumbel, type_vv_15> AgradDistributionGumbel_vv_15;
+typedef std::tuple<AgradDistributionGumbel, type_vv_16> AgradDistributionGumbel_vv_16;
+typedef std::tuple<AgradDistributionGumbel, type_vv_17> AgradDistributionGumbel_vv_17;
+typedef std::tuple<AgradDistributionGumbel, type_vv_18> AgradDistributionGumbel_vv_18;
+typedef std::tuple<AgradDistributionGumbel, type_vv_19> AgradDistributionGumbel_vv_19;
+typedef std::tuple<AgradDistributionGumbel, type_vv_20> AgradDistributionGumbel_vv_20;
+typedef std::tuple<AgradDistributionGumbel, type_vv_21> AgradDistributionGumbel_vv_21;
+typedef std::tuple<AgradDistributionGumbel, type_vv_22> AgradDistributionGumbel_vv_22;
+typedef std::tuple<AgradDistributionGumbel, type_vv_23> AgradDistributionGumbel_vv_23;
+typedef std::tuple<AgradDistributionGumbel, type_vv_24> AgradDistributionGumbel_vv_24;
+typedef std::tuple<AgradDistributionGumbel, type_vv_25> AgradDistributionGumbel_vv_25;
+typedef std::tuple<AgradDistributionGumbel, type_vv_26> AgradDistributionGumbel_vv_26;
+typedef std::tuple<AgradDistributionGumbel, type_vv_27> AgradDistributionGumbel_vv_27;
+typedef std::tuple<AgradDistributionGumbel, type_vv_28> AgradDistributionGumbel_vv_28;
+typedef std::tuple<AgradDistributionGumbel, type_vv_29> AgradDistributionGumbel_vv_29;
+typedef std::tuple<AgradDistributionGumbel, type_vv_30> AgradDistributionGumbel_vv_30;
+typedef std::tuple<AgradDistributionGumbel, type_vv_31> AgradDistributionGumbel_vv_31;
+typedef std::tuple<AgradDistributionGumbel, type_vv_32> AgradDistributionGumbel_vv_32;
+typedef std::tuple<AgradDistributionGumbel, type_vv_33> AgradDistributionGumbel_vv_33;
+typedef std::tuple<AgradDistributionGumbel, type_vv_34> AgradDistributionGumbel_vv_34;
+typedef std::tuple<AgradDistributionGumbel, type_vv_35> AgradDistributionGumbel_vv_35;
+typedef std::tuple<AgradDistributionGumbel, type_vv_36> AgradDistributionGumbel_vv_36;
+typedef std::tuple<AgradDistributionGumbel, type_vv_37> AgradDistributionGumbel_vv_37;
+typedef std::tuple<AgradDistributionGumbel, type_vv_38> AgradDistributionGumbel_vv_38;
+typedef std::tuple<AgradDistributionGumbel, type_vv_39> AgradDistributionGumbel_vv_39;
+typedef std::tuple<AgradDistributionGumbel, type_vv_40> AgradDistributionGumbel_vv_40;
+typedef std::tuple<AgradDistributionGumbel, type_vv_41> AgradDistributionGumbel_vv_41;
+typedef std::tuple<AgradDistributionGumbel, type_vv_42> AgradDistributionGumbel_vv_42;
+typedef std::tuple<AgradDistributionGumbel, type_vv_43> AgradDistributionGumbel_vv_43;
+typedef std::tuple<AgradDistributionGumbel, type_vv_44> AgradDistributionGumbel_vv_44;
+typedef std::tuple<AgradDistributionGumbel, type_vv_45> AgradDistributionGumbel_vv_45;
+typedef std::tuple<AgradDistributionGumbel, type_vv_46> AgradDistributionGumbel_vv_46;
+typedef std::tuple<AgradDistributionGumbel, type_vv_47> AgradDistributionGumbel_vv_47;
+typedef std::tuple<AgradDistributionGumbel, type_vv_48> AgradDistributionGumbel_vv_48;
+typedef std::tuple<AgradDistributionGumbel, type_vv_49> AgradDistributionGumbel_vv_49;
+typedef std::tuple<AgradDistributionGumbel, type_vv_50> AgradDistributionGumbel_vv_50;
+typedef std::tuple<AgradDistributionGumbel, type_vv_51> AgradDistributionGumbel_vv_51;
+typedef std::tuple<AgradDistributionGumbel, type_vv_52> AgradDistributionGumbel_vv_52;
+typedef std::tuple<AgradDistributionGumbel, type_vv_53> AgradDistributionGumbel_vv_53;
+typedef std::tuple<AgradDistributionGumbel, type_vv_54> AgradDistributionGumbel_vv_54;
+typedef std::tuple<AgradDistributionGumbel, type_vv_55> AgradDistributionGumbel_vv_55;
+typedef std::tuple<AgradDistributionGumbel, type_vv_56> AgradDistributionGumbel_vv_56;
+typedef std::tuple<AgradDistributionGumbel, type_vv_57> AgradDistributionGumbel_vv_57;
+typedef std::tuple<AgradDistributionGumbel, type_vv_58> AgradDistributionGumbel_vv_58;
+typedef std::tuple<AgradDistributionGumbel, type_vv_59> AgradDistributionGumbel_vv_59;
+typedef std::tuple<AgradDistributionGumbel, type_vv_60> AgradDistributionGumbel_vv_60;
+typedef std::tuple<AgradDistributionGumbel, type_vv_61> AgradDistributionGumbel_vv_61;
+typedef std::tuple<AgradDistributionGumbel, type_vv_62> AgradDistributionGumbel_vv_62;
+typedef std::tuple<AgradDistributionGumbel, type_vv_63> AgradDistributionGumbel_vv_63;
+typedef std::tuple<AgradDistributionGumbel, type_vv_64> AgradDistributionGumbel_vv_64;
+typedef std::tuple<AgradDistributionGumbel, type_vv_65> AgradDistributionGumbel_vv_65;
+typedef std::tuple<AgradDistributionGumbel, type_vv_66> AgradDistributionGumbel_vv_66;
+typedef std::tuple<AgradDistributionGumbel, type_vv_67> AgradDistributionGumbel_vv_67;
+typedef std::tuple<AgradDistributionGumbel, type_vv_68> AgradDistributionGumbel_vv_68;
+typedef std::tuple<AgradDistributionGumbel, type_vv_69> AgradDistributionGumbel_vv_69;
+typedef std::tuple<AgradDistributionGumbel, type_vv_70> AgradDistributionGumbel_vv_70;
+typedef std::tuple<AgradDistributionGumbel, type_vv_71> AgradDistributionGumbel_vv_71;
+typedef std::tuple<AgradDistributionGumbel, type_vv_72> AgradDistributionGumbel_vv_72;
+typedef std::tuple<AgradDistributionGumbel, type_vv_73> AgradDistributionGumbel_vv_73;
+typedef std::tuple<AgradDistributionGumbel, type_vv_74> AgradDistributionGumbel_vv_74;
+typedef std::tuple<AgradDistributionGumbel, type_vv_75> AgradDistributionGumbel_vv_75;
+typedef std::tuple<AgradDistributionGumbel, type_vv_76> AgradDistributionGumbel_vv_76;
+typedef std::tuple<AgradDistributionGumbel, type_vv_77> AgradDistributionGumbel_vv_77;
+typedef std::tuple<AgradDistributionGumbel, type_vv_78> AgradDistributionGumbel_vv_78;
+typedef std::tuple<AgradDistributionGumbel, type_vv_79> AgradDistributionGumbel_vv_79;
+typedef std::tuple<AgradDistributionGumbel, type_vv_80> AgradDistributionGumbel_vv_80;
+typedef std::tuple<AgradDistributionGumbel, type_vv_81> AgradDistributionGumbel_vv_81;
+typedef std::tuple<AgradDistributionGumbel, type_vv_82> AgradDistributionGumbel_vv_82;
+typedef std::tuple<AgradDistributionGumbel, type_vv_83> AgradDistributionGumbel_vv_83;
+typedef std::tuple<AgradDistributionGumbel, type_vv_84> AgradDistributionGumbel_vv_84;
+typedef std::tuple<AgradDistributionGumbel, type_vv_85> AgradDistributionGumbel_vv_85;
+typedef std::tuple<AgradDistributionGumbel, type_vv_86> AgradDistributionGumbel_vv_86;
+typedef std::tuple<AgradDistributionGumbel, type_vv_87> AgradDistributionGumbel_vv_87;
+typedef std::tuple<AgradDistributionGumbel, type_vv_88> AgradDistributionGumbel_vv_88;
+typedef std::tuple<AgradDistributionGumbel, type_vv_89> AgradDistributionGumbel_vv_89;
+typedef std::tuple<AgradDistributionGumbel, type_vv_90> AgradDistributionGumbel_vv_90;
+typedef std::tuple<AgradDistributionGumbel, type_vv_91> AgradDistributionGumbel_vv_91;
+typedef std::tuple<AgradDistributionGumbel, type_vv_92> AgradDistributionGumbel_vv_92;
+typedef std::tuple<AgradDistributionGumbel, type_vv_93> AgradDistributionGumbel_vv_93;
+typedef std::tuple<AgradDistributionGumbel, type_vv_94> AgradDistributionGumbel_vv_94;
+typedef std::tuple<AgradDistributionGumbel, type_vv_95> AgradDistributionGumbel_vv_95;
+typedef std::tuple<AgradDistributionGumbel, type_vv_96> AgradDistributionGumbel_vv_96;
+typedef std::tuple<AgradDistributionGumbel, type_vv_97> AgradDistributionGumbel_vv_97;
+typedef std::tuple<AgradDistributionGumbel, type_vv_98> AgradDistributionGumbel_vv_98;
+typedef std::tuple<AgradDistributionGumbel, type_vv_99> AgradDistributionGumbel_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_0, AgradDistributionTestFixture, AgradDistributionGumbel_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_1, AgradDistributionTestFixture, AgradDistributionGumbel_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_2, AgradDistributionTestFixture, AgradDistributionGumbel_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_3, AgradDistributionTestFixture, AgradDistributionGumbel_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_4, AgradDistributionTestFixture, AgradDistributionGumbel_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_5, AgradDistributionTestFixture, AgradDistributionGumbel_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_6, AgradDistributionTestFixture, AgradDistributionGumbel_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_7, AgradDistributionTestFixture, AgradDistributionGumbel_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_8, AgradDistributionTestFixture, AgradDistributionGumbel_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_9, AgradDistributionTestFixture, AgradDistributionGumbel_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_10, AgradDistributionTestFixture, AgradDistributionGumbel_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_11, AgradDistributionTestFixture, AgradDistributionGumbel_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_12, AgradDistributionTestFixture, AgradDistributionGumbel_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_13, AgradDistributionTestFixture, AgradDistributionGumbel_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_14, AgradDistributionTestFixture, AgradDistributionGumbel_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_15, AgradDistributionTestFixture, AgradDistributionGumbel_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_16, AgradDistributionTestFixture, AgradDistributionGumbel_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_17, AgradDistributionTestFixture, AgradDistributionGumbel_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_18, AgradDistributionTestFixture, AgradDistributionGumbel_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_19, AgradDistributionTestFixture, AgradDistributionGumbel_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_20, AgradDistributionTestFixture, AgradDistributionGumbel_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_21, AgradDistributionTestFixture, AgradDistributionGumbel_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_22, AgradDistributionTestFixture, AgradDistributionGumbel_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_23, AgradDistributionTestFixture, AgradDistributionGumbel_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_24, AgradDistributionTestFixture, AgradDistributionGumbel_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_25, AgradDistributionTestFixture, AgradDistributionGumbel_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_26, AgradDistributionTestFixture, AgradDistributionGumbel_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_27, AgradDistributionTestFixture, AgradDistributionGumbel_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_28, AgradDistributionTestFixture, AgradDistributionGumbel_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_29, AgradDistributionTestFixture, AgradDistributionGumbel_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_30, AgradDistributionTestFixture, AgradDistributionGumbel_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_31, AgradDistributionTestFixture, AgradDistributionGumbel_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_32, AgradDistributionTestFixture, AgradDistributionGumbel_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_33, AgradDistributionTestFixture, AgradDistributionGumbel_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_34, AgradDistributionTestFixture, AgradDistributionGumbel_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_35, AgradDistributionTestFixture, AgradDistributionGumbel_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_36, AgradDistributionTestFixture, AgradDistributionGumbel_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_37, AgradDistributionTestFixture, AgradDistributionGumbel_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_38, AgradDistributionTestFixture, AgradDistributionGumbel_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_39, AgradDistributionTestFixture, AgradDistributionGumbel_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_40, AgradDistributionTestFixture, AgradDistributionGumbel_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_41, AgradDistributionTestFixture, AgradDistributionGumbel_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_42, AgradDistributionTestFixture, AgradDistributionGumbel_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_43, AgradDistributionTestFixture, AgradDistributionGumbel_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_44, AgradDistributionTestFixture, AgradDistributionGumbel_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_45, AgradDistributionTestFixture, AgradDistributionGumbel_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_46, AgradDistributionTestFixture, AgradDistributionGumbel_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_47, AgradDistributionTestFixture, AgradDistributionGumbel_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_48, AgradDistributionTestFixture, AgradDistributionGumbel_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_49, AgradDistributionTestFixture, AgradDistributionGumbel_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_50, AgradDistributionTestFixture, AgradDistributionGumbel_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_51, AgradDistributionTestFixture, AgradDistributionGumbel_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_52, AgradDistributionTestFixture, AgradDistributionGumbel_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_53, AgradDistributionTestFixture, AgradDistributionGumbel_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_54, AgradDistributionTestFixture, AgradDistributionGumbel_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_55, AgradDistributionTestFixture, AgradDistributionGumbel_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_56, AgradDistributionTestFixture, AgradDistributionGumbel_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_57, AgradDistributionTestFixture, AgradDistributionGumbel_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_58, AgradDistributionTestFixture, AgradDistributionGumbel_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_59, AgradDistributionTestFixture, AgradDistributionGumbel_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_60, AgradDistributionTestFixture, AgradDistributionGumbel_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_61, AgradDistributionTestFixture, AgradDistributionGumbel_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_62, AgradDistributionTestFixture, AgradDistributionGumbel_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_63, AgradDistributionTestFixture, AgradDistributionGumbel_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_64, AgradDistributionTestFixture, AgradDistributionGumbel_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_65, AgradDistributionTestFixture, AgradDistributionGumbel_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_66, AgradDistributionTestFixture, AgradDistributionGumbel_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_67, AgradDistributionTestFixture, AgradDistributionGumbel_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_68, AgradDistributionTestFixture, AgradDistributionGumbel_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_69, AgradDistributionTestFixture, AgradDistributionGumbel_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_70, AgradDistributionTestFixture, AgradDistributionGumbel_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_71, AgradDistributionTestFixture, AgradDistributionGumbel_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_72, AgradDistributionTestFixture, AgradDistributionGumbel_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_73, AgradDistributionTestFixture, AgradDistributionGumbel_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_74, AgradDistributionTestFixture, AgradDistributionGumbel_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_75, AgradDistributionTestFixture, AgradDistributionGumbel_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_76, AgradDistributionTestFixture, AgradDistributionGumbel_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_77, AgradDistributionTestFixture, AgradDistributionGumbel_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_78, AgradDistributionTestFixture, AgradDistributionGumbel_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_79, AgradDistributionTestFixture, AgradDistributionGumbel_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_80, AgradDistributionTestFixture, AgradDistributionGumbel_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_81, AgradDistributionTestFixture, AgradDistributionGumbel_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_82, AgradDistributionTestFixture, AgradDistributionGumbel_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_83, AgradDistributionTestFixture, AgradDistributionGumbel_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_84, AgradDistributionTestFixture, AgradDistributionGumbel_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_85, AgradDistributionTestFixture, AgradDistributionGumbel_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_86, AgradDistributionTestFixture, AgradDistributionGumbel_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_87, AgradDistributionTestFixture, AgradDistributionGumbel_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_88, AgradDistributionTestFixture, AgradDistributionGumbel_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_89, AgradDistributionTestFixture, AgradDistributionGumbel_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_90, AgradDistributionTestFixture, AgradDistributionGumbel_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_91, AgradDistributionTestFixture, AgradDistributionGumbel_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_92, AgradDistributionTestFixture, AgradDistributionGumbel_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_93, AgradDistributionTestFixture, AgradDistributionGumbel_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_94, AgradDistributionTestFixture, AgradDistributionGumbel_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_95, AgradDistributionTestFixture, AgradDistributionGumbel_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_96, AgradDistributionTestFixture, AgradDistributionGumbel_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_97, AgradDistributionTestFixture, AgradDistributionGumbel_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_98, AgradDistributionTestFixture, AgradDistributionGumbel_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_99, AgradDistributionTestFixture, AgradDistributionGumbel_vv_99);
+
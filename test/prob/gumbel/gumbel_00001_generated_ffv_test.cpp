@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradDistributionGumbel, type_ffv_100> AgradDistributionGumbel_ffv_100;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_101> AgradDistributionGumbel_ffv_101;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_102> AgradDistributionGumbel_ffv_102;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_103> AgradDistributionGumbel_ffv_103;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_104> AgradDistributionGumbel_ffv_104;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_105> AgradDistributionGumbel_ffv_105;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_106> AgradDistributionGumbel_ffv_106;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_107> AgradDistributionGumbel_ffv_107;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_108> AgradDistributionGumbel_ffv_108;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_109> AgradDistributionGumbel_ffv_109;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_110> AgradDistributionGumbel_ffv_110;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_111> AgradDistributionGumbel_ffv_111;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_112> AgradDistributionGumbel_ffv_112;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_113> AgradDistributionGumbel_ffv_113;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_114> AgradDistributionGumbel_ffv_114;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_115> AgradDistributionGumbel_ffv_115;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_116> AgradDistributionGumbel_ffv_116;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_117> AgradDistributionGumbel_ffv_117;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_118> AgradDistributionGumbel_ffv_118;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_119> AgradDistributionGumbel_ffv_119;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_120> AgradDistributionGumbel_ffv_120;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_121> AgradDistributionGumbel_ffv_121;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_122> AgradDistributionGumbel_ffv_122;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_123> AgradDistributionGumbel_ffv_123;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_124> AgradDistributionGumbel_ffv_124;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_125> AgradDistributionGumbel_ffv_125;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_126> AgradDistributionGumbel_ffv_126;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_127> AgradDistributionGumbel_ffv_127;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_128> AgradDistributionGumbel_ffv_128;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_129> AgradDistributionGumbel_ffv_129;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_130> AgradDistributionGumbel_ffv_130;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_131> AgradDistributionGumbel_ffv_131;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_132> AgradDistributionGumbel_ffv_132;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_133> AgradDistributionGumbel_ffv_133;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_134> AgradDistributionGumbel_ffv_134;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_135> AgradDistributionGumbel_ffv_135;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_136> AgradDistributionGumbel_ffv_136;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_137> AgradDistributionGumbel_ffv_137;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_138> AgradDistributionGumbel_ffv_138;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_139> AgradDistributionGumbel_ffv_139;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_140> AgradDistributionGumbel_ffv_140;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_141> AgradDistributionGumbel_ffv_141;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_142> AgradDistributionGumbel_ffv_142;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_143> AgradDistributionGumbel_ffv_143;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_144> AgradDistributionGumbel_ffv_144;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_145> AgradDistributionGumbel_ffv_145;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_146> AgradDistributionGumbel_ffv_146;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_147> AgradDistributionGumbel_ffv_147;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_148> AgradDistributionGumbel_ffv_148;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_149> AgradDistributionGumbel_ffv_149;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_150> AgradDistributionGumbel_ffv_150;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_151> AgradDistributionGumbel_ffv_151;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_152> AgradDistributionGumbel_ffv_152;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_153> AgradDistributionGumbel_ffv_153;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_154> AgradDistributionGumbel_ffv_154;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_155> AgradDistributionGumbel_ffv_155;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_156> AgradDistributionGumbel_ffv_156;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_157> AgradDistributionGumbel_ffv_157;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_158> AgradDistributionGumbel_ffv_158;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_159> AgradDistributionGumbel_ffv_159;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_160> AgradDistributionGumbel_ffv_160;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_161> AgradDistributionGumbel_ffv_161;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_162> AgradDistributionGumbel_ffv_162;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_163> AgradDistributionGumbel_ffv_163;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_164> AgradDistributionGumbel_ffv_164;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_165> AgradDistributionGumbel_ffv_165;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_166> AgradDistributionGumbel_ffv_166;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_167> AgradDistributionGumbel_ffv_167;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_168> AgradDistributionGumbel_ffv_168;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_169> AgradDistributionGumbel_ffv_169;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_170> AgradDistributionGumbel_ffv_170;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_171> AgradDistributionGumbel_ffv_171;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_172> AgradDistributionGumbel_ffv_172;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_173> AgradDistributionGumbel_ffv_173;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_174> AgradDistributionGumbel_ffv_174;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_175> AgradDistributionGumbel_ffv_175;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_176> AgradDistributionGumbel_ffv_176;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_177> AgradDistributionGumbel_ffv_177;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_178> AgradDistributionGumbel_ffv_178;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_179> AgradDistributionGumbel_ffv_179;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_180> AgradDistributionGumbel_ffv_180;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_181> AgradDistributionGumbel_ffv_181;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_182> AgradDistributionGumbel_ffv_182;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_183> AgradDistributionGumbel_ffv_183;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_184> AgradDistributionGumbel_ffv_184;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_185> AgradDistributionGumbel_ffv_185;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_186> AgradDistributionGumbel_ffv_186;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_187> AgradDistributionGumbel_ffv_187;
+typedef std::tuple<AgradDistributionGumbel, type_ffv_188> AgradDistributionGumbel_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_100, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_101, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_102, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_103, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_104, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_105, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_106, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_107, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_108, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_109, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_110, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_111, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_112, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_113, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_114, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_115, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_116, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_117, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_118, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_119, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_120, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_121, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_122, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_123, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_124, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_125, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_126, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_127, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_128, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_129, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_130, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_131, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_132, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_133, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_134, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_135, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_136, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_137, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_138, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_139, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_140, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_141, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_142, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_143, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_144, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_145, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_146, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_147, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_148, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_149, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_150, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_151, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_152, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_153, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_154, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_155, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_156, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_157, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_158, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_159, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_160, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_161, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_162, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_163, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_164, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_165, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_166, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_167, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_168, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_169, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_170, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_171, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_172, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_173, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_174, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_175, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_176, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_177, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_178, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_179, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_180, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_181, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_182, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_183, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_184, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_185, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_186, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_187, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_ffv_188, AgradDistributionTestFixture, AgradDistributionGumbel_ffv_188);
+
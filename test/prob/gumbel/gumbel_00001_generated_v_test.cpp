@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionGumbel, type_v_100> AgradDistributionGumbel_v_100;
+typedef std::tuple<AgradDistributionGumbel, type_v_101> AgradDistributionGumbel_v_101;
+typedef std::tuple<AgradDistributionGumbel, type_v_102> AgradDistributionGumbel_v_102;
+typedef std::tuple<AgradDistributionGumbel, type_v_103> AgradDistributionGumbel_v_103;
+typedef std::tuple<AgradDistributionGumbel, type_v_104> AgradDistributionGumbel_v_104;
+typedef std::tuple<AgradDistributionGumbel, type_v_105> AgradDistributionGumbel_v_105;
+typedef std::tuple<AgradDistributionGumbel, type_v_106> AgradDistributionGumbel_v_106;
+typedef std::tuple<AgradDistributionGumbel, type_v_107> AgradDistributionGumbel_v_107;
+typedef std::tuple<AgradDistributionGumbel, type_v_108> AgradDistributionGumbel_v_108;
+typedef std::tuple<AgradDistributionGumbel, type_v_109> AgradDistributionGumbel_v_109;
+typedef std::tuple<AgradDistributionGumbel, type_v_110> AgradDistributionGumbel_v_110;
+typedef std::tuple<AgradDistributionGumbel, type_v_111> AgradDistributionGumbel_v_111;
+typedef std::tuple<AgradDistributionGumbel, type_v_112> AgradDistributionGumbel_v_112;
+typedef std::tuple<AgradDistributionGumbel, type_v_113> AgradDistributionGumbel_v_113;
+typedef std::tuple<AgradDistributionGumbel, type_v_114> AgradDistributionGumbel_v_114;
+typedef std::tuple<AgradDistributionGumbel, type_v_115> AgradDistributionGumbel_v_115;
+typedef std::tuple<AgradDistributionGumbel, type_v_116> AgradDistributionGumbel_v_116;
+typedef std::tuple<AgradDistributionGumbel, type_v_117> AgradDistributionGumbel_v_117;
+typedef std::tuple<AgradDistributionGumbel, type_v_118> AgradDistributionGumbel_v_118;
+typedef std::tuple<AgradDistributionGumbel, type_v_119> AgradDistributionGumbel_v_119;
+typedef std::tuple<AgradDistributionGumbel, type_v_120> AgradDistributionGumbel_v_120;
+typedef std::tuple<AgradDistributionGumbel, type_v_121> AgradDistributionGumbel_v_121;
+typedef std::tuple<AgradDistributionGumbel, type_v_122> AgradDistributionGumbel_v_122;
+typedef std::tuple<AgradDistributionGumbel, type_v_123> AgradDistributionGumbel_v_123;
+typedef std::tuple<AgradDistributionGumbel, type_v_124> AgradDistributionGumbel_v_124;
+typedef std::tuple<AgradDistributionGumbel, type_v_125> AgradDistributionGumbel_v_125;
+typedef std::tuple<AgradDistributionGumbel, type_v_126> AgradDistributionGumbel_v_126;
+typedef std::tuple<AgradDistributionGumbel, type_v_127> AgradDistributionGumbel_v_127;
+typedef std::tuple<AgradDistributionGumbel, type_v_128> AgradDistributionGumbel_v_128;
+typedef std::tuple<AgradDistributionGumbel, type_v_129> AgradDistributionGumbel_v_129;
+typedef std::tuple<AgradDistributionGumbel, type_v_130> AgradDistributionGumbel_v_130;
+typedef std::tuple<AgradDistributionGumbel, type_v_131> AgradDistributionGumbel_v_131;
+typedef std::tuple<AgradDistributionGumbel, type_v_132> AgradDistributionGumbel_v_132;
+typedef std::tuple<AgradDistributionGumbel, type_v_133> AgradDistributionGumbel_v_133;
+typedef std::tuple<AgradDistributionGumbel, type_v_134> AgradDistributionGumbel_v_134;
+typedef std::tuple<AgradDistributionGumbel, type_v_135> AgradDistributionGumbel_v_135;
+typedef std::tuple<AgradDistributionGumbel, type_v_136> AgradDistributionGumbel_v_136;
+typedef std::tuple<AgradDistributionGumbel, type_v_137> AgradDistributionGumbel_v_137;
+typedef std::tuple<AgradDistributionGumbel, type_v_138> AgradDistributionGumbel_v_138;
+typedef std::tuple<AgradDistributionGumbel, type_v_139> AgradDistributionGumbel_v_139;
+typedef std::tuple<AgradDistributionGumbel, type_v_140> AgradDistributionGumbel_v_140;
+typedef std::tuple<AgradDistributionGumbel, type_v_141> AgradDistributionGumbel_v_141;
+typedef std::tuple<AgradDistributionGumbel, type_v_142> AgradDistributionGumbel_v_142;
+typedef std::tuple<AgradDistributionGumbel, type_v_143> AgradDistributionGumbel_v_143;
+typedef std::tuple<AgradDistributionGumbel, type_v_144> AgradDistributionGumbel_v_144;
+typedef std::tuple<AgradDistributionGumbel, type_v_145> AgradDistributionGumbel_v_145;
+typedef std::tuple<AgradDistributionGumbel, type_v_146> AgradDistributionGumbel_v_146;
+typedef std::tuple<AgradDistributionGumbel, type_v_147> AgradDistributionGumbel_v_147;
+typedef std::tuple<AgradDistributionGumbel, type_v_148> AgradDistributionGumbel_v_148;
+typedef std::tuple<AgradDistributionGumbel, type_v_149> AgradDistributionGumbel_v_149;
+typedef std::tuple<AgradDistributionGumbel, type_v_150> AgradDistributionGumbel_v_150;
+typedef std::tuple<AgradDistributionGumbel, type_v_151> AgradDistributionGumbel_v_151;
+typedef std::tuple<AgradDistributionGumbel, type_v_152> AgradDistributionGumbel_v_152;
+typedef std::tuple<AgradDistributionGumbel, type_v_153> AgradDistributionGumbel_v_153;
+typedef std::tuple<AgradDistributionGumbel, type_v_154> AgradDistributionGumbel_v_154;
+typedef std::tuple<AgradDistributionGumbel, type_v_155> AgradDistributionGumbel_v_155;
+typedef std::tuple<AgradDistributionGumbel, type_v_156> AgradDistributionGumbel_v_156;
+typedef std::tuple<AgradDistributionGumbel, type_v_157> AgradDistributionGumbel_v_157;
+typedef std::tuple<AgradDistributionGumbel, type_v_158> AgradDistributionGumbel_v_158;
+typedef std::tuple<AgradDistributionGumbel, type_v_159> AgradDistributionGumbel_v_159;
+typedef std::tuple<AgradDistributionGumbel, type_v_160> AgradDistributionGumbel_v_160;
+typedef std::tuple<AgradDistributionGumbel, type_v_161> AgradDistributionGumbel_v_161;
+typedef std::tuple<AgradDistributionGumbel, type_v_162> AgradDistributionGumbel_v_162;
+typedef std::tuple<AgradDistributionGumbel, type_v_163> AgradDistributionGumbel_v_163;
+typedef std::tuple<AgradDistributionGumbel, type_v_164> AgradDistributionGumbel_v_164;
+typedef std::tuple<AgradDistributionGumbel, type_v_165> AgradDistributionGumbel_v_165;
+typedef std::tuple<AgradDistributionGumbel, type_v_166> AgradDistributionGumbel_v_166;
+typedef std::tuple<AgradDistributionGumbel, type_v_167> AgradDistributionGumbel_v_167;
+typedef std::tuple<AgradDistributionGumbel, type_v_168> AgradDistributionGumbel_v_168;
+typedef std::tuple<AgradDistributionGumbel, type_v_169> AgradDistributionGumbel_v_169;
+typedef std::tuple<AgradDistributionGumbel, type_v_170> AgradDistributionGumbel_v_170;
+typedef std::tuple<AgradDistributionGumbel, type_v_171> AgradDistributionGumbel_v_171;
+typedef std::tuple<AgradDistributionGumbel, type_v_172> AgradDistributionGumbel_v_172;
+typedef std::tuple<AgradDistributionGumbel, type_v_173> AgradDistributionGumbel_v_173;
+typedef std::tuple<AgradDistributionGumbel, type_v_174> AgradDistributionGumbel_v_174;
+typedef std::tuple<AgradDistributionGumbel, type_v_175> AgradDistributionGumbel_v_175;
+typedef std::tuple<AgradDistributionGumbel, type_v_176> AgradDistributionGumbel_v_176;
+typedef std::tuple<AgradDistributionGumbel, type_v_177> AgradDistributionGumbel_v_177;
+typedef std::tuple<AgradDistributionGumbel, type_v_178> AgradDistributionGumbel_v_178;
+typedef std::tuple<AgradDistributionGumbel, type_v_179> AgradDistributionGumbel_v_179;
+typedef std::tuple<AgradDistributionGumbel, type_v_180> AgradDistributionGumbel_v_180;
+typedef std::tuple<AgradDistributionGumbel, type_v_181> AgradDistributionGumbel_v_181;
+typedef std::tuple<AgradDistributionGumbel, type_v_182> AgradDistributionGumbel_v_182;
+typedef std::tuple<AgradDistributionGumbel, type_v_183> AgradDistributionGumbel_v_183;
+typedef std::tuple<AgradDistributionGumbel, type_v_184> AgradDistributionGumbel_v_184;
+typedef std::tuple<AgradDistributionGumbel, type_v_185> AgradDistributionGumbel_v_185;
+typedef std::tuple<AgradDistributionGumbel, type_v_186> AgradDistributionGumbel_v_186;
+typedef std::tuple<AgradDistributionGumbel, type_v_187> AgradDistributionGumbel_v_187;
+typedef std::tuple<AgradDistributionGumbel, type_v_188> AgradDistributionGumbel_v_188;
+typedef std::tuple<AgradDistributionGumbel, type_v_189> AgradDistributionGumbel_v_189;
+typedef std::tuple<AgradDistributionGumbel, type_v_190> AgradDistributionGumbel_v_190;
+typedef std::tuple<AgradDistributionGumbel, type_v_191> AgradDistributionGumbel_v_191;
+typedef std::tuple<AgradDistributionGumbel, type_v_192> AgradDistributionGumbel_v_192;
+typedef std::tuple<AgradDistributionGumbel, type_v_193> AgradDistributionGumbel_v_193;
+typedef std::tuple<AgradDistributionGumbel, type_v_194> AgradDistributionGumbel_v_194;
+typedef std::tuple<AgradDistributionGumbel, type_v_195> AgradDistributionGumbel_v_195;
+typedef std::tuple<AgradDistributionGumbel, type_v_196> AgradDistributionGumbel_v_196;
+typedef std::tuple<AgradDistributionGumbel, type_v_197> AgradDistributionGumbel_v_197;
+typedef std::tuple<AgradDistributionGumbel, type_v_198> AgradDistributionGumbel_v_198;
+typedef std::tuple<AgradDistributionGumbel, type_v_199> AgradDistributionGumbel_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_100, AgradDistributionTestFixture, AgradDistributionGumbel_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_101, AgradDistributionTestFixture, AgradDistributionGumbel_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_102, AgradDistributionTestFixture, AgradDistributionGumbel_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_103, AgradDistributionTestFixture, AgradDistributionGumbel_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_104, AgradDistributionTestFixture, AgradDistributionGumbel_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_105, AgradDistributionTestFixture, AgradDistributionGumbel_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_106, AgradDistributionTestFixture, AgradDistributionGumbel_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_107, AgradDistributionTestFixture, AgradDistributionGumbel_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_108, AgradDistributionTestFixture, AgradDistributionGumbel_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_109, AgradDistributionTestFixture, AgradDistributionGumbel_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_110, AgradDistributionTestFixture, AgradDistributionGumbel_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_111, AgradDistributionTestFixture, AgradDistributionGumbel_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_112, AgradDistributionTestFixture, AgradDistributionGumbel_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_113, AgradDistributionTestFixture, AgradDistributionGumbel_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_114, AgradDistributionTestFixture, AgradDistributionGumbel_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_115, AgradDistributionTestFixture, AgradDistributionGumbel_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_116, AgradDistributionTestFixture, AgradDistributionGumbel_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_117, AgradDistributionTestFixture, AgradDistributionGumbel_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_118, AgradDistributionTestFixture, AgradDistributionGumbel_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_119, AgradDistributionTestFixture, AgradDistributionGumbel_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_120, AgradDistributionTestFixture, AgradDistributionGumbel_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_121, AgradDistributionTestFixture, AgradDistributionGumbel_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_122, AgradDistributionTestFixture, AgradDistributionGumbel_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_123, AgradDistributionTestFixture, AgradDistributionGumbel_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_124, AgradDistributionTestFixture, AgradDistributionGumbel_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_125, AgradDistributionTestFixture, AgradDistributionGumbel_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_126, AgradDistributionTestFixture, AgradDistributionGumbel_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_127, AgradDistributionTestFixture, AgradDistributionGumbel_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_128, AgradDistributionTestFixture, AgradDistributionGumbel_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_129, AgradDistributionTestFixture, AgradDistributionGumbel_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_130, AgradDistributionTestFixture, AgradDistributionGumbel_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_131, AgradDistributionTestFixture, AgradDistributionGumbel_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_132, AgradDistributionTestFixture, AgradDistributionGumbel_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_133, AgradDistributionTestFixture, AgradDistributionGumbel_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_134, AgradDistributionTestFixture, AgradDistributionGumbel_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_135, AgradDistributionTestFixture, AgradDistributionGumbel_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_136, AgradDistributionTestFixture, AgradDistributionGumbel_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_137, AgradDistributionTestFixture, AgradDistributionGumbel_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_138, AgradDistributionTestFixture, AgradDistributionGumbel_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_139, AgradDistributionTestFixture, AgradDistributionGumbel_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_140, AgradDistributionTestFixture, AgradDistributionGumbel_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_141, AgradDistributionTestFixture, AgradDistributionGumbel_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_142, AgradDistributionTestFixture, AgradDistributionGumbel_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_143, AgradDistributionTestFixture, AgradDistributionGumbel_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_144, AgradDistributionTestFixture, AgradDistributionGumbel_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_145, AgradDistributionTestFixture, AgradDistributionGumbel_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_146, AgradDistributionTestFixture, AgradDistributionGumbel_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_147, AgradDistributionTestFixture, AgradDistributionGumbel_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_148, AgradDistributionTestFixture, AgradDistributionGumbel_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_149, AgradDistributionTestFixture, AgradDistributionGumbel_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_150, AgradDistributionTestFixture, AgradDistributionGumbel_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_151, AgradDistributionTestFixture, AgradDistributionGumbel_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_152, AgradDistributionTestFixture, AgradDistributionGumbel_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_153, AgradDistributionTestFixture, AgradDistributionGumbel_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_154, AgradDistributionTestFixture, AgradDistributionGumbel_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_155, AgradDistributionTestFixture, AgradDistributionGumbel_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_156, AgradDistributionTestFixture, AgradDistributionGumbel_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_157, AgradDistributionTestFixture, AgradDistributionGumbel_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_158, AgradDistributionTestFixture, AgradDistributionGumbel_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_159, AgradDistributionTestFixture, AgradDistributionGumbel_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_160, AgradDistributionTestFixture, AgradDistributionGumbel_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_161, AgradDistributionTestFixture, AgradDistributionGumbel_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_162, AgradDistributionTestFixture, AgradDistributionGumbel_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_163, AgradDistributionTestFixture, AgradDistributionGumbel_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_164, AgradDistributionTestFixture, AgradDistributionGumbel_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_165, AgradDistributionTestFixture, AgradDistributionGumbel_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_166, AgradDistributionTestFixture, AgradDistributionGumbel_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_167, AgradDistributionTestFixture, AgradDistributionGumbel_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_168, AgradDistributionTestFixture, AgradDistributionGumbel_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_169, AgradDistributionTestFixture, AgradDistributionGumbel_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_170, AgradDistributionTestFixture, AgradDistributionGumbel_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_171, AgradDistributionTestFixture, AgradDistributionGumbel_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_172, AgradDistributionTestFixture, AgradDistributionGumbel_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_173, AgradDistributionTestFixture, AgradDistributionGumbel_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_174, AgradDistributionTestFixture, AgradDistributionGumbel_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_175, AgradDistributionTestFixture, AgradDistributionGumbel_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_176, AgradDistributionTestFixture, AgradDistributionGumbel_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_177, AgradDistributionTestFixture, AgradDistributionGumbel_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_178, AgradDistributionTestFixture, AgradDistributionGumbel_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_179, AgradDistributionTestFixture, AgradDistributionGumbel_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_180, AgradDistributionTestFixture, AgradDistributionGumbel_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_181, AgradDistributionTestFixture, AgradDistributionGumbel_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_182, AgradDistributionTestFixture, AgradDistributionGumbel_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_183, AgradDistributionTestFixture, AgradDistributionGumbel_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_184, AgradDistributionTestFixture, AgradDistributionGumbel_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_185, AgradDistributionTestFixture, AgradDistributionGumbel_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_186, AgradDistributionTestFixture, AgradDistributionGumbel_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_187, AgradDistributionTestFixture, AgradDistributionGumbel_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_188, AgradDistributionTestFixture, AgradDistributionGumbel_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_189, AgradDistributionTestFixture, AgradDistributionGumbel_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_190, AgradDistributionTestFixture, AgradDistributionGumbel_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_191, AgradDistributionTestFixture, AgradDistributionGumbel_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_192, AgradDistributionTestFixture, AgradDistributionGumbel_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_193, AgradDistributionTestFixture, AgradDistributionGumbel_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_194, AgradDistributionTestFixture, AgradDistributionGumbel_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_195, AgradDistributionTestFixture, AgradDistributionGumbel_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_196, AgradDistributionTestFixture, AgradDistributionGumbel_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_197, AgradDistributionTestFixture, AgradDistributionGumbel_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_198, AgradDistributionTestFixture, AgradDistributionGumbel_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_199, AgradDistributionTestFixture, AgradDistributionGumbel_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionGumbel, type_vv_100> AgradDistributionGumbel_vv_100;
+typedef std::tuple<AgradDistributionGumbel, type_vv_101> AgradDistributionGumbel_vv_101;
+typedef std::tuple<AgradDistributionGumbel, type_vv_102> AgradDistributionGumbel_vv_102;
+typedef std::tuple<AgradDistributionGumbel, type_vv_103> AgradDistributionGumbel_vv_103;
+typedef std::tuple<AgradDistributionGumbel, type_vv_104> AgradDistributionGumbel_vv_104;
+typedef std::tuple<AgradDistributionGumbel, type_vv_105> AgradDistributionGumbel_vv_105;
+typedef std::tuple<AgradDistributionGumbel, type_vv_106> AgradDistributionGumbel_vv_106;
+typedef std::tuple<AgradDistributionGumbel, type_vv_107> AgradDistributionGumbel_vv_107;
+typedef std::tuple<AgradDistributionGumbel, type_vv_108> AgradDistributionGumbel_vv_108;
+typedef std::tuple<AgradDistributionGumbel, type_vv_109> AgradDistributionGumbel_vv_109;
+typedef std::tuple<AgradDistributionGumbel, type_vv_110> AgradDistributionGumbel_vv_110;
+typedef std::tuple<AgradDistributionGumbel, type_vv_111> AgradDistributionGumbel_vv_111;
+typedef std::tuple<AgradDistributionGumbel, type_vv_112> AgradDistributionGumbel_vv_112;
+typedef std::tuple<AgradDistributionGumbel, type_vv_113> AgradDistributionGumbel_vv_113;
+typedef std::tuple<AgradDistributionGumbel, type_vv_114> AgradDistributionGumbel_vv_114;
+typedef std::tuple<AgradDistributionGumbel, type_vv_115> AgradDistributionGumbel_vv_115;
+typedef std::tuple<AgradDistributionGumbel, type_vv_116> AgradDistributionGumbel_vv_116;
+typedef std::tuple<AgradDistributionGumbel, type_vv_117> AgradDistributionGumbel_vv_117;
+typedef std::tuple<AgradDistributionGumbel, type_vv_118> AgradDistributionGumbel_vv_118;
+typedef std::tuple<AgradDistributionGumbel, type_vv_119> AgradDistributionGumbel_vv_119;
+typedef std::tuple<AgradDistributionGumbel, type_vv_120> AgradDistributionGumbel_vv_120;
+typedef std::tuple<AgradDistributionGumbel, type_vv_121> AgradDistributionGumbel_vv_121;
+typedef std::tuple<AgradDistributionGumbel, type_vv_122> AgradDistributionGumbel_vv_122;
+typedef std::tuple<AgradDistributionGumbel, type_vv_123> AgradDistributionGumbel_vv_123;
+typedef std::tuple<AgradDistributionGumbel, type_vv_124> AgradDistributionGumbel_vv_124;
+typedef std::tuple<AgradDistributionGumbel, type_vv_125> AgradDistributionGumbel_vv_125;
+typedef std::tuple<AgradDistributionGumbel, type_vv_126> AgradDistributionGumbel_vv_126;
+typedef std::tuple<AgradDistributionGumbel, type_vv_127> AgradDistributionGumbel_vv_127;
+typedef std::tuple<AgradDistributionGumbel, type_vv_128> AgradDistributionGumbel_vv_128;
+typedef std::tuple<AgradDistributionGumbel, type_vv_129> AgradDistributionGumbel_vv_129;
+typedef std::tuple<AgradDistributionGumbel, type_vv_130> AgradDistributionGumbel_vv_130;
+typedef std::tuple<AgradDistributionGumbel, type_vv_131> AgradDistributionGumbel_vv_131;
+typedef std::tuple<AgradDistributionGumbel, type_vv_132> AgradDistributionGumbel_vv_132;
+typedef std::tuple<AgradDistributionGumbel, type_vv_133> AgradDistributionGumbel_vv_133;
+typedef std::tuple<AgradDistributionGumbel, type_vv_134> AgradDistributionGumbel_vv_134;
+typedef std::tuple<AgradDistributionGumbel, type_vv_135> AgradDistributionGumbel_vv_135;
+typedef std::tuple<AgradDistributionGumbel, type_vv_136> AgradDistributionGumbel_vv_136;
+typedef std::tuple<AgradDistributionGumbel, type_vv_137> AgradDistributionGumbel_vv_137;
+typedef std::tuple<AgradDistributionGumbel, type_vv_138> AgradDistributionGumbel_vv_138;
+typedef std::tuple<AgradDistributionGumbel, type_vv_139> AgradDistributionGumbel_vv_139;
+typedef std::tuple<AgradDistributionGumbel, type_vv_140> AgradDistributionGumbel_vv_140;
+typedef std::tuple<AgradDistributionGumbel, type_vv_141> AgradDistributionGumbel_vv_141;
+typedef std::tuple<AgradDistributionGumbel, type_vv_142> AgradDistributionGumbel_vv_142;
+typedef std::tuple<AgradDistributionGumbel, type_vv_143> AgradDistributionGumbel_vv_143;
+typedef std::tuple<AgradDistributionGumbel, type_vv_144> AgradDistributionGumbel_vv_144;
+typedef std::tuple<AgradDistributionGumbel, type_vv_145> AgradDistributionGumbel_vv_145;
+typedef std::tuple<AgradDistributionGumbel, type_vv_146> AgradDistributionGumbel_vv_146;
+typedef std::tuple<AgradDistributionGumbel, type_vv_147> AgradDistributionGumbel_vv_147;
+typedef std::tuple<AgradDistributionGumbel, type_vv_148> AgradDistributionGumbel_vv_148;
+typedef std::tuple<AgradDistributionGumbel, type_vv_149> AgradDistributionGumbel_vv_149;
+typedef std::tuple<AgradDistributionGumbel, type_vv_150> AgradDistributionGumbel_vv_150;
+typedef std::tuple<AgradDistributionGumbel, type_vv_151> AgradDistributionGumbel_vv_151;
+typedef std::tuple<AgradDistributionGumbel, type_vv_152> AgradDistributionGumbel_vv_152;
+typedef std::tuple<AgradDistributionGumbel, type_vv_153> AgradDistributionGumbel_vv_153;
+typedef std::tuple<AgradDistributionGumbel, type_vv_154> AgradDistributionGumbel_vv_154;
+typedef std::tuple<AgradDistributionGumbel, type_vv_155> AgradDistributionGumbel_vv_155;
+typedef std::tuple<AgradDistributionGumbel, type_vv_156> AgradDistributionGumbel_vv_156;
+typedef std::tuple<AgradDistributionGumbel, type_vv_157> AgradDistributionGumbel_vv_157;
+typedef std::tuple<AgradDistributionGumbel, type_vv_158> AgradDistributionGumbel_vv_158;
+typedef std::tuple<AgradDistributionGumbel, type_vv_159> AgradDistributionGumbel_vv_159;
+typedef std::tuple<AgradDistributionGumbel, type_vv_160> AgradDistributionGumbel_vv_160;
+typedef std::tuple<AgradDistributionGumbel, type_vv_161> AgradDistributionGumbel_vv_161;
+typedef std::tuple<AgradDistributionGumbel, type_vv_162> AgradDistributionGumbel_vv_162;
+typedef std::tuple<AgradDistributionGumbel, type_vv_163> AgradDistributionGumbel_vv_163;
+typedef std::tuple<AgradDistributionGumbel, type_vv_164> AgradDistributionGumbel_vv_164;
+typedef std::tuple<AgradDistributionGumbel, type_vv_165> AgradDistributionGumbel_vv_165;
+typedef std::tuple<AgradDistributionGumbel, type_vv_166> AgradDistributionGumbel_vv_166;
+typedef std::tuple<AgradDistributionGumbel, type_vv_167> AgradDistributionGumbel_vv_167;
+typedef std::tuple<AgradDistributionGumbel, type_vv_168> AgradDistributionGumbel_vv_168;
+typedef std::tuple<AgradDistributionGumbel, type_vv_169> AgradDistributionGumbel_vv_169;
+typedef std::tuple<AgradDistributionGumbel, type_vv_170> AgradDistributionGumbel_vv_170;
+typedef std::tuple<AgradDistributionGumbel, type_vv_171> AgradDistributionGumbel_vv_171;
+typedef std::tuple<AgradDistributionGumbel, type_vv_172> AgradDistributionGumbel_vv_172;
+typedef std::tuple<AgradDistributionGumbel, type_vv_173> AgradDistributionGumbel_vv_173;
+typedef std::tuple<AgradDistributionGumbel, type_vv_174> AgradDistributionGumbel_vv_174;
+typedef std::tuple<AgradDistributionGumbel, type_vv_175> AgradDistributionGumbel_vv_175;
+typedef std::tuple<AgradDistributionGumbel, type_vv_176> AgradDistributionGumbel_vv_176;
+typedef std::tuple<AgradDistributionGumbel, type_vv_177> AgradDistributionGumbel_vv_177;
+typedef std::tuple<AgradDistributionGumbel, type_vv_178> AgradDistributionGumbel_vv_178;
+typedef std::tuple<AgradDistributionGumbel, type_vv_179> AgradDistributionGumbel_vv_179;
+typedef std::tuple<AgradDistributionGumbel, type_vv_180> AgradDistributionGumbel_vv_180;
+typedef std::tuple<AgradDistributionGumbel, type_vv_181> AgradDistributionGumbel_vv_181;
+typedef std::tuple<AgradDistributionGumbel, type_vv_182> AgradDistributionGumbel_vv_182;
+typedef std::tuple<AgradDistributionGumbel, type_vv_183> AgradDistributionGumbel_vv_183;
+typedef std::tuple<AgradDistributionGumbel, type_vv_184> AgradDistributionGumbel_vv_184;
+typedef std::tuple<AgradDistributionGumbel, type_vv_185> AgradDistributionGumbel_vv_185;
+typedef std::tuple<AgradDistributionGumbel, type_vv_186> AgradDistributionGumbel_vv_186;
+typedef std::tuple<AgradDistributionGumbel, type_vv_187> AgradDistributionGumbel_vv_187;
+typedef std::tuple<AgradDistributionGumbel, type_vv_188> AgradDistributionGumbel_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_100, AgradDistributionTestFixture, AgradDistributionGumbel_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_101, AgradDistributionTestFixture, AgradDistributionGumbel_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_102, AgradDistributionTestFixture, AgradDistributionGumbel_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_103, AgradDistributionTestFixture, AgradDistributionGumbel_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_104, AgradDistributionTestFixture, AgradDistributionGumbel_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_105, AgradDistributionTestFixture, AgradDistributionGumbel_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_106, AgradDistributionTestFixture, AgradDistributionGumbel_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_107, AgradDistributionTestFixture, AgradDistributionGumbel_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_108, AgradDistributionTestFixture, AgradDistributionGumbel_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_109, AgradDistributionTestFixture, AgradDistributionGumbel_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_110, AgradDistributionTestFixture, AgradDistributionGumbel_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_111, AgradDistributionTestFixture, AgradDistributionGumbel_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_112, AgradDistributionTestFixture, AgradDistributionGumbel_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_113, AgradDistributionTestFixture, AgradDistributionGumbel_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_114, AgradDistributionTestFixture, AgradDistributionGumbel_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_115, AgradDistributionTestFixture, AgradDistributionGumbel_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_116, AgradDistributionTestFixture, AgradDistributionGumbel_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_117, AgradDistributionTestFixture, AgradDistributionGumbel_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_118, AgradDistributionTestFixture, AgradDistributionGumbel_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_119, AgradDistributionTestFixture, AgradDistributionGumbel_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_120, AgradDistributionTestFixture, AgradDistributionGumbel_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_121, AgradDistributionTestFixture, AgradDistributionGumbel_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_122, AgradDistributionTestFixture, AgradDistributionGumbel_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_123, AgradDistributionTestFixture, AgradDistributionGumbel_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_124, AgradDistributionTestFixture, AgradDistributionGumbel_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_125, AgradDistributionTestFixture, AgradDistributionGumbel_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_126, AgradDistributionTestFixture, AgradDistributionGumbel_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_127, AgradDistributionTestFixture, AgradDistributionGumbel_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_128, AgradDistributionTestFixture, AgradDistributionGumbel_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_129, AgradDistributionTestFixture, AgradDistributionGumbel_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_130, AgradDistributionTestFixture, AgradDistributionGumbel_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_131, AgradDistributionTestFixture, AgradDistributionGumbel_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_132, AgradDistributionTestFixture, AgradDistributionGumbel_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_133, AgradDistributionTestFixture, AgradDistributionGumbel_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_134, AgradDistributionTestFixture, AgradDistributionGumbel_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_135, AgradDistributionTestFixture, AgradDistributionGumbel_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_136, AgradDistributionTestFixture, AgradDistributionGumbel_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_137, AgradDistributionTestFixture, AgradDistributionGumbel_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_138, AgradDistributionTestFixture, AgradDistributionGumbel_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_139, AgradDistributionTestFixture, AgradDistributionGumbel_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_140, AgradDistributionTestFixture, AgradDistributionGumbel_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_141, AgradDistributionTestFixture, AgradDistributionGumbel_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_142, AgradDistributionTestFixture, AgradDistributionGumbel_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_143, AgradDistributionTestFixture, AgradDistributionGumbel_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_144, AgradDistributionTestFixture, AgradDistributionGumbel_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_145, AgradDistributionTestFixture, AgradDistributionGumbel_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_146, AgradDistributionTestFixture, AgradDistributionGumbel_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_147, AgradDistributionTestFixture, AgradDistributionGumbel_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_148, AgradDistributionTestFixture, AgradDistributionGumbel_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_149, AgradDistributionTestFixture, AgradDistributionGumbel_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_150, AgradDistributionTestFixture, AgradDistributionGumbel_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_151, AgradDistributionTestFixture, AgradDistributionGumbel_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_152, AgradDistributionTestFixture, AgradDistributionGumbel_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_153, AgradDistributionTestFixture, AgradDistributionGumbel_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_154, AgradDistributionTestFixture, AgradDistributionGumbel_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_155, AgradDistributionTestFixture, AgradDistributionGumbel_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_156, AgradDistributionTestFixture, AgradDistributionGumbel_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_157, AgradDistributionTestFixture, AgradDistributionGumbel_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_158, AgradDistributionTestFixture, AgradDistributionGumbel_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_159, AgradDistributionTestFixture, AgradDistributionGumbel_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_160, AgradDistributionTestFixture, AgradDistributionGumbel_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_161, AgradDistributionTestFixture, AgradDistributionGumbel_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_162, AgradDistributionTestFixture, AgradDistributionGumbel_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_163, AgradDistributionTestFixture, AgradDistributionGumbel_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_164, AgradDistributionTestFixture, AgradDistributionGumbel_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_165, AgradDistributionTestFixture, AgradDistributionGumbel_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_166, AgradDistributionTestFixture, AgradDistributionGumbel_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_167, AgradDistributionTestFixture, AgradDistributionGumbel_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_168, AgradDistributionTestFixture, AgradDistributionGumbel_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_169, AgradDistributionTestFixture, AgradDistributionGumbel_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_170, AgradDistributionTestFixture, AgradDistributionGumbel_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_171, AgradDistributionTestFixture, AgradDistributionGumbel_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_172, AgradDistributionTestFixture, AgradDistributionGumbel_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_173, AgradDistributionTestFixture, AgradDistributionGumbel_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_174, AgradDistributionTestFixture, AgradDistributionGumbel_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_175, AgradDistributionTestFixture, AgradDistributionGumbel_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_176, AgradDistributionTestFixture, AgradDistributionGumbel_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_177, AgradDistributionTestFixture, AgradDistributionGumbel_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_178, AgradDistributionTestFixture, AgradDistributionGumbel_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_179, AgradDistributionTestFixture, AgradDistributionGumbel_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_180, AgradDistributionTestFixture, AgradDistributionGumbel_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_181, AgradDistributionTestFixture, AgradDistributionGumbel_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_182, AgradDistributionTestFixture, AgradDistributionGumbel_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_183, AgradDistributionTestFixture, AgradDistributionGumbel_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_184, AgradDistributionTestFixture, AgradDistributionGumbel_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_185, AgradDistributionTestFixture, AgradDistributionGumbel_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_186, AgradDistributionTestFixture, AgradDistributionGumbel_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_187, AgradDistributionTestFixture, AgradDistributionGumbel_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_vv_188, AgradDistributionTestFixture, AgradDistributionGumbel_vv_188);
+
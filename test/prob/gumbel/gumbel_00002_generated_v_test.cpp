@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradDistributionGumbel, type_v_200> AgradDistributionGumbel_v_200;
+typedef std::tuple<AgradDistributionGumbel, type_v_201> AgradDistributionGumbel_v_201;
+typedef std::tuple<AgradDistributionGumbel, type_v_202> AgradDistributionGumbel_v_202;
+typedef std::tuple<AgradDistributionGumbel, type_v_203> AgradDistributionGumbel_v_203;
+typedef std::tuple<AgradDistributionGumbel, type_v_204> AgradDistributionGumbel_v_204;
+typedef std::tuple<AgradDistributionGumbel, type_v_205> AgradDistributionGumbel_v_205;
+typedef std::tuple<AgradDistributionGumbel, type_v_206> AgradDistributionGumbel_v_206;
+typedef std::tuple<AgradDistributionGumbel, type_v_207> AgradDistributionGumbel_v_207;
+typedef std::tuple<AgradDistributionGumbel, type_v_208> AgradDistributionGumbel_v_208;
+typedef std::tuple<AgradDistributionGumbel, type_v_209> AgradDistributionGumbel_v_209;
+typedef std::tuple<AgradDistributionGumbel, type_v_210> AgradDistributionGumbel_v_210;
+typedef std::tuple<AgradDistributionGumbel, type_v_211> AgradDistributionGumbel_v_211;
+typedef std::tuple<AgradDistributionGumbel, type_v_212> AgradDistributionGumbel_v_212;
+typedef std::tuple<AgradDistributionGumbel, type_v_213> AgradDistributionGumbel_v_213;
+typedef std::tuple<AgradDistributionGumbel, type_v_214> AgradDistributionGumbel_v_214;
+typedef std::tuple<AgradDistributionGumbel, type_v_215> AgradDistributionGumbel_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_200, AgradDistributionTestFixture, AgradDistributionGumbel_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_201, AgradDistributionTestFixture, AgradDistributionGumbel_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_202, AgradDistributionTestFixture, AgradDistributionGumbel_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_203, AgradDistributionTestFixture, AgradDistributionGumbel_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_204, AgradDistributionTestFixture, AgradDistributionGumbel_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_205, AgradDistributionTestFixture, AgradDistributionGumbel_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_206, AgradDistributionTestFixture, AgradDistributionGumbel_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_207, AgradDistributionTestFixture, AgradDistributionGumbel_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_208, AgradDistributionTestFixture, AgradDistributionGumbel_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_209, AgradDistributionTestFixture, AgradDistributionGumbel_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_210, AgradDistributionTestFixture, AgradDistributionGumbel_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_211, AgradDistributionTestFixture, AgradDistributionGumbel_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_212, AgradDistributionTestFixture, AgradDistributionGumbel_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_213, AgradDistributionTestFixture, AgradDistributionGumbel_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_214, AgradDistributionTestFixture, AgradDistributionGumbel_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionGumbel_v_215, AgradDistributionTestFixture, AgradDistributionGumbel_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_0> AgradCcdfLogGumbel_ffv_0;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_1> AgradCcdfLogGumbel_ffv_1;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_2> AgradCcdfLogGumbel_ffv_2;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_3> AgradCcdfLogGumbel_ffv_3;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_4> AgradCcdfLogGumbel_ffv_4;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_5> AgradCcdfLogGumbel_ffv_5;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_6> AgradCcdfLogGumbel_ffv_6;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_7> AgradCcdfLogGumbel_ffv_7;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_8> AgradCcdfLogGumbel_ffv_8;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_9> AgradCcdfLogGumbel_ffv_9;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_10> AgradCcdfLogGumbel_ffv_10;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_11> AgradCcdfLogGumbel_ffv_11;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_12> AgradCcdfLogGumbel_ffv_12;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_13> AgradCcdfLogGumbel_ffv_13;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_14> AgradCcdfLogGumbel_ffv_14;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_15> AgradCcdfLogGumbel_ffv_15;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_16> AgradCcdfLogGumbel_ffv_16;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_17> AgradCcdfLogGumbel_ffv_17;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_18> AgradCcdfLogGumbel_ffv_18;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_19> AgradCcdfLogGumbel_ffv_19;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_20> AgradCcdfLogGumbel_ffv_20;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_21> AgradCcdfLogGumbel_ffv_21;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_22> AgradCcdfLogGumbel_ffv_22;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_23> AgradCcdfLogGumbel_ffv_23;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_24> AgradCcdfLogGumbel_ffv_24;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_25> AgradCcdfLogGumbel_ffv_25;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_26> AgradCcdfLogGumbel_ffv_26;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_27> AgradCcdfLogGumbel_ffv_27;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_28> AgradCcdfLogGumbel_ffv_28;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_29> AgradCcdfLogGumbel_ffv_29;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_30> AgradCcdfLogGumbel_ffv_30;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_31> AgradCcdfLogGumbel_ffv_31;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_32> AgradCcdfLogGumbel_ffv_32;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_33> AgradCcdfLogGumbel_ffv_33;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_34> AgradCcdfLogGumbel_ffv_34;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_35> AgradCcdfLogGumbel_ffv_35;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_36> AgradCcdfLogGumbel_ffv_36;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_37> AgradCcdfLogGumbel_ffv_37;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_38> AgradCcdfLogGumbel_ffv_38;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_39> AgradCcdfLogGumbel_ffv_39;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_40> AgradCcdfLogGumbel_ffv_40;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_41> AgradCcdfLogGumbel_ffv_41;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_42> AgradCcdfLogGumbel_ffv_42;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_43> AgradCcdfLogGumbel_ffv_43;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_44> AgradCcdfLogGumbel_ffv_44;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_45> AgradCcdfLogGumbel_ffv_45;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_46> AgradCcdfLogGumbel_ffv_46;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_47> AgradCcdfLogGumbel_ffv_47;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_48> AgradCcdfLogGumbel_ffv_48;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_49> AgradCcdfLogGumbel_ffv_49;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_50> AgradCcdfLogGumbel_ffv_50;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_51> AgradCcdfLogGumbel_ffv_51;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_52> AgradCcdfLogGumbel_ffv_52;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_53> AgradCcdfLogGumbel_ffv_53;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_54> AgradCcdfLogGumbel_ffv_54;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_55> AgradCcdfLogGumbel_ffv_55;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_56> AgradCcdfLogGumbel_ffv_56;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_57> AgradCcdfLogGumbel_ffv_57;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_58> AgradCcdfLogGumbel_ffv_58;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_59> AgradCcdfLogGumbel_ffv_59;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_60> AgradCcdfLogGumbel_ffv_60;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_61> AgradCcdfLogGumbel_ffv_61;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_62> AgradCcdfLogGumbel_ffv_62;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_63> AgradCcdfLogGumbel_ffv_63;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_64> AgradCcdfLogGumbel_ffv_64;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_65> AgradCcdfLogGumbel_ffv_65;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_66> AgradCcdfLogGumbel_ffv_66;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_67> AgradCcdfLogGumbel_ffv_67;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_68> AgradCcdfLogGumbel_ffv_68;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_69> AgradCcdfLogGumbel_ffv_69;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_70> AgradCcdfLogGumbel_ffv_70;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_71> AgradCcdfLogGumbel_ffv_71;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_72> AgradCcdfLogGumbel_ffv_72;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_73> AgradCcdfLogGumbel_ffv_73;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_74> AgradCcdfLogGumbel_ffv_74;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_75> AgradCcdfLogGumbel_ffv_75;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_76> AgradCcdfLogGumbel_ffv_76;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_77> AgradCcdfLogGumbel_ffv_77;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_78> AgradCcdfLogGumbel_ffv_78;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_79> AgradCcdfLogGumbel_ffv_79;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_80> AgradCcdfLogGumbel_ffv_80;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_81> AgradCcdfLogGumbel_ffv_81;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_82> AgradCcdfLogGumbel_ffv_82;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_83> AgradCcdfLogGumbel_ffv_83;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_84> AgradCcdfLogGumbel_ffv_84;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_85> AgradCcdfLogGumbel_ffv_85;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_86> AgradCcdfLogGumbel_ffv_86;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_87> AgradCcdfLogGumbel_ffv_87;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_88> AgradCcdfLogGumbel_ffv_88;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_89> AgradCcdfLogGumbel_ffv_89;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_90> AgradCcdfLogGumbel_ffv_90;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_91> AgradCcdfLogGumbel_ffv_91;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_92> AgradCcdfLogGumbel_ffv_92;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_93> AgradCcdfLogGumbel_ffv_93;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_94> AgradCcdfLogGumbel_ffv_94;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_95> AgradCcdfLogGumbel_ffv_95;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_96> AgradCcdfLogGumbel_ffv_96;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_97> AgradCcdfLogGumbel_ffv_97;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_98> AgradCcdfLogGumbel_ffv_98;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_99> AgradCcdfLogGumbel_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_99);
+
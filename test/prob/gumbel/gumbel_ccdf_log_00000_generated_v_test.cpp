@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogGumbel, type_v_0> AgradCcdfLogGumbel_v_0;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_1> AgradCcdfLogGumbel_v_1;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_2> AgradCcdfLogGumbel_v_2;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_3> AgradCcdfLogGumbel_v_3;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_4> AgradCcdfLogGumbel_v_4;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_5> AgradCcdfLogGumbel_v_5;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_6> AgradCcdfLogGumbel_v_6;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_7> AgradCcdfLogGumbel_v_7;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_8> AgradCcdfLogGumbel_v_8;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_9> AgradCcdfLogGumbel_v_9;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_10> AgradCcdfLogGumbel_v_10;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_11> AgradCcdfLogGumbel_v_11;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_12> AgradCcdfLogGumbel_v_12;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_13> AgradCcdfLogGumbel_v_13;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_14> AgradCcdfLogGumbel_v_14;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_15> AgradCcdfLogGumbel_v_15;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_16> AgradCcdfLogGumbel_v_16;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_17> AgradCcdfLogGumbel_v_17;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_18> AgradCcdfLogGumbel_v_18;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_19> AgradCcdfLogGumbel_v_19;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_20> AgradCcdfLogGumbel_v_20;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_21> AgradCcdfLogGumbel_v_21;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_22> AgradCcdfLogGumbel_v_22;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_23> AgradCcdfLogGumbel_v_23;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_24> AgradCcdfLogGumbel_v_24;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_25> AgradCcdfLogGumbel_v_25;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_26> AgradCcdfLogGumbel_v_26;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_27> AgradCcdfLogGumbel_v_27;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_28> AgradCcdfLogGumbel_v_28;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_29> AgradCcdfLogGumbel_v_29;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_30> AgradCcdfLogGumbel_v_30;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_31> AgradCcdfLogGumbel_v_31;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_32> AgradCcdfLogGumbel_v_32;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_33> AgradCcdfLogGumbel_v_33;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_34> AgradCcdfLogGumbel_v_34;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_35> AgradCcdfLogGumbel_v_35;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_36> AgradCcdfLogGumbel_v_36;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_37> AgradCcdfLogGumbel_v_37;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_38> AgradCcdfLogGumbel_v_38;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_39> AgradCcdfLogGumbel_v_39;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_40> AgradCcdfLogGumbel_v_40;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_41> AgradCcdfLogGumbel_v_41;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_42> AgradCcdfLogGumbel_v_42;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_43> AgradCcdfLogGumbel_v_43;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_44> AgradCcdfLogGumbel_v_44;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_45> AgradCcdfLogGumbel_v_45;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_46> AgradCcdfLogGumbel_v_46;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_47> AgradCcdfLogGumbel_v_47;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_48> AgradCcdfLogGumbel_v_48;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_49> AgradCcdfLogGumbel_v_49;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_50> AgradCcdfLogGumbel_v_50;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_51> AgradCcdfLogGumbel_v_51;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_52> AgradCcdfLogGumbel_v_52;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_53> AgradCcdfLogGumbel_v_53;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_54> AgradCcdfLogGumbel_v_54;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_55> AgradCcdfLogGumbel_v_55;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_56> AgradCcdfLogGumbel_v_56;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_57> AgradCcdfLogGumbel_v_57;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_58> AgradCcdfLogGumbel_v_58;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_59> AgradCcdfLogGumbel_v_59;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_60> AgradCcdfLogGumbel_v_60;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_61> AgradCcdfLogGumbel_v_61;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_62> AgradCcdfLogGumbel_v_62;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_63> AgradCcdfLogGumbel_v_63;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_64> AgradCcdfLogGumbel_v_64;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_65> AgradCcdfLogGumbel_v_65;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_66> AgradCcdfLogGumbel_v_66;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_67> AgradCcdfLogGumbel_v_67;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_68> AgradCcdfLogGumbel_v_68;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_69> AgradCcdfLogGumbel_v_69;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_70> AgradCcdfLogGumbel_v_70;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_71> AgradCcdfLogGumbel_v_71;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_72> AgradCcdfLogGumbel_v_72;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_73> AgradCcdfLogGumbel_v_73;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_74> AgradCcdfLogGumbel_v_74;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_75> AgradCcdfLogGumbel_v_75;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_76> AgradCcdfLogGumbel_v_76;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_77> AgradCcdfLogGumbel_v_77;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_78> AgradCcdfLogGumbel_v_78;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_79> AgradCcdfLogGumbel_v_79;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_80> AgradCcdfLogGumbel_v_80;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_81> AgradCcdfLogGumbel_v_81;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_82> AgradCcdfLogGumbel_v_82;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_83> AgradCcdfLogGumbel_v_83;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_84> AgradCcdfLogGumbel_v_84;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_85> AgradCcdfLogGumbel_v_85;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_86> AgradCcdfLogGumbel_v_86;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_87> AgradCcdfLogGumbel_v_87;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_88> AgradCcdfLogGumbel_v_88;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_89> AgradCcdfLogGumbel_v_89;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_90> AgradCcdfLogGumbel_v_90;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_91> AgradCcdfLogGumbel_v_91;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_92> AgradCcdfLogGumbel_v_92;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_93> AgradCcdfLogGumbel_v_93;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_94> AgradCcdfLogGumbel_v_94;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_95> AgradCcdfLogGumbel_v_95;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_96> AgradCcdfLogGumbel_v_96;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_97> AgradCcdfLogGumbel_v_97;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_98> AgradCcdfLogGumbel_v_98;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_99> AgradCcdfLogGumbel_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_0, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_1, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_2, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_3, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_4, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_5, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_6, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_7, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_8, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_9, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_10, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_11, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_12, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_13, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_14, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_15, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_16, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_17, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_18, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_19, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_20, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_21, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_22, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_23, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_24, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_25, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_26, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_27, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_28, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_29, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_30, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_31, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_32, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_33, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_34, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_35, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_36, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_37, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_38, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_39, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_40, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_41, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_42, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_43, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_44, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_45, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_46, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_47, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_48, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_49, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_50, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_51, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_52, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_53, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_54, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_55, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_56, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_57, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_58, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_59, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_60, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_61, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_62, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_63, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_64, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_65, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_66, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_67, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_68, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_69, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_70, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_71, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_72, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_73, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_74, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_75, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_76, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_77, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_78, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_79, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_80, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_81, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_82, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_83, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_84, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_85, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_86, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_87, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_88, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_89, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_90, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_91, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_92, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_93, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_94, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_95, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_96, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_97, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_98, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_99, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_99);
+
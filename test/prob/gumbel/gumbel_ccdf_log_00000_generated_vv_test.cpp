@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_0> AgradCcdfLogGumbel_vv_0;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_1> AgradCcdfLogGumbel_vv_1;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_2> AgradCcdfLogGumbel_vv_2;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_3> AgradCcdfLogGumbel_vv_3;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_4> AgradCcdfLogGumbel_vv_4;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_5> AgradCcdfLogGumbel_vv_5;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_6> AgradCcdfLogGumbel_vv_6;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_7> AgradCcdfLogGumbel_vv_7;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_8> AgradCcdfLogGumbel_vv_8;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_9> AgradCcdfLogGumbel_vv_9;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_10> AgradCcdfLogGumbel_vv_10;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_11> AgradCcdfLogGumbel_vv_11;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_12> AgradCcdfLogGumbel_vv_12;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_13> AgradCcdfLogGumbel_vv_13;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_14> AgradCcdfLogGumbel_vv_14;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_15> AgradCcdfLogGumbel_vv_15;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_16> AgradCcdfLogGumbel_vv_16;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_17> AgradCcdfLogGumbel_vv_17;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_18> AgradCcdfLogGumbel_vv_18;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_19> AgradCcdfLogGumbel_vv_19;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_20> AgradCcdfLogGumbel_vv_20;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_21> AgradCcdfLogGumbel_vv_21;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_22> AgradCcdfLogGumbel_vv_22;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_23> AgradCcdfLogGumbel_vv_23;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_24> AgradCcdfLogGumbel_vv_24;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_25> AgradCcdfLogGumbel_vv_25;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_26> AgradCcdfLogGumbel_vv_26;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_27> AgradCcdfLogGumbel_vv_27;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_28> AgradCcdfLogGumbel_vv_28;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_29> AgradCcdfLogGumbel_vv_29;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_30> AgradCcdfLogGumbel_vv_30;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_31> AgradCcdfLogGumbel_vv_31;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_32> AgradCcdfLogGumbel_vv_32;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_33> AgradCcdfLogGumbel_vv_33;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_34> AgradCcdfLogGumbel_vv_34;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_35> AgradCcdfLogGumbel_vv_35;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_36> AgradCcdfLogGumbel_vv_36;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_37> AgradCcdfLogGumbel_vv_37;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_38> AgradCcdfLogGumbel_vv_38;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_39> AgradCcdfLogGumbel_vv_39;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_40> AgradCcdfLogGumbel_vv_40;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_41> AgradCcdfLogGumbel_vv_41;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_42> AgradCcdfLogGumbel_vv_42;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_43> AgradCcdfLogGumbel_vv_43;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_44> AgradCcdfLogGumbel_vv_44;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_45> AgradCcdfLogGumbel_vv_45;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_46> AgradCcdfLogGumbel_vv_46;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_47> AgradCcdfLogGumbel_vv_47;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_48> AgradCcdfLogGumbel_vv_48;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_49> AgradCcdfLogGumbel_vv_49;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_50> AgradCcdfLogGumbel_vv_50;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_51> AgradCcdfLogGumbel_vv_51;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_52> AgradCcdfLogGumbel_vv_52;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_53> AgradCcdfLogGumbel_vv_53;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_54> AgradCcdfLogGumbel_vv_54;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_55> AgradCcdfLogGumbel_vv_55;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_56> AgradCcdfLogGumbel_vv_56;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_57> AgradCcdfLogGumbel_vv_57;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_58> AgradCcdfLogGumbel_vv_58;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_59> AgradCcdfLogGumbel_vv_59;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_60> AgradCcdfLogGumbel_vv_60;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_61> AgradCcdfLogGumbel_vv_61;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_62> AgradCcdfLogGumbel_vv_62;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_63> AgradCcdfLogGumbel_vv_63;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_64> AgradCcdfLogGumbel_vv_64;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_65> AgradCcdfLogGumbel_vv_65;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_66> AgradCcdfLogGumbel_vv_66;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_67> AgradCcdfLogGumbel_vv_67;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_68> AgradCcdfLogGumbel_vv_68;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_69> AgradCcdfLogGumbel_vv_69;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_70> AgradCcdfLogGumbel_vv_70;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_71> AgradCcdfLogGumbel_vv_71;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_72> AgradCcdfLogGumbel_vv_72;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_73> AgradCcdfLogGumbel_vv_73;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_74> AgradCcdfLogGumbel_vv_74;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_75> AgradCcdfLogGumbel_vv_75;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_76> AgradCcdfLogGumbel_vv_76;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_77> AgradCcdfLogGumbel_vv_77;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_78> AgradCcdfLogGumbel_vv_78;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_79> AgradCcdfLogGumbel_vv_79;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_80> AgradCcdfLogGumbel_vv_80;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_81> AgradCcdfLogGumbel_vv_81;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_82> AgradCcdfLogGumbel_vv_82;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_83> AgradCcdfLogGumbel_vv_83;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_84> AgradCcdfLogGumbel_vv_84;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_85> AgradCcdfLogGumbel_vv_85;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_86> AgradCcdfLogGumbel_vv_86;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_87> AgradCcdfLogGumbel_vv_87;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_88> AgradCcdfLogGumbel_vv_88;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_89> AgradCcdfLogGumbel_vv_89;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_90> AgradCcdfLogGumbel_vv_90;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_91> AgradCcdfLogGumbel_vv_91;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_92> AgradCcdfLogGumbel_vv_92;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_93> AgradCcdfLogGumbel_vv_93;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_94> AgradCcdfLogGumbel_vv_94;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_95> AgradCcdfLogGumbel_vv_95;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_96> AgradCcdfLogGumbel_vv_96;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_97> AgradCcdfLogGumbel_vv_97;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_98> AgradCcdfLogGumbel_vv_98;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_99> AgradCcdfLogGumbel_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_99);
+
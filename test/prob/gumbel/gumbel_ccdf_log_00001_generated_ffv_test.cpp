@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_100> AgradCcdfLogGumbel_ffv_100;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_101> AgradCcdfLogGumbel_ffv_101;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_102> AgradCcdfLogGumbel_ffv_102;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_103> AgradCcdfLogGumbel_ffv_103;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_104> AgradCcdfLogGumbel_ffv_104;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_105> AgradCcdfLogGumbel_ffv_105;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_106> AgradCcdfLogGumbel_ffv_106;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_107> AgradCcdfLogGumbel_ffv_107;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_108> AgradCcdfLogGumbel_ffv_108;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_109> AgradCcdfLogGumbel_ffv_109;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_110> AgradCcdfLogGumbel_ffv_110;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_111> AgradCcdfLogGumbel_ffv_111;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_112> AgradCcdfLogGumbel_ffv_112;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_113> AgradCcdfLogGumbel_ffv_113;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_114> AgradCcdfLogGumbel_ffv_114;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_115> AgradCcdfLogGumbel_ffv_115;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_116> AgradCcdfLogGumbel_ffv_116;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_117> AgradCcdfLogGumbel_ffv_117;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_118> AgradCcdfLogGumbel_ffv_118;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_119> AgradCcdfLogGumbel_ffv_119;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_120> AgradCcdfLogGumbel_ffv_120;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_121> AgradCcdfLogGumbel_ffv_121;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_122> AgradCcdfLogGumbel_ffv_122;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_123> AgradCcdfLogGumbel_ffv_123;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_124> AgradCcdfLogGumbel_ffv_124;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_125> AgradCcdfLogGumbel_ffv_125;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_126> AgradCcdfLogGumbel_ffv_126;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_127> AgradCcdfLogGumbel_ffv_127;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_128> AgradCcdfLogGumbel_ffv_128;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_129> AgradCcdfLogGumbel_ffv_129;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_130> AgradCcdfLogGumbel_ffv_130;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_131> AgradCcdfLogGumbel_ffv_131;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_132> AgradCcdfLogGumbel_ffv_132;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_133> AgradCcdfLogGumbel_ffv_133;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_134> AgradCcdfLogGumbel_ffv_134;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_135> AgradCcdfLogGumbel_ffv_135;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_136> AgradCcdfLogGumbel_ffv_136;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_137> AgradCcdfLogGumbel_ffv_137;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_138> AgradCcdfLogGumbel_ffv_138;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_139> AgradCcdfLogGumbel_ffv_139;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_140> AgradCcdfLogGumbel_ffv_140;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_141> AgradCcdfLogGumbel_ffv_141;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_142> AgradCcdfLogGumbel_ffv_142;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_143> AgradCcdfLogGumbel_ffv_143;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_144> AgradCcdfLogGumbel_ffv_144;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_145> AgradCcdfLogGumbel_ffv_145;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_146> AgradCcdfLogGumbel_ffv_146;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_147> AgradCcdfLogGumbel_ffv_147;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_148> AgradCcdfLogGumbel_ffv_148;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_149> AgradCcdfLogGumbel_ffv_149;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_150> AgradCcdfLogGumbel_ffv_150;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_151> AgradCcdfLogGumbel_ffv_151;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_152> AgradCcdfLogGumbel_ffv_152;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_153> AgradCcdfLogGumbel_ffv_153;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_154> AgradCcdfLogGumbel_ffv_154;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_155> AgradCcdfLogGumbel_ffv_155;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_156> AgradCcdfLogGumbel_ffv_156;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_157> AgradCcdfLogGumbel_ffv_157;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_158> AgradCcdfLogGumbel_ffv_158;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_159> AgradCcdfLogGumbel_ffv_159;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_160> AgradCcdfLogGumbel_ffv_160;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_161> AgradCcdfLogGumbel_ffv_161;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_162> AgradCcdfLogGumbel_ffv_162;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_163> AgradCcdfLogGumbel_ffv_163;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_164> AgradCcdfLogGumbel_ffv_164;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_165> AgradCcdfLogGumbel_ffv_165;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_166> AgradCcdfLogGumbel_ffv_166;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_167> AgradCcdfLogGumbel_ffv_167;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_168> AgradCcdfLogGumbel_ffv_168;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_169> AgradCcdfLogGumbel_ffv_169;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_170> AgradCcdfLogGumbel_ffv_170;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_171> AgradCcdfLogGumbel_ffv_171;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_172> AgradCcdfLogGumbel_ffv_172;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_173> AgradCcdfLogGumbel_ffv_173;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_174> AgradCcdfLogGumbel_ffv_174;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_175> AgradCcdfLogGumbel_ffv_175;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_176> AgradCcdfLogGumbel_ffv_176;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_177> AgradCcdfLogGumbel_ffv_177;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_178> AgradCcdfLogGumbel_ffv_178;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_179> AgradCcdfLogGumbel_ffv_179;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_180> AgradCcdfLogGumbel_ffv_180;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_181> AgradCcdfLogGumbel_ffv_181;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_182> AgradCcdfLogGumbel_ffv_182;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_183> AgradCcdfLogGumbel_ffv_183;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_184> AgradCcdfLogGumbel_ffv_184;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_185> AgradCcdfLogGumbel_ffv_185;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_186> AgradCcdfLogGumbel_ffv_186;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_187> AgradCcdfLogGumbel_ffv_187;
+typedef std::tuple<AgradCcdfLogGumbel, type_ffv_188> AgradCcdfLogGumbel_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_ffv_188);
+
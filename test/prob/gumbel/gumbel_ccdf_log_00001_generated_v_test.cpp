@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogGumbel, type_v_100> AgradCcdfLogGumbel_v_100;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_101> AgradCcdfLogGumbel_v_101;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_102> AgradCcdfLogGumbel_v_102;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_103> AgradCcdfLogGumbel_v_103;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_104> AgradCcdfLogGumbel_v_104;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_105> AgradCcdfLogGumbel_v_105;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_106> AgradCcdfLogGumbel_v_106;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_107> AgradCcdfLogGumbel_v_107;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_108> AgradCcdfLogGumbel_v_108;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_109> AgradCcdfLogGumbel_v_109;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_110> AgradCcdfLogGumbel_v_110;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_111> AgradCcdfLogGumbel_v_111;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_112> AgradCcdfLogGumbel_v_112;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_113> AgradCcdfLogGumbel_v_113;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_114> AgradCcdfLogGumbel_v_114;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_115> AgradCcdfLogGumbel_v_115;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_116> AgradCcdfLogGumbel_v_116;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_117> AgradCcdfLogGumbel_v_117;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_118> AgradCcdfLogGumbel_v_118;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_119> AgradCcdfLogGumbel_v_119;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_120> AgradCcdfLogGumbel_v_120;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_121> AgradCcdfLogGumbel_v_121;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_122> AgradCcdfLogGumbel_v_122;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_123> AgradCcdfLogGumbel_v_123;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_124> AgradCcdfLogGumbel_v_124;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_125> AgradCcdfLogGumbel_v_125;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_126> AgradCcdfLogGumbel_v_126;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_127> AgradCcdfLogGumbel_v_127;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_128> AgradCcdfLogGumbel_v_128;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_129> AgradCcdfLogGumbel_v_129;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_130> AgradCcdfLogGumbel_v_130;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_131> AgradCcdfLogGumbel_v_131;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_132> AgradCcdfLogGumbel_v_132;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_133> AgradCcdfLogGumbel_v_133;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_134> AgradCcdfLogGumbel_v_134;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_135> AgradCcdfLogGumbel_v_135;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_136> AgradCcdfLogGumbel_v_136;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_137> AgradCcdfLogGumbel_v_137;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_138> AgradCcdfLogGumbel_v_138;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_139> AgradCcdfLogGumbel_v_139;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_140> AgradCcdfLogGumbel_v_140;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_141> AgradCcdfLogGumbel_v_141;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_142> AgradCcdfLogGumbel_v_142;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_143> AgradCcdfLogGumbel_v_143;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_144> AgradCcdfLogGumbel_v_144;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_145> AgradCcdfLogGumbel_v_145;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_146> AgradCcdfLogGumbel_v_146;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_147> AgradCcdfLogGumbel_v_147;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_148> AgradCcdfLogGumbel_v_148;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_149> AgradCcdfLogGumbel_v_149;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_150> AgradCcdfLogGumbel_v_150;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_151> AgradCcdfLogGumbel_v_151;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_152> AgradCcdfLogGumbel_v_152;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_153> AgradCcdfLogGumbel_v_153;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_154> AgradCcdfLogGumbel_v_154;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_155> AgradCcdfLogGumbel_v_155;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_156> AgradCcdfLogGumbel_v_156;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_157> AgradCcdfLogGumbel_v_157;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_158> AgradCcdfLogGumbel_v_158;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_159> AgradCcdfLogGumbel_v_159;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_160> AgradCcdfLogGumbel_v_160;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_161> AgradCcdfLogGumbel_v_161;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_162> AgradCcdfLogGumbel_v_162;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_163> AgradCcdfLogGumbel_v_163;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_164> AgradCcdfLogGumbel_v_164;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_165> AgradCcdfLogGumbel_v_165;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_166> AgradCcdfLogGumbel_v_166;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_167> AgradCcdfLogGumbel_v_167;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_168> AgradCcdfLogGumbel_v_168;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_169> AgradCcdfLogGumbel_v_169;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_170> AgradCcdfLogGumbel_v_170;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_171> AgradCcdfLogGumbel_v_171;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_172> AgradCcdfLogGumbel_v_172;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_173> AgradCcdfLogGumbel_v_173;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_174> AgradCcdfLogGumbel_v_174;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_175> AgradCcdfLogGumbel_v_175;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_176> AgradCcdfLogGumbel_v_176;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_177> AgradCcdfLogGumbel_v_177;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_178> AgradCcdfLogGumbel_v_178;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_179> AgradCcdfLogGumbel_v_179;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_180> AgradCcdfLogGumbel_v_180;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_181> AgradCcdfLogGumbel_v_181;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_182> AgradCcdfLogGumbel_v_182;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_183> AgradCcdfLogGumbel_v_183;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_184> AgradCcdfLogGumbel_v_184;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_185> AgradCcdfLogGumbel_v_185;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_186> AgradCcdfLogGumbel_v_186;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_187> AgradCcdfLogGumbel_v_187;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_188> AgradCcdfLogGumbel_v_188;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_189> AgradCcdfLogGumbel_v_189;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_190> AgradCcdfLogGumbel_v_190;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_191> AgradCcdfLogGumbel_v_191;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_192> AgradCcdfLogGumbel_v_192;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_193> AgradCcdfLogGumbel_v_193;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_194> AgradCcdfLogGumbel_v_194;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_195> AgradCcdfLogGumbel_v_195;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_196> AgradCcdfLogGumbel_v_196;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_197> AgradCcdfLogGumbel_v_197;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_198> AgradCcdfLogGumbel_v_198;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_199> AgradCcdfLogGumbel_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_100, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_101, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_102, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_103, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_104, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_105, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_106, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_107, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_108, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_109, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_110, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_111, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_112, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_113, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_114, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_115, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_116, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_117, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_118, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_119, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_120, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_121, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_122, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_123, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_124, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_125, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_126, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_127, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_128, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_129, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_130, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_131, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_132, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_133, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_134, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_135, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_136, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_137, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_138, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_139, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_140, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_141, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_142, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_143, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_144, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_145, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_146, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_147, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_148, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_149, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_150, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_151, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_152, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_153, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_154, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_155, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_156, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_157, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_158, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_159, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_160, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_161, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_162, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_163, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_164, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_165, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_166, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_167, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_168, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_169, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_170, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_171, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_172, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_173, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_174, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_175, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_176, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_177, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_178, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_179, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_180, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_181, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_182, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_183, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_184, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_185, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_186, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_187, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_188, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_189, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_190, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_191, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_192, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_193, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_194, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_195, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_196, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_197, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_198, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_199, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_199);
+
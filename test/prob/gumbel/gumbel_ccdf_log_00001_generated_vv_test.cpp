@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_100> AgradCcdfLogGumbel_vv_100;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_101> AgradCcdfLogGumbel_vv_101;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_102> AgradCcdfLogGumbel_vv_102;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_103> AgradCcdfLogGumbel_vv_103;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_104> AgradCcdfLogGumbel_vv_104;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_105> AgradCcdfLogGumbel_vv_105;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_106> AgradCcdfLogGumbel_vv_106;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_107> AgradCcdfLogGumbel_vv_107;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_108> AgradCcdfLogGumbel_vv_108;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_109> AgradCcdfLogGumbel_vv_109;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_110> AgradCcdfLogGumbel_vv_110;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_111> AgradCcdfLogGumbel_vv_111;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_112> AgradCcdfLogGumbel_vv_112;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_113> AgradCcdfLogGumbel_vv_113;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_114> AgradCcdfLogGumbel_vv_114;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_115> AgradCcdfLogGumbel_vv_115;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_116> AgradCcdfLogGumbel_vv_116;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_117> AgradCcdfLogGumbel_vv_117;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_118> AgradCcdfLogGumbel_vv_118;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_119> AgradCcdfLogGumbel_vv_119;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_120> AgradCcdfLogGumbel_vv_120;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_121> AgradCcdfLogGumbel_vv_121;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_122> AgradCcdfLogGumbel_vv_122;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_123> AgradCcdfLogGumbel_vv_123;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_124> AgradCcdfLogGumbel_vv_124;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_125> AgradCcdfLogGumbel_vv_125;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_126> AgradCcdfLogGumbel_vv_126;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_127> AgradCcdfLogGumbel_vv_127;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_128> AgradCcdfLogGumbel_vv_128;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_129> AgradCcdfLogGumbel_vv_129;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_130> AgradCcdfLogGumbel_vv_130;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_131> AgradCcdfLogGumbel_vv_131;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_132> AgradCcdfLogGumbel_vv_132;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_133> AgradCcdfLogGumbel_vv_133;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_134> AgradCcdfLogGumbel_vv_134;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_135> AgradCcdfLogGumbel_vv_135;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_136> AgradCcdfLogGumbel_vv_136;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_137> AgradCcdfLogGumbel_vv_137;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_138> AgradCcdfLogGumbel_vv_138;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_139> AgradCcdfLogGumbel_vv_139;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_140> AgradCcdfLogGumbel_vv_140;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_141> AgradCcdfLogGumbel_vv_141;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_142> AgradCcdfLogGumbel_vv_142;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_143> AgradCcdfLogGumbel_vv_143;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_144> AgradCcdfLogGumbel_vv_144;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_145> AgradCcdfLogGumbel_vv_145;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_146> AgradCcdfLogGumbel_vv_146;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_147> AgradCcdfLogGumbel_vv_147;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_148> AgradCcdfLogGumbel_vv_148;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_149> AgradCcdfLogGumbel_vv_149;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_150> AgradCcdfLogGumbel_vv_150;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_151> AgradCcdfLogGumbel_vv_151;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_152> AgradCcdfLogGumbel_vv_152;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_153> AgradCcdfLogGumbel_vv_153;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_154> AgradCcdfLogGumbel_vv_154;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_155> AgradCcdfLogGumbel_vv_155;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_156> AgradCcdfLogGumbel_vv_156;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_157> AgradCcdfLogGumbel_vv_157;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_158> AgradCcdfLogGumbel_vv_158;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_159> AgradCcdfLogGumbel_vv_159;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_160> AgradCcdfLogGumbel_vv_160;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_161> AgradCcdfLogGumbel_vv_161;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_162> AgradCcdfLogGumbel_vv_162;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_163> AgradCcdfLogGumbel_vv_163;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_164> AgradCcdfLogGumbel_vv_164;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_165> AgradCcdfLogGumbel_vv_165;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_166> AgradCcdfLogGumbel_vv_166;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_167> AgradCcdfLogGumbel_vv_167;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_168> AgradCcdfLogGumbel_vv_168;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_169> AgradCcdfLogGumbel_vv_169;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_170> AgradCcdfLogGumbel_vv_170;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_171> AgradCcdfLogGumbel_vv_171;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_172> AgradCcdfLogGumbel_vv_172;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_173> AgradCcdfLogGumbel_vv_173;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_174> AgradCcdfLogGumbel_vv_174;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_175> AgradCcdfLogGumbel_vv_175;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_176> AgradCcdfLogGumbel_vv_176;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_177> AgradCcdfLogGumbel_vv_177;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_178> AgradCcdfLogGumbel_vv_178;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_179> AgradCcdfLogGumbel_vv_179;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_180> AgradCcdfLogGumbel_vv_180;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_181> AgradCcdfLogGumbel_vv_181;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_182> AgradCcdfLogGumbel_vv_182;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_183> AgradCcdfLogGumbel_vv_183;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_184> AgradCcdfLogGumbel_vv_184;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_185> AgradCcdfLogGumbel_vv_185;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_186> AgradCcdfLogGumbel_vv_186;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_187> AgradCcdfLogGumbel_vv_187;
+typedef std::tuple<AgradCcdfLogGumbel, type_vv_188> AgradCcdfLogGumbel_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCcdfLogGumbel, type_v_200> AgradCcdfLogGumbel_v_200;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_201> AgradCcdfLogGumbel_v_201;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_202> AgradCcdfLogGumbel_v_202;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_203> AgradCcdfLogGumbel_v_203;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_204> AgradCcdfLogGumbel_v_204;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_205> AgradCcdfLogGumbel_v_205;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_206> AgradCcdfLogGumbel_v_206;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_207> AgradCcdfLogGumbel_v_207;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_208> AgradCcdfLogGumbel_v_208;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_209> AgradCcdfLogGumbel_v_209;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_210> AgradCcdfLogGumbel_v_210;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_211> AgradCcdfLogGumbel_v_211;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_212> AgradCcdfLogGumbel_v_212;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_213> AgradCcdfLogGumbel_v_213;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_214> AgradCcdfLogGumbel_v_214;
+typedef std::tuple<AgradCcdfLogGumbel, type_v_215> AgradCcdfLogGumbel_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_200, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_201, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_202, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_203, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_204, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_205, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_206, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_207, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_208, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_209, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_210, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_211, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_212, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_213, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_214, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogGumbel_v_215, AgradCcdfLogTestFixture, AgradCcdfLogGumbel_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_cdf_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfGumbel, type_ffv_0> AgradCdfGumbel_ffv_0;
+typedef std::tuple<AgradCdfGumbel, type_ffv_1> AgradCdfGumbel_ffv_1;
+typedef std::tuple<AgradCdfGumbel, type_ffv_2> AgradCdfGumbel_ffv_2;
+typedef std::tuple<AgradCdfGumbel, type_ffv_3> AgradCdfGumbel_ffv_3;
+typedef std::tuple<AgradCdfGumbel, type_ffv_4> AgradCdfGumbel_ffv_4;
+typedef std::tuple<AgradCdfGumbel, type_ffv_5> AgradCdfGumbel_ffv_5;
+typedef std::tuple<AgradCdfGumbel, type_ffv_6> AgradCdfGumbel_ffv_6;
+typedef std::tuple<AgradCdfGumbel, type_ffv_7> AgradCdfGumbel_ffv_7;
+typedef std::tuple<AgradCdfGumbel, type_ffv_8> AgradCdfGumbel_ffv_8;
+typedef std::tuple<AgradCdfGumbel, type_ffv_9> AgradCdfGumbel_ffv_9;
+typedef std::tuple<AgradCdfGumbel, type_ffv_10> AgradCdfGumbel_ffv_10;
+typedef std::tuple<AgradCdfGumbel, type_ffv_11> AgradCdfGumbel_ffv_11;
+typedef std::tuple<AgradCdfGumbel, type_ffv_12> AgradCdfGumbel_ffv_12;
+typedef std::tuple<AgradCdfGumbel, type_ffv_13> AgradCdfGumbel_ffv_13;
+typedef std::tuple<AgradCdfGumbel, type_ffv_14> AgradCdfGumbel_ffv_14;
+typedef std::tuple<AgradCdfGumbel, type_ffv_15> AgradCdfGumbel_ffv_15;
+typedef std::tuple<AgradCdfGumbel, type_ffv_16> AgradCdfGumbel_ffv_16;
+typedef std::tuple<AgradCdfGumbel, type_ffv_17> AgradCdfGumbel_ffv_17;
+typedef std::tuple<AgradCdfGumbel, type_ffv_18> AgradCdfGumbel_ffv_18;
+typedef std::tuple<AgradCdfGumbel, type_ffv_19> AgradCdfGumbel_ffv_19;
+typedef std::tuple<AgradCdfGumbel, type_ffv_20> AgradCdfGumbel_ffv_20;
+typedef std::tuple<AgradCdfGumbel, type_ffv_21> AgradCdfGumbel_ffv_21;
+typedef std::tuple<AgradCdfGumbel, type_ffv_22> AgradCdfGumbel_ffv_22;
+typedef std::tuple<AgradCdfGumbel, type_ffv_23> AgradCdfGumbel_ffv_23;
+typedef std::tuple<AgradCdfGumbel, type_ffv_24> AgradCdfGumbel_ffv_24;
+typedef std::tuple<AgradCdfGumbel, type_ffv_25> AgradCdfGumbel_ffv_25;
+typedef std::tuple<AgradCdfGumbel, type_ffv_26> AgradCdfGumbel_ffv_26;
+typedef std::tuple<AgradCdfGumbel, type_ffv_27> AgradCdfGumbel_ffv_27;
+typedef std::tuple<AgradCdfGumbel, type_ffv_28> AgradCdfGumbel_ffv_28;
+typedef std::tuple<AgradCdfGumbel, type_ffv_29> AgradCdfGumbel_ffv_29;
+typedef std::tuple<AgradCdfGumbel, type_ffv_30> AgradCdfGumbel_ffv_30;
+typedef std::tuple<AgradCdfGumbel, type_ffv_31> AgradCdfGumbel_ffv_31;
+typedef std::tuple<AgradCdfGumbel, type_ffv_32> AgradCdfGumbel_ffv_32;
+typedef std::tuple<AgradCdfGumbel, type_ffv_33> AgradCdfGumbel_ffv_33;
+typedef std::tuple<AgradCdfGumbel, type_ffv_34> AgradCdfGumbel_ffv_34;
+typedef std::tuple<AgradCdfGumbel, type_ffv_35> AgradCdfGumbel_ffv_35;
+typedef std::tuple<AgradCdfGumbel, type_ffv_36> AgradCdfGumbel_ffv_36;
+typedef std::tuple<AgradCdfGumbel, type_ffv_37> AgradCdfGumbel_ffv_37;
+typedef std::tuple<AgradCdfGumbel, type_ffv_38> AgradCdfGumbel_ffv_38;
+typedef std::tuple<AgradCdfGumbel, type_ffv_39> AgradCdfGumbel_ffv_39;
+typedef std::tuple<AgradCdfGumbel, type_ffv_40> AgradCdfGumbel_ffv_40;
+typedef std::tuple<AgradCdfGumbel, type_ffv_41> AgradCdfGumbel_ffv_41;
+typedef std::tuple<AgradCdfGumbel, type_ffv_42> AgradCdfGumbel_ffv_42;
+typedef std::tuple<AgradCdfGumbel, type_ffv_43> AgradCdfGumbel_ffv_43;
+typedef std::tuple<AgradCdfGumbel, type_ffv_44> AgradCdfGumbel_ffv_44;
+typedef std::tuple<AgradCdfGumbel, type_ffv_45> AgradCdfGumbel_ffv_45;
+typedef std::tuple<AgradCdfGumbel, type_ffv_46> AgradCdfGumbel_ffv_46;
+typedef std::tuple<AgradCdfGumbel, type_ffv_47> AgradCdfGumbel_ffv_47;
+typedef std::tuple<AgradCdfGumbel, type_ffv_48> AgradCdfGumbel_ffv_48;
+typedef std::tuple<AgradCdfGumbel, type_ffv_49> AgradCdfGumbel_ffv_49;
+typedef std::tuple<AgradCdfGumbel, type_ffv_50> AgradCdfGumbel_ffv_50;
+typedef std::tuple<AgradCdfGumbel, type_ffv_51> AgradCdfGumbel_ffv_51;
+typedef std::tuple<AgradCdfGumbel, type_ffv_52> AgradCdfGumbel_ffv_52;
+typedef std::tuple<AgradCdfGumbel, type_ffv_53> AgradCdfGumbel_ffv_53;
+typedef std::tuple<AgradCdfGumbel, type_ffv_54> AgradCdfGumbel_ffv_54;
+typedef std::tuple<AgradCdfGumbel, type_ffv_55> AgradCdfGumbel_ffv_55;
+typedef std::tuple<AgradCdfGumbel, type_ffv_56> AgradCdfGumbel_ffv_56;
+typedef std::tuple<AgradCdfGumbel, type_ffv_57> AgradCdfGumbel_ffv_57;
+typedef std::tuple<AgradCdfGumbel, type_ffv_58> AgradCdfGumbel_ffv_58;
+typedef std::tuple<AgradCdfGumbel, type_ffv_59> AgradCdfGumbel_ffv_59;
+typedef std::tuple<AgradCdfGumbel, type_ffv_60> AgradCdfGumbel_ffv_60;
+typedef std::tuple<AgradCdfGumbel, type_ffv_61> AgradCdfGumbel_ffv_61;
+typedef std::tuple<AgradCdfGumbel, type_ffv_62> AgradCdfGumbel_ffv_62;
+typedef std::tuple<AgradCdfGumbel, type_ffv_63> AgradCdfGumbel_ffv_63;
+typedef std::tuple<AgradCdfGumbel, type_ffv_64> AgradCdfGumbel_ffv_64;
+typedef std::tuple<AgradCdfGumbel, type_ffv_65> AgradCdfGumbel_ffv_65;
+typedef std::tuple<AgradCdfGumbel, type_ffv_66> AgradCdfGumbel_ffv_66;
+typedef std::tuple<AgradCdfGumbel, type_ffv_67> AgradCdfGumbel_ffv_67;
+typedef std::tuple<AgradCdfGumbel, type_ffv_68> AgradCdfGumbel_ffv_68;
+typedef std::tuple<AgradCdfGumbel, type_ffv_69> AgradCdfGumbel_ffv_69;
+typedef std::tuple<AgradCdfGumbel, type_ffv_70> AgradCdfGumbel_ffv_70;
+typedef std::tuple<AgradCdfGumbel, type_ffv_71> AgradCdfGumbel_ffv_71;
+typedef std::tuple<AgradCdfGumbel, type_ffv_72> AgradCdfGumbel_ffv_72;
+typedef std::tuple<AgradCdfGumbel, type_ffv_73> AgradCdfGumbel_ffv_73;
+typedef std::tuple<AgradCdfGumbel, type_ffv_74> AgradCdfGumbel_ffv_74;
+typedef std::tuple<AgradCdfGumbel, type_ffv_75> AgradCdfGumbel_ffv_75;
+typedef std::tuple<AgradCdfGumbel, type_ffv_76> AgradCdfGumbel_ffv_76;
+typedef std::tuple<AgradCdfGumbel, type_ffv_77> AgradCdfGumbel_ffv_77;
+typedef std::tuple<AgradCdfGumbel, type_ffv_78> AgradCdfGumbel_ffv_78;
+typedef std::tuple<AgradCdfGumbel, type_ffv_79> AgradCdfGumbel_ffv_79;
+typedef std::tuple<AgradCdfGumbel, type_ffv_80> AgradCdfGumbel_ffv_80;
+typedef std::tuple<AgradCdfGumbel, type_ffv_81> AgradCdfGumbel_ffv_81;
+typedef std::tuple<AgradCdfGumbel, type_ffv_82> AgradCdfGumbel_ffv_82;
+typedef std::tuple<AgradCdfGumbel, type_ffv_83> AgradCdfGumbel_ffv_83;
+typedef std::tuple<AgradCdfGumbel, type_ffv_84> AgradCdfGumbel_ffv_84;
+typedef std::tuple<AgradCdfGumbel, type_ffv_85> AgradCdfGumbel_ffv_85;
+typedef std::tuple<AgradCdfGumbel, type_ffv_86> AgradCdfGumbel_ffv_86;
+typedef std::tuple<AgradCdfGumbel, type_ffv_87> AgradCdfGumbel_ffv_87;
+typedef std::tuple<AgradCdfGumbel, type_ffv_88> AgradCdfGumbel_ffv_88;
+typedef std::tuple<AgradCdfGumbel, type_ffv_89> AgradCdfGumbel_ffv_89;
+typedef std::tuple<AgradCdfGumbel, type_ffv_90> AgradCdfGumbel_ffv_90;
+typedef std::tuple<AgradCdfGumbel, type_ffv_91> AgradCdfGumbel_ffv_91;
+typedef std::tuple<AgradCdfGumbel, type_ffv_92> AgradCdfGumbel_ffv_92;
+typedef std::tuple<AgradCdfGumbel, type_ffv_93> AgradCdfGumbel_ffv_93;
+typedef std::tuple<AgradCdfGumbel, type_ffv_94> AgradCdfGumbel_ffv_94;
+typedef std::tuple<AgradCdfGumbel, type_ffv_95> AgradCdfGumbel_ffv_95;
+typedef std::tuple<AgradCdfGumbel, type_ffv_96> AgradCdfGumbel_ffv_96;
+typedef std::tuple<AgradCdfGumbel, type_ffv_97> AgradCdfGumbel_ffv_97;
+typedef std::tuple<AgradCdfGumbel, type_ffv_98> AgradCdfGumbel_ffv_98;
+typedef std::tuple<AgradCdfGumbel, type_ffv_99> AgradCdfGumbel_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_0, AgradCdfTestFixture, AgradCdfGumbel_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_1, AgradCdfTestFixture, AgradCdfGumbel_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_2, AgradCdfTestFixture, AgradCdfGumbel_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_3, AgradCdfTestFixture, AgradCdfGumbel_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_4, AgradCdfTestFixture, AgradCdfGumbel_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_5, AgradCdfTestFixture, AgradCdfGumbel_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_6, AgradCdfTestFixture, AgradCdfGumbel_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_7, AgradCdfTestFixture, AgradCdfGumbel_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_8, AgradCdfTestFixture, AgradCdfGumbel_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_9, AgradCdfTestFixture, AgradCdfGumbel_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_10, AgradCdfTestFixture, AgradCdfGumbel_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_11, AgradCdfTestFixture, AgradCdfGumbel_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_12, AgradCdfTestFixture, AgradCdfGumbel_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_13, AgradCdfTestFixture, AgradCdfGumbel_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_14, AgradCdfTestFixture, AgradCdfGumbel_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_15, AgradCdfTestFixture, AgradCdfGumbel_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_16, AgradCdfTestFixture, AgradCdfGumbel_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_17, AgradCdfTestFixture, AgradCdfGumbel_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_18, AgradCdfTestFixture, AgradCdfGumbel_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_19, AgradCdfTestFixture, AgradCdfGumbel_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_20, AgradCdfTestFixture, AgradCdfGumbel_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_21, AgradCdfTestFixture, AgradCdfGumbel_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_22, AgradCdfTestFixture, AgradCdfGumbel_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_23, AgradCdfTestFixture, AgradCdfGumbel_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_24, AgradCdfTestFixture, AgradCdfGumbel_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_25, AgradCdfTestFixture, AgradCdfGumbel_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_26, AgradCdfTestFixture, AgradCdfGumbel_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_27, AgradCdfTestFixture, AgradCdfGumbel_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_28, AgradCdfTestFixture, AgradCdfGumbel_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_29, AgradCdfTestFixture, AgradCdfGumbel_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_30, AgradCdfTestFixture, AgradCdfGumbel_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_31, AgradCdfTestFixture, AgradCdfGumbel_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_32, AgradCdfTestFixture, AgradCdfGumbel_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_33, AgradCdfTestFixture, AgradCdfGumbel_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_34, AgradCdfTestFixture, AgradCdfGumbel_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_35, AgradCdfTestFixture, AgradCdfGumbel_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_36, AgradCdfTestFixture, AgradCdfGumbel_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_37, AgradCdfTestFixture, AgradCdfGumbel_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_38, AgradCdfTestFixture, AgradCdfGumbel_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_39, AgradCdfTestFixture, AgradCdfGumbel_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_40, AgradCdfTestFixture, AgradCdfGumbel_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_41, AgradCdfTestFixture, AgradCdfGumbel_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_42, AgradCdfTestFixture, AgradCdfGumbel_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_43, AgradCdfTestFixture, AgradCdfGumbel_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_44, AgradCdfTestFixture, AgradCdfGumbel_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_45, AgradCdfTestFixture, AgradCdfGumbel_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_46, AgradCdfTestFixture, AgradCdfGumbel_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_47, AgradCdfTestFixture, AgradCdfGumbel_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_48, AgradCdfTestFixture, AgradCdfGumbel_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_49, AgradCdfTestFixture, AgradCdfGumbel_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_50, AgradCdfTestFixture, AgradCdfGumbel_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_51, AgradCdfTestFixture, AgradCdfGumbel_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_52, AgradCdfTestFixture, AgradCdfGumbel_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_53, AgradCdfTestFixture, AgradCdfGumbel_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_54, AgradCdfTestFixture, AgradCdfGumbel_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_55, AgradCdfTestFixture, AgradCdfGumbel_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_56, AgradCdfTestFixture, AgradCdfGumbel_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_57, AgradCdfTestFixture, AgradCdfGumbel_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_58, AgradCdfTestFixture, AgradCdfGumbel_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_59, AgradCdfTestFixture, AgradCdfGumbel_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_60, AgradCdfTestFixture, AgradCdfGumbel_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_61, AgradCdfTestFixture, AgradCdfGumbel_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_62, AgradCdfTestFixture, AgradCdfGumbel_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_63, AgradCdfTestFixture, AgradCdfGumbel_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_64, AgradCdfTestFixture, AgradCdfGumbel_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_65, AgradCdfTestFixture, AgradCdfGumbel_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_66, AgradCdfTestFixture, AgradCdfGumbel_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_67, AgradCdfTestFixture, AgradCdfGumbel_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_68, AgradCdfTestFixture, AgradCdfGumbel_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_69, AgradCdfTestFixture, AgradCdfGumbel_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_70, AgradCdfTestFixture, AgradCdfGumbel_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_71, AgradCdfTestFixture, AgradCdfGumbel_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_72, AgradCdfTestFixture, AgradCdfGumbel_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_73, AgradCdfTestFixture, AgradCdfGumbel_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_74, AgradCdfTestFixture, AgradCdfGumbel_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_75, AgradCdfTestFixture, AgradCdfGumbel_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_76, AgradCdfTestFixture, AgradCdfGumbel_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_77, AgradCdfTestFixture, AgradCdfGumbel_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_78, AgradCdfTestFixture, AgradCdfGumbel_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_79, AgradCdfTestFixture, AgradCdfGumbel_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_80, AgradCdfTestFixture, AgradCdfGumbel_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_81, AgradCdfTestFixture, AgradCdfGumbel_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_82, AgradCdfTestFixture, AgradCdfGumbel_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_83, AgradCdfTestFixture, AgradCdfGumbel_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_84, AgradCdfTestFixture, AgradCdfGumbel_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_85, AgradCdfTestFixture, AgradCdfGumbel_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_86, AgradCdfTestFixture, AgradCdfGumbel_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_87, AgradCdfTestFixture, AgradCdfGumbel_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_88, AgradCdfTestFixture, AgradCdfGumbel_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_89, AgradCdfTestFixture, AgradCdfGumbel_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_90, AgradCdfTestFixture, AgradCdfGumbel_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_91, AgradCdfTestFixture, AgradCdfGumbel_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_92, AgradCdfTestFixture, AgradCdfGumbel_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_93, AgradCdfTestFixture, AgradCdfGumbel_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_94, AgradCdfTestFixture, AgradCdfGumbel_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_95, AgradCdfTestFixture, AgradCdfGumbel_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_96, AgradCdfTestFixture, AgradCdfGumbel_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_97, AgradCdfTestFixture, AgradCdfGumbel_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_98, AgradCdfTestFixture, AgradCdfGumbel_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_99, AgradCdfTestFixture, AgradCdfGumbel_ffv_99);
+
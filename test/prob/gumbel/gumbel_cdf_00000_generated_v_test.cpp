@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfGumbel, type_v_0> AgradCdfGumbel_v_0;
+typedef std::tuple<AgradCdfGumbel, type_v_1> AgradCdfGumbel_v_1;
+typedef std::tuple<AgradCdfGumbel, type_v_2> AgradCdfGumbel_v_2;
+typedef std::tuple<AgradCdfGumbel, type_v_3> AgradCdfGumbel_v_3;
+typedef std::tuple<AgradCdfGumbel, type_v_4> AgradCdfGumbel_v_4;
+typedef std::tuple<AgradCdfGumbel, type_v_5> AgradCdfGumbel_v_5;
+typedef std::tuple<AgradCdfGumbel, type_v_6> AgradCdfGumbel_v_6;
+typedef std::tuple<AgradCdfGumbel, type_v_7> AgradCdfGumbel_v_7;
+typedef std::tuple<AgradCdfGumbel, type_v_8> AgradCdfGumbel_v_8;
+typedef std::tuple<AgradCdfGumbel, type_v_9> AgradCdfGumbel_v_9;
+typedef std::tuple<AgradCdfGumbel, type_v_10> AgradCdfGumbel_v_10;
+typedef std::tuple<AgradCdfGumbel, type_v_11> AgradCdfGumbel_v_11;
+typedef std::tuple<AgradCdfGumbel, type_v_12> AgradCdfGumbel_v_12;
+typedef std::tuple<AgradCdfGumbel, type_v_13> AgradCdfGumbel_v_13;
+typedef std::tuple<AgradCdfGumbel, type_v_14> AgradCdfGumbel_v_14;
+typedef std::tuple<AgradCdfGumbel, type_v_15> AgradCdfGumbel_v_15;
+typedef std::tuple<AgradCdfGumbel, type_v_16> AgradCdfGumbel_v_16;
+typedef std::tuple<AgradCdfGumbel, type_v_17> AgradCdfGumbel_v_17;
+typedef std::tuple<AgradCdfGumbel, type_v_18> AgradCdfGumbel_v_18;
+typedef std::tuple<AgradCdfGumbel, type_v_19> AgradCdfGumbel_v_19;
+typedef std::tuple<AgradCdfGumbel, type_v_20> AgradCdfGumbel_v_20;
+typedef std::tuple<AgradCdfGumbel, type_v_21> AgradCdfGumbel_v_21;
+typedef std::tuple<AgradCdfGumbel, type_v_22> AgradCdfGumbel_v_22;
+typedef std::tuple<AgradCdfGumbel, type_v_23> AgradCdfGumbel_v_23;
+typedef std::tuple<AgradCdfGumbel, type_v_24> AgradCdfGumbel_v_24;
+typedef std::tuple<AgradCdfGumbel, type_v_25> AgradCdfGumbel_v_25;
+typedef std::tuple<AgradCdfGumbel, type_v_26> AgradCdfGumbel_v_26;
+typedef std::tuple<AgradCdfGumbel, type_v_27> AgradCdfGumbel_v_27;
+typedef std::tuple<AgradCdfGumbel, type_v_28> AgradCdfGumbel_v_28;
+typedef std::tuple<AgradCdfGumbel, type_v_29> AgradCdfGumbel_v_29;
+typedef std::tuple<AgradCdfGumbel, type_v_30> AgradCdfGumbel_v_30;
+typedef std::tuple<AgradCdfGumbel, type_v_31> AgradCdfGumbel_v_31;
+typedef std::tuple<AgradCdfGumbel, type_v_32> AgradCdfGumbel_v_32;
+typedef std::tuple<AgradCdfGumbel, type_v_33> AgradCdfGumbel_v_33;
+typedef std::tuple<AgradCdfGumbel, type_v_34> AgradCdfGumbel_v_34;
+typedef std::tuple<AgradCdfGumbel, type_v_35> AgradCdfGumbel_v_35;
+typedef std::tuple<AgradCdfGumbel, type_v_36> AgradCdfGumbel_v_36;
+typedef std::tuple<AgradCdfGumbel, type_v_37> AgradCdfGumbel_v_37;
+typedef std::tuple<AgradCdfGumbel, type_v_38> AgradCdfGumbel_v_38;
+typedef std::tuple<AgradCdfGumbel, type_v_39> AgradCdfGumbel_v_39;
+typedef std::tuple<AgradCdfGumbel, type_v_40> AgradCdfGumbel_v_40;
+typedef std::tuple<AgradCdfGumbel, type_v_41> AgradCdfGumbel_v_41;
+typedef std::tuple<AgradCdfGumbel, type_v_42> AgradCdfGumbel_v_42;
+typedef std::tuple<AgradCdfGumbel, type_v_43> AgradCdfGumbel_v_43;
+typedef std::tuple<AgradCdfGumbel, type_v_44> AgradCdfGumbel_v_44;
+typedef std::tuple<AgradCdfGumbel, type_v_45> AgradCdfGumbel_v_45;
+typedef std::tuple<AgradCdfGumbel, type_v_46> AgradCdfGumbel_v_46;
+typedef std::tuple<AgradCdfGumbel, type_v_47> AgradCdfGumbel_v_47;
+typedef std::tuple<AgradCdfGumbel, type_v_48> AgradCdfGumbel_v_48;
+typedef std::tuple<AgradCdfGumbel, type_v_49> AgradCdfGumbel_v_49;
+typedef std::tuple<AgradCdfGumbel, type_v_50> AgradCdfGumbel_v_50;
+typedef std::tuple<AgradCdfGumbel, type_v_51> AgradCdfGumbel_v_51;
+typedef std::tuple<AgradCdfGumbel, type_v_52> AgradCdfGumbel_v_52;
+typedef std::tuple<AgradCdfGumbel, type_v_53> AgradCdfGumbel_v_53;
+typedef std::tuple<AgradCdfGumbel, type_v_54> AgradCdfGumbel_v_54;
+typedef std::tuple<AgradCdfGumbel, type_v_55> AgradCdfGumbel_v_55;
+typedef std::tuple<AgradCdfGumbel, type_v_56> AgradCdfGumbel_v_56;
+typedef std::tuple<AgradCdfGumbel, type_v_57> AgradCdfGumbel_v_57;
+typedef std::tuple<AgradCdfGumbel, type_v_58> AgradCdfGumbel_v_58;
+typedef std::tuple<AgradCdfGumbel, type_v_59> AgradCdfGumbel_v_59;
+typedef std::tuple<AgradCdfGumbel, type_v_60> AgradCdfGumbel_v_60;
+typedef std::tuple<AgradCdfGumbel, type_v_61> AgradCdfGumbel_v_61;
+typedef std::tuple<AgradCdfGumbel, type_v_62> AgradCdfGumbel_v_62;
+typedef std::tuple<AgradCdfGumbel, type_v_63> AgradCdfGumbel_v_63;
+typedef std::tuple<AgradCdfGumbel, type_v_64> AgradCdfGumbel_v_64;
+typedef std::tuple<AgradCdfGumbel, type_v_65> AgradCdfGumbel_v_65;
+typedef std::tuple<AgradCdfGumbel, type_v_66> AgradCdfGumbel_v_66;
+typedef std::tuple<AgradCdfGumbel, type_v_67> AgradCdfGumbel_v_67;
+typedef std::tuple<AgradCdfGumbel, type_v_68> AgradCdfGumbel_v_68;
+typedef std::tuple<AgradCdfGumbel, type_v_69> AgradCdfGumbel_v_69;
+typedef std::tuple<AgradCdfGumbel, type_v_70> AgradCdfGumbel_v_70;
+typedef std::tuple<AgradCdfGumbel, type_v_71> AgradCdfGumbel_v_71;
+typedef std::tuple<AgradCdfGumbel, type_v_72> AgradCdfGumbel_v_72;
+typedef std::tuple<AgradCdfGumbel, type_v_73> AgradCdfGumbel_v_73;
+typedef std::tuple<AgradCdfGumbel, type_v_74> AgradCdfGumbel_v_74;
+typedef std::tuple<AgradCdfGumbel, type_v_75> AgradCdfGumbel_v_75;
+typedef std::tuple<AgradCdfGumbel, type_v_76> AgradCdfGumbel_v_76;
+typedef std::tuple<AgradCdfGumbel, type_v_77> AgradCdfGumbel_v_77;
+typedef std::tuple<AgradCdfGumbel, type_v_78> AgradCdfGumbel_v_78;
+typedef std::tuple<AgradCdfGumbel, type_v_79> AgradCdfGumbel_v_79;
+typedef std::tuple<AgradCdfGumbel, type_v_80> AgradCdfGumbel_v_80;
+typedef std::tuple<AgradCdfGumbel, type_v_81> AgradCdfGumbel_v_81;
+typedef std::tuple<AgradCdfGumbel, type_v_82> AgradCdfGumbel_v_82;
+typedef std::tuple<AgradCdfGumbel, type_v_83> AgradCdfGumbel_v_83;
+typedef std::tuple<AgradCdfGumbel, type_v_84> AgradCdfGumbel_v_84;
+typedef std::tuple<AgradCdfGumbel, type_v_85> AgradCdfGumbel_v_85;
+typedef std::tuple<AgradCdfGumbel, type_v_86> AgradCdfGumbel_v_86;
+typedef std::tuple<AgradCdfGumbel, type_v_87> AgradCdfGumbel_v_87;
+typedef std::tuple<AgradCdfGumbel, type_v_88> AgradCdfGumbel_v_88;
+typedef std::tuple<AgradCdfGumbel, type_v_89> AgradCdfGumbel_v_89;
+typedef std::tuple<AgradCdfGumbel, type_v_90> AgradCdfGumbel_v_90;
+typedef std::tuple<AgradCdfGumbel, type_v_91> AgradCdfGumbel_v_91;
+typedef std::tuple<AgradCdfGumbel, type_v_92> AgradCdfGumbel_v_92;
+typedef std::tuple<AgradCdfGumbel, type_v_93> AgradCdfGumbel_v_93;
+typedef std::tuple<AgradCdfGumbel, type_v_94> AgradCdfGumbel_v_94;
+typedef std::tuple<AgradCdfGumbel, type_v_95> AgradCdfGumbel_v_95;
+typedef std::tuple<AgradCdfGumbel, type_v_96> AgradCdfGumbel_v_96;
+typedef std::tuple<AgradCdfGumbel, type_v_97> AgradCdfGumbel_v_97;
+typedef std::tuple<AgradCdfGumbel, type_v_98> AgradCdfGumbel_v_98;
+typedef std::tuple<AgradCdfGumbel, type_v_99> AgradCdfGumbel_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_0, AgradCdfTestFixture, AgradCdfGumbel_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_1, AgradCdfTestFixture, AgradCdfGumbel_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_2, AgradCdfTestFixture, AgradCdfGumbel_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_3, AgradCdfTestFixture, AgradCdfGumbel_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_4, AgradCdfTestFixture, AgradCdfGumbel_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_5, AgradCdfTestFixture, AgradCdfGumbel_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_6, AgradCdfTestFixture, AgradCdfGumbel_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_7, AgradCdfTestFixture, AgradCdfGumbel_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_8, AgradCdfTestFixture, AgradCdfGumbel_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_9, AgradCdfTestFixture, AgradCdfGumbel_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_10, AgradCdfTestFixture, AgradCdfGumbel_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_11, AgradCdfTestFixture, AgradCdfGumbel_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_12, AgradCdfTestFixture, AgradCdfGumbel_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_13, AgradCdfTestFixture, AgradCdfGumbel_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_14, AgradCdfTestFixture, AgradCdfGumbel_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_15, AgradCdfTestFixture, AgradCdfGumbel_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_16, AgradCdfTestFixture, AgradCdfGumbel_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_17, AgradCdfTestFixture, AgradCdfGumbel_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_18, AgradCdfTestFixture, AgradCdfGumbel_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_19, AgradCdfTestFixture, AgradCdfGumbel_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_20, AgradCdfTestFixture, AgradCdfGumbel_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_21, AgradCdfTestFixture, AgradCdfGumbel_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_22, AgradCdfTestFixture, AgradCdfGumbel_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_23, AgradCdfTestFixture, AgradCdfGumbel_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_24, AgradCdfTestFixture, AgradCdfGumbel_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_25, AgradCdfTestFixture, AgradCdfGumbel_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_26, AgradCdfTestFixture, AgradCdfGumbel_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_27, AgradCdfTestFixture, AgradCdfGumbel_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_28, AgradCdfTestFixture, AgradCdfGumbel_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_29, AgradCdfTestFixture, AgradCdfGumbel_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_30, AgradCdfTestFixture, AgradCdfGumbel_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_31, AgradCdfTestFixture, AgradCdfGumbel_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_32, AgradCdfTestFixture, AgradCdfGumbel_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_33, AgradCdfTestFixture, AgradCdfGumbel_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_34, AgradCdfTestFixture, AgradCdfGumbel_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_35, AgradCdfTestFixture, AgradCdfGumbel_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_36, AgradCdfTestFixture, AgradCdfGumbel_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_37, AgradCdfTestFixture, AgradCdfGumbel_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_38, AgradCdfTestFixture, AgradCdfGumbel_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_39, AgradCdfTestFixture, AgradCdfGumbel_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_40, AgradCdfTestFixture, AgradCdfGumbel_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_41, AgradCdfTestFixture, AgradCdfGumbel_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_42, AgradCdfTestFixture, AgradCdfGumbel_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_43, AgradCdfTestFixture, AgradCdfGumbel_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_44, AgradCdfTestFixture, AgradCdfGumbel_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_45, AgradCdfTestFixture, AgradCdfGumbel_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_46, AgradCdfTestFixture, AgradCdfGumbel_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_47, AgradCdfTestFixture, AgradCdfGumbel_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_48, AgradCdfTestFixture, AgradCdfGumbel_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_49, AgradCdfTestFixture, AgradCdfGumbel_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_50, AgradCdfTestFixture, AgradCdfGumbel_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_51, AgradCdfTestFixture, AgradCdfGumbel_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_52, AgradCdfTestFixture, AgradCdfGumbel_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_53, AgradCdfTestFixture, AgradCdfGumbel_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_54, AgradCdfTestFixture, AgradCdfGumbel_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_55, AgradCdfTestFixture, AgradCdfGumbel_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_56, AgradCdfTestFixture, AgradCdfGumbel_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_57, AgradCdfTestFixture, AgradCdfGumbel_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_58, AgradCdfTestFixture, AgradCdfGumbel_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_59, AgradCdfTestFixture, AgradCdfGumbel_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_60, AgradCdfTestFixture, AgradCdfGumbel_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_61, AgradCdfTestFixture, AgradCdfGumbel_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_62, AgradCdfTestFixture, AgradCdfGumbel_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_63, AgradCdfTestFixture, AgradCdfGumbel_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_64, AgradCdfTestFixture, AgradCdfGumbel_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_65, AgradCdfTestFixture, AgradCdfGumbel_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_66, AgradCdfTestFixture, AgradCdfGumbel_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_67, AgradCdfTestFixture, AgradCdfGumbel_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_68, AgradCdfTestFixture, AgradCdfGumbel_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_69, AgradCdfTestFixture, AgradCdfGumbel_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_70, AgradCdfTestFixture, AgradCdfGumbel_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_71, AgradCdfTestFixture, AgradCdfGumbel_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_72, AgradCdfTestFixture, AgradCdfGumbel_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_73, AgradCdfTestFixture, AgradCdfGumbel_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_74, AgradCdfTestFixture, AgradCdfGumbel_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_75, AgradCdfTestFixture, AgradCdfGumbel_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_76, AgradCdfTestFixture, AgradCdfGumbel_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_77, AgradCdfTestFixture, AgradCdfGumbel_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_78, AgradCdfTestFixture, AgradCdfGumbel_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_79, AgradCdfTestFixture, AgradCdfGumbel_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_80, AgradCdfTestFixture, AgradCdfGumbel_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_81, AgradCdfTestFixture, AgradCdfGumbel_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_82, AgradCdfTestFixture, AgradCdfGumbel_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_83, AgradCdfTestFixture, AgradCdfGumbel_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_84, AgradCdfTestFixture, AgradCdfGumbel_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_85, AgradCdfTestFixture, AgradCdfGumbel_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_86, AgradCdfTestFixture, AgradCdfGumbel_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_87, AgradCdfTestFixture, AgradCdfGumbel_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_88, AgradCdfTestFixture, AgradCdfGumbel_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_89, AgradCdfTestFixture, AgradCdfGumbel_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_90, AgradCdfTestFixture, AgradCdfGumbel_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_91, AgradCdfTestFixture, AgradCdfGumbel_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_92, AgradCdfTestFixture, AgradCdfGumbel_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_93, AgradCdfTestFixture, AgradCdfGumbel_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_94, AgradCdfTestFixture, AgradCdfGumbel_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_95, AgradCdfTestFixture, AgradCdfGumbel_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_96, AgradCdfTestFixture, AgradCdfGumbel_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_97, AgradCdfTestFixture, AgradCdfGumbel_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_98, AgradCdfTestFixture, AgradCdfGumbel_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_99, AgradCdfTestFixture, AgradCdfGumbel_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_cdf_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfGumbel, type_vv_0> AgradCdfGumbel_vv_0;
+typedef std::tuple<AgradCdfGumbel, type_vv_1> AgradCdfGumbel_vv_1;
+typedef std::tuple<AgradCdfGumbel, type_vv_2> AgradCdfGumbel_vv_2;
+typedef std::tuple<AgradCdfGumbel, type_vv_3> AgradCdfGumbel_vv_3;
+typedef std::tuple<AgradCdfGumbel, type_vv_4> AgradCdfGumbel_vv_4;
+typedef std::tuple<AgradCdfGumbel, type_vv_5> AgradCdfGumbel_vv_5;
+typedef std::tuple<AgradCdfGumbel, type_vv_6> AgradCdfGumbel_vv_6;
+typedef std::tuple<AgradCdfGumbel, type_vv_7> AgradCdfGumbel_vv_7;
+typedef std::tuple<AgradCdfGumbel, type_vv_8> AgradCdfGumbel_vv_8;
+typedef std::tuple<AgradCdfGumbel, type_vv_9> AgradCdfGumbel_vv_9;
+typedef std::tuple<AgradCdfGumbel, type_vv_10> AgradCdfGumbel_vv_10;
+typedef std::tuple<AgradCdfGumbel, type_vv_11> AgradCdfGumbel_vv_11;
+typedef std::tuple<AgradCdfGumbel, type_vv_12> AgradCdfGumbel_vv_12;
+typedef std::tuple<AgradCdfGumbel, type_vv_13> AgradCdfGumbel_vv_13;
+typedef std::tuple<AgradCdfGumbel, type_vv_14> AgradCdfGumbel_vv_14;
+typedef std::tuple<AgradCdfGumbel, type_vv_15> AgradCdfGumbel_vv_15;
+typedef std::tuple<AgradCdfGumbel, type_vv_16> AgradCdfGumbel_vv_16;
+typedef std::tuple<AgradCdfGumbel, type_vv_17> AgradCdfGumbel_vv_17;
+typedef std::tuple<AgradCdfGumbel, type_vv_18> AgradCdfGumbel_vv_18;
+typedef std::tuple<AgradCdfGumbel, type_vv_19> AgradCdfGumbel_vv_19;
+typedef std::tuple<AgradCdfGumbel, type_vv_20> AgradCdfGumbel_vv_20;
+typedef std::tuple<AgradCdfGumbel, type_vv_21> AgradCdfGumbel_vv_21;
+typedef std::tuple<AgradCdfGumbel, type_vv_22> AgradCdfGumbel_vv_22;
+typedef std::tuple<AgradCdfGumbel, type_vv_23> AgradCdfGumbel_vv_23;
+typedef std::tuple<AgradCdfGumbel, type_vv_24> AgradCdfGumbel_vv_24;
+typedef std::tuple<AgradCdfGumbel, type_vv_25> AgradCdfGumbel_vv_25;
+typedef std::tuple<AgradCdfGumbel, type_vv_26> AgradCdfGumbel_vv_26;
+typedef std::tuple<AgradCdfGumbel, type_vv_27> AgradCdfGumbel_vv_27;
+typedef std::tuple<AgradCdfGumbel, type_vv_28> AgradCdfGumbel_vv_28;
+typedef std::tuple<AgradCdfGumbel, type_vv_29> AgradCdfGumbel_vv_29;
+typedef std::tuple<AgradCdfGumbel, type_vv_30> AgradCdfGumbel_vv_30;
+typedef std::tuple<AgradCdfGumbel, type_vv_31> AgradCdfGumbel_vv_31;
+typedef std::tuple<AgradCdfGumbel, type_vv_32> AgradCdfGumbel_vv_32;
+typedef std::tuple<AgradCdfGumbel, type_vv_33> AgradCdfGumbel_vv_33;
+typedef std::tuple<AgradCdfGumbel, type_vv_34> AgradCdfGumbel_vv_34;
+typedef std::tuple<AgradCdfGumbel, type_vv_35> AgradCdfGumbel_vv_35;
+typedef std::tuple<AgradCdfGumbel, type_vv_36> AgradCdfGumbel_vv_36;
+typedef std::tuple<AgradCdfGumbel, type_vv_37> AgradCdfGumbel_vv_37;
+typedef std::tuple<AgradCdfGumbel, type_vv_38> AgradCdfGumbel_vv_38;
+typedef std::tuple<AgradCdfGumbel, type_vv_39> AgradCdfGumbel_vv_39;
+typedef std::tuple<AgradCdfGumbel, type_vv_40> AgradCdfGumbel_vv_40;
+typedef std::tuple<AgradCdfGumbel, type_vv_41> AgradCdfGumbel_vv_41;
+typedef std::tuple<AgradCdfGumbel, type_vv_42> AgradCdfGumbel_vv_42;
+typedef std::tuple<AgradCdfGumbel, type_vv_43> AgradCdfGumbel_vv_43;
+typedef std::tuple<AgradCdfGumbel, type_vv_44> AgradCdfGumbel_vv_44;
+typedef std::tuple<AgradCdfGumbel, type_vv_45> AgradCdfGumbel_vv_45;
+typedef std::tuple<AgradCdfGumbel, type_vv_46> AgradCdfGumbel_vv_46;
+typedef std::tuple<AgradCdfGumbel, type_vv_47> AgradCdfGumbel_vv_47;
+typedef std::tuple<AgradCdfGumbel, type_vv_48> AgradCdfGumbel_vv_48;
+typedef std::tuple<AgradCdfGumbel, type_vv_49> AgradCdfGumbel_vv_49;
+typedef std::tuple<AgradCdfGumbel, type_vv_50> AgradCdfGumbel_vv_50;
+typedef std::tuple<AgradCdfGumbel, type_vv_51> AgradCdfGumbel_vv_51;
+typedef std::tuple<AgradCdfGumbel, type_vv_52> AgradCdfGumbel_vv_52;
+typedef std::tuple<AgradCdfGumbel, type_vv_53> AgradCdfGumbel_vv_53;
+typedef std::tuple<AgradCdfGumbel, type_vv_54> AgradCdfGumbel_vv_54;
+typedef std::tuple<AgradCdfGumbel, type_vv_55> AgradCdfGumbel_vv_55;
+typedef std::tuple<AgradCdfGumbel, type_vv_56> AgradCdfGumbel_vv_56;
+typedef std::tuple<AgradCdfGumbel, type_vv_57> AgradCdfGumbel_vv_57;
+typedef std::tuple<AgradCdfGumbel, type_vv_58> AgradCdfGumbel_vv_58;
+typedef std::tuple<AgradCdfGumbel, type_vv_59> AgradCdfGumbel_vv_59;
+typedef std::tuple<AgradCdfGumbel, type_vv_60> AgradCdfGumbel_vv_60;
+typedef std::tuple<AgradCdfGumbel, type_vv_61> AgradCdfGumbel_vv_61;
+typedef std::tuple<AgradCdfGumbel, type_vv_62> AgradCdfGumbel_vv_62;
+typedef std::tuple<AgradCdfGumbel, type_vv_63> AgradCdfGumbel_vv_63;
+typedef std::tuple<AgradCdfGumbel, type_vv_64> AgradCdfGumbel_vv_64;
+typedef std::tuple<AgradCdfGumbel, type_vv_65> AgradCdfGumbel_vv_65;
+typedef std::tuple<AgradCdfGumbel, type_vv_66> AgradCdfGumbel_vv_66;
+typedef std::tuple<AgradCdfGumbel, type_vv_67> AgradCdfGumbel_vv_67;
+typedef std::tuple<AgradCdfGumbel, type_vv_68> AgradCdfGumbel_vv_68;
+typedef std::tuple<AgradCdfGumbel, type_vv_69> AgradCdfGumbel_vv_69;
+typedef std::tuple<AgradCdfGumbel, type_vv_70> AgradCdfGumbel_vv_70;
+typedef std::tuple<AgradCdfGumbel, type_vv_71> AgradCdfGumbel_vv_71;
+typedef std::tuple<AgradCdfGumbel, type_vv_72> AgradCdfGumbel_vv_72;
+typedef std::tuple<AgradCdfGumbel, type_vv_73> AgradCdfGumbel_vv_73;
+typedef std::tuple<AgradCdfGumbel, type_vv_74> AgradCdfGumbel_vv_74;
+typedef std::tuple<AgradCdfGumbel, type_vv_75> AgradCdfGumbel_vv_75;
+typedef std::tuple<AgradCdfGumbel, type_vv_76> AgradCdfGumbel_vv_76;
+typedef std::tuple<AgradCdfGumbel, type_vv_77> AgradCdfGumbel_vv_77;
+typedef std::tuple<AgradCdfGumbel, type_vv_78> AgradCdfGumbel_vv_78;
+typedef std::tuple<AgradCdfGumbel, type_vv_79> AgradCdfGumbel_vv_79;
+typedef std::tuple<AgradCdfGumbel, type_vv_80> AgradCdfGumbel_vv_80;
+typedef std::tuple<AgradCdfGumbel, type_vv_81> AgradCdfGumbel_vv_81;
+typedef std::tuple<AgradCdfGumbel, type_vv_82> AgradCdfGumbel_vv_82;
+typedef std::tuple<AgradCdfGumbel, type_vv_83> AgradCdfGumbel_vv_83;
+typedef std::tuple<AgradCdfGumbel, type_vv_84> AgradCdfGumbel_vv_84;
+typedef std::tuple<AgradCdfGumbel, type_vv_85> AgradCdfGumbel_vv_85;
+typedef std::tuple<AgradCdfGumbel, type_vv_86> AgradCdfGumbel_vv_86;
+typedef std::tuple<AgradCdfGumbel, type_vv_87> AgradCdfGumbel_vv_87;
+typedef std::tuple<AgradCdfGumbel, type_vv_88> AgradCdfGumbel_vv_88;
+typedef std::tuple<AgradCdfGumbel, type_vv_89> AgradCdfGumbel_vv_89;
+typedef std::tuple<AgradCdfGumbel, type_vv_90> AgradCdfGumbel_vv_90;
+typedef std::tuple<AgradCdfGumbel, type_vv_91> AgradCdfGumbel_vv_91;
+typedef std::tuple<AgradCdfGumbel, type_vv_92> AgradCdfGumbel_vv_92;
+typedef std::tuple<AgradCdfGumbel, type_vv_93> AgradCdfGumbel_vv_93;
+typedef std::tuple<AgradCdfGumbel, type_vv_94> AgradCdfGumbel_vv_94;
+typedef std::tuple<AgradCdfGumbel, type_vv_95> AgradCdfGumbel_vv_95;
+typedef std::tuple<AgradCdfGumbel, type_vv_96> AgradCdfGumbel_vv_96;
+typedef std::tuple<AgradCdfGumbel, type_vv_97> AgradCdfGumbel_vv_97;
+typedef std::tuple<AgradCdfGumbel, type_vv_98> AgradCdfGumbel_vv_98;
+typedef std::tuple<AgradCdfGumbel, type_vv_99> AgradCdfGumbel_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_0, AgradCdfTestFixture, AgradCdfGumbel_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_1, AgradCdfTestFixture, AgradCdfGumbel_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_2, AgradCdfTestFixture, AgradCdfGumbel_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_3, AgradCdfTestFixture, AgradCdfGumbel_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_4, AgradCdfTestFixture, AgradCdfGumbel_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_5, AgradCdfTestFixture, AgradCdfGumbel_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_6, AgradCdfTestFixture, AgradCdfGumbel_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_7, AgradCdfTestFixture, AgradCdfGumbel_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_8, AgradCdfTestFixture, AgradCdfGumbel_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_9, AgradCdfTestFixture, AgradCdfGumbel_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_10, AgradCdfTestFixture, AgradCdfGumbel_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_11, AgradCdfTestFixture, AgradCdfGumbel_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_12, AgradCdfTestFixture, AgradCdfGumbel_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_13, AgradCdfTestFixture, AgradCdfGumbel_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_14, AgradCdfTestFixture, AgradCdfGumbel_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_15, AgradCdfTestFixture, AgradCdfGumbel_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_16, AgradCdfTestFixture, AgradCdfGumbel_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_17, AgradCdfTestFixture, AgradCdfGumbel_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_18, AgradCdfTestFixture, AgradCdfGumbel_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_19, AgradCdfTestFixture, AgradCdfGumbel_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_20, AgradCdfTestFixture, AgradCdfGumbel_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_21, AgradCdfTestFixture, AgradCdfGumbel_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_22, AgradCdfTestFixture, AgradCdfGumbel_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_23, AgradCdfTestFixture, AgradCdfGumbel_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_24, AgradCdfTestFixture, AgradCdfGumbel_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_25, AgradCdfTestFixture, AgradCdfGumbel_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_26, AgradCdfTestFixture, AgradCdfGumbel_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_27, AgradCdfTestFixture, AgradCdfGumbel_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_28, AgradCdfTestFixture, AgradCdfGumbel_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_29, AgradCdfTestFixture, AgradCdfGumbel_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_30, AgradCdfTestFixture, AgradCdfGumbel_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_31, AgradCdfTestFixture, AgradCdfGumbel_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_32, AgradCdfTestFixture, AgradCdfGumbel_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_33, AgradCdfTestFixture, AgradCdfGumbel_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_34, AgradCdfTestFixture, AgradCdfGumbel_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_35, AgradCdfTestFixture, AgradCdfGumbel_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_36, AgradCdfTestFixture, AgradCdfGumbel_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_37, AgradCdfTestFixture, AgradCdfGumbel_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_38, AgradCdfTestFixture, AgradCdfGumbel_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_39, AgradCdfTestFixture, AgradCdfGumbel_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_40, AgradCdfTestFixture, AgradCdfGumbel_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_41, AgradCdfTestFixture, AgradCdfGumbel_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_42, AgradCdfTestFixture, AgradCdfGumbel_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_43, AgradCdfTestFixture, AgradCdfGumbel_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_44, AgradCdfTestFixture, AgradCdfGumbel_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_45, AgradCdfTestFixture, AgradCdfGumbel_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_46, AgradCdfTestFixture, AgradCdfGumbel_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_47, AgradCdfTestFixture, AgradCdfGumbel_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_48, AgradCdfTestFixture, AgradCdfGumbel_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_49, AgradCdfTestFixture, AgradCdfGumbel_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_50, AgradCdfTestFixture, AgradCdfGumbel_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_51, AgradCdfTestFixture, AgradCdfGumbel_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_52, AgradCdfTestFixture, AgradCdfGumbel_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_53, AgradCdfTestFixture, AgradCdfGumbel_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_54, AgradCdfTestFixture, AgradCdfGumbel_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_55, AgradCdfTestFixture, AgradCdfGumbel_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_56, AgradCdfTestFixture, AgradCdfGumbel_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_57, AgradCdfTestFixture, AgradCdfGumbel_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_58, AgradCdfTestFixture, AgradCdfGumbel_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_59, AgradCdfTestFixture, AgradCdfGumbel_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_60, AgradCdfTestFixture, AgradCdfGumbel_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_61, AgradCdfTestFixture, AgradCdfGumbel_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_62, AgradCdfTestFixture, AgradCdfGumbel_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_63, AgradCdfTestFixture, AgradCdfGumbel_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_64, AgradCdfTestFixture, AgradCdfGumbel_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_65, AgradCdfTestFixture, AgradCdfGumbel_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_66, AgradCdfTestFixture, AgradCdfGumbel_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_67, AgradCdfTestFixture, AgradCdfGumbel_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_68, AgradCdfTestFixture, AgradCdfGumbel_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_69, AgradCdfTestFixture, AgradCdfGumbel_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_70, AgradCdfTestFixture, AgradCdfGumbel_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_71, AgradCdfTestFixture, AgradCdfGumbel_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_72, AgradCdfTestFixture, AgradCdfGumbel_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_73, AgradCdfTestFixture, AgradCdfGumbel_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_74, AgradCdfTestFixture, AgradCdfGumbel_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_75, AgradCdfTestFixture, AgradCdfGumbel_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_76, AgradCdfTestFixture, AgradCdfGumbel_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_77, AgradCdfTestFixture, AgradCdfGumbel_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_78, AgradCdfTestFixture, AgradCdfGumbel_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_79, AgradCdfTestFixture, AgradCdfGumbel_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_80, AgradCdfTestFixture, AgradCdfGumbel_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_81, AgradCdfTestFixture, AgradCdfGumbel_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_82, AgradCdfTestFixture, AgradCdfGumbel_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_83, AgradCdfTestFixture, AgradCdfGumbel_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_84, AgradCdfTestFixture, AgradCdfGumbel_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_85, AgradCdfTestFixture, AgradCdfGumbel_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_86, AgradCdfTestFixture, AgradCdfGumbel_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_87, AgradCdfTestFixture, AgradCdfGumbel_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_88, AgradCdfTestFixture, AgradCdfGumbel_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_89, AgradCdfTestFixture, AgradCdfGumbel_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_90, AgradCdfTestFixture, AgradCdfGumbel_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_91, AgradCdfTestFixture, AgradCdfGumbel_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_92, AgradCdfTestFixture, AgradCdfGumbel_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_93, AgradCdfTestFixture, AgradCdfGumbel_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_94, AgradCdfTestFixture, AgradCdfGumbel_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_95, AgradCdfTestFixture, AgradCdfGumbel_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_96, AgradCdfTestFixture, AgradCdfGumbel_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_97, AgradCdfTestFixture, AgradCdfGumbel_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_98, AgradCdfTestFixture, AgradCdfGumbel_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_99, AgradCdfTestFixture, AgradCdfGumbel_vv_99);
+
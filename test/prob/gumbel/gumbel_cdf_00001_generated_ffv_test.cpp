@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfGumbel, type_ffv_100> AgradCdfGumbel_ffv_100;
+typedef std::tuple<AgradCdfGumbel, type_ffv_101> AgradCdfGumbel_ffv_101;
+typedef std::tuple<AgradCdfGumbel, type_ffv_102> AgradCdfGumbel_ffv_102;
+typedef std::tuple<AgradCdfGumbel, type_ffv_103> AgradCdfGumbel_ffv_103;
+typedef std::tuple<AgradCdfGumbel, type_ffv_104> AgradCdfGumbel_ffv_104;
+typedef std::tuple<AgradCdfGumbel, type_ffv_105> AgradCdfGumbel_ffv_105;
+typedef std::tuple<AgradCdfGumbel, type_ffv_106> AgradCdfGumbel_ffv_106;
+typedef std::tuple<AgradCdfGumbel, type_ffv_107> AgradCdfGumbel_ffv_107;
+typedef std::tuple<AgradCdfGumbel, type_ffv_108> AgradCdfGumbel_ffv_108;
+typedef std::tuple<AgradCdfGumbel, type_ffv_109> AgradCdfGumbel_ffv_109;
+typedef std::tuple<AgradCdfGumbel, type_ffv_110> AgradCdfGumbel_ffv_110;
+typedef std::tuple<AgradCdfGumbel, type_ffv_111> AgradCdfGumbel_ffv_111;
+typedef std::tuple<AgradCdfGumbel, type_ffv_112> AgradCdfGumbel_ffv_112;
+typedef std::tuple<AgradCdfGumbel, type_ffv_113> AgradCdfGumbel_ffv_113;
+typedef std::tuple<AgradCdfGumbel, type_ffv_114> AgradCdfGumbel_ffv_114;
+typedef std::tuple<AgradCdfGumbel, type_ffv_115> AgradCdfGumbel_ffv_115;
+typedef std::tuple<AgradCdfGumbel, type_ffv_116> AgradCdfGumbel_ffv_116;
+typedef std::tuple<AgradCdfGumbel, type_ffv_117> AgradCdfGumbel_ffv_117;
+typedef std::tuple<AgradCdfGumbel, type_ffv_118> AgradCdfGumbel_ffv_118;
+typedef std::tuple<AgradCdfGumbel, type_ffv_119> AgradCdfGumbel_ffv_119;
+typedef std::tuple<AgradCdfGumbel, type_ffv_120> AgradCdfGumbel_ffv_120;
+typedef std::tuple<AgradCdfGumbel, type_ffv_121> AgradCdfGumbel_ffv_121;
+typedef std::tuple<AgradCdfGumbel, type_ffv_122> AgradCdfGumbel_ffv_122;
+typedef std::tuple<AgradCdfGumbel, type_ffv_123> AgradCdfGumbel_ffv_123;
+typedef std::tuple<AgradCdfGumbel, type_ffv_124> AgradCdfGumbel_ffv_124;
+typedef std::tuple<AgradCdfGumbel, type_ffv_125> AgradCdfGumbel_ffv_125;
+typedef std::tuple<AgradCdfGumbel, type_ffv_126> AgradCdfGumbel_ffv_126;
+typedef std::tuple<AgradCdfGumbel, type_ffv_127> AgradCdfGumbel_ffv_127;
+typedef std::tuple<AgradCdfGumbel, type_ffv_128> AgradCdfGumbel_ffv_128;
+typedef std::tuple<AgradCdfGumbel, type_ffv_129> AgradCdfGumbel_ffv_129;
+typedef std::tuple<AgradCdfGumbel, type_ffv_130> AgradCdfGumbel_ffv_130;
+typedef std::tuple<AgradCdfGumbel, type_ffv_131> AgradCdfGumbel_ffv_131;
+typedef std::tuple<AgradCdfGumbel, type_ffv_132> AgradCdfGumbel_ffv_132;
+typedef std::tuple<AgradCdfGumbel, type_ffv_133> AgradCdfGumbel_ffv_133;
+typedef std::tuple<AgradCdfGumbel, type_ffv_134> AgradCdfGumbel_ffv_134;
+typedef std::tuple<AgradCdfGumbel, type_ffv_135> AgradCdfGumbel_ffv_135;
+typedef std::tuple<AgradCdfGumbel, type_ffv_136> AgradCdfGumbel_ffv_136;
+typedef std::tuple<AgradCdfGumbel, type_ffv_137> AgradCdfGumbel_ffv_137;
+typedef std::tuple<AgradCdfGumbel, type_ffv_138> AgradCdfGumbel_ffv_138;
+typedef std::tuple<AgradCdfGumbel, type_ffv_139> AgradCdfGumbel_ffv_139;
+typedef std::tuple<AgradCdfGumbel, type_ffv_140> AgradCdfGumbel_ffv_140;
+typedef std::tuple<AgradCdfGumbel, type_ffv_141> AgradCdfGumbel_ffv_141;
+typedef std::tuple<AgradCdfGumbel, type_ffv_142> AgradCdfGumbel_ffv_142;
+typedef std::tuple<AgradCdfGumbel, type_ffv_143> AgradCdfGumbel_ffv_143;
+typedef std::tuple<AgradCdfGumbel, type_ffv_144> AgradCdfGumbel_ffv_144;
+typedef std::tuple<AgradCdfGumbel, type_ffv_145> AgradCdfGumbel_ffv_145;
+typedef std::tuple<AgradCdfGumbel, type_ffv_146> AgradCdfGumbel_ffv_146;
+typedef std::tuple<AgradCdfGumbel, type_ffv_147> AgradCdfGumbel_ffv_147;
+typedef std::tuple<AgradCdfGumbel, type_ffv_148> AgradCdfGumbel_ffv_148;
+typedef std::tuple<AgradCdfGumbel, type_ffv_149> AgradCdfGumbel_ffv_149;
+typedef std::tuple<AgradCdfGumbel, type_ffv_150> AgradCdfGumbel_ffv_150;
+typedef std::tuple<AgradCdfGumbel, type_ffv_151> AgradCdfGumbel_ffv_151;
+typedef std::tuple<AgradCdfGumbel, type_ffv_152> AgradCdfGumbel_ffv_152;
+typedef std::tuple<AgradCdfGumbel, type_ffv_153> AgradCdfGumbel_ffv_153;
+typedef std::tuple<AgradCdfGumbel, type_ffv_154> AgradCdfGumbel_ffv_154;
+typedef std::tuple<AgradCdfGumbel, type_ffv_155> AgradCdfGumbel_ffv_155;
+typedef std::tuple<AgradCdfGumbel, type_ffv_156> AgradCdfGumbel_ffv_156;
+typedef std::tuple<AgradCdfGumbel, type_ffv_157> AgradCdfGumbel_ffv_157;
+typedef std::tuple<AgradCdfGumbel, type_ffv_158> AgradCdfGumbel_ffv_158;
+typedef std::tuple<AgradCdfGumbel, type_ffv_159> AgradCdfGumbel_ffv_159;
+typedef std::tuple<AgradCdfGumbel, type_ffv_160> AgradCdfGumbel_ffv_160;
+typedef std::tuple<AgradCdfGumbel, type_ffv_161> AgradCdfGumbel_ffv_161;
+typedef std::tuple<AgradCdfGumbel, type_ffv_162> AgradCdfGumbel_ffv_162;
+typedef std::tuple<AgradCdfGumbel, type_ffv_163> AgradCdfGumbel_ffv_163;
+typedef std::tuple<AgradCdfGumbel, type_ffv_164> AgradCdfGumbel_ffv_164;
+typedef std::tuple<AgradCdfGumbel, type_ffv_165> AgradCdfGumbel_ffv_165;
+typedef std::tuple<AgradCdfGumbel, type_ffv_166> AgradCdfGumbel_ffv_166;
+typedef std::tuple<AgradCdfGumbel, type_ffv_167> AgradCdfGumbel_ffv_167;
+typedef std::tuple<AgradCdfGumbel, type_ffv_168> AgradCdfGumbel_ffv_168;
+typedef std::tuple<AgradCdfGumbel, type_ffv_169> AgradCdfGumbel_ffv_169;
+typedef std::tuple<AgradCdfGumbel, type_ffv_170> AgradCdfGumbel_ffv_170;
+typedef std::tuple<AgradCdfGumbel, type_ffv_171> AgradCdfGumbel_ffv_171;
+typedef std::tuple<AgradCdfGumbel, type_ffv_172> AgradCdfGumbel_ffv_172;
+typedef std::tuple<AgradCdfGumbel, type_ffv_173> AgradCdfGumbel_ffv_173;
+typedef std::tuple<AgradCdfGumbel, type_ffv_174> AgradCdfGumbel_ffv_174;
+typedef std::tuple<AgradCdfGumbel, type_ffv_175> AgradCdfGumbel_ffv_175;
+typedef std::tuple<AgradCdfGumbel, type_ffv_176> AgradCdfGumbel_ffv_176;
+typedef std::tuple<AgradCdfGumbel, type_ffv_177> AgradCdfGumbel_ffv_177;
+typedef std::tuple<AgradCdfGumbel, type_ffv_178> AgradCdfGumbel_ffv_178;
+typedef std::tuple<AgradCdfGumbel, type_ffv_179> AgradCdfGumbel_ffv_179;
+typedef std::tuple<AgradCdfGumbel, type_ffv_180> AgradCdfGumbel_ffv_180;
+typedef std::tuple<AgradCdfGumbel, type_ffv_181> AgradCdfGumbel_ffv_181;
+typedef std::tuple<AgradCdfGumbel, type_ffv_182> AgradCdfGumbel_ffv_182;
+typedef std::tuple<AgradCdfGumbel, type_ffv_183> AgradCdfGumbel_ffv_183;
+typedef std::tuple<AgradCdfGumbel, type_ffv_184> AgradCdfGumbel_ffv_184;
+typedef std::tuple<AgradCdfGumbel, type_ffv_185> AgradCdfGumbel_ffv_185;
+typedef std::tuple<AgradCdfGumbel, type_ffv_186> AgradCdfGumbel_ffv_186;
+typedef std::tuple<AgradCdfGumbel, type_ffv_187> AgradCdfGumbel_ffv_187;
+typedef std::tuple<AgradCdfGumbel, type_ffv_188> AgradCdfGumbel_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_100, AgradCdfTestFixture, AgradCdfGumbel_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_101, AgradCdfTestFixture, AgradCdfGumbel_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_102, AgradCdfTestFixture, AgradCdfGumbel_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_103, AgradCdfTestFixture, AgradCdfGumbel_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_104, AgradCdfTestFixture, AgradCdfGumbel_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_105, AgradCdfTestFixture, AgradCdfGumbel_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_106, AgradCdfTestFixture, AgradCdfGumbel_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_107, AgradCdfTestFixture, AgradCdfGumbel_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_108, AgradCdfTestFixture, AgradCdfGumbel_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_109, AgradCdfTestFixture, AgradCdfGumbel_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_110, AgradCdfTestFixture, AgradCdfGumbel_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_111, AgradCdfTestFixture, AgradCdfGumbel_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_112, AgradCdfTestFixture, AgradCdfGumbel_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_113, AgradCdfTestFixture, AgradCdfGumbel_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_114, AgradCdfTestFixture, AgradCdfGumbel_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_115, AgradCdfTestFixture, AgradCdfGumbel_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_116, AgradCdfTestFixture, AgradCdfGumbel_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_117, AgradCdfTestFixture, AgradCdfGumbel_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_118, AgradCdfTestFixture, AgradCdfGumbel_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_119, AgradCdfTestFixture, AgradCdfGumbel_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_120, AgradCdfTestFixture, AgradCdfGumbel_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_121, AgradCdfTestFixture, AgradCdfGumbel_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_122, AgradCdfTestFixture, AgradCdfGumbel_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_123, AgradCdfTestFixture, AgradCdfGumbel_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_124, AgradCdfTestFixture, AgradCdfGumbel_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_125, AgradCdfTestFixture, AgradCdfGumbel_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_126, AgradCdfTestFixture, AgradCdfGumbel_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_127, AgradCdfTestFixture, AgradCdfGumbel_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_128, AgradCdfTestFixture, AgradCdfGumbel_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_129, AgradCdfTestFixture, AgradCdfGumbel_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_130, AgradCdfTestFixture, AgradCdfGumbel_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_131, AgradCdfTestFixture, AgradCdfGumbel_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_132, AgradCdfTestFixture, AgradCdfGumbel_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_133, AgradCdfTestFixture, AgradCdfGumbel_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_134, AgradCdfTestFixture, AgradCdfGumbel_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_135, AgradCdfTestFixture, AgradCdfGumbel_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_136, AgradCdfTestFixture, AgradCdfGumbel_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_137, AgradCdfTestFixture, AgradCdfGumbel_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_138, AgradCdfTestFixture, AgradCdfGumbel_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_139, AgradCdfTestFixture, AgradCdfGumbel_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_140, AgradCdfTestFixture, AgradCdfGumbel_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_141, AgradCdfTestFixture, AgradCdfGumbel_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_142, AgradCdfTestFixture, AgradCdfGumbel_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_143, AgradCdfTestFixture, AgradCdfGumbel_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_144, AgradCdfTestFixture, AgradCdfGumbel_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_145, AgradCdfTestFixture, AgradCdfGumbel_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_146, AgradCdfTestFixture, AgradCdfGumbel_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_147, AgradCdfTestFixture, AgradCdfGumbel_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_148, AgradCdfTestFixture, AgradCdfGumbel_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_149, AgradCdfTestFixture, AgradCdfGumbel_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_150, AgradCdfTestFixture, AgradCdfGumbel_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_151, AgradCdfTestFixture, AgradCdfGumbel_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_152, AgradCdfTestFixture, AgradCdfGumbel_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_153, AgradCdfTestFixture, AgradCdfGumbel_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_154, AgradCdfTestFixture, AgradCdfGumbel_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_155, AgradCdfTestFixture, AgradCdfGumbel_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_156, AgradCdfTestFixture, AgradCdfGumbel_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_157, AgradCdfTestFixture, AgradCdfGumbel_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_158, AgradCdfTestFixture, AgradCdfGumbel_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_159, AgradCdfTestFixture, AgradCdfGumbel_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_160, AgradCdfTestFixture, AgradCdfGumbel_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_161, AgradCdfTestFixture, AgradCdfGumbel_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_162, AgradCdfTestFixture, AgradCdfGumbel_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_163, AgradCdfTestFixture, AgradCdfGumbel_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_164, AgradCdfTestFixture, AgradCdfGumbel_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_165, AgradCdfTestFixture, AgradCdfGumbel_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_166, AgradCdfTestFixture, AgradCdfGumbel_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_167, AgradCdfTestFixture, AgradCdfGumbel_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_168, AgradCdfTestFixture, AgradCdfGumbel_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_169, AgradCdfTestFixture, AgradCdfGumbel_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_170, AgradCdfTestFixture, AgradCdfGumbel_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_171, AgradCdfTestFixture, AgradCdfGumbel_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_172, AgradCdfTestFixture, AgradCdfGumbel_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_173, AgradCdfTestFixture, AgradCdfGumbel_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_174, AgradCdfTestFixture, AgradCdfGumbel_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_175, AgradCdfTestFixture, AgradCdfGumbel_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_176, AgradCdfTestFixture, AgradCdfGumbel_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_177, AgradCdfTestFixture, AgradCdfGumbel_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_178, AgradCdfTestFixture, AgradCdfGumbel_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_179, AgradCdfTestFixture, AgradCdfGumbel_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_180, AgradCdfTestFixture, AgradCdfGumbel_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_181, AgradCdfTestFixture, AgradCdfGumbel_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_182, AgradCdfTestFixture, AgradCdfGumbel_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_183, AgradCdfTestFixture, AgradCdfGumbel_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_184, AgradCdfTestFixture, AgradCdfGumbel_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_185, AgradCdfTestFixture, AgradCdfGumbel_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_186, AgradCdfTestFixture, AgradCdfGumbel_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_187, AgradCdfTestFixture, AgradCdfGumbel_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_ffv_188, AgradCdfTestFixture, AgradCdfGumbel_ffv_188);
+
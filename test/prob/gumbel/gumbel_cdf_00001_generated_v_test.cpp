@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfGumbel, type_v_100> AgradCdfGumbel_v_100;
+typedef std::tuple<AgradCdfGumbel, type_v_101> AgradCdfGumbel_v_101;
+typedef std::tuple<AgradCdfGumbel, type_v_102> AgradCdfGumbel_v_102;
+typedef std::tuple<AgradCdfGumbel, type_v_103> AgradCdfGumbel_v_103;
+typedef std::tuple<AgradCdfGumbel, type_v_104> AgradCdfGumbel_v_104;
+typedef std::tuple<AgradCdfGumbel, type_v_105> AgradCdfGumbel_v_105;
+typedef std::tuple<AgradCdfGumbel, type_v_106> AgradCdfGumbel_v_106;
+typedef std::tuple<AgradCdfGumbel, type_v_107> AgradCdfGumbel_v_107;
+typedef std::tuple<AgradCdfGumbel, type_v_108> AgradCdfGumbel_v_108;
+typedef std::tuple<AgradCdfGumbel, type_v_109> AgradCdfGumbel_v_109;
+typedef std::tuple<AgradCdfGumbel, type_v_110> AgradCdfGumbel_v_110;
+typedef std::tuple<AgradCdfGumbel, type_v_111> AgradCdfGumbel_v_111;
+typedef std::tuple<AgradCdfGumbel, type_v_112> AgradCdfGumbel_v_112;
+typedef std::tuple<AgradCdfGumbel, type_v_113> AgradCdfGumbel_v_113;
+typedef std::tuple<AgradCdfGumbel, type_v_114> AgradCdfGumbel_v_114;
+typedef std::tuple<AgradCdfGumbel, type_v_115> AgradCdfGumbel_v_115;
+typedef std::tuple<AgradCdfGumbel, type_v_116> AgradCdfGumbel_v_116;
+typedef std::tuple<AgradCdfGumbel, type_v_117> AgradCdfGumbel_v_117;
+typedef std::tuple<AgradCdfGumbel, type_v_118> AgradCdfGumbel_v_118;
+typedef std::tuple<AgradCdfGumbel, type_v_119> AgradCdfGumbel_v_119;
+typedef std::tuple<AgradCdfGumbel, type_v_120> AgradCdfGumbel_v_120;
+typedef std::tuple<AgradCdfGumbel, type_v_121> AgradCdfGumbel_v_121;
+typedef std::tuple<AgradCdfGumbel, type_v_122> AgradCdfGumbel_v_122;
+typedef std::tuple<AgradCdfGumbel, type_v_123> AgradCdfGumbel_v_123;
+typedef std::tuple<AgradCdfGumbel, type_v_124> AgradCdfGumbel_v_124;
+typedef std::tuple<AgradCdfGumbel, type_v_125> AgradCdfGumbel_v_125;
+typedef std::tuple<AgradCdfGumbel, type_v_126> AgradCdfGumbel_v_126;
+typedef std::tuple<AgradCdfGumbel, type_v_127> AgradCdfGumbel_v_127;
+typedef std::tuple<AgradCdfGumbel, type_v_128> AgradCdfGumbel_v_128;
+typedef std::tuple<AgradCdfGumbel, type_v_129> AgradCdfGumbel_v_129;
+typedef std::tuple<AgradCdfGumbel, type_v_130> AgradCdfGumbel_v_130;
+typedef std::tuple<AgradCdfGumbel, type_v_131> AgradCdfGumbel_v_131;
+typedef std::tuple<AgradCdfGumbel, type_v_132> AgradCdfGumbel_v_132;
+typedef std::tuple<AgradCdfGumbel, type_v_133> AgradCdfGumbel_v_133;
+typedef std::tuple<AgradCdfGumbel, type_v_134> AgradCdfGumbel_v_134;
+typedef std::tuple<AgradCdfGumbel, type_v_135> AgradCdfGumbel_v_135;
+typedef std::tuple<AgradCdfGumbel, type_v_136> AgradCdfGumbel_v_136;
+typedef std::tuple<AgradCdfGumbel, type_v_137> AgradCdfGumbel_v_137;
+typedef std::tuple<AgradCdfGumbel, type_v_138> AgradCdfGumbel_v_138;
+typedef std::tuple<AgradCdfGumbel, type_v_139> AgradCdfGumbel_v_139;
+typedef std::tuple<AgradCdfGumbel, type_v_140> AgradCdfGumbel_v_140;
+typedef std::tuple<AgradCdfGumbel, type_v_141> AgradCdfGumbel_v_141;
+typedef std::tuple<AgradCdfGumbel, type_v_142> AgradCdfGumbel_v_142;
+typedef std::tuple<AgradCdfGumbel, type_v_143> AgradCdfGumbel_v_143;
+typedef std::tuple<AgradCdfGumbel, type_v_144> AgradCdfGumbel_v_144;
+typedef std::tuple<AgradCdfGumbel, type_v_145> AgradCdfGumbel_v_145;
+typedef std::tuple<AgradCdfGumbel, type_v_146> AgradCdfGumbel_v_146;
+typedef std::tuple<AgradCdfGumbel, type_v_147> AgradCdfGumbel_v_147;
+typedef std::tuple<AgradCdfGumbel, type_v_148> AgradCdfGumbel_v_148;
+typedef std::tuple<AgradCdfGumbel, type_v_149> AgradCdfGumbel_v_149;
+typedef std::tuple<AgradCdfGumbel, type_v_150> AgradCdfGumbel_v_150;
+typedef std::tuple<AgradCdfGumbel, type_v_151> AgradCdfGumbel_v_151;
+typedef std::tuple<AgradCdfGumbel, type_v_152> AgradCdfGumbel_v_152;
+typedef std::tuple<AgradCdfGumbel, type_v_153> AgradCdfGumbel_v_153;
+typedef std::tuple<AgradCdfGumbel, type_v_154> AgradCdfGumbel_v_154;
+typedef std::tuple<AgradCdfGumbel, type_v_155> AgradCdfGumbel_v_155;
+typedef std::tuple<AgradCdfGumbel, type_v_156> AgradCdfGumbel_v_156;
+typedef std::tuple<AgradCdfGumbel, type_v_157> AgradCdfGumbel_v_157;
+typedef std::tuple<AgradCdfGumbel, type_v_158> AgradCdfGumbel_v_158;
+typedef std::tuple<AgradCdfGumbel, type_v_159> AgradCdfGumbel_v_159;
+typedef std::tuple<AgradCdfGumbel, type_v_160> AgradCdfGumbel_v_160;
+typedef std::tuple<AgradCdfGumbel, type_v_161> AgradCdfGumbel_v_161;
+typedef std::tuple<AgradCdfGumbel, type_v_162> AgradCdfGumbel_v_162;
+typedef std::tuple<AgradCdfGumbel, type_v_163> AgradCdfGumbel_v_163;
+typedef std::tuple<AgradCdfGumbel, type_v_164> AgradCdfGumbel_v_164;
+typedef std::tuple<AgradCdfGumbel, type_v_165> AgradCdfGumbel_v_165;
+typedef std::tuple<AgradCdfGumbel, type_v_166> AgradCdfGumbel_v_166;
+typedef std::tuple<AgradCdfGumbel, type_v_167> AgradCdfGumbel_v_167;
+typedef std::tuple<AgradCdfGumbel, type_v_168> AgradCdfGumbel_v_168;
+typedef std::tuple<AgradCdfGumbel, type_v_169> AgradCdfGumbel_v_169;
+typedef std::tuple<AgradCdfGumbel, type_v_170> AgradCdfGumbel_v_170;
+typedef std::tuple<AgradCdfGumbel, type_v_171> AgradCdfGumbel_v_171;
+typedef std::tuple<AgradCdfGumbel, type_v_172> AgradCdfGumbel_v_172;
+typedef std::tuple<AgradCdfGumbel, type_v_173> AgradCdfGumbel_v_173;
+typedef std::tuple<AgradCdfGumbel, type_v_174> AgradCdfGumbel_v_174;
+typedef std::tuple<AgradCdfGumbel, type_v_175> AgradCdfGumbel_v_175;
+typedef std::tuple<AgradCdfGumbel, type_v_176> AgradCdfGumbel_v_176;
+typedef std::tuple<AgradCdfGumbel, type_v_177> AgradCdfGumbel_v_177;
+typedef std::tuple<AgradCdfGumbel, type_v_178> AgradCdfGumbel_v_178;
+typedef std::tuple<AgradCdfGumbel, type_v_179> AgradCdfGumbel_v_179;
+typedef std::tuple<AgradCdfGumbel, type_v_180> AgradCdfGumbel_v_180;
+typedef std::tuple<AgradCdfGumbel, type_v_181> AgradCdfGumbel_v_181;
+typedef std::tuple<AgradCdfGumbel, type_v_182> AgradCdfGumbel_v_182;
+typedef std::tuple<AgradCdfGumbel, type_v_183> AgradCdfGumbel_v_183;
+typedef std::tuple<AgradCdfGumbel, type_v_184> AgradCdfGumbel_v_184;
+typedef std::tuple<AgradCdfGumbel, type_v_185> AgradCdfGumbel_v_185;
+typedef std::tuple<AgradCdfGumbel, type_v_186> AgradCdfGumbel_v_186;
+typedef std::tuple<AgradCdfGumbel, type_v_187> AgradCdfGumbel_v_187;
+typedef std::tuple<AgradCdfGumbel, type_v_188> AgradCdfGumbel_v_188;
+typedef std::tuple<AgradCdfGumbel, type_v_189> AgradCdfGumbel_v_189;
+typedef std::tuple<AgradCdfGumbel, type_v_190> AgradCdfGumbel_v_190;
+typedef std::tuple<AgradCdfGumbel, type_v_191> AgradCdfGumbel_v_191;
+typedef std::tuple<AgradCdfGumbel, type_v_192> AgradCdfGumbel_v_192;
+typedef std::tuple<AgradCdfGumbel, type_v_193> AgradCdfGumbel_v_193;
+typedef std::tuple<AgradCdfGumbel, type_v_194> AgradCdfGumbel_v_194;
+typedef std::tuple<AgradCdfGumbel, type_v_195> AgradCdfGumbel_v_195;
+typedef std::tuple<AgradCdfGumbel, type_v_196> AgradCdfGumbel_v_196;
+typedef std::tuple<AgradCdfGumbel, type_v_197> AgradCdfGumbel_v_197;
+typedef std::tuple<AgradCdfGumbel, type_v_198> AgradCdfGumbel_v_198;
+typedef std::tuple<AgradCdfGumbel, type_v_199> AgradCdfGumbel_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_100, AgradCdfTestFixture, AgradCdfGumbel_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_101, AgradCdfTestFixture, AgradCdfGumbel_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_102, AgradCdfTestFixture, AgradCdfGumbel_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_103, AgradCdfTestFixture, AgradCdfGumbel_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_104, AgradCdfTestFixture, AgradCdfGumbel_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_105, AgradCdfTestFixture, AgradCdfGumbel_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_106, AgradCdfTestFixture, AgradCdfGumbel_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_107, AgradCdfTestFixture, AgradCdfGumbel_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_108, AgradCdfTestFixture, AgradCdfGumbel_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_109, AgradCdfTestFixture, AgradCdfGumbel_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_110, AgradCdfTestFixture, AgradCdfGumbel_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_111, AgradCdfTestFixture, AgradCdfGumbel_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_112, AgradCdfTestFixture, AgradCdfGumbel_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_113, AgradCdfTestFixture, AgradCdfGumbel_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_114, AgradCdfTestFixture, AgradCdfGumbel_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_115, AgradCdfTestFixture, AgradCdfGumbel_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_116, AgradCdfTestFixture, AgradCdfGumbel_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_117, AgradCdfTestFixture, AgradCdfGumbel_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_118, AgradCdfTestFixture, AgradCdfGumbel_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_119, AgradCdfTestFixture, AgradCdfGumbel_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_120, AgradCdfTestFixture, AgradCdfGumbel_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_121, AgradCdfTestFixture, AgradCdfGumbel_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_122, AgradCdfTestFixture, AgradCdfGumbel_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_123, AgradCdfTestFixture, AgradCdfGumbel_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_124, AgradCdfTestFixture, AgradCdfGumbel_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_125, AgradCdfTestFixture, AgradCdfGumbel_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_126, AgradCdfTestFixture, AgradCdfGumbel_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_127, AgradCdfTestFixture, AgradCdfGumbel_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_128, AgradCdfTestFixture, AgradCdfGumbel_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_129, AgradCdfTestFixture, AgradCdfGumbel_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_130, AgradCdfTestFixture, AgradCdfGumbel_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_131, AgradCdfTestFixture, AgradCdfGumbel_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_132, AgradCdfTestFixture, AgradCdfGumbel_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_133, AgradCdfTestFixture, AgradCdfGumbel_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_134, AgradCdfTestFixture, AgradCdfGumbel_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_135, AgradCdfTestFixture, AgradCdfGumbel_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_136, AgradCdfTestFixture, AgradCdfGumbel_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_137, AgradCdfTestFixture, AgradCdfGumbel_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_138, AgradCdfTestFixture, AgradCdfGumbel_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_139, AgradCdfTestFixture, AgradCdfGumbel_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_140, AgradCdfTestFixture, AgradCdfGumbel_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_141, AgradCdfTestFixture, AgradCdfGumbel_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_142, AgradCdfTestFixture, AgradCdfGumbel_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_143, AgradCdfTestFixture, AgradCdfGumbel_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_144, AgradCdfTestFixture, AgradCdfGumbel_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_145, AgradCdfTestFixture, AgradCdfGumbel_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_146, AgradCdfTestFixture, AgradCdfGumbel_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_147, AgradCdfTestFixture, AgradCdfGumbel_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_148, AgradCdfTestFixture, AgradCdfGumbel_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_149, AgradCdfTestFixture, AgradCdfGumbel_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_150, AgradCdfTestFixture, AgradCdfGumbel_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_151, AgradCdfTestFixture, AgradCdfGumbel_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_152, AgradCdfTestFixture, AgradCdfGumbel_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_153, AgradCdfTestFixture, AgradCdfGumbel_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_154, AgradCdfTestFixture, AgradCdfGumbel_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_155, AgradCdfTestFixture, AgradCdfGumbel_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_156, AgradCdfTestFixture, AgradCdfGumbel_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_157, AgradCdfTestFixture, AgradCdfGumbel_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_158, AgradCdfTestFixture, AgradCdfGumbel_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_159, AgradCdfTestFixture, AgradCdfGumbel_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_160, AgradCdfTestFixture, AgradCdfGumbel_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_161, AgradCdfTestFixture, AgradCdfGumbel_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_162, AgradCdfTestFixture, AgradCdfGumbel_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_163, AgradCdfTestFixture, AgradCdfGumbel_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_164, AgradCdfTestFixture, AgradCdfGumbel_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_165, AgradCdfTestFixture, AgradCdfGumbel_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_166, AgradCdfTestFixture, AgradCdfGumbel_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_167, AgradCdfTestFixture, AgradCdfGumbel_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_168, AgradCdfTestFixture, AgradCdfGumbel_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_169, AgradCdfTestFixture, AgradCdfGumbel_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_170, AgradCdfTestFixture, AgradCdfGumbel_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_171, AgradCdfTestFixture, AgradCdfGumbel_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_172, AgradCdfTestFixture, AgradCdfGumbel_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_173, AgradCdfTestFixture, AgradCdfGumbel_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_174, AgradCdfTestFixture, AgradCdfGumbel_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_175, AgradCdfTestFixture, AgradCdfGumbel_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_176, AgradCdfTestFixture, AgradCdfGumbel_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_177, AgradCdfTestFixture, AgradCdfGumbel_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_178, AgradCdfTestFixture, AgradCdfGumbel_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_179, AgradCdfTestFixture, AgradCdfGumbel_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_180, AgradCdfTestFixture, AgradCdfGumbel_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_181, AgradCdfTestFixture, AgradCdfGumbel_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_182, AgradCdfTestFixture, AgradCdfGumbel_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_183, AgradCdfTestFixture, AgradCdfGumbel_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_184, AgradCdfTestFixture, AgradCdfGumbel_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_185, AgradCdfTestFixture, AgradCdfGumbel_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_186, AgradCdfTestFixture, AgradCdfGumbel_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_187, AgradCdfTestFixture, AgradCdfGumbel_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_188, AgradCdfTestFixture, AgradCdfGumbel_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_189, AgradCdfTestFixture, AgradCdfGumbel_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_190, AgradCdfTestFixture, AgradCdfGumbel_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_191, AgradCdfTestFixture, AgradCdfGumbel_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_192, AgradCdfTestFixture, AgradCdfGumbel_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_193, AgradCdfTestFixture, AgradCdfGumbel_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_194, AgradCdfTestFixture, AgradCdfGumbel_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_195, AgradCdfTestFixture, AgradCdfGumbel_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_196, AgradCdfTestFixture, AgradCdfGumbel_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_197, AgradCdfTestFixture, AgradCdfGumbel_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_198, AgradCdfTestFixture, AgradCdfGumbel_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_v_199, AgradCdfTestFixture, AgradCdfGumbel_v_199);
+
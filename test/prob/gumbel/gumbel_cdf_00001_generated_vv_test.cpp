@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfGumbel, type_vv_100> AgradCdfGumbel_vv_100;
+typedef std::tuple<AgradCdfGumbel, type_vv_101> AgradCdfGumbel_vv_101;
+typedef std::tuple<AgradCdfGumbel, type_vv_102> AgradCdfGumbel_vv_102;
+typedef std::tuple<AgradCdfGumbel, type_vv_103> AgradCdfGumbel_vv_103;
+typedef std::tuple<AgradCdfGumbel, type_vv_104> AgradCdfGumbel_vv_104;
+typedef std::tuple<AgradCdfGumbel, type_vv_105> AgradCdfGumbel_vv_105;
+typedef std::tuple<AgradCdfGumbel, type_vv_106> AgradCdfGumbel_vv_106;
+typedef std::tuple<AgradCdfGumbel, type_vv_107> AgradCdfGumbel_vv_107;
+typedef std::tuple<AgradCdfGumbel, type_vv_108> AgradCdfGumbel_vv_108;
+typedef std::tuple<AgradCdfGumbel, type_vv_109> AgradCdfGumbel_vv_109;
+typedef std::tuple<AgradCdfGumbel, type_vv_110> AgradCdfGumbel_vv_110;
+typedef std::tuple<AgradCdfGumbel, type_vv_111> AgradCdfGumbel_vv_111;
+typedef std::tuple<AgradCdfGumbel, type_vv_112> AgradCdfGumbel_vv_112;
+typedef std::tuple<AgradCdfGumbel, type_vv_113> AgradCdfGumbel_vv_113;
+typedef std::tuple<AgradCdfGumbel, type_vv_114> AgradCdfGumbel_vv_114;
+typedef std::tuple<AgradCdfGumbel, type_vv_115> AgradCdfGumbel_vv_115;
+typedef std::tuple<AgradCdfGumbel, type_vv_116> AgradCdfGumbel_vv_116;
+typedef std::tuple<AgradCdfGumbel, type_vv_117> AgradCdfGumbel_vv_117;
+typedef std::tuple<AgradCdfGumbel, type_vv_118> AgradCdfGumbel_vv_118;
+typedef std::tuple<AgradCdfGumbel, type_vv_119> AgradCdfGumbel_vv_119;
+typedef std::tuple<AgradCdfGumbel, type_vv_120> AgradCdfGumbel_vv_120;
+typedef std::tuple<AgradCdfGumbel, type_vv_121> AgradCdfGumbel_vv_121;
+typedef std::tuple<AgradCdfGumbel, type_vv_122> AgradCdfGumbel_vv_122;
+typedef std::tuple<AgradCdfGumbel, type_vv_123> AgradCdfGumbel_vv_123;
+typedef std::tuple<AgradCdfGumbel, type_vv_124> AgradCdfGumbel_vv_124;
+typedef std::tuple<AgradCdfGumbel, type_vv_125> AgradCdfGumbel_vv_125;
+typedef std::tuple<AgradCdfGumbel, type_vv_126> AgradCdfGumbel_vv_126;
+typedef std::tuple<AgradCdfGumbel, type_vv_127> AgradCdfGumbel_vv_127;
+typedef std::tuple<AgradCdfGumbel, type_vv_128> AgradCdfGumbel_vv_128;
+typedef std::tuple<AgradCdfGumbel, type_vv_129> AgradCdfGumbel_vv_129;
+typedef std::tuple<AgradCdfGumbel, type_vv_130> AgradCdfGumbel_vv_130;
+typedef std::tuple<AgradCdfGumbel, type_vv_131> AgradCdfGumbel_vv_131;
+typedef std::tuple<AgradCdfGumbel, type_vv_132> AgradCdfGumbel_vv_132;
+typedef std::tuple<AgradCdfGumbel, type_vv_133> AgradCdfGumbel_vv_133;
+typedef std::tuple<AgradCdfGumbel, type_vv_134> AgradCdfGumbel_vv_134;
+typedef std::tuple<AgradCdfGumbel, type_vv_135> AgradCdfGumbel_vv_135;
+typedef std::tuple<AgradCdfGumbel, type_vv_136> AgradCdfGumbel_vv_136;
+typedef std::tuple<AgradCdfGumbel, type_vv_137> AgradCdfGumbel_vv_137;
+typedef std::tuple<AgradCdfGumbel, type_vv_138> AgradCdfGumbel_vv_138;
+typedef std::tuple<AgradCdfGumbel, type_vv_139> AgradCdfGumbel_vv_139;
+typedef std::tuple<AgradCdfGumbel, type_vv_140> AgradCdfGumbel_vv_140;
+typedef std::tuple<AgradCdfGumbel, type_vv_141> AgradCdfGumbel_vv_141;
+typedef std::tuple<AgradCdfGumbel, type_vv_142> AgradCdfGumbel_vv_142;
+typedef std::tuple<AgradCdfGumbel, type_vv_143> AgradCdfGumbel_vv_143;
+typedef std::tuple<AgradCdfGumbel, type_vv_144> AgradCdfGumbel_vv_144;
+typedef std::tuple<AgradCdfGumbel, type_vv_145> AgradCdfGumbel_vv_145;
+typedef std::tuple<AgradCdfGumbel, type_vv_146> AgradCdfGumbel_vv_146;
+typedef std::tuple<AgradCdfGumbel, type_vv_147> AgradCdfGumbel_vv_147;
+typedef std::tuple<AgradCdfGumbel, type_vv_148> AgradCdfGumbel_vv_148;
+typedef std::tuple<AgradCdfGumbel, type_vv_149> AgradCdfGumbel_vv_149;
+typedef std::tuple<AgradCdfGumbel, type_vv_150> AgradCdfGumbel_vv_150;
+typedef std::tuple<AgradCdfGumbel, type_vv_151> AgradCdfGumbel_vv_151;
+typedef std::tuple<AgradCdfGumbel, type_vv_152> AgradCdfGumbel_vv_152;
+typedef std::tuple<AgradCdfGumbel, type_vv_153> AgradCdfGumbel_vv_153;
+typedef std::tuple<AgradCdfGumbel, type_vv_154> AgradCdfGumbel_vv_154;
+typedef std::tuple<AgradCdfGumbel, type_vv_155> AgradCdfGumbel_vv_155;
+typedef std::tuple<AgradCdfGumbel, type_vv_156> AgradCdfGumbel_vv_156;
+typedef std::tuple<AgradCdfGumbel, type_vv_157> AgradCdfGumbel_vv_157;
+typedef std::tuple<AgradCdfGumbel, type_vv_158> AgradCdfGumbel_vv_158;
+typedef std::tuple<AgradCdfGumbel, type_vv_159> AgradCdfGumbel_vv_159;
+typedef std::tuple<AgradCdfGumbel, type_vv_160> AgradCdfGumbel_vv_160;
+typedef std::tuple<AgradCdfGumbel, type_vv_161> AgradCdfGumbel_vv_161;
+typedef std::tuple<AgradCdfGumbel, type_vv_162> AgradCdfGumbel_vv_162;
+typedef std::tuple<AgradCdfGumbel, type_vv_163> AgradCdfGumbel_vv_163;
+typedef std::tuple<AgradCdfGumbel, type_vv_164> AgradCdfGumbel_vv_164;
+typedef std::tuple<AgradCdfGumbel, type_vv_165> AgradCdfGumbel_vv_165;
+typedef std::tuple<AgradCdfGumbel, type_vv_166> AgradCdfGumbel_vv_166;
+typedef std::tuple<AgradCdfGumbel, type_vv_167> AgradCdfGumbel_vv_167;
+typedef std::tuple<AgradCdfGumbel, type_vv_168> AgradCdfGumbel_vv_168;
+typedef std::tuple<AgradCdfGumbel, type_vv_169> AgradCdfGumbel_vv_169;
+typedef std::tuple<AgradCdfGumbel, type_vv_170> AgradCdfGumbel_vv_170;
+typedef std::tuple<AgradCdfGumbel, type_vv_171> AgradCdfGumbel_vv_171;
+typedef std::tuple<AgradCdfGumbel, type_vv_172> AgradCdfGumbel_vv_172;
+typedef std::tuple<AgradCdfGumbel, type_vv_173> AgradCdfGumbel_vv_173;
+typedef std::tuple<AgradCdfGumbel, type_vv_174> AgradCdfGumbel_vv_174;
+typedef std::tuple<AgradCdfGumbel, type_vv_175> AgradCdfGumbel_vv_175;
+typedef std::tuple<AgradCdfGumbel, type_vv_176> AgradCdfGumbel_vv_176;
+typedef std::tuple<AgradCdfGumbel, type_vv_177> AgradCdfGumbel_vv_177;
+typedef std::tuple<AgradCdfGumbel, type_vv_178> AgradCdfGumbel_vv_178;
+typedef std::tuple<AgradCdfGumbel, type_vv_179> AgradCdfGumbel_vv_179;
+typedef std::tuple<AgradCdfGumbel, type_vv_180> AgradCdfGumbel_vv_180;
+typedef std::tuple<AgradCdfGumbel, type_vv_181> AgradCdfGumbel_vv_181;
+typedef std::tuple<AgradCdfGumbel, type_vv_182> AgradCdfGumbel_vv_182;
+typedef std::tuple<AgradCdfGumbel, type_vv_183> AgradCdfGumbel_vv_183;
+typedef std::tuple<AgradCdfGumbel, type_vv_184> AgradCdfGumbel_vv_184;
+typedef std::tuple<AgradCdfGumbel, type_vv_185> AgradCdfGumbel_vv_185;
+typedef std::tuple<AgradCdfGumbel, type_vv_186> AgradCdfGumbel_vv_186;
+typedef std::tuple<AgradCdfGumbel, type_vv_187> AgradCdfGumbel_vv_187;
+typedef std::tuple<AgradCdfGumbel, type_vv_188> AgradCdfGumbel_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_100, AgradCdfTestFixture, AgradCdfGumbel_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_101, AgradCdfTestFixture, AgradCdfGumbel_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_102, AgradCdfTestFixture, AgradCdfGumbel_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_103, AgradCdfTestFixture, AgradCdfGumbel_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_104, AgradCdfTestFixture, AgradCdfGumbel_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_105, AgradCdfTestFixture, AgradCdfGumbel_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_106, AgradCdfTestFixture, AgradCdfGumbel_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_107, AgradCdfTestFixture, AgradCdfGumbel_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_108, AgradCdfTestFixture, AgradCdfGumbel_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_109, AgradCdfTestFixture, AgradCdfGumbel_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_110, AgradCdfTestFixture, AgradCdfGumbel_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_111, AgradCdfTestFixture, AgradCdfGumbel_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_112, AgradCdfTestFixture, AgradCdfGumbel_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_113, AgradCdfTestFixture, AgradCdfGumbel_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_114, AgradCdfTestFixture, AgradCdfGumbel_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_115, AgradCdfTestFixture, AgradCdfGumbel_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_116, AgradCdfTestFixture, AgradCdfGumbel_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_117, AgradCdfTestFixture, AgradCdfGumbel_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_118, AgradCdfTestFixture, AgradCdfGumbel_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_119, AgradCdfTestFixture, AgradCdfGumbel_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_120, AgradCdfTestFixture, AgradCdfGumbel_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_121, AgradCdfTestFixture, AgradCdfGumbel_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_122, AgradCdfTestFixture, AgradCdfGumbel_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_123, AgradCdfTestFixture, AgradCdfGumbel_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_124, AgradCdfTestFixture, AgradCdfGumbel_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_125, AgradCdfTestFixture, AgradCdfGumbel_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_126, AgradCdfTestFixture, AgradCdfGumbel_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_127, AgradCdfTestFixture, AgradCdfGumbel_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_128, AgradCdfTestFixture, AgradCdfGumbel_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_129, AgradCdfTestFixture, AgradCdfGumbel_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_130, AgradCdfTestFixture, AgradCdfGumbel_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_131, AgradCdfTestFixture, AgradCdfGumbel_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_132, AgradCdfTestFixture, AgradCdfGumbel_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_133, AgradCdfTestFixture, AgradCdfGumbel_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_134, AgradCdfTestFixture, AgradCdfGumbel_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_135, AgradCdfTestFixture, AgradCdfGumbel_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_136, AgradCdfTestFixture, AgradCdfGumbel_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_137, AgradCdfTestFixture, AgradCdfGumbel_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_138, AgradCdfTestFixture, AgradCdfGumbel_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_139, AgradCdfTestFixture, AgradCdfGumbel_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_140, AgradCdfTestFixture, AgradCdfGumbel_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_141, AgradCdfTestFixture, AgradCdfGumbel_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_142, AgradCdfTestFixture, AgradCdfGumbel_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_143, AgradCdfTestFixture, AgradCdfGumbel_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_144, AgradCdfTestFixture, AgradCdfGumbel_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_145, AgradCdfTestFixture, AgradCdfGumbel_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_146, AgradCdfTestFixture, AgradCdfGumbel_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_147, AgradCdfTestFixture, AgradCdfGumbel_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_148, AgradCdfTestFixture, AgradCdfGumbel_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_149, AgradCdfTestFixture, AgradCdfGumbel_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_150, AgradCdfTestFixture, AgradCdfGumbel_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_151, AgradCdfTestFixture, AgradCdfGumbel_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_152, AgradCdfTestFixture, AgradCdfGumbel_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_153, AgradCdfTestFixture, AgradCdfGumbel_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_154, AgradCdfTestFixture, AgradCdfGumbel_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_155, AgradCdfTestFixture, AgradCdfGumbel_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_156, AgradCdfTestFixture, AgradCdfGumbel_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_157, AgradCdfTestFixture, AgradCdfGumbel_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_158, AgradCdfTestFixture, AgradCdfGumbel_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_159, AgradCdfTestFixture, AgradCdfGumbel_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_160, AgradCdfTestFixture, AgradCdfGumbel_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_161, AgradCdfTestFixture, AgradCdfGumbel_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_162, AgradCdfTestFixture, AgradCdfGumbel_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_163, AgradCdfTestFixture, AgradCdfGumbel_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_164, AgradCdfTestFixture, AgradCdfGumbel_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_165, AgradCdfTestFixture, AgradCdfGumbel_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_166, AgradCdfTestFixture, AgradCdfGumbel_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_167, AgradCdfTestFixture, AgradCdfGumbel_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_168, AgradCdfTestFixture, AgradCdfGumbel_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_169, AgradCdfTestFixture, AgradCdfGumbel_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_170, AgradCdfTestFixture, AgradCdfGumbel_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_171, AgradCdfTestFixture, AgradCdfGumbel_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_172, AgradCdfTestFixture, AgradCdfGumbel_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_173, AgradCdfTestFixture, AgradCdfGumbel_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_174, AgradCdfTestFixture, AgradCdfGumbel_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_175, AgradCdfTestFixture, AgradCdfGumbel_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_176, AgradCdfTestFixture, AgradCdfGumbel_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_177, AgradCdfTestFixture, AgradCdfGumbel_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_178, AgradCdfTestFixture, AgradCdfGumbel_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_179, AgradCdfTestFixture, AgradCdfGumbel_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_180, AgradCdfTestFixture, AgradCdfGumbel_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_181, AgradCdfTestFixture, AgradCdfGumbel_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_182, AgradCdfTestFixture, AgradCdfGumbel_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_183, AgradCdfTestFixture, AgradCdfGumbel_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_184, AgradCdfTestFixture, AgradCdfGumbel_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_185, AgradCdfTestFixture, AgradCdfGumbel_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_186, AgradCdfTestFixture, AgradCdfGumbel_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_187, AgradCdfTestFixture, AgradCdfGumbel_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfGumbel_vv_188, AgradCdfTestFixture, AgradCdfGumbel_vv_188);
+
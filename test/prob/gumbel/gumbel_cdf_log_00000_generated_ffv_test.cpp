@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_0> AgradCdfLogGumbel_ffv_0;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_1> AgradCdfLogGumbel_ffv_1;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_2> AgradCdfLogGumbel_ffv_2;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_3> AgradCdfLogGumbel_ffv_3;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_4> AgradCdfLogGumbel_ffv_4;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_5> AgradCdfLogGumbel_ffv_5;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_6> AgradCdfLogGumbel_ffv_6;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_7> AgradCdfLogGumbel_ffv_7;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_8> AgradCdfLogGumbel_ffv_8;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_9> AgradCdfLogGumbel_ffv_9;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_10> AgradCdfLogGumbel_ffv_10;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_11> AgradCdfLogGumbel_ffv_11;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_12> AgradCdfLogGumbel_ffv_12;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_13> AgradCdfLogGumbel_ffv_13;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_14> AgradCdfLogGumbel_ffv_14;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_15> AgradCdfLogGumbel_ffv_15;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_16> AgradCdfLogGumbel_ffv_16;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_17> AgradCdfLogGumbel_ffv_17;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_18> AgradCdfLogGumbel_ffv_18;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_19> AgradCdfLogGumbel_ffv_19;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_20> AgradCdfLogGumbel_ffv_20;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_21> AgradCdfLogGumbel_ffv_21;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_22> AgradCdfLogGumbel_ffv_22;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_23> AgradCdfLogGumbel_ffv_23;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_24> AgradCdfLogGumbel_ffv_24;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_25> AgradCdfLogGumbel_ffv_25;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_26> AgradCdfLogGumbel_ffv_26;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_27> AgradCdfLogGumbel_ffv_27;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_28> AgradCdfLogGumbel_ffv_28;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_29> AgradCdfLogGumbel_ffv_29;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_30> AgradCdfLogGumbel_ffv_30;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_31> AgradCdfLogGumbel_ffv_31;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_32> AgradCdfLogGumbel_ffv_32;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_33> AgradCdfLogGumbel_ffv_33;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_34> AgradCdfLogGumbel_ffv_34;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_35> AgradCdfLogGumbel_ffv_35;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_36> AgradCdfLogGumbel_ffv_36;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_37> AgradCdfLogGumbel_ffv_37;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_38> AgradCdfLogGumbel_ffv_38;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_39> AgradCdfLogGumbel_ffv_39;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_40> AgradCdfLogGumbel_ffv_40;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_41> AgradCdfLogGumbel_ffv_41;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_42> AgradCdfLogGumbel_ffv_42;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_43> AgradCdfLogGumbel_ffv_43;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_44> AgradCdfLogGumbel_ffv_44;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_45> AgradCdfLogGumbel_ffv_45;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_46> AgradCdfLogGumbel_ffv_46;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_47> AgradCdfLogGumbel_ffv_47;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_48> AgradCdfLogGumbel_ffv_48;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_49> AgradCdfLogGumbel_ffv_49;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_50> AgradCdfLogGumbel_ffv_50;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_51> AgradCdfLogGumbel_ffv_51;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_52> AgradCdfLogGumbel_ffv_52;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_53> AgradCdfLogGumbel_ffv_53;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_54> AgradCdfLogGumbel_ffv_54;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_55> AgradCdfLogGumbel_ffv_55;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_56> AgradCdfLogGumbel_ffv_56;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_57> AgradCdfLogGumbel_ffv_57;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_58> AgradCdfLogGumbel_ffv_58;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_59> AgradCdfLogGumbel_ffv_59;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_60> AgradCdfLogGumbel_ffv_60;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_61> AgradCdfLogGumbel_ffv_61;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_62> AgradCdfLogGumbel_ffv_62;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_63> AgradCdfLogGumbel_ffv_63;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_64> AgradCdfLogGumbel_ffv_64;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_65> AgradCdfLogGumbel_ffv_65;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_66> AgradCdfLogGumbel_ffv_66;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_67> AgradCdfLogGumbel_ffv_67;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_68> AgradCdfLogGumbel_ffv_68;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_69> AgradCdfLogGumbel_ffv_69;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_70> AgradCdfLogGumbel_ffv_70;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_71> AgradCdfLogGumbel_ffv_71;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_72> AgradCdfLogGumbel_ffv_72;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_73> AgradCdfLogGumbel_ffv_73;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_74> AgradCdfLogGumbel_ffv_74;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_75> AgradCdfLogGumbel_ffv_75;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_76> AgradCdfLogGumbel_ffv_76;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_77> AgradCdfLogGumbel_ffv_77;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_78> AgradCdfLogGumbel_ffv_78;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_79> AgradCdfLogGumbel_ffv_79;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_80> AgradCdfLogGumbel_ffv_80;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_81> AgradCdfLogGumbel_ffv_81;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_82> AgradCdfLogGumbel_ffv_82;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_83> AgradCdfLogGumbel_ffv_83;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_84> AgradCdfLogGumbel_ffv_84;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_85> AgradCdfLogGumbel_ffv_85;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_86> AgradCdfLogGumbel_ffv_86;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_87> AgradCdfLogGumbel_ffv_87;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_88> AgradCdfLogGumbel_ffv_88;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_89> AgradCdfLogGumbel_ffv_89;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_90> AgradCdfLogGumbel_ffv_90;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_91> AgradCdfLogGumbel_ffv_91;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_92> AgradCdfLogGumbel_ffv_92;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_93> AgradCdfLogGumbel_ffv_93;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_94> AgradCdfLogGumbel_ffv_94;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_95> AgradCdfLogGumbel_ffv_95;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_96> AgradCdfLogGumbel_ffv_96;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_97> AgradCdfLogGumbel_ffv_97;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_98> AgradCdfLogGumbel_ffv_98;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_99> AgradCdfLogGumbel_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_0, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_1, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_2, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_3, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_4, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_5, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_6, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_7, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_8, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_9, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_10, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_11, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_12, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_13, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_14, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_15, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_16, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_17, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_18, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_19, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_20, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_21, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_22, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_23, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_24, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_25, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_26, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_27, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_28, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_29, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_30, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_31, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_32, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_33, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_34, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_35, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_36, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_37, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_38, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_39, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_40, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_41, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_42, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_43, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_44, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_45, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_46, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_47, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_48, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_49, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_50, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_51, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_52, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_53, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_54, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_55, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_56, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_57, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_58, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_59, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_60, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_61, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_62, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_63, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_64, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_65, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_66, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_67, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_68, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_69, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_70, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_71, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_72, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_73, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_74, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_75, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_76, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_77, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_78, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_79, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_80, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_81, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_82, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_83, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_84, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_85, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_86, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_87, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_88, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_89, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_90, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_91, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_92, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_93, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_94, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_95, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_96, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_97, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_98, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_99, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogGumbel, type_v_0> AgradCdfLogGumbel_v_0;
+typedef std::tuple<AgradCdfLogGumbel, type_v_1> AgradCdfLogGumbel_v_1;
+typedef std::tuple<AgradCdfLogGumbel, type_v_2> AgradCdfLogGumbel_v_2;
+typedef std::tuple<AgradCdfLogGumbel, type_v_3> AgradCdfLogGumbel_v_3;
+typedef std::tuple<AgradCdfLogGumbel, type_v_4> AgradCdfLogGumbel_v_4;
+typedef std::tuple<AgradCdfLogGumbel, type_v_5> AgradCdfLogGumbel_v_5;
+typedef std::tuple<AgradCdfLogGumbel, type_v_6> AgradCdfLogGumbel_v_6;
+typedef std::tuple<AgradCdfLogGumbel, type_v_7> AgradCdfLogGumbel_v_7;
+typedef std::tuple<AgradCdfLogGumbel, type_v_8> AgradCdfLogGumbel_v_8;
+typedef std::tuple<AgradCdfLogGumbel, type_v_9> AgradCdfLogGumbel_v_9;
+typedef std::tuple<AgradCdfLogGumbel, type_v_10> AgradCdfLogGumbel_v_10;
+typedef std::tuple<AgradCdfLogGumbel, type_v_11> AgradCdfLogGumbel_v_11;
+typedef std::tuple<AgradCdfLogGumbel, type_v_12> AgradCdfLogGumbel_v_12;
+typedef std::tuple<AgradCdfLogGumbel, type_v_13> AgradCdfLogGumbel_v_13;
+typedef std::tuple<AgradCdfLogGumbel, type_v_14> AgradCdfLogGumbel_v_14;
+typedef std::tuple<AgradCdfLogGumbel, type_v_15> AgradCdfLogGumbel_v_15;
+typedef std::tuple<AgradCdfLogGumbel, type_v_16> AgradCdfLogGumbel_v_16;
+typedef std::tuple<AgradCdfLogGumbel, type_v_17> AgradCdfLogGumbel_v_17;
+typedef std::tuple<AgradCdfLogGumbel, type_v_18> AgradCdfLogGumbel_v_18;
+typedef std::tuple<AgradCdfLogGumbel, type_v_19> AgradCdfLogGumbel_v_19;
+typedef std::tuple<AgradCdfLogGumbel, type_v_20> AgradCdfLogGumbel_v_20;
+typedef std::tuple<AgradCdfLogGumbel, type_v_21> AgradCdfLogGumbel_v_21;
+typedef std::tuple<AgradCdfLogGumbel, type_v_22> AgradCdfLogGumbel_v_22;
+typedef std::tuple<AgradCdfLogGumbel, type_v_23> AgradCdfLogGumbel_v_23;
+typedef std::tuple<AgradCdfLogGumbel, type_v_24> AgradCdfLogGumbel_v_24;
+typedef std::tuple<AgradCdfLogGumbel, type_v_25> AgradCdfLogGumbel_v_25;
+typedef std::tuple<AgradCdfLogGumbel, type_v_26> AgradCdfLogGumbel_v_26;
+typedef std::tuple<AgradCdfLogGumbel, type_v_27> AgradCdfLogGumbel_v_27;
+typedef std::tuple<AgradCdfLogGumbel, type_v_28> AgradCdfLogGumbel_v_28;
+typedef std::tuple<AgradCdfLogGumbel, type_v_29> AgradCdfLogGumbel_v_29;
+typedef std::tuple<AgradCdfLogGumbel, type_v_30> AgradCdfLogGumbel_v_30;
+typedef std::tuple<AgradCdfLogGumbel, type_v_31> AgradCdfLogGumbel_v_31;
+typedef std::tuple<AgradCdfLogGumbel, type_v_32> AgradCdfLogGumbel_v_32;
+typedef std::tuple<AgradCdfLogGumbel, type_v_33> AgradCdfLogGumbel_v_33;
+typedef std::tuple<AgradCdfLogGumbel, type_v_34> AgradCdfLogGumbel_v_34;
+typedef std::tuple<AgradCdfLogGumbel, type_v_35> AgradCdfLogGumbel_v_35;
+typedef std::tuple<AgradCdfLogGumbel, type_v_36> AgradCdfLogGumbel_v_36;
+typedef std::tuple<AgradCdfLogGumbel, type_v_37> AgradCdfLogGumbel_v_37;
+typedef std::tuple<AgradCdfLogGumbel, type_v_38> AgradCdfLogGumbel_v_38;
+typedef std::tuple<AgradCdfLogGumbel, type_v_39> AgradCdfLogGumbel_v_39;
+typedef std::tuple<AgradCdfLogGumbel, type_v_40> AgradCdfLogGumbel_v_40;
+typedef std::tuple<AgradCdfLogGumbel, type_v_41> AgradCdfLogGumbel_v_41;
+typedef std::tuple<AgradCdfLogGumbel, type_v_42> AgradCdfLogGumbel_v_42;
+typedef std::tuple<AgradCdfLogGumbel, type_v_43> AgradCdfLogGumbel_v_43;
+typedef std::tuple<AgradCdfLogGumbel, type_v_44> AgradCdfLogGumbel_v_44;
+typedef std::tuple<AgradCdfLogGumbel, type_v_45> AgradCdfLogGumbel_v_45;
+typedef std::tuple<AgradCdfLogGumbel, type_v_46> AgradCdfLogGumbel_v_46;
+typedef std::tuple<AgradCdfLogGumbel, type_v_47> AgradCdfLogGumbel_v_47;
+typedef std::tuple<AgradCdfLogGumbel, type_v_48> AgradCdfLogGumbel_v_48;
+typedef std::tuple<AgradCdfLogGumbel, type_v_49> AgradCdfLogGumbel_v_49;
+typedef std::tuple<AgradCdfLogGumbel, type_v_50> AgradCdfLogGumbel_v_50;
+typedef std::tuple<AgradCdfLogGumbel, type_v_51> AgradCdfLogGumbel_v_51;
+typedef std::tuple<AgradCdfLogGumbel, type_v_52> AgradCdfLogGumbel_v_52;
+typedef std::tuple<AgradCdfLogGumbel, type_v_53> AgradCdfLogGumbel_v_53;
+typedef std::tuple<AgradCdfLogGumbel, type_v_54> AgradCdfLogGumbel_v_54;
+typedef std::tuple<AgradCdfLogGumbel, type_v_55> AgradCdfLogGumbel_v_55;
+typedef std::tuple<AgradCdfLogGumbel, type_v_56> AgradCdfLogGumbel_v_56;
+typedef std::tuple<AgradCdfLogGumbel, type_v_57> AgradCdfLogGumbel_v_57;
+typedef std::tuple<AgradCdfLogGumbel, type_v_58> AgradCdfLogGumbel_v_58;
+typedef std::tuple<AgradCdfLogGumbel, type_v_59> AgradCdfLogGumbel_v_59;
+typedef std::tuple<AgradCdfLogGumbel, type_v_60> AgradCdfLogGumbel_v_60;
+typedef std::tuple<AgradCdfLogGumbel, type_v_61> AgradCdfLogGumbel_v_61;
+typedef std::tuple<AgradCdfLogGumbel, type_v_62> AgradCdfLogGumbel_v_62;
+typedef std::tuple<AgradCdfLogGumbel, type_v_63> AgradCdfLogGumbel_v_63;
+typedef std::tuple<AgradCdfLogGumbel, type_v_64> AgradCdfLogGumbel_v_64;
+typedef std::tuple<AgradCdfLogGumbel, type_v_65> AgradCdfLogGumbel_v_65;
+typedef std::tuple<AgradCdfLogGumbel, type_v_66> AgradCdfLogGumbel_v_66;
+typedef std::tuple<AgradCdfLogGumbel, type_v_67> AgradCdfLogGumbel_v_67;
+typedef std::tuple<AgradCdfLogGumbel, type_v_68> AgradCdfLogGumbel_v_68;
+typedef std::tuple<AgradCdfLogGumbel, type_v_69> AgradCdfLogGumbel_v_69;
+typedef std::tuple<AgradCdfLogGumbel, type_v_70> AgradCdfLogGumbel_v_70;
+typedef std::tuple<AgradCdfLogGumbel, type_v_71> AgradCdfLogGumbel_v_71;
+typedef std::tuple<AgradCdfLogGumbel, type_v_72> AgradCdfLogGumbel_v_72;
+typedef std::tuple<AgradCdfLogGumbel, type_v_73> AgradCdfLogGumbel_v_73;
+typedef std::tuple<AgradCdfLogGumbel, type_v_74> AgradCdfLogGumbel_v_74;
+typedef std::tuple<AgradCdfLogGumbel, type_v_75> AgradCdfLogGumbel_v_75;
+typedef std::tuple<AgradCdfLogGumbel, type_v_76> AgradCdfLogGumbel_v_76;
+typedef std::tuple<AgradCdfLogGumbel, type_v_77> AgradCdfLogGumbel_v_77;
+typedef std::tuple<AgradCdfLogGumbel, type_v_78> AgradCdfLogGumbel_v_78;
+typedef std::tuple<AgradCdfLogGumbel, type_v_79> AgradCdfLogGumbel_v_79;
+typedef std::tuple<AgradCdfLogGumbel, type_v_80> AgradCdfLogGumbel_v_80;
+typedef std::tuple<AgradCdfLogGumbel, type_v_81> AgradCdfLogGumbel_v_81;
+typedef std::tuple<AgradCdfLogGumbel, type_v_82> AgradCdfLogGumbel_v_82;
+typedef std::tuple<AgradCdfLogGumbel, type_v_83> AgradCdfLogGumbel_v_83;
+typedef std::tuple<AgradCdfLogGumbel, type_v_84> AgradCdfLogGumbel_v_84;
+typedef std::tuple<AgradCdfLogGumbel, type_v_85> AgradCdfLogGumbel_v_85;
+typedef std::tuple<AgradCdfLogGumbel, type_v_86> AgradCdfLogGumbel_v_86;
+typedef std::tuple<AgradCdfLogGumbel, type_v_87> AgradCdfLogGumbel_v_87;
+typedef std::tuple<AgradCdfLogGumbel, type_v_88> AgradCdfLogGumbel_v_88;
+typedef std::tuple<AgradCdfLogGumbel, type_v_89> AgradCdfLogGumbel_v_89;
+typedef std::tuple<AgradCdfLogGumbel, type_v_90> AgradCdfLogGumbel_v_90;
+typedef std::tuple<AgradCdfLogGumbel, type_v_91> AgradCdfLogGumbel_v_91;
+typedef std::tuple<AgradCdfLogGumbel, type_v_92> AgradCdfLogGumbel_v_92;
+typedef std::tuple<AgradCdfLogGumbel, type_v_93> AgradCdfLogGumbel_v_93;
+typedef std::tuple<AgradCdfLogGumbel, type_v_94> AgradCdfLogGumbel_v_94;
+typedef std::tuple<AgradCdfLogGumbel, type_v_95> AgradCdfLogGumbel_v_95;
+typedef std::tuple<AgradCdfLogGumbel, type_v_96> AgradCdfLogGumbel_v_96;
+typedef std::tuple<AgradCdfLogGumbel, type_v_97> AgradCdfLogGumbel_v_97;
+typedef std::tuple<AgradCdfLogGumbel, type_v_98> AgradCdfLogGumbel_v_98;
+typedef std::tuple<AgradCdfLogGumbel, type_v_99> AgradCdfLogGumbel_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_0, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_1, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_2, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_3, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_4, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_5, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_6, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_7, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_8, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_9, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_10, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_11, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_12, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_13, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_14, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_15, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_16, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_17, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_18, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_19, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_20, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_21, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_22, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_23, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_24, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_25, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_26, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_27, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_28, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_29, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_30, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_31, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_32, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_33, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_34, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_35, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_36, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_37, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_38, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_39, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_40, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_41, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_42, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_43, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_44, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_45, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_46, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_47, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_48, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_49, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_50, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_51, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_52, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_53, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_54, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_55, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_56, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_57, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_58, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_59, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_60, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_61, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_62, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_63, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_64, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_65, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_66, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_67, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_68, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_69, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_70, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_71, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_72, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_73, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_74, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_75, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_76, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_77, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_78, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_79, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_80, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_81, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_82, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_83, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_84, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_85, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_86, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_87, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_88, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_89, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_90, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_91, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_92, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_93, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_94, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_95, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_96, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_97, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_98, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_99, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_99);
+
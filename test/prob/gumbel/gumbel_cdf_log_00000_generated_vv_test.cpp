@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogGumbel, type_vv_0> AgradCdfLogGumbel_vv_0;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_1> AgradCdfLogGumbel_vv_1;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_2> AgradCdfLogGumbel_vv_2;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_3> AgradCdfLogGumbel_vv_3;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_4> AgradCdfLogGumbel_vv_4;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_5> AgradCdfLogGumbel_vv_5;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_6> AgradCdfLogGumbel_vv_6;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_7> AgradCdfLogGumbel_vv_7;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_8> AgradCdfLogGumbel_vv_8;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_9> AgradCdfLogGumbel_vv_9;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_10> AgradCdfLogGumbel_vv_10;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_11> AgradCdfLogGumbel_vv_11;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_12> AgradCdfLogGumbel_vv_12;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_13> AgradCdfLogGumbel_vv_13;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_14> AgradCdfLogGumbel_vv_14;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_15> AgradCdfLogGumbel_vv_15;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_16> AgradCdfLogGumbel_vv_16;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_17> AgradCdfLogGumbel_vv_17;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_18> AgradCdfLogGumbel_vv_18;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_19> AgradCdfLogGumbel_vv_19;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_20> AgradCdfLogGumbel_vv_20;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_21> AgradCdfLogGumbel_vv_21;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_22> AgradCdfLogGumbel_vv_22;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_23> AgradCdfLogGumbel_vv_23;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_24> AgradCdfLogGumbel_vv_24;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_25> AgradCdfLogGumbel_vv_25;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_26> AgradCdfLogGumbel_vv_26;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_27> AgradCdfLogGumbel_vv_27;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_28> AgradCdfLogGumbel_vv_28;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_29> AgradCdfLogGumbel_vv_29;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_30> AgradCdfLogGumbel_vv_30;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_31> AgradCdfLogGumbel_vv_31;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_32> AgradCdfLogGumbel_vv_32;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_33> AgradCdfLogGumbel_vv_33;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_34> AgradCdfLogGumbel_vv_34;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_35> AgradCdfLogGumbel_vv_35;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_36> AgradCdfLogGumbel_vv_36;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_37> AgradCdfLogGumbel_vv_37;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_38> AgradCdfLogGumbel_vv_38;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_39> AgradCdfLogGumbel_vv_39;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_40> AgradCdfLogGumbel_vv_40;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_41> AgradCdfLogGumbel_vv_41;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_42> AgradCdfLogGumbel_vv_42;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_43> AgradCdfLogGumbel_vv_43;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_44> AgradCdfLogGumbel_vv_44;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_45> AgradCdfLogGumbel_vv_45;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_46> AgradCdfLogGumbel_vv_46;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_47> AgradCdfLogGumbel_vv_47;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_48> AgradCdfLogGumbel_vv_48;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_49> AgradCdfLogGumbel_vv_49;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_50> AgradCdfLogGumbel_vv_50;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_51> AgradCdfLogGumbel_vv_51;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_52> AgradCdfLogGumbel_vv_52;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_53> AgradCdfLogGumbel_vv_53;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_54> AgradCdfLogGumbel_vv_54;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_55> AgradCdfLogGumbel_vv_55;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_56> AgradCdfLogGumbel_vv_56;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_57> AgradCdfLogGumbel_vv_57;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_58> AgradCdfLogGumbel_vv_58;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_59> AgradCdfLogGumbel_vv_59;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_60> AgradCdfLogGumbel_vv_60;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_61> AgradCdfLogGumbel_vv_61;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_62> AgradCdfLogGumbel_vv_62;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_63> AgradCdfLogGumbel_vv_63;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_64> AgradCdfLogGumbel_vv_64;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_65> AgradCdfLogGumbel_vv_65;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_66> AgradCdfLogGumbel_vv_66;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_67> AgradCdfLogGumbel_vv_67;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_68> AgradCdfLogGumbel_vv_68;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_69> AgradCdfLogGumbel_vv_69;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_70> AgradCdfLogGumbel_vv_70;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_71> AgradCdfLogGumbel_vv_71;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_72> AgradCdfLogGumbel_vv_72;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_73> AgradCdfLogGumbel_vv_73;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_74> AgradCdfLogGumbel_vv_74;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_75> AgradCdfLogGumbel_vv_75;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_76> AgradCdfLogGumbel_vv_76;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_77> AgradCdfLogGumbel_vv_77;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_78> AgradCdfLogGumbel_vv_78;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_79> AgradCdfLogGumbel_vv_79;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_80> AgradCdfLogGumbel_vv_80;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_81> AgradCdfLogGumbel_vv_81;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_82> AgradCdfLogGumbel_vv_82;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_83> AgradCdfLogGumbel_vv_83;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_84> AgradCdfLogGumbel_vv_84;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_85> AgradCdfLogGumbel_vv_85;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_86> AgradCdfLogGumbel_vv_86;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_87> AgradCdfLogGumbel_vv_87;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_88> AgradCdfLogGumbel_vv_88;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_89> AgradCdfLogGumbel_vv_89;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_90> AgradCdfLogGumbel_vv_90;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_91> AgradCdfLogGumbel_vv_91;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_92> AgradCdfLogGumbel_vv_92;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_93> AgradCdfLogGumbel_vv_93;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_94> AgradCdfLogGumbel_vv_94;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_95> AgradCdfLogGumbel_vv_95;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_96> AgradCdfLogGumbel_vv_96;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_97> AgradCdfLogGumbel_vv_97;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_98> AgradCdfLogGumbel_vv_98;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_99> AgradCdfLogGumbel_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_0, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_1, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_2, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_3, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_4, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_5, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_6, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_7, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_8, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_9, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_10, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_11, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_12, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_13, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_14, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_15, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_16, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_17, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_18, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_19, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_20, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_21, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_22, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_23, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_24, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_25, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_26, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_27, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_28, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_29, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_30, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_31, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_32, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_33, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_34, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_35, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_36, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_37, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_38, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_39, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_40, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_41, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_42, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_43, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_44, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_45, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_46, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_47, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_48, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_49, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_50, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_51, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_52, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_53, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_54, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_55, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_56, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_57, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_58, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_59, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_60, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_61, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_62, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_63, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_64, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_65, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_66, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_67, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_68, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_69, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_70, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_71, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_72, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_73, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_74, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_75, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_76, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_77, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_78, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_79, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_80, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_81, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_82, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_83, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_84, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_85, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_86, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_87, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_88, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_89, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_90, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_91, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_92, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_93, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_94, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_95, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_96, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_97, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_98, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_99, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_99);
+
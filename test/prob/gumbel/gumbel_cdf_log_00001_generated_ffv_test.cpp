@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_100> AgradCdfLogGumbel_ffv_100;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_101> AgradCdfLogGumbel_ffv_101;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_102> AgradCdfLogGumbel_ffv_102;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_103> AgradCdfLogGumbel_ffv_103;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_104> AgradCdfLogGumbel_ffv_104;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_105> AgradCdfLogGumbel_ffv_105;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_106> AgradCdfLogGumbel_ffv_106;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_107> AgradCdfLogGumbel_ffv_107;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_108> AgradCdfLogGumbel_ffv_108;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_109> AgradCdfLogGumbel_ffv_109;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_110> AgradCdfLogGumbel_ffv_110;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_111> AgradCdfLogGumbel_ffv_111;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_112> AgradCdfLogGumbel_ffv_112;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_113> AgradCdfLogGumbel_ffv_113;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_114> AgradCdfLogGumbel_ffv_114;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_115> AgradCdfLogGumbel_ffv_115;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_116> AgradCdfLogGumbel_ffv_116;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_117> AgradCdfLogGumbel_ffv_117;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_118> AgradCdfLogGumbel_ffv_118;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_119> AgradCdfLogGumbel_ffv_119;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_120> AgradCdfLogGumbel_ffv_120;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_121> AgradCdfLogGumbel_ffv_121;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_122> AgradCdfLogGumbel_ffv_122;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_123> AgradCdfLogGumbel_ffv_123;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_124> AgradCdfLogGumbel_ffv_124;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_125> AgradCdfLogGumbel_ffv_125;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_126> AgradCdfLogGumbel_ffv_126;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_127> AgradCdfLogGumbel_ffv_127;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_128> AgradCdfLogGumbel_ffv_128;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_129> AgradCdfLogGumbel_ffv_129;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_130> AgradCdfLogGumbel_ffv_130;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_131> AgradCdfLogGumbel_ffv_131;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_132> AgradCdfLogGumbel_ffv_132;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_133> AgradCdfLogGumbel_ffv_133;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_134> AgradCdfLogGumbel_ffv_134;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_135> AgradCdfLogGumbel_ffv_135;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_136> AgradCdfLogGumbel_ffv_136;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_137> AgradCdfLogGumbel_ffv_137;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_138> AgradCdfLogGumbel_ffv_138;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_139> AgradCdfLogGumbel_ffv_139;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_140> AgradCdfLogGumbel_ffv_140;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_141> AgradCdfLogGumbel_ffv_141;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_142> AgradCdfLogGumbel_ffv_142;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_143> AgradCdfLogGumbel_ffv_143;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_144> AgradCdfLogGumbel_ffv_144;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_145> AgradCdfLogGumbel_ffv_145;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_146> AgradCdfLogGumbel_ffv_146;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_147> AgradCdfLogGumbel_ffv_147;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_148> AgradCdfLogGumbel_ffv_148;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_149> AgradCdfLogGumbel_ffv_149;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_150> AgradCdfLogGumbel_ffv_150;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_151> AgradCdfLogGumbel_ffv_151;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_152> AgradCdfLogGumbel_ffv_152;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_153> AgradCdfLogGumbel_ffv_153;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_154> AgradCdfLogGumbel_ffv_154;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_155> AgradCdfLogGumbel_ffv_155;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_156> AgradCdfLogGumbel_ffv_156;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_157> AgradCdfLogGumbel_ffv_157;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_158> AgradCdfLogGumbel_ffv_158;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_159> AgradCdfLogGumbel_ffv_159;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_160> AgradCdfLogGumbel_ffv_160;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_161> AgradCdfLogGumbel_ffv_161;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_162> AgradCdfLogGumbel_ffv_162;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_163> AgradCdfLogGumbel_ffv_163;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_164> AgradCdfLogGumbel_ffv_164;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_165> AgradCdfLogGumbel_ffv_165;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_166> AgradCdfLogGumbel_ffv_166;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_167> AgradCdfLogGumbel_ffv_167;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_168> AgradCdfLogGumbel_ffv_168;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_169> AgradCdfLogGumbel_ffv_169;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_170> AgradCdfLogGumbel_ffv_170;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_171> AgradCdfLogGumbel_ffv_171;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_172> AgradCdfLogGumbel_ffv_172;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_173> AgradCdfLogGumbel_ffv_173;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_174> AgradCdfLogGumbel_ffv_174;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_175> AgradCdfLogGumbel_ffv_175;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_176> AgradCdfLogGumbel_ffv_176;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_177> AgradCdfLogGumbel_ffv_177;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_178> AgradCdfLogGumbel_ffv_178;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_179> AgradCdfLogGumbel_ffv_179;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_180> AgradCdfLogGumbel_ffv_180;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_181> AgradCdfLogGumbel_ffv_181;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_182> AgradCdfLogGumbel_ffv_182;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_183> AgradCdfLogGumbel_ffv_183;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_184> AgradCdfLogGumbel_ffv_184;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_185> AgradCdfLogGumbel_ffv_185;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_186> AgradCdfLogGumbel_ffv_186;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_187> AgradCdfLogGumbel_ffv_187;
+typedef std::tuple<AgradCdfLogGumbel, type_ffv_188> AgradCdfLogGumbel_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_100, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_101, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_102, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_103, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_104, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_105, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_106, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_107, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_108, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_109, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_110, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_111, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_112, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_113, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_114, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_115, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_116, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_117, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_118, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_119, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_120, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_121, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_122, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_123, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_124, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_125, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_126, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_127, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_128, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_129, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_130, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_131, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_132, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_133, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_134, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_135, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_136, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_137, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_138, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_139, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_140, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_141, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_142, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_143, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_144, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_145, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_146, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_147, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_148, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_149, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_150, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_151, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_152, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_153, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_154, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_155, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_156, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_157, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_158, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_159, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_160, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_161, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_162, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_163, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_164, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_165, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_166, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_167, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_168, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_169, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_170, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_171, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_172, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_173, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_174, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_175, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_176, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_177, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_178, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_179, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_180, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_181, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_182, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_183, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_184, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_185, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_186, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_187, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_ffv_188, AgradCdfLogTestFixture, AgradCdfLogGumbel_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogGumbel, type_v_100> AgradCdfLogGumbel_v_100;
+typedef std::tuple<AgradCdfLogGumbel, type_v_101> AgradCdfLogGumbel_v_101;
+typedef std::tuple<AgradCdfLogGumbel, type_v_102> AgradCdfLogGumbel_v_102;
+typedef std::tuple<AgradCdfLogGumbel, type_v_103> AgradCdfLogGumbel_v_103;
+typedef std::tuple<AgradCdfLogGumbel, type_v_104> AgradCdfLogGumbel_v_104;
+typedef std::tuple<AgradCdfLogGumbel, type_v_105> AgradCdfLogGumbel_v_105;
+typedef std::tuple<AgradCdfLogGumbel, type_v_106> AgradCdfLogGumbel_v_106;
+typedef std::tuple<AgradCdfLogGumbel, type_v_107> AgradCdfLogGumbel_v_107;
+typedef std::tuple<AgradCdfLogGumbel, type_v_108> AgradCdfLogGumbel_v_108;
+typedef std::tuple<AgradCdfLogGumbel, type_v_109> AgradCdfLogGumbel_v_109;
+typedef std::tuple<AgradCdfLogGumbel, type_v_110> AgradCdfLogGumbel_v_110;
+typedef std::tuple<AgradCdfLogGumbel, type_v_111> AgradCdfLogGumbel_v_111;
+typedef std::tuple<AgradCdfLogGumbel, type_v_112> AgradCdfLogGumbel_v_112;
+typedef std::tuple<AgradCdfLogGumbel, type_v_113> AgradCdfLogGumbel_v_113;
+typedef std::tuple<AgradCdfLogGumbel, type_v_114> AgradCdfLogGumbel_v_114;
+typedef std::tuple<AgradCdfLogGumbel, type_v_115> AgradCdfLogGumbel_v_115;
+typedef std::tuple<AgradCdfLogGumbel, type_v_116> AgradCdfLogGumbel_v_116;
+typedef std::tuple<AgradCdfLogGumbel, type_v_117> AgradCdfLogGumbel_v_117;
+typedef std::tuple<AgradCdfLogGumbel, type_v_118> AgradCdfLogGumbel_v_118;
+typedef std::tuple<AgradCdfLogGumbel, type_v_119> AgradCdfLogGumbel_v_119;
+typedef std::tuple<AgradCdfLogGumbel, type_v_120> AgradCdfLogGumbel_v_120;
+typedef std::tuple<AgradCdfLogGumbel, type_v_121> AgradCdfLogGumbel_v_121;
+typedef std::tuple<AgradCdfLogGumbel, type_v_122> AgradCdfLogGumbel_v_122;
+typedef std::tuple<AgradCdfLogGumbel, type_v_123> AgradCdfLogGumbel_v_123;
+typedef std::tuple<AgradCdfLogGumbel, type_v_124> AgradCdfLogGumbel_v_124;
+typedef std::tuple<AgradCdfLogGumbel, type_v_125> AgradCdfLogGumbel_v_125;
+typedef std::tuple<AgradCdfLogGumbel, type_v_126> AgradCdfLogGumbel_v_126;
+typedef std::tuple<AgradCdfLogGumbel, type_v_127> AgradCdfLogGumbel_v_127;
+typedef std::tuple<AgradCdfLogGumbel, type_v_128> AgradCdfLogGumbel_v_128;
+typedef std::tuple<AgradCdfLogGumbel, type_v_129> AgradCdfLogGumbel_v_129;
+typedef std::tuple<AgradCdfLogGumbel, type_v_130> AgradCdfLogGumbel_v_130;
+typedef std::tuple<AgradCdfLogGumbel, type_v_131> AgradCdfLogGumbel_v_131;
+typedef std::tuple<AgradCdfLogGumbel, type_v_132> AgradCdfLogGumbel_v_132;
+typedef std::tuple<AgradCdfLogGumbel, type_v_133> AgradCdfLogGumbel_v_133;
+typedef std::tuple<AgradCdfLogGumbel, type_v_134> AgradCdfLogGumbel_v_134;
+typedef std::tuple<AgradCdfLogGumbel, type_v_135> AgradCdfLogGumbel_v_135;
+typedef std::tuple<AgradCdfLogGumbel, type_v_136> AgradCdfLogGumbel_v_136;
+typedef std::tuple<AgradCdfLogGumbel, type_v_137> AgradCdfLogGumbel_v_137;
+typedef std::tuple<AgradCdfLogGumbel, type_v_138> AgradCdfLogGumbel_v_138;
+typedef std::tuple<AgradCdfLogGumbel, type_v_139> AgradCdfLogGumbel_v_139;
+typedef std::tuple<AgradCdfLogGumbel, type_v_140> AgradCdfLogGumbel_v_140;
+typedef std::tuple<AgradCdfLogGumbel, type_v_141> AgradCdfLogGumbel_v_141;
+typedef std::tuple<AgradCdfLogGumbel, type_v_142> AgradCdfLogGumbel_v_142;
+typedef std::tuple<AgradCdfLogGumbel, type_v_143> AgradCdfLogGumbel_v_143;
+typedef std::tuple<AgradCdfLogGumbel, type_v_144> AgradCdfLogGumbel_v_144;
+typedef std::tuple<AgradCdfLogGumbel, type_v_145> AgradCdfLogGumbel_v_145;
+typedef std::tuple<AgradCdfLogGumbel, type_v_146> AgradCdfLogGumbel_v_146;
+typedef std::tuple<AgradCdfLogGumbel, type_v_147> AgradCdfLogGumbel_v_147;
+typedef std::tuple<AgradCdfLogGumbel, type_v_148> AgradCdfLogGumbel_v_148;
+typedef std::tuple<AgradCdfLogGumbel, type_v_149> AgradCdfLogGumbel_v_149;
+typedef std::tuple<AgradCdfLogGumbel, type_v_150> AgradCdfLogGumbel_v_150;
+typedef std::tuple<AgradCdfLogGumbel, type_v_151> AgradCdfLogGumbel_v_151;
+typedef std::tuple<AgradCdfLogGumbel, type_v_152> AgradCdfLogGumbel_v_152;
+typedef std::tuple<AgradCdfLogGumbel, type_v_153> AgradCdfLogGumbel_v_153;
+typedef std::tuple<AgradCdfLogGumbel, type_v_154> AgradCdfLogGumbel_v_154;
+typedef std::tuple<AgradCdfLogGumbel, type_v_155> AgradCdfLogGumbel_v_155;
+typedef std::tuple<AgradCdfLogGumbel, type_v_156> AgradCdfLogGumbel_v_156;
+typedef std::tuple<AgradCdfLogGumbel, type_v_157> AgradCdfLogGumbel_v_157;
+typedef std::tuple<AgradCdfLogGumbel, type_v_158> AgradCdfLogGumbel_v_158;
+typedef std::tuple<AgradCdfLogGumbel, type_v_159> AgradCdfLogGumbel_v_159;
+typedef std::tuple<AgradCdfLogGumbel, type_v_160> AgradCdfLogGumbel_v_160;
+typedef std::tuple<AgradCdfLogGumbel, type_v_161> AgradCdfLogGumbel_v_161;
+typedef std::tuple<AgradCdfLogGumbel, type_v_162> AgradCdfLogGumbel_v_162;
+typedef std::tuple<AgradCdfLogGumbel, type_v_163> AgradCdfLogGumbel_v_163;
+typedef std::tuple<AgradCdfLogGumbel, type_v_164> AgradCdfLogGumbel_v_164;
+typedef std::tuple<AgradCdfLogGumbel, type_v_165> AgradCdfLogGumbel_v_165;
+typedef std::tuple<AgradCdfLogGumbel, type_v_166> AgradCdfLogGumbel_v_166;
+typedef std::tuple<AgradCdfLogGumbel, type_v_167> AgradCdfLogGumbel_v_167;
+typedef std::tuple<AgradCdfLogGumbel, type_v_168> AgradCdfLogGumbel_v_168;
+typedef std::tuple<AgradCdfLogGumbel, type_v_169> AgradCdfLogGumbel_v_169;
+typedef std::tuple<AgradCdfLogGumbel, type_v_170> AgradCdfLogGumbel_v_170;
+typedef std::tuple<AgradCdfLogGumbel, type_v_171> AgradCdfLogGumbel_v_171;
+typedef std::tuple<AgradCdfLogGumbel, type_v_172> AgradCdfLogGumbel_v_172;
+typedef std::tuple<AgradCdfLogGumbel, type_v_173> AgradCdfLogGumbel_v_173;
+typedef std::tuple<AgradCdfLogGumbel, type_v_174> AgradCdfLogGumbel_v_174;
+typedef std::tuple<AgradCdfLogGumbel, type_v_175> AgradCdfLogGumbel_v_175;
+typedef std::tuple<AgradCdfLogGumbel, type_v_176> AgradCdfLogGumbel_v_176;
+typedef std::tuple<AgradCdfLogGumbel, type_v_177> AgradCdfLogGumbel_v_177;
+typedef std::tuple<AgradCdfLogGumbel, type_v_178> AgradCdfLogGumbel_v_178;
+typedef std::tuple<AgradCdfLogGumbel, type_v_179> AgradCdfLogGumbel_v_179;
+typedef std::tuple<AgradCdfLogGumbel, type_v_180> AgradCdfLogGumbel_v_180;
+typedef std::tuple<AgradCdfLogGumbel, type_v_181> AgradCdfLogGumbel_v_181;
+typedef std::tuple<AgradCdfLogGumbel, type_v_182> AgradCdfLogGumbel_v_182;
+typedef std::tuple<AgradCdfLogGumbel, type_v_183> AgradCdfLogGumbel_v_183;
+typedef std::tuple<AgradCdfLogGumbel, type_v_184> AgradCdfLogGumbel_v_184;
+typedef std::tuple<AgradCdfLogGumbel, type_v_185> AgradCdfLogGumbel_v_185;
+typedef std::tuple<AgradCdfLogGumbel, type_v_186> AgradCdfLogGumbel_v_186;
+typedef std::tuple<AgradCdfLogGumbel, type_v_187> AgradCdfLogGumbel_v_187;
+typedef std::tuple<AgradCdfLogGumbel, type_v_188> AgradCdfLogGumbel_v_188;
+typedef std::tuple<AgradCdfLogGumbel, type_v_189> AgradCdfLogGumbel_v_189;
+typedef std::tuple<AgradCdfLogGumbel, type_v_190> AgradCdfLogGumbel_v_190;
+typedef std::tuple<AgradCdfLogGumbel, type_v_191> AgradCdfLogGumbel_v_191;
+typedef std::tuple<AgradCdfLogGumbel, type_v_192> AgradCdfLogGumbel_v_192;
+typedef std::tuple<AgradCdfLogGumbel, type_v_193> AgradCdfLogGumbel_v_193;
+typedef std::tuple<AgradCdfLogGumbel, type_v_194> AgradCdfLogGumbel_v_194;
+typedef std::tuple<AgradCdfLogGumbel, type_v_195> AgradCdfLogGumbel_v_195;
+typedef std::tuple<AgradCdfLogGumbel, type_v_196> AgradCdfLogGumbel_v_196;
+typedef std::tuple<AgradCdfLogGumbel, type_v_197> AgradCdfLogGumbel_v_197;
+typedef std::tuple<AgradCdfLogGumbel, type_v_198> AgradCdfLogGumbel_v_198;
+typedef std::tuple<AgradCdfLogGumbel, type_v_199> AgradCdfLogGumbel_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_100, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_101, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_102, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_103, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_104, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_105, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_106, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_107, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_108, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_109, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_110, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_111, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_112, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_113, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_114, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_115, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_116, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_117, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_118, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_119, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_120, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_121, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_122, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_123, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_124, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_125, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_126, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_127, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_128, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_129, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_130, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_131, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_132, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_133, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_134, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_135, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_136, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_137, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_138, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_139, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_140, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_141, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_142, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_143, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_144, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_145, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_146, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_147, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_148, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_149, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_150, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_151, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_152, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_153, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_154, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_155, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_156, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_157, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_158, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_159, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_160, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_161, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_162, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_163, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_164, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_165, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_166, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_167, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_168, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_169, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_170, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_171, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_172, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_173, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_174, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_175, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_176, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_177, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_178, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_179, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_180, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_181, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_182, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_183, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_184, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_185, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_186, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_187, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_188, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_189, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_190, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_191, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_192, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_193, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_194, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_195, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_196, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_197, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_198, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_v_199, AgradCdfLogTestFixture, AgradCdfLogGumbel_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/gumbel/gumbel_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogGumbel, type_vv_100> AgradCdfLogGumbel_vv_100;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_101> AgradCdfLogGumbel_vv_101;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_102> AgradCdfLogGumbel_vv_102;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_103> AgradCdfLogGumbel_vv_103;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_104> AgradCdfLogGumbel_vv_104;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_105> AgradCdfLogGumbel_vv_105;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_106> AgradCdfLogGumbel_vv_106;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_107> AgradCdfLogGumbel_vv_107;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_108> AgradCdfLogGumbel_vv_108;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_109> AgradCdfLogGumbel_vv_109;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_110> AgradCdfLogGumbel_vv_110;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_111> AgradCdfLogGumbel_vv_111;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_112> AgradCdfLogGumbel_vv_112;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_113> AgradCdfLogGumbel_vv_113;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_114> AgradCdfLogGumbel_vv_114;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_115> AgradCdfLogGumbel_vv_115;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_116> AgradCdfLogGumbel_vv_116;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_117> AgradCdfLogGumbel_vv_117;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_118> AgradCdfLogGumbel_vv_118;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_119> AgradCdfLogGumbel_vv_119;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_120> AgradCdfLogGumbel_vv_120;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_121> AgradCdfLogGumbel_vv_121;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_122> AgradCdfLogGumbel_vv_122;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_123> AgradCdfLogGumbel_vv_123;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_124> AgradCdfLogGumbel_vv_124;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_125> AgradCdfLogGumbel_vv_125;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_126> AgradCdfLogGumbel_vv_126;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_127> AgradCdfLogGumbel_vv_127;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_128> AgradCdfLogGumbel_vv_128;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_129> AgradCdfLogGumbel_vv_129;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_130> AgradCdfLogGumbel_vv_130;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_131> AgradCdfLogGumbel_vv_131;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_132> AgradCdfLogGumbel_vv_132;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_133> AgradCdfLogGumbel_vv_133;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_134> AgradCdfLogGumbel_vv_134;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_135> AgradCdfLogGumbel_vv_135;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_136> AgradCdfLogGumbel_vv_136;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_137> AgradCdfLogGumbel_vv_137;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_138> AgradCdfLogGumbel_vv_138;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_139> AgradCdfLogGumbel_vv_139;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_140> AgradCdfLogGumbel_vv_140;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_141> AgradCdfLogGumbel_vv_141;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_142> AgradCdfLogGumbel_vv_142;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_143> AgradCdfLogGumbel_vv_143;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_144> AgradCdfLogGumbel_vv_144;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_145> AgradCdfLogGumbel_vv_145;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_146> AgradCdfLogGumbel_vv_146;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_147> AgradCdfLogGumbel_vv_147;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_148> AgradCdfLogGumbel_vv_148;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_149> AgradCdfLogGumbel_vv_149;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_150> AgradCdfLogGumbel_vv_150;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_151> AgradCdfLogGumbel_vv_151;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_152> AgradCdfLogGumbel_vv_152;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_153> AgradCdfLogGumbel_vv_153;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_154> AgradCdfLogGumbel_vv_154;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_155> AgradCdfLogGumbel_vv_155;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_156> AgradCdfLogGumbel_vv_156;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_157> AgradCdfLogGumbel_vv_157;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_158> AgradCdfLogGumbel_vv_158;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_159> AgradCdfLogGumbel_vv_159;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_160> AgradCdfLogGumbel_vv_160;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_161> AgradCdfLogGumbel_vv_161;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_162> AgradCdfLogGumbel_vv_162;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_163> AgradCdfLogGumbel_vv_163;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_164> AgradCdfLogGumbel_vv_164;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_165> AgradCdfLogGumbel_vv_165;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_166> AgradCdfLogGumbel_vv_166;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_167> AgradCdfLogGumbel_vv_167;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_168> AgradCdfLogGumbel_vv_168;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_169> AgradCdfLogGumbel_vv_169;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_170> AgradCdfLogGumbel_vv_170;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_171> AgradCdfLogGumbel_vv_171;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_172> AgradCdfLogGumbel_vv_172;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_173> AgradCdfLogGumbel_vv_173;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_174> AgradCdfLogGumbel_vv_174;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_175> AgradCdfLogGumbel_vv_175;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_176> AgradCdfLogGumbel_vv_176;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_177> AgradCdfLogGumbel_vv_177;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_178> AgradCdfLogGumbel_vv_178;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_179> AgradCdfLogGumbel_vv_179;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_180> AgradCdfLogGumbel_vv_180;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_181> AgradCdfLogGumbel_vv_181;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_182> AgradCdfLogGumbel_vv_182;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_183> AgradCdfLogGumbel_vv_183;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_184> AgradCdfLogGumbel_vv_184;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_185> AgradCdfLogGumbel_vv_185;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_186> AgradCdfLogGumbel_vv_186;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_187> AgradCdfLogGumbel_vv_187;
+typedef std::tuple<AgradCdfLogGumbel, type_vv_188> AgradCdfLogGumbel_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_100, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_101, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_102, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_103, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_104, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_105, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_106, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_107, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_108, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_109, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_110, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_111, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_112, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_113, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_114, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_115, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_116, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_117, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_118, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_119, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_120, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_121, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_122, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_123, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_124, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_125, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_126, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_127, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_128, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_129, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_130, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_131, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_132, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_133, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_134, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_135, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_136, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_137, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_138, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_139, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_140, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_141, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_142, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_143, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_144, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_145, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_146, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_147, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_148, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_149, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_150, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_151, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_152, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_153, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_154, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_155, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_156, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_157, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_158, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_159, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_160, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_161, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_162, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_163, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_164, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_165, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_166, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_167, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_168, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_169, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_170, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_171, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_172, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_173, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_174, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_175, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_176, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_177, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_178, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_179, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_180, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_181, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_182, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_183, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_184, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_185, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_186, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_187, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogGumbel_vv_188, AgradCdfLogTestFixture, AgradCdfLogGumbel_vv_188);
+
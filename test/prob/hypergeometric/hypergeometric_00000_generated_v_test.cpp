@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/hypergeometric/hypergeometric_test.hpp>
+
+typedef std::tuple<int, int, int, int, empty, empty> type_v_0;
+typedef std::tuple<int, int, int, std::vector<int>, empty, empty> type_v_1;
+typedef std::tuple<int, int, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<int, int, std::vector<int>, int, empty, empty> type_v_3;
+typedef std::tuple<int, int, std::vector<int>, std::vector<int>, empty, empty> type_v_4;
+typedef std::tuple<int, int, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<int, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty> type_v_6;
+typedef std::tuple<int, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty> type_v_7;
+typedef std::tuple<int, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<int, std::vector<int>, int, int, empty, empty> type_v_9;
+typedef std::tuple<int, std::vector<int>, int, std::vector<int>, empty, empty> type_v_10;
+typedef std::tuple<int, std::vector<int>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<int, std::vector<int>, std::vector<int>, int, empty, empty> type_v_12;
+typedef std::tuple<int, std::vector<int>, std::vector<int>, std::vector<int>, empty, empty> type_v_13;
+typedef std::tuple<int, std::vector<int>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty> type_v_15;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty> type_v_16;
+typedef std::tuple<int, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, int, empty, empty> type_v_18;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<int>, empty, empty> type_v_19;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, int, empty, empty> type_v_21;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<int>, empty, empty> type_v_22;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty> type_v_24;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty> type_v_25;
+typedef std::tuple<int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<std::vector<int>, int, int, int, empty, empty> type_v_27;
+typedef std::tuple<std::vector<int>, int, int, std::vector<int>, empty, empty> type_v_28;
+typedef std::tuple<std::vector<int>, int, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<std::vector<int>, int, std::vector<int>, int, empty, empty> type_v_30;
+typedef std::tuple<std::vector<int>, int, std::vector<int>, std::vector<int>, empty, empty> type_v_31;
+typedef std::tuple<std::vector<int>, int, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty> type_v_33;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty> type_v_34;
+typedef std::tuple<std::vector<int>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<std::vector<int>, std::vector<int>, int, int, empty, empty> type_v_36;
+typedef std::tuple<std::vector<int>, std::vector<int>, int, std::vector<int>, empty, empty> type_v_37;
+typedef std::tuple<std::vector<int>, std::vector<int>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<int>, int, empty, empty> type_v_39;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<int>, std::vector<int>, empty, empty> type_v_40;
+typedef std::tuple<std::vector<int>, std::vector<int>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty> type_v_42;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty> type_v_43;
+typedef std::tuple<std::vector<int>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, int, empty, empty> type_v_45;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<int>, empty, empty> type_v_46;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, int, empty, empty> type_v_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<int>, empty, empty> type_v_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty> type_v_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty> type_v_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, int, int, empty, empty> type_v_54;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, int, std::vector<int>, empty, empty> type_v_55;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<int>, int, empty, empty> type_v_57;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<int>, std::vector<int>, empty, empty> type_v_58;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty> type_v_60;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty> type_v_61;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, int, int, empty, empty> type_v_63;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, int, std::vector<int>, empty, empty> type_v_64;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<int>, int, empty, empty> type_v_66;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<int>, std::vector<int>, empty, empty> type_v_67;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty> type_v_69;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty> type_v_70;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, int, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, std::vector<int>, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, int, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, std::vector<int>, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, int, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<int>, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_0> AgradDistributionsHypergeometric_v_0;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_1> AgradDistributionsHypergeometric_v_1;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_2> AgradDistributionsHypergeometric_v_2;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_3> AgradDistributionsHypergeometric_v_3;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_4> AgradDistributionsHypergeometric_v_4;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_5> AgradDistributionsHypergeometric_v_5;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_6> AgradDistributionsHypergeometric_v_6;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_7> AgradDistributionsHypergeometric_v_7;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_8> AgradDistributionsHypergeometric_v_8;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_9> AgradDistributionsHypergeometric_v_9;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_10> AgradDistributionsHypergeometric_v_10;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_11> AgradDistributionsHypergeometric_v_11;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_12> AgradDistributionsHypergeometric_v_12;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_13> AgradDistributionsHypergeometric_v_13;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_14> AgradDistributionsHypergeometric_v_14;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_15> AgradDistributionsHypergeometric_v_15;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_16> AgradDistributionsHypergeometric_v_16;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_17> AgradDistributionsHypergeometric_v_17;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_18> AgradDistributionsHypergeometric_v_18;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_19> AgradDistributionsHypergeometric_v_19;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_20> AgradDistributionsHypergeometric_v_20;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_21> AgradDistributionsHypergeometric_v_21;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_22> AgradDistributionsHypergeometric_v_22;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_23> AgradDistributionsHypergeometric_v_23;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_24> AgradDistributionsHypergeometric_v_24;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_25> AgradDistributionsHypergeometric_v_25;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_26> AgradDistributionsHypergeometric_v_26;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_27> AgradDistributionsHypergeometric_v_27;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_28> AgradDistributionsHypergeometric_v_28;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_29> AgradDistributionsHypergeometric_v_29;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_30> AgradDistributionsHypergeometric_v_30;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_31> AgradDistributionsHypergeometric_v_31;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_32> AgradDistributionsHypergeometric_v_32;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_33> AgradDistributionsHypergeometric_v_33;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_34> AgradDistributionsHypergeometric_v_34;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_35> AgradDistributionsHypergeometric_v_35;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_36> AgradDistributionsHypergeometric_v_36;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_37> AgradDistributionsHypergeometric_v_37;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_38> AgradDistributionsHypergeometric_v_38;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_39> AgradDistributionsHypergeometric_v_39;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_40> AgradDistributionsHypergeometric_v_40;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_41> AgradDistributionsHypergeometric_v_41;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_42> AgradDistributionsHypergeometric_v_42;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_43> AgradDistributionsHypergeometric_v_43;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_44> AgradDistributionsHypergeometric_v_44;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_45> AgradDistributionsHypergeometric_v_45;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_46> AgradDistributionsHypergeometric_v_46;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_47> AgradDistributionsHypergeometric_v_47;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_48> AgradDistributionsHypergeometric_v_48;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_49> AgradDistributionsHypergeometric_v_49;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_50> AgradDistributionsHypergeometric_v_50;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_51> AgradDistributionsHypergeometric_v_51;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_52> AgradDistributionsHypergeometric_v_52;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_53> AgradDistributionsHypergeometric_v_53;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_54> AgradDistributionsHypergeometric_v_54;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_55> AgradDistributionsHypergeometric_v_55;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_56> AgradDistributionsHypergeometric_v_56;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_57> AgradDistributionsHypergeometric_v_57;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_58> AgradDistributionsHypergeometric_v_58;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_59> AgradDistributionsHypergeometric_v_59;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_60> AgradDistributionsHypergeometric_v_60;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_61> AgradDistributionsHypergeometric_v_61;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_62> AgradDistributionsHypergeometric_v_62;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_63> AgradDistributionsHypergeometric_v_63;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_64> AgradDistributionsHypergeometric_v_64;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_65> AgradDistributionsHypergeometric_v_65;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_66> AgradDistributionsHypergeometric_v_66;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_67> AgradDistributionsHypergeometric_v_67;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_68> AgradDistributionsHypergeometric_v_68;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_69> AgradDistributionsHypergeometric_v_69;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_70> AgradDistributionsHypergeometric_v_70;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_71> AgradDistributionsHypergeometric_v_71;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_72> AgradDistributionsHypergeometric_v_72;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_73> AgradDistributionsHypergeometric_v_73;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_74> AgradDistributionsHypergeometric_v_74;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_75> AgradDistributionsHypergeometric_v_75;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_76> AgradDistributionsHypergeometric_v_76;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_77> AgradDistributionsHypergeometric_v_77;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_78> AgradDistributionsHypergeometric_v_78;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_79> AgradDistributionsHypergeometric_v_79;
+typedef std::tuple<AgradDistributionsHypergeometric, type_v_80> AgradDistributionsHypergeometric_v_80;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_0, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_1, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_2, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_3, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_4, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_5, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_6, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_7, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_8, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_9, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_10, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_11, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_12, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_13, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_14, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_15, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_16, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_17, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_18, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_19, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_20, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_21, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_22, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_23, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_24, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_25, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_26, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_27, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_28, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_29, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_30, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_31, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_32, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_33, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_34, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_35, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_36, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_37, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_38, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_39, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_40, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_41, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_42, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_43, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_44, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_45, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_46, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_47, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_48, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_49, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_50, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_51, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_52, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_53, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_54, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_55, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_56, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_57, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_58, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_59, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_60, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_61, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_62, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_63, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_64, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_65, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_66, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_67, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_68, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_69, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_70, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_71, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_72, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_73, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_74, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_75, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_76, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_77, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_78, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_79, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsHypergeometric_v_80, AgradDistributionTestFixture, AgradDistributionsHypergeometric_v_80);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_chi_square/inv_chi_square_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_2;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_3;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_4;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_8;
+typedef std::tuple<fvar<fvar<var> >, double, empty, empty, empty, empty> type_ffv_9;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, empty, empty, empty, empty> type_ffv_10;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_11;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_12;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_13;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, empty, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_17;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_18;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_19;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_0> AgradDistributionsInvChiSquare_ffv_0;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_1> AgradDistributionsInvChiSquare_ffv_1;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_2> AgradDistributionsInvChiSquare_ffv_2;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_3> AgradDistributionsInvChiSquare_ffv_3;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_4> AgradDistributionsInvChiSquare_ffv_4;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_5> AgradDistributionsInvChiSquare_ffv_5;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_6> AgradDistributionsInvChiSquare_ffv_6;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_7> AgradDistributionsInvChiSquare_ffv_7;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_8> AgradDistributionsInvChiSquare_ffv_8;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_9> AgradDistributionsInvChiSquare_ffv_9;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_10> AgradDistributionsInvChiSquare_ffv_10;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_11> AgradDistributionsInvChiSquare_ffv_11;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_12> AgradDistributionsInvChiSquare_ffv_12;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_13> AgradDistributionsInvChiSquare_ffv_13;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_14> AgradDistributionsInvChiSquare_ffv_14;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_15> AgradDistributionsInvChiSquare_ffv_15;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_16> AgradDistributionsInvChiSquare_ffv_16;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_17> AgradDistributionsInvChiSquare_ffv_17;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_18> AgradDistributionsInvChiSquare_ffv_18;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_19> AgradDistributionsInvChiSquare_ffv_19;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_20> AgradDistributionsInvChiSquare_ffv_20;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_21> AgradDistributionsInvChiSquare_ffv_21;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_22> AgradDistributionsInvChiSquare_ffv_22;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_23> AgradDistributionsInvChiSquare_ffv_23;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_24> AgradDistributionsInvChiSquare_ffv_24;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_25> AgradDistributionsInvChiSquare_ffv_25;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_ffv_26> AgradDistributionsInvChiSquare_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_0, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_1, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_2, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_3, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_4, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_5, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_6, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_7, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_8, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_9, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_10, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_11, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_12, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_13, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_14, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_15, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_16, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_17, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_18, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_19, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_20, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_21, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_22, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_23, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_24, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_25, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_ffv_26, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_ffv_26);
+
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_chi_square/inv_chi_square_test.hpp>
+
+typedef std::tuple<double, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<double, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<double, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<double>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<double>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_v_18;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_v_19;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_20;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_v_21;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_v_22;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_29;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_30;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_31;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_32;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_33;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_34;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_35;
+
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_0> AgradDistributionsInvChiSquare_v_0;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_1> AgradDistributionsInvChiSquare_v_1;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_2> AgradDistributionsInvChiSquare_v_2;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_3> AgradDistributionsInvChiSquare_v_3;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_4> AgradDistributionsInvChiSquare_v_4;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_5> AgradDistributionsInvChiSquare_v_5;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_6> AgradDistributionsInvChiSquare_v_6;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_7> AgradDistributionsInvChiSquare_v_7;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_8> AgradDistributionsInvChiSquare_v_8;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_9> AgradDistributionsInvChiSquare_v_9;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_10> AgradDistributionsInvChiSquare_v_10;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_11> AgradDistributionsInvChiSquare_v_11;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_12> AgradDistributionsInvChiSquare_v_12;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_13> AgradDistributionsInvChiSquare_v_13;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_14> AgradDistributionsInvChiSquare_v_14;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_15> AgradDistributionsInvChiSquare_v_15;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_16> AgradDistributionsInvChiSquare_v_16;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_17> AgradDistributionsInvChiSquare_v_17;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_18> AgradDistributionsInvChiSquare_v_18;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_19> AgradDistributionsInvChiSquare_v_19;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_20> AgradDistributionsInvChiSquare_v_20;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_21> AgradDistributionsInvChiSquare_v_21;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_22> AgradDistributionsInvChiSquare_v_22;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_23> AgradDistributionsInvChiSquare_v_23;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_24> AgradDistributionsInvChiSquare_v_24;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_25> AgradDistributionsInvChiSquare_v_25;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_26> AgradDistributionsInvChiSquare_v_26;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_27> AgradDistributionsInvChiSquare_v_27;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_28> AgradDistributionsInvChiSquare_v_28;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_29> AgradDistributionsInvChiSquare_v_29;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_30> AgradDistributionsInvChiSquare_v_30;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_31> AgradDistributionsInvChiSquare_v_31;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_32> AgradDistributionsInvChiSquare_v_32;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_33> AgradDistributionsInvChiSquare_v_33;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_34> AgradDistributionsInvChiSquare_v_34;
+typedef std::tuple<AgradDistributionsInvChiSquare, type_v_35> AgradDistributionsInvChiSquare_v_35;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_0, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_1, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_2, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_3, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_4, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_5, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_6, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_7, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_8, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_9, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_10, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_11, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_12, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_13, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_14, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_15, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_16, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_17, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_18, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_19, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_20, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_21, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_22, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_23, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_24, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_25, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_26, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_27, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_28, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_29, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_30, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_31, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_32, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_33, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_34, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvChiSquare_v_35, AgradDistributionTestFixture, AgradDistributionsInvChiSquare_v_35);
+
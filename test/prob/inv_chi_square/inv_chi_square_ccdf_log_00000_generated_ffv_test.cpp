@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_chi_square/inv_chi_square_ccdf_log_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_2;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_3;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_4;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_8;
+typedef std::tuple<fvar<fvar<var> >, double, empty, empty, empty, empty> type_ffv_9;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, empty, empty, empty, empty> type_ffv_10;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_11;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_12;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_13;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, empty, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_17;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_18;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_19;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_0> AgradCcdfLogInvChiSquare_ffv_0;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_1> AgradCcdfLogInvChiSquare_ffv_1;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_2> AgradCcdfLogInvChiSquare_ffv_2;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_3> AgradCcdfLogInvChiSquare_ffv_3;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_4> AgradCcdfLogInvChiSquare_ffv_4;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_5> AgradCcdfLogInvChiSquare_ffv_5;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_6> AgradCcdfLogInvChiSquare_ffv_6;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_7> AgradCcdfLogInvChiSquare_ffv_7;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_8> AgradCcdfLogInvChiSquare_ffv_8;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_9> AgradCcdfLogInvChiSquare_ffv_9;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_10> AgradCcdfLogInvChiSquare_ffv_10;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_11> AgradCcdfLogInvChiSquare_ffv_11;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_12> AgradCcdfLogInvChiSquare_ffv_12;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_13> AgradCcdfLogInvChiSquare_ffv_13;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_14> AgradCcdfLogInvChiSquare_ffv_14;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_15> AgradCcdfLogInvChiSquare_ffv_15;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_16> AgradCcdfLogInvChiSquare_ffv_16;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_17> AgradCcdfLogInvChiSquare_ffv_17;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_18> AgradCcdfLogInvChiSquare_ffv_18;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_19> AgradCcdfLogInvChiSquare_ffv_19;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_20> AgradCcdfLogInvChiSquare_ffv_20;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_21> AgradCcdfLogInvChiSquare_ffv_21;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_22> AgradCcdfLogInvChiSquare_ffv_22;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_23> AgradCcdfLogInvChiSquare_ffv_23;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_24> AgradCcdfLogInvChiSquare_ffv_24;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_25> AgradCcdfLogInvChiSquare_ffv_25;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_ffv_26> AgradCcdfLogInvChiSquare_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_ffv_26);
+
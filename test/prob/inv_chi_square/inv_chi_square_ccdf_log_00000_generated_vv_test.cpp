@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_chi_square/inv_chi_square_ccdf_log_test.hpp>
+
+typedef std::tuple<double, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_vv_9;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_vv_10;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_11;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_vv_12;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_vv_13;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_17;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_vv_18;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_vv_19;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_20;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty, empty> type_vv_21;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty, empty> type_vv_22;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_23;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty, empty> type_vv_24;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty, empty> type_vv_25;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_0> AgradCcdfLogInvChiSquare_vv_0;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_1> AgradCcdfLogInvChiSquare_vv_1;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_2> AgradCcdfLogInvChiSquare_vv_2;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_3> AgradCcdfLogInvChiSquare_vv_3;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_4> AgradCcdfLogInvChiSquare_vv_4;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_5> AgradCcdfLogInvChiSquare_vv_5;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_6> AgradCcdfLogInvChiSquare_vv_6;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_7> AgradCcdfLogInvChiSquare_vv_7;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_8> AgradCcdfLogInvChiSquare_vv_8;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_9> AgradCcdfLogInvChiSquare_vv_9;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_10> AgradCcdfLogInvChiSquare_vv_10;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_11> AgradCcdfLogInvChiSquare_vv_11;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_12> AgradCcdfLogInvChiSquare_vv_12;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_13> AgradCcdfLogInvChiSquare_vv_13;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_14> AgradCcdfLogInvChiSquare_vv_14;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_15> AgradCcdfLogInvChiSquare_vv_15;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_16> AgradCcdfLogInvChiSquare_vv_16;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_17> AgradCcdfLogInvChiSquare_vv_17;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_18> AgradCcdfLogInvChiSquare_vv_18;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_19> AgradCcdfLogInvChiSquare_vv_19;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_20> AgradCcdfLogInvChiSquare_vv_20;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_21> AgradCcdfLogInvChiSquare_vv_21;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_22> AgradCcdfLogInvChiSquare_vv_22;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_23> AgradCcdfLogInvChiSquare_vv_23;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_24> AgradCcdfLogInvChiSquare_vv_24;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_25> AgradCcdfLogInvChiSquare_vv_25;
+typedef std::tuple<AgradCcdfLogInvChiSquare, type_vv_26> AgradCcdfLogInvChiSquare_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvChiSquare_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogInvChiSquare_vv_26);
+
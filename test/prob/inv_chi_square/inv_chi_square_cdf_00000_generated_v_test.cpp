@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_chi_square/inv_chi_square_cdf_test.hpp>
+
+typedef std::tuple<double, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<double, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<double, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<double>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<double>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_v_18;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_v_19;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_20;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_v_21;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_v_22;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_29;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_30;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_31;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_32;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_33;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_34;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_35;
+
+typedef std::tuple<AgradCdfInvChiSquare, type_v_0> AgradCdfInvChiSquare_v_0;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_1> AgradCdfInvChiSquare_v_1;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_2> AgradCdfInvChiSquare_v_2;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_3> AgradCdfInvChiSquare_v_3;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_4> AgradCdfInvChiSquare_v_4;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_5> AgradCdfInvChiSquare_v_5;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_6> AgradCdfInvChiSquare_v_6;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_7> AgradCdfInvChiSquare_v_7;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_8> AgradCdfInvChiSquare_v_8;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_9> AgradCdfInvChiSquare_v_9;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_10> AgradCdfInvChiSquare_v_10;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_11> AgradCdfInvChiSquare_v_11;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_12> AgradCdfInvChiSquare_v_12;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_13> AgradCdfInvChiSquare_v_13;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_14> AgradCdfInvChiSquare_v_14;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_15> AgradCdfInvChiSquare_v_15;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_16> AgradCdfInvChiSquare_v_16;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_17> AgradCdfInvChiSquare_v_17;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_18> AgradCdfInvChiSquare_v_18;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_19> AgradCdfInvChiSquare_v_19;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_20> AgradCdfInvChiSquare_v_20;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_21> AgradCdfInvChiSquare_v_21;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_22> AgradCdfInvChiSquare_v_22;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_23> AgradCdfInvChiSquare_v_23;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_24> AgradCdfInvChiSquare_v_24;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_25> AgradCdfInvChiSquare_v_25;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_26> AgradCdfInvChiSquare_v_26;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_27> AgradCdfInvChiSquare_v_27;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_28> AgradCdfInvChiSquare_v_28;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_29> AgradCdfInvChiSquare_v_29;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_30> AgradCdfInvChiSquare_v_30;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_31> AgradCdfInvChiSquare_v_31;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_32> AgradCdfInvChiSquare_v_32;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_33> AgradCdfInvChiSquare_v_33;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_34> AgradCdfInvChiSquare_v_34;
+typedef std::tuple<AgradCdfInvChiSquare, type_v_35> AgradCdfInvChiSquare_v_35;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_0, AgradCdfTestFixture, AgradCdfInvChiSquare_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_1, AgradCdfTestFixture, AgradCdfInvChiSquare_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_2, AgradCdfTestFixture, AgradCdfInvChiSquare_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_3, AgradCdfTestFixture, AgradCdfInvChiSquare_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_4, AgradCdfTestFixture, AgradCdfInvChiSquare_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_5, AgradCdfTestFixture, AgradCdfInvChiSquare_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_6, AgradCdfTestFixture, AgradCdfInvChiSquare_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_7, AgradCdfTestFixture, AgradCdfInvChiSquare_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_8, AgradCdfTestFixture, AgradCdfInvChiSquare_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_9, AgradCdfTestFixture, AgradCdfInvChiSquare_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_10, AgradCdfTestFixture, AgradCdfInvChiSquare_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_11, AgradCdfTestFixture, AgradCdfInvChiSquare_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_12, AgradCdfTestFixture, AgradCdfInvChiSquare_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_13, AgradCdfTestFixture, AgradCdfInvChiSquare_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_14, AgradCdfTestFixture, AgradCdfInvChiSquare_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_15, AgradCdfTestFixture, AgradCdfInvChiSquare_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_16, AgradCdfTestFixture, AgradCdfInvChiSquare_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_17, AgradCdfTestFixture, AgradCdfInvChiSquare_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_18, AgradCdfTestFixture, AgradCdfInvChiSquare_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_19, AgradCdfTestFixture, AgradCdfInvChiSquare_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_20, AgradCdfTestFixture, AgradCdfInvChiSquare_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_21, AgradCdfTestFixture, AgradCdfInvChiSquare_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_22, AgradCdfTestFixture, AgradCdfInvChiSquare_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_23, AgradCdfTestFixture, AgradCdfInvChiSquare_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_24, AgradCdfTestFixture, AgradCdfInvChiSquare_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_25, AgradCdfTestFixture, AgradCdfInvChiSquare_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_26, AgradCdfTestFixture, AgradCdfInvChiSquare_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_27, AgradCdfTestFixture, AgradCdfInvChiSquare_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_28, AgradCdfTestFixture, AgradCdfInvChiSquare_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_29, AgradCdfTestFixture, AgradCdfInvChiSquare_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_30, AgradCdfTestFixture, AgradCdfInvChiSquare_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_31, AgradCdfTestFixture, AgradCdfInvChiSquare_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_32, AgradCdfTestFixture, AgradCdfInvChiSquare_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_33, AgradCdfTestFixture, AgradCdfInvChiSquare_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_34, AgradCdfTestFixture, AgradCdfInvChiSquare_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_v_35, AgradCdfTestFixture, AgradCdfInvChiSquare_v_35);
+
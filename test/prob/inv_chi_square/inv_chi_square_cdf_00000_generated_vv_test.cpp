@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_chi_square/inv_chi_square_cdf_test.hpp>
+
+typedef std::tuple<double, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_vv_9;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_vv_10;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_11;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_vv_12;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_vv_13;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_17;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_vv_18;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_vv_19;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_20;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty, empty> type_vv_21;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty, empty> type_vv_22;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_23;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty, empty> type_vv_24;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty, empty> type_vv_25;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_0> AgradCdfInvChiSquare_vv_0;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_1> AgradCdfInvChiSquare_vv_1;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_2> AgradCdfInvChiSquare_vv_2;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_3> AgradCdfInvChiSquare_vv_3;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_4> AgradCdfInvChiSquare_vv_4;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_5> AgradCdfInvChiSquare_vv_5;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_6> AgradCdfInvChiSquare_vv_6;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_7> AgradCdfInvChiSquare_vv_7;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_8> AgradCdfInvChiSquare_vv_8;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_9> AgradCdfInvChiSquare_vv_9;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_10> AgradCdfInvChiSquare_vv_10;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_11> AgradCdfInvChiSquare_vv_11;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_12> AgradCdfInvChiSquare_vv_12;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_13> AgradCdfInvChiSquare_vv_13;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_14> AgradCdfInvChiSquare_vv_14;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_15> AgradCdfInvChiSquare_vv_15;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_16> AgradCdfInvChiSquare_vv_16;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_17> AgradCdfInvChiSquare_vv_17;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_18> AgradCdfInvChiSquare_vv_18;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_19> AgradCdfInvChiSquare_vv_19;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_20> AgradCdfInvChiSquare_vv_20;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_21> AgradCdfInvChiSquare_vv_21;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_22> AgradCdfInvChiSquare_vv_22;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_23> AgradCdfInvChiSquare_vv_23;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_24> AgradCdfInvChiSquare_vv_24;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_25> AgradCdfInvChiSquare_vv_25;
+typedef std::tuple<AgradCdfInvChiSquare, type_vv_26> AgradCdfInvChiSquare_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_0, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_1, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_2, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_3, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_4, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_5, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_6, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_7, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_8, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_9, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_10, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_11, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_12, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_13, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_14, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_15, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_16, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_17, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_18, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_19, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_20, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_21, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_22, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_23, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_24, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_25, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvChiSquare_vv_26, AgradCdfTestFixture, AgradCdfInvChiSquare_vv_26);
+
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_chi_square/inv_chi_square_cdf_log_test.hpp>
+
+typedef std::tuple<double, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_vv_9;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_vv_10;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_11;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_vv_12;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_vv_13;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_17;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_vv_18;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_vv_19;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_20;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty, empty> type_vv_21;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty, empty> type_vv_22;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_23;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty, empty> type_vv_24;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty, empty> type_vv_25;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_0> AgradCdfLogInvChiSquare_vv_0;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_1> AgradCdfLogInvChiSquare_vv_1;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_2> AgradCdfLogInvChiSquare_vv_2;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_3> AgradCdfLogInvChiSquare_vv_3;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_4> AgradCdfLogInvChiSquare_vv_4;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_5> AgradCdfLogInvChiSquare_vv_5;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_6> AgradCdfLogInvChiSquare_vv_6;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_7> AgradCdfLogInvChiSquare_vv_7;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_8> AgradCdfLogInvChiSquare_vv_8;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_9> AgradCdfLogInvChiSquare_vv_9;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_10> AgradCdfLogInvChiSquare_vv_10;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_11> AgradCdfLogInvChiSquare_vv_11;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_12> AgradCdfLogInvChiSquare_vv_12;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_13> AgradCdfLogInvChiSquare_vv_13;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_14> AgradCdfLogInvChiSquare_vv_14;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_15> AgradCdfLogInvChiSquare_vv_15;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_16> AgradCdfLogInvChiSquare_vv_16;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_17> AgradCdfLogInvChiSquare_vv_17;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_18> AgradCdfLogInvChiSquare_vv_18;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_19> AgradCdfLogInvChiSquare_vv_19;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_20> AgradCdfLogInvChiSquare_vv_20;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_21> AgradCdfLogInvChiSquare_vv_21;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_22> AgradCdfLogInvChiSquare_vv_22;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_23> AgradCdfLogInvChiSquare_vv_23;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_24> AgradCdfLogInvChiSquare_vv_24;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_25> AgradCdfLogInvChiSquare_vv_25;
+typedef std::tuple<AgradCdfLogInvChiSquare, type_vv_26> AgradCdfLogInvChiSquare_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_0, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_1, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_2, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_3, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_4, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_5, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_6, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_7, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_8, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_9, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_10, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_11, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_12, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_13, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_14, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_15, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_16, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_17, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_18, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_19, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_20, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_21, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_22, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_23, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_24, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_25, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvChiSquare_vv_26, AgradCdfLogTestFixture, AgradCdfLogInvChiSquare_vv_26);
+
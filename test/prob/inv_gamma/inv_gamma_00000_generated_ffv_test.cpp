@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_0> AgradDistributionsInvGamma_ffv_0;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_1> AgradDistributionsInvGamma_ffv_1;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_2> AgradDistributionsInvGamma_ffv_2;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_3> AgradDistributionsInvGamma_ffv_3;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_4> AgradDistributionsInvGamma_ffv_4;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_5> AgradDistributionsInvGamma_ffv_5;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_6> AgradDistributionsInvGamma_ffv_6;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_7> AgradDistributionsInvGamma_ffv_7;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_8> AgradDistributionsInvGamma_ffv_8;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_9> AgradDistributionsInvGamma_ffv_9;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_10> AgradDistributionsInvGamma_ffv_10;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_11> AgradDistributionsInvGamma_ffv_11;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_12> AgradDistributionsInvGamma_ffv_12;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_13> AgradDistributionsInvGamma_ffv_13;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_14> AgradDistributionsInvGamma_ffv_14;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_15> AgradDistributionsInvGamma_ffv_15;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_16> AgradDistributionsInvGamma_ffv_16;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_17> AgradDistributionsInvGamma_ffv_17;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_18> AgradDistributionsInvGamma_ffv_18;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_19> AgradDistributionsInvGamma_ffv_19;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_20> AgradDistributionsInvGamma_ffv_20;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_21> AgradDistributionsInvGamma_ffv_21;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_22> AgradDistributionsInvGamma_ffv_22;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_23> AgradDistributionsInvGamma_ffv_23;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_24> AgradDistributionsInvGamma_ffv_24;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_25> AgradDistributionsInvGamma_ffv_25;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_26> AgradDistributionsInvGamma_ffv_26;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_27> AgradDistributionsInvGamma_ffv_27;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_28> AgradDistributionsInvGamma_ffv_28;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_29> AgradDistributionsInvGamma_ffv_29;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_30> AgradDistributionsInvGamma_ffv_30;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_31> AgradDistributionsInvGamma_ffv_31;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_32> AgradDistributionsInvGamma_ffv_32;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_33> AgradDistributionsInvGamma_ffv_33;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_34> AgradDistributionsInvGamma_ffv_34;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_35> AgradDistributionsInvGamma_ffv_35;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_36> AgradDistributionsInvGamma_ffv_36;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_37> AgradDistributionsInvGamma_ffv_37;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_38> AgradDistributionsInvGamma_ffv_38;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_39> AgradDistributionsInvGamma_ffv_39;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_40> AgradDistributionsInvGamma_ffv_40;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_41> AgradDistributionsInvGamma_ffv_41;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_42> AgradDistributionsInvGamma_ffv_42;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_43> AgradDistributionsInvGamma_ffv_43;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_44> AgradDistributionsInvGamma_ffv_44;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_45> AgradDistributionsInvGamma_ffv_45;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_46> AgradDistributionsInvGamma_ffv_46;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_47> AgradDistributionsInvGamma_ffv_47;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_48> AgradDistributionsInvGamma_ffv_48;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_49> AgradDistributionsInvGamma_ffv_49;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_50> AgradDistributionsInvGamma_ffv_50;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_51> AgradDistributionsInvGamma_ffv_51;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_52> AgradDistributionsInvGamma_ffv_52;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_53> AgradDistributionsInvGamma_ffv_53;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_54> AgradDistributionsInvGamma_ffv_54;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_55> AgradDistributionsInvGamma_ffv_55;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_56> AgradDistributionsInvGamma_ffv_56;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_57> AgradDistributionsInvGamma_ffv_57;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_58> AgradDistributionsInvGamma_ffv_58;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_59> AgradDistributionsInvGamma_ffv_59;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_60> AgradDistributionsInvGamma_ffv_60;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_61> AgradDistributionsInvGamma_ffv_61;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_62> AgradDistributionsInvGamma_ffv_62;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_63> AgradDistributionsInvGamma_ffv_63;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_64> AgradDistributionsInvGamma_ffv_64;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_65> AgradDistributionsInvGamma_ffv_65;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_66> AgradDistributionsInvGamma_ffv_66;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_67> AgradDistributionsInvGamma_ffv_67;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_68> AgradDistributionsInvGamma_ffv_68;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_69> AgradDistributionsInvGamma_ffv_69;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_70> AgradDistributionsInvGamma_ffv_70;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_71> AgradDistributionsInvGamma_ffv_71;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_72> AgradDistributionsInvGamma_ffv_72;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_73> AgradDistributionsInvGamma_ffv_73;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_74> AgradDistributionsInvGamma_ffv_74;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_75> AgradDistributionsInvGamma_ffv_75;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_76> AgradDistributionsInvGamma_ffv_76;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_77> AgradDistributionsInvGamma_ffv_77;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_78> AgradDistributionsInvGamma_ffv_78;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_79> AgradDistributionsInvGamma_ffv_79;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_80> AgradDistributionsInvGamma_ffv_80;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_81> AgradDistributionsInvGamma_ffv_81;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_82> AgradDistributionsInvGamma_ffv_82;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_83> AgradDistributionsInvGamma_ffv_83;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_84> AgradDistributionsInvGamma_ffv_84;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_85> AgradDistributionsInvGamma_ffv_85;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_86> AgradDistributionsInvGamma_ffv_86;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_87> AgradDistributionsInvGamma_ffv_87;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_88> AgradDistributionsInvGamma_ffv_88;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_89> AgradDistributionsInvGamma_ffv_89;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_90> AgradDistributionsInvGamma_ffv_90;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_91> AgradDistributionsInvGamma_ffv_91;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_92> AgradDistributionsInvGamma_ffv_92;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_93> AgradDistributionsInvGamma_ffv_93;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_94> AgradDistributionsInvGamma_ffv_94;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_95> AgradDistributionsInvGamma_ffv_95;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_96> AgradDistributionsInvGamma_ffv_96;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_97> AgradDistributionsInvGamma_ffv_97;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_98> AgradDistributionsInvGamma_ffv_98;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_99> AgradDistributionsInvGamma_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_0, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_1, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_2, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_3, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_4, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_5, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_6, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_7, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_8, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_9, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_10, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_11, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_12, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_13, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_14, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_15, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_16, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_17, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_18, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_19, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_20, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_21, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_22, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_23, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_24, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_25, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_26, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_27, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_28, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_29, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_30, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_31, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_32, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_33, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_34, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_35, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_36, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_37, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_38, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_39, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_40, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_41, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_42, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_43, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_44, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_45, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_46, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_47, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_48, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_49, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_50, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_51, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_52, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_53, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_54, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_55, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_56, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_57, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_58, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_59, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_60, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_61, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_62, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_63, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_64, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_65, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_66, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_67, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_68, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_69, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_70, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_71, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_72, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_73, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_74, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_75, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_76, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_77, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_78, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_79, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_80, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_81, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_82, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_83, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_84, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_85, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_86, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_87, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_88, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_89, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_90, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_91, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_92, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_93, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_94, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_95, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_96, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_97, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_98, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_99, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsInvGamma, type_v_0> AgradDistributionsInvGamma_v_0;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_1> AgradDistributionsInvGamma_v_1;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_2> AgradDistributionsInvGamma_v_2;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_3> AgradDistributionsInvGamma_v_3;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_4> AgradDistributionsInvGamma_v_4;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_5> AgradDistributionsInvGamma_v_5;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_6> AgradDistributionsInvGamma_v_6;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_7> AgradDistributionsInvGamma_v_7;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_8> AgradDistributionsInvGamma_v_8;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_9> AgradDistributionsInvGamma_v_9;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_10> AgradDistributionsInvGamma_v_10;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_11> AgradDistributionsInvGamma_v_11;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_12> AgradDistributionsInvGamma_v_12;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_13> AgradDistributionsInvGamma_v_13;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_14> AgradDistributionsInvGamma_v_14;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_15> AgradDistributionsInvGamma_v_15;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_16> AgradDistributionsInvGamma_v_16;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_17> AgradDistributionsInvGamma_v_17;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_18> AgradDistributionsInvGamma_v_18;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_19> AgradDistributionsInvGamma_v_19;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_20> AgradDistributionsInvGamma_v_20;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_21> AgradDistributionsInvGamma_v_21;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_22> AgradDistributionsInvGamma_v_22;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_23> AgradDistributionsInvGamma_v_23;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_24> AgradDistributionsInvGamma_v_24;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_25> AgradDistributionsInvGamma_v_25;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_26> AgradDistributionsInvGamma_v_26;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_27> AgradDistributionsInvGamma_v_27;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_28> AgradDistributionsInvGamma_v_28;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_29> AgradDistributionsInvGamma_v_29;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_30> AgradDistributionsInvGamma_v_30;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_31> AgradDistributionsInvGamma_v_31;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_32> AgradDistributionsInvGamma_v_32;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_33> AgradDistributionsInvGamma_v_33;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_34> AgradDistributionsInvGamma_v_34;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_35> AgradDistributionsInvGamma_v_35;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_36> AgradDistributionsInvGamma_v_36;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_37> AgradDistributionsInvGamma_v_37;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_38> AgradDistributionsInvGamma_v_38;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_39> AgradDistributionsInvGamma_v_39;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_40> AgradDistributionsInvGamma_v_40;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_41> AgradDistributionsInvGamma_v_41;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_42> AgradDistributionsInvGamma_v_42;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_43> AgradDistributionsInvGamma_v_43;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_44> AgradDistributionsInvGamma_v_44;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_45> AgradDistributionsInvGamma_v_45;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_46> AgradDistributionsInvGamma_v_46;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_47> AgradDistributionsInvGamma_v_47;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_48> AgradDistributionsInvGamma_v_48;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_49> AgradDistributionsInvGamma_v_49;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_50> AgradDistributionsInvGamma_v_50;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_51> AgradDistributionsInvGamma_v_51;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_52> AgradDistributionsInvGamma_v_52;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_53> AgradDistributionsInvGamma_v_53;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_54> AgradDistributionsInvGamma_v_54;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_55> AgradDistributionsInvGamma_v_55;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_56> AgradDistributionsInvGamma_v_56;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_57> AgradDistributionsInvGamma_v_57;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_58> AgradDistributionsInvGamma_v_58;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_59> AgradDistributionsInvGamma_v_59;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_60> AgradDistributionsInvGamma_v_60;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_61> AgradDistributionsInvGamma_v_61;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_62> AgradDistributionsInvGamma_v_62;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_63> AgradDistributionsInvGamma_v_63;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_64> AgradDistributionsInvGamma_v_64;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_65> AgradDistributionsInvGamma_v_65;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_66> AgradDistributionsInvGamma_v_66;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_67> AgradDistributionsInvGamma_v_67;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_68> AgradDistributionsInvGamma_v_68;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_69> AgradDistributionsInvGamma_v_69;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_70> AgradDistributionsInvGamma_v_70;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_71> AgradDistributionsInvGamma_v_71;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_72> AgradDistributionsInvGamma_v_72;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_73> AgradDistributionsInvGamma_v_73;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_74> AgradDistributionsInvGamma_v_74;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_75> AgradDistributionsInvGamma_v_75;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_76> AgradDistributionsInvGamma_v_76;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_77> AgradDistributionsInvGamma_v_77;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_78> AgradDistributionsInvGamma_v_78;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_79> AgradDistributionsInvGamma_v_79;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_80> AgradDistributionsInvGamma_v_80;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_81> AgradDistributionsInvGamma_v_81;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_82> AgradDistributionsInvGamma_v_82;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_83> AgradDistributionsInvGamma_v_83;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_84> AgradDistributionsInvGamma_v_84;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_85> AgradDistributionsInvGamma_v_85;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_86> AgradDistributionsInvGamma_v_86;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_87> AgradDistributionsInvGamma_v_87;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_88> AgradDistributionsInvGamma_v_88;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_89> AgradDistributionsInvGamma_v_89;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_90> AgradDistributionsInvGamma_v_90;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_91> AgradDistributionsInvGamma_v_91;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_92> AgradDistributionsInvGamma_v_92;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_93> AgradDistributionsInvGamma_v_93;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_94> AgradDistributionsInvGamma_v_94;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_95> AgradDistributionsInvGamma_v_95;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_96> AgradDistributionsInvGamma_v_96;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_97> AgradDistributionsInvGamma_v_97;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_98> AgradDistributionsInvGamma_v_98;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_99> AgradDistributionsInvGamma_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_0, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_1, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_2, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_3, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_4, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_5, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_6, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_7, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_8, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_9, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_10, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_11, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_12, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_13, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_14, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_15, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_16, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_17, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_18, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_19, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_20, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_21, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_22, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_23, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_24, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_25, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_26, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_27, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_28, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_29, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_30, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_31, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_32, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_33, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_34, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_35, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_36, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_37, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_38, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_39, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_40, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_41, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_42, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_43, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_44, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_45, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_46, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_47, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_48, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_49, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_50, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_51, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_52, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_53, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_54, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_55, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_56, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_57, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_58, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_59, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_60, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_61, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_62, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_63, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_64, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_65, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_66, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_67, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_68, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_69, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_70, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_71, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_72, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_73, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_74, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_75, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_76, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_77, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_78, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_79, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_80, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_81, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_82, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_83, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_84, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_85, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_86, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_87, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_88, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_89, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_90, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_91, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_92, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_93, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_94, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_95, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_96, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_97, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_98, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_99, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_0> AgradDistributionsInvGamma_vv_0;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_1> AgradDistributionsInvGamma_vv_1;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_2> AgradDistributionsInvGamma_vv_2;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_3> AgradDistributionsInvGamma_vv_3;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_4> AgradDistributionsInvGamma_vv_4;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_5> AgradDistributionsInvGamma_vv_5;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_6> AgradDistributionsInvGamma_vv_6;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_7> AgradDistributionsInvGamma_vv_7;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_8> AgradDistributionsInvGamma_vv_8;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_9> AgradDistributionsInvGamma_vv_9;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_10> AgradDistributionsInvGamma_vv_10;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_11> AgradDistributionsInvGamma_vv_11;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_12> AgradDistributionsInvGamma_vv_12;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_13> AgradDistributionsInvGamma_vv_13;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_14> AgradDistributionsInvGamma_vv_14;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_15> AgradDistributionsInvGamma_vv_15;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_16> AgradDistributionsInvGamma_vv_16;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_17> AgradDistributionsInvGamma_vv_17;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_18> AgradDistributionsInvGamma_vv_18;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_19> AgradDistributionsInvGamma_vv_19;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_20> AgradDistributionsInvGamma_vv_20;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_21> AgradDistributionsInvGamma_vv_21;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_22> AgradDistributionsInvGamma_vv_22;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_23> AgradDistributionsInvGamma_vv_23;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_24> AgradDistributionsInvGamma_vv_24;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_25> AgradDistributionsInvGamma_vv_25;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_26> AgradDistributionsInvGamma_vv_26;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_27> AgradDistributionsInvGamma_vv_27;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_28> AgradDistributionsInvGamma_vv_28;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_29> AgradDistributionsInvGamma_vv_29;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_30> AgradDistributionsInvGamma_vv_30;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_31> AgradDistributionsInvGamma_vv_31;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_32> AgradDistributionsInvGamma_vv_32;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_33> AgradDistributionsInvGamma_vv_33;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_34> AgradDistributionsInvGamma_vv_34;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_35> AgradDistributionsInvGamma_vv_35;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_36> AgradDistributionsInvGamma_vv_36;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_37> AgradDistributionsInvGamma_vv_37;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_38> AgradDistributionsInvGamma_vv_38;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_39> AgradDistributionsInvGamma_vv_39;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_40> AgradDistributionsInvGamma_vv_40;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_41> AgradDistributionsInvGamma_vv_41;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_42> AgradDistributionsInvGamma_vv_42;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_43> AgradDistributionsInvGamma_vv_43;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_44> AgradDistributionsInvGamma_vv_44;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_45> AgradDistributionsInvGamma_vv_45;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_46> AgradDistributionsInvGamma_vv_46;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_47> AgradDistributionsInvGamma_vv_47;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_48> AgradDistributionsInvGamma_vv_48;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_49> AgradDistributionsInvGamma_vv_49;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_50> AgradDistributionsInvGamma_vv_50;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_51> AgradDistributionsInvGamma_vv_51;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_52> AgradDistributionsInvGamma_vv_52;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_53> AgradDistributionsInvGamma_vv_53;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_54> AgradDistributionsInvGamma_vv_54;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_55> AgradDistributionsInvGamma_vv_55;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_56> AgradDistributionsInvGamma_vv_56;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_57> AgradDistributionsInvGamma_vv_57;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_58> AgradDistributionsInvGamma_vv_58;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_59> AgradDistributionsInvGamma_vv_59;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_60> AgradDistributionsInvGamma_vv_60;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_61> AgradDistributionsInvGamma_vv_61;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_62> AgradDistributionsInvGamma_vv_62;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_63> AgradDistributionsInvGamma_vv_63;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_64> AgradDistributionsInvGamma_vv_64;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_65> AgradDistributionsInvGamma_vv_65;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_66> AgradDistributionsInvGamma_vv_66;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_67> AgradDistributionsInvGamma_vv_67;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_68> AgradDistributionsInvGamma_vv_68;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_69> AgradDistributionsInvGamma_vv_69;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_70> AgradDistributionsInvGamma_vv_70;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_71> AgradDistributionsInvGamma_vv_71;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_72> AgradDistributionsInvGamma_vv_72;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_73> AgradDistributionsInvGamma_vv_73;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_74> AgradDistributionsInvGamma_vv_74;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_75> AgradDistributionsInvGamma_vv_75;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_76> AgradDistributionsInvGamma_vv_76;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_77> AgradDistributionsInvGamma_vv_77;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_78> AgradDistributionsInvGamma_vv_78;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_79> AgradDistributionsInvGamma_vv_79;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_80> AgradDistributionsInvGamma_vv_80;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_81> AgradDistributionsInvGamma_vv_81;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_82> AgradDistributionsInvGamma_vv_82;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_83> AgradDistributionsInvGamma_vv_83;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_84> AgradDistributionsInvGamma_vv_84;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_85> AgradDistributionsInvGamma_vv_85;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_86> AgradDistributionsInvGamma_vv_86;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_87> AgradDistributionsInvGamma_vv_87;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_88> AgradDistributionsInvGamma_vv_88;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_89> AgradDistributionsInvGamma_vv_89;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_90> AgradDistributionsInvGamma_vv_90;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_91> AgradDistributionsInvGamma_vv_91;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_92> AgradDistributionsInvGamma_vv_92;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_93> AgradDistributionsInvGamma_vv_93;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_94> AgradDistributionsInvGamma_vv_94;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_95> AgradDistributionsInvGamma_vv_95;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_96> AgradDistributionsInvGamma_vv_96;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_97> AgradDistributionsInvGamma_vv_97;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_98> AgradDistributionsInvGamma_vv_98;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_99> AgradDistributionsInvGamma_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_0, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_1, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_2, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_3, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_4, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_5, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_6, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_7, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_8, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_9, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_10, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_11, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_12, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_13, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_14, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_15, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_16, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_17, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_18, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_19, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_20, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_21, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_22, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_23, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_24, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_25, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_26, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_27, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_28, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_29, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_30, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_31, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_32, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_33, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_34, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_35, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_36, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_37, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_38, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_39, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_40, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_41, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_42, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_43, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_44, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_45, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_46, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_47, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_48, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_49, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_50, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_51, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_52, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_53, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_54, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_55, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_56, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_57, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_58, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_59, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_60, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_61, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_62, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_63, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_64, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_65, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_66, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_67, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_68, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_69, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_70, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_71, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_72, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_73, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_74, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_75, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_76, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_77, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_78, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_79, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_80, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_81, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_82, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_83, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_84, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_85, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_86, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_87, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_88, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_89, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_90, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_91, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_92, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_93, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_94, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_95, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_96, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_97, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_98, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_99, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_100> AgradDistributionsInvGamma_ffv_100;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_101> AgradDistributionsInvGamma_ffv_101;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_102> AgradDistributionsInvGamma_ffv_102;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_103> AgradDistributionsInvGamma_ffv_103;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_104> AgradDistributionsInvGamma_ffv_104;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_105> AgradDistributionsInvGamma_ffv_105;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_106> AgradDistributionsInvGamma_ffv_106;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_107> AgradDistributionsInvGamma_ffv_107;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_108> AgradDistributionsInvGamma_ffv_108;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_109> AgradDistributionsInvGamma_ffv_109;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_110> AgradDistributionsInvGamma_ffv_110;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_111> AgradDistributionsInvGamma_ffv_111;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_112> AgradDistributionsInvGamma_ffv_112;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_113> AgradDistributionsInvGamma_ffv_113;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_114> AgradDistributionsInvGamma_ffv_114;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_115> AgradDistributionsInvGamma_ffv_115;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_116> AgradDistributionsInvGamma_ffv_116;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_117> AgradDistributionsInvGamma_ffv_117;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_118> AgradDistributionsInvGamma_ffv_118;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_119> AgradDistributionsInvGamma_ffv_119;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_120> AgradDistributionsInvGamma_ffv_120;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_121> AgradDistributionsInvGamma_ffv_121;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_122> AgradDistributionsInvGamma_ffv_122;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_123> AgradDistributionsInvGamma_ffv_123;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_124> AgradDistributionsInvGamma_ffv_124;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_125> AgradDistributionsInvGamma_ffv_125;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_126> AgradDistributionsInvGamma_ffv_126;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_127> AgradDistributionsInvGamma_ffv_127;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_128> AgradDistributionsInvGamma_ffv_128;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_129> AgradDistributionsInvGamma_ffv_129;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_130> AgradDistributionsInvGamma_ffv_130;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_131> AgradDistributionsInvGamma_ffv_131;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_132> AgradDistributionsInvGamma_ffv_132;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_133> AgradDistributionsInvGamma_ffv_133;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_134> AgradDistributionsInvGamma_ffv_134;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_135> AgradDistributionsInvGamma_ffv_135;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_136> AgradDistributionsInvGamma_ffv_136;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_137> AgradDistributionsInvGamma_ffv_137;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_138> AgradDistributionsInvGamma_ffv_138;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_139> AgradDistributionsInvGamma_ffv_139;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_140> AgradDistributionsInvGamma_ffv_140;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_141> AgradDistributionsInvGamma_ffv_141;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_142> AgradDistributionsInvGamma_ffv_142;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_143> AgradDistributionsInvGamma_ffv_143;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_144> AgradDistributionsInvGamma_ffv_144;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_145> AgradDistributionsInvGamma_ffv_145;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_146> AgradDistributionsInvGamma_ffv_146;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_147> AgradDistributionsInvGamma_ffv_147;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_148> AgradDistributionsInvGamma_ffv_148;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_149> AgradDistributionsInvGamma_ffv_149;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_150> AgradDistributionsInvGamma_ffv_150;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_151> AgradDistributionsInvGamma_ffv_151;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_152> AgradDistributionsInvGamma_ffv_152;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_153> AgradDistributionsInvGamma_ffv_153;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_154> AgradDistributionsInvGamma_ffv_154;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_155> AgradDistributionsInvGamma_ffv_155;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_156> AgradDistributionsInvGamma_ffv_156;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_157> AgradDistributionsInvGamma_ffv_157;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_158> AgradDistributionsInvGamma_ffv_158;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_159> AgradDistributionsInvGamma_ffv_159;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_160> AgradDistributionsInvGamma_ffv_160;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_161> AgradDistributionsInvGamma_ffv_161;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_162> AgradDistributionsInvGamma_ffv_162;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_163> AgradDistributionsInvGamma_ffv_163;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_164> AgradDistributionsInvGamma_ffv_164;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_165> AgradDistributionsInvGamma_ffv_165;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_166> AgradDistributionsInvGamma_ffv_166;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_167> AgradDistributionsInvGamma_ffv_167;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_168> AgradDistributionsInvGamma_ffv_168;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_169> AgradDistributionsInvGamma_ffv_169;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_170> AgradDistributionsInvGamma_ffv_170;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_171> AgradDistributionsInvGamma_ffv_171;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_172> AgradDistributionsInvGamma_ffv_172;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_173> AgradDistributionsInvGamma_ffv_173;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_174> AgradDistributionsInvGamma_ffv_174;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_175> AgradDistributionsInvGamma_ffv_175;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_176> AgradDistributionsInvGamma_ffv_176;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_177> AgradDistributionsInvGamma_ffv_177;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_178> AgradDistributionsInvGamma_ffv_178;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_179> AgradDistributionsInvGamma_ffv_179;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_180> AgradDistributionsInvGamma_ffv_180;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_181> AgradDistributionsInvGamma_ffv_181;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_182> AgradDistributionsInvGamma_ffv_182;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_183> AgradDistributionsInvGamma_ffv_183;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_184> AgradDistributionsInvGamma_ffv_184;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_185> AgradDistributionsInvGamma_ffv_185;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_186> AgradDistributionsInvGamma_ffv_186;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_187> AgradDistributionsInvGamma_ffv_187;
+typedef std::tuple<AgradDistributionsInvGamma, type_ffv_188> AgradDistributionsInvGamma_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_100, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_101, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_102, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_103, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_104, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_105, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_106, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_107, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_108, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_109, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_110, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_111, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_112, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_113, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_114, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_115, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_116, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_117, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_118, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_119, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_120, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_121, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_122, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_123, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_124, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_125, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_126, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_127, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_128, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_129, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_130, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_131, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_132, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_133, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_134, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_135, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_136, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_137, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_138, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_139, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_140, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_141, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_142, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_143, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_144, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_145, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_146, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_147, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_148, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_149, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_150, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_151, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_152, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_153, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_154, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_155, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_156, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_157, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_158, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_159, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_160, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_161, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_162, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_163, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_164, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_165, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_166, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_167, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_168, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_169, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_170, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_171, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_172, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_173, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_174, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_175, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_176, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_177, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_178, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_179, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_180, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_181, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_182, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_183, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_184, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_185, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_186, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_187, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_ffv_188, AgradDistributionTestFixture, AgradDistributionsInvGamma_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsInvGamma, type_v_100> AgradDistributionsInvGamma_v_100;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_101> AgradDistributionsInvGamma_v_101;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_102> AgradDistributionsInvGamma_v_102;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_103> AgradDistributionsInvGamma_v_103;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_104> AgradDistributionsInvGamma_v_104;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_105> AgradDistributionsInvGamma_v_105;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_106> AgradDistributionsInvGamma_v_106;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_107> AgradDistributionsInvGamma_v_107;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_108> AgradDistributionsInvGamma_v_108;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_109> AgradDistributionsInvGamma_v_109;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_110> AgradDistributionsInvGamma_v_110;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_111> AgradDistributionsInvGamma_v_111;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_112> AgradDistributionsInvGamma_v_112;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_113> AgradDistributionsInvGamma_v_113;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_114> AgradDistributionsInvGamma_v_114;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_115> AgradDistributionsInvGamma_v_115;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_116> AgradDistributionsInvGamma_v_116;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_117> AgradDistributionsInvGamma_v_117;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_118> AgradDistributionsInvGamma_v_118;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_119> AgradDistributionsInvGamma_v_119;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_120> AgradDistributionsInvGamma_v_120;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_121> AgradDistributionsInvGamma_v_121;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_122> AgradDistributionsInvGamma_v_122;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_123> AgradDistributionsInvGamma_v_123;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_124> AgradDistributionsInvGamma_v_124;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_125> AgradDistributionsInvGamma_v_125;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_126> AgradDistributionsInvGamma_v_126;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_127> AgradDistributionsInvGamma_v_127;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_128> AgradDistributionsInvGamma_v_128;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_129> AgradDistributionsInvGamma_v_129;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_130> AgradDistributionsInvGamma_v_130;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_131> AgradDistributionsInvGamma_v_131;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_132> AgradDistributionsInvGamma_v_132;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_133> AgradDistributionsInvGamma_v_133;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_134> AgradDistributionsInvGamma_v_134;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_135> AgradDistributionsInvGamma_v_135;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_136> AgradDistributionsInvGamma_v_136;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_137> AgradDistributionsInvGamma_v_137;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_138> AgradDistributionsInvGamma_v_138;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_139> AgradDistributionsInvGamma_v_139;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_140> AgradDistributionsInvGamma_v_140;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_141> AgradDistributionsInvGamma_v_141;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_142> AgradDistributionsInvGamma_v_142;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_143> AgradDistributionsInvGamma_v_143;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_144> AgradDistributionsInvGamma_v_144;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_145> AgradDistributionsInvGamma_v_145;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_146> AgradDistributionsInvGamma_v_146;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_147> AgradDistributionsInvGamma_v_147;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_148> AgradDistributionsInvGamma_v_148;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_149> AgradDistributionsInvGamma_v_149;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_150> AgradDistributionsInvGamma_v_150;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_151> AgradDistributionsInvGamma_v_151;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_152> AgradDistributionsInvGamma_v_152;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_153> AgradDistributionsInvGamma_v_153;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_154> AgradDistributionsInvGamma_v_154;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_155> AgradDistributionsInvGamma_v_155;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_156> AgradDistributionsInvGamma_v_156;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_157> AgradDistributionsInvGamma_v_157;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_158> AgradDistributionsInvGamma_v_158;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_159> AgradDistributionsInvGamma_v_159;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_160> AgradDistributionsInvGamma_v_160;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_161> AgradDistributionsInvGamma_v_161;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_162> AgradDistributionsInvGamma_v_162;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_163> AgradDistributionsInvGamma_v_163;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_164> AgradDistributionsInvGamma_v_164;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_165> AgradDistributionsInvGamma_v_165;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_166> AgradDistributionsInvGamma_v_166;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_167> AgradDistributionsInvGamma_v_167;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_168> AgradDistributionsInvGamma_v_168;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_169> AgradDistributionsInvGamma_v_169;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_170> AgradDistributionsInvGamma_v_170;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_171> AgradDistributionsInvGamma_v_171;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_172> AgradDistributionsInvGamma_v_172;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_173> AgradDistributionsInvGamma_v_173;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_174> AgradDistributionsInvGamma_v_174;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_175> AgradDistributionsInvGamma_v_175;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_176> AgradDistributionsInvGamma_v_176;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_177> AgradDistributionsInvGamma_v_177;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_178> AgradDistributionsInvGamma_v_178;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_179> AgradDistributionsInvGamma_v_179;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_180> AgradDistributionsInvGamma_v_180;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_181> AgradDistributionsInvGamma_v_181;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_182> AgradDistributionsInvGamma_v_182;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_183> AgradDistributionsInvGamma_v_183;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_184> AgradDistributionsInvGamma_v_184;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_185> AgradDistributionsInvGamma_v_185;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_186> AgradDistributionsInvGamma_v_186;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_187> AgradDistributionsInvGamma_v_187;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_188> AgradDistributionsInvGamma_v_188;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_189> AgradDistributionsInvGamma_v_189;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_190> AgradDistributionsInvGamma_v_190;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_191> AgradDistributionsInvGamma_v_191;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_192> AgradDistributionsInvGamma_v_192;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_193> AgradDistributionsInvGamma_v_193;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_194> AgradDistributionsInvGamma_v_194;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_195> AgradDistributionsInvGamma_v_195;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_196> AgradDistributionsInvGamma_v_196;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_197> AgradDistributionsInvGamma_v_197;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_198> AgradDistributionsInvGamma_v_198;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_199> AgradDistributionsInvGamma_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_100, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_101, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_102, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_103, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_104, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_105, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_106, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_107, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_108, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_109, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_110, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_111, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_112, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_113, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_114, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_115, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_116, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_117, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_118, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_119, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_120, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_121, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_122, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_123, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_124, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_125, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_126, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_127, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_128, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_129, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_130, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_131, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_132, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_133, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_134, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_135, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_136, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_137, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_138, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_139, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_140, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_141, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_142, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_143, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_144, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_145, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_146, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_147, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_148, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_149, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_150, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_151, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_152, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_153, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_154, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_155, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_156, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_157, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_158, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_159, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_160, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_161, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_162, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_163, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_164, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_165, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_166, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_167, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_168, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_169, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_170, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_171, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_172, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_173, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_174, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_175, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_176, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_177, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_178, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_179, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_180, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_181, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_182, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_183, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_184, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_185, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_186, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_187, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_188, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_189, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_190, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_191, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_192, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_193, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_194, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_195, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_196, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_197, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_198, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_199, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_199);
+
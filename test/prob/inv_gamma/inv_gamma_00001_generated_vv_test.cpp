@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_100> AgradDistributionsInvGamma_vv_100;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_101> AgradDistributionsInvGamma_vv_101;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_102> AgradDistributionsInvGamma_vv_102;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_103> AgradDistributionsInvGamma_vv_103;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_104> AgradDistributionsInvGamma_vv_104;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_105> AgradDistributionsInvGamma_vv_105;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_106> AgradDistributionsInvGamma_vv_106;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_107> AgradDistributionsInvGamma_vv_107;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_108> AgradDistributionsInvGamma_vv_108;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_109> AgradDistributionsInvGamma_vv_109;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_110> AgradDistributionsInvGamma_vv_110;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_111> AgradDistributionsInvGamma_vv_111;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_112> AgradDistributionsInvGamma_vv_112;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_113> AgradDistributionsInvGamma_vv_113;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_114> AgradDistributionsInvGamma_vv_114;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_115> AgradDistributionsInvGamma_vv_115;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_116> AgradDistributionsInvGamma_vv_116;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_117> AgradDistributionsInvGamma_vv_117;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_118> AgradDistributionsInvGamma_vv_118;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_119> AgradDistributionsInvGamma_vv_119;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_120> AgradDistributionsInvGamma_vv_120;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_121> AgradDistributionsInvGamma_vv_121;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_122> AgradDistributionsInvGamma_vv_122;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_123> AgradDistributionsInvGamma_vv_123;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_124> AgradDistributionsInvGamma_vv_124;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_125> AgradDistributionsInvGamma_vv_125;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_126> AgradDistributionsInvGamma_vv_126;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_127> AgradDistributionsInvGamma_vv_127;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_128> AgradDistributionsInvGamma_vv_128;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_129> AgradDistributionsInvGamma_vv_129;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_130> AgradDistributionsInvGamma_vv_130;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_131> AgradDistributionsInvGamma_vv_131;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_132> AgradDistributionsInvGamma_vv_132;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_133> AgradDistributionsInvGamma_vv_133;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_134> AgradDistributionsInvGamma_vv_134;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_135> AgradDistributionsInvGamma_vv_135;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_136> AgradDistributionsInvGamma_vv_136;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_137> AgradDistributionsInvGamma_vv_137;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_138> AgradDistributionsInvGamma_vv_138;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_139> AgradDistributionsInvGamma_vv_139;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_140> AgradDistributionsInvGamma_vv_140;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_141> AgradDistributionsInvGamma_vv_141;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_142> AgradDistributionsInvGamma_vv_142;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_143> AgradDistributionsInvGamma_vv_143;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_144> AgradDistributionsInvGamma_vv_144;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_145> AgradDistributionsInvGamma_vv_145;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_146> AgradDistributionsInvGamma_vv_146;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_147> AgradDistributionsInvGamma_vv_147;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_148> AgradDistributionsInvGamma_vv_148;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_149> AgradDistributionsInvGamma_vv_149;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_150> AgradDistributionsInvGamma_vv_150;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_151> AgradDistributionsInvGamma_vv_151;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_152> AgradDistributionsInvGamma_vv_152;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_153> AgradDistributionsInvGamma_vv_153;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_154> AgradDistributionsInvGamma_vv_154;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_155> AgradDistributionsInvGamma_vv_155;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_156> AgradDistributionsInvGamma_vv_156;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_157> AgradDistributionsInvGamma_vv_157;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_158> AgradDistributionsInvGamma_vv_158;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_159> AgradDistributionsInvGamma_vv_159;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_160> AgradDistributionsInvGamma_vv_160;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_161> AgradDistributionsInvGamma_vv_161;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_162> AgradDistributionsInvGamma_vv_162;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_163> AgradDistributionsInvGamma_vv_163;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_164> AgradDistributionsInvGamma_vv_164;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_165> AgradDistributionsInvGamma_vv_165;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_166> AgradDistributionsInvGamma_vv_166;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_167> AgradDistributionsInvGamma_vv_167;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_168> AgradDistributionsInvGamma_vv_168;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_169> AgradDistributionsInvGamma_vv_169;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_170> AgradDistributionsInvGamma_vv_170;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_171> AgradDistributionsInvGamma_vv_171;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_172> AgradDistributionsInvGamma_vv_172;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_173> AgradDistributionsInvGamma_vv_173;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_174> AgradDistributionsInvGamma_vv_174;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_175> AgradDistributionsInvGamma_vv_175;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_176> AgradDistributionsInvGamma_vv_176;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_177> AgradDistributionsInvGamma_vv_177;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_178> AgradDistributionsInvGamma_vv_178;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_179> AgradDistributionsInvGamma_vv_179;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_180> AgradDistributionsInvGamma_vv_180;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_181> AgradDistributionsInvGamma_vv_181;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_182> AgradDistributionsInvGamma_vv_182;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_183> AgradDistributionsInvGamma_vv_183;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_184> AgradDistributionsInvGamma_vv_184;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_185> AgradDistributionsInvGamma_vv_185;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_186> AgradDistributionsInvGamma_vv_186;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_187> AgradDistributionsInvGamma_vv_187;
+typedef std::tuple<AgradDistributionsInvGamma, type_vv_188> AgradDistributionsInvGamma_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_100, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_101, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_102, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_103, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_104, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_105, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_106, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_107, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_108, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_109, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_110, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_111, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_112, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_113, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_114, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_115, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_116, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_117, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_118, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_119, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_120, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_121, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_122, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_123, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_124, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_125, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_126, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_127, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_128, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_129, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_130, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_131, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_132, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_133, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_134, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_135, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_136, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_137, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_138, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_139, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_140, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_141, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_142, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_143, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_144, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_145, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_146, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_147, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_148, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_149, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_150, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_151, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_152, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_153, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_154, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_155, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_156, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_157, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_158, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_159, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_160, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_161, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_162, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_163, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_164, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_165, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_166, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_167, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_168, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_169, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_170, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_171, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_172, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_173, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_174, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_175, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_176, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_177, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_178, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_179, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_180, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_181, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_182, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_183, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_184, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_185, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_186, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_187, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_vv_188, AgradDistributionTestFixture, AgradDistributionsInvGamma_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradDistributionsInvGamma, type_v_200> AgradDistributionsInvGamma_v_200;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_201> AgradDistributionsInvGamma_v_201;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_202> AgradDistributionsInvGamma_v_202;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_203> AgradDistributionsInvGamma_v_203;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_204> AgradDistributionsInvGamma_v_204;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_205> AgradDistributionsInvGamma_v_205;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_206> AgradDistributionsInvGamma_v_206;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_207> AgradDistributionsInvGamma_v_207;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_208> AgradDistributionsInvGamma_v_208;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_209> AgradDistributionsInvGamma_v_209;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_210> AgradDistributionsInvGamma_v_210;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_211> AgradDistributionsInvGamma_v_211;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_212> AgradDistributionsInvGamma_v_212;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_213> AgradDistributionsInvGamma_v_213;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_214> AgradDistributionsInvGamma_v_214;
+typedef std::tuple<AgradDistributionsInvGamma, type_v_215> AgradDistributionsInvGamma_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_200, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_201, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_202, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_203, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_204, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_205, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_206, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_207, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_208, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_209, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_210, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_211, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_212, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_213, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_214, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsInvGamma_v_215, AgradDistributionTestFixture, AgradDistributionsInvGamma_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_0> AgradCcdfLogInvGamma_ffv_0;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_1> AgradCcdfLogInvGamma_ffv_1;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_2> AgradCcdfLogInvGamma_ffv_2;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_3> AgradCcdfLogInvGamma_ffv_3;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_4> AgradCcdfLogInvGamma_ffv_4;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_5> AgradCcdfLogInvGamma_ffv_5;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_6> AgradCcdfLogInvGamma_ffv_6;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_7> AgradCcdfLogInvGamma_ffv_7;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_8> AgradCcdfLogInvGamma_ffv_8;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_9> AgradCcdfLogInvGamma_ffv_9;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_10> AgradCcdfLogInvGamma_ffv_10;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_11> AgradCcdfLogInvGamma_ffv_11;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_12> AgradCcdfLogInvGamma_ffv_12;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_13> AgradCcdfLogInvGamma_ffv_13;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_14> AgradCcdfLogInvGamma_ffv_14;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_15> AgradCcdfLogInvGamma_ffv_15;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_16> AgradCcdfLogInvGamma_ffv_16;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_17> AgradCcdfLogInvGamma_ffv_17;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_18> AgradCcdfLogInvGamma_ffv_18;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_19> AgradCcdfLogInvGamma_ffv_19;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_20> AgradCcdfLogInvGamma_ffv_20;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_21> AgradCcdfLogInvGamma_ffv_21;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_22> AgradCcdfLogInvGamma_ffv_22;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_23> AgradCcdfLogInvGamma_ffv_23;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_24> AgradCcdfLogInvGamma_ffv_24;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_25> AgradCcdfLogInvGamma_ffv_25;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_26> AgradCcdfLogInvGamma_ffv_26;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_27> AgradCcdfLogInvGamma_ffv_27;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_28> AgradCcdfLogInvGamma_ffv_28;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_29> AgradCcdfLogInvGamma_ffv_29;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_30> AgradCcdfLogInvGamma_ffv_30;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_31> AgradCcdfLogInvGamma_ffv_31;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_32> AgradCcdfLogInvGamma_ffv_32;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_33> AgradCcdfLogInvGamma_ffv_33;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_34> AgradCcdfLogInvGamma_ffv_34;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_35> AgradCcdfLogInvGamma_ffv_35;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_36> AgradCcdfLogInvGamma_ffv_36;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_37> AgradCcdfLogInvGamma_ffv_37;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_38> AgradCcdfLogInvGamma_ffv_38;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_39> AgradCcdfLogInvGamma_ffv_39;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_40> AgradCcdfLogInvGamma_ffv_40;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_41> AgradCcdfLogInvGamma_ffv_41;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_42> AgradCcdfLogInvGamma_ffv_42;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_43> AgradCcdfLogInvGamma_ffv_43;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_44> AgradCcdfLogInvGamma_ffv_44;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_45> AgradCcdfLogInvGamma_ffv_45;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_46> AgradCcdfLogInvGamma_ffv_46;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_47> AgradCcdfLogInvGamma_ffv_47;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_48> AgradCcdfLogInvGamma_ffv_48;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_49> AgradCcdfLogInvGamma_ffv_49;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_50> AgradCcdfLogInvGamma_ffv_50;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_51> AgradCcdfLogInvGamma_ffv_51;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_52> AgradCcdfLogInvGamma_ffv_52;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_53> AgradCcdfLogInvGamma_ffv_53;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_54> AgradCcdfLogInvGamma_ffv_54;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_55> AgradCcdfLogInvGamma_ffv_55;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_56> AgradCcdfLogInvGamma_ffv_56;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_57> AgradCcdfLogInvGamma_ffv_57;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_58> AgradCcdfLogInvGamma_ffv_58;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_59> AgradCcdfLogInvGamma_ffv_59;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_60> AgradCcdfLogInvGamma_ffv_60;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_61> AgradCcdfLogInvGamma_ffv_61;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_62> AgradCcdfLogInvGamma_ffv_62;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_63> AgradCcdfLogInvGamma_ffv_63;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_64> AgradCcdfLogInvGamma_ffv_64;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_65> AgradCcdfLogInvGamma_ffv_65;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_66> AgradCcdfLogInvGamma_ffv_66;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_67> AgradCcdfLogInvGamma_ffv_67;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_68> AgradCcdfLogInvGamma_ffv_68;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_69> AgradCcdfLogInvGamma_ffv_69;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_70> AgradCcdfLogInvGamma_ffv_70;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_71> AgradCcdfLogInvGamma_ffv_71;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_72> AgradCcdfLogInvGamma_ffv_72;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_73> AgradCcdfLogInvGamma_ffv_73;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_74> AgradCcdfLogInvGamma_ffv_74;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_75> AgradCcdfLogInvGamma_ffv_75;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_76> AgradCcdfLogInvGamma_ffv_76;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_77> AgradCcdfLogInvGamma_ffv_77;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_78> AgradCcdfLogInvGamma_ffv_78;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_79> AgradCcdfLogInvGamma_ffv_79;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_80> AgradCcdfLogInvGamma_ffv_80;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_81> AgradCcdfLogInvGamma_ffv_81;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_82> AgradCcdfLogInvGamma_ffv_82;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_83> AgradCcdfLogInvGamma_ffv_83;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_84> AgradCcdfLogInvGamma_ffv_84;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_85> AgradCcdfLogInvGamma_ffv_85;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_86> AgradCcdfLogInvGamma_ffv_86;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_87> AgradCcdfLogInvGamma_ffv_87;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_88> AgradCcdfLogInvGamma_ffv_88;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_89> AgradCcdfLogInvGamma_ffv_89;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_90> AgradCcdfLogInvGamma_ffv_90;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_91> AgradCcdfLogInvGamma_ffv_91;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_92> AgradCcdfLogInvGamma_ffv_92;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_93> AgradCcdfLogInvGamma_ffv_93;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_94> AgradCcdfLogInvGamma_ffv_94;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_95> AgradCcdfLogInvGamma_ffv_95;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_96> AgradCcdfLogInvGamma_ffv_96;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_97> AgradCcdfLogInvGamma_ffv_97;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_98> AgradCcdfLogInvGamma_ffv_98;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_99> AgradCcdfLogInvGamma_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_0> AgradCcdfLogInvGamma_v_0;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_1> AgradCcdfLogInvGamma_v_1;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_2> AgradCcdfLogInvGamma_v_2;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_3> AgradCcdfLogInvGamma_v_3;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_4> AgradCcdfLogInvGamma_v_4;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_5> AgradCcdfLogInvGamma_v_5;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_6> AgradCcdfLogInvGamma_v_6;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_7> AgradCcdfLogInvGamma_v_7;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_8> AgradCcdfLogInvGamma_v_8;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_9> AgradCcdfLogInvGamma_v_9;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_10> AgradCcdfLogInvGamma_v_10;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_11> AgradCcdfLogInvGamma_v_11;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_12> AgradCcdfLogInvGamma_v_12;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_13> AgradCcdfLogInvGamma_v_13;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_14> AgradCcdfLogInvGamma_v_14;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_15> AgradCcdfLogInvGamma_v_15;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_16> AgradCcdfLogInvGamma_v_16;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_17> AgradCcdfLogInvGamma_v_17;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_18> AgradCcdfLogInvGamma_v_18;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_19> AgradCcdfLogInvGamma_v_19;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_20> AgradCcdfLogInvGamma_v_20;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_21> AgradCcdfLogInvGamma_v_21;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_22> AgradCcdfLogInvGamma_v_22;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_23> AgradCcdfLogInvGamma_v_23;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_24> AgradCcdfLogInvGamma_v_24;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_25> AgradCcdfLogInvGamma_v_25;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_26> AgradCcdfLogInvGamma_v_26;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_27> AgradCcdfLogInvGamma_v_27;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_28> AgradCcdfLogInvGamma_v_28;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_29> AgradCcdfLogInvGamma_v_29;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_30> AgradCcdfLogInvGamma_v_30;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_31> AgradCcdfLogInvGamma_v_31;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_32> AgradCcdfLogInvGamma_v_32;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_33> AgradCcdfLogInvGamma_v_33;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_34> AgradCcdfLogInvGamma_v_34;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_35> AgradCcdfLogInvGamma_v_35;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_36> AgradCcdfLogInvGamma_v_36;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_37> AgradCcdfLogInvGamma_v_37;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_38> AgradCcdfLogInvGamma_v_38;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_39> AgradCcdfLogInvGamma_v_39;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_40> AgradCcdfLogInvGamma_v_40;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_41> AgradCcdfLogInvGamma_v_41;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_42> AgradCcdfLogInvGamma_v_42;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_43> AgradCcdfLogInvGamma_v_43;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_44> AgradCcdfLogInvGamma_v_44;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_45> AgradCcdfLogInvGamma_v_45;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_46> AgradCcdfLogInvGamma_v_46;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_47> AgradCcdfLogInvGamma_v_47;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_48> AgradCcdfLogInvGamma_v_48;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_49> AgradCcdfLogInvGamma_v_49;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_50> AgradCcdfLogInvGamma_v_50;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_51> AgradCcdfLogInvGamma_v_51;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_52> AgradCcdfLogInvGamma_v_52;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_53> AgradCcdfLogInvGamma_v_53;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_54> AgradCcdfLogInvGamma_v_54;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_55> AgradCcdfLogInvGamma_v_55;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_56> AgradCcdfLogInvGamma_v_56;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_57> AgradCcdfLogInvGamma_v_57;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_58> AgradCcdfLogInvGamma_v_58;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_59> AgradCcdfLogInvGamma_v_59;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_60> AgradCcdfLogInvGamma_v_60;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_61> AgradCcdfLogInvGamma_v_61;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_62> AgradCcdfLogInvGamma_v_62;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_63> AgradCcdfLogInvGamma_v_63;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_64> AgradCcdfLogInvGamma_v_64;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_65> AgradCcdfLogInvGamma_v_65;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_66> AgradCcdfLogInvGamma_v_66;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_67> AgradCcdfLogInvGamma_v_67;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_68> AgradCcdfLogInvGamma_v_68;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_69> AgradCcdfLogInvGamma_v_69;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_70> AgradCcdfLogInvGamma_v_70;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_71> AgradCcdfLogInvGamma_v_71;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_72> AgradCcdfLogInvGamma_v_72;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_73> AgradCcdfLogInvGamma_v_73;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_74> AgradCcdfLogInvGamma_v_74;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_75> AgradCcdfLogInvGamma_v_75;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_76> AgradCcdfLogInvGamma_v_76;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_77> AgradCcdfLogInvGamma_v_77;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_78> AgradCcdfLogInvGamma_v_78;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_79> AgradCcdfLogInvGamma_v_79;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_80> AgradCcdfLogInvGamma_v_80;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_81> AgradCcdfLogInvGamma_v_81;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_82> AgradCcdfLogInvGamma_v_82;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_83> AgradCcdfLogInvGamma_v_83;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_84> AgradCcdfLogInvGamma_v_84;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_85> AgradCcdfLogInvGamma_v_85;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_86> AgradCcdfLogInvGamma_v_86;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_87> AgradCcdfLogInvGamma_v_87;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_88> AgradCcdfLogInvGamma_v_88;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_89> AgradCcdfLogInvGamma_v_89;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_90> AgradCcdfLogInvGamma_v_90;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_91> AgradCcdfLogInvGamma_v_91;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_92> AgradCcdfLogInvGamma_v_92;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_93> AgradCcdfLogInvGamma_v_93;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_94> AgradCcdfLogInvGamma_v_94;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_95> AgradCcdfLogInvGamma_v_95;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_96> AgradCcdfLogInvGamma_v_96;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_97> AgradCcdfLogInvGamma_v_97;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_98> AgradCcdfLogInvGamma_v_98;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_99> AgradCcdfLogInvGamma_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_0, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_1, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_2, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_3, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_4, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_5, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_6, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_7, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_8, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_9, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_10, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_11, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_12, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_13, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_14, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_15, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_16, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_17, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_18, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_19, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_20, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_21, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_22, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_23, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_24, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_25, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_26, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_27, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_28, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_29, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_30, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_31, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_32, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_33, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_34, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_35, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_36, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_37, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_38, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_39, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_40, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_41, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_42, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_43, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_44, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_45, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_46, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_47, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_48, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_49, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_50, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_51, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_52, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_53, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_54, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_55, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_56, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_57, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_58, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_59, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_60, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_61, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_62, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_63, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_64, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_65, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_66, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_67, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_68, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_69, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_70, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_71, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_72, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_73, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_74, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_75, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_76, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_77, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_78, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_79, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_80, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_81, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_82, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_83, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_84, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_85, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_86, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_87, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_88, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_89, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_90, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_91, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_92, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_93, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_94, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_95, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_96, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_97, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_98, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_99, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_99);
+
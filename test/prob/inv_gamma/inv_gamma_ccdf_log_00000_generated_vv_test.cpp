@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_0> AgradCcdfLogInvGamma_vv_0;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_1> AgradCcdfLogInvGamma_vv_1;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_2> AgradCcdfLogInvGamma_vv_2;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_3> AgradCcdfLogInvGamma_vv_3;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_4> AgradCcdfLogInvGamma_vv_4;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_5> AgradCcdfLogInvGamma_vv_5;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_6> AgradCcdfLogInvGamma_vv_6;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_7> AgradCcdfLogInvGamma_vv_7;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_8> AgradCcdfLogInvGamma_vv_8;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_9> AgradCcdfLogInvGamma_vv_9;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_10> AgradCcdfLogInvGamma_vv_10;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_11> AgradCcdfLogInvGamma_vv_11;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_12> AgradCcdfLogInvGamma_vv_12;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_13> AgradCcdfLogInvGamma_vv_13;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_14> AgradCcdfLogInvGamma_vv_14;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_15> AgradCcdfLogInvGamma_vv_15;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_16> AgradCcdfLogInvGamma_vv_16;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_17> AgradCcdfLogInvGamma_vv_17;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_18> AgradCcdfLogInvGamma_vv_18;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_19> AgradCcdfLogInvGamma_vv_19;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_20> AgradCcdfLogInvGamma_vv_20;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_21> AgradCcdfLogInvGamma_vv_21;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_22> AgradCcdfLogInvGamma_vv_22;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_23> AgradCcdfLogInvGamma_vv_23;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_24> AgradCcdfLogInvGamma_vv_24;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_25> AgradCcdfLogInvGamma_vv_25;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_26> AgradCcdfLogInvGamma_vv_26;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_27> AgradCcdfLogInvGamma_vv_27;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_28> AgradCcdfLogInvGamma_vv_28;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_29> AgradCcdfLogInvGamma_vv_29;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_30> AgradCcdfLogInvGamma_vv_30;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_31> AgradCcdfLogInvGamma_vv_31;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_32> AgradCcdfLogInvGamma_vv_32;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_33> AgradCcdfLogInvGamma_vv_33;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_34> AgradCcdfLogInvGamma_vv_34;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_35> AgradCcdfLogInvGamma_vv_35;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_36> AgradCcdfLogInvGamma_vv_36;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_37> AgradCcdfLogInvGamma_vv_37;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_38> AgradCcdfLogInvGamma_vv_38;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_39> AgradCcdfLogInvGamma_vv_39;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_40> AgradCcdfLogInvGamma_vv_40;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_41> AgradCcdfLogInvGamma_vv_41;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_42> AgradCcdfLogInvGamma_vv_42;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_43> AgradCcdfLogInvGamma_vv_43;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_44> AgradCcdfLogInvGamma_vv_44;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_45> AgradCcdfLogInvGamma_vv_45;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_46> AgradCcdfLogInvGamma_vv_46;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_47> AgradCcdfLogInvGamma_vv_47;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_48> AgradCcdfLogInvGamma_vv_48;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_49> AgradCcdfLogInvGamma_vv_49;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_50> AgradCcdfLogInvGamma_vv_50;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_51> AgradCcdfLogInvGamma_vv_51;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_52> AgradCcdfLogInvGamma_vv_52;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_53> AgradCcdfLogInvGamma_vv_53;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_54> AgradCcdfLogInvGamma_vv_54;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_55> AgradCcdfLogInvGamma_vv_55;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_56> AgradCcdfLogInvGamma_vv_56;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_57> AgradCcdfLogInvGamma_vv_57;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_58> AgradCcdfLogInvGamma_vv_58;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_59> AgradCcdfLogInvGamma_vv_59;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_60> AgradCcdfLogInvGamma_vv_60;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_61> AgradCcdfLogInvGamma_vv_61;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_62> AgradCcdfLogInvGamma_vv_62;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_63> AgradCcdfLogInvGamma_vv_63;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_64> AgradCcdfLogInvGamma_vv_64;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_65> AgradCcdfLogInvGamma_vv_65;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_66> AgradCcdfLogInvGamma_vv_66;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_67> AgradCcdfLogInvGamma_vv_67;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_68> AgradCcdfLogInvGamma_vv_68;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_69> AgradCcdfLogInvGamma_vv_69;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_70> AgradCcdfLogInvGamma_vv_70;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_71> AgradCcdfLogInvGamma_vv_71;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_72> AgradCcdfLogInvGamma_vv_72;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_73> AgradCcdfLogInvGamma_vv_73;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_74> AgradCcdfLogInvGamma_vv_74;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_75> AgradCcdfLogInvGamma_vv_75;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_76> AgradCcdfLogInvGamma_vv_76;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_77> AgradCcdfLogInvGamma_vv_77;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_78> AgradCcdfLogInvGamma_vv_78;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_79> AgradCcdfLogInvGamma_vv_79;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_80> AgradCcdfLogInvGamma_vv_80;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_81> AgradCcdfLogInvGamma_vv_81;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_82> AgradCcdfLogInvGamma_vv_82;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_83> AgradCcdfLogInvGamma_vv_83;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_84> AgradCcdfLogInvGamma_vv_84;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_85> AgradCcdfLogInvGamma_vv_85;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_86> AgradCcdfLogInvGamma_vv_86;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_87> AgradCcdfLogInvGamma_vv_87;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_88> AgradCcdfLogInvGamma_vv_88;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_89> AgradCcdfLogInvGamma_vv_89;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_90> AgradCcdfLogInvGamma_vv_90;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_91> AgradCcdfLogInvGamma_vv_91;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_92> AgradCcdfLogInvGamma_vv_92;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_93> AgradCcdfLogInvGamma_vv_93;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_94> AgradCcdfLogInvGamma_vv_94;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_95> AgradCcdfLogInvGamma_vv_95;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_96> AgradCcdfLogInvGamma_vv_96;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_97> AgradCcdfLogInvGamma_vv_97;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_98> AgradCcdfLogInvGamma_vv_98;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_99> AgradCcdfLogInvGamma_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_99);
+
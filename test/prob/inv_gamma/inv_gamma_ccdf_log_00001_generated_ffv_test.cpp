@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_100> AgradCcdfLogInvGamma_ffv_100;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_101> AgradCcdfLogInvGamma_ffv_101;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_102> AgradCcdfLogInvGamma_ffv_102;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_103> AgradCcdfLogInvGamma_ffv_103;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_104> AgradCcdfLogInvGamma_ffv_104;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_105> AgradCcdfLogInvGamma_ffv_105;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_106> AgradCcdfLogInvGamma_ffv_106;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_107> AgradCcdfLogInvGamma_ffv_107;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_108> AgradCcdfLogInvGamma_ffv_108;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_109> AgradCcdfLogInvGamma_ffv_109;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_110> AgradCcdfLogInvGamma_ffv_110;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_111> AgradCcdfLogInvGamma_ffv_111;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_112> AgradCcdfLogInvGamma_ffv_112;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_113> AgradCcdfLogInvGamma_ffv_113;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_114> AgradCcdfLogInvGamma_ffv_114;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_115> AgradCcdfLogInvGamma_ffv_115;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_116> AgradCcdfLogInvGamma_ffv_116;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_117> AgradCcdfLogInvGamma_ffv_117;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_118> AgradCcdfLogInvGamma_ffv_118;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_119> AgradCcdfLogInvGamma_ffv_119;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_120> AgradCcdfLogInvGamma_ffv_120;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_121> AgradCcdfLogInvGamma_ffv_121;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_122> AgradCcdfLogInvGamma_ffv_122;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_123> AgradCcdfLogInvGamma_ffv_123;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_124> AgradCcdfLogInvGamma_ffv_124;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_125> AgradCcdfLogInvGamma_ffv_125;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_126> AgradCcdfLogInvGamma_ffv_126;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_127> AgradCcdfLogInvGamma_ffv_127;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_128> AgradCcdfLogInvGamma_ffv_128;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_129> AgradCcdfLogInvGamma_ffv_129;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_130> AgradCcdfLogInvGamma_ffv_130;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_131> AgradCcdfLogInvGamma_ffv_131;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_132> AgradCcdfLogInvGamma_ffv_132;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_133> AgradCcdfLogInvGamma_ffv_133;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_134> AgradCcdfLogInvGamma_ffv_134;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_135> AgradCcdfLogInvGamma_ffv_135;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_136> AgradCcdfLogInvGamma_ffv_136;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_137> AgradCcdfLogInvGamma_ffv_137;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_138> AgradCcdfLogInvGamma_ffv_138;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_139> AgradCcdfLogInvGamma_ffv_139;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_140> AgradCcdfLogInvGamma_ffv_140;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_141> AgradCcdfLogInvGamma_ffv_141;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_142> AgradCcdfLogInvGamma_ffv_142;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_143> AgradCcdfLogInvGamma_ffv_143;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_144> AgradCcdfLogInvGamma_ffv_144;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_145> AgradCcdfLogInvGamma_ffv_145;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_146> AgradCcdfLogInvGamma_ffv_146;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_147> AgradCcdfLogInvGamma_ffv_147;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_148> AgradCcdfLogInvGamma_ffv_148;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_149> AgradCcdfLogInvGamma_ffv_149;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_150> AgradCcdfLogInvGamma_ffv_150;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_151> AgradCcdfLogInvGamma_ffv_151;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_152> AgradCcdfLogInvGamma_ffv_152;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_153> AgradCcdfLogInvGamma_ffv_153;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_154> AgradCcdfLogInvGamma_ffv_154;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_155> AgradCcdfLogInvGamma_ffv_155;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_156> AgradCcdfLogInvGamma_ffv_156;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_157> AgradCcdfLogInvGamma_ffv_157;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_158> AgradCcdfLogInvGamma_ffv_158;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_159> AgradCcdfLogInvGamma_ffv_159;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_160> AgradCcdfLogInvGamma_ffv_160;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_161> AgradCcdfLogInvGamma_ffv_161;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_162> AgradCcdfLogInvGamma_ffv_162;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_163> AgradCcdfLogInvGamma_ffv_163;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_164> AgradCcdfLogInvGamma_ffv_164;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_165> AgradCcdfLogInvGamma_ffv_165;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_166> AgradCcdfLogInvGamma_ffv_166;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_167> AgradCcdfLogInvGamma_ffv_167;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_168> AgradCcdfLogInvGamma_ffv_168;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_169> AgradCcdfLogInvGamma_ffv_169;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_170> AgradCcdfLogInvGamma_ffv_170;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_171> AgradCcdfLogInvGamma_ffv_171;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_172> AgradCcdfLogInvGamma_ffv_172;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_173> AgradCcdfLogInvGamma_ffv_173;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_174> AgradCcdfLogInvGamma_ffv_174;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_175> AgradCcdfLogInvGamma_ffv_175;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_176> AgradCcdfLogInvGamma_ffv_176;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_177> AgradCcdfLogInvGamma_ffv_177;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_178> AgradCcdfLogInvGamma_ffv_178;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_179> AgradCcdfLogInvGamma_ffv_179;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_180> AgradCcdfLogInvGamma_ffv_180;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_181> AgradCcdfLogInvGamma_ffv_181;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_182> AgradCcdfLogInvGamma_ffv_182;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_183> AgradCcdfLogInvGamma_ffv_183;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_184> AgradCcdfLogInvGamma_ffv_184;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_185> AgradCcdfLogInvGamma_ffv_185;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_186> AgradCcdfLogInvGamma_ffv_186;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_187> AgradCcdfLogInvGamma_ffv_187;
+typedef std::tuple<AgradCcdfLogInvGamma, type_ffv_188> AgradCcdfLogInvGamma_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_100> AgradCcdfLogInvGamma_v_100;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_101> AgradCcdfLogInvGamma_v_101;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_102> AgradCcdfLogInvGamma_v_102;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_103> AgradCcdfLogInvGamma_v_103;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_104> AgradCcdfLogInvGamma_v_104;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_105> AgradCcdfLogInvGamma_v_105;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_106> AgradCcdfLogInvGamma_v_106;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_107> AgradCcdfLogInvGamma_v_107;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_108> AgradCcdfLogInvGamma_v_108;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_109> AgradCcdfLogInvGamma_v_109;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_110> AgradCcdfLogInvGamma_v_110;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_111> AgradCcdfLogInvGamma_v_111;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_112> AgradCcdfLogInvGamma_v_112;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_113> AgradCcdfLogInvGamma_v_113;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_114> AgradCcdfLogInvGamma_v_114;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_115> AgradCcdfLogInvGamma_v_115;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_116> AgradCcdfLogInvGamma_v_116;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_117> AgradCcdfLogInvGamma_v_117;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_118> AgradCcdfLogInvGamma_v_118;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_119> AgradCcdfLogInvGamma_v_119;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_120> AgradCcdfLogInvGamma_v_120;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_121> AgradCcdfLogInvGamma_v_121;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_122> AgradCcdfLogInvGamma_v_122;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_123> AgradCcdfLogInvGamma_v_123;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_124> AgradCcdfLogInvGamma_v_124;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_125> AgradCcdfLogInvGamma_v_125;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_126> AgradCcdfLogInvGamma_v_126;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_127> AgradCcdfLogInvGamma_v_127;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_128> AgradCcdfLogInvGamma_v_128;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_129> AgradCcdfLogInvGamma_v_129;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_130> AgradCcdfLogInvGamma_v_130;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_131> AgradCcdfLogInvGamma_v_131;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_132> AgradCcdfLogInvGamma_v_132;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_133> AgradCcdfLogInvGamma_v_133;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_134> AgradCcdfLogInvGamma_v_134;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_135> AgradCcdfLogInvGamma_v_135;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_136> AgradCcdfLogInvGamma_v_136;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_137> AgradCcdfLogInvGamma_v_137;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_138> AgradCcdfLogInvGamma_v_138;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_139> AgradCcdfLogInvGamma_v_139;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_140> AgradCcdfLogInvGamma_v_140;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_141> AgradCcdfLogInvGamma_v_141;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_142> AgradCcdfLogInvGamma_v_142;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_143> AgradCcdfLogInvGamma_v_143;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_144> AgradCcdfLogInvGamma_v_144;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_145> AgradCcdfLogInvGamma_v_145;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_146> AgradCcdfLogInvGamma_v_146;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_147> AgradCcdfLogInvGamma_v_147;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_148> AgradCcdfLogInvGamma_v_148;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_149> AgradCcdfLogInvGamma_v_149;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_150> AgradCcdfLogInvGamma_v_150;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_151> AgradCcdfLogInvGamma_v_151;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_152> AgradCcdfLogInvGamma_v_152;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_153> AgradCcdfLogInvGamma_v_153;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_154> AgradCcdfLogInvGamma_v_154;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_155> AgradCcdfLogInvGamma_v_155;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_156> AgradCcdfLogInvGamma_v_156;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_157> AgradCcdfLogInvGamma_v_157;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_158> AgradCcdfLogInvGamma_v_158;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_159> AgradCcdfLogInvGamma_v_159;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_160> AgradCcdfLogInvGamma_v_160;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_161> AgradCcdfLogInvGamma_v_161;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_162> AgradCcdfLogInvGamma_v_162;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_163> AgradCcdfLogInvGamma_v_163;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_164> AgradCcdfLogInvGamma_v_164;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_165> AgradCcdfLogInvGamma_v_165;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_166> AgradCcdfLogInvGamma_v_166;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_167> AgradCcdfLogInvGamma_v_167;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_168> AgradCcdfLogInvGamma_v_168;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_169> AgradCcdfLogInvGamma_v_169;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_170> AgradCcdfLogInvGamma_v_170;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_171> AgradCcdfLogInvGamma_v_171;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_172> AgradCcdfLogInvGamma_v_172;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_173> AgradCcdfLogInvGamma_v_173;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_174> AgradCcdfLogInvGamma_v_174;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_175> AgradCcdfLogInvGamma_v_175;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_176> AgradCcdfLogInvGamma_v_176;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_177> AgradCcdfLogInvGamma_v_177;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_178> AgradCcdfLogInvGamma_v_178;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_179> AgradCcdfLogInvGamma_v_179;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_180> AgradCcdfLogInvGamma_v_180;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_181> AgradCcdfLogInvGamma_v_181;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_182> AgradCcdfLogInvGamma_v_182;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_183> AgradCcdfLogInvGamma_v_183;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_184> AgradCcdfLogInvGamma_v_184;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_185> AgradCcdfLogInvGamma_v_185;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_186> AgradCcdfLogInvGamma_v_186;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_187> AgradCcdfLogInvGamma_v_187;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_188> AgradCcdfLogInvGamma_v_188;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_189> AgradCcdfLogInvGamma_v_189;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_190> AgradCcdfLogInvGamma_v_190;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_191> AgradCcdfLogInvGamma_v_191;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_192> AgradCcdfLogInvGamma_v_192;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_193> AgradCcdfLogInvGamma_v_193;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_194> AgradCcdfLogInvGamma_v_194;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_195> AgradCcdfLogInvGamma_v_195;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_196> AgradCcdfLogInvGamma_v_196;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_197> AgradCcdfLogInvGamma_v_197;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_198> AgradCcdfLogInvGamma_v_198;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_199> AgradCcdfLogInvGamma_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_100, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_101, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_102, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_103, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_104, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_105, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_106, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_107, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_108, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_109, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_110, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_111, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_112, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_113, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_114, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_115, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_116, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_117, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_118, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_119, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_120, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_121, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_122, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_123, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_124, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_125, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_126, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_127, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_128, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_129, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_130, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_131, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_132, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_133, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_134, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_135, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_136, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_137, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_138, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_139, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_140, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_141, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_142, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_143, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_144, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_145, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_146, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_147, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_148, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_149, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_150, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_151, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_152, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_153, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_154, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_155, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_156, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_157, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_158, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_159, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_160, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_161, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_162, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_163, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_164, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_165, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_166, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_167, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_168, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_169, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_170, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_171, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_172, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_173, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_174, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_175, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_176, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_177, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_178, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_179, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_180, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_181, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_182, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_183, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_184, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_185, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_186, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_187, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_188, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_189, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_190, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_191, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_192, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_193, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_194, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_195, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_196, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_197, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_198, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_199, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_100> AgradCcdfLogInvGamma_vv_100;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_101> AgradCcdfLogInvGamma_vv_101;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_102> AgradCcdfLogInvGamma_vv_102;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_103> AgradCcdfLogInvGamma_vv_103;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_104> AgradCcdfLogInvGamma_vv_104;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_105> AgradCcdfLogInvGamma_vv_105;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_106> AgradCcdfLogInvGamma_vv_106;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_107> AgradCcdfLogInvGamma_vv_107;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_108> AgradCcdfLogInvGamma_vv_108;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_109> AgradCcdfLogInvGamma_vv_109;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_110> AgradCcdfLogInvGamma_vv_110;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_111> AgradCcdfLogInvGamma_vv_111;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_112> AgradCcdfLogInvGamma_vv_112;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_113> AgradCcdfLogInvGamma_vv_113;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_114> AgradCcdfLogInvGamma_vv_114;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_115> AgradCcdfLogInvGamma_vv_115;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_116> AgradCcdfLogInvGamma_vv_116;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_117> AgradCcdfLogInvGamma_vv_117;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_118> AgradCcdfLogInvGamma_vv_118;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_119> AgradCcdfLogInvGamma_vv_119;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_120> AgradCcdfLogInvGamma_vv_120;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_121> AgradCcdfLogInvGamma_vv_121;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_122> AgradCcdfLogInvGamma_vv_122;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_123> AgradCcdfLogInvGamma_vv_123;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_124> AgradCcdfLogInvGamma_vv_124;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_125> AgradCcdfLogInvGamma_vv_125;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_126> AgradCcdfLogInvGamma_vv_126;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_127> AgradCcdfLogInvGamma_vv_127;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_128> AgradCcdfLogInvGamma_vv_128;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_129> AgradCcdfLogInvGamma_vv_129;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_130> AgradCcdfLogInvGamma_vv_130;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_131> AgradCcdfLogInvGamma_vv_131;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_132> AgradCcdfLogInvGamma_vv_132;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_133> AgradCcdfLogInvGamma_vv_133;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_134> AgradCcdfLogInvGamma_vv_134;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_135> AgradCcdfLogInvGamma_vv_135;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_136> AgradCcdfLogInvGamma_vv_136;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_137> AgradCcdfLogInvGamma_vv_137;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_138> AgradCcdfLogInvGamma_vv_138;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_139> AgradCcdfLogInvGamma_vv_139;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_140> AgradCcdfLogInvGamma_vv_140;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_141> AgradCcdfLogInvGamma_vv_141;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_142> AgradCcdfLogInvGamma_vv_142;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_143> AgradCcdfLogInvGamma_vv_143;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_144> AgradCcdfLogInvGamma_vv_144;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_145> AgradCcdfLogInvGamma_vv_145;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_146> AgradCcdfLogInvGamma_vv_146;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_147> AgradCcdfLogInvGamma_vv_147;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_148> AgradCcdfLogInvGamma_vv_148;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_149> AgradCcdfLogInvGamma_vv_149;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_150> AgradCcdfLogInvGamma_vv_150;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_151> AgradCcdfLogInvGamma_vv_151;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_152> AgradCcdfLogInvGamma_vv_152;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_153> AgradCcdfLogInvGamma_vv_153;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_154> AgradCcdfLogInvGamma_vv_154;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_155> AgradCcdfLogInvGamma_vv_155;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_156> AgradCcdfLogInvGamma_vv_156;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_157> AgradCcdfLogInvGamma_vv_157;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_158> AgradCcdfLogInvGamma_vv_158;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_159> AgradCcdfLogInvGamma_vv_159;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_160> AgradCcdfLogInvGamma_vv_160;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_161> AgradCcdfLogInvGamma_vv_161;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_162> AgradCcdfLogInvGamma_vv_162;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_163> AgradCcdfLogInvGamma_vv_163;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_164> AgradCcdfLogInvGamma_vv_164;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_165> AgradCcdfLogInvGamma_vv_165;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_166> AgradCcdfLogInvGamma_vv_166;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_167> AgradCcdfLogInvGamma_vv_167;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_168> AgradCcdfLogInvGamma_vv_168;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_169> AgradCcdfLogInvGamma_vv_169;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_170> AgradCcdfLogInvGamma_vv_170;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_171> AgradCcdfLogInvGamma_vv_171;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_172> AgradCcdfLogInvGamma_vv_172;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_173> AgradCcdfLogInvGamma_vv_173;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_174> AgradCcdfLogInvGamma_vv_174;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_175> AgradCcdfLogInvGamma_vv_175;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_176> AgradCcdfLogInvGamma_vv_176;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_177> AgradCcdfLogInvGamma_vv_177;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_178> AgradCcdfLogInvGamma_vv_178;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_179> AgradCcdfLogInvGamma_vv_179;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_180> AgradCcdfLogInvGamma_vv_180;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_181> AgradCcdfLogInvGamma_vv_181;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_182> AgradCcdfLogInvGamma_vv_182;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_183> AgradCcdfLogInvGamma_vv_183;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_184> AgradCcdfLogInvGamma_vv_184;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_185> AgradCcdfLogInvGamma_vv_185;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_186> AgradCcdfLogInvGamma_vv_186;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_187> AgradCcdfLogInvGamma_vv_187;
+typedef std::tuple<AgradCcdfLogInvGamma, type_vv_188> AgradCcdfLogInvGamma_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_200> AgradCcdfLogInvGamma_v_200;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_201> AgradCcdfLogInvGamma_v_201;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_202> AgradCcdfLogInvGamma_v_202;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_203> AgradCcdfLogInvGamma_v_203;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_204> AgradCcdfLogInvGamma_v_204;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_205> AgradCcdfLogInvGamma_v_205;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_206> AgradCcdfLogInvGamma_v_206;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_207> AgradCcdfLogInvGamma_v_207;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_208> AgradCcdfLogInvGamma_v_208;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_209> AgradCcdfLogInvGamma_v_209;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_210> AgradCcdfLogInvGamma_v_210;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_211> AgradCcdfLogInvGamma_v_211;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_212> AgradCcdfLogInvGamma_v_212;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_213> AgradCcdfLogInvGamma_v_213;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_214> AgradCcdfLogInvGamma_v_214;
+typedef std::tuple<AgradCcdfLogInvGamma, type_v_215> AgradCcdfLogInvGamma_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_200, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_201, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_202, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_203, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_204, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_205, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_206, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_207, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_208, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_209, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_210, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_211, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_212, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_213, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_214, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogInvGamma_v_215, AgradCcdfLogTestFixture, AgradCcdfLogInvGamma_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfInvGamma, type_ffv_0> AgradCdfInvGamma_ffv_0;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_1> AgradCdfInvGamma_ffv_1;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_2> AgradCdfInvGamma_ffv_2;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_3> AgradCdfInvGamma_ffv_3;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_4> AgradCdfInvGamma_ffv_4;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_5> AgradCdfInvGamma_ffv_5;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_6> AgradCdfInvGamma_ffv_6;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_7> AgradCdfInvGamma_ffv_7;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_8> AgradCdfInvGamma_ffv_8;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_9> AgradCdfInvGamma_ffv_9;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_10> AgradCdfInvGamma_ffv_10;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_11> AgradCdfInvGamma_ffv_11;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_12> AgradCdfInvGamma_ffv_12;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_13> AgradCdfInvGamma_ffv_13;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_14> AgradCdfInvGamma_ffv_14;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_15> AgradCdfInvGamma_ffv_15;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_16> AgradCdfInvGamma_ffv_16;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_17> AgradCdfInvGamma_ffv_17;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_18> AgradCdfInvGamma_ffv_18;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_19> AgradCdfInvGamma_ffv_19;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_20> AgradCdfInvGamma_ffv_20;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_21> AgradCdfInvGamma_ffv_21;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_22> AgradCdfInvGamma_ffv_22;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_23> AgradCdfInvGamma_ffv_23;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_24> AgradCdfInvGamma_ffv_24;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_25> AgradCdfInvGamma_ffv_25;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_26> AgradCdfInvGamma_ffv_26;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_27> AgradCdfInvGamma_ffv_27;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_28> AgradCdfInvGamma_ffv_28;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_29> AgradCdfInvGamma_ffv_29;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_30> AgradCdfInvGamma_ffv_30;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_31> AgradCdfInvGamma_ffv_31;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_32> AgradCdfInvGamma_ffv_32;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_33> AgradCdfInvGamma_ffv_33;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_34> AgradCdfInvGamma_ffv_34;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_35> AgradCdfInvGamma_ffv_35;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_36> AgradCdfInvGamma_ffv_36;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_37> AgradCdfInvGamma_ffv_37;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_38> AgradCdfInvGamma_ffv_38;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_39> AgradCdfInvGamma_ffv_39;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_40> AgradCdfInvGamma_ffv_40;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_41> AgradCdfInvGamma_ffv_41;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_42> AgradCdfInvGamma_ffv_42;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_43> AgradCdfInvGamma_ffv_43;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_44> AgradCdfInvGamma_ffv_44;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_45> AgradCdfInvGamma_ffv_45;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_46> AgradCdfInvGamma_ffv_46;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_47> AgradCdfInvGamma_ffv_47;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_48> AgradCdfInvGamma_ffv_48;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_49> AgradCdfInvGamma_ffv_49;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_50> AgradCdfInvGamma_ffv_50;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_51> AgradCdfInvGamma_ffv_51;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_52> AgradCdfInvGamma_ffv_52;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_53> AgradCdfInvGamma_ffv_53;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_54> AgradCdfInvGamma_ffv_54;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_55> AgradCdfInvGamma_ffv_55;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_56> AgradCdfInvGamma_ffv_56;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_57> AgradCdfInvGamma_ffv_57;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_58> AgradCdfInvGamma_ffv_58;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_59> AgradCdfInvGamma_ffv_59;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_60> AgradCdfInvGamma_ffv_60;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_61> AgradCdfInvGamma_ffv_61;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_62> AgradCdfInvGamma_ffv_62;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_63> AgradCdfInvGamma_ffv_63;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_64> AgradCdfInvGamma_ffv_64;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_65> AgradCdfInvGamma_ffv_65;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_66> AgradCdfInvGamma_ffv_66;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_67> AgradCdfInvGamma_ffv_67;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_68> AgradCdfInvGamma_ffv_68;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_69> AgradCdfInvGamma_ffv_69;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_70> AgradCdfInvGamma_ffv_70;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_71> AgradCdfInvGamma_ffv_71;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_72> AgradCdfInvGamma_ffv_72;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_73> AgradCdfInvGamma_ffv_73;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_74> AgradCdfInvGamma_ffv_74;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_75> AgradCdfInvGamma_ffv_75;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_76> AgradCdfInvGamma_ffv_76;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_77> AgradCdfInvGamma_ffv_77;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_78> AgradCdfInvGamma_ffv_78;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_79> AgradCdfInvGamma_ffv_79;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_80> AgradCdfInvGamma_ffv_80;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_81> AgradCdfInvGamma_ffv_81;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_82> AgradCdfInvGamma_ffv_82;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_83> AgradCdfInvGamma_ffv_83;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_84> AgradCdfInvGamma_ffv_84;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_85> AgradCdfInvGamma_ffv_85;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_86> AgradCdfInvGamma_ffv_86;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_87> AgradCdfInvGamma_ffv_87;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_88> AgradCdfInvGamma_ffv_88;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_89> AgradCdfInvGamma_ffv_89;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_90> AgradCdfInvGamma_ffv_90;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_91> AgradCdfInvGamma_ffv_91;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_92> AgradCdfInvGamma_ffv_92;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_93> AgradCdfInvGamma_ffv_93;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_94> AgradCdfInvGamma_ffv_94;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_95> AgradCdfInvGamma_ffv_95;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_96> AgradCdfInvGamma_ffv_96;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_97> AgradCdfInvGamma_ffv_97;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_98> AgradCdfInvGamma_ffv_98;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_99> AgradCdfInvGamma_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_0, AgradCdfTestFixture, AgradCdfInvGamma_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_1, AgradCdfTestFixture, AgradCdfInvGamma_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_2, AgradCdfTestFixture, AgradCdfInvGamma_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_3, AgradCdfTestFixture, AgradCdfInvGamma_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_4, AgradCdfTestFixture, AgradCdfInvGamma_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_5, AgradCdfTestFixture, AgradCdfInvGamma_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_6, AgradCdfTestFixture, AgradCdfInvGamma_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_7, AgradCdfTestFixture, AgradCdfInvGamma_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_8, AgradCdfTestFixture, AgradCdfInvGamma_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_9, AgradCdfTestFixture, AgradCdfInvGamma_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_10, AgradCdfTestFixture, AgradCdfInvGamma_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_11, AgradCdfTestFixture, AgradCdfInvGamma_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_12, AgradCdfTestFixture, AgradCdfInvGamma_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_13, AgradCdfTestFixture, AgradCdfInvGamma_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_14, AgradCdfTestFixture, AgradCdfInvGamma_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_15, AgradCdfTestFixture, AgradCdfInvGamma_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_16, AgradCdfTestFixture, AgradCdfInvGamma_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_17, AgradCdfTestFixture, AgradCdfInvGamma_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_18, AgradCdfTestFixture, AgradCdfInvGamma_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_19, AgradCdfTestFixture, AgradCdfInvGamma_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_20, AgradCdfTestFixture, AgradCdfInvGamma_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_21, AgradCdfTestFixture, AgradCdfInvGamma_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_22, AgradCdfTestFixture, AgradCdfInvGamma_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_23, AgradCdfTestFixture, AgradCdfInvGamma_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_24, AgradCdfTestFixture, AgradCdfInvGamma_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_25, AgradCdfTestFixture, AgradCdfInvGamma_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_26, AgradCdfTestFixture, AgradCdfInvGamma_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_27, AgradCdfTestFixture, AgradCdfInvGamma_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_28, AgradCdfTestFixture, AgradCdfInvGamma_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_29, AgradCdfTestFixture, AgradCdfInvGamma_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_30, AgradCdfTestFixture, AgradCdfInvGamma_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_31, AgradCdfTestFixture, AgradCdfInvGamma_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_32, AgradCdfTestFixture, AgradCdfInvGamma_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_33, AgradCdfTestFixture, AgradCdfInvGamma_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_34, AgradCdfTestFixture, AgradCdfInvGamma_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_35, AgradCdfTestFixture, AgradCdfInvGamma_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_36, AgradCdfTestFixture, AgradCdfInvGamma_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_37, AgradCdfTestFixture, AgradCdfInvGamma_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_38, AgradCdfTestFixture, AgradCdfInvGamma_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_39, AgradCdfTestFixture, AgradCdfInvGamma_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_40, AgradCdfTestFixture, AgradCdfInvGamma_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_41, AgradCdfTestFixture, AgradCdfInvGamma_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_42, AgradCdfTestFixture, AgradCdfInvGamma_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_43, AgradCdfTestFixture, AgradCdfInvGamma_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_44, AgradCdfTestFixture, AgradCdfInvGamma_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_45, AgradCdfTestFixture, AgradCdfInvGamma_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_46, AgradCdfTestFixture, AgradCdfInvGamma_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_47, AgradCdfTestFixture, AgradCdfInvGamma_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_48, AgradCdfTestFixture, AgradCdfInvGamma_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_49, AgradCdfTestFixture, AgradCdfInvGamma_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_50, AgradCdfTestFixture, AgradCdfInvGamma_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_51, AgradCdfTestFixture, AgradCdfInvGamma_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_52, AgradCdfTestFixture, AgradCdfInvGamma_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_53, AgradCdfTestFixture, AgradCdfInvGamma_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_54, AgradCdfTestFixture, AgradCdfInvGamma_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_55, AgradCdfTestFixture, AgradCdfInvGamma_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_56, AgradCdfTestFixture, AgradCdfInvGamma_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_57, AgradCdfTestFixture, AgradCdfInvGamma_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_58, AgradCdfTestFixture, AgradCdfInvGamma_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_59, AgradCdfTestFixture, AgradCdfInvGamma_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_60, AgradCdfTestFixture, AgradCdfInvGamma_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_61, AgradCdfTestFixture, AgradCdfInvGamma_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_62, AgradCdfTestFixture, AgradCdfInvGamma_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_63, AgradCdfTestFixture, AgradCdfInvGamma_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_64, AgradCdfTestFixture, AgradCdfInvGamma_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_65, AgradCdfTestFixture, AgradCdfInvGamma_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_66, AgradCdfTestFixture, AgradCdfInvGamma_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_67, AgradCdfTestFixture, AgradCdfInvGamma_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_68, AgradCdfTestFixture, AgradCdfInvGamma_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_69, AgradCdfTestFixture, AgradCdfInvGamma_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_70, AgradCdfTestFixture, AgradCdfInvGamma_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_71, AgradCdfTestFixture, AgradCdfInvGamma_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_72, AgradCdfTestFixture, AgradCdfInvGamma_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_73, AgradCdfTestFixture, AgradCdfInvGamma_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_74, AgradCdfTestFixture, AgradCdfInvGamma_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_75, AgradCdfTestFixture, AgradCdfInvGamma_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_76, AgradCdfTestFixture, AgradCdfInvGamma_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_77, AgradCdfTestFixture, AgradCdfInvGamma_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_78, AgradCdfTestFixture, AgradCdfInvGamma_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_79, AgradCdfTestFixture, AgradCdfInvGamma_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_80, AgradCdfTestFixture, AgradCdfInvGamma_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_81, AgradCdfTestFixture, AgradCdfInvGamma_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_82, AgradCdfTestFixture, AgradCdfInvGamma_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_83, AgradCdfTestFixture, AgradCdfInvGamma_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_84, AgradCdfTestFixture, AgradCdfInvGamma_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_85, AgradCdfTestFixture, AgradCdfInvGamma_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_86, AgradCdfTestFixture, AgradCdfInvGamma_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_87, AgradCdfTestFixture, AgradCdfInvGamma_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_88, AgradCdfTestFixture, AgradCdfInvGamma_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_89, AgradCdfTestFixture, AgradCdfInvGamma_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_90, AgradCdfTestFixture, AgradCdfInvGamma_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_91, AgradCdfTestFixture, AgradCdfInvGamma_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_92, AgradCdfTestFixture, AgradCdfInvGamma_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_93, AgradCdfTestFixture, AgradCdfInvGamma_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_94, AgradCdfTestFixture, AgradCdfInvGamma_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_95, AgradCdfTestFixture, AgradCdfInvGamma_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_96, AgradCdfTestFixture, AgradCdfInvGamma_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_97, AgradCdfTestFixture, AgradCdfInvGamma_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_98, AgradCdfTestFixture, AgradCdfInvGamma_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_99, AgradCdfTestFixture, AgradCdfInvGamma_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfInvGamma, type_v_0> AgradCdfInvGamma_v_0;
+typedef std::tuple<AgradCdfInvGamma, type_v_1> AgradCdfInvGamma_v_1;
+typedef std::tuple<AgradCdfInvGamma, type_v_2> AgradCdfInvGamma_v_2;
+typedef std::tuple<AgradCdfInvGamma, type_v_3> AgradCdfInvGamma_v_3;
+typedef std::tuple<AgradCdfInvGamma, type_v_4> AgradCdfInvGamma_v_4;
+typedef std::tuple<AgradCdfInvGamma, type_v_5> AgradCdfInvGamma_v_5;
+typedef std::tuple<AgradCdfInvGamma, type_v_6> AgradCdfInvGamma_v_6;
+typedef std::tuple<AgradCdfInvGamma, type_v_7> AgradCdfInvGamma_v_7;
+typedef std::tuple<AgradCdfInvGamma, type_v_8> AgradCdfInvGamma_v_8;
+typedef std::tuple<AgradCdfInvGamma, type_v_9> AgradCdfInvGamma_v_9;
+typedef std::tuple<AgradCdfInvGamma, type_v_10> AgradCdfInvGamma_v_10;
+typedef std::tuple<AgradCdfInvGamma, type_v_11> AgradCdfInvGamma_v_11;
+typedef std::tuple<AgradCdfInvGamma, type_v_12> AgradCdfInvGamma_v_12;
+typedef std::tuple<AgradCdfInvGamma, type_v_13> AgradCdfInvGamma_v_13;
+typedef std::tuple<AgradCdfInvGamma, type_v_14> AgradCdfInvGamma_v_14;
+typedef std::tuple<AgradCdfInvGamma, type_v_15> AgradCdfInvGamma_v_15;
+typedef std::tuple<AgradCdfInvGamma, type_v_16> AgradCdfInvGamma_v_16;
+typedef std::tuple<AgradCdfInvGamma, type_v_17> AgradCdfInvGamma_v_17;
+typedef std::tuple<AgradCdfInvGamma, type_v_18> AgradCdfInvGamma_v_18;
+typedef std::tuple<AgradCdfInvGamma, type_v_19> AgradCdfInvGamma_v_19;
+typedef std::tuple<AgradCdfInvGamma, type_v_20> AgradCdfInvGamma_v_20;
+typedef std::tuple<AgradCdfInvGamma, type_v_21> AgradCdfInvGamma_v_21;
+typedef std::tuple<AgradCdfInvGamma, type_v_22> AgradCdfInvGamma_v_22;
+typedef std::tuple<AgradCdfInvGamma, type_v_23> AgradCdfInvGamma_v_23;
+typedef std::tuple<AgradCdfInvGamma, type_v_24> AgradCdfInvGamma_v_24;
+typedef std::tuple<AgradCdfInvGamma, type_v_25> AgradCdfInvGamma_v_25;
+typedef std::tuple<AgradCdfInvGamma, type_v_26> AgradCdfInvGamma_v_26;
+typedef std::tuple<AgradCdfInvGamma, type_v_27> AgradCdfInvGamma_v_27;
+typedef std::tuple<AgradCdfInvGamma, type_v_28> AgradCdfInvGamma_v_28;
+typedef std::tuple<AgradCdfInvGamma, type_v_29> AgradCdfInvGamma_v_29;
+typedef std::tuple<AgradCdfInvGamma, type_v_30> AgradCdfInvGamma_v_30;
+typedef std::tuple<AgradCdfInvGamma, type_v_31> AgradCdfInvGamma_v_31;
+typedef std::tuple<AgradCdfInvGamma, type_v_32> AgradCdfInvGamma_v_32;
+typedef std::tuple<AgradCdfInvGamma, type_v_33> AgradCdfInvGamma_v_33;
+typedef std::tuple<AgradCdfInvGamma, type_v_34> AgradCdfInvGamma_v_34;
+typedef std::tuple<AgradCdfInvGamma, type_v_35> AgradCdfInvGamma_v_35;
+typedef std::tuple<AgradCdfInvGamma, type_v_36> AgradCdfInvGamma_v_36;
+typedef std::tuple<AgradCdfInvGamma, type_v_37> AgradCdfInvGamma_v_37;
+typedef std::tuple<AgradCdfInvGamma, type_v_38> AgradCdfInvGamma_v_38;
+typedef std::tuple<AgradCdfInvGamma, type_v_39> AgradCdfInvGamma_v_39;
+typedef std::tuple<AgradCdfInvGamma, type_v_40> AgradCdfInvGamma_v_40;
+typedef std::tuple<AgradCdfInvGamma, type_v_41> AgradCdfInvGamma_v_41;
+typedef std::tuple<AgradCdfInvGamma, type_v_42> AgradCdfInvGamma_v_42;
+typedef std::tuple<AgradCdfInvGamma, type_v_43> AgradCdfInvGamma_v_43;
+typedef std::tuple<AgradCdfInvGamma, type_v_44> AgradCdfInvGamma_v_44;
+typedef std::tuple<AgradCdfInvGamma, type_v_45> AgradCdfInvGamma_v_45;
+typedef std::tuple<AgradCdfInvGamma, type_v_46> AgradCdfInvGamma_v_46;
+typedef std::tuple<AgradCdfInvGamma, type_v_47> AgradCdfInvGamma_v_47;
+typedef std::tuple<AgradCdfInvGamma, type_v_48> AgradCdfInvGamma_v_48;
+typedef std::tuple<AgradCdfInvGamma, type_v_49> AgradCdfInvGamma_v_49;
+typedef std::tuple<AgradCdfInvGamma, type_v_50> AgradCdfInvGamma_v_50;
+typedef std::tuple<AgradCdfInvGamma, type_v_51> AgradCdfInvGamma_v_51;
+typedef std::tuple<AgradCdfInvGamma, type_v_52> AgradCdfInvGamma_v_52;
+typedef std::tuple<AgradCdfInvGamma, type_v_53> AgradCdfInvGamma_v_53;
+typedef std::tuple<AgradCdfInvGamma, type_v_54> AgradCdfInvGamma_v_54;
+typedef std::tuple<AgradCdfInvGamma, type_v_55> AgradCdfInvGamma_v_55;
+typedef std::tuple<AgradCdfInvGamma, type_v_56> AgradCdfInvGamma_v_56;
+typedef std::tuple<AgradCdfInvGamma, type_v_57> AgradCdfInvGamma_v_57;
+typedef std::tuple<AgradCdfInvGamma, type_v_58> AgradCdfInvGamma_v_58;
+typedef std::tuple<AgradCdfInvGamma, type_v_59> AgradCdfInvGamma_v_59;
+typedef std::tuple<AgradCdfInvGamma, type_v_60> AgradCdfInvGamma_v_60;
+typedef std::tuple<AgradCdfInvGamma, type_v_61> AgradCdfInvGamma_v_61;
+typedef std::tuple<AgradCdfInvGamma, type_v_62> AgradCdfInvGamma_v_62;
+typedef std::tuple<AgradCdfInvGamma, type_v_63> AgradCdfInvGamma_v_63;
+typedef std::tuple<AgradCdfInvGamma, type_v_64> AgradCdfInvGamma_v_64;
+typedef std::tuple<AgradCdfInvGamma, type_v_65> AgradCdfInvGamma_v_65;
+typedef std::tuple<AgradCdfInvGamma, type_v_66> AgradCdfInvGamma_v_66;
+typedef std::tuple<AgradCdfInvGamma, type_v_67> AgradCdfInvGamma_v_67;
+typedef std::tuple<AgradCdfInvGamma, type_v_68> AgradCdfInvGamma_v_68;
+typedef std::tuple<AgradCdfInvGamma, type_v_69> AgradCdfInvGamma_v_69;
+typedef std::tuple<AgradCdfInvGamma, type_v_70> AgradCdfInvGamma_v_70;
+typedef std::tuple<AgradCdfInvGamma, type_v_71> AgradCdfInvGamma_v_71;
+typedef std::tuple<AgradCdfInvGamma, type_v_72> AgradCdfInvGamma_v_72;
+typedef std::tuple<AgradCdfInvGamma, type_v_73> AgradCdfInvGamma_v_73;
+typedef std::tuple<AgradCdfInvGamma, type_v_74> AgradCdfInvGamma_v_74;
+typedef std::tuple<AgradCdfInvGamma, type_v_75> AgradCdfInvGamma_v_75;
+typedef std::tuple<AgradCdfInvGamma, type_v_76> AgradCdfInvGamma_v_76;
+typedef std::tuple<AgradCdfInvGamma, type_v_77> AgradCdfInvGamma_v_77;
+typedef std::tuple<AgradCdfInvGamma, type_v_78> AgradCdfInvGamma_v_78;
+typedef std::tuple<AgradCdfInvGamma, type_v_79> AgradCdfInvGamma_v_79;
+typedef std::tuple<AgradCdfInvGamma, type_v_80> AgradCdfInvGamma_v_80;
+typedef std::tuple<AgradCdfInvGamma, type_v_81> AgradCdfInvGamma_v_81;
+typedef std::tuple<AgradCdfInvGamma, type_v_82> AgradCdfInvGamma_v_82;
+typedef std::tuple<AgradCdfInvGamma, type_v_83> AgradCdfInvGamma_v_83;
+typedef std::tuple<AgradCdfInvGamma, type_v_84> AgradCdfInvGamma_v_84;
+typedef std::tuple<AgradCdfInvGamma, type_v_85> AgradCdfInvGamma_v_85;
+typedef std::tuple<AgradCdfInvGamma, type_v_86> AgradCdfInvGamma_v_86;
+typedef std::tuple<AgradCdfInvGamma, type_v_87> AgradCdfInvGamma_v_87;
+typedef std::tuple<AgradCdfInvGamma, type_v_88> AgradCdfInvGamma_v_88;
+typedef std::tuple<AgradCdfInvGamma, type_v_89> AgradCdfInvGamma_v_89;
+typedef std::tuple<AgradCdfInvGamma, type_v_90> AgradCdfInvGamma_v_90;
+typedef std::tuple<AgradCdfInvGamma, type_v_91> AgradCdfInvGamma_v_91;
+typedef std::tuple<AgradCdfInvGamma, type_v_92> AgradCdfInvGamma_v_92;
+typedef std::tuple<AgradCdfInvGamma, type_v_93> AgradCdfInvGamma_v_93;
+typedef std::tuple<AgradCdfInvGamma, type_v_94> AgradCdfInvGamma_v_94;
+typedef std::tuple<AgradCdfInvGamma, type_v_95> AgradCdfInvGamma_v_95;
+typedef std::tuple<AgradCdfInvGamma, type_v_96> AgradCdfInvGamma_v_96;
+typedef std::tuple<AgradCdfInvGamma, type_v_97> AgradCdfInvGamma_v_97;
+typedef std::tuple<AgradCdfInvGamma, type_v_98> AgradCdfInvGamma_v_98;
+typedef std::tuple<AgradCdfInvGamma, type_v_99> AgradCdfInvGamma_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_0, AgradCdfTestFixture, AgradCdfInvGamma_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_1, AgradCdfTestFixture, AgradCdfInvGamma_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_2, AgradCdfTestFixture, AgradCdfInvGamma_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_3, AgradCdfTestFixture, AgradCdfInvGamma_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_4, AgradCdfTestFixture, AgradCdfInvGamma_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_5, AgradCdfTestFixture, AgradCdfInvGamma_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_6, AgradCdfTestFixture, AgradCdfInvGamma_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_7, AgradCdfTestFixture, AgradCdfInvGamma_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_8, AgradCdfTestFixture, AgradCdfInvGamma_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_9, AgradCdfTestFixture, AgradCdfInvGamma_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_10, AgradCdfTestFixture, AgradCdfInvGamma_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_11, AgradCdfTestFixture, AgradCdfInvGamma_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_12, AgradCdfTestFixture, AgradCdfInvGamma_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_13, AgradCdfTestFixture, AgradCdfInvGamma_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_14, AgradCdfTestFixture, AgradCdfInvGamma_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_15, AgradCdfTestFixture, AgradCdfInvGamma_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_16, AgradCdfTestFixture, AgradCdfInvGamma_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_17, AgradCdfTestFixture, AgradCdfInvGamma_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_18, AgradCdfTestFixture, AgradCdfInvGamma_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_19, AgradCdfTestFixture, AgradCdfInvGamma_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_20, AgradCdfTestFixture, AgradCdfInvGamma_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_21, AgradCdfTestFixture, AgradCdfInvGamma_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_22, AgradCdfTestFixture, AgradCdfInvGamma_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_23, AgradCdfTestFixture, AgradCdfInvGamma_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_24, AgradCdfTestFixture, AgradCdfInvGamma_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_25, AgradCdfTestFixture, AgradCdfInvGamma_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_26, AgradCdfTestFixture, AgradCdfInvGamma_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_27, AgradCdfTestFixture, AgradCdfInvGamma_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_28, AgradCdfTestFixture, AgradCdfInvGamma_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_29, AgradCdfTestFixture, AgradCdfInvGamma_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_30, AgradCdfTestFixture, AgradCdfInvGamma_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_31, AgradCdfTestFixture, AgradCdfInvGamma_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_32, AgradCdfTestFixture, AgradCdfInvGamma_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_33, AgradCdfTestFixture, AgradCdfInvGamma_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_34, AgradCdfTestFixture, AgradCdfInvGamma_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_35, AgradCdfTestFixture, AgradCdfInvGamma_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_36, AgradCdfTestFixture, AgradCdfInvGamma_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_37, AgradCdfTestFixture, AgradCdfInvGamma_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_38, AgradCdfTestFixture, AgradCdfInvGamma_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_39, AgradCdfTestFixture, AgradCdfInvGamma_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_40, AgradCdfTestFixture, AgradCdfInvGamma_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_41, AgradCdfTestFixture, AgradCdfInvGamma_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_42, AgradCdfTestFixture, AgradCdfInvGamma_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_43, AgradCdfTestFixture, AgradCdfInvGamma_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_44, AgradCdfTestFixture, AgradCdfInvGamma_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_45, AgradCdfTestFixture, AgradCdfInvGamma_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_46, AgradCdfTestFixture, AgradCdfInvGamma_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_47, AgradCdfTestFixture, AgradCdfInvGamma_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_48, AgradCdfTestFixture, AgradCdfInvGamma_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_49, AgradCdfTestFixture, AgradCdfInvGamma_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_50, AgradCdfTestFixture, AgradCdfInvGamma_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_51, AgradCdfTestFixture, AgradCdfInvGamma_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_52, AgradCdfTestFixture, AgradCdfInvGamma_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_53, AgradCdfTestFixture, AgradCdfInvGamma_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_54, AgradCdfTestFixture, AgradCdfInvGamma_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_55, AgradCdfTestFixture, AgradCdfInvGamma_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_56, AgradCdfTestFixture, AgradCdfInvGamma_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_57, AgradCdfTestFixture, AgradCdfInvGamma_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_58, AgradCdfTestFixture, AgradCdfInvGamma_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_59, AgradCdfTestFixture, AgradCdfInvGamma_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_60, AgradCdfTestFixture, AgradCdfInvGamma_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_61, AgradCdfTestFixture, AgradCdfInvGamma_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_62, AgradCdfTestFixture, AgradCdfInvGamma_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_63, AgradCdfTestFixture, AgradCdfInvGamma_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_64, AgradCdfTestFixture, AgradCdfInvGamma_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_65, AgradCdfTestFixture, AgradCdfInvGamma_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_66, AgradCdfTestFixture, AgradCdfInvGamma_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_67, AgradCdfTestFixture, AgradCdfInvGamma_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_68, AgradCdfTestFixture, AgradCdfInvGamma_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_69, AgradCdfTestFixture, AgradCdfInvGamma_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_70, AgradCdfTestFixture, AgradCdfInvGamma_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_71, AgradCdfTestFixture, AgradCdfInvGamma_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_72, AgradCdfTestFixture, AgradCdfInvGamma_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_73, AgradCdfTestFixture, AgradCdfInvGamma_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_74, AgradCdfTestFixture, AgradCdfInvGamma_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_75, AgradCdfTestFixture, AgradCdfInvGamma_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_76, AgradCdfTestFixture, AgradCdfInvGamma_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_77, AgradCdfTestFixture, AgradCdfInvGamma_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_78, AgradCdfTestFixture, AgradCdfInvGamma_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_79, AgradCdfTestFixture, AgradCdfInvGamma_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_80, AgradCdfTestFixture, AgradCdfInvGamma_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_81, AgradCdfTestFixture, AgradCdfInvGamma_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_82, AgradCdfTestFixture, AgradCdfInvGamma_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_83, AgradCdfTestFixture, AgradCdfInvGamma_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_84, AgradCdfTestFixture, AgradCdfInvGamma_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_85, AgradCdfTestFixture, AgradCdfInvGamma_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_86, AgradCdfTestFixture, AgradCdfInvGamma_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_87, AgradCdfTestFixture, AgradCdfInvGamma_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_88, AgradCdfTestFixture, AgradCdfInvGamma_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_89, AgradCdfTestFixture, AgradCdfInvGamma_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_90, AgradCdfTestFixture, AgradCdfInvGamma_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_91, AgradCdfTestFixture, AgradCdfInvGamma_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_92, AgradCdfTestFixture, AgradCdfInvGamma_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_93, AgradCdfTestFixture, AgradCdfInvGamma_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_94, AgradCdfTestFixture, AgradCdfInvGamma_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_95, AgradCdfTestFixture, AgradCdfInvGamma_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_96, AgradCdfTestFixture, AgradCdfInvGamma_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_97, AgradCdfTestFixture, AgradCdfInvGamma_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_98, AgradCdfTestFixture, AgradCdfInvGamma_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_99, AgradCdfTestFixture, AgradCdfInvGamma_v_99);
+
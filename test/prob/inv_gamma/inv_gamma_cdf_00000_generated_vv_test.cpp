@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfInvGamma, type_vv_0> AgradCdfInvGamma_vv_0;
+typedef std::tuple<AgradCdfInvGamma, type_vv_1> AgradCdfInvGamma_vv_1;
+typedef std::tuple<AgradCdfInvGamma, type_vv_2> AgradCdfInvGamma_vv_2;
+typedef std::tuple<AgradCdfInvGamma, type_vv_3> AgradCdfInvGamma_vv_3;
+typedef std::tuple<AgradCdfInvGamma, type_vv_4> AgradCdfInvGamma_vv_4;
+typedef std::tuple<AgradCdfInvGamma, type_vv_5> AgradCdfInvGamma_vv_5;
+typedef std::tuple<AgradCdfInvGamma, type_vv_6> AgradCdfInvGamma_vv_6;
+typedef std::tuple<AgradCdfInvGamma, type_vv_7> AgradCdfInvGamma_vv_7;
+typedef std::tuple<AgradCdfInvGamma, type_vv_8> AgradCdfInvGamma_vv_8;
+typedef std::tuple<AgradCdfInvGamma, type_vv_9> AgradCdfInvGamma_vv_9;
+typedef std::tuple<AgradCdfInvGamma, type_vv_10> AgradCdfInvGamma_vv_10;
+typedef std::tuple<AgradCdfInvGamma, type_vv_11> AgradCdfInvGamma_vv_11;
+typedef std::tuple<AgradCdfInvGamma, type_vv_12> AgradCdfInvGamma_vv_12;
+typedef std::tuple<AgradCdfInvGamma, type_vv_13> AgradCdfInvGamma_vv_13;
+typedef std::tuple<AgradCdfInvGamma, type_vv_14> AgradCdfInvGamma_vv_14;
+typedef std::tuple<AgradCdfInvGamma, type_vv_15> AgradCdfInvGamma_vv_15;
+typedef std::tuple<AgradCdfInvGamma, type_vv_16> AgradCdfInvGamma_vv_16;
+typedef std::tuple<AgradCdfInvGamma, type_vv_17> AgradCdfInvGamma_vv_17;
+typedef std::tuple<AgradCdfInvGamma, type_vv_18> AgradCdfInvGamma_vv_18;
+typedef std::tuple<AgradCdfInvGamma, type_vv_19> AgradCdfInvGamma_vv_19;
+typedef std::tuple<AgradCdfInvGamma, type_vv_20> AgradCdfInvGamma_vv_20;
+typedef std::tuple<AgradCdfInvGamma, type_vv_21> AgradCdfInvGamma_vv_21;
+typedef std::tuple<AgradCdfInvGamma, type_vv_22> AgradCdfInvGamma_vv_22;
+typedef std::tuple<AgradCdfInvGamma, type_vv_23> AgradCdfInvGamma_vv_23;
+typedef std::tuple<AgradCdfInvGamma, type_vv_24> AgradCdfInvGamma_vv_24;
+typedef std::tuple<AgradCdfInvGamma, type_vv_25> AgradCdfInvGamma_vv_25;
+typedef std::tuple<AgradCdfInvGamma, type_vv_26> AgradCdfInvGamma_vv_26;
+typedef std::tuple<AgradCdfInvGamma, type_vv_27> AgradCdfInvGamma_vv_27;
+typedef std::tuple<AgradCdfInvGamma, type_vv_28> AgradCdfInvGamma_vv_28;
+typedef std::tuple<AgradCdfInvGamma, type_vv_29> AgradCdfInvGamma_vv_29;
+typedef std::tuple<AgradCdfInvGamma, type_vv_30> AgradCdfInvGamma_vv_30;
+typedef std::tuple<AgradCdfInvGamma, type_vv_31> AgradCdfInvGamma_vv_31;
+typedef std::tuple<AgradCdfInvGamma, type_vv_32> AgradCdfInvGamma_vv_32;
+typedef std::tuple<AgradCdfInvGamma, type_vv_33> AgradCdfInvGamma_vv_33;
+typedef std::tuple<AgradCdfInvGamma, type_vv_34> AgradCdfInvGamma_vv_34;
+typedef std::tuple<AgradCdfInvGamma, type_vv_35> AgradCdfInvGamma_vv_35;
+typedef std::tuple<AgradCdfInvGamma, type_vv_36> AgradCdfInvGamma_vv_36;
+typedef std::tuple<AgradCdfInvGamma, type_vv_37> AgradCdfInvGamma_vv_37;
+typedef std::tuple<AgradCdfInvGamma, type_vv_38> AgradCdfInvGamma_vv_38;
+typedef std::tuple<AgradCdfInvGamma, type_vv_39> AgradCdfInvGamma_vv_39;
+typedef std::tuple<AgradCdfInvGamma, type_vv_40> AgradCdfInvGamma_vv_40;
+typedef std::tuple<AgradCdfInvGamma, type_vv_41> AgradCdfInvGamma_vv_41;
+typedef std::tuple<AgradCdfInvGamma, type_vv_42> AgradCdfInvGamma_vv_42;
+typedef std::tuple<AgradCdfInvGamma, type_vv_43> AgradCdfInvGamma_vv_43;
+typedef std::tuple<AgradCdfInvGamma, type_vv_44> AgradCdfInvGamma_vv_44;
+typedef std::tuple<AgradCdfInvGamma, type_vv_45> AgradCdfInvGamma_vv_45;
+typedef std::tuple<AgradCdfInvGamma, type_vv_46> AgradCdfInvGamma_vv_46;
+typedef std::tuple<AgradCdfInvGamma, type_vv_47> AgradCdfInvGamma_vv_47;
+typedef std::tuple<AgradCdfInvGamma, type_vv_48> AgradCdfInvGamma_vv_48;
+typedef std::tuple<AgradCdfInvGamma, type_vv_49> AgradCdfInvGamma_vv_49;
+typedef std::tuple<AgradCdfInvGamma, type_vv_50> AgradCdfInvGamma_vv_50;
+typedef std::tuple<AgradCdfInvGamma, type_vv_51> AgradCdfInvGamma_vv_51;
+typedef std::tuple<AgradCdfInvGamma, type_vv_52> AgradCdfInvGamma_vv_52;
+typedef std::tuple<AgradCdfInvGamma, type_vv_53> AgradCdfInvGamma_vv_53;
+typedef std::tuple<AgradCdfInvGamma, type_vv_54> AgradCdfInvGamma_vv_54;
+typedef std::tuple<AgradCdfInvGamma, type_vv_55> AgradCdfInvGamma_vv_55;
+typedef std::tuple<AgradCdfInvGamma, type_vv_56> AgradCdfInvGamma_vv_56;
+typedef std::tuple<AgradCdfInvGamma, type_vv_57> AgradCdfInvGamma_vv_57;
+typedef std::tuple<AgradCdfInvGamma, type_vv_58> AgradCdfInvGamma_vv_58;
+typedef std::tuple<AgradCdfInvGamma, type_vv_59> AgradCdfInvGamma_vv_59;
+typedef std::tuple<AgradCdfInvGamma, type_vv_60> AgradCdfInvGamma_vv_60;
+typedef std::tuple<AgradCdfInvGamma, type_vv_61> AgradCdfInvGamma_vv_61;
+typedef std::tuple<AgradCdfInvGamma, type_vv_62> AgradCdfInvGamma_vv_62;
+typedef std::tuple<AgradCdfInvGamma, type_vv_63> AgradCdfInvGamma_vv_63;
+typedef std::tuple<AgradCdfInvGamma, type_vv_64> AgradCdfInvGamma_vv_64;
+typedef std::tuple<AgradCdfInvGamma, type_vv_65> AgradCdfInvGamma_vv_65;
+typedef std::tuple<AgradCdfInvGamma, type_vv_66> AgradCdfInvGamma_vv_66;
+typedef std::tuple<AgradCdfInvGamma, type_vv_67> AgradCdfInvGamma_vv_67;
+typedef std::tuple<AgradCdfInvGamma, type_vv_68> AgradCdfInvGamma_vv_68;
+typedef std::tuple<AgradCdfInvGamma, type_vv_69> AgradCdfInvGamma_vv_69;
+typedef std::tuple<AgradCdfInvGamma, type_vv_70> AgradCdfInvGamma_vv_70;
+typedef std::tuple<AgradCdfInvGamma, type_vv_71> AgradCdfInvGamma_vv_71;
+typedef std::tuple<AgradCdfInvGamma, type_vv_72> AgradCdfInvGamma_vv_72;
+typedef std::tuple<AgradCdfInvGamma, type_vv_73> AgradCdfInvGamma_vv_73;
+typedef std::tuple<AgradCdfInvGamma, type_vv_74> AgradCdfInvGamma_vv_74;
+typedef std::tuple<AgradCdfInvGamma, type_vv_75> AgradCdfInvGamma_vv_75;
+typedef std::tuple<AgradCdfInvGamma, type_vv_76> AgradCdfInvGamma_vv_76;
+typedef std::tuple<AgradCdfInvGamma, type_vv_77> AgradCdfInvGamma_vv_77;
+typedef std::tuple<AgradCdfInvGamma, type_vv_78> AgradCdfInvGamma_vv_78;
+typedef std::tuple<AgradCdfInvGamma, type_vv_79> AgradCdfInvGamma_vv_79;
+typedef std::tuple<AgradCdfInvGamma, type_vv_80> AgradCdfInvGamma_vv_80;
+typedef std::tuple<AgradCdfInvGamma, type_vv_81> AgradCdfInvGamma_vv_81;
+typedef std::tuple<AgradCdfInvGamma, type_vv_82> AgradCdfInvGamma_vv_82;
+typedef std::tuple<AgradCdfInvGamma, type_vv_83> AgradCdfInvGamma_vv_83;
+typedef std::tuple<AgradCdfInvGamma, type_vv_84> AgradCdfInvGamma_vv_84;
+typedef std::tuple<AgradCdfInvGamma, type_vv_85> AgradCdfInvGamma_vv_85;
+typedef std::tuple<AgradCdfInvGamma, type_vv_86> AgradCdfInvGamma_vv_86;
+typedef std::tuple<AgradCdfInvGamma, type_vv_87> AgradCdfInvGamma_vv_87;
+typedef std::tuple<AgradCdfInvGamma, type_vv_88> AgradCdfInvGamma_vv_88;
+typedef std::tuple<AgradCdfInvGamma, type_vv_89> AgradCdfInvGamma_vv_89;
+typedef std::tuple<AgradCdfInvGamma, type_vv_90> AgradCdfInvGamma_vv_90;
+typedef std::tuple<AgradCdfInvGamma, type_vv_91> AgradCdfInvGamma_vv_91;
+typedef std::tuple<AgradCdfInvGamma, type_vv_92> AgradCdfInvGamma_vv_92;
+typedef std::tuple<AgradCdfInvGamma, type_vv_93> AgradCdfInvGamma_vv_93;
+typedef std::tuple<AgradCdfInvGamma, type_vv_94> AgradCdfInvGamma_vv_94;
+typedef std::tuple<AgradCdfInvGamma, type_vv_95> AgradCdfInvGamma_vv_95;
+typedef std::tuple<AgradCdfInvGamma, type_vv_96> AgradCdfInvGamma_vv_96;
+typedef std::tuple<AgradCdfInvGamma, type_vv_97> AgradCdfInvGamma_vv_97;
+typedef std::tuple<AgradCdfInvGamma, type_vv_98> AgradCdfInvGamma_vv_98;
+typedef std::tuple<AgradCdfInvGamma, type_vv_99> AgradCdfInvGamma_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_0, AgradCdfTestFixture, AgradCdfInvGamma_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_1, AgradCdfTestFixture, AgradCdfInvGamma_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_2, AgradCdfTestFixture, AgradCdfInvGamma_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_3, AgradCdfTestFixture, AgradCdfInvGamma_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_4, AgradCdfTestFixture, AgradCdfInvGamma_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_5, AgradCdfTestFixture, AgradCdfInvGamma_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_6, AgradCdfTestFixture, AgradCdfInvGamma_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_7, AgradCdfTestFixture, AgradCdfInvGamma_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_8, AgradCdfTestFixture, AgradCdfInvGamma_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_9, AgradCdfTestFixture, AgradCdfInvGamma_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_10, AgradCdfTestFixture, AgradCdfInvGamma_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_11, AgradCdfTestFixture, AgradCdfInvGamma_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_12, AgradCdfTestFixture, AgradCdfInvGamma_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_13, AgradCdfTestFixture, AgradCdfInvGamma_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_14, AgradCdfTestFixture, AgradCdfInvGamma_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_15, AgradCdfTestFixture, AgradCdfInvGamma_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_16, AgradCdfTestFixture, AgradCdfInvGamma_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_17, AgradCdfTestFixture, AgradCdfInvGamma_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_18, AgradCdfTestFixture, AgradCdfInvGamma_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_19, AgradCdfTestFixture, AgradCdfInvGamma_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_20, AgradCdfTestFixture, AgradCdfInvGamma_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_21, AgradCdfTestFixture, AgradCdfInvGamma_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_22, AgradCdfTestFixture, AgradCdfInvGamma_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_23, AgradCdfTestFixture, AgradCdfInvGamma_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_24, AgradCdfTestFixture, AgradCdfInvGamma_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_25, AgradCdfTestFixture, AgradCdfInvGamma_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_26, AgradCdfTestFixture, AgradCdfInvGamma_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_27, AgradCdfTestFixture, AgradCdfInvGamma_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_28, AgradCdfTestFixture, AgradCdfInvGamma_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_29, AgradCdfTestFixture, AgradCdfInvGamma_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_30, AgradCdfTestFixture, AgradCdfInvGamma_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_31, AgradCdfTestFixture, AgradCdfInvGamma_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_32, AgradCdfTestFixture, AgradCdfInvGamma_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_33, AgradCdfTestFixture, AgradCdfInvGamma_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_34, AgradCdfTestFixture, AgradCdfInvGamma_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_35, AgradCdfTestFixture, AgradCdfInvGamma_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_36, AgradCdfTestFixture, AgradCdfInvGamma_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_37, AgradCdfTestFixture, AgradCdfInvGamma_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_38, AgradCdfTestFixture, AgradCdfInvGamma_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_39, AgradCdfTestFixture, AgradCdfInvGamma_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_40, AgradCdfTestFixture, AgradCdfInvGamma_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_41, AgradCdfTestFixture, AgradCdfInvGamma_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_42, AgradCdfTestFixture, AgradCdfInvGamma_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_43, AgradCdfTestFixture, AgradCdfInvGamma_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_44, AgradCdfTestFixture, AgradCdfInvGamma_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_45, AgradCdfTestFixture, AgradCdfInvGamma_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_46, AgradCdfTestFixture, AgradCdfInvGamma_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_47, AgradCdfTestFixture, AgradCdfInvGamma_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_48, AgradCdfTestFixture, AgradCdfInvGamma_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_49, AgradCdfTestFixture, AgradCdfInvGamma_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_50, AgradCdfTestFixture, AgradCdfInvGamma_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_51, AgradCdfTestFixture, AgradCdfInvGamma_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_52, AgradCdfTestFixture, AgradCdfInvGamma_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_53, AgradCdfTestFixture, AgradCdfInvGamma_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_54, AgradCdfTestFixture, AgradCdfInvGamma_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_55, AgradCdfTestFixture, AgradCdfInvGamma_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_56, AgradCdfTestFixture, AgradCdfInvGamma_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_57, AgradCdfTestFixture, AgradCdfInvGamma_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_58, AgradCdfTestFixture, AgradCdfInvGamma_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_59, AgradCdfTestFixture, AgradCdfInvGamma_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_60, AgradCdfTestFixture, AgradCdfInvGamma_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_61, AgradCdfTestFixture, AgradCdfInvGamma_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_62, AgradCdfTestFixture, AgradCdfInvGamma_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_63, AgradCdfTestFixture, AgradCdfInvGamma_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_64, AgradCdfTestFixture, AgradCdfInvGamma_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_65, AgradCdfTestFixture, AgradCdfInvGamma_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_66, AgradCdfTestFixture, AgradCdfInvGamma_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_67, AgradCdfTestFixture, AgradCdfInvGamma_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_68, AgradCdfTestFixture, AgradCdfInvGamma_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_69, AgradCdfTestFixture, AgradCdfInvGamma_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_70, AgradCdfTestFixture, AgradCdfInvGamma_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_71, AgradCdfTestFixture, AgradCdfInvGamma_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_72, AgradCdfTestFixture, AgradCdfInvGamma_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_73, AgradCdfTestFixture, AgradCdfInvGamma_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_74, AgradCdfTestFixture, AgradCdfInvGamma_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_75, AgradCdfTestFixture, AgradCdfInvGamma_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_76, AgradCdfTestFixture, AgradCdfInvGamma_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_77, AgradCdfTestFixture, AgradCdfInvGamma_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_78, AgradCdfTestFixture, AgradCdfInvGamma_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_79, AgradCdfTestFixture, AgradCdfInvGamma_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_80, AgradCdfTestFixture, AgradCdfInvGamma_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_81, AgradCdfTestFixture, AgradCdfInvGamma_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_82, AgradCdfTestFixture, AgradCdfInvGamma_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_83, AgradCdfTestFixture, AgradCdfInvGamma_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_84, AgradCdfTestFixture, AgradCdfInvGamma_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_85, AgradCdfTestFixture, AgradCdfInvGamma_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_86, AgradCdfTestFixture, AgradCdfInvGamma_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_87, AgradCdfTestFixture, AgradCdfInvGamma_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_88, AgradCdfTestFixture, AgradCdfInvGamma_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_89, AgradCdfTestFixture, AgradCdfInvGamma_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_90, AgradCdfTestFixture, AgradCdfInvGamma_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_91, AgradCdfTestFixture, AgradCdfInvGamma_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_92, AgradCdfTestFixture, AgradCdfInvGamma_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_93, AgradCdfTestFixture, AgradCdfInvGamma_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_94, AgradCdfTestFixture, AgradCdfInvGamma_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_95, AgradCdfTestFixture, AgradCdfInvGamma_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_96, AgradCdfTestFixture, AgradCdfInvGamma_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_97, AgradCdfTestFixture, AgradCdfInvGamma_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_98, AgradCdfTestFixture, AgradCdfInvGamma_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_99, AgradCdfTestFixture, AgradCdfInvGamma_vv_99);
+
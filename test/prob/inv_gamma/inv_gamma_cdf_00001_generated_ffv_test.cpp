@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfInvGamma, type_ffv_100> AgradCdfInvGamma_ffv_100;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_101> AgradCdfInvGamma_ffv_101;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_102> AgradCdfInvGamma_ffv_102;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_103> AgradCdfInvGamma_ffv_103;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_104> AgradCdfInvGamma_ffv_104;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_105> AgradCdfInvGamma_ffv_105;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_106> AgradCdfInvGamma_ffv_106;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_107> AgradCdfInvGamma_ffv_107;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_108> AgradCdfInvGamma_ffv_108;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_109> AgradCdfInvGamma_ffv_109;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_110> AgradCdfInvGamma_ffv_110;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_111> AgradCdfInvGamma_ffv_111;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_112> AgradCdfInvGamma_ffv_112;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_113> AgradCdfInvGamma_ffv_113;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_114> AgradCdfInvGamma_ffv_114;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_115> AgradCdfInvGamma_ffv_115;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_116> AgradCdfInvGamma_ffv_116;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_117> AgradCdfInvGamma_ffv_117;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_118> AgradCdfInvGamma_ffv_118;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_119> AgradCdfInvGamma_ffv_119;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_120> AgradCdfInvGamma_ffv_120;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_121> AgradCdfInvGamma_ffv_121;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_122> AgradCdfInvGamma_ffv_122;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_123> AgradCdfInvGamma_ffv_123;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_124> AgradCdfInvGamma_ffv_124;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_125> AgradCdfInvGamma_ffv_125;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_126> AgradCdfInvGamma_ffv_126;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_127> AgradCdfInvGamma_ffv_127;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_128> AgradCdfInvGamma_ffv_128;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_129> AgradCdfInvGamma_ffv_129;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_130> AgradCdfInvGamma_ffv_130;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_131> AgradCdfInvGamma_ffv_131;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_132> AgradCdfInvGamma_ffv_132;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_133> AgradCdfInvGamma_ffv_133;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_134> AgradCdfInvGamma_ffv_134;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_135> AgradCdfInvGamma_ffv_135;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_136> AgradCdfInvGamma_ffv_136;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_137> AgradCdfInvGamma_ffv_137;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_138> AgradCdfInvGamma_ffv_138;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_139> AgradCdfInvGamma_ffv_139;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_140> AgradCdfInvGamma_ffv_140;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_141> AgradCdfInvGamma_ffv_141;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_142> AgradCdfInvGamma_ffv_142;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_143> AgradCdfInvGamma_ffv_143;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_144> AgradCdfInvGamma_ffv_144;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_145> AgradCdfInvGamma_ffv_145;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_146> AgradCdfInvGamma_ffv_146;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_147> AgradCdfInvGamma_ffv_147;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_148> AgradCdfInvGamma_ffv_148;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_149> AgradCdfInvGamma_ffv_149;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_150> AgradCdfInvGamma_ffv_150;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_151> AgradCdfInvGamma_ffv_151;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_152> AgradCdfInvGamma_ffv_152;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_153> AgradCdfInvGamma_ffv_153;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_154> AgradCdfInvGamma_ffv_154;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_155> AgradCdfInvGamma_ffv_155;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_156> AgradCdfInvGamma_ffv_156;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_157> AgradCdfInvGamma_ffv_157;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_158> AgradCdfInvGamma_ffv_158;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_159> AgradCdfInvGamma_ffv_159;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_160> AgradCdfInvGamma_ffv_160;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_161> AgradCdfInvGamma_ffv_161;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_162> AgradCdfInvGamma_ffv_162;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_163> AgradCdfInvGamma_ffv_163;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_164> AgradCdfInvGamma_ffv_164;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_165> AgradCdfInvGamma_ffv_165;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_166> AgradCdfInvGamma_ffv_166;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_167> AgradCdfInvGamma_ffv_167;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_168> AgradCdfInvGamma_ffv_168;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_169> AgradCdfInvGamma_ffv_169;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_170> AgradCdfInvGamma_ffv_170;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_171> AgradCdfInvGamma_ffv_171;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_172> AgradCdfInvGamma_ffv_172;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_173> AgradCdfInvGamma_ffv_173;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_174> AgradCdfInvGamma_ffv_174;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_175> AgradCdfInvGamma_ffv_175;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_176> AgradCdfInvGamma_ffv_176;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_177> AgradCdfInvGamma_ffv_177;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_178> AgradCdfInvGamma_ffv_178;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_179> AgradCdfInvGamma_ffv_179;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_180> AgradCdfInvGamma_ffv_180;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_181> AgradCdfInvGamma_ffv_181;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_182> AgradCdfInvGamma_ffv_182;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_183> AgradCdfInvGamma_ffv_183;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_184> AgradCdfInvGamma_ffv_184;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_185> AgradCdfInvGamma_ffv_185;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_186> AgradCdfInvGamma_ffv_186;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_187> AgradCdfInvGamma_ffv_187;
+typedef std::tuple<AgradCdfInvGamma, type_ffv_188> AgradCdfInvGamma_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_100, AgradCdfTestFixture, AgradCdfInvGamma_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_101, AgradCdfTestFixture, AgradCdfInvGamma_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_102, AgradCdfTestFixture, AgradCdfInvGamma_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_103, AgradCdfTestFixture, AgradCdfInvGamma_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_104, AgradCdfTestFixture, AgradCdfInvGamma_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_105, AgradCdfTestFixture, AgradCdfInvGamma_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_106, AgradCdfTestFixture, AgradCdfInvGamma_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_107, AgradCdfTestFixture, AgradCdfInvGamma_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_108, AgradCdfTestFixture, AgradCdfInvGamma_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_109, AgradCdfTestFixture, AgradCdfInvGamma_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_110, AgradCdfTestFixture, AgradCdfInvGamma_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_111, AgradCdfTestFixture, AgradCdfInvGamma_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_112, AgradCdfTestFixture, AgradCdfInvGamma_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_113, AgradCdfTestFixture, AgradCdfInvGamma_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_114, AgradCdfTestFixture, AgradCdfInvGamma_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_115, AgradCdfTestFixture, AgradCdfInvGamma_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_116, AgradCdfTestFixture, AgradCdfInvGamma_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_117, AgradCdfTestFixture, AgradCdfInvGamma_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_118, AgradCdfTestFixture, AgradCdfInvGamma_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_119, AgradCdfTestFixture, AgradCdfInvGamma_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_120, AgradCdfTestFixture, AgradCdfInvGamma_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_121, AgradCdfTestFixture, AgradCdfInvGamma_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_122, AgradCdfTestFixture, AgradCdfInvGamma_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_123, AgradCdfTestFixture, AgradCdfInvGamma_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_124, AgradCdfTestFixture, AgradCdfInvGamma_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_125, AgradCdfTestFixture, AgradCdfInvGamma_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_126, AgradCdfTestFixture, AgradCdfInvGamma_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_127, AgradCdfTestFixture, AgradCdfInvGamma_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_128, AgradCdfTestFixture, AgradCdfInvGamma_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_129, AgradCdfTestFixture, AgradCdfInvGamma_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_130, AgradCdfTestFixture, AgradCdfInvGamma_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_131, AgradCdfTestFixture, AgradCdfInvGamma_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_132, AgradCdfTestFixture, AgradCdfInvGamma_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_133, AgradCdfTestFixture, AgradCdfInvGamma_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_134, AgradCdfTestFixture, AgradCdfInvGamma_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_135, AgradCdfTestFixture, AgradCdfInvGamma_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_136, AgradCdfTestFixture, AgradCdfInvGamma_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_137, AgradCdfTestFixture, AgradCdfInvGamma_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_138, AgradCdfTestFixture, AgradCdfInvGamma_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_139, AgradCdfTestFixture, AgradCdfInvGamma_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_140, AgradCdfTestFixture, AgradCdfInvGamma_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_141, AgradCdfTestFixture, AgradCdfInvGamma_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_142, AgradCdfTestFixture, AgradCdfInvGamma_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_143, AgradCdfTestFixture, AgradCdfInvGamma_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_144, AgradCdfTestFixture, AgradCdfInvGamma_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_145, AgradCdfTestFixture, AgradCdfInvGamma_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_146, AgradCdfTestFixture, AgradCdfInvGamma_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_147, AgradCdfTestFixture, AgradCdfInvGamma_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_148, AgradCdfTestFixture, AgradCdfInvGamma_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_149, AgradCdfTestFixture, AgradCdfInvGamma_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_150, AgradCdfTestFixture, AgradCdfInvGamma_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_151, AgradCdfTestFixture, AgradCdfInvGamma_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_152, AgradCdfTestFixture, AgradCdfInvGamma_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_153, AgradCdfTestFixture, AgradCdfInvGamma_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_154, AgradCdfTestFixture, AgradCdfInvGamma_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_155, AgradCdfTestFixture, AgradCdfInvGamma_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_156, AgradCdfTestFixture, AgradCdfInvGamma_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_157, AgradCdfTestFixture, AgradCdfInvGamma_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_158, AgradCdfTestFixture, AgradCdfInvGamma_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_159, AgradCdfTestFixture, AgradCdfInvGamma_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_160, AgradCdfTestFixture, AgradCdfInvGamma_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_161, AgradCdfTestFixture, AgradCdfInvGamma_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_162, AgradCdfTestFixture, AgradCdfInvGamma_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_163, AgradCdfTestFixture, AgradCdfInvGamma_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_164, AgradCdfTestFixture, AgradCdfInvGamma_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_165, AgradCdfTestFixture, AgradCdfInvGamma_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_166, AgradCdfTestFixture, AgradCdfInvGamma_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_167, AgradCdfTestFixture, AgradCdfInvGamma_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_168, AgradCdfTestFixture, AgradCdfInvGamma_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_169, AgradCdfTestFixture, AgradCdfInvGamma_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_170, AgradCdfTestFixture, AgradCdfInvGamma_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_171, AgradCdfTestFixture, AgradCdfInvGamma_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_172, AgradCdfTestFixture, AgradCdfInvGamma_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_173, AgradCdfTestFixture, AgradCdfInvGamma_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_174, AgradCdfTestFixture, AgradCdfInvGamma_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_175, AgradCdfTestFixture, AgradCdfInvGamma_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_176, AgradCdfTestFixture, AgradCdfInvGamma_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_177, AgradCdfTestFixture, AgradCdfInvGamma_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_178, AgradCdfTestFixture, AgradCdfInvGamma_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_179, AgradCdfTestFixture, AgradCdfInvGamma_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_180, AgradCdfTestFixture, AgradCdfInvGamma_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_181, AgradCdfTestFixture, AgradCdfInvGamma_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_182, AgradCdfTestFixture, AgradCdfInvGamma_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_183, AgradCdfTestFixture, AgradCdfInvGamma_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_184, AgradCdfTestFixture, AgradCdfInvGamma_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_185, AgradCdfTestFixture, AgradCdfInvGamma_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_186, AgradCdfTestFixture, AgradCdfInvGamma_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_187, AgradCdfTestFixture, AgradCdfInvGamma_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_ffv_188, AgradCdfTestFixture, AgradCdfInvGamma_ffv_188);
+
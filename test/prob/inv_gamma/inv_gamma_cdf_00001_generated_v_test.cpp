@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfInvGamma, type_v_100> AgradCdfInvGamma_v_100;
+typedef std::tuple<AgradCdfInvGamma, type_v_101> AgradCdfInvGamma_v_101;
+typedef std::tuple<AgradCdfInvGamma, type_v_102> AgradCdfInvGamma_v_102;
+typedef std::tuple<AgradCdfInvGamma, type_v_103> AgradCdfInvGamma_v_103;
+typedef std::tuple<AgradCdfInvGamma, type_v_104> AgradCdfInvGamma_v_104;
+typedef std::tuple<AgradCdfInvGamma, type_v_105> AgradCdfInvGamma_v_105;
+typedef std::tuple<AgradCdfInvGamma, type_v_106> AgradCdfInvGamma_v_106;
+typedef std::tuple<AgradCdfInvGamma, type_v_107> AgradCdfInvGamma_v_107;
+typedef std::tuple<AgradCdfInvGamma, type_v_108> AgradCdfInvGamma_v_108;
+typedef std::tuple<AgradCdfInvGamma, type_v_109> AgradCdfInvGamma_v_109;
+typedef std::tuple<AgradCdfInvGamma, type_v_110> AgradCdfInvGamma_v_110;
+typedef std::tuple<AgradCdfInvGamma, type_v_111> AgradCdfInvGamma_v_111;
+typedef std::tuple<AgradCdfInvGamma, type_v_112> AgradCdfInvGamma_v_112;
+typedef std::tuple<AgradCdfInvGamma, type_v_113> AgradCdfInvGamma_v_113;
+typedef std::tuple<AgradCdfInvGamma, type_v_114> AgradCdfInvGamma_v_114;
+typedef std::tuple<AgradCdfInvGamma, type_v_115> AgradCdfInvGamma_v_115;
+typedef std::tuple<AgradCdfInvGamma, type_v_116> AgradCdfInvGamma_v_116;
+typedef std::tuple<AgradCdfInvGamma, type_v_117> AgradCdfInvGamma_v_117;
+typedef std::tuple<AgradCdfInvGamma, type_v_118> AgradCdfInvGamma_v_118;
+typedef std::tuple<AgradCdfInvGamma, type_v_119> AgradCdfInvGamma_v_119;
+typedef std::tuple<AgradCdfInvGamma, type_v_120> AgradCdfInvGamma_v_120;
+typedef std::tuple<AgradCdfInvGamma, type_v_121> AgradCdfInvGamma_v_121;
+typedef std::tuple<AgradCdfInvGamma, type_v_122> AgradCdfInvGamma_v_122;
+typedef std::tuple<AgradCdfInvGamma, type_v_123> AgradCdfInvGamma_v_123;
+typedef std::tuple<AgradCdfInvGamma, type_v_124> AgradCdfInvGamma_v_124;
+typedef std::tuple<AgradCdfInvGamma, type_v_125> AgradCdfInvGamma_v_125;
+typedef std::tuple<AgradCdfInvGamma, type_v_126> AgradCdfInvGamma_v_126;
+typedef std::tuple<AgradCdfInvGamma, type_v_127> AgradCdfInvGamma_v_127;
+typedef std::tuple<AgradCdfInvGamma, type_v_128> AgradCdfInvGamma_v_128;
+typedef std::tuple<AgradCdfInvGamma, type_v_129> AgradCdfInvGamma_v_129;
+typedef std::tuple<AgradCdfInvGamma, type_v_130> AgradCdfInvGamma_v_130;
+typedef std::tuple<AgradCdfInvGamma, type_v_131> AgradCdfInvGamma_v_131;
+typedef std::tuple<AgradCdfInvGamma, type_v_132> AgradCdfInvGamma_v_132;
+typedef std::tuple<AgradCdfInvGamma, type_v_133> AgradCdfInvGamma_v_133;
+typedef std::tuple<AgradCdfInvGamma, type_v_134> AgradCdfInvGamma_v_134;
+typedef std::tuple<AgradCdfInvGamma, type_v_135> AgradCdfInvGamma_v_135;
+typedef std::tuple<AgradCdfInvGamma, type_v_136> AgradCdfInvGamma_v_136;
+typedef std::tuple<AgradCdfInvGamma, type_v_137> AgradCdfInvGamma_v_137;
+typedef std::tuple<AgradCdfInvGamma, type_v_138> AgradCdfInvGamma_v_138;
+typedef std::tuple<AgradCdfInvGamma, type_v_139> AgradCdfInvGamma_v_139;
+typedef std::tuple<AgradCdfInvGamma, type_v_140> AgradCdfInvGamma_v_140;
+typedef std::tuple<AgradCdfInvGamma, type_v_141> AgradCdfInvGamma_v_141;
+typedef std::tuple<AgradCdfInvGamma, type_v_142> AgradCdfInvGamma_v_142;
+typedef std::tuple<AgradCdfInvGamma, type_v_143> AgradCdfInvGamma_v_143;
+typedef std::tuple<AgradCdfInvGamma, type_v_144> AgradCdfInvGamma_v_144;
+typedef std::tuple<AgradCdfInvGamma, type_v_145> AgradCdfInvGamma_v_145;
+typedef std::tuple<AgradCdfInvGamma, type_v_146> AgradCdfInvGamma_v_146;
+typedef std::tuple<AgradCdfInvGamma, type_v_147> AgradCdfInvGamma_v_147;
+typedef std::tuple<AgradCdfInvGamma, type_v_148> AgradCdfInvGamma_v_148;
+typedef std::tuple<AgradCdfInvGamma, type_v_149> AgradCdfInvGamma_v_149;
+typedef std::tuple<AgradCdfInvGamma, type_v_150> AgradCdfInvGamma_v_150;
+typedef std::tuple<AgradCdfInvGamma, type_v_151> AgradCdfInvGamma_v_151;
+typedef std::tuple<AgradCdfInvGamma, type_v_152> AgradCdfInvGamma_v_152;
+typedef std::tuple<AgradCdfInvGamma, type_v_153> AgradCdfInvGamma_v_153;
+typedef std::tuple<AgradCdfInvGamma, type_v_154> AgradCdfInvGamma_v_154;
+typedef std::tuple<AgradCdfInvGamma, type_v_155> AgradCdfInvGamma_v_155;
+typedef std::tuple<AgradCdfInvGamma, type_v_156> AgradCdfInvGamma_v_156;
+typedef std::tuple<AgradCdfInvGamma, type_v_157> AgradCdfInvGamma_v_157;
+typedef std::tuple<AgradCdfInvGamma, type_v_158> AgradCdfInvGamma_v_158;
+typedef std::tuple<AgradCdfInvGamma, type_v_159> AgradCdfInvGamma_v_159;
+typedef std::tuple<AgradCdfInvGamma, type_v_160> AgradCdfInvGamma_v_160;
+typedef std::tuple<AgradCdfInvGamma, type_v_161> AgradCdfInvGamma_v_161;
+typedef std::tuple<AgradCdfInvGamma, type_v_162> AgradCdfInvGamma_v_162;
+typedef std::tuple<AgradCdfInvGamma, type_v_163> AgradCdfInvGamma_v_163;
+typedef std::tuple<AgradCdfInvGamma, type_v_164> AgradCdfInvGamma_v_164;
+typedef std::tuple<AgradCdfInvGamma, type_v_165> AgradCdfInvGamma_v_165;
+typedef std::tuple<AgradCdfInvGamma, type_v_166> AgradCdfInvGamma_v_166;
+typedef std::tuple<AgradCdfInvGamma, type_v_167> AgradCdfInvGamma_v_167;
+typedef std::tuple<AgradCdfInvGamma, type_v_168> AgradCdfInvGamma_v_168;
+typedef std::tuple<AgradCdfInvGamma, type_v_169> AgradCdfInvGamma_v_169;
+typedef std::tuple<AgradCdfInvGamma, type_v_170> AgradCdfInvGamma_v_170;
+typedef std::tuple<AgradCdfInvGamma, type_v_171> AgradCdfInvGamma_v_171;
+typedef std::tuple<AgradCdfInvGamma, type_v_172> AgradCdfInvGamma_v_172;
+typedef std::tuple<AgradCdfInvGamma, type_v_173> AgradCdfInvGamma_v_173;
+typedef std::tuple<AgradCdfInvGamma, type_v_174> AgradCdfInvGamma_v_174;
+typedef std::tuple<AgradCdfInvGamma, type_v_175> AgradCdfInvGamma_v_175;
+typedef std::tuple<AgradCdfInvGamma, type_v_176> AgradCdfInvGamma_v_176;
+typedef std::tuple<AgradCdfInvGamma, type_v_177> AgradCdfInvGamma_v_177;
+typedef std::tuple<AgradCdfInvGamma, type_v_178> AgradCdfInvGamma_v_178;
+typedef std::tuple<AgradCdfInvGamma, type_v_179> AgradCdfInvGamma_v_179;
+typedef std::tuple<AgradCdfInvGamma, type_v_180> AgradCdfInvGamma_v_180;
+typedef std::tuple<AgradCdfInvGamma, type_v_181> AgradCdfInvGamma_v_181;
+typedef std::tuple<AgradCdfInvGamma, type_v_182> AgradCdfInvGamma_v_182;
+typedef std::tuple<AgradCdfInvGamma, type_v_183> AgradCdfInvGamma_v_183;
+typedef std::tuple<AgradCdfInvGamma, type_v_184> AgradCdfInvGamma_v_184;
+typedef std::tuple<AgradCdfInvGamma, type_v_185> AgradCdfInvGamma_v_185;
+typedef std::tuple<AgradCdfInvGamma, type_v_186> AgradCdfInvGamma_v_186;
+typedef std::tuple<AgradCdfInvGamma, type_v_187> AgradCdfInvGamma_v_187;
+typedef std::tuple<AgradCdfInvGamma, type_v_188> AgradCdfInvGamma_v_188;
+typedef std::tuple<AgradCdfInvGamma, type_v_189> AgradCdfInvGamma_v_189;
+typedef std::tuple<AgradCdfInvGamma, type_v_190> AgradCdfInvGamma_v_190;
+typedef std::tuple<AgradCdfInvGamma, type_v_191> AgradCdfInvGamma_v_191;
+typedef std::tuple<AgradCdfInvGamma, type_v_192> AgradCdfInvGamma_v_192;
+typedef std::tuple<AgradCdfInvGamma, type_v_193> AgradCdfInvGamma_v_193;
+typedef std::tuple<AgradCdfInvGamma, type_v_194> AgradCdfInvGamma_v_194;
+typedef std::tuple<AgradCdfInvGamma, type_v_195> AgradCdfInvGamma_v_195;
+typedef std::tuple<AgradCdfInvGamma, type_v_196> AgradCdfInvGamma_v_196;
+typedef std::tuple<AgradCdfInvGamma, type_v_197> AgradCdfInvGamma_v_197;
+typedef std::tuple<AgradCdfInvGamma, type_v_198> AgradCdfInvGamma_v_198;
+typedef std::tuple<AgradCdfInvGamma, type_v_199> AgradCdfInvGamma_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_100, AgradCdfTestFixture, AgradCdfInvGamma_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_101, AgradCdfTestFixture, AgradCdfInvGamma_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_102, AgradCdfTestFixture, AgradCdfInvGamma_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_103, AgradCdfTestFixture, AgradCdfInvGamma_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_104, AgradCdfTestFixture, AgradCdfInvGamma_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_105, AgradCdfTestFixture, AgradCdfInvGamma_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_106, AgradCdfTestFixture, AgradCdfInvGamma_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_107, AgradCdfTestFixture, AgradCdfInvGamma_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_108, AgradCdfTestFixture, AgradCdfInvGamma_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_109, AgradCdfTestFixture, AgradCdfInvGamma_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_110, AgradCdfTestFixture, AgradCdfInvGamma_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_111, AgradCdfTestFixture, AgradCdfInvGamma_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_112, AgradCdfTestFixture, AgradCdfInvGamma_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_113, AgradCdfTestFixture, AgradCdfInvGamma_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_114, AgradCdfTestFixture, AgradCdfInvGamma_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_115, AgradCdfTestFixture, AgradCdfInvGamma_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_116, AgradCdfTestFixture, AgradCdfInvGamma_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_117, AgradCdfTestFixture, AgradCdfInvGamma_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_118, AgradCdfTestFixture, AgradCdfInvGamma_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_119, AgradCdfTestFixture, AgradCdfInvGamma_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_120, AgradCdfTestFixture, AgradCdfInvGamma_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_121, AgradCdfTestFixture, AgradCdfInvGamma_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_122, AgradCdfTestFixture, AgradCdfInvGamma_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_123, AgradCdfTestFixture, AgradCdfInvGamma_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_124, AgradCdfTestFixture, AgradCdfInvGamma_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_125, AgradCdfTestFixture, AgradCdfInvGamma_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_126, AgradCdfTestFixture, AgradCdfInvGamma_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_127, AgradCdfTestFixture, AgradCdfInvGamma_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_128, AgradCdfTestFixture, AgradCdfInvGamma_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_129, AgradCdfTestFixture, AgradCdfInvGamma_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_130, AgradCdfTestFixture, AgradCdfInvGamma_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_131, AgradCdfTestFixture, AgradCdfInvGamma_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_132, AgradCdfTestFixture, AgradCdfInvGamma_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_133, AgradCdfTestFixture, AgradCdfInvGamma_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_134, AgradCdfTestFixture, AgradCdfInvGamma_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_135, AgradCdfTestFixture, AgradCdfInvGamma_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_136, AgradCdfTestFixture, AgradCdfInvGamma_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_137, AgradCdfTestFixture, AgradCdfInvGamma_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_138, AgradCdfTestFixture, AgradCdfInvGamma_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_139, AgradCdfTestFixture, AgradCdfInvGamma_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_140, AgradCdfTestFixture, AgradCdfInvGamma_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_141, AgradCdfTestFixture, AgradCdfInvGamma_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_142, AgradCdfTestFixture, AgradCdfInvGamma_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_143, AgradCdfTestFixture, AgradCdfInvGamma_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_144, AgradCdfTestFixture, AgradCdfInvGamma_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_145, AgradCdfTestFixture, AgradCdfInvGamma_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_146, AgradCdfTestFixture, AgradCdfInvGamma_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_147, AgradCdfTestFixture, AgradCdfInvGamma_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_148, AgradCdfTestFixture, AgradCdfInvGamma_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_149, AgradCdfTestFixture, AgradCdfInvGamma_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_150, AgradCdfTestFixture, AgradCdfInvGamma_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_151, AgradCdfTestFixture, AgradCdfInvGamma_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_152, AgradCdfTestFixture, AgradCdfInvGamma_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_153, AgradCdfTestFixture, AgradCdfInvGamma_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_154, AgradCdfTestFixture, AgradCdfInvGamma_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_155, AgradCdfTestFixture, AgradCdfInvGamma_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_156, AgradCdfTestFixture, AgradCdfInvGamma_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_157, AgradCdfTestFixture, AgradCdfInvGamma_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_158, AgradCdfTestFixture, AgradCdfInvGamma_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_159, AgradCdfTestFixture, AgradCdfInvGamma_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_160, AgradCdfTestFixture, AgradCdfInvGamma_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_161, AgradCdfTestFixture, AgradCdfInvGamma_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_162, AgradCdfTestFixture, AgradCdfInvGamma_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_163, AgradCdfTestFixture, AgradCdfInvGamma_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_164, AgradCdfTestFixture, AgradCdfInvGamma_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_165, AgradCdfTestFixture, AgradCdfInvGamma_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_166, AgradCdfTestFixture, AgradCdfInvGamma_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_167, AgradCdfTestFixture, AgradCdfInvGamma_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_168, AgradCdfTestFixture, AgradCdfInvGamma_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_169, AgradCdfTestFixture, AgradCdfInvGamma_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_170, AgradCdfTestFixture, AgradCdfInvGamma_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_171, AgradCdfTestFixture, AgradCdfInvGamma_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_172, AgradCdfTestFixture, AgradCdfInvGamma_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_173, AgradCdfTestFixture, AgradCdfInvGamma_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_174, AgradCdfTestFixture, AgradCdfInvGamma_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_175, AgradCdfTestFixture, AgradCdfInvGamma_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_176, AgradCdfTestFixture, AgradCdfInvGamma_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_177, AgradCdfTestFixture, AgradCdfInvGamma_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_178, AgradCdfTestFixture, AgradCdfInvGamma_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_179, AgradCdfTestFixture, AgradCdfInvGamma_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_180, AgradCdfTestFixture, AgradCdfInvGamma_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_181, AgradCdfTestFixture, AgradCdfInvGamma_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_182, AgradCdfTestFixture, AgradCdfInvGamma_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_183, AgradCdfTestFixture, AgradCdfInvGamma_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_184, AgradCdfTestFixture, AgradCdfInvGamma_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_185, AgradCdfTestFixture, AgradCdfInvGamma_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_186, AgradCdfTestFixture, AgradCdfInvGamma_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_187, AgradCdfTestFixture, AgradCdfInvGamma_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_188, AgradCdfTestFixture, AgradCdfInvGamma_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_189, AgradCdfTestFixture, AgradCdfInvGamma_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_190, AgradCdfTestFixture, AgradCdfInvGamma_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_191, AgradCdfTestFixture, AgradCdfInvGamma_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_192, AgradCdfTestFixture, AgradCdfInvGamma_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_193, AgradCdfTestFixture, AgradCdfInvGamma_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_194, AgradCdfTestFixture, AgradCdfInvGamma_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_195, AgradCdfTestFixture, AgradCdfInvGamma_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_196, AgradCdfTestFixture, AgradCdfInvGamma_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_197, AgradCdfTestFixture, AgradCdfInvGamma_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_198, AgradCdfTestFixture, AgradCdfInvGamma_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_199, AgradCdfTestFixture, AgradCdfInvGamma_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfInvGamma, type_vv_100> AgradCdfInvGamma_vv_100;
+typedef std::tuple<AgradCdfInvGamma, type_vv_101> AgradCdfInvGamma_vv_101;
+typedef std::tuple<AgradCdfInvGamma, type_vv_102> AgradCdfInvGamma_vv_102;
+typedef std::tuple<AgradCdfInvGamma, type_vv_103> AgradCdfInvGamma_vv_103;
+typedef std::tuple<AgradCdfInvGamma, type_vv_104> AgradCdfInvGamma_vv_104;
+typedef std::tuple<AgradCdfInvGamma, type_vv_105> AgradCdfInvGamma_vv_105;
+typedef std::tuple<AgradCdfInvGamma, type_vv_106> AgradCdfInvGamma_vv_106;
+typedef std::tuple<AgradCdfInvGamma, type_vv_107> AgradCdfInvGamma_vv_107;
+typedef std::tuple<AgradCdfInvGamma, type_vv_108> AgradCdfInvGamma_vv_108;
+typedef std::tuple<AgradCdfInvGamma, type_vv_109> AgradCdfInvGamma_vv_109;
+typedef std::tuple<AgradCdfInvGamma, type_vv_110> AgradCdfInvGamma_vv_110;
+typedef std::tuple<AgradCdfInvGamma, type_vv_111> AgradCdfInvGamma_vv_111;
+typedef std::tuple<AgradCdfInvGamma, type_vv_112> AgradCdfInvGamma_vv_112;
+typedef std::tuple<AgradCdfInvGamma, type_vv_113> AgradCdfInvGamma_vv_113;
+typedef std::tuple<AgradCdfInvGamma, type_vv_114> AgradCdfInvGamma_vv_114;
+typedef std::tuple<AgradCdfInvGamma, type_vv_115> AgradCdfInvGamma_vv_115;
+typedef std::tuple<AgradCdfInvGamma, type_vv_116> AgradCdfInvGamma_vv_116;
+typedef std::tuple<AgradCdfInvGamma, type_vv_117> AgradCdfInvGamma_vv_117;
+typedef std::tuple<AgradCdfInvGamma, type_vv_118> AgradCdfInvGamma_vv_118;
+typedef std::tuple<AgradCdfInvGamma, type_vv_119> AgradCdfInvGamma_vv_119;
+typedef std::tuple<AgradCdfInvGamma, type_vv_120> AgradCdfInvGamma_vv_120;
+typedef std::tuple<AgradCdfInvGamma, type_vv_121> AgradCdfInvGamma_vv_121;
+typedef std::tuple<AgradCdfInvGamma, type_vv_122> AgradCdfInvGamma_vv_122;
+typedef std::tuple<AgradCdfInvGamma, type_vv_123> AgradCdfInvGamma_vv_123;
+typedef std::tuple<AgradCdfInvGamma, type_vv_124> AgradCdfInvGamma_vv_124;
+typedef std::tuple<AgradCdfInvGamma, type_vv_125> AgradCdfInvGamma_vv_125;
+typedef std::tuple<AgradCdfInvGamma, type_vv_126> AgradCdfInvGamma_vv_126;
+typedef std::tuple<AgradCdfInvGamma, type_vv_127> AgradCdfInvGamma_vv_127;
+typedef std::tuple<AgradCdfInvGamma, type_vv_128> AgradCdfInvGamma_vv_128;
+typedef std::tuple<AgradCdfInvGamma, type_vv_129> AgradCdfInvGamma_vv_129;
+typedef std::tuple<AgradCdfInvGamma, type_vv_130> AgradCdfInvGamma_vv_130;
+typedef std::tuple<AgradCdfInvGamma, type_vv_131> AgradCdfInvGamma_vv_131;
+typedef std::tuple<AgradCdfInvGamma, type_vv_132> AgradCdfInvGamma_vv_132;
+typedef std::tuple<AgradCdfInvGamma, type_vv_133> AgradCdfInvGamma_vv_133;
+typedef std::tuple<AgradCdfInvGamma, type_vv_134> AgradCdfInvGamma_vv_134;
+typedef std::tuple<AgradCdfInvGamma, type_vv_135> AgradCdfInvGamma_vv_135;
+typedef std::tuple<AgradCdfInvGamma, type_vv_136> AgradCdfInvGamma_vv_136;
+typedef std::tuple<AgradCdfInvGamma, type_vv_137> AgradCdfInvGamma_vv_137;
+typedef std::tuple<AgradCdfInvGamma, type_vv_138> AgradCdfInvGamma_vv_138;
+typedef std::tuple<AgradCdfInvGamma, type_vv_139> AgradCdfInvGamma_vv_139;
+typedef std::tuple<AgradCdfInvGamma, type_vv_140> AgradCdfInvGamma_vv_140;
+typedef std::tuple<AgradCdfInvGamma, type_vv_141> AgradCdfInvGamma_vv_141;
+typedef std::tuple<AgradCdfInvGamma, type_vv_142> AgradCdfInvGamma_vv_142;
+typedef std::tuple<AgradCdfInvGamma, type_vv_143> AgradCdfInvGamma_vv_143;
+typedef std::tuple<AgradCdfInvGamma, type_vv_144> AgradCdfInvGamma_vv_144;
+typedef std::tuple<AgradCdfInvGamma, type_vv_145> AgradCdfInvGamma_vv_145;
+typedef std::tuple<AgradCdfInvGamma, type_vv_146> AgradCdfInvGamma_vv_146;
+typedef std::tuple<AgradCdfInvGamma, type_vv_147> AgradCdfInvGamma_vv_147;
+typedef std::tuple<AgradCdfInvGamma, type_vv_148> AgradCdfInvGamma_vv_148;
+typedef std::tuple<AgradCdfInvGamma, type_vv_149> AgradCdfInvGamma_vv_149;
+typedef std::tuple<AgradCdfInvGamma, type_vv_150> AgradCdfInvGamma_vv_150;
+typedef std::tuple<AgradCdfInvGamma, type_vv_151> AgradCdfInvGamma_vv_151;
+typedef std::tuple<AgradCdfInvGamma, type_vv_152> AgradCdfInvGamma_vv_152;
+typedef std::tuple<AgradCdfInvGamma, type_vv_153> AgradCdfInvGamma_vv_153;
+typedef std::tuple<AgradCdfInvGamma, type_vv_154> AgradCdfInvGamma_vv_154;
+typedef std::tuple<AgradCdfInvGamma, type_vv_155> AgradCdfInvGamma_vv_155;
+typedef std::tuple<AgradCdfInvGamma, type_vv_156> AgradCdfInvGamma_vv_156;
+typedef std::tuple<AgradCdfInvGamma, type_vv_157> AgradCdfInvGamma_vv_157;
+typedef std::tuple<AgradCdfInvGamma, type_vv_158> AgradCdfInvGamma_vv_158;
+typedef std::tuple<AgradCdfInvGamma, type_vv_159> AgradCdfInvGamma_vv_159;
+typedef std::tuple<AgradCdfInvGamma, type_vv_160> AgradCdfInvGamma_vv_160;
+typedef std::tuple<AgradCdfInvGamma, type_vv_161> AgradCdfInvGamma_vv_161;
+typedef std::tuple<AgradCdfInvGamma, type_vv_162> AgradCdfInvGamma_vv_162;
+typedef std::tuple<AgradCdfInvGamma, type_vv_163> AgradCdfInvGamma_vv_163;
+typedef std::tuple<AgradCdfInvGamma, type_vv_164> AgradCdfInvGamma_vv_164;
+typedef std::tuple<AgradCdfInvGamma, type_vv_165> AgradCdfInvGamma_vv_165;
+typedef std::tuple<AgradCdfInvGamma, type_vv_166> AgradCdfInvGamma_vv_166;
+typedef std::tuple<AgradCdfInvGamma, type_vv_167> AgradCdfInvGamma_vv_167;
+typedef std::tuple<AgradCdfInvGamma, type_vv_168> AgradCdfInvGamma_vv_168;
+typedef std::tuple<AgradCdfInvGamma, type_vv_169> AgradCdfInvGamma_vv_169;
+typedef std::tuple<AgradCdfInvGamma, type_vv_170> AgradCdfInvGamma_vv_170;
+typedef std::tuple<AgradCdfInvGamma, type_vv_171> AgradCdfInvGamma_vv_171;
+typedef std::tuple<AgradCdfInvGamma, type_vv_172> AgradCdfInvGamma_vv_172;
+typedef std::tuple<AgradCdfInvGamma, type_vv_173> AgradCdfInvGamma_vv_173;
+typedef std::tuple<AgradCdfInvGamma, type_vv_174> AgradCdfInvGamma_vv_174;
+typedef std::tuple<AgradCdfInvGamma, type_vv_175> AgradCdfInvGamma_vv_175;
+typedef std::tuple<AgradCdfInvGamma, type_vv_176> AgradCdfInvGamma_vv_176;
+typedef std::tuple<AgradCdfInvGamma, type_vv_177> AgradCdfInvGamma_vv_177;
+typedef std::tuple<AgradCdfInvGamma, type_vv_178> AgradCdfInvGamma_vv_178;
+typedef std::tuple<AgradCdfInvGamma, type_vv_179> AgradCdfInvGamma_vv_179;
+typedef std::tuple<AgradCdfInvGamma, type_vv_180> AgradCdfInvGamma_vv_180;
+typedef std::tuple<AgradCdfInvGamma, type_vv_181> AgradCdfInvGamma_vv_181;
+typedef std::tuple<AgradCdfInvGamma, type_vv_182> AgradCdfInvGamma_vv_182;
+typedef std::tuple<AgradCdfInvGamma, type_vv_183> AgradCdfInvGamma_vv_183;
+typedef std::tuple<AgradCdfInvGamma, type_vv_184> AgradCdfInvGamma_vv_184;
+typedef std::tuple<AgradCdfInvGamma, type_vv_185> AgradCdfInvGamma_vv_185;
+typedef std::tuple<AgradCdfInvGamma, type_vv_186> AgradCdfInvGamma_vv_186;
+typedef std::tuple<AgradCdfInvGamma, type_vv_187> AgradCdfInvGamma_vv_187;
+typedef std::tuple<AgradCdfInvGamma, type_vv_188> AgradCdfInvGamma_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_100, AgradCdfTestFixture, AgradCdfInvGamma_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_101, AgradCdfTestFixture, AgradCdfInvGamma_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_102, AgradCdfTestFixture, AgradCdfInvGamma_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_103, AgradCdfTestFixture, AgradCdfInvGamma_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_104, AgradCdfTestFixture, AgradCdfInvGamma_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_105, AgradCdfTestFixture, AgradCdfInvGamma_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_106, AgradCdfTestFixture, AgradCdfInvGamma_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_107, AgradCdfTestFixture, AgradCdfInvGamma_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_108, AgradCdfTestFixture, AgradCdfInvGamma_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_109, AgradCdfTestFixture, AgradCdfInvGamma_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_110, AgradCdfTestFixture, AgradCdfInvGamma_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_111, AgradCdfTestFixture, AgradCdfInvGamma_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_112, AgradCdfTestFixture, AgradCdfInvGamma_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_113, AgradCdfTestFixture, AgradCdfInvGamma_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_114, AgradCdfTestFixture, AgradCdfInvGamma_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_115, AgradCdfTestFixture, AgradCdfInvGamma_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_116, AgradCdfTestFixture, AgradCdfInvGamma_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_117, AgradCdfTestFixture, AgradCdfInvGamma_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_118, AgradCdfTestFixture, AgradCdfInvGamma_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_119, AgradCdfTestFixture, AgradCdfInvGamma_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_120, AgradCdfTestFixture, AgradCdfInvGamma_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_121, AgradCdfTestFixture, AgradCdfInvGamma_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_122, AgradCdfTestFixture, AgradCdfInvGamma_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_123, AgradCdfTestFixture, AgradCdfInvGamma_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_124, AgradCdfTestFixture, AgradCdfInvGamma_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_125, AgradCdfTestFixture, AgradCdfInvGamma_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_126, AgradCdfTestFixture, AgradCdfInvGamma_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_127, AgradCdfTestFixture, AgradCdfInvGamma_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_128, AgradCdfTestFixture, AgradCdfInvGamma_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_129, AgradCdfTestFixture, AgradCdfInvGamma_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_130, AgradCdfTestFixture, AgradCdfInvGamma_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_131, AgradCdfTestFixture, AgradCdfInvGamma_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_132, AgradCdfTestFixture, AgradCdfInvGamma_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_133, AgradCdfTestFixture, AgradCdfInvGamma_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_134, AgradCdfTestFixture, AgradCdfInvGamma_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_135, AgradCdfTestFixture, AgradCdfInvGamma_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_136, AgradCdfTestFixture, AgradCdfInvGamma_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_137, AgradCdfTestFixture, AgradCdfInvGamma_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_138, AgradCdfTestFixture, AgradCdfInvGamma_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_139, AgradCdfTestFixture, AgradCdfInvGamma_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_140, AgradCdfTestFixture, AgradCdfInvGamma_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_141, AgradCdfTestFixture, AgradCdfInvGamma_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_142, AgradCdfTestFixture, AgradCdfInvGamma_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_143, AgradCdfTestFixture, AgradCdfInvGamma_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_144, AgradCdfTestFixture, AgradCdfInvGamma_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_145, AgradCdfTestFixture, AgradCdfInvGamma_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_146, AgradCdfTestFixture, AgradCdfInvGamma_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_147, AgradCdfTestFixture, AgradCdfInvGamma_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_148, AgradCdfTestFixture, AgradCdfInvGamma_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_149, AgradCdfTestFixture, AgradCdfInvGamma_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_150, AgradCdfTestFixture, AgradCdfInvGamma_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_151, AgradCdfTestFixture, AgradCdfInvGamma_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_152, AgradCdfTestFixture, AgradCdfInvGamma_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_153, AgradCdfTestFixture, AgradCdfInvGamma_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_154, AgradCdfTestFixture, AgradCdfInvGamma_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_155, AgradCdfTestFixture, AgradCdfInvGamma_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_156, AgradCdfTestFixture, AgradCdfInvGamma_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_157, AgradCdfTestFixture, AgradCdfInvGamma_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_158, AgradCdfTestFixture, AgradCdfInvGamma_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_159, AgradCdfTestFixture, AgradCdfInvGamma_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_160, AgradCdfTestFixture, AgradCdfInvGamma_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_161, AgradCdfTestFixture, AgradCdfInvGamma_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_162, AgradCdfTestFixture, AgradCdfInvGamma_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_163, AgradCdfTestFixture, AgradCdfInvGamma_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_164, AgradCdfTestFixture, AgradCdfInvGamma_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_165, AgradCdfTestFixture, AgradCdfInvGamma_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_166, AgradCdfTestFixture, AgradCdfInvGamma_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_167, AgradCdfTestFixture, AgradCdfInvGamma_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_168, AgradCdfTestFixture, AgradCdfInvGamma_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_169, AgradCdfTestFixture, AgradCdfInvGamma_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_170, AgradCdfTestFixture, AgradCdfInvGamma_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_171, AgradCdfTestFixture, AgradCdfInvGamma_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_172, AgradCdfTestFixture, AgradCdfInvGamma_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_173, AgradCdfTestFixture, AgradCdfInvGamma_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_174, AgradCdfTestFixture, AgradCdfInvGamma_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_175, AgradCdfTestFixture, AgradCdfInvGamma_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_176, AgradCdfTestFixture, AgradCdfInvGamma_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_177, AgradCdfTestFixture, AgradCdfInvGamma_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_178, AgradCdfTestFixture, AgradCdfInvGamma_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_179, AgradCdfTestFixture, AgradCdfInvGamma_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_180, AgradCdfTestFixture, AgradCdfInvGamma_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_181, AgradCdfTestFixture, AgradCdfInvGamma_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_182, AgradCdfTestFixture, AgradCdfInvGamma_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_183, AgradCdfTestFixture, AgradCdfInvGamma_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_184, AgradCdfTestFixture, AgradCdfInvGamma_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_185, AgradCdfTestFixture, AgradCdfInvGamma_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_186, AgradCdfTestFixture, AgradCdfInvGamma_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_187, AgradCdfTestFixture, AgradCdfInvGamma_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_vv_188, AgradCdfTestFixture, AgradCdfInvGamma_vv_188);
+
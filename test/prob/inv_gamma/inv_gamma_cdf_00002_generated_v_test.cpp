@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCdfInvGamma, type_v_200> AgradCdfInvGamma_v_200;
+typedef std::tuple<AgradCdfInvGamma, type_v_201> AgradCdfInvGamma_v_201;
+typedef std::tuple<AgradCdfInvGamma, type_v_202> AgradCdfInvGamma_v_202;
+typedef std::tuple<AgradCdfInvGamma, type_v_203> AgradCdfInvGamma_v_203;
+typedef std::tuple<AgradCdfInvGamma, type_v_204> AgradCdfInvGamma_v_204;
+typedef std::tuple<AgradCdfInvGamma, type_v_205> AgradCdfInvGamma_v_205;
+typedef std::tuple<AgradCdfInvGamma, type_v_206> AgradCdfInvGamma_v_206;
+typedef std::tuple<AgradCdfInvGamma, type_v_207> AgradCdfInvGamma_v_207;
+typedef std::tuple<AgradCdfInvGamma, type_v_208> AgradCdfInvGamma_v_208;
+typedef std::tuple<AgradCdfInvGamma, type_v_209> AgradCdfInvGamma_v_209;
+typedef std::tuple<AgradCdfInvGamma, type_v_210> AgradCdfInvGamma_v_210;
+typedef std::tuple<AgradCdfInvGamma, type_v_211> AgradCdfInvGamma_v_211;
+typedef std::tuple<AgradCdfInvGamma, type_v_212> AgradCdfInvGamma_v_212;
+typedef std::tuple<AgradCdfInvGamma, type_v_213> AgradCdfInvGamma_v_213;
+typedef std::tuple<AgradCdfInvGamma, type_v_214> AgradCdfInvGamma_v_214;
+typedef std::tuple<AgradCdfInvGamma, type_v_215> AgradCdfInvGamma_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_200, AgradCdfTestFixture, AgradCdfInvGamma_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_201, AgradCdfTestFixture, AgradCdfInvGamma_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_202, AgradCdfTestFixture, AgradCdfInvGamma_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_203, AgradCdfTestFixture, AgradCdfInvGamma_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_204, AgradCdfTestFixture, AgradCdfInvGamma_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_205, AgradCdfTestFixture, AgradCdfInvGamma_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_206, AgradCdfTestFixture, AgradCdfInvGamma_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_207, AgradCdfTestFixture, AgradCdfInvGamma_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_208, AgradCdfTestFixture, AgradCdfInvGamma_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_209, AgradCdfTestFixture, AgradCdfInvGamma_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_210, AgradCdfTestFixture, AgradCdfInvGamma_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_211, AgradCdfTestFixture, AgradCdfInvGamma_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_212, AgradCdfTestFixture, AgradCdfInvGamma_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_213, AgradCdfTestFixture, AgradCdfInvGamma_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_214, AgradCdfTestFixture, AgradCdfInvGamma_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfInvGamma_v_215, AgradCdfTestFixture, AgradCdfInvGamma_v_215);
+
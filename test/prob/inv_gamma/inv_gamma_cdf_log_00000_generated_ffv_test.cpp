@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_0> AgradCdfLogInvGamma_ffv_0;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_1> AgradCdfLogInvGamma_ffv_1;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_2> AgradCdfLogInvGamma_ffv_2;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_3> AgradCdfLogInvGamma_ffv_3;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_4> AgradCdfLogInvGamma_ffv_4;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_5> AgradCdfLogInvGamma_ffv_5;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_6> AgradCdfLogInvGamma_ffv_6;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_7> AgradCdfLogInvGamma_ffv_7;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_8> AgradCdfLogInvGamma_ffv_8;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_9> AgradCdfLogInvGamma_ffv_9;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_10> AgradCdfLogInvGamma_ffv_10;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_11> AgradCdfLogInvGamma_ffv_11;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_12> AgradCdfLogInvGamma_ffv_12;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_13> AgradCdfLogInvGamma_ffv_13;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_14> AgradCdfLogInvGamma_ffv_14;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_15> AgradCdfLogInvGamma_ffv_15;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_16> AgradCdfLogInvGamma_ffv_16;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_17> AgradCdfLogInvGamma_ffv_17;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_18> AgradCdfLogInvGamma_ffv_18;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_19> AgradCdfLogInvGamma_ffv_19;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_20> AgradCdfLogInvGamma_ffv_20;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_21> AgradCdfLogInvGamma_ffv_21;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_22> AgradCdfLogInvGamma_ffv_22;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_23> AgradCdfLogInvGamma_ffv_23;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_24> AgradCdfLogInvGamma_ffv_24;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_25> AgradCdfLogInvGamma_ffv_25;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_26> AgradCdfLogInvGamma_ffv_26;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_27> AgradCdfLogInvGamma_ffv_27;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_28> AgradCdfLogInvGamma_ffv_28;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_29> AgradCdfLogInvGamma_ffv_29;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_30> AgradCdfLogInvGamma_ffv_30;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_31> AgradCdfLogInvGamma_ffv_31;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_32> AgradCdfLogInvGamma_ffv_32;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_33> AgradCdfLogInvGamma_ffv_33;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_34> AgradCdfLogInvGamma_ffv_34;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_35> AgradCdfLogInvGamma_ffv_35;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_36> AgradCdfLogInvGamma_ffv_36;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_37> AgradCdfLogInvGamma_ffv_37;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_38> AgradCdfLogInvGamma_ffv_38;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_39> AgradCdfLogInvGamma_ffv_39;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_40> AgradCdfLogInvGamma_ffv_40;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_41> AgradCdfLogInvGamma_ffv_41;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_42> AgradCdfLogInvGamma_ffv_42;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_43> AgradCdfLogInvGamma_ffv_43;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_44> AgradCdfLogInvGamma_ffv_44;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_45> AgradCdfLogInvGamma_ffv_45;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_46> AgradCdfLogInvGamma_ffv_46;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_47> AgradCdfLogInvGamma_ffv_47;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_48> AgradCdfLogInvGamma_ffv_48;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_49> AgradCdfLogInvGamma_ffv_49;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_50> AgradCdfLogInvGamma_ffv_50;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_51> AgradCdfLogInvGamma_ffv_51;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_52> AgradCdfLogInvGamma_ffv_52;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_53> AgradCdfLogInvGamma_ffv_53;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_54> AgradCdfLogInvGamma_ffv_54;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_55> AgradCdfLogInvGamma_ffv_55;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_56> AgradCdfLogInvGamma_ffv_56;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_57> AgradCdfLogInvGamma_ffv_57;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_58> AgradCdfLogInvGamma_ffv_58;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_59> AgradCdfLogInvGamma_ffv_59;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_60> AgradCdfLogInvGamma_ffv_60;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_61> AgradCdfLogInvGamma_ffv_61;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_62> AgradCdfLogInvGamma_ffv_62;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_63> AgradCdfLogInvGamma_ffv_63;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_64> AgradCdfLogInvGamma_ffv_64;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_65> AgradCdfLogInvGamma_ffv_65;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_66> AgradCdfLogInvGamma_ffv_66;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_67> AgradCdfLogInvGamma_ffv_67;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_68> AgradCdfLogInvGamma_ffv_68;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_69> AgradCdfLogInvGamma_ffv_69;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_70> AgradCdfLogInvGamma_ffv_70;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_71> AgradCdfLogInvGamma_ffv_71;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_72> AgradCdfLogInvGamma_ffv_72;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_73> AgradCdfLogInvGamma_ffv_73;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_74> AgradCdfLogInvGamma_ffv_74;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_75> AgradCdfLogInvGamma_ffv_75;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_76> AgradCdfLogInvGamma_ffv_76;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_77> AgradCdfLogInvGamma_ffv_77;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_78> AgradCdfLogInvGamma_ffv_78;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_79> AgradCdfLogInvGamma_ffv_79;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_80> AgradCdfLogInvGamma_ffv_80;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_81> AgradCdfLogInvGamma_ffv_81;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_82> AgradCdfLogInvGamma_ffv_82;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_83> AgradCdfLogInvGamma_ffv_83;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_84> AgradCdfLogInvGamma_ffv_84;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_85> AgradCdfLogInvGamma_ffv_85;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_86> AgradCdfLogInvGamma_ffv_86;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_87> AgradCdfLogInvGamma_ffv_87;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_88> AgradCdfLogInvGamma_ffv_88;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_89> AgradCdfLogInvGamma_ffv_89;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_90> AgradCdfLogInvGamma_ffv_90;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_91> AgradCdfLogInvGamma_ffv_91;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_92> AgradCdfLogInvGamma_ffv_92;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_93> AgradCdfLogInvGamma_ffv_93;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_94> AgradCdfLogInvGamma_ffv_94;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_95> AgradCdfLogInvGamma_ffv_95;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_96> AgradCdfLogInvGamma_ffv_96;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_97> AgradCdfLogInvGamma_ffv_97;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_98> AgradCdfLogInvGamma_ffv_98;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_99> AgradCdfLogInvGamma_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_0, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_1, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_2, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_3, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_4, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_5, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_6, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_7, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_8, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_9, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_10, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_11, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_12, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_13, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_14, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_15, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_16, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_17, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_18, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_19, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_20, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_21, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_22, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_23, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_24, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_25, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_26, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_27, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_28, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_29, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_30, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_31, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_32, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_33, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_34, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_35, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_36, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_37, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_38, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_39, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_40, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_41, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_42, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_43, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_44, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_45, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_46, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_47, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_48, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_49, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_50, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_51, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_52, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_53, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_54, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_55, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_56, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_57, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_58, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_59, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_60, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_61, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_62, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_63, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_64, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_65, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_66, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_67, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_68, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_69, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_70, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_71, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_72, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_73, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_74, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_75, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_76, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_77, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_78, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_79, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_80, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_81, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_82, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_83, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_84, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_85, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_86, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_87, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_88, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_89, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_90, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_91, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_92, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_93, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_94, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_95, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_96, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_97, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_98, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_99, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogInvGamma, type_v_0> AgradCdfLogInvGamma_v_0;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_1> AgradCdfLogInvGamma_v_1;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_2> AgradCdfLogInvGamma_v_2;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_3> AgradCdfLogInvGamma_v_3;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_4> AgradCdfLogInvGamma_v_4;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_5> AgradCdfLogInvGamma_v_5;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_6> AgradCdfLogInvGamma_v_6;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_7> AgradCdfLogInvGamma_v_7;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_8> AgradCdfLogInvGamma_v_8;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_9> AgradCdfLogInvGamma_v_9;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_10> AgradCdfLogInvGamma_v_10;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_11> AgradCdfLogInvGamma_v_11;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_12> AgradCdfLogInvGamma_v_12;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_13> AgradCdfLogInvGamma_v_13;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_14> AgradCdfLogInvGamma_v_14;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_15> AgradCdfLogInvGamma_v_15;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_16> AgradCdfLogInvGamma_v_16;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_17> AgradCdfLogInvGamma_v_17;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_18> AgradCdfLogInvGamma_v_18;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_19> AgradCdfLogInvGamma_v_19;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_20> AgradCdfLogInvGamma_v_20;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_21> AgradCdfLogInvGamma_v_21;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_22> AgradCdfLogInvGamma_v_22;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_23> AgradCdfLogInvGamma_v_23;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_24> AgradCdfLogInvGamma_v_24;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_25> AgradCdfLogInvGamma_v_25;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_26> AgradCdfLogInvGamma_v_26;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_27> AgradCdfLogInvGamma_v_27;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_28> AgradCdfLogInvGamma_v_28;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_29> AgradCdfLogInvGamma_v_29;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_30> AgradCdfLogInvGamma_v_30;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_31> AgradCdfLogInvGamma_v_31;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_32> AgradCdfLogInvGamma_v_32;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_33> AgradCdfLogInvGamma_v_33;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_34> AgradCdfLogInvGamma_v_34;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_35> AgradCdfLogInvGamma_v_35;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_36> AgradCdfLogInvGamma_v_36;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_37> AgradCdfLogInvGamma_v_37;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_38> AgradCdfLogInvGamma_v_38;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_39> AgradCdfLogInvGamma_v_39;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_40> AgradCdfLogInvGamma_v_40;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_41> AgradCdfLogInvGamma_v_41;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_42> AgradCdfLogInvGamma_v_42;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_43> AgradCdfLogInvGamma_v_43;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_44> AgradCdfLogInvGamma_v_44;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_45> AgradCdfLogInvGamma_v_45;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_46> AgradCdfLogInvGamma_v_46;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_47> AgradCdfLogInvGamma_v_47;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_48> AgradCdfLogInvGamma_v_48;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_49> AgradCdfLogInvGamma_v_49;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_50> AgradCdfLogInvGamma_v_50;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_51> AgradCdfLogInvGamma_v_51;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_52> AgradCdfLogInvGamma_v_52;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_53> AgradCdfLogInvGamma_v_53;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_54> AgradCdfLogInvGamma_v_54;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_55> AgradCdfLogInvGamma_v_55;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_56> AgradCdfLogInvGamma_v_56;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_57> AgradCdfLogInvGamma_v_57;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_58> AgradCdfLogInvGamma_v_58;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_59> AgradCdfLogInvGamma_v_59;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_60> AgradCdfLogInvGamma_v_60;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_61> AgradCdfLogInvGamma_v_61;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_62> AgradCdfLogInvGamma_v_62;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_63> AgradCdfLogInvGamma_v_63;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_64> AgradCdfLogInvGamma_v_64;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_65> AgradCdfLogInvGamma_v_65;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_66> AgradCdfLogInvGamma_v_66;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_67> AgradCdfLogInvGamma_v_67;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_68> AgradCdfLogInvGamma_v_68;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_69> AgradCdfLogInvGamma_v_69;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_70> AgradCdfLogInvGamma_v_70;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_71> AgradCdfLogInvGamma_v_71;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_72> AgradCdfLogInvGamma_v_72;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_73> AgradCdfLogInvGamma_v_73;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_74> AgradCdfLogInvGamma_v_74;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_75> AgradCdfLogInvGamma_v_75;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_76> AgradCdfLogInvGamma_v_76;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_77> AgradCdfLogInvGamma_v_77;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_78> AgradCdfLogInvGamma_v_78;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_79> AgradCdfLogInvGamma_v_79;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_80> AgradCdfLogInvGamma_v_80;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_81> AgradCdfLogInvGamma_v_81;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_82> AgradCdfLogInvGamma_v_82;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_83> AgradCdfLogInvGamma_v_83;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_84> AgradCdfLogInvGamma_v_84;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_85> AgradCdfLogInvGamma_v_85;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_86> AgradCdfLogInvGamma_v_86;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_87> AgradCdfLogInvGamma_v_87;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_88> AgradCdfLogInvGamma_v_88;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_89> AgradCdfLogInvGamma_v_89;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_90> AgradCdfLogInvGamma_v_90;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_91> AgradCdfLogInvGamma_v_91;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_92> AgradCdfLogInvGamma_v_92;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_93> AgradCdfLogInvGamma_v_93;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_94> AgradCdfLogInvGamma_v_94;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_95> AgradCdfLogInvGamma_v_95;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_96> AgradCdfLogInvGamma_v_96;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_97> AgradCdfLogInvGamma_v_97;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_98> AgradCdfLogInvGamma_v_98;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_99> AgradCdfLogInvGamma_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_0, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_1, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_2, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_3, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_4, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_5, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_6, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_7, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_8, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_9, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_10, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_11, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_12, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_13, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_14, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_15, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_16, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_17, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_18, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_19, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_20, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_21, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_22, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_23, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_24, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_25, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_26, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_27, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_28, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_29, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_30, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_31, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_32, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_33, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_34, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_35, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_36, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_37, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_38, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_39, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_40, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_41, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_42, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_43, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_44, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_45, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_46, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_47, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_48, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_49, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_50, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_51, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_52, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_53, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_54, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_55, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_56, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_57, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_58, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_59, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_60, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_61, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_62, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_63, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_64, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_65, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_66, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_67, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_68, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_69, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_70, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_71, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_72, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_73, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_74, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_75, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_76, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_77, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_78, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_79, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_80, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_81, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_82, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_83, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_84, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_85, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_86, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_87, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_88, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_89, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_90, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_91, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_92, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_93, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_94, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_95, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_96, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_97, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_98, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_99, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_99);
+
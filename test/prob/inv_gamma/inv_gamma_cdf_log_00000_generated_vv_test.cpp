@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_0> AgradCdfLogInvGamma_vv_0;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_1> AgradCdfLogInvGamma_vv_1;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_2> AgradCdfLogInvGamma_vv_2;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_3> AgradCdfLogInvGamma_vv_3;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_4> AgradCdfLogInvGamma_vv_4;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_5> AgradCdfLogInvGamma_vv_5;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_6> AgradCdfLogInvGamma_vv_6;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_7> AgradCdfLogInvGamma_vv_7;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_8> AgradCdfLogInvGamma_vv_8;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_9> AgradCdfLogInvGamma_vv_9;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_10> AgradCdfLogInvGamma_vv_10;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_11> AgradCdfLogInvGamma_vv_11;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_12> AgradCdfLogInvGamma_vv_12;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_13> AgradCdfLogInvGamma_vv_13;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_14> AgradCdfLogInvGamma_vv_14;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_15> AgradCdfLogInvGamma_vv_15;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_16> AgradCdfLogInvGamma_vv_16;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_17> AgradCdfLogInvGamma_vv_17;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_18> AgradCdfLogInvGamma_vv_18;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_19> AgradCdfLogInvGamma_vv_19;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_20> AgradCdfLogInvGamma_vv_20;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_21> AgradCdfLogInvGamma_vv_21;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_22> AgradCdfLogInvGamma_vv_22;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_23> AgradCdfLogInvGamma_vv_23;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_24> AgradCdfLogInvGamma_vv_24;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_25> AgradCdfLogInvGamma_vv_25;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_26> AgradCdfLogInvGamma_vv_26;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_27> AgradCdfLogInvGamma_vv_27;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_28> AgradCdfLogInvGamma_vv_28;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_29> AgradCdfLogInvGamma_vv_29;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_30> AgradCdfLogInvGamma_vv_30;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_31> AgradCdfLogInvGamma_vv_31;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_32> AgradCdfLogInvGamma_vv_32;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_33> AgradCdfLogInvGamma_vv_33;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_34> AgradCdfLogInvGamma_vv_34;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_35> AgradCdfLogInvGamma_vv_35;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_36> AgradCdfLogInvGamma_vv_36;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_37> AgradCdfLogInvGamma_vv_37;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_38> AgradCdfLogInvGamma_vv_38;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_39> AgradCdfLogInvGamma_vv_39;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_40> AgradCdfLogInvGamma_vv_40;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_41> AgradCdfLogInvGamma_vv_41;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_42> AgradCdfLogInvGamma_vv_42;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_43> AgradCdfLogInvGamma_vv_43;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_44> AgradCdfLogInvGamma_vv_44;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_45> AgradCdfLogInvGamma_vv_45;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_46> AgradCdfLogInvGamma_vv_46;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_47> AgradCdfLogInvGamma_vv_47;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_48> AgradCdfLogInvGamma_vv_48;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_49> AgradCdfLogInvGamma_vv_49;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_50> AgradCdfLogInvGamma_vv_50;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_51> AgradCdfLogInvGamma_vv_51;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_52> AgradCdfLogInvGamma_vv_52;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_53> AgradCdfLogInvGamma_vv_53;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_54> AgradCdfLogInvGamma_vv_54;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_55> AgradCdfLogInvGamma_vv_55;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_56> AgradCdfLogInvGamma_vv_56;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_57> AgradCdfLogInvGamma_vv_57;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_58> AgradCdfLogInvGamma_vv_58;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_59> AgradCdfLogInvGamma_vv_59;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_60> AgradCdfLogInvGamma_vv_60;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_61> AgradCdfLogInvGamma_vv_61;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_62> AgradCdfLogInvGamma_vv_62;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_63> AgradCdfLogInvGamma_vv_63;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_64> AgradCdfLogInvGamma_vv_64;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_65> AgradCdfLogInvGamma_vv_65;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_66> AgradCdfLogInvGamma_vv_66;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_67> AgradCdfLogInvGamma_vv_67;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_68> AgradCdfLogInvGamma_vv_68;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_69> AgradCdfLogInvGamma_vv_69;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_70> AgradCdfLogInvGamma_vv_70;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_71> AgradCdfLogInvGamma_vv_71;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_72> AgradCdfLogInvGamma_vv_72;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_73> AgradCdfLogInvGamma_vv_73;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_74> AgradCdfLogInvGamma_vv_74;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_75> AgradCdfLogInvGamma_vv_75;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_76> AgradCdfLogInvGamma_vv_76;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_77> AgradCdfLogInvGamma_vv_77;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_78> AgradCdfLogInvGamma_vv_78;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_79> AgradCdfLogInvGamma_vv_79;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_80> AgradCdfLogInvGamma_vv_80;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_81> AgradCdfLogInvGamma_vv_81;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_82> AgradCdfLogInvGamma_vv_82;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_83> AgradCdfLogInvGamma_vv_83;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_84> AgradCdfLogInvGamma_vv_84;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_85> AgradCdfLogInvGamma_vv_85;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_86> AgradCdfLogInvGamma_vv_86;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_87> AgradCdfLogInvGamma_vv_87;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_88> AgradCdfLogInvGamma_vv_88;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_89> AgradCdfLogInvGamma_vv_89;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_90> AgradCdfLogInvGamma_vv_90;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_91> AgradCdfLogInvGamma_vv_91;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_92> AgradCdfLogInvGamma_vv_92;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_93> AgradCdfLogInvGamma_vv_93;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_94> AgradCdfLogInvGamma_vv_94;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_95> AgradCdfLogInvGamma_vv_95;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_96> AgradCdfLogInvGamma_vv_96;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_97> AgradCdfLogInvGamma_vv_97;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_98> AgradCdfLogInvGamma_vv_98;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_99> AgradCdfLogInvGamma_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_0, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_1, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_2, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_3, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_4, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_5, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_6, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_7, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_8, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_9, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_10, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_11, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_12, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_13, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_14, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_15, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_16, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_17, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_18, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_19, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_20, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_21, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_22, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_23, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_24, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_25, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_26, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_27, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_28, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_29, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_30, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_31, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_32, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_33, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_34, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_35, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_36, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_37, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_38, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_39, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_40, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_41, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_42, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_43, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_44, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_45, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_46, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_47, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_48, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_49, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_50, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_51, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_52, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_53, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_54, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_55, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_56, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_57, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_58, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_59, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_60, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_61, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_62, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_63, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_64, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_65, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_66, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_67, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_68, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_69, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_70, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_71, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_72, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_73, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_74, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_75, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_76, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_77, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_78, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_79, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_80, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_81, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_82, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_83, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_84, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_85, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_86, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_87, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_88, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_89, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_90, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_91, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_92, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_93, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_94, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_95, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_96, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_97, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_98, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_99, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_100> AgradCdfLogInvGamma_ffv_100;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_101> AgradCdfLogInvGamma_ffv_101;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_102> AgradCdfLogInvGamma_ffv_102;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_103> AgradCdfLogInvGamma_ffv_103;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_104> AgradCdfLogInvGamma_ffv_104;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_105> AgradCdfLogInvGamma_ffv_105;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_106> AgradCdfLogInvGamma_ffv_106;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_107> AgradCdfLogInvGamma_ffv_107;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_108> AgradCdfLogInvGamma_ffv_108;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_109> AgradCdfLogInvGamma_ffv_109;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_110> AgradCdfLogInvGamma_ffv_110;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_111> AgradCdfLogInvGamma_ffv_111;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_112> AgradCdfLogInvGamma_ffv_112;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_113> AgradCdfLogInvGamma_ffv_113;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_114> AgradCdfLogInvGamma_ffv_114;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_115> AgradCdfLogInvGamma_ffv_115;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_116> AgradCdfLogInvGamma_ffv_116;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_117> AgradCdfLogInvGamma_ffv_117;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_118> AgradCdfLogInvGamma_ffv_118;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_119> AgradCdfLogInvGamma_ffv_119;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_120> AgradCdfLogInvGamma_ffv_120;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_121> AgradCdfLogInvGamma_ffv_121;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_122> AgradCdfLogInvGamma_ffv_122;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_123> AgradCdfLogInvGamma_ffv_123;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_124> AgradCdfLogInvGamma_ffv_124;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_125> AgradCdfLogInvGamma_ffv_125;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_126> AgradCdfLogInvGamma_ffv_126;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_127> AgradCdfLogInvGamma_ffv_127;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_128> AgradCdfLogInvGamma_ffv_128;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_129> AgradCdfLogInvGamma_ffv_129;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_130> AgradCdfLogInvGamma_ffv_130;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_131> AgradCdfLogInvGamma_ffv_131;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_132> AgradCdfLogInvGamma_ffv_132;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_133> AgradCdfLogInvGamma_ffv_133;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_134> AgradCdfLogInvGamma_ffv_134;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_135> AgradCdfLogInvGamma_ffv_135;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_136> AgradCdfLogInvGamma_ffv_136;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_137> AgradCdfLogInvGamma_ffv_137;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_138> AgradCdfLogInvGamma_ffv_138;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_139> AgradCdfLogInvGamma_ffv_139;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_140> AgradCdfLogInvGamma_ffv_140;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_141> AgradCdfLogInvGamma_ffv_141;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_142> AgradCdfLogInvGamma_ffv_142;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_143> AgradCdfLogInvGamma_ffv_143;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_144> AgradCdfLogInvGamma_ffv_144;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_145> AgradCdfLogInvGamma_ffv_145;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_146> AgradCdfLogInvGamma_ffv_146;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_147> AgradCdfLogInvGamma_ffv_147;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_148> AgradCdfLogInvGamma_ffv_148;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_149> AgradCdfLogInvGamma_ffv_149;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_150> AgradCdfLogInvGamma_ffv_150;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_151> AgradCdfLogInvGamma_ffv_151;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_152> AgradCdfLogInvGamma_ffv_152;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_153> AgradCdfLogInvGamma_ffv_153;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_154> AgradCdfLogInvGamma_ffv_154;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_155> AgradCdfLogInvGamma_ffv_155;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_156> AgradCdfLogInvGamma_ffv_156;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_157> AgradCdfLogInvGamma_ffv_157;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_158> AgradCdfLogInvGamma_ffv_158;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_159> AgradCdfLogInvGamma_ffv_159;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_160> AgradCdfLogInvGamma_ffv_160;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_161> AgradCdfLogInvGamma_ffv_161;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_162> AgradCdfLogInvGamma_ffv_162;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_163> AgradCdfLogInvGamma_ffv_163;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_164> AgradCdfLogInvGamma_ffv_164;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_165> AgradCdfLogInvGamma_ffv_165;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_166> AgradCdfLogInvGamma_ffv_166;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_167> AgradCdfLogInvGamma_ffv_167;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_168> AgradCdfLogInvGamma_ffv_168;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_169> AgradCdfLogInvGamma_ffv_169;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_170> AgradCdfLogInvGamma_ffv_170;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_171> AgradCdfLogInvGamma_ffv_171;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_172> AgradCdfLogInvGamma_ffv_172;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_173> AgradCdfLogInvGamma_ffv_173;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_174> AgradCdfLogInvGamma_ffv_174;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_175> AgradCdfLogInvGamma_ffv_175;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_176> AgradCdfLogInvGamma_ffv_176;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_177> AgradCdfLogInvGamma_ffv_177;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_178> AgradCdfLogInvGamma_ffv_178;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_179> AgradCdfLogInvGamma_ffv_179;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_180> AgradCdfLogInvGamma_ffv_180;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_181> AgradCdfLogInvGamma_ffv_181;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_182> AgradCdfLogInvGamma_ffv_182;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_183> AgradCdfLogInvGamma_ffv_183;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_184> AgradCdfLogInvGamma_ffv_184;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_185> AgradCdfLogInvGamma_ffv_185;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_186> AgradCdfLogInvGamma_ffv_186;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_187> AgradCdfLogInvGamma_ffv_187;
+typedef std::tuple<AgradCdfLogInvGamma, type_ffv_188> AgradCdfLogInvGamma_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_100, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_101, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_102, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_103, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_104, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_105, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_106, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_107, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_108, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_109, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_110, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_111, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_112, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_113, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_114, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_115, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_116, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_117, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_118, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_119, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_120, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_121, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_122, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_123, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_124, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_125, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_126, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_127, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_128, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_129, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_130, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_131, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_132, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_133, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_134, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_135, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_136, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_137, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_138, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_139, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_140, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_141, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_142, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_143, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_144, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_145, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_146, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_147, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_148, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_149, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_150, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_151, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_152, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_153, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_154, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_155, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_156, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_157, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_158, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_159, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_160, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_161, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_162, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_163, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_164, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_165, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_166, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_167, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_168, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_169, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_170, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_171, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_172, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_173, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_174, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_175, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_176, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_177, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_178, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_179, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_180, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_181, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_182, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_183, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_184, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_185, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_186, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_187, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_ffv_188, AgradCdfLogTestFixture, AgradCdfLogInvGamma_ffv_188);
+
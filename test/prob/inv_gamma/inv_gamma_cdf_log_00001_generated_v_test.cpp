@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogInvGamma, type_v_100> AgradCdfLogInvGamma_v_100;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_101> AgradCdfLogInvGamma_v_101;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_102> AgradCdfLogInvGamma_v_102;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_103> AgradCdfLogInvGamma_v_103;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_104> AgradCdfLogInvGamma_v_104;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_105> AgradCdfLogInvGamma_v_105;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_106> AgradCdfLogInvGamma_v_106;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_107> AgradCdfLogInvGamma_v_107;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_108> AgradCdfLogInvGamma_v_108;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_109> AgradCdfLogInvGamma_v_109;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_110> AgradCdfLogInvGamma_v_110;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_111> AgradCdfLogInvGamma_v_111;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_112> AgradCdfLogInvGamma_v_112;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_113> AgradCdfLogInvGamma_v_113;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_114> AgradCdfLogInvGamma_v_114;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_115> AgradCdfLogInvGamma_v_115;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_116> AgradCdfLogInvGamma_v_116;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_117> AgradCdfLogInvGamma_v_117;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_118> AgradCdfLogInvGamma_v_118;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_119> AgradCdfLogInvGamma_v_119;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_120> AgradCdfLogInvGamma_v_120;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_121> AgradCdfLogInvGamma_v_121;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_122> AgradCdfLogInvGamma_v_122;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_123> AgradCdfLogInvGamma_v_123;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_124> AgradCdfLogInvGamma_v_124;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_125> AgradCdfLogInvGamma_v_125;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_126> AgradCdfLogInvGamma_v_126;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_127> AgradCdfLogInvGamma_v_127;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_128> AgradCdfLogInvGamma_v_128;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_129> AgradCdfLogInvGamma_v_129;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_130> AgradCdfLogInvGamma_v_130;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_131> AgradCdfLogInvGamma_v_131;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_132> AgradCdfLogInvGamma_v_132;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_133> AgradCdfLogInvGamma_v_133;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_134> AgradCdfLogInvGamma_v_134;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_135> AgradCdfLogInvGamma_v_135;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_136> AgradCdfLogInvGamma_v_136;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_137> AgradCdfLogInvGamma_v_137;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_138> AgradCdfLogInvGamma_v_138;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_139> AgradCdfLogInvGamma_v_139;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_140> AgradCdfLogInvGamma_v_140;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_141> AgradCdfLogInvGamma_v_141;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_142> AgradCdfLogInvGamma_v_142;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_143> AgradCdfLogInvGamma_v_143;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_144> AgradCdfLogInvGamma_v_144;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_145> AgradCdfLogInvGamma_v_145;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_146> AgradCdfLogInvGamma_v_146;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_147> AgradCdfLogInvGamma_v_147;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_148> AgradCdfLogInvGamma_v_148;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_149> AgradCdfLogInvGamma_v_149;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_150> AgradCdfLogInvGamma_v_150;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_151> AgradCdfLogInvGamma_v_151;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_152> AgradCdfLogInvGamma_v_152;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_153> AgradCdfLogInvGamma_v_153;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_154> AgradCdfLogInvGamma_v_154;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_155> AgradCdfLogInvGamma_v_155;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_156> AgradCdfLogInvGamma_v_156;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_157> AgradCdfLogInvGamma_v_157;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_158> AgradCdfLogInvGamma_v_158;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_159> AgradCdfLogInvGamma_v_159;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_160> AgradCdfLogInvGamma_v_160;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_161> AgradCdfLogInvGamma_v_161;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_162> AgradCdfLogInvGamma_v_162;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_163> AgradCdfLogInvGamma_v_163;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_164> AgradCdfLogInvGamma_v_164;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_165> AgradCdfLogInvGamma_v_165;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_166> AgradCdfLogInvGamma_v_166;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_167> AgradCdfLogInvGamma_v_167;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_168> AgradCdfLogInvGamma_v_168;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_169> AgradCdfLogInvGamma_v_169;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_170> AgradCdfLogInvGamma_v_170;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_171> AgradCdfLogInvGamma_v_171;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_172> AgradCdfLogInvGamma_v_172;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_173> AgradCdfLogInvGamma_v_173;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_174> AgradCdfLogInvGamma_v_174;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_175> AgradCdfLogInvGamma_v_175;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_176> AgradCdfLogInvGamma_v_176;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_177> AgradCdfLogInvGamma_v_177;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_178> AgradCdfLogInvGamma_v_178;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_179> AgradCdfLogInvGamma_v_179;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_180> AgradCdfLogInvGamma_v_180;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_181> AgradCdfLogInvGamma_v_181;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_182> AgradCdfLogInvGamma_v_182;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_183> AgradCdfLogInvGamma_v_183;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_184> AgradCdfLogInvGamma_v_184;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_185> AgradCdfLogInvGamma_v_185;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_186> AgradCdfLogInvGamma_v_186;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_187> AgradCdfLogInvGamma_v_187;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_188> AgradCdfLogInvGamma_v_188;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_189> AgradCdfLogInvGamma_v_189;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_190> AgradCdfLogInvGamma_v_190;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_191> AgradCdfLogInvGamma_v_191;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_192> AgradCdfLogInvGamma_v_192;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_193> AgradCdfLogInvGamma_v_193;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_194> AgradCdfLogInvGamma_v_194;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_195> AgradCdfLogInvGamma_v_195;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_196> AgradCdfLogInvGamma_v_196;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_197> AgradCdfLogInvGamma_v_197;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_198> AgradCdfLogInvGamma_v_198;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_199> AgradCdfLogInvGamma_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_100, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_101, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_102, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_103, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_104, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_105, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_106, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_107, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_108, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_109, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_110, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_111, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_112, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_113, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_114, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_115, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_116, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_117, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_118, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_119, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_120, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_121, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_122, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_123, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_124, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_125, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_126, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_127, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_128, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_129, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_130, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_131, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_132, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_133, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_134, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_135, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_136, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_137, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_138, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_139, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_140, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_141, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_142, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_143, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_144, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_145, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_146, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_147, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_148, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_149, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_150, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_151, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_152, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_153, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_154, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_155, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_156, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_157, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_158, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_159, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_160, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_161, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_162, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_163, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_164, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_165, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_166, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_167, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_168, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_169, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_170, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_171, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_172, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_173, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_174, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_175, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_176, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_177, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_178, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_179, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_180, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_181, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_182, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_183, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_184, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_185, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_186, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_187, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_188, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_189, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_190, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_191, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_192, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_193, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_194, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_195, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_196, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_197, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_198, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_199, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_199);
+
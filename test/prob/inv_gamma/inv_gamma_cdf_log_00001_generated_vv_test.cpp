@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_100> AgradCdfLogInvGamma_vv_100;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_101> AgradCdfLogInvGamma_vv_101;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_102> AgradCdfLogInvGamma_vv_102;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_103> AgradCdfLogInvGamma_vv_103;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_104> AgradCdfLogInvGamma_vv_104;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_105> AgradCdfLogInvGamma_vv_105;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_106> AgradCdfLogInvGamma_vv_106;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_107> AgradCdfLogInvGamma_vv_107;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_108> AgradCdfLogInvGamma_vv_108;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_109> AgradCdfLogInvGamma_vv_109;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_110> AgradCdfLogInvGamma_vv_110;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_111> AgradCdfLogInvGamma_vv_111;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_112> AgradCdfLogInvGamma_vv_112;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_113> AgradCdfLogInvGamma_vv_113;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_114> AgradCdfLogInvGamma_vv_114;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_115> AgradCdfLogInvGamma_vv_115;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_116> AgradCdfLogInvGamma_vv_116;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_117> AgradCdfLogInvGamma_vv_117;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_118> AgradCdfLogInvGamma_vv_118;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_119> AgradCdfLogInvGamma_vv_119;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_120> AgradCdfLogInvGamma_vv_120;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_121> AgradCdfLogInvGamma_vv_121;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_122> AgradCdfLogInvGamma_vv_122;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_123> AgradCdfLogInvGamma_vv_123;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_124> AgradCdfLogInvGamma_vv_124;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_125> AgradCdfLogInvGamma_vv_125;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_126> AgradCdfLogInvGamma_vv_126;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_127> AgradCdfLogInvGamma_vv_127;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_128> AgradCdfLogInvGamma_vv_128;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_129> AgradCdfLogInvGamma_vv_129;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_130> AgradCdfLogInvGamma_vv_130;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_131> AgradCdfLogInvGamma_vv_131;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_132> AgradCdfLogInvGamma_vv_132;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_133> AgradCdfLogInvGamma_vv_133;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_134> AgradCdfLogInvGamma_vv_134;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_135> AgradCdfLogInvGamma_vv_135;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_136> AgradCdfLogInvGamma_vv_136;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_137> AgradCdfLogInvGamma_vv_137;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_138> AgradCdfLogInvGamma_vv_138;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_139> AgradCdfLogInvGamma_vv_139;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_140> AgradCdfLogInvGamma_vv_140;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_141> AgradCdfLogInvGamma_vv_141;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_142> AgradCdfLogInvGamma_vv_142;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_143> AgradCdfLogInvGamma_vv_143;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_144> AgradCdfLogInvGamma_vv_144;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_145> AgradCdfLogInvGamma_vv_145;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_146> AgradCdfLogInvGamma_vv_146;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_147> AgradCdfLogInvGamma_vv_147;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_148> AgradCdfLogInvGamma_vv_148;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_149> AgradCdfLogInvGamma_vv_149;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_150> AgradCdfLogInvGamma_vv_150;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_151> AgradCdfLogInvGamma_vv_151;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_152> AgradCdfLogInvGamma_vv_152;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_153> AgradCdfLogInvGamma_vv_153;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_154> AgradCdfLogInvGamma_vv_154;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_155> AgradCdfLogInvGamma_vv_155;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_156> AgradCdfLogInvGamma_vv_156;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_157> AgradCdfLogInvGamma_vv_157;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_158> AgradCdfLogInvGamma_vv_158;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_159> AgradCdfLogInvGamma_vv_159;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_160> AgradCdfLogInvGamma_vv_160;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_161> AgradCdfLogInvGamma_vv_161;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_162> AgradCdfLogInvGamma_vv_162;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_163> AgradCdfLogInvGamma_vv_163;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_164> AgradCdfLogInvGamma_vv_164;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_165> AgradCdfLogInvGamma_vv_165;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_166> AgradCdfLogInvGamma_vv_166;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_167> AgradCdfLogInvGamma_vv_167;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_168> AgradCdfLogInvGamma_vv_168;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_169> AgradCdfLogInvGamma_vv_169;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_170> AgradCdfLogInvGamma_vv_170;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_171> AgradCdfLogInvGamma_vv_171;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_172> AgradCdfLogInvGamma_vv_172;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_173> AgradCdfLogInvGamma_vv_173;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_174> AgradCdfLogInvGamma_vv_174;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_175> AgradCdfLogInvGamma_vv_175;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_176> AgradCdfLogInvGamma_vv_176;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_177> AgradCdfLogInvGamma_vv_177;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_178> AgradCdfLogInvGamma_vv_178;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_179> AgradCdfLogInvGamma_vv_179;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_180> AgradCdfLogInvGamma_vv_180;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_181> AgradCdfLogInvGamma_vv_181;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_182> AgradCdfLogInvGamma_vv_182;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_183> AgradCdfLogInvGamma_vv_183;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_184> AgradCdfLogInvGamma_vv_184;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_185> AgradCdfLogInvGamma_vv_185;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_186> AgradCdfLogInvGamma_vv_186;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_187> AgradCdfLogInvGamma_vv_187;
+typedef std::tuple<AgradCdfLogInvGamma, type_vv_188> AgradCdfLogInvGamma_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_100, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_101, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_102, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_103, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_104, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_105, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_106, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_107, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_108, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_109, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_110, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_111, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_112, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_113, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_114, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_115, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_116, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_117, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_118, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_119, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_120, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_121, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_122, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_123, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_124, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_125, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_126, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_127, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_128, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_129, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_130, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_131, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_132, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_133, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_134, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_135, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_136, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_137, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_138, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_139, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_140, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_141, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_142, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_143, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_144, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_145, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_146, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_147, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_148, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_149, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_150, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_151, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_152, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_153, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_154, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_155, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_156, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_157, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_158, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_159, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_160, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_161, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_162, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_163, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_164, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_165, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_166, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_167, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_168, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_169, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_170, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_171, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_172, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_173, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_174, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_175, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_176, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_177, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_178, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_179, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_180, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_181, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_182, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_183, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_184, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_185, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_186, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_187, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_vv_188, AgradCdfLogTestFixture, AgradCdfLogInvGamma_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/inv_gamma/inv_gamma_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCdfLogInvGamma, type_v_200> AgradCdfLogInvGamma_v_200;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_201> AgradCdfLogInvGamma_v_201;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_202> AgradCdfLogInvGamma_v_202;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_203> AgradCdfLogInvGamma_v_203;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_204> AgradCdfLogInvGamma_v_204;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_205> AgradCdfLogInvGamma_v_205;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_206> AgradCdfLogInvGamma_v_206;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_207> AgradCdfLogInvGamma_v_207;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_208> AgradCdfLogInvGamma_v_208;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_209> AgradCdfLogInvGamma_v_209;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_210> AgradCdfLogInvGamma_v_210;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_211> AgradCdfLogInvGamma_v_211;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_212> AgradCdfLogInvGamma_v_212;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_213> AgradCdfLogInvGamma_v_213;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_214> AgradCdfLogInvGamma_v_214;
+typedef std::tuple<AgradCdfLogInvGamma, type_v_215> AgradCdfLogInvGamma_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_200, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_201, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_202, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_203, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_204, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_205, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_206, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_207, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_208, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_209, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_210, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_211, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_212, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_213, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_214, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogInvGamma_v_215, AgradCdfLogTestFixture, AgradCdfLogInvGamma_v_215);
+
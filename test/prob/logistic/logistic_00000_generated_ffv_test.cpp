@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_0> AgradDistributionsLogistic_ffv_0;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_1> AgradDistributionsLogistic_ffv_1;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_2> AgradDistributionsLogistic_ffv_2;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_3> AgradDistributionsLogistic_ffv_3;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_4> AgradDistributionsLogistic_ffv_4;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_5> AgradDistributionsLogistic_ffv_5;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_6> AgradDistributionsLogistic_ffv_6;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_7> AgradDistributionsLogistic_ffv_7;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_8> AgradDistributionsLogistic_ffv_8;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_9> AgradDistributionsLogistic_ffv_9;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_10> AgradDistributionsLogistic_ffv_10;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_11> AgradDistributionsLogistic_ffv_11;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_12> AgradDistributionsLogistic_ffv_12;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_13> AgradDistributionsLogistic_ffv_13;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_14> AgradDistributionsLogistic_ffv_14;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_15> AgradDistributionsLogistic_ffv_15;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_16> AgradDistributionsLogistic_ffv_16;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_17> AgradDistributionsLogistic_ffv_17;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_18> AgradDistributionsLogistic_ffv_18;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_19> AgradDistributionsLogistic_ffv_19;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_20> AgradDistributionsLogistic_ffv_20;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_21> AgradDistributionsLogistic_ffv_21;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_22> AgradDistributionsLogistic_ffv_22;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_23> AgradDistributionsLogistic_ffv_23;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_24> AgradDistributionsLogistic_ffv_24;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_25> AgradDistributionsLogistic_ffv_25;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_26> AgradDistributionsLogistic_ffv_26;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_27> AgradDistributionsLogistic_ffv_27;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_28> AgradDistributionsLogistic_ffv_28;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_29> AgradDistributionsLogistic_ffv_29;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_30> AgradDistributionsLogistic_ffv_30;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_31> AgradDistributionsLogistic_ffv_31;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_32> AgradDistributionsLogistic_ffv_32;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_33> AgradDistributionsLogistic_ffv_33;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_34> AgradDistributionsLogistic_ffv_34;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_35> AgradDistributionsLogistic_ffv_35;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_36> AgradDistributionsLogistic_ffv_36;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_37> AgradDistributionsLogistic_ffv_37;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_38> AgradDistributionsLogistic_ffv_38;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_39> AgradDistributionsLogistic_ffv_39;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_40> AgradDistributionsLogistic_ffv_40;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_41> AgradDistributionsLogistic_ffv_41;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_42> AgradDistributionsLogistic_ffv_42;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_43> AgradDistributionsLogistic_ffv_43;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_44> AgradDistributionsLogistic_ffv_44;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_45> AgradDistributionsLogistic_ffv_45;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_46> AgradDistributionsLogistic_ffv_46;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_47> AgradDistributionsLogistic_ffv_47;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_48> AgradDistributionsLogistic_ffv_48;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_49> AgradDistributionsLogistic_ffv_49;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_50> AgradDistributionsLogistic_ffv_50;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_51> AgradDistributionsLogistic_ffv_51;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_52> AgradDistributionsLogistic_ffv_52;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_53> AgradDistributionsLogistic_ffv_53;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_54> AgradDistributionsLogistic_ffv_54;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_55> AgradDistributionsLogistic_ffv_55;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_56> AgradDistributionsLogistic_ffv_56;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_57> AgradDistributionsLogistic_ffv_57;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_58> AgradDistributionsLogistic_ffv_58;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_59> AgradDistributionsLogistic_ffv_59;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_60> AgradDistributionsLogistic_ffv_60;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_61> AgradDistributionsLogistic_ffv_61;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_62> AgradDistributionsLogistic_ffv_62;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_63> AgradDistributionsLogistic_ffv_63;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_64> AgradDistributionsLogistic_ffv_64;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_65> AgradDistributionsLogistic_ffv_65;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_66> AgradDistributionsLogistic_ffv_66;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_67> AgradDistributionsLogistic_ffv_67;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_68> AgradDistributionsLogistic_ffv_68;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_69> AgradDistributionsLogistic_ffv_69;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_70> AgradDistributionsLogistic_ffv_70;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_71> AgradDistributionsLogistic_ffv_71;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_72> AgradDistributionsLogistic_ffv_72;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_73> AgradDistributionsLogistic_ffv_73;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_74> AgradDistributionsLogistic_ffv_74;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_75> AgradDistributionsLogistic_ffv_75;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_76> AgradDistributionsLogistic_ffv_76;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_77> AgradDistributionsLogistic_ffv_77;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_78> AgradDistributionsLogistic_ffv_78;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_79> AgradDistributionsLogistic_ffv_79;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_80> AgradDistributionsLogistic_ffv_80;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_81> AgradDistributionsLogistic_ffv_81;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_82> AgradDistributionsLogistic_ffv_82;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_83> AgradDistributionsLogistic_ffv_83;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_84> AgradDistributionsLogistic_ffv_84;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_85> AgradDistributionsLogistic_ffv_85;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_86> AgradDistributionsLogistic_ffv_86;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_87> AgradDistributionsLogistic_ffv_87;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_88> AgradDistributionsLogistic_ffv_88;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_89> AgradDistributionsLogistic_ffv_89;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_90> AgradDistributionsLogistic_ffv_90;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_91> AgradDistributionsLogistic_ffv_91;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_92> AgradDistributionsLogistic_ffv_92;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_93> AgradDistributionsLogistic_ffv_93;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_94> AgradDistributionsLogistic_ffv_94;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_95> AgradDistributionsLogistic_ffv_95;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_96> AgradDistributionsLogistic_ffv_96;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_97> AgradDistributionsLogistic_ffv_97;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_98> AgradDistributionsLogistic_ffv_98;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_99> AgradDistributionsLogistic_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_0, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_1, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_2, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_3, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_4, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_5, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_6, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_7, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_8, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_9, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_10, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_11, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_12, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_13, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_14, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_15, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_16, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_17, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_18, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_19, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_20, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_21, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_22, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_23, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_24, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_25, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_26, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_27, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_28, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_29, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_30, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_31, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_32, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_33, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_34, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_35, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_36, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_37, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_38, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_39, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_40, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_41, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_42, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_43, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_44, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_45, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_46, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_47, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_48, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_49, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_50, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_51, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_52, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_53, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_54, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_55, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_56, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_57, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_58, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_59, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_60, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_61, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_62, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_63, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_64, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_65, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_66, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_67, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_68, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_69, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_70, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_71, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_72, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_73, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_74, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_75, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_76, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_77, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_78, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_79, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_80, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_81, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_82, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_83, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_84, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_85, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_86, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_87, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_88, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_89, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_90, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_91, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_92, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_93, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_94, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_95, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_96, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_97, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_98, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_99, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsLogistic, type_v_0> AgradDistributionsLogistic_v_0;
+typedef std::tuple<AgradDistributionsLogistic, type_v_1> AgradDistributionsLogistic_v_1;
+typedef std::tuple<AgradDistributionsLogistic, type_v_2> AgradDistributionsLogistic_v_2;
+typedef std::tuple<AgradDistributionsLogistic, type_v_3> AgradDistributionsLogistic_v_3;
+typedef std::tuple<AgradDistributionsLogistic, type_v_4> AgradDistributionsLogistic_v_4;
+typedef std::tuple<AgradDistributionsLogistic, type_v_5> AgradDistributionsLogistic_v_5;
+typedef std::tuple<AgradDistributionsLogistic, type_v_6> AgradDistributionsLogistic_v_6;
+typedef std::tuple<AgradDistributionsLogistic, type_v_7> AgradDistributionsLogistic_v_7;
+typedef std::tuple<AgradDistributionsLogistic, type_v_8> AgradDistributionsLogistic_v_8;
+typedef std::tuple<AgradDistributionsLogistic, type_v_9> AgradDistributionsLogistic_v_9;
+typedef std::tuple<AgradDistributionsLogistic, type_v_10> AgradDistributionsLogistic_v_10;
+typedef std::tuple<AgradDistributionsLogistic, type_v_11> AgradDistributionsLogistic_v_11;
+typedef std::tuple<AgradDistributionsLogistic, type_v_12> AgradDistributionsLogistic_v_12;
+typedef std::tuple<AgradDistributionsLogistic, type_v_13> AgradDistributionsLogistic_v_13;
+typedef std::tuple<AgradDistributionsLogistic, type_v_14> AgradDistributionsLogistic_v_14;
+typedef std::tuple<AgradDistributionsLogistic, type_v_15> AgradDistributionsLogistic_v_15;
+typedef std::tuple<AgradDistributionsLogistic, type_v_16> AgradDistributionsLogistic_v_16;
+typedef std::tuple<AgradDistributionsLogistic, type_v_17> AgradDistributionsLogistic_v_17;
+typedef std::tuple<AgradDistributionsLogistic, type_v_18> AgradDistributionsLogistic_v_18;
+typedef std::tuple<AgradDistributionsLogistic, type_v_19> AgradDistributionsLogistic_v_19;
+typedef std::tuple<AgradDistributionsLogistic, type_v_20> AgradDistributionsLogistic_v_20;
+typedef std::tuple<AgradDistributionsLogistic, type_v_21> AgradDistributionsLogistic_v_21;
+typedef std::tuple<AgradDistributionsLogistic, type_v_22> AgradDistributionsLogistic_v_22;
+typedef std::tuple<AgradDistributionsLogistic, type_v_23> AgradDistributionsLogistic_v_23;
+typedef std::tuple<AgradDistributionsLogistic, type_v_24> AgradDistributionsLogistic_v_24;
+typedef std::tuple<AgradDistributionsLogistic, type_v_25> AgradDistributionsLogistic_v_25;
+typedef std::tuple<AgradDistributionsLogistic, type_v_26> AgradDistributionsLogistic_v_26;
+typedef std::tuple<AgradDistributionsLogistic, type_v_27> AgradDistributionsLogistic_v_27;
+typedef std::tuple<AgradDistributionsLogistic, type_v_28> AgradDistributionsLogistic_v_28;
+typedef std::tuple<AgradDistributionsLogistic, type_v_29> AgradDistributionsLogistic_v_29;
+typedef std::tuple<AgradDistributionsLogistic, type_v_30> AgradDistributionsLogistic_v_30;
+typedef std::tuple<AgradDistributionsLogistic, type_v_31> AgradDistributionsLogistic_v_31;
+typedef std::tuple<AgradDistributionsLogistic, type_v_32> AgradDistributionsLogistic_v_32;
+typedef std::tuple<AgradDistributionsLogistic, type_v_33> AgradDistributionsLogistic_v_33;
+typedef std::tuple<AgradDistributionsLogistic, type_v_34> AgradDistributionsLogistic_v_34;
+typedef std::tuple<AgradDistributionsLogistic, type_v_35> AgradDistributionsLogistic_v_35;
+typedef std::tuple<AgradDistributionsLogistic, type_v_36> AgradDistributionsLogistic_v_36;
+typedef std::tuple<AgradDistributionsLogistic, type_v_37> AgradDistributionsLogistic_v_37;
+typedef std::tuple<AgradDistributionsLogistic, type_v_38> AgradDistributionsLogistic_v_38;
+typedef std::tuple<AgradDistributionsLogistic, type_v_39> AgradDistributionsLogistic_v_39;
+typedef std::tuple<AgradDistributionsLogistic, type_v_40> AgradDistributionsLogistic_v_40;
+typedef std::tuple<AgradDistributionsLogistic, type_v_41> AgradDistributionsLogistic_v_41;
+typedef std::tuple<AgradDistributionsLogistic, type_v_42> AgradDistributionsLogistic_v_42;
+typedef std::tuple<AgradDistributionsLogistic, type_v_43> AgradDistributionsLogistic_v_43;
+typedef std::tuple<AgradDistributionsLogistic, type_v_44> AgradDistributionsLogistic_v_44;
+typedef std::tuple<AgradDistributionsLogistic, type_v_45> AgradDistributionsLogistic_v_45;
+typedef std::tuple<AgradDistributionsLogistic, type_v_46> AgradDistributionsLogistic_v_46;
+typedef std::tuple<AgradDistributionsLogistic, type_v_47> AgradDistributionsLogistic_v_47;
+typedef std::tuple<AgradDistributionsLogistic, type_v_48> AgradDistributionsLogistic_v_48;
+typedef std::tuple<AgradDistributionsLogistic, type_v_49> AgradDistributionsLogistic_v_49;
+typedef std::tuple<AgradDistributionsLogistic, type_v_50> AgradDistributionsLogistic_v_50;
+typedef std::tuple<AgradDistributionsLogistic, type_v_51> AgradDistributionsLogistic_v_51;
+typedef std::tuple<AgradDistributionsLogistic, type_v_52> AgradDistributionsLogistic_v_52;
+typedef std::tuple<AgradDistributionsLogistic, type_v_53> AgradDistributionsLogistic_v_53;
+typedef std::tuple<AgradDistributionsLogistic, type_v_54> AgradDistributionsLogistic_v_54;
+typedef std::tuple<AgradDistributionsLogistic, type_v_55> AgradDistributionsLogistic_v_55;
+typedef std::tuple<AgradDistributionsLogistic, type_v_56> AgradDistributionsLogistic_v_56;
+typedef std::tuple<AgradDistributionsLogistic, type_v_57> AgradDistributionsLogistic_v_57;
+typedef std::tuple<AgradDistributionsLogistic, type_v_58> AgradDistributionsLogistic_v_58;
+typedef std::tuple<AgradDistributionsLogistic, type_v_59> AgradDistributionsLogistic_v_59;
+typedef std::tuple<AgradDistributionsLogistic, type_v_60> AgradDistributionsLogistic_v_60;
+typedef std::tuple<AgradDistributionsLogistic, type_v_61> AgradDistributionsLogistic_v_61;
+typedef std::tuple<AgradDistributionsLogistic, type_v_62> AgradDistributionsLogistic_v_62;
+typedef std::tuple<AgradDistributionsLogistic, type_v_63> AgradDistributionsLogistic_v_63;
+typedef std::tuple<AgradDistributionsLogistic, type_v_64> AgradDistributionsLogistic_v_64;
+typedef std::tuple<AgradDistributionsLogistic, type_v_65> AgradDistributionsLogistic_v_65;
+typedef std::tuple<AgradDistributionsLogistic, type_v_66> AgradDistributionsLogistic_v_66;
+typedef std::tuple<AgradDistributionsLogistic, type_v_67> AgradDistributionsLogistic_v_67;
+typedef std::tuple<AgradDistributionsLogistic, type_v_68> AgradDistributionsLogistic_v_68;
+typedef std::tuple<AgradDistributionsLogistic, type_v_69> AgradDistributionsLogistic_v_69;
+typedef std::tuple<AgradDistributionsLogistic, type_v_70> AgradDistributionsLogistic_v_70;
+typedef std::tuple<AgradDistributionsLogistic, type_v_71> AgradDistributionsLogistic_v_71;
+typedef std::tuple<AgradDistributionsLogistic, type_v_72> AgradDistributionsLogistic_v_72;
+typedef std::tuple<AgradDistributionsLogistic, type_v_73> AgradDistributionsLogistic_v_73;
+typedef std::tuple<AgradDistributionsLogistic, type_v_74> AgradDistributionsLogistic_v_74;
+typedef std::tuple<AgradDistributionsLogistic, type_v_75> AgradDistributionsLogistic_v_75;
+typedef std::tuple<AgradDistributionsLogistic, type_v_76> AgradDistributionsLogistic_v_76;
+typedef std::tuple<AgradDistributionsLogistic, type_v_77> AgradDistributionsLogistic_v_77;
+typedef std::tuple<AgradDistributionsLogistic, type_v_78> AgradDistributionsLogistic_v_78;
+typedef std::tuple<AgradDistributionsLogistic, type_v_79> AgradDistributionsLogistic_v_79;
+typedef std::tuple<AgradDistributionsLogistic, type_v_80> AgradDistributionsLogistic_v_80;
+typedef std::tuple<AgradDistributionsLogistic, type_v_81> AgradDistributionsLogistic_v_81;
+typedef std::tuple<AgradDistributionsLogistic, type_v_82> AgradDistributionsLogistic_v_82;
+typedef std::tuple<AgradDistributionsLogistic, type_v_83> AgradDistributionsLogistic_v_83;
+typedef std::tuple<AgradDistributionsLogistic, type_v_84> AgradDistributionsLogistic_v_84;
+typedef std::tuple<AgradDistributionsLogistic, type_v_85> AgradDistributionsLogistic_v_85;
+typedef std::tuple<AgradDistributionsLogistic, type_v_86> AgradDistributionsLogistic_v_86;
+typedef std::tuple<AgradDistributionsLogistic, type_v_87> AgradDistributionsLogistic_v_87;
+typedef std::tuple<AgradDistributionsLogistic, type_v_88> AgradDistributionsLogistic_v_88;
+typedef std::tuple<AgradDistributionsLogistic, type_v_89> AgradDistributionsLogistic_v_89;
+typedef std::tuple<AgradDistributionsLogistic, type_v_90> AgradDistributionsLogistic_v_90;
+typedef std::tuple<AgradDistributionsLogistic, type_v_91> AgradDistributionsLogistic_v_91;
+typedef std::tuple<AgradDistributionsLogistic, type_v_92> AgradDistributionsLogistic_v_92;
+typedef std::tuple<AgradDistributionsLogistic, type_v_93> AgradDistributionsLogistic_v_93;
+typedef std::tuple<AgradDistributionsLogistic, type_v_94> AgradDistributionsLogistic_v_94;
+typedef std::tuple<AgradDistributionsLogistic, type_v_95> AgradDistributionsLogistic_v_95;
+typedef std::tuple<AgradDistributionsLogistic, type_v_96> AgradDistributionsLogistic_v_96;
+typedef std::tuple<AgradDistributionsLogistic, type_v_97> AgradDistributionsLogistic_v_97;
+typedef std::tuple<AgradDistributionsLogistic, type_v_98> AgradDistributionsLogistic_v_98;
+typedef std::tuple<AgradDistributionsLogistic, type_v_99> AgradDistributionsLogistic_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_0, AgradDistributionTestFixture, AgradDistributionsLogistic_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_1, AgradDistributionTestFixture, AgradDistributionsLogistic_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_2, AgradDistributionTestFixture, AgradDistributionsLogistic_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_3, AgradDistributionTestFixture, AgradDistributionsLogistic_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_4, AgradDistributionTestFixture, AgradDistributionsLogistic_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_5, AgradDistributionTestFixture, AgradDistributionsLogistic_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_6, AgradDistributionTestFixture, AgradDistributionsLogistic_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_7, AgradDistributionTestFixture, AgradDistributionsLogistic_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_8, AgradDistributionTestFixture, AgradDistributionsLogistic_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_9, AgradDistributionTestFixture, AgradDistributionsLogistic_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_10, AgradDistributionTestFixture, AgradDistributionsLogistic_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_11, AgradDistributionTestFixture, AgradDistributionsLogistic_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_12, AgradDistributionTestFixture, AgradDistributionsLogistic_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_13, AgradDistributionTestFixture, AgradDistributionsLogistic_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_14, AgradDistributionTestFixture, AgradDistributionsLogistic_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_15, AgradDistributionTestFixture, AgradDistributionsLogistic_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_16, AgradDistributionTestFixture, AgradDistributionsLogistic_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_17, AgradDistributionTestFixture, AgradDistributionsLogistic_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_18, AgradDistributionTestFixture, AgradDistributionsLogistic_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_19, AgradDistributionTestFixture, AgradDistributionsLogistic_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_20, AgradDistributionTestFixture, AgradDistributionsLogistic_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_21, AgradDistributionTestFixture, AgradDistributionsLogistic_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_22, AgradDistributionTestFixture, AgradDistributionsLogistic_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_23, AgradDistributionTestFixture, AgradDistributionsLogistic_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_24, AgradDistributionTestFixture, AgradDistributionsLogistic_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_25, AgradDistributionTestFixture, AgradDistributionsLogistic_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_26, AgradDistributionTestFixture, AgradDistributionsLogistic_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_27, AgradDistributionTestFixture, AgradDistributionsLogistic_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_28, AgradDistributionTestFixture, AgradDistributionsLogistic_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_29, AgradDistributionTestFixture, AgradDistributionsLogistic_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_30, AgradDistributionTestFixture, AgradDistributionsLogistic_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_31, AgradDistributionTestFixture, AgradDistributionsLogistic_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_32, AgradDistributionTestFixture, AgradDistributionsLogistic_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_33, AgradDistributionTestFixture, AgradDistributionsLogistic_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_34, AgradDistributionTestFixture, AgradDistributionsLogistic_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_35, AgradDistributionTestFixture, AgradDistributionsLogistic_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_36, AgradDistributionTestFixture, AgradDistributionsLogistic_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_37, AgradDistributionTestFixture, AgradDistributionsLogistic_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_38, AgradDistributionTestFixture, AgradDistributionsLogistic_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_39, AgradDistributionTestFixture, AgradDistributionsLogistic_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_40, AgradDistributionTestFixture, AgradDistributionsLogistic_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_41, AgradDistributionTestFixture, AgradDistributionsLogistic_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_42, AgradDistributionTestFixture, AgradDistributionsLogistic_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_43, AgradDistributionTestFixture, AgradDistributionsLogistic_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_44, AgradDistributionTestFixture, AgradDistributionsLogistic_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_45, AgradDistributionTestFixture, AgradDistributionsLogistic_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_46, AgradDistributionTestFixture, AgradDistributionsLogistic_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_47, AgradDistributionTestFixture, AgradDistributionsLogistic_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_48, AgradDistributionTestFixture, AgradDistributionsLogistic_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_49, AgradDistributionTestFixture, AgradDistributionsLogistic_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_50, AgradDistributionTestFixture, AgradDistributionsLogistic_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_51, AgradDistributionTestFixture, AgradDistributionsLogistic_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_52, AgradDistributionTestFixture, AgradDistributionsLogistic_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_53, AgradDistributionTestFixture, AgradDistributionsLogistic_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_54, AgradDistributionTestFixture, AgradDistributionsLogistic_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_55, AgradDistributionTestFixture, AgradDistributionsLogistic_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_56, AgradDistributionTestFixture, AgradDistributionsLogistic_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_57, AgradDistributionTestFixture, AgradDistributionsLogistic_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_58, AgradDistributionTestFixture, AgradDistributionsLogistic_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_59, AgradDistributionTestFixture, AgradDistributionsLogistic_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_60, AgradDistributionTestFixture, AgradDistributionsLogistic_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_61, AgradDistributionTestFixture, AgradDistributionsLogistic_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_62, AgradDistributionTestFixture, AgradDistributionsLogistic_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_63, AgradDistributionTestFixture, AgradDistributionsLogistic_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_64, AgradDistributionTestFixture, AgradDistributionsLogistic_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_65, AgradDistributionTestFixture, AgradDistributionsLogistic_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_66, AgradDistributionTestFixture, AgradDistributionsLogistic_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_67, AgradDistributionTestFixture, AgradDistributionsLogistic_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_68, AgradDistributionTestFixture, AgradDistributionsLogistic_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_69, AgradDistributionTestFixture, AgradDistributionsLogistic_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_70, AgradDistributionTestFixture, AgradDistributionsLogistic_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_71, AgradDistributionTestFixture, AgradDistributionsLogistic_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_72, AgradDistributionTestFixture, AgradDistributionsLogistic_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_73, AgradDistributionTestFixture, AgradDistributionsLogistic_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_74, AgradDistributionTestFixture, AgradDistributionsLogistic_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_75, AgradDistributionTestFixture, AgradDistributionsLogistic_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_76, AgradDistributionTestFixture, AgradDistributionsLogistic_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_77, AgradDistributionTestFixture, AgradDistributionsLogistic_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_78, AgradDistributionTestFixture, AgradDistributionsLogistic_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_79, AgradDistributionTestFixture, AgradDistributionsLogistic_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_80, AgradDistributionTestFixture, AgradDistributionsLogistic_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_81, AgradDistributionTestFixture, AgradDistributionsLogistic_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_82, AgradDistributionTestFixture, AgradDistributionsLogistic_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_83, AgradDistributionTestFixture, AgradDistributionsLogistic_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_84, AgradDistributionTestFixture, AgradDistributionsLogistic_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_85, AgradDistributionTestFixture, AgradDistributionsLogistic_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_86, AgradDistributionTestFixture, AgradDistributionsLogistic_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_87, AgradDistributionTestFixture, AgradDistributionsLogistic_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_88, AgradDistributionTestFixture, AgradDistributionsLogistic_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_89, AgradDistributionTestFixture, AgradDistributionsLogistic_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_90, AgradDistributionTestFixture, AgradDistributionsLogistic_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_91, AgradDistributionTestFixture, AgradDistributionsLogistic_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_92, AgradDistributionTestFixture, AgradDistributionsLogistic_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_93, AgradDistributionTestFixture, AgradDistributionsLogistic_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_94, AgradDistributionTestFixture, AgradDistributionsLogistic_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_95, AgradDistributionTestFixture, AgradDistributionsLogistic_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_96, AgradDistributionTestFixture, AgradDistributionsLogistic_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_97, AgradDistributionTestFixture, AgradDistributionsLogistic_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_98, AgradDistributionTestFixture, AgradDistributionsLogistic_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_99, AgradDistributionTestFixture, AgradDistributionsLogistic_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsLogistic, type_vv_0> AgradDistributionsLogistic_vv_0;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_1> AgradDistributionsLogistic_vv_1;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_2> AgradDistributionsLogistic_vv_2;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_3> AgradDistributionsLogistic_vv_3;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_4> AgradDistributionsLogistic_vv_4;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_5> AgradDistributionsLogistic_vv_5;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_6> AgradDistributionsLogistic_vv_6;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_7> AgradDistributionsLogistic_vv_7;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_8> AgradDistributionsLogistic_vv_8;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_9> AgradDistributionsLogistic_vv_9;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_10> AgradDistributionsLogistic_vv_10;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_11> AgradDistributionsLogistic_vv_11;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_12> AgradDistributionsLogistic_vv_12;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_13> AgradDistributionsLogistic_vv_13;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_14> AgradDistributionsLogistic_vv_14;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_15> AgradDistributionsLogistic_vv_15;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_16> AgradDistributionsLogistic_vv_16;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_17> AgradDistributionsLogistic_vv_17;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_18> AgradDistributionsLogistic_vv_18;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_19> AgradDistributionsLogistic_vv_19;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_20> AgradDistributionsLogistic_vv_20;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_21> AgradDistributionsLogistic_vv_21;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_22> AgradDistributionsLogistic_vv_22;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_23> AgradDistributionsLogistic_vv_23;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_24> AgradDistributionsLogistic_vv_24;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_25> AgradDistributionsLogistic_vv_25;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_26> AgradDistributionsLogistic_vv_26;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_27> AgradDistributionsLogistic_vv_27;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_28> AgradDistributionsLogistic_vv_28;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_29> AgradDistributionsLogistic_vv_29;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_30> AgradDistributionsLogistic_vv_30;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_31> AgradDistributionsLogistic_vv_31;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_32> AgradDistributionsLogistic_vv_32;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_33> AgradDistributionsLogistic_vv_33;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_34> AgradDistributionsLogistic_vv_34;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_35> AgradDistributionsLogistic_vv_35;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_36> AgradDistributionsLogistic_vv_36;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_37> AgradDistributionsLogistic_vv_37;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_38> AgradDistributionsLogistic_vv_38;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_39> AgradDistributionsLogistic_vv_39;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_40> AgradDistributionsLogistic_vv_40;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_41> AgradDistributionsLogistic_vv_41;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_42> AgradDistributionsLogistic_vv_42;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_43> AgradDistributionsLogistic_vv_43;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_44> AgradDistributionsLogistic_vv_44;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_45> AgradDistributionsLogistic_vv_45;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_46> AgradDistributionsLogistic_vv_46;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_47> AgradDistributionsLogistic_vv_47;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_48> AgradDistributionsLogistic_vv_48;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_49> AgradDistributionsLogistic_vv_49;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_50> AgradDistributionsLogistic_vv_50;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_51> AgradDistributionsLogistic_vv_51;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_52> AgradDistributionsLogistic_vv_52;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_53> AgradDistributionsLogistic_vv_53;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_54> AgradDistributionsLogistic_vv_54;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_55> AgradDistributionsLogistic_vv_55;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_56> AgradDistributionsLogistic_vv_56;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_57> AgradDistributionsLogistic_vv_57;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_58> AgradDistributionsLogistic_vv_58;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_59> AgradDistributionsLogistic_vv_59;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_60> AgradDistributionsLogistic_vv_60;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_61> AgradDistributionsLogistic_vv_61;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_62> AgradDistributionsLogistic_vv_62;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_63> AgradDistributionsLogistic_vv_63;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_64> AgradDistributionsLogistic_vv_64;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_65> AgradDistributionsLogistic_vv_65;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_66> AgradDistributionsLogistic_vv_66;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_67> AgradDistributionsLogistic_vv_67;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_68> AgradDistributionsLogistic_vv_68;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_69> AgradDistributionsLogistic_vv_69;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_70> AgradDistributionsLogistic_vv_70;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_71> AgradDistributionsLogistic_vv_71;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_72> AgradDistributionsLogistic_vv_72;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_73> AgradDistributionsLogistic_vv_73;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_74> AgradDistributionsLogistic_vv_74;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_75> AgradDistributionsLogistic_vv_75;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_76> AgradDistributionsLogistic_vv_76;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_77> AgradDistributionsLogistic_vv_77;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_78> AgradDistributionsLogistic_vv_78;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_79> AgradDistributionsLogistic_vv_79;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_80> AgradDistributionsLogistic_vv_80;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_81> AgradDistributionsLogistic_vv_81;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_82> AgradDistributionsLogistic_vv_82;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_83> AgradDistributionsLogistic_vv_83;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_84> AgradDistributionsLogistic_vv_84;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_85> AgradDistributionsLogistic_vv_85;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_86> AgradDistributionsLogistic_vv_86;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_87> AgradDistributionsLogistic_vv_87;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_88> AgradDistributionsLogistic_vv_88;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_89> AgradDistributionsLogistic_vv_89;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_90> AgradDistributionsLogistic_vv_90;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_91> AgradDistributionsLogistic_vv_91;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_92> AgradDistributionsLogistic_vv_92;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_93> AgradDistributionsLogistic_vv_93;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_94> AgradDistributionsLogistic_vv_94;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_95> AgradDistributionsLogistic_vv_95;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_96> AgradDistributionsLogistic_vv_96;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_97> AgradDistributionsLogistic_vv_97;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_98> AgradDistributionsLogistic_vv_98;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_99> AgradDistributionsLogistic_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_0, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_1, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_2, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_3, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_4, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_5, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_6, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_7, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_8, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_9, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_10, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_11, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_12, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_13, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_14, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_15, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_16, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_17, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_18, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_19, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_20, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_21, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_22, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_23, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_24, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_25, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_26, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_27, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_28, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_29, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_30, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_31, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_32, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_33, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_34, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_35, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_36, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_37, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_38, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_39, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_40, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_41, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_42, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_43, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_44, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_45, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_46, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_47, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_48, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_49, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_50, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_51, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_52, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_53, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_54, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_55, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_56, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_57, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_58, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_59, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_60, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_61, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_62, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_63, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_64, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_65, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_66, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_67, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_68, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_69, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_70, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_71, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_72, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_73, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_74, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_75, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_76, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_77, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_78, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_79, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_80, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_81, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_82, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_83, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_84, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_85, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_86, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_87, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_88, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_89, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_90, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_91, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_92, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_93, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_94, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_95, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_96, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_97, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_98, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_99, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_99);
+
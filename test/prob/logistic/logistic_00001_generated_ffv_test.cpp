@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_100> AgradDistributionsLogistic_ffv_100;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_101> AgradDistributionsLogistic_ffv_101;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_102> AgradDistributionsLogistic_ffv_102;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_103> AgradDistributionsLogistic_ffv_103;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_104> AgradDistributionsLogistic_ffv_104;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_105> AgradDistributionsLogistic_ffv_105;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_106> AgradDistributionsLogistic_ffv_106;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_107> AgradDistributionsLogistic_ffv_107;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_108> AgradDistributionsLogistic_ffv_108;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_109> AgradDistributionsLogistic_ffv_109;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_110> AgradDistributionsLogistic_ffv_110;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_111> AgradDistributionsLogistic_ffv_111;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_112> AgradDistributionsLogistic_ffv_112;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_113> AgradDistributionsLogistic_ffv_113;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_114> AgradDistributionsLogistic_ffv_114;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_115> AgradDistributionsLogistic_ffv_115;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_116> AgradDistributionsLogistic_ffv_116;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_117> AgradDistributionsLogistic_ffv_117;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_118> AgradDistributionsLogistic_ffv_118;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_119> AgradDistributionsLogistic_ffv_119;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_120> AgradDistributionsLogistic_ffv_120;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_121> AgradDistributionsLogistic_ffv_121;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_122> AgradDistributionsLogistic_ffv_122;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_123> AgradDistributionsLogistic_ffv_123;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_124> AgradDistributionsLogistic_ffv_124;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_125> AgradDistributionsLogistic_ffv_125;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_126> AgradDistributionsLogistic_ffv_126;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_127> AgradDistributionsLogistic_ffv_127;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_128> AgradDistributionsLogistic_ffv_128;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_129> AgradDistributionsLogistic_ffv_129;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_130> AgradDistributionsLogistic_ffv_130;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_131> AgradDistributionsLogistic_ffv_131;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_132> AgradDistributionsLogistic_ffv_132;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_133> AgradDistributionsLogistic_ffv_133;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_134> AgradDistributionsLogistic_ffv_134;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_135> AgradDistributionsLogistic_ffv_135;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_136> AgradDistributionsLogistic_ffv_136;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_137> AgradDistributionsLogistic_ffv_137;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_138> AgradDistributionsLogistic_ffv_138;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_139> AgradDistributionsLogistic_ffv_139;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_140> AgradDistributionsLogistic_ffv_140;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_141> AgradDistributionsLogistic_ffv_141;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_142> AgradDistributionsLogistic_ffv_142;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_143> AgradDistributionsLogistic_ffv_143;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_144> AgradDistributionsLogistic_ffv_144;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_145> AgradDistributionsLogistic_ffv_145;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_146> AgradDistributionsLogistic_ffv_146;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_147> AgradDistributionsLogistic_ffv_147;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_148> AgradDistributionsLogistic_ffv_148;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_149> AgradDistributionsLogistic_ffv_149;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_150> AgradDistributionsLogistic_ffv_150;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_151> AgradDistributionsLogistic_ffv_151;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_152> AgradDistributionsLogistic_ffv_152;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_153> AgradDistributionsLogistic_ffv_153;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_154> AgradDistributionsLogistic_ffv_154;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_155> AgradDistributionsLogistic_ffv_155;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_156> AgradDistributionsLogistic_ffv_156;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_157> AgradDistributionsLogistic_ffv_157;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_158> AgradDistributionsLogistic_ffv_158;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_159> AgradDistributionsLogistic_ffv_159;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_160> AgradDistributionsLogistic_ffv_160;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_161> AgradDistributionsLogistic_ffv_161;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_162> AgradDistributionsLogistic_ffv_162;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_163> AgradDistributionsLogistic_ffv_163;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_164> AgradDistributionsLogistic_ffv_164;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_165> AgradDistributionsLogistic_ffv_165;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_166> AgradDistributionsLogistic_ffv_166;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_167> AgradDistributionsLogistic_ffv_167;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_168> AgradDistributionsLogistic_ffv_168;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_169> AgradDistributionsLogistic_ffv_169;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_170> AgradDistributionsLogistic_ffv_170;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_171> AgradDistributionsLogistic_ffv_171;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_172> AgradDistributionsLogistic_ffv_172;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_173> AgradDistributionsLogistic_ffv_173;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_174> AgradDistributionsLogistic_ffv_174;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_175> AgradDistributionsLogistic_ffv_175;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_176> AgradDistributionsLogistic_ffv_176;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_177> AgradDistributionsLogistic_ffv_177;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_178> AgradDistributionsLogistic_ffv_178;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_179> AgradDistributionsLogistic_ffv_179;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_180> AgradDistributionsLogistic_ffv_180;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_181> AgradDistributionsLogistic_ffv_181;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_182> AgradDistributionsLogistic_ffv_182;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_183> AgradDistributionsLogistic_ffv_183;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_184> AgradDistributionsLogistic_ffv_184;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_185> AgradDistributionsLogistic_ffv_185;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_186> AgradDistributionsLogistic_ffv_186;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_187> AgradDistributionsLogistic_ffv_187;
+typedef std::tuple<AgradDistributionsLogistic, type_ffv_188> AgradDistributionsLogistic_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_100, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_101, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_102, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_103, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_104, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_105, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_106, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_107, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_108, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_109, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_110, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_111, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_112, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_113, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_114, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_115, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_116, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_117, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_118, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_119, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_120, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_121, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_122, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_123, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_124, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_125, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_126, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_127, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_128, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_129, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_130, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_131, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_132, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_133, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_134, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_135, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_136, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_137, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_138, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_139, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_140, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_141, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_142, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_143, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_144, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_145, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_146, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_147, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_148, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_149, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_150, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_151, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_152, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_153, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_154, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_155, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_156, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_157, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_158, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_159, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_160, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_161, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_162, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_163, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_164, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_165, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_166, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_167, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_168, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_169, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_170, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_171, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_172, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_173, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_174, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_175, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_176, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_177, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_178, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_179, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_180, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_181, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_182, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_183, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_184, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_185, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_186, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_187, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_ffv_188, AgradDistributionTestFixture, AgradDistributionsLogistic_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsLogistic, type_v_100> AgradDistributionsLogistic_v_100;
+typedef std::tuple<AgradDistributionsLogistic, type_v_101> AgradDistributionsLogistic_v_101;
+typedef std::tuple<AgradDistributionsLogistic, type_v_102> AgradDistributionsLogistic_v_102;
+typedef std::tuple<AgradDistributionsLogistic, type_v_103> AgradDistributionsLogistic_v_103;
+typedef std::tuple<AgradDistributionsLogistic, type_v_104> AgradDistributionsLogistic_v_104;
+typedef std::tuple<AgradDistributionsLogistic, type_v_105> AgradDistributionsLogistic_v_105;
+typedef std::tuple<AgradDistributionsLogistic, type_v_106> AgradDistributionsLogistic_v_106;
+typedef std::tuple<AgradDistributionsLogistic, type_v_107> AgradDistributionsLogistic_v_107;
+typedef std::tuple<AgradDistributionsLogistic, type_v_108> AgradDistributionsLogistic_v_108;
+typedef std::tuple<AgradDistributionsLogistic, type_v_109> AgradDistributionsLogistic_v_109;
+typedef std::tuple<AgradDistributionsLogistic, type_v_110> AgradDistributionsLogistic_v_110;
+typedef std::tuple<AgradDistributionsLogistic, type_v_111> AgradDistributionsLogistic_v_111;
+typedef std::tuple<AgradDistributionsLogistic, type_v_112> AgradDistributionsLogistic_v_112;
+typedef std::tuple<AgradDistributionsLogistic, type_v_113> AgradDistributionsLogistic_v_113;
+typedef std::tuple<AgradDistributionsLogistic, type_v_114> AgradDistributionsLogistic_v_114;
+typedef std::tuple<AgradDistributionsLogistic, type_v_115> AgradDistributionsLogistic_v_115;
+typedef std::tuple<AgradDistributionsLogistic, type_v_116> AgradDistributionsLogistic_v_116;
+typedef std::tuple<AgradDistributionsLogistic, type_v_117> AgradDistributionsLogistic_v_117;
+typedef std::tuple<AgradDistributionsLogistic, type_v_118> AgradDistributionsLogistic_v_118;
+typedef std::tuple<AgradDistributionsLogistic, type_v_119> AgradDistributionsLogistic_v_119;
+typedef std::tuple<AgradDistributionsLogistic, type_v_120> AgradDistributionsLogistic_v_120;
+typedef std::tuple<AgradDistributionsLogistic, type_v_121> AgradDistributionsLogistic_v_121;
+typedef std::tuple<AgradDistributionsLogistic, type_v_122> AgradDistributionsLogistic_v_122;
+typedef std::tuple<AgradDistributionsLogistic, type_v_123> AgradDistributionsLogistic_v_123;
+typedef std::tuple<AgradDistributionsLogistic, type_v_124> AgradDistributionsLogistic_v_124;
+typedef std::tuple<AgradDistributionsLogistic, type_v_125> AgradDistributionsLogistic_v_125;
+typedef std::tuple<AgradDistributionsLogistic, type_v_126> AgradDistributionsLogistic_v_126;
+typedef std::tuple<AgradDistributionsLogistic, type_v_127> AgradDistributionsLogistic_v_127;
+typedef std::tuple<AgradDistributionsLogistic, type_v_128> AgradDistributionsLogistic_v_128;
+typedef std::tuple<AgradDistributionsLogistic, type_v_129> AgradDistributionsLogistic_v_129;
+typedef std::tuple<AgradDistributionsLogistic, type_v_130> AgradDistributionsLogistic_v_130;
+typedef std::tuple<AgradDistributionsLogistic, type_v_131> AgradDistributionsLogistic_v_131;
+typedef std::tuple<AgradDistributionsLogistic, type_v_132> AgradDistributionsLogistic_v_132;
+typedef std::tuple<AgradDistributionsLogistic, type_v_133> AgradDistributionsLogistic_v_133;
+typedef std::tuple<AgradDistributionsLogistic, type_v_134> AgradDistributionsLogistic_v_134;
+typedef std::tuple<AgradDistributionsLogistic, type_v_135> AgradDistributionsLogistic_v_135;
+typedef std::tuple<AgradDistributionsLogistic, type_v_136> AgradDistributionsLogistic_v_136;
+typedef std::tuple<AgradDistributionsLogistic, type_v_137> AgradDistributionsLogistic_v_137;
+typedef std::tuple<AgradDistributionsLogistic, type_v_138> AgradDistributionsLogistic_v_138;
+typedef std::tuple<AgradDistributionsLogistic, type_v_139> AgradDistributionsLogistic_v_139;
+typedef std::tuple<AgradDistributionsLogistic, type_v_140> AgradDistributionsLogistic_v_140;
+typedef std::tuple<AgradDistributionsLogistic, type_v_141> AgradDistributionsLogistic_v_141;
+typedef std::tuple<AgradDistributionsLogistic, type_v_142> AgradDistributionsLogistic_v_142;
+typedef std::tuple<AgradDistributionsLogistic, type_v_143> AgradDistributionsLogistic_v_143;
+typedef std::tuple<AgradDistributionsLogistic, type_v_144> AgradDistributionsLogistic_v_144;
+typedef std::tuple<AgradDistributionsLogistic, type_v_145> AgradDistributionsLogistic_v_145;
+typedef std::tuple<AgradDistributionsLogistic, type_v_146> AgradDistributionsLogistic_v_146;
+typedef std::tuple<AgradDistributionsLogistic, type_v_147> AgradDistributionsLogistic_v_147;
+typedef std::tuple<AgradDistributionsLogistic, type_v_148> AgradDistributionsLogistic_v_148;
+typedef std::tuple<AgradDistributionsLogistic, type_v_149> AgradDistributionsLogistic_v_149;
+typedef std::tuple<AgradDistributionsLogistic, type_v_150> AgradDistributionsLogistic_v_150;
+typedef std::tuple<AgradDistributionsLogistic, type_v_151> AgradDistributionsLogistic_v_151;
+typedef std::tuple<AgradDistributionsLogistic, type_v_152> AgradDistributionsLogistic_v_152;
+typedef std::tuple<AgradDistributionsLogistic, type_v_153> AgradDistributionsLogistic_v_153;
+typedef std::tuple<AgradDistributionsLogistic, type_v_154> AgradDistributionsLogistic_v_154;
+typedef std::tuple<AgradDistributionsLogistic, type_v_155> AgradDistributionsLogistic_v_155;
+typedef std::tuple<AgradDistributionsLogistic, type_v_156> AgradDistributionsLogistic_v_156;
+typedef std::tuple<AgradDistributionsLogistic, type_v_157> AgradDistributionsLogistic_v_157;
+typedef std::tuple<AgradDistributionsLogistic, type_v_158> AgradDistributionsLogistic_v_158;
+typedef std::tuple<AgradDistributionsLogistic, type_v_159> AgradDistributionsLogistic_v_159;
+typedef std::tuple<AgradDistributionsLogistic, type_v_160> AgradDistributionsLogistic_v_160;
+typedef std::tuple<AgradDistributionsLogistic, type_v_161> AgradDistributionsLogistic_v_161;
+typedef std::tuple<AgradDistributionsLogistic, type_v_162> AgradDistributionsLogistic_v_162;
+typedef std::tuple<AgradDistributionsLogistic, type_v_163> AgradDistributionsLogistic_v_163;
+typedef std::tuple<AgradDistributionsLogistic, type_v_164> AgradDistributionsLogistic_v_164;
+typedef std::tuple<AgradDistributionsLogistic, type_v_165> AgradDistributionsLogistic_v_165;
+typedef std::tuple<AgradDistributionsLogistic, type_v_166> AgradDistributionsLogistic_v_166;
+typedef std::tuple<AgradDistributionsLogistic, type_v_167> AgradDistributionsLogistic_v_167;
+typedef std::tuple<AgradDistributionsLogistic, type_v_168> AgradDistributionsLogistic_v_168;
+typedef std::tuple<AgradDistributionsLogistic, type_v_169> AgradDistributionsLogistic_v_169;
+typedef std::tuple<AgradDistributionsLogistic, type_v_170> AgradDistributionsLogistic_v_170;
+typedef std::tuple<AgradDistributionsLogistic, type_v_171> AgradDistributionsLogistic_v_171;
+typedef std::tuple<AgradDistributionsLogistic, type_v_172> AgradDistributionsLogistic_v_172;
+typedef std::tuple<AgradDistributionsLogistic, type_v_173> AgradDistributionsLogistic_v_173;
+typedef std::tuple<AgradDistributionsLogistic, type_v_174> AgradDistributionsLogistic_v_174;
+typedef std::tuple<AgradDistributionsLogistic, type_v_175> AgradDistributionsLogistic_v_175;
+typedef std::tuple<AgradDistributionsLogistic, type_v_176> AgradDistributionsLogistic_v_176;
+typedef std::tuple<AgradDistributionsLogistic, type_v_177> AgradDistributionsLogistic_v_177;
+typedef std::tuple<AgradDistributionsLogistic, type_v_178> AgradDistributionsLogistic_v_178;
+typedef std::tuple<AgradDistributionsLogistic, type_v_179> AgradDistributionsLogistic_v_179;
+typedef std::tuple<AgradDistributionsLogistic, type_v_180> AgradDistributionsLogistic_v_180;
+typedef std::tuple<AgradDistributionsLogistic, type_v_181> AgradDistributionsLogistic_v_181;
+typedef std::tuple<AgradDistributionsLogistic, type_v_182> AgradDistributionsLogistic_v_182;
+typedef std::tuple<AgradDistributionsLogistic, type_v_183> AgradDistributionsLogistic_v_183;
+typedef std::tuple<AgradDistributionsLogistic, type_v_184> AgradDistributionsLogistic_v_184;
+typedef std::tuple<AgradDistributionsLogistic, type_v_185> AgradDistributionsLogistic_v_185;
+typedef std::tuple<AgradDistributionsLogistic, type_v_186> AgradDistributionsLogistic_v_186;
+typedef std::tuple<AgradDistributionsLogistic, type_v_187> AgradDistributionsLogistic_v_187;
+typedef std::tuple<AgradDistributionsLogistic, type_v_188> AgradDistributionsLogistic_v_188;
+typedef std::tuple<AgradDistributionsLogistic, type_v_189> AgradDistributionsLogistic_v_189;
+typedef std::tuple<AgradDistributionsLogistic, type_v_190> AgradDistributionsLogistic_v_190;
+typedef std::tuple<AgradDistributionsLogistic, type_v_191> AgradDistributionsLogistic_v_191;
+typedef std::tuple<AgradDistributionsLogistic, type_v_192> AgradDistributionsLogistic_v_192;
+typedef std::tuple<AgradDistributionsLogistic, type_v_193> AgradDistributionsLogistic_v_193;
+typedef std::tuple<AgradDistributionsLogistic, type_v_194> AgradDistributionsLogistic_v_194;
+typedef std::tuple<AgradDistributionsLogistic, type_v_195> AgradDistributionsLogistic_v_195;
+typedef std::tuple<AgradDistributionsLogistic, type_v_196> AgradDistributionsLogistic_v_196;
+typedef std::tuple<AgradDistributionsLogistic, type_v_197> AgradDistributionsLogistic_v_197;
+typedef std::tuple<AgradDistributionsLogistic, type_v_198> AgradDistributionsLogistic_v_198;
+typedef std::tuple<AgradDistributionsLogistic, type_v_199> AgradDistributionsLogistic_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_100, AgradDistributionTestFixture, AgradDistributionsLogistic_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_101, AgradDistributionTestFixture, AgradDistributionsLogistic_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_102, AgradDistributionTestFixture, AgradDistributionsLogistic_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_103, AgradDistributionTestFixture, AgradDistributionsLogistic_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_104, AgradDistributionTestFixture, AgradDistributionsLogistic_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_105, AgradDistributionTestFixture, AgradDistributionsLogistic_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_106, AgradDistributionTestFixture, AgradDistributionsLogistic_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_107, AgradDistributionTestFixture, AgradDistributionsLogistic_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_108, AgradDistributionTestFixture, AgradDistributionsLogistic_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_109, AgradDistributionTestFixture, AgradDistributionsLogistic_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_110, AgradDistributionTestFixture, AgradDistributionsLogistic_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_111, AgradDistributionTestFixture, AgradDistributionsLogistic_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_112, AgradDistributionTestFixture, AgradDistributionsLogistic_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_113, AgradDistributionTestFixture, AgradDistributionsLogistic_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_114, AgradDistributionTestFixture, AgradDistributionsLogistic_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_115, AgradDistributionTestFixture, AgradDistributionsLogistic_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_116, AgradDistributionTestFixture, AgradDistributionsLogistic_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_117, AgradDistributionTestFixture, AgradDistributionsLogistic_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_118, AgradDistributionTestFixture, AgradDistributionsLogistic_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_119, AgradDistributionTestFixture, AgradDistributionsLogistic_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_120, AgradDistributionTestFixture, AgradDistributionsLogistic_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_121, AgradDistributionTestFixture, AgradDistributionsLogistic_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_122, AgradDistributionTestFixture, AgradDistributionsLogistic_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_123, AgradDistributionTestFixture, AgradDistributionsLogistic_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_124, AgradDistributionTestFixture, AgradDistributionsLogistic_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_125, AgradDistributionTestFixture, AgradDistributionsLogistic_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_126, AgradDistributionTestFixture, AgradDistributionsLogistic_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_127, AgradDistributionTestFixture, AgradDistributionsLogistic_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_128, AgradDistributionTestFixture, AgradDistributionsLogistic_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_129, AgradDistributionTestFixture, AgradDistributionsLogistic_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_130, AgradDistributionTestFixture, AgradDistributionsLogistic_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_131, AgradDistributionTestFixture, AgradDistributionsLogistic_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_132, AgradDistributionTestFixture, AgradDistributionsLogistic_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_133, AgradDistributionTestFixture, AgradDistributionsLogistic_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_134, AgradDistributionTestFixture, AgradDistributionsLogistic_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_135, AgradDistributionTestFixture, AgradDistributionsLogistic_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_136, AgradDistributionTestFixture, AgradDistributionsLogistic_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_137, AgradDistributionTestFixture, AgradDistributionsLogistic_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_138, AgradDistributionTestFixture, AgradDistributionsLogistic_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_139, AgradDistributionTestFixture, AgradDistributionsLogistic_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_140, AgradDistributionTestFixture, AgradDistributionsLogistic_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_141, AgradDistributionTestFixture, AgradDistributionsLogistic_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_142, AgradDistributionTestFixture, AgradDistributionsLogistic_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_143, AgradDistributionTestFixture, AgradDistributionsLogistic_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_144, AgradDistributionTestFixture, AgradDistributionsLogistic_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_145, AgradDistributionTestFixture, AgradDistributionsLogistic_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_146, AgradDistributionTestFixture, AgradDistributionsLogistic_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_147, AgradDistributionTestFixture, AgradDistributionsLogistic_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_148, AgradDistributionTestFixture, AgradDistributionsLogistic_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_149, AgradDistributionTestFixture, AgradDistributionsLogistic_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_150, AgradDistributionTestFixture, AgradDistributionsLogistic_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_151, AgradDistributionTestFixture, AgradDistributionsLogistic_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_152, AgradDistributionTestFixture, AgradDistributionsLogistic_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_153, AgradDistributionTestFixture, AgradDistributionsLogistic_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_154, AgradDistributionTestFixture, AgradDistributionsLogistic_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_155, AgradDistributionTestFixture, AgradDistributionsLogistic_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_156, AgradDistributionTestFixture, AgradDistributionsLogistic_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_157, AgradDistributionTestFixture, AgradDistributionsLogistic_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_158, AgradDistributionTestFixture, AgradDistributionsLogistic_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_159, AgradDistributionTestFixture, AgradDistributionsLogistic_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_160, AgradDistributionTestFixture, AgradDistributionsLogistic_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_161, AgradDistributionTestFixture, AgradDistributionsLogistic_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_162, AgradDistributionTestFixture, AgradDistributionsLogistic_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_163, AgradDistributionTestFixture, AgradDistributionsLogistic_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_164, AgradDistributionTestFixture, AgradDistributionsLogistic_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_165, AgradDistributionTestFixture, AgradDistributionsLogistic_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_166, AgradDistributionTestFixture, AgradDistributionsLogistic_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_167, AgradDistributionTestFixture, AgradDistributionsLogistic_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_168, AgradDistributionTestFixture, AgradDistributionsLogistic_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_169, AgradDistributionTestFixture, AgradDistributionsLogistic_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_170, AgradDistributionTestFixture, AgradDistributionsLogistic_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_171, AgradDistributionTestFixture, AgradDistributionsLogistic_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_172, AgradDistributionTestFixture, AgradDistributionsLogistic_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_173, AgradDistributionTestFixture, AgradDistributionsLogistic_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_174, AgradDistributionTestFixture, AgradDistributionsLogistic_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_175, AgradDistributionTestFixture, AgradDistributionsLogistic_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_176, AgradDistributionTestFixture, AgradDistributionsLogistic_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_177, AgradDistributionTestFixture, AgradDistributionsLogistic_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_178, AgradDistributionTestFixture, AgradDistributionsLogistic_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_179, AgradDistributionTestFixture, AgradDistributionsLogistic_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_180, AgradDistributionTestFixture, AgradDistributionsLogistic_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_181, AgradDistributionTestFixture, AgradDistributionsLogistic_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_182, AgradDistributionTestFixture, AgradDistributionsLogistic_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_183, AgradDistributionTestFixture, AgradDistributionsLogistic_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_184, AgradDistributionTestFixture, AgradDistributionsLogistic_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_185, AgradDistributionTestFixture, AgradDistributionsLogistic_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_186, AgradDistributionTestFixture, AgradDistributionsLogistic_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_187, AgradDistributionTestFixture, AgradDistributionsLogistic_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_188, AgradDistributionTestFixture, AgradDistributionsLogistic_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_189, AgradDistributionTestFixture, AgradDistributionsLogistic_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_190, AgradDistributionTestFixture, AgradDistributionsLogistic_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_191, AgradDistributionTestFixture, AgradDistributionsLogistic_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_192, AgradDistributionTestFixture, AgradDistributionsLogistic_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_193, AgradDistributionTestFixture, AgradDistributionsLogistic_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_194, AgradDistributionTestFixture, AgradDistributionsLogistic_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_195, AgradDistributionTestFixture, AgradDistributionsLogistic_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_196, AgradDistributionTestFixture, AgradDistributionsLogistic_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_197, AgradDistributionTestFixture, AgradDistributionsLogistic_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_198, AgradDistributionTestFixture, AgradDistributionsLogistic_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_199, AgradDistributionTestFixture, AgradDistributionsLogistic_v_199);
+
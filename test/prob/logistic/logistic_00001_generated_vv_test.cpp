@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionsLogistic, type_vv_100> AgradDistributionsLogistic_vv_100;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_101> AgradDistributionsLogistic_vv_101;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_102> AgradDistributionsLogistic_vv_102;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_103> AgradDistributionsLogistic_vv_103;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_104> AgradDistributionsLogistic_vv_104;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_105> AgradDistributionsLogistic_vv_105;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_106> AgradDistributionsLogistic_vv_106;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_107> AgradDistributionsLogistic_vv_107;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_108> AgradDistributionsLogistic_vv_108;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_109> AgradDistributionsLogistic_vv_109;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_110> AgradDistributionsLogistic_vv_110;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_111> AgradDistributionsLogistic_vv_111;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_112> AgradDistributionsLogistic_vv_112;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_113> AgradDistributionsLogistic_vv_113;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_114> AgradDistributionsLogistic_vv_114;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_115> AgradDistributionsLogistic_vv_115;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_116> AgradDistributionsLogistic_vv_116;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_117> AgradDistributionsLogistic_vv_117;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_118> AgradDistributionsLogistic_vv_118;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_119> AgradDistributionsLogistic_vv_119;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_120> AgradDistributionsLogistic_vv_120;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_121> AgradDistributionsLogistic_vv_121;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_122> AgradDistributionsLogistic_vv_122;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_123> AgradDistributionsLogistic_vv_123;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_124> AgradDistributionsLogistic_vv_124;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_125> AgradDistributionsLogistic_vv_125;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_126> AgradDistributionsLogistic_vv_126;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_127> AgradDistributionsLogistic_vv_127;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_128> AgradDistributionsLogistic_vv_128;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_129> AgradDistributionsLogistic_vv_129;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_130> AgradDistributionsLogistic_vv_130;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_131> AgradDistributionsLogistic_vv_131;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_132> AgradDistributionsLogistic_vv_132;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_133> AgradDistributionsLogistic_vv_133;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_134> AgradDistributionsLogistic_vv_134;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_135> AgradDistributionsLogistic_vv_135;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_136> AgradDistributionsLogistic_vv_136;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_137> AgradDistributionsLogistic_vv_137;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_138> AgradDistributionsLogistic_vv_138;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_139> AgradDistributionsLogistic_vv_139;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_140> AgradDistributionsLogistic_vv_140;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_141> AgradDistributionsLogistic_vv_141;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_142> AgradDistributionsLogistic_vv_142;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_143> AgradDistributionsLogistic_vv_143;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_144> AgradDistributionsLogistic_vv_144;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_145> AgradDistributionsLogistic_vv_145;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_146> AgradDistributionsLogistic_vv_146;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_147> AgradDistributionsLogistic_vv_147;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_148> AgradDistributionsLogistic_vv_148;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_149> AgradDistributionsLogistic_vv_149;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_150> AgradDistributionsLogistic_vv_150;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_151> AgradDistributionsLogistic_vv_151;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_152> AgradDistributionsLogistic_vv_152;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_153> AgradDistributionsLogistic_vv_153;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_154> AgradDistributionsLogistic_vv_154;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_155> AgradDistributionsLogistic_vv_155;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_156> AgradDistributionsLogistic_vv_156;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_157> AgradDistributionsLogistic_vv_157;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_158> AgradDistributionsLogistic_vv_158;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_159> AgradDistributionsLogistic_vv_159;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_160> AgradDistributionsLogistic_vv_160;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_161> AgradDistributionsLogistic_vv_161;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_162> AgradDistributionsLogistic_vv_162;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_163> AgradDistributionsLogistic_vv_163;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_164> AgradDistributionsLogistic_vv_164;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_165> AgradDistributionsLogistic_vv_165;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_166> AgradDistributionsLogistic_vv_166;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_167> AgradDistributionsLogistic_vv_167;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_168> AgradDistributionsLogistic_vv_168;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_169> AgradDistributionsLogistic_vv_169;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_170> AgradDistributionsLogistic_vv_170;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_171> AgradDistributionsLogistic_vv_171;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_172> AgradDistributionsLogistic_vv_172;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_173> AgradDistributionsLogistic_vv_173;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_174> AgradDistributionsLogistic_vv_174;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_175> AgradDistributionsLogistic_vv_175;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_176> AgradDistributionsLogistic_vv_176;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_177> AgradDistributionsLogistic_vv_177;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_178> AgradDistributionsLogistic_vv_178;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_179> AgradDistributionsLogistic_vv_179;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_180> AgradDistributionsLogistic_vv_180;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_181> AgradDistributionsLogistic_vv_181;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_182> AgradDistributionsLogistic_vv_182;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_183> AgradDistributionsLogistic_vv_183;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_184> AgradDistributionsLogistic_vv_184;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_185> AgradDistributionsLogistic_vv_185;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_186> AgradDistributionsLogistic_vv_186;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_187> AgradDistributionsLogistic_vv_187;
+typedef std::tuple<AgradDistributionsLogistic, type_vv_188> AgradDistributionsLogistic_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_100, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_101, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_102, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_103, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_104, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_105, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_106, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_107, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_108, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_109, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_110, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_111, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_112, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_113, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_114, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_115, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_116, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_117, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_118, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_119, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_120, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_121, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_122, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_123, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_124, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_125, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_126, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_127, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_128, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_129, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_130, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_131, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_132, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_133, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_134, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_135, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_136, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_137, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_138, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_139, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_140, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_141, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_142, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_143, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_144, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_145, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_146, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_147, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_148, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_149, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_150, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_151, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_152, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_153, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_154, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_155, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_156, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_157, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_158, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_159, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_160, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_161, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_162, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_163, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_164, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_165, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_166, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_167, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_168, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_169, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_170, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_171, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_172, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_173, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_174, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_175, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_176, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_177, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_178, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_179, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_180, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_181, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_182, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_183, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_184, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_185, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_186, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_187, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_vv_188, AgradDistributionTestFixture, AgradDistributionsLogistic_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradDistributionsLogistic, type_v_200> AgradDistributionsLogistic_v_200;
+typedef std::tuple<AgradDistributionsLogistic, type_v_201> AgradDistributionsLogistic_v_201;
+typedef std::tuple<AgradDistributionsLogistic, type_v_202> AgradDistributionsLogistic_v_202;
+typedef std::tuple<AgradDistributionsLogistic, type_v_203> AgradDistributionsLogistic_v_203;
+typedef std::tuple<AgradDistributionsLogistic, type_v_204> AgradDistributionsLogistic_v_204;
+typedef std::tuple<AgradDistributionsLogistic, type_v_205> AgradDistributionsLogistic_v_205;
+typedef std::tuple<AgradDistributionsLogistic, type_v_206> AgradDistributionsLogistic_v_206;
+typedef std::tuple<AgradDistributionsLogistic, type_v_207> AgradDistributionsLogistic_v_207;
+typedef std::tuple<AgradDistributionsLogistic, type_v_208> AgradDistributionsLogistic_v_208;
+typedef std::tuple<AgradDistributionsLogistic, type_v_209> AgradDistributionsLogistic_v_209;
+typedef std::tuple<AgradDistributionsLogistic, type_v_210> AgradDistributionsLogistic_v_210;
+typedef std::tuple<AgradDistributionsLogistic, type_v_211> AgradDistributionsLogistic_v_211;
+typedef std::tuple<AgradDistributionsLogistic, type_v_212> AgradDistributionsLogistic_v_212;
+typedef std::tuple<AgradDistributionsLogistic, type_v_213> AgradDistributionsLogistic_v_213;
+typedef std::tuple<AgradDistributionsLogistic, type_v_214> AgradDistributionsLogistic_v_214;
+typedef std::tuple<AgradDistributionsLogistic, type_v_215> AgradDistributionsLogistic_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_200, AgradDistributionTestFixture, AgradDistributionsLogistic_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_201, AgradDistributionTestFixture, AgradDistributionsLogistic_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_202, AgradDistributionTestFixture, AgradDistributionsLogistic_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_203, AgradDistributionTestFixture, AgradDistributionsLogistic_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_204, AgradDistributionTestFixture, AgradDistributionsLogistic_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_205, AgradDistributionTestFixture, AgradDistributionsLogistic_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_206, AgradDistributionTestFixture, AgradDistributionsLogistic_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_207, AgradDistributionTestFixture, AgradDistributionsLogistic_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_208, AgradDistributionTestFixture, AgradDistributionsLogistic_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_209, AgradDistributionTestFixture, AgradDistributionsLogistic_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_210, AgradDistributionTestFixture, AgradDistributionsLogistic_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_211, AgradDistributionTestFixture, AgradDistributionsLogistic_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_212, AgradDistributionTestFixture, AgradDistributionsLogistic_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_213, AgradDistributionTestFixture, AgradDistributionsLogistic_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_214, AgradDistributionTestFixture, AgradDistributionsLogistic_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLogistic_v_215, AgradDistributionTestFixture, AgradDistributionsLogistic_v_215);
+
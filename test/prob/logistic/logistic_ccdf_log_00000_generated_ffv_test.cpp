@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_0> AgradCcdfLogLogistic_ffv_0;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_1> AgradCcdfLogLogistic_ffv_1;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_2> AgradCcdfLogLogistic_ffv_2;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_3> AgradCcdfLogLogistic_ffv_3;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_4> AgradCcdfLogLogistic_ffv_4;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_5> AgradCcdfLogLogistic_ffv_5;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_6> AgradCcdfLogLogistic_ffv_6;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_7> AgradCcdfLogLogistic_ffv_7;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_8> AgradCcdfLogLogistic_ffv_8;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_9> AgradCcdfLogLogistic_ffv_9;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_10> AgradCcdfLogLogistic_ffv_10;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_11> AgradCcdfLogLogistic_ffv_11;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_12> AgradCcdfLogLogistic_ffv_12;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_13> AgradCcdfLogLogistic_ffv_13;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_14> AgradCcdfLogLogistic_ffv_14;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_15> AgradCcdfLogLogistic_ffv_15;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_16> AgradCcdfLogLogistic_ffv_16;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_17> AgradCcdfLogLogistic_ffv_17;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_18> AgradCcdfLogLogistic_ffv_18;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_19> AgradCcdfLogLogistic_ffv_19;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_20> AgradCcdfLogLogistic_ffv_20;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_21> AgradCcdfLogLogistic_ffv_21;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_22> AgradCcdfLogLogistic_ffv_22;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_23> AgradCcdfLogLogistic_ffv_23;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_24> AgradCcdfLogLogistic_ffv_24;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_25> AgradCcdfLogLogistic_ffv_25;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_26> AgradCcdfLogLogistic_ffv_26;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_27> AgradCcdfLogLogistic_ffv_27;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_28> AgradCcdfLogLogistic_ffv_28;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_29> AgradCcdfLogLogistic_ffv_29;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_30> AgradCcdfLogLogistic_ffv_30;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_31> AgradCcdfLogLogistic_ffv_31;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_32> AgradCcdfLogLogistic_ffv_32;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_33> AgradCcdfLogLogistic_ffv_33;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_34> AgradCcdfLogLogistic_ffv_34;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_35> AgradCcdfLogLogistic_ffv_35;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_36> AgradCcdfLogLogistic_ffv_36;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_37> AgradCcdfLogLogistic_ffv_37;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_38> AgradCcdfLogLogistic_ffv_38;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_39> AgradCcdfLogLogistic_ffv_39;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_40> AgradCcdfLogLogistic_ffv_40;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_41> AgradCcdfLogLogistic_ffv_41;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_42> AgradCcdfLogLogistic_ffv_42;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_43> AgradCcdfLogLogistic_ffv_43;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_44> AgradCcdfLogLogistic_ffv_44;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_45> AgradCcdfLogLogistic_ffv_45;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_46> AgradCcdfLogLogistic_ffv_46;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_47> AgradCcdfLogLogistic_ffv_47;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_48> AgradCcdfLogLogistic_ffv_48;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_49> AgradCcdfLogLogistic_ffv_49;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_50> AgradCcdfLogLogistic_ffv_50;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_51> AgradCcdfLogLogistic_ffv_51;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_52> AgradCcdfLogLogistic_ffv_52;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_53> AgradCcdfLogLogistic_ffv_53;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_54> AgradCcdfLogLogistic_ffv_54;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_55> AgradCcdfLogLogistic_ffv_55;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_56> AgradCcdfLogLogistic_ffv_56;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_57> AgradCcdfLogLogistic_ffv_57;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_58> AgradCcdfLogLogistic_ffv_58;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_59> AgradCcdfLogLogistic_ffv_59;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_60> AgradCcdfLogLogistic_ffv_60;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_61> AgradCcdfLogLogistic_ffv_61;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_62> AgradCcdfLogLogistic_ffv_62;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_63> AgradCcdfLogLogistic_ffv_63;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_64> AgradCcdfLogLogistic_ffv_64;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_65> AgradCcdfLogLogistic_ffv_65;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_66> AgradCcdfLogLogistic_ffv_66;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_67> AgradCcdfLogLogistic_ffv_67;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_68> AgradCcdfLogLogistic_ffv_68;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_69> AgradCcdfLogLogistic_ffv_69;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_70> AgradCcdfLogLogistic_ffv_70;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_71> AgradCcdfLogLogistic_ffv_71;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_72> AgradCcdfLogLogistic_ffv_72;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_73> AgradCcdfLogLogistic_ffv_73;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_74> AgradCcdfLogLogistic_ffv_74;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_75> AgradCcdfLogLogistic_ffv_75;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_76> AgradCcdfLogLogistic_ffv_76;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_77> AgradCcdfLogLogistic_ffv_77;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_78> AgradCcdfLogLogistic_ffv_78;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_79> AgradCcdfLogLogistic_ffv_79;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_80> AgradCcdfLogLogistic_ffv_80;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_81> AgradCcdfLogLogistic_ffv_81;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_82> AgradCcdfLogLogistic_ffv_82;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_83> AgradCcdfLogLogistic_ffv_83;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_84> AgradCcdfLogLogistic_ffv_84;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_85> AgradCcdfLogLogistic_ffv_85;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_86> AgradCcdfLogLogistic_ffv_86;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_87> AgradCcdfLogLogistic_ffv_87;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_88> AgradCcdfLogLogistic_ffv_88;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_89> AgradCcdfLogLogistic_ffv_89;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_90> AgradCcdfLogLogistic_ffv_90;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_91> AgradCcdfLogLogistic_ffv_91;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_92> AgradCcdfLogLogistic_ffv_92;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_93> AgradCcdfLogLogistic_ffv_93;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_94> AgradCcdfLogLogistic_ffv_94;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_95> AgradCcdfLogLogistic_ffv_95;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_96> AgradCcdfLogLogistic_ffv_96;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_97> AgradCcdfLogLogistic_ffv_97;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_98> AgradCcdfLogLogistic_ffv_98;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_99> AgradCcdfLogLogistic_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_99);
+
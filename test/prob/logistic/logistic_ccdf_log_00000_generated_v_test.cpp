@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogLogistic, type_v_0> AgradCcdfLogLogistic_v_0;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_1> AgradCcdfLogLogistic_v_1;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_2> AgradCcdfLogLogistic_v_2;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_3> AgradCcdfLogLogistic_v_3;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_4> AgradCcdfLogLogistic_v_4;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_5> AgradCcdfLogLogistic_v_5;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_6> AgradCcdfLogLogistic_v_6;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_7> AgradCcdfLogLogistic_v_7;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_8> AgradCcdfLogLogistic_v_8;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_9> AgradCcdfLogLogistic_v_9;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_10> AgradCcdfLogLogistic_v_10;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_11> AgradCcdfLogLogistic_v_11;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_12> AgradCcdfLogLogistic_v_12;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_13> AgradCcdfLogLogistic_v_13;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_14> AgradCcdfLogLogistic_v_14;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_15> AgradCcdfLogLogistic_v_15;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_16> AgradCcdfLogLogistic_v_16;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_17> AgradCcdfLogLogistic_v_17;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_18> AgradCcdfLogLogistic_v_18;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_19> AgradCcdfLogLogistic_v_19;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_20> AgradCcdfLogLogistic_v_20;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_21> AgradCcdfLogLogistic_v_21;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_22> AgradCcdfLogLogistic_v_22;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_23> AgradCcdfLogLogistic_v_23;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_24> AgradCcdfLogLogistic_v_24;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_25> AgradCcdfLogLogistic_v_25;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_26> AgradCcdfLogLogistic_v_26;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_27> AgradCcdfLogLogistic_v_27;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_28> AgradCcdfLogLogistic_v_28;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_29> AgradCcdfLogLogistic_v_29;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_30> AgradCcdfLogLogistic_v_30;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_31> AgradCcdfLogLogistic_v_31;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_32> AgradCcdfLogLogistic_v_32;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_33> AgradCcdfLogLogistic_v_33;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_34> AgradCcdfLogLogistic_v_34;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_35> AgradCcdfLogLogistic_v_35;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_36> AgradCcdfLogLogistic_v_36;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_37> AgradCcdfLogLogistic_v_37;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_38> AgradCcdfLogLogistic_v_38;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_39> AgradCcdfLogLogistic_v_39;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_40> AgradCcdfLogLogistic_v_40;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_41> AgradCcdfLogLogistic_v_41;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_42> AgradCcdfLogLogistic_v_42;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_43> AgradCcdfLogLogistic_v_43;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_44> AgradCcdfLogLogistic_v_44;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_45> AgradCcdfLogLogistic_v_45;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_46> AgradCcdfLogLogistic_v_46;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_47> AgradCcdfLogLogistic_v_47;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_48> AgradCcdfLogLogistic_v_48;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_49> AgradCcdfLogLogistic_v_49;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_50> AgradCcdfLogLogistic_v_50;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_51> AgradCcdfLogLogistic_v_51;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_52> AgradCcdfLogLogistic_v_52;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_53> AgradCcdfLogLogistic_v_53;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_54> AgradCcdfLogLogistic_v_54;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_55> AgradCcdfLogLogistic_v_55;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_56> AgradCcdfLogLogistic_v_56;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_57> AgradCcdfLogLogistic_v_57;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_58> AgradCcdfLogLogistic_v_58;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_59> AgradCcdfLogLogistic_v_59;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_60> AgradCcdfLogLogistic_v_60;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_61> AgradCcdfLogLogistic_v_61;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_62> AgradCcdfLogLogistic_v_62;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_63> AgradCcdfLogLogistic_v_63;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_64> AgradCcdfLogLogistic_v_64;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_65> AgradCcdfLogLogistic_v_65;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_66> AgradCcdfLogLogistic_v_66;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_67> AgradCcdfLogLogistic_v_67;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_68> AgradCcdfLogLogistic_v_68;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_69> AgradCcdfLogLogistic_v_69;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_70> AgradCcdfLogLogistic_v_70;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_71> AgradCcdfLogLogistic_v_71;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_72> AgradCcdfLogLogistic_v_72;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_73> AgradCcdfLogLogistic_v_73;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_74> AgradCcdfLogLogistic_v_74;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_75> AgradCcdfLogLogistic_v_75;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_76> AgradCcdfLogLogistic_v_76;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_77> AgradCcdfLogLogistic_v_77;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_78> AgradCcdfLogLogistic_v_78;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_79> AgradCcdfLogLogistic_v_79;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_80> AgradCcdfLogLogistic_v_80;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_81> AgradCcdfLogLogistic_v_81;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_82> AgradCcdfLogLogistic_v_82;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_83> AgradCcdfLogLogistic_v_83;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_84> AgradCcdfLogLogistic_v_84;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_85> AgradCcdfLogLogistic_v_85;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_86> AgradCcdfLogLogistic_v_86;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_87> AgradCcdfLogLogistic_v_87;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_88> AgradCcdfLogLogistic_v_88;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_89> AgradCcdfLogLogistic_v_89;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_90> AgradCcdfLogLogistic_v_90;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_91> AgradCcdfLogLogistic_v_91;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_92> AgradCcdfLogLogistic_v_92;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_93> AgradCcdfLogLogistic_v_93;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_94> AgradCcdfLogLogistic_v_94;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_95> AgradCcdfLogLogistic_v_95;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_96> AgradCcdfLogLogistic_v_96;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_97> AgradCcdfLogLogistic_v_97;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_98> AgradCcdfLogLogistic_v_98;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_99> AgradCcdfLogLogistic_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_0, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_1, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_2, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_3, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_4, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_5, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_6, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_7, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_8, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_9, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_10, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_11, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_12, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_13, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_14, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_15, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_16, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_17, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_18, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_19, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_20, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_21, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_22, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_23, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_24, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_25, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_26, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_27, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_28, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_29, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_30, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_31, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_32, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_33, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_34, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_35, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_36, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_37, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_38, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_39, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_40, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_41, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_42, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_43, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_44, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_45, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_46, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_47, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_48, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_49, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_50, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_51, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_52, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_53, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_54, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_55, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_56, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_57, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_58, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_59, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_60, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_61, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_62, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_63, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_64, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_65, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_66, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_67, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_68, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_69, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_70, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_71, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_72, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_73, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_74, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_75, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_76, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_77, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_78, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_79, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_80, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_81, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_82, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_83, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_84, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_85, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_86, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_87, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_88, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_89, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_90, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_91, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_92, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_93, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_94, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_95, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_96, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_97, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_98, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_99, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_0> AgradCcdfLogLogistic_vv_0;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_1> AgradCcdfLogLogistic_vv_1;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_2> AgradCcdfLogLogistic_vv_2;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_3> AgradCcdfLogLogistic_vv_3;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_4> AgradCcdfLogLogistic_vv_4;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_5> AgradCcdfLogLogistic_vv_5;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_6> AgradCcdfLogLogistic_vv_6;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_7> AgradCcdfLogLogistic_vv_7;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_8> AgradCcdfLogLogistic_vv_8;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_9> AgradCcdfLogLogistic_vv_9;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_10> AgradCcdfLogLogistic_vv_10;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_11> AgradCcdfLogLogistic_vv_11;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_12> AgradCcdfLogLogistic_vv_12;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_13> AgradCcdfLogLogistic_vv_13;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_14> AgradCcdfLogLogistic_vv_14;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_15> AgradCcdfLogLogistic_vv_15;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_16> AgradCcdfLogLogistic_vv_16;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_17> AgradCcdfLogLogistic_vv_17;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_18> AgradCcdfLogLogistic_vv_18;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_19> AgradCcdfLogLogistic_vv_19;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_20> AgradCcdfLogLogistic_vv_20;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_21> AgradCcdfLogLogistic_vv_21;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_22> AgradCcdfLogLogistic_vv_22;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_23> AgradCcdfLogLogistic_vv_23;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_24> AgradCcdfLogLogistic_vv_24;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_25> AgradCcdfLogLogistic_vv_25;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_26> AgradCcdfLogLogistic_vv_26;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_27> AgradCcdfLogLogistic_vv_27;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_28> AgradCcdfLogLogistic_vv_28;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_29> AgradCcdfLogLogistic_vv_29;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_30> AgradCcdfLogLogistic_vv_30;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_31> AgradCcdfLogLogistic_vv_31;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_32> AgradCcdfLogLogistic_vv_32;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_33> AgradCcdfLogLogistic_vv_33;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_34> AgradCcdfLogLogistic_vv_34;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_35> AgradCcdfLogLogistic_vv_35;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_36> AgradCcdfLogLogistic_vv_36;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_37> AgradCcdfLogLogistic_vv_37;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_38> AgradCcdfLogLogistic_vv_38;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_39> AgradCcdfLogLogistic_vv_39;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_40> AgradCcdfLogLogistic_vv_40;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_41> AgradCcdfLogLogistic_vv_41;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_42> AgradCcdfLogLogistic_vv_42;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_43> AgradCcdfLogLogistic_vv_43;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_44> AgradCcdfLogLogistic_vv_44;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_45> AgradCcdfLogLogistic_vv_45;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_46> AgradCcdfLogLogistic_vv_46;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_47> AgradCcdfLogLogistic_vv_47;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_48> AgradCcdfLogLogistic_vv_48;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_49> AgradCcdfLogLogistic_vv_49;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_50> AgradCcdfLogLogistic_vv_50;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_51> AgradCcdfLogLogistic_vv_51;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_52> AgradCcdfLogLogistic_vv_52;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_53> AgradCcdfLogLogistic_vv_53;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_54> AgradCcdfLogLogistic_vv_54;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_55> AgradCcdfLogLogistic_vv_55;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_56> AgradCcdfLogLogistic_vv_56;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_57> AgradCcdfLogLogistic_vv_57;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_58> AgradCcdfLogLogistic_vv_58;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_59> AgradCcdfLogLogistic_vv_59;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_60> AgradCcdfLogLogistic_vv_60;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_61> AgradCcdfLogLogistic_vv_61;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_62> AgradCcdfLogLogistic_vv_62;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_63> AgradCcdfLogLogistic_vv_63;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_64> AgradCcdfLogLogistic_vv_64;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_65> AgradCcdfLogLogistic_vv_65;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_66> AgradCcdfLogLogistic_vv_66;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_67> AgradCcdfLogLogistic_vv_67;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_68> AgradCcdfLogLogistic_vv_68;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_69> AgradCcdfLogLogistic_vv_69;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_70> AgradCcdfLogLogistic_vv_70;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_71> AgradCcdfLogLogistic_vv_71;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_72> AgradCcdfLogLogistic_vv_72;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_73> AgradCcdfLogLogistic_vv_73;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_74> AgradCcdfLogLogistic_vv_74;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_75> AgradCcdfLogLogistic_vv_75;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_76> AgradCcdfLogLogistic_vv_76;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_77> AgradCcdfLogLogistic_vv_77;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_78> AgradCcdfLogLogistic_vv_78;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_79> AgradCcdfLogLogistic_vv_79;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_80> AgradCcdfLogLogistic_vv_80;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_81> AgradCcdfLogLogistic_vv_81;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_82> AgradCcdfLogLogistic_vv_82;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_83> AgradCcdfLogLogistic_vv_83;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_84> AgradCcdfLogLogistic_vv_84;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_85> AgradCcdfLogLogistic_vv_85;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_86> AgradCcdfLogLogistic_vv_86;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_87> AgradCcdfLogLogistic_vv_87;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_88> AgradCcdfLogLogistic_vv_88;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_89> AgradCcdfLogLogistic_vv_89;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_90> AgradCcdfLogLogistic_vv_90;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_91> AgradCcdfLogLogistic_vv_91;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_92> AgradCcdfLogLogistic_vv_92;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_93> AgradCcdfLogLogistic_vv_93;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_94> AgradCcdfLogLogistic_vv_94;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_95> AgradCcdfLogLogistic_vv_95;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_96> AgradCcdfLogLogistic_vv_96;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_97> AgradCcdfLogLogistic_vv_97;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_98> AgradCcdfLogLogistic_vv_98;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_99> AgradCcdfLogLogistic_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_99);
+
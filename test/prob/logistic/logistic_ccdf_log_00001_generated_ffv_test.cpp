@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_100> AgradCcdfLogLogistic_ffv_100;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_101> AgradCcdfLogLogistic_ffv_101;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_102> AgradCcdfLogLogistic_ffv_102;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_103> AgradCcdfLogLogistic_ffv_103;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_104> AgradCcdfLogLogistic_ffv_104;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_105> AgradCcdfLogLogistic_ffv_105;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_106> AgradCcdfLogLogistic_ffv_106;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_107> AgradCcdfLogLogistic_ffv_107;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_108> AgradCcdfLogLogistic_ffv_108;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_109> AgradCcdfLogLogistic_ffv_109;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_110> AgradCcdfLogLogistic_ffv_110;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_111> AgradCcdfLogLogistic_ffv_111;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_112> AgradCcdfLogLogistic_ffv_112;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_113> AgradCcdfLogLogistic_ffv_113;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_114> AgradCcdfLogLogistic_ffv_114;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_115> AgradCcdfLogLogistic_ffv_115;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_116> AgradCcdfLogLogistic_ffv_116;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_117> AgradCcdfLogLogistic_ffv_117;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_118> AgradCcdfLogLogistic_ffv_118;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_119> AgradCcdfLogLogistic_ffv_119;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_120> AgradCcdfLogLogistic_ffv_120;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_121> AgradCcdfLogLogistic_ffv_121;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_122> AgradCcdfLogLogistic_ffv_122;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_123> AgradCcdfLogLogistic_ffv_123;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_124> AgradCcdfLogLogistic_ffv_124;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_125> AgradCcdfLogLogistic_ffv_125;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_126> AgradCcdfLogLogistic_ffv_126;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_127> AgradCcdfLogLogistic_ffv_127;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_128> AgradCcdfLogLogistic_ffv_128;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_129> AgradCcdfLogLogistic_ffv_129;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_130> AgradCcdfLogLogistic_ffv_130;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_131> AgradCcdfLogLogistic_ffv_131;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_132> AgradCcdfLogLogistic_ffv_132;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_133> AgradCcdfLogLogistic_ffv_133;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_134> AgradCcdfLogLogistic_ffv_134;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_135> AgradCcdfLogLogistic_ffv_135;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_136> AgradCcdfLogLogistic_ffv_136;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_137> AgradCcdfLogLogistic_ffv_137;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_138> AgradCcdfLogLogistic_ffv_138;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_139> AgradCcdfLogLogistic_ffv_139;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_140> AgradCcdfLogLogistic_ffv_140;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_141> AgradCcdfLogLogistic_ffv_141;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_142> AgradCcdfLogLogistic_ffv_142;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_143> AgradCcdfLogLogistic_ffv_143;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_144> AgradCcdfLogLogistic_ffv_144;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_145> AgradCcdfLogLogistic_ffv_145;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_146> AgradCcdfLogLogistic_ffv_146;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_147> AgradCcdfLogLogistic_ffv_147;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_148> AgradCcdfLogLogistic_ffv_148;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_149> AgradCcdfLogLogistic_ffv_149;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_150> AgradCcdfLogLogistic_ffv_150;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_151> AgradCcdfLogLogistic_ffv_151;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_152> AgradCcdfLogLogistic_ffv_152;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_153> AgradCcdfLogLogistic_ffv_153;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_154> AgradCcdfLogLogistic_ffv_154;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_155> AgradCcdfLogLogistic_ffv_155;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_156> AgradCcdfLogLogistic_ffv_156;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_157> AgradCcdfLogLogistic_ffv_157;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_158> AgradCcdfLogLogistic_ffv_158;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_159> AgradCcdfLogLogistic_ffv_159;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_160> AgradCcdfLogLogistic_ffv_160;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_161> AgradCcdfLogLogistic_ffv_161;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_162> AgradCcdfLogLogistic_ffv_162;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_163> AgradCcdfLogLogistic_ffv_163;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_164> AgradCcdfLogLogistic_ffv_164;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_165> AgradCcdfLogLogistic_ffv_165;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_166> AgradCcdfLogLogistic_ffv_166;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_167> AgradCcdfLogLogistic_ffv_167;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_168> AgradCcdfLogLogistic_ffv_168;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_169> AgradCcdfLogLogistic_ffv_169;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_170> AgradCcdfLogLogistic_ffv_170;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_171> AgradCcdfLogLogistic_ffv_171;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_172> AgradCcdfLogLogistic_ffv_172;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_173> AgradCcdfLogLogistic_ffv_173;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_174> AgradCcdfLogLogistic_ffv_174;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_175> AgradCcdfLogLogistic_ffv_175;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_176> AgradCcdfLogLogistic_ffv_176;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_177> AgradCcdfLogLogistic_ffv_177;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_178> AgradCcdfLogLogistic_ffv_178;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_179> AgradCcdfLogLogistic_ffv_179;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_180> AgradCcdfLogLogistic_ffv_180;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_181> AgradCcdfLogLogistic_ffv_181;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_182> AgradCcdfLogLogistic_ffv_182;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_183> AgradCcdfLogLogistic_ffv_183;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_184> AgradCcdfLogLogistic_ffv_184;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_185> AgradCcdfLogLogistic_ffv_185;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_186> AgradCcdfLogLogistic_ffv_186;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_187> AgradCcdfLogLogistic_ffv_187;
+typedef std::tuple<AgradCcdfLogLogistic, type_ffv_188> AgradCcdfLogLogistic_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogLogistic, type_v_100> AgradCcdfLogLogistic_v_100;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_101> AgradCcdfLogLogistic_v_101;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_102> AgradCcdfLogLogistic_v_102;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_103> AgradCcdfLogLogistic_v_103;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_104> AgradCcdfLogLogistic_v_104;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_105> AgradCcdfLogLogistic_v_105;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_106> AgradCcdfLogLogistic_v_106;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_107> AgradCcdfLogLogistic_v_107;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_108> AgradCcdfLogLogistic_v_108;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_109> AgradCcdfLogLogistic_v_109;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_110> AgradCcdfLogLogistic_v_110;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_111> AgradCcdfLogLogistic_v_111;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_112> AgradCcdfLogLogistic_v_112;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_113> AgradCcdfLogLogistic_v_113;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_114> AgradCcdfLogLogistic_v_114;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_115> AgradCcdfLogLogistic_v_115;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_116> AgradCcdfLogLogistic_v_116;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_117> AgradCcdfLogLogistic_v_117;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_118> AgradCcdfLogLogistic_v_118;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_119> AgradCcdfLogLogistic_v_119;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_120> AgradCcdfLogLogistic_v_120;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_121> AgradCcdfLogLogistic_v_121;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_122> AgradCcdfLogLogistic_v_122;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_123> AgradCcdfLogLogistic_v_123;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_124> AgradCcdfLogLogistic_v_124;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_125> AgradCcdfLogLogistic_v_125;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_126> AgradCcdfLogLogistic_v_126;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_127> AgradCcdfLogLogistic_v_127;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_128> AgradCcdfLogLogistic_v_128;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_129> AgradCcdfLogLogistic_v_129;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_130> AgradCcdfLogLogistic_v_130;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_131> AgradCcdfLogLogistic_v_131;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_132> AgradCcdfLogLogistic_v_132;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_133> AgradCcdfLogLogistic_v_133;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_134> AgradCcdfLogLogistic_v_134;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_135> AgradCcdfLogLogistic_v_135;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_136> AgradCcdfLogLogistic_v_136;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_137> AgradCcdfLogLogistic_v_137;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_138> AgradCcdfLogLogistic_v_138;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_139> AgradCcdfLogLogistic_v_139;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_140> AgradCcdfLogLogistic_v_140;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_141> AgradCcdfLogLogistic_v_141;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_142> AgradCcdfLogLogistic_v_142;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_143> AgradCcdfLogLogistic_v_143;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_144> AgradCcdfLogLogistic_v_144;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_145> AgradCcdfLogLogistic_v_145;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_146> AgradCcdfLogLogistic_v_146;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_147> AgradCcdfLogLogistic_v_147;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_148> AgradCcdfLogLogistic_v_148;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_149> AgradCcdfLogLogistic_v_149;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_150> AgradCcdfLogLogistic_v_150;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_151> AgradCcdfLogLogistic_v_151;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_152> AgradCcdfLogLogistic_v_152;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_153> AgradCcdfLogLogistic_v_153;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_154> AgradCcdfLogLogistic_v_154;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_155> AgradCcdfLogLogistic_v_155;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_156> AgradCcdfLogLogistic_v_156;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_157> AgradCcdfLogLogistic_v_157;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_158> AgradCcdfLogLogistic_v_158;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_159> AgradCcdfLogLogistic_v_159;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_160> AgradCcdfLogLogistic_v_160;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_161> AgradCcdfLogLogistic_v_161;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_162> AgradCcdfLogLogistic_v_162;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_163> AgradCcdfLogLogistic_v_163;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_164> AgradCcdfLogLogistic_v_164;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_165> AgradCcdfLogLogistic_v_165;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_166> AgradCcdfLogLogistic_v_166;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_167> AgradCcdfLogLogistic_v_167;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_168> AgradCcdfLogLogistic_v_168;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_169> AgradCcdfLogLogistic_v_169;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_170> AgradCcdfLogLogistic_v_170;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_171> AgradCcdfLogLogistic_v_171;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_172> AgradCcdfLogLogistic_v_172;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_173> AgradCcdfLogLogistic_v_173;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_174> AgradCcdfLogLogistic_v_174;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_175> AgradCcdfLogLogistic_v_175;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_176> AgradCcdfLogLogistic_v_176;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_177> AgradCcdfLogLogistic_v_177;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_178> AgradCcdfLogLogistic_v_178;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_179> AgradCcdfLogLogistic_v_179;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_180> AgradCcdfLogLogistic_v_180;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_181> AgradCcdfLogLogistic_v_181;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_182> AgradCcdfLogLogistic_v_182;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_183> AgradCcdfLogLogistic_v_183;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_184> AgradCcdfLogLogistic_v_184;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_185> AgradCcdfLogLogistic_v_185;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_186> AgradCcdfLogLogistic_v_186;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_187> AgradCcdfLogLogistic_v_187;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_188> AgradCcdfLogLogistic_v_188;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_189> AgradCcdfLogLogistic_v_189;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_190> AgradCcdfLogLogistic_v_190;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_191> AgradCcdfLogLogistic_v_191;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_192> AgradCcdfLogLogistic_v_192;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_193> AgradCcdfLogLogistic_v_193;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_194> AgradCcdfLogLogistic_v_194;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_195> AgradCcdfLogLogistic_v_195;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_196> AgradCcdfLogLogistic_v_196;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_197> AgradCcdfLogLogistic_v_197;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_198> AgradCcdfLogLogistic_v_198;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_199> AgradCcdfLogLogistic_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_100, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_101, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_102, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_103, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_104, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_105, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_106, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_107, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_108, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_109, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_110, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_111, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_112, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_113, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_114, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_115, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_116, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_117, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_118, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_119, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_120, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_121, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_122, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_123, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_124, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_125, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_126, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_127, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_128, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_129, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_130, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_131, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_132, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_133, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_134, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_135, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_136, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_137, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_138, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_139, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_140, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_141, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_142, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_143, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_144, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_145, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_146, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_147, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_148, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_149, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_150, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_151, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_152, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_153, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_154, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_155, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_156, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_157, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_158, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_159, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_160, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_161, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_162, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_163, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_164, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_165, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_166, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_167, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_168, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_169, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_170, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_171, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_172, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_173, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_174, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_175, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_176, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_177, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_178, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_179, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_180, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_181, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_182, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_183, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_184, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_185, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_186, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_187, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_188, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_189, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_190, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_191, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_192, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_193, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_194, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_195, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_196, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_197, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_198, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_199, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_100> AgradCcdfLogLogistic_vv_100;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_101> AgradCcdfLogLogistic_vv_101;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_102> AgradCcdfLogLogistic_vv_102;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_103> AgradCcdfLogLogistic_vv_103;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_104> AgradCcdfLogLogistic_vv_104;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_105> AgradCcdfLogLogistic_vv_105;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_106> AgradCcdfLogLogistic_vv_106;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_107> AgradCcdfLogLogistic_vv_107;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_108> AgradCcdfLogLogistic_vv_108;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_109> AgradCcdfLogLogistic_vv_109;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_110> AgradCcdfLogLogistic_vv_110;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_111> AgradCcdfLogLogistic_vv_111;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_112> AgradCcdfLogLogistic_vv_112;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_113> AgradCcdfLogLogistic_vv_113;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_114> AgradCcdfLogLogistic_vv_114;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_115> AgradCcdfLogLogistic_vv_115;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_116> AgradCcdfLogLogistic_vv_116;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_117> AgradCcdfLogLogistic_vv_117;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_118> AgradCcdfLogLogistic_vv_118;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_119> AgradCcdfLogLogistic_vv_119;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_120> AgradCcdfLogLogistic_vv_120;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_121> AgradCcdfLogLogistic_vv_121;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_122> AgradCcdfLogLogistic_vv_122;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_123> AgradCcdfLogLogistic_vv_123;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_124> AgradCcdfLogLogistic_vv_124;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_125> AgradCcdfLogLogistic_vv_125;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_126> AgradCcdfLogLogistic_vv_126;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_127> AgradCcdfLogLogistic_vv_127;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_128> AgradCcdfLogLogistic_vv_128;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_129> AgradCcdfLogLogistic_vv_129;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_130> AgradCcdfLogLogistic_vv_130;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_131> AgradCcdfLogLogistic_vv_131;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_132> AgradCcdfLogLogistic_vv_132;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_133> AgradCcdfLogLogistic_vv_133;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_134> AgradCcdfLogLogistic_vv_134;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_135> AgradCcdfLogLogistic_vv_135;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_136> AgradCcdfLogLogistic_vv_136;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_137> AgradCcdfLogLogistic_vv_137;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_138> AgradCcdfLogLogistic_vv_138;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_139> AgradCcdfLogLogistic_vv_139;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_140> AgradCcdfLogLogistic_vv_140;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_141> AgradCcdfLogLogistic_vv_141;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_142> AgradCcdfLogLogistic_vv_142;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_143> AgradCcdfLogLogistic_vv_143;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_144> AgradCcdfLogLogistic_vv_144;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_145> AgradCcdfLogLogistic_vv_145;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_146> AgradCcdfLogLogistic_vv_146;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_147> AgradCcdfLogLogistic_vv_147;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_148> AgradCcdfLogLogistic_vv_148;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_149> AgradCcdfLogLogistic_vv_149;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_150> AgradCcdfLogLogistic_vv_150;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_151> AgradCcdfLogLogistic_vv_151;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_152> AgradCcdfLogLogistic_vv_152;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_153> AgradCcdfLogLogistic_vv_153;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_154> AgradCcdfLogLogistic_vv_154;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_155> AgradCcdfLogLogistic_vv_155;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_156> AgradCcdfLogLogistic_vv_156;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_157> AgradCcdfLogLogistic_vv_157;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_158> AgradCcdfLogLogistic_vv_158;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_159> AgradCcdfLogLogistic_vv_159;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_160> AgradCcdfLogLogistic_vv_160;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_161> AgradCcdfLogLogistic_vv_161;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_162> AgradCcdfLogLogistic_vv_162;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_163> AgradCcdfLogLogistic_vv_163;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_164> AgradCcdfLogLogistic_vv_164;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_165> AgradCcdfLogLogistic_vv_165;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_166> AgradCcdfLogLogistic_vv_166;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_167> AgradCcdfLogLogistic_vv_167;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_168> AgradCcdfLogLogistic_vv_168;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_169> AgradCcdfLogLogistic_vv_169;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_170> AgradCcdfLogLogistic_vv_170;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_171> AgradCcdfLogLogistic_vv_171;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_172> AgradCcdfLogLogistic_vv_172;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_173> AgradCcdfLogLogistic_vv_173;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_174> AgradCcdfLogLogistic_vv_174;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_175> AgradCcdfLogLogistic_vv_175;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_176> AgradCcdfLogLogistic_vv_176;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_177> AgradCcdfLogLogistic_vv_177;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_178> AgradCcdfLogLogistic_vv_178;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_179> AgradCcdfLogLogistic_vv_179;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_180> AgradCcdfLogLogistic_vv_180;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_181> AgradCcdfLogLogistic_vv_181;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_182> AgradCcdfLogLogistic_vv_182;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_183> AgradCcdfLogLogistic_vv_183;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_184> AgradCcdfLogLogistic_vv_184;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_185> AgradCcdfLogLogistic_vv_185;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_186> AgradCcdfLogLogistic_vv_186;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_187> AgradCcdfLogLogistic_vv_187;
+typedef std::tuple<AgradCcdfLogLogistic, type_vv_188> AgradCcdfLogLogistic_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_vv_188);
+
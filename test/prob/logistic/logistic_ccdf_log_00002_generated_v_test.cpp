@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCcdfLogLogistic, type_v_200> AgradCcdfLogLogistic_v_200;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_201> AgradCcdfLogLogistic_v_201;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_202> AgradCcdfLogLogistic_v_202;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_203> AgradCcdfLogLogistic_v_203;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_204> AgradCcdfLogLogistic_v_204;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_205> AgradCcdfLogLogistic_v_205;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_206> AgradCcdfLogLogistic_v_206;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_207> AgradCcdfLogLogistic_v_207;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_208> AgradCcdfLogLogistic_v_208;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_209> AgradCcdfLogLogistic_v_209;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_210> AgradCcdfLogLogistic_v_210;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_211> AgradCcdfLogLogistic_v_211;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_212> AgradCcdfLogLogistic_v_212;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_213> AgradCcdfLogLogistic_v_213;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_214> AgradCcdfLogLogistic_v_214;
+typedef std::tuple<AgradCcdfLogLogistic, type_v_215> AgradCcdfLogLogistic_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_200, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_201, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_202, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_203, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_204, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_205, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_206, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_207, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_208, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_209, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_210, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_211, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_212, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_213, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_214, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLogistic_v_215, AgradCcdfLogTestFixture, AgradCcdfLogLogistic_v_215);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogistic, type_ffv_100> AgradCdfLogistic_ffv_100;
+typedef std::tuple<AgradCdfLogistic, type_ffv_101> AgradCdfLogistic_ffv_101;
+typedef std::tuple<AgradCdfLogistic, type_ffv_102> AgradCdfLogistic_ffv_102;
+typedef std::tuple<AgradCdfLogistic, type_ffv_103> AgradCdfLogistic_ffv_103;
+typedef std::tuple<AgradCdfLogistic, type_ffv_104> AgradCdfLogistic_ffv_104;
+typedef std::tuple<AgradCdfLogistic, type_ffv_105> AgradCdfLogistic_ffv_105;
+typedef std::tuple<AgradCdfLogistic, type_ffv_106> AgradCdfLogistic_ffv_106;
+typedef std::tuple<AgradCdfLogistic, type_ffv_107> AgradCdfLogistic_ffv_107;
+typedef std::tuple<AgradCdfLogistic, type_ffv_108> AgradCdfLogistic_ffv_108;
+typedef std::tuple<AgradCdfLogistic, type_ffv_109> AgradCdfLogistic_ffv_109;
+typedef std::tuple<AgradCdfLogistic, type_ffv_110> AgradCdfLogistic_ffv_110;
+typedef std::tuple<AgradCdfLogistic, type_ffv_111> AgradCdfLogistic_ffv_111;
+typedef std::tuple<AgradCdfLogistic, type_ffv_112> AgradCdfLogistic_ffv_112;
+typedef std::tuple<AgradCdfLogistic, type_ffv_113> AgradCdfLogistic_ffv_113;
+typedef std::tuple<AgradCdfLogistic, type_ffv_114> AgradCdfLogistic_ffv_114;
+typedef std::tuple<AgradCdfLogistic, type_ffv_115> AgradCdfLogistic_ffv_115;
+typedef std::tuple<AgradCdfLogistic, type_ffv_116> AgradCdfLogistic_ffv_116;
+typedef std::tuple<AgradCdfLogistic, type_ffv_117> AgradCdfLogistic_ffv_117;
+typedef std::tuple<AgradCdfLogistic, type_ffv_118> AgradCdfLogistic_ffv_118;
+typedef std::tuple<AgradCdfLogistic, type_ffv_119> AgradCdfLogistic_ffv_119;
+typedef std::tuple<AgradCdfLogistic, type_ffv_120> AgradCdfLogistic_ffv_120;
+typedef std::tuple<AgradCdfLogistic, type_ffv_121> AgradCdfLogistic_ffv_121;
+typedef std::tuple<AgradCdfLogistic, type_ffv_122> AgradCdfLogistic_ffv_122;
+typedef std::tuple<AgradCdfLogistic, type_ffv_123> AgradCdfLogistic_ffv_123;
+typedef std::tuple<AgradCdfLogistic, type_ffv_124> AgradCdfLogistic_ffv_124;
+typedef std::tuple<AgradCdfLogistic, type_ffv_125> AgradCdfLogistic_ffv_125;
+typedef std::tuple<AgradCdfLogistic, type_ffv_126> AgradCdfLogistic_ffv_126;
+typedef std::tuple<AgradCdfLogistic, type_ffv_127> AgradCdfLogistic_ffv_127;
+typedef std::tuple<AgradCdfLogistic, type_ffv_128> AgradCdfLogistic_ffv_128;
+typedef std::tuple<AgradCdfLogistic, type_ffv_129> AgradCdfLogistic_ffv_129;
+typedef std::tuple<AgradCdfLogistic, type_ffv_130> AgradCdfLogistic_ffv_130;
+typedef std::tuple<AgradCdfLogistic, type_ffv_131> AgradCdfLogistic_ffv_131;
+typedef std::tuple<AgradCdfLogistic, type_ffv_132> AgradCdfLogistic_ffv_132;
+typedef std::tuple<AgradCdfLogistic, type_ffv_133> AgradCdfLogistic_ffv_133;
+typedef std::tuple<AgradCdfLogistic, type_ffv_134> AgradCdfLogistic_ffv_134;
+typedef std::tuple<AgradCdfLogistic, type_ffv_135> AgradCdfLogistic_ffv_135;
+typedef std::tuple<AgradCdfLogistic, type_ffv_136> AgradCdfLogistic_ffv_136;
+typedef std::tuple<AgradCdfLogistic, type_ffv_137> AgradCdfLogistic_ffv_137;
+typedef std::tuple<AgradCdfLogistic, type_ffv_138> AgradCdfLogistic_ffv_138;
+typedef std::tuple<AgradCdfLogistic, type_ffv_139> AgradCdfLogistic_ffv_139;
+typedef std::tuple<AgradCdfLogistic, type_ffv_140> AgradCdfLogistic_ffv_140;
+typedef std::tuple<AgradCdfLogistic, type_ffv_141> AgradCdfLogistic_ffv_141;
+typedef std::tuple<AgradCdfLogistic, type_ffv_142> AgradCdfLogistic_ffv_142;
+typedef std::tuple<AgradCdfLogistic, type_ffv_143> AgradCdfLogistic_ffv_143;
+typedef std::tuple<AgradCdfLogistic, type_ffv_144> AgradCdfLogistic_ffv_144;
+typedef std::tuple<AgradCdfLogistic, type_ffv_145> AgradCdfLogistic_ffv_145;
+typedef std::tuple<AgradCdfLogistic, type_ffv_146> AgradCdfLogistic_ffv_146;
+typedef std::tuple<AgradCdfLogistic, type_ffv_147> AgradCdfLogistic_ffv_147;
+typedef std::tuple<AgradCdfLogistic, type_ffv_148> AgradCdfLogistic_ffv_148;
+typedef std::tuple<AgradCdfLogistic, type_ffv_149> AgradCdfLogistic_ffv_149;
+typedef std::tuple<AgradCdfLogistic, type_ffv_150> AgradCdfLogistic_ffv_150;
+typedef std::tuple<AgradCdfLogistic, type_ffv_151> AgradCdfLogistic_ffv_151;
+typedef std::tuple<AgradCdfLogistic, type_ffv_152> AgradCdfLogistic_ffv_152;
+typedef std::tuple<AgradCdfLogistic, type_ffv_153> AgradCdfLogistic_ffv_153;
+typedef std::tuple<AgradCdfLogistic, type_ffv_154> AgradCdfLogistic_ffv_154;
+typedef std::tuple<AgradCdfLogistic, type_ffv_155> AgradCdfLogistic_ffv_155;
+typedef std::tuple<AgradCdfLogistic, type_ffv_156> AgradCdfLogistic_ffv_156;
+typedef std::tuple<AgradCdfLogistic, type_ffv_157> AgradCdfLogistic_ffv_157;
+typedef std::tuple<AgradCdfLogistic, type_ffv_158> AgradCdfLogistic_ffv_158;
+typedef std::tuple<AgradCdfLogistic, type_ffv_159> AgradCdfLogistic_ffv_159;
+typedef std::tuple<AgradCdfLogistic, type_ffv_160> AgradCdfLogistic_ffv_160;
+typedef std::tuple<AgradCdfLogistic, type_ffv_161> AgradCdfLogistic_ffv_161;
+typedef std::tuple<AgradCdfLogistic, type_ffv_162> AgradCdfLogistic_ffv_162;
+typedef std::tuple<AgradCdfLogistic, type_ffv_163> AgradCdfLogistic_ffv_163;
+typedef std::tuple<AgradCdfLogistic, type_ffv_164> AgradCdfLogistic_ffv_164;
+typedef std::tuple<AgradCdfLogistic, type_ffv_165> AgradCdfLogistic_ffv_165;
+typedef std::tuple<AgradCdfLogistic, type_ffv_166> AgradCdfLogistic_ffv_166;
+typedef std::tuple<AgradCdfLogistic, type_ffv_167> AgradCdfLogistic_ffv_167;
+typedef std::tuple<AgradCdfLogistic, type_ffv_168> AgradCdfLogistic_ffv_168;
+typedef std::tuple<AgradCdfLogistic, type_ffv_169> AgradCdfLogistic_ffv_169;
+typedef std::tuple<AgradCdfLogistic, type_ffv_170> AgradCdfLogistic_ffv_170;
+typedef std::tuple<AgradCdfLogistic, type_ffv_171> AgradCdfLogistic_ffv_171;
+typedef std::tuple<AgradCdfLogistic, type_ffv_172> AgradCdfLogistic_ffv_172;
+typedef std::tuple<AgradCdfLogistic, type_ffv_173> AgradCdfLogistic_ffv_173;
+typedef std::tuple<AgradCdfLogistic, type_ffv_174> AgradCdfLogistic_ffv_174;
+typedef std::tuple<AgradCdfLogistic, type_ffv_175> AgradCdfLogistic_ffv_175;
+typedef std::tuple<AgradCdfLogistic, type_ffv_176> AgradCdfLogistic_ffv_176;
+typedef std::tuple<AgradCdfLogistic, type_ffv_177> AgradCdfLogistic_ffv_177;
+typedef std::tuple<AgradCdfLogistic, type_ffv_178> AgradCdfLogistic_ffv_178;
+typedef std::tuple<AgradCdfLogistic, type_ffv_179> AgradCdfLogistic_ffv_179;
+typedef std::tuple<AgradCdfLogistic, type_ffv_180> AgradCdfLogistic_ffv_180;
+typedef std::tuple<AgradCdfLogistic, type_ffv_181> AgradCdfLogistic_ffv_181;
+typedef std::tuple<AgradCdfLogistic, type_ffv_182> AgradCdfLogistic_ffv_182;
+typedef std::tuple<AgradCdfLogistic, type_ffv_183> AgradCdfLogistic_ffv_183;
+typedef std::tuple<AgradCdfLogistic, type_ffv_184> AgradCdfLogistic_ffv_184;
+typedef std::tuple<AgradCdfLogistic, type_ffv_185> AgradCdfLogistic_ffv_185;
+typedef std::tuple<AgradCdfLogistic, type_ffv_186> AgradCdfLogistic_ffv_186;
+typedef std::tuple<AgradCdfLogistic, type_ffv_187> AgradCdfLogistic_ffv_187;
+typedef std::tuple<AgradCdfLogistic, type_ffv_188> AgradCdfLogistic_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_100, AgradCdfTestFixture, AgradCdfLogistic_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_101, AgradCdfTestFixture, AgradCdfLogistic_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_102, AgradCdfTestFixture, AgradCdfLogistic_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_103, AgradCdfTestFixture, AgradCdfLogistic_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_104, AgradCdfTestFixture, AgradCdfLogistic_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_105, AgradCdfTestFixture, AgradCdfLogistic_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_106, AgradCdfTestFixture, AgradCdfLogistic_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_107, AgradCdfTestFixture, AgradCdfLogistic_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_108, AgradCdfTestFixture, AgradCdfLogistic_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_109, AgradCdfTestFixture, AgradCdfLogistic_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_110, AgradCdfTestFixture, AgradCdfLogistic_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_111, AgradCdfTestFixture, AgradCdfLogistic_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_112, AgradCdfTestFixture, AgradCdfLogistic_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_113, AgradCdfTestFixture, AgradCdfLogistic_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_114, AgradCdfTestFixture, AgradCdfLogistic_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_115, AgradCdfTestFixture, AgradCdfLogistic_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_116, AgradCdfTestFixture, AgradCdfLogistic_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_117, AgradCdfTestFixture, AgradCdfLogistic_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_118, AgradCdfTestFixture, AgradCdfLogistic_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_119, AgradCdfTestFixture, AgradCdfLogistic_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_120, AgradCdfTestFixture, AgradCdfLogistic_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_121, AgradCdfTestFixture, AgradCdfLogistic_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_122, AgradCdfTestFixture, AgradCdfLogistic_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_123, AgradCdfTestFixture, AgradCdfLogistic_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_124, AgradCdfTestFixture, AgradCdfLogistic_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_125, AgradCdfTestFixture, AgradCdfLogistic_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_126, AgradCdfTestFixture, AgradCdfLogistic_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_127, AgradCdfTestFixture, AgradCdfLogistic_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_128, AgradCdfTestFixture, AgradCdfLogistic_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_129, AgradCdfTestFixture, AgradCdfLogistic_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_130, AgradCdfTestFixture, AgradCdfLogistic_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_131, AgradCdfTestFixture, AgradCdfLogistic_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_132, AgradCdfTestFixture, AgradCdfLogistic_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_133, AgradCdfTestFixture, AgradCdfLogistic_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_134, AgradCdfTestFixture, AgradCdfLogistic_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_135, AgradCdfTestFixture, AgradCdfLogistic_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_136, AgradCdfTestFixture, AgradCdfLogistic_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_137, AgradCdfTestFixture, AgradCdfLogistic_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_138, AgradCdfTestFixture, AgradCdfLogistic_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_139, AgradCdfTestFixture, AgradCdfLogistic_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_140, AgradCdfTestFixture, AgradCdfLogistic_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_141, AgradCdfTestFixture, AgradCdfLogistic_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_142, AgradCdfTestFixture, AgradCdfLogistic_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_143, AgradCdfTestFixture, AgradCdfLogistic_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_144, AgradCdfTestFixture, AgradCdfLogistic_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_145, AgradCdfTestFixture, AgradCdfLogistic_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_146, AgradCdfTestFixture, AgradCdfLogistic_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_147, AgradCdfTestFixture, AgradCdfLogistic_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_148, AgradCdfTestFixture, AgradCdfLogistic_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_149, AgradCdfTestFixture, AgradCdfLogistic_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_150, AgradCdfTestFixture, AgradCdfLogistic_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_151, AgradCdfTestFixture, AgradCdfLogistic_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_152, AgradCdfTestFixture, AgradCdfLogistic_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_153, AgradCdfTestFixture, AgradCdfLogistic_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_154, AgradCdfTestFixture, AgradCdfLogistic_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_155, AgradCdfTestFixture, AgradCdfLogistic_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_156, AgradCdfTestFixture, AgradCdfLogistic_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_157, AgradCdfTestFixture, AgradCdfLogistic_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_158, AgradCdfTestFixture, AgradCdfLogistic_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_159, AgradCdfTestFixture, AgradCdfLogistic_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_160, AgradCdfTestFixture, AgradCdfLogistic_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_161, AgradCdfTestFixture, AgradCdfLogistic_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_162, AgradCdfTestFixture, AgradCdfLogistic_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_163, AgradCdfTestFixture, AgradCdfLogistic_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_164, AgradCdfTestFixture, AgradCdfLogistic_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_165, AgradCdfTestFixture, AgradCdfLogistic_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_166, AgradCdfTestFixture, AgradCdfLogistic_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_167, AgradCdfTestFixture, AgradCdfLogistic_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_168, AgradCdfTestFixture, AgradCdfLogistic_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_169, AgradCdfTestFixture, AgradCdfLogistic_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_170, AgradCdfTestFixture, AgradCdfLogistic_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_171, AgradCdfTestFixture, AgradCdfLogistic_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_172, AgradCdfTestFixture, AgradCdfLogistic_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_173, AgradCdfTestFixture, AgradCdfLogistic_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_174, AgradCdfTestFixture, AgradCdfLogistic_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_175, AgradCdfTestFixture, AgradCdfLogistic_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_176, AgradCdfTestFixture, AgradCdfLogistic_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_177, AgradCdfTestFixture, AgradCdfLogistic_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_178, AgradCdfTestFixture, AgradCdfLogistic_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_179, AgradCdfTestFixture, AgradCdfLogistic_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_180, AgradCdfTestFixture, AgradCdfLogistic_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_181, AgradCdfTestFixture, AgradCdfLogistic_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_182, AgradCdfTestFixture, AgradCdfLogistic_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_183, AgradCdfTestFixture, AgradCdfLogistic_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_184, AgradCdfTestFixture, AgradCdfLogistic_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_185, AgradCdfTestFixture, AgradCdfLogistic_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_186, AgradCdfTestFixture, AgradCdfLogistic_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_187, AgradCdfTestFixture, AgradCdfLogistic_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_188, AgradCdfTestFixture, AgradCdfLogistic_ffv_188);
+
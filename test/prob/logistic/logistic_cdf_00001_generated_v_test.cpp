@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogistic, type_v_100> AgradCdfLogistic_v_100;
+typedef std::tuple<AgradCdfLogistic, type_v_101> AgradCdfLogistic_v_101;
+typedef std::tuple<AgradCdfLogistic, type_v_102> AgradCdfLogistic_v_102;
+typedef std::tuple<AgradCdfLogistic, type_v_103> AgradCdfLogistic_v_103;
+typedef std::tuple<AgradCdfLogistic, type_v_104> AgradCdfLogistic_v_104;
+typedef std::tuple<AgradCdfLogistic, type_v_105> AgradCdfLogistic_v_105;
+typedef std::tuple<AgradCdfLogistic, type_v_106> AgradCdfLogistic_v_106;
+typedef std::tuple<AgradCdfLogistic, type_v_107> AgradCdfLogistic_v_107;
+typedef std::tuple<AgradCdfLogistic, type_v_108> AgradCdfLogistic_v_108;
+typedef std::tuple<AgradCdfLogistic, type_v_109> AgradCdfLogistic_v_109;
+typedef std::tuple<AgradCdfLogistic, type_v_110> AgradCdfLogistic_v_110;
+typedef std::tuple<AgradCdfLogistic, type_v_111> AgradCdfLogistic_v_111;
+typedef std::tuple<AgradCdfLogistic, type_v_112> AgradCdfLogistic_v_112;
+typedef std::tuple<AgradCdfLogistic, type_v_113> AgradCdfLogistic_v_113;
+typedef std::tuple<AgradCdfLogistic, type_v_114> AgradCdfLogistic_v_114;
+typedef std::tuple<AgradCdfLogistic, type_v_115> AgradCdfLogistic_v_115;
+typedef std::tuple<AgradCdfLogistic, type_v_116> AgradCdfLogistic_v_116;
+typedef std::tuple<AgradCdfLogistic, type_v_117> AgradCdfLogistic_v_117;
+typedef std::tuple<AgradCdfLogistic, type_v_118> AgradCdfLogistic_v_118;
+typedef std::tuple<AgradCdfLogistic, type_v_119> AgradCdfLogistic_v_119;
+typedef std::tuple<AgradCdfLogistic, type_v_120> AgradCdfLogistic_v_120;
+typedef std::tuple<AgradCdfLogistic, type_v_121> AgradCdfLogistic_v_121;
+typedef std::tuple<AgradCdfLogistic, type_v_122> AgradCdfLogistic_v_122;
+typedef std::tuple<AgradCdfLogistic, type_v_123> AgradCdfLogistic_v_123;
+typedef std::tuple<AgradCdfLogistic, type_v_124> AgradCdfLogistic_v_124;
+typedef std::tuple<AgradCdfLogistic, type_v_125> AgradCdfLogistic_v_125;
+typedef std::tuple<AgradCdfLogistic, type_v_126> AgradCdfLogistic_v_126;
+typedef std::tuple<AgradCdfLogistic, type_v_127> AgradCdfLogistic_v_127;
+typedef std::tuple<AgradCdfLogistic, type_v_128> AgradCdfLogistic_v_128;
+typedef std::tuple<AgradCdfLogistic, type_v_129> AgradCdfLogistic_v_129;
+typedef std::tuple<AgradCdfLogistic, type_v_130> AgradCdfLogistic_v_130;
+typedef std::tuple<AgradCdfLogistic, type_v_131> AgradCdfLogistic_v_131;
+typedef std::tuple<AgradCdfLogistic, type_v_132> AgradCdfLogistic_v_132;
+typedef std::tuple<AgradCdfLogistic, type_v_133> AgradCdfLogistic_v_133;
+typedef std::tuple<AgradCdfLogistic, type_v_134> AgradCdfLogistic_v_134;
+typedef std::tuple<AgradCdfLogistic, type_v_135> AgradCdfLogistic_v_135;
+typedef std::tuple<AgradCdfLogistic, type_v_136> AgradCdfLogistic_v_136;
+typedef std::tuple<AgradCdfLogistic, type_v_137> AgradCdfLogistic_v_137;
+typedef std::tuple<AgradCdfLogistic, type_v_138> AgradCdfLogistic_v_138;
+typedef std::tuple<AgradCdfLogistic, type_v_139> AgradCdfLogistic_v_139;
+typedef std::tuple<AgradCdfLogistic, type_v_140> AgradCdfLogistic_v_140;
+typedef std::tuple<AgradCdfLogistic, type_v_141> AgradCdfLogistic_v_141;
+typedef std::tuple<AgradCdfLogistic, type_v_142> AgradCdfLogistic_v_142;
+typedef std::tuple<AgradCdfLogistic, type_v_143> AgradCdfLogistic_v_143;
+typedef std::tuple<AgradCdfLogistic, type_v_144> AgradCdfLogistic_v_144;
+typedef std::tuple<AgradCdfLogistic, type_v_145> AgradCdfLogistic_v_145;
+typedef std::tuple<AgradCdfLogistic, type_v_146> AgradCdfLogistic_v_146;
+typedef std::tuple<AgradCdfLogistic, type_v_147> AgradCdfLogistic_v_147;
+typedef std::tuple<AgradCdfLogistic, type_v_148> AgradCdfLogistic_v_148;
+typedef std::tuple<AgradCdfLogistic, type_v_149> AgradCdfLogistic_v_149;
+typedef std::tuple<AgradCdfLogistic, type_v_150> AgradCdfLogistic_v_150;
+typedef std::tuple<AgradCdfLogistic, type_v_151> AgradCdfLogistic_v_151;
+typedef std::tuple<AgradCdfLogistic, type_v_152> AgradCdfLogistic_v_152;
+typedef std::tuple<AgradCdfLogistic, type_v_153> AgradCdfLogistic_v_153;
+typedef std::tuple<AgradCdfLogistic, type_v_154> AgradCdfLogistic_v_154;
+typedef std::tuple<AgradCdfLogistic, type_v_155> AgradCdfLogistic_v_155;
+typedef std::tuple<AgradCdfLogistic, type_v_156> AgradCdfLogistic_v_156;
+typedef std::tuple<AgradCdfLogistic, type_v_157> AgradCdfLogistic_v_157;
+typedef std::tuple<AgradCdfLogistic, type_v_158> AgradCdfLogistic_v_158;
+typedef std::tuple<AgradCdfLogistic, type_v_159> AgradCdfLogistic_v_159;
+typedef std::tuple<AgradCdfLogistic, type_v_160> AgradCdfLogistic_v_160;
+typedef std::tuple<AgradCdfLogistic, type_v_161> AgradCdfLogistic_v_161;
+typedef std::tuple<AgradCdfLogistic, type_v_162> AgradCdfLogistic_v_162;
+typedef std::tuple<AgradCdfLogistic, type_v_163> AgradCdfLogistic_v_163;
+typedef std::tuple<AgradCdfLogistic, type_v_164> AgradCdfLogistic_v_164;
+typedef std::tuple<AgradCdfLogistic, type_v_165> AgradCdfLogistic_v_165;
+typedef std::tuple<AgradCdfLogistic, type_v_166> AgradCdfLogistic_v_166;
+typedef std::tuple<AgradCdfLogistic, type_v_167> AgradCdfLogistic_v_167;
+typedef std::tuple<AgradCdfLogistic, type_v_168> AgradCdfLogistic_v_168;
+typedef std::tuple<AgradCdfLogistic, type_v_169> AgradCdfLogistic_v_169;
+typedef std::tuple<AgradCdfLogistic, type_v_170> AgradCdfLogistic_v_170;
+typedef std::tuple<AgradCdfLogistic, type_v_171> AgradCdfLogistic_v_171;
+typedef std::tuple<AgradCdfLogistic, type_v_172> AgradCdfLogistic_v_172;
+typedef std::tuple<AgradCdfLogistic, type_v_173> AgradCdfLogistic_v_173;
+typedef std::tuple<AgradCdfLogistic, type_v_174> AgradCdfLogistic_v_174;
+typedef std::tuple<AgradCdfLogistic, type_v_175> AgradCdfLogistic_v_175;
+typedef std::tuple<AgradCdfLogistic, type_v_176> AgradCdfLogistic_v_176;
+typedef std::tuple<AgradCdfLogistic, type_v_177> AgradCdfLogistic_v_177;
+typedef std::tuple<AgradCdfLogistic, type_v_178> AgradCdfLogistic_v_178;
+typedef std::tuple<AgradCdfLogistic, type_v_179> AgradCdfLogistic_v_179;
+typedef std::tuple<AgradCdfLogistic, type_v_180> AgradCdfLogistic_v_180;
+typedef std::tuple<AgradCdfLogistic, type_v_181> AgradCdfLogistic_v_181;
+typedef std::tuple<AgradCdfLogistic, type_v_182> AgradCdfLogistic_v_182;
+typedef std::tuple<AgradCdfLogistic, type_v_183> AgradCdfLogistic_v_183;
+typedef std::tuple<AgradCdfLogistic, type_v_184> AgradCdfLogistic_v_184;
+typedef std::tuple<AgradCdfLogistic, type_v_185> AgradCdfLogistic_v_185;
+typedef std::tuple<AgradCdfLogistic, type_v_186> AgradCdfLogistic_v_186;
+typedef std::tuple<AgradCdfLogistic, type_v_187> AgradCdfLogistic_v_187;
+typedef std::tuple<AgradCdfLogistic, type_v_188> AgradCdfLogistic_v_188;
+typedef std::tuple<AgradCdfLogistic, type_v_189> AgradCdfLogistic_v_189;
+typedef std::tuple<AgradCdfLogistic, type_v_190> AgradCdfLogistic_v_190;
+typedef std::tuple<AgradCdfLogistic, type_v_191> AgradCdfLogistic_v_191;
+typedef std::tuple<AgradCdfLogistic, type_v_192> AgradCdfLogistic_v_192;
+typedef std::tuple<AgradCdfLogistic, type_v_193> AgradCdfLogistic_v_193;
+typedef std::tuple<AgradCdfLogistic, type_v_194> AgradCdfLogistic_v_194;
+typedef std::tuple<AgradCdfLogistic, type_v_195> AgradCdfLogistic_v_195;
+typedef std::tuple<AgradCdfLogistic, type_v_196> AgradCdfLogistic_v_196;
+typedef std::tuple<AgradCdfLogistic, type_v_197> AgradCdfLogistic_v_197;
+typedef std::tuple<AgradCdfLogistic, type_v_198> AgradCdfLogistic_v_198;
+typedef std::tuple<AgradCdfLogistic, type_v_199> AgradCdfLogistic_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_100, AgradCdfTestFixture, AgradCdfLogistic_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_101, AgradCdfTestFixture, AgradCdfLogistic_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_102, AgradCdfTestFixture, AgradCdfLogistic_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_103, AgradCdfTestFixture, AgradCdfLogistic_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_104, AgradCdfTestFixture, AgradCdfLogistic_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_105, AgradCdfTestFixture, AgradCdfLogistic_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_106, AgradCdfTestFixture, AgradCdfLogistic_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_107, AgradCdfTestFixture, AgradCdfLogistic_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_108, AgradCdfTestFixture, AgradCdfLogistic_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_109, AgradCdfTestFixture, AgradCdfLogistic_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_110, AgradCdfTestFixture, AgradCdfLogistic_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_111, AgradCdfTestFixture, AgradCdfLogistic_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_112, AgradCdfTestFixture, AgradCdfLogistic_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_113, AgradCdfTestFixture, AgradCdfLogistic_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_114, AgradCdfTestFixture, AgradCdfLogistic_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_115, AgradCdfTestFixture, AgradCdfLogistic_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_116, AgradCdfTestFixture, AgradCdfLogistic_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_117, AgradCdfTestFixture, AgradCdfLogistic_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_118, AgradCdfTestFixture, AgradCdfLogistic_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_119, AgradCdfTestFixture, AgradCdfLogistic_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_120, AgradCdfTestFixture, AgradCdfLogistic_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_121, AgradCdfTestFixture, AgradCdfLogistic_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_122, AgradCdfTestFixture, AgradCdfLogistic_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_123, AgradCdfTestFixture, AgradCdfLogistic_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_124, AgradCdfTestFixture, AgradCdfLogistic_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_125, AgradCdfTestFixture, AgradCdfLogistic_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_126, AgradCdfTestFixture, AgradCdfLogistic_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_127, AgradCdfTestFixture, AgradCdfLogistic_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_128, AgradCdfTestFixture, AgradCdfLogistic_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_129, AgradCdfTestFixture, AgradCdfLogistic_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_130, AgradCdfTestFixture, AgradCdfLogistic_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_131, AgradCdfTestFixture, AgradCdfLogistic_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_132, AgradCdfTestFixture, AgradCdfLogistic_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_133, AgradCdfTestFixture, AgradCdfLogistic_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_134, AgradCdfTestFixture, AgradCdfLogistic_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_135, AgradCdfTestFixture, AgradCdfLogistic_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_136, AgradCdfTestFixture, AgradCdfLogistic_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_137, AgradCdfTestFixture, AgradCdfLogistic_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_138, AgradCdfTestFixture, AgradCdfLogistic_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_139, AgradCdfTestFixture, AgradCdfLogistic_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_140, AgradCdfTestFixture, AgradCdfLogistic_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_141, AgradCdfTestFixture, AgradCdfLogistic_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_142, AgradCdfTestFixture, AgradCdfLogistic_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_143, AgradCdfTestFixture, AgradCdfLogistic_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_144, AgradCdfTestFixture, AgradCdfLogistic_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_145, AgradCdfTestFixture, AgradCdfLogistic_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_146, AgradCdfTestFixture, AgradCdfLogistic_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_147, AgradCdfTestFixture, AgradCdfLogistic_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_148, AgradCdfTestFixture, AgradCdfLogistic_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_149, AgradCdfTestFixture, AgradCdfLogistic_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_150, AgradCdfTestFixture, AgradCdfLogistic_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_151, AgradCdfTestFixture, AgradCdfLogistic_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_152, AgradCdfTestFixture, AgradCdfLogistic_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_153, AgradCdfTestFixture, AgradCdfLogistic_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_154, AgradCdfTestFixture, AgradCdfLogistic_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_155, AgradCdfTestFixture, AgradCdfLogistic_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_156, AgradCdfTestFixture, AgradCdfLogistic_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_157, AgradCdfTestFixture, AgradCdfLogistic_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_158, AgradCdfTestFixture, AgradCdfLogistic_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_159, AgradCdfTestFixture, AgradCdfLogistic_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_160, AgradCdfTestFixture, AgradCdfLogistic_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_161, AgradCdfTestFixture, AgradCdfLogistic_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_162, AgradCdfTestFixture, AgradCdfLogistic_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_163, AgradCdfTestFixture, AgradCdfLogistic_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_164, AgradCdfTestFixture, AgradCdfLogistic_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_165, AgradCdfTestFixture, AgradCdfLogistic_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_166, AgradCdfTestFixture, AgradCdfLogistic_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_167, AgradCdfTestFixture, AgradCdfLogistic_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_168, AgradCdfTestFixture, AgradCdfLogistic_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_169, AgradCdfTestFixture, AgradCdfLogistic_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_170, AgradCdfTestFixture, AgradCdfLogistic_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_171, AgradCdfTestFixture, AgradCdfLogistic_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_172, AgradCdfTestFixture, AgradCdfLogistic_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_173, AgradCdfTestFixture, AgradCdfLogistic_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_174, AgradCdfTestFixture, AgradCdfLogistic_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_175, AgradCdfTestFixture, AgradCdfLogistic_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_176, AgradCdfTestFixture, AgradCdfLogistic_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_177, AgradCdfTestFixture, AgradCdfLogistic_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_178, AgradCdfTestFixture, AgradCdfLogistic_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_179, AgradCdfTestFixture, AgradCdfLogistic_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_180, AgradCdfTestFixture, AgradCdfLogistic_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_181, AgradCdfTestFixture, AgradCdfLogistic_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_182, AgradCdfTestFixture, AgradCdfLogistic_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_183, AgradCdfTestFixture, AgradCdfLogistic_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_184, AgradCdfTestFixture, AgradCdfLogistic_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_185, AgradCdfTestFixture, AgradCdfLogistic_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_186, AgradCdfTestFixture, AgradCdfLogistic_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_187, AgradCdfTestFixture, AgradCdfLogistic_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_188, AgradCdfTestFixture, AgradCdfLogistic_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_189, AgradCdfTestFixture, AgradCdfLogistic_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_190, AgradCdfTestFixture, AgradCdfLogistic_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_191, AgradCdfTestFixture, AgradCdfLogistic_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_192, AgradCdfTestFixture, AgradCdfLogistic_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_193, AgradCdfTestFixture, AgradCdfLogistic_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_194, AgradCdfTestFixture, AgradCdfLogistic_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_195, AgradCdfTestFixture, AgradCdfLogistic_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_196, AgradCdfTestFixture, AgradCdfLogistic_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_197, AgradCdfTestFixture, AgradCdfLogistic_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_198, AgradCdfTestFixture, AgradCdfLogistic_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_199, AgradCdfTestFixture, AgradCdfLogistic_v_199);
+
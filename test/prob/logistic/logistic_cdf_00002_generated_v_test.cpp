@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCdfLogistic, type_v_200> AgradCdfLogistic_v_200;
+typedef std::tuple<AgradCdfLogistic, type_v_201> AgradCdfLogistic_v_201;
+typedef std::tuple<AgradCdfLogistic, type_v_202> AgradCdfLogistic_v_202;
+typedef std::tuple<AgradCdfLogistic, type_v_203> AgradCdfLogistic_v_203;
+typedef std::tuple<AgradCdfLogistic, type_v_204> AgradCdfLogistic_v_204;
+typedef std::tuple<AgradCdfLogistic, type_v_205> AgradCdfLogistic_v_205;
+typedef std::tuple<AgradCdfLogistic, type_v_206> AgradCdfLogistic_v_206;
+typedef std::tuple<AgradCdfLogistic, type_v_207> AgradCdfLogistic_v_207;
+typedef std::tuple<AgradCdfLogistic, type_v_208> AgradCdfLogistic_v_208;
+typedef std::tuple<AgradCdfLogistic, type_v_209> AgradCdfLogistic_v_209;
+typedef std::tuple<AgradCdfLogistic, type_v_210> AgradCdfLogistic_v_210;
+typedef std::tuple<AgradCdfLogistic, type_v_211> AgradCdfLogistic_v_211;
+typedef std::tuple<AgradCdfLogistic, type_v_212> AgradCdfLogistic_v_212;
+typedef std::tuple<AgradCdfLogistic, type_v_213> AgradCdfLogistic_v_213;
+typedef std::tuple<AgradCdfLogistic, type_v_214> AgradCdfLogistic_v_214;
+typedef std::tuple<AgradCdfLogistic, type_v_215> AgradCdfLogistic_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_200, AgradCdfTestFixture, AgradCdfLogistic_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_201, AgradCdfTestFixture, AgradCdfLogistic_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_202, AgradCdfTestFixture, AgradCdfLogistic_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_203, AgradCdfTestFixture, AgradCdfLogistic_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_204, AgradCdfTestFixture, AgradCdfLogistic_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_205, AgradCdfTestFixture, AgradCdfLogistic_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_206, AgradCdfTestFixture, AgradCdfLogistic_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_207, AgradCdfTestFixture, AgradCdfLogistic_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_208, AgradCdfTestFixture, AgradCdfLogistic_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_209, AgradCdfTestFixture, AgradCdfLogistic_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_210, AgradCdfTestFixture, AgradCdfLogistic_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_211, AgradCdfTestFixture, AgradCdfLogistic_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_212, AgradCdfTestFixture, AgradCdfLogistic_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_213, AgradCdfTestFixture, AgradCdfLogistic_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_214, AgradCdfTestFixture, AgradCdfLogistic_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_215, AgradCdfTestFixture, AgradCdfLogistic_v_215);
+
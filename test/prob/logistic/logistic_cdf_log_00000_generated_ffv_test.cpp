@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_0> AgradCdfLogLogistic_ffv_0;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_1> AgradCdfLogLogistic_ffv_1;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_2> AgradCdfLogLogistic_ffv_2;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_3> AgradCdfLogLogistic_ffv_3;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_4> AgradCdfLogLogistic_ffv_4;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_5> AgradCdfLogLogistic_ffv_5;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_6> AgradCdfLogLogistic_ffv_6;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_7> AgradCdfLogLogistic_ffv_7;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_8> AgradCdfLogLogistic_ffv_8;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_9> AgradCdfLogLogistic_ffv_9;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_10> AgradCdfLogLogistic_ffv_10;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_11> AgradCdfLogLogistic_ffv_11;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_12> AgradCdfLogLogistic_ffv_12;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_13> AgradCdfLogLogistic_ffv_13;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_14> AgradCdfLogLogistic_ffv_14;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_15> AgradCdfLogLogistic_ffv_15;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_16> AgradCdfLogLogistic_ffv_16;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_17> AgradCdfLogLogistic_ffv_17;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_18> AgradCdfLogLogistic_ffv_18;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_19> AgradCdfLogLogistic_ffv_19;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_20> AgradCdfLogLogistic_ffv_20;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_21> AgradCdfLogLogistic_ffv_21;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_22> AgradCdfLogLogistic_ffv_22;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_23> AgradCdfLogLogistic_ffv_23;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_24> AgradCdfLogLogistic_ffv_24;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_25> AgradCdfLogLogistic_ffv_25;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_26> AgradCdfLogLogistic_ffv_26;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_27> AgradCdfLogLogistic_ffv_27;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_28> AgradCdfLogLogistic_ffv_28;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_29> AgradCdfLogLogistic_ffv_29;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_30> AgradCdfLogLogistic_ffv_30;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_31> AgradCdfLogLogistic_ffv_31;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_32> AgradCdfLogLogistic_ffv_32;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_33> AgradCdfLogLogistic_ffv_33;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_34> AgradCdfLogLogistic_ffv_34;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_35> AgradCdfLogLogistic_ffv_35;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_36> AgradCdfLogLogistic_ffv_36;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_37> AgradCdfLogLogistic_ffv_37;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_38> AgradCdfLogLogistic_ffv_38;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_39> AgradCdfLogLogistic_ffv_39;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_40> AgradCdfLogLogistic_ffv_40;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_41> AgradCdfLogLogistic_ffv_41;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_42> AgradCdfLogLogistic_ffv_42;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_43> AgradCdfLogLogistic_ffv_43;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_44> AgradCdfLogLogistic_ffv_44;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_45> AgradCdfLogLogistic_ffv_45;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_46> AgradCdfLogLogistic_ffv_46;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_47> AgradCdfLogLogistic_ffv_47;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_48> AgradCdfLogLogistic_ffv_48;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_49> AgradCdfLogLogistic_ffv_49;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_50> AgradCdfLogLogistic_ffv_50;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_51> AgradCdfLogLogistic_ffv_51;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_52> AgradCdfLogLogistic_ffv_52;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_53> AgradCdfLogLogistic_ffv_53;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_54> AgradCdfLogLogistic_ffv_54;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_55> AgradCdfLogLogistic_ffv_55;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_56> AgradCdfLogLogistic_ffv_56;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_57> AgradCdfLogLogistic_ffv_57;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_58> AgradCdfLogLogistic_ffv_58;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_59> AgradCdfLogLogistic_ffv_59;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_60> AgradCdfLogLogistic_ffv_60;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_61> AgradCdfLogLogistic_ffv_61;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_62> AgradCdfLogLogistic_ffv_62;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_63> AgradCdfLogLogistic_ffv_63;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_64> AgradCdfLogLogistic_ffv_64;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_65> AgradCdfLogLogistic_ffv_65;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_66> AgradCdfLogLogistic_ffv_66;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_67> AgradCdfLogLogistic_ffv_67;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_68> AgradCdfLogLogistic_ffv_68;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_69> AgradCdfLogLogistic_ffv_69;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_70> AgradCdfLogLogistic_ffv_70;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_71> AgradCdfLogLogistic_ffv_71;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_72> AgradCdfLogLogistic_ffv_72;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_73> AgradCdfLogLogistic_ffv_73;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_74> AgradCdfLogLogistic_ffv_74;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_75> AgradCdfLogLogistic_ffv_75;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_76> AgradCdfLogLogistic_ffv_76;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_77> AgradCdfLogLogistic_ffv_77;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_78> AgradCdfLogLogistic_ffv_78;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_79> AgradCdfLogLogistic_ffv_79;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_80> AgradCdfLogLogistic_ffv_80;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_81> AgradCdfLogLogistic_ffv_81;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_82> AgradCdfLogLogistic_ffv_82;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_83> AgradCdfLogLogistic_ffv_83;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_84> AgradCdfLogLogistic_ffv_84;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_85> AgradCdfLogLogistic_ffv_85;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_86> AgradCdfLogLogistic_ffv_86;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_87> AgradCdfLogLogistic_ffv_87;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_88> AgradCdfLogLogistic_ffv_88;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_89> AgradCdfLogLogistic_ffv_89;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_90> AgradCdfLogLogistic_ffv_90;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_91> AgradCdfLogLogistic_ffv_91;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_92> AgradCdfLogLogistic_ffv_92;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_93> AgradCdfLogLogistic_ffv_93;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_94> AgradCdfLogLogistic_ffv_94;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_95> AgradCdfLogLogistic_ffv_95;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_96> AgradCdfLogLogistic_ffv_96;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_97> AgradCdfLogLogistic_ffv_97;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_98> AgradCdfLogLogistic_ffv_98;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_99> AgradCdfLogLogistic_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_0, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_1, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_2, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_3, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_4, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_5, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_6, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_7, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_8, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_9, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_10, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_11, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_12, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_13, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_14, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_15, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_16, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_17, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_18, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_19, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_20, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_21, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_22, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_23, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_24, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_25, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_26, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_27, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_28, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_29, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_30, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_31, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_32, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_33, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_34, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_35, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_36, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_37, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_38, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_39, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_40, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_41, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_42, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_43, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_44, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_45, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_46, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_47, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_48, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_49, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_50, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_51, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_52, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_53, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_54, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_55, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_56, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_57, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_58, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_59, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_60, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_61, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_62, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_63, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_64, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_65, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_66, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_67, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_68, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_69, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_70, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_71, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_72, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_73, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_74, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_75, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_76, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_77, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_78, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_79, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_80, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_81, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_82, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_83, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_84, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_85, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_86, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_87, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_88, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_89, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_90, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_91, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_92, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_93, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_94, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_95, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_96, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_97, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_98, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_99, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_99);
+
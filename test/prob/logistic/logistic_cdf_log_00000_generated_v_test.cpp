@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogLogistic, type_v_0> AgradCdfLogLogistic_v_0;
+typedef std::tuple<AgradCdfLogLogistic, type_v_1> AgradCdfLogLogistic_v_1;
+typedef std::tuple<AgradCdfLogLogistic, type_v_2> AgradCdfLogLogistic_v_2;
+typedef std::tuple<AgradCdfLogLogistic, type_v_3> AgradCdfLogLogistic_v_3;
+typedef std::tuple<AgradCdfLogLogistic, type_v_4> AgradCdfLogLogistic_v_4;
+typedef std::tuple<AgradCdfLogLogistic, type_v_5> AgradCdfLogLogistic_v_5;
+typedef std::tuple<AgradCdfLogLogistic, type_v_6> AgradCdfLogLogistic_v_6;
+typedef std::tuple<AgradCdfLogLogistic, type_v_7> AgradCdfLogLogistic_v_7;
+typedef std::tuple<AgradCdfLogLogistic, type_v_8> AgradCdfLogLogistic_v_8;
+typedef std::tuple<AgradCdfLogLogistic, type_v_9> AgradCdfLogLogistic_v_9;
+typedef std::tuple<AgradCdfLogLogistic, type_v_10> AgradCdfLogLogistic_v_10;
+typedef std::tuple<AgradCdfLogLogistic, type_v_11> AgradCdfLogLogistic_v_11;
+typedef std::tuple<AgradCdfLogLogistic, type_v_12> AgradCdfLogLogistic_v_12;
+typedef std::tuple<AgradCdfLogLogistic, type_v_13> AgradCdfLogLogistic_v_13;
+typedef std::tuple<AgradCdfLogLogistic, type_v_14> AgradCdfLogLogistic_v_14;
+typedef std::tuple<AgradCdfLogLogistic, type_v_15> AgradCdfLogLogistic_v_15;
+typedef std::tuple<AgradCdfLogLogistic, type_v_16> AgradCdfLogLogistic_v_16;
+typedef std::tuple<AgradCdfLogLogistic, type_v_17> AgradCdfLogLogistic_v_17;
+typedef std::tuple<AgradCdfLogLogistic, type_v_18> AgradCdfLogLogistic_v_18;
+typedef std::tuple<AgradCdfLogLogistic, type_v_19> AgradCdfLogLogistic_v_19;
+typedef std::tuple<AgradCdfLogLogistic, type_v_20> AgradCdfLogLogistic_v_20;
+typedef std::tuple<AgradCdfLogLogistic, type_v_21> AgradCdfLogLogistic_v_21;
+typedef std::tuple<AgradCdfLogLogistic, type_v_22> AgradCdfLogLogistic_v_22;
+typedef std::tuple<AgradCdfLogLogistic, type_v_23> AgradCdfLogLogistic_v_23;
+typedef std::tuple<AgradCdfLogLogistic, type_v_24> AgradCdfLogLogistic_v_24;
+typedef std::tuple<AgradCdfLogLogistic, type_v_25> AgradCdfLogLogistic_v_25;
+typedef std::tuple<AgradCdfLogLogistic, type_v_26> AgradCdfLogLogistic_v_26;
+typedef std::tuple<AgradCdfLogLogistic, type_v_27> AgradCdfLogLogistic_v_27;
+typedef std::tuple<AgradCdfLogLogistic, type_v_28> AgradCdfLogLogistic_v_28;
+typedef std::tuple<AgradCdfLogLogistic, type_v_29> AgradCdfLogLogistic_v_29;
+typedef std::tuple<AgradCdfLogLogistic, type_v_30> AgradCdfLogLogistic_v_30;
+typedef std::tuple<AgradCdfLogLogistic, type_v_31> AgradCdfLogLogistic_v_31;
+typedef std::tuple<AgradCdfLogLogistic, type_v_32> AgradCdfLogLogistic_v_32;
+typedef std::tuple<AgradCdfLogLogistic, type_v_33> AgradCdfLogLogistic_v_33;
+typedef std::tuple<AgradCdfLogLogistic, type_v_34> AgradCdfLogLogistic_v_34;
+typedef std::tuple<AgradCdfLogLogistic, type_v_35> AgradCdfLogLogistic_v_35;
+typedef std::tuple<AgradCdfLogLogistic, type_v_36> AgradCdfLogLogistic_v_36;
+typedef std::tuple<AgradCdfLogLogistic, type_v_37> AgradCdfLogLogistic_v_37;
+typedef std::tuple<AgradCdfLogLogistic, type_v_38> AgradCdfLogLogistic_v_38;
+typedef std::tuple<AgradCdfLogLogistic, type_v_39> AgradCdfLogLogistic_v_39;
+typedef std::tuple<AgradCdfLogLogistic, type_v_40> AgradCdfLogLogistic_v_40;
+typedef std::tuple<AgradCdfLogLogistic, type_v_41> AgradCdfLogLogistic_v_41;
+typedef std::tuple<AgradCdfLogLogistic, type_v_42> AgradCdfLogLogistic_v_42;
+typedef std::tuple<AgradCdfLogLogistic, type_v_43> AgradCdfLogLogistic_v_43;
+typedef std::tuple<AgradCdfLogLogistic, type_v_44> AgradCdfLogLogistic_v_44;
+typedef std::tuple<AgradCdfLogLogistic, type_v_45> AgradCdfLogLogistic_v_45;
+typedef std::tuple<AgradCdfLogLogistic, type_v_46> AgradCdfLogLogistic_v_46;
+typedef std::tuple<AgradCdfLogLogistic, type_v_47> AgradCdfLogLogistic_v_47;
+typedef std::tuple<AgradCdfLogLogistic, type_v_48> AgradCdfLogLogistic_v_48;
+typedef std::tuple<AgradCdfLogLogistic, type_v_49> AgradCdfLogLogistic_v_49;
+typedef std::tuple<AgradCdfLogLogistic, type_v_50> AgradCdfLogLogistic_v_50;
+typedef std::tuple<AgradCdfLogLogistic, type_v_51> AgradCdfLogLogistic_v_51;
+typedef std::tuple<AgradCdfLogLogistic, type_v_52> AgradCdfLogLogistic_v_52;
+typedef std::tuple<AgradCdfLogLogistic, type_v_53> AgradCdfLogLogistic_v_53;
+typedef std::tuple<AgradCdfLogLogistic, type_v_54> AgradCdfLogLogistic_v_54;
+typedef std::tuple<AgradCdfLogLogistic, type_v_55> AgradCdfLogLogistic_v_55;
+typedef std::tuple<AgradCdfLogLogistic, type_v_56> AgradCdfLogLogistic_v_56;
+typedef std::tuple<AgradCdfLogLogistic, type_v_57> AgradCdfLogLogistic_v_57;
+typedef std::tuple<AgradCdfLogLogistic, type_v_58> AgradCdfLogLogistic_v_58;
+typedef std::tuple<AgradCdfLogLogistic, type_v_59> AgradCdfLogLogistic_v_59;
+typedef std::tuple<AgradCdfLogLogistic, type_v_60> AgradCdfLogLogistic_v_60;
+typedef std::tuple<AgradCdfLogLogistic, type_v_61> AgradCdfLogLogistic_v_61;
+typedef std::tuple<AgradCdfLogLogistic, type_v_62> AgradCdfLogLogistic_v_62;
+typedef std::tuple<AgradCdfLogLogistic, type_v_63> AgradCdfLogLogistic_v_63;
+typedef std::tuple<AgradCdfLogLogistic, type_v_64> AgradCdfLogLogistic_v_64;
+typedef std::tuple<AgradCdfLogLogistic, type_v_65> AgradCdfLogLogistic_v_65;
+typedef std::tuple<AgradCdfLogLogistic, type_v_66> AgradCdfLogLogistic_v_66;
+typedef std::tuple<AgradCdfLogLogistic, type_v_67> AgradCdfLogLogistic_v_67;
+typedef std::tuple<AgradCdfLogLogistic, type_v_68> AgradCdfLogLogistic_v_68;
+typedef std::tuple<AgradCdfLogLogistic, type_v_69> AgradCdfLogLogistic_v_69;
+typedef std::tuple<AgradCdfLogLogistic, type_v_70> AgradCdfLogLogistic_v_70;
+typedef std::tuple<AgradCdfLogLogistic, type_v_71> AgradCdfLogLogistic_v_71;
+typedef std::tuple<AgradCdfLogLogistic, type_v_72> AgradCdfLogLogistic_v_72;
+typedef std::tuple<AgradCdfLogLogistic, type_v_73> AgradCdfLogLogistic_v_73;
+typedef std::tuple<AgradCdfLogLogistic, type_v_74> AgradCdfLogLogistic_v_74;
+typedef std::tuple<AgradCdfLogLogistic, type_v_75> AgradCdfLogLogistic_v_75;
+typedef std::tuple<AgradCdfLogLogistic, type_v_76> AgradCdfLogLogistic_v_76;
+typedef std::tuple<AgradCdfLogLogistic, type_v_77> AgradCdfLogLogistic_v_77;
+typedef std::tuple<AgradCdfLogLogistic, type_v_78> AgradCdfLogLogistic_v_78;
+typedef std::tuple<AgradCdfLogLogistic, type_v_79> AgradCdfLogLogistic_v_79;
+typedef std::tuple<AgradCdfLogLogistic, type_v_80> AgradCdfLogLogistic_v_80;
+typedef std::tuple<AgradCdfLogLogistic, type_v_81> AgradCdfLogLogistic_v_81;
+typedef std::tuple<AgradCdfLogLogistic, type_v_82> AgradCdfLogLogistic_v_82;
+typedef std::tuple<AgradCdfLogLogistic, type_v_83> AgradCdfLogLogistic_v_83;
+typedef std::tuple<AgradCdfLogLogistic, type_v_84> AgradCdfLogLogistic_v_84;
+typedef std::tuple<AgradCdfLogLogistic, type_v_85> AgradCdfLogLogistic_v_85;
+typedef std::tuple<AgradCdfLogLogistic, type_v_86> AgradCdfLogLogistic_v_86;
+typedef std::tuple<AgradCdfLogLogistic, type_v_87> AgradCdfLogLogistic_v_87;
+typedef std::tuple<AgradCdfLogLogistic, type_v_88> AgradCdfLogLogistic_v_88;
+typedef std::tuple<AgradCdfLogLogistic, type_v_89> AgradCdfLogLogistic_v_89;
+typedef std::tuple<AgradCdfLogLogistic, type_v_90> AgradCdfLogLogistic_v_90;
+typedef std::tuple<AgradCdfLogLogistic, type_v_91> AgradCdfLogLogistic_v_91;
+typedef std::tuple<AgradCdfLogLogistic, type_v_92> AgradCdfLogLogistic_v_92;
+typedef std::tuple<AgradCdfLogLogistic, type_v_93> AgradCdfLogLogistic_v_93;
+typedef std::tuple<AgradCdfLogLogistic, type_v_94> AgradCdfLogLogistic_v_94;
+typedef std::tuple<AgradCdfLogLogistic, type_v_95> AgradCdfLogLogistic_v_95;
+typedef std::tuple<AgradCdfLogLogistic, type_v_96> AgradCdfLogLogistic_v_96;
+typedef std::tuple<AgradCdfLogLogistic, type_v_97> AgradCdfLogLogistic_v_97;
+typedef std::tuple<AgradCdfLogLogistic, type_v_98> AgradCdfLogLogistic_v_98;
+typedef std::tuple<AgradCdfLogLogistic, type_v_99> AgradCdfLogLogistic_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_0, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_1, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_2, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_3, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_4, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_5, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_6, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_7, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_8, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_9, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_10, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_11, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_12, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_13, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_14, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_15, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_16, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_17, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_18, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_19, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_20, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_21, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_22, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_23, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_24, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_25, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_26, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_27, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_28, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_29, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_30, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_31, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_32, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_33, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_34, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_35, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_36, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_37, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_38, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_39, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_40, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_41, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_42, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_43, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_44, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_45, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_46, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_47, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_48, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_49, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_50, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_51, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_52, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_53, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_54, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_55, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_56, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_57, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_58, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_59, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_60, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_61, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_62, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_63, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_64, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_65, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_66, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_67, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_68, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_69, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_70, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_71, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_72, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_73, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_74, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_75, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_76, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_77, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_78, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_79, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_80, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_81, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_82, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_83, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_84, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_85, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_86, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_87, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_88, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_89, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_90, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_91, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_92, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_93, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_94, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_95, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_96, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_97, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_98, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_99, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_99);
+
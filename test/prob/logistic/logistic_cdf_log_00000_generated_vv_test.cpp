@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogLogistic, type_vv_0> AgradCdfLogLogistic_vv_0;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_1> AgradCdfLogLogistic_vv_1;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_2> AgradCdfLogLogistic_vv_2;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_3> AgradCdfLogLogistic_vv_3;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_4> AgradCdfLogLogistic_vv_4;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_5> AgradCdfLogLogistic_vv_5;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_6> AgradCdfLogLogistic_vv_6;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_7> AgradCdfLogLogistic_vv_7;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_8> AgradCdfLogLogistic_vv_8;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_9> AgradCdfLogLogistic_vv_9;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_10> AgradCdfLogLogistic_vv_10;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_11> AgradCdfLogLogistic_vv_11;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_12> AgradCdfLogLogistic_vv_12;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_13> AgradCdfLogLogistic_vv_13;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_14> AgradCdfLogLogistic_vv_14;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_15> AgradCdfLogLogistic_vv_15;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_16> AgradCdfLogLogistic_vv_16;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_17> AgradCdfLogLogistic_vv_17;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_18> AgradCdfLogLogistic_vv_18;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_19> AgradCdfLogLogistic_vv_19;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_20> AgradCdfLogLogistic_vv_20;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_21> AgradCdfLogLogistic_vv_21;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_22> AgradCdfLogLogistic_vv_22;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_23> AgradCdfLogLogistic_vv_23;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_24> AgradCdfLogLogistic_vv_24;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_25> AgradCdfLogLogistic_vv_25;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_26> AgradCdfLogLogistic_vv_26;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_27> AgradCdfLogLogistic_vv_27;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_28> AgradCdfLogLogistic_vv_28;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_29> AgradCdfLogLogistic_vv_29;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_30> AgradCdfLogLogistic_vv_30;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_31> AgradCdfLogLogistic_vv_31;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_32> AgradCdfLogLogistic_vv_32;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_33> AgradCdfLogLogistic_vv_33;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_34> AgradCdfLogLogistic_vv_34;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_35> AgradCdfLogLogistic_vv_35;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_36> AgradCdfLogLogistic_vv_36;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_37> AgradCdfLogLogistic_vv_37;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_38> AgradCdfLogLogistic_vv_38;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_39> AgradCdfLogLogistic_vv_39;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_40> AgradCdfLogLogistic_vv_40;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_41> AgradCdfLogLogistic_vv_41;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_42> AgradCdfLogLogistic_vv_42;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_43> AgradCdfLogLogistic_vv_43;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_44> AgradCdfLogLogistic_vv_44;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_45> AgradCdfLogLogistic_vv_45;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_46> AgradCdfLogLogistic_vv_46;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_47> AgradCdfLogLogistic_vv_47;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_48> AgradCdfLogLogistic_vv_48;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_49> AgradCdfLogLogistic_vv_49;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_50> AgradCdfLogLogistic_vv_50;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_51> AgradCdfLogLogistic_vv_51;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_52> AgradCdfLogLogistic_vv_52;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_53> AgradCdfLogLogistic_vv_53;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_54> AgradCdfLogLogistic_vv_54;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_55> AgradCdfLogLogistic_vv_55;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_56> AgradCdfLogLogistic_vv_56;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_57> AgradCdfLogLogistic_vv_57;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_58> AgradCdfLogLogistic_vv_58;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_59> AgradCdfLogLogistic_vv_59;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_60> AgradCdfLogLogistic_vv_60;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_61> AgradCdfLogLogistic_vv_61;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_62> AgradCdfLogLogistic_vv_62;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_63> AgradCdfLogLogistic_vv_63;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_64> AgradCdfLogLogistic_vv_64;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_65> AgradCdfLogLogistic_vv_65;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_66> AgradCdfLogLogistic_vv_66;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_67> AgradCdfLogLogistic_vv_67;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_68> AgradCdfLogLogistic_vv_68;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_69> AgradCdfLogLogistic_vv_69;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_70> AgradCdfLogLogistic_vv_70;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_71> AgradCdfLogLogistic_vv_71;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_72> AgradCdfLogLogistic_vv_72;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_73> AgradCdfLogLogistic_vv_73;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_74> AgradCdfLogLogistic_vv_74;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_75> AgradCdfLogLogistic_vv_75;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_76> AgradCdfLogLogistic_vv_76;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_77> AgradCdfLogLogistic_vv_77;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_78> AgradCdfLogLogistic_vv_78;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_79> AgradCdfLogLogistic_vv_79;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_80> AgradCdfLogLogistic_vv_80;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_81> AgradCdfLogLogistic_vv_81;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_82> AgradCdfLogLogistic_vv_82;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_83> AgradCdfLogLogistic_vv_83;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_84> AgradCdfLogLogistic_vv_84;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_85> AgradCdfLogLogistic_vv_85;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_86> AgradCdfLogLogistic_vv_86;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_87> AgradCdfLogLogistic_vv_87;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_88> AgradCdfLogLogistic_vv_88;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_89> AgradCdfLogLogistic_vv_89;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_90> AgradCdfLogLogistic_vv_90;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_91> AgradCdfLogLogistic_vv_91;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_92> AgradCdfLogLogistic_vv_92;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_93> AgradCdfLogLogistic_vv_93;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_94> AgradCdfLogLogistic_vv_94;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_95> AgradCdfLogLogistic_vv_95;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_96> AgradCdfLogLogistic_vv_96;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_97> AgradCdfLogLogistic_vv_97;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_98> AgradCdfLogLogistic_vv_98;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_99> AgradCdfLogLogistic_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_0, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_1, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_2, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_3, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_4, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_5, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_6, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_7, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_8, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_9, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_10, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_11, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_12, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_13, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_14, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_15, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_16, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_17, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_18, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_19, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_20, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_21, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_22, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_23, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_24, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_25, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_26, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_27, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_28, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_29, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_30, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_31, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_32, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_33, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_34, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_35, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_36, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_37, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_38, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_39, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_40, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_41, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_42, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_43, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_44, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_45, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_46, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_47, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_48, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_49, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_50, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_51, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_52, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_53, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_54, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_55, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_56, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_57, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_58, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_59, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_60, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_61, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_62, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_63, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_64, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_65, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_66, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_67, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_68, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_69, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_70, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_71, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_72, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_73, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_74, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_75, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_76, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_77, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_78, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_79, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_80, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_81, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_82, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_83, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_84, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_85, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_86, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_87, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_88, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_89, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_90, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_91, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_92, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_93, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_94, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_95, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_96, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_97, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_98, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_99, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_100> AgradCdfLogLogistic_ffv_100;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_101> AgradCdfLogLogistic_ffv_101;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_102> AgradCdfLogLogistic_ffv_102;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_103> AgradCdfLogLogistic_ffv_103;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_104> AgradCdfLogLogistic_ffv_104;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_105> AgradCdfLogLogistic_ffv_105;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_106> AgradCdfLogLogistic_ffv_106;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_107> AgradCdfLogLogistic_ffv_107;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_108> AgradCdfLogLogistic_ffv_108;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_109> AgradCdfLogLogistic_ffv_109;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_110> AgradCdfLogLogistic_ffv_110;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_111> AgradCdfLogLogistic_ffv_111;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_112> AgradCdfLogLogistic_ffv_112;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_113> AgradCdfLogLogistic_ffv_113;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_114> AgradCdfLogLogistic_ffv_114;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_115> AgradCdfLogLogistic_ffv_115;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_116> AgradCdfLogLogistic_ffv_116;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_117> AgradCdfLogLogistic_ffv_117;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_118> AgradCdfLogLogistic_ffv_118;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_119> AgradCdfLogLogistic_ffv_119;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_120> AgradCdfLogLogistic_ffv_120;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_121> AgradCdfLogLogistic_ffv_121;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_122> AgradCdfLogLogistic_ffv_122;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_123> AgradCdfLogLogistic_ffv_123;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_124> AgradCdfLogLogistic_ffv_124;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_125> AgradCdfLogLogistic_ffv_125;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_126> AgradCdfLogLogistic_ffv_126;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_127> AgradCdfLogLogistic_ffv_127;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_128> AgradCdfLogLogistic_ffv_128;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_129> AgradCdfLogLogistic_ffv_129;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_130> AgradCdfLogLogistic_ffv_130;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_131> AgradCdfLogLogistic_ffv_131;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_132> AgradCdfLogLogistic_ffv_132;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_133> AgradCdfLogLogistic_ffv_133;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_134> AgradCdfLogLogistic_ffv_134;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_135> AgradCdfLogLogistic_ffv_135;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_136> AgradCdfLogLogistic_ffv_136;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_137> AgradCdfLogLogistic_ffv_137;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_138> AgradCdfLogLogistic_ffv_138;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_139> AgradCdfLogLogistic_ffv_139;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_140> AgradCdfLogLogistic_ffv_140;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_141> AgradCdfLogLogistic_ffv_141;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_142> AgradCdfLogLogistic_ffv_142;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_143> AgradCdfLogLogistic_ffv_143;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_144> AgradCdfLogLogistic_ffv_144;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_145> AgradCdfLogLogistic_ffv_145;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_146> AgradCdfLogLogistic_ffv_146;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_147> AgradCdfLogLogistic_ffv_147;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_148> AgradCdfLogLogistic_ffv_148;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_149> AgradCdfLogLogistic_ffv_149;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_150> AgradCdfLogLogistic_ffv_150;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_151> AgradCdfLogLogistic_ffv_151;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_152> AgradCdfLogLogistic_ffv_152;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_153> AgradCdfLogLogistic_ffv_153;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_154> AgradCdfLogLogistic_ffv_154;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_155> AgradCdfLogLogistic_ffv_155;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_156> AgradCdfLogLogistic_ffv_156;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_157> AgradCdfLogLogistic_ffv_157;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_158> AgradCdfLogLogistic_ffv_158;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_159> AgradCdfLogLogistic_ffv_159;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_160> AgradCdfLogLogistic_ffv_160;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_161> AgradCdfLogLogistic_ffv_161;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_162> AgradCdfLogLogistic_ffv_162;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_163> AgradCdfLogLogistic_ffv_163;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_164> AgradCdfLogLogistic_ffv_164;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_165> AgradCdfLogLogistic_ffv_165;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_166> AgradCdfLogLogistic_ffv_166;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_167> AgradCdfLogLogistic_ffv_167;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_168> AgradCdfLogLogistic_ffv_168;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_169> AgradCdfLogLogistic_ffv_169;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_170> AgradCdfLogLogistic_ffv_170;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_171> AgradCdfLogLogistic_ffv_171;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_172> AgradCdfLogLogistic_ffv_172;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_173> AgradCdfLogLogistic_ffv_173;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_174> AgradCdfLogLogistic_ffv_174;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_175> AgradCdfLogLogistic_ffv_175;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_176> AgradCdfLogLogistic_ffv_176;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_177> AgradCdfLogLogistic_ffv_177;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_178> AgradCdfLogLogistic_ffv_178;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_179> AgradCdfLogLogistic_ffv_179;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_180> AgradCdfLogLogistic_ffv_180;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_181> AgradCdfLogLogistic_ffv_181;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_182> AgradCdfLogLogistic_ffv_182;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_183> AgradCdfLogLogistic_ffv_183;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_184> AgradCdfLogLogistic_ffv_184;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_185> AgradCdfLogLogistic_ffv_185;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_186> AgradCdfLogLogistic_ffv_186;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_187> AgradCdfLogLogistic_ffv_187;
+typedef std::tuple<AgradCdfLogLogistic, type_ffv_188> AgradCdfLogLogistic_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_100, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_101, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_102, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_103, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_104, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_105, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_106, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_107, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_108, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_109, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_110, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_111, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_112, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_113, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_114, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_115, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_116, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_117, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_118, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_119, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_120, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_121, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_122, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_123, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_124, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_125, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_126, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_127, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_128, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_129, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_130, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_131, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_132, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_133, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_134, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_135, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_136, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_137, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_138, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_139, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_140, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_141, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_142, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_143, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_144, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_145, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_146, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_147, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_148, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_149, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_150, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_151, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_152, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_153, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_154, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_155, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_156, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_157, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_158, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_159, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_160, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_161, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_162, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_163, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_164, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_165, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_166, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_167, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_168, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_169, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_170, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_171, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_172, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_173, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_174, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_175, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_176, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_177, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_178, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_179, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_180, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_181, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_182, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_183, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_184, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_185, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_186, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_187, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_ffv_188, AgradCdfLogTestFixture, AgradCdfLogLogistic_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogLogistic, type_v_100> AgradCdfLogLogistic_v_100;
+typedef std::tuple<AgradCdfLogLogistic, type_v_101> AgradCdfLogLogistic_v_101;
+typedef std::tuple<AgradCdfLogLogistic, type_v_102> AgradCdfLogLogistic_v_102;
+typedef std::tuple<AgradCdfLogLogistic, type_v_103> AgradCdfLogLogistic_v_103;
+typedef std::tuple<AgradCdfLogLogistic, type_v_104> AgradCdfLogLogistic_v_104;
+typedef std::tuple<AgradCdfLogLogistic, type_v_105> AgradCdfLogLogistic_v_105;
+typedef std::tuple<AgradCdfLogLogistic, type_v_106> AgradCdfLogLogistic_v_106;
+typedef std::tuple<AgradCdfLogLogistic, type_v_107> AgradCdfLogLogistic_v_107;
+typedef std::tuple<AgradCdfLogLogistic, type_v_108> AgradCdfLogLogistic_v_108;
+typedef std::tuple<AgradCdfLogLogistic, type_v_109> AgradCdfLogLogistic_v_109;
+typedef std::tuple<AgradCdfLogLogistic, type_v_110> AgradCdfLogLogistic_v_110;
+typedef std::tuple<AgradCdfLogLogistic, type_v_111> AgradCdfLogLogistic_v_111;
+typedef std::tuple<AgradCdfLogLogistic, type_v_112> AgradCdfLogLogistic_v_112;
+typedef std::tuple<AgradCdfLogLogistic, type_v_113> AgradCdfLogLogistic_v_113;
+typedef std::tuple<AgradCdfLogLogistic, type_v_114> AgradCdfLogLogistic_v_114;
+typedef std::tuple<AgradCdfLogLogistic, type_v_115> AgradCdfLogLogistic_v_115;
+typedef std::tuple<AgradCdfLogLogistic, type_v_116> AgradCdfLogLogistic_v_116;
+typedef std::tuple<AgradCdfLogLogistic, type_v_117> AgradCdfLogLogistic_v_117;
+typedef std::tuple<AgradCdfLogLogistic, type_v_118> AgradCdfLogLogistic_v_118;
+typedef std::tuple<AgradCdfLogLogistic, type_v_119> AgradCdfLogLogistic_v_119;
+typedef std::tuple<AgradCdfLogLogistic, type_v_120> AgradCdfLogLogistic_v_120;
+typedef std::tuple<AgradCdfLogLogistic, type_v_121> AgradCdfLogLogistic_v_121;
+typedef std::tuple<AgradCdfLogLogistic, type_v_122> AgradCdfLogLogistic_v_122;
+typedef std::tuple<AgradCdfLogLogistic, type_v_123> AgradCdfLogLogistic_v_123;
+typedef std::tuple<AgradCdfLogLogistic, type_v_124> AgradCdfLogLogistic_v_124;
+typedef std::tuple<AgradCdfLogLogistic, type_v_125> AgradCdfLogLogistic_v_125;
+typedef std::tuple<AgradCdfLogLogistic, type_v_126> AgradCdfLogLogistic_v_126;
+typedef std::tuple<AgradCdfLogLogistic, type_v_127> AgradCdfLogLogistic_v_127;
+typedef std::tuple<AgradCdfLogLogistic, type_v_128> AgradCdfLogLogistic_v_128;
+typedef std::tuple<AgradCdfLogLogistic, type_v_129> AgradCdfLogLogistic_v_129;
+typedef std::tuple<AgradCdfLogLogistic, type_v_130> AgradCdfLogLogistic_v_130;
+typedef std::tuple<AgradCdfLogLogistic, type_v_131> AgradCdfLogLogistic_v_131;
+typedef std::tuple<AgradCdfLogLogistic, type_v_132> AgradCdfLogLogistic_v_132;
+typedef std::tuple<AgradCdfLogLogistic, type_v_133> AgradCdfLogLogistic_v_133;
+typedef std::tuple<AgradCdfLogLogistic, type_v_134> AgradCdfLogLogistic_v_134;
+typedef std::tuple<AgradCdfLogLogistic, type_v_135> AgradCdfLogLogistic_v_135;
+typedef std::tuple<AgradCdfLogLogistic, type_v_136> AgradCdfLogLogistic_v_136;
+typedef std::tuple<AgradCdfLogLogistic, type_v_137> AgradCdfLogLogistic_v_137;
+typedef std::tuple<AgradCdfLogLogistic, type_v_138> AgradCdfLogLogistic_v_138;
+typedef std::tuple<AgradCdfLogLogistic, type_v_139> AgradCdfLogLogistic_v_139;
+typedef std::tuple<AgradCdfLogLogistic, type_v_140> AgradCdfLogLogistic_v_140;
+typedef std::tuple<AgradCdfLogLogistic, type_v_141> AgradCdfLogLogistic_v_141;
+typedef std::tuple<AgradCdfLogLogistic, type_v_142> AgradCdfLogLogistic_v_142;
+typedef std::tuple<AgradCdfLogLogistic, type_v_143> AgradCdfLogLogistic_v_143;
+typedef std::tuple<AgradCdfLogLogistic, type_v_144> AgradCdfLogLogistic_v_144;
+typedef std::tuple<AgradCdfLogLogistic, type_v_145> AgradCdfLogLogistic_v_145;
+typedef std::tuple<AgradCdfLogLogistic, type_v_146> AgradCdfLogLogistic_v_146;
+typedef std::tuple<AgradCdfLogLogistic, type_v_147> AgradCdfLogLogistic_v_147;
+typedef std::tuple<AgradCdfLogLogistic, type_v_148> AgradCdfLogLogistic_v_148;
+typedef std::tuple<AgradCdfLogLogistic, type_v_149> AgradCdfLogLogistic_v_149;
+typedef std::tuple<AgradCdfLogLogistic, type_v_150> AgradCdfLogLogistic_v_150;
+typedef std::tuple<AgradCdfLogLogistic, type_v_151> AgradCdfLogLogistic_v_151;
+typedef std::tuple<AgradCdfLogLogistic, type_v_152> AgradCdfLogLogistic_v_152;
+typedef std::tuple<AgradCdfLogLogistic, type_v_153> AgradCdfLogLogistic_v_153;
+typedef std::tuple<AgradCdfLogLogistic, type_v_154> AgradCdfLogLogistic_v_154;
+typedef std::tuple<AgradCdfLogLogistic, type_v_155> AgradCdfLogLogistic_v_155;
+typedef std::tuple<AgradCdfLogLogistic, type_v_156> AgradCdfLogLogistic_v_156;
+typedef std::tuple<AgradCdfLogLogistic, type_v_157> AgradCdfLogLogistic_v_157;
+typedef std::tuple<AgradCdfLogLogistic, type_v_158> AgradCdfLogLogistic_v_158;
+typedef std::tuple<AgradCdfLogLogistic, type_v_159> AgradCdfLogLogistic_v_159;
+typedef std::tuple<AgradCdfLogLogistic, type_v_160> AgradCdfLogLogistic_v_160;
+typedef std::tuple<AgradCdfLogLogistic, type_v_161> AgradCdfLogLogistic_v_161;
+typedef std::tuple<AgradCdfLogLogistic, type_v_162> AgradCdfLogLogistic_v_162;
+typedef std::tuple<AgradCdfLogLogistic, type_v_163> AgradCdfLogLogistic_v_163;
+typedef std::tuple<AgradCdfLogLogistic, type_v_164> AgradCdfLogLogistic_v_164;
+typedef std::tuple<AgradCdfLogLogistic, type_v_165> AgradCdfLogLogistic_v_165;
+typedef std::tuple<AgradCdfLogLogistic, type_v_166> AgradCdfLogLogistic_v_166;
+typedef std::tuple<AgradCdfLogLogistic, type_v_167> AgradCdfLogLogistic_v_167;
+typedef std::tuple<AgradCdfLogLogistic, type_v_168> AgradCdfLogLogistic_v_168;
+typedef std::tuple<AgradCdfLogLogistic, type_v_169> AgradCdfLogLogistic_v_169;
+typedef std::tuple<AgradCdfLogLogistic, type_v_170> AgradCdfLogLogistic_v_170;
+typedef std::tuple<AgradCdfLogLogistic, type_v_171> AgradCdfLogLogistic_v_171;
+typedef std::tuple<AgradCdfLogLogistic, type_v_172> AgradCdfLogLogistic_v_172;
+typedef std::tuple<AgradCdfLogLogistic, type_v_173> AgradCdfLogLogistic_v_173;
+typedef std::tuple<AgradCdfLogLogistic, type_v_174> AgradCdfLogLogistic_v_174;
+typedef std::tuple<AgradCdfLogLogistic, type_v_175> AgradCdfLogLogistic_v_175;
+typedef std::tuple<AgradCdfLogLogistic, type_v_176> AgradCdfLogLogistic_v_176;
+typedef std::tuple<AgradCdfLogLogistic, type_v_177> AgradCdfLogLogistic_v_177;
+typedef std::tuple<AgradCdfLogLogistic, type_v_178> AgradCdfLogLogistic_v_178;
+typedef std::tuple<AgradCdfLogLogistic, type_v_179> AgradCdfLogLogistic_v_179;
+typedef std::tuple<AgradCdfLogLogistic, type_v_180> AgradCdfLogLogistic_v_180;
+typedef std::tuple<AgradCdfLogLogistic, type_v_181> AgradCdfLogLogistic_v_181;
+typedef std::tuple<AgradCdfLogLogistic, type_v_182> AgradCdfLogLogistic_v_182;
+typedef std::tuple<AgradCdfLogLogistic, type_v_183> AgradCdfLogLogistic_v_183;
+typedef std::tuple<AgradCdfLogLogistic, type_v_184> AgradCdfLogLogistic_v_184;
+typedef std::tuple<AgradCdfLogLogistic, type_v_185> AgradCdfLogLogistic_v_185;
+typedef std::tuple<AgradCdfLogLogistic, type_v_186> AgradCdfLogLogistic_v_186;
+typedef std::tuple<AgradCdfLogLogistic, type_v_187> AgradCdfLogLogistic_v_187;
+typedef std::tuple<AgradCdfLogLogistic, type_v_188> AgradCdfLogLogistic_v_188;
+typedef std::tuple<AgradCdfLogLogistic, type_v_189> AgradCdfLogLogistic_v_189;
+typedef std::tuple<AgradCdfLogLogistic, type_v_190> AgradCdfLogLogistic_v_190;
+typedef std::tuple<AgradCdfLogLogistic, type_v_191> AgradCdfLogLogistic_v_191;
+typedef std::tuple<AgradCdfLogLogistic, type_v_192> AgradCdfLogLogistic_v_192;
+typedef std::tuple<AgradCdfLogLogistic, type_v_193> AgradCdfLogLogistic_v_193;
+typedef std::tuple<AgradCdfLogLogistic, type_v_194> AgradCdfLogLogistic_v_194;
+typedef std::tuple<AgradCdfLogLogistic, type_v_195> AgradCdfLogLogistic_v_195;
+typedef std::tuple<AgradCdfLogLogistic, type_v_196> AgradCdfLogLogistic_v_196;
+typedef std::tuple<AgradCdfLogLogistic, type_v_197> AgradCdfLogLogistic_v_197;
+typedef std::tuple<AgradCdfLogLogistic, type_v_198> AgradCdfLogLogistic_v_198;
+typedef std::tuple<AgradCdfLogLogistic, type_v_199> AgradCdfLogLogistic_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_100, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_101, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_102, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_103, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_104, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_105, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_106, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_107, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_108, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_109, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_110, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_111, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_112, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_113, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_114, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_115, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_116, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_117, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_118, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_119, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_120, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_121, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_122, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_123, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_124, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_125, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_126, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_127, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_128, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_129, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_130, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_131, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_132, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_133, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_134, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_135, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_136, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_137, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_138, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_139, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_140, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_141, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_142, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_143, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_144, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_145, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_146, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_147, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_148, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_149, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_150, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_151, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_152, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_153, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_154, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_155, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_156, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_157, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_158, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_159, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_160, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_161, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_162, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_163, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_164, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_165, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_166, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_167, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_168, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_169, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_170, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_171, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_172, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_173, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_174, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_175, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_176, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_177, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_178, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_179, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_180, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_181, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_182, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_183, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_184, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_185, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_186, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_187, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_188, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_189, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_190, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_191, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_192, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_193, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_194, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_195, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_196, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_197, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_198, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_v_199, AgradCdfLogTestFixture, AgradCdfLogLogistic_v_199);
+
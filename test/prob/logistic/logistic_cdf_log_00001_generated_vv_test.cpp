@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/logistic/logistic_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogLogistic, type_vv_100> AgradCdfLogLogistic_vv_100;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_101> AgradCdfLogLogistic_vv_101;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_102> AgradCdfLogLogistic_vv_102;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_103> AgradCdfLogLogistic_vv_103;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_104> AgradCdfLogLogistic_vv_104;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_105> AgradCdfLogLogistic_vv_105;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_106> AgradCdfLogLogistic_vv_106;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_107> AgradCdfLogLogistic_vv_107;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_108> AgradCdfLogLogistic_vv_108;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_109> AgradCdfLogLogistic_vv_109;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_110> AgradCdfLogLogistic_vv_110;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_111> AgradCdfLogLogistic_vv_111;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_112> AgradCdfLogLogistic_vv_112;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_113> AgradCdfLogLogistic_vv_113;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_114> AgradCdfLogLogistic_vv_114;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_115> AgradCdfLogLogistic_vv_115;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_116> AgradCdfLogLogistic_vv_116;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_117> AgradCdfLogLogistic_vv_117;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_118> AgradCdfLogLogistic_vv_118;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_119> AgradCdfLogLogistic_vv_119;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_120> AgradCdfLogLogistic_vv_120;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_121> AgradCdfLogLogistic_vv_121;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_122> AgradCdfLogLogistic_vv_122;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_123> AgradCdfLogLogistic_vv_123;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_124> AgradCdfLogLogistic_vv_124;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_125> AgradCdfLogLogistic_vv_125;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_126> AgradCdfLogLogistic_vv_126;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_127> AgradCdfLogLogistic_vv_127;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_128> AgradCdfLogLogistic_vv_128;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_129> AgradCdfLogLogistic_vv_129;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_130> AgradCdfLogLogistic_vv_130;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_131> AgradCdfLogLogistic_vv_131;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_132> AgradCdfLogLogistic_vv_132;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_133> AgradCdfLogLogistic_vv_133;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_134> AgradCdfLogLogistic_vv_134;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_135> AgradCdfLogLogistic_vv_135;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_136> AgradCdfLogLogistic_vv_136;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_137> AgradCdfLogLogistic_vv_137;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_138> AgradCdfLogLogistic_vv_138;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_139> AgradCdfLogLogistic_vv_139;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_140> AgradCdfLogLogistic_vv_140;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_141> AgradCdfLogLogistic_vv_141;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_142> AgradCdfLogLogistic_vv_142;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_143> AgradCdfLogLogistic_vv_143;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_144> AgradCdfLogLogistic_vv_144;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_145> AgradCdfLogLogistic_vv_145;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_146> AgradCdfLogLogistic_vv_146;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_147> AgradCdfLogLogistic_vv_147;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_148> AgradCdfLogLogistic_vv_148;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_149> AgradCdfLogLogistic_vv_149;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_150> AgradCdfLogLogistic_vv_150;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_151> AgradCdfLogLogistic_vv_151;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_152> AgradCdfLogLogistic_vv_152;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_153> AgradCdfLogLogistic_vv_153;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_154> AgradCdfLogLogistic_vv_154;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_155> AgradCdfLogLogistic_vv_155;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_156> AgradCdfLogLogistic_vv_156;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_157> AgradCdfLogLogistic_vv_157;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_158> AgradCdfLogLogistic_vv_158;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_159> AgradCdfLogLogistic_vv_159;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_160> AgradCdfLogLogistic_vv_160;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_161> AgradCdfLogLogistic_vv_161;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_162> AgradCdfLogLogistic_vv_162;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_163> AgradCdfLogLogistic_vv_163;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_164> AgradCdfLogLogistic_vv_164;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_165> AgradCdfLogLogistic_vv_165;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_166> AgradCdfLogLogistic_vv_166;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_167> AgradCdfLogLogistic_vv_167;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_168> AgradCdfLogLogistic_vv_168;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_169> AgradCdfLogLogistic_vv_169;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_170> AgradCdfLogLogistic_vv_170;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_171> AgradCdfLogLogistic_vv_171;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_172> AgradCdfLogLogistic_vv_172;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_173> AgradCdfLogLogistic_vv_173;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_174> AgradCdfLogLogistic_vv_174;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_175> AgradCdfLogLogistic_vv_175;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_176> AgradCdfLogLogistic_vv_176;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_177> AgradCdfLogLogistic_vv_177;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_178> AgradCdfLogLogistic_vv_178;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_179> AgradCdfLogLogistic_vv_179;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_180> AgradCdfLogLogistic_vv_180;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_181> AgradCdfLogLogistic_vv_181;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_182> AgradCdfLogLogistic_vv_182;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_183> AgradCdfLogLogistic_vv_183;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_184> AgradCdfLogLogistic_vv_184;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_185> AgradCdfLogLogistic_vv_185;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_186> AgradCdfLogLogistic_vv_186;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_187> AgradCdfLogLogistic_vv_187;
+typedef std::tuple<AgradCdfLogLogistic, type_vv_188> AgradCdfLogLogistic_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_100, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_101, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_102, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_103, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_104, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_105, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_106, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_107, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_108, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_109, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_110, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_111, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_112, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_113, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_114, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_115, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_116, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_117, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_118, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_119, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_120, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_121, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_122, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_123, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_124, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_125, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_126, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_127, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_128, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_129, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_130, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_131, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_132, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_133, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_134, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_135, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_136, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_137, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_138, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_139, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_140, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_141, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_142, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_143, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_144, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_145, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_146, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_147, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_148, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_149, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_150, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_151, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_152, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_153, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_154, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_155, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_156, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_157, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_158, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_159, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_160, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_161, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_162, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_163, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_164, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_165, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_166, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_167, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_168, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_169, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_170, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_171, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_172, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_173, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_174, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_175, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_176, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_177, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_178, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_179, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_180, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_181, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_182, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_183, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_184, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_185, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_186, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_187, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLogistic_vv_188, AgradCdfLogTestFixture, AgradCdfLogLogistic_vv_188);
+
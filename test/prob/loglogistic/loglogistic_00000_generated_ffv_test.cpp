@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/loglogistic/loglogistic_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_0> AgradDistributionsLoglogistic_ffv_0;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_1> AgradDistributionsLoglogistic_ffv_1;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_2> AgradDistributionsLoglogistic_ffv_2;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_3> AgradDistributionsLoglogistic_ffv_3;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_4> AgradDistributionsLoglogistic_ffv_4;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_5> AgradDistributionsLoglogistic_ffv_5;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_6> AgradDistributionsLoglogistic_ffv_6;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_7> AgradDistributionsLoglogistic_ffv_7;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_8> AgradDistributionsLoglogistic_ffv_8;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_9> AgradDistributionsLoglogistic_ffv_9;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_10> AgradDistributionsLoglogistic_ffv_10;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_11> AgradDistributionsLoglogistic_ffv_11;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_12> AgradDistributionsLoglogistic_ffv_12;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_13> AgradDistributionsLoglogistic_ffv_13;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_14> AgradDistributionsLoglogistic_ffv_14;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_15> AgradDistributionsLoglogistic_ffv_15;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_16> AgradDistributionsLoglogistic_ffv_16;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_17> AgradDistributionsLoglogistic_ffv_17;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_18> AgradDistributionsLoglogistic_ffv_18;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_19> AgradDistributionsLoglogistic_ffv_19;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_20> AgradDistributionsLoglogistic_ffv_20;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_21> AgradDistributionsLoglogistic_ffv_21;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_22> AgradDistributionsLoglogistic_ffv_22;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_23> AgradDistributionsLoglogistic_ffv_23;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_24> AgradDistributionsLoglogistic_ffv_24;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_25> AgradDistributionsLoglogistic_ffv_25;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_26> AgradDistributionsLoglogistic_ffv_26;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_27> AgradDistributionsLoglogistic_ffv_27;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_28> AgradDistributionsLoglogistic_ffv_28;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_29> AgradDistributionsLoglogistic_ffv_29;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_30> AgradDistributionsLoglogistic_ffv_30;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_31> AgradDistributionsLoglogistic_ffv_31;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_32> AgradDistributionsLoglogistic_ffv_32;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_33> AgradDistributionsLoglogistic_ffv_33;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_34> AgradDistributionsLoglogistic_ffv_34;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_35> AgradDistributionsLoglogistic_ffv_35;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_36> AgradDistributionsLoglogistic_ffv_36;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_37> AgradDistributionsLoglogistic_ffv_37;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_38> AgradDistributionsLoglogistic_ffv_38;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_39> AgradDistributionsLoglogistic_ffv_39;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_40> AgradDistributionsLoglogistic_ffv_40;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_41> AgradDistributionsLoglogistic_ffv_41;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_42> AgradDistributionsLoglogistic_ffv_42;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_43> AgradDistributionsLoglogistic_ffv_43;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_44> AgradDistributionsLoglogistic_ffv_44;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_45> AgradDistributionsLoglogistic_ffv_45;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_46> AgradDistributionsLoglogistic_ffv_46;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_47> AgradDistributionsLoglogistic_ffv_47;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_48> AgradDistributionsLoglogistic_ffv_48;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_49> AgradDistributionsLoglogistic_ffv_49;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_50> AgradDistributionsLoglogistic_ffv_50;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_51> AgradDistributionsLoglogistic_ffv_51;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_52> AgradDistributionsLoglogistic_ffv_52;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_53> AgradDistributionsLoglogistic_ffv_53;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_54> AgradDistributionsLoglogistic_ffv_54;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_55> AgradDistributionsLoglogistic_ffv_55;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_56> AgradDistributionsLoglogistic_ffv_56;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_57> AgradDistributionsLoglogistic_ffv_57;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_58> AgradDistributionsLoglogistic_ffv_58;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_59> AgradDistributionsLoglogistic_ffv_59;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_60> AgradDistributionsLoglogistic_ffv_60;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_61> AgradDistributionsLoglogistic_ffv_61;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_62> AgradDistributionsLoglogistic_ffv_62;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_63> AgradDistributionsLoglogistic_ffv_63;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_64> AgradDistributionsLoglogistic_ffv_64;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_65> AgradDistributionsLoglogistic_ffv_65;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_66> AgradDistributionsLoglogistic_ffv_66;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_67> AgradDistributionsLoglogistic_ffv_67;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_68> AgradDistributionsLoglogistic_ffv_68;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_69> AgradDistributionsLoglogistic_ffv_69;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_70> AgradDistributionsLoglogistic_ffv_70;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_71> AgradDistributionsLoglogistic_ffv_71;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_72> AgradDistributionsLoglogistic_ffv_72;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_73> AgradDistributionsLoglogistic_ffv_73;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_74> AgradDistributionsLoglogistic_ffv_74;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_75> AgradDistributionsLoglogistic_ffv_75;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_76> AgradDistributionsLoglogistic_ffv_76;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_77> AgradDistributionsLoglogistic_ffv_77;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_78> AgradDistributionsLoglogistic_ffv_78;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_79> AgradDistributionsLoglogistic_ffv_79;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_80> AgradDistributionsLoglogistic_ffv_80;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_81> AgradDistributionsLoglogistic_ffv_81;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_82> AgradDistributionsLoglogistic_ffv_82;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_83> AgradDistributionsLoglogistic_ffv_83;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_84> AgradDistributionsLoglogistic_ffv_84;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_85> AgradDistributionsLoglogistic_ffv_85;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_86> AgradDistributionsLoglogistic_ffv_86;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_87> AgradDistributionsLoglogistic_ffv_87;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_88> AgradDistributionsLoglogistic_ffv_88;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_89> AgradDistributionsLoglogistic_ffv_89;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_90> AgradDistributionsLoglogistic_ffv_90;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_91> AgradDistributionsLoglogistic_ffv_91;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_92> AgradDistributionsLoglogistic_ffv_92;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_93> AgradDistributionsLoglogistic_ffv_93;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_94> AgradDistributionsLoglogistic_ffv_94;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_95> AgradDistributionsLoglogistic_ffv_95;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_96> AgradDistributionsLoglogistic_ffv_96;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_97> AgradDistributionsLoglogistic_ffv_97;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_98> AgradDistributionsLoglogistic_ffv_98;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_99> AgradDistributionsLoglogistic_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_0, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_1, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_2, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_3, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_4, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_5, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_6, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_7, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_8, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_9, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_10, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_11, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_12, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_13, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_14, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_15, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_16, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_17, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_18, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_19, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_20, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_21, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_22, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_23, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_24, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_25, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_26, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_27, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_28, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_29, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_30, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_31, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_32, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_33, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_34, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_35, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_36, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_37, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_38, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_39, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_40, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_41, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_42, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_43, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_44, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_45, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_46, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_47, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_48, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_49, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_50, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_51, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_52, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_53, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_54, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_55, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_56, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_57, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_58, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_59, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_60, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_61, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_62, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_63, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_64, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_65, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_66, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_67, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_68, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_69, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_70, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_71, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_72, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_73, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_74, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_75, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_76, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_77, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_78, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_79, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_80, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_81, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_82, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_83, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_84, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_85, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_86, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_87, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_88, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_89, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_90, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_91, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_92, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_93, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_94, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_95, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_96, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_97, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_98, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_99, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/loglogistic/loglogistic_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_0> AgradDistributionsLoglogistic_v_0;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_1> AgradDistributionsLoglogistic_v_1;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_2> AgradDistributionsLoglogistic_v_2;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_3> AgradDistributionsLoglogistic_v_3;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_4> AgradDistributionsLoglogistic_v_4;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_5> AgradDistributionsLoglogistic_v_5;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_6> AgradDistributionsLoglogistic_v_6;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_7> AgradDistributionsLoglogistic_v_7;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_8> AgradDistributionsLoglogistic_v_8;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_9> AgradDistributionsLoglogistic_v_9;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_10> AgradDistributionsLoglogistic_v_10;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_11> AgradDistributionsLoglogistic_v_11;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_12> AgradDistributionsLoglogistic_v_12;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_13> AgradDistributionsLoglogistic_v_13;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_14> AgradDistributionsLoglogistic_v_14;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_15> AgradDistributionsLoglogistic_v_15;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_16> AgradDistributionsLoglogistic_v_16;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_17> AgradDistributionsLoglogistic_v_17;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_18> AgradDistributionsLoglogistic_v_18;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_19> AgradDistributionsLoglogistic_v_19;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_20> AgradDistributionsLoglogistic_v_20;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_21> AgradDistributionsLoglogistic_v_21;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_22> AgradDistributionsLoglogistic_v_22;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_23> AgradDistributionsLoglogistic_v_23;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_24> AgradDistributionsLoglogistic_v_24;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_25> AgradDistributionsLoglogistic_v_25;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_26> AgradDistributionsLoglogistic_v_26;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_27> AgradDistributionsLoglogistic_v_27;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_28> AgradDistributionsLoglogistic_v_28;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_29> AgradDistributionsLoglogistic_v_29;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_30> AgradDistributionsLoglogistic_v_30;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_31> AgradDistributionsLoglogistic_v_31;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_32> AgradDistributionsLoglogistic_v_32;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_33> AgradDistributionsLoglogistic_v_33;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_34> AgradDistributionsLoglogistic_v_34;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_35> AgradDistributionsLoglogistic_v_35;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_36> AgradDistributionsLoglogistic_v_36;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_37> AgradDistributionsLoglogistic_v_37;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_38> AgradDistributionsLoglogistic_v_38;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_39> AgradDistributionsLoglogistic_v_39;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_40> AgradDistributionsLoglogistic_v_40;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_41> AgradDistributionsLoglogistic_v_41;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_42> AgradDistributionsLoglogistic_v_42;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_43> AgradDistributionsLoglogistic_v_43;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_44> AgradDistributionsLoglogistic_v_44;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_45> AgradDistributionsLoglogistic_v_45;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_46> AgradDistributionsLoglogistic_v_46;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_47> AgradDistributionsLoglogistic_v_47;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_48> AgradDistributionsLoglogistic_v_48;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_49> AgradDistributionsLoglogistic_v_49;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_50> AgradDistributionsLoglogistic_v_50;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_51> AgradDistributionsLoglogistic_v_51;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_52> AgradDistributionsLoglogistic_v_52;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_53> AgradDistributionsLoglogistic_v_53;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_54> AgradDistributionsLoglogistic_v_54;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_55> AgradDistributionsLoglogistic_v_55;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_56> AgradDistributionsLoglogistic_v_56;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_57> AgradDistributionsLoglogistic_v_57;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_58> AgradDistributionsLoglogistic_v_58;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_59> AgradDistributionsLoglogistic_v_59;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_60> AgradDistributionsLoglogistic_v_60;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_61> AgradDistributionsLoglogistic_v_61;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_62> AgradDistributionsLoglogistic_v_62;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_63> AgradDistributionsLoglogistic_v_63;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_64> AgradDistributionsLoglogistic_v_64;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_65> AgradDistributionsLoglogistic_v_65;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_66> AgradDistributionsLoglogistic_v_66;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_67> AgradDistributionsLoglogistic_v_67;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_68> AgradDistributionsLoglogistic_v_68;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_69> AgradDistributionsLoglogistic_v_69;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_70> AgradDistributionsLoglogistic_v_70;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_71> AgradDistributionsLoglogistic_v_71;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_72> AgradDistributionsLoglogistic_v_72;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_73> AgradDistributionsLoglogistic_v_73;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_74> AgradDistributionsLoglogistic_v_74;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_75> AgradDistributionsLoglogistic_v_75;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_76> AgradDistributionsLoglogistic_v_76;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_77> AgradDistributionsLoglogistic_v_77;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_78> AgradDistributionsLoglogistic_v_78;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_79> AgradDistributionsLoglogistic_v_79;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_80> AgradDistributionsLoglogistic_v_80;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_81> AgradDistributionsLoglogistic_v_81;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_82> AgradDistributionsLoglogistic_v_82;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_83> AgradDistributionsLoglogistic_v_83;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_84> AgradDistributionsLoglogistic_v_84;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_85> AgradDistributionsLoglogistic_v_85;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_86> AgradDistributionsLoglogistic_v_86;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_87> AgradDistributionsLoglogistic_v_87;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_88> AgradDistributionsLoglogistic_v_88;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_89> AgradDistributionsLoglogistic_v_89;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_90> AgradDistributionsLoglogistic_v_90;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_91> AgradDistributionsLoglogistic_v_91;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_92> AgradDistributionsLoglogistic_v_92;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_93> AgradDistributionsLoglogistic_v_93;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_94> AgradDistributionsLoglogistic_v_94;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_95> AgradDistributionsLoglogistic_v_95;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_96> AgradDistributionsLoglogistic_v_96;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_97> AgradDistributionsLoglogistic_v_97;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_98> AgradDistributionsLoglogistic_v_98;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_99> AgradDistributionsLoglogistic_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_0, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_1, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_2, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_3, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_4, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_5, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_6, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_7, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_8, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_9, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_10, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_11, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_12, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_13, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_14, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_15, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_16, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_17, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_18, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_19, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_20, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_21, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_22, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_23, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_24, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_25, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_26, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_27, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_28, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_29, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_30, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_31, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_32, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_33, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_34, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_35, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_36, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_37, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_38, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_39, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_40, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_41, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_42, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_43, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_44, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_45, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_46, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_47, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_48, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_49, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_50, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_51, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_52, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_53, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_54, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_55, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_56, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_57, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_58, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_59, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_60, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_61, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_62, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_63, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_64, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_65, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_66, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_67, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_68, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_69, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_70, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_71, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_72, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_73, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_74, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_75, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_76, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_77, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_78, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_79, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_80, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_81, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_82, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_83, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_84, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_85, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_86, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_87, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_88, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_89, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_90, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_91, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_92, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_93, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_94, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_95, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_96, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_97, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_98, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_99, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/loglogistic/loglogistic_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_0> AgradDistributionsLoglogistic_vv_0;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_1> AgradDistributionsLoglogistic_vv_1;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_2> AgradDistributionsLoglogistic_vv_2;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_3> AgradDistributionsLoglogistic_vv_3;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_4> AgradDistributionsLoglogistic_vv_4;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_5> AgradDistributionsLoglogistic_vv_5;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_6> AgradDistributionsLoglogistic_vv_6;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_7> AgradDistributionsLoglogistic_vv_7;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_8> AgradDistributionsLoglogistic_vv_8;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_9> AgradDistributionsLoglogistic_vv_9;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_10> AgradDistributionsLoglogistic_vv_10;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_11> AgradDistributionsLoglogistic_vv_11;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_12> AgradDistributionsLoglogistic_vv_12;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_13> AgradDistributionsLoglogistic_vv_13;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_14> AgradDistributionsLoglogistic_vv_14;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_15> AgradDistributionsLoglogistic_vv_15;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_16> AgradDistributionsLoglogistic_vv_16;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_17> AgradDistributionsLoglogistic_vv_17;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_18> AgradDistributionsLoglogistic_vv_18;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_19> AgradDistributionsLoglogistic_vv_19;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_20> AgradDistributionsLoglogistic_vv_20;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_21> AgradDistributionsLoglogistic_vv_21;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_22> AgradDistributionsLoglogistic_vv_22;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_23> AgradDistributionsLoglogistic_vv_23;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_24> AgradDistributionsLoglogistic_vv_24;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_25> AgradDistributionsLoglogistic_vv_25;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_26> AgradDistributionsLoglogistic_vv_26;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_27> AgradDistributionsLoglogistic_vv_27;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_28> AgradDistributionsLoglogistic_vv_28;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_29> AgradDistributionsLoglogistic_vv_29;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_30> AgradDistributionsLoglogistic_vv_30;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_31> AgradDistributionsLoglogistic_vv_31;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_32> AgradDistributionsLoglogistic_vv_32;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_33> AgradDistributionsLoglogistic_vv_33;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_34> AgradDistributionsLoglogistic_vv_34;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_35> AgradDistributionsLoglogistic_vv_35;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_36> AgradDistributionsLoglogistic_vv_36;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_37> AgradDistributionsLoglogistic_vv_37;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_38> AgradDistributionsLoglogistic_vv_38;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_39> AgradDistributionsLoglogistic_vv_39;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_40> AgradDistributionsLoglogistic_vv_40;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_41> AgradDistributionsLoglogistic_vv_41;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_42> AgradDistributionsLoglogistic_vv_42;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_43> AgradDistributionsLoglogistic_vv_43;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_44> AgradDistributionsLoglogistic_vv_44;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_45> AgradDistributionsLoglogistic_vv_45;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_46> AgradDistributionsLoglogistic_vv_46;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_47> AgradDistributionsLoglogistic_vv_47;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_48> AgradDistributionsLoglogistic_vv_48;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_49> AgradDistributionsLoglogistic_vv_49;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_50> AgradDistributionsLoglogistic_vv_50;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_51> AgradDistributionsLoglogistic_vv_51;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_52> AgradDistributionsLoglogistic_vv_52;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_53> AgradDistributionsLoglogistic_vv_53;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_54> AgradDistributionsLoglogistic_vv_54;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_55> AgradDistributionsLoglogistic_vv_55;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_56> AgradDistributionsLoglogistic_vv_56;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_57> AgradDistributionsLoglogistic_vv_57;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_58> AgradDistributionsLoglogistic_vv_58;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_59> AgradDistributionsLoglogistic_vv_59;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_60> AgradDistributionsLoglogistic_vv_60;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_61> AgradDistributionsLoglogistic_vv_61;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_62> AgradDistributionsLoglogistic_vv_62;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_63> AgradDistributionsLoglogistic_vv_63;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_64> AgradDistributionsLoglogistic_vv_64;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_65> AgradDistributionsLoglogistic_vv_65;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_66> AgradDistributionsLoglogistic_vv_66;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_67> AgradDistributionsLoglogistic_vv_67;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_68> AgradDistributionsLoglogistic_vv_68;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_69> AgradDistributionsLoglogistic_vv_69;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_70> AgradDistributionsLoglogistic_vv_70;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_71> AgradDistributionsLoglogistic_vv_71;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_72> AgradDistributionsLoglogistic_vv_72;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_73> AgradDistributionsLoglogistic_vv_73;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_74> AgradDistributionsLoglogistic_vv_74;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_75> AgradDistributionsLoglogistic_vv_75;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_76> AgradDistributionsLoglogistic_vv_76;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_77> AgradDistributionsLoglogistic_vv_77;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_78> AgradDistributionsLoglogistic_vv_78;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_79> AgradDistributionsLoglogistic_vv_79;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_80> AgradDistributionsLoglogistic_vv_80;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_81> AgradDistributionsLoglogistic_vv_81;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_82> AgradDistributionsLoglogistic_vv_82;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_83> AgradDistributionsLoglogistic_vv_83;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_84> AgradDistributionsLoglogistic_vv_84;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_85> AgradDistributionsLoglogistic_vv_85;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_86> AgradDistributionsLoglogistic_vv_86;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_87> AgradDistributionsLoglogistic_vv_87;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_88> AgradDistributionsLoglogistic_vv_88;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_89> AgradDistributionsLoglogistic_vv_89;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_90> AgradDistributionsLoglogistic_vv_90;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_91> AgradDistributionsLoglogistic_vv_91;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_92> AgradDistributionsLoglogistic_vv_92;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_93> AgradDistributionsLoglogistic_vv_93;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_94> AgradDistributionsLoglogistic_vv_94;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_95> AgradDistributionsLoglogistic_vv_95;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_96> AgradDistributionsLoglogistic_vv_96;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_97> AgradDistributionsLoglogistic_vv_97;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_98> AgradDistributionsLoglogistic_vv_98;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_99> AgradDistributionsLoglogistic_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_0, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_1, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_2, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_3, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_4, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_5, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_6, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_7, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_8, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_9, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_10, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_11, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_12, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_13, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_14, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_15, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_16, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_17, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_18, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_19, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_20, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_21, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_22, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_23, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_24, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_25, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_26, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_27, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_28, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_29, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_30, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_31, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_32, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_33, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_34, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_35, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_36, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_37, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_38, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_39, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_40, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_41, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_42, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_43, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_44, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_45, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_46, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_47, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_48, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_49, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_50, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_51, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_52, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_53, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_54, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_55, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_56, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_57, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_58, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_59, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_60, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_61, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_62, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_63, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_64, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_65, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_66, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_67, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_68, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_69, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_70, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_71, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_72, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_73, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_74, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_75, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_76, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_77, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_78, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_79, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_80, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_81, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_82, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_83, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_84, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_85, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_86, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_87, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_88, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_89, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_90, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_91, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_92, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_93, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_94, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_95, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_96, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_97, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_98, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_99, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/loglogistic/loglogistic_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_100> AgradDistributionsLoglogistic_ffv_100;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_101> AgradDistributionsLoglogistic_ffv_101;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_102> AgradDistributionsLoglogistic_ffv_102;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_103> AgradDistributionsLoglogistic_ffv_103;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_104> AgradDistributionsLoglogistic_ffv_104;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_105> AgradDistributionsLoglogistic_ffv_105;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_106> AgradDistributionsLoglogistic_ffv_106;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_107> AgradDistributionsLoglogistic_ffv_107;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_108> AgradDistributionsLoglogistic_ffv_108;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_109> AgradDistributionsLoglogistic_ffv_109;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_110> AgradDistributionsLoglogistic_ffv_110;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_111> AgradDistributionsLoglogistic_ffv_111;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_112> AgradDistributionsLoglogistic_ffv_112;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_113> AgradDistributionsLoglogistic_ffv_113;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_114> AgradDistributionsLoglogistic_ffv_114;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_115> AgradDistributionsLoglogistic_ffv_115;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_116> AgradDistributionsLoglogistic_ffv_116;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_117> AgradDistributionsLoglogistic_ffv_117;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_118> AgradDistributionsLoglogistic_ffv_118;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_119> AgradDistributionsLoglogistic_ffv_119;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_120> AgradDistributionsLoglogistic_ffv_120;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_121> AgradDistributionsLoglogistic_ffv_121;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_122> AgradDistributionsLoglogistic_ffv_122;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_123> AgradDistributionsLoglogistic_ffv_123;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_124> AgradDistributionsLoglogistic_ffv_124;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_125> AgradDistributionsLoglogistic_ffv_125;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_126> AgradDistributionsLoglogistic_ffv_126;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_127> AgradDistributionsLoglogistic_ffv_127;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_128> AgradDistributionsLoglogistic_ffv_128;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_129> AgradDistributionsLoglogistic_ffv_129;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_130> AgradDistributionsLoglogistic_ffv_130;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_131> AgradDistributionsLoglogistic_ffv_131;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_132> AgradDistributionsLoglogistic_ffv_132;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_133> AgradDistributionsLoglogistic_ffv_133;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_134> AgradDistributionsLoglogistic_ffv_134;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_135> AgradDistributionsLoglogistic_ffv_135;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_136> AgradDistributionsLoglogistic_ffv_136;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_137> AgradDistributionsLoglogistic_ffv_137;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_138> AgradDistributionsLoglogistic_ffv_138;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_139> AgradDistributionsLoglogistic_ffv_139;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_140> AgradDistributionsLoglogistic_ffv_140;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_141> AgradDistributionsLoglogistic_ffv_141;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_142> AgradDistributionsLoglogistic_ffv_142;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_143> AgradDistributionsLoglogistic_ffv_143;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_144> AgradDistributionsLoglogistic_ffv_144;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_145> AgradDistributionsLoglogistic_ffv_145;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_146> AgradDistributionsLoglogistic_ffv_146;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_147> AgradDistributionsLoglogistic_ffv_147;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_148> AgradDistributionsLoglogistic_ffv_148;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_149> AgradDistributionsLoglogistic_ffv_149;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_150> AgradDistributionsLoglogistic_ffv_150;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_151> AgradDistributionsLoglogistic_ffv_151;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_152> AgradDistributionsLoglogistic_ffv_152;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_153> AgradDistributionsLoglogistic_ffv_153;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_154> AgradDistributionsLoglogistic_ffv_154;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_155> AgradDistributionsLoglogistic_ffv_155;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_156> AgradDistributionsLoglogistic_ffv_156;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_157> AgradDistributionsLoglogistic_ffv_157;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_158> AgradDistributionsLoglogistic_ffv_158;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_159> AgradDistributionsLoglogistic_ffv_159;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_160> AgradDistributionsLoglogistic_ffv_160;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_161> AgradDistributionsLoglogistic_ffv_161;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_162> AgradDistributionsLoglogistic_ffv_162;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_163> AgradDistributionsLoglogistic_ffv_163;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_164> AgradDistributionsLoglogistic_ffv_164;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_165> AgradDistributionsLoglogistic_ffv_165;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_166> AgradDistributionsLoglogistic_ffv_166;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_167> AgradDistributionsLoglogistic_ffv_167;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_168> AgradDistributionsLoglogistic_ffv_168;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_169> AgradDistributionsLoglogistic_ffv_169;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_170> AgradDistributionsLoglogistic_ffv_170;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_171> AgradDistributionsLoglogistic_ffv_171;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_172> AgradDistributionsLoglogistic_ffv_172;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_173> AgradDistributionsLoglogistic_ffv_173;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_174> AgradDistributionsLoglogistic_ffv_174;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_175> AgradDistributionsLoglogistic_ffv_175;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_176> AgradDistributionsLoglogistic_ffv_176;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_177> AgradDistributionsLoglogistic_ffv_177;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_178> AgradDistributionsLoglogistic_ffv_178;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_179> AgradDistributionsLoglogistic_ffv_179;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_180> AgradDistributionsLoglogistic_ffv_180;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_181> AgradDistributionsLoglogistic_ffv_181;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_182> AgradDistributionsLoglogistic_ffv_182;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_183> AgradDistributionsLoglogistic_ffv_183;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_184> AgradDistributionsLoglogistic_ffv_184;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_185> AgradDistributionsLoglogistic_ffv_185;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_186> AgradDistributionsLoglogistic_ffv_186;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_187> AgradDistributionsLoglogistic_ffv_187;
+typedef std::tuple<AgradDistributionsLoglogistic, type_ffv_188> AgradDistributionsLoglogistic_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_100, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_101, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_102, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_103, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_104, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_105, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_106, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_107, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_108, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_109, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_110, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_111, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_112, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_113, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_114, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_115, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_116, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_117, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_118, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_119, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_120, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_121, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_122, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_123, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_124, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_125, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_126, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_127, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_128, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_129, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_130, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_131, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_132, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_133, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_134, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_135, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_136, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_137, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_138, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_139, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_140, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_141, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_142, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_143, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_144, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_145, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_146, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_147, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_148, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_149, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_150, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_151, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_152, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_153, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_154, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_155, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_156, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_157, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_158, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_159, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_160, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_161, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_162, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_163, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_164, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_165, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_166, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_167, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_168, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_169, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_170, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_171, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_172, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_173, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_174, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_175, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_176, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_177, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_178, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_179, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_180, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_181, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_182, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_183, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_184, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_185, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_186, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_187, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_ffv_188, AgradDistributionTestFixture, AgradDistributionsLoglogistic_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/loglogistic/loglogistic_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_100> AgradDistributionsLoglogistic_v_100;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_101> AgradDistributionsLoglogistic_v_101;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_102> AgradDistributionsLoglogistic_v_102;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_103> AgradDistributionsLoglogistic_v_103;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_104> AgradDistributionsLoglogistic_v_104;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_105> AgradDistributionsLoglogistic_v_105;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_106> AgradDistributionsLoglogistic_v_106;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_107> AgradDistributionsLoglogistic_v_107;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_108> AgradDistributionsLoglogistic_v_108;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_109> AgradDistributionsLoglogistic_v_109;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_110> AgradDistributionsLoglogistic_v_110;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_111> AgradDistributionsLoglogistic_v_111;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_112> AgradDistributionsLoglogistic_v_112;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_113> AgradDistributionsLoglogistic_v_113;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_114> AgradDistributionsLoglogistic_v_114;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_115> AgradDistributionsLoglogistic_v_115;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_116> AgradDistributionsLoglogistic_v_116;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_117> AgradDistributionsLoglogistic_v_117;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_118> AgradDistributionsLoglogistic_v_118;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_119> AgradDistributionsLoglogistic_v_119;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_120> AgradDistributionsLoglogistic_v_120;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_121> AgradDistributionsLoglogistic_v_121;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_122> AgradDistributionsLoglogistic_v_122;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_123> AgradDistributionsLoglogistic_v_123;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_124> AgradDistributionsLoglogistic_v_124;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_125> AgradDistributionsLoglogistic_v_125;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_126> AgradDistributionsLoglogistic_v_126;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_127> AgradDistributionsLoglogistic_v_127;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_128> AgradDistributionsLoglogistic_v_128;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_129> AgradDistributionsLoglogistic_v_129;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_130> AgradDistributionsLoglogistic_v_130;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_131> AgradDistributionsLoglogistic_v_131;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_132> AgradDistributionsLoglogistic_v_132;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_133> AgradDistributionsLoglogistic_v_133;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_134> AgradDistributionsLoglogistic_v_134;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_135> AgradDistributionsLoglogistic_v_135;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_136> AgradDistributionsLoglogistic_v_136;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_137> AgradDistributionsLoglogistic_v_137;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_138> AgradDistributionsLoglogistic_v_138;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_139> AgradDistributionsLoglogistic_v_139;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_140> AgradDistributionsLoglogistic_v_140;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_141> AgradDistributionsLoglogistic_v_141;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_142> AgradDistributionsLoglogistic_v_142;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_143> AgradDistributionsLoglogistic_v_143;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_144> AgradDistributionsLoglogistic_v_144;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_145> AgradDistributionsLoglogistic_v_145;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_146> AgradDistributionsLoglogistic_v_146;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_147> AgradDistributionsLoglogistic_v_147;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_148> AgradDistributionsLoglogistic_v_148;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_149> AgradDistributionsLoglogistic_v_149;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_150> AgradDistributionsLoglogistic_v_150;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_151> AgradDistributionsLoglogistic_v_151;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_152> AgradDistributionsLoglogistic_v_152;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_153> AgradDistributionsLoglogistic_v_153;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_154> AgradDistributionsLoglogistic_v_154;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_155> AgradDistributionsLoglogistic_v_155;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_156> AgradDistributionsLoglogistic_v_156;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_157> AgradDistributionsLoglogistic_v_157;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_158> AgradDistributionsLoglogistic_v_158;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_159> AgradDistributionsLoglogistic_v_159;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_160> AgradDistributionsLoglogistic_v_160;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_161> AgradDistributionsLoglogistic_v_161;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_162> AgradDistributionsLoglogistic_v_162;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_163> AgradDistributionsLoglogistic_v_163;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_164> AgradDistributionsLoglogistic_v_164;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_165> AgradDistributionsLoglogistic_v_165;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_166> AgradDistributionsLoglogistic_v_166;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_167> AgradDistributionsLoglogistic_v_167;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_168> AgradDistributionsLoglogistic_v_168;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_169> AgradDistributionsLoglogistic_v_169;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_170> AgradDistributionsLoglogistic_v_170;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_171> AgradDistributionsLoglogistic_v_171;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_172> AgradDistributionsLoglogistic_v_172;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_173> AgradDistributionsLoglogistic_v_173;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_174> AgradDistributionsLoglogistic_v_174;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_175> AgradDistributionsLoglogistic_v_175;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_176> AgradDistributionsLoglogistic_v_176;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_177> AgradDistributionsLoglogistic_v_177;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_178> AgradDistributionsLoglogistic_v_178;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_179> AgradDistributionsLoglogistic_v_179;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_180> AgradDistributionsLoglogistic_v_180;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_181> AgradDistributionsLoglogistic_v_181;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_182> AgradDistributionsLoglogistic_v_182;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_183> AgradDistributionsLoglogistic_v_183;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_184> AgradDistributionsLoglogistic_v_184;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_185> AgradDistributionsLoglogistic_v_185;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_186> AgradDistributionsLoglogistic_v_186;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_187> AgradDistributionsLoglogistic_v_187;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_188> AgradDistributionsLoglogistic_v_188;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_189> AgradDistributionsLoglogistic_v_189;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_190> AgradDistributionsLoglogistic_v_190;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_191> AgradDistributionsLoglogistic_v_191;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_192> AgradDistributionsLoglogistic_v_192;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_193> AgradDistributionsLoglogistic_v_193;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_194> AgradDistributionsLoglogistic_v_194;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_195> AgradDistributionsLoglogistic_v_195;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_196> AgradDistributionsLoglogistic_v_196;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_197> AgradDistributionsLoglogistic_v_197;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_198> AgradDistributionsLoglogistic_v_198;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_199> AgradDistributionsLoglogistic_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_100, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_101, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_102, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_103, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_104, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_105, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_106, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_107, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_108, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_109, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_110, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_111, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_112, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_113, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_114, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_115, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_116, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_117, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_118, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_119, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_120, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_121, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_122, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_123, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_124, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_125, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_126, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_127, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_128, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_129, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_130, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_131, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_132, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_133, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_134, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_135, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_136, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_137, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_138, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_139, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_140, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_141, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_142, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_143, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_144, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_145, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_146, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_147, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_148, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_149, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_150, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_151, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_152, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_153, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_154, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_155, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_156, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_157, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_158, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_159, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_160, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_161, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_162, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_163, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_164, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_165, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_166, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_167, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_168, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_169, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_170, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_171, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_172, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_173, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_174, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_175, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_176, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_177, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_178, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_179, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_180, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_181, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_182, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_183, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_184, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_185, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_186, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_187, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_188, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_189, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_190, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_191, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_192, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_193, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_194, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_195, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_196, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_197, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_198, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_199, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/loglogistic/loglogistic_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_100> AgradDistributionsLoglogistic_vv_100;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_101> AgradDistributionsLoglogistic_vv_101;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_102> AgradDistributionsLoglogistic_vv_102;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_103> AgradDistributionsLoglogistic_vv_103;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_104> AgradDistributionsLoglogistic_vv_104;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_105> AgradDistributionsLoglogistic_vv_105;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_106> AgradDistributionsLoglogistic_vv_106;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_107> AgradDistributionsLoglogistic_vv_107;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_108> AgradDistributionsLoglogistic_vv_108;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_109> AgradDistributionsLoglogistic_vv_109;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_110> AgradDistributionsLoglogistic_vv_110;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_111> AgradDistributionsLoglogistic_vv_111;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_112> AgradDistributionsLoglogistic_vv_112;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_113> AgradDistributionsLoglogistic_vv_113;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_114> AgradDistributionsLoglogistic_vv_114;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_115> AgradDistributionsLoglogistic_vv_115;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_116> AgradDistributionsLoglogistic_vv_116;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_117> AgradDistributionsLoglogistic_vv_117;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_118> AgradDistributionsLoglogistic_vv_118;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_119> AgradDistributionsLoglogistic_vv_119;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_120> AgradDistributionsLoglogistic_vv_120;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_121> AgradDistributionsLoglogistic_vv_121;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_122> AgradDistributionsLoglogistic_vv_122;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_123> AgradDistributionsLoglogistic_vv_123;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_124> AgradDistributionsLoglogistic_vv_124;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_125> AgradDistributionsLoglogistic_vv_125;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_126> AgradDistributionsLoglogistic_vv_126;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_127> AgradDistributionsLoglogistic_vv_127;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_128> AgradDistributionsLoglogistic_vv_128;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_129> AgradDistributionsLoglogistic_vv_129;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_130> AgradDistributionsLoglogistic_vv_130;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_131> AgradDistributionsLoglogistic_vv_131;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_132> AgradDistributionsLoglogistic_vv_132;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_133> AgradDistributionsLoglogistic_vv_133;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_134> AgradDistributionsLoglogistic_vv_134;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_135> AgradDistributionsLoglogistic_vv_135;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_136> AgradDistributionsLoglogistic_vv_136;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_137> AgradDistributionsLoglogistic_vv_137;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_138> AgradDistributionsLoglogistic_vv_138;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_139> AgradDistributionsLoglogistic_vv_139;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_140> AgradDistributionsLoglogistic_vv_140;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_141> AgradDistributionsLoglogistic_vv_141;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_142> AgradDistributionsLoglogistic_vv_142;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_143> AgradDistributionsLoglogistic_vv_143;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_144> AgradDistributionsLoglogistic_vv_144;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_145> AgradDistributionsLoglogistic_vv_145;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_146> AgradDistributionsLoglogistic_vv_146;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_147> AgradDistributionsLoglogistic_vv_147;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_148> AgradDistributionsLoglogistic_vv_148;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_149> AgradDistributionsLoglogistic_vv_149;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_150> AgradDistributionsLoglogistic_vv_150;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_151> AgradDistributionsLoglogistic_vv_151;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_152> AgradDistributionsLoglogistic_vv_152;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_153> AgradDistributionsLoglogistic_vv_153;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_154> AgradDistributionsLoglogistic_vv_154;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_155> AgradDistributionsLoglogistic_vv_155;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_156> AgradDistributionsLoglogistic_vv_156;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_157> AgradDistributionsLoglogistic_vv_157;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_158> AgradDistributionsLoglogistic_vv_158;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_159> AgradDistributionsLoglogistic_vv_159;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_160> AgradDistributionsLoglogistic_vv_160;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_161> AgradDistributionsLoglogistic_vv_161;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_162> AgradDistributionsLoglogistic_vv_162;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_163> AgradDistributionsLoglogistic_vv_163;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_164> AgradDistributionsLoglogistic_vv_164;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_165> AgradDistributionsLoglogistic_vv_165;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_166> AgradDistributionsLoglogistic_vv_166;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_167> AgradDistributionsLoglogistic_vv_167;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_168> AgradDistributionsLoglogistic_vv_168;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_169> AgradDistributionsLoglogistic_vv_169;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_170> AgradDistributionsLoglogistic_vv_170;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_171> AgradDistributionsLoglogistic_vv_171;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_172> AgradDistributionsLoglogistic_vv_172;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_173> AgradDistributionsLoglogistic_vv_173;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_174> AgradDistributionsLoglogistic_vv_174;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_175> AgradDistributionsLoglogistic_vv_175;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_176> AgradDistributionsLoglogistic_vv_176;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_177> AgradDistributionsLoglogistic_vv_177;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_178> AgradDistributionsLoglogistic_vv_178;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_179> AgradDistributionsLoglogistic_vv_179;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_180> AgradDistributionsLoglogistic_vv_180;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_181> AgradDistributionsLoglogistic_vv_181;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_182> AgradDistributionsLoglogistic_vv_182;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_183> AgradDistributionsLoglogistic_vv_183;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_184> AgradDistributionsLoglogistic_vv_184;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_185> AgradDistributionsLoglogistic_vv_185;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_186> AgradDistributionsLoglogistic_vv_186;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_187> AgradDistributionsLoglogistic_vv_187;
+typedef std::tuple<AgradDistributionsLoglogistic, type_vv_188> AgradDistributionsLoglogistic_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_100, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_101, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_102, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_103, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_104, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_105, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_106, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_107, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_108, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_109, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_110, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_111, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_112, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_113, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_114, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_115, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_116, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_117, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_118, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_119, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_120, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_121, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_122, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_123, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_124, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_125, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_126, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_127, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_128, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_129, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_130, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_131, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_132, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_133, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_134, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_135, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_136, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_137, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_138, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_139, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_140, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_141, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_142, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_143, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_144, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_145, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_146, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_147, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_148, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_149, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_150, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_151, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_152, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_153, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_154, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_155, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_156, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_157, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_158, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_159, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_160, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_161, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_162, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_163, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_164, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_165, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_166, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_167, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_168, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_169, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_170, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_171, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_172, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_173, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_174, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_175, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_176, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_177, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_178, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_179, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_180, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_181, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_182, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_183, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_184, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_185, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_186, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_187, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_vv_188, AgradDistributionTestFixture, AgradDistributionsLoglogistic_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/loglogistic/loglogistic_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_200> AgradDistributionsLoglogistic_v_200;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_201> AgradDistributionsLoglogistic_v_201;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_202> AgradDistributionsLoglogistic_v_202;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_203> AgradDistributionsLoglogistic_v_203;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_204> AgradDistributionsLoglogistic_v_204;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_205> AgradDistributionsLoglogistic_v_205;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_206> AgradDistributionsLoglogistic_v_206;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_207> AgradDistributionsLoglogistic_v_207;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_208> AgradDistributionsLoglogistic_v_208;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_209> AgradDistributionsLoglogistic_v_209;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_210> AgradDistributionsLoglogistic_v_210;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_211> AgradDistributionsLoglogistic_v_211;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_212> AgradDistributionsLoglogistic_v_212;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_213> AgradDistributionsLoglogistic_v_213;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_214> AgradDistributionsLoglogistic_v_214;
+typedef std::tuple<AgradDistributionsLoglogistic, type_v_215> AgradDistributionsLoglogistic_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_200, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_201, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_202, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_203, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_204, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_205, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_206, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_207, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_208, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_209, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_210, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_211, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_212, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_213, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_214, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLoglogistic_v_215, AgradDistributionTestFixture, AgradDistributionsLoglogistic_v_215);
+
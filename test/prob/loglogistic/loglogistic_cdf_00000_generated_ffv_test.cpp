@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/loglogistic/loglogistic_cdf_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogistic, type_ffv_0> AgradCdfLogistic_ffv_0;
+typedef std::tuple<AgradCdfLogistic, type_ffv_1> AgradCdfLogistic_ffv_1;
+typedef std::tuple<AgradCdfLogistic, type_ffv_2> AgradCdfLogistic_ffv_2;
+typedef std::tuple<AgradCdfLogistic, type_ffv_3> AgradCdfLogistic_ffv_3;
+typedef std::tuple<AgradCdfLogistic, type_ffv_4> AgradCdfLogistic_ffv_4;
+typedef std::tuple<AgradCdfLogistic, type_ffv_5> AgradCdfLogistic_ffv_5;
+typedef std::tuple<AgradCdfLogistic, type_ffv_6> AgradCdfLogistic_ffv_6;
+typedef std::tuple<AgradCdfLogistic, type_ffv_7> AgradCdfLogistic_ffv_7;
+typedef std::tuple<AgradCdfLogistic, type_ffv_8> AgradCdfLogistic_ffv_8;
+typedef std::tuple<AgradCdfLogistic, type_ffv_9> AgradCdfLogistic_ffv_9;
+typedef std::tuple<AgradCdfLogistic, type_ffv_10> AgradCdfLogistic_ffv_10;
+typedef std::tuple<AgradCdfLogistic, type_ffv_11> AgradCdfLogistic_ffv_11;
+typedef std::tuple<AgradCdfLogistic, type_ffv_12> AgradCdfLogistic_ffv_12;
+typedef std::tuple<AgradCdfLogistic, type_ffv_13> AgradCdfLogistic_ffv_13;
+typedef std::tuple<AgradCdfLogistic, type_ffv_14> AgradCdfLogistic_ffv_14;
+typedef std::tuple<AgradCdfLogistic, type_ffv_15> AgradCdfLogistic_ffv_15;
+typedef std::tuple<AgradCdfLogistic, type_ffv_16> AgradCdfLogistic_ffv_16;
+typedef std::tuple<AgradCdfLogistic, type_ffv_17> AgradCdfLogistic_ffv_17;
+typedef std::tuple<AgradCdfLogistic, type_ffv_18> AgradCdfLogistic_ffv_18;
+typedef std::tuple<AgradCdfLogistic, type_ffv_19> AgradCdfLogistic_ffv_19;
+typedef std::tuple<AgradCdfLogistic, type_ffv_20> AgradCdfLogistic_ffv_20;
+typedef std::tuple<AgradCdfLogistic, type_ffv_21> AgradCdfLogistic_ffv_21;
+typedef std::tuple<AgradCdfLogistic, type_ffv_22> AgradCdfLogistic_ffv_22;
+typedef std::tuple<AgradCdfLogistic, type_ffv_23> AgradCdfLogistic_ffv_23;
+typedef std::tuple<AgradCdfLogistic, type_ffv_24> AgradCdfLogistic_ffv_24;
+typedef std::tuple<AgradCdfLogistic, type_ffv_25> AgradCdfLogistic_ffv_25;
+typedef std::tuple<AgradCdfLogistic, type_ffv_26> AgradCdfLogistic_ffv_26;
+typedef std::tuple<AgradCdfLogistic, type_ffv_27> AgradCdfLogistic_ffv_27;
+typedef std::tuple<AgradCdfLogistic, type_ffv_28> AgradCdfLogistic_ffv_28;
+typedef std::tuple<AgradCdfLogistic, type_ffv_29> AgradCdfLogistic_ffv_29;
+typedef std::tuple<AgradCdfLogistic, type_ffv_30> AgradCdfLogistic_ffv_30;
+typedef std::tuple<AgradCdfLogistic, type_ffv_31> AgradCdfLogistic_ffv_31;
+typedef std::tuple<AgradCdfLogistic, type_ffv_32> AgradCdfLogistic_ffv_32;
+typedef std::tuple<AgradCdfLogistic, type_ffv_33> AgradCdfLogistic_ffv_33;
+typedef std::tuple<AgradCdfLogistic, type_ffv_34> AgradCdfLogistic_ffv_34;
+typedef std::tuple<AgradCdfLogistic, type_ffv_35> AgradCdfLogistic_ffv_35;
+typedef std::tuple<AgradCdfLogistic, type_ffv_36> AgradCdfLogistic_ffv_36;
+typedef std::tuple<AgradCdfLogistic, type_ffv_37> AgradCdfLogistic_ffv_37;
+typedef std::tuple<AgradCdfLogistic, type_ffv_38> AgradCdfLogistic_ffv_38;
+typedef std::tuple<AgradCdfLogistic, type_ffv_39> AgradCdfLogistic_ffv_39;
+typedef std::tuple<AgradCdfLogistic, type_ffv_40> AgradCdfLogistic_ffv_40;
+typedef std::tuple<AgradCdfLogistic, type_ffv_41> AgradCdfLogistic_ffv_41;
+typedef std::tuple<AgradCdfLogistic, type_ffv_42> AgradCdfLogistic_ffv_42;
+typedef std::tuple<AgradCdfLogistic, type_ffv_43> AgradCdfLogistic_ffv_43;
+typedef std::tuple<AgradCdfLogistic, type_ffv_44> AgradCdfLogistic_ffv_44;
+typedef std::tuple<AgradCdfLogistic, type_ffv_45> AgradCdfLogistic_ffv_45;
+typedef std::tuple<AgradCdfLogistic, type_ffv_46> AgradCdfLogistic_ffv_46;
+typedef std::tuple<AgradCdfLogistic, type_ffv_47> AgradCdfLogistic_ffv_47;
+typedef std::tuple<AgradCdfLogistic, type_ffv_48> AgradCdfLogistic_ffv_48;
+typedef std::tuple<AgradCdfLogistic, type_ffv_49> AgradCdfLogistic_ffv_49;
+typedef std::tuple<AgradCdfLogistic, type_ffv_50> AgradCdfLogistic_ffv_50;
+typedef std::tuple<AgradCdfLogistic, type_ffv_51> AgradCdfLogistic_ffv_51;
+typedef std::tuple<AgradCdfLogistic, type_ffv_52> AgradCdfLogistic_ffv_52;
+typedef std::tuple<AgradCdfLogistic, type_ffv_53> AgradCdfLogistic_ffv_53;
+typedef std::tuple<AgradCdfLogistic, type_ffv_54> AgradCdfLogistic_ffv_54;
+typedef std::tuple<AgradCdfLogistic, type_ffv_55> AgradCdfLogistic_ffv_55;
+typedef std::tuple<AgradCdfLogistic, type_ffv_56> AgradCdfLogistic_ffv_56;
+typedef std::tuple<AgradCdfLogistic, type_ffv_57> AgradCdfLogistic_ffv_57;
+typedef std::tuple<AgradCdfLogistic, type_ffv_58> AgradCdfLogistic_ffv_58;
+typedef std::tuple<AgradCdfLogistic, type_ffv_59> AgradCdfLogistic_ffv_59;
+typedef std::tuple<AgradCdfLogistic, type_ffv_60> AgradCdfLogistic_ffv_60;
+typedef std::tuple<AgradCdfLogistic, type_ffv_61> AgradCdfLogistic_ffv_61;
+typedef std::tuple<AgradCdfLogistic, type_ffv_62> AgradCdfLogistic_ffv_62;
+typedef std::tuple<AgradCdfLogistic, type_ffv_63> AgradCdfLogistic_ffv_63;
+typedef std::tuple<AgradCdfLogistic, type_ffv_64> AgradCdfLogistic_ffv_64;
+typedef std::tuple<AgradCdfLogistic, type_ffv_65> AgradCdfLogistic_ffv_65;
+typedef std::tuple<AgradCdfLogistic, type_ffv_66> AgradCdfLogistic_ffv_66;
+typedef std::tuple<AgradCdfLogistic, type_ffv_67> AgradCdfLogistic_ffv_67;
+typedef std::tuple<AgradCdfLogistic, type_ffv_68> AgradCdfLogistic_ffv_68;
+typedef std::tuple<AgradCdfLogistic, type_ffv_69> AgradCdfLogistic_ffv_69;
+typedef std::tuple<AgradCdfLogistic, type_ffv_70> AgradCdfLogistic_ffv_70;
+typedef std::tuple<AgradCdfLogistic, type_ffv_71> AgradCdfLogistic_ffv_71;
+typedef std::tuple<AgradCdfLogistic, type_ffv_72> AgradCdfLogistic_ffv_72;
+typedef std::tuple<AgradCdfLogistic, type_ffv_73> AgradCdfLogistic_ffv_73;
+typedef std::tuple<AgradCdfLogistic, type_ffv_74> AgradCdfLogistic_ffv_74;
+typedef std::tuple<AgradCdfLogistic, type_ffv_75> AgradCdfLogistic_ffv_75;
+typedef std::tuple<AgradCdfLogistic, type_ffv_76> AgradCdfLogistic_ffv_76;
+typedef std::tuple<AgradCdfLogistic, type_ffv_77> AgradCdfLogistic_ffv_77;
+typedef std::tuple<AgradCdfLogistic, type_ffv_78> AgradCdfLogistic_ffv_78;
+typedef std::tuple<AgradCdfLogistic, type_ffv_79> AgradCdfLogistic_ffv_79;
+typedef std::tuple<AgradCdfLogistic, type_ffv_80> AgradCdfLogistic_ffv_80;
+typedef std::tuple<AgradCdfLogistic, type_ffv_81> AgradCdfLogistic_ffv_81;
+typedef std::tuple<AgradCdfLogistic, type_ffv_82> AgradCdfLogistic_ffv_82;
+typedef std::tuple<AgradCdfLogistic, type_ffv_83> AgradCdfLogistic_ffv_83;
+typedef std::tuple<AgradCdfLogistic, type_ffv_84> AgradCdfLogistic_ffv_84;
+typedef std::tuple<AgradCdfLogistic, type_ffv_85> AgradCdfLogistic_ffv_85;
+typedef std::tuple<AgradCdfLogistic, type_ffv_86> AgradCdfLogistic_ffv_86;
+typedef std::tuple<AgradCdfLogistic, type_ffv_87> AgradCdfLogistic_ffv_87;
+typedef std::tuple<AgradCdfLogistic, type_ffv_88> AgradCdfLogistic_ffv_88;
+typedef std::tuple<AgradCdfLogistic, type_ffv_89> AgradCdfLogistic_ffv_89;
+typedef std::tuple<AgradCdfLogistic, type_ffv_90> AgradCdfLogistic_ffv_90;
+typedef std::tuple<AgradCdfLogistic, type_ffv_91> AgradCdfLogistic_ffv_91;
+typedef std::tuple<AgradCdfLogistic, type_ffv_92> AgradCdfLogistic_ffv_92;
+typedef std::tuple<AgradCdfLogistic, type_ffv_93> AgradCdfLogistic_ffv_93;
+typedef std::tuple<AgradCdfLogistic, type_ffv_94> AgradCdfLogistic_ffv_94;
+typedef std::tuple<AgradCdfLogistic, type_ffv_95> AgradCdfLogistic_ffv_95;
+typedef std::tuple<AgradCdfLogistic, type_ffv_96> AgradCdfLogistic_ffv_96;
+typedef std::tuple<AgradCdfLogistic, type_ffv_97> AgradCdfLogistic_ffv_97;
+typedef std::tuple<AgradCdfLogistic, type_ffv_98> AgradCdfLogistic_ffv_98;
+typedef std::tuple<AgradCdfLogistic, type_ffv_99> AgradCdfLogistic_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_0, AgradCdfTestFixture, AgradCdfLogistic_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_1, AgradCdfTestFixture, AgradCdfLogistic_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_2, AgradCdfTestFixture, AgradCdfLogistic_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_3, AgradCdfTestFixture, AgradCdfLogistic_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_4, AgradCdfTestFixture, AgradCdfLogistic_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_5, AgradCdfTestFixture, AgradCdfLogistic_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_6, AgradCdfTestFixture, AgradCdfLogistic_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_7, AgradCdfTestFixture, AgradCdfLogistic_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_8, AgradCdfTestFixture, AgradCdfLogistic_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_9, AgradCdfTestFixture, AgradCdfLogistic_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_10, AgradCdfTestFixture, AgradCdfLogistic_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_11, AgradCdfTestFixture, AgradCdfLogistic_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_12, AgradCdfTestFixture, AgradCdfLogistic_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_13, AgradCdfTestFixture, AgradCdfLogistic_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_14, AgradCdfTestFixture, AgradCdfLogistic_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_15, AgradCdfTestFixture, AgradCdfLogistic_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_16, AgradCdfTestFixture, AgradCdfLogistic_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_17, AgradCdfTestFixture, AgradCdfLogistic_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_18, AgradCdfTestFixture, AgradCdfLogistic_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_19, AgradCdfTestFixture, AgradCdfLogistic_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_20, AgradCdfTestFixture, AgradCdfLogistic_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_21, AgradCdfTestFixture, AgradCdfLogistic_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_22, AgradCdfTestFixture, AgradCdfLogistic_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_23, AgradCdfTestFixture, AgradCdfLogistic_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_24, AgradCdfTestFixture, AgradCdfLogistic_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_25, AgradCdfTestFixture, AgradCdfLogistic_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_26, AgradCdfTestFixture, AgradCdfLogistic_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_27, AgradCdfTestFixture, AgradCdfLogistic_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_28, AgradCdfTestFixture, AgradCdfLogistic_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_29, AgradCdfTestFixture, AgradCdfLogistic_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_30, AgradCdfTestFixture, AgradCdfLogistic_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_31, AgradCdfTestFixture, AgradCdfLogistic_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_32, AgradCdfTestFixture, AgradCdfLogistic_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_33, AgradCdfTestFixture, AgradCdfLogistic_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_34, AgradCdfTestFixture, AgradCdfLogistic_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_35, AgradCdfTestFixture, AgradCdfLogistic_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_36, AgradCdfTestFixture, AgradCdfLogistic_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_37, AgradCdfTestFixture, AgradCdfLogistic_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_38, AgradCdfTestFixture, AgradCdfLogistic_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_39, AgradCdfTestFixture, AgradCdfLogistic_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_40, AgradCdfTestFixture, AgradCdfLogistic_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_41, AgradCdfTestFixture, AgradCdfLogistic_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_42, AgradCdfTestFixture, AgradCdfLogistic_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_43, AgradCdfTestFixture, AgradCdfLogistic_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_44, AgradCdfTestFixture, AgradCdfLogistic_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_45, AgradCdfTestFixture, AgradCdfLogistic_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_46, AgradCdfTestFixture, AgradCdfLogistic_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_47, AgradCdfTestFixture, AgradCdfLogistic_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_48, AgradCdfTestFixture, AgradCdfLogistic_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_49, AgradCdfTestFixture, AgradCdfLogistic_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_50, AgradCdfTestFixture, AgradCdfLogistic_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_51, AgradCdfTestFixture, AgradCdfLogistic_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_52, AgradCdfTestFixture, AgradCdfLogistic_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_53, AgradCdfTestFixture, AgradCdfLogistic_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_54, AgradCdfTestFixture, AgradCdfLogistic_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_55, AgradCdfTestFixture, AgradCdfLogistic_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_56, AgradCdfTestFixture, AgradCdfLogistic_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_57, AgradCdfTestFixture, AgradCdfLogistic_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_58, AgradCdfTestFixture, AgradCdfLogistic_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_59, AgradCdfTestFixture, AgradCdfLogistic_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_60, AgradCdfTestFixture, AgradCdfLogistic_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_61, AgradCdfTestFixture, AgradCdfLogistic_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_62, AgradCdfTestFixture, AgradCdfLogistic_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_63, AgradCdfTestFixture, AgradCdfLogistic_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_64, AgradCdfTestFixture, AgradCdfLogistic_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_65, AgradCdfTestFixture, AgradCdfLogistic_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_66, AgradCdfTestFixture, AgradCdfLogistic_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_67, AgradCdfTestFixture, AgradCdfLogistic_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_68, AgradCdfTestFixture, AgradCdfLogistic_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_69, AgradCdfTestFixture, AgradCdfLogistic_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_70, AgradCdfTestFixture, AgradCdfLogistic_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_71, AgradCdfTestFixture, AgradCdfLogistic_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_72, AgradCdfTestFixture, AgradCdfLogistic_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_73, AgradCdfTestFixture, AgradCdfLogistic_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_74, AgradCdfTestFixture, AgradCdfLogistic_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_75, AgradCdfTestFixture, AgradCdfLogistic_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_76, AgradCdfTestFixture, AgradCdfLogistic_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_77, AgradCdfTestFixture, AgradCdfLogistic_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_78, AgradCdfTestFixture, AgradCdfLogistic_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_79, AgradCdfTestFixture, AgradCdfLogistic_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_80, AgradCdfTestFixture, AgradCdfLogistic_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_81, AgradCdfTestFixture, AgradCdfLogistic_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_82, AgradCdfTestFixture, AgradCdfLogistic_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_83, AgradCdfTestFixture, AgradCdfLogistic_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_84, AgradCdfTestFixture, AgradCdfLogistic_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_85, AgradCdfTestFixture, AgradCdfLogistic_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_86, AgradCdfTestFixture, AgradCdfLogistic_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_87, AgradCdfTestFixture, AgradCdfLogistic_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_88, AgradCdfTestFixture, AgradCdfLogistic_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_89, AgradCdfTestFixture, AgradCdfLogistic_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_90, AgradCdfTestFixture, AgradCdfLogistic_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_91, AgradCdfTestFixture, AgradCdfLogistic_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_92, AgradCdfTestFixture, AgradCdfLogistic_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_93, AgradCdfTestFixture, AgradCdfLogistic_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_94, AgradCdfTestFixture, AgradCdfLogistic_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_95, AgradCdfTestFixture, AgradCdfLogistic_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_96, AgradCdfTestFixture, AgradCdfLogistic_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_97, AgradCdfTestFixture, AgradCdfLogistic_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_98, AgradCdfTestFixture, AgradCdfLogistic_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_ffv_99, AgradCdfTestFixture, AgradCdfLogistic_ffv_99);
+
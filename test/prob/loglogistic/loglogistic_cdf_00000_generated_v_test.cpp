@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/loglogistic/loglogistic_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogistic, type_v_0> AgradCdfLogistic_v_0;
+typedef std::tuple<AgradCdfLogistic, type_v_1> AgradCdfLogistic_v_1;
+typedef std::tuple<AgradCdfLogistic, type_v_2> AgradCdfLogistic_v_2;
+typedef std::tuple<AgradCdfLogistic, type_v_3> AgradCdfLogistic_v_3;
+typedef std::tuple<AgradCdfLogistic, type_v_4> AgradCdfLogistic_v_4;
+typedef std::tuple<AgradCdfLogistic, type_v_5> AgradCdfLogistic_v_5;
+typedef std::tuple<AgradCdfLogistic, type_v_6> AgradCdfLogistic_v_6;
+typedef std::tuple<AgradCdfLogistic, type_v_7> AgradCdfLogistic_v_7;
+typedef std::tuple<AgradCdfLogistic, type_v_8> AgradCdfLogistic_v_8;
+typedef std::tuple<AgradCdfLogistic, type_v_9> AgradCdfLogistic_v_9;
+typedef std::tuple<AgradCdfLogistic, type_v_10> AgradCdfLogistic_v_10;
+typedef std::tuple<AgradCdfLogistic, type_v_11> AgradCdfLogistic_v_11;
+typedef std::tuple<AgradCdfLogistic, type_v_12> AgradCdfLogistic_v_12;
+typedef std::tuple<AgradCdfLogistic, type_v_13> AgradCdfLogistic_v_13;
+typedef std::tuple<AgradCdfLogistic, type_v_14> AgradCdfLogistic_v_14;
+typedef std::tuple<AgradCdfLogistic, type_v_15> AgradCdfLogistic_v_15;
+typedef std::tuple<AgradCdfLogistic, type_v_16> AgradCdfLogistic_v_16;
+typedef std::tuple<AgradCdfLogistic, type_v_17> AgradCdfLogistic_v_17;
+typedef std::tuple<AgradCdfLogistic, type_v_18> AgradCdfLogistic_v_18;
+typedef std::tuple<AgradCdfLogistic, type_v_19> AgradCdfLogistic_v_19;
+typedef std::tuple<AgradCdfLogistic, type_v_20> AgradCdfLogistic_v_20;
+typedef std::tuple<AgradCdfLogistic, type_v_21> AgradCdfLogistic_v_21;
+typedef std::tuple<AgradCdfLogistic, type_v_22> AgradCdfLogistic_v_22;
+typedef std::tuple<AgradCdfLogistic, type_v_23> AgradCdfLogistic_v_23;
+typedef std::tuple<AgradCdfLogistic, type_v_24> AgradCdfLogistic_v_24;
+typedef std::tuple<AgradCdfLogistic, type_v_25> AgradCdfLogistic_v_25;
+typedef std::tuple<AgradCdfLogistic, type_v_26> AgradCdfLogistic_v_26;
+typedef std::tuple<AgradCdfLogistic, type_v_27> AgradCdfLogistic_v_27;
+typedef std::tuple<AgradCdfLogistic, type_v_28> AgradCdfLogistic_v_28;
+typedef std::tuple<AgradCdfLogistic, type_v_29> AgradCdfLogistic_v_29;
+typedef std::tuple<AgradCdfLogistic, type_v_30> AgradCdfLogistic_v_30;
+typedef std::tuple<AgradCdfLogistic, type_v_31> AgradCdfLogistic_v_31;
+typedef std::tuple<AgradCdfLogistic, type_v_32> AgradCdfLogistic_v_32;
+typedef std::tuple<AgradCdfLogistic, type_v_33> AgradCdfLogistic_v_33;
+typedef std::tuple<AgradCdfLogistic, type_v_34> AgradCdfLogistic_v_34;
+typedef std::tuple<AgradCdfLogistic, type_v_35> AgradCdfLogistic_v_35;
+typedef std::tuple<AgradCdfLogistic, type_v_36> AgradCdfLogistic_v_36;
+typedef std::tuple<AgradCdfLogistic, type_v_37> AgradCdfLogistic_v_37;
+typedef std::tuple<AgradCdfLogistic, type_v_38> AgradCdfLogistic_v_38;
+typedef std::tuple<AgradCdfLogistic, type_v_39> AgradCdfLogistic_v_39;
+typedef std::tuple<AgradCdfLogistic, type_v_40> AgradCdfLogistic_v_40;
+typedef std::tuple<AgradCdfLogistic, type_v_41> AgradCdfLogistic_v_41;
+typedef std::tuple<AgradCdfLogistic, type_v_42> AgradCdfLogistic_v_42;
+typedef std::tuple<AgradCdfLogistic, type_v_43> AgradCdfLogistic_v_43;
+typedef std::tuple<AgradCdfLogistic, type_v_44> AgradCdfLogistic_v_44;
+typedef std::tuple<AgradCdfLogistic, type_v_45> AgradCdfLogistic_v_45;
+typedef std::tuple<AgradCdfLogistic, type_v_46> AgradCdfLogistic_v_46;
+typedef std::tuple<AgradCdfLogistic, type_v_47> AgradCdfLogistic_v_47;
+typedef std::tuple<AgradCdfLogistic, type_v_48> AgradCdfLogistic_v_48;
+typedef std::tuple<AgradCdfLogistic, type_v_49> AgradCdfLogistic_v_49;
+typedef std::tuple<AgradCdfLogistic, type_v_50> AgradCdfLogistic_v_50;
+typedef std::tuple<AgradCdfLogistic, type_v_51> AgradCdfLogistic_v_51;
+typedef std::tuple<AgradCdfLogistic, type_v_52> AgradCdfLogistic_v_52;
+typedef std::tuple<AgradCdfLogistic, type_v_53> AgradCdfLogistic_v_53;
+typedef std::tuple<AgradCdfLogistic, type_v_54> AgradCdfLogistic_v_54;
+typedef std::tuple<AgradCdfLogistic, type_v_55> AgradCdfLogistic_v_55;
+typedef std::tuple<AgradCdfLogistic, type_v_56> AgradCdfLogistic_v_56;
+typedef std::tuple<AgradCdfLogistic, type_v_57> AgradCdfLogistic_v_57;
+typedef std::tuple<AgradCdfLogistic, type_v_58> AgradCdfLogistic_v_58;
+typedef std::tuple<AgradCdfLogistic, type_v_59> AgradCdfLogistic_v_59;
+typedef std::tuple<AgradCdfLogistic, type_v_60> AgradCdfLogistic_v_60;
+typedef std::tuple<AgradCdfLogistic, type_v_61> AgradCdfLogistic_v_61;
+typedef std::tuple<AgradCdfLogistic, type_v_62> AgradCdfLogistic_v_62;
+typedef std::tuple<AgradCdfLogistic, type_v_63> AgradCdfLogistic_v_63;
+typedef std::tuple<AgradCdfLogistic, type_v_64> AgradCdfLogistic_v_64;
+typedef std::tuple<AgradCdfLogistic, type_v_65> AgradCdfLogistic_v_65;
+typedef std::tuple<AgradCdfLogistic, type_v_66> AgradCdfLogistic_v_66;
+typedef std::tuple<AgradCdfLogistic, type_v_67> AgradCdfLogistic_v_67;
+typedef std::tuple<AgradCdfLogistic, type_v_68> AgradCdfLogistic_v_68;
+typedef std::tuple<AgradCdfLogistic, type_v_69> AgradCdfLogistic_v_69;
+typedef std::tuple<AgradCdfLogistic, type_v_70> AgradCdfLogistic_v_70;
+typedef std::tuple<AgradCdfLogistic, type_v_71> AgradCdfLogistic_v_71;
+typedef std::tuple<AgradCdfLogistic, type_v_72> AgradCdfLogistic_v_72;
+typedef std::tuple<AgradCdfLogistic, type_v_73> AgradCdfLogistic_v_73;
+typedef std::tuple<AgradCdfLogistic, type_v_74> AgradCdfLogistic_v_74;
+typedef std::tuple<AgradCdfLogistic, type_v_75> AgradCdfLogistic_v_75;
+typedef std::tuple<AgradCdfLogistic, type_v_76> AgradCdfLogistic_v_76;
+typedef std::tuple<AgradCdfLogistic, type_v_77> AgradCdfLogistic_v_77;
+typedef std::tuple<AgradCdfLogistic, type_v_78> AgradCdfLogistic_v_78;
+typedef std::tuple<AgradCdfLogistic, type_v_79> AgradCdfLogistic_v_79;
+typedef std::tuple<AgradCdfLogistic, type_v_80> AgradCdfLogistic_v_80;
+typedef std::tuple<AgradCdfLogistic, type_v_81> AgradCdfLogistic_v_81;
+typedef std::tuple<AgradCdfLogistic, type_v_82> AgradCdfLogistic_v_82;
+typedef std::tuple<AgradCdfLogistic, type_v_83> AgradCdfLogistic_v_83;
+typedef std::tuple<AgradCdfLogistic, type_v_84> AgradCdfLogistic_v_84;
+typedef std::tuple<AgradCdfLogistic, type_v_85> AgradCdfLogistic_v_85;
+typedef std::tuple<AgradCdfLogistic, type_v_86> AgradCdfLogistic_v_86;
+typedef std::tuple<AgradCdfLogistic, type_v_87> AgradCdfLogistic_v_87;
+typedef std::tuple<AgradCdfLogistic, type_v_88> AgradCdfLogistic_v_88;
+typedef std::tuple<AgradCdfLogistic, type_v_89> AgradCdfLogistic_v_89;
+typedef std::tuple<AgradCdfLogistic, type_v_90> AgradCdfLogistic_v_90;
+typedef std::tuple<AgradCdfLogistic, type_v_91> AgradCdfLogistic_v_91;
+typedef std::tuple<AgradCdfLogistic, type_v_92> AgradCdfLogistic_v_92;
+typedef std::tuple<AgradCdfLogistic, type_v_93> AgradCdfLogistic_v_93;
+typedef std::tuple<AgradCdfLogistic, type_v_94> AgradCdfLogistic_v_94;
+typedef std::tuple<AgradCdfLogistic, type_v_95> AgradCdfLogistic_v_95;
+typedef std::tuple<AgradCdfLogistic, type_v_96> AgradCdfLogistic_v_96;
+typedef std::tuple<AgradCdfLogistic, type_v_97> AgradCdfLogistic_v_97;
+typedef std::tuple<AgradCdfLogistic, type_v_98> AgradCdfLogistic_v_98;
+typedef std::tuple<AgradCdfLogistic, type_v_99> AgradCdfLogistic_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_0, AgradCdfTestFixture, AgradCdfLogistic_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_1, AgradCdfTestFixture, AgradCdfLogistic_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_2, AgradCdfTestFixture, AgradCdfLogistic_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_3, AgradCdfTestFixture, AgradCdfLogistic_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_4, AgradCdfTestFixture, AgradCdfLogistic_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_5, AgradCdfTestFixture, AgradCdfLogistic_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_6, AgradCdfTestFixture, AgradCdfLogistic_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_7, AgradCdfTestFixture, AgradCdfLogistic_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_8, AgradCdfTestFixture, AgradCdfLogistic_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_9, AgradCdfTestFixture, AgradCdfLogistic_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_10, AgradCdfTestFixture, AgradCdfLogistic_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_11, AgradCdfTestFixture, AgradCdfLogistic_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_12, AgradCdfTestFixture, AgradCdfLogistic_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_13, AgradCdfTestFixture, AgradCdfLogistic_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_14, AgradCdfTestFixture, AgradCdfLogistic_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_15, AgradCdfTestFixture, AgradCdfLogistic_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_16, AgradCdfTestFixture, AgradCdfLogistic_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_17, AgradCdfTestFixture, AgradCdfLogistic_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_18, AgradCdfTestFixture, AgradCdfLogistic_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_19, AgradCdfTestFixture, AgradCdfLogistic_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_20, AgradCdfTestFixture, AgradCdfLogistic_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_21, AgradCdfTestFixture, AgradCdfLogistic_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_22, AgradCdfTestFixture, AgradCdfLogistic_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_23, AgradCdfTestFixture, AgradCdfLogistic_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_24, AgradCdfTestFixture, AgradCdfLogistic_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_25, AgradCdfTestFixture, AgradCdfLogistic_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_26, AgradCdfTestFixture, AgradCdfLogistic_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_27, AgradCdfTestFixture, AgradCdfLogistic_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_28, AgradCdfTestFixture, AgradCdfLogistic_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_29, AgradCdfTestFixture, AgradCdfLogistic_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_30, AgradCdfTestFixture, AgradCdfLogistic_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_31, AgradCdfTestFixture, AgradCdfLogistic_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_32, AgradCdfTestFixture, AgradCdfLogistic_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_33, AgradCdfTestFixture, AgradCdfLogistic_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_34, AgradCdfTestFixture, AgradCdfLogistic_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_35, AgradCdfTestFixture, AgradCdfLogistic_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_36, AgradCdfTestFixture, AgradCdfLogistic_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_37, AgradCdfTestFixture, AgradCdfLogistic_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_38, AgradCdfTestFixture, AgradCdfLogistic_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_39, AgradCdfTestFixture, AgradCdfLogistic_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_40, AgradCdfTestFixture, AgradCdfLogistic_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_41, AgradCdfTestFixture, AgradCdfLogistic_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_42, AgradCdfTestFixture, AgradCdfLogistic_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_43, AgradCdfTestFixture, AgradCdfLogistic_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_44, AgradCdfTestFixture, AgradCdfLogistic_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_45, AgradCdfTestFixture, AgradCdfLogistic_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_46, AgradCdfTestFixture, AgradCdfLogistic_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_47, AgradCdfTestFixture, AgradCdfLogistic_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_48, AgradCdfTestFixture, AgradCdfLogistic_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_49, AgradCdfTestFixture, AgradCdfLogistic_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_50, AgradCdfTestFixture, AgradCdfLogistic_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_51, AgradCdfTestFixture, AgradCdfLogistic_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_52, AgradCdfTestFixture, AgradCdfLogistic_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_53, AgradCdfTestFixture, AgradCdfLogistic_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_54, AgradCdfTestFixture, AgradCdfLogistic_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_55, AgradCdfTestFixture, AgradCdfLogistic_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_56, AgradCdfTestFixture, AgradCdfLogistic_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_57, AgradCdfTestFixture, AgradCdfLogistic_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_58, AgradCdfTestFixture, AgradCdfLogistic_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_59, AgradCdfTestFixture, AgradCdfLogistic_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_60, AgradCdfTestFixture, AgradCdfLogistic_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_61, AgradCdfTestFixture, AgradCdfLogistic_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_62, AgradCdfTestFixture, AgradCdfLogistic_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_63, AgradCdfTestFixture, AgradCdfLogistic_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_64, AgradCdfTestFixture, AgradCdfLogistic_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_65, AgradCdfTestFixture, AgradCdfLogistic_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_66, AgradCdfTestFixture, AgradCdfLogistic_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_67, AgradCdfTestFixture, AgradCdfLogistic_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_68, AgradCdfTestFixture, AgradCdfLogistic_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_69, AgradCdfTestFixture, AgradCdfLogistic_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_70, AgradCdfTestFixture, AgradCdfLogistic_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_71, AgradCdfTestFixture, AgradCdfLogistic_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_72, AgradCdfTestFixture, AgradCdfLogistic_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_73, AgradCdfTestFixture, AgradCdfLogistic_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_74, AgradCdfTestFixture, AgradCdfLogistic_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_75, AgradCdfTestFixture, AgradCdfLogistic_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_76, AgradCdfTestFixture, AgradCdfLogistic_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_77, AgradCdfTestFixture, AgradCdfLogistic_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_78, AgradCdfTestFixture, AgradCdfLogistic_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_79, AgradCdfTestFixture, AgradCdfLogistic_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_80, AgradCdfTestFixture, AgradCdfLogistic_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_81, AgradCdfTestFixture, AgradCdfLogistic_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_82, AgradCdfTestFixture, AgradCdfLogistic_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_83, AgradCdfTestFixture, AgradCdfLogistic_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_84, AgradCdfTestFixture, AgradCdfLogistic_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_85, AgradCdfTestFixture, AgradCdfLogistic_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_86, AgradCdfTestFixture, AgradCdfLogistic_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_87, AgradCdfTestFixture, AgradCdfLogistic_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_88, AgradCdfTestFixture, AgradCdfLogistic_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_89, AgradCdfTestFixture, AgradCdfLogistic_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_90, AgradCdfTestFixture, AgradCdfLogistic_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_91, AgradCdfTestFixture, AgradCdfLogistic_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_92, AgradCdfTestFixture, AgradCdfLogistic_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_93, AgradCdfTestFixture, AgradCdfLogistic_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_94, AgradCdfTestFixture, AgradCdfLogistic_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_95, AgradCdfTestFixture, AgradCdfLogistic_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_96, AgradCdfTestFixture, AgradCdfLogistic_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_97, AgradCdfTestFixture, AgradCdfLogistic_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_98, AgradCdfTestFixture, AgradCdfLogistic_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_v_99, AgradCdfTestFixture, AgradCdfLogistic_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/loglogistic/loglogistic_cdf_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogistic, type_vv_0> AgradCdfLogistic_vv_0;
+typedef std::tuple<AgradCdfLogistic, type_vv_1> AgradCdfLogistic_vv_1;
+typedef std::tuple<AgradCdfLogistic, type_vv_2> AgradCdfLogistic_vv_2;
+typedef std::tuple<AgradCdfLogistic, type_vv_3> AgradCdfLogistic_vv_3;
+typedef std::tuple<AgradCdfLogistic, type_vv_4> AgradCdfLogistic_vv_4;
+typedef std::tuple<AgradCdfLogistic, type_vv_5> AgradCdfLogistic_vv_5;
+typedef std::tuple<AgradCdfLogistic, type_vv_6> AgradCdfLogistic_vv_6;
+typedef std::tuple<AgradCdfLogistic, type_vv_7> AgradCdfLogistic_vv_7;
+typedef std::tuple<AgradCdfLogistic, type_vv_8> AgradCdfLogistic_vv_8;
+typedef std::tuple<AgradCdfLogistic, type_vv_9> AgradCdfLogistic_vv_9;
+typedef std::tuple<AgradCdfLogistic, type_vv_10> AgradCdfLogistic_vv_10;
+typedef std::tuple<AgradCdfLogistic, type_vv_11> AgradCdfLogistic_vv_11;
+typedef std::tuple<AgradCdfLogistic, type_vv_12> AgradCdfLogistic_vv_12;
+typedef std::tuple<AgradCdfLogistic, type_vv_13> AgradCdfLogistic_vv_13;
+typedef std::tuple<AgradCdfLogistic, type_vv_14> AgradCdfLogistic_vv_14;
+typedef std::tuple<AgradCdfLogistic, type_vv_15> AgradCdfLogistic_vv_15;
+typedef std::tuple<AgradCdfLogistic, type_vv_16> AgradCdfLogistic_vv_16;
+typedef std::tuple<AgradCdfLogistic, type_vv_17> AgradCdfLogistic_vv_17;
+typedef std::tuple<AgradCdfLogistic, type_vv_18> AgradCdfLogistic_vv_18;
+typedef std::tuple<AgradCdfLogistic, type_vv_19> AgradCdfLogistic_vv_19;
+typedef std::tuple<AgradCdfLogistic, type_vv_20> AgradCdfLogistic_vv_20;
+typedef std::tuple<AgradCdfLogistic, type_vv_21> AgradCdfLogistic_vv_21;
+typedef std::tuple<AgradCdfLogistic, type_vv_22> AgradCdfLogistic_vv_22;
+typedef std::tuple<AgradCdfLogistic, type_vv_23> AgradCdfLogistic_vv_23;
+typedef std::tuple<AgradCdfLogistic, type_vv_24> AgradCdfLogistic_vv_24;
+typedef std::tuple<AgradCdfLogistic, type_vv_25> AgradCdfLogistic_vv_25;
+typedef std::tuple<AgradCdfLogistic, type_vv_26> AgradCdfLogistic_vv_26;
+typedef std::tuple<AgradCdfLogistic, type_vv_27> AgradCdfLogistic_vv_27;
+typedef std::tuple<AgradCdfLogistic, type_vv_28> AgradCdfLogistic_vv_28;
+typedef std::tuple<AgradCdfLogistic, type_vv_29> AgradCdfLogistic_vv_29;
+typedef std::tuple<AgradCdfLogistic, type_vv_30> AgradCdfLogistic_vv_30;
+typedef std::tuple<AgradCdfLogistic, type_vv_31> AgradCdfLogistic_vv_31;
+typedef std::tuple<AgradCdfLogistic, type_vv_32> AgradCdfLogistic_vv_32;
+typedef std::tuple<AgradCdfLogistic, type_vv_33> AgradCdfLogistic_vv_33;
+typedef std::tuple<AgradCdfLogistic, type_vv_34> AgradCdfLogistic_vv_34;
+typedef std::tuple<AgradCdfLogistic, type_vv_35> AgradCdfLogistic_vv_35;
+typedef std::tuple<AgradCdfLogistic, type_vv_36> AgradCdfLogistic_vv_36;
+typedef std::tuple<AgradCdfLogistic, type_vv_37> AgradCdfLogistic_vv_37;
+typedef std::tuple<AgradCdfLogistic, type_vv_38> AgradCdfLogistic_vv_38;
+typedef std::tuple<AgradCdfLogistic, type_vv_39> AgradCdfLogistic_vv_39;
+typedef std::tuple<AgradCdfLogistic, type_vv_40> AgradCdfLogistic_vv_40;
+typedef std::tuple<AgradCdfLogistic, type_vv_41> AgradCdfLogistic_vv_41;
+typedef std::tuple<AgradCdfLogistic, type_vv_42> AgradCdfLogistic_vv_42;
+typedef std::tuple<AgradCdfLogistic, type_vv_43> AgradCdfLogistic_vv_43;
+typedef std::tuple<AgradCdfLogistic, type_vv_44> AgradCdfLogistic_vv_44;
+typedef std::tuple<AgradCdfLogistic, type_vv_45> AgradCdfLogistic_vv_45;
+typedef std::tuple<AgradCdfLogistic, type_vv_46> AgradCdfLogistic_vv_46;
+typedef std::tuple<AgradCdfLogistic, type_vv_47> AgradCdfLogistic_vv_47;
+typedef std::tuple<AgradCdfLogistic, type_vv_48> AgradCdfLogistic_vv_48;
+typedef std::tuple<AgradCdfLogistic, type_vv_49> AgradCdfLogistic_vv_49;
+typedef std::tuple<AgradCdfLogistic, type_vv_50> AgradCdfLogistic_vv_50;
+typedef std::tuple<AgradCdfLogistic, type_vv_51> AgradCdfLogistic_vv_51;
+typedef std::tuple<AgradCdfLogistic, type_vv_52> AgradCdfLogistic_vv_52;
+typedef std::tuple<AgradCdfLogistic, type_vv_53> AgradCdfLogistic_vv_53;
+typedef std::tuple<AgradCdfLogistic, type_vv_54> AgradCdfLogistic_vv_54;
+typedef std::tuple<AgradCdfLogistic, type_vv_55> AgradCdfLogistic_vv_55;
+typedef std::tuple<AgradCdfLogistic, type_vv_56> AgradCdfLogistic_vv_56;
+typedef std::tuple<AgradCdfLogistic, type_vv_57> AgradCdfLogistic_vv_57;
+typedef std::tuple<AgradCdfLogistic, type_vv_58> AgradCdfLogistic_vv_58;
+typedef std::tuple<AgradCdfLogistic, type_vv_59> AgradCdfLogistic_vv_59;
+typedef std::tuple<AgradCdfLogistic, type_vv_60> AgradCdfLogistic_vv_60;
+typedef std::tuple<AgradCdfLogistic, type_vv_61> AgradCdfLogistic_vv_61;
+typedef std::tuple<AgradCdfLogistic, type_vv_62> AgradCdfLogistic_vv_62;
+typedef std::tuple<AgradCdfLogistic, type_vv_63> AgradCdfLogistic_vv_63;
+typedef std::tuple<AgradCdfLogistic, type_vv_64> AgradCdfLogistic_vv_64;
+typedef std::tuple<AgradCdfLogistic, type_vv_65> AgradCdfLogistic_vv_65;
+typedef std::tuple<AgradCdfLogistic, type_vv_66> AgradCdfLogistic_vv_66;
+typedef std::tuple<AgradCdfLogistic, type_vv_67> AgradCdfLogistic_vv_67;
+typedef std::tuple<AgradCdfLogistic, type_vv_68> AgradCdfLogistic_vv_68;
+typedef std::tuple<AgradCdfLogistic, type_vv_69> AgradCdfLogistic_vv_69;
+typedef std::tuple<AgradCdfLogistic, type_vv_70> AgradCdfLogistic_vv_70;
+typedef std::tuple<AgradCdfLogistic, type_vv_71> AgradCdfLogistic_vv_71;
+typedef std::tuple<AgradCdfLogistic, type_vv_72> AgradCdfLogistic_vv_72;
+typedef std::tuple<AgradCdfLogistic, type_vv_73> AgradCdfLogistic_vv_73;
+typedef std::tuple<AgradCdfLogistic, type_vv_74> AgradCdfLogistic_vv_74;
+typedef std::tuple<AgradCdfLogistic, type_vv_75> AgradCdfLogistic_vv_75;
+typedef std::tuple<AgradCdfLogistic, type_vv_76> AgradCdfLogistic_vv_76;
+typedef std::tuple<AgradCdfLogistic, type_vv_77> AgradCdfLogistic_vv_77;
+typedef std::tuple<AgradCdfLogistic, type_vv_78> AgradCdfLogistic_vv_78;
+typedef std::tuple<AgradCdfLogistic, type_vv_79> AgradCdfLogistic_vv_79;
+typedef std::tuple<AgradCdfLogistic, type_vv_80> AgradCdfLogistic_vv_80;
+typedef std::tuple<AgradCdfLogistic, type_vv_81> AgradCdfLogistic_vv_81;
+typedef std::tuple<AgradCdfLogistic, type_vv_82> AgradCdfLogistic_vv_82;
+typedef std::tuple<AgradCdfLogistic, type_vv_83> AgradCdfLogistic_vv_83;
+typedef std::tuple<AgradCdfLogistic, type_vv_84> AgradCdfLogistic_vv_84;
+typedef std::tuple<AgradCdfLogistic, type_vv_85> AgradCdfLogistic_vv_85;
+typedef std::tuple<AgradCdfLogistic, type_vv_86> AgradCdfLogistic_vv_86;
+typedef std::tuple<AgradCdfLogistic, type_vv_87> AgradCdfLogistic_vv_87;
+typedef std::tuple<AgradCdfLogistic, type_vv_88> AgradCdfLogistic_vv_88;
+typedef std::tuple<AgradCdfLogistic, type_vv_89> AgradCdfLogistic_vv_89;
+typedef std::tuple<AgradCdfLogistic, type_vv_90> AgradCdfLogistic_vv_90;
+typedef std::tuple<AgradCdfLogistic, type_vv_91> AgradCdfLogistic_vv_91;
+typedef std::tuple<AgradCdfLogistic, type_vv_92> AgradCdfLogistic_vv_92;
+typedef std::tuple<AgradCdfLogistic, type_vv_93> AgradCdfLogistic_vv_93;
+typedef std::tuple<AgradCdfLogistic, type_vv_94> AgradCdfLogistic_vv_94;
+typedef std::tuple<AgradCdfLogistic, type_vv_95> AgradCdfLogistic_vv_95;
+typedef std::tuple<AgradCdfLogistic, type_vv_96> AgradCdfLogistic_vv_96;
+typedef std::tuple<AgradCdfLogistic, type_vv_97> AgradCdfLogistic_vv_97;
+typedef std::tuple<AgradCdfLogistic, type_vv_98> AgradCdfLogistic_vv_98;
+typedef std::tuple<AgradCdfLogistic, type_vv_99> AgradCdfLogistic_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_0, AgradCdfTestFixture, AgradCdfLogistic_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_1, AgradCdfTestFixture, AgradCdfLogistic_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_2, AgradCdfTestFixture, AgradCdfLogistic_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_3, AgradCdfTestFixture, AgradCdfLogistic_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_4, AgradCdfTestFixture, AgradCdfLogistic_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_5, AgradCdfTestFixture, AgradCdfLogistic_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_6, AgradCdfTestFixture, AgradCdfLogistic_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_7, AgradCdfTestFixture, AgradCdfLogistic_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_8, AgradCdfTestFixture, AgradCdfLogistic_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_9, AgradCdfTestFixture, AgradCdfLogistic_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_10, AgradCdfTestFixture, AgradCdfLogistic_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_11, AgradCdfTestFixture, AgradCdfLogistic_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_12, AgradCdfTestFixture, AgradCdfLogistic_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_13, AgradCdfTestFixture, AgradCdfLogistic_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_14, AgradCdfTestFixture, AgradCdfLogistic_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_15, AgradCdfTestFixture, AgradCdfLogistic_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_16, AgradCdfTestFixture, AgradCdfLogistic_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_17, AgradCdfTestFixture, AgradCdfLogistic_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_18, AgradCdfTestFixture, AgradCdfLogistic_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_19, AgradCdfTestFixture, AgradCdfLogistic_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_20, AgradCdfTestFixture, AgradCdfLogistic_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_21, AgradCdfTestFixture, AgradCdfLogistic_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_22, AgradCdfTestFixture, AgradCdfLogistic_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_23, AgradCdfTestFixture, AgradCdfLogistic_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_24, AgradCdfTestFixture, AgradCdfLogistic_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_25, AgradCdfTestFixture, AgradCdfLogistic_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_26, AgradCdfTestFixture, AgradCdfLogistic_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_27, AgradCdfTestFixture, AgradCdfLogistic_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_28, AgradCdfTestFixture, AgradCdfLogistic_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_29, AgradCdfTestFixture, AgradCdfLogistic_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_30, AgradCdfTestFixture, AgradCdfLogistic_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_31, AgradCdfTestFixture, AgradCdfLogistic_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_32, AgradCdfTestFixture, AgradCdfLogistic_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_33, AgradCdfTestFixture, AgradCdfLogistic_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_34, AgradCdfTestFixture, AgradCdfLogistic_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_35, AgradCdfTestFixture, AgradCdfLogistic_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_36, AgradCdfTestFixture, AgradCdfLogistic_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_37, AgradCdfTestFixture, AgradCdfLogistic_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_38, AgradCdfTestFixture, AgradCdfLogistic_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_39, AgradCdfTestFixture, AgradCdfLogistic_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_40, AgradCdfTestFixture, AgradCdfLogistic_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_41, AgradCdfTestFixture, AgradCdfLogistic_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_42, AgradCdfTestFixture, AgradCdfLogistic_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_43, AgradCdfTestFixture, AgradCdfLogistic_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_44, AgradCdfTestFixture, AgradCdfLogistic_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_45, AgradCdfTestFixture, AgradCdfLogistic_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_46, AgradCdfTestFixture, AgradCdfLogistic_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_47, AgradCdfTestFixture, AgradCdfLogistic_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_48, AgradCdfTestFixture, AgradCdfLogistic_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_49, AgradCdfTestFixture, AgradCdfLogistic_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_50, AgradCdfTestFixture, AgradCdfLogistic_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_51, AgradCdfTestFixture, AgradCdfLogistic_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_52, AgradCdfTestFixture, AgradCdfLogistic_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_53, AgradCdfTestFixture, AgradCdfLogistic_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_54, AgradCdfTestFixture, AgradCdfLogistic_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_55, AgradCdfTestFixture, AgradCdfLogistic_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_56, AgradCdfTestFixture, AgradCdfLogistic_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_57, AgradCdfTestFixture, AgradCdfLogistic_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_58, AgradCdfTestFixture, AgradCdfLogistic_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_59, AgradCdfTestFixture, AgradCdfLogistic_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_60, AgradCdfTestFixture, AgradCdfLogistic_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_61, AgradCdfTestFixture, AgradCdfLogistic_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_62, AgradCdfTestFixture, AgradCdfLogistic_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_63, AgradCdfTestFixture, AgradCdfLogistic_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_64, AgradCdfTestFixture, AgradCdfLogistic_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_65, AgradCdfTestFixture, AgradCdfLogistic_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_66, AgradCdfTestFixture, AgradCdfLogistic_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_67, AgradCdfTestFixture, AgradCdfLogistic_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_68, AgradCdfTestFixture, AgradCdfLogistic_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_69, AgradCdfTestFixture, AgradCdfLogistic_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_70, AgradCdfTestFixture, AgradCdfLogistic_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_71, AgradCdfTestFixture, AgradCdfLogistic_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_72, AgradCdfTestFixture, AgradCdfLogistic_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_73, AgradCdfTestFixture, AgradCdfLogistic_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_74, AgradCdfTestFixture, AgradCdfLogistic_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_75, AgradCdfTestFixture, AgradCdfLogistic_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_76, AgradCdfTestFixture, AgradCdfLogistic_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_77, AgradCdfTestFixture, AgradCdfLogistic_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_78, AgradCdfTestFixture, AgradCdfLogistic_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_79, AgradCdfTestFixture, AgradCdfLogistic_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_80, AgradCdfTestFixture, AgradCdfLogistic_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_81, AgradCdfTestFixture, AgradCdfLogistic_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_82, AgradCdfTestFixture, AgradCdfLogistic_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_83, AgradCdfTestFixture, AgradCdfLogistic_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_84, AgradCdfTestFixture, AgradCdfLogistic_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_85, AgradCdfTestFixture, AgradCdfLogistic_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_86, AgradCdfTestFixture, AgradCdfLogistic_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_87, AgradCdfTestFixture, AgradCdfLogistic_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_88, AgradCdfTestFixture, AgradCdfLogistic_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_89, AgradCdfTestFixture, AgradCdfLogistic_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_90, AgradCdfTestFixture, AgradCdfLogistic_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_91, AgradCdfTestFixture, AgradCdfLogistic_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_92, AgradCdfTestFixture, AgradCdfLogistic_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_93, AgradCdfTestFixture, AgradCdfLogistic_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_94, AgradCdfTestFixture, AgradCdfLogistic_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_95, AgradCdfTestFixture, AgradCdfLogistic_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_96, AgradCdfTestFixture, AgradCdfLogistic_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_97, AgradCdfTestFixture, AgradCdfLogistic_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_98, AgradCdfTestFixture, AgradCdfLogistic_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_99, AgradCdfTestFixture, AgradCdfLogistic_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/loglogistic/loglogistic_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogistic, type_vv_100> AgradCdfLogistic_vv_100;
+typedef std::tuple<AgradCdfLogistic, type_vv_101> AgradCdfLogistic_vv_101;
+typedef std::tuple<AgradCdfLogistic, type_vv_102> AgradCdfLogistic_vv_102;
+typedef std::tuple<AgradCdfLogistic, type_vv_103> AgradCdfLogistic_vv_103;
+typedef std::tuple<AgradCdfLogistic, type_vv_104> AgradCdfLogistic_vv_104;
+typedef std::tuple<AgradCdfLogistic, type_vv_105> AgradCdfLogistic_vv_105;
+typedef std::tuple<AgradCdfLogistic, type_vv_106> AgradCdfLogistic_vv_106;
+typedef std::tuple<AgradCdfLogistic, type_vv_107> AgradCdfLogistic_vv_107;
+typedef std::tuple<AgradCdfLogistic, type_vv_108> AgradCdfLogistic_vv_108;
+typedef std::tuple<AgradCdfLogistic, type_vv_109> AgradCdfLogistic_vv_109;
+typedef std::tuple<AgradCdfLogistic, type_vv_110> AgradCdfLogistic_vv_110;
+typedef std::tuple<AgradCdfLogistic, type_vv_111> AgradCdfLogistic_vv_111;
+typedef std::tuple<AgradCdfLogistic, type_vv_112> AgradCdfLogistic_vv_112;
+typedef std::tuple<AgradCdfLogistic, type_vv_113> AgradCdfLogistic_vv_113;
+typedef std::tuple<AgradCdfLogistic, type_vv_114> AgradCdfLogistic_vv_114;
+typedef std::tuple<AgradCdfLogistic, type_vv_115> AgradCdfLogistic_vv_115;
+typedef std::tuple<AgradCdfLogistic, type_vv_116> AgradCdfLogistic_vv_116;
+typedef std::tuple<AgradCdfLogistic, type_vv_117> AgradCdfLogistic_vv_117;
+typedef std::tuple<AgradCdfLogistic, type_vv_118> AgradCdfLogistic_vv_118;
+typedef std::tuple<AgradCdfLogistic, type_vv_119> AgradCdfLogistic_vv_119;
+typedef std::tuple<AgradCdfLogistic, type_vv_120> AgradCdfLogistic_vv_120;
+typedef std::tuple<AgradCdfLogistic, type_vv_121> AgradCdfLogistic_vv_121;
+typedef std::tuple<AgradCdfLogistic, type_vv_122> AgradCdfLogistic_vv_122;
+typedef std::tuple<AgradCdfLogistic, type_vv_123> AgradCdfLogistic_vv_123;
+typedef std::tuple<AgradCdfLogistic, type_vv_124> AgradCdfLogistic_vv_124;
+typedef std::tuple<AgradCdfLogistic, type_vv_125> AgradCdfLogistic_vv_125;
+typedef std::tuple<AgradCdfLogistic, type_vv_126> AgradCdfLogistic_vv_126;
+typedef std::tuple<AgradCdfLogistic, type_vv_127> AgradCdfLogistic_vv_127;
+typedef std::tuple<AgradCdfLogistic, type_vv_128> AgradCdfLogistic_vv_128;
+typedef std::tuple<AgradCdfLogistic, type_vv_129> AgradCdfLogistic_vv_129;
+typedef std::tuple<AgradCdfLogistic, type_vv_130> AgradCdfLogistic_vv_130;
+typedef std::tuple<AgradCdfLogistic, type_vv_131> AgradCdfLogistic_vv_131;
+typedef std::tuple<AgradCdfLogistic, type_vv_132> AgradCdfLogistic_vv_132;
+typedef std::tuple<AgradCdfLogistic, type_vv_133> AgradCdfLogistic_vv_133;
+typedef std::tuple<AgradCdfLogistic, type_vv_134> AgradCdfLogistic_vv_134;
+typedef std::tuple<AgradCdfLogistic, type_vv_135> AgradCdfLogistic_vv_135;
+typedef std::tuple<AgradCdfLogistic, type_vv_136> AgradCdfLogistic_vv_136;
+typedef std::tuple<AgradCdfLogistic, type_vv_137> AgradCdfLogistic_vv_137;
+typedef std::tuple<AgradCdfLogistic, type_vv_138> AgradCdfLogistic_vv_138;
+typedef std::tuple<AgradCdfLogistic, type_vv_139> AgradCdfLogistic_vv_139;
+typedef std::tuple<AgradCdfLogistic, type_vv_140> AgradCdfLogistic_vv_140;
+typedef std::tuple<AgradCdfLogistic, type_vv_141> AgradCdfLogistic_vv_141;
+typedef std::tuple<AgradCdfLogistic, type_vv_142> AgradCdfLogistic_vv_142;
+typedef std::tuple<AgradCdfLogistic, type_vv_143> AgradCdfLogistic_vv_143;
+typedef std::tuple<AgradCdfLogistic, type_vv_144> AgradCdfLogistic_vv_144;
+typedef std::tuple<AgradCdfLogistic, type_vv_145> AgradCdfLogistic_vv_145;
+typedef std::tuple<AgradCdfLogistic, type_vv_146> AgradCdfLogistic_vv_146;
+typedef std::tuple<AgradCdfLogistic, type_vv_147> AgradCdfLogistic_vv_147;
+typedef std::tuple<AgradCdfLogistic, type_vv_148> AgradCdfLogistic_vv_148;
+typedef std::tuple<AgradCdfLogistic, type_vv_149> AgradCdfLogistic_vv_149;
+typedef std::tuple<AgradCdfLogistic, type_vv_150> AgradCdfLogistic_vv_150;
+typedef std::tuple<AgradCdfLogistic, type_vv_151> AgradCdfLogistic_vv_151;
+typedef std::tuple<AgradCdfLogistic, type_vv_152> AgradCdfLogistic_vv_152;
+typedef std::tuple<AgradCdfLogistic, type_vv_153> AgradCdfLogistic_vv_153;
+typedef std::tuple<AgradCdfLogistic, type_vv_154> AgradCdfLogistic_vv_154;
+typedef std::tuple<AgradCdfLogistic, type_vv_155> AgradCdfLogistic_vv_155;
+typedef std::tuple<AgradCdfLogistic, type_vv_156> AgradCdfLogistic_vv_156;
+typedef std::tuple<AgradCdfLogistic, type_vv_157> AgradCdfLogistic_vv_157;
+typedef std::tuple<AgradCdfLogistic, type_vv_158> AgradCdfLogistic_vv_158;
+typedef std::tuple<AgradCdfLogistic, type_vv_159> AgradCdfLogistic_vv_159;
+typedef std::tuple<AgradCdfLogistic, type_vv_160> AgradCdfLogistic_vv_160;
+typedef std::tuple<AgradCdfLogistic, type_vv_161> AgradCdfLogistic_vv_161;
+typedef std::tuple<AgradCdfLogistic, type_vv_162> AgradCdfLogistic_vv_162;
+typedef std::tuple<AgradCdfLogistic, type_vv_163> AgradCdfLogistic_vv_163;
+typedef std::tuple<AgradCdfLogistic, type_vv_164> AgradCdfLogistic_vv_164;
+typedef std::tuple<AgradCdfLogistic, type_vv_165> AgradCdfLogistic_vv_165;
+typedef std::tuple<AgradCdfLogistic, type_vv_166> AgradCdfLogistic_vv_166;
+typedef std::tuple<AgradCdfLogistic, type_vv_167> AgradCdfLogistic_vv_167;
+typedef std::tuple<AgradCdfLogistic, type_vv_168> AgradCdfLogistic_vv_168;
+typedef std::tuple<AgradCdfLogistic, type_vv_169> AgradCdfLogistic_vv_169;
+typedef std::tuple<AgradCdfLogistic, type_vv_170> AgradCdfLogistic_vv_170;
+typedef std::tuple<AgradCdfLogistic, type_vv_171> AgradCdfLogistic_vv_171;
+typedef std::tuple<AgradCdfLogistic, type_vv_172> AgradCdfLogistic_vv_172;
+typedef std::tuple<AgradCdfLogistic, type_vv_173> AgradCdfLogistic_vv_173;
+typedef std::tuple<AgradCdfLogistic, type_vv_174> AgradCdfLogistic_vv_174;
+typedef std::tuple<AgradCdfLogistic, type_vv_175> AgradCdfLogistic_vv_175;
+typedef std::tuple<AgradCdfLogistic, type_vv_176> AgradCdfLogistic_vv_176;
+typedef std::tuple<AgradCdfLogistic, type_vv_177> AgradCdfLogistic_vv_177;
+typedef std::tuple<AgradCdfLogistic, type_vv_178> AgradCdfLogistic_vv_178;
+typedef std::tuple<AgradCdfLogistic, type_vv_179> AgradCdfLogistic_vv_179;
+typedef std::tuple<AgradCdfLogistic, type_vv_180> AgradCdfLogistic_vv_180;
+typedef std::tuple<AgradCdfLogistic, type_vv_181> AgradCdfLogistic_vv_181;
+typedef std::tuple<AgradCdfLogistic, type_vv_182> AgradCdfLogistic_vv_182;
+typedef std::tuple<AgradCdfLogistic, type_vv_183> AgradCdfLogistic_vv_183;
+typedef std::tuple<AgradCdfLogistic, type_vv_184> AgradCdfLogistic_vv_184;
+typedef std::tuple<AgradCdfLogistic, type_vv_185> AgradCdfLogistic_vv_185;
+typedef std::tuple<AgradCdfLogistic, type_vv_186> AgradCdfLogistic_vv_186;
+typedef std::tuple<AgradCdfLogistic, type_vv_187> AgradCdfLogistic_vv_187;
+typedef std::tuple<AgradCdfLogistic, type_vv_188> AgradCdfLogistic_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_100, AgradCdfTestFixture, AgradCdfLogistic_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_101, AgradCdfTestFixture, AgradCdfLogistic_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_102, AgradCdfTestFixture, AgradCdfLogistic_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_103, AgradCdfTestFixture, AgradCdfLogistic_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_104, AgradCdfTestFixture, AgradCdfLogistic_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_105, AgradCdfTestFixture, AgradCdfLogistic_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_106, AgradCdfTestFixture, AgradCdfLogistic_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_107, AgradCdfTestFixture, AgradCdfLogistic_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_108, AgradCdfTestFixture, AgradCdfLogistic_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_109, AgradCdfTestFixture, AgradCdfLogistic_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_110, AgradCdfTestFixture, AgradCdfLogistic_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_111, AgradCdfTestFixture, AgradCdfLogistic_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_112, AgradCdfTestFixture, AgradCdfLogistic_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_113, AgradCdfTestFixture, AgradCdfLogistic_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_114, AgradCdfTestFixture, AgradCdfLogistic_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_115, AgradCdfTestFixture, AgradCdfLogistic_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_116, AgradCdfTestFixture, AgradCdfLogistic_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_117, AgradCdfTestFixture, AgradCdfLogistic_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_118, AgradCdfTestFixture, AgradCdfLogistic_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_119, AgradCdfTestFixture, AgradCdfLogistic_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_120, AgradCdfTestFixture, AgradCdfLogistic_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_121, AgradCdfTestFixture, AgradCdfLogistic_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_122, AgradCdfTestFixture, AgradCdfLogistic_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_123, AgradCdfTestFixture, AgradCdfLogistic_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_124, AgradCdfTestFixture, AgradCdfLogistic_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_125, AgradCdfTestFixture, AgradCdfLogistic_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_126, AgradCdfTestFixture, AgradCdfLogistic_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_127, AgradCdfTestFixture, AgradCdfLogistic_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_128, AgradCdfTestFixture, AgradCdfLogistic_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_129, AgradCdfTestFixture, AgradCdfLogistic_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_130, AgradCdfTestFixture, AgradCdfLogistic_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_131, AgradCdfTestFixture, AgradCdfLogistic_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_132, AgradCdfTestFixture, AgradCdfLogistic_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_133, AgradCdfTestFixture, AgradCdfLogistic_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_134, AgradCdfTestFixture, AgradCdfLogistic_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_135, AgradCdfTestFixture, AgradCdfLogistic_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_136, AgradCdfTestFixture, AgradCdfLogistic_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_137, AgradCdfTestFixture, AgradCdfLogistic_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_138, AgradCdfTestFixture, AgradCdfLogistic_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_139, AgradCdfTestFixture, AgradCdfLogistic_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_140, AgradCdfTestFixture, AgradCdfLogistic_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_141, AgradCdfTestFixture, AgradCdfLogistic_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_142, AgradCdfTestFixture, AgradCdfLogistic_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_143, AgradCdfTestFixture, AgradCdfLogistic_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_144, AgradCdfTestFixture, AgradCdfLogistic_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_145, AgradCdfTestFixture, AgradCdfLogistic_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_146, AgradCdfTestFixture, AgradCdfLogistic_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_147, AgradCdfTestFixture, AgradCdfLogistic_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_148, AgradCdfTestFixture, AgradCdfLogistic_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_149, AgradCdfTestFixture, AgradCdfLogistic_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_150, AgradCdfTestFixture, AgradCdfLogistic_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_151, AgradCdfTestFixture, AgradCdfLogistic_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_152, AgradCdfTestFixture, AgradCdfLogistic_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_153, AgradCdfTestFixture, AgradCdfLogistic_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_154, AgradCdfTestFixture, AgradCdfLogistic_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_155, AgradCdfTestFixture, AgradCdfLogistic_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_156, AgradCdfTestFixture, AgradCdfLogistic_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_157, AgradCdfTestFixture, AgradCdfLogistic_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_158, AgradCdfTestFixture, AgradCdfLogistic_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_159, AgradCdfTestFixture, AgradCdfLogistic_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_160, AgradCdfTestFixture, AgradCdfLogistic_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_161, AgradCdfTestFixture, AgradCdfLogistic_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_162, AgradCdfTestFixture, AgradCdfLogistic_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_163, AgradCdfTestFixture, AgradCdfLogistic_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_164, AgradCdfTestFixture, AgradCdfLogistic_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_165, AgradCdfTestFixture, AgradCdfLogistic_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_166, AgradCdfTestFixture, AgradCdfLogistic_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_167, AgradCdfTestFixture, AgradCdfLogistic_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_168, AgradCdfTestFixture, AgradCdfLogistic_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_169, AgradCdfTestFixture, AgradCdfLogistic_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_170, AgradCdfTestFixture, AgradCdfLogistic_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_171, AgradCdfTestFixture, AgradCdfLogistic_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_172, AgradCdfTestFixture, AgradCdfLogistic_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_173, AgradCdfTestFixture, AgradCdfLogistic_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_174, AgradCdfTestFixture, AgradCdfLogistic_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_175, AgradCdfTestFixture, AgradCdfLogistic_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_176, AgradCdfTestFixture, AgradCdfLogistic_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_177, AgradCdfTestFixture, AgradCdfLogistic_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_178, AgradCdfTestFixture, AgradCdfLogistic_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_179, AgradCdfTestFixture, AgradCdfLogistic_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_180, AgradCdfTestFixture, AgradCdfLogistic_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_181, AgradCdfTestFixture, AgradCdfLogistic_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_182, AgradCdfTestFixture, AgradCdfLogistic_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_183, AgradCdfTestFixture, AgradCdfLogistic_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_184, AgradCdfTestFixture, AgradCdfLogistic_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_185, AgradCdfTestFixture, AgradCdfLogistic_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_186, AgradCdfTestFixture, AgradCdfLogistic_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_187, AgradCdfTestFixture, AgradCdfLogistic_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogistic_vv_188, AgradCdfTestFixture, AgradCdfLogistic_vv_188);
+
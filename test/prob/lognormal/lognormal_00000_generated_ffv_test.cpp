@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_0> AgradDistributionsLognormal_ffv_0;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_1> AgradDistributionsLognormal_ffv_1;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_2> AgradDistributionsLognormal_ffv_2;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_3> AgradDistributionsLognormal_ffv_3;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_4> AgradDistributionsLognormal_ffv_4;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_5> AgradDistributionsLognormal_ffv_5;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_6> AgradDistributionsLognormal_ffv_6;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_7> AgradDistributionsLognormal_ffv_7;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_8> AgradDistributionsLognormal_ffv_8;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_9> AgradDistributionsLognormal_ffv_9;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_10> AgradDistributionsLognormal_ffv_10;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_11> AgradDistributionsLognormal_ffv_11;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_12> AgradDistributionsLognormal_ffv_12;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_13> AgradDistributionsLognormal_ffv_13;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_14> AgradDistributionsLognormal_ffv_14;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_15> AgradDistributionsLognormal_ffv_15;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_16> AgradDistributionsLognormal_ffv_16;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_17> AgradDistributionsLognormal_ffv_17;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_18> AgradDistributionsLognormal_ffv_18;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_19> AgradDistributionsLognormal_ffv_19;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_20> AgradDistributionsLognormal_ffv_20;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_21> AgradDistributionsLognormal_ffv_21;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_22> AgradDistributionsLognormal_ffv_22;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_23> AgradDistributionsLognormal_ffv_23;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_24> AgradDistributionsLognormal_ffv_24;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_25> AgradDistributionsLognormal_ffv_25;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_26> AgradDistributionsLognormal_ffv_26;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_27> AgradDistributionsLognormal_ffv_27;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_28> AgradDistributionsLognormal_ffv_28;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_29> AgradDistributionsLognormal_ffv_29;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_30> AgradDistributionsLognormal_ffv_30;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_31> AgradDistributionsLognormal_ffv_31;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_32> AgradDistributionsLognormal_ffv_32;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_33> AgradDistributionsLognormal_ffv_33;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_34> AgradDistributionsLognormal_ffv_34;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_35> AgradDistributionsLognormal_ffv_35;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_36> AgradDistributionsLognormal_ffv_36;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_37> AgradDistributionsLognormal_ffv_37;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_38> AgradDistributionsLognormal_ffv_38;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_39> AgradDistributionsLognormal_ffv_39;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_40> AgradDistributionsLognormal_ffv_40;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_41> AgradDistributionsLognormal_ffv_41;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_42> AgradDistributionsLognormal_ffv_42;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_43> AgradDistributionsLognormal_ffv_43;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_44> AgradDistributionsLognormal_ffv_44;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_45> AgradDistributionsLognormal_ffv_45;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_46> AgradDistributionsLognormal_ffv_46;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_47> AgradDistributionsLognormal_ffv_47;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_48> AgradDistributionsLognormal_ffv_48;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_49> AgradDistributionsLognormal_ffv_49;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_50> AgradDistributionsLognormal_ffv_50;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_51> AgradDistributionsLognormal_ffv_51;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_52> AgradDistributionsLognormal_ffv_52;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_53> AgradDistributionsLognormal_ffv_53;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_54> AgradDistributionsLognormal_ffv_54;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_55> AgradDistributionsLognormal_ffv_55;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_56> AgradDistributionsLognormal_ffv_56;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_57> AgradDistributionsLognormal_ffv_57;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_58> AgradDistributionsLognormal_ffv_58;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_59> AgradDistributionsLognormal_ffv_59;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_60> AgradDistributionsLognormal_ffv_60;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_61> AgradDistributionsLognormal_ffv_61;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_62> AgradDistributionsLognormal_ffv_62;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_63> AgradDistributionsLognormal_ffv_63;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_64> AgradDistributionsLognormal_ffv_64;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_65> AgradDistributionsLognormal_ffv_65;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_66> AgradDistributionsLognormal_ffv_66;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_67> AgradDistributionsLognormal_ffv_67;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_68> AgradDistributionsLognormal_ffv_68;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_69> AgradDistributionsLognormal_ffv_69;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_70> AgradDistributionsLognormal_ffv_70;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_71> AgradDistributionsLognormal_ffv_71;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_72> AgradDistributionsLognormal_ffv_72;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_73> AgradDistributionsLognormal_ffv_73;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_74> AgradDistributionsLognormal_ffv_74;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_75> AgradDistributionsLognormal_ffv_75;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_76> AgradDistributionsLognormal_ffv_76;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_77> AgradDistributionsLognormal_ffv_77;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_78> AgradDistributionsLognormal_ffv_78;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_79> AgradDistributionsLognormal_ffv_79;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_80> AgradDistributionsLognormal_ffv_80;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_81> AgradDistributionsLognormal_ffv_81;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_82> AgradDistributionsLognormal_ffv_82;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_83> AgradDistributionsLognormal_ffv_83;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_84> AgradDistributionsLognormal_ffv_84;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_85> AgradDistributionsLognormal_ffv_85;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_86> AgradDistributionsLognormal_ffv_86;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_87> AgradDistributionsLognormal_ffv_87;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_88> AgradDistributionsLognormal_ffv_88;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_89> AgradDistributionsLognormal_ffv_89;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_90> AgradDistributionsLognormal_ffv_90;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_91> AgradDistributionsLognormal_ffv_91;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_92> AgradDistributionsLognormal_ffv_92;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_93> AgradDistributionsLognormal_ffv_93;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_94> AgradDistributionsLognormal_ffv_94;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_95> AgradDistributionsLognormal_ffv_95;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_96> AgradDistributionsLognormal_ffv_96;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_97> AgradDistributionsLognormal_ffv_97;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_98> AgradDistributionsLognormal_ffv_98;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_99> AgradDistributionsLognormal_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_0, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_1, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_2, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_3, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_4, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_5, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_6, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_7, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_8, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_9, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_10, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_11, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_12, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_13, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_14, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_15, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_16, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_17, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_18, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_19, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_20, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_21, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_22, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_23, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_24, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_25, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_26, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_27, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_28, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_29, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_30, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_31, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_32, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_33, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_34, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_35, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_36, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_37, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_38, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_39, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_40, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_41, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_42, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_43, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_44, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_45, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_46, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_47, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_48, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_49, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_50, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_51, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_52, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_53, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_54, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_55, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_56, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_57, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_58, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_59, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_60, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_61, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_62, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_63, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_64, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_65, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_66, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_67, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_68, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_69, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_70, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_71, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_72, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_73, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_74, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_75, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_76, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_77, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_78, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_79, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_80, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_81, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_82, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_83, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_84, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_85, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_86, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_87, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_88, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_89, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_90, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_91, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_92, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_93, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_94, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_95, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_96, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_97, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_98, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_99, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsLognormal, type_v_0> AgradDistributionsLognormal_v_0;
+typedef std::tuple<AgradDistributionsLognormal, type_v_1> AgradDistributionsLognormal_v_1;
+typedef std::tuple<AgradDistributionsLognormal, type_v_2> AgradDistributionsLognormal_v_2;
+typedef std::tuple<AgradDistributionsLognormal, type_v_3> AgradDistributionsLognormal_v_3;
+typedef std::tuple<AgradDistributionsLognormal, type_v_4> AgradDistributionsLognormal_v_4;
+typedef std::tuple<AgradDistributionsLognormal, type_v_5> AgradDistributionsLognormal_v_5;
+typedef std::tuple<AgradDistributionsLognormal, type_v_6> AgradDistributionsLognormal_v_6;
+typedef std::tuple<AgradDistributionsLognormal, type_v_7> AgradDistributionsLognormal_v_7;
+typedef std::tuple<AgradDistributionsLognormal, type_v_8> AgradDistributionsLognormal_v_8;
+typedef std::tuple<AgradDistributionsLognormal, type_v_9> AgradDistributionsLognormal_v_9;
+typedef std::tuple<AgradDistributionsLognormal, type_v_10> AgradDistributionsLognormal_v_10;
+typedef std::tuple<AgradDistributionsLognormal, type_v_11> AgradDistributionsLognormal_v_11;
+typedef std::tuple<AgradDistributionsLognormal, type_v_12> AgradDistributionsLognormal_v_12;
+typedef std::tuple<AgradDistributionsLognormal, type_v_13> AgradDistributionsLognormal_v_13;
+typedef std::tuple<AgradDistributionsLognormal, type_v_14> AgradDistributionsLognormal_v_14;
+typedef std::tuple<AgradDistributionsLognormal, type_v_15> AgradDistributionsLognormal_v_15;
+typedef std::tuple<AgradDistributionsLognormal, type_v_16> AgradDistributionsLognormal_v_16;
+typedef std::tuple<AgradDistributionsLognormal, type_v_17> AgradDistributionsLognormal_v_17;
+typedef std::tuple<AgradDistributionsLognormal, type_v_18> AgradDistributionsLognormal_v_18;
+typedef std::tuple<AgradDistributionsLognormal, type_v_19> AgradDistributionsLognormal_v_19;
+typedef std::tuple<AgradDistributionsLognormal, type_v_20> AgradDistributionsLognormal_v_20;
+typedef std::tuple<AgradDistributionsLognormal, type_v_21> AgradDistributionsLognormal_v_21;
+typedef std::tuple<AgradDistributionsLognormal, type_v_22> AgradDistributionsLognormal_v_22;
+typedef std::tuple<AgradDistributionsLognormal, type_v_23> AgradDistributionsLognormal_v_23;
+typedef std::tuple<AgradDistributionsLognormal, type_v_24> AgradDistributionsLognormal_v_24;
+typedef std::tuple<AgradDistributionsLognormal, type_v_25> AgradDistributionsLognormal_v_25;
+typedef std::tuple<AgradDistributionsLognormal, type_v_26> AgradDistributionsLognormal_v_26;
+typedef std::tuple<AgradDistributionsLognormal, type_v_27> AgradDistributionsLognormal_v_27;
+typedef std::tuple<AgradDistributionsLognormal, type_v_28> AgradDistributionsLognormal_v_28;
+typedef std::tuple<AgradDistributionsLognormal, type_v_29> AgradDistributionsLognormal_v_29;
+typedef std::tuple<AgradDistributionsLognormal, type_v_30> AgradDistributionsLognormal_v_30;
+typedef std::tuple<AgradDistributionsLognormal, type_v_31> AgradDistributionsLognormal_v_31;
+typedef std::tuple<AgradDistributionsLognormal, type_v_32> AgradDistributionsLognormal_v_32;
+typedef std::tuple<AgradDistributionsLognormal, type_v_33> AgradDistributionsLognormal_v_33;
+typedef std::tuple<AgradDistributionsLognormal, type_v_34> AgradDistributionsLognormal_v_34;
+typedef std::tuple<AgradDistributionsLognormal, type_v_35> AgradDistributionsLognormal_v_35;
+typedef std::tuple<AgradDistributionsLognormal, type_v_36> AgradDistributionsLognormal_v_36;
+typedef std::tuple<AgradDistributionsLognormal, type_v_37> AgradDistributionsLognormal_v_37;
+typedef std::tuple<AgradDistributionsLognormal, type_v_38> AgradDistributionsLognormal_v_38;
+typedef std::tuple<AgradDistributionsLognormal, type_v_39> AgradDistributionsLognormal_v_39;
+typedef std::tuple<AgradDistributionsLognormal, type_v_40> AgradDistributionsLognormal_v_40;
+typedef std::tuple<AgradDistributionsLognormal, type_v_41> AgradDistributionsLognormal_v_41;
+typedef std::tuple<AgradDistributionsLognormal, type_v_42> AgradDistributionsLognormal_v_42;
+typedef std::tuple<AgradDistributionsLognormal, type_v_43> AgradDistributionsLognormal_v_43;
+typedef std::tuple<AgradDistributionsLognormal, type_v_44> AgradDistributionsLognormal_v_44;
+typedef std::tuple<AgradDistributionsLognormal, type_v_45> AgradDistributionsLognormal_v_45;
+typedef std::tuple<AgradDistributionsLognormal, type_v_46> AgradDistributionsLognormal_v_46;
+typedef std::tuple<AgradDistributionsLognormal, type_v_47> AgradDistributionsLognormal_v_47;
+typedef std::tuple<AgradDistributionsLognormal, type_v_48> AgradDistributionsLognormal_v_48;
+typedef std::tuple<AgradDistributionsLognormal, type_v_49> AgradDistributionsLognormal_v_49;
+typedef std::tuple<AgradDistributionsLognormal, type_v_50> AgradDistributionsLognormal_v_50;
+typedef std::tuple<AgradDistributionsLognormal, type_v_51> AgradDistributionsLognormal_v_51;
+typedef std::tuple<AgradDistributionsLognormal, type_v_52> AgradDistributionsLognormal_v_52;
+typedef std::tuple<AgradDistributionsLognormal, type_v_53> AgradDistributionsLognormal_v_53;
+typedef std::tuple<AgradDistributionsLognormal, type_v_54> AgradDistributionsLognormal_v_54;
+typedef std::tuple<AgradDistributionsLognormal, type_v_55> AgradDistributionsLognormal_v_55;
+typedef std::tuple<AgradDistributionsLognormal, type_v_56> AgradDistributionsLognormal_v_56;
+typedef std::tuple<AgradDistributionsLognormal, type_v_57> AgradDistributionsLognormal_v_57;
+typedef std::tuple<AgradDistributionsLognormal, type_v_58> AgradDistributionsLognormal_v_58;
+typedef std::tuple<AgradDistributionsLognormal, type_v_59> AgradDistributionsLognormal_v_59;
+typedef std::tuple<AgradDistributionsLognormal, type_v_60> AgradDistributionsLognormal_v_60;
+typedef std::tuple<AgradDistributionsLognormal, type_v_61> AgradDistributionsLognormal_v_61;
+typedef std::tuple<AgradDistributionsLognormal, type_v_62> AgradDistributionsLognormal_v_62;
+typedef std::tuple<AgradDistributionsLognormal, type_v_63> AgradDistributionsLognormal_v_63;
+typedef std::tuple<AgradDistributionsLognormal, type_v_64> AgradDistributionsLognormal_v_64;
+typedef std::tuple<AgradDistributionsLognormal, type_v_65> AgradDistributionsLognormal_v_65;
+typedef std::tuple<AgradDistributionsLognormal, type_v_66> AgradDistributionsLognormal_v_66;
+typedef std::tuple<AgradDistributionsLognormal, type_v_67> AgradDistributionsLognormal_v_67;
+typedef std::tuple<AgradDistributionsLognormal, type_v_68> AgradDistributionsLognormal_v_68;
+typedef std::tuple<AgradDistributionsLognormal, type_v_69> AgradDistributionsLognormal_v_69;
+typedef std::tuple<AgradDistributionsLognormal, type_v_70> AgradDistributionsLognormal_v_70;
+typedef std::tuple<AgradDistributionsLognormal, type_v_71> AgradDistributionsLognormal_v_71;
+typedef std::tuple<AgradDistributionsLognormal, type_v_72> AgradDistributionsLognormal_v_72;
+typedef std::tuple<AgradDistributionsLognormal, type_v_73> AgradDistributionsLognormal_v_73;
+typedef std::tuple<AgradDistributionsLognormal, type_v_74> AgradDistributionsLognormal_v_74;
+typedef std::tuple<AgradDistributionsLognormal, type_v_75> AgradDistributionsLognormal_v_75;
+typedef std::tuple<AgradDistributionsLognormal, type_v_76> AgradDistributionsLognormal_v_76;
+typedef std::tuple<AgradDistributionsLognormal, type_v_77> AgradDistributionsLognormal_v_77;
+typedef std::tuple<AgradDistributionsLognormal, type_v_78> AgradDistributionsLognormal_v_78;
+typedef std::tuple<AgradDistributionsLognormal, type_v_79> AgradDistributionsLognormal_v_79;
+typedef std::tuple<AgradDistributionsLognormal, type_v_80> AgradDistributionsLognormal_v_80;
+typedef std::tuple<AgradDistributionsLognormal, type_v_81> AgradDistributionsLognormal_v_81;
+typedef std::tuple<AgradDistributionsLognormal, type_v_82> AgradDistributionsLognormal_v_82;
+typedef std::tuple<AgradDistributionsLognormal, type_v_83> AgradDistributionsLognormal_v_83;
+typedef std::tuple<AgradDistributionsLognormal, type_v_84> AgradDistributionsLognormal_v_84;
+typedef std::tuple<AgradDistributionsLognormal, type_v_85> AgradDistributionsLognormal_v_85;
+typedef std::tuple<AgradDistributionsLognormal, type_v_86> AgradDistributionsLognormal_v_86;
+typedef std::tuple<AgradDistributionsLognormal, type_v_87> AgradDistributionsLognormal_v_87;
+typedef std::tuple<AgradDistributionsLognormal, type_v_88> AgradDistributionsLognormal_v_88;
+typedef std::tuple<AgradDistributionsLognormal, type_v_89> AgradDistributionsLognormal_v_89;
+typedef std::tuple<AgradDistributionsLognormal, type_v_90> AgradDistributionsLognormal_v_90;
+typedef std::tuple<AgradDistributionsLognormal, type_v_91> AgradDistributionsLognormal_v_91;
+typedef std::tuple<AgradDistributionsLognormal, type_v_92> AgradDistributionsLognormal_v_92;
+typedef std::tuple<AgradDistributionsLognormal, type_v_93> AgradDistributionsLognormal_v_93;
+typedef std::tuple<AgradDistributionsLognormal, type_v_94> AgradDistributionsLognormal_v_94;
+typedef std::tuple<AgradDistributionsLognormal, type_v_95> AgradDistributionsLognormal_v_95;
+typedef std::tuple<AgradDistributionsLognormal, type_v_96> AgradDistributionsLognormal_v_96;
+typedef std::tuple<AgradDistributionsLognormal, type_v_97> AgradDistributionsLognormal_v_97;
+typedef std::tuple<AgradDistributionsLognormal, type_v_98> AgradDistributionsLognormal_v_98;
+typedef std::tuple<AgradDistributionsLognormal, type_v_99> AgradDistributionsLognormal_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_0, AgradDistributionTestFixture, AgradDistributionsLognormal_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_1, AgradDistributionTestFixture, AgradDistributionsLognormal_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_2, AgradDistributionTestFixture, AgradDistributionsLognormal_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_3, AgradDistributionTestFixture, AgradDistributionsLognormal_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_4, AgradDistributionTestFixture, AgradDistributionsLognormal_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_5, AgradDistributionTestFixture, AgradDistributionsLognormal_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_6, AgradDistributionTestFixture, AgradDistributionsLognormal_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_7, AgradDistributionTestFixture, AgradDistributionsLognormal_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_8, AgradDistributionTestFixture, AgradDistributionsLognormal_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_9, AgradDistributionTestFixture, AgradDistributionsLognormal_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_10, AgradDistributionTestFixture, AgradDistributionsLognormal_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_11, AgradDistributionTestFixture, AgradDistributionsLognormal_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_12, AgradDistributionTestFixture, AgradDistributionsLognormal_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_13, AgradDistributionTestFixture, AgradDistributionsLognormal_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_14, AgradDistributionTestFixture, AgradDistributionsLognormal_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_15, AgradDistributionTestFixture, AgradDistributionsLognormal_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_16, AgradDistributionTestFixture, AgradDistributionsLognormal_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_17, AgradDistributionTestFixture, AgradDistributionsLognormal_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_18, AgradDistributionTestFixture, AgradDistributionsLognormal_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_19, AgradDistributionTestFixture, AgradDistributionsLognormal_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_20, AgradDistributionTestFixture, AgradDistributionsLognormal_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_21, AgradDistributionTestFixture, AgradDistributionsLognormal_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_22, AgradDistributionTestFixture, AgradDistributionsLognormal_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_23, AgradDistributionTestFixture, AgradDistributionsLognormal_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_24, AgradDistributionTestFixture, AgradDistributionsLognormal_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_25, AgradDistributionTestFixture, AgradDistributionsLognormal_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_26, AgradDistributionTestFixture, AgradDistributionsLognormal_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_27, AgradDistributionTestFixture, AgradDistributionsLognormal_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_28, AgradDistributionTestFixture, AgradDistributionsLognormal_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_29, AgradDistributionTestFixture, AgradDistributionsLognormal_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_30, AgradDistributionTestFixture, AgradDistributionsLognormal_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_31, AgradDistributionTestFixture, AgradDistributionsLognormal_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_32, AgradDistributionTestFixture, AgradDistributionsLognormal_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_33, AgradDistributionTestFixture, AgradDistributionsLognormal_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_34, AgradDistributionTestFixture, AgradDistributionsLognormal_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_35, AgradDistributionTestFixture, AgradDistributionsLognormal_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_36, AgradDistributionTestFixture, AgradDistributionsLognormal_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_37, AgradDistributionTestFixture, AgradDistributionsLognormal_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_38, AgradDistributionTestFixture, AgradDistributionsLognormal_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_39, AgradDistributionTestFixture, AgradDistributionsLognormal_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_40, AgradDistributionTestFixture, AgradDistributionsLognormal_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_41, AgradDistributionTestFixture, AgradDistributionsLognormal_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_42, AgradDistributionTestFixture, AgradDistributionsLognormal_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_43, AgradDistributionTestFixture, AgradDistributionsLognormal_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_44, AgradDistributionTestFixture, AgradDistributionsLognormal_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_45, AgradDistributionTestFixture, AgradDistributionsLognormal_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_46, AgradDistributionTestFixture, AgradDistributionsLognormal_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_47, AgradDistributionTestFixture, AgradDistributionsLognormal_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_48, AgradDistributionTestFixture, AgradDistributionsLognormal_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_49, AgradDistributionTestFixture, AgradDistributionsLognormal_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_50, AgradDistributionTestFixture, AgradDistributionsLognormal_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_51, AgradDistributionTestFixture, AgradDistributionsLognormal_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_52, AgradDistributionTestFixture, AgradDistributionsLognormal_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_53, AgradDistributionTestFixture, AgradDistributionsLognormal_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_54, AgradDistributionTestFixture, AgradDistributionsLognormal_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_55, AgradDistributionTestFixture, AgradDistributionsLognormal_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_56, AgradDistributionTestFixture, AgradDistributionsLognormal_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_57, AgradDistributionTestFixture, AgradDistributionsLognormal_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_58, AgradDistributionTestFixture, AgradDistributionsLognormal_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_59, AgradDistributionTestFixture, AgradDistributionsLognormal_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_60, AgradDistributionTestFixture, AgradDistributionsLognormal_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_61, AgradDistributionTestFixture, AgradDistributionsLognormal_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_62, AgradDistributionTestFixture, AgradDistributionsLognormal_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_63, AgradDistributionTestFixture, AgradDistributionsLognormal_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_64, AgradDistributionTestFixture, AgradDistributionsLognormal_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_65, AgradDistributionTestFixture, AgradDistributionsLognormal_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_66, AgradDistributionTestFixture, AgradDistributionsLognormal_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_67, AgradDistributionTestFixture, AgradDistributionsLognormal_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_68, AgradDistributionTestFixture, AgradDistributionsLognormal_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_69, AgradDistributionTestFixture, AgradDistributionsLognormal_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_70, AgradDistributionTestFixture, AgradDistributionsLognormal_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_71, AgradDistributionTestFixture, AgradDistributionsLognormal_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_72, AgradDistributionTestFixture, AgradDistributionsLognormal_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_73, AgradDistributionTestFixture, AgradDistributionsLognormal_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_74, AgradDistributionTestFixture, AgradDistributionsLognormal_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_75, AgradDistributionTestFixture, AgradDistributionsLognormal_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_76, AgradDistributionTestFixture, AgradDistributionsLognormal_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_77, AgradDistributionTestFixture, AgradDistributionsLognormal_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_78, AgradDistributionTestFixture, AgradDistributionsLognormal_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_79, AgradDistributionTestFixture, AgradDistributionsLognormal_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_80, AgradDistributionTestFixture, AgradDistributionsLognormal_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_81, AgradDistributionTestFixture, AgradDistributionsLognormal_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_82, AgradDistributionTestFixture, AgradDistributionsLognormal_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_83, AgradDistributionTestFixture, AgradDistributionsLognormal_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_84, AgradDistributionTestFixture, AgradDistributionsLognormal_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_85, AgradDistributionTestFixture, AgradDistributionsLognormal_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_86, AgradDistributionTestFixture, AgradDistributionsLognormal_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_87, AgradDistributionTestFixture, AgradDistributionsLognormal_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_88, AgradDistributionTestFixture, AgradDistributionsLognormal_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_89, AgradDistributionTestFixture, AgradDistributionsLognormal_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_90, AgradDistributionTestFixture, AgradDistributionsLognormal_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_91, AgradDistributionTestFixture, AgradDistributionsLognormal_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_92, AgradDistributionTestFixture, AgradDistributionsLognormal_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_93, AgradDistributionTestFixture, AgradDistributionsLognormal_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_94, AgradDistributionTestFixture, AgradDistributionsLognormal_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_95, AgradDistributionTestFixture, AgradDistributionsLognormal_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_96, AgradDistributionTestFixture, AgradDistributionsLognormal_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_97, AgradDistributionTestFixture, AgradDistributionsLognormal_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_98, AgradDistributionTestFixture, AgradDistributionsLognormal_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_99, AgradDistributionTestFixture, AgradDistributionsLognormal_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsLognormal, type_vv_0> AgradDistributionsLognormal_vv_0;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_1> AgradDistributionsLognormal_vv_1;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_2> AgradDistributionsLognormal_vv_2;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_3> AgradDistributionsLognormal_vv_3;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_4> AgradDistributionsLognormal_vv_4;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_5> AgradDistributionsLognormal_vv_5;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_6> AgradDistributionsLognormal_vv_6;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_7> AgradDistributionsLognormal_vv_7;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_8> AgradDistributionsLognormal_vv_8;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_9> AgradDistributionsLognormal_vv_9;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_10> AgradDistributionsLognormal_vv_10;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_11> AgradDistributionsLognormal_vv_11;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_12> AgradDistributionsLognormal_vv_12;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_13> AgradDistributionsLognormal_vv_13;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_14> AgradDistributionsLognormal_vv_14;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_15> AgradDistributionsLognormal_vv_15;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_16> AgradDistributionsLognormal_vv_16;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_17> AgradDistributionsLognormal_vv_17;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_18> AgradDistributionsLognormal_vv_18;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_19> AgradDistributionsLognormal_vv_19;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_20> AgradDistributionsLognormal_vv_20;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_21> AgradDistributionsLognormal_vv_21;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_22> AgradDistributionsLognormal_vv_22;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_23> AgradDistributionsLognormal_vv_23;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_24> AgradDistributionsLognormal_vv_24;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_25> AgradDistributionsLognormal_vv_25;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_26> AgradDistributionsLognormal_vv_26;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_27> AgradDistributionsLognormal_vv_27;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_28> AgradDistributionsLognormal_vv_28;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_29> AgradDistributionsLognormal_vv_29;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_30> AgradDistributionsLognormal_vv_30;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_31> AgradDistributionsLognormal_vv_31;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_32> AgradDistributionsLognormal_vv_32;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_33> AgradDistributionsLognormal_vv_33;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_34> AgradDistributionsLognormal_vv_34;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_35> AgradDistributionsLognormal_vv_35;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_36> AgradDistributionsLognormal_vv_36;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_37> AgradDistributionsLognormal_vv_37;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_38> AgradDistributionsLognormal_vv_38;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_39> AgradDistributionsLognormal_vv_39;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_40> AgradDistributionsLognormal_vv_40;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_41> AgradDistributionsLognormal_vv_41;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_42> AgradDistributionsLognormal_vv_42;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_43> AgradDistributionsLognormal_vv_43;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_44> AgradDistributionsLognormal_vv_44;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_45> AgradDistributionsLognormal_vv_45;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_46> AgradDistributionsLognormal_vv_46;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_47> AgradDistributionsLognormal_vv_47;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_48> AgradDistributionsLognormal_vv_48;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_49> AgradDistributionsLognormal_vv_49;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_50> AgradDistributionsLognormal_vv_50;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_51> AgradDistributionsLognormal_vv_51;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_52> AgradDistributionsLognormal_vv_52;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_53> AgradDistributionsLognormal_vv_53;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_54> AgradDistributionsLognormal_vv_54;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_55> AgradDistributionsLognormal_vv_55;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_56> AgradDistributionsLognormal_vv_56;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_57> AgradDistributionsLognormal_vv_57;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_58> AgradDistributionsLognormal_vv_58;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_59> AgradDistributionsLognormal_vv_59;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_60> AgradDistributionsLognormal_vv_60;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_61> AgradDistributionsLognormal_vv_61;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_62> AgradDistributionsLognormal_vv_62;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_63> AgradDistributionsLognormal_vv_63;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_64> AgradDistributionsLognormal_vv_64;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_65> AgradDistributionsLognormal_vv_65;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_66> AgradDistributionsLognormal_vv_66;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_67> AgradDistributionsLognormal_vv_67;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_68> AgradDistributionsLognormal_vv_68;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_69> AgradDistributionsLognormal_vv_69;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_70> AgradDistributionsLognormal_vv_70;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_71> AgradDistributionsLognormal_vv_71;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_72> AgradDistributionsLognormal_vv_72;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_73> AgradDistributionsLognormal_vv_73;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_74> AgradDistributionsLognormal_vv_74;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_75> AgradDistributionsLognormal_vv_75;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_76> AgradDistributionsLognormal_vv_76;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_77> AgradDistributionsLognormal_vv_77;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_78> AgradDistributionsLognormal_vv_78;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_79> AgradDistributionsLognormal_vv_79;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_80> AgradDistributionsLognormal_vv_80;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_81> AgradDistributionsLognormal_vv_81;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_82> AgradDistributionsLognormal_vv_82;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_83> AgradDistributionsLognormal_vv_83;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_84> AgradDistributionsLognormal_vv_84;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_85> AgradDistributionsLognormal_vv_85;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_86> AgradDistributionsLognormal_vv_86;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_87> AgradDistributionsLognormal_vv_87;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_88> AgradDistributionsLognormal_vv_88;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_89> AgradDistributionsLognormal_vv_89;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_90> AgradDistributionsLognormal_vv_90;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_91> AgradDistributionsLognormal_vv_91;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_92> AgradDistributionsLognormal_vv_92;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_93> AgradDistributionsLognormal_vv_93;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_94> AgradDistributionsLognormal_vv_94;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_95> AgradDistributionsLognormal_vv_95;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_96> AgradDistributionsLognormal_vv_96;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_97> AgradDistributionsLognormal_vv_97;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_98> AgradDistributionsLognormal_vv_98;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_99> AgradDistributionsLognormal_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_0, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_1, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_2, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_3, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_4, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_5, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_6, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_7, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_8, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_9, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_10, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_11, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_12, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_13, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_14, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_15, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_16, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_17, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_18, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_19, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_20, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_21, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_22, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_23, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_24, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_25, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_26, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_27, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_28, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_29, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_30, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_31, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_32, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_33, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_34, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_35, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_36, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_37, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_38, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_39, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_40, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_41, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_42, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_43, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_44, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_45, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_46, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_47, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_48, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_49, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_50, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_51, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_52, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_53, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_54, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_55, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_56, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_57, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_58, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_59, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_60, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_61, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_62, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_63, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_64, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_65, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_66, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_67, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_68, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_69, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_70, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_71, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_72, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_73, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_74, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_75, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_76, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_77, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_78, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_79, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_80, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_81, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_82, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_83, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_84, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_85, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_86, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_87, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_88, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_89, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_90, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_91, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_92, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_93, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_94, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_95, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_96, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_97, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_98, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_99, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_100> AgradDistributionsLognormal_ffv_100;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_101> AgradDistributionsLognormal_ffv_101;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_102> AgradDistributionsLognormal_ffv_102;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_103> AgradDistributionsLognormal_ffv_103;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_104> AgradDistributionsLognormal_ffv_104;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_105> AgradDistributionsLognormal_ffv_105;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_106> AgradDistributionsLognormal_ffv_106;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_107> AgradDistributionsLognormal_ffv_107;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_108> AgradDistributionsLognormal_ffv_108;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_109> AgradDistributionsLognormal_ffv_109;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_110> AgradDistributionsLognormal_ffv_110;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_111> AgradDistributionsLognormal_ffv_111;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_112> AgradDistributionsLognormal_ffv_112;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_113> AgradDistributionsLognormal_ffv_113;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_114> AgradDistributionsLognormal_ffv_114;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_115> AgradDistributionsLognormal_ffv_115;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_116> AgradDistributionsLognormal_ffv_116;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_117> AgradDistributionsLognormal_ffv_117;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_118> AgradDistributionsLognormal_ffv_118;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_119> AgradDistributionsLognormal_ffv_119;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_120> AgradDistributionsLognormal_ffv_120;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_121> AgradDistributionsLognormal_ffv_121;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_122> AgradDistributionsLognormal_ffv_122;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_123> AgradDistributionsLognormal_ffv_123;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_124> AgradDistributionsLognormal_ffv_124;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_125> AgradDistributionsLognormal_ffv_125;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_126> AgradDistributionsLognormal_ffv_126;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_127> AgradDistributionsLognormal_ffv_127;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_128> AgradDistributionsLognormal_ffv_128;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_129> AgradDistributionsLognormal_ffv_129;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_130> AgradDistributionsLognormal_ffv_130;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_131> AgradDistributionsLognormal_ffv_131;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_132> AgradDistributionsLognormal_ffv_132;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_133> AgradDistributionsLognormal_ffv_133;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_134> AgradDistributionsLognormal_ffv_134;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_135> AgradDistributionsLognormal_ffv_135;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_136> AgradDistributionsLognormal_ffv_136;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_137> AgradDistributionsLognormal_ffv_137;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_138> AgradDistributionsLognormal_ffv_138;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_139> AgradDistributionsLognormal_ffv_139;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_140> AgradDistributionsLognormal_ffv_140;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_141> AgradDistributionsLognormal_ffv_141;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_142> AgradDistributionsLognormal_ffv_142;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_143> AgradDistributionsLognormal_ffv_143;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_144> AgradDistributionsLognormal_ffv_144;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_145> AgradDistributionsLognormal_ffv_145;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_146> AgradDistributionsLognormal_ffv_146;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_147> AgradDistributionsLognormal_ffv_147;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_148> AgradDistributionsLognormal_ffv_148;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_149> AgradDistributionsLognormal_ffv_149;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_150> AgradDistributionsLognormal_ffv_150;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_151> AgradDistributionsLognormal_ffv_151;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_152> AgradDistributionsLognormal_ffv_152;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_153> AgradDistributionsLognormal_ffv_153;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_154> AgradDistributionsLognormal_ffv_154;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_155> AgradDistributionsLognormal_ffv_155;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_156> AgradDistributionsLognormal_ffv_156;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_157> AgradDistributionsLognormal_ffv_157;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_158> AgradDistributionsLognormal_ffv_158;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_159> AgradDistributionsLognormal_ffv_159;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_160> AgradDistributionsLognormal_ffv_160;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_161> AgradDistributionsLognormal_ffv_161;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_162> AgradDistributionsLognormal_ffv_162;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_163> AgradDistributionsLognormal_ffv_163;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_164> AgradDistributionsLognormal_ffv_164;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_165> AgradDistributionsLognormal_ffv_165;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_166> AgradDistributionsLognormal_ffv_166;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_167> AgradDistributionsLognormal_ffv_167;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_168> AgradDistributionsLognormal_ffv_168;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_169> AgradDistributionsLognormal_ffv_169;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_170> AgradDistributionsLognormal_ffv_170;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_171> AgradDistributionsLognormal_ffv_171;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_172> AgradDistributionsLognormal_ffv_172;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_173> AgradDistributionsLognormal_ffv_173;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_174> AgradDistributionsLognormal_ffv_174;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_175> AgradDistributionsLognormal_ffv_175;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_176> AgradDistributionsLognormal_ffv_176;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_177> AgradDistributionsLognormal_ffv_177;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_178> AgradDistributionsLognormal_ffv_178;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_179> AgradDistributionsLognormal_ffv_179;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_180> AgradDistributionsLognormal_ffv_180;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_181> AgradDistributionsLognormal_ffv_181;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_182> AgradDistributionsLognormal_ffv_182;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_183> AgradDistributionsLognormal_ffv_183;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_184> AgradDistributionsLognormal_ffv_184;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_185> AgradDistributionsLognormal_ffv_185;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_186> AgradDistributionsLognormal_ffv_186;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_187> AgradDistributionsLognormal_ffv_187;
+typedef std::tuple<AgradDistributionsLognormal, type_ffv_188> AgradDistributionsLognormal_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_100, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_101, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_102, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_103, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_104, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_105, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_106, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_107, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_108, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_109, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_110, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_111, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_112, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_113, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_114, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_115, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_116, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_117, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_118, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_119, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_120, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_121, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_122, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_123, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_124, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_125, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_126, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_127, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_128, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_129, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_130, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_131, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_132, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_133, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_134, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_135, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_136, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_137, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_138, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_139, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_140, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_141, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_142, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_143, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_144, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_145, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_146, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_147, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_148, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_149, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_150, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_151, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_152, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_153, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_154, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_155, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_156, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_157, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_158, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_159, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_160, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_161, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_162, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_163, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_164, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_165, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_166, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_167, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_168, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_169, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_170, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_171, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_172, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_173, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_174, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_175, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_176, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_177, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_178, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_179, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_180, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_181, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_182, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_183, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_184, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_185, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_186, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_187, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_ffv_188, AgradDistributionTestFixture, AgradDistributionsLognormal_ffv_188);
+
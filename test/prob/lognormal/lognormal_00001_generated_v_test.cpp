@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsLognormal, type_v_100> AgradDistributionsLognormal_v_100;
+typedef std::tuple<AgradDistributionsLognormal, type_v_101> AgradDistributionsLognormal_v_101;
+typedef std::tuple<AgradDistributionsLognormal, type_v_102> AgradDistributionsLognormal_v_102;
+typedef std::tuple<AgradDistributionsLognormal, type_v_103> AgradDistributionsLognormal_v_103;
+typedef std::tuple<AgradDistributionsLognormal, type_v_104> AgradDistributionsLognormal_v_104;
+typedef std::tuple<AgradDistributionsLognormal, type_v_105> AgradDistributionsLognormal_v_105;
+typedef std::tuple<AgradDistributionsLognormal, type_v_106> AgradDistributionsLognormal_v_106;
+typedef std::tuple<AgradDistributionsLognormal, type_v_107> AgradDistributionsLognormal_v_107;
+typedef std::tuple<AgradDistributionsLognormal, type_v_108> AgradDistributionsLognormal_v_108;
+typedef std::tuple<AgradDistributionsLognormal, type_v_109> AgradDistributionsLognormal_v_109;
+typedef std::tuple<AgradDistributionsLognormal, type_v_110> AgradDistributionsLognormal_v_110;
+typedef std::tuple<AgradDistributionsLognormal, type_v_111> AgradDistributionsLognormal_v_111;
+typedef std::tuple<AgradDistributionsLognormal, type_v_112> AgradDistributionsLognormal_v_112;
+typedef std::tuple<AgradDistributionsLognormal, type_v_113> AgradDistributionsLognormal_v_113;
+typedef std::tuple<AgradDistributionsLognormal, type_v_114> AgradDistributionsLognormal_v_114;
+typedef std::tuple<AgradDistributionsLognormal, type_v_115> AgradDistributionsLognormal_v_115;
+typedef std::tuple<AgradDistributionsLognormal, type_v_116> AgradDistributionsLognormal_v_116;
+typedef std::tuple<AgradDistributionsLognormal, type_v_117> AgradDistributionsLognormal_v_117;
+typedef std::tuple<AgradDistributionsLognormal, type_v_118> AgradDistributionsLognormal_v_118;
+typedef std::tuple<AgradDistributionsLognormal, type_v_119> AgradDistributionsLognormal_v_119;
+typedef std::tuple<AgradDistributionsLognormal, type_v_120> AgradDistributionsLognormal_v_120;
+typedef std::tuple<AgradDistributionsLognormal, type_v_121> AgradDistributionsLognormal_v_121;
+typedef std::tuple<AgradDistributionsLognormal, type_v_122> AgradDistributionsLognormal_v_122;
+typedef std::tuple<AgradDistributionsLognormal, type_v_123> AgradDistributionsLognormal_v_123;
+typedef std::tuple<AgradDistributionsLognormal, type_v_124> AgradDistributionsLognormal_v_124;
+typedef std::tuple<AgradDistributionsLognormal, type_v_125> AgradDistributionsLognormal_v_125;
+typedef std::tuple<AgradDistributionsLognormal, type_v_126> AgradDistributionsLognormal_v_126;
+typedef std::tuple<AgradDistributionsLognormal, type_v_127> AgradDistributionsLognormal_v_127;
+typedef std::tuple<AgradDistributionsLognormal, type_v_128> AgradDistributionsLognormal_v_128;
+typedef std::tuple<AgradDistributionsLognormal, type_v_129> AgradDistributionsLognormal_v_129;
+typedef std::tuple<AgradDistributionsLognormal, type_v_130> AgradDistributionsLognormal_v_130;
+typedef std::tuple<AgradDistributionsLognormal, type_v_131> AgradDistributionsLognormal_v_131;
+typedef std::tuple<AgradDistributionsLognormal, type_v_132> AgradDistributionsLognormal_v_132;
+typedef std::tuple<AgradDistributionsLognormal, type_v_133> AgradDistributionsLognormal_v_133;
+typedef std::tuple<AgradDistributionsLognormal, type_v_134> AgradDistributionsLognormal_v_134;
+typedef std::tuple<AgradDistributionsLognormal, type_v_135> AgradDistributionsLognormal_v_135;
+typedef std::tuple<AgradDistributionsLognormal, type_v_136> AgradDistributionsLognormal_v_136;
+typedef std::tuple<AgradDistributionsLognormal, type_v_137> AgradDistributionsLognormal_v_137;
+typedef std::tuple<AgradDistributionsLognormal, type_v_138> AgradDistributionsLognormal_v_138;
+typedef std::tuple<AgradDistributionsLognormal, type_v_139> AgradDistributionsLognormal_v_139;
+typedef std::tuple<AgradDistributionsLognormal, type_v_140> AgradDistributionsLognormal_v_140;
+typedef std::tuple<AgradDistributionsLognormal, type_v_141> AgradDistributionsLognormal_v_141;
+typedef std::tuple<AgradDistributionsLognormal, type_v_142> AgradDistributionsLognormal_v_142;
+typedef std::tuple<AgradDistributionsLognormal, type_v_143> AgradDistributionsLognormal_v_143;
+typedef std::tuple<AgradDistributionsLognormal, type_v_144> AgradDistributionsLognormal_v_144;
+typedef std::tuple<AgradDistributionsLognormal, type_v_145> AgradDistributionsLognormal_v_145;
+typedef std::tuple<AgradDistributionsLognormal, type_v_146> AgradDistributionsLognormal_v_146;
+typedef std::tuple<AgradDistributionsLognormal, type_v_147> AgradDistributionsLognormal_v_147;
+typedef std::tuple<AgradDistributionsLognormal, type_v_148> AgradDistributionsLognormal_v_148;
+typedef std::tuple<AgradDistributionsLognormal, type_v_149> AgradDistributionsLognormal_v_149;
+typedef std::tuple<AgradDistributionsLognormal, type_v_150> AgradDistributionsLognormal_v_150;
+typedef std::tuple<AgradDistributionsLognormal, type_v_151> AgradDistributionsLognormal_v_151;
+typedef std::tuple<AgradDistributionsLognormal, type_v_152> AgradDistributionsLognormal_v_152;
+typedef std::tuple<AgradDistributionsLognormal, type_v_153> AgradDistributionsLognormal_v_153;
+typedef std::tuple<AgradDistributionsLognormal, type_v_154> AgradDistributionsLognormal_v_154;
+typedef std::tuple<AgradDistributionsLognormal, type_v_155> AgradDistributionsLognormal_v_155;
+typedef std::tuple<AgradDistributionsLognormal, type_v_156> AgradDistributionsLognormal_v_156;
+typedef std::tuple<AgradDistributionsLognormal, type_v_157> AgradDistributionsLognormal_v_157;
+typedef std::tuple<AgradDistributionsLognormal, type_v_158> AgradDistributionsLognormal_v_158;
+typedef std::tuple<AgradDistributionsLognormal, type_v_159> AgradDistributionsLognormal_v_159;
+typedef std::tuple<AgradDistributionsLognormal, type_v_160> AgradDistributionsLognormal_v_160;
+typedef std::tuple<AgradDistributionsLognormal, type_v_161> AgradDistributionsLognormal_v_161;
+typedef std::tuple<AgradDistributionsLognormal, type_v_162> AgradDistributionsLognormal_v_162;
+typedef std::tuple<AgradDistributionsLognormal, type_v_163> AgradDistributionsLognormal_v_163;
+typedef std::tuple<AgradDistributionsLognormal, type_v_164> AgradDistributionsLognormal_v_164;
+typedef std::tuple<AgradDistributionsLognormal, type_v_165> AgradDistributionsLognormal_v_165;
+typedef std::tuple<AgradDistributionsLognormal, type_v_166> AgradDistributionsLognormal_v_166;
+typedef std::tuple<AgradDistributionsLognormal, type_v_167> AgradDistributionsLognormal_v_167;
+typedef std::tuple<AgradDistributionsLognormal, type_v_168> AgradDistributionsLognormal_v_168;
+typedef std::tuple<AgradDistributionsLognormal, type_v_169> AgradDistributionsLognormal_v_169;
+typedef std::tuple<AgradDistributionsLognormal, type_v_170> AgradDistributionsLognormal_v_170;
+typedef std::tuple<AgradDistributionsLognormal, type_v_171> AgradDistributionsLognormal_v_171;
+typedef std::tuple<AgradDistributionsLognormal, type_v_172> AgradDistributionsLognormal_v_172;
+typedef std::tuple<AgradDistributionsLognormal, type_v_173> AgradDistributionsLognormal_v_173;
+typedef std::tuple<AgradDistributionsLognormal, type_v_174> AgradDistributionsLognormal_v_174;
+typedef std::tuple<AgradDistributionsLognormal, type_v_175> AgradDistributionsLognormal_v_175;
+typedef std::tuple<AgradDistributionsLognormal, type_v_176> AgradDistributionsLognormal_v_176;
+typedef std::tuple<AgradDistributionsLognormal, type_v_177> AgradDistributionsLognormal_v_177;
+typedef std::tuple<AgradDistributionsLognormal, type_v_178> AgradDistributionsLognormal_v_178;
+typedef std::tuple<AgradDistributionsLognormal, type_v_179> AgradDistributionsLognormal_v_179;
+typedef std::tuple<AgradDistributionsLognormal, type_v_180> AgradDistributionsLognormal_v_180;
+typedef std::tuple<AgradDistributionsLognormal, type_v_181> AgradDistributionsLognormal_v_181;
+typedef std::tuple<AgradDistributionsLognormal, type_v_182> AgradDistributionsLognormal_v_182;
+typedef std::tuple<AgradDistributionsLognormal, type_v_183> AgradDistributionsLognormal_v_183;
+typedef std::tuple<AgradDistributionsLognormal, type_v_184> AgradDistributionsLognormal_v_184;
+typedef std::tuple<AgradDistributionsLognormal, type_v_185> AgradDistributionsLognormal_v_185;
+typedef std::tuple<AgradDistributionsLognormal, type_v_186> AgradDistributionsLognormal_v_186;
+typedef std::tuple<AgradDistributionsLognormal, type_v_187> AgradDistributionsLognormal_v_187;
+typedef std::tuple<AgradDistributionsLognormal, type_v_188> AgradDistributionsLognormal_v_188;
+typedef std::tuple<AgradDistributionsLognormal, type_v_189> AgradDistributionsLognormal_v_189;
+typedef std::tuple<AgradDistributionsLognormal, type_v_190> AgradDistributionsLognormal_v_190;
+typedef std::tuple<AgradDistributionsLognormal, type_v_191> AgradDistributionsLognormal_v_191;
+typedef std::tuple<AgradDistributionsLognormal, type_v_192> AgradDistributionsLognormal_v_192;
+typedef std::tuple<AgradDistributionsLognormal, type_v_193> AgradDistributionsLognormal_v_193;
+typedef std::tuple<AgradDistributionsLognormal, type_v_194> AgradDistributionsLognormal_v_194;
+typedef std::tuple<AgradDistributionsLognormal, type_v_195> AgradDistributionsLognormal_v_195;
+typedef std::tuple<AgradDistributionsLognormal, type_v_196> AgradDistributionsLognormal_v_196;
+typedef std::tuple<AgradDistributionsLognormal, type_v_197> AgradDistributionsLognormal_v_197;
+typedef std::tuple<AgradDistributionsLognormal, type_v_198> AgradDistributionsLognormal_v_198;
+typedef std::tuple<AgradDistributionsLognormal, type_v_199> AgradDistributionsLognormal_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_100, AgradDistributionTestFixture, AgradDistributionsLognormal_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_101, AgradDistributionTestFixture, AgradDistributionsLognormal_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_102, AgradDistributionTestFixture, AgradDistributionsLognormal_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_103, AgradDistributionTestFixture, AgradDistributionsLognormal_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_104, AgradDistributionTestFixture, AgradDistributionsLognormal_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_105, AgradDistributionTestFixture, AgradDistributionsLognormal_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_106, AgradDistributionTestFixture, AgradDistributionsLognormal_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_107, AgradDistributionTestFixture, AgradDistributionsLognormal_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_108, AgradDistributionTestFixture, AgradDistributionsLognormal_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_109, AgradDistributionTestFixture, AgradDistributionsLognormal_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_110, AgradDistributionTestFixture, AgradDistributionsLognormal_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_111, AgradDistributionTestFixture, AgradDistributionsLognormal_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_112, AgradDistributionTestFixture, AgradDistributionsLognormal_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_113, AgradDistributionTestFixture, AgradDistributionsLognormal_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_114, AgradDistributionTestFixture, AgradDistributionsLognormal_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_115, AgradDistributionTestFixture, AgradDistributionsLognormal_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_116, AgradDistributionTestFixture, AgradDistributionsLognormal_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_117, AgradDistributionTestFixture, AgradDistributionsLognormal_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_118, AgradDistributionTestFixture, AgradDistributionsLognormal_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_119, AgradDistributionTestFixture, AgradDistributionsLognormal_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_120, AgradDistributionTestFixture, AgradDistributionsLognormal_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_121, AgradDistributionTestFixture, AgradDistributionsLognormal_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_122, AgradDistributionTestFixture, AgradDistributionsLognormal_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_123, AgradDistributionTestFixture, AgradDistributionsLognormal_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_124, AgradDistributionTestFixture, AgradDistributionsLognormal_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_125, AgradDistributionTestFixture, AgradDistributionsLognormal_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_126, AgradDistributionTestFixture, AgradDistributionsLognormal_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_127, AgradDistributionTestFixture, AgradDistributionsLognormal_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_128, AgradDistributionTestFixture, AgradDistributionsLognormal_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_129, AgradDistributionTestFixture, AgradDistributionsLognormal_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_130, AgradDistributionTestFixture, AgradDistributionsLognormal_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_131, AgradDistributionTestFixture, AgradDistributionsLognormal_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_132, AgradDistributionTestFixture, AgradDistributionsLognormal_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_133, AgradDistributionTestFixture, AgradDistributionsLognormal_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_134, AgradDistributionTestFixture, AgradDistributionsLognormal_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_135, AgradDistributionTestFixture, AgradDistributionsLognormal_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_136, AgradDistributionTestFixture, AgradDistributionsLognormal_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_137, AgradDistributionTestFixture, AgradDistributionsLognormal_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_138, AgradDistributionTestFixture, AgradDistributionsLognormal_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_139, AgradDistributionTestFixture, AgradDistributionsLognormal_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_140, AgradDistributionTestFixture, AgradDistributionsLognormal_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_141, AgradDistributionTestFixture, AgradDistributionsLognormal_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_142, AgradDistributionTestFixture, AgradDistributionsLognormal_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_143, AgradDistributionTestFixture, AgradDistributionsLognormal_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_144, AgradDistributionTestFixture, AgradDistributionsLognormal_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_145, AgradDistributionTestFixture, AgradDistributionsLognormal_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_146, AgradDistributionTestFixture, AgradDistributionsLognormal_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_147, AgradDistributionTestFixture, AgradDistributionsLognormal_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_148, AgradDistributionTestFixture, AgradDistributionsLognormal_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_149, AgradDistributionTestFixture, AgradDistributionsLognormal_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_150, AgradDistributionTestFixture, AgradDistributionsLognormal_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_151, AgradDistributionTestFixture, AgradDistributionsLognormal_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_152, AgradDistributionTestFixture, AgradDistributionsLognormal_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_153, AgradDistributionTestFixture, AgradDistributionsLognormal_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_154, AgradDistributionTestFixture, AgradDistributionsLognormal_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_155, AgradDistributionTestFixture, AgradDistributionsLognormal_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_156, AgradDistributionTestFixture, AgradDistributionsLognormal_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_157, AgradDistributionTestFixture, AgradDistributionsLognormal_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_158, AgradDistributionTestFixture, AgradDistributionsLognormal_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_159, AgradDistributionTestFixture, AgradDistributionsLognormal_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_160, AgradDistributionTestFixture, AgradDistributionsLognormal_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_161, AgradDistributionTestFixture, AgradDistributionsLognormal_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_162, AgradDistributionTestFixture, AgradDistributionsLognormal_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_163, AgradDistributionTestFixture, AgradDistributionsLognormal_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_164, AgradDistributionTestFixture, AgradDistributionsLognormal_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_165, AgradDistributionTestFixture, AgradDistributionsLognormal_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_166, AgradDistributionTestFixture, AgradDistributionsLognormal_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_167, AgradDistributionTestFixture, AgradDistributionsLognormal_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_168, AgradDistributionTestFixture, AgradDistributionsLognormal_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_169, AgradDistributionTestFixture, AgradDistributionsLognormal_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_170, AgradDistributionTestFixture, AgradDistributionsLognormal_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_171, AgradDistributionTestFixture, AgradDistributionsLognormal_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_172, AgradDistributionTestFixture, AgradDistributionsLognormal_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_173, AgradDistributionTestFixture, AgradDistributionsLognormal_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_174, AgradDistributionTestFixture, AgradDistributionsLognormal_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_175, AgradDistributionTestFixture, AgradDistributionsLognormal_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_176, AgradDistributionTestFixture, AgradDistributionsLognormal_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_177, AgradDistributionTestFixture, AgradDistributionsLognormal_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_178, AgradDistributionTestFixture, AgradDistributionsLognormal_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_179, AgradDistributionTestFixture, AgradDistributionsLognormal_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_180, AgradDistributionTestFixture, AgradDistributionsLognormal_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_181, AgradDistributionTestFixture, AgradDistributionsLognormal_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_182, AgradDistributionTestFixture, AgradDistributionsLognormal_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_183, AgradDistributionTestFixture, AgradDistributionsLognormal_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_184, AgradDistributionTestFixture, AgradDistributionsLognormal_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_185, AgradDistributionTestFixture, AgradDistributionsLognormal_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_186, AgradDistributionTestFixture, AgradDistributionsLognormal_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_187, AgradDistributionTestFixture, AgradDistributionsLognormal_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_188, AgradDistributionTestFixture, AgradDistributionsLognormal_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_189, AgradDistributionTestFixture, AgradDistributionsLognormal_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_190, AgradDistributionTestFixture, AgradDistributionsLognormal_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_191, AgradDistributionTestFixture, AgradDistributionsLognormal_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_192, AgradDistributionTestFixture, AgradDistributionsLognormal_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_193, AgradDistributionTestFixture, AgradDistributionsLognormal_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_194, AgradDistributionTestFixture, AgradDistributionsLognormal_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_195, AgradDistributionTestFixture, AgradDistributionsLognormal_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_196, AgradDistributionTestFixture, AgradDistributionsLognormal_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_197, AgradDistributionTestFixture, AgradDistributionsLognormal_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_198, AgradDistributionTestFixture, AgradDistributionsLognormal_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_199, AgradDistributionTestFixture, AgradDistributionsLognormal_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionsLognormal, type_vv_100> AgradDistributionsLognormal_vv_100;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_101> AgradDistributionsLognormal_vv_101;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_102> AgradDistributionsLognormal_vv_102;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_103> AgradDistributionsLognormal_vv_103;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_104> AgradDistributionsLognormal_vv_104;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_105> AgradDistributionsLognormal_vv_105;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_106> AgradDistributionsLognormal_vv_106;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_107> AgradDistributionsLognormal_vv_107;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_108> AgradDistributionsLognormal_vv_108;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_109> AgradDistributionsLognormal_vv_109;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_110> AgradDistributionsLognormal_vv_110;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_111> AgradDistributionsLognormal_vv_111;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_112> AgradDistributionsLognormal_vv_112;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_113> AgradDistributionsLognormal_vv_113;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_114> AgradDistributionsLognormal_vv_114;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_115> AgradDistributionsLognormal_vv_115;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_116> AgradDistributionsLognormal_vv_116;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_117> AgradDistributionsLognormal_vv_117;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_118> AgradDistributionsLognormal_vv_118;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_119> AgradDistributionsLognormal_vv_119;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_120> AgradDistributionsLognormal_vv_120;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_121> AgradDistributionsLognormal_vv_121;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_122> AgradDistributionsLognormal_vv_122;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_123> AgradDistributionsLognormal_vv_123;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_124> AgradDistributionsLognormal_vv_124;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_125> AgradDistributionsLognormal_vv_125;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_126> AgradDistributionsLognormal_vv_126;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_127> AgradDistributionsLognormal_vv_127;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_128> AgradDistributionsLognormal_vv_128;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_129> AgradDistributionsLognormal_vv_129;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_130> AgradDistributionsLognormal_vv_130;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_131> AgradDistributionsLognormal_vv_131;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_132> AgradDistributionsLognormal_vv_132;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_133> AgradDistributionsLognormal_vv_133;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_134> AgradDistributionsLognormal_vv_134;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_135> AgradDistributionsLognormal_vv_135;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_136> AgradDistributionsLognormal_vv_136;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_137> AgradDistributionsLognormal_vv_137;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_138> AgradDistributionsLognormal_vv_138;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_139> AgradDistributionsLognormal_vv_139;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_140> AgradDistributionsLognormal_vv_140;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_141> AgradDistributionsLognormal_vv_141;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_142> AgradDistributionsLognormal_vv_142;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_143> AgradDistributionsLognormal_vv_143;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_144> AgradDistributionsLognormal_vv_144;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_145> AgradDistributionsLognormal_vv_145;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_146> AgradDistributionsLognormal_vv_146;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_147> AgradDistributionsLognormal_vv_147;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_148> AgradDistributionsLognormal_vv_148;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_149> AgradDistributionsLognormal_vv_149;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_150> AgradDistributionsLognormal_vv_150;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_151> AgradDistributionsLognormal_vv_151;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_152> AgradDistributionsLognormal_vv_152;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_153> AgradDistributionsLognormal_vv_153;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_154> AgradDistributionsLognormal_vv_154;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_155> AgradDistributionsLognormal_vv_155;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_156> AgradDistributionsLognormal_vv_156;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_157> AgradDistributionsLognormal_vv_157;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_158> AgradDistributionsLognormal_vv_158;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_159> AgradDistributionsLognormal_vv_159;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_160> AgradDistributionsLognormal_vv_160;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_161> AgradDistributionsLognormal_vv_161;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_162> AgradDistributionsLognormal_vv_162;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_163> AgradDistributionsLognormal_vv_163;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_164> AgradDistributionsLognormal_vv_164;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_165> AgradDistributionsLognormal_vv_165;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_166> AgradDistributionsLognormal_vv_166;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_167> AgradDistributionsLognormal_vv_167;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_168> AgradDistributionsLognormal_vv_168;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_169> AgradDistributionsLognormal_vv_169;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_170> AgradDistributionsLognormal_vv_170;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_171> AgradDistributionsLognormal_vv_171;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_172> AgradDistributionsLognormal_vv_172;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_173> AgradDistributionsLognormal_vv_173;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_174> AgradDistributionsLognormal_vv_174;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_175> AgradDistributionsLognormal_vv_175;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_176> AgradDistributionsLognormal_vv_176;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_177> AgradDistributionsLognormal_vv_177;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_178> AgradDistributionsLognormal_vv_178;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_179> AgradDistributionsLognormal_vv_179;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_180> AgradDistributionsLognormal_vv_180;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_181> AgradDistributionsLognormal_vv_181;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_182> AgradDistributionsLognormal_vv_182;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_183> AgradDistributionsLognormal_vv_183;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_184> AgradDistributionsLognormal_vv_184;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_185> AgradDistributionsLognormal_vv_185;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_186> AgradDistributionsLognormal_vv_186;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_187> AgradDistributionsLognormal_vv_187;
+typedef std::tuple<AgradDistributionsLognormal, type_vv_188> AgradDistributionsLognormal_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_100, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_101, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_102, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_103, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_104, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_105, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_106, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_107, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_108, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_109, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_110, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_111, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_112, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_113, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_114, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_115, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_116, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_117, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_118, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_119, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_120, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_121, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_122, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_123, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_124, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_125, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_126, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_127, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_128, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_129, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_130, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_131, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_132, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_133, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_134, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_135, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_136, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_137, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_138, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_139, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_140, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_141, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_142, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_143, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_144, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_145, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_146, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_147, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_148, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_149, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_150, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_151, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_152, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_153, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_154, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_155, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_156, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_157, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_158, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_159, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_160, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_161, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_162, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_163, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_164, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_165, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_166, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_167, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_168, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_169, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_170, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_171, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_172, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_173, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_174, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_175, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_176, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_177, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_178, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_179, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_180, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_181, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_182, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_183, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_184, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_185, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_186, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_187, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_vv_188, AgradDistributionTestFixture, AgradDistributionsLognormal_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradDistributionsLognormal, type_v_200> AgradDistributionsLognormal_v_200;
+typedef std::tuple<AgradDistributionsLognormal, type_v_201> AgradDistributionsLognormal_v_201;
+typedef std::tuple<AgradDistributionsLognormal, type_v_202> AgradDistributionsLognormal_v_202;
+typedef std::tuple<AgradDistributionsLognormal, type_v_203> AgradDistributionsLognormal_v_203;
+typedef std::tuple<AgradDistributionsLognormal, type_v_204> AgradDistributionsLognormal_v_204;
+typedef std::tuple<AgradDistributionsLognormal, type_v_205> AgradDistributionsLognormal_v_205;
+typedef std::tuple<AgradDistributionsLognormal, type_v_206> AgradDistributionsLognormal_v_206;
+typedef std::tuple<AgradDistributionsLognormal, type_v_207> AgradDistributionsLognormal_v_207;
+typedef std::tuple<AgradDistributionsLognormal, type_v_208> AgradDistributionsLognormal_v_208;
+typedef std::tuple<AgradDistributionsLognormal, type_v_209> AgradDistributionsLognormal_v_209;
+typedef std::tuple<AgradDistributionsLognormal, type_v_210> AgradDistributionsLognormal_v_210;
+typedef std::tuple<AgradDistributionsLognormal, type_v_211> AgradDistributionsLognormal_v_211;
+typedef std::tuple<AgradDistributionsLognormal, type_v_212> AgradDistributionsLognormal_v_212;
+typedef std::tuple<AgradDistributionsLognormal, type_v_213> AgradDistributionsLognormal_v_213;
+typedef std::tuple<AgradDistributionsLognormal, type_v_214> AgradDistributionsLognormal_v_214;
+typedef std::tuple<AgradDistributionsLognormal, type_v_215> AgradDistributionsLognormal_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_200, AgradDistributionTestFixture, AgradDistributionsLognormal_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_201, AgradDistributionTestFixture, AgradDistributionsLognormal_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_202, AgradDistributionTestFixture, AgradDistributionsLognormal_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_203, AgradDistributionTestFixture, AgradDistributionsLognormal_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_204, AgradDistributionTestFixture, AgradDistributionsLognormal_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_205, AgradDistributionTestFixture, AgradDistributionsLognormal_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_206, AgradDistributionTestFixture, AgradDistributionsLognormal_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_207, AgradDistributionTestFixture, AgradDistributionsLognormal_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_208, AgradDistributionTestFixture, AgradDistributionsLognormal_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_209, AgradDistributionTestFixture, AgradDistributionsLognormal_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_210, AgradDistributionTestFixture, AgradDistributionsLognormal_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_211, AgradDistributionTestFixture, AgradDistributionsLognormal_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_212, AgradDistributionTestFixture, AgradDistributionsLognormal_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_213, AgradDistributionTestFixture, AgradDistributionsLognormal_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_214, AgradDistributionTestFixture, AgradDistributionsLognormal_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsLognormal_v_215, AgradDistributionTestFixture, AgradDistributionsLognormal_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_0> AgradCcdfLogLognormal_ffv_0;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_1> AgradCcdfLogLognormal_ffv_1;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_2> AgradCcdfLogLognormal_ffv_2;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_3> AgradCcdfLogLognormal_ffv_3;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_4> AgradCcdfLogLognormal_ffv_4;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_5> AgradCcdfLogLognormal_ffv_5;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_6> AgradCcdfLogLognormal_ffv_6;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_7> AgradCcdfLogLognormal_ffv_7;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_8> AgradCcdfLogLognormal_ffv_8;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_9> AgradCcdfLogLognormal_ffv_9;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_10> AgradCcdfLogLognormal_ffv_10;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_11> AgradCcdfLogLognormal_ffv_11;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_12> AgradCcdfLogLognormal_ffv_12;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_13> AgradCcdfLogLognormal_ffv_13;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_14> AgradCcdfLogLognormal_ffv_14;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_15> AgradCcdfLogLognormal_ffv_15;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_16> AgradCcdfLogLognormal_ffv_16;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_17> AgradCcdfLogLognormal_ffv_17;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_18> AgradCcdfLogLognormal_ffv_18;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_19> AgradCcdfLogLognormal_ffv_19;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_20> AgradCcdfLogLognormal_ffv_20;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_21> AgradCcdfLogLognormal_ffv_21;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_22> AgradCcdfLogLognormal_ffv_22;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_23> AgradCcdfLogLognormal_ffv_23;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_24> AgradCcdfLogLognormal_ffv_24;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_25> AgradCcdfLogLognormal_ffv_25;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_26> AgradCcdfLogLognormal_ffv_26;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_27> AgradCcdfLogLognormal_ffv_27;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_28> AgradCcdfLogLognormal_ffv_28;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_29> AgradCcdfLogLognormal_ffv_29;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_30> AgradCcdfLogLognormal_ffv_30;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_31> AgradCcdfLogLognormal_ffv_31;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_32> AgradCcdfLogLognormal_ffv_32;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_33> AgradCcdfLogLognormal_ffv_33;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_34> AgradCcdfLogLognormal_ffv_34;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_35> AgradCcdfLogLognormal_ffv_35;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_36> AgradCcdfLogLognormal_ffv_36;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_37> AgradCcdfLogLognormal_ffv_37;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_38> AgradCcdfLogLognormal_ffv_38;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_39> AgradCcdfLogLognormal_ffv_39;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_40> AgradCcdfLogLognormal_ffv_40;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_41> AgradCcdfLogLognormal_ffv_41;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_42> AgradCcdfLogLognormal_ffv_42;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_43> AgradCcdfLogLognormal_ffv_43;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_44> AgradCcdfLogLognormal_ffv_44;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_45> AgradCcdfLogLognormal_ffv_45;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_46> AgradCcdfLogLognormal_ffv_46;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_47> AgradCcdfLogLognormal_ffv_47;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_48> AgradCcdfLogLognormal_ffv_48;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_49> AgradCcdfLogLognormal_ffv_49;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_50> AgradCcdfLogLognormal_ffv_50;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_51> AgradCcdfLogLognormal_ffv_51;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_52> AgradCcdfLogLognormal_ffv_52;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_53> AgradCcdfLogLognormal_ffv_53;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_54> AgradCcdfLogLognormal_ffv_54;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_55> AgradCcdfLogLognormal_ffv_55;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_56> AgradCcdfLogLognormal_ffv_56;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_57> AgradCcdfLogLognormal_ffv_57;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_58> AgradCcdfLogLognormal_ffv_58;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_59> AgradCcdfLogLognormal_ffv_59;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_60> AgradCcdfLogLognormal_ffv_60;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_61> AgradCcdfLogLognormal_ffv_61;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_62> AgradCcdfLogLognormal_ffv_62;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_63> AgradCcdfLogLognormal_ffv_63;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_64> AgradCcdfLogLognormal_ffv_64;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_65> AgradCcdfLogLognormal_ffv_65;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_66> AgradCcdfLogLognormal_ffv_66;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_67> AgradCcdfLogLognormal_ffv_67;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_68> AgradCcdfLogLognormal_ffv_68;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_69> AgradCcdfLogLognormal_ffv_69;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_70> AgradCcdfLogLognormal_ffv_70;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_71> AgradCcdfLogLognormal_ffv_71;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_72> AgradCcdfLogLognormal_ffv_72;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_73> AgradCcdfLogLognormal_ffv_73;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_74> AgradCcdfLogLognormal_ffv_74;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_75> AgradCcdfLogLognormal_ffv_75;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_76> AgradCcdfLogLognormal_ffv_76;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_77> AgradCcdfLogLognormal_ffv_77;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_78> AgradCcdfLogLognormal_ffv_78;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_79> AgradCcdfLogLognormal_ffv_79;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_80> AgradCcdfLogLognormal_ffv_80;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_81> AgradCcdfLogLognormal_ffv_81;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_82> AgradCcdfLogLognormal_ffv_82;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_83> AgradCcdfLogLognormal_ffv_83;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_84> AgradCcdfLogLognormal_ffv_84;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_85> AgradCcdfLogLognormal_ffv_85;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_86> AgradCcdfLogLognormal_ffv_86;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_87> AgradCcdfLogLognormal_ffv_87;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_88> AgradCcdfLogLognormal_ffv_88;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_89> AgradCcdfLogLognormal_ffv_89;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_90> AgradCcdfLogLognormal_ffv_90;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_91> AgradCcdfLogLognormal_ffv_91;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_92> AgradCcdfLogLognormal_ffv_92;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_93> AgradCcdfLogLognormal_ffv_93;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_94> AgradCcdfLogLognormal_ffv_94;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_95> AgradCcdfLogLognormal_ffv_95;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_96> AgradCcdfLogLognormal_ffv_96;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_97> AgradCcdfLogLognormal_ffv_97;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_98> AgradCcdfLogLognormal_ffv_98;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_99> AgradCcdfLogLognormal_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogLognormal, type_v_0> AgradCcdfLogLognormal_v_0;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_1> AgradCcdfLogLognormal_v_1;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_2> AgradCcdfLogLognormal_v_2;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_3> AgradCcdfLogLognormal_v_3;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_4> AgradCcdfLogLognormal_v_4;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_5> AgradCcdfLogLognormal_v_5;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_6> AgradCcdfLogLognormal_v_6;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_7> AgradCcdfLogLognormal_v_7;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_8> AgradCcdfLogLognormal_v_8;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_9> AgradCcdfLogLognormal_v_9;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_10> AgradCcdfLogLognormal_v_10;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_11> AgradCcdfLogLognormal_v_11;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_12> AgradCcdfLogLognormal_v_12;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_13> AgradCcdfLogLognormal_v_13;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_14> AgradCcdfLogLognormal_v_14;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_15> AgradCcdfLogLognormal_v_15;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_16> AgradCcdfLogLognormal_v_16;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_17> AgradCcdfLogLognormal_v_17;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_18> AgradCcdfLogLognormal_v_18;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_19> AgradCcdfLogLognormal_v_19;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_20> AgradCcdfLogLognormal_v_20;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_21> AgradCcdfLogLognormal_v_21;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_22> AgradCcdfLogLognormal_v_22;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_23> AgradCcdfLogLognormal_v_23;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_24> AgradCcdfLogLognormal_v_24;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_25> AgradCcdfLogLognormal_v_25;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_26> AgradCcdfLogLognormal_v_26;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_27> AgradCcdfLogLognormal_v_27;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_28> AgradCcdfLogLognormal_v_28;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_29> AgradCcdfLogLognormal_v_29;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_30> AgradCcdfLogLognormal_v_30;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_31> AgradCcdfLogLognormal_v_31;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_32> AgradCcdfLogLognormal_v_32;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_33> AgradCcdfLogLognormal_v_33;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_34> AgradCcdfLogLognormal_v_34;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_35> AgradCcdfLogLognormal_v_35;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_36> AgradCcdfLogLognormal_v_36;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_37> AgradCcdfLogLognormal_v_37;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_38> AgradCcdfLogLognormal_v_38;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_39> AgradCcdfLogLognormal_v_39;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_40> AgradCcdfLogLognormal_v_40;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_41> AgradCcdfLogLognormal_v_41;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_42> AgradCcdfLogLognormal_v_42;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_43> AgradCcdfLogLognormal_v_43;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_44> AgradCcdfLogLognormal_v_44;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_45> AgradCcdfLogLognormal_v_45;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_46> AgradCcdfLogLognormal_v_46;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_47> AgradCcdfLogLognormal_v_47;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_48> AgradCcdfLogLognormal_v_48;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_49> AgradCcdfLogLognormal_v_49;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_50> AgradCcdfLogLognormal_v_50;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_51> AgradCcdfLogLognormal_v_51;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_52> AgradCcdfLogLognormal_v_52;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_53> AgradCcdfLogLognormal_v_53;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_54> AgradCcdfLogLognormal_v_54;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_55> AgradCcdfLogLognormal_v_55;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_56> AgradCcdfLogLognormal_v_56;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_57> AgradCcdfLogLognormal_v_57;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_58> AgradCcdfLogLognormal_v_58;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_59> AgradCcdfLogLognormal_v_59;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_60> AgradCcdfLogLognormal_v_60;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_61> AgradCcdfLogLognormal_v_61;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_62> AgradCcdfLogLognormal_v_62;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_63> AgradCcdfLogLognormal_v_63;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_64> AgradCcdfLogLognormal_v_64;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_65> AgradCcdfLogLognormal_v_65;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_66> AgradCcdfLogLognormal_v_66;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_67> AgradCcdfLogLognormal_v_67;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_68> AgradCcdfLogLognormal_v_68;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_69> AgradCcdfLogLognormal_v_69;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_70> AgradCcdfLogLognormal_v_70;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_71> AgradCcdfLogLognormal_v_71;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_72> AgradCcdfLogLognormal_v_72;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_73> AgradCcdfLogLognormal_v_73;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_74> AgradCcdfLogLognormal_v_74;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_75> AgradCcdfLogLognormal_v_75;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_76> AgradCcdfLogLognormal_v_76;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_77> AgradCcdfLogLognormal_v_77;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_78> AgradCcdfLogLognormal_v_78;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_79> AgradCcdfLogLognormal_v_79;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_80> AgradCcdfLogLognormal_v_80;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_81> AgradCcdfLogLognormal_v_81;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_82> AgradCcdfLogLognormal_v_82;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_83> AgradCcdfLogLognormal_v_83;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_84> AgradCcdfLogLognormal_v_84;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_85> AgradCcdfLogLognormal_v_85;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_86> AgradCcdfLogLognormal_v_86;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_87> AgradCcdfLogLognormal_v_87;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_88> AgradCcdfLogLognormal_v_88;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_89> AgradCcdfLogLognormal_v_89;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_90> AgradCcdfLogLognormal_v_90;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_91> AgradCcdfLogLognormal_v_91;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_92> AgradCcdfLogLognormal_v_92;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_93> AgradCcdfLogLognormal_v_93;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_94> AgradCcdfLogLognormal_v_94;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_95> AgradCcdfLogLognormal_v_95;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_96> AgradCcdfLogLognormal_v_96;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_97> AgradCcdfLogLognormal_v_97;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_98> AgradCcdfLogLognormal_v_98;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_99> AgradCcdfLogLognormal_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_0, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_1, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_2, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_3, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_4, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_5, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_6, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_7, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_8, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_9, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_10, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_11, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_12, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_13, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_14, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_15, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_16, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_17, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_18, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_19, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_20, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_21, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_22, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_23, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_24, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_25, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_26, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_27, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_28, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_29, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_30, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_31, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_32, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_33, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_34, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_35, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_36, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_37, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_38, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_39, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_40, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_41, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_42, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_43, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_44, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_45, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_46, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_47, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_48, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_49, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_50, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_51, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_52, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_53, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_54, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_55, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_56, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_57, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_58, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_59, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_60, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_61, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_62, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_63, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_64, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_65, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_66, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_67, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_68, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_69, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_70, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_71, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_72, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_73, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_74, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_75, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_76, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_77, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_78, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_79, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_80, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_81, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_82, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_83, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_84, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_85, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_86, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_87, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_88, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_89, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_90, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_91, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_92, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_93, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_94, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_95, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_96, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_97, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_98, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_99, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_0> AgradCcdfLogLognormal_vv_0;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_1> AgradCcdfLogLognormal_vv_1;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_2> AgradCcdfLogLognormal_vv_2;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_3> AgradCcdfLogLognormal_vv_3;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_4> AgradCcdfLogLognormal_vv_4;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_5> AgradCcdfLogLognormal_vv_5;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_6> AgradCcdfLogLognormal_vv_6;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_7> AgradCcdfLogLognormal_vv_7;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_8> AgradCcdfLogLognormal_vv_8;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_9> AgradCcdfLogLognormal_vv_9;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_10> AgradCcdfLogLognormal_vv_10;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_11> AgradCcdfLogLognormal_vv_11;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_12> AgradCcdfLogLognormal_vv_12;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_13> AgradCcdfLogLognormal_vv_13;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_14> AgradCcdfLogLognormal_vv_14;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_15> AgradCcdfLogLognormal_vv_15;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_16> AgradCcdfLogLognormal_vv_16;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_17> AgradCcdfLogLognormal_vv_17;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_18> AgradCcdfLogLognormal_vv_18;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_19> AgradCcdfLogLognormal_vv_19;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_20> AgradCcdfLogLognormal_vv_20;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_21> AgradCcdfLogLognormal_vv_21;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_22> AgradCcdfLogLognormal_vv_22;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_23> AgradCcdfLogLognormal_vv_23;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_24> AgradCcdfLogLognormal_vv_24;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_25> AgradCcdfLogLognormal_vv_25;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_26> AgradCcdfLogLognormal_vv_26;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_27> AgradCcdfLogLognormal_vv_27;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_28> AgradCcdfLogLognormal_vv_28;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_29> AgradCcdfLogLognormal_vv_29;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_30> AgradCcdfLogLognormal_vv_30;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_31> AgradCcdfLogLognormal_vv_31;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_32> AgradCcdfLogLognormal_vv_32;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_33> AgradCcdfLogLognormal_vv_33;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_34> AgradCcdfLogLognormal_vv_34;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_35> AgradCcdfLogLognormal_vv_35;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_36> AgradCcdfLogLognormal_vv_36;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_37> AgradCcdfLogLognormal_vv_37;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_38> AgradCcdfLogLognormal_vv_38;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_39> AgradCcdfLogLognormal_vv_39;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_40> AgradCcdfLogLognormal_vv_40;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_41> AgradCcdfLogLognormal_vv_41;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_42> AgradCcdfLogLognormal_vv_42;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_43> AgradCcdfLogLognormal_vv_43;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_44> AgradCcdfLogLognormal_vv_44;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_45> AgradCcdfLogLognormal_vv_45;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_46> AgradCcdfLogLognormal_vv_46;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_47> AgradCcdfLogLognormal_vv_47;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_48> AgradCcdfLogLognormal_vv_48;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_49> AgradCcdfLogLognormal_vv_49;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_50> AgradCcdfLogLognormal_vv_50;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_51> AgradCcdfLogLognormal_vv_51;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_52> AgradCcdfLogLognormal_vv_52;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_53> AgradCcdfLogLognormal_vv_53;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_54> AgradCcdfLogLognormal_vv_54;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_55> AgradCcdfLogLognormal_vv_55;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_56> AgradCcdfLogLognormal_vv_56;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_57> AgradCcdfLogLognormal_vv_57;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_58> AgradCcdfLogLognormal_vv_58;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_59> AgradCcdfLogLognormal_vv_59;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_60> AgradCcdfLogLognormal_vv_60;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_61> AgradCcdfLogLognormal_vv_61;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_62> AgradCcdfLogLognormal_vv_62;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_63> AgradCcdfLogLognormal_vv_63;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_64> AgradCcdfLogLognormal_vv_64;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_65> AgradCcdfLogLognormal_vv_65;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_66> AgradCcdfLogLognormal_vv_66;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_67> AgradCcdfLogLognormal_vv_67;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_68> AgradCcdfLogLognormal_vv_68;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_69> AgradCcdfLogLognormal_vv_69;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_70> AgradCcdfLogLognormal_vv_70;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_71> AgradCcdfLogLognormal_vv_71;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_72> AgradCcdfLogLognormal_vv_72;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_73> AgradCcdfLogLognormal_vv_73;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_74> AgradCcdfLogLognormal_vv_74;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_75> AgradCcdfLogLognormal_vv_75;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_76> AgradCcdfLogLognormal_vv_76;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_77> AgradCcdfLogLognormal_vv_77;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_78> AgradCcdfLogLognormal_vv_78;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_79> AgradCcdfLogLognormal_vv_79;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_80> AgradCcdfLogLognormal_vv_80;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_81> AgradCcdfLogLognormal_vv_81;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_82> AgradCcdfLogLognormal_vv_82;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_83> AgradCcdfLogLognormal_vv_83;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_84> AgradCcdfLogLognormal_vv_84;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_85> AgradCcdfLogLognormal_vv_85;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_86> AgradCcdfLogLognormal_vv_86;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_87> AgradCcdfLogLognormal_vv_87;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_88> AgradCcdfLogLognormal_vv_88;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_89> AgradCcdfLogLognormal_vv_89;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_90> AgradCcdfLogLognormal_vv_90;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_91> AgradCcdfLogLognormal_vv_91;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_92> AgradCcdfLogLognormal_vv_92;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_93> AgradCcdfLogLognormal_vv_93;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_94> AgradCcdfLogLognormal_vv_94;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_95> AgradCcdfLogLognormal_vv_95;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_96> AgradCcdfLogLognormal_vv_96;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_97> AgradCcdfLogLognormal_vv_97;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_98> AgradCcdfLogLognormal_vv_98;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_99> AgradCcdfLogLognormal_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_99);
+
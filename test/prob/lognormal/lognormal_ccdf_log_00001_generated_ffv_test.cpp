@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_100> AgradCcdfLogLognormal_ffv_100;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_101> AgradCcdfLogLognormal_ffv_101;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_102> AgradCcdfLogLognormal_ffv_102;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_103> AgradCcdfLogLognormal_ffv_103;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_104> AgradCcdfLogLognormal_ffv_104;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_105> AgradCcdfLogLognormal_ffv_105;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_106> AgradCcdfLogLognormal_ffv_106;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_107> AgradCcdfLogLognormal_ffv_107;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_108> AgradCcdfLogLognormal_ffv_108;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_109> AgradCcdfLogLognormal_ffv_109;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_110> AgradCcdfLogLognormal_ffv_110;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_111> AgradCcdfLogLognormal_ffv_111;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_112> AgradCcdfLogLognormal_ffv_112;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_113> AgradCcdfLogLognormal_ffv_113;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_114> AgradCcdfLogLognormal_ffv_114;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_115> AgradCcdfLogLognormal_ffv_115;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_116> AgradCcdfLogLognormal_ffv_116;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_117> AgradCcdfLogLognormal_ffv_117;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_118> AgradCcdfLogLognormal_ffv_118;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_119> AgradCcdfLogLognormal_ffv_119;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_120> AgradCcdfLogLognormal_ffv_120;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_121> AgradCcdfLogLognormal_ffv_121;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_122> AgradCcdfLogLognormal_ffv_122;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_123> AgradCcdfLogLognormal_ffv_123;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_124> AgradCcdfLogLognormal_ffv_124;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_125> AgradCcdfLogLognormal_ffv_125;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_126> AgradCcdfLogLognormal_ffv_126;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_127> AgradCcdfLogLognormal_ffv_127;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_128> AgradCcdfLogLognormal_ffv_128;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_129> AgradCcdfLogLognormal_ffv_129;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_130> AgradCcdfLogLognormal_ffv_130;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_131> AgradCcdfLogLognormal_ffv_131;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_132> AgradCcdfLogLognormal_ffv_132;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_133> AgradCcdfLogLognormal_ffv_133;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_134> AgradCcdfLogLognormal_ffv_134;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_135> AgradCcdfLogLognormal_ffv_135;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_136> AgradCcdfLogLognormal_ffv_136;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_137> AgradCcdfLogLognormal_ffv_137;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_138> AgradCcdfLogLognormal_ffv_138;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_139> AgradCcdfLogLognormal_ffv_139;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_140> AgradCcdfLogLognormal_ffv_140;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_141> AgradCcdfLogLognormal_ffv_141;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_142> AgradCcdfLogLognormal_ffv_142;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_143> AgradCcdfLogLognormal_ffv_143;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_144> AgradCcdfLogLognormal_ffv_144;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_145> AgradCcdfLogLognormal_ffv_145;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_146> AgradCcdfLogLognormal_ffv_146;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_147> AgradCcdfLogLognormal_ffv_147;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_148> AgradCcdfLogLognormal_ffv_148;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_149> AgradCcdfLogLognormal_ffv_149;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_150> AgradCcdfLogLognormal_ffv_150;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_151> AgradCcdfLogLognormal_ffv_151;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_152> AgradCcdfLogLognormal_ffv_152;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_153> AgradCcdfLogLognormal_ffv_153;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_154> AgradCcdfLogLognormal_ffv_154;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_155> AgradCcdfLogLognormal_ffv_155;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_156> AgradCcdfLogLognormal_ffv_156;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_157> AgradCcdfLogLognormal_ffv_157;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_158> AgradCcdfLogLognormal_ffv_158;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_159> AgradCcdfLogLognormal_ffv_159;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_160> AgradCcdfLogLognormal_ffv_160;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_161> AgradCcdfLogLognormal_ffv_161;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_162> AgradCcdfLogLognormal_ffv_162;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_163> AgradCcdfLogLognormal_ffv_163;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_164> AgradCcdfLogLognormal_ffv_164;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_165> AgradCcdfLogLognormal_ffv_165;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_166> AgradCcdfLogLognormal_ffv_166;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_167> AgradCcdfLogLognormal_ffv_167;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_168> AgradCcdfLogLognormal_ffv_168;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_169> AgradCcdfLogLognormal_ffv_169;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_170> AgradCcdfLogLognormal_ffv_170;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_171> AgradCcdfLogLognormal_ffv_171;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_172> AgradCcdfLogLognormal_ffv_172;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_173> AgradCcdfLogLognormal_ffv_173;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_174> AgradCcdfLogLognormal_ffv_174;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_175> AgradCcdfLogLognormal_ffv_175;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_176> AgradCcdfLogLognormal_ffv_176;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_177> AgradCcdfLogLognormal_ffv_177;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_178> AgradCcdfLogLognormal_ffv_178;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_179> AgradCcdfLogLognormal_ffv_179;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_180> AgradCcdfLogLognormal_ffv_180;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_181> AgradCcdfLogLognormal_ffv_181;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_182> AgradCcdfLogLognormal_ffv_182;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_183> AgradCcdfLogLognormal_ffv_183;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_184> AgradCcdfLogLognormal_ffv_184;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_185> AgradCcdfLogLognormal_ffv_185;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_186> AgradCcdfLogLognormal_ffv_186;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_187> AgradCcdfLogLognormal_ffv_187;
+typedef std::tuple<AgradCcdfLogLognormal, type_ffv_188> AgradCcdfLogLognormal_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_ffv_188);
+
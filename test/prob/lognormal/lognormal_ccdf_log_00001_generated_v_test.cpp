@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogLognormal, type_v_100> AgradCcdfLogLognormal_v_100;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_101> AgradCcdfLogLognormal_v_101;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_102> AgradCcdfLogLognormal_v_102;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_103> AgradCcdfLogLognormal_v_103;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_104> AgradCcdfLogLognormal_v_104;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_105> AgradCcdfLogLognormal_v_105;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_106> AgradCcdfLogLognormal_v_106;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_107> AgradCcdfLogLognormal_v_107;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_108> AgradCcdfLogLognormal_v_108;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_109> AgradCcdfLogLognormal_v_109;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_110> AgradCcdfLogLognormal_v_110;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_111> AgradCcdfLogLognormal_v_111;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_112> AgradCcdfLogLognormal_v_112;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_113> AgradCcdfLogLognormal_v_113;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_114> AgradCcdfLogLognormal_v_114;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_115> AgradCcdfLogLognormal_v_115;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_116> AgradCcdfLogLognormal_v_116;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_117> AgradCcdfLogLognormal_v_117;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_118> AgradCcdfLogLognormal_v_118;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_119> AgradCcdfLogLognormal_v_119;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_120> AgradCcdfLogLognormal_v_120;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_121> AgradCcdfLogLognormal_v_121;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_122> AgradCcdfLogLognormal_v_122;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_123> AgradCcdfLogLognormal_v_123;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_124> AgradCcdfLogLognormal_v_124;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_125> AgradCcdfLogLognormal_v_125;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_126> AgradCcdfLogLognormal_v_126;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_127> AgradCcdfLogLognormal_v_127;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_128> AgradCcdfLogLognormal_v_128;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_129> AgradCcdfLogLognormal_v_129;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_130> AgradCcdfLogLognormal_v_130;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_131> AgradCcdfLogLognormal_v_131;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_132> AgradCcdfLogLognormal_v_132;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_133> AgradCcdfLogLognormal_v_133;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_134> AgradCcdfLogLognormal_v_134;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_135> AgradCcdfLogLognormal_v_135;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_136> AgradCcdfLogLognormal_v_136;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_137> AgradCcdfLogLognormal_v_137;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_138> AgradCcdfLogLognormal_v_138;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_139> AgradCcdfLogLognormal_v_139;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_140> AgradCcdfLogLognormal_v_140;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_141> AgradCcdfLogLognormal_v_141;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_142> AgradCcdfLogLognormal_v_142;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_143> AgradCcdfLogLognormal_v_143;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_144> AgradCcdfLogLognormal_v_144;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_145> AgradCcdfLogLognormal_v_145;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_146> AgradCcdfLogLognormal_v_146;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_147> AgradCcdfLogLognormal_v_147;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_148> AgradCcdfLogLognormal_v_148;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_149> AgradCcdfLogLognormal_v_149;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_150> AgradCcdfLogLognormal_v_150;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_151> AgradCcdfLogLognormal_v_151;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_152> AgradCcdfLogLognormal_v_152;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_153> AgradCcdfLogLognormal_v_153;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_154> AgradCcdfLogLognormal_v_154;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_155> AgradCcdfLogLognormal_v_155;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_156> AgradCcdfLogLognormal_v_156;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_157> AgradCcdfLogLognormal_v_157;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_158> AgradCcdfLogLognormal_v_158;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_159> AgradCcdfLogLognormal_v_159;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_160> AgradCcdfLogLognormal_v_160;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_161> AgradCcdfLogLognormal_v_161;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_162> AgradCcdfLogLognormal_v_162;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_163> AgradCcdfLogLognormal_v_163;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_164> AgradCcdfLogLognormal_v_164;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_165> AgradCcdfLogLognormal_v_165;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_166> AgradCcdfLogLognormal_v_166;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_167> AgradCcdfLogLognormal_v_167;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_168> AgradCcdfLogLognormal_v_168;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_169> AgradCcdfLogLognormal_v_169;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_170> AgradCcdfLogLognormal_v_170;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_171> AgradCcdfLogLognormal_v_171;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_172> AgradCcdfLogLognormal_v_172;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_173> AgradCcdfLogLognormal_v_173;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_174> AgradCcdfLogLognormal_v_174;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_175> AgradCcdfLogLognormal_v_175;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_176> AgradCcdfLogLognormal_v_176;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_177> AgradCcdfLogLognormal_v_177;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_178> AgradCcdfLogLognormal_v_178;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_179> AgradCcdfLogLognormal_v_179;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_180> AgradCcdfLogLognormal_v_180;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_181> AgradCcdfLogLognormal_v_181;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_182> AgradCcdfLogLognormal_v_182;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_183> AgradCcdfLogLognormal_v_183;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_184> AgradCcdfLogLognormal_v_184;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_185> AgradCcdfLogLognormal_v_185;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_186> AgradCcdfLogLognormal_v_186;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_187> AgradCcdfLogLognormal_v_187;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_188> AgradCcdfLogLognormal_v_188;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_189> AgradCcdfLogLognormal_v_189;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_190> AgradCcdfLogLognormal_v_190;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_191> AgradCcdfLogLognormal_v_191;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_192> AgradCcdfLogLognormal_v_192;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_193> AgradCcdfLogLognormal_v_193;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_194> AgradCcdfLogLognormal_v_194;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_195> AgradCcdfLogLognormal_v_195;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_196> AgradCcdfLogLognormal_v_196;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_197> AgradCcdfLogLognormal_v_197;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_198> AgradCcdfLogLognormal_v_198;
+typedef std::tuple<AgradCcdfLogLognormal, type_v_199> AgradCcdfLogLognormal_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_100, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_101, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_102, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_103, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_104, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_105, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_106, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_107, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_108, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_109, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_110, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_111, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_112, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_113, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_114, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_115, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_116, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_117, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_118, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_119, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_120, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_121, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_122, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_123, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_124, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_125, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_126, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_127, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_128, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_129, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_130, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_131, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_132, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_133, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_134, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_135, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_136, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_137, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_138, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_139, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_140, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_141, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_142, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_143, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_144, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_145, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_146, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_147, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_148, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_149, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_150, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_151, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_152, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_153, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_154, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_155, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_156, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_157, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_158, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_159, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_160, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_161, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_162, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_163, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_164, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_165, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_166, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_167, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_168, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_169, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_170, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_171, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_172, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_173, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_174, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_175, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_176, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_177, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_178, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_179, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_180, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_181, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_182, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_183, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_184, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_185, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_186, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_187, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_188, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_189, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_190, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_191, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_192, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_193, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_194, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_195, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_196, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_197, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_198, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_v_199, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_v_199);
+
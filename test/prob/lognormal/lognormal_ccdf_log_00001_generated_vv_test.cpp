@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_100> AgradCcdfLogLognormal_vv_100;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_101> AgradCcdfLogLognormal_vv_101;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_102> AgradCcdfLogLognormal_vv_102;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_103> AgradCcdfLogLognormal_vv_103;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_104> AgradCcdfLogLognormal_vv_104;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_105> AgradCcdfLogLognormal_vv_105;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_106> AgradCcdfLogLognormal_vv_106;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_107> AgradCcdfLogLognormal_vv_107;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_108> AgradCcdfLogLognormal_vv_108;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_109> AgradCcdfLogLognormal_vv_109;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_110> AgradCcdfLogLognormal_vv_110;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_111> AgradCcdfLogLognormal_vv_111;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_112> AgradCcdfLogLognormal_vv_112;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_113> AgradCcdfLogLognormal_vv_113;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_114> AgradCcdfLogLognormal_vv_114;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_115> AgradCcdfLogLognormal_vv_115;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_116> AgradCcdfLogLognormal_vv_116;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_117> AgradCcdfLogLognormal_vv_117;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_118> AgradCcdfLogLognormal_vv_118;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_119> AgradCcdfLogLognormal_vv_119;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_120> AgradCcdfLogLognormal_vv_120;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_121> AgradCcdfLogLognormal_vv_121;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_122> AgradCcdfLogLognormal_vv_122;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_123> AgradCcdfLogLognormal_vv_123;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_124> AgradCcdfLogLognormal_vv_124;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_125> AgradCcdfLogLognormal_vv_125;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_126> AgradCcdfLogLognormal_vv_126;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_127> AgradCcdfLogLognormal_vv_127;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_128> AgradCcdfLogLognormal_vv_128;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_129> AgradCcdfLogLognormal_vv_129;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_130> AgradCcdfLogLognormal_vv_130;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_131> AgradCcdfLogLognormal_vv_131;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_132> AgradCcdfLogLognormal_vv_132;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_133> AgradCcdfLogLognormal_vv_133;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_134> AgradCcdfLogLognormal_vv_134;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_135> AgradCcdfLogLognormal_vv_135;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_136> AgradCcdfLogLognormal_vv_136;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_137> AgradCcdfLogLognormal_vv_137;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_138> AgradCcdfLogLognormal_vv_138;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_139> AgradCcdfLogLognormal_vv_139;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_140> AgradCcdfLogLognormal_vv_140;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_141> AgradCcdfLogLognormal_vv_141;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_142> AgradCcdfLogLognormal_vv_142;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_143> AgradCcdfLogLognormal_vv_143;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_144> AgradCcdfLogLognormal_vv_144;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_145> AgradCcdfLogLognormal_vv_145;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_146> AgradCcdfLogLognormal_vv_146;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_147> AgradCcdfLogLognormal_vv_147;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_148> AgradCcdfLogLognormal_vv_148;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_149> AgradCcdfLogLognormal_vv_149;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_150> AgradCcdfLogLognormal_vv_150;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_151> AgradCcdfLogLognormal_vv_151;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_152> AgradCcdfLogLognormal_vv_152;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_153> AgradCcdfLogLognormal_vv_153;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_154> AgradCcdfLogLognormal_vv_154;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_155> AgradCcdfLogLognormal_vv_155;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_156> AgradCcdfLogLognormal_vv_156;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_157> AgradCcdfLogLognormal_vv_157;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_158> AgradCcdfLogLognormal_vv_158;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_159> AgradCcdfLogLognormal_vv_159;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_160> AgradCcdfLogLognormal_vv_160;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_161> AgradCcdfLogLognormal_vv_161;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_162> AgradCcdfLogLognormal_vv_162;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_163> AgradCcdfLogLognormal_vv_163;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_164> AgradCcdfLogLognormal_vv_164;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_165> AgradCcdfLogLognormal_vv_165;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_166> AgradCcdfLogLognormal_vv_166;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_167> AgradCcdfLogLognormal_vv_167;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_168> AgradCcdfLogLognormal_vv_168;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_169> AgradCcdfLogLognormal_vv_169;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_170> AgradCcdfLogLognormal_vv_170;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_171> AgradCcdfLogLognormal_vv_171;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_172> AgradCcdfLogLognormal_vv_172;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_173> AgradCcdfLogLognormal_vv_173;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_174> AgradCcdfLogLognormal_vv_174;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_175> AgradCcdfLogLognormal_vv_175;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_176> AgradCcdfLogLognormal_vv_176;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_177> AgradCcdfLogLognormal_vv_177;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_178> AgradCcdfLogLognormal_vv_178;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_179> AgradCcdfLogLognormal_vv_179;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_180> AgradCcdfLogLognormal_vv_180;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_181> AgradCcdfLogLognormal_vv_181;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_182> AgradCcdfLogLognormal_vv_182;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_183> AgradCcdfLogLognormal_vv_183;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_184> AgradCcdfLogLognormal_vv_184;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_185> AgradCcdfLogLognormal_vv_185;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_186> AgradCcdfLogLognormal_vv_186;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_187> AgradCcdfLogLognormal_vv_187;
+typedef std::tuple<AgradCcdfLogLognormal, type_vv_188> AgradCcdfLogLognormal_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogLognormal_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogLognormal_vv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLognormal, type_ffv_0> AgradCdfLognormal_ffv_0;
+typedef std::tuple<AgradCdfLognormal, type_ffv_1> AgradCdfLognormal_ffv_1;
+typedef std::tuple<AgradCdfLognormal, type_ffv_2> AgradCdfLognormal_ffv_2;
+typedef std::tuple<AgradCdfLognormal, type_ffv_3> AgradCdfLognormal_ffv_3;
+typedef std::tuple<AgradCdfLognormal, type_ffv_4> AgradCdfLognormal_ffv_4;
+typedef std::tuple<AgradCdfLognormal, type_ffv_5> AgradCdfLognormal_ffv_5;
+typedef std::tuple<AgradCdfLognormal, type_ffv_6> AgradCdfLognormal_ffv_6;
+typedef std::tuple<AgradCdfLognormal, type_ffv_7> AgradCdfLognormal_ffv_7;
+typedef std::tuple<AgradCdfLognormal, type_ffv_8> AgradCdfLognormal_ffv_8;
+typedef std::tuple<AgradCdfLognormal, type_ffv_9> AgradCdfLognormal_ffv_9;
+typedef std::tuple<AgradCdfLognormal, type_ffv_10> AgradCdfLognormal_ffv_10;
+typedef std::tuple<AgradCdfLognormal, type_ffv_11> AgradCdfLognormal_ffv_11;
+typedef std::tuple<AgradCdfLognormal, type_ffv_12> AgradCdfLognormal_ffv_12;
+typedef std::tuple<AgradCdfLognormal, type_ffv_13> AgradCdfLognormal_ffv_13;
+typedef std::tuple<AgradCdfLognormal, type_ffv_14> AgradCdfLognormal_ffv_14;
+typedef std::tuple<AgradCdfLognormal, type_ffv_15> AgradCdfLognormal_ffv_15;
+typedef std::tuple<AgradCdfLognormal, type_ffv_16> AgradCdfLognormal_ffv_16;
+typedef std::tuple<AgradCdfLognormal, type_ffv_17> AgradCdfLognormal_ffv_17;
+typedef std::tuple<AgradCdfLognormal, type_ffv_18> AgradCdfLognormal_ffv_18;
+typedef std::tuple<AgradCdfLognormal, type_ffv_19> AgradCdfLognormal_ffv_19;
+typedef std::tuple<AgradCdfLognormal, type_ffv_20> AgradCdfLognormal_ffv_20;
+typedef std::tuple<AgradCdfLognormal, type_ffv_21> AgradCdfLognormal_ffv_21;
+typedef std::tuple<AgradCdfLognormal, type_ffv_22> AgradCdfLognormal_ffv_22;
+typedef std::tuple<AgradCdfLognormal, type_ffv_23> AgradCdfLognormal_ffv_23;
+typedef std::tuple<AgradCdfLognormal, type_ffv_24> AgradCdfLognormal_ffv_24;
+typedef std::tuple<AgradCdfLognormal, type_ffv_25> AgradCdfLognormal_ffv_25;
+typedef std::tuple<AgradCdfLognormal, type_ffv_26> AgradCdfLognormal_ffv_26;
+typedef std::tuple<AgradCdfLognormal, type_ffv_27> AgradCdfLognormal_ffv_27;
+typedef std::tuple<AgradCdfLognormal, type_ffv_28> AgradCdfLognormal_ffv_28;
+typedef std::tuple<AgradCdfLognormal, type_ffv_29> AgradCdfLognormal_ffv_29;
+typedef std::tuple<AgradCdfLognormal, type_ffv_30> AgradCdfLognormal_ffv_30;
+typedef std::tuple<AgradCdfLognormal, type_ffv_31> AgradCdfLognormal_ffv_31;
+typedef std::tuple<AgradCdfLognormal, type_ffv_32> AgradCdfLognormal_ffv_32;
+typedef std::tuple<AgradCdfLognormal, type_ffv_33> AgradCdfLognormal_ffv_33;
+typedef std::tuple<AgradCdfLognormal, type_ffv_34> AgradCdfLognormal_ffv_34;
+typedef std::tuple<AgradCdfLognormal, type_ffv_35> AgradCdfLognormal_ffv_35;
+typedef std::tuple<AgradCdfLognormal, type_ffv_36> AgradCdfLognormal_ffv_36;
+typedef std::tuple<AgradCdfLognormal, type_ffv_37> AgradCdfLognormal_ffv_37;
+typedef std::tuple<AgradCdfLognormal, type_ffv_38> AgradCdfLognormal_ffv_38;
+typedef std::tuple<AgradCdfLognormal, type_ffv_39> AgradCdfLognormal_ffv_39;
+typedef std::tuple<AgradCdfLognormal, type_ffv_40> AgradCdfLognormal_ffv_40;
+typedef std::tuple<AgradCdfLognormal, type_ffv_41> AgradCdfLognormal_ffv_41;
+typedef std::tuple<AgradCdfLognormal, type_ffv_42> AgradCdfLognormal_ffv_42;
+typedef std::tuple<AgradCdfLognormal, type_ffv_43> AgradCdfLognormal_ffv_43;
+typedef std::tuple<AgradCdfLognormal, type_ffv_44> AgradCdfLognormal_ffv_44;
+typedef std::tuple<AgradCdfLognormal, type_ffv_45> AgradCdfLognormal_ffv_45;
+typedef std::tuple<AgradCdfLognormal, type_ffv_46> AgradCdfLognormal_ffv_46;
+typedef std::tuple<AgradCdfLognormal, type_ffv_47> AgradCdfLognormal_ffv_47;
+typedef std::tuple<AgradCdfLognormal, type_ffv_48> AgradCdfLognormal_ffv_48;
+typedef std::tuple<AgradCdfLognormal, type_ffv_49> AgradCdfLognormal_ffv_49;
+typedef std::tuple<AgradCdfLognormal, type_ffv_50> AgradCdfLognormal_ffv_50;
+typedef std::tuple<AgradCdfLognormal, type_ffv_51> AgradCdfLognormal_ffv_51;
+typedef std::tuple<AgradCdfLognormal, type_ffv_52> AgradCdfLognormal_ffv_52;
+typedef std::tuple<AgradCdfLognormal, type_ffv_53> AgradCdfLognormal_ffv_53;
+typedef std::tuple<AgradCdfLognormal, type_ffv_54> AgradCdfLognormal_ffv_54;
+typedef std::tuple<AgradCdfLognormal, type_ffv_55> AgradCdfLognormal_ffv_55;
+typedef std::tuple<AgradCdfLognormal, type_ffv_56> AgradCdfLognormal_ffv_56;
+typedef std::tuple<AgradCdfLognormal, type_ffv_57> AgradCdfLognormal_ffv_57;
+typedef std::tuple<AgradCdfLognormal, type_ffv_58> AgradCdfLognormal_ffv_58;
+typedef std::tuple<AgradCdfLognormal, type_ffv_59> AgradCdfLognormal_ffv_59;
+typedef std::tuple<AgradCdfLognormal, type_ffv_60> AgradCdfLognormal_ffv_60;
+typedef std::tuple<AgradCdfLognormal, type_ffv_61> AgradCdfLognormal_ffv_61;
+typedef std::tuple<AgradCdfLognormal, type_ffv_62> AgradCdfLognormal_ffv_62;
+typedef std::tuple<AgradCdfLognormal, type_ffv_63> AgradCdfLognormal_ffv_63;
+typedef std::tuple<AgradCdfLognormal, type_ffv_64> AgradCdfLognormal_ffv_64;
+typedef std::tuple<AgradCdfLognormal, type_ffv_65> AgradCdfLognormal_ffv_65;
+typedef std::tuple<AgradCdfLognormal, type_ffv_66> AgradCdfLognormal_ffv_66;
+typedef std::tuple<AgradCdfLognormal, type_ffv_67> AgradCdfLognormal_ffv_67;
+typedef std::tuple<AgradCdfLognormal, type_ffv_68> AgradCdfLognormal_ffv_68;
+typedef std::tuple<AgradCdfLognormal, type_ffv_69> AgradCdfLognormal_ffv_69;
+typedef std::tuple<AgradCdfLognormal, type_ffv_70> AgradCdfLognormal_ffv_70;
+typedef std::tuple<AgradCdfLognormal, type_ffv_71> AgradCdfLognormal_ffv_71;
+typedef std::tuple<AgradCdfLognormal, type_ffv_72> AgradCdfLognormal_ffv_72;
+typedef std::tuple<AgradCdfLognormal, type_ffv_73> AgradCdfLognormal_ffv_73;
+typedef std::tuple<AgradCdfLognormal, type_ffv_74> AgradCdfLognormal_ffv_74;
+typedef std::tuple<AgradCdfLognormal, type_ffv_75> AgradCdfLognormal_ffv_75;
+typedef std::tuple<AgradCdfLognormal, type_ffv_76> AgradCdfLognormal_ffv_76;
+typedef std::tuple<AgradCdfLognormal, type_ffv_77> AgradCdfLognormal_ffv_77;
+typedef std::tuple<AgradCdfLognormal, type_ffv_78> AgradCdfLognormal_ffv_78;
+typedef std::tuple<AgradCdfLognormal, type_ffv_79> AgradCdfLognormal_ffv_79;
+typedef std::tuple<AgradCdfLognormal, type_ffv_80> AgradCdfLognormal_ffv_80;
+typedef std::tuple<AgradCdfLognormal, type_ffv_81> AgradCdfLognormal_ffv_81;
+typedef std::tuple<AgradCdfLognormal, type_ffv_82> AgradCdfLognormal_ffv_82;
+typedef std::tuple<AgradCdfLognormal, type_ffv_83> AgradCdfLognormal_ffv_83;
+typedef std::tuple<AgradCdfLognormal, type_ffv_84> AgradCdfLognormal_ffv_84;
+typedef std::tuple<AgradCdfLognormal, type_ffv_85> AgradCdfLognormal_ffv_85;
+typedef std::tuple<AgradCdfLognormal, type_ffv_86> AgradCdfLognormal_ffv_86;
+typedef std::tuple<AgradCdfLognormal, type_ffv_87> AgradCdfLognormal_ffv_87;
+typedef std::tuple<AgradCdfLognormal, type_ffv_88> AgradCdfLognormal_ffv_88;
+typedef std::tuple<AgradCdfLognormal, type_ffv_89> AgradCdfLognormal_ffv_89;
+typedef std::tuple<AgradCdfLognormal, type_ffv_90> AgradCdfLognormal_ffv_90;
+typedef std::tuple<AgradCdfLognormal, type_ffv_91> AgradCdfLognormal_ffv_91;
+typedef std::tuple<AgradCdfLognormal, type_ffv_92> AgradCdfLognormal_ffv_92;
+typedef std::tuple<AgradCdfLognormal, type_ffv_93> AgradCdfLognormal_ffv_93;
+typedef std::tuple<AgradCdfLognormal, type_ffv_94> AgradCdfLognormal_ffv_94;
+typedef std::tuple<AgradCdfLognormal, type_ffv_95> AgradCdfLognormal_ffv_95;
+typedef std::tuple<AgradCdfLognormal, type_ffv_96> AgradCdfLognormal_ffv_96;
+typedef std::tuple<AgradCdfLognormal, type_ffv_97> AgradCdfLognormal_ffv_97;
+typedef std::tuple<AgradCdfLognormal, type_ffv_98> AgradCdfLognormal_ffv_98;
+typedef std::tuple<AgradCdfLognormal, type_ffv_99> AgradCdfLognormal_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_0, AgradCdfTestFixture, AgradCdfLognormal_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_1, AgradCdfTestFixture, AgradCdfLognormal_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_2, AgradCdfTestFixture, AgradCdfLognormal_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_3, AgradCdfTestFixture, AgradCdfLognormal_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_4, AgradCdfTestFixture, AgradCdfLognormal_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_5, AgradCdfTestFixture, AgradCdfLognormal_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_6, AgradCdfTestFixture, AgradCdfLognormal_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_7, AgradCdfTestFixture, AgradCdfLognormal_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_8, AgradCdfTestFixture, AgradCdfLognormal_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_9, AgradCdfTestFixture, AgradCdfLognormal_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_10, AgradCdfTestFixture, AgradCdfLognormal_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_11, AgradCdfTestFixture, AgradCdfLognormal_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_12, AgradCdfTestFixture, AgradCdfLognormal_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_13, AgradCdfTestFixture, AgradCdfLognormal_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_14, AgradCdfTestFixture, AgradCdfLognormal_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_15, AgradCdfTestFixture, AgradCdfLognormal_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_16, AgradCdfTestFixture, AgradCdfLognormal_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_17, AgradCdfTestFixture, AgradCdfLognormal_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_18, AgradCdfTestFixture, AgradCdfLognormal_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_19, AgradCdfTestFixture, AgradCdfLognormal_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_20, AgradCdfTestFixture, AgradCdfLognormal_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_21, AgradCdfTestFixture, AgradCdfLognormal_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_22, AgradCdfTestFixture, AgradCdfLognormal_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_23, AgradCdfTestFixture, AgradCdfLognormal_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_24, AgradCdfTestFixture, AgradCdfLognormal_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_25, AgradCdfTestFixture, AgradCdfLognormal_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_26, AgradCdfTestFixture, AgradCdfLognormal_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_27, AgradCdfTestFixture, AgradCdfLognormal_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_28, AgradCdfTestFixture, AgradCdfLognormal_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_29, AgradCdfTestFixture, AgradCdfLognormal_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_30, AgradCdfTestFixture, AgradCdfLognormal_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_31, AgradCdfTestFixture, AgradCdfLognormal_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_32, AgradCdfTestFixture, AgradCdfLognormal_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_33, AgradCdfTestFixture, AgradCdfLognormal_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_34, AgradCdfTestFixture, AgradCdfLognormal_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_35, AgradCdfTestFixture, AgradCdfLognormal_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_36, AgradCdfTestFixture, AgradCdfLognormal_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_37, AgradCdfTestFixture, AgradCdfLognormal_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_38, AgradCdfTestFixture, AgradCdfLognormal_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_39, AgradCdfTestFixture, AgradCdfLognormal_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_40, AgradCdfTestFixture, AgradCdfLognormal_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_41, AgradCdfTestFixture, AgradCdfLognormal_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_42, AgradCdfTestFixture, AgradCdfLognormal_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_43, AgradCdfTestFixture, AgradCdfLognormal_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_44, AgradCdfTestFixture, AgradCdfLognormal_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_45, AgradCdfTestFixture, AgradCdfLognormal_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_46, AgradCdfTestFixture, AgradCdfLognormal_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_47, AgradCdfTestFixture, AgradCdfLognormal_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_48, AgradCdfTestFixture, AgradCdfLognormal_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_49, AgradCdfTestFixture, AgradCdfLognormal_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_50, AgradCdfTestFixture, AgradCdfLognormal_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_51, AgradCdfTestFixture, AgradCdfLognormal_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_52, AgradCdfTestFixture, AgradCdfLognormal_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_53, AgradCdfTestFixture, AgradCdfLognormal_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_54, AgradCdfTestFixture, AgradCdfLognormal_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_55, AgradCdfTestFixture, AgradCdfLognormal_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_56, AgradCdfTestFixture, AgradCdfLognormal_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_57, AgradCdfTestFixture, AgradCdfLognormal_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_58, AgradCdfTestFixture, AgradCdfLognormal_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_59, AgradCdfTestFixture, AgradCdfLognormal_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_60, AgradCdfTestFixture, AgradCdfLognormal_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_61, AgradCdfTestFixture, AgradCdfLognormal_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_62, AgradCdfTestFixture, AgradCdfLognormal_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_63, AgradCdfTestFixture, AgradCdfLognormal_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_64, AgradCdfTestFixture, AgradCdfLognormal_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_65, AgradCdfTestFixture, AgradCdfLognormal_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_66, AgradCdfTestFixture, AgradCdfLognormal_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_67, AgradCdfTestFixture, AgradCdfLognormal_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_68, AgradCdfTestFixture, AgradCdfLognormal_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_69, AgradCdfTestFixture, AgradCdfLognormal_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_70, AgradCdfTestFixture, AgradCdfLognormal_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_71, AgradCdfTestFixture, AgradCdfLognormal_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_72, AgradCdfTestFixture, AgradCdfLognormal_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_73, AgradCdfTestFixture, AgradCdfLognormal_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_74, AgradCdfTestFixture, AgradCdfLognormal_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_75, AgradCdfTestFixture, AgradCdfLognormal_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_76, AgradCdfTestFixture, AgradCdfLognormal_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_77, AgradCdfTestFixture, AgradCdfLognormal_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_78, AgradCdfTestFixture, AgradCdfLognormal_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_79, AgradCdfTestFixture, AgradCdfLognormal_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_80, AgradCdfTestFixture, AgradCdfLognormal_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_81, AgradCdfTestFixture, AgradCdfLognormal_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_82, AgradCdfTestFixture, AgradCdfLognormal_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_83, AgradCdfTestFixture, AgradCdfLognormal_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_84, AgradCdfTestFixture, AgradCdfLognormal_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_85, AgradCdfTestFixture, AgradCdfLognormal_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_86, AgradCdfTestFixture, AgradCdfLognormal_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_87, AgradCdfTestFixture, AgradCdfLognormal_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_88, AgradCdfTestFixture, AgradCdfLognormal_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_89, AgradCdfTestFixture, AgradCdfLognormal_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_90, AgradCdfTestFixture, AgradCdfLognormal_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_91, AgradCdfTestFixture, AgradCdfLognormal_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_92, AgradCdfTestFixture, AgradCdfLognormal_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_93, AgradCdfTestFixture, AgradCdfLognormal_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_94, AgradCdfTestFixture, AgradCdfLognormal_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_95, AgradCdfTestFixture, AgradCdfLognormal_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_96, AgradCdfTestFixture, AgradCdfLognormal_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_97, AgradCdfTestFixture, AgradCdfLognormal_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_98, AgradCdfTestFixture, AgradCdfLognormal_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_99, AgradCdfTestFixture, AgradCdfLognormal_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLognormal, type_v_0> AgradCdfLognormal_v_0;
+typedef std::tuple<AgradCdfLognormal, type_v_1> AgradCdfLognormal_v_1;
+typedef std::tuple<AgradCdfLognormal, type_v_2> AgradCdfLognormal_v_2;
+typedef std::tuple<AgradCdfLognormal, type_v_3> AgradCdfLognormal_v_3;
+typedef std::tuple<AgradCdfLognormal, type_v_4> AgradCdfLognormal_v_4;
+typedef std::tuple<AgradCdfLognormal, type_v_5> AgradCdfLognormal_v_5;
+typedef std::tuple<AgradCdfLognormal, type_v_6> AgradCdfLognormal_v_6;
+typedef std::tuple<AgradCdfLognormal, type_v_7> AgradCdfLognormal_v_7;
+typedef std::tuple<AgradCdfLognormal, type_v_8> AgradCdfLognormal_v_8;
+typedef std::tuple<AgradCdfLognormal, type_v_9> AgradCdfLognormal_v_9;
+typedef std::tuple<AgradCdfLognormal, type_v_10> AgradCdfLognormal_v_10;
+typedef std::tuple<AgradCdfLognormal, type_v_11> AgradCdfLognormal_v_11;
+typedef std::tuple<AgradCdfLognormal, type_v_12> AgradCdfLognormal_v_12;
+typedef std::tuple<AgradCdfLognormal, type_v_13> AgradCdfLognormal_v_13;
+typedef std::tuple<AgradCdfLognormal, type_v_14> AgradCdfLognormal_v_14;
+typedef std::tuple<AgradCdfLognormal, type_v_15> AgradCdfLognormal_v_15;
+typedef std::tuple<AgradCdfLognormal, type_v_16> AgradCdfLognormal_v_16;
+typedef std::tuple<AgradCdfLognormal, type_v_17> AgradCdfLognormal_v_17;
+typedef std::tuple<AgradCdfLognormal, type_v_18> AgradCdfLognormal_v_18;
+typedef std::tuple<AgradCdfLognormal, type_v_19> AgradCdfLognormal_v_19;
+typedef std::tuple<AgradCdfLognormal, type_v_20> AgradCdfLognormal_v_20;
+typedef std::tuple<AgradCdfLognormal, type_v_21> AgradCdfLognormal_v_21;
+typedef std::tuple<AgradCdfLognormal, type_v_22> AgradCdfLognormal_v_22;
+typedef std::tuple<AgradCdfLognormal, type_v_23> AgradCdfLognormal_v_23;
+typedef std::tuple<AgradCdfLognormal, type_v_24> AgradCdfLognormal_v_24;
+typedef std::tuple<AgradCdfLognormal, type_v_25> AgradCdfLognormal_v_25;
+typedef std::tuple<AgradCdfLognormal, type_v_26> AgradCdfLognormal_v_26;
+typedef std::tuple<AgradCdfLognormal, type_v_27> AgradCdfLognormal_v_27;
+typedef std::tuple<AgradCdfLognormal, type_v_28> AgradCdfLognormal_v_28;
+typedef std::tuple<AgradCdfLognormal, type_v_29> AgradCdfLognormal_v_29;
+typedef std::tuple<AgradCdfLognormal, type_v_30> AgradCdfLognormal_v_30;
+typedef std::tuple<AgradCdfLognormal, type_v_31> AgradCdfLognormal_v_31;
+typedef std::tuple<AgradCdfLognormal, type_v_32> AgradCdfLognormal_v_32;
+typedef std::tuple<AgradCdfLognormal, type_v_33> AgradCdfLognormal_v_33;
+typedef std::tuple<AgradCdfLognormal, type_v_34> AgradCdfLognormal_v_34;
+typedef std::tuple<AgradCdfLognormal, type_v_35> AgradCdfLognormal_v_35;
+typedef std::tuple<AgradCdfLognormal, type_v_36> AgradCdfLognormal_v_36;
+typedef std::tuple<AgradCdfLognormal, type_v_37> AgradCdfLognormal_v_37;
+typedef std::tuple<AgradCdfLognormal, type_v_38> AgradCdfLognormal_v_38;
+typedef std::tuple<AgradCdfLognormal, type_v_39> AgradCdfLognormal_v_39;
+typedef std::tuple<AgradCdfLognormal, type_v_40> AgradCdfLognormal_v_40;
+typedef std::tuple<AgradCdfLognormal, type_v_41> AgradCdfLognormal_v_41;
+typedef std::tuple<AgradCdfLognormal, type_v_42> AgradCdfLognormal_v_42;
+typedef std::tuple<AgradCdfLognormal, type_v_43> AgradCdfLognormal_v_43;
+typedef std::tuple<AgradCdfLognormal, type_v_44> AgradCdfLognormal_v_44;
+typedef std::tuple<AgradCdfLognormal, type_v_45> AgradCdfLognormal_v_45;
+typedef std::tuple<AgradCdfLognormal, type_v_46> AgradCdfLognormal_v_46;
+typedef std::tuple<AgradCdfLognormal, type_v_47> AgradCdfLognormal_v_47;
+typedef std::tuple<AgradCdfLognormal, type_v_48> AgradCdfLognormal_v_48;
+typedef std::tuple<AgradCdfLognormal, type_v_49> AgradCdfLognormal_v_49;
+typedef std::tuple<AgradCdfLognormal, type_v_50> AgradCdfLognormal_v_50;
+typedef std::tuple<AgradCdfLognormal, type_v_51> AgradCdfLognormal_v_51;
+typedef std::tuple<AgradCdfLognormal, type_v_52> AgradCdfLognormal_v_52;
+typedef std::tuple<AgradCdfLognormal, type_v_53> AgradCdfLognormal_v_53;
+typedef std::tuple<AgradCdfLognormal, type_v_54> AgradCdfLognormal_v_54;
+typedef std::tuple<AgradCdfLognormal, type_v_55> AgradCdfLognormal_v_55;
+typedef std::tuple<AgradCdfLognormal, type_v_56> AgradCdfLognormal_v_56;
+typedef std::tuple<AgradCdfLognormal, type_v_57> AgradCdfLognormal_v_57;
+typedef std::tuple<AgradCdfLognormal, type_v_58> AgradCdfLognormal_v_58;
+typedef std::tuple<AgradCdfLognormal, type_v_59> AgradCdfLognormal_v_59;
+typedef std::tuple<AgradCdfLognormal, type_v_60> AgradCdfLognormal_v_60;
+typedef std::tuple<AgradCdfLognormal, type_v_61> AgradCdfLognormal_v_61;
+typedef std::tuple<AgradCdfLognormal, type_v_62> AgradCdfLognormal_v_62;
+typedef std::tuple<AgradCdfLognormal, type_v_63> AgradCdfLognormal_v_63;
+typedef std::tuple<AgradCdfLognormal, type_v_64> AgradCdfLognormal_v_64;
+typedef std::tuple<AgradCdfLognormal, type_v_65> AgradCdfLognormal_v_65;
+typedef std::tuple<AgradCdfLognormal, type_v_66> AgradCdfLognormal_v_66;
+typedef std::tuple<AgradCdfLognormal, type_v_67> AgradCdfLognormal_v_67;
+typedef std::tuple<AgradCdfLognormal, type_v_68> AgradCdfLognormal_v_68;
+typedef std::tuple<AgradCdfLognormal, type_v_69> AgradCdfLognormal_v_69;
+typedef std::tuple<AgradCdfLognormal, type_v_70> AgradCdfLognormal_v_70;
+typedef std::tuple<AgradCdfLognormal, type_v_71> AgradCdfLognormal_v_71;
+typedef std::tuple<AgradCdfLognormal, type_v_72> AgradCdfLognormal_v_72;
+typedef std::tuple<AgradCdfLognormal, type_v_73> AgradCdfLognormal_v_73;
+typedef std::tuple<AgradCdfLognormal, type_v_74> AgradCdfLognormal_v_74;
+typedef std::tuple<AgradCdfLognormal, type_v_75> AgradCdfLognormal_v_75;
+typedef std::tuple<AgradCdfLognormal, type_v_76> AgradCdfLognormal_v_76;
+typedef std::tuple<AgradCdfLognormal, type_v_77> AgradCdfLognormal_v_77;
+typedef std::tuple<AgradCdfLognormal, type_v_78> AgradCdfLognormal_v_78;
+typedef std::tuple<AgradCdfLognormal, type_v_79> AgradCdfLognormal_v_79;
+typedef std::tuple<AgradCdfLognormal, type_v_80> AgradCdfLognormal_v_80;
+typedef std::tuple<AgradCdfLognormal, type_v_81> AgradCdfLognormal_v_81;
+typedef std::tuple<AgradCdfLognormal, type_v_82> AgradCdfLognormal_v_82;
+typedef std::tuple<AgradCdfLognormal, type_v_83> AgradCdfLognormal_v_83;
+typedef std::tuple<AgradCdfLognormal, type_v_84> AgradCdfLognormal_v_84;
+typedef std::tuple<AgradCdfLognormal, type_v_85> AgradCdfLognormal_v_85;
+typedef std::tuple<AgradCdfLognormal, type_v_86> AgradCdfLognormal_v_86;
+typedef std::tuple<AgradCdfLognormal, type_v_87> AgradCdfLognormal_v_87;
+typedef std::tuple<AgradCdfLognormal, type_v_88> AgradCdfLognormal_v_88;
+typedef std::tuple<AgradCdfLognormal, type_v_89> AgradCdfLognormal_v_89;
+typedef std::tuple<AgradCdfLognormal, type_v_90> AgradCdfLognormal_v_90;
+typedef std::tuple<AgradCdfLognormal, type_v_91> AgradCdfLognormal_v_91;
+typedef std::tuple<AgradCdfLognormal, type_v_92> AgradCdfLognormal_v_92;
+typedef std::tuple<AgradCdfLognormal, type_v_93> AgradCdfLognormal_v_93;
+typedef std::tuple<AgradCdfLognormal, type_v_94> AgradCdfLognormal_v_94;
+typedef std::tuple<AgradCdfLognormal, type_v_95> AgradCdfLognormal_v_95;
+typedef std::tuple<AgradCdfLognormal, type_v_96> AgradCdfLognormal_v_96;
+typedef std::tuple<AgradCdfLognormal, type_v_97> AgradCdfLognormal_v_97;
+typedef std::tuple<AgradCdfLognormal, type_v_98> AgradCdfLognormal_v_98;
+typedef std::tuple<AgradCdfLognormal, type_v_99> AgradCdfLognormal_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_0, AgradCdfTestFixture, AgradCdfLognormal_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_1, AgradCdfTestFixture, AgradCdfLognormal_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_2, AgradCdfTestFixture, AgradCdfLognormal_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_3, AgradCdfTestFixture, AgradCdfLognormal_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_4, AgradCdfTestFixture, AgradCdfLognormal_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_5, AgradCdfTestFixture, AgradCdfLognormal_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_6, AgradCdfTestFixture, AgradCdfLognormal_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_7, AgradCdfTestFixture, AgradCdfLognormal_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_8, AgradCdfTestFixture, AgradCdfLognormal_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_9, AgradCdfTestFixture, AgradCdfLognormal_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_10, AgradCdfTestFixture, AgradCdfLognormal_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_11, AgradCdfTestFixture, AgradCdfLognormal_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_12, AgradCdfTestFixture, AgradCdfLognormal_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_13, AgradCdfTestFixture, AgradCdfLognormal_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_14, AgradCdfTestFixture, AgradCdfLognormal_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_15, AgradCdfTestFixture, AgradCdfLognormal_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_16, AgradCdfTestFixture, AgradCdfLognormal_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_17, AgradCdfTestFixture, AgradCdfLognormal_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_18, AgradCdfTestFixture, AgradCdfLognormal_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_19, AgradCdfTestFixture, AgradCdfLognormal_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_20, AgradCdfTestFixture, AgradCdfLognormal_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_21, AgradCdfTestFixture, AgradCdfLognormal_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_22, AgradCdfTestFixture, AgradCdfLognormal_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_23, AgradCdfTestFixture, AgradCdfLognormal_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_24, AgradCdfTestFixture, AgradCdfLognormal_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_25, AgradCdfTestFixture, AgradCdfLognormal_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_26, AgradCdfTestFixture, AgradCdfLognormal_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_27, AgradCdfTestFixture, AgradCdfLognormal_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_28, AgradCdfTestFixture, AgradCdfLognormal_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_29, AgradCdfTestFixture, AgradCdfLognormal_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_30, AgradCdfTestFixture, AgradCdfLognormal_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_31, AgradCdfTestFixture, AgradCdfLognormal_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_32, AgradCdfTestFixture, AgradCdfLognormal_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_33, AgradCdfTestFixture, AgradCdfLognormal_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_34, AgradCdfTestFixture, AgradCdfLognormal_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_35, AgradCdfTestFixture, AgradCdfLognormal_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_36, AgradCdfTestFixture, AgradCdfLognormal_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_37, AgradCdfTestFixture, AgradCdfLognormal_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_38, AgradCdfTestFixture, AgradCdfLognormal_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_39, AgradCdfTestFixture, AgradCdfLognormal_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_40, AgradCdfTestFixture, AgradCdfLognormal_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_41, AgradCdfTestFixture, AgradCdfLognormal_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_42, AgradCdfTestFixture, AgradCdfLognormal_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_43, AgradCdfTestFixture, AgradCdfLognormal_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_44, AgradCdfTestFixture, AgradCdfLognormal_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_45, AgradCdfTestFixture, AgradCdfLognormal_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_46, AgradCdfTestFixture, AgradCdfLognormal_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_47, AgradCdfTestFixture, AgradCdfLognormal_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_48, AgradCdfTestFixture, AgradCdfLognormal_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_49, AgradCdfTestFixture, AgradCdfLognormal_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_50, AgradCdfTestFixture, AgradCdfLognormal_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_51, AgradCdfTestFixture, AgradCdfLognormal_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_52, AgradCdfTestFixture, AgradCdfLognormal_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_53, AgradCdfTestFixture, AgradCdfLognormal_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_54, AgradCdfTestFixture, AgradCdfLognormal_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_55, AgradCdfTestFixture, AgradCdfLognormal_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_56, AgradCdfTestFixture, AgradCdfLognormal_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_57, AgradCdfTestFixture, AgradCdfLognormal_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_58, AgradCdfTestFixture, AgradCdfLognormal_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_59, AgradCdfTestFixture, AgradCdfLognormal_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_60, AgradCdfTestFixture, AgradCdfLognormal_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_61, AgradCdfTestFixture, AgradCdfLognormal_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_62, AgradCdfTestFixture, AgradCdfLognormal_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_63, AgradCdfTestFixture, AgradCdfLognormal_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_64, AgradCdfTestFixture, AgradCdfLognormal_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_65, AgradCdfTestFixture, AgradCdfLognormal_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_66, AgradCdfTestFixture, AgradCdfLognormal_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_67, AgradCdfTestFixture, AgradCdfLognormal_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_68, AgradCdfTestFixture, AgradCdfLognormal_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_69, AgradCdfTestFixture, AgradCdfLognormal_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_70, AgradCdfTestFixture, AgradCdfLognormal_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_71, AgradCdfTestFixture, AgradCdfLognormal_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_72, AgradCdfTestFixture, AgradCdfLognormal_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_73, AgradCdfTestFixture, AgradCdfLognormal_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_74, AgradCdfTestFixture, AgradCdfLognormal_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_75, AgradCdfTestFixture, AgradCdfLognormal_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_76, AgradCdfTestFixture, AgradCdfLognormal_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_77, AgradCdfTestFixture, AgradCdfLognormal_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_78, AgradCdfTestFixture, AgradCdfLognormal_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_79, AgradCdfTestFixture, AgradCdfLognormal_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_80, AgradCdfTestFixture, AgradCdfLognormal_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_81, AgradCdfTestFixture, AgradCdfLognormal_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_82, AgradCdfTestFixture, AgradCdfLognormal_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_83, AgradCdfTestFixture, AgradCdfLognormal_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_84, AgradCdfTestFixture, AgradCdfLognormal_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_85, AgradCdfTestFixture, AgradCdfLognormal_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_86, AgradCdfTestFixture, AgradCdfLognormal_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_87, AgradCdfTestFixture, AgradCdfLognormal_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_88, AgradCdfTestFixture, AgradCdfLognormal_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_89, AgradCdfTestFixture, AgradCdfLognormal_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_90, AgradCdfTestFixture, AgradCdfLognormal_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_91, AgradCdfTestFixture, AgradCdfLognormal_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_92, AgradCdfTestFixture, AgradCdfLognormal_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_93, AgradCdfTestFixture, AgradCdfLognormal_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_94, AgradCdfTestFixture, AgradCdfLognormal_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_95, AgradCdfTestFixture, AgradCdfLognormal_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_96, AgradCdfTestFixture, AgradCdfLognormal_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_97, AgradCdfTestFixture, AgradCdfLognormal_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_98, AgradCdfTestFixture, AgradCdfLognormal_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_99, AgradCdfTestFixture, AgradCdfLognormal_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLognormal, type_vv_0> AgradCdfLognormal_vv_0;
+typedef std::tuple<AgradCdfLognormal, type_vv_1> AgradCdfLognormal_vv_1;
+typedef std::tuple<AgradCdfLognormal, type_vv_2> AgradCdfLognormal_vv_2;
+typedef std::tuple<AgradCdfLognormal, type_vv_3> AgradCdfLognormal_vv_3;
+typedef std::tuple<AgradCdfLognormal, type_vv_4> AgradCdfLognormal_vv_4;
+typedef std::tuple<AgradCdfLognormal, type_vv_5> AgradCdfLognormal_vv_5;
+typedef std::tuple<AgradCdfLognormal, type_vv_6> AgradCdfLognormal_vv_6;
+typedef std::tuple<AgradCdfLognormal, type_vv_7> AgradCdfLognormal_vv_7;
+typedef std::tuple<AgradCdfLognormal, type_vv_8> AgradCdfLognormal_vv_8;
+typedef std::tuple<AgradCdfLognormal, type_vv_9> AgradCdfLognormal_vv_9;
+typedef std::tuple<AgradCdfLognormal, type_vv_10> AgradCdfLognormal_vv_10;
+typedef std::tuple<AgradCdfLognormal, type_vv_11> AgradCdfLognormal_vv_11;
+typedef std::tuple<AgradCdfLognormal, type_vv_12> AgradCdfLognormal_vv_12;
+typedef std::tuple<AgradCdfLognormal, type_vv_13> AgradCdfLognormal_vv_13;
+typedef std::tuple<AgradCdfLognormal, type_vv_14> AgradCdfLognormal_vv_14;
+typedef std::tuple<AgradCdfLognormal, type_vv_15> AgradCdfLognormal_vv_15;
+typedef std::tuple<AgradCdfLognormal, type_vv_16> AgradCdfLognormal_vv_16;
+typedef std::tuple<AgradCdfLognormal, type_vv_17> AgradCdfLognormal_vv_17;
+typedef std::tuple<AgradCdfLognormal, type_vv_18> AgradCdfLognormal_vv_18;
+typedef std::tuple<AgradCdfLognormal, type_vv_19> AgradCdfLognormal_vv_19;
+typedef std::tuple<AgradCdfLognormal, type_vv_20> AgradCdfLognormal_vv_20;
+typedef std::tuple<AgradCdfLognormal, type_vv_21> AgradCdfLognormal_vv_21;
+typedef std::tuple<AgradCdfLognormal, type_vv_22> AgradCdfLognormal_vv_22;
+typedef std::tuple<AgradCdfLognormal, type_vv_23> AgradCdfLognormal_vv_23;
+typedef std::tuple<AgradCdfLognormal, type_vv_24> AgradCdfLognormal_vv_24;
+typedef std::tuple<AgradCdfLognormal, type_vv_25> AgradCdfLognormal_vv_25;
+typedef std::tuple<AgradCdfLognormal, type_vv_26> AgradCdfLognormal_vv_26;
+typedef std::tuple<AgradCdfLognormal, type_vv_27> AgradCdfLognormal_vv_27;
+typedef std::tuple<AgradCdfLognormal, type_vv_28> AgradCdfLognormal_vv_28;
+typedef std::tuple<AgradCdfLognormal, type_vv_29> AgradCdfLognormal_vv_29;
+typedef std::tuple<AgradCdfLognormal, type_vv_30> AgradCdfLognormal_vv_30;
+typedef std::tuple<AgradCdfLognormal, type_vv_31> AgradCdfLognormal_vv_31;
+typedef std::tuple<AgradCdfLognormal, type_vv_32> AgradCdfLognormal_vv_32;
+typedef std::tuple<AgradCdfLognormal, type_vv_33> AgradCdfLognormal_vv_33;
+typedef std::tuple<AgradCdfLognormal, type_vv_34> AgradCdfLognormal_vv_34;
+typedef std::tuple<AgradCdfLognormal, type_vv_35> AgradCdfLognormal_vv_35;
+typedef std::tuple<AgradCdfLognormal, type_vv_36> AgradCdfLognormal_vv_36;
+typedef std::tuple<AgradCdfLognormal, type_vv_37> AgradCdfLognormal_vv_37;
+typedef std::tuple<AgradCdfLognormal, type_vv_38> AgradCdfLognormal_vv_38;
+typedef std::tuple<AgradCdfLognormal, type_vv_39> AgradCdfLognormal_vv_39;
+typedef std::tuple<AgradCdfLognormal, type_vv_40> AgradCdfLognormal_vv_40;
+typedef std::tuple<AgradCdfLognormal, type_vv_41> AgradCdfLognormal_vv_41;
+typedef std::tuple<AgradCdfLognormal, type_vv_42> AgradCdfLognormal_vv_42;
+typedef std::tuple<AgradCdfLognormal, type_vv_43> AgradCdfLognormal_vv_43;
+typedef std::tuple<AgradCdfLognormal, type_vv_44> AgradCdfLognormal_vv_44;
+typedef std::tuple<AgradCdfLognormal, type_vv_45> AgradCdfLognormal_vv_45;
+typedef std::tuple<AgradCdfLognormal, type_vv_46> AgradCdfLognormal_vv_46;
+typedef std::tuple<AgradCdfLognormal, type_vv_47> AgradCdfLognormal_vv_47;
+typedef std::tuple<AgradCdfLognormal, type_vv_48> AgradCdfLognormal_vv_48;
+typedef std::tuple<AgradCdfLognormal, type_vv_49> AgradCdfLognormal_vv_49;
+typedef std::tuple<AgradCdfLognormal, type_vv_50> AgradCdfLognormal_vv_50;
+typedef std::tuple<AgradCdfLognormal, type_vv_51> AgradCdfLognormal_vv_51;
+typedef std::tuple<AgradCdfLognormal, type_vv_52> AgradCdfLognormal_vv_52;
+typedef std::tuple<AgradCdfLognormal, type_vv_53> AgradCdfLognormal_vv_53;
+typedef std::tuple<AgradCdfLognormal, type_vv_54> AgradCdfLognormal_vv_54;
+typedef std::tuple<AgradCdfLognormal, type_vv_55> AgradCdfLognormal_vv_55;
+typedef std::tuple<AgradCdfLognormal, type_vv_56> AgradCdfLognormal_vv_56;
+typedef std::tuple<AgradCdfLognormal, type_vv_57> AgradCdfLognormal_vv_57;
+typedef std::tuple<AgradCdfLognormal, type_vv_58> AgradCdfLognormal_vv_58;
+typedef std::tuple<AgradCdfLognormal, type_vv_59> AgradCdfLognormal_vv_59;
+typedef std::tuple<AgradCdfLognormal, type_vv_60> AgradCdfLognormal_vv_60;
+typedef std::tuple<AgradCdfLognormal, type_vv_61> AgradCdfLognormal_vv_61;
+typedef std::tuple<AgradCdfLognormal, type_vv_62> AgradCdfLognormal_vv_62;
+typedef std::tuple<AgradCdfLognormal, type_vv_63> AgradCdfLognormal_vv_63;
+typedef std::tuple<AgradCdfLognormal, type_vv_64> AgradCdfLognormal_vv_64;
+typedef std::tuple<AgradCdfLognormal, type_vv_65> AgradCdfLognormal_vv_65;
+typedef std::tuple<AgradCdfLognormal, type_vv_66> AgradCdfLognormal_vv_66;
+typedef std::tuple<AgradCdfLognormal, type_vv_67> AgradCdfLognormal_vv_67;
+typedef std::tuple<AgradCdfLognormal, type_vv_68> AgradCdfLognormal_vv_68;
+typedef std::tuple<AgradCdfLognormal, type_vv_69> AgradCdfLognormal_vv_69;
+typedef std::tuple<AgradCdfLognormal, type_vv_70> AgradCdfLognormal_vv_70;
+typedef std::tuple<AgradCdfLognormal, type_vv_71> AgradCdfLognormal_vv_71;
+typedef std::tuple<AgradCdfLognormal, type_vv_72> AgradCdfLognormal_vv_72;
+typedef std::tuple<AgradCdfLognormal, type_vv_73> AgradCdfLognormal_vv_73;
+typedef std::tuple<AgradCdfLognormal, type_vv_74> AgradCdfLognormal_vv_74;
+typedef std::tuple<AgradCdfLognormal, type_vv_75> AgradCdfLognormal_vv_75;
+typedef std::tuple<AgradCdfLognormal, type_vv_76> AgradCdfLognormal_vv_76;
+typedef std::tuple<AgradCdfLognormal, type_vv_77> AgradCdfLognormal_vv_77;
+typedef std::tuple<AgradCdfLognormal, type_vv_78> AgradCdfLognormal_vv_78;
+typedef std::tuple<AgradCdfLognormal, type_vv_79> AgradCdfLognormal_vv_79;
+typedef std::tuple<AgradCdfLognormal, type_vv_80> AgradCdfLognormal_vv_80;
+typedef std::tuple<AgradCdfLognormal, type_vv_81> AgradCdfLognormal_vv_81;
+typedef std::tuple<AgradCdfLognormal, type_vv_82> AgradCdfLognormal_vv_82;
+typedef std::tuple<AgradCdfLognormal, type_vv_83> AgradCdfLognormal_vv_83;
+typedef std::tuple<AgradCdfLognormal, type_vv_84> AgradCdfLognormal_vv_84;
+typedef std::tuple<AgradCdfLognormal, type_vv_85> AgradCdfLognormal_vv_85;
+typedef std::tuple<AgradCdfLognormal, type_vv_86> AgradCdfLognormal_vv_86;
+typedef std::tuple<AgradCdfLognormal, type_vv_87> AgradCdfLognormal_vv_87;
+typedef std::tuple<AgradCdfLognormal, type_vv_88> AgradCdfLognormal_vv_88;
+typedef std::tuple<AgradCdfLognormal, type_vv_89> AgradCdfLognormal_vv_89;
+typedef std::tuple<AgradCdfLognormal, type_vv_90> AgradCdfLognormal_vv_90;
+typedef std::tuple<AgradCdfLognormal, type_vv_91> AgradCdfLognormal_vv_91;
+typedef std::tuple<AgradCdfLognormal, type_vv_92> AgradCdfLognormal_vv_92;
+typedef std::tuple<AgradCdfLognormal, type_vv_93> AgradCdfLognormal_vv_93;
+typedef std::tuple<AgradCdfLognormal, type_vv_94> AgradCdfLognormal_vv_94;
+typedef std::tuple<AgradCdfLognormal, type_vv_95> AgradCdfLognormal_vv_95;
+typedef std::tuple<AgradCdfLognormal, type_vv_96> AgradCdfLognormal_vv_96;
+typedef std::tuple<AgradCdfLognormal, type_vv_97> AgradCdfLognormal_vv_97;
+typedef std::tuple<AgradCdfLognormal, type_vv_98> AgradCdfLognormal_vv_98;
+typedef std::tuple<AgradCdfLognormal, type_vv_99> AgradCdfLognormal_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_0, AgradCdfTestFixture, AgradCdfLognormal_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_1, AgradCdfTestFixture, AgradCdfLognormal_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_2, AgradCdfTestFixture, AgradCdfLognormal_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_3, AgradCdfTestFixture, AgradCdfLognormal_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_4, AgradCdfTestFixture, AgradCdfLognormal_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_5, AgradCdfTestFixture, AgradCdfLognormal_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_6, AgradCdfTestFixture, AgradCdfLognormal_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_7, AgradCdfTestFixture, AgradCdfLognormal_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_8, AgradCdfTestFixture, AgradCdfLognormal_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_9, AgradCdfTestFixture, AgradCdfLognormal_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_10, AgradCdfTestFixture, AgradCdfLognormal_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_11, AgradCdfTestFixture, AgradCdfLognormal_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_12, AgradCdfTestFixture, AgradCdfLognormal_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_13, AgradCdfTestFixture, AgradCdfLognormal_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_14, AgradCdfTestFixture, AgradCdfLognormal_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_15, AgradCdfTestFixture, AgradCdfLognormal_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_16, AgradCdfTestFixture, AgradCdfLognormal_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_17, AgradCdfTestFixture, AgradCdfLognormal_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_18, AgradCdfTestFixture, AgradCdfLognormal_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_19, AgradCdfTestFixture, AgradCdfLognormal_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_20, AgradCdfTestFixture, AgradCdfLognormal_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_21, AgradCdfTestFixture, AgradCdfLognormal_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_22, AgradCdfTestFixture, AgradCdfLognormal_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_23, AgradCdfTestFixture, AgradCdfLognormal_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_24, AgradCdfTestFixture, AgradCdfLognormal_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_25, AgradCdfTestFixture, AgradCdfLognormal_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_26, AgradCdfTestFixture, AgradCdfLognormal_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_27, AgradCdfTestFixture, AgradCdfLognormal_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_28, AgradCdfTestFixture, AgradCdfLognormal_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_29, AgradCdfTestFixture, AgradCdfLognormal_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_30, AgradCdfTestFixture, AgradCdfLognormal_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_31, AgradCdfTestFixture, AgradCdfLognormal_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_32, AgradCdfTestFixture, AgradCdfLognormal_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_33, AgradCdfTestFixture, AgradCdfLognormal_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_34, AgradCdfTestFixture, AgradCdfLognormal_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_35, AgradCdfTestFixture, AgradCdfLognormal_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_36, AgradCdfTestFixture, AgradCdfLognormal_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_37, AgradCdfTestFixture, AgradCdfLognormal_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_38, AgradCdfTestFixture, AgradCdfLognormal_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_39, AgradCdfTestFixture, AgradCdfLognormal_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_40, AgradCdfTestFixture, AgradCdfLognormal_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_41, AgradCdfTestFixture, AgradCdfLognormal_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_42, AgradCdfTestFixture, AgradCdfLognormal_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_43, AgradCdfTestFixture, AgradCdfLognormal_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_44, AgradCdfTestFixture, AgradCdfLognormal_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_45, AgradCdfTestFixture, AgradCdfLognormal_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_46, AgradCdfTestFixture, AgradCdfLognormal_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_47, AgradCdfTestFixture, AgradCdfLognormal_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_48, AgradCdfTestFixture, AgradCdfLognormal_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_49, AgradCdfTestFixture, AgradCdfLognormal_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_50, AgradCdfTestFixture, AgradCdfLognormal_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_51, AgradCdfTestFixture, AgradCdfLognormal_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_52, AgradCdfTestFixture, AgradCdfLognormal_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_53, AgradCdfTestFixture, AgradCdfLognormal_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_54, AgradCdfTestFixture, AgradCdfLognormal_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_55, AgradCdfTestFixture, AgradCdfLognormal_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_56, AgradCdfTestFixture, AgradCdfLognormal_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_57, AgradCdfTestFixture, AgradCdfLognormal_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_58, AgradCdfTestFixture, AgradCdfLognormal_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_59, AgradCdfTestFixture, AgradCdfLognormal_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_60, AgradCdfTestFixture, AgradCdfLognormal_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_61, AgradCdfTestFixture, AgradCdfLognormal_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_62, AgradCdfTestFixture, AgradCdfLognormal_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_63, AgradCdfTestFixture, AgradCdfLognormal_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_64, AgradCdfTestFixture, AgradCdfLognormal_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_65, AgradCdfTestFixture, AgradCdfLognormal_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_66, AgradCdfTestFixture, AgradCdfLognormal_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_67, AgradCdfTestFixture, AgradCdfLognormal_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_68, AgradCdfTestFixture, AgradCdfLognormal_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_69, AgradCdfTestFixture, AgradCdfLognormal_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_70, AgradCdfTestFixture, AgradCdfLognormal_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_71, AgradCdfTestFixture, AgradCdfLognormal_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_72, AgradCdfTestFixture, AgradCdfLognormal_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_73, AgradCdfTestFixture, AgradCdfLognormal_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_74, AgradCdfTestFixture, AgradCdfLognormal_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_75, AgradCdfTestFixture, AgradCdfLognormal_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_76, AgradCdfTestFixture, AgradCdfLognormal_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_77, AgradCdfTestFixture, AgradCdfLognormal_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_78, AgradCdfTestFixture, AgradCdfLognormal_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_79, AgradCdfTestFixture, AgradCdfLognormal_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_80, AgradCdfTestFixture, AgradCdfLognormal_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_81, AgradCdfTestFixture, AgradCdfLognormal_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_82, AgradCdfTestFixture, AgradCdfLognormal_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_83, AgradCdfTestFixture, AgradCdfLognormal_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_84, AgradCdfTestFixture, AgradCdfLognormal_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_85, AgradCdfTestFixture, AgradCdfLognormal_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_86, AgradCdfTestFixture, AgradCdfLognormal_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_87, AgradCdfTestFixture, AgradCdfLognormal_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_88, AgradCdfTestFixture, AgradCdfLognormal_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_89, AgradCdfTestFixture, AgradCdfLognormal_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_90, AgradCdfTestFixture, AgradCdfLognormal_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_91, AgradCdfTestFixture, AgradCdfLognormal_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_92, AgradCdfTestFixture, AgradCdfLognormal_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_93, AgradCdfTestFixture, AgradCdfLognormal_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_94, AgradCdfTestFixture, AgradCdfLognormal_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_95, AgradCdfTestFixture, AgradCdfLognormal_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_96, AgradCdfTestFixture, AgradCdfLognormal_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_97, AgradCdfTestFixture, AgradCdfLognormal_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_98, AgradCdfTestFixture, AgradCdfLognormal_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_99, AgradCdfTestFixture, AgradCdfLognormal_vv_99);
+
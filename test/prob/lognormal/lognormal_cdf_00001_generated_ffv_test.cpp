@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLognormal, type_ffv_100> AgradCdfLognormal_ffv_100;
+typedef std::tuple<AgradCdfLognormal, type_ffv_101> AgradCdfLognormal_ffv_101;
+typedef std::tuple<AgradCdfLognormal, type_ffv_102> AgradCdfLognormal_ffv_102;
+typedef std::tuple<AgradCdfLognormal, type_ffv_103> AgradCdfLognormal_ffv_103;
+typedef std::tuple<AgradCdfLognormal, type_ffv_104> AgradCdfLognormal_ffv_104;
+typedef std::tuple<AgradCdfLognormal, type_ffv_105> AgradCdfLognormal_ffv_105;
+typedef std::tuple<AgradCdfLognormal, type_ffv_106> AgradCdfLognormal_ffv_106;
+typedef std::tuple<AgradCdfLognormal, type_ffv_107> AgradCdfLognormal_ffv_107;
+typedef std::tuple<AgradCdfLognormal, type_ffv_108> AgradCdfLognormal_ffv_108;
+typedef std::tuple<AgradCdfLognormal, type_ffv_109> AgradCdfLognormal_ffv_109;
+typedef std::tuple<AgradCdfLognormal, type_ffv_110> AgradCdfLognormal_ffv_110;
+typedef std::tuple<AgradCdfLognormal, type_ffv_111> AgradCdfLognormal_ffv_111;
+typedef std::tuple<AgradCdfLognormal, type_ffv_112> AgradCdfLognormal_ffv_112;
+typedef std::tuple<AgradCdfLognormal, type_ffv_113> AgradCdfLognormal_ffv_113;
+typedef std::tuple<AgradCdfLognormal, type_ffv_114> AgradCdfLognormal_ffv_114;
+typedef std::tuple<AgradCdfLognormal, type_ffv_115> AgradCdfLognormal_ffv_115;
+typedef std::tuple<AgradCdfLognormal, type_ffv_116> AgradCdfLognormal_ffv_116;
+typedef std::tuple<AgradCdfLognormal, type_ffv_117> AgradCdfLognormal_ffv_117;
+typedef std::tuple<AgradCdfLognormal, type_ffv_118> AgradCdfLognormal_ffv_118;
+typedef std::tuple<AgradCdfLognormal, type_ffv_119> AgradCdfLognormal_ffv_119;
+typedef std::tuple<AgradCdfLognormal, type_ffv_120> AgradCdfLognormal_ffv_120;
+typedef std::tuple<AgradCdfLognormal, type_ffv_121> AgradCdfLognormal_ffv_121;
+typedef std::tuple<AgradCdfLognormal, type_ffv_122> AgradCdfLognormal_ffv_122;
+typedef std::tuple<AgradCdfLognormal, type_ffv_123> AgradCdfLognormal_ffv_123;
+typedef std::tuple<AgradCdfLognormal, type_ffv_124> AgradCdfLognormal_ffv_124;
+typedef std::tuple<AgradCdfLognormal, type_ffv_125> AgradCdfLognormal_ffv_125;
+typedef std::tuple<AgradCdfLognormal, type_ffv_126> AgradCdfLognormal_ffv_126;
+typedef std::tuple<AgradCdfLognormal, type_ffv_127> AgradCdfLognormal_ffv_127;
+typedef std::tuple<AgradCdfLognormal, type_ffv_128> AgradCdfLognormal_ffv_128;
+typedef std::tuple<AgradCdfLognormal, type_ffv_129> AgradCdfLognormal_ffv_129;
+typedef std::tuple<AgradCdfLognormal, type_ffv_130> AgradCdfLognormal_ffv_130;
+typedef std::tuple<AgradCdfLognormal, type_ffv_131> AgradCdfLognormal_ffv_131;
+typedef std::tuple<AgradCdfLognormal, type_ffv_132> AgradCdfLognormal_ffv_132;
+typedef std::tuple<AgradCdfLognormal, type_ffv_133> AgradCdfLognormal_ffv_133;
+typedef std::tuple<AgradCdfLognormal, type_ffv_134> AgradCdfLognormal_ffv_134;
+typedef std::tuple<AgradCdfLognormal, type_ffv_135> AgradCdfLognormal_ffv_135;
+typedef std::tuple<AgradCdfLognormal, type_ffv_136> AgradCdfLognormal_ffv_136;
+typedef std::tuple<AgradCdfLognormal, type_ffv_137> AgradCdfLognormal_ffv_137;
+typedef std::tuple<AgradCdfLognormal, type_ffv_138> AgradCdfLognormal_ffv_138;
+typedef std::tuple<AgradCdfLognormal, type_ffv_139> AgradCdfLognormal_ffv_139;
+typedef std::tuple<AgradCdfLognormal, type_ffv_140> AgradCdfLognormal_ffv_140;
+typedef std::tuple<AgradCdfLognormal, type_ffv_141> AgradCdfLognormal_ffv_141;
+typedef std::tuple<AgradCdfLognormal, type_ffv_142> AgradCdfLognormal_ffv_142;
+typedef std::tuple<AgradCdfLognormal, type_ffv_143> AgradCdfLognormal_ffv_143;
+typedef std::tuple<AgradCdfLognormal, type_ffv_144> AgradCdfLognormal_ffv_144;
+typedef std::tuple<AgradCdfLognormal, type_ffv_145> AgradCdfLognormal_ffv_145;
+typedef std::tuple<AgradCdfLognormal, type_ffv_146> AgradCdfLognormal_ffv_146;
+typedef std::tuple<AgradCdfLognormal, type_ffv_147> AgradCdfLognormal_ffv_147;
+typedef std::tuple<AgradCdfLognormal, type_ffv_148> AgradCdfLognormal_ffv_148;
+typedef std::tuple<AgradCdfLognormal, type_ffv_149> AgradCdfLognormal_ffv_149;
+typedef std::tuple<AgradCdfLognormal, type_ffv_150> AgradCdfLognormal_ffv_150;
+typedef std::tuple<AgradCdfLognormal, type_ffv_151> AgradCdfLognormal_ffv_151;
+typedef std::tuple<AgradCdfLognormal, type_ffv_152> AgradCdfLognormal_ffv_152;
+typedef std::tuple<AgradCdfLognormal, type_ffv_153> AgradCdfLognormal_ffv_153;
+typedef std::tuple<AgradCdfLognormal, type_ffv_154> AgradCdfLognormal_ffv_154;
+typedef std::tuple<AgradCdfLognormal, type_ffv_155> AgradCdfLognormal_ffv_155;
+typedef std::tuple<AgradCdfLognormal, type_ffv_156> AgradCdfLognormal_ffv_156;
+typedef std::tuple<AgradCdfLognormal, type_ffv_157> AgradCdfLognormal_ffv_157;
+typedef std::tuple<AgradCdfLognormal, type_ffv_158> AgradCdfLognormal_ffv_158;
+typedef std::tuple<AgradCdfLognormal, type_ffv_159> AgradCdfLognormal_ffv_159;
+typedef std::tuple<AgradCdfLognormal, type_ffv_160> AgradCdfLognormal_ffv_160;
+typedef std::tuple<AgradCdfLognormal, type_ffv_161> AgradCdfLognormal_ffv_161;
+typedef std::tuple<AgradCdfLognormal, type_ffv_162> AgradCdfLognormal_ffv_162;
+typedef std::tuple<AgradCdfLognormal, type_ffv_163> AgradCdfLognormal_ffv_163;
+typedef std::tuple<AgradCdfLognormal, type_ffv_164> AgradCdfLognormal_ffv_164;
+typedef std::tuple<AgradCdfLognormal, type_ffv_165> AgradCdfLognormal_ffv_165;
+typedef std::tuple<AgradCdfLognormal, type_ffv_166> AgradCdfLognormal_ffv_166;
+typedef std::tuple<AgradCdfLognormal, type_ffv_167> AgradCdfLognormal_ffv_167;
+typedef std::tuple<AgradCdfLognormal, type_ffv_168> AgradCdfLognormal_ffv_168;
+typedef std::tuple<AgradCdfLognormal, type_ffv_169> AgradCdfLognormal_ffv_169;
+typedef std::tuple<AgradCdfLognormal, type_ffv_170> AgradCdfLognormal_ffv_170;
+typedef std::tuple<AgradCdfLognormal, type_ffv_171> AgradCdfLognormal_ffv_171;
+typedef std::tuple<AgradCdfLognormal, type_ffv_172> AgradCdfLognormal_ffv_172;
+typedef std::tuple<AgradCdfLognormal, type_ffv_173> AgradCdfLognormal_ffv_173;
+typedef std::tuple<AgradCdfLognormal, type_ffv_174> AgradCdfLognormal_ffv_174;
+typedef std::tuple<AgradCdfLognormal, type_ffv_175> AgradCdfLognormal_ffv_175;
+typedef std::tuple<AgradCdfLognormal, type_ffv_176> AgradCdfLognormal_ffv_176;
+typedef std::tuple<AgradCdfLognormal, type_ffv_177> AgradCdfLognormal_ffv_177;
+typedef std::tuple<AgradCdfLognormal, type_ffv_178> AgradCdfLognormal_ffv_178;
+typedef std::tuple<AgradCdfLognormal, type_ffv_179> AgradCdfLognormal_ffv_179;
+typedef std::tuple<AgradCdfLognormal, type_ffv_180> AgradCdfLognormal_ffv_180;
+typedef std::tuple<AgradCdfLognormal, type_ffv_181> AgradCdfLognormal_ffv_181;
+typedef std::tuple<AgradCdfLognormal, type_ffv_182> AgradCdfLognormal_ffv_182;
+typedef std::tuple<AgradCdfLognormal, type_ffv_183> AgradCdfLognormal_ffv_183;
+typedef std::tuple<AgradCdfLognormal, type_ffv_184> AgradCdfLognormal_ffv_184;
+typedef std::tuple<AgradCdfLognormal, type_ffv_185> AgradCdfLognormal_ffv_185;
+typedef std::tuple<AgradCdfLognormal, type_ffv_186> AgradCdfLognormal_ffv_186;
+typedef std::tuple<AgradCdfLognormal, type_ffv_187> AgradCdfLognormal_ffv_187;
+typedef std::tuple<AgradCdfLognormal, type_ffv_188> AgradCdfLognormal_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_100, AgradCdfTestFixture, AgradCdfLognormal_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_101, AgradCdfTestFixture, AgradCdfLognormal_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_102, AgradCdfTestFixture, AgradCdfLognormal_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_103, AgradCdfTestFixture, AgradCdfLognormal_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_104, AgradCdfTestFixture, AgradCdfLognormal_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_105, AgradCdfTestFixture, AgradCdfLognormal_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_106, AgradCdfTestFixture, AgradCdfLognormal_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_107, AgradCdfTestFixture, AgradCdfLognormal_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_108, AgradCdfTestFixture, AgradCdfLognormal_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_109, AgradCdfTestFixture, AgradCdfLognormal_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_110, AgradCdfTestFixture, AgradCdfLognormal_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_111, AgradCdfTestFixture, AgradCdfLognormal_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_112, AgradCdfTestFixture, AgradCdfLognormal_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_113, AgradCdfTestFixture, AgradCdfLognormal_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_114, AgradCdfTestFixture, AgradCdfLognormal_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_115, AgradCdfTestFixture, AgradCdfLognormal_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_116, AgradCdfTestFixture, AgradCdfLognormal_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_117, AgradCdfTestFixture, AgradCdfLognormal_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_118, AgradCdfTestFixture, AgradCdfLognormal_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_119, AgradCdfTestFixture, AgradCdfLognormal_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_120, AgradCdfTestFixture, AgradCdfLognormal_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_121, AgradCdfTestFixture, AgradCdfLognormal_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_122, AgradCdfTestFixture, AgradCdfLognormal_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_123, AgradCdfTestFixture, AgradCdfLognormal_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_124, AgradCdfTestFixture, AgradCdfLognormal_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_125, AgradCdfTestFixture, AgradCdfLognormal_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_126, AgradCdfTestFixture, AgradCdfLognormal_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_127, AgradCdfTestFixture, AgradCdfLognormal_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_128, AgradCdfTestFixture, AgradCdfLognormal_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_129, AgradCdfTestFixture, AgradCdfLognormal_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_130, AgradCdfTestFixture, AgradCdfLognormal_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_131, AgradCdfTestFixture, AgradCdfLognormal_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_132, AgradCdfTestFixture, AgradCdfLognormal_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_133, AgradCdfTestFixture, AgradCdfLognormal_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_134, AgradCdfTestFixture, AgradCdfLognormal_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_135, AgradCdfTestFixture, AgradCdfLognormal_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_136, AgradCdfTestFixture, AgradCdfLognormal_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_137, AgradCdfTestFixture, AgradCdfLognormal_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_138, AgradCdfTestFixture, AgradCdfLognormal_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_139, AgradCdfTestFixture, AgradCdfLognormal_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_140, AgradCdfTestFixture, AgradCdfLognormal_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_141, AgradCdfTestFixture, AgradCdfLognormal_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_142, AgradCdfTestFixture, AgradCdfLognormal_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_143, AgradCdfTestFixture, AgradCdfLognormal_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_144, AgradCdfTestFixture, AgradCdfLognormal_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_145, AgradCdfTestFixture, AgradCdfLognormal_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_146, AgradCdfTestFixture, AgradCdfLognormal_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_147, AgradCdfTestFixture, AgradCdfLognormal_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_148, AgradCdfTestFixture, AgradCdfLognormal_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_149, AgradCdfTestFixture, AgradCdfLognormal_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_150, AgradCdfTestFixture, AgradCdfLognormal_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_151, AgradCdfTestFixture, AgradCdfLognormal_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_152, AgradCdfTestFixture, AgradCdfLognormal_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_153, AgradCdfTestFixture, AgradCdfLognormal_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_154, AgradCdfTestFixture, AgradCdfLognormal_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_155, AgradCdfTestFixture, AgradCdfLognormal_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_156, AgradCdfTestFixture, AgradCdfLognormal_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_157, AgradCdfTestFixture, AgradCdfLognormal_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_158, AgradCdfTestFixture, AgradCdfLognormal_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_159, AgradCdfTestFixture, AgradCdfLognormal_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_160, AgradCdfTestFixture, AgradCdfLognormal_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_161, AgradCdfTestFixture, AgradCdfLognormal_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_162, AgradCdfTestFixture, AgradCdfLognormal_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_163, AgradCdfTestFixture, AgradCdfLognormal_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_164, AgradCdfTestFixture, AgradCdfLognormal_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_165, AgradCdfTestFixture, AgradCdfLognormal_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_166, AgradCdfTestFixture, AgradCdfLognormal_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_167, AgradCdfTestFixture, AgradCdfLognormal_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_168, AgradCdfTestFixture, AgradCdfLognormal_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_169, AgradCdfTestFixture, AgradCdfLognormal_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_170, AgradCdfTestFixture, AgradCdfLognormal_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_171, AgradCdfTestFixture, AgradCdfLognormal_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_172, AgradCdfTestFixture, AgradCdfLognormal_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_173, AgradCdfTestFixture, AgradCdfLognormal_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_174, AgradCdfTestFixture, AgradCdfLognormal_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_175, AgradCdfTestFixture, AgradCdfLognormal_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_176, AgradCdfTestFixture, AgradCdfLognormal_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_177, AgradCdfTestFixture, AgradCdfLognormal_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_178, AgradCdfTestFixture, AgradCdfLognormal_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_179, AgradCdfTestFixture, AgradCdfLognormal_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_180, AgradCdfTestFixture, AgradCdfLognormal_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_181, AgradCdfTestFixture, AgradCdfLognormal_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_182, AgradCdfTestFixture, AgradCdfLognormal_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_183, AgradCdfTestFixture, AgradCdfLognormal_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_184, AgradCdfTestFixture, AgradCdfLognormal_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_185, AgradCdfTestFixture, AgradCdfLognormal_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_186, AgradCdfTestFixture, AgradCdfLognormal_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_187, AgradCdfTestFixture, AgradCdfLognormal_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_ffv_188, AgradCdfTestFixture, AgradCdfLognormal_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLognormal, type_v_100> AgradCdfLognormal_v_100;
+typedef std::tuple<AgradCdfLognormal, type_v_101> AgradCdfLognormal_v_101;
+typedef std::tuple<AgradCdfLognormal, type_v_102> AgradCdfLognormal_v_102;
+typedef std::tuple<AgradCdfLognormal, type_v_103> AgradCdfLognormal_v_103;
+typedef std::tuple<AgradCdfLognormal, type_v_104> AgradCdfLognormal_v_104;
+typedef std::tuple<AgradCdfLognormal, type_v_105> AgradCdfLognormal_v_105;
+typedef std::tuple<AgradCdfLognormal, type_v_106> AgradCdfLognormal_v_106;
+typedef std::tuple<AgradCdfLognormal, type_v_107> AgradCdfLognormal_v_107;
+typedef std::tuple<AgradCdfLognormal, type_v_108> AgradCdfLognormal_v_108;
+typedef std::tuple<AgradCdfLognormal, type_v_109> AgradCdfLognormal_v_109;
+typedef std::tuple<AgradCdfLognormal, type_v_110> AgradCdfLognormal_v_110;
+typedef std::tuple<AgradCdfLognormal, type_v_111> AgradCdfLognormal_v_111;
+typedef std::tuple<AgradCdfLognormal, type_v_112> AgradCdfLognormal_v_112;
+typedef std::tuple<AgradCdfLognormal, type_v_113> AgradCdfLognormal_v_113;
+typedef std::tuple<AgradCdfLognormal, type_v_114> AgradCdfLognormal_v_114;
+typedef std::tuple<AgradCdfLognormal, type_v_115> AgradCdfLognormal_v_115;
+typedef std::tuple<AgradCdfLognormal, type_v_116> AgradCdfLognormal_v_116;
+typedef std::tuple<AgradCdfLognormal, type_v_117> AgradCdfLognormal_v_117;
+typedef std::tuple<AgradCdfLognormal, type_v_118> AgradCdfLognormal_v_118;
+typedef std::tuple<AgradCdfLognormal, type_v_119> AgradCdfLognormal_v_119;
+typedef std::tuple<AgradCdfLognormal, type_v_120> AgradCdfLognormal_v_120;
+typedef std::tuple<AgradCdfLognormal, type_v_121> AgradCdfLognormal_v_121;
+typedef std::tuple<AgradCdfLognormal, type_v_122> AgradCdfLognormal_v_122;
+typedef std::tuple<AgradCdfLognormal, type_v_123> AgradCdfLognormal_v_123;
+typedef std::tuple<AgradCdfLognormal, type_v_124> AgradCdfLognormal_v_124;
+typedef std::tuple<AgradCdfLognormal, type_v_125> AgradCdfLognormal_v_125;
+typedef std::tuple<AgradCdfLognormal, type_v_126> AgradCdfLognormal_v_126;
+typedef std::tuple<AgradCdfLognormal, type_v_127> AgradCdfLognormal_v_127;
+typedef std::tuple<AgradCdfLognormal, type_v_128> AgradCdfLognormal_v_128;
+typedef std::tuple<AgradCdfLognormal, type_v_129> AgradCdfLognormal_v_129;
+typedef std::tuple<AgradCdfLognormal, type_v_130> AgradCdfLognormal_v_130;
+typedef std::tuple<AgradCdfLognormal, type_v_131> AgradCdfLognormal_v_131;
+typedef std::tuple<AgradCdfLognormal, type_v_132> AgradCdfLognormal_v_132;
+typedef std::tuple<AgradCdfLognormal, type_v_133> AgradCdfLognormal_v_133;
+typedef std::tuple<AgradCdfLognormal, type_v_134> AgradCdfLognormal_v_134;
+typedef std::tuple<AgradCdfLognormal, type_v_135> AgradCdfLognormal_v_135;
+typedef std::tuple<AgradCdfLognormal, type_v_136> AgradCdfLognormal_v_136;
+typedef std::tuple<AgradCdfLognormal, type_v_137> AgradCdfLognormal_v_137;
+typedef std::tuple<AgradCdfLognormal, type_v_138> AgradCdfLognormal_v_138;
+typedef std::tuple<AgradCdfLognormal, type_v_139> AgradCdfLognormal_v_139;
+typedef std::tuple<AgradCdfLognormal, type_v_140> AgradCdfLognormal_v_140;
+typedef std::tuple<AgradCdfLognormal, type_v_141> AgradCdfLognormal_v_141;
+typedef std::tuple<AgradCdfLognormal, type_v_142> AgradCdfLognormal_v_142;
+typedef std::tuple<AgradCdfLognormal, type_v_143> AgradCdfLognormal_v_143;
+typedef std::tuple<AgradCdfLognormal, type_v_144> AgradCdfLognormal_v_144;
+typedef std::tuple<AgradCdfLognormal, type_v_145> AgradCdfLognormal_v_145;
+typedef std::tuple<AgradCdfLognormal, type_v_146> AgradCdfLognormal_v_146;
+typedef std::tuple<AgradCdfLognormal, type_v_147> AgradCdfLognormal_v_147;
+typedef std::tuple<AgradCdfLognormal, type_v_148> AgradCdfLognormal_v_148;
+typedef std::tuple<AgradCdfLognormal, type_v_149> AgradCdfLognormal_v_149;
+typedef std::tuple<AgradCdfLognormal, type_v_150> AgradCdfLognormal_v_150;
+typedef std::tuple<AgradCdfLognormal, type_v_151> AgradCdfLognormal_v_151;
+typedef std::tuple<AgradCdfLognormal, type_v_152> AgradCdfLognormal_v_152;
+typedef std::tuple<AgradCdfLognormal, type_v_153> AgradCdfLognormal_v_153;
+typedef std::tuple<AgradCdfLognormal, type_v_154> AgradCdfLognormal_v_154;
+typedef std::tuple<AgradCdfLognormal, type_v_155> AgradCdfLognormal_v_155;
+typedef std::tuple<AgradCdfLognormal, type_v_156> AgradCdfLognormal_v_156;
+typedef std::tuple<AgradCdfLognormal, type_v_157> AgradCdfLognormal_v_157;
+typedef std::tuple<AgradCdfLognormal, type_v_158> AgradCdfLognormal_v_158;
+typedef std::tuple<AgradCdfLognormal, type_v_159> AgradCdfLognormal_v_159;
+typedef std::tuple<AgradCdfLognormal, type_v_160> AgradCdfLognormal_v_160;
+typedef std::tuple<AgradCdfLognormal, type_v_161> AgradCdfLognormal_v_161;
+typedef std::tuple<AgradCdfLognormal, type_v_162> AgradCdfLognormal_v_162;
+typedef std::tuple<AgradCdfLognormal, type_v_163> AgradCdfLognormal_v_163;
+typedef std::tuple<AgradCdfLognormal, type_v_164> AgradCdfLognormal_v_164;
+typedef std::tuple<AgradCdfLognormal, type_v_165> AgradCdfLognormal_v_165;
+typedef std::tuple<AgradCdfLognormal, type_v_166> AgradCdfLognormal_v_166;
+typedef std::tuple<AgradCdfLognormal, type_v_167> AgradCdfLognormal_v_167;
+typedef std::tuple<AgradCdfLognormal, type_v_168> AgradCdfLognormal_v_168;
+typedef std::tuple<AgradCdfLognormal, type_v_169> AgradCdfLognormal_v_169;
+typedef std::tuple<AgradCdfLognormal, type_v_170> AgradCdfLognormal_v_170;
+typedef std::tuple<AgradCdfLognormal, type_v_171> AgradCdfLognormal_v_171;
+typedef std::tuple<AgradCdfLognormal, type_v_172> AgradCdfLognormal_v_172;
+typedef std::tuple<AgradCdfLognormal, type_v_173> AgradCdfLognormal_v_173;
+typedef std::tuple<AgradCdfLognormal, type_v_174> AgradCdfLognormal_v_174;
+typedef std::tuple<AgradCdfLognormal, type_v_175> AgradCdfLognormal_v_175;
+typedef std::tuple<AgradCdfLognormal, type_v_176> AgradCdfLognormal_v_176;
+typedef std::tuple<AgradCdfLognormal, type_v_177> AgradCdfLognormal_v_177;
+typedef std::tuple<AgradCdfLognormal, type_v_178> AgradCdfLognormal_v_178;
+typedef std::tuple<AgradCdfLognormal, type_v_179> AgradCdfLognormal_v_179;
+typedef std::tuple<AgradCdfLognormal, type_v_180> AgradCdfLognormal_v_180;
+typedef std::tuple<AgradCdfLognormal, type_v_181> AgradCdfLognormal_v_181;
+typedef std::tuple<AgradCdfLognormal, type_v_182> AgradCdfLognormal_v_182;
+typedef std::tuple<AgradCdfLognormal, type_v_183> AgradCdfLognormal_v_183;
+typedef std::tuple<AgradCdfLognormal, type_v_184> AgradCdfLognormal_v_184;
+typedef std::tuple<AgradCdfLognormal, type_v_185> AgradCdfLognormal_v_185;
+typedef std::tuple<AgradCdfLognormal, type_v_186> AgradCdfLognormal_v_186;
+typedef std::tuple<AgradCdfLognormal, type_v_187> AgradCdfLognormal_v_187;
+typedef std::tuple<AgradCdfLognormal, type_v_188> AgradCdfLognormal_v_188;
+typedef std::tuple<AgradCdfLognormal, type_v_189> AgradCdfLognormal_v_189;
+typedef std::tuple<AgradCdfLognormal, type_v_190> AgradCdfLognormal_v_190;
+typedef std::tuple<AgradCdfLognormal, type_v_191> AgradCdfLognormal_v_191;
+typedef std::tuple<AgradCdfLognormal, type_v_192> AgradCdfLognormal_v_192;
+typedef std::tuple<AgradCdfLognormal, type_v_193> AgradCdfLognormal_v_193;
+typedef std::tuple<AgradCdfLognormal, type_v_194> AgradCdfLognormal_v_194;
+typedef std::tuple<AgradCdfLognormal, type_v_195> AgradCdfLognormal_v_195;
+typedef std::tuple<AgradCdfLognormal, type_v_196> AgradCdfLognormal_v_196;
+typedef std::tuple<AgradCdfLognormal, type_v_197> AgradCdfLognormal_v_197;
+typedef std::tuple<AgradCdfLognormal, type_v_198> AgradCdfLognormal_v_198;
+typedef std::tuple<AgradCdfLognormal, type_v_199> AgradCdfLognormal_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_100, AgradCdfTestFixture, AgradCdfLognormal_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_101, AgradCdfTestFixture, AgradCdfLognormal_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_102, AgradCdfTestFixture, AgradCdfLognormal_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_103, AgradCdfTestFixture, AgradCdfLognormal_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_104, AgradCdfTestFixture, AgradCdfLognormal_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_105, AgradCdfTestFixture, AgradCdfLognormal_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_106, AgradCdfTestFixture, AgradCdfLognormal_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_107, AgradCdfTestFixture, AgradCdfLognormal_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_108, AgradCdfTestFixture, AgradCdfLognormal_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_109, AgradCdfTestFixture, AgradCdfLognormal_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_110, AgradCdfTestFixture, AgradCdfLognormal_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_111, AgradCdfTestFixture, AgradCdfLognormal_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_112, AgradCdfTestFixture, AgradCdfLognormal_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_113, AgradCdfTestFixture, AgradCdfLognormal_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_114, AgradCdfTestFixture, AgradCdfLognormal_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_115, AgradCdfTestFixture, AgradCdfLognormal_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_116, AgradCdfTestFixture, AgradCdfLognormal_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_117, AgradCdfTestFixture, AgradCdfLognormal_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_118, AgradCdfTestFixture, AgradCdfLognormal_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_119, AgradCdfTestFixture, AgradCdfLognormal_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_120, AgradCdfTestFixture, AgradCdfLognormal_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_121, AgradCdfTestFixture, AgradCdfLognormal_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_122, AgradCdfTestFixture, AgradCdfLognormal_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_123, AgradCdfTestFixture, AgradCdfLognormal_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_124, AgradCdfTestFixture, AgradCdfLognormal_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_125, AgradCdfTestFixture, AgradCdfLognormal_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_126, AgradCdfTestFixture, AgradCdfLognormal_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_127, AgradCdfTestFixture, AgradCdfLognormal_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_128, AgradCdfTestFixture, AgradCdfLognormal_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_129, AgradCdfTestFixture, AgradCdfLognormal_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_130, AgradCdfTestFixture, AgradCdfLognormal_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_131, AgradCdfTestFixture, AgradCdfLognormal_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_132, AgradCdfTestFixture, AgradCdfLognormal_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_133, AgradCdfTestFixture, AgradCdfLognormal_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_134, AgradCdfTestFixture, AgradCdfLognormal_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_135, AgradCdfTestFixture, AgradCdfLognormal_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_136, AgradCdfTestFixture, AgradCdfLognormal_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_137, AgradCdfTestFixture, AgradCdfLognormal_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_138, AgradCdfTestFixture, AgradCdfLognormal_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_139, AgradCdfTestFixture, AgradCdfLognormal_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_140, AgradCdfTestFixture, AgradCdfLognormal_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_141, AgradCdfTestFixture, AgradCdfLognormal_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_142, AgradCdfTestFixture, AgradCdfLognormal_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_143, AgradCdfTestFixture, AgradCdfLognormal_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_144, AgradCdfTestFixture, AgradCdfLognormal_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_145, AgradCdfTestFixture, AgradCdfLognormal_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_146, AgradCdfTestFixture, AgradCdfLognormal_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_147, AgradCdfTestFixture, AgradCdfLognormal_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_148, AgradCdfTestFixture, AgradCdfLognormal_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_149, AgradCdfTestFixture, AgradCdfLognormal_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_150, AgradCdfTestFixture, AgradCdfLognormal_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_151, AgradCdfTestFixture, AgradCdfLognormal_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_152, AgradCdfTestFixture, AgradCdfLognormal_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_153, AgradCdfTestFixture, AgradCdfLognormal_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_154, AgradCdfTestFixture, AgradCdfLognormal_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_155, AgradCdfTestFixture, AgradCdfLognormal_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_156, AgradCdfTestFixture, AgradCdfLognormal_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_157, AgradCdfTestFixture, AgradCdfLognormal_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_158, AgradCdfTestFixture, AgradCdfLognormal_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_159, AgradCdfTestFixture, AgradCdfLognormal_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_160, AgradCdfTestFixture, AgradCdfLognormal_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_161, AgradCdfTestFixture, AgradCdfLognormal_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_162, AgradCdfTestFixture, AgradCdfLognormal_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_163, AgradCdfTestFixture, AgradCdfLognormal_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_164, AgradCdfTestFixture, AgradCdfLognormal_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_165, AgradCdfTestFixture, AgradCdfLognormal_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_166, AgradCdfTestFixture, AgradCdfLognormal_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_167, AgradCdfTestFixture, AgradCdfLognormal_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_168, AgradCdfTestFixture, AgradCdfLognormal_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_169, AgradCdfTestFixture, AgradCdfLognormal_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_170, AgradCdfTestFixture, AgradCdfLognormal_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_171, AgradCdfTestFixture, AgradCdfLognormal_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_172, AgradCdfTestFixture, AgradCdfLognormal_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_173, AgradCdfTestFixture, AgradCdfLognormal_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_174, AgradCdfTestFixture, AgradCdfLognormal_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_175, AgradCdfTestFixture, AgradCdfLognormal_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_176, AgradCdfTestFixture, AgradCdfLognormal_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_177, AgradCdfTestFixture, AgradCdfLognormal_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_178, AgradCdfTestFixture, AgradCdfLognormal_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_179, AgradCdfTestFixture, AgradCdfLognormal_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_180, AgradCdfTestFixture, AgradCdfLognormal_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_181, AgradCdfTestFixture, AgradCdfLognormal_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_182, AgradCdfTestFixture, AgradCdfLognormal_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_183, AgradCdfTestFixture, AgradCdfLognormal_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_184, AgradCdfTestFixture, AgradCdfLognormal_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_185, AgradCdfTestFixture, AgradCdfLognormal_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_186, AgradCdfTestFixture, AgradCdfLognormal_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_187, AgradCdfTestFixture, AgradCdfLognormal_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_188, AgradCdfTestFixture, AgradCdfLognormal_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_189, AgradCdfTestFixture, AgradCdfLognormal_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_190, AgradCdfTestFixture, AgradCdfLognormal_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_191, AgradCdfTestFixture, AgradCdfLognormal_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_192, AgradCdfTestFixture, AgradCdfLognormal_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_193, AgradCdfTestFixture, AgradCdfLognormal_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_194, AgradCdfTestFixture, AgradCdfLognormal_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_195, AgradCdfTestFixture, AgradCdfLognormal_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_196, AgradCdfTestFixture, AgradCdfLognormal_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_197, AgradCdfTestFixture, AgradCdfLognormal_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_198, AgradCdfTestFixture, AgradCdfLognormal_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_199, AgradCdfTestFixture, AgradCdfLognormal_v_199);
+
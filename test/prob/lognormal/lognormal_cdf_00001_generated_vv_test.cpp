@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLognormal, type_vv_100> AgradCdfLognormal_vv_100;
+typedef std::tuple<AgradCdfLognormal, type_vv_101> AgradCdfLognormal_vv_101;
+typedef std::tuple<AgradCdfLognormal, type_vv_102> AgradCdfLognormal_vv_102;
+typedef std::tuple<AgradCdfLognormal, type_vv_103> AgradCdfLognormal_vv_103;
+typedef std::tuple<AgradCdfLognormal, type_vv_104> AgradCdfLognormal_vv_104;
+typedef std::tuple<AgradCdfLognormal, type_vv_105> AgradCdfLognormal_vv_105;
+typedef std::tuple<AgradCdfLognormal, type_vv_106> AgradCdfLognormal_vv_106;
+typedef std::tuple<AgradCdfLognormal, type_vv_107> AgradCdfLognormal_vv_107;
+typedef std::tuple<AgradCdfLognormal, type_vv_108> AgradCdfLognormal_vv_108;
+typedef std::tuple<AgradCdfLognormal, type_vv_109> AgradCdfLognormal_vv_109;
+typedef std::tuple<AgradCdfLognormal, type_vv_110> AgradCdfLognormal_vv_110;
+typedef std::tuple<AgradCdfLognormal, type_vv_111> AgradCdfLognormal_vv_111;
+typedef std::tuple<AgradCdfLognormal, type_vv_112> AgradCdfLognormal_vv_112;
+typedef std::tuple<AgradCdfLognormal, type_vv_113> AgradCdfLognormal_vv_113;
+typedef std::tuple<AgradCdfLognormal, type_vv_114> AgradCdfLognormal_vv_114;
+typedef std::tuple<AgradCdfLognormal, type_vv_115> AgradCdfLognormal_vv_115;
+typedef std::tuple<AgradCdfLognormal, type_vv_116> AgradCdfLognormal_vv_116;
+typedef std::tuple<AgradCdfLognormal, type_vv_117> AgradCdfLognormal_vv_117;
+typedef std::tuple<AgradCdfLognormal, type_vv_118> AgradCdfLognormal_vv_118;
+typedef std::tuple<AgradCdfLognormal, type_vv_119> AgradCdfLognormal_vv_119;
+typedef std::tuple<AgradCdfLognormal, type_vv_120> AgradCdfLognormal_vv_120;
+typedef std::tuple<AgradCdfLognormal, type_vv_121> AgradCdfLognormal_vv_121;
+typedef std::tuple<AgradCdfLognormal, type_vv_122> AgradCdfLognormal_vv_122;
+typedef std::tuple<AgradCdfLognormal, type_vv_123> AgradCdfLognormal_vv_123;
+typedef std::tuple<AgradCdfLognormal, type_vv_124> AgradCdfLognormal_vv_124;
+typedef std::tuple<AgradCdfLognormal, type_vv_125> AgradCdfLognormal_vv_125;
+typedef std::tuple<AgradCdfLognormal, type_vv_126> AgradCdfLognormal_vv_126;
+typedef std::tuple<AgradCdfLognormal, type_vv_127> AgradCdfLognormal_vv_127;
+typedef std::tuple<AgradCdfLognormal, type_vv_128> AgradCdfLognormal_vv_128;
+typedef std::tuple<AgradCdfLognormal, type_vv_129> AgradCdfLognormal_vv_129;
+typedef std::tuple<AgradCdfLognormal, type_vv_130> AgradCdfLognormal_vv_130;
+typedef std::tuple<AgradCdfLognormal, type_vv_131> AgradCdfLognormal_vv_131;
+typedef std::tuple<AgradCdfLognormal, type_vv_132> AgradCdfLognormal_vv_132;
+typedef std::tuple<AgradCdfLognormal, type_vv_133> AgradCdfLognormal_vv_133;
+typedef std::tuple<AgradCdfLognormal, type_vv_134> AgradCdfLognormal_vv_134;
+typedef std::tuple<AgradCdfLognormal, type_vv_135> AgradCdfLognormal_vv_135;
+typedef std::tuple<AgradCdfLognormal, type_vv_136> AgradCdfLognormal_vv_136;
+typedef std::tuple<AgradCdfLognormal, type_vv_137> AgradCdfLognormal_vv_137;
+typedef std::tuple<AgradCdfLognormal, type_vv_138> AgradCdfLognormal_vv_138;
+typedef std::tuple<AgradCdfLognormal, type_vv_139> AgradCdfLognormal_vv_139;
+typedef std::tuple<AgradCdfLognormal, type_vv_140> AgradCdfLognormal_vv_140;
+typedef std::tuple<AgradCdfLognormal, type_vv_141> AgradCdfLognormal_vv_141;
+typedef std::tuple<AgradCdfLognormal, type_vv_142> AgradCdfLognormal_vv_142;
+typedef std::tuple<AgradCdfLognormal, type_vv_143> AgradCdfLognormal_vv_143;
+typedef std::tuple<AgradCdfLognormal, type_vv_144> AgradCdfLognormal_vv_144;
+typedef std::tuple<AgradCdfLognormal, type_vv_145> AgradCdfLognormal_vv_145;
+typedef std::tuple<AgradCdfLognormal, type_vv_146> AgradCdfLognormal_vv_146;
+typedef std::tuple<AgradCdfLognormal, type_vv_147> AgradCdfLognormal_vv_147;
+typedef std::tuple<AgradCdfLognormal, type_vv_148> AgradCdfLognormal_vv_148;
+typedef std::tuple<AgradCdfLognormal, type_vv_149> AgradCdfLognormal_vv_149;
+typedef std::tuple<AgradCdfLognormal, type_vv_150> AgradCdfLognormal_vv_150;
+typedef std::tuple<AgradCdfLognormal, type_vv_151> AgradCdfLognormal_vv_151;
+typedef std::tuple<AgradCdfLognormal, type_vv_152> AgradCdfLognormal_vv_152;
+typedef std::tuple<AgradCdfLognormal, type_vv_153> AgradCdfLognormal_vv_153;
+typedef std::tuple<AgradCdfLognormal, type_vv_154> AgradCdfLognormal_vv_154;
+typedef std::tuple<AgradCdfLognormal, type_vv_155> AgradCdfLognormal_vv_155;
+typedef std::tuple<AgradCdfLognormal, type_vv_156> AgradCdfLognormal_vv_156;
+typedef std::tuple<AgradCdfLognormal, type_vv_157> AgradCdfLognormal_vv_157;
+typedef std::tuple<AgradCdfLognormal, type_vv_158> AgradCdfLognormal_vv_158;
+typedef std::tuple<AgradCdfLognormal, type_vv_159> AgradCdfLognormal_vv_159;
+typedef std::tuple<AgradCdfLognormal, type_vv_160> AgradCdfLognormal_vv_160;
+typedef std::tuple<AgradCdfLognormal, type_vv_161> AgradCdfLognormal_vv_161;
+typedef std::tuple<AgradCdfLognormal, type_vv_162> AgradCdfLognormal_vv_162;
+typedef std::tuple<AgradCdfLognormal, type_vv_163> AgradCdfLognormal_vv_163;
+typedef std::tuple<AgradCdfLognormal, type_vv_164> AgradCdfLognormal_vv_164;
+typedef std::tuple<AgradCdfLognormal, type_vv_165> AgradCdfLognormal_vv_165;
+typedef std::tuple<AgradCdfLognormal, type_vv_166> AgradCdfLognormal_vv_166;
+typedef std::tuple<AgradCdfLognormal, type_vv_167> AgradCdfLognormal_vv_167;
+typedef std::tuple<AgradCdfLognormal, type_vv_168> AgradCdfLognormal_vv_168;
+typedef std::tuple<AgradCdfLognormal, type_vv_169> AgradCdfLognormal_vv_169;
+typedef std::tuple<AgradCdfLognormal, type_vv_170> AgradCdfLognormal_vv_170;
+typedef std::tuple<AgradCdfLognormal, type_vv_171> AgradCdfLognormal_vv_171;
+typedef std::tuple<AgradCdfLognormal, type_vv_172> AgradCdfLognormal_vv_172;
+typedef std::tuple<AgradCdfLognormal, type_vv_173> AgradCdfLognormal_vv_173;
+typedef std::tuple<AgradCdfLognormal, type_vv_174> AgradCdfLognormal_vv_174;
+typedef std::tuple<AgradCdfLognormal, type_vv_175> AgradCdfLognormal_vv_175;
+typedef std::tuple<AgradCdfLognormal, type_vv_176> AgradCdfLognormal_vv_176;
+typedef std::tuple<AgradCdfLognormal, type_vv_177> AgradCdfLognormal_vv_177;
+typedef std::tuple<AgradCdfLognormal, type_vv_178> AgradCdfLognormal_vv_178;
+typedef std::tuple<AgradCdfLognormal, type_vv_179> AgradCdfLognormal_vv_179;
+typedef std::tuple<AgradCdfLognormal, type_vv_180> AgradCdfLognormal_vv_180;
+typedef std::tuple<AgradCdfLognormal, type_vv_181> AgradCdfLognormal_vv_181;
+typedef std::tuple<AgradCdfLognormal, type_vv_182> AgradCdfLognormal_vv_182;
+typedef std::tuple<AgradCdfLognormal, type_vv_183> AgradCdfLognormal_vv_183;
+typedef std::tuple<AgradCdfLognormal, type_vv_184> AgradCdfLognormal_vv_184;
+typedef std::tuple<AgradCdfLognormal, type_vv_185> AgradCdfLognormal_vv_185;
+typedef std::tuple<AgradCdfLognormal, type_vv_186> AgradCdfLognormal_vv_186;
+typedef std::tuple<AgradCdfLognormal, type_vv_187> AgradCdfLognormal_vv_187;
+typedef std::tuple<AgradCdfLognormal, type_vv_188> AgradCdfLognormal_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_100, AgradCdfTestFixture, AgradCdfLognormal_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_101, AgradCdfTestFixture, AgradCdfLognormal_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_102, AgradCdfTestFixture, AgradCdfLognormal_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_103, AgradCdfTestFixture, AgradCdfLognormal_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_104, AgradCdfTestFixture, AgradCdfLognormal_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_105, AgradCdfTestFixture, AgradCdfLognormal_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_106, AgradCdfTestFixture, AgradCdfLognormal_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_107, AgradCdfTestFixture, AgradCdfLognormal_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_108, AgradCdfTestFixture, AgradCdfLognormal_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_109, AgradCdfTestFixture, AgradCdfLognormal_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_110, AgradCdfTestFixture, AgradCdfLognormal_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_111, AgradCdfTestFixture, AgradCdfLognormal_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_112, AgradCdfTestFixture, AgradCdfLognormal_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_113, AgradCdfTestFixture, AgradCdfLognormal_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_114, AgradCdfTestFixture, AgradCdfLognormal_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_115, AgradCdfTestFixture, AgradCdfLognormal_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_116, AgradCdfTestFixture, AgradCdfLognormal_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_117, AgradCdfTestFixture, AgradCdfLognormal_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_118, AgradCdfTestFixture, AgradCdfLognormal_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_119, AgradCdfTestFixture, AgradCdfLognormal_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_120, AgradCdfTestFixture, AgradCdfLognormal_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_121, AgradCdfTestFixture, AgradCdfLognormal_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_122, AgradCdfTestFixture, AgradCdfLognormal_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_123, AgradCdfTestFixture, AgradCdfLognormal_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_124, AgradCdfTestFixture, AgradCdfLognormal_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_125, AgradCdfTestFixture, AgradCdfLognormal_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_126, AgradCdfTestFixture, AgradCdfLognormal_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_127, AgradCdfTestFixture, AgradCdfLognormal_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_128, AgradCdfTestFixture, AgradCdfLognormal_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_129, AgradCdfTestFixture, AgradCdfLognormal_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_130, AgradCdfTestFixture, AgradCdfLognormal_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_131, AgradCdfTestFixture, AgradCdfLognormal_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_132, AgradCdfTestFixture, AgradCdfLognormal_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_133, AgradCdfTestFixture, AgradCdfLognormal_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_134, AgradCdfTestFixture, AgradCdfLognormal_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_135, AgradCdfTestFixture, AgradCdfLognormal_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_136, AgradCdfTestFixture, AgradCdfLognormal_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_137, AgradCdfTestFixture, AgradCdfLognormal_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_138, AgradCdfTestFixture, AgradCdfLognormal_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_139, AgradCdfTestFixture, AgradCdfLognormal_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_140, AgradCdfTestFixture, AgradCdfLognormal_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_141, AgradCdfTestFixture, AgradCdfLognormal_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_142, AgradCdfTestFixture, AgradCdfLognormal_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_143, AgradCdfTestFixture, AgradCdfLognormal_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_144, AgradCdfTestFixture, AgradCdfLognormal_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_145, AgradCdfTestFixture, AgradCdfLognormal_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_146, AgradCdfTestFixture, AgradCdfLognormal_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_147, AgradCdfTestFixture, AgradCdfLognormal_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_148, AgradCdfTestFixture, AgradCdfLognormal_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_149, AgradCdfTestFixture, AgradCdfLognormal_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_150, AgradCdfTestFixture, AgradCdfLognormal_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_151, AgradCdfTestFixture, AgradCdfLognormal_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_152, AgradCdfTestFixture, AgradCdfLognormal_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_153, AgradCdfTestFixture, AgradCdfLognormal_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_154, AgradCdfTestFixture, AgradCdfLognormal_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_155, AgradCdfTestFixture, AgradCdfLognormal_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_156, AgradCdfTestFixture, AgradCdfLognormal_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_157, AgradCdfTestFixture, AgradCdfLognormal_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_158, AgradCdfTestFixture, AgradCdfLognormal_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_159, AgradCdfTestFixture, AgradCdfLognormal_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_160, AgradCdfTestFixture, AgradCdfLognormal_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_161, AgradCdfTestFixture, AgradCdfLognormal_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_162, AgradCdfTestFixture, AgradCdfLognormal_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_163, AgradCdfTestFixture, AgradCdfLognormal_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_164, AgradCdfTestFixture, AgradCdfLognormal_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_165, AgradCdfTestFixture, AgradCdfLognormal_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_166, AgradCdfTestFixture, AgradCdfLognormal_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_167, AgradCdfTestFixture, AgradCdfLognormal_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_168, AgradCdfTestFixture, AgradCdfLognormal_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_169, AgradCdfTestFixture, AgradCdfLognormal_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_170, AgradCdfTestFixture, AgradCdfLognormal_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_171, AgradCdfTestFixture, AgradCdfLognormal_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_172, AgradCdfTestFixture, AgradCdfLognormal_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_173, AgradCdfTestFixture, AgradCdfLognormal_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_174, AgradCdfTestFixture, AgradCdfLognormal_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_175, AgradCdfTestFixture, AgradCdfLognormal_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_176, AgradCdfTestFixture, AgradCdfLognormal_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_177, AgradCdfTestFixture, AgradCdfLognormal_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_178, AgradCdfTestFixture, AgradCdfLognormal_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_179, AgradCdfTestFixture, AgradCdfLognormal_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_180, AgradCdfTestFixture, AgradCdfLognormal_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_181, AgradCdfTestFixture, AgradCdfLognormal_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_182, AgradCdfTestFixture, AgradCdfLognormal_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_183, AgradCdfTestFixture, AgradCdfLognormal_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_184, AgradCdfTestFixture, AgradCdfLognormal_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_185, AgradCdfTestFixture, AgradCdfLognormal_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_186, AgradCdfTestFixture, AgradCdfLognormal_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_187, AgradCdfTestFixture, AgradCdfLognormal_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_vv_188, AgradCdfTestFixture, AgradCdfLognormal_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCdfLognormal, type_v_200> AgradCdfLognormal_v_200;
+typedef std::tuple<AgradCdfLognormal, type_v_201> AgradCdfLognormal_v_201;
+typedef std::tuple<AgradCdfLognormal, type_v_202> AgradCdfLognormal_v_202;
+typedef std::tuple<AgradCdfLognormal, type_v_203> AgradCdfLognormal_v_203;
+typedef std::tuple<AgradCdfLognormal, type_v_204> AgradCdfLognormal_v_204;
+typedef std::tuple<AgradCdfLognormal, type_v_205> AgradCdfLognormal_v_205;
+typedef std::tuple<AgradCdfLognormal, type_v_206> AgradCdfLognormal_v_206;
+typedef std::tuple<AgradCdfLognormal, type_v_207> AgradCdfLognormal_v_207;
+typedef std::tuple<AgradCdfLognormal, type_v_208> AgradCdfLognormal_v_208;
+typedef std::tuple<AgradCdfLognormal, type_v_209> AgradCdfLognormal_v_209;
+typedef std::tuple<AgradCdfLognormal, type_v_210> AgradCdfLognormal_v_210;
+typedef std::tuple<AgradCdfLognormal, type_v_211> AgradCdfLognormal_v_211;
+typedef std::tuple<AgradCdfLognormal, type_v_212> AgradCdfLognormal_v_212;
+typedef std::tuple<AgradCdfLognormal, type_v_213> AgradCdfLognormal_v_213;
+typedef std::tuple<AgradCdfLognormal, type_v_214> AgradCdfLognormal_v_214;
+typedef std::tuple<AgradCdfLognormal, type_v_215> AgradCdfLognormal_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_200, AgradCdfTestFixture, AgradCdfLognormal_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_201, AgradCdfTestFixture, AgradCdfLognormal_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_202, AgradCdfTestFixture, AgradCdfLognormal_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_203, AgradCdfTestFixture, AgradCdfLognormal_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_204, AgradCdfTestFixture, AgradCdfLognormal_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_205, AgradCdfTestFixture, AgradCdfLognormal_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_206, AgradCdfTestFixture, AgradCdfLognormal_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_207, AgradCdfTestFixture, AgradCdfLognormal_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_208, AgradCdfTestFixture, AgradCdfLognormal_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_209, AgradCdfTestFixture, AgradCdfLognormal_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_210, AgradCdfTestFixture, AgradCdfLognormal_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_211, AgradCdfTestFixture, AgradCdfLognormal_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_212, AgradCdfTestFixture, AgradCdfLognormal_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_213, AgradCdfTestFixture, AgradCdfLognormal_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_214, AgradCdfTestFixture, AgradCdfLognormal_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLognormal_v_215, AgradCdfTestFixture, AgradCdfLognormal_v_215);
+
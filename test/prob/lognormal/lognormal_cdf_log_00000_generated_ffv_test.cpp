@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_0> AgradCdfLogLognormal_ffv_0;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_1> AgradCdfLogLognormal_ffv_1;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_2> AgradCdfLogLognormal_ffv_2;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_3> AgradCdfLogLognormal_ffv_3;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_4> AgradCdfLogLognormal_ffv_4;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_5> AgradCdfLogLognormal_ffv_5;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_6> AgradCdfLogLognormal_ffv_6;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_7> AgradCdfLogLognormal_ffv_7;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_8> AgradCdfLogLognormal_ffv_8;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_9> AgradCdfLogLognormal_ffv_9;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_10> AgradCdfLogLognormal_ffv_10;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_11> AgradCdfLogLognormal_ffv_11;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_12> AgradCdfLogLognormal_ffv_12;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_13> AgradCdfLogLognormal_ffv_13;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_14> AgradCdfLogLognormal_ffv_14;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_15> AgradCdfLogLognormal_ffv_15;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_16> AgradCdfLogLognormal_ffv_16;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_17> AgradCdfLogLognormal_ffv_17;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_18> AgradCdfLogLognormal_ffv_18;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_19> AgradCdfLogLognormal_ffv_19;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_20> AgradCdfLogLognormal_ffv_20;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_21> AgradCdfLogLognormal_ffv_21;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_22> AgradCdfLogLognormal_ffv_22;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_23> AgradCdfLogLognormal_ffv_23;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_24> AgradCdfLogLognormal_ffv_24;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_25> AgradCdfLogLognormal_ffv_25;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_26> AgradCdfLogLognormal_ffv_26;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_27> AgradCdfLogLognormal_ffv_27;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_28> AgradCdfLogLognormal_ffv_28;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_29> AgradCdfLogLognormal_ffv_29;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_30> AgradCdfLogLognormal_ffv_30;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_31> AgradCdfLogLognormal_ffv_31;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_32> AgradCdfLogLognormal_ffv_32;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_33> AgradCdfLogLognormal_ffv_33;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_34> AgradCdfLogLognormal_ffv_34;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_35> AgradCdfLogLognormal_ffv_35;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_36> AgradCdfLogLognormal_ffv_36;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_37> AgradCdfLogLognormal_ffv_37;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_38> AgradCdfLogLognormal_ffv_38;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_39> AgradCdfLogLognormal_ffv_39;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_40> AgradCdfLogLognormal_ffv_40;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_41> AgradCdfLogLognormal_ffv_41;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_42> AgradCdfLogLognormal_ffv_42;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_43> AgradCdfLogLognormal_ffv_43;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_44> AgradCdfLogLognormal_ffv_44;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_45> AgradCdfLogLognormal_ffv_45;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_46> AgradCdfLogLognormal_ffv_46;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_47> AgradCdfLogLognormal_ffv_47;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_48> AgradCdfLogLognormal_ffv_48;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_49> AgradCdfLogLognormal_ffv_49;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_50> AgradCdfLogLognormal_ffv_50;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_51> AgradCdfLogLognormal_ffv_51;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_52> AgradCdfLogLognormal_ffv_52;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_53> AgradCdfLogLognormal_ffv_53;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_54> AgradCdfLogLognormal_ffv_54;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_55> AgradCdfLogLognormal_ffv_55;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_56> AgradCdfLogLognormal_ffv_56;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_57> AgradCdfLogLognormal_ffv_57;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_58> AgradCdfLogLognormal_ffv_58;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_59> AgradCdfLogLognormal_ffv_59;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_60> AgradCdfLogLognormal_ffv_60;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_61> AgradCdfLogLognormal_ffv_61;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_62> AgradCdfLogLognormal_ffv_62;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_63> AgradCdfLogLognormal_ffv_63;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_64> AgradCdfLogLognormal_ffv_64;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_65> AgradCdfLogLognormal_ffv_65;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_66> AgradCdfLogLognormal_ffv_66;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_67> AgradCdfLogLognormal_ffv_67;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_68> AgradCdfLogLognormal_ffv_68;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_69> AgradCdfLogLognormal_ffv_69;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_70> AgradCdfLogLognormal_ffv_70;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_71> AgradCdfLogLognormal_ffv_71;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_72> AgradCdfLogLognormal_ffv_72;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_73> AgradCdfLogLognormal_ffv_73;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_74> AgradCdfLogLognormal_ffv_74;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_75> AgradCdfLogLognormal_ffv_75;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_76> AgradCdfLogLognormal_ffv_76;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_77> AgradCdfLogLognormal_ffv_77;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_78> AgradCdfLogLognormal_ffv_78;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_79> AgradCdfLogLognormal_ffv_79;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_80> AgradCdfLogLognormal_ffv_80;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_81> AgradCdfLogLognormal_ffv_81;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_82> AgradCdfLogLognormal_ffv_82;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_83> AgradCdfLogLognormal_ffv_83;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_84> AgradCdfLogLognormal_ffv_84;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_85> AgradCdfLogLognormal_ffv_85;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_86> AgradCdfLogLognormal_ffv_86;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_87> AgradCdfLogLognormal_ffv_87;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_88> AgradCdfLogLognormal_ffv_88;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_89> AgradCdfLogLognormal_ffv_89;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_90> AgradCdfLogLognormal_ffv_90;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_91> AgradCdfLogLognormal_ffv_91;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_92> AgradCdfLogLognormal_ffv_92;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_93> AgradCdfLogLognormal_ffv_93;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_94> AgradCdfLogLognormal_ffv_94;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_95> AgradCdfLogLognormal_ffv_95;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_96> AgradCdfLogLognormal_ffv_96;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_97> AgradCdfLogLognormal_ffv_97;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_98> AgradCdfLogLognormal_ffv_98;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_99> AgradCdfLogLognormal_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_0, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_1, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_2, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_3, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_4, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_5, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_6, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_7, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_8, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_9, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_10, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_11, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_12, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_13, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_14, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_15, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_16, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_17, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_18, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_19, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_20, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_21, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_22, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_23, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_24, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_25, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_26, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_27, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_28, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_29, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_30, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_31, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_32, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_33, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_34, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_35, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_36, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_37, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_38, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_39, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_40, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_41, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_42, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_43, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_44, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_45, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_46, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_47, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_48, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_49, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_50, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_51, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_52, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_53, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_54, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_55, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_56, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_57, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_58, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_59, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_60, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_61, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_62, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_63, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_64, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_65, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_66, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_67, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_68, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_69, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_70, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_71, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_72, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_73, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_74, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_75, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_76, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_77, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_78, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_79, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_80, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_81, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_82, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_83, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_84, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_85, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_86, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_87, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_88, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_89, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_90, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_91, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_92, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_93, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_94, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_95, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_96, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_97, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_98, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_99, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogLognormal, type_v_0> AgradCdfLogLognormal_v_0;
+typedef std::tuple<AgradCdfLogLognormal, type_v_1> AgradCdfLogLognormal_v_1;
+typedef std::tuple<AgradCdfLogLognormal, type_v_2> AgradCdfLogLognormal_v_2;
+typedef std::tuple<AgradCdfLogLognormal, type_v_3> AgradCdfLogLognormal_v_3;
+typedef std::tuple<AgradCdfLogLognormal, type_v_4> AgradCdfLogLognormal_v_4;
+typedef std::tuple<AgradCdfLogLognormal, type_v_5> AgradCdfLogLognormal_v_5;
+typedef std::tuple<AgradCdfLogLognormal, type_v_6> AgradCdfLogLognormal_v_6;
+typedef std::tuple<AgradCdfLogLognormal, type_v_7> AgradCdfLogLognormal_v_7;
+typedef std::tuple<AgradCdfLogLognormal, type_v_8> AgradCdfLogLognormal_v_8;
+typedef std::tuple<AgradCdfLogLognormal, type_v_9> AgradCdfLogLognormal_v_9;
+typedef std::tuple<AgradCdfLogLognormal, type_v_10> AgradCdfLogLognormal_v_10;
+typedef std::tuple<AgradCdfLogLognormal, type_v_11> AgradCdfLogLognormal_v_11;
+typedef std::tuple<AgradCdfLogLognormal, type_v_12> AgradCdfLogLognormal_v_12;
+typedef std::tuple<AgradCdfLogLognormal, type_v_13> AgradCdfLogLognormal_v_13;
+typedef std::tuple<AgradCdfLogLognormal, type_v_14> AgradCdfLogLognormal_v_14;
+typedef std::tuple<AgradCdfLogLognormal, type_v_15> AgradCdfLogLognormal_v_15;
+typedef std::tuple<AgradCdfLogLognormal, type_v_16> AgradCdfLogLognormal_v_16;
+typedef std::tuple<AgradCdfLogLognormal, type_v_17> AgradCdfLogLognormal_v_17;
+typedef std::tuple<AgradCdfLogLognormal, type_v_18> AgradCdfLogLognormal_v_18;
+typedef std::tuple<AgradCdfLogLognormal, type_v_19> AgradCdfLogLognormal_v_19;
+typedef std::tuple<AgradCdfLogLognormal, type_v_20> AgradCdfLogLognormal_v_20;
+typedef std::tuple<AgradCdfLogLognormal, type_v_21> AgradCdfLogLognormal_v_21;
+typedef std::tuple<AgradCdfLogLognormal, type_v_22> AgradCdfLogLognormal_v_22;
+typedef std::tuple<AgradCdfLogLognormal, type_v_23> AgradCdfLogLognormal_v_23;
+typedef std::tuple<AgradCdfLogLognormal, type_v_24> AgradCdfLogLognormal_v_24;
+typedef std::tuple<AgradCdfLogLognormal, type_v_25> AgradCdfLogLognormal_v_25;
+typedef std::tuple<AgradCdfLogLognormal, type_v_26> AgradCdfLogLognormal_v_26;
+typedef std::tuple<AgradCdfLogLognormal, type_v_27> AgradCdfLogLognormal_v_27;
+typedef std::tuple<AgradCdfLogLognormal, type_v_28> AgradCdfLogLognormal_v_28;
+typedef std::tuple<AgradCdfLogLognormal, type_v_29> AgradCdfLogLognormal_v_29;
+typedef std::tuple<AgradCdfLogLognormal, type_v_30> AgradCdfLogLognormal_v_30;
+typedef std::tuple<AgradCdfLogLognormal, type_v_31> AgradCdfLogLognormal_v_31;
+typedef std::tuple<AgradCdfLogLognormal, type_v_32> AgradCdfLogLognormal_v_32;
+typedef std::tuple<AgradCdfLogLognormal, type_v_33> AgradCdfLogLognormal_v_33;
+typedef std::tuple<AgradCdfLogLognormal, type_v_34> AgradCdfLogLognormal_v_34;
+typedef std::tuple<AgradCdfLogLognormal, type_v_35> AgradCdfLogLognormal_v_35;
+typedef std::tuple<AgradCdfLogLognormal, type_v_36> AgradCdfLogLognormal_v_36;
+typedef std::tuple<AgradCdfLogLognormal, type_v_37> AgradCdfLogLognormal_v_37;
+typedef std::tuple<AgradCdfLogLognormal, type_v_38> AgradCdfLogLognormal_v_38;
+typedef std::tuple<AgradCdfLogLognormal, type_v_39> AgradCdfLogLognormal_v_39;
+typedef std::tuple<AgradCdfLogLognormal, type_v_40> AgradCdfLogLognormal_v_40;
+typedef std::tuple<AgradCdfLogLognormal, type_v_41> AgradCdfLogLognormal_v_41;
+typedef std::tuple<AgradCdfLogLognormal, type_v_42> AgradCdfLogLognormal_v_42;
+typedef std::tuple<AgradCdfLogLognormal, type_v_43> AgradCdfLogLognormal_v_43;
+typedef std::tuple<AgradCdfLogLognormal, type_v_44> AgradCdfLogLognormal_v_44;
+typedef std::tuple<AgradCdfLogLognormal, type_v_45> AgradCdfLogLognormal_v_45;
+typedef std::tuple<AgradCdfLogLognormal, type_v_46> AgradCdfLogLognormal_v_46;
+typedef std::tuple<AgradCdfLogLognormal, type_v_47> AgradCdfLogLognormal_v_47;
+typedef std::tuple<AgradCdfLogLognormal, type_v_48> AgradCdfLogLognormal_v_48;
+typedef std::tuple<AgradCdfLogLognormal, type_v_49> AgradCdfLogLognormal_v_49;
+typedef std::tuple<AgradCdfLogLognormal, type_v_50> AgradCdfLogLognormal_v_50;
+typedef std::tuple<AgradCdfLogLognormal, type_v_51> AgradCdfLogLognormal_v_51;
+typedef std::tuple<AgradCdfLogLognormal, type_v_52> AgradCdfLogLognormal_v_52;
+typedef std::tuple<AgradCdfLogLognormal, type_v_53> AgradCdfLogLognormal_v_53;
+typedef std::tuple<AgradCdfLogLognormal, type_v_54> AgradCdfLogLognormal_v_54;
+typedef std::tuple<AgradCdfLogLognormal, type_v_55> AgradCdfLogLognormal_v_55;
+typedef std::tuple<AgradCdfLogLognormal, type_v_56> AgradCdfLogLognormal_v_56;
+typedef std::tuple<AgradCdfLogLognormal, type_v_57> AgradCdfLogLognormal_v_57;
+typedef std::tuple<AgradCdfLogLognormal, type_v_58> AgradCdfLogLognormal_v_58;
+typedef std::tuple<AgradCdfLogLognormal, type_v_59> AgradCdfLogLognormal_v_59;
+typedef std::tuple<AgradCdfLogLognormal, type_v_60> AgradCdfLogLognormal_v_60;
+typedef std::tuple<AgradCdfLogLognormal, type_v_61> AgradCdfLogLognormal_v_61;
+typedef std::tuple<AgradCdfLogLognormal, type_v_62> AgradCdfLogLognormal_v_62;
+typedef std::tuple<AgradCdfLogLognormal, type_v_63> AgradCdfLogLognormal_v_63;
+typedef std::tuple<AgradCdfLogLognormal, type_v_64> AgradCdfLogLognormal_v_64;
+typedef std::tuple<AgradCdfLogLognormal, type_v_65> AgradCdfLogLognormal_v_65;
+typedef std::tuple<AgradCdfLogLognormal, type_v_66> AgradCdfLogLognormal_v_66;
+typedef std::tuple<AgradCdfLogLognormal, type_v_67> AgradCdfLogLognormal_v_67;
+typedef std::tuple<AgradCdfLogLognormal, type_v_68> AgradCdfLogLognormal_v_68;
+typedef std::tuple<AgradCdfLogLognormal, type_v_69> AgradCdfLogLognormal_v_69;
+typedef std::tuple<AgradCdfLogLognormal, type_v_70> AgradCdfLogLognormal_v_70;
+typedef std::tuple<AgradCdfLogLognormal, type_v_71> AgradCdfLogLognormal_v_71;
+typedef std::tuple<AgradCdfLogLognormal, type_v_72> AgradCdfLogLognormal_v_72;
+typedef std::tuple<AgradCdfLogLognormal, type_v_73> AgradCdfLogLognormal_v_73;
+typedef std::tuple<AgradCdfLogLognormal, type_v_74> AgradCdfLogLognormal_v_74;
+typedef std::tuple<AgradCdfLogLognormal, type_v_75> AgradCdfLogLognormal_v_75;
+typedef std::tuple<AgradCdfLogLognormal, type_v_76> AgradCdfLogLognormal_v_76;
+typedef std::tuple<AgradCdfLogLognormal, type_v_77> AgradCdfLogLognormal_v_77;
+typedef std::tuple<AgradCdfLogLognormal, type_v_78> AgradCdfLogLognormal_v_78;
+typedef std::tuple<AgradCdfLogLognormal, type_v_79> AgradCdfLogLognormal_v_79;
+typedef std::tuple<AgradCdfLogLognormal, type_v_80> AgradCdfLogLognormal_v_80;
+typedef std::tuple<AgradCdfLogLognormal, type_v_81> AgradCdfLogLognormal_v_81;
+typedef std::tuple<AgradCdfLogLognormal, type_v_82> AgradCdfLogLognormal_v_82;
+typedef std::tuple<AgradCdfLogLognormal, type_v_83> AgradCdfLogLognormal_v_83;
+typedef std::tuple<AgradCdfLogLognormal, type_v_84> AgradCdfLogLognormal_v_84;
+typedef std::tuple<AgradCdfLogLognormal, type_v_85> AgradCdfLogLognormal_v_85;
+typedef std::tuple<AgradCdfLogLognormal, type_v_86> AgradCdfLogLognormal_v_86;
+typedef std::tuple<AgradCdfLogLognormal, type_v_87> AgradCdfLogLognormal_v_87;
+typedef std::tuple<AgradCdfLogLognormal, type_v_88> AgradCdfLogLognormal_v_88;
+typedef std::tuple<AgradCdfLogLognormal, type_v_89> AgradCdfLogLognormal_v_89;
+typedef std::tuple<AgradCdfLogLognormal, type_v_90> AgradCdfLogLognormal_v_90;
+typedef std::tuple<AgradCdfLogLognormal, type_v_91> AgradCdfLogLognormal_v_91;
+typedef std::tuple<AgradCdfLogLognormal, type_v_92> AgradCdfLogLognormal_v_92;
+typedef std::tuple<AgradCdfLogLognormal, type_v_93> AgradCdfLogLognormal_v_93;
+typedef std::tuple<AgradCdfLogLognormal, type_v_94> AgradCdfLogLognormal_v_94;
+typedef std::tuple<AgradCdfLogLognormal, type_v_95> AgradCdfLogLognormal_v_95;
+typedef std::tuple<AgradCdfLogLognormal, type_v_96> AgradCdfLogLognormal_v_96;
+typedef std::tuple<AgradCdfLogLognormal, type_v_97> AgradCdfLogLognormal_v_97;
+typedef std::tuple<AgradCdfLogLognormal, type_v_98> AgradCdfLogLognormal_v_98;
+typedef std::tuple<AgradCdfLogLognormal, type_v_99> AgradCdfLogLognormal_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_0, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_1, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_2, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_3, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_4, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_5, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_6, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_7, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_8, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_9, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_10, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_11, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_12, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_13, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_14, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_15, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_16, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_17, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_18, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_19, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_20, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_21, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_22, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_23, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_24, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_25, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_26, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_27, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_28, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_29, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_30, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_31, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_32, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_33, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_34, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_35, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_36, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_37, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_38, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_39, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_40, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_41, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_42, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_43, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_44, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_45, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_46, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_47, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_48, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_49, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_50, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_51, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_52, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_53, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_54, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_55, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_56, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_57, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_58, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_59, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_60, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_61, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_62, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_63, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_64, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_65, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_66, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_67, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_68, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_69, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_70, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_71, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_72, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_73, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_74, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_75, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_76, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_77, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_78, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_79, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_80, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_81, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_82, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_83, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_84, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_85, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_86, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_87, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_88, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_89, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_90, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_91, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_92, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_93, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_94, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_95, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_96, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_97, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_98, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_99, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_99);
+
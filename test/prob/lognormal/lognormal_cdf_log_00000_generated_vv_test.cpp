@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogLognormal, type_vv_0> AgradCdfLogLognormal_vv_0;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_1> AgradCdfLogLognormal_vv_1;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_2> AgradCdfLogLognormal_vv_2;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_3> AgradCdfLogLognormal_vv_3;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_4> AgradCdfLogLognormal_vv_4;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_5> AgradCdfLogLognormal_vv_5;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_6> AgradCdfLogLognormal_vv_6;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_7> AgradCdfLogLognormal_vv_7;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_8> AgradCdfLogLognormal_vv_8;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_9> AgradCdfLogLognormal_vv_9;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_10> AgradCdfLogLognormal_vv_10;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_11> AgradCdfLogLognormal_vv_11;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_12> AgradCdfLogLognormal_vv_12;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_13> AgradCdfLogLognormal_vv_13;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_14> AgradCdfLogLognormal_vv_14;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_15> AgradCdfLogLognormal_vv_15;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_16> AgradCdfLogLognormal_vv_16;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_17> AgradCdfLogLognormal_vv_17;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_18> AgradCdfLogLognormal_vv_18;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_19> AgradCdfLogLognormal_vv_19;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_20> AgradCdfLogLognormal_vv_20;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_21> AgradCdfLogLognormal_vv_21;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_22> AgradCdfLogLognormal_vv_22;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_23> AgradCdfLogLognormal_vv_23;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_24> AgradCdfLogLognormal_vv_24;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_25> AgradCdfLogLognormal_vv_25;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_26> AgradCdfLogLognormal_vv_26;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_27> AgradCdfLogLognormal_vv_27;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_28> AgradCdfLogLognormal_vv_28;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_29> AgradCdfLogLognormal_vv_29;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_30> AgradCdfLogLognormal_vv_30;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_31> AgradCdfLogLognormal_vv_31;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_32> AgradCdfLogLognormal_vv_32;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_33> AgradCdfLogLognormal_vv_33;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_34> AgradCdfLogLognormal_vv_34;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_35> AgradCdfLogLognormal_vv_35;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_36> AgradCdfLogLognormal_vv_36;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_37> AgradCdfLogLognormal_vv_37;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_38> AgradCdfLogLognormal_vv_38;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_39> AgradCdfLogLognormal_vv_39;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_40> AgradCdfLogLognormal_vv_40;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_41> AgradCdfLogLognormal_vv_41;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_42> AgradCdfLogLognormal_vv_42;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_43> AgradCdfLogLognormal_vv_43;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_44> AgradCdfLogLognormal_vv_44;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_45> AgradCdfLogLognormal_vv_45;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_46> AgradCdfLogLognormal_vv_46;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_47> AgradCdfLogLognormal_vv_47;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_48> AgradCdfLogLognormal_vv_48;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_49> AgradCdfLogLognormal_vv_49;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_50> AgradCdfLogLognormal_vv_50;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_51> AgradCdfLogLognormal_vv_51;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_52> AgradCdfLogLognormal_vv_52;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_53> AgradCdfLogLognormal_vv_53;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_54> AgradCdfLogLognormal_vv_54;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_55> AgradCdfLogLognormal_vv_55;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_56> AgradCdfLogLognormal_vv_56;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_57> AgradCdfLogLognormal_vv_57;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_58> AgradCdfLogLognormal_vv_58;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_59> AgradCdfLogLognormal_vv_59;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_60> AgradCdfLogLognormal_vv_60;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_61> AgradCdfLogLognormal_vv_61;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_62> AgradCdfLogLognormal_vv_62;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_63> AgradCdfLogLognormal_vv_63;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_64> AgradCdfLogLognormal_vv_64;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_65> AgradCdfLogLognormal_vv_65;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_66> AgradCdfLogLognormal_vv_66;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_67> AgradCdfLogLognormal_vv_67;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_68> AgradCdfLogLognormal_vv_68;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_69> AgradCdfLogLognormal_vv_69;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_70> AgradCdfLogLognormal_vv_70;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_71> AgradCdfLogLognormal_vv_71;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_72> AgradCdfLogLognormal_vv_72;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_73> AgradCdfLogLognormal_vv_73;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_74> AgradCdfLogLognormal_vv_74;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_75> AgradCdfLogLognormal_vv_75;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_76> AgradCdfLogLognormal_vv_76;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_77> AgradCdfLogLognormal_vv_77;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_78> AgradCdfLogLognormal_vv_78;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_79> AgradCdfLogLognormal_vv_79;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_80> AgradCdfLogLognormal_vv_80;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_81> AgradCdfLogLognormal_vv_81;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_82> AgradCdfLogLognormal_vv_82;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_83> AgradCdfLogLognormal_vv_83;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_84> AgradCdfLogLognormal_vv_84;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_85> AgradCdfLogLognormal_vv_85;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_86> AgradCdfLogLognormal_vv_86;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_87> AgradCdfLogLognormal_vv_87;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_88> AgradCdfLogLognormal_vv_88;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_89> AgradCdfLogLognormal_vv_89;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_90> AgradCdfLogLognormal_vv_90;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_91> AgradCdfLogLognormal_vv_91;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_92> AgradCdfLogLognormal_vv_92;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_93> AgradCdfLogLognormal_vv_93;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_94> AgradCdfLogLognormal_vv_94;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_95> AgradCdfLogLognormal_vv_95;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_96> AgradCdfLogLognormal_vv_96;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_97> AgradCdfLogLognormal_vv_97;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_98> AgradCdfLogLognormal_vv_98;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_99> AgradCdfLogLognormal_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_0, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_1, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_2, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_3, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_4, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_5, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_6, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_7, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_8, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_9, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_10, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_11, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_12, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_13, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_14, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_15, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_16, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_17, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_18, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_19, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_20, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_21, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_22, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_23, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_24, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_25, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_26, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_27, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_28, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_29, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_30, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_31, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_32, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_33, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_34, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_35, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_36, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_37, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_38, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_39, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_40, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_41, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_42, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_43, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_44, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_45, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_46, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_47, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_48, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_49, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_50, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_51, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_52, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_53, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_54, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_55, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_56, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_57, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_58, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_59, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_60, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_61, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_62, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_63, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_64, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_65, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_66, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_67, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_68, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_69, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_70, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_71, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_72, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_73, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_74, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_75, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_76, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_77, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_78, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_79, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_80, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_81, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_82, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_83, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_84, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_85, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_86, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_87, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_88, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_89, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_90, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_91, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_92, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_93, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_94, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_95, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_96, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_97, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_98, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_99, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_99);
+
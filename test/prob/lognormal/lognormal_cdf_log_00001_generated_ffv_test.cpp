@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_100> AgradCdfLogLognormal_ffv_100;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_101> AgradCdfLogLognormal_ffv_101;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_102> AgradCdfLogLognormal_ffv_102;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_103> AgradCdfLogLognormal_ffv_103;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_104> AgradCdfLogLognormal_ffv_104;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_105> AgradCdfLogLognormal_ffv_105;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_106> AgradCdfLogLognormal_ffv_106;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_107> AgradCdfLogLognormal_ffv_107;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_108> AgradCdfLogLognormal_ffv_108;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_109> AgradCdfLogLognormal_ffv_109;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_110> AgradCdfLogLognormal_ffv_110;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_111> AgradCdfLogLognormal_ffv_111;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_112> AgradCdfLogLognormal_ffv_112;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_113> AgradCdfLogLognormal_ffv_113;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_114> AgradCdfLogLognormal_ffv_114;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_115> AgradCdfLogLognormal_ffv_115;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_116> AgradCdfLogLognormal_ffv_116;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_117> AgradCdfLogLognormal_ffv_117;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_118> AgradCdfLogLognormal_ffv_118;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_119> AgradCdfLogLognormal_ffv_119;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_120> AgradCdfLogLognormal_ffv_120;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_121> AgradCdfLogLognormal_ffv_121;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_122> AgradCdfLogLognormal_ffv_122;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_123> AgradCdfLogLognormal_ffv_123;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_124> AgradCdfLogLognormal_ffv_124;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_125> AgradCdfLogLognormal_ffv_125;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_126> AgradCdfLogLognormal_ffv_126;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_127> AgradCdfLogLognormal_ffv_127;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_128> AgradCdfLogLognormal_ffv_128;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_129> AgradCdfLogLognormal_ffv_129;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_130> AgradCdfLogLognormal_ffv_130;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_131> AgradCdfLogLognormal_ffv_131;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_132> AgradCdfLogLognormal_ffv_132;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_133> AgradCdfLogLognormal_ffv_133;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_134> AgradCdfLogLognormal_ffv_134;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_135> AgradCdfLogLognormal_ffv_135;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_136> AgradCdfLogLognormal_ffv_136;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_137> AgradCdfLogLognormal_ffv_137;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_138> AgradCdfLogLognormal_ffv_138;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_139> AgradCdfLogLognormal_ffv_139;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_140> AgradCdfLogLognormal_ffv_140;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_141> AgradCdfLogLognormal_ffv_141;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_142> AgradCdfLogLognormal_ffv_142;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_143> AgradCdfLogLognormal_ffv_143;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_144> AgradCdfLogLognormal_ffv_144;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_145> AgradCdfLogLognormal_ffv_145;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_146> AgradCdfLogLognormal_ffv_146;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_147> AgradCdfLogLognormal_ffv_147;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_148> AgradCdfLogLognormal_ffv_148;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_149> AgradCdfLogLognormal_ffv_149;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_150> AgradCdfLogLognormal_ffv_150;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_151> AgradCdfLogLognormal_ffv_151;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_152> AgradCdfLogLognormal_ffv_152;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_153> AgradCdfLogLognormal_ffv_153;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_154> AgradCdfLogLognormal_ffv_154;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_155> AgradCdfLogLognormal_ffv_155;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_156> AgradCdfLogLognormal_ffv_156;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_157> AgradCdfLogLognormal_ffv_157;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_158> AgradCdfLogLognormal_ffv_158;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_159> AgradCdfLogLognormal_ffv_159;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_160> AgradCdfLogLognormal_ffv_160;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_161> AgradCdfLogLognormal_ffv_161;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_162> AgradCdfLogLognormal_ffv_162;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_163> AgradCdfLogLognormal_ffv_163;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_164> AgradCdfLogLognormal_ffv_164;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_165> AgradCdfLogLognormal_ffv_165;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_166> AgradCdfLogLognormal_ffv_166;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_167> AgradCdfLogLognormal_ffv_167;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_168> AgradCdfLogLognormal_ffv_168;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_169> AgradCdfLogLognormal_ffv_169;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_170> AgradCdfLogLognormal_ffv_170;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_171> AgradCdfLogLognormal_ffv_171;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_172> AgradCdfLogLognormal_ffv_172;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_173> AgradCdfLogLognormal_ffv_173;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_174> AgradCdfLogLognormal_ffv_174;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_175> AgradCdfLogLognormal_ffv_175;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_176> AgradCdfLogLognormal_ffv_176;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_177> AgradCdfLogLognormal_ffv_177;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_178> AgradCdfLogLognormal_ffv_178;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_179> AgradCdfLogLognormal_ffv_179;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_180> AgradCdfLogLognormal_ffv_180;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_181> AgradCdfLogLognormal_ffv_181;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_182> AgradCdfLogLognormal_ffv_182;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_183> AgradCdfLogLognormal_ffv_183;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_184> AgradCdfLogLognormal_ffv_184;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_185> AgradCdfLogLognormal_ffv_185;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_186> AgradCdfLogLognormal_ffv_186;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_187> AgradCdfLogLognormal_ffv_187;
+typedef std::tuple<AgradCdfLogLognormal, type_ffv_188> AgradCdfLogLognormal_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_100, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_101, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_102, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_103, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_104, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_105, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_106, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_107, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_108, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_109, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_110, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_111, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_112, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_113, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_114, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_115, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_116, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_117, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_118, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_119, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_120, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_121, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_122, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_123, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_124, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_125, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_126, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_127, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_128, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_129, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_130, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_131, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_132, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_133, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_134, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_135, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_136, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_137, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_138, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_139, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_140, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_141, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_142, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_143, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_144, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_145, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_146, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_147, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_148, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_149, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_150, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_151, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_152, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_153, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_154, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_155, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_156, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_157, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_158, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_159, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_160, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_161, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_162, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_163, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_164, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_165, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_166, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_167, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_168, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_169, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_170, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_171, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_172, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_173, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_174, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_175, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_176, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_177, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_178, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_179, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_180, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_181, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_182, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_183, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_184, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_185, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_186, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_187, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_ffv_188, AgradCdfLogTestFixture, AgradCdfLogLognormal_ffv_188);
+
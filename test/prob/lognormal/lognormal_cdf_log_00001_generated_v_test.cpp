@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogLognormal, type_v_100> AgradCdfLogLognormal_v_100;
+typedef std::tuple<AgradCdfLogLognormal, type_v_101> AgradCdfLogLognormal_v_101;
+typedef std::tuple<AgradCdfLogLognormal, type_v_102> AgradCdfLogLognormal_v_102;
+typedef std::tuple<AgradCdfLogLognormal, type_v_103> AgradCdfLogLognormal_v_103;
+typedef std::tuple<AgradCdfLogLognormal, type_v_104> AgradCdfLogLognormal_v_104;
+typedef std::tuple<AgradCdfLogLognormal, type_v_105> AgradCdfLogLognormal_v_105;
+typedef std::tuple<AgradCdfLogLognormal, type_v_106> AgradCdfLogLognormal_v_106;
+typedef std::tuple<AgradCdfLogLognormal, type_v_107> AgradCdfLogLognormal_v_107;
+typedef std::tuple<AgradCdfLogLognormal, type_v_108> AgradCdfLogLognormal_v_108;
+typedef std::tuple<AgradCdfLogLognormal, type_v_109> AgradCdfLogLognormal_v_109;
+typedef std::tuple<AgradCdfLogLognormal, type_v_110> AgradCdfLogLognormal_v_110;
+typedef std::tuple<AgradCdfLogLognormal, type_v_111> AgradCdfLogLognormal_v_111;
+typedef std::tuple<AgradCdfLogLognormal, type_v_112> AgradCdfLogLognormal_v_112;
+typedef std::tuple<AgradCdfLogLognormal, type_v_113> AgradCdfLogLognormal_v_113;
+typedef std::tuple<AgradCdfLogLognormal, type_v_114> AgradCdfLogLognormal_v_114;
+typedef std::tuple<AgradCdfLogLognormal, type_v_115> AgradCdfLogLognormal_v_115;
+typedef std::tuple<AgradCdfLogLognormal, type_v_116> AgradCdfLogLognormal_v_116;
+typedef std::tuple<AgradCdfLogLognormal, type_v_117> AgradCdfLogLognormal_v_117;
+typedef std::tuple<AgradCdfLogLognormal, type_v_118> AgradCdfLogLognormal_v_118;
+typedef std::tuple<AgradCdfLogLognormal, type_v_119> AgradCdfLogLognormal_v_119;
+typedef std::tuple<AgradCdfLogLognormal, type_v_120> AgradCdfLogLognormal_v_120;
+typedef std::tuple<AgradCdfLogLognormal, type_v_121> AgradCdfLogLognormal_v_121;
+typedef std::tuple<AgradCdfLogLognormal, type_v_122> AgradCdfLogLognormal_v_122;
+typedef std::tuple<AgradCdfLogLognormal, type_v_123> AgradCdfLogLognormal_v_123;
+typedef std::tuple<AgradCdfLogLognormal, type_v_124> AgradCdfLogLognormal_v_124;
+typedef std::tuple<AgradCdfLogLognormal, type_v_125> AgradCdfLogLognormal_v_125;
+typedef std::tuple<AgradCdfLogLognormal, type_v_126> AgradCdfLogLognormal_v_126;
+typedef std::tuple<AgradCdfLogLognormal, type_v_127> AgradCdfLogLognormal_v_127;
+typedef std::tuple<AgradCdfLogLognormal, type_v_128> AgradCdfLogLognormal_v_128;
+typedef std::tuple<AgradCdfLogLognormal, type_v_129> AgradCdfLogLognormal_v_129;
+typedef std::tuple<AgradCdfLogLognormal, type_v_130> AgradCdfLogLognormal_v_130;
+typedef std::tuple<AgradCdfLogLognormal, type_v_131> AgradCdfLogLognormal_v_131;
+typedef std::tuple<AgradCdfLogLognormal, type_v_132> AgradCdfLogLognormal_v_132;
+typedef std::tuple<AgradCdfLogLognormal, type_v_133> AgradCdfLogLognormal_v_133;
+typedef std::tuple<AgradCdfLogLognormal, type_v_134> AgradCdfLogLognormal_v_134;
+typedef std::tuple<AgradCdfLogLognormal, type_v_135> AgradCdfLogLognormal_v_135;
+typedef std::tuple<AgradCdfLogLognormal, type_v_136> AgradCdfLogLognormal_v_136;
+typedef std::tuple<AgradCdfLogLognormal, type_v_137> AgradCdfLogLognormal_v_137;
+typedef std::tuple<AgradCdfLogLognormal, type_v_138> AgradCdfLogLognormal_v_138;
+typedef std::tuple<AgradCdfLogLognormal, type_v_139> AgradCdfLogLognormal_v_139;
+typedef std::tuple<AgradCdfLogLognormal, type_v_140> AgradCdfLogLognormal_v_140;
+typedef std::tuple<AgradCdfLogLognormal, type_v_141> AgradCdfLogLognormal_v_141;
+typedef std::tuple<AgradCdfLogLognormal, type_v_142> AgradCdfLogLognormal_v_142;
+typedef std::tuple<AgradCdfLogLognormal, type_v_143> AgradCdfLogLognormal_v_143;
+typedef std::tuple<AgradCdfLogLognormal, type_v_144> AgradCdfLogLognormal_v_144;
+typedef std::tuple<AgradCdfLogLognormal, type_v_145> AgradCdfLogLognormal_v_145;
+typedef std::tuple<AgradCdfLogLognormal, type_v_146> AgradCdfLogLognormal_v_146;
+typedef std::tuple<AgradCdfLogLognormal, type_v_147> AgradCdfLogLognormal_v_147;
+typedef std::tuple<AgradCdfLogLognormal, type_v_148> AgradCdfLogLognormal_v_148;
+typedef std::tuple<AgradCdfLogLognormal, type_v_149> AgradCdfLogLognormal_v_149;
+typedef std::tuple<AgradCdfLogLognormal, type_v_150> AgradCdfLogLognormal_v_150;
+typedef std::tuple<AgradCdfLogLognormal, type_v_151> AgradCdfLogLognormal_v_151;
+typedef std::tuple<AgradCdfLogLognormal, type_v_152> AgradCdfLogLognormal_v_152;
+typedef std::tuple<AgradCdfLogLognormal, type_v_153> AgradCdfLogLognormal_v_153;
+typedef std::tuple<AgradCdfLogLognormal, type_v_154> AgradCdfLogLognormal_v_154;
+typedef std::tuple<AgradCdfLogLognormal, type_v_155> AgradCdfLogLognormal_v_155;
+typedef std::tuple<AgradCdfLogLognormal, type_v_156> AgradCdfLogLognormal_v_156;
+typedef std::tuple<AgradCdfLogLognormal, type_v_157> AgradCdfLogLognormal_v_157;
+typedef std::tuple<AgradCdfLogLognormal, type_v_158> AgradCdfLogLognormal_v_158;
+typedef std::tuple<AgradCdfLogLognormal, type_v_159> AgradCdfLogLognormal_v_159;
+typedef std::tuple<AgradCdfLogLognormal, type_v_160> AgradCdfLogLognormal_v_160;
+typedef std::tuple<AgradCdfLogLognormal, type_v_161> AgradCdfLogLognormal_v_161;
+typedef std::tuple<AgradCdfLogLognormal, type_v_162> AgradCdfLogLognormal_v_162;
+typedef std::tuple<AgradCdfLogLognormal, type_v_163> AgradCdfLogLognormal_v_163;
+typedef std::tuple<AgradCdfLogLognormal, type_v_164> AgradCdfLogLognormal_v_164;
+typedef std::tuple<AgradCdfLogLognormal, type_v_165> AgradCdfLogLognormal_v_165;
+typedef std::tuple<AgradCdfLogLognormal, type_v_166> AgradCdfLogLognormal_v_166;
+typedef std::tuple<AgradCdfLogLognormal, type_v_167> AgradCdfLogLognormal_v_167;
+typedef std::tuple<AgradCdfLogLognormal, type_v_168> AgradCdfLogLognormal_v_168;
+typedef std::tuple<AgradCdfLogLognormal, type_v_169> AgradCdfLogLognormal_v_169;
+typedef std::tuple<AgradCdfLogLognormal, type_v_170> AgradCdfLogLognormal_v_170;
+typedef std::tuple<AgradCdfLogLognormal, type_v_171> AgradCdfLogLognormal_v_171;
+typedef std::tuple<AgradCdfLogLognormal, type_v_172> AgradCdfLogLognormal_v_172;
+typedef std::tuple<AgradCdfLogLognormal, type_v_173> AgradCdfLogLognormal_v_173;
+typedef std::tuple<AgradCdfLogLognormal, type_v_174> AgradCdfLogLognormal_v_174;
+typedef std::tuple<AgradCdfLogLognormal, type_v_175> AgradCdfLogLognormal_v_175;
+typedef std::tuple<AgradCdfLogLognormal, type_v_176> AgradCdfLogLognormal_v_176;
+typedef std::tuple<AgradCdfLogLognormal, type_v_177> AgradCdfLogLognormal_v_177;
+typedef std::tuple<AgradCdfLogLognormal, type_v_178> AgradCdfLogLognormal_v_178;
+typedef std::tuple<AgradCdfLogLognormal, type_v_179> AgradCdfLogLognormal_v_179;
+typedef std::tuple<AgradCdfLogLognormal, type_v_180> AgradCdfLogLognormal_v_180;
+typedef std::tuple<AgradCdfLogLognormal, type_v_181> AgradCdfLogLognormal_v_181;
+typedef std::tuple<AgradCdfLogLognormal, type_v_182> AgradCdfLogLognormal_v_182;
+typedef std::tuple<AgradCdfLogLognormal, type_v_183> AgradCdfLogLognormal_v_183;
+typedef std::tuple<AgradCdfLogLognormal, type_v_184> AgradCdfLogLognormal_v_184;
+typedef std::tuple<AgradCdfLogLognormal, type_v_185> AgradCdfLogLognormal_v_185;
+typedef std::tuple<AgradCdfLogLognormal, type_v_186> AgradCdfLogLognormal_v_186;
+typedef std::tuple<AgradCdfLogLognormal, type_v_187> AgradCdfLogLognormal_v_187;
+typedef std::tuple<AgradCdfLogLognormal, type_v_188> AgradCdfLogLognormal_v_188;
+typedef std::tuple<AgradCdfLogLognormal, type_v_189> AgradCdfLogLognormal_v_189;
+typedef std::tuple<AgradCdfLogLognormal, type_v_190> AgradCdfLogLognormal_v_190;
+typedef std::tuple<AgradCdfLogLognormal, type_v_191> AgradCdfLogLognormal_v_191;
+typedef std::tuple<AgradCdfLogLognormal, type_v_192> AgradCdfLogLognormal_v_192;
+typedef std::tuple<AgradCdfLogLognormal, type_v_193> AgradCdfLogLognormal_v_193;
+typedef std::tuple<AgradCdfLogLognormal, type_v_194> AgradCdfLogLognormal_v_194;
+typedef std::tuple<AgradCdfLogLognormal, type_v_195> AgradCdfLogLognormal_v_195;
+typedef std::tuple<AgradCdfLogLognormal, type_v_196> AgradCdfLogLognormal_v_196;
+typedef std::tuple<AgradCdfLogLognormal, type_v_197> AgradCdfLogLognormal_v_197;
+typedef std::tuple<AgradCdfLogLognormal, type_v_198> AgradCdfLogLognormal_v_198;
+typedef std::tuple<AgradCdfLogLognormal, type_v_199> AgradCdfLogLognormal_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_100, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_101, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_102, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_103, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_104, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_105, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_106, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_107, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_108, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_109, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_110, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_111, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_112, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_113, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_114, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_115, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_116, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_117, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_118, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_119, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_120, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_121, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_122, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_123, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_124, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_125, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_126, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_127, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_128, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_129, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_130, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_131, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_132, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_133, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_134, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_135, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_136, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_137, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_138, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_139, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_140, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_141, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_142, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_143, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_144, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_145, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_146, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_147, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_148, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_149, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_150, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_151, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_152, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_153, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_154, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_155, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_156, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_157, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_158, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_159, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_160, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_161, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_162, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_163, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_164, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_165, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_166, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_167, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_168, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_169, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_170, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_171, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_172, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_173, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_174, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_175, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_176, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_177, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_178, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_179, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_180, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_181, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_182, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_183, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_184, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_185, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_186, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_187, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_188, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_189, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_190, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_191, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_192, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_193, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_194, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_195, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_196, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_197, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_198, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_199, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_199);
+
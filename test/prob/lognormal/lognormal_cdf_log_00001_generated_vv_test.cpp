@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogLognormal, type_vv_100> AgradCdfLogLognormal_vv_100;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_101> AgradCdfLogLognormal_vv_101;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_102> AgradCdfLogLognormal_vv_102;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_103> AgradCdfLogLognormal_vv_103;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_104> AgradCdfLogLognormal_vv_104;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_105> AgradCdfLogLognormal_vv_105;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_106> AgradCdfLogLognormal_vv_106;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_107> AgradCdfLogLognormal_vv_107;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_108> AgradCdfLogLognormal_vv_108;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_109> AgradCdfLogLognormal_vv_109;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_110> AgradCdfLogLognormal_vv_110;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_111> AgradCdfLogLognormal_vv_111;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_112> AgradCdfLogLognormal_vv_112;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_113> AgradCdfLogLognormal_vv_113;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_114> AgradCdfLogLognormal_vv_114;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_115> AgradCdfLogLognormal_vv_115;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_116> AgradCdfLogLognormal_vv_116;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_117> AgradCdfLogLognormal_vv_117;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_118> AgradCdfLogLognormal_vv_118;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_119> AgradCdfLogLognormal_vv_119;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_120> AgradCdfLogLognormal_vv_120;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_121> AgradCdfLogLognormal_vv_121;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_122> AgradCdfLogLognormal_vv_122;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_123> AgradCdfLogLognormal_vv_123;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_124> AgradCdfLogLognormal_vv_124;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_125> AgradCdfLogLognormal_vv_125;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_126> AgradCdfLogLognormal_vv_126;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_127> AgradCdfLogLognormal_vv_127;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_128> AgradCdfLogLognormal_vv_128;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_129> AgradCdfLogLognormal_vv_129;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_130> AgradCdfLogLognormal_vv_130;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_131> AgradCdfLogLognormal_vv_131;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_132> AgradCdfLogLognormal_vv_132;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_133> AgradCdfLogLognormal_vv_133;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_134> AgradCdfLogLognormal_vv_134;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_135> AgradCdfLogLognormal_vv_135;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_136> AgradCdfLogLognormal_vv_136;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_137> AgradCdfLogLognormal_vv_137;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_138> AgradCdfLogLognormal_vv_138;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_139> AgradCdfLogLognormal_vv_139;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_140> AgradCdfLogLognormal_vv_140;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_141> AgradCdfLogLognormal_vv_141;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_142> AgradCdfLogLognormal_vv_142;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_143> AgradCdfLogLognormal_vv_143;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_144> AgradCdfLogLognormal_vv_144;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_145> AgradCdfLogLognormal_vv_145;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_146> AgradCdfLogLognormal_vv_146;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_147> AgradCdfLogLognormal_vv_147;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_148> AgradCdfLogLognormal_vv_148;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_149> AgradCdfLogLognormal_vv_149;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_150> AgradCdfLogLognormal_vv_150;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_151> AgradCdfLogLognormal_vv_151;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_152> AgradCdfLogLognormal_vv_152;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_153> AgradCdfLogLognormal_vv_153;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_154> AgradCdfLogLognormal_vv_154;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_155> AgradCdfLogLognormal_vv_155;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_156> AgradCdfLogLognormal_vv_156;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_157> AgradCdfLogLognormal_vv_157;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_158> AgradCdfLogLognormal_vv_158;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_159> AgradCdfLogLognormal_vv_159;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_160> AgradCdfLogLognormal_vv_160;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_161> AgradCdfLogLognormal_vv_161;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_162> AgradCdfLogLognormal_vv_162;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_163> AgradCdfLogLognormal_vv_163;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_164> AgradCdfLogLognormal_vv_164;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_165> AgradCdfLogLognormal_vv_165;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_166> AgradCdfLogLognormal_vv_166;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_167> AgradCdfLogLognormal_vv_167;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_168> AgradCdfLogLognormal_vv_168;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_169> AgradCdfLogLognormal_vv_169;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_170> AgradCdfLogLognormal_vv_170;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_171> AgradCdfLogLognormal_vv_171;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_172> AgradCdfLogLognormal_vv_172;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_173> AgradCdfLogLognormal_vv_173;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_174> AgradCdfLogLognormal_vv_174;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_175> AgradCdfLogLognormal_vv_175;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_176> AgradCdfLogLognormal_vv_176;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_177> AgradCdfLogLognormal_vv_177;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_178> AgradCdfLogLognormal_vv_178;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_179> AgradCdfLogLognormal_vv_179;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_180> AgradCdfLogLognormal_vv_180;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_181> AgradCdfLogLognormal_vv_181;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_182> AgradCdfLogLognormal_vv_182;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_183> AgradCdfLogLognormal_vv_183;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_184> AgradCdfLogLognormal_vv_184;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_185> AgradCdfLogLognormal_vv_185;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_186> AgradCdfLogLognormal_vv_186;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_187> AgradCdfLogLognormal_vv_187;
+typedef std::tuple<AgradCdfLogLognormal, type_vv_188> AgradCdfLogLognormal_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_100, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_101, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_102, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_103, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_104, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_105, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_106, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_107, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_108, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_109, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_110, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_111, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_112, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_113, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_114, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_115, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_116, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_117, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_118, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_119, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_120, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_121, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_122, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_123, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_124, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_125, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_126, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_127, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_128, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_129, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_130, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_131, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_132, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_133, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_134, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_135, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_136, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_137, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_138, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_139, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_140, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_141, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_142, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_143, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_144, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_145, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_146, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_147, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_148, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_149, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_150, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_151, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_152, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_153, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_154, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_155, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_156, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_157, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_158, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_159, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_160, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_161, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_162, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_163, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_164, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_165, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_166, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_167, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_168, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_169, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_170, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_171, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_172, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_173, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_174, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_175, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_176, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_177, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_178, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_179, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_180, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_181, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_182, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_183, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_184, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_185, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_186, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_187, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_vv_188, AgradCdfLogTestFixture, AgradCdfLogLognormal_vv_188);
+
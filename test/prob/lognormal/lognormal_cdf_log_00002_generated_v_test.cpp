@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/lognormal/lognormal_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCdfLogLognormal, type_v_200> AgradCdfLogLognormal_v_200;
+typedef std::tuple<AgradCdfLogLognormal, type_v_201> AgradCdfLogLognormal_v_201;
+typedef std::tuple<AgradCdfLogLognormal, type_v_202> AgradCdfLogLognormal_v_202;
+typedef std::tuple<AgradCdfLogLognormal, type_v_203> AgradCdfLogLognormal_v_203;
+typedef std::tuple<AgradCdfLogLognormal, type_v_204> AgradCdfLogLognormal_v_204;
+typedef std::tuple<AgradCdfLogLognormal, type_v_205> AgradCdfLogLognormal_v_205;
+typedef std::tuple<AgradCdfLogLognormal, type_v_206> AgradCdfLogLognormal_v_206;
+typedef std::tuple<AgradCdfLogLognormal, type_v_207> AgradCdfLogLognormal_v_207;
+typedef std::tuple<AgradCdfLogLognormal, type_v_208> AgradCdfLogLognormal_v_208;
+typedef std::tuple<AgradCdfLogLognormal, type_v_209> AgradCdfLogLognormal_v_209;
+typedef std::tuple<AgradCdfLogLognormal, type_v_210> AgradCdfLogLognormal_v_210;
+typedef std::tuple<AgradCdfLogLognormal, type_v_211> AgradCdfLogLognormal_v_211;
+typedef std::tuple<AgradCdfLogLognormal, type_v_212> AgradCdfLogLognormal_v_212;
+typedef std::tuple<AgradCdfLogLognormal, type_v_213> AgradCdfLogLognormal_v_213;
+typedef std::tuple<AgradCdfLogLognormal, type_v_214> AgradCdfLogLognormal_v_214;
+typedef std::tuple<AgradCdfLogLognormal, type_v_215> AgradCdfLogLognormal_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_200, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_201, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_202, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_203, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_204, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_205, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_206, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_207, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_208, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_209, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_210, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_211, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_212, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_213, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_214, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogLognormal_v_215, AgradCdfLogTestFixture, AgradCdfLogLognormal_v_215);
+
@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial/neg_binomial_test.hpp>
+
+typedef std::tuple<int, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<int, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_0> AgradDistributionsNegBinomial_ffv_0;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_1> AgradDistributionsNegBinomial_ffv_1;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_2> AgradDistributionsNegBinomial_ffv_2;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_3> AgradDistributionsNegBinomial_ffv_3;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_4> AgradDistributionsNegBinomial_ffv_4;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_5> AgradDistributionsNegBinomial_ffv_5;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_6> AgradDistributionsNegBinomial_ffv_6;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_7> AgradDistributionsNegBinomial_ffv_7;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_8> AgradDistributionsNegBinomial_ffv_8;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_9> AgradDistributionsNegBinomial_ffv_9;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_10> AgradDistributionsNegBinomial_ffv_10;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_11> AgradDistributionsNegBinomial_ffv_11;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_12> AgradDistributionsNegBinomial_ffv_12;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_13> AgradDistributionsNegBinomial_ffv_13;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_14> AgradDistributionsNegBinomial_ffv_14;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_15> AgradDistributionsNegBinomial_ffv_15;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_16> AgradDistributionsNegBinomial_ffv_16;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_17> AgradDistributionsNegBinomial_ffv_17;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_18> AgradDistributionsNegBinomial_ffv_18;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_19> AgradDistributionsNegBinomial_ffv_19;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_20> AgradDistributionsNegBinomial_ffv_20;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_21> AgradDistributionsNegBinomial_ffv_21;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_22> AgradDistributionsNegBinomial_ffv_22;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_23> AgradDistributionsNegBinomial_ffv_23;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_24> AgradDistributionsNegBinomial_ffv_24;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_25> AgradDistributionsNegBinomial_ffv_25;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_26> AgradDistributionsNegBinomial_ffv_26;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_27> AgradDistributionsNegBinomial_ffv_27;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_28> AgradDistributionsNegBinomial_ffv_28;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_29> AgradDistributionsNegBinomial_ffv_29;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_30> AgradDistributionsNegBinomial_ffv_30;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_31> AgradDistributionsNegBinomial_ffv_31;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_32> AgradDistributionsNegBinomial_ffv_32;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_33> AgradDistributionsNegBinomial_ffv_33;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_34> AgradDistributionsNegBinomial_ffv_34;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_35> AgradDistributionsNegBinomial_ffv_35;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_36> AgradDistributionsNegBinomial_ffv_36;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_37> AgradDistributionsNegBinomial_ffv_37;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_38> AgradDistributionsNegBinomial_ffv_38;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_39> AgradDistributionsNegBinomial_ffv_39;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_40> AgradDistributionsNegBinomial_ffv_40;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_41> AgradDistributionsNegBinomial_ffv_41;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_42> AgradDistributionsNegBinomial_ffv_42;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_43> AgradDistributionsNegBinomial_ffv_43;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_44> AgradDistributionsNegBinomial_ffv_44;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_45> AgradDistributionsNegBinomial_ffv_45;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_46> AgradDistributionsNegBinomial_ffv_46;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_47> AgradDistributionsNegBinomial_ffv_47;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_48> AgradDistributionsNegBinomial_ffv_48;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_49> AgradDistributionsNegBinomial_ffv_49;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_50> AgradDistributionsNegBinomial_ffv_50;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_51> AgradDistributionsNegBinomial_ffv_51;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_52> AgradDistributionsNegBinomial_ffv_52;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_53> AgradDistributionsNegBinomial_ffv_53;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_54> AgradDistributionsNegBinomial_ffv_54;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_55> AgradDistributionsNegBinomial_ffv_55;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_56> AgradDistributionsNegBinomial_ffv_56;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_57> AgradDistributionsNegBinomial_ffv_57;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_58> AgradDistributionsNegBinomial_ffv_58;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_59> AgradDistributionsNegBinomial_ffv_59;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_60> AgradDistributionsNegBinomial_ffv_60;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_61> AgradDistributionsNegBinomial_ffv_61;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_62> AgradDistributionsNegBinomial_ffv_62;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_63> AgradDistributionsNegBinomial_ffv_63;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_64> AgradDistributionsNegBinomial_ffv_64;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_65> AgradDistributionsNegBinomial_ffv_65;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_66> AgradDistributionsNegBinomial_ffv_66;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_67> AgradDistributionsNegBinomial_ffv_67;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_68> AgradDistributionsNegBinomial_ffv_68;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_69> AgradDistributionsNegBinomial_ffv_69;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_70> AgradDistributionsNegBinomial_ffv_70;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_71> AgradDistributionsNegBinomial_ffv_71;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_72> AgradDistributionsNegBinomial_ffv_72;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_73> AgradDistributionsNegBinomial_ffv_73;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_74> AgradDistributionsNegBinomial_ffv_74;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_75> AgradDistributionsNegBinomial_ffv_75;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_76> AgradDistributionsNegBinomial_ffv_76;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_77> AgradDistributionsNegBinomial_ffv_77;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_78> AgradDistributionsNegBinomial_ffv_78;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_79> AgradDistributionsNegBinomial_ffv_79;
+typedef std::tuple<AgradDistributionsNegBinomial, type_ffv_80> AgradDistributionsNegBinomial_ffv_80;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_0, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_1, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_2, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_3, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_4, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_5, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_6, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_7, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_8, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_9, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_10, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_11, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_12, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_13, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_14, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_15, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_16, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_17, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_18, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_19, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_20, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_21, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_22, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_23, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_24, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_25, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_26, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_27, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_28, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_29, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_30, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_31, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_32, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_33, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_34, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_35, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_36, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_37, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_38, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_39, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_40, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_41, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_42, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_43, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_44, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_45, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_46, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_47, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_48, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_49, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_50, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_51, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_52, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_53, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_54, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_55, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_56, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_57, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_58, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_59, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_60, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_61, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_62, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_63, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_64, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_65, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_66, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_67, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_68, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_69, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_70, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_71, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_72, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_73, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_74, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_75, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_76, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_77, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_78, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_79, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_ffv_80, AgradDistributionTestFixture, AgradDistributionsNegBinomial_ffv_80);
+
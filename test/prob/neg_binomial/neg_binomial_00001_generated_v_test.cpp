@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial/neg_binomial_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+
+typedef std::tuple<AgradDistributionsNegBinomial, type_v_100> AgradDistributionsNegBinomial_v_100;
+typedef std::tuple<AgradDistributionsNegBinomial, type_v_101> AgradDistributionsNegBinomial_v_101;
+typedef std::tuple<AgradDistributionsNegBinomial, type_v_102> AgradDistributionsNegBinomial_v_102;
+typedef std::tuple<AgradDistributionsNegBinomial, type_v_103> AgradDistributionsNegBinomial_v_103;
+typedef std::tuple<AgradDistributionsNegBinomial, type_v_104> AgradDistributionsNegBinomial_v_104;
+typedef std::tuple<AgradDistributionsNegBinomial, type_v_105> AgradDistributionsNegBinomial_v_105;
+typedef std::tuple<AgradDistributionsNegBinomial, type_v_106> AgradDistributionsNegBinomial_v_106;
+typedef std::tuple<AgradDistributionsNegBinomial, type_v_107> AgradDistributionsNegBinomial_v_107;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_v_100, AgradDistributionTestFixture, AgradDistributionsNegBinomial_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_v_101, AgradDistributionTestFixture, AgradDistributionsNegBinomial_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_v_102, AgradDistributionTestFixture, AgradDistributionsNegBinomial_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_v_103, AgradDistributionTestFixture, AgradDistributionsNegBinomial_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_v_104, AgradDistributionTestFixture, AgradDistributionsNegBinomial_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_v_105, AgradDistributionTestFixture, AgradDistributionsNegBinomial_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_v_106, AgradDistributionTestFixture, AgradDistributionsNegBinomial_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial_v_107, AgradDistributionTestFixture, AgradDistributionsNegBinomial_v_107);
+
@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial/neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<int, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_0> AgradCcdfLogNegBinomial_ffv_0;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_1> AgradCcdfLogNegBinomial_ffv_1;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_2> AgradCcdfLogNegBinomial_ffv_2;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_3> AgradCcdfLogNegBinomial_ffv_3;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_4> AgradCcdfLogNegBinomial_ffv_4;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_5> AgradCcdfLogNegBinomial_ffv_5;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_6> AgradCcdfLogNegBinomial_ffv_6;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_7> AgradCcdfLogNegBinomial_ffv_7;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_8> AgradCcdfLogNegBinomial_ffv_8;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_9> AgradCcdfLogNegBinomial_ffv_9;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_10> AgradCcdfLogNegBinomial_ffv_10;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_11> AgradCcdfLogNegBinomial_ffv_11;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_12> AgradCcdfLogNegBinomial_ffv_12;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_13> AgradCcdfLogNegBinomial_ffv_13;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_14> AgradCcdfLogNegBinomial_ffv_14;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_15> AgradCcdfLogNegBinomial_ffv_15;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_16> AgradCcdfLogNegBinomial_ffv_16;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_17> AgradCcdfLogNegBinomial_ffv_17;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_18> AgradCcdfLogNegBinomial_ffv_18;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_19> AgradCcdfLogNegBinomial_ffv_19;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_20> AgradCcdfLogNegBinomial_ffv_20;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_21> AgradCcdfLogNegBinomial_ffv_21;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_22> AgradCcdfLogNegBinomial_ffv_22;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_23> AgradCcdfLogNegBinomial_ffv_23;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_24> AgradCcdfLogNegBinomial_ffv_24;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_25> AgradCcdfLogNegBinomial_ffv_25;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_26> AgradCcdfLogNegBinomial_ffv_26;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_27> AgradCcdfLogNegBinomial_ffv_27;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_28> AgradCcdfLogNegBinomial_ffv_28;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_29> AgradCcdfLogNegBinomial_ffv_29;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_30> AgradCcdfLogNegBinomial_ffv_30;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_31> AgradCcdfLogNegBinomial_ffv_31;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_32> AgradCcdfLogNegBinomial_ffv_32;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_33> AgradCcdfLogNegBinomial_ffv_33;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_34> AgradCcdfLogNegBinomial_ffv_34;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_35> AgradCcdfLogNegBinomial_ffv_35;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_36> AgradCcdfLogNegBinomial_ffv_36;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_37> AgradCcdfLogNegBinomial_ffv_37;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_38> AgradCcdfLogNegBinomial_ffv_38;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_39> AgradCcdfLogNegBinomial_ffv_39;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_40> AgradCcdfLogNegBinomial_ffv_40;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_41> AgradCcdfLogNegBinomial_ffv_41;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_42> AgradCcdfLogNegBinomial_ffv_42;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_43> AgradCcdfLogNegBinomial_ffv_43;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_44> AgradCcdfLogNegBinomial_ffv_44;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_45> AgradCcdfLogNegBinomial_ffv_45;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_46> AgradCcdfLogNegBinomial_ffv_46;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_47> AgradCcdfLogNegBinomial_ffv_47;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_48> AgradCcdfLogNegBinomial_ffv_48;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_49> AgradCcdfLogNegBinomial_ffv_49;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_50> AgradCcdfLogNegBinomial_ffv_50;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_51> AgradCcdfLogNegBinomial_ffv_51;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_52> AgradCcdfLogNegBinomial_ffv_52;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_53> AgradCcdfLogNegBinomial_ffv_53;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_54> AgradCcdfLogNegBinomial_ffv_54;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_55> AgradCcdfLogNegBinomial_ffv_55;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_56> AgradCcdfLogNegBinomial_ffv_56;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_57> AgradCcdfLogNegBinomial_ffv_57;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_58> AgradCcdfLogNegBinomial_ffv_58;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_59> AgradCcdfLogNegBinomial_ffv_59;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_60> AgradCcdfLogNegBinomial_ffv_60;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_61> AgradCcdfLogNegBinomial_ffv_61;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_62> AgradCcdfLogNegBinomial_ffv_62;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_63> AgradCcdfLogNegBinomial_ffv_63;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_64> AgradCcdfLogNegBinomial_ffv_64;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_65> AgradCcdfLogNegBinomial_ffv_65;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_66> AgradCcdfLogNegBinomial_ffv_66;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_67> AgradCcdfLogNegBinomial_ffv_67;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_68> AgradCcdfLogNegBinomial_ffv_68;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_69> AgradCcdfLogNegBinomial_ffv_69;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_70> AgradCcdfLogNegBinomial_ffv_70;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_71> AgradCcdfLogNegBinomial_ffv_71;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_72> AgradCcdfLogNegBinomial_ffv_72;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_73> AgradCcdfLogNegBinomial_ffv_73;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_74> AgradCcdfLogNegBinomial_ffv_74;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_75> AgradCcdfLogNegBinomial_ffv_75;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_76> AgradCcdfLogNegBinomial_ffv_76;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_77> AgradCcdfLogNegBinomial_ffv_77;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_78> AgradCcdfLogNegBinomial_ffv_78;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_79> AgradCcdfLogNegBinomial_ffv_79;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_ffv_80> AgradCcdfLogNegBinomial_ffv_80;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_ffv_80);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial/neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<int, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<int, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<int, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<int, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<int, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<int, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<int, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<int, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<int, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<int>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<int>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<int>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<int>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_0> AgradCcdfLogNegBinomial_v_0;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_1> AgradCcdfLogNegBinomial_v_1;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_2> AgradCcdfLogNegBinomial_v_2;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_3> AgradCcdfLogNegBinomial_v_3;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_4> AgradCcdfLogNegBinomial_v_4;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_5> AgradCcdfLogNegBinomial_v_5;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_6> AgradCcdfLogNegBinomial_v_6;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_7> AgradCcdfLogNegBinomial_v_7;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_8> AgradCcdfLogNegBinomial_v_8;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_9> AgradCcdfLogNegBinomial_v_9;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_10> AgradCcdfLogNegBinomial_v_10;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_11> AgradCcdfLogNegBinomial_v_11;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_12> AgradCcdfLogNegBinomial_v_12;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_13> AgradCcdfLogNegBinomial_v_13;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_14> AgradCcdfLogNegBinomial_v_14;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_15> AgradCcdfLogNegBinomial_v_15;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_16> AgradCcdfLogNegBinomial_v_16;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_17> AgradCcdfLogNegBinomial_v_17;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_18> AgradCcdfLogNegBinomial_v_18;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_19> AgradCcdfLogNegBinomial_v_19;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_20> AgradCcdfLogNegBinomial_v_20;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_21> AgradCcdfLogNegBinomial_v_21;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_22> AgradCcdfLogNegBinomial_v_22;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_23> AgradCcdfLogNegBinomial_v_23;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_24> AgradCcdfLogNegBinomial_v_24;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_25> AgradCcdfLogNegBinomial_v_25;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_26> AgradCcdfLogNegBinomial_v_26;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_27> AgradCcdfLogNegBinomial_v_27;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_28> AgradCcdfLogNegBinomial_v_28;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_29> AgradCcdfLogNegBinomial_v_29;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_30> AgradCcdfLogNegBinomial_v_30;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_31> AgradCcdfLogNegBinomial_v_31;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_32> AgradCcdfLogNegBinomial_v_32;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_33> AgradCcdfLogNegBinomial_v_33;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_34> AgradCcdfLogNegBinomial_v_34;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_35> AgradCcdfLogNegBinomial_v_35;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_36> AgradCcdfLogNegBinomial_v_36;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_37> AgradCcdfLogNegBinomial_v_37;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_38> AgradCcdfLogNegBinomial_v_38;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_39> AgradCcdfLogNegBinomial_v_39;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_40> AgradCcdfLogNegBinomial_v_40;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_41> AgradCcdfLogNegBinomial_v_41;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_42> AgradCcdfLogNegBinomial_v_42;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_43> AgradCcdfLogNegBinomial_v_43;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_44> AgradCcdfLogNegBinomial_v_44;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_45> AgradCcdfLogNegBinomial_v_45;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_46> AgradCcdfLogNegBinomial_v_46;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_47> AgradCcdfLogNegBinomial_v_47;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_48> AgradCcdfLogNegBinomial_v_48;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_49> AgradCcdfLogNegBinomial_v_49;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_50> AgradCcdfLogNegBinomial_v_50;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_51> AgradCcdfLogNegBinomial_v_51;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_52> AgradCcdfLogNegBinomial_v_52;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_53> AgradCcdfLogNegBinomial_v_53;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_54> AgradCcdfLogNegBinomial_v_54;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_55> AgradCcdfLogNegBinomial_v_55;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_56> AgradCcdfLogNegBinomial_v_56;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_57> AgradCcdfLogNegBinomial_v_57;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_58> AgradCcdfLogNegBinomial_v_58;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_59> AgradCcdfLogNegBinomial_v_59;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_60> AgradCcdfLogNegBinomial_v_60;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_61> AgradCcdfLogNegBinomial_v_61;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_62> AgradCcdfLogNegBinomial_v_62;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_63> AgradCcdfLogNegBinomial_v_63;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_64> AgradCcdfLogNegBinomial_v_64;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_65> AgradCcdfLogNegBinomial_v_65;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_66> AgradCcdfLogNegBinomial_v_66;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_67> AgradCcdfLogNegBinomial_v_67;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_68> AgradCcdfLogNegBinomial_v_68;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_69> AgradCcdfLogNegBinomial_v_69;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_70> AgradCcdfLogNegBinomial_v_70;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_71> AgradCcdfLogNegBinomial_v_71;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_72> AgradCcdfLogNegBinomial_v_72;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_73> AgradCcdfLogNegBinomial_v_73;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_74> AgradCcdfLogNegBinomial_v_74;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_75> AgradCcdfLogNegBinomial_v_75;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_76> AgradCcdfLogNegBinomial_v_76;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_77> AgradCcdfLogNegBinomial_v_77;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_78> AgradCcdfLogNegBinomial_v_78;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_79> AgradCcdfLogNegBinomial_v_79;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_80> AgradCcdfLogNegBinomial_v_80;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_81> AgradCcdfLogNegBinomial_v_81;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_82> AgradCcdfLogNegBinomial_v_82;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_83> AgradCcdfLogNegBinomial_v_83;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_84> AgradCcdfLogNegBinomial_v_84;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_85> AgradCcdfLogNegBinomial_v_85;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_86> AgradCcdfLogNegBinomial_v_86;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_87> AgradCcdfLogNegBinomial_v_87;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_88> AgradCcdfLogNegBinomial_v_88;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_89> AgradCcdfLogNegBinomial_v_89;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_90> AgradCcdfLogNegBinomial_v_90;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_91> AgradCcdfLogNegBinomial_v_91;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_92> AgradCcdfLogNegBinomial_v_92;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_93> AgradCcdfLogNegBinomial_v_93;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_94> AgradCcdfLogNegBinomial_v_94;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_95> AgradCcdfLogNegBinomial_v_95;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_96> AgradCcdfLogNegBinomial_v_96;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_97> AgradCcdfLogNegBinomial_v_97;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_98> AgradCcdfLogNegBinomial_v_98;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_v_99> AgradCcdfLogNegBinomial_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_0, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_1, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_2, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_3, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_4, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_5, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_6, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_7, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_8, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_9, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_10, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_11, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_12, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_13, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_14, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_15, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_16, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_17, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_18, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_19, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_20, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_21, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_22, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_23, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_24, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_25, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_26, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_27, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_28, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_29, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_30, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_31, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_32, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_33, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_34, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_35, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_36, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_37, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_38, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_39, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_40, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_41, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_42, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_43, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_44, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_45, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_46, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_47, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_48, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_49, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_50, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_51, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_52, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_53, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_54, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_55, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_56, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_57, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_58, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_59, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_60, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_61, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_62, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_63, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_64, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_65, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_66, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_67, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_68, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_69, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_70, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_71, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_72, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_73, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_74, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_75, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_76, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_77, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_78, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_79, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_80, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_81, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_82, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_83, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_84, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_85, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_86, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_87, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_88, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_89, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_90, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_91, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_92, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_93, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_94, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_95, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_96, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_97, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_98, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_v_99, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_v_99);
+
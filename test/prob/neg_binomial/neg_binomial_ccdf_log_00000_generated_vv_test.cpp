@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial/neg_binomial_ccdf_log_test.hpp>
+
+typedef std::tuple<int, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<int, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<int, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<int, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<int, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<int, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<int, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<int, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<int>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<int>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<int>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_0> AgradCcdfLogNegBinomial_vv_0;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_1> AgradCcdfLogNegBinomial_vv_1;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_2> AgradCcdfLogNegBinomial_vv_2;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_3> AgradCcdfLogNegBinomial_vv_3;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_4> AgradCcdfLogNegBinomial_vv_4;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_5> AgradCcdfLogNegBinomial_vv_5;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_6> AgradCcdfLogNegBinomial_vv_6;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_7> AgradCcdfLogNegBinomial_vv_7;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_8> AgradCcdfLogNegBinomial_vv_8;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_9> AgradCcdfLogNegBinomial_vv_9;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_10> AgradCcdfLogNegBinomial_vv_10;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_11> AgradCcdfLogNegBinomial_vv_11;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_12> AgradCcdfLogNegBinomial_vv_12;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_13> AgradCcdfLogNegBinomial_vv_13;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_14> AgradCcdfLogNegBinomial_vv_14;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_15> AgradCcdfLogNegBinomial_vv_15;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_16> AgradCcdfLogNegBinomial_vv_16;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_17> AgradCcdfLogNegBinomial_vv_17;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_18> AgradCcdfLogNegBinomial_vv_18;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_19> AgradCcdfLogNegBinomial_vv_19;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_20> AgradCcdfLogNegBinomial_vv_20;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_21> AgradCcdfLogNegBinomial_vv_21;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_22> AgradCcdfLogNegBinomial_vv_22;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_23> AgradCcdfLogNegBinomial_vv_23;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_24> AgradCcdfLogNegBinomial_vv_24;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_25> AgradCcdfLogNegBinomial_vv_25;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_26> AgradCcdfLogNegBinomial_vv_26;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_27> AgradCcdfLogNegBinomial_vv_27;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_28> AgradCcdfLogNegBinomial_vv_28;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_29> AgradCcdfLogNegBinomial_vv_29;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_30> AgradCcdfLogNegBinomial_vv_30;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_31> AgradCcdfLogNegBinomial_vv_31;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_32> AgradCcdfLogNegBinomial_vv_32;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_33> AgradCcdfLogNegBinomial_vv_33;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_34> AgradCcdfLogNegBinomial_vv_34;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_35> AgradCcdfLogNegBinomial_vv_35;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_36> AgradCcdfLogNegBinomial_vv_36;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_37> AgradCcdfLogNegBinomial_vv_37;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_38> AgradCcdfLogNegBinomial_vv_38;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_39> AgradCcdfLogNegBinomial_vv_39;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_40> AgradCcdfLogNegBinomial_vv_40;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_41> AgradCcdfLogNegBinomial_vv_41;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_42> AgradCcdfLogNegBinomial_vv_42;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_43> AgradCcdfLogNegBinomial_vv_43;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_44> AgradCcdfLogNegBinomial_vv_44;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_45> AgradCcdfLogNegBinomial_vv_45;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_46> AgradCcdfLogNegBinomial_vv_46;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_47> AgradCcdfLogNegBinomial_vv_47;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_48> AgradCcdfLogNegBinomial_vv_48;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_49> AgradCcdfLogNegBinomial_vv_49;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_50> AgradCcdfLogNegBinomial_vv_50;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_51> AgradCcdfLogNegBinomial_vv_51;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_52> AgradCcdfLogNegBinomial_vv_52;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_53> AgradCcdfLogNegBinomial_vv_53;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_54> AgradCcdfLogNegBinomial_vv_54;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_55> AgradCcdfLogNegBinomial_vv_55;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_56> AgradCcdfLogNegBinomial_vv_56;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_57> AgradCcdfLogNegBinomial_vv_57;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_58> AgradCcdfLogNegBinomial_vv_58;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_59> AgradCcdfLogNegBinomial_vv_59;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_60> AgradCcdfLogNegBinomial_vv_60;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_61> AgradCcdfLogNegBinomial_vv_61;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_62> AgradCcdfLogNegBinomial_vv_62;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_63> AgradCcdfLogNegBinomial_vv_63;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_64> AgradCcdfLogNegBinomial_vv_64;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_65> AgradCcdfLogNegBinomial_vv_65;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_66> AgradCcdfLogNegBinomial_vv_66;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_67> AgradCcdfLogNegBinomial_vv_67;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_68> AgradCcdfLogNegBinomial_vv_68;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_69> AgradCcdfLogNegBinomial_vv_69;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_70> AgradCcdfLogNegBinomial_vv_70;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_71> AgradCcdfLogNegBinomial_vv_71;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_72> AgradCcdfLogNegBinomial_vv_72;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_73> AgradCcdfLogNegBinomial_vv_73;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_74> AgradCcdfLogNegBinomial_vv_74;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_75> AgradCcdfLogNegBinomial_vv_75;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_76> AgradCcdfLogNegBinomial_vv_76;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_77> AgradCcdfLogNegBinomial_vv_77;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_78> AgradCcdfLogNegBinomial_vv_78;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_79> AgradCcdfLogNegBinomial_vv_79;
+typedef std::tuple<AgradCcdfLogNegBinomial, type_vv_80> AgradCcdfLogNegBinomial_vv_80;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNegBinomial_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogNegBinomial_vv_80);
+
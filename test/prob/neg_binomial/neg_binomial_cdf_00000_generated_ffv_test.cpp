@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial/neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<int, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_0> AgradCdfNegBinomial_ffv_0;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_1> AgradCdfNegBinomial_ffv_1;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_2> AgradCdfNegBinomial_ffv_2;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_3> AgradCdfNegBinomial_ffv_3;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_4> AgradCdfNegBinomial_ffv_4;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_5> AgradCdfNegBinomial_ffv_5;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_6> AgradCdfNegBinomial_ffv_6;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_7> AgradCdfNegBinomial_ffv_7;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_8> AgradCdfNegBinomial_ffv_8;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_9> AgradCdfNegBinomial_ffv_9;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_10> AgradCdfNegBinomial_ffv_10;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_11> AgradCdfNegBinomial_ffv_11;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_12> AgradCdfNegBinomial_ffv_12;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_13> AgradCdfNegBinomial_ffv_13;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_14> AgradCdfNegBinomial_ffv_14;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_15> AgradCdfNegBinomial_ffv_15;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_16> AgradCdfNegBinomial_ffv_16;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_17> AgradCdfNegBinomial_ffv_17;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_18> AgradCdfNegBinomial_ffv_18;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_19> AgradCdfNegBinomial_ffv_19;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_20> AgradCdfNegBinomial_ffv_20;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_21> AgradCdfNegBinomial_ffv_21;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_22> AgradCdfNegBinomial_ffv_22;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_23> AgradCdfNegBinomial_ffv_23;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_24> AgradCdfNegBinomial_ffv_24;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_25> AgradCdfNegBinomial_ffv_25;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_26> AgradCdfNegBinomial_ffv_26;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_27> AgradCdfNegBinomial_ffv_27;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_28> AgradCdfNegBinomial_ffv_28;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_29> AgradCdfNegBinomial_ffv_29;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_30> AgradCdfNegBinomial_ffv_30;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_31> AgradCdfNegBinomial_ffv_31;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_32> AgradCdfNegBinomial_ffv_32;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_33> AgradCdfNegBinomial_ffv_33;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_34> AgradCdfNegBinomial_ffv_34;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_35> AgradCdfNegBinomial_ffv_35;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_36> AgradCdfNegBinomial_ffv_36;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_37> AgradCdfNegBinomial_ffv_37;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_38> AgradCdfNegBinomial_ffv_38;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_39> AgradCdfNegBinomial_ffv_39;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_40> AgradCdfNegBinomial_ffv_40;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_41> AgradCdfNegBinomial_ffv_41;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_42> AgradCdfNegBinomial_ffv_42;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_43> AgradCdfNegBinomial_ffv_43;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_44> AgradCdfNegBinomial_ffv_44;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_45> AgradCdfNegBinomial_ffv_45;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_46> AgradCdfNegBinomial_ffv_46;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_47> AgradCdfNegBinomial_ffv_47;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_48> AgradCdfNegBinomial_ffv_48;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_49> AgradCdfNegBinomial_ffv_49;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_50> AgradCdfNegBinomial_ffv_50;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_51> AgradCdfNegBinomial_ffv_51;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_52> AgradCdfNegBinomial_ffv_52;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_53> AgradCdfNegBinomial_ffv_53;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_54> AgradCdfNegBinomial_ffv_54;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_55> AgradCdfNegBinomial_ffv_55;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_56> AgradCdfNegBinomial_ffv_56;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_57> AgradCdfNegBinomial_ffv_57;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_58> AgradCdfNegBinomial_ffv_58;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_59> AgradCdfNegBinomial_ffv_59;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_60> AgradCdfNegBinomial_ffv_60;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_61> AgradCdfNegBinomial_ffv_61;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_62> AgradCdfNegBinomial_ffv_62;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_63> AgradCdfNegBinomial_ffv_63;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_64> AgradCdfNegBinomial_ffv_64;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_65> AgradCdfNegBinomial_ffv_65;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_66> AgradCdfNegBinomial_ffv_66;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_67> AgradCdfNegBinomial_ffv_67;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_68> AgradCdfNegBinomial_ffv_68;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_69> AgradCdfNegBinomial_ffv_69;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_70> AgradCdfNegBinomial_ffv_70;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_71> AgradCdfNegBinomial_ffv_71;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_72> AgradCdfNegBinomial_ffv_72;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_73> AgradCdfNegBinomial_ffv_73;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_74> AgradCdfNegBinomial_ffv_74;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_75> AgradCdfNegBinomial_ffv_75;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_76> AgradCdfNegBinomial_ffv_76;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_77> AgradCdfNegBinomial_ffv_77;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_78> AgradCdfNegBinomial_ffv_78;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_79> AgradCdfNegBinomial_ffv_79;
+typedef std::tuple<AgradCdfNegBinomial, type_ffv_80> AgradCdfNegBinomial_ffv_80;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_0, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_1, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_2, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_3, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_4, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_5, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_6, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_7, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_8, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_9, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_10, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_11, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_12, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_13, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_14, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_15, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_16, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_17, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_18, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_19, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_20, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_21, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_22, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_23, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_24, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_25, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_26, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_27, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_28, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_29, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_30, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_31, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_32, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_33, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_34, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_35, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_36, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_37, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_38, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_39, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_40, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_41, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_42, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_43, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_44, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_45, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_46, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_47, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_48, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_49, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_50, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_51, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_52, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_53, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_54, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_55, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_56, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_57, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_58, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_59, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_60, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_61, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_62, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_63, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_64, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_65, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_66, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_67, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_68, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_69, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_70, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_71, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_72, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_73, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_74, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_75, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_76, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_77, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_78, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_79, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_ffv_80, AgradCdfTestFixture, AgradCdfNegBinomial_ffv_80);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial/neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<int, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<int, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<int, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<int, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<int, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<int, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<int, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<int, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<int, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<int>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<int>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<int>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<int>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfNegBinomial, type_v_0> AgradCdfNegBinomial_v_0;
+typedef std::tuple<AgradCdfNegBinomial, type_v_1> AgradCdfNegBinomial_v_1;
+typedef std::tuple<AgradCdfNegBinomial, type_v_2> AgradCdfNegBinomial_v_2;
+typedef std::tuple<AgradCdfNegBinomial, type_v_3> AgradCdfNegBinomial_v_3;
+typedef std::tuple<AgradCdfNegBinomial, type_v_4> AgradCdfNegBinomial_v_4;
+typedef std::tuple<AgradCdfNegBinomial, type_v_5> AgradCdfNegBinomial_v_5;
+typedef std::tuple<AgradCdfNegBinomial, type_v_6> AgradCdfNegBinomial_v_6;
+typedef std::tuple<AgradCdfNegBinomial, type_v_7> AgradCdfNegBinomial_v_7;
+typedef std::tuple<AgradCdfNegBinomial, type_v_8> AgradCdfNegBinomial_v_8;
+typedef std::tuple<AgradCdfNegBinomial, type_v_9> AgradCdfNegBinomial_v_9;
+typedef std::tuple<AgradCdfNegBinomial, type_v_10> AgradCdfNegBinomial_v_10;
+typedef std::tuple<AgradCdfNegBinomial, type_v_11> AgradCdfNegBinomial_v_11;
+typedef std::tuple<AgradCdfNegBinomial, type_v_12> AgradCdfNegBinomial_v_12;
+typedef std::tuple<AgradCdfNegBinomial, type_v_13> AgradCdfNegBinomial_v_13;
+typedef std::tuple<AgradCdfNegBinomial, type_v_14> AgradCdfNegBinomial_v_14;
+typedef std::tuple<AgradCdfNegBinomial, type_v_15> AgradCdfNegBinomial_v_15;
+typedef std::tuple<AgradCdfNegBinomial, type_v_16> AgradCdfNegBinomial_v_16;
+typedef std::tuple<AgradCdfNegBinomial, type_v_17> AgradCdfNegBinomial_v_17;
+typedef std::tuple<AgradCdfNegBinomial, type_v_18> AgradCdfNegBinomial_v_18;
+typedef std::tuple<AgradCdfNegBinomial, type_v_19> AgradCdfNegBinomial_v_19;
+typedef std::tuple<AgradCdfNegBinomial, type_v_20> AgradCdfNegBinomial_v_20;
+typedef std::tuple<AgradCdfNegBinomial, type_v_21> AgradCdfNegBinomial_v_21;
+typedef std::tuple<AgradCdfNegBinomial, type_v_22> AgradCdfNegBinomial_v_22;
+typedef std::tuple<AgradCdfNegBinomial, type_v_23> AgradCdfNegBinomial_v_23;
+typedef std::tuple<AgradCdfNegBinomial, type_v_24> AgradCdfNegBinomial_v_24;
+typedef std::tuple<AgradCdfNegBinomial, type_v_25> AgradCdfNegBinomial_v_25;
+typedef std::tuple<AgradCdfNegBinomial, type_v_26> AgradCdfNegBinomial_v_26;
+typedef std::tuple<AgradCdfNegBinomial, type_v_27> AgradCdfNegBinomial_v_27;
+typedef std::tuple<AgradCdfNegBinomial, type_v_28> AgradCdfNegBinomial_v_28;
+typedef std::tuple<AgradCdfNegBinomial, type_v_29> AgradCdfNegBinomial_v_29;
+typedef std::tuple<AgradCdfNegBinomial, type_v_30> AgradCdfNegBinomial_v_30;
+typedef std::tuple<AgradCdfNegBinomial, type_v_31> AgradCdfNegBinomial_v_31;
+typedef std::tuple<AgradCdfNegBinomial, type_v_32> AgradCdfNegBinomial_v_32;
+typedef std::tuple<AgradCdfNegBinomial, type_v_33> AgradCdfNegBinomial_v_33;
+typedef std::tuple<AgradCdfNegBinomial, type_v_34> AgradCdfNegBinomial_v_34;
+typedef std::tuple<AgradCdfNegBinomial, type_v_35> AgradCdfNegBinomial_v_35;
+typedef std::tuple<AgradCdfNegBinomial, type_v_36> AgradCdfNegBinomial_v_36;
+typedef std::tuple<AgradCdfNegBinomial, type_v_37> AgradCdfNegBinomial_v_37;
+typedef std::tuple<AgradCdfNegBinomial, type_v_38> AgradCdfNegBinomial_v_38;
+typedef std::tuple<AgradCdfNegBinomial, type_v_39> AgradCdfNegBinomial_v_39;
+typedef std::tuple<AgradCdfNegBinomial, type_v_40> AgradCdfNegBinomial_v_40;
+typedef std::tuple<AgradCdfNegBinomial, type_v_41> AgradCdfNegBinomial_v_41;
+typedef std::tuple<AgradCdfNegBinomial, type_v_42> AgradCdfNegBinomial_v_42;
+typedef std::tuple<AgradCdfNegBinomial, type_v_43> AgradCdfNegBinomial_v_43;
+typedef std::tuple<AgradCdfNegBinomial, type_v_44> AgradCdfNegBinomial_v_44;
+typedef std::tuple<AgradCdfNegBinomial, type_v_45> AgradCdfNegBinomial_v_45;
+typedef std::tuple<AgradCdfNegBinomial, type_v_46> AgradCdfNegBinomial_v_46;
+typedef std::tuple<AgradCdfNegBinomial, type_v_47> AgradCdfNegBinomial_v_47;
+typedef std::tuple<AgradCdfNegBinomial, type_v_48> AgradCdfNegBinomial_v_48;
+typedef std::tuple<AgradCdfNegBinomial, type_v_49> AgradCdfNegBinomial_v_49;
+typedef std::tuple<AgradCdfNegBinomial, type_v_50> AgradCdfNegBinomial_v_50;
+typedef std::tuple<AgradCdfNegBinomial, type_v_51> AgradCdfNegBinomial_v_51;
+typedef std::tuple<AgradCdfNegBinomial, type_v_52> AgradCdfNegBinomial_v_52;
+typedef std::tuple<AgradCdfNegBinomial, type_v_53> AgradCdfNegBinomial_v_53;
+typedef std::tuple<AgradCdfNegBinomial, type_v_54> AgradCdfNegBinomial_v_54;
+typedef std::tuple<AgradCdfNegBinomial, type_v_55> AgradCdfNegBinomial_v_55;
+typedef std::tuple<AgradCdfNegBinomial, type_v_56> AgradCdfNegBinomial_v_56;
+typedef std::tuple<AgradCdfNegBinomial, type_v_57> AgradCdfNegBinomial_v_57;
+typedef std::tuple<AgradCdfNegBinomial, type_v_58> AgradCdfNegBinomial_v_58;
+typedef std::tuple<AgradCdfNegBinomial, type_v_59> AgradCdfNegBinomial_v_59;
+typedef std::tuple<AgradCdfNegBinomial, type_v_60> AgradCdfNegBinomial_v_60;
+typedef std::tuple<AgradCdfNegBinomial, type_v_61> AgradCdfNegBinomial_v_61;
+typedef std::tuple<AgradCdfNegBinomial, type_v_62> AgradCdfNegBinomial_v_62;
+typedef std::tuple<AgradCdfNegBinomial, type_v_63> AgradCdfNegBinomial_v_63;
+typedef std::tuple<AgradCdfNegBinomial, type_v_64> AgradCdfNegBinomial_v_64;
+typedef std::tuple<AgradCdfNegBinomial, type_v_65> AgradCdfNegBinomial_v_65;
+typedef std::tuple<AgradCdfNegBinomial, type_v_66> AgradCdfNegBinomial_v_66;
+typedef std::tuple<AgradCdfNegBinomial, type_v_67> AgradCdfNegBinomial_v_67;
+typedef std::tuple<AgradCdfNegBinomial, type_v_68> AgradCdfNegBinomial_v_68;
+typedef std::tuple<AgradCdfNegBinomial, type_v_69> AgradCdfNegBinomial_v_69;
+typedef std::tuple<AgradCdfNegBinomial, type_v_70> AgradCdfNegBinomial_v_70;
+typedef std::tuple<AgradCdfNegBinomial, type_v_71> AgradCdfNegBinomial_v_71;
+typedef std::tuple<AgradCdfNegBinomial, type_v_72> AgradCdfNegBinomial_v_72;
+typedef std::tuple<AgradCdfNegBinomial, type_v_73> AgradCdfNegBinomial_v_73;
+typedef std::tuple<AgradCdfNegBinomial, type_v_74> AgradCdfNegBinomial_v_74;
+typedef std::tuple<AgradCdfNegBinomial, type_v_75> AgradCdfNegBinomial_v_75;
+typedef std::tuple<AgradCdfNegBinomial, type_v_76> AgradCdfNegBinomial_v_76;
+typedef std::tuple<AgradCdfNegBinomial, type_v_77> AgradCdfNegBinomial_v_77;
+typedef std::tuple<AgradCdfNegBinomial, type_v_78> AgradCdfNegBinomial_v_78;
+typedef std::tuple<AgradCdfNegBinomial, type_v_79> AgradCdfNegBinomial_v_79;
+typedef std::tuple<AgradCdfNegBinomial, type_v_80> AgradCdfNegBinomial_v_80;
+typedef std::tuple<AgradCdfNegBinomial, type_v_81> AgradCdfNegBinomial_v_81;
+typedef std::tuple<AgradCdfNegBinomial, type_v_82> AgradCdfNegBinomial_v_82;
+typedef std::tuple<AgradCdfNegBinomial, type_v_83> AgradCdfNegBinomial_v_83;
+typedef std::tuple<AgradCdfNegBinomial, type_v_84> AgradCdfNegBinomial_v_84;
+typedef std::tuple<AgradCdfNegBinomial, type_v_85> AgradCdfNegBinomial_v_85;
+typedef std::tuple<AgradCdfNegBinomial, type_v_86> AgradCdfNegBinomial_v_86;
+typedef std::tuple<AgradCdfNegBinomial, type_v_87> AgradCdfNegBinomial_v_87;
+typedef std::tuple<AgradCdfNegBinomial, type_v_88> AgradCdfNegBinomial_v_88;
+typedef std::tuple<AgradCdfNegBinomial, type_v_89> AgradCdfNegBinomial_v_89;
+typedef std::tuple<AgradCdfNegBinomial, type_v_90> AgradCdfNegBinomial_v_90;
+typedef std::tuple<AgradCdfNegBinomial, type_v_91> AgradCdfNegBinomial_v_91;
+typedef std::tuple<AgradCdfNegBinomial, type_v_92> AgradCdfNegBinomial_v_92;
+typedef std::tuple<AgradCdfNegBinomial, type_v_93> AgradCdfNegBinomial_v_93;
+typedef std::tuple<AgradCdfNegBinomial, type_v_94> AgradCdfNegBinomial_v_94;
+typedef std::tuple<AgradCdfNegBinomial, type_v_95> AgradCdfNegBinomial_v_95;
+typedef std::tuple<AgradCdfNegBinomial, type_v_96> AgradCdfNegBinomial_v_96;
+typedef std::tuple<AgradCdfNegBinomial, type_v_97> AgradCdfNegBinomial_v_97;
+typedef std::tuple<AgradCdfNegBinomial, type_v_98> AgradCdfNegBinomial_v_98;
+typedef std::tuple<AgradCdfNegBinomial, type_v_99> AgradCdfNegBinomial_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_0, AgradCdfTestFixture, AgradCdfNegBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_1, AgradCdfTestFixture, AgradCdfNegBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_2, AgradCdfTestFixture, AgradCdfNegBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_3, AgradCdfTestFixture, AgradCdfNegBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_4, AgradCdfTestFixture, AgradCdfNegBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_5, AgradCdfTestFixture, AgradCdfNegBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_6, AgradCdfTestFixture, AgradCdfNegBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_7, AgradCdfTestFixture, AgradCdfNegBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_8, AgradCdfTestFixture, AgradCdfNegBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_9, AgradCdfTestFixture, AgradCdfNegBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_10, AgradCdfTestFixture, AgradCdfNegBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_11, AgradCdfTestFixture, AgradCdfNegBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_12, AgradCdfTestFixture, AgradCdfNegBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_13, AgradCdfTestFixture, AgradCdfNegBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_14, AgradCdfTestFixture, AgradCdfNegBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_15, AgradCdfTestFixture, AgradCdfNegBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_16, AgradCdfTestFixture, AgradCdfNegBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_17, AgradCdfTestFixture, AgradCdfNegBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_18, AgradCdfTestFixture, AgradCdfNegBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_19, AgradCdfTestFixture, AgradCdfNegBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_20, AgradCdfTestFixture, AgradCdfNegBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_21, AgradCdfTestFixture, AgradCdfNegBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_22, AgradCdfTestFixture, AgradCdfNegBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_23, AgradCdfTestFixture, AgradCdfNegBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_24, AgradCdfTestFixture, AgradCdfNegBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_25, AgradCdfTestFixture, AgradCdfNegBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_26, AgradCdfTestFixture, AgradCdfNegBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_27, AgradCdfTestFixture, AgradCdfNegBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_28, AgradCdfTestFixture, AgradCdfNegBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_29, AgradCdfTestFixture, AgradCdfNegBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_30, AgradCdfTestFixture, AgradCdfNegBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_31, AgradCdfTestFixture, AgradCdfNegBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_32, AgradCdfTestFixture, AgradCdfNegBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_33, AgradCdfTestFixture, AgradCdfNegBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_34, AgradCdfTestFixture, AgradCdfNegBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_35, AgradCdfTestFixture, AgradCdfNegBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_36, AgradCdfTestFixture, AgradCdfNegBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_37, AgradCdfTestFixture, AgradCdfNegBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_38, AgradCdfTestFixture, AgradCdfNegBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_39, AgradCdfTestFixture, AgradCdfNegBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_40, AgradCdfTestFixture, AgradCdfNegBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_41, AgradCdfTestFixture, AgradCdfNegBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_42, AgradCdfTestFixture, AgradCdfNegBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_43, AgradCdfTestFixture, AgradCdfNegBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_44, AgradCdfTestFixture, AgradCdfNegBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_45, AgradCdfTestFixture, AgradCdfNegBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_46, AgradCdfTestFixture, AgradCdfNegBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_47, AgradCdfTestFixture, AgradCdfNegBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_48, AgradCdfTestFixture, AgradCdfNegBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_49, AgradCdfTestFixture, AgradCdfNegBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_50, AgradCdfTestFixture, AgradCdfNegBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_51, AgradCdfTestFixture, AgradCdfNegBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_52, AgradCdfTestFixture, AgradCdfNegBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_53, AgradCdfTestFixture, AgradCdfNegBinomial_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_54, AgradCdfTestFixture, AgradCdfNegBinomial_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_55, AgradCdfTestFixture, AgradCdfNegBinomial_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_56, AgradCdfTestFixture, AgradCdfNegBinomial_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_57, AgradCdfTestFixture, AgradCdfNegBinomial_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_58, AgradCdfTestFixture, AgradCdfNegBinomial_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_59, AgradCdfTestFixture, AgradCdfNegBinomial_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_60, AgradCdfTestFixture, AgradCdfNegBinomial_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_61, AgradCdfTestFixture, AgradCdfNegBinomial_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_62, AgradCdfTestFixture, AgradCdfNegBinomial_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_63, AgradCdfTestFixture, AgradCdfNegBinomial_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_64, AgradCdfTestFixture, AgradCdfNegBinomial_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_65, AgradCdfTestFixture, AgradCdfNegBinomial_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_66, AgradCdfTestFixture, AgradCdfNegBinomial_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_67, AgradCdfTestFixture, AgradCdfNegBinomial_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_68, AgradCdfTestFixture, AgradCdfNegBinomial_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_69, AgradCdfTestFixture, AgradCdfNegBinomial_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_70, AgradCdfTestFixture, AgradCdfNegBinomial_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_71, AgradCdfTestFixture, AgradCdfNegBinomial_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_72, AgradCdfTestFixture, AgradCdfNegBinomial_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_73, AgradCdfTestFixture, AgradCdfNegBinomial_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_74, AgradCdfTestFixture, AgradCdfNegBinomial_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_75, AgradCdfTestFixture, AgradCdfNegBinomial_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_76, AgradCdfTestFixture, AgradCdfNegBinomial_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_77, AgradCdfTestFixture, AgradCdfNegBinomial_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_78, AgradCdfTestFixture, AgradCdfNegBinomial_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_79, AgradCdfTestFixture, AgradCdfNegBinomial_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_80, AgradCdfTestFixture, AgradCdfNegBinomial_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_81, AgradCdfTestFixture, AgradCdfNegBinomial_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_82, AgradCdfTestFixture, AgradCdfNegBinomial_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_83, AgradCdfTestFixture, AgradCdfNegBinomial_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_84, AgradCdfTestFixture, AgradCdfNegBinomial_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_85, AgradCdfTestFixture, AgradCdfNegBinomial_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_86, AgradCdfTestFixture, AgradCdfNegBinomial_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_87, AgradCdfTestFixture, AgradCdfNegBinomial_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_88, AgradCdfTestFixture, AgradCdfNegBinomial_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_89, AgradCdfTestFixture, AgradCdfNegBinomial_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_90, AgradCdfTestFixture, AgradCdfNegBinomial_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_91, AgradCdfTestFixture, AgradCdfNegBinomial_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_92, AgradCdfTestFixture, AgradCdfNegBinomial_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_93, AgradCdfTestFixture, AgradCdfNegBinomial_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_94, AgradCdfTestFixture, AgradCdfNegBinomial_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_95, AgradCdfTestFixture, AgradCdfNegBinomial_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_96, AgradCdfTestFixture, AgradCdfNegBinomial_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_97, AgradCdfTestFixture, AgradCdfNegBinomial_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_98, AgradCdfTestFixture, AgradCdfNegBinomial_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_v_99, AgradCdfTestFixture, AgradCdfNegBinomial_v_99);
+
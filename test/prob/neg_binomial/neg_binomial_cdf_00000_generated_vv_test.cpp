@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial/neg_binomial_cdf_test.hpp>
+
+typedef std::tuple<int, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<int, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<int, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<int, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<int, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<int, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<int, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<int, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<int>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<int>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<int>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+
+typedef std::tuple<AgradCdfNegBinomial, type_vv_0> AgradCdfNegBinomial_vv_0;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_1> AgradCdfNegBinomial_vv_1;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_2> AgradCdfNegBinomial_vv_2;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_3> AgradCdfNegBinomial_vv_3;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_4> AgradCdfNegBinomial_vv_4;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_5> AgradCdfNegBinomial_vv_5;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_6> AgradCdfNegBinomial_vv_6;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_7> AgradCdfNegBinomial_vv_7;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_8> AgradCdfNegBinomial_vv_8;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_9> AgradCdfNegBinomial_vv_9;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_10> AgradCdfNegBinomial_vv_10;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_11> AgradCdfNegBinomial_vv_11;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_12> AgradCdfNegBinomial_vv_12;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_13> AgradCdfNegBinomial_vv_13;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_14> AgradCdfNegBinomial_vv_14;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_15> AgradCdfNegBinomial_vv_15;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_16> AgradCdfNegBinomial_vv_16;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_17> AgradCdfNegBinomial_vv_17;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_18> AgradCdfNegBinomial_vv_18;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_19> AgradCdfNegBinomial_vv_19;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_20> AgradCdfNegBinomial_vv_20;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_21> AgradCdfNegBinomial_vv_21;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_22> AgradCdfNegBinomial_vv_22;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_23> AgradCdfNegBinomial_vv_23;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_24> AgradCdfNegBinomial_vv_24;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_25> AgradCdfNegBinomial_vv_25;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_26> AgradCdfNegBinomial_vv_26;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_27> AgradCdfNegBinomial_vv_27;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_28> AgradCdfNegBinomial_vv_28;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_29> AgradCdfNegBinomial_vv_29;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_30> AgradCdfNegBinomial_vv_30;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_31> AgradCdfNegBinomial_vv_31;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_32> AgradCdfNegBinomial_vv_32;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_33> AgradCdfNegBinomial_vv_33;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_34> AgradCdfNegBinomial_vv_34;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_35> AgradCdfNegBinomial_vv_35;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_36> AgradCdfNegBinomial_vv_36;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_37> AgradCdfNegBinomial_vv_37;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_38> AgradCdfNegBinomial_vv_38;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_39> AgradCdfNegBinomial_vv_39;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_40> AgradCdfNegBinomial_vv_40;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_41> AgradCdfNegBinomial_vv_41;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_42> AgradCdfNegBinomial_vv_42;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_43> AgradCdfNegBinomial_vv_43;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_44> AgradCdfNegBinomial_vv_44;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_45> AgradCdfNegBinomial_vv_45;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_46> AgradCdfNegBinomial_vv_46;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_47> AgradCdfNegBinomial_vv_47;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_48> AgradCdfNegBinomial_vv_48;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_49> AgradCdfNegBinomial_vv_49;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_50> AgradCdfNegBinomial_vv_50;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_51> AgradCdfNegBinomial_vv_51;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_52> AgradCdfNegBinomial_vv_52;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_53> AgradCdfNegBinomial_vv_53;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_54> AgradCdfNegBinomial_vv_54;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_55> AgradCdfNegBinomial_vv_55;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_56> AgradCdfNegBinomial_vv_56;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_57> AgradCdfNegBinomial_vv_57;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_58> AgradCdfNegBinomial_vv_58;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_59> AgradCdfNegBinomial_vv_59;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_60> AgradCdfNegBinomial_vv_60;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_61> AgradCdfNegBinomial_vv_61;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_62> AgradCdfNegBinomial_vv_62;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_63> AgradCdfNegBinomial_vv_63;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_64> AgradCdfNegBinomial_vv_64;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_65> AgradCdfNegBinomial_vv_65;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_66> AgradCdfNegBinomial_vv_66;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_67> AgradCdfNegBinomial_vv_67;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_68> AgradCdfNegBinomial_vv_68;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_69> AgradCdfNegBinomial_vv_69;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_70> AgradCdfNegBinomial_vv_70;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_71> AgradCdfNegBinomial_vv_71;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_72> AgradCdfNegBinomial_vv_72;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_73> AgradCdfNegBinomial_vv_73;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_74> AgradCdfNegBinomial_vv_74;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_75> AgradCdfNegBinomial_vv_75;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_76> AgradCdfNegBinomial_vv_76;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_77> AgradCdfNegBinomial_vv_77;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_78> AgradCdfNegBinomial_vv_78;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_79> AgradCdfNegBinomial_vv_79;
+typedef std::tuple<AgradCdfNegBinomial, type_vv_80> AgradCdfNegBinomial_vv_80;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_0, AgradCdfTestFixture, AgradCdfNegBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_1, AgradCdfTestFixture, AgradCdfNegBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_2, AgradCdfTestFixture, AgradCdfNegBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_3, AgradCdfTestFixture, AgradCdfNegBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_4, AgradCdfTestFixture, AgradCdfNegBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_5, AgradCdfTestFixture, AgradCdfNegBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_6, AgradCdfTestFixture, AgradCdfNegBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_7, AgradCdfTestFixture, AgradCdfNegBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_8, AgradCdfTestFixture, AgradCdfNegBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_9, AgradCdfTestFixture, AgradCdfNegBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_10, AgradCdfTestFixture, AgradCdfNegBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_11, AgradCdfTestFixture, AgradCdfNegBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_12, AgradCdfTestFixture, AgradCdfNegBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_13, AgradCdfTestFixture, AgradCdfNegBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_14, AgradCdfTestFixture, AgradCdfNegBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_15, AgradCdfTestFixture, AgradCdfNegBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_16, AgradCdfTestFixture, AgradCdfNegBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_17, AgradCdfTestFixture, AgradCdfNegBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_18, AgradCdfTestFixture, AgradCdfNegBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_19, AgradCdfTestFixture, AgradCdfNegBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_20, AgradCdfTestFixture, AgradCdfNegBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_21, AgradCdfTestFixture, AgradCdfNegBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_22, AgradCdfTestFixture, AgradCdfNegBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_23, AgradCdfTestFixture, AgradCdfNegBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_24, AgradCdfTestFixture, AgradCdfNegBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_25, AgradCdfTestFixture, AgradCdfNegBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_26, AgradCdfTestFixture, AgradCdfNegBinomial_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_27, AgradCdfTestFixture, AgradCdfNegBinomial_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_28, AgradCdfTestFixture, AgradCdfNegBinomial_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_29, AgradCdfTestFixture, AgradCdfNegBinomial_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_30, AgradCdfTestFixture, AgradCdfNegBinomial_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_31, AgradCdfTestFixture, AgradCdfNegBinomial_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_32, AgradCdfTestFixture, AgradCdfNegBinomial_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_33, AgradCdfTestFixture, AgradCdfNegBinomial_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_34, AgradCdfTestFixture, AgradCdfNegBinomial_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_35, AgradCdfTestFixture, AgradCdfNegBinomial_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_36, AgradCdfTestFixture, AgradCdfNegBinomial_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_37, AgradCdfTestFixture, AgradCdfNegBinomial_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_38, AgradCdfTestFixture, AgradCdfNegBinomial_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_39, AgradCdfTestFixture, AgradCdfNegBinomial_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_40, AgradCdfTestFixture, AgradCdfNegBinomial_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_41, AgradCdfTestFixture, AgradCdfNegBinomial_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_42, AgradCdfTestFixture, AgradCdfNegBinomial_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_43, AgradCdfTestFixture, AgradCdfNegBinomial_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_44, AgradCdfTestFixture, AgradCdfNegBinomial_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_45, AgradCdfTestFixture, AgradCdfNegBinomial_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_46, AgradCdfTestFixture, AgradCdfNegBinomial_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_47, AgradCdfTestFixture, AgradCdfNegBinomial_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_48, AgradCdfTestFixture, AgradCdfNegBinomial_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_49, AgradCdfTestFixture, AgradCdfNegBinomial_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_50, AgradCdfTestFixture, AgradCdfNegBinomial_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_51, AgradCdfTestFixture, AgradCdfNegBinomial_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_52, AgradCdfTestFixture, AgradCdfNegBinomial_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_53, AgradCdfTestFixture, AgradCdfNegBinomial_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_54, AgradCdfTestFixture, AgradCdfNegBinomial_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_55, AgradCdfTestFixture, AgradCdfNegBinomial_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_56, AgradCdfTestFixture, AgradCdfNegBinomial_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_57, AgradCdfTestFixture, AgradCdfNegBinomial_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_58, AgradCdfTestFixture, AgradCdfNegBinomial_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_59, AgradCdfTestFixture, AgradCdfNegBinomial_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_60, AgradCdfTestFixture, AgradCdfNegBinomial_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_61, AgradCdfTestFixture, AgradCdfNegBinomial_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_62, AgradCdfTestFixture, AgradCdfNegBinomial_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_63, AgradCdfTestFixture, AgradCdfNegBinomial_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_64, AgradCdfTestFixture, AgradCdfNegBinomial_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_65, AgradCdfTestFixture, AgradCdfNegBinomial_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_66, AgradCdfTestFixture, AgradCdfNegBinomial_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_67, AgradCdfTestFixture, AgradCdfNegBinomial_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_68, AgradCdfTestFixture, AgradCdfNegBinomial_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_69, AgradCdfTestFixture, AgradCdfNegBinomial_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_70, AgradCdfTestFixture, AgradCdfNegBinomial_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_71, AgradCdfTestFixture, AgradCdfNegBinomial_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_72, AgradCdfTestFixture, AgradCdfNegBinomial_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_73, AgradCdfTestFixture, AgradCdfNegBinomial_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_74, AgradCdfTestFixture, AgradCdfNegBinomial_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_75, AgradCdfTestFixture, AgradCdfNegBinomial_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_76, AgradCdfTestFixture, AgradCdfNegBinomial_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_77, AgradCdfTestFixture, AgradCdfNegBinomial_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_78, AgradCdfTestFixture, AgradCdfNegBinomial_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_79, AgradCdfTestFixture, AgradCdfNegBinomial_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial_vv_80, AgradCdfTestFixture, AgradCdfNegBinomial_vv_80);
+
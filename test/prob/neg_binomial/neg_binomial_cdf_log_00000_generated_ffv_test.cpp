@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial/neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<int, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_0> AgradCdfLogNegBinomial_ffv_0;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_1> AgradCdfLogNegBinomial_ffv_1;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_2> AgradCdfLogNegBinomial_ffv_2;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_3> AgradCdfLogNegBinomial_ffv_3;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_4> AgradCdfLogNegBinomial_ffv_4;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_5> AgradCdfLogNegBinomial_ffv_5;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_6> AgradCdfLogNegBinomial_ffv_6;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_7> AgradCdfLogNegBinomial_ffv_7;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_8> AgradCdfLogNegBinomial_ffv_8;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_9> AgradCdfLogNegBinomial_ffv_9;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_10> AgradCdfLogNegBinomial_ffv_10;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_11> AgradCdfLogNegBinomial_ffv_11;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_12> AgradCdfLogNegBinomial_ffv_12;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_13> AgradCdfLogNegBinomial_ffv_13;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_14> AgradCdfLogNegBinomial_ffv_14;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_15> AgradCdfLogNegBinomial_ffv_15;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_16> AgradCdfLogNegBinomial_ffv_16;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_17> AgradCdfLogNegBinomial_ffv_17;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_18> AgradCdfLogNegBinomial_ffv_18;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_19> AgradCdfLogNegBinomial_ffv_19;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_20> AgradCdfLogNegBinomial_ffv_20;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_21> AgradCdfLogNegBinomial_ffv_21;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_22> AgradCdfLogNegBinomial_ffv_22;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_23> AgradCdfLogNegBinomial_ffv_23;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_24> AgradCdfLogNegBinomial_ffv_24;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_25> AgradCdfLogNegBinomial_ffv_25;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_26> AgradCdfLogNegBinomial_ffv_26;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_27> AgradCdfLogNegBinomial_ffv_27;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_28> AgradCdfLogNegBinomial_ffv_28;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_29> AgradCdfLogNegBinomial_ffv_29;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_30> AgradCdfLogNegBinomial_ffv_30;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_31> AgradCdfLogNegBinomial_ffv_31;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_32> AgradCdfLogNegBinomial_ffv_32;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_33> AgradCdfLogNegBinomial_ffv_33;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_34> AgradCdfLogNegBinomial_ffv_34;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_35> AgradCdfLogNegBinomial_ffv_35;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_36> AgradCdfLogNegBinomial_ffv_36;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_37> AgradCdfLogNegBinomial_ffv_37;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_38> AgradCdfLogNegBinomial_ffv_38;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_39> AgradCdfLogNegBinomial_ffv_39;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_40> AgradCdfLogNegBinomial_ffv_40;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_41> AgradCdfLogNegBinomial_ffv_41;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_42> AgradCdfLogNegBinomial_ffv_42;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_43> AgradCdfLogNegBinomial_ffv_43;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_44> AgradCdfLogNegBinomial_ffv_44;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_45> AgradCdfLogNegBinomial_ffv_45;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_46> AgradCdfLogNegBinomial_ffv_46;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_47> AgradCdfLogNegBinomial_ffv_47;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_48> AgradCdfLogNegBinomial_ffv_48;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_49> AgradCdfLogNegBinomial_ffv_49;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_50> AgradCdfLogNegBinomial_ffv_50;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_51> AgradCdfLogNegBinomial_ffv_51;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_52> AgradCdfLogNegBinomial_ffv_52;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_53> AgradCdfLogNegBinomial_ffv_53;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_54> AgradCdfLogNegBinomial_ffv_54;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_55> AgradCdfLogNegBinomial_ffv_55;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_56> AgradCdfLogNegBinomial_ffv_56;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_57> AgradCdfLogNegBinomial_ffv_57;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_58> AgradCdfLogNegBinomial_ffv_58;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_59> AgradCdfLogNegBinomial_ffv_59;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_60> AgradCdfLogNegBinomial_ffv_60;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_61> AgradCdfLogNegBinomial_ffv_61;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_62> AgradCdfLogNegBinomial_ffv_62;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_63> AgradCdfLogNegBinomial_ffv_63;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_64> AgradCdfLogNegBinomial_ffv_64;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_65> AgradCdfLogNegBinomial_ffv_65;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_66> AgradCdfLogNegBinomial_ffv_66;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_67> AgradCdfLogNegBinomial_ffv_67;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_68> AgradCdfLogNegBinomial_ffv_68;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_69> AgradCdfLogNegBinomial_ffv_69;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_70> AgradCdfLogNegBinomial_ffv_70;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_71> AgradCdfLogNegBinomial_ffv_71;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_72> AgradCdfLogNegBinomial_ffv_72;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_73> AgradCdfLogNegBinomial_ffv_73;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_74> AgradCdfLogNegBinomial_ffv_74;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_75> AgradCdfLogNegBinomial_ffv_75;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_76> AgradCdfLogNegBinomial_ffv_76;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_77> AgradCdfLogNegBinomial_ffv_77;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_78> AgradCdfLogNegBinomial_ffv_78;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_79> AgradCdfLogNegBinomial_ffv_79;
+typedef std::tuple<AgradCdfLogNegBinomial, type_ffv_80> AgradCdfLogNegBinomial_ffv_80;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_0, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_1, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_2, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_3, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_4, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_5, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_6, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_7, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_8, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_9, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_10, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_11, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_12, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_13, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_14, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_15, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_16, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_17, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_18, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_19, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_20, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_21, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_22, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_23, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_24, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_25, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_26, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_27, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_28, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_29, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_30, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_31, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_32, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_33, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_34, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_35, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_36, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_37, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_38, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_39, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_40, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_41, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_42, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_43, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_44, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_45, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_46, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_47, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_48, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_49, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_50, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_51, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_52, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_53, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_54, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_55, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_56, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_57, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_58, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_59, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_60, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_61, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_62, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_63, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_64, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_65, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_66, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_67, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_68, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_69, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_70, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_71, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_72, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_73, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_74, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_75, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_76, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_77, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_78, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_79, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_ffv_80, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_ffv_80);
+
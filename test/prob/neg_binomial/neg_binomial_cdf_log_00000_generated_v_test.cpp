@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial/neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<int, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<int, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<int, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<int, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<int, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<int, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<int, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<int, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<int, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<int>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<int>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<int>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<int>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_0> AgradCdfLogNegBinomial_v_0;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_1> AgradCdfLogNegBinomial_v_1;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_2> AgradCdfLogNegBinomial_v_2;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_3> AgradCdfLogNegBinomial_v_3;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_4> AgradCdfLogNegBinomial_v_4;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_5> AgradCdfLogNegBinomial_v_5;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_6> AgradCdfLogNegBinomial_v_6;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_7> AgradCdfLogNegBinomial_v_7;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_8> AgradCdfLogNegBinomial_v_8;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_9> AgradCdfLogNegBinomial_v_9;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_10> AgradCdfLogNegBinomial_v_10;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_11> AgradCdfLogNegBinomial_v_11;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_12> AgradCdfLogNegBinomial_v_12;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_13> AgradCdfLogNegBinomial_v_13;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_14> AgradCdfLogNegBinomial_v_14;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_15> AgradCdfLogNegBinomial_v_15;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_16> AgradCdfLogNegBinomial_v_16;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_17> AgradCdfLogNegBinomial_v_17;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_18> AgradCdfLogNegBinomial_v_18;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_19> AgradCdfLogNegBinomial_v_19;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_20> AgradCdfLogNegBinomial_v_20;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_21> AgradCdfLogNegBinomial_v_21;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_22> AgradCdfLogNegBinomial_v_22;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_23> AgradCdfLogNegBinomial_v_23;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_24> AgradCdfLogNegBinomial_v_24;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_25> AgradCdfLogNegBinomial_v_25;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_26> AgradCdfLogNegBinomial_v_26;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_27> AgradCdfLogNegBinomial_v_27;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_28> AgradCdfLogNegBinomial_v_28;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_29> AgradCdfLogNegBinomial_v_29;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_30> AgradCdfLogNegBinomial_v_30;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_31> AgradCdfLogNegBinomial_v_31;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_32> AgradCdfLogNegBinomial_v_32;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_33> AgradCdfLogNegBinomial_v_33;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_34> AgradCdfLogNegBinomial_v_34;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_35> AgradCdfLogNegBinomial_v_35;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_36> AgradCdfLogNegBinomial_v_36;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_37> AgradCdfLogNegBinomial_v_37;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_38> AgradCdfLogNegBinomial_v_38;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_39> AgradCdfLogNegBinomial_v_39;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_40> AgradCdfLogNegBinomial_v_40;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_41> AgradCdfLogNegBinomial_v_41;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_42> AgradCdfLogNegBinomial_v_42;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_43> AgradCdfLogNegBinomial_v_43;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_44> AgradCdfLogNegBinomial_v_44;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_45> AgradCdfLogNegBinomial_v_45;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_46> AgradCdfLogNegBinomial_v_46;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_47> AgradCdfLogNegBinomial_v_47;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_48> AgradCdfLogNegBinomial_v_48;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_49> AgradCdfLogNegBinomial_v_49;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_50> AgradCdfLogNegBinomial_v_50;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_51> AgradCdfLogNegBinomial_v_51;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_52> AgradCdfLogNegBinomial_v_52;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_53> AgradCdfLogNegBinomial_v_53;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_54> AgradCdfLogNegBinomial_v_54;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_55> AgradCdfLogNegBinomial_v_55;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_56> AgradCdfLogNegBinomial_v_56;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_57> AgradCdfLogNegBinomial_v_57;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_58> AgradCdfLogNegBinomial_v_58;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_59> AgradCdfLogNegBinomial_v_59;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_60> AgradCdfLogNegBinomial_v_60;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_61> AgradCdfLogNegBinomial_v_61;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_62> AgradCdfLogNegBinomial_v_62;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_63> AgradCdfLogNegBinomial_v_63;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_64> AgradCdfLogNegBinomial_v_64;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_65> AgradCdfLogNegBinomial_v_65;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_66> AgradCdfLogNegBinomial_v_66;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_67> AgradCdfLogNegBinomial_v_67;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_68> AgradCdfLogNegBinomial_v_68;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_69> AgradCdfLogNegBinomial_v_69;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_70> AgradCdfLogNegBinomial_v_70;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_71> AgradCdfLogNegBinomial_v_71;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_72> AgradCdfLogNegBinomial_v_72;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_73> AgradCdfLogNegBinomial_v_73;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_74> AgradCdfLogNegBinomial_v_74;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_75> AgradCdfLogNegBinomial_v_75;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_76> AgradCdfLogNegBinomial_v_76;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_77> AgradCdfLogNegBinomial_v_77;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_78> AgradCdfLogNegBinomial_v_78;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_79> AgradCdfLogNegBinomial_v_79;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_80> AgradCdfLogNegBinomial_v_80;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_81> AgradCdfLogNegBinomial_v_81;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_82> AgradCdfLogNegBinomial_v_82;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_83> AgradCdfLogNegBinomial_v_83;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_84> AgradCdfLogNegBinomial_v_84;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_85> AgradCdfLogNegBinomial_v_85;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_86> AgradCdfLogNegBinomial_v_86;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_87> AgradCdfLogNegBinomial_v_87;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_88> AgradCdfLogNegBinomial_v_88;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_89> AgradCdfLogNegBinomial_v_89;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_90> AgradCdfLogNegBinomial_v_90;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_91> AgradCdfLogNegBinomial_v_91;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_92> AgradCdfLogNegBinomial_v_92;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_93> AgradCdfLogNegBinomial_v_93;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_94> AgradCdfLogNegBinomial_v_94;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_95> AgradCdfLogNegBinomial_v_95;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_96> AgradCdfLogNegBinomial_v_96;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_97> AgradCdfLogNegBinomial_v_97;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_98> AgradCdfLogNegBinomial_v_98;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_99> AgradCdfLogNegBinomial_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_0, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_1, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_2, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_3, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_4, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_5, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_6, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_7, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_8, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_9, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_10, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_11, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_12, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_13, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_14, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_15, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_16, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_17, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_18, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_19, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_20, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_21, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_22, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_23, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_24, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_25, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_26, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_27, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_28, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_29, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_30, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_31, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_32, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_33, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_34, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_35, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_36, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_37, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_38, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_39, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_40, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_41, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_42, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_43, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_44, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_45, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_46, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_47, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_48, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_49, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_50, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_51, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_52, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_53, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_54, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_55, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_56, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_57, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_58, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_59, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_60, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_61, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_62, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_63, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_64, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_65, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_66, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_67, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_68, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_69, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_70, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_71, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_72, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_73, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_74, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_75, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_76, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_77, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_78, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_79, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_80, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_81, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_82, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_83, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_84, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_85, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_86, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_87, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_88, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_89, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_90, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_91, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_92, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_93, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_94, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_95, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_96, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_97, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_98, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_99, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_99);
+
@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial/neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<int, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<int, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<int, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<int, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<int, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<int, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<int, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<int, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<int>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<int>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<int>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_0> AgradCdfLogNegBinomial_vv_0;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_1> AgradCdfLogNegBinomial_vv_1;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_2> AgradCdfLogNegBinomial_vv_2;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_3> AgradCdfLogNegBinomial_vv_3;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_4> AgradCdfLogNegBinomial_vv_4;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_5> AgradCdfLogNegBinomial_vv_5;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_6> AgradCdfLogNegBinomial_vv_6;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_7> AgradCdfLogNegBinomial_vv_7;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_8> AgradCdfLogNegBinomial_vv_8;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_9> AgradCdfLogNegBinomial_vv_9;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_10> AgradCdfLogNegBinomial_vv_10;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_11> AgradCdfLogNegBinomial_vv_11;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_12> AgradCdfLogNegBinomial_vv_12;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_13> AgradCdfLogNegBinomial_vv_13;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_14> AgradCdfLogNegBinomial_vv_14;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_15> AgradCdfLogNegBinomial_vv_15;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_16> AgradCdfLogNegBinomial_vv_16;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_17> AgradCdfLogNegBinomial_vv_17;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_18> AgradCdfLogNegBinomial_vv_18;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_19> AgradCdfLogNegBinomial_vv_19;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_20> AgradCdfLogNegBinomial_vv_20;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_21> AgradCdfLogNegBinomial_vv_21;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_22> AgradCdfLogNegBinomial_vv_22;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_23> AgradCdfLogNegBinomial_vv_23;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_24> AgradCdfLogNegBinomial_vv_24;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_25> AgradCdfLogNegBinomial_vv_25;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_26> AgradCdfLogNegBinomial_vv_26;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_27> AgradCdfLogNegBinomial_vv_27;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_28> AgradCdfLogNegBinomial_vv_28;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_29> AgradCdfLogNegBinomial_vv_29;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_30> AgradCdfLogNegBinomial_vv_30;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_31> AgradCdfLogNegBinomial_vv_31;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_32> AgradCdfLogNegBinomial_vv_32;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_33> AgradCdfLogNegBinomial_vv_33;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_34> AgradCdfLogNegBinomial_vv_34;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_35> AgradCdfLogNegBinomial_vv_35;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_36> AgradCdfLogNegBinomial_vv_36;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_37> AgradCdfLogNegBinomial_vv_37;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_38> AgradCdfLogNegBinomial_vv_38;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_39> AgradCdfLogNegBinomial_vv_39;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_40> AgradCdfLogNegBinomial_vv_40;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_41> AgradCdfLogNegBinomial_vv_41;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_42> AgradCdfLogNegBinomial_vv_42;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_43> AgradCdfLogNegBinomial_vv_43;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_44> AgradCdfLogNegBinomial_vv_44;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_45> AgradCdfLogNegBinomial_vv_45;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_46> AgradCdfLogNegBinomial_vv_46;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_47> AgradCdfLogNegBinomial_vv_47;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_48> AgradCdfLogNegBinomial_vv_48;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_49> AgradCdfLogNegBinomial_vv_49;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_50> AgradCdfLogNegBinomial_vv_50;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_51> AgradCdfLogNegBinomial_vv_51;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_52> AgradCdfLogNegBinomial_vv_52;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_53> AgradCdfLogNegBinomial_vv_53;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_54> AgradCdfLogNegBinomial_vv_54;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_55> AgradCdfLogNegBinomial_vv_55;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_56> AgradCdfLogNegBinomial_vv_56;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_57> AgradCdfLogNegBinomial_vv_57;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_58> AgradCdfLogNegBinomial_vv_58;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_59> AgradCdfLogNegBinomial_vv_59;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_60> AgradCdfLogNegBinomial_vv_60;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_61> AgradCdfLogNegBinomial_vv_61;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_62> AgradCdfLogNegBinomial_vv_62;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_63> AgradCdfLogNegBinomial_vv_63;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_64> AgradCdfLogNegBinomial_vv_64;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_65> AgradCdfLogNegBinomial_vv_65;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_66> AgradCdfLogNegBinomial_vv_66;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_67> AgradCdfLogNegBinomial_vv_67;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_68> AgradCdfLogNegBinomial_vv_68;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_69> AgradCdfLogNegBinomial_vv_69;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_70> AgradCdfLogNegBinomial_vv_70;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_71> AgradCdfLogNegBinomial_vv_71;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_72> AgradCdfLogNegBinomial_vv_72;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_73> AgradCdfLogNegBinomial_vv_73;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_74> AgradCdfLogNegBinomial_vv_74;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_75> AgradCdfLogNegBinomial_vv_75;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_76> AgradCdfLogNegBinomial_vv_76;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_77> AgradCdfLogNegBinomial_vv_77;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_78> AgradCdfLogNegBinomial_vv_78;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_79> AgradCdfLogNegBinomial_vv_79;
+typedef std::tuple<AgradCdfLogNegBinomial, type_vv_80> AgradCdfLogNegBinomial_vv_80;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_0, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_1, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_2, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_3, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_4, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_5, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_6, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_7, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_8, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_9, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_10, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_11, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_12, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_13, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_14, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_15, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_16, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_17, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_18, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_19, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_20, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_21, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_22, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_23, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_24, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_25, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_26, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_27, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_28, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_29, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_30, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_31, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_32, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_33, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_34, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_35, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_36, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_37, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_38, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_39, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_40, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_41, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_42, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_43, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_44, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_45, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_46, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_47, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_48, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_49, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_50, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_51, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_52, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_53, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_54, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_55, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_56, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_57, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_58, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_59, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_60, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_61, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_62, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_63, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_64, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_65, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_66, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_67, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_68, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_69, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_70, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_71, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_72, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_73, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_74, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_75, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_76, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_77, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_78, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_79, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_vv_80, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_vv_80);
+
@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial/neg_binomial_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_100> AgradCdfLogNegBinomial_v_100;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_101> AgradCdfLogNegBinomial_v_101;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_102> AgradCdfLogNegBinomial_v_102;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_103> AgradCdfLogNegBinomial_v_103;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_104> AgradCdfLogNegBinomial_v_104;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_105> AgradCdfLogNegBinomial_v_105;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_106> AgradCdfLogNegBinomial_v_106;
+typedef std::tuple<AgradCdfLogNegBinomial, type_v_107> AgradCdfLogNegBinomial_v_107;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_100, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_101, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_102, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_103, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_104, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_105, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_106, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial_v_107, AgradCdfLogTestFixture, AgradCdfLogNegBinomial_v_107);
+
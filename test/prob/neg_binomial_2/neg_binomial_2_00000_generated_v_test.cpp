@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial_2/neg_binomial_2_test.hpp>
+
+typedef std::tuple<int, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<int, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<int, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<int, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<int, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<int, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<int, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<int, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<int, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<int, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<int>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<int>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<int>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<int>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_0> AgradDistributionsNegBinomial2_v_0;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_1> AgradDistributionsNegBinomial2_v_1;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_2> AgradDistributionsNegBinomial2_v_2;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_3> AgradDistributionsNegBinomial2_v_3;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_4> AgradDistributionsNegBinomial2_v_4;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_5> AgradDistributionsNegBinomial2_v_5;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_6> AgradDistributionsNegBinomial2_v_6;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_7> AgradDistributionsNegBinomial2_v_7;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_8> AgradDistributionsNegBinomial2_v_8;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_9> AgradDistributionsNegBinomial2_v_9;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_10> AgradDistributionsNegBinomial2_v_10;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_11> AgradDistributionsNegBinomial2_v_11;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_12> AgradDistributionsNegBinomial2_v_12;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_13> AgradDistributionsNegBinomial2_v_13;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_14> AgradDistributionsNegBinomial2_v_14;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_15> AgradDistributionsNegBinomial2_v_15;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_16> AgradDistributionsNegBinomial2_v_16;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_17> AgradDistributionsNegBinomial2_v_17;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_18> AgradDistributionsNegBinomial2_v_18;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_19> AgradDistributionsNegBinomial2_v_19;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_20> AgradDistributionsNegBinomial2_v_20;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_21> AgradDistributionsNegBinomial2_v_21;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_22> AgradDistributionsNegBinomial2_v_22;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_23> AgradDistributionsNegBinomial2_v_23;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_24> AgradDistributionsNegBinomial2_v_24;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_25> AgradDistributionsNegBinomial2_v_25;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_26> AgradDistributionsNegBinomial2_v_26;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_27> AgradDistributionsNegBinomial2_v_27;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_28> AgradDistributionsNegBinomial2_v_28;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_29> AgradDistributionsNegBinomial2_v_29;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_30> AgradDistributionsNegBinomial2_v_30;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_31> AgradDistributionsNegBinomial2_v_31;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_32> AgradDistributionsNegBinomial2_v_32;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_33> AgradDistributionsNegBinomial2_v_33;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_34> AgradDistributionsNegBinomial2_v_34;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_35> AgradDistributionsNegBinomial2_v_35;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_36> AgradDistributionsNegBinomial2_v_36;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_37> AgradDistributionsNegBinomial2_v_37;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_38> AgradDistributionsNegBinomial2_v_38;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_39> AgradDistributionsNegBinomial2_v_39;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_40> AgradDistributionsNegBinomial2_v_40;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_41> AgradDistributionsNegBinomial2_v_41;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_42> AgradDistributionsNegBinomial2_v_42;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_43> AgradDistributionsNegBinomial2_v_43;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_44> AgradDistributionsNegBinomial2_v_44;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_45> AgradDistributionsNegBinomial2_v_45;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_46> AgradDistributionsNegBinomial2_v_46;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_47> AgradDistributionsNegBinomial2_v_47;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_48> AgradDistributionsNegBinomial2_v_48;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_49> AgradDistributionsNegBinomial2_v_49;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_50> AgradDistributionsNegBinomial2_v_50;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_51> AgradDistributionsNegBinomial2_v_51;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_52> AgradDistributionsNegBinomial2_v_52;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_53> AgradDistributionsNegBinomial2_v_53;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_54> AgradDistributionsNegBinomial2_v_54;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_55> AgradDistributionsNegBinomial2_v_55;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_56> AgradDistributionsNegBinomial2_v_56;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_57> AgradDistributionsNegBinomial2_v_57;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_58> AgradDistributionsNegBinomial2_v_58;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_59> AgradDistributionsNegBinomial2_v_59;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_60> AgradDistributionsNegBinomial2_v_60;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_61> AgradDistributionsNegBinomial2_v_61;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_62> AgradDistributionsNegBinomial2_v_62;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_63> AgradDistributionsNegBinomial2_v_63;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_64> AgradDistributionsNegBinomial2_v_64;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_65> AgradDistributionsNegBinomial2_v_65;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_66> AgradDistributionsNegBinomial2_v_66;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_67> AgradDistributionsNegBinomial2_v_67;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_68> AgradDistributionsNegBinomial2_v_68;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_69> AgradDistributionsNegBinomial2_v_69;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_70> AgradDistributionsNegBinomial2_v_70;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_71> AgradDistributionsNegBinomial2_v_71;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_72> AgradDistributionsNegBinomial2_v_72;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_73> AgradDistributionsNegBinomial2_v_73;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_74> AgradDistributionsNegBinomial2_v_74;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_75> AgradDistributionsNegBinomial2_v_75;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_76> AgradDistributionsNegBinomial2_v_76;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_77> AgradDistributionsNegBinomial2_v_77;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_78> AgradDistributionsNegBinomial2_v_78;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_79> AgradDistributionsNegBinomial2_v_79;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_80> AgradDistributionsNegBinomial2_v_80;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_81> AgradDistributionsNegBinomial2_v_81;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_82> AgradDistributionsNegBinomial2_v_82;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_83> AgradDistributionsNegBinomial2_v_83;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_84> AgradDistributionsNegBinomial2_v_84;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_85> AgradDistributionsNegBinomial2_v_85;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_86> AgradDistributionsNegBinomial2_v_86;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_87> AgradDistributionsNegBinomial2_v_87;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_88> AgradDistributionsNegBinomial2_v_88;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_89> AgradDistributionsNegBinomial2_v_89;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_90> AgradDistributionsNegBinomial2_v_90;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_91> AgradDistributionsNegBinomial2_v_91;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_92> AgradDistributionsNegBinomial2_v_92;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_93> AgradDistributionsNegBinomial2_v_93;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_94> AgradDistributionsNegBinomial2_v_94;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_95> AgradDistributionsNegBinomial2_v_95;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_96> AgradDistributionsNegBinomial2_v_96;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_97> AgradDistributionsNegBinomial2_v_97;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_98> AgradDistributionsNegBinomial2_v_98;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_v_99> AgradDistributionsNegBinomial2_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_0, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_1, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_2, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_3, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_4, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_5, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_6, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_7, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_8, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_9, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_10, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_11, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_12, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_13, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_14, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_15, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_16, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_17, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_18, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_19, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_20, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_21, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_22, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_23, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_24, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_25, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_26, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_27, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_28, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_29, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_30, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_31, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_32, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_33, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_34, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_35, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_36, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_37, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_38, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_39, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_40, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_41, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_42, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_43, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_44, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_45, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_46, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_47, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_48, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_49, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_50, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_51, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_52, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_53, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_54, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_55, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_56, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_57, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_58, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_59, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_60, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_61, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_62, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_63, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_64, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_65, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_66, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_67, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_68, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_69, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_70, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_71, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_72, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_73, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_74, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_75, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_76, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_77, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_78, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_79, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_80, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_81, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_82, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_83, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_84, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_85, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_86, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_87, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_88, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_89, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_90, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_91, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_92, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_93, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_94, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_95, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_96, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_97, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_98, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_v_99, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_v_99);
+
@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial_2/neg_binomial_2_test.hpp>
+
+typedef std::tuple<int, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<int, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<int, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<int, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<int, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<int, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<int, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<int, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<int>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<int>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<int>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_0> AgradDistributionsNegBinomial2_vv_0;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_1> AgradDistributionsNegBinomial2_vv_1;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_2> AgradDistributionsNegBinomial2_vv_2;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_3> AgradDistributionsNegBinomial2_vv_3;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_4> AgradDistributionsNegBinomial2_vv_4;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_5> AgradDistributionsNegBinomial2_vv_5;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_6> AgradDistributionsNegBinomial2_vv_6;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_7> AgradDistributionsNegBinomial2_vv_7;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_8> AgradDistributionsNegBinomial2_vv_8;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_9> AgradDistributionsNegBinomial2_vv_9;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_10> AgradDistributionsNegBinomial2_vv_10;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_11> AgradDistributionsNegBinomial2_vv_11;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_12> AgradDistributionsNegBinomial2_vv_12;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_13> AgradDistributionsNegBinomial2_vv_13;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_14> AgradDistributionsNegBinomial2_vv_14;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_15> AgradDistributionsNegBinomial2_vv_15;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_16> AgradDistributionsNegBinomial2_vv_16;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_17> AgradDistributionsNegBinomial2_vv_17;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_18> AgradDistributionsNegBinomial2_vv_18;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_19> AgradDistributionsNegBinomial2_vv_19;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_20> AgradDistributionsNegBinomial2_vv_20;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_21> AgradDistributionsNegBinomial2_vv_21;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_22> AgradDistributionsNegBinomial2_vv_22;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_23> AgradDistributionsNegBinomial2_vv_23;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_24> AgradDistributionsNegBinomial2_vv_24;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_25> AgradDistributionsNegBinomial2_vv_25;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_26> AgradDistributionsNegBinomial2_vv_26;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_27> AgradDistributionsNegBinomial2_vv_27;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_28> AgradDistributionsNegBinomial2_vv_28;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_29> AgradDistributionsNegBinomial2_vv_29;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_30> AgradDistributionsNegBinomial2_vv_30;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_31> AgradDistributionsNegBinomial2_vv_31;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_32> AgradDistributionsNegBinomial2_vv_32;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_33> AgradDistributionsNegBinomial2_vv_33;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_34> AgradDistributionsNegBinomial2_vv_34;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_35> AgradDistributionsNegBinomial2_vv_35;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_36> AgradDistributionsNegBinomial2_vv_36;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_37> AgradDistributionsNegBinomial2_vv_37;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_38> AgradDistributionsNegBinomial2_vv_38;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_39> AgradDistributionsNegBinomial2_vv_39;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_40> AgradDistributionsNegBinomial2_vv_40;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_41> AgradDistributionsNegBinomial2_vv_41;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_42> AgradDistributionsNegBinomial2_vv_42;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_43> AgradDistributionsNegBinomial2_vv_43;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_44> AgradDistributionsNegBinomial2_vv_44;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_45> AgradDistributionsNegBinomial2_vv_45;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_46> AgradDistributionsNegBinomial2_vv_46;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_47> AgradDistributionsNegBinomial2_vv_47;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_48> AgradDistributionsNegBinomial2_vv_48;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_49> AgradDistributionsNegBinomial2_vv_49;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_50> AgradDistributionsNegBinomial2_vv_50;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_51> AgradDistributionsNegBinomial2_vv_51;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_52> AgradDistributionsNegBinomial2_vv_52;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_53> AgradDistributionsNegBinomial2_vv_53;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_54> AgradDistributionsNegBinomial2_vv_54;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_55> AgradDistributionsNegBinomial2_vv_55;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_56> AgradDistributionsNegBinomial2_vv_56;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_57> AgradDistributionsNegBinomial2_vv_57;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_58> AgradDistributionsNegBinomial2_vv_58;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_59> AgradDistributionsNegBinomial2_vv_59;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_60> AgradDistributionsNegBinomial2_vv_60;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_61> AgradDistributionsNegBinomial2_vv_61;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_62> AgradDistributionsNegBinomial2_vv_62;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_63> AgradDistributionsNegBinomial2_vv_63;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_64> AgradDistributionsNegBinomial2_vv_64;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_65> AgradDistributionsNegBinomial2_vv_65;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_66> AgradDistributionsNegBinomial2_vv_66;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_67> AgradDistributionsNegBinomial2_vv_67;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_68> AgradDistributionsNegBinomial2_vv_68;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_69> AgradDistributionsNegBinomial2_vv_69;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_70> AgradDistributionsNegBinomial2_vv_70;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_71> AgradDistributionsNegBinomial2_vv_71;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_72> AgradDistributionsNegBinomial2_vv_72;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_73> AgradDistributionsNegBinomial2_vv_73;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_74> AgradDistributionsNegBinomial2_vv_74;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_75> AgradDistributionsNegBinomial2_vv_75;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_76> AgradDistributionsNegBinomial2_vv_76;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_77> AgradDistributionsNegBinomial2_vv_77;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_78> AgradDistributionsNegBinomial2_vv_78;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_79> AgradDistributionsNegBinomial2_vv_79;
+typedef std::tuple<AgradDistributionsNegBinomial2, type_vv_80> AgradDistributionsNegBinomial2_vv_80;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_0, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_1, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_2, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_3, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_4, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_5, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_6, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_7, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_8, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_9, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_10, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_11, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_12, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_13, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_14, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_15, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_16, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_17, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_18, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_19, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_20, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_21, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_22, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_23, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_24, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_25, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_26, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_27, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_28, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_29, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_30, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_31, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_32, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_33, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_34, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_35, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_36, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_37, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_38, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_39, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_40, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_41, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_42, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_43, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_44, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_45, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_46, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_47, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_48, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_49, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_50, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_51, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_52, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_53, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_54, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_55, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_56, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_57, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_58, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_59, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_60, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_61, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_62, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_63, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_64, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_65, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_66, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_67, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_68, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_69, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_70, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_71, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_72, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_73, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_74, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_75, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_76, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_77, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_78, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_79, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2_vv_80, AgradDistributionTestFixture, AgradDistributionsNegBinomial2_vv_80);
+
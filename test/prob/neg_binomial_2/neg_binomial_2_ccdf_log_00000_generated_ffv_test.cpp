@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial_2/neg_binomial_2_ccdf_log_test.hpp>
+
+typedef std::tuple<int, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<int, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_0> AgradCdfLogNegBinomial2_ffv_0;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_1> AgradCdfLogNegBinomial2_ffv_1;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_2> AgradCdfLogNegBinomial2_ffv_2;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_3> AgradCdfLogNegBinomial2_ffv_3;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_4> AgradCdfLogNegBinomial2_ffv_4;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_5> AgradCdfLogNegBinomial2_ffv_5;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_6> AgradCdfLogNegBinomial2_ffv_6;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_7> AgradCdfLogNegBinomial2_ffv_7;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_8> AgradCdfLogNegBinomial2_ffv_8;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_9> AgradCdfLogNegBinomial2_ffv_9;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_10> AgradCdfLogNegBinomial2_ffv_10;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_11> AgradCdfLogNegBinomial2_ffv_11;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_12> AgradCdfLogNegBinomial2_ffv_12;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_13> AgradCdfLogNegBinomial2_ffv_13;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_14> AgradCdfLogNegBinomial2_ffv_14;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_15> AgradCdfLogNegBinomial2_ffv_15;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_16> AgradCdfLogNegBinomial2_ffv_16;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_17> AgradCdfLogNegBinomial2_ffv_17;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_18> AgradCdfLogNegBinomial2_ffv_18;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_19> AgradCdfLogNegBinomial2_ffv_19;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_20> AgradCdfLogNegBinomial2_ffv_20;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_21> AgradCdfLogNegBinomial2_ffv_21;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_22> AgradCdfLogNegBinomial2_ffv_22;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_23> AgradCdfLogNegBinomial2_ffv_23;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_24> AgradCdfLogNegBinomial2_ffv_24;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_25> AgradCdfLogNegBinomial2_ffv_25;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_26> AgradCdfLogNegBinomial2_ffv_26;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_27> AgradCdfLogNegBinomial2_ffv_27;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_28> AgradCdfLogNegBinomial2_ffv_28;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_29> AgradCdfLogNegBinomial2_ffv_29;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_30> AgradCdfLogNegBinomial2_ffv_30;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_31> AgradCdfLogNegBinomial2_ffv_31;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_32> AgradCdfLogNegBinomial2_ffv_32;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_33> AgradCdfLogNegBinomial2_ffv_33;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_34> AgradCdfLogNegBinomial2_ffv_34;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_35> AgradCdfLogNegBinomial2_ffv_35;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_36> AgradCdfLogNegBinomial2_ffv_36;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_37> AgradCdfLogNegBinomial2_ffv_37;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_38> AgradCdfLogNegBinomial2_ffv_38;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_39> AgradCdfLogNegBinomial2_ffv_39;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_40> AgradCdfLogNegBinomial2_ffv_40;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_41> AgradCdfLogNegBinomial2_ffv_41;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_42> AgradCdfLogNegBinomial2_ffv_42;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_43> AgradCdfLogNegBinomial2_ffv_43;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_44> AgradCdfLogNegBinomial2_ffv_44;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_45> AgradCdfLogNegBinomial2_ffv_45;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_46> AgradCdfLogNegBinomial2_ffv_46;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_47> AgradCdfLogNegBinomial2_ffv_47;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_48> AgradCdfLogNegBinomial2_ffv_48;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_49> AgradCdfLogNegBinomial2_ffv_49;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_50> AgradCdfLogNegBinomial2_ffv_50;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_51> AgradCdfLogNegBinomial2_ffv_51;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_52> AgradCdfLogNegBinomial2_ffv_52;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_53> AgradCdfLogNegBinomial2_ffv_53;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_54> AgradCdfLogNegBinomial2_ffv_54;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_55> AgradCdfLogNegBinomial2_ffv_55;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_56> AgradCdfLogNegBinomial2_ffv_56;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_57> AgradCdfLogNegBinomial2_ffv_57;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_58> AgradCdfLogNegBinomial2_ffv_58;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_59> AgradCdfLogNegBinomial2_ffv_59;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_60> AgradCdfLogNegBinomial2_ffv_60;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_61> AgradCdfLogNegBinomial2_ffv_61;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_62> AgradCdfLogNegBinomial2_ffv_62;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_63> AgradCdfLogNegBinomial2_ffv_63;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_64> AgradCdfLogNegBinomial2_ffv_64;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_65> AgradCdfLogNegBinomial2_ffv_65;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_66> AgradCdfLogNegBinomial2_ffv_66;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_67> AgradCdfLogNegBinomial2_ffv_67;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_68> AgradCdfLogNegBinomial2_ffv_68;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_69> AgradCdfLogNegBinomial2_ffv_69;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_70> AgradCdfLogNegBinomial2_ffv_70;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_71> AgradCdfLogNegBinomial2_ffv_71;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_72> AgradCdfLogNegBinomial2_ffv_72;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_73> AgradCdfLogNegBinomial2_ffv_73;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_74> AgradCdfLogNegBinomial2_ffv_74;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_75> AgradCdfLogNegBinomial2_ffv_75;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_76> AgradCdfLogNegBinomial2_ffv_76;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_77> AgradCdfLogNegBinomial2_ffv_77;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_78> AgradCdfLogNegBinomial2_ffv_78;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_79> AgradCdfLogNegBinomial2_ffv_79;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_ffv_80> AgradCdfLogNegBinomial2_ffv_80;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_0, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_1, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_2, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_3, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_4, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_5, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_6, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_7, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_8, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_9, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_10, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_11, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_12, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_13, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_14, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_15, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_16, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_17, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_18, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_19, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_20, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_21, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_22, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_23, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_24, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_25, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_26, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_27, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_28, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_29, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_30, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_31, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_32, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_33, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_34, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_35, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_36, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_37, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_38, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_39, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_40, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_41, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_42, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_43, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_44, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_45, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_46, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_47, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_48, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_49, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_50, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_51, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_52, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_53, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_54, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_55, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_56, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_57, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_58, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_59, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_60, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_61, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_62, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_63, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_64, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_65, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_66, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_67, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_68, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_69, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_70, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_71, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_72, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_73, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_74, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_75, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_76, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_77, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_78, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_79, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_ffv_80, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_ffv_80);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial_2/neg_binomial_2_ccdf_log_test.hpp>
+
+typedef std::tuple<int, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<int, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<int, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<int, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<int, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<int, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<int, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<int, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<int, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<int, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<int>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<int>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<int>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<int>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_0> AgradCdfLogNegBinomial2_v_0;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_1> AgradCdfLogNegBinomial2_v_1;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_2> AgradCdfLogNegBinomial2_v_2;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_3> AgradCdfLogNegBinomial2_v_3;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_4> AgradCdfLogNegBinomial2_v_4;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_5> AgradCdfLogNegBinomial2_v_5;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_6> AgradCdfLogNegBinomial2_v_6;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_7> AgradCdfLogNegBinomial2_v_7;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_8> AgradCdfLogNegBinomial2_v_8;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_9> AgradCdfLogNegBinomial2_v_9;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_10> AgradCdfLogNegBinomial2_v_10;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_11> AgradCdfLogNegBinomial2_v_11;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_12> AgradCdfLogNegBinomial2_v_12;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_13> AgradCdfLogNegBinomial2_v_13;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_14> AgradCdfLogNegBinomial2_v_14;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_15> AgradCdfLogNegBinomial2_v_15;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_16> AgradCdfLogNegBinomial2_v_16;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_17> AgradCdfLogNegBinomial2_v_17;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_18> AgradCdfLogNegBinomial2_v_18;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_19> AgradCdfLogNegBinomial2_v_19;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_20> AgradCdfLogNegBinomial2_v_20;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_21> AgradCdfLogNegBinomial2_v_21;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_22> AgradCdfLogNegBinomial2_v_22;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_23> AgradCdfLogNegBinomial2_v_23;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_24> AgradCdfLogNegBinomial2_v_24;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_25> AgradCdfLogNegBinomial2_v_25;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_26> AgradCdfLogNegBinomial2_v_26;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_27> AgradCdfLogNegBinomial2_v_27;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_28> AgradCdfLogNegBinomial2_v_28;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_29> AgradCdfLogNegBinomial2_v_29;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_30> AgradCdfLogNegBinomial2_v_30;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_31> AgradCdfLogNegBinomial2_v_31;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_32> AgradCdfLogNegBinomial2_v_32;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_33> AgradCdfLogNegBinomial2_v_33;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_34> AgradCdfLogNegBinomial2_v_34;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_35> AgradCdfLogNegBinomial2_v_35;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_36> AgradCdfLogNegBinomial2_v_36;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_37> AgradCdfLogNegBinomial2_v_37;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_38> AgradCdfLogNegBinomial2_v_38;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_39> AgradCdfLogNegBinomial2_v_39;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_40> AgradCdfLogNegBinomial2_v_40;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_41> AgradCdfLogNegBinomial2_v_41;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_42> AgradCdfLogNegBinomial2_v_42;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_43> AgradCdfLogNegBinomial2_v_43;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_44> AgradCdfLogNegBinomial2_v_44;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_45> AgradCdfLogNegBinomial2_v_45;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_46> AgradCdfLogNegBinomial2_v_46;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_47> AgradCdfLogNegBinomial2_v_47;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_48> AgradCdfLogNegBinomial2_v_48;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_49> AgradCdfLogNegBinomial2_v_49;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_50> AgradCdfLogNegBinomial2_v_50;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_51> AgradCdfLogNegBinomial2_v_51;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_52> AgradCdfLogNegBinomial2_v_52;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_53> AgradCdfLogNegBinomial2_v_53;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_54> AgradCdfLogNegBinomial2_v_54;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_55> AgradCdfLogNegBinomial2_v_55;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_56> AgradCdfLogNegBinomial2_v_56;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_57> AgradCdfLogNegBinomial2_v_57;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_58> AgradCdfLogNegBinomial2_v_58;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_59> AgradCdfLogNegBinomial2_v_59;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_60> AgradCdfLogNegBinomial2_v_60;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_61> AgradCdfLogNegBinomial2_v_61;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_62> AgradCdfLogNegBinomial2_v_62;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_63> AgradCdfLogNegBinomial2_v_63;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_64> AgradCdfLogNegBinomial2_v_64;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_65> AgradCdfLogNegBinomial2_v_65;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_66> AgradCdfLogNegBinomial2_v_66;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_67> AgradCdfLogNegBinomial2_v_67;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_68> AgradCdfLogNegBinomial2_v_68;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_69> AgradCdfLogNegBinomial2_v_69;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_70> AgradCdfLogNegBinomial2_v_70;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_71> AgradCdfLogNegBinomial2_v_71;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_72> AgradCdfLogNegBinomial2_v_72;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_73> AgradCdfLogNegBinomial2_v_73;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_74> AgradCdfLogNegBinomial2_v_74;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_75> AgradCdfLogNegBinomial2_v_75;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_76> AgradCdfLogNegBinomial2_v_76;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_77> AgradCdfLogNegBinomial2_v_77;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_78> AgradCdfLogNegBinomial2_v_78;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_79> AgradCdfLogNegBinomial2_v_79;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_80> AgradCdfLogNegBinomial2_v_80;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_81> AgradCdfLogNegBinomial2_v_81;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_82> AgradCdfLogNegBinomial2_v_82;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_83> AgradCdfLogNegBinomial2_v_83;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_84> AgradCdfLogNegBinomial2_v_84;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_85> AgradCdfLogNegBinomial2_v_85;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_86> AgradCdfLogNegBinomial2_v_86;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_87> AgradCdfLogNegBinomial2_v_87;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_88> AgradCdfLogNegBinomial2_v_88;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_89> AgradCdfLogNegBinomial2_v_89;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_90> AgradCdfLogNegBinomial2_v_90;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_91> AgradCdfLogNegBinomial2_v_91;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_92> AgradCdfLogNegBinomial2_v_92;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_93> AgradCdfLogNegBinomial2_v_93;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_94> AgradCdfLogNegBinomial2_v_94;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_95> AgradCdfLogNegBinomial2_v_95;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_96> AgradCdfLogNegBinomial2_v_96;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_97> AgradCdfLogNegBinomial2_v_97;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_98> AgradCdfLogNegBinomial2_v_98;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_v_99> AgradCdfLogNegBinomial2_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_0, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_1, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_2, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_3, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_4, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_5, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_6, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_7, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_8, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_9, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_10, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_11, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_12, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_13, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_14, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_15, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_16, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_17, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_18, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_19, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_20, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_21, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_22, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_23, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_24, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_25, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_26, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_27, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_28, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_29, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_30, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_31, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_32, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_33, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_34, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_35, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_36, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_37, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_38, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_39, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_40, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_41, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_42, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_43, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_44, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_45, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_46, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_47, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_48, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_49, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_50, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_51, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_52, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_53, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_54, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_55, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_56, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_57, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_58, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_59, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_60, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_61, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_62, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_63, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_64, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_65, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_66, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_67, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_68, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_69, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_70, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_71, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_72, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_73, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_74, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_75, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_76, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_77, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_78, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_79, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_80, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_81, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_82, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_83, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_84, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_85, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_86, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_87, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_88, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_89, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_90, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_91, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_92, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_93, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_94, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_95, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_96, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_97, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_98, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_v_99, AgradCcdfLogTestFixture, AgradCdfLogNegBinomial2_v_99);
+
@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial_2/neg_binomial_2_cdf_test.hpp>
+
+typedef std::tuple<int, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<int, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<int, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<int, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<int>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_0> AgradCdfNegBinomial2_ffv_0;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_1> AgradCdfNegBinomial2_ffv_1;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_2> AgradCdfNegBinomial2_ffv_2;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_3> AgradCdfNegBinomial2_ffv_3;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_4> AgradCdfNegBinomial2_ffv_4;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_5> AgradCdfNegBinomial2_ffv_5;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_6> AgradCdfNegBinomial2_ffv_6;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_7> AgradCdfNegBinomial2_ffv_7;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_8> AgradCdfNegBinomial2_ffv_8;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_9> AgradCdfNegBinomial2_ffv_9;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_10> AgradCdfNegBinomial2_ffv_10;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_11> AgradCdfNegBinomial2_ffv_11;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_12> AgradCdfNegBinomial2_ffv_12;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_13> AgradCdfNegBinomial2_ffv_13;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_14> AgradCdfNegBinomial2_ffv_14;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_15> AgradCdfNegBinomial2_ffv_15;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_16> AgradCdfNegBinomial2_ffv_16;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_17> AgradCdfNegBinomial2_ffv_17;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_18> AgradCdfNegBinomial2_ffv_18;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_19> AgradCdfNegBinomial2_ffv_19;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_20> AgradCdfNegBinomial2_ffv_20;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_21> AgradCdfNegBinomial2_ffv_21;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_22> AgradCdfNegBinomial2_ffv_22;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_23> AgradCdfNegBinomial2_ffv_23;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_24> AgradCdfNegBinomial2_ffv_24;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_25> AgradCdfNegBinomial2_ffv_25;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_26> AgradCdfNegBinomial2_ffv_26;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_27> AgradCdfNegBinomial2_ffv_27;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_28> AgradCdfNegBinomial2_ffv_28;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_29> AgradCdfNegBinomial2_ffv_29;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_30> AgradCdfNegBinomial2_ffv_30;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_31> AgradCdfNegBinomial2_ffv_31;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_32> AgradCdfNegBinomial2_ffv_32;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_33> AgradCdfNegBinomial2_ffv_33;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_34> AgradCdfNegBinomial2_ffv_34;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_35> AgradCdfNegBinomial2_ffv_35;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_36> AgradCdfNegBinomial2_ffv_36;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_37> AgradCdfNegBinomial2_ffv_37;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_38> AgradCdfNegBinomial2_ffv_38;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_39> AgradCdfNegBinomial2_ffv_39;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_40> AgradCdfNegBinomial2_ffv_40;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_41> AgradCdfNegBinomial2_ffv_41;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_42> AgradCdfNegBinomial2_ffv_42;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_43> AgradCdfNegBinomial2_ffv_43;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_44> AgradCdfNegBinomial2_ffv_44;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_45> AgradCdfNegBinomial2_ffv_45;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_46> AgradCdfNegBinomial2_ffv_46;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_47> AgradCdfNegBinomial2_ffv_47;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_48> AgradCdfNegBinomial2_ffv_48;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_49> AgradCdfNegBinomial2_ffv_49;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_50> AgradCdfNegBinomial2_ffv_50;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_51> AgradCdfNegBinomial2_ffv_51;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_52> AgradCdfNegBinomial2_ffv_52;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_53> AgradCdfNegBinomial2_ffv_53;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_54> AgradCdfNegBinomial2_ffv_54;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_55> AgradCdfNegBinomial2_ffv_55;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_56> AgradCdfNegBinomial2_ffv_56;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_57> AgradCdfNegBinomial2_ffv_57;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_58> AgradCdfNegBinomial2_ffv_58;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_59> AgradCdfNegBinomial2_ffv_59;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_60> AgradCdfNegBinomial2_ffv_60;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_61> AgradCdfNegBinomial2_ffv_61;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_62> AgradCdfNegBinomial2_ffv_62;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_63> AgradCdfNegBinomial2_ffv_63;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_64> AgradCdfNegBinomial2_ffv_64;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_65> AgradCdfNegBinomial2_ffv_65;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_66> AgradCdfNegBinomial2_ffv_66;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_67> AgradCdfNegBinomial2_ffv_67;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_68> AgradCdfNegBinomial2_ffv_68;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_69> AgradCdfNegBinomial2_ffv_69;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_70> AgradCdfNegBinomial2_ffv_70;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_71> AgradCdfNegBinomial2_ffv_71;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_72> AgradCdfNegBinomial2_ffv_72;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_73> AgradCdfNegBinomial2_ffv_73;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_74> AgradCdfNegBinomial2_ffv_74;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_75> AgradCdfNegBinomial2_ffv_75;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_76> AgradCdfNegBinomial2_ffv_76;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_77> AgradCdfNegBinomial2_ffv_77;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_78> AgradCdfNegBinomial2_ffv_78;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_79> AgradCdfNegBinomial2_ffv_79;
+typedef std::tuple<AgradCdfNegBinomial2, type_ffv_80> AgradCdfNegBinomial2_ffv_80;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_0, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_1, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_2, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_3, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_4, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_5, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_6, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_7, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_8, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_9, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_10, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_11, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_12, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_13, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_14, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_15, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_16, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_17, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_18, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_19, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_20, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_21, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_22, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_23, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_24, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_25, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_26, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_27, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_28, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_29, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_30, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_31, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_32, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_33, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_34, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_35, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_36, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_37, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_38, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_39, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_40, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_41, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_42, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_43, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_44, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_45, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_46, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_47, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_48, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_49, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_50, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_51, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_52, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_53, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_54, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_55, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_56, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_57, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_58, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_59, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_60, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_61, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_62, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_63, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_64, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_65, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_66, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_67, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_68, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_69, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_70, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_71, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_72, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_73, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_74, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_75, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_76, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_77, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_78, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_79, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_ffv_80, AgradCdfTestFixture, AgradCdfNegBinomial2_ffv_80);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial_2/neg_binomial_2_cdf_test.hpp>
+
+typedef std::tuple<int, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<int, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<int, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<int, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<int, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<int, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<int, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<int, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<int, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<int, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<int, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<int, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<int, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<int>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<int>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<int>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<int>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<int>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<int>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfNegBinomial2, type_v_0> AgradCdfNegBinomial2_v_0;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_1> AgradCdfNegBinomial2_v_1;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_2> AgradCdfNegBinomial2_v_2;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_3> AgradCdfNegBinomial2_v_3;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_4> AgradCdfNegBinomial2_v_4;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_5> AgradCdfNegBinomial2_v_5;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_6> AgradCdfNegBinomial2_v_6;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_7> AgradCdfNegBinomial2_v_7;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_8> AgradCdfNegBinomial2_v_8;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_9> AgradCdfNegBinomial2_v_9;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_10> AgradCdfNegBinomial2_v_10;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_11> AgradCdfNegBinomial2_v_11;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_12> AgradCdfNegBinomial2_v_12;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_13> AgradCdfNegBinomial2_v_13;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_14> AgradCdfNegBinomial2_v_14;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_15> AgradCdfNegBinomial2_v_15;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_16> AgradCdfNegBinomial2_v_16;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_17> AgradCdfNegBinomial2_v_17;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_18> AgradCdfNegBinomial2_v_18;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_19> AgradCdfNegBinomial2_v_19;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_20> AgradCdfNegBinomial2_v_20;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_21> AgradCdfNegBinomial2_v_21;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_22> AgradCdfNegBinomial2_v_22;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_23> AgradCdfNegBinomial2_v_23;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_24> AgradCdfNegBinomial2_v_24;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_25> AgradCdfNegBinomial2_v_25;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_26> AgradCdfNegBinomial2_v_26;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_27> AgradCdfNegBinomial2_v_27;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_28> AgradCdfNegBinomial2_v_28;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_29> AgradCdfNegBinomial2_v_29;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_30> AgradCdfNegBinomial2_v_30;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_31> AgradCdfNegBinomial2_v_31;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_32> AgradCdfNegBinomial2_v_32;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_33> AgradCdfNegBinomial2_v_33;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_34> AgradCdfNegBinomial2_v_34;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_35> AgradCdfNegBinomial2_v_35;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_36> AgradCdfNegBinomial2_v_36;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_37> AgradCdfNegBinomial2_v_37;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_38> AgradCdfNegBinomial2_v_38;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_39> AgradCdfNegBinomial2_v_39;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_40> AgradCdfNegBinomial2_v_40;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_41> AgradCdfNegBinomial2_v_41;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_42> AgradCdfNegBinomial2_v_42;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_43> AgradCdfNegBinomial2_v_43;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_44> AgradCdfNegBinomial2_v_44;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_45> AgradCdfNegBinomial2_v_45;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_46> AgradCdfNegBinomial2_v_46;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_47> AgradCdfNegBinomial2_v_47;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_48> AgradCdfNegBinomial2_v_48;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_49> AgradCdfNegBinomial2_v_49;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_50> AgradCdfNegBinomial2_v_50;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_51> AgradCdfNegBinomial2_v_51;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_52> AgradCdfNegBinomial2_v_52;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_53> AgradCdfNegBinomial2_v_53;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_54> AgradCdfNegBinomial2_v_54;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_55> AgradCdfNegBinomial2_v_55;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_56> AgradCdfNegBinomial2_v_56;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_57> AgradCdfNegBinomial2_v_57;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_58> AgradCdfNegBinomial2_v_58;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_59> AgradCdfNegBinomial2_v_59;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_60> AgradCdfNegBinomial2_v_60;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_61> AgradCdfNegBinomial2_v_61;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_62> AgradCdfNegBinomial2_v_62;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_63> AgradCdfNegBinomial2_v_63;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_64> AgradCdfNegBinomial2_v_64;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_65> AgradCdfNegBinomial2_v_65;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_66> AgradCdfNegBinomial2_v_66;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_67> AgradCdfNegBinomial2_v_67;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_68> AgradCdfNegBinomial2_v_68;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_69> AgradCdfNegBinomial2_v_69;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_70> AgradCdfNegBinomial2_v_70;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_71> AgradCdfNegBinomial2_v_71;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_72> AgradCdfNegBinomial2_v_72;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_73> AgradCdfNegBinomial2_v_73;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_74> AgradCdfNegBinomial2_v_74;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_75> AgradCdfNegBinomial2_v_75;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_76> AgradCdfNegBinomial2_v_76;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_77> AgradCdfNegBinomial2_v_77;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_78> AgradCdfNegBinomial2_v_78;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_79> AgradCdfNegBinomial2_v_79;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_80> AgradCdfNegBinomial2_v_80;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_81> AgradCdfNegBinomial2_v_81;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_82> AgradCdfNegBinomial2_v_82;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_83> AgradCdfNegBinomial2_v_83;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_84> AgradCdfNegBinomial2_v_84;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_85> AgradCdfNegBinomial2_v_85;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_86> AgradCdfNegBinomial2_v_86;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_87> AgradCdfNegBinomial2_v_87;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_88> AgradCdfNegBinomial2_v_88;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_89> AgradCdfNegBinomial2_v_89;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_90> AgradCdfNegBinomial2_v_90;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_91> AgradCdfNegBinomial2_v_91;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_92> AgradCdfNegBinomial2_v_92;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_93> AgradCdfNegBinomial2_v_93;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_94> AgradCdfNegBinomial2_v_94;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_95> AgradCdfNegBinomial2_v_95;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_96> AgradCdfNegBinomial2_v_96;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_97> AgradCdfNegBinomial2_v_97;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_98> AgradCdfNegBinomial2_v_98;
+typedef std::tuple<AgradCdfNegBinomial2, type_v_99> AgradCdfNegBinomial2_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_0, AgradCdfTestFixture, AgradCdfNegBinomial2_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_1, AgradCdfTestFixture, AgradCdfNegBinomial2_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_2, AgradCdfTestFixture, AgradCdfNegBinomial2_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_3, AgradCdfTestFixture, AgradCdfNegBinomial2_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_4, AgradCdfTestFixture, AgradCdfNegBinomial2_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_5, AgradCdfTestFixture, AgradCdfNegBinomial2_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_6, AgradCdfTestFixture, AgradCdfNegBinomial2_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_7, AgradCdfTestFixture, AgradCdfNegBinomial2_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_8, AgradCdfTestFixture, AgradCdfNegBinomial2_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_9, AgradCdfTestFixture, AgradCdfNegBinomial2_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_10, AgradCdfTestFixture, AgradCdfNegBinomial2_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_11, AgradCdfTestFixture, AgradCdfNegBinomial2_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_12, AgradCdfTestFixture, AgradCdfNegBinomial2_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_13, AgradCdfTestFixture, AgradCdfNegBinomial2_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_14, AgradCdfTestFixture, AgradCdfNegBinomial2_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_15, AgradCdfTestFixture, AgradCdfNegBinomial2_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_16, AgradCdfTestFixture, AgradCdfNegBinomial2_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_17, AgradCdfTestFixture, AgradCdfNegBinomial2_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_18, AgradCdfTestFixture, AgradCdfNegBinomial2_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_19, AgradCdfTestFixture, AgradCdfNegBinomial2_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_20, AgradCdfTestFixture, AgradCdfNegBinomial2_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_21, AgradCdfTestFixture, AgradCdfNegBinomial2_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_22, AgradCdfTestFixture, AgradCdfNegBinomial2_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_23, AgradCdfTestFixture, AgradCdfNegBinomial2_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_24, AgradCdfTestFixture, AgradCdfNegBinomial2_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_25, AgradCdfTestFixture, AgradCdfNegBinomial2_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_26, AgradCdfTestFixture, AgradCdfNegBinomial2_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_27, AgradCdfTestFixture, AgradCdfNegBinomial2_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_28, AgradCdfTestFixture, AgradCdfNegBinomial2_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_29, AgradCdfTestFixture, AgradCdfNegBinomial2_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_30, AgradCdfTestFixture, AgradCdfNegBinomial2_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_31, AgradCdfTestFixture, AgradCdfNegBinomial2_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_32, AgradCdfTestFixture, AgradCdfNegBinomial2_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_33, AgradCdfTestFixture, AgradCdfNegBinomial2_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_34, AgradCdfTestFixture, AgradCdfNegBinomial2_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_35, AgradCdfTestFixture, AgradCdfNegBinomial2_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_36, AgradCdfTestFixture, AgradCdfNegBinomial2_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_37, AgradCdfTestFixture, AgradCdfNegBinomial2_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_38, AgradCdfTestFixture, AgradCdfNegBinomial2_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_39, AgradCdfTestFixture, AgradCdfNegBinomial2_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_40, AgradCdfTestFixture, AgradCdfNegBinomial2_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_41, AgradCdfTestFixture, AgradCdfNegBinomial2_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_42, AgradCdfTestFixture, AgradCdfNegBinomial2_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_43, AgradCdfTestFixture, AgradCdfNegBinomial2_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_44, AgradCdfTestFixture, AgradCdfNegBinomial2_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_45, AgradCdfTestFixture, AgradCdfNegBinomial2_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_46, AgradCdfTestFixture, AgradCdfNegBinomial2_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_47, AgradCdfTestFixture, AgradCdfNegBinomial2_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_48, AgradCdfTestFixture, AgradCdfNegBinomial2_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_49, AgradCdfTestFixture, AgradCdfNegBinomial2_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_50, AgradCdfTestFixture, AgradCdfNegBinomial2_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_51, AgradCdfTestFixture, AgradCdfNegBinomial2_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_52, AgradCdfTestFixture, AgradCdfNegBinomial2_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_53, AgradCdfTestFixture, AgradCdfNegBinomial2_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_54, AgradCdfTestFixture, AgradCdfNegBinomial2_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_55, AgradCdfTestFixture, AgradCdfNegBinomial2_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_56, AgradCdfTestFixture, AgradCdfNegBinomial2_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_57, AgradCdfTestFixture, AgradCdfNegBinomial2_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_58, AgradCdfTestFixture, AgradCdfNegBinomial2_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_59, AgradCdfTestFixture, AgradCdfNegBinomial2_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_60, AgradCdfTestFixture, AgradCdfNegBinomial2_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_61, AgradCdfTestFixture, AgradCdfNegBinomial2_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_62, AgradCdfTestFixture, AgradCdfNegBinomial2_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_63, AgradCdfTestFixture, AgradCdfNegBinomial2_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_64, AgradCdfTestFixture, AgradCdfNegBinomial2_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_65, AgradCdfTestFixture, AgradCdfNegBinomial2_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_66, AgradCdfTestFixture, AgradCdfNegBinomial2_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_67, AgradCdfTestFixture, AgradCdfNegBinomial2_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_68, AgradCdfTestFixture, AgradCdfNegBinomial2_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_69, AgradCdfTestFixture, AgradCdfNegBinomial2_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_70, AgradCdfTestFixture, AgradCdfNegBinomial2_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_71, AgradCdfTestFixture, AgradCdfNegBinomial2_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_72, AgradCdfTestFixture, AgradCdfNegBinomial2_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_73, AgradCdfTestFixture, AgradCdfNegBinomial2_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_74, AgradCdfTestFixture, AgradCdfNegBinomial2_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_75, AgradCdfTestFixture, AgradCdfNegBinomial2_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_76, AgradCdfTestFixture, AgradCdfNegBinomial2_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_77, AgradCdfTestFixture, AgradCdfNegBinomial2_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_78, AgradCdfTestFixture, AgradCdfNegBinomial2_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_79, AgradCdfTestFixture, AgradCdfNegBinomial2_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_80, AgradCdfTestFixture, AgradCdfNegBinomial2_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_81, AgradCdfTestFixture, AgradCdfNegBinomial2_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_82, AgradCdfTestFixture, AgradCdfNegBinomial2_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_83, AgradCdfTestFixture, AgradCdfNegBinomial2_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_84, AgradCdfTestFixture, AgradCdfNegBinomial2_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_85, AgradCdfTestFixture, AgradCdfNegBinomial2_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_86, AgradCdfTestFixture, AgradCdfNegBinomial2_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_87, AgradCdfTestFixture, AgradCdfNegBinomial2_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_88, AgradCdfTestFixture, AgradCdfNegBinomial2_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_89, AgradCdfTestFixture, AgradCdfNegBinomial2_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_90, AgradCdfTestFixture, AgradCdfNegBinomial2_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_91, AgradCdfTestFixture, AgradCdfNegBinomial2_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_92, AgradCdfTestFixture, AgradCdfNegBinomial2_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_93, AgradCdfTestFixture, AgradCdfNegBinomial2_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_94, AgradCdfTestFixture, AgradCdfNegBinomial2_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_95, AgradCdfTestFixture, AgradCdfNegBinomial2_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_96, AgradCdfTestFixture, AgradCdfNegBinomial2_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_97, AgradCdfTestFixture, AgradCdfNegBinomial2_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_98, AgradCdfTestFixture, AgradCdfNegBinomial2_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNegBinomial2_v_99, AgradCdfTestFixture, AgradCdfNegBinomial2_v_99);
+
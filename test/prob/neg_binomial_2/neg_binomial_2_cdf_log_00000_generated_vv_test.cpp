@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial_2/neg_binomial_2_cdf_log_test.hpp>
+
+typedef std::tuple<int, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<int, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<int, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<int, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<int, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<int, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<int, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<int, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<int, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<int, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<int, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<int>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<int>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<int>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<int>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<int>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<int>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<int>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<int>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<int>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<int>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<int>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_0> AgradCdfLogNegBinomial2_vv_0;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_1> AgradCdfLogNegBinomial2_vv_1;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_2> AgradCdfLogNegBinomial2_vv_2;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_3> AgradCdfLogNegBinomial2_vv_3;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_4> AgradCdfLogNegBinomial2_vv_4;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_5> AgradCdfLogNegBinomial2_vv_5;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_6> AgradCdfLogNegBinomial2_vv_6;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_7> AgradCdfLogNegBinomial2_vv_7;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_8> AgradCdfLogNegBinomial2_vv_8;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_9> AgradCdfLogNegBinomial2_vv_9;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_10> AgradCdfLogNegBinomial2_vv_10;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_11> AgradCdfLogNegBinomial2_vv_11;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_12> AgradCdfLogNegBinomial2_vv_12;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_13> AgradCdfLogNegBinomial2_vv_13;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_14> AgradCdfLogNegBinomial2_vv_14;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_15> AgradCdfLogNegBinomial2_vv_15;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_16> AgradCdfLogNegBinomial2_vv_16;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_17> AgradCdfLogNegBinomial2_vv_17;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_18> AgradCdfLogNegBinomial2_vv_18;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_19> AgradCdfLogNegBinomial2_vv_19;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_20> AgradCdfLogNegBinomial2_vv_20;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_21> AgradCdfLogNegBinomial2_vv_21;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_22> AgradCdfLogNegBinomial2_vv_22;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_23> AgradCdfLogNegBinomial2_vv_23;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_24> AgradCdfLogNegBinomial2_vv_24;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_25> AgradCdfLogNegBinomial2_vv_25;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_26> AgradCdfLogNegBinomial2_vv_26;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_27> AgradCdfLogNegBinomial2_vv_27;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_28> AgradCdfLogNegBinomial2_vv_28;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_29> AgradCdfLogNegBinomial2_vv_29;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_30> AgradCdfLogNegBinomial2_vv_30;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_31> AgradCdfLogNegBinomial2_vv_31;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_32> AgradCdfLogNegBinomial2_vv_32;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_33> AgradCdfLogNegBinomial2_vv_33;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_34> AgradCdfLogNegBinomial2_vv_34;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_35> AgradCdfLogNegBinomial2_vv_35;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_36> AgradCdfLogNegBinomial2_vv_36;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_37> AgradCdfLogNegBinomial2_vv_37;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_38> AgradCdfLogNegBinomial2_vv_38;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_39> AgradCdfLogNegBinomial2_vv_39;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_40> AgradCdfLogNegBinomial2_vv_40;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_41> AgradCdfLogNegBinomial2_vv_41;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_42> AgradCdfLogNegBinomial2_vv_42;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_43> AgradCdfLogNegBinomial2_vv_43;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_44> AgradCdfLogNegBinomial2_vv_44;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_45> AgradCdfLogNegBinomial2_vv_45;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_46> AgradCdfLogNegBinomial2_vv_46;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_47> AgradCdfLogNegBinomial2_vv_47;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_48> AgradCdfLogNegBinomial2_vv_48;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_49> AgradCdfLogNegBinomial2_vv_49;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_50> AgradCdfLogNegBinomial2_vv_50;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_51> AgradCdfLogNegBinomial2_vv_51;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_52> AgradCdfLogNegBinomial2_vv_52;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_53> AgradCdfLogNegBinomial2_vv_53;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_54> AgradCdfLogNegBinomial2_vv_54;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_55> AgradCdfLogNegBinomial2_vv_55;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_56> AgradCdfLogNegBinomial2_vv_56;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_57> AgradCdfLogNegBinomial2_vv_57;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_58> AgradCdfLogNegBinomial2_vv_58;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_59> AgradCdfLogNegBinomial2_vv_59;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_60> AgradCdfLogNegBinomial2_vv_60;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_61> AgradCdfLogNegBinomial2_vv_61;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_62> AgradCdfLogNegBinomial2_vv_62;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_63> AgradCdfLogNegBinomial2_vv_63;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_64> AgradCdfLogNegBinomial2_vv_64;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_65> AgradCdfLogNegBinomial2_vv_65;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_66> AgradCdfLogNegBinomial2_vv_66;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_67> AgradCdfLogNegBinomial2_vv_67;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_68> AgradCdfLogNegBinomial2_vv_68;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_69> AgradCdfLogNegBinomial2_vv_69;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_70> AgradCdfLogNegBinomial2_vv_70;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_71> AgradCdfLogNegBinomial2_vv_71;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_72> AgradCdfLogNegBinomial2_vv_72;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_73> AgradCdfLogNegBinomial2_vv_73;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_74> AgradCdfLogNegBinomial2_vv_74;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_75> AgradCdfLogNegBinomial2_vv_75;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_76> AgradCdfLogNegBinomial2_vv_76;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_77> AgradCdfLogNegBinomial2_vv_77;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_78> AgradCdfLogNegBinomial2_vv_78;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_79> AgradCdfLogNegBinomial2_vv_79;
+typedef std::tuple<AgradCdfLogNegBinomial2, type_vv_80> AgradCdfLogNegBinomial2_vv_80;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_0, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_1, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_2, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_3, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_4, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_5, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_6, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_7, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_8, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_9, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_10, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_11, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_12, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_13, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_14, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_15, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_16, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_17, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_18, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_19, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_20, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_21, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_22, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_23, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_24, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_25, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_26, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_27, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_28, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_29, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_30, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_31, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_32, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_33, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_34, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_35, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_36, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_37, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_38, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_39, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_40, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_41, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_42, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_43, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_44, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_45, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_46, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_47, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_48, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_49, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_50, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_51, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_52, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_53, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_54, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_55, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_56, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_57, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_58, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_59, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_60, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_61, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_62, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_63, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_64, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_65, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_66, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_67, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_68, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_69, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_70, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_71, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_72, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_73, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_74, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_75, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_76, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_77, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_78, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_79, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNegBinomial2_vv_80, AgradCdfLogTestFixture, AgradCdfLogNegBinomial2_vv_80);
+
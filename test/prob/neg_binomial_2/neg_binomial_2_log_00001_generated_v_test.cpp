@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/neg_binomial_2/neg_binomial_2_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+
+typedef std::tuple<AgradDistributionsNegBinomial2Log, type_v_100> AgradDistributionsNegBinomial2Log_v_100;
+typedef std::tuple<AgradDistributionsNegBinomial2Log, type_v_101> AgradDistributionsNegBinomial2Log_v_101;
+typedef std::tuple<AgradDistributionsNegBinomial2Log, type_v_102> AgradDistributionsNegBinomial2Log_v_102;
+typedef std::tuple<AgradDistributionsNegBinomial2Log, type_v_103> AgradDistributionsNegBinomial2Log_v_103;
+typedef std::tuple<AgradDistributionsNegBinomial2Log, type_v_104> AgradDistributionsNegBinomial2Log_v_104;
+typedef std::tuple<AgradDistributionsNegBinomial2Log, type_v_105> AgradDistributionsNegBinomial2Log_v_105;
+typedef std::tuple<AgradDistributionsNegBinomial2Log, type_v_106> AgradDistributionsNegBinomial2Log_v_106;
+typedef std::tuple<AgradDistributionsNegBinomial2Log, type_v_107> AgradDistributionsNegBinomial2Log_v_107;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2Log_v_100, AgradDistributionTestFixture, AgradDistributionsNegBinomial2Log_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2Log_v_101, AgradDistributionTestFixture, AgradDistributionsNegBinomial2Log_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2Log_v_102, AgradDistributionTestFixture, AgradDistributionsNegBinomial2Log_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2Log_v_103, AgradDistributionTestFixture, AgradDistributionsNegBinomial2Log_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2Log_v_104, AgradDistributionTestFixture, AgradDistributionsNegBinomial2Log_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2Log_v_105, AgradDistributionTestFixture, AgradDistributionsNegBinomial2Log_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2Log_v_106, AgradDistributionTestFixture, AgradDistributionsNegBinomial2Log_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsNegBinomial2Log_v_107, AgradDistributionTestFixture, AgradDistributionsNegBinomial2Log_v_107);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionNormal, type_ffv_0> AgradDistributionNormal_ffv_0;
+typedef std::tuple<AgradDistributionNormal, type_ffv_1> AgradDistributionNormal_ffv_1;
+typedef std::tuple<AgradDistributionNormal, type_ffv_2> AgradDistributionNormal_ffv_2;
+typedef std::tuple<AgradDistributionNormal, type_ffv_3> AgradDistributionNormal_ffv_3;
+typedef std::tuple<AgradDistributionNormal, type_ffv_4> AgradDistributionNormal_ffv_4;
+typedef std::tuple<AgradDistributionNormal, type_ffv_5> AgradDistributionNormal_ffv_5;
+typedef std::tuple<AgradDistributionNormal, type_ffv_6> AgradDistributionNormal_ffv_6;
+typedef std::tuple<AgradDistributionNormal, type_ffv_7> AgradDistributionNormal_ffv_7;
+typedef std::tuple<AgradDistributionNormal, type_ffv_8> AgradDistributionNormal_ffv_8;
+typedef std::tuple<AgradDistributionNormal, type_ffv_9> AgradDistributionNormal_ffv_9;
+typedef std::tuple<AgradDistributionNormal, type_ffv_10> AgradDistributionNormal_ffv_10;
+typedef std::tuple<AgradDistributionNormal, type_ffv_11> AgradDistributionNormal_ffv_11;
+typedef std::tuple<AgradDistributionNormal, type_ffv_12> AgradDistributionNormal_ffv_12;
+typedef std::tuple<AgradDistributionNormal, type_ffv_13> AgradDistributionNormal_ffv_13;
+typedef std::tuple<AgradDistributionNormal, type_ffv_14> AgradDistributionNormal_ffv_14;
+typedef std::tuple<AgradDistributionNormal, type_ffv_15> AgradDistributionNormal_ffv_15;
+typedef std::tuple<AgradDistributionNormal, type_ffv_16> AgradDistributionNormal_ffv_16;
+typedef std::tuple<AgradDistributionNormal, type_ffv_17> AgradDistributionNormal_ffv_17;
+typedef std::tuple<AgradDistributionNormal, type_ffv_18> AgradDistributionNormal_ffv_18;
+typedef std::tuple<AgradDistributionNormal, type_ffv_19> AgradDistributionNormal_ffv_19;
+typedef std::tuple<AgradDistributionNormal, type_ffv_20> AgradDistributionNormal_ffv_20;
+typedef std::tuple<AgradDistributionNormal, type_ffv_21> AgradDistributionNormal_ffv_21;
+typedef std::tuple<AgradDistributionNormal, type_ffv_22> AgradDistributionNormal_ffv_22;
+typedef std::tuple<AgradDistributionNormal, type_ffv_23> AgradDistributionNormal_ffv_23;
+typedef std::tuple<AgradDistributionNormal, type_ffv_24> AgradDistributionNormal_ffv_24;
+typedef std::tuple<AgradDistributionNormal, type_ffv_25> AgradDistributionNormal_ffv_25;
+typedef std::tuple<AgradDistributionNormal, type_ffv_26> AgradDistributionNormal_ffv_26;
+typedef std::tuple<AgradDistributionNormal, type_ffv_27> AgradDistributionNormal_ffv_27;
+typedef std::tuple<AgradDistributionNormal, type_ffv_28> AgradDistributionNormal_ffv_28;
+typedef std::tuple<AgradDistributionNormal, type_ffv_29> AgradDistributionNormal_ffv_29;
+typedef std::tuple<AgradDistributionNormal, type_ffv_30> AgradDistributionNormal_ffv_30;
+typedef std::tuple<AgradDistributionNormal, type_ffv_31> AgradDistributionNormal_ffv_31;
+typedef std::tuple<AgradDistributionNormal, type_ffv_32> AgradDistributionNormal_ffv_32;
+typedef std::tuple<AgradDistributionNormal, type_ffv_33> AgradDistributionNormal_ffv_33;
+typedef std::tuple<AgradDistributionNormal, type_ffv_34> AgradDistributionNormal_ffv_34;
+typedef std::tuple<AgradDistributionNormal, type_ffv_35> AgradDistributionNormal_ffv_35;
+typedef std::tuple<AgradDistributionNormal, type_ffv_36> AgradDistributionNormal_ffv_36;
+typedef std::tuple<AgradDistributionNormal, type_ffv_37> AgradDistributionNormal_ffv_37;
+typedef std::tuple<AgradDistributionNormal, type_ffv_38> AgradDistributionNormal_ffv_38;
+typedef std::tuple<AgradDistributionNormal, type_ffv_39> AgradDistributionNormal_ffv_39;
+typedef std::tuple<AgradDistributionNormal, type_ffv_40> AgradDistributionNormal_ffv_40;
+typedef std::tuple<AgradDistributionNormal, type_ffv_41> AgradDistributionNormal_ffv_41;
+typedef std::tuple<AgradDistributionNormal, type_ffv_42> AgradDistributionNormal_ffv_42;
+typedef std::tuple<AgradDistributionNormal, type_ffv_43> AgradDistributionNormal_ffv_43;
+typedef std::tuple<AgradDistributionNormal, type_ffv_44> AgradDistributionNormal_ffv_44;
+typedef std::tuple<AgradDistributionNormal, type_ffv_45> AgradDistributionNormal_ffv_45;
+typedef std::tuple<AgradDistributionNormal, type_ffv_46> AgradDistributionNormal_ffv_46;
+typedef std::tuple<AgradDistributionNormal, type_ffv_47> AgradDistributionNormal_ffv_47;
+typedef std::tuple<AgradDistributionNormal, type_ffv_48> AgradDistributionNormal_ffv_48;
+typedef std::tuple<AgradDistributionNormal, type_ffv_49> AgradDistributionNormal_ffv_49;
+typedef std::tuple<AgradDistributionNormal, type_ffv_50> AgradDistributionNormal_ffv_50;
+typedef std::tuple<AgradDistributionNormal, type_ffv_51> AgradDistributionNormal_ffv_51;
+typedef std::tuple<AgradDistributionNormal, type_ffv_52> AgradDistributionNormal_ffv_52;
+typedef std::tuple<AgradDistributionNormal, type_ffv_53> AgradDistributionNormal_ffv_53;
+typedef std::tuple<AgradDistributionNormal, type_ffv_54> AgradDistributionNormal_ffv_54;
+typedef std::tuple<AgradDistributionNormal, type_ffv_55> AgradDistributionNormal_ffv_55;
+typedef std::tuple<AgradDistributionNormal, type_ffv_56> AgradDistributionNormal_ffv_56;
+typedef std::tuple<AgradDistributionNormal, type_ffv_57> AgradDistributionNormal_ffv_57;
+typedef std::tuple<AgradDistributionNormal, type_ffv_58> AgradDistributionNormal_ffv_58;
+typedef std::tuple<AgradDistributionNormal, type_ffv_59> AgradDistributionNormal_ffv_59;
+typedef std::tuple<AgradDistributionNormal, type_ffv_60> AgradDistributionNormal_ffv_60;
+typedef std::tuple<AgradDistributionNormal, type_ffv_61> AgradDistributionNormal_ffv_61;
+typedef std::tuple<AgradDistributionNormal, type_ffv_62> AgradDistributionNormal_ffv_62;
+typedef std::tuple<AgradDistributionNormal, type_ffv_63> AgradDistributionNormal_ffv_63;
+typedef std::tuple<AgradDistributionNormal, type_ffv_64> AgradDistributionNormal_ffv_64;
+typedef std::tuple<AgradDistributionNormal, type_ffv_65> AgradDistributionNormal_ffv_65;
+typedef std::tuple<AgradDistributionNormal, type_ffv_66> AgradDistributionNormal_ffv_66;
+typedef std::tuple<AgradDistributionNormal, type_ffv_67> AgradDistributionNormal_ffv_67;
+typedef std::tuple<AgradDistributionNormal, type_ffv_68> AgradDistributionNormal_ffv_68;
+typedef std::tuple<AgradDistributionNormal, type_ffv_69> AgradDistributionNormal_ffv_69;
+typedef std::tuple<AgradDistributionNormal, type_ffv_70> AgradDistributionNormal_ffv_70;
+typedef std::tuple<AgradDistributionNormal, type_ffv_71> AgradDistributionNormal_ffv_71;
+typedef std::tuple<AgradDistributionNormal, type_ffv_72> AgradDistributionNormal_ffv_72;
+typedef std::tuple<AgradDistributionNormal, type_ffv_73> AgradDistributionNormal_ffv_73;
+typedef std::tuple<AgradDistributionNormal, type_ffv_74> AgradDistributionNormal_ffv_74;
+typedef std::tuple<AgradDistributionNormal, type_ffv_75> AgradDistributionNormal_ffv_75;
+typedef std::tuple<AgradDistributionNormal, type_ffv_76> AgradDistributionNormal_ffv_76;
+typedef std::tuple<AgradDistributionNormal, type_ffv_77> AgradDistributionNormal_ffv_77;
+typedef std::tuple<AgradDistributionNormal, type_ffv_78> AgradDistributionNormal_ffv_78;
+typedef std::tuple<AgradDistributionNormal, type_ffv_79> AgradDistributionNormal_ffv_79;
+typedef std::tuple<AgradDistributionNormal, type_ffv_80> AgradDistributionNormal_ffv_80;
+typedef std::tuple<AgradDistributionNormal, type_ffv_81> AgradDistributionNormal_ffv_81;
+typedef std::tuple<AgradDistributionNormal, type_ffv_82> AgradDistributionNormal_ffv_82;
+typedef std::tuple<AgradDistributionNormal, type_ffv_83> AgradDistributionNormal_ffv_83;
+typedef std::tuple<AgradDistributionNormal, type_ffv_84> AgradDistributionNormal_ffv_84;
+typedef std::tuple<AgradDistributionNormal, type_ffv_85> AgradDistributionNormal_ffv_85;
+typedef std::tuple<AgradDistributionNormal, type_ffv_86> AgradDistributionNormal_ffv_86;
+typedef std::tuple<AgradDistributionNormal, type_ffv_87> AgradDistributionNormal_ffv_87;
+typedef std::tuple<AgradDistributionNormal, type_ffv_88> AgradDistributionNormal_ffv_88;
+typedef std::tuple<AgradDistributionNormal, type_ffv_89> AgradDistributionNormal_ffv_89;
+typedef std::tuple<AgradDistributionNormal, type_ffv_90> AgradDistributionNormal_ffv_90;
+typedef std::tuple<AgradDistributionNormal, type_ffv_91> AgradDistributionNormal_ffv_91;
+typedef std::tuple<AgradDistributionNormal, type_ffv_92> AgradDistributionNormal_ffv_92;
+typedef std::tuple<AgradDistributionNormal, type_ffv_93> AgradDistributionNormal_ffv_93;
+typedef std::tuple<AgradDistributionNormal, type_ffv_94> AgradDistributionNormal_ffv_94;
+typedef std::tuple<AgradDistributionNormal, type_ffv_95> AgradDistributionNormal_ffv_95;
+typedef std::tuple<AgradDistributionNormal, type_ffv_96> AgradDistributionNormal_ffv_96;
+typedef std::tuple<AgradDistributionNormal, type_ffv_97> AgradDistributionNormal_ffv_97;
+typedef std::tuple<AgradDistributionNormal, type_ffv_98> AgradDistributionNormal_ffv_98;
+typedef std::tuple<AgradDistributionNormal, type_ffv_99> AgradDistributionNormal_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_0, AgradDistributionTestFixture, AgradDistributionNormal_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_1, AgradDistributionTestFixture, AgradDistributionNormal_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_2, AgradDistributionTestFixture, AgradDistributionNormal_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_3, AgradDistributionTestFixture, AgradDistributionNormal_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_4, AgradDistributionTestFixture, AgradDistributionNormal_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_5, AgradDistributionTestFixture, AgradDistributionNormal_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_6, AgradDistributionTestFixture, AgradDistributionNormal_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_7, AgradDistributionTestFixture, AgradDistributionNormal_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_8, AgradDistributionTestFixture, AgradDistributionNormal_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_9, AgradDistributionTestFixture, AgradDistributionNormal_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_10, AgradDistributionTestFixture, AgradDistributionNormal_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_11, AgradDistributionTestFixture, AgradDistributionNormal_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_12, AgradDistributionTestFixture, AgradDistributionNormal_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_13, AgradDistributionTestFixture, AgradDistributionNormal_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_14, AgradDistributionTestFixture, AgradDistributionNormal_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_15, AgradDistributionTestFixture, AgradDistributionNormal_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_16, AgradDistributionTestFixture, AgradDistributionNormal_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_17, AgradDistributionTestFixture, AgradDistributionNormal_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_18, AgradDistributionTestFixture, AgradDistributionNormal_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_19, AgradDistributionTestFixture, AgradDistributionNormal_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_20, AgradDistributionTestFixture, AgradDistributionNormal_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_21, AgradDistributionTestFixture, AgradDistributionNormal_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_22, AgradDistributionTestFixture, AgradDistributionNormal_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_23, AgradDistributionTestFixture, AgradDistributionNormal_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_24, AgradDistributionTestFixture, AgradDistributionNormal_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_25, AgradDistributionTestFixture, AgradDistributionNormal_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_26, AgradDistributionTestFixture, AgradDistributionNormal_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_27, AgradDistributionTestFixture, AgradDistributionNormal_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_28, AgradDistributionTestFixture, AgradDistributionNormal_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_29, AgradDistributionTestFixture, AgradDistributionNormal_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_30, AgradDistributionTestFixture, AgradDistributionNormal_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_31, AgradDistributionTestFixture, AgradDistributionNormal_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_32, AgradDistributionTestFixture, AgradDistributionNormal_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_33, AgradDistributionTestFixture, AgradDistributionNormal_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_34, AgradDistributionTestFixture, AgradDistributionNormal_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_35, AgradDistributionTestFixture, AgradDistributionNormal_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_36, AgradDistributionTestFixture, AgradDistributionNormal_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_37, AgradDistributionTestFixture, AgradDistributionNormal_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_38, AgradDistributionTestFixture, AgradDistributionNormal_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_39, AgradDistributionTestFixture, AgradDistributionNormal_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_40, AgradDistributionTestFixture, AgradDistributionNormal_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_41, AgradDistributionTestFixture, AgradDistributionNormal_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_42, AgradDistributionTestFixture, AgradDistributionNormal_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_43, AgradDistributionTestFixture, AgradDistributionNormal_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_44, AgradDistributionTestFixture, AgradDistributionNormal_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_45, AgradDistributionTestFixture, AgradDistributionNormal_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_46, AgradDistributionTestFixture, AgradDistributionNormal_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_47, AgradDistributionTestFixture, AgradDistributionNormal_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_48, AgradDistributionTestFixture, AgradDistributionNormal_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_49, AgradDistributionTestFixture, AgradDistributionNormal_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_50, AgradDistributionTestFixture, AgradDistributionNormal_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_51, AgradDistributionTestFixture, AgradDistributionNormal_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_52, AgradDistributionTestFixture, AgradDistributionNormal_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_53, AgradDistributionTestFixture, AgradDistributionNormal_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_54, AgradDistributionTestFixture, AgradDistributionNormal_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_55, AgradDistributionTestFixture, AgradDistributionNormal_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_56, AgradDistributionTestFixture, AgradDistributionNormal_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_57, AgradDistributionTestFixture, AgradDistributionNormal_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_58, AgradDistributionTestFixture, AgradDistributionNormal_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_59, AgradDistributionTestFixture, AgradDistributionNormal_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_60, AgradDistributionTestFixture, AgradDistributionNormal_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_61, AgradDistributionTestFixture, AgradDistributionNormal_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_62, AgradDistributionTestFixture, AgradDistributionNormal_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_63, AgradDistributionTestFixture, AgradDistributionNormal_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_64, AgradDistributionTestFixture, AgradDistributionNormal_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_65, AgradDistributionTestFixture, AgradDistributionNormal_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_66, AgradDistributionTestFixture, AgradDistributionNormal_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_67, AgradDistributionTestFixture, AgradDistributionNormal_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_68, AgradDistributionTestFixture, AgradDistributionNormal_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_69, AgradDistributionTestFixture, AgradDistributionNormal_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_70, AgradDistributionTestFixture, AgradDistributionNormal_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_71, AgradDistributionTestFixture, AgradDistributionNormal_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_72, AgradDistributionTestFixture, AgradDistributionNormal_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_73, AgradDistributionTestFixture, AgradDistributionNormal_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_74, AgradDistributionTestFixture, AgradDistributionNormal_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_75, AgradDistributionTestFixture, AgradDistributionNormal_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_76, AgradDistributionTestFixture, AgradDistributionNormal_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_77, AgradDistributionTestFixture, AgradDistributionNormal_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_78, AgradDistributionTestFixture, AgradDistributionNormal_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_79, AgradDistributionTestFixture, AgradDistributionNormal_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_80, AgradDistributionTestFixture, AgradDistributionNormal_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_81, AgradDistributionTestFixture, AgradDistributionNormal_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_82, AgradDistributionTestFixture, AgradDistributionNormal_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_83, AgradDistributionTestFixture, AgradDistributionNormal_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_84, AgradDistributionTestFixture, AgradDistributionNormal_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_85, AgradDistributionTestFixture, AgradDistributionNormal_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_86, AgradDistributionTestFixture, AgradDistributionNormal_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_87, AgradDistributionTestFixture, AgradDistributionNormal_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_88, AgradDistributionTestFixture, AgradDistributionNormal_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_89, AgradDistributionTestFixture, AgradDistributionNormal_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_90, AgradDistributionTestFixture, AgradDistributionNormal_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_91, AgradDistributionTestFixture, AgradDistributionNormal_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_92, AgradDistributionTestFixture, AgradDistributionNormal_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_93, AgradDistributionTestFixture, AgradDistributionNormal_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_94, AgradDistributionTestFixture, AgradDistributionNormal_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_95, AgradDistributionTestFixture, AgradDistributionNormal_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_96, AgradDistributionTestFixture, AgradDistributionNormal_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_97, AgradDistributionTestFixture, AgradDistributionNormal_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_98, AgradDistributionTestFixture, AgradDistributionNormal_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_99, AgradDistributionTestFixture, AgradDistributionNormal_ffv_99);
+
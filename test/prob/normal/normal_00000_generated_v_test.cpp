@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionNormal, type_v_0> AgradDistributionNormal_v_0;
+typedef std::tuple<AgradDistributionNormal, type_v_1> AgradDistributionNormal_v_1;
+typedef std::tuple<AgradDistributionNormal, type_v_2> AgradDistributionNormal_v_2;
+typedef std::tuple<AgradDistributionNormal, type_v_3> AgradDistributionNormal_v_3;
+typedef std::tuple<AgradDistributionNormal, type_v_4> AgradDistributionNormal_v_4;
+typedef std::tuple<AgradDistributionNormal, type_v_5> AgradDistributionNormal_v_5;
+typedef std::tuple<AgradDistributionNormal, type_v_6> AgradDistributionNormal_v_6;
+typedef std::tuple<AgradDistributionNormal, type_v_7> AgradDistributionNormal_v_7;
+typedef std::tuple<AgradDistributionNormal, type_v_8> AgradDistributionNormal_v_8;
+typedef std::tuple<AgradDistributionNormal, type_v_9> AgradDistributionNormal_v_9;
+typedef std::tuple<AgradDistributionNormal, type_v_10> AgradDistributionNormal_v_10;
+typedef std::tuple<AgradDistributionNormal, type_v_11> AgradDistributionNormal_v_11;
+typedef std::tuple<AgradDistributionNormal, type_v_12> AgradDistributionNormal_v_12;
+typedef std::tuple<AgradDistributionNormal, type_v_13> AgradDistributionNormal_v_13;
+typedef std::tuple<AgradDistributionNormal, type_v_14> AgradDistributionNormal_v_14;
+typedef std::tuple<AgradDistributionNormal, type_v_15> AgradDistributionNormal_v_15;
+typedef std::tuple<AgradDistributionNormal, type_v_16> AgradDistributionNormal_v_16;
+typedef std::tuple<AgradDistributionNormal, type_v_17> AgradDistributionNormal_v_17;
+typedef std::tuple<AgradDistributionNormal, type_v_18> AgradDistributionNormal_v_18;
+typedef std::tuple<AgradDistributionNormal, type_v_19> AgradDistributionNormal_v_19;
+typedef std::tuple<AgradDistributionNormal, type_v_20> AgradDistributionNormal_v_20;
+typedef std::tuple<AgradDistributionNormal, type_v_21> AgradDistributionNormal_v_21;
+typedef std::tuple<AgradDistributionNormal, type_v_22> AgradDistributionNormal_v_22;
+typedef std::tuple<AgradDistributionNormal, type_v_23> AgradDistributionNormal_v_23;
+typedef std::tuple<AgradDistributionNormal, type_v_24> AgradDistributionNormal_v_24;
+typedef std::tuple<AgradDistributionNormal, type_v_25> AgradDistributionNormal_v_25;
+typedef std::tuple<AgradDistributionNormal, type_v_26> AgradDistributionNormal_v_26;
+typedef std::tuple<AgradDistributionNormal, type_v_27> AgradDistributionNormal_v_27;
+typedef std::tuple<AgradDistributionNormal, type_v_28> AgradDistributionNormal_v_28;
+typedef std::tuple<AgradDistributionNormal, type_v_29> AgradDistributionNormal_v_29;
+typedef std::tuple<AgradDistributionNormal, type_v_30> AgradDistributionNormal_v_30;
+typedef std::tuple<AgradDistributionNormal, type_v_31> AgradDistributionNormal_v_31;
+typedef std::tuple<AgradDistributionNormal, type_v_32> AgradDistributionNormal_v_32;
+typedef std::tuple<AgradDistributionNormal, type_v_33> AgradDistributionNormal_v_33;
+typedef std::tuple<AgradDistributionNormal, type_v_34> AgradDistributionNormal_v_34;
+typedef std::tuple<AgradDistributionNormal, type_v_35> AgradDistributionNormal_v_35;
+typedef std::tuple<AgradDistributionNormal, type_v_36> AgradDistributionNormal_v_36;
+typedef std::tuple<AgradDistributionNormal, type_v_37> AgradDistributionNormal_v_37;
+typedef std::tuple<AgradDistributionNormal, type_v_38> AgradDistributionNormal_v_38;
+typedef std::tuple<AgradDistributionNormal, type_v_39> AgradDistributionNormal_v_39;
+typedef std::tuple<AgradDistributionNormal, type_v_40> AgradDistributionNormal_v_40;
+typedef std::tuple<AgradDistributionNormal, type_v_41> AgradDistributionNormal_v_41;
+typedef std::tuple<AgradDistributionNormal, type_v_42> AgradDistributionNormal_v_42;
+typedef std::tuple<AgradDistributionNormal, type_v_43> AgradDistributionNormal_v_43;
+typedef std::tuple<AgradDistributionNormal, type_v_44> AgradDistributionNormal_v_44;
+typedef std::tuple<AgradDistributionNormal, type_v_45> AgradDistributionNormal_v_45;
+typedef std::tuple<AgradDistributionNormal, type_v_46> AgradDistributionNormal_v_46;
+typedef std::tuple<AgradDistributionNormal, type_v_47> AgradDistributionNormal_v_47;
+typedef std::tuple<AgradDistributionNormal, type_v_48> AgradDistributionNormal_v_48;
+typedef std::tuple<AgradDistributionNormal, type_v_49> AgradDistributionNormal_v_49;
+typedef std::tuple<AgradDistributionNormal, type_v_50> AgradDistributionNormal_v_50;
+typedef std::tuple<AgradDistributionNormal, type_v_51> AgradDistributionNormal_v_51;
+typedef std::tuple<AgradDistributionNormal, type_v_52> AgradDistributionNormal_v_52;
+typedef std::tuple<AgradDistributionNormal, type_v_53> AgradDistributionNormal_v_53;
+typedef std::tuple<AgradDistributionNormal, type_v_54> AgradDistributionNormal_v_54;
+typedef std::tuple<AgradDistributionNormal, type_v_55> AgradDistributionNormal_v_55;
+typedef std::tuple<AgradDistributionNormal, type_v_56> AgradDistributionNormal_v_56;
+typedef std::tuple<AgradDistributionNormal, type_v_57> AgradDistributionNormal_v_57;
+typedef std::tuple<AgradDistributionNormal, type_v_58> AgradDistributionNormal_v_58;
+typedef std::tuple<AgradDistributionNormal, type_v_59> AgradDistributionNormal_v_59;
+typedef std::tuple<AgradDistributionNormal, type_v_60> AgradDistributionNormal_v_60;
+typedef std::tuple<AgradDistributionNormal, type_v_61> AgradDistributionNormal_v_61;
+typedef std::tuple<AgradDistributionNormal, type_v_62> AgradDistributionNormal_v_62;
+typedef std::tuple<AgradDistributionNormal, type_v_63> AgradDistributionNormal_v_63;
+typedef std::tuple<AgradDistributionNormal, type_v_64> AgradDistributionNormal_v_64;
+typedef std::tuple<AgradDistributionNormal, type_v_65> AgradDistributionNormal_v_65;
+typedef std::tuple<AgradDistributionNormal, type_v_66> AgradDistributionNormal_v_66;
+typedef std::tuple<AgradDistributionNormal, type_v_67> AgradDistributionNormal_v_67;
+typedef std::tuple<AgradDistributionNormal, type_v_68> AgradDistributionNormal_v_68;
+typedef std::tuple<AgradDistributionNormal, type_v_69> AgradDistributionNormal_v_69;
+typedef std::tuple<AgradDistributionNormal, type_v_70> AgradDistributionNormal_v_70;
+typedef std::tuple<AgradDistributionNormal, type_v_71> AgradDistributionNormal_v_71;
+typedef std::tuple<AgradDistributionNormal, type_v_72> AgradDistributionNormal_v_72;
+typedef std::tuple<AgradDistributionNormal, type_v_73> AgradDistributionNormal_v_73;
+typedef std::tuple<AgradDistributionNormal, type_v_74> AgradDistributionNormal_v_74;
+typedef std::tuple<AgradDistributionNormal, type_v_75> AgradDistributionNormal_v_75;
+typedef std::tuple<AgradDistributionNormal, type_v_76> AgradDistributionNormal_v_76;
+typedef std::tuple<AgradDistributionNormal, type_v_77> AgradDistributionNormal_v_77;
+typedef std::tuple<AgradDistributionNormal, type_v_78> AgradDistributionNormal_v_78;
+typedef std::tuple<AgradDistributionNormal, type_v_79> AgradDistributionNormal_v_79;
+typedef std::tuple<AgradDistributionNormal, type_v_80> AgradDistributionNormal_v_80;
+typedef std::tuple<AgradDistributionNormal, type_v_81> AgradDistributionNormal_v_81;
+typedef std::tuple<AgradDistributionNormal, type_v_82> AgradDistributionNormal_v_82;
+typedef std::tuple<AgradDistributionNormal, type_v_83> AgradDistributionNormal_v_83;
+typedef std::tuple<AgradDistributionNormal, type_v_84> AgradDistributionNormal_v_84;
+typedef std::tuple<AgradDistributionNormal, type_v_85> AgradDistributionNormal_v_85;
+typedef std::tuple<AgradDistributionNormal, type_v_86> AgradDistributionNormal_v_86;
+typedef std::tuple<AgradDistributionNormal, type_v_87> AgradDistributionNormal_v_87;
+typedef std::tuple<AgradDistributionNormal, type_v_88> AgradDistributionNormal_v_88;
+typedef std::tuple<AgradDistributionNormal, type_v_89> AgradDistributionNormal_v_89;
+typedef std::tuple<AgradDistributionNormal, type_v_90> AgradDistributionNormal_v_90;
+typedef std::tuple<AgradDistributionNormal, type_v_91> AgradDistributionNormal_v_91;
+typedef std::tuple<AgradDistributionNormal, type_v_92> AgradDistributionNormal_v_92;
+typedef std::tuple<AgradDistributionNormal, type_v_93> AgradDistributionNormal_v_93;
+typedef std::tuple<AgradDistributionNormal, type_v_94> AgradDistributionNormal_v_94;
+typedef std::tuple<AgradDistributionNormal, type_v_95> AgradDistributionNormal_v_95;
+typedef std::tuple<AgradDistributionNormal, type_v_96> AgradDistributionNormal_v_96;
+typedef std::tuple<AgradDistributionNormal, type_v_97> AgradDistributionNormal_v_97;
+typedef std::tuple<AgradDistributionNormal, type_v_98> AgradDistributionNormal_v_98;
+typedef std::tuple<AgradDistributionNormal, type_v_99> AgradDistributionNormal_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_0, AgradDistributionTestFixture, AgradDistributionNormal_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_1, AgradDistributionTestFixture, AgradDistributionNormal_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_2, AgradDistributionTestFixture, AgradDistributionNormal_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_3, AgradDistributionTestFixture, AgradDistributionNormal_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_4, AgradDistributionTestFixture, AgradDistributionNormal_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_5, AgradDistributionTestFixture, AgradDistributionNormal_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_6, AgradDistributionTestFixture, AgradDistributionNormal_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_7, AgradDistributionTestFixture, AgradDistributionNormal_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_8, AgradDistributionTestFixture, AgradDistributionNormal_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_9, AgradDistributionTestFixture, AgradDistributionNormal_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_10, AgradDistributionTestFixture, AgradDistributionNormal_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_11, AgradDistributionTestFixture, AgradDistributionNormal_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_12, AgradDistributionTestFixture, AgradDistributionNormal_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_13, AgradDistributionTestFixture, AgradDistributionNormal_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_14, AgradDistributionTestFixture, AgradDistributionNormal_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_15, AgradDistributionTestFixture, AgradDistributionNormal_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_16, AgradDistributionTestFixture, AgradDistributionNormal_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_17, AgradDistributionTestFixture, AgradDistributionNormal_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_18, AgradDistributionTestFixture, AgradDistributionNormal_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_19, AgradDistributionTestFixture, AgradDistributionNormal_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_20, AgradDistributionTestFixture, AgradDistributionNormal_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_21, AgradDistributionTestFixture, AgradDistributionNormal_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_22, AgradDistributionTestFixture, AgradDistributionNormal_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_23, AgradDistributionTestFixture, AgradDistributionNormal_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_24, AgradDistributionTestFixture, AgradDistributionNormal_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_25, AgradDistributionTestFixture, AgradDistributionNormal_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_26, AgradDistributionTestFixture, AgradDistributionNormal_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_27, AgradDistributionTestFixture, AgradDistributionNormal_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_28, AgradDistributionTestFixture, AgradDistributionNormal_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_29, AgradDistributionTestFixture, AgradDistributionNormal_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_30, AgradDistributionTestFixture, AgradDistributionNormal_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_31, AgradDistributionTestFixture, AgradDistributionNormal_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_32, AgradDistributionTestFixture, AgradDistributionNormal_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_33, AgradDistributionTestFixture, AgradDistributionNormal_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_34, AgradDistributionTestFixture, AgradDistributionNormal_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_35, AgradDistributionTestFixture, AgradDistributionNormal_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_36, AgradDistributionTestFixture, AgradDistributionNormal_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_37, AgradDistributionTestFixture, AgradDistributionNormal_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_38, AgradDistributionTestFixture, AgradDistributionNormal_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_39, AgradDistributionTestFixture, AgradDistributionNormal_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_40, AgradDistributionTestFixture, AgradDistributionNormal_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_41, AgradDistributionTestFixture, AgradDistributionNormal_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_42, AgradDistributionTestFixture, AgradDistributionNormal_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_43, AgradDistributionTestFixture, AgradDistributionNormal_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_44, AgradDistributionTestFixture, AgradDistributionNormal_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_45, AgradDistributionTestFixture, AgradDistributionNormal_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_46, AgradDistributionTestFixture, AgradDistributionNormal_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_47, AgradDistributionTestFixture, AgradDistributionNormal_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_48, AgradDistributionTestFixture, AgradDistributionNormal_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_49, AgradDistributionTestFixture, AgradDistributionNormal_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_50, AgradDistributionTestFixture, AgradDistributionNormal_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_51, AgradDistributionTestFixture, AgradDistributionNormal_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_52, AgradDistributionTestFixture, AgradDistributionNormal_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_53, AgradDistributionTestFixture, AgradDistributionNormal_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_54, AgradDistributionTestFixture, AgradDistributionNormal_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_55, AgradDistributionTestFixture, AgradDistributionNormal_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_56, AgradDistributionTestFixture, AgradDistributionNormal_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_57, AgradDistributionTestFixture, AgradDistributionNormal_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_58, AgradDistributionTestFixture, AgradDistributionNormal_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_59, AgradDistributionTestFixture, AgradDistributionNormal_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_60, AgradDistributionTestFixture, AgradDistributionNormal_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_61, AgradDistributionTestFixture, AgradDistributionNormal_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_62, AgradDistributionTestFixture, AgradDistributionNormal_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_63, AgradDistributionTestFixture, AgradDistributionNormal_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_64, AgradDistributionTestFixture, AgradDistributionNormal_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_65, AgradDistributionTestFixture, AgradDistributionNormal_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_66, AgradDistributionTestFixture, AgradDistributionNormal_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_67, AgradDistributionTestFixture, AgradDistributionNormal_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_68, AgradDistributionTestFixture, AgradDistributionNormal_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_69, AgradDistributionTestFixture, AgradDistributionNormal_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_70, AgradDistributionTestFixture, AgradDistributionNormal_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_71, AgradDistributionTestFixture, AgradDistributionNormal_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_72, AgradDistributionTestFixture, AgradDistributionNormal_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_73, AgradDistributionTestFixture, AgradDistributionNormal_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_74, AgradDistributionTestFixture, AgradDistributionNormal_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_75, AgradDistributionTestFixture, AgradDistributionNormal_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_76, AgradDistributionTestFixture, AgradDistributionNormal_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_77, AgradDistributionTestFixture, AgradDistributionNormal_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_78, AgradDistributionTestFixture, AgradDistributionNormal_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_79, AgradDistributionTestFixture, AgradDistributionNormal_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_80, AgradDistributionTestFixture, AgradDistributionNormal_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_81, AgradDistributionTestFixture, AgradDistributionNormal_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_82, AgradDistributionTestFixture, AgradDistributionNormal_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_83, AgradDistributionTestFixture, AgradDistributionNormal_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_84, AgradDistributionTestFixture, AgradDistributionNormal_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_85, AgradDistributionTestFixture, AgradDistributionNormal_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_86, AgradDistributionTestFixture, AgradDistributionNormal_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_87, AgradDistributionTestFixture, AgradDistributionNormal_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_88, AgradDistributionTestFixture, AgradDistributionNormal_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_89, AgradDistributionTestFixture, AgradDistributionNormal_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_90, AgradDistributionTestFixture, AgradDistributionNormal_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_91, AgradDistributionTestFixture, AgradDistributionNormal_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_92, AgradDistributionTestFixture, AgradDistributionNormal_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_93, AgradDistributionTestFixture, AgradDistributionNormal_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_94, AgradDistributionTestFixture, AgradDistributionNormal_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_95, AgradDistributionTestFixture, AgradDistributionNormal_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_96, AgradDistributionTestFixture, AgradDistributionNormal_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_97, AgradDistributionTestFixture, AgradDistributionNormal_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_98, AgradDistributionTestFixture, AgradDistributionNormal_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_99, AgradDistributionTestFixture, AgradDistributionNormal_v_99);
+
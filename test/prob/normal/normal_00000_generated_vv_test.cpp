@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionNormal, type_vv_0> AgradDistributionNormal_vv_0;
+typedef std::tuple<AgradDistributionNormal, type_vv_1> AgradDistributionNormal_vv_1;
+typedef std::tuple<AgradDistributionNormal, type_vv_2> AgradDistributionNormal_vv_2;
+typedef std::tuple<AgradDistributionNormal, type_vv_3> AgradDistributionNormal_vv_3;
+typedef std::tuple<AgradDistributionNormal, type_vv_4> AgradDistributionNormal_vv_4;
+typedef std::tuple<AgradDistributionNormal, type_vv_5> AgradDistributionNormal_vv_5;
+typedef std::tuple<AgradDistributionNormal, type_vv_6> AgradDistributionNormal_vv_6;
+typedef std::tuple<AgradDistributionNormal, type_vv_7> AgradDistributionNormal_vv_7;
+typedef std::tuple<AgradDistributionNormal, type_vv_8> AgradDistributionNormal_vv_8;
+typedef std::tuple<AgradDistributionNormal, type_vv_9> AgradDistributionNormal_vv_9;
+typedef std::tuple<AgradDistributionNormal, type_vv_10> AgradDistributionNormal_vv_10;
+typedef std::tuple<AgradDistributionNormal, type_vv_11> AgradDistributionNormal_vv_11;
+typedef std::tuple<AgradDistributionNormal, type_vv_12> AgradDistributionNormal_vv_12;
+typedef std::tuple<AgradDistributionNormal, type_vv_13> AgradDistributionNormal_vv_13;
+typedef std::tuple<AgradDistributionNormal, type_vv_14> AgradDistributionNormal_vv_14;
+typedef std::tuple<AgradDistributionNormal, type_vv_15> AgradDistributionNormal_vv_15;
+typedef std::tuple<AgradDistributionNormal, type_vv_16> AgradDistributionNormal_vv_16;
+typedef std::tuple<AgradDistributionNormal, type_vv_17> AgradDistributionNormal_vv_17;
+typedef std::tuple<AgradDistributionNormal, type_vv_18> AgradDistributionNormal_vv_18;
+typedef std::tuple<AgradDistributionNormal, type_vv_19> AgradDistributionNormal_vv_19;
+typedef std::tuple<AgradDistributionNormal, type_vv_20> AgradDistributionNormal_vv_20;
+typedef std::tuple<AgradDistributionNormal, type_vv_21> AgradDistributionNormal_vv_21;
+typedef std::tuple<AgradDistributionNormal, type_vv_22> AgradDistributionNormal_vv_22;
+typedef std::tuple<AgradDistributionNormal, type_vv_23> AgradDistributionNormal_vv_23;
+typedef std::tuple<AgradDistributionNormal, type_vv_24> AgradDistributionNormal_vv_24;
+typedef std::tuple<AgradDistributionNormal, type_vv_25> AgradDistributionNormal_vv_25;
+typedef std::tuple<AgradDistributionNormal, type_vv_26> AgradDistributionNormal_vv_26;
+typedef std::tuple<AgradDistributionNormal, type_vv_27> AgradDistributionNormal_vv_27;
+typedef std::tuple<AgradDistributionNormal, type_vv_28> AgradDistributionNormal_vv_28;
+typedef std::tuple<AgradDistributionNormal, type_vv_29> AgradDistributionNormal_vv_29;
+typedef std::tuple<AgradDistributionNormal, type_vv_30> AgradDistributionNormal_vv_30;
+typedef std::tuple<AgradDistributionNormal, type_vv_31> AgradDistributionNormal_vv_31;
+typedef std::tuple<AgradDistributionNormal, type_vv_32> AgradDistributionNormal_vv_32;
+typedef std::tuple<AgradDistributionNormal, type_vv_33> AgradDistributionNormal_vv_33;
+typedef std::tuple<AgradDistributionNormal, type_vv_34> AgradDistributionNormal_vv_34;
+typedef std::tuple<AgradDistributionNormal, type_vv_35> AgradDistributionNormal_vv_35;
+typedef std::tuple<AgradDistributionNormal, type_vv_36> AgradDistributionNormal_vv_36;
+typedef std::tuple<AgradDistributionNormal, type_vv_37> AgradDistributionNormal_vv_37;
+typedef std::tuple<AgradDistributionNormal, type_vv_38> AgradDistributionNormal_vv_38;
+typedef std::tuple<AgradDistributionNormal, type_vv_39> AgradDistributionNormal_vv_39;
+typedef std::tuple<AgradDistributionNormal, type_vv_40> AgradDistributionNormal_vv_40;
+typedef std::tuple<AgradDistributionNormal, type_vv_41> AgradDistributionNormal_vv_41;
+typedef std::tuple<AgradDistributionNormal, type_vv_42> AgradDistributionNormal_vv_42;
+typedef std::tuple<AgradDistributionNormal, type_vv_43> AgradDistributionNormal_vv_43;
+typedef std::tuple<AgradDistributionNormal, type_vv_44> AgradDistributionNormal_vv_44;
+typedef std::tuple<AgradDistributionNormal, type_vv_45> AgradDistributionNormal_vv_45;
+typedef std::tuple<AgradDistributionNormal, type_vv_46> AgradDistributionNormal_vv_46;
+typedef std::tuple<AgradDistributionNormal, type_vv_47> AgradDistributionNormal_vv_47;
+typedef std::tuple<AgradDistributionNormal, type_vv_48> AgradDistributionNormal_vv_48;
+typedef std::tuple<AgradDistributionNormal, type_vv_49> AgradDistributionNormal_vv_49;
+typedef std::tuple<AgradDistributionNormal, type_vv_50> AgradDistributionNormal_vv_50;
+typedef std::tuple<AgradDistributionNormal, type_vv_51> AgradDistributionNormal_vv_51;
+typedef std::tuple<AgradDistributionNormal, type_vv_52> AgradDistributionNormal_vv_52;
+typedef std::tuple<AgradDistributionNormal, type_vv_53> AgradDistributionNormal_vv_53;
+typedef std::tuple<AgradDistributionNormal, type_vv_54> AgradDistributionNormal_vv_54;
+typedef std::tuple<AgradDistributionNormal, type_vv_55> AgradDistributionNormal_vv_55;
+typedef std::tuple<AgradDistributionNormal, type_vv_56> AgradDistributionNormal_vv_56;
+typedef std::tuple<AgradDistributionNormal, type_vv_57> AgradDistributionNormal_vv_57;
+typedef std::tuple<AgradDistributionNormal, type_vv_58> AgradDistributionNormal_vv_58;
+typedef std::tuple<AgradDistributionNormal, type_vv_59> AgradDistributionNormal_vv_59;
+typedef std::tuple<AgradDistributionNormal, type_vv_60> AgradDistributionNormal_vv_60;
+typedef std::tuple<AgradDistributionNormal, type_vv_61> AgradDistributionNormal_vv_61;
+typedef std::tuple<AgradDistributionNormal, type_vv_62> AgradDistributionNormal_vv_62;
+typedef std::tuple<AgradDistributionNormal, type_vv_63> AgradDistributionNormal_vv_63;
+typedef std::tuple<AgradDistributionNormal, type_vv_64> AgradDistributionNormal_vv_64;
+typedef std::tuple<AgradDistributionNormal, type_vv_65> AgradDistributionNormal_vv_65;
+typedef std::tuple<AgradDistributionNormal, type_vv_66> AgradDistributionNormal_vv_66;
+typedef std::tuple<AgradDistributionNormal, type_vv_67> AgradDistributionNormal_vv_67;
+typedef std::tuple<AgradDistributionNormal, type_vv_68> AgradDistributionNormal_vv_68;
+typedef std::tuple<AgradDistributionNormal, type_vv_69> AgradDistributionNormal_vv_69;
+typedef std::tuple<AgradDistributionNormal, type_vv_70> AgradDistributionNormal_vv_70;
+typedef std::tuple<AgradDistributionNormal, type_vv_71> AgradDistributionNormal_vv_71;
+typedef std::tuple<AgradDistributionNormal, type_vv_72> AgradDistributionNormal_vv_72;
+typedef std::tuple<AgradDistributionNormal, type_vv_73> AgradDistributionNormal_vv_73;
+typedef std::tuple<AgradDistributionNormal, type_vv_74> AgradDistributionNormal_vv_74;
+typedef std::tuple<AgradDistributionNormal, type_vv_75> AgradDistributionNormal_vv_75;
+typedef std::tuple<AgradDistributionNormal, type_vv_76> AgradDistributionNormal_vv_76;
+typedef std::tuple<AgradDistributionNormal, type_vv_77> AgradDistributionNormal_vv_77;
+typedef std::tuple<AgradDistributionNormal, type_vv_78> AgradDistributionNormal_vv_78;
+typedef std::tuple<AgradDistributionNormal, type_vv_79> AgradDistributionNormal_vv_79;
+typedef std::tuple<AgradDistributionNormal, type_vv_80> AgradDistributionNormal_vv_80;
+typedef std::tuple<AgradDistributionNormal, type_vv_81> AgradDistributionNormal_vv_81;
+typedef std::tuple<AgradDistributionNormal, type_vv_82> AgradDistributionNormal_vv_82;
+typedef std::tuple<AgradDistributionNormal, type_vv_83> AgradDistributionNormal_vv_83;
+typedef std::tuple<AgradDistributionNormal, type_vv_84> AgradDistributionNormal_vv_84;
+typedef std::tuple<AgradDistributionNormal, type_vv_85> AgradDistributionNormal_vv_85;
+typedef std::tuple<AgradDistributionNormal, type_vv_86> AgradDistributionNormal_vv_86;
+typedef std::tuple<AgradDistributionNormal, type_vv_87> AgradDistributionNormal_vv_87;
+typedef std::tuple<AgradDistributionNormal, type_vv_88> AgradDistributionNormal_vv_88;
+typedef std::tuple<AgradDistributionNormal, type_vv_89> AgradDistributionNormal_vv_89;
+typedef std::tuple<AgradDistributionNormal, type_vv_90> AgradDistributionNormal_vv_90;
+typedef std::tuple<AgradDistributionNormal, type_vv_91> AgradDistributionNormal_vv_91;
+typedef std::tuple<AgradDistributionNormal, type_vv_92> AgradDistributionNormal_vv_92;
+typedef std::tuple<AgradDistributionNormal, type_vv_93> AgradDistributionNormal_vv_93;
+typedef std::tuple<AgradDistributionNormal, type_vv_94> AgradDistributionNormal_vv_94;
+typedef std::tuple<AgradDistributionNormal, type_vv_95> AgradDistributionNormal_vv_95;
+typedef std::tuple<AgradDistributionNormal, type_vv_96> AgradDistributionNormal_vv_96;
+typedef std::tuple<AgradDistributionNormal, type_vv_97> AgradDistributionNormal_vv_97;
+typedef std::tuple<AgradDistributionNormal, type_vv_98> AgradDistributionNormal_vv_98;
+typedef std::tuple<AgradDistributionNormal, type_vv_99> AgradDistributionNormal_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_0, AgradDistributionTestFixture, AgradDistributionNormal_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_1, AgradDistributionTestFixture, AgradDistributionNormal_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_2, AgradDistributionTestFixture, AgradDistributionNormal_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_3, AgradDistributionTestFixture, AgradDistributionNormal_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_4, AgradDistributionTestFixture, AgradDistributionNormal_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_5, AgradDistributionTestFixture, AgradDistributionNormal_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_6, AgradDistributionTestFixture, AgradDistributionNormal_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_7, AgradDistributionTestFixture, AgradDistributionNormal_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_8, AgradDistributionTestFixture, AgradDistributionNormal_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_9, AgradDistributionTestFixture, AgradDistributionNormal_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_10, AgradDistributionTestFixture, AgradDistributionNormal_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_11, AgradDistributionTestFixture, AgradDistributionNormal_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_12, AgradDistributionTestFixture, AgradDistributionNormal_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_13, AgradDistributionTestFixture, AgradDistributionNormal_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_14, AgradDistributionTestFixture, AgradDistributionNormal_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_15, AgradDistributionTestFixture, AgradDistributionNormal_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_16, AgradDistributionTestFixture, AgradDistributionNormal_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_17, AgradDistributionTestFixture, AgradDistributionNormal_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_18, AgradDistributionTestFixture, AgradDistributionNormal_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_19, AgradDistributionTestFixture, AgradDistributionNormal_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_20, AgradDistributionTestFixture, AgradDistributionNormal_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_21, AgradDistributionTestFixture, AgradDistributionNormal_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_22, AgradDistributionTestFixture, AgradDistributionNormal_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_23, AgradDistributionTestFixture, AgradDistributionNormal_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_24, AgradDistributionTestFixture, AgradDistributionNormal_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_25, AgradDistributionTestFixture, AgradDistributionNormal_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_26, AgradDistributionTestFixture, AgradDistributionNormal_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_27, AgradDistributionTestFixture, AgradDistributionNormal_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_28, AgradDistributionTestFixture, AgradDistributionNormal_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_29, AgradDistributionTestFixture, AgradDistributionNormal_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_30, AgradDistributionTestFixture, AgradDistributionNormal_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_31, AgradDistributionTestFixture, AgradDistributionNormal_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_32, AgradDistributionTestFixture, AgradDistributionNormal_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_33, AgradDistributionTestFixture, AgradDistributionNormal_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_34, AgradDistributionTestFixture, AgradDistributionNormal_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_35, AgradDistributionTestFixture, AgradDistributionNormal_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_36, AgradDistributionTestFixture, AgradDistributionNormal_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_37, AgradDistributionTestFixture, AgradDistributionNormal_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_38, AgradDistributionTestFixture, AgradDistributionNormal_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_39, AgradDistributionTestFixture, AgradDistributionNormal_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_40, AgradDistributionTestFixture, AgradDistributionNormal_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_41, AgradDistributionTestFixture, AgradDistributionNormal_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_42, AgradDistributionTestFixture, AgradDistributionNormal_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_43, AgradDistributionTestFixture, AgradDistributionNormal_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_44, AgradDistributionTestFixture, AgradDistributionNormal_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_45, AgradDistributionTestFixture, AgradDistributionNormal_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_46, AgradDistributionTestFixture, AgradDistributionNormal_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_47, AgradDistributionTestFixture, AgradDistributionNormal_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_48, AgradDistributionTestFixture, AgradDistributionNormal_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_49, AgradDistributionTestFixture, AgradDistributionNormal_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_50, AgradDistributionTestFixture, AgradDistributionNormal_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_51, AgradDistributionTestFixture, AgradDistributionNormal_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_52, AgradDistributionTestFixture, AgradDistributionNormal_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_53, AgradDistributionTestFixture, AgradDistributionNormal_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_54, AgradDistributionTestFixture, AgradDistributionNormal_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_55, AgradDistributionTestFixture, AgradDistributionNormal_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_56, AgradDistributionTestFixture, AgradDistributionNormal_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_57, AgradDistributionTestFixture, AgradDistributionNormal_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_58, AgradDistributionTestFixture, AgradDistributionNormal_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_59, AgradDistributionTestFixture, AgradDistributionNormal_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_60, AgradDistributionTestFixture, AgradDistributionNormal_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_61, AgradDistributionTestFixture, AgradDistributionNormal_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_62, AgradDistributionTestFixture, AgradDistributionNormal_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_63, AgradDistributionTestFixture, AgradDistributionNormal_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_64, AgradDistributionTestFixture, AgradDistributionNormal_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_65, AgradDistributionTestFixture, AgradDistributionNormal_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_66, AgradDistributionTestFixture, AgradDistributionNormal_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_67, AgradDistributionTestFixture, AgradDistributionNormal_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_68, AgradDistributionTestFixture, AgradDistributionNormal_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_69, AgradDistributionTestFixture, AgradDistributionNormal_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_70, AgradDistributionTestFixture, AgradDistributionNormal_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_71, AgradDistributionTestFixture, AgradDistributionNormal_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_72, AgradDistributionTestFixture, AgradDistributionNormal_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_73, AgradDistributionTestFixture, AgradDistributionNormal_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_74, AgradDistributionTestFixture, AgradDistributionNormal_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_75, AgradDistributionTestFixture, AgradDistributionNormal_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_76, AgradDistributionTestFixture, AgradDistributionNormal_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_77, AgradDistributionTestFixture, AgradDistributionNormal_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_78, AgradDistributionTestFixture, AgradDistributionNormal_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_79, AgradDistributionTestFixture, AgradDistributionNormal_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_80, AgradDistributionTestFixture, AgradDistributionNormal_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_81, AgradDistributionTestFixture, AgradDistributionNormal_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_82, AgradDistributionTestFixture, AgradDistributionNormal_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_83, AgradDistributionTestFixture, AgradDistributionNormal_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_84, AgradDistributionTestFixture, AgradDistributionNormal_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_85, AgradDistributionTestFixture, AgradDistributionNormal_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_86, AgradDistributionTestFixture, AgradDistributionNormal_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_87, AgradDistributionTestFixture, AgradDistributionNormal_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_88, AgradDistributionTestFixture, AgradDistributionNormal_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_89, AgradDistributionTestFixture, AgradDistributionNormal_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_90, AgradDistributionTestFixture, AgradDistributionNormal_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_91, AgradDistributionTestFixture, AgradDistributionNormal_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_92, AgradDistributionTestFixture, AgradDistributionNormal_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_93, AgradDistributionTestFixture, AgradDistributionNormal_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_94, AgradDistributionTestFixture, AgradDistributionNormal_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_95, AgradDistributionTestFixture, AgradDistributionNormal_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_96, AgradDistributionTestFixture, AgradDistributionNormal_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_97, AgradDistributionTestFixture, AgradDistributionNormal_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_98, AgradDistributionTestFixture, AgradDistributionNormal_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_99, AgradDistributionTestFixture, AgradDistributionNormal_vv_99);
+
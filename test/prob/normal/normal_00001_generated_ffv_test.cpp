@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradDistributionNormal, type_ffv_100> AgradDistributionNormal_ffv_100;
+typedef std::tuple<AgradDistributionNormal, type_ffv_101> AgradDistributionNormal_ffv_101;
+typedef std::tuple<AgradDistributionNormal, type_ffv_102> AgradDistributionNormal_ffv_102;
+typedef std::tuple<AgradDistributionNormal, type_ffv_103> AgradDistributionNormal_ffv_103;
+typedef std::tuple<AgradDistributionNormal, type_ffv_104> AgradDistributionNormal_ffv_104;
+typedef std::tuple<AgradDistributionNormal, type_ffv_105> AgradDistributionNormal_ffv_105;
+typedef std::tuple<AgradDistributionNormal, type_ffv_106> AgradDistributionNormal_ffv_106;
+typedef std::tuple<AgradDistributionNormal, type_ffv_107> AgradDistributionNormal_ffv_107;
+typedef std::tuple<AgradDistributionNormal, type_ffv_108> AgradDistributionNormal_ffv_108;
+typedef std::tuple<AgradDistributionNormal, type_ffv_109> AgradDistributionNormal_ffv_109;
+typedef std::tuple<AgradDistributionNormal, type_ffv_110> AgradDistributionNormal_ffv_110;
+typedef std::tuple<AgradDistributionNormal, type_ffv_111> AgradDistributionNormal_ffv_111;
+typedef std::tuple<AgradDistributionNormal, type_ffv_112> AgradDistributionNormal_ffv_112;
+typedef std::tuple<AgradDistributionNormal, type_ffv_113> AgradDistributionNormal_ffv_113;
+typedef std::tuple<AgradDistributionNormal, type_ffv_114> AgradDistributionNormal_ffv_114;
+typedef std::tuple<AgradDistributionNormal, type_ffv_115> AgradDistributionNormal_ffv_115;
+typedef std::tuple<AgradDistributionNormal, type_ffv_116> AgradDistributionNormal_ffv_116;
+typedef std::tuple<AgradDistributionNormal, type_ffv_117> AgradDistributionNormal_ffv_117;
+typedef std::tuple<AgradDistributionNormal, type_ffv_118> AgradDistributionNormal_ffv_118;
+typedef std::tuple<AgradDistributionNormal, type_ffv_119> AgradDistributionNormal_ffv_119;
+typedef std::tuple<AgradDistributionNormal, type_ffv_120> AgradDistributionNormal_ffv_120;
+typedef std::tuple<AgradDistributionNormal, type_ffv_121> AgradDistributionNormal_ffv_121;
+typedef std::tuple<AgradDistributionNormal, type_ffv_122> AgradDistributionNormal_ffv_122;
+typedef std::tuple<AgradDistributionNormal, type_ffv_123> AgradDistributionNormal_ffv_123;
+typedef std::tuple<AgradDistributionNormal, type_ffv_124> AgradDistributionNormal_ffv_124;
+typedef std::tuple<AgradDistributionNormal, type_ffv_125> AgradDistributionNormal_ffv_125;
+typedef std::tuple<AgradDistributionNormal, type_ffv_126> AgradDistributionNormal_ffv_126;
+typedef std::tuple<AgradDistributionNormal, type_ffv_127> AgradDistributionNormal_ffv_127;
+typedef std::tuple<AgradDistributionNormal, type_ffv_128> AgradDistributionNormal_ffv_128;
+typedef std::tuple<AgradDistributionNormal, type_ffv_129> AgradDistributionNormal_ffv_129;
+typedef std::tuple<AgradDistributionNormal, type_ffv_130> AgradDistributionNormal_ffv_130;
+typedef std::tuple<AgradDistributionNormal, type_ffv_131> AgradDistributionNormal_ffv_131;
+typedef std::tuple<AgradDistributionNormal, type_ffv_132> AgradDistributionNormal_ffv_132;
+typedef std::tuple<AgradDistributionNormal, type_ffv_133> AgradDistributionNormal_ffv_133;
+typedef std::tuple<AgradDistributionNormal, type_ffv_134> AgradDistributionNormal_ffv_134;
+typedef std::tuple<AgradDistributionNormal, type_ffv_135> AgradDistributionNormal_ffv_135;
+typedef std::tuple<AgradDistributionNormal, type_ffv_136> AgradDistributionNormal_ffv_136;
+typedef std::tuple<AgradDistributionNormal, type_ffv_137> AgradDistributionNormal_ffv_137;
+typedef std::tuple<AgradDistributionNormal, type_ffv_138> AgradDistributionNormal_ffv_138;
+typedef std::tuple<AgradDistributionNormal, type_ffv_139> AgradDistributionNormal_ffv_139;
+typedef std::tuple<AgradDistributionNormal, type_ffv_140> AgradDistributionNormal_ffv_140;
+typedef std::tuple<AgradDistributionNormal, type_ffv_141> AgradDistributionNormal_ffv_141;
+typedef std::tuple<AgradDistributionNormal, type_ffv_142> AgradDistributionNormal_ffv_142;
+typedef std::tuple<AgradDistributionNormal, type_ffv_143> AgradDistributionNormal_ffv_143;
+typedef std::tuple<AgradDistributionNormal, type_ffv_144> AgradDistributionNormal_ffv_144;
+typedef std::tuple<AgradDistributionNormal, type_ffv_145> AgradDistributionNormal_ffv_145;
+typedef std::tuple<AgradDistributionNormal, type_ffv_146> AgradDistributionNormal_ffv_146;
+typedef std::tuple<AgradDistributionNormal, type_ffv_147> AgradDistributionNormal_ffv_147;
+typedef std::tuple<AgradDistributionNormal, type_ffv_148> AgradDistributionNormal_ffv_148;
+typedef std::tuple<AgradDistributionNormal, type_ffv_149> AgradDistributionNormal_ffv_149;
+typedef std::tuple<AgradDistributionNormal, type_ffv_150> AgradDistributionNormal_ffv_150;
+typedef std::tuple<AgradDistributionNormal, type_ffv_151> AgradDistributionNormal_ffv_151;
+typedef std::tuple<AgradDistributionNormal, type_ffv_152> AgradDistributionNormal_ffv_152;
+typedef std::tuple<AgradDistributionNormal, type_ffv_153> AgradDistributionNormal_ffv_153;
+typedef std::tuple<AgradDistributionNormal, type_ffv_154> AgradDistributionNormal_ffv_154;
+typedef std::tuple<AgradDistributionNormal, type_ffv_155> AgradDistributionNormal_ffv_155;
+typedef std::tuple<AgradDistributionNormal, type_ffv_156> AgradDistributionNormal_ffv_156;
+typedef std::tuple<AgradDistributionNormal, type_ffv_157> AgradDistributionNormal_ffv_157;
+typedef std::tuple<AgradDistributionNormal, type_ffv_158> AgradDistributionNormal_ffv_158;
+typedef std::tuple<AgradDistributionNormal, type_ffv_159> AgradDistributionNormal_ffv_159;
+typedef std::tuple<AgradDistributionNormal, type_ffv_160> AgradDistributionNormal_ffv_160;
+typedef std::tuple<AgradDistributionNormal, type_ffv_161> AgradDistributionNormal_ffv_161;
+typedef std::tuple<AgradDistributionNormal, type_ffv_162> AgradDistributionNormal_ffv_162;
+typedef std::tuple<AgradDistributionNormal, type_ffv_163> AgradDistributionNormal_ffv_163;
+typedef std::tuple<AgradDistributionNormal, type_ffv_164> AgradDistributionNormal_ffv_164;
+typedef std::tuple<AgradDistributionNormal, type_ffv_165> AgradDistributionNormal_ffv_165;
+typedef std::tuple<AgradDistributionNormal, type_ffv_166> AgradDistributionNormal_ffv_166;
+typedef std::tuple<AgradDistributionNormal, type_ffv_167> AgradDistributionNormal_ffv_167;
+typedef std::tuple<AgradDistributionNormal, type_ffv_168> AgradDistributionNormal_ffv_168;
+typedef std::tuple<AgradDistributionNormal, type_ffv_169> AgradDistributionNormal_ffv_169;
+typedef std::tuple<AgradDistributionNormal, type_ffv_170> AgradDistributionNormal_ffv_170;
+typedef std::tuple<AgradDistributionNormal, type_ffv_171> AgradDistributionNormal_ffv_171;
+typedef std::tuple<AgradDistributionNormal, type_ffv_172> AgradDistributionNormal_ffv_172;
+typedef std::tuple<AgradDistributionNormal, type_ffv_173> AgradDistributionNormal_ffv_173;
+typedef std::tuple<AgradDistributionNormal, type_ffv_174> AgradDistributionNormal_ffv_174;
+typedef std::tuple<AgradDistributionNormal, type_ffv_175> AgradDistributionNormal_ffv_175;
+typedef std::tuple<AgradDistributionNormal, type_ffv_176> AgradDistributionNormal_ffv_176;
+typedef std::tuple<AgradDistributionNormal, type_ffv_177> AgradDistributionNormal_ffv_177;
+typedef std::tuple<AgradDistributionNormal, type_ffv_178> AgradDistributionNormal_ffv_178;
+typedef std::tuple<AgradDistributionNormal, type_ffv_179> AgradDistributionNormal_ffv_179;
+typedef std::tuple<AgradDistributionNormal, type_ffv_180> AgradDistributionNormal_ffv_180;
+typedef std::tuple<AgradDistributionNormal, type_ffv_181> AgradDistributionNormal_ffv_181;
+typedef std::tuple<AgradDistributionNormal, type_ffv_182> AgradDistributionNormal_ffv_182;
+typedef std::tuple<AgradDistributionNormal, type_ffv_183> AgradDistributionNormal_ffv_183;
+typedef std::tuple<AgradDistributionNormal, type_ffv_184> AgradDistributionNormal_ffv_184;
+typedef std::tuple<AgradDistributionNormal, type_ffv_185> AgradDistributionNormal_ffv_185;
+typedef std::tuple<AgradDistributionNormal, type_ffv_186> AgradDistributionNormal_ffv_186;
+typedef std::tuple<AgradDistributionNormal, type_ffv_187> AgradDistributionNormal_ffv_187;
+typedef std::tuple<AgradDistributionNormal, type_ffv_188> AgradDistributionNormal_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_100, AgradDistributionTestFixture, AgradDistributionNormal_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_101, AgradDistributionTestFixture, AgradDistributionNormal_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_102, AgradDistributionTestFixture, AgradDistributionNormal_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_103, AgradDistributionTestFixture, AgradDistributionNormal_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_104, AgradDistributionTestFixture, AgradDistributionNormal_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_105, AgradDistributionTestFixture, AgradDistributionNormal_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_106, AgradDistributionTestFixture, AgradDistributionNormal_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_107, AgradDistributionTestFixture, AgradDistributionNormal_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_108, AgradDistributionTestFixture, AgradDistributionNormal_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_109, AgradDistributionTestFixture, AgradDistributionNormal_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_110, AgradDistributionTestFixture, AgradDistributionNormal_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_111, AgradDistributionTestFixture, AgradDistributionNormal_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_112, AgradDistributionTestFixture, AgradDistributionNormal_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_113, AgradDistributionTestFixture, AgradDistributionNormal_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_114, AgradDistributionTestFixture, AgradDistributionNormal_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_115, AgradDistributionTestFixture, AgradDistributionNormal_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_116, AgradDistributionTestFixture, AgradDistributionNormal_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_117, AgradDistributionTestFixture, AgradDistributionNormal_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_118, AgradDistributionTestFixture, AgradDistributionNormal_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_119, AgradDistributionTestFixture, AgradDistributionNormal_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_120, AgradDistributionTestFixture, AgradDistributionNormal_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_121, AgradDistributionTestFixture, AgradDistributionNormal_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_122, AgradDistributionTestFixture, AgradDistributionNormal_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_123, AgradDistributionTestFixture, AgradDistributionNormal_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_124, AgradDistributionTestFixture, AgradDistributionNormal_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_125, AgradDistributionTestFixture, AgradDistributionNormal_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_126, AgradDistributionTestFixture, AgradDistributionNormal_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_127, AgradDistributionTestFixture, AgradDistributionNormal_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_128, AgradDistributionTestFixture, AgradDistributionNormal_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_129, AgradDistributionTestFixture, AgradDistributionNormal_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_130, AgradDistributionTestFixture, AgradDistributionNormal_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_131, AgradDistributionTestFixture, AgradDistributionNormal_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_132, AgradDistributionTestFixture, AgradDistributionNormal_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_133, AgradDistributionTestFixture, AgradDistributionNormal_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_134, AgradDistributionTestFixture, AgradDistributionNormal_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_135, AgradDistributionTestFixture, AgradDistributionNormal_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_136, AgradDistributionTestFixture, AgradDistributionNormal_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_137, AgradDistributionTestFixture, AgradDistributionNormal_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_138, AgradDistributionTestFixture, AgradDistributionNormal_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_139, AgradDistributionTestFixture, AgradDistributionNormal_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_140, AgradDistributionTestFixture, AgradDistributionNormal_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_141, AgradDistributionTestFixture, AgradDistributionNormal_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_142, AgradDistributionTestFixture, AgradDistributionNormal_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_143, AgradDistributionTestFixture, AgradDistributionNormal_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_144, AgradDistributionTestFixture, AgradDistributionNormal_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_145, AgradDistributionTestFixture, AgradDistributionNormal_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_146, AgradDistributionTestFixture, AgradDistributionNormal_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_147, AgradDistributionTestFixture, AgradDistributionNormal_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_148, AgradDistributionTestFixture, AgradDistributionNormal_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_149, AgradDistributionTestFixture, AgradDistributionNormal_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_150, AgradDistributionTestFixture, AgradDistributionNormal_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_151, AgradDistributionTestFixture, AgradDistributionNormal_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_152, AgradDistributionTestFixture, AgradDistributionNormal_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_153, AgradDistributionTestFixture, AgradDistributionNormal_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_154, AgradDistributionTestFixture, AgradDistributionNormal_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_155, AgradDistributionTestFixture, AgradDistributionNormal_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_156, AgradDistributionTestFixture, AgradDistributionNormal_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_157, AgradDistributionTestFixture, AgradDistributionNormal_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_158, AgradDistributionTestFixture, AgradDistributionNormal_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_159, AgradDistributionTestFixture, AgradDistributionNormal_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_160, AgradDistributionTestFixture, AgradDistributionNormal_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_161, AgradDistributionTestFixture, AgradDistributionNormal_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_162, AgradDistributionTestFixture, AgradDistributionNormal_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_163, AgradDistributionTestFixture, AgradDistributionNormal_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_164, AgradDistributionTestFixture, AgradDistributionNormal_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_165, AgradDistributionTestFixture, AgradDistributionNormal_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_166, AgradDistributionTestFixture, AgradDistributionNormal_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_167, AgradDistributionTestFixture, AgradDistributionNormal_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_168, AgradDistributionTestFixture, AgradDistributionNormal_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_169, AgradDistributionTestFixture, AgradDistributionNormal_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_170, AgradDistributionTestFixture, AgradDistributionNormal_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_171, AgradDistributionTestFixture, AgradDistributionNormal_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_172, AgradDistributionTestFixture, AgradDistributionNormal_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_173, AgradDistributionTestFixture, AgradDistributionNormal_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_174, AgradDistributionTestFixture, AgradDistributionNormal_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_175, AgradDistributionTestFixture, AgradDistributionNormal_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_176, AgradDistributionTestFixture, AgradDistributionNormal_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_177, AgradDistributionTestFixture, AgradDistributionNormal_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_178, AgradDistributionTestFixture, AgradDistributionNormal_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_179, AgradDistributionTestFixture, AgradDistributionNormal_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_180, AgradDistributionTestFixture, AgradDistributionNormal_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_181, AgradDistributionTestFixture, AgradDistributionNormal_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_182, AgradDistributionTestFixture, AgradDistributionNormal_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_183, AgradDistributionTestFixture, AgradDistributionNormal_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_184, AgradDistributionTestFixture, AgradDistributionNormal_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_185, AgradDistributionTestFixture, AgradDistributionNormal_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_186, AgradDistributionTestFixture, AgradDistributionNormal_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_187, AgradDistributionTestFixture, AgradDistributionNormal_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_ffv_188, AgradDistributionTestFixture, AgradDistributionNormal_ffv_188);
+
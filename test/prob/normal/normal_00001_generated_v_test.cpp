@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionNormal, type_v_100> AgradDistributionNormal_v_100;
+typedef std::tuple<AgradDistributionNormal, type_v_101> AgradDistributionNormal_v_101;
+typedef std::tuple<AgradDistributionNormal, type_v_102> AgradDistributionNormal_v_102;
+typedef std::tuple<AgradDistributionNormal, type_v_103> AgradDistributionNormal_v_103;
+typedef std::tuple<AgradDistributionNormal, type_v_104> AgradDistributionNormal_v_104;
+typedef std::tuple<AgradDistributionNormal, type_v_105> AgradDistributionNormal_v_105;
+typedef std::tuple<AgradDistributionNormal, type_v_106> AgradDistributionNormal_v_106;
+typedef std::tuple<AgradDistributionNormal, type_v_107> AgradDistributionNormal_v_107;
+typedef std::tuple<AgradDistributionNormal, type_v_108> AgradDistributionNormal_v_108;
+typedef std::tuple<AgradDistributionNormal, type_v_109> AgradDistributionNormal_v_109;
+typedef std::tuple<AgradDistributionNormal, type_v_110> AgradDistributionNormal_v_110;
+typedef std::tuple<AgradDistributionNormal, type_v_111> AgradDistributionNormal_v_111;
+typedef std::tuple<AgradDistributionNormal, type_v_112> AgradDistributionNormal_v_112;
+typedef std::tuple<AgradDistributionNormal, type_v_113> AgradDistributionNormal_v_113;
+typedef std::tuple<AgradDistributionNormal, type_v_114> AgradDistributionNormal_v_114;
+typedef std::tuple<AgradDistributionNormal, type_v_115> AgradDistributionNormal_v_115;
+typedef std::tuple<AgradDistributionNormal, type_v_116> AgradDistributionNormal_v_116;
+typedef std::tuple<AgradDistributionNormal, type_v_117> AgradDistributionNormal_v_117;
+typedef std::tuple<AgradDistributionNormal, type_v_118> AgradDistributionNormal_v_118;
+typedef std::tuple<AgradDistributionNormal, type_v_119> AgradDistributionNormal_v_119;
+typedef std::tuple<AgradDistributionNormal, type_v_120> AgradDistributionNormal_v_120;
+typedef std::tuple<AgradDistributionNormal, type_v_121> AgradDistributionNormal_v_121;
+typedef std::tuple<AgradDistributionNormal, type_v_122> AgradDistributionNormal_v_122;
+typedef std::tuple<AgradDistributionNormal, type_v_123> AgradDistributionNormal_v_123;
+typedef std::tuple<AgradDistributionNormal, type_v_124> AgradDistributionNormal_v_124;
+typedef std::tuple<AgradDistributionNormal, type_v_125> AgradDistributionNormal_v_125;
+typedef std::tuple<AgradDistributionNormal, type_v_126> AgradDistributionNormal_v_126;
+typedef std::tuple<AgradDistributionNormal, type_v_127> AgradDistributionNormal_v_127;
+typedef std::tuple<AgradDistributionNormal, type_v_128> AgradDistributionNormal_v_128;
+typedef std::tuple<AgradDistributionNormal, type_v_129> AgradDistributionNormal_v_129;
+typedef std::tuple<AgradDistributionNormal, type_v_130> AgradDistributionNormal_v_130;
+typedef std::tuple<AgradDistributionNormal, type_v_131> AgradDistributionNormal_v_131;
+typedef std::tuple<AgradDistributionNormal, type_v_132> AgradDistributionNormal_v_132;
+typedef std::tuple<AgradDistributionNormal, type_v_133> AgradDistributionNormal_v_133;
+typedef std::tuple<AgradDistributionNormal, type_v_134> AgradDistributionNormal_v_134;
+typedef std::tuple<AgradDistributionNormal, type_v_135> AgradDistributionNormal_v_135;
+typedef std::tuple<AgradDistributionNormal, type_v_136> AgradDistributionNormal_v_136;
+typedef std::tuple<AgradDistributionNormal, type_v_137> AgradDistributionNormal_v_137;
+typedef std::tuple<AgradDistributionNormal, type_v_138> AgradDistributionNormal_v_138;
+typedef std::tuple<AgradDistributionNormal, type_v_139> AgradDistributionNormal_v_139;
+typedef std::tuple<AgradDistributionNormal, type_v_140> AgradDistributionNormal_v_140;
+typedef std::tuple<AgradDistributionNormal, type_v_141> AgradDistributionNormal_v_141;
+typedef std::tuple<AgradDistributionNormal, type_v_142> AgradDistributionNormal_v_142;
+typedef std::tuple<AgradDistributionNormal, type_v_143> AgradDistributionNormal_v_143;
+typedef std::tuple<AgradDistributionNormal, type_v_144> AgradDistributionNormal_v_144;
+typedef std::tuple<AgradDistributionNormal, type_v_145> AgradDistributionNormal_v_145;
+typedef std::tuple<AgradDistributionNormal, type_v_146> AgradDistributionNormal_v_146;
+typedef std::tuple<AgradDistributionNormal, type_v_147> AgradDistributionNormal_v_147;
+typedef std::tuple<AgradDistributionNormal, type_v_148> AgradDistributionNormal_v_148;
+typedef std::tuple<AgradDistributionNormal, type_v_149> AgradDistributionNormal_v_149;
+typedef std::tuple<AgradDistributionNormal, type_v_150> AgradDistributionNormal_v_150;
+typedef std::tuple<AgradDistributionNormal, type_v_151> AgradDistributionNormal_v_151;
+typedef std::tuple<AgradDistributionNormal, type_v_152> AgradDistributionNormal_v_152;
+typedef std::tuple<AgradDistributionNormal, type_v_153> AgradDistributionNormal_v_153;
+typedef std::tuple<AgradDistributionNormal, type_v_154> AgradDistributionNormal_v_154;
+typedef std::tuple<AgradDistributionNormal, type_v_155> AgradDistributionNormal_v_155;
+typedef std::tuple<AgradDistributionNormal, type_v_156> AgradDistributionNormal_v_156;
+typedef std::tuple<AgradDistributionNormal, type_v_157> AgradDistributionNormal_v_157;
+typedef std::tuple<AgradDistributionNormal, type_v_158> AgradDistributionNormal_v_158;
+typedef std::tuple<AgradDistributionNormal, type_v_159> AgradDistributionNormal_v_159;
+typedef std::tuple<AgradDistributionNormal, type_v_160> AgradDistributionNormal_v_160;
+typedef std::tuple<AgradDistributionNormal, type_v_161> AgradDistributionNormal_v_161;
+typedef std::tuple<AgradDistributionNormal, type_v_162> AgradDistributionNormal_v_162;
+typedef std::tuple<AgradDistributionNormal, type_v_163> AgradDistributionNormal_v_163;
+typedef std::tuple<AgradDistributionNormal, type_v_164> AgradDistributionNormal_v_164;
+typedef std::tuple<AgradDistributionNormal, type_v_165> AgradDistributionNormal_v_165;
+typedef std::tuple<AgradDistributionNormal, type_v_166> AgradDistributionNormal_v_166;
+typedef std::tuple<AgradDistributionNormal, type_v_167> AgradDistributionNormal_v_167;
+typedef std::tuple<AgradDistributionNormal, type_v_168> AgradDistributionNormal_v_168;
+typedef std::tuple<AgradDistributionNormal, type_v_169> AgradDistributionNormal_v_169;
+typedef std::tuple<AgradDistributionNormal, type_v_170> AgradDistributionNormal_v_170;
+typedef std::tuple<AgradDistributionNormal, type_v_171> AgradDistributionNormal_v_171;
+typedef std::tuple<AgradDistributionNormal, type_v_172> AgradDistributionNormal_v_172;
+typedef std::tuple<AgradDistributionNormal, type_v_173> AgradDistributionNormal_v_173;
+typedef std::tuple<AgradDistributionNormal, type_v_174> AgradDistributionNormal_v_174;
+typedef std::tuple<AgradDistributionNormal, type_v_175> AgradDistributionNormal_v_175;
+typedef std::tuple<AgradDistributionNormal, type_v_176> AgradDistributionNormal_v_176;
+typedef std::tuple<AgradDistributionNormal, type_v_177> AgradDistributionNormal_v_177;
+typedef std::tuple<AgradDistributionNormal, type_v_178> AgradDistributionNormal_v_178;
+typedef std::tuple<AgradDistributionNormal, type_v_179> AgradDistributionNormal_v_179;
+typedef std::tuple<AgradDistributionNormal, type_v_180> AgradDistributionNormal_v_180;
+typedef std::tuple<AgradDistributionNormal, type_v_181> AgradDistributionNormal_v_181;
+typedef std::tuple<AgradDistributionNormal, type_v_182> AgradDistributionNormal_v_182;
+typedef std::tuple<AgradDistributionNormal, type_v_183> AgradDistributionNormal_v_183;
+typedef std::tuple<AgradDistributionNormal, type_v_184> AgradDistributionNormal_v_184;
+typedef std::tuple<AgradDistributionNormal, type_v_185> AgradDistributionNormal_v_185;
+typedef std::tuple<AgradDistributionNormal, type_v_186> AgradDistributionNormal_v_186;
+typedef std::tuple<AgradDistributionNormal, type_v_187> AgradDistributionNormal_v_187;
+typedef std::tuple<AgradDistributionNormal, type_v_188> AgradDistributionNormal_v_188;
+typedef std::tuple<AgradDistributionNormal, type_v_189> AgradDistributionNormal_v_189;
+typedef std::tuple<AgradDistributionNormal, type_v_190> AgradDistributionNormal_v_190;
+typedef std::tuple<AgradDistributionNormal, type_v_191> AgradDistributionNormal_v_191;
+typedef std::tuple<AgradDistributionNormal, type_v_192> AgradDistributionNormal_v_192;
+typedef std::tuple<AgradDistributionNormal, type_v_193> AgradDistributionNormal_v_193;
+typedef std::tuple<AgradDistributionNormal, type_v_194> AgradDistributionNormal_v_194;
+typedef std::tuple<AgradDistributionNormal, type_v_195> AgradDistributionNormal_v_195;
+typedef std::tuple<AgradDistributionNormal, type_v_196> AgradDistributionNormal_v_196;
+typedef std::tuple<AgradDistributionNormal, type_v_197> AgradDistributionNormal_v_197;
+typedef std::tuple<AgradDistributionNormal, type_v_198> AgradDistributionNormal_v_198;
+typedef std::tuple<AgradDistributionNormal, type_v_199> AgradDistributionNormal_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_100, AgradDistributionTestFixture, AgradDistributionNormal_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_101, AgradDistributionTestFixture, AgradDistributionNormal_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_102, AgradDistributionTestFixture, AgradDistributionNormal_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_103, AgradDistributionTestFixture, AgradDistributionNormal_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_104, AgradDistributionTestFixture, AgradDistributionNormal_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_105, AgradDistributionTestFixture, AgradDistributionNormal_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_106, AgradDistributionTestFixture, AgradDistributionNormal_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_107, AgradDistributionTestFixture, AgradDistributionNormal_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_108, AgradDistributionTestFixture, AgradDistributionNormal_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_109, AgradDistributionTestFixture, AgradDistributionNormal_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_110, AgradDistributionTestFixture, AgradDistributionNormal_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_111, AgradDistributionTestFixture, AgradDistributionNormal_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_112, AgradDistributionTestFixture, AgradDistributionNormal_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_113, AgradDistributionTestFixture, AgradDistributionNormal_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_114, AgradDistributionTestFixture, AgradDistributionNormal_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_115, AgradDistributionTestFixture, AgradDistributionNormal_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_116, AgradDistributionTestFixture, AgradDistributionNormal_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_117, AgradDistributionTestFixture, AgradDistributionNormal_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_118, AgradDistributionTestFixture, AgradDistributionNormal_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_119, AgradDistributionTestFixture, AgradDistributionNormal_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_120, AgradDistributionTestFixture, AgradDistributionNormal_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_121, AgradDistributionTestFixture, AgradDistributionNormal_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_122, AgradDistributionTestFixture, AgradDistributionNormal_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_123, AgradDistributionTestFixture, AgradDistributionNormal_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_124, AgradDistributionTestFixture, AgradDistributionNormal_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_125, AgradDistributionTestFixture, AgradDistributionNormal_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_126, AgradDistributionTestFixture, AgradDistributionNormal_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_127, AgradDistributionTestFixture, AgradDistributionNormal_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_128, AgradDistributionTestFixture, AgradDistributionNormal_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_129, AgradDistributionTestFixture, AgradDistributionNormal_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_130, AgradDistributionTestFixture, AgradDistributionNormal_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_131, AgradDistributionTestFixture, AgradDistributionNormal_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_132, AgradDistributionTestFixture, AgradDistributionNormal_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_133, AgradDistributionTestFixture, AgradDistributionNormal_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_134, AgradDistributionTestFixture, AgradDistributionNormal_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_135, AgradDistributionTestFixture, AgradDistributionNormal_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_136, AgradDistributionTestFixture, AgradDistributionNormal_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_137, AgradDistributionTestFixture, AgradDistributionNormal_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_138, AgradDistributionTestFixture, AgradDistributionNormal_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_139, AgradDistributionTestFixture, AgradDistributionNormal_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_140, AgradDistributionTestFixture, AgradDistributionNormal_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_141, AgradDistributionTestFixture, AgradDistributionNormal_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_142, AgradDistributionTestFixture, AgradDistributionNormal_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_143, AgradDistributionTestFixture, AgradDistributionNormal_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_144, AgradDistributionTestFixture, AgradDistributionNormal_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_145, AgradDistributionTestFixture, AgradDistributionNormal_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_146, AgradDistributionTestFixture, AgradDistributionNormal_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_147, AgradDistributionTestFixture, AgradDistributionNormal_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_148, AgradDistributionTestFixture, AgradDistributionNormal_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_149, AgradDistributionTestFixture, AgradDistributionNormal_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_150, AgradDistributionTestFixture, AgradDistributionNormal_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_151, AgradDistributionTestFixture, AgradDistributionNormal_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_152, AgradDistributionTestFixture, AgradDistributionNormal_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_153, AgradDistributionTestFixture, AgradDistributionNormal_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_154, AgradDistributionTestFixture, AgradDistributionNormal_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_155, AgradDistributionTestFixture, AgradDistributionNormal_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_156, AgradDistributionTestFixture, AgradDistributionNormal_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_157, AgradDistributionTestFixture, AgradDistributionNormal_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_158, AgradDistributionTestFixture, AgradDistributionNormal_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_159, AgradDistributionTestFixture, AgradDistributionNormal_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_160, AgradDistributionTestFixture, AgradDistributionNormal_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_161, AgradDistributionTestFixture, AgradDistributionNormal_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_162, AgradDistributionTestFixture, AgradDistributionNormal_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_163, AgradDistributionTestFixture, AgradDistributionNormal_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_164, AgradDistributionTestFixture, AgradDistributionNormal_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_165, AgradDistributionTestFixture, AgradDistributionNormal_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_166, AgradDistributionTestFixture, AgradDistributionNormal_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_167, AgradDistributionTestFixture, AgradDistributionNormal_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_168, AgradDistributionTestFixture, AgradDistributionNormal_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_169, AgradDistributionTestFixture, AgradDistributionNormal_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_170, AgradDistributionTestFixture, AgradDistributionNormal_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_171, AgradDistributionTestFixture, AgradDistributionNormal_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_172, AgradDistributionTestFixture, AgradDistributionNormal_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_173, AgradDistributionTestFixture, AgradDistributionNormal_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_174, AgradDistributionTestFixture, AgradDistributionNormal_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_175, AgradDistributionTestFixture, AgradDistributionNormal_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_176, AgradDistributionTestFixture, AgradDistributionNormal_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_177, AgradDistributionTestFixture, AgradDistributionNormal_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_178, AgradDistributionTestFixture, AgradDistributionNormal_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_179, AgradDistributionTestFixture, AgradDistributionNormal_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_180, AgradDistributionTestFixture, AgradDistributionNormal_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_181, AgradDistributionTestFixture, AgradDistributionNormal_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_182, AgradDistributionTestFixture, AgradDistributionNormal_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_183, AgradDistributionTestFixture, AgradDistributionNormal_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_184, AgradDistributionTestFixture, AgradDistributionNormal_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_185, AgradDistributionTestFixture, AgradDistributionNormal_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_186, AgradDistributionTestFixture, AgradDistributionNormal_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_187, AgradDistributionTestFixture, AgradDistributionNormal_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_188, AgradDistributionTestFixture, AgradDistributionNormal_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_189, AgradDistributionTestFixture, AgradDistributionNormal_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_190, AgradDistributionTestFixture, AgradDistributionNormal_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_191, AgradDistributionTestFixture, AgradDistributionNormal_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_192, AgradDistributionTestFixture, AgradDistributionNormal_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_193, AgradDistributionTestFixture, AgradDistributionNormal_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_194, AgradDistributionTestFixture, AgradDistributionNormal_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_195, AgradDistributionTestFixture, AgradDistributionNormal_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_196, AgradDistributionTestFixture, AgradDistributionNormal_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_197, AgradDistributionTestFixture, AgradDistributionNormal_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_198, AgradDistributionTestFixture, AgradDistributionNormal_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_199, AgradDistributionTestFixture, AgradDistributionNormal_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionNormal, type_vv_100> AgradDistributionNormal_vv_100;
+typedef std::tuple<AgradDistributionNormal, type_vv_101> AgradDistributionNormal_vv_101;
+typedef std::tuple<AgradDistributionNormal, type_vv_102> AgradDistributionNormal_vv_102;
+typedef std::tuple<AgradDistributionNormal, type_vv_103> AgradDistributionNormal_vv_103;
+typedef std::tuple<AgradDistributionNormal, type_vv_104> AgradDistributionNormal_vv_104;
+typedef std::tuple<AgradDistributionNormal, type_vv_105> AgradDistributionNormal_vv_105;
+typedef std::tuple<AgradDistributionNormal, type_vv_106> AgradDistributionNormal_vv_106;
+typedef std::tuple<AgradDistributionNormal, type_vv_107> AgradDistributionNormal_vv_107;
+typedef std::tuple<AgradDistributionNormal, type_vv_108> AgradDistributionNormal_vv_108;
+typedef std::tuple<AgradDistributionNormal, type_vv_109> AgradDistributionNormal_vv_109;
+typedef std::tuple<AgradDistributionNormal, type_vv_110> AgradDistributionNormal_vv_110;
+typedef std::tuple<AgradDistributionNormal, type_vv_111> AgradDistributionNormal_vv_111;
+typedef std::tuple<AgradDistributionNormal, type_vv_112> AgradDistributionNormal_vv_112;
+typedef std::tuple<AgradDistributionNormal, type_vv_113> AgradDistributionNormal_vv_113;
+typedef std::tuple<AgradDistributionNormal, type_vv_114> AgradDistributionNormal_vv_114;
+typedef std::tuple<AgradDistributionNormal, type_vv_115> AgradDistributionNormal_vv_115;
+typedef std::tuple<AgradDistributionNormal, type_vv_116> AgradDistributionNormal_vv_116;
+typedef std::tuple<AgradDistributionNormal, type_vv_117> AgradDistributionNormal_vv_117;
+typedef std::tuple<AgradDistributionNormal, type_vv_118> AgradDistributionNormal_vv_118;
+typedef std::tuple<AgradDistributionNormal, type_vv_119> AgradDistributionNormal_vv_119;
+typedef std::tuple<AgradDistributionNormal, type_vv_120> AgradDistributionNormal_vv_120;
+typedef std::tuple<AgradDistributionNormal, type_vv_121> AgradDistributionNormal_vv_121;
+typedef std::tuple<AgradDistributionNormal, type_vv_122> AgradDistributionNormal_vv_122;
+typedef std::tuple<AgradDistributionNormal, type_vv_123> AgradDistributionNormal_vv_123;
+typedef std::tuple<AgradDistributionNormal, type_vv_124> AgradDistributionNormal_vv_124;
+typedef std::tuple<AgradDistributionNormal, type_vv_125> AgradDistributionNormal_vv_125;
+typedef std::tuple<AgradDistributionNormal, type_vv_126> AgradDistributionNormal_vv_126;
+typedef std::tuple<AgradDistributionNormal, type_vv_127> AgradDistributionNormal_vv_127;
+typedef std::tuple<AgradDistributionNormal, type_vv_128> AgradDistributionNormal_vv_128;
+typedef std::tuple<AgradDistributionNormal, type_vv_129> AgradDistributionNormal_vv_129;
+typedef std::tuple<AgradDistributionNormal, type_vv_130> AgradDistributionNormal_vv_130;
+typedef std::tuple<AgradDistributionNormal, type_vv_131> AgradDistributionNormal_vv_131;
+typedef std::tuple<AgradDistributionNormal, type_vv_132> AgradDistributionNormal_vv_132;
+typedef std::tuple<AgradDistributionNormal, type_vv_133> AgradDistributionNormal_vv_133;
+typedef std::tuple<AgradDistributionNormal, type_vv_134> AgradDistributionNormal_vv_134;
+typedef std::tuple<AgradDistributionNormal, type_vv_135> AgradDistributionNormal_vv_135;
+typedef std::tuple<AgradDistributionNormal, type_vv_136> AgradDistributionNormal_vv_136;
+typedef std::tuple<AgradDistributionNormal, type_vv_137> AgradDistributionNormal_vv_137;
+typedef std::tuple<AgradDistributionNormal, type_vv_138> AgradDistributionNormal_vv_138;
+typedef std::tuple<AgradDistributionNormal, type_vv_139> AgradDistributionNormal_vv_139;
+typedef std::tuple<AgradDistributionNormal, type_vv_140> AgradDistributionNormal_vv_140;
+typedef std::tuple<AgradDistributionNormal, type_vv_141> AgradDistributionNormal_vv_141;
+typedef std::tuple<AgradDistributionNormal, type_vv_142> AgradDistributionNormal_vv_142;
+typedef std::tuple<AgradDistributionNormal, type_vv_143> AgradDistributionNormal_vv_143;
+typedef std::tuple<AgradDistributionNormal, type_vv_144> AgradDistributionNormal_vv_144;
+typedef std::tuple<AgradDistributionNormal, type_vv_145> AgradDistributionNormal_vv_145;
+typedef std::tuple<AgradDistributionNormal, type_vv_146> AgradDistributionNormal_vv_146;
+typedef std::tuple<AgradDistributionNormal, type_vv_147> AgradDistributionNormal_vv_147;
+typedef std::tuple<AgradDistributionNormal, type_vv_148> AgradDistributionNormal_vv_148;
+typedef std::tuple<AgradDistributionNormal, type_vv_149> AgradDistributionNormal_vv_149;
+typedef std::tuple<AgradDistributionNormal, type_vv_150> AgradDistributionNormal_vv_150;
+typedef std::tuple<AgradDistributionNormal, type_vv_151> AgradDistributionNormal_vv_151;
+typedef std::tuple<AgradDistributionNormal, type_vv_152> AgradDistributionNormal_vv_152;
+typedef std::tuple<AgradDistributionNormal, type_vv_153> AgradDistributionNormal_vv_153;
+typedef std::tuple<AgradDistributionNormal, type_vv_154> AgradDistributionNormal_vv_154;
+typedef std::tuple<AgradDistributionNormal, type_vv_155> AgradDistributionNormal_vv_155;
+typedef std::tuple<AgradDistributionNormal, type_vv_156> AgradDistributionNormal_vv_156;
+typedef std::tuple<AgradDistributionNormal, type_vv_157> AgradDistributionNormal_vv_157;
+typedef std::tuple<AgradDistributionNormal, type_vv_158> AgradDistributionNormal_vv_158;
+typedef std::tuple<AgradDistributionNormal, type_vv_159> AgradDistributionNormal_vv_159;
+typedef std::tuple<AgradDistributionNormal, type_vv_160> AgradDistributionNormal_vv_160;
+typedef std::tuple<AgradDistributionNormal, type_vv_161> AgradDistributionNormal_vv_161;
+typedef std::tuple<AgradDistributionNormal, type_vv_162> AgradDistributionNormal_vv_162;
+typedef std::tuple<AgradDistributionNormal, type_vv_163> AgradDistributionNormal_vv_163;
+typedef std::tuple<AgradDistributionNormal, type_vv_164> AgradDistributionNormal_vv_164;
+typedef std::tuple<AgradDistributionNormal, type_vv_165> AgradDistributionNormal_vv_165;
+typedef std::tuple<AgradDistributionNormal, type_vv_166> AgradDistributionNormal_vv_166;
+typedef std::tuple<AgradDistributionNormal, type_vv_167> AgradDistributionNormal_vv_167;
+typedef std::tuple<AgradDistributionNormal, type_vv_168> AgradDistributionNormal_vv_168;
+typedef std::tuple<AgradDistributionNormal, type_vv_169> AgradDistributionNormal_vv_169;
+typedef std::tuple<AgradDistributionNormal, type_vv_170> AgradDistributionNormal_vv_170;
+typedef std::tuple<AgradDistributionNormal, type_vv_171> AgradDistributionNormal_vv_171;
+typedef std::tuple<AgradDistributionNormal, type_vv_172> AgradDistributionNormal_vv_172;
+typedef std::tuple<AgradDistributionNormal, type_vv_173> AgradDistributionNormal_vv_173;
+typedef std::tuple<AgradDistributionNormal, type_vv_174> AgradDistributionNormal_vv_174;
+typedef std::tuple<AgradDistributionNormal, type_vv_175> AgradDistributionNormal_vv_175;
+typedef std::tuple<AgradDistributionNormal, type_vv_176> AgradDistributionNormal_vv_176;
+typedef std::tuple<AgradDistributionNormal, type_vv_177> AgradDistributionNormal_vv_177;
+typedef std::tuple<AgradDistributionNormal, type_vv_178> AgradDistributionNormal_vv_178;
+typedef std::tuple<AgradDistributionNormal, type_vv_179> AgradDistributionNormal_vv_179;
+typedef std::tuple<AgradDistributionNormal, type_vv_180> AgradDistributionNormal_vv_180;
+typedef std::tuple<AgradDistributionNormal, type_vv_181> AgradDistributionNormal_vv_181;
+typedef std::tuple<AgradDistributionNormal, type_vv_182> AgradDistributionNormal_vv_182;
+typedef std::tuple<AgradDistributionNormal, type_vv_183> AgradDistributionNormal_vv_183;
+typedef std::tuple<AgradDistributionNormal, type_vv_184> AgradDistributionNormal_vv_184;
+typedef std::tuple<AgradDistributionNormal, type_vv_185> AgradDistributionNormal_vv_185;
+typedef std::tuple<AgradDistributionNormal, type_vv_186> AgradDistributionNormal_vv_186;
+typedef std::tuple<AgradDistributionNormal, type_vv_187> AgradDistributionNormal_vv_187;
+typedef std::tuple<AgradDistributionNormal, type_vv_188> AgradDistributionNormal_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_100, AgradDistributionTestFixture, AgradDistributionNormal_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_101, AgradDistributionTestFixture, AgradDistributionNormal_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_102, AgradDistributionTestFixture, AgradDistributionNormal_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_103, AgradDistributionTestFixture, AgradDistributionNormal_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_104, AgradDistributionTestFixture, AgradDistributionNormal_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_105, AgradDistributionTestFixture, AgradDistributionNormal_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_106, AgradDistributionTestFixture, AgradDistributionNormal_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_107, AgradDistributionTestFixture, AgradDistributionNormal_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_108, AgradDistributionTestFixture, AgradDistributionNormal_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_109, AgradDistributionTestFixture, AgradDistributionNormal_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_110, AgradDistributionTestFixture, AgradDistributionNormal_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_111, AgradDistributionTestFixture, AgradDistributionNormal_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_112, AgradDistributionTestFixture, AgradDistributionNormal_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_113, AgradDistributionTestFixture, AgradDistributionNormal_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_114, AgradDistributionTestFixture, AgradDistributionNormal_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_115, AgradDistributionTestFixture, AgradDistributionNormal_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_116, AgradDistributionTestFixture, AgradDistributionNormal_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_117, AgradDistributionTestFixture, AgradDistributionNormal_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_118, AgradDistributionTestFixture, AgradDistributionNormal_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_119, AgradDistributionTestFixture, AgradDistributionNormal_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_120, AgradDistributionTestFixture, AgradDistributionNormal_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_121, AgradDistributionTestFixture, AgradDistributionNormal_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_122, AgradDistributionTestFixture, AgradDistributionNormal_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_123, AgradDistributionTestFixture, AgradDistributionNormal_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_124, AgradDistributionTestFixture, AgradDistributionNormal_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_125, AgradDistributionTestFixture, AgradDistributionNormal_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_126, AgradDistributionTestFixture, AgradDistributionNormal_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_127, AgradDistributionTestFixture, AgradDistributionNormal_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_128, AgradDistributionTestFixture, AgradDistributionNormal_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_129, AgradDistributionTestFixture, AgradDistributionNormal_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_130, AgradDistributionTestFixture, AgradDistributionNormal_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_131, AgradDistributionTestFixture, AgradDistributionNormal_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_132, AgradDistributionTestFixture, AgradDistributionNormal_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_133, AgradDistributionTestFixture, AgradDistributionNormal_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_134, AgradDistributionTestFixture, AgradDistributionNormal_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_135, AgradDistributionTestFixture, AgradDistributionNormal_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_136, AgradDistributionTestFixture, AgradDistributionNormal_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_137, AgradDistributionTestFixture, AgradDistributionNormal_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_138, AgradDistributionTestFixture, AgradDistributionNormal_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_139, AgradDistributionTestFixture, AgradDistributionNormal_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_140, AgradDistributionTestFixture, AgradDistributionNormal_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_141, AgradDistributionTestFixture, AgradDistributionNormal_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_142, AgradDistributionTestFixture, AgradDistributionNormal_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_143, AgradDistributionTestFixture, AgradDistributionNormal_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_144, AgradDistributionTestFixture, AgradDistributionNormal_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_145, AgradDistributionTestFixture, AgradDistributionNormal_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_146, AgradDistributionTestFixture, AgradDistributionNormal_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_147, AgradDistributionTestFixture, AgradDistributionNormal_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_148, AgradDistributionTestFixture, AgradDistributionNormal_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_149, AgradDistributionTestFixture, AgradDistributionNormal_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_150, AgradDistributionTestFixture, AgradDistributionNormal_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_151, AgradDistributionTestFixture, AgradDistributionNormal_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_152, AgradDistributionTestFixture, AgradDistributionNormal_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_153, AgradDistributionTestFixture, AgradDistributionNormal_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_154, AgradDistributionTestFixture, AgradDistributionNormal_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_155, AgradDistributionTestFixture, AgradDistributionNormal_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_156, AgradDistributionTestFixture, AgradDistributionNormal_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_157, AgradDistributionTestFixture, AgradDistributionNormal_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_158, AgradDistributionTestFixture, AgradDistributionNormal_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_159, AgradDistributionTestFixture, AgradDistributionNormal_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_160, AgradDistributionTestFixture, AgradDistributionNormal_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_161, AgradDistributionTestFixture, AgradDistributionNormal_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_162, AgradDistributionTestFixture, AgradDistributionNormal_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_163, AgradDistributionTestFixture, AgradDistributionNormal_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_164, AgradDistributionTestFixture, AgradDistributionNormal_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_165, AgradDistributionTestFixture, AgradDistributionNormal_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_166, AgradDistributionTestFixture, AgradDistributionNormal_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_167, AgradDistributionTestFixture, AgradDistributionNormal_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_168, AgradDistributionTestFixture, AgradDistributionNormal_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_169, AgradDistributionTestFixture, AgradDistributionNormal_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_170, AgradDistributionTestFixture, AgradDistributionNormal_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_171, AgradDistributionTestFixture, AgradDistributionNormal_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_172, AgradDistributionTestFixture, AgradDistributionNormal_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_173, AgradDistributionTestFixture, AgradDistributionNormal_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_174, AgradDistributionTestFixture, AgradDistributionNormal_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_175, AgradDistributionTestFixture, AgradDistributionNormal_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_176, AgradDistributionTestFixture, AgradDistributionNormal_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_177, AgradDistributionTestFixture, AgradDistributionNormal_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_178, AgradDistributionTestFixture, AgradDistributionNormal_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_179, AgradDistributionTestFixture, AgradDistributionNormal_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_180, AgradDistributionTestFixture, AgradDistributionNormal_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_181, AgradDistributionTestFixture, AgradDistributionNormal_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_182, AgradDistributionTestFixture, AgradDistributionNormal_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_183, AgradDistributionTestFixture, AgradDistributionNormal_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_184, AgradDistributionTestFixture, AgradDistributionNormal_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_185, AgradDistributionTestFixture, AgradDistributionNormal_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_186, AgradDistributionTestFixture, AgradDistributionNormal_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_187, AgradDistributionTestFixture, AgradDistributionNormal_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_vv_188, AgradDistributionTestFixture, AgradDistributionNormal_vv_188);
+
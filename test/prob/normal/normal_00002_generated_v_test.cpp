@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradDistributionNormal, type_v_200> AgradDistributionNormal_v_200;
+typedef std::tuple<AgradDistributionNormal, type_v_201> AgradDistributionNormal_v_201;
+typedef std::tuple<AgradDistributionNormal, type_v_202> AgradDistributionNormal_v_202;
+typedef std::tuple<AgradDistributionNormal, type_v_203> AgradDistributionNormal_v_203;
+typedef std::tuple<AgradDistributionNormal, type_v_204> AgradDistributionNormal_v_204;
+typedef std::tuple<AgradDistributionNormal, type_v_205> AgradDistributionNormal_v_205;
+typedef std::tuple<AgradDistributionNormal, type_v_206> AgradDistributionNormal_v_206;
+typedef std::tuple<AgradDistributionNormal, type_v_207> AgradDistributionNormal_v_207;
+typedef std::tuple<AgradDistributionNormal, type_v_208> AgradDistributionNormal_v_208;
+typedef std::tuple<AgradDistributionNormal, type_v_209> AgradDistributionNormal_v_209;
+typedef std::tuple<AgradDistributionNormal, type_v_210> AgradDistributionNormal_v_210;
+typedef std::tuple<AgradDistributionNormal, type_v_211> AgradDistributionNormal_v_211;
+typedef std::tuple<AgradDistributionNormal, type_v_212> AgradDistributionNormal_v_212;
+typedef std::tuple<AgradDistributionNormal, type_v_213> AgradDistributionNormal_v_213;
+typedef std::tuple<AgradDistributionNormal, type_v_214> AgradDistributionNormal_v_214;
+typedef std::tuple<AgradDistributionNormal, type_v_215> AgradDistributionNormal_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_200, AgradDistributionTestFixture, AgradDistributionNormal_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_201, AgradDistributionTestFixture, AgradDistributionNormal_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_202, AgradDistributionTestFixture, AgradDistributionNormal_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_203, AgradDistributionTestFixture, AgradDistributionNormal_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_204, AgradDistributionTestFixture, AgradDistributionNormal_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_205, AgradDistributionTestFixture, AgradDistributionNormal_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_206, AgradDistributionTestFixture, AgradDistributionNormal_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_207, AgradDistributionTestFixture, AgradDistributionNormal_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_208, AgradDistributionTestFixture, AgradDistributionNormal_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_209, AgradDistributionTestFixture, AgradDistributionNormal_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_210, AgradDistributionTestFixture, AgradDistributionNormal_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_211, AgradDistributionTestFixture, AgradDistributionNormal_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_212, AgradDistributionTestFixture, AgradDistributionNormal_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_213, AgradDistributionTestFixture, AgradDistributionNormal_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_214, AgradDistributionTestFixture, AgradDistributionNormal_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormal_v_215, AgradDistributionTestFixture, AgradDistributionNormal_v_215);
+
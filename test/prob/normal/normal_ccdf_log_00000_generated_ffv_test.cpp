@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_0> AgradCcdfLogNormal_ffv_0;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_1> AgradCcdfLogNormal_ffv_1;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_2> AgradCcdfLogNormal_ffv_2;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_3> AgradCcdfLogNormal_ffv_3;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_4> AgradCcdfLogNormal_ffv_4;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_5> AgradCcdfLogNormal_ffv_5;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_6> AgradCcdfLogNormal_ffv_6;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_7> AgradCcdfLogNormal_ffv_7;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_8> AgradCcdfLogNormal_ffv_8;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_9> AgradCcdfLogNormal_ffv_9;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_10> AgradCcdfLogNormal_ffv_10;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_11> AgradCcdfLogNormal_ffv_11;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_12> AgradCcdfLogNormal_ffv_12;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_13> AgradCcdfLogNormal_ffv_13;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_14> AgradCcdfLogNormal_ffv_14;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_15> AgradCcdfLogNormal_ffv_15;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_16> AgradCcdfLogNormal_ffv_16;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_17> AgradCcdfLogNormal_ffv_17;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_18> AgradCcdfLogNormal_ffv_18;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_19> AgradCcdfLogNormal_ffv_19;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_20> AgradCcdfLogNormal_ffv_20;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_21> AgradCcdfLogNormal_ffv_21;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_22> AgradCcdfLogNormal_ffv_22;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_23> AgradCcdfLogNormal_ffv_23;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_24> AgradCcdfLogNormal_ffv_24;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_25> AgradCcdfLogNormal_ffv_25;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_26> AgradCcdfLogNormal_ffv_26;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_27> AgradCcdfLogNormal_ffv_27;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_28> AgradCcdfLogNormal_ffv_28;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_29> AgradCcdfLogNormal_ffv_29;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_30> AgradCcdfLogNormal_ffv_30;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_31> AgradCcdfLogNormal_ffv_31;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_32> AgradCcdfLogNormal_ffv_32;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_33> AgradCcdfLogNormal_ffv_33;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_34> AgradCcdfLogNormal_ffv_34;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_35> AgradCcdfLogNormal_ffv_35;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_36> AgradCcdfLogNormal_ffv_36;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_37> AgradCcdfLogNormal_ffv_37;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_38> AgradCcdfLogNormal_ffv_38;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_39> AgradCcdfLogNormal_ffv_39;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_40> AgradCcdfLogNormal_ffv_40;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_41> AgradCcdfLogNormal_ffv_41;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_42> AgradCcdfLogNormal_ffv_42;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_43> AgradCcdfLogNormal_ffv_43;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_44> AgradCcdfLogNormal_ffv_44;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_45> AgradCcdfLogNormal_ffv_45;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_46> AgradCcdfLogNormal_ffv_46;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_47> AgradCcdfLogNormal_ffv_47;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_48> AgradCcdfLogNormal_ffv_48;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_49> AgradCcdfLogNormal_ffv_49;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_50> AgradCcdfLogNormal_ffv_50;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_51> AgradCcdfLogNormal_ffv_51;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_52> AgradCcdfLogNormal_ffv_52;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_53> AgradCcdfLogNormal_ffv_53;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_54> AgradCcdfLogNormal_ffv_54;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_55> AgradCcdfLogNormal_ffv_55;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_56> AgradCcdfLogNormal_ffv_56;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_57> AgradCcdfLogNormal_ffv_57;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_58> AgradCcdfLogNormal_ffv_58;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_59> AgradCcdfLogNormal_ffv_59;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_60> AgradCcdfLogNormal_ffv_60;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_61> AgradCcdfLogNormal_ffv_61;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_62> AgradCcdfLogNormal_ffv_62;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_63> AgradCcdfLogNormal_ffv_63;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_64> AgradCcdfLogNormal_ffv_64;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_65> AgradCcdfLogNormal_ffv_65;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_66> AgradCcdfLogNormal_ffv_66;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_67> AgradCcdfLogNormal_ffv_67;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_68> AgradCcdfLogNormal_ffv_68;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_69> AgradCcdfLogNormal_ffv_69;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_70> AgradCcdfLogNormal_ffv_70;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_71> AgradCcdfLogNormal_ffv_71;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_72> AgradCcdfLogNormal_ffv_72;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_73> AgradCcdfLogNormal_ffv_73;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_74> AgradCcdfLogNormal_ffv_74;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_75> AgradCcdfLogNormal_ffv_75;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_76> AgradCcdfLogNormal_ffv_76;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_77> AgradCcdfLogNormal_ffv_77;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_78> AgradCcdfLogNormal_ffv_78;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_79> AgradCcdfLogNormal_ffv_79;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_80> AgradCcdfLogNormal_ffv_80;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_81> AgradCcdfLogNormal_ffv_81;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_82> AgradCcdfLogNormal_ffv_82;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_83> AgradCcdfLogNormal_ffv_83;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_84> AgradCcdfLogNormal_ffv_84;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_85> AgradCcdfLogNormal_ffv_85;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_86> AgradCcdfLogNormal_ffv_86;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_87> AgradCcdfLogNormal_ffv_87;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_88> AgradCcdfLogNormal_ffv_88;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_89> AgradCcdfLogNormal_ffv_89;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_90> AgradCcdfLogNormal_ffv_90;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_91> AgradCcdfLogNormal_ffv_91;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_92> AgradCcdfLogNormal_ffv_92;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_93> AgradCcdfLogNormal_ffv_93;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_94> AgradCcdfLogNormal_ffv_94;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_95> AgradCcdfLogNormal_ffv_95;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_96> AgradCcdfLogNormal_ffv_96;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_97> AgradCcdfLogNormal_ffv_97;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_98> AgradCcdfLogNormal_ffv_98;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_99> AgradCcdfLogNormal_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogNormal, type_v_0> AgradCcdfLogNormal_v_0;
+typedef std::tuple<AgradCcdfLogNormal, type_v_1> AgradCcdfLogNormal_v_1;
+typedef std::tuple<AgradCcdfLogNormal, type_v_2> AgradCcdfLogNormal_v_2;
+typedef std::tuple<AgradCcdfLogNormal, type_v_3> AgradCcdfLogNormal_v_3;
+typedef std::tuple<AgradCcdfLogNormal, type_v_4> AgradCcdfLogNormal_v_4;
+typedef std::tuple<AgradCcdfLogNormal, type_v_5> AgradCcdfLogNormal_v_5;
+typedef std::tuple<AgradCcdfLogNormal, type_v_6> AgradCcdfLogNormal_v_6;
+typedef std::tuple<AgradCcdfLogNormal, type_v_7> AgradCcdfLogNormal_v_7;
+typedef std::tuple<AgradCcdfLogNormal, type_v_8> AgradCcdfLogNormal_v_8;
+typedef std::tuple<AgradCcdfLogNormal, type_v_9> AgradCcdfLogNormal_v_9;
+typedef std::tuple<AgradCcdfLogNormal, type_v_10> AgradCcdfLogNormal_v_10;
+typedef std::tuple<AgradCcdfLogNormal, type_v_11> AgradCcdfLogNormal_v_11;
+typedef std::tuple<AgradCcdfLogNormal, type_v_12> AgradCcdfLogNormal_v_12;
+typedef std::tuple<AgradCcdfLogNormal, type_v_13> AgradCcdfLogNormal_v_13;
+typedef std::tuple<AgradCcdfLogNormal, type_v_14> AgradCcdfLogNormal_v_14;
+typedef std::tuple<AgradCcdfLogNormal, type_v_15> AgradCcdfLogNormal_v_15;
+typedef std::tuple<AgradCcdfLogNormal, type_v_16> AgradCcdfLogNormal_v_16;
+typedef std::tuple<AgradCcdfLogNormal, type_v_17> AgradCcdfLogNormal_v_17;
+typedef std::tuple<AgradCcdfLogNormal, type_v_18> AgradCcdfLogNormal_v_18;
+typedef std::tuple<AgradCcdfLogNormal, type_v_19> AgradCcdfLogNormal_v_19;
+typedef std::tuple<AgradCcdfLogNormal, type_v_20> AgradCcdfLogNormal_v_20;
+typedef std::tuple<AgradCcdfLogNormal, type_v_21> AgradCcdfLogNormal_v_21;
+typedef std::tuple<AgradCcdfLogNormal, type_v_22> AgradCcdfLogNormal_v_22;
+typedef std::tuple<AgradCcdfLogNormal, type_v_23> AgradCcdfLogNormal_v_23;
+typedef std::tuple<AgradCcdfLogNormal, type_v_24> AgradCcdfLogNormal_v_24;
+typedef std::tuple<AgradCcdfLogNormal, type_v_25> AgradCcdfLogNormal_v_25;
+typedef std::tuple<AgradCcdfLogNormal, type_v_26> AgradCcdfLogNormal_v_26;
+typedef std::tuple<AgradCcdfLogNormal, type_v_27> AgradCcdfLogNormal_v_27;
+typedef std::tuple<AgradCcdfLogNormal, type_v_28> AgradCcdfLogNormal_v_28;
+typedef std::tuple<AgradCcdfLogNormal, type_v_29> AgradCcdfLogNormal_v_29;
+typedef std::tuple<AgradCcdfLogNormal, type_v_30> AgradCcdfLogNormal_v_30;
+typedef std::tuple<AgradCcdfLogNormal, type_v_31> AgradCcdfLogNormal_v_31;
+typedef std::tuple<AgradCcdfLogNormal, type_v_32> AgradCcdfLogNormal_v_32;
+typedef std::tuple<AgradCcdfLogNormal, type_v_33> AgradCcdfLogNormal_v_33;
+typedef std::tuple<AgradCcdfLogNormal, type_v_34> AgradCcdfLogNormal_v_34;
+typedef std::tuple<AgradCcdfLogNormal, type_v_35> AgradCcdfLogNormal_v_35;
+typedef std::tuple<AgradCcdfLogNormal, type_v_36> AgradCcdfLogNormal_v_36;
+typedef std::tuple<AgradCcdfLogNormal, type_v_37> AgradCcdfLogNormal_v_37;
+typedef std::tuple<AgradCcdfLogNormal, type_v_38> AgradCcdfLogNormal_v_38;
+typedef std::tuple<AgradCcdfLogNormal, type_v_39> AgradCcdfLogNormal_v_39;
+typedef std::tuple<AgradCcdfLogNormal, type_v_40> AgradCcdfLogNormal_v_40;
+typedef std::tuple<AgradCcdfLogNormal, type_v_41> AgradCcdfLogNormal_v_41;
+typedef std::tuple<AgradCcdfLogNormal, type_v_42> AgradCcdfLogNormal_v_42;
+typedef std::tuple<AgradCcdfLogNormal, type_v_43> AgradCcdfLogNormal_v_43;
+typedef std::tuple<AgradCcdfLogNormal, type_v_44> AgradCcdfLogNormal_v_44;
+typedef std::tuple<AgradCcdfLogNormal, type_v_45> AgradCcdfLogNormal_v_45;
+typedef std::tuple<AgradCcdfLogNormal, type_v_46> AgradCcdfLogNormal_v_46;
+typedef std::tuple<AgradCcdfLogNormal, type_v_47> AgradCcdfLogNormal_v_47;
+typedef std::tuple<AgradCcdfLogNormal, type_v_48> AgradCcdfLogNormal_v_48;
+typedef std::tuple<AgradCcdfLogNormal, type_v_49> AgradCcdfLogNormal_v_49;
+typedef std::tuple<AgradCcdfLogNormal, type_v_50> AgradCcdfLogNormal_v_50;
+typedef std::tuple<AgradCcdfLogNormal, type_v_51> AgradCcdfLogNormal_v_51;
+typedef std::tuple<AgradCcdfLogNormal, type_v_52> AgradCcdfLogNormal_v_52;
+typedef std::tuple<AgradCcdfLogNormal, type_v_53> AgradCcdfLogNormal_v_53;
+typedef std::tuple<AgradCcdfLogNormal, type_v_54> AgradCcdfLogNormal_v_54;
+typedef std::tuple<AgradCcdfLogNormal, type_v_55> AgradCcdfLogNormal_v_55;
+typedef std::tuple<AgradCcdfLogNormal, type_v_56> AgradCcdfLogNormal_v_56;
+typedef std::tuple<AgradCcdfLogNormal, type_v_57> AgradCcdfLogNormal_v_57;
+typedef std::tuple<AgradCcdfLogNormal, type_v_58> AgradCcdfLogNormal_v_58;
+typedef std::tuple<AgradCcdfLogNormal, type_v_59> AgradCcdfLogNormal_v_59;
+typedef std::tuple<AgradCcdfLogNormal, type_v_60> AgradCcdfLogNormal_v_60;
+typedef std::tuple<AgradCcdfLogNormal, type_v_61> AgradCcdfLogNormal_v_61;
+typedef std::tuple<AgradCcdfLogNormal, type_v_62> AgradCcdfLogNormal_v_62;
+typedef std::tuple<AgradCcdfLogNormal, type_v_63> AgradCcdfLogNormal_v_63;
+typedef std::tuple<AgradCcdfLogNormal, type_v_64> AgradCcdfLogNormal_v_64;
+typedef std::tuple<AgradCcdfLogNormal, type_v_65> AgradCcdfLogNormal_v_65;
+typedef std::tuple<AgradCcdfLogNormal, type_v_66> AgradCcdfLogNormal_v_66;
+typedef std::tuple<AgradCcdfLogNormal, type_v_67> AgradCcdfLogNormal_v_67;
+typedef std::tuple<AgradCcdfLogNormal, type_v_68> AgradCcdfLogNormal_v_68;
+typedef std::tuple<AgradCcdfLogNormal, type_v_69> AgradCcdfLogNormal_v_69;
+typedef std::tuple<AgradCcdfLogNormal, type_v_70> AgradCcdfLogNormal_v_70;
+typedef std::tuple<AgradCcdfLogNormal, type_v_71> AgradCcdfLogNormal_v_71;
+typedef std::tuple<AgradCcdfLogNormal, type_v_72> AgradCcdfLogNormal_v_72;
+typedef std::tuple<AgradCcdfLogNormal, type_v_73> AgradCcdfLogNormal_v_73;
+typedef std::tuple<AgradCcdfLogNormal, type_v_74> AgradCcdfLogNormal_v_74;
+typedef std::tuple<AgradCcdfLogNormal, type_v_75> AgradCcdfLogNormal_v_75;
+typedef std::tuple<AgradCcdfLogNormal, type_v_76> AgradCcdfLogNormal_v_76;
+typedef std::tuple<AgradCcdfLogNormal, type_v_77> AgradCcdfLogNormal_v_77;
+typedef std::tuple<AgradCcdfLogNormal, type_v_78> AgradCcdfLogNormal_v_78;
+typedef std::tuple<AgradCcdfLogNormal, type_v_79> AgradCcdfLogNormal_v_79;
+typedef std::tuple<AgradCcdfLogNormal, type_v_80> AgradCcdfLogNormal_v_80;
+typedef std::tuple<AgradCcdfLogNormal, type_v_81> AgradCcdfLogNormal_v_81;
+typedef std::tuple<AgradCcdfLogNormal, type_v_82> AgradCcdfLogNormal_v_82;
+typedef std::tuple<AgradCcdfLogNormal, type_v_83> AgradCcdfLogNormal_v_83;
+typedef std::tuple<AgradCcdfLogNormal, type_v_84> AgradCcdfLogNormal_v_84;
+typedef std::tuple<AgradCcdfLogNormal, type_v_85> AgradCcdfLogNormal_v_85;
+typedef std::tuple<AgradCcdfLogNormal, type_v_86> AgradCcdfLogNormal_v_86;
+typedef std::tuple<AgradCcdfLogNormal, type_v_87> AgradCcdfLogNormal_v_87;
+typedef std::tuple<AgradCcdfLogNormal, type_v_88> AgradCcdfLogNormal_v_88;
+typedef std::tuple<AgradCcdfLogNormal, type_v_89> AgradCcdfLogNormal_v_89;
+typedef std::tuple<AgradCcdfLogNormal, type_v_90> AgradCcdfLogNormal_v_90;
+typedef std::tuple<AgradCcdfLogNormal, type_v_91> AgradCcdfLogNormal_v_91;
+typedef std::tuple<AgradCcdfLogNormal, type_v_92> AgradCcdfLogNormal_v_92;
+typedef std::tuple<AgradCcdfLogNormal, type_v_93> AgradCcdfLogNormal_v_93;
+typedef std::tuple<AgradCcdfLogNormal, type_v_94> AgradCcdfLogNormal_v_94;
+typedef std::tuple<AgradCcdfLogNormal, type_v_95> AgradCcdfLogNormal_v_95;
+typedef std::tuple<AgradCcdfLogNormal, type_v_96> AgradCcdfLogNormal_v_96;
+typedef std::tuple<AgradCcdfLogNormal, type_v_97> AgradCcdfLogNormal_v_97;
+typedef std::tuple<AgradCcdfLogNormal, type_v_98> AgradCcdfLogNormal_v_98;
+typedef std::tuple<AgradCcdfLogNormal, type_v_99> AgradCcdfLogNormal_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_0, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_1, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_2, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_3, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_4, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_5, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_6, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_7, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_8, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_9, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_10, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_11, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_12, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_13, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_14, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_15, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_16, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_17, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_18, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_19, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_20, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_21, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_22, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_23, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_24, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_25, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_26, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_27, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_28, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_29, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_30, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_31, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_32, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_33, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_34, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_35, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_36, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_37, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_38, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_39, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_40, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_41, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_42, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_43, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_44, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_45, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_46, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_47, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_48, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_49, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_50, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_51, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_52, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_53, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_54, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_55, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_56, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_57, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_58, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_59, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_60, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_61, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_62, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_63, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_64, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_65, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_66, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_67, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_68, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_69, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_70, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_71, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_72, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_73, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_74, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_75, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_76, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_77, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_78, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_79, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_80, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_81, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_82, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_83, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_84, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_85, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_86, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_87, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_88, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_89, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_90, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_91, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_92, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_93, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_94, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_95, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_96, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_97, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_98, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_99, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_99);
+
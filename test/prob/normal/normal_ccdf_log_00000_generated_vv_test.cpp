@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogNormal, type_vv_0> AgradCcdfLogNormal_vv_0;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_1> AgradCcdfLogNormal_vv_1;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_2> AgradCcdfLogNormal_vv_2;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_3> AgradCcdfLogNormal_vv_3;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_4> AgradCcdfLogNormal_vv_4;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_5> AgradCcdfLogNormal_vv_5;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_6> AgradCcdfLogNormal_vv_6;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_7> AgradCcdfLogNormal_vv_7;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_8> AgradCcdfLogNormal_vv_8;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_9> AgradCcdfLogNormal_vv_9;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_10> AgradCcdfLogNormal_vv_10;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_11> AgradCcdfLogNormal_vv_11;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_12> AgradCcdfLogNormal_vv_12;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_13> AgradCcdfLogNormal_vv_13;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_14> AgradCcdfLogNormal_vv_14;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_15> AgradCcdfLogNormal_vv_15;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_16> AgradCcdfLogNormal_vv_16;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_17> AgradCcdfLogNormal_vv_17;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_18> AgradCcdfLogNormal_vv_18;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_19> AgradCcdfLogNormal_vv_19;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_20> AgradCcdfLogNormal_vv_20;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_21> AgradCcdfLogNormal_vv_21;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_22> AgradCcdfLogNormal_vv_22;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_23> AgradCcdfLogNormal_vv_23;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_24> AgradCcdfLogNormal_vv_24;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_25> AgradCcdfLogNormal_vv_25;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_26> AgradCcdfLogNormal_vv_26;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_27> AgradCcdfLogNormal_vv_27;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_28> AgradCcdfLogNormal_vv_28;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_29> AgradCcdfLogNormal_vv_29;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_30> AgradCcdfLogNormal_vv_30;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_31> AgradCcdfLogNormal_vv_31;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_32> AgradCcdfLogNormal_vv_32;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_33> AgradCcdfLogNormal_vv_33;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_34> AgradCcdfLogNormal_vv_34;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_35> AgradCcdfLogNormal_vv_35;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_36> AgradCcdfLogNormal_vv_36;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_37> AgradCcdfLogNormal_vv_37;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_38> AgradCcdfLogNormal_vv_38;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_39> AgradCcdfLogNormal_vv_39;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_40> AgradCcdfLogNormal_vv_40;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_41> AgradCcdfLogNormal_vv_41;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_42> AgradCcdfLogNormal_vv_42;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_43> AgradCcdfLogNormal_vv_43;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_44> AgradCcdfLogNormal_vv_44;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_45> AgradCcdfLogNormal_vv_45;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_46> AgradCcdfLogNormal_vv_46;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_47> AgradCcdfLogNormal_vv_47;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_48> AgradCcdfLogNormal_vv_48;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_49> AgradCcdfLogNormal_vv_49;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_50> AgradCcdfLogNormal_vv_50;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_51> AgradCcdfLogNormal_vv_51;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_52> AgradCcdfLogNormal_vv_52;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_53> AgradCcdfLogNormal_vv_53;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_54> AgradCcdfLogNormal_vv_54;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_55> AgradCcdfLogNormal_vv_55;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_56> AgradCcdfLogNormal_vv_56;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_57> AgradCcdfLogNormal_vv_57;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_58> AgradCcdfLogNormal_vv_58;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_59> AgradCcdfLogNormal_vv_59;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_60> AgradCcdfLogNormal_vv_60;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_61> AgradCcdfLogNormal_vv_61;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_62> AgradCcdfLogNormal_vv_62;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_63> AgradCcdfLogNormal_vv_63;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_64> AgradCcdfLogNormal_vv_64;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_65> AgradCcdfLogNormal_vv_65;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_66> AgradCcdfLogNormal_vv_66;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_67> AgradCcdfLogNormal_vv_67;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_68> AgradCcdfLogNormal_vv_68;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_69> AgradCcdfLogNormal_vv_69;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_70> AgradCcdfLogNormal_vv_70;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_71> AgradCcdfLogNormal_vv_71;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_72> AgradCcdfLogNormal_vv_72;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_73> AgradCcdfLogNormal_vv_73;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_74> AgradCcdfLogNormal_vv_74;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_75> AgradCcdfLogNormal_vv_75;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_76> AgradCcdfLogNormal_vv_76;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_77> AgradCcdfLogNormal_vv_77;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_78> AgradCcdfLogNormal_vv_78;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_79> AgradCcdfLogNormal_vv_79;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_80> AgradCcdfLogNormal_vv_80;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_81> AgradCcdfLogNormal_vv_81;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_82> AgradCcdfLogNormal_vv_82;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_83> AgradCcdfLogNormal_vv_83;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_84> AgradCcdfLogNormal_vv_84;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_85> AgradCcdfLogNormal_vv_85;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_86> AgradCcdfLogNormal_vv_86;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_87> AgradCcdfLogNormal_vv_87;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_88> AgradCcdfLogNormal_vv_88;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_89> AgradCcdfLogNormal_vv_89;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_90> AgradCcdfLogNormal_vv_90;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_91> AgradCcdfLogNormal_vv_91;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_92> AgradCcdfLogNormal_vv_92;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_93> AgradCcdfLogNormal_vv_93;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_94> AgradCcdfLogNormal_vv_94;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_95> AgradCcdfLogNormal_vv_95;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_96> AgradCcdfLogNormal_vv_96;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_97> AgradCcdfLogNormal_vv_97;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_98> AgradCcdfLogNormal_vv_98;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_99> AgradCcdfLogNormal_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_99);
+
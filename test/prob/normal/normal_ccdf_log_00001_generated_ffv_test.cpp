@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_100> AgradCcdfLogNormal_ffv_100;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_101> AgradCcdfLogNormal_ffv_101;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_102> AgradCcdfLogNormal_ffv_102;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_103> AgradCcdfLogNormal_ffv_103;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_104> AgradCcdfLogNormal_ffv_104;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_105> AgradCcdfLogNormal_ffv_105;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_106> AgradCcdfLogNormal_ffv_106;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_107> AgradCcdfLogNormal_ffv_107;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_108> AgradCcdfLogNormal_ffv_108;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_109> AgradCcdfLogNormal_ffv_109;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_110> AgradCcdfLogNormal_ffv_110;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_111> AgradCcdfLogNormal_ffv_111;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_112> AgradCcdfLogNormal_ffv_112;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_113> AgradCcdfLogNormal_ffv_113;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_114> AgradCcdfLogNormal_ffv_114;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_115> AgradCcdfLogNormal_ffv_115;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_116> AgradCcdfLogNormal_ffv_116;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_117> AgradCcdfLogNormal_ffv_117;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_118> AgradCcdfLogNormal_ffv_118;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_119> AgradCcdfLogNormal_ffv_119;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_120> AgradCcdfLogNormal_ffv_120;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_121> AgradCcdfLogNormal_ffv_121;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_122> AgradCcdfLogNormal_ffv_122;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_123> AgradCcdfLogNormal_ffv_123;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_124> AgradCcdfLogNormal_ffv_124;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_125> AgradCcdfLogNormal_ffv_125;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_126> AgradCcdfLogNormal_ffv_126;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_127> AgradCcdfLogNormal_ffv_127;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_128> AgradCcdfLogNormal_ffv_128;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_129> AgradCcdfLogNormal_ffv_129;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_130> AgradCcdfLogNormal_ffv_130;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_131> AgradCcdfLogNormal_ffv_131;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_132> AgradCcdfLogNormal_ffv_132;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_133> AgradCcdfLogNormal_ffv_133;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_134> AgradCcdfLogNormal_ffv_134;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_135> AgradCcdfLogNormal_ffv_135;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_136> AgradCcdfLogNormal_ffv_136;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_137> AgradCcdfLogNormal_ffv_137;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_138> AgradCcdfLogNormal_ffv_138;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_139> AgradCcdfLogNormal_ffv_139;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_140> AgradCcdfLogNormal_ffv_140;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_141> AgradCcdfLogNormal_ffv_141;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_142> AgradCcdfLogNormal_ffv_142;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_143> AgradCcdfLogNormal_ffv_143;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_144> AgradCcdfLogNormal_ffv_144;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_145> AgradCcdfLogNormal_ffv_145;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_146> AgradCcdfLogNormal_ffv_146;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_147> AgradCcdfLogNormal_ffv_147;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_148> AgradCcdfLogNormal_ffv_148;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_149> AgradCcdfLogNormal_ffv_149;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_150> AgradCcdfLogNormal_ffv_150;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_151> AgradCcdfLogNormal_ffv_151;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_152> AgradCcdfLogNormal_ffv_152;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_153> AgradCcdfLogNormal_ffv_153;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_154> AgradCcdfLogNormal_ffv_154;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_155> AgradCcdfLogNormal_ffv_155;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_156> AgradCcdfLogNormal_ffv_156;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_157> AgradCcdfLogNormal_ffv_157;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_158> AgradCcdfLogNormal_ffv_158;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_159> AgradCcdfLogNormal_ffv_159;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_160> AgradCcdfLogNormal_ffv_160;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_161> AgradCcdfLogNormal_ffv_161;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_162> AgradCcdfLogNormal_ffv_162;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_163> AgradCcdfLogNormal_ffv_163;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_164> AgradCcdfLogNormal_ffv_164;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_165> AgradCcdfLogNormal_ffv_165;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_166> AgradCcdfLogNormal_ffv_166;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_167> AgradCcdfLogNormal_ffv_167;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_168> AgradCcdfLogNormal_ffv_168;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_169> AgradCcdfLogNormal_ffv_169;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_170> AgradCcdfLogNormal_ffv_170;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_171> AgradCcdfLogNormal_ffv_171;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_172> AgradCcdfLogNormal_ffv_172;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_173> AgradCcdfLogNormal_ffv_173;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_174> AgradCcdfLogNormal_ffv_174;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_175> AgradCcdfLogNormal_ffv_175;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_176> AgradCcdfLogNormal_ffv_176;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_177> AgradCcdfLogNormal_ffv_177;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_178> AgradCcdfLogNormal_ffv_178;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_179> AgradCcdfLogNormal_ffv_179;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_180> AgradCcdfLogNormal_ffv_180;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_181> AgradCcdfLogNormal_ffv_181;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_182> AgradCcdfLogNormal_ffv_182;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_183> AgradCcdfLogNormal_ffv_183;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_184> AgradCcdfLogNormal_ffv_184;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_185> AgradCcdfLogNormal_ffv_185;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_186> AgradCcdfLogNormal_ffv_186;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_187> AgradCcdfLogNormal_ffv_187;
+typedef std::tuple<AgradCcdfLogNormal, type_ffv_188> AgradCcdfLogNormal_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogNormal_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogNormal, type_v_100> AgradCcdfLogNormal_v_100;
+typedef std::tuple<AgradCcdfLogNormal, type_v_101> AgradCcdfLogNormal_v_101;
+typedef std::tuple<AgradCcdfLogNormal, type_v_102> AgradCcdfLogNormal_v_102;
+typedef std::tuple<AgradCcdfLogNormal, type_v_103> AgradCcdfLogNormal_v_103;
+typedef std::tuple<AgradCcdfLogNormal, type_v_104> AgradCcdfLogNormal_v_104;
+typedef std::tuple<AgradCcdfLogNormal, type_v_105> AgradCcdfLogNormal_v_105;
+typedef std::tuple<AgradCcdfLogNormal, type_v_106> AgradCcdfLogNormal_v_106;
+typedef std::tuple<AgradCcdfLogNormal, type_v_107> AgradCcdfLogNormal_v_107;
+typedef std::tuple<AgradCcdfLogNormal, type_v_108> AgradCcdfLogNormal_v_108;
+typedef std::tuple<AgradCcdfLogNormal, type_v_109> AgradCcdfLogNormal_v_109;
+typedef std::tuple<AgradCcdfLogNormal, type_v_110> AgradCcdfLogNormal_v_110;
+typedef std::tuple<AgradCcdfLogNormal, type_v_111> AgradCcdfLogNormal_v_111;
+typedef std::tuple<AgradCcdfLogNormal, type_v_112> AgradCcdfLogNormal_v_112;
+typedef std::tuple<AgradCcdfLogNormal, type_v_113> AgradCcdfLogNormal_v_113;
+typedef std::tuple<AgradCcdfLogNormal, type_v_114> AgradCcdfLogNormal_v_114;
+typedef std::tuple<AgradCcdfLogNormal, type_v_115> AgradCcdfLogNormal_v_115;
+typedef std::tuple<AgradCcdfLogNormal, type_v_116> AgradCcdfLogNormal_v_116;
+typedef std::tuple<AgradCcdfLogNormal, type_v_117> AgradCcdfLogNormal_v_117;
+typedef std::tuple<AgradCcdfLogNormal, type_v_118> AgradCcdfLogNormal_v_118;
+typedef std::tuple<AgradCcdfLogNormal, type_v_119> AgradCcdfLogNormal_v_119;
+typedef std::tuple<AgradCcdfLogNormal, type_v_120> AgradCcdfLogNormal_v_120;
+typedef std::tuple<AgradCcdfLogNormal, type_v_121> AgradCcdfLogNormal_v_121;
+typedef std::tuple<AgradCcdfLogNormal, type_v_122> AgradCcdfLogNormal_v_122;
+typedef std::tuple<AgradCcdfLogNormal, type_v_123> AgradCcdfLogNormal_v_123;
+typedef std::tuple<AgradCcdfLogNormal, type_v_124> AgradCcdfLogNormal_v_124;
+typedef std::tuple<AgradCcdfLogNormal, type_v_125> AgradCcdfLogNormal_v_125;
+typedef std::tuple<AgradCcdfLogNormal, type_v_126> AgradCcdfLogNormal_v_126;
+typedef std::tuple<AgradCcdfLogNormal, type_v_127> AgradCcdfLogNormal_v_127;
+typedef std::tuple<AgradCcdfLogNormal, type_v_128> AgradCcdfLogNormal_v_128;
+typedef std::tuple<AgradCcdfLogNormal, type_v_129> AgradCcdfLogNormal_v_129;
+typedef std::tuple<AgradCcdfLogNormal, type_v_130> AgradCcdfLogNormal_v_130;
+typedef std::tuple<AgradCcdfLogNormal, type_v_131> AgradCcdfLogNormal_v_131;
+typedef std::tuple<AgradCcdfLogNormal, type_v_132> AgradCcdfLogNormal_v_132;
+typedef std::tuple<AgradCcdfLogNormal, type_v_133> AgradCcdfLogNormal_v_133;
+typedef std::tuple<AgradCcdfLogNormal, type_v_134> AgradCcdfLogNormal_v_134;
+typedef std::tuple<AgradCcdfLogNormal, type_v_135> AgradCcdfLogNormal_v_135;
+typedef std::tuple<AgradCcdfLogNormal, type_v_136> AgradCcdfLogNormal_v_136;
+typedef std::tuple<AgradCcdfLogNormal, type_v_137> AgradCcdfLogNormal_v_137;
+typedef std::tuple<AgradCcdfLogNormal, type_v_138> AgradCcdfLogNormal_v_138;
+typedef std::tuple<AgradCcdfLogNormal, type_v_139> AgradCcdfLogNormal_v_139;
+typedef std::tuple<AgradCcdfLogNormal, type_v_140> AgradCcdfLogNormal_v_140;
+typedef std::tuple<AgradCcdfLogNormal, type_v_141> AgradCcdfLogNormal_v_141;
+typedef std::tuple<AgradCcdfLogNormal, type_v_142> AgradCcdfLogNormal_v_142;
+typedef std::tuple<AgradCcdfLogNormal, type_v_143> AgradCcdfLogNormal_v_143;
+typedef std::tuple<AgradCcdfLogNormal, type_v_144> AgradCcdfLogNormal_v_144;
+typedef std::tuple<AgradCcdfLogNormal, type_v_145> AgradCcdfLogNormal_v_145;
+typedef std::tuple<AgradCcdfLogNormal, type_v_146> AgradCcdfLogNormal_v_146;
+typedef std::tuple<AgradCcdfLogNormal, type_v_147> AgradCcdfLogNormal_v_147;
+typedef std::tuple<AgradCcdfLogNormal, type_v_148> AgradCcdfLogNormal_v_148;
+typedef std::tuple<AgradCcdfLogNormal, type_v_149> AgradCcdfLogNormal_v_149;
+typedef std::tuple<AgradCcdfLogNormal, type_v_150> AgradCcdfLogNormal_v_150;
+typedef std::tuple<AgradCcdfLogNormal, type_v_151> AgradCcdfLogNormal_v_151;
+typedef std::tuple<AgradCcdfLogNormal, type_v_152> AgradCcdfLogNormal_v_152;
+typedef std::tuple<AgradCcdfLogNormal, type_v_153> AgradCcdfLogNormal_v_153;
+typedef std::tuple<AgradCcdfLogNormal, type_v_154> AgradCcdfLogNormal_v_154;
+typedef std::tuple<AgradCcdfLogNormal, type_v_155> AgradCcdfLogNormal_v_155;
+typedef std::tuple<AgradCcdfLogNormal, type_v_156> AgradCcdfLogNormal_v_156;
+typedef std::tuple<AgradCcdfLogNormal, type_v_157> AgradCcdfLogNormal_v_157;
+typedef std::tuple<AgradCcdfLogNormal, type_v_158> AgradCcdfLogNormal_v_158;
+typedef std::tuple<AgradCcdfLogNormal, type_v_159> AgradCcdfLogNormal_v_159;
+typedef std::tuple<AgradCcdfLogNormal, type_v_160> AgradCcdfLogNormal_v_160;
+typedef std::tuple<AgradCcdfLogNormal, type_v_161> AgradCcdfLogNormal_v_161;
+typedef std::tuple<AgradCcdfLogNormal, type_v_162> AgradCcdfLogNormal_v_162;
+typedef std::tuple<AgradCcdfLogNormal, type_v_163> AgradCcdfLogNormal_v_163;
+typedef std::tuple<AgradCcdfLogNormal, type_v_164> AgradCcdfLogNormal_v_164;
+typedef std::tuple<AgradCcdfLogNormal, type_v_165> AgradCcdfLogNormal_v_165;
+typedef std::tuple<AgradCcdfLogNormal, type_v_166> AgradCcdfLogNormal_v_166;
+typedef std::tuple<AgradCcdfLogNormal, type_v_167> AgradCcdfLogNormal_v_167;
+typedef std::tuple<AgradCcdfLogNormal, type_v_168> AgradCcdfLogNormal_v_168;
+typedef std::tuple<AgradCcdfLogNormal, type_v_169> AgradCcdfLogNormal_v_169;
+typedef std::tuple<AgradCcdfLogNormal, type_v_170> AgradCcdfLogNormal_v_170;
+typedef std::tuple<AgradCcdfLogNormal, type_v_171> AgradCcdfLogNormal_v_171;
+typedef std::tuple<AgradCcdfLogNormal, type_v_172> AgradCcdfLogNormal_v_172;
+typedef std::tuple<AgradCcdfLogNormal, type_v_173> AgradCcdfLogNormal_v_173;
+typedef std::tuple<AgradCcdfLogNormal, type_v_174> AgradCcdfLogNormal_v_174;
+typedef std::tuple<AgradCcdfLogNormal, type_v_175> AgradCcdfLogNormal_v_175;
+typedef std::tuple<AgradCcdfLogNormal, type_v_176> AgradCcdfLogNormal_v_176;
+typedef std::tuple<AgradCcdfLogNormal, type_v_177> AgradCcdfLogNormal_v_177;
+typedef std::tuple<AgradCcdfLogNormal, type_v_178> AgradCcdfLogNormal_v_178;
+typedef std::tuple<AgradCcdfLogNormal, type_v_179> AgradCcdfLogNormal_v_179;
+typedef std::tuple<AgradCcdfLogNormal, type_v_180> AgradCcdfLogNormal_v_180;
+typedef std::tuple<AgradCcdfLogNormal, type_v_181> AgradCcdfLogNormal_v_181;
+typedef std::tuple<AgradCcdfLogNormal, type_v_182> AgradCcdfLogNormal_v_182;
+typedef std::tuple<AgradCcdfLogNormal, type_v_183> AgradCcdfLogNormal_v_183;
+typedef std::tuple<AgradCcdfLogNormal, type_v_184> AgradCcdfLogNormal_v_184;
+typedef std::tuple<AgradCcdfLogNormal, type_v_185> AgradCcdfLogNormal_v_185;
+typedef std::tuple<AgradCcdfLogNormal, type_v_186> AgradCcdfLogNormal_v_186;
+typedef std::tuple<AgradCcdfLogNormal, type_v_187> AgradCcdfLogNormal_v_187;
+typedef std::tuple<AgradCcdfLogNormal, type_v_188> AgradCcdfLogNormal_v_188;
+typedef std::tuple<AgradCcdfLogNormal, type_v_189> AgradCcdfLogNormal_v_189;
+typedef std::tuple<AgradCcdfLogNormal, type_v_190> AgradCcdfLogNormal_v_190;
+typedef std::tuple<AgradCcdfLogNormal, type_v_191> AgradCcdfLogNormal_v_191;
+typedef std::tuple<AgradCcdfLogNormal, type_v_192> AgradCcdfLogNormal_v_192;
+typedef std::tuple<AgradCcdfLogNormal, type_v_193> AgradCcdfLogNormal_v_193;
+typedef std::tuple<AgradCcdfLogNormal, type_v_194> AgradCcdfLogNormal_v_194;
+typedef std::tuple<AgradCcdfLogNormal, type_v_195> AgradCcdfLogNormal_v_195;
+typedef std::tuple<AgradCcdfLogNormal, type_v_196> AgradCcdfLogNormal_v_196;
+typedef std::tuple<AgradCcdfLogNormal, type_v_197> AgradCcdfLogNormal_v_197;
+typedef std::tuple<AgradCcdfLogNormal, type_v_198> AgradCcdfLogNormal_v_198;
+typedef std::tuple<AgradCcdfLogNormal, type_v_199> AgradCcdfLogNormal_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_100, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_101, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_102, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_103, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_104, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_105, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_106, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_107, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_108, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_109, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_110, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_111, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_112, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_113, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_114, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_115, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_116, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_117, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_118, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_119, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_120, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_121, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_122, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_123, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_124, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_125, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_126, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_127, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_128, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_129, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_130, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_131, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_132, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_133, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_134, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_135, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_136, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_137, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_138, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_139, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_140, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_141, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_142, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_143, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_144, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_145, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_146, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_147, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_148, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_149, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_150, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_151, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_152, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_153, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_154, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_155, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_156, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_157, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_158, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_159, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_160, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_161, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_162, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_163, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_164, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_165, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_166, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_167, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_168, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_169, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_170, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_171, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_172, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_173, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_174, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_175, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_176, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_177, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_178, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_179, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_180, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_181, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_182, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_183, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_184, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_185, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_186, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_187, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_188, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_189, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_190, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_191, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_192, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_193, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_194, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_195, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_196, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_197, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_198, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_v_199, AgradCcdfLogTestFixture, AgradCcdfLogNormal_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogNormal, type_vv_100> AgradCcdfLogNormal_vv_100;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_101> AgradCcdfLogNormal_vv_101;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_102> AgradCcdfLogNormal_vv_102;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_103> AgradCcdfLogNormal_vv_103;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_104> AgradCcdfLogNormal_vv_104;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_105> AgradCcdfLogNormal_vv_105;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_106> AgradCcdfLogNormal_vv_106;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_107> AgradCcdfLogNormal_vv_107;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_108> AgradCcdfLogNormal_vv_108;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_109> AgradCcdfLogNormal_vv_109;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_110> AgradCcdfLogNormal_vv_110;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_111> AgradCcdfLogNormal_vv_111;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_112> AgradCcdfLogNormal_vv_112;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_113> AgradCcdfLogNormal_vv_113;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_114> AgradCcdfLogNormal_vv_114;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_115> AgradCcdfLogNormal_vv_115;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_116> AgradCcdfLogNormal_vv_116;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_117> AgradCcdfLogNormal_vv_117;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_118> AgradCcdfLogNormal_vv_118;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_119> AgradCcdfLogNormal_vv_119;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_120> AgradCcdfLogNormal_vv_120;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_121> AgradCcdfLogNormal_vv_121;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_122> AgradCcdfLogNormal_vv_122;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_123> AgradCcdfLogNormal_vv_123;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_124> AgradCcdfLogNormal_vv_124;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_125> AgradCcdfLogNormal_vv_125;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_126> AgradCcdfLogNormal_vv_126;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_127> AgradCcdfLogNormal_vv_127;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_128> AgradCcdfLogNormal_vv_128;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_129> AgradCcdfLogNormal_vv_129;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_130> AgradCcdfLogNormal_vv_130;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_131> AgradCcdfLogNormal_vv_131;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_132> AgradCcdfLogNormal_vv_132;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_133> AgradCcdfLogNormal_vv_133;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_134> AgradCcdfLogNormal_vv_134;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_135> AgradCcdfLogNormal_vv_135;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_136> AgradCcdfLogNormal_vv_136;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_137> AgradCcdfLogNormal_vv_137;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_138> AgradCcdfLogNormal_vv_138;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_139> AgradCcdfLogNormal_vv_139;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_140> AgradCcdfLogNormal_vv_140;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_141> AgradCcdfLogNormal_vv_141;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_142> AgradCcdfLogNormal_vv_142;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_143> AgradCcdfLogNormal_vv_143;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_144> AgradCcdfLogNormal_vv_144;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_145> AgradCcdfLogNormal_vv_145;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_146> AgradCcdfLogNormal_vv_146;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_147> AgradCcdfLogNormal_vv_147;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_148> AgradCcdfLogNormal_vv_148;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_149> AgradCcdfLogNormal_vv_149;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_150> AgradCcdfLogNormal_vv_150;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_151> AgradCcdfLogNormal_vv_151;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_152> AgradCcdfLogNormal_vv_152;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_153> AgradCcdfLogNormal_vv_153;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_154> AgradCcdfLogNormal_vv_154;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_155> AgradCcdfLogNormal_vv_155;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_156> AgradCcdfLogNormal_vv_156;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_157> AgradCcdfLogNormal_vv_157;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_158> AgradCcdfLogNormal_vv_158;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_159> AgradCcdfLogNormal_vv_159;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_160> AgradCcdfLogNormal_vv_160;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_161> AgradCcdfLogNormal_vv_161;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_162> AgradCcdfLogNormal_vv_162;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_163> AgradCcdfLogNormal_vv_163;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_164> AgradCcdfLogNormal_vv_164;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_165> AgradCcdfLogNormal_vv_165;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_166> AgradCcdfLogNormal_vv_166;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_167> AgradCcdfLogNormal_vv_167;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_168> AgradCcdfLogNormal_vv_168;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_169> AgradCcdfLogNormal_vv_169;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_170> AgradCcdfLogNormal_vv_170;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_171> AgradCcdfLogNormal_vv_171;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_172> AgradCcdfLogNormal_vv_172;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_173> AgradCcdfLogNormal_vv_173;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_174> AgradCcdfLogNormal_vv_174;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_175> AgradCcdfLogNormal_vv_175;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_176> AgradCcdfLogNormal_vv_176;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_177> AgradCcdfLogNormal_vv_177;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_178> AgradCcdfLogNormal_vv_178;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_179> AgradCcdfLogNormal_vv_179;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_180> AgradCcdfLogNormal_vv_180;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_181> AgradCcdfLogNormal_vv_181;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_182> AgradCcdfLogNormal_vv_182;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_183> AgradCcdfLogNormal_vv_183;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_184> AgradCcdfLogNormal_vv_184;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_185> AgradCcdfLogNormal_vv_185;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_186> AgradCcdfLogNormal_vv_186;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_187> AgradCcdfLogNormal_vv_187;
+typedef std::tuple<AgradCcdfLogNormal, type_vv_188> AgradCcdfLogNormal_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogNormal_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogNormal_vv_188);
+
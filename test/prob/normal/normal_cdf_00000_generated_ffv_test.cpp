@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfNormal, type_ffv_0> AgradCdfNormal_ffv_0;
+typedef std::tuple<AgradCdfNormal, type_ffv_1> AgradCdfNormal_ffv_1;
+typedef std::tuple<AgradCdfNormal, type_ffv_2> AgradCdfNormal_ffv_2;
+typedef std::tuple<AgradCdfNormal, type_ffv_3> AgradCdfNormal_ffv_3;
+typedef std::tuple<AgradCdfNormal, type_ffv_4> AgradCdfNormal_ffv_4;
+typedef std::tuple<AgradCdfNormal, type_ffv_5> AgradCdfNormal_ffv_5;
+typedef std::tuple<AgradCdfNormal, type_ffv_6> AgradCdfNormal_ffv_6;
+typedef std::tuple<AgradCdfNormal, type_ffv_7> AgradCdfNormal_ffv_7;
+typedef std::tuple<AgradCdfNormal, type_ffv_8> AgradCdfNormal_ffv_8;
+typedef std::tuple<AgradCdfNormal, type_ffv_9> AgradCdfNormal_ffv_9;
+typedef std::tuple<AgradCdfNormal, type_ffv_10> AgradCdfNormal_ffv_10;
+typedef std::tuple<AgradCdfNormal, type_ffv_11> AgradCdfNormal_ffv_11;
+typedef std::tuple<AgradCdfNormal, type_ffv_12> AgradCdfNormal_ffv_12;
+typedef std::tuple<AgradCdfNormal, type_ffv_13> AgradCdfNormal_ffv_13;
+typedef std::tuple<AgradCdfNormal, type_ffv_14> AgradCdfNormal_ffv_14;
+typedef std::tuple<AgradCdfNormal, type_ffv_15> AgradCdfNormal_ffv_15;
+typedef std::tuple<AgradCdfNormal, type_ffv_16> AgradCdfNormal_ffv_16;
+typedef std::tuple<AgradCdfNormal, type_ffv_17> AgradCdfNormal_ffv_17;
+typedef std::tuple<AgradCdfNormal, type_ffv_18> AgradCdfNormal_ffv_18;
+typedef std::tuple<AgradCdfNormal, type_ffv_19> AgradCdfNormal_ffv_19;
+typedef std::tuple<AgradCdfNormal, type_ffv_20> AgradCdfNormal_ffv_20;
+typedef std::tuple<AgradCdfNormal, type_ffv_21> AgradCdfNormal_ffv_21;
+typedef std::tuple<AgradCdfNormal, type_ffv_22> AgradCdfNormal_ffv_22;
+typedef std::tuple<AgradCdfNormal, type_ffv_23> AgradCdfNormal_ffv_23;
+typedef std::tuple<AgradCdfNormal, type_ffv_24> AgradCdfNormal_ffv_24;
+typedef std::tuple<AgradCdfNormal, type_ffv_25> AgradCdfNormal_ffv_25;
+typedef std::tuple<AgradCdfNormal, type_ffv_26> AgradCdfNormal_ffv_26;
+typedef std::tuple<AgradCdfNormal, type_ffv_27> AgradCdfNormal_ffv_27;
+typedef std::tuple<AgradCdfNormal, type_ffv_28> AgradCdfNormal_ffv_28;
+typedef std::tuple<AgradCdfNormal, type_ffv_29> AgradCdfNormal_ffv_29;
+typedef std::tuple<AgradCdfNormal, type_ffv_30> AgradCdfNormal_ffv_30;
+typedef std::tuple<AgradCdfNormal, type_ffv_31> AgradCdfNormal_ffv_31;
+typedef std::tuple<AgradCdfNormal, type_ffv_32> AgradCdfNormal_ffv_32;
+typedef std::tuple<AgradCdfNormal, type_ffv_33> AgradCdfNormal_ffv_33;
+typedef std::tuple<AgradCdfNormal, type_ffv_34> AgradCdfNormal_ffv_34;
+typedef std::tuple<AgradCdfNormal, type_ffv_35> AgradCdfNormal_ffv_35;
+typedef std::tuple<AgradCdfNormal, type_ffv_36> AgradCdfNormal_ffv_36;
+typedef std::tuple<AgradCdfNormal, type_ffv_37> AgradCdfNormal_ffv_37;
+typedef std::tuple<AgradCdfNormal, type_ffv_38> AgradCdfNormal_ffv_38;
+typedef std::tuple<AgradCdfNormal, type_ffv_39> AgradCdfNormal_ffv_39;
+typedef std::tuple<AgradCdfNormal, type_ffv_40> AgradCdfNormal_ffv_40;
+typedef std::tuple<AgradCdfNormal, type_ffv_41> AgradCdfNormal_ffv_41;
+typedef std::tuple<AgradCdfNormal, type_ffv_42> AgradCdfNormal_ffv_42;
+typedef std::tuple<AgradCdfNormal, type_ffv_43> AgradCdfNormal_ffv_43;
+typedef std::tuple<AgradCdfNormal, type_ffv_44> AgradCdfNormal_ffv_44;
+typedef std::tuple<AgradCdfNormal, type_ffv_45> AgradCdfNormal_ffv_45;
+typedef std::tuple<AgradCdfNormal, type_ffv_46> AgradCdfNormal_ffv_46;
+typedef std::tuple<AgradCdfNormal, type_ffv_47> AgradCdfNormal_ffv_47;
+typedef std::tuple<AgradCdfNormal, type_ffv_48> AgradCdfNormal_ffv_48;
+typedef std::tuple<AgradCdfNormal, type_ffv_49> AgradCdfNormal_ffv_49;
+typedef std::tuple<AgradCdfNormal, type_ffv_50> AgradCdfNormal_ffv_50;
+typedef std::tuple<AgradCdfNormal, type_ffv_51> AgradCdfNormal_ffv_51;
+typedef std::tuple<AgradCdfNormal, type_ffv_52> AgradCdfNormal_ffv_52;
+typedef std::tuple<AgradCdfNormal, type_ffv_53> AgradCdfNormal_ffv_53;
+typedef std::tuple<AgradCdfNormal, type_ffv_54> AgradCdfNormal_ffv_54;
+typedef std::tuple<AgradCdfNormal, type_ffv_55> AgradCdfNormal_ffv_55;
+typedef std::tuple<AgradCdfNormal, type_ffv_56> AgradCdfNormal_ffv_56;
+typedef std::tuple<AgradCdfNormal, type_ffv_57> AgradCdfNormal_ffv_57;
+typedef std::tuple<AgradCdfNormal, type_ffv_58> AgradCdfNormal_ffv_58;
+typedef std::tuple<AgradCdfNormal, type_ffv_59> AgradCdfNormal_ffv_59;
+typedef std::tuple<AgradCdfNormal, type_ffv_60> AgradCdfNormal_ffv_60;
+typedef std::tuple<AgradCdfNormal, type_ffv_61> AgradCdfNormal_ffv_61;
+typedef std::tuple<AgradCdfNormal, type_ffv_62> AgradCdfNormal_ffv_62;
+typedef std::tuple<AgradCdfNormal, type_ffv_63> AgradCdfNormal_ffv_63;
+typedef std::tuple<AgradCdfNormal, type_ffv_64> AgradCdfNormal_ffv_64;
+typedef std::tuple<AgradCdfNormal, type_ffv_65> AgradCdfNormal_ffv_65;
+typedef std::tuple<AgradCdfNormal, type_ffv_66> AgradCdfNormal_ffv_66;
+typedef std::tuple<AgradCdfNormal, type_ffv_67> AgradCdfNormal_ffv_67;
+typedef std::tuple<AgradCdfNormal, type_ffv_68> AgradCdfNormal_ffv_68;
+typedef std::tuple<AgradCdfNormal, type_ffv_69> AgradCdfNormal_ffv_69;
+typedef std::tuple<AgradCdfNormal, type_ffv_70> AgradCdfNormal_ffv_70;
+typedef std::tuple<AgradCdfNormal, type_ffv_71> AgradCdfNormal_ffv_71;
+typedef std::tuple<AgradCdfNormal, type_ffv_72> AgradCdfNormal_ffv_72;
+typedef std::tuple<AgradCdfNormal, type_ffv_73> AgradCdfNormal_ffv_73;
+typedef std::tuple<AgradCdfNormal, type_ffv_74> AgradCdfNormal_ffv_74;
+typedef std::tuple<AgradCdfNormal, type_ffv_75> AgradCdfNormal_ffv_75;
+typedef std::tuple<AgradCdfNormal, type_ffv_76> AgradCdfNormal_ffv_76;
+typedef std::tuple<AgradCdfNormal, type_ffv_77> AgradCdfNormal_ffv_77;
+typedef std::tuple<AgradCdfNormal, type_ffv_78> AgradCdfNormal_ffv_78;
+typedef std::tuple<AgradCdfNormal, type_ffv_79> AgradCdfNormal_ffv_79;
+typedef std::tuple<AgradCdfNormal, type_ffv_80> AgradCdfNormal_ffv_80;
+typedef std::tuple<AgradCdfNormal, type_ffv_81> AgradCdfNormal_ffv_81;
+typedef std::tuple<AgradCdfNormal, type_ffv_82> AgradCdfNormal_ffv_82;
+typedef std::tuple<AgradCdfNormal, type_ffv_83> AgradCdfNormal_ffv_83;
+typedef std::tuple<AgradCdfNormal, type_ffv_84> AgradCdfNormal_ffv_84;
+typedef std::tuple<AgradCdfNormal, type_ffv_85> AgradCdfNormal_ffv_85;
+typedef std::tuple<AgradCdfNormal, type_ffv_86> AgradCdfNormal_ffv_86;
+typedef std::tuple<AgradCdfNormal, type_ffv_87> AgradCdfNormal_ffv_87;
+typedef std::tuple<AgradCdfNormal, type_ffv_88> AgradCdfNormal_ffv_88;
+typedef std::tuple<AgradCdfNormal, type_ffv_89> AgradCdfNormal_ffv_89;
+typedef std::tuple<AgradCdfNormal, type_ffv_90> AgradCdfNormal_ffv_90;
+typedef std::tuple<AgradCdfNormal, type_ffv_91> AgradCdfNormal_ffv_91;
+typedef std::tuple<AgradCdfNormal, type_ffv_92> AgradCdfNormal_ffv_92;
+typedef std::tuple<AgradCdfNormal, type_ffv_93> AgradCdfNormal_ffv_93;
+typedef std::tuple<AgradCdfNormal, type_ffv_94> AgradCdfNormal_ffv_94;
+typedef std::tuple<AgradCdfNormal, type_ffv_95> AgradCdfNormal_ffv_95;
+typedef std::tuple<AgradCdfNormal, type_ffv_96> AgradCdfNormal_ffv_96;
+typedef std::tuple<AgradCdfNormal, type_ffv_97> AgradCdfNormal_ffv_97;
+typedef std::tuple<AgradCdfNormal, type_ffv_98> AgradCdfNormal_ffv_98;
+typedef std::tuple<AgradCdfNormal, type_ffv_99> AgradCdfNormal_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_0, AgradCdfTestFixture, AgradCdfNormal_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_1, AgradCdfTestFixture, AgradCdfNormal_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_2, AgradCdfTestFixture, AgradCdfNormal_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_3, AgradCdfTestFixture, AgradCdfNormal_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_4, AgradCdfTestFixture, AgradCdfNormal_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_5, AgradCdfTestFixture, AgradCdfNormal_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_6, AgradCdfTestFixture, AgradCdfNormal_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_7, AgradCdfTestFixture, AgradCdfNormal_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_8, AgradCdfTestFixture, AgradCdfNormal_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_9, AgradCdfTestFixture, AgradCdfNormal_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_10, AgradCdfTestFixture, AgradCdfNormal_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_11, AgradCdfTestFixture, AgradCdfNormal_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_12, AgradCdfTestFixture, AgradCdfNormal_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_13, AgradCdfTestFixture, AgradCdfNormal_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_14, AgradCdfTestFixture, AgradCdfNormal_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_15, AgradCdfTestFixture, AgradCdfNormal_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_16, AgradCdfTestFixture, AgradCdfNormal_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_17, AgradCdfTestFixture, AgradCdfNormal_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_18, AgradCdfTestFixture, AgradCdfNormal_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_19, AgradCdfTestFixture, AgradCdfNormal_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_20, AgradCdfTestFixture, AgradCdfNormal_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_21, AgradCdfTestFixture, AgradCdfNormal_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_22, AgradCdfTestFixture, AgradCdfNormal_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_23, AgradCdfTestFixture, AgradCdfNormal_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_24, AgradCdfTestFixture, AgradCdfNormal_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_25, AgradCdfTestFixture, AgradCdfNormal_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_26, AgradCdfTestFixture, AgradCdfNormal_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_27, AgradCdfTestFixture, AgradCdfNormal_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_28, AgradCdfTestFixture, AgradCdfNormal_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_29, AgradCdfTestFixture, AgradCdfNormal_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_30, AgradCdfTestFixture, AgradCdfNormal_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_31, AgradCdfTestFixture, AgradCdfNormal_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_32, AgradCdfTestFixture, AgradCdfNormal_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_33, AgradCdfTestFixture, AgradCdfNormal_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_34, AgradCdfTestFixture, AgradCdfNormal_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_35, AgradCdfTestFixture, AgradCdfNormal_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_36, AgradCdfTestFixture, AgradCdfNormal_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_37, AgradCdfTestFixture, AgradCdfNormal_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_38, AgradCdfTestFixture, AgradCdfNormal_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_39, AgradCdfTestFixture, AgradCdfNormal_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_40, AgradCdfTestFixture, AgradCdfNormal_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_41, AgradCdfTestFixture, AgradCdfNormal_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_42, AgradCdfTestFixture, AgradCdfNormal_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_43, AgradCdfTestFixture, AgradCdfNormal_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_44, AgradCdfTestFixture, AgradCdfNormal_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_45, AgradCdfTestFixture, AgradCdfNormal_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_46, AgradCdfTestFixture, AgradCdfNormal_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_47, AgradCdfTestFixture, AgradCdfNormal_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_48, AgradCdfTestFixture, AgradCdfNormal_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_49, AgradCdfTestFixture, AgradCdfNormal_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_50, AgradCdfTestFixture, AgradCdfNormal_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_51, AgradCdfTestFixture, AgradCdfNormal_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_52, AgradCdfTestFixture, AgradCdfNormal_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_53, AgradCdfTestFixture, AgradCdfNormal_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_54, AgradCdfTestFixture, AgradCdfNormal_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_55, AgradCdfTestFixture, AgradCdfNormal_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_56, AgradCdfTestFixture, AgradCdfNormal_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_57, AgradCdfTestFixture, AgradCdfNormal_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_58, AgradCdfTestFixture, AgradCdfNormal_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_59, AgradCdfTestFixture, AgradCdfNormal_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_60, AgradCdfTestFixture, AgradCdfNormal_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_61, AgradCdfTestFixture, AgradCdfNormal_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_62, AgradCdfTestFixture, AgradCdfNormal_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_63, AgradCdfTestFixture, AgradCdfNormal_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_64, AgradCdfTestFixture, AgradCdfNormal_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_65, AgradCdfTestFixture, AgradCdfNormal_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_66, AgradCdfTestFixture, AgradCdfNormal_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_67, AgradCdfTestFixture, AgradCdfNormal_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_68, AgradCdfTestFixture, AgradCdfNormal_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_69, AgradCdfTestFixture, AgradCdfNormal_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_70, AgradCdfTestFixture, AgradCdfNormal_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_71, AgradCdfTestFixture, AgradCdfNormal_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_72, AgradCdfTestFixture, AgradCdfNormal_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_73, AgradCdfTestFixture, AgradCdfNormal_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_74, AgradCdfTestFixture, AgradCdfNormal_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_75, AgradCdfTestFixture, AgradCdfNormal_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_76, AgradCdfTestFixture, AgradCdfNormal_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_77, AgradCdfTestFixture, AgradCdfNormal_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_78, AgradCdfTestFixture, AgradCdfNormal_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_79, AgradCdfTestFixture, AgradCdfNormal_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_80, AgradCdfTestFixture, AgradCdfNormal_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_81, AgradCdfTestFixture, AgradCdfNormal_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_82, AgradCdfTestFixture, AgradCdfNormal_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_83, AgradCdfTestFixture, AgradCdfNormal_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_84, AgradCdfTestFixture, AgradCdfNormal_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_85, AgradCdfTestFixture, AgradCdfNormal_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_86, AgradCdfTestFixture, AgradCdfNormal_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_87, AgradCdfTestFixture, AgradCdfNormal_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_88, AgradCdfTestFixture, AgradCdfNormal_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_89, AgradCdfTestFixture, AgradCdfNormal_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_90, AgradCdfTestFixture, AgradCdfNormal_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_91, AgradCdfTestFixture, AgradCdfNormal_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_92, AgradCdfTestFixture, AgradCdfNormal_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_93, AgradCdfTestFixture, AgradCdfNormal_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_94, AgradCdfTestFixture, AgradCdfNormal_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_95, AgradCdfTestFixture, AgradCdfNormal_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_96, AgradCdfTestFixture, AgradCdfNormal_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_97, AgradCdfTestFixture, AgradCdfNormal_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_98, AgradCdfTestFixture, AgradCdfNormal_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_99, AgradCdfTestFixture, AgradCdfNormal_ffv_99);
+
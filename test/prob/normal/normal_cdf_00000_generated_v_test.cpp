@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfNormal, type_v_0> AgradCdfNormal_v_0;
+typedef std::tuple<AgradCdfNormal, type_v_1> AgradCdfNormal_v_1;
+typedef std::tuple<AgradCdfNormal, type_v_2> AgradCdfNormal_v_2;
+typedef std::tuple<AgradCdfNormal, type_v_3> AgradCdfNormal_v_3;
+typedef std::tuple<AgradCdfNormal, type_v_4> AgradCdfNormal_v_4;
+typedef std::tuple<AgradCdfNormal, type_v_5> AgradCdfNormal_v_5;
+typedef std::tuple<AgradCdfNormal, type_v_6> AgradCdfNormal_v_6;
+typedef std::tuple<AgradCdfNormal, type_v_7> AgradCdfNormal_v_7;
+typedef std::tuple<AgradCdfNormal, type_v_8> AgradCdfNormal_v_8;
+typedef std::tuple<AgradCdfNormal, type_v_9> AgradCdfNormal_v_9;
+typedef std::tuple<AgradCdfNormal, type_v_10> AgradCdfNormal_v_10;
+typedef std::tuple<AgradCdfNormal, type_v_11> AgradCdfNormal_v_11;
+typedef std::tuple<AgradCdfNormal, type_v_12> AgradCdfNormal_v_12;
+typedef std::tuple<AgradCdfNormal, type_v_13> AgradCdfNormal_v_13;
+typedef std::tuple<AgradCdfNormal, type_v_14> AgradCdfNormal_v_14;
+typedef std::tuple<AgradCdfNormal, type_v_15> AgradCdfNormal_v_15;
+typedef std::tuple<AgradCdfNormal, type_v_16> AgradCdfNormal_v_16;
+typedef std::tuple<AgradCdfNormal, type_v_17> AgradCdfNormal_v_17;
+typedef std::tuple<AgradCdfNormal, type_v_18> AgradCdfNormal_v_18;
+typedef std::tuple<AgradCdfNormal, type_v_19> AgradCdfNormal_v_19;
+typedef std::tuple<AgradCdfNormal, type_v_20> AgradCdfNormal_v_20;
+typedef std::tuple<AgradCdfNormal, type_v_21> AgradCdfNormal_v_21;
+typedef std::tuple<AgradCdfNormal, type_v_22> AgradCdfNormal_v_22;
+typedef std::tuple<AgradCdfNormal, type_v_23> AgradCdfNormal_v_23;
+typedef std::tuple<AgradCdfNormal, type_v_24> AgradCdfNormal_v_24;
+typedef std::tuple<AgradCdfNormal, type_v_25> AgradCdfNormal_v_25;
+typedef std::tuple<AgradCdfNormal, type_v_26> AgradCdfNormal_v_26;
+typedef std::tuple<AgradCdfNormal, type_v_27> AgradCdfNormal_v_27;
+typedef std::tuple<AgradCdfNormal, type_v_28> AgradCdfNormal_v_28;
+typedef std::tuple<AgradCdfNormal, type_v_29> AgradCdfNormal_v_29;
+typedef std::tuple<AgradCdfNormal, type_v_30> AgradCdfNormal_v_30;
+typedef std::tuple<AgradCdfNormal, type_v_31> AgradCdfNormal_v_31;
+typedef std::tuple<AgradCdfNormal, type_v_32> AgradCdfNormal_v_32;
+typedef std::tuple<AgradCdfNormal, type_v_33> AgradCdfNormal_v_33;
+typedef std::tuple<AgradCdfNormal, type_v_34> AgradCdfNormal_v_34;
+typedef std::tuple<AgradCdfNormal, type_v_35> AgradCdfNormal_v_35;
+typedef std::tuple<AgradCdfNormal, type_v_36> AgradCdfNormal_v_36;
+typedef std::tuple<AgradCdfNormal, type_v_37> AgradCdfNormal_v_37;
+typedef std::tuple<AgradCdfNormal, type_v_38> AgradCdfNormal_v_38;
+typedef std::tuple<AgradCdfNormal, type_v_39> AgradCdfNormal_v_39;
+typedef std::tuple<AgradCdfNormal, type_v_40> AgradCdfNormal_v_40;
+typedef std::tuple<AgradCdfNormal, type_v_41> AgradCdfNormal_v_41;
+typedef std::tuple<AgradCdfNormal, type_v_42> AgradCdfNormal_v_42;
+typedef std::tuple<AgradCdfNormal, type_v_43> AgradCdfNormal_v_43;
+typedef std::tuple<AgradCdfNormal, type_v_44> AgradCdfNormal_v_44;
+typedef std::tuple<AgradCdfNormal, type_v_45> AgradCdfNormal_v_45;
+typedef std::tuple<AgradCdfNormal, type_v_46> AgradCdfNormal_v_46;
+typedef std::tuple<AgradCdfNormal, type_v_47> AgradCdfNormal_v_47;
+typedef std::tuple<AgradCdfNormal, type_v_48> AgradCdfNormal_v_48;
+typedef std::tuple<AgradCdfNormal, type_v_49> AgradCdfNormal_v_49;
+typedef std::tuple<AgradCdfNormal, type_v_50> AgradCdfNormal_v_50;
+typedef std::tuple<AgradCdfNormal, type_v_51> AgradCdfNormal_v_51;
+typedef std::tuple<AgradCdfNormal, type_v_52> AgradCdfNormal_v_52;
+typedef std::tuple<AgradCdfNormal, type_v_53> AgradCdfNormal_v_53;
+typedef std::tuple<AgradCdfNormal, type_v_54> AgradCdfNormal_v_54;
+typedef std::tuple<AgradCdfNormal, type_v_55> AgradCdfNormal_v_55;
+typedef std::tuple<AgradCdfNormal, type_v_56> AgradCdfNormal_v_56;
+typedef std::tuple<AgradCdfNormal, type_v_57> AgradCdfNormal_v_57;
+typedef std::tuple<AgradCdfNormal, type_v_58> AgradCdfNormal_v_58;
+typedef std::tuple<AgradCdfNormal, type_v_59> AgradCdfNormal_v_59;
+typedef std::tuple<AgradCdfNormal, type_v_60> AgradCdfNormal_v_60;
+typedef std::tuple<AgradCdfNormal, type_v_61> AgradCdfNormal_v_61;
+typedef std::tuple<AgradCdfNormal, type_v_62> AgradCdfNormal_v_62;
+typedef std::tuple<AgradCdfNormal, type_v_63> AgradCdfNormal_v_63;
+typedef std::tuple<AgradCdfNormal, type_v_64> AgradCdfNormal_v_64;
+typedef std::tuple<AgradCdfNormal, type_v_65> AgradCdfNormal_v_65;
+typedef std::tuple<AgradCdfNormal, type_v_66> AgradCdfNormal_v_66;
+typedef std::tuple<AgradCdfNormal, type_v_67> AgradCdfNormal_v_67;
+typedef std::tuple<AgradCdfNormal, type_v_68> AgradCdfNormal_v_68;
+typedef std::tuple<AgradCdfNormal, type_v_69> AgradCdfNormal_v_69;
+typedef std::tuple<AgradCdfNormal, type_v_70> AgradCdfNormal_v_70;
+typedef std::tuple<AgradCdfNormal, type_v_71> AgradCdfNormal_v_71;
+typedef std::tuple<AgradCdfNormal, type_v_72> AgradCdfNormal_v_72;
+typedef std::tuple<AgradCdfNormal, type_v_73> AgradCdfNormal_v_73;
+typedef std::tuple<AgradCdfNormal, type_v_74> AgradCdfNormal_v_74;
+typedef std::tuple<AgradCdfNormal, type_v_75> AgradCdfNormal_v_75;
+typedef std::tuple<AgradCdfNormal, type_v_76> AgradCdfNormal_v_76;
+typedef std::tuple<AgradCdfNormal, type_v_77> AgradCdfNormal_v_77;
+typedef std::tuple<AgradCdfNormal, type_v_78> AgradCdfNormal_v_78;
+typedef std::tuple<AgradCdfNormal, type_v_79> AgradCdfNormal_v_79;
+typedef std::tuple<AgradCdfNormal, type_v_80> AgradCdfNormal_v_80;
+typedef std::tuple<AgradCdfNormal, type_v_81> AgradCdfNormal_v_81;
+typedef std::tuple<AgradCdfNormal, type_v_82> AgradCdfNormal_v_82;
+typedef std::tuple<AgradCdfNormal, type_v_83> AgradCdfNormal_v_83;
+typedef std::tuple<AgradCdfNormal, type_v_84> AgradCdfNormal_v_84;
+typedef std::tuple<AgradCdfNormal, type_v_85> AgradCdfNormal_v_85;
+typedef std::tuple<AgradCdfNormal, type_v_86> AgradCdfNormal_v_86;
+typedef std::tuple<AgradCdfNormal, type_v_87> AgradCdfNormal_v_87;
+typedef std::tuple<AgradCdfNormal, type_v_88> AgradCdfNormal_v_88;
+typedef std::tuple<AgradCdfNormal, type_v_89> AgradCdfNormal_v_89;
+typedef std::tuple<AgradCdfNormal, type_v_90> AgradCdfNormal_v_90;
+typedef std::tuple<AgradCdfNormal, type_v_91> AgradCdfNormal_v_91;
+typedef std::tuple<AgradCdfNormal, type_v_92> AgradCdfNormal_v_92;
+typedef std::tuple<AgradCdfNormal, type_v_93> AgradCdfNormal_v_93;
+typedef std::tuple<AgradCdfNormal, type_v_94> AgradCdfNormal_v_94;
+typedef std::tuple<AgradCdfNormal, type_v_95> AgradCdfNormal_v_95;
+typedef std::tuple<AgradCdfNormal, type_v_96> AgradCdfNormal_v_96;
+typedef std::tuple<AgradCdfNormal, type_v_97> AgradCdfNormal_v_97;
+typedef std::tuple<AgradCdfNormal, type_v_98> AgradCdfNormal_v_98;
+typedef std::tuple<AgradCdfNormal, type_v_99> AgradCdfNormal_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_0, AgradCdfTestFixture, AgradCdfNormal_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_1, AgradCdfTestFixture, AgradCdfNormal_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_2, AgradCdfTestFixture, AgradCdfNormal_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_3, AgradCdfTestFixture, AgradCdfNormal_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_4, AgradCdfTestFixture, AgradCdfNormal_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_5, AgradCdfTestFixture, AgradCdfNormal_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_6, AgradCdfTestFixture, AgradCdfNormal_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_7, AgradCdfTestFixture, AgradCdfNormal_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_8, AgradCdfTestFixture, AgradCdfNormal_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_9, AgradCdfTestFixture, AgradCdfNormal_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_10, AgradCdfTestFixture, AgradCdfNormal_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_11, AgradCdfTestFixture, AgradCdfNormal_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_12, AgradCdfTestFixture, AgradCdfNormal_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_13, AgradCdfTestFixture, AgradCdfNormal_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_14, AgradCdfTestFixture, AgradCdfNormal_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_15, AgradCdfTestFixture, AgradCdfNormal_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_16, AgradCdfTestFixture, AgradCdfNormal_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_17, AgradCdfTestFixture, AgradCdfNormal_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_18, AgradCdfTestFixture, AgradCdfNormal_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_19, AgradCdfTestFixture, AgradCdfNormal_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_20, AgradCdfTestFixture, AgradCdfNormal_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_21, AgradCdfTestFixture, AgradCdfNormal_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_22, AgradCdfTestFixture, AgradCdfNormal_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_23, AgradCdfTestFixture, AgradCdfNormal_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_24, AgradCdfTestFixture, AgradCdfNormal_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_25, AgradCdfTestFixture, AgradCdfNormal_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_26, AgradCdfTestFixture, AgradCdfNormal_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_27, AgradCdfTestFixture, AgradCdfNormal_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_28, AgradCdfTestFixture, AgradCdfNormal_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_29, AgradCdfTestFixture, AgradCdfNormal_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_30, AgradCdfTestFixture, AgradCdfNormal_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_31, AgradCdfTestFixture, AgradCdfNormal_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_32, AgradCdfTestFixture, AgradCdfNormal_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_33, AgradCdfTestFixture, AgradCdfNormal_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_34, AgradCdfTestFixture, AgradCdfNormal_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_35, AgradCdfTestFixture, AgradCdfNormal_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_36, AgradCdfTestFixture, AgradCdfNormal_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_37, AgradCdfTestFixture, AgradCdfNormal_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_38, AgradCdfTestFixture, AgradCdfNormal_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_39, AgradCdfTestFixture, AgradCdfNormal_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_40, AgradCdfTestFixture, AgradCdfNormal_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_41, AgradCdfTestFixture, AgradCdfNormal_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_42, AgradCdfTestFixture, AgradCdfNormal_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_43, AgradCdfTestFixture, AgradCdfNormal_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_44, AgradCdfTestFixture, AgradCdfNormal_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_45, AgradCdfTestFixture, AgradCdfNormal_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_46, AgradCdfTestFixture, AgradCdfNormal_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_47, AgradCdfTestFixture, AgradCdfNormal_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_48, AgradCdfTestFixture, AgradCdfNormal_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_49, AgradCdfTestFixture, AgradCdfNormal_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_50, AgradCdfTestFixture, AgradCdfNormal_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_51, AgradCdfTestFixture, AgradCdfNormal_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_52, AgradCdfTestFixture, AgradCdfNormal_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_53, AgradCdfTestFixture, AgradCdfNormal_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_54, AgradCdfTestFixture, AgradCdfNormal_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_55, AgradCdfTestFixture, AgradCdfNormal_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_56, AgradCdfTestFixture, AgradCdfNormal_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_57, AgradCdfTestFixture, AgradCdfNormal_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_58, AgradCdfTestFixture, AgradCdfNormal_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_59, AgradCdfTestFixture, AgradCdfNormal_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_60, AgradCdfTestFixture, AgradCdfNormal_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_61, AgradCdfTestFixture, AgradCdfNormal_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_62, AgradCdfTestFixture, AgradCdfNormal_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_63, AgradCdfTestFixture, AgradCdfNormal_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_64, AgradCdfTestFixture, AgradCdfNormal_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_65, AgradCdfTestFixture, AgradCdfNormal_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_66, AgradCdfTestFixture, AgradCdfNormal_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_67, AgradCdfTestFixture, AgradCdfNormal_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_68, AgradCdfTestFixture, AgradCdfNormal_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_69, AgradCdfTestFixture, AgradCdfNormal_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_70, AgradCdfTestFixture, AgradCdfNormal_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_71, AgradCdfTestFixture, AgradCdfNormal_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_72, AgradCdfTestFixture, AgradCdfNormal_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_73, AgradCdfTestFixture, AgradCdfNormal_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_74, AgradCdfTestFixture, AgradCdfNormal_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_75, AgradCdfTestFixture, AgradCdfNormal_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_76, AgradCdfTestFixture, AgradCdfNormal_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_77, AgradCdfTestFixture, AgradCdfNormal_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_78, AgradCdfTestFixture, AgradCdfNormal_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_79, AgradCdfTestFixture, AgradCdfNormal_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_80, AgradCdfTestFixture, AgradCdfNormal_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_81, AgradCdfTestFixture, AgradCdfNormal_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_82, AgradCdfTestFixture, AgradCdfNormal_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_83, AgradCdfTestFixture, AgradCdfNormal_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_84, AgradCdfTestFixture, AgradCdfNormal_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_85, AgradCdfTestFixture, AgradCdfNormal_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_86, AgradCdfTestFixture, AgradCdfNormal_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_87, AgradCdfTestFixture, AgradCdfNormal_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_88, AgradCdfTestFixture, AgradCdfNormal_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_89, AgradCdfTestFixture, AgradCdfNormal_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_90, AgradCdfTestFixture, AgradCdfNormal_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_91, AgradCdfTestFixture, AgradCdfNormal_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_92, AgradCdfTestFixture, AgradCdfNormal_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_93, AgradCdfTestFixture, AgradCdfNormal_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_94, AgradCdfTestFixture, AgradCdfNormal_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_95, AgradCdfTestFixture, AgradCdfNormal_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_96, AgradCdfTestFixture, AgradCdfNormal_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_97, AgradCdfTestFixture, AgradCdfNormal_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_98, AgradCdfTestFixture, AgradCdfNormal_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_99, AgradCdfTestFixture, AgradCdfNormal_v_99);
+
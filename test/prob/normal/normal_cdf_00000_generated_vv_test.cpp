@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfNormal, type_vv_0> AgradCdfNormal_vv_0;
+typedef std::tuple<AgradCdfNormal, type_vv_1> AgradCdfNormal_vv_1;
+typedef std::tuple<AgradCdfNormal, type_vv_2> AgradCdfNormal_vv_2;
+typedef std::tuple<AgradCdfNormal, type_vv_3> AgradCdfNormal_vv_3;
+typedef std::tuple<AgradCdfNormal, type_vv_4> AgradCdfNormal_vv_4;
+typedef std::tuple<AgradCdfNormal, type_vv_5> AgradCdfNormal_vv_5;
+typedef std::tuple<AgradCdfNormal, type_vv_6> AgradCdfNormal_vv_6;
+typedef std::tuple<AgradCdfNormal, type_vv_7> AgradCdfNormal_vv_7;
+typedef std::tuple<AgradCdfNormal, type_vv_8> AgradCdfNormal_vv_8;
+typedef std::tuple<AgradCdfNormal, type_vv_9> AgradCdfNormal_vv_9;
+typedef std::tuple<AgradCdfNormal, type_vv_10> AgradCdfNormal_vv_10;
+typedef std::tuple<AgradCdfNormal, type_vv_11> AgradCdfNormal_vv_11;
+typedef std::tuple<AgradCdfNormal, type_vv_12> AgradCdfNormal_vv_12;
+typedef std::tuple<AgradCdfNormal, type_vv_13> AgradCdfNormal_vv_13;
+typedef std::tuple<AgradCdfNormal, type_vv_14> AgradCdfNormal_vv_14;
+typedef std::tuple<AgradCdfNormal, type_vv_15> AgradCdfNormal_vv_15;
+typedef std::tuple<AgradCdfNormal, type_vv_16> AgradCdfNormal_vv_16;
+typedef std::tuple<AgradCdfNormal, type_vv_17> AgradCdfNormal_vv_17;
+typedef std::tuple<AgradCdfNormal, type_vv_18> AgradCdfNormal_vv_18;
+typedef std::tuple<AgradCdfNormal, type_vv_19> AgradCdfNormal_vv_19;
+typedef std::tuple<AgradCdfNormal, type_vv_20> AgradCdfNormal_vv_20;
+typedef std::tuple<AgradCdfNormal, type_vv_21> AgradCdfNormal_vv_21;
+typedef std::tuple<AgradCdfNormal, type_vv_22> AgradCdfNormal_vv_22;
+typedef std::tuple<AgradCdfNormal, type_vv_23> AgradCdfNormal_vv_23;
+typedef std::tuple<AgradCdfNormal, type_vv_24> AgradCdfNormal_vv_24;
+typedef std::tuple<AgradCdfNormal, type_vv_25> AgradCdfNormal_vv_25;
+typedef std::tuple<AgradCdfNormal, type_vv_26> AgradCdfNormal_vv_26;
+typedef std::tuple<AgradCdfNormal, type_vv_27> AgradCdfNormal_vv_27;
+typedef std::tuple<AgradCdfNormal, type_vv_28> AgradCdfNormal_vv_28;
+typedef std::tuple<AgradCdfNormal, type_vv_29> AgradCdfNormal_vv_29;
+typedef std::tuple<AgradCdfNormal, type_vv_30> AgradCdfNormal_vv_30;
+typedef std::tuple<AgradCdfNormal, type_vv_31> AgradCdfNormal_vv_31;
+typedef std::tuple<AgradCdfNormal, type_vv_32> AgradCdfNormal_vv_32;
+typedef std::tuple<AgradCdfNormal, type_vv_33> AgradCdfNormal_vv_33;
+typedef std::tuple<AgradCdfNormal, type_vv_34> AgradCdfNormal_vv_34;
+typedef std::tuple<AgradCdfNormal, type_vv_35> AgradCdfNormal_vv_35;
+typedef std::tuple<AgradCdfNormal, type_vv_36> AgradCdfNormal_vv_36;
+typedef std::tuple<AgradCdfNormal, type_vv_37> AgradCdfNormal_vv_37;
+typedef std::tuple<AgradCdfNormal, type_vv_38> AgradCdfNormal_vv_38;
+typedef std::tuple<AgradCdfNormal, type_vv_39> AgradCdfNormal_vv_39;
+typedef std::tuple<AgradCdfNormal, type_vv_40> AgradCdfNormal_vv_40;
+typedef std::tuple<AgradCdfNormal, type_vv_41> AgradCdfNormal_vv_41;
+typedef std::tuple<AgradCdfNormal, type_vv_42> AgradCdfNormal_vv_42;
+typedef std::tuple<AgradCdfNormal, type_vv_43> AgradCdfNormal_vv_43;
+typedef std::tuple<AgradCdfNormal, type_vv_44> AgradCdfNormal_vv_44;
+typedef std::tuple<AgradCdfNormal, type_vv_45> AgradCdfNormal_vv_45;
+typedef std::tuple<AgradCdfNormal, type_vv_46> AgradCdfNormal_vv_46;
+typedef std::tuple<AgradCdfNormal, type_vv_47> AgradCdfNormal_vv_47;
+typedef std::tuple<AgradCdfNormal, type_vv_48> AgradCdfNormal_vv_48;
+typedef std::tuple<AgradCdfNormal, type_vv_49> AgradCdfNormal_vv_49;
+typedef std::tuple<AgradCdfNormal, type_vv_50> AgradCdfNormal_vv_50;
+typedef std::tuple<AgradCdfNormal, type_vv_51> AgradCdfNormal_vv_51;
+typedef std::tuple<AgradCdfNormal, type_vv_52> AgradCdfNormal_vv_52;
+typedef std::tuple<AgradCdfNormal, type_vv_53> AgradCdfNormal_vv_53;
+typedef std::tuple<AgradCdfNormal, type_vv_54> AgradCdfNormal_vv_54;
+typedef std::tuple<AgradCdfNormal, type_vv_55> AgradCdfNormal_vv_55;
+typedef std::tuple<AgradCdfNormal, type_vv_56> AgradCdfNormal_vv_56;
+typedef std::tuple<AgradCdfNormal, type_vv_57> AgradCdfNormal_vv_57;
+typedef std::tuple<AgradCdfNormal, type_vv_58> AgradCdfNormal_vv_58;
+typedef std::tuple<AgradCdfNormal, type_vv_59> AgradCdfNormal_vv_59;
+typedef std::tuple<AgradCdfNormal, type_vv_60> AgradCdfNormal_vv_60;
+typedef std::tuple<AgradCdfNormal, type_vv_61> AgradCdfNormal_vv_61;
+typedef std::tuple<AgradCdfNormal, type_vv_62> AgradCdfNormal_vv_62;
+typedef std::tuple<AgradCdfNormal, type_vv_63> AgradCdfNormal_vv_63;
+typedef std::tuple<AgradCdfNormal, type_vv_64> AgradCdfNormal_vv_64;
+typedef std::tuple<AgradCdfNormal, type_vv_65> AgradCdfNormal_vv_65;
+typedef std::tuple<AgradCdfNormal, type_vv_66> AgradCdfNormal_vv_66;
+typedef std::tuple<AgradCdfNormal, type_vv_67> AgradCdfNormal_vv_67;
+typedef std::tuple<AgradCdfNormal, type_vv_68> AgradCdfNormal_vv_68;
+typedef std::tuple<AgradCdfNormal, type_vv_69> AgradCdfNormal_vv_69;
+typedef std::tuple<AgradCdfNormal, type_vv_70> AgradCdfNormal_vv_70;
+typedef std::tuple<AgradCdfNormal, type_vv_71> AgradCdfNormal_vv_71;
+typedef std::tuple<AgradCdfNormal, type_vv_72> AgradCdfNormal_vv_72;
+typedef std::tuple<AgradCdfNormal, type_vv_73> AgradCdfNormal_vv_73;
+typedef std::tuple<AgradCdfNormal, type_vv_74> AgradCdfNormal_vv_74;
+typedef std::tuple<AgradCdfNormal, type_vv_75> AgradCdfNormal_vv_75;
+typedef std::tuple<AgradCdfNormal, type_vv_76> AgradCdfNormal_vv_76;
+typedef std::tuple<AgradCdfNormal, type_vv_77> AgradCdfNormal_vv_77;
+typedef std::tuple<AgradCdfNormal, type_vv_78> AgradCdfNormal_vv_78;
+typedef std::tuple<AgradCdfNormal, type_vv_79> AgradCdfNormal_vv_79;
+typedef std::tuple<AgradCdfNormal, type_vv_80> AgradCdfNormal_vv_80;
+typedef std::tuple<AgradCdfNormal, type_vv_81> AgradCdfNormal_vv_81;
+typedef std::tuple<AgradCdfNormal, type_vv_82> AgradCdfNormal_vv_82;
+typedef std::tuple<AgradCdfNormal, type_vv_83> AgradCdfNormal_vv_83;
+typedef std::tuple<AgradCdfNormal, type_vv_84> AgradCdfNormal_vv_84;
+typedef std::tuple<AgradCdfNormal, type_vv_85> AgradCdfNormal_vv_85;
+typedef std::tuple<AgradCdfNormal, type_vv_86> AgradCdfNormal_vv_86;
+typedef std::tuple<AgradCdfNormal, type_vv_87> AgradCdfNormal_vv_87;
+typedef std::tuple<AgradCdfNormal, type_vv_88> AgradCdfNormal_vv_88;
+typedef std::tuple<AgradCdfNormal, type_vv_89> AgradCdfNormal_vv_89;
+typedef std::tuple<AgradCdfNormal, type_vv_90> AgradCdfNormal_vv_90;
+typedef std::tuple<AgradCdfNormal, type_vv_91> AgradCdfNormal_vv_91;
+typedef std::tuple<AgradCdfNormal, type_vv_92> AgradCdfNormal_vv_92;
+typedef std::tuple<AgradCdfNormal, type_vv_93> AgradCdfNormal_vv_93;
+typedef std::tuple<AgradCdfNormal, type_vv_94> AgradCdfNormal_vv_94;
+typedef std::tuple<AgradCdfNormal, type_vv_95> AgradCdfNormal_vv_95;
+typedef std::tuple<AgradCdfNormal, type_vv_96> AgradCdfNormal_vv_96;
+typedef std::tuple<AgradCdfNormal, type_vv_97> AgradCdfNormal_vv_97;
+typedef std::tuple<AgradCdfNormal, type_vv_98> AgradCdfNormal_vv_98;
+typedef std::tuple<AgradCdfNormal, type_vv_99> AgradCdfNormal_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_0, AgradCdfTestFixture, AgradCdfNormal_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_1, AgradCdfTestFixture, AgradCdfNormal_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_2, AgradCdfTestFixture, AgradCdfNormal_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_3, AgradCdfTestFixture, AgradCdfNormal_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_4, AgradCdfTestFixture, AgradCdfNormal_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_5, AgradCdfTestFixture, AgradCdfNormal_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_6, AgradCdfTestFixture, AgradCdfNormal_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_7, AgradCdfTestFixture, AgradCdfNormal_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_8, AgradCdfTestFixture, AgradCdfNormal_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_9, AgradCdfTestFixture, AgradCdfNormal_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_10, AgradCdfTestFixture, AgradCdfNormal_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_11, AgradCdfTestFixture, AgradCdfNormal_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_12, AgradCdfTestFixture, AgradCdfNormal_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_13, AgradCdfTestFixture, AgradCdfNormal_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_14, AgradCdfTestFixture, AgradCdfNormal_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_15, AgradCdfTestFixture, AgradCdfNormal_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_16, AgradCdfTestFixture, AgradCdfNormal_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_17, AgradCdfTestFixture, AgradCdfNormal_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_18, AgradCdfTestFixture, AgradCdfNormal_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_19, AgradCdfTestFixture, AgradCdfNormal_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_20, AgradCdfTestFixture, AgradCdfNormal_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_21, AgradCdfTestFixture, AgradCdfNormal_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_22, AgradCdfTestFixture, AgradCdfNormal_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_23, AgradCdfTestFixture, AgradCdfNormal_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_24, AgradCdfTestFixture, AgradCdfNormal_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_25, AgradCdfTestFixture, AgradCdfNormal_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_26, AgradCdfTestFixture, AgradCdfNormal_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_27, AgradCdfTestFixture, AgradCdfNormal_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_28, AgradCdfTestFixture, AgradCdfNormal_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_29, AgradCdfTestFixture, AgradCdfNormal_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_30, AgradCdfTestFixture, AgradCdfNormal_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_31, AgradCdfTestFixture, AgradCdfNormal_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_32, AgradCdfTestFixture, AgradCdfNormal_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_33, AgradCdfTestFixture, AgradCdfNormal_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_34, AgradCdfTestFixture, AgradCdfNormal_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_35, AgradCdfTestFixture, AgradCdfNormal_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_36, AgradCdfTestFixture, AgradCdfNormal_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_37, AgradCdfTestFixture, AgradCdfNormal_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_38, AgradCdfTestFixture, AgradCdfNormal_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_39, AgradCdfTestFixture, AgradCdfNormal_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_40, AgradCdfTestFixture, AgradCdfNormal_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_41, AgradCdfTestFixture, AgradCdfNormal_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_42, AgradCdfTestFixture, AgradCdfNormal_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_43, AgradCdfTestFixture, AgradCdfNormal_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_44, AgradCdfTestFixture, AgradCdfNormal_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_45, AgradCdfTestFixture, AgradCdfNormal_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_46, AgradCdfTestFixture, AgradCdfNormal_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_47, AgradCdfTestFixture, AgradCdfNormal_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_48, AgradCdfTestFixture, AgradCdfNormal_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_49, AgradCdfTestFixture, AgradCdfNormal_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_50, AgradCdfTestFixture, AgradCdfNormal_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_51, AgradCdfTestFixture, AgradCdfNormal_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_52, AgradCdfTestFixture, AgradCdfNormal_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_53, AgradCdfTestFixture, AgradCdfNormal_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_54, AgradCdfTestFixture, AgradCdfNormal_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_55, AgradCdfTestFixture, AgradCdfNormal_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_56, AgradCdfTestFixture, AgradCdfNormal_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_57, AgradCdfTestFixture, AgradCdfNormal_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_58, AgradCdfTestFixture, AgradCdfNormal_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_59, AgradCdfTestFixture, AgradCdfNormal_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_60, AgradCdfTestFixture, AgradCdfNormal_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_61, AgradCdfTestFixture, AgradCdfNormal_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_62, AgradCdfTestFixture, AgradCdfNormal_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_63, AgradCdfTestFixture, AgradCdfNormal_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_64, AgradCdfTestFixture, AgradCdfNormal_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_65, AgradCdfTestFixture, AgradCdfNormal_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_66, AgradCdfTestFixture, AgradCdfNormal_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_67, AgradCdfTestFixture, AgradCdfNormal_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_68, AgradCdfTestFixture, AgradCdfNormal_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_69, AgradCdfTestFixture, AgradCdfNormal_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_70, AgradCdfTestFixture, AgradCdfNormal_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_71, AgradCdfTestFixture, AgradCdfNormal_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_72, AgradCdfTestFixture, AgradCdfNormal_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_73, AgradCdfTestFixture, AgradCdfNormal_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_74, AgradCdfTestFixture, AgradCdfNormal_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_75, AgradCdfTestFixture, AgradCdfNormal_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_76, AgradCdfTestFixture, AgradCdfNormal_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_77, AgradCdfTestFixture, AgradCdfNormal_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_78, AgradCdfTestFixture, AgradCdfNormal_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_79, AgradCdfTestFixture, AgradCdfNormal_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_80, AgradCdfTestFixture, AgradCdfNormal_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_81, AgradCdfTestFixture, AgradCdfNormal_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_82, AgradCdfTestFixture, AgradCdfNormal_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_83, AgradCdfTestFixture, AgradCdfNormal_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_84, AgradCdfTestFixture, AgradCdfNormal_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_85, AgradCdfTestFixture, AgradCdfNormal_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_86, AgradCdfTestFixture, AgradCdfNormal_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_87, AgradCdfTestFixture, AgradCdfNormal_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_88, AgradCdfTestFixture, AgradCdfNormal_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_89, AgradCdfTestFixture, AgradCdfNormal_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_90, AgradCdfTestFixture, AgradCdfNormal_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_91, AgradCdfTestFixture, AgradCdfNormal_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_92, AgradCdfTestFixture, AgradCdfNormal_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_93, AgradCdfTestFixture, AgradCdfNormal_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_94, AgradCdfTestFixture, AgradCdfNormal_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_95, AgradCdfTestFixture, AgradCdfNormal_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_96, AgradCdfTestFixture, AgradCdfNormal_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_97, AgradCdfTestFixture, AgradCdfNormal_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_98, AgradCdfTestFixture, AgradCdfNormal_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_99, AgradCdfTestFixture, AgradCdfNormal_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfNormal, type_ffv_100> AgradCdfNormal_ffv_100;
+typedef std::tuple<AgradCdfNormal, type_ffv_101> AgradCdfNormal_ffv_101;
+typedef std::tuple<AgradCdfNormal, type_ffv_102> AgradCdfNormal_ffv_102;
+typedef std::tuple<AgradCdfNormal, type_ffv_103> AgradCdfNormal_ffv_103;
+typedef std::tuple<AgradCdfNormal, type_ffv_104> AgradCdfNormal_ffv_104;
+typedef std::tuple<AgradCdfNormal, type_ffv_105> AgradCdfNormal_ffv_105;
+typedef std::tuple<AgradCdfNormal, type_ffv_106> AgradCdfNormal_ffv_106;
+typedef std::tuple<AgradCdfNormal, type_ffv_107> AgradCdfNormal_ffv_107;
+typedef std::tuple<AgradCdfNormal, type_ffv_108> AgradCdfNormal_ffv_108;
+typedef std::tuple<AgradCdfNormal, type_ffv_109> AgradCdfNormal_ffv_109;
+typedef std::tuple<AgradCdfNormal, type_ffv_110> AgradCdfNormal_ffv_110;
+typedef std::tuple<AgradCdfNormal, type_ffv_111> AgradCdfNormal_ffv_111;
+typedef std::tuple<AgradCdfNormal, type_ffv_112> AgradCdfNormal_ffv_112;
+typedef std::tuple<AgradCdfNormal, type_ffv_113> AgradCdfNormal_ffv_113;
+typedef std::tuple<AgradCdfNormal, type_ffv_114> AgradCdfNormal_ffv_114;
+typedef std::tuple<AgradCdfNormal, type_ffv_115> AgradCdfNormal_ffv_115;
+typedef std::tuple<AgradCdfNormal, type_ffv_116> AgradCdfNormal_ffv_116;
+typedef std::tuple<AgradCdfNormal, type_ffv_117> AgradCdfNormal_ffv_117;
+typedef std::tuple<AgradCdfNormal, type_ffv_118> AgradCdfNormal_ffv_118;
+typedef std::tuple<AgradCdfNormal, type_ffv_119> AgradCdfNormal_ffv_119;
+typedef std::tuple<AgradCdfNormal, type_ffv_120> AgradCdfNormal_ffv_120;
+typedef std::tuple<AgradCdfNormal, type_ffv_121> AgradCdfNormal_ffv_121;
+typedef std::tuple<AgradCdfNormal, type_ffv_122> AgradCdfNormal_ffv_122;
+typedef std::tuple<AgradCdfNormal, type_ffv_123> AgradCdfNormal_ffv_123;
+typedef std::tuple<AgradCdfNormal, type_ffv_124> AgradCdfNormal_ffv_124;
+typedef std::tuple<AgradCdfNormal, type_ffv_125> AgradCdfNormal_ffv_125;
+typedef std::tuple<AgradCdfNormal, type_ffv_126> AgradCdfNormal_ffv_126;
+typedef std::tuple<AgradCdfNormal, type_ffv_127> AgradCdfNormal_ffv_127;
+typedef std::tuple<AgradCdfNormal, type_ffv_128> AgradCdfNormal_ffv_128;
+typedef std::tuple<AgradCdfNormal, type_ffv_129> AgradCdfNormal_ffv_129;
+typedef std::tuple<AgradCdfNormal, type_ffv_130> AgradCdfNormal_ffv_130;
+typedef std::tuple<AgradCdfNormal, type_ffv_131> AgradCdfNormal_ffv_131;
+typedef std::tuple<AgradCdfNormal, type_ffv_132> AgradCdfNormal_ffv_132;
+typedef std::tuple<AgradCdfNormal, type_ffv_133> AgradCdfNormal_ffv_133;
+typedef std::tuple<AgradCdfNormal, type_ffv_134> AgradCdfNormal_ffv_134;
+typedef std::tuple<AgradCdfNormal, type_ffv_135> AgradCdfNormal_ffv_135;
+typedef std::tuple<AgradCdfNormal, type_ffv_136> AgradCdfNormal_ffv_136;
+typedef std::tuple<AgradCdfNormal, type_ffv_137> AgradCdfNormal_ffv_137;
+typedef std::tuple<AgradCdfNormal, type_ffv_138> AgradCdfNormal_ffv_138;
+typedef std::tuple<AgradCdfNormal, type_ffv_139> AgradCdfNormal_ffv_139;
+typedef std::tuple<AgradCdfNormal, type_ffv_140> AgradCdfNormal_ffv_140;
+typedef std::tuple<AgradCdfNormal, type_ffv_141> AgradCdfNormal_ffv_141;
+typedef std::tuple<AgradCdfNormal, type_ffv_142> AgradCdfNormal_ffv_142;
+typedef std::tuple<AgradCdfNormal, type_ffv_143> AgradCdfNormal_ffv_143;
+typedef std::tuple<AgradCdfNormal, type_ffv_144> AgradCdfNormal_ffv_144;
+typedef std::tuple<AgradCdfNormal, type_ffv_145> AgradCdfNormal_ffv_145;
+typedef std::tuple<AgradCdfNormal, type_ffv_146> AgradCdfNormal_ffv_146;
+typedef std::tuple<AgradCdfNormal, type_ffv_147> AgradCdfNormal_ffv_147;
+typedef std::tuple<AgradCdfNormal, type_ffv_148> AgradCdfNormal_ffv_148;
+typedef std::tuple<AgradCdfNormal, type_ffv_149> AgradCdfNormal_ffv_149;
+typedef std::tuple<AgradCdfNormal, type_ffv_150> AgradCdfNormal_ffv_150;
+typedef std::tuple<AgradCdfNormal, type_ffv_151> AgradCdfNormal_ffv_151;
+typedef std::tuple<AgradCdfNormal, type_ffv_152> AgradCdfNormal_ffv_152;
+typedef std::tuple<AgradCdfNormal, type_ffv_153> AgradCdfNormal_ffv_153;
+typedef std::tuple<AgradCdfNormal, type_ffv_154> AgradCdfNormal_ffv_154;
+typedef std::tuple<AgradCdfNormal, type_ffv_155> AgradCdfNormal_ffv_155;
+typedef std::tuple<AgradCdfNormal, type_ffv_156> AgradCdfNormal_ffv_156;
+typedef std::tuple<AgradCdfNormal, type_ffv_157> AgradCdfNormal_ffv_157;
+typedef std::tuple<AgradCdfNormal, type_ffv_158> AgradCdfNormal_ffv_158;
+typedef std::tuple<AgradCdfNormal, type_ffv_159> AgradCdfNormal_ffv_159;
+typedef std::tuple<AgradCdfNormal, type_ffv_160> AgradCdfNormal_ffv_160;
+typedef std::tuple<AgradCdfNormal, type_ffv_161> AgradCdfNormal_ffv_161;
+typedef std::tuple<AgradCdfNormal, type_ffv_162> AgradCdfNormal_ffv_162;
+typedef std::tuple<AgradCdfNormal, type_ffv_163> AgradCdfNormal_ffv_163;
+typedef std::tuple<AgradCdfNormal, type_ffv_164> AgradCdfNormal_ffv_164;
+typedef std::tuple<AgradCdfNormal, type_ffv_165> AgradCdfNormal_ffv_165;
+typedef std::tuple<AgradCdfNormal, type_ffv_166> AgradCdfNormal_ffv_166;
+typedef std::tuple<AgradCdfNormal, type_ffv_167> AgradCdfNormal_ffv_167;
+typedef std::tuple<AgradCdfNormal, type_ffv_168> AgradCdfNormal_ffv_168;
+typedef std::tuple<AgradCdfNormal, type_ffv_169> AgradCdfNormal_ffv_169;
+typedef std::tuple<AgradCdfNormal, type_ffv_170> AgradCdfNormal_ffv_170;
+typedef std::tuple<AgradCdfNormal, type_ffv_171> AgradCdfNormal_ffv_171;
+typedef std::tuple<AgradCdfNormal, type_ffv_172> AgradCdfNormal_ffv_172;
+typedef std::tuple<AgradCdfNormal, type_ffv_173> AgradCdfNormal_ffv_173;
+typedef std::tuple<AgradCdfNormal, type_ffv_174> AgradCdfNormal_ffv_174;
+typedef std::tuple<AgradCdfNormal, type_ffv_175> AgradCdfNormal_ffv_175;
+typedef std::tuple<AgradCdfNormal, type_ffv_176> AgradCdfNormal_ffv_176;
+typedef std::tuple<AgradCdfNormal, type_ffv_177> AgradCdfNormal_ffv_177;
+typedef std::tuple<AgradCdfNormal, type_ffv_178> AgradCdfNormal_ffv_178;
+typedef std::tuple<AgradCdfNormal, type_ffv_179> AgradCdfNormal_ffv_179;
+typedef std::tuple<AgradCdfNormal, type_ffv_180> AgradCdfNormal_ffv_180;
+typedef std::tuple<AgradCdfNormal, type_ffv_181> AgradCdfNormal_ffv_181;
+typedef std::tuple<AgradCdfNormal, type_ffv_182> AgradCdfNormal_ffv_182;
+typedef std::tuple<AgradCdfNormal, type_ffv_183> AgradCdfNormal_ffv_183;
+typedef std::tuple<AgradCdfNormal, type_ffv_184> AgradCdfNormal_ffv_184;
+typedef std::tuple<AgradCdfNormal, type_ffv_185> AgradCdfNormal_ffv_185;
+typedef std::tuple<AgradCdfNormal, type_ffv_186> AgradCdfNormal_ffv_186;
+typedef std::tuple<AgradCdfNormal, type_ffv_187> AgradCdfNormal_ffv_187;
+typedef std::tuple<AgradCdfNormal, type_ffv_188> AgradCdfNormal_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_100, AgradCdfTestFixture, AgradCdfNormal_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_101, AgradCdfTestFixture, AgradCdfNormal_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_102, AgradCdfTestFixture, AgradCdfNormal_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_103, AgradCdfTestFixture, AgradCdfNormal_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_104, AgradCdfTestFixture, AgradCdfNormal_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_105, AgradCdfTestFixture, AgradCdfNormal_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_106, AgradCdfTestFixture, AgradCdfNormal_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_107, AgradCdfTestFixture, AgradCdfNormal_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_108, AgradCdfTestFixture, AgradCdfNormal_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_109, AgradCdfTestFixture, AgradCdfNormal_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_110, AgradCdfTestFixture, AgradCdfNormal_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_111, AgradCdfTestFixture, AgradCdfNormal_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_112, AgradCdfTestFixture, AgradCdfNormal_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_113, AgradCdfTestFixture, AgradCdfNormal_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_114, AgradCdfTestFixture, AgradCdfNormal_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_115, AgradCdfTestFixture, AgradCdfNormal_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_116, AgradCdfTestFixture, AgradCdfNormal_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_117, AgradCdfTestFixture, AgradCdfNormal_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_118, AgradCdfTestFixture, AgradCdfNormal_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_119, AgradCdfTestFixture, AgradCdfNormal_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_120, AgradCdfTestFixture, AgradCdfNormal_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_121, AgradCdfTestFixture, AgradCdfNormal_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_122, AgradCdfTestFixture, AgradCdfNormal_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_123, AgradCdfTestFixture, AgradCdfNormal_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_124, AgradCdfTestFixture, AgradCdfNormal_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_125, AgradCdfTestFixture, AgradCdfNormal_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_126, AgradCdfTestFixture, AgradCdfNormal_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_127, AgradCdfTestFixture, AgradCdfNormal_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_128, AgradCdfTestFixture, AgradCdfNormal_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_129, AgradCdfTestFixture, AgradCdfNormal_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_130, AgradCdfTestFixture, AgradCdfNormal_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_131, AgradCdfTestFixture, AgradCdfNormal_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_132, AgradCdfTestFixture, AgradCdfNormal_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_133, AgradCdfTestFixture, AgradCdfNormal_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_134, AgradCdfTestFixture, AgradCdfNormal_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_135, AgradCdfTestFixture, AgradCdfNormal_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_136, AgradCdfTestFixture, AgradCdfNormal_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_137, AgradCdfTestFixture, AgradCdfNormal_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_138, AgradCdfTestFixture, AgradCdfNormal_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_139, AgradCdfTestFixture, AgradCdfNormal_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_140, AgradCdfTestFixture, AgradCdfNormal_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_141, AgradCdfTestFixture, AgradCdfNormal_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_142, AgradCdfTestFixture, AgradCdfNormal_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_143, AgradCdfTestFixture, AgradCdfNormal_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_144, AgradCdfTestFixture, AgradCdfNormal_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_145, AgradCdfTestFixture, AgradCdfNormal_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_146, AgradCdfTestFixture, AgradCdfNormal_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_147, AgradCdfTestFixture, AgradCdfNormal_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_148, AgradCdfTestFixture, AgradCdfNormal_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_149, AgradCdfTestFixture, AgradCdfNormal_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_150, AgradCdfTestFixture, AgradCdfNormal_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_151, AgradCdfTestFixture, AgradCdfNormal_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_152, AgradCdfTestFixture, AgradCdfNormal_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_153, AgradCdfTestFixture, AgradCdfNormal_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_154, AgradCdfTestFixture, AgradCdfNormal_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_155, AgradCdfTestFixture, AgradCdfNormal_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_156, AgradCdfTestFixture, AgradCdfNormal_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_157, AgradCdfTestFixture, AgradCdfNormal_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_158, AgradCdfTestFixture, AgradCdfNormal_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_159, AgradCdfTestFixture, AgradCdfNormal_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_160, AgradCdfTestFixture, AgradCdfNormal_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_161, AgradCdfTestFixture, AgradCdfNormal_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_162, AgradCdfTestFixture, AgradCdfNormal_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_163, AgradCdfTestFixture, AgradCdfNormal_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_164, AgradCdfTestFixture, AgradCdfNormal_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_165, AgradCdfTestFixture, AgradCdfNormal_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_166, AgradCdfTestFixture, AgradCdfNormal_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_167, AgradCdfTestFixture, AgradCdfNormal_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_168, AgradCdfTestFixture, AgradCdfNormal_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_169, AgradCdfTestFixture, AgradCdfNormal_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_170, AgradCdfTestFixture, AgradCdfNormal_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_171, AgradCdfTestFixture, AgradCdfNormal_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_172, AgradCdfTestFixture, AgradCdfNormal_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_173, AgradCdfTestFixture, AgradCdfNormal_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_174, AgradCdfTestFixture, AgradCdfNormal_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_175, AgradCdfTestFixture, AgradCdfNormal_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_176, AgradCdfTestFixture, AgradCdfNormal_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_177, AgradCdfTestFixture, AgradCdfNormal_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_178, AgradCdfTestFixture, AgradCdfNormal_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_179, AgradCdfTestFixture, AgradCdfNormal_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_180, AgradCdfTestFixture, AgradCdfNormal_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_181, AgradCdfTestFixture, AgradCdfNormal_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_182, AgradCdfTestFixture, AgradCdfNormal_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_183, AgradCdfTestFixture, AgradCdfNormal_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_184, AgradCdfTestFixture, AgradCdfNormal_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_185, AgradCdfTestFixture, AgradCdfNormal_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_186, AgradCdfTestFixture, AgradCdfNormal_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_187, AgradCdfTestFixture, AgradCdfNormal_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_ffv_188, AgradCdfTestFixture, AgradCdfNormal_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfNormal, type_v_100> AgradCdfNormal_v_100;
+typedef std::tuple<AgradCdfNormal, type_v_101> AgradCdfNormal_v_101;
+typedef std::tuple<AgradCdfNormal, type_v_102> AgradCdfNormal_v_102;
+typedef std::tuple<AgradCdfNormal, type_v_103> AgradCdfNormal_v_103;
+typedef std::tuple<AgradCdfNormal, type_v_104> AgradCdfNormal_v_104;
+typedef std::tuple<AgradCdfNormal, type_v_105> AgradCdfNormal_v_105;
+typedef std::tuple<AgradCdfNormal, type_v_106> AgradCdfNormal_v_106;
+typedef std::tuple<AgradCdfNormal, type_v_107> AgradCdfNormal_v_107;
+typedef std::tuple<AgradCdfNormal, type_v_108> AgradCdfNormal_v_108;
+typedef std::tuple<AgradCdfNormal, type_v_109> AgradCdfNormal_v_109;
+typedef std::tuple<AgradCdfNormal, type_v_110> AgradCdfNormal_v_110;
+typedef std::tuple<AgradCdfNormal, type_v_111> AgradCdfNormal_v_111;
+typedef std::tuple<AgradCdfNormal, type_v_112> AgradCdfNormal_v_112;
+typedef std::tuple<AgradCdfNormal, type_v_113> AgradCdfNormal_v_113;
+typedef std::tuple<AgradCdfNormal, type_v_114> AgradCdfNormal_v_114;
+typedef std::tuple<AgradCdfNormal, type_v_115> AgradCdfNormal_v_115;
+typedef std::tuple<AgradCdfNormal, type_v_116> AgradCdfNormal_v_116;
+typedef std::tuple<AgradCdfNormal, type_v_117> AgradCdfNormal_v_117;
+typedef std::tuple<AgradCdfNormal, type_v_118> AgradCdfNormal_v_118;
+typedef std::tuple<AgradCdfNormal, type_v_119> AgradCdfNormal_v_119;
+typedef std::tuple<AgradCdfNormal, type_v_120> AgradCdfNormal_v_120;
+typedef std::tuple<AgradCdfNormal, type_v_121> AgradCdfNormal_v_121;
+typedef std::tuple<AgradCdfNormal, type_v_122> AgradCdfNormal_v_122;
+typedef std::tuple<AgradCdfNormal, type_v_123> AgradCdfNormal_v_123;
+typedef std::tuple<AgradCdfNormal, type_v_124> AgradCdfNormal_v_124;
+typedef std::tuple<AgradCdfNormal, type_v_125> AgradCdfNormal_v_125;
+typedef std::tuple<AgradCdfNormal, type_v_126> AgradCdfNormal_v_126;
+typedef std::tuple<AgradCdfNormal, type_v_127> AgradCdfNormal_v_127;
+typedef std::tuple<AgradCdfNormal, type_v_128> AgradCdfNormal_v_128;
+typedef std::tuple<AgradCdfNormal, type_v_129> AgradCdfNormal_v_129;
+typedef std::tuple<AgradCdfNormal, type_v_130> AgradCdfNormal_v_130;
+typedef std::tuple<AgradCdfNormal, type_v_131> AgradCdfNormal_v_131;
+typedef std::tuple<AgradCdfNormal, type_v_132> AgradCdfNormal_v_132;
+typedef std::tuple<AgradCdfNormal, type_v_133> AgradCdfNormal_v_133;
+typedef std::tuple<AgradCdfNormal, type_v_134> AgradCdfNormal_v_134;
+typedef std::tuple<AgradCdfNormal, type_v_135> AgradCdfNormal_v_135;
+typedef std::tuple<AgradCdfNormal, type_v_136> AgradCdfNormal_v_136;
+typedef std::tuple<AgradCdfNormal, type_v_137> AgradCdfNormal_v_137;
+typedef std::tuple<AgradCdfNormal, type_v_138> AgradCdfNormal_v_138;
+typedef std::tuple<AgradCdfNormal, type_v_139> AgradCdfNormal_v_139;
+typedef std::tuple<AgradCdfNormal, type_v_140> AgradCdfNormal_v_140;
+typedef std::tuple<AgradCdfNormal, type_v_141> AgradCdfNormal_v_141;
+typedef std::tuple<AgradCdfNormal, type_v_142> AgradCdfNormal_v_142;
+typedef std::tuple<AgradCdfNormal, type_v_143> AgradCdfNormal_v_143;
+typedef std::tuple<AgradCdfNormal, type_v_144> AgradCdfNormal_v_144;
+typedef std::tuple<AgradCdfNormal, type_v_145> AgradCdfNormal_v_145;
+typedef std::tuple<AgradCdfNormal, type_v_146> AgradCdfNormal_v_146;
+typedef std::tuple<AgradCdfNormal, type_v_147> AgradCdfNormal_v_147;
+typedef std::tuple<AgradCdfNormal, type_v_148> AgradCdfNormal_v_148;
+typedef std::tuple<AgradCdfNormal, type_v_149> AgradCdfNormal_v_149;
+typedef std::tuple<AgradCdfNormal, type_v_150> AgradCdfNormal_v_150;
+typedef std::tuple<AgradCdfNormal, type_v_151> AgradCdfNormal_v_151;
+typedef std::tuple<AgradCdfNormal, type_v_152> AgradCdfNormal_v_152;
+typedef std::tuple<AgradCdfNormal, type_v_153> AgradCdfNormal_v_153;
+typedef std::tuple<AgradCdfNormal, type_v_154> AgradCdfNormal_v_154;
+typedef std::tuple<AgradCdfNormal, type_v_155> AgradCdfNormal_v_155;
+typedef std::tuple<AgradCdfNormal, type_v_156> AgradCdfNormal_v_156;
+typedef std::tuple<AgradCdfNormal, type_v_157> AgradCdfNormal_v_157;
+typedef std::tuple<AgradCdfNormal, type_v_158> AgradCdfNormal_v_158;
+typedef std::tuple<AgradCdfNormal, type_v_159> AgradCdfNormal_v_159;
+typedef std::tuple<AgradCdfNormal, type_v_160> AgradCdfNormal_v_160;
+typedef std::tuple<AgradCdfNormal, type_v_161> AgradCdfNormal_v_161;
+typedef std::tuple<AgradCdfNormal, type_v_162> AgradCdfNormal_v_162;
+typedef std::tuple<AgradCdfNormal, type_v_163> AgradCdfNormal_v_163;
+typedef std::tuple<AgradCdfNormal, type_v_164> AgradCdfNormal_v_164;
+typedef std::tuple<AgradCdfNormal, type_v_165> AgradCdfNormal_v_165;
+typedef std::tuple<AgradCdfNormal, type_v_166> AgradCdfNormal_v_166;
+typedef std::tuple<AgradCdfNormal, type_v_167> AgradCdfNormal_v_167;
+typedef std::tuple<AgradCdfNormal, type_v_168> AgradCdfNormal_v_168;
+typedef std::tuple<AgradCdfNormal, type_v_169> AgradCdfNormal_v_169;
+typedef std::tuple<AgradCdfNormal, type_v_170> AgradCdfNormal_v_170;
+typedef std::tuple<AgradCdfNormal, type_v_171> AgradCdfNormal_v_171;
+typedef std::tuple<AgradCdfNormal, type_v_172> AgradCdfNormal_v_172;
+typedef std::tuple<AgradCdfNormal, type_v_173> AgradCdfNormal_v_173;
+typedef std::tuple<AgradCdfNormal, type_v_174> AgradCdfNormal_v_174;
+typedef std::tuple<AgradCdfNormal, type_v_175> AgradCdfNormal_v_175;
+typedef std::tuple<AgradCdfNormal, type_v_176> AgradCdfNormal_v_176;
+typedef std::tuple<AgradCdfNormal, type_v_177> AgradCdfNormal_v_177;
+typedef std::tuple<AgradCdfNormal, type_v_178> AgradCdfNormal_v_178;
+typedef std::tuple<AgradCdfNormal, type_v_179> AgradCdfNormal_v_179;
+typedef std::tuple<AgradCdfNormal, type_v_180> AgradCdfNormal_v_180;
+typedef std::tuple<AgradCdfNormal, type_v_181> AgradCdfNormal_v_181;
+typedef std::tuple<AgradCdfNormal, type_v_182> AgradCdfNormal_v_182;
+typedef std::tuple<AgradCdfNormal, type_v_183> AgradCdfNormal_v_183;
+typedef std::tuple<AgradCdfNormal, type_v_184> AgradCdfNormal_v_184;
+typedef std::tuple<AgradCdfNormal, type_v_185> AgradCdfNormal_v_185;
+typedef std::tuple<AgradCdfNormal, type_v_186> AgradCdfNormal_v_186;
+typedef std::tuple<AgradCdfNormal, type_v_187> AgradCdfNormal_v_187;
+typedef std::tuple<AgradCdfNormal, type_v_188> AgradCdfNormal_v_188;
+typedef std::tuple<AgradCdfNormal, type_v_189> AgradCdfNormal_v_189;
+typedef std::tuple<AgradCdfNormal, type_v_190> AgradCdfNormal_v_190;
+typedef std::tuple<AgradCdfNormal, type_v_191> AgradCdfNormal_v_191;
+typedef std::tuple<AgradCdfNormal, type_v_192> AgradCdfNormal_v_192;
+typedef std::tuple<AgradCdfNormal, type_v_193> AgradCdfNormal_v_193;
+typedef std::tuple<AgradCdfNormal, type_v_194> AgradCdfNormal_v_194;
+typedef std::tuple<AgradCdfNormal, type_v_195> AgradCdfNormal_v_195;
+typedef std::tuple<AgradCdfNormal, type_v_196> AgradCdfNormal_v_196;
+typedef std::tuple<AgradCdfNormal, type_v_197> AgradCdfNormal_v_197;
+typedef std::tuple<AgradCdfNormal, type_v_198> AgradCdfNormal_v_198;
+typedef std::tuple<AgradCdfNormal, type_v_199> AgradCdfNormal_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_100, AgradCdfTestFixture, AgradCdfNormal_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_101, AgradCdfTestFixture, AgradCdfNormal_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_102, AgradCdfTestFixture, AgradCdfNormal_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_103, AgradCdfTestFixture, AgradCdfNormal_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_104, AgradCdfTestFixture, AgradCdfNormal_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_105, AgradCdfTestFixture, AgradCdfNormal_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_106, AgradCdfTestFixture, AgradCdfNormal_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_107, AgradCdfTestFixture, AgradCdfNormal_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_108, AgradCdfTestFixture, AgradCdfNormal_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_109, AgradCdfTestFixture, AgradCdfNormal_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_110, AgradCdfTestFixture, AgradCdfNormal_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_111, AgradCdfTestFixture, AgradCdfNormal_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_112, AgradCdfTestFixture, AgradCdfNormal_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_113, AgradCdfTestFixture, AgradCdfNormal_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_114, AgradCdfTestFixture, AgradCdfNormal_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_115, AgradCdfTestFixture, AgradCdfNormal_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_116, AgradCdfTestFixture, AgradCdfNormal_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_117, AgradCdfTestFixture, AgradCdfNormal_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_118, AgradCdfTestFixture, AgradCdfNormal_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_119, AgradCdfTestFixture, AgradCdfNormal_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_120, AgradCdfTestFixture, AgradCdfNormal_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_121, AgradCdfTestFixture, AgradCdfNormal_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_122, AgradCdfTestFixture, AgradCdfNormal_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_123, AgradCdfTestFixture, AgradCdfNormal_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_124, AgradCdfTestFixture, AgradCdfNormal_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_125, AgradCdfTestFixture, AgradCdfNormal_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_126, AgradCdfTestFixture, AgradCdfNormal_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_127, AgradCdfTestFixture, AgradCdfNormal_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_128, AgradCdfTestFixture, AgradCdfNormal_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_129, AgradCdfTestFixture, AgradCdfNormal_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_130, AgradCdfTestFixture, AgradCdfNormal_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_131, AgradCdfTestFixture, AgradCdfNormal_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_132, AgradCdfTestFixture, AgradCdfNormal_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_133, AgradCdfTestFixture, AgradCdfNormal_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_134, AgradCdfTestFixture, AgradCdfNormal_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_135, AgradCdfTestFixture, AgradCdfNormal_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_136, AgradCdfTestFixture, AgradCdfNormal_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_137, AgradCdfTestFixture, AgradCdfNormal_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_138, AgradCdfTestFixture, AgradCdfNormal_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_139, AgradCdfTestFixture, AgradCdfNormal_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_140, AgradCdfTestFixture, AgradCdfNormal_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_141, AgradCdfTestFixture, AgradCdfNormal_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_142, AgradCdfTestFixture, AgradCdfNormal_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_143, AgradCdfTestFixture, AgradCdfNormal_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_144, AgradCdfTestFixture, AgradCdfNormal_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_145, AgradCdfTestFixture, AgradCdfNormal_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_146, AgradCdfTestFixture, AgradCdfNormal_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_147, AgradCdfTestFixture, AgradCdfNormal_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_148, AgradCdfTestFixture, AgradCdfNormal_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_149, AgradCdfTestFixture, AgradCdfNormal_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_150, AgradCdfTestFixture, AgradCdfNormal_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_151, AgradCdfTestFixture, AgradCdfNormal_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_152, AgradCdfTestFixture, AgradCdfNormal_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_153, AgradCdfTestFixture, AgradCdfNormal_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_154, AgradCdfTestFixture, AgradCdfNormal_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_155, AgradCdfTestFixture, AgradCdfNormal_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_156, AgradCdfTestFixture, AgradCdfNormal_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_157, AgradCdfTestFixture, AgradCdfNormal_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_158, AgradCdfTestFixture, AgradCdfNormal_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_159, AgradCdfTestFixture, AgradCdfNormal_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_160, AgradCdfTestFixture, AgradCdfNormal_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_161, AgradCdfTestFixture, AgradCdfNormal_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_162, AgradCdfTestFixture, AgradCdfNormal_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_163, AgradCdfTestFixture, AgradCdfNormal_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_164, AgradCdfTestFixture, AgradCdfNormal_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_165, AgradCdfTestFixture, AgradCdfNormal_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_166, AgradCdfTestFixture, AgradCdfNormal_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_167, AgradCdfTestFixture, AgradCdfNormal_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_168, AgradCdfTestFixture, AgradCdfNormal_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_169, AgradCdfTestFixture, AgradCdfNormal_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_170, AgradCdfTestFixture, AgradCdfNormal_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_171, AgradCdfTestFixture, AgradCdfNormal_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_172, AgradCdfTestFixture, AgradCdfNormal_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_173, AgradCdfTestFixture, AgradCdfNormal_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_174, AgradCdfTestFixture, AgradCdfNormal_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_175, AgradCdfTestFixture, AgradCdfNormal_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_176, AgradCdfTestFixture, AgradCdfNormal_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_177, AgradCdfTestFixture, AgradCdfNormal_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_178, AgradCdfTestFixture, AgradCdfNormal_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_179, AgradCdfTestFixture, AgradCdfNormal_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_180, AgradCdfTestFixture, AgradCdfNormal_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_181, AgradCdfTestFixture, AgradCdfNormal_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_182, AgradCdfTestFixture, AgradCdfNormal_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_183, AgradCdfTestFixture, AgradCdfNormal_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_184, AgradCdfTestFixture, AgradCdfNormal_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_185, AgradCdfTestFixture, AgradCdfNormal_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_186, AgradCdfTestFixture, AgradCdfNormal_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_187, AgradCdfTestFixture, AgradCdfNormal_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_188, AgradCdfTestFixture, AgradCdfNormal_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_189, AgradCdfTestFixture, AgradCdfNormal_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_190, AgradCdfTestFixture, AgradCdfNormal_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_191, AgradCdfTestFixture, AgradCdfNormal_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_192, AgradCdfTestFixture, AgradCdfNormal_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_193, AgradCdfTestFixture, AgradCdfNormal_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_194, AgradCdfTestFixture, AgradCdfNormal_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_195, AgradCdfTestFixture, AgradCdfNormal_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_196, AgradCdfTestFixture, AgradCdfNormal_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_197, AgradCdfTestFixture, AgradCdfNormal_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_198, AgradCdfTestFixture, AgradCdfNormal_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_v_199, AgradCdfTestFixture, AgradCdfNormal_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfNormal, type_vv_100> AgradCdfNormal_vv_100;
+typedef std::tuple<AgradCdfNormal, type_vv_101> AgradCdfNormal_vv_101;
+typedef std::tuple<AgradCdfNormal, type_vv_102> AgradCdfNormal_vv_102;
+typedef std::tuple<AgradCdfNormal, type_vv_103> AgradCdfNormal_vv_103;
+typedef std::tuple<AgradCdfNormal, type_vv_104> AgradCdfNormal_vv_104;
+typedef std::tuple<AgradCdfNormal, type_vv_105> AgradCdfNormal_vv_105;
+typedef std::tuple<AgradCdfNormal, type_vv_106> AgradCdfNormal_vv_106;
+typedef std::tuple<AgradCdfNormal, type_vv_107> AgradCdfNormal_vv_107;
+typedef std::tuple<AgradCdfNormal, type_vv_108> AgradCdfNormal_vv_108;
+typedef std::tuple<AgradCdfNormal, type_vv_109> AgradCdfNormal_vv_109;
+typedef std::tuple<AgradCdfNormal, type_vv_110> AgradCdfNormal_vv_110;
+typedef std::tuple<AgradCdfNormal, type_vv_111> AgradCdfNormal_vv_111;
+typedef std::tuple<AgradCdfNormal, type_vv_112> AgradCdfNormal_vv_112;
+typedef std::tuple<AgradCdfNormal, type_vv_113> AgradCdfNormal_vv_113;
+typedef std::tuple<AgradCdfNormal, type_vv_114> AgradCdfNormal_vv_114;
+typedef std::tuple<AgradCdfNormal, type_vv_115> AgradCdfNormal_vv_115;
+typedef std::tuple<AgradCdfNormal, type_vv_116> AgradCdfNormal_vv_116;
+typedef std::tuple<AgradCdfNormal, type_vv_117> AgradCdfNormal_vv_117;
+typedef std::tuple<AgradCdfNormal, type_vv_118> AgradCdfNormal_vv_118;
+typedef std::tuple<AgradCdfNormal, type_vv_119> AgradCdfNormal_vv_119;
+typedef std::tuple<AgradCdfNormal, type_vv_120> AgradCdfNormal_vv_120;
+typedef std::tuple<AgradCdfNormal, type_vv_121> AgradCdfNormal_vv_121;
+typedef std::tuple<AgradCdfNormal, type_vv_122> AgradCdfNormal_vv_122;
+typedef std::tuple<AgradCdfNormal, type_vv_123> AgradCdfNormal_vv_123;
+typedef std::tuple<AgradCdfNormal, type_vv_124> AgradCdfNormal_vv_124;
+typedef std::tuple<AgradCdfNormal, type_vv_125> AgradCdfNormal_vv_125;
+typedef std::tuple<AgradCdfNormal, type_vv_126> AgradCdfNormal_vv_126;
+typedef std::tuple<AgradCdfNormal, type_vv_127> AgradCdfNormal_vv_127;
+typedef std::tuple<AgradCdfNormal, type_vv_128> AgradCdfNormal_vv_128;
+typedef std::tuple<AgradCdfNormal, type_vv_129> AgradCdfNormal_vv_129;
+typedef std::tuple<AgradCdfNormal, type_vv_130> AgradCdfNormal_vv_130;
+typedef std::tuple<AgradCdfNormal, type_vv_131> AgradCdfNormal_vv_131;
+typedef std::tuple<AgradCdfNormal, type_vv_132> AgradCdfNormal_vv_132;
+typedef std::tuple<AgradCdfNormal, type_vv_133> AgradCdfNormal_vv_133;
+typedef std::tuple<AgradCdfNormal, type_vv_134> AgradCdfNormal_vv_134;
+typedef std::tuple<AgradCdfNormal, type_vv_135> AgradCdfNormal_vv_135;
+typedef std::tuple<AgradCdfNormal, type_vv_136> AgradCdfNormal_vv_136;
+typedef std::tuple<AgradCdfNormal, type_vv_137> AgradCdfNormal_vv_137;
+typedef std::tuple<AgradCdfNormal, type_vv_138> AgradCdfNormal_vv_138;
+typedef std::tuple<AgradCdfNormal, type_vv_139> AgradCdfNormal_vv_139;
+typedef std::tuple<AgradCdfNormal, type_vv_140> AgradCdfNormal_vv_140;
+typedef std::tuple<AgradCdfNormal, type_vv_141> AgradCdfNormal_vv_141;
+typedef std::tuple<AgradCdfNormal, type_vv_142> AgradCdfNormal_vv_142;
+typedef std::tuple<AgradCdfNormal, type_vv_143> AgradCdfNormal_vv_143;
+typedef std::tuple<AgradCdfNormal, type_vv_144> AgradCdfNormal_vv_144;
+typedef std::tuple<AgradCdfNormal, type_vv_145> AgradCdfNormal_vv_145;
+typedef std::tuple<AgradCdfNormal, type_vv_146> AgradCdfNormal_vv_146;
+typedef std::tuple<AgradCdfNormal, type_vv_147> AgradCdfNormal_vv_147;
+typedef std::tuple<AgradCdfNormal, type_vv_148> AgradCdfNormal_vv_148;
+typedef std::tuple<AgradCdfNormal, type_vv_149> AgradCdfNormal_vv_149;
+typedef std::tuple<AgradCdfNormal, type_vv_150> AgradCdfNormal_vv_150;
+typedef std::tuple<AgradCdfNormal, type_vv_151> AgradCdfNormal_vv_151;
+typedef std::tuple<AgradCdfNormal, type_vv_152> AgradCdfNormal_vv_152;
+typedef std::tuple<AgradCdfNormal, type_vv_153> AgradCdfNormal_vv_153;
+typedef std::tuple<AgradCdfNormal, type_vv_154> AgradCdfNormal_vv_154;
+typedef std::tuple<AgradCdfNormal, type_vv_155> AgradCdfNormal_vv_155;
+typedef std::tuple<AgradCdfNormal, type_vv_156> AgradCdfNormal_vv_156;
+typedef std::tuple<AgradCdfNormal, type_vv_157> AgradCdfNormal_vv_157;
+typedef std::tuple<AgradCdfNormal, type_vv_158> AgradCdfNormal_vv_158;
+typedef std::tuple<AgradCdfNormal, type_vv_159> AgradCdfNormal_vv_159;
+typedef std::tuple<AgradCdfNormal, type_vv_160> AgradCdfNormal_vv_160;
+typedef std::tuple<AgradCdfNormal, type_vv_161> AgradCdfNormal_vv_161;
+typedef std::tuple<AgradCdfNormal, type_vv_162> AgradCdfNormal_vv_162;
+typedef std::tuple<AgradCdfNormal, type_vv_163> AgradCdfNormal_vv_163;
+typedef std::tuple<AgradCdfNormal, type_vv_164> AgradCdfNormal_vv_164;
+typedef std::tuple<AgradCdfNormal, type_vv_165> AgradCdfNormal_vv_165;
+typedef std::tuple<AgradCdfNormal, type_vv_166> AgradCdfNormal_vv_166;
+typedef std::tuple<AgradCdfNormal, type_vv_167> AgradCdfNormal_vv_167;
+typedef std::tuple<AgradCdfNormal, type_vv_168> AgradCdfNormal_vv_168;
+typedef std::tuple<AgradCdfNormal, type_vv_169> AgradCdfNormal_vv_169;
+typedef std::tuple<AgradCdfNormal, type_vv_170> AgradCdfNormal_vv_170;
+typedef std::tuple<AgradCdfNormal, type_vv_171> AgradCdfNormal_vv_171;
+typedef std::tuple<AgradCdfNormal, type_vv_172> AgradCdfNormal_vv_172;
+typedef std::tuple<AgradCdfNormal, type_vv_173> AgradCdfNormal_vv_173;
+typedef std::tuple<AgradCdfNormal, type_vv_174> AgradCdfNormal_vv_174;
+typedef std::tuple<AgradCdfNormal, type_vv_175> AgradCdfNormal_vv_175;
+typedef std::tuple<AgradCdfNormal, type_vv_176> AgradCdfNormal_vv_176;
+typedef std::tuple<AgradCdfNormal, type_vv_177> AgradCdfNormal_vv_177;
+typedef std::tuple<AgradCdfNormal, type_vv_178> AgradCdfNormal_vv_178;
+typedef std::tuple<AgradCdfNormal, type_vv_179> AgradCdfNormal_vv_179;
+typedef std::tuple<AgradCdfNormal, type_vv_180> AgradCdfNormal_vv_180;
+typedef std::tuple<AgradCdfNormal, type_vv_181> AgradCdfNormal_vv_181;
+typedef std::tuple<AgradCdfNormal, type_vv_182> AgradCdfNormal_vv_182;
+typedef std::tuple<AgradCdfNormal, type_vv_183> AgradCdfNormal_vv_183;
+typedef std::tuple<AgradCdfNormal, type_vv_184> AgradCdfNormal_vv_184;
+typedef std::tuple<AgradCdfNormal, type_vv_185> AgradCdfNormal_vv_185;
+typedef std::tuple<AgradCdfNormal, type_vv_186> AgradCdfNormal_vv_186;
+typedef std::tuple<AgradCdfNormal, type_vv_187> AgradCdfNormal_vv_187;
+typedef std::tuple<AgradCdfNormal, type_vv_188> AgradCdfNormal_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_100, AgradCdfTestFixture, AgradCdfNormal_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_101, AgradCdfTestFixture, AgradCdfNormal_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_102, AgradCdfTestFixture, AgradCdfNormal_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_103, AgradCdfTestFixture, AgradCdfNormal_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_104, AgradCdfTestFixture, AgradCdfNormal_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_105, AgradCdfTestFixture, AgradCdfNormal_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_106, AgradCdfTestFixture, AgradCdfNormal_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_107, AgradCdfTestFixture, AgradCdfNormal_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_108, AgradCdfTestFixture, AgradCdfNormal_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_109, AgradCdfTestFixture, AgradCdfNormal_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_110, AgradCdfTestFixture, AgradCdfNormal_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_111, AgradCdfTestFixture, AgradCdfNormal_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_112, AgradCdfTestFixture, AgradCdfNormal_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_113, AgradCdfTestFixture, AgradCdfNormal_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_114, AgradCdfTestFixture, AgradCdfNormal_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_115, AgradCdfTestFixture, AgradCdfNormal_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_116, AgradCdfTestFixture, AgradCdfNormal_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_117, AgradCdfTestFixture, AgradCdfNormal_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_118, AgradCdfTestFixture, AgradCdfNormal_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_119, AgradCdfTestFixture, AgradCdfNormal_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_120, AgradCdfTestFixture, AgradCdfNormal_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_121, AgradCdfTestFixture, AgradCdfNormal_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_122, AgradCdfTestFixture, AgradCdfNormal_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_123, AgradCdfTestFixture, AgradCdfNormal_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_124, AgradCdfTestFixture, AgradCdfNormal_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_125, AgradCdfTestFixture, AgradCdfNormal_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_126, AgradCdfTestFixture, AgradCdfNormal_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_127, AgradCdfTestFixture, AgradCdfNormal_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_128, AgradCdfTestFixture, AgradCdfNormal_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_129, AgradCdfTestFixture, AgradCdfNormal_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_130, AgradCdfTestFixture, AgradCdfNormal_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_131, AgradCdfTestFixture, AgradCdfNormal_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_132, AgradCdfTestFixture, AgradCdfNormal_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_133, AgradCdfTestFixture, AgradCdfNormal_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_134, AgradCdfTestFixture, AgradCdfNormal_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_135, AgradCdfTestFixture, AgradCdfNormal_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_136, AgradCdfTestFixture, AgradCdfNormal_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_137, AgradCdfTestFixture, AgradCdfNormal_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_138, AgradCdfTestFixture, AgradCdfNormal_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_139, AgradCdfTestFixture, AgradCdfNormal_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_140, AgradCdfTestFixture, AgradCdfNormal_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_141, AgradCdfTestFixture, AgradCdfNormal_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_142, AgradCdfTestFixture, AgradCdfNormal_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_143, AgradCdfTestFixture, AgradCdfNormal_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_144, AgradCdfTestFixture, AgradCdfNormal_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_145, AgradCdfTestFixture, AgradCdfNormal_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_146, AgradCdfTestFixture, AgradCdfNormal_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_147, AgradCdfTestFixture, AgradCdfNormal_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_148, AgradCdfTestFixture, AgradCdfNormal_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_149, AgradCdfTestFixture, AgradCdfNormal_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_150, AgradCdfTestFixture, AgradCdfNormal_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_151, AgradCdfTestFixture, AgradCdfNormal_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_152, AgradCdfTestFixture, AgradCdfNormal_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_153, AgradCdfTestFixture, AgradCdfNormal_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_154, AgradCdfTestFixture, AgradCdfNormal_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_155, AgradCdfTestFixture, AgradCdfNormal_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_156, AgradCdfTestFixture, AgradCdfNormal_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_157, AgradCdfTestFixture, AgradCdfNormal_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_158, AgradCdfTestFixture, AgradCdfNormal_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_159, AgradCdfTestFixture, AgradCdfNormal_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_160, AgradCdfTestFixture, AgradCdfNormal_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_161, AgradCdfTestFixture, AgradCdfNormal_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_162, AgradCdfTestFixture, AgradCdfNormal_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_163, AgradCdfTestFixture, AgradCdfNormal_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_164, AgradCdfTestFixture, AgradCdfNormal_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_165, AgradCdfTestFixture, AgradCdfNormal_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_166, AgradCdfTestFixture, AgradCdfNormal_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_167, AgradCdfTestFixture, AgradCdfNormal_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_168, AgradCdfTestFixture, AgradCdfNormal_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_169, AgradCdfTestFixture, AgradCdfNormal_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_170, AgradCdfTestFixture, AgradCdfNormal_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_171, AgradCdfTestFixture, AgradCdfNormal_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_172, AgradCdfTestFixture, AgradCdfNormal_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_173, AgradCdfTestFixture, AgradCdfNormal_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_174, AgradCdfTestFixture, AgradCdfNormal_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_175, AgradCdfTestFixture, AgradCdfNormal_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_176, AgradCdfTestFixture, AgradCdfNormal_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_177, AgradCdfTestFixture, AgradCdfNormal_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_178, AgradCdfTestFixture, AgradCdfNormal_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_179, AgradCdfTestFixture, AgradCdfNormal_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_180, AgradCdfTestFixture, AgradCdfNormal_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_181, AgradCdfTestFixture, AgradCdfNormal_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_182, AgradCdfTestFixture, AgradCdfNormal_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_183, AgradCdfTestFixture, AgradCdfNormal_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_184, AgradCdfTestFixture, AgradCdfNormal_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_185, AgradCdfTestFixture, AgradCdfNormal_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_186, AgradCdfTestFixture, AgradCdfNormal_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_187, AgradCdfTestFixture, AgradCdfNormal_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfNormal_vv_188, AgradCdfTestFixture, AgradCdfNormal_vv_188);
+
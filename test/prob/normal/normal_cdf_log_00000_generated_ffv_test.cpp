@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogNormal, type_ffv_0> AgradCdfLogNormal_ffv_0;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_1> AgradCdfLogNormal_ffv_1;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_2> AgradCdfLogNormal_ffv_2;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_3> AgradCdfLogNormal_ffv_3;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_4> AgradCdfLogNormal_ffv_4;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_5> AgradCdfLogNormal_ffv_5;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_6> AgradCdfLogNormal_ffv_6;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_7> AgradCdfLogNormal_ffv_7;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_8> AgradCdfLogNormal_ffv_8;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_9> AgradCdfLogNormal_ffv_9;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_10> AgradCdfLogNormal_ffv_10;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_11> AgradCdfLogNormal_ffv_11;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_12> AgradCdfLogNormal_ffv_12;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_13> AgradCdfLogNormal_ffv_13;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_14> AgradCdfLogNormal_ffv_14;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_15> AgradCdfLogNormal_ffv_15;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_16> AgradCdfLogNormal_ffv_16;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_17> AgradCdfLogNormal_ffv_17;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_18> AgradCdfLogNormal_ffv_18;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_19> AgradCdfLogNormal_ffv_19;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_20> AgradCdfLogNormal_ffv_20;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_21> AgradCdfLogNormal_ffv_21;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_22> AgradCdfLogNormal_ffv_22;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_23> AgradCdfLogNormal_ffv_23;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_24> AgradCdfLogNormal_ffv_24;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_25> AgradCdfLogNormal_ffv_25;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_26> AgradCdfLogNormal_ffv_26;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_27> AgradCdfLogNormal_ffv_27;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_28> AgradCdfLogNormal_ffv_28;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_29> AgradCdfLogNormal_ffv_29;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_30> AgradCdfLogNormal_ffv_30;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_31> AgradCdfLogNormal_ffv_31;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_32> AgradCdfLogNormal_ffv_32;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_33> AgradCdfLogNormal_ffv_33;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_34> AgradCdfLogNormal_ffv_34;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_35> AgradCdfLogNormal_ffv_35;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_36> AgradCdfLogNormal_ffv_36;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_37> AgradCdfLogNormal_ffv_37;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_38> AgradCdfLogNormal_ffv_38;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_39> AgradCdfLogNormal_ffv_39;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_40> AgradCdfLogNormal_ffv_40;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_41> AgradCdfLogNormal_ffv_41;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_42> AgradCdfLogNormal_ffv_42;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_43> AgradCdfLogNormal_ffv_43;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_44> AgradCdfLogNormal_ffv_44;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_45> AgradCdfLogNormal_ffv_45;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_46> AgradCdfLogNormal_ffv_46;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_47> AgradCdfLogNormal_ffv_47;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_48> AgradCdfLogNormal_ffv_48;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_49> AgradCdfLogNormal_ffv_49;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_50> AgradCdfLogNormal_ffv_50;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_51> AgradCdfLogNormal_ffv_51;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_52> AgradCdfLogNormal_ffv_52;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_53> AgradCdfLogNormal_ffv_53;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_54> AgradCdfLogNormal_ffv_54;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_55> AgradCdfLogNormal_ffv_55;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_56> AgradCdfLogNormal_ffv_56;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_57> AgradCdfLogNormal_ffv_57;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_58> AgradCdfLogNormal_ffv_58;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_59> AgradCdfLogNormal_ffv_59;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_60> AgradCdfLogNormal_ffv_60;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_61> AgradCdfLogNormal_ffv_61;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_62> AgradCdfLogNormal_ffv_62;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_63> AgradCdfLogNormal_ffv_63;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_64> AgradCdfLogNormal_ffv_64;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_65> AgradCdfLogNormal_ffv_65;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_66> AgradCdfLogNormal_ffv_66;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_67> AgradCdfLogNormal_ffv_67;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_68> AgradCdfLogNormal_ffv_68;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_69> AgradCdfLogNormal_ffv_69;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_70> AgradCdfLogNormal_ffv_70;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_71> AgradCdfLogNormal_ffv_71;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_72> AgradCdfLogNormal_ffv_72;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_73> AgradCdfLogNormal_ffv_73;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_74> AgradCdfLogNormal_ffv_74;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_75> AgradCdfLogNormal_ffv_75;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_76> AgradCdfLogNormal_ffv_76;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_77> AgradCdfLogNormal_ffv_77;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_78> AgradCdfLogNormal_ffv_78;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_79> AgradCdfLogNormal_ffv_79;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_80> AgradCdfLogNormal_ffv_80;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_81> AgradCdfLogNormal_ffv_81;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_82> AgradCdfLogNormal_ffv_82;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_83> AgradCdfLogNormal_ffv_83;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_84> AgradCdfLogNormal_ffv_84;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_85> AgradCdfLogNormal_ffv_85;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_86> AgradCdfLogNormal_ffv_86;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_87> AgradCdfLogNormal_ffv_87;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_88> AgradCdfLogNormal_ffv_88;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_89> AgradCdfLogNormal_ffv_89;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_90> AgradCdfLogNormal_ffv_90;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_91> AgradCdfLogNormal_ffv_91;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_92> AgradCdfLogNormal_ffv_92;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_93> AgradCdfLogNormal_ffv_93;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_94> AgradCdfLogNormal_ffv_94;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_95> AgradCdfLogNormal_ffv_95;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_96> AgradCdfLogNormal_ffv_96;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_97> AgradCdfLogNormal_ffv_97;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_98> AgradCdfLogNormal_ffv_98;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_99> AgradCdfLogNormal_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_0, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_1, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_2, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_3, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_4, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_5, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_6, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_7, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_8, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_9, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_10, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_11, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_12, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_13, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_14, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_15, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_16, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_17, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_18, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_19, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_20, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_21, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_22, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_23, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_24, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_25, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_26, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_27, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_28, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_29, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_30, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_31, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_32, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_33, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_34, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_35, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_36, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_37, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_38, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_39, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_40, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_41, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_42, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_43, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_44, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_45, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_46, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_47, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_48, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_49, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_50, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_51, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_52, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_53, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_54, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_55, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_56, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_57, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_58, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_59, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_60, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_61, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_62, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_63, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_64, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_65, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_66, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_67, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_68, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_69, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_70, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_71, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_72, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_73, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_74, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_75, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_76, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_77, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_78, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_79, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_80, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_81, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_82, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_83, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_84, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_85, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_86, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_87, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_88, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_89, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_90, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_91, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_92, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_93, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_94, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_95, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_96, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_97, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_98, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_99, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_99);
+
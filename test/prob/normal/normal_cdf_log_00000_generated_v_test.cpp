@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogNormal, type_v_0> AgradCdfLogNormal_v_0;
+typedef std::tuple<AgradCdfLogNormal, type_v_1> AgradCdfLogNormal_v_1;
+typedef std::tuple<AgradCdfLogNormal, type_v_2> AgradCdfLogNormal_v_2;
+typedef std::tuple<AgradCdfLogNormal, type_v_3> AgradCdfLogNormal_v_3;
+typedef std::tuple<AgradCdfLogNormal, type_v_4> AgradCdfLogNormal_v_4;
+typedef std::tuple<AgradCdfLogNormal, type_v_5> AgradCdfLogNormal_v_5;
+typedef std::tuple<AgradCdfLogNormal, type_v_6> AgradCdfLogNormal_v_6;
+typedef std::tuple<AgradCdfLogNormal, type_v_7> AgradCdfLogNormal_v_7;
+typedef std::tuple<AgradCdfLogNormal, type_v_8> AgradCdfLogNormal_v_8;
+typedef std::tuple<AgradCdfLogNormal, type_v_9> AgradCdfLogNormal_v_9;
+typedef std::tuple<AgradCdfLogNormal, type_v_10> AgradCdfLogNormal_v_10;
+typedef std::tuple<AgradCdfLogNormal, type_v_11> AgradCdfLogNormal_v_11;
+typedef std::tuple<AgradCdfLogNormal, type_v_12> AgradCdfLogNormal_v_12;
+typedef std::tuple<AgradCdfLogNormal, type_v_13> AgradCdfLogNormal_v_13;
+typedef std::tuple<AgradCdfLogNormal, type_v_14> AgradCdfLogNormal_v_14;
+typedef std::tuple<AgradCdfLogNormal, type_v_15> AgradCdfLogNormal_v_15;
+typedef std::tuple<AgradCdfLogNormal, type_v_16> AgradCdfLogNormal_v_16;
+typedef std::tuple<AgradCdfLogNormal, type_v_17> AgradCdfLogNormal_v_17;
+typedef std::tuple<AgradCdfLogNormal, type_v_18> AgradCdfLogNormal_v_18;
+typedef std::tuple<AgradCdfLogNormal, type_v_19> AgradCdfLogNormal_v_19;
+typedef std::tuple<AgradCdfLogNormal, type_v_20> AgradCdfLogNormal_v_20;
+typedef std::tuple<AgradCdfLogNormal, type_v_21> AgradCdfLogNormal_v_21;
+typedef std::tuple<AgradCdfLogNormal, type_v_22> AgradCdfLogNormal_v_22;
+typedef std::tuple<AgradCdfLogNormal, type_v_23> AgradCdfLogNormal_v_23;
+typedef std::tuple<AgradCdfLogNormal, type_v_24> AgradCdfLogNormal_v_24;
+typedef std::tuple<AgradCdfLogNormal, type_v_25> AgradCdfLogNormal_v_25;
+typedef std::tuple<AgradCdfLogNormal, type_v_26> AgradCdfLogNormal_v_26;
+typedef std::tuple<AgradCdfLogNormal, type_v_27> AgradCdfLogNormal_v_27;
+typedef std::tuple<AgradCdfLogNormal, type_v_28> AgradCdfLogNormal_v_28;
+typedef std::tuple<AgradCdfLogNormal, type_v_29> AgradCdfLogNormal_v_29;
+typedef std::tuple<AgradCdfLogNormal, type_v_30> AgradCdfLogNormal_v_30;
+typedef std::tuple<AgradCdfLogNormal, type_v_31> AgradCdfLogNormal_v_31;
+typedef std::tuple<AgradCdfLogNormal, type_v_32> AgradCdfLogNormal_v_32;
+typedef std::tuple<AgradCdfLogNormal, type_v_33> AgradCdfLogNormal_v_33;
+typedef std::tuple<AgradCdfLogNormal, type_v_34> AgradCdfLogNormal_v_34;
+typedef std::tuple<AgradCdfLogNormal, type_v_35> AgradCdfLogNormal_v_35;
+typedef std::tuple<AgradCdfLogNormal, type_v_36> AgradCdfLogNormal_v_36;
+typedef std::tuple<AgradCdfLogNormal, type_v_37> AgradCdfLogNormal_v_37;
+typedef std::tuple<AgradCdfLogNormal, type_v_38> AgradCdfLogNormal_v_38;
+typedef std::tuple<AgradCdfLogNormal, type_v_39> AgradCdfLogNormal_v_39;
+typedef std::tuple<AgradCdfLogNormal, type_v_40> AgradCdfLogNormal_v_40;
+typedef std::tuple<AgradCdfLogNormal, type_v_41> AgradCdfLogNormal_v_41;
+typedef std::tuple<AgradCdfLogNormal, type_v_42> AgradCdfLogNormal_v_42;
+typedef std::tuple<AgradCdfLogNormal, type_v_43> AgradCdfLogNormal_v_43;
+typedef std::tuple<AgradCdfLogNormal, type_v_44> AgradCdfLogNormal_v_44;
+typedef std::tuple<AgradCdfLogNormal, type_v_45> AgradCdfLogNormal_v_45;
+typedef std::tuple<AgradCdfLogNormal, type_v_46> AgradCdfLogNormal_v_46;
+typedef std::tuple<AgradCdfLogNormal, type_v_47> AgradCdfLogNormal_v_47;
+typedef std::tuple<AgradCdfLogNormal, type_v_48> AgradCdfLogNormal_v_48;
+typedef std::tuple<AgradCdfLogNormal, type_v_49> AgradCdfLogNormal_v_49;
+typedef std::tuple<AgradCdfLogNormal, type_v_50> AgradCdfLogNormal_v_50;
+typedef std::tuple<AgradCdfLogNormal, type_v_51> AgradCdfLogNormal_v_51;
+typedef std::tuple<AgradCdfLogNormal, type_v_52> AgradCdfLogNormal_v_52;
+typedef std::tuple<AgradCdfLogNormal, type_v_53> AgradCdfLogNormal_v_53;
+typedef std::tuple<AgradCdfLogNormal, type_v_54> AgradCdfLogNormal_v_54;
+typedef std::tuple<AgradCdfLogNormal, type_v_55> AgradCdfLogNormal_v_55;
+typedef std::tuple<AgradCdfLogNormal, type_v_56> AgradCdfLogNormal_v_56;
+typedef std::tuple<AgradCdfLogNormal, type_v_57> AgradCdfLogNormal_v_57;
+typedef std::tuple<AgradCdfLogNormal, type_v_58> AgradCdfLogNormal_v_58;
+typedef std::tuple<AgradCdfLogNormal, type_v_59> AgradCdfLogNormal_v_59;
+typedef std::tuple<AgradCdfLogNormal, type_v_60> AgradCdfLogNormal_v_60;
+typedef std::tuple<AgradCdfLogNormal, type_v_61> AgradCdfLogNormal_v_61;
+typedef std::tuple<AgradCdfLogNormal, type_v_62> AgradCdfLogNormal_v_62;
+typedef std::tuple<AgradCdfLogNormal, type_v_63> AgradCdfLogNormal_v_63;
+typedef std::tuple<AgradCdfLogNormal, type_v_64> AgradCdfLogNormal_v_64;
+typedef std::tuple<AgradCdfLogNormal, type_v_65> AgradCdfLogNormal_v_65;
+typedef std::tuple<AgradCdfLogNormal, type_v_66> AgradCdfLogNormal_v_66;
+typedef std::tuple<AgradCdfLogNormal, type_v_67> AgradCdfLogNormal_v_67;
+typedef std::tuple<AgradCdfLogNormal, type_v_68> AgradCdfLogNormal_v_68;
+typedef std::tuple<AgradCdfLogNormal, type_v_69> AgradCdfLogNormal_v_69;
+typedef std::tuple<AgradCdfLogNormal, type_v_70> AgradCdfLogNormal_v_70;
+typedef std::tuple<AgradCdfLogNormal, type_v_71> AgradCdfLogNormal_v_71;
+typedef std::tuple<AgradCdfLogNormal, type_v_72> AgradCdfLogNormal_v_72;
+typedef std::tuple<AgradCdfLogNormal, type_v_73> AgradCdfLogNormal_v_73;
+typedef std::tuple<AgradCdfLogNormal, type_v_74> AgradCdfLogNormal_v_74;
+typedef std::tuple<AgradCdfLogNormal, type_v_75> AgradCdfLogNormal_v_75;
+typedef std::tuple<AgradCdfLogNormal, type_v_76> AgradCdfLogNormal_v_76;
+typedef std::tuple<AgradCdfLogNormal, type_v_77> AgradCdfLogNormal_v_77;
+typedef std::tuple<AgradCdfLogNormal, type_v_78> AgradCdfLogNormal_v_78;
+typedef std::tuple<AgradCdfLogNormal, type_v_79> AgradCdfLogNormal_v_79;
+typedef std::tuple<AgradCdfLogNormal, type_v_80> AgradCdfLogNormal_v_80;
+typedef std::tuple<AgradCdfLogNormal, type_v_81> AgradCdfLogNormal_v_81;
+typedef std::tuple<AgradCdfLogNormal, type_v_82> AgradCdfLogNormal_v_82;
+typedef std::tuple<AgradCdfLogNormal, type_v_83> AgradCdfLogNormal_v_83;
+typedef std::tuple<AgradCdfLogNormal, type_v_84> AgradCdfLogNormal_v_84;
+typedef std::tuple<AgradCdfLogNormal, type_v_85> AgradCdfLogNormal_v_85;
+typedef std::tuple<AgradCdfLogNormal, type_v_86> AgradCdfLogNormal_v_86;
+typedef std::tuple<AgradCdfLogNormal, type_v_87> AgradCdfLogNormal_v_87;
+typedef std::tuple<AgradCdfLogNormal, type_v_88> AgradCdfLogNormal_v_88;
+typedef std::tuple<AgradCdfLogNormal, type_v_89> AgradCdfLogNormal_v_89;
+typedef std::tuple<AgradCdfLogNormal, type_v_90> AgradCdfLogNormal_v_90;
+typedef std::tuple<AgradCdfLogNormal, type_v_91> AgradCdfLogNormal_v_91;
+typedef std::tuple<AgradCdfLogNormal, type_v_92> AgradCdfLogNormal_v_92;
+typedef std::tuple<AgradCdfLogNormal, type_v_93> AgradCdfLogNormal_v_93;
+typedef std::tuple<AgradCdfLogNormal, type_v_94> AgradCdfLogNormal_v_94;
+typedef std::tuple<AgradCdfLogNormal, type_v_95> AgradCdfLogNormal_v_95;
+typedef std::tuple<AgradCdfLogNormal, type_v_96> AgradCdfLogNormal_v_96;
+typedef std::tuple<AgradCdfLogNormal, type_v_97> AgradCdfLogNormal_v_97;
+typedef std::tuple<AgradCdfLogNormal, type_v_98> AgradCdfLogNormal_v_98;
+typedef std::tuple<AgradCdfLogNormal, type_v_99> AgradCdfLogNormal_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_0, AgradCdfLogTestFixture, AgradCdfLogNormal_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_1, AgradCdfLogTestFixture, AgradCdfLogNormal_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_2, AgradCdfLogTestFixture, AgradCdfLogNormal_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_3, AgradCdfLogTestFixture, AgradCdfLogNormal_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_4, AgradCdfLogTestFixture, AgradCdfLogNormal_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_5, AgradCdfLogTestFixture, AgradCdfLogNormal_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_6, AgradCdfLogTestFixture, AgradCdfLogNormal_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_7, AgradCdfLogTestFixture, AgradCdfLogNormal_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_8, AgradCdfLogTestFixture, AgradCdfLogNormal_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_9, AgradCdfLogTestFixture, AgradCdfLogNormal_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_10, AgradCdfLogTestFixture, AgradCdfLogNormal_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_11, AgradCdfLogTestFixture, AgradCdfLogNormal_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_12, AgradCdfLogTestFixture, AgradCdfLogNormal_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_13, AgradCdfLogTestFixture, AgradCdfLogNormal_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_14, AgradCdfLogTestFixture, AgradCdfLogNormal_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_15, AgradCdfLogTestFixture, AgradCdfLogNormal_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_16, AgradCdfLogTestFixture, AgradCdfLogNormal_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_17, AgradCdfLogTestFixture, AgradCdfLogNormal_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_18, AgradCdfLogTestFixture, AgradCdfLogNormal_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_19, AgradCdfLogTestFixture, AgradCdfLogNormal_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_20, AgradCdfLogTestFixture, AgradCdfLogNormal_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_21, AgradCdfLogTestFixture, AgradCdfLogNormal_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_22, AgradCdfLogTestFixture, AgradCdfLogNormal_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_23, AgradCdfLogTestFixture, AgradCdfLogNormal_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_24, AgradCdfLogTestFixture, AgradCdfLogNormal_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_25, AgradCdfLogTestFixture, AgradCdfLogNormal_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_26, AgradCdfLogTestFixture, AgradCdfLogNormal_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_27, AgradCdfLogTestFixture, AgradCdfLogNormal_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_28, AgradCdfLogTestFixture, AgradCdfLogNormal_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_29, AgradCdfLogTestFixture, AgradCdfLogNormal_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_30, AgradCdfLogTestFixture, AgradCdfLogNormal_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_31, AgradCdfLogTestFixture, AgradCdfLogNormal_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_32, AgradCdfLogTestFixture, AgradCdfLogNormal_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_33, AgradCdfLogTestFixture, AgradCdfLogNormal_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_34, AgradCdfLogTestFixture, AgradCdfLogNormal_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_35, AgradCdfLogTestFixture, AgradCdfLogNormal_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_36, AgradCdfLogTestFixture, AgradCdfLogNormal_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_37, AgradCdfLogTestFixture, AgradCdfLogNormal_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_38, AgradCdfLogTestFixture, AgradCdfLogNormal_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_39, AgradCdfLogTestFixture, AgradCdfLogNormal_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_40, AgradCdfLogTestFixture, AgradCdfLogNormal_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_41, AgradCdfLogTestFixture, AgradCdfLogNormal_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_42, AgradCdfLogTestFixture, AgradCdfLogNormal_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_43, AgradCdfLogTestFixture, AgradCdfLogNormal_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_44, AgradCdfLogTestFixture, AgradCdfLogNormal_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_45, AgradCdfLogTestFixture, AgradCdfLogNormal_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_46, AgradCdfLogTestFixture, AgradCdfLogNormal_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_47, AgradCdfLogTestFixture, AgradCdfLogNormal_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_48, AgradCdfLogTestFixture, AgradCdfLogNormal_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_49, AgradCdfLogTestFixture, AgradCdfLogNormal_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_50, AgradCdfLogTestFixture, AgradCdfLogNormal_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_51, AgradCdfLogTestFixture, AgradCdfLogNormal_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_52, AgradCdfLogTestFixture, AgradCdfLogNormal_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_53, AgradCdfLogTestFixture, AgradCdfLogNormal_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_54, AgradCdfLogTestFixture, AgradCdfLogNormal_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_55, AgradCdfLogTestFixture, AgradCdfLogNormal_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_56, AgradCdfLogTestFixture, AgradCdfLogNormal_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_57, AgradCdfLogTestFixture, AgradCdfLogNormal_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_58, AgradCdfLogTestFixture, AgradCdfLogNormal_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_59, AgradCdfLogTestFixture, AgradCdfLogNormal_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_60, AgradCdfLogTestFixture, AgradCdfLogNormal_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_61, AgradCdfLogTestFixture, AgradCdfLogNormal_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_62, AgradCdfLogTestFixture, AgradCdfLogNormal_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_63, AgradCdfLogTestFixture, AgradCdfLogNormal_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_64, AgradCdfLogTestFixture, AgradCdfLogNormal_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_65, AgradCdfLogTestFixture, AgradCdfLogNormal_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_66, AgradCdfLogTestFixture, AgradCdfLogNormal_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_67, AgradCdfLogTestFixture, AgradCdfLogNormal_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_68, AgradCdfLogTestFixture, AgradCdfLogNormal_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_69, AgradCdfLogTestFixture, AgradCdfLogNormal_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_70, AgradCdfLogTestFixture, AgradCdfLogNormal_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_71, AgradCdfLogTestFixture, AgradCdfLogNormal_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_72, AgradCdfLogTestFixture, AgradCdfLogNormal_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_73, AgradCdfLogTestFixture, AgradCdfLogNormal_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_74, AgradCdfLogTestFixture, AgradCdfLogNormal_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_75, AgradCdfLogTestFixture, AgradCdfLogNormal_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_76, AgradCdfLogTestFixture, AgradCdfLogNormal_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_77, AgradCdfLogTestFixture, AgradCdfLogNormal_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_78, AgradCdfLogTestFixture, AgradCdfLogNormal_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_79, AgradCdfLogTestFixture, AgradCdfLogNormal_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_80, AgradCdfLogTestFixture, AgradCdfLogNormal_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_81, AgradCdfLogTestFixture, AgradCdfLogNormal_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_82, AgradCdfLogTestFixture, AgradCdfLogNormal_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_83, AgradCdfLogTestFixture, AgradCdfLogNormal_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_84, AgradCdfLogTestFixture, AgradCdfLogNormal_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_85, AgradCdfLogTestFixture, AgradCdfLogNormal_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_86, AgradCdfLogTestFixture, AgradCdfLogNormal_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_87, AgradCdfLogTestFixture, AgradCdfLogNormal_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_88, AgradCdfLogTestFixture, AgradCdfLogNormal_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_89, AgradCdfLogTestFixture, AgradCdfLogNormal_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_90, AgradCdfLogTestFixture, AgradCdfLogNormal_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_91, AgradCdfLogTestFixture, AgradCdfLogNormal_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_92, AgradCdfLogTestFixture, AgradCdfLogNormal_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_93, AgradCdfLogTestFixture, AgradCdfLogNormal_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_94, AgradCdfLogTestFixture, AgradCdfLogNormal_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_95, AgradCdfLogTestFixture, AgradCdfLogNormal_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_96, AgradCdfLogTestFixture, AgradCdfLogNormal_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_97, AgradCdfLogTestFixture, AgradCdfLogNormal_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_98, AgradCdfLogTestFixture, AgradCdfLogNormal_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_99, AgradCdfLogTestFixture, AgradCdfLogNormal_v_99);
+
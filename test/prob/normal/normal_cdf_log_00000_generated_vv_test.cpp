@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogNormal, type_vv_0> AgradCdfLogNormal_vv_0;
+typedef std::tuple<AgradCdfLogNormal, type_vv_1> AgradCdfLogNormal_vv_1;
+typedef std::tuple<AgradCdfLogNormal, type_vv_2> AgradCdfLogNormal_vv_2;
+typedef std::tuple<AgradCdfLogNormal, type_vv_3> AgradCdfLogNormal_vv_3;
+typedef std::tuple<AgradCdfLogNormal, type_vv_4> AgradCdfLogNormal_vv_4;
+typedef std::tuple<AgradCdfLogNormal, type_vv_5> AgradCdfLogNormal_vv_5;
+typedef std::tuple<AgradCdfLogNormal, type_vv_6> AgradCdfLogNormal_vv_6;
+typedef std::tuple<AgradCdfLogNormal, type_vv_7> AgradCdfLogNormal_vv_7;
+typedef std::tuple<AgradCdfLogNormal, type_vv_8> AgradCdfLogNormal_vv_8;
+typedef std::tuple<AgradCdfLogNormal, type_vv_9> AgradCdfLogNormal_vv_9;
+typedef std::tuple<AgradCdfLogNormal, type_vv_10> AgradCdfLogNormal_vv_10;
+typedef std::tuple<AgradCdfLogNormal, type_vv_11> AgradCdfLogNormal_vv_11;
+typedef std::tuple<AgradCdfLogNormal, type_vv_12> AgradCdfLogNormal_vv_12;
+typedef std::tuple<AgradCdfLogNormal, type_vv_13> AgradCdfLogNormal_vv_13;
+typedef std::tuple<AgradCdfLogNormal, type_vv_14> AgradCdfLogNormal_vv_14;
+typedef std::tuple<AgradCdfLogNormal, type_vv_15> AgradCdfLogNormal_vv_15;
+typedef std::tuple<AgradCdfLogNormal, type_vv_16> AgradCdfLogNormal_vv_16;
+typedef std::tuple<AgradCdfLogNormal, type_vv_17> AgradCdfLogNormal_vv_17;
+typedef std::tuple<AgradCdfLogNormal, type_vv_18> AgradCdfLogNormal_vv_18;
+typedef std::tuple<AgradCdfLogNormal, type_vv_19> AgradCdfLogNormal_vv_19;
+typedef std::tuple<AgradCdfLogNormal, type_vv_20> AgradCdfLogNormal_vv_20;
+typedef std::tuple<AgradCdfLogNormal, type_vv_21> AgradCdfLogNormal_vv_21;
+typedef std::tuple<AgradCdfLogNormal, type_vv_22> AgradCdfLogNormal_vv_22;
+typedef std::tuple<AgradCdfLogNormal, type_vv_23> AgradCdfLogNormal_vv_23;
+typedef std::tuple<AgradCdfLogNormal, type_vv_24> AgradCdfLogNormal_vv_24;
+typedef std::tuple<AgradCdfLogNormal, type_vv_25> AgradCdfLogNormal_vv_25;
+typedef std::tuple<AgradCdfLogNormal, type_vv_26> AgradCdfLogNormal_vv_26;
+typedef std::tuple<AgradCdfLogNormal, type_vv_27> AgradCdfLogNormal_vv_27;
+typedef std::tuple<AgradCdfLogNormal, type_vv_28> AgradCdfLogNormal_vv_28;
+typedef std::tuple<AgradCdfLogNormal, type_vv_29> AgradCdfLogNormal_vv_29;
+typedef std::tuple<AgradCdfLogNormal, type_vv_30> AgradCdfLogNormal_vv_30;
+typedef std::tuple<AgradCdfLogNormal, type_vv_31> AgradCdfLogNormal_vv_31;
+typedef std::tuple<AgradCdfLogNormal, type_vv_32> AgradCdfLogNormal_vv_32;
+typedef std::tuple<AgradCdfLogNormal, type_vv_33> AgradCdfLogNormal_vv_33;
+typedef std::tuple<AgradCdfLogNormal, type_vv_34> AgradCdfLogNormal_vv_34;
+typedef std::tuple<AgradCdfLogNormal, type_vv_35> AgradCdfLogNormal_vv_35;
+typedef std::tuple<AgradCdfLogNormal, type_vv_36> AgradCdfLogNormal_vv_36;
+typedef std::tuple<AgradCdfLogNormal, type_vv_37> AgradCdfLogNormal_vv_37;
+typedef std::tuple<AgradCdfLogNormal, type_vv_38> AgradCdfLogNormal_vv_38;
+typedef std::tuple<AgradCdfLogNormal, type_vv_39> AgradCdfLogNormal_vv_39;
+typedef std::tuple<AgradCdfLogNormal, type_vv_40> AgradCdfLogNormal_vv_40;
+typedef std::tuple<AgradCdfLogNormal, type_vv_41> AgradCdfLogNormal_vv_41;
+typedef std::tuple<AgradCdfLogNormal, type_vv_42> AgradCdfLogNormal_vv_42;
+typedef std::tuple<AgradCdfLogNormal, type_vv_43> AgradCdfLogNormal_vv_43;
+typedef std::tuple<AgradCdfLogNormal, type_vv_44> AgradCdfLogNormal_vv_44;
+typedef std::tuple<AgradCdfLogNormal, type_vv_45> AgradCdfLogNormal_vv_45;
+typedef std::tuple<AgradCdfLogNormal, type_vv_46> AgradCdfLogNormal_vv_46;
+typedef std::tuple<AgradCdfLogNormal, type_vv_47> AgradCdfLogNormal_vv_47;
+typedef std::tuple<AgradCdfLogNormal, type_vv_48> AgradCdfLogNormal_vv_48;
+typedef std::tuple<AgradCdfLogNormal, type_vv_49> AgradCdfLogNormal_vv_49;
+typedef std::tuple<AgradCdfLogNormal, type_vv_50> AgradCdfLogNormal_vv_50;
+typedef std::tuple<AgradCdfLogNormal, type_vv_51> AgradCdfLogNormal_vv_51;
+typedef std::tuple<AgradCdfLogNormal, type_vv_52> AgradCdfLogNormal_vv_52;
+typedef std::tuple<AgradCdfLogNormal, type_vv_53> AgradCdfLogNormal_vv_53;
+typedef std::tuple<AgradCdfLogNormal, type_vv_54> AgradCdfLogNormal_vv_54;
+typedef std::tuple<AgradCdfLogNormal, type_vv_55> AgradCdfLogNormal_vv_55;
+typedef std::tuple<AgradCdfLogNormal, type_vv_56> AgradCdfLogNormal_vv_56;
+typedef std::tuple<AgradCdfLogNormal, type_vv_57> AgradCdfLogNormal_vv_57;
+typedef std::tuple<AgradCdfLogNormal, type_vv_58> AgradCdfLogNormal_vv_58;
+typedef std::tuple<AgradCdfLogNormal, type_vv_59> AgradCdfLogNormal_vv_59;
+typedef std::tuple<AgradCdfLogNormal, type_vv_60> AgradCdfLogNormal_vv_60;
+typedef std::tuple<AgradCdfLogNormal, type_vv_61> AgradCdfLogNormal_vv_61;
+typedef std::tuple<AgradCdfLogNormal, type_vv_62> AgradCdfLogNormal_vv_62;
+typedef std::tuple<AgradCdfLogNormal, type_vv_63> AgradCdfLogNormal_vv_63;
+typedef std::tuple<AgradCdfLogNormal, type_vv_64> AgradCdfLogNormal_vv_64;
+typedef std::tuple<AgradCdfLogNormal, type_vv_65> AgradCdfLogNormal_vv_65;
+typedef std::tuple<AgradCdfLogNormal, type_vv_66> AgradCdfLogNormal_vv_66;
+typedef std::tuple<AgradCdfLogNormal, type_vv_67> AgradCdfLogNormal_vv_67;
+typedef std::tuple<AgradCdfLogNormal, type_vv_68> AgradCdfLogNormal_vv_68;
+typedef std::tuple<AgradCdfLogNormal, type_vv_69> AgradCdfLogNormal_vv_69;
+typedef std::tuple<AgradCdfLogNormal, type_vv_70> AgradCdfLogNormal_vv_70;
+typedef std::tuple<AgradCdfLogNormal, type_vv_71> AgradCdfLogNormal_vv_71;
+typedef std::tuple<AgradCdfLogNormal, type_vv_72> AgradCdfLogNormal_vv_72;
+typedef std::tuple<AgradCdfLogNormal, type_vv_73> AgradCdfLogNormal_vv_73;
+typedef std::tuple<AgradCdfLogNormal, type_vv_74> AgradCdfLogNormal_vv_74;
+typedef std::tuple<AgradCdfLogNormal, type_vv_75> AgradCdfLogNormal_vv_75;
+typedef std::tuple<AgradCdfLogNormal, type_vv_76> AgradCdfLogNormal_vv_76;
+typedef std::tuple<AgradCdfLogNormal, type_vv_77> AgradCdfLogNormal_vv_77;
+typedef std::tuple<AgradCdfLogNormal, type_vv_78> AgradCdfLogNormal_vv_78;
+typedef std::tuple<AgradCdfLogNormal, type_vv_79> AgradCdfLogNormal_vv_79;
+typedef std::tuple<AgradCdfLogNormal, type_vv_80> AgradCdfLogNormal_vv_80;
+typedef std::tuple<AgradCdfLogNormal, type_vv_81> AgradCdfLogNormal_vv_81;
+typedef std::tuple<AgradCdfLogNormal, type_vv_82> AgradCdfLogNormal_vv_82;
+typedef std::tuple<AgradCdfLogNormal, type_vv_83> AgradCdfLogNormal_vv_83;
+typedef std::tuple<AgradCdfLogNormal, type_vv_84> AgradCdfLogNormal_vv_84;
+typedef std::tuple<AgradCdfLogNormal, type_vv_85> AgradCdfLogNormal_vv_85;
+typedef std::tuple<AgradCdfLogNormal, type_vv_86> AgradCdfLogNormal_vv_86;
+typedef std::tuple<AgradCdfLogNormal, type_vv_87> AgradCdfLogNormal_vv_87;
+typedef std::tuple<AgradCdfLogNormal, type_vv_88> AgradCdfLogNormal_vv_88;
+typedef std::tuple<AgradCdfLogNormal, type_vv_89> AgradCdfLogNormal_vv_89;
+typedef std::tuple<AgradCdfLogNormal, type_vv_90> AgradCdfLogNormal_vv_90;
+typedef std::tuple<AgradCdfLogNormal, type_vv_91> AgradCdfLogNormal_vv_91;
+typedef std::tuple<AgradCdfLogNormal, type_vv_92> AgradCdfLogNormal_vv_92;
+typedef std::tuple<AgradCdfLogNormal, type_vv_93> AgradCdfLogNormal_vv_93;
+typedef std::tuple<AgradCdfLogNormal, type_vv_94> AgradCdfLogNormal_vv_94;
+typedef std::tuple<AgradCdfLogNormal, type_vv_95> AgradCdfLogNormal_vv_95;
+typedef std::tuple<AgradCdfLogNormal, type_vv_96> AgradCdfLogNormal_vv_96;
+typedef std::tuple<AgradCdfLogNormal, type_vv_97> AgradCdfLogNormal_vv_97;
+typedef std::tuple<AgradCdfLogNormal, type_vv_98> AgradCdfLogNormal_vv_98;
+typedef std::tuple<AgradCdfLogNormal, type_vv_99> AgradCdfLogNormal_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_0, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_1, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_2, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_3, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_4, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_5, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_6, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_7, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_8, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_9, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_10, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_11, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_12, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_13, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_14, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_15, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_16, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_17, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_18, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_19, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_20, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_21, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_22, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_23, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_24, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_25, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_26, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_27, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_28, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_29, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_30, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_31, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_32, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_33, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_34, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_35, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_36, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_37, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_38, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_39, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_40, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_41, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_42, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_43, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_44, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_45, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_46, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_47, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_48, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_49, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_50, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_51, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_52, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_53, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_54, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_55, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_56, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_57, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_58, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_59, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_60, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_61, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_62, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_63, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_64, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_65, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_66, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_67, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_68, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_69, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_70, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_71, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_72, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_73, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_74, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_75, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_76, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_77, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_78, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_79, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_80, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_81, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_82, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_83, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_84, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_85, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_86, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_87, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_88, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_89, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_90, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_91, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_92, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_93, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_94, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_95, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_96, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_97, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_98, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_99, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogNormal, type_ffv_100> AgradCdfLogNormal_ffv_100;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_101> AgradCdfLogNormal_ffv_101;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_102> AgradCdfLogNormal_ffv_102;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_103> AgradCdfLogNormal_ffv_103;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_104> AgradCdfLogNormal_ffv_104;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_105> AgradCdfLogNormal_ffv_105;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_106> AgradCdfLogNormal_ffv_106;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_107> AgradCdfLogNormal_ffv_107;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_108> AgradCdfLogNormal_ffv_108;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_109> AgradCdfLogNormal_ffv_109;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_110> AgradCdfLogNormal_ffv_110;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_111> AgradCdfLogNormal_ffv_111;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_112> AgradCdfLogNormal_ffv_112;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_113> AgradCdfLogNormal_ffv_113;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_114> AgradCdfLogNormal_ffv_114;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_115> AgradCdfLogNormal_ffv_115;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_116> AgradCdfLogNormal_ffv_116;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_117> AgradCdfLogNormal_ffv_117;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_118> AgradCdfLogNormal_ffv_118;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_119> AgradCdfLogNormal_ffv_119;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_120> AgradCdfLogNormal_ffv_120;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_121> AgradCdfLogNormal_ffv_121;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_122> AgradCdfLogNormal_ffv_122;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_123> AgradCdfLogNormal_ffv_123;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_124> AgradCdfLogNormal_ffv_124;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_125> AgradCdfLogNormal_ffv_125;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_126> AgradCdfLogNormal_ffv_126;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_127> AgradCdfLogNormal_ffv_127;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_128> AgradCdfLogNormal_ffv_128;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_129> AgradCdfLogNormal_ffv_129;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_130> AgradCdfLogNormal_ffv_130;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_131> AgradCdfLogNormal_ffv_131;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_132> AgradCdfLogNormal_ffv_132;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_133> AgradCdfLogNormal_ffv_133;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_134> AgradCdfLogNormal_ffv_134;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_135> AgradCdfLogNormal_ffv_135;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_136> AgradCdfLogNormal_ffv_136;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_137> AgradCdfLogNormal_ffv_137;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_138> AgradCdfLogNormal_ffv_138;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_139> AgradCdfLogNormal_ffv_139;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_140> AgradCdfLogNormal_ffv_140;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_141> AgradCdfLogNormal_ffv_141;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_142> AgradCdfLogNormal_ffv_142;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_143> AgradCdfLogNormal_ffv_143;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_144> AgradCdfLogNormal_ffv_144;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_145> AgradCdfLogNormal_ffv_145;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_146> AgradCdfLogNormal_ffv_146;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_147> AgradCdfLogNormal_ffv_147;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_148> AgradCdfLogNormal_ffv_148;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_149> AgradCdfLogNormal_ffv_149;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_150> AgradCdfLogNormal_ffv_150;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_151> AgradCdfLogNormal_ffv_151;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_152> AgradCdfLogNormal_ffv_152;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_153> AgradCdfLogNormal_ffv_153;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_154> AgradCdfLogNormal_ffv_154;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_155> AgradCdfLogNormal_ffv_155;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_156> AgradCdfLogNormal_ffv_156;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_157> AgradCdfLogNormal_ffv_157;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_158> AgradCdfLogNormal_ffv_158;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_159> AgradCdfLogNormal_ffv_159;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_160> AgradCdfLogNormal_ffv_160;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_161> AgradCdfLogNormal_ffv_161;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_162> AgradCdfLogNormal_ffv_162;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_163> AgradCdfLogNormal_ffv_163;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_164> AgradCdfLogNormal_ffv_164;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_165> AgradCdfLogNormal_ffv_165;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_166> AgradCdfLogNormal_ffv_166;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_167> AgradCdfLogNormal_ffv_167;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_168> AgradCdfLogNormal_ffv_168;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_169> AgradCdfLogNormal_ffv_169;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_170> AgradCdfLogNormal_ffv_170;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_171> AgradCdfLogNormal_ffv_171;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_172> AgradCdfLogNormal_ffv_172;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_173> AgradCdfLogNormal_ffv_173;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_174> AgradCdfLogNormal_ffv_174;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_175> AgradCdfLogNormal_ffv_175;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_176> AgradCdfLogNormal_ffv_176;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_177> AgradCdfLogNormal_ffv_177;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_178> AgradCdfLogNormal_ffv_178;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_179> AgradCdfLogNormal_ffv_179;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_180> AgradCdfLogNormal_ffv_180;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_181> AgradCdfLogNormal_ffv_181;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_182> AgradCdfLogNormal_ffv_182;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_183> AgradCdfLogNormal_ffv_183;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_184> AgradCdfLogNormal_ffv_184;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_185> AgradCdfLogNormal_ffv_185;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_186> AgradCdfLogNormal_ffv_186;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_187> AgradCdfLogNormal_ffv_187;
+typedef std::tuple<AgradCdfLogNormal, type_ffv_188> AgradCdfLogNormal_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_100, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_101, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_102, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_103, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_104, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_105, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_106, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_107, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_108, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_109, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_110, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_111, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_112, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_113, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_114, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_115, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_116, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_117, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_118, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_119, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_120, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_121, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_122, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_123, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_124, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_125, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_126, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_127, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_128, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_129, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_130, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_131, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_132, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_133, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_134, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_135, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_136, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_137, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_138, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_139, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_140, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_141, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_142, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_143, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_144, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_145, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_146, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_147, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_148, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_149, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_150, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_151, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_152, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_153, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_154, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_155, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_156, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_157, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_158, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_159, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_160, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_161, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_162, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_163, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_164, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_165, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_166, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_167, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_168, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_169, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_170, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_171, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_172, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_173, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_174, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_175, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_176, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_177, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_178, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_179, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_180, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_181, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_182, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_183, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_184, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_185, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_186, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_187, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_ffv_188, AgradCdfLogTestFixture, AgradCdfLogNormal_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogNormal, type_v_100> AgradCdfLogNormal_v_100;
+typedef std::tuple<AgradCdfLogNormal, type_v_101> AgradCdfLogNormal_v_101;
+typedef std::tuple<AgradCdfLogNormal, type_v_102> AgradCdfLogNormal_v_102;
+typedef std::tuple<AgradCdfLogNormal, type_v_103> AgradCdfLogNormal_v_103;
+typedef std::tuple<AgradCdfLogNormal, type_v_104> AgradCdfLogNormal_v_104;
+typedef std::tuple<AgradCdfLogNormal, type_v_105> AgradCdfLogNormal_v_105;
+typedef std::tuple<AgradCdfLogNormal, type_v_106> AgradCdfLogNormal_v_106;
+typedef std::tuple<AgradCdfLogNormal, type_v_107> AgradCdfLogNormal_v_107;
+typedef std::tuple<AgradCdfLogNormal, type_v_108> AgradCdfLogNormal_v_108;
+typedef std::tuple<AgradCdfLogNormal, type_v_109> AgradCdfLogNormal_v_109;
+typedef std::tuple<AgradCdfLogNormal, type_v_110> AgradCdfLogNormal_v_110;
+typedef std::tuple<AgradCdfLogNormal, type_v_111> AgradCdfLogNormal_v_111;
+typedef std::tuple<AgradCdfLogNormal, type_v_112> AgradCdfLogNormal_v_112;
+typedef std::tuple<AgradCdfLogNormal, type_v_113> AgradCdfLogNormal_v_113;
+typedef std::tuple<AgradCdfLogNormal, type_v_114> AgradCdfLogNormal_v_114;
+typedef std::tuple<AgradCdfLogNormal, type_v_115> AgradCdfLogNormal_v_115;
+typedef std::tuple<AgradCdfLogNormal, type_v_116> AgradCdfLogNormal_v_116;
+typedef std::tuple<AgradCdfLogNormal, type_v_117> AgradCdfLogNormal_v_117;
+typedef std::tuple<AgradCdfLogNormal, type_v_118> AgradCdfLogNormal_v_118;
+typedef std::tuple<AgradCdfLogNormal, type_v_119> AgradCdfLogNormal_v_119;
+typedef std::tuple<AgradCdfLogNormal, type_v_120> AgradCdfLogNormal_v_120;
+typedef std::tuple<AgradCdfLogNormal, type_v_121> AgradCdfLogNormal_v_121;
+typedef std::tuple<AgradCdfLogNormal, type_v_122> AgradCdfLogNormal_v_122;
+typedef std::tuple<AgradCdfLogNormal, type_v_123> AgradCdfLogNormal_v_123;
+typedef std::tuple<AgradCdfLogNormal, type_v_124> AgradCdfLogNormal_v_124;
+typedef std::tuple<AgradCdfLogNormal, type_v_125> AgradCdfLogNormal_v_125;
+typedef std::tuple<AgradCdfLogNormal, type_v_126> AgradCdfLogNormal_v_126;
+typedef std::tuple<AgradCdfLogNormal, type_v_127> AgradCdfLogNormal_v_127;
+typedef std::tuple<AgradCdfLogNormal, type_v_128> AgradCdfLogNormal_v_128;
+typedef std::tuple<AgradCdfLogNormal, type_v_129> AgradCdfLogNormal_v_129;
+typedef std::tuple<AgradCdfLogNormal, type_v_130> AgradCdfLogNormal_v_130;
+typedef std::tuple<AgradCdfLogNormal, type_v_131> AgradCdfLogNormal_v_131;
+typedef std::tuple<AgradCdfLogNormal, type_v_132> AgradCdfLogNormal_v_132;
+typedef std::tuple<AgradCdfLogNormal, type_v_133> AgradCdfLogNormal_v_133;
+typedef std::tuple<AgradCdfLogNormal, type_v_134> AgradCdfLogNormal_v_134;
+typedef std::tuple<AgradCdfLogNormal, type_v_135> AgradCdfLogNormal_v_135;
+typedef std::tuple<AgradCdfLogNormal, type_v_136> AgradCdfLogNormal_v_136;
+typedef std::tuple<AgradCdfLogNormal, type_v_137> AgradCdfLogNormal_v_137;
+typedef std::tuple<AgradCdfLogNormal, type_v_138> AgradCdfLogNormal_v_138;
+typedef std::tuple<AgradCdfLogNormal, type_v_139> AgradCdfLogNormal_v_139;
+typedef std::tuple<AgradCdfLogNormal, type_v_140> AgradCdfLogNormal_v_140;
+typedef std::tuple<AgradCdfLogNormal, type_v_141> AgradCdfLogNormal_v_141;
+typedef std::tuple<AgradCdfLogNormal, type_v_142> AgradCdfLogNormal_v_142;
+typedef std::tuple<AgradCdfLogNormal, type_v_143> AgradCdfLogNormal_v_143;
+typedef std::tuple<AgradCdfLogNormal, type_v_144> AgradCdfLogNormal_v_144;
+typedef std::tuple<AgradCdfLogNormal, type_v_145> AgradCdfLogNormal_v_145;
+typedef std::tuple<AgradCdfLogNormal, type_v_146> AgradCdfLogNormal_v_146;
+typedef std::tuple<AgradCdfLogNormal, type_v_147> AgradCdfLogNormal_v_147;
+typedef std::tuple<AgradCdfLogNormal, type_v_148> AgradCdfLogNormal_v_148;
+typedef std::tuple<AgradCdfLogNormal, type_v_149> AgradCdfLogNormal_v_149;
+typedef std::tuple<AgradCdfLogNormal, type_v_150> AgradCdfLogNormal_v_150;
+typedef std::tuple<AgradCdfLogNormal, type_v_151> AgradCdfLogNormal_v_151;
+typedef std::tuple<AgradCdfLogNormal, type_v_152> AgradCdfLogNormal_v_152;
+typedef std::tuple<AgradCdfLogNormal, type_v_153> AgradCdfLogNormal_v_153;
+typedef std::tuple<AgradCdfLogNormal, type_v_154> AgradCdfLogNormal_v_154;
+typedef std::tuple<AgradCdfLogNormal, type_v_155> AgradCdfLogNormal_v_155;
+typedef std::tuple<AgradCdfLogNormal, type_v_156> AgradCdfLogNormal_v_156;
+typedef std::tuple<AgradCdfLogNormal, type_v_157> AgradCdfLogNormal_v_157;
+typedef std::tuple<AgradCdfLogNormal, type_v_158> AgradCdfLogNormal_v_158;
+typedef std::tuple<AgradCdfLogNormal, type_v_159> AgradCdfLogNormal_v_159;
+typedef std::tuple<AgradCdfLogNormal, type_v_160> AgradCdfLogNormal_v_160;
+typedef std::tuple<AgradCdfLogNormal, type_v_161> AgradCdfLogNormal_v_161;
+typedef std::tuple<AgradCdfLogNormal, type_v_162> AgradCdfLogNormal_v_162;
+typedef std::tuple<AgradCdfLogNormal, type_v_163> AgradCdfLogNormal_v_163;
+typedef std::tuple<AgradCdfLogNormal, type_v_164> AgradCdfLogNormal_v_164;
+typedef std::tuple<AgradCdfLogNormal, type_v_165> AgradCdfLogNormal_v_165;
+typedef std::tuple<AgradCdfLogNormal, type_v_166> AgradCdfLogNormal_v_166;
+typedef std::tuple<AgradCdfLogNormal, type_v_167> AgradCdfLogNormal_v_167;
+typedef std::tuple<AgradCdfLogNormal, type_v_168> AgradCdfLogNormal_v_168;
+typedef std::tuple<AgradCdfLogNormal, type_v_169> AgradCdfLogNormal_v_169;
+typedef std::tuple<AgradCdfLogNormal, type_v_170> AgradCdfLogNormal_v_170;
+typedef std::tuple<AgradCdfLogNormal, type_v_171> AgradCdfLogNormal_v_171;
+typedef std::tuple<AgradCdfLogNormal, type_v_172> AgradCdfLogNormal_v_172;
+typedef std::tuple<AgradCdfLogNormal, type_v_173> AgradCdfLogNormal_v_173;
+typedef std::tuple<AgradCdfLogNormal, type_v_174> AgradCdfLogNormal_v_174;
+typedef std::tuple<AgradCdfLogNormal, type_v_175> AgradCdfLogNormal_v_175;
+typedef std::tuple<AgradCdfLogNormal, type_v_176> AgradCdfLogNormal_v_176;
+typedef std::tuple<AgradCdfLogNormal, type_v_177> AgradCdfLogNormal_v_177;
+typedef std::tuple<AgradCdfLogNormal, type_v_178> AgradCdfLogNormal_v_178;
+typedef std::tuple<AgradCdfLogNormal, type_v_179> AgradCdfLogNormal_v_179;
+typedef std::tuple<AgradCdfLogNormal, type_v_180> AgradCdfLogNormal_v_180;
+typedef std::tuple<AgradCdfLogNormal, type_v_181> AgradCdfLogNormal_v_181;
+typedef std::tuple<AgradCdfLogNormal, type_v_182> AgradCdfLogNormal_v_182;
+typedef std::tuple<AgradCdfLogNormal, type_v_183> AgradCdfLogNormal_v_183;
+typedef std::tuple<AgradCdfLogNormal, type_v_184> AgradCdfLogNormal_v_184;
+typedef std::tuple<AgradCdfLogNormal, type_v_185> AgradCdfLogNormal_v_185;
+typedef std::tuple<AgradCdfLogNormal, type_v_186> AgradCdfLogNormal_v_186;
+typedef std::tuple<AgradCdfLogNormal, type_v_187> AgradCdfLogNormal_v_187;
+typedef std::tuple<AgradCdfLogNormal, type_v_188> AgradCdfLogNormal_v_188;
+typedef std::tuple<AgradCdfLogNormal, type_v_189> AgradCdfLogNormal_v_189;
+typedef std::tuple<AgradCdfLogNormal, type_v_190> AgradCdfLogNormal_v_190;
+typedef std::tuple<AgradCdfLogNormal, type_v_191> AgradCdfLogNormal_v_191;
+typedef std::tuple<AgradCdfLogNormal, type_v_192> AgradCdfLogNormal_v_192;
+typedef std::tuple<AgradCdfLogNormal, type_v_193> AgradCdfLogNormal_v_193;
+typedef std::tuple<AgradCdfLogNormal, type_v_194> AgradCdfLogNormal_v_194;
+typedef std::tuple<AgradCdfLogNormal, type_v_195> AgradCdfLogNormal_v_195;
+typedef std::tuple<AgradCdfLogNormal, type_v_196> AgradCdfLogNormal_v_196;
+typedef std::tuple<AgradCdfLogNormal, type_v_197> AgradCdfLogNormal_v_197;
+typedef std::tuple<AgradCdfLogNormal, type_v_198> AgradCdfLogNormal_v_198;
+typedef std::tuple<AgradCdfLogNormal, type_v_199> AgradCdfLogNormal_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_100, AgradCdfLogTestFixture, AgradCdfLogNormal_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_101, AgradCdfLogTestFixture, AgradCdfLogNormal_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_102, AgradCdfLogTestFixture, AgradCdfLogNormal_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_103, AgradCdfLogTestFixture, AgradCdfLogNormal_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_104, AgradCdfLogTestFixture, AgradCdfLogNormal_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_105, AgradCdfLogTestFixture, AgradCdfLogNormal_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_106, AgradCdfLogTestFixture, AgradCdfLogNormal_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_107, AgradCdfLogTestFixture, AgradCdfLogNormal_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_108, AgradCdfLogTestFixture, AgradCdfLogNormal_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_109, AgradCdfLogTestFixture, AgradCdfLogNormal_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_110, AgradCdfLogTestFixture, AgradCdfLogNormal_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_111, AgradCdfLogTestFixture, AgradCdfLogNormal_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_112, AgradCdfLogTestFixture, AgradCdfLogNormal_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_113, AgradCdfLogTestFixture, AgradCdfLogNormal_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_114, AgradCdfLogTestFixture, AgradCdfLogNormal_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_115, AgradCdfLogTestFixture, AgradCdfLogNormal_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_116, AgradCdfLogTestFixture, AgradCdfLogNormal_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_117, AgradCdfLogTestFixture, AgradCdfLogNormal_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_118, AgradCdfLogTestFixture, AgradCdfLogNormal_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_119, AgradCdfLogTestFixture, AgradCdfLogNormal_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_120, AgradCdfLogTestFixture, AgradCdfLogNormal_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_121, AgradCdfLogTestFixture, AgradCdfLogNormal_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_122, AgradCdfLogTestFixture, AgradCdfLogNormal_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_123, AgradCdfLogTestFixture, AgradCdfLogNormal_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_124, AgradCdfLogTestFixture, AgradCdfLogNormal_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_125, AgradCdfLogTestFixture, AgradCdfLogNormal_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_126, AgradCdfLogTestFixture, AgradCdfLogNormal_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_127, AgradCdfLogTestFixture, AgradCdfLogNormal_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_128, AgradCdfLogTestFixture, AgradCdfLogNormal_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_129, AgradCdfLogTestFixture, AgradCdfLogNormal_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_130, AgradCdfLogTestFixture, AgradCdfLogNormal_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_131, AgradCdfLogTestFixture, AgradCdfLogNormal_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_132, AgradCdfLogTestFixture, AgradCdfLogNormal_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_133, AgradCdfLogTestFixture, AgradCdfLogNormal_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_134, AgradCdfLogTestFixture, AgradCdfLogNormal_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_135, AgradCdfLogTestFixture, AgradCdfLogNormal_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_136, AgradCdfLogTestFixture, AgradCdfLogNormal_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_137, AgradCdfLogTestFixture, AgradCdfLogNormal_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_138, AgradCdfLogTestFixture, AgradCdfLogNormal_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_139, AgradCdfLogTestFixture, AgradCdfLogNormal_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_140, AgradCdfLogTestFixture, AgradCdfLogNormal_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_141, AgradCdfLogTestFixture, AgradCdfLogNormal_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_142, AgradCdfLogTestFixture, AgradCdfLogNormal_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_143, AgradCdfLogTestFixture, AgradCdfLogNormal_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_144, AgradCdfLogTestFixture, AgradCdfLogNormal_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_145, AgradCdfLogTestFixture, AgradCdfLogNormal_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_146, AgradCdfLogTestFixture, AgradCdfLogNormal_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_147, AgradCdfLogTestFixture, AgradCdfLogNormal_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_148, AgradCdfLogTestFixture, AgradCdfLogNormal_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_149, AgradCdfLogTestFixture, AgradCdfLogNormal_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_150, AgradCdfLogTestFixture, AgradCdfLogNormal_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_151, AgradCdfLogTestFixture, AgradCdfLogNormal_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_152, AgradCdfLogTestFixture, AgradCdfLogNormal_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_153, AgradCdfLogTestFixture, AgradCdfLogNormal_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_154, AgradCdfLogTestFixture, AgradCdfLogNormal_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_155, AgradCdfLogTestFixture, AgradCdfLogNormal_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_156, AgradCdfLogTestFixture, AgradCdfLogNormal_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_157, AgradCdfLogTestFixture, AgradCdfLogNormal_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_158, AgradCdfLogTestFixture, AgradCdfLogNormal_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_159, AgradCdfLogTestFixture, AgradCdfLogNormal_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_160, AgradCdfLogTestFixture, AgradCdfLogNormal_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_161, AgradCdfLogTestFixture, AgradCdfLogNormal_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_162, AgradCdfLogTestFixture, AgradCdfLogNormal_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_163, AgradCdfLogTestFixture, AgradCdfLogNormal_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_164, AgradCdfLogTestFixture, AgradCdfLogNormal_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_165, AgradCdfLogTestFixture, AgradCdfLogNormal_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_166, AgradCdfLogTestFixture, AgradCdfLogNormal_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_167, AgradCdfLogTestFixture, AgradCdfLogNormal_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_168, AgradCdfLogTestFixture, AgradCdfLogNormal_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_169, AgradCdfLogTestFixture, AgradCdfLogNormal_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_170, AgradCdfLogTestFixture, AgradCdfLogNormal_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_171, AgradCdfLogTestFixture, AgradCdfLogNormal_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_172, AgradCdfLogTestFixture, AgradCdfLogNormal_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_173, AgradCdfLogTestFixture, AgradCdfLogNormal_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_174, AgradCdfLogTestFixture, AgradCdfLogNormal_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_175, AgradCdfLogTestFixture, AgradCdfLogNormal_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_176, AgradCdfLogTestFixture, AgradCdfLogNormal_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_177, AgradCdfLogTestFixture, AgradCdfLogNormal_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_178, AgradCdfLogTestFixture, AgradCdfLogNormal_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_179, AgradCdfLogTestFixture, AgradCdfLogNormal_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_180, AgradCdfLogTestFixture, AgradCdfLogNormal_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_181, AgradCdfLogTestFixture, AgradCdfLogNormal_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_182, AgradCdfLogTestFixture, AgradCdfLogNormal_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_183, AgradCdfLogTestFixture, AgradCdfLogNormal_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_184, AgradCdfLogTestFixture, AgradCdfLogNormal_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_185, AgradCdfLogTestFixture, AgradCdfLogNormal_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_186, AgradCdfLogTestFixture, AgradCdfLogNormal_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_187, AgradCdfLogTestFixture, AgradCdfLogNormal_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_188, AgradCdfLogTestFixture, AgradCdfLogNormal_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_189, AgradCdfLogTestFixture, AgradCdfLogNormal_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_190, AgradCdfLogTestFixture, AgradCdfLogNormal_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_191, AgradCdfLogTestFixture, AgradCdfLogNormal_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_192, AgradCdfLogTestFixture, AgradCdfLogNormal_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_193, AgradCdfLogTestFixture, AgradCdfLogNormal_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_194, AgradCdfLogTestFixture, AgradCdfLogNormal_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_195, AgradCdfLogTestFixture, AgradCdfLogNormal_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_196, AgradCdfLogTestFixture, AgradCdfLogNormal_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_197, AgradCdfLogTestFixture, AgradCdfLogNormal_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_198, AgradCdfLogTestFixture, AgradCdfLogNormal_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_199, AgradCdfLogTestFixture, AgradCdfLogNormal_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogNormal, type_vv_100> AgradCdfLogNormal_vv_100;
+typedef std::tuple<AgradCdfLogNormal, type_vv_101> AgradCdfLogNormal_vv_101;
+typedef std::tuple<AgradCdfLogNormal, type_vv_102> AgradCdfLogNormal_vv_102;
+typedef std::tuple<AgradCdfLogNormal, type_vv_103> AgradCdfLogNormal_vv_103;
+typedef std::tuple<AgradCdfLogNormal, type_vv_104> AgradCdfLogNormal_vv_104;
+typedef std::tuple<AgradCdfLogNormal, type_vv_105> AgradCdfLogNormal_vv_105;
+typedef std::tuple<AgradCdfLogNormal, type_vv_106> AgradCdfLogNormal_vv_106;
+typedef std::tuple<AgradCdfLogNormal, type_vv_107> AgradCdfLogNormal_vv_107;
+typedef std::tuple<AgradCdfLogNormal, type_vv_108> AgradCdfLogNormal_vv_108;
+typedef std::tuple<AgradCdfLogNormal, type_vv_109> AgradCdfLogNormal_vv_109;
+typedef std::tuple<AgradCdfLogNormal, type_vv_110> AgradCdfLogNormal_vv_110;
+typedef std::tuple<AgradCdfLogNormal, type_vv_111> AgradCdfLogNormal_vv_111;
+typedef std::tuple<AgradCdfLogNormal, type_vv_112> AgradCdfLogNormal_vv_112;
+typedef std::tuple<AgradCdfLogNormal, type_vv_113> AgradCdfLogNormal_vv_113;
+typedef std::tuple<AgradCdfLogNormal, type_vv_114> AgradCdfLogNormal_vv_114;
+typedef std::tuple<AgradCdfLogNormal, type_vv_115> AgradCdfLogNormal_vv_115;
+typedef std::tuple<AgradCdfLogNormal, type_vv_116> AgradCdfLogNormal_vv_116;
+typedef std::tuple<AgradCdfLogNormal, type_vv_117> AgradCdfLogNormal_vv_117;
+typedef std::tuple<AgradCdfLogNormal, type_vv_118> AgradCdfLogNormal_vv_118;
+typedef std::tuple<AgradCdfLogNormal, type_vv_119> AgradCdfLogNormal_vv_119;
+typedef std::tuple<AgradCdfLogNormal, type_vv_120> AgradCdfLogNormal_vv_120;
+typedef std::tuple<AgradCdfLogNormal, type_vv_121> AgradCdfLogNormal_vv_121;
+typedef std::tuple<AgradCdfLogNormal, type_vv_122> AgradCdfLogNormal_vv_122;
+typedef std::tuple<AgradCdfLogNormal, type_vv_123> AgradCdfLogNormal_vv_123;
+typedef std::tuple<AgradCdfLogNormal, type_vv_124> AgradCdfLogNormal_vv_124;
+typedef std::tuple<AgradCdfLogNormal, type_vv_125> AgradCdfLogNormal_vv_125;
+typedef std::tuple<AgradCdfLogNormal, type_vv_126> AgradCdfLogNormal_vv_126;
+typedef std::tuple<AgradCdfLogNormal, type_vv_127> AgradCdfLogNormal_vv_127;
+typedef std::tuple<AgradCdfLogNormal, type_vv_128> AgradCdfLogNormal_vv_128;
+typedef std::tuple<AgradCdfLogNormal, type_vv_129> AgradCdfLogNormal_vv_129;
+typedef std::tuple<AgradCdfLogNormal, type_vv_130> AgradCdfLogNormal_vv_130;
+typedef std::tuple<AgradCdfLogNormal, type_vv_131> AgradCdfLogNormal_vv_131;
+typedef std::tuple<AgradCdfLogNormal, type_vv_132> AgradCdfLogNormal_vv_132;
+typedef std::tuple<AgradCdfLogNormal, type_vv_133> AgradCdfLogNormal_vv_133;
+typedef std::tuple<AgradCdfLogNormal, type_vv_134> AgradCdfLogNormal_vv_134;
+typedef std::tuple<AgradCdfLogNormal, type_vv_135> AgradCdfLogNormal_vv_135;
+typedef std::tuple<AgradCdfLogNormal, type_vv_136> AgradCdfLogNormal_vv_136;
+typedef std::tuple<AgradCdfLogNormal, type_vv_137> AgradCdfLogNormal_vv_137;
+typedef std::tuple<AgradCdfLogNormal, type_vv_138> AgradCdfLogNormal_vv_138;
+typedef std::tuple<AgradCdfLogNormal, type_vv_139> AgradCdfLogNormal_vv_139;
+typedef std::tuple<AgradCdfLogNormal, type_vv_140> AgradCdfLogNormal_vv_140;
+typedef std::tuple<AgradCdfLogNormal, type_vv_141> AgradCdfLogNormal_vv_141;
+typedef std::tuple<AgradCdfLogNormal, type_vv_142> AgradCdfLogNormal_vv_142;
+typedef std::tuple<AgradCdfLogNormal, type_vv_143> AgradCdfLogNormal_vv_143;
+typedef std::tuple<AgradCdfLogNormal, type_vv_144> AgradCdfLogNormal_vv_144;
+typedef std::tuple<AgradCdfLogNormal, type_vv_145> AgradCdfLogNormal_vv_145;
+typedef std::tuple<AgradCdfLogNormal, type_vv_146> AgradCdfLogNormal_vv_146;
+typedef std::tuple<AgradCdfLogNormal, type_vv_147> AgradCdfLogNormal_vv_147;
+typedef std::tuple<AgradCdfLogNormal, type_vv_148> AgradCdfLogNormal_vv_148;
+typedef std::tuple<AgradCdfLogNormal, type_vv_149> AgradCdfLogNormal_vv_149;
+typedef std::tuple<AgradCdfLogNormal, type_vv_150> AgradCdfLogNormal_vv_150;
+typedef std::tuple<AgradCdfLogNormal, type_vv_151> AgradCdfLogNormal_vv_151;
+typedef std::tuple<AgradCdfLogNormal, type_vv_152> AgradCdfLogNormal_vv_152;
+typedef std::tuple<AgradCdfLogNormal, type_vv_153> AgradCdfLogNormal_vv_153;
+typedef std::tuple<AgradCdfLogNormal, type_vv_154> AgradCdfLogNormal_vv_154;
+typedef std::tuple<AgradCdfLogNormal, type_vv_155> AgradCdfLogNormal_vv_155;
+typedef std::tuple<AgradCdfLogNormal, type_vv_156> AgradCdfLogNormal_vv_156;
+typedef std::tuple<AgradCdfLogNormal, type_vv_157> AgradCdfLogNormal_vv_157;
+typedef std::tuple<AgradCdfLogNormal, type_vv_158> AgradCdfLogNormal_vv_158;
+typedef std::tuple<AgradCdfLogNormal, type_vv_159> AgradCdfLogNormal_vv_159;
+typedef std::tuple<AgradCdfLogNormal, type_vv_160> AgradCdfLogNormal_vv_160;
+typedef std::tuple<AgradCdfLogNormal, type_vv_161> AgradCdfLogNormal_vv_161;
+typedef std::tuple<AgradCdfLogNormal, type_vv_162> AgradCdfLogNormal_vv_162;
+typedef std::tuple<AgradCdfLogNormal, type_vv_163> AgradCdfLogNormal_vv_163;
+typedef std::tuple<AgradCdfLogNormal, type_vv_164> AgradCdfLogNormal_vv_164;
+typedef std::tuple<AgradCdfLogNormal, type_vv_165> AgradCdfLogNormal_vv_165;
+typedef std::tuple<AgradCdfLogNormal, type_vv_166> AgradCdfLogNormal_vv_166;
+typedef std::tuple<AgradCdfLogNormal, type_vv_167> AgradCdfLogNormal_vv_167;
+typedef std::tuple<AgradCdfLogNormal, type_vv_168> AgradCdfLogNormal_vv_168;
+typedef std::tuple<AgradCdfLogNormal, type_vv_169> AgradCdfLogNormal_vv_169;
+typedef std::tuple<AgradCdfLogNormal, type_vv_170> AgradCdfLogNormal_vv_170;
+typedef std::tuple<AgradCdfLogNormal, type_vv_171> AgradCdfLogNormal_vv_171;
+typedef std::tuple<AgradCdfLogNormal, type_vv_172> AgradCdfLogNormal_vv_172;
+typedef std::tuple<AgradCdfLogNormal, type_vv_173> AgradCdfLogNormal_vv_173;
+typedef std::tuple<AgradCdfLogNormal, type_vv_174> AgradCdfLogNormal_vv_174;
+typedef std::tuple<AgradCdfLogNormal, type_vv_175> AgradCdfLogNormal_vv_175;
+typedef std::tuple<AgradCdfLogNormal, type_vv_176> AgradCdfLogNormal_vv_176;
+typedef std::tuple<AgradCdfLogNormal, type_vv_177> AgradCdfLogNormal_vv_177;
+typedef std::tuple<AgradCdfLogNormal, type_vv_178> AgradCdfLogNormal_vv_178;
+typedef std::tuple<AgradCdfLogNormal, type_vv_179> AgradCdfLogNormal_vv_179;
+typedef std::tuple<AgradCdfLogNormal, type_vv_180> AgradCdfLogNormal_vv_180;
+typedef std::tuple<AgradCdfLogNormal, type_vv_181> AgradCdfLogNormal_vv_181;
+typedef std::tuple<AgradCdfLogNormal, type_vv_182> AgradCdfLogNormal_vv_182;
+typedef std::tuple<AgradCdfLogNormal, type_vv_183> AgradCdfLogNormal_vv_183;
+typedef std::tuple<AgradCdfLogNormal, type_vv_184> AgradCdfLogNormal_vv_184;
+typedef std::tuple<AgradCdfLogNormal, type_vv_185> AgradCdfLogNormal_vv_185;
+typedef std::tuple<AgradCdfLogNormal, type_vv_186> AgradCdfLogNormal_vv_186;
+typedef std::tuple<AgradCdfLogNormal, type_vv_187> AgradCdfLogNormal_vv_187;
+typedef std::tuple<AgradCdfLogNormal, type_vv_188> AgradCdfLogNormal_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_100, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_101, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_102, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_103, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_104, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_105, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_106, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_107, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_108, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_109, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_110, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_111, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_112, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_113, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_114, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_115, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_116, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_117, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_118, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_119, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_120, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_121, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_122, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_123, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_124, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_125, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_126, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_127, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_128, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_129, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_130, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_131, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_132, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_133, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_134, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_135, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_136, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_137, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_138, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_139, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_140, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_141, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_142, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_143, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_144, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_145, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_146, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_147, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_148, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_149, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_150, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_151, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_152, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_153, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_154, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_155, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_156, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_157, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_158, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_159, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_160, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_161, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_162, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_163, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_164, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_165, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_166, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_167, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_168, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_169, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_170, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_171, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_172, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_173, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_174, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_175, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_176, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_177, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_178, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_179, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_180, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_181, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_182, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_183, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_184, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_185, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_186, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_187, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_vv_188, AgradCdfLogTestFixture, AgradCdfLogNormal_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal/normal_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCdfLogNormal, type_v_200> AgradCdfLogNormal_v_200;
+typedef std::tuple<AgradCdfLogNormal, type_v_201> AgradCdfLogNormal_v_201;
+typedef std::tuple<AgradCdfLogNormal, type_v_202> AgradCdfLogNormal_v_202;
+typedef std::tuple<AgradCdfLogNormal, type_v_203> AgradCdfLogNormal_v_203;
+typedef std::tuple<AgradCdfLogNormal, type_v_204> AgradCdfLogNormal_v_204;
+typedef std::tuple<AgradCdfLogNormal, type_v_205> AgradCdfLogNormal_v_205;
+typedef std::tuple<AgradCdfLogNormal, type_v_206> AgradCdfLogNormal_v_206;
+typedef std::tuple<AgradCdfLogNormal, type_v_207> AgradCdfLogNormal_v_207;
+typedef std::tuple<AgradCdfLogNormal, type_v_208> AgradCdfLogNormal_v_208;
+typedef std::tuple<AgradCdfLogNormal, type_v_209> AgradCdfLogNormal_v_209;
+typedef std::tuple<AgradCdfLogNormal, type_v_210> AgradCdfLogNormal_v_210;
+typedef std::tuple<AgradCdfLogNormal, type_v_211> AgradCdfLogNormal_v_211;
+typedef std::tuple<AgradCdfLogNormal, type_v_212> AgradCdfLogNormal_v_212;
+typedef std::tuple<AgradCdfLogNormal, type_v_213> AgradCdfLogNormal_v_213;
+typedef std::tuple<AgradCdfLogNormal, type_v_214> AgradCdfLogNormal_v_214;
+typedef std::tuple<AgradCdfLogNormal, type_v_215> AgradCdfLogNormal_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_200, AgradCdfLogTestFixture, AgradCdfLogNormal_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_201, AgradCdfLogTestFixture, AgradCdfLogNormal_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_202, AgradCdfLogTestFixture, AgradCdfLogNormal_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_203, AgradCdfLogTestFixture, AgradCdfLogNormal_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_204, AgradCdfLogTestFixture, AgradCdfLogNormal_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_205, AgradCdfLogTestFixture, AgradCdfLogNormal_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_206, AgradCdfLogTestFixture, AgradCdfLogNormal_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_207, AgradCdfLogTestFixture, AgradCdfLogNormal_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_208, AgradCdfLogTestFixture, AgradCdfLogNormal_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_209, AgradCdfLogTestFixture, AgradCdfLogNormal_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_210, AgradCdfLogTestFixture, AgradCdfLogNormal_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_211, AgradCdfLogTestFixture, AgradCdfLogNormal_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_212, AgradCdfLogTestFixture, AgradCdfLogNormal_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_213, AgradCdfLogTestFixture, AgradCdfLogNormal_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_214, AgradCdfLogTestFixture, AgradCdfLogNormal_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogNormal_v_215, AgradCdfLogTestFixture, AgradCdfLogNormal_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, double, int, double, fvar<fvar<var> >, empty> type_ffv_0;
+typedef std::tuple<double, double, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1;
+typedef std::tuple<double, double, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2;
+typedef std::tuple<double, double, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3;
+typedef std::tuple<double, double, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_4;
+typedef std::tuple<double, double, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_5;
+typedef std::tuple<double, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_6;
+typedef std::tuple<double, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_7;
+typedef std::tuple<double, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_8;
+typedef std::tuple<double, double, int, fvar<fvar<var> >, double, empty> type_ffv_9;
+typedef std::tuple<double, double, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_10;
+typedef std::tuple<double, double, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_11;
+typedef std::tuple<double, double, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_12;
+typedef std::tuple<double, double, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_13;
+typedef std::tuple<double, double, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_14;
+typedef std::tuple<double, double, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_15;
+typedef std::tuple<double, double, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_16;
+typedef std::tuple<double, double, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_17;
+typedef std::tuple<double, double, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_18;
+typedef std::tuple<double, double, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_19;
+typedef std::tuple<double, double, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_20;
+typedef std::tuple<double, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_21;
+typedef std::tuple<double, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_22;
+typedef std::tuple<double, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_23;
+typedef std::tuple<double, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_24;
+typedef std::tuple<double, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_25;
+typedef std::tuple<double, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_26;
+typedef std::tuple<double, double, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_27;
+typedef std::tuple<double, double, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_28;
+typedef std::tuple<double, double, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_29;
+typedef std::tuple<double, double, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_30;
+typedef std::tuple<double, double, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_31;
+typedef std::tuple<double, double, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_32;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_33;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_34;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_35;
+typedef std::tuple<double, double, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_36;
+typedef std::tuple<double, double, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_37;
+typedef std::tuple<double, double, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_38;
+typedef std::tuple<double, double, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_39;
+typedef std::tuple<double, double, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_40;
+typedef std::tuple<double, double, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_41;
+typedef std::tuple<double, double, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_42;
+typedef std::tuple<double, double, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_43;
+typedef std::tuple<double, double, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_44;
+typedef std::tuple<double, double, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_45;
+typedef std::tuple<double, double, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_46;
+typedef std::tuple<double, double, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_47;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_48;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_49;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_50;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_51;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_52;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_53;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_54;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_55;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_56;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_57;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_58;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_59;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_60;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_61;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_62;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_63;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_64;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_65;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_66;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_67;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_68;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_69;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_70;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_71;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_72;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_73;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_74;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_75;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_76;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_77;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_78;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_79;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_80;
+typedef std::tuple<double, std::vector<double>, int, double, fvar<fvar<var> >, empty> type_ffv_81;
+typedef std::tuple<double, std::vector<double>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_82;
+typedef std::tuple<double, std::vector<double>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_83;
+typedef std::tuple<double, std::vector<double>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_84;
+typedef std::tuple<double, std::vector<double>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_85;
+typedef std::tuple<double, std::vector<double>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_86;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_87;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_88;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_89;
+typedef std::tuple<double, std::vector<double>, int, fvar<fvar<var> >, double, empty> type_ffv_90;
+typedef std::tuple<double, std::vector<double>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_91;
+typedef std::tuple<double, std::vector<double>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_92;
+typedef std::tuple<double, std::vector<double>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_93;
+typedef std::tuple<double, std::vector<double>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_94;
+typedef std::tuple<double, std::vector<double>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_95;
+typedef std::tuple<double, std::vector<double>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_96;
+typedef std::tuple<double, std::vector<double>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_97;
+typedef std::tuple<double, std::vector<double>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_98;
+typedef std::tuple<double, std::vector<double>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_0> AgradDistributionNormalSufficient_ffv_0;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1> AgradDistributionNormalSufficient_ffv_1;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2> AgradDistributionNormalSufficient_ffv_2;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3> AgradDistributionNormalSufficient_ffv_3;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_4> AgradDistributionNormalSufficient_ffv_4;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_5> AgradDistributionNormalSufficient_ffv_5;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_6> AgradDistributionNormalSufficient_ffv_6;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_7> AgradDistributionNormalSufficient_ffv_7;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_8> AgradDistributionNormalSufficient_ffv_8;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_9> AgradDistributionNormalSufficient_ffv_9;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_10> AgradDistributionNormalSufficient_ffv_10;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_11> AgradDistributionNormalSufficient_ffv_11;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_12> AgradDistributionNormalSufficient_ffv_12;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_13> AgradDistributionNormalSufficient_ffv_13;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_14> AgradDistributionNormalSufficient_ffv_14;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_15> AgradDistributionNormalSufficient_ffv_15;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_16> AgradDistributionNormalSufficient_ffv_16;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_17> AgradDistributionNormalSufficient_ffv_17;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_18> AgradDistributionNormalSufficient_ffv_18;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_19> AgradDistributionNormalSufficient_ffv_19;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_20> AgradDistributionNormalSufficient_ffv_20;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_21> AgradDistributionNormalSufficient_ffv_21;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_22> AgradDistributionNormalSufficient_ffv_22;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_23> AgradDistributionNormalSufficient_ffv_23;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_24> AgradDistributionNormalSufficient_ffv_24;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_25> AgradDistributionNormalSufficient_ffv_25;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_26> AgradDistributionNormalSufficient_ffv_26;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_27> AgradDistributionNormalSufficient_ffv_27;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_28> AgradDistributionNormalSufficient_ffv_28;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_29> AgradDistributionNormalSufficient_ffv_29;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_30> AgradDistributionNormalSufficient_ffv_30;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_31> AgradDistributionNormalSufficient_ffv_31;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_32> AgradDistributionNormalSufficient_ffv_32;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_33> AgradDistributionNormalSufficient_ffv_33;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_34> AgradDistributionNormalSufficient_ffv_34;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_35> AgradDistributionNormalSufficient_ffv_35;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_36> AgradDistributionNormalSufficient_ffv_36;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_37> AgradDistributionNormalSufficient_ffv_37;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_38> AgradDistributionNormalSufficient_ffv_38;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_39> AgradDistributionNormalSufficient_ffv_39;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_40> AgradDistributionNormalSufficient_ffv_40;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_41> AgradDistributionNormalSufficient_ffv_41;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_42> AgradDistributionNormalSufficient_ffv_42;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_43> AgradDistributionNormalSufficient_ffv_43;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_44> AgradDistributionNormalSufficient_ffv_44;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_45> AgradDistributionNormalSufficient_ffv_45;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_46> AgradDistributionNormalSufficient_ffv_46;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_47> AgradDistributionNormalSufficient_ffv_47;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_48> AgradDistributionNormalSufficient_ffv_48;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_49> AgradDistributionNormalSufficient_ffv_49;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_50> AgradDistributionNormalSufficient_ffv_50;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_51> AgradDistributionNormalSufficient_ffv_51;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_52> AgradDistributionNormalSufficient_ffv_52;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_53> AgradDistributionNormalSufficient_ffv_53;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_54> AgradDistributionNormalSufficient_ffv_54;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_55> AgradDistributionNormalSufficient_ffv_55;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_56> AgradDistributionNormalSufficient_ffv_56;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_57> AgradDistributionNormalSufficient_ffv_57;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_58> AgradDistributionNormalSufficient_ffv_58;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_59> AgradDistributionNormalSufficient_ffv_59;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_60> AgradDistributionNormalSufficient_ffv_60;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_61> AgradDistributionNormalSufficient_ffv_61;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_62> AgradDistributionNormalSufficient_ffv_62;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_63> AgradDistributionNormalSufficient_ffv_63;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_64> AgradDistributionNormalSufficient_ffv_64;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_65> AgradDistributionNormalSufficient_ffv_65;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_66> AgradDistributionNormalSufficient_ffv_66;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_67> AgradDistributionNormalSufficient_ffv_67;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_68> AgradDistributionNormalSufficient_ffv_68;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_69> AgradDistributionNormalSufficient_ffv_69;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_70> AgradDistributionNormalSufficient_ffv_70;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_71> AgradDistributionNormalSufficient_ffv_71;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_72> AgradDistributionNormalSufficient_ffv_72;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_73> AgradDistributionNormalSufficient_ffv_73;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_74> AgradDistributionNormalSufficient_ffv_74;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_75> AgradDistributionNormalSufficient_ffv_75;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_76> AgradDistributionNormalSufficient_ffv_76;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_77> AgradDistributionNormalSufficient_ffv_77;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_78> AgradDistributionNormalSufficient_ffv_78;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_79> AgradDistributionNormalSufficient_ffv_79;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_80> AgradDistributionNormalSufficient_ffv_80;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_81> AgradDistributionNormalSufficient_ffv_81;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_82> AgradDistributionNormalSufficient_ffv_82;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_83> AgradDistributionNormalSufficient_ffv_83;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_84> AgradDistributionNormalSufficient_ffv_84;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_85> AgradDistributionNormalSufficient_ffv_85;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_86> AgradDistributionNormalSufficient_ffv_86;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_87> AgradDistributionNormalSufficient_ffv_87;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_88> AgradDistributionNormalSufficient_ffv_88;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_89> AgradDistributionNormalSufficient_ffv_89;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_90> AgradDistributionNormalSufficient_ffv_90;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_91> AgradDistributionNormalSufficient_ffv_91;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_92> AgradDistributionNormalSufficient_ffv_92;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_93> AgradDistributionNormalSufficient_ffv_93;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_94> AgradDistributionNormalSufficient_ffv_94;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_95> AgradDistributionNormalSufficient_ffv_95;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_96> AgradDistributionNormalSufficient_ffv_96;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_97> AgradDistributionNormalSufficient_ffv_97;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_98> AgradDistributionNormalSufficient_ffv_98;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_99> AgradDistributionNormalSufficient_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_0, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_4, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_5, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_6, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_7, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_8, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_9, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_10, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_11, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_12, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_13, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_14, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_15, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_16, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_17, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_18, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_19, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_20, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_21, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_22, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_23, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_24, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_25, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_26, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_27, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_28, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_29, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_30, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_31, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_32, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_33, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_34, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_35, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_36, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_37, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_38, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_39, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_40, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_41, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_42, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_43, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_44, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_45, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_46, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_47, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_48, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_49, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_50, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_51, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_52, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_53, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_54, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_55, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_56, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_57, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_58, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_59, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_60, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_61, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_62, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_63, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_64, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_65, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_66, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_67, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_68, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_69, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_70, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_71, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_72, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_73, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_74, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_75, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_76, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_77, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_78, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_79, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_80, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_81, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_82, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_83, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_84, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_85, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_86, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_87, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_88, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_89, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_90, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_91, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_92, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_93, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_94, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_95, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_96, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_97, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_98, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_99, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, double, int, double, double, empty> type_v_0;
+typedef std::tuple<double, double, int, double, std::vector<double>, empty> type_v_1;
+typedef std::tuple<double, double, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2;
+typedef std::tuple<double, double, int, double, var, empty> type_v_3;
+typedef std::tuple<double, double, int, double, std::vector<var>, empty> type_v_4;
+typedef std::tuple<double, double, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_5;
+typedef std::tuple<double, double, int, std::vector<double>, double, empty> type_v_6;
+typedef std::tuple<double, double, int, std::vector<double>, std::vector<double>, empty> type_v_7;
+typedef std::tuple<double, double, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_8;
+typedef std::tuple<double, double, int, std::vector<double>, var, empty> type_v_9;
+typedef std::tuple<double, double, int, std::vector<double>, std::vector<var>, empty> type_v_10;
+typedef std::tuple<double, double, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_11;
+typedef std::tuple<double, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_12;
+typedef std::tuple<double, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_13;
+typedef std::tuple<double, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_14;
+typedef std::tuple<double, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_15;
+typedef std::tuple<double, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_16;
+typedef std::tuple<double, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_17;
+typedef std::tuple<double, double, int, var, double, empty> type_v_18;
+typedef std::tuple<double, double, int, var, std::vector<double>, empty> type_v_19;
+typedef std::tuple<double, double, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_20;
+typedef std::tuple<double, double, int, var, var, empty> type_v_21;
+typedef std::tuple<double, double, int, var, std::vector<var>, empty> type_v_22;
+typedef std::tuple<double, double, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_23;
+typedef std::tuple<double, double, int, std::vector<var>, double, empty> type_v_24;
+typedef std::tuple<double, double, int, std::vector<var>, std::vector<double>, empty> type_v_25;
+typedef std::tuple<double, double, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_26;
+typedef std::tuple<double, double, int, std::vector<var>, var, empty> type_v_27;
+typedef std::tuple<double, double, int, std::vector<var>, std::vector<var>, empty> type_v_28;
+typedef std::tuple<double, double, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_29;
+typedef std::tuple<double, double, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_30;
+typedef std::tuple<double, double, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_31;
+typedef std::tuple<double, double, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_32;
+typedef std::tuple<double, double, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_33;
+typedef std::tuple<double, double, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_34;
+typedef std::tuple<double, double, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_35;
+typedef std::tuple<double, double, std::vector<int>, double, double, empty> type_v_36;
+typedef std::tuple<double, double, std::vector<int>, double, std::vector<double>, empty> type_v_37;
+typedef std::tuple<double, double, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_38;
+typedef std::tuple<double, double, std::vector<int>, double, var, empty> type_v_39;
+typedef std::tuple<double, double, std::vector<int>, double, std::vector<var>, empty> type_v_40;
+typedef std::tuple<double, double, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_41;
+typedef std::tuple<double, double, std::vector<int>, std::vector<double>, double, empty> type_v_42;
+typedef std::tuple<double, double, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_43;
+typedef std::tuple<double, double, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_44;
+typedef std::tuple<double, double, std::vector<int>, std::vector<double>, var, empty> type_v_45;
+typedef std::tuple<double, double, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_46;
+typedef std::tuple<double, double, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_47;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_48;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_49;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_50;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_51;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_52;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_53;
+typedef std::tuple<double, double, std::vector<int>, var, double, empty> type_v_54;
+typedef std::tuple<double, double, std::vector<int>, var, std::vector<double>, empty> type_v_55;
+typedef std::tuple<double, double, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_56;
+typedef std::tuple<double, double, std::vector<int>, var, var, empty> type_v_57;
+typedef std::tuple<double, double, std::vector<int>, var, std::vector<var>, empty> type_v_58;
+typedef std::tuple<double, double, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_59;
+typedef std::tuple<double, double, std::vector<int>, std::vector<var>, double, empty> type_v_60;
+typedef std::tuple<double, double, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_61;
+typedef std::tuple<double, double, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_62;
+typedef std::tuple<double, double, std::vector<int>, std::vector<var>, var, empty> type_v_63;
+typedef std::tuple<double, double, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_64;
+typedef std::tuple<double, double, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_65;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_66;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_67;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_68;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_69;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_70;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_71;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_72;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_73;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_74;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_75;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_76;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_77;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_78;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_79;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_80;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_81;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_82;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_83;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_84;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_85;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_86;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_87;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_88;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_89;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_90;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_91;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_92;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_93;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_94;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_95;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_96;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_97;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_98;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_0> AgradDistributionNormalSufficient_v_0;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1> AgradDistributionNormalSufficient_v_1;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2> AgradDistributionNormalSufficient_v_2;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3> AgradDistributionNormalSufficient_v_3;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_4> AgradDistributionNormalSufficient_v_4;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_5> AgradDistributionNormalSufficient_v_5;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_6> AgradDistributionNormalSufficient_v_6;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_7> AgradDistributionNormalSufficient_v_7;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_8> AgradDistributionNormalSufficient_v_8;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_9> AgradDistributionNormalSufficient_v_9;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_10> AgradDistributionNormalSufficient_v_10;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_11> AgradDistributionNormalSufficient_v_11;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_12> AgradDistributionNormalSufficient_v_12;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_13> AgradDistributionNormalSufficient_v_13;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_14> AgradDistributionNormalSufficient_v_14;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_15> AgradDistributionNormalSufficient_v_15;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_16> AgradDistributionNormalSufficient_v_16;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_17> AgradDistributionNormalSufficient_v_17;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_18> AgradDistributionNormalSufficient_v_18;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_19> AgradDistributionNormalSufficient_v_19;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_20> AgradDistributionNormalSufficient_v_20;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_21> AgradDistributionNormalSufficient_v_21;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_22> AgradDistributionNormalSufficient_v_22;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_23> AgradDistributionNormalSufficient_v_23;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_24> AgradDistributionNormalSufficient_v_24;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_25> AgradDistributionNormalSufficient_v_25;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_26> AgradDistributionNormalSufficient_v_26;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_27> AgradDistributionNormalSufficient_v_27;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_28> AgradDistributionNormalSufficient_v_28;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_29> AgradDistributionNormalSufficient_v_29;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_30> AgradDistributionNormalSufficient_v_30;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_31> AgradDistributionNormalSufficient_v_31;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_32> AgradDistributionNormalSufficient_v_32;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_33> AgradDistributionNormalSufficient_v_33;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_34> AgradDistributionNormalSufficient_v_34;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_35> AgradDistributionNormalSufficient_v_35;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_36> AgradDistributionNormalSufficient_v_36;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_37> AgradDistributionNormalSufficient_v_37;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_38> AgradDistributionNormalSufficient_v_38;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_39> AgradDistributionNormalSufficient_v_39;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_40> AgradDistributionNormalSufficient_v_40;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_41> AgradDistributionNormalSufficient_v_41;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_42> AgradDistributionNormalSufficient_v_42;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_43> AgradDistributionNormalSufficient_v_43;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_44> AgradDistributionNormalSufficient_v_44;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_45> AgradDistributionNormalSufficient_v_45;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_46> AgradDistributionNormalSufficient_v_46;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_47> AgradDistributionNormalSufficient_v_47;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_48> AgradDistributionNormalSufficient_v_48;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_49> AgradDistributionNormalSufficient_v_49;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_50> AgradDistributionNormalSufficient_v_50;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_51> AgradDistributionNormalSufficient_v_51;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_52> AgradDistributionNormalSufficient_v_52;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_53> AgradDistributionNormalSufficient_v_53;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_54> AgradDistributionNormalSufficient_v_54;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_55> AgradDistributionNormalSufficient_v_55;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_56> AgradDistributionNormalSufficient_v_56;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_57> AgradDistributionNormalSufficient_v_57;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_58> AgradDistributionNormalSufficient_v_58;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_59> AgradDistributionNormalSufficient_v_59;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_60> AgradDistributionNormalSufficient_v_60;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_61> AgradDistributionNormalSufficient_v_61;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_62> AgradDistributionNormalSufficient_v_62;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_63> AgradDistributionNormalSufficient_v_63;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_64> AgradDistributionNormalSufficient_v_64;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_65> AgradDistributionNormalSufficient_v_65;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_66> AgradDistributionNormalSufficient_v_66;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_67> AgradDistributionNormalSufficient_v_67;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_68> AgradDistributionNormalSufficient_v_68;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_69> AgradDistributionNormalSufficient_v_69;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_70> AgradDistributionNormalSufficient_v_70;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_71> AgradDistributionNormalSufficient_v_71;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_72> AgradDistributionNormalSufficient_v_72;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_73> AgradDistributionNormalSufficient_v_73;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_74> AgradDistributionNormalSufficient_v_74;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_75> AgradDistributionNormalSufficient_v_75;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_76> AgradDistributionNormalSufficient_v_76;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_77> AgradDistributionNormalSufficient_v_77;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_78> AgradDistributionNormalSufficient_v_78;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_79> AgradDistributionNormalSufficient_v_79;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_80> AgradDistributionNormalSufficient_v_80;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_81> AgradDistributionNormalSufficient_v_81;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_82> AgradDistributionNormalSufficient_v_82;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_83> AgradDistributionNormalSufficient_v_83;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_84> AgradDistributionNormalSufficient_v_84;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_85> AgradDistributionNormalSufficient_v_85;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_86> AgradDistributionNormalSufficient_v_86;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_87> AgradDistributionNormalSufficient_v_87;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_88> AgradDistributionNormalSufficient_v_88;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_89> AgradDistributionNormalSufficient_v_89;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_90> AgradDistributionNormalSufficient_v_90;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_91> AgradDistributionNormalSufficient_v_91;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_92> AgradDistributionNormalSufficient_v_92;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_93> AgradDistributionNormalSufficient_v_93;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_94> AgradDistributionNormalSufficient_v_94;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_95> AgradDistributionNormalSufficient_v_95;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_96> AgradDistributionNormalSufficient_v_96;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_97> AgradDistributionNormalSufficient_v_97;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_98> AgradDistributionNormalSufficient_v_98;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_99> AgradDistributionNormalSufficient_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_0, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_4, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_5, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_6, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_7, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_8, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_9, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_10, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_11, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_12, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_13, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_14, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_15, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_16, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_17, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_18, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_19, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_20, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_21, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_22, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_23, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_24, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_25, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_26, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_27, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_28, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_29, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_30, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_31, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_32, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_33, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_34, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_35, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_36, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_37, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_38, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_39, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_40, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_41, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_42, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_43, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_44, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_45, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_46, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_47, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_48, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_49, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_50, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_51, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_52, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_53, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_54, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_55, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_56, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_57, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_58, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_59, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_60, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_61, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_62, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_63, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_64, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_65, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_66, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_67, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_68, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_69, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_70, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_71, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_72, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_73, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_74, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_75, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_76, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_77, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_78, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_79, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_80, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_81, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_82, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_83, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_84, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_85, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_86, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_87, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_88, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_89, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_90, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_91, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_92, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_93, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_94, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_95, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_96, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_97, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_98, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_99, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_99);
+
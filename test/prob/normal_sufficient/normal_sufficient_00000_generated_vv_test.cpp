@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, double, int, double, var, empty> type_vv_0;
+typedef std::tuple<double, double, int, double, std::vector<var>, empty> type_vv_1;
+typedef std::tuple<double, double, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2;
+typedef std::tuple<double, double, int, std::vector<double>, var, empty> type_vv_3;
+typedef std::tuple<double, double, int, std::vector<double>, std::vector<var>, empty> type_vv_4;
+typedef std::tuple<double, double, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_5;
+typedef std::tuple<double, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_6;
+typedef std::tuple<double, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_7;
+typedef std::tuple<double, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_8;
+typedef std::tuple<double, double, int, var, double, empty> type_vv_9;
+typedef std::tuple<double, double, int, var, std::vector<double>, empty> type_vv_10;
+typedef std::tuple<double, double, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_11;
+typedef std::tuple<double, double, int, var, var, empty> type_vv_12;
+typedef std::tuple<double, double, int, var, std::vector<var>, empty> type_vv_13;
+typedef std::tuple<double, double, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_14;
+typedef std::tuple<double, double, int, std::vector<var>, double, empty> type_vv_15;
+typedef std::tuple<double, double, int, std::vector<var>, std::vector<double>, empty> type_vv_16;
+typedef std::tuple<double, double, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_17;
+typedef std::tuple<double, double, int, std::vector<var>, var, empty> type_vv_18;
+typedef std::tuple<double, double, int, std::vector<var>, std::vector<var>, empty> type_vv_19;
+typedef std::tuple<double, double, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_20;
+typedef std::tuple<double, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_21;
+typedef std::tuple<double, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_22;
+typedef std::tuple<double, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_23;
+typedef std::tuple<double, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_24;
+typedef std::tuple<double, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_25;
+typedef std::tuple<double, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_26;
+typedef std::tuple<double, double, std::vector<int>, double, var, empty> type_vv_27;
+typedef std::tuple<double, double, std::vector<int>, double, std::vector<var>, empty> type_vv_28;
+typedef std::tuple<double, double, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_29;
+typedef std::tuple<double, double, std::vector<int>, std::vector<double>, var, empty> type_vv_30;
+typedef std::tuple<double, double, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_31;
+typedef std::tuple<double, double, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_32;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_33;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_34;
+typedef std::tuple<double, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_35;
+typedef std::tuple<double, double, std::vector<int>, var, double, empty> type_vv_36;
+typedef std::tuple<double, double, std::vector<int>, var, std::vector<double>, empty> type_vv_37;
+typedef std::tuple<double, double, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_38;
+typedef std::tuple<double, double, std::vector<int>, var, var, empty> type_vv_39;
+typedef std::tuple<double, double, std::vector<int>, var, std::vector<var>, empty> type_vv_40;
+typedef std::tuple<double, double, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_41;
+typedef std::tuple<double, double, std::vector<int>, std::vector<var>, double, empty> type_vv_42;
+typedef std::tuple<double, double, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_43;
+typedef std::tuple<double, double, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_44;
+typedef std::tuple<double, double, std::vector<int>, std::vector<var>, var, empty> type_vv_45;
+typedef std::tuple<double, double, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_46;
+typedef std::tuple<double, double, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_47;
+typedef std::tuple<double, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_48;
+typedef std::tuple<double, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_49;
+typedef std::tuple<double, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_50;
+typedef std::tuple<double, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_51;
+typedef std::tuple<double, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_52;
+typedef std::tuple<double, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_53;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_54;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_55;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_56;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_57;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_58;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_59;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_60;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_61;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_62;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_63;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_64;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_65;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_66;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_67;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_68;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_69;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_70;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_71;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_72;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_73;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_74;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_75;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_76;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_77;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_78;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_79;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_80;
+typedef std::tuple<double, std::vector<double>, int, double, var, empty> type_vv_81;
+typedef std::tuple<double, std::vector<double>, int, double, std::vector<var>, empty> type_vv_82;
+typedef std::tuple<double, std::vector<double>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_83;
+typedef std::tuple<double, std::vector<double>, int, std::vector<double>, var, empty> type_vv_84;
+typedef std::tuple<double, std::vector<double>, int, std::vector<double>, std::vector<var>, empty> type_vv_85;
+typedef std::tuple<double, std::vector<double>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_86;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_87;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_88;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_89;
+typedef std::tuple<double, std::vector<double>, int, var, double, empty> type_vv_90;
+typedef std::tuple<double, std::vector<double>, int, var, std::vector<double>, empty> type_vv_91;
+typedef std::tuple<double, std::vector<double>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_92;
+typedef std::tuple<double, std::vector<double>, int, var, var, empty> type_vv_93;
+typedef std::tuple<double, std::vector<double>, int, var, std::vector<var>, empty> type_vv_94;
+typedef std::tuple<double, std::vector<double>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_95;
+typedef std::tuple<double, std::vector<double>, int, std::vector<var>, double, empty> type_vv_96;
+typedef std::tuple<double, std::vector<double>, int, std::vector<var>, std::vector<double>, empty> type_vv_97;
+typedef std::tuple<double, std::vector<double>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_98;
+typedef std::tuple<double, std::vector<double>, int, std::vector<var>, var, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_0> AgradDistributionNormalSufficient_vv_0;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1> AgradDistributionNormalSufficient_vv_1;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2> AgradDistributionNormalSufficient_vv_2;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3> AgradDistributionNormalSufficient_vv_3;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_4> AgradDistributionNormalSufficient_vv_4;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_5> AgradDistributionNormalSufficient_vv_5;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_6> AgradDistributionNormalSufficient_vv_6;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_7> AgradDistributionNormalSufficient_vv_7;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_8> AgradDistributionNormalSufficient_vv_8;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_9> AgradDistributionNormalSufficient_vv_9;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_10> AgradDistributionNormalSufficient_vv_10;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_11> AgradDistributionNormalSufficient_vv_11;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_12> AgradDistributionNormalSufficient_vv_12;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_13> AgradDistributionNormalSufficient_vv_13;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_14> AgradDistributionNormalSufficient_vv_14;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_15> AgradDistributionNormalSufficient_vv_15;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_16> AgradDistributionNormalSufficient_vv_16;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_17> AgradDistributionNormalSufficient_vv_17;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_18> AgradDistributionNormalSufficient_vv_18;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_19> AgradDistributionNormalSufficient_vv_19;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_20> AgradDistributionNormalSufficient_vv_20;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_21> AgradDistributionNormalSufficient_vv_21;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_22> AgradDistributionNormalSufficient_vv_22;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_23> AgradDistributionNormalSufficient_vv_23;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_24> AgradDistributionNormalSufficient_vv_24;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_25> AgradDistributionNormalSufficient_vv_25;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_26> AgradDistributionNormalSufficient_vv_26;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_27> AgradDistributionNormalSufficient_vv_27;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_28> AgradDistributionNormalSufficient_vv_28;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_29> AgradDistributionNormalSufficient_vv_29;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_30> AgradDistributionNormalSufficient_vv_30;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_31> AgradDistributionNormalSufficient_vv_31;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_32> AgradDistributionNormalSufficient_vv_32;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_33> AgradDistributionNormalSufficient_vv_33;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_34> AgradDistributionNormalSufficient_vv_34;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_35> AgradDistributionNormalSufficient_vv_35;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_36> AgradDistributionNormalSufficient_vv_36;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_37> AgradDistributionNormalSufficient_vv_37;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_38> AgradDistributionNormalSufficient_vv_38;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_39> AgradDistributionNormalSufficient_vv_39;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_40> AgradDistributionNormalSufficient_vv_40;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_41> AgradDistributionNormalSufficient_vv_41;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_42> AgradDistributionNormalSufficient_vv_42;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_43> AgradDistributionNormalSufficient_vv_43;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_44> AgradDistributionNormalSufficient_vv_44;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_45> AgradDistributionNormalSufficient_vv_45;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_46> AgradDistributionNormalSufficient_vv_46;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_47> AgradDistributionNormalSufficient_vv_47;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_48> AgradDistributionNormalSufficient_vv_48;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_49> AgradDistributionNormalSufficient_vv_49;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_50> AgradDistributionNormalSufficient_vv_50;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_51> AgradDistributionNormalSufficient_vv_51;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_52> AgradDistributionNormalSufficient_vv_52;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_53> AgradDistributionNormalSufficient_vv_53;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_54> AgradDistributionNormalSufficient_vv_54;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_55> AgradDistributionNormalSufficient_vv_55;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_56> AgradDistributionNormalSufficient_vv_56;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_57> AgradDistributionNormalSufficient_vv_57;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_58> AgradDistributionNormalSufficient_vv_58;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_59> AgradDistributionNormalSufficient_vv_59;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_60> AgradDistributionNormalSufficient_vv_60;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_61> AgradDistributionNormalSufficient_vv_61;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_62> AgradDistributionNormalSufficient_vv_62;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_63> AgradDistributionNormalSufficient_vv_63;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_64> AgradDistributionNormalSufficient_vv_64;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_65> AgradDistributionNormalSufficient_vv_65;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_66> AgradDistributionNormalSufficient_vv_66;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_67> AgradDistributionNormalSufficient_vv_67;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_68> AgradDistributionNormalSufficient_vv_68;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_69> AgradDistributionNormalSufficient_vv_69;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_70> AgradDistributionNormalSufficient_vv_70;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_71> AgradDistributionNormalSufficient_vv_71;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_72> AgradDistributionNormalSufficient_vv_72;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_73> AgradDistributionNormalSufficient_vv_73;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_74> AgradDistributionNormalSufficient_vv_74;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_75> AgradDistributionNormalSufficient_vv_75;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_76> AgradDistributionNormalSufficient_vv_76;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_77> AgradDistributionNormalSufficient_vv_77;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_78> AgradDistributionNormalSufficient_vv_78;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_79> AgradDistributionNormalSufficient_vv_79;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_80> AgradDistributionNormalSufficient_vv_80;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_81> AgradDistributionNormalSufficient_vv_81;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_82> AgradDistributionNormalSufficient_vv_82;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_83> AgradDistributionNormalSufficient_vv_83;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_84> AgradDistributionNormalSufficient_vv_84;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_85> AgradDistributionNormalSufficient_vv_85;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_86> AgradDistributionNormalSufficient_vv_86;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_87> AgradDistributionNormalSufficient_vv_87;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_88> AgradDistributionNormalSufficient_vv_88;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_89> AgradDistributionNormalSufficient_vv_89;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_90> AgradDistributionNormalSufficient_vv_90;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_91> AgradDistributionNormalSufficient_vv_91;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_92> AgradDistributionNormalSufficient_vv_92;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_93> AgradDistributionNormalSufficient_vv_93;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_94> AgradDistributionNormalSufficient_vv_94;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_95> AgradDistributionNormalSufficient_vv_95;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_96> AgradDistributionNormalSufficient_vv_96;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_97> AgradDistributionNormalSufficient_vv_97;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_98> AgradDistributionNormalSufficient_vv_98;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_99> AgradDistributionNormalSufficient_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_0, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_4, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_5, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_6, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_7, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_8, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_9, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_10, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_11, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_12, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_13, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_14, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_15, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_16, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_17, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_18, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_19, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_20, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_21, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_22, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_23, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_24, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_25, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_26, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_27, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_28, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_29, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_30, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_31, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_32, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_33, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_34, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_35, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_36, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_37, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_38, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_39, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_40, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_41, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_42, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_43, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_44, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_45, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_46, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_47, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_48, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_49, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_50, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_51, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_52, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_53, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_54, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_55, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_56, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_57, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_58, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_59, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_60, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_61, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_62, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_63, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_64, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_65, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_66, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_67, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_68, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_69, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_70, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_71, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_72, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_73, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_74, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_75, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_76, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_77, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_78, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_79, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_80, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_81, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_82, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_83, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_84, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_85, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_86, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_87, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_88, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_89, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_90, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_91, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_92, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_93, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_94, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_95, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_96, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_97, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_98, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_99, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_99);
+
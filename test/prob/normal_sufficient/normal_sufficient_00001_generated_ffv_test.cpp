@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, std::vector<double>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_100;
+typedef std::tuple<double, std::vector<double>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_101;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_102;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_103;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_104;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_105;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_106;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_107;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_108;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_109;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_110;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_111;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_112;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_113;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_114;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_115;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_116;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_117;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_118;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_119;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_120;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_121;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_122;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_123;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_124;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_125;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_126;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_127;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_128;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_129;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_130;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_131;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_132;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_133;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_134;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_135;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_136;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_137;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_138;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_139;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_140;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_141;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_142;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_143;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_144;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_145;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_146;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_147;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_148;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_149;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_150;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_151;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_152;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_153;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_154;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_155;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_156;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_157;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_158;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_159;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_160;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_161;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty> type_ffv_162;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_163;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_164;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_165;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_166;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_167;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_168;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_169;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_170;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, double, empty> type_ffv_171;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_172;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_173;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_174;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_175;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_176;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_177;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_178;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_179;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_180;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_181;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_182;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_183;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_184;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_185;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_186;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_187;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_188;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_189;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_190;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_191;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_192;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_193;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_194;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_195;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_196;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_197;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_198;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_199;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_100> AgradDistributionNormalSufficient_ffv_100;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_101> AgradDistributionNormalSufficient_ffv_101;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_102> AgradDistributionNormalSufficient_ffv_102;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_103> AgradDistributionNormalSufficient_ffv_103;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_104> AgradDistributionNormalSufficient_ffv_104;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_105> AgradDistributionNormalSufficient_ffv_105;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_106> AgradDistributionNormalSufficient_ffv_106;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_107> AgradDistributionNormalSufficient_ffv_107;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_108> AgradDistributionNormalSufficient_ffv_108;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_109> AgradDistributionNormalSufficient_ffv_109;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_110> AgradDistributionNormalSufficient_ffv_110;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_111> AgradDistributionNormalSufficient_ffv_111;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_112> AgradDistributionNormalSufficient_ffv_112;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_113> AgradDistributionNormalSufficient_ffv_113;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_114> AgradDistributionNormalSufficient_ffv_114;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_115> AgradDistributionNormalSufficient_ffv_115;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_116> AgradDistributionNormalSufficient_ffv_116;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_117> AgradDistributionNormalSufficient_ffv_117;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_118> AgradDistributionNormalSufficient_ffv_118;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_119> AgradDistributionNormalSufficient_ffv_119;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_120> AgradDistributionNormalSufficient_ffv_120;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_121> AgradDistributionNormalSufficient_ffv_121;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_122> AgradDistributionNormalSufficient_ffv_122;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_123> AgradDistributionNormalSufficient_ffv_123;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_124> AgradDistributionNormalSufficient_ffv_124;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_125> AgradDistributionNormalSufficient_ffv_125;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_126> AgradDistributionNormalSufficient_ffv_126;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_127> AgradDistributionNormalSufficient_ffv_127;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_128> AgradDistributionNormalSufficient_ffv_128;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_129> AgradDistributionNormalSufficient_ffv_129;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_130> AgradDistributionNormalSufficient_ffv_130;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_131> AgradDistributionNormalSufficient_ffv_131;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_132> AgradDistributionNormalSufficient_ffv_132;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_133> AgradDistributionNormalSufficient_ffv_133;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_134> AgradDistributionNormalSufficient_ffv_134;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_135> AgradDistributionNormalSufficient_ffv_135;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_136> AgradDistributionNormalSufficient_ffv_136;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_137> AgradDistributionNormalSufficient_ffv_137;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_138> AgradDistributionNormalSufficient_ffv_138;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_139> AgradDistributionNormalSufficient_ffv_139;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_140> AgradDistributionNormalSufficient_ffv_140;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_141> AgradDistributionNormalSufficient_ffv_141;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_142> AgradDistributionNormalSufficient_ffv_142;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_143> AgradDistributionNormalSufficient_ffv_143;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_144> AgradDistributionNormalSufficient_ffv_144;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_145> AgradDistributionNormalSufficient_ffv_145;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_146> AgradDistributionNormalSufficient_ffv_146;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_147> AgradDistributionNormalSufficient_ffv_147;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_148> AgradDistributionNormalSufficient_ffv_148;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_149> AgradDistributionNormalSufficient_ffv_149;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_150> AgradDistributionNormalSufficient_ffv_150;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_151> AgradDistributionNormalSufficient_ffv_151;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_152> AgradDistributionNormalSufficient_ffv_152;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_153> AgradDistributionNormalSufficient_ffv_153;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_154> AgradDistributionNormalSufficient_ffv_154;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_155> AgradDistributionNormalSufficient_ffv_155;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_156> AgradDistributionNormalSufficient_ffv_156;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_157> AgradDistributionNormalSufficient_ffv_157;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_158> AgradDistributionNormalSufficient_ffv_158;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_159> AgradDistributionNormalSufficient_ffv_159;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_160> AgradDistributionNormalSufficient_ffv_160;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_161> AgradDistributionNormalSufficient_ffv_161;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_162> AgradDistributionNormalSufficient_ffv_162;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_163> AgradDistributionNormalSufficient_ffv_163;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_164> AgradDistributionNormalSufficient_ffv_164;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_165> AgradDistributionNormalSufficient_ffv_165;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_166> AgradDistributionNormalSufficient_ffv_166;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_167> AgradDistributionNormalSufficient_ffv_167;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_168> AgradDistributionNormalSufficient_ffv_168;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_169> AgradDistributionNormalSufficient_ffv_169;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_170> AgradDistributionNormalSufficient_ffv_170;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_171> AgradDistributionNormalSufficient_ffv_171;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_172> AgradDistributionNormalSufficient_ffv_172;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_173> AgradDistributionNormalSufficient_ffv_173;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_174> AgradDistributionNormalSufficient_ffv_174;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_175> AgradDistributionNormalSufficient_ffv_175;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_176> AgradDistributionNormalSufficient_ffv_176;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_177> AgradDistributionNormalSufficient_ffv_177;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_178> AgradDistributionNormalSufficient_ffv_178;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_179> AgradDistributionNormalSufficient_ffv_179;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_180> AgradDistributionNormalSufficient_ffv_180;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_181> AgradDistributionNormalSufficient_ffv_181;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_182> AgradDistributionNormalSufficient_ffv_182;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_183> AgradDistributionNormalSufficient_ffv_183;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_184> AgradDistributionNormalSufficient_ffv_184;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_185> AgradDistributionNormalSufficient_ffv_185;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_186> AgradDistributionNormalSufficient_ffv_186;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_187> AgradDistributionNormalSufficient_ffv_187;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_188> AgradDistributionNormalSufficient_ffv_188;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_189> AgradDistributionNormalSufficient_ffv_189;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_190> AgradDistributionNormalSufficient_ffv_190;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_191> AgradDistributionNormalSufficient_ffv_191;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_192> AgradDistributionNormalSufficient_ffv_192;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_193> AgradDistributionNormalSufficient_ffv_193;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_194> AgradDistributionNormalSufficient_ffv_194;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_195> AgradDistributionNormalSufficient_ffv_195;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_196> AgradDistributionNormalSufficient_ffv_196;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_197> AgradDistributionNormalSufficient_ffv_197;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_198> AgradDistributionNormalSufficient_ffv_198;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_199> AgradDistributionNormalSufficient_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_100, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_101, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_102, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_103, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_104, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_105, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_106, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_107, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_108, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_109, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_110, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_111, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_112, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_113, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_114, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_115, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_116, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_117, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_118, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_119, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_120, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_121, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_122, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_123, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_124, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_125, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_126, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_127, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_128, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_129, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_130, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_131, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_132, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_133, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_134, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_135, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_136, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_137, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_138, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_139, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_140, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_141, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_142, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_143, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_144, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_145, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_146, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_147, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_148, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_149, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_150, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_151, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_152, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_153, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_154, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_155, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_156, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_157, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_158, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_159, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_160, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_161, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_162, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_163, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_164, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_165, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_166, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_167, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_168, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_169, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_170, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_171, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_172, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_173, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_174, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_175, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_176, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_177, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_178, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_179, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_180, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_181, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_182, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_183, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_184, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_185, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_186, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_187, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_188, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_189, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_190, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_191, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_192, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_193, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_194, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_195, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_196, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_197, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_198, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_199, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_100;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_101;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_102;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_103;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_104;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_105;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_106;
+typedef std::tuple<double, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_107;
+typedef std::tuple<double, std::vector<double>, int, double, double, empty> type_v_108;
+typedef std::tuple<double, std::vector<double>, int, double, std::vector<double>, empty> type_v_109;
+typedef std::tuple<double, std::vector<double>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_110;
+typedef std::tuple<double, std::vector<double>, int, double, var, empty> type_v_111;
+typedef std::tuple<double, std::vector<double>, int, double, std::vector<var>, empty> type_v_112;
+typedef std::tuple<double, std::vector<double>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_113;
+typedef std::tuple<double, std::vector<double>, int, std::vector<double>, double, empty> type_v_114;
+typedef std::tuple<double, std::vector<double>, int, std::vector<double>, std::vector<double>, empty> type_v_115;
+typedef std::tuple<double, std::vector<double>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_116;
+typedef std::tuple<double, std::vector<double>, int, std::vector<double>, var, empty> type_v_117;
+typedef std::tuple<double, std::vector<double>, int, std::vector<double>, std::vector<var>, empty> type_v_118;
+typedef std::tuple<double, std::vector<double>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_119;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_120;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_121;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_122;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_123;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_124;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_125;
+typedef std::tuple<double, std::vector<double>, int, var, double, empty> type_v_126;
+typedef std::tuple<double, std::vector<double>, int, var, std::vector<double>, empty> type_v_127;
+typedef std::tuple<double, std::vector<double>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_128;
+typedef std::tuple<double, std::vector<double>, int, var, var, empty> type_v_129;
+typedef std::tuple<double, std::vector<double>, int, var, std::vector<var>, empty> type_v_130;
+typedef std::tuple<double, std::vector<double>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_131;
+typedef std::tuple<double, std::vector<double>, int, std::vector<var>, double, empty> type_v_132;
+typedef std::tuple<double, std::vector<double>, int, std::vector<var>, std::vector<double>, empty> type_v_133;
+typedef std::tuple<double, std::vector<double>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_134;
+typedef std::tuple<double, std::vector<double>, int, std::vector<var>, var, empty> type_v_135;
+typedef std::tuple<double, std::vector<double>, int, std::vector<var>, std::vector<var>, empty> type_v_136;
+typedef std::tuple<double, std::vector<double>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_137;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_138;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_139;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_140;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_141;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_142;
+typedef std::tuple<double, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_143;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, double, double, empty> type_v_144;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, double, std::vector<double>, empty> type_v_145;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_146;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, double, var, empty> type_v_147;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, double, std::vector<var>, empty> type_v_148;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_149;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<double>, double, empty> type_v_150;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_151;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_152;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<double>, var, empty> type_v_153;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_154;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_155;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_156;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_157;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_158;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_159;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_160;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_161;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, var, double, empty> type_v_162;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, var, std::vector<double>, empty> type_v_163;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_164;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, var, var, empty> type_v_165;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, var, std::vector<var>, empty> type_v_166;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_167;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<var>, double, empty> type_v_168;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_169;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_170;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<var>, var, empty> type_v_171;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_172;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_173;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_174;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_175;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_176;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_177;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_178;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_179;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_180;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_181;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_182;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_183;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_184;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_185;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_186;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_187;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_188;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_189;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_190;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_191;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_192;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_193;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_194;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_195;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_196;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_197;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_198;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_100> AgradDistributionNormalSufficient_v_100;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_101> AgradDistributionNormalSufficient_v_101;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_102> AgradDistributionNormalSufficient_v_102;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_103> AgradDistributionNormalSufficient_v_103;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_104> AgradDistributionNormalSufficient_v_104;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_105> AgradDistributionNormalSufficient_v_105;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_106> AgradDistributionNormalSufficient_v_106;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_107> AgradDistributionNormalSufficient_v_107;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_108> AgradDistributionNormalSufficient_v_108;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_109> AgradDistributionNormalSufficient_v_109;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_110> AgradDistributionNormalSufficient_v_110;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_111> AgradDistributionNormalSufficient_v_111;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_112> AgradDistributionNormalSufficient_v_112;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_113> AgradDistributionNormalSufficient_v_113;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_114> AgradDistributionNormalSufficient_v_114;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_115> AgradDistributionNormalSufficient_v_115;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_116> AgradDistributionNormalSufficient_v_116;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_117> AgradDistributionNormalSufficient_v_117;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_118> AgradDistributionNormalSufficient_v_118;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_119> AgradDistributionNormalSufficient_v_119;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_120> AgradDistributionNormalSufficient_v_120;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_121> AgradDistributionNormalSufficient_v_121;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_122> AgradDistributionNormalSufficient_v_122;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_123> AgradDistributionNormalSufficient_v_123;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_124> AgradDistributionNormalSufficient_v_124;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_125> AgradDistributionNormalSufficient_v_125;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_126> AgradDistributionNormalSufficient_v_126;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_127> AgradDistributionNormalSufficient_v_127;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_128> AgradDistributionNormalSufficient_v_128;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_129> AgradDistributionNormalSufficient_v_129;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_130> AgradDistributionNormalSufficient_v_130;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_131> AgradDistributionNormalSufficient_v_131;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_132> AgradDistributionNormalSufficient_v_132;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_133> AgradDistributionNormalSufficient_v_133;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_134> AgradDistributionNormalSufficient_v_134;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_135> AgradDistributionNormalSufficient_v_135;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_136> AgradDistributionNormalSufficient_v_136;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_137> AgradDistributionNormalSufficient_v_137;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_138> AgradDistributionNormalSufficient_v_138;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_139> AgradDistributionNormalSufficient_v_139;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_140> AgradDistributionNormalSufficient_v_140;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_141> AgradDistributionNormalSufficient_v_141;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_142> AgradDistributionNormalSufficient_v_142;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_143> AgradDistributionNormalSufficient_v_143;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_144> AgradDistributionNormalSufficient_v_144;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_145> AgradDistributionNormalSufficient_v_145;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_146> AgradDistributionNormalSufficient_v_146;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_147> AgradDistributionNormalSufficient_v_147;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_148> AgradDistributionNormalSufficient_v_148;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_149> AgradDistributionNormalSufficient_v_149;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_150> AgradDistributionNormalSufficient_v_150;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_151> AgradDistributionNormalSufficient_v_151;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_152> AgradDistributionNormalSufficient_v_152;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_153> AgradDistributionNormalSufficient_v_153;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_154> AgradDistributionNormalSufficient_v_154;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_155> AgradDistributionNormalSufficient_v_155;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_156> AgradDistributionNormalSufficient_v_156;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_157> AgradDistributionNormalSufficient_v_157;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_158> AgradDistributionNormalSufficient_v_158;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_159> AgradDistributionNormalSufficient_v_159;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_160> AgradDistributionNormalSufficient_v_160;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_161> AgradDistributionNormalSufficient_v_161;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_162> AgradDistributionNormalSufficient_v_162;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_163> AgradDistributionNormalSufficient_v_163;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_164> AgradDistributionNormalSufficient_v_164;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_165> AgradDistributionNormalSufficient_v_165;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_166> AgradDistributionNormalSufficient_v_166;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_167> AgradDistributionNormalSufficient_v_167;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_168> AgradDistributionNormalSufficient_v_168;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_169> AgradDistributionNormalSufficient_v_169;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_170> AgradDistributionNormalSufficient_v_170;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_171> AgradDistributionNormalSufficient_v_171;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_172> AgradDistributionNormalSufficient_v_172;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_173> AgradDistributionNormalSufficient_v_173;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_174> AgradDistributionNormalSufficient_v_174;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_175> AgradDistributionNormalSufficient_v_175;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_176> AgradDistributionNormalSufficient_v_176;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_177> AgradDistributionNormalSufficient_v_177;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_178> AgradDistributionNormalSufficient_v_178;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_179> AgradDistributionNormalSufficient_v_179;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_180> AgradDistributionNormalSufficient_v_180;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_181> AgradDistributionNormalSufficient_v_181;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_182> AgradDistributionNormalSufficient_v_182;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_183> AgradDistributionNormalSufficient_v_183;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_184> AgradDistributionNormalSufficient_v_184;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_185> AgradDistributionNormalSufficient_v_185;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_186> AgradDistributionNormalSufficient_v_186;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_187> AgradDistributionNormalSufficient_v_187;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_188> AgradDistributionNormalSufficient_v_188;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_189> AgradDistributionNormalSufficient_v_189;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_190> AgradDistributionNormalSufficient_v_190;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_191> AgradDistributionNormalSufficient_v_191;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_192> AgradDistributionNormalSufficient_v_192;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_193> AgradDistributionNormalSufficient_v_193;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_194> AgradDistributionNormalSufficient_v_194;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_195> AgradDistributionNormalSufficient_v_195;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_196> AgradDistributionNormalSufficient_v_196;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_197> AgradDistributionNormalSufficient_v_197;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_198> AgradDistributionNormalSufficient_v_198;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_199> AgradDistributionNormalSufficient_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_100, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_101, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_102, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_103, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_104, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_105, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_106, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_107, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_108, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_109, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_110, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_111, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_112, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_113, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_114, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_115, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_116, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_117, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_118, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_119, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_120, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_121, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_122, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_123, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_124, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_125, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_126, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_127, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_128, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_129, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_130, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_131, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_132, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_133, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_134, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_135, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_136, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_137, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_138, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_139, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_140, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_141, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_142, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_143, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_144, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_145, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_146, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_147, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_148, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_149, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_150, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_151, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_152, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_153, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_154, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_155, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_156, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_157, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_158, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_159, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_160, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_161, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_162, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_163, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_164, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_165, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_166, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_167, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_168, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_169, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_170, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_171, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_172, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_173, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_174, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_175, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_176, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_177, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_178, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_179, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_180, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_181, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_182, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_183, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_184, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_185, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_186, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_187, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_188, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_189, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_190, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_191, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_192, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_193, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_194, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_195, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_196, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_197, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_198, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_199, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_199);
+
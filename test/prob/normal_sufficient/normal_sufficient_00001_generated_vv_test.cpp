@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, std::vector<double>, int, std::vector<var>, std::vector<var>, empty> type_vv_100;
+typedef std::tuple<double, std::vector<double>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_101;
+typedef std::tuple<double, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_102;
+typedef std::tuple<double, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_103;
+typedef std::tuple<double, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_104;
+typedef std::tuple<double, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_105;
+typedef std::tuple<double, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_106;
+typedef std::tuple<double, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_107;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, double, var, empty> type_vv_108;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, double, std::vector<var>, empty> type_vv_109;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_110;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<double>, var, empty> type_vv_111;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_112;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_113;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_114;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_115;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_116;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, var, double, empty> type_vv_117;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, var, std::vector<double>, empty> type_vv_118;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_119;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, var, var, empty> type_vv_120;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, var, std::vector<var>, empty> type_vv_121;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_122;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<var>, double, empty> type_vv_123;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_124;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_125;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<var>, var, empty> type_vv_126;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_127;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_128;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_129;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_130;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_131;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_132;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_133;
+typedef std::tuple<double, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_134;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_135;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_136;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_137;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_138;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_139;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_140;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_141;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_142;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_143;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_144;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_145;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_146;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_147;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_148;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_149;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_150;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_151;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_152;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_153;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_154;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_155;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_156;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_157;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_158;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_159;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_160;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_161;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, var, empty> type_vv_162;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty> type_vv_163;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_164;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty> type_vv_165;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty> type_vv_166;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_167;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_168;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_169;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_170;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, double, empty> type_vv_171;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty> type_vv_172;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_173;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, var, empty> type_vv_174;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty> type_vv_175;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_176;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty> type_vv_177;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty> type_vv_178;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_179;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty> type_vv_180;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty> type_vv_181;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_182;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_183;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_184;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_185;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_186;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_187;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_188;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty> type_vv_189;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty> type_vv_190;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_191;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty> type_vv_192;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_193;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_194;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_195;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_196;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_197;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty> type_vv_198;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty> type_vv_199;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_100> AgradDistributionNormalSufficient_vv_100;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_101> AgradDistributionNormalSufficient_vv_101;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_102> AgradDistributionNormalSufficient_vv_102;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_103> AgradDistributionNormalSufficient_vv_103;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_104> AgradDistributionNormalSufficient_vv_104;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_105> AgradDistributionNormalSufficient_vv_105;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_106> AgradDistributionNormalSufficient_vv_106;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_107> AgradDistributionNormalSufficient_vv_107;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_108> AgradDistributionNormalSufficient_vv_108;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_109> AgradDistributionNormalSufficient_vv_109;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_110> AgradDistributionNormalSufficient_vv_110;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_111> AgradDistributionNormalSufficient_vv_111;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_112> AgradDistributionNormalSufficient_vv_112;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_113> AgradDistributionNormalSufficient_vv_113;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_114> AgradDistributionNormalSufficient_vv_114;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_115> AgradDistributionNormalSufficient_vv_115;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_116> AgradDistributionNormalSufficient_vv_116;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_117> AgradDistributionNormalSufficient_vv_117;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_118> AgradDistributionNormalSufficient_vv_118;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_119> AgradDistributionNormalSufficient_vv_119;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_120> AgradDistributionNormalSufficient_vv_120;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_121> AgradDistributionNormalSufficient_vv_121;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_122> AgradDistributionNormalSufficient_vv_122;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_123> AgradDistributionNormalSufficient_vv_123;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_124> AgradDistributionNormalSufficient_vv_124;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_125> AgradDistributionNormalSufficient_vv_125;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_126> AgradDistributionNormalSufficient_vv_126;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_127> AgradDistributionNormalSufficient_vv_127;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_128> AgradDistributionNormalSufficient_vv_128;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_129> AgradDistributionNormalSufficient_vv_129;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_130> AgradDistributionNormalSufficient_vv_130;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_131> AgradDistributionNormalSufficient_vv_131;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_132> AgradDistributionNormalSufficient_vv_132;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_133> AgradDistributionNormalSufficient_vv_133;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_134> AgradDistributionNormalSufficient_vv_134;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_135> AgradDistributionNormalSufficient_vv_135;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_136> AgradDistributionNormalSufficient_vv_136;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_137> AgradDistributionNormalSufficient_vv_137;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_138> AgradDistributionNormalSufficient_vv_138;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_139> AgradDistributionNormalSufficient_vv_139;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_140> AgradDistributionNormalSufficient_vv_140;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_141> AgradDistributionNormalSufficient_vv_141;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_142> AgradDistributionNormalSufficient_vv_142;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_143> AgradDistributionNormalSufficient_vv_143;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_144> AgradDistributionNormalSufficient_vv_144;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_145> AgradDistributionNormalSufficient_vv_145;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_146> AgradDistributionNormalSufficient_vv_146;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_147> AgradDistributionNormalSufficient_vv_147;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_148> AgradDistributionNormalSufficient_vv_148;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_149> AgradDistributionNormalSufficient_vv_149;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_150> AgradDistributionNormalSufficient_vv_150;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_151> AgradDistributionNormalSufficient_vv_151;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_152> AgradDistributionNormalSufficient_vv_152;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_153> AgradDistributionNormalSufficient_vv_153;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_154> AgradDistributionNormalSufficient_vv_154;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_155> AgradDistributionNormalSufficient_vv_155;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_156> AgradDistributionNormalSufficient_vv_156;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_157> AgradDistributionNormalSufficient_vv_157;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_158> AgradDistributionNormalSufficient_vv_158;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_159> AgradDistributionNormalSufficient_vv_159;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_160> AgradDistributionNormalSufficient_vv_160;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_161> AgradDistributionNormalSufficient_vv_161;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_162> AgradDistributionNormalSufficient_vv_162;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_163> AgradDistributionNormalSufficient_vv_163;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_164> AgradDistributionNormalSufficient_vv_164;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_165> AgradDistributionNormalSufficient_vv_165;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_166> AgradDistributionNormalSufficient_vv_166;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_167> AgradDistributionNormalSufficient_vv_167;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_168> AgradDistributionNormalSufficient_vv_168;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_169> AgradDistributionNormalSufficient_vv_169;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_170> AgradDistributionNormalSufficient_vv_170;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_171> AgradDistributionNormalSufficient_vv_171;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_172> AgradDistributionNormalSufficient_vv_172;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_173> AgradDistributionNormalSufficient_vv_173;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_174> AgradDistributionNormalSufficient_vv_174;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_175> AgradDistributionNormalSufficient_vv_175;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_176> AgradDistributionNormalSufficient_vv_176;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_177> AgradDistributionNormalSufficient_vv_177;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_178> AgradDistributionNormalSufficient_vv_178;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_179> AgradDistributionNormalSufficient_vv_179;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_180> AgradDistributionNormalSufficient_vv_180;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_181> AgradDistributionNormalSufficient_vv_181;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_182> AgradDistributionNormalSufficient_vv_182;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_183> AgradDistributionNormalSufficient_vv_183;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_184> AgradDistributionNormalSufficient_vv_184;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_185> AgradDistributionNormalSufficient_vv_185;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_186> AgradDistributionNormalSufficient_vv_186;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_187> AgradDistributionNormalSufficient_vv_187;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_188> AgradDistributionNormalSufficient_vv_188;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_189> AgradDistributionNormalSufficient_vv_189;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_190> AgradDistributionNormalSufficient_vv_190;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_191> AgradDistributionNormalSufficient_vv_191;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_192> AgradDistributionNormalSufficient_vv_192;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_193> AgradDistributionNormalSufficient_vv_193;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_194> AgradDistributionNormalSufficient_vv_194;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_195> AgradDistributionNormalSufficient_vv_195;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_196> AgradDistributionNormalSufficient_vv_196;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_197> AgradDistributionNormalSufficient_vv_197;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_198> AgradDistributionNormalSufficient_vv_198;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_199> AgradDistributionNormalSufficient_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_100, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_101, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_102, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_103, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_104, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_105, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_106, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_107, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_108, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_109, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_110, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_111, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_112, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_113, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_114, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_115, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_116, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_117, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_118, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_119, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_120, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_121, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_122, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_123, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_124, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_125, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_126, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_127, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_128, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_129, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_130, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_131, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_132, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_133, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_134, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_135, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_136, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_137, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_138, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_139, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_140, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_141, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_142, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_143, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_144, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_145, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_146, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_147, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_148, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_149, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_150, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_151, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_152, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_153, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_154, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_155, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_156, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_157, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_158, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_159, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_160, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_161, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_162, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_163, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_164, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_165, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_166, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_167, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_168, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_169, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_170, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_171, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_172, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_173, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_174, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_175, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_176, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_177, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_178, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_179, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_180, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_181, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_182, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_183, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_184, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_185, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_186, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_187, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_188, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_189, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_190, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_191, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_192, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_193, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_194, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_195, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_196, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_197, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_198, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_199, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_199);
+
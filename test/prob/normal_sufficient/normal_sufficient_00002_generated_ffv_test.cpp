@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_200;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_201;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_202;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_203;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_204;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_205;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_206;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_207;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_208;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_209;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_210;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_211;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_212;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_213;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_214;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_215;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_216;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_217;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_218;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_219;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_220;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_221;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_222;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_223;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_224;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_225;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_226;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_227;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_228;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_229;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_230;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_231;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_232;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_233;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_234;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_235;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_236;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_237;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_238;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_239;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_240;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_241;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_242;
+typedef std::tuple<double, fvar<fvar<var> >, int, double, double, empty> type_ffv_243;
+typedef std::tuple<double, fvar<fvar<var> >, int, double, std::vector<double>, empty> type_ffv_244;
+typedef std::tuple<double, fvar<fvar<var> >, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_245;
+typedef std::tuple<double, fvar<fvar<var> >, int, double, fvar<fvar<var> >, empty> type_ffv_246;
+typedef std::tuple<double, fvar<fvar<var> >, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_247;
+typedef std::tuple<double, fvar<fvar<var> >, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_248;
+typedef std::tuple<double, fvar<fvar<var> >, int, std::vector<double>, double, empty> type_ffv_249;
+typedef std::tuple<double, fvar<fvar<var> >, int, std::vector<double>, std::vector<double>, empty> type_ffv_250;
+typedef std::tuple<double, fvar<fvar<var> >, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_251;
+typedef std::tuple<double, fvar<fvar<var> >, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_252;
+typedef std::tuple<double, fvar<fvar<var> >, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_253;
+typedef std::tuple<double, fvar<fvar<var> >, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_254;
+typedef std::tuple<double, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_255;
+typedef std::tuple<double, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_256;
+typedef std::tuple<double, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_257;
+typedef std::tuple<double, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_258;
+typedef std::tuple<double, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_259;
+typedef std::tuple<double, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_260;
+typedef std::tuple<double, fvar<fvar<var> >, int, fvar<fvar<var> >, double, empty> type_ffv_261;
+typedef std::tuple<double, fvar<fvar<var> >, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_262;
+typedef std::tuple<double, fvar<fvar<var> >, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_263;
+typedef std::tuple<double, fvar<fvar<var> >, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_264;
+typedef std::tuple<double, fvar<fvar<var> >, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_265;
+typedef std::tuple<double, fvar<fvar<var> >, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_266;
+typedef std::tuple<double, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_267;
+typedef std::tuple<double, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_268;
+typedef std::tuple<double, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_269;
+typedef std::tuple<double, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_270;
+typedef std::tuple<double, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_271;
+typedef std::tuple<double, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_272;
+typedef std::tuple<double, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_273;
+typedef std::tuple<double, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_274;
+typedef std::tuple<double, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_275;
+typedef std::tuple<double, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_276;
+typedef std::tuple<double, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_277;
+typedef std::tuple<double, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_278;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, double, double, empty> type_ffv_279;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, double, std::vector<double>, empty> type_ffv_280;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_281;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_282;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_283;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_284;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, std::vector<double>, double, empty> type_ffv_285;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_286;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_287;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_288;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_289;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_290;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_291;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_292;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_293;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_294;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_295;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_296;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_297;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_298;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_299;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_200> AgradDistributionNormalSufficient_ffv_200;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_201> AgradDistributionNormalSufficient_ffv_201;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_202> AgradDistributionNormalSufficient_ffv_202;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_203> AgradDistributionNormalSufficient_ffv_203;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_204> AgradDistributionNormalSufficient_ffv_204;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_205> AgradDistributionNormalSufficient_ffv_205;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_206> AgradDistributionNormalSufficient_ffv_206;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_207> AgradDistributionNormalSufficient_ffv_207;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_208> AgradDistributionNormalSufficient_ffv_208;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_209> AgradDistributionNormalSufficient_ffv_209;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_210> AgradDistributionNormalSufficient_ffv_210;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_211> AgradDistributionNormalSufficient_ffv_211;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_212> AgradDistributionNormalSufficient_ffv_212;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_213> AgradDistributionNormalSufficient_ffv_213;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_214> AgradDistributionNormalSufficient_ffv_214;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_215> AgradDistributionNormalSufficient_ffv_215;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_216> AgradDistributionNormalSufficient_ffv_216;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_217> AgradDistributionNormalSufficient_ffv_217;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_218> AgradDistributionNormalSufficient_ffv_218;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_219> AgradDistributionNormalSufficient_ffv_219;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_220> AgradDistributionNormalSufficient_ffv_220;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_221> AgradDistributionNormalSufficient_ffv_221;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_222> AgradDistributionNormalSufficient_ffv_222;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_223> AgradDistributionNormalSufficient_ffv_223;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_224> AgradDistributionNormalSufficient_ffv_224;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_225> AgradDistributionNormalSufficient_ffv_225;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_226> AgradDistributionNormalSufficient_ffv_226;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_227> AgradDistributionNormalSufficient_ffv_227;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_228> AgradDistributionNormalSufficient_ffv_228;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_229> AgradDistributionNormalSufficient_ffv_229;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_230> AgradDistributionNormalSufficient_ffv_230;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_231> AgradDistributionNormalSufficient_ffv_231;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_232> AgradDistributionNormalSufficient_ffv_232;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_233> AgradDistributionNormalSufficient_ffv_233;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_234> AgradDistributionNormalSufficient_ffv_234;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_235> AgradDistributionNormalSufficient_ffv_235;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_236> AgradDistributionNormalSufficient_ffv_236;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_237> AgradDistributionNormalSufficient_ffv_237;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_238> AgradDistributionNormalSufficient_ffv_238;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_239> AgradDistributionNormalSufficient_ffv_239;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_240> AgradDistributionNormalSufficient_ffv_240;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_241> AgradDistributionNormalSufficient_ffv_241;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_242> AgradDistributionNormalSufficient_ffv_242;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_243> AgradDistributionNormalSufficient_ffv_243;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_244> AgradDistributionNormalSufficient_ffv_244;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_245> AgradDistributionNormalSufficient_ffv_245;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_246> AgradDistributionNormalSufficient_ffv_246;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_247> AgradDistributionNormalSufficient_ffv_247;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_248> AgradDistributionNormalSufficient_ffv_248;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_249> AgradDistributionNormalSufficient_ffv_249;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_250> AgradDistributionNormalSufficient_ffv_250;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_251> AgradDistributionNormalSufficient_ffv_251;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_252> AgradDistributionNormalSufficient_ffv_252;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_253> AgradDistributionNormalSufficient_ffv_253;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_254> AgradDistributionNormalSufficient_ffv_254;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_255> AgradDistributionNormalSufficient_ffv_255;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_256> AgradDistributionNormalSufficient_ffv_256;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_257> AgradDistributionNormalSufficient_ffv_257;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_258> AgradDistributionNormalSufficient_ffv_258;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_259> AgradDistributionNormalSufficient_ffv_259;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_260> AgradDistributionNormalSufficient_ffv_260;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_261> AgradDistributionNormalSufficient_ffv_261;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_262> AgradDistributionNormalSufficient_ffv_262;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_263> AgradDistributionNormalSufficient_ffv_263;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_264> AgradDistributionNormalSufficient_ffv_264;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_265> AgradDistributionNormalSufficient_ffv_265;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_266> AgradDistributionNormalSufficient_ffv_266;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_267> AgradDistributionNormalSufficient_ffv_267;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_268> AgradDistributionNormalSufficient_ffv_268;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_269> AgradDistributionNormalSufficient_ffv_269;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_270> AgradDistributionNormalSufficient_ffv_270;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_271> AgradDistributionNormalSufficient_ffv_271;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_272> AgradDistributionNormalSufficient_ffv_272;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_273> AgradDistributionNormalSufficient_ffv_273;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_274> AgradDistributionNormalSufficient_ffv_274;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_275> AgradDistributionNormalSufficient_ffv_275;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_276> AgradDistributionNormalSufficient_ffv_276;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_277> AgradDistributionNormalSufficient_ffv_277;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_278> AgradDistributionNormalSufficient_ffv_278;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_279> AgradDistributionNormalSufficient_ffv_279;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_280> AgradDistributionNormalSufficient_ffv_280;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_281> AgradDistributionNormalSufficient_ffv_281;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_282> AgradDistributionNormalSufficient_ffv_282;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_283> AgradDistributionNormalSufficient_ffv_283;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_284> AgradDistributionNormalSufficient_ffv_284;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_285> AgradDistributionNormalSufficient_ffv_285;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_286> AgradDistributionNormalSufficient_ffv_286;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_287> AgradDistributionNormalSufficient_ffv_287;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_288> AgradDistributionNormalSufficient_ffv_288;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_289> AgradDistributionNormalSufficient_ffv_289;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_290> AgradDistributionNormalSufficient_ffv_290;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_291> AgradDistributionNormalSufficient_ffv_291;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_292> AgradDistributionNormalSufficient_ffv_292;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_293> AgradDistributionNormalSufficient_ffv_293;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_294> AgradDistributionNormalSufficient_ffv_294;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_295> AgradDistributionNormalSufficient_ffv_295;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_296> AgradDistributionNormalSufficient_ffv_296;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_297> AgradDistributionNormalSufficient_ffv_297;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_298> AgradDistributionNormalSufficient_ffv_298;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_299> AgradDistributionNormalSufficient_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_200, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_201, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_202, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_203, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_204, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_205, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_206, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_207, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_208, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_209, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_210, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_211, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_212, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_213, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_214, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_215, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_216, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_217, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_218, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_219, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_220, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_221, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_222, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_223, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_224, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_225, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_226, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_227, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_228, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_229, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_230, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_231, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_232, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_233, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_234, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_235, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_236, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_237, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_238, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_239, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_240, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_241, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_242, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_243, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_244, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_245, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_246, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_247, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_248, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_249, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_250, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_251, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_252, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_253, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_254, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_255, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_256, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_257, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_258, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_259, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_260, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_261, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_262, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_263, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_264, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_265, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_266, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_267, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_268, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_269, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_270, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_271, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_272, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_273, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_274, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_275, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_276, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_277, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_278, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_279, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_280, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_281, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_282, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_283, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_284, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_285, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_286, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_287, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_288, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_289, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_290, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_291, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_292, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_293, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_294, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_295, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_296, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_297, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_298, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_299, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_200;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_201;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_202;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_203;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_204;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_205;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_206;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_207;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_208;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_209;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_210;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_211;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_212;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_213;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_214;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_215;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, double, empty> type_v_216;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_v_217;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_218;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, var, empty> type_v_219;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty> type_v_220;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_221;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_v_222;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_v_223;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_224;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty> type_v_225;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty> type_v_226;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_227;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_228;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_229;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_230;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_231;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_232;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_233;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, double, empty> type_v_234;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty> type_v_235;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_236;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, var, empty> type_v_237;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty> type_v_238;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_239;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty> type_v_240;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty> type_v_241;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_242;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty> type_v_243;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty> type_v_244;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_245;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_246;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_247;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_248;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_249;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_250;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_251;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty> type_v_252;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty> type_v_253;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_254;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty> type_v_255;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty> type_v_256;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_257;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_v_258;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_259;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_260;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty> type_v_261;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_262;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_263;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_264;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_265;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_266;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_267;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_268;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_269;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty> type_v_270;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty> type_v_271;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_272;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty> type_v_273;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty> type_v_274;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_275;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty> type_v_276;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_277;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_278;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty> type_v_279;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_280;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_281;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_282;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_283;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_284;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_285;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_286;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_287;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_288;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_289;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_290;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_291;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_292;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_293;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_294;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_295;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_296;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_297;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_298;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_299;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_200> AgradDistributionNormalSufficient_v_200;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_201> AgradDistributionNormalSufficient_v_201;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_202> AgradDistributionNormalSufficient_v_202;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_203> AgradDistributionNormalSufficient_v_203;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_204> AgradDistributionNormalSufficient_v_204;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_205> AgradDistributionNormalSufficient_v_205;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_206> AgradDistributionNormalSufficient_v_206;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_207> AgradDistributionNormalSufficient_v_207;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_208> AgradDistributionNormalSufficient_v_208;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_209> AgradDistributionNormalSufficient_v_209;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_210> AgradDistributionNormalSufficient_v_210;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_211> AgradDistributionNormalSufficient_v_211;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_212> AgradDistributionNormalSufficient_v_212;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_213> AgradDistributionNormalSufficient_v_213;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_214> AgradDistributionNormalSufficient_v_214;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_215> AgradDistributionNormalSufficient_v_215;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_216> AgradDistributionNormalSufficient_v_216;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_217> AgradDistributionNormalSufficient_v_217;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_218> AgradDistributionNormalSufficient_v_218;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_219> AgradDistributionNormalSufficient_v_219;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_220> AgradDistributionNormalSufficient_v_220;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_221> AgradDistributionNormalSufficient_v_221;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_222> AgradDistributionNormalSufficient_v_222;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_223> AgradDistributionNormalSufficient_v_223;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_224> AgradDistributionNormalSufficient_v_224;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_225> AgradDistributionNormalSufficient_v_225;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_226> AgradDistributionNormalSufficient_v_226;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_227> AgradDistributionNormalSufficient_v_227;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_228> AgradDistributionNormalSufficient_v_228;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_229> AgradDistributionNormalSufficient_v_229;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_230> AgradDistributionNormalSufficient_v_230;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_231> AgradDistributionNormalSufficient_v_231;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_232> AgradDistributionNormalSufficient_v_232;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_233> AgradDistributionNormalSufficient_v_233;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_234> AgradDistributionNormalSufficient_v_234;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_235> AgradDistributionNormalSufficient_v_235;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_236> AgradDistributionNormalSufficient_v_236;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_237> AgradDistributionNormalSufficient_v_237;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_238> AgradDistributionNormalSufficient_v_238;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_239> AgradDistributionNormalSufficient_v_239;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_240> AgradDistributionNormalSufficient_v_240;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_241> AgradDistributionNormalSufficient_v_241;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_242> AgradDistributionNormalSufficient_v_242;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_243> AgradDistributionNormalSufficient_v_243;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_244> AgradDistributionNormalSufficient_v_244;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_245> AgradDistributionNormalSufficient_v_245;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_246> AgradDistributionNormalSufficient_v_246;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_247> AgradDistributionNormalSufficient_v_247;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_248> AgradDistributionNormalSufficient_v_248;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_249> AgradDistributionNormalSufficient_v_249;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_250> AgradDistributionNormalSufficient_v_250;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_251> AgradDistributionNormalSufficient_v_251;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_252> AgradDistributionNormalSufficient_v_252;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_253> AgradDistributionNormalSufficient_v_253;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_254> AgradDistributionNormalSufficient_v_254;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_255> AgradDistributionNormalSufficient_v_255;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_256> AgradDistributionNormalSufficient_v_256;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_257> AgradDistributionNormalSufficient_v_257;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_258> AgradDistributionNormalSufficient_v_258;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_259> AgradDistributionNormalSufficient_v_259;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_260> AgradDistributionNormalSufficient_v_260;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_261> AgradDistributionNormalSufficient_v_261;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_262> AgradDistributionNormalSufficient_v_262;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_263> AgradDistributionNormalSufficient_v_263;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_264> AgradDistributionNormalSufficient_v_264;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_265> AgradDistributionNormalSufficient_v_265;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_266> AgradDistributionNormalSufficient_v_266;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_267> AgradDistributionNormalSufficient_v_267;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_268> AgradDistributionNormalSufficient_v_268;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_269> AgradDistributionNormalSufficient_v_269;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_270> AgradDistributionNormalSufficient_v_270;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_271> AgradDistributionNormalSufficient_v_271;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_272> AgradDistributionNormalSufficient_v_272;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_273> AgradDistributionNormalSufficient_v_273;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_274> AgradDistributionNormalSufficient_v_274;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_275> AgradDistributionNormalSufficient_v_275;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_276> AgradDistributionNormalSufficient_v_276;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_277> AgradDistributionNormalSufficient_v_277;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_278> AgradDistributionNormalSufficient_v_278;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_279> AgradDistributionNormalSufficient_v_279;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_280> AgradDistributionNormalSufficient_v_280;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_281> AgradDistributionNormalSufficient_v_281;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_282> AgradDistributionNormalSufficient_v_282;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_283> AgradDistributionNormalSufficient_v_283;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_284> AgradDistributionNormalSufficient_v_284;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_285> AgradDistributionNormalSufficient_v_285;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_286> AgradDistributionNormalSufficient_v_286;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_287> AgradDistributionNormalSufficient_v_287;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_288> AgradDistributionNormalSufficient_v_288;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_289> AgradDistributionNormalSufficient_v_289;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_290> AgradDistributionNormalSufficient_v_290;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_291> AgradDistributionNormalSufficient_v_291;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_292> AgradDistributionNormalSufficient_v_292;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_293> AgradDistributionNormalSufficient_v_293;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_294> AgradDistributionNormalSufficient_v_294;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_295> AgradDistributionNormalSufficient_v_295;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_296> AgradDistributionNormalSufficient_v_296;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_297> AgradDistributionNormalSufficient_v_297;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_298> AgradDistributionNormalSufficient_v_298;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_299> AgradDistributionNormalSufficient_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_200, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_201, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_202, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_203, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_204, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_205, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_206, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_207, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_208, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_209, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_210, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_211, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_212, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_213, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_214, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_215, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_216, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_217, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_218, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_219, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_220, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_221, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_222, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_223, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_224, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_225, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_226, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_227, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_228, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_229, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_230, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_231, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_232, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_233, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_234, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_235, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_236, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_237, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_238, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_239, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_240, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_241, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_242, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_243, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_244, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_245, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_246, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_247, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_248, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_249, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_250, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_251, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_252, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_253, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_254, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_255, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_256, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_257, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_258, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_259, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_260, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_261, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_262, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_263, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_264, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_265, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_266, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_267, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_268, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_269, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_270, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_271, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_272, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_273, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_274, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_275, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_276, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_277, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_278, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_279, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_280, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_281, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_282, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_283, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_284, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_285, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_286, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_287, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_288, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_289, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_290, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_291, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_292, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_293, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_294, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_295, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_296, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_297, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_298, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_299, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_299);
+
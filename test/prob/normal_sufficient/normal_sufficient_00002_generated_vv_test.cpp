@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_200;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty> type_vv_201;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty> type_vv_202;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_203;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty> type_vv_204;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_205;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_206;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty> type_vv_207;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_208;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_209;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_210;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_211;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_212;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_213;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_214;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_215;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_216;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_217;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_218;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_219;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_220;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_221;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_222;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_223;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_224;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_225;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_226;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_227;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_228;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_229;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_230;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_231;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_232;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_233;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_234;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_235;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_236;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_237;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_238;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_239;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_240;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_241;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_242;
+typedef std::tuple<double, var, int, double, double, empty> type_vv_243;
+typedef std::tuple<double, var, int, double, std::vector<double>, empty> type_vv_244;
+typedef std::tuple<double, var, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_245;
+typedef std::tuple<double, var, int, double, var, empty> type_vv_246;
+typedef std::tuple<double, var, int, double, std::vector<var>, empty> type_vv_247;
+typedef std::tuple<double, var, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_248;
+typedef std::tuple<double, var, int, std::vector<double>, double, empty> type_vv_249;
+typedef std::tuple<double, var, int, std::vector<double>, std::vector<double>, empty> type_vv_250;
+typedef std::tuple<double, var, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_251;
+typedef std::tuple<double, var, int, std::vector<double>, var, empty> type_vv_252;
+typedef std::tuple<double, var, int, std::vector<double>, std::vector<var>, empty> type_vv_253;
+typedef std::tuple<double, var, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_254;
+typedef std::tuple<double, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_255;
+typedef std::tuple<double, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_256;
+typedef std::tuple<double, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_257;
+typedef std::tuple<double, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_258;
+typedef std::tuple<double, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_259;
+typedef std::tuple<double, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_260;
+typedef std::tuple<double, var, int, var, double, empty> type_vv_261;
+typedef std::tuple<double, var, int, var, std::vector<double>, empty> type_vv_262;
+typedef std::tuple<double, var, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_263;
+typedef std::tuple<double, var, int, var, var, empty> type_vv_264;
+typedef std::tuple<double, var, int, var, std::vector<var>, empty> type_vv_265;
+typedef std::tuple<double, var, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_266;
+typedef std::tuple<double, var, int, std::vector<var>, double, empty> type_vv_267;
+typedef std::tuple<double, var, int, std::vector<var>, std::vector<double>, empty> type_vv_268;
+typedef std::tuple<double, var, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_269;
+typedef std::tuple<double, var, int, std::vector<var>, var, empty> type_vv_270;
+typedef std::tuple<double, var, int, std::vector<var>, std::vector<var>, empty> type_vv_271;
+typedef std::tuple<double, var, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_272;
+typedef std::tuple<double, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_273;
+typedef std::tuple<double, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_274;
+typedef std::tuple<double, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_275;
+typedef std::tuple<double, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_276;
+typedef std::tuple<double, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_277;
+typedef std::tuple<double, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_278;
+typedef std::tuple<double, var, std::vector<int>, double, double, empty> type_vv_279;
+typedef std::tuple<double, var, std::vector<int>, double, std::vector<double>, empty> type_vv_280;
+typedef std::tuple<double, var, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_281;
+typedef std::tuple<double, var, std::vector<int>, double, var, empty> type_vv_282;
+typedef std::tuple<double, var, std::vector<int>, double, std::vector<var>, empty> type_vv_283;
+typedef std::tuple<double, var, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_284;
+typedef std::tuple<double, var, std::vector<int>, std::vector<double>, double, empty> type_vv_285;
+typedef std::tuple<double, var, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_286;
+typedef std::tuple<double, var, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_287;
+typedef std::tuple<double, var, std::vector<int>, std::vector<double>, var, empty> type_vv_288;
+typedef std::tuple<double, var, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_289;
+typedef std::tuple<double, var, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_290;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_291;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_292;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_293;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_294;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_295;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_296;
+typedef std::tuple<double, var, std::vector<int>, var, double, empty> type_vv_297;
+typedef std::tuple<double, var, std::vector<int>, var, std::vector<double>, empty> type_vv_298;
+typedef std::tuple<double, var, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_299;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_200> AgradDistributionNormalSufficient_vv_200;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_201> AgradDistributionNormalSufficient_vv_201;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_202> AgradDistributionNormalSufficient_vv_202;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_203> AgradDistributionNormalSufficient_vv_203;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_204> AgradDistributionNormalSufficient_vv_204;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_205> AgradDistributionNormalSufficient_vv_205;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_206> AgradDistributionNormalSufficient_vv_206;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_207> AgradDistributionNormalSufficient_vv_207;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_208> AgradDistributionNormalSufficient_vv_208;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_209> AgradDistributionNormalSufficient_vv_209;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_210> AgradDistributionNormalSufficient_vv_210;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_211> AgradDistributionNormalSufficient_vv_211;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_212> AgradDistributionNormalSufficient_vv_212;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_213> AgradDistributionNormalSufficient_vv_213;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_214> AgradDistributionNormalSufficient_vv_214;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_215> AgradDistributionNormalSufficient_vv_215;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_216> AgradDistributionNormalSufficient_vv_216;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_217> AgradDistributionNormalSufficient_vv_217;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_218> AgradDistributionNormalSufficient_vv_218;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_219> AgradDistributionNormalSufficient_vv_219;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_220> AgradDistributionNormalSufficient_vv_220;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_221> AgradDistributionNormalSufficient_vv_221;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_222> AgradDistributionNormalSufficient_vv_222;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_223> AgradDistributionNormalSufficient_vv_223;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_224> AgradDistributionNormalSufficient_vv_224;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_225> AgradDistributionNormalSufficient_vv_225;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_226> AgradDistributionNormalSufficient_vv_226;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_227> AgradDistributionNormalSufficient_vv_227;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_228> AgradDistributionNormalSufficient_vv_228;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_229> AgradDistributionNormalSufficient_vv_229;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_230> AgradDistributionNormalSufficient_vv_230;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_231> AgradDistributionNormalSufficient_vv_231;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_232> AgradDistributionNormalSufficient_vv_232;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_233> AgradDistributionNormalSufficient_vv_233;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_234> AgradDistributionNormalSufficient_vv_234;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_235> AgradDistributionNormalSufficient_vv_235;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_236> AgradDistributionNormalSufficient_vv_236;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_237> AgradDistributionNormalSufficient_vv_237;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_238> AgradDistributionNormalSufficient_vv_238;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_239> AgradDistributionNormalSufficient_vv_239;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_240> AgradDistributionNormalSufficient_vv_240;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_241> AgradDistributionNormalSufficient_vv_241;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_242> AgradDistributionNormalSufficient_vv_242;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_243> AgradDistributionNormalSufficient_vv_243;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_244> AgradDistributionNormalSufficient_vv_244;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_245> AgradDistributionNormalSufficient_vv_245;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_246> AgradDistributionNormalSufficient_vv_246;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_247> AgradDistributionNormalSufficient_vv_247;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_248> AgradDistributionNormalSufficient_vv_248;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_249> AgradDistributionNormalSufficient_vv_249;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_250> AgradDistributionNormalSufficient_vv_250;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_251> AgradDistributionNormalSufficient_vv_251;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_252> AgradDistributionNormalSufficient_vv_252;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_253> AgradDistributionNormalSufficient_vv_253;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_254> AgradDistributionNormalSufficient_vv_254;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_255> AgradDistributionNormalSufficient_vv_255;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_256> AgradDistributionNormalSufficient_vv_256;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_257> AgradDistributionNormalSufficient_vv_257;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_258> AgradDistributionNormalSufficient_vv_258;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_259> AgradDistributionNormalSufficient_vv_259;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_260> AgradDistributionNormalSufficient_vv_260;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_261> AgradDistributionNormalSufficient_vv_261;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_262> AgradDistributionNormalSufficient_vv_262;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_263> AgradDistributionNormalSufficient_vv_263;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_264> AgradDistributionNormalSufficient_vv_264;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_265> AgradDistributionNormalSufficient_vv_265;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_266> AgradDistributionNormalSufficient_vv_266;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_267> AgradDistributionNormalSufficient_vv_267;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_268> AgradDistributionNormalSufficient_vv_268;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_269> AgradDistributionNormalSufficient_vv_269;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_270> AgradDistributionNormalSufficient_vv_270;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_271> AgradDistributionNormalSufficient_vv_271;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_272> AgradDistributionNormalSufficient_vv_272;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_273> AgradDistributionNormalSufficient_vv_273;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_274> AgradDistributionNormalSufficient_vv_274;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_275> AgradDistributionNormalSufficient_vv_275;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_276> AgradDistributionNormalSufficient_vv_276;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_277> AgradDistributionNormalSufficient_vv_277;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_278> AgradDistributionNormalSufficient_vv_278;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_279> AgradDistributionNormalSufficient_vv_279;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_280> AgradDistributionNormalSufficient_vv_280;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_281> AgradDistributionNormalSufficient_vv_281;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_282> AgradDistributionNormalSufficient_vv_282;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_283> AgradDistributionNormalSufficient_vv_283;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_284> AgradDistributionNormalSufficient_vv_284;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_285> AgradDistributionNormalSufficient_vv_285;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_286> AgradDistributionNormalSufficient_vv_286;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_287> AgradDistributionNormalSufficient_vv_287;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_288> AgradDistributionNormalSufficient_vv_288;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_289> AgradDistributionNormalSufficient_vv_289;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_290> AgradDistributionNormalSufficient_vv_290;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_291> AgradDistributionNormalSufficient_vv_291;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_292> AgradDistributionNormalSufficient_vv_292;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_293> AgradDistributionNormalSufficient_vv_293;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_294> AgradDistributionNormalSufficient_vv_294;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_295> AgradDistributionNormalSufficient_vv_295;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_296> AgradDistributionNormalSufficient_vv_296;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_297> AgradDistributionNormalSufficient_vv_297;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_298> AgradDistributionNormalSufficient_vv_298;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_299> AgradDistributionNormalSufficient_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_200, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_201, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_202, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_203, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_204, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_205, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_206, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_207, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_208, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_209, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_210, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_211, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_212, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_213, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_214, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_215, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_216, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_217, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_218, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_219, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_220, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_221, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_222, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_223, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_224, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_225, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_226, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_227, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_228, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_229, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_230, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_231, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_232, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_233, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_234, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_235, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_236, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_237, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_238, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_239, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_240, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_241, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_242, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_243, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_244, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_245, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_246, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_247, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_248, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_249, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_250, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_251, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_252, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_253, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_254, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_255, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_256, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_257, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_258, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_259, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_260, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_261, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_262, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_263, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_264, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_265, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_266, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_267, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_268, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_269, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_270, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_271, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_272, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_273, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_274, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_275, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_276, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_277, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_278, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_279, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_280, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_281, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_282, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_283, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_284, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_285, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_286, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_287, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_288, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_289, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_290, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_291, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_292, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_293, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_294, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_295, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_296, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_297, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_298, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_299, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_299);
+
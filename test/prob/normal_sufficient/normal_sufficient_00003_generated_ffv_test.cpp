@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_300;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_301;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_302;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_303;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_304;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_305;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_306;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_307;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_308;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_309;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_310;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_311;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_312;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_313;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_314;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_315;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_316;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_317;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_318;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_319;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_320;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_321;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_322;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_323;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_324;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_325;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_326;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_327;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_328;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_329;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_330;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_331;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_332;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_333;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_334;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_335;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_336;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_337;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_338;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_339;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_340;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_341;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_342;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_343;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_344;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_345;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_346;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_347;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_348;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_349;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_350;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, double, double, empty> type_ffv_351;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, double, std::vector<double>, empty> type_ffv_352;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_353;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, double, fvar<fvar<var> >, empty> type_ffv_354;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_355;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_356;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, std::vector<double>, double, empty> type_ffv_357;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, std::vector<double>, std::vector<double>, empty> type_ffv_358;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_359;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_360;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_361;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_362;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_363;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_364;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_365;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_366;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_367;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_368;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, double, empty> type_ffv_369;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_370;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_371;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_372;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_373;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_374;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_375;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_376;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_377;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_378;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_379;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_380;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_381;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_382;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_383;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_384;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_385;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_386;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, double, double, empty> type_ffv_387;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, double, std::vector<double>, empty> type_ffv_388;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_389;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_390;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_391;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_392;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, double, empty> type_ffv_393;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_394;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_395;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_396;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_397;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_398;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_399;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_300> AgradDistributionNormalSufficient_ffv_300;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_301> AgradDistributionNormalSufficient_ffv_301;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_302> AgradDistributionNormalSufficient_ffv_302;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_303> AgradDistributionNormalSufficient_ffv_303;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_304> AgradDistributionNormalSufficient_ffv_304;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_305> AgradDistributionNormalSufficient_ffv_305;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_306> AgradDistributionNormalSufficient_ffv_306;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_307> AgradDistributionNormalSufficient_ffv_307;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_308> AgradDistributionNormalSufficient_ffv_308;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_309> AgradDistributionNormalSufficient_ffv_309;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_310> AgradDistributionNormalSufficient_ffv_310;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_311> AgradDistributionNormalSufficient_ffv_311;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_312> AgradDistributionNormalSufficient_ffv_312;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_313> AgradDistributionNormalSufficient_ffv_313;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_314> AgradDistributionNormalSufficient_ffv_314;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_315> AgradDistributionNormalSufficient_ffv_315;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_316> AgradDistributionNormalSufficient_ffv_316;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_317> AgradDistributionNormalSufficient_ffv_317;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_318> AgradDistributionNormalSufficient_ffv_318;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_319> AgradDistributionNormalSufficient_ffv_319;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_320> AgradDistributionNormalSufficient_ffv_320;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_321> AgradDistributionNormalSufficient_ffv_321;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_322> AgradDistributionNormalSufficient_ffv_322;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_323> AgradDistributionNormalSufficient_ffv_323;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_324> AgradDistributionNormalSufficient_ffv_324;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_325> AgradDistributionNormalSufficient_ffv_325;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_326> AgradDistributionNormalSufficient_ffv_326;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_327> AgradDistributionNormalSufficient_ffv_327;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_328> AgradDistributionNormalSufficient_ffv_328;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_329> AgradDistributionNormalSufficient_ffv_329;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_330> AgradDistributionNormalSufficient_ffv_330;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_331> AgradDistributionNormalSufficient_ffv_331;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_332> AgradDistributionNormalSufficient_ffv_332;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_333> AgradDistributionNormalSufficient_ffv_333;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_334> AgradDistributionNormalSufficient_ffv_334;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_335> AgradDistributionNormalSufficient_ffv_335;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_336> AgradDistributionNormalSufficient_ffv_336;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_337> AgradDistributionNormalSufficient_ffv_337;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_338> AgradDistributionNormalSufficient_ffv_338;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_339> AgradDistributionNormalSufficient_ffv_339;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_340> AgradDistributionNormalSufficient_ffv_340;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_341> AgradDistributionNormalSufficient_ffv_341;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_342> AgradDistributionNormalSufficient_ffv_342;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_343> AgradDistributionNormalSufficient_ffv_343;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_344> AgradDistributionNormalSufficient_ffv_344;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_345> AgradDistributionNormalSufficient_ffv_345;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_346> AgradDistributionNormalSufficient_ffv_346;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_347> AgradDistributionNormalSufficient_ffv_347;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_348> AgradDistributionNormalSufficient_ffv_348;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_349> AgradDistributionNormalSufficient_ffv_349;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_350> AgradDistributionNormalSufficient_ffv_350;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_351> AgradDistributionNormalSufficient_ffv_351;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_352> AgradDistributionNormalSufficient_ffv_352;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_353> AgradDistributionNormalSufficient_ffv_353;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_354> AgradDistributionNormalSufficient_ffv_354;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_355> AgradDistributionNormalSufficient_ffv_355;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_356> AgradDistributionNormalSufficient_ffv_356;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_357> AgradDistributionNormalSufficient_ffv_357;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_358> AgradDistributionNormalSufficient_ffv_358;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_359> AgradDistributionNormalSufficient_ffv_359;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_360> AgradDistributionNormalSufficient_ffv_360;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_361> AgradDistributionNormalSufficient_ffv_361;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_362> AgradDistributionNormalSufficient_ffv_362;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_363> AgradDistributionNormalSufficient_ffv_363;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_364> AgradDistributionNormalSufficient_ffv_364;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_365> AgradDistributionNormalSufficient_ffv_365;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_366> AgradDistributionNormalSufficient_ffv_366;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_367> AgradDistributionNormalSufficient_ffv_367;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_368> AgradDistributionNormalSufficient_ffv_368;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_369> AgradDistributionNormalSufficient_ffv_369;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_370> AgradDistributionNormalSufficient_ffv_370;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_371> AgradDistributionNormalSufficient_ffv_371;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_372> AgradDistributionNormalSufficient_ffv_372;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_373> AgradDistributionNormalSufficient_ffv_373;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_374> AgradDistributionNormalSufficient_ffv_374;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_375> AgradDistributionNormalSufficient_ffv_375;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_376> AgradDistributionNormalSufficient_ffv_376;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_377> AgradDistributionNormalSufficient_ffv_377;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_378> AgradDistributionNormalSufficient_ffv_378;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_379> AgradDistributionNormalSufficient_ffv_379;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_380> AgradDistributionNormalSufficient_ffv_380;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_381> AgradDistributionNormalSufficient_ffv_381;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_382> AgradDistributionNormalSufficient_ffv_382;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_383> AgradDistributionNormalSufficient_ffv_383;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_384> AgradDistributionNormalSufficient_ffv_384;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_385> AgradDistributionNormalSufficient_ffv_385;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_386> AgradDistributionNormalSufficient_ffv_386;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_387> AgradDistributionNormalSufficient_ffv_387;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_388> AgradDistributionNormalSufficient_ffv_388;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_389> AgradDistributionNormalSufficient_ffv_389;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_390> AgradDistributionNormalSufficient_ffv_390;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_391> AgradDistributionNormalSufficient_ffv_391;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_392> AgradDistributionNormalSufficient_ffv_392;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_393> AgradDistributionNormalSufficient_ffv_393;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_394> AgradDistributionNormalSufficient_ffv_394;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_395> AgradDistributionNormalSufficient_ffv_395;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_396> AgradDistributionNormalSufficient_ffv_396;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_397> AgradDistributionNormalSufficient_ffv_397;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_398> AgradDistributionNormalSufficient_ffv_398;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_399> AgradDistributionNormalSufficient_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_300, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_301, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_302, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_303, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_304, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_305, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_306, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_307, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_308, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_309, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_310, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_311, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_312, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_313, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_314, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_315, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_316, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_317, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_318, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_319, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_320, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_321, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_322, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_323, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_324, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_325, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_326, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_327, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_328, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_329, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_330, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_331, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_332, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_333, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_334, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_335, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_336, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_337, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_338, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_339, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_340, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_341, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_342, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_343, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_344, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_345, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_346, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_347, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_348, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_349, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_350, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_351, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_352, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_353, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_354, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_355, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_356, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_357, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_358, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_359, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_360, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_361, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_362, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_363, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_364, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_365, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_366, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_367, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_368, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_369, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_370, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_371, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_372, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_373, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_374, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_375, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_376, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_377, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_378, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_379, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_380, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_381, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_382, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_383, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_384, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_385, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_386, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_387, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_388, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_389, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_390, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_391, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_392, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_393, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_394, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_395, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_396, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_397, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_398, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_399, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_300;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_301;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_302;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_303;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_304;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_305;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_306;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_307;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_308;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_309;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_310;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_311;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_312;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_313;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_314;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_315;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_316;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_317;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_318;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_319;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_320;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_321;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_322;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_323;
+typedef std::tuple<double, var, int, double, double, empty> type_v_324;
+typedef std::tuple<double, var, int, double, std::vector<double>, empty> type_v_325;
+typedef std::tuple<double, var, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_326;
+typedef std::tuple<double, var, int, double, var, empty> type_v_327;
+typedef std::tuple<double, var, int, double, std::vector<var>, empty> type_v_328;
+typedef std::tuple<double, var, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_329;
+typedef std::tuple<double, var, int, std::vector<double>, double, empty> type_v_330;
+typedef std::tuple<double, var, int, std::vector<double>, std::vector<double>, empty> type_v_331;
+typedef std::tuple<double, var, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_332;
+typedef std::tuple<double, var, int, std::vector<double>, var, empty> type_v_333;
+typedef std::tuple<double, var, int, std::vector<double>, std::vector<var>, empty> type_v_334;
+typedef std::tuple<double, var, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_335;
+typedef std::tuple<double, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_336;
+typedef std::tuple<double, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_337;
+typedef std::tuple<double, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_338;
+typedef std::tuple<double, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_339;
+typedef std::tuple<double, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_340;
+typedef std::tuple<double, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_341;
+typedef std::tuple<double, var, int, var, double, empty> type_v_342;
+typedef std::tuple<double, var, int, var, std::vector<double>, empty> type_v_343;
+typedef std::tuple<double, var, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_344;
+typedef std::tuple<double, var, int, var, var, empty> type_v_345;
+typedef std::tuple<double, var, int, var, std::vector<var>, empty> type_v_346;
+typedef std::tuple<double, var, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_347;
+typedef std::tuple<double, var, int, std::vector<var>, double, empty> type_v_348;
+typedef std::tuple<double, var, int, std::vector<var>, std::vector<double>, empty> type_v_349;
+typedef std::tuple<double, var, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_350;
+typedef std::tuple<double, var, int, std::vector<var>, var, empty> type_v_351;
+typedef std::tuple<double, var, int, std::vector<var>, std::vector<var>, empty> type_v_352;
+typedef std::tuple<double, var, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_353;
+typedef std::tuple<double, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_354;
+typedef std::tuple<double, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_355;
+typedef std::tuple<double, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_356;
+typedef std::tuple<double, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_357;
+typedef std::tuple<double, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_358;
+typedef std::tuple<double, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_359;
+typedef std::tuple<double, var, std::vector<int>, double, double, empty> type_v_360;
+typedef std::tuple<double, var, std::vector<int>, double, std::vector<double>, empty> type_v_361;
+typedef std::tuple<double, var, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_362;
+typedef std::tuple<double, var, std::vector<int>, double, var, empty> type_v_363;
+typedef std::tuple<double, var, std::vector<int>, double, std::vector<var>, empty> type_v_364;
+typedef std::tuple<double, var, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_365;
+typedef std::tuple<double, var, std::vector<int>, std::vector<double>, double, empty> type_v_366;
+typedef std::tuple<double, var, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_367;
+typedef std::tuple<double, var, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_368;
+typedef std::tuple<double, var, std::vector<int>, std::vector<double>, var, empty> type_v_369;
+typedef std::tuple<double, var, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_370;
+typedef std::tuple<double, var, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_371;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_372;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_373;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_374;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_375;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_376;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_377;
+typedef std::tuple<double, var, std::vector<int>, var, double, empty> type_v_378;
+typedef std::tuple<double, var, std::vector<int>, var, std::vector<double>, empty> type_v_379;
+typedef std::tuple<double, var, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_380;
+typedef std::tuple<double, var, std::vector<int>, var, var, empty> type_v_381;
+typedef std::tuple<double, var, std::vector<int>, var, std::vector<var>, empty> type_v_382;
+typedef std::tuple<double, var, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_383;
+typedef std::tuple<double, var, std::vector<int>, std::vector<var>, double, empty> type_v_384;
+typedef std::tuple<double, var, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_385;
+typedef std::tuple<double, var, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_386;
+typedef std::tuple<double, var, std::vector<int>, std::vector<var>, var, empty> type_v_387;
+typedef std::tuple<double, var, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_388;
+typedef std::tuple<double, var, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_389;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_390;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_391;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_392;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_393;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_394;
+typedef std::tuple<double, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_395;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_396;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_397;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_398;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_399;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_300> AgradDistributionNormalSufficient_v_300;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_301> AgradDistributionNormalSufficient_v_301;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_302> AgradDistributionNormalSufficient_v_302;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_303> AgradDistributionNormalSufficient_v_303;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_304> AgradDistributionNormalSufficient_v_304;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_305> AgradDistributionNormalSufficient_v_305;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_306> AgradDistributionNormalSufficient_v_306;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_307> AgradDistributionNormalSufficient_v_307;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_308> AgradDistributionNormalSufficient_v_308;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_309> AgradDistributionNormalSufficient_v_309;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_310> AgradDistributionNormalSufficient_v_310;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_311> AgradDistributionNormalSufficient_v_311;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_312> AgradDistributionNormalSufficient_v_312;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_313> AgradDistributionNormalSufficient_v_313;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_314> AgradDistributionNormalSufficient_v_314;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_315> AgradDistributionNormalSufficient_v_315;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_316> AgradDistributionNormalSufficient_v_316;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_317> AgradDistributionNormalSufficient_v_317;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_318> AgradDistributionNormalSufficient_v_318;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_319> AgradDistributionNormalSufficient_v_319;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_320> AgradDistributionNormalSufficient_v_320;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_321> AgradDistributionNormalSufficient_v_321;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_322> AgradDistributionNormalSufficient_v_322;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_323> AgradDistributionNormalSufficient_v_323;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_324> AgradDistributionNormalSufficient_v_324;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_325> AgradDistributionNormalSufficient_v_325;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_326> AgradDistributionNormalSufficient_v_326;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_327> AgradDistributionNormalSufficient_v_327;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_328> AgradDistributionNormalSufficient_v_328;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_329> AgradDistributionNormalSufficient_v_329;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_330> AgradDistributionNormalSufficient_v_330;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_331> AgradDistributionNormalSufficient_v_331;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_332> AgradDistributionNormalSufficient_v_332;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_333> AgradDistributionNormalSufficient_v_333;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_334> AgradDistributionNormalSufficient_v_334;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_335> AgradDistributionNormalSufficient_v_335;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_336> AgradDistributionNormalSufficient_v_336;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_337> AgradDistributionNormalSufficient_v_337;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_338> AgradDistributionNormalSufficient_v_338;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_339> AgradDistributionNormalSufficient_v_339;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_340> AgradDistributionNormalSufficient_v_340;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_341> AgradDistributionNormalSufficient_v_341;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_342> AgradDistributionNormalSufficient_v_342;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_343> AgradDistributionNormalSufficient_v_343;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_344> AgradDistributionNormalSufficient_v_344;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_345> AgradDistributionNormalSufficient_v_345;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_346> AgradDistributionNormalSufficient_v_346;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_347> AgradDistributionNormalSufficient_v_347;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_348> AgradDistributionNormalSufficient_v_348;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_349> AgradDistributionNormalSufficient_v_349;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_350> AgradDistributionNormalSufficient_v_350;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_351> AgradDistributionNormalSufficient_v_351;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_352> AgradDistributionNormalSufficient_v_352;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_353> AgradDistributionNormalSufficient_v_353;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_354> AgradDistributionNormalSufficient_v_354;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_355> AgradDistributionNormalSufficient_v_355;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_356> AgradDistributionNormalSufficient_v_356;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_357> AgradDistributionNormalSufficient_v_357;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_358> AgradDistributionNormalSufficient_v_358;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_359> AgradDistributionNormalSufficient_v_359;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_360> AgradDistributionNormalSufficient_v_360;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_361> AgradDistributionNormalSufficient_v_361;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_362> AgradDistributionNormalSufficient_v_362;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_363> AgradDistributionNormalSufficient_v_363;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_364> AgradDistributionNormalSufficient_v_364;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_365> AgradDistributionNormalSufficient_v_365;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_366> AgradDistributionNormalSufficient_v_366;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_367> AgradDistributionNormalSufficient_v_367;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_368> AgradDistributionNormalSufficient_v_368;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_369> AgradDistributionNormalSufficient_v_369;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_370> AgradDistributionNormalSufficient_v_370;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_371> AgradDistributionNormalSufficient_v_371;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_372> AgradDistributionNormalSufficient_v_372;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_373> AgradDistributionNormalSufficient_v_373;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_374> AgradDistributionNormalSufficient_v_374;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_375> AgradDistributionNormalSufficient_v_375;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_376> AgradDistributionNormalSufficient_v_376;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_377> AgradDistributionNormalSufficient_v_377;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_378> AgradDistributionNormalSufficient_v_378;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_379> AgradDistributionNormalSufficient_v_379;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_380> AgradDistributionNormalSufficient_v_380;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_381> AgradDistributionNormalSufficient_v_381;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_382> AgradDistributionNormalSufficient_v_382;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_383> AgradDistributionNormalSufficient_v_383;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_384> AgradDistributionNormalSufficient_v_384;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_385> AgradDistributionNormalSufficient_v_385;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_386> AgradDistributionNormalSufficient_v_386;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_387> AgradDistributionNormalSufficient_v_387;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_388> AgradDistributionNormalSufficient_v_388;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_389> AgradDistributionNormalSufficient_v_389;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_390> AgradDistributionNormalSufficient_v_390;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_391> AgradDistributionNormalSufficient_v_391;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_392> AgradDistributionNormalSufficient_v_392;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_393> AgradDistributionNormalSufficient_v_393;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_394> AgradDistributionNormalSufficient_v_394;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_395> AgradDistributionNormalSufficient_v_395;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_396> AgradDistributionNormalSufficient_v_396;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_397> AgradDistributionNormalSufficient_v_397;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_398> AgradDistributionNormalSufficient_v_398;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_399> AgradDistributionNormalSufficient_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_300, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_301, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_302, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_303, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_304, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_305, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_306, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_307, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_308, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_309, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_310, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_311, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_312, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_313, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_314, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_315, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_316, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_317, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_318, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_319, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_320, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_321, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_322, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_323, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_324, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_325, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_326, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_327, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_328, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_329, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_330, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_331, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_332, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_333, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_334, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_335, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_336, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_337, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_338, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_339, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_340, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_341, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_342, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_343, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_344, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_345, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_346, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_347, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_348, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_349, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_350, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_351, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_352, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_353, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_354, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_355, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_356, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_357, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_358, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_359, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_360, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_361, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_362, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_363, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_364, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_365, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_366, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_367, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_368, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_369, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_370, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_371, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_372, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_373, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_374, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_375, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_376, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_377, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_378, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_379, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_380, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_381, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_382, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_383, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_384, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_385, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_386, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_387, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_388, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_389, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_390, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_391, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_392, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_393, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_394, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_395, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_396, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_397, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_398, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_399, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_399);
+
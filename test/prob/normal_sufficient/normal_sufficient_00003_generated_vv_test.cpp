@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, var, std::vector<int>, var, var, empty> type_vv_300;
+typedef std::tuple<double, var, std::vector<int>, var, std::vector<var>, empty> type_vv_301;
+typedef std::tuple<double, var, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_302;
+typedef std::tuple<double, var, std::vector<int>, std::vector<var>, double, empty> type_vv_303;
+typedef std::tuple<double, var, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_304;
+typedef std::tuple<double, var, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_305;
+typedef std::tuple<double, var, std::vector<int>, std::vector<var>, var, empty> type_vv_306;
+typedef std::tuple<double, var, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_307;
+typedef std::tuple<double, var, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_308;
+typedef std::tuple<double, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_309;
+typedef std::tuple<double, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_310;
+typedef std::tuple<double, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_311;
+typedef std::tuple<double, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_312;
+typedef std::tuple<double, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_313;
+typedef std::tuple<double, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_314;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_315;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_316;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_317;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_318;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_319;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_320;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_321;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_322;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_323;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_324;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_325;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_326;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_327;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_328;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_329;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_330;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_331;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_332;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_333;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_334;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_335;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_336;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_337;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_338;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_339;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_340;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_341;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_342;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_343;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_344;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_345;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_346;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_347;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_348;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_349;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_350;
+typedef std::tuple<double, std::vector<var>, int, double, double, empty> type_vv_351;
+typedef std::tuple<double, std::vector<var>, int, double, std::vector<double>, empty> type_vv_352;
+typedef std::tuple<double, std::vector<var>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_353;
+typedef std::tuple<double, std::vector<var>, int, double, var, empty> type_vv_354;
+typedef std::tuple<double, std::vector<var>, int, double, std::vector<var>, empty> type_vv_355;
+typedef std::tuple<double, std::vector<var>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_356;
+typedef std::tuple<double, std::vector<var>, int, std::vector<double>, double, empty> type_vv_357;
+typedef std::tuple<double, std::vector<var>, int, std::vector<double>, std::vector<double>, empty> type_vv_358;
+typedef std::tuple<double, std::vector<var>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_359;
+typedef std::tuple<double, std::vector<var>, int, std::vector<double>, var, empty> type_vv_360;
+typedef std::tuple<double, std::vector<var>, int, std::vector<double>, std::vector<var>, empty> type_vv_361;
+typedef std::tuple<double, std::vector<var>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_362;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_363;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_364;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_365;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_366;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_367;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_368;
+typedef std::tuple<double, std::vector<var>, int, var, double, empty> type_vv_369;
+typedef std::tuple<double, std::vector<var>, int, var, std::vector<double>, empty> type_vv_370;
+typedef std::tuple<double, std::vector<var>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_371;
+typedef std::tuple<double, std::vector<var>, int, var, var, empty> type_vv_372;
+typedef std::tuple<double, std::vector<var>, int, var, std::vector<var>, empty> type_vv_373;
+typedef std::tuple<double, std::vector<var>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_374;
+typedef std::tuple<double, std::vector<var>, int, std::vector<var>, double, empty> type_vv_375;
+typedef std::tuple<double, std::vector<var>, int, std::vector<var>, std::vector<double>, empty> type_vv_376;
+typedef std::tuple<double, std::vector<var>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_377;
+typedef std::tuple<double, std::vector<var>, int, std::vector<var>, var, empty> type_vv_378;
+typedef std::tuple<double, std::vector<var>, int, std::vector<var>, std::vector<var>, empty> type_vv_379;
+typedef std::tuple<double, std::vector<var>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_380;
+typedef std::tuple<double, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_381;
+typedef std::tuple<double, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_382;
+typedef std::tuple<double, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_383;
+typedef std::tuple<double, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_384;
+typedef std::tuple<double, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_385;
+typedef std::tuple<double, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_386;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, double, double, empty> type_vv_387;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, double, std::vector<double>, empty> type_vv_388;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_389;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, double, var, empty> type_vv_390;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, double, std::vector<var>, empty> type_vv_391;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_392;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<double>, double, empty> type_vv_393;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_394;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_395;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<double>, var, empty> type_vv_396;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_397;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_398;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_399;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_300> AgradDistributionNormalSufficient_vv_300;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_301> AgradDistributionNormalSufficient_vv_301;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_302> AgradDistributionNormalSufficient_vv_302;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_303> AgradDistributionNormalSufficient_vv_303;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_304> AgradDistributionNormalSufficient_vv_304;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_305> AgradDistributionNormalSufficient_vv_305;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_306> AgradDistributionNormalSufficient_vv_306;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_307> AgradDistributionNormalSufficient_vv_307;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_308> AgradDistributionNormalSufficient_vv_308;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_309> AgradDistributionNormalSufficient_vv_309;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_310> AgradDistributionNormalSufficient_vv_310;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_311> AgradDistributionNormalSufficient_vv_311;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_312> AgradDistributionNormalSufficient_vv_312;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_313> AgradDistributionNormalSufficient_vv_313;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_314> AgradDistributionNormalSufficient_vv_314;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_315> AgradDistributionNormalSufficient_vv_315;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_316> AgradDistributionNormalSufficient_vv_316;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_317> AgradDistributionNormalSufficient_vv_317;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_318> AgradDistributionNormalSufficient_vv_318;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_319> AgradDistributionNormalSufficient_vv_319;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_320> AgradDistributionNormalSufficient_vv_320;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_321> AgradDistributionNormalSufficient_vv_321;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_322> AgradDistributionNormalSufficient_vv_322;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_323> AgradDistributionNormalSufficient_vv_323;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_324> AgradDistributionNormalSufficient_vv_324;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_325> AgradDistributionNormalSufficient_vv_325;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_326> AgradDistributionNormalSufficient_vv_326;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_327> AgradDistributionNormalSufficient_vv_327;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_328> AgradDistributionNormalSufficient_vv_328;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_329> AgradDistributionNormalSufficient_vv_329;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_330> AgradDistributionNormalSufficient_vv_330;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_331> AgradDistributionNormalSufficient_vv_331;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_332> AgradDistributionNormalSufficient_vv_332;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_333> AgradDistributionNormalSufficient_vv_333;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_334> AgradDistributionNormalSufficient_vv_334;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_335> AgradDistributionNormalSufficient_vv_335;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_336> AgradDistributionNormalSufficient_vv_336;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_337> AgradDistributionNormalSufficient_vv_337;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_338> AgradDistributionNormalSufficient_vv_338;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_339> AgradDistributionNormalSufficient_vv_339;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_340> AgradDistributionNormalSufficient_vv_340;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_341> AgradDistributionNormalSufficient_vv_341;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_342> AgradDistributionNormalSufficient_vv_342;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_343> AgradDistributionNormalSufficient_vv_343;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_344> AgradDistributionNormalSufficient_vv_344;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_345> AgradDistributionNormalSufficient_vv_345;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_346> AgradDistributionNormalSufficient_vv_346;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_347> AgradDistributionNormalSufficient_vv_347;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_348> AgradDistributionNormalSufficient_vv_348;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_349> AgradDistributionNormalSufficient_vv_349;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_350> AgradDistributionNormalSufficient_vv_350;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_351> AgradDistributionNormalSufficient_vv_351;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_352> AgradDistributionNormalSufficient_vv_352;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_353> AgradDistributionNormalSufficient_vv_353;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_354> AgradDistributionNormalSufficient_vv_354;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_355> AgradDistributionNormalSufficient_vv_355;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_356> AgradDistributionNormalSufficient_vv_356;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_357> AgradDistributionNormalSufficient_vv_357;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_358> AgradDistributionNormalSufficient_vv_358;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_359> AgradDistributionNormalSufficient_vv_359;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_360> AgradDistributionNormalSufficient_vv_360;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_361> AgradDistributionNormalSufficient_vv_361;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_362> AgradDistributionNormalSufficient_vv_362;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_363> AgradDistributionNormalSufficient_vv_363;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_364> AgradDistributionNormalSufficient_vv_364;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_365> AgradDistributionNormalSufficient_vv_365;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_366> AgradDistributionNormalSufficient_vv_366;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_367> AgradDistributionNormalSufficient_vv_367;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_368> AgradDistributionNormalSufficient_vv_368;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_369> AgradDistributionNormalSufficient_vv_369;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_370> AgradDistributionNormalSufficient_vv_370;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_371> AgradDistributionNormalSufficient_vv_371;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_372> AgradDistributionNormalSufficient_vv_372;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_373> AgradDistributionNormalSufficient_vv_373;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_374> AgradDistributionNormalSufficient_vv_374;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_375> AgradDistributionNormalSufficient_vv_375;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_376> AgradDistributionNormalSufficient_vv_376;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_377> AgradDistributionNormalSufficient_vv_377;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_378> AgradDistributionNormalSufficient_vv_378;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_379> AgradDistributionNormalSufficient_vv_379;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_380> AgradDistributionNormalSufficient_vv_380;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_381> AgradDistributionNormalSufficient_vv_381;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_382> AgradDistributionNormalSufficient_vv_382;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_383> AgradDistributionNormalSufficient_vv_383;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_384> AgradDistributionNormalSufficient_vv_384;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_385> AgradDistributionNormalSufficient_vv_385;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_386> AgradDistributionNormalSufficient_vv_386;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_387> AgradDistributionNormalSufficient_vv_387;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_388> AgradDistributionNormalSufficient_vv_388;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_389> AgradDistributionNormalSufficient_vv_389;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_390> AgradDistributionNormalSufficient_vv_390;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_391> AgradDistributionNormalSufficient_vv_391;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_392> AgradDistributionNormalSufficient_vv_392;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_393> AgradDistributionNormalSufficient_vv_393;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_394> AgradDistributionNormalSufficient_vv_394;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_395> AgradDistributionNormalSufficient_vv_395;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_396> AgradDistributionNormalSufficient_vv_396;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_397> AgradDistributionNormalSufficient_vv_397;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_398> AgradDistributionNormalSufficient_vv_398;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_399> AgradDistributionNormalSufficient_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_300, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_301, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_302, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_303, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_304, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_305, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_306, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_307, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_308, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_309, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_310, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_311, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_312, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_313, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_314, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_315, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_316, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_317, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_318, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_319, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_320, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_321, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_322, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_323, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_324, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_325, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_326, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_327, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_328, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_329, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_330, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_331, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_332, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_333, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_334, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_335, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_336, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_337, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_338, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_339, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_340, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_341, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_342, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_343, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_344, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_345, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_346, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_347, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_348, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_349, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_350, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_351, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_352, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_353, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_354, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_355, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_356, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_357, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_358, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_359, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_360, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_361, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_362, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_363, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_364, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_365, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_366, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_367, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_368, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_369, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_370, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_371, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_372, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_373, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_374, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_375, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_376, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_377, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_378, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_379, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_380, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_381, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_382, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_383, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_384, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_385, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_386, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_387, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_388, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_389, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_390, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_391, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_392, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_393, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_394, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_395, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_396, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_397, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_398, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_399, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_399);
+
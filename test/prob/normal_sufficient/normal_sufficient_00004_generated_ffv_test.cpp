@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_400;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_401;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_402;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_403;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_404;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_405;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_406;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_407;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_408;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_409;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_410;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_411;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_412;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_413;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_414;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_415;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_416;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_417;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_418;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_419;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_420;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_421;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_422;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_423;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_424;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_425;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_426;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_427;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_428;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_429;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_430;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_431;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_432;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_433;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_434;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_435;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_436;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_437;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_438;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_439;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_440;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_441;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_442;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_443;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_444;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_445;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_446;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_447;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_448;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_449;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_450;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_451;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_452;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_453;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_454;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_455;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_456;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_457;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_458;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, double, empty> type_ffv_459;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_ffv_460;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_461;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty> type_ffv_462;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_463;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_464;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_ffv_465;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_ffv_466;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_467;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_468;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_469;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_470;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_471;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_472;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_473;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_474;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_475;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_476;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, double, empty> type_ffv_477;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_478;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_479;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_480;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_481;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_482;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_483;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_484;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_485;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_486;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_487;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_488;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_489;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_490;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_491;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_492;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_493;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_494;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty> type_ffv_495;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty> type_ffv_496;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_497;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_498;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_499;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_400> AgradDistributionNormalSufficient_ffv_400;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_401> AgradDistributionNormalSufficient_ffv_401;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_402> AgradDistributionNormalSufficient_ffv_402;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_403> AgradDistributionNormalSufficient_ffv_403;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_404> AgradDistributionNormalSufficient_ffv_404;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_405> AgradDistributionNormalSufficient_ffv_405;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_406> AgradDistributionNormalSufficient_ffv_406;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_407> AgradDistributionNormalSufficient_ffv_407;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_408> AgradDistributionNormalSufficient_ffv_408;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_409> AgradDistributionNormalSufficient_ffv_409;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_410> AgradDistributionNormalSufficient_ffv_410;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_411> AgradDistributionNormalSufficient_ffv_411;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_412> AgradDistributionNormalSufficient_ffv_412;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_413> AgradDistributionNormalSufficient_ffv_413;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_414> AgradDistributionNormalSufficient_ffv_414;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_415> AgradDistributionNormalSufficient_ffv_415;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_416> AgradDistributionNormalSufficient_ffv_416;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_417> AgradDistributionNormalSufficient_ffv_417;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_418> AgradDistributionNormalSufficient_ffv_418;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_419> AgradDistributionNormalSufficient_ffv_419;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_420> AgradDistributionNormalSufficient_ffv_420;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_421> AgradDistributionNormalSufficient_ffv_421;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_422> AgradDistributionNormalSufficient_ffv_422;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_423> AgradDistributionNormalSufficient_ffv_423;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_424> AgradDistributionNormalSufficient_ffv_424;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_425> AgradDistributionNormalSufficient_ffv_425;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_426> AgradDistributionNormalSufficient_ffv_426;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_427> AgradDistributionNormalSufficient_ffv_427;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_428> AgradDistributionNormalSufficient_ffv_428;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_429> AgradDistributionNormalSufficient_ffv_429;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_430> AgradDistributionNormalSufficient_ffv_430;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_431> AgradDistributionNormalSufficient_ffv_431;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_432> AgradDistributionNormalSufficient_ffv_432;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_433> AgradDistributionNormalSufficient_ffv_433;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_434> AgradDistributionNormalSufficient_ffv_434;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_435> AgradDistributionNormalSufficient_ffv_435;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_436> AgradDistributionNormalSufficient_ffv_436;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_437> AgradDistributionNormalSufficient_ffv_437;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_438> AgradDistributionNormalSufficient_ffv_438;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_439> AgradDistributionNormalSufficient_ffv_439;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_440> AgradDistributionNormalSufficient_ffv_440;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_441> AgradDistributionNormalSufficient_ffv_441;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_442> AgradDistributionNormalSufficient_ffv_442;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_443> AgradDistributionNormalSufficient_ffv_443;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_444> AgradDistributionNormalSufficient_ffv_444;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_445> AgradDistributionNormalSufficient_ffv_445;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_446> AgradDistributionNormalSufficient_ffv_446;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_447> AgradDistributionNormalSufficient_ffv_447;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_448> AgradDistributionNormalSufficient_ffv_448;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_449> AgradDistributionNormalSufficient_ffv_449;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_450> AgradDistributionNormalSufficient_ffv_450;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_451> AgradDistributionNormalSufficient_ffv_451;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_452> AgradDistributionNormalSufficient_ffv_452;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_453> AgradDistributionNormalSufficient_ffv_453;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_454> AgradDistributionNormalSufficient_ffv_454;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_455> AgradDistributionNormalSufficient_ffv_455;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_456> AgradDistributionNormalSufficient_ffv_456;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_457> AgradDistributionNormalSufficient_ffv_457;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_458> AgradDistributionNormalSufficient_ffv_458;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_459> AgradDistributionNormalSufficient_ffv_459;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_460> AgradDistributionNormalSufficient_ffv_460;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_461> AgradDistributionNormalSufficient_ffv_461;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_462> AgradDistributionNormalSufficient_ffv_462;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_463> AgradDistributionNormalSufficient_ffv_463;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_464> AgradDistributionNormalSufficient_ffv_464;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_465> AgradDistributionNormalSufficient_ffv_465;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_466> AgradDistributionNormalSufficient_ffv_466;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_467> AgradDistributionNormalSufficient_ffv_467;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_468> AgradDistributionNormalSufficient_ffv_468;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_469> AgradDistributionNormalSufficient_ffv_469;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_470> AgradDistributionNormalSufficient_ffv_470;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_471> AgradDistributionNormalSufficient_ffv_471;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_472> AgradDistributionNormalSufficient_ffv_472;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_473> AgradDistributionNormalSufficient_ffv_473;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_474> AgradDistributionNormalSufficient_ffv_474;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_475> AgradDistributionNormalSufficient_ffv_475;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_476> AgradDistributionNormalSufficient_ffv_476;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_477> AgradDistributionNormalSufficient_ffv_477;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_478> AgradDistributionNormalSufficient_ffv_478;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_479> AgradDistributionNormalSufficient_ffv_479;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_480> AgradDistributionNormalSufficient_ffv_480;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_481> AgradDistributionNormalSufficient_ffv_481;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_482> AgradDistributionNormalSufficient_ffv_482;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_483> AgradDistributionNormalSufficient_ffv_483;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_484> AgradDistributionNormalSufficient_ffv_484;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_485> AgradDistributionNormalSufficient_ffv_485;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_486> AgradDistributionNormalSufficient_ffv_486;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_487> AgradDistributionNormalSufficient_ffv_487;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_488> AgradDistributionNormalSufficient_ffv_488;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_489> AgradDistributionNormalSufficient_ffv_489;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_490> AgradDistributionNormalSufficient_ffv_490;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_491> AgradDistributionNormalSufficient_ffv_491;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_492> AgradDistributionNormalSufficient_ffv_492;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_493> AgradDistributionNormalSufficient_ffv_493;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_494> AgradDistributionNormalSufficient_ffv_494;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_495> AgradDistributionNormalSufficient_ffv_495;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_496> AgradDistributionNormalSufficient_ffv_496;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_497> AgradDistributionNormalSufficient_ffv_497;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_498> AgradDistributionNormalSufficient_ffv_498;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_499> AgradDistributionNormalSufficient_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_400, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_401, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_402, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_403, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_404, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_405, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_406, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_407, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_408, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_409, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_410, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_411, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_412, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_413, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_414, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_415, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_416, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_417, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_418, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_419, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_420, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_421, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_422, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_423, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_424, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_425, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_426, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_427, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_428, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_429, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_430, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_431, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_432, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_433, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_434, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_435, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_436, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_437, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_438, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_439, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_440, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_441, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_442, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_443, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_444, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_445, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_446, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_447, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_448, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_449, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_450, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_451, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_452, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_453, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_454, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_455, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_456, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_457, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_458, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_459, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_460, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_461, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_462, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_463, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_464, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_465, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_466, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_467, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_468, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_469, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_470, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_471, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_472, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_473, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_474, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_475, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_476, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_477, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_478, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_479, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_480, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_481, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_482, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_483, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_484, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_485, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_486, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_487, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_488, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_489, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_490, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_491, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_492, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_493, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_494, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_495, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_496, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_497, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_498, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_499, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_400;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_401;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_402;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_403;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_404;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_405;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_406;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_407;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_408;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_409;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_410;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_411;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_412;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_413;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_414;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_415;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_416;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_417;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_418;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_419;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_420;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_421;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_422;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_423;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_424;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_425;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_426;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_427;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_428;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_429;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_430;
+typedef std::tuple<double, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_431;
+typedef std::tuple<double, std::vector<var>, int, double, double, empty> type_v_432;
+typedef std::tuple<double, std::vector<var>, int, double, std::vector<double>, empty> type_v_433;
+typedef std::tuple<double, std::vector<var>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_434;
+typedef std::tuple<double, std::vector<var>, int, double, var, empty> type_v_435;
+typedef std::tuple<double, std::vector<var>, int, double, std::vector<var>, empty> type_v_436;
+typedef std::tuple<double, std::vector<var>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_437;
+typedef std::tuple<double, std::vector<var>, int, std::vector<double>, double, empty> type_v_438;
+typedef std::tuple<double, std::vector<var>, int, std::vector<double>, std::vector<double>, empty> type_v_439;
+typedef std::tuple<double, std::vector<var>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_440;
+typedef std::tuple<double, std::vector<var>, int, std::vector<double>, var, empty> type_v_441;
+typedef std::tuple<double, std::vector<var>, int, std::vector<double>, std::vector<var>, empty> type_v_442;
+typedef std::tuple<double, std::vector<var>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_443;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_444;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_445;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_446;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_447;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_448;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_449;
+typedef std::tuple<double, std::vector<var>, int, var, double, empty> type_v_450;
+typedef std::tuple<double, std::vector<var>, int, var, std::vector<double>, empty> type_v_451;
+typedef std::tuple<double, std::vector<var>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_452;
+typedef std::tuple<double, std::vector<var>, int, var, var, empty> type_v_453;
+typedef std::tuple<double, std::vector<var>, int, var, std::vector<var>, empty> type_v_454;
+typedef std::tuple<double, std::vector<var>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_455;
+typedef std::tuple<double, std::vector<var>, int, std::vector<var>, double, empty> type_v_456;
+typedef std::tuple<double, std::vector<var>, int, std::vector<var>, std::vector<double>, empty> type_v_457;
+typedef std::tuple<double, std::vector<var>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_458;
+typedef std::tuple<double, std::vector<var>, int, std::vector<var>, var, empty> type_v_459;
+typedef std::tuple<double, std::vector<var>, int, std::vector<var>, std::vector<var>, empty> type_v_460;
+typedef std::tuple<double, std::vector<var>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_461;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_462;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_463;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_464;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_465;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_466;
+typedef std::tuple<double, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_467;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, double, double, empty> type_v_468;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, double, std::vector<double>, empty> type_v_469;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_470;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, double, var, empty> type_v_471;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, double, std::vector<var>, empty> type_v_472;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_473;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<double>, double, empty> type_v_474;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_475;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_476;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<double>, var, empty> type_v_477;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_478;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_479;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_480;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_481;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_482;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_483;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_484;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_485;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, var, double, empty> type_v_486;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, var, std::vector<double>, empty> type_v_487;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_488;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, var, var, empty> type_v_489;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, var, std::vector<var>, empty> type_v_490;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_491;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<var>, double, empty> type_v_492;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_493;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_494;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<var>, var, empty> type_v_495;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_496;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_497;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_498;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_499;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_400> AgradDistributionNormalSufficient_v_400;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_401> AgradDistributionNormalSufficient_v_401;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_402> AgradDistributionNormalSufficient_v_402;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_403> AgradDistributionNormalSufficient_v_403;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_404> AgradDistributionNormalSufficient_v_404;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_405> AgradDistributionNormalSufficient_v_405;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_406> AgradDistributionNormalSufficient_v_406;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_407> AgradDistributionNormalSufficient_v_407;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_408> AgradDistributionNormalSufficient_v_408;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_409> AgradDistributionNormalSufficient_v_409;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_410> AgradDistributionNormalSufficient_v_410;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_411> AgradDistributionNormalSufficient_v_411;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_412> AgradDistributionNormalSufficient_v_412;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_413> AgradDistributionNormalSufficient_v_413;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_414> AgradDistributionNormalSufficient_v_414;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_415> AgradDistributionNormalSufficient_v_415;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_416> AgradDistributionNormalSufficient_v_416;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_417> AgradDistributionNormalSufficient_v_417;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_418> AgradDistributionNormalSufficient_v_418;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_419> AgradDistributionNormalSufficient_v_419;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_420> AgradDistributionNormalSufficient_v_420;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_421> AgradDistributionNormalSufficient_v_421;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_422> AgradDistributionNormalSufficient_v_422;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_423> AgradDistributionNormalSufficient_v_423;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_424> AgradDistributionNormalSufficient_v_424;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_425> AgradDistributionNormalSufficient_v_425;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_426> AgradDistributionNormalSufficient_v_426;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_427> AgradDistributionNormalSufficient_v_427;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_428> AgradDistributionNormalSufficient_v_428;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_429> AgradDistributionNormalSufficient_v_429;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_430> AgradDistributionNormalSufficient_v_430;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_431> AgradDistributionNormalSufficient_v_431;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_432> AgradDistributionNormalSufficient_v_432;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_433> AgradDistributionNormalSufficient_v_433;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_434> AgradDistributionNormalSufficient_v_434;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_435> AgradDistributionNormalSufficient_v_435;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_436> AgradDistributionNormalSufficient_v_436;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_437> AgradDistributionNormalSufficient_v_437;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_438> AgradDistributionNormalSufficient_v_438;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_439> AgradDistributionNormalSufficient_v_439;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_440> AgradDistributionNormalSufficient_v_440;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_441> AgradDistributionNormalSufficient_v_441;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_442> AgradDistributionNormalSufficient_v_442;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_443> AgradDistributionNormalSufficient_v_443;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_444> AgradDistributionNormalSufficient_v_444;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_445> AgradDistributionNormalSufficient_v_445;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_446> AgradDistributionNormalSufficient_v_446;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_447> AgradDistributionNormalSufficient_v_447;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_448> AgradDistributionNormalSufficient_v_448;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_449> AgradDistributionNormalSufficient_v_449;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_450> AgradDistributionNormalSufficient_v_450;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_451> AgradDistributionNormalSufficient_v_451;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_452> AgradDistributionNormalSufficient_v_452;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_453> AgradDistributionNormalSufficient_v_453;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_454> AgradDistributionNormalSufficient_v_454;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_455> AgradDistributionNormalSufficient_v_455;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_456> AgradDistributionNormalSufficient_v_456;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_457> AgradDistributionNormalSufficient_v_457;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_458> AgradDistributionNormalSufficient_v_458;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_459> AgradDistributionNormalSufficient_v_459;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_460> AgradDistributionNormalSufficient_v_460;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_461> AgradDistributionNormalSufficient_v_461;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_462> AgradDistributionNormalSufficient_v_462;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_463> AgradDistributionNormalSufficient_v_463;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_464> AgradDistributionNormalSufficient_v_464;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_465> AgradDistributionNormalSufficient_v_465;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_466> AgradDistributionNormalSufficient_v_466;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_467> AgradDistributionNormalSufficient_v_467;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_468> AgradDistributionNormalSufficient_v_468;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_469> AgradDistributionNormalSufficient_v_469;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_470> AgradDistributionNormalSufficient_v_470;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_471> AgradDistributionNormalSufficient_v_471;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_472> AgradDistributionNormalSufficient_v_472;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_473> AgradDistributionNormalSufficient_v_473;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_474> AgradDistributionNormalSufficient_v_474;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_475> AgradDistributionNormalSufficient_v_475;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_476> AgradDistributionNormalSufficient_v_476;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_477> AgradDistributionNormalSufficient_v_477;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_478> AgradDistributionNormalSufficient_v_478;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_479> AgradDistributionNormalSufficient_v_479;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_480> AgradDistributionNormalSufficient_v_480;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_481> AgradDistributionNormalSufficient_v_481;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_482> AgradDistributionNormalSufficient_v_482;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_483> AgradDistributionNormalSufficient_v_483;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_484> AgradDistributionNormalSufficient_v_484;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_485> AgradDistributionNormalSufficient_v_485;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_486> AgradDistributionNormalSufficient_v_486;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_487> AgradDistributionNormalSufficient_v_487;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_488> AgradDistributionNormalSufficient_v_488;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_489> AgradDistributionNormalSufficient_v_489;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_490> AgradDistributionNormalSufficient_v_490;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_491> AgradDistributionNormalSufficient_v_491;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_492> AgradDistributionNormalSufficient_v_492;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_493> AgradDistributionNormalSufficient_v_493;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_494> AgradDistributionNormalSufficient_v_494;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_495> AgradDistributionNormalSufficient_v_495;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_496> AgradDistributionNormalSufficient_v_496;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_497> AgradDistributionNormalSufficient_v_497;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_498> AgradDistributionNormalSufficient_v_498;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_499> AgradDistributionNormalSufficient_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_400, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_401, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_402, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_403, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_404, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_405, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_406, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_407, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_408, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_409, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_410, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_411, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_412, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_413, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_414, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_415, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_416, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_417, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_418, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_419, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_420, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_421, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_422, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_423, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_424, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_425, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_426, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_427, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_428, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_429, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_430, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_431, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_432, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_433, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_434, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_435, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_436, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_437, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_438, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_439, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_440, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_441, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_442, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_443, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_444, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_445, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_446, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_447, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_448, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_449, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_450, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_451, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_452, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_453, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_454, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_455, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_456, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_457, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_458, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_459, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_460, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_461, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_462, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_463, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_464, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_465, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_466, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_467, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_468, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_469, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_470, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_471, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_472, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_473, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_474, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_475, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_476, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_477, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_478, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_479, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_480, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_481, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_482, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_483, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_484, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_485, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_486, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_487, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_488, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_489, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_490, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_491, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_492, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_493, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_494, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_495, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_496, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_497, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_498, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_499, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_499);
+
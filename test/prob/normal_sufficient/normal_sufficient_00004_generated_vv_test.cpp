@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_400;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_401;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_402;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_403;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_404;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, var, double, empty> type_vv_405;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, var, std::vector<double>, empty> type_vv_406;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_407;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, var, var, empty> type_vv_408;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, var, std::vector<var>, empty> type_vv_409;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_410;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<var>, double, empty> type_vv_411;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_412;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_413;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<var>, var, empty> type_vv_414;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_415;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_416;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_417;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_418;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_419;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_420;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_421;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_422;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_423;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_424;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_425;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_426;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_427;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_428;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_429;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_430;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_431;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_432;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_433;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_434;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_435;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_436;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_437;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_438;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_439;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_440;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_441;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_442;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_443;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_444;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_445;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_446;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_447;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_448;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_449;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_450;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_451;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_452;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_453;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_454;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_455;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_456;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_457;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_458;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, double, double, empty> type_vv_459;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, double, std::vector<double>, empty> type_vv_460;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_461;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, double, var, empty> type_vv_462;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, double, std::vector<var>, empty> type_vv_463;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_464;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<double>, double, empty> type_vv_465;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<double>, std::vector<double>, empty> type_vv_466;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_467;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<double>, var, empty> type_vv_468;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<double>, std::vector<var>, empty> type_vv_469;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_470;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_471;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_472;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_473;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_474;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_475;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_476;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, var, double, empty> type_vv_477;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, var, std::vector<double>, empty> type_vv_478;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_479;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, var, var, empty> type_vv_480;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, var, std::vector<var>, empty> type_vv_481;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_482;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<var>, double, empty> type_vv_483;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<var>, std::vector<double>, empty> type_vv_484;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_485;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<var>, var, empty> type_vv_486;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<var>, std::vector<var>, empty> type_vv_487;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_488;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_489;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_490;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_491;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_492;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_493;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_494;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, double, double, empty> type_vv_495;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, double, std::vector<double>, empty> type_vv_496;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_497;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, double, var, empty> type_vv_498;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, double, std::vector<var>, empty> type_vv_499;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_400> AgradDistributionNormalSufficient_vv_400;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_401> AgradDistributionNormalSufficient_vv_401;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_402> AgradDistributionNormalSufficient_vv_402;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_403> AgradDistributionNormalSufficient_vv_403;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_404> AgradDistributionNormalSufficient_vv_404;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_405> AgradDistributionNormalSufficient_vv_405;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_406> AgradDistributionNormalSufficient_vv_406;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_407> AgradDistributionNormalSufficient_vv_407;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_408> AgradDistributionNormalSufficient_vv_408;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_409> AgradDistributionNormalSufficient_vv_409;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_410> AgradDistributionNormalSufficient_vv_410;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_411> AgradDistributionNormalSufficient_vv_411;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_412> AgradDistributionNormalSufficient_vv_412;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_413> AgradDistributionNormalSufficient_vv_413;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_414> AgradDistributionNormalSufficient_vv_414;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_415> AgradDistributionNormalSufficient_vv_415;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_416> AgradDistributionNormalSufficient_vv_416;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_417> AgradDistributionNormalSufficient_vv_417;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_418> AgradDistributionNormalSufficient_vv_418;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_419> AgradDistributionNormalSufficient_vv_419;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_420> AgradDistributionNormalSufficient_vv_420;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_421> AgradDistributionNormalSufficient_vv_421;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_422> AgradDistributionNormalSufficient_vv_422;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_423> AgradDistributionNormalSufficient_vv_423;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_424> AgradDistributionNormalSufficient_vv_424;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_425> AgradDistributionNormalSufficient_vv_425;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_426> AgradDistributionNormalSufficient_vv_426;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_427> AgradDistributionNormalSufficient_vv_427;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_428> AgradDistributionNormalSufficient_vv_428;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_429> AgradDistributionNormalSufficient_vv_429;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_430> AgradDistributionNormalSufficient_vv_430;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_431> AgradDistributionNormalSufficient_vv_431;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_432> AgradDistributionNormalSufficient_vv_432;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_433> AgradDistributionNormalSufficient_vv_433;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_434> AgradDistributionNormalSufficient_vv_434;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_435> AgradDistributionNormalSufficient_vv_435;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_436> AgradDistributionNormalSufficient_vv_436;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_437> AgradDistributionNormalSufficient_vv_437;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_438> AgradDistributionNormalSufficient_vv_438;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_439> AgradDistributionNormalSufficient_vv_439;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_440> AgradDistributionNormalSufficient_vv_440;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_441> AgradDistributionNormalSufficient_vv_441;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_442> AgradDistributionNormalSufficient_vv_442;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_443> AgradDistributionNormalSufficient_vv_443;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_444> AgradDistributionNormalSufficient_vv_444;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_445> AgradDistributionNormalSufficient_vv_445;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_446> AgradDistributionNormalSufficient_vv_446;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_447> AgradDistributionNormalSufficient_vv_447;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_448> AgradDistributionNormalSufficient_vv_448;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_449> AgradDistributionNormalSufficient_vv_449;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_450> AgradDistributionNormalSufficient_vv_450;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_451> AgradDistributionNormalSufficient_vv_451;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_452> AgradDistributionNormalSufficient_vv_452;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_453> AgradDistributionNormalSufficient_vv_453;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_454> AgradDistributionNormalSufficient_vv_454;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_455> AgradDistributionNormalSufficient_vv_455;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_456> AgradDistributionNormalSufficient_vv_456;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_457> AgradDistributionNormalSufficient_vv_457;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_458> AgradDistributionNormalSufficient_vv_458;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_459> AgradDistributionNormalSufficient_vv_459;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_460> AgradDistributionNormalSufficient_vv_460;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_461> AgradDistributionNormalSufficient_vv_461;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_462> AgradDistributionNormalSufficient_vv_462;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_463> AgradDistributionNormalSufficient_vv_463;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_464> AgradDistributionNormalSufficient_vv_464;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_465> AgradDistributionNormalSufficient_vv_465;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_466> AgradDistributionNormalSufficient_vv_466;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_467> AgradDistributionNormalSufficient_vv_467;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_468> AgradDistributionNormalSufficient_vv_468;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_469> AgradDistributionNormalSufficient_vv_469;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_470> AgradDistributionNormalSufficient_vv_470;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_471> AgradDistributionNormalSufficient_vv_471;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_472> AgradDistributionNormalSufficient_vv_472;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_473> AgradDistributionNormalSufficient_vv_473;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_474> AgradDistributionNormalSufficient_vv_474;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_475> AgradDistributionNormalSufficient_vv_475;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_476> AgradDistributionNormalSufficient_vv_476;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_477> AgradDistributionNormalSufficient_vv_477;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_478> AgradDistributionNormalSufficient_vv_478;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_479> AgradDistributionNormalSufficient_vv_479;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_480> AgradDistributionNormalSufficient_vv_480;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_481> AgradDistributionNormalSufficient_vv_481;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_482> AgradDistributionNormalSufficient_vv_482;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_483> AgradDistributionNormalSufficient_vv_483;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_484> AgradDistributionNormalSufficient_vv_484;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_485> AgradDistributionNormalSufficient_vv_485;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_486> AgradDistributionNormalSufficient_vv_486;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_487> AgradDistributionNormalSufficient_vv_487;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_488> AgradDistributionNormalSufficient_vv_488;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_489> AgradDistributionNormalSufficient_vv_489;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_490> AgradDistributionNormalSufficient_vv_490;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_491> AgradDistributionNormalSufficient_vv_491;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_492> AgradDistributionNormalSufficient_vv_492;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_493> AgradDistributionNormalSufficient_vv_493;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_494> AgradDistributionNormalSufficient_vv_494;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_495> AgradDistributionNormalSufficient_vv_495;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_496> AgradDistributionNormalSufficient_vv_496;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_497> AgradDistributionNormalSufficient_vv_497;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_498> AgradDistributionNormalSufficient_vv_498;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_499> AgradDistributionNormalSufficient_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_400, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_401, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_402, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_403, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_404, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_405, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_406, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_407, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_408, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_409, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_410, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_411, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_412, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_413, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_414, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_415, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_416, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_417, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_418, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_419, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_420, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_421, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_422, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_423, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_424, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_425, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_426, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_427, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_428, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_429, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_430, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_431, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_432, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_433, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_434, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_435, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_436, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_437, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_438, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_439, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_440, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_441, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_442, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_443, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_444, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_445, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_446, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_447, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_448, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_449, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_450, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_451, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_452, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_453, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_454, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_455, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_456, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_457, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_458, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_459, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_460, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_461, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_462, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_463, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_464, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_465, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_466, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_467, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_468, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_469, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_470, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_471, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_472, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_473, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_474, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_475, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_476, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_477, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_478, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_479, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_480, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_481, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_482, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_483, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_484, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_485, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_486, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_487, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_488, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_489, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_490, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_491, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_492, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_493, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_494, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_495, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_496, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_497, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_498, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_499, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_499);
+
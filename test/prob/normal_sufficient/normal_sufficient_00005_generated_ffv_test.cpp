@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_500;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_ffv_501;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_502;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_503;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_504;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_505;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_506;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_507;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_508;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_509;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_510;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_511;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_512;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_513;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_514;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_515;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_516;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_517;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_518;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_519;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_520;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_521;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_522;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_523;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_524;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_525;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_526;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_527;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_528;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_529;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_530;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_531;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_532;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_533;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_534;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_535;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_536;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_537;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_538;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_539;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_540;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_541;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_542;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_543;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_544;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_545;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_546;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_547;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_548;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_549;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_550;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_551;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_552;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_553;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_554;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_555;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_556;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_557;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_558;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_559;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_560;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_561;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_562;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_563;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_564;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_565;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_566;
+typedef std::tuple<std::vector<double>, double, int, double, fvar<fvar<var> >, empty> type_ffv_567;
+typedef std::tuple<std::vector<double>, double, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_568;
+typedef std::tuple<std::vector<double>, double, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_569;
+typedef std::tuple<std::vector<double>, double, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_570;
+typedef std::tuple<std::vector<double>, double, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_571;
+typedef std::tuple<std::vector<double>, double, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_572;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_573;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_574;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_575;
+typedef std::tuple<std::vector<double>, double, int, fvar<fvar<var> >, double, empty> type_ffv_576;
+typedef std::tuple<std::vector<double>, double, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_577;
+typedef std::tuple<std::vector<double>, double, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_578;
+typedef std::tuple<std::vector<double>, double, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_579;
+typedef std::tuple<std::vector<double>, double, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_580;
+typedef std::tuple<std::vector<double>, double, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_581;
+typedef std::tuple<std::vector<double>, double, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_582;
+typedef std::tuple<std::vector<double>, double, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_583;
+typedef std::tuple<std::vector<double>, double, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_584;
+typedef std::tuple<std::vector<double>, double, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_585;
+typedef std::tuple<std::vector<double>, double, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_586;
+typedef std::tuple<std::vector<double>, double, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_587;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_588;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_589;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_590;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_591;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_592;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_593;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_594;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_595;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_596;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_597;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_598;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_599;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_500> AgradDistributionNormalSufficient_ffv_500;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_501> AgradDistributionNormalSufficient_ffv_501;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_502> AgradDistributionNormalSufficient_ffv_502;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_503> AgradDistributionNormalSufficient_ffv_503;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_504> AgradDistributionNormalSufficient_ffv_504;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_505> AgradDistributionNormalSufficient_ffv_505;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_506> AgradDistributionNormalSufficient_ffv_506;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_507> AgradDistributionNormalSufficient_ffv_507;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_508> AgradDistributionNormalSufficient_ffv_508;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_509> AgradDistributionNormalSufficient_ffv_509;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_510> AgradDistributionNormalSufficient_ffv_510;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_511> AgradDistributionNormalSufficient_ffv_511;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_512> AgradDistributionNormalSufficient_ffv_512;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_513> AgradDistributionNormalSufficient_ffv_513;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_514> AgradDistributionNormalSufficient_ffv_514;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_515> AgradDistributionNormalSufficient_ffv_515;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_516> AgradDistributionNormalSufficient_ffv_516;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_517> AgradDistributionNormalSufficient_ffv_517;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_518> AgradDistributionNormalSufficient_ffv_518;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_519> AgradDistributionNormalSufficient_ffv_519;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_520> AgradDistributionNormalSufficient_ffv_520;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_521> AgradDistributionNormalSufficient_ffv_521;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_522> AgradDistributionNormalSufficient_ffv_522;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_523> AgradDistributionNormalSufficient_ffv_523;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_524> AgradDistributionNormalSufficient_ffv_524;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_525> AgradDistributionNormalSufficient_ffv_525;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_526> AgradDistributionNormalSufficient_ffv_526;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_527> AgradDistributionNormalSufficient_ffv_527;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_528> AgradDistributionNormalSufficient_ffv_528;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_529> AgradDistributionNormalSufficient_ffv_529;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_530> AgradDistributionNormalSufficient_ffv_530;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_531> AgradDistributionNormalSufficient_ffv_531;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_532> AgradDistributionNormalSufficient_ffv_532;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_533> AgradDistributionNormalSufficient_ffv_533;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_534> AgradDistributionNormalSufficient_ffv_534;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_535> AgradDistributionNormalSufficient_ffv_535;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_536> AgradDistributionNormalSufficient_ffv_536;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_537> AgradDistributionNormalSufficient_ffv_537;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_538> AgradDistributionNormalSufficient_ffv_538;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_539> AgradDistributionNormalSufficient_ffv_539;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_540> AgradDistributionNormalSufficient_ffv_540;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_541> AgradDistributionNormalSufficient_ffv_541;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_542> AgradDistributionNormalSufficient_ffv_542;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_543> AgradDistributionNormalSufficient_ffv_543;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_544> AgradDistributionNormalSufficient_ffv_544;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_545> AgradDistributionNormalSufficient_ffv_545;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_546> AgradDistributionNormalSufficient_ffv_546;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_547> AgradDistributionNormalSufficient_ffv_547;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_548> AgradDistributionNormalSufficient_ffv_548;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_549> AgradDistributionNormalSufficient_ffv_549;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_550> AgradDistributionNormalSufficient_ffv_550;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_551> AgradDistributionNormalSufficient_ffv_551;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_552> AgradDistributionNormalSufficient_ffv_552;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_553> AgradDistributionNormalSufficient_ffv_553;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_554> AgradDistributionNormalSufficient_ffv_554;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_555> AgradDistributionNormalSufficient_ffv_555;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_556> AgradDistributionNormalSufficient_ffv_556;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_557> AgradDistributionNormalSufficient_ffv_557;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_558> AgradDistributionNormalSufficient_ffv_558;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_559> AgradDistributionNormalSufficient_ffv_559;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_560> AgradDistributionNormalSufficient_ffv_560;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_561> AgradDistributionNormalSufficient_ffv_561;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_562> AgradDistributionNormalSufficient_ffv_562;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_563> AgradDistributionNormalSufficient_ffv_563;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_564> AgradDistributionNormalSufficient_ffv_564;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_565> AgradDistributionNormalSufficient_ffv_565;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_566> AgradDistributionNormalSufficient_ffv_566;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_567> AgradDistributionNormalSufficient_ffv_567;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_568> AgradDistributionNormalSufficient_ffv_568;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_569> AgradDistributionNormalSufficient_ffv_569;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_570> AgradDistributionNormalSufficient_ffv_570;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_571> AgradDistributionNormalSufficient_ffv_571;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_572> AgradDistributionNormalSufficient_ffv_572;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_573> AgradDistributionNormalSufficient_ffv_573;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_574> AgradDistributionNormalSufficient_ffv_574;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_575> AgradDistributionNormalSufficient_ffv_575;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_576> AgradDistributionNormalSufficient_ffv_576;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_577> AgradDistributionNormalSufficient_ffv_577;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_578> AgradDistributionNormalSufficient_ffv_578;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_579> AgradDistributionNormalSufficient_ffv_579;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_580> AgradDistributionNormalSufficient_ffv_580;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_581> AgradDistributionNormalSufficient_ffv_581;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_582> AgradDistributionNormalSufficient_ffv_582;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_583> AgradDistributionNormalSufficient_ffv_583;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_584> AgradDistributionNormalSufficient_ffv_584;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_585> AgradDistributionNormalSufficient_ffv_585;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_586> AgradDistributionNormalSufficient_ffv_586;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_587> AgradDistributionNormalSufficient_ffv_587;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_588> AgradDistributionNormalSufficient_ffv_588;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_589> AgradDistributionNormalSufficient_ffv_589;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_590> AgradDistributionNormalSufficient_ffv_590;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_591> AgradDistributionNormalSufficient_ffv_591;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_592> AgradDistributionNormalSufficient_ffv_592;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_593> AgradDistributionNormalSufficient_ffv_593;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_594> AgradDistributionNormalSufficient_ffv_594;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_595> AgradDistributionNormalSufficient_ffv_595;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_596> AgradDistributionNormalSufficient_ffv_596;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_597> AgradDistributionNormalSufficient_ffv_597;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_598> AgradDistributionNormalSufficient_ffv_598;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_599> AgradDistributionNormalSufficient_ffv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_500, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_501, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_502, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_503, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_504, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_505, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_506, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_507, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_508, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_509, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_510, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_511, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_512, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_513, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_514, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_515, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_516, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_517, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_518, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_519, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_520, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_521, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_522, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_523, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_524, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_525, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_526, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_527, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_528, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_529, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_530, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_531, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_532, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_533, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_534, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_535, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_536, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_537, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_538, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_539, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_540, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_541, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_542, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_543, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_544, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_545, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_546, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_547, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_548, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_549, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_550, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_551, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_552, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_553, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_554, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_555, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_556, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_557, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_558, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_559, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_560, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_561, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_562, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_563, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_564, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_565, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_566, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_567, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_568, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_569, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_570, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_571, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_572, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_573, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_574, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_575, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_576, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_577, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_578, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_579, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_580, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_581, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_582, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_583, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_584, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_585, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_586, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_587, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_588, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_589, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_590, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_591, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_592, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_593, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_594, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_595, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_596, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_597, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_598, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_599, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_500;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_501;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_502;
+typedef std::tuple<double, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_503;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_504;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_505;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_506;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_507;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_508;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_509;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_510;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_511;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_512;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_513;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_514;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_515;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_516;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_517;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_518;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_519;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_520;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_521;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_522;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_523;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_524;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_525;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_526;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_527;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_528;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_529;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_530;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_531;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_532;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_533;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_534;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_535;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_536;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_537;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_538;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_539;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, double, empty> type_v_540;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_v_541;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_542;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, var, empty> type_v_543;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty> type_v_544;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_545;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_v_546;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_v_547;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_548;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty> type_v_549;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty> type_v_550;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_551;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_552;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_553;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_554;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_555;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_556;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_557;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, var, double, empty> type_v_558;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty> type_v_559;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_560;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, var, var, empty> type_v_561;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty> type_v_562;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_563;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty> type_v_564;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty> type_v_565;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_566;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty> type_v_567;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty> type_v_568;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_569;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_570;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_571;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_572;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_573;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_574;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_575;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty> type_v_576;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty> type_v_577;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_578;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty> type_v_579;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty> type_v_580;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_581;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_v_582;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_583;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_584;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty> type_v_585;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_586;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_587;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_588;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_589;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_590;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_591;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_592;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_593;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty> type_v_594;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty> type_v_595;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_596;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty> type_v_597;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty> type_v_598;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_599;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_500> AgradDistributionNormalSufficient_v_500;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_501> AgradDistributionNormalSufficient_v_501;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_502> AgradDistributionNormalSufficient_v_502;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_503> AgradDistributionNormalSufficient_v_503;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_504> AgradDistributionNormalSufficient_v_504;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_505> AgradDistributionNormalSufficient_v_505;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_506> AgradDistributionNormalSufficient_v_506;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_507> AgradDistributionNormalSufficient_v_507;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_508> AgradDistributionNormalSufficient_v_508;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_509> AgradDistributionNormalSufficient_v_509;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_510> AgradDistributionNormalSufficient_v_510;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_511> AgradDistributionNormalSufficient_v_511;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_512> AgradDistributionNormalSufficient_v_512;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_513> AgradDistributionNormalSufficient_v_513;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_514> AgradDistributionNormalSufficient_v_514;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_515> AgradDistributionNormalSufficient_v_515;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_516> AgradDistributionNormalSufficient_v_516;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_517> AgradDistributionNormalSufficient_v_517;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_518> AgradDistributionNormalSufficient_v_518;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_519> AgradDistributionNormalSufficient_v_519;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_520> AgradDistributionNormalSufficient_v_520;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_521> AgradDistributionNormalSufficient_v_521;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_522> AgradDistributionNormalSufficient_v_522;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_523> AgradDistributionNormalSufficient_v_523;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_524> AgradDistributionNormalSufficient_v_524;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_525> AgradDistributionNormalSufficient_v_525;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_526> AgradDistributionNormalSufficient_v_526;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_527> AgradDistributionNormalSufficient_v_527;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_528> AgradDistributionNormalSufficient_v_528;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_529> AgradDistributionNormalSufficient_v_529;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_530> AgradDistributionNormalSufficient_v_530;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_531> AgradDistributionNormalSufficient_v_531;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_532> AgradDistributionNormalSufficient_v_532;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_533> AgradDistributionNormalSufficient_v_533;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_534> AgradDistributionNormalSufficient_v_534;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_535> AgradDistributionNormalSufficient_v_535;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_536> AgradDistributionNormalSufficient_v_536;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_537> AgradDistributionNormalSufficient_v_537;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_538> AgradDistributionNormalSufficient_v_538;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_539> AgradDistributionNormalSufficient_v_539;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_540> AgradDistributionNormalSufficient_v_540;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_541> AgradDistributionNormalSufficient_v_541;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_542> AgradDistributionNormalSufficient_v_542;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_543> AgradDistributionNormalSufficient_v_543;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_544> AgradDistributionNormalSufficient_v_544;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_545> AgradDistributionNormalSufficient_v_545;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_546> AgradDistributionNormalSufficient_v_546;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_547> AgradDistributionNormalSufficient_v_547;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_548> AgradDistributionNormalSufficient_v_548;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_549> AgradDistributionNormalSufficient_v_549;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_550> AgradDistributionNormalSufficient_v_550;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_551> AgradDistributionNormalSufficient_v_551;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_552> AgradDistributionNormalSufficient_v_552;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_553> AgradDistributionNormalSufficient_v_553;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_554> AgradDistributionNormalSufficient_v_554;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_555> AgradDistributionNormalSufficient_v_555;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_556> AgradDistributionNormalSufficient_v_556;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_557> AgradDistributionNormalSufficient_v_557;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_558> AgradDistributionNormalSufficient_v_558;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_559> AgradDistributionNormalSufficient_v_559;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_560> AgradDistributionNormalSufficient_v_560;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_561> AgradDistributionNormalSufficient_v_561;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_562> AgradDistributionNormalSufficient_v_562;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_563> AgradDistributionNormalSufficient_v_563;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_564> AgradDistributionNormalSufficient_v_564;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_565> AgradDistributionNormalSufficient_v_565;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_566> AgradDistributionNormalSufficient_v_566;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_567> AgradDistributionNormalSufficient_v_567;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_568> AgradDistributionNormalSufficient_v_568;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_569> AgradDistributionNormalSufficient_v_569;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_570> AgradDistributionNormalSufficient_v_570;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_571> AgradDistributionNormalSufficient_v_571;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_572> AgradDistributionNormalSufficient_v_572;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_573> AgradDistributionNormalSufficient_v_573;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_574> AgradDistributionNormalSufficient_v_574;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_575> AgradDistributionNormalSufficient_v_575;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_576> AgradDistributionNormalSufficient_v_576;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_577> AgradDistributionNormalSufficient_v_577;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_578> AgradDistributionNormalSufficient_v_578;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_579> AgradDistributionNormalSufficient_v_579;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_580> AgradDistributionNormalSufficient_v_580;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_581> AgradDistributionNormalSufficient_v_581;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_582> AgradDistributionNormalSufficient_v_582;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_583> AgradDistributionNormalSufficient_v_583;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_584> AgradDistributionNormalSufficient_v_584;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_585> AgradDistributionNormalSufficient_v_585;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_586> AgradDistributionNormalSufficient_v_586;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_587> AgradDistributionNormalSufficient_v_587;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_588> AgradDistributionNormalSufficient_v_588;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_589> AgradDistributionNormalSufficient_v_589;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_590> AgradDistributionNormalSufficient_v_590;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_591> AgradDistributionNormalSufficient_v_591;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_592> AgradDistributionNormalSufficient_v_592;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_593> AgradDistributionNormalSufficient_v_593;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_594> AgradDistributionNormalSufficient_v_594;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_595> AgradDistributionNormalSufficient_v_595;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_596> AgradDistributionNormalSufficient_v_596;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_597> AgradDistributionNormalSufficient_v_597;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_598> AgradDistributionNormalSufficient_v_598;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_599> AgradDistributionNormalSufficient_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_500, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_501, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_502, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_503, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_504, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_505, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_506, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_507, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_508, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_509, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_510, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_511, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_512, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_513, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_514, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_515, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_516, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_517, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_518, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_519, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_520, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_521, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_522, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_523, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_524, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_525, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_526, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_527, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_528, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_529, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_530, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_531, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_532, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_533, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_534, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_535, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_536, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_537, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_538, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_539, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_540, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_541, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_542, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_543, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_544, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_545, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_546, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_547, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_548, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_549, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_550, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_551, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_552, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_553, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_554, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_555, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_556, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_557, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_558, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_559, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_560, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_561, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_562, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_563, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_564, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_565, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_566, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_567, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_568, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_569, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_570, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_571, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_572, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_573, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_574, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_575, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_576, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_577, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_578, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_579, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_580, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_581, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_582, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_583, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_584, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_585, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_586, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_587, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_588, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_589, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_590, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_591, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_592, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_593, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_594, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_595, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_596, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_597, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_598, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_599, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_599);
+
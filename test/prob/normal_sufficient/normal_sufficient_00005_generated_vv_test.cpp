@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_500;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<double>, double, empty> type_vv_501;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_502;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_503;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<double>, var, empty> type_vv_504;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_505;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_506;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_507;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_508;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_509;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_510;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_511;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_512;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, var, double, empty> type_vv_513;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, var, std::vector<double>, empty> type_vv_514;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_515;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, var, var, empty> type_vv_516;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, var, std::vector<var>, empty> type_vv_517;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_518;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<var>, double, empty> type_vv_519;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_520;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_521;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<var>, var, empty> type_vv_522;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_523;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_524;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_525;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_526;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_527;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_528;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_529;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_530;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_531;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_532;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_533;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_534;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_535;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_536;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_537;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_538;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_539;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_540;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_541;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_542;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_543;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_544;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_545;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_546;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_547;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_548;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_549;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_550;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_551;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_552;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_553;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_554;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_555;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_556;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_557;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_558;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_559;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_560;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_561;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_562;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_563;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_564;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_565;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_566;
+typedef std::tuple<std::vector<double>, double, int, double, var, empty> type_vv_567;
+typedef std::tuple<std::vector<double>, double, int, double, std::vector<var>, empty> type_vv_568;
+typedef std::tuple<std::vector<double>, double, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_569;
+typedef std::tuple<std::vector<double>, double, int, std::vector<double>, var, empty> type_vv_570;
+typedef std::tuple<std::vector<double>, double, int, std::vector<double>, std::vector<var>, empty> type_vv_571;
+typedef std::tuple<std::vector<double>, double, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_572;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_573;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_574;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_575;
+typedef std::tuple<std::vector<double>, double, int, var, double, empty> type_vv_576;
+typedef std::tuple<std::vector<double>, double, int, var, std::vector<double>, empty> type_vv_577;
+typedef std::tuple<std::vector<double>, double, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_578;
+typedef std::tuple<std::vector<double>, double, int, var, var, empty> type_vv_579;
+typedef std::tuple<std::vector<double>, double, int, var, std::vector<var>, empty> type_vv_580;
+typedef std::tuple<std::vector<double>, double, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_581;
+typedef std::tuple<std::vector<double>, double, int, std::vector<var>, double, empty> type_vv_582;
+typedef std::tuple<std::vector<double>, double, int, std::vector<var>, std::vector<double>, empty> type_vv_583;
+typedef std::tuple<std::vector<double>, double, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_584;
+typedef std::tuple<std::vector<double>, double, int, std::vector<var>, var, empty> type_vv_585;
+typedef std::tuple<std::vector<double>, double, int, std::vector<var>, std::vector<var>, empty> type_vv_586;
+typedef std::tuple<std::vector<double>, double, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_587;
+typedef std::tuple<std::vector<double>, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_588;
+typedef std::tuple<std::vector<double>, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_589;
+typedef std::tuple<std::vector<double>, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_590;
+typedef std::tuple<std::vector<double>, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_591;
+typedef std::tuple<std::vector<double>, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_592;
+typedef std::tuple<std::vector<double>, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_593;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, double, var, empty> type_vv_594;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, double, std::vector<var>, empty> type_vv_595;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_596;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<double>, var, empty> type_vv_597;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_598;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_599;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_500> AgradDistributionNormalSufficient_vv_500;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_501> AgradDistributionNormalSufficient_vv_501;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_502> AgradDistributionNormalSufficient_vv_502;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_503> AgradDistributionNormalSufficient_vv_503;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_504> AgradDistributionNormalSufficient_vv_504;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_505> AgradDistributionNormalSufficient_vv_505;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_506> AgradDistributionNormalSufficient_vv_506;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_507> AgradDistributionNormalSufficient_vv_507;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_508> AgradDistributionNormalSufficient_vv_508;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_509> AgradDistributionNormalSufficient_vv_509;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_510> AgradDistributionNormalSufficient_vv_510;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_511> AgradDistributionNormalSufficient_vv_511;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_512> AgradDistributionNormalSufficient_vv_512;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_513> AgradDistributionNormalSufficient_vv_513;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_514> AgradDistributionNormalSufficient_vv_514;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_515> AgradDistributionNormalSufficient_vv_515;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_516> AgradDistributionNormalSufficient_vv_516;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_517> AgradDistributionNormalSufficient_vv_517;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_518> AgradDistributionNormalSufficient_vv_518;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_519> AgradDistributionNormalSufficient_vv_519;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_520> AgradDistributionNormalSufficient_vv_520;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_521> AgradDistributionNormalSufficient_vv_521;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_522> AgradDistributionNormalSufficient_vv_522;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_523> AgradDistributionNormalSufficient_vv_523;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_524> AgradDistributionNormalSufficient_vv_524;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_525> AgradDistributionNormalSufficient_vv_525;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_526> AgradDistributionNormalSufficient_vv_526;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_527> AgradDistributionNormalSufficient_vv_527;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_528> AgradDistributionNormalSufficient_vv_528;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_529> AgradDistributionNormalSufficient_vv_529;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_530> AgradDistributionNormalSufficient_vv_530;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_531> AgradDistributionNormalSufficient_vv_531;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_532> AgradDistributionNormalSufficient_vv_532;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_533> AgradDistributionNormalSufficient_vv_533;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_534> AgradDistributionNormalSufficient_vv_534;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_535> AgradDistributionNormalSufficient_vv_535;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_536> AgradDistributionNormalSufficient_vv_536;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_537> AgradDistributionNormalSufficient_vv_537;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_538> AgradDistributionNormalSufficient_vv_538;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_539> AgradDistributionNormalSufficient_vv_539;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_540> AgradDistributionNormalSufficient_vv_540;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_541> AgradDistributionNormalSufficient_vv_541;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_542> AgradDistributionNormalSufficient_vv_542;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_543> AgradDistributionNormalSufficient_vv_543;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_544> AgradDistributionNormalSufficient_vv_544;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_545> AgradDistributionNormalSufficient_vv_545;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_546> AgradDistributionNormalSufficient_vv_546;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_547> AgradDistributionNormalSufficient_vv_547;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_548> AgradDistributionNormalSufficient_vv_548;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_549> AgradDistributionNormalSufficient_vv_549;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_550> AgradDistributionNormalSufficient_vv_550;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_551> AgradDistributionNormalSufficient_vv_551;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_552> AgradDistributionNormalSufficient_vv_552;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_553> AgradDistributionNormalSufficient_vv_553;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_554> AgradDistributionNormalSufficient_vv_554;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_555> AgradDistributionNormalSufficient_vv_555;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_556> AgradDistributionNormalSufficient_vv_556;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_557> AgradDistributionNormalSufficient_vv_557;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_558> AgradDistributionNormalSufficient_vv_558;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_559> AgradDistributionNormalSufficient_vv_559;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_560> AgradDistributionNormalSufficient_vv_560;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_561> AgradDistributionNormalSufficient_vv_561;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_562> AgradDistributionNormalSufficient_vv_562;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_563> AgradDistributionNormalSufficient_vv_563;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_564> AgradDistributionNormalSufficient_vv_564;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_565> AgradDistributionNormalSufficient_vv_565;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_566> AgradDistributionNormalSufficient_vv_566;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_567> AgradDistributionNormalSufficient_vv_567;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_568> AgradDistributionNormalSufficient_vv_568;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_569> AgradDistributionNormalSufficient_vv_569;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_570> AgradDistributionNormalSufficient_vv_570;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_571> AgradDistributionNormalSufficient_vv_571;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_572> AgradDistributionNormalSufficient_vv_572;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_573> AgradDistributionNormalSufficient_vv_573;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_574> AgradDistributionNormalSufficient_vv_574;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_575> AgradDistributionNormalSufficient_vv_575;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_576> AgradDistributionNormalSufficient_vv_576;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_577> AgradDistributionNormalSufficient_vv_577;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_578> AgradDistributionNormalSufficient_vv_578;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_579> AgradDistributionNormalSufficient_vv_579;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_580> AgradDistributionNormalSufficient_vv_580;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_581> AgradDistributionNormalSufficient_vv_581;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_582> AgradDistributionNormalSufficient_vv_582;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_583> AgradDistributionNormalSufficient_vv_583;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_584> AgradDistributionNormalSufficient_vv_584;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_585> AgradDistributionNormalSufficient_vv_585;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_586> AgradDistributionNormalSufficient_vv_586;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_587> AgradDistributionNormalSufficient_vv_587;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_588> AgradDistributionNormalSufficient_vv_588;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_589> AgradDistributionNormalSufficient_vv_589;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_590> AgradDistributionNormalSufficient_vv_590;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_591> AgradDistributionNormalSufficient_vv_591;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_592> AgradDistributionNormalSufficient_vv_592;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_593> AgradDistributionNormalSufficient_vv_593;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_594> AgradDistributionNormalSufficient_vv_594;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_595> AgradDistributionNormalSufficient_vv_595;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_596> AgradDistributionNormalSufficient_vv_596;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_597> AgradDistributionNormalSufficient_vv_597;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_598> AgradDistributionNormalSufficient_vv_598;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_599> AgradDistributionNormalSufficient_vv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_500, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_501, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_502, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_503, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_504, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_505, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_506, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_507, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_508, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_509, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_510, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_511, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_512, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_513, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_514, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_515, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_516, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_517, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_518, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_519, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_520, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_521, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_522, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_523, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_524, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_525, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_526, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_527, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_528, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_529, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_530, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_531, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_532, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_533, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_534, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_535, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_536, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_537, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_538, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_539, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_540, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_541, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_542, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_543, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_544, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_545, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_546, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_547, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_548, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_549, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_550, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_551, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_552, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_553, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_554, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_555, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_556, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_557, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_558, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_559, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_560, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_561, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_562, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_563, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_564, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_565, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_566, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_567, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_568, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_569, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_570, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_571, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_572, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_573, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_574, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_575, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_576, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_577, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_578, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_579, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_580, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_581, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_582, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_583, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_584, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_585, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_586, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_587, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_588, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_589, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_590, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_591, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_592, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_593, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_594, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_595, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_596, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_597, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_598, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_599, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_600;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_601;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_602;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_603;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_604;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_605;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_606;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_607;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_608;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_609;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_610;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_611;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_612;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_613;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_614;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_615;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_616;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_617;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_618;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_619;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_620;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_621;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_622;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_623;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_624;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_625;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_626;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_627;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_628;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_629;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_630;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_631;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_632;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_633;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_634;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_635;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_636;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_637;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_638;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_639;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_640;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_641;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_642;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_643;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_644;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_645;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_646;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_647;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, double, fvar<fvar<var> >, empty> type_ffv_648;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_649;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_650;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_651;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_652;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_653;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_654;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_655;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_656;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, fvar<fvar<var> >, double, empty> type_ffv_657;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_658;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_659;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_660;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_661;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_662;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_663;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_664;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_665;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_666;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_667;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_668;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_669;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_670;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_671;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_672;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_673;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_674;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_675;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_676;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_677;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_678;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_679;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_680;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_681;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_682;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_683;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_684;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_685;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_686;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_687;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_688;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_689;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_690;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_691;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_692;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_693;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_694;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_695;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_696;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_697;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_698;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_699;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_600> AgradDistributionNormalSufficient_ffv_600;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_601> AgradDistributionNormalSufficient_ffv_601;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_602> AgradDistributionNormalSufficient_ffv_602;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_603> AgradDistributionNormalSufficient_ffv_603;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_604> AgradDistributionNormalSufficient_ffv_604;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_605> AgradDistributionNormalSufficient_ffv_605;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_606> AgradDistributionNormalSufficient_ffv_606;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_607> AgradDistributionNormalSufficient_ffv_607;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_608> AgradDistributionNormalSufficient_ffv_608;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_609> AgradDistributionNormalSufficient_ffv_609;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_610> AgradDistributionNormalSufficient_ffv_610;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_611> AgradDistributionNormalSufficient_ffv_611;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_612> AgradDistributionNormalSufficient_ffv_612;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_613> AgradDistributionNormalSufficient_ffv_613;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_614> AgradDistributionNormalSufficient_ffv_614;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_615> AgradDistributionNormalSufficient_ffv_615;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_616> AgradDistributionNormalSufficient_ffv_616;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_617> AgradDistributionNormalSufficient_ffv_617;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_618> AgradDistributionNormalSufficient_ffv_618;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_619> AgradDistributionNormalSufficient_ffv_619;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_620> AgradDistributionNormalSufficient_ffv_620;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_621> AgradDistributionNormalSufficient_ffv_621;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_622> AgradDistributionNormalSufficient_ffv_622;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_623> AgradDistributionNormalSufficient_ffv_623;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_624> AgradDistributionNormalSufficient_ffv_624;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_625> AgradDistributionNormalSufficient_ffv_625;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_626> AgradDistributionNormalSufficient_ffv_626;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_627> AgradDistributionNormalSufficient_ffv_627;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_628> AgradDistributionNormalSufficient_ffv_628;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_629> AgradDistributionNormalSufficient_ffv_629;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_630> AgradDistributionNormalSufficient_ffv_630;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_631> AgradDistributionNormalSufficient_ffv_631;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_632> AgradDistributionNormalSufficient_ffv_632;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_633> AgradDistributionNormalSufficient_ffv_633;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_634> AgradDistributionNormalSufficient_ffv_634;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_635> AgradDistributionNormalSufficient_ffv_635;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_636> AgradDistributionNormalSufficient_ffv_636;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_637> AgradDistributionNormalSufficient_ffv_637;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_638> AgradDistributionNormalSufficient_ffv_638;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_639> AgradDistributionNormalSufficient_ffv_639;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_640> AgradDistributionNormalSufficient_ffv_640;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_641> AgradDistributionNormalSufficient_ffv_641;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_642> AgradDistributionNormalSufficient_ffv_642;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_643> AgradDistributionNormalSufficient_ffv_643;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_644> AgradDistributionNormalSufficient_ffv_644;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_645> AgradDistributionNormalSufficient_ffv_645;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_646> AgradDistributionNormalSufficient_ffv_646;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_647> AgradDistributionNormalSufficient_ffv_647;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_648> AgradDistributionNormalSufficient_ffv_648;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_649> AgradDistributionNormalSufficient_ffv_649;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_650> AgradDistributionNormalSufficient_ffv_650;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_651> AgradDistributionNormalSufficient_ffv_651;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_652> AgradDistributionNormalSufficient_ffv_652;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_653> AgradDistributionNormalSufficient_ffv_653;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_654> AgradDistributionNormalSufficient_ffv_654;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_655> AgradDistributionNormalSufficient_ffv_655;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_656> AgradDistributionNormalSufficient_ffv_656;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_657> AgradDistributionNormalSufficient_ffv_657;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_658> AgradDistributionNormalSufficient_ffv_658;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_659> AgradDistributionNormalSufficient_ffv_659;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_660> AgradDistributionNormalSufficient_ffv_660;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_661> AgradDistributionNormalSufficient_ffv_661;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_662> AgradDistributionNormalSufficient_ffv_662;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_663> AgradDistributionNormalSufficient_ffv_663;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_664> AgradDistributionNormalSufficient_ffv_664;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_665> AgradDistributionNormalSufficient_ffv_665;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_666> AgradDistributionNormalSufficient_ffv_666;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_667> AgradDistributionNormalSufficient_ffv_667;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_668> AgradDistributionNormalSufficient_ffv_668;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_669> AgradDistributionNormalSufficient_ffv_669;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_670> AgradDistributionNormalSufficient_ffv_670;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_671> AgradDistributionNormalSufficient_ffv_671;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_672> AgradDistributionNormalSufficient_ffv_672;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_673> AgradDistributionNormalSufficient_ffv_673;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_674> AgradDistributionNormalSufficient_ffv_674;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_675> AgradDistributionNormalSufficient_ffv_675;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_676> AgradDistributionNormalSufficient_ffv_676;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_677> AgradDistributionNormalSufficient_ffv_677;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_678> AgradDistributionNormalSufficient_ffv_678;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_679> AgradDistributionNormalSufficient_ffv_679;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_680> AgradDistributionNormalSufficient_ffv_680;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_681> AgradDistributionNormalSufficient_ffv_681;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_682> AgradDistributionNormalSufficient_ffv_682;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_683> AgradDistributionNormalSufficient_ffv_683;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_684> AgradDistributionNormalSufficient_ffv_684;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_685> AgradDistributionNormalSufficient_ffv_685;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_686> AgradDistributionNormalSufficient_ffv_686;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_687> AgradDistributionNormalSufficient_ffv_687;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_688> AgradDistributionNormalSufficient_ffv_688;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_689> AgradDistributionNormalSufficient_ffv_689;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_690> AgradDistributionNormalSufficient_ffv_690;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_691> AgradDistributionNormalSufficient_ffv_691;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_692> AgradDistributionNormalSufficient_ffv_692;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_693> AgradDistributionNormalSufficient_ffv_693;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_694> AgradDistributionNormalSufficient_ffv_694;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_695> AgradDistributionNormalSufficient_ffv_695;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_696> AgradDistributionNormalSufficient_ffv_696;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_697> AgradDistributionNormalSufficient_ffv_697;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_698> AgradDistributionNormalSufficient_ffv_698;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_699> AgradDistributionNormalSufficient_ffv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_600, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_601, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_602, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_603, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_604, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_605, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_606, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_607, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_608, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_609, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_610, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_611, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_612, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_613, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_614, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_615, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_616, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_617, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_618, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_619, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_620, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_621, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_622, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_623, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_624, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_625, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_626, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_627, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_628, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_629, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_630, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_631, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_632, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_633, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_634, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_635, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_636, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_637, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_638, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_639, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_640, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_641, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_642, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_643, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_644, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_645, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_646, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_647, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_648, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_649, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_650, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_651, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_652, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_653, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_654, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_655, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_656, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_657, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_658, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_659, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_660, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_661, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_662, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_663, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_664, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_665, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_666, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_667, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_668, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_669, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_670, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_671, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_672, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_673, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_674, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_675, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_676, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_677, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_678, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_679, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_680, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_681, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_682, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_683, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_684, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_685, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_686, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_687, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_688, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_689, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_690, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_691, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_692, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_693, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_694, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_695, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_696, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_697, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_698, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_699, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_699);
+
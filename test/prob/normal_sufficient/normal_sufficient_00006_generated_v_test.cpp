@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty> type_v_600;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_601;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_602;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty> type_v_603;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_604;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_605;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_606;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_607;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_608;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_609;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_610;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_611;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_612;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_613;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_614;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_615;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_616;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_617;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_618;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_619;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_620;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_621;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_622;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_623;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_624;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_625;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_626;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_627;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_628;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_629;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_630;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_631;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_632;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_633;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_634;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_635;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_636;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_637;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_638;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_639;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_640;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_641;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_642;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_643;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_644;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_645;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_646;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_647;
+typedef std::tuple<std::vector<double>, double, int, double, double, empty> type_v_648;
+typedef std::tuple<std::vector<double>, double, int, double, std::vector<double>, empty> type_v_649;
+typedef std::tuple<std::vector<double>, double, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_650;
+typedef std::tuple<std::vector<double>, double, int, double, var, empty> type_v_651;
+typedef std::tuple<std::vector<double>, double, int, double, std::vector<var>, empty> type_v_652;
+typedef std::tuple<std::vector<double>, double, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_653;
+typedef std::tuple<std::vector<double>, double, int, std::vector<double>, double, empty> type_v_654;
+typedef std::tuple<std::vector<double>, double, int, std::vector<double>, std::vector<double>, empty> type_v_655;
+typedef std::tuple<std::vector<double>, double, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_656;
+typedef std::tuple<std::vector<double>, double, int, std::vector<double>, var, empty> type_v_657;
+typedef std::tuple<std::vector<double>, double, int, std::vector<double>, std::vector<var>, empty> type_v_658;
+typedef std::tuple<std::vector<double>, double, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_659;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_660;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_661;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_662;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_663;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_664;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_665;
+typedef std::tuple<std::vector<double>, double, int, var, double, empty> type_v_666;
+typedef std::tuple<std::vector<double>, double, int, var, std::vector<double>, empty> type_v_667;
+typedef std::tuple<std::vector<double>, double, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_668;
+typedef std::tuple<std::vector<double>, double, int, var, var, empty> type_v_669;
+typedef std::tuple<std::vector<double>, double, int, var, std::vector<var>, empty> type_v_670;
+typedef std::tuple<std::vector<double>, double, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_671;
+typedef std::tuple<std::vector<double>, double, int, std::vector<var>, double, empty> type_v_672;
+typedef std::tuple<std::vector<double>, double, int, std::vector<var>, std::vector<double>, empty> type_v_673;
+typedef std::tuple<std::vector<double>, double, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_674;
+typedef std::tuple<std::vector<double>, double, int, std::vector<var>, var, empty> type_v_675;
+typedef std::tuple<std::vector<double>, double, int, std::vector<var>, std::vector<var>, empty> type_v_676;
+typedef std::tuple<std::vector<double>, double, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_677;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_678;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_679;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_680;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_681;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_682;
+typedef std::tuple<std::vector<double>, double, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_683;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, double, double, empty> type_v_684;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, double, std::vector<double>, empty> type_v_685;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_686;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, double, var, empty> type_v_687;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, double, std::vector<var>, empty> type_v_688;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_689;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<double>, double, empty> type_v_690;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_691;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_692;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<double>, var, empty> type_v_693;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_694;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_695;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_696;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_697;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_698;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_699;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_600> AgradDistributionNormalSufficient_v_600;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_601> AgradDistributionNormalSufficient_v_601;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_602> AgradDistributionNormalSufficient_v_602;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_603> AgradDistributionNormalSufficient_v_603;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_604> AgradDistributionNormalSufficient_v_604;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_605> AgradDistributionNormalSufficient_v_605;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_606> AgradDistributionNormalSufficient_v_606;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_607> AgradDistributionNormalSufficient_v_607;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_608> AgradDistributionNormalSufficient_v_608;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_609> AgradDistributionNormalSufficient_v_609;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_610> AgradDistributionNormalSufficient_v_610;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_611> AgradDistributionNormalSufficient_v_611;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_612> AgradDistributionNormalSufficient_v_612;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_613> AgradDistributionNormalSufficient_v_613;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_614> AgradDistributionNormalSufficient_v_614;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_615> AgradDistributionNormalSufficient_v_615;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_616> AgradDistributionNormalSufficient_v_616;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_617> AgradDistributionNormalSufficient_v_617;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_618> AgradDistributionNormalSufficient_v_618;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_619> AgradDistributionNormalSufficient_v_619;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_620> AgradDistributionNormalSufficient_v_620;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_621> AgradDistributionNormalSufficient_v_621;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_622> AgradDistributionNormalSufficient_v_622;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_623> AgradDistributionNormalSufficient_v_623;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_624> AgradDistributionNormalSufficient_v_624;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_625> AgradDistributionNormalSufficient_v_625;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_626> AgradDistributionNormalSufficient_v_626;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_627> AgradDistributionNormalSufficient_v_627;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_628> AgradDistributionNormalSufficient_v_628;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_629> AgradDistributionNormalSufficient_v_629;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_630> AgradDistributionNormalSufficient_v_630;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_631> AgradDistributionNormalSufficient_v_631;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_632> AgradDistributionNormalSufficient_v_632;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_633> AgradDistributionNormalSufficient_v_633;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_634> AgradDistributionNormalSufficient_v_634;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_635> AgradDistributionNormalSufficient_v_635;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_636> AgradDistributionNormalSufficient_v_636;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_637> AgradDistributionNormalSufficient_v_637;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_638> AgradDistributionNormalSufficient_v_638;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_639> AgradDistributionNormalSufficient_v_639;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_640> AgradDistributionNormalSufficient_v_640;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_641> AgradDistributionNormalSufficient_v_641;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_642> AgradDistributionNormalSufficient_v_642;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_643> AgradDistributionNormalSufficient_v_643;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_644> AgradDistributionNormalSufficient_v_644;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_645> AgradDistributionNormalSufficient_v_645;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_646> AgradDistributionNormalSufficient_v_646;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_647> AgradDistributionNormalSufficient_v_647;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_648> AgradDistributionNormalSufficient_v_648;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_649> AgradDistributionNormalSufficient_v_649;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_650> AgradDistributionNormalSufficient_v_650;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_651> AgradDistributionNormalSufficient_v_651;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_652> AgradDistributionNormalSufficient_v_652;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_653> AgradDistributionNormalSufficient_v_653;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_654> AgradDistributionNormalSufficient_v_654;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_655> AgradDistributionNormalSufficient_v_655;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_656> AgradDistributionNormalSufficient_v_656;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_657> AgradDistributionNormalSufficient_v_657;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_658> AgradDistributionNormalSufficient_v_658;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_659> AgradDistributionNormalSufficient_v_659;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_660> AgradDistributionNormalSufficient_v_660;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_661> AgradDistributionNormalSufficient_v_661;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_662> AgradDistributionNormalSufficient_v_662;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_663> AgradDistributionNormalSufficient_v_663;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_664> AgradDistributionNormalSufficient_v_664;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_665> AgradDistributionNormalSufficient_v_665;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_666> AgradDistributionNormalSufficient_v_666;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_667> AgradDistributionNormalSufficient_v_667;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_668> AgradDistributionNormalSufficient_v_668;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_669> AgradDistributionNormalSufficient_v_669;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_670> AgradDistributionNormalSufficient_v_670;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_671> AgradDistributionNormalSufficient_v_671;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_672> AgradDistributionNormalSufficient_v_672;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_673> AgradDistributionNormalSufficient_v_673;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_674> AgradDistributionNormalSufficient_v_674;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_675> AgradDistributionNormalSufficient_v_675;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_676> AgradDistributionNormalSufficient_v_676;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_677> AgradDistributionNormalSufficient_v_677;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_678> AgradDistributionNormalSufficient_v_678;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_679> AgradDistributionNormalSufficient_v_679;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_680> AgradDistributionNormalSufficient_v_680;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_681> AgradDistributionNormalSufficient_v_681;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_682> AgradDistributionNormalSufficient_v_682;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_683> AgradDistributionNormalSufficient_v_683;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_684> AgradDistributionNormalSufficient_v_684;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_685> AgradDistributionNormalSufficient_v_685;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_686> AgradDistributionNormalSufficient_v_686;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_687> AgradDistributionNormalSufficient_v_687;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_688> AgradDistributionNormalSufficient_v_688;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_689> AgradDistributionNormalSufficient_v_689;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_690> AgradDistributionNormalSufficient_v_690;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_691> AgradDistributionNormalSufficient_v_691;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_692> AgradDistributionNormalSufficient_v_692;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_693> AgradDistributionNormalSufficient_v_693;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_694> AgradDistributionNormalSufficient_v_694;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_695> AgradDistributionNormalSufficient_v_695;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_696> AgradDistributionNormalSufficient_v_696;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_697> AgradDistributionNormalSufficient_v_697;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_698> AgradDistributionNormalSufficient_v_698;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_699> AgradDistributionNormalSufficient_v_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_600, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_601, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_602, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_603, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_604, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_605, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_606, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_607, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_608, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_609, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_610, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_611, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_612, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_613, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_614, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_615, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_616, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_617, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_618, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_619, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_620, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_621, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_622, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_623, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_624, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_625, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_626, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_627, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_628, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_629, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_630, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_631, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_632, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_633, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_634, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_635, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_636, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_637, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_638, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_639, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_640, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_641, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_642, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_643, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_644, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_645, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_646, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_647, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_648, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_649, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_650, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_651, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_652, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_653, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_654, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_655, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_656, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_657, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_658, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_659, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_660, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_661, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_662, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_663, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_664, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_665, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_666, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_667, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_668, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_669, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_670, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_671, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_672, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_673, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_674, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_675, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_676, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_677, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_678, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_679, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_680, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_681, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_682, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_683, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_684, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_685, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_686, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_687, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_688, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_689, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_690, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_691, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_692, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_693, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_694, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_695, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_696, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_697, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_698, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_699, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_699);
+
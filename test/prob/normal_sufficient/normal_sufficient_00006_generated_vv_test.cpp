@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_600;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_601;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_602;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, var, double, empty> type_vv_603;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, var, std::vector<double>, empty> type_vv_604;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_605;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, var, var, empty> type_vv_606;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, var, std::vector<var>, empty> type_vv_607;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_608;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<var>, double, empty> type_vv_609;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_610;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_611;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<var>, var, empty> type_vv_612;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_613;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_614;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_615;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_616;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_617;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_618;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_619;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_620;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_621;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_622;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_623;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_624;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_625;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_626;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_627;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_628;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_629;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_630;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_631;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_632;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_633;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_634;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_635;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_636;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_637;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_638;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_639;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_640;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_641;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_642;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_643;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_644;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_645;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_646;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_647;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, double, var, empty> type_vv_648;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, double, std::vector<var>, empty> type_vv_649;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_650;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<double>, var, empty> type_vv_651;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<double>, std::vector<var>, empty> type_vv_652;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_653;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_654;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_655;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_656;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, var, double, empty> type_vv_657;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, var, std::vector<double>, empty> type_vv_658;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_659;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, var, var, empty> type_vv_660;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, var, std::vector<var>, empty> type_vv_661;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_662;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<var>, double, empty> type_vv_663;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<var>, std::vector<double>, empty> type_vv_664;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_665;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<var>, var, empty> type_vv_666;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<var>, std::vector<var>, empty> type_vv_667;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_668;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_669;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_670;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_671;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_672;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_673;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_674;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, double, var, empty> type_vv_675;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, double, std::vector<var>, empty> type_vv_676;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_677;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<double>, var, empty> type_vv_678;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_679;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_680;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_681;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_682;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_683;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, var, double, empty> type_vv_684;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, var, std::vector<double>, empty> type_vv_685;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_686;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, var, var, empty> type_vv_687;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, var, std::vector<var>, empty> type_vv_688;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_689;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<var>, double, empty> type_vv_690;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_691;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_692;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<var>, var, empty> type_vv_693;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_694;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_695;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_696;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_697;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_698;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_699;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_600> AgradDistributionNormalSufficient_vv_600;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_601> AgradDistributionNormalSufficient_vv_601;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_602> AgradDistributionNormalSufficient_vv_602;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_603> AgradDistributionNormalSufficient_vv_603;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_604> AgradDistributionNormalSufficient_vv_604;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_605> AgradDistributionNormalSufficient_vv_605;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_606> AgradDistributionNormalSufficient_vv_606;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_607> AgradDistributionNormalSufficient_vv_607;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_608> AgradDistributionNormalSufficient_vv_608;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_609> AgradDistributionNormalSufficient_vv_609;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_610> AgradDistributionNormalSufficient_vv_610;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_611> AgradDistributionNormalSufficient_vv_611;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_612> AgradDistributionNormalSufficient_vv_612;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_613> AgradDistributionNormalSufficient_vv_613;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_614> AgradDistributionNormalSufficient_vv_614;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_615> AgradDistributionNormalSufficient_vv_615;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_616> AgradDistributionNormalSufficient_vv_616;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_617> AgradDistributionNormalSufficient_vv_617;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_618> AgradDistributionNormalSufficient_vv_618;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_619> AgradDistributionNormalSufficient_vv_619;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_620> AgradDistributionNormalSufficient_vv_620;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_621> AgradDistributionNormalSufficient_vv_621;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_622> AgradDistributionNormalSufficient_vv_622;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_623> AgradDistributionNormalSufficient_vv_623;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_624> AgradDistributionNormalSufficient_vv_624;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_625> AgradDistributionNormalSufficient_vv_625;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_626> AgradDistributionNormalSufficient_vv_626;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_627> AgradDistributionNormalSufficient_vv_627;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_628> AgradDistributionNormalSufficient_vv_628;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_629> AgradDistributionNormalSufficient_vv_629;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_630> AgradDistributionNormalSufficient_vv_630;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_631> AgradDistributionNormalSufficient_vv_631;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_632> AgradDistributionNormalSufficient_vv_632;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_633> AgradDistributionNormalSufficient_vv_633;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_634> AgradDistributionNormalSufficient_vv_634;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_635> AgradDistributionNormalSufficient_vv_635;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_636> AgradDistributionNormalSufficient_vv_636;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_637> AgradDistributionNormalSufficient_vv_637;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_638> AgradDistributionNormalSufficient_vv_638;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_639> AgradDistributionNormalSufficient_vv_639;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_640> AgradDistributionNormalSufficient_vv_640;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_641> AgradDistributionNormalSufficient_vv_641;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_642> AgradDistributionNormalSufficient_vv_642;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_643> AgradDistributionNormalSufficient_vv_643;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_644> AgradDistributionNormalSufficient_vv_644;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_645> AgradDistributionNormalSufficient_vv_645;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_646> AgradDistributionNormalSufficient_vv_646;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_647> AgradDistributionNormalSufficient_vv_647;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_648> AgradDistributionNormalSufficient_vv_648;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_649> AgradDistributionNormalSufficient_vv_649;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_650> AgradDistributionNormalSufficient_vv_650;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_651> AgradDistributionNormalSufficient_vv_651;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_652> AgradDistributionNormalSufficient_vv_652;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_653> AgradDistributionNormalSufficient_vv_653;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_654> AgradDistributionNormalSufficient_vv_654;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_655> AgradDistributionNormalSufficient_vv_655;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_656> AgradDistributionNormalSufficient_vv_656;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_657> AgradDistributionNormalSufficient_vv_657;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_658> AgradDistributionNormalSufficient_vv_658;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_659> AgradDistributionNormalSufficient_vv_659;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_660> AgradDistributionNormalSufficient_vv_660;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_661> AgradDistributionNormalSufficient_vv_661;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_662> AgradDistributionNormalSufficient_vv_662;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_663> AgradDistributionNormalSufficient_vv_663;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_664> AgradDistributionNormalSufficient_vv_664;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_665> AgradDistributionNormalSufficient_vv_665;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_666> AgradDistributionNormalSufficient_vv_666;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_667> AgradDistributionNormalSufficient_vv_667;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_668> AgradDistributionNormalSufficient_vv_668;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_669> AgradDistributionNormalSufficient_vv_669;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_670> AgradDistributionNormalSufficient_vv_670;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_671> AgradDistributionNormalSufficient_vv_671;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_672> AgradDistributionNormalSufficient_vv_672;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_673> AgradDistributionNormalSufficient_vv_673;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_674> AgradDistributionNormalSufficient_vv_674;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_675> AgradDistributionNormalSufficient_vv_675;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_676> AgradDistributionNormalSufficient_vv_676;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_677> AgradDistributionNormalSufficient_vv_677;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_678> AgradDistributionNormalSufficient_vv_678;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_679> AgradDistributionNormalSufficient_vv_679;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_680> AgradDistributionNormalSufficient_vv_680;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_681> AgradDistributionNormalSufficient_vv_681;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_682> AgradDistributionNormalSufficient_vv_682;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_683> AgradDistributionNormalSufficient_vv_683;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_684> AgradDistributionNormalSufficient_vv_684;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_685> AgradDistributionNormalSufficient_vv_685;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_686> AgradDistributionNormalSufficient_vv_686;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_687> AgradDistributionNormalSufficient_vv_687;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_688> AgradDistributionNormalSufficient_vv_688;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_689> AgradDistributionNormalSufficient_vv_689;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_690> AgradDistributionNormalSufficient_vv_690;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_691> AgradDistributionNormalSufficient_vv_691;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_692> AgradDistributionNormalSufficient_vv_692;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_693> AgradDistributionNormalSufficient_vv_693;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_694> AgradDistributionNormalSufficient_vv_694;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_695> AgradDistributionNormalSufficient_vv_695;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_696> AgradDistributionNormalSufficient_vv_696;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_697> AgradDistributionNormalSufficient_vv_697;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_698> AgradDistributionNormalSufficient_vv_698;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_699> AgradDistributionNormalSufficient_vv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_600, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_601, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_602, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_603, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_604, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_605, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_606, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_607, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_608, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_609, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_610, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_611, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_612, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_613, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_614, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_615, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_616, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_617, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_618, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_619, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_620, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_621, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_622, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_623, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_624, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_625, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_626, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_627, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_628, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_629, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_630, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_631, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_632, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_633, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_634, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_635, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_636, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_637, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_638, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_639, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_640, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_641, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_642, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_643, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_644, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_645, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_646, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_647, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_648, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_649, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_650, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_651, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_652, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_653, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_654, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_655, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_656, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_657, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_658, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_659, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_660, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_661, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_662, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_663, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_664, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_665, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_666, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_667, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_668, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_669, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_670, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_671, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_672, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_673, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_674, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_675, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_676, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_677, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_678, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_679, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_680, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_681, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_682, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_683, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_684, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_685, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_686, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_687, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_688, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_689, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_690, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_691, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_692, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_693, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_694, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_695, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_696, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_697, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_698, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_699, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_700;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_701;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_702;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_703;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_704;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_705;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_706;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_707;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_708;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_709;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_710;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_711;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_712;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_713;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_714;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_715;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_716;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_717;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_718;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_719;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_720;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_721;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_722;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_723;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_724;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_725;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_726;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_727;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_728;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty> type_ffv_729;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_730;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_731;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_732;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_733;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_734;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_735;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_736;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_737;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, double, empty> type_ffv_738;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_739;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_740;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_741;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_742;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_743;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_744;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_745;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_746;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_747;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_748;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_749;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_750;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_751;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_752;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_753;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_754;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_755;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_756;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_757;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_758;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_759;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_760;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_761;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_762;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_763;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_764;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_765;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_766;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_767;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_768;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_769;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_770;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_771;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_772;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_773;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_774;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_775;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_776;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_777;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_778;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_779;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_780;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_781;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_782;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_783;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_784;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_785;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_786;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_787;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_788;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_789;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_790;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_791;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_792;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_793;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_794;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_795;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_796;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_797;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_798;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_799;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_700> AgradDistributionNormalSufficient_ffv_700;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_701> AgradDistributionNormalSufficient_ffv_701;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_702> AgradDistributionNormalSufficient_ffv_702;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_703> AgradDistributionNormalSufficient_ffv_703;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_704> AgradDistributionNormalSufficient_ffv_704;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_705> AgradDistributionNormalSufficient_ffv_705;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_706> AgradDistributionNormalSufficient_ffv_706;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_707> AgradDistributionNormalSufficient_ffv_707;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_708> AgradDistributionNormalSufficient_ffv_708;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_709> AgradDistributionNormalSufficient_ffv_709;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_710> AgradDistributionNormalSufficient_ffv_710;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_711> AgradDistributionNormalSufficient_ffv_711;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_712> AgradDistributionNormalSufficient_ffv_712;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_713> AgradDistributionNormalSufficient_ffv_713;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_714> AgradDistributionNormalSufficient_ffv_714;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_715> AgradDistributionNormalSufficient_ffv_715;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_716> AgradDistributionNormalSufficient_ffv_716;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_717> AgradDistributionNormalSufficient_ffv_717;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_718> AgradDistributionNormalSufficient_ffv_718;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_719> AgradDistributionNormalSufficient_ffv_719;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_720> AgradDistributionNormalSufficient_ffv_720;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_721> AgradDistributionNormalSufficient_ffv_721;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_722> AgradDistributionNormalSufficient_ffv_722;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_723> AgradDistributionNormalSufficient_ffv_723;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_724> AgradDistributionNormalSufficient_ffv_724;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_725> AgradDistributionNormalSufficient_ffv_725;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_726> AgradDistributionNormalSufficient_ffv_726;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_727> AgradDistributionNormalSufficient_ffv_727;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_728> AgradDistributionNormalSufficient_ffv_728;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_729> AgradDistributionNormalSufficient_ffv_729;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_730> AgradDistributionNormalSufficient_ffv_730;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_731> AgradDistributionNormalSufficient_ffv_731;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_732> AgradDistributionNormalSufficient_ffv_732;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_733> AgradDistributionNormalSufficient_ffv_733;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_734> AgradDistributionNormalSufficient_ffv_734;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_735> AgradDistributionNormalSufficient_ffv_735;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_736> AgradDistributionNormalSufficient_ffv_736;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_737> AgradDistributionNormalSufficient_ffv_737;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_738> AgradDistributionNormalSufficient_ffv_738;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_739> AgradDistributionNormalSufficient_ffv_739;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_740> AgradDistributionNormalSufficient_ffv_740;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_741> AgradDistributionNormalSufficient_ffv_741;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_742> AgradDistributionNormalSufficient_ffv_742;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_743> AgradDistributionNormalSufficient_ffv_743;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_744> AgradDistributionNormalSufficient_ffv_744;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_745> AgradDistributionNormalSufficient_ffv_745;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_746> AgradDistributionNormalSufficient_ffv_746;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_747> AgradDistributionNormalSufficient_ffv_747;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_748> AgradDistributionNormalSufficient_ffv_748;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_749> AgradDistributionNormalSufficient_ffv_749;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_750> AgradDistributionNormalSufficient_ffv_750;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_751> AgradDistributionNormalSufficient_ffv_751;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_752> AgradDistributionNormalSufficient_ffv_752;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_753> AgradDistributionNormalSufficient_ffv_753;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_754> AgradDistributionNormalSufficient_ffv_754;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_755> AgradDistributionNormalSufficient_ffv_755;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_756> AgradDistributionNormalSufficient_ffv_756;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_757> AgradDistributionNormalSufficient_ffv_757;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_758> AgradDistributionNormalSufficient_ffv_758;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_759> AgradDistributionNormalSufficient_ffv_759;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_760> AgradDistributionNormalSufficient_ffv_760;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_761> AgradDistributionNormalSufficient_ffv_761;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_762> AgradDistributionNormalSufficient_ffv_762;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_763> AgradDistributionNormalSufficient_ffv_763;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_764> AgradDistributionNormalSufficient_ffv_764;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_765> AgradDistributionNormalSufficient_ffv_765;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_766> AgradDistributionNormalSufficient_ffv_766;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_767> AgradDistributionNormalSufficient_ffv_767;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_768> AgradDistributionNormalSufficient_ffv_768;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_769> AgradDistributionNormalSufficient_ffv_769;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_770> AgradDistributionNormalSufficient_ffv_770;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_771> AgradDistributionNormalSufficient_ffv_771;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_772> AgradDistributionNormalSufficient_ffv_772;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_773> AgradDistributionNormalSufficient_ffv_773;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_774> AgradDistributionNormalSufficient_ffv_774;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_775> AgradDistributionNormalSufficient_ffv_775;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_776> AgradDistributionNormalSufficient_ffv_776;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_777> AgradDistributionNormalSufficient_ffv_777;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_778> AgradDistributionNormalSufficient_ffv_778;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_779> AgradDistributionNormalSufficient_ffv_779;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_780> AgradDistributionNormalSufficient_ffv_780;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_781> AgradDistributionNormalSufficient_ffv_781;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_782> AgradDistributionNormalSufficient_ffv_782;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_783> AgradDistributionNormalSufficient_ffv_783;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_784> AgradDistributionNormalSufficient_ffv_784;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_785> AgradDistributionNormalSufficient_ffv_785;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_786> AgradDistributionNormalSufficient_ffv_786;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_787> AgradDistributionNormalSufficient_ffv_787;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_788> AgradDistributionNormalSufficient_ffv_788;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_789> AgradDistributionNormalSufficient_ffv_789;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_790> AgradDistributionNormalSufficient_ffv_790;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_791> AgradDistributionNormalSufficient_ffv_791;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_792> AgradDistributionNormalSufficient_ffv_792;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_793> AgradDistributionNormalSufficient_ffv_793;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_794> AgradDistributionNormalSufficient_ffv_794;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_795> AgradDistributionNormalSufficient_ffv_795;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_796> AgradDistributionNormalSufficient_ffv_796;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_797> AgradDistributionNormalSufficient_ffv_797;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_798> AgradDistributionNormalSufficient_ffv_798;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_799> AgradDistributionNormalSufficient_ffv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_700, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_701, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_702, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_703, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_704, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_705, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_706, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_707, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_708, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_709, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_710, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_711, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_712, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_713, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_714, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_715, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_716, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_717, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_718, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_719, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_720, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_721, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_722, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_723, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_724, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_725, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_726, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_727, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_728, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_729, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_730, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_731, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_732, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_733, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_734, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_735, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_736, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_737, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_738, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_739, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_740, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_741, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_742, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_743, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_744, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_745, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_746, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_747, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_748, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_749, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_750, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_751, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_752, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_753, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_754, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_755, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_756, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_757, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_758, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_759, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_760, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_761, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_762, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_763, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_764, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_765, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_766, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_767, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_768, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_769, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_770, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_771, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_772, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_773, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_774, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_775, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_776, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_777, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_778, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_779, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_780, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_781, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_782, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_783, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_784, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_785, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_786, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_787, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_788, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_789, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_790, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_791, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_792, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_793, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_794, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_795, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_796, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_797, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_798, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_799, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_700;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_701;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, var, double, empty> type_v_702;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, var, std::vector<double>, empty> type_v_703;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_704;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, var, var, empty> type_v_705;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, var, std::vector<var>, empty> type_v_706;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_707;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<var>, double, empty> type_v_708;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_709;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_710;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<var>, var, empty> type_v_711;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_712;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_713;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_714;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_715;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_716;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_717;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_718;
+typedef std::tuple<std::vector<double>, double, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_719;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_720;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_721;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_722;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_723;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_724;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_725;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_726;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_727;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_728;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_729;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_730;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_731;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_732;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_733;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_734;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_735;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_736;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_737;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_738;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_739;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_740;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_741;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_742;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_743;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_744;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_745;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_746;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_747;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_748;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_749;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_750;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_751;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_752;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_753;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_754;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_755;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, double, double, empty> type_v_756;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, double, std::vector<double>, empty> type_v_757;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_758;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, double, var, empty> type_v_759;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, double, std::vector<var>, empty> type_v_760;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_761;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<double>, double, empty> type_v_762;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<double>, std::vector<double>, empty> type_v_763;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_764;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<double>, var, empty> type_v_765;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<double>, std::vector<var>, empty> type_v_766;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_767;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_768;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_769;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_770;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_771;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_772;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_773;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, var, double, empty> type_v_774;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, var, std::vector<double>, empty> type_v_775;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_776;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, var, var, empty> type_v_777;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, var, std::vector<var>, empty> type_v_778;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_779;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<var>, double, empty> type_v_780;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<var>, std::vector<double>, empty> type_v_781;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_782;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<var>, var, empty> type_v_783;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<var>, std::vector<var>, empty> type_v_784;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_785;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_786;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_787;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_788;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_789;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_790;
+typedef std::tuple<std::vector<double>, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_791;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, double, double, empty> type_v_792;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, double, std::vector<double>, empty> type_v_793;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_794;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, double, var, empty> type_v_795;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, double, std::vector<var>, empty> type_v_796;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_797;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<double>, double, empty> type_v_798;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_799;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_700> AgradDistributionNormalSufficient_v_700;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_701> AgradDistributionNormalSufficient_v_701;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_702> AgradDistributionNormalSufficient_v_702;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_703> AgradDistributionNormalSufficient_v_703;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_704> AgradDistributionNormalSufficient_v_704;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_705> AgradDistributionNormalSufficient_v_705;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_706> AgradDistributionNormalSufficient_v_706;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_707> AgradDistributionNormalSufficient_v_707;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_708> AgradDistributionNormalSufficient_v_708;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_709> AgradDistributionNormalSufficient_v_709;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_710> AgradDistributionNormalSufficient_v_710;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_711> AgradDistributionNormalSufficient_v_711;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_712> AgradDistributionNormalSufficient_v_712;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_713> AgradDistributionNormalSufficient_v_713;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_714> AgradDistributionNormalSufficient_v_714;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_715> AgradDistributionNormalSufficient_v_715;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_716> AgradDistributionNormalSufficient_v_716;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_717> AgradDistributionNormalSufficient_v_717;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_718> AgradDistributionNormalSufficient_v_718;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_719> AgradDistributionNormalSufficient_v_719;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_720> AgradDistributionNormalSufficient_v_720;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_721> AgradDistributionNormalSufficient_v_721;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_722> AgradDistributionNormalSufficient_v_722;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_723> AgradDistributionNormalSufficient_v_723;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_724> AgradDistributionNormalSufficient_v_724;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_725> AgradDistributionNormalSufficient_v_725;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_726> AgradDistributionNormalSufficient_v_726;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_727> AgradDistributionNormalSufficient_v_727;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_728> AgradDistributionNormalSufficient_v_728;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_729> AgradDistributionNormalSufficient_v_729;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_730> AgradDistributionNormalSufficient_v_730;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_731> AgradDistributionNormalSufficient_v_731;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_732> AgradDistributionNormalSufficient_v_732;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_733> AgradDistributionNormalSufficient_v_733;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_734> AgradDistributionNormalSufficient_v_734;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_735> AgradDistributionNormalSufficient_v_735;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_736> AgradDistributionNormalSufficient_v_736;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_737> AgradDistributionNormalSufficient_v_737;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_738> AgradDistributionNormalSufficient_v_738;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_739> AgradDistributionNormalSufficient_v_739;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_740> AgradDistributionNormalSufficient_v_740;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_741> AgradDistributionNormalSufficient_v_741;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_742> AgradDistributionNormalSufficient_v_742;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_743> AgradDistributionNormalSufficient_v_743;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_744> AgradDistributionNormalSufficient_v_744;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_745> AgradDistributionNormalSufficient_v_745;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_746> AgradDistributionNormalSufficient_v_746;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_747> AgradDistributionNormalSufficient_v_747;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_748> AgradDistributionNormalSufficient_v_748;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_749> AgradDistributionNormalSufficient_v_749;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_750> AgradDistributionNormalSufficient_v_750;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_751> AgradDistributionNormalSufficient_v_751;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_752> AgradDistributionNormalSufficient_v_752;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_753> AgradDistributionNormalSufficient_v_753;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_754> AgradDistributionNormalSufficient_v_754;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_755> AgradDistributionNormalSufficient_v_755;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_756> AgradDistributionNormalSufficient_v_756;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_757> AgradDistributionNormalSufficient_v_757;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_758> AgradDistributionNormalSufficient_v_758;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_759> AgradDistributionNormalSufficient_v_759;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_760> AgradDistributionNormalSufficient_v_760;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_761> AgradDistributionNormalSufficient_v_761;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_762> AgradDistributionNormalSufficient_v_762;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_763> AgradDistributionNormalSufficient_v_763;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_764> AgradDistributionNormalSufficient_v_764;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_765> AgradDistributionNormalSufficient_v_765;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_766> AgradDistributionNormalSufficient_v_766;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_767> AgradDistributionNormalSufficient_v_767;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_768> AgradDistributionNormalSufficient_v_768;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_769> AgradDistributionNormalSufficient_v_769;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_770> AgradDistributionNormalSufficient_v_770;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_771> AgradDistributionNormalSufficient_v_771;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_772> AgradDistributionNormalSufficient_v_772;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_773> AgradDistributionNormalSufficient_v_773;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_774> AgradDistributionNormalSufficient_v_774;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_775> AgradDistributionNormalSufficient_v_775;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_776> AgradDistributionNormalSufficient_v_776;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_777> AgradDistributionNormalSufficient_v_777;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_778> AgradDistributionNormalSufficient_v_778;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_779> AgradDistributionNormalSufficient_v_779;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_780> AgradDistributionNormalSufficient_v_780;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_781> AgradDistributionNormalSufficient_v_781;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_782> AgradDistributionNormalSufficient_v_782;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_783> AgradDistributionNormalSufficient_v_783;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_784> AgradDistributionNormalSufficient_v_784;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_785> AgradDistributionNormalSufficient_v_785;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_786> AgradDistributionNormalSufficient_v_786;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_787> AgradDistributionNormalSufficient_v_787;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_788> AgradDistributionNormalSufficient_v_788;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_789> AgradDistributionNormalSufficient_v_789;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_790> AgradDistributionNormalSufficient_v_790;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_791> AgradDistributionNormalSufficient_v_791;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_792> AgradDistributionNormalSufficient_v_792;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_793> AgradDistributionNormalSufficient_v_793;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_794> AgradDistributionNormalSufficient_v_794;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_795> AgradDistributionNormalSufficient_v_795;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_796> AgradDistributionNormalSufficient_v_796;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_797> AgradDistributionNormalSufficient_v_797;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_798> AgradDistributionNormalSufficient_v_798;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_799> AgradDistributionNormalSufficient_v_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_700, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_701, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_702, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_703, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_704, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_705, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_706, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_707, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_708, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_709, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_710, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_711, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_712, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_713, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_714, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_715, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_716, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_717, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_718, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_719, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_720, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_721, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_722, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_723, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_724, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_725, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_726, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_727, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_728, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_729, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_730, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_731, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_732, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_733, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_734, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_735, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_736, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_737, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_738, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_739, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_740, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_741, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_742, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_743, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_744, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_745, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_746, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_747, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_748, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_749, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_750, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_751, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_752, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_753, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_754, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_755, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_756, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_757, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_758, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_759, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_760, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_761, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_762, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_763, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_764, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_765, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_766, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_767, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_768, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_769, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_770, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_771, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_772, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_773, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_774, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_775, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_776, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_777, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_778, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_779, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_780, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_781, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_782, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_783, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_784, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_785, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_786, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_787, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_788, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_789, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_790, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_791, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_792, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_793, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_794, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_795, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_796, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_797, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_798, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_799, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_799);
+
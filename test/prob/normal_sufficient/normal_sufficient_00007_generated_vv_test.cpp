@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_700;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_701;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_702;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_703;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_704;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_705;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_706;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_707;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_708;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_709;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_710;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_711;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_712;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_713;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_714;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_715;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_716;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_717;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_718;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_719;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_720;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_721;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_722;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_723;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_724;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_725;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_726;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_727;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_728;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, var, empty> type_vv_729;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty> type_vv_730;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_731;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty> type_vv_732;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty> type_vv_733;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_734;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_735;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_736;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_737;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, double, empty> type_vv_738;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty> type_vv_739;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_740;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, var, empty> type_vv_741;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty> type_vv_742;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_743;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty> type_vv_744;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty> type_vv_745;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_746;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty> type_vv_747;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty> type_vv_748;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_749;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_750;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_751;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_752;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_753;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_754;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_755;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty> type_vv_756;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty> type_vv_757;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_758;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty> type_vv_759;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_760;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_761;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_762;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_763;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_764;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty> type_vv_765;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty> type_vv_766;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_767;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty> type_vv_768;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty> type_vv_769;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_770;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty> type_vv_771;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_772;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_773;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty> type_vv_774;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_775;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_776;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_777;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_778;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_779;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_780;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_781;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_782;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_783;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_784;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_785;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_786;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_787;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_788;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_789;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_790;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_791;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_792;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_793;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_794;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_795;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_796;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_797;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_798;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_799;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_700> AgradDistributionNormalSufficient_vv_700;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_701> AgradDistributionNormalSufficient_vv_701;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_702> AgradDistributionNormalSufficient_vv_702;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_703> AgradDistributionNormalSufficient_vv_703;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_704> AgradDistributionNormalSufficient_vv_704;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_705> AgradDistributionNormalSufficient_vv_705;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_706> AgradDistributionNormalSufficient_vv_706;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_707> AgradDistributionNormalSufficient_vv_707;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_708> AgradDistributionNormalSufficient_vv_708;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_709> AgradDistributionNormalSufficient_vv_709;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_710> AgradDistributionNormalSufficient_vv_710;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_711> AgradDistributionNormalSufficient_vv_711;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_712> AgradDistributionNormalSufficient_vv_712;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_713> AgradDistributionNormalSufficient_vv_713;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_714> AgradDistributionNormalSufficient_vv_714;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_715> AgradDistributionNormalSufficient_vv_715;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_716> AgradDistributionNormalSufficient_vv_716;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_717> AgradDistributionNormalSufficient_vv_717;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_718> AgradDistributionNormalSufficient_vv_718;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_719> AgradDistributionNormalSufficient_vv_719;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_720> AgradDistributionNormalSufficient_vv_720;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_721> AgradDistributionNormalSufficient_vv_721;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_722> AgradDistributionNormalSufficient_vv_722;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_723> AgradDistributionNormalSufficient_vv_723;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_724> AgradDistributionNormalSufficient_vv_724;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_725> AgradDistributionNormalSufficient_vv_725;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_726> AgradDistributionNormalSufficient_vv_726;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_727> AgradDistributionNormalSufficient_vv_727;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_728> AgradDistributionNormalSufficient_vv_728;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_729> AgradDistributionNormalSufficient_vv_729;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_730> AgradDistributionNormalSufficient_vv_730;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_731> AgradDistributionNormalSufficient_vv_731;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_732> AgradDistributionNormalSufficient_vv_732;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_733> AgradDistributionNormalSufficient_vv_733;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_734> AgradDistributionNormalSufficient_vv_734;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_735> AgradDistributionNormalSufficient_vv_735;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_736> AgradDistributionNormalSufficient_vv_736;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_737> AgradDistributionNormalSufficient_vv_737;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_738> AgradDistributionNormalSufficient_vv_738;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_739> AgradDistributionNormalSufficient_vv_739;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_740> AgradDistributionNormalSufficient_vv_740;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_741> AgradDistributionNormalSufficient_vv_741;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_742> AgradDistributionNormalSufficient_vv_742;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_743> AgradDistributionNormalSufficient_vv_743;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_744> AgradDistributionNormalSufficient_vv_744;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_745> AgradDistributionNormalSufficient_vv_745;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_746> AgradDistributionNormalSufficient_vv_746;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_747> AgradDistributionNormalSufficient_vv_747;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_748> AgradDistributionNormalSufficient_vv_748;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_749> AgradDistributionNormalSufficient_vv_749;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_750> AgradDistributionNormalSufficient_vv_750;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_751> AgradDistributionNormalSufficient_vv_751;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_752> AgradDistributionNormalSufficient_vv_752;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_753> AgradDistributionNormalSufficient_vv_753;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_754> AgradDistributionNormalSufficient_vv_754;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_755> AgradDistributionNormalSufficient_vv_755;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_756> AgradDistributionNormalSufficient_vv_756;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_757> AgradDistributionNormalSufficient_vv_757;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_758> AgradDistributionNormalSufficient_vv_758;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_759> AgradDistributionNormalSufficient_vv_759;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_760> AgradDistributionNormalSufficient_vv_760;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_761> AgradDistributionNormalSufficient_vv_761;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_762> AgradDistributionNormalSufficient_vv_762;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_763> AgradDistributionNormalSufficient_vv_763;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_764> AgradDistributionNormalSufficient_vv_764;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_765> AgradDistributionNormalSufficient_vv_765;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_766> AgradDistributionNormalSufficient_vv_766;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_767> AgradDistributionNormalSufficient_vv_767;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_768> AgradDistributionNormalSufficient_vv_768;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_769> AgradDistributionNormalSufficient_vv_769;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_770> AgradDistributionNormalSufficient_vv_770;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_771> AgradDistributionNormalSufficient_vv_771;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_772> AgradDistributionNormalSufficient_vv_772;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_773> AgradDistributionNormalSufficient_vv_773;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_774> AgradDistributionNormalSufficient_vv_774;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_775> AgradDistributionNormalSufficient_vv_775;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_776> AgradDistributionNormalSufficient_vv_776;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_777> AgradDistributionNormalSufficient_vv_777;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_778> AgradDistributionNormalSufficient_vv_778;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_779> AgradDistributionNormalSufficient_vv_779;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_780> AgradDistributionNormalSufficient_vv_780;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_781> AgradDistributionNormalSufficient_vv_781;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_782> AgradDistributionNormalSufficient_vv_782;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_783> AgradDistributionNormalSufficient_vv_783;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_784> AgradDistributionNormalSufficient_vv_784;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_785> AgradDistributionNormalSufficient_vv_785;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_786> AgradDistributionNormalSufficient_vv_786;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_787> AgradDistributionNormalSufficient_vv_787;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_788> AgradDistributionNormalSufficient_vv_788;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_789> AgradDistributionNormalSufficient_vv_789;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_790> AgradDistributionNormalSufficient_vv_790;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_791> AgradDistributionNormalSufficient_vv_791;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_792> AgradDistributionNormalSufficient_vv_792;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_793> AgradDistributionNormalSufficient_vv_793;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_794> AgradDistributionNormalSufficient_vv_794;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_795> AgradDistributionNormalSufficient_vv_795;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_796> AgradDistributionNormalSufficient_vv_796;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_797> AgradDistributionNormalSufficient_vv_797;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_798> AgradDistributionNormalSufficient_vv_798;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_799> AgradDistributionNormalSufficient_vv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_700, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_701, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_702, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_703, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_704, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_705, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_706, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_707, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_708, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_709, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_710, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_711, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_712, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_713, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_714, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_715, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_716, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_717, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_718, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_719, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_720, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_721, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_722, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_723, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_724, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_725, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_726, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_727, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_728, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_729, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_730, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_731, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_732, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_733, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_734, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_735, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_736, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_737, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_738, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_739, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_740, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_741, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_742, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_743, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_744, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_745, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_746, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_747, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_748, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_749, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_750, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_751, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_752, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_753, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_754, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_755, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_756, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_757, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_758, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_759, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_760, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_761, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_762, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_763, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_764, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_765, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_766, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_767, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_768, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_769, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_770, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_771, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_772, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_773, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_774, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_775, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_776, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_777, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_778, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_779, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_780, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_781, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_782, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_783, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_784, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_785, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_786, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_787, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_788, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_789, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_790, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_791, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_792, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_793, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_794, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_795, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_796, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_797, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_798, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_799, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_800;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_801;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_802;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_803;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_804;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_805;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_806;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_807;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_808;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_809;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, double, double, empty> type_ffv_810;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, double, std::vector<double>, empty> type_ffv_811;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_812;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, double, fvar<fvar<var> >, empty> type_ffv_813;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_814;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_815;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, std::vector<double>, double, empty> type_ffv_816;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, std::vector<double>, std::vector<double>, empty> type_ffv_817;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_818;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_819;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_820;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_821;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_822;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_823;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_824;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_825;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_826;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_827;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, fvar<fvar<var> >, double, empty> type_ffv_828;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_829;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_830;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_831;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_832;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_833;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_834;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_835;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_836;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_837;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_838;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_839;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_840;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_841;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_842;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_843;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_844;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_845;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, double, double, empty> type_ffv_846;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, double, std::vector<double>, empty> type_ffv_847;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_848;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_849;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_850;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_851;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, double, empty> type_ffv_852;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_853;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_854;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_855;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_856;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_857;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_858;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_859;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_860;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_861;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_862;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_863;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_864;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_865;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_866;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_867;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_868;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_869;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_870;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_871;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_872;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_873;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_874;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_875;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_876;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_877;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_878;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_879;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_880;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_881;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_882;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_883;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_884;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_885;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_886;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_887;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_888;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_889;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_890;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_891;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_892;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_893;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_894;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_895;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_896;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_897;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_898;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_899;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_800> AgradDistributionNormalSufficient_ffv_800;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_801> AgradDistributionNormalSufficient_ffv_801;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_802> AgradDistributionNormalSufficient_ffv_802;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_803> AgradDistributionNormalSufficient_ffv_803;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_804> AgradDistributionNormalSufficient_ffv_804;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_805> AgradDistributionNormalSufficient_ffv_805;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_806> AgradDistributionNormalSufficient_ffv_806;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_807> AgradDistributionNormalSufficient_ffv_807;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_808> AgradDistributionNormalSufficient_ffv_808;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_809> AgradDistributionNormalSufficient_ffv_809;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_810> AgradDistributionNormalSufficient_ffv_810;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_811> AgradDistributionNormalSufficient_ffv_811;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_812> AgradDistributionNormalSufficient_ffv_812;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_813> AgradDistributionNormalSufficient_ffv_813;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_814> AgradDistributionNormalSufficient_ffv_814;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_815> AgradDistributionNormalSufficient_ffv_815;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_816> AgradDistributionNormalSufficient_ffv_816;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_817> AgradDistributionNormalSufficient_ffv_817;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_818> AgradDistributionNormalSufficient_ffv_818;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_819> AgradDistributionNormalSufficient_ffv_819;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_820> AgradDistributionNormalSufficient_ffv_820;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_821> AgradDistributionNormalSufficient_ffv_821;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_822> AgradDistributionNormalSufficient_ffv_822;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_823> AgradDistributionNormalSufficient_ffv_823;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_824> AgradDistributionNormalSufficient_ffv_824;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_825> AgradDistributionNormalSufficient_ffv_825;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_826> AgradDistributionNormalSufficient_ffv_826;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_827> AgradDistributionNormalSufficient_ffv_827;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_828> AgradDistributionNormalSufficient_ffv_828;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_829> AgradDistributionNormalSufficient_ffv_829;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_830> AgradDistributionNormalSufficient_ffv_830;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_831> AgradDistributionNormalSufficient_ffv_831;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_832> AgradDistributionNormalSufficient_ffv_832;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_833> AgradDistributionNormalSufficient_ffv_833;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_834> AgradDistributionNormalSufficient_ffv_834;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_835> AgradDistributionNormalSufficient_ffv_835;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_836> AgradDistributionNormalSufficient_ffv_836;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_837> AgradDistributionNormalSufficient_ffv_837;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_838> AgradDistributionNormalSufficient_ffv_838;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_839> AgradDistributionNormalSufficient_ffv_839;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_840> AgradDistributionNormalSufficient_ffv_840;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_841> AgradDistributionNormalSufficient_ffv_841;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_842> AgradDistributionNormalSufficient_ffv_842;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_843> AgradDistributionNormalSufficient_ffv_843;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_844> AgradDistributionNormalSufficient_ffv_844;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_845> AgradDistributionNormalSufficient_ffv_845;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_846> AgradDistributionNormalSufficient_ffv_846;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_847> AgradDistributionNormalSufficient_ffv_847;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_848> AgradDistributionNormalSufficient_ffv_848;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_849> AgradDistributionNormalSufficient_ffv_849;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_850> AgradDistributionNormalSufficient_ffv_850;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_851> AgradDistributionNormalSufficient_ffv_851;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_852> AgradDistributionNormalSufficient_ffv_852;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_853> AgradDistributionNormalSufficient_ffv_853;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_854> AgradDistributionNormalSufficient_ffv_854;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_855> AgradDistributionNormalSufficient_ffv_855;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_856> AgradDistributionNormalSufficient_ffv_856;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_857> AgradDistributionNormalSufficient_ffv_857;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_858> AgradDistributionNormalSufficient_ffv_858;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_859> AgradDistributionNormalSufficient_ffv_859;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_860> AgradDistributionNormalSufficient_ffv_860;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_861> AgradDistributionNormalSufficient_ffv_861;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_862> AgradDistributionNormalSufficient_ffv_862;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_863> AgradDistributionNormalSufficient_ffv_863;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_864> AgradDistributionNormalSufficient_ffv_864;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_865> AgradDistributionNormalSufficient_ffv_865;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_866> AgradDistributionNormalSufficient_ffv_866;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_867> AgradDistributionNormalSufficient_ffv_867;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_868> AgradDistributionNormalSufficient_ffv_868;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_869> AgradDistributionNormalSufficient_ffv_869;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_870> AgradDistributionNormalSufficient_ffv_870;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_871> AgradDistributionNormalSufficient_ffv_871;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_872> AgradDistributionNormalSufficient_ffv_872;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_873> AgradDistributionNormalSufficient_ffv_873;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_874> AgradDistributionNormalSufficient_ffv_874;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_875> AgradDistributionNormalSufficient_ffv_875;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_876> AgradDistributionNormalSufficient_ffv_876;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_877> AgradDistributionNormalSufficient_ffv_877;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_878> AgradDistributionNormalSufficient_ffv_878;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_879> AgradDistributionNormalSufficient_ffv_879;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_880> AgradDistributionNormalSufficient_ffv_880;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_881> AgradDistributionNormalSufficient_ffv_881;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_882> AgradDistributionNormalSufficient_ffv_882;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_883> AgradDistributionNormalSufficient_ffv_883;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_884> AgradDistributionNormalSufficient_ffv_884;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_885> AgradDistributionNormalSufficient_ffv_885;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_886> AgradDistributionNormalSufficient_ffv_886;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_887> AgradDistributionNormalSufficient_ffv_887;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_888> AgradDistributionNormalSufficient_ffv_888;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_889> AgradDistributionNormalSufficient_ffv_889;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_890> AgradDistributionNormalSufficient_ffv_890;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_891> AgradDistributionNormalSufficient_ffv_891;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_892> AgradDistributionNormalSufficient_ffv_892;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_893> AgradDistributionNormalSufficient_ffv_893;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_894> AgradDistributionNormalSufficient_ffv_894;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_895> AgradDistributionNormalSufficient_ffv_895;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_896> AgradDistributionNormalSufficient_ffv_896;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_897> AgradDistributionNormalSufficient_ffv_897;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_898> AgradDistributionNormalSufficient_ffv_898;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_899> AgradDistributionNormalSufficient_ffv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_800, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_801, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_802, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_803, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_804, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_805, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_806, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_807, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_808, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_809, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_810, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_811, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_812, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_813, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_814, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_815, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_816, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_817, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_818, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_819, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_820, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_821, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_822, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_823, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_824, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_825, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_826, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_827, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_828, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_829, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_830, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_831, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_832, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_833, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_834, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_835, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_836, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_837, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_838, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_839, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_840, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_841, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_842, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_843, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_844, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_845, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_846, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_847, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_848, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_849, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_850, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_851, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_852, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_853, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_854, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_855, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_856, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_857, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_858, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_859, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_860, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_861, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_862, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_863, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_864, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_865, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_866, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_867, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_868, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_869, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_870, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_871, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_872, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_873, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_874, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_875, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_876, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_877, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_878, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_879, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_880, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_881, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_882, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_883, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_884, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_885, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_886, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_887, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_888, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_889, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_890, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_891, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_892, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_893, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_894, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_895, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_896, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_897, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_898, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_899, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_800;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<double>, var, empty> type_v_801;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_802;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_803;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_804;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_805;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_806;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_807;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_808;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_809;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, var, double, empty> type_v_810;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, var, std::vector<double>, empty> type_v_811;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_812;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, var, var, empty> type_v_813;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, var, std::vector<var>, empty> type_v_814;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_815;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<var>, double, empty> type_v_816;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_817;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_818;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<var>, var, empty> type_v_819;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_820;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_821;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_822;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_823;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_824;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_825;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_826;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_827;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_828;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_829;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_830;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_831;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_832;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_833;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_834;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_835;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_836;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_837;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_838;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_839;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_840;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_841;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_842;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_843;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_844;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_845;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_846;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_847;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_848;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_849;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_850;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_851;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_852;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_853;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_854;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_855;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_856;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_857;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_858;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_859;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_860;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_861;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_862;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_863;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, double, empty> type_v_864;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_v_865;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_866;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, var, empty> type_v_867;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty> type_v_868;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_869;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_v_870;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_v_871;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_872;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty> type_v_873;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty> type_v_874;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_875;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_876;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_877;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_878;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_879;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_880;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_881;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, double, empty> type_v_882;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty> type_v_883;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_884;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, var, empty> type_v_885;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty> type_v_886;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_887;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty> type_v_888;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty> type_v_889;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_890;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty> type_v_891;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty> type_v_892;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_893;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_894;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_895;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_896;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_897;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_898;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_899;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_800> AgradDistributionNormalSufficient_v_800;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_801> AgradDistributionNormalSufficient_v_801;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_802> AgradDistributionNormalSufficient_v_802;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_803> AgradDistributionNormalSufficient_v_803;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_804> AgradDistributionNormalSufficient_v_804;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_805> AgradDistributionNormalSufficient_v_805;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_806> AgradDistributionNormalSufficient_v_806;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_807> AgradDistributionNormalSufficient_v_807;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_808> AgradDistributionNormalSufficient_v_808;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_809> AgradDistributionNormalSufficient_v_809;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_810> AgradDistributionNormalSufficient_v_810;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_811> AgradDistributionNormalSufficient_v_811;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_812> AgradDistributionNormalSufficient_v_812;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_813> AgradDistributionNormalSufficient_v_813;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_814> AgradDistributionNormalSufficient_v_814;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_815> AgradDistributionNormalSufficient_v_815;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_816> AgradDistributionNormalSufficient_v_816;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_817> AgradDistributionNormalSufficient_v_817;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_818> AgradDistributionNormalSufficient_v_818;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_819> AgradDistributionNormalSufficient_v_819;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_820> AgradDistributionNormalSufficient_v_820;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_821> AgradDistributionNormalSufficient_v_821;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_822> AgradDistributionNormalSufficient_v_822;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_823> AgradDistributionNormalSufficient_v_823;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_824> AgradDistributionNormalSufficient_v_824;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_825> AgradDistributionNormalSufficient_v_825;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_826> AgradDistributionNormalSufficient_v_826;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_827> AgradDistributionNormalSufficient_v_827;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_828> AgradDistributionNormalSufficient_v_828;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_829> AgradDistributionNormalSufficient_v_829;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_830> AgradDistributionNormalSufficient_v_830;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_831> AgradDistributionNormalSufficient_v_831;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_832> AgradDistributionNormalSufficient_v_832;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_833> AgradDistributionNormalSufficient_v_833;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_834> AgradDistributionNormalSufficient_v_834;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_835> AgradDistributionNormalSufficient_v_835;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_836> AgradDistributionNormalSufficient_v_836;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_837> AgradDistributionNormalSufficient_v_837;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_838> AgradDistributionNormalSufficient_v_838;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_839> AgradDistributionNormalSufficient_v_839;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_840> AgradDistributionNormalSufficient_v_840;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_841> AgradDistributionNormalSufficient_v_841;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_842> AgradDistributionNormalSufficient_v_842;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_843> AgradDistributionNormalSufficient_v_843;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_844> AgradDistributionNormalSufficient_v_844;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_845> AgradDistributionNormalSufficient_v_845;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_846> AgradDistributionNormalSufficient_v_846;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_847> AgradDistributionNormalSufficient_v_847;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_848> AgradDistributionNormalSufficient_v_848;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_849> AgradDistributionNormalSufficient_v_849;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_850> AgradDistributionNormalSufficient_v_850;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_851> AgradDistributionNormalSufficient_v_851;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_852> AgradDistributionNormalSufficient_v_852;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_853> AgradDistributionNormalSufficient_v_853;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_854> AgradDistributionNormalSufficient_v_854;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_855> AgradDistributionNormalSufficient_v_855;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_856> AgradDistributionNormalSufficient_v_856;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_857> AgradDistributionNormalSufficient_v_857;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_858> AgradDistributionNormalSufficient_v_858;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_859> AgradDistributionNormalSufficient_v_859;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_860> AgradDistributionNormalSufficient_v_860;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_861> AgradDistributionNormalSufficient_v_861;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_862> AgradDistributionNormalSufficient_v_862;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_863> AgradDistributionNormalSufficient_v_863;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_864> AgradDistributionNormalSufficient_v_864;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_865> AgradDistributionNormalSufficient_v_865;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_866> AgradDistributionNormalSufficient_v_866;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_867> AgradDistributionNormalSufficient_v_867;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_868> AgradDistributionNormalSufficient_v_868;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_869> AgradDistributionNormalSufficient_v_869;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_870> AgradDistributionNormalSufficient_v_870;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_871> AgradDistributionNormalSufficient_v_871;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_872> AgradDistributionNormalSufficient_v_872;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_873> AgradDistributionNormalSufficient_v_873;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_874> AgradDistributionNormalSufficient_v_874;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_875> AgradDistributionNormalSufficient_v_875;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_876> AgradDistributionNormalSufficient_v_876;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_877> AgradDistributionNormalSufficient_v_877;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_878> AgradDistributionNormalSufficient_v_878;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_879> AgradDistributionNormalSufficient_v_879;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_880> AgradDistributionNormalSufficient_v_880;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_881> AgradDistributionNormalSufficient_v_881;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_882> AgradDistributionNormalSufficient_v_882;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_883> AgradDistributionNormalSufficient_v_883;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_884> AgradDistributionNormalSufficient_v_884;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_885> AgradDistributionNormalSufficient_v_885;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_886> AgradDistributionNormalSufficient_v_886;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_887> AgradDistributionNormalSufficient_v_887;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_888> AgradDistributionNormalSufficient_v_888;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_889> AgradDistributionNormalSufficient_v_889;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_890> AgradDistributionNormalSufficient_v_890;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_891> AgradDistributionNormalSufficient_v_891;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_892> AgradDistributionNormalSufficient_v_892;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_893> AgradDistributionNormalSufficient_v_893;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_894> AgradDistributionNormalSufficient_v_894;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_895> AgradDistributionNormalSufficient_v_895;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_896> AgradDistributionNormalSufficient_v_896;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_897> AgradDistributionNormalSufficient_v_897;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_898> AgradDistributionNormalSufficient_v_898;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_899> AgradDistributionNormalSufficient_v_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_800, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_801, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_802, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_803, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_804, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_805, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_806, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_807, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_808, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_809, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_810, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_811, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_812, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_813, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_814, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_815, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_816, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_817, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_818, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_819, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_820, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_821, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_822, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_823, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_824, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_825, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_826, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_827, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_828, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_829, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_830, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_831, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_832, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_833, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_834, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_835, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_836, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_837, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_838, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_839, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_840, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_841, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_842, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_843, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_844, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_845, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_846, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_847, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_848, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_849, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_850, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_851, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_852, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_853, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_854, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_855, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_856, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_857, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_858, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_859, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_860, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_861, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_862, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_863, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_864, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_865, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_866, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_867, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_868, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_869, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_870, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_871, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_872, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_873, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_874, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_875, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_876, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_877, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_878, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_879, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_880, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_881, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_882, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_883, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_884, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_885, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_886, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_887, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_888, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_889, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_890, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_891, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_892, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_893, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_894, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_895, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_896, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_897, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_898, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_899, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_800;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_801;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_802;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_803;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_804;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_805;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_806;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_807;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_808;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_809;
+typedef std::tuple<std::vector<double>, var, int, double, double, empty> type_vv_810;
+typedef std::tuple<std::vector<double>, var, int, double, std::vector<double>, empty> type_vv_811;
+typedef std::tuple<std::vector<double>, var, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_812;
+typedef std::tuple<std::vector<double>, var, int, double, var, empty> type_vv_813;
+typedef std::tuple<std::vector<double>, var, int, double, std::vector<var>, empty> type_vv_814;
+typedef std::tuple<std::vector<double>, var, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_815;
+typedef std::tuple<std::vector<double>, var, int, std::vector<double>, double, empty> type_vv_816;
+typedef std::tuple<std::vector<double>, var, int, std::vector<double>, std::vector<double>, empty> type_vv_817;
+typedef std::tuple<std::vector<double>, var, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_818;
+typedef std::tuple<std::vector<double>, var, int, std::vector<double>, var, empty> type_vv_819;
+typedef std::tuple<std::vector<double>, var, int, std::vector<double>, std::vector<var>, empty> type_vv_820;
+typedef std::tuple<std::vector<double>, var, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_821;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_822;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_823;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_824;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_825;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_826;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_827;
+typedef std::tuple<std::vector<double>, var, int, var, double, empty> type_vv_828;
+typedef std::tuple<std::vector<double>, var, int, var, std::vector<double>, empty> type_vv_829;
+typedef std::tuple<std::vector<double>, var, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_830;
+typedef std::tuple<std::vector<double>, var, int, var, var, empty> type_vv_831;
+typedef std::tuple<std::vector<double>, var, int, var, std::vector<var>, empty> type_vv_832;
+typedef std::tuple<std::vector<double>, var, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_833;
+typedef std::tuple<std::vector<double>, var, int, std::vector<var>, double, empty> type_vv_834;
+typedef std::tuple<std::vector<double>, var, int, std::vector<var>, std::vector<double>, empty> type_vv_835;
+typedef std::tuple<std::vector<double>, var, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_836;
+typedef std::tuple<std::vector<double>, var, int, std::vector<var>, var, empty> type_vv_837;
+typedef std::tuple<std::vector<double>, var, int, std::vector<var>, std::vector<var>, empty> type_vv_838;
+typedef std::tuple<std::vector<double>, var, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_839;
+typedef std::tuple<std::vector<double>, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_840;
+typedef std::tuple<std::vector<double>, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_841;
+typedef std::tuple<std::vector<double>, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_842;
+typedef std::tuple<std::vector<double>, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_843;
+typedef std::tuple<std::vector<double>, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_844;
+typedef std::tuple<std::vector<double>, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_845;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, double, double, empty> type_vv_846;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, double, std::vector<double>, empty> type_vv_847;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_848;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, double, var, empty> type_vv_849;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, double, std::vector<var>, empty> type_vv_850;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_851;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<double>, double, empty> type_vv_852;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_853;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_854;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<double>, var, empty> type_vv_855;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_856;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_857;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_858;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_859;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_860;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_861;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_862;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_863;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, var, double, empty> type_vv_864;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, var, std::vector<double>, empty> type_vv_865;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_866;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, var, var, empty> type_vv_867;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, var, std::vector<var>, empty> type_vv_868;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_869;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<var>, double, empty> type_vv_870;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_871;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_872;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<var>, var, empty> type_vv_873;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_874;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_875;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_876;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_877;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_878;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_879;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_880;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_881;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_882;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_883;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_884;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_885;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_886;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_887;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_888;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_889;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_890;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_891;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_892;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_893;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_894;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_895;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_896;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_897;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_898;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_899;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_800> AgradDistributionNormalSufficient_vv_800;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_801> AgradDistributionNormalSufficient_vv_801;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_802> AgradDistributionNormalSufficient_vv_802;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_803> AgradDistributionNormalSufficient_vv_803;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_804> AgradDistributionNormalSufficient_vv_804;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_805> AgradDistributionNormalSufficient_vv_805;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_806> AgradDistributionNormalSufficient_vv_806;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_807> AgradDistributionNormalSufficient_vv_807;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_808> AgradDistributionNormalSufficient_vv_808;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_809> AgradDistributionNormalSufficient_vv_809;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_810> AgradDistributionNormalSufficient_vv_810;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_811> AgradDistributionNormalSufficient_vv_811;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_812> AgradDistributionNormalSufficient_vv_812;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_813> AgradDistributionNormalSufficient_vv_813;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_814> AgradDistributionNormalSufficient_vv_814;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_815> AgradDistributionNormalSufficient_vv_815;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_816> AgradDistributionNormalSufficient_vv_816;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_817> AgradDistributionNormalSufficient_vv_817;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_818> AgradDistributionNormalSufficient_vv_818;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_819> AgradDistributionNormalSufficient_vv_819;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_820> AgradDistributionNormalSufficient_vv_820;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_821> AgradDistributionNormalSufficient_vv_821;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_822> AgradDistributionNormalSufficient_vv_822;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_823> AgradDistributionNormalSufficient_vv_823;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_824> AgradDistributionNormalSufficient_vv_824;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_825> AgradDistributionNormalSufficient_vv_825;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_826> AgradDistributionNormalSufficient_vv_826;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_827> AgradDistributionNormalSufficient_vv_827;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_828> AgradDistributionNormalSufficient_vv_828;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_829> AgradDistributionNormalSufficient_vv_829;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_830> AgradDistributionNormalSufficient_vv_830;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_831> AgradDistributionNormalSufficient_vv_831;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_832> AgradDistributionNormalSufficient_vv_832;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_833> AgradDistributionNormalSufficient_vv_833;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_834> AgradDistributionNormalSufficient_vv_834;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_835> AgradDistributionNormalSufficient_vv_835;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_836> AgradDistributionNormalSufficient_vv_836;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_837> AgradDistributionNormalSufficient_vv_837;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_838> AgradDistributionNormalSufficient_vv_838;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_839> AgradDistributionNormalSufficient_vv_839;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_840> AgradDistributionNormalSufficient_vv_840;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_841> AgradDistributionNormalSufficient_vv_841;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_842> AgradDistributionNormalSufficient_vv_842;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_843> AgradDistributionNormalSufficient_vv_843;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_844> AgradDistributionNormalSufficient_vv_844;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_845> AgradDistributionNormalSufficient_vv_845;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_846> AgradDistributionNormalSufficient_vv_846;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_847> AgradDistributionNormalSufficient_vv_847;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_848> AgradDistributionNormalSufficient_vv_848;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_849> AgradDistributionNormalSufficient_vv_849;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_850> AgradDistributionNormalSufficient_vv_850;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_851> AgradDistributionNormalSufficient_vv_851;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_852> AgradDistributionNormalSufficient_vv_852;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_853> AgradDistributionNormalSufficient_vv_853;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_854> AgradDistributionNormalSufficient_vv_854;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_855> AgradDistributionNormalSufficient_vv_855;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_856> AgradDistributionNormalSufficient_vv_856;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_857> AgradDistributionNormalSufficient_vv_857;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_858> AgradDistributionNormalSufficient_vv_858;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_859> AgradDistributionNormalSufficient_vv_859;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_860> AgradDistributionNormalSufficient_vv_860;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_861> AgradDistributionNormalSufficient_vv_861;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_862> AgradDistributionNormalSufficient_vv_862;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_863> AgradDistributionNormalSufficient_vv_863;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_864> AgradDistributionNormalSufficient_vv_864;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_865> AgradDistributionNormalSufficient_vv_865;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_866> AgradDistributionNormalSufficient_vv_866;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_867> AgradDistributionNormalSufficient_vv_867;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_868> AgradDistributionNormalSufficient_vv_868;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_869> AgradDistributionNormalSufficient_vv_869;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_870> AgradDistributionNormalSufficient_vv_870;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_871> AgradDistributionNormalSufficient_vv_871;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_872> AgradDistributionNormalSufficient_vv_872;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_873> AgradDistributionNormalSufficient_vv_873;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_874> AgradDistributionNormalSufficient_vv_874;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_875> AgradDistributionNormalSufficient_vv_875;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_876> AgradDistributionNormalSufficient_vv_876;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_877> AgradDistributionNormalSufficient_vv_877;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_878> AgradDistributionNormalSufficient_vv_878;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_879> AgradDistributionNormalSufficient_vv_879;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_880> AgradDistributionNormalSufficient_vv_880;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_881> AgradDistributionNormalSufficient_vv_881;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_882> AgradDistributionNormalSufficient_vv_882;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_883> AgradDistributionNormalSufficient_vv_883;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_884> AgradDistributionNormalSufficient_vv_884;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_885> AgradDistributionNormalSufficient_vv_885;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_886> AgradDistributionNormalSufficient_vv_886;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_887> AgradDistributionNormalSufficient_vv_887;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_888> AgradDistributionNormalSufficient_vv_888;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_889> AgradDistributionNormalSufficient_vv_889;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_890> AgradDistributionNormalSufficient_vv_890;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_891> AgradDistributionNormalSufficient_vv_891;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_892> AgradDistributionNormalSufficient_vv_892;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_893> AgradDistributionNormalSufficient_vv_893;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_894> AgradDistributionNormalSufficient_vv_894;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_895> AgradDistributionNormalSufficient_vv_895;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_896> AgradDistributionNormalSufficient_vv_896;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_897> AgradDistributionNormalSufficient_vv_897;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_898> AgradDistributionNormalSufficient_vv_898;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_899> AgradDistributionNormalSufficient_vv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_800, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_801, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_802, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_803, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_804, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_805, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_806, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_807, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_808, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_809, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_810, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_811, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_812, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_813, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_814, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_815, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_816, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_817, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_818, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_819, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_820, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_821, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_822, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_823, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_824, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_825, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_826, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_827, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_828, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_829, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_830, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_831, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_832, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_833, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_834, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_835, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_836, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_837, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_838, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_839, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_840, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_841, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_842, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_843, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_844, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_845, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_846, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_847, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_848, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_849, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_850, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_851, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_852, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_853, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_854, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_855, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_856, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_857, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_858, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_859, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_860, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_861, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_862, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_863, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_864, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_865, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_866, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_867, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_868, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_869, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_870, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_871, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_872, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_873, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_874, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_875, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_876, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_877, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_878, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_879, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_880, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_881, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_882, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_883, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_884, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_885, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_886, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_887, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_888, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_889, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_890, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_891, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_892, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_893, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_894, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_895, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_896, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_897, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_898, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_899, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_900;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_901;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_902;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_903;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_904;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_905;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_906;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_907;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_908;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_909;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_910;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_911;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_912;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_913;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_914;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_915;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_916;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_917;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, double, double, empty> type_ffv_918;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, double, std::vector<double>, empty> type_ffv_919;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_920;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, double, fvar<fvar<var> >, empty> type_ffv_921;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_922;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_923;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, double, empty> type_ffv_924;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, std::vector<double>, empty> type_ffv_925;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_926;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_927;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_928;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_929;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_930;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_931;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_932;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_933;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_934;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_935;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, double, empty> type_ffv_936;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_937;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_938;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_939;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_940;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_941;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_942;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_943;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_944;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_945;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_946;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_947;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_948;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_949;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_950;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_951;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_952;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_953;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, double, empty> type_ffv_954;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, std::vector<double>, empty> type_ffv_955;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_956;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_957;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_958;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_959;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, double, empty> type_ffv_960;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_961;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_962;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_963;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_964;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_965;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_966;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_967;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_968;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_969;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_970;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_971;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_972;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_973;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_974;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_975;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_976;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_977;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_978;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_979;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_980;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_981;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_982;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_983;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_984;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_985;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_986;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_987;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_988;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_989;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_990;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_991;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_992;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_993;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_994;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_995;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_996;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_997;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_998;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_999;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_900> AgradDistributionNormalSufficient_ffv_900;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_901> AgradDistributionNormalSufficient_ffv_901;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_902> AgradDistributionNormalSufficient_ffv_902;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_903> AgradDistributionNormalSufficient_ffv_903;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_904> AgradDistributionNormalSufficient_ffv_904;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_905> AgradDistributionNormalSufficient_ffv_905;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_906> AgradDistributionNormalSufficient_ffv_906;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_907> AgradDistributionNormalSufficient_ffv_907;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_908> AgradDistributionNormalSufficient_ffv_908;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_909> AgradDistributionNormalSufficient_ffv_909;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_910> AgradDistributionNormalSufficient_ffv_910;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_911> AgradDistributionNormalSufficient_ffv_911;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_912> AgradDistributionNormalSufficient_ffv_912;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_913> AgradDistributionNormalSufficient_ffv_913;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_914> AgradDistributionNormalSufficient_ffv_914;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_915> AgradDistributionNormalSufficient_ffv_915;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_916> AgradDistributionNormalSufficient_ffv_916;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_917> AgradDistributionNormalSufficient_ffv_917;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_918> AgradDistributionNormalSufficient_ffv_918;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_919> AgradDistributionNormalSufficient_ffv_919;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_920> AgradDistributionNormalSufficient_ffv_920;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_921> AgradDistributionNormalSufficient_ffv_921;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_922> AgradDistributionNormalSufficient_ffv_922;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_923> AgradDistributionNormalSufficient_ffv_923;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_924> AgradDistributionNormalSufficient_ffv_924;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_925> AgradDistributionNormalSufficient_ffv_925;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_926> AgradDistributionNormalSufficient_ffv_926;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_927> AgradDistributionNormalSufficient_ffv_927;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_928> AgradDistributionNormalSufficient_ffv_928;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_929> AgradDistributionNormalSufficient_ffv_929;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_930> AgradDistributionNormalSufficient_ffv_930;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_931> AgradDistributionNormalSufficient_ffv_931;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_932> AgradDistributionNormalSufficient_ffv_932;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_933> AgradDistributionNormalSufficient_ffv_933;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_934> AgradDistributionNormalSufficient_ffv_934;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_935> AgradDistributionNormalSufficient_ffv_935;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_936> AgradDistributionNormalSufficient_ffv_936;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_937> AgradDistributionNormalSufficient_ffv_937;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_938> AgradDistributionNormalSufficient_ffv_938;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_939> AgradDistributionNormalSufficient_ffv_939;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_940> AgradDistributionNormalSufficient_ffv_940;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_941> AgradDistributionNormalSufficient_ffv_941;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_942> AgradDistributionNormalSufficient_ffv_942;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_943> AgradDistributionNormalSufficient_ffv_943;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_944> AgradDistributionNormalSufficient_ffv_944;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_945> AgradDistributionNormalSufficient_ffv_945;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_946> AgradDistributionNormalSufficient_ffv_946;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_947> AgradDistributionNormalSufficient_ffv_947;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_948> AgradDistributionNormalSufficient_ffv_948;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_949> AgradDistributionNormalSufficient_ffv_949;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_950> AgradDistributionNormalSufficient_ffv_950;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_951> AgradDistributionNormalSufficient_ffv_951;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_952> AgradDistributionNormalSufficient_ffv_952;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_953> AgradDistributionNormalSufficient_ffv_953;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_954> AgradDistributionNormalSufficient_ffv_954;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_955> AgradDistributionNormalSufficient_ffv_955;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_956> AgradDistributionNormalSufficient_ffv_956;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_957> AgradDistributionNormalSufficient_ffv_957;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_958> AgradDistributionNormalSufficient_ffv_958;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_959> AgradDistributionNormalSufficient_ffv_959;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_960> AgradDistributionNormalSufficient_ffv_960;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_961> AgradDistributionNormalSufficient_ffv_961;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_962> AgradDistributionNormalSufficient_ffv_962;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_963> AgradDistributionNormalSufficient_ffv_963;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_964> AgradDistributionNormalSufficient_ffv_964;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_965> AgradDistributionNormalSufficient_ffv_965;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_966> AgradDistributionNormalSufficient_ffv_966;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_967> AgradDistributionNormalSufficient_ffv_967;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_968> AgradDistributionNormalSufficient_ffv_968;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_969> AgradDistributionNormalSufficient_ffv_969;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_970> AgradDistributionNormalSufficient_ffv_970;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_971> AgradDistributionNormalSufficient_ffv_971;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_972> AgradDistributionNormalSufficient_ffv_972;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_973> AgradDistributionNormalSufficient_ffv_973;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_974> AgradDistributionNormalSufficient_ffv_974;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_975> AgradDistributionNormalSufficient_ffv_975;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_976> AgradDistributionNormalSufficient_ffv_976;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_977> AgradDistributionNormalSufficient_ffv_977;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_978> AgradDistributionNormalSufficient_ffv_978;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_979> AgradDistributionNormalSufficient_ffv_979;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_980> AgradDistributionNormalSufficient_ffv_980;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_981> AgradDistributionNormalSufficient_ffv_981;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_982> AgradDistributionNormalSufficient_ffv_982;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_983> AgradDistributionNormalSufficient_ffv_983;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_984> AgradDistributionNormalSufficient_ffv_984;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_985> AgradDistributionNormalSufficient_ffv_985;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_986> AgradDistributionNormalSufficient_ffv_986;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_987> AgradDistributionNormalSufficient_ffv_987;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_988> AgradDistributionNormalSufficient_ffv_988;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_989> AgradDistributionNormalSufficient_ffv_989;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_990> AgradDistributionNormalSufficient_ffv_990;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_991> AgradDistributionNormalSufficient_ffv_991;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_992> AgradDistributionNormalSufficient_ffv_992;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_993> AgradDistributionNormalSufficient_ffv_993;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_994> AgradDistributionNormalSufficient_ffv_994;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_995> AgradDistributionNormalSufficient_ffv_995;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_996> AgradDistributionNormalSufficient_ffv_996;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_997> AgradDistributionNormalSufficient_ffv_997;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_998> AgradDistributionNormalSufficient_ffv_998;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_999> AgradDistributionNormalSufficient_ffv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_900, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_901, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_902, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_903, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_904, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_905, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_906, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_907, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_908, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_909, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_910, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_911, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_912, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_913, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_914, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_915, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_916, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_917, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_918, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_919, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_920, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_921, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_922, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_923, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_924, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_925, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_926, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_927, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_928, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_929, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_930, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_931, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_932, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_933, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_934, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_935, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_936, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_937, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_938, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_939, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_940, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_941, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_942, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_943, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_944, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_945, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_946, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_947, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_948, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_949, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_950, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_951, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_952, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_953, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_954, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_955, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_956, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_957, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_958, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_959, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_960, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_961, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_962, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_963, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_964, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_965, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_966, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_967, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_968, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_969, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_970, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_971, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_972, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_973, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_974, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_975, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_976, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_977, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_978, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_979, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_980, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_981, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_982, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_983, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_984, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_985, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_986, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_987, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_988, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_989, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_990, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_991, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_992, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_993, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_994, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_995, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_996, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_997, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_998, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_999, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_999);
+
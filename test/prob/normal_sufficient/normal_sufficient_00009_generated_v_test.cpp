@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty> type_v_900;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty> type_v_901;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_902;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty> type_v_903;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty> type_v_904;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_905;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_v_906;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_907;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_908;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty> type_v_909;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_910;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_911;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_912;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_913;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_914;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_915;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_916;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_917;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty> type_v_918;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty> type_v_919;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_920;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty> type_v_921;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty> type_v_922;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_923;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty> type_v_924;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_925;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_926;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty> type_v_927;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_928;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_929;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_930;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_931;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_932;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_933;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_934;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_935;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_936;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_937;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_938;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_939;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_940;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_941;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_942;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_943;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_944;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_945;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_946;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_947;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_948;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_949;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_950;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_951;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_952;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_953;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_954;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_955;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_956;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_957;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_958;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_959;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_960;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_961;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_962;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_963;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_964;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_965;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_966;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_967;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_968;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_969;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_970;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_971;
+typedef std::tuple<std::vector<double>, var, int, double, double, empty> type_v_972;
+typedef std::tuple<std::vector<double>, var, int, double, std::vector<double>, empty> type_v_973;
+typedef std::tuple<std::vector<double>, var, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_974;
+typedef std::tuple<std::vector<double>, var, int, double, var, empty> type_v_975;
+typedef std::tuple<std::vector<double>, var, int, double, std::vector<var>, empty> type_v_976;
+typedef std::tuple<std::vector<double>, var, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_977;
+typedef std::tuple<std::vector<double>, var, int, std::vector<double>, double, empty> type_v_978;
+typedef std::tuple<std::vector<double>, var, int, std::vector<double>, std::vector<double>, empty> type_v_979;
+typedef std::tuple<std::vector<double>, var, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_980;
+typedef std::tuple<std::vector<double>, var, int, std::vector<double>, var, empty> type_v_981;
+typedef std::tuple<std::vector<double>, var, int, std::vector<double>, std::vector<var>, empty> type_v_982;
+typedef std::tuple<std::vector<double>, var, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_983;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_984;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_985;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_986;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_987;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_988;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_989;
+typedef std::tuple<std::vector<double>, var, int, var, double, empty> type_v_990;
+typedef std::tuple<std::vector<double>, var, int, var, std::vector<double>, empty> type_v_991;
+typedef std::tuple<std::vector<double>, var, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_992;
+typedef std::tuple<std::vector<double>, var, int, var, var, empty> type_v_993;
+typedef std::tuple<std::vector<double>, var, int, var, std::vector<var>, empty> type_v_994;
+typedef std::tuple<std::vector<double>, var, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_995;
+typedef std::tuple<std::vector<double>, var, int, std::vector<var>, double, empty> type_v_996;
+typedef std::tuple<std::vector<double>, var, int, std::vector<var>, std::vector<double>, empty> type_v_997;
+typedef std::tuple<std::vector<double>, var, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_998;
+typedef std::tuple<std::vector<double>, var, int, std::vector<var>, var, empty> type_v_999;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_900> AgradDistributionNormalSufficient_v_900;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_901> AgradDistributionNormalSufficient_v_901;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_902> AgradDistributionNormalSufficient_v_902;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_903> AgradDistributionNormalSufficient_v_903;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_904> AgradDistributionNormalSufficient_v_904;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_905> AgradDistributionNormalSufficient_v_905;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_906> AgradDistributionNormalSufficient_v_906;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_907> AgradDistributionNormalSufficient_v_907;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_908> AgradDistributionNormalSufficient_v_908;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_909> AgradDistributionNormalSufficient_v_909;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_910> AgradDistributionNormalSufficient_v_910;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_911> AgradDistributionNormalSufficient_v_911;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_912> AgradDistributionNormalSufficient_v_912;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_913> AgradDistributionNormalSufficient_v_913;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_914> AgradDistributionNormalSufficient_v_914;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_915> AgradDistributionNormalSufficient_v_915;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_916> AgradDistributionNormalSufficient_v_916;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_917> AgradDistributionNormalSufficient_v_917;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_918> AgradDistributionNormalSufficient_v_918;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_919> AgradDistributionNormalSufficient_v_919;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_920> AgradDistributionNormalSufficient_v_920;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_921> AgradDistributionNormalSufficient_v_921;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_922> AgradDistributionNormalSufficient_v_922;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_923> AgradDistributionNormalSufficient_v_923;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_924> AgradDistributionNormalSufficient_v_924;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_925> AgradDistributionNormalSufficient_v_925;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_926> AgradDistributionNormalSufficient_v_926;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_927> AgradDistributionNormalSufficient_v_927;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_928> AgradDistributionNormalSufficient_v_928;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_929> AgradDistributionNormalSufficient_v_929;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_930> AgradDistributionNormalSufficient_v_930;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_931> AgradDistributionNormalSufficient_v_931;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_932> AgradDistributionNormalSufficient_v_932;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_933> AgradDistributionNormalSufficient_v_933;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_934> AgradDistributionNormalSufficient_v_934;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_935> AgradDistributionNormalSufficient_v_935;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_936> AgradDistributionNormalSufficient_v_936;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_937> AgradDistributionNormalSufficient_v_937;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_938> AgradDistributionNormalSufficient_v_938;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_939> AgradDistributionNormalSufficient_v_939;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_940> AgradDistributionNormalSufficient_v_940;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_941> AgradDistributionNormalSufficient_v_941;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_942> AgradDistributionNormalSufficient_v_942;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_943> AgradDistributionNormalSufficient_v_943;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_944> AgradDistributionNormalSufficient_v_944;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_945> AgradDistributionNormalSufficient_v_945;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_946> AgradDistributionNormalSufficient_v_946;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_947> AgradDistributionNormalSufficient_v_947;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_948> AgradDistributionNormalSufficient_v_948;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_949> AgradDistributionNormalSufficient_v_949;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_950> AgradDistributionNormalSufficient_v_950;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_951> AgradDistributionNormalSufficient_v_951;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_952> AgradDistributionNormalSufficient_v_952;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_953> AgradDistributionNormalSufficient_v_953;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_954> AgradDistributionNormalSufficient_v_954;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_955> AgradDistributionNormalSufficient_v_955;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_956> AgradDistributionNormalSufficient_v_956;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_957> AgradDistributionNormalSufficient_v_957;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_958> AgradDistributionNormalSufficient_v_958;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_959> AgradDistributionNormalSufficient_v_959;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_960> AgradDistributionNormalSufficient_v_960;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_961> AgradDistributionNormalSufficient_v_961;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_962> AgradDistributionNormalSufficient_v_962;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_963> AgradDistributionNormalSufficient_v_963;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_964> AgradDistributionNormalSufficient_v_964;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_965> AgradDistributionNormalSufficient_v_965;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_966> AgradDistributionNormalSufficient_v_966;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_967> AgradDistributionNormalSufficient_v_967;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_968> AgradDistributionNormalSufficient_v_968;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_969> AgradDistributionNormalSufficient_v_969;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_970> AgradDistributionNormalSufficient_v_970;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_971> AgradDistributionNormalSufficient_v_971;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_972> AgradDistributionNormalSufficient_v_972;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_973> AgradDistributionNormalSufficient_v_973;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_974> AgradDistributionNormalSufficient_v_974;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_975> AgradDistributionNormalSufficient_v_975;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_976> AgradDistributionNormalSufficient_v_976;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_977> AgradDistributionNormalSufficient_v_977;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_978> AgradDistributionNormalSufficient_v_978;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_979> AgradDistributionNormalSufficient_v_979;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_980> AgradDistributionNormalSufficient_v_980;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_981> AgradDistributionNormalSufficient_v_981;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_982> AgradDistributionNormalSufficient_v_982;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_983> AgradDistributionNormalSufficient_v_983;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_984> AgradDistributionNormalSufficient_v_984;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_985> AgradDistributionNormalSufficient_v_985;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_986> AgradDistributionNormalSufficient_v_986;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_987> AgradDistributionNormalSufficient_v_987;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_988> AgradDistributionNormalSufficient_v_988;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_989> AgradDistributionNormalSufficient_v_989;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_990> AgradDistributionNormalSufficient_v_990;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_991> AgradDistributionNormalSufficient_v_991;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_992> AgradDistributionNormalSufficient_v_992;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_993> AgradDistributionNormalSufficient_v_993;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_994> AgradDistributionNormalSufficient_v_994;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_995> AgradDistributionNormalSufficient_v_995;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_996> AgradDistributionNormalSufficient_v_996;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_997> AgradDistributionNormalSufficient_v_997;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_998> AgradDistributionNormalSufficient_v_998;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_999> AgradDistributionNormalSufficient_v_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_900, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_901, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_902, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_903, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_904, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_905, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_906, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_907, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_908, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_909, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_910, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_911, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_912, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_913, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_914, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_915, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_916, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_917, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_918, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_919, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_920, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_921, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_922, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_923, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_924, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_925, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_926, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_927, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_928, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_929, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_930, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_931, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_932, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_933, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_934, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_935, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_936, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_937, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_938, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_939, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_940, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_941, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_942, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_943, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_944, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_945, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_946, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_947, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_948, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_949, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_950, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_951, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_952, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_953, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_954, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_955, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_956, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_957, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_958, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_959, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_960, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_961, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_962, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_963, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_964, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_965, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_966, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_967, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_968, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_969, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_970, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_971, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_972, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_973, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_974, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_975, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_976, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_977, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_978, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_979, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_980, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_981, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_982, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_983, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_984, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_985, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_986, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_987, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_988, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_989, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_990, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_991, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_992, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_993, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_994, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_995, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_996, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_997, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_998, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_999, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_999);
+